@@ -35,7 +35,8 @@ namespace ApplicationStatusMapper
 {
 AWS_MIGRATIONHUB_API ApplicationStatus GetApplicationStatusForName(const Aws::String& name);
 
-AWS_MIGRATIONHUB_API Aws::String GetNameForApplicationStatus(ApplicationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MIGRATIONHUB_API const char* GetNameForApplicationStatus(ApplicationStatus value);
 } // namespace ApplicationStatusMapper
 } // namespace Model
 } // namespace MigrationHub
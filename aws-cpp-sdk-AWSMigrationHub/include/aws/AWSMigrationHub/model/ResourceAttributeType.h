@@ -42,7 +42,8 @@ namespace ResourceAttributeTypeMapper
 {
 AWS_MIGRATIONHUB_API ResourceAttributeType GetResourceAttributeTypeForName(const Aws::String& name);
 
-AWS_MIGRATIONHUB_API Aws::String GetNameForResourceAttributeType(ResourceAttributeType value);
+// names of values not modeled point into the enum overflow container
+AWS_MIGRATIONHUB_API const char* GetNameForResourceAttributeType(ResourceAttributeType value);
 } // namespace ResourceAttributeTypeMapper
 } // namespace Model
 } // namespace MigrationHub
@@ -110,10 +110,8 @@ void MigrationHubClient::init(const ClientConfiguration& config)
 
 AssociateCreatedArtifactOutcome MigrationHubClient::AssociateCreatedArtifact(const AssociateCreatedArtifactRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -127,10 +125,10 @@ AssociateCreatedArtifactOutcome MigrationHubClient::AssociateCreatedArtifact(con
 
 AssociateCreatedArtifactOutcomeCallable MigrationHubClient::AssociateCreatedArtifactCallable(const AssociateCreatedArtifactRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AssociateCreatedArtifactOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateCreatedArtifact(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< AssociateCreatedArtifactOutcome() > task([this, request](){ return this->AssociateCreatedArtifact(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::AssociateCreatedArtifactAsync(const AssociateCreatedArtifactRequest& request, const AssociateCreatedArtifactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -145,10 +143,8 @@ void MigrationHubClient::AssociateCreatedArtifactAsyncHelper(const AssociateCrea
 
 AssociateDiscoveredResourceOutcome MigrationHubClient::AssociateDiscoveredResource(const AssociateDiscoveredResourceRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -162,10 +158,10 @@ AssociateDiscoveredResourceOutcome MigrationHubClient::AssociateDiscoveredResour
 
 AssociateDiscoveredResourceOutcomeCallable MigrationHubClient::AssociateDiscoveredResourceCallable(const AssociateDiscoveredResourceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< AssociateDiscoveredResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->AssociateDiscoveredResource(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< AssociateDiscoveredResourceOutcome() > task([this, request](){ return this->AssociateDiscoveredResource(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::AssociateDiscoveredResourceAsync(const AssociateDiscoveredResourceRequest& request, const AssociateDiscoveredResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -180,10 +176,8 @@ void MigrationHubClient::AssociateDiscoveredResourceAsyncHelper(const AssociateD
 
 CreateProgressUpdateStreamOutcome MigrationHubClient::CreateProgressUpdateStream(const CreateProgressUpdateStreamRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -197,10 +191,10 @@ CreateProgressUpdateStreamOutcome MigrationHubClient::CreateProgressUpdateStream
 
 CreateProgressUpdateStreamOutcomeCallable MigrationHubClient::CreateProgressUpdateStreamCallable(const CreateProgressUpdateStreamRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateProgressUpdateStreamOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateProgressUpdateStream(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreateProgressUpdateStreamOutcome() > task([this, request](){ return this->CreateProgressUpdateStream(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::CreateProgressUpdateStreamAsync(const CreateProgressUpdateStreamRequest& request, const CreateProgressUpdateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -215,10 +209,8 @@ void MigrationHubClient::CreateProgressUpdateStreamAsyncHelper(const CreateProgr
 
 DeleteProgressUpdateStreamOutcome MigrationHubClient::DeleteProgressUpdateStream(const DeleteProgressUpdateStreamRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -232,10 +224,10 @@ DeleteProgressUpdateStreamOutcome MigrationHubClient::DeleteProgressUpdateStream
 
 DeleteProgressUpdateStreamOutcomeCallable MigrationHubClient::DeleteProgressUpdateStreamCallable(const DeleteProgressUpdateStreamRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteProgressUpdateStreamOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteProgressUpdateStream(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DeleteProgressUpdateStreamOutcome() > task([this, request](){ return this->DeleteProgressUpdateStream(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::DeleteProgressUpdateStreamAsync(const DeleteProgressUpdateStreamRequest& request, const DeleteProgressUpdateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -250,10 +242,8 @@ void MigrationHubClient::DeleteProgressUpdateStreamAsyncHelper(const DeleteProgr
 
 DescribeApplicationStateOutcome MigrationHubClient::DescribeApplicationState(const DescribeApplicationStateRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -267,10 +257,10 @@ DescribeApplicationStateOutcome MigrationHubClient::DescribeApplicationState(con
 
 DescribeApplicationStateOutcomeCallable MigrationHubClient::DescribeApplicationStateCallable(const DescribeApplicationStateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeApplicationStateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeApplicationState(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DescribeApplicationStateOutcome() > task([this, request](){ return this->DescribeApplicationState(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::DescribeApplicationStateAsync(const DescribeApplicationStateRequest& request, const DescribeApplicationStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -285,10 +275,8 @@ void MigrationHubClient::DescribeApplicationStateAsyncHelper(const DescribeAppli
 
 DescribeMigrationTaskOutcome MigrationHubClient::DescribeMigrationTask(const DescribeMigrationTaskRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -302,10 +290,10 @@ DescribeMigrationTaskOutcome MigrationHubClient::DescribeMigrationTask(const Des
 
 DescribeMigrationTaskOutcomeCallable MigrationHubClient::DescribeMigrationTaskCallable(const DescribeMigrationTaskRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DescribeMigrationTaskOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DescribeMigrationTask(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DescribeMigrationTaskOutcome() > task([this, request](){ return this->DescribeMigrationTask(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::DescribeMigrationTaskAsync(const DescribeMigrationTaskRequest& request, const DescribeMigrationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -320,10 +308,8 @@ void MigrationHubClient::DescribeMigrationTaskAsyncHelper(const DescribeMigratio
 
 DisassociateCreatedArtifactOutcome MigrationHubClient::DisassociateCreatedArtifact(const DisassociateCreatedArtifactRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -337,10 +323,10 @@ DisassociateCreatedArtifactOutcome MigrationHubClient::DisassociateCreatedArtifa
 
 DisassociateCreatedArtifactOutcomeCallable MigrationHubClient::DisassociateCreatedArtifactCallable(const DisassociateCreatedArtifactRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DisassociateCreatedArtifactOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateCreatedArtifact(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DisassociateCreatedArtifactOutcome() > task([this, request](){ return this->DisassociateCreatedArtifact(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::DisassociateCreatedArtifactAsync(const DisassociateCreatedArtifactRequest& request, const DisassociateCreatedArtifactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -355,10 +341,8 @@ void MigrationHubClient::DisassociateCreatedArtifactAsyncHelper(const Disassocia
 
 DisassociateDiscoveredResourceOutcome MigrationHubClient::DisassociateDiscoveredResource(const DisassociateDiscoveredResourceRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -372,10 +356,10 @@ DisassociateDiscoveredResourceOutcome MigrationHubClient::DisassociateDiscovered
 
 DisassociateDiscoveredResourceOutcomeCallable MigrationHubClient::DisassociateDiscoveredResourceCallable(const DisassociateDiscoveredResourceRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DisassociateDiscoveredResourceOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->DisassociateDiscoveredResource(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DisassociateDiscoveredResourceOutcome() > task([this, request](){ return this->DisassociateDiscoveredResource(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::DisassociateDiscoveredResourceAsync(const DisassociateDiscoveredResourceRequest& request, const DisassociateDiscoveredResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -390,10 +374,8 @@ void MigrationHubClient::DisassociateDiscoveredResourceAsyncHelper(const Disasso
 
 ImportMigrationTaskOutcome MigrationHubClient::ImportMigrationTask(const ImportMigrationTaskRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -407,10 +389,10 @@ ImportMigrationTaskOutcome MigrationHubClient::ImportMigrationTask(const ImportM
 
 ImportMigrationTaskOutcomeCallable MigrationHubClient::ImportMigrationTaskCallable(const ImportMigrationTaskRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ImportMigrationTaskOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ImportMigrationTask(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ImportMigrationTaskOutcome() > task([this, request](){ return this->ImportMigrationTask(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::ImportMigrationTaskAsync(const ImportMigrationTaskRequest& request, const ImportMigrationTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -425,10 +407,8 @@ void MigrationHubClient::ImportMigrationTaskAsyncHelper(const ImportMigrationTas
 
 ListCreatedArtifactsOutcome MigrationHubClient::ListCreatedArtifacts(const ListCreatedArtifactsRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -442,10 +422,10 @@ ListCreatedArtifactsOutcome MigrationHubClient::ListCreatedArtifacts(const ListC
 
 ListCreatedArtifactsOutcomeCallable MigrationHubClient::ListCreatedArtifactsCallable(const ListCreatedArtifactsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListCreatedArtifactsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCreatedArtifacts(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListCreatedArtifactsOutcome() > task([this, request](){ return this->ListCreatedArtifacts(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::ListCreatedArtifactsAsync(const ListCreatedArtifactsRequest& request, const ListCreatedArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -460,10 +440,8 @@ void MigrationHubClient::ListCreatedArtifactsAsyncHelper(const ListCreatedArtifa
 
 ListDiscoveredResourcesOutcome MigrationHubClient::ListDiscoveredResources(const ListDiscoveredResourcesRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -477,10 +455,10 @@ ListDiscoveredResourcesOutcome MigrationHubClient::ListDiscoveredResources(const
 
 ListDiscoveredResourcesOutcomeCallable MigrationHubClient::ListDiscoveredResourcesCallable(const ListDiscoveredResourcesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListDiscoveredResourcesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDiscoveredResources(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListDiscoveredResourcesOutcome() > task([this, request](){ return this->ListDiscoveredResources(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::ListDiscoveredResourcesAsync(const ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -495,10 +473,8 @@ void MigrationHubClient::ListDiscoveredResourcesAsyncHelper(const ListDiscovered
 
 ListMigrationTasksOutcome MigrationHubClient::ListMigrationTasks(const ListMigrationTasksRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -512,10 +488,10 @@ ListMigrationTasksOutcome MigrationHubClient::ListMigrationTasks(const ListMigra
 
 ListMigrationTasksOutcomeCallable MigrationHubClient::ListMigrationTasksCallable(const ListMigrationTasksRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListMigrationTasksOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListMigrationTasks(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListMigrationTasksOutcome() > task([this, request](){ return this->ListMigrationTasks(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::ListMigrationTasksAsync(const ListMigrationTasksRequest& request, const ListMigrationTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -530,10 +506,8 @@ void MigrationHubClient::ListMigrationTasksAsyncHelper(const ListMigrationTasksR
 
 ListProgressUpdateStreamsOutcome MigrationHubClient::ListProgressUpdateStreams(const ListProgressUpdateStreamsRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -547,10 +521,10 @@ ListProgressUpdateStreamsOutcome MigrationHubClient::ListProgressUpdateStreams(c
 
 ListProgressUpdateStreamsOutcomeCallable MigrationHubClient::ListProgressUpdateStreamsCallable(const ListProgressUpdateStreamsRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListProgressUpdateStreamsOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListProgressUpdateStreams(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListProgressUpdateStreamsOutcome() > task([this, request](){ return this->ListProgressUpdateStreams(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::ListProgressUpdateStreamsAsync(const ListProgressUpdateStreamsRequest& request, const ListProgressUpdateStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -565,10 +539,8 @@ void MigrationHubClient::ListProgressUpdateStreamsAsyncHelper(const ListProgress
 
 NotifyApplicationStateOutcome MigrationHubClient::NotifyApplicationState(const NotifyApplicationStateRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -582,10 +554,10 @@ NotifyApplicationStateOutcome MigrationHubClient::NotifyApplicationState(const N
 
 NotifyApplicationStateOutcomeCallable MigrationHubClient::NotifyApplicationStateCallable(const NotifyApplicationStateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< NotifyApplicationStateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->NotifyApplicationState(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< NotifyApplicationStateOutcome() > task([this, request](){ return this->NotifyApplicationState(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::NotifyApplicationStateAsync(const NotifyApplicationStateRequest& request, const NotifyApplicationStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -600,10 +572,8 @@ void MigrationHubClient::NotifyApplicationStateAsyncHelper(const NotifyApplicati
 
 NotifyMigrationTaskStateOutcome MigrationHubClient::NotifyMigrationTaskState(const NotifyMigrationTaskStateRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -617,10 +587,10 @@ NotifyMigrationTaskStateOutcome MigrationHubClient::NotifyMigrationTaskState(con
 
 NotifyMigrationTaskStateOutcomeCallable MigrationHubClient::NotifyMigrationTaskStateCallable(const NotifyMigrationTaskStateRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< NotifyMigrationTaskStateOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->NotifyMigrationTaskState(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< NotifyMigrationTaskStateOutcome() > task([this, request](){ return this->NotifyMigrationTaskState(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::NotifyMigrationTaskStateAsync(const NotifyMigrationTaskStateRequest& request, const NotifyMigrationTaskStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -635,10 +605,8 @@ void MigrationHubClient::NotifyMigrationTaskStateAsyncHelper(const NotifyMigrati
 
 PutResourceAttributesOutcome MigrationHubClient::PutResourceAttributes(const PutResourceAttributesRequest& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/");
   JsonOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST, Aws::Auth::SIGV4_SIGNER);
   if(outcome.IsSuccess())
   {
@@ -652,10 +620,10 @@ PutResourceAttributesOutcome MigrationHubClient::PutResourceAttributes(const Put
 
 PutResourceAttributesOutcomeCallable MigrationHubClient::PutResourceAttributesCallable(const PutResourceAttributesRequest& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< PutResourceAttributesOutcome() > >(ALLOCATION_TAG, [this, request](){ return this->PutResourceAttributes(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< PutResourceAttributesOutcome() > task([this, request](){ return this->PutResourceAttributes(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void MigrationHubClient::PutResourceAttributesAsync(const PutResourceAttributesRequest& request, const PutResourceAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
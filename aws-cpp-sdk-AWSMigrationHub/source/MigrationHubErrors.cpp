@@ -28,10 +28,10 @@ namespace MigrationHub
 namespace MigrationHubErrorMapper
 {
 
-static const int DRY_RUN_OPERATION_HASH = HashingUtils::HashString("DryRunOperation");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInputException");
-static const int UNAUTHORIZED_OPERATION_HASH = HashingUtils::HashString("UnauthorizedOperation");
-static const int POLICY_ERROR_HASH = HashingUtils::HashString("PolicyErrorException");
+static constexpr int DRY_RUN_OPERATION_HASH = HashingUtils::CompileTimeHashString("DryRunOperation");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInputException");
+static constexpr int UNAUTHORIZED_OPERATION_HASH = HashingUtils::CompileTimeHashString("UnauthorizedOperation");
+static constexpr int POLICY_ERROR_HASH = HashingUtils::CompileTimeHashString("PolicyErrorException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace ApplicationStatusMapper
       {
 
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
+        static constexpr int NOT_STARTED_HASH = HashingUtils::CompileTimeHashString("NOT_STARTED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
 
 
         ApplicationStatus GetApplicationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_STARTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ApplicationStatus::NOT_STARTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return ApplicationStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ApplicationStatus::COMPLETED;
+          case NOT_STARTED_HASH:
+            if (name == "NOT_STARTED")
+            {
+              return ApplicationStatus::NOT_STARTED;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return ApplicationStatus::IN_PROGRESS;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return ApplicationStatus::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ApplicationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForApplicationStatus(ApplicationStatus enumValue)
+        const char* GetNameForApplicationStatus(ApplicationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,60 +30,86 @@ namespace Aws
       namespace ResourceAttributeTypeMapper
       {
 
-        static const int IPV4_ADDRESS_HASH = HashingUtils::HashString("IPV4_ADDRESS");
-        static const int IPV6_ADDRESS_HASH = HashingUtils::HashString("IPV6_ADDRESS");
-        static const int MAC_ADDRESS_HASH = HashingUtils::HashString("MAC_ADDRESS");
-        static const int FQDN_HASH = HashingUtils::HashString("FQDN");
-        static const int VM_MANAGER_ID_HASH = HashingUtils::HashString("VM_MANAGER_ID");
-        static const int VM_MANAGED_OBJECT_REFERENCE_HASH = HashingUtils::HashString("VM_MANAGED_OBJECT_REFERENCE");
-        static const int VM_NAME_HASH = HashingUtils::HashString("VM_NAME");
-        static const int VM_PATH_HASH = HashingUtils::HashString("VM_PATH");
-        static const int BIOS_ID_HASH = HashingUtils::HashString("BIOS_ID");
-        static const int MOTHERBOARD_SERIAL_NUMBER_HASH = HashingUtils::HashString("MOTHERBOARD_SERIAL_NUMBER");
+        static constexpr int IPV4_ADDRESS_HASH = HashingUtils::CompileTimeHashString("IPV4_ADDRESS");
+        static constexpr int IPV6_ADDRESS_HASH = HashingUtils::CompileTimeHashString("IPV6_ADDRESS");
+        static constexpr int MAC_ADDRESS_HASH = HashingUtils::CompileTimeHashString("MAC_ADDRESS");
+        static constexpr int FQDN_HASH = HashingUtils::CompileTimeHashString("FQDN");
+        static constexpr int VM_MANAGER_ID_HASH = HashingUtils::CompileTimeHashString("VM_MANAGER_ID");
+        static constexpr int VM_MANAGED_OBJECT_REFERENCE_HASH = HashingUtils::CompileTimeHashString("VM_MANAGED_OBJECT_REFERENCE");
+        static constexpr int VM_NAME_HASH = HashingUtils::CompileTimeHashString("VM_NAME");
+        static constexpr int VM_PATH_HASH = HashingUtils::CompileTimeHashString("VM_PATH");
+        static constexpr int BIOS_ID_HASH = HashingUtils::CompileTimeHashString("BIOS_ID");
+        static constexpr int MOTHERBOARD_SERIAL_NUMBER_HASH = HashingUtils::CompileTimeHashString("MOTHERBOARD_SERIAL_NUMBER");
 
 
         ResourceAttributeType GetResourceAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IPV4_ADDRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceAttributeType::IPV4_ADDRESS;
-          }
-          else if (hashCode == IPV6_ADDRESS_HASH)
-          {
-            return ResourceAttributeType::IPV6_ADDRESS;
-          }
-          else if (hashCode == MAC_ADDRESS_HASH)
-          {
-            return ResourceAttributeType::MAC_ADDRESS;
-          }
-          else if (hashCode == FQDN_HASH)
-          {
-            return ResourceAttributeType::FQDN;
-          }
-          else if (hashCode == VM_MANAGER_ID_HASH)
-          {
-            return ResourceAttributeType::VM_MANAGER_ID;
-          }
-          else if (hashCode == VM_MANAGED_OBJECT_REFERENCE_HASH)
-          {
-            return ResourceAttributeType::VM_MANAGED_OBJECT_REFERENCE;
-          }
-          else if (hashCode == VM_NAME_HASH)
-          {
-            return ResourceAttributeType::VM_NAME;
-          }
-          else if (hashCode == VM_PATH_HASH)
-          {
-            return ResourceAttributeType::VM_PATH;
-          }
-          else if (hashCode == BIOS_ID_HASH)
-          {
-            return ResourceAttributeType::BIOS_ID;
-          }
-          else if (hashCode == MOTHERBOARD_SERIAL_NUMBER_HASH)
-          {
-            return ResourceAttributeType::MOTHERBOARD_SERIAL_NUMBER;
+          case IPV4_ADDRESS_HASH:
+            if (name == "IPV4_ADDRESS")
+            {
+              return ResourceAttributeType::IPV4_ADDRESS;
+            }
+            break;
+          case IPV6_ADDRESS_HASH:
+            if (name == "IPV6_ADDRESS")
+            {
+              return ResourceAttributeType::IPV6_ADDRESS;
+            }
+            break;
+          case MAC_ADDRESS_HASH:
+            if (name == "MAC_ADDRESS")
+            {
+              return ResourceAttributeType::MAC_ADDRESS;
+            }
+            break;
+          case FQDN_HASH:
+            if (name == "FQDN")
+            {
+              return ResourceAttributeType::FQDN;
+            }
+            break;
+          case VM_MANAGER_ID_HASH:
+            if (name == "VM_MANAGER_ID")
+            {
+              return ResourceAttributeType::VM_MANAGER_ID;
+            }
+            break;
+          case VM_MANAGED_OBJECT_REFERENCE_HASH:
+            if (name == "VM_MANAGED_OBJECT_REFERENCE")
+            {
+              return ResourceAttributeType::VM_MANAGED_OBJECT_REFERENCE;
+            }
+            break;
+          case VM_NAME_HASH:
+            if (name == "VM_NAME")
+            {
+              return ResourceAttributeType::VM_NAME;
+            }
+            break;
+          case VM_PATH_HASH:
+            if (name == "VM_PATH")
+            {
+              return ResourceAttributeType::VM_PATH;
+            }
+            break;
+          case BIOS_ID_HASH:
+            if (name == "BIOS_ID")
+            {
+              return ResourceAttributeType::BIOS_ID;
+            }
+            break;
+          case MOTHERBOARD_SERIAL_NUMBER_HASH:
+            if (name == "MOTHERBOARD_SERIAL_NUMBER")
+            {
+              return ResourceAttributeType::MOTHERBOARD_SERIAL_NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return ResourceAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceAttributeType(ResourceAttributeType enumValue)
+        const char* GetNameForResourceAttributeType(ResourceAttributeType enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
+        static constexpr int NOT_STARTED_HASH = HashingUtils::CompileTimeHashString("NOT_STARTED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
 
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_STARTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Status::NOT_STARTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return Status::IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return Status::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return Status::COMPLETED;
+          case NOT_STARTED_HASH:
+            if (name == "NOT_STARTED")
+            {
+              return Status::NOT_STARTED;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return Status::IN_PROGRESS;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return Status::FAILED;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return Status::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatus(Status enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
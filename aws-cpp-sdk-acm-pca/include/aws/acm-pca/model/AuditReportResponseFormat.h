@@ -34,7 +34,8 @@ namespace AuditReportResponseFormatMapper
 {
 AWS_ACMPCA_API AuditReportResponseFormat GetAuditReportResponseFormatForName(const Aws::String& name);
 
-AWS_ACMPCA_API Aws::String GetNameForAuditReportResponseFormat(AuditReportResponseFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_ACMPCA_API const char* GetNameForAuditReportResponseFormat(AuditReportResponseFormat value);
 } // namespace AuditReportResponseFormatMapper
 } // namespace Model
 } // namespace ACMPCA
@@ -35,7 +35,8 @@ namespace AuditReportStatusMapper
 {
 AWS_ACMPCA_API AuditReportStatus GetAuditReportStatusForName(const Aws::String& name);
 
-AWS_ACMPCA_API Aws::String GetNameForAuditReportStatus(AuditReportStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ACMPCA_API const char* GetNameForAuditReportStatus(AuditReportStatus value);
 } // namespace AuditReportStatusMapper
 } // namespace Model
 } // namespace ACMPCA
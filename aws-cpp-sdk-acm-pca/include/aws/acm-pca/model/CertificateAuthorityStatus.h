@@ -39,7 +39,8 @@ namespace CertificateAuthorityStatusMapper
 {
 AWS_ACMPCA_API CertificateAuthorityStatus GetCertificateAuthorityStatusForName(const Aws::String& name);
 
-AWS_ACMPCA_API Aws::String GetNameForCertificateAuthorityStatus(CertificateAuthorityStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ACMPCA_API const char* GetNameForCertificateAuthorityStatus(CertificateAuthorityStatus value);
 } // namespace CertificateAuthorityStatusMapper
 } // namespace Model
 } // namespace ACMPCA
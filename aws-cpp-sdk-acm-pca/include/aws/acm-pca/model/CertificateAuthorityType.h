@@ -33,7 +33,8 @@ namespace CertificateAuthorityTypeMapper
 {
 AWS_ACMPCA_API CertificateAuthorityType GetCertificateAuthorityTypeForName(const Aws::String& name);
 
-AWS_ACMPCA_API Aws::String GetNameForCertificateAuthorityType(CertificateAuthorityType value);
+// names of values not modeled point into the enum overflow container
+AWS_ACMPCA_API const char* GetNameForCertificateAuthorityType(CertificateAuthorityType value);
 } // namespace CertificateAuthorityTypeMapper
 } // namespace Model
 } // namespace ACMPCA
@@ -35,7 +35,8 @@ namespace FailureReasonMapper
 {
 AWS_ACMPCA_API FailureReason GetFailureReasonForName(const Aws::String& name);
 
-AWS_ACMPCA_API Aws::String GetNameForFailureReason(FailureReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ACMPCA_API const char* GetNameForFailureReason(FailureReason value);
 } // namespace FailureReasonMapper
 } // namespace Model
 } // namespace ACMPCA
@@ -36,7 +36,8 @@ namespace KeyAlgorithmMapper
 {
 AWS_ACMPCA_API KeyAlgorithm GetKeyAlgorithmForName(const Aws::String& name);
 
-AWS_ACMPCA_API Aws::String GetNameForKeyAlgorithm(KeyAlgorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_ACMPCA_API const char* GetNameForKeyAlgorithm(KeyAlgorithm value);
 } // namespace KeyAlgorithmMapper
 } // namespace Model
 } // namespace ACMPCA
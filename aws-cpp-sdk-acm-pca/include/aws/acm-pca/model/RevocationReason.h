@@ -40,7 +40,8 @@ namespace RevocationReasonMapper
 {
 AWS_ACMPCA_API RevocationReason GetRevocationReasonForName(const Aws::String& name);
 
-AWS_ACMPCA_API Aws::String GetNameForRevocationReason(RevocationReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ACMPCA_API const char* GetNameForRevocationReason(RevocationReason value);
 } // namespace RevocationReasonMapper
 } // namespace Model
 } // namespace ACMPCA
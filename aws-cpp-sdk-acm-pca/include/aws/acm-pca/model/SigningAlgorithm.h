@@ -38,7 +38,8 @@ namespace SigningAlgorithmMapper
 {
 AWS_ACMPCA_API SigningAlgorithm GetSigningAlgorithmForName(const Aws::String& name);
 
-AWS_ACMPCA_API Aws::String GetNameForSigningAlgorithm(SigningAlgorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_ACMPCA_API const char* GetNameForSigningAlgorithm(SigningAlgorithm value);
 } // namespace SigningAlgorithmMapper
 } // namespace Model
 } // namespace ACMPCA
@@ -37,7 +37,8 @@ namespace ValidityPeriodTypeMapper
 {
 AWS_ACMPCA_API ValidityPeriodType GetValidityPeriodTypeForName(const Aws::String& name);
 
-AWS_ACMPCA_API Aws::String GetNameForValidityPeriodType(ValidityPeriodType value);
+// names of values not modeled point into the enum overflow container
+AWS_ACMPCA_API const char* GetNameForValidityPeriodType(ValidityPeriodType value);
 } // namespace ValidityPeriodTypeMapper
 } // namespace Model
 } // namespace ACMPCA
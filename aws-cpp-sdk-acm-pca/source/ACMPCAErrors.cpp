@@ -28,21 +28,21 @@ namespace ACMPCA
 namespace ACMPCAErrorMapper
 {
 
-static const int REQUEST_IN_PROGRESS_HASH = HashingUtils::HashString("RequestInProgressException");
-static const int TOO_MANY_TAGS_HASH = HashingUtils::HashString("TooManyTagsException");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int CERTIFICATE_MISMATCH_HASH = HashingUtils::HashString("CertificateMismatchException");
-static const int INVALID_TAG_HASH = HashingUtils::HashString("InvalidTagException");
-static const int INVALID_STATE_HASH = HashingUtils::HashString("InvalidStateException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int MALFORMED_CERTIFICATE_HASH = HashingUtils::HashString("MalformedCertificateException");
-static const int REQUEST_ALREADY_PROCESSED_HASH = HashingUtils::HashString("RequestAlreadyProcessedException");
-static const int REQUEST_FAILED_HASH = HashingUtils::HashString("RequestFailedException");
-static const int INVALID_ARN_HASH = HashingUtils::HashString("InvalidArnException");
-static const int INVALID_POLICY_HASH = HashingUtils::HashString("InvalidPolicyException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int INVALID_ARGS_HASH = HashingUtils::HashString("InvalidArgsException");
-static const int MALFORMED_C_S_R_HASH = HashingUtils::HashString("MalformedCSRException");
+static constexpr int REQUEST_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("RequestInProgressException");
+static constexpr int TOO_MANY_TAGS_HASH = HashingUtils::CompileTimeHashString("TooManyTagsException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int CERTIFICATE_MISMATCH_HASH = HashingUtils::CompileTimeHashString("CertificateMismatchException");
+static constexpr int INVALID_TAG_HASH = HashingUtils::CompileTimeHashString("InvalidTagException");
+static constexpr int INVALID_STATE_HASH = HashingUtils::CompileTimeHashString("InvalidStateException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int MALFORMED_CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("MalformedCertificateException");
+static constexpr int REQUEST_ALREADY_PROCESSED_HASH = HashingUtils::CompileTimeHashString("RequestAlreadyProcessedException");
+static constexpr int REQUEST_FAILED_HASH = HashingUtils::CompileTimeHashString("RequestFailedException");
+static constexpr int INVALID_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidArnException");
+static constexpr int INVALID_POLICY_HASH = HashingUtils::CompileTimeHashString("InvalidPolicyException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int INVALID_ARGS_HASH = HashingUtils::CompileTimeHashString("InvalidArgsException");
+static constexpr int MALFORMED_C_S_R_HASH = HashingUtils::CompileTimeHashString("MalformedCSRException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace AuditReportResponseFormatMapper
       {
 
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
+        static constexpr int JSON_HASH = HashingUtils::CompileTimeHashString("JSON");
+        static constexpr int CSV_HASH = HashingUtils::CompileTimeHashString("CSV");
 
 
         AuditReportResponseFormat GetAuditReportResponseFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JSON_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuditReportResponseFormat::JSON;
-          }
-          else if (hashCode == CSV_HASH)
-          {
-            return AuditReportResponseFormat::CSV;
+          case JSON_HASH:
+            if (name == "JSON")
+            {
+              return AuditReportResponseFormat::JSON;
+            }
+            break;
+          case CSV_HASH:
+            if (name == "CSV")
+            {
+              return AuditReportResponseFormat::CSV;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AuditReportResponseFormat::NOT_SET;
         }
 
-        Aws::String GetNameForAuditReportResponseFormat(AuditReportResponseFormat enumValue)
+        const char* GetNameForAuditReportResponseFormat(AuditReportResponseFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AuditReportStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         AuditReportStatus GetAuditReportStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuditReportStatus::CREATING;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return AuditReportStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AuditReportStatus::FAILED;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return AuditReportStatus::CREATING;
+            }
+            break;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return AuditReportStatus::SUCCESS;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return AuditReportStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AuditReportStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAuditReportStatus(AuditReportStatus enumValue)
+        const char* GetNameForAuditReportStatus(AuditReportStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace CertificateAuthorityStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int PENDING_CERTIFICATE_HASH = HashingUtils::HashString("PENDING_CERTIFICATE");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int PENDING_CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("PENDING_CERTIFICATE");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
+        static constexpr int EXPIRED_HASH = HashingUtils::CompileTimeHashString("EXPIRED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         CertificateAuthorityStatus GetCertificateAuthorityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CertificateAuthorityStatus::CREATING;
-          }
-          else if (hashCode == PENDING_CERTIFICATE_HASH)
-          {
-            return CertificateAuthorityStatus::PENDING_CERTIFICATE;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return CertificateAuthorityStatus::ACTIVE;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return CertificateAuthorityStatus::DELETED;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return CertificateAuthorityStatus::DISABLED;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return CertificateAuthorityStatus::EXPIRED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return CertificateAuthorityStatus::FAILED;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return CertificateAuthorityStatus::CREATING;
+            }
+            break;
+          case PENDING_CERTIFICATE_HASH:
+            if (name == "PENDING_CERTIFICATE")
+            {
+              return CertificateAuthorityStatus::PENDING_CERTIFICATE;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return CertificateAuthorityStatus::ACTIVE;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return CertificateAuthorityStatus::DELETED;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return CertificateAuthorityStatus::DISABLED;
+            }
+            break;
+          case EXPIRED_HASH:
+            if (name == "EXPIRED")
+            {
+              return CertificateAuthorityStatus::EXPIRED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return CertificateAuthorityStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return CertificateAuthorityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateAuthorityStatus(CertificateAuthorityStatus enumValue)
+        const char* GetNameForCertificateAuthorityStatus(CertificateAuthorityStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
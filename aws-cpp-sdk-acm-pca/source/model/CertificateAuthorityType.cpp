@@ -30,15 +30,23 @@ namespace Aws
       namespace CertificateAuthorityTypeMapper
       {
 
-        static const int SUBORDINATE_HASH = HashingUtils::HashString("SUBORDINATE");
+        static constexpr int SUBORDINATE_HASH = HashingUtils::CompileTimeHashString("SUBORDINATE");
 
 
         CertificateAuthorityType GetCertificateAuthorityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBORDINATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CertificateAuthorityType::SUBORDINATE;
+          case SUBORDINATE_HASH:
+            if (name == "SUBORDINATE")
+            {
+              return CertificateAuthorityType::SUBORDINATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return CertificateAuthorityType::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateAuthorityType(CertificateAuthorityType enumValue)
+        const char* GetNameForCertificateAuthorityType(CertificateAuthorityType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace FailureReasonMapper
       {
 
-        static const int REQUEST_TIMED_OUT_HASH = HashingUtils::HashString("REQUEST_TIMED_OUT");
-        static const int UNSUPPORTED_ALGORITHM_HASH = HashingUtils::HashString("UNSUPPORTED_ALGORITHM");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
+        static constexpr int REQUEST_TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("REQUEST_TIMED_OUT");
+        static constexpr int UNSUPPORTED_ALGORITHM_HASH = HashingUtils::CompileTimeHashString("UNSUPPORTED_ALGORITHM");
+        static constexpr int OTHER_HASH = HashingUtils::CompileTimeHashString("OTHER");
 
 
         FailureReason GetFailureReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REQUEST_TIMED_OUT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FailureReason::REQUEST_TIMED_OUT;
-          }
-          else if (hashCode == UNSUPPORTED_ALGORITHM_HASH)
-          {
-            return FailureReason::UNSUPPORTED_ALGORITHM;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return FailureReason::OTHER;
+          case REQUEST_TIMED_OUT_HASH:
+            if (name == "REQUEST_TIMED_OUT")
+            {
+              return FailureReason::REQUEST_TIMED_OUT;
+            }
+            break;
+          case UNSUPPORTED_ALGORITHM_HASH:
+            if (name == "UNSUPPORTED_ALGORITHM")
+            {
+              return FailureReason::UNSUPPORTED_ALGORITHM;
+            }
+            break;
+          case OTHER_HASH:
+            if (name == "OTHER")
+            {
+              return FailureReason::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FailureReason::NOT_SET;
         }
 
-        Aws::String GetNameForFailureReason(FailureReason enumValue)
+        const char* GetNameForFailureReason(FailureReason enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace KeyAlgorithmMapper
       {
 
-        static const int RSA_2048_HASH = HashingUtils::HashString("RSA_2048");
-        static const int RSA_4096_HASH = HashingUtils::HashString("RSA_4096");
-        static const int EC_prime256v1_HASH = HashingUtils::HashString("EC_prime256v1");
-        static const int EC_secp384r1_HASH = HashingUtils::HashString("EC_secp384r1");
+        static constexpr int RSA_2048_HASH = HashingUtils::CompileTimeHashString("RSA_2048");
+        static constexpr int RSA_4096_HASH = HashingUtils::CompileTimeHashString("RSA_4096");
+        static constexpr int EC_prime256v1_HASH = HashingUtils::CompileTimeHashString("EC_prime256v1");
+        static constexpr int EC_secp384r1_HASH = HashingUtils::CompileTimeHashString("EC_secp384r1");
 
 
         KeyAlgorithm GetKeyAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSA_2048_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return KeyAlgorithm::RSA_2048;
-          }
-          else if (hashCode == RSA_4096_HASH)
-          {
-            return KeyAlgorithm::RSA_4096;
-          }
-          else if (hashCode == EC_prime256v1_HASH)
-          {
-            return KeyAlgorithm::EC_prime256v1;
-          }
-          else if (hashCode == EC_secp384r1_HASH)
-          {
-            return KeyAlgorithm::EC_secp384r1;
+          case RSA_2048_HASH:
+            if (name == "RSA_2048")
+            {
+              return KeyAlgorithm::RSA_2048;
+            }
+            break;
+          case RSA_4096_HASH:
+            if (name == "RSA_4096")
+            {
+              return KeyAlgorithm::RSA_4096;
+            }
+            break;
+          case EC_prime256v1_HASH:
+            if (name == "EC_prime256v1")
+            {
+              return KeyAlgorithm::EC_prime256v1;
+            }
+            break;
+          case EC_secp384r1_HASH:
+            if (name == "EC_secp384r1")
+            {
+              return KeyAlgorithm::EC_secp384r1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return KeyAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForKeyAlgorithm(KeyAlgorithm enumValue)
+        const char* GetNameForKeyAlgorithm(KeyAlgorithm enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace RevocationReasonMapper
       {
 
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
-        static const int KEY_COMPROMISE_HASH = HashingUtils::HashString("KEY_COMPROMISE");
-        static const int CERTIFICATE_AUTHORITY_COMPROMISE_HASH = HashingUtils::HashString("CERTIFICATE_AUTHORITY_COMPROMISE");
-        static const int AFFILIATION_CHANGED_HASH = HashingUtils::HashString("AFFILIATION_CHANGED");
-        static const int SUPERSEDED_HASH = HashingUtils::HashString("SUPERSEDED");
-        static const int CESSATION_OF_OPERATION_HASH = HashingUtils::HashString("CESSATION_OF_OPERATION");
-        static const int PRIVILEGE_WITHDRAWN_HASH = HashingUtils::HashString("PRIVILEGE_WITHDRAWN");
-        static const int A_A_COMPROMISE_HASH = HashingUtils::HashString("A_A_COMPROMISE");
+        static constexpr int UNSPECIFIED_HASH = HashingUtils::CompileTimeHashString("UNSPECIFIED");
+        static constexpr int KEY_COMPROMISE_HASH = HashingUtils::CompileTimeHashString("KEY_COMPROMISE");
+        static constexpr int CERTIFICATE_AUTHORITY_COMPROMISE_HASH = HashingUtils::CompileTimeHashString("CERTIFICATE_AUTHORITY_COMPROMISE");
+        static constexpr int AFFILIATION_CHANGED_HASH = HashingUtils::CompileTimeHashString("AFFILIATION_CHANGED");
+        static constexpr int SUPERSEDED_HASH = HashingUtils::CompileTimeHashString("SUPERSEDED");
+        static constexpr int CESSATION_OF_OPERATION_HASH = HashingUtils::CompileTimeHashString("CESSATION_OF_OPERATION");
+        static constexpr int PRIVILEGE_WITHDRAWN_HASH = HashingUtils::CompileTimeHashString("PRIVILEGE_WITHDRAWN");
+        static constexpr int A_A_COMPROMISE_HASH = HashingUtils::CompileTimeHashString("A_A_COMPROMISE");
 
 
         RevocationReason GetRevocationReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNSPECIFIED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RevocationReason::UNSPECIFIED;
-          }
-          else if (hashCode == KEY_COMPROMISE_HASH)
-          {
-            return RevocationReason::KEY_COMPROMISE;
-          }
-          else if (hashCode == CERTIFICATE_AUTHORITY_COMPROMISE_HASH)
-          {
-            return RevocationReason::CERTIFICATE_AUTHORITY_COMPROMISE;
-          }
-          else if (hashCode == AFFILIATION_CHANGED_HASH)
-          {
-            return RevocationReason::AFFILIATION_CHANGED;
-          }
-          else if (hashCode == SUPERSEDED_HASH)
-          {
-            return RevocationReason::SUPERSEDED;
-          }
-          else if (hashCode == CESSATION_OF_OPERATION_HASH)
-          {
-            return RevocationReason::CESSATION_OF_OPERATION;
-          }
-          else if (hashCode == PRIVILEGE_WITHDRAWN_HASH)
-          {
-            return RevocationReason::PRIVILEGE_WITHDRAWN;
-          }
-          else if (hashCode == A_A_COMPROMISE_HASH)
-          {
-            return RevocationReason::A_A_COMPROMISE;
+          case UNSPECIFIED_HASH:
+            if (name == "UNSPECIFIED")
+            {
+              return RevocationReason::UNSPECIFIED;
+            }
+            break;
+          case KEY_COMPROMISE_HASH:
+            if (name == "KEY_COMPROMISE")
+            {
+              return RevocationReason::KEY_COMPROMISE;
+            }
+            break;
+          case CERTIFICATE_AUTHORITY_COMPROMISE_HASH:
+            if (name == "CERTIFICATE_AUTHORITY_COMPROMISE")
+            {
+              return RevocationReason::CERTIFICATE_AUTHORITY_COMPROMISE;
+            }
+            break;
+          case AFFILIATION_CHANGED_HASH:
+            if (name == "AFFILIATION_CHANGED")
+            {
+              return RevocationReason::AFFILIATION_CHANGED;
+            }
+            break;
+          case SUPERSEDED_HASH:
+            if (name == "SUPERSEDED")
+            {
+              return RevocationReason::SUPERSEDED;
+            }
+            break;
+          case CESSATION_OF_OPERATION_HASH:
+            if (name == "CESSATION_OF_OPERATION")
+            {
+              return RevocationReason::CESSATION_OF_OPERATION;
+            }
+            break;
+          case PRIVILEGE_WITHDRAWN_HASH:
+            if (name == "PRIVILEGE_WITHDRAWN")
+            {
+              return RevocationReason::PRIVILEGE_WITHDRAWN;
+            }
+            break;
+          case A_A_COMPROMISE_HASH:
+            if (name == "A_A_COMPROMISE")
+            {
+              return RevocationReason::A_A_COMPROMISE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return RevocationReason::NOT_SET;
         }
 
-        Aws::String GetNameForRevocationReason(RevocationReason enumValue)
+        const char* GetNameForRevocationReason(RevocationReason enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
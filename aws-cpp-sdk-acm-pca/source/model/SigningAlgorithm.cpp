@@ -30,40 +30,58 @@ namespace Aws
       namespace SigningAlgorithmMapper
       {
 
-        static const int SHA256WITHECDSA_HASH = HashingUtils::HashString("SHA256WITHECDSA");
-        static const int SHA384WITHECDSA_HASH = HashingUtils::HashString("SHA384WITHECDSA");
-        static const int SHA512WITHECDSA_HASH = HashingUtils::HashString("SHA512WITHECDSA");
-        static const int SHA256WITHRSA_HASH = HashingUtils::HashString("SHA256WITHRSA");
-        static const int SHA384WITHRSA_HASH = HashingUtils::HashString("SHA384WITHRSA");
-        static const int SHA512WITHRSA_HASH = HashingUtils::HashString("SHA512WITHRSA");
+        static constexpr int SHA256WITHECDSA_HASH = HashingUtils::CompileTimeHashString("SHA256WITHECDSA");
+        static constexpr int SHA384WITHECDSA_HASH = HashingUtils::CompileTimeHashString("SHA384WITHECDSA");
+        static constexpr int SHA512WITHECDSA_HASH = HashingUtils::CompileTimeHashString("SHA512WITHECDSA");
+        static constexpr int SHA256WITHRSA_HASH = HashingUtils::CompileTimeHashString("SHA256WITHRSA");
+        static constexpr int SHA384WITHRSA_HASH = HashingUtils::CompileTimeHashString("SHA384WITHRSA");
+        static constexpr int SHA512WITHRSA_HASH = HashingUtils::CompileTimeHashString("SHA512WITHRSA");
 
 
         SigningAlgorithm GetSigningAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SHA256WITHECDSA_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SigningAlgorithm::SHA256WITHECDSA;
-          }
-          else if (hashCode == SHA384WITHECDSA_HASH)
-          {
-            return SigningAlgorithm::SHA384WITHECDSA;
-          }
-          else if (hashCode == SHA512WITHECDSA_HASH)
-          {
-            return SigningAlgorithm::SHA512WITHECDSA;
-          }
-          else if (hashCode == SHA256WITHRSA_HASH)
-          {
-            return SigningAlgorithm::SHA256WITHRSA;
-          }
-          else if (hashCode == SHA384WITHRSA_HASH)
-          {
-            return SigningAlgorithm::SHA384WITHRSA;
-          }
-          else if (hashCode == SHA512WITHRSA_HASH)
-          {
-            return SigningAlgorithm::SHA512WITHRSA;
+          case SHA256WITHECDSA_HASH:
+            if (name == "SHA256WITHECDSA")
+            {
+              return SigningAlgorithm::SHA256WITHECDSA;
+            }
+            break;
+          case SHA384WITHECDSA_HASH:
+            if (name == "SHA384WITHECDSA")
+            {
+              return SigningAlgorithm::SHA384WITHECDSA;
+            }
+            break;
+          case SHA512WITHECDSA_HASH:
+            if (name == "SHA512WITHECDSA")
+            {
+              return SigningAlgorithm::SHA512WITHECDSA;
+            }
+            break;
+          case SHA256WITHRSA_HASH:
+            if (name == "SHA256WITHRSA")
+            {
+              return SigningAlgorithm::SHA256WITHRSA;
+            }
+            break;
+          case SHA384WITHRSA_HASH:
+            if (name == "SHA384WITHRSA")
+            {
+              return SigningAlgorithm::SHA384WITHRSA;
+            }
+            break;
+          case SHA512WITHRSA_HASH:
+            if (name == "SHA512WITHRSA")
+            {
+              return SigningAlgorithm::SHA512WITHRSA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return SigningAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForSigningAlgorithm(SigningAlgorithm enumValue)
+        const char* GetNameForSigningAlgorithm(SigningAlgorithm enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
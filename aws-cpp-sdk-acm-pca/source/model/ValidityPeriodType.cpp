@@ -30,35 +30,51 @@ namespace Aws
       namespace ValidityPeriodTypeMapper
       {
 
-        static const int END_DATE_HASH = HashingUtils::HashString("END_DATE");
-        static const int ABSOLUTE_HASH = HashingUtils::HashString("ABSOLUTE");
-        static const int DAYS_HASH = HashingUtils::HashString("DAYS");
-        static const int MONTHS_HASH = HashingUtils::HashString("MONTHS");
-        static const int YEARS_HASH = HashingUtils::HashString("YEARS");
+        static constexpr int END_DATE_HASH = HashingUtils::CompileTimeHashString("END_DATE");
+        static constexpr int ABSOLUTE_HASH = HashingUtils::CompileTimeHashString("ABSOLUTE");
+        static constexpr int DAYS_HASH = HashingUtils::CompileTimeHashString("DAYS");
+        static constexpr int MONTHS_HASH = HashingUtils::CompileTimeHashString("MONTHS");
+        static constexpr int YEARS_HASH = HashingUtils::CompileTimeHashString("YEARS");
 
 
         ValidityPeriodType GetValidityPeriodTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == END_DATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ValidityPeriodType::END_DATE;
-          }
-          else if (hashCode == ABSOLUTE_HASH)
-          {
-            return ValidityPeriodType::ABSOLUTE;
-          }
-          else if (hashCode == DAYS_HASH)
-          {
-            return ValidityPeriodType::DAYS;
-          }
-          else if (hashCode == MONTHS_HASH)
-          {
-            return ValidityPeriodType::MONTHS;
-          }
-          else if (hashCode == YEARS_HASH)
-          {
-            return ValidityPeriodType::YEARS;
+          case END_DATE_HASH:
+            if (name == "END_DATE")
+            {
+              return ValidityPeriodType::END_DATE;
+            }
+            break;
+          case ABSOLUTE_HASH:
+            if (name == "ABSOLUTE")
+            {
+              return ValidityPeriodType::ABSOLUTE;
+            }
+            break;
+          case DAYS_HASH:
+            if (name == "DAYS")
+            {
+              return ValidityPeriodType::DAYS;
+            }
+            break;
+          case MONTHS_HASH:
+            if (name == "MONTHS")
+            {
+              return ValidityPeriodType::MONTHS;
+            }
+            break;
+          case YEARS_HASH:
+            if (name == "YEARS")
+            {
+              return ValidityPeriodType::YEARS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ValidityPeriodType::NOT_SET;
         }
 
-        Aws::String GetNameForValidityPeriodType(ValidityPeriodType enumValue)
+        const char* GetNameForValidityPeriodType(ValidityPeriodType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -39,7 +39,8 @@ namespace CertificateStatusMapper
 {
 AWS_ACM_API CertificateStatus GetCertificateStatusForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForCertificateStatus(CertificateStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForCertificateStatus(CertificateStatus value);
 } // namespace CertificateStatusMapper
 } // namespace Model
 } // namespace ACM
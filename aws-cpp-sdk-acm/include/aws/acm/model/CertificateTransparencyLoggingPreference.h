@@ -34,7 +34,8 @@ namespace CertificateTransparencyLoggingPreferenceMapper
 {
 AWS_ACM_API CertificateTransparencyLoggingPreference GetCertificateTransparencyLoggingPreferenceForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForCertificateTransparencyLoggingPreference(CertificateTransparencyLoggingPreference value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForCertificateTransparencyLoggingPreference(CertificateTransparencyLoggingPreference value);
 } // namespace CertificateTransparencyLoggingPreferenceMapper
 } // namespace Model
 } // namespace ACM
@@ -35,7 +35,8 @@ namespace CertificateTypeMapper
 {
 AWS_ACM_API CertificateType GetCertificateTypeForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForCertificateType(CertificateType value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForCertificateType(CertificateType value);
 } // namespace CertificateTypeMapper
 } // namespace Model
 } // namespace ACM
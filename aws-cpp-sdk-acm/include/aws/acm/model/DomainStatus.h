@@ -35,7 +35,8 @@ namespace DomainStatusMapper
 {
 AWS_ACM_API DomainStatus GetDomainStatusForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForDomainStatus(DomainStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForDomainStatus(DomainStatus value);
 } // namespace DomainStatusMapper
 } // namespace Model
 } // namespace ACM
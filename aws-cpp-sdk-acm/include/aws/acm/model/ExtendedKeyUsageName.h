@@ -44,7 +44,8 @@ namespace ExtendedKeyUsageNameMapper
 {
 AWS_ACM_API ExtendedKeyUsageName GetExtendedKeyUsageNameForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForExtendedKeyUsageName(ExtendedKeyUsageName value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForExtendedKeyUsageName(ExtendedKeyUsageName value);
 } // namespace ExtendedKeyUsageNameMapper
 } // namespace Model
 } // namespace ACM
@@ -44,7 +44,8 @@ namespace FailureReasonMapper
 {
 AWS_ACM_API FailureReason GetFailureReasonForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForFailureReason(FailureReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForFailureReason(FailureReason value);
 } // namespace FailureReasonMapper
 } // namespace Model
 } // namespace ACM
@@ -38,7 +38,8 @@ namespace KeyAlgorithmMapper
 {
 AWS_ACM_API KeyAlgorithm GetKeyAlgorithmForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForKeyAlgorithm(KeyAlgorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForKeyAlgorithm(KeyAlgorithm value);
 } // namespace KeyAlgorithmMapper
 } // namespace Model
 } // namespace ACM
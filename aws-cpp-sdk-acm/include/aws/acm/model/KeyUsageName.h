@@ -43,7 +43,8 @@ namespace KeyUsageNameMapper
 {
 AWS_ACM_API KeyUsageName GetKeyUsageNameForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForKeyUsageName(KeyUsageName value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForKeyUsageName(KeyUsageName value);
 } // namespace KeyUsageNameMapper
 } // namespace Model
 } // namespace ACM
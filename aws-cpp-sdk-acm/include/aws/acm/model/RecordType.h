@@ -33,7 +33,8 @@ namespace RecordTypeMapper
 {
 AWS_ACM_API RecordType GetRecordTypeForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForRecordType(RecordType value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForRecordType(RecordType value);
 } // namespace RecordTypeMapper
 } // namespace Model
 } // namespace ACM
@@ -34,7 +34,8 @@ namespace RenewalEligibilityMapper
 {
 AWS_ACM_API RenewalEligibility GetRenewalEligibilityForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForRenewalEligibility(RenewalEligibility value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForRenewalEligibility(RenewalEligibility value);
 } // namespace RenewalEligibilityMapper
 } // namespace Model
 } // namespace ACM
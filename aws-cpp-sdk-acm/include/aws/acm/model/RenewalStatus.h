@@ -36,7 +36,8 @@ namespace RenewalStatusMapper
 {
 AWS_ACM_API RenewalStatus GetRenewalStatusForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForRenewalStatus(RenewalStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForRenewalStatus(RenewalStatus value);
 } // namespace RenewalStatusMapper
 } // namespace Model
 } // namespace ACM
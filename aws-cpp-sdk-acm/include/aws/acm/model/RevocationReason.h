@@ -42,7 +42,8 @@ namespace RevocationReasonMapper
 {
 AWS_ACM_API RevocationReason GetRevocationReasonForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForRevocationReason(RevocationReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForRevocationReason(RevocationReason value);
 } // namespace RevocationReasonMapper
 } // namespace Model
 } // namespace ACM
@@ -34,7 +34,8 @@ namespace ValidationMethodMapper
 {
 AWS_ACM_API ValidationMethod GetValidationMethodForName(const Aws::String& name);
 
-AWS_ACM_API Aws::String GetNameForValidationMethod(ValidationMethod value);
+// names of values not modeled point into the enum overflow container
+AWS_ACM_API const char* GetNameForValidationMethod(ValidationMethod value);
 } // namespace ValidationMethodMapper
 } // namespace Model
 } // namespace ACM
@@ -26,8 +26,8 @@ namespace ACM
 {
 namespace ACMEndpoint
 {
-  static const int CN_NORTH_HASH = Aws::Utils::HashingUtils::HashString("cn-north-1");
-  static const int CN_NORTHWEST_1_HASH = Aws::Utils::HashingUtils::HashString("cn-northwest-1");
+  static constexpr int CN_NORTH_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("cn-north-1");
+  static constexpr int CN_NORTHWEST_1_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("cn-northwest-1");
   
 
   Aws::String ForRegion(const Aws::String& regionName, bool useDualStack)
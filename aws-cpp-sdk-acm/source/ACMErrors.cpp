@@ -28,14 +28,14 @@ namespace ACM
 namespace ACMErrorMapper
 {
 
-static const int REQUEST_IN_PROGRESS_HASH = HashingUtils::HashString("RequestInProgressException");
-static const int TOO_MANY_TAGS_HASH = HashingUtils::HashString("TooManyTagsException");
-static const int INVALID_DOMAIN_VALIDATION_OPTIONS_HASH = HashingUtils::HashString("InvalidDomainValidationOptionsException");
-static const int INVALID_TAG_HASH = HashingUtils::HashString("InvalidTagException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int INVALID_ARN_HASH = HashingUtils::HashString("InvalidArnException");
-static const int INVALID_STATE_HASH = HashingUtils::HashString("InvalidStateException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
+static constexpr int REQUEST_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("RequestInProgressException");
+static constexpr int TOO_MANY_TAGS_HASH = HashingUtils::CompileTimeHashString("TooManyTagsException");
+static constexpr int INVALID_DOMAIN_VALIDATION_OPTIONS_HASH = HashingUtils::CompileTimeHashString("InvalidDomainValidationOptionsException");
+static constexpr int INVALID_TAG_HASH = HashingUtils::CompileTimeHashString("InvalidTagException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int INVALID_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidArnException");
+static constexpr int INVALID_STATE_HASH = HashingUtils::CompileTimeHashString("InvalidStateException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
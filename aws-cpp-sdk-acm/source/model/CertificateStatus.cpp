@@ -30,45 +30,65 @@ namespace Aws
       namespace CertificateStatusMapper
       {
 
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int ISSUED_HASH = HashingUtils::HashString("ISSUED");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int VALIDATION_TIMED_OUT_HASH = HashingUtils::HashString("VALIDATION_TIMED_OUT");
-        static const int REVOKED_HASH = HashingUtils::HashString("REVOKED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int PENDING_VALIDATION_HASH = HashingUtils::CompileTimeHashString("PENDING_VALIDATION");
+        static constexpr int ISSUED_HASH = HashingUtils::CompileTimeHashString("ISSUED");
+        static constexpr int INACTIVE_HASH = HashingUtils::CompileTimeHashString("INACTIVE");
+        static constexpr int EXPIRED_HASH = HashingUtils::CompileTimeHashString("EXPIRED");
+        static constexpr int VALIDATION_TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("VALIDATION_TIMED_OUT");
+        static constexpr int REVOKED_HASH = HashingUtils::CompileTimeHashString("REVOKED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         CertificateStatus GetCertificateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VALIDATION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CertificateStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == ISSUED_HASH)
-          {
-            return CertificateStatus::ISSUED;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return CertificateStatus::INACTIVE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return CertificateStatus::EXPIRED;
-          }
-          else if (hashCode == VALIDATION_TIMED_OUT_HASH)
-          {
-            return CertificateStatus::VALIDATION_TIMED_OUT;
-          }
-          else if (hashCode == REVOKED_HASH)
-          {
-            return CertificateStatus::REVOKED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return CertificateStatus::FAILED;
+          case PENDING_VALIDATION_HASH:
+            if (name == "PENDING_VALIDATION")
+            {
+              return CertificateStatus::PENDING_VALIDATION;
+            }
+            break;
+          case ISSUED_HASH:
+            if (name == "ISSUED")
+            {
+              return CertificateStatus::ISSUED;
+            }
+            break;
+          case INACTIVE_HASH:
+            if (name == "INACTIVE")
+            {
+              return CertificateStatus::INACTIVE;
+            }
+            break;
+          case EXPIRED_HASH:
+            if (name == "EXPIRED")
+            {
+              return CertificateStatus::EXPIRED;
+            }
+            break;
+          case VALIDATION_TIMED_OUT_HASH:
+            if (name == "VALIDATION_TIMED_OUT")
+            {
+              return CertificateStatus::VALIDATION_TIMED_OUT;
+            }
+            break;
+          case REVOKED_HASH:
+            if (name == "REVOKED")
+            {
+              return CertificateStatus::REVOKED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return CertificateStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return CertificateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateStatus(CertificateStatus enumValue)
+        const char* GetNameForCertificateStatus(CertificateStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace CertificateTypeMapper
       {
 
-        static const int IMPORTED_HASH = HashingUtils::HashString("IMPORTED");
-        static const int AMAZON_ISSUED_HASH = HashingUtils::HashString("AMAZON_ISSUED");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
+        static constexpr int IMPORTED_HASH = HashingUtils::CompileTimeHashString("IMPORTED");
+        static constexpr int AMAZON_ISSUED_HASH = HashingUtils::CompileTimeHashString("AMAZON_ISSUED");
+        static constexpr int PRIVATE__HASH = HashingUtils::CompileTimeHashString("PRIVATE");
 
 
         CertificateType GetCertificateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMPORTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CertificateType::IMPORTED;
-          }
-          else if (hashCode == AMAZON_ISSUED_HASH)
-          {
-            return CertificateType::AMAZON_ISSUED;
-          }
-          else if (hashCode == PRIVATE__HASH)
-          {
-            return CertificateType::PRIVATE_;
+          case IMPORTED_HASH:
+            if (name == "IMPORTED")
+            {
+              return CertificateType::IMPORTED;
+            }
+            break;
+          case AMAZON_ISSUED_HASH:
+            if (name == "AMAZON_ISSUED")
+            {
+              return CertificateType::AMAZON_ISSUED;
+            }
+            break;
+          case PRIVATE__HASH:
+            if (name == "PRIVATE")
+            {
+              return CertificateType::PRIVATE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return CertificateType::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateType(CertificateType enumValue)
+        const char* GetNameForCertificateType(CertificateType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
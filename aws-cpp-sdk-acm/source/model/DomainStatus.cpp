@@ -30,25 +30,37 @@ namespace Aws
       namespace DomainStatusMapper
       {
 
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int PENDING_VALIDATION_HASH = HashingUtils::CompileTimeHashString("PENDING_VALIDATION");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         DomainStatus GetDomainStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VALIDATION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DomainStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return DomainStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DomainStatus::FAILED;
+          case PENDING_VALIDATION_HASH:
+            if (name == "PENDING_VALIDATION")
+            {
+              return DomainStatus::PENDING_VALIDATION;
+            }
+            break;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return DomainStatus::SUCCESS;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return DomainStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DomainStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDomainStatus(DomainStatus enumValue)
+        const char* GetNameForDomainStatus(DomainStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,70 +30,100 @@ namespace Aws
       namespace ExtendedKeyUsageNameMapper
       {
 
-        static const int TLS_WEB_SERVER_AUTHENTICATION_HASH = HashingUtils::HashString("TLS_WEB_SERVER_AUTHENTICATION");
-        static const int TLS_WEB_CLIENT_AUTHENTICATION_HASH = HashingUtils::HashString("TLS_WEB_CLIENT_AUTHENTICATION");
-        static const int CODE_SIGNING_HASH = HashingUtils::HashString("CODE_SIGNING");
-        static const int EMAIL_PROTECTION_HASH = HashingUtils::HashString("EMAIL_PROTECTION");
-        static const int TIME_STAMPING_HASH = HashingUtils::HashString("TIME_STAMPING");
-        static const int OCSP_SIGNING_HASH = HashingUtils::HashString("OCSP_SIGNING");
-        static const int IPSEC_END_SYSTEM_HASH = HashingUtils::HashString("IPSEC_END_SYSTEM");
-        static const int IPSEC_TUNNEL_HASH = HashingUtils::HashString("IPSEC_TUNNEL");
-        static const int IPSEC_USER_HASH = HashingUtils::HashString("IPSEC_USER");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
+        static constexpr int TLS_WEB_SERVER_AUTHENTICATION_HASH = HashingUtils::CompileTimeHashString("TLS_WEB_SERVER_AUTHENTICATION");
+        static constexpr int TLS_WEB_CLIENT_AUTHENTICATION_HASH = HashingUtils::CompileTimeHashString("TLS_WEB_CLIENT_AUTHENTICATION");
+        static constexpr int CODE_SIGNING_HASH = HashingUtils::CompileTimeHashString("CODE_SIGNING");
+        static constexpr int EMAIL_PROTECTION_HASH = HashingUtils::CompileTimeHashString("EMAIL_PROTECTION");
+        static constexpr int TIME_STAMPING_HASH = HashingUtils::CompileTimeHashString("TIME_STAMPING");
+        static constexpr int OCSP_SIGNING_HASH = HashingUtils::CompileTimeHashString("OCSP_SIGNING");
+        static constexpr int IPSEC_END_SYSTEM_HASH = HashingUtils::CompileTimeHashString("IPSEC_END_SYSTEM");
+        static constexpr int IPSEC_TUNNEL_HASH = HashingUtils::CompileTimeHashString("IPSEC_TUNNEL");
+        static constexpr int IPSEC_USER_HASH = HashingUtils::CompileTimeHashString("IPSEC_USER");
+        static constexpr int ANY_HASH = HashingUtils::CompileTimeHashString("ANY");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int CUSTOM_HASH = HashingUtils::CompileTimeHashString("CUSTOM");
 
 
         ExtendedKeyUsageName GetExtendedKeyUsageNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TLS_WEB_SERVER_AUTHENTICATION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExtendedKeyUsageName::TLS_WEB_SERVER_AUTHENTICATION;
-          }
-          else if (hashCode == TLS_WEB_CLIENT_AUTHENTICATION_HASH)
-          {
-            return ExtendedKeyUsageName::TLS_WEB_CLIENT_AUTHENTICATION;
-          }
-          else if (hashCode == CODE_SIGNING_HASH)
-          {
-            return ExtendedKeyUsageName::CODE_SIGNING;
-          }
-          else if (hashCode == EMAIL_PROTECTION_HASH)
-          {
-            return ExtendedKeyUsageName::EMAIL_PROTECTION;
-          }
-          else if (hashCode == TIME_STAMPING_HASH)
-          {
-            return ExtendedKeyUsageName::TIME_STAMPING;
-          }
-          else if (hashCode == OCSP_SIGNING_HASH)
-          {
-            return ExtendedKeyUsageName::OCSP_SIGNING;
-          }
-          else if (hashCode == IPSEC_END_SYSTEM_HASH)
-          {
-            return ExtendedKeyUsageName::IPSEC_END_SYSTEM;
-          }
-          else if (hashCode == IPSEC_TUNNEL_HASH)
-          {
-            return ExtendedKeyUsageName::IPSEC_TUNNEL;
-          }
-          else if (hashCode == IPSEC_USER_HASH)
-          {
-            return ExtendedKeyUsageName::IPSEC_USER;
-          }
-          else if (hashCode == ANY_HASH)
-          {
-            return ExtendedKeyUsageName::ANY;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return ExtendedKeyUsageName::NONE;
-          }
-          else if (hashCode == CUSTOM_HASH)
-          {
-            return ExtendedKeyUsageName::CUSTOM;
+          case TLS_WEB_SERVER_AUTHENTICATION_HASH:
+            if (name == "TLS_WEB_SERVER_AUTHENTICATION")
+            {
+              return ExtendedKeyUsageName::TLS_WEB_SERVER_AUTHENTICATION;
+            }
+            break;
+          case TLS_WEB_CLIENT_AUTHENTICATION_HASH:
+            if (name == "TLS_WEB_CLIENT_AUTHENTICATION")
+            {
+              return ExtendedKeyUsageName::TLS_WEB_CLIENT_AUTHENTICATION;
+            }
+            break;
+          case CODE_SIGNING_HASH:
+            if (name == "CODE_SIGNING")
+            {
+              return ExtendedKeyUsageName::CODE_SIGNING;
+            }
+            break;
+          case EMAIL_PROTECTION_HASH:
+            if (name == "EMAIL_PROTECTION")
+            {
+              return ExtendedKeyUsageName::EMAIL_PROTECTION;
+            }
+            break;
+          case TIME_STAMPING_HASH:
+            if (name == "TIME_STAMPING")
+            {
+              return ExtendedKeyUsageName::TIME_STAMPING;
+            }
+            break;
+          case OCSP_SIGNING_HASH:
+            if (name == "OCSP_SIGNING")
+            {
+              return ExtendedKeyUsageName::OCSP_SIGNING;
+            }
+            break;
+          case IPSEC_END_SYSTEM_HASH:
+            if (name == "IPSEC_END_SYSTEM")
+            {
+              return ExtendedKeyUsageName::IPSEC_END_SYSTEM;
+            }
+            break;
+          case IPSEC_TUNNEL_HASH:
+            if (name == "IPSEC_TUNNEL")
+            {
+              return ExtendedKeyUsageName::IPSEC_TUNNEL;
+            }
+            break;
+          case IPSEC_USER_HASH:
+            if (name == "IPSEC_USER")
+            {
+              return ExtendedKeyUsageName::IPSEC_USER;
+            }
+            break;
+          case ANY_HASH:
+            if (name == "ANY")
+            {
+              return ExtendedKeyUsageName::ANY;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return ExtendedKeyUsageName::NONE;
+            }
+            break;
+          case CUSTOM_HASH:
+            if (name == "CUSTOM")
+            {
+              return ExtendedKeyUsageName::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return ExtendedKeyUsageName::NOT_SET;
         }
 
-        Aws::String GetNameForExtendedKeyUsageName(ExtendedKeyUsageName enumValue)
+        const char* GetNameForExtendedKeyUsageName(ExtendedKeyUsageName enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
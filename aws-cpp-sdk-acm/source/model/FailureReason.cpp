@@ -30,70 +30,100 @@ namespace Aws
       namespace FailureReasonMapper
       {
 
-        static const int NO_AVAILABLE_CONTACTS_HASH = HashingUtils::HashString("NO_AVAILABLE_CONTACTS");
-        static const int ADDITIONAL_VERIFICATION_REQUIRED_HASH = HashingUtils::HashString("ADDITIONAL_VERIFICATION_REQUIRED");
-        static const int DOMAIN_NOT_ALLOWED_HASH = HashingUtils::HashString("DOMAIN_NOT_ALLOWED");
-        static const int INVALID_PUBLIC_DOMAIN_HASH = HashingUtils::HashString("INVALID_PUBLIC_DOMAIN");
-        static const int CAA_ERROR_HASH = HashingUtils::HashString("CAA_ERROR");
-        static const int PCA_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("PCA_LIMIT_EXCEEDED");
-        static const int PCA_INVALID_ARN_HASH = HashingUtils::HashString("PCA_INVALID_ARN");
-        static const int PCA_INVALID_STATE_HASH = HashingUtils::HashString("PCA_INVALID_STATE");
-        static const int PCA_REQUEST_FAILED_HASH = HashingUtils::HashString("PCA_REQUEST_FAILED");
-        static const int PCA_RESOURCE_NOT_FOUND_HASH = HashingUtils::HashString("PCA_RESOURCE_NOT_FOUND");
-        static const int PCA_INVALID_ARGS_HASH = HashingUtils::HashString("PCA_INVALID_ARGS");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
+        static constexpr int NO_AVAILABLE_CONTACTS_HASH = HashingUtils::CompileTimeHashString("NO_AVAILABLE_CONTACTS");
+        static constexpr int ADDITIONAL_VERIFICATION_REQUIRED_HASH = HashingUtils::CompileTimeHashString("ADDITIONAL_VERIFICATION_REQUIRED");
+        static constexpr int DOMAIN_NOT_ALLOWED_HASH = HashingUtils::CompileTimeHashString("DOMAIN_NOT_ALLOWED");
+        static constexpr int INVALID_PUBLIC_DOMAIN_HASH = HashingUtils::CompileTimeHashString("INVALID_PUBLIC_DOMAIN");
+        static constexpr int CAA_ERROR_HASH = HashingUtils::CompileTimeHashString("CAA_ERROR");
+        static constexpr int PCA_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("PCA_LIMIT_EXCEEDED");
+        static constexpr int PCA_INVALID_ARN_HASH = HashingUtils::CompileTimeHashString("PCA_INVALID_ARN");
+        static constexpr int PCA_INVALID_STATE_HASH = HashingUtils::CompileTimeHashString("PCA_INVALID_STATE");
+        static constexpr int PCA_REQUEST_FAILED_HASH = HashingUtils::CompileTimeHashString("PCA_REQUEST_FAILED");
+        static constexpr int PCA_RESOURCE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("PCA_RESOURCE_NOT_FOUND");
+        static constexpr int PCA_INVALID_ARGS_HASH = HashingUtils::CompileTimeHashString("PCA_INVALID_ARGS");
+        static constexpr int OTHER_HASH = HashingUtils::CompileTimeHashString("OTHER");
 
 
         FailureReason GetFailureReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_AVAILABLE_CONTACTS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FailureReason::NO_AVAILABLE_CONTACTS;
-          }
-          else if (hashCode == ADDITIONAL_VERIFICATION_REQUIRED_HASH)
-          {
-            return FailureReason::ADDITIONAL_VERIFICATION_REQUIRED;
-          }
-          else if (hashCode == DOMAIN_NOT_ALLOWED_HASH)
-          {
-            return FailureReason::DOMAIN_NOT_ALLOWED;
-          }
-          else if (hashCode == INVALID_PUBLIC_DOMAIN_HASH)
-          {
-            return FailureReason::INVALID_PUBLIC_DOMAIN;
-          }
-          else if (hashCode == CAA_ERROR_HASH)
-          {
-            return FailureReason::CAA_ERROR;
-          }
-          else if (hashCode == PCA_LIMIT_EXCEEDED_HASH)
-          {
-            return FailureReason::PCA_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == PCA_INVALID_ARN_HASH)
-          {
-            return FailureReason::PCA_INVALID_ARN;
-          }
-          else if (hashCode == PCA_INVALID_STATE_HASH)
-          {
-            return FailureReason::PCA_INVALID_STATE;
-          }
-          else if (hashCode == PCA_REQUEST_FAILED_HASH)
-          {
-            return FailureReason::PCA_REQUEST_FAILED;
-          }
-          else if (hashCode == PCA_RESOURCE_NOT_FOUND_HASH)
-          {
-            return FailureReason::PCA_RESOURCE_NOT_FOUND;
-          }
-          else if (hashCode == PCA_INVALID_ARGS_HASH)
-          {
-            return FailureReason::PCA_INVALID_ARGS;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return FailureReason::OTHER;
+          case NO_AVAILABLE_CONTACTS_HASH:
+            if (name == "NO_AVAILABLE_CONTACTS")
+            {
+              return FailureReason::NO_AVAILABLE_CONTACTS;
+            }
+            break;
+          case ADDITIONAL_VERIFICATION_REQUIRED_HASH:
+            if (name == "ADDITIONAL_VERIFICATION_REQUIRED")
+            {
+              return FailureReason::ADDITIONAL_VERIFICATION_REQUIRED;
+            }
+            break;
+          case DOMAIN_NOT_ALLOWED_HASH:
+            if (name == "DOMAIN_NOT_ALLOWED")
+            {
+              return FailureReason::DOMAIN_NOT_ALLOWED;
+            }
+            break;
+          case INVALID_PUBLIC_DOMAIN_HASH:
+            if (name == "INVALID_PUBLIC_DOMAIN")
+            {
+              return FailureReason::INVALID_PUBLIC_DOMAIN;
+            }
+            break;
+          case CAA_ERROR_HASH:
+            if (name == "CAA_ERROR")
+            {
+              return FailureReason::CAA_ERROR;
+            }
+            break;
+          case PCA_LIMIT_EXCEEDED_HASH:
+            if (name == "PCA_LIMIT_EXCEEDED")
+            {
+              return FailureReason::PCA_LIMIT_EXCEEDED;
+            }
+            break;
+          case PCA_INVALID_ARN_HASH:
+            if (name == "PCA_INVALID_ARN")
+            {
+              return FailureReason::PCA_INVALID_ARN;
+            }
+            break;
+          case PCA_INVALID_STATE_HASH:
+            if (name == "PCA_INVALID_STATE")
+            {
+              return FailureReason::PCA_INVALID_STATE;
+            }
+            break;
+          case PCA_REQUEST_FAILED_HASH:
+            if (name == "PCA_REQUEST_FAILED")
+            {
+              return FailureReason::PCA_REQUEST_FAILED;
+            }
+            break;
+          case PCA_RESOURCE_NOT_FOUND_HASH:
+            if (name == "PCA_RESOURCE_NOT_FOUND")
+            {
+              return FailureReason::PCA_RESOURCE_NOT_FOUND;
+            }
+            break;
+          case PCA_INVALID_ARGS_HASH:
+            if (name == "PCA_INVALID_ARGS")
+            {
+              return FailureReason::PCA_INVALID_ARGS;
+            }
+            break;
+          case OTHER_HASH:
+            if (name == "OTHER")
+            {
+              return FailureReason::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return FailureReason::NOT_SET;
         }
 
-        Aws::String GetNameForFailureReason(FailureReason enumValue)
+        const char* GetNameForFailureReason(FailureReason enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,65 +30,93 @@ namespace Aws
       namespace KeyUsageNameMapper
       {
 
-        static const int DIGITAL_SIGNATURE_HASH = HashingUtils::HashString("DIGITAL_SIGNATURE");
-        static const int NON_REPUDIATION_HASH = HashingUtils::HashString("NON_REPUDIATION");
-        static const int KEY_ENCIPHERMENT_HASH = HashingUtils::HashString("KEY_ENCIPHERMENT");
-        static const int DATA_ENCIPHERMENT_HASH = HashingUtils::HashString("DATA_ENCIPHERMENT");
-        static const int KEY_AGREEMENT_HASH = HashingUtils::HashString("KEY_AGREEMENT");
-        static const int CERTIFICATE_SIGNING_HASH = HashingUtils::HashString("CERTIFICATE_SIGNING");
-        static const int CRL_SIGNING_HASH = HashingUtils::HashString("CRL_SIGNING");
-        static const int ENCIPHER_ONLY_HASH = HashingUtils::HashString("ENCIPHER_ONLY");
-        static const int DECIPHER_ONLY_HASH = HashingUtils::HashString("DECIPHER_ONLY");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
+        static constexpr int DIGITAL_SIGNATURE_HASH = HashingUtils::CompileTimeHashString("DIGITAL_SIGNATURE");
+        static constexpr int NON_REPUDIATION_HASH = HashingUtils::CompileTimeHashString("NON_REPUDIATION");
+        static constexpr int KEY_ENCIPHERMENT_HASH = HashingUtils::CompileTimeHashString("KEY_ENCIPHERMENT");
+        static constexpr int DATA_ENCIPHERMENT_HASH = HashingUtils::CompileTimeHashString("DATA_ENCIPHERMENT");
+        static constexpr int KEY_AGREEMENT_HASH = HashingUtils::CompileTimeHashString("KEY_AGREEMENT");
+        static constexpr int CERTIFICATE_SIGNING_HASH = HashingUtils::CompileTimeHashString("CERTIFICATE_SIGNING");
+        static constexpr int CRL_SIGNING_HASH = HashingUtils::CompileTimeHashString("CRL_SIGNING");
+        static constexpr int ENCIPHER_ONLY_HASH = HashingUtils::CompileTimeHashString("ENCIPHER_ONLY");
+        static constexpr int DECIPHER_ONLY_HASH = HashingUtils::CompileTimeHashString("DECIPHER_ONLY");
+        static constexpr int ANY_HASH = HashingUtils::CompileTimeHashString("ANY");
+        static constexpr int CUSTOM_HASH = HashingUtils::CompileTimeHashString("CUSTOM");
 
 
         KeyUsageName GetKeyUsageNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DIGITAL_SIGNATURE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return KeyUsageName::DIGITAL_SIGNATURE;
-          }
-          else if (hashCode == NON_REPUDIATION_HASH)
-          {
-            return KeyUsageName::NON_REPUDIATION;
-          }
-          else if (hashCode == KEY_ENCIPHERMENT_HASH)
-          {
-            return KeyUsageName::KEY_ENCIPHERMENT;
-          }
-          else if (hashCode == DATA_ENCIPHERMENT_HASH)
-          {
-            return KeyUsageName::DATA_ENCIPHERMENT;
-          }
-          else if (hashCode == KEY_AGREEMENT_HASH)
-          {
-            return KeyUsageName::KEY_AGREEMENT;
-          }
-          else if (hashCode == CERTIFICATE_SIGNING_HASH)
-          {
-            return KeyUsageName::CERTIFICATE_SIGNING;
-          }
-          else if (hashCode == CRL_SIGNING_HASH)
-          {
-            return KeyUsageName::CRL_SIGNING;
-          }
-          else if (hashCode == ENCIPHER_ONLY_HASH)
-          {
-            return KeyUsageName::ENCIPHER_ONLY;
-          }
-          else if (hashCode == DECIPHER_ONLY_HASH)
-          {
-            return KeyUsageName::DECIPHER_ONLY;
-          }
-          else if (hashCode == ANY_HASH)
-          {
-            return KeyUsageName::ANY;
-          }
-          else if (hashCode == CUSTOM_HASH)
-          {
-            return KeyUsageName::CUSTOM;
+          case DIGITAL_SIGNATURE_HASH:
+            if (name == "DIGITAL_SIGNATURE")
+            {
+              return KeyUsageName::DIGITAL_SIGNATURE;
+            }
+            break;
+          case NON_REPUDIATION_HASH:
+            if (name == "NON_REPUDIATION")
+            {
+              return KeyUsageName::NON_REPUDIATION;
+            }
+            break;
+          case KEY_ENCIPHERMENT_HASH:
+            if (name == "KEY_ENCIPHERMENT")
+            {
+              return KeyUsageName::KEY_ENCIPHERMENT;
+            }
+            break;
+          case DATA_ENCIPHERMENT_HASH:
+            if (name == "DATA_ENCIPHERMENT")
+            {
+              return KeyUsageName::DATA_ENCIPHERMENT;
+            }
+            break;
+          case KEY_AGREEMENT_HASH:
+            if (name == "KEY_AGREEMENT")
+            {
+              return KeyUsageName::KEY_AGREEMENT;
+            }
+            break;
+          case CERTIFICATE_SIGNING_HASH:
+            if (name == "CERTIFICATE_SIGNING")
+            {
+              return KeyUsageName::CERTIFICATE_SIGNING;
+            }
+            break;
+          case CRL_SIGNING_HASH:
+            if (name == "CRL_SIGNING")
+            {
+              return KeyUsageName::CRL_SIGNING;
+            }
+            break;
+          case ENCIPHER_ONLY_HASH:
+            if (name == "ENCIPHER_ONLY")
+            {
+              return KeyUsageName::ENCIPHER_ONLY;
+            }
+            break;
+          case DECIPHER_ONLY_HASH:
+            if (name == "DECIPHER_ONLY")
+            {
+              return KeyUsageName::DECIPHER_ONLY;
+            }
+            break;
+          case ANY_HASH:
+            if (name == "ANY")
+            {
+              return KeyUsageName::ANY;
+            }
+            break;
+          case CUSTOM_HASH:
+            if (name == "CUSTOM")
+            {
+              return KeyUsageName::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return KeyUsageName::NOT_SET;
         }
 
-        Aws::String GetNameForKeyUsageName(KeyUsageName enumValue)
+        const char* GetNameForKeyUsageName(KeyUsageName enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace RecordTypeMapper
       {
 
-        static const int CNAME_HASH = HashingUtils::HashString("CNAME");
+        static constexpr int CNAME_HASH = HashingUtils::CompileTimeHashString("CNAME");
 
 
         RecordType GetRecordTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CNAME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RecordType::CNAME;
+          case CNAME_HASH:
+            if (name == "CNAME")
+            {
+              return RecordType::CNAME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return RecordType::NOT_SET;
         }
 
-        Aws::String GetNameForRecordType(RecordType enumValue)
+        const char* GetNameForRecordType(RecordType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace RenewalEligibilityMapper
       {
 
-        static const int ELIGIBLE_HASH = HashingUtils::HashString("ELIGIBLE");
-        static const int INELIGIBLE_HASH = HashingUtils::HashString("INELIGIBLE");
+        static constexpr int ELIGIBLE_HASH = HashingUtils::CompileTimeHashString("ELIGIBLE");
+        static constexpr int INELIGIBLE_HASH = HashingUtils::CompileTimeHashString("INELIGIBLE");
 
 
         RenewalEligibility GetRenewalEligibilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ELIGIBLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RenewalEligibility::ELIGIBLE;
-          }
-          else if (hashCode == INELIGIBLE_HASH)
-          {
-            return RenewalEligibility::INELIGIBLE;
+          case ELIGIBLE_HASH:
+            if (name == "ELIGIBLE")
+            {
+              return RenewalEligibility::ELIGIBLE;
+            }
+            break;
+          case INELIGIBLE_HASH:
+            if (name == "INELIGIBLE")
+            {
+              return RenewalEligibility::INELIGIBLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RenewalEligibility::NOT_SET;
         }
 
-        Aws::String GetNameForRenewalEligibility(RenewalEligibility enumValue)
+        const char* GetNameForRenewalEligibility(RenewalEligibility enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
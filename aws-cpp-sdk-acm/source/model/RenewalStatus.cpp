@@ -30,30 +30,44 @@ namespace Aws
       namespace RenewalStatusMapper
       {
 
-        static const int PENDING_AUTO_RENEWAL_HASH = HashingUtils::HashString("PENDING_AUTO_RENEWAL");
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int PENDING_AUTO_RENEWAL_HASH = HashingUtils::CompileTimeHashString("PENDING_AUTO_RENEWAL");
+        static constexpr int PENDING_VALIDATION_HASH = HashingUtils::CompileTimeHashString("PENDING_VALIDATION");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         RenewalStatus GetRenewalStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_AUTO_RENEWAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RenewalStatus::PENDING_AUTO_RENEWAL;
-          }
-          else if (hashCode == PENDING_VALIDATION_HASH)
-          {
-            return RenewalStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return RenewalStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return RenewalStatus::FAILED;
+          case PENDING_AUTO_RENEWAL_HASH:
+            if (name == "PENDING_AUTO_RENEWAL")
+            {
+              return RenewalStatus::PENDING_AUTO_RENEWAL;
+            }
+            break;
+          case PENDING_VALIDATION_HASH:
+            if (name == "PENDING_VALIDATION")
+            {
+              return RenewalStatus::PENDING_VALIDATION;
+            }
+            break;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return RenewalStatus::SUCCESS;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return RenewalStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return RenewalStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRenewalStatus(RenewalStatus enumValue)
+        const char* GetNameForRenewalStatus(RenewalStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,60 +30,86 @@ namespace Aws
       namespace RevocationReasonMapper
       {
 
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
-        static const int KEY_COMPROMISE_HASH = HashingUtils::HashString("KEY_COMPROMISE");
-        static const int CA_COMPROMISE_HASH = HashingUtils::HashString("CA_COMPROMISE");
-        static const int AFFILIATION_CHANGED_HASH = HashingUtils::HashString("AFFILIATION_CHANGED");
-        static const int SUPERCEDED_HASH = HashingUtils::HashString("SUPERCEDED");
-        static const int CESSATION_OF_OPERATION_HASH = HashingUtils::HashString("CESSATION_OF_OPERATION");
-        static const int CERTIFICATE_HOLD_HASH = HashingUtils::HashString("CERTIFICATE_HOLD");
-        static const int REMOVE_FROM_CRL_HASH = HashingUtils::HashString("REMOVE_FROM_CRL");
-        static const int PRIVILEGE_WITHDRAWN_HASH = HashingUtils::HashString("PRIVILEGE_WITHDRAWN");
-        static const int A_A_COMPROMISE_HASH = HashingUtils::HashString("A_A_COMPROMISE");
+        static constexpr int UNSPECIFIED_HASH = HashingUtils::CompileTimeHashString("UNSPECIFIED");
+        static constexpr int KEY_COMPROMISE_HASH = HashingUtils::CompileTimeHashString("KEY_COMPROMISE");
+        static constexpr int CA_COMPROMISE_HASH = HashingUtils::CompileTimeHashString("CA_COMPROMISE");
+        static constexpr int AFFILIATION_CHANGED_HASH = HashingUtils::CompileTimeHashString("AFFILIATION_CHANGED");
+        static constexpr int SUPERCEDED_HASH = HashingUtils::CompileTimeHashString("SUPERCEDED");
+        static constexpr int CESSATION_OF_OPERATION_HASH = HashingUtils::CompileTimeHashString("CESSATION_OF_OPERATION");
+        static constexpr int CERTIFICATE_HOLD_HASH = HashingUtils::CompileTimeHashString("CERTIFICATE_HOLD");
+        static constexpr int REMOVE_FROM_CRL_HASH = HashingUtils::CompileTimeHashString("REMOVE_FROM_CRL");
+        static constexpr int PRIVILEGE_WITHDRAWN_HASH = HashingUtils::CompileTimeHashString("PRIVILEGE_WITHDRAWN");
+        static constexpr int A_A_COMPROMISE_HASH = HashingUtils::CompileTimeHashString("A_A_COMPROMISE");
 
 
         RevocationReason GetRevocationReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNSPECIFIED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RevocationReason::UNSPECIFIED;
-          }
-          else if (hashCode == KEY_COMPROMISE_HASH)
-          {
-            return RevocationReason::KEY_COMPROMISE;
-          }
-          else if (hashCode == CA_COMPROMISE_HASH)
-          {
-            return RevocationReason::CA_COMPROMISE;
-          }
-          else if (hashCode == AFFILIATION_CHANGED_HASH)
-          {
-            return RevocationReason::AFFILIATION_CHANGED;
-          }
-          else if (hashCode == SUPERCEDED_HASH)
-          {
-            return RevocationReason::SUPERCEDED;
-          }
-          else if (hashCode == CESSATION_OF_OPERATION_HASH)
-          {
-            return RevocationReason::CESSATION_OF_OPERATION;
-          }
-          else if (hashCode == CERTIFICATE_HOLD_HASH)
-          {
-            return RevocationReason::CERTIFICATE_HOLD;
-          }
-          else if (hashCode == REMOVE_FROM_CRL_HASH)
-          {
-            return RevocationReason::REMOVE_FROM_CRL;
-          }
-          else if (hashCode == PRIVILEGE_WITHDRAWN_HASH)
-          {
-            return RevocationReason::PRIVILEGE_WITHDRAWN;
-          }
-          else if (hashCode == A_A_COMPROMISE_HASH)
-          {
-            return RevocationReason::A_A_COMPROMISE;
+          case UNSPECIFIED_HASH:
+            if (name == "UNSPECIFIED")
+            {
+              return RevocationReason::UNSPECIFIED;
+            }
+            break;
+          case KEY_COMPROMISE_HASH:
+            if (name == "KEY_COMPROMISE")
+            {
+              return RevocationReason::KEY_COMPROMISE;
+            }
+            break;
+          case CA_COMPROMISE_HASH:
+            if (name == "CA_COMPROMISE")
+            {
+              return RevocationReason::CA_COMPROMISE;
+            }
+            break;
+          case AFFILIATION_CHANGED_HASH:
+            if (name == "AFFILIATION_CHANGED")
+            {
+              return RevocationReason::AFFILIATION_CHANGED;
+            }
+            break;
+          case SUPERCEDED_HASH:
+            if (name == "SUPERCEDED")
+            {
+              return RevocationReason::SUPERCEDED;
+            }
+            break;
+          case CESSATION_OF_OPERATION_HASH:
+            if (name == "CESSATION_OF_OPERATION")
+            {
+              return RevocationReason::CESSATION_OF_OPERATION;
+            }
+            break;
+          case CERTIFICATE_HOLD_HASH:
+            if (name == "CERTIFICATE_HOLD")
+            {
+              return RevocationReason::CERTIFICATE_HOLD;
+            }
+            break;
+          case REMOVE_FROM_CRL_HASH:
+            if (name == "REMOVE_FROM_CRL")
+            {
+              return RevocationReason::REMOVE_FROM_CRL;
+            }
+            break;
+          case PRIVILEGE_WITHDRAWN_HASH:
+            if (name == "PRIVILEGE_WITHDRAWN")
+            {
+              return RevocationReason::PRIVILEGE_WITHDRAWN;
+            }
+            break;
+          case A_A_COMPROMISE_HASH:
+            if (name == "A_A_COMPROMISE")
+            {
+              return RevocationReason::A_A_COMPROMISE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return RevocationReason::NOT_SET;
         }
 
-        Aws::String GetNameForRevocationReason(RevocationReason enumValue)
+        const char* GetNameForRevocationReason(RevocationReason enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
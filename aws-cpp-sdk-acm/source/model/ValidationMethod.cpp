@@ -30,20 +30,30 @@ namespace Aws
       namespace ValidationMethodMapper
       {
 
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-        static const int DNS_HASH = HashingUtils::HashString("DNS");
+        static constexpr int EMAIL_HASH = HashingUtils::CompileTimeHashString("EMAIL");
+        static constexpr int DNS_HASH = HashingUtils::CompileTimeHashString("DNS");
 
 
         ValidationMethod GetValidationMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMAIL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ValidationMethod::EMAIL;
-          }
-          else if (hashCode == DNS_HASH)
-          {
-            return ValidationMethod::DNS;
+          case EMAIL_HASH:
+            if (name == "EMAIL")
+            {
+              return ValidationMethod::EMAIL;
+            }
+            break;
+          case DNS_HASH:
+            if (name == "DNS")
+            {
+              return ValidationMethod::DNS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ValidationMethod::NOT_SET;
         }
 
-        Aws::String GetNameForValidationMethod(ValidationMethod enumValue)
+        const char* GetNameForValidationMethod(ValidationMethod enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace ConnectionStatusMapper
 {
 AWS_ALEXAFORBUSINESS_API ConnectionStatus GetConnectionStatusForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForConnectionStatus(ConnectionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForConnectionStatus(ConnectionStatus value);
 } // namespace ConnectionStatusMapper
 } // namespace Model
 } // namespace AlexaForBusiness
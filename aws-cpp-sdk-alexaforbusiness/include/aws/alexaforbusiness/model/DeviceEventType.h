@@ -34,7 +34,8 @@ namespace DeviceEventTypeMapper
 {
 AWS_ALEXAFORBUSINESS_API DeviceEventType GetDeviceEventTypeForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForDeviceEventType(DeviceEventType value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForDeviceEventType(DeviceEventType value);
 } // namespace DeviceEventTypeMapper
 } // namespace Model
 } // namespace AlexaForBusiness
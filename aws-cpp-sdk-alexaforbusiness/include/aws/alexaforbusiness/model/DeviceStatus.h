@@ -36,7 +36,8 @@ namespace DeviceStatusMapper
 {
 AWS_ALEXAFORBUSINESS_API DeviceStatus GetDeviceStatusForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForDeviceStatus(DeviceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForDeviceStatus(DeviceStatus value);
 } // namespace DeviceStatusMapper
 } // namespace Model
 } // namespace AlexaForBusiness
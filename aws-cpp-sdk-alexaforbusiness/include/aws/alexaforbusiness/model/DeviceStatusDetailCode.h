@@ -34,7 +34,8 @@ namespace DeviceStatusDetailCodeMapper
 {
 AWS_ALEXAFORBUSINESS_API DeviceStatusDetailCode GetDeviceStatusDetailCodeForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForDeviceStatusDetailCode(DeviceStatusDetailCode value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForDeviceStatusDetailCode(DeviceStatusDetailCode value);
 } // namespace DeviceStatusDetailCodeMapper
 } // namespace Model
 } // namespace AlexaForBusiness
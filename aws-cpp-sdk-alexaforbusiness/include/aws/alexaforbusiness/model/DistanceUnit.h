@@ -34,7 +34,8 @@ namespace DistanceUnitMapper
 {
 AWS_ALEXAFORBUSINESS_API DistanceUnit GetDistanceUnitForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForDistanceUnit(DistanceUnit value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForDistanceUnit(DistanceUnit value);
 } // namespace DistanceUnitMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -37,7 +37,8 @@ namespace EnrollmentStatusMapper
 {
 AWS_ALEXAFORBUSINESS_API EnrollmentStatus GetEnrollmentStatusForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForEnrollmentStatus(EnrollmentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForEnrollmentStatus(EnrollmentStatus value);
 } // namespace EnrollmentStatusMapper
 } // namespace Model
 } // namespace AlexaForBusiness
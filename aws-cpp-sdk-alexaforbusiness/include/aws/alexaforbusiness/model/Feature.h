@@ -38,7 +38,8 @@ namespace FeatureMapper
 {
 AWS_ALEXAFORBUSINESS_API Feature GetFeatureForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForFeature(Feature value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForFeature(Feature value);
 } // namespace FeatureMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -34,7 +34,8 @@ namespace SortValueMapper
 {
 AWS_ALEXAFORBUSINESS_API SortValue GetSortValueForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForSortValue(SortValue value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForSortValue(SortValue value);
 } // namespace SortValueMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -34,7 +34,8 @@ namespace TemperatureUnitMapper
 {
 AWS_ALEXAFORBUSINESS_API TemperatureUnit GetTemperatureUnitForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForTemperatureUnit(TemperatureUnit value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForTemperatureUnit(TemperatureUnit value);
 } // namespace TemperatureUnitMapper
 } // namespace Model
 } // namespace AlexaForBusiness
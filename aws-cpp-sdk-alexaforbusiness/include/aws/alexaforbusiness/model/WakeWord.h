@@ -36,7 +36,8 @@ namespace WakeWordMapper
 {
 AWS_ALEXAFORBUSINESS_API WakeWord GetWakeWordForName(const Aws::String& name);
 
-AWS_ALEXAFORBUSINESS_API Aws::String GetNameForWakeWord(WakeWord value);
+// names of values not modeled point into the enum overflow container
+AWS_ALEXAFORBUSINESS_API const char* GetNameForWakeWord(WakeWord value);
 } // namespace WakeWordMapper
 } // namespace Model
 } // namespace AlexaForBusiness
@@ -28,13 +28,13 @@ namespace AlexaForBusiness
 namespace AlexaForBusinessErrorMapper
 {
 
-static const int ALREADY_EXISTS_HASH = HashingUtils::HashString("AlreadyExistsException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int INVALID_USER_STATUS_HASH = HashingUtils::HashString("InvalidUserStatusException");
-static const int DEVICE_NOT_REGISTERED_HASH = HashingUtils::HashString("DeviceNotRegisteredException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int NAME_IN_USE_HASH = HashingUtils::HashString("NameInUseException");
+static constexpr int ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("AlreadyExistsException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int INVALID_USER_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidUserStatusException");
+static constexpr int DEVICE_NOT_REGISTERED_HASH = HashingUtils::CompileTimeHashString("DeviceNotRegisteredException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int NAME_IN_USE_HASH = HashingUtils::CompileTimeHashString("NameInUseException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
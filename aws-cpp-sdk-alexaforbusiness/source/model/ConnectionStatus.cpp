@@ -30,20 +30,30 @@ namespace Aws
       namespace ConnectionStatusMapper
       {
 
-        static const int ONLINE_HASH = HashingUtils::HashString("ONLINE");
-        static const int OFFLINE_HASH = HashingUtils::HashString("OFFLINE");
+        static constexpr int ONLINE_HASH = HashingUtils::CompileTimeHashString("ONLINE");
+        static constexpr int OFFLINE_HASH = HashingUtils::CompileTimeHashString("OFFLINE");
 
 
         ConnectionStatus GetConnectionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONLINE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConnectionStatus::ONLINE;
-          }
-          else if (hashCode == OFFLINE_HASH)
-          {
-            return ConnectionStatus::OFFLINE;
+          case ONLINE_HASH:
+            if (name == "ONLINE")
+            {
+              return ConnectionStatus::ONLINE;
+            }
+            break;
+          case OFFLINE_HASH:
+            if (name == "OFFLINE")
+            {
+              return ConnectionStatus::OFFLINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ConnectionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionStatus(ConnectionStatus enumValue)
+        const char* GetNameForConnectionStatus(ConnectionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DeviceEventTypeMapper
       {
 
-        static const int CONNECTION_STATUS_HASH = HashingUtils::HashString("CONNECTION_STATUS");
-        static const int DEVICE_STATUS_HASH = HashingUtils::HashString("DEVICE_STATUS");
+        static constexpr int CONNECTION_STATUS_HASH = HashingUtils::CompileTimeHashString("CONNECTION_STATUS");
+        static constexpr int DEVICE_STATUS_HASH = HashingUtils::CompileTimeHashString("DEVICE_STATUS");
 
 
         DeviceEventType GetDeviceEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONNECTION_STATUS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeviceEventType::CONNECTION_STATUS;
-          }
-          else if (hashCode == DEVICE_STATUS_HASH)
-          {
-            return DeviceEventType::DEVICE_STATUS;
+          case CONNECTION_STATUS_HASH:
+            if (name == "CONNECTION_STATUS")
+            {
+              return DeviceEventType::CONNECTION_STATUS;
+            }
+            break;
+          case DEVICE_STATUS_HASH:
+            if (name == "DEVICE_STATUS")
+            {
+              return DeviceEventType::DEVICE_STATUS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeviceEventType::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceEventType(DeviceEventType enumValue)
+        const char* GetNameForDeviceEventType(DeviceEventType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
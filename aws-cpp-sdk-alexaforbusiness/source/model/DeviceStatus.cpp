@@ -30,30 +30,44 @@ namespace Aws
       namespace DeviceStatusMapper
       {
 
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int WAS_OFFLINE_HASH = HashingUtils::HashString("WAS_OFFLINE");
-        static const int DEREGISTERED_HASH = HashingUtils::HashString("DEREGISTERED");
+        static constexpr int READY_HASH = HashingUtils::CompileTimeHashString("READY");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int WAS_OFFLINE_HASH = HashingUtils::CompileTimeHashString("WAS_OFFLINE");
+        static constexpr int DEREGISTERED_HASH = HashingUtils::CompileTimeHashString("DEREGISTERED");
 
 
         DeviceStatus GetDeviceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeviceStatus::READY;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return DeviceStatus::PENDING;
-          }
-          else if (hashCode == WAS_OFFLINE_HASH)
-          {
-            return DeviceStatus::WAS_OFFLINE;
-          }
-          else if (hashCode == DEREGISTERED_HASH)
-          {
-            return DeviceStatus::DEREGISTERED;
+          case READY_HASH:
+            if (name == "READY")
+            {
+              return DeviceStatus::READY;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return DeviceStatus::PENDING;
+            }
+            break;
+          case WAS_OFFLINE_HASH:
+            if (name == "WAS_OFFLINE")
+            {
+              return DeviceStatus::WAS_OFFLINE;
+            }
+            break;
+          case DEREGISTERED_HASH:
+            if (name == "DEREGISTERED")
+            {
+              return DeviceStatus::DEREGISTERED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DeviceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceStatus(DeviceStatus enumValue)
+        const char* GetNameForDeviceStatus(DeviceStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DeviceStatusDetailCodeMapper
       {
 
-        static const int DEVICE_SOFTWARE_UPDATE_NEEDED_HASH = HashingUtils::HashString("DEVICE_SOFTWARE_UPDATE_NEEDED");
-        static const int DEVICE_WAS_OFFLINE_HASH = HashingUtils::HashString("DEVICE_WAS_OFFLINE");
+        static constexpr int DEVICE_SOFTWARE_UPDATE_NEEDED_HASH = HashingUtils::CompileTimeHashString("DEVICE_SOFTWARE_UPDATE_NEEDED");
+        static constexpr int DEVICE_WAS_OFFLINE_HASH = HashingUtils::CompileTimeHashString("DEVICE_WAS_OFFLINE");
 
 
         DeviceStatusDetailCode GetDeviceStatusDetailCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEVICE_SOFTWARE_UPDATE_NEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeviceStatusDetailCode::DEVICE_SOFTWARE_UPDATE_NEEDED;
-          }
-          else if (hashCode == DEVICE_WAS_OFFLINE_HASH)
-          {
-            return DeviceStatusDetailCode::DEVICE_WAS_OFFLINE;
+          case DEVICE_SOFTWARE_UPDATE_NEEDED_HASH:
+            if (name == "DEVICE_SOFTWARE_UPDATE_NEEDED")
+            {
+              return DeviceStatusDetailCode::DEVICE_SOFTWARE_UPDATE_NEEDED;
+            }
+            break;
+          case DEVICE_WAS_OFFLINE_HASH:
+            if (name == "DEVICE_WAS_OFFLINE")
+            {
+              return DeviceStatusDetailCode::DEVICE_WAS_OFFLINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeviceStatusDetailCode::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceStatusDetailCode(DeviceStatusDetailCode enumValue)
+        const char* GetNameForDeviceStatusDetailCode(DeviceStatusDetailCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DistanceUnitMapper
       {
 
-        static const int METRIC_HASH = HashingUtils::HashString("METRIC");
-        static const int IMPERIAL_HASH = HashingUtils::HashString("IMPERIAL");
+        static constexpr int METRIC_HASH = HashingUtils::CompileTimeHashString("METRIC");
+        static constexpr int IMPERIAL_HASH = HashingUtils::CompileTimeHashString("IMPERIAL");
 
 
         DistanceUnit GetDistanceUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == METRIC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DistanceUnit::METRIC;
-          }
-          else if (hashCode == IMPERIAL_HASH)
-          {
-            return DistanceUnit::IMPERIAL;
+          case METRIC_HASH:
+            if (name == "METRIC")
+            {
+              return DistanceUnit::METRIC;
+            }
+            break;
+          case IMPERIAL_HASH:
+            if (name == "IMPERIAL")
+            {
+              return DistanceUnit::IMPERIAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DistanceUnit::NOT_SET;
         }
 
-        Aws::String GetNameForDistanceUnit(DistanceUnit enumValue)
+        const char* GetNameForDistanceUnit(DistanceUnit enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
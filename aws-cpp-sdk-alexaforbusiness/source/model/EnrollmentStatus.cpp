@@ -30,35 +30,51 @@ namespace Aws
       namespace EnrollmentStatusMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int REGISTERED_HASH = HashingUtils::HashString("REGISTERED");
-        static const int DISASSOCIATING_HASH = HashingUtils::HashString("DISASSOCIATING");
-        static const int DEREGISTERING_HASH = HashingUtils::HashString("DEREGISTERING");
+        static constexpr int INITIALIZED_HASH = HashingUtils::CompileTimeHashString("INITIALIZED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int REGISTERED_HASH = HashingUtils::CompileTimeHashString("REGISTERED");
+        static constexpr int DISASSOCIATING_HASH = HashingUtils::CompileTimeHashString("DISASSOCIATING");
+        static constexpr int DEREGISTERING_HASH = HashingUtils::CompileTimeHashString("DEREGISTERING");
 
 
         EnrollmentStatus GetEnrollmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnrollmentStatus::INITIALIZED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return EnrollmentStatus::PENDING;
-          }
-          else if (hashCode == REGISTERED_HASH)
-          {
-            return EnrollmentStatus::REGISTERED;
-          }
-          else if (hashCode == DISASSOCIATING_HASH)
-          {
-            return EnrollmentStatus::DISASSOCIATING;
-          }
-          else if (hashCode == DEREGISTERING_HASH)
-          {
-            return EnrollmentStatus::DEREGISTERING;
+          case INITIALIZED_HASH:
+            if (name == "INITIALIZED")
+            {
+              return EnrollmentStatus::INITIALIZED;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return EnrollmentStatus::PENDING;
+            }
+            break;
+          case REGISTERED_HASH:
+            if (name == "REGISTERED")
+            {
+              return EnrollmentStatus::REGISTERED;
+            }
+            break;
+          case DISASSOCIATING_HASH:
+            if (name == "DISASSOCIATING")
+            {
+              return EnrollmentStatus::DISASSOCIATING;
+            }
+            break;
+          case DEREGISTERING_HASH:
+            if (name == "DEREGISTERING")
+            {
+              return EnrollmentStatus::DEREGISTERING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return EnrollmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEnrollmentStatus(EnrollmentStatus enumValue)
+        const char* GetNameForEnrollmentStatus(EnrollmentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace FeatureMapper
       {
 
-        static const int BLUETOOTH_HASH = HashingUtils::HashString("BLUETOOTH");
-        static const int VOLUME_HASH = HashingUtils::HashString("VOLUME");
-        static const int NOTIFICATIONS_HASH = HashingUtils::HashString("NOTIFICATIONS");
-        static const int LISTS_HASH = HashingUtils::HashString("LISTS");
-        static const int SKILLS_HASH = HashingUtils::HashString("SKILLS");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        static constexpr int BLUETOOTH_HASH = HashingUtils::CompileTimeHashString("BLUETOOTH");
+        static constexpr int VOLUME_HASH = HashingUtils::CompileTimeHashString("VOLUME");
+        static constexpr int NOTIFICATIONS_HASH = HashingUtils::CompileTimeHashString("NOTIFICATIONS");
+        static constexpr int LISTS_HASH = HashingUtils::CompileTimeHashString("LISTS");
+        static constexpr int SKILLS_HASH = HashingUtils::CompileTimeHashString("SKILLS");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
 
 
         Feature GetFeatureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLUETOOTH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Feature::BLUETOOTH;
-          }
-          else if (hashCode == VOLUME_HASH)
-          {
-            return Feature::VOLUME;
-          }
-          else if (hashCode == NOTIFICATIONS_HASH)
-          {
-            return Feature::NOTIFICATIONS;
-          }
-          else if (hashCode == LISTS_HASH)
-          {
-            return Feature::LISTS;
-          }
-          else if (hashCode == SKILLS_HASH)
-          {
-            return Feature::SKILLS;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return Feature::ALL;
+          case BLUETOOTH_HASH:
+            if (name == "BLUETOOTH")
+            {
+              return Feature::BLUETOOTH;
+            }
+            break;
+          case VOLUME_HASH:
+            if (name == "VOLUME")
+            {
+              return Feature::VOLUME;
+            }
+            break;
+          case NOTIFICATIONS_HASH:
+            if (name == "NOTIFICATIONS")
+            {
+              return Feature::NOTIFICATIONS;
+            }
+            break;
+          case LISTS_HASH:
+            if (name == "LISTS")
+            {
+              return Feature::LISTS;
+            }
+            break;
+          case SKILLS_HASH:
+            if (name == "SKILLS")
+            {
+              return Feature::SKILLS;
+            }
+            break;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return Feature::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return Feature::NOT_SET;
         }
 
-        Aws::String GetNameForFeature(Feature enumValue)
+        const char* GetNameForFeature(Feature enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace TemperatureUnitMapper
       {
 
-        static const int FAHRENHEIT_HASH = HashingUtils::HashString("FAHRENHEIT");
-        static const int CELSIUS_HASH = HashingUtils::HashString("CELSIUS");
+        static constexpr int FAHRENHEIT_HASH = HashingUtils::CompileTimeHashString("FAHRENHEIT");
+        static constexpr int CELSIUS_HASH = HashingUtils::CompileTimeHashString("CELSIUS");
 
 
         TemperatureUnit GetTemperatureUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAHRENHEIT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TemperatureUnit::FAHRENHEIT;
-          }
-          else if (hashCode == CELSIUS_HASH)
-          {
-            return TemperatureUnit::CELSIUS;
+          case FAHRENHEIT_HASH:
+            if (name == "FAHRENHEIT")
+            {
+              return TemperatureUnit::FAHRENHEIT;
+            }
+            break;
+          case CELSIUS_HASH:
+            if (name == "CELSIUS")
+            {
+              return TemperatureUnit::CELSIUS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TemperatureUnit::NOT_SET;
         }
 
-        Aws::String GetNameForTemperatureUnit(TemperatureUnit enumValue)
+        const char* GetNameForTemperatureUnit(TemperatureUnit enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
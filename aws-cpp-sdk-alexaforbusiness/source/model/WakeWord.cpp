@@ -30,30 +30,44 @@ namespace Aws
       namespace WakeWordMapper
       {
 
-        static const int ALEXA_HASH = HashingUtils::HashString("ALEXA");
-        static const int AMAZON_HASH = HashingUtils::HashString("AMAZON");
-        static const int ECHO_HASH = HashingUtils::HashString("ECHO");
-        static const int COMPUTER_HASH = HashingUtils::HashString("COMPUTER");
+        static constexpr int ALEXA_HASH = HashingUtils::CompileTimeHashString("ALEXA");
+        static constexpr int AMAZON_HASH = HashingUtils::CompileTimeHashString("AMAZON");
+        static constexpr int ECHO_HASH = HashingUtils::CompileTimeHashString("ECHO");
+        static constexpr int COMPUTER_HASH = HashingUtils::CompileTimeHashString("COMPUTER");
 
 
         WakeWord GetWakeWordForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALEXA_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WakeWord::ALEXA;
-          }
-          else if (hashCode == AMAZON_HASH)
-          {
-            return WakeWord::AMAZON;
-          }
-          else if (hashCode == ECHO_HASH)
-          {
-            return WakeWord::ECHO;
-          }
-          else if (hashCode == COMPUTER_HASH)
-          {
-            return WakeWord::COMPUTER;
+          case ALEXA_HASH:
+            if (name == "ALEXA")
+            {
+              return WakeWord::ALEXA;
+            }
+            break;
+          case AMAZON_HASH:
+            if (name == "AMAZON")
+            {
+              return WakeWord::AMAZON;
+            }
+            break;
+          case ECHO_HASH:
+            if (name == "ECHO")
+            {
+              return WakeWord::ECHO;
+            }
+            break;
+          case COMPUTER_HASH:
+            if (name == "COMPUTER")
+            {
+              return WakeWord::COMPUTER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return WakeWord::NOT_SET;
         }
 
-        Aws::String GetNameForWakeWord(WakeWord enumValue)
+        const char* GetNameForWakeWord(WakeWord enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
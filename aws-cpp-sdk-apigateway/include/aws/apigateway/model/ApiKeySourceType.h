@@ -34,7 +34,8 @@ namespace ApiKeySourceTypeMapper
 {
 AWS_APIGATEWAY_API ApiKeySourceType GetApiKeySourceTypeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForApiKeySourceType(ApiKeySourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForApiKeySourceType(ApiKeySourceType value);
 } // namespace ApiKeySourceTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -33,7 +33,8 @@ namespace ApiKeysFormatMapper
 {
 AWS_APIGATEWAY_API ApiKeysFormat GetApiKeysFormatForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForApiKeysFormat(ApiKeysFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForApiKeysFormat(ApiKeysFormat value);
 } // namespace ApiKeysFormatMapper
 } // namespace Model
 } // namespace APIGateway
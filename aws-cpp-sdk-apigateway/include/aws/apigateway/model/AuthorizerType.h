@@ -35,7 +35,8 @@ namespace AuthorizerTypeMapper
 {
 AWS_APIGATEWAY_API AuthorizerType GetAuthorizerTypeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForAuthorizerType(AuthorizerType value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForAuthorizerType(AuthorizerType value);
 } // namespace AuthorizerTypeMapper
 } // namespace Model
 } // namespace APIGateway
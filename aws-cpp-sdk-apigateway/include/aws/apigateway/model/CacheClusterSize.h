@@ -40,7 +40,8 @@ namespace CacheClusterSizeMapper
 {
 AWS_APIGATEWAY_API CacheClusterSize GetCacheClusterSizeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForCacheClusterSize(CacheClusterSize value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForCacheClusterSize(CacheClusterSize value);
 } // namespace CacheClusterSizeMapper
 } // namespace Model
 } // namespace APIGateway
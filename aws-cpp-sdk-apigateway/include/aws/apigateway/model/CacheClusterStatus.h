@@ -37,7 +37,8 @@ namespace CacheClusterStatusMapper
 {
 AWS_APIGATEWAY_API CacheClusterStatus GetCacheClusterStatusForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForCacheClusterStatus(CacheClusterStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForCacheClusterStatus(CacheClusterStatus value);
 } // namespace CacheClusterStatusMapper
 } // namespace Model
 } // namespace APIGateway
@@ -34,7 +34,8 @@ namespace ConnectionTypeMapper
 {
 AWS_APIGATEWAY_API ConnectionType GetConnectionTypeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForConnectionType(ConnectionType value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForConnectionType(ConnectionType value);
 } // namespace ConnectionTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -34,7 +34,8 @@ namespace ContentHandlingStrategyMapper
 {
 AWS_APIGATEWAY_API ContentHandlingStrategy GetContentHandlingStrategyForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForContentHandlingStrategy(ContentHandlingStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForContentHandlingStrategy(ContentHandlingStrategy value);
 } // namespace ContentHandlingStrategyMapper
 } // namespace Model
 } // namespace APIGateway
@@ -44,7 +44,8 @@ namespace DocumentationPartTypeMapper
 {
 AWS_APIGATEWAY_API DocumentationPartType GetDocumentationPartTypeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForDocumentationPartType(DocumentationPartType value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForDocumentationPartType(DocumentationPartType value);
 } // namespace DocumentationPartTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -35,7 +35,8 @@ namespace EndpointTypeMapper
 {
 AWS_APIGATEWAY_API EndpointType GetEndpointTypeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForEndpointType(EndpointType value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForEndpointType(EndpointType value);
 } // namespace EndpointTypeMapper
 } // namespace Model
 } // namespace APIGateway
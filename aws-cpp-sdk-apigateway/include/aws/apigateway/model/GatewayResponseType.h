@@ -52,7 +52,8 @@ namespace GatewayResponseTypeMapper
 {
 AWS_APIGATEWAY_API GatewayResponseType GetGatewayResponseTypeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForGatewayResponseType(GatewayResponseType value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForGatewayResponseType(GatewayResponseType value);
 } // namespace GatewayResponseTypeMapper
 } // namespace Model
 } // namespace APIGateway
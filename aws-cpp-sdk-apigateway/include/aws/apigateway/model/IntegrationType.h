@@ -37,7 +37,8 @@ namespace IntegrationTypeMapper
 {
 AWS_APIGATEWAY_API IntegrationType GetIntegrationTypeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForIntegrationType(IntegrationType value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForIntegrationType(IntegrationType value);
 } // namespace IntegrationTypeMapper
 } // namespace Model
 } // namespace APIGateway
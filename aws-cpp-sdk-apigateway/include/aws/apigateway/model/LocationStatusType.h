@@ -34,7 +34,8 @@ namespace LocationStatusTypeMapper
 {
 AWS_APIGATEWAY_API LocationStatusType GetLocationStatusTypeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForLocationStatusType(LocationStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForLocationStatusType(LocationStatusType value);
 } // namespace LocationStatusTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -38,7 +38,8 @@ namespace OpMapper
 {
 AWS_APIGATEWAY_API Op GetOpForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForOp(Op value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForOp(Op value);
 } // namespace OpMapper
 } // namespace Model
 } // namespace APIGateway
@@ -34,7 +34,8 @@ namespace PutModeMapper
 {
 AWS_APIGATEWAY_API PutMode GetPutModeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForPutMode(PutMode value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForPutMode(PutMode value);
 } // namespace PutModeMapper
 } // namespace Model
 } // namespace APIGateway
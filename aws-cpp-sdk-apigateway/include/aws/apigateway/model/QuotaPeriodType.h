@@ -35,7 +35,8 @@ namespace QuotaPeriodTypeMapper
 {
 AWS_APIGATEWAY_API QuotaPeriodType GetQuotaPeriodTypeForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForQuotaPeriodType(QuotaPeriodType value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForQuotaPeriodType(QuotaPeriodType value);
 } // namespace QuotaPeriodTypeMapper
 } // namespace Model
 } // namespace APIGateway
@@ -35,7 +35,8 @@ namespace UnauthorizedCacheControlHeaderStrategyMapper
 {
 AWS_APIGATEWAY_API UnauthorizedCacheControlHeaderStrategy GetUnauthorizedCacheControlHeaderStrategyForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForUnauthorizedCacheControlHeaderStrategy(UnauthorizedCacheControlHeaderStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForUnauthorizedCacheControlHeaderStrategy(UnauthorizedCacheControlHeaderStrategy value);
 } // namespace UnauthorizedCacheControlHeaderStrategyMapper
 } // namespace Model
 } // namespace APIGateway
@@ -36,7 +36,8 @@ namespace VpcLinkStatusMapper
 {
 AWS_APIGATEWAY_API VpcLinkStatus GetVpcLinkStatusForName(const Aws::String& name);
 
-AWS_APIGATEWAY_API Aws::String GetNameForVpcLinkStatus(VpcLinkStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_APIGATEWAY_API const char* GetNameForVpcLinkStatus(VpcLinkStatus value);
 } // namespace VpcLinkStatusMapper
 } // namespace Model
 } // namespace APIGateway
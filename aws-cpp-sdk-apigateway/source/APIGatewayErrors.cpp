@@ -28,12 +28,12 @@ namespace APIGateway
 namespace APIGatewayErrorMapper
 {
 
-static const int CONFLICT_HASH = HashingUtils::HashString("ConflictException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int BAD_REQUEST_HASH = HashingUtils::HashString("BadRequestException");
-static const int UNAUTHORIZED_HASH = HashingUtils::HashString("UnauthorizedException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
+static constexpr int CONFLICT_HASH = HashingUtils::CompileTimeHashString("ConflictException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int BAD_REQUEST_HASH = HashingUtils::CompileTimeHashString("BadRequestException");
+static constexpr int UNAUTHORIZED_HASH = HashingUtils::CompileTimeHashString("UnauthorizedException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace ApiKeySourceTypeMapper
       {
 
-        static const int HEADER_HASH = HashingUtils::HashString("HEADER");
-        static const int AUTHORIZER_HASH = HashingUtils::HashString("AUTHORIZER");
+        static constexpr int HEADER_HASH = HashingUtils::CompileTimeHashString("HEADER");
+        static constexpr int AUTHORIZER_HASH = HashingUtils::CompileTimeHashString("AUTHORIZER");
 
 
         ApiKeySourceType GetApiKeySourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEADER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ApiKeySourceType::HEADER;
-          }
-          else if (hashCode == AUTHORIZER_HASH)
-          {
-            return ApiKeySourceType::AUTHORIZER;
+          case HEADER_HASH:
+            if (name == "HEADER")
+            {
+              return ApiKeySourceType::HEADER;
+            }
+            break;
+          case AUTHORIZER_HASH:
+            if (name == "AUTHORIZER")
+            {
+              return ApiKeySourceType::AUTHORIZER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ApiKeySourceType::NOT_SET;
         }
 
-        Aws::String GetNameForApiKeySourceType(ApiKeySourceType enumValue)
+        const char* GetNameForApiKeySourceType(ApiKeySourceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
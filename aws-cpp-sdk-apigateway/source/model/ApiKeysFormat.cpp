@@ -30,15 +30,23 @@ namespace Aws
       namespace ApiKeysFormatMapper
       {
 
-        static const int csv_HASH = HashingUtils::HashString("csv");
+        static constexpr int csv_HASH = HashingUtils::CompileTimeHashString("csv");
 
 
         ApiKeysFormat GetApiKeysFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == csv_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ApiKeysFormat::csv;
+          case csv_HASH:
+            if (name == "csv")
+            {
+              return ApiKeysFormat::csv;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ApiKeysFormat::NOT_SET;
         }
 
-        Aws::String GetNameForApiKeysFormat(ApiKeysFormat enumValue)
+        const char* GetNameForApiKeysFormat(ApiKeysFormat enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AuthorizerTypeMapper
       {
 
-        static const int TOKEN_HASH = HashingUtils::HashString("TOKEN");
-        static const int REQUEST_HASH = HashingUtils::HashString("REQUEST");
-        static const int COGNITO_USER_POOLS_HASH = HashingUtils::HashString("COGNITO_USER_POOLS");
+        static constexpr int TOKEN_HASH = HashingUtils::CompileTimeHashString("TOKEN");
+        static constexpr int REQUEST_HASH = HashingUtils::CompileTimeHashString("REQUEST");
+        static constexpr int COGNITO_USER_POOLS_HASH = HashingUtils::CompileTimeHashString("COGNITO_USER_POOLS");
 
 
         AuthorizerType GetAuthorizerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TOKEN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthorizerType::TOKEN;
-          }
-          else if (hashCode == REQUEST_HASH)
-          {
-            return AuthorizerType::REQUEST;
-          }
-          else if (hashCode == COGNITO_USER_POOLS_HASH)
-          {
-            return AuthorizerType::COGNITO_USER_POOLS;
+          case TOKEN_HASH:
+            if (name == "TOKEN")
+            {
+              return AuthorizerType::TOKEN;
+            }
+            break;
+          case REQUEST_HASH:
+            if (name == "REQUEST")
+            {
+              return AuthorizerType::REQUEST;
+            }
+            break;
+          case COGNITO_USER_POOLS_HASH:
+            if (name == "COGNITO_USER_POOLS")
+            {
+              return AuthorizerType::COGNITO_USER_POOLS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AuthorizerType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthorizerType(AuthorizerType enumValue)
+        const char* GetNameForAuthorizerType(AuthorizerType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace CacheClusterSizeMapper
       {
 
-        static const int _0_5_HASH = HashingUtils::HashString("0.5");
-        static const int _1_6_HASH = HashingUtils::HashString("1.6");
-        static const int _6_1_HASH = HashingUtils::HashString("6.1");
-        static const int _13_5_HASH = HashingUtils::HashString("13.5");
-        static const int _28_4_HASH = HashingUtils::HashString("28.4");
-        static const int _58_2_HASH = HashingUtils::HashString("58.2");
-        static const int _118_HASH = HashingUtils::HashString("118");
-        static const int _237_HASH = HashingUtils::HashString("237");
+        static constexpr int _0_5_HASH = HashingUtils::CompileTimeHashString("0.5");
+        static constexpr int _1_6_HASH = HashingUtils::CompileTimeHashString("1.6");
+        static constexpr int _6_1_HASH = HashingUtils::CompileTimeHashString("6.1");
+        static constexpr int _13_5_HASH = HashingUtils::CompileTimeHashString("13.5");
+        static constexpr int _28_4_HASH = HashingUtils::CompileTimeHashString("28.4");
+        static constexpr int _58_2_HASH = HashingUtils::CompileTimeHashString("58.2");
+        static constexpr int _118_HASH = HashingUtils::CompileTimeHashString("118");
+        static constexpr int _237_HASH = HashingUtils::CompileTimeHashString("237");
 
 
         CacheClusterSize GetCacheClusterSizeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == _0_5_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CacheClusterSize::_0_5;
-          }
-          else if (hashCode == _1_6_HASH)
-          {
-            return CacheClusterSize::_1_6;
-          }
-          else if (hashCode == _6_1_HASH)
-          {
-            return CacheClusterSize::_6_1;
-          }
-          else if (hashCode == _13_5_HASH)
-          {
-            return CacheClusterSize::_13_5;
-          }
-          else if (hashCode == _28_4_HASH)
-          {
-            return CacheClusterSize::_28_4;
-          }
-          else if (hashCode == _58_2_HASH)
-          {
-            return CacheClusterSize::_58_2;
-          }
-          else if (hashCode == _118_HASH)
-          {
-            return CacheClusterSize::_118;
-          }
-          else if (hashCode == _237_HASH)
-          {
-            return CacheClusterSize::_237;
+          case _0_5_HASH:
+            if (name == "0.5")
+            {
+              return CacheClusterSize::_0_5;
+            }
+            break;
+          case _1_6_HASH:
+            if (name == "1.6")
+            {
+              return CacheClusterSize::_1_6;
+            }
+            break;
+          case _6_1_HASH:
+            if (name == "6.1")
+            {
+              return CacheClusterSize::_6_1;
+            }
+            break;
+          case _13_5_HASH:
+            if (name == "13.5")
+            {
+              return CacheClusterSize::_13_5;
+            }
+            break;
+          case _28_4_HASH:
+            if (name == "28.4")
+            {
+              return CacheClusterSize::_28_4;
+            }
+            break;
+          case _58_2_HASH:
+            if (name == "58.2")
+            {
+              return CacheClusterSize::_58_2;
+            }
+            break;
+          case _118_HASH:
+            if (name == "118")
+            {
+              return CacheClusterSize::_118;
+            }
+            break;
+          case _237_HASH:
+            if (name == "237")
+            {
+              return CacheClusterSize::_237;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return CacheClusterSize::NOT_SET;
         }
 
-        Aws::String GetNameForCacheClusterSize(CacheClusterSize enumValue)
+        const char* GetNameForCacheClusterSize(CacheClusterSize enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace CacheClusterStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int NOT_AVAILABLE_HASH = HashingUtils::HashString("NOT_AVAILABLE");
-        static const int FLUSH_IN_PROGRESS_HASH = HashingUtils::HashString("FLUSH_IN_PROGRESS");
+        static constexpr int CREATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATE_IN_PROGRESS");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int DELETE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("DELETE_IN_PROGRESS");
+        static constexpr int NOT_AVAILABLE_HASH = HashingUtils::CompileTimeHashString("NOT_AVAILABLE");
+        static constexpr int FLUSH_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("FLUSH_IN_PROGRESS");
 
 
         CacheClusterStatus GetCacheClusterStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CacheClusterStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return CacheClusterStatus::AVAILABLE;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return CacheClusterStatus::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == NOT_AVAILABLE_HASH)
-          {
-            return CacheClusterStatus::NOT_AVAILABLE;
-          }
-          else if (hashCode == FLUSH_IN_PROGRESS_HASH)
-          {
-            return CacheClusterStatus::FLUSH_IN_PROGRESS;
+          case CREATE_IN_PROGRESS_HASH:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return CacheClusterStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return CacheClusterStatus::AVAILABLE;
+            }
+            break;
+          case DELETE_IN_PROGRESS_HASH:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return CacheClusterStatus::DELETE_IN_PROGRESS;
+            }
+            break;
+          case NOT_AVAILABLE_HASH:
+            if (name == "NOT_AVAILABLE")
+            {
+              return CacheClusterStatus::NOT_AVAILABLE;
+            }
+            break;
+          case FLUSH_IN_PROGRESS_HASH:
+            if (name == "FLUSH_IN_PROGRESS")
+            {
+              return CacheClusterStatus::FLUSH_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return CacheClusterStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCacheClusterStatus(CacheClusterStatus enumValue)
+        const char* GetNameForCacheClusterStatus(CacheClusterStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
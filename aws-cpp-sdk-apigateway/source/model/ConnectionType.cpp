@@ -30,20 +30,30 @@ namespace Aws
       namespace ConnectionTypeMapper
       {
 
-        static const int INTERNET_HASH = HashingUtils::HashString("INTERNET");
-        static const int VPC_LINK_HASH = HashingUtils::HashString("VPC_LINK");
+        static constexpr int INTERNET_HASH = HashingUtils::CompileTimeHashString("INTERNET");
+        static constexpr int VPC_LINK_HASH = HashingUtils::CompileTimeHashString("VPC_LINK");
 
 
         ConnectionType GetConnectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNET_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConnectionType::INTERNET;
-          }
-          else if (hashCode == VPC_LINK_HASH)
-          {
-            return ConnectionType::VPC_LINK;
+          case INTERNET_HASH:
+            if (name == "INTERNET")
+            {
+              return ConnectionType::INTERNET;
+            }
+            break;
+          case VPC_LINK_HASH:
+            if (name == "VPC_LINK")
+            {
+              return ConnectionType::VPC_LINK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ConnectionType::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionType(ConnectionType enumValue)
+        const char* GetNameForConnectionType(ConnectionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
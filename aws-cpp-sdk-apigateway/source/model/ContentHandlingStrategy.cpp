@@ -30,20 +30,30 @@ namespace Aws
       namespace ContentHandlingStrategyMapper
       {
 
-        static const int CONVERT_TO_BINARY_HASH = HashingUtils::HashString("CONVERT_TO_BINARY");
-        static const int CONVERT_TO_TEXT_HASH = HashingUtils::HashString("CONVERT_TO_TEXT");
+        static constexpr int CONVERT_TO_BINARY_HASH = HashingUtils::CompileTimeHashString("CONVERT_TO_BINARY");
+        static constexpr int CONVERT_TO_TEXT_HASH = HashingUtils::CompileTimeHashString("CONVERT_TO_TEXT");
 
 
         ContentHandlingStrategy GetContentHandlingStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONVERT_TO_BINARY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContentHandlingStrategy::CONVERT_TO_BINARY;
-          }
-          else if (hashCode == CONVERT_TO_TEXT_HASH)
-          {
-            return ContentHandlingStrategy::CONVERT_TO_TEXT;
+          case CONVERT_TO_BINARY_HASH:
+            if (name == "CONVERT_TO_BINARY")
+            {
+              return ContentHandlingStrategy::CONVERT_TO_BINARY;
+            }
+            break;
+          case CONVERT_TO_TEXT_HASH:
+            if (name == "CONVERT_TO_TEXT")
+            {
+              return ContentHandlingStrategy::CONVERT_TO_TEXT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ContentHandlingStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForContentHandlingStrategy(ContentHandlingStrategy enumValue)
+        const char* GetNameForContentHandlingStrategy(ContentHandlingStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,70 +30,100 @@ namespace Aws
       namespace DocumentationPartTypeMapper
       {
 
-        static const int API_HASH = HashingUtils::HashString("API");
-        static const int AUTHORIZER_HASH = HashingUtils::HashString("AUTHORIZER");
-        static const int MODEL_HASH = HashingUtils::HashString("MODEL");
-        static const int RESOURCE_HASH = HashingUtils::HashString("RESOURCE");
-        static const int METHOD_HASH = HashingUtils::HashString("METHOD");
-        static const int PATH_PARAMETER_HASH = HashingUtils::HashString("PATH_PARAMETER");
-        static const int QUERY_PARAMETER_HASH = HashingUtils::HashString("QUERY_PARAMETER");
-        static const int REQUEST_HEADER_HASH = HashingUtils::HashString("REQUEST_HEADER");
-        static const int REQUEST_BODY_HASH = HashingUtils::HashString("REQUEST_BODY");
-        static const int RESPONSE_HASH = HashingUtils::HashString("RESPONSE");
-        static const int RESPONSE_HEADER_HASH = HashingUtils::HashString("RESPONSE_HEADER");
-        static const int RESPONSE_BODY_HASH = HashingUtils::HashString("RESPONSE_BODY");
+        static constexpr int API_HASH = HashingUtils::CompileTimeHashString("API");
+        static constexpr int AUTHORIZER_HASH = HashingUtils::CompileTimeHashString("AUTHORIZER");
+        static constexpr int MODEL_HASH = HashingUtils::CompileTimeHashString("MODEL");
+        static constexpr int RESOURCE_HASH = HashingUtils::CompileTimeHashString("RESOURCE");
+        static constexpr int METHOD_HASH = HashingUtils::CompileTimeHashString("METHOD");
+        static constexpr int PATH_PARAMETER_HASH = HashingUtils::CompileTimeHashString("PATH_PARAMETER");
+        static constexpr int QUERY_PARAMETER_HASH = HashingUtils::CompileTimeHashString("QUERY_PARAMETER");
+        static constexpr int REQUEST_HEADER_HASH = HashingUtils::CompileTimeHashString("REQUEST_HEADER");
+        static constexpr int REQUEST_BODY_HASH = HashingUtils::CompileTimeHashString("REQUEST_BODY");
+        static constexpr int RESPONSE_HASH = HashingUtils::CompileTimeHashString("RESPONSE");
+        static constexpr int RESPONSE_HEADER_HASH = HashingUtils::CompileTimeHashString("RESPONSE_HEADER");
+        static constexpr int RESPONSE_BODY_HASH = HashingUtils::CompileTimeHashString("RESPONSE_BODY");
 
 
         DocumentationPartType GetDocumentationPartTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == API_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentationPartType::API;
-          }
-          else if (hashCode == AUTHORIZER_HASH)
-          {
-            return DocumentationPartType::AUTHORIZER;
-          }
-          else if (hashCode == MODEL_HASH)
-          {
-            return DocumentationPartType::MODEL;
-          }
-          else if (hashCode == RESOURCE_HASH)
-          {
-            return DocumentationPartType::RESOURCE;
-          }
-          else if (hashCode == METHOD_HASH)
-          {
-            return DocumentationPartType::METHOD;
-          }
-          else if (hashCode == PATH_PARAMETER_HASH)
-          {
-            return DocumentationPartType::PATH_PARAMETER;
-          }
-          else if (hashCode == QUERY_PARAMETER_HASH)
-          {
-            return DocumentationPartType::QUERY_PARAMETER;
-          }
-          else if (hashCode == REQUEST_HEADER_HASH)
-          {
-            return DocumentationPartType::REQUEST_HEADER;
-          }
-          else if (hashCode == REQUEST_BODY_HASH)
-          {
-            return DocumentationPartType::REQUEST_BODY;
-          }
-          else if (hashCode == RESPONSE_HASH)
-          {
-            return DocumentationPartType::RESPONSE;
-          }
-          else if (hashCode == RESPONSE_HEADER_HASH)
-          {
-            return DocumentationPartType::RESPONSE_HEADER;
-          }
-          else if (hashCode == RESPONSE_BODY_HASH)
-          {
-            return DocumentationPartType::RESPONSE_BODY;
+          case API_HASH:
+            if (name == "API")
+            {
+              return DocumentationPartType::API;
+            }
+            break;
+          case AUTHORIZER_HASH:
+            if (name == "AUTHORIZER")
+            {
+              return DocumentationPartType::AUTHORIZER;
+            }
+            break;
+          case MODEL_HASH:
+            if (name == "MODEL")
+            {
+              return DocumentationPartType::MODEL;
+            }
+            break;
+          case RESOURCE_HASH:
+            if (name == "RESOURCE")
+            {
+              return DocumentationPartType::RESOURCE;
+            }
+            break;
+          case METHOD_HASH:
+            if (name == "METHOD")
+            {
+              return DocumentationPartType::METHOD;
+            }
+            break;
+          case PATH_PARAMETER_HASH:
+            if (name == "PATH_PARAMETER")
+            {
+              return DocumentationPartType::PATH_PARAMETER;
+            }
+            break;
+          case QUERY_PARAMETER_HASH:
+            if (name == "QUERY_PARAMETER")
+            {
+              return DocumentationPartType::QUERY_PARAMETER;
+            }
+            break;
+          case REQUEST_HEADER_HASH:
+            if (name == "REQUEST_HEADER")
+            {
+              return DocumentationPartType::REQUEST_HEADER;
+            }
+            break;
+          case REQUEST_BODY_HASH:
+            if (name == "REQUEST_BODY")
+            {
+              return DocumentationPartType::REQUEST_BODY;
+            }
+            break;
+          case RESPONSE_HASH:
+            if (name == "RESPONSE")
+            {
+              return DocumentationPartType::RESPONSE;
+            }
+            break;
+          case RESPONSE_HEADER_HASH:
+            if (name == "RESPONSE_HEADER")
+            {
+              return DocumentationPartType::RESPONSE_HEADER;
+            }
+            break;
+          case RESPONSE_BODY_HASH:
+            if (name == "RESPONSE_BODY")
+            {
+              return DocumentationPartType::RESPONSE_BODY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return DocumentationPartType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentationPartType(DocumentationPartType enumValue)
+        const char* GetNameForDocumentationPartType(DocumentationPartType enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace EndpointTypeMapper
       {
 
-        static const int REGIONAL_HASH = HashingUtils::HashString("REGIONAL");
-        static const int EDGE_HASH = HashingUtils::HashString("EDGE");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
+        static constexpr int REGIONAL_HASH = HashingUtils::CompileTimeHashString("REGIONAL");
+        static constexpr int EDGE_HASH = HashingUtils::CompileTimeHashString("EDGE");
+        static constexpr int PRIVATE__HASH = HashingUtils::CompileTimeHashString("PRIVATE");
 
 
         EndpointType GetEndpointTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGIONAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EndpointType::REGIONAL;
-          }
-          else if (hashCode == EDGE_HASH)
-          {
-            return EndpointType::EDGE;
-          }
-          else if (hashCode == PRIVATE__HASH)
-          {
-            return EndpointType::PRIVATE_;
+          case REGIONAL_HASH:
+            if (name == "REGIONAL")
+            {
+              return EndpointType::REGIONAL;
+            }
+            break;
+          case EDGE_HASH:
+            if (name == "EDGE")
+            {
+              return EndpointType::EDGE;
+            }
+            break;
+          case PRIVATE__HASH:
+            if (name == "PRIVATE")
+            {
+              return EndpointType::PRIVATE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return EndpointType::NOT_SET;
         }
 
-        Aws::String GetNameForEndpointType(EndpointType enumValue)
+        const char* GetNameForEndpointType(EndpointType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
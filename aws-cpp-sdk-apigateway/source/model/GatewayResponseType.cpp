@@ -30,110 +30,156 @@ namespace Aws
       namespace GatewayResponseTypeMapper
       {
 
-        static const int DEFAULT_4XX_HASH = HashingUtils::HashString("DEFAULT_4XX");
-        static const int DEFAULT_5XX_HASH = HashingUtils::HashString("DEFAULT_5XX");
-        static const int RESOURCE_NOT_FOUND_HASH = HashingUtils::HashString("RESOURCE_NOT_FOUND");
-        static const int UNAUTHORIZED_HASH = HashingUtils::HashString("UNAUTHORIZED");
-        static const int INVALID_API_KEY_HASH = HashingUtils::HashString("INVALID_API_KEY");
-        static const int ACCESS_DENIED_HASH = HashingUtils::HashString("ACCESS_DENIED");
-        static const int AUTHORIZER_FAILURE_HASH = HashingUtils::HashString("AUTHORIZER_FAILURE");
-        static const int AUTHORIZER_CONFIGURATION_ERROR_HASH = HashingUtils::HashString("AUTHORIZER_CONFIGURATION_ERROR");
-        static const int INVALID_SIGNATURE_HASH = HashingUtils::HashString("INVALID_SIGNATURE");
-        static const int EXPIRED_TOKEN_HASH = HashingUtils::HashString("EXPIRED_TOKEN");
-        static const int MISSING_AUTHENTICATION_TOKEN_HASH = HashingUtils::HashString("MISSING_AUTHENTICATION_TOKEN");
-        static const int INTEGRATION_FAILURE_HASH = HashingUtils::HashString("INTEGRATION_FAILURE");
-        static const int INTEGRATION_TIMEOUT_HASH = HashingUtils::HashString("INTEGRATION_TIMEOUT");
-        static const int API_CONFIGURATION_ERROR_HASH = HashingUtils::HashString("API_CONFIGURATION_ERROR");
-        static const int UNSUPPORTED_MEDIA_TYPE_HASH = HashingUtils::HashString("UNSUPPORTED_MEDIA_TYPE");
-        static const int BAD_REQUEST_PARAMETERS_HASH = HashingUtils::HashString("BAD_REQUEST_PARAMETERS");
-        static const int BAD_REQUEST_BODY_HASH = HashingUtils::HashString("BAD_REQUEST_BODY");
-        static const int REQUEST_TOO_LARGE_HASH = HashingUtils::HashString("REQUEST_TOO_LARGE");
-        static const int THROTTLED_HASH = HashingUtils::HashString("THROTTLED");
-        static const int QUOTA_EXCEEDED_HASH = HashingUtils::HashString("QUOTA_EXCEEDED");
+        static constexpr int DEFAULT_4XX_HASH = HashingUtils::CompileTimeHashString("DEFAULT_4XX");
+        static constexpr int DEFAULT_5XX_HASH = HashingUtils::CompileTimeHashString("DEFAULT_5XX");
+        static constexpr int RESOURCE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("RESOURCE_NOT_FOUND");
+        static constexpr int UNAUTHORIZED_HASH = HashingUtils::CompileTimeHashString("UNAUTHORIZED");
+        static constexpr int INVALID_API_KEY_HASH = HashingUtils::CompileTimeHashString("INVALID_API_KEY");
+        static constexpr int ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED");
+        static constexpr int AUTHORIZER_FAILURE_HASH = HashingUtils::CompileTimeHashString("AUTHORIZER_FAILURE");
+        static constexpr int AUTHORIZER_CONFIGURATION_ERROR_HASH = HashingUtils::CompileTimeHashString("AUTHORIZER_CONFIGURATION_ERROR");
+        static constexpr int INVALID_SIGNATURE_HASH = HashingUtils::CompileTimeHashString("INVALID_SIGNATURE");
+        static constexpr int EXPIRED_TOKEN_HASH = HashingUtils::CompileTimeHashString("EXPIRED_TOKEN");
+        static constexpr int MISSING_AUTHENTICATION_TOKEN_HASH = HashingUtils::CompileTimeHashString("MISSING_AUTHENTICATION_TOKEN");
+        static constexpr int INTEGRATION_FAILURE_HASH = HashingUtils::CompileTimeHashString("INTEGRATION_FAILURE");
+        static constexpr int INTEGRATION_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("INTEGRATION_TIMEOUT");
+        static constexpr int API_CONFIGURATION_ERROR_HASH = HashingUtils::CompileTimeHashString("API_CONFIGURATION_ERROR");
+        static constexpr int UNSUPPORTED_MEDIA_TYPE_HASH = HashingUtils::CompileTimeHashString("UNSUPPORTED_MEDIA_TYPE");
+        static constexpr int BAD_REQUEST_PARAMETERS_HASH = HashingUtils::CompileTimeHashString("BAD_REQUEST_PARAMETERS");
+        static constexpr int BAD_REQUEST_BODY_HASH = HashingUtils::CompileTimeHashString("BAD_REQUEST_BODY");
+        static constexpr int REQUEST_TOO_LARGE_HASH = HashingUtils::CompileTimeHashString("REQUEST_TOO_LARGE");
+        static constexpr int THROTTLED_HASH = HashingUtils::CompileTimeHashString("THROTTLED");
+        static constexpr int QUOTA_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("QUOTA_EXCEEDED");
 
 
         GatewayResponseType GetGatewayResponseTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_4XX_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GatewayResponseType::DEFAULT_4XX;
-          }
-          else if (hashCode == DEFAULT_5XX_HASH)
-          {
-            return GatewayResponseType::DEFAULT_5XX;
-          }
-          else if (hashCode == RESOURCE_NOT_FOUND_HASH)
-          {
-            return GatewayResponseType::RESOURCE_NOT_FOUND;
-          }
-          else if (hashCode == UNAUTHORIZED_HASH)
-          {
-            return GatewayResponseType::UNAUTHORIZED;
-          }
-          else if (hashCode == INVALID_API_KEY_HASH)
-          {
-            return GatewayResponseType::INVALID_API_KEY;
-          }
-          else if (hashCode == ACCESS_DENIED_HASH)
-          {
-            return GatewayResponseType::ACCESS_DENIED;
-          }
-          else if (hashCode == AUTHORIZER_FAILURE_HASH)
-          {
-            return GatewayResponseType::AUTHORIZER_FAILURE;
-          }
-          else if (hashCode == AUTHORIZER_CONFIGURATION_ERROR_HASH)
-          {
-            return GatewayResponseType::AUTHORIZER_CONFIGURATION_ERROR;
-          }
-          else if (hashCode == INVALID_SIGNATURE_HASH)
-          {
-            return GatewayResponseType::INVALID_SIGNATURE;
-          }
-          else if (hashCode == EXPIRED_TOKEN_HASH)
-          {
-            return GatewayResponseType::EXPIRED_TOKEN;
-          }
-          else if (hashCode == MISSING_AUTHENTICATION_TOKEN_HASH)
-          {
-            return GatewayResponseType::MISSING_AUTHENTICATION_TOKEN;
-          }
-          else if (hashCode == INTEGRATION_FAILURE_HASH)
-          {
-            return GatewayResponseType::INTEGRATION_FAILURE;
-          }
-          else if (hashCode == INTEGRATION_TIMEOUT_HASH)
-          {
-            return GatewayResponseType::INTEGRATION_TIMEOUT;
-          }
-          else if (hashCode == API_CONFIGURATION_ERROR_HASH)
-          {
-            return GatewayResponseType::API_CONFIGURATION_ERROR;
-          }
-          else if (hashCode == UNSUPPORTED_MEDIA_TYPE_HASH)
-          {
-            return GatewayResponseType::UNSUPPORTED_MEDIA_TYPE;
-          }
-          else if (hashCode == BAD_REQUEST_PARAMETERS_HASH)
-          {
-            return GatewayResponseType::BAD_REQUEST_PARAMETERS;
-          }
-          else if (hashCode == BAD_REQUEST_BODY_HASH)
-          {
-            return GatewayResponseType::BAD_REQUEST_BODY;
-          }
-          else if (hashCode == REQUEST_TOO_LARGE_HASH)
-          {
-            return GatewayResponseType::REQUEST_TOO_LARGE;
-          }
-          else if (hashCode == THROTTLED_HASH)
-          {
-            return GatewayResponseType::THROTTLED;
-          }
-          else if (hashCode == QUOTA_EXCEEDED_HASH)
-          {
-            return GatewayResponseType::QUOTA_EXCEEDED;
+          case DEFAULT_4XX_HASH:
+            if (name == "DEFAULT_4XX")
+            {
+              return GatewayResponseType::DEFAULT_4XX;
+            }
+            break;
+          case DEFAULT_5XX_HASH:
+            if (name == "DEFAULT_5XX")
+            {
+              return GatewayResponseType::DEFAULT_5XX;
+            }
+            break;
+          case RESOURCE_NOT_FOUND_HASH:
+            if (name == "RESOURCE_NOT_FOUND")
+            {
+              return GatewayResponseType::RESOURCE_NOT_FOUND;
+            }
+            break;
+          case UNAUTHORIZED_HASH:
+            if (name == "UNAUTHORIZED")
+            {
+              return GatewayResponseType::UNAUTHORIZED;
+            }
+            break;
+          case INVALID_API_KEY_HASH:
+            if (name == "INVALID_API_KEY")
+            {
+              return GatewayResponseType::INVALID_API_KEY;
+            }
+            break;
+          case ACCESS_DENIED_HASH:
+            if (name == "ACCESS_DENIED")
+            {
+              return GatewayResponseType::ACCESS_DENIED;
+            }
+            break;
+          case AUTHORIZER_FAILURE_HASH:
+            if (name == "AUTHORIZER_FAILURE")
+            {
+              return GatewayResponseType::AUTHORIZER_FAILURE;
+            }
+            break;
+          case AUTHORIZER_CONFIGURATION_ERROR_HASH:
+            if (name == "AUTHORIZER_CONFIGURATION_ERROR")
+            {
+              return GatewayResponseType::AUTHORIZER_CONFIGURATION_ERROR;
+            }
+            break;
+          case INVALID_SIGNATURE_HASH:
+            if (name == "INVALID_SIGNATURE")
+            {
+              return GatewayResponseType::INVALID_SIGNATURE;
+            }
+            break;
+          case EXPIRED_TOKEN_HASH:
+            if (name == "EXPIRED_TOKEN")
+            {
+              return GatewayResponseType::EXPIRED_TOKEN;
+            }
+            break;
+          case MISSING_AUTHENTICATION_TOKEN_HASH:
+            if (name == "MISSING_AUTHENTICATION_TOKEN")
+            {
+              return GatewayResponseType::MISSING_AUTHENTICATION_TOKEN;
+            }
+            break;
+          case INTEGRATION_FAILURE_HASH:
+            if (name == "INTEGRATION_FAILURE")
+            {
+              return GatewayResponseType::INTEGRATION_FAILURE;
+            }
+            break;
+          case INTEGRATION_TIMEOUT_HASH:
+            if (name == "INTEGRATION_TIMEOUT")
+            {
+              return GatewayResponseType::INTEGRATION_TIMEOUT;
+            }
+            break;
+          case API_CONFIGURATION_ERROR_HASH:
+            if (name == "API_CONFIGURATION_ERROR")
+            {
+              return GatewayResponseType::API_CONFIGURATION_ERROR;
+            }
+            break;
+          case UNSUPPORTED_MEDIA_TYPE_HASH:
+            if (name == "UNSUPPORTED_MEDIA_TYPE")
+            {
+              return GatewayResponseType::UNSUPPORTED_MEDIA_TYPE;
+            }
+            break;
+          case BAD_REQUEST_PARAMETERS_HASH:
+            if (name == "BAD_REQUEST_PARAMETERS")
+            {
+              return GatewayResponseType::BAD_REQUEST_PARAMETERS;
+            }
+            break;
+          case BAD_REQUEST_BODY_HASH:
+            if (name == "BAD_REQUEST_BODY")
+            {
+              return GatewayResponseType::BAD_REQUEST_BODY;
+            }
+            break;
+          case REQUEST_TOO_LARGE_HASH:
+            if (name == "REQUEST_TOO_LARGE")
+            {
+              return GatewayResponseType::REQUEST_TOO_LARGE;
+            }
+            break;
+          case THROTTLED_HASH:
+            if (name == "THROTTLED")
+            {
+              return GatewayResponseType::THROTTLED;
+            }
+            break;
+          case QUOTA_EXCEEDED_HASH:
+            if (name == "QUOTA_EXCEEDED")
+            {
+              return GatewayResponseType::QUOTA_EXCEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -145,7 +191,7 @@ namespace Aws
           return GatewayResponseType::NOT_SET;
         }
 
-        Aws::String GetNameForGatewayResponseType(GatewayResponseType enumValue)
+        const char* GetNameForGatewayResponseType(GatewayResponseType enumValue)
         {
           switch(enumValue)
           {
@@ -193,7 +239,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace IntegrationTypeMapper
       {
 
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int MOCK_HASH = HashingUtils::HashString("MOCK");
-        static const int HTTP_PROXY_HASH = HashingUtils::HashString("HTTP_PROXY");
-        static const int AWS_PROXY_HASH = HashingUtils::HashString("AWS_PROXY");
+        static constexpr int HTTP_HASH = HashingUtils::CompileTimeHashString("HTTP");
+        static constexpr int AWS_HASH = HashingUtils::CompileTimeHashString("AWS");
+        static constexpr int MOCK_HASH = HashingUtils::CompileTimeHashString("MOCK");
+        static constexpr int HTTP_PROXY_HASH = HashingUtils::CompileTimeHashString("HTTP_PROXY");
+        static constexpr int AWS_PROXY_HASH = HashingUtils::CompileTimeHashString("AWS_PROXY");
 
 
         IntegrationType GetIntegrationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IntegrationType::HTTP;
-          }
-          else if (hashCode == AWS_HASH)
-          {
-            return IntegrationType::AWS;
-          }
-          else if (hashCode == MOCK_HASH)
-          {
-            return IntegrationType::MOCK;
-          }
-          else if (hashCode == HTTP_PROXY_HASH)
-          {
-            return IntegrationType::HTTP_PROXY;
-          }
-          else if (hashCode == AWS_PROXY_HASH)
-          {
-            return IntegrationType::AWS_PROXY;
+          case HTTP_HASH:
+            if (name == "HTTP")
+            {
+              return IntegrationType::HTTP;
+            }
+            break;
+          case AWS_HASH:
+            if (name == "AWS")
+            {
+              return IntegrationType::AWS;
+            }
+            break;
+          case MOCK_HASH:
+            if (name == "MOCK")
+            {
+              return IntegrationType::MOCK;
+            }
+            break;
+          case HTTP_PROXY_HASH:
+            if (name == "HTTP_PROXY")
+            {
+              return IntegrationType::HTTP_PROXY;
+            }
+            break;
+          case AWS_PROXY_HASH:
+            if (name == "AWS_PROXY")
+            {
+              return IntegrationType::AWS_PROXY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return IntegrationType::NOT_SET;
         }
 
-        Aws::String GetNameForIntegrationType(IntegrationType enumValue)
+        const char* GetNameForIntegrationType(IntegrationType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace LocationStatusTypeMapper
       {
 
-        static const int DOCUMENTED_HASH = HashingUtils::HashString("DOCUMENTED");
-        static const int UNDOCUMENTED_HASH = HashingUtils::HashString("UNDOCUMENTED");
+        static constexpr int DOCUMENTED_HASH = HashingUtils::CompileTimeHashString("DOCUMENTED");
+        static constexpr int UNDOCUMENTED_HASH = HashingUtils::CompileTimeHashString("UNDOCUMENTED");
 
 
         LocationStatusType GetLocationStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DOCUMENTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LocationStatusType::DOCUMENTED;
-          }
-          else if (hashCode == UNDOCUMENTED_HASH)
-          {
-            return LocationStatusType::UNDOCUMENTED;
+          case DOCUMENTED_HASH:
+            if (name == "DOCUMENTED")
+            {
+              return LocationStatusType::DOCUMENTED;
+            }
+            break;
+          case UNDOCUMENTED_HASH:
+            if (name == "UNDOCUMENTED")
+            {
+              return LocationStatusType::UNDOCUMENTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LocationStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForLocationStatusType(LocationStatusType enumValue)
+        const char* GetNameForLocationStatusType(LocationStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
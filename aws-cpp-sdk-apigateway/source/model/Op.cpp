@@ -30,40 +30,58 @@ namespace Aws
       namespace OpMapper
       {
 
-        static const int add_HASH = HashingUtils::HashString("add");
-        static const int remove_HASH = HashingUtils::HashString("remove");
-        static const int replace_HASH = HashingUtils::HashString("replace");
-        static const int move_HASH = HashingUtils::HashString("move");
-        static const int copy_HASH = HashingUtils::HashString("copy");
-        static const int test_HASH = HashingUtils::HashString("test");
+        static constexpr int add_HASH = HashingUtils::CompileTimeHashString("add");
+        static constexpr int remove_HASH = HashingUtils::CompileTimeHashString("remove");
+        static constexpr int replace_HASH = HashingUtils::CompileTimeHashString("replace");
+        static constexpr int move_HASH = HashingUtils::CompileTimeHashString("move");
+        static constexpr int copy_HASH = HashingUtils::CompileTimeHashString("copy");
+        static constexpr int test_HASH = HashingUtils::CompileTimeHashString("test");
 
 
         Op GetOpForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == add_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Op::add;
-          }
-          else if (hashCode == remove_HASH)
-          {
-            return Op::remove;
-          }
-          else if (hashCode == replace_HASH)
-          {
-            return Op::replace;
-          }
-          else if (hashCode == move_HASH)
-          {
-            return Op::move;
-          }
-          else if (hashCode == copy_HASH)
-          {
-            return Op::copy;
-          }
-          else if (hashCode == test_HASH)
-          {
-            return Op::test;
+          case add_HASH:
+            if (name == "add")
+            {
+              return Op::add;
+            }
+            break;
+          case remove_HASH:
+            if (name == "remove")
+            {
+              return Op::remove;
+            }
+            break;
+          case replace_HASH:
+            if (name == "replace")
+            {
+              return Op::replace;
+            }
+            break;
+          case move_HASH:
+            if (name == "move")
+            {
+              return Op::move;
+            }
+            break;
+          case copy_HASH:
+            if (name == "copy")
+            {
+              return Op::copy;
+            }
+            break;
+          case test_HASH:
+            if (name == "test")
+            {
+              return Op::test;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return Op::NOT_SET;
         }
 
-        Aws::String GetNameForOp(Op enumValue)
+        const char* GetNameForOp(Op enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PutModeMapper
       {
 
-        static const int merge_HASH = HashingUtils::HashString("merge");
-        static const int overwrite_HASH = HashingUtils::HashString("overwrite");
+        static constexpr int merge_HASH = HashingUtils::CompileTimeHashString("merge");
+        static constexpr int overwrite_HASH = HashingUtils::CompileTimeHashString("overwrite");
 
 
         PutMode GetPutModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == merge_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PutMode::merge;
-          }
-          else if (hashCode == overwrite_HASH)
-          {
-            return PutMode::overwrite;
+          case merge_HASH:
+            if (name == "merge")
+            {
+              return PutMode::merge;
+            }
+            break;
+          case overwrite_HASH:
+            if (name == "overwrite")
+            {
+              return PutMode::overwrite;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PutMode::NOT_SET;
         }
 
-        Aws::String GetNameForPutMode(PutMode enumValue)
+        const char* GetNameForPutMode(PutMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
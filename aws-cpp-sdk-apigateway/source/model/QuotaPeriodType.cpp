@@ -30,25 +30,37 @@ namespace Aws
       namespace QuotaPeriodTypeMapper
       {
 
-        static const int DAY_HASH = HashingUtils::HashString("DAY");
-        static const int WEEK_HASH = HashingUtils::HashString("WEEK");
-        static const int MONTH_HASH = HashingUtils::HashString("MONTH");
+        static constexpr int DAY_HASH = HashingUtils::CompileTimeHashString("DAY");
+        static constexpr int WEEK_HASH = HashingUtils::CompileTimeHashString("WEEK");
+        static constexpr int MONTH_HASH = HashingUtils::CompileTimeHashString("MONTH");
 
 
         QuotaPeriodType GetQuotaPeriodTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QuotaPeriodType::DAY;
-          }
-          else if (hashCode == WEEK_HASH)
-          {
-            return QuotaPeriodType::WEEK;
-          }
-          else if (hashCode == MONTH_HASH)
-          {
-            return QuotaPeriodType::MONTH;
+          case DAY_HASH:
+            if (name == "DAY")
+            {
+              return QuotaPeriodType::DAY;
+            }
+            break;
+          case WEEK_HASH:
+            if (name == "WEEK")
+            {
+              return QuotaPeriodType::WEEK;
+            }
+            break;
+          case MONTH_HASH:
+            if (name == "MONTH")
+            {
+              return QuotaPeriodType::MONTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return QuotaPeriodType::NOT_SET;
         }
 
-        Aws::String GetNameForQuotaPeriodType(QuotaPeriodType enumValue)
+        const char* GetNameForQuotaPeriodType(QuotaPeriodType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace UnauthorizedCacheControlHeaderStrategyMapper
       {
 
-        static const int FAIL_WITH_403_HASH = HashingUtils::HashString("FAIL_WITH_403");
-        static const int SUCCEED_WITH_RESPONSE_HEADER_HASH = HashingUtils::HashString("SUCCEED_WITH_RESPONSE_HEADER");
-        static const int SUCCEED_WITHOUT_RESPONSE_HEADER_HASH = HashingUtils::HashString("SUCCEED_WITHOUT_RESPONSE_HEADER");
+        static constexpr int FAIL_WITH_403_HASH = HashingUtils::CompileTimeHashString("FAIL_WITH_403");
+        static constexpr int SUCCEED_WITH_RESPONSE_HEADER_HASH = HashingUtils::CompileTimeHashString("SUCCEED_WITH_RESPONSE_HEADER");
+        static constexpr int SUCCEED_WITHOUT_RESPONSE_HEADER_HASH = HashingUtils::CompileTimeHashString("SUCCEED_WITHOUT_RESPONSE_HEADER");
 
 
         UnauthorizedCacheControlHeaderStrategy GetUnauthorizedCacheControlHeaderStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAIL_WITH_403_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UnauthorizedCacheControlHeaderStrategy::FAIL_WITH_403;
-          }
-          else if (hashCode == SUCCEED_WITH_RESPONSE_HEADER_HASH)
-          {
-            return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITH_RESPONSE_HEADER;
-          }
-          else if (hashCode == SUCCEED_WITHOUT_RESPONSE_HEADER_HASH)
-          {
-            return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITHOUT_RESPONSE_HEADER;
+          case FAIL_WITH_403_HASH:
+            if (name == "FAIL_WITH_403")
+            {
+              return UnauthorizedCacheControlHeaderStrategy::FAIL_WITH_403;
+            }
+            break;
+          case SUCCEED_WITH_RESPONSE_HEADER_HASH:
+            if (name == "SUCCEED_WITH_RESPONSE_HEADER")
+            {
+              return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITH_RESPONSE_HEADER;
+            }
+            break;
+          case SUCCEED_WITHOUT_RESPONSE_HEADER_HASH:
+            if (name == "SUCCEED_WITHOUT_RESPONSE_HEADER")
+            {
+              return UnauthorizedCacheControlHeaderStrategy::SUCCEED_WITHOUT_RESPONSE_HEADER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return UnauthorizedCacheControlHeaderStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForUnauthorizedCacheControlHeaderStrategy(UnauthorizedCacheControlHeaderStrategy enumValue)
+        const char* GetNameForUnauthorizedCacheControlHeaderStrategy(UnauthorizedCacheControlHeaderStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace VpcLinkStatusMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         VpcLinkStatus GetVpcLinkStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VpcLinkStatus::AVAILABLE;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return VpcLinkStatus::PENDING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return VpcLinkStatus::DELETING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return VpcLinkStatus::FAILED;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return VpcLinkStatus::AVAILABLE;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return VpcLinkStatus::PENDING;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return VpcLinkStatus::DELETING;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return VpcLinkStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return VpcLinkStatus::NOT_SET;
         }
 
-        Aws::String GetNameForVpcLinkStatus(VpcLinkStatus enumValue)
+        const char* GetNameForVpcLinkStatus(VpcLinkStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace AdjustmentTypeMapper
 {
 AWS_APPLICATIONAUTOSCALING_API AdjustmentType GetAdjustmentTypeForName(const Aws::String& name);
 
-AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForAdjustmentType(AdjustmentType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForAdjustmentType(AdjustmentType value);
 } // namespace AdjustmentTypeMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
@@ -35,7 +35,8 @@ namespace MetricAggregationTypeMapper
 {
 AWS_APPLICATIONAUTOSCALING_API MetricAggregationType GetMetricAggregationTypeForName(const Aws::String& name);
 
-AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForMetricAggregationType(MetricAggregationType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForMetricAggregationType(MetricAggregationType value);
 } // namespace MetricAggregationTypeMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
@@ -37,7 +37,8 @@ namespace MetricStatisticMapper
 {
 AWS_APPLICATIONAUTOSCALING_API MetricStatistic GetMetricStatisticForName(const Aws::String& name);
 
-AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForMetricStatistic(MetricStatistic value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForMetricStatistic(MetricStatistic value);
 } // namespace MetricStatisticMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
@@ -43,7 +43,8 @@ namespace MetricTypeMapper
 {
 AWS_APPLICATIONAUTOSCALING_API MetricType GetMetricTypeForName(const Aws::String& name);
 
-AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForMetricType(MetricType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForMetricType(MetricType value);
 } // namespace MetricTypeMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
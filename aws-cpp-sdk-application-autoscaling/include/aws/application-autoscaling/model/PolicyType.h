@@ -34,7 +34,8 @@ namespace PolicyTypeMapper
 {
 AWS_APPLICATIONAUTOSCALING_API PolicyType GetPolicyTypeForName(const Aws::String& name);
 
-AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForPolicyType(PolicyType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForPolicyType(PolicyType value);
 } // namespace PolicyTypeMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
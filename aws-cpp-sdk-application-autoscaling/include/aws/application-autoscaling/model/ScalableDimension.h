@@ -43,7 +43,8 @@ namespace ScalableDimensionMapper
 {
 AWS_APPLICATIONAUTOSCALING_API ScalableDimension GetScalableDimensionForName(const Aws::String& name);
 
-AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForScalableDimension(ScalableDimension value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForScalableDimension(ScalableDimension value);
 } // namespace ScalableDimensionMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
@@ -38,7 +38,8 @@ namespace ScalingActivityStatusCodeMapper
 {
 AWS_APPLICATIONAUTOSCALING_API ScalingActivityStatusCode GetScalingActivityStatusCodeForName(const Aws::String& name);
 
-AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForScalingActivityStatusCode(ScalingActivityStatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForScalingActivityStatusCode(ScalingActivityStatusCode value);
 } // namespace ScalingActivityStatusCodeMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
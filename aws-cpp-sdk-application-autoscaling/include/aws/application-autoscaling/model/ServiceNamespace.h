@@ -40,7 +40,8 @@ namespace ServiceNamespaceMapper
 {
 AWS_APPLICATIONAUTOSCALING_API ServiceNamespace GetServiceNamespaceForName(const Aws::String& name);
 
-AWS_APPLICATIONAUTOSCALING_API Aws::String GetNameForServiceNamespace(ServiceNamespace value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONAUTOSCALING_API const char* GetNameForServiceNamespace(ServiceNamespace value);
 } // namespace ServiceNamespaceMapper
 } // namespace Model
 } // namespace ApplicationAutoScaling
@@ -28,12 +28,12 @@ namespace ApplicationAutoScaling
 namespace ApplicationAutoScalingErrorMapper
 {
 
-static const int OBJECT_NOT_FOUND_HASH = HashingUtils::HashString("ObjectNotFoundException");
-static const int FAILED_RESOURCE_ACCESS_HASH = HashingUtils::HashString("FailedResourceAccessException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int CONCURRENT_UPDATE_HASH = HashingUtils::HashString("ConcurrentUpdateException");
-static const int INTERNAL_SERVICE_HASH = HashingUtils::HashString("InternalServiceException");
+static constexpr int OBJECT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ObjectNotFoundException");
+static constexpr int FAILED_RESOURCE_ACCESS_HASH = HashingUtils::CompileTimeHashString("FailedResourceAccessException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int CONCURRENT_UPDATE_HASH = HashingUtils::CompileTimeHashString("ConcurrentUpdateException");
+static constexpr int INTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
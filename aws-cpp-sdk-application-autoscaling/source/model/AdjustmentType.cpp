@@ -30,25 +30,37 @@ namespace Aws
       namespace AdjustmentTypeMapper
       {
 
-        static const int ChangeInCapacity_HASH = HashingUtils::HashString("ChangeInCapacity");
-        static const int PercentChangeInCapacity_HASH = HashingUtils::HashString("PercentChangeInCapacity");
-        static const int ExactCapacity_HASH = HashingUtils::HashString("ExactCapacity");
+        static constexpr int ChangeInCapacity_HASH = HashingUtils::CompileTimeHashString("ChangeInCapacity");
+        static constexpr int PercentChangeInCapacity_HASH = HashingUtils::CompileTimeHashString("PercentChangeInCapacity");
+        static constexpr int ExactCapacity_HASH = HashingUtils::CompileTimeHashString("ExactCapacity");
 
 
         AdjustmentType GetAdjustmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ChangeInCapacity_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AdjustmentType::ChangeInCapacity;
-          }
-          else if (hashCode == PercentChangeInCapacity_HASH)
-          {
-            return AdjustmentType::PercentChangeInCapacity;
-          }
-          else if (hashCode == ExactCapacity_HASH)
-          {
-            return AdjustmentType::ExactCapacity;
+          case ChangeInCapacity_HASH:
+            if (name == "ChangeInCapacity")
+            {
+              return AdjustmentType::ChangeInCapacity;
+            }
+            break;
+          case PercentChangeInCapacity_HASH:
+            if (name == "PercentChangeInCapacity")
+            {
+              return AdjustmentType::PercentChangeInCapacity;
+            }
+            break;
+          case ExactCapacity_HASH:
+            if (name == "ExactCapacity")
+            {
+              return AdjustmentType::ExactCapacity;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AdjustmentType::NOT_SET;
         }
 
-        Aws::String GetNameForAdjustmentType(AdjustmentType enumValue)
+        const char* GetNameForAdjustmentType(AdjustmentType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
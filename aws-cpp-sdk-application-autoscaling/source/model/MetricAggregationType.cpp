@@ -30,25 +30,37 @@ namespace Aws
       namespace MetricAggregationTypeMapper
       {
 
-        static const int Average_HASH = HashingUtils::HashString("Average");
-        static const int Minimum_HASH = HashingUtils::HashString("Minimum");
-        static const int Maximum_HASH = HashingUtils::HashString("Maximum");
+        static constexpr int Average_HASH = HashingUtils::CompileTimeHashString("Average");
+        static constexpr int Minimum_HASH = HashingUtils::CompileTimeHashString("Minimum");
+        static constexpr int Maximum_HASH = HashingUtils::CompileTimeHashString("Maximum");
 
 
         MetricAggregationType GetMetricAggregationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Average_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MetricAggregationType::Average;
-          }
-          else if (hashCode == Minimum_HASH)
-          {
-            return MetricAggregationType::Minimum;
-          }
-          else if (hashCode == Maximum_HASH)
-          {
-            return MetricAggregationType::Maximum;
+          case Average_HASH:
+            if (name == "Average")
+            {
+              return MetricAggregationType::Average;
+            }
+            break;
+          case Minimum_HASH:
+            if (name == "Minimum")
+            {
+              return MetricAggregationType::Minimum;
+            }
+            break;
+          case Maximum_HASH:
+            if (name == "Maximum")
+            {
+              return MetricAggregationType::Maximum;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return MetricAggregationType::NOT_SET;
         }
 
-        Aws::String GetNameForMetricAggregationType(MetricAggregationType enumValue)
+        const char* GetNameForMetricAggregationType(MetricAggregationType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
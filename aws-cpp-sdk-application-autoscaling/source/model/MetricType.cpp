@@ -30,65 +30,93 @@ namespace Aws
       namespace MetricTypeMapper
       {
 
-        static const int DynamoDBReadCapacityUtilization_HASH = HashingUtils::HashString("DynamoDBReadCapacityUtilization");
-        static const int DynamoDBWriteCapacityUtilization_HASH = HashingUtils::HashString("DynamoDBWriteCapacityUtilization");
-        static const int ALBRequestCountPerTarget_HASH = HashingUtils::HashString("ALBRequestCountPerTarget");
-        static const int RDSReaderAverageCPUUtilization_HASH = HashingUtils::HashString("RDSReaderAverageCPUUtilization");
-        static const int RDSReaderAverageDatabaseConnections_HASH = HashingUtils::HashString("RDSReaderAverageDatabaseConnections");
-        static const int EC2SpotFleetRequestAverageCPUUtilization_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageCPUUtilization");
-        static const int EC2SpotFleetRequestAverageNetworkIn_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageNetworkIn");
-        static const int EC2SpotFleetRequestAverageNetworkOut_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageNetworkOut");
-        static const int SageMakerVariantInvocationsPerInstance_HASH = HashingUtils::HashString("SageMakerVariantInvocationsPerInstance");
-        static const int ECSServiceAverageCPUUtilization_HASH = HashingUtils::HashString("ECSServiceAverageCPUUtilization");
-        static const int ECSServiceAverageMemoryUtilization_HASH = HashingUtils::HashString("ECSServiceAverageMemoryUtilization");
+        static constexpr int DynamoDBReadCapacityUtilization_HASH = HashingUtils::CompileTimeHashString("DynamoDBReadCapacityUtilization");
+        static constexpr int DynamoDBWriteCapacityUtilization_HASH = HashingUtils::CompileTimeHashString("DynamoDBWriteCapacityUtilization");
+        static constexpr int ALBRequestCountPerTarget_HASH = HashingUtils::CompileTimeHashString("ALBRequestCountPerTarget");
+        static constexpr int RDSReaderAverageCPUUtilization_HASH = HashingUtils::CompileTimeHashString("RDSReaderAverageCPUUtilization");
+        static constexpr int RDSReaderAverageDatabaseConnections_HASH = HashingUtils::CompileTimeHashString("RDSReaderAverageDatabaseConnections");
+        static constexpr int EC2SpotFleetRequestAverageCPUUtilization_HASH = HashingUtils::CompileTimeHashString("EC2SpotFleetRequestAverageCPUUtilization");
+        static constexpr int EC2SpotFleetRequestAverageNetworkIn_HASH = HashingUtils::CompileTimeHashString("EC2SpotFleetRequestAverageNetworkIn");
+        static constexpr int EC2SpotFleetRequestAverageNetworkOut_HASH = HashingUtils::CompileTimeHashString("EC2SpotFleetRequestAverageNetworkOut");
+        static constexpr int SageMakerVariantInvocationsPerInstance_HASH = HashingUtils::CompileTimeHashString("SageMakerVariantInvocationsPerInstance");
+        static constexpr int ECSServiceAverageCPUUtilization_HASH = HashingUtils::CompileTimeHashString("ECSServiceAverageCPUUtilization");
+        static constexpr int ECSServiceAverageMemoryUtilization_HASH = HashingUtils::CompileTimeHashString("ECSServiceAverageMemoryUtilization");
 
 
         MetricType GetMetricTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DynamoDBReadCapacityUtilization_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MetricType::DynamoDBReadCapacityUtilization;
-          }
-          else if (hashCode == DynamoDBWriteCapacityUtilization_HASH)
-          {
-            return MetricType::DynamoDBWriteCapacityUtilization;
-          }
-          else if (hashCode == ALBRequestCountPerTarget_HASH)
-          {
-            return MetricType::ALBRequestCountPerTarget;
-          }
-          else if (hashCode == RDSReaderAverageCPUUtilization_HASH)
-          {
-            return MetricType::RDSReaderAverageCPUUtilization;
-          }
-          else if (hashCode == RDSReaderAverageDatabaseConnections_HASH)
-          {
-            return MetricType::RDSReaderAverageDatabaseConnections;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageCPUUtilization_HASH)
-          {
-            return MetricType::EC2SpotFleetRequestAverageCPUUtilization;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageNetworkIn_HASH)
-          {
-            return MetricType::EC2SpotFleetRequestAverageNetworkIn;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageNetworkOut_HASH)
-          {
-            return MetricType::EC2SpotFleetRequestAverageNetworkOut;
-          }
-          else if (hashCode == SageMakerVariantInvocationsPerInstance_HASH)
-          {
-            return MetricType::SageMakerVariantInvocationsPerInstance;
-          }
-          else if (hashCode == ECSServiceAverageCPUUtilization_HASH)
-          {
-            return MetricType::ECSServiceAverageCPUUtilization;
-          }
-          else if (hashCode == ECSServiceAverageMemoryUtilization_HASH)
-          {
-            return MetricType::ECSServiceAverageMemoryUtilization;
+          case DynamoDBReadCapacityUtilization_HASH:
+            if (name == "DynamoDBReadCapacityUtilization")
+            {
+              return MetricType::DynamoDBReadCapacityUtilization;
+            }
+            break;
+          case DynamoDBWriteCapacityUtilization_HASH:
+            if (name == "DynamoDBWriteCapacityUtilization")
+            {
+              return MetricType::DynamoDBWriteCapacityUtilization;
+            }
+            break;
+          case ALBRequestCountPerTarget_HASH:
+            if (name == "ALBRequestCountPerTarget")
+            {
+              return MetricType::ALBRequestCountPerTarget;
+            }
+            break;
+          case RDSReaderAverageCPUUtilization_HASH:
+            if (name == "RDSReaderAverageCPUUtilization")
+            {
+              return MetricType::RDSReaderAverageCPUUtilization;
+            }
+            break;
+          case RDSReaderAverageDatabaseConnections_HASH:
+            if (name == "RDSReaderAverageDatabaseConnections")
+            {
+              return MetricType::RDSReaderAverageDatabaseConnections;
+            }
+            break;
+          case EC2SpotFleetRequestAverageCPUUtilization_HASH:
+            if (name == "EC2SpotFleetRequestAverageCPUUtilization")
+            {
+              return MetricType::EC2SpotFleetRequestAverageCPUUtilization;
+            }
+            break;
+          case EC2SpotFleetRequestAverageNetworkIn_HASH:
+            if (name == "EC2SpotFleetRequestAverageNetworkIn")
+            {
+              return MetricType::EC2SpotFleetRequestAverageNetworkIn;
+            }
+            break;
+          case EC2SpotFleetRequestAverageNetworkOut_HASH:
+            if (name == "EC2SpotFleetRequestAverageNetworkOut")
+            {
+              return MetricType::EC2SpotFleetRequestAverageNetworkOut;
+            }
+            break;
+          case SageMakerVariantInvocationsPerInstance_HASH:
+            if (name == "SageMakerVariantInvocationsPerInstance")
+            {
+              return MetricType::SageMakerVariantInvocationsPerInstance;
+            }
+            break;
+          case ECSServiceAverageCPUUtilization_HASH:
+            if (name == "ECSServiceAverageCPUUtilization")
+            {
+              return MetricType::ECSServiceAverageCPUUtilization;
+            }
+            break;
+          case ECSServiceAverageMemoryUtilization_HASH:
+            if (name == "ECSServiceAverageMemoryUtilization")
+            {
+              return MetricType::ECSServiceAverageMemoryUtilization;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return MetricType::NOT_SET;
         }
 
-        Aws::String GetNameForMetricType(MetricType enumValue)
+        const char* GetNameForMetricType(MetricType enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PolicyTypeMapper
       {
 
-        static const int StepScaling_HASH = HashingUtils::HashString("StepScaling");
-        static const int TargetTrackingScaling_HASH = HashingUtils::HashString("TargetTrackingScaling");
+        static constexpr int StepScaling_HASH = HashingUtils::CompileTimeHashString("StepScaling");
+        static constexpr int TargetTrackingScaling_HASH = HashingUtils::CompileTimeHashString("TargetTrackingScaling");
 
 
         PolicyType GetPolicyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == StepScaling_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PolicyType::StepScaling;
-          }
-          else if (hashCode == TargetTrackingScaling_HASH)
-          {
-            return PolicyType::TargetTrackingScaling;
+          case StepScaling_HASH:
+            if (name == "StepScaling")
+            {
+              return PolicyType::StepScaling;
+            }
+            break;
+          case TargetTrackingScaling_HASH:
+            if (name == "TargetTrackingScaling")
+            {
+              return PolicyType::TargetTrackingScaling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PolicyType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyType(PolicyType enumValue)
+        const char* GetNameForPolicyType(PolicyType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,65 +30,93 @@ namespace Aws
       namespace ScalableDimensionMapper
       {
 
-        static const int ecs_service_DesiredCount_HASH = HashingUtils::HashString("ecs:service:DesiredCount");
-        static const int ec2_spot_fleet_request_TargetCapacity_HASH = HashingUtils::HashString("ec2:spot-fleet-request:TargetCapacity");
-        static const int elasticmapreduce_instancegroup_InstanceCount_HASH = HashingUtils::HashString("elasticmapreduce:instancegroup:InstanceCount");
-        static const int appstream_fleet_DesiredCapacity_HASH = HashingUtils::HashString("appstream:fleet:DesiredCapacity");
-        static const int dynamodb_table_ReadCapacityUnits_HASH = HashingUtils::HashString("dynamodb:table:ReadCapacityUnits");
-        static const int dynamodb_table_WriteCapacityUnits_HASH = HashingUtils::HashString("dynamodb:table:WriteCapacityUnits");
-        static const int dynamodb_index_ReadCapacityUnits_HASH = HashingUtils::HashString("dynamodb:index:ReadCapacityUnits");
-        static const int dynamodb_index_WriteCapacityUnits_HASH = HashingUtils::HashString("dynamodb:index:WriteCapacityUnits");
-        static const int rds_cluster_ReadReplicaCount_HASH = HashingUtils::HashString("rds:cluster:ReadReplicaCount");
-        static const int sagemaker_variant_DesiredInstanceCount_HASH = HashingUtils::HashString("sagemaker:variant:DesiredInstanceCount");
-        static const int custom_resource_ResourceType_Property_HASH = HashingUtils::HashString("custom-resource:ResourceType:Property");
+        static constexpr int ecs_service_DesiredCount_HASH = HashingUtils::CompileTimeHashString("ecs:service:DesiredCount");
+        static constexpr int ec2_spot_fleet_request_TargetCapacity_HASH = HashingUtils::CompileTimeHashString("ec2:spot-fleet-request:TargetCapacity");
+        static constexpr int elasticmapreduce_instancegroup_InstanceCount_HASH = HashingUtils::CompileTimeHashString("elasticmapreduce:instancegroup:InstanceCount");
+        static constexpr int appstream_fleet_DesiredCapacity_HASH = HashingUtils::CompileTimeHashString("appstream:fleet:DesiredCapacity");
+        static constexpr int dynamodb_table_ReadCapacityUnits_HASH = HashingUtils::CompileTimeHashString("dynamodb:table:ReadCapacityUnits");
+        static constexpr int dynamodb_table_WriteCapacityUnits_HASH = HashingUtils::CompileTimeHashString("dynamodb:table:WriteCapacityUnits");
+        static constexpr int dynamodb_index_ReadCapacityUnits_HASH = HashingUtils::CompileTimeHashString("dynamodb:index:ReadCapacityUnits");
+        static constexpr int dynamodb_index_WriteCapacityUnits_HASH = HashingUtils::CompileTimeHashString("dynamodb:index:WriteCapacityUnits");
+        static constexpr int rds_cluster_ReadReplicaCount_HASH = HashingUtils::CompileTimeHashString("rds:cluster:ReadReplicaCount");
+        static constexpr int sagemaker_variant_DesiredInstanceCount_HASH = HashingUtils::CompileTimeHashString("sagemaker:variant:DesiredInstanceCount");
+        static constexpr int custom_resource_ResourceType_Property_HASH = HashingUtils::CompileTimeHashString("custom-resource:ResourceType:Property");
 
 
         ScalableDimension GetScalableDimensionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ecs_service_DesiredCount_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalableDimension::ecs_service_DesiredCount;
-          }
-          else if (hashCode == ec2_spot_fleet_request_TargetCapacity_HASH)
-          {
-            return ScalableDimension::ec2_spot_fleet_request_TargetCapacity;
-          }
-          else if (hashCode == elasticmapreduce_instancegroup_InstanceCount_HASH)
-          {
-            return ScalableDimension::elasticmapreduce_instancegroup_InstanceCount;
-          }
-          else if (hashCode == appstream_fleet_DesiredCapacity_HASH)
-          {
-            return ScalableDimension::appstream_fleet_DesiredCapacity;
-          }
-          else if (hashCode == dynamodb_table_ReadCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_table_ReadCapacityUnits;
-          }
-          else if (hashCode == dynamodb_table_WriteCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_table_WriteCapacityUnits;
-          }
-          else if (hashCode == dynamodb_index_ReadCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_index_ReadCapacityUnits;
-          }
-          else if (hashCode == dynamodb_index_WriteCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_index_WriteCapacityUnits;
-          }
-          else if (hashCode == rds_cluster_ReadReplicaCount_HASH)
-          {
-            return ScalableDimension::rds_cluster_ReadReplicaCount;
-          }
-          else if (hashCode == sagemaker_variant_DesiredInstanceCount_HASH)
-          {
-            return ScalableDimension::sagemaker_variant_DesiredInstanceCount;
-          }
-          else if (hashCode == custom_resource_ResourceType_Property_HASH)
-          {
-            return ScalableDimension::custom_resource_ResourceType_Property;
+          case ecs_service_DesiredCount_HASH:
+            if (name == "ecs:service:DesiredCount")
+            {
+              return ScalableDimension::ecs_service_DesiredCount;
+            }
+            break;
+          case ec2_spot_fleet_request_TargetCapacity_HASH:
+            if (name == "ec2:spot-fleet-request:TargetCapacity")
+            {
+              return ScalableDimension::ec2_spot_fleet_request_TargetCapacity;
+            }
+            break;
+          case elasticmapreduce_instancegroup_InstanceCount_HASH:
+            if (name == "elasticmapreduce:instancegroup:InstanceCount")
+            {
+              return ScalableDimension::elasticmapreduce_instancegroup_InstanceCount;
+            }
+            break;
+          case appstream_fleet_DesiredCapacity_HASH:
+            if (name == "appstream:fleet:DesiredCapacity")
+            {
+              return ScalableDimension::appstream_fleet_DesiredCapacity;
+            }
+            break;
+          case dynamodb_table_ReadCapacityUnits_HASH:
+            if (name == "dynamodb:table:ReadCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_table_ReadCapacityUnits;
+            }
+            break;
+          case dynamodb_table_WriteCapacityUnits_HASH:
+            if (name == "dynamodb:table:WriteCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_table_WriteCapacityUnits;
+            }
+            break;
+          case dynamodb_index_ReadCapacityUnits_HASH:
+            if (name == "dynamodb:index:ReadCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_index_ReadCapacityUnits;
+            }
+            break;
+          case dynamodb_index_WriteCapacityUnits_HASH:
+            if (name == "dynamodb:index:WriteCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_index_WriteCapacityUnits;
+            }
+            break;
+          case rds_cluster_ReadReplicaCount_HASH:
+            if (name == "rds:cluster:ReadReplicaCount")
+            {
+              return ScalableDimension::rds_cluster_ReadReplicaCount;
+            }
+            break;
+          case sagemaker_variant_DesiredInstanceCount_HASH:
+            if (name == "sagemaker:variant:DesiredInstanceCount")
+            {
+              return ScalableDimension::sagemaker_variant_DesiredInstanceCount;
+            }
+            break;
+          case custom_resource_ResourceType_Property_HASH:
+            if (name == "custom-resource:ResourceType:Property")
+            {
+              return ScalableDimension::custom_resource_ResourceType_Property;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return ScalableDimension::NOT_SET;
         }
 
-        Aws::String GetNameForScalableDimension(ScalableDimension enumValue)
+        const char* GetNameForScalableDimension(ScalableDimension enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace ScalingActivityStatusCodeMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Successful_HASH = HashingUtils::HashString("Successful");
-        static const int Overridden_HASH = HashingUtils::HashString("Overridden");
-        static const int Unfulfilled_HASH = HashingUtils::HashString("Unfulfilled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Successful_HASH = HashingUtils::CompileTimeHashString("Successful");
+        static constexpr int Overridden_HASH = HashingUtils::CompileTimeHashString("Overridden");
+        static constexpr int Unfulfilled_HASH = HashingUtils::CompileTimeHashString("Unfulfilled");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         ScalingActivityStatusCode GetScalingActivityStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalingActivityStatusCode::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return ScalingActivityStatusCode::InProgress;
-          }
-          else if (hashCode == Successful_HASH)
-          {
-            return ScalingActivityStatusCode::Successful;
-          }
-          else if (hashCode == Overridden_HASH)
-          {
-            return ScalingActivityStatusCode::Overridden;
-          }
-          else if (hashCode == Unfulfilled_HASH)
-          {
-            return ScalingActivityStatusCode::Unfulfilled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ScalingActivityStatusCode::Failed;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return ScalingActivityStatusCode::Pending;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return ScalingActivityStatusCode::InProgress;
+            }
+            break;
+          case Successful_HASH:
+            if (name == "Successful")
+            {
+              return ScalingActivityStatusCode::Successful;
+            }
+            break;
+          case Overridden_HASH:
+            if (name == "Overridden")
+            {
+              return ScalingActivityStatusCode::Overridden;
+            }
+            break;
+          case Unfulfilled_HASH:
+            if (name == "Unfulfilled")
+            {
+              return ScalingActivityStatusCode::Unfulfilled;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return ScalingActivityStatusCode::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ScalingActivityStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForScalingActivityStatusCode(ScalingActivityStatusCode enumValue)
+        const char* GetNameForScalingActivityStatusCode(ScalingActivityStatusCode enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
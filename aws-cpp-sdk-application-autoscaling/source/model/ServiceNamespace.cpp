@@ -30,50 +30,72 @@ namespace Aws
       namespace ServiceNamespaceMapper
       {
 
-        static const int ecs_HASH = HashingUtils::HashString("ecs");
-        static const int elasticmapreduce_HASH = HashingUtils::HashString("elasticmapreduce");
-        static const int ec2_HASH = HashingUtils::HashString("ec2");
-        static const int appstream_HASH = HashingUtils::HashString("appstream");
-        static const int dynamodb_HASH = HashingUtils::HashString("dynamodb");
-        static const int rds_HASH = HashingUtils::HashString("rds");
-        static const int sagemaker_HASH = HashingUtils::HashString("sagemaker");
-        static const int custom_resource_HASH = HashingUtils::HashString("custom-resource");
+        static constexpr int ecs_HASH = HashingUtils::CompileTimeHashString("ecs");
+        static constexpr int elasticmapreduce_HASH = HashingUtils::CompileTimeHashString("elasticmapreduce");
+        static constexpr int ec2_HASH = HashingUtils::CompileTimeHashString("ec2");
+        static constexpr int appstream_HASH = HashingUtils::CompileTimeHashString("appstream");
+        static constexpr int dynamodb_HASH = HashingUtils::CompileTimeHashString("dynamodb");
+        static constexpr int rds_HASH = HashingUtils::CompileTimeHashString("rds");
+        static constexpr int sagemaker_HASH = HashingUtils::CompileTimeHashString("sagemaker");
+        static constexpr int custom_resource_HASH = HashingUtils::CompileTimeHashString("custom-resource");
 
 
         ServiceNamespace GetServiceNamespaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ecs_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServiceNamespace::ecs;
-          }
-          else if (hashCode == elasticmapreduce_HASH)
-          {
-            return ServiceNamespace::elasticmapreduce;
-          }
-          else if (hashCode == ec2_HASH)
-          {
-            return ServiceNamespace::ec2;
-          }
-          else if (hashCode == appstream_HASH)
-          {
-            return ServiceNamespace::appstream;
-          }
-          else if (hashCode == dynamodb_HASH)
-          {
-            return ServiceNamespace::dynamodb;
-          }
-          else if (hashCode == rds_HASH)
-          {
-            return ServiceNamespace::rds;
-          }
-          else if (hashCode == sagemaker_HASH)
-          {
-            return ServiceNamespace::sagemaker;
-          }
-          else if (hashCode == custom_resource_HASH)
-          {
-            return ServiceNamespace::custom_resource;
+          case ecs_HASH:
+            if (name == "ecs")
+            {
+              return ServiceNamespace::ecs;
+            }
+            break;
+          case elasticmapreduce_HASH:
+            if (name == "elasticmapreduce")
+            {
+              return ServiceNamespace::elasticmapreduce;
+            }
+            break;
+          case ec2_HASH:
+            if (name == "ec2")
+            {
+              return ServiceNamespace::ec2;
+            }
+            break;
+          case appstream_HASH:
+            if (name == "appstream")
+            {
+              return ServiceNamespace::appstream;
+            }
+            break;
+          case dynamodb_HASH:
+            if (name == "dynamodb")
+            {
+              return ServiceNamespace::dynamodb;
+            }
+            break;
+          case rds_HASH:
+            if (name == "rds")
+            {
+              return ServiceNamespace::rds;
+            }
+            break;
+          case sagemaker_HASH:
+            if (name == "sagemaker")
+            {
+              return ServiceNamespace::sagemaker;
+            }
+            break;
+          case custom_resource_HASH:
+            if (name == "custom-resource")
+            {
+              return ServiceNamespace::custom_resource;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return ServiceNamespace::NOT_SET;
         }
 
-        Aws::String GetNameForServiceNamespace(ServiceNamespace enumValue)
+        const char* GetNameForServiceNamespace(ServiceNamespace enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -37,7 +37,8 @@ namespace ActionMapper
 {
 AWS_APPSTREAM_API Action GetActionForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForAction(Action value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForAction(Action value);
 } // namespace ActionMapper
 } // namespace Model
 } // namespace AppStream
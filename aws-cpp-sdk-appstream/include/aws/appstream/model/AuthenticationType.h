@@ -35,7 +35,8 @@ namespace AuthenticationTypeMapper
 {
 AWS_APPSTREAM_API AuthenticationType GetAuthenticationTypeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForAuthenticationType(AuthenticationType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForAuthenticationType(AuthenticationType value);
 } // namespace AuthenticationTypeMapper
 } // namespace Model
 } // namespace AppStream
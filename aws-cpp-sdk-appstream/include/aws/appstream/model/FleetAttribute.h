@@ -35,7 +35,8 @@ namespace FleetAttributeMapper
 {
 AWS_APPSTREAM_API FleetAttribute GetFleetAttributeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForFleetAttribute(FleetAttribute value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForFleetAttribute(FleetAttribute value);
 } // namespace FleetAttributeMapper
 } // namespace Model
 } // namespace AppStream
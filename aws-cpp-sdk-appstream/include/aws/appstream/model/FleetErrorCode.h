@@ -58,7 +58,8 @@ namespace FleetErrorCodeMapper
 {
 AWS_APPSTREAM_API FleetErrorCode GetFleetErrorCodeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForFleetErrorCode(FleetErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForFleetErrorCode(FleetErrorCode value);
 } // namespace FleetErrorCodeMapper
 } // namespace Model
 } // namespace AppStream
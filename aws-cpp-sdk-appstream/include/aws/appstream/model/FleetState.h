@@ -36,7 +36,8 @@ namespace FleetStateMapper
 {
 AWS_APPSTREAM_API FleetState GetFleetStateForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForFleetState(FleetState value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForFleetState(FleetState value);
 } // namespace FleetStateMapper
 } // namespace Model
 } // namespace AppStream
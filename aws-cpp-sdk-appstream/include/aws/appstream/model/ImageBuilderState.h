@@ -41,7 +41,8 @@ namespace ImageBuilderStateMapper
 {
 AWS_APPSTREAM_API ImageBuilderState GetImageBuilderStateForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForImageBuilderState(ImageBuilderState value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForImageBuilderState(ImageBuilderState value);
 } // namespace ImageBuilderStateMapper
 } // namespace Model
 } // namespace AppStream
@@ -34,7 +34,8 @@ namespace ImageBuilderStateChangeReasonCodeMapper
 {
 AWS_APPSTREAM_API ImageBuilderStateChangeReasonCode GetImageBuilderStateChangeReasonCodeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForImageBuilderStateChangeReasonCode(ImageBuilderStateChangeReasonCode value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForImageBuilderStateChangeReasonCode(ImageBuilderStateChangeReasonCode value);
 } // namespace ImageBuilderStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace AppStream
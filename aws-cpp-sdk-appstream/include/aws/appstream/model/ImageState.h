@@ -37,7 +37,8 @@ namespace ImageStateMapper
 {
 AWS_APPSTREAM_API ImageState GetImageStateForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForImageState(ImageState value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForImageState(ImageState value);
 } // namespace ImageStateMapper
 } // namespace Model
 } // namespace AppStream
@@ -35,7 +35,8 @@ namespace ImageStateChangeReasonCodeMapper
 {
 AWS_APPSTREAM_API ImageStateChangeReasonCode GetImageStateChangeReasonCodeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForImageStateChangeReasonCode(ImageStateChangeReasonCode value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForImageStateChangeReasonCode(ImageStateChangeReasonCode value);
 } // namespace ImageStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace AppStream
@@ -34,7 +34,8 @@ namespace PermissionMapper
 {
 AWS_APPSTREAM_API Permission GetPermissionForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForPermission(Permission value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForPermission(Permission value);
 } // namespace PermissionMapper
 } // namespace Model
 } // namespace AppStream
@@ -33,7 +33,8 @@ namespace PlatformTypeMapper
 {
 AWS_APPSTREAM_API PlatformType GetPlatformTypeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForPlatformType(PlatformType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForPlatformType(PlatformType value);
 } // namespace PlatformTypeMapper
 } // namespace Model
 } // namespace AppStream
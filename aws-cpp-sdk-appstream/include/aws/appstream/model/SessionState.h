@@ -35,7 +35,8 @@ namespace SessionStateMapper
 {
 AWS_APPSTREAM_API SessionState GetSessionStateForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForSessionState(SessionState value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForSessionState(SessionState value);
 } // namespace SessionStateMapper
 } // namespace Model
 } // namespace AppStream
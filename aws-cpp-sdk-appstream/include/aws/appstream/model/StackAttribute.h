@@ -40,7 +40,8 @@ namespace StackAttributeMapper
 {
 AWS_APPSTREAM_API StackAttribute GetStackAttributeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForStackAttribute(StackAttribute value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForStackAttribute(StackAttribute value);
 } // namespace StackAttributeMapper
 } // namespace Model
 } // namespace AppStream
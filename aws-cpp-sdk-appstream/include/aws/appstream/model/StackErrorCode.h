@@ -34,7 +34,8 @@ namespace StackErrorCodeMapper
 {
 AWS_APPSTREAM_API StackErrorCode GetStackErrorCodeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForStackErrorCode(StackErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForStackErrorCode(StackErrorCode value);
 } // namespace StackErrorCodeMapper
 } // namespace Model
 } // namespace AppStream
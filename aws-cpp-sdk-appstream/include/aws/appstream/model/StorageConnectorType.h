@@ -35,7 +35,8 @@ namespace StorageConnectorTypeMapper
 {
 AWS_APPSTREAM_API StorageConnectorType GetStorageConnectorTypeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForStorageConnectorType(StorageConnectorType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForStorageConnectorType(StorageConnectorType value);
 } // namespace StorageConnectorTypeMapper
 } // namespace Model
 } // namespace AppStream
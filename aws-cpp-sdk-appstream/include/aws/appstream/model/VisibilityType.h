@@ -35,7 +35,8 @@ namespace VisibilityTypeMapper
 {
 AWS_APPSTREAM_API VisibilityType GetVisibilityTypeForName(const Aws::String& name);
 
-AWS_APPSTREAM_API Aws::String GetNameForVisibilityType(VisibilityType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSTREAM_API const char* GetNameForVisibilityType(VisibilityType value);
 } // namespace VisibilityTypeMapper
 } // namespace Model
 } // namespace AppStream
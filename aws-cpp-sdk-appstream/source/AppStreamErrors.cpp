@@ -28,15 +28,15 @@ namespace AppStream
 namespace AppStreamErrorMapper
 {
 
-static const int INVALID_ACCOUNT_STATUS_HASH = HashingUtils::HashString("InvalidAccountStatusException");
-static const int RESOURCE_NOT_AVAILABLE_HASH = HashingUtils::HashString("ResourceNotAvailableException");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ResourceAlreadyExistsException");
-static const int INVALID_ROLE_HASH = HashingUtils::HashString("InvalidRoleException");
-static const int INCOMPATIBLE_IMAGE_HASH = HashingUtils::HashString("IncompatibleImageException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OperationNotPermittedException");
+static constexpr int INVALID_ACCOUNT_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidAccountStatusException");
+static constexpr int RESOURCE_NOT_AVAILABLE_HASH = HashingUtils::CompileTimeHashString("ResourceNotAvailableException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyExistsException");
+static constexpr int INVALID_ROLE_HASH = HashingUtils::CompileTimeHashString("InvalidRoleException");
+static constexpr int INCOMPATIBLE_IMAGE_HASH = HashingUtils::CompileTimeHashString("IncompatibleImageException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OperationNotPermittedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
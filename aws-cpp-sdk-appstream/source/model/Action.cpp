@@ -30,35 +30,51 @@ namespace Aws
       namespace ActionMapper
       {
 
-        static const int CLIPBOARD_COPY_FROM_LOCAL_DEVICE_HASH = HashingUtils::HashString("CLIPBOARD_COPY_FROM_LOCAL_DEVICE");
-        static const int CLIPBOARD_COPY_TO_LOCAL_DEVICE_HASH = HashingUtils::HashString("CLIPBOARD_COPY_TO_LOCAL_DEVICE");
-        static const int FILE_UPLOAD_HASH = HashingUtils::HashString("FILE_UPLOAD");
-        static const int FILE_DOWNLOAD_HASH = HashingUtils::HashString("FILE_DOWNLOAD");
-        static const int PRINTING_TO_LOCAL_DEVICE_HASH = HashingUtils::HashString("PRINTING_TO_LOCAL_DEVICE");
+        static constexpr int CLIPBOARD_COPY_FROM_LOCAL_DEVICE_HASH = HashingUtils::CompileTimeHashString("CLIPBOARD_COPY_FROM_LOCAL_DEVICE");
+        static constexpr int CLIPBOARD_COPY_TO_LOCAL_DEVICE_HASH = HashingUtils::CompileTimeHashString("CLIPBOARD_COPY_TO_LOCAL_DEVICE");
+        static constexpr int FILE_UPLOAD_HASH = HashingUtils::CompileTimeHashString("FILE_UPLOAD");
+        static constexpr int FILE_DOWNLOAD_HASH = HashingUtils::CompileTimeHashString("FILE_DOWNLOAD");
+        static constexpr int PRINTING_TO_LOCAL_DEVICE_HASH = HashingUtils::CompileTimeHashString("PRINTING_TO_LOCAL_DEVICE");
 
 
         Action GetActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLIPBOARD_COPY_FROM_LOCAL_DEVICE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Action::CLIPBOARD_COPY_FROM_LOCAL_DEVICE;
-          }
-          else if (hashCode == CLIPBOARD_COPY_TO_LOCAL_DEVICE_HASH)
-          {
-            return Action::CLIPBOARD_COPY_TO_LOCAL_DEVICE;
-          }
-          else if (hashCode == FILE_UPLOAD_HASH)
-          {
-            return Action::FILE_UPLOAD;
-          }
-          else if (hashCode == FILE_DOWNLOAD_HASH)
-          {
-            return Action::FILE_DOWNLOAD;
-          }
-          else if (hashCode == PRINTING_TO_LOCAL_DEVICE_HASH)
-          {
-            return Action::PRINTING_TO_LOCAL_DEVICE;
+          case CLIPBOARD_COPY_FROM_LOCAL_DEVICE_HASH:
+            if (name == "CLIPBOARD_COPY_FROM_LOCAL_DEVICE")
+            {
+              return Action::CLIPBOARD_COPY_FROM_LOCAL_DEVICE;
+            }
+            break;
+          case CLIPBOARD_COPY_TO_LOCAL_DEVICE_HASH:
+            if (name == "CLIPBOARD_COPY_TO_LOCAL_DEVICE")
+            {
+              return Action::CLIPBOARD_COPY_TO_LOCAL_DEVICE;
+            }
+            break;
+          case FILE_UPLOAD_HASH:
+            if (name == "FILE_UPLOAD")
+            {
+              return Action::FILE_UPLOAD;
+            }
+            break;
+          case FILE_DOWNLOAD_HASH:
+            if (name == "FILE_DOWNLOAD")
+            {
+              return Action::FILE_DOWNLOAD;
+            }
+            break;
+          case PRINTING_TO_LOCAL_DEVICE_HASH:
+            if (name == "PRINTING_TO_LOCAL_DEVICE")
+            {
+              return Action::PRINTING_TO_LOCAL_DEVICE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Action::NOT_SET;
         }
 
-        Aws::String GetNameForAction(Action enumValue)
+        const char* GetNameForAction(Action enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AuthenticationTypeMapper
       {
 
-        static const int API_HASH = HashingUtils::HashString("API");
-        static const int SAML_HASH = HashingUtils::HashString("SAML");
-        static const int USERPOOL_HASH = HashingUtils::HashString("USERPOOL");
+        static constexpr int API_HASH = HashingUtils::CompileTimeHashString("API");
+        static constexpr int SAML_HASH = HashingUtils::CompileTimeHashString("SAML");
+        static constexpr int USERPOOL_HASH = HashingUtils::CompileTimeHashString("USERPOOL");
 
 
         AuthenticationType GetAuthenticationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == API_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthenticationType::API;
-          }
-          else if (hashCode == SAML_HASH)
-          {
-            return AuthenticationType::SAML;
-          }
-          else if (hashCode == USERPOOL_HASH)
-          {
-            return AuthenticationType::USERPOOL;
+          case API_HASH:
+            if (name == "API")
+            {
+              return AuthenticationType::API;
+            }
+            break;
+          case SAML_HASH:
+            if (name == "SAML")
+            {
+              return AuthenticationType::SAML;
+            }
+            break;
+          case USERPOOL_HASH:
+            if (name == "USERPOOL")
+            {
+              return AuthenticationType::USERPOOL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AuthenticationType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticationType(AuthenticationType enumValue)
+        const char* GetNameForAuthenticationType(AuthenticationType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
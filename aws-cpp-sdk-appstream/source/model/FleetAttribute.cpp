@@ -30,25 +30,37 @@ namespace Aws
       namespace FleetAttributeMapper
       {
 
-        static const int VPC_CONFIGURATION_HASH = HashingUtils::HashString("VPC_CONFIGURATION");
-        static const int VPC_CONFIGURATION_SECURITY_GROUP_IDS_HASH = HashingUtils::HashString("VPC_CONFIGURATION_SECURITY_GROUP_IDS");
-        static const int DOMAIN_JOIN_INFO_HASH = HashingUtils::HashString("DOMAIN_JOIN_INFO");
+        static constexpr int VPC_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("VPC_CONFIGURATION");
+        static constexpr int VPC_CONFIGURATION_SECURITY_GROUP_IDS_HASH = HashingUtils::CompileTimeHashString("VPC_CONFIGURATION_SECURITY_GROUP_IDS");
+        static constexpr int DOMAIN_JOIN_INFO_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_INFO");
 
 
         FleetAttribute GetFleetAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VPC_CONFIGURATION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetAttribute::VPC_CONFIGURATION;
-          }
-          else if (hashCode == VPC_CONFIGURATION_SECURITY_GROUP_IDS_HASH)
-          {
-            return FleetAttribute::VPC_CONFIGURATION_SECURITY_GROUP_IDS;
-          }
-          else if (hashCode == DOMAIN_JOIN_INFO_HASH)
-          {
-            return FleetAttribute::DOMAIN_JOIN_INFO;
+          case VPC_CONFIGURATION_HASH:
+            if (name == "VPC_CONFIGURATION")
+            {
+              return FleetAttribute::VPC_CONFIGURATION;
+            }
+            break;
+          case VPC_CONFIGURATION_SECURITY_GROUP_IDS_HASH:
+            if (name == "VPC_CONFIGURATION_SECURITY_GROUP_IDS")
+            {
+              return FleetAttribute::VPC_CONFIGURATION_SECURITY_GROUP_IDS;
+            }
+            break;
+          case DOMAIN_JOIN_INFO_HASH:
+            if (name == "DOMAIN_JOIN_INFO")
+            {
+              return FleetAttribute::DOMAIN_JOIN_INFO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FleetAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForFleetAttribute(FleetAttribute enumValue)
+        const char* GetNameForFleetAttribute(FleetAttribute enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,140 +30,198 @@ namespace Aws
       namespace FleetErrorCodeMapper
       {
 
-        static const int IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION");
-        static const int IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION");
-        static const int IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION");
-        static const int NETWORK_INTERFACE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("NETWORK_INTERFACE_LIMIT_EXCEEDED");
-        static const int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::HashString("INTERNAL_SERVICE_ERROR");
-        static const int IAM_SERVICE_ROLE_IS_MISSING_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_IS_MISSING");
-        static const int SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES_HASH = HashingUtils::HashString("SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES");
-        static const int IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION");
-        static const int SUBNET_NOT_FOUND_HASH = HashingUtils::HashString("SUBNET_NOT_FOUND");
-        static const int IMAGE_NOT_FOUND_HASH = HashingUtils::HashString("IMAGE_NOT_FOUND");
-        static const int INVALID_SUBNET_CONFIGURATION_HASH = HashingUtils::HashString("INVALID_SUBNET_CONFIGURATION");
-        static const int SECURITY_GROUPS_NOT_FOUND_HASH = HashingUtils::HashString("SECURITY_GROUPS_NOT_FOUND");
-        static const int IGW_NOT_ATTACHED_HASH = HashingUtils::HashString("IGW_NOT_ATTACHED");
-        static const int IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION_HASH = HashingUtils::HashString("IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION");
-        static const int DOMAIN_JOIN_ERROR_FILE_NOT_FOUND_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_FILE_NOT_FOUND");
-        static const int DOMAIN_JOIN_ERROR_ACCESS_DENIED_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_ACCESS_DENIED");
-        static const int DOMAIN_JOIN_ERROR_LOGON_FAILURE_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_LOGON_FAILURE");
-        static const int DOMAIN_JOIN_ERROR_INVALID_PARAMETER_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_INVALID_PARAMETER");
-        static const int DOMAIN_JOIN_ERROR_MORE_DATA_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_MORE_DATA");
-        static const int DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN");
-        static const int DOMAIN_JOIN_ERROR_NOT_SUPPORTED_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_NOT_SUPPORTED");
-        static const int DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME_HASH = HashingUtils::HashString("DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME");
-        static const int DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED_HASH = HashingUtils::HashString("DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED");
-        static const int DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED_HASH = HashingUtils::HashString("DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED");
-        static const int DOMAIN_JOIN_NERR_PASSWORD_EXPIRED_HASH = HashingUtils::HashString("DOMAIN_JOIN_NERR_PASSWORD_EXPIRED");
-        static const int DOMAIN_JOIN_INTERNAL_SERVICE_ERROR_HASH = HashingUtils::HashString("DOMAIN_JOIN_INTERNAL_SERVICE_ERROR");
+        static constexpr int IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION_HASH = HashingUtils::CompileTimeHashString("IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION");
+        static constexpr int IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION_HASH = HashingUtils::CompileTimeHashString("IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION");
+        static constexpr int IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION_HASH = HashingUtils::CompileTimeHashString("IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION");
+        static constexpr int NETWORK_INTERFACE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NETWORK_INTERFACE_LIMIT_EXCEEDED");
+        static constexpr int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_SERVICE_ERROR");
+        static constexpr int IAM_SERVICE_ROLE_IS_MISSING_HASH = HashingUtils::CompileTimeHashString("IAM_SERVICE_ROLE_IS_MISSING");
+        static constexpr int SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES_HASH = HashingUtils::CompileTimeHashString("SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES");
+        static constexpr int IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION_HASH = HashingUtils::CompileTimeHashString("IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION");
+        static constexpr int SUBNET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SUBNET_NOT_FOUND");
+        static constexpr int IMAGE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("IMAGE_NOT_FOUND");
+        static constexpr int INVALID_SUBNET_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("INVALID_SUBNET_CONFIGURATION");
+        static constexpr int SECURITY_GROUPS_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SECURITY_GROUPS_NOT_FOUND");
+        static constexpr int IGW_NOT_ATTACHED_HASH = HashingUtils::CompileTimeHashString("IGW_NOT_ATTACHED");
+        static constexpr int IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION_HASH = HashingUtils::CompileTimeHashString("IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION");
+        static constexpr int DOMAIN_JOIN_ERROR_FILE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_ERROR_FILE_NOT_FOUND");
+        static constexpr int DOMAIN_JOIN_ERROR_ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_ERROR_ACCESS_DENIED");
+        static constexpr int DOMAIN_JOIN_ERROR_LOGON_FAILURE_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_ERROR_LOGON_FAILURE");
+        static constexpr int DOMAIN_JOIN_ERROR_INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_ERROR_INVALID_PARAMETER");
+        static constexpr int DOMAIN_JOIN_ERROR_MORE_DATA_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_ERROR_MORE_DATA");
+        static constexpr int DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN");
+        static constexpr int DOMAIN_JOIN_ERROR_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_ERROR_NOT_SUPPORTED");
+        static constexpr int DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME");
+        static constexpr int DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED");
+        static constexpr int DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED");
+        static constexpr int DOMAIN_JOIN_NERR_PASSWORD_EXPIRED_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_NERR_PASSWORD_EXPIRED");
+        static constexpr int DOMAIN_JOIN_INTERNAL_SERVICE_ERROR_HASH = HashingUtils::CompileTimeHashString("DOMAIN_JOIN_INTERNAL_SERVICE_ERROR");
 
 
         FleetErrorCode GetFleetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION;
-          }
-          else if (hashCode == NETWORK_INTERFACE_LIMIT_EXCEEDED_HASH)
-          {
-            return FleetErrorCode::NETWORK_INTERFACE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == INTERNAL_SERVICE_ERROR_HASH)
-          {
-            return FleetErrorCode::INTERNAL_SERVICE_ERROR;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_IS_MISSING_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_IS_MISSING;
-          }
-          else if (hashCode == SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES_HASH)
-          {
-            return FleetErrorCode::SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION;
-          }
-          else if (hashCode == SUBNET_NOT_FOUND_HASH)
-          {
-            return FleetErrorCode::SUBNET_NOT_FOUND;
-          }
-          else if (hashCode == IMAGE_NOT_FOUND_HASH)
-          {
-            return FleetErrorCode::IMAGE_NOT_FOUND;
-          }
-          else if (hashCode == INVALID_SUBNET_CONFIGURATION_HASH)
-          {
-            return FleetErrorCode::INVALID_SUBNET_CONFIGURATION;
-          }
-          else if (hashCode == SECURITY_GROUPS_NOT_FOUND_HASH)
-          {
-            return FleetErrorCode::SECURITY_GROUPS_NOT_FOUND;
-          }
-          else if (hashCode == IGW_NOT_ATTACHED_HASH)
-          {
-            return FleetErrorCode::IGW_NOT_ATTACHED;
-          }
-          else if (hashCode == IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION_HASH)
-          {
-            return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_FILE_NOT_FOUND_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_FILE_NOT_FOUND;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_ACCESS_DENIED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_ACCESS_DENIED;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_LOGON_FAILURE_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_LOGON_FAILURE;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_INVALID_PARAMETER_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_INVALID_PARAMETER;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_MORE_DATA_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_MORE_DATA;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_NOT_SUPPORTED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_NOT_SUPPORTED;
-          }
-          else if (hashCode == DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME;
-          }
-          else if (hashCode == DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED;
-          }
-          else if (hashCode == DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED;
-          }
-          else if (hashCode == DOMAIN_JOIN_NERR_PASSWORD_EXPIRED_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_NERR_PASSWORD_EXPIRED;
-          }
-          else if (hashCode == DOMAIN_JOIN_INTERNAL_SERVICE_ERROR_HASH)
-          {
-            return FleetErrorCode::DOMAIN_JOIN_INTERNAL_SERVICE_ERROR;
+          case IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION_HASH:
+            if (name == "IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DESCRIBE_ACTION;
+            }
+            break;
+          case IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION_HASH:
+            if (name == "IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_CREATE_ACTION;
+            }
+            break;
+          case IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION_HASH:
+            if (name == "IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_ENI_DELETE_ACTION;
+            }
+            break;
+          case NETWORK_INTERFACE_LIMIT_EXCEEDED_HASH:
+            if (name == "NETWORK_INTERFACE_LIMIT_EXCEEDED")
+            {
+              return FleetErrorCode::NETWORK_INTERFACE_LIMIT_EXCEEDED;
+            }
+            break;
+          case INTERNAL_SERVICE_ERROR_HASH:
+            if (name == "INTERNAL_SERVICE_ERROR")
+            {
+              return FleetErrorCode::INTERNAL_SERVICE_ERROR;
+            }
+            break;
+          case IAM_SERVICE_ROLE_IS_MISSING_HASH:
+            if (name == "IAM_SERVICE_ROLE_IS_MISSING")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_IS_MISSING;
+            }
+            break;
+          case SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES_HASH:
+            if (name == "SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES")
+            {
+              return FleetErrorCode::SUBNET_HAS_INSUFFICIENT_IP_ADDRESSES;
+            }
+            break;
+          case IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION_HASH:
+            if (name == "IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SUBNET_ACTION;
+            }
+            break;
+          case SUBNET_NOT_FOUND_HASH:
+            if (name == "SUBNET_NOT_FOUND")
+            {
+              return FleetErrorCode::SUBNET_NOT_FOUND;
+            }
+            break;
+          case IMAGE_NOT_FOUND_HASH:
+            if (name == "IMAGE_NOT_FOUND")
+            {
+              return FleetErrorCode::IMAGE_NOT_FOUND;
+            }
+            break;
+          case INVALID_SUBNET_CONFIGURATION_HASH:
+            if (name == "INVALID_SUBNET_CONFIGURATION")
+            {
+              return FleetErrorCode::INVALID_SUBNET_CONFIGURATION;
+            }
+            break;
+          case SECURITY_GROUPS_NOT_FOUND_HASH:
+            if (name == "SECURITY_GROUPS_NOT_FOUND")
+            {
+              return FleetErrorCode::SECURITY_GROUPS_NOT_FOUND;
+            }
+            break;
+          case IGW_NOT_ATTACHED_HASH:
+            if (name == "IGW_NOT_ATTACHED")
+            {
+              return FleetErrorCode::IGW_NOT_ATTACHED;
+            }
+            break;
+          case IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION_HASH:
+            if (name == "IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION")
+            {
+              return FleetErrorCode::IAM_SERVICE_ROLE_MISSING_DESCRIBE_SECURITY_GROUPS_ACTION;
+            }
+            break;
+          case DOMAIN_JOIN_ERROR_FILE_NOT_FOUND_HASH:
+            if (name == "DOMAIN_JOIN_ERROR_FILE_NOT_FOUND")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_FILE_NOT_FOUND;
+            }
+            break;
+          case DOMAIN_JOIN_ERROR_ACCESS_DENIED_HASH:
+            if (name == "DOMAIN_JOIN_ERROR_ACCESS_DENIED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_ACCESS_DENIED;
+            }
+            break;
+          case DOMAIN_JOIN_ERROR_LOGON_FAILURE_HASH:
+            if (name == "DOMAIN_JOIN_ERROR_LOGON_FAILURE")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_LOGON_FAILURE;
+            }
+            break;
+          case DOMAIN_JOIN_ERROR_INVALID_PARAMETER_HASH:
+            if (name == "DOMAIN_JOIN_ERROR_INVALID_PARAMETER")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_INVALID_PARAMETER;
+            }
+            break;
+          case DOMAIN_JOIN_ERROR_MORE_DATA_HASH:
+            if (name == "DOMAIN_JOIN_ERROR_MORE_DATA")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_MORE_DATA;
+            }
+            break;
+          case DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN_HASH:
+            if (name == "DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_NO_SUCH_DOMAIN;
+            }
+            break;
+          case DOMAIN_JOIN_ERROR_NOT_SUPPORTED_HASH:
+            if (name == "DOMAIN_JOIN_ERROR_NOT_SUPPORTED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_NOT_SUPPORTED;
+            }
+            break;
+          case DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME_HASH:
+            if (name == "DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_NERR_INVALID_WORKGROUP_NAME;
+            }
+            break;
+          case DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED_HASH:
+            if (name == "DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_NERR_WORKSTATION_NOT_STARTED;
+            }
+            break;
+          case DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED_HASH:
+            if (name == "DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_ERROR_DS_MACHINE_ACCOUNT_QUOTA_EXCEEDED;
+            }
+            break;
+          case DOMAIN_JOIN_NERR_PASSWORD_EXPIRED_HASH:
+            if (name == "DOMAIN_JOIN_NERR_PASSWORD_EXPIRED")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_NERR_PASSWORD_EXPIRED;
+            }
+            break;
+          case DOMAIN_JOIN_INTERNAL_SERVICE_ERROR_HASH:
+            if (name == "DOMAIN_JOIN_INTERNAL_SERVICE_ERROR")
+            {
+              return FleetErrorCode::DOMAIN_JOIN_INTERNAL_SERVICE_ERROR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -175,7 +233,7 @@ namespace Aws
           return FleetErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForFleetErrorCode(FleetErrorCode enumValue)
+        const char* GetNameForFleetErrorCode(FleetErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -235,7 +293,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace FleetStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
+        static constexpr int STARTING_HASH = HashingUtils::CompileTimeHashString("STARTING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
 
 
         FleetState GetFleetStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetState::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return FleetState::RUNNING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return FleetState::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return FleetState::STOPPED;
+          case STARTING_HASH:
+            if (name == "STARTING")
+            {
+              return FleetState::STARTING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return FleetState::RUNNING;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return FleetState::STOPPING;
+            }
+            break;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return FleetState::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return FleetState::NOT_SET;
         }
 
-        Aws::String GetNameForFleetState(FleetState enumValue)
+        const char* GetNameForFleetState(FleetState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
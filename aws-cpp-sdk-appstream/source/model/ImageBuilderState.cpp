@@ -30,55 +30,79 @@ namespace Aws
       namespace ImageBuilderStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int UPDATING_AGENT_HASH = HashingUtils::HashString("UPDATING_AGENT");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int REBOOTING_HASH = HashingUtils::HashString("REBOOTING");
-        static const int SNAPSHOTTING_HASH = HashingUtils::HashString("SNAPSHOTTING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int UPDATING_AGENT_HASH = HashingUtils::CompileTimeHashString("UPDATING_AGENT");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
+        static constexpr int REBOOTING_HASH = HashingUtils::CompileTimeHashString("REBOOTING");
+        static constexpr int SNAPSHOTTING_HASH = HashingUtils::CompileTimeHashString("SNAPSHOTTING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         ImageBuilderState GetImageBuilderStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ImageBuilderState::PENDING;
-          }
-          else if (hashCode == UPDATING_AGENT_HASH)
-          {
-            return ImageBuilderState::UPDATING_AGENT;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ImageBuilderState::RUNNING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return ImageBuilderState::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return ImageBuilderState::STOPPED;
-          }
-          else if (hashCode == REBOOTING_HASH)
-          {
-            return ImageBuilderState::REBOOTING;
-          }
-          else if (hashCode == SNAPSHOTTING_HASH)
-          {
-            return ImageBuilderState::SNAPSHOTTING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ImageBuilderState::DELETING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ImageBuilderState::FAILED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ImageBuilderState::PENDING;
+            }
+            break;
+          case UPDATING_AGENT_HASH:
+            if (name == "UPDATING_AGENT")
+            {
+              return ImageBuilderState::UPDATING_AGENT;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return ImageBuilderState::RUNNING;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return ImageBuilderState::STOPPING;
+            }
+            break;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return ImageBuilderState::STOPPED;
+            }
+            break;
+          case REBOOTING_HASH:
+            if (name == "REBOOTING")
+            {
+              return ImageBuilderState::REBOOTING;
+            }
+            break;
+          case SNAPSHOTTING_HASH:
+            if (name == "SNAPSHOTTING")
+            {
+              return ImageBuilderState::SNAPSHOTTING;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ImageBuilderState::DELETING;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ImageBuilderState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return ImageBuilderState::NOT_SET;
         }
 
-        Aws::String GetNameForImageBuilderState(ImageBuilderState enumValue)
+        const char* GetNameForImageBuilderState(ImageBuilderState enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ImageBuilderStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int IMAGE_UNAVAILABLE_HASH = HashingUtils::HashString("IMAGE_UNAVAILABLE");
+        static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_ERROR");
+        static constexpr int IMAGE_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("IMAGE_UNAVAILABLE");
 
 
         ImageBuilderStateChangeReasonCode GetImageBuilderStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ImageBuilderStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == IMAGE_UNAVAILABLE_HASH)
-          {
-            return ImageBuilderStateChangeReasonCode::IMAGE_UNAVAILABLE;
+          case INTERNAL_ERROR_HASH:
+            if (name == "INTERNAL_ERROR")
+            {
+              return ImageBuilderStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case IMAGE_UNAVAILABLE_HASH:
+            if (name == "IMAGE_UNAVAILABLE")
+            {
+              return ImageBuilderStateChangeReasonCode::IMAGE_UNAVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ImageBuilderStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForImageBuilderStateChangeReasonCode(ImageBuilderStateChangeReasonCode enumValue)
+        const char* GetNameForImageBuilderStateChangeReasonCode(ImageBuilderStateChangeReasonCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
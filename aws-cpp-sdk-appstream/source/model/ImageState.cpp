@@ -30,35 +30,51 @@ namespace Aws
       namespace ImageStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COPYING_HASH = HashingUtils::HashString("COPYING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int COPYING_HASH = HashingUtils::CompileTimeHashString("COPYING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
 
 
         ImageState GetImageStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ImageState::PENDING;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return ImageState::AVAILABLE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ImageState::FAILED;
-          }
-          else if (hashCode == COPYING_HASH)
-          {
-            return ImageState::COPYING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ImageState::DELETING;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ImageState::PENDING;
+            }
+            break;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return ImageState::AVAILABLE;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ImageState::FAILED;
+            }
+            break;
+          case COPYING_HASH:
+            if (name == "COPYING")
+            {
+              return ImageState::COPYING;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ImageState::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ImageState::NOT_SET;
         }
 
-        Aws::String GetNameForImageState(ImageState enumValue)
+        const char* GetNameForImageState(ImageState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ImageStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int IMAGE_BUILDER_NOT_AVAILABLE_HASH = HashingUtils::HashString("IMAGE_BUILDER_NOT_AVAILABLE");
-        static const int IMAGE_COPY_FAILURE_HASH = HashingUtils::HashString("IMAGE_COPY_FAILURE");
+        static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_ERROR");
+        static constexpr int IMAGE_BUILDER_NOT_AVAILABLE_HASH = HashingUtils::CompileTimeHashString("IMAGE_BUILDER_NOT_AVAILABLE");
+        static constexpr int IMAGE_COPY_FAILURE_HASH = HashingUtils::CompileTimeHashString("IMAGE_COPY_FAILURE");
 
 
         ImageStateChangeReasonCode GetImageStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ImageStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == IMAGE_BUILDER_NOT_AVAILABLE_HASH)
-          {
-            return ImageStateChangeReasonCode::IMAGE_BUILDER_NOT_AVAILABLE;
-          }
-          else if (hashCode == IMAGE_COPY_FAILURE_HASH)
-          {
-            return ImageStateChangeReasonCode::IMAGE_COPY_FAILURE;
+          case INTERNAL_ERROR_HASH:
+            if (name == "INTERNAL_ERROR")
+            {
+              return ImageStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case IMAGE_BUILDER_NOT_AVAILABLE_HASH:
+            if (name == "IMAGE_BUILDER_NOT_AVAILABLE")
+            {
+              return ImageStateChangeReasonCode::IMAGE_BUILDER_NOT_AVAILABLE;
+            }
+            break;
+          case IMAGE_COPY_FAILURE_HASH:
+            if (name == "IMAGE_COPY_FAILURE")
+            {
+              return ImageStateChangeReasonCode::IMAGE_COPY_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ImageStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForImageStateChangeReasonCode(ImageStateChangeReasonCode enumValue)
+        const char* GetNameForImageStateChangeReasonCode(ImageStateChangeReasonCode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace PlatformTypeMapper
       {
 
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
+        static constexpr int WINDOWS_HASH = HashingUtils::CompileTimeHashString("WINDOWS");
 
 
         PlatformType GetPlatformTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlatformType::WINDOWS;
+          case WINDOWS_HASH:
+            if (name == "WINDOWS")
+            {
+              return PlatformType::WINDOWS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return PlatformType::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformType(PlatformType enumValue)
+        const char* GetNameForPlatformType(PlatformType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
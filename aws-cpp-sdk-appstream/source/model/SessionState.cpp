@@ -30,25 +30,37 @@ namespace Aws
       namespace SessionStateMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int EXPIRED_HASH = HashingUtils::CompileTimeHashString("EXPIRED");
 
 
         SessionState GetSessionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SessionState::ACTIVE;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return SessionState::PENDING;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return SessionState::EXPIRED;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return SessionState::ACTIVE;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return SessionState::PENDING;
+            }
+            break;
+          case EXPIRED_HASH:
+            if (name == "EXPIRED")
+            {
+              return SessionState::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return SessionState::NOT_SET;
         }
 
-        Aws::String GetNameForSessionState(SessionState enumValue)
+        const char* GetNameForSessionState(SessionState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
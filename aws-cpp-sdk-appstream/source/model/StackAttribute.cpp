@@ -30,50 +30,72 @@ namespace Aws
       namespace StackAttributeMapper
       {
 
-        static const int STORAGE_CONNECTORS_HASH = HashingUtils::HashString("STORAGE_CONNECTORS");
-        static const int STORAGE_CONNECTOR_HOMEFOLDERS_HASH = HashingUtils::HashString("STORAGE_CONNECTOR_HOMEFOLDERS");
-        static const int STORAGE_CONNECTOR_GOOGLE_DRIVE_HASH = HashingUtils::HashString("STORAGE_CONNECTOR_GOOGLE_DRIVE");
-        static const int STORAGE_CONNECTOR_ONE_DRIVE_HASH = HashingUtils::HashString("STORAGE_CONNECTOR_ONE_DRIVE");
-        static const int REDIRECT_URL_HASH = HashingUtils::HashString("REDIRECT_URL");
-        static const int FEEDBACK_URL_HASH = HashingUtils::HashString("FEEDBACK_URL");
-        static const int THEME_NAME_HASH = HashingUtils::HashString("THEME_NAME");
-        static const int USER_SETTINGS_HASH = HashingUtils::HashString("USER_SETTINGS");
+        static constexpr int STORAGE_CONNECTORS_HASH = HashingUtils::CompileTimeHashString("STORAGE_CONNECTORS");
+        static constexpr int STORAGE_CONNECTOR_HOMEFOLDERS_HASH = HashingUtils::CompileTimeHashString("STORAGE_CONNECTOR_HOMEFOLDERS");
+        static constexpr int STORAGE_CONNECTOR_GOOGLE_DRIVE_HASH = HashingUtils::CompileTimeHashString("STORAGE_CONNECTOR_GOOGLE_DRIVE");
+        static constexpr int STORAGE_CONNECTOR_ONE_DRIVE_HASH = HashingUtils::CompileTimeHashString("STORAGE_CONNECTOR_ONE_DRIVE");
+        static constexpr int REDIRECT_URL_HASH = HashingUtils::CompileTimeHashString("REDIRECT_URL");
+        static constexpr int FEEDBACK_URL_HASH = HashingUtils::CompileTimeHashString("FEEDBACK_URL");
+        static constexpr int THEME_NAME_HASH = HashingUtils::CompileTimeHashString("THEME_NAME");
+        static constexpr int USER_SETTINGS_HASH = HashingUtils::CompileTimeHashString("USER_SETTINGS");
 
 
         StackAttribute GetStackAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STORAGE_CONNECTORS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StackAttribute::STORAGE_CONNECTORS;
-          }
-          else if (hashCode == STORAGE_CONNECTOR_HOMEFOLDERS_HASH)
-          {
-            return StackAttribute::STORAGE_CONNECTOR_HOMEFOLDERS;
-          }
-          else if (hashCode == STORAGE_CONNECTOR_GOOGLE_DRIVE_HASH)
-          {
-            return StackAttribute::STORAGE_CONNECTOR_GOOGLE_DRIVE;
-          }
-          else if (hashCode == STORAGE_CONNECTOR_ONE_DRIVE_HASH)
-          {
-            return StackAttribute::STORAGE_CONNECTOR_ONE_DRIVE;
-          }
-          else if (hashCode == REDIRECT_URL_HASH)
-          {
-            return StackAttribute::REDIRECT_URL;
-          }
-          else if (hashCode == FEEDBACK_URL_HASH)
-          {
-            return StackAttribute::FEEDBACK_URL;
-          }
-          else if (hashCode == THEME_NAME_HASH)
-          {
-            return StackAttribute::THEME_NAME;
-          }
-          else if (hashCode == USER_SETTINGS_HASH)
-          {
-            return StackAttribute::USER_SETTINGS;
+          case STORAGE_CONNECTORS_HASH:
+            if (name == "STORAGE_CONNECTORS")
+            {
+              return StackAttribute::STORAGE_CONNECTORS;
+            }
+            break;
+          case STORAGE_CONNECTOR_HOMEFOLDERS_HASH:
+            if (name == "STORAGE_CONNECTOR_HOMEFOLDERS")
+            {
+              return StackAttribute::STORAGE_CONNECTOR_HOMEFOLDERS;
+            }
+            break;
+          case STORAGE_CONNECTOR_GOOGLE_DRIVE_HASH:
+            if (name == "STORAGE_CONNECTOR_GOOGLE_DRIVE")
+            {
+              return StackAttribute::STORAGE_CONNECTOR_GOOGLE_DRIVE;
+            }
+            break;
+          case STORAGE_CONNECTOR_ONE_DRIVE_HASH:
+            if (name == "STORAGE_CONNECTOR_ONE_DRIVE")
+            {
+              return StackAttribute::STORAGE_CONNECTOR_ONE_DRIVE;
+            }
+            break;
+          case REDIRECT_URL_HASH:
+            if (name == "REDIRECT_URL")
+            {
+              return StackAttribute::REDIRECT_URL;
+            }
+            break;
+          case FEEDBACK_URL_HASH:
+            if (name == "FEEDBACK_URL")
+            {
+              return StackAttribute::FEEDBACK_URL;
+            }
+            break;
+          case THEME_NAME_HASH:
+            if (name == "THEME_NAME")
+            {
+              return StackAttribute::THEME_NAME;
+            }
+            break;
+          case USER_SETTINGS_HASH:
+            if (name == "USER_SETTINGS")
+            {
+              return StackAttribute::USER_SETTINGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return StackAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForStackAttribute(StackAttribute enumValue)
+        const char* GetNameForStackAttribute(StackAttribute enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
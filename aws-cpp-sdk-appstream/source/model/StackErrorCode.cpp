@@ -30,20 +30,30 @@ namespace Aws
       namespace StackErrorCodeMapper
       {
 
-        static const int STORAGE_CONNECTOR_ERROR_HASH = HashingUtils::HashString("STORAGE_CONNECTOR_ERROR");
-        static const int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::HashString("INTERNAL_SERVICE_ERROR");
+        static constexpr int STORAGE_CONNECTOR_ERROR_HASH = HashingUtils::CompileTimeHashString("STORAGE_CONNECTOR_ERROR");
+        static constexpr int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_SERVICE_ERROR");
 
 
         StackErrorCode GetStackErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STORAGE_CONNECTOR_ERROR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StackErrorCode::STORAGE_CONNECTOR_ERROR;
-          }
-          else if (hashCode == INTERNAL_SERVICE_ERROR_HASH)
-          {
-            return StackErrorCode::INTERNAL_SERVICE_ERROR;
+          case STORAGE_CONNECTOR_ERROR_HASH:
+            if (name == "STORAGE_CONNECTOR_ERROR")
+            {
+              return StackErrorCode::STORAGE_CONNECTOR_ERROR;
+            }
+            break;
+          case INTERNAL_SERVICE_ERROR_HASH:
+            if (name == "INTERNAL_SERVICE_ERROR")
+            {
+              return StackErrorCode::INTERNAL_SERVICE_ERROR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return StackErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForStackErrorCode(StackErrorCode enumValue)
+        const char* GetNameForStackErrorCode(StackErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
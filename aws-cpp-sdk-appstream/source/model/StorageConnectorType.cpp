@@ -30,25 +30,37 @@ namespace Aws
       namespace StorageConnectorTypeMapper
       {
 
-        static const int HOMEFOLDERS_HASH = HashingUtils::HashString("HOMEFOLDERS");
-        static const int GOOGLE_DRIVE_HASH = HashingUtils::HashString("GOOGLE_DRIVE");
-        static const int ONE_DRIVE_HASH = HashingUtils::HashString("ONE_DRIVE");
+        static constexpr int HOMEFOLDERS_HASH = HashingUtils::CompileTimeHashString("HOMEFOLDERS");
+        static constexpr int GOOGLE_DRIVE_HASH = HashingUtils::CompileTimeHashString("GOOGLE_DRIVE");
+        static constexpr int ONE_DRIVE_HASH = HashingUtils::CompileTimeHashString("ONE_DRIVE");
 
 
         StorageConnectorType GetStorageConnectorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOMEFOLDERS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StorageConnectorType::HOMEFOLDERS;
-          }
-          else if (hashCode == GOOGLE_DRIVE_HASH)
-          {
-            return StorageConnectorType::GOOGLE_DRIVE;
-          }
-          else if (hashCode == ONE_DRIVE_HASH)
-          {
-            return StorageConnectorType::ONE_DRIVE;
+          case HOMEFOLDERS_HASH:
+            if (name == "HOMEFOLDERS")
+            {
+              return StorageConnectorType::HOMEFOLDERS;
+            }
+            break;
+          case GOOGLE_DRIVE_HASH:
+            if (name == "GOOGLE_DRIVE")
+            {
+              return StorageConnectorType::GOOGLE_DRIVE;
+            }
+            break;
+          case ONE_DRIVE_HASH:
+            if (name == "ONE_DRIVE")
+            {
+              return StorageConnectorType::ONE_DRIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return StorageConnectorType::NOT_SET;
         }
 
-        Aws::String GetNameForStorageConnectorType(StorageConnectorType enumValue)
+        const char* GetNameForStorageConnectorType(StorageConnectorType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace VisibilityTypeMapper
       {
 
-        static const int PUBLIC__HASH = HashingUtils::HashString("PUBLIC");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
-        static const int SHARED_HASH = HashingUtils::HashString("SHARED");
+        static constexpr int PUBLIC__HASH = HashingUtils::CompileTimeHashString("PUBLIC");
+        static constexpr int PRIVATE__HASH = HashingUtils::CompileTimeHashString("PRIVATE");
+        static constexpr int SHARED_HASH = HashingUtils::CompileTimeHashString("SHARED");
 
 
         VisibilityType GetVisibilityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUBLIC__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VisibilityType::PUBLIC_;
-          }
-          else if (hashCode == PRIVATE__HASH)
-          {
-            return VisibilityType::PRIVATE_;
-          }
-          else if (hashCode == SHARED_HASH)
-          {
-            return VisibilityType::SHARED;
+          case PUBLIC__HASH:
+            if (name == "PUBLIC")
+            {
+              return VisibilityType::PUBLIC_;
+            }
+            break;
+          case PRIVATE__HASH:
+            if (name == "PRIVATE")
+            {
+              return VisibilityType::PRIVATE_;
+            }
+            break;
+          case SHARED_HASH:
+            if (name == "SHARED")
+            {
+              return VisibilityType::SHARED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return VisibilityType::NOT_SET;
         }
 
-        Aws::String GetNameForVisibilityType(VisibilityType enumValue)
+        const char* GetNameForVisibilityType(VisibilityType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
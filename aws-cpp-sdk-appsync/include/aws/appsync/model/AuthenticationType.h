@@ -36,7 +36,8 @@ namespace AuthenticationTypeMapper
 {
 AWS_APPSYNC_API AuthenticationType GetAuthenticationTypeForName(const Aws::String& name);
 
-AWS_APPSYNC_API Aws::String GetNameForAuthenticationType(AuthenticationType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSYNC_API const char* GetNameForAuthenticationType(AuthenticationType value);
 } // namespace AuthenticationTypeMapper
 } // namespace Model
 } // namespace AppSync
@@ -37,7 +37,8 @@ namespace DataSourceTypeMapper
 {
 AWS_APPSYNC_API DataSourceType GetDataSourceTypeForName(const Aws::String& name);
 
-AWS_APPSYNC_API Aws::String GetNameForDataSourceType(DataSourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSYNC_API const char* GetNameForDataSourceType(DataSourceType value);
 } // namespace DataSourceTypeMapper
 } // namespace Model
 } // namespace AppSync
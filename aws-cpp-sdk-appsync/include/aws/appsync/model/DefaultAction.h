@@ -34,7 +34,8 @@ namespace DefaultActionMapper
 {
 AWS_APPSYNC_API DefaultAction GetDefaultActionForName(const Aws::String& name);
 
-AWS_APPSYNC_API Aws::String GetNameForDefaultAction(DefaultAction value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSYNC_API const char* GetNameForDefaultAction(DefaultAction value);
 } // namespace DefaultActionMapper
 } // namespace Model
 } // namespace AppSync
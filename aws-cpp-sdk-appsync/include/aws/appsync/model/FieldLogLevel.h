@@ -35,7 +35,8 @@ namespace FieldLogLevelMapper
 {
 AWS_APPSYNC_API FieldLogLevel GetFieldLogLevelForName(const Aws::String& name);
 
-AWS_APPSYNC_API Aws::String GetNameForFieldLogLevel(FieldLogLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSYNC_API const char* GetNameForFieldLogLevel(FieldLogLevel value);
 } // namespace FieldLogLevelMapper
 } // namespace Model
 } // namespace AppSync
@@ -34,7 +34,8 @@ namespace OutputTypeMapper
 {
 AWS_APPSYNC_API OutputType GetOutputTypeForName(const Aws::String& name);
 
-AWS_APPSYNC_API Aws::String GetNameForOutputType(OutputType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSYNC_API const char* GetNameForOutputType(OutputType value);
 } // namespace OutputTypeMapper
 } // namespace Model
 } // namespace AppSync
@@ -35,7 +35,8 @@ namespace SchemaStatusMapper
 {
 AWS_APPSYNC_API SchemaStatus GetSchemaStatusForName(const Aws::String& name);
 
-AWS_APPSYNC_API Aws::String GetNameForSchemaStatus(SchemaStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSYNC_API const char* GetNameForSchemaStatus(SchemaStatus value);
 } // namespace SchemaStatusMapper
 } // namespace Model
 } // namespace AppSync
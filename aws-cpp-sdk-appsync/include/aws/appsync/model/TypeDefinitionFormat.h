@@ -34,7 +34,8 @@ namespace TypeDefinitionFormatMapper
 {
 AWS_APPSYNC_API TypeDefinitionFormat GetTypeDefinitionFormatForName(const Aws::String& name);
 
-AWS_APPSYNC_API Aws::String GetNameForTypeDefinitionFormat(TypeDefinitionFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_APPSYNC_API const char* GetNameForTypeDefinitionFormat(TypeDefinitionFormat value);
 } // namespace TypeDefinitionFormatMapper
 } // namespace Model
 } // namespace AppSync
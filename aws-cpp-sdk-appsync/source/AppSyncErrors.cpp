@@ -28,15 +28,15 @@ namespace AppSync
 namespace AppSyncErrorMapper
 {
 
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int GRAPH_Q_L_SCHEMA_HASH = HashingUtils::HashString("GraphQLSchemaException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int BAD_REQUEST_HASH = HashingUtils::HashString("BadRequestException");
-static const int API_KEY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ApiKeyLimitExceededException");
-static const int UNAUTHORIZED_HASH = HashingUtils::HashString("UnauthorizedException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int API_KEY_VALIDITY_OUT_OF_BOUNDS_HASH = HashingUtils::HashString("ApiKeyValidityOutOfBoundsException");
-static const int API_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ApiLimitExceededException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int GRAPH_Q_L_SCHEMA_HASH = HashingUtils::CompileTimeHashString("GraphQLSchemaException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int BAD_REQUEST_HASH = HashingUtils::CompileTimeHashString("BadRequestException");
+static constexpr int API_KEY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ApiKeyLimitExceededException");
+static constexpr int UNAUTHORIZED_HASH = HashingUtils::CompileTimeHashString("UnauthorizedException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int API_KEY_VALIDITY_OUT_OF_BOUNDS_HASH = HashingUtils::CompileTimeHashString("ApiKeyValidityOutOfBoundsException");
+static constexpr int API_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ApiLimitExceededException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
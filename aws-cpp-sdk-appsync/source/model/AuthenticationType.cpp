@@ -30,30 +30,44 @@ namespace Aws
       namespace AuthenticationTypeMapper
       {
 
-        static const int API_KEY_HASH = HashingUtils::HashString("API_KEY");
-        static const int AWS_IAM_HASH = HashingUtils::HashString("AWS_IAM");
-        static const int AMAZON_COGNITO_USER_POOLS_HASH = HashingUtils::HashString("AMAZON_COGNITO_USER_POOLS");
-        static const int OPENID_CONNECT_HASH = HashingUtils::HashString("OPENID_CONNECT");
+        static constexpr int API_KEY_HASH = HashingUtils::CompileTimeHashString("API_KEY");
+        static constexpr int AWS_IAM_HASH = HashingUtils::CompileTimeHashString("AWS_IAM");
+        static constexpr int AMAZON_COGNITO_USER_POOLS_HASH = HashingUtils::CompileTimeHashString("AMAZON_COGNITO_USER_POOLS");
+        static constexpr int OPENID_CONNECT_HASH = HashingUtils::CompileTimeHashString("OPENID_CONNECT");
 
 
         AuthenticationType GetAuthenticationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == API_KEY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthenticationType::API_KEY;
-          }
-          else if (hashCode == AWS_IAM_HASH)
-          {
-            return AuthenticationType::AWS_IAM;
-          }
-          else if (hashCode == AMAZON_COGNITO_USER_POOLS_HASH)
-          {
-            return AuthenticationType::AMAZON_COGNITO_USER_POOLS;
-          }
-          else if (hashCode == OPENID_CONNECT_HASH)
-          {
-            return AuthenticationType::OPENID_CONNECT;
+          case API_KEY_HASH:
+            if (name == "API_KEY")
+            {
+              return AuthenticationType::API_KEY;
+            }
+            break;
+          case AWS_IAM_HASH:
+            if (name == "AWS_IAM")
+            {
+              return AuthenticationType::AWS_IAM;
+            }
+            break;
+          case AMAZON_COGNITO_USER_POOLS_HASH:
+            if (name == "AMAZON_COGNITO_USER_POOLS")
+            {
+              return AuthenticationType::AMAZON_COGNITO_USER_POOLS;
+            }
+            break;
+          case OPENID_CONNECT_HASH:
+            if (name == "OPENID_CONNECT")
+            {
+              return AuthenticationType::OPENID_CONNECT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AuthenticationType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticationType(AuthenticationType enumValue)
+        const char* GetNameForAuthenticationType(AuthenticationType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
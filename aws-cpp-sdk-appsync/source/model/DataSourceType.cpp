@@ -30,35 +30,51 @@ namespace Aws
       namespace DataSourceTypeMapper
       {
 
-        static const int AWS_LAMBDA_HASH = HashingUtils::HashString("AWS_LAMBDA");
-        static const int AMAZON_DYNAMODB_HASH = HashingUtils::HashString("AMAZON_DYNAMODB");
-        static const int AMAZON_ELASTICSEARCH_HASH = HashingUtils::HashString("AMAZON_ELASTICSEARCH");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
+        static constexpr int AWS_LAMBDA_HASH = HashingUtils::CompileTimeHashString("AWS_LAMBDA");
+        static constexpr int AMAZON_DYNAMODB_HASH = HashingUtils::CompileTimeHashString("AMAZON_DYNAMODB");
+        static constexpr int AMAZON_ELASTICSEARCH_HASH = HashingUtils::CompileTimeHashString("AMAZON_ELASTICSEARCH");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int HTTP_HASH = HashingUtils::CompileTimeHashString("HTTP");
 
 
         DataSourceType GetDataSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_LAMBDA_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DataSourceType::AWS_LAMBDA;
-          }
-          else if (hashCode == AMAZON_DYNAMODB_HASH)
-          {
-            return DataSourceType::AMAZON_DYNAMODB;
-          }
-          else if (hashCode == AMAZON_ELASTICSEARCH_HASH)
-          {
-            return DataSourceType::AMAZON_ELASTICSEARCH;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return DataSourceType::NONE;
-          }
-          else if (hashCode == HTTP_HASH)
-          {
-            return DataSourceType::HTTP;
+          case AWS_LAMBDA_HASH:
+            if (name == "AWS_LAMBDA")
+            {
+              return DataSourceType::AWS_LAMBDA;
+            }
+            break;
+          case AMAZON_DYNAMODB_HASH:
+            if (name == "AMAZON_DYNAMODB")
+            {
+              return DataSourceType::AMAZON_DYNAMODB;
+            }
+            break;
+          case AMAZON_ELASTICSEARCH_HASH:
+            if (name == "AMAZON_ELASTICSEARCH")
+            {
+              return DataSourceType::AMAZON_ELASTICSEARCH;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return DataSourceType::NONE;
+            }
+            break;
+          case HTTP_HASH:
+            if (name == "HTTP")
+            {
+              return DataSourceType::HTTP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return DataSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForDataSourceType(DataSourceType enumValue)
+        const char* GetNameForDataSourceType(DataSourceType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
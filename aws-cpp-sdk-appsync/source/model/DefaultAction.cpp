@@ -30,20 +30,30 @@ namespace Aws
       namespace DefaultActionMapper
       {
 
-        static const int ALLOW_HASH = HashingUtils::HashString("ALLOW");
-        static const int DENY_HASH = HashingUtils::HashString("DENY");
+        static constexpr int ALLOW_HASH = HashingUtils::CompileTimeHashString("ALLOW");
+        static constexpr int DENY_HASH = HashingUtils::CompileTimeHashString("DENY");
 
 
         DefaultAction GetDefaultActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALLOW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DefaultAction::ALLOW;
-          }
-          else if (hashCode == DENY_HASH)
-          {
-            return DefaultAction::DENY;
+          case ALLOW_HASH:
+            if (name == "ALLOW")
+            {
+              return DefaultAction::ALLOW;
+            }
+            break;
+          case DENY_HASH:
+            if (name == "DENY")
+            {
+              return DefaultAction::DENY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DefaultAction::NOT_SET;
         }
 
-        Aws::String GetNameForDefaultAction(DefaultAction enumValue)
+        const char* GetNameForDefaultAction(DefaultAction enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace FieldLogLevelMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
 
 
         FieldLogLevel GetFieldLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FieldLogLevel::NONE;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return FieldLogLevel::ERROR_;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return FieldLogLevel::ALL;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return FieldLogLevel::NONE;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return FieldLogLevel::ERROR_;
+            }
+            break;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return FieldLogLevel::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FieldLogLevel::NOT_SET;
         }
 
-        Aws::String GetNameForFieldLogLevel(FieldLogLevel enumValue)
+        const char* GetNameForFieldLogLevel(FieldLogLevel enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
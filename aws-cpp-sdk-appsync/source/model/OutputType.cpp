@@ -30,20 +30,30 @@ namespace Aws
       namespace OutputTypeMapper
       {
 
-        static const int SDL_HASH = HashingUtils::HashString("SDL");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
+        static constexpr int SDL_HASH = HashingUtils::CompileTimeHashString("SDL");
+        static constexpr int JSON_HASH = HashingUtils::CompileTimeHashString("JSON");
 
 
         OutputType GetOutputTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SDL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OutputType::SDL;
-          }
-          else if (hashCode == JSON_HASH)
-          {
-            return OutputType::JSON;
+          case SDL_HASH:
+            if (name == "SDL")
+            {
+              return OutputType::SDL;
+            }
+            break;
+          case JSON_HASH:
+            if (name == "JSON")
+            {
+              return OutputType::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OutputType::NOT_SET;
         }
 
-        Aws::String GetNameForOutputType(OutputType enumValue)
+        const char* GetNameForOutputType(OutputType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
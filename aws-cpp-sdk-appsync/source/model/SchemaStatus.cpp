@@ -30,25 +30,37 @@ namespace Aws
       namespace SchemaStatusMapper
       {
 
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
+        static constexpr int PROCESSING_HASH = HashingUtils::CompileTimeHashString("PROCESSING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
 
 
         SchemaStatus GetSchemaStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROCESSING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SchemaStatus::PROCESSING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return SchemaStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return SchemaStatus::DELETING;
+          case PROCESSING_HASH:
+            if (name == "PROCESSING")
+            {
+              return SchemaStatus::PROCESSING;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return SchemaStatus::ACTIVE;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return SchemaStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return SchemaStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSchemaStatus(SchemaStatus enumValue)
+        const char* GetNameForSchemaStatus(SchemaStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
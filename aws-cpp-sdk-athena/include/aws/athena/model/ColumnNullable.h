@@ -35,7 +35,8 @@ namespace ColumnNullableMapper
 {
 AWS_ATHENA_API ColumnNullable GetColumnNullableForName(const Aws::String& name);
 
-AWS_ATHENA_API Aws::String GetNameForColumnNullable(ColumnNullable value);
+// names of values not modeled point into the enum overflow container
+AWS_ATHENA_API const char* GetNameForColumnNullable(ColumnNullable value);
 } // namespace ColumnNullableMapper
 } // namespace Model
 } // namespace Athena
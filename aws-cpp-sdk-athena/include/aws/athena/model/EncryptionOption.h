@@ -35,7 +35,8 @@ namespace EncryptionOptionMapper
 {
 AWS_ATHENA_API EncryptionOption GetEncryptionOptionForName(const Aws::String& name);
 
-AWS_ATHENA_API Aws::String GetNameForEncryptionOption(EncryptionOption value);
+// names of values not modeled point into the enum overflow container
+AWS_ATHENA_API const char* GetNameForEncryptionOption(EncryptionOption value);
 } // namespace EncryptionOptionMapper
 } // namespace Model
 } // namespace Athena
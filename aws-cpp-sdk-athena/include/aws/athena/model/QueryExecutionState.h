@@ -37,7 +37,8 @@ namespace QueryExecutionStateMapper
 {
 AWS_ATHENA_API QueryExecutionState GetQueryExecutionStateForName(const Aws::String& name);
 
-AWS_ATHENA_API Aws::String GetNameForQueryExecutionState(QueryExecutionState value);
+// names of values not modeled point into the enum overflow container
+AWS_ATHENA_API const char* GetNameForQueryExecutionState(QueryExecutionState value);
 } // namespace QueryExecutionStateMapper
 } // namespace Model
 } // namespace Athena
@@ -33,7 +33,8 @@ namespace ThrottleReasonMapper
 {
 AWS_ATHENA_API ThrottleReason GetThrottleReasonForName(const Aws::String& name);
 
-AWS_ATHENA_API Aws::String GetNameForThrottleReason(ThrottleReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ATHENA_API const char* GetNameForThrottleReason(ThrottleReason value);
 } // namespace ThrottleReasonMapper
 } // namespace Model
 } // namespace Athena
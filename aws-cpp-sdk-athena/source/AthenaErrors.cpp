@@ -28,9 +28,9 @@ namespace Athena
 namespace AthenaErrorMapper
 {
 
-static const int INTERNAL_SERVER_HASH = HashingUtils::HashString("InternalServerException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
+static constexpr int INTERNAL_SERVER_HASH = HashingUtils::CompileTimeHashString("InternalServerException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace ColumnNullableMapper
       {
 
-        static const int NOT_NULL_HASH = HashingUtils::HashString("NOT_NULL");
-        static const int NULLABLE_HASH = HashingUtils::HashString("NULLABLE");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
+        static constexpr int NOT_NULL_HASH = HashingUtils::CompileTimeHashString("NOT_NULL");
+        static constexpr int NULLABLE_HASH = HashingUtils::CompileTimeHashString("NULLABLE");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
 
 
         ColumnNullable GetColumnNullableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_NULL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ColumnNullable::NOT_NULL;
-          }
-          else if (hashCode == NULLABLE_HASH)
-          {
-            return ColumnNullable::NULLABLE;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return ColumnNullable::UNKNOWN;
+          case NOT_NULL_HASH:
+            if (name == "NOT_NULL")
+            {
+              return ColumnNullable::NOT_NULL;
+            }
+            break;
+          case NULLABLE_HASH:
+            if (name == "NULLABLE")
+            {
+              return ColumnNullable::NULLABLE;
+            }
+            break;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return ColumnNullable::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ColumnNullable::NOT_SET;
         }
 
-        Aws::String GetNameForColumnNullable(ColumnNullable enumValue)
+        const char* GetNameForColumnNullable(ColumnNullable enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
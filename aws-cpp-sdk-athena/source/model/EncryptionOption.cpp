@@ -30,25 +30,37 @@ namespace Aws
       namespace EncryptionOptionMapper
       {
 
-        static const int SSE_S3_HASH = HashingUtils::HashString("SSE_S3");
-        static const int SSE_KMS_HASH = HashingUtils::HashString("SSE_KMS");
-        static const int CSE_KMS_HASH = HashingUtils::HashString("CSE_KMS");
+        static constexpr int SSE_S3_HASH = HashingUtils::CompileTimeHashString("SSE_S3");
+        static constexpr int SSE_KMS_HASH = HashingUtils::CompileTimeHashString("SSE_KMS");
+        static constexpr int CSE_KMS_HASH = HashingUtils::CompileTimeHashString("CSE_KMS");
 
 
         EncryptionOption GetEncryptionOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSE_S3_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EncryptionOption::SSE_S3;
-          }
-          else if (hashCode == SSE_KMS_HASH)
-          {
-            return EncryptionOption::SSE_KMS;
-          }
-          else if (hashCode == CSE_KMS_HASH)
-          {
-            return EncryptionOption::CSE_KMS;
+          case SSE_S3_HASH:
+            if (name == "SSE_S3")
+            {
+              return EncryptionOption::SSE_S3;
+            }
+            break;
+          case SSE_KMS_HASH:
+            if (name == "SSE_KMS")
+            {
+              return EncryptionOption::SSE_KMS;
+            }
+            break;
+          case CSE_KMS_HASH:
+            if (name == "CSE_KMS")
+            {
+              return EncryptionOption::CSE_KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return EncryptionOption::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionOption(EncryptionOption enumValue)
+        const char* GetNameForEncryptionOption(EncryptionOption enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
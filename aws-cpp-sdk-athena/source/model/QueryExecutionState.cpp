@@ -30,35 +30,51 @@ namespace Aws
       namespace QueryExecutionStateMapper
       {
 
-        static const int QUEUED_HASH = HashingUtils::HashString("QUEUED");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
+        static constexpr int QUEUED_HASH = HashingUtils::CompileTimeHashString("QUEUED");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int CANCELLED_HASH = HashingUtils::CompileTimeHashString("CANCELLED");
 
 
         QueryExecutionState GetQueryExecutionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == QUEUED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QueryExecutionState::QUEUED;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return QueryExecutionState::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return QueryExecutionState::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return QueryExecutionState::FAILED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return QueryExecutionState::CANCELLED;
+          case QUEUED_HASH:
+            if (name == "QUEUED")
+            {
+              return QueryExecutionState::QUEUED;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return QueryExecutionState::RUNNING;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return QueryExecutionState::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return QueryExecutionState::FAILED;
+            }
+            break;
+          case CANCELLED_HASH:
+            if (name == "CANCELLED")
+            {
+              return QueryExecutionState::CANCELLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return QueryExecutionState::NOT_SET;
         }
 
-        Aws::String GetNameForQueryExecutionState(QueryExecutionState enumValue)
+        const char* GetNameForQueryExecutionState(QueryExecutionState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
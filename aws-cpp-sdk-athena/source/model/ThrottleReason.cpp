@@ -30,15 +30,23 @@ namespace Aws
       namespace ThrottleReasonMapper
       {
 
-        static const int CONCURRENT_QUERY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("CONCURRENT_QUERY_LIMIT_EXCEEDED");
+        static constexpr int CONCURRENT_QUERY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CONCURRENT_QUERY_LIMIT_EXCEEDED");
 
 
         ThrottleReason GetThrottleReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONCURRENT_QUERY_LIMIT_EXCEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ThrottleReason::CONCURRENT_QUERY_LIMIT_EXCEEDED;
+          case CONCURRENT_QUERY_LIMIT_EXCEEDED_HASH:
+            if (name == "CONCURRENT_QUERY_LIMIT_EXCEEDED")
+            {
+              return ThrottleReason::CONCURRENT_QUERY_LIMIT_EXCEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ThrottleReason::NOT_SET;
         }
 
-        Aws::String GetNameForThrottleReason(ThrottleReason enumValue)
+        const char* GetNameForThrottleReason(ThrottleReason enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -33,7 +33,8 @@ namespace PolicyTypeMapper
 {
 AWS_AUTOSCALINGPLANS_API PolicyType GetPolicyTypeForName(const Aws::String& name);
 
-AWS_AUTOSCALINGPLANS_API Aws::String GetNameForPolicyType(PolicyType value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALINGPLANS_API const char* GetNameForPolicyType(PolicyType value);
 } // namespace PolicyTypeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
@@ -40,7 +40,8 @@ namespace ScalableDimensionMapper
 {
 AWS_AUTOSCALINGPLANS_API ScalableDimension GetScalableDimensionForName(const Aws::String& name);
 
-AWS_AUTOSCALINGPLANS_API Aws::String GetNameForScalableDimension(ScalableDimension value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALINGPLANS_API const char* GetNameForScalableDimension(ScalableDimension value);
 } // namespace ScalableDimensionMapper
 } // namespace Model
 } // namespace AutoScalingPlans
@@ -45,7 +45,8 @@ namespace ScalingMetricTypeMapper
 {
 AWS_AUTOSCALINGPLANS_API ScalingMetricType GetScalingMetricTypeForName(const Aws::String& name);
 
-AWS_AUTOSCALINGPLANS_API Aws::String GetNameForScalingMetricType(ScalingMetricType value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALINGPLANS_API const char* GetNameForScalingMetricType(ScalingMetricType value);
 } // namespace ScalingMetricTypeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
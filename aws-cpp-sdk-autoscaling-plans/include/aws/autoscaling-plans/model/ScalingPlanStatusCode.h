@@ -40,7 +40,8 @@ namespace ScalingPlanStatusCodeMapper
 {
 AWS_AUTOSCALINGPLANS_API ScalingPlanStatusCode GetScalingPlanStatusCodeForName(const Aws::String& name);
 
-AWS_AUTOSCALINGPLANS_API Aws::String GetNameForScalingPlanStatusCode(ScalingPlanStatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALINGPLANS_API const char* GetNameForScalingPlanStatusCode(ScalingPlanStatusCode value);
 } // namespace ScalingPlanStatusCodeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
@@ -35,7 +35,8 @@ namespace ScalingStatusCodeMapper
 {
 AWS_AUTOSCALINGPLANS_API ScalingStatusCode GetScalingStatusCodeForName(const Aws::String& name);
 
-AWS_AUTOSCALINGPLANS_API Aws::String GetNameForScalingStatusCode(ScalingStatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALINGPLANS_API const char* GetNameForScalingStatusCode(ScalingStatusCode value);
 } // namespace ScalingStatusCodeMapper
 } // namespace Model
 } // namespace AutoScalingPlans
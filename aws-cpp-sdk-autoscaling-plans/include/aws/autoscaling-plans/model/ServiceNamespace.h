@@ -37,7 +37,8 @@ namespace ServiceNamespaceMapper
 {
 AWS_AUTOSCALINGPLANS_API ServiceNamespace GetServiceNamespaceForName(const Aws::String& name);
 
-AWS_AUTOSCALINGPLANS_API Aws::String GetNameForServiceNamespace(ServiceNamespace value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALINGPLANS_API const char* GetNameForServiceNamespace(ServiceNamespace value);
 } // namespace ServiceNamespaceMapper
 } // namespace Model
 } // namespace AutoScalingPlans
@@ -30,50 +30,72 @@ namespace Aws
       namespace ScalableDimensionMapper
       {
 
-        static const int autoscaling_autoScalingGroup_DesiredCapacity_HASH = HashingUtils::HashString("autoscaling:autoScalingGroup:DesiredCapacity");
-        static const int ecs_service_DesiredCount_HASH = HashingUtils::HashString("ecs:service:DesiredCount");
-        static const int ec2_spot_fleet_request_TargetCapacity_HASH = HashingUtils::HashString("ec2:spot-fleet-request:TargetCapacity");
-        static const int rds_cluster_ReadReplicaCount_HASH = HashingUtils::HashString("rds:cluster:ReadReplicaCount");
-        static const int dynamodb_table_ReadCapacityUnits_HASH = HashingUtils::HashString("dynamodb:table:ReadCapacityUnits");
-        static const int dynamodb_table_WriteCapacityUnits_HASH = HashingUtils::HashString("dynamodb:table:WriteCapacityUnits");
-        static const int dynamodb_index_ReadCapacityUnits_HASH = HashingUtils::HashString("dynamodb:index:ReadCapacityUnits");
-        static const int dynamodb_index_WriteCapacityUnits_HASH = HashingUtils::HashString("dynamodb:index:WriteCapacityUnits");
+        static constexpr int autoscaling_autoScalingGroup_DesiredCapacity_HASH = HashingUtils::CompileTimeHashString("autoscaling:autoScalingGroup:DesiredCapacity");
+        static constexpr int ecs_service_DesiredCount_HASH = HashingUtils::CompileTimeHashString("ecs:service:DesiredCount");
+        static constexpr int ec2_spot_fleet_request_TargetCapacity_HASH = HashingUtils::CompileTimeHashString("ec2:spot-fleet-request:TargetCapacity");
+        static constexpr int rds_cluster_ReadReplicaCount_HASH = HashingUtils::CompileTimeHashString("rds:cluster:ReadReplicaCount");
+        static constexpr int dynamodb_table_ReadCapacityUnits_HASH = HashingUtils::CompileTimeHashString("dynamodb:table:ReadCapacityUnits");
+        static constexpr int dynamodb_table_WriteCapacityUnits_HASH = HashingUtils::CompileTimeHashString("dynamodb:table:WriteCapacityUnits");
+        static constexpr int dynamodb_index_ReadCapacityUnits_HASH = HashingUtils::CompileTimeHashString("dynamodb:index:ReadCapacityUnits");
+        static constexpr int dynamodb_index_WriteCapacityUnits_HASH = HashingUtils::CompileTimeHashString("dynamodb:index:WriteCapacityUnits");
 
 
         ScalableDimension GetScalableDimensionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == autoscaling_autoScalingGroup_DesiredCapacity_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalableDimension::autoscaling_autoScalingGroup_DesiredCapacity;
-          }
-          else if (hashCode == ecs_service_DesiredCount_HASH)
-          {
-            return ScalableDimension::ecs_service_DesiredCount;
-          }
-          else if (hashCode == ec2_spot_fleet_request_TargetCapacity_HASH)
-          {
-            return ScalableDimension::ec2_spot_fleet_request_TargetCapacity;
-          }
-          else if (hashCode == rds_cluster_ReadReplicaCount_HASH)
-          {
-            return ScalableDimension::rds_cluster_ReadReplicaCount;
-          }
-          else if (hashCode == dynamodb_table_ReadCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_table_ReadCapacityUnits;
-          }
-          else if (hashCode == dynamodb_table_WriteCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_table_WriteCapacityUnits;
-          }
-          else if (hashCode == dynamodb_index_ReadCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_index_ReadCapacityUnits;
-          }
-          else if (hashCode == dynamodb_index_WriteCapacityUnits_HASH)
-          {
-            return ScalableDimension::dynamodb_index_WriteCapacityUnits;
+          case autoscaling_autoScalingGroup_DesiredCapacity_HASH:
+            if (name == "autoscaling:autoScalingGroup:DesiredCapacity")
+            {
+              return ScalableDimension::autoscaling_autoScalingGroup_DesiredCapacity;
+            }
+            break;
+          case ecs_service_DesiredCount_HASH:
+            if (name == "ecs:service:DesiredCount")
+            {
+              return ScalableDimension::ecs_service_DesiredCount;
+            }
+            break;
+          case ec2_spot_fleet_request_TargetCapacity_HASH:
+            if (name == "ec2:spot-fleet-request:TargetCapacity")
+            {
+              return ScalableDimension::ec2_spot_fleet_request_TargetCapacity;
+            }
+            break;
+          case rds_cluster_ReadReplicaCount_HASH:
+            if (name == "rds:cluster:ReadReplicaCount")
+            {
+              return ScalableDimension::rds_cluster_ReadReplicaCount;
+            }
+            break;
+          case dynamodb_table_ReadCapacityUnits_HASH:
+            if (name == "dynamodb:table:ReadCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_table_ReadCapacityUnits;
+            }
+            break;
+          case dynamodb_table_WriteCapacityUnits_HASH:
+            if (name == "dynamodb:table:WriteCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_table_WriteCapacityUnits;
+            }
+            break;
+          case dynamodb_index_ReadCapacityUnits_HASH:
+            if (name == "dynamodb:index:ReadCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_index_ReadCapacityUnits;
+            }
+            break;
+          case dynamodb_index_WriteCapacityUnits_HASH:
+            if (name == "dynamodb:index:WriteCapacityUnits")
+            {
+              return ScalableDimension::dynamodb_index_WriteCapacityUnits;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return ScalableDimension::NOT_SET;
         }
 
-        Aws::String GetNameForScalableDimension(ScalableDimension enumValue)
+        const char* GetNameForScalableDimension(ScalableDimension enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
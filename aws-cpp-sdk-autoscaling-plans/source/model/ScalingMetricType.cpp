@@ -30,75 +30,107 @@ namespace Aws
       namespace ScalingMetricTypeMapper
       {
 
-        static const int ASGAverageCPUUtilization_HASH = HashingUtils::HashString("ASGAverageCPUUtilization");
-        static const int ASGAverageNetworkIn_HASH = HashingUtils::HashString("ASGAverageNetworkIn");
-        static const int ASGAverageNetworkOut_HASH = HashingUtils::HashString("ASGAverageNetworkOut");
-        static const int DynamoDBReadCapacityUtilization_HASH = HashingUtils::HashString("DynamoDBReadCapacityUtilization");
-        static const int DynamoDBWriteCapacityUtilization_HASH = HashingUtils::HashString("DynamoDBWriteCapacityUtilization");
-        static const int ECSServiceAverageCPUUtilization_HASH = HashingUtils::HashString("ECSServiceAverageCPUUtilization");
-        static const int ECSServiceAverageMemoryUtilization_HASH = HashingUtils::HashString("ECSServiceAverageMemoryUtilization");
-        static const int ALBRequestCountPerTarget_HASH = HashingUtils::HashString("ALBRequestCountPerTarget");
-        static const int RDSReaderAverageCPUUtilization_HASH = HashingUtils::HashString("RDSReaderAverageCPUUtilization");
-        static const int RDSReaderAverageDatabaseConnections_HASH = HashingUtils::HashString("RDSReaderAverageDatabaseConnections");
-        static const int EC2SpotFleetRequestAverageCPUUtilization_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageCPUUtilization");
-        static const int EC2SpotFleetRequestAverageNetworkIn_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageNetworkIn");
-        static const int EC2SpotFleetRequestAverageNetworkOut_HASH = HashingUtils::HashString("EC2SpotFleetRequestAverageNetworkOut");
+        static constexpr int ASGAverageCPUUtilization_HASH = HashingUtils::CompileTimeHashString("ASGAverageCPUUtilization");
+        static constexpr int ASGAverageNetworkIn_HASH = HashingUtils::CompileTimeHashString("ASGAverageNetworkIn");
+        static constexpr int ASGAverageNetworkOut_HASH = HashingUtils::CompileTimeHashString("ASGAverageNetworkOut");
+        static constexpr int DynamoDBReadCapacityUtilization_HASH = HashingUtils::CompileTimeHashString("DynamoDBReadCapacityUtilization");
+        static constexpr int DynamoDBWriteCapacityUtilization_HASH = HashingUtils::CompileTimeHashString("DynamoDBWriteCapacityUtilization");
+        static constexpr int ECSServiceAverageCPUUtilization_HASH = HashingUtils::CompileTimeHashString("ECSServiceAverageCPUUtilization");
+        static constexpr int ECSServiceAverageMemoryUtilization_HASH = HashingUtils::CompileTimeHashString("ECSServiceAverageMemoryUtilization");
+        static constexpr int ALBRequestCountPerTarget_HASH = HashingUtils::CompileTimeHashString("ALBRequestCountPerTarget");
+        static constexpr int RDSReaderAverageCPUUtilization_HASH = HashingUtils::CompileTimeHashString("RDSReaderAverageCPUUtilization");
+        static constexpr int RDSReaderAverageDatabaseConnections_HASH = HashingUtils::CompileTimeHashString("RDSReaderAverageDatabaseConnections");
+        static constexpr int EC2SpotFleetRequestAverageCPUUtilization_HASH = HashingUtils::CompileTimeHashString("EC2SpotFleetRequestAverageCPUUtilization");
+        static constexpr int EC2SpotFleetRequestAverageNetworkIn_HASH = HashingUtils::CompileTimeHashString("EC2SpotFleetRequestAverageNetworkIn");
+        static constexpr int EC2SpotFleetRequestAverageNetworkOut_HASH = HashingUtils::CompileTimeHashString("EC2SpotFleetRequestAverageNetworkOut");
 
 
         ScalingMetricType GetScalingMetricTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASGAverageCPUUtilization_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalingMetricType::ASGAverageCPUUtilization;
-          }
-          else if (hashCode == ASGAverageNetworkIn_HASH)
-          {
-            return ScalingMetricType::ASGAverageNetworkIn;
-          }
-          else if (hashCode == ASGAverageNetworkOut_HASH)
-          {
-            return ScalingMetricType::ASGAverageNetworkOut;
-          }
-          else if (hashCode == DynamoDBReadCapacityUtilization_HASH)
-          {
-            return ScalingMetricType::DynamoDBReadCapacityUtilization;
-          }
-          else if (hashCode == DynamoDBWriteCapacityUtilization_HASH)
-          {
-            return ScalingMetricType::DynamoDBWriteCapacityUtilization;
-          }
-          else if (hashCode == ECSServiceAverageCPUUtilization_HASH)
-          {
-            return ScalingMetricType::ECSServiceAverageCPUUtilization;
-          }
-          else if (hashCode == ECSServiceAverageMemoryUtilization_HASH)
-          {
-            return ScalingMetricType::ECSServiceAverageMemoryUtilization;
-          }
-          else if (hashCode == ALBRequestCountPerTarget_HASH)
-          {
-            return ScalingMetricType::ALBRequestCountPerTarget;
-          }
-          else if (hashCode == RDSReaderAverageCPUUtilization_HASH)
-          {
-            return ScalingMetricType::RDSReaderAverageCPUUtilization;
-          }
-          else if (hashCode == RDSReaderAverageDatabaseConnections_HASH)
-          {
-            return ScalingMetricType::RDSReaderAverageDatabaseConnections;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageCPUUtilization_HASH)
-          {
-            return ScalingMetricType::EC2SpotFleetRequestAverageCPUUtilization;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageNetworkIn_HASH)
-          {
-            return ScalingMetricType::EC2SpotFleetRequestAverageNetworkIn;
-          }
-          else if (hashCode == EC2SpotFleetRequestAverageNetworkOut_HASH)
-          {
-            return ScalingMetricType::EC2SpotFleetRequestAverageNetworkOut;
+          case ASGAverageCPUUtilization_HASH:
+            if (name == "ASGAverageCPUUtilization")
+            {
+              return ScalingMetricType::ASGAverageCPUUtilization;
+            }
+            break;
+          case ASGAverageNetworkIn_HASH:
+            if (name == "ASGAverageNetworkIn")
+            {
+              return ScalingMetricType::ASGAverageNetworkIn;
+            }
+            break;
+          case ASGAverageNetworkOut_HASH:
+            if (name == "ASGAverageNetworkOut")
+            {
+              return ScalingMetricType::ASGAverageNetworkOut;
+            }
+            break;
+          case DynamoDBReadCapacityUtilization_HASH:
+            if (name == "DynamoDBReadCapacityUtilization")
+            {
+              return ScalingMetricType::DynamoDBReadCapacityUtilization;
+            }
+            break;
+          case DynamoDBWriteCapacityUtilization_HASH:
+            if (name == "DynamoDBWriteCapacityUtilization")
+            {
+              return ScalingMetricType::DynamoDBWriteCapacityUtilization;
+            }
+            break;
+          case ECSServiceAverageCPUUtilization_HASH:
+            if (name == "ECSServiceAverageCPUUtilization")
+            {
+              return ScalingMetricType::ECSServiceAverageCPUUtilization;
+            }
+            break;
+          case ECSServiceAverageMemoryUtilization_HASH:
+            if (name == "ECSServiceAverageMemoryUtilization")
+            {
+              return ScalingMetricType::ECSServiceAverageMemoryUtilization;
+            }
+            break;
+          case ALBRequestCountPerTarget_HASH:
+            if (name == "ALBRequestCountPerTarget")
+            {
+              return ScalingMetricType::ALBRequestCountPerTarget;
+            }
+            break;
+          case RDSReaderAverageCPUUtilization_HASH:
+            if (name == "RDSReaderAverageCPUUtilization")
+            {
+              return ScalingMetricType::RDSReaderAverageCPUUtilization;
+            }
+            break;
+          case RDSReaderAverageDatabaseConnections_HASH:
+            if (name == "RDSReaderAverageDatabaseConnections")
+            {
+              return ScalingMetricType::RDSReaderAverageDatabaseConnections;
+            }
+            break;
+          case EC2SpotFleetRequestAverageCPUUtilization_HASH:
+            if (name == "EC2SpotFleetRequestAverageCPUUtilization")
+            {
+              return ScalingMetricType::EC2SpotFleetRequestAverageCPUUtilization;
+            }
+            break;
+          case EC2SpotFleetRequestAverageNetworkIn_HASH:
+            if (name == "EC2SpotFleetRequestAverageNetworkIn")
+            {
+              return ScalingMetricType::EC2SpotFleetRequestAverageNetworkIn;
+            }
+            break;
+          case EC2SpotFleetRequestAverageNetworkOut_HASH:
+            if (name == "EC2SpotFleetRequestAverageNetworkOut")
+            {
+              return ScalingMetricType::EC2SpotFleetRequestAverageNetworkOut;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,7 +142,7 @@ namespace Aws
           return ScalingMetricType::NOT_SET;
         }
 
-        Aws::String GetNameForScalingMetricType(ScalingMetricType enumValue)
+        const char* GetNameForScalingMetricType(ScalingMetricType enumValue)
         {
           switch(enumValue)
           {
@@ -144,7 +176,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace ScalingPlanStatusCodeMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int ActiveWithProblems_HASH = HashingUtils::HashString("ActiveWithProblems");
-        static const int CreationInProgress_HASH = HashingUtils::HashString("CreationInProgress");
-        static const int CreationFailed_HASH = HashingUtils::HashString("CreationFailed");
-        static const int DeletionInProgress_HASH = HashingUtils::HashString("DeletionInProgress");
-        static const int DeletionFailed_HASH = HashingUtils::HashString("DeletionFailed");
-        static const int UpdateInProgress_HASH = HashingUtils::HashString("UpdateInProgress");
-        static const int UpdateFailed_HASH = HashingUtils::HashString("UpdateFailed");
+        static constexpr int Active_HASH = HashingUtils::CompileTimeHashString("Active");
+        static constexpr int ActiveWithProblems_HASH = HashingUtils::CompileTimeHashString("ActiveWithProblems");
+        static constexpr int CreationInProgress_HASH = HashingUtils::CompileTimeHashString("CreationInProgress");
+        static constexpr int CreationFailed_HASH = HashingUtils::CompileTimeHashString("CreationFailed");
+        static constexpr int DeletionInProgress_HASH = HashingUtils::CompileTimeHashString("DeletionInProgress");
+        static constexpr int DeletionFailed_HASH = HashingUtils::CompileTimeHashString("DeletionFailed");
+        static constexpr int UpdateInProgress_HASH = HashingUtils::CompileTimeHashString("UpdateInProgress");
+        static constexpr int UpdateFailed_HASH = HashingUtils::CompileTimeHashString("UpdateFailed");
 
 
         ScalingPlanStatusCode GetScalingPlanStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalingPlanStatusCode::Active;
-          }
-          else if (hashCode == ActiveWithProblems_HASH)
-          {
-            return ScalingPlanStatusCode::ActiveWithProblems;
-          }
-          else if (hashCode == CreationInProgress_HASH)
-          {
-            return ScalingPlanStatusCode::CreationInProgress;
-          }
-          else if (hashCode == CreationFailed_HASH)
-          {
-            return ScalingPlanStatusCode::CreationFailed;
-          }
-          else if (hashCode == DeletionInProgress_HASH)
-          {
-            return ScalingPlanStatusCode::DeletionInProgress;
-          }
-          else if (hashCode == DeletionFailed_HASH)
-          {
-            return ScalingPlanStatusCode::DeletionFailed;
-          }
-          else if (hashCode == UpdateInProgress_HASH)
-          {
-            return ScalingPlanStatusCode::UpdateInProgress;
-          }
-          else if (hashCode == UpdateFailed_HASH)
-          {
-            return ScalingPlanStatusCode::UpdateFailed;
+          case Active_HASH:
+            if (name == "Active")
+            {
+              return ScalingPlanStatusCode::Active;
+            }
+            break;
+          case ActiveWithProblems_HASH:
+            if (name == "ActiveWithProblems")
+            {
+              return ScalingPlanStatusCode::ActiveWithProblems;
+            }
+            break;
+          case CreationInProgress_HASH:
+            if (name == "CreationInProgress")
+            {
+              return ScalingPlanStatusCode::CreationInProgress;
+            }
+            break;
+          case CreationFailed_HASH:
+            if (name == "CreationFailed")
+            {
+              return ScalingPlanStatusCode::CreationFailed;
+            }
+            break;
+          case DeletionInProgress_HASH:
+            if (name == "DeletionInProgress")
+            {
+              return ScalingPlanStatusCode::DeletionInProgress;
+            }
+            break;
+          case DeletionFailed_HASH:
+            if (name == "DeletionFailed")
+            {
+              return ScalingPlanStatusCode::DeletionFailed;
+            }
+            break;
+          case UpdateInProgress_HASH:
+            if (name == "UpdateInProgress")
+            {
+              return ScalingPlanStatusCode::UpdateInProgress;
+            }
+            break;
+          case UpdateFailed_HASH:
+            if (name == "UpdateFailed")
+            {
+              return ScalingPlanStatusCode::UpdateFailed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return ScalingPlanStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForScalingPlanStatusCode(ScalingPlanStatusCode enumValue)
+        const char* GetNameForScalingPlanStatusCode(ScalingPlanStatusCode enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
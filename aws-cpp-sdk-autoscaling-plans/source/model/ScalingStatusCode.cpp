@@ -30,25 +30,37 @@ namespace Aws
       namespace ScalingStatusCodeMapper
       {
 
-        static const int Inactive_HASH = HashingUtils::HashString("Inactive");
-        static const int PartiallyActive_HASH = HashingUtils::HashString("PartiallyActive");
-        static const int Active_HASH = HashingUtils::HashString("Active");
+        static constexpr int Inactive_HASH = HashingUtils::CompileTimeHashString("Inactive");
+        static constexpr int PartiallyActive_HASH = HashingUtils::CompileTimeHashString("PartiallyActive");
+        static constexpr int Active_HASH = HashingUtils::CompileTimeHashString("Active");
 
 
         ScalingStatusCode GetScalingStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Inactive_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalingStatusCode::Inactive;
-          }
-          else if (hashCode == PartiallyActive_HASH)
-          {
-            return ScalingStatusCode::PartiallyActive;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return ScalingStatusCode::Active;
+          case Inactive_HASH:
+            if (name == "Inactive")
+            {
+              return ScalingStatusCode::Inactive;
+            }
+            break;
+          case PartiallyActive_HASH:
+            if (name == "PartiallyActive")
+            {
+              return ScalingStatusCode::PartiallyActive;
+            }
+            break;
+          case Active_HASH:
+            if (name == "Active")
+            {
+              return ScalingStatusCode::Active;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ScalingStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForScalingStatusCode(ScalingStatusCode enumValue)
+        const char* GetNameForScalingStatusCode(ScalingStatusCode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
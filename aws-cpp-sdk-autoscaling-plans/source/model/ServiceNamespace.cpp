@@ -30,35 +30,51 @@ namespace Aws
       namespace ServiceNamespaceMapper
       {
 
-        static const int autoscaling_HASH = HashingUtils::HashString("autoscaling");
-        static const int ecs_HASH = HashingUtils::HashString("ecs");
-        static const int ec2_HASH = HashingUtils::HashString("ec2");
-        static const int rds_HASH = HashingUtils::HashString("rds");
-        static const int dynamodb_HASH = HashingUtils::HashString("dynamodb");
+        static constexpr int autoscaling_HASH = HashingUtils::CompileTimeHashString("autoscaling");
+        static constexpr int ecs_HASH = HashingUtils::CompileTimeHashString("ecs");
+        static constexpr int ec2_HASH = HashingUtils::CompileTimeHashString("ec2");
+        static constexpr int rds_HASH = HashingUtils::CompileTimeHashString("rds");
+        static constexpr int dynamodb_HASH = HashingUtils::CompileTimeHashString("dynamodb");
 
 
         ServiceNamespace GetServiceNamespaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == autoscaling_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServiceNamespace::autoscaling;
-          }
-          else if (hashCode == ecs_HASH)
-          {
-            return ServiceNamespace::ecs;
-          }
-          else if (hashCode == ec2_HASH)
-          {
-            return ServiceNamespace::ec2;
-          }
-          else if (hashCode == rds_HASH)
-          {
-            return ServiceNamespace::rds;
-          }
-          else if (hashCode == dynamodb_HASH)
-          {
-            return ServiceNamespace::dynamodb;
+          case autoscaling_HASH:
+            if (name == "autoscaling")
+            {
+              return ServiceNamespace::autoscaling;
+            }
+            break;
+          case ecs_HASH:
+            if (name == "ecs")
+            {
+              return ServiceNamespace::ecs;
+            }
+            break;
+          case ec2_HASH:
+            if (name == "ec2")
+            {
+              return ServiceNamespace::ec2;
+            }
+            break;
+          case rds_HASH:
+            if (name == "rds")
+            {
+              return ServiceNamespace::rds;
+            }
+            break;
+          case dynamodb_HASH:
+            if (name == "dynamodb")
+            {
+              return ServiceNamespace::dynamodb;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ServiceNamespace::NOT_SET;
         }
 
-        Aws::String GetNameForServiceNamespace(ServiceNamespace enumValue)
+        const char* GetNameForServiceNamespace(ServiceNamespace enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
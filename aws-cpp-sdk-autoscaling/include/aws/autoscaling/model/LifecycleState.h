@@ -45,7 +45,8 @@ namespace LifecycleStateMapper
 {
 AWS_AUTOSCALING_API LifecycleState GetLifecycleStateForName(const Aws::String& name);
 
-AWS_AUTOSCALING_API Aws::String GetNameForLifecycleState(LifecycleState value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALING_API const char* GetNameForLifecycleState(LifecycleState value);
 } // namespace LifecycleStateMapper
 } // namespace Model
 } // namespace AutoScaling
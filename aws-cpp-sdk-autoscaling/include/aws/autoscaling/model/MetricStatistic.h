@@ -37,7 +37,8 @@ namespace MetricStatisticMapper
 {
 AWS_AUTOSCALING_API MetricStatistic GetMetricStatisticForName(const Aws::String& name);
 
-AWS_AUTOSCALING_API Aws::String GetNameForMetricStatistic(MetricStatistic value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALING_API const char* GetNameForMetricStatistic(MetricStatistic value);
 } // namespace MetricStatisticMapper
 } // namespace Model
 } // namespace AutoScaling
@@ -36,7 +36,8 @@ namespace MetricTypeMapper
 {
 AWS_AUTOSCALING_API MetricType GetMetricTypeForName(const Aws::String& name);
 
-AWS_AUTOSCALING_API Aws::String GetNameForMetricType(MetricType value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALING_API const char* GetNameForMetricType(MetricType value);
 } // namespace MetricTypeMapper
 } // namespace Model
 } // namespace AutoScaling
@@ -44,7 +44,8 @@ namespace ScalingActivityStatusCodeMapper
 {
 AWS_AUTOSCALING_API ScalingActivityStatusCode GetScalingActivityStatusCodeForName(const Aws::String& name);
 
-AWS_AUTOSCALING_API Aws::String GetNameForScalingActivityStatusCode(ScalingActivityStatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_AUTOSCALING_API const char* GetNameForScalingActivityStatusCode(ScalingActivityStatusCode value);
 } // namespace ScalingActivityStatusCodeMapper
 } // namespace Model
 } // namespace AutoScaling
@@ -28,13 +28,13 @@ namespace AutoScaling
 namespace AutoScalingErrorMapper
 {
 
-static const int SCALING_ACTIVITY_IN_PROGRESS_FAULT_HASH = HashingUtils::HashString("ScalingActivityInProgress");
-static const int RESOURCE_CONTENTION_FAULT_HASH = HashingUtils::HashString("ResourceContention");
-static const int ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("AlreadyExists");
-static const int RESOURCE_IN_USE_FAULT_HASH = HashingUtils::HashString("ResourceInUse");
-static const int LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::HashString("LimitExceeded");
-static const int SERVICE_LINKED_ROLE_FAILURE_HASH = HashingUtils::HashString("ServiceLinkedRoleFailure");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextToken");
+static constexpr int SCALING_ACTIVITY_IN_PROGRESS_FAULT_HASH = HashingUtils::CompileTimeHashString("ScalingActivityInProgress");
+static constexpr int RESOURCE_CONTENTION_FAULT_HASH = HashingUtils::CompileTimeHashString("ResourceContention");
+static constexpr int ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("AlreadyExists");
+static constexpr int RESOURCE_IN_USE_FAULT_HASH = HashingUtils::CompileTimeHashString("ResourceInUse");
+static constexpr int LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("LimitExceeded");
+static constexpr int SERVICE_LINKED_ROLE_FAILURE_HASH = HashingUtils::CompileTimeHashString("ServiceLinkedRoleFailure");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextToken");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,75 +30,107 @@ namespace Aws
       namespace LifecycleStateMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Pending_Wait_HASH = HashingUtils::HashString("Pending:Wait");
-        static const int Pending_Proceed_HASH = HashingUtils::HashString("Pending:Proceed");
-        static const int Quarantined_HASH = HashingUtils::HashString("Quarantined");
-        static const int InService_HASH = HashingUtils::HashString("InService");
-        static const int Terminating_HASH = HashingUtils::HashString("Terminating");
-        static const int Terminating_Wait_HASH = HashingUtils::HashString("Terminating:Wait");
-        static const int Terminating_Proceed_HASH = HashingUtils::HashString("Terminating:Proceed");
-        static const int Terminated_HASH = HashingUtils::HashString("Terminated");
-        static const int Detaching_HASH = HashingUtils::HashString("Detaching");
-        static const int Detached_HASH = HashingUtils::HashString("Detached");
-        static const int EnteringStandby_HASH = HashingUtils::HashString("EnteringStandby");
-        static const int Standby_HASH = HashingUtils::HashString("Standby");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Pending_Wait_HASH = HashingUtils::CompileTimeHashString("Pending:Wait");
+        static constexpr int Pending_Proceed_HASH = HashingUtils::CompileTimeHashString("Pending:Proceed");
+        static constexpr int Quarantined_HASH = HashingUtils::CompileTimeHashString("Quarantined");
+        static constexpr int InService_HASH = HashingUtils::CompileTimeHashString("InService");
+        static constexpr int Terminating_HASH = HashingUtils::CompileTimeHashString("Terminating");
+        static constexpr int Terminating_Wait_HASH = HashingUtils::CompileTimeHashString("Terminating:Wait");
+        static constexpr int Terminating_Proceed_HASH = HashingUtils::CompileTimeHashString("Terminating:Proceed");
+        static constexpr int Terminated_HASH = HashingUtils::CompileTimeHashString("Terminated");
+        static constexpr int Detaching_HASH = HashingUtils::CompileTimeHashString("Detaching");
+        static constexpr int Detached_HASH = HashingUtils::CompileTimeHashString("Detached");
+        static constexpr int EnteringStandby_HASH = HashingUtils::CompileTimeHashString("EnteringStandby");
+        static constexpr int Standby_HASH = HashingUtils::CompileTimeHashString("Standby");
 
 
         LifecycleState GetLifecycleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LifecycleState::Pending;
-          }
-          else if (hashCode == Pending_Wait_HASH)
-          {
-            return LifecycleState::Pending_Wait;
-          }
-          else if (hashCode == Pending_Proceed_HASH)
-          {
-            return LifecycleState::Pending_Proceed;
-          }
-          else if (hashCode == Quarantined_HASH)
-          {
-            return LifecycleState::Quarantined;
-          }
-          else if (hashCode == InService_HASH)
-          {
-            return LifecycleState::InService;
-          }
-          else if (hashCode == Terminating_HASH)
-          {
-            return LifecycleState::Terminating;
-          }
-          else if (hashCode == Terminating_Wait_HASH)
-          {
-            return LifecycleState::Terminating_Wait;
-          }
-          else if (hashCode == Terminating_Proceed_HASH)
-          {
-            return LifecycleState::Terminating_Proceed;
-          }
-          else if (hashCode == Terminated_HASH)
-          {
-            return LifecycleState::Terminated;
-          }
-          else if (hashCode == Detaching_HASH)
-          {
-            return LifecycleState::Detaching;
-          }
-          else if (hashCode == Detached_HASH)
-          {
-            return LifecycleState::Detached;
-          }
-          else if (hashCode == EnteringStandby_HASH)
-          {
-            return LifecycleState::EnteringStandby;
-          }
-          else if (hashCode == Standby_HASH)
-          {
-            return LifecycleState::Standby;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return LifecycleState::Pending;
+            }
+            break;
+          case Pending_Wait_HASH:
+            if (name == "Pending:Wait")
+            {
+              return LifecycleState::Pending_Wait;
+            }
+            break;
+          case Pending_Proceed_HASH:
+            if (name == "Pending:Proceed")
+            {
+              return LifecycleState::Pending_Proceed;
+            }
+            break;
+          case Quarantined_HASH:
+            if (name == "Quarantined")
+            {
+              return LifecycleState::Quarantined;
+            }
+            break;
+          case InService_HASH:
+            if (name == "InService")
+            {
+              return LifecycleState::InService;
+            }
+            break;
+          case Terminating_HASH:
+            if (name == "Terminating")
+            {
+              return LifecycleState::Terminating;
+            }
+            break;
+          case Terminating_Wait_HASH:
+            if (name == "Terminating:Wait")
+            {
+              return LifecycleState::Terminating_Wait;
+            }
+            break;
+          case Terminating_Proceed_HASH:
+            if (name == "Terminating:Proceed")
+            {
+              return LifecycleState::Terminating_Proceed;
+            }
+            break;
+          case Terminated_HASH:
+            if (name == "Terminated")
+            {
+              return LifecycleState::Terminated;
+            }
+            break;
+          case Detaching_HASH:
+            if (name == "Detaching")
+            {
+              return LifecycleState::Detaching;
+            }
+            break;
+          case Detached_HASH:
+            if (name == "Detached")
+            {
+              return LifecycleState::Detached;
+            }
+            break;
+          case EnteringStandby_HASH:
+            if (name == "EnteringStandby")
+            {
+              return LifecycleState::EnteringStandby;
+            }
+            break;
+          case Standby_HASH:
+            if (name == "Standby")
+            {
+              return LifecycleState::Standby;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,7 +142,7 @@ namespace Aws
           return LifecycleState::NOT_SET;
         }
 
-        Aws::String GetNameForLifecycleState(LifecycleState enumValue)
+        const char* GetNameForLifecycleState(LifecycleState enumValue)
         {
           switch(enumValue)
           {
@@ -144,7 +176,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
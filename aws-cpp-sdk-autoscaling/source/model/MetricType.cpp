@@ -30,30 +30,44 @@ namespace Aws
       namespace MetricTypeMapper
       {
 
-        static const int ASGAverageCPUUtilization_HASH = HashingUtils::HashString("ASGAverageCPUUtilization");
-        static const int ASGAverageNetworkIn_HASH = HashingUtils::HashString("ASGAverageNetworkIn");
-        static const int ASGAverageNetworkOut_HASH = HashingUtils::HashString("ASGAverageNetworkOut");
-        static const int ALBRequestCountPerTarget_HASH = HashingUtils::HashString("ALBRequestCountPerTarget");
+        static constexpr int ASGAverageCPUUtilization_HASH = HashingUtils::CompileTimeHashString("ASGAverageCPUUtilization");
+        static constexpr int ASGAverageNetworkIn_HASH = HashingUtils::CompileTimeHashString("ASGAverageNetworkIn");
+        static constexpr int ASGAverageNetworkOut_HASH = HashingUtils::CompileTimeHashString("ASGAverageNetworkOut");
+        static constexpr int ALBRequestCountPerTarget_HASH = HashingUtils::CompileTimeHashString("ALBRequestCountPerTarget");
 
 
         MetricType GetMetricTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASGAverageCPUUtilization_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MetricType::ASGAverageCPUUtilization;
-          }
-          else if (hashCode == ASGAverageNetworkIn_HASH)
-          {
-            return MetricType::ASGAverageNetworkIn;
-          }
-          else if (hashCode == ASGAverageNetworkOut_HASH)
-          {
-            return MetricType::ASGAverageNetworkOut;
-          }
-          else if (hashCode == ALBRequestCountPerTarget_HASH)
-          {
-            return MetricType::ALBRequestCountPerTarget;
+          case ASGAverageCPUUtilization_HASH:
+            if (name == "ASGAverageCPUUtilization")
+            {
+              return MetricType::ASGAverageCPUUtilization;
+            }
+            break;
+          case ASGAverageNetworkIn_HASH:
+            if (name == "ASGAverageNetworkIn")
+            {
+              return MetricType::ASGAverageNetworkIn;
+            }
+            break;
+          case ASGAverageNetworkOut_HASH:
+            if (name == "ASGAverageNetworkOut")
+            {
+              return MetricType::ASGAverageNetworkOut;
+            }
+            break;
+          case ALBRequestCountPerTarget_HASH:
+            if (name == "ALBRequestCountPerTarget")
+            {
+              return MetricType::ALBRequestCountPerTarget;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return MetricType::NOT_SET;
         }
 
-        Aws::String GetNameForMetricType(MetricType enumValue)
+        const char* GetNameForMetricType(MetricType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,70 +30,100 @@ namespace Aws
       namespace ScalingActivityStatusCodeMapper
       {
 
-        static const int PendingSpotBidPlacement_HASH = HashingUtils::HashString("PendingSpotBidPlacement");
-        static const int WaitingForSpotInstanceRequestId_HASH = HashingUtils::HashString("WaitingForSpotInstanceRequestId");
-        static const int WaitingForSpotInstanceId_HASH = HashingUtils::HashString("WaitingForSpotInstanceId");
-        static const int WaitingForInstanceId_HASH = HashingUtils::HashString("WaitingForInstanceId");
-        static const int PreInService_HASH = HashingUtils::HashString("PreInService");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int WaitingForELBConnectionDraining_HASH = HashingUtils::HashString("WaitingForELBConnectionDraining");
-        static const int MidLifecycleAction_HASH = HashingUtils::HashString("MidLifecycleAction");
-        static const int WaitingForInstanceWarmup_HASH = HashingUtils::HashString("WaitingForInstanceWarmup");
-        static const int Successful_HASH = HashingUtils::HashString("Successful");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
+        static constexpr int PendingSpotBidPlacement_HASH = HashingUtils::CompileTimeHashString("PendingSpotBidPlacement");
+        static constexpr int WaitingForSpotInstanceRequestId_HASH = HashingUtils::CompileTimeHashString("WaitingForSpotInstanceRequestId");
+        static constexpr int WaitingForSpotInstanceId_HASH = HashingUtils::CompileTimeHashString("WaitingForSpotInstanceId");
+        static constexpr int WaitingForInstanceId_HASH = HashingUtils::CompileTimeHashString("WaitingForInstanceId");
+        static constexpr int PreInService_HASH = HashingUtils::CompileTimeHashString("PreInService");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int WaitingForELBConnectionDraining_HASH = HashingUtils::CompileTimeHashString("WaitingForELBConnectionDraining");
+        static constexpr int MidLifecycleAction_HASH = HashingUtils::CompileTimeHashString("MidLifecycleAction");
+        static constexpr int WaitingForInstanceWarmup_HASH = HashingUtils::CompileTimeHashString("WaitingForInstanceWarmup");
+        static constexpr int Successful_HASH = HashingUtils::CompileTimeHashString("Successful");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
 
 
         ScalingActivityStatusCode GetScalingActivityStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PendingSpotBidPlacement_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalingActivityStatusCode::PendingSpotBidPlacement;
-          }
-          else if (hashCode == WaitingForSpotInstanceRequestId_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForSpotInstanceRequestId;
-          }
-          else if (hashCode == WaitingForSpotInstanceId_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForSpotInstanceId;
-          }
-          else if (hashCode == WaitingForInstanceId_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForInstanceId;
-          }
-          else if (hashCode == PreInService_HASH)
-          {
-            return ScalingActivityStatusCode::PreInService;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return ScalingActivityStatusCode::InProgress;
-          }
-          else if (hashCode == WaitingForELBConnectionDraining_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForELBConnectionDraining;
-          }
-          else if (hashCode == MidLifecycleAction_HASH)
-          {
-            return ScalingActivityStatusCode::MidLifecycleAction;
-          }
-          else if (hashCode == WaitingForInstanceWarmup_HASH)
-          {
-            return ScalingActivityStatusCode::WaitingForInstanceWarmup;
-          }
-          else if (hashCode == Successful_HASH)
-          {
-            return ScalingActivityStatusCode::Successful;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ScalingActivityStatusCode::Failed;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return ScalingActivityStatusCode::Cancelled;
+          case PendingSpotBidPlacement_HASH:
+            if (name == "PendingSpotBidPlacement")
+            {
+              return ScalingActivityStatusCode::PendingSpotBidPlacement;
+            }
+            break;
+          case WaitingForSpotInstanceRequestId_HASH:
+            if (name == "WaitingForSpotInstanceRequestId")
+            {
+              return ScalingActivityStatusCode::WaitingForSpotInstanceRequestId;
+            }
+            break;
+          case WaitingForSpotInstanceId_HASH:
+            if (name == "WaitingForSpotInstanceId")
+            {
+              return ScalingActivityStatusCode::WaitingForSpotInstanceId;
+            }
+            break;
+          case WaitingForInstanceId_HASH:
+            if (name == "WaitingForInstanceId")
+            {
+              return ScalingActivityStatusCode::WaitingForInstanceId;
+            }
+            break;
+          case PreInService_HASH:
+            if (name == "PreInService")
+            {
+              return ScalingActivityStatusCode::PreInService;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return ScalingActivityStatusCode::InProgress;
+            }
+            break;
+          case WaitingForELBConnectionDraining_HASH:
+            if (name == "WaitingForELBConnectionDraining")
+            {
+              return ScalingActivityStatusCode::WaitingForELBConnectionDraining;
+            }
+            break;
+          case MidLifecycleAction_HASH:
+            if (name == "MidLifecycleAction")
+            {
+              return ScalingActivityStatusCode::MidLifecycleAction;
+            }
+            break;
+          case WaitingForInstanceWarmup_HASH:
+            if (name == "WaitingForInstanceWarmup")
+            {
+              return ScalingActivityStatusCode::WaitingForInstanceWarmup;
+            }
+            break;
+          case Successful_HASH:
+            if (name == "Successful")
+            {
+              return ScalingActivityStatusCode::Successful;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return ScalingActivityStatusCode::Failed;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return ScalingActivityStatusCode::Cancelled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return ScalingActivityStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForScalingActivityStatusCode(ScalingActivityStatusCode enumValue)
+        const char* GetNameForScalingActivityStatusCode(ScalingActivityStatusCode enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace ArrayJobDependencyMapper
 {
 AWS_BATCH_API ArrayJobDependency GetArrayJobDependencyForName(const Aws::String& name);
 
-AWS_BATCH_API Aws::String GetNameForArrayJobDependency(ArrayJobDependency value);
+// names of values not modeled point into the enum overflow container
+AWS_BATCH_API const char* GetNameForArrayJobDependency(ArrayJobDependency value);
 } // namespace ArrayJobDependencyMapper
 } // namespace Model
 } // namespace Batch
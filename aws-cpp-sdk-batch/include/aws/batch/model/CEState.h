@@ -34,7 +34,8 @@ namespace CEStateMapper
 {
 AWS_BATCH_API CEState GetCEStateForName(const Aws::String& name);
 
-AWS_BATCH_API Aws::String GetNameForCEState(CEState value);
+// names of values not modeled point into the enum overflow container
+AWS_BATCH_API const char* GetNameForCEState(CEState value);
 } // namespace CEStateMapper
 } // namespace Model
 } // namespace Batch
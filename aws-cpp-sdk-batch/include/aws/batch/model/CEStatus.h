@@ -38,7 +38,8 @@ namespace CEStatusMapper
 {
 AWS_BATCH_API CEStatus GetCEStatusForName(const Aws::String& name);
 
-AWS_BATCH_API Aws::String GetNameForCEStatus(CEStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_BATCH_API const char* GetNameForCEStatus(CEStatus value);
 } // namespace CEStatusMapper
 } // namespace Model
 } // namespace Batch
@@ -34,7 +34,8 @@ namespace CETypeMapper
 {
 AWS_BATCH_API CEType GetCETypeForName(const Aws::String& name);
 
-AWS_BATCH_API Aws::String GetNameForCEType(CEType value);
+// names of values not modeled point into the enum overflow container
+AWS_BATCH_API const char* GetNameForCEType(CEType value);
 } // namespace CETypeMapper
 } // namespace Model
 } // namespace Batch
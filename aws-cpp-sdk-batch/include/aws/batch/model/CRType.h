@@ -34,7 +34,8 @@ namespace CRTypeMapper
 {
 AWS_BATCH_API CRType GetCRTypeForName(const Aws::String& name);
 
-AWS_BATCH_API Aws::String GetNameForCRType(CRType value);
+// names of values not modeled point into the enum overflow container
+AWS_BATCH_API const char* GetNameForCRType(CRType value);
 } // namespace CRTypeMapper
 } // namespace Model
 } // namespace Batch
@@ -34,7 +34,8 @@ namespace JQStateMapper
 {
 AWS_BATCH_API JQState GetJQStateForName(const Aws::String& name);
 
-AWS_BATCH_API Aws::String GetNameForJQState(JQState value);
+// names of values not modeled point into the enum overflow container
+AWS_BATCH_API const char* GetNameForJQState(JQState value);
 } // namespace JQStateMapper
 } // namespace Model
 } // namespace Batch
@@ -38,7 +38,8 @@ namespace JQStatusMapper
 {
 AWS_BATCH_API JQStatus GetJQStatusForName(const Aws::String& name);
 
-AWS_BATCH_API Aws::String GetNameForJQStatus(JQStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_BATCH_API const char* GetNameForJQStatus(JQStatus value);
 } // namespace JQStatusMapper
 } // namespace Model
 } // namespace Batch
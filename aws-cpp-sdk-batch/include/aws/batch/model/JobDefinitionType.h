@@ -33,7 +33,8 @@ namespace JobDefinitionTypeMapper
 {
 AWS_BATCH_API JobDefinitionType GetJobDefinitionTypeForName(const Aws::String& name);
 
-AWS_BATCH_API Aws::String GetNameForJobDefinitionType(JobDefinitionType value);
+// names of values not modeled point into the enum overflow container
+AWS_BATCH_API const char* GetNameForJobDefinitionType(JobDefinitionType value);
 } // namespace JobDefinitionTypeMapper
 } // namespace Model
 } // namespace Batch
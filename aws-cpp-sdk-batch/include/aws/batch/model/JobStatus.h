@@ -39,7 +39,8 @@ namespace JobStatusMapper
 {
 AWS_BATCH_API JobStatus GetJobStatusForName(const Aws::String& name);
 
-AWS_BATCH_API Aws::String GetNameForJobStatus(JobStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_BATCH_API const char* GetNameForJobStatus(JobStatus value);
 } // namespace JobStatusMapper
 } // namespace Model
 } // namespace Batch
@@ -28,8 +28,8 @@ namespace Batch
 namespace BatchErrorMapper
 {
 
-static const int SERVER_HASH = HashingUtils::HashString("ServerException");
-static const int CLIENT_HASH = HashingUtils::HashString("ClientException");
+static constexpr int SERVER_HASH = HashingUtils::CompileTimeHashString("ServerException");
+static constexpr int CLIENT_HASH = HashingUtils::CompileTimeHashString("ClientException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace ArrayJobDependencyMapper
       {
 
-        static const int N_TO_N_HASH = HashingUtils::HashString("N_TO_N");
-        static const int SEQUENTIAL_HASH = HashingUtils::HashString("SEQUENTIAL");
+        static constexpr int N_TO_N_HASH = HashingUtils::CompileTimeHashString("N_TO_N");
+        static constexpr int SEQUENTIAL_HASH = HashingUtils::CompileTimeHashString("SEQUENTIAL");
 
 
         ArrayJobDependency GetArrayJobDependencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == N_TO_N_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ArrayJobDependency::N_TO_N;
-          }
-          else if (hashCode == SEQUENTIAL_HASH)
-          {
-            return ArrayJobDependency::SEQUENTIAL;
+          case N_TO_N_HASH:
+            if (name == "N_TO_N")
+            {
+              return ArrayJobDependency::N_TO_N;
+            }
+            break;
+          case SEQUENTIAL_HASH:
+            if (name == "SEQUENTIAL")
+            {
+              return ArrayJobDependency::SEQUENTIAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ArrayJobDependency::NOT_SET;
         }
 
-        Aws::String GetNameForArrayJobDependency(ArrayJobDependency enumValue)
+        const char* GetNameForArrayJobDependency(ArrayJobDependency enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
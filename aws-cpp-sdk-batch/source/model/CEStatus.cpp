@@ -30,40 +30,58 @@ namespace Aws
       namespace CEStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int VALID_HASH = HashingUtils::HashString("VALID");
-        static const int INVALID_HASH = HashingUtils::HashString("INVALID");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
+        static constexpr int VALID_HASH = HashingUtils::CompileTimeHashString("VALID");
+        static constexpr int INVALID_HASH = HashingUtils::CompileTimeHashString("INVALID");
 
 
         CEStatus GetCEStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CEStatus::CREATING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return CEStatus::UPDATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return CEStatus::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return CEStatus::DELETED;
-          }
-          else if (hashCode == VALID_HASH)
-          {
-            return CEStatus::VALID;
-          }
-          else if (hashCode == INVALID_HASH)
-          {
-            return CEStatus::INVALID;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return CEStatus::CREATING;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return CEStatus::UPDATING;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return CEStatus::DELETING;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return CEStatus::DELETED;
+            }
+            break;
+          case VALID_HASH:
+            if (name == "VALID")
+            {
+              return CEStatus::VALID;
+            }
+            break;
+          case INVALID_HASH:
+            if (name == "INVALID")
+            {
+              return CEStatus::INVALID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return CEStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCEStatus(CEStatus enumValue)
+        const char* GetNameForCEStatus(CEStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
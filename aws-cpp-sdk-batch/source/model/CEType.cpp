@@ -30,20 +30,30 @@ namespace Aws
       namespace CETypeMapper
       {
 
-        static const int MANAGED_HASH = HashingUtils::HashString("MANAGED");
-        static const int UNMANAGED_HASH = HashingUtils::HashString("UNMANAGED");
+        static constexpr int MANAGED_HASH = HashingUtils::CompileTimeHashString("MANAGED");
+        static constexpr int UNMANAGED_HASH = HashingUtils::CompileTimeHashString("UNMANAGED");
 
 
         CEType GetCETypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MANAGED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CEType::MANAGED;
-          }
-          else if (hashCode == UNMANAGED_HASH)
-          {
-            return CEType::UNMANAGED;
+          case MANAGED_HASH:
+            if (name == "MANAGED")
+            {
+              return CEType::MANAGED;
+            }
+            break;
+          case UNMANAGED_HASH:
+            if (name == "UNMANAGED")
+            {
+              return CEType::UNMANAGED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CEType::NOT_SET;
         }
 
-        Aws::String GetNameForCEType(CEType enumValue)
+        const char* GetNameForCEType(CEType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace CRTypeMapper
       {
 
-        static const int EC2_HASH = HashingUtils::HashString("EC2");
-        static const int SPOT_HASH = HashingUtils::HashString("SPOT");
+        static constexpr int EC2_HASH = HashingUtils::CompileTimeHashString("EC2");
+        static constexpr int SPOT_HASH = HashingUtils::CompileTimeHashString("SPOT");
 
 
         CRType GetCRTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EC2_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CRType::EC2;
-          }
-          else if (hashCode == SPOT_HASH)
-          {
-            return CRType::SPOT;
+          case EC2_HASH:
+            if (name == "EC2")
+            {
+              return CRType::EC2;
+            }
+            break;
+          case SPOT_HASH:
+            if (name == "SPOT")
+            {
+              return CRType::SPOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CRType::NOT_SET;
         }
 
-        Aws::String GetNameForCRType(CRType enumValue)
+        const char* GetNameForCRType(CRType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace JobDefinitionTypeMapper
       {
 
-        static const int container_HASH = HashingUtils::HashString("container");
+        static constexpr int container_HASH = HashingUtils::CompileTimeHashString("container");
 
 
         JobDefinitionType GetJobDefinitionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == container_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobDefinitionType::container;
+          case container_HASH:
+            if (name == "container")
+            {
+              return JobDefinitionType::container;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return JobDefinitionType::NOT_SET;
         }
 
-        Aws::String GetNameForJobDefinitionType(JobDefinitionType enumValue)
+        const char* GetNameForJobDefinitionType(JobDefinitionType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
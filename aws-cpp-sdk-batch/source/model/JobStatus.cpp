@@ -30,45 +30,65 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNABLE_HASH = HashingUtils::HashString("RUNNABLE");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int SUBMITTED_HASH = HashingUtils::CompileTimeHashString("SUBMITTED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int RUNNABLE_HASH = HashingUtils::CompileTimeHashString("RUNNABLE");
+        static constexpr int STARTING_HASH = HashingUtils::CompileTimeHashString("STARTING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobStatus::SUBMITTED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return JobStatus::PENDING;
-          }
-          else if (hashCode == RUNNABLE_HASH)
-          {
-            return JobStatus::RUNNABLE;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return JobStatus::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return JobStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return JobStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobStatus::FAILED;
+          case SUBMITTED_HASH:
+            if (name == "SUBMITTED")
+            {
+              return JobStatus::SUBMITTED;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return JobStatus::PENDING;
+            }
+            break;
+          case RUNNABLE_HASH:
+            if (name == "RUNNABLE")
+            {
+              return JobStatus::RUNNABLE;
+            }
+            break;
+          case STARTING_HASH:
+            if (name == "STARTING")
+            {
+              return JobStatus::STARTING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return JobStatus::RUNNING;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return JobStatus::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return JobStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatus(JobStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -36,7 +36,8 @@ namespace BudgetTypeMapper
 {
 AWS_BUDGETS_API BudgetType GetBudgetTypeForName(const Aws::String& name);
 
-AWS_BUDGETS_API Aws::String GetNameForBudgetType(BudgetType value);
+// names of values not modeled point into the enum overflow container
+AWS_BUDGETS_API const char* GetNameForBudgetType(BudgetType value);
 } // namespace BudgetTypeMapper
 } // namespace Model
 } // namespace Budgets
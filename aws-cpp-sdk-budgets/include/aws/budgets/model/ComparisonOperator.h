@@ -35,7 +35,8 @@ namespace ComparisonOperatorMapper
 {
 AWS_BUDGETS_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
-AWS_BUDGETS_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_BUDGETS_API const char* GetNameForComparisonOperator(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace Budgets
@@ -34,7 +34,8 @@ namespace SubscriptionTypeMapper
 {
 AWS_BUDGETS_API SubscriptionType GetSubscriptionTypeForName(const Aws::String& name);
 
-AWS_BUDGETS_API Aws::String GetNameForSubscriptionType(SubscriptionType value);
+// names of values not modeled point into the enum overflow container
+AWS_BUDGETS_API const char* GetNameForSubscriptionType(SubscriptionType value);
 } // namespace SubscriptionTypeMapper
 } // namespace Model
 } // namespace Budgets
@@ -34,7 +34,8 @@ namespace ThresholdTypeMapper
 {
 AWS_BUDGETS_API ThresholdType GetThresholdTypeForName(const Aws::String& name);
 
-AWS_BUDGETS_API Aws::String GetNameForThresholdType(ThresholdType value);
+// names of values not modeled point into the enum overflow container
+AWS_BUDGETS_API const char* GetNameForThresholdType(ThresholdType value);
 } // namespace ThresholdTypeMapper
 } // namespace Model
 } // namespace Budgets
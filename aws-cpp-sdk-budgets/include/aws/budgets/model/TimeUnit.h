@@ -36,7 +36,8 @@ namespace TimeUnitMapper
 {
 AWS_BUDGETS_API TimeUnit GetTimeUnitForName(const Aws::String& name);
 
-AWS_BUDGETS_API Aws::String GetNameForTimeUnit(TimeUnit value);
+// names of values not modeled point into the enum overflow container
+AWS_BUDGETS_API const char* GetNameForTimeUnit(TimeUnit value);
 } // namespace TimeUnitMapper
 } // namespace Model
 } // namespace Budgets
@@ -28,13 +28,13 @@ namespace Budgets
 namespace BudgetsErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int DUPLICATE_RECORD_HASH = HashingUtils::HashString("DuplicateRecordException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int CREATION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("CreationLimitExceededException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int EXPIRED_NEXT_TOKEN_HASH = HashingUtils::HashString("ExpiredNextTokenException");
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalErrorException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int DUPLICATE_RECORD_HASH = HashingUtils::CompileTimeHashString("DuplicateRecordException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int CREATION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CreationLimitExceededException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int EXPIRED_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("ExpiredNextTokenException");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalErrorException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
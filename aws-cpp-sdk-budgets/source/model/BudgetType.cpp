@@ -30,30 +30,44 @@ namespace Aws
       namespace BudgetTypeMapper
       {
 
-        static const int USAGE_HASH = HashingUtils::HashString("USAGE");
-        static const int COST_HASH = HashingUtils::HashString("COST");
-        static const int RI_UTILIZATION_HASH = HashingUtils::HashString("RI_UTILIZATION");
-        static const int RI_COVERAGE_HASH = HashingUtils::HashString("RI_COVERAGE");
+        static constexpr int USAGE_HASH = HashingUtils::CompileTimeHashString("USAGE");
+        static constexpr int COST_HASH = HashingUtils::CompileTimeHashString("COST");
+        static constexpr int RI_UTILIZATION_HASH = HashingUtils::CompileTimeHashString("RI_UTILIZATION");
+        static constexpr int RI_COVERAGE_HASH = HashingUtils::CompileTimeHashString("RI_COVERAGE");
 
 
         BudgetType GetBudgetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USAGE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BudgetType::USAGE;
-          }
-          else if (hashCode == COST_HASH)
-          {
-            return BudgetType::COST;
-          }
-          else if (hashCode == RI_UTILIZATION_HASH)
-          {
-            return BudgetType::RI_UTILIZATION;
-          }
-          else if (hashCode == RI_COVERAGE_HASH)
-          {
-            return BudgetType::RI_COVERAGE;
+          case USAGE_HASH:
+            if (name == "USAGE")
+            {
+              return BudgetType::USAGE;
+            }
+            break;
+          case COST_HASH:
+            if (name == "COST")
+            {
+              return BudgetType::COST;
+            }
+            break;
+          case RI_UTILIZATION_HASH:
+            if (name == "RI_UTILIZATION")
+            {
+              return BudgetType::RI_UTILIZATION;
+            }
+            break;
+          case RI_COVERAGE_HASH:
+            if (name == "RI_COVERAGE")
+            {
+              return BudgetType::RI_COVERAGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return BudgetType::NOT_SET;
         }
 
-        Aws::String GetNameForBudgetType(BudgetType enumValue)
+        const char* GetNameForBudgetType(BudgetType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int EQUAL_TO_HASH = HashingUtils::HashString("EQUAL_TO");
+        static constexpr int GREATER_THAN_HASH = HashingUtils::CompileTimeHashString("GREATER_THAN");
+        static constexpr int LESS_THAN_HASH = HashingUtils::CompileTimeHashString("LESS_THAN");
+        static constexpr int EQUAL_TO_HASH = HashingUtils::CompileTimeHashString("EQUAL_TO");
 
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GREATER_THAN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComparisonOperator::GREATER_THAN;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
-            return ComparisonOperator::LESS_THAN;
-          }
-          else if (hashCode == EQUAL_TO_HASH)
-          {
-            return ComparisonOperator::EQUAL_TO;
+          case GREATER_THAN_HASH:
+            if (name == "GREATER_THAN")
+            {
+              return ComparisonOperator::GREATER_THAN;
+            }
+            break;
+          case LESS_THAN_HASH:
+            if (name == "LESS_THAN")
+            {
+              return ComparisonOperator::LESS_THAN;
+            }
+            break;
+          case EQUAL_TO_HASH:
+            if (name == "EQUAL_TO")
+            {
+              return ComparisonOperator::EQUAL_TO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperator(ComparisonOperator enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
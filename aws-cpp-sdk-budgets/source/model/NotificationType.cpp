@@ -30,20 +30,30 @@ namespace Aws
       namespace NotificationTypeMapper
       {
 
-        static const int ACTUAL_HASH = HashingUtils::HashString("ACTUAL");
-        static const int FORECASTED_HASH = HashingUtils::HashString("FORECASTED");
+        static constexpr int ACTUAL_HASH = HashingUtils::CompileTimeHashString("ACTUAL");
+        static constexpr int FORECASTED_HASH = HashingUtils::CompileTimeHashString("FORECASTED");
 
 
         NotificationType GetNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTUAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotificationType::ACTUAL;
-          }
-          else if (hashCode == FORECASTED_HASH)
-          {
-            return NotificationType::FORECASTED;
+          case ACTUAL_HASH:
+            if (name == "ACTUAL")
+            {
+              return NotificationType::ACTUAL;
+            }
+            break;
+          case FORECASTED_HASH:
+            if (name == "FORECASTED")
+            {
+              return NotificationType::FORECASTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return NotificationType::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationType(NotificationType enumValue)
+        const char* GetNameForNotificationType(NotificationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SubscriptionTypeMapper
       {
 
-        static const int SNS_HASH = HashingUtils::HashString("SNS");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
+        static constexpr int SNS_HASH = HashingUtils::CompileTimeHashString("SNS");
+        static constexpr int EMAIL_HASH = HashingUtils::CompileTimeHashString("EMAIL");
 
 
         SubscriptionType GetSubscriptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SNS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SubscriptionType::SNS;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
-            return SubscriptionType::EMAIL;
+          case SNS_HASH:
+            if (name == "SNS")
+            {
+              return SubscriptionType::SNS;
+            }
+            break;
+          case EMAIL_HASH:
+            if (name == "EMAIL")
+            {
+              return SubscriptionType::EMAIL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SubscriptionType::NOT_SET;
         }
 
-        Aws::String GetNameForSubscriptionType(SubscriptionType enumValue)
+        const char* GetNameForSubscriptionType(SubscriptionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ThresholdTypeMapper
       {
 
-        static const int PERCENTAGE_HASH = HashingUtils::HashString("PERCENTAGE");
-        static const int ABSOLUTE_VALUE_HASH = HashingUtils::HashString("ABSOLUTE_VALUE");
+        static constexpr int PERCENTAGE_HASH = HashingUtils::CompileTimeHashString("PERCENTAGE");
+        static constexpr int ABSOLUTE_VALUE_HASH = HashingUtils::CompileTimeHashString("ABSOLUTE_VALUE");
 
 
         ThresholdType GetThresholdTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PERCENTAGE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ThresholdType::PERCENTAGE;
-          }
-          else if (hashCode == ABSOLUTE_VALUE_HASH)
-          {
-            return ThresholdType::ABSOLUTE_VALUE;
+          case PERCENTAGE_HASH:
+            if (name == "PERCENTAGE")
+            {
+              return ThresholdType::PERCENTAGE;
+            }
+            break;
+          case ABSOLUTE_VALUE_HASH:
+            if (name == "ABSOLUTE_VALUE")
+            {
+              return ThresholdType::ABSOLUTE_VALUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ThresholdType::NOT_SET;
         }
 
-        Aws::String GetNameForThresholdType(ThresholdType enumValue)
+        const char* GetNameForThresholdType(ThresholdType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace TimeUnitMapper
       {
 
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
-        static const int QUARTERLY_HASH = HashingUtils::HashString("QUARTERLY");
-        static const int ANNUALLY_HASH = HashingUtils::HashString("ANNUALLY");
+        static constexpr int DAILY_HASH = HashingUtils::CompileTimeHashString("DAILY");
+        static constexpr int MONTHLY_HASH = HashingUtils::CompileTimeHashString("MONTHLY");
+        static constexpr int QUARTERLY_HASH = HashingUtils::CompileTimeHashString("QUARTERLY");
+        static constexpr int ANNUALLY_HASH = HashingUtils::CompileTimeHashString("ANNUALLY");
 
 
         TimeUnit GetTimeUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAILY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TimeUnit::DAILY;
-          }
-          else if (hashCode == MONTHLY_HASH)
-          {
-            return TimeUnit::MONTHLY;
-          }
-          else if (hashCode == QUARTERLY_HASH)
-          {
-            return TimeUnit::QUARTERLY;
-          }
-          else if (hashCode == ANNUALLY_HASH)
-          {
-            return TimeUnit::ANNUALLY;
+          case DAILY_HASH:
+            if (name == "DAILY")
+            {
+              return TimeUnit::DAILY;
+            }
+            break;
+          case MONTHLY_HASH:
+            if (name == "MONTHLY")
+            {
+              return TimeUnit::MONTHLY;
+            }
+            break;
+          case QUARTERLY_HASH:
+            if (name == "QUARTERLY")
+            {
+              return TimeUnit::QUARTERLY;
+            }
+            break;
+          case ANNUALLY_HASH:
+            if (name == "ANNUALLY")
+            {
+              return TimeUnit::ANNUALLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return TimeUnit::NOT_SET;
         }
 
-        Aws::String GetNameForTimeUnit(TimeUnit enumValue)
+        const char* GetNameForTimeUnit(TimeUnit enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace AccountScopeMapper
 {
 AWS_COSTEXPLORER_API AccountScope GetAccountScopeForName(const Aws::String& name);
 
-AWS_COSTEXPLORER_API Aws::String GetNameForAccountScope(AccountScope value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTEXPLORER_API const char* GetNameForAccountScope(AccountScope value);
 } // namespace AccountScopeMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -34,7 +34,8 @@ namespace ContextMapper
 {
 AWS_COSTEXPLORER_API Context GetContextForName(const Aws::String& name);
 
-AWS_COSTEXPLORER_API Aws::String GetNameForContext(Context value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTEXPLORER_API const char* GetNameForContext(Context value);
 } // namespace ContextMapper
 } // namespace Model
 } // namespace CostExplorer
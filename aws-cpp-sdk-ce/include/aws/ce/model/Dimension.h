@@ -52,7 +52,8 @@ namespace DimensionMapper
 {
 AWS_COSTEXPLORER_API Dimension GetDimensionForName(const Aws::String& name);
 
-AWS_COSTEXPLORER_API Aws::String GetNameForDimension(Dimension value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTEXPLORER_API const char* GetNameForDimension(Dimension value);
 } // namespace DimensionMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -34,7 +34,8 @@ namespace GranularityMapper
 {
 AWS_COSTEXPLORER_API Granularity GetGranularityForName(const Aws::String& name);
 
-AWS_COSTEXPLORER_API Aws::String GetNameForGranularity(Granularity value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTEXPLORER_API const char* GetNameForGranularity(Granularity value);
 } // namespace GranularityMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -34,7 +34,8 @@ namespace GroupDefinitionTypeMapper
 {
 AWS_COSTEXPLORER_API GroupDefinitionType GetGroupDefinitionTypeForName(const Aws::String& name);
 
-AWS_COSTEXPLORER_API Aws::String GetNameForGroupDefinitionType(GroupDefinitionType value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTEXPLORER_API const char* GetNameForGroupDefinitionType(GroupDefinitionType value);
 } // namespace GroupDefinitionTypeMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -35,7 +35,8 @@ namespace LookbackPeriodInDaysMapper
 {
 AWS_COSTEXPLORER_API LookbackPeriodInDays GetLookbackPeriodInDaysForName(const Aws::String& name);
 
-AWS_COSTEXPLORER_API Aws::String GetNameForLookbackPeriodInDays(LookbackPeriodInDays value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTEXPLORER_API const char* GetNameForLookbackPeriodInDays(LookbackPeriodInDays value);
 } // namespace LookbackPeriodInDaysMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -34,7 +34,8 @@ namespace OfferingClassMapper
 {
 AWS_COSTEXPLORER_API OfferingClass GetOfferingClassForName(const Aws::String& name);
 
-AWS_COSTEXPLORER_API Aws::String GetNameForOfferingClass(OfferingClass value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTEXPLORER_API const char* GetNameForOfferingClass(OfferingClass value);
 } // namespace OfferingClassMapper
 } // namespace Model
 } // namespace CostExplorer
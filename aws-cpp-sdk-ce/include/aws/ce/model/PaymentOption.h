@@ -38,7 +38,8 @@ namespace PaymentOptionMapper
 {
 AWS_COSTEXPLORER_API PaymentOption GetPaymentOptionForName(const Aws::String& name);
 
-AWS_COSTEXPLORER_API Aws::String GetNameForPaymentOption(PaymentOption value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTEXPLORER_API const char* GetNameForPaymentOption(PaymentOption value);
 } // namespace PaymentOptionMapper
 } // namespace Model
 } // namespace CostExplorer
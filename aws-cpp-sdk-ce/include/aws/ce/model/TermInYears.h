@@ -34,7 +34,8 @@ namespace TermInYearsMapper
 {
 AWS_COSTEXPLORER_API TermInYears GetTermInYearsForName(const Aws::String& name);
 
-AWS_COSTEXPLORER_API Aws::String GetNameForTermInYears(TermInYears value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTEXPLORER_API const char* GetNameForTermInYears(TermInYears value);
 } // namespace TermInYearsMapper
 } // namespace Model
 } // namespace CostExplorer
@@ -28,11 +28,11 @@ namespace CostExplorer
 namespace CostExplorerErrorMapper
 {
 
-static const int BILL_EXPIRATION_HASH = HashingUtils::HashString("BillExpirationException");
-static const int DATA_UNAVAILABLE_HASH = HashingUtils::HashString("DataUnavailableException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int REQUEST_CHANGED_HASH = HashingUtils::HashString("RequestChangedException");
+static constexpr int BILL_EXPIRATION_HASH = HashingUtils::CompileTimeHashString("BillExpirationException");
+static constexpr int DATA_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("DataUnavailableException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int REQUEST_CHANGED_HASH = HashingUtils::CompileTimeHashString("RequestChangedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace AccountScopeMapper
       {
 
-        static const int PAYER_HASH = HashingUtils::HashString("PAYER");
-        static const int LINKED_HASH = HashingUtils::HashString("LINKED");
+        static constexpr int PAYER_HASH = HashingUtils::CompileTimeHashString("PAYER");
+        static constexpr int LINKED_HASH = HashingUtils::CompileTimeHashString("LINKED");
 
 
         AccountScope GetAccountScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PAYER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccountScope::PAYER;
-          }
-          else if (hashCode == LINKED_HASH)
-          {
-            return AccountScope::LINKED;
+          case PAYER_HASH:
+            if (name == "PAYER")
+            {
+              return AccountScope::PAYER;
+            }
+            break;
+          case LINKED_HASH:
+            if (name == "LINKED")
+            {
+              return AccountScope::LINKED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AccountScope::NOT_SET;
         }
 
-        Aws::String GetNameForAccountScope(AccountScope enumValue)
+        const char* GetNameForAccountScope(AccountScope enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
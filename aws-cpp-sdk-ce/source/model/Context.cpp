@@ -30,20 +30,30 @@ namespace Aws
       namespace ContextMapper
       {
 
-        static const int COST_AND_USAGE_HASH = HashingUtils::HashString("COST_AND_USAGE");
-        static const int RESERVATIONS_HASH = HashingUtils::HashString("RESERVATIONS");
+        static constexpr int COST_AND_USAGE_HASH = HashingUtils::CompileTimeHashString("COST_AND_USAGE");
+        static constexpr int RESERVATIONS_HASH = HashingUtils::CompileTimeHashString("RESERVATIONS");
 
 
         Context GetContextForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COST_AND_USAGE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Context::COST_AND_USAGE;
-          }
-          else if (hashCode == RESERVATIONS_HASH)
-          {
-            return Context::RESERVATIONS;
+          case COST_AND_USAGE_HASH:
+            if (name == "COST_AND_USAGE")
+            {
+              return Context::COST_AND_USAGE;
+            }
+            break;
+          case RESERVATIONS_HASH:
+            if (name == "RESERVATIONS")
+            {
+              return Context::RESERVATIONS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Context::NOT_SET;
         }
 
-        Aws::String GetNameForContext(Context enumValue)
+        const char* GetNameForContext(Context enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
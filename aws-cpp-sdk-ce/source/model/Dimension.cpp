@@ -30,110 +30,156 @@ namespace Aws
       namespace DimensionMapper
       {
 
-        static const int AZ_HASH = HashingUtils::HashString("AZ");
-        static const int INSTANCE_TYPE_HASH = HashingUtils::HashString("INSTANCE_TYPE");
-        static const int LINKED_ACCOUNT_HASH = HashingUtils::HashString("LINKED_ACCOUNT");
-        static const int OPERATION_HASH = HashingUtils::HashString("OPERATION");
-        static const int PURCHASE_TYPE_HASH = HashingUtils::HashString("PURCHASE_TYPE");
-        static const int REGION_HASH = HashingUtils::HashString("REGION");
-        static const int SERVICE_HASH = HashingUtils::HashString("SERVICE");
-        static const int USAGE_TYPE_HASH = HashingUtils::HashString("USAGE_TYPE");
-        static const int USAGE_TYPE_GROUP_HASH = HashingUtils::HashString("USAGE_TYPE_GROUP");
-        static const int RECORD_TYPE_HASH = HashingUtils::HashString("RECORD_TYPE");
-        static const int OPERATING_SYSTEM_HASH = HashingUtils::HashString("OPERATING_SYSTEM");
-        static const int TENANCY_HASH = HashingUtils::HashString("TENANCY");
-        static const int SCOPE_HASH = HashingUtils::HashString("SCOPE");
-        static const int PLATFORM_HASH = HashingUtils::HashString("PLATFORM");
-        static const int SUBSCRIPTION_ID_HASH = HashingUtils::HashString("SUBSCRIPTION_ID");
-        static const int LEGAL_ENTITY_NAME_HASH = HashingUtils::HashString("LEGAL_ENTITY_NAME");
-        static const int DEPLOYMENT_OPTION_HASH = HashingUtils::HashString("DEPLOYMENT_OPTION");
-        static const int DATABASE_ENGINE_HASH = HashingUtils::HashString("DATABASE_ENGINE");
-        static const int CACHE_ENGINE_HASH = HashingUtils::HashString("CACHE_ENGINE");
-        static const int INSTANCE_TYPE_FAMILY_HASH = HashingUtils::HashString("INSTANCE_TYPE_FAMILY");
+        static constexpr int AZ_HASH = HashingUtils::CompileTimeHashString("AZ");
+        static constexpr int INSTANCE_TYPE_HASH = HashingUtils::CompileTimeHashString("INSTANCE_TYPE");
+        static constexpr int LINKED_ACCOUNT_HASH = HashingUtils::CompileTimeHashString("LINKED_ACCOUNT");
+        static constexpr int OPERATION_HASH = HashingUtils::CompileTimeHashString("OPERATION");
+        static constexpr int PURCHASE_TYPE_HASH = HashingUtils::CompileTimeHashString("PURCHASE_TYPE");
+        static constexpr int REGION_HASH = HashingUtils::CompileTimeHashString("REGION");
+        static constexpr int SERVICE_HASH = HashingUtils::CompileTimeHashString("SERVICE");
+        static constexpr int USAGE_TYPE_HASH = HashingUtils::CompileTimeHashString("USAGE_TYPE");
+        static constexpr int USAGE_TYPE_GROUP_HASH = HashingUtils::CompileTimeHashString("USAGE_TYPE_GROUP");
+        static constexpr int RECORD_TYPE_HASH = HashingUtils::CompileTimeHashString("RECORD_TYPE");
+        static constexpr int OPERATING_SYSTEM_HASH = HashingUtils::CompileTimeHashString("OPERATING_SYSTEM");
+        static constexpr int TENANCY_HASH = HashingUtils::CompileTimeHashString("TENANCY");
+        static constexpr int SCOPE_HASH = HashingUtils::CompileTimeHashString("SCOPE");
+        static constexpr int PLATFORM_HASH = HashingUtils::CompileTimeHashString("PLATFORM");
+        static constexpr int SUBSCRIPTION_ID_HASH = HashingUtils::CompileTimeHashString("SUBSCRIPTION_ID");
+        static constexpr int LEGAL_ENTITY_NAME_HASH = HashingUtils::CompileTimeHashString("LEGAL_ENTITY_NAME");
+        static constexpr int DEPLOYMENT_OPTION_HASH = HashingUtils::CompileTimeHashString("DEPLOYMENT_OPTION");
+        static constexpr int DATABASE_ENGINE_HASH = HashingUtils::CompileTimeHashString("DATABASE_ENGINE");
+        static constexpr int CACHE_ENGINE_HASH = HashingUtils::CompileTimeHashString("CACHE_ENGINE");
+        static constexpr int INSTANCE_TYPE_FAMILY_HASH = HashingUtils::CompileTimeHashString("INSTANCE_TYPE_FAMILY");
 
 
         Dimension GetDimensionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AZ_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Dimension::AZ;
-          }
-          else if (hashCode == INSTANCE_TYPE_HASH)
-          {
-            return Dimension::INSTANCE_TYPE;
-          }
-          else if (hashCode == LINKED_ACCOUNT_HASH)
-          {
-            return Dimension::LINKED_ACCOUNT;
-          }
-          else if (hashCode == OPERATION_HASH)
-          {
-            return Dimension::OPERATION;
-          }
-          else if (hashCode == PURCHASE_TYPE_HASH)
-          {
-            return Dimension::PURCHASE_TYPE;
-          }
-          else if (hashCode == REGION_HASH)
-          {
-            return Dimension::REGION;
-          }
-          else if (hashCode == SERVICE_HASH)
-          {
-            return Dimension::SERVICE;
-          }
-          else if (hashCode == USAGE_TYPE_HASH)
-          {
-            return Dimension::USAGE_TYPE;
-          }
-          else if (hashCode == USAGE_TYPE_GROUP_HASH)
-          {
-            return Dimension::USAGE_TYPE_GROUP;
-          }
-          else if (hashCode == RECORD_TYPE_HASH)
-          {
-            return Dimension::RECORD_TYPE;
-          }
-          else if (hashCode == OPERATING_SYSTEM_HASH)
-          {
-            return Dimension::OPERATING_SYSTEM;
-          }
-          else if (hashCode == TENANCY_HASH)
-          {
-            return Dimension::TENANCY;
-          }
-          else if (hashCode == SCOPE_HASH)
-          {
-            return Dimension::SCOPE;
-          }
-          else if (hashCode == PLATFORM_HASH)
-          {
-            return Dimension::PLATFORM;
-          }
-          else if (hashCode == SUBSCRIPTION_ID_HASH)
-          {
-            return Dimension::SUBSCRIPTION_ID;
-          }
-          else if (hashCode == LEGAL_ENTITY_NAME_HASH)
-          {
-            return Dimension::LEGAL_ENTITY_NAME;
-          }
-          else if (hashCode == DEPLOYMENT_OPTION_HASH)
-          {
-            return Dimension::DEPLOYMENT_OPTION;
-          }
-          else if (hashCode == DATABASE_ENGINE_HASH)
-          {
-            return Dimension::DATABASE_ENGINE;
-          }
-          else if (hashCode == CACHE_ENGINE_HASH)
-          {
-            return Dimension::CACHE_ENGINE;
-          }
-          else if (hashCode == INSTANCE_TYPE_FAMILY_HASH)
-          {
-            return Dimension::INSTANCE_TYPE_FAMILY;
+          case AZ_HASH:
+            if (name == "AZ")
+            {
+              return Dimension::AZ;
+            }
+            break;
+          case INSTANCE_TYPE_HASH:
+            if (name == "INSTANCE_TYPE")
+            {
+              return Dimension::INSTANCE_TYPE;
+            }
+            break;
+          case LINKED_ACCOUNT_HASH:
+            if (name == "LINKED_ACCOUNT")
+            {
+              return Dimension::LINKED_ACCOUNT;
+            }
+            break;
+          case OPERATION_HASH:
+            if (name == "OPERATION")
+            {
+              return Dimension::OPERATION;
+            }
+            break;
+          case PURCHASE_TYPE_HASH:
+            if (name == "PURCHASE_TYPE")
+            {
+              return Dimension::PURCHASE_TYPE;
+            }
+            break;
+          case REGION_HASH:
+            if (name == "REGION")
+            {
+              return Dimension::REGION;
+            }
+            break;
+          case SERVICE_HASH:
+            if (name == "SERVICE")
+            {
+              return Dimension::SERVICE;
+            }
+            break;
+          case USAGE_TYPE_HASH:
+            if (name == "USAGE_TYPE")
+            {
+              return Dimension::USAGE_TYPE;
+            }
+            break;
+          case USAGE_TYPE_GROUP_HASH:
+            if (name == "USAGE_TYPE_GROUP")
+            {
+              return Dimension::USAGE_TYPE_GROUP;
+            }
+            break;
+          case RECORD_TYPE_HASH:
+            if (name == "RECORD_TYPE")
+            {
+              return Dimension::RECORD_TYPE;
+            }
+            break;
+          case OPERATING_SYSTEM_HASH:
+            if (name == "OPERATING_SYSTEM")
+            {
+              return Dimension::OPERATING_SYSTEM;
+            }
+            break;
+          case TENANCY_HASH:
+            if (name == "TENANCY")
+            {
+              return Dimension::TENANCY;
+            }
+            break;
+          case SCOPE_HASH:
+            if (name == "SCOPE")
+            {
+              return Dimension::SCOPE;
+            }
+            break;
+          case PLATFORM_HASH:
+            if (name == "PLATFORM")
+            {
+              return Dimension::PLATFORM;
+            }
+            break;
+          case SUBSCRIPTION_ID_HASH:
+            if (name == "SUBSCRIPTION_ID")
+            {
+              return Dimension::SUBSCRIPTION_ID;
+            }
+            break;
+          case LEGAL_ENTITY_NAME_HASH:
+            if (name == "LEGAL_ENTITY_NAME")
+            {
+              return Dimension::LEGAL_ENTITY_NAME;
+            }
+            break;
+          case DEPLOYMENT_OPTION_HASH:
+            if (name == "DEPLOYMENT_OPTION")
+            {
+              return Dimension::DEPLOYMENT_OPTION;
+            }
+            break;
+          case DATABASE_ENGINE_HASH:
+            if (name == "DATABASE_ENGINE")
+            {
+              return Dimension::DATABASE_ENGINE;
+            }
+            break;
+          case CACHE_ENGINE_HASH:
+            if (name == "CACHE_ENGINE")
+            {
+              return Dimension::CACHE_ENGINE;
+            }
+            break;
+          case INSTANCE_TYPE_FAMILY_HASH:
+            if (name == "INSTANCE_TYPE_FAMILY")
+            {
+              return Dimension::INSTANCE_TYPE_FAMILY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -145,7 +191,7 @@ namespace Aws
           return Dimension::NOT_SET;
         }
 
-        Aws::String GetNameForDimension(Dimension enumValue)
+        const char* GetNameForDimension(Dimension enumValue)
         {
           switch(enumValue)
           {
@@ -193,7 +239,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace GranularityMapper
       {
 
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
+        static constexpr int DAILY_HASH = HashingUtils::CompileTimeHashString("DAILY");
+        static constexpr int MONTHLY_HASH = HashingUtils::CompileTimeHashString("MONTHLY");
 
 
         Granularity GetGranularityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAILY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Granularity::DAILY;
-          }
-          else if (hashCode == MONTHLY_HASH)
-          {
-            return Granularity::MONTHLY;
+          case DAILY_HASH:
+            if (name == "DAILY")
+            {
+              return Granularity::DAILY;
+            }
+            break;
+          case MONTHLY_HASH:
+            if (name == "MONTHLY")
+            {
+              return Granularity::MONTHLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Granularity::NOT_SET;
         }
 
-        Aws::String GetNameForGranularity(Granularity enumValue)
+        const char* GetNameForGranularity(Granularity enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace GroupDefinitionTypeMapper
       {
 
-        static const int DIMENSION_HASH = HashingUtils::HashString("DIMENSION");
-        static const int TAG_HASH = HashingUtils::HashString("TAG");
+        static constexpr int DIMENSION_HASH = HashingUtils::CompileTimeHashString("DIMENSION");
+        static constexpr int TAG_HASH = HashingUtils::CompileTimeHashString("TAG");
 
 
         GroupDefinitionType GetGroupDefinitionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DIMENSION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GroupDefinitionType::DIMENSION;
-          }
-          else if (hashCode == TAG_HASH)
-          {
-            return GroupDefinitionType::TAG;
+          case DIMENSION_HASH:
+            if (name == "DIMENSION")
+            {
+              return GroupDefinitionType::DIMENSION;
+            }
+            break;
+          case TAG_HASH:
+            if (name == "TAG")
+            {
+              return GroupDefinitionType::TAG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return GroupDefinitionType::NOT_SET;
         }
 
-        Aws::String GetNameForGroupDefinitionType(GroupDefinitionType enumValue)
+        const char* GetNameForGroupDefinitionType(GroupDefinitionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace LookbackPeriodInDaysMapper
       {
 
-        static const int SEVEN_DAYS_HASH = HashingUtils::HashString("SEVEN_DAYS");
-        static const int THIRTY_DAYS_HASH = HashingUtils::HashString("THIRTY_DAYS");
-        static const int SIXTY_DAYS_HASH = HashingUtils::HashString("SIXTY_DAYS");
+        static constexpr int SEVEN_DAYS_HASH = HashingUtils::CompileTimeHashString("SEVEN_DAYS");
+        static constexpr int THIRTY_DAYS_HASH = HashingUtils::CompileTimeHashString("THIRTY_DAYS");
+        static constexpr int SIXTY_DAYS_HASH = HashingUtils::CompileTimeHashString("SIXTY_DAYS");
 
 
         LookbackPeriodInDays GetLookbackPeriodInDaysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SEVEN_DAYS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LookbackPeriodInDays::SEVEN_DAYS;
-          }
-          else if (hashCode == THIRTY_DAYS_HASH)
-          {
-            return LookbackPeriodInDays::THIRTY_DAYS;
-          }
-          else if (hashCode == SIXTY_DAYS_HASH)
-          {
-            return LookbackPeriodInDays::SIXTY_DAYS;
+          case SEVEN_DAYS_HASH:
+            if (name == "SEVEN_DAYS")
+            {
+              return LookbackPeriodInDays::SEVEN_DAYS;
+            }
+            break;
+          case THIRTY_DAYS_HASH:
+            if (name == "THIRTY_DAYS")
+            {
+              return LookbackPeriodInDays::THIRTY_DAYS;
+            }
+            break;
+          case SIXTY_DAYS_HASH:
+            if (name == "SIXTY_DAYS")
+            {
+              return LookbackPeriodInDays::SIXTY_DAYS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return LookbackPeriodInDays::NOT_SET;
         }
 
-        Aws::String GetNameForLookbackPeriodInDays(LookbackPeriodInDays enumValue)
+        const char* GetNameForLookbackPeriodInDays(LookbackPeriodInDays enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
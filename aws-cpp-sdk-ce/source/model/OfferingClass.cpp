@@ -30,20 +30,30 @@ namespace Aws
       namespace OfferingClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int CONVERTIBLE_HASH = HashingUtils::HashString("CONVERTIBLE");
+        static constexpr int STANDARD_HASH = HashingUtils::CompileTimeHashString("STANDARD");
+        static constexpr int CONVERTIBLE_HASH = HashingUtils::CompileTimeHashString("CONVERTIBLE");
 
 
         OfferingClass GetOfferingClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OfferingClass::STANDARD;
-          }
-          else if (hashCode == CONVERTIBLE_HASH)
-          {
-            return OfferingClass::CONVERTIBLE;
+          case STANDARD_HASH:
+            if (name == "STANDARD")
+            {
+              return OfferingClass::STANDARD;
+            }
+            break;
+          case CONVERTIBLE_HASH:
+            if (name == "CONVERTIBLE")
+            {
+              return OfferingClass::CONVERTIBLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OfferingClass::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingClass(OfferingClass enumValue)
+        const char* GetNameForOfferingClass(OfferingClass enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
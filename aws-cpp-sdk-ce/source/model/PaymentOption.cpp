@@ -30,40 +30,58 @@ namespace Aws
       namespace PaymentOptionMapper
       {
 
-        static const int NO_UPFRONT_HASH = HashingUtils::HashString("NO_UPFRONT");
-        static const int PARTIAL_UPFRONT_HASH = HashingUtils::HashString("PARTIAL_UPFRONT");
-        static const int ALL_UPFRONT_HASH = HashingUtils::HashString("ALL_UPFRONT");
-        static const int LIGHT_UTILIZATION_HASH = HashingUtils::HashString("LIGHT_UTILIZATION");
-        static const int MEDIUM_UTILIZATION_HASH = HashingUtils::HashString("MEDIUM_UTILIZATION");
-        static const int HEAVY_UTILIZATION_HASH = HashingUtils::HashString("HEAVY_UTILIZATION");
+        static constexpr int NO_UPFRONT_HASH = HashingUtils::CompileTimeHashString("NO_UPFRONT");
+        static constexpr int PARTIAL_UPFRONT_HASH = HashingUtils::CompileTimeHashString("PARTIAL_UPFRONT");
+        static constexpr int ALL_UPFRONT_HASH = HashingUtils::CompileTimeHashString("ALL_UPFRONT");
+        static constexpr int LIGHT_UTILIZATION_HASH = HashingUtils::CompileTimeHashString("LIGHT_UTILIZATION");
+        static constexpr int MEDIUM_UTILIZATION_HASH = HashingUtils::CompileTimeHashString("MEDIUM_UTILIZATION");
+        static constexpr int HEAVY_UTILIZATION_HASH = HashingUtils::CompileTimeHashString("HEAVY_UTILIZATION");
 
 
         PaymentOption GetPaymentOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_UPFRONT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PaymentOption::NO_UPFRONT;
-          }
-          else if (hashCode == PARTIAL_UPFRONT_HASH)
-          {
-            return PaymentOption::PARTIAL_UPFRONT;
-          }
-          else if (hashCode == ALL_UPFRONT_HASH)
-          {
-            return PaymentOption::ALL_UPFRONT;
-          }
-          else if (hashCode == LIGHT_UTILIZATION_HASH)
-          {
-            return PaymentOption::LIGHT_UTILIZATION;
-          }
-          else if (hashCode == MEDIUM_UTILIZATION_HASH)
-          {
-            return PaymentOption::MEDIUM_UTILIZATION;
-          }
-          else if (hashCode == HEAVY_UTILIZATION_HASH)
-          {
-            return PaymentOption::HEAVY_UTILIZATION;
+          case NO_UPFRONT_HASH:
+            if (name == "NO_UPFRONT")
+            {
+              return PaymentOption::NO_UPFRONT;
+            }
+            break;
+          case PARTIAL_UPFRONT_HASH:
+            if (name == "PARTIAL_UPFRONT")
+            {
+              return PaymentOption::PARTIAL_UPFRONT;
+            }
+            break;
+          case ALL_UPFRONT_HASH:
+            if (name == "ALL_UPFRONT")
+            {
+              return PaymentOption::ALL_UPFRONT;
+            }
+            break;
+          case LIGHT_UTILIZATION_HASH:
+            if (name == "LIGHT_UTILIZATION")
+            {
+              return PaymentOption::LIGHT_UTILIZATION;
+            }
+            break;
+          case MEDIUM_UTILIZATION_HASH:
+            if (name == "MEDIUM_UTILIZATION")
+            {
+              return PaymentOption::MEDIUM_UTILIZATION;
+            }
+            break;
+          case HEAVY_UTILIZATION_HASH:
+            if (name == "HEAVY_UTILIZATION")
+            {
+              return PaymentOption::HEAVY_UTILIZATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return PaymentOption::NOT_SET;
         }
 
-        Aws::String GetNameForPaymentOption(PaymentOption enumValue)
+        const char* GetNameForPaymentOption(PaymentOption enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace TermInYearsMapper
       {
 
-        static const int ONE_YEAR_HASH = HashingUtils::HashString("ONE_YEAR");
-        static const int THREE_YEARS_HASH = HashingUtils::HashString("THREE_YEARS");
+        static constexpr int ONE_YEAR_HASH = HashingUtils::CompileTimeHashString("ONE_YEAR");
+        static constexpr int THREE_YEARS_HASH = HashingUtils::CompileTimeHashString("THREE_YEARS");
 
 
         TermInYears GetTermInYearsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONE_YEAR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TermInYears::ONE_YEAR;
-          }
-          else if (hashCode == THREE_YEARS_HASH)
-          {
-            return TermInYears::THREE_YEARS;
+          case ONE_YEAR_HASH:
+            if (name == "ONE_YEAR")
+            {
+              return TermInYears::ONE_YEAR;
+            }
+            break;
+          case THREE_YEARS_HASH:
+            if (name == "THREE_YEARS")
+            {
+              return TermInYears::THREE_YEARS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TermInYears::NOT_SET;
         }
 
-        Aws::String GetNameForTermInYears(TermInYears enumValue)
+        const char* GetNameForTermInYears(TermInYears enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
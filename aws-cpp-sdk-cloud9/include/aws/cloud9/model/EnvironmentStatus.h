@@ -39,7 +39,8 @@ namespace EnvironmentStatusMapper
 {
 AWS_CLOUD9_API EnvironmentStatus GetEnvironmentStatusForName(const Aws::String& name);
 
-AWS_CLOUD9_API Aws::String GetNameForEnvironmentStatus(EnvironmentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUD9_API const char* GetNameForEnvironmentStatus(EnvironmentStatus value);
 } // namespace EnvironmentStatusMapper
 } // namespace Model
 } // namespace Cloud9
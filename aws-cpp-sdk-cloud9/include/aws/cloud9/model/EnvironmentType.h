@@ -34,7 +34,8 @@ namespace EnvironmentTypeMapper
 {
 AWS_CLOUD9_API EnvironmentType GetEnvironmentTypeForName(const Aws::String& name);
 
-AWS_CLOUD9_API Aws::String GetNameForEnvironmentType(EnvironmentType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUD9_API const char* GetNameForEnvironmentType(EnvironmentType value);
 } // namespace EnvironmentTypeMapper
 } // namespace Model
 } // namespace Cloud9
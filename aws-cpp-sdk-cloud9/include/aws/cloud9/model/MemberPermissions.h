@@ -34,7 +34,8 @@ namespace MemberPermissionsMapper
 {
 AWS_CLOUD9_API MemberPermissions GetMemberPermissionsForName(const Aws::String& name);
 
-AWS_CLOUD9_API Aws::String GetNameForMemberPermissions(MemberPermissions value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUD9_API const char* GetNameForMemberPermissions(MemberPermissions value);
 } // namespace MemberPermissionsMapper
 } // namespace Model
 } // namespace Cloud9
@@ -35,7 +35,8 @@ namespace PermissionsMapper
 {
 AWS_CLOUD9_API Permissions GetPermissionsForName(const Aws::String& name);
 
-AWS_CLOUD9_API Aws::String GetNameForPermissions(Permissions value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUD9_API const char* GetNameForPermissions(Permissions value);
 } // namespace PermissionsMapper
 } // namespace Model
 } // namespace Cloud9
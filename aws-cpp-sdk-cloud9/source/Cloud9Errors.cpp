@@ -28,13 +28,13 @@ namespace Cloud9
 namespace Cloud9ErrorMapper
 {
 
-static const int FORBIDDEN_HASH = HashingUtils::HashString("ForbiddenException");
-static const int CONFLICT_HASH = HashingUtils::HashString("ConflictException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int BAD_REQUEST_HASH = HashingUtils::HashString("BadRequestException");
-static const int INTERNAL_SERVER_ERROR_HASH = HashingUtils::HashString("InternalServerErrorException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
+static constexpr int FORBIDDEN_HASH = HashingUtils::CompileTimeHashString("ForbiddenException");
+static constexpr int CONFLICT_HASH = HashingUtils::CompileTimeHashString("ConflictException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int BAD_REQUEST_HASH = HashingUtils::CompileTimeHashString("BadRequestException");
+static constexpr int INTERNAL_SERVER_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalServerErrorException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
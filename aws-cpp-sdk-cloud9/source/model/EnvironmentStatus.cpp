@@ -30,45 +30,65 @@ namespace Aws
       namespace EnvironmentStatusMapper
       {
 
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int creating_HASH = HashingUtils::HashString("creating");
-        static const int connecting_HASH = HashingUtils::HashString("connecting");
-        static const int ready_HASH = HashingUtils::HashString("ready");
-        static const int stopping_HASH = HashingUtils::HashString("stopping");
-        static const int stopped_HASH = HashingUtils::HashString("stopped");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
+        static constexpr int creating_HASH = HashingUtils::CompileTimeHashString("creating");
+        static constexpr int connecting_HASH = HashingUtils::CompileTimeHashString("connecting");
+        static constexpr int ready_HASH = HashingUtils::CompileTimeHashString("ready");
+        static constexpr int stopping_HASH = HashingUtils::CompileTimeHashString("stopping");
+        static constexpr int stopped_HASH = HashingUtils::CompileTimeHashString("stopped");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
 
 
         EnvironmentStatus GetEnvironmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == error_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnvironmentStatus::error;
-          }
-          else if (hashCode == creating_HASH)
-          {
-            return EnvironmentStatus::creating;
-          }
-          else if (hashCode == connecting_HASH)
-          {
-            return EnvironmentStatus::connecting;
-          }
-          else if (hashCode == ready_HASH)
-          {
-            return EnvironmentStatus::ready;
-          }
-          else if (hashCode == stopping_HASH)
-          {
-            return EnvironmentStatus::stopping;
-          }
-          else if (hashCode == stopped_HASH)
-          {
-            return EnvironmentStatus::stopped;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return EnvironmentStatus::deleting;
+          case error_HASH:
+            if (name == "error")
+            {
+              return EnvironmentStatus::error;
+            }
+            break;
+          case creating_HASH:
+            if (name == "creating")
+            {
+              return EnvironmentStatus::creating;
+            }
+            break;
+          case connecting_HASH:
+            if (name == "connecting")
+            {
+              return EnvironmentStatus::connecting;
+            }
+            break;
+          case ready_HASH:
+            if (name == "ready")
+            {
+              return EnvironmentStatus::ready;
+            }
+            break;
+          case stopping_HASH:
+            if (name == "stopping")
+            {
+              return EnvironmentStatus::stopping;
+            }
+            break;
+          case stopped_HASH:
+            if (name == "stopped")
+            {
+              return EnvironmentStatus::stopped;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return EnvironmentStatus::deleting;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return EnvironmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentStatus(EnvironmentStatus enumValue)
+        const char* GetNameForEnvironmentStatus(EnvironmentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
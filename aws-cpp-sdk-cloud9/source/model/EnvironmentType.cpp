@@ -30,20 +30,30 @@ namespace Aws
       namespace EnvironmentTypeMapper
       {
 
-        static const int ssh_HASH = HashingUtils::HashString("ssh");
-        static const int ec2_HASH = HashingUtils::HashString("ec2");
+        static constexpr int ssh_HASH = HashingUtils::CompileTimeHashString("ssh");
+        static constexpr int ec2_HASH = HashingUtils::CompileTimeHashString("ec2");
 
 
         EnvironmentType GetEnvironmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ssh_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnvironmentType::ssh;
-          }
-          else if (hashCode == ec2_HASH)
-          {
-            return EnvironmentType::ec2;
+          case ssh_HASH:
+            if (name == "ssh")
+            {
+              return EnvironmentType::ssh;
+            }
+            break;
+          case ec2_HASH:
+            if (name == "ec2")
+            {
+              return EnvironmentType::ec2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EnvironmentType::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentType(EnvironmentType enumValue)
+        const char* GetNameForEnvironmentType(EnvironmentType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace MemberPermissionsMapper
       {
 
-        static const int read_write_HASH = HashingUtils::HashString("read-write");
-        static const int read_only_HASH = HashingUtils::HashString("read-only");
+        static constexpr int read_write_HASH = HashingUtils::CompileTimeHashString("read-write");
+        static constexpr int read_only_HASH = HashingUtils::CompileTimeHashString("read-only");
 
 
         MemberPermissions GetMemberPermissionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == read_write_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MemberPermissions::read_write;
-          }
-          else if (hashCode == read_only_HASH)
-          {
-            return MemberPermissions::read_only;
+          case read_write_HASH:
+            if (name == "read-write")
+            {
+              return MemberPermissions::read_write;
+            }
+            break;
+          case read_only_HASH:
+            if (name == "read-only")
+            {
+              return MemberPermissions::read_only;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MemberPermissions::NOT_SET;
         }
 
-        Aws::String GetNameForMemberPermissions(MemberPermissions enumValue)
+        const char* GetNameForMemberPermissions(MemberPermissions enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
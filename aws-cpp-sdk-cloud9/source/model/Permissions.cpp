@@ -30,25 +30,37 @@ namespace Aws
       namespace PermissionsMapper
       {
 
-        static const int owner_HASH = HashingUtils::HashString("owner");
-        static const int read_write_HASH = HashingUtils::HashString("read-write");
-        static const int read_only_HASH = HashingUtils::HashString("read-only");
+        static constexpr int owner_HASH = HashingUtils::CompileTimeHashString("owner");
+        static constexpr int read_write_HASH = HashingUtils::CompileTimeHashString("read-write");
+        static constexpr int read_only_HASH = HashingUtils::CompileTimeHashString("read-only");
 
 
         Permissions GetPermissionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == owner_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Permissions::owner;
-          }
-          else if (hashCode == read_write_HASH)
-          {
-            return Permissions::read_write;
-          }
-          else if (hashCode == read_only_HASH)
-          {
-            return Permissions::read_only;
+          case owner_HASH:
+            if (name == "owner")
+            {
+              return Permissions::owner;
+            }
+            break;
+          case read_write_HASH:
+            if (name == "read-write")
+            {
+              return Permissions::read_write;
+            }
+            break;
+          case read_only_HASH:
+            if (name == "read-only")
+            {
+              return Permissions::read_only;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Permissions::NOT_SET;
         }
 
-        Aws::String GetNameForPermissions(Permissions enumValue)
+        const char* GetNameForPermissions(Permissions enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -45,7 +45,8 @@ namespace BatchReadExceptionTypeMapper
 {
 AWS_CLOUDDIRECTORY_API BatchReadExceptionType GetBatchReadExceptionTypeForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForBatchReadExceptionType(BatchReadExceptionType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForBatchReadExceptionType(BatchReadExceptionType value);
 } // namespace BatchReadExceptionTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
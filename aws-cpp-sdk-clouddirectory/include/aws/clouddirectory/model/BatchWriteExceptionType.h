@@ -50,7 +50,8 @@ namespace BatchWriteExceptionTypeMapper
 {
 AWS_CLOUDDIRECTORY_API BatchWriteExceptionType GetBatchWriteExceptionTypeForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForBatchWriteExceptionType(BatchWriteExceptionType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForBatchWriteExceptionType(BatchWriteExceptionType value);
 } // namespace BatchWriteExceptionTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -34,7 +34,8 @@ namespace ConsistencyLevelMapper
 {
 AWS_CLOUDDIRECTORY_API ConsistencyLevel GetConsistencyLevelForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForConsistencyLevel(ConsistencyLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForConsistencyLevel(ConsistencyLevel value);
 } // namespace ConsistencyLevelMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -35,7 +35,8 @@ namespace DirectoryStateMapper
 {
 AWS_CLOUDDIRECTORY_API DirectoryState GetDirectoryStateForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForDirectoryState(DirectoryState value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForDirectoryState(DirectoryState value);
 } // namespace DirectoryStateMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -38,7 +38,8 @@ namespace FacetAttributeTypeMapper
 {
 AWS_CLOUDDIRECTORY_API FacetAttributeType GetFacetAttributeTypeForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForFacetAttributeType(FacetAttributeType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForFacetAttributeType(FacetAttributeType value);
 } // namespace FacetAttributeTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -34,7 +34,8 @@ namespace FacetStyleMapper
 {
 AWS_CLOUDDIRECTORY_API FacetStyle GetFacetStyleForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForFacetStyle(FacetStyle value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForFacetStyle(FacetStyle value);
 } // namespace FacetStyleMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -36,7 +36,8 @@ namespace ObjectTypeMapper
 {
 AWS_CLOUDDIRECTORY_API ObjectType GetObjectTypeForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForObjectType(ObjectType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForObjectType(ObjectType value);
 } // namespace ObjectTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -37,7 +37,8 @@ namespace RangeModeMapper
 {
 AWS_CLOUDDIRECTORY_API RangeMode GetRangeModeForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForRangeMode(RangeMode value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForRangeMode(RangeMode value);
 } // namespace RangeModeMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -34,7 +34,8 @@ namespace RequiredAttributeBehaviorMapper
 {
 AWS_CLOUDDIRECTORY_API RequiredAttributeBehavior GetRequiredAttributeBehaviorForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForRequiredAttributeBehavior(RequiredAttributeBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForRequiredAttributeBehavior(RequiredAttributeBehavior value);
 } // namespace RequiredAttributeBehaviorMapper
 } // namespace Model
 } // namespace CloudDirectory
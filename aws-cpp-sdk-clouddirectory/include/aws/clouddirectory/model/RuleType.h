@@ -36,7 +36,8 @@ namespace RuleTypeMapper
 {
 AWS_CLOUDDIRECTORY_API RuleType GetRuleTypeForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForRuleType(RuleType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForRuleType(RuleType value);
 } // namespace RuleTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -34,7 +34,8 @@ namespace UpdateActionTypeMapper
 {
 AWS_CLOUDDIRECTORY_API UpdateActionType GetUpdateActionTypeForName(const Aws::String& name);
 
-AWS_CLOUDDIRECTORY_API Aws::String GetNameForUpdateActionType(UpdateActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDDIRECTORY_API const char* GetNameForUpdateActionType(UpdateActionType value);
 } // namespace UpdateActionTypeMapper
 } // namespace Model
 } // namespace CloudDirectory
@@ -28,38 +28,38 @@ namespace CloudDirectory
 namespace CloudDirectoryErrorMapper
 {
 
-static const int RETRYABLE_CONFLICT_HASH = HashingUtils::HashString("RetryableConflictException");
-static const int DIRECTORY_NOT_ENABLED_HASH = HashingUtils::HashString("DirectoryNotEnabledException");
-static const int NOT_NODE_HASH = HashingUtils::HashString("NotNodeException");
-static const int INDEXED_ATTRIBUTE_MISSING_HASH = HashingUtils::HashString("IndexedAttributeMissingException");
-static const int NOT_INDEX_HASH = HashingUtils::HashString("NotIndexException");
-static const int DIRECTORY_NOT_DISABLED_HASH = HashingUtils::HashString("DirectoryNotDisabledException");
-static const int CANNOT_LIST_PARENT_OF_ROOT_HASH = HashingUtils::HashString("CannotListParentOfRootException");
-static const int FACET_VALIDATION_HASH = HashingUtils::HashString("FacetValidationException");
-static const int INTERNAL_SERVICE_HASH = HashingUtils::HashString("InternalServiceException");
-static const int SCHEMA_ALREADY_EXISTS_HASH = HashingUtils::HashString("SchemaAlreadyExistsException");
-static const int FACET_NOT_FOUND_HASH = HashingUtils::HashString("FacetNotFoundException");
-static const int INCOMPATIBLE_SCHEMA_HASH = HashingUtils::HashString("IncompatibleSchemaException");
-static const int INVALID_FACET_UPDATE_HASH = HashingUtils::HashString("InvalidFacetUpdateException");
-static const int NOT_POLICY_HASH = HashingUtils::HashString("NotPolicyException");
-static const int UNSUPPORTED_INDEX_TYPE_HASH = HashingUtils::HashString("UnsupportedIndexTypeException");
-static const int FACET_ALREADY_EXISTS_HASH = HashingUtils::HashString("FacetAlreadyExistsException");
-static const int INVALID_ARN_HASH = HashingUtils::HashString("InvalidArnException");
-static const int SCHEMA_ALREADY_PUBLISHED_HASH = HashingUtils::HashString("SchemaAlreadyPublishedException");
-static const int INVALID_SCHEMA_DOC_HASH = HashingUtils::HashString("InvalidSchemaDocException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int DIRECTORY_ALREADY_EXISTS_HASH = HashingUtils::HashString("DirectoryAlreadyExistsException");
-static const int BATCH_WRITE_HASH = HashingUtils::HashString("BatchWriteException");
-static const int FACET_IN_USE_HASH = HashingUtils::HashString("FacetInUseException");
-static const int OBJECT_ALREADY_DETACHED_HASH = HashingUtils::HashString("ObjectAlreadyDetachedException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int INVALID_ATTACHMENT_HASH = HashingUtils::HashString("InvalidAttachmentException");
-static const int DIRECTORY_DELETED_HASH = HashingUtils::HashString("DirectoryDeletedException");
-static const int INVALID_TAGGING_REQUEST_HASH = HashingUtils::HashString("InvalidTaggingRequestException");
-static const int OBJECT_NOT_DETACHED_HASH = HashingUtils::HashString("ObjectNotDetachedException");
-static const int STILL_CONTAINS_LINKS_HASH = HashingUtils::HashString("StillContainsLinksException");
-static const int INVALID_RULE_HASH = HashingUtils::HashString("InvalidRuleException");
-static const int LINK_NAME_ALREADY_IN_USE_HASH = HashingUtils::HashString("LinkNameAlreadyInUseException");
+static constexpr int RETRYABLE_CONFLICT_HASH = HashingUtils::CompileTimeHashString("RetryableConflictException");
+static constexpr int DIRECTORY_NOT_ENABLED_HASH = HashingUtils::CompileTimeHashString("DirectoryNotEnabledException");
+static constexpr int NOT_NODE_HASH = HashingUtils::CompileTimeHashString("NotNodeException");
+static constexpr int INDEXED_ATTRIBUTE_MISSING_HASH = HashingUtils::CompileTimeHashString("IndexedAttributeMissingException");
+static constexpr int NOT_INDEX_HASH = HashingUtils::CompileTimeHashString("NotIndexException");
+static constexpr int DIRECTORY_NOT_DISABLED_HASH = HashingUtils::CompileTimeHashString("DirectoryNotDisabledException");
+static constexpr int CANNOT_LIST_PARENT_OF_ROOT_HASH = HashingUtils::CompileTimeHashString("CannotListParentOfRootException");
+static constexpr int FACET_VALIDATION_HASH = HashingUtils::CompileTimeHashString("FacetValidationException");
+static constexpr int INTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
+static constexpr int SCHEMA_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("SchemaAlreadyExistsException");
+static constexpr int FACET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("FacetNotFoundException");
+static constexpr int INCOMPATIBLE_SCHEMA_HASH = HashingUtils::CompileTimeHashString("IncompatibleSchemaException");
+static constexpr int INVALID_FACET_UPDATE_HASH = HashingUtils::CompileTimeHashString("InvalidFacetUpdateException");
+static constexpr int NOT_POLICY_HASH = HashingUtils::CompileTimeHashString("NotPolicyException");
+static constexpr int UNSUPPORTED_INDEX_TYPE_HASH = HashingUtils::CompileTimeHashString("UnsupportedIndexTypeException");
+static constexpr int FACET_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("FacetAlreadyExistsException");
+static constexpr int INVALID_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidArnException");
+static constexpr int SCHEMA_ALREADY_PUBLISHED_HASH = HashingUtils::CompileTimeHashString("SchemaAlreadyPublishedException");
+static constexpr int INVALID_SCHEMA_DOC_HASH = HashingUtils::CompileTimeHashString("InvalidSchemaDocException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int DIRECTORY_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("DirectoryAlreadyExistsException");
+static constexpr int BATCH_WRITE_HASH = HashingUtils::CompileTimeHashString("BatchWriteException");
+static constexpr int FACET_IN_USE_HASH = HashingUtils::CompileTimeHashString("FacetInUseException");
+static constexpr int OBJECT_ALREADY_DETACHED_HASH = HashingUtils::CompileTimeHashString("ObjectAlreadyDetachedException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int INVALID_ATTACHMENT_HASH = HashingUtils::CompileTimeHashString("InvalidAttachmentException");
+static constexpr int DIRECTORY_DELETED_HASH = HashingUtils::CompileTimeHashString("DirectoryDeletedException");
+static constexpr int INVALID_TAGGING_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidTaggingRequestException");
+static constexpr int OBJECT_NOT_DETACHED_HASH = HashingUtils::CompileTimeHashString("ObjectNotDetachedException");
+static constexpr int STILL_CONTAINS_LINKS_HASH = HashingUtils::CompileTimeHashString("StillContainsLinksException");
+static constexpr int INVALID_RULE_HASH = HashingUtils::CompileTimeHashString("InvalidRuleException");
+static constexpr int LINK_NAME_ALREADY_IN_USE_HASH = HashingUtils::CompileTimeHashString("LinkNameAlreadyInUseException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,75 +30,107 @@ namespace Aws
       namespace BatchReadExceptionTypeMapper
       {
 
-        static const int ValidationException_HASH = HashingUtils::HashString("ValidationException");
-        static const int InvalidArnException_HASH = HashingUtils::HashString("InvalidArnException");
-        static const int ResourceNotFoundException_HASH = HashingUtils::HashString("ResourceNotFoundException");
-        static const int InvalidNextTokenException_HASH = HashingUtils::HashString("InvalidNextTokenException");
-        static const int AccessDeniedException_HASH = HashingUtils::HashString("AccessDeniedException");
-        static const int NotNodeException_HASH = HashingUtils::HashString("NotNodeException");
-        static const int FacetValidationException_HASH = HashingUtils::HashString("FacetValidationException");
-        static const int CannotListParentOfRootException_HASH = HashingUtils::HashString("CannotListParentOfRootException");
-        static const int NotIndexException_HASH = HashingUtils::HashString("NotIndexException");
-        static const int NotPolicyException_HASH = HashingUtils::HashString("NotPolicyException");
-        static const int DirectoryNotEnabledException_HASH = HashingUtils::HashString("DirectoryNotEnabledException");
-        static const int LimitExceededException_HASH = HashingUtils::HashString("LimitExceededException");
-        static const int InternalServiceException_HASH = HashingUtils::HashString("InternalServiceException");
+        static constexpr int ValidationException_HASH = HashingUtils::CompileTimeHashString("ValidationException");
+        static constexpr int InvalidArnException_HASH = HashingUtils::CompileTimeHashString("InvalidArnException");
+        static constexpr int ResourceNotFoundException_HASH = HashingUtils::CompileTimeHashString("ResourceNotFoundException");
+        static constexpr int InvalidNextTokenException_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+        static constexpr int AccessDeniedException_HASH = HashingUtils::CompileTimeHashString("AccessDeniedException");
+        static constexpr int NotNodeException_HASH = HashingUtils::CompileTimeHashString("NotNodeException");
+        static constexpr int FacetValidationException_HASH = HashingUtils::CompileTimeHashString("FacetValidationException");
+        static constexpr int CannotListParentOfRootException_HASH = HashingUtils::CompileTimeHashString("CannotListParentOfRootException");
+        static constexpr int NotIndexException_HASH = HashingUtils::CompileTimeHashString("NotIndexException");
+        static constexpr int NotPolicyException_HASH = HashingUtils::CompileTimeHashString("NotPolicyException");
+        static constexpr int DirectoryNotEnabledException_HASH = HashingUtils::CompileTimeHashString("DirectoryNotEnabledException");
+        static constexpr int LimitExceededException_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+        static constexpr int InternalServiceException_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
 
 
         BatchReadExceptionType GetBatchReadExceptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ValidationException_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BatchReadExceptionType::ValidationException;
-          }
-          else if (hashCode == InvalidArnException_HASH)
-          {
-            return BatchReadExceptionType::InvalidArnException;
-          }
-          else if (hashCode == ResourceNotFoundException_HASH)
-          {
-            return BatchReadExceptionType::ResourceNotFoundException;
-          }
-          else if (hashCode == InvalidNextTokenException_HASH)
-          {
-            return BatchReadExceptionType::InvalidNextTokenException;
-          }
-          else if (hashCode == AccessDeniedException_HASH)
-          {
-            return BatchReadExceptionType::AccessDeniedException;
-          }
-          else if (hashCode == NotNodeException_HASH)
-          {
-            return BatchReadExceptionType::NotNodeException;
-          }
-          else if (hashCode == FacetValidationException_HASH)
-          {
-            return BatchReadExceptionType::FacetValidationException;
-          }
-          else if (hashCode == CannotListParentOfRootException_HASH)
-          {
-            return BatchReadExceptionType::CannotListParentOfRootException;
-          }
-          else if (hashCode == NotIndexException_HASH)
-          {
-            return BatchReadExceptionType::NotIndexException;
-          }
-          else if (hashCode == NotPolicyException_HASH)
-          {
-            return BatchReadExceptionType::NotPolicyException;
-          }
-          else if (hashCode == DirectoryNotEnabledException_HASH)
-          {
-            return BatchReadExceptionType::DirectoryNotEnabledException;
-          }
-          else if (hashCode == LimitExceededException_HASH)
-          {
-            return BatchReadExceptionType::LimitExceededException;
-          }
-          else if (hashCode == InternalServiceException_HASH)
-          {
-            return BatchReadExceptionType::InternalServiceException;
+          case ValidationException_HASH:
+            if (name == "ValidationException")
+            {
+              return BatchReadExceptionType::ValidationException;
+            }
+            break;
+          case InvalidArnException_HASH:
+            if (name == "InvalidArnException")
+            {
+              return BatchReadExceptionType::InvalidArnException;
+            }
+            break;
+          case ResourceNotFoundException_HASH:
+            if (name == "ResourceNotFoundException")
+            {
+              return BatchReadExceptionType::ResourceNotFoundException;
+            }
+            break;
+          case InvalidNextTokenException_HASH:
+            if (name == "InvalidNextTokenException")
+            {
+              return BatchReadExceptionType::InvalidNextTokenException;
+            }
+            break;
+          case AccessDeniedException_HASH:
+            if (name == "AccessDeniedException")
+            {
+              return BatchReadExceptionType::AccessDeniedException;
+            }
+            break;
+          case NotNodeException_HASH:
+            if (name == "NotNodeException")
+            {
+              return BatchReadExceptionType::NotNodeException;
+            }
+            break;
+          case FacetValidationException_HASH:
+            if (name == "FacetValidationException")
+            {
+              return BatchReadExceptionType::FacetValidationException;
+            }
+            break;
+          case CannotListParentOfRootException_HASH:
+            if (name == "CannotListParentOfRootException")
+            {
+              return BatchReadExceptionType::CannotListParentOfRootException;
+            }
+            break;
+          case NotIndexException_HASH:
+            if (name == "NotIndexException")
+            {
+              return BatchReadExceptionType::NotIndexException;
+            }
+            break;
+          case NotPolicyException_HASH:
+            if (name == "NotPolicyException")
+            {
+              return BatchReadExceptionType::NotPolicyException;
+            }
+            break;
+          case DirectoryNotEnabledException_HASH:
+            if (name == "DirectoryNotEnabledException")
+            {
+              return BatchReadExceptionType::DirectoryNotEnabledException;
+            }
+            break;
+          case LimitExceededException_HASH:
+            if (name == "LimitExceededException")
+            {
+              return BatchReadExceptionType::LimitExceededException;
+            }
+            break;
+          case InternalServiceException_HASH:
+            if (name == "InternalServiceException")
+            {
+              return BatchReadExceptionType::InternalServiceException;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,7 +142,7 @@ namespace Aws
           return BatchReadExceptionType::NOT_SET;
         }
 
-        Aws::String GetNameForBatchReadExceptionType(BatchReadExceptionType enumValue)
+        const char* GetNameForBatchReadExceptionType(BatchReadExceptionType enumValue)
         {
           switch(enumValue)
           {
@@ -144,7 +176,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,100 +30,142 @@ namespace Aws
       namespace BatchWriteExceptionTypeMapper
       {
 
-        static const int InternalServiceException_HASH = HashingUtils::HashString("InternalServiceException");
-        static const int ValidationException_HASH = HashingUtils::HashString("ValidationException");
-        static const int InvalidArnException_HASH = HashingUtils::HashString("InvalidArnException");
-        static const int LinkNameAlreadyInUseException_HASH = HashingUtils::HashString("LinkNameAlreadyInUseException");
-        static const int StillContainsLinksException_HASH = HashingUtils::HashString("StillContainsLinksException");
-        static const int FacetValidationException_HASH = HashingUtils::HashString("FacetValidationException");
-        static const int ObjectNotDetachedException_HASH = HashingUtils::HashString("ObjectNotDetachedException");
-        static const int ResourceNotFoundException_HASH = HashingUtils::HashString("ResourceNotFoundException");
-        static const int AccessDeniedException_HASH = HashingUtils::HashString("AccessDeniedException");
-        static const int InvalidAttachmentException_HASH = HashingUtils::HashString("InvalidAttachmentException");
-        static const int NotIndexException_HASH = HashingUtils::HashString("NotIndexException");
-        static const int NotNodeException_HASH = HashingUtils::HashString("NotNodeException");
-        static const int IndexedAttributeMissingException_HASH = HashingUtils::HashString("IndexedAttributeMissingException");
-        static const int ObjectAlreadyDetachedException_HASH = HashingUtils::HashString("ObjectAlreadyDetachedException");
-        static const int NotPolicyException_HASH = HashingUtils::HashString("NotPolicyException");
-        static const int DirectoryNotEnabledException_HASH = HashingUtils::HashString("DirectoryNotEnabledException");
-        static const int LimitExceededException_HASH = HashingUtils::HashString("LimitExceededException");
-        static const int UnsupportedIndexTypeException_HASH = HashingUtils::HashString("UnsupportedIndexTypeException");
+        static constexpr int InternalServiceException_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
+        static constexpr int ValidationException_HASH = HashingUtils::CompileTimeHashString("ValidationException");
+        static constexpr int InvalidArnException_HASH = HashingUtils::CompileTimeHashString("InvalidArnException");
+        static constexpr int LinkNameAlreadyInUseException_HASH = HashingUtils::CompileTimeHashString("LinkNameAlreadyInUseException");
+        static constexpr int StillContainsLinksException_HASH = HashingUtils::CompileTimeHashString("StillContainsLinksException");
+        static constexpr int FacetValidationException_HASH = HashingUtils::CompileTimeHashString("FacetValidationException");
+        static constexpr int ObjectNotDetachedException_HASH = HashingUtils::CompileTimeHashString("ObjectNotDetachedException");
+        static constexpr int ResourceNotFoundException_HASH = HashingUtils::CompileTimeHashString("ResourceNotFoundException");
+        static constexpr int AccessDeniedException_HASH = HashingUtils::CompileTimeHashString("AccessDeniedException");
+        static constexpr int InvalidAttachmentException_HASH = HashingUtils::CompileTimeHashString("InvalidAttachmentException");
+        static constexpr int NotIndexException_HASH = HashingUtils::CompileTimeHashString("NotIndexException");
+        static constexpr int NotNodeException_HASH = HashingUtils::CompileTimeHashString("NotNodeException");
+        static constexpr int IndexedAttributeMissingException_HASH = HashingUtils::CompileTimeHashString("IndexedAttributeMissingException");
+        static constexpr int ObjectAlreadyDetachedException_HASH = HashingUtils::CompileTimeHashString("ObjectAlreadyDetachedException");
+        static constexpr int NotPolicyException_HASH = HashingUtils::CompileTimeHashString("NotPolicyException");
+        static constexpr int DirectoryNotEnabledException_HASH = HashingUtils::CompileTimeHashString("DirectoryNotEnabledException");
+        static constexpr int LimitExceededException_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+        static constexpr int UnsupportedIndexTypeException_HASH = HashingUtils::CompileTimeHashString("UnsupportedIndexTypeException");
 
 
         BatchWriteExceptionType GetBatchWriteExceptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InternalServiceException_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BatchWriteExceptionType::InternalServiceException;
-          }
-          else if (hashCode == ValidationException_HASH)
-          {
-            return BatchWriteExceptionType::ValidationException;
-          }
-          else if (hashCode == InvalidArnException_HASH)
-          {
-            return BatchWriteExceptionType::InvalidArnException;
-          }
-          else if (hashCode == LinkNameAlreadyInUseException_HASH)
-          {
-            return BatchWriteExceptionType::LinkNameAlreadyInUseException;
-          }
-          else if (hashCode == StillContainsLinksException_HASH)
-          {
-            return BatchWriteExceptionType::StillContainsLinksException;
-          }
-          else if (hashCode == FacetValidationException_HASH)
-          {
-            return BatchWriteExceptionType::FacetValidationException;
-          }
-          else if (hashCode == ObjectNotDetachedException_HASH)
-          {
-            return BatchWriteExceptionType::ObjectNotDetachedException;
-          }
-          else if (hashCode == ResourceNotFoundException_HASH)
-          {
-            return BatchWriteExceptionType::ResourceNotFoundException;
-          }
-          else if (hashCode == AccessDeniedException_HASH)
-          {
-            return BatchWriteExceptionType::AccessDeniedException;
-          }
-          else if (hashCode == InvalidAttachmentException_HASH)
-          {
-            return BatchWriteExceptionType::InvalidAttachmentException;
-          }
-          else if (hashCode == NotIndexException_HASH)
-          {
-            return BatchWriteExceptionType::NotIndexException;
-          }
-          else if (hashCode == NotNodeException_HASH)
-          {
-            return BatchWriteExceptionType::NotNodeException;
-          }
-          else if (hashCode == IndexedAttributeMissingException_HASH)
-          {
-            return BatchWriteExceptionType::IndexedAttributeMissingException;
-          }
-          else if (hashCode == ObjectAlreadyDetachedException_HASH)
-          {
-            return BatchWriteExceptionType::ObjectAlreadyDetachedException;
-          }
-          else if (hashCode == NotPolicyException_HASH)
-          {
-            return BatchWriteExceptionType::NotPolicyException;
-          }
-          else if (hashCode == DirectoryNotEnabledException_HASH)
-          {
-            return BatchWriteExceptionType::DirectoryNotEnabledException;
-          }
-          else if (hashCode == LimitExceededException_HASH)
-          {
-            return BatchWriteExceptionType::LimitExceededException;
-          }
-          else if (hashCode == UnsupportedIndexTypeException_HASH)
-          {
-            return BatchWriteExceptionType::UnsupportedIndexTypeException;
+          case InternalServiceException_HASH:
+            if (name == "InternalServiceException")
+            {
+              return BatchWriteExceptionType::InternalServiceException;
+            }
+            break;
+          case ValidationException_HASH:
+            if (name == "ValidationException")
+            {
+              return BatchWriteExceptionType::ValidationException;
+            }
+            break;
+          case InvalidArnException_HASH:
+            if (name == "InvalidArnException")
+            {
+              return BatchWriteExceptionType::InvalidArnException;
+            }
+            break;
+          case LinkNameAlreadyInUseException_HASH:
+            if (name == "LinkNameAlreadyInUseException")
+            {
+              return BatchWriteExceptionType::LinkNameAlreadyInUseException;
+            }
+            break;
+          case StillContainsLinksException_HASH:
+            if (name == "StillContainsLinksException")
+            {
+              return BatchWriteExceptionType::StillContainsLinksException;
+            }
+            break;
+          case FacetValidationException_HASH:
+            if (name == "FacetValidationException")
+            {
+              return BatchWriteExceptionType::FacetValidationException;
+            }
+            break;
+          case ObjectNotDetachedException_HASH:
+            if (name == "ObjectNotDetachedException")
+            {
+              return BatchWriteExceptionType::ObjectNotDetachedException;
+            }
+            break;
+          case ResourceNotFoundException_HASH:
+            if (name == "ResourceNotFoundException")
+            {
+              return BatchWriteExceptionType::ResourceNotFoundException;
+            }
+            break;
+          case AccessDeniedException_HASH:
+            if (name == "AccessDeniedException")
+            {
+              return BatchWriteExceptionType::AccessDeniedException;
+            }
+            break;
+          case InvalidAttachmentException_HASH:
+            if (name == "InvalidAttachmentException")
+            {
+              return BatchWriteExceptionType::InvalidAttachmentException;
+            }
+            break;
+          case NotIndexException_HASH:
+            if (name == "NotIndexException")
+            {
+              return BatchWriteExceptionType::NotIndexException;
+            }
+            break;
+          case NotNodeException_HASH:
+            if (name == "NotNodeException")
+            {
+              return BatchWriteExceptionType::NotNodeException;
+            }
+            break;
+          case IndexedAttributeMissingException_HASH:
+            if (name == "IndexedAttributeMissingException")
+            {
+              return BatchWriteExceptionType::IndexedAttributeMissingException;
+            }
+            break;
+          case ObjectAlreadyDetachedException_HASH:
+            if (name == "ObjectAlreadyDetachedException")
+            {
+              return BatchWriteExceptionType::ObjectAlreadyDetachedException;
+            }
+            break;
+          case NotPolicyException_HASH:
+            if (name == "NotPolicyException")
+            {
+              return BatchWriteExceptionType::NotPolicyException;
+            }
+            break;
+          case DirectoryNotEnabledException_HASH:
+            if (name == "DirectoryNotEnabledException")
+            {
+              return BatchWriteExceptionType::DirectoryNotEnabledException;
+            }
+            break;
+          case LimitExceededException_HASH:
+            if (name == "LimitExceededException")
+            {
+              return BatchWriteExceptionType::LimitExceededException;
+            }
+            break;
+          case UnsupportedIndexTypeException_HASH:
+            if (name == "UnsupportedIndexTypeException")
+            {
+              return BatchWriteExceptionType::UnsupportedIndexTypeException;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -135,7 +177,7 @@ namespace Aws
           return BatchWriteExceptionType::NOT_SET;
         }
 
-        Aws::String GetNameForBatchWriteExceptionType(BatchWriteExceptionType enumValue)
+        const char* GetNameForBatchWriteExceptionType(BatchWriteExceptionType enumValue)
         {
           switch(enumValue)
           {
@@ -179,7 +221,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
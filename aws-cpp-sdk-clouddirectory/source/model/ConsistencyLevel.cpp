@@ -30,20 +30,30 @@ namespace Aws
       namespace ConsistencyLevelMapper
       {
 
-        static const int SERIALIZABLE_HASH = HashingUtils::HashString("SERIALIZABLE");
-        static const int EVENTUAL_HASH = HashingUtils::HashString("EVENTUAL");
+        static constexpr int SERIALIZABLE_HASH = HashingUtils::CompileTimeHashString("SERIALIZABLE");
+        static constexpr int EVENTUAL_HASH = HashingUtils::CompileTimeHashString("EVENTUAL");
 
 
         ConsistencyLevel GetConsistencyLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SERIALIZABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConsistencyLevel::SERIALIZABLE;
-          }
-          else if (hashCode == EVENTUAL_HASH)
-          {
-            return ConsistencyLevel::EVENTUAL;
+          case SERIALIZABLE_HASH:
+            if (name == "SERIALIZABLE")
+            {
+              return ConsistencyLevel::SERIALIZABLE;
+            }
+            break;
+          case EVENTUAL_HASH:
+            if (name == "EVENTUAL")
+            {
+              return ConsistencyLevel::EVENTUAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ConsistencyLevel::NOT_SET;
         }
 
-        Aws::String GetNameForConsistencyLevel(ConsistencyLevel enumValue)
+        const char* GetNameForConsistencyLevel(ConsistencyLevel enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
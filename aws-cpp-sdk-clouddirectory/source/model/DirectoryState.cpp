@@ -30,25 +30,37 @@ namespace Aws
       namespace DirectoryStateMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         DirectoryState GetDirectoryStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DirectoryState::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return DirectoryState::DISABLED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return DirectoryState::DELETED;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return DirectoryState::ENABLED;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return DirectoryState::DISABLED;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return DirectoryState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DirectoryState::NOT_SET;
         }
 
-        Aws::String GetNameForDirectoryState(DirectoryState enumValue)
+        const char* GetNameForDirectoryState(DirectoryState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace FacetAttributeTypeMapper
       {
 
-        static const int STRING_HASH = HashingUtils::HashString("STRING");
-        static const int BINARY_HASH = HashingUtils::HashString("BINARY");
-        static const int BOOLEAN_HASH = HashingUtils::HashString("BOOLEAN");
-        static const int NUMBER_HASH = HashingUtils::HashString("NUMBER");
-        static const int DATETIME_HASH = HashingUtils::HashString("DATETIME");
-        static const int VARIANT_HASH = HashingUtils::HashString("VARIANT");
+        static constexpr int STRING_HASH = HashingUtils::CompileTimeHashString("STRING");
+        static constexpr int BINARY_HASH = HashingUtils::CompileTimeHashString("BINARY");
+        static constexpr int BOOLEAN_HASH = HashingUtils::CompileTimeHashString("BOOLEAN");
+        static constexpr int NUMBER_HASH = HashingUtils::CompileTimeHashString("NUMBER");
+        static constexpr int DATETIME_HASH = HashingUtils::CompileTimeHashString("DATETIME");
+        static constexpr int VARIANT_HASH = HashingUtils::CompileTimeHashString("VARIANT");
 
 
         FacetAttributeType GetFacetAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STRING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FacetAttributeType::STRING;
-          }
-          else if (hashCode == BINARY_HASH)
-          {
-            return FacetAttributeType::BINARY;
-          }
-          else if (hashCode == BOOLEAN_HASH)
-          {
-            return FacetAttributeType::BOOLEAN;
-          }
-          else if (hashCode == NUMBER_HASH)
-          {
-            return FacetAttributeType::NUMBER;
-          }
-          else if (hashCode == DATETIME_HASH)
-          {
-            return FacetAttributeType::DATETIME;
-          }
-          else if (hashCode == VARIANT_HASH)
-          {
-            return FacetAttributeType::VARIANT;
+          case STRING_HASH:
+            if (name == "STRING")
+            {
+              return FacetAttributeType::STRING;
+            }
+            break;
+          case BINARY_HASH:
+            if (name == "BINARY")
+            {
+              return FacetAttributeType::BINARY;
+            }
+            break;
+          case BOOLEAN_HASH:
+            if (name == "BOOLEAN")
+            {
+              return FacetAttributeType::BOOLEAN;
+            }
+            break;
+          case NUMBER_HASH:
+            if (name == "NUMBER")
+            {
+              return FacetAttributeType::NUMBER;
+            }
+            break;
+          case DATETIME_HASH:
+            if (name == "DATETIME")
+            {
+              return FacetAttributeType::DATETIME;
+            }
+            break;
+          case VARIANT_HASH:
+            if (name == "VARIANT")
+            {
+              return FacetAttributeType::VARIANT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return FacetAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForFacetAttributeType(FacetAttributeType enumValue)
+        const char* GetNameForFacetAttributeType(FacetAttributeType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ObjectTypeMapper
       {
 
-        static const int NODE_HASH = HashingUtils::HashString("NODE");
-        static const int LEAF_NODE_HASH = HashingUtils::HashString("LEAF_NODE");
-        static const int POLICY_HASH = HashingUtils::HashString("POLICY");
-        static const int INDEX_HASH = HashingUtils::HashString("INDEX");
+        static constexpr int NODE_HASH = HashingUtils::CompileTimeHashString("NODE");
+        static constexpr int LEAF_NODE_HASH = HashingUtils::CompileTimeHashString("LEAF_NODE");
+        static constexpr int POLICY_HASH = HashingUtils::CompileTimeHashString("POLICY");
+        static constexpr int INDEX_HASH = HashingUtils::CompileTimeHashString("INDEX");
 
 
         ObjectType GetObjectTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NODE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ObjectType::NODE;
-          }
-          else if (hashCode == LEAF_NODE_HASH)
-          {
-            return ObjectType::LEAF_NODE;
-          }
-          else if (hashCode == POLICY_HASH)
-          {
-            return ObjectType::POLICY;
-          }
-          else if (hashCode == INDEX_HASH)
-          {
-            return ObjectType::INDEX;
+          case NODE_HASH:
+            if (name == "NODE")
+            {
+              return ObjectType::NODE;
+            }
+            break;
+          case LEAF_NODE_HASH:
+            if (name == "LEAF_NODE")
+            {
+              return ObjectType::LEAF_NODE;
+            }
+            break;
+          case POLICY_HASH:
+            if (name == "POLICY")
+            {
+              return ObjectType::POLICY;
+            }
+            break;
+          case INDEX_HASH:
+            if (name == "INDEX")
+            {
+              return ObjectType::INDEX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ObjectType::NOT_SET;
         }
 
-        Aws::String GetNameForObjectType(ObjectType enumValue)
+        const char* GetNameForObjectType(ObjectType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace RangeModeMapper
       {
 
-        static const int FIRST_HASH = HashingUtils::HashString("FIRST");
-        static const int LAST_HASH = HashingUtils::HashString("LAST");
-        static const int LAST_BEFORE_MISSING_VALUES_HASH = HashingUtils::HashString("LAST_BEFORE_MISSING_VALUES");
-        static const int INCLUSIVE_HASH = HashingUtils::HashString("INCLUSIVE");
-        static const int EXCLUSIVE_HASH = HashingUtils::HashString("EXCLUSIVE");
+        static constexpr int FIRST_HASH = HashingUtils::CompileTimeHashString("FIRST");
+        static constexpr int LAST_HASH = HashingUtils::CompileTimeHashString("LAST");
+        static constexpr int LAST_BEFORE_MISSING_VALUES_HASH = HashingUtils::CompileTimeHashString("LAST_BEFORE_MISSING_VALUES");
+        static constexpr int INCLUSIVE_HASH = HashingUtils::CompileTimeHashString("INCLUSIVE");
+        static constexpr int EXCLUSIVE_HASH = HashingUtils::CompileTimeHashString("EXCLUSIVE");
 
 
         RangeMode GetRangeModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FIRST_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RangeMode::FIRST;
-          }
-          else if (hashCode == LAST_HASH)
-          {
-            return RangeMode::LAST;
-          }
-          else if (hashCode == LAST_BEFORE_MISSING_VALUES_HASH)
-          {
-            return RangeMode::LAST_BEFORE_MISSING_VALUES;
-          }
-          else if (hashCode == INCLUSIVE_HASH)
-          {
-            return RangeMode::INCLUSIVE;
-          }
-          else if (hashCode == EXCLUSIVE_HASH)
-          {
-            return RangeMode::EXCLUSIVE;
+          case FIRST_HASH:
+            if (name == "FIRST")
+            {
+              return RangeMode::FIRST;
+            }
+            break;
+          case LAST_HASH:
+            if (name == "LAST")
+            {
+              return RangeMode::LAST;
+            }
+            break;
+          case LAST_BEFORE_MISSING_VALUES_HASH:
+            if (name == "LAST_BEFORE_MISSING_VALUES")
+            {
+              return RangeMode::LAST_BEFORE_MISSING_VALUES;
+            }
+            break;
+          case INCLUSIVE_HASH:
+            if (name == "INCLUSIVE")
+            {
+              return RangeMode::INCLUSIVE;
+            }
+            break;
+          case EXCLUSIVE_HASH:
+            if (name == "EXCLUSIVE")
+            {
+              return RangeMode::EXCLUSIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return RangeMode::NOT_SET;
         }
 
-        Aws::String GetNameForRangeMode(RangeMode enumValue)
+        const char* GetNameForRangeMode(RangeMode enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
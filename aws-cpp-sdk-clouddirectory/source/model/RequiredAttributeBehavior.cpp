@@ -30,20 +30,30 @@ namespace Aws
       namespace RequiredAttributeBehaviorMapper
       {
 
-        static const int REQUIRED_ALWAYS_HASH = HashingUtils::HashString("REQUIRED_ALWAYS");
-        static const int NOT_REQUIRED_HASH = HashingUtils::HashString("NOT_REQUIRED");
+        static constexpr int REQUIRED_ALWAYS_HASH = HashingUtils::CompileTimeHashString("REQUIRED_ALWAYS");
+        static constexpr int NOT_REQUIRED_HASH = HashingUtils::CompileTimeHashString("NOT_REQUIRED");
 
 
         RequiredAttributeBehavior GetRequiredAttributeBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REQUIRED_ALWAYS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RequiredAttributeBehavior::REQUIRED_ALWAYS;
-          }
-          else if (hashCode == NOT_REQUIRED_HASH)
-          {
-            return RequiredAttributeBehavior::NOT_REQUIRED;
+          case REQUIRED_ALWAYS_HASH:
+            if (name == "REQUIRED_ALWAYS")
+            {
+              return RequiredAttributeBehavior::REQUIRED_ALWAYS;
+            }
+            break;
+          case NOT_REQUIRED_HASH:
+            if (name == "NOT_REQUIRED")
+            {
+              return RequiredAttributeBehavior::NOT_REQUIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RequiredAttributeBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForRequiredAttributeBehavior(RequiredAttributeBehavior enumValue)
+        const char* GetNameForRequiredAttributeBehavior(RequiredAttributeBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace RuleTypeMapper
       {
 
-        static const int BINARY_LENGTH_HASH = HashingUtils::HashString("BINARY_LENGTH");
-        static const int NUMBER_COMPARISON_HASH = HashingUtils::HashString("NUMBER_COMPARISON");
-        static const int STRING_FROM_SET_HASH = HashingUtils::HashString("STRING_FROM_SET");
-        static const int STRING_LENGTH_HASH = HashingUtils::HashString("STRING_LENGTH");
+        static constexpr int BINARY_LENGTH_HASH = HashingUtils::CompileTimeHashString("BINARY_LENGTH");
+        static constexpr int NUMBER_COMPARISON_HASH = HashingUtils::CompileTimeHashString("NUMBER_COMPARISON");
+        static constexpr int STRING_FROM_SET_HASH = HashingUtils::CompileTimeHashString("STRING_FROM_SET");
+        static constexpr int STRING_LENGTH_HASH = HashingUtils::CompileTimeHashString("STRING_LENGTH");
 
 
         RuleType GetRuleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BINARY_LENGTH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RuleType::BINARY_LENGTH;
-          }
-          else if (hashCode == NUMBER_COMPARISON_HASH)
-          {
-            return RuleType::NUMBER_COMPARISON;
-          }
-          else if (hashCode == STRING_FROM_SET_HASH)
-          {
-            return RuleType::STRING_FROM_SET;
-          }
-          else if (hashCode == STRING_LENGTH_HASH)
-          {
-            return RuleType::STRING_LENGTH;
+          case BINARY_LENGTH_HASH:
+            if (name == "BINARY_LENGTH")
+            {
+              return RuleType::BINARY_LENGTH;
+            }
+            break;
+          case NUMBER_COMPARISON_HASH:
+            if (name == "NUMBER_COMPARISON")
+            {
+              return RuleType::NUMBER_COMPARISON;
+            }
+            break;
+          case STRING_FROM_SET_HASH:
+            if (name == "STRING_FROM_SET")
+            {
+              return RuleType::STRING_FROM_SET;
+            }
+            break;
+          case STRING_LENGTH_HASH:
+            if (name == "STRING_LENGTH")
+            {
+              return RuleType::STRING_LENGTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return RuleType::NOT_SET;
         }
 
-        Aws::String GetNameForRuleType(RuleType enumValue)
+        const char* GetNameForRuleType(RuleType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
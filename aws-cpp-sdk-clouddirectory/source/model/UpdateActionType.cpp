@@ -30,20 +30,30 @@ namespace Aws
       namespace UpdateActionTypeMapper
       {
 
-        static const int CREATE_OR_UPDATE_HASH = HashingUtils::HashString("CREATE_OR_UPDATE");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
+        static constexpr int CREATE_OR_UPDATE_HASH = HashingUtils::CompileTimeHashString("CREATE_OR_UPDATE");
+        static constexpr int DELETE__HASH = HashingUtils::CompileTimeHashString("DELETE");
 
 
         UpdateActionType GetUpdateActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_OR_UPDATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UpdateActionType::CREATE_OR_UPDATE;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return UpdateActionType::DELETE_;
+          case CREATE_OR_UPDATE_HASH:
+            if (name == "CREATE_OR_UPDATE")
+            {
+              return UpdateActionType::CREATE_OR_UPDATE;
+            }
+            break;
+          case DELETE__HASH:
+            if (name == "DELETE")
+            {
+              return UpdateActionType::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return UpdateActionType::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateActionType(UpdateActionType enumValue)
+        const char* GetNameForUpdateActionType(UpdateActionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
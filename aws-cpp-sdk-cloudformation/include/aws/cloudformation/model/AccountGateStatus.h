@@ -35,7 +35,8 @@ namespace AccountGateStatusMapper
 {
 AWS_CLOUDFORMATION_API AccountGateStatus GetAccountGateStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForAccountGateStatus(AccountGateStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForAccountGateStatus(AccountGateStatus value);
 } // namespace AccountGateStatusMapper
 } // namespace Model
 } // namespace CloudFormation
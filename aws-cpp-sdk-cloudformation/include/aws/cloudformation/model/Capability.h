@@ -34,7 +34,8 @@ namespace CapabilityMapper
 {
 AWS_CLOUDFORMATION_API Capability GetCapabilityForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForCapability(Capability value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForCapability(Capability value);
 } // namespace CapabilityMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -35,7 +35,8 @@ namespace ChangeActionMapper
 {
 AWS_CLOUDFORMATION_API ChangeAction GetChangeActionForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForChangeAction(ChangeAction value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForChangeAction(ChangeAction value);
 } // namespace ChangeActionMapper
 } // namespace Model
 } // namespace CloudFormation
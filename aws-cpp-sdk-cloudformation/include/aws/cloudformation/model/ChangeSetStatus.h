@@ -37,7 +37,8 @@ namespace ChangeSetStatusMapper
 {
 AWS_CLOUDFORMATION_API ChangeSetStatus GetChangeSetStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForChangeSetStatus(ChangeSetStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForChangeSetStatus(ChangeSetStatus value);
 } // namespace ChangeSetStatusMapper
 } // namespace Model
 } // namespace CloudFormation
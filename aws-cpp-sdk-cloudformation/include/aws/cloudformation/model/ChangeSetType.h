@@ -34,7 +34,8 @@ namespace ChangeSetTypeMapper
 {
 AWS_CLOUDFORMATION_API ChangeSetType GetChangeSetTypeForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForChangeSetType(ChangeSetType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForChangeSetType(ChangeSetType value);
 } // namespace ChangeSetTypeMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -37,7 +37,8 @@ namespace ChangeSourceMapper
 {
 AWS_CLOUDFORMATION_API ChangeSource GetChangeSourceForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForChangeSource(ChangeSource value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForChangeSource(ChangeSource value);
 } // namespace ChangeSourceMapper
 } // namespace Model
 } // namespace CloudFormation
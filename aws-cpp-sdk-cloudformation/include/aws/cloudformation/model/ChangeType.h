@@ -33,7 +33,8 @@ namespace ChangeTypeMapper
 {
 AWS_CLOUDFORMATION_API ChangeType GetChangeTypeForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForChangeType(ChangeType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForChangeType(ChangeType value);
 } // namespace ChangeTypeMapper
 } // namespace Model
 } // namespace CloudFormation
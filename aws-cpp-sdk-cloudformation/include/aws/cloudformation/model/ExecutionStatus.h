@@ -38,7 +38,8 @@ namespace ExecutionStatusMapper
 {
 AWS_CLOUDFORMATION_API ExecutionStatus GetExecutionStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForExecutionStatus(ExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForExecutionStatus(ExecutionStatus value);
 } // namespace ExecutionStatusMapper
 } // namespace Model
 } // namespace CloudFormation
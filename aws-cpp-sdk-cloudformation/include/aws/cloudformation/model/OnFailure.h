@@ -35,7 +35,8 @@ namespace OnFailureMapper
 {
 AWS_CLOUDFORMATION_API OnFailure GetOnFailureForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForOnFailure(OnFailure value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForOnFailure(OnFailure value);
 } // namespace OnFailureMapper
 } // namespace Model
 } // namespace CloudFormation
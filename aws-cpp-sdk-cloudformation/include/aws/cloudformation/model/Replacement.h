@@ -35,7 +35,8 @@ namespace ReplacementMapper
 {
 AWS_CLOUDFORMATION_API Replacement GetReplacementForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForReplacement(Replacement value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForReplacement(Replacement value);
 } // namespace ReplacementMapper
 } // namespace Model
 } // namespace CloudFormation
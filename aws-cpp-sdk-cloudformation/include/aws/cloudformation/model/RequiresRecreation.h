@@ -35,7 +35,8 @@ namespace RequiresRecreationMapper
 {
 AWS_CLOUDFORMATION_API RequiresRecreation GetRequiresRecreationForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForRequiresRecreation(RequiresRecreation value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForRequiresRecreation(RequiresRecreation value);
 } // namespace RequiresRecreationMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -38,7 +38,8 @@ namespace ResourceAttributeMapper
 {
 AWS_CLOUDFORMATION_API ResourceAttribute GetResourceAttributeForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForResourceAttribute(ResourceAttribute value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForResourceAttribute(ResourceAttribute value);
 } // namespace ResourceAttributeMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -34,7 +34,8 @@ namespace ResourceSignalStatusMapper
 {
 AWS_CLOUDFORMATION_API ResourceSignalStatus GetResourceSignalStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForResourceSignalStatus(ResourceSignalStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForResourceSignalStatus(ResourceSignalStatus value);
 } // namespace ResourceSignalStatusMapper
 } // namespace Model
 } // namespace CloudFormation
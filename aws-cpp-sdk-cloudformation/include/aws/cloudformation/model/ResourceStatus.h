@@ -42,7 +42,8 @@ namespace ResourceStatusMapper
 {
 AWS_CLOUDFORMATION_API ResourceStatus GetResourceStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForResourceStatus(ResourceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForResourceStatus(ResourceStatus value);
 } // namespace ResourceStatusMapper
 } // namespace Model
 } // namespace CloudFormation
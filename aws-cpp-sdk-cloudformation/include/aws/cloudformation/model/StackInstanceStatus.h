@@ -35,7 +35,8 @@ namespace StackInstanceStatusMapper
 {
 AWS_CLOUDFORMATION_API StackInstanceStatus GetStackInstanceStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForStackInstanceStatus(StackInstanceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForStackInstanceStatus(StackInstanceStatus value);
 } // namespace StackInstanceStatusMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -35,7 +35,8 @@ namespace StackSetOperationActionMapper
 {
 AWS_CLOUDFORMATION_API StackSetOperationAction GetStackSetOperationActionForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForStackSetOperationAction(StackSetOperationAction value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForStackSetOperationAction(StackSetOperationAction value);
 } // namespace StackSetOperationActionMapper
 } // namespace Model
 } // namespace CloudFormation
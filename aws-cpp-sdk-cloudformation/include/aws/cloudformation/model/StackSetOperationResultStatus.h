@@ -37,7 +37,8 @@ namespace StackSetOperationResultStatusMapper
 {
 AWS_CLOUDFORMATION_API StackSetOperationResultStatus GetStackSetOperationResultStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForStackSetOperationResultStatus(StackSetOperationResultStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForStackSetOperationResultStatus(StackSetOperationResultStatus value);
 } // namespace StackSetOperationResultStatusMapper
 } // namespace Model
 } // namespace CloudFormation
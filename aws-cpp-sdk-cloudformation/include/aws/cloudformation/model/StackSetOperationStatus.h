@@ -37,7 +37,8 @@ namespace StackSetOperationStatusMapper
 {
 AWS_CLOUDFORMATION_API StackSetOperationStatus GetStackSetOperationStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForStackSetOperationStatus(StackSetOperationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForStackSetOperationStatus(StackSetOperationStatus value);
 } // namespace StackSetOperationStatusMapper
 } // namespace Model
 } // namespace CloudFormation
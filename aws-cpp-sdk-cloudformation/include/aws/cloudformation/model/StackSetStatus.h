@@ -34,7 +34,8 @@ namespace StackSetStatusMapper
 {
 AWS_CLOUDFORMATION_API StackSetStatus GetStackSetStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForStackSetStatus(StackSetStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForStackSetStatus(StackSetStatus value);
 } // namespace StackSetStatusMapper
 } // namespace Model
 } // namespace CloudFormation
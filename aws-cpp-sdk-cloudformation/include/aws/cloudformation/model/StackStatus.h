@@ -49,7 +49,8 @@ namespace StackStatusMapper
 {
 AWS_CLOUDFORMATION_API StackStatus GetStackStatusForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForStackStatus(StackStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForStackStatus(StackStatus value);
 } // namespace StackStatusMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -34,7 +34,8 @@ namespace TemplateStageMapper
 {
 AWS_CLOUDFORMATION_API TemplateStage GetTemplateStageForName(const Aws::String& name);
 
-AWS_CLOUDFORMATION_API Aws::String GetNameForTemplateStage(TemplateStage value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFORMATION_API const char* GetNameForTemplateStage(TemplateStage value);
 } // namespace TemplateStageMapper
 } // namespace Model
 } // namespace CloudFormation
@@ -28,22 +28,22 @@ namespace CloudFormation
 namespace CloudFormationErrorMapper
 {
 
-static const int STALE_REQUEST_HASH = HashingUtils::HashString("StaleRequestException");
-static const int TOKEN_ALREADY_EXISTS_HASH = HashingUtils::HashString("TokenAlreadyExistsException");
-static const int OPERATION_NOT_FOUND_HASH = HashingUtils::HashString("OperationNotFoundException");
-static const int ALREADY_EXISTS_HASH = HashingUtils::HashString("AlreadyExistsException");
-static const int STACK_SET_NOT_FOUND_HASH = HashingUtils::HashString("StackSetNotFoundException");
-static const int OPERATION_ID_ALREADY_EXISTS_HASH = HashingUtils::HashString("OperationIdAlreadyExistsException");
-static const int INVALID_CHANGE_SET_STATUS_HASH = HashingUtils::HashString("InvalidChangeSetStatus");
-static const int OPERATION_IN_PROGRESS_HASH = HashingUtils::HashString("OperationInProgressException");
-static const int CHANGE_SET_NOT_FOUND_HASH = HashingUtils::HashString("ChangeSetNotFound");
-static const int STACK_SET_NOT_EMPTY_HASH = HashingUtils::HashString("StackSetNotEmptyException");
-static const int INSUFFICIENT_CAPABILITIES_HASH = HashingUtils::HashString("InsufficientCapabilitiesException");
-static const int CREATED_BUT_MODIFIED_HASH = HashingUtils::HashString("CreatedButModifiedException");
-static const int INVALID_OPERATION_HASH = HashingUtils::HashString("InvalidOperationException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int NAME_ALREADY_EXISTS_HASH = HashingUtils::HashString("NameAlreadyExistsException");
-static const int STACK_INSTANCE_NOT_FOUND_HASH = HashingUtils::HashString("StackInstanceNotFoundException");
+static constexpr int STALE_REQUEST_HASH = HashingUtils::CompileTimeHashString("StaleRequestException");
+static constexpr int TOKEN_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("TokenAlreadyExistsException");
+static constexpr int OPERATION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("OperationNotFoundException");
+static constexpr int ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("AlreadyExistsException");
+static constexpr int STACK_SET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("StackSetNotFoundException");
+static constexpr int OPERATION_ID_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("OperationIdAlreadyExistsException");
+static constexpr int INVALID_CHANGE_SET_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidChangeSetStatus");
+static constexpr int OPERATION_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("OperationInProgressException");
+static constexpr int CHANGE_SET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ChangeSetNotFound");
+static constexpr int STACK_SET_NOT_EMPTY_HASH = HashingUtils::CompileTimeHashString("StackSetNotEmptyException");
+static constexpr int INSUFFICIENT_CAPABILITIES_HASH = HashingUtils::CompileTimeHashString("InsufficientCapabilitiesException");
+static constexpr int CREATED_BUT_MODIFIED_HASH = HashingUtils::CompileTimeHashString("CreatedButModifiedException");
+static constexpr int INVALID_OPERATION_HASH = HashingUtils::CompileTimeHashString("InvalidOperationException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int NAME_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("NameAlreadyExistsException");
+static constexpr int STACK_INSTANCE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("StackInstanceNotFoundException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
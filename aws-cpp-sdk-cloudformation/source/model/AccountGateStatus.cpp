@@ -30,25 +30,37 @@ namespace Aws
       namespace AccountGateStatusMapper
       {
 
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SKIPPED_HASH = HashingUtils::HashString("SKIPPED");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int SKIPPED_HASH = HashingUtils::CompileTimeHashString("SKIPPED");
 
 
         AccountGateStatus GetAccountGateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccountGateStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AccountGateStatus::FAILED;
-          }
-          else if (hashCode == SKIPPED_HASH)
-          {
-            return AccountGateStatus::SKIPPED;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return AccountGateStatus::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return AccountGateStatus::FAILED;
+            }
+            break;
+          case SKIPPED_HASH:
+            if (name == "SKIPPED")
+            {
+              return AccountGateStatus::SKIPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AccountGateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAccountGateStatus(AccountGateStatus enumValue)
+        const char* GetNameForAccountGateStatus(AccountGateStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
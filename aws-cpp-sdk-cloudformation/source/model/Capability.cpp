@@ -30,20 +30,30 @@ namespace Aws
       namespace CapabilityMapper
       {
 
-        static const int CAPABILITY_IAM_HASH = HashingUtils::HashString("CAPABILITY_IAM");
-        static const int CAPABILITY_NAMED_IAM_HASH = HashingUtils::HashString("CAPABILITY_NAMED_IAM");
+        static constexpr int CAPABILITY_IAM_HASH = HashingUtils::CompileTimeHashString("CAPABILITY_IAM");
+        static constexpr int CAPABILITY_NAMED_IAM_HASH = HashingUtils::CompileTimeHashString("CAPABILITY_NAMED_IAM");
 
 
         Capability GetCapabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CAPABILITY_IAM_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Capability::CAPABILITY_IAM;
-          }
-          else if (hashCode == CAPABILITY_NAMED_IAM_HASH)
-          {
-            return Capability::CAPABILITY_NAMED_IAM;
+          case CAPABILITY_IAM_HASH:
+            if (name == "CAPABILITY_IAM")
+            {
+              return Capability::CAPABILITY_IAM;
+            }
+            break;
+          case CAPABILITY_NAMED_IAM_HASH:
+            if (name == "CAPABILITY_NAMED_IAM")
+            {
+              return Capability::CAPABILITY_NAMED_IAM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Capability::NOT_SET;
         }
 
-        Aws::String GetNameForCapability(Capability enumValue)
+        const char* GetNameForCapability(Capability enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
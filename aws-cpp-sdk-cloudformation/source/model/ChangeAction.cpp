@@ -30,25 +30,37 @@ namespace Aws
       namespace ChangeActionMapper
       {
 
-        static const int Add_HASH = HashingUtils::HashString("Add");
-        static const int Modify_HASH = HashingUtils::HashString("Modify");
-        static const int Remove_HASH = HashingUtils::HashString("Remove");
+        static constexpr int Add_HASH = HashingUtils::CompileTimeHashString("Add");
+        static constexpr int Modify_HASH = HashingUtils::CompileTimeHashString("Modify");
+        static constexpr int Remove_HASH = HashingUtils::CompileTimeHashString("Remove");
 
 
         ChangeAction GetChangeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Add_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeAction::Add;
-          }
-          else if (hashCode == Modify_HASH)
-          {
-            return ChangeAction::Modify;
-          }
-          else if (hashCode == Remove_HASH)
-          {
-            return ChangeAction::Remove;
+          case Add_HASH:
+            if (name == "Add")
+            {
+              return ChangeAction::Add;
+            }
+            break;
+          case Modify_HASH:
+            if (name == "Modify")
+            {
+              return ChangeAction::Modify;
+            }
+            break;
+          case Remove_HASH:
+            if (name == "Remove")
+            {
+              return ChangeAction::Remove;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ChangeAction::NOT_SET;
         }
 
-        Aws::String GetNameForChangeAction(ChangeAction enumValue)
+        const char* GetNameForChangeAction(ChangeAction enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
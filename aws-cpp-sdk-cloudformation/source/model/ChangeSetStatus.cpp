@@ -30,35 +30,51 @@ namespace Aws
       namespace ChangeSetStatusMapper
       {
 
-        static const int CREATE_PENDING_HASH = HashingUtils::HashString("CREATE_PENDING");
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int DELETE_COMPLETE_HASH = HashingUtils::HashString("DELETE_COMPLETE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int CREATE_PENDING_HASH = HashingUtils::CompileTimeHashString("CREATE_PENDING");
+        static constexpr int CREATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATE_IN_PROGRESS");
+        static constexpr int CREATE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("CREATE_COMPLETE");
+        static constexpr int DELETE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("DELETE_COMPLETE");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         ChangeSetStatus GetChangeSetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeSetStatus::CREATE_PENDING;
-          }
-          else if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
-            return ChangeSetStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
-            return ChangeSetStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == DELETE_COMPLETE_HASH)
-          {
-            return ChangeSetStatus::DELETE_COMPLETE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ChangeSetStatus::FAILED;
+          case CREATE_PENDING_HASH:
+            if (name == "CREATE_PENDING")
+            {
+              return ChangeSetStatus::CREATE_PENDING;
+            }
+            break;
+          case CREATE_IN_PROGRESS_HASH:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return ChangeSetStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case CREATE_COMPLETE_HASH:
+            if (name == "CREATE_COMPLETE")
+            {
+              return ChangeSetStatus::CREATE_COMPLETE;
+            }
+            break;
+          case DELETE_COMPLETE_HASH:
+            if (name == "DELETE_COMPLETE")
+            {
+              return ChangeSetStatus::DELETE_COMPLETE;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ChangeSetStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ChangeSetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForChangeSetStatus(ChangeSetStatus enumValue)
+        const char* GetNameForChangeSetStatus(ChangeSetStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ChangeSetTypeMapper
       {
 
-        static const int CREATE_HASH = HashingUtils::HashString("CREATE");
-        static const int UPDATE_HASH = HashingUtils::HashString("UPDATE");
+        static constexpr int CREATE_HASH = HashingUtils::CompileTimeHashString("CREATE");
+        static constexpr int UPDATE_HASH = HashingUtils::CompileTimeHashString("UPDATE");
 
 
         ChangeSetType GetChangeSetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeSetType::CREATE;
-          }
-          else if (hashCode == UPDATE_HASH)
-          {
-            return ChangeSetType::UPDATE;
+          case CREATE_HASH:
+            if (name == "CREATE")
+            {
+              return ChangeSetType::CREATE;
+            }
+            break;
+          case UPDATE_HASH:
+            if (name == "UPDATE")
+            {
+              return ChangeSetType::UPDATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ChangeSetType::NOT_SET;
         }
 
-        Aws::String GetNameForChangeSetType(ChangeSetType enumValue)
+        const char* GetNameForChangeSetType(ChangeSetType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
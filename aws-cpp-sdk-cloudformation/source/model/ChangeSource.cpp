@@ -30,35 +30,51 @@ namespace Aws
       namespace ChangeSourceMapper
       {
 
-        static const int ResourceReference_HASH = HashingUtils::HashString("ResourceReference");
-        static const int ParameterReference_HASH = HashingUtils::HashString("ParameterReference");
-        static const int ResourceAttribute_HASH = HashingUtils::HashString("ResourceAttribute");
-        static const int DirectModification_HASH = HashingUtils::HashString("DirectModification");
-        static const int Automatic_HASH = HashingUtils::HashString("Automatic");
+        static constexpr int ResourceReference_HASH = HashingUtils::CompileTimeHashString("ResourceReference");
+        static constexpr int ParameterReference_HASH = HashingUtils::CompileTimeHashString("ParameterReference");
+        static constexpr int ResourceAttribute_HASH = HashingUtils::CompileTimeHashString("ResourceAttribute");
+        static constexpr int DirectModification_HASH = HashingUtils::CompileTimeHashString("DirectModification");
+        static constexpr int Automatic_HASH = HashingUtils::CompileTimeHashString("Automatic");
 
 
         ChangeSource GetChangeSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ResourceReference_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeSource::ResourceReference;
-          }
-          else if (hashCode == ParameterReference_HASH)
-          {
-            return ChangeSource::ParameterReference;
-          }
-          else if (hashCode == ResourceAttribute_HASH)
-          {
-            return ChangeSource::ResourceAttribute;
-          }
-          else if (hashCode == DirectModification_HASH)
-          {
-            return ChangeSource::DirectModification;
-          }
-          else if (hashCode == Automatic_HASH)
-          {
-            return ChangeSource::Automatic;
+          case ResourceReference_HASH:
+            if (name == "ResourceReference")
+            {
+              return ChangeSource::ResourceReference;
+            }
+            break;
+          case ParameterReference_HASH:
+            if (name == "ParameterReference")
+            {
+              return ChangeSource::ParameterReference;
+            }
+            break;
+          case ResourceAttribute_HASH:
+            if (name == "ResourceAttribute")
+            {
+              return ChangeSource::ResourceAttribute;
+            }
+            break;
+          case DirectModification_HASH:
+            if (name == "DirectModification")
+            {
+              return ChangeSource::DirectModification;
+            }
+            break;
+          case Automatic_HASH:
+            if (name == "Automatic")
+            {
+              return ChangeSource::Automatic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ChangeSource::NOT_SET;
         }
 
-        Aws::String GetNameForChangeSource(ChangeSource enumValue)
+        const char* GetNameForChangeSource(ChangeSource enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
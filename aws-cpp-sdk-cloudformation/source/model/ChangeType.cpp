@@ -30,15 +30,23 @@ namespace Aws
       namespace ChangeTypeMapper
       {
 
-        static const int Resource_HASH = HashingUtils::HashString("Resource");
+        static constexpr int Resource_HASH = HashingUtils::CompileTimeHashString("Resource");
 
 
         ChangeType GetChangeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Resource_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeType::Resource;
+          case Resource_HASH:
+            if (name == "Resource")
+            {
+              return ChangeType::Resource;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ChangeType::NOT_SET;
         }
 
-        Aws::String GetNameForChangeType(ChangeType enumValue)
+        const char* GetNameForChangeType(ChangeType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
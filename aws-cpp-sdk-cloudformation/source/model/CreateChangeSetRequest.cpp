@@ -81,7 +81,7 @@ Aws::String CreateChangeSetRequest::SerializePayload() const
     for(auto& item : m_capabilities)
     {
       ss << "Capabilities.member." << capabilitiesCount << "="
-          << StringUtils::URLEncode(CapabilityMapper::GetNameForCapability(item).c_str()) << "&";
+          << StringUtils::URLEncode(CapabilityMapper::GetNameForCapability(item)) << "&";
       capabilitiesCount++;
     }
   }
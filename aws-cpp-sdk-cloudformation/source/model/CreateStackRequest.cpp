@@ -106,7 +106,7 @@ Aws::String CreateStackRequest::SerializePayload() const
     for(auto& item : m_capabilities)
     {
       ss << "Capabilities.member." << capabilitiesCount << "="
-          << StringUtils::URLEncode(CapabilityMapper::GetNameForCapability(item).c_str()) << "&";
+          << StringUtils::URLEncode(CapabilityMapper::GetNameForCapability(item)) << "&";
       capabilitiesCount++;
     }
   }
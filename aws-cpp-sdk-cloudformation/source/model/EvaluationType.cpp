@@ -30,20 +30,30 @@ namespace Aws
       namespace EvaluationTypeMapper
       {
 
-        static const int Static_HASH = HashingUtils::HashString("Static");
-        static const int Dynamic_HASH = HashingUtils::HashString("Dynamic");
+        static constexpr int Static_HASH = HashingUtils::CompileTimeHashString("Static");
+        static constexpr int Dynamic_HASH = HashingUtils::CompileTimeHashString("Dynamic");
 
 
         EvaluationType GetEvaluationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Static_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EvaluationType::Static;
-          }
-          else if (hashCode == Dynamic_HASH)
-          {
-            return EvaluationType::Dynamic;
+          case Static_HASH:
+            if (name == "Static")
+            {
+              return EvaluationType::Static;
+            }
+            break;
+          case Dynamic_HASH:
+            if (name == "Dynamic")
+            {
+              return EvaluationType::Dynamic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EvaluationType::NOT_SET;
         }
 
-        Aws::String GetNameForEvaluationType(EvaluationType enumValue)
+        const char* GetNameForEvaluationType(EvaluationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
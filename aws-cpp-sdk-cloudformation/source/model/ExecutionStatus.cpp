@@ -30,40 +30,58 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int EXECUTE_IN_PROGRESS_HASH = HashingUtils::HashString("EXECUTE_IN_PROGRESS");
-        static const int EXECUTE_COMPLETE_HASH = HashingUtils::HashString("EXECUTE_COMPLETE");
-        static const int EXECUTE_FAILED_HASH = HashingUtils::HashString("EXECUTE_FAILED");
-        static const int OBSOLETE_HASH = HashingUtils::HashString("OBSOLETE");
+        static constexpr int UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("UNAVAILABLE");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int EXECUTE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("EXECUTE_IN_PROGRESS");
+        static constexpr int EXECUTE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("EXECUTE_COMPLETE");
+        static constexpr int EXECUTE_FAILED_HASH = HashingUtils::CompileTimeHashString("EXECUTE_FAILED");
+        static constexpr int OBSOLETE_HASH = HashingUtils::CompileTimeHashString("OBSOLETE");
 
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNAVAILABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExecutionStatus::UNAVAILABLE;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return ExecutionStatus::AVAILABLE;
-          }
-          else if (hashCode == EXECUTE_IN_PROGRESS_HASH)
-          {
-            return ExecutionStatus::EXECUTE_IN_PROGRESS;
-          }
-          else if (hashCode == EXECUTE_COMPLETE_HASH)
-          {
-            return ExecutionStatus::EXECUTE_COMPLETE;
-          }
-          else if (hashCode == EXECUTE_FAILED_HASH)
-          {
-            return ExecutionStatus::EXECUTE_FAILED;
-          }
-          else if (hashCode == OBSOLETE_HASH)
-          {
-            return ExecutionStatus::OBSOLETE;
+          case UNAVAILABLE_HASH:
+            if (name == "UNAVAILABLE")
+            {
+              return ExecutionStatus::UNAVAILABLE;
+            }
+            break;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return ExecutionStatus::AVAILABLE;
+            }
+            break;
+          case EXECUTE_IN_PROGRESS_HASH:
+            if (name == "EXECUTE_IN_PROGRESS")
+            {
+              return ExecutionStatus::EXECUTE_IN_PROGRESS;
+            }
+            break;
+          case EXECUTE_COMPLETE_HASH:
+            if (name == "EXECUTE_COMPLETE")
+            {
+              return ExecutionStatus::EXECUTE_COMPLETE;
+            }
+            break;
+          case EXECUTE_FAILED_HASH:
+            if (name == "EXECUTE_FAILED")
+            {
+              return ExecutionStatus::EXECUTE_FAILED;
+            }
+            break;
+          case OBSOLETE_HASH:
+            if (name == "OBSOLETE")
+            {
+              return ExecutionStatus::OBSOLETE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        const char* GetNameForExecutionStatus(ExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
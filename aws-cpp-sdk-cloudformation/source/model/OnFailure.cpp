@@ -30,25 +30,37 @@ namespace Aws
       namespace OnFailureMapper
       {
 
-        static const int DO_NOTHING_HASH = HashingUtils::HashString("DO_NOTHING");
-        static const int ROLLBACK_HASH = HashingUtils::HashString("ROLLBACK");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
+        static constexpr int DO_NOTHING_HASH = HashingUtils::CompileTimeHashString("DO_NOTHING");
+        static constexpr int ROLLBACK_HASH = HashingUtils::CompileTimeHashString("ROLLBACK");
+        static constexpr int DELETE__HASH = HashingUtils::CompileTimeHashString("DELETE");
 
 
         OnFailure GetOnFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DO_NOTHING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OnFailure::DO_NOTHING;
-          }
-          else if (hashCode == ROLLBACK_HASH)
-          {
-            return OnFailure::ROLLBACK;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return OnFailure::DELETE_;
+          case DO_NOTHING_HASH:
+            if (name == "DO_NOTHING")
+            {
+              return OnFailure::DO_NOTHING;
+            }
+            break;
+          case ROLLBACK_HASH:
+            if (name == "ROLLBACK")
+            {
+              return OnFailure::ROLLBACK;
+            }
+            break;
+          case DELETE__HASH:
+            if (name == "DELETE")
+            {
+              return OnFailure::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return OnFailure::NOT_SET;
         }
 
-        Aws::String GetNameForOnFailure(OnFailure enumValue)
+        const char* GetNameForOnFailure(OnFailure enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ReplacementMapper
       {
 
-        static const int True_HASH = HashingUtils::HashString("True");
-        static const int False_HASH = HashingUtils::HashString("False");
-        static const int Conditional_HASH = HashingUtils::HashString("Conditional");
+        static constexpr int True_HASH = HashingUtils::CompileTimeHashString("True");
+        static constexpr int False_HASH = HashingUtils::CompileTimeHashString("False");
+        static constexpr int Conditional_HASH = HashingUtils::CompileTimeHashString("Conditional");
 
 
         Replacement GetReplacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == True_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Replacement::True;
-          }
-          else if (hashCode == False_HASH)
-          {
-            return Replacement::False;
-          }
-          else if (hashCode == Conditional_HASH)
-          {
-            return Replacement::Conditional;
+          case True_HASH:
+            if (name == "True")
+            {
+              return Replacement::True;
+            }
+            break;
+          case False_HASH:
+            if (name == "False")
+            {
+              return Replacement::False;
+            }
+            break;
+          case Conditional_HASH:
+            if (name == "Conditional")
+            {
+              return Replacement::Conditional;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Replacement::NOT_SET;
         }
 
-        Aws::String GetNameForReplacement(Replacement enumValue)
+        const char* GetNameForReplacement(Replacement enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace RequiresRecreationMapper
       {
 
-        static const int Never_HASH = HashingUtils::HashString("Never");
-        static const int Conditionally_HASH = HashingUtils::HashString("Conditionally");
-        static const int Always_HASH = HashingUtils::HashString("Always");
+        static constexpr int Never_HASH = HashingUtils::CompileTimeHashString("Never");
+        static constexpr int Conditionally_HASH = HashingUtils::CompileTimeHashString("Conditionally");
+        static constexpr int Always_HASH = HashingUtils::CompileTimeHashString("Always");
 
 
         RequiresRecreation GetRequiresRecreationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Never_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RequiresRecreation::Never;
-          }
-          else if (hashCode == Conditionally_HASH)
-          {
-            return RequiresRecreation::Conditionally;
-          }
-          else if (hashCode == Always_HASH)
-          {
-            return RequiresRecreation::Always;
+          case Never_HASH:
+            if (name == "Never")
+            {
+              return RequiresRecreation::Never;
+            }
+            break;
+          case Conditionally_HASH:
+            if (name == "Conditionally")
+            {
+              return RequiresRecreation::Conditionally;
+            }
+            break;
+          case Always_HASH:
+            if (name == "Always")
+            {
+              return RequiresRecreation::Always;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RequiresRecreation::NOT_SET;
         }
 
-        Aws::String GetNameForRequiresRecreation(RequiresRecreation enumValue)
+        const char* GetNameForRequiresRecreation(RequiresRecreation enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
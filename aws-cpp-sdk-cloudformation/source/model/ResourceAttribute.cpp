@@ -30,40 +30,58 @@ namespace Aws
       namespace ResourceAttributeMapper
       {
 
-        static const int Properties_HASH = HashingUtils::HashString("Properties");
-        static const int Metadata_HASH = HashingUtils::HashString("Metadata");
-        static const int CreationPolicy_HASH = HashingUtils::HashString("CreationPolicy");
-        static const int UpdatePolicy_HASH = HashingUtils::HashString("UpdatePolicy");
-        static const int DeletionPolicy_HASH = HashingUtils::HashString("DeletionPolicy");
-        static const int Tags_HASH = HashingUtils::HashString("Tags");
+        static constexpr int Properties_HASH = HashingUtils::CompileTimeHashString("Properties");
+        static constexpr int Metadata_HASH = HashingUtils::CompileTimeHashString("Metadata");
+        static constexpr int CreationPolicy_HASH = HashingUtils::CompileTimeHashString("CreationPolicy");
+        static constexpr int UpdatePolicy_HASH = HashingUtils::CompileTimeHashString("UpdatePolicy");
+        static constexpr int DeletionPolicy_HASH = HashingUtils::CompileTimeHashString("DeletionPolicy");
+        static constexpr int Tags_HASH = HashingUtils::CompileTimeHashString("Tags");
 
 
         ResourceAttribute GetResourceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Properties_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceAttribute::Properties;
-          }
-          else if (hashCode == Metadata_HASH)
-          {
-            return ResourceAttribute::Metadata;
-          }
-          else if (hashCode == CreationPolicy_HASH)
-          {
-            return ResourceAttribute::CreationPolicy;
-          }
-          else if (hashCode == UpdatePolicy_HASH)
-          {
-            return ResourceAttribute::UpdatePolicy;
-          }
-          else if (hashCode == DeletionPolicy_HASH)
-          {
-            return ResourceAttribute::DeletionPolicy;
-          }
-          else if (hashCode == Tags_HASH)
-          {
-            return ResourceAttribute::Tags;
+          case Properties_HASH:
+            if (name == "Properties")
+            {
+              return ResourceAttribute::Properties;
+            }
+            break;
+          case Metadata_HASH:
+            if (name == "Metadata")
+            {
+              return ResourceAttribute::Metadata;
+            }
+            break;
+          case CreationPolicy_HASH:
+            if (name == "CreationPolicy")
+            {
+              return ResourceAttribute::CreationPolicy;
+            }
+            break;
+          case UpdatePolicy_HASH:
+            if (name == "UpdatePolicy")
+            {
+              return ResourceAttribute::UpdatePolicy;
+            }
+            break;
+          case DeletionPolicy_HASH:
+            if (name == "DeletionPolicy")
+            {
+              return ResourceAttribute::DeletionPolicy;
+            }
+            break;
+          case Tags_HASH:
+            if (name == "Tags")
+            {
+              return ResourceAttribute::Tags;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ResourceAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForResourceAttribute(ResourceAttribute enumValue)
+        const char* GetNameForResourceAttribute(ResourceAttribute enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ResourceSignalStatusMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILURE_HASH = HashingUtils::HashString("FAILURE");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int FAILURE_HASH = HashingUtils::CompileTimeHashString("FAILURE");
 
 
         ResourceSignalStatus GetResourceSignalStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceSignalStatus::SUCCESS;
-          }
-          else if (hashCode == FAILURE_HASH)
-          {
-            return ResourceSignalStatus::FAILURE;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return ResourceSignalStatus::SUCCESS;
+            }
+            break;
+          case FAILURE_HASH:
+            if (name == "FAILURE")
+            {
+              return ResourceSignalStatus::FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ResourceSignalStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResourceSignalStatus(ResourceSignalStatus enumValue)
+        const char* GetNameForResourceSignalStatus(ResourceSignalStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
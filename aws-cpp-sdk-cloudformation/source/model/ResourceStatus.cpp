@@ -30,60 +30,86 @@ namespace Aws
       namespace ResourceStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETE_FAILED_HASH = HashingUtils::HashString("DELETE_FAILED");
-        static const int DELETE_COMPLETE_HASH = HashingUtils::HashString("DELETE_COMPLETE");
-        static const int DELETE_SKIPPED_HASH = HashingUtils::HashString("DELETE_SKIPPED");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
-        static const int UPDATE_FAILED_HASH = HashingUtils::HashString("UPDATE_FAILED");
-        static const int UPDATE_COMPLETE_HASH = HashingUtils::HashString("UPDATE_COMPLETE");
+        static constexpr int CREATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATE_IN_PROGRESS");
+        static constexpr int CREATE_FAILED_HASH = HashingUtils::CompileTimeHashString("CREATE_FAILED");
+        static constexpr int CREATE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("CREATE_COMPLETE");
+        static constexpr int DELETE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("DELETE_IN_PROGRESS");
+        static constexpr int DELETE_FAILED_HASH = HashingUtils::CompileTimeHashString("DELETE_FAILED");
+        static constexpr int DELETE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("DELETE_COMPLETE");
+        static constexpr int DELETE_SKIPPED_HASH = HashingUtils::CompileTimeHashString("DELETE_SKIPPED");
+        static constexpr int UPDATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("UPDATE_IN_PROGRESS");
+        static constexpr int UPDATE_FAILED_HASH = HashingUtils::CompileTimeHashString("UPDATE_FAILED");
+        static constexpr int UPDATE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("UPDATE_COMPLETE");
 
 
         ResourceStatus GetResourceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
-            return ResourceStatus::CREATE_FAILED;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
-            return ResourceStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return ResourceStatus::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETE_FAILED_HASH)
-          {
-            return ResourceStatus::DELETE_FAILED;
-          }
-          else if (hashCode == DELETE_COMPLETE_HASH)
-          {
-            return ResourceStatus::DELETE_COMPLETE;
-          }
-          else if (hashCode == DELETE_SKIPPED_HASH)
-          {
-            return ResourceStatus::DELETE_SKIPPED;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
-          {
-            return ResourceStatus::UPDATE_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_FAILED_HASH)
-          {
-            return ResourceStatus::UPDATE_FAILED;
-          }
-          else if (hashCode == UPDATE_COMPLETE_HASH)
-          {
-            return ResourceStatus::UPDATE_COMPLETE;
+          case CREATE_IN_PROGRESS_HASH:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return ResourceStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case CREATE_FAILED_HASH:
+            if (name == "CREATE_FAILED")
+            {
+              return ResourceStatus::CREATE_FAILED;
+            }
+            break;
+          case CREATE_COMPLETE_HASH:
+            if (name == "CREATE_COMPLETE")
+            {
+              return ResourceStatus::CREATE_COMPLETE;
+            }
+            break;
+          case DELETE_IN_PROGRESS_HASH:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return ResourceStatus::DELETE_IN_PROGRESS;
+            }
+            break;
+          case DELETE_FAILED_HASH:
+            if (name == "DELETE_FAILED")
+            {
+              return ResourceStatus::DELETE_FAILED;
+            }
+            break;
+          case DELETE_COMPLETE_HASH:
+            if (name == "DELETE_COMPLETE")
+            {
+              return ResourceStatus::DELETE_COMPLETE;
+            }
+            break;
+          case DELETE_SKIPPED_HASH:
+            if (name == "DELETE_SKIPPED")
+            {
+              return ResourceStatus::DELETE_SKIPPED;
+            }
+            break;
+          case UPDATE_IN_PROGRESS_HASH:
+            if (name == "UPDATE_IN_PROGRESS")
+            {
+              return ResourceStatus::UPDATE_IN_PROGRESS;
+            }
+            break;
+          case UPDATE_FAILED_HASH:
+            if (name == "UPDATE_FAILED")
+            {
+              return ResourceStatus::UPDATE_FAILED;
+            }
+            break;
+          case UPDATE_COMPLETE_HASH:
+            if (name == "UPDATE_COMPLETE")
+            {
+              return ResourceStatus::UPDATE_COMPLETE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return ResourceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForResourceStatus(ResourceStatus enumValue)
+        const char* GetNameForResourceStatus(ResourceStatus enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace StackInstanceStatusMapper
       {
 
-        static const int CURRENT_HASH = HashingUtils::HashString("CURRENT");
-        static const int OUTDATED_HASH = HashingUtils::HashString("OUTDATED");
-        static const int INOPERABLE_HASH = HashingUtils::HashString("INOPERABLE");
+        static constexpr int CURRENT_HASH = HashingUtils::CompileTimeHashString("CURRENT");
+        static constexpr int OUTDATED_HASH = HashingUtils::CompileTimeHashString("OUTDATED");
+        static constexpr int INOPERABLE_HASH = HashingUtils::CompileTimeHashString("INOPERABLE");
 
 
         StackInstanceStatus GetStackInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CURRENT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StackInstanceStatus::CURRENT;
-          }
-          else if (hashCode == OUTDATED_HASH)
-          {
-            return StackInstanceStatus::OUTDATED;
-          }
-          else if (hashCode == INOPERABLE_HASH)
-          {
-            return StackInstanceStatus::INOPERABLE;
+          case CURRENT_HASH:
+            if (name == "CURRENT")
+            {
+              return StackInstanceStatus::CURRENT;
+            }
+            break;
+          case OUTDATED_HASH:
+            if (name == "OUTDATED")
+            {
+              return StackInstanceStatus::OUTDATED;
+            }
+            break;
+          case INOPERABLE_HASH:
+            if (name == "INOPERABLE")
+            {
+              return StackInstanceStatus::INOPERABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return StackInstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackInstanceStatus(StackInstanceStatus enumValue)
+        const char* GetNameForStackInstanceStatus(StackInstanceStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace StackSetOperationActionMapper
       {
 
-        static const int CREATE_HASH = HashingUtils::HashString("CREATE");
-        static const int UPDATE_HASH = HashingUtils::HashString("UPDATE");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
+        static constexpr int CREATE_HASH = HashingUtils::CompileTimeHashString("CREATE");
+        static constexpr int UPDATE_HASH = HashingUtils::CompileTimeHashString("UPDATE");
+        static constexpr int DELETE__HASH = HashingUtils::CompileTimeHashString("DELETE");
 
 
         StackSetOperationAction GetStackSetOperationActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StackSetOperationAction::CREATE;
-          }
-          else if (hashCode == UPDATE_HASH)
-          {
-            return StackSetOperationAction::UPDATE;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return StackSetOperationAction::DELETE_;
+          case CREATE_HASH:
+            if (name == "CREATE")
+            {
+              return StackSetOperationAction::CREATE;
+            }
+            break;
+          case UPDATE_HASH:
+            if (name == "UPDATE")
+            {
+              return StackSetOperationAction::UPDATE;
+            }
+            break;
+          case DELETE__HASH:
+            if (name == "DELETE")
+            {
+              return StackSetOperationAction::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return StackSetOperationAction::NOT_SET;
         }
 
-        Aws::String GetNameForStackSetOperationAction(StackSetOperationAction enumValue)
+        const char* GetNameForStackSetOperationAction(StackSetOperationAction enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
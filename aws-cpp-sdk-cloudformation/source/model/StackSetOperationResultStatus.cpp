@@ -30,35 +30,51 @@ namespace Aws
       namespace StackSetOperationResultStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int CANCELLED_HASH = HashingUtils::CompileTimeHashString("CANCELLED");
 
 
         StackSetOperationResultStatus GetStackSetOperationResultStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StackSetOperationResultStatus::PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return StackSetOperationResultStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return StackSetOperationResultStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StackSetOperationResultStatus::FAILED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return StackSetOperationResultStatus::CANCELLED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return StackSetOperationResultStatus::PENDING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return StackSetOperationResultStatus::RUNNING;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return StackSetOperationResultStatus::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return StackSetOperationResultStatus::FAILED;
+            }
+            break;
+          case CANCELLED_HASH:
+            if (name == "CANCELLED")
+            {
+              return StackSetOperationResultStatus::CANCELLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return StackSetOperationResultStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackSetOperationResultStatus(StackSetOperationResultStatus enumValue)
+        const char* GetNameForStackSetOperationResultStatus(StackSetOperationResultStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace StackSetOperationStatusMapper
       {
 
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
 
 
         StackSetOperationStatus GetStackSetOperationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUNNING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StackSetOperationStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return StackSetOperationStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StackSetOperationStatus::FAILED;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return StackSetOperationStatus::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return StackSetOperationStatus::STOPPED;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return StackSetOperationStatus::RUNNING;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return StackSetOperationStatus::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return StackSetOperationStatus::FAILED;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return StackSetOperationStatus::STOPPING;
+            }
+            break;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return StackSetOperationStatus::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return StackSetOperationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackSetOperationStatus(StackSetOperationStatus enumValue)
+        const char* GetNameForStackSetOperationStatus(StackSetOperationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace StackSetStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         StackSetStatus GetStackSetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StackSetStatus::ACTIVE;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return StackSetStatus::DELETED;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return StackSetStatus::ACTIVE;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return StackSetStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return StackSetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackSetStatus(StackSetStatus enumValue)
+        const char* GetNameForStackSetStatus(StackSetStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
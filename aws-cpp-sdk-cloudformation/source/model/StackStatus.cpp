@@ -30,95 +30,135 @@ namespace Aws
       namespace StackStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int ROLLBACK_IN_PROGRESS_HASH = HashingUtils::HashString("ROLLBACK_IN_PROGRESS");
-        static const int ROLLBACK_FAILED_HASH = HashingUtils::HashString("ROLLBACK_FAILED");
-        static const int ROLLBACK_COMPLETE_HASH = HashingUtils::HashString("ROLLBACK_COMPLETE");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETE_FAILED_HASH = HashingUtils::HashString("DELETE_FAILED");
-        static const int DELETE_COMPLETE_HASH = HashingUtils::HashString("DELETE_COMPLETE");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
-        static const int UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_COMPLETE_CLEANUP_IN_PROGRESS");
-        static const int UPDATE_COMPLETE_HASH = HashingUtils::HashString("UPDATE_COMPLETE");
-        static const int UPDATE_ROLLBACK_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_IN_PROGRESS");
-        static const int UPDATE_ROLLBACK_FAILED_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_FAILED");
-        static const int UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS");
-        static const int UPDATE_ROLLBACK_COMPLETE_HASH = HashingUtils::HashString("UPDATE_ROLLBACK_COMPLETE");
-        static const int REVIEW_IN_PROGRESS_HASH = HashingUtils::HashString("REVIEW_IN_PROGRESS");
+        static constexpr int CREATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATE_IN_PROGRESS");
+        static constexpr int CREATE_FAILED_HASH = HashingUtils::CompileTimeHashString("CREATE_FAILED");
+        static constexpr int CREATE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("CREATE_COMPLETE");
+        static constexpr int ROLLBACK_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("ROLLBACK_IN_PROGRESS");
+        static constexpr int ROLLBACK_FAILED_HASH = HashingUtils::CompileTimeHashString("ROLLBACK_FAILED");
+        static constexpr int ROLLBACK_COMPLETE_HASH = HashingUtils::CompileTimeHashString("ROLLBACK_COMPLETE");
+        static constexpr int DELETE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("DELETE_IN_PROGRESS");
+        static constexpr int DELETE_FAILED_HASH = HashingUtils::CompileTimeHashString("DELETE_FAILED");
+        static constexpr int DELETE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("DELETE_COMPLETE");
+        static constexpr int UPDATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("UPDATE_IN_PROGRESS");
+        static constexpr int UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("UPDATE_COMPLETE_CLEANUP_IN_PROGRESS");
+        static constexpr int UPDATE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("UPDATE_COMPLETE");
+        static constexpr int UPDATE_ROLLBACK_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("UPDATE_ROLLBACK_IN_PROGRESS");
+        static constexpr int UPDATE_ROLLBACK_FAILED_HASH = HashingUtils::CompileTimeHashString("UPDATE_ROLLBACK_FAILED");
+        static constexpr int UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS");
+        static constexpr int UPDATE_ROLLBACK_COMPLETE_HASH = HashingUtils::CompileTimeHashString("UPDATE_ROLLBACK_COMPLETE");
+        static constexpr int REVIEW_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("REVIEW_IN_PROGRESS");
 
 
         StackStatus GetStackStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StackStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
-            return StackStatus::CREATE_FAILED;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
-            return StackStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == ROLLBACK_IN_PROGRESS_HASH)
-          {
-            return StackStatus::ROLLBACK_IN_PROGRESS;
-          }
-          else if (hashCode == ROLLBACK_FAILED_HASH)
-          {
-            return StackStatus::ROLLBACK_FAILED;
-          }
-          else if (hashCode == ROLLBACK_COMPLETE_HASH)
-          {
-            return StackStatus::ROLLBACK_COMPLETE;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return StackStatus::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETE_FAILED_HASH)
-          {
-            return StackStatus::DELETE_FAILED;
-          }
-          else if (hashCode == DELETE_COMPLETE_HASH)
-          {
-            return StackStatus::DELETE_COMPLETE;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
-          {
-            return StackStatus::UPDATE_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH)
-          {
-            return StackStatus::UPDATE_COMPLETE_CLEANUP_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_COMPLETE_HASH)
-          {
-            return StackStatus::UPDATE_COMPLETE;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_IN_PROGRESS_HASH)
-          {
-            return StackStatus::UPDATE_ROLLBACK_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_FAILED_HASH)
-          {
-            return StackStatus::UPDATE_ROLLBACK_FAILED;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH)
-          {
-            return StackStatus::UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS;
-          }
-          else if (hashCode == UPDATE_ROLLBACK_COMPLETE_HASH)
-          {
-            return StackStatus::UPDATE_ROLLBACK_COMPLETE;
-          }
-          else if (hashCode == REVIEW_IN_PROGRESS_HASH)
-          {
-            return StackStatus::REVIEW_IN_PROGRESS;
+          case CREATE_IN_PROGRESS_HASH:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return StackStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case CREATE_FAILED_HASH:
+            if (name == "CREATE_FAILED")
+            {
+              return StackStatus::CREATE_FAILED;
+            }
+            break;
+          case CREATE_COMPLETE_HASH:
+            if (name == "CREATE_COMPLETE")
+            {
+              return StackStatus::CREATE_COMPLETE;
+            }
+            break;
+          case ROLLBACK_IN_PROGRESS_HASH:
+            if (name == "ROLLBACK_IN_PROGRESS")
+            {
+              return StackStatus::ROLLBACK_IN_PROGRESS;
+            }
+            break;
+          case ROLLBACK_FAILED_HASH:
+            if (name == "ROLLBACK_FAILED")
+            {
+              return StackStatus::ROLLBACK_FAILED;
+            }
+            break;
+          case ROLLBACK_COMPLETE_HASH:
+            if (name == "ROLLBACK_COMPLETE")
+            {
+              return StackStatus::ROLLBACK_COMPLETE;
+            }
+            break;
+          case DELETE_IN_PROGRESS_HASH:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return StackStatus::DELETE_IN_PROGRESS;
+            }
+            break;
+          case DELETE_FAILED_HASH:
+            if (name == "DELETE_FAILED")
+            {
+              return StackStatus::DELETE_FAILED;
+            }
+            break;
+          case DELETE_COMPLETE_HASH:
+            if (name == "DELETE_COMPLETE")
+            {
+              return StackStatus::DELETE_COMPLETE;
+            }
+            break;
+          case UPDATE_IN_PROGRESS_HASH:
+            if (name == "UPDATE_IN_PROGRESS")
+            {
+              return StackStatus::UPDATE_IN_PROGRESS;
+            }
+            break;
+          case UPDATE_COMPLETE_CLEANUP_IN_PROGRESS_HASH:
+            if (name == "UPDATE_COMPLETE_CLEANUP_IN_PROGRESS")
+            {
+              return StackStatus::UPDATE_COMPLETE_CLEANUP_IN_PROGRESS;
+            }
+            break;
+          case UPDATE_COMPLETE_HASH:
+            if (name == "UPDATE_COMPLETE")
+            {
+              return StackStatus::UPDATE_COMPLETE;
+            }
+            break;
+          case UPDATE_ROLLBACK_IN_PROGRESS_HASH:
+            if (name == "UPDATE_ROLLBACK_IN_PROGRESS")
+            {
+              return StackStatus::UPDATE_ROLLBACK_IN_PROGRESS;
+            }
+            break;
+          case UPDATE_ROLLBACK_FAILED_HASH:
+            if (name == "UPDATE_ROLLBACK_FAILED")
+            {
+              return StackStatus::UPDATE_ROLLBACK_FAILED;
+            }
+            break;
+          case UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS_HASH:
+            if (name == "UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS")
+            {
+              return StackStatus::UPDATE_ROLLBACK_COMPLETE_CLEANUP_IN_PROGRESS;
+            }
+            break;
+          case UPDATE_ROLLBACK_COMPLETE_HASH:
+            if (name == "UPDATE_ROLLBACK_COMPLETE")
+            {
+              return StackStatus::UPDATE_ROLLBACK_COMPLETE;
+            }
+            break;
+          case REVIEW_IN_PROGRESS_HASH:
+            if (name == "REVIEW_IN_PROGRESS")
+            {
+              return StackStatus::REVIEW_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,7 +170,7 @@ namespace Aws
           return StackStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStackStatus(StackStatus enumValue)
+        const char* GetNameForStackStatus(StackStatus enumValue)
         {
           switch(enumValue)
           {
@@ -172,7 +212,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
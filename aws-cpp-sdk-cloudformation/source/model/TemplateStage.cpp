@@ -30,20 +30,30 @@ namespace Aws
       namespace TemplateStageMapper
       {
 
-        static const int Original_HASH = HashingUtils::HashString("Original");
-        static const int Processed_HASH = HashingUtils::HashString("Processed");
+        static constexpr int Original_HASH = HashingUtils::CompileTimeHashString("Original");
+        static constexpr int Processed_HASH = HashingUtils::CompileTimeHashString("Processed");
 
 
         TemplateStage GetTemplateStageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Original_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TemplateStage::Original;
-          }
-          else if (hashCode == Processed_HASH)
-          {
-            return TemplateStage::Processed;
+          case Original_HASH:
+            if (name == "Original")
+            {
+              return TemplateStage::Original;
+            }
+            break;
+          case Processed_HASH:
+            if (name == "Processed")
+            {
+              return TemplateStage::Processed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TemplateStage::NOT_SET;
         }
 
-        Aws::String GetNameForTemplateStage(TemplateStage enumValue)
+        const char* GetNameForTemplateStage(TemplateStage enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -20,6 +20,7 @@
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/AmazonSerializableWebServiceRequest.h>
 #include <aws/core/client/AWSClient.h>
+#include <aws/core/http/URI.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/cloudfront/model/CreateCloudFrontOriginAccessIdentity2018_06_18Result.h>
@@ -1863,7 +1864,7 @@ namespace Model
         void UpdatePublicKey2018_06_18AsyncHelper(const Model::UpdatePublicKey2018_06_18Request& request, const UpdatePublicKey2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
         void UpdateStreamingDistribution2018_06_18AsyncHelper(const Model::UpdateStreamingDistribution2018_06_18Request& request, const UpdateStreamingDistribution2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
 
-    Aws::String m_uri;
+    Aws::Http::URI m_uri;
     std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
   };
 
@@ -36,7 +36,8 @@ namespace EventTypeMapper
 {
 AWS_CLOUDFRONT_API EventType GetEventTypeForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForEventType(EventType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForEventType(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace CloudFront
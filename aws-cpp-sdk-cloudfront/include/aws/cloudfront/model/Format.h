@@ -33,7 +33,8 @@ namespace FormatMapper
 {
 AWS_CLOUDFRONT_API Format GetFormatForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForFormat(Format value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForFormat(Format value);
 } // namespace FormatMapper
 } // namespace Model
 } // namespace CloudFront
@@ -35,7 +35,8 @@ namespace GeoRestrictionTypeMapper
 {
 AWS_CLOUDFRONT_API GeoRestrictionType GetGeoRestrictionTypeForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForGeoRestrictionType(GeoRestrictionType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForGeoRestrictionType(GeoRestrictionType value);
 } // namespace GeoRestrictionTypeMapper
 } // namespace Model
 } // namespace CloudFront
@@ -34,7 +34,8 @@ namespace HttpVersionMapper
 {
 AWS_CLOUDFRONT_API HttpVersion GetHttpVersionForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForHttpVersion(HttpVersion value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForHttpVersion(HttpVersion value);
 } // namespace HttpVersionMapper
 } // namespace Model
 } // namespace CloudFront
@@ -35,7 +35,8 @@ namespace ItemSelectionMapper
 {
 AWS_CLOUDFRONT_API ItemSelection GetItemSelectionForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForItemSelection(ItemSelection value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForItemSelection(ItemSelection value);
 } // namespace ItemSelectionMapper
 } // namespace Model
 } // namespace CloudFront
@@ -39,7 +39,8 @@ namespace MethodMapper
 {
 AWS_CLOUDFRONT_API Method GetMethodForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForMethod(Method value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForMethod(Method value);
 } // namespace MethodMapper
 } // namespace Model
 } // namespace CloudFront
@@ -37,7 +37,8 @@ namespace MinimumProtocolVersionMapper
 {
 AWS_CLOUDFRONT_API MinimumProtocolVersion GetMinimumProtocolVersionForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForMinimumProtocolVersion(MinimumProtocolVersion value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForMinimumProtocolVersion(MinimumProtocolVersion value);
 } // namespace MinimumProtocolVersionMapper
 } // namespace Model
 } // namespace CloudFront
@@ -35,7 +35,8 @@ namespace OriginProtocolPolicyMapper
 {
 AWS_CLOUDFRONT_API OriginProtocolPolicy GetOriginProtocolPolicyForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForOriginProtocolPolicy(OriginProtocolPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForOriginProtocolPolicy(OriginProtocolPolicy value);
 } // namespace OriginProtocolPolicyMapper
 } // namespace Model
 } // namespace CloudFront
@@ -35,7 +35,8 @@ namespace PriceClassMapper
 {
 AWS_CLOUDFRONT_API PriceClass GetPriceClassForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForPriceClass(PriceClass value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForPriceClass(PriceClass value);
 } // namespace PriceClassMapper
 } // namespace Model
 } // namespace CloudFront
@@ -34,7 +34,8 @@ namespace SSLSupportMethodMapper
 {
 AWS_CLOUDFRONT_API SSLSupportMethod GetSSLSupportMethodForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForSSLSupportMethod(SSLSupportMethod value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForSSLSupportMethod(SSLSupportMethod value);
 } // namespace SSLSupportMethodMapper
 } // namespace Model
 } // namespace CloudFront
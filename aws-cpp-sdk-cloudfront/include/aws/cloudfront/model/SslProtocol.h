@@ -36,7 +36,8 @@ namespace SslProtocolMapper
 {
 AWS_CLOUDFRONT_API SslProtocol GetSslProtocolForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForSslProtocol(SslProtocol value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForSslProtocol(SslProtocol value);
 } // namespace SslProtocolMapper
 } // namespace Model
 } // namespace CloudFront
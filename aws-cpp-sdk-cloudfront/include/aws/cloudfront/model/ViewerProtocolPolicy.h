@@ -35,7 +35,8 @@ namespace ViewerProtocolPolicyMapper
 {
 AWS_CLOUDFRONT_API ViewerProtocolPolicy GetViewerProtocolPolicyForName(const Aws::String& name);
 
-AWS_CLOUDFRONT_API Aws::String GetNameForViewerProtocolPolicy(ViewerProtocolPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDFRONT_API const char* GetNameForViewerProtocolPolicy(ViewerProtocolPolicy value);
 } // namespace ViewerProtocolPolicyMapper
 } // namespace Model
 } // namespace CloudFront
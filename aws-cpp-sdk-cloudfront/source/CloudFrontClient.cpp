@@ -140,10 +140,8 @@ void CloudFrontClient::init(const ClientConfiguration& config)
 
 CreateCloudFrontOriginAccessIdentity2018_06_18Outcome CloudFrontClient::CreateCloudFrontOriginAccessIdentity2018_06_18(const CreateCloudFrontOriginAccessIdentity2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/origin-access-identity/cloudfront";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/origin-access-identity/cloudfront");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
@@ -157,10 +155,10 @@ CreateCloudFrontOriginAccessIdentity2018_06_18Outcome CloudFrontClient::CreateCl
 
 CreateCloudFrontOriginAccessIdentity2018_06_18OutcomeCallable CloudFrontClient::CreateCloudFrontOriginAccessIdentity2018_06_18Callable(const CreateCloudFrontOriginAccessIdentity2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateCloudFrontOriginAccessIdentity2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateCloudFrontOriginAccessIdentity2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreateCloudFrontOriginAccessIdentity2018_06_18Outcome() > task([this, request](){ return this->CreateCloudFrontOriginAccessIdentity2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2018_06_18Async(const CreateCloudFrontOriginAccessIdentity2018_06_18Request& request, const CreateCloudFrontOriginAccessIdentity2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -175,10 +173,8 @@ void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2018_06_18AsyncHelper
 
 CreateDistribution2018_06_18Outcome CloudFrontClient::CreateDistribution2018_06_18(const CreateDistribution2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/distribution";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/distribution");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
@@ -192,10 +188,10 @@ CreateDistribution2018_06_18Outcome CloudFrontClient::CreateDistribution2018_06_
 
 CreateDistribution2018_06_18OutcomeCallable CloudFrontClient::CreateDistribution2018_06_18Callable(const CreateDistribution2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateDistribution2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDistribution2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreateDistribution2018_06_18Outcome() > task([this, request](){ return this->CreateDistribution2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::CreateDistribution2018_06_18Async(const CreateDistribution2018_06_18Request& request, const CreateDistribution2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -229,10 +225,10 @@ CreateDistributionWithTags2018_06_18Outcome CloudFrontClient::CreateDistribution
 
 CreateDistributionWithTags2018_06_18OutcomeCallable CloudFrontClient::CreateDistributionWithTags2018_06_18Callable(const CreateDistributionWithTags2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateDistributionWithTags2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateDistributionWithTags2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreateDistributionWithTags2018_06_18Outcome() > task([this, request](){ return this->CreateDistributionWithTags2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::CreateDistributionWithTags2018_06_18Async(const CreateDistributionWithTags2018_06_18Request& request, const CreateDistributionWithTags2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -247,10 +243,8 @@ void CloudFrontClient::CreateDistributionWithTags2018_06_18AsyncHelper(const Cre
 
 CreateFieldLevelEncryptionConfig2018_06_18Outcome CloudFrontClient::CreateFieldLevelEncryptionConfig2018_06_18(const CreateFieldLevelEncryptionConfig2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/field-level-encryption";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/field-level-encryption");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
@@ -264,10 +258,10 @@ CreateFieldLevelEncryptionConfig2018_06_18Outcome CloudFrontClient::CreateFieldL
 
 CreateFieldLevelEncryptionConfig2018_06_18OutcomeCallable CloudFrontClient::CreateFieldLevelEncryptionConfig2018_06_18Callable(const CreateFieldLevelEncryptionConfig2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateFieldLevelEncryptionConfig2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateFieldLevelEncryptionConfig2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreateFieldLevelEncryptionConfig2018_06_18Outcome() > task([this, request](){ return this->CreateFieldLevelEncryptionConfig2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::CreateFieldLevelEncryptionConfig2018_06_18Async(const CreateFieldLevelEncryptionConfig2018_06_18Request& request, const CreateFieldLevelEncryptionConfig2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -282,10 +276,8 @@ void CloudFrontClient::CreateFieldLevelEncryptionConfig2018_06_18AsyncHelper(con
 
 CreateFieldLevelEncryptionProfile2018_06_18Outcome CloudFrontClient::CreateFieldLevelEncryptionProfile2018_06_18(const CreateFieldLevelEncryptionProfile2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/field-level-encryption-profile";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/field-level-encryption-profile");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
@@ -299,10 +291,10 @@ CreateFieldLevelEncryptionProfile2018_06_18Outcome CloudFrontClient::CreateField
 
 CreateFieldLevelEncryptionProfile2018_06_18OutcomeCallable CloudFrontClient::CreateFieldLevelEncryptionProfile2018_06_18Callable(const CreateFieldLevelEncryptionProfile2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateFieldLevelEncryptionProfile2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateFieldLevelEncryptionProfile2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreateFieldLevelEncryptionProfile2018_06_18Outcome() > task([this, request](){ return this->CreateFieldLevelEncryptionProfile2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::CreateFieldLevelEncryptionProfile2018_06_18Async(const CreateFieldLevelEncryptionProfile2018_06_18Request& request, const CreateFieldLevelEncryptionProfile2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -336,10 +328,10 @@ CreateInvalidation2018_06_18Outcome CloudFrontClient::CreateInvalidation2018_06_
 
 CreateInvalidation2018_06_18OutcomeCallable CloudFrontClient::CreateInvalidation2018_06_18Callable(const CreateInvalidation2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateInvalidation2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateInvalidation2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreateInvalidation2018_06_18Outcome() > task([this, request](){ return this->CreateInvalidation2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::CreateInvalidation2018_06_18Async(const CreateInvalidation2018_06_18Request& request, const CreateInvalidation2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -354,10 +346,8 @@ void CloudFrontClient::CreateInvalidation2018_06_18AsyncHelper(const CreateInval
 
 CreatePublicKey2018_06_18Outcome CloudFrontClient::CreatePublicKey2018_06_18(const CreatePublicKey2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/public-key";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/public-key");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
@@ -371,10 +361,10 @@ CreatePublicKey2018_06_18Outcome CloudFrontClient::CreatePublicKey2018_06_18(con
 
 CreatePublicKey2018_06_18OutcomeCallable CloudFrontClient::CreatePublicKey2018_06_18Callable(const CreatePublicKey2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreatePublicKey2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreatePublicKey2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreatePublicKey2018_06_18Outcome() > task([this, request](){ return this->CreatePublicKey2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::CreatePublicKey2018_06_18Async(const CreatePublicKey2018_06_18Request& request, const CreatePublicKey2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -389,10 +379,8 @@ void CloudFrontClient::CreatePublicKey2018_06_18AsyncHelper(const CreatePublicKe
 
 CreateStreamingDistribution2018_06_18Outcome CloudFrontClient::CreateStreamingDistribution2018_06_18(const CreateStreamingDistribution2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/streaming-distribution";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/streaming-distribution");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
@@ -406,10 +394,10 @@ CreateStreamingDistribution2018_06_18Outcome CloudFrontClient::CreateStreamingDi
 
 CreateStreamingDistribution2018_06_18OutcomeCallable CloudFrontClient::CreateStreamingDistribution2018_06_18Callable(const CreateStreamingDistribution2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateStreamingDistribution2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStreamingDistribution2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreateStreamingDistribution2018_06_18Outcome() > task([this, request](){ return this->CreateStreamingDistribution2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::CreateStreamingDistribution2018_06_18Async(const CreateStreamingDistribution2018_06_18Request& request, const CreateStreamingDistribution2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -443,10 +431,10 @@ CreateStreamingDistributionWithTags2018_06_18Outcome CloudFrontClient::CreateStr
 
 CreateStreamingDistributionWithTags2018_06_18OutcomeCallable CloudFrontClient::CreateStreamingDistributionWithTags2018_06_18Callable(const CreateStreamingDistributionWithTags2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< CreateStreamingDistributionWithTags2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->CreateStreamingDistributionWithTags2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< CreateStreamingDistributionWithTags2018_06_18Outcome() > task([this, request](){ return this->CreateStreamingDistributionWithTags2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::CreateStreamingDistributionWithTags2018_06_18Async(const CreateStreamingDistributionWithTags2018_06_18Request& request, const CreateStreamingDistributionWithTags2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -479,10 +467,10 @@ DeleteCloudFrontOriginAccessIdentity2018_06_18Outcome CloudFrontClient::DeleteCl
 
 DeleteCloudFrontOriginAccessIdentity2018_06_18OutcomeCallable CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2018_06_18Callable(const DeleteCloudFrontOriginAccessIdentity2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteCloudFrontOriginAccessIdentity2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteCloudFrontOriginAccessIdentity2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DeleteCloudFrontOriginAccessIdentity2018_06_18Outcome() > task([this, request](){ return this->DeleteCloudFrontOriginAccessIdentity2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2018_06_18Async(const DeleteCloudFrontOriginAccessIdentity2018_06_18Request& request, const DeleteCloudFrontOriginAccessIdentity2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -515,10 +503,10 @@ DeleteDistribution2018_06_18Outcome CloudFrontClient::DeleteDistribution2018_06_
 
 DeleteDistribution2018_06_18OutcomeCallable CloudFrontClient::DeleteDistribution2018_06_18Callable(const DeleteDistribution2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteDistribution2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteDistribution2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DeleteDistribution2018_06_18Outcome() > task([this, request](){ return this->DeleteDistribution2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::DeleteDistribution2018_06_18Async(const DeleteDistribution2018_06_18Request& request, const DeleteDistribution2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -551,10 +539,10 @@ DeleteFieldLevelEncryptionConfig2018_06_18Outcome CloudFrontClient::DeleteFieldL
 
 DeleteFieldLevelEncryptionConfig2018_06_18OutcomeCallable CloudFrontClient::DeleteFieldLevelEncryptionConfig2018_06_18Callable(const DeleteFieldLevelEncryptionConfig2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteFieldLevelEncryptionConfig2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteFieldLevelEncryptionConfig2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DeleteFieldLevelEncryptionConfig2018_06_18Outcome() > task([this, request](){ return this->DeleteFieldLevelEncryptionConfig2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::DeleteFieldLevelEncryptionConfig2018_06_18Async(const DeleteFieldLevelEncryptionConfig2018_06_18Request& request, const DeleteFieldLevelEncryptionConfig2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -587,10 +575,10 @@ DeleteFieldLevelEncryptionProfile2018_06_18Outcome CloudFrontClient::DeleteField
 
 DeleteFieldLevelEncryptionProfile2018_06_18OutcomeCallable CloudFrontClient::DeleteFieldLevelEncryptionProfile2018_06_18Callable(const DeleteFieldLevelEncryptionProfile2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteFieldLevelEncryptionProfile2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteFieldLevelEncryptionProfile2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DeleteFieldLevelEncryptionProfile2018_06_18Outcome() > task([this, request](){ return this->DeleteFieldLevelEncryptionProfile2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::DeleteFieldLevelEncryptionProfile2018_06_18Async(const DeleteFieldLevelEncryptionProfile2018_06_18Request& request, const DeleteFieldLevelEncryptionProfile2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -623,10 +611,10 @@ DeletePublicKey2018_06_18Outcome CloudFrontClient::DeletePublicKey2018_06_18(con
 
 DeletePublicKey2018_06_18OutcomeCallable CloudFrontClient::DeletePublicKey2018_06_18Callable(const DeletePublicKey2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeletePublicKey2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeletePublicKey2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DeletePublicKey2018_06_18Outcome() > task([this, request](){ return this->DeletePublicKey2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::DeletePublicKey2018_06_18Async(const DeletePublicKey2018_06_18Request& request, const DeletePublicKey2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -659,10 +647,10 @@ DeleteStreamingDistribution2018_06_18Outcome CloudFrontClient::DeleteStreamingDi
 
 DeleteStreamingDistribution2018_06_18OutcomeCallable CloudFrontClient::DeleteStreamingDistribution2018_06_18Callable(const DeleteStreamingDistribution2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< DeleteStreamingDistribution2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->DeleteStreamingDistribution2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< DeleteStreamingDistribution2018_06_18Outcome() > task([this, request](){ return this->DeleteStreamingDistribution2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::DeleteStreamingDistribution2018_06_18Async(const DeleteStreamingDistribution2018_06_18Request& request, const DeleteStreamingDistribution2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -695,10 +683,10 @@ GetCloudFrontOriginAccessIdentity2018_06_18Outcome CloudFrontClient::GetCloudFro
 
 GetCloudFrontOriginAccessIdentity2018_06_18OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentity2018_06_18Callable(const GetCloudFrontOriginAccessIdentity2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetCloudFrontOriginAccessIdentity2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCloudFrontOriginAccessIdentity2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetCloudFrontOriginAccessIdentity2018_06_18Outcome() > task([this, request](){ return this->GetCloudFrontOriginAccessIdentity2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2018_06_18Async(const GetCloudFrontOriginAccessIdentity2018_06_18Request& request, const GetCloudFrontOriginAccessIdentity2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -732,10 +720,10 @@ GetCloudFrontOriginAccessIdentityConfig2018_06_18Outcome CloudFrontClient::GetCl
 
 GetCloudFrontOriginAccessIdentityConfig2018_06_18OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2018_06_18Callable(const GetCloudFrontOriginAccessIdentityConfig2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetCloudFrontOriginAccessIdentityConfig2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetCloudFrontOriginAccessIdentityConfig2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetCloudFrontOriginAccessIdentityConfig2018_06_18Outcome() > task([this, request](){ return this->GetCloudFrontOriginAccessIdentityConfig2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2018_06_18Async(const GetCloudFrontOriginAccessIdentityConfig2018_06_18Request& request, const GetCloudFrontOriginAccessIdentityConfig2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -768,10 +756,10 @@ GetDistribution2018_06_18Outcome CloudFrontClient::GetDistribution2018_06_18(con
 
 GetDistribution2018_06_18OutcomeCallable CloudFrontClient::GetDistribution2018_06_18Callable(const GetDistribution2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetDistribution2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDistribution2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetDistribution2018_06_18Outcome() > task([this, request](){ return this->GetDistribution2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetDistribution2018_06_18Async(const GetDistribution2018_06_18Request& request, const GetDistribution2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -805,10 +793,10 @@ GetDistributionConfig2018_06_18Outcome CloudFrontClient::GetDistributionConfig20
 
 GetDistributionConfig2018_06_18OutcomeCallable CloudFrontClient::GetDistributionConfig2018_06_18Callable(const GetDistributionConfig2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetDistributionConfig2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetDistributionConfig2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetDistributionConfig2018_06_18Outcome() > task([this, request](){ return this->GetDistributionConfig2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetDistributionConfig2018_06_18Async(const GetDistributionConfig2018_06_18Request& request, const GetDistributionConfig2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -841,10 +829,10 @@ GetFieldLevelEncryption2018_06_18Outcome CloudFrontClient::GetFieldLevelEncrypti
 
 GetFieldLevelEncryption2018_06_18OutcomeCallable CloudFrontClient::GetFieldLevelEncryption2018_06_18Callable(const GetFieldLevelEncryption2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetFieldLevelEncryption2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFieldLevelEncryption2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetFieldLevelEncryption2018_06_18Outcome() > task([this, request](){ return this->GetFieldLevelEncryption2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetFieldLevelEncryption2018_06_18Async(const GetFieldLevelEncryption2018_06_18Request& request, const GetFieldLevelEncryption2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -878,10 +866,10 @@ GetFieldLevelEncryptionConfig2018_06_18Outcome CloudFrontClient::GetFieldLevelEn
 
 GetFieldLevelEncryptionConfig2018_06_18OutcomeCallable CloudFrontClient::GetFieldLevelEncryptionConfig2018_06_18Callable(const GetFieldLevelEncryptionConfig2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetFieldLevelEncryptionConfig2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFieldLevelEncryptionConfig2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetFieldLevelEncryptionConfig2018_06_18Outcome() > task([this, request](){ return this->GetFieldLevelEncryptionConfig2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetFieldLevelEncryptionConfig2018_06_18Async(const GetFieldLevelEncryptionConfig2018_06_18Request& request, const GetFieldLevelEncryptionConfig2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -914,10 +902,10 @@ GetFieldLevelEncryptionProfile2018_06_18Outcome CloudFrontClient::GetFieldLevelE
 
 GetFieldLevelEncryptionProfile2018_06_18OutcomeCallable CloudFrontClient::GetFieldLevelEncryptionProfile2018_06_18Callable(const GetFieldLevelEncryptionProfile2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetFieldLevelEncryptionProfile2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFieldLevelEncryptionProfile2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetFieldLevelEncryptionProfile2018_06_18Outcome() > task([this, request](){ return this->GetFieldLevelEncryptionProfile2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetFieldLevelEncryptionProfile2018_06_18Async(const GetFieldLevelEncryptionProfile2018_06_18Request& request, const GetFieldLevelEncryptionProfile2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -951,10 +939,10 @@ GetFieldLevelEncryptionProfileConfig2018_06_18Outcome CloudFrontClient::GetField
 
 GetFieldLevelEncryptionProfileConfig2018_06_18OutcomeCallable CloudFrontClient::GetFieldLevelEncryptionProfileConfig2018_06_18Callable(const GetFieldLevelEncryptionProfileConfig2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetFieldLevelEncryptionProfileConfig2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetFieldLevelEncryptionProfileConfig2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetFieldLevelEncryptionProfileConfig2018_06_18Outcome() > task([this, request](){ return this->GetFieldLevelEncryptionProfileConfig2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetFieldLevelEncryptionProfileConfig2018_06_18Async(const GetFieldLevelEncryptionProfileConfig2018_06_18Request& request, const GetFieldLevelEncryptionProfileConfig2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -989,10 +977,10 @@ GetInvalidation2018_06_18Outcome CloudFrontClient::GetInvalidation2018_06_18(con
 
 GetInvalidation2018_06_18OutcomeCallable CloudFrontClient::GetInvalidation2018_06_18Callable(const GetInvalidation2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetInvalidation2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetInvalidation2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetInvalidation2018_06_18Outcome() > task([this, request](){ return this->GetInvalidation2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetInvalidation2018_06_18Async(const GetInvalidation2018_06_18Request& request, const GetInvalidation2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1025,10 +1013,10 @@ GetPublicKey2018_06_18Outcome CloudFrontClient::GetPublicKey2018_06_18(const Get
 
 GetPublicKey2018_06_18OutcomeCallable CloudFrontClient::GetPublicKey2018_06_18Callable(const GetPublicKey2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetPublicKey2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetPublicKey2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetPublicKey2018_06_18Outcome() > task([this, request](){ return this->GetPublicKey2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetPublicKey2018_06_18Async(const GetPublicKey2018_06_18Request& request, const GetPublicKey2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1062,10 +1050,10 @@ GetPublicKeyConfig2018_06_18Outcome CloudFrontClient::GetPublicKeyConfig2018_06_
 
 GetPublicKeyConfig2018_06_18OutcomeCallable CloudFrontClient::GetPublicKeyConfig2018_06_18Callable(const GetPublicKeyConfig2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetPublicKeyConfig2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetPublicKeyConfig2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetPublicKeyConfig2018_06_18Outcome() > task([this, request](){ return this->GetPublicKeyConfig2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetPublicKeyConfig2018_06_18Async(const GetPublicKeyConfig2018_06_18Request& request, const GetPublicKeyConfig2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1098,10 +1086,10 @@ GetStreamingDistribution2018_06_18Outcome CloudFrontClient::GetStreamingDistribu
 
 GetStreamingDistribution2018_06_18OutcomeCallable CloudFrontClient::GetStreamingDistribution2018_06_18Callable(const GetStreamingDistribution2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetStreamingDistribution2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStreamingDistribution2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetStreamingDistribution2018_06_18Outcome() > task([this, request](){ return this->GetStreamingDistribution2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetStreamingDistribution2018_06_18Async(const GetStreamingDistribution2018_06_18Request& request, const GetStreamingDistribution2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1135,10 +1123,10 @@ GetStreamingDistributionConfig2018_06_18Outcome CloudFrontClient::GetStreamingDi
 
 GetStreamingDistributionConfig2018_06_18OutcomeCallable CloudFrontClient::GetStreamingDistributionConfig2018_06_18Callable(const GetStreamingDistributionConfig2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< GetStreamingDistributionConfig2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->GetStreamingDistributionConfig2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< GetStreamingDistributionConfig2018_06_18Outcome() > task([this, request](){ return this->GetStreamingDistributionConfig2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::GetStreamingDistributionConfig2018_06_18Async(const GetStreamingDistributionConfig2018_06_18Request& request, const GetStreamingDistributionConfig2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1153,10 +1141,8 @@ void CloudFrontClient::GetStreamingDistributionConfig2018_06_18AsyncHelper(const
 
 ListCloudFrontOriginAccessIdentities2018_06_18Outcome CloudFrontClient::ListCloudFrontOriginAccessIdentities2018_06_18(const ListCloudFrontOriginAccessIdentities2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/origin-access-identity/cloudfront";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/origin-access-identity/cloudfront");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
@@ -1170,10 +1156,10 @@ ListCloudFrontOriginAccessIdentities2018_06_18Outcome CloudFrontClient::ListClou
 
 ListCloudFrontOriginAccessIdentities2018_06_18OutcomeCallable CloudFrontClient::ListCloudFrontOriginAccessIdentities2018_06_18Callable(const ListCloudFrontOriginAccessIdentities2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListCloudFrontOriginAccessIdentities2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListCloudFrontOriginAccessIdentities2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListCloudFrontOriginAccessIdentities2018_06_18Outcome() > task([this, request](){ return this->ListCloudFrontOriginAccessIdentities2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2018_06_18Async(const ListCloudFrontOriginAccessIdentities2018_06_18Request& request, const ListCloudFrontOriginAccessIdentities2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1188,10 +1174,8 @@ void CloudFrontClient::ListCloudFrontOriginAccessIdentities2018_06_18AsyncHelper
 
 ListDistributions2018_06_18Outcome CloudFrontClient::ListDistributions2018_06_18(const ListDistributions2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/distribution";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/distribution");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
@@ -1205,10 +1189,10 @@ ListDistributions2018_06_18Outcome CloudFrontClient::ListDistributions2018_06_18
 
 ListDistributions2018_06_18OutcomeCallable CloudFrontClient::ListDistributions2018_06_18Callable(const ListDistributions2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListDistributions2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDistributions2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListDistributions2018_06_18Outcome() > task([this, request](){ return this->ListDistributions2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::ListDistributions2018_06_18Async(const ListDistributions2018_06_18Request& request, const ListDistributions2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1241,10 +1225,10 @@ ListDistributionsByWebACLId2018_06_18Outcome CloudFrontClient::ListDistributions
 
 ListDistributionsByWebACLId2018_06_18OutcomeCallable CloudFrontClient::ListDistributionsByWebACLId2018_06_18Callable(const ListDistributionsByWebACLId2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListDistributionsByWebACLId2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListDistributionsByWebACLId2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListDistributionsByWebACLId2018_06_18Outcome() > task([this, request](){ return this->ListDistributionsByWebACLId2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::ListDistributionsByWebACLId2018_06_18Async(const ListDistributionsByWebACLId2018_06_18Request& request, const ListDistributionsByWebACLId2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1259,10 +1243,8 @@ void CloudFrontClient::ListDistributionsByWebACLId2018_06_18AsyncHelper(const Li
 
 ListFieldLevelEncryptionConfigs2018_06_18Outcome CloudFrontClient::ListFieldLevelEncryptionConfigs2018_06_18(const ListFieldLevelEncryptionConfigs2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/field-level-encryption";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/field-level-encryption");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
@@ -1276,10 +1258,10 @@ ListFieldLevelEncryptionConfigs2018_06_18Outcome CloudFrontClient::ListFieldLeve
 
 ListFieldLevelEncryptionConfigs2018_06_18OutcomeCallable CloudFrontClient::ListFieldLevelEncryptionConfigs2018_06_18Callable(const ListFieldLevelEncryptionConfigs2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListFieldLevelEncryptionConfigs2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListFieldLevelEncryptionConfigs2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListFieldLevelEncryptionConfigs2018_06_18Outcome() > task([this, request](){ return this->ListFieldLevelEncryptionConfigs2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::ListFieldLevelEncryptionConfigs2018_06_18Async(const ListFieldLevelEncryptionConfigs2018_06_18Request& request, const ListFieldLevelEncryptionConfigs2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1294,10 +1276,8 @@ void CloudFrontClient::ListFieldLevelEncryptionConfigs2018_06_18AsyncHelper(cons
 
 ListFieldLevelEncryptionProfiles2018_06_18Outcome CloudFrontClient::ListFieldLevelEncryptionProfiles2018_06_18(const ListFieldLevelEncryptionProfiles2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/field-level-encryption-profile";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/field-level-encryption-profile");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
@@ -1311,10 +1291,10 @@ ListFieldLevelEncryptionProfiles2018_06_18Outcome CloudFrontClient::ListFieldLev
 
 ListFieldLevelEncryptionProfiles2018_06_18OutcomeCallable CloudFrontClient::ListFieldLevelEncryptionProfiles2018_06_18Callable(const ListFieldLevelEncryptionProfiles2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListFieldLevelEncryptionProfiles2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListFieldLevelEncryptionProfiles2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListFieldLevelEncryptionProfiles2018_06_18Outcome() > task([this, request](){ return this->ListFieldLevelEncryptionProfiles2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::ListFieldLevelEncryptionProfiles2018_06_18Async(const ListFieldLevelEncryptionProfiles2018_06_18Request& request, const ListFieldLevelEncryptionProfiles2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1348,10 +1328,10 @@ ListInvalidations2018_06_18Outcome CloudFrontClient::ListInvalidations2018_06_18
 
 ListInvalidations2018_06_18OutcomeCallable CloudFrontClient::ListInvalidations2018_06_18Callable(const ListInvalidations2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListInvalidations2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListInvalidations2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListInvalidations2018_06_18Outcome() > task([this, request](){ return this->ListInvalidations2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::ListInvalidations2018_06_18Async(const ListInvalidations2018_06_18Request& request, const ListInvalidations2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1366,10 +1346,8 @@ void CloudFrontClient::ListInvalidations2018_06_18AsyncHelper(const ListInvalida
 
 ListPublicKeys2018_06_18Outcome CloudFrontClient::ListPublicKeys2018_06_18(const ListPublicKeys2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/public-key";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/public-key");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
@@ -1383,10 +1361,10 @@ ListPublicKeys2018_06_18Outcome CloudFrontClient::ListPublicKeys2018_06_18(const
 
 ListPublicKeys2018_06_18OutcomeCallable CloudFrontClient::ListPublicKeys2018_06_18Callable(const ListPublicKeys2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListPublicKeys2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListPublicKeys2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListPublicKeys2018_06_18Outcome() > task([this, request](){ return this->ListPublicKeys2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::ListPublicKeys2018_06_18Async(const ListPublicKeys2018_06_18Request& request, const ListPublicKeys2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1401,10 +1379,8 @@ void CloudFrontClient::ListPublicKeys2018_06_18AsyncHelper(const ListPublicKeys2
 
 ListStreamingDistributions2018_06_18Outcome CloudFrontClient::ListStreamingDistributions2018_06_18(const ListStreamingDistributions2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/streaming-distribution";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/streaming-distribution");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
@@ -1418,10 +1394,10 @@ ListStreamingDistributions2018_06_18Outcome CloudFrontClient::ListStreamingDistr
 
 ListStreamingDistributions2018_06_18OutcomeCallable CloudFrontClient::ListStreamingDistributions2018_06_18Callable(const ListStreamingDistributions2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListStreamingDistributions2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListStreamingDistributions2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListStreamingDistributions2018_06_18Outcome() > task([this, request](){ return this->ListStreamingDistributions2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::ListStreamingDistributions2018_06_18Async(const ListStreamingDistributions2018_06_18Request& request, const ListStreamingDistributions2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1436,10 +1412,8 @@ void CloudFrontClient::ListStreamingDistributions2018_06_18AsyncHelper(const Lis
 
 ListTagsForResource2018_06_18Outcome CloudFrontClient::ListTagsForResource2018_06_18(const ListTagsForResource2018_06_18Request& request) const
 {
-  Aws::StringStream ss;
   Aws::Http::URI uri = m_uri;
-  ss << "/2018-06-18/tagging";
-  uri.SetPath(uri.GetPath() + ss.str());
+  uri.SetPath(uri.GetPath() + "/2018-06-18/tagging");
   XmlOutcome outcome = MakeRequest(uri, request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
@@ -1453,10 +1427,10 @@ ListTagsForResource2018_06_18Outcome CloudFrontClient::ListTagsForResource2018_0
 
 ListTagsForResource2018_06_18OutcomeCallable CloudFrontClient::ListTagsForResource2018_06_18Callable(const ListTagsForResource2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< ListTagsForResource2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->ListTagsForResource2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< ListTagsForResource2018_06_18Outcome() > task([this, request](){ return this->ListTagsForResource2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::ListTagsForResource2018_06_18Async(const ListTagsForResource2018_06_18Request& request, const ListTagsForResource2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1490,10 +1464,10 @@ TagResource2018_06_18Outcome CloudFrontClient::TagResource2018_06_18(const TagRe
 
 TagResource2018_06_18OutcomeCallable CloudFrontClient::TagResource2018_06_18Callable(const TagResource2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< TagResource2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->TagResource2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< TagResource2018_06_18Outcome() > task([this, request](){ return this->TagResource2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::TagResource2018_06_18Async(const TagResource2018_06_18Request& request, const TagResource2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1527,10 +1501,10 @@ UntagResource2018_06_18Outcome CloudFrontClient::UntagResource2018_06_18(const U
 
 UntagResource2018_06_18OutcomeCallable CloudFrontClient::UntagResource2018_06_18Callable(const UntagResource2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UntagResource2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UntagResource2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< UntagResource2018_06_18Outcome() > task([this, request](){ return this->UntagResource2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::UntagResource2018_06_18Async(const UntagResource2018_06_18Request& request, const UntagResource2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1564,10 +1538,10 @@ UpdateCloudFrontOriginAccessIdentity2018_06_18Outcome CloudFrontClient::UpdateCl
 
 UpdateCloudFrontOriginAccessIdentity2018_06_18OutcomeCallable CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2018_06_18Callable(const UpdateCloudFrontOriginAccessIdentity2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateCloudFrontOriginAccessIdentity2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateCloudFrontOriginAccessIdentity2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< UpdateCloudFrontOriginAccessIdentity2018_06_18Outcome() > task([this, request](){ return this->UpdateCloudFrontOriginAccessIdentity2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2018_06_18Async(const UpdateCloudFrontOriginAccessIdentity2018_06_18Request& request, const UpdateCloudFrontOriginAccessIdentity2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1601,10 +1575,10 @@ UpdateDistribution2018_06_18Outcome CloudFrontClient::UpdateDistribution2018_06_
 
 UpdateDistribution2018_06_18OutcomeCallable CloudFrontClient::UpdateDistribution2018_06_18Callable(const UpdateDistribution2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateDistribution2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateDistribution2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< UpdateDistribution2018_06_18Outcome() > task([this, request](){ return this->UpdateDistribution2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::UpdateDistribution2018_06_18Async(const UpdateDistribution2018_06_18Request& request, const UpdateDistribution2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1638,10 +1612,10 @@ UpdateFieldLevelEncryptionConfig2018_06_18Outcome CloudFrontClient::UpdateFieldL
 
 UpdateFieldLevelEncryptionConfig2018_06_18OutcomeCallable CloudFrontClient::UpdateFieldLevelEncryptionConfig2018_06_18Callable(const UpdateFieldLevelEncryptionConfig2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateFieldLevelEncryptionConfig2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateFieldLevelEncryptionConfig2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< UpdateFieldLevelEncryptionConfig2018_06_18Outcome() > task([this, request](){ return this->UpdateFieldLevelEncryptionConfig2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::UpdateFieldLevelEncryptionConfig2018_06_18Async(const UpdateFieldLevelEncryptionConfig2018_06_18Request& request, const UpdateFieldLevelEncryptionConfig2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1675,10 +1649,10 @@ UpdateFieldLevelEncryptionProfile2018_06_18Outcome CloudFrontClient::UpdateField
 
 UpdateFieldLevelEncryptionProfile2018_06_18OutcomeCallable CloudFrontClient::UpdateFieldLevelEncryptionProfile2018_06_18Callable(const UpdateFieldLevelEncryptionProfile2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateFieldLevelEncryptionProfile2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateFieldLevelEncryptionProfile2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< UpdateFieldLevelEncryptionProfile2018_06_18Outcome() > task([this, request](){ return this->UpdateFieldLevelEncryptionProfile2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::UpdateFieldLevelEncryptionProfile2018_06_18Async(const UpdateFieldLevelEncryptionProfile2018_06_18Request& request, const UpdateFieldLevelEncryptionProfile2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1712,10 +1686,10 @@ UpdatePublicKey2018_06_18Outcome CloudFrontClient::UpdatePublicKey2018_06_18(con
 
 UpdatePublicKey2018_06_18OutcomeCallable CloudFrontClient::UpdatePublicKey2018_06_18Callable(const UpdatePublicKey2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdatePublicKey2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdatePublicKey2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< UpdatePublicKey2018_06_18Outcome() > task([this, request](){ return this->UpdatePublicKey2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::UpdatePublicKey2018_06_18Async(const UpdatePublicKey2018_06_18Request& request, const UpdatePublicKey2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1749,10 +1723,10 @@ UpdateStreamingDistribution2018_06_18Outcome CloudFrontClient::UpdateStreamingDi
 
 UpdateStreamingDistribution2018_06_18OutcomeCallable CloudFrontClient::UpdateStreamingDistribution2018_06_18Callable(const UpdateStreamingDistribution2018_06_18Request& request) const
 {
-  auto task = Aws::MakeShared< std::packaged_task< UpdateStreamingDistribution2018_06_18Outcome() > >(ALLOCATION_TAG, [this, request](){ return this->UpdateStreamingDistribution2018_06_18(request); } );
-  auto packagedFunction = [task]() { (*task)(); };
-  m_executor->Submit(packagedFunction);
-  return task->get_future();
+  std::packaged_task< UpdateStreamingDistribution2018_06_18Outcome() > task([this, request](){ return this->UpdateStreamingDistribution2018_06_18(request); } );
+  auto future = task.get_future();
+  m_executor->Submit(std::move(task));
+  return future;
 }
 
 void CloudFrontClient::UpdateStreamingDistribution2018_06_18Async(const UpdateStreamingDistribution2018_06_18Request& request, const UpdateStreamingDistribution2018_06_18ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
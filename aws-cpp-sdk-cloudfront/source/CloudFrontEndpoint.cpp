@@ -26,10 +26,10 @@ namespace CloudFront
 {
 namespace CloudFrontEndpoint
 {
-  static const int CN_NORTH_HASH = Aws::Utils::HashingUtils::HashString("cn-north-1");
-  static const int CN_NORTHWEST_1_HASH = Aws::Utils::HashingUtils::HashString("cn-northwest-1");
+  static constexpr int CN_NORTH_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("cn-north-1");
+  static constexpr int CN_NORTHWEST_1_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("cn-northwest-1");
   
-  static const int US_EAST_1_HASH = Aws::Utils::HashingUtils::HashString("us-east-1");
+  static constexpr int US_EAST_1_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("us-east-1");
 
   Aws::String ForRegion(const Aws::String& regionName, bool useDualStack)
   {
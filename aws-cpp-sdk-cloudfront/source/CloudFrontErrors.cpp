@@ -28,85 +28,85 @@ namespace CloudFront
 namespace CloudFrontErrorMapper
 {
 
-static const int TOO_MANY_DISTRIBUTIONS_ASSOCIATED_TO_FIELD_LEVEL_ENCRYPTION_CONFIG_HASH = HashingUtils::HashString("TooManyDistributionsAssociatedToFieldLevelEncryptionConfig");
-static const int NO_SUCH_FIELD_LEVEL_ENCRYPTION_PROFILE_HASH = HashingUtils::HashString("NoSuchFieldLevelEncryptionProfile");
-static const int NO_SUCH_STREAMING_DISTRIBUTION_HASH = HashingUtils::HashString("NoSuchStreamingDistribution");
-static const int INVALID_RELATIVE_PATH_HASH = HashingUtils::HashString("InvalidRelativePath");
-static const int PUBLIC_KEY_IN_USE_HASH = HashingUtils::HashString("PublicKeyInUse");
-static const int ILLEGAL_FIELD_LEVEL_ENCRYPTION_CONFIG_ASSOCIATION_WITH_CACHE_BEHAVIOR_HASH = HashingUtils::HashString("IllegalFieldLevelEncryptionConfigAssociationWithCacheBehavior");
-static const int PUBLIC_KEY_ALREADY_EXISTS_HASH = HashingUtils::HashString("PublicKeyAlreadyExists");
-static const int INVALID_REQUIRED_PROTOCOL_HASH = HashingUtils::HashString("InvalidRequiredProtocol");
-static const int INVALID_VIEWER_CERTIFICATE_HASH = HashingUtils::HashString("InvalidViewerCertificate");
-static const int TOO_MANY_DISTRIBUTIONS_HASH = HashingUtils::HashString("TooManyDistributions");
-static const int INVALID_LOCATION_CODE_HASH = HashingUtils::HashString("InvalidLocationCode");
-static const int TOO_MANY_TRUSTED_SIGNERS_HASH = HashingUtils::HashString("TooManyTrustedSigners");
-static const int TOO_MANY_PUBLIC_KEYS_HASH = HashingUtils::HashString("TooManyPublicKeys");
-static const int CLOUD_FRONT_ORIGIN_ACCESS_IDENTITY_IN_USE_HASH = HashingUtils::HashString("CloudFrontOriginAccessIdentityInUse");
-static const int STREAMING_DISTRIBUTION_NOT_DISABLED_HASH = HashingUtils::HashString("StreamingDistributionNotDisabled");
-static const int MISSING_BODY_HASH = HashingUtils::HashString("MissingBody");
-static const int INVALID_ORIGIN_HASH = HashingUtils::HashString("InvalidOrigin");
-static const int CLOUD_FRONT_ORIGIN_ACCESS_IDENTITY_ALREADY_EXISTS_HASH = HashingUtils::HashString("CloudFrontOriginAccessIdentityAlreadyExists");
-static const int INVALID_HEADERS_FOR_S3_ORIGIN_HASH = HashingUtils::HashString("InvalidHeadersForS3Origin");
-static const int TOO_MANY_ORIGIN_CUSTOM_HEADERS_HASH = HashingUtils::HashString("TooManyOriginCustomHeaders");
-static const int INVALID_ERROR_CODE_HASH = HashingUtils::HashString("InvalidErrorCode");
-static const int TOO_MANY_STREAMING_DISTRIBUTION_C_N_A_M_ES_HASH = HashingUtils::HashString("TooManyStreamingDistributionCNAMEs");
-static const int NO_SUCH_CLOUD_FRONT_ORIGIN_ACCESS_IDENTITY_HASH = HashingUtils::HashString("NoSuchCloudFrontOriginAccessIdentity");
-static const int INVALID_FORWARD_COOKIES_HASH = HashingUtils::HashString("InvalidForwardCookies");
-static const int TOO_MANY_FIELD_LEVEL_ENCRYPTION_CONTENT_TYPE_PROFILES_HASH = HashingUtils::HashString("TooManyFieldLevelEncryptionContentTypeProfiles");
-static const int TOO_MANY_INVALIDATIONS_IN_PROGRESS_HASH = HashingUtils::HashString("TooManyInvalidationsInProgress");
-static const int INVALID_PROTOCOL_SETTINGS_HASH = HashingUtils::HashString("InvalidProtocolSettings");
-static const int NO_SUCH_RESOURCE_HASH = HashingUtils::HashString("NoSuchResource");
-static const int NO_SUCH_DISTRIBUTION_HASH = HashingUtils::HashString("NoSuchDistribution");
-static const int TOO_MANY_HEADERS_IN_FORWARDED_VALUES_HASH = HashingUtils::HashString("TooManyHeadersInForwardedValues");
-static const int INVALID_GEO_RESTRICTION_PARAMETER_HASH = HashingUtils::HashString("InvalidGeoRestrictionParameter");
-static const int STREAMING_DISTRIBUTION_ALREADY_EXISTS_HASH = HashingUtils::HashString("StreamingDistributionAlreadyExists");
-static const int DISTRIBUTION_NOT_DISABLED_HASH = HashingUtils::HashString("DistributionNotDisabled");
-static const int C_N_A_M_E_ALREADY_EXISTS_HASH = HashingUtils::HashString("CNAMEAlreadyExists");
-static const int TOO_MANY_QUERY_STRING_PARAMETERS_HASH = HashingUtils::HashString("TooManyQueryStringParameters");
-static const int NO_SUCH_FIELD_LEVEL_ENCRYPTION_CONFIG_HASH = HashingUtils::HashString("NoSuchFieldLevelEncryptionConfig");
-static const int TOO_MANY_FIELD_LEVEL_ENCRYPTION_CONFIGS_HASH = HashingUtils::HashString("TooManyFieldLevelEncryptionConfigs");
-static const int TOO_MANY_DISTRIBUTIONS_WITH_LAMBDA_ASSOCIATIONS_HASH = HashingUtils::HashString("TooManyDistributionsWithLambdaAssociations");
-static const int TOO_MANY_FIELD_LEVEL_ENCRYPTION_QUERY_ARG_PROFILES_HASH = HashingUtils::HashString("TooManyFieldLevelEncryptionQueryArgProfiles");
-static const int QUERY_ARG_PROFILE_EMPTY_HASH = HashingUtils::HashString("QueryArgProfileEmpty");
-static const int INVALID_DEFAULT_ROOT_OBJECT_HASH = HashingUtils::HashString("InvalidDefaultRootObject");
-static const int BATCH_TOO_LARGE_HASH = HashingUtils::HashString("BatchTooLarge");
-static const int NO_SUCH_PUBLIC_KEY_HASH = HashingUtils::HashString("NoSuchPublicKey");
-static const int TOO_MANY_CERTIFICATES_HASH = HashingUtils::HashString("TooManyCertificates");
-static const int TOO_MANY_DISTRIBUTION_C_N_A_M_ES_HASH = HashingUtils::HashString("TooManyDistributionCNAMEs");
-static const int INVALID_T_T_L_ORDER_HASH = HashingUtils::HashString("InvalidTTLOrder");
-static const int CANNOT_CHANGE_IMMUTABLE_PUBLIC_KEY_FIELDS_HASH = HashingUtils::HashString("CannotChangeImmutablePublicKeyFields");
-static const int INVALID_ARGUMENT_HASH = HashingUtils::HashString("InvalidArgument");
-static const int TOO_MANY_STREAMING_DISTRIBUTIONS_HASH = HashingUtils::HashString("TooManyStreamingDistributions");
-static const int TOO_MANY_FIELD_LEVEL_ENCRYPTION_ENCRYPTION_ENTITIES_HASH = HashingUtils::HashString("TooManyFieldLevelEncryptionEncryptionEntities");
-static const int INVALID_WEB_A_C_L_ID_HASH = HashingUtils::HashString("InvalidWebACLId");
-static const int TOO_MANY_CLOUD_FRONT_ORIGIN_ACCESS_IDENTITIES_HASH = HashingUtils::HashString("TooManyCloudFrontOriginAccessIdentities");
-static const int PRECONDITION_FAILED_HASH = HashingUtils::HashString("PreconditionFailed");
-static const int TRUSTED_SIGNER_DOES_NOT_EXIST_HASH = HashingUtils::HashString("TrustedSignerDoesNotExist");
-static const int INVALID_ORIGIN_READ_TIMEOUT_HASH = HashingUtils::HashString("InvalidOriginReadTimeout");
-static const int INVALID_ORIGIN_KEEPALIVE_TIMEOUT_HASH = HashingUtils::HashString("InvalidOriginKeepaliveTimeout");
-static const int FIELD_LEVEL_ENCRYPTION_PROFILE_ALREADY_EXISTS_HASH = HashingUtils::HashString("FieldLevelEncryptionProfileAlreadyExists");
-static const int TOO_MANY_ORIGINS_HASH = HashingUtils::HashString("TooManyOrigins");
-static const int NO_SUCH_INVALIDATION_HASH = HashingUtils::HashString("NoSuchInvalidation");
-static const int INVALID_LAMBDA_FUNCTION_ASSOCIATION_HASH = HashingUtils::HashString("InvalidLambdaFunctionAssociation");
-static const int FIELD_LEVEL_ENCRYPTION_PROFILE_SIZE_EXCEEDED_HASH = HashingUtils::HashString("FieldLevelEncryptionProfileSizeExceeded");
-static const int FIELD_LEVEL_ENCRYPTION_CONFIG_ALREADY_EXISTS_HASH = HashingUtils::HashString("FieldLevelEncryptionConfigAlreadyExists");
-static const int TOO_MANY_CACHE_BEHAVIORS_HASH = HashingUtils::HashString("TooManyCacheBehaviors");
-static const int NO_SUCH_ORIGIN_HASH = HashingUtils::HashString("NoSuchOrigin");
-static const int DISTRIBUTION_ALREADY_EXISTS_HASH = HashingUtils::HashString("DistributionAlreadyExists");
-static const int FIELD_LEVEL_ENCRYPTION_CONFIG_IN_USE_HASH = HashingUtils::HashString("FieldLevelEncryptionConfigInUse");
-static const int FIELD_LEVEL_ENCRYPTION_PROFILE_IN_USE_HASH = HashingUtils::HashString("FieldLevelEncryptionProfileInUse");
-static const int INCONSISTENT_QUANTITIES_HASH = HashingUtils::HashString("InconsistentQuantities");
-static const int TOO_MANY_LAMBDA_FUNCTION_ASSOCIATIONS_HASH = HashingUtils::HashString("TooManyLambdaFunctionAssociations");
-static const int INVALID_MINIMUM_PROTOCOL_VERSION_HASH = HashingUtils::HashString("InvalidMinimumProtocolVersion");
-static const int INVALID_TAGGING_HASH = HashingUtils::HashString("InvalidTagging");
-static const int TOO_MANY_FIELD_LEVEL_ENCRYPTION_PROFILES_HASH = HashingUtils::HashString("TooManyFieldLevelEncryptionProfiles");
-static const int ILLEGAL_UPDATE_HASH = HashingUtils::HashString("IllegalUpdate");
-static const int INVALID_ORIGIN_ACCESS_IDENTITY_HASH = HashingUtils::HashString("InvalidOriginAccessIdentity");
-static const int INVALID_QUERY_STRING_PARAMETERS_HASH = HashingUtils::HashString("InvalidQueryStringParameters");
-static const int INVALID_IF_MATCH_VERSION_HASH = HashingUtils::HashString("InvalidIfMatchVersion");
-static const int INVALID_RESPONSE_CODE_HASH = HashingUtils::HashString("InvalidResponseCode");
-static const int TOO_MANY_COOKIE_NAMES_IN_WHITE_LIST_HASH = HashingUtils::HashString("TooManyCookieNamesInWhiteList");
-static const int TOO_MANY_FIELD_LEVEL_ENCRYPTION_FIELD_PATTERNS_HASH = HashingUtils::HashString("TooManyFieldLevelEncryptionFieldPatterns");
+static constexpr int TOO_MANY_DISTRIBUTIONS_ASSOCIATED_TO_FIELD_LEVEL_ENCRYPTION_CONFIG_HASH = HashingUtils::CompileTimeHashString("TooManyDistributionsAssociatedToFieldLevelEncryptionConfig");
+static constexpr int NO_SUCH_FIELD_LEVEL_ENCRYPTION_PROFILE_HASH = HashingUtils::CompileTimeHashString("NoSuchFieldLevelEncryptionProfile");
+static constexpr int NO_SUCH_STREAMING_DISTRIBUTION_HASH = HashingUtils::CompileTimeHashString("NoSuchStreamingDistribution");
+static constexpr int INVALID_RELATIVE_PATH_HASH = HashingUtils::CompileTimeHashString("InvalidRelativePath");
+static constexpr int PUBLIC_KEY_IN_USE_HASH = HashingUtils::CompileTimeHashString("PublicKeyInUse");
+static constexpr int ILLEGAL_FIELD_LEVEL_ENCRYPTION_CONFIG_ASSOCIATION_WITH_CACHE_BEHAVIOR_HASH = HashingUtils::CompileTimeHashString("IllegalFieldLevelEncryptionConfigAssociationWithCacheBehavior");
+static constexpr int PUBLIC_KEY_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("PublicKeyAlreadyExists");
+static constexpr int INVALID_REQUIRED_PROTOCOL_HASH = HashingUtils::CompileTimeHashString("InvalidRequiredProtocol");
+static constexpr int INVALID_VIEWER_CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("InvalidViewerCertificate");
+static constexpr int TOO_MANY_DISTRIBUTIONS_HASH = HashingUtils::CompileTimeHashString("TooManyDistributions");
+static constexpr int INVALID_LOCATION_CODE_HASH = HashingUtils::CompileTimeHashString("InvalidLocationCode");
+static constexpr int TOO_MANY_TRUSTED_SIGNERS_HASH = HashingUtils::CompileTimeHashString("TooManyTrustedSigners");
+static constexpr int TOO_MANY_PUBLIC_KEYS_HASH = HashingUtils::CompileTimeHashString("TooManyPublicKeys");
+static constexpr int CLOUD_FRONT_ORIGIN_ACCESS_IDENTITY_IN_USE_HASH = HashingUtils::CompileTimeHashString("CloudFrontOriginAccessIdentityInUse");
+static constexpr int STREAMING_DISTRIBUTION_NOT_DISABLED_HASH = HashingUtils::CompileTimeHashString("StreamingDistributionNotDisabled");
+static constexpr int MISSING_BODY_HASH = HashingUtils::CompileTimeHashString("MissingBody");
+static constexpr int INVALID_ORIGIN_HASH = HashingUtils::CompileTimeHashString("InvalidOrigin");
+static constexpr int CLOUD_FRONT_ORIGIN_ACCESS_IDENTITY_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("CloudFrontOriginAccessIdentityAlreadyExists");
+static constexpr int INVALID_HEADERS_FOR_S3_ORIGIN_HASH = HashingUtils::CompileTimeHashString("InvalidHeadersForS3Origin");
+static constexpr int TOO_MANY_ORIGIN_CUSTOM_HEADERS_HASH = HashingUtils::CompileTimeHashString("TooManyOriginCustomHeaders");
+static constexpr int INVALID_ERROR_CODE_HASH = HashingUtils::CompileTimeHashString("InvalidErrorCode");
+static constexpr int TOO_MANY_STREAMING_DISTRIBUTION_C_N_A_M_ES_HASH = HashingUtils::CompileTimeHashString("TooManyStreamingDistributionCNAMEs");
+static constexpr int NO_SUCH_CLOUD_FRONT_ORIGIN_ACCESS_IDENTITY_HASH = HashingUtils::CompileTimeHashString("NoSuchCloudFrontOriginAccessIdentity");
+static constexpr int INVALID_FORWARD_COOKIES_HASH = HashingUtils::CompileTimeHashString("InvalidForwardCookies");
+static constexpr int TOO_MANY_FIELD_LEVEL_ENCRYPTION_CONTENT_TYPE_PROFILES_HASH = HashingUtils::CompileTimeHashString("TooManyFieldLevelEncryptionContentTypeProfiles");
+static constexpr int TOO_MANY_INVALIDATIONS_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("TooManyInvalidationsInProgress");
+static constexpr int INVALID_PROTOCOL_SETTINGS_HASH = HashingUtils::CompileTimeHashString("InvalidProtocolSettings");
+static constexpr int NO_SUCH_RESOURCE_HASH = HashingUtils::CompileTimeHashString("NoSuchResource");
+static constexpr int NO_SUCH_DISTRIBUTION_HASH = HashingUtils::CompileTimeHashString("NoSuchDistribution");
+static constexpr int TOO_MANY_HEADERS_IN_FORWARDED_VALUES_HASH = HashingUtils::CompileTimeHashString("TooManyHeadersInForwardedValues");
+static constexpr int INVALID_GEO_RESTRICTION_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidGeoRestrictionParameter");
+static constexpr int STREAMING_DISTRIBUTION_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("StreamingDistributionAlreadyExists");
+static constexpr int DISTRIBUTION_NOT_DISABLED_HASH = HashingUtils::CompileTimeHashString("DistributionNotDisabled");
+static constexpr int C_N_A_M_E_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("CNAMEAlreadyExists");
+static constexpr int TOO_MANY_QUERY_STRING_PARAMETERS_HASH = HashingUtils::CompileTimeHashString("TooManyQueryStringParameters");
+static constexpr int NO_SUCH_FIELD_LEVEL_ENCRYPTION_CONFIG_HASH = HashingUtils::CompileTimeHashString("NoSuchFieldLevelEncryptionConfig");
+static constexpr int TOO_MANY_FIELD_LEVEL_ENCRYPTION_CONFIGS_HASH = HashingUtils::CompileTimeHashString("TooManyFieldLevelEncryptionConfigs");
+static constexpr int TOO_MANY_DISTRIBUTIONS_WITH_LAMBDA_ASSOCIATIONS_HASH = HashingUtils::CompileTimeHashString("TooManyDistributionsWithLambdaAssociations");
+static constexpr int TOO_MANY_FIELD_LEVEL_ENCRYPTION_QUERY_ARG_PROFILES_HASH = HashingUtils::CompileTimeHashString("TooManyFieldLevelEncryptionQueryArgProfiles");
+static constexpr int QUERY_ARG_PROFILE_EMPTY_HASH = HashingUtils::CompileTimeHashString("QueryArgProfileEmpty");
+static constexpr int INVALID_DEFAULT_ROOT_OBJECT_HASH = HashingUtils::CompileTimeHashString("InvalidDefaultRootObject");
+static constexpr int BATCH_TOO_LARGE_HASH = HashingUtils::CompileTimeHashString("BatchTooLarge");
+static constexpr int NO_SUCH_PUBLIC_KEY_HASH = HashingUtils::CompileTimeHashString("NoSuchPublicKey");
+static constexpr int TOO_MANY_CERTIFICATES_HASH = HashingUtils::CompileTimeHashString("TooManyCertificates");
+static constexpr int TOO_MANY_DISTRIBUTION_C_N_A_M_ES_HASH = HashingUtils::CompileTimeHashString("TooManyDistributionCNAMEs");
+static constexpr int INVALID_T_T_L_ORDER_HASH = HashingUtils::CompileTimeHashString("InvalidTTLOrder");
+static constexpr int CANNOT_CHANGE_IMMUTABLE_PUBLIC_KEY_FIELDS_HASH = HashingUtils::CompileTimeHashString("CannotChangeImmutablePublicKeyFields");
+static constexpr int INVALID_ARGUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidArgument");
+static constexpr int TOO_MANY_STREAMING_DISTRIBUTIONS_HASH = HashingUtils::CompileTimeHashString("TooManyStreamingDistributions");
+static constexpr int TOO_MANY_FIELD_LEVEL_ENCRYPTION_ENCRYPTION_ENTITIES_HASH = HashingUtils::CompileTimeHashString("TooManyFieldLevelEncryptionEncryptionEntities");
+static constexpr int INVALID_WEB_A_C_L_ID_HASH = HashingUtils::CompileTimeHashString("InvalidWebACLId");
+static constexpr int TOO_MANY_CLOUD_FRONT_ORIGIN_ACCESS_IDENTITIES_HASH = HashingUtils::CompileTimeHashString("TooManyCloudFrontOriginAccessIdentities");
+static constexpr int PRECONDITION_FAILED_HASH = HashingUtils::CompileTimeHashString("PreconditionFailed");
+static constexpr int TRUSTED_SIGNER_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("TrustedSignerDoesNotExist");
+static constexpr int INVALID_ORIGIN_READ_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("InvalidOriginReadTimeout");
+static constexpr int INVALID_ORIGIN_KEEPALIVE_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("InvalidOriginKeepaliveTimeout");
+static constexpr int FIELD_LEVEL_ENCRYPTION_PROFILE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("FieldLevelEncryptionProfileAlreadyExists");
+static constexpr int TOO_MANY_ORIGINS_HASH = HashingUtils::CompileTimeHashString("TooManyOrigins");
+static constexpr int NO_SUCH_INVALIDATION_HASH = HashingUtils::CompileTimeHashString("NoSuchInvalidation");
+static constexpr int INVALID_LAMBDA_FUNCTION_ASSOCIATION_HASH = HashingUtils::CompileTimeHashString("InvalidLambdaFunctionAssociation");
+static constexpr int FIELD_LEVEL_ENCRYPTION_PROFILE_SIZE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("FieldLevelEncryptionProfileSizeExceeded");
+static constexpr int FIELD_LEVEL_ENCRYPTION_CONFIG_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("FieldLevelEncryptionConfigAlreadyExists");
+static constexpr int TOO_MANY_CACHE_BEHAVIORS_HASH = HashingUtils::CompileTimeHashString("TooManyCacheBehaviors");
+static constexpr int NO_SUCH_ORIGIN_HASH = HashingUtils::CompileTimeHashString("NoSuchOrigin");
+static constexpr int DISTRIBUTION_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("DistributionAlreadyExists");
+static constexpr int FIELD_LEVEL_ENCRYPTION_CONFIG_IN_USE_HASH = HashingUtils::CompileTimeHashString("FieldLevelEncryptionConfigInUse");
+static constexpr int FIELD_LEVEL_ENCRYPTION_PROFILE_IN_USE_HASH = HashingUtils::CompileTimeHashString("FieldLevelEncryptionProfileInUse");
+static constexpr int INCONSISTENT_QUANTITIES_HASH = HashingUtils::CompileTimeHashString("InconsistentQuantities");
+static constexpr int TOO_MANY_LAMBDA_FUNCTION_ASSOCIATIONS_HASH = HashingUtils::CompileTimeHashString("TooManyLambdaFunctionAssociations");
+static constexpr int INVALID_MINIMUM_PROTOCOL_VERSION_HASH = HashingUtils::CompileTimeHashString("InvalidMinimumProtocolVersion");
+static constexpr int INVALID_TAGGING_HASH = HashingUtils::CompileTimeHashString("InvalidTagging");
+static constexpr int TOO_MANY_FIELD_LEVEL_ENCRYPTION_PROFILES_HASH = HashingUtils::CompileTimeHashString("TooManyFieldLevelEncryptionProfiles");
+static constexpr int ILLEGAL_UPDATE_HASH = HashingUtils::CompileTimeHashString("IllegalUpdate");
+static constexpr int INVALID_ORIGIN_ACCESS_IDENTITY_HASH = HashingUtils::CompileTimeHashString("InvalidOriginAccessIdentity");
+static constexpr int INVALID_QUERY_STRING_PARAMETERS_HASH = HashingUtils::CompileTimeHashString("InvalidQueryStringParameters");
+static constexpr int INVALID_IF_MATCH_VERSION_HASH = HashingUtils::CompileTimeHashString("InvalidIfMatchVersion");
+static constexpr int INVALID_RESPONSE_CODE_HASH = HashingUtils::CompileTimeHashString("InvalidResponseCode");
+static constexpr int TOO_MANY_COOKIE_NAMES_IN_WHITE_LIST_HASH = HashingUtils::CompileTimeHashString("TooManyCookieNamesInWhiteList");
+static constexpr int TOO_MANY_FIELD_LEVEL_ENCRYPTION_FIELD_PATTERNS_HASH = HashingUtils::CompileTimeHashString("TooManyFieldLevelEncryptionFieldPatterns");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
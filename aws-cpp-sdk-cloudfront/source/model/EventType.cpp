@@ -30,30 +30,44 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int viewer_request_HASH = HashingUtils::HashString("viewer-request");
-        static const int viewer_response_HASH = HashingUtils::HashString("viewer-response");
-        static const int origin_request_HASH = HashingUtils::HashString("origin-request");
-        static const int origin_response_HASH = HashingUtils::HashString("origin-response");
+        static constexpr int viewer_request_HASH = HashingUtils::CompileTimeHashString("viewer-request");
+        static constexpr int viewer_response_HASH = HashingUtils::CompileTimeHashString("viewer-response");
+        static constexpr int origin_request_HASH = HashingUtils::CompileTimeHashString("origin-request");
+        static constexpr int origin_response_HASH = HashingUtils::CompileTimeHashString("origin-response");
 
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == viewer_request_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventType::viewer_request;
-          }
-          else if (hashCode == viewer_response_HASH)
-          {
-            return EventType::viewer_response;
-          }
-          else if (hashCode == origin_request_HASH)
-          {
-            return EventType::origin_request;
-          }
-          else if (hashCode == origin_response_HASH)
-          {
-            return EventType::origin_response;
+          case viewer_request_HASH:
+            if (name == "viewer-request")
+            {
+              return EventType::viewer_request;
+            }
+            break;
+          case viewer_response_HASH:
+            if (name == "viewer-response")
+            {
+              return EventType::viewer_response;
+            }
+            break;
+          case origin_request_HASH:
+            if (name == "origin-request")
+            {
+              return EventType::origin_request;
+            }
+            break;
+          case origin_response_HASH:
+            if (name == "origin-response")
+            {
+              return EventType::origin_response;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventType(EventType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
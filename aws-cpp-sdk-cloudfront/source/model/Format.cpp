@@ -30,15 +30,23 @@ namespace Aws
       namespace FormatMapper
       {
 
-        static const int URLEncoded_HASH = HashingUtils::HashString("URLEncoded");
+        static constexpr int URLEncoded_HASH = HashingUtils::CompileTimeHashString("URLEncoded");
 
 
         Format GetFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == URLEncoded_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Format::URLEncoded;
+          case URLEncoded_HASH:
+            if (name == "URLEncoded")
+            {
+              return Format::URLEncoded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return Format::NOT_SET;
         }
 
-        Aws::String GetNameForFormat(Format enumValue)
+        const char* GetNameForFormat(Format enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
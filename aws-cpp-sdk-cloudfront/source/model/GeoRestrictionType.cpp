@@ -30,25 +30,37 @@ namespace Aws
       namespace GeoRestrictionTypeMapper
       {
 
-        static const int blacklist_HASH = HashingUtils::HashString("blacklist");
-        static const int whitelist_HASH = HashingUtils::HashString("whitelist");
-        static const int none_HASH = HashingUtils::HashString("none");
+        static constexpr int blacklist_HASH = HashingUtils::CompileTimeHashString("blacklist");
+        static constexpr int whitelist_HASH = HashingUtils::CompileTimeHashString("whitelist");
+        static constexpr int none_HASH = HashingUtils::CompileTimeHashString("none");
 
 
         GeoRestrictionType GetGeoRestrictionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == blacklist_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GeoRestrictionType::blacklist;
-          }
-          else if (hashCode == whitelist_HASH)
-          {
-            return GeoRestrictionType::whitelist;
-          }
-          else if (hashCode == none_HASH)
-          {
-            return GeoRestrictionType::none;
+          case blacklist_HASH:
+            if (name == "blacklist")
+            {
+              return GeoRestrictionType::blacklist;
+            }
+            break;
+          case whitelist_HASH:
+            if (name == "whitelist")
+            {
+              return GeoRestrictionType::whitelist;
+            }
+            break;
+          case none_HASH:
+            if (name == "none")
+            {
+              return GeoRestrictionType::none;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return GeoRestrictionType::NOT_SET;
         }
 
-        Aws::String GetNameForGeoRestrictionType(GeoRestrictionType enumValue)
+        const char* GetNameForGeoRestrictionType(GeoRestrictionType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HttpVersionMapper
       {
 
-        static const int http1_1_HASH = HashingUtils::HashString("http1.1");
-        static const int http2_HASH = HashingUtils::HashString("http2");
+        static constexpr int http1_1_HASH = HashingUtils::CompileTimeHashString("http1.1");
+        static constexpr int http2_HASH = HashingUtils::CompileTimeHashString("http2");
 
 
         HttpVersion GetHttpVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == http1_1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HttpVersion::http1_1;
-          }
-          else if (hashCode == http2_HASH)
-          {
-            return HttpVersion::http2;
+          case http1_1_HASH:
+            if (name == "http1.1")
+            {
+              return HttpVersion::http1_1;
+            }
+            break;
+          case http2_HASH:
+            if (name == "http2")
+            {
+              return HttpVersion::http2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HttpVersion::NOT_SET;
         }
 
-        Aws::String GetNameForHttpVersion(HttpVersion enumValue)
+        const char* GetNameForHttpVersion(HttpVersion enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ItemSelectionMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int whitelist_HASH = HashingUtils::HashString("whitelist");
-        static const int all_HASH = HashingUtils::HashString("all");
+        static constexpr int none_HASH = HashingUtils::CompileTimeHashString("none");
+        static constexpr int whitelist_HASH = HashingUtils::CompileTimeHashString("whitelist");
+        static constexpr int all_HASH = HashingUtils::CompileTimeHashString("all");
 
 
         ItemSelection GetItemSelectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ItemSelection::none;
-          }
-          else if (hashCode == whitelist_HASH)
-          {
-            return ItemSelection::whitelist;
-          }
-          else if (hashCode == all_HASH)
-          {
-            return ItemSelection::all;
+          case none_HASH:
+            if (name == "none")
+            {
+              return ItemSelection::none;
+            }
+            break;
+          case whitelist_HASH:
+            if (name == "whitelist")
+            {
+              return ItemSelection::whitelist;
+            }
+            break;
+          case all_HASH:
+            if (name == "all")
+            {
+              return ItemSelection::all;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ItemSelection::NOT_SET;
         }
 
-        Aws::String GetNameForItemSelection(ItemSelection enumValue)
+        const char* GetNameForItemSelection(ItemSelection enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
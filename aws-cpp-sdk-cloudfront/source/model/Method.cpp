@@ -30,45 +30,65 @@ namespace Aws
       namespace MethodMapper
       {
 
-        static const int GET__HASH = HashingUtils::HashString("GET");
-        static const int HEAD_HASH = HashingUtils::HashString("HEAD");
-        static const int POST_HASH = HashingUtils::HashString("POST");
-        static const int PUT_HASH = HashingUtils::HashString("PUT");
-        static const int PATCH_HASH = HashingUtils::HashString("PATCH");
-        static const int OPTIONS_HASH = HashingUtils::HashString("OPTIONS");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
+        static constexpr int GET__HASH = HashingUtils::CompileTimeHashString("GET");
+        static constexpr int HEAD_HASH = HashingUtils::CompileTimeHashString("HEAD");
+        static constexpr int POST_HASH = HashingUtils::CompileTimeHashString("POST");
+        static constexpr int PUT_HASH = HashingUtils::CompileTimeHashString("PUT");
+        static constexpr int PATCH_HASH = HashingUtils::CompileTimeHashString("PATCH");
+        static constexpr int OPTIONS_HASH = HashingUtils::CompileTimeHashString("OPTIONS");
+        static constexpr int DELETE__HASH = HashingUtils::CompileTimeHashString("DELETE");
 
 
         Method GetMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GET__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Method::GET_;
-          }
-          else if (hashCode == HEAD_HASH)
-          {
-            return Method::HEAD;
-          }
-          else if (hashCode == POST_HASH)
-          {
-            return Method::POST;
-          }
-          else if (hashCode == PUT_HASH)
-          {
-            return Method::PUT;
-          }
-          else if (hashCode == PATCH_HASH)
-          {
-            return Method::PATCH;
-          }
-          else if (hashCode == OPTIONS_HASH)
-          {
-            return Method::OPTIONS;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return Method::DELETE_;
+          case GET__HASH:
+            if (name == "GET")
+            {
+              return Method::GET_;
+            }
+            break;
+          case HEAD_HASH:
+            if (name == "HEAD")
+            {
+              return Method::HEAD;
+            }
+            break;
+          case POST_HASH:
+            if (name == "POST")
+            {
+              return Method::POST;
+            }
+            break;
+          case PUT_HASH:
+            if (name == "PUT")
+            {
+              return Method::PUT;
+            }
+            break;
+          case PATCH_HASH:
+            if (name == "PATCH")
+            {
+              return Method::PATCH;
+            }
+            break;
+          case OPTIONS_HASH:
+            if (name == "OPTIONS")
+            {
+              return Method::OPTIONS;
+            }
+            break;
+          case DELETE__HASH:
+            if (name == "DELETE")
+            {
+              return Method::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return Method::NOT_SET;
         }
 
-        Aws::String GetNameForMethod(Method enumValue)
+        const char* GetNameForMethod(Method enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace MinimumProtocolVersionMapper
       {
 
-        static const int SSLv3_HASH = HashingUtils::HashString("SSLv3");
-        static const int TLSv1_HASH = HashingUtils::HashString("TLSv1");
-        static const int TLSv1_2016_HASH = HashingUtils::HashString("TLSv1_2016");
-        static const int TLSv1_1_2016_HASH = HashingUtils::HashString("TLSv1.1_2016");
-        static const int TLSv1_2_2018_HASH = HashingUtils::HashString("TLSv1.2_2018");
+        static constexpr int SSLv3_HASH = HashingUtils::CompileTimeHashString("SSLv3");
+        static constexpr int TLSv1_HASH = HashingUtils::CompileTimeHashString("TLSv1");
+        static constexpr int TLSv1_2016_HASH = HashingUtils::CompileTimeHashString("TLSv1_2016");
+        static constexpr int TLSv1_1_2016_HASH = HashingUtils::CompileTimeHashString("TLSv1.1_2016");
+        static constexpr int TLSv1_2_2018_HASH = HashingUtils::CompileTimeHashString("TLSv1.2_2018");
 
 
         MinimumProtocolVersion GetMinimumProtocolVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSLv3_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MinimumProtocolVersion::SSLv3;
-          }
-          else if (hashCode == TLSv1_HASH)
-          {
-            return MinimumProtocolVersion::TLSv1;
-          }
-          else if (hashCode == TLSv1_2016_HASH)
-          {
-            return MinimumProtocolVersion::TLSv1_2016;
-          }
-          else if (hashCode == TLSv1_1_2016_HASH)
-          {
-            return MinimumProtocolVersion::TLSv1_1_2016;
-          }
-          else if (hashCode == TLSv1_2_2018_HASH)
-          {
-            return MinimumProtocolVersion::TLSv1_2_2018;
+          case SSLv3_HASH:
+            if (name == "SSLv3")
+            {
+              return MinimumProtocolVersion::SSLv3;
+            }
+            break;
+          case TLSv1_HASH:
+            if (name == "TLSv1")
+            {
+              return MinimumProtocolVersion::TLSv1;
+            }
+            break;
+          case TLSv1_2016_HASH:
+            if (name == "TLSv1_2016")
+            {
+              return MinimumProtocolVersion::TLSv1_2016;
+            }
+            break;
+          case TLSv1_1_2016_HASH:
+            if (name == "TLSv1.1_2016")
+            {
+              return MinimumProtocolVersion::TLSv1_1_2016;
+            }
+            break;
+          case TLSv1_2_2018_HASH:
+            if (name == "TLSv1.2_2018")
+            {
+              return MinimumProtocolVersion::TLSv1_2_2018;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return MinimumProtocolVersion::NOT_SET;
         }
 
-        Aws::String GetNameForMinimumProtocolVersion(MinimumProtocolVersion enumValue)
+        const char* GetNameForMinimumProtocolVersion(MinimumProtocolVersion enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace OriginProtocolPolicyMapper
       {
 
-        static const int http_only_HASH = HashingUtils::HashString("http-only");
-        static const int match_viewer_HASH = HashingUtils::HashString("match-viewer");
-        static const int https_only_HASH = HashingUtils::HashString("https-only");
+        static constexpr int http_only_HASH = HashingUtils::CompileTimeHashString("http-only");
+        static constexpr int match_viewer_HASH = HashingUtils::CompileTimeHashString("match-viewer");
+        static constexpr int https_only_HASH = HashingUtils::CompileTimeHashString("https-only");
 
 
         OriginProtocolPolicy GetOriginProtocolPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == http_only_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OriginProtocolPolicy::http_only;
-          }
-          else if (hashCode == match_viewer_HASH)
-          {
-            return OriginProtocolPolicy::match_viewer;
-          }
-          else if (hashCode == https_only_HASH)
-          {
-            return OriginProtocolPolicy::https_only;
+          case http_only_HASH:
+            if (name == "http-only")
+            {
+              return OriginProtocolPolicy::http_only;
+            }
+            break;
+          case match_viewer_HASH:
+            if (name == "match-viewer")
+            {
+              return OriginProtocolPolicy::match_viewer;
+            }
+            break;
+          case https_only_HASH:
+            if (name == "https-only")
+            {
+              return OriginProtocolPolicy::https_only;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return OriginProtocolPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForOriginProtocolPolicy(OriginProtocolPolicy enumValue)
+        const char* GetNameForOriginProtocolPolicy(OriginProtocolPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
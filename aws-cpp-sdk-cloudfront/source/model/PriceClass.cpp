@@ -30,25 +30,37 @@ namespace Aws
       namespace PriceClassMapper
       {
 
-        static const int PriceClass_100_HASH = HashingUtils::HashString("PriceClass_100");
-        static const int PriceClass_200_HASH = HashingUtils::HashString("PriceClass_200");
-        static const int PriceClass_All_HASH = HashingUtils::HashString("PriceClass_All");
+        static constexpr int PriceClass_100_HASH = HashingUtils::CompileTimeHashString("PriceClass_100");
+        static constexpr int PriceClass_200_HASH = HashingUtils::CompileTimeHashString("PriceClass_200");
+        static constexpr int PriceClass_All_HASH = HashingUtils::CompileTimeHashString("PriceClass_All");
 
 
         PriceClass GetPriceClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PriceClass_100_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PriceClass::PriceClass_100;
-          }
-          else if (hashCode == PriceClass_200_HASH)
-          {
-            return PriceClass::PriceClass_200;
-          }
-          else if (hashCode == PriceClass_All_HASH)
-          {
-            return PriceClass::PriceClass_All;
+          case PriceClass_100_HASH:
+            if (name == "PriceClass_100")
+            {
+              return PriceClass::PriceClass_100;
+            }
+            break;
+          case PriceClass_200_HASH:
+            if (name == "PriceClass_200")
+            {
+              return PriceClass::PriceClass_200;
+            }
+            break;
+          case PriceClass_All_HASH:
+            if (name == "PriceClass_All")
+            {
+              return PriceClass::PriceClass_All;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PriceClass::NOT_SET;
         }
 
-        Aws::String GetNameForPriceClass(PriceClass enumValue)
+        const char* GetNameForPriceClass(PriceClass enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
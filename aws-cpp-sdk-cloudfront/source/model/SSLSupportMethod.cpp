@@ -30,20 +30,30 @@ namespace Aws
       namespace SSLSupportMethodMapper
       {
 
-        static const int sni_only_HASH = HashingUtils::HashString("sni-only");
-        static const int vip_HASH = HashingUtils::HashString("vip");
+        static constexpr int sni_only_HASH = HashingUtils::CompileTimeHashString("sni-only");
+        static constexpr int vip_HASH = HashingUtils::CompileTimeHashString("vip");
 
 
         SSLSupportMethod GetSSLSupportMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == sni_only_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SSLSupportMethod::sni_only;
-          }
-          else if (hashCode == vip_HASH)
-          {
-            return SSLSupportMethod::vip;
+          case sni_only_HASH:
+            if (name == "sni-only")
+            {
+              return SSLSupportMethod::sni_only;
+            }
+            break;
+          case vip_HASH:
+            if (name == "vip")
+            {
+              return SSLSupportMethod::vip;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SSLSupportMethod::NOT_SET;
         }
 
-        Aws::String GetNameForSSLSupportMethod(SSLSupportMethod enumValue)
+        const char* GetNameForSSLSupportMethod(SSLSupportMethod enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
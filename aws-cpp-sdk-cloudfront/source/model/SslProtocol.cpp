@@ -30,30 +30,44 @@ namespace Aws
       namespace SslProtocolMapper
       {
 
-        static const int SSLv3_HASH = HashingUtils::HashString("SSLv3");
-        static const int TLSv1_HASH = HashingUtils::HashString("TLSv1");
-        static const int TLSv1_1_HASH = HashingUtils::HashString("TLSv1.1");
-        static const int TLSv1_2_HASH = HashingUtils::HashString("TLSv1.2");
+        static constexpr int SSLv3_HASH = HashingUtils::CompileTimeHashString("SSLv3");
+        static constexpr int TLSv1_HASH = HashingUtils::CompileTimeHashString("TLSv1");
+        static constexpr int TLSv1_1_HASH = HashingUtils::CompileTimeHashString("TLSv1.1");
+        static constexpr int TLSv1_2_HASH = HashingUtils::CompileTimeHashString("TLSv1.2");
 
 
         SslProtocol GetSslProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSLv3_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SslProtocol::SSLv3;
-          }
-          else if (hashCode == TLSv1_HASH)
-          {
-            return SslProtocol::TLSv1;
-          }
-          else if (hashCode == TLSv1_1_HASH)
-          {
-            return SslProtocol::TLSv1_1;
-          }
-          else if (hashCode == TLSv1_2_HASH)
-          {
-            return SslProtocol::TLSv1_2;
+          case SSLv3_HASH:
+            if (name == "SSLv3")
+            {
+              return SslProtocol::SSLv3;
+            }
+            break;
+          case TLSv1_HASH:
+            if (name == "TLSv1")
+            {
+              return SslProtocol::TLSv1;
+            }
+            break;
+          case TLSv1_1_HASH:
+            if (name == "TLSv1.1")
+            {
+              return SslProtocol::TLSv1_1;
+            }
+            break;
+          case TLSv1_2_HASH:
+            if (name == "TLSv1.2")
+            {
+              return SslProtocol::TLSv1_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return SslProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForSslProtocol(SslProtocol enumValue)
+        const char* GetNameForSslProtocol(SslProtocol enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
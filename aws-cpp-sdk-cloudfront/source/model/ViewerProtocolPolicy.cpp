@@ -30,25 +30,37 @@ namespace Aws
       namespace ViewerProtocolPolicyMapper
       {
 
-        static const int allow_all_HASH = HashingUtils::HashString("allow-all");
-        static const int https_only_HASH = HashingUtils::HashString("https-only");
-        static const int redirect_to_https_HASH = HashingUtils::HashString("redirect-to-https");
+        static constexpr int allow_all_HASH = HashingUtils::CompileTimeHashString("allow-all");
+        static constexpr int https_only_HASH = HashingUtils::CompileTimeHashString("https-only");
+        static constexpr int redirect_to_https_HASH = HashingUtils::CompileTimeHashString("redirect-to-https");
 
 
         ViewerProtocolPolicy GetViewerProtocolPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == allow_all_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ViewerProtocolPolicy::allow_all;
-          }
-          else if (hashCode == https_only_HASH)
-          {
-            return ViewerProtocolPolicy::https_only;
-          }
-          else if (hashCode == redirect_to_https_HASH)
-          {
-            return ViewerProtocolPolicy::redirect_to_https;
+          case allow_all_HASH:
+            if (name == "allow-all")
+            {
+              return ViewerProtocolPolicy::allow_all;
+            }
+            break;
+          case https_only_HASH:
+            if (name == "https-only")
+            {
+              return ViewerProtocolPolicy::https_only;
+            }
+            break;
+          case redirect_to_https_HASH:
+            if (name == "redirect-to-https")
+            {
+              return ViewerProtocolPolicy::redirect_to_https;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ViewerProtocolPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForViewerProtocolPolicy(ViewerProtocolPolicy enumValue)
+        const char* GetNameForViewerProtocolPolicy(ViewerProtocolPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace ClientVersionMapper
 {
 AWS_CLOUDHSM_API ClientVersion GetClientVersionForName(const Aws::String& name);
 
-AWS_CLOUDHSM_API Aws::String GetNameForClientVersion(ClientVersion value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDHSM_API const char* GetNameForClientVersion(ClientVersion value);
 } // namespace ClientVersionMapper
 } // namespace Model
 } // namespace CloudHSM
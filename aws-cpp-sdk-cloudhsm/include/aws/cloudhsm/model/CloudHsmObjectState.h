@@ -35,7 +35,8 @@ namespace CloudHsmObjectStateMapper
 {
 AWS_CLOUDHSM_API CloudHsmObjectState GetCloudHsmObjectStateForName(const Aws::String& name);
 
-AWS_CLOUDHSM_API Aws::String GetNameForCloudHsmObjectState(CloudHsmObjectState value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDHSM_API const char* GetNameForCloudHsmObjectState(CloudHsmObjectState value);
 } // namespace CloudHsmObjectStateMapper
 } // namespace Model
 } // namespace CloudHSM
@@ -39,7 +39,8 @@ namespace HsmStatusMapper
 {
 AWS_CLOUDHSM_API HsmStatus GetHsmStatusForName(const Aws::String& name);
 
-AWS_CLOUDHSM_API Aws::String GetNameForHsmStatus(HsmStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDHSM_API const char* GetNameForHsmStatus(HsmStatus value);
 } // namespace HsmStatusMapper
 } // namespace Model
 } // namespace CloudHSM
@@ -33,7 +33,8 @@ namespace SubscriptionTypeMapper
 {
 AWS_CLOUDHSM_API SubscriptionType GetSubscriptionTypeForName(const Aws::String& name);
 
-AWS_CLOUDHSM_API Aws::String GetNameForSubscriptionType(SubscriptionType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDHSM_API const char* GetNameForSubscriptionType(SubscriptionType value);
 } // namespace SubscriptionTypeMapper
 } // namespace Model
 } // namespace CloudHSM
@@ -28,9 +28,9 @@ namespace CloudHSM
 namespace CloudHSMErrorMapper
 {
 
-static const int CLOUD_HSM_SERVICE_HASH = HashingUtils::HashString("CloudHsmServiceException");
-static const int CLOUD_HSM_INTERNAL_HASH = HashingUtils::HashString("CloudHsmInternalException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
+static constexpr int CLOUD_HSM_SERVICE_HASH = HashingUtils::CompileTimeHashString("CloudHsmServiceException");
+static constexpr int CLOUD_HSM_INTERNAL_HASH = HashingUtils::CompileTimeHashString("CloudHsmInternalException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
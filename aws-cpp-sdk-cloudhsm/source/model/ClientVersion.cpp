@@ -30,20 +30,30 @@ namespace Aws
       namespace ClientVersionMapper
       {
 
-        static const int _5_1_HASH = HashingUtils::HashString("5.1");
-        static const int _5_3_HASH = HashingUtils::HashString("5.3");
+        static constexpr int _5_1_HASH = HashingUtils::CompileTimeHashString("5.1");
+        static constexpr int _5_3_HASH = HashingUtils::CompileTimeHashString("5.3");
 
 
         ClientVersion GetClientVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == _5_1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ClientVersion::_5_1;
-          }
-          else if (hashCode == _5_3_HASH)
-          {
-            return ClientVersion::_5_3;
+          case _5_1_HASH:
+            if (name == "5.1")
+            {
+              return ClientVersion::_5_1;
+            }
+            break;
+          case _5_3_HASH:
+            if (name == "5.3")
+            {
+              return ClientVersion::_5_3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ClientVersion::NOT_SET;
         }
 
-        Aws::String GetNameForClientVersion(ClientVersion enumValue)
+        const char* GetNameForClientVersion(ClientVersion enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
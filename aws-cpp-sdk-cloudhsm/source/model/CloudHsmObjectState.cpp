@@ -30,25 +30,37 @@ namespace Aws
       namespace CloudHsmObjectStateMapper
       {
 
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
+        static constexpr int READY_HASH = HashingUtils::CompileTimeHashString("READY");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
+        static constexpr int DEGRADED_HASH = HashingUtils::CompileTimeHashString("DEGRADED");
 
 
         CloudHsmObjectState GetCloudHsmObjectStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CloudHsmObjectState::READY;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return CloudHsmObjectState::UPDATING;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
-            return CloudHsmObjectState::DEGRADED;
+          case READY_HASH:
+            if (name == "READY")
+            {
+              return CloudHsmObjectState::READY;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return CloudHsmObjectState::UPDATING;
+            }
+            break;
+          case DEGRADED_HASH:
+            if (name == "DEGRADED")
+            {
+              return CloudHsmObjectState::DEGRADED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return CloudHsmObjectState::NOT_SET;
         }
 
-        Aws::String GetNameForCloudHsmObjectState(CloudHsmObjectState enumValue)
+        const char* GetNameForCloudHsmObjectState(CloudHsmObjectState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
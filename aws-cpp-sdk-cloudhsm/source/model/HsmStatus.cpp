@@ -30,45 +30,65 @@ namespace Aws
       namespace HsmStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
+        static constexpr int SUSPENDED_HASH = HashingUtils::CompileTimeHashString("SUSPENDED");
+        static constexpr int TERMINATING_HASH = HashingUtils::CompileTimeHashString("TERMINATING");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
+        static constexpr int DEGRADED_HASH = HashingUtils::CompileTimeHashString("DEGRADED");
 
 
         HsmStatus GetHsmStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HsmStatus::PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return HsmStatus::RUNNING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return HsmStatus::UPDATING;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
-            return HsmStatus::SUSPENDED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return HsmStatus::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return HsmStatus::TERMINATED;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
-            return HsmStatus::DEGRADED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return HsmStatus::PENDING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return HsmStatus::RUNNING;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return HsmStatus::UPDATING;
+            }
+            break;
+          case SUSPENDED_HASH:
+            if (name == "SUSPENDED")
+            {
+              return HsmStatus::SUSPENDED;
+            }
+            break;
+          case TERMINATING_HASH:
+            if (name == "TERMINATING")
+            {
+              return HsmStatus::TERMINATING;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return HsmStatus::TERMINATED;
+            }
+            break;
+          case DEGRADED_HASH:
+            if (name == "DEGRADED")
+            {
+              return HsmStatus::DEGRADED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return HsmStatus::NOT_SET;
         }
 
-        Aws::String GetNameForHsmStatus(HsmStatus enumValue)
+        const char* GetNameForHsmStatus(HsmStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
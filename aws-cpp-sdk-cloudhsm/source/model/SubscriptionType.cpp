@@ -30,15 +30,23 @@ namespace Aws
       namespace SubscriptionTypeMapper
       {
 
-        static const int PRODUCTION_HASH = HashingUtils::HashString("PRODUCTION");
+        static constexpr int PRODUCTION_HASH = HashingUtils::CompileTimeHashString("PRODUCTION");
 
 
         SubscriptionType GetSubscriptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRODUCTION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SubscriptionType::PRODUCTION;
+          case PRODUCTION_HASH:
+            if (name == "PRODUCTION")
+            {
+              return SubscriptionType::PRODUCTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return SubscriptionType::NOT_SET;
         }
 
-        Aws::String GetNameForSubscriptionType(SubscriptionType enumValue)
+        const char* GetNameForSubscriptionType(SubscriptionType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -33,7 +33,8 @@ namespace BackupPolicyMapper
 {
 AWS_CLOUDHSMV2_API BackupPolicy GetBackupPolicyForName(const Aws::String& name);
 
-AWS_CLOUDHSMV2_API Aws::String GetNameForBackupPolicy(BackupPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDHSMV2_API const char* GetNameForBackupPolicy(BackupPolicy value);
 } // namespace BackupPolicyMapper
 } // namespace Model
 } // namespace CloudHSMV2
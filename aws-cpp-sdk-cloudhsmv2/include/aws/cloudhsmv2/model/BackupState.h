@@ -35,7 +35,8 @@ namespace BackupStateMapper
 {
 AWS_CLOUDHSMV2_API BackupState GetBackupStateForName(const Aws::String& name);
 
-AWS_CLOUDHSMV2_API Aws::String GetNameForBackupState(BackupState value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDHSMV2_API const char* GetNameForBackupState(BackupState value);
 } // namespace BackupStateMapper
 } // namespace Model
 } // namespace CloudHSMV2
@@ -41,7 +41,8 @@ namespace ClusterStateMapper
 {
 AWS_CLOUDHSMV2_API ClusterState GetClusterStateForName(const Aws::String& name);
 
-AWS_CLOUDHSMV2_API Aws::String GetNameForClusterState(ClusterState value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDHSMV2_API const char* GetNameForClusterState(ClusterState value);
 } // namespace ClusterStateMapper
 } // namespace Model
 } // namespace CloudHSMV2
@@ -37,7 +37,8 @@ namespace HsmStateMapper
 {
 AWS_CLOUDHSMV2_API HsmState GetHsmStateForName(const Aws::String& name);
 
-AWS_CLOUDHSMV2_API Aws::String GetNameForHsmState(HsmState value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDHSMV2_API const char* GetNameForHsmState(HsmState value);
 } // namespace HsmStateMapper
 } // namespace Model
 } // namespace CloudHSMV2
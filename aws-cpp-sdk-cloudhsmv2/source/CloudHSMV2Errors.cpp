@@ -28,11 +28,11 @@ namespace CloudHSMV2
 namespace CloudHSMV2ErrorMapper
 {
 
-static const int CLOUD_HSM_INTERNAL_FAILURE_HASH = HashingUtils::HashString("CloudHsmInternalFailureException");
-static const int CLOUD_HSM_SERVICE_HASH = HashingUtils::HashString("CloudHsmServiceException");
-static const int CLOUD_HSM_ACCESS_DENIED_HASH = HashingUtils::HashString("CloudHsmAccessDeniedException");
-static const int CLOUD_HSM_INVALID_REQUEST_HASH = HashingUtils::HashString("CloudHsmInvalidRequestException");
-static const int CLOUD_HSM_RESOURCE_NOT_FOUND_HASH = HashingUtils::HashString("CloudHsmResourceNotFoundException");
+static constexpr int CLOUD_HSM_INTERNAL_FAILURE_HASH = HashingUtils::CompileTimeHashString("CloudHsmInternalFailureException");
+static constexpr int CLOUD_HSM_SERVICE_HASH = HashingUtils::CompileTimeHashString("CloudHsmServiceException");
+static constexpr int CLOUD_HSM_ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("CloudHsmAccessDeniedException");
+static constexpr int CLOUD_HSM_INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("CloudHsmInvalidRequestException");
+static constexpr int CLOUD_HSM_RESOURCE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("CloudHsmResourceNotFoundException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,15 +30,23 @@ namespace Aws
       namespace BackupPolicyMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
+        static constexpr int DEFAULT_HASH = HashingUtils::CompileTimeHashString("DEFAULT");
 
 
         BackupPolicy GetBackupPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BackupPolicy::DEFAULT;
+          case DEFAULT_HASH:
+            if (name == "DEFAULT")
+            {
+              return BackupPolicy::DEFAULT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return BackupPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForBackupPolicy(BackupPolicy enumValue)
+        const char* GetNameForBackupPolicy(BackupPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
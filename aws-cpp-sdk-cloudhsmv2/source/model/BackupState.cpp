@@ -30,25 +30,37 @@ namespace Aws
       namespace BackupStateMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int CREATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATE_IN_PROGRESS");
+        static constexpr int READY_HASH = HashingUtils::CompileTimeHashString("READY");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         BackupState GetBackupStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BackupState::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return BackupState::READY;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return BackupState::DELETED;
+          case CREATE_IN_PROGRESS_HASH:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return BackupState::CREATE_IN_PROGRESS;
+            }
+            break;
+          case READY_HASH:
+            if (name == "READY")
+            {
+              return BackupState::READY;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return BackupState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return BackupState::NOT_SET;
         }
 
-        Aws::String GetNameForBackupState(BackupState enumValue)
+        const char* GetNameForBackupState(BackupState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,55 +30,79 @@ namespace Aws
       namespace ClusterStateMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int UNINITIALIZED_HASH = HashingUtils::HashString("UNINITIALIZED");
-        static const int INITIALIZE_IN_PROGRESS_HASH = HashingUtils::HashString("INITIALIZE_IN_PROGRESS");
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
+        static constexpr int CREATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATE_IN_PROGRESS");
+        static constexpr int UNINITIALIZED_HASH = HashingUtils::CompileTimeHashString("UNINITIALIZED");
+        static constexpr int INITIALIZE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("INITIALIZE_IN_PROGRESS");
+        static constexpr int INITIALIZED_HASH = HashingUtils::CompileTimeHashString("INITIALIZED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int UPDATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("UPDATE_IN_PROGRESS");
+        static constexpr int DELETE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("DELETE_IN_PROGRESS");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
+        static constexpr int DEGRADED_HASH = HashingUtils::CompileTimeHashString("DEGRADED");
 
 
         ClusterState GetClusterStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ClusterState::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == UNINITIALIZED_HASH)
-          {
-            return ClusterState::UNINITIALIZED;
-          }
-          else if (hashCode == INITIALIZE_IN_PROGRESS_HASH)
-          {
-            return ClusterState::INITIALIZE_IN_PROGRESS;
-          }
-          else if (hashCode == INITIALIZED_HASH)
-          {
-            return ClusterState::INITIALIZED;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return ClusterState::ACTIVE;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
-          {
-            return ClusterState::UPDATE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return ClusterState::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ClusterState::DELETED;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
-            return ClusterState::DEGRADED;
+          case CREATE_IN_PROGRESS_HASH:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return ClusterState::CREATE_IN_PROGRESS;
+            }
+            break;
+          case UNINITIALIZED_HASH:
+            if (name == "UNINITIALIZED")
+            {
+              return ClusterState::UNINITIALIZED;
+            }
+            break;
+          case INITIALIZE_IN_PROGRESS_HASH:
+            if (name == "INITIALIZE_IN_PROGRESS")
+            {
+              return ClusterState::INITIALIZE_IN_PROGRESS;
+            }
+            break;
+          case INITIALIZED_HASH:
+            if (name == "INITIALIZED")
+            {
+              return ClusterState::INITIALIZED;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ClusterState::ACTIVE;
+            }
+            break;
+          case UPDATE_IN_PROGRESS_HASH:
+            if (name == "UPDATE_IN_PROGRESS")
+            {
+              return ClusterState::UPDATE_IN_PROGRESS;
+            }
+            break;
+          case DELETE_IN_PROGRESS_HASH:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return ClusterState::DELETE_IN_PROGRESS;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return ClusterState::DELETED;
+            }
+            break;
+          case DEGRADED_HASH:
+            if (name == "DEGRADED")
+            {
+              return ClusterState::DEGRADED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return ClusterState::NOT_SET;
         }
 
-        Aws::String GetNameForClusterState(ClusterState enumValue)
+        const char* GetNameForClusterState(ClusterState enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace HsmStateMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DEGRADED_HASH = HashingUtils::HashString("DEGRADED");
-        static const int DELETE_IN_PROGRESS_HASH = HashingUtils::HashString("DELETE_IN_PROGRESS");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int CREATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATE_IN_PROGRESS");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DEGRADED_HASH = HashingUtils::CompileTimeHashString("DEGRADED");
+        static constexpr int DELETE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("DELETE_IN_PROGRESS");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         HsmState GetHsmStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HsmState::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return HsmState::ACTIVE;
-          }
-          else if (hashCode == DEGRADED_HASH)
-          {
-            return HsmState::DEGRADED;
-          }
-          else if (hashCode == DELETE_IN_PROGRESS_HASH)
-          {
-            return HsmState::DELETE_IN_PROGRESS;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return HsmState::DELETED;
+          case CREATE_IN_PROGRESS_HASH:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return HsmState::CREATE_IN_PROGRESS;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return HsmState::ACTIVE;
+            }
+            break;
+          case DEGRADED_HASH:
+            if (name == "DEGRADED")
+            {
+              return HsmState::DEGRADED;
+            }
+            break;
+          case DELETE_IN_PROGRESS_HASH:
+            if (name == "DELETE_IN_PROGRESS")
+            {
+              return HsmState::DELETE_IN_PROGRESS;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return HsmState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return HsmState::NOT_SET;
         }
 
-        Aws::String GetNameForHsmState(HsmState enumValue)
+        const char* GetNameForHsmState(HsmState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
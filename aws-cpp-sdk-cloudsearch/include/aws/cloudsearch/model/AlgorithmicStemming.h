@@ -36,7 +36,8 @@ namespace AlgorithmicStemmingMapper
 {
 AWS_CLOUDSEARCH_API AlgorithmicStemming GetAlgorithmicStemmingForName(const Aws::String& name);
 
-AWS_CLOUDSEARCH_API Aws::String GetNameForAlgorithmicStemming(AlgorithmicStemming value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDSEARCH_API const char* GetNameForAlgorithmicStemming(AlgorithmicStemming value);
 } // namespace AlgorithmicStemmingMapper
 } // namespace Model
 } // namespace CloudSearch
@@ -67,7 +67,8 @@ namespace AnalysisSchemeLanguageMapper
 {
 AWS_CLOUDSEARCH_API AnalysisSchemeLanguage GetAnalysisSchemeLanguageForName(const Aws::String& name);
 
-AWS_CLOUDSEARCH_API Aws::String GetNameForAnalysisSchemeLanguage(AnalysisSchemeLanguage value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDSEARCH_API const char* GetNameForAnalysisSchemeLanguage(AnalysisSchemeLanguage value);
 } // namespace AnalysisSchemeLanguageMapper
 } // namespace Model
 } // namespace CloudSearch
@@ -43,7 +43,8 @@ namespace IndexFieldTypeMapper
 {
 AWS_CLOUDSEARCH_API IndexFieldType GetIndexFieldTypeForName(const Aws::String& name);
 
-AWS_CLOUDSEARCH_API Aws::String GetNameForIndexFieldType(IndexFieldType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDSEARCH_API const char* GetNameForIndexFieldType(IndexFieldType value);
 } // namespace IndexFieldTypeMapper
 } // namespace Model
 } // namespace CloudSearch
@@ -36,7 +36,8 @@ namespace OptionStateMapper
 {
 AWS_CLOUDSEARCH_API OptionState GetOptionStateForName(const Aws::String& name);
 
-AWS_CLOUDSEARCH_API Aws::String GetNameForOptionState(OptionState value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDSEARCH_API const char* GetNameForOptionState(OptionState value);
 } // namespace OptionStateMapper
 } // namespace Model
 } // namespace CloudSearch
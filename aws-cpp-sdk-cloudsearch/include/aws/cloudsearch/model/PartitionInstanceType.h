@@ -40,7 +40,8 @@ namespace PartitionInstanceTypeMapper
 {
 AWS_CLOUDSEARCH_API PartitionInstanceType GetPartitionInstanceTypeForName(const Aws::String& name);
 
-AWS_CLOUDSEARCH_API Aws::String GetNameForPartitionInstanceType(PartitionInstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDSEARCH_API const char* GetNameForPartitionInstanceType(PartitionInstanceType value);
 } // namespace PartitionInstanceTypeMapper
 } // namespace Model
 } // namespace CloudSearch
@@ -35,7 +35,8 @@ namespace SuggesterFuzzyMatchingMapper
 {
 AWS_CLOUDSEARCH_API SuggesterFuzzyMatching GetSuggesterFuzzyMatchingForName(const Aws::String& name);
 
-AWS_CLOUDSEARCH_API Aws::String GetNameForSuggesterFuzzyMatching(SuggesterFuzzyMatching value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDSEARCH_API const char* GetNameForSuggesterFuzzyMatching(SuggesterFuzzyMatching value);
 } // namespace SuggesterFuzzyMatchingMapper
 } // namespace Model
 } // namespace CloudSearch
@@ -28,11 +28,11 @@ namespace CloudSearch
 namespace CloudSearchErrorMapper
 {
 
-static const int BASE_HASH = HashingUtils::HashString("BaseException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceeded");
-static const int INTERNAL_HASH = HashingUtils::HashString("InternalException");
-static const int INVALID_TYPE_HASH = HashingUtils::HashString("InvalidType");
-static const int DISABLED_OPERATION_HASH = HashingUtils::HashString("DisabledAction");
+static constexpr int BASE_HASH = HashingUtils::CompileTimeHashString("BaseException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceeded");
+static constexpr int INTERNAL_HASH = HashingUtils::CompileTimeHashString("InternalException");
+static constexpr int INVALID_TYPE_HASH = HashingUtils::CompileTimeHashString("InvalidType");
+static constexpr int DISABLED_OPERATION_HASH = HashingUtils::CompileTimeHashString("DisabledAction");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,30 +30,44 @@ namespace Aws
       namespace AlgorithmicStemmingMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int minimal_HASH = HashingUtils::HashString("minimal");
-        static const int light_HASH = HashingUtils::HashString("light");
-        static const int full_HASH = HashingUtils::HashString("full");
+        static constexpr int none_HASH = HashingUtils::CompileTimeHashString("none");
+        static constexpr int minimal_HASH = HashingUtils::CompileTimeHashString("minimal");
+        static constexpr int light_HASH = HashingUtils::CompileTimeHashString("light");
+        static constexpr int full_HASH = HashingUtils::CompileTimeHashString("full");
 
 
         AlgorithmicStemming GetAlgorithmicStemmingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AlgorithmicStemming::none;
-          }
-          else if (hashCode == minimal_HASH)
-          {
-            return AlgorithmicStemming::minimal;
-          }
-          else if (hashCode == light_HASH)
-          {
-            return AlgorithmicStemming::light;
-          }
-          else if (hashCode == full_HASH)
-          {
-            return AlgorithmicStemming::full;
+          case none_HASH:
+            if (name == "none")
+            {
+              return AlgorithmicStemming::none;
+            }
+            break;
+          case minimal_HASH:
+            if (name == "minimal")
+            {
+              return AlgorithmicStemming::minimal;
+            }
+            break;
+          case light_HASH:
+            if (name == "light")
+            {
+              return AlgorithmicStemming::light;
+            }
+            break;
+          case full_HASH:
+            if (name == "full")
+            {
+              return AlgorithmicStemming::full;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AlgorithmicStemming::NOT_SET;
         }
 
-        Aws::String GetNameForAlgorithmicStemming(AlgorithmicStemming enumValue)
+        const char* GetNameForAlgorithmicStemming(AlgorithmicStemming enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
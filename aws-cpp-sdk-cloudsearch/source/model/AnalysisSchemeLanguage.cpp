@@ -30,185 +30,261 @@ namespace Aws
       namespace AnalysisSchemeLanguageMapper
       {
 
-        static const int ar_HASH = HashingUtils::HashString("ar");
-        static const int bg_HASH = HashingUtils::HashString("bg");
-        static const int ca_HASH = HashingUtils::HashString("ca");
-        static const int cs_HASH = HashingUtils::HashString("cs");
-        static const int da_HASH = HashingUtils::HashString("da");
-        static const int de_HASH = HashingUtils::HashString("de");
-        static const int el_HASH = HashingUtils::HashString("el");
-        static const int en_HASH = HashingUtils::HashString("en");
-        static const int es_HASH = HashingUtils::HashString("es");
-        static const int eu_HASH = HashingUtils::HashString("eu");
-        static const int fa_HASH = HashingUtils::HashString("fa");
-        static const int fi_HASH = HashingUtils::HashString("fi");
-        static const int fr_HASH = HashingUtils::HashString("fr");
-        static const int ga_HASH = HashingUtils::HashString("ga");
-        static const int gl_HASH = HashingUtils::HashString("gl");
-        static const int he_HASH = HashingUtils::HashString("he");
-        static const int hi_HASH = HashingUtils::HashString("hi");
-        static const int hu_HASH = HashingUtils::HashString("hu");
-        static const int hy_HASH = HashingUtils::HashString("hy");
-        static const int id_HASH = HashingUtils::HashString("id");
-        static const int it_HASH = HashingUtils::HashString("it");
-        static const int ja_HASH = HashingUtils::HashString("ja");
-        static const int ko_HASH = HashingUtils::HashString("ko");
-        static const int lv_HASH = HashingUtils::HashString("lv");
-        static const int mul_HASH = HashingUtils::HashString("mul");
-        static const int nl_HASH = HashingUtils::HashString("nl");
-        static const int no_HASH = HashingUtils::HashString("no");
-        static const int pt_HASH = HashingUtils::HashString("pt");
-        static const int ro_HASH = HashingUtils::HashString("ro");
-        static const int ru_HASH = HashingUtils::HashString("ru");
-        static const int sv_HASH = HashingUtils::HashString("sv");
-        static const int th_HASH = HashingUtils::HashString("th");
-        static const int tr_HASH = HashingUtils::HashString("tr");
-        static const int zh_Hans_HASH = HashingUtils::HashString("zh-Hans");
-        static const int zh_Hant_HASH = HashingUtils::HashString("zh-Hant");
+        static constexpr int ar_HASH = HashingUtils::CompileTimeHashString("ar");
+        static constexpr int bg_HASH = HashingUtils::CompileTimeHashString("bg");
+        static constexpr int ca_HASH = HashingUtils::CompileTimeHashString("ca");
+        static constexpr int cs_HASH = HashingUtils::CompileTimeHashString("cs");
+        static constexpr int da_HASH = HashingUtils::CompileTimeHashString("da");
+        static constexpr int de_HASH = HashingUtils::CompileTimeHashString("de");
+        static constexpr int el_HASH = HashingUtils::CompileTimeHashString("el");
+        static constexpr int en_HASH = HashingUtils::CompileTimeHashString("en");
+        static constexpr int es_HASH = HashingUtils::CompileTimeHashString("es");
+        static constexpr int eu_HASH = HashingUtils::CompileTimeHashString("eu");
+        static constexpr int fa_HASH = HashingUtils::CompileTimeHashString("fa");
+        static constexpr int fi_HASH = HashingUtils::CompileTimeHashString("fi");
+        static constexpr int fr_HASH = HashingUtils::CompileTimeHashString("fr");
+        static constexpr int ga_HASH = HashingUtils::CompileTimeHashString("ga");
+        static constexpr int gl_HASH = HashingUtils::CompileTimeHashString("gl");
+        static constexpr int he_HASH = HashingUtils::CompileTimeHashString("he");
+        static constexpr int hi_HASH = HashingUtils::CompileTimeHashString("hi");
+        static constexpr int hu_HASH = HashingUtils::CompileTimeHashString("hu");
+        static constexpr int hy_HASH = HashingUtils::CompileTimeHashString("hy");
+        static constexpr int id_HASH = HashingUtils::CompileTimeHashString("id");
+        static constexpr int it_HASH = HashingUtils::CompileTimeHashString("it");
+        static constexpr int ja_HASH = HashingUtils::CompileTimeHashString("ja");
+        static constexpr int ko_HASH = HashingUtils::CompileTimeHashString("ko");
+        static constexpr int lv_HASH = HashingUtils::CompileTimeHashString("lv");
+        static constexpr int mul_HASH = HashingUtils::CompileTimeHashString("mul");
+        static constexpr int nl_HASH = HashingUtils::CompileTimeHashString("nl");
+        static constexpr int no_HASH = HashingUtils::CompileTimeHashString("no");
+        static constexpr int pt_HASH = HashingUtils::CompileTimeHashString("pt");
+        static constexpr int ro_HASH = HashingUtils::CompileTimeHashString("ro");
+        static constexpr int ru_HASH = HashingUtils::CompileTimeHashString("ru");
+        static constexpr int sv_HASH = HashingUtils::CompileTimeHashString("sv");
+        static constexpr int th_HASH = HashingUtils::CompileTimeHashString("th");
+        static constexpr int tr_HASH = HashingUtils::CompileTimeHashString("tr");
+        static constexpr int zh_Hans_HASH = HashingUtils::CompileTimeHashString("zh-Hans");
+        static constexpr int zh_Hant_HASH = HashingUtils::CompileTimeHashString("zh-Hant");
 
 
         AnalysisSchemeLanguage GetAnalysisSchemeLanguageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ar_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AnalysisSchemeLanguage::ar;
-          }
-          else if (hashCode == bg_HASH)
-          {
-            return AnalysisSchemeLanguage::bg;
-          }
-          else if (hashCode == ca_HASH)
-          {
-            return AnalysisSchemeLanguage::ca;
-          }
-          else if (hashCode == cs_HASH)
-          {
-            return AnalysisSchemeLanguage::cs;
-          }
-          else if (hashCode == da_HASH)
-          {
-            return AnalysisSchemeLanguage::da;
-          }
-          else if (hashCode == de_HASH)
-          {
-            return AnalysisSchemeLanguage::de;
-          }
-          else if (hashCode == el_HASH)
-          {
-            return AnalysisSchemeLanguage::el;
-          }
-          else if (hashCode == en_HASH)
-          {
-            return AnalysisSchemeLanguage::en;
-          }
-          else if (hashCode == es_HASH)
-          {
-            return AnalysisSchemeLanguage::es;
-          }
-          else if (hashCode == eu_HASH)
-          {
-            return AnalysisSchemeLanguage::eu;
-          }
-          else if (hashCode == fa_HASH)
-          {
-            return AnalysisSchemeLanguage::fa;
-          }
-          else if (hashCode == fi_HASH)
-          {
-            return AnalysisSchemeLanguage::fi;
-          }
-          else if (hashCode == fr_HASH)
-          {
-            return AnalysisSchemeLanguage::fr;
-          }
-          else if (hashCode == ga_HASH)
-          {
-            return AnalysisSchemeLanguage::ga;
-          }
-          else if (hashCode == gl_HASH)
-          {
-            return AnalysisSchemeLanguage::gl;
-          }
-          else if (hashCode == he_HASH)
-          {
-            return AnalysisSchemeLanguage::he;
-          }
-          else if (hashCode == hi_HASH)
-          {
-            return AnalysisSchemeLanguage::hi;
-          }
-          else if (hashCode == hu_HASH)
-          {
-            return AnalysisSchemeLanguage::hu;
-          }
-          else if (hashCode == hy_HASH)
-          {
-            return AnalysisSchemeLanguage::hy;
-          }
-          else if (hashCode == id_HASH)
-          {
-            return AnalysisSchemeLanguage::id;
-          }
-          else if (hashCode == it_HASH)
-          {
-            return AnalysisSchemeLanguage::it;
-          }
-          else if (hashCode == ja_HASH)
-          {
-            return AnalysisSchemeLanguage::ja;
-          }
-          else if (hashCode == ko_HASH)
-          {
-            return AnalysisSchemeLanguage::ko;
-          }
-          else if (hashCode == lv_HASH)
-          {
-            return AnalysisSchemeLanguage::lv;
-          }
-          else if (hashCode == mul_HASH)
-          {
-            return AnalysisSchemeLanguage::mul;
-          }
-          else if (hashCode == nl_HASH)
-          {
-            return AnalysisSchemeLanguage::nl;
-          }
-          else if (hashCode == no_HASH)
-          {
-            return AnalysisSchemeLanguage::no;
-          }
-          else if (hashCode == pt_HASH)
-          {
-            return AnalysisSchemeLanguage::pt;
-          }
-          else if (hashCode == ro_HASH)
-          {
-            return AnalysisSchemeLanguage::ro;
-          }
-          else if (hashCode == ru_HASH)
-          {
-            return AnalysisSchemeLanguage::ru;
-          }
-          else if (hashCode == sv_HASH)
-          {
-            return AnalysisSchemeLanguage::sv;
-          }
-          else if (hashCode == th_HASH)
-          {
-            return AnalysisSchemeLanguage::th;
-          }
-          else if (hashCode == tr_HASH)
-          {
-            return AnalysisSchemeLanguage::tr;
-          }
-          else if (hashCode == zh_Hans_HASH)
-          {
-            return AnalysisSchemeLanguage::zh_Hans;
-          }
-          else if (hashCode == zh_Hant_HASH)
-          {
-            return AnalysisSchemeLanguage::zh_Hant;
+          case ar_HASH:
+            if (name == "ar")
+            {
+              return AnalysisSchemeLanguage::ar;
+            }
+            break;
+          case bg_HASH:
+            if (name == "bg")
+            {
+              return AnalysisSchemeLanguage::bg;
+            }
+            break;
+          case ca_HASH:
+            if (name == "ca")
+            {
+              return AnalysisSchemeLanguage::ca;
+            }
+            break;
+          case cs_HASH:
+            if (name == "cs")
+            {
+              return AnalysisSchemeLanguage::cs;
+            }
+            break;
+          case da_HASH:
+            if (name == "da")
+            {
+              return AnalysisSchemeLanguage::da;
+            }
+            break;
+          case de_HASH:
+            if (name == "de")
+            {
+              return AnalysisSchemeLanguage::de;
+            }
+            break;
+          case el_HASH:
+            if (name == "el")
+            {
+              return AnalysisSchemeLanguage::el;
+            }
+            break;
+          case en_HASH:
+            if (name == "en")
+            {
+              return AnalysisSchemeLanguage::en;
+            }
+            break;
+          case es_HASH:
+            if (name == "es")
+            {
+              return AnalysisSchemeLanguage::es;
+            }
+            break;
+          case eu_HASH:
+            if (name == "eu")
+            {
+              return AnalysisSchemeLanguage::eu;
+            }
+            break;
+          case fa_HASH:
+            if (name == "fa")
+            {
+              return AnalysisSchemeLanguage::fa;
+            }
+            break;
+          case fi_HASH:
+            if (name == "fi")
+            {
+              return AnalysisSchemeLanguage::fi;
+            }
+            break;
+          case fr_HASH:
+            if (name == "fr")
+            {
+              return AnalysisSchemeLanguage::fr;
+            }
+            break;
+          case ga_HASH:
+            if (name == "ga")
+            {
+              return AnalysisSchemeLanguage::ga;
+            }
+            break;
+          case gl_HASH:
+            if (name == "gl")
+            {
+              return AnalysisSchemeLanguage::gl;
+            }
+            break;
+          case he_HASH:
+            if (name == "he")
+            {
+              return AnalysisSchemeLanguage::he;
+            }
+            break;
+          case hi_HASH:
+            if (name == "hi")
+            {
+              return AnalysisSchemeLanguage::hi;
+            }
+            break;
+          case hu_HASH:
+            if (name == "hu")
+            {
+              return AnalysisSchemeLanguage::hu;
+            }
+            break;
+          case hy_HASH:
+            if (name == "hy")
+            {
+              return AnalysisSchemeLanguage::hy;
+            }
+            break;
+          case id_HASH:
+            if (name == "id")
+            {
+              return AnalysisSchemeLanguage::id;
+            }
+            break;
+          case it_HASH:
+            if (name == "it")
+            {
+              return AnalysisSchemeLanguage::it;
+            }
+            break;
+          case ja_HASH:
+            if (name == "ja")
+            {
+              return AnalysisSchemeLanguage::ja;
+            }
+            break;
+          case ko_HASH:
+            if (name == "ko")
+            {
+              return AnalysisSchemeLanguage::ko;
+            }
+            break;
+          case lv_HASH:
+            if (name == "lv")
+            {
+              return AnalysisSchemeLanguage::lv;
+            }
+            break;
+          case mul_HASH:
+            if (name == "mul")
+            {
+              return AnalysisSchemeLanguage::mul;
+            }
+            break;
+          case nl_HASH:
+            if (name == "nl")
+            {
+              return AnalysisSchemeLanguage::nl;
+            }
+            break;
+          case no_HASH:
+            if (name == "no")
+            {
+              return AnalysisSchemeLanguage::no;
+            }
+            break;
+          case pt_HASH:
+            if (name == "pt")
+            {
+              return AnalysisSchemeLanguage::pt;
+            }
+            break;
+          case ro_HASH:
+            if (name == "ro")
+            {
+              return AnalysisSchemeLanguage::ro;
+            }
+            break;
+          case ru_HASH:
+            if (name == "ru")
+            {
+              return AnalysisSchemeLanguage::ru;
+            }
+            break;
+          case sv_HASH:
+            if (name == "sv")
+            {
+              return AnalysisSchemeLanguage::sv;
+            }
+            break;
+          case th_HASH:
+            if (name == "th")
+            {
+              return AnalysisSchemeLanguage::th;
+            }
+            break;
+          case tr_HASH:
+            if (name == "tr")
+            {
+              return AnalysisSchemeLanguage::tr;
+            }
+            break;
+          case zh_Hans_HASH:
+            if (name == "zh-Hans")
+            {
+              return AnalysisSchemeLanguage::zh_Hans;
+            }
+            break;
+          case zh_Hant_HASH:
+            if (name == "zh-Hant")
+            {
+              return AnalysisSchemeLanguage::zh_Hant;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -220,7 +296,7 @@ namespace Aws
           return AnalysisSchemeLanguage::NOT_SET;
         }
 
-        Aws::String GetNameForAnalysisSchemeLanguage(AnalysisSchemeLanguage enumValue)
+        const char* GetNameForAnalysisSchemeLanguage(AnalysisSchemeLanguage enumValue)
         {
           switch(enumValue)
           {
@@ -298,7 +374,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,65 +30,93 @@ namespace Aws
       namespace IndexFieldTypeMapper
       {
 
-        static const int int__HASH = HashingUtils::HashString("int");
-        static const int double__HASH = HashingUtils::HashString("double");
-        static const int literal_HASH = HashingUtils::HashString("literal");
-        static const int text_HASH = HashingUtils::HashString("text");
-        static const int date_HASH = HashingUtils::HashString("date");
-        static const int latlon_HASH = HashingUtils::HashString("latlon");
-        static const int int_array_HASH = HashingUtils::HashString("int-array");
-        static const int double_array_HASH = HashingUtils::HashString("double-array");
-        static const int literal_array_HASH = HashingUtils::HashString("literal-array");
-        static const int text_array_HASH = HashingUtils::HashString("text-array");
-        static const int date_array_HASH = HashingUtils::HashString("date-array");
+        static constexpr int int__HASH = HashingUtils::CompileTimeHashString("int");
+        static constexpr int double__HASH = HashingUtils::CompileTimeHashString("double");
+        static constexpr int literal_HASH = HashingUtils::CompileTimeHashString("literal");
+        static constexpr int text_HASH = HashingUtils::CompileTimeHashString("text");
+        static constexpr int date_HASH = HashingUtils::CompileTimeHashString("date");
+        static constexpr int latlon_HASH = HashingUtils::CompileTimeHashString("latlon");
+        static constexpr int int_array_HASH = HashingUtils::CompileTimeHashString("int-array");
+        static constexpr int double_array_HASH = HashingUtils::CompileTimeHashString("double-array");
+        static constexpr int literal_array_HASH = HashingUtils::CompileTimeHashString("literal-array");
+        static constexpr int text_array_HASH = HashingUtils::CompileTimeHashString("text-array");
+        static constexpr int date_array_HASH = HashingUtils::CompileTimeHashString("date-array");
 
 
         IndexFieldType GetIndexFieldTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == int__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IndexFieldType::int_;
-          }
-          else if (hashCode == double__HASH)
-          {
-            return IndexFieldType::double_;
-          }
-          else if (hashCode == literal_HASH)
-          {
-            return IndexFieldType::literal;
-          }
-          else if (hashCode == text_HASH)
-          {
-            return IndexFieldType::text;
-          }
-          else if (hashCode == date_HASH)
-          {
-            return IndexFieldType::date;
-          }
-          else if (hashCode == latlon_HASH)
-          {
-            return IndexFieldType::latlon;
-          }
-          else if (hashCode == int_array_HASH)
-          {
-            return IndexFieldType::int_array;
-          }
-          else if (hashCode == double_array_HASH)
-          {
-            return IndexFieldType::double_array;
-          }
-          else if (hashCode == literal_array_HASH)
-          {
-            return IndexFieldType::literal_array;
-          }
-          else if (hashCode == text_array_HASH)
-          {
-            return IndexFieldType::text_array;
-          }
-          else if (hashCode == date_array_HASH)
-          {
-            return IndexFieldType::date_array;
+          case int__HASH:
+            if (name == "int")
+            {
+              return IndexFieldType::int_;
+            }
+            break;
+          case double__HASH:
+            if (name == "double")
+            {
+              return IndexFieldType::double_;
+            }
+            break;
+          case literal_HASH:
+            if (name == "literal")
+            {
+              return IndexFieldType::literal;
+            }
+            break;
+          case text_HASH:
+            if (name == "text")
+            {
+              return IndexFieldType::text;
+            }
+            break;
+          case date_HASH:
+            if (name == "date")
+            {
+              return IndexFieldType::date;
+            }
+            break;
+          case latlon_HASH:
+            if (name == "latlon")
+            {
+              return IndexFieldType::latlon;
+            }
+            break;
+          case int_array_HASH:
+            if (name == "int-array")
+            {
+              return IndexFieldType::int_array;
+            }
+            break;
+          case double_array_HASH:
+            if (name == "double-array")
+            {
+              return IndexFieldType::double_array;
+            }
+            break;
+          case literal_array_HASH:
+            if (name == "literal-array")
+            {
+              return IndexFieldType::literal_array;
+            }
+            break;
+          case text_array_HASH:
+            if (name == "text-array")
+            {
+              return IndexFieldType::text_array;
+            }
+            break;
+          case date_array_HASH:
+            if (name == "date-array")
+            {
+              return IndexFieldType::date_array;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return IndexFieldType::NOT_SET;
         }
 
-        Aws::String GetNameForIndexFieldType(IndexFieldType enumValue)
+        const char* GetNameForIndexFieldType(IndexFieldType enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
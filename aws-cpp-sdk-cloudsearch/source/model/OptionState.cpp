@@ -30,30 +30,44 @@ namespace Aws
       namespace OptionStateMapper
       {
 
-        static const int RequiresIndexDocuments_HASH = HashingUtils::HashString("RequiresIndexDocuments");
-        static const int Processing_HASH = HashingUtils::HashString("Processing");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int FailedToValidate_HASH = HashingUtils::HashString("FailedToValidate");
+        static constexpr int RequiresIndexDocuments_HASH = HashingUtils::CompileTimeHashString("RequiresIndexDocuments");
+        static constexpr int Processing_HASH = HashingUtils::CompileTimeHashString("Processing");
+        static constexpr int Active_HASH = HashingUtils::CompileTimeHashString("Active");
+        static constexpr int FailedToValidate_HASH = HashingUtils::CompileTimeHashString("FailedToValidate");
 
 
         OptionState GetOptionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RequiresIndexDocuments_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OptionState::RequiresIndexDocuments;
-          }
-          else if (hashCode == Processing_HASH)
-          {
-            return OptionState::Processing;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return OptionState::Active;
-          }
-          else if (hashCode == FailedToValidate_HASH)
-          {
-            return OptionState::FailedToValidate;
+          case RequiresIndexDocuments_HASH:
+            if (name == "RequiresIndexDocuments")
+            {
+              return OptionState::RequiresIndexDocuments;
+            }
+            break;
+          case Processing_HASH:
+            if (name == "Processing")
+            {
+              return OptionState::Processing;
+            }
+            break;
+          case Active_HASH:
+            if (name == "Active")
+            {
+              return OptionState::Active;
+            }
+            break;
+          case FailedToValidate_HASH:
+            if (name == "FailedToValidate")
+            {
+              return OptionState::FailedToValidate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return OptionState::NOT_SET;
         }
 
-        Aws::String GetNameForOptionState(OptionState enumValue)
+        const char* GetNameForOptionState(OptionState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace PartitionInstanceTypeMapper
       {
 
-        static const int search_m1_small_HASH = HashingUtils::HashString("search.m1.small");
-        static const int search_m1_large_HASH = HashingUtils::HashString("search.m1.large");
-        static const int search_m2_xlarge_HASH = HashingUtils::HashString("search.m2.xlarge");
-        static const int search_m2_2xlarge_HASH = HashingUtils::HashString("search.m2.2xlarge");
-        static const int search_m3_medium_HASH = HashingUtils::HashString("search.m3.medium");
-        static const int search_m3_large_HASH = HashingUtils::HashString("search.m3.large");
-        static const int search_m3_xlarge_HASH = HashingUtils::HashString("search.m3.xlarge");
-        static const int search_m3_2xlarge_HASH = HashingUtils::HashString("search.m3.2xlarge");
+        static constexpr int search_m1_small_HASH = HashingUtils::CompileTimeHashString("search.m1.small");
+        static constexpr int search_m1_large_HASH = HashingUtils::CompileTimeHashString("search.m1.large");
+        static constexpr int search_m2_xlarge_HASH = HashingUtils::CompileTimeHashString("search.m2.xlarge");
+        static constexpr int search_m2_2xlarge_HASH = HashingUtils::CompileTimeHashString("search.m2.2xlarge");
+        static constexpr int search_m3_medium_HASH = HashingUtils::CompileTimeHashString("search.m3.medium");
+        static constexpr int search_m3_large_HASH = HashingUtils::CompileTimeHashString("search.m3.large");
+        static constexpr int search_m3_xlarge_HASH = HashingUtils::CompileTimeHashString("search.m3.xlarge");
+        static constexpr int search_m3_2xlarge_HASH = HashingUtils::CompileTimeHashString("search.m3.2xlarge");
 
 
         PartitionInstanceType GetPartitionInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == search_m1_small_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PartitionInstanceType::search_m1_small;
-          }
-          else if (hashCode == search_m1_large_HASH)
-          {
-            return PartitionInstanceType::search_m1_large;
-          }
-          else if (hashCode == search_m2_xlarge_HASH)
-          {
-            return PartitionInstanceType::search_m2_xlarge;
-          }
-          else if (hashCode == search_m2_2xlarge_HASH)
-          {
-            return PartitionInstanceType::search_m2_2xlarge;
-          }
-          else if (hashCode == search_m3_medium_HASH)
-          {
-            return PartitionInstanceType::search_m3_medium;
-          }
-          else if (hashCode == search_m3_large_HASH)
-          {
-            return PartitionInstanceType::search_m3_large;
-          }
-          else if (hashCode == search_m3_xlarge_HASH)
-          {
-            return PartitionInstanceType::search_m3_xlarge;
-          }
-          else if (hashCode == search_m3_2xlarge_HASH)
-          {
-            return PartitionInstanceType::search_m3_2xlarge;
+          case search_m1_small_HASH:
+            if (name == "search.m1.small")
+            {
+              return PartitionInstanceType::search_m1_small;
+            }
+            break;
+          case search_m1_large_HASH:
+            if (name == "search.m1.large")
+            {
+              return PartitionInstanceType::search_m1_large;
+            }
+            break;
+          case search_m2_xlarge_HASH:
+            if (name == "search.m2.xlarge")
+            {
+              return PartitionInstanceType::search_m2_xlarge;
+            }
+            break;
+          case search_m2_2xlarge_HASH:
+            if (name == "search.m2.2xlarge")
+            {
+              return PartitionInstanceType::search_m2_2xlarge;
+            }
+            break;
+          case search_m3_medium_HASH:
+            if (name == "search.m3.medium")
+            {
+              return PartitionInstanceType::search_m3_medium;
+            }
+            break;
+          case search_m3_large_HASH:
+            if (name == "search.m3.large")
+            {
+              return PartitionInstanceType::search_m3_large;
+            }
+            break;
+          case search_m3_xlarge_HASH:
+            if (name == "search.m3.xlarge")
+            {
+              return PartitionInstanceType::search_m3_xlarge;
+            }
+            break;
+          case search_m3_2xlarge_HASH:
+            if (name == "search.m3.2xlarge")
+            {
+              return PartitionInstanceType::search_m3_2xlarge;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return PartitionInstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForPartitionInstanceType(PartitionInstanceType enumValue)
+        const char* GetNameForPartitionInstanceType(PartitionInstanceType enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace SuggesterFuzzyMatchingMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int low_HASH = HashingUtils::HashString("low");
-        static const int high_HASH = HashingUtils::HashString("high");
+        static constexpr int none_HASH = HashingUtils::CompileTimeHashString("none");
+        static constexpr int low_HASH = HashingUtils::CompileTimeHashString("low");
+        static constexpr int high_HASH = HashingUtils::CompileTimeHashString("high");
 
 
         SuggesterFuzzyMatching GetSuggesterFuzzyMatchingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SuggesterFuzzyMatching::none;
-          }
-          else if (hashCode == low_HASH)
-          {
-            return SuggesterFuzzyMatching::low;
-          }
-          else if (hashCode == high_HASH)
-          {
-            return SuggesterFuzzyMatching::high;
+          case none_HASH:
+            if (name == "none")
+            {
+              return SuggesterFuzzyMatching::none;
+            }
+            break;
+          case low_HASH:
+            if (name == "low")
+            {
+              return SuggesterFuzzyMatching::low;
+            }
+            break;
+          case high_HASH:
+            if (name == "high")
+            {
+              return SuggesterFuzzyMatching::high;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return SuggesterFuzzyMatching::NOT_SET;
         }
 
-        Aws::String GetNameForSuggesterFuzzyMatching(SuggesterFuzzyMatching enumValue)
+        const char* GetNameForSuggesterFuzzyMatching(SuggesterFuzzyMatching enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace ContentTypeMapper
 {
 AWS_CLOUDSEARCHDOMAIN_API ContentType GetContentTypeForName(const Aws::String& name);
 
-AWS_CLOUDSEARCHDOMAIN_API Aws::String GetNameForContentType(ContentType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDSEARCHDOMAIN_API const char* GetNameForContentType(ContentType value);
 } // namespace ContentTypeMapper
 } // namespace Model
 } // namespace CloudSearchDomain
@@ -36,7 +36,8 @@ namespace QueryParserMapper
 {
 AWS_CLOUDSEARCHDOMAIN_API QueryParser GetQueryParserForName(const Aws::String& name);
 
-AWS_CLOUDSEARCHDOMAIN_API Aws::String GetNameForQueryParser(QueryParser value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDSEARCHDOMAIN_API const char* GetNameForQueryParser(QueryParser value);
 } // namespace QueryParserMapper
 } // namespace Model
 } // namespace CloudSearchDomain
@@ -28,8 +28,8 @@ namespace CloudSearchDomain
 namespace CloudSearchDomainErrorMapper
 {
 
-static const int DOCUMENT_SERVICE_HASH = HashingUtils::HashString("DocumentServiceException");
-static const int SEARCH_HASH = HashingUtils::HashString("SearchException");
+static constexpr int DOCUMENT_SERVICE_HASH = HashingUtils::CompileTimeHashString("DocumentServiceException");
+static constexpr int SEARCH_HASH = HashingUtils::CompileTimeHashString("SearchException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
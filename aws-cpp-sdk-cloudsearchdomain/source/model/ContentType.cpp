@@ -30,20 +30,30 @@ namespace Aws
       namespace ContentTypeMapper
       {
 
-        static const int application_json_HASH = HashingUtils::HashString("application/json");
-        static const int application_xml_HASH = HashingUtils::HashString("application/xml");
+        static constexpr int application_json_HASH = HashingUtils::CompileTimeHashString("application/json");
+        static constexpr int application_xml_HASH = HashingUtils::CompileTimeHashString("application/xml");
 
 
         ContentType GetContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_json_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContentType::application_json;
-          }
-          else if (hashCode == application_xml_HASH)
-          {
-            return ContentType::application_xml;
+          case application_json_HASH:
+            if (name == "application/json")
+            {
+              return ContentType::application_json;
+            }
+            break;
+          case application_xml_HASH:
+            if (name == "application/xml")
+            {
+              return ContentType::application_xml;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ContentType::NOT_SET;
         }
 
-        Aws::String GetNameForContentType(ContentType enumValue)
+        const char* GetNameForContentType(ContentType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace QueryParserMapper
       {
 
-        static const int simple_HASH = HashingUtils::HashString("simple");
-        static const int structured_HASH = HashingUtils::HashString("structured");
-        static const int lucene_HASH = HashingUtils::HashString("lucene");
-        static const int dismax_HASH = HashingUtils::HashString("dismax");
+        static constexpr int simple_HASH = HashingUtils::CompileTimeHashString("simple");
+        static constexpr int structured_HASH = HashingUtils::CompileTimeHashString("structured");
+        static constexpr int lucene_HASH = HashingUtils::CompileTimeHashString("lucene");
+        static constexpr int dismax_HASH = HashingUtils::CompileTimeHashString("dismax");
 
 
         QueryParser GetQueryParserForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == simple_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QueryParser::simple;
-          }
-          else if (hashCode == structured_HASH)
-          {
-            return QueryParser::structured;
-          }
-          else if (hashCode == lucene_HASH)
-          {
-            return QueryParser::lucene;
-          }
-          else if (hashCode == dismax_HASH)
-          {
-            return QueryParser::dismax;
+          case simple_HASH:
+            if (name == "simple")
+            {
+              return QueryParser::simple;
+            }
+            break;
+          case structured_HASH:
+            if (name == "structured")
+            {
+              return QueryParser::structured;
+            }
+            break;
+          case lucene_HASH:
+            if (name == "lucene")
+            {
+              return QueryParser::lucene;
+            }
+            break;
+          case dismax_HASH:
+            if (name == "dismax")
+            {
+              return QueryParser::dismax;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return QueryParser::NOT_SET;
         }
 
-        Aws::String GetNameForQueryParser(QueryParser enumValue)
+        const char* GetNameForQueryParser(QueryParser enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
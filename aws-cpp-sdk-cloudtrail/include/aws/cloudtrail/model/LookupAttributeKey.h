@@ -38,7 +38,8 @@ namespace LookupAttributeKeyMapper
 {
 AWS_CLOUDTRAIL_API LookupAttributeKey GetLookupAttributeKeyForName(const Aws::String& name);
 
-AWS_CLOUDTRAIL_API Aws::String GetNameForLookupAttributeKey(LookupAttributeKey value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDTRAIL_API const char* GetNameForLookupAttributeKey(LookupAttributeKey value);
 } // namespace LookupAttributeKeyMapper
 } // namespace Model
 } // namespace CloudTrail
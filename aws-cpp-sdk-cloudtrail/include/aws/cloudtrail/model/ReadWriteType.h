@@ -35,7 +35,8 @@ namespace ReadWriteTypeMapper
 {
 AWS_CLOUDTRAIL_API ReadWriteType GetReadWriteTypeForName(const Aws::String& name);
 
-AWS_CLOUDTRAIL_API Aws::String GetNameForReadWriteType(ReadWriteType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDTRAIL_API const char* GetNameForReadWriteType(ReadWriteType value);
 } // namespace ReadWriteTypeMapper
 } // namespace Model
 } // namespace CloudTrail
@@ -28,38 +28,38 @@ namespace CloudTrail
 namespace CloudTrailErrorMapper
 {
 
-static const int INVALID_LOOKUP_ATTRIBUTES_HASH = HashingUtils::HashString("InvalidLookupAttributesException");
-static const int TRAIL_NOT_PROVIDED_HASH = HashingUtils::HashString("TrailNotProvidedException");
-static const int INSUFFICIENT_S3_BUCKET_POLICY_HASH = HashingUtils::HashString("InsufficientS3BucketPolicyException");
-static const int MAXIMUM_NUMBER_OF_TRAILS_EXCEEDED_HASH = HashingUtils::HashString("MaximumNumberOfTrailsExceededException");
-static const int INVALID_S3_PREFIX_HASH = HashingUtils::HashString("InvalidS3PrefixException");
-static const int INVALID_CLOUD_WATCH_LOGS_LOG_GROUP_ARN_HASH = HashingUtils::HashString("InvalidCloudWatchLogsLogGroupArnException");
-static const int INSUFFICIENT_SNS_TOPIC_POLICY_HASH = HashingUtils::HashString("InsufficientSnsTopicPolicyException");
-static const int S3_BUCKET_DOES_NOT_EXIST_HASH = HashingUtils::HashString("S3BucketDoesNotExistException");
-static const int KMS_HASH = HashingUtils::HashString("KmsException");
-static const int INVALID_HOME_REGION_HASH = HashingUtils::HashString("InvalidHomeRegionException");
-static const int RESOURCE_TYPE_NOT_SUPPORTED_HASH = HashingUtils::HashString("ResourceTypeNotSupportedException");
-static const int KMS_KEY_DISABLED_HASH = HashingUtils::HashString("KmsKeyDisabledException");
-static const int TRAIL_ALREADY_EXISTS_HASH = HashingUtils::HashString("TrailAlreadyExistsException");
-static const int INVALID_TOKEN_HASH = HashingUtils::HashString("InvalidTokenException");
-static const int CLOUD_WATCH_LOGS_DELIVERY_UNAVAILABLE_HASH = HashingUtils::HashString("CloudWatchLogsDeliveryUnavailableException");
-static const int CLOUD_TRAIL_A_R_N_INVALID_HASH = HashingUtils::HashString("CloudTrailARNInvalidException");
-static const int TAGS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TagsLimitExceededException");
-static const int INVALID_S3_BUCKET_NAME_HASH = HashingUtils::HashString("InvalidS3BucketNameException");
-static const int INVALID_MAX_RESULTS_HASH = HashingUtils::HashString("InvalidMaxResultsException");
-static const int INVALID_CLOUD_WATCH_LOGS_ROLE_ARN_HASH = HashingUtils::HashString("InvalidCloudWatchLogsRoleArnException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int INVALID_TRAIL_NAME_HASH = HashingUtils::HashString("InvalidTrailNameException");
-static const int INVALID_KMS_KEY_ID_HASH = HashingUtils::HashString("InvalidKmsKeyIdException");
-static const int INVALID_SNS_TOPIC_NAME_HASH = HashingUtils::HashString("InvalidSnsTopicNameException");
-static const int INSUFFICIENT_ENCRYPTION_POLICY_HASH = HashingUtils::HashString("InsufficientEncryptionPolicyException");
-static const int INVALID_TAG_PARAMETER_HASH = HashingUtils::HashString("InvalidTagParameterException");
-static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OperationNotPermittedException");
-static const int UNSUPPORTED_OPERATION_HASH = HashingUtils::HashString("UnsupportedOperationException");
-static const int TRAIL_NOT_FOUND_HASH = HashingUtils::HashString("TrailNotFoundException");
-static const int INVALID_TIME_RANGE_HASH = HashingUtils::HashString("InvalidTimeRangeException");
-static const int INVALID_EVENT_SELECTORS_HASH = HashingUtils::HashString("InvalidEventSelectorsException");
-static const int KMS_KEY_NOT_FOUND_HASH = HashingUtils::HashString("KmsKeyNotFoundException");
+static constexpr int INVALID_LOOKUP_ATTRIBUTES_HASH = HashingUtils::CompileTimeHashString("InvalidLookupAttributesException");
+static constexpr int TRAIL_NOT_PROVIDED_HASH = HashingUtils::CompileTimeHashString("TrailNotProvidedException");
+static constexpr int INSUFFICIENT_S3_BUCKET_POLICY_HASH = HashingUtils::CompileTimeHashString("InsufficientS3BucketPolicyException");
+static constexpr int MAXIMUM_NUMBER_OF_TRAILS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaximumNumberOfTrailsExceededException");
+static constexpr int INVALID_S3_PREFIX_HASH = HashingUtils::CompileTimeHashString("InvalidS3PrefixException");
+static constexpr int INVALID_CLOUD_WATCH_LOGS_LOG_GROUP_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidCloudWatchLogsLogGroupArnException");
+static constexpr int INSUFFICIENT_SNS_TOPIC_POLICY_HASH = HashingUtils::CompileTimeHashString("InsufficientSnsTopicPolicyException");
+static constexpr int S3_BUCKET_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("S3BucketDoesNotExistException");
+static constexpr int KMS_HASH = HashingUtils::CompileTimeHashString("KmsException");
+static constexpr int INVALID_HOME_REGION_HASH = HashingUtils::CompileTimeHashString("InvalidHomeRegionException");
+static constexpr int RESOURCE_TYPE_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("ResourceTypeNotSupportedException");
+static constexpr int KMS_KEY_DISABLED_HASH = HashingUtils::CompileTimeHashString("KmsKeyDisabledException");
+static constexpr int TRAIL_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("TrailAlreadyExistsException");
+static constexpr int INVALID_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidTokenException");
+static constexpr int CLOUD_WATCH_LOGS_DELIVERY_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("CloudWatchLogsDeliveryUnavailableException");
+static constexpr int CLOUD_TRAIL_A_R_N_INVALID_HASH = HashingUtils::CompileTimeHashString("CloudTrailARNInvalidException");
+static constexpr int TAGS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TagsLimitExceededException");
+static constexpr int INVALID_S3_BUCKET_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidS3BucketNameException");
+static constexpr int INVALID_MAX_RESULTS_HASH = HashingUtils::CompileTimeHashString("InvalidMaxResultsException");
+static constexpr int INVALID_CLOUD_WATCH_LOGS_ROLE_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidCloudWatchLogsRoleArnException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int INVALID_TRAIL_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidTrailNameException");
+static constexpr int INVALID_KMS_KEY_ID_HASH = HashingUtils::CompileTimeHashString("InvalidKmsKeyIdException");
+static constexpr int INVALID_SNS_TOPIC_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidSnsTopicNameException");
+static constexpr int INSUFFICIENT_ENCRYPTION_POLICY_HASH = HashingUtils::CompileTimeHashString("InsufficientEncryptionPolicyException");
+static constexpr int INVALID_TAG_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidTagParameterException");
+static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OperationNotPermittedException");
+static constexpr int UNSUPPORTED_OPERATION_HASH = HashingUtils::CompileTimeHashString("UnsupportedOperationException");
+static constexpr int TRAIL_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("TrailNotFoundException");
+static constexpr int INVALID_TIME_RANGE_HASH = HashingUtils::CompileTimeHashString("InvalidTimeRangeException");
+static constexpr int INVALID_EVENT_SELECTORS_HASH = HashingUtils::CompileTimeHashString("InvalidEventSelectorsException");
+static constexpr int KMS_KEY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("KmsKeyNotFoundException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,40 +30,58 @@ namespace Aws
       namespace LookupAttributeKeyMapper
       {
 
-        static const int EventId_HASH = HashingUtils::HashString("EventId");
-        static const int EventName_HASH = HashingUtils::HashString("EventName");
-        static const int Username_HASH = HashingUtils::HashString("Username");
-        static const int ResourceType_HASH = HashingUtils::HashString("ResourceType");
-        static const int ResourceName_HASH = HashingUtils::HashString("ResourceName");
-        static const int EventSource_HASH = HashingUtils::HashString("EventSource");
+        static constexpr int EventId_HASH = HashingUtils::CompileTimeHashString("EventId");
+        static constexpr int EventName_HASH = HashingUtils::CompileTimeHashString("EventName");
+        static constexpr int Username_HASH = HashingUtils::CompileTimeHashString("Username");
+        static constexpr int ResourceType_HASH = HashingUtils::CompileTimeHashString("ResourceType");
+        static constexpr int ResourceName_HASH = HashingUtils::CompileTimeHashString("ResourceName");
+        static constexpr int EventSource_HASH = HashingUtils::CompileTimeHashString("EventSource");
 
 
         LookupAttributeKey GetLookupAttributeKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EventId_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LookupAttributeKey::EventId;
-          }
-          else if (hashCode == EventName_HASH)
-          {
-            return LookupAttributeKey::EventName;
-          }
-          else if (hashCode == Username_HASH)
-          {
-            return LookupAttributeKey::Username;
-          }
-          else if (hashCode == ResourceType_HASH)
-          {
-            return LookupAttributeKey::ResourceType;
-          }
-          else if (hashCode == ResourceName_HASH)
-          {
-            return LookupAttributeKey::ResourceName;
-          }
-          else if (hashCode == EventSource_HASH)
-          {
-            return LookupAttributeKey::EventSource;
+          case EventId_HASH:
+            if (name == "EventId")
+            {
+              return LookupAttributeKey::EventId;
+            }
+            break;
+          case EventName_HASH:
+            if (name == "EventName")
+            {
+              return LookupAttributeKey::EventName;
+            }
+            break;
+          case Username_HASH:
+            if (name == "Username")
+            {
+              return LookupAttributeKey::Username;
+            }
+            break;
+          case ResourceType_HASH:
+            if (name == "ResourceType")
+            {
+              return LookupAttributeKey::ResourceType;
+            }
+            break;
+          case ResourceName_HASH:
+            if (name == "ResourceName")
+            {
+              return LookupAttributeKey::ResourceName;
+            }
+            break;
+          case EventSource_HASH:
+            if (name == "EventSource")
+            {
+              return LookupAttributeKey::EventSource;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return LookupAttributeKey::NOT_SET;
         }
 
-        Aws::String GetNameForLookupAttributeKey(LookupAttributeKey enumValue)
+        const char* GetNameForLookupAttributeKey(LookupAttributeKey enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ReadWriteTypeMapper
       {
 
-        static const int ReadOnly_HASH = HashingUtils::HashString("ReadOnly");
-        static const int WriteOnly_HASH = HashingUtils::HashString("WriteOnly");
-        static const int All_HASH = HashingUtils::HashString("All");
+        static constexpr int ReadOnly_HASH = HashingUtils::CompileTimeHashString("ReadOnly");
+        static constexpr int WriteOnly_HASH = HashingUtils::CompileTimeHashString("WriteOnly");
+        static constexpr int All_HASH = HashingUtils::CompileTimeHashString("All");
 
 
         ReadWriteType GetReadWriteTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ReadOnly_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReadWriteType::ReadOnly;
-          }
-          else if (hashCode == WriteOnly_HASH)
-          {
-            return ReadWriteType::WriteOnly;
-          }
-          else if (hashCode == All_HASH)
-          {
-            return ReadWriteType::All;
+          case ReadOnly_HASH:
+            if (name == "ReadOnly")
+            {
+              return ReadWriteType::ReadOnly;
+            }
+            break;
+          case WriteOnly_HASH:
+            if (name == "WriteOnly")
+            {
+              return ReadWriteType::WriteOnly;
+            }
+            break;
+          case All_HASH:
+            if (name == "All")
+            {
+              return ReadWriteType::All;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ReadWriteType::NOT_SET;
         }
 
-        Aws::String GetNameForReadWriteType(ReadWriteType enumValue)
+        const char* GetNameForReadWriteType(ReadWriteType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
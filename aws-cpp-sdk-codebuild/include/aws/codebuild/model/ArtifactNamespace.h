@@ -34,7 +34,8 @@ namespace ArtifactNamespaceMapper
 {
 AWS_CODEBUILD_API ArtifactNamespace GetArtifactNamespaceForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForArtifactNamespace(ArtifactNamespace value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForArtifactNamespace(ArtifactNamespace value);
 } // namespace ArtifactNamespaceMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -34,7 +34,8 @@ namespace ArtifactPackagingMapper
 {
 AWS_CODEBUILD_API ArtifactPackaging GetArtifactPackagingForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForArtifactPackaging(ArtifactPackaging value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForArtifactPackaging(ArtifactPackaging value);
 } // namespace ArtifactPackagingMapper
 } // namespace Model
 } // namespace CodeBuild
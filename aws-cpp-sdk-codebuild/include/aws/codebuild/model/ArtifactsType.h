@@ -35,7 +35,8 @@ namespace ArtifactsTypeMapper
 {
 AWS_CODEBUILD_API ArtifactsType GetArtifactsTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForArtifactsType(ArtifactsType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForArtifactsType(ArtifactsType value);
 } // namespace ArtifactsTypeMapper
 } // namespace Model
 } // namespace CodeBuild
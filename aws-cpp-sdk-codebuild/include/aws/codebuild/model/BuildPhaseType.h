@@ -42,7 +42,8 @@ namespace BuildPhaseTypeMapper
 {
 AWS_CODEBUILD_API BuildPhaseType GetBuildPhaseTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForBuildPhaseType(BuildPhaseType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForBuildPhaseType(BuildPhaseType value);
 } // namespace BuildPhaseTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -34,7 +34,8 @@ namespace CacheTypeMapper
 {
 AWS_CODEBUILD_API CacheType GetCacheTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForCacheType(CacheType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForCacheType(CacheType value);
 } // namespace CacheTypeMapper
 } // namespace Model
 } // namespace CodeBuild
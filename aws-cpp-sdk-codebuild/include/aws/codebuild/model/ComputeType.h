@@ -35,7 +35,8 @@ namespace ComputeTypeMapper
 {
 AWS_CODEBUILD_API ComputeType GetComputeTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForComputeType(ComputeType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForComputeType(ComputeType value);
 } // namespace ComputeTypeMapper
 } // namespace Model
 } // namespace CodeBuild
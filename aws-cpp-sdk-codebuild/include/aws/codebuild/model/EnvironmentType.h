@@ -34,7 +34,8 @@ namespace EnvironmentTypeMapper
 {
 AWS_CODEBUILD_API EnvironmentType GetEnvironmentTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForEnvironmentType(EnvironmentType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForEnvironmentType(EnvironmentType value);
 } // namespace EnvironmentTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -34,7 +34,8 @@ namespace EnvironmentVariableTypeMapper
 {
 AWS_CODEBUILD_API EnvironmentVariableType GetEnvironmentVariableTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForEnvironmentVariableType(EnvironmentVariableType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForEnvironmentVariableType(EnvironmentVariableType value);
 } // namespace EnvironmentVariableTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -41,7 +41,8 @@ namespace LanguageTypeMapper
 {
 AWS_CODEBUILD_API LanguageType GetLanguageTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForLanguageType(LanguageType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForLanguageType(LanguageType value);
 } // namespace LanguageTypeMapper
 } // namespace Model
 } // namespace CodeBuild
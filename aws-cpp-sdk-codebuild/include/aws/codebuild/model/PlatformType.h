@@ -36,7 +36,8 @@ namespace PlatformTypeMapper
 {
 AWS_CODEBUILD_API PlatformType GetPlatformTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForPlatformType(PlatformType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForPlatformType(PlatformType value);
 } // namespace PlatformTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -35,7 +35,8 @@ namespace ProjectSortByTypeMapper
 {
 AWS_CODEBUILD_API ProjectSortByType GetProjectSortByTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForProjectSortByType(ProjectSortByType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForProjectSortByType(ProjectSortByType value);
 } // namespace ProjectSortByTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -34,7 +34,8 @@ namespace SortOrderTypeMapper
 {
 AWS_CODEBUILD_API SortOrderType GetSortOrderTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForSortOrderType(SortOrderType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForSortOrderType(SortOrderType value);
 } // namespace SortOrderTypeMapper
 } // namespace Model
 } // namespace CodeBuild
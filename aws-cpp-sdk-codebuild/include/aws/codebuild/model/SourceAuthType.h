@@ -33,7 +33,8 @@ namespace SourceAuthTypeMapper
 {
 AWS_CODEBUILD_API SourceAuthType GetSourceAuthTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForSourceAuthType(SourceAuthType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForSourceAuthType(SourceAuthType value);
 } // namespace SourceAuthTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -38,7 +38,8 @@ namespace SourceTypeMapper
 {
 AWS_CODEBUILD_API SourceType GetSourceTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForSourceType(SourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForSourceType(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace CodeBuild
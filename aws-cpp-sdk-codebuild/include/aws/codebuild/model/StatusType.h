@@ -38,7 +38,8 @@ namespace StatusTypeMapper
 {
 AWS_CODEBUILD_API StatusType GetStatusTypeForName(const Aws::String& name);
 
-AWS_CODEBUILD_API Aws::String GetNameForStatusType(StatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEBUILD_API const char* GetNameForStatusType(StatusType value);
 } // namespace StatusTypeMapper
 } // namespace Model
 } // namespace CodeBuild
@@ -28,10 +28,10 @@ namespace CodeBuild
 namespace CodeBuildErrorMapper
 {
 
-static const int O_AUTH_PROVIDER_HASH = HashingUtils::HashString("OAuthProviderException");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInputException");
-static const int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ResourceAlreadyExistsException");
-static const int ACCOUNT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AccountLimitExceededException");
+static constexpr int O_AUTH_PROVIDER_HASH = HashingUtils::CompileTimeHashString("OAuthProviderException");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInputException");
+static constexpr int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyExistsException");
+static constexpr int ACCOUNT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AccountLimitExceededException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace ArtifactNamespaceMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int BUILD_ID_HASH = HashingUtils::HashString("BUILD_ID");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int BUILD_ID_HASH = HashingUtils::CompileTimeHashString("BUILD_ID");
 
 
         ArtifactNamespace GetArtifactNamespaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ArtifactNamespace::NONE;
-          }
-          else if (hashCode == BUILD_ID_HASH)
-          {
-            return ArtifactNamespace::BUILD_ID;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return ArtifactNamespace::NONE;
+            }
+            break;
+          case BUILD_ID_HASH:
+            if (name == "BUILD_ID")
+            {
+              return ArtifactNamespace::BUILD_ID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ArtifactNamespace::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactNamespace(ArtifactNamespace enumValue)
+        const char* GetNameForArtifactNamespace(ArtifactNamespace enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
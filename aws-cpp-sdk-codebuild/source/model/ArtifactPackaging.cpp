@@ -30,20 +30,30 @@ namespace Aws
       namespace ArtifactPackagingMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int ZIP_HASH = HashingUtils::HashString("ZIP");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int ZIP_HASH = HashingUtils::CompileTimeHashString("ZIP");
 
 
         ArtifactPackaging GetArtifactPackagingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ArtifactPackaging::NONE;
-          }
-          else if (hashCode == ZIP_HASH)
-          {
-            return ArtifactPackaging::ZIP;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return ArtifactPackaging::NONE;
+            }
+            break;
+          case ZIP_HASH:
+            if (name == "ZIP")
+            {
+              return ArtifactPackaging::ZIP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ArtifactPackaging::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactPackaging(ArtifactPackaging enumValue)
+        const char* GetNameForArtifactPackaging(ArtifactPackaging enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ArtifactsTypeMapper
       {
 
-        static const int CODEPIPELINE_HASH = HashingUtils::HashString("CODEPIPELINE");
-        static const int S3_HASH = HashingUtils::HashString("S3");
-        static const int NO_ARTIFACTS_HASH = HashingUtils::HashString("NO_ARTIFACTS");
+        static constexpr int CODEPIPELINE_HASH = HashingUtils::CompileTimeHashString("CODEPIPELINE");
+        static constexpr int S3_HASH = HashingUtils::CompileTimeHashString("S3");
+        static constexpr int NO_ARTIFACTS_HASH = HashingUtils::CompileTimeHashString("NO_ARTIFACTS");
 
 
         ArtifactsType GetArtifactsTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODEPIPELINE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ArtifactsType::CODEPIPELINE;
-          }
-          else if (hashCode == S3_HASH)
-          {
-            return ArtifactsType::S3;
-          }
-          else if (hashCode == NO_ARTIFACTS_HASH)
-          {
-            return ArtifactsType::NO_ARTIFACTS;
+          case CODEPIPELINE_HASH:
+            if (name == "CODEPIPELINE")
+            {
+              return ArtifactsType::CODEPIPELINE;
+            }
+            break;
+          case S3_HASH:
+            if (name == "S3")
+            {
+              return ArtifactsType::S3;
+            }
+            break;
+          case NO_ARTIFACTS_HASH:
+            if (name == "NO_ARTIFACTS")
+            {
+              return ArtifactsType::NO_ARTIFACTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ArtifactsType::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactsType(ArtifactsType enumValue)
+        const char* GetNameForArtifactsType(ArtifactsType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
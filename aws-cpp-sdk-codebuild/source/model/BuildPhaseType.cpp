@@ -30,60 +30,86 @@ namespace Aws
       namespace BuildPhaseTypeMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int DOWNLOAD_SOURCE_HASH = HashingUtils::HashString("DOWNLOAD_SOURCE");
-        static const int INSTALL_HASH = HashingUtils::HashString("INSTALL");
-        static const int PRE_BUILD_HASH = HashingUtils::HashString("PRE_BUILD");
-        static const int BUILD_HASH = HashingUtils::HashString("BUILD");
-        static const int POST_BUILD_HASH = HashingUtils::HashString("POST_BUILD");
-        static const int UPLOAD_ARTIFACTS_HASH = HashingUtils::HashString("UPLOAD_ARTIFACTS");
-        static const int FINALIZING_HASH = HashingUtils::HashString("FINALIZING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
+        static constexpr int SUBMITTED_HASH = HashingUtils::CompileTimeHashString("SUBMITTED");
+        static constexpr int PROVISIONING_HASH = HashingUtils::CompileTimeHashString("PROVISIONING");
+        static constexpr int DOWNLOAD_SOURCE_HASH = HashingUtils::CompileTimeHashString("DOWNLOAD_SOURCE");
+        static constexpr int INSTALL_HASH = HashingUtils::CompileTimeHashString("INSTALL");
+        static constexpr int PRE_BUILD_HASH = HashingUtils::CompileTimeHashString("PRE_BUILD");
+        static constexpr int BUILD_HASH = HashingUtils::CompileTimeHashString("BUILD");
+        static constexpr int POST_BUILD_HASH = HashingUtils::CompileTimeHashString("POST_BUILD");
+        static constexpr int UPLOAD_ARTIFACTS_HASH = HashingUtils::CompileTimeHashString("UPLOAD_ARTIFACTS");
+        static constexpr int FINALIZING_HASH = HashingUtils::CompileTimeHashString("FINALIZING");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
 
 
         BuildPhaseType GetBuildPhaseTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BuildPhaseType::SUBMITTED;
-          }
-          else if (hashCode == PROVISIONING_HASH)
-          {
-            return BuildPhaseType::PROVISIONING;
-          }
-          else if (hashCode == DOWNLOAD_SOURCE_HASH)
-          {
-            return BuildPhaseType::DOWNLOAD_SOURCE;
-          }
-          else if (hashCode == INSTALL_HASH)
-          {
-            return BuildPhaseType::INSTALL;
-          }
-          else if (hashCode == PRE_BUILD_HASH)
-          {
-            return BuildPhaseType::PRE_BUILD;
-          }
-          else if (hashCode == BUILD_HASH)
-          {
-            return BuildPhaseType::BUILD;
-          }
-          else if (hashCode == POST_BUILD_HASH)
-          {
-            return BuildPhaseType::POST_BUILD;
-          }
-          else if (hashCode == UPLOAD_ARTIFACTS_HASH)
-          {
-            return BuildPhaseType::UPLOAD_ARTIFACTS;
-          }
-          else if (hashCode == FINALIZING_HASH)
-          {
-            return BuildPhaseType::FINALIZING;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return BuildPhaseType::COMPLETED;
+          case SUBMITTED_HASH:
+            if (name == "SUBMITTED")
+            {
+              return BuildPhaseType::SUBMITTED;
+            }
+            break;
+          case PROVISIONING_HASH:
+            if (name == "PROVISIONING")
+            {
+              return BuildPhaseType::PROVISIONING;
+            }
+            break;
+          case DOWNLOAD_SOURCE_HASH:
+            if (name == "DOWNLOAD_SOURCE")
+            {
+              return BuildPhaseType::DOWNLOAD_SOURCE;
+            }
+            break;
+          case INSTALL_HASH:
+            if (name == "INSTALL")
+            {
+              return BuildPhaseType::INSTALL;
+            }
+            break;
+          case PRE_BUILD_HASH:
+            if (name == "PRE_BUILD")
+            {
+              return BuildPhaseType::PRE_BUILD;
+            }
+            break;
+          case BUILD_HASH:
+            if (name == "BUILD")
+            {
+              return BuildPhaseType::BUILD;
+            }
+            break;
+          case POST_BUILD_HASH:
+            if (name == "POST_BUILD")
+            {
+              return BuildPhaseType::POST_BUILD;
+            }
+            break;
+          case UPLOAD_ARTIFACTS_HASH:
+            if (name == "UPLOAD_ARTIFACTS")
+            {
+              return BuildPhaseType::UPLOAD_ARTIFACTS;
+            }
+            break;
+          case FINALIZING_HASH:
+            if (name == "FINALIZING")
+            {
+              return BuildPhaseType::FINALIZING;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return BuildPhaseType::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return BuildPhaseType::NOT_SET;
         }
 
-        Aws::String GetNameForBuildPhaseType(BuildPhaseType enumValue)
+        const char* GetNameForBuildPhaseType(BuildPhaseType enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace CacheTypeMapper
       {
 
-        static const int NO_CACHE_HASH = HashingUtils::HashString("NO_CACHE");
-        static const int S3_HASH = HashingUtils::HashString("S3");
+        static constexpr int NO_CACHE_HASH = HashingUtils::CompileTimeHashString("NO_CACHE");
+        static constexpr int S3_HASH = HashingUtils::CompileTimeHashString("S3");
 
 
         CacheType GetCacheTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_CACHE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CacheType::NO_CACHE;
-          }
-          else if (hashCode == S3_HASH)
-          {
-            return CacheType::S3;
+          case NO_CACHE_HASH:
+            if (name == "NO_CACHE")
+            {
+              return CacheType::NO_CACHE;
+            }
+            break;
+          case S3_HASH:
+            if (name == "S3")
+            {
+              return CacheType::S3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CacheType::NOT_SET;
         }
 
-        Aws::String GetNameForCacheType(CacheType enumValue)
+        const char* GetNameForCacheType(CacheType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
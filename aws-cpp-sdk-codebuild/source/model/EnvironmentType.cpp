@@ -30,20 +30,30 @@ namespace Aws
       namespace EnvironmentTypeMapper
       {
 
-        static const int WINDOWS_CONTAINER_HASH = HashingUtils::HashString("WINDOWS_CONTAINER");
-        static const int LINUX_CONTAINER_HASH = HashingUtils::HashString("LINUX_CONTAINER");
+        static constexpr int WINDOWS_CONTAINER_HASH = HashingUtils::CompileTimeHashString("WINDOWS_CONTAINER");
+        static constexpr int LINUX_CONTAINER_HASH = HashingUtils::CompileTimeHashString("LINUX_CONTAINER");
 
 
         EnvironmentType GetEnvironmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_CONTAINER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnvironmentType::WINDOWS_CONTAINER;
-          }
-          else if (hashCode == LINUX_CONTAINER_HASH)
-          {
-            return EnvironmentType::LINUX_CONTAINER;
+          case WINDOWS_CONTAINER_HASH:
+            if (name == "WINDOWS_CONTAINER")
+            {
+              return EnvironmentType::WINDOWS_CONTAINER;
+            }
+            break;
+          case LINUX_CONTAINER_HASH:
+            if (name == "LINUX_CONTAINER")
+            {
+              return EnvironmentType::LINUX_CONTAINER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EnvironmentType::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentType(EnvironmentType enumValue)
+        const char* GetNameForEnvironmentType(EnvironmentType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace EnvironmentVariableTypeMapper
       {
 
-        static const int PLAINTEXT_HASH = HashingUtils::HashString("PLAINTEXT");
-        static const int PARAMETER_STORE_HASH = HashingUtils::HashString("PARAMETER_STORE");
+        static constexpr int PLAINTEXT_HASH = HashingUtils::CompileTimeHashString("PLAINTEXT");
+        static constexpr int PARAMETER_STORE_HASH = HashingUtils::CompileTimeHashString("PARAMETER_STORE");
 
 
         EnvironmentVariableType GetEnvironmentVariableTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PLAINTEXT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnvironmentVariableType::PLAINTEXT;
-          }
-          else if (hashCode == PARAMETER_STORE_HASH)
-          {
-            return EnvironmentVariableType::PARAMETER_STORE;
+          case PLAINTEXT_HASH:
+            if (name == "PLAINTEXT")
+            {
+              return EnvironmentVariableType::PLAINTEXT;
+            }
+            break;
+          case PARAMETER_STORE_HASH:
+            if (name == "PARAMETER_STORE")
+            {
+              return EnvironmentVariableType::PARAMETER_STORE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EnvironmentVariableType::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentVariableType(EnvironmentVariableType enumValue)
+        const char* GetNameForEnvironmentVariableType(EnvironmentVariableType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,55 +30,79 @@ namespace Aws
       namespace LanguageTypeMapper
       {
 
-        static const int JAVA_HASH = HashingUtils::HashString("JAVA");
-        static const int PYTHON_HASH = HashingUtils::HashString("PYTHON");
-        static const int NODE_JS_HASH = HashingUtils::HashString("NODE_JS");
-        static const int RUBY_HASH = HashingUtils::HashString("RUBY");
-        static const int GOLANG_HASH = HashingUtils::HashString("GOLANG");
-        static const int DOCKER_HASH = HashingUtils::HashString("DOCKER");
-        static const int ANDROID__HASH = HashingUtils::HashString("ANDROID");
-        static const int DOTNET_HASH = HashingUtils::HashString("DOTNET");
-        static const int BASE_HASH = HashingUtils::HashString("BASE");
+        static constexpr int JAVA_HASH = HashingUtils::CompileTimeHashString("JAVA");
+        static constexpr int PYTHON_HASH = HashingUtils::CompileTimeHashString("PYTHON");
+        static constexpr int NODE_JS_HASH = HashingUtils::CompileTimeHashString("NODE_JS");
+        static constexpr int RUBY_HASH = HashingUtils::CompileTimeHashString("RUBY");
+        static constexpr int GOLANG_HASH = HashingUtils::CompileTimeHashString("GOLANG");
+        static constexpr int DOCKER_HASH = HashingUtils::CompileTimeHashString("DOCKER");
+        static constexpr int ANDROID__HASH = HashingUtils::CompileTimeHashString("ANDROID");
+        static constexpr int DOTNET_HASH = HashingUtils::CompileTimeHashString("DOTNET");
+        static constexpr int BASE_HASH = HashingUtils::CompileTimeHashString("BASE");
 
 
         LanguageType GetLanguageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JAVA_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LanguageType::JAVA;
-          }
-          else if (hashCode == PYTHON_HASH)
-          {
-            return LanguageType::PYTHON;
-          }
-          else if (hashCode == NODE_JS_HASH)
-          {
-            return LanguageType::NODE_JS;
-          }
-          else if (hashCode == RUBY_HASH)
-          {
-            return LanguageType::RUBY;
-          }
-          else if (hashCode == GOLANG_HASH)
-          {
-            return LanguageType::GOLANG;
-          }
-          else if (hashCode == DOCKER_HASH)
-          {
-            return LanguageType::DOCKER;
-          }
-          else if (hashCode == ANDROID__HASH)
-          {
-            return LanguageType::ANDROID_;
-          }
-          else if (hashCode == DOTNET_HASH)
-          {
-            return LanguageType::DOTNET;
-          }
-          else if (hashCode == BASE_HASH)
-          {
-            return LanguageType::BASE;
+          case JAVA_HASH:
+            if (name == "JAVA")
+            {
+              return LanguageType::JAVA;
+            }
+            break;
+          case PYTHON_HASH:
+            if (name == "PYTHON")
+            {
+              return LanguageType::PYTHON;
+            }
+            break;
+          case NODE_JS_HASH:
+            if (name == "NODE_JS")
+            {
+              return LanguageType::NODE_JS;
+            }
+            break;
+          case RUBY_HASH:
+            if (name == "RUBY")
+            {
+              return LanguageType::RUBY;
+            }
+            break;
+          case GOLANG_HASH:
+            if (name == "GOLANG")
+            {
+              return LanguageType::GOLANG;
+            }
+            break;
+          case DOCKER_HASH:
+            if (name == "DOCKER")
+            {
+              return LanguageType::DOCKER;
+            }
+            break;
+          case ANDROID__HASH:
+            if (name == "ANDROID")
+            {
+              return LanguageType::ANDROID_;
+            }
+            break;
+          case DOTNET_HASH:
+            if (name == "DOTNET")
+            {
+              return LanguageType::DOTNET;
+            }
+            break;
+          case BASE_HASH:
+            if (name == "BASE")
+            {
+              return LanguageType::BASE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return LanguageType::NOT_SET;
         }
 
-        Aws::String GetNameForLanguageType(LanguageType enumValue)
+        const char* GetNameForLanguageType(LanguageType enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
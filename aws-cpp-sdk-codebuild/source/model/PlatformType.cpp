@@ -30,30 +30,44 @@ namespace Aws
       namespace PlatformTypeMapper
       {
 
-        static const int DEBIAN_HASH = HashingUtils::HashString("DEBIAN");
-        static const int AMAZON_LINUX_HASH = HashingUtils::HashString("AMAZON_LINUX");
-        static const int UBUNTU_HASH = HashingUtils::HashString("UBUNTU");
-        static const int WINDOWS_SERVER_HASH = HashingUtils::HashString("WINDOWS_SERVER");
+        static constexpr int DEBIAN_HASH = HashingUtils::CompileTimeHashString("DEBIAN");
+        static constexpr int AMAZON_LINUX_HASH = HashingUtils::CompileTimeHashString("AMAZON_LINUX");
+        static constexpr int UBUNTU_HASH = HashingUtils::CompileTimeHashString("UBUNTU");
+        static constexpr int WINDOWS_SERVER_HASH = HashingUtils::CompileTimeHashString("WINDOWS_SERVER");
 
 
         PlatformType GetPlatformTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEBIAN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlatformType::DEBIAN;
-          }
-          else if (hashCode == AMAZON_LINUX_HASH)
-          {
-            return PlatformType::AMAZON_LINUX;
-          }
-          else if (hashCode == UBUNTU_HASH)
-          {
-            return PlatformType::UBUNTU;
-          }
-          else if (hashCode == WINDOWS_SERVER_HASH)
-          {
-            return PlatformType::WINDOWS_SERVER;
+          case DEBIAN_HASH:
+            if (name == "DEBIAN")
+            {
+              return PlatformType::DEBIAN;
+            }
+            break;
+          case AMAZON_LINUX_HASH:
+            if (name == "AMAZON_LINUX")
+            {
+              return PlatformType::AMAZON_LINUX;
+            }
+            break;
+          case UBUNTU_HASH:
+            if (name == "UBUNTU")
+            {
+              return PlatformType::UBUNTU;
+            }
+            break;
+          case WINDOWS_SERVER_HASH:
+            if (name == "WINDOWS_SERVER")
+            {
+              return PlatformType::WINDOWS_SERVER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return PlatformType::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformType(PlatformType enumValue)
+        const char* GetNameForPlatformType(PlatformType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
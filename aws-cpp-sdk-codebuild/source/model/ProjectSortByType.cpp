@@ -30,25 +30,37 @@ namespace Aws
       namespace ProjectSortByTypeMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int CREATED_TIME_HASH = HashingUtils::HashString("CREATED_TIME");
-        static const int LAST_MODIFIED_TIME_HASH = HashingUtils::HashString("LAST_MODIFIED_TIME");
+        static constexpr int NAME_HASH = HashingUtils::CompileTimeHashString("NAME");
+        static constexpr int CREATED_TIME_HASH = HashingUtils::CompileTimeHashString("CREATED_TIME");
+        static constexpr int LAST_MODIFIED_TIME_HASH = HashingUtils::CompileTimeHashString("LAST_MODIFIED_TIME");
 
 
         ProjectSortByType GetProjectSortByTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProjectSortByType::NAME;
-          }
-          else if (hashCode == CREATED_TIME_HASH)
-          {
-            return ProjectSortByType::CREATED_TIME;
-          }
-          else if (hashCode == LAST_MODIFIED_TIME_HASH)
-          {
-            return ProjectSortByType::LAST_MODIFIED_TIME;
+          case NAME_HASH:
+            if (name == "NAME")
+            {
+              return ProjectSortByType::NAME;
+            }
+            break;
+          case CREATED_TIME_HASH:
+            if (name == "CREATED_TIME")
+            {
+              return ProjectSortByType::CREATED_TIME;
+            }
+            break;
+          case LAST_MODIFIED_TIME_HASH:
+            if (name == "LAST_MODIFIED_TIME")
+            {
+              return ProjectSortByType::LAST_MODIFIED_TIME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ProjectSortByType::NOT_SET;
         }
 
-        Aws::String GetNameForProjectSortByType(ProjectSortByType enumValue)
+        const char* GetNameForProjectSortByType(ProjectSortByType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
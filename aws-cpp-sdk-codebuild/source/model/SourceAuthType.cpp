@@ -30,15 +30,23 @@ namespace Aws
       namespace SourceAuthTypeMapper
       {
 
-        static const int OAUTH_HASH = HashingUtils::HashString("OAUTH");
+        static constexpr int OAUTH_HASH = HashingUtils::CompileTimeHashString("OAUTH");
 
 
         SourceAuthType GetSourceAuthTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OAUTH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceAuthType::OAUTH;
+          case OAUTH_HASH:
+            if (name == "OAUTH")
+            {
+              return SourceAuthType::OAUTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return SourceAuthType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceAuthType(SourceAuthType enumValue)
+        const char* GetNameForSourceAuthType(SourceAuthType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int CODECOMMIT_HASH = HashingUtils::HashString("CODECOMMIT");
-        static const int CODEPIPELINE_HASH = HashingUtils::HashString("CODEPIPELINE");
-        static const int GITHUB_HASH = HashingUtils::HashString("GITHUB");
-        static const int S3_HASH = HashingUtils::HashString("S3");
-        static const int BITBUCKET_HASH = HashingUtils::HashString("BITBUCKET");
-        static const int GITHUB_ENTERPRISE_HASH = HashingUtils::HashString("GITHUB_ENTERPRISE");
+        static constexpr int CODECOMMIT_HASH = HashingUtils::CompileTimeHashString("CODECOMMIT");
+        static constexpr int CODEPIPELINE_HASH = HashingUtils::CompileTimeHashString("CODEPIPELINE");
+        static constexpr int GITHUB_HASH = HashingUtils::CompileTimeHashString("GITHUB");
+        static constexpr int S3_HASH = HashingUtils::CompileTimeHashString("S3");
+        static constexpr int BITBUCKET_HASH = HashingUtils::CompileTimeHashString("BITBUCKET");
+        static constexpr int GITHUB_ENTERPRISE_HASH = HashingUtils::CompileTimeHashString("GITHUB_ENTERPRISE");
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODECOMMIT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceType::CODECOMMIT;
-          }
-          else if (hashCode == CODEPIPELINE_HASH)
-          {
-            return SourceType::CODEPIPELINE;
-          }
-          else if (hashCode == GITHUB_HASH)
-          {
-            return SourceType::GITHUB;
-          }
-          else if (hashCode == S3_HASH)
-          {
-            return SourceType::S3;
-          }
-          else if (hashCode == BITBUCKET_HASH)
-          {
-            return SourceType::BITBUCKET;
-          }
-          else if (hashCode == GITHUB_ENTERPRISE_HASH)
-          {
-            return SourceType::GITHUB_ENTERPRISE;
+          case CODECOMMIT_HASH:
+            if (name == "CODECOMMIT")
+            {
+              return SourceType::CODECOMMIT;
+            }
+            break;
+          case CODEPIPELINE_HASH:
+            if (name == "CODEPIPELINE")
+            {
+              return SourceType::CODEPIPELINE;
+            }
+            break;
+          case GITHUB_HASH:
+            if (name == "GITHUB")
+            {
+              return SourceType::GITHUB;
+            }
+            break;
+          case S3_HASH:
+            if (name == "S3")
+            {
+              return SourceType::S3;
+            }
+            break;
+          case BITBUCKET_HASH:
+            if (name == "BITBUCKET")
+            {
+              return SourceType::BITBUCKET;
+            }
+            break;
+          case GITHUB_ENTERPRISE_HASH:
+            if (name == "GITHUB_ENTERPRISE")
+            {
+              return SourceType::GITHUB_ENTERPRISE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceType(SourceType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace StatusTypeMapper
       {
 
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int FAULT_HASH = HashingUtils::HashString("FAULT");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int FAULT_HASH = HashingUtils::CompileTimeHashString("FAULT");
+        static constexpr int TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("TIMED_OUT");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
 
 
         StatusType GetStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StatusType::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StatusType::FAILED;
-          }
-          else if (hashCode == FAULT_HASH)
-          {
-            return StatusType::FAULT;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return StatusType::TIMED_OUT;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return StatusType::IN_PROGRESS;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return StatusType::STOPPED;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return StatusType::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return StatusType::FAILED;
+            }
+            break;
+          case FAULT_HASH:
+            if (name == "FAULT")
+            {
+              return StatusType::FAULT;
+            }
+            break;
+          case TIMED_OUT_HASH:
+            if (name == "TIMED_OUT")
+            {
+              return StatusType::TIMED_OUT;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return StatusType::IN_PROGRESS;
+            }
+            break;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return StatusType::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return StatusType::NOT_SET;
         }
 
-        Aws::String GetNameForStatusType(StatusType enumValue)
+        const char* GetNameForStatusType(StatusType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace ChangeTypeEnumMapper
 {
 AWS_CODECOMMIT_API ChangeTypeEnum GetChangeTypeEnumForName(const Aws::String& name);
 
-AWS_CODECOMMIT_API Aws::String GetNameForChangeTypeEnum(ChangeTypeEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_CODECOMMIT_API const char* GetNameForChangeTypeEnum(ChangeTypeEnum value);
 } // namespace ChangeTypeEnumMapper
 } // namespace Model
 } // namespace CodeCommit
@@ -35,7 +35,8 @@ namespace FileModeTypeEnumMapper
 {
 AWS_CODECOMMIT_API FileModeTypeEnum GetFileModeTypeEnumForName(const Aws::String& name);
 
-AWS_CODECOMMIT_API Aws::String GetNameForFileModeTypeEnum(FileModeTypeEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_CODECOMMIT_API const char* GetNameForFileModeTypeEnum(FileModeTypeEnum value);
 } // namespace FileModeTypeEnumMapper
 } // namespace Model
 } // namespace CodeCommit
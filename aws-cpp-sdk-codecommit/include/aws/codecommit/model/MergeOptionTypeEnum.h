@@ -33,7 +33,8 @@ namespace MergeOptionTypeEnumMapper
 {
 AWS_CODECOMMIT_API MergeOptionTypeEnum GetMergeOptionTypeEnumForName(const Aws::String& name);
 
-AWS_CODECOMMIT_API Aws::String GetNameForMergeOptionTypeEnum(MergeOptionTypeEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_CODECOMMIT_API const char* GetNameForMergeOptionTypeEnum(MergeOptionTypeEnum value);
 } // namespace MergeOptionTypeEnumMapper
 } // namespace Model
 } // namespace CodeCommit
@@ -34,7 +34,8 @@ namespace OrderEnumMapper
 {
 AWS_CODECOMMIT_API OrderEnum GetOrderEnumForName(const Aws::String& name);
 
-AWS_CODECOMMIT_API Aws::String GetNameForOrderEnum(OrderEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_CODECOMMIT_API const char* GetNameForOrderEnum(OrderEnum value);
 } // namespace OrderEnumMapper
 } // namespace Model
 } // namespace CodeCommit
@@ -36,7 +36,8 @@ namespace PullRequestEventTypeMapper
 {
 AWS_CODECOMMIT_API PullRequestEventType GetPullRequestEventTypeForName(const Aws::String& name);
 
-AWS_CODECOMMIT_API Aws::String GetNameForPullRequestEventType(PullRequestEventType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODECOMMIT_API const char* GetNameForPullRequestEventType(PullRequestEventType value);
 } // namespace PullRequestEventTypeMapper
 } // namespace Model
 } // namespace CodeCommit
@@ -34,7 +34,8 @@ namespace PullRequestStatusEnumMapper
 {
 AWS_CODECOMMIT_API PullRequestStatusEnum GetPullRequestStatusEnumForName(const Aws::String& name);
 
-AWS_CODECOMMIT_API Aws::String GetNameForPullRequestStatusEnum(PullRequestStatusEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_CODECOMMIT_API const char* GetNameForPullRequestStatusEnum(PullRequestStatusEnum value);
 } // namespace PullRequestStatusEnumMapper
 } // namespace Model
 } // namespace CodeCommit
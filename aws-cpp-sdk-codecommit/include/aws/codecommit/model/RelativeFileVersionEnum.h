@@ -34,7 +34,8 @@ namespace RelativeFileVersionEnumMapper
 {
 AWS_CODECOMMIT_API RelativeFileVersionEnum GetRelativeFileVersionEnumForName(const Aws::String& name);
 
-AWS_CODECOMMIT_API Aws::String GetNameForRelativeFileVersionEnum(RelativeFileVersionEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_CODECOMMIT_API const char* GetNameForRelativeFileVersionEnum(RelativeFileVersionEnum value);
 } // namespace RelativeFileVersionEnumMapper
 } // namespace Model
 } // namespace CodeCommit
@@ -36,7 +36,8 @@ namespace RepositoryTriggerEventEnumMapper
 {
 AWS_CODECOMMIT_API RepositoryTriggerEventEnum GetRepositoryTriggerEventEnumForName(const Aws::String& name);
 
-AWS_CODECOMMIT_API Aws::String GetNameForRepositoryTriggerEventEnum(RepositoryTriggerEventEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_CODECOMMIT_API const char* GetNameForRepositoryTriggerEventEnum(RepositoryTriggerEventEnum value);
 } // namespace RepositoryTriggerEventEnumMapper
 } // namespace Model
 } // namespace CodeCommit
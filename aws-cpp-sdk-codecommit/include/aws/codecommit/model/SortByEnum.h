@@ -34,7 +34,8 @@ namespace SortByEnumMapper
 {
 AWS_CODECOMMIT_API SortByEnum GetSortByEnumForName(const Aws::String& name);
 
-AWS_CODECOMMIT_API Aws::String GetNameForSortByEnum(SortByEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_CODECOMMIT_API const char* GetNameForSortByEnum(SortByEnum value);
 } // namespace SortByEnumMapper
 } // namespace Model
 } // namespace CodeCommit
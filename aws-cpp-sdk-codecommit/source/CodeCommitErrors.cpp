@@ -28,116 +28,116 @@ namespace CodeCommit
 namespace CodeCommitErrorMapper
 {
 
-static const int DIRECTORY_NAME_CONFLICTS_WITH_FILE_NAME_HASH = HashingUtils::HashString("DirectoryNameConflictsWithFileNameException");
-static const int BLOB_ID_REQUIRED_HASH = HashingUtils::HashString("BlobIdRequiredException");
-static const int MULTIPLE_REPOSITORIES_IN_PULL_REQUEST_HASH = HashingUtils::HashString("MultipleRepositoriesInPullRequestException");
-static const int INVALID_BLOB_ID_HASH = HashingUtils::HashString("InvalidBlobIdException");
-static const int REPOSITORY_NAMES_REQUIRED_HASH = HashingUtils::HashString("RepositoryNamesRequiredException");
-static const int INVALID_CONTINUATION_TOKEN_HASH = HashingUtils::HashString("InvalidContinuationTokenException");
-static const int MERGE_OPTION_REQUIRED_HASH = HashingUtils::HashString("MergeOptionRequiredException");
-static const int ENCRYPTION_KEY_ACCESS_DENIED_HASH = HashingUtils::HashString("EncryptionKeyAccessDeniedException");
-static const int CLIENT_REQUEST_TOKEN_REQUIRED_HASH = HashingUtils::HashString("ClientRequestTokenRequiredException");
-static const int DEFAULT_BRANCH_CANNOT_BE_DELETED_HASH = HashingUtils::HashString("DefaultBranchCannotBeDeletedException");
-static const int INVALID_PULL_REQUEST_ID_HASH = HashingUtils::HashString("InvalidPullRequestIdException");
-static const int BEFORE_COMMIT_ID_AND_AFTER_COMMIT_ID_ARE_SAME_HASH = HashingUtils::HashString("BeforeCommitIdAndAfterCommitIdAreSameException");
-static const int PULL_REQUEST_ID_REQUIRED_HASH = HashingUtils::HashString("PullRequestIdRequiredException");
-static const int MAXIMUM_BRANCHES_EXCEEDED_HASH = HashingUtils::HashString("MaximumBranchesExceededException");
-static const int REPOSITORY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("RepositoryLimitExceededException");
-static const int REPOSITORY_TRIGGER_DESTINATION_ARN_REQUIRED_HASH = HashingUtils::HashString("RepositoryTriggerDestinationArnRequiredException");
-static const int TITLE_REQUIRED_HASH = HashingUtils::HashString("TitleRequiredException");
-static const int INVALID_PULL_REQUEST_STATUS_UPDATE_HASH = HashingUtils::HashString("InvalidPullRequestStatusUpdateException");
-static const int REPOSITORY_TRIGGERS_LIST_REQUIRED_HASH = HashingUtils::HashString("RepositoryTriggersListRequiredException");
-static const int BRANCH_NAME_EXISTS_HASH = HashingUtils::HashString("BranchNameExistsException");
-static const int INVALID_COMMENT_ID_HASH = HashingUtils::HashString("InvalidCommentIdException");
-static const int COMMENT_DELETED_HASH = HashingUtils::HashString("CommentDeletedException");
-static const int COMMIT_MESSAGE_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("CommitMessageLengthExceededException");
-static const int INVALID_PULL_REQUEST_EVENT_TYPE_HASH = HashingUtils::HashString("InvalidPullRequestEventTypeException");
-static const int INVALID_COMMIT_HASH = HashingUtils::HashString("InvalidCommitException");
-static const int INVALID_COMMIT_ID_HASH = HashingUtils::HashString("InvalidCommitIdException");
-static const int INVALID_REPOSITORY_DESCRIPTION_HASH = HashingUtils::HashString("InvalidRepositoryDescriptionException");
-static const int INVALID_ACTOR_ARN_HASH = HashingUtils::HashString("InvalidActorArnException");
-static const int COMMIT_DOES_NOT_EXIST_HASH = HashingUtils::HashString("CommitDoesNotExistException");
-static const int COMMENT_DOES_NOT_EXIST_HASH = HashingUtils::HashString("CommentDoesNotExistException");
-static const int BRANCH_DOES_NOT_EXIST_HASH = HashingUtils::HashString("BranchDoesNotExistException");
-static const int IDEMPOTENCY_PARAMETER_MISMATCH_HASH = HashingUtils::HashString("IdempotencyParameterMismatchException");
-static const int INVALID_REPOSITORY_TRIGGER_EVENTS_HASH = HashingUtils::HashString("InvalidRepositoryTriggerEventsException");
-static const int BRANCH_NAME_REQUIRED_HASH = HashingUtils::HashString("BranchNameRequiredException");
-static const int COMMENT_ID_REQUIRED_HASH = HashingUtils::HashString("CommentIdRequiredException");
-static const int INVALID_CLIENT_REQUEST_TOKEN_HASH = HashingUtils::HashString("InvalidClientRequestTokenException");
-static const int REPOSITORY_NOT_ASSOCIATED_WITH_PULL_REQUEST_HASH = HashingUtils::HashString("RepositoryNotAssociatedWithPullRequestException");
-static const int INVALID_REPOSITORY_TRIGGER_NAME_HASH = HashingUtils::HashString("InvalidRepositoryTriggerNameException");
-static const int INVALID_DESCRIPTION_HASH = HashingUtils::HashString("InvalidDescriptionException");
-static const int INVALID_SORT_BY_HASH = HashingUtils::HashString("InvalidSortByException");
-static const int MAXIMUM_REPOSITORY_NAMES_EXCEEDED_HASH = HashingUtils::HashString("MaximumRepositoryNamesExceededException");
-static const int INVALID_TARGET_HASH = HashingUtils::HashString("InvalidTargetException");
-static const int PARENT_COMMIT_ID_OUTDATED_HASH = HashingUtils::HashString("ParentCommitIdOutdatedException");
-static const int COMMIT_REQUIRED_HASH = HashingUtils::HashString("CommitRequiredException");
-static const int COMMENT_CONTENT_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("CommentContentSizeLimitExceededException");
-static const int REPOSITORY_DOES_NOT_EXIST_HASH = HashingUtils::HashString("RepositoryDoesNotExistException");
-static const int MAXIMUM_OPEN_PULL_REQUESTS_EXCEEDED_HASH = HashingUtils::HashString("MaximumOpenPullRequestsExceededException");
-static const int REFERENCE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ReferenceDoesNotExistException");
-static const int PATH_DOES_NOT_EXIST_HASH = HashingUtils::HashString("PathDoesNotExistException");
-static const int TIP_OF_SOURCE_REFERENCE_IS_DIFFERENT_HASH = HashingUtils::HashString("TipOfSourceReferenceIsDifferentException");
-static const int TARGETS_REQUIRED_HASH = HashingUtils::HashString("TargetsRequiredException");
-static const int FILE_CONTENT_REQUIRED_HASH = HashingUtils::HashString("FileContentRequiredException");
-static const int PULL_REQUEST_DOES_NOT_EXIST_HASH = HashingUtils::HashString("PullRequestDoesNotExistException");
-static const int BRANCH_NAME_IS_TAG_NAME_HASH = HashingUtils::HashString("BranchNameIsTagNameException");
-static const int COMMIT_ID_REQUIRED_HASH = HashingUtils::HashString("CommitIdRequiredException");
-static const int ENCRYPTION_INTEGRITY_CHECKS_FAILED_HASH = HashingUtils::HashString("EncryptionIntegrityChecksFailedException");
-static const int PARENT_COMMIT_ID_REQUIRED_HASH = HashingUtils::HashString("ParentCommitIdRequiredException");
-static const int REPOSITORY_TRIGGER_EVENTS_LIST_REQUIRED_HASH = HashingUtils::HashString("RepositoryTriggerEventsListRequiredException");
-static const int INVALID_REPOSITORY_TRIGGER_DESTINATION_ARN_HASH = HashingUtils::HashString("InvalidRepositoryTriggerDestinationArnException");
-static const int INVALID_ORDER_HASH = HashingUtils::HashString("InvalidOrderException");
-static const int INVALID_REPOSITORY_TRIGGER_CUSTOM_DATA_HASH = HashingUtils::HashString("InvalidRepositoryTriggerCustomDataException");
-static const int PULL_REQUEST_ALREADY_CLOSED_HASH = HashingUtils::HashString("PullRequestAlreadyClosedException");
-static const int INVALID_EMAIL_HASH = HashingUtils::HashString("InvalidEmailException");
-static const int INVALID_FILE_MODE_HASH = HashingUtils::HashString("InvalidFileModeException");
-static const int PULL_REQUEST_STATUS_REQUIRED_HASH = HashingUtils::HashString("PullRequestStatusRequiredException");
-static const int PATH_REQUIRED_HASH = HashingUtils::HashString("PathRequiredException");
-static const int INVALID_REPOSITORY_TRIGGER_BRANCH_NAME_HASH = HashingUtils::HashString("InvalidRepositoryTriggerBranchNameException");
-static const int INVALID_SOURCE_COMMIT_SPECIFIER_HASH = HashingUtils::HashString("InvalidSourceCommitSpecifierException");
-static const int INVALID_MERGE_OPTION_HASH = HashingUtils::HashString("InvalidMergeOptionException");
-static const int ENCRYPTION_KEY_UNAVAILABLE_HASH = HashingUtils::HashString("EncryptionKeyUnavailableException");
-static const int REPOSITORY_NAME_REQUIRED_HASH = HashingUtils::HashString("RepositoryNameRequiredException");
-static const int INVALID_REPOSITORY_TRIGGER_REGION_HASH = HashingUtils::HashString("InvalidRepositoryTriggerRegionException");
-static const int INVALID_FILE_LOCATION_HASH = HashingUtils::HashString("InvalidFileLocationException");
-static const int REFERENCE_NAME_REQUIRED_HASH = HashingUtils::HashString("ReferenceNameRequiredException");
-static const int INVALID_BRANCH_NAME_HASH = HashingUtils::HashString("InvalidBranchNameException");
-static const int SAME_FILE_CONTENT_HASH = HashingUtils::HashString("SameFileContentException");
-static const int NAME_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("NameLengthExceededException");
-static const int REPOSITORY_NAME_EXISTS_HASH = HashingUtils::HashString("RepositoryNameExistsException");
-static const int PARENT_COMMIT_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ParentCommitDoesNotExistException");
-static const int COMMENT_NOT_CREATED_BY_CALLER_HASH = HashingUtils::HashString("CommentNotCreatedByCallerException");
-static const int ENCRYPTION_KEY_DISABLED_HASH = HashingUtils::HashString("EncryptionKeyDisabledException");
-static const int INVALID_MAX_RESULTS_HASH = HashingUtils::HashString("InvalidMaxResultsException");
-static const int ENCRYPTION_KEY_NOT_FOUND_HASH = HashingUtils::HashString("EncryptionKeyNotFoundException");
-static const int REFERENCE_TYPE_NOT_SUPPORTED_HASH = HashingUtils::HashString("ReferenceTypeNotSupportedException");
-static const int INVALID_PATH_HASH = HashingUtils::HashString("InvalidPathException");
-static const int FILE_TOO_LARGE_HASH = HashingUtils::HashString("FileTooLargeException");
-static const int MANUAL_MERGE_REQUIRED_HASH = HashingUtils::HashString("ManualMergeRequiredException");
-static const int INVALID_RELATIVE_FILE_VERSION_ENUM_HASH = HashingUtils::HashString("InvalidRelativeFileVersionEnumException");
-static const int INVALID_REFERENCE_NAME_HASH = HashingUtils::HashString("InvalidReferenceNameException");
-static const int BLOB_ID_DOES_NOT_EXIST_HASH = HashingUtils::HashString("BlobIdDoesNotExistException");
-static const int INVALID_TITLE_HASH = HashingUtils::HashString("InvalidTitleException");
-static const int SOURCE_AND_DESTINATION_ARE_SAME_HASH = HashingUtils::HashString("SourceAndDestinationAreSameException");
-static const int REPOSITORY_TRIGGER_NAME_REQUIRED_HASH = HashingUtils::HashString("RepositoryTriggerNameRequiredException");
-static const int INVALID_PULL_REQUEST_STATUS_HASH = HashingUtils::HashString("InvalidPullRequestStatusException");
-static const int AUTHOR_DOES_NOT_EXIST_HASH = HashingUtils::HashString("AuthorDoesNotExistException");
-static const int FILE_NAME_CONFLICTS_WITH_DIRECTORY_NAME_HASH = HashingUtils::HashString("FileNameConflictsWithDirectoryNameException");
-static const int INVALID_FILE_POSITION_HASH = HashingUtils::HashString("InvalidFilePositionException");
-static const int INVALID_REPOSITORY_NAME_HASH = HashingUtils::HashString("InvalidRepositoryNameException");
-static const int TIPS_DIVERGENCE_EXCEEDED_HASH = HashingUtils::HashString("TipsDivergenceExceededException");
-static const int INVALID_PARENT_COMMIT_ID_HASH = HashingUtils::HashString("InvalidParentCommitIdException");
-static const int TARGET_REQUIRED_HASH = HashingUtils::HashString("TargetRequiredException");
-static const int INVALID_AUTHOR_ARN_HASH = HashingUtils::HashString("InvalidAuthorArnException");
-static const int FILE_CONTENT_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("FileContentSizeLimitExceededException");
-static const int COMMENT_CONTENT_REQUIRED_HASH = HashingUtils::HashString("CommentContentRequiredException");
-static const int INVALID_TARGETS_HASH = HashingUtils::HashString("InvalidTargetsException");
-static const int INVALID_DESTINATION_COMMIT_SPECIFIER_HASH = HashingUtils::HashString("InvalidDestinationCommitSpecifierException");
-static const int COMMIT_ID_DOES_NOT_EXIST_HASH = HashingUtils::HashString("CommitIdDoesNotExistException");
-static const int ACTOR_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ActorDoesNotExistException");
-static const int MAXIMUM_REPOSITORY_TRIGGERS_EXCEEDED_HASH = HashingUtils::HashString("MaximumRepositoryTriggersExceededException");
-static const int REPOSITORY_TRIGGER_BRANCH_NAME_LIST_REQUIRED_HASH = HashingUtils::HashString("RepositoryTriggerBranchNameListRequiredException");
+static constexpr int DIRECTORY_NAME_CONFLICTS_WITH_FILE_NAME_HASH = HashingUtils::CompileTimeHashString("DirectoryNameConflictsWithFileNameException");
+static constexpr int BLOB_ID_REQUIRED_HASH = HashingUtils::CompileTimeHashString("BlobIdRequiredException");
+static constexpr int MULTIPLE_REPOSITORIES_IN_PULL_REQUEST_HASH = HashingUtils::CompileTimeHashString("MultipleRepositoriesInPullRequestException");
+static constexpr int INVALID_BLOB_ID_HASH = HashingUtils::CompileTimeHashString("InvalidBlobIdException");
+static constexpr int REPOSITORY_NAMES_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RepositoryNamesRequiredException");
+static constexpr int INVALID_CONTINUATION_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidContinuationTokenException");
+static constexpr int MERGE_OPTION_REQUIRED_HASH = HashingUtils::CompileTimeHashString("MergeOptionRequiredException");
+static constexpr int ENCRYPTION_KEY_ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("EncryptionKeyAccessDeniedException");
+static constexpr int CLIENT_REQUEST_TOKEN_REQUIRED_HASH = HashingUtils::CompileTimeHashString("ClientRequestTokenRequiredException");
+static constexpr int DEFAULT_BRANCH_CANNOT_BE_DELETED_HASH = HashingUtils::CompileTimeHashString("DefaultBranchCannotBeDeletedException");
+static constexpr int INVALID_PULL_REQUEST_ID_HASH = HashingUtils::CompileTimeHashString("InvalidPullRequestIdException");
+static constexpr int BEFORE_COMMIT_ID_AND_AFTER_COMMIT_ID_ARE_SAME_HASH = HashingUtils::CompileTimeHashString("BeforeCommitIdAndAfterCommitIdAreSameException");
+static constexpr int PULL_REQUEST_ID_REQUIRED_HASH = HashingUtils::CompileTimeHashString("PullRequestIdRequiredException");
+static constexpr int MAXIMUM_BRANCHES_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaximumBranchesExceededException");
+static constexpr int REPOSITORY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("RepositoryLimitExceededException");
+static constexpr int REPOSITORY_TRIGGER_DESTINATION_ARN_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RepositoryTriggerDestinationArnRequiredException");
+static constexpr int TITLE_REQUIRED_HASH = HashingUtils::CompileTimeHashString("TitleRequiredException");
+static constexpr int INVALID_PULL_REQUEST_STATUS_UPDATE_HASH = HashingUtils::CompileTimeHashString("InvalidPullRequestStatusUpdateException");
+static constexpr int REPOSITORY_TRIGGERS_LIST_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RepositoryTriggersListRequiredException");
+static constexpr int BRANCH_NAME_EXISTS_HASH = HashingUtils::CompileTimeHashString("BranchNameExistsException");
+static constexpr int INVALID_COMMENT_ID_HASH = HashingUtils::CompileTimeHashString("InvalidCommentIdException");
+static constexpr int COMMENT_DELETED_HASH = HashingUtils::CompileTimeHashString("CommentDeletedException");
+static constexpr int COMMIT_MESSAGE_LENGTH_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CommitMessageLengthExceededException");
+static constexpr int INVALID_PULL_REQUEST_EVENT_TYPE_HASH = HashingUtils::CompileTimeHashString("InvalidPullRequestEventTypeException");
+static constexpr int INVALID_COMMIT_HASH = HashingUtils::CompileTimeHashString("InvalidCommitException");
+static constexpr int INVALID_COMMIT_ID_HASH = HashingUtils::CompileTimeHashString("InvalidCommitIdException");
+static constexpr int INVALID_REPOSITORY_DESCRIPTION_HASH = HashingUtils::CompileTimeHashString("InvalidRepositoryDescriptionException");
+static constexpr int INVALID_ACTOR_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidActorArnException");
+static constexpr int COMMIT_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("CommitDoesNotExistException");
+static constexpr int COMMENT_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("CommentDoesNotExistException");
+static constexpr int BRANCH_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("BranchDoesNotExistException");
+static constexpr int IDEMPOTENCY_PARAMETER_MISMATCH_HASH = HashingUtils::CompileTimeHashString("IdempotencyParameterMismatchException");
+static constexpr int INVALID_REPOSITORY_TRIGGER_EVENTS_HASH = HashingUtils::CompileTimeHashString("InvalidRepositoryTriggerEventsException");
+static constexpr int BRANCH_NAME_REQUIRED_HASH = HashingUtils::CompileTimeHashString("BranchNameRequiredException");
+static constexpr int COMMENT_ID_REQUIRED_HASH = HashingUtils::CompileTimeHashString("CommentIdRequiredException");
+static constexpr int INVALID_CLIENT_REQUEST_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidClientRequestTokenException");
+static constexpr int REPOSITORY_NOT_ASSOCIATED_WITH_PULL_REQUEST_HASH = HashingUtils::CompileTimeHashString("RepositoryNotAssociatedWithPullRequestException");
+static constexpr int INVALID_REPOSITORY_TRIGGER_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidRepositoryTriggerNameException");
+static constexpr int INVALID_DESCRIPTION_HASH = HashingUtils::CompileTimeHashString("InvalidDescriptionException");
+static constexpr int INVALID_SORT_BY_HASH = HashingUtils::CompileTimeHashString("InvalidSortByException");
+static constexpr int MAXIMUM_REPOSITORY_NAMES_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaximumRepositoryNamesExceededException");
+static constexpr int INVALID_TARGET_HASH = HashingUtils::CompileTimeHashString("InvalidTargetException");
+static constexpr int PARENT_COMMIT_ID_OUTDATED_HASH = HashingUtils::CompileTimeHashString("ParentCommitIdOutdatedException");
+static constexpr int COMMIT_REQUIRED_HASH = HashingUtils::CompileTimeHashString("CommitRequiredException");
+static constexpr int COMMENT_CONTENT_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CommentContentSizeLimitExceededException");
+static constexpr int REPOSITORY_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("RepositoryDoesNotExistException");
+static constexpr int MAXIMUM_OPEN_PULL_REQUESTS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaximumOpenPullRequestsExceededException");
+static constexpr int REFERENCE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ReferenceDoesNotExistException");
+static constexpr int PATH_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("PathDoesNotExistException");
+static constexpr int TIP_OF_SOURCE_REFERENCE_IS_DIFFERENT_HASH = HashingUtils::CompileTimeHashString("TipOfSourceReferenceIsDifferentException");
+static constexpr int TARGETS_REQUIRED_HASH = HashingUtils::CompileTimeHashString("TargetsRequiredException");
+static constexpr int FILE_CONTENT_REQUIRED_HASH = HashingUtils::CompileTimeHashString("FileContentRequiredException");
+static constexpr int PULL_REQUEST_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("PullRequestDoesNotExistException");
+static constexpr int BRANCH_NAME_IS_TAG_NAME_HASH = HashingUtils::CompileTimeHashString("BranchNameIsTagNameException");
+static constexpr int COMMIT_ID_REQUIRED_HASH = HashingUtils::CompileTimeHashString("CommitIdRequiredException");
+static constexpr int ENCRYPTION_INTEGRITY_CHECKS_FAILED_HASH = HashingUtils::CompileTimeHashString("EncryptionIntegrityChecksFailedException");
+static constexpr int PARENT_COMMIT_ID_REQUIRED_HASH = HashingUtils::CompileTimeHashString("ParentCommitIdRequiredException");
+static constexpr int REPOSITORY_TRIGGER_EVENTS_LIST_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RepositoryTriggerEventsListRequiredException");
+static constexpr int INVALID_REPOSITORY_TRIGGER_DESTINATION_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidRepositoryTriggerDestinationArnException");
+static constexpr int INVALID_ORDER_HASH = HashingUtils::CompileTimeHashString("InvalidOrderException");
+static constexpr int INVALID_REPOSITORY_TRIGGER_CUSTOM_DATA_HASH = HashingUtils::CompileTimeHashString("InvalidRepositoryTriggerCustomDataException");
+static constexpr int PULL_REQUEST_ALREADY_CLOSED_HASH = HashingUtils::CompileTimeHashString("PullRequestAlreadyClosedException");
+static constexpr int INVALID_EMAIL_HASH = HashingUtils::CompileTimeHashString("InvalidEmailException");
+static constexpr int INVALID_FILE_MODE_HASH = HashingUtils::CompileTimeHashString("InvalidFileModeException");
+static constexpr int PULL_REQUEST_STATUS_REQUIRED_HASH = HashingUtils::CompileTimeHashString("PullRequestStatusRequiredException");
+static constexpr int PATH_REQUIRED_HASH = HashingUtils::CompileTimeHashString("PathRequiredException");
+static constexpr int INVALID_REPOSITORY_TRIGGER_BRANCH_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidRepositoryTriggerBranchNameException");
+static constexpr int INVALID_SOURCE_COMMIT_SPECIFIER_HASH = HashingUtils::CompileTimeHashString("InvalidSourceCommitSpecifierException");
+static constexpr int INVALID_MERGE_OPTION_HASH = HashingUtils::CompileTimeHashString("InvalidMergeOptionException");
+static constexpr int ENCRYPTION_KEY_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("EncryptionKeyUnavailableException");
+static constexpr int REPOSITORY_NAME_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RepositoryNameRequiredException");
+static constexpr int INVALID_REPOSITORY_TRIGGER_REGION_HASH = HashingUtils::CompileTimeHashString("InvalidRepositoryTriggerRegionException");
+static constexpr int INVALID_FILE_LOCATION_HASH = HashingUtils::CompileTimeHashString("InvalidFileLocationException");
+static constexpr int REFERENCE_NAME_REQUIRED_HASH = HashingUtils::CompileTimeHashString("ReferenceNameRequiredException");
+static constexpr int INVALID_BRANCH_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidBranchNameException");
+static constexpr int SAME_FILE_CONTENT_HASH = HashingUtils::CompileTimeHashString("SameFileContentException");
+static constexpr int NAME_LENGTH_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NameLengthExceededException");
+static constexpr int REPOSITORY_NAME_EXISTS_HASH = HashingUtils::CompileTimeHashString("RepositoryNameExistsException");
+static constexpr int PARENT_COMMIT_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ParentCommitDoesNotExistException");
+static constexpr int COMMENT_NOT_CREATED_BY_CALLER_HASH = HashingUtils::CompileTimeHashString("CommentNotCreatedByCallerException");
+static constexpr int ENCRYPTION_KEY_DISABLED_HASH = HashingUtils::CompileTimeHashString("EncryptionKeyDisabledException");
+static constexpr int INVALID_MAX_RESULTS_HASH = HashingUtils::CompileTimeHashString("InvalidMaxResultsException");
+static constexpr int ENCRYPTION_KEY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("EncryptionKeyNotFoundException");
+static constexpr int REFERENCE_TYPE_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("ReferenceTypeNotSupportedException");
+static constexpr int INVALID_PATH_HASH = HashingUtils::CompileTimeHashString("InvalidPathException");
+static constexpr int FILE_TOO_LARGE_HASH = HashingUtils::CompileTimeHashString("FileTooLargeException");
+static constexpr int MANUAL_MERGE_REQUIRED_HASH = HashingUtils::CompileTimeHashString("ManualMergeRequiredException");
+static constexpr int INVALID_RELATIVE_FILE_VERSION_ENUM_HASH = HashingUtils::CompileTimeHashString("InvalidRelativeFileVersionEnumException");
+static constexpr int INVALID_REFERENCE_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidReferenceNameException");
+static constexpr int BLOB_ID_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("BlobIdDoesNotExistException");
+static constexpr int INVALID_TITLE_HASH = HashingUtils::CompileTimeHashString("InvalidTitleException");
+static constexpr int SOURCE_AND_DESTINATION_ARE_SAME_HASH = HashingUtils::CompileTimeHashString("SourceAndDestinationAreSameException");
+static constexpr int REPOSITORY_TRIGGER_NAME_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RepositoryTriggerNameRequiredException");
+static constexpr int INVALID_PULL_REQUEST_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidPullRequestStatusException");
+static constexpr int AUTHOR_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("AuthorDoesNotExistException");
+static constexpr int FILE_NAME_CONFLICTS_WITH_DIRECTORY_NAME_HASH = HashingUtils::CompileTimeHashString("FileNameConflictsWithDirectoryNameException");
+static constexpr int INVALID_FILE_POSITION_HASH = HashingUtils::CompileTimeHashString("InvalidFilePositionException");
+static constexpr int INVALID_REPOSITORY_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidRepositoryNameException");
+static constexpr int TIPS_DIVERGENCE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TipsDivergenceExceededException");
+static constexpr int INVALID_PARENT_COMMIT_ID_HASH = HashingUtils::CompileTimeHashString("InvalidParentCommitIdException");
+static constexpr int TARGET_REQUIRED_HASH = HashingUtils::CompileTimeHashString("TargetRequiredException");
+static constexpr int INVALID_AUTHOR_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidAuthorArnException");
+static constexpr int FILE_CONTENT_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("FileContentSizeLimitExceededException");
+static constexpr int COMMENT_CONTENT_REQUIRED_HASH = HashingUtils::CompileTimeHashString("CommentContentRequiredException");
+static constexpr int INVALID_TARGETS_HASH = HashingUtils::CompileTimeHashString("InvalidTargetsException");
+static constexpr int INVALID_DESTINATION_COMMIT_SPECIFIER_HASH = HashingUtils::CompileTimeHashString("InvalidDestinationCommitSpecifierException");
+static constexpr int COMMIT_ID_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("CommitIdDoesNotExistException");
+static constexpr int ACTOR_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ActorDoesNotExistException");
+static constexpr int MAXIMUM_REPOSITORY_TRIGGERS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaximumRepositoryTriggersExceededException");
+static constexpr int REPOSITORY_TRIGGER_BRANCH_NAME_LIST_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RepositoryTriggerBranchNameListRequiredException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace ChangeTypeEnumMapper
       {
 
-        static const int A_HASH = HashingUtils::HashString("A");
-        static const int M_HASH = HashingUtils::HashString("M");
-        static const int D_HASH = HashingUtils::HashString("D");
+        static constexpr int A_HASH = HashingUtils::CompileTimeHashString("A");
+        static constexpr int M_HASH = HashingUtils::CompileTimeHashString("M");
+        static constexpr int D_HASH = HashingUtils::CompileTimeHashString("D");
 
 
         ChangeTypeEnum GetChangeTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == A_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeTypeEnum::A;
-          }
-          else if (hashCode == M_HASH)
-          {
-            return ChangeTypeEnum::M;
-          }
-          else if (hashCode == D_HASH)
-          {
-            return ChangeTypeEnum::D;
+          case A_HASH:
+            if (name == "A")
+            {
+              return ChangeTypeEnum::A;
+            }
+            break;
+          case M_HASH:
+            if (name == "M")
+            {
+              return ChangeTypeEnum::M;
+            }
+            break;
+          case D_HASH:
+            if (name == "D")
+            {
+              return ChangeTypeEnum::D;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ChangeTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForChangeTypeEnum(ChangeTypeEnum enumValue)
+        const char* GetNameForChangeTypeEnum(ChangeTypeEnum enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
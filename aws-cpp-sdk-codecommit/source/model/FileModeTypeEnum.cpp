@@ -30,25 +30,37 @@ namespace Aws
       namespace FileModeTypeEnumMapper
       {
 
-        static const int EXECUTABLE_HASH = HashingUtils::HashString("EXECUTABLE");
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
-        static const int SYMLINK_HASH = HashingUtils::HashString("SYMLINK");
+        static constexpr int EXECUTABLE_HASH = HashingUtils::CompileTimeHashString("EXECUTABLE");
+        static constexpr int NORMAL_HASH = HashingUtils::CompileTimeHashString("NORMAL");
+        static constexpr int SYMLINK_HASH = HashingUtils::CompileTimeHashString("SYMLINK");
 
 
         FileModeTypeEnum GetFileModeTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXECUTABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FileModeTypeEnum::EXECUTABLE;
-          }
-          else if (hashCode == NORMAL_HASH)
-          {
-            return FileModeTypeEnum::NORMAL;
-          }
-          else if (hashCode == SYMLINK_HASH)
-          {
-            return FileModeTypeEnum::SYMLINK;
+          case EXECUTABLE_HASH:
+            if (name == "EXECUTABLE")
+            {
+              return FileModeTypeEnum::EXECUTABLE;
+            }
+            break;
+          case NORMAL_HASH:
+            if (name == "NORMAL")
+            {
+              return FileModeTypeEnum::NORMAL;
+            }
+            break;
+          case SYMLINK_HASH:
+            if (name == "SYMLINK")
+            {
+              return FileModeTypeEnum::SYMLINK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FileModeTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForFileModeTypeEnum(FileModeTypeEnum enumValue)
+        const char* GetNameForFileModeTypeEnum(FileModeTypeEnum enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
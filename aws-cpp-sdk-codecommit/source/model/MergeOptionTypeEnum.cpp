@@ -30,15 +30,23 @@ namespace Aws
       namespace MergeOptionTypeEnumMapper
       {
 
-        static const int FAST_FORWARD_MERGE_HASH = HashingUtils::HashString("FAST_FORWARD_MERGE");
+        static constexpr int FAST_FORWARD_MERGE_HASH = HashingUtils::CompileTimeHashString("FAST_FORWARD_MERGE");
 
 
         MergeOptionTypeEnum GetMergeOptionTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAST_FORWARD_MERGE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MergeOptionTypeEnum::FAST_FORWARD_MERGE;
+          case FAST_FORWARD_MERGE_HASH:
+            if (name == "FAST_FORWARD_MERGE")
+            {
+              return MergeOptionTypeEnum::FAST_FORWARD_MERGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return MergeOptionTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForMergeOptionTypeEnum(MergeOptionTypeEnum enumValue)
+        const char* GetNameForMergeOptionTypeEnum(MergeOptionTypeEnum enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace OrderEnumMapper
       {
 
-        static const int ascending_HASH = HashingUtils::HashString("ascending");
-        static const int descending_HASH = HashingUtils::HashString("descending");
+        static constexpr int ascending_HASH = HashingUtils::CompileTimeHashString("ascending");
+        static constexpr int descending_HASH = HashingUtils::CompileTimeHashString("descending");
 
 
         OrderEnum GetOrderEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ascending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OrderEnum::ascending;
-          }
-          else if (hashCode == descending_HASH)
-          {
-            return OrderEnum::descending;
+          case ascending_HASH:
+            if (name == "ascending")
+            {
+              return OrderEnum::ascending;
+            }
+            break;
+          case descending_HASH:
+            if (name == "descending")
+            {
+              return OrderEnum::descending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OrderEnum::NOT_SET;
         }
 
-        Aws::String GetNameForOrderEnum(OrderEnum enumValue)
+        const char* GetNameForOrderEnum(OrderEnum enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
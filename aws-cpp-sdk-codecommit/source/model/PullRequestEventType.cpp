@@ -30,30 +30,44 @@ namespace Aws
       namespace PullRequestEventTypeMapper
       {
 
-        static const int PULL_REQUEST_CREATED_HASH = HashingUtils::HashString("PULL_REQUEST_CREATED");
-        static const int PULL_REQUEST_STATUS_CHANGED_HASH = HashingUtils::HashString("PULL_REQUEST_STATUS_CHANGED");
-        static const int PULL_REQUEST_SOURCE_REFERENCE_UPDATED_HASH = HashingUtils::HashString("PULL_REQUEST_SOURCE_REFERENCE_UPDATED");
-        static const int PULL_REQUEST_MERGE_STATE_CHANGED_HASH = HashingUtils::HashString("PULL_REQUEST_MERGE_STATE_CHANGED");
+        static constexpr int PULL_REQUEST_CREATED_HASH = HashingUtils::CompileTimeHashString("PULL_REQUEST_CREATED");
+        static constexpr int PULL_REQUEST_STATUS_CHANGED_HASH = HashingUtils::CompileTimeHashString("PULL_REQUEST_STATUS_CHANGED");
+        static constexpr int PULL_REQUEST_SOURCE_REFERENCE_UPDATED_HASH = HashingUtils::CompileTimeHashString("PULL_REQUEST_SOURCE_REFERENCE_UPDATED");
+        static constexpr int PULL_REQUEST_MERGE_STATE_CHANGED_HASH = HashingUtils::CompileTimeHashString("PULL_REQUEST_MERGE_STATE_CHANGED");
 
 
         PullRequestEventType GetPullRequestEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PULL_REQUEST_CREATED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PullRequestEventType::PULL_REQUEST_CREATED;
-          }
-          else if (hashCode == PULL_REQUEST_STATUS_CHANGED_HASH)
-          {
-            return PullRequestEventType::PULL_REQUEST_STATUS_CHANGED;
-          }
-          else if (hashCode == PULL_REQUEST_SOURCE_REFERENCE_UPDATED_HASH)
-          {
-            return PullRequestEventType::PULL_REQUEST_SOURCE_REFERENCE_UPDATED;
-          }
-          else if (hashCode == PULL_REQUEST_MERGE_STATE_CHANGED_HASH)
-          {
-            return PullRequestEventType::PULL_REQUEST_MERGE_STATE_CHANGED;
+          case PULL_REQUEST_CREATED_HASH:
+            if (name == "PULL_REQUEST_CREATED")
+            {
+              return PullRequestEventType::PULL_REQUEST_CREATED;
+            }
+            break;
+          case PULL_REQUEST_STATUS_CHANGED_HASH:
+            if (name == "PULL_REQUEST_STATUS_CHANGED")
+            {
+              return PullRequestEventType::PULL_REQUEST_STATUS_CHANGED;
+            }
+            break;
+          case PULL_REQUEST_SOURCE_REFERENCE_UPDATED_HASH:
+            if (name == "PULL_REQUEST_SOURCE_REFERENCE_UPDATED")
+            {
+              return PullRequestEventType::PULL_REQUEST_SOURCE_REFERENCE_UPDATED;
+            }
+            break;
+          case PULL_REQUEST_MERGE_STATE_CHANGED_HASH:
+            if (name == "PULL_REQUEST_MERGE_STATE_CHANGED")
+            {
+              return PullRequestEventType::PULL_REQUEST_MERGE_STATE_CHANGED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return PullRequestEventType::NOT_SET;
         }
 
-        Aws::String GetNameForPullRequestEventType(PullRequestEventType enumValue)
+        const char* GetNameForPullRequestEventType(PullRequestEventType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PullRequestStatusEnumMapper
       {
 
-        static const int OPEN_HASH = HashingUtils::HashString("OPEN");
-        static const int CLOSED_HASH = HashingUtils::HashString("CLOSED");
+        static constexpr int OPEN_HASH = HashingUtils::CompileTimeHashString("OPEN");
+        static constexpr int CLOSED_HASH = HashingUtils::CompileTimeHashString("CLOSED");
 
 
         PullRequestStatusEnum GetPullRequestStatusEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OPEN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PullRequestStatusEnum::OPEN;
-          }
-          else if (hashCode == CLOSED_HASH)
-          {
-            return PullRequestStatusEnum::CLOSED;
+          case OPEN_HASH:
+            if (name == "OPEN")
+            {
+              return PullRequestStatusEnum::OPEN;
+            }
+            break;
+          case CLOSED_HASH:
+            if (name == "CLOSED")
+            {
+              return PullRequestStatusEnum::CLOSED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PullRequestStatusEnum::NOT_SET;
         }
 
-        Aws::String GetNameForPullRequestStatusEnum(PullRequestStatusEnum enumValue)
+        const char* GetNameForPullRequestStatusEnum(PullRequestStatusEnum enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace RelativeFileVersionEnumMapper
       {
 
-        static const int BEFORE_HASH = HashingUtils::HashString("BEFORE");
-        static const int AFTER_HASH = HashingUtils::HashString("AFTER");
+        static constexpr int BEFORE_HASH = HashingUtils::CompileTimeHashString("BEFORE");
+        static constexpr int AFTER_HASH = HashingUtils::CompileTimeHashString("AFTER");
 
 
         RelativeFileVersionEnum GetRelativeFileVersionEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BEFORE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RelativeFileVersionEnum::BEFORE;
-          }
-          else if (hashCode == AFTER_HASH)
-          {
-            return RelativeFileVersionEnum::AFTER;
+          case BEFORE_HASH:
+            if (name == "BEFORE")
+            {
+              return RelativeFileVersionEnum::BEFORE;
+            }
+            break;
+          case AFTER_HASH:
+            if (name == "AFTER")
+            {
+              return RelativeFileVersionEnum::AFTER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RelativeFileVersionEnum::NOT_SET;
         }
 
-        Aws::String GetNameForRelativeFileVersionEnum(RelativeFileVersionEnum enumValue)
+        const char* GetNameForRelativeFileVersionEnum(RelativeFileVersionEnum enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
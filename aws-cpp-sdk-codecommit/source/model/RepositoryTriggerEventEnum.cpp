@@ -30,30 +30,44 @@ namespace Aws
       namespace RepositoryTriggerEventEnumMapper
       {
 
-        static const int all_HASH = HashingUtils::HashString("all");
-        static const int updateReference_HASH = HashingUtils::HashString("updateReference");
-        static const int createReference_HASH = HashingUtils::HashString("createReference");
-        static const int deleteReference_HASH = HashingUtils::HashString("deleteReference");
+        static constexpr int all_HASH = HashingUtils::CompileTimeHashString("all");
+        static constexpr int updateReference_HASH = HashingUtils::CompileTimeHashString("updateReference");
+        static constexpr int createReference_HASH = HashingUtils::CompileTimeHashString("createReference");
+        static constexpr int deleteReference_HASH = HashingUtils::CompileTimeHashString("deleteReference");
 
 
         RepositoryTriggerEventEnum GetRepositoryTriggerEventEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == all_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RepositoryTriggerEventEnum::all;
-          }
-          else if (hashCode == updateReference_HASH)
-          {
-            return RepositoryTriggerEventEnum::updateReference;
-          }
-          else if (hashCode == createReference_HASH)
-          {
-            return RepositoryTriggerEventEnum::createReference;
-          }
-          else if (hashCode == deleteReference_HASH)
-          {
-            return RepositoryTriggerEventEnum::deleteReference;
+          case all_HASH:
+            if (name == "all")
+            {
+              return RepositoryTriggerEventEnum::all;
+            }
+            break;
+          case updateReference_HASH:
+            if (name == "updateReference")
+            {
+              return RepositoryTriggerEventEnum::updateReference;
+            }
+            break;
+          case createReference_HASH:
+            if (name == "createReference")
+            {
+              return RepositoryTriggerEventEnum::createReference;
+            }
+            break;
+          case deleteReference_HASH:
+            if (name == "deleteReference")
+            {
+              return RepositoryTriggerEventEnum::deleteReference;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return RepositoryTriggerEventEnum::NOT_SET;
         }
 
-        Aws::String GetNameForRepositoryTriggerEventEnum(RepositoryTriggerEventEnum enumValue)
+        const char* GetNameForRepositoryTriggerEventEnum(RepositoryTriggerEventEnum enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SortByEnumMapper
       {
 
-        static const int repositoryName_HASH = HashingUtils::HashString("repositoryName");
-        static const int lastModifiedDate_HASH = HashingUtils::HashString("lastModifiedDate");
+        static constexpr int repositoryName_HASH = HashingUtils::CompileTimeHashString("repositoryName");
+        static constexpr int lastModifiedDate_HASH = HashingUtils::CompileTimeHashString("lastModifiedDate");
 
 
         SortByEnum GetSortByEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == repositoryName_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SortByEnum::repositoryName;
-          }
-          else if (hashCode == lastModifiedDate_HASH)
-          {
-            return SortByEnum::lastModifiedDate;
+          case repositoryName_HASH:
+            if (name == "repositoryName")
+            {
+              return SortByEnum::repositoryName;
+            }
+            break;
+          case lastModifiedDate_HASH:
+            if (name == "lastModifiedDate")
+            {
+              return SortByEnum::lastModifiedDate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SortByEnum::NOT_SET;
         }
 
-        Aws::String GetNameForSortByEnum(SortByEnum enumValue)
+        const char* GetNameForSortByEnum(SortByEnum enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace ApplicationRevisionSortByMapper
 {
 AWS_CODEDEPLOY_API ApplicationRevisionSortBy GetApplicationRevisionSortByForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForApplicationRevisionSortBy(ApplicationRevisionSortBy value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForApplicationRevisionSortBy(ApplicationRevisionSortBy value);
 } // namespace ApplicationRevisionSortByMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,7 +35,8 @@ namespace AutoRollbackEventMapper
 {
 AWS_CODEDEPLOY_API AutoRollbackEvent GetAutoRollbackEventForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForAutoRollbackEvent(AutoRollbackEvent value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForAutoRollbackEvent(AutoRollbackEvent value);
 } // namespace AutoRollbackEventMapper
 } // namespace Model
 } // namespace CodeDeploy
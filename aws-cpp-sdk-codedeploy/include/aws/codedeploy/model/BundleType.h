@@ -37,7 +37,8 @@ namespace BundleTypeMapper
 {
 AWS_CODEDEPLOY_API BundleType GetBundleTypeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForBundleType(BundleType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForBundleType(BundleType value);
 } // namespace BundleTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -34,7 +34,8 @@ namespace ComputePlatformMapper
 {
 AWS_CODEDEPLOY_API ComputePlatform GetComputePlatformForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForComputePlatform(ComputePlatform value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForComputePlatform(ComputePlatform value);
 } // namespace ComputePlatformMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,7 +35,8 @@ namespace DeploymentCreatorMapper
 {
 AWS_CODEDEPLOY_API DeploymentCreator GetDeploymentCreatorForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentCreator(DeploymentCreator value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentCreator(DeploymentCreator value);
 } // namespace DeploymentCreatorMapper
 } // namespace Model
 } // namespace CodeDeploy
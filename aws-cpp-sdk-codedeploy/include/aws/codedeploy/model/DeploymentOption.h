@@ -34,7 +34,8 @@ namespace DeploymentOptionMapper
 {
 AWS_CODEDEPLOY_API DeploymentOption GetDeploymentOptionForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentOption(DeploymentOption value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentOption(DeploymentOption value);
 } // namespace DeploymentOptionMapper
 } // namespace Model
 } // namespace CodeDeploy
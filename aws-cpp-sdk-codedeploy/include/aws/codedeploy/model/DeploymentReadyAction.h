@@ -34,7 +34,8 @@ namespace DeploymentReadyActionMapper
 {
 AWS_CODEDEPLOY_API DeploymentReadyAction GetDeploymentReadyActionForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentReadyAction(DeploymentReadyAction value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentReadyAction(DeploymentReadyAction value);
 } // namespace DeploymentReadyActionMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -39,7 +39,8 @@ namespace DeploymentStatusMapper
 {
 AWS_CODEDEPLOY_API DeploymentStatus GetDeploymentStatusForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentStatus(DeploymentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentStatus(DeploymentStatus value);
 } // namespace DeploymentStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -34,7 +34,8 @@ namespace DeploymentTypeMapper
 {
 AWS_CODEDEPLOY_API DeploymentType GetDeploymentTypeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForDeploymentType(DeploymentType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForDeploymentType(DeploymentType value);
 } // namespace DeploymentTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,7 +35,8 @@ namespace EC2TagFilterTypeMapper
 {
 AWS_CODEDEPLOY_API EC2TagFilterType GetEC2TagFilterTypeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForEC2TagFilterType(EC2TagFilterType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForEC2TagFilterType(EC2TagFilterType value);
 } // namespace EC2TagFilterTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
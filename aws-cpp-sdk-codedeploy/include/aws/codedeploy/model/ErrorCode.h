@@ -58,7 +58,8 @@ namespace ErrorCodeMapper
 {
 AWS_CODEDEPLOY_API ErrorCode GetErrorCodeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForErrorCode(ErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForErrorCode(ErrorCode value);
 } // namespace ErrorCodeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,7 +35,8 @@ namespace FileExistsBehaviorMapper
 {
 AWS_CODEDEPLOY_API FileExistsBehavior GetFileExistsBehaviorForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForFileExistsBehavior(FileExistsBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForFileExistsBehavior(FileExistsBehavior value);
 } // namespace FileExistsBehaviorMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -34,7 +34,8 @@ namespace GreenFleetProvisioningActionMapper
 {
 AWS_CODEDEPLOY_API GreenFleetProvisioningAction GetGreenFleetProvisioningActionForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForGreenFleetProvisioningAction(GreenFleetProvisioningAction value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForGreenFleetProvisioningAction(GreenFleetProvisioningAction value);
 } // namespace GreenFleetProvisioningActionMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -34,7 +34,8 @@ namespace InstanceActionMapper
 {
 AWS_CODEDEPLOY_API InstanceAction GetInstanceActionForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForInstanceAction(InstanceAction value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForInstanceAction(InstanceAction value);
 } // namespace InstanceActionMapper
 } // namespace Model
 } // namespace CodeDeploy
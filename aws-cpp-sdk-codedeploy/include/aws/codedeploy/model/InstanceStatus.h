@@ -39,7 +39,8 @@ namespace InstanceStatusMapper
 {
 AWS_CODEDEPLOY_API InstanceStatus GetInstanceStatusForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForInstanceStatus(InstanceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForInstanceStatus(InstanceStatus value);
 } // namespace InstanceStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
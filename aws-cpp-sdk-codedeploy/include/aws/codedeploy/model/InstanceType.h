@@ -34,7 +34,8 @@ namespace InstanceTypeMapper
 {
 AWS_CODEDEPLOY_API InstanceType GetInstanceTypeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForInstanceType(InstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForInstanceType(InstanceType value);
 } // namespace InstanceTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
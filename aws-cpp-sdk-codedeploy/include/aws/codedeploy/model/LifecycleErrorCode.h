@@ -38,7 +38,8 @@ namespace LifecycleErrorCodeMapper
 {
 AWS_CODEDEPLOY_API LifecycleErrorCode GetLifecycleErrorCodeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForLifecycleErrorCode(LifecycleErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForLifecycleErrorCode(LifecycleErrorCode value);
 } // namespace LifecycleErrorCodeMapper
 } // namespace Model
 } // namespace CodeDeploy
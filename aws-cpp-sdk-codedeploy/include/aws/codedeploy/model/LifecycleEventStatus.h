@@ -38,7 +38,8 @@ namespace LifecycleEventStatusMapper
 {
 AWS_CODEDEPLOY_API LifecycleEventStatus GetLifecycleEventStatusForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForLifecycleEventStatus(LifecycleEventStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForLifecycleEventStatus(LifecycleEventStatus value);
 } // namespace LifecycleEventStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
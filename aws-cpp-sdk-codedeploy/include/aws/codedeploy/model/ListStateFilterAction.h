@@ -35,7 +35,8 @@ namespace ListStateFilterActionMapper
 {
 AWS_CODEDEPLOY_API ListStateFilterAction GetListStateFilterActionForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForListStateFilterAction(ListStateFilterAction value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForListStateFilterAction(ListStateFilterAction value);
 } // namespace ListStateFilterActionMapper
 } // namespace Model
 } // namespace CodeDeploy
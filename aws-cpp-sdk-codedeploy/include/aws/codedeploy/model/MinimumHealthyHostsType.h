@@ -34,7 +34,8 @@ namespace MinimumHealthyHostsTypeMapper
 {
 AWS_CODEDEPLOY_API MinimumHealthyHostsType GetMinimumHealthyHostsTypeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForMinimumHealthyHostsType(MinimumHealthyHostsType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForMinimumHealthyHostsType(MinimumHealthyHostsType value);
 } // namespace MinimumHealthyHostsTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -34,7 +34,8 @@ namespace RegistrationStatusMapper
 {
 AWS_CODEDEPLOY_API RegistrationStatus GetRegistrationStatusForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForRegistrationStatus(RegistrationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForRegistrationStatus(RegistrationStatus value);
 } // namespace RegistrationStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,7 +35,8 @@ namespace RevisionLocationTypeMapper
 {
 AWS_CODEDEPLOY_API RevisionLocationType GetRevisionLocationTypeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForRevisionLocationType(RevisionLocationType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForRevisionLocationType(RevisionLocationType value);
 } // namespace RevisionLocationTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -34,7 +34,8 @@ namespace StopStatusMapper
 {
 AWS_CODEDEPLOY_API StopStatus GetStopStatusForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForStopStatus(StopStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForStopStatus(StopStatus value);
 } // namespace StopStatusMapper
 } // namespace Model
 } // namespace CodeDeploy
@@ -35,7 +35,8 @@ namespace TagFilterTypeMapper
 {
 AWS_CODEDEPLOY_API TagFilterType GetTagFilterTypeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForTagFilterType(TagFilterType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForTagFilterType(TagFilterType value);
 } // namespace TagFilterTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
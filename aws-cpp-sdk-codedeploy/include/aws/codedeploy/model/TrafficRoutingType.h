@@ -35,7 +35,8 @@ namespace TrafficRoutingTypeMapper
 {
 AWS_CODEDEPLOY_API TrafficRoutingType GetTrafficRoutingTypeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForTrafficRoutingType(TrafficRoutingType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForTrafficRoutingType(TrafficRoutingType value);
 } // namespace TrafficRoutingTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
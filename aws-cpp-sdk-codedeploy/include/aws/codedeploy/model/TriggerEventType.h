@@ -42,7 +42,8 @@ namespace TriggerEventTypeMapper
 {
 AWS_CODEDEPLOY_API TriggerEventType GetTriggerEventTypeForName(const Aws::String& name);
 
-AWS_CODEDEPLOY_API Aws::String GetNameForTriggerEventType(TriggerEventType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEDEPLOY_API const char* GetNameForTriggerEventType(TriggerEventType value);
 } // namespace TriggerEventTypeMapper
 } // namespace Model
 } // namespace CodeDeploy
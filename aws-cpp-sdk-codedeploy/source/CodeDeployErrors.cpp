@@ -28,100 +28,100 @@ namespace CodeDeploy
 namespace CodeDeployErrorMapper
 {
 
-static const int OPERATION_NOT_SUPPORTED_HASH = HashingUtils::HashString("OperationNotSupportedException");
-static const int DEPLOYMENT_CONFIG_DOES_NOT_EXIST_HASH = HashingUtils::HashString("DeploymentConfigDoesNotExistException");
-static const int DEPLOYMENT_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DeploymentGroupLimitExceededException");
-static const int INVALID_KEY_PREFIX_FILTER_HASH = HashingUtils::HashString("InvalidKeyPrefixFilterException");
-static const int INVALID_DEPLOYED_STATE_FILTER_HASH = HashingUtils::HashString("InvalidDeployedStateFilterException");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInputException");
-static const int INVALID_DEPLOYMENT_GROUP_NAME_HASH = HashingUtils::HashString("InvalidDeploymentGroupNameException");
-static const int APPLICATION_NAME_REQUIRED_HASH = HashingUtils::HashString("ApplicationNameRequiredException");
-static const int GIT_HUB_ACCOUNT_TOKEN_NAME_REQUIRED_HASH = HashingUtils::HashString("GitHubAccountTokenNameRequiredException");
-static const int INSTANCE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("InstanceDoesNotExistException");
-static const int INVALID_DEPLOYMENT_INSTANCE_TYPE_HASH = HashingUtils::HashString("InvalidDeploymentInstanceTypeException");
-static const int INVALID_BUCKET_NAME_FILTER_HASH = HashingUtils::HashString("InvalidBucketNameFilterException");
-static const int INVALID_AUTO_SCALING_GROUP_HASH = HashingUtils::HashString("InvalidAutoScalingGroupException");
-static const int INVALID_E_C2_TAG_HASH = HashingUtils::HashString("InvalidEC2TagException");
-static const int INVALID_SORT_ORDER_HASH = HashingUtils::HashString("InvalidSortOrderException");
-static const int INVALID_COMPUTE_PLATFORM_HASH = HashingUtils::HashString("InvalidComputePlatformException");
-static const int UNSUPPORTED_ACTION_FOR_DEPLOYMENT_TYPE_HASH = HashingUtils::HashString("UnsupportedActionForDeploymentTypeException");
-static const int DEPLOYMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DeploymentLimitExceededException");
-static const int INVALID_ALARM_CONFIG_HASH = HashingUtils::HashString("InvalidAlarmConfigException");
-static const int INVALID_DEPLOYMENT_STATUS_HASH = HashingUtils::HashString("InvalidDeploymentStatusException");
-static const int INVALID_INSTANCE_STATUS_HASH = HashingUtils::HashString("InvalidInstanceStatusException");
-static const int REVISION_DOES_NOT_EXIST_HASH = HashingUtils::HashString("RevisionDoesNotExistException");
-static const int INVALID_MINIMUM_HEALTHY_HOST_VALUE_HASH = HashingUtils::HashString("InvalidMinimumHealthyHostValueException");
-static const int TRIGGER_TARGETS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TriggerTargetsLimitExceededException");
-static const int INVALID_LOAD_BALANCER_INFO_HASH = HashingUtils::HashString("InvalidLoadBalancerInfoException");
-static const int DEPLOYMENT_CONFIG_IN_USE_HASH = HashingUtils::HashString("DeploymentConfigInUseException");
-static const int INVALID_APPLICATION_NAME_HASH = HashingUtils::HashString("InvalidApplicationNameException");
-static const int RESOURCE_VALIDATION_HASH = HashingUtils::HashString("ResourceValidationException");
-static const int INVALID_TAG_HASH = HashingUtils::HashString("InvalidTagException");
-static const int LIFECYCLE_EVENT_ALREADY_COMPLETED_HASH = HashingUtils::HashString("LifecycleEventAlreadyCompletedException");
-static const int INVALID_DEPLOYMENT_CONFIG_NAME_HASH = HashingUtils::HashString("InvalidDeploymentConfigNameException");
-static const int INVALID_ON_PREMISES_TAG_COMBINATION_HASH = HashingUtils::HashString("InvalidOnPremisesTagCombinationException");
-static const int INVALID_FILE_EXISTS_BEHAVIOR_HASH = HashingUtils::HashString("InvalidFileExistsBehaviorException");
-static const int INSTANCE_NAME_REQUIRED_HASH = HashingUtils::HashString("InstanceNameRequiredException");
-static const int DEPLOYMENT_CONFIG_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DeploymentConfigLimitExceededException");
-static const int APPLICATION_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ApplicationDoesNotExistException");
-static const int DEPLOYMENT_ID_REQUIRED_HASH = HashingUtils::HashString("DeploymentIdRequiredException");
-static const int INVALID_IGNORE_APPLICATION_STOP_FAILURES_VALUE_HASH = HashingUtils::HashString("InvalidIgnoreApplicationStopFailuresValueException");
-static const int INVALID_REGISTRATION_STATUS_HASH = HashingUtils::HashString("InvalidRegistrationStatusException");
-static const int INVALID_TARGET_INSTANCES_HASH = HashingUtils::HashString("InvalidTargetInstancesException");
-static const int GIT_HUB_ACCOUNT_TOKEN_DOES_NOT_EXIST_HASH = HashingUtils::HashString("GitHubAccountTokenDoesNotExistException");
-static const int INVALID_TRIGGER_CONFIG_HASH = HashingUtils::HashString("InvalidTriggerConfigException");
-static const int INVALID_OPERATION_HASH = HashingUtils::HashString("InvalidOperationException");
-static const int TAG_REQUIRED_HASH = HashingUtils::HashString("TagRequiredException");
-static const int DEPLOYMENT_IS_NOT_IN_READY_STATE_HASH = HashingUtils::HashString("DeploymentIsNotInReadyStateException");
-static const int INVALID_INSTANCE_TYPE_HASH = HashingUtils::HashString("InvalidInstanceTypeException");
-static const int INVALID_LIFECYCLE_EVENT_HOOK_EXECUTION_STATUS_HASH = HashingUtils::HashString("InvalidLifecycleEventHookExecutionStatusException");
-static const int APPLICATION_ALREADY_EXISTS_HASH = HashingUtils::HashString("ApplicationAlreadyExistsException");
-static const int DEPLOYMENT_GROUP_DOES_NOT_EXIST_HASH = HashingUtils::HashString("DeploymentGroupDoesNotExistException");
-static const int INVALID_DEPLOYMENT_ID_HASH = HashingUtils::HashString("InvalidDeploymentIdException");
-static const int INVALID_LIFECYCLE_EVENT_HOOK_EXECUTION_ID_HASH = HashingUtils::HashString("InvalidLifecycleEventHookExecutionIdException");
-static const int INVALID_SORT_BY_HASH = HashingUtils::HashString("InvalidSortByException");
-static const int INVALID_AUTO_ROLLBACK_CONFIG_HASH = HashingUtils::HashString("InvalidAutoRollbackConfigException");
-static const int IAM_ARN_REQUIRED_HASH = HashingUtils::HashString("IamArnRequiredException");
-static const int ALARMS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AlarmsLimitExceededException");
-static const int DEPLOYMENT_DOES_NOT_EXIST_HASH = HashingUtils::HashString("DeploymentDoesNotExistException");
-static const int INSTANCE_ID_REQUIRED_HASH = HashingUtils::HashString("InstanceIdRequiredException");
-static const int DESCRIPTION_TOO_LONG_HASH = HashingUtils::HashString("DescriptionTooLongException");
-static const int ROLE_REQUIRED_HASH = HashingUtils::HashString("RoleRequiredException");
-static const int DEPLOYMENT_GROUP_NAME_REQUIRED_HASH = HashingUtils::HashString("DeploymentGroupNameRequiredException");
-static const int INVALID_INSTANCE_NAME_HASH = HashingUtils::HashString("InvalidInstanceNameException");
-static const int DEPLOYMENT_CONFIG_ALREADY_EXISTS_HASH = HashingUtils::HashString("DeploymentConfigAlreadyExistsException");
-static const int INVALID_ROLE_HASH = HashingUtils::HashString("InvalidRoleException");
-static const int INVALID_TRAFFIC_ROUTING_CONFIGURATION_HASH = HashingUtils::HashString("InvalidTrafficRoutingConfigurationException");
-static const int INVALID_TAG_FILTER_HASH = HashingUtils::HashString("InvalidTagFilterException");
-static const int INVALID_GIT_HUB_ACCOUNT_TOKEN_HASH = HashingUtils::HashString("InvalidGitHubAccountTokenException");
-static const int IAM_SESSION_ARN_ALREADY_REGISTERED_HASH = HashingUtils::HashString("IamSessionArnAlreadyRegisteredException");
-static const int MULTIPLE_IAM_ARNS_PROVIDED_HASH = HashingUtils::HashString("MultipleIamArnsProvidedException");
-static const int INVALID_BLUE_GREEN_DEPLOYMENT_CONFIGURATION_HASH = HashingUtils::HashString("InvalidBlueGreenDeploymentConfigurationException");
-static const int INSTANCE_NAME_ALREADY_REGISTERED_HASH = HashingUtils::HashString("InstanceNameAlreadyRegisteredException");
-static const int INVALID_IAM_SESSION_ARN_HASH = HashingUtils::HashString("InvalidIamSessionArnException");
-static const int INSTANCE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("InstanceLimitExceededException");
-static const int BATCH_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("BatchLimitExceededException");
-static const int DEPLOYMENT_NOT_STARTED_HASH = HashingUtils::HashString("DeploymentNotStartedException");
-static const int LIFECYCLE_HOOK_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LifecycleHookLimitExceededException");
-static const int DEPLOYMENT_GROUP_ALREADY_EXISTS_HASH = HashingUtils::HashString("DeploymentGroupAlreadyExistsException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int INVALID_E_C2_TAG_COMBINATION_HASH = HashingUtils::HashString("InvalidEC2TagCombinationException");
-static const int DEPLOYMENT_CONFIG_NAME_REQUIRED_HASH = HashingUtils::HashString("DeploymentConfigNameRequiredException");
-static const int INVALID_DEPLOYMENT_STYLE_HASH = HashingUtils::HashString("InvalidDeploymentStyleException");
-static const int IAM_USER_ARN_ALREADY_REGISTERED_HASH = HashingUtils::HashString("IamUserArnAlreadyRegisteredException");
-static const int DEPLOYMENT_ALREADY_COMPLETED_HASH = HashingUtils::HashString("DeploymentAlreadyCompletedException");
-static const int REVISION_REQUIRED_HASH = HashingUtils::HashString("RevisionRequiredException");
-static const int APPLICATION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ApplicationLimitExceededException");
-static const int INVALID_GIT_HUB_ACCOUNT_TOKEN_NAME_HASH = HashingUtils::HashString("InvalidGitHubAccountTokenNameException");
-static const int INSTANCE_NOT_REGISTERED_HASH = HashingUtils::HashString("InstanceNotRegisteredException");
-static const int BUCKET_NAME_FILTER_REQUIRED_HASH = HashingUtils::HashString("BucketNameFilterRequiredException");
-static const int TAG_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TagLimitExceededException");
-static const int INVALID_UPDATE_OUTDATED_INSTANCES_ONLY_VALUE_HASH = HashingUtils::HashString("InvalidUpdateOutdatedInstancesOnlyValueException");
-static const int INVALID_IAM_USER_ARN_HASH = HashingUtils::HashString("InvalidIamUserArnException");
-static const int INVALID_REVISION_HASH = HashingUtils::HashString("InvalidRevisionException");
-static const int TAG_SET_LIST_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TagSetListLimitExceededException");
-static const int INVALID_TIME_RANGE_HASH = HashingUtils::HashString("InvalidTimeRangeException");
-static const int IAM_USER_ARN_REQUIRED_HASH = HashingUtils::HashString("IamUserArnRequiredException");
+static constexpr int OPERATION_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("OperationNotSupportedException");
+static constexpr int DEPLOYMENT_CONFIG_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("DeploymentConfigDoesNotExistException");
+static constexpr int DEPLOYMENT_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DeploymentGroupLimitExceededException");
+static constexpr int INVALID_KEY_PREFIX_FILTER_HASH = HashingUtils::CompileTimeHashString("InvalidKeyPrefixFilterException");
+static constexpr int INVALID_DEPLOYED_STATE_FILTER_HASH = HashingUtils::CompileTimeHashString("InvalidDeployedStateFilterException");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInputException");
+static constexpr int INVALID_DEPLOYMENT_GROUP_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidDeploymentGroupNameException");
+static constexpr int APPLICATION_NAME_REQUIRED_HASH = HashingUtils::CompileTimeHashString("ApplicationNameRequiredException");
+static constexpr int GIT_HUB_ACCOUNT_TOKEN_NAME_REQUIRED_HASH = HashingUtils::CompileTimeHashString("GitHubAccountTokenNameRequiredException");
+static constexpr int INSTANCE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("InstanceDoesNotExistException");
+static constexpr int INVALID_DEPLOYMENT_INSTANCE_TYPE_HASH = HashingUtils::CompileTimeHashString("InvalidDeploymentInstanceTypeException");
+static constexpr int INVALID_BUCKET_NAME_FILTER_HASH = HashingUtils::CompileTimeHashString("InvalidBucketNameFilterException");
+static constexpr int INVALID_AUTO_SCALING_GROUP_HASH = HashingUtils::CompileTimeHashString("InvalidAutoScalingGroupException");
+static constexpr int INVALID_E_C2_TAG_HASH = HashingUtils::CompileTimeHashString("InvalidEC2TagException");
+static constexpr int INVALID_SORT_ORDER_HASH = HashingUtils::CompileTimeHashString("InvalidSortOrderException");
+static constexpr int INVALID_COMPUTE_PLATFORM_HASH = HashingUtils::CompileTimeHashString("InvalidComputePlatformException");
+static constexpr int UNSUPPORTED_ACTION_FOR_DEPLOYMENT_TYPE_HASH = HashingUtils::CompileTimeHashString("UnsupportedActionForDeploymentTypeException");
+static constexpr int DEPLOYMENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DeploymentLimitExceededException");
+static constexpr int INVALID_ALARM_CONFIG_HASH = HashingUtils::CompileTimeHashString("InvalidAlarmConfigException");
+static constexpr int INVALID_DEPLOYMENT_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidDeploymentStatusException");
+static constexpr int INVALID_INSTANCE_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceStatusException");
+static constexpr int REVISION_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("RevisionDoesNotExistException");
+static constexpr int INVALID_MINIMUM_HEALTHY_HOST_VALUE_HASH = HashingUtils::CompileTimeHashString("InvalidMinimumHealthyHostValueException");
+static constexpr int TRIGGER_TARGETS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TriggerTargetsLimitExceededException");
+static constexpr int INVALID_LOAD_BALANCER_INFO_HASH = HashingUtils::CompileTimeHashString("InvalidLoadBalancerInfoException");
+static constexpr int DEPLOYMENT_CONFIG_IN_USE_HASH = HashingUtils::CompileTimeHashString("DeploymentConfigInUseException");
+static constexpr int INVALID_APPLICATION_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidApplicationNameException");
+static constexpr int RESOURCE_VALIDATION_HASH = HashingUtils::CompileTimeHashString("ResourceValidationException");
+static constexpr int INVALID_TAG_HASH = HashingUtils::CompileTimeHashString("InvalidTagException");
+static constexpr int LIFECYCLE_EVENT_ALREADY_COMPLETED_HASH = HashingUtils::CompileTimeHashString("LifecycleEventAlreadyCompletedException");
+static constexpr int INVALID_DEPLOYMENT_CONFIG_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidDeploymentConfigNameException");
+static constexpr int INVALID_ON_PREMISES_TAG_COMBINATION_HASH = HashingUtils::CompileTimeHashString("InvalidOnPremisesTagCombinationException");
+static constexpr int INVALID_FILE_EXISTS_BEHAVIOR_HASH = HashingUtils::CompileTimeHashString("InvalidFileExistsBehaviorException");
+static constexpr int INSTANCE_NAME_REQUIRED_HASH = HashingUtils::CompileTimeHashString("InstanceNameRequiredException");
+static constexpr int DEPLOYMENT_CONFIG_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DeploymentConfigLimitExceededException");
+static constexpr int APPLICATION_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ApplicationDoesNotExistException");
+static constexpr int DEPLOYMENT_ID_REQUIRED_HASH = HashingUtils::CompileTimeHashString("DeploymentIdRequiredException");
+static constexpr int INVALID_IGNORE_APPLICATION_STOP_FAILURES_VALUE_HASH = HashingUtils::CompileTimeHashString("InvalidIgnoreApplicationStopFailuresValueException");
+static constexpr int INVALID_REGISTRATION_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidRegistrationStatusException");
+static constexpr int INVALID_TARGET_INSTANCES_HASH = HashingUtils::CompileTimeHashString("InvalidTargetInstancesException");
+static constexpr int GIT_HUB_ACCOUNT_TOKEN_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("GitHubAccountTokenDoesNotExistException");
+static constexpr int INVALID_TRIGGER_CONFIG_HASH = HashingUtils::CompileTimeHashString("InvalidTriggerConfigException");
+static constexpr int INVALID_OPERATION_HASH = HashingUtils::CompileTimeHashString("InvalidOperationException");
+static constexpr int TAG_REQUIRED_HASH = HashingUtils::CompileTimeHashString("TagRequiredException");
+static constexpr int DEPLOYMENT_IS_NOT_IN_READY_STATE_HASH = HashingUtils::CompileTimeHashString("DeploymentIsNotInReadyStateException");
+static constexpr int INVALID_INSTANCE_TYPE_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceTypeException");
+static constexpr int INVALID_LIFECYCLE_EVENT_HOOK_EXECUTION_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidLifecycleEventHookExecutionStatusException");
+static constexpr int APPLICATION_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ApplicationAlreadyExistsException");
+static constexpr int DEPLOYMENT_GROUP_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("DeploymentGroupDoesNotExistException");
+static constexpr int INVALID_DEPLOYMENT_ID_HASH = HashingUtils::CompileTimeHashString("InvalidDeploymentIdException");
+static constexpr int INVALID_LIFECYCLE_EVENT_HOOK_EXECUTION_ID_HASH = HashingUtils::CompileTimeHashString("InvalidLifecycleEventHookExecutionIdException");
+static constexpr int INVALID_SORT_BY_HASH = HashingUtils::CompileTimeHashString("InvalidSortByException");
+static constexpr int INVALID_AUTO_ROLLBACK_CONFIG_HASH = HashingUtils::CompileTimeHashString("InvalidAutoRollbackConfigException");
+static constexpr int IAM_ARN_REQUIRED_HASH = HashingUtils::CompileTimeHashString("IamArnRequiredException");
+static constexpr int ALARMS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AlarmsLimitExceededException");
+static constexpr int DEPLOYMENT_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("DeploymentDoesNotExistException");
+static constexpr int INSTANCE_ID_REQUIRED_HASH = HashingUtils::CompileTimeHashString("InstanceIdRequiredException");
+static constexpr int DESCRIPTION_TOO_LONG_HASH = HashingUtils::CompileTimeHashString("DescriptionTooLongException");
+static constexpr int ROLE_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RoleRequiredException");
+static constexpr int DEPLOYMENT_GROUP_NAME_REQUIRED_HASH = HashingUtils::CompileTimeHashString("DeploymentGroupNameRequiredException");
+static constexpr int INVALID_INSTANCE_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceNameException");
+static constexpr int DEPLOYMENT_CONFIG_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("DeploymentConfigAlreadyExistsException");
+static constexpr int INVALID_ROLE_HASH = HashingUtils::CompileTimeHashString("InvalidRoleException");
+static constexpr int INVALID_TRAFFIC_ROUTING_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("InvalidTrafficRoutingConfigurationException");
+static constexpr int INVALID_TAG_FILTER_HASH = HashingUtils::CompileTimeHashString("InvalidTagFilterException");
+static constexpr int INVALID_GIT_HUB_ACCOUNT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidGitHubAccountTokenException");
+static constexpr int IAM_SESSION_ARN_ALREADY_REGISTERED_HASH = HashingUtils::CompileTimeHashString("IamSessionArnAlreadyRegisteredException");
+static constexpr int MULTIPLE_IAM_ARNS_PROVIDED_HASH = HashingUtils::CompileTimeHashString("MultipleIamArnsProvidedException");
+static constexpr int INVALID_BLUE_GREEN_DEPLOYMENT_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("InvalidBlueGreenDeploymentConfigurationException");
+static constexpr int INSTANCE_NAME_ALREADY_REGISTERED_HASH = HashingUtils::CompileTimeHashString("InstanceNameAlreadyRegisteredException");
+static constexpr int INVALID_IAM_SESSION_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidIamSessionArnException");
+static constexpr int INSTANCE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("InstanceLimitExceededException");
+static constexpr int BATCH_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("BatchLimitExceededException");
+static constexpr int DEPLOYMENT_NOT_STARTED_HASH = HashingUtils::CompileTimeHashString("DeploymentNotStartedException");
+static constexpr int LIFECYCLE_HOOK_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LifecycleHookLimitExceededException");
+static constexpr int DEPLOYMENT_GROUP_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("DeploymentGroupAlreadyExistsException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int INVALID_E_C2_TAG_COMBINATION_HASH = HashingUtils::CompileTimeHashString("InvalidEC2TagCombinationException");
+static constexpr int DEPLOYMENT_CONFIG_NAME_REQUIRED_HASH = HashingUtils::CompileTimeHashString("DeploymentConfigNameRequiredException");
+static constexpr int INVALID_DEPLOYMENT_STYLE_HASH = HashingUtils::CompileTimeHashString("InvalidDeploymentStyleException");
+static constexpr int IAM_USER_ARN_ALREADY_REGISTERED_HASH = HashingUtils::CompileTimeHashString("IamUserArnAlreadyRegisteredException");
+static constexpr int DEPLOYMENT_ALREADY_COMPLETED_HASH = HashingUtils::CompileTimeHashString("DeploymentAlreadyCompletedException");
+static constexpr int REVISION_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RevisionRequiredException");
+static constexpr int APPLICATION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ApplicationLimitExceededException");
+static constexpr int INVALID_GIT_HUB_ACCOUNT_TOKEN_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidGitHubAccountTokenNameException");
+static constexpr int INSTANCE_NOT_REGISTERED_HASH = HashingUtils::CompileTimeHashString("InstanceNotRegisteredException");
+static constexpr int BUCKET_NAME_FILTER_REQUIRED_HASH = HashingUtils::CompileTimeHashString("BucketNameFilterRequiredException");
+static constexpr int TAG_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TagLimitExceededException");
+static constexpr int INVALID_UPDATE_OUTDATED_INSTANCES_ONLY_VALUE_HASH = HashingUtils::CompileTimeHashString("InvalidUpdateOutdatedInstancesOnlyValueException");
+static constexpr int INVALID_IAM_USER_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidIamUserArnException");
+static constexpr int INVALID_REVISION_HASH = HashingUtils::CompileTimeHashString("InvalidRevisionException");
+static constexpr int TAG_SET_LIST_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TagSetListLimitExceededException");
+static constexpr int INVALID_TIME_RANGE_HASH = HashingUtils::CompileTimeHashString("InvalidTimeRangeException");
+static constexpr int IAM_USER_ARN_REQUIRED_HASH = HashingUtils::CompileTimeHashString("IamUserArnRequiredException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace ApplicationRevisionSortByMapper
       {
 
-        static const int registerTime_HASH = HashingUtils::HashString("registerTime");
-        static const int firstUsedTime_HASH = HashingUtils::HashString("firstUsedTime");
-        static const int lastUsedTime_HASH = HashingUtils::HashString("lastUsedTime");
+        static constexpr int registerTime_HASH = HashingUtils::CompileTimeHashString("registerTime");
+        static constexpr int firstUsedTime_HASH = HashingUtils::CompileTimeHashString("firstUsedTime");
+        static constexpr int lastUsedTime_HASH = HashingUtils::CompileTimeHashString("lastUsedTime");
 
 
         ApplicationRevisionSortBy GetApplicationRevisionSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == registerTime_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ApplicationRevisionSortBy::registerTime;
-          }
-          else if (hashCode == firstUsedTime_HASH)
-          {
-            return ApplicationRevisionSortBy::firstUsedTime;
-          }
-          else if (hashCode == lastUsedTime_HASH)
-          {
-            return ApplicationRevisionSortBy::lastUsedTime;
+          case registerTime_HASH:
+            if (name == "registerTime")
+            {
+              return ApplicationRevisionSortBy::registerTime;
+            }
+            break;
+          case firstUsedTime_HASH:
+            if (name == "firstUsedTime")
+            {
+              return ApplicationRevisionSortBy::firstUsedTime;
+            }
+            break;
+          case lastUsedTime_HASH:
+            if (name == "lastUsedTime")
+            {
+              return ApplicationRevisionSortBy::lastUsedTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ApplicationRevisionSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForApplicationRevisionSortBy(ApplicationRevisionSortBy enumValue)
+        const char* GetNameForApplicationRevisionSortBy(ApplicationRevisionSortBy enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AutoRollbackEventMapper
       {
 
-        static const int DEPLOYMENT_FAILURE_HASH = HashingUtils::HashString("DEPLOYMENT_FAILURE");
-        static const int DEPLOYMENT_STOP_ON_ALARM_HASH = HashingUtils::HashString("DEPLOYMENT_STOP_ON_ALARM");
-        static const int DEPLOYMENT_STOP_ON_REQUEST_HASH = HashingUtils::HashString("DEPLOYMENT_STOP_ON_REQUEST");
+        static constexpr int DEPLOYMENT_FAILURE_HASH = HashingUtils::CompileTimeHashString("DEPLOYMENT_FAILURE");
+        static constexpr int DEPLOYMENT_STOP_ON_ALARM_HASH = HashingUtils::CompileTimeHashString("DEPLOYMENT_STOP_ON_ALARM");
+        static constexpr int DEPLOYMENT_STOP_ON_REQUEST_HASH = HashingUtils::CompileTimeHashString("DEPLOYMENT_STOP_ON_REQUEST");
 
 
         AutoRollbackEvent GetAutoRollbackEventForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEPLOYMENT_FAILURE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AutoRollbackEvent::DEPLOYMENT_FAILURE;
-          }
-          else if (hashCode == DEPLOYMENT_STOP_ON_ALARM_HASH)
-          {
-            return AutoRollbackEvent::DEPLOYMENT_STOP_ON_ALARM;
-          }
-          else if (hashCode == DEPLOYMENT_STOP_ON_REQUEST_HASH)
-          {
-            return AutoRollbackEvent::DEPLOYMENT_STOP_ON_REQUEST;
+          case DEPLOYMENT_FAILURE_HASH:
+            if (name == "DEPLOYMENT_FAILURE")
+            {
+              return AutoRollbackEvent::DEPLOYMENT_FAILURE;
+            }
+            break;
+          case DEPLOYMENT_STOP_ON_ALARM_HASH:
+            if (name == "DEPLOYMENT_STOP_ON_ALARM")
+            {
+              return AutoRollbackEvent::DEPLOYMENT_STOP_ON_ALARM;
+            }
+            break;
+          case DEPLOYMENT_STOP_ON_REQUEST_HASH:
+            if (name == "DEPLOYMENT_STOP_ON_REQUEST")
+            {
+              return AutoRollbackEvent::DEPLOYMENT_STOP_ON_REQUEST;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AutoRollbackEvent::NOT_SET;
         }
 
-        Aws::String GetNameForAutoRollbackEvent(AutoRollbackEvent enumValue)
+        const char* GetNameForAutoRollbackEvent(AutoRollbackEvent enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
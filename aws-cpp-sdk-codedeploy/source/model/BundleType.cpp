@@ -30,35 +30,51 @@ namespace Aws
       namespace BundleTypeMapper
       {
 
-        static const int tar_HASH = HashingUtils::HashString("tar");
-        static const int tgz_HASH = HashingUtils::HashString("tgz");
-        static const int zip_HASH = HashingUtils::HashString("zip");
-        static const int YAML_HASH = HashingUtils::HashString("YAML");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
+        static constexpr int tar_HASH = HashingUtils::CompileTimeHashString("tar");
+        static constexpr int tgz_HASH = HashingUtils::CompileTimeHashString("tgz");
+        static constexpr int zip_HASH = HashingUtils::CompileTimeHashString("zip");
+        static constexpr int YAML_HASH = HashingUtils::CompileTimeHashString("YAML");
+        static constexpr int JSON_HASH = HashingUtils::CompileTimeHashString("JSON");
 
 
         BundleType GetBundleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tar_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BundleType::tar;
-          }
-          else if (hashCode == tgz_HASH)
-          {
-            return BundleType::tgz;
-          }
-          else if (hashCode == zip_HASH)
-          {
-            return BundleType::zip;
-          }
-          else if (hashCode == YAML_HASH)
-          {
-            return BundleType::YAML;
-          }
-          else if (hashCode == JSON_HASH)
-          {
-            return BundleType::JSON;
+          case tar_HASH:
+            if (name == "tar")
+            {
+              return BundleType::tar;
+            }
+            break;
+          case tgz_HASH:
+            if (name == "tgz")
+            {
+              return BundleType::tgz;
+            }
+            break;
+          case zip_HASH:
+            if (name == "zip")
+            {
+              return BundleType::zip;
+            }
+            break;
+          case YAML_HASH:
+            if (name == "YAML")
+            {
+              return BundleType::YAML;
+            }
+            break;
+          case JSON_HASH:
+            if (name == "JSON")
+            {
+              return BundleType::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return BundleType::NOT_SET;
         }
 
-        Aws::String GetNameForBundleType(BundleType enumValue)
+        const char* GetNameForBundleType(BundleType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ComputePlatformMapper
       {
 
-        static const int Server_HASH = HashingUtils::HashString("Server");
-        static const int Lambda_HASH = HashingUtils::HashString("Lambda");
+        static constexpr int Server_HASH = HashingUtils::CompileTimeHashString("Server");
+        static constexpr int Lambda_HASH = HashingUtils::CompileTimeHashString("Lambda");
 
 
         ComputePlatform GetComputePlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Server_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComputePlatform::Server;
-          }
-          else if (hashCode == Lambda_HASH)
-          {
-            return ComputePlatform::Lambda;
+          case Server_HASH:
+            if (name == "Server")
+            {
+              return ComputePlatform::Server;
+            }
+            break;
+          case Lambda_HASH:
+            if (name == "Lambda")
+            {
+              return ComputePlatform::Lambda;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ComputePlatform::NOT_SET;
         }
 
-        Aws::String GetNameForComputePlatform(ComputePlatform enumValue)
+        const char* GetNameForComputePlatform(ComputePlatform enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
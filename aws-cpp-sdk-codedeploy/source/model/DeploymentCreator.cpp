@@ -30,25 +30,37 @@ namespace Aws
       namespace DeploymentCreatorMapper
       {
 
-        static const int user_HASH = HashingUtils::HashString("user");
-        static const int autoscaling_HASH = HashingUtils::HashString("autoscaling");
-        static const int codeDeployRollback_HASH = HashingUtils::HashString("codeDeployRollback");
+        static constexpr int user_HASH = HashingUtils::CompileTimeHashString("user");
+        static constexpr int autoscaling_HASH = HashingUtils::CompileTimeHashString("autoscaling");
+        static constexpr int codeDeployRollback_HASH = HashingUtils::CompileTimeHashString("codeDeployRollback");
 
 
         DeploymentCreator GetDeploymentCreatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == user_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeploymentCreator::user;
-          }
-          else if (hashCode == autoscaling_HASH)
-          {
-            return DeploymentCreator::autoscaling;
-          }
-          else if (hashCode == codeDeployRollback_HASH)
-          {
-            return DeploymentCreator::codeDeployRollback;
+          case user_HASH:
+            if (name == "user")
+            {
+              return DeploymentCreator::user;
+            }
+            break;
+          case autoscaling_HASH:
+            if (name == "autoscaling")
+            {
+              return DeploymentCreator::autoscaling;
+            }
+            break;
+          case codeDeployRollback_HASH:
+            if (name == "codeDeployRollback")
+            {
+              return DeploymentCreator::codeDeployRollback;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DeploymentCreator::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentCreator(DeploymentCreator enumValue)
+        const char* GetNameForDeploymentCreator(DeploymentCreator enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DeploymentOptionMapper
       {
 
-        static const int WITH_TRAFFIC_CONTROL_HASH = HashingUtils::HashString("WITH_TRAFFIC_CONTROL");
-        static const int WITHOUT_TRAFFIC_CONTROL_HASH = HashingUtils::HashString("WITHOUT_TRAFFIC_CONTROL");
+        static constexpr int WITH_TRAFFIC_CONTROL_HASH = HashingUtils::CompileTimeHashString("WITH_TRAFFIC_CONTROL");
+        static constexpr int WITHOUT_TRAFFIC_CONTROL_HASH = HashingUtils::CompileTimeHashString("WITHOUT_TRAFFIC_CONTROL");
 
 
         DeploymentOption GetDeploymentOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WITH_TRAFFIC_CONTROL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeploymentOption::WITH_TRAFFIC_CONTROL;
-          }
-          else if (hashCode == WITHOUT_TRAFFIC_CONTROL_HASH)
-          {
-            return DeploymentOption::WITHOUT_TRAFFIC_CONTROL;
+          case WITH_TRAFFIC_CONTROL_HASH:
+            if (name == "WITH_TRAFFIC_CONTROL")
+            {
+              return DeploymentOption::WITH_TRAFFIC_CONTROL;
+            }
+            break;
+          case WITHOUT_TRAFFIC_CONTROL_HASH:
+            if (name == "WITHOUT_TRAFFIC_CONTROL")
+            {
+              return DeploymentOption::WITHOUT_TRAFFIC_CONTROL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeploymentOption::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentOption(DeploymentOption enumValue)
+        const char* GetNameForDeploymentOption(DeploymentOption enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
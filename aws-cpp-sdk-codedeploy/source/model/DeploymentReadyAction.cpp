@@ -30,20 +30,30 @@ namespace Aws
       namespace DeploymentReadyActionMapper
       {
 
-        static const int CONTINUE_DEPLOYMENT_HASH = HashingUtils::HashString("CONTINUE_DEPLOYMENT");
-        static const int STOP_DEPLOYMENT_HASH = HashingUtils::HashString("STOP_DEPLOYMENT");
+        static constexpr int CONTINUE_DEPLOYMENT_HASH = HashingUtils::CompileTimeHashString("CONTINUE_DEPLOYMENT");
+        static constexpr int STOP_DEPLOYMENT_HASH = HashingUtils::CompileTimeHashString("STOP_DEPLOYMENT");
 
 
         DeploymentReadyAction GetDeploymentReadyActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONTINUE_DEPLOYMENT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeploymentReadyAction::CONTINUE_DEPLOYMENT;
-          }
-          else if (hashCode == STOP_DEPLOYMENT_HASH)
-          {
-            return DeploymentReadyAction::STOP_DEPLOYMENT;
+          case CONTINUE_DEPLOYMENT_HASH:
+            if (name == "CONTINUE_DEPLOYMENT")
+            {
+              return DeploymentReadyAction::CONTINUE_DEPLOYMENT;
+            }
+            break;
+          case STOP_DEPLOYMENT_HASH:
+            if (name == "STOP_DEPLOYMENT")
+            {
+              return DeploymentReadyAction::STOP_DEPLOYMENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeploymentReadyAction::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentReadyAction(DeploymentReadyAction enumValue)
+        const char* GetNameForDeploymentReadyAction(DeploymentReadyAction enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace DeploymentStatusMapper
       {
 
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Queued_HASH = HashingUtils::HashString("Queued");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
+        static constexpr int Created_HASH = HashingUtils::CompileTimeHashString("Created");
+        static constexpr int Queued_HASH = HashingUtils::CompileTimeHashString("Queued");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Stopped_HASH = HashingUtils::CompileTimeHashString("Stopped");
+        static constexpr int Ready_HASH = HashingUtils::CompileTimeHashString("Ready");
 
 
         DeploymentStatus GetDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Created_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeploymentStatus::Created;
-          }
-          else if (hashCode == Queued_HASH)
-          {
-            return DeploymentStatus::Queued;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return DeploymentStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return DeploymentStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DeploymentStatus::Failed;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return DeploymentStatus::Stopped;
-          }
-          else if (hashCode == Ready_HASH)
-          {
-            return DeploymentStatus::Ready;
+          case Created_HASH:
+            if (name == "Created")
+            {
+              return DeploymentStatus::Created;
+            }
+            break;
+          case Queued_HASH:
+            if (name == "Queued")
+            {
+              return DeploymentStatus::Queued;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return DeploymentStatus::InProgress;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return DeploymentStatus::Succeeded;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return DeploymentStatus::Failed;
+            }
+            break;
+          case Stopped_HASH:
+            if (name == "Stopped")
+            {
+              return DeploymentStatus::Stopped;
+            }
+            break;
+          case Ready_HASH:
+            if (name == "Ready")
+            {
+              return DeploymentStatus::Ready;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return DeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentStatus(DeploymentStatus enumValue)
+        const char* GetNameForDeploymentStatus(DeploymentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DeploymentTypeMapper
       {
 
-        static const int IN_PLACE_HASH = HashingUtils::HashString("IN_PLACE");
-        static const int BLUE_GREEN_HASH = HashingUtils::HashString("BLUE_GREEN");
+        static constexpr int IN_PLACE_HASH = HashingUtils::CompileTimeHashString("IN_PLACE");
+        static constexpr int BLUE_GREEN_HASH = HashingUtils::CompileTimeHashString("BLUE_GREEN");
 
 
         DeploymentType GetDeploymentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PLACE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeploymentType::IN_PLACE;
-          }
-          else if (hashCode == BLUE_GREEN_HASH)
-          {
-            return DeploymentType::BLUE_GREEN;
+          case IN_PLACE_HASH:
+            if (name == "IN_PLACE")
+            {
+              return DeploymentType::IN_PLACE;
+            }
+            break;
+          case BLUE_GREEN_HASH:
+            if (name == "BLUE_GREEN")
+            {
+              return DeploymentType::BLUE_GREEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeploymentType::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentType(DeploymentType enumValue)
+        const char* GetNameForDeploymentType(DeploymentType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,140 +30,198 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int DEPLOYMENT_GROUP_MISSING_HASH = HashingUtils::HashString("DEPLOYMENT_GROUP_MISSING");
-        static const int APPLICATION_MISSING_HASH = HashingUtils::HashString("APPLICATION_MISSING");
-        static const int REVISION_MISSING_HASH = HashingUtils::HashString("REVISION_MISSING");
-        static const int IAM_ROLE_MISSING_HASH = HashingUtils::HashString("IAM_ROLE_MISSING");
-        static const int IAM_ROLE_PERMISSIONS_HASH = HashingUtils::HashString("IAM_ROLE_PERMISSIONS");
-        static const int NO_EC2_SUBSCRIPTION_HASH = HashingUtils::HashString("NO_EC2_SUBSCRIPTION");
-        static const int OVER_MAX_INSTANCES_HASH = HashingUtils::HashString("OVER_MAX_INSTANCES");
-        static const int NO_INSTANCES_HASH = HashingUtils::HashString("NO_INSTANCES");
-        static const int TIMEOUT_HASH = HashingUtils::HashString("TIMEOUT");
-        static const int HEALTH_CONSTRAINTS_INVALID_HASH = HashingUtils::HashString("HEALTH_CONSTRAINTS_INVALID");
-        static const int HEALTH_CONSTRAINTS_HASH = HashingUtils::HashString("HEALTH_CONSTRAINTS");
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int THROTTLED_HASH = HashingUtils::HashString("THROTTLED");
-        static const int ALARM_ACTIVE_HASH = HashingUtils::HashString("ALARM_ACTIVE");
-        static const int AGENT_ISSUE_HASH = HashingUtils::HashString("AGENT_ISSUE");
-        static const int AUTO_SCALING_IAM_ROLE_PERMISSIONS_HASH = HashingUtils::HashString("AUTO_SCALING_IAM_ROLE_PERMISSIONS");
-        static const int AUTO_SCALING_CONFIGURATION_HASH = HashingUtils::HashString("AUTO_SCALING_CONFIGURATION");
-        static const int MANUAL_STOP_HASH = HashingUtils::HashString("MANUAL_STOP");
-        static const int MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION_HASH = HashingUtils::HashString("MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION");
-        static const int MISSING_ELB_INFORMATION_HASH = HashingUtils::HashString("MISSING_ELB_INFORMATION");
-        static const int MISSING_GITHUB_TOKEN_HASH = HashingUtils::HashString("MISSING_GITHUB_TOKEN");
-        static const int ELASTIC_LOAD_BALANCING_INVALID_HASH = HashingUtils::HashString("ELASTIC_LOAD_BALANCING_INVALID");
-        static const int ELB_INVALID_INSTANCE_HASH = HashingUtils::HashString("ELB_INVALID_INSTANCE");
-        static const int INVALID_LAMBDA_CONFIGURATION_HASH = HashingUtils::HashString("INVALID_LAMBDA_CONFIGURATION");
-        static const int INVALID_LAMBDA_FUNCTION_HASH = HashingUtils::HashString("INVALID_LAMBDA_FUNCTION");
-        static const int HOOK_EXECUTION_FAILURE_HASH = HashingUtils::HashString("HOOK_EXECUTION_FAILURE");
+        static constexpr int DEPLOYMENT_GROUP_MISSING_HASH = HashingUtils::CompileTimeHashString("DEPLOYMENT_GROUP_MISSING");
+        static constexpr int APPLICATION_MISSING_HASH = HashingUtils::CompileTimeHashString("APPLICATION_MISSING");
+        static constexpr int REVISION_MISSING_HASH = HashingUtils::CompileTimeHashString("REVISION_MISSING");
+        static constexpr int IAM_ROLE_MISSING_HASH = HashingUtils::CompileTimeHashString("IAM_ROLE_MISSING");
+        static constexpr int IAM_ROLE_PERMISSIONS_HASH = HashingUtils::CompileTimeHashString("IAM_ROLE_PERMISSIONS");
+        static constexpr int NO_EC2_SUBSCRIPTION_HASH = HashingUtils::CompileTimeHashString("NO_EC2_SUBSCRIPTION");
+        static constexpr int OVER_MAX_INSTANCES_HASH = HashingUtils::CompileTimeHashString("OVER_MAX_INSTANCES");
+        static constexpr int NO_INSTANCES_HASH = HashingUtils::CompileTimeHashString("NO_INSTANCES");
+        static constexpr int TIMEOUT_HASH = HashingUtils::CompileTimeHashString("TIMEOUT");
+        static constexpr int HEALTH_CONSTRAINTS_INVALID_HASH = HashingUtils::CompileTimeHashString("HEALTH_CONSTRAINTS_INVALID");
+        static constexpr int HEALTH_CONSTRAINTS_HASH = HashingUtils::CompileTimeHashString("HEALTH_CONSTRAINTS");
+        static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_ERROR");
+        static constexpr int THROTTLED_HASH = HashingUtils::CompileTimeHashString("THROTTLED");
+        static constexpr int ALARM_ACTIVE_HASH = HashingUtils::CompileTimeHashString("ALARM_ACTIVE");
+        static constexpr int AGENT_ISSUE_HASH = HashingUtils::CompileTimeHashString("AGENT_ISSUE");
+        static constexpr int AUTO_SCALING_IAM_ROLE_PERMISSIONS_HASH = HashingUtils::CompileTimeHashString("AUTO_SCALING_IAM_ROLE_PERMISSIONS");
+        static constexpr int AUTO_SCALING_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("AUTO_SCALING_CONFIGURATION");
+        static constexpr int MANUAL_STOP_HASH = HashingUtils::CompileTimeHashString("MANUAL_STOP");
+        static constexpr int MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION");
+        static constexpr int MISSING_ELB_INFORMATION_HASH = HashingUtils::CompileTimeHashString("MISSING_ELB_INFORMATION");
+        static constexpr int MISSING_GITHUB_TOKEN_HASH = HashingUtils::CompileTimeHashString("MISSING_GITHUB_TOKEN");
+        static constexpr int ELASTIC_LOAD_BALANCING_INVALID_HASH = HashingUtils::CompileTimeHashString("ELASTIC_LOAD_BALANCING_INVALID");
+        static constexpr int ELB_INVALID_INSTANCE_HASH = HashingUtils::CompileTimeHashString("ELB_INVALID_INSTANCE");
+        static constexpr int INVALID_LAMBDA_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("INVALID_LAMBDA_CONFIGURATION");
+        static constexpr int INVALID_LAMBDA_FUNCTION_HASH = HashingUtils::CompileTimeHashString("INVALID_LAMBDA_FUNCTION");
+        static constexpr int HOOK_EXECUTION_FAILURE_HASH = HashingUtils::CompileTimeHashString("HOOK_EXECUTION_FAILURE");
 
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEPLOYMENT_GROUP_MISSING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ErrorCode::DEPLOYMENT_GROUP_MISSING;
-          }
-          else if (hashCode == APPLICATION_MISSING_HASH)
-          {
-            return ErrorCode::APPLICATION_MISSING;
-          }
-          else if (hashCode == REVISION_MISSING_HASH)
-          {
-            return ErrorCode::REVISION_MISSING;
-          }
-          else if (hashCode == IAM_ROLE_MISSING_HASH)
-          {
-            return ErrorCode::IAM_ROLE_MISSING;
-          }
-          else if (hashCode == IAM_ROLE_PERMISSIONS_HASH)
-          {
-            return ErrorCode::IAM_ROLE_PERMISSIONS;
-          }
-          else if (hashCode == NO_EC2_SUBSCRIPTION_HASH)
-          {
-            return ErrorCode::NO_EC2_SUBSCRIPTION;
-          }
-          else if (hashCode == OVER_MAX_INSTANCES_HASH)
-          {
-            return ErrorCode::OVER_MAX_INSTANCES;
-          }
-          else if (hashCode == NO_INSTANCES_HASH)
-          {
-            return ErrorCode::NO_INSTANCES;
-          }
-          else if (hashCode == TIMEOUT_HASH)
-          {
-            return ErrorCode::TIMEOUT;
-          }
-          else if (hashCode == HEALTH_CONSTRAINTS_INVALID_HASH)
-          {
-            return ErrorCode::HEALTH_CONSTRAINTS_INVALID;
-          }
-          else if (hashCode == HEALTH_CONSTRAINTS_HASH)
-          {
-            return ErrorCode::HEALTH_CONSTRAINTS;
-          }
-          else if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return ErrorCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == THROTTLED_HASH)
-          {
-            return ErrorCode::THROTTLED;
-          }
-          else if (hashCode == ALARM_ACTIVE_HASH)
-          {
-            return ErrorCode::ALARM_ACTIVE;
-          }
-          else if (hashCode == AGENT_ISSUE_HASH)
-          {
-            return ErrorCode::AGENT_ISSUE;
-          }
-          else if (hashCode == AUTO_SCALING_IAM_ROLE_PERMISSIONS_HASH)
-          {
-            return ErrorCode::AUTO_SCALING_IAM_ROLE_PERMISSIONS;
-          }
-          else if (hashCode == AUTO_SCALING_CONFIGURATION_HASH)
-          {
-            return ErrorCode::AUTO_SCALING_CONFIGURATION;
-          }
-          else if (hashCode == MANUAL_STOP_HASH)
-          {
-            return ErrorCode::MANUAL_STOP;
-          }
-          else if (hashCode == MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION_HASH)
-          {
-            return ErrorCode::MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION;
-          }
-          else if (hashCode == MISSING_ELB_INFORMATION_HASH)
-          {
-            return ErrorCode::MISSING_ELB_INFORMATION;
-          }
-          else if (hashCode == MISSING_GITHUB_TOKEN_HASH)
-          {
-            return ErrorCode::MISSING_GITHUB_TOKEN;
-          }
-          else if (hashCode == ELASTIC_LOAD_BALANCING_INVALID_HASH)
-          {
-            return ErrorCode::ELASTIC_LOAD_BALANCING_INVALID;
-          }
-          else if (hashCode == ELB_INVALID_INSTANCE_HASH)
-          {
-            return ErrorCode::ELB_INVALID_INSTANCE;
-          }
-          else if (hashCode == INVALID_LAMBDA_CONFIGURATION_HASH)
-          {
-            return ErrorCode::INVALID_LAMBDA_CONFIGURATION;
-          }
-          else if (hashCode == INVALID_LAMBDA_FUNCTION_HASH)
-          {
-            return ErrorCode::INVALID_LAMBDA_FUNCTION;
-          }
-          else if (hashCode == HOOK_EXECUTION_FAILURE_HASH)
-          {
-            return ErrorCode::HOOK_EXECUTION_FAILURE;
+          case DEPLOYMENT_GROUP_MISSING_HASH:
+            if (name == "DEPLOYMENT_GROUP_MISSING")
+            {
+              return ErrorCode::DEPLOYMENT_GROUP_MISSING;
+            }
+            break;
+          case APPLICATION_MISSING_HASH:
+            if (name == "APPLICATION_MISSING")
+            {
+              return ErrorCode::APPLICATION_MISSING;
+            }
+            break;
+          case REVISION_MISSING_HASH:
+            if (name == "REVISION_MISSING")
+            {
+              return ErrorCode::REVISION_MISSING;
+            }
+            break;
+          case IAM_ROLE_MISSING_HASH:
+            if (name == "IAM_ROLE_MISSING")
+            {
+              return ErrorCode::IAM_ROLE_MISSING;
+            }
+            break;
+          case IAM_ROLE_PERMISSIONS_HASH:
+            if (name == "IAM_ROLE_PERMISSIONS")
+            {
+              return ErrorCode::IAM_ROLE_PERMISSIONS;
+            }
+            break;
+          case NO_EC2_SUBSCRIPTION_HASH:
+            if (name == "NO_EC2_SUBSCRIPTION")
+            {
+              return ErrorCode::NO_EC2_SUBSCRIPTION;
+            }
+            break;
+          case OVER_MAX_INSTANCES_HASH:
+            if (name == "OVER_MAX_INSTANCES")
+            {
+              return ErrorCode::OVER_MAX_INSTANCES;
+            }
+            break;
+          case NO_INSTANCES_HASH:
+            if (name == "NO_INSTANCES")
+            {
+              return ErrorCode::NO_INSTANCES;
+            }
+            break;
+          case TIMEOUT_HASH:
+            if (name == "TIMEOUT")
+            {
+              return ErrorCode::TIMEOUT;
+            }
+            break;
+          case HEALTH_CONSTRAINTS_INVALID_HASH:
+            if (name == "HEALTH_CONSTRAINTS_INVALID")
+            {
+              return ErrorCode::HEALTH_CONSTRAINTS_INVALID;
+            }
+            break;
+          case HEALTH_CONSTRAINTS_HASH:
+            if (name == "HEALTH_CONSTRAINTS")
+            {
+              return ErrorCode::HEALTH_CONSTRAINTS;
+            }
+            break;
+          case INTERNAL_ERROR_HASH:
+            if (name == "INTERNAL_ERROR")
+            {
+              return ErrorCode::INTERNAL_ERROR;
+            }
+            break;
+          case THROTTLED_HASH:
+            if (name == "THROTTLED")
+            {
+              return ErrorCode::THROTTLED;
+            }
+            break;
+          case ALARM_ACTIVE_HASH:
+            if (name == "ALARM_ACTIVE")
+            {
+              return ErrorCode::ALARM_ACTIVE;
+            }
+            break;
+          case AGENT_ISSUE_HASH:
+            if (name == "AGENT_ISSUE")
+            {
+              return ErrorCode::AGENT_ISSUE;
+            }
+            break;
+          case AUTO_SCALING_IAM_ROLE_PERMISSIONS_HASH:
+            if (name == "AUTO_SCALING_IAM_ROLE_PERMISSIONS")
+            {
+              return ErrorCode::AUTO_SCALING_IAM_ROLE_PERMISSIONS;
+            }
+            break;
+          case AUTO_SCALING_CONFIGURATION_HASH:
+            if (name == "AUTO_SCALING_CONFIGURATION")
+            {
+              return ErrorCode::AUTO_SCALING_CONFIGURATION;
+            }
+            break;
+          case MANUAL_STOP_HASH:
+            if (name == "MANUAL_STOP")
+            {
+              return ErrorCode::MANUAL_STOP;
+            }
+            break;
+          case MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION_HASH:
+            if (name == "MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION")
+            {
+              return ErrorCode::MISSING_BLUE_GREEN_DEPLOYMENT_CONFIGURATION;
+            }
+            break;
+          case MISSING_ELB_INFORMATION_HASH:
+            if (name == "MISSING_ELB_INFORMATION")
+            {
+              return ErrorCode::MISSING_ELB_INFORMATION;
+            }
+            break;
+          case MISSING_GITHUB_TOKEN_HASH:
+            if (name == "MISSING_GITHUB_TOKEN")
+            {
+              return ErrorCode::MISSING_GITHUB_TOKEN;
+            }
+            break;
+          case ELASTIC_LOAD_BALANCING_INVALID_HASH:
+            if (name == "ELASTIC_LOAD_BALANCING_INVALID")
+            {
+              return ErrorCode::ELASTIC_LOAD_BALANCING_INVALID;
+            }
+            break;
+          case ELB_INVALID_INSTANCE_HASH:
+            if (name == "ELB_INVALID_INSTANCE")
+            {
+              return ErrorCode::ELB_INVALID_INSTANCE;
+            }
+            break;
+          case INVALID_LAMBDA_CONFIGURATION_HASH:
+            if (name == "INVALID_LAMBDA_CONFIGURATION")
+            {
+              return ErrorCode::INVALID_LAMBDA_CONFIGURATION;
+            }
+            break;
+          case INVALID_LAMBDA_FUNCTION_HASH:
+            if (name == "INVALID_LAMBDA_FUNCTION")
+            {
+              return ErrorCode::INVALID_LAMBDA_FUNCTION;
+            }
+            break;
+          case HOOK_EXECUTION_FAILURE_HASH:
+            if (name == "HOOK_EXECUTION_FAILURE")
+            {
+              return ErrorCode::HOOK_EXECUTION_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -175,7 +233,7 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCode(ErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -235,7 +293,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace FileExistsBehaviorMapper
       {
 
-        static const int DISALLOW_HASH = HashingUtils::HashString("DISALLOW");
-        static const int OVERWRITE_HASH = HashingUtils::HashString("OVERWRITE");
-        static const int RETAIN_HASH = HashingUtils::HashString("RETAIN");
+        static constexpr int DISALLOW_HASH = HashingUtils::CompileTimeHashString("DISALLOW");
+        static constexpr int OVERWRITE_HASH = HashingUtils::CompileTimeHashString("OVERWRITE");
+        static constexpr int RETAIN_HASH = HashingUtils::CompileTimeHashString("RETAIN");
 
 
         FileExistsBehavior GetFileExistsBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISALLOW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FileExistsBehavior::DISALLOW;
-          }
-          else if (hashCode == OVERWRITE_HASH)
-          {
-            return FileExistsBehavior::OVERWRITE;
-          }
-          else if (hashCode == RETAIN_HASH)
-          {
-            return FileExistsBehavior::RETAIN;
+          case DISALLOW_HASH:
+            if (name == "DISALLOW")
+            {
+              return FileExistsBehavior::DISALLOW;
+            }
+            break;
+          case OVERWRITE_HASH:
+            if (name == "OVERWRITE")
+            {
+              return FileExistsBehavior::OVERWRITE;
+            }
+            break;
+          case RETAIN_HASH:
+            if (name == "RETAIN")
+            {
+              return FileExistsBehavior::RETAIN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FileExistsBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForFileExistsBehavior(FileExistsBehavior enumValue)
+        const char* GetNameForFileExistsBehavior(FileExistsBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace GreenFleetProvisioningActionMapper
       {
 
-        static const int DISCOVER_EXISTING_HASH = HashingUtils::HashString("DISCOVER_EXISTING");
-        static const int COPY_AUTO_SCALING_GROUP_HASH = HashingUtils::HashString("COPY_AUTO_SCALING_GROUP");
+        static constexpr int DISCOVER_EXISTING_HASH = HashingUtils::CompileTimeHashString("DISCOVER_EXISTING");
+        static constexpr int COPY_AUTO_SCALING_GROUP_HASH = HashingUtils::CompileTimeHashString("COPY_AUTO_SCALING_GROUP");
 
 
         GreenFleetProvisioningAction GetGreenFleetProvisioningActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISCOVER_EXISTING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GreenFleetProvisioningAction::DISCOVER_EXISTING;
-          }
-          else if (hashCode == COPY_AUTO_SCALING_GROUP_HASH)
-          {
-            return GreenFleetProvisioningAction::COPY_AUTO_SCALING_GROUP;
+          case DISCOVER_EXISTING_HASH:
+            if (name == "DISCOVER_EXISTING")
+            {
+              return GreenFleetProvisioningAction::DISCOVER_EXISTING;
+            }
+            break;
+          case COPY_AUTO_SCALING_GROUP_HASH:
+            if (name == "COPY_AUTO_SCALING_GROUP")
+            {
+              return GreenFleetProvisioningAction::COPY_AUTO_SCALING_GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return GreenFleetProvisioningAction::NOT_SET;
         }
 
-        Aws::String GetNameForGreenFleetProvisioningAction(GreenFleetProvisioningAction enumValue)
+        const char* GetNameForGreenFleetProvisioningAction(GreenFleetProvisioningAction enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace InstanceActionMapper
       {
 
-        static const int TERMINATE_HASH = HashingUtils::HashString("TERMINATE");
-        static const int KEEP_ALIVE_HASH = HashingUtils::HashString("KEEP_ALIVE");
+        static constexpr int TERMINATE_HASH = HashingUtils::CompileTimeHashString("TERMINATE");
+        static constexpr int KEEP_ALIVE_HASH = HashingUtils::CompileTimeHashString("KEEP_ALIVE");
 
 
         InstanceAction GetInstanceActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceAction::TERMINATE;
-          }
-          else if (hashCode == KEEP_ALIVE_HASH)
-          {
-            return InstanceAction::KEEP_ALIVE;
+          case TERMINATE_HASH:
+            if (name == "TERMINATE")
+            {
+              return InstanceAction::TERMINATE;
+            }
+            break;
+          case KEEP_ALIVE_HASH:
+            if (name == "KEEP_ALIVE")
+            {
+              return InstanceAction::KEEP_ALIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InstanceAction::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceAction(InstanceAction enumValue)
+        const char* GetNameForInstanceAction(InstanceAction enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
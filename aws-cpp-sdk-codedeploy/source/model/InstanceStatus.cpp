@@ -30,45 +30,65 @@ namespace Aws
       namespace InstanceStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Skipped_HASH = HashingUtils::HashString("Skipped");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Skipped_HASH = HashingUtils::CompileTimeHashString("Skipped");
+        static constexpr int Unknown_HASH = HashingUtils::CompileTimeHashString("Unknown");
+        static constexpr int Ready_HASH = HashingUtils::CompileTimeHashString("Ready");
 
 
         InstanceStatus GetInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return InstanceStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return InstanceStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return InstanceStatus::Failed;
-          }
-          else if (hashCode == Skipped_HASH)
-          {
-            return InstanceStatus::Skipped;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return InstanceStatus::Unknown;
-          }
-          else if (hashCode == Ready_HASH)
-          {
-            return InstanceStatus::Ready;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return InstanceStatus::Pending;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return InstanceStatus::InProgress;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return InstanceStatus::Succeeded;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return InstanceStatus::Failed;
+            }
+            break;
+          case Skipped_HASH:
+            if (name == "Skipped")
+            {
+              return InstanceStatus::Skipped;
+            }
+            break;
+          case Unknown_HASH:
+            if (name == "Unknown")
+            {
+              return InstanceStatus::Unknown;
+            }
+            break;
+          case Ready_HASH:
+            if (name == "Ready")
+            {
+              return InstanceStatus::Ready;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return InstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceStatus(InstanceStatus enumValue)
+        const char* GetNameForInstanceStatus(InstanceStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
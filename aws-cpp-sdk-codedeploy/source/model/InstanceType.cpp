@@ -30,20 +30,30 @@ namespace Aws
       namespace InstanceTypeMapper
       {
 
-        static const int Blue_HASH = HashingUtils::HashString("Blue");
-        static const int Green_HASH = HashingUtils::HashString("Green");
+        static constexpr int Blue_HASH = HashingUtils::CompileTimeHashString("Blue");
+        static constexpr int Green_HASH = HashingUtils::CompileTimeHashString("Green");
 
 
         InstanceType GetInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Blue_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceType::Blue;
-          }
-          else if (hashCode == Green_HASH)
-          {
-            return InstanceType::Green;
+          case Blue_HASH:
+            if (name == "Blue")
+            {
+              return InstanceType::Blue;
+            }
+            break;
+          case Green_HASH:
+            if (name == "Green")
+            {
+              return InstanceType::Green;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceType(InstanceType enumValue)
+        const char* GetNameForInstanceType(InstanceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace LifecycleErrorCodeMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int ScriptMissing_HASH = HashingUtils::HashString("ScriptMissing");
-        static const int ScriptNotExecutable_HASH = HashingUtils::HashString("ScriptNotExecutable");
-        static const int ScriptTimedOut_HASH = HashingUtils::HashString("ScriptTimedOut");
-        static const int ScriptFailed_HASH = HashingUtils::HashString("ScriptFailed");
-        static const int UnknownError_HASH = HashingUtils::HashString("UnknownError");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int ScriptMissing_HASH = HashingUtils::CompileTimeHashString("ScriptMissing");
+        static constexpr int ScriptNotExecutable_HASH = HashingUtils::CompileTimeHashString("ScriptNotExecutable");
+        static constexpr int ScriptTimedOut_HASH = HashingUtils::CompileTimeHashString("ScriptTimedOut");
+        static constexpr int ScriptFailed_HASH = HashingUtils::CompileTimeHashString("ScriptFailed");
+        static constexpr int UnknownError_HASH = HashingUtils::CompileTimeHashString("UnknownError");
 
 
         LifecycleErrorCode GetLifecycleErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LifecycleErrorCode::Success;
-          }
-          else if (hashCode == ScriptMissing_HASH)
-          {
-            return LifecycleErrorCode::ScriptMissing;
-          }
-          else if (hashCode == ScriptNotExecutable_HASH)
-          {
-            return LifecycleErrorCode::ScriptNotExecutable;
-          }
-          else if (hashCode == ScriptTimedOut_HASH)
-          {
-            return LifecycleErrorCode::ScriptTimedOut;
-          }
-          else if (hashCode == ScriptFailed_HASH)
-          {
-            return LifecycleErrorCode::ScriptFailed;
-          }
-          else if (hashCode == UnknownError_HASH)
-          {
-            return LifecycleErrorCode::UnknownError;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return LifecycleErrorCode::Success;
+            }
+            break;
+          case ScriptMissing_HASH:
+            if (name == "ScriptMissing")
+            {
+              return LifecycleErrorCode::ScriptMissing;
+            }
+            break;
+          case ScriptNotExecutable_HASH:
+            if (name == "ScriptNotExecutable")
+            {
+              return LifecycleErrorCode::ScriptNotExecutable;
+            }
+            break;
+          case ScriptTimedOut_HASH:
+            if (name == "ScriptTimedOut")
+            {
+              return LifecycleErrorCode::ScriptTimedOut;
+            }
+            break;
+          case ScriptFailed_HASH:
+            if (name == "ScriptFailed")
+            {
+              return LifecycleErrorCode::ScriptFailed;
+            }
+            break;
+          case UnknownError_HASH:
+            if (name == "UnknownError")
+            {
+              return LifecycleErrorCode::UnknownError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return LifecycleErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForLifecycleErrorCode(LifecycleErrorCode enumValue)
+        const char* GetNameForLifecycleErrorCode(LifecycleErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace LifecycleEventStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Skipped_HASH = HashingUtils::HashString("Skipped");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Skipped_HASH = HashingUtils::CompileTimeHashString("Skipped");
+        static constexpr int Unknown_HASH = HashingUtils::CompileTimeHashString("Unknown");
 
 
         LifecycleEventStatus GetLifecycleEventStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LifecycleEventStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return LifecycleEventStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return LifecycleEventStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return LifecycleEventStatus::Failed;
-          }
-          else if (hashCode == Skipped_HASH)
-          {
-            return LifecycleEventStatus::Skipped;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return LifecycleEventStatus::Unknown;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return LifecycleEventStatus::Pending;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return LifecycleEventStatus::InProgress;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return LifecycleEventStatus::Succeeded;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return LifecycleEventStatus::Failed;
+            }
+            break;
+          case Skipped_HASH:
+            if (name == "Skipped")
+            {
+              return LifecycleEventStatus::Skipped;
+            }
+            break;
+          case Unknown_HASH:
+            if (name == "Unknown")
+            {
+              return LifecycleEventStatus::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return LifecycleEventStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLifecycleEventStatus(LifecycleEventStatus enumValue)
+        const char* GetNameForLifecycleEventStatus(LifecycleEventStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ListStateFilterActionMapper
       {
 
-        static const int include_HASH = HashingUtils::HashString("include");
-        static const int exclude_HASH = HashingUtils::HashString("exclude");
-        static const int ignore_HASH = HashingUtils::HashString("ignore");
+        static constexpr int include_HASH = HashingUtils::CompileTimeHashString("include");
+        static constexpr int exclude_HASH = HashingUtils::CompileTimeHashString("exclude");
+        static constexpr int ignore_HASH = HashingUtils::CompileTimeHashString("ignore");
 
 
         ListStateFilterAction GetListStateFilterActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == include_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ListStateFilterAction::include;
-          }
-          else if (hashCode == exclude_HASH)
-          {
-            return ListStateFilterAction::exclude;
-          }
-          else if (hashCode == ignore_HASH)
-          {
-            return ListStateFilterAction::ignore;
+          case include_HASH:
+            if (name == "include")
+            {
+              return ListStateFilterAction::include;
+            }
+            break;
+          case exclude_HASH:
+            if (name == "exclude")
+            {
+              return ListStateFilterAction::exclude;
+            }
+            break;
+          case ignore_HASH:
+            if (name == "ignore")
+            {
+              return ListStateFilterAction::ignore;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ListStateFilterAction::NOT_SET;
         }
 
-        Aws::String GetNameForListStateFilterAction(ListStateFilterAction enumValue)
+        const char* GetNameForListStateFilterAction(ListStateFilterAction enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
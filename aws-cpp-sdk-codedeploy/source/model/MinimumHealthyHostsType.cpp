@@ -30,20 +30,30 @@ namespace Aws
       namespace MinimumHealthyHostsTypeMapper
       {
 
-        static const int HOST_COUNT_HASH = HashingUtils::HashString("HOST_COUNT");
-        static const int FLEET_PERCENT_HASH = HashingUtils::HashString("FLEET_PERCENT");
+        static constexpr int HOST_COUNT_HASH = HashingUtils::CompileTimeHashString("HOST_COUNT");
+        static constexpr int FLEET_PERCENT_HASH = HashingUtils::CompileTimeHashString("FLEET_PERCENT");
 
 
         MinimumHealthyHostsType GetMinimumHealthyHostsTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOST_COUNT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MinimumHealthyHostsType::HOST_COUNT;
-          }
-          else if (hashCode == FLEET_PERCENT_HASH)
-          {
-            return MinimumHealthyHostsType::FLEET_PERCENT;
+          case HOST_COUNT_HASH:
+            if (name == "HOST_COUNT")
+            {
+              return MinimumHealthyHostsType::HOST_COUNT;
+            }
+            break;
+          case FLEET_PERCENT_HASH:
+            if (name == "FLEET_PERCENT")
+            {
+              return MinimumHealthyHostsType::FLEET_PERCENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MinimumHealthyHostsType::NOT_SET;
         }
 
-        Aws::String GetNameForMinimumHealthyHostsType(MinimumHealthyHostsType enumValue)
+        const char* GetNameForMinimumHealthyHostsType(MinimumHealthyHostsType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
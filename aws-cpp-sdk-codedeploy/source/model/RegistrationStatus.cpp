@@ -30,20 +30,30 @@ namespace Aws
       namespace RegistrationStatusMapper
       {
 
-        static const int Registered_HASH = HashingUtils::HashString("Registered");
-        static const int Deregistered_HASH = HashingUtils::HashString("Deregistered");
+        static constexpr int Registered_HASH = HashingUtils::CompileTimeHashString("Registered");
+        static constexpr int Deregistered_HASH = HashingUtils::CompileTimeHashString("Deregistered");
 
 
         RegistrationStatus GetRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Registered_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RegistrationStatus::Registered;
-          }
-          else if (hashCode == Deregistered_HASH)
-          {
-            return RegistrationStatus::Deregistered;
+          case Registered_HASH:
+            if (name == "Registered")
+            {
+              return RegistrationStatus::Registered;
+            }
+            break;
+          case Deregistered_HASH:
+            if (name == "Deregistered")
+            {
+              return RegistrationStatus::Deregistered;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RegistrationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRegistrationStatus(RegistrationStatus enumValue)
+        const char* GetNameForRegistrationStatus(RegistrationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
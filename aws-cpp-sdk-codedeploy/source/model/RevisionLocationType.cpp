@@ -30,25 +30,37 @@ namespace Aws
       namespace RevisionLocationTypeMapper
       {
 
-        static const int S3_HASH = HashingUtils::HashString("S3");
-        static const int GitHub_HASH = HashingUtils::HashString("GitHub");
-        static const int String_HASH = HashingUtils::HashString("String");
+        static constexpr int S3_HASH = HashingUtils::CompileTimeHashString("S3");
+        static constexpr int GitHub_HASH = HashingUtils::CompileTimeHashString("GitHub");
+        static constexpr int String_HASH = HashingUtils::CompileTimeHashString("String");
 
 
         RevisionLocationType GetRevisionLocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S3_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RevisionLocationType::S3;
-          }
-          else if (hashCode == GitHub_HASH)
-          {
-            return RevisionLocationType::GitHub;
-          }
-          else if (hashCode == String_HASH)
-          {
-            return RevisionLocationType::String;
+          case S3_HASH:
+            if (name == "S3")
+            {
+              return RevisionLocationType::S3;
+            }
+            break;
+          case GitHub_HASH:
+            if (name == "GitHub")
+            {
+              return RevisionLocationType::GitHub;
+            }
+            break;
+          case String_HASH:
+            if (name == "String")
+            {
+              return RevisionLocationType::String;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RevisionLocationType::NOT_SET;
         }
 
-        Aws::String GetNameForRevisionLocationType(RevisionLocationType enumValue)
+        const char* GetNameForRevisionLocationType(RevisionLocationType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace StopStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
 
 
         StopStatus GetStopStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StopStatus::Pending;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return StopStatus::Succeeded;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return StopStatus::Pending;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return StopStatus::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return StopStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStopStatus(StopStatus enumValue)
+        const char* GetNameForStopStatus(StopStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace TagFilterTypeMapper
       {
 
-        static const int KEY_ONLY_HASH = HashingUtils::HashString("KEY_ONLY");
-        static const int VALUE_ONLY_HASH = HashingUtils::HashString("VALUE_ONLY");
-        static const int KEY_AND_VALUE_HASH = HashingUtils::HashString("KEY_AND_VALUE");
+        static constexpr int KEY_ONLY_HASH = HashingUtils::CompileTimeHashString("KEY_ONLY");
+        static constexpr int VALUE_ONLY_HASH = HashingUtils::CompileTimeHashString("VALUE_ONLY");
+        static constexpr int KEY_AND_VALUE_HASH = HashingUtils::CompileTimeHashString("KEY_AND_VALUE");
 
 
         TagFilterType GetTagFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KEY_ONLY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TagFilterType::KEY_ONLY;
-          }
-          else if (hashCode == VALUE_ONLY_HASH)
-          {
-            return TagFilterType::VALUE_ONLY;
-          }
-          else if (hashCode == KEY_AND_VALUE_HASH)
-          {
-            return TagFilterType::KEY_AND_VALUE;
+          case KEY_ONLY_HASH:
+            if (name == "KEY_ONLY")
+            {
+              return TagFilterType::KEY_ONLY;
+            }
+            break;
+          case VALUE_ONLY_HASH:
+            if (name == "VALUE_ONLY")
+            {
+              return TagFilterType::VALUE_ONLY;
+            }
+            break;
+          case KEY_AND_VALUE_HASH:
+            if (name == "KEY_AND_VALUE")
+            {
+              return TagFilterType::KEY_AND_VALUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TagFilterType::NOT_SET;
         }
 
-        Aws::String GetNameForTagFilterType(TagFilterType enumValue)
+        const char* GetNameForTagFilterType(TagFilterType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace TrafficRoutingTypeMapper
       {
 
-        static const int TimeBasedCanary_HASH = HashingUtils::HashString("TimeBasedCanary");
-        static const int TimeBasedLinear_HASH = HashingUtils::HashString("TimeBasedLinear");
-        static const int AllAtOnce_HASH = HashingUtils::HashString("AllAtOnce");
+        static constexpr int TimeBasedCanary_HASH = HashingUtils::CompileTimeHashString("TimeBasedCanary");
+        static constexpr int TimeBasedLinear_HASH = HashingUtils::CompileTimeHashString("TimeBasedLinear");
+        static constexpr int AllAtOnce_HASH = HashingUtils::CompileTimeHashString("AllAtOnce");
 
 
         TrafficRoutingType GetTrafficRoutingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TimeBasedCanary_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TrafficRoutingType::TimeBasedCanary;
-          }
-          else if (hashCode == TimeBasedLinear_HASH)
-          {
-            return TrafficRoutingType::TimeBasedLinear;
-          }
-          else if (hashCode == AllAtOnce_HASH)
-          {
-            return TrafficRoutingType::AllAtOnce;
+          case TimeBasedCanary_HASH:
+            if (name == "TimeBasedCanary")
+            {
+              return TrafficRoutingType::TimeBasedCanary;
+            }
+            break;
+          case TimeBasedLinear_HASH:
+            if (name == "TimeBasedLinear")
+            {
+              return TrafficRoutingType::TimeBasedLinear;
+            }
+            break;
+          case AllAtOnce_HASH:
+            if (name == "AllAtOnce")
+            {
+              return TrafficRoutingType::AllAtOnce;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TrafficRoutingType::NOT_SET;
         }
 
-        Aws::String GetNameForTrafficRoutingType(TrafficRoutingType enumValue)
+        const char* GetNameForTrafficRoutingType(TrafficRoutingType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,60 +30,86 @@ namespace Aws
       namespace TriggerEventTypeMapper
       {
 
-        static const int DeploymentStart_HASH = HashingUtils::HashString("DeploymentStart");
-        static const int DeploymentSuccess_HASH = HashingUtils::HashString("DeploymentSuccess");
-        static const int DeploymentFailure_HASH = HashingUtils::HashString("DeploymentFailure");
-        static const int DeploymentStop_HASH = HashingUtils::HashString("DeploymentStop");
-        static const int DeploymentRollback_HASH = HashingUtils::HashString("DeploymentRollback");
-        static const int DeploymentReady_HASH = HashingUtils::HashString("DeploymentReady");
-        static const int InstanceStart_HASH = HashingUtils::HashString("InstanceStart");
-        static const int InstanceSuccess_HASH = HashingUtils::HashString("InstanceSuccess");
-        static const int InstanceFailure_HASH = HashingUtils::HashString("InstanceFailure");
-        static const int InstanceReady_HASH = HashingUtils::HashString("InstanceReady");
+        static constexpr int DeploymentStart_HASH = HashingUtils::CompileTimeHashString("DeploymentStart");
+        static constexpr int DeploymentSuccess_HASH = HashingUtils::CompileTimeHashString("DeploymentSuccess");
+        static constexpr int DeploymentFailure_HASH = HashingUtils::CompileTimeHashString("DeploymentFailure");
+        static constexpr int DeploymentStop_HASH = HashingUtils::CompileTimeHashString("DeploymentStop");
+        static constexpr int DeploymentRollback_HASH = HashingUtils::CompileTimeHashString("DeploymentRollback");
+        static constexpr int DeploymentReady_HASH = HashingUtils::CompileTimeHashString("DeploymentReady");
+        static constexpr int InstanceStart_HASH = HashingUtils::CompileTimeHashString("InstanceStart");
+        static constexpr int InstanceSuccess_HASH = HashingUtils::CompileTimeHashString("InstanceSuccess");
+        static constexpr int InstanceFailure_HASH = HashingUtils::CompileTimeHashString("InstanceFailure");
+        static constexpr int InstanceReady_HASH = HashingUtils::CompileTimeHashString("InstanceReady");
 
 
         TriggerEventType GetTriggerEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DeploymentStart_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TriggerEventType::DeploymentStart;
-          }
-          else if (hashCode == DeploymentSuccess_HASH)
-          {
-            return TriggerEventType::DeploymentSuccess;
-          }
-          else if (hashCode == DeploymentFailure_HASH)
-          {
-            return TriggerEventType::DeploymentFailure;
-          }
-          else if (hashCode == DeploymentStop_HASH)
-          {
-            return TriggerEventType::DeploymentStop;
-          }
-          else if (hashCode == DeploymentRollback_HASH)
-          {
-            return TriggerEventType::DeploymentRollback;
-          }
-          else if (hashCode == DeploymentReady_HASH)
-          {
-            return TriggerEventType::DeploymentReady;
-          }
-          else if (hashCode == InstanceStart_HASH)
-          {
-            return TriggerEventType::InstanceStart;
-          }
-          else if (hashCode == InstanceSuccess_HASH)
-          {
-            return TriggerEventType::InstanceSuccess;
-          }
-          else if (hashCode == InstanceFailure_HASH)
-          {
-            return TriggerEventType::InstanceFailure;
-          }
-          else if (hashCode == InstanceReady_HASH)
-          {
-            return TriggerEventType::InstanceReady;
+          case DeploymentStart_HASH:
+            if (name == "DeploymentStart")
+            {
+              return TriggerEventType::DeploymentStart;
+            }
+            break;
+          case DeploymentSuccess_HASH:
+            if (name == "DeploymentSuccess")
+            {
+              return TriggerEventType::DeploymentSuccess;
+            }
+            break;
+          case DeploymentFailure_HASH:
+            if (name == "DeploymentFailure")
+            {
+              return TriggerEventType::DeploymentFailure;
+            }
+            break;
+          case DeploymentStop_HASH:
+            if (name == "DeploymentStop")
+            {
+              return TriggerEventType::DeploymentStop;
+            }
+            break;
+          case DeploymentRollback_HASH:
+            if (name == "DeploymentRollback")
+            {
+              return TriggerEventType::DeploymentRollback;
+            }
+            break;
+          case DeploymentReady_HASH:
+            if (name == "DeploymentReady")
+            {
+              return TriggerEventType::DeploymentReady;
+            }
+            break;
+          case InstanceStart_HASH:
+            if (name == "InstanceStart")
+            {
+              return TriggerEventType::InstanceStart;
+            }
+            break;
+          case InstanceSuccess_HASH:
+            if (name == "InstanceSuccess")
+            {
+              return TriggerEventType::InstanceSuccess;
+            }
+            break;
+          case InstanceFailure_HASH:
+            if (name == "InstanceFailure")
+            {
+              return TriggerEventType::InstanceFailure;
+            }
+            break;
+          case InstanceReady_HASH:
+            if (name == "InstanceReady")
+            {
+              return TriggerEventType::InstanceReady;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return TriggerEventType::NOT_SET;
         }
 
-        Aws::String GetNameForTriggerEventType(TriggerEventType enumValue)
+        const char* GetNameForTriggerEventType(TriggerEventType enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
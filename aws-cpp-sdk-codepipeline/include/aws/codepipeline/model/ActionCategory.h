@@ -38,7 +38,8 @@ namespace ActionCategoryMapper
 {
 AWS_CODEPIPELINE_API ActionCategory GetActionCategoryForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForActionCategory(ActionCategory value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForActionCategory(ActionCategory value);
 } // namespace ActionCategoryMapper
 } // namespace Model
 } // namespace CodePipeline
@@ -35,7 +35,8 @@ namespace ActionConfigurationPropertyTypeMapper
 {
 AWS_CODEPIPELINE_API ActionConfigurationPropertyType GetActionConfigurationPropertyTypeForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForActionConfigurationPropertyType(ActionConfigurationPropertyType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForActionConfigurationPropertyType(ActionConfigurationPropertyType value);
 } // namespace ActionConfigurationPropertyTypeMapper
 } // namespace Model
 } // namespace CodePipeline
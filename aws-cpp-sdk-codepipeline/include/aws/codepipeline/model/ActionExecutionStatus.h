@@ -35,7 +35,8 @@ namespace ActionExecutionStatusMapper
 {
 AWS_CODEPIPELINE_API ActionExecutionStatus GetActionExecutionStatusForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForActionExecutionStatus(ActionExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForActionExecutionStatus(ActionExecutionStatus value);
 } // namespace ActionExecutionStatusMapper
 } // namespace Model
 } // namespace CodePipeline
@@ -35,7 +35,8 @@ namespace ActionOwnerMapper
 {
 AWS_CODEPIPELINE_API ActionOwner GetActionOwnerForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForActionOwner(ActionOwner value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForActionOwner(ActionOwner value);
 } // namespace ActionOwnerMapper
 } // namespace Model
 } // namespace CodePipeline
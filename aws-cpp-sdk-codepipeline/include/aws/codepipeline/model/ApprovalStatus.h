@@ -34,7 +34,8 @@ namespace ApprovalStatusMapper
 {
 AWS_CODEPIPELINE_API ApprovalStatus GetApprovalStatusForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForApprovalStatus(ApprovalStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForApprovalStatus(ApprovalStatus value);
 } // namespace ApprovalStatusMapper
 } // namespace Model
 } // namespace CodePipeline
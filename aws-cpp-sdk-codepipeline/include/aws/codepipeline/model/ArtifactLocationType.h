@@ -33,7 +33,8 @@ namespace ArtifactLocationTypeMapper
 {
 AWS_CODEPIPELINE_API ArtifactLocationType GetArtifactLocationTypeForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForArtifactLocationType(ArtifactLocationType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForArtifactLocationType(ArtifactLocationType value);
 } // namespace ArtifactLocationTypeMapper
 } // namespace Model
 } // namespace CodePipeline
@@ -33,7 +33,8 @@ namespace ArtifactStoreTypeMapper
 {
 AWS_CODEPIPELINE_API ArtifactStoreType GetArtifactStoreTypeForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForArtifactStoreType(ArtifactStoreType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForArtifactStoreType(ArtifactStoreType value);
 } // namespace ArtifactStoreTypeMapper
 } // namespace Model
 } // namespace CodePipeline
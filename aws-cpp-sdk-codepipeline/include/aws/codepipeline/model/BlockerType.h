@@ -33,7 +33,8 @@ namespace BlockerTypeMapper
 {
 AWS_CODEPIPELINE_API BlockerType GetBlockerTypeForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForBlockerType(BlockerType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForBlockerType(BlockerType value);
 } // namespace BlockerTypeMapper
 } // namespace Model
 } // namespace CodePipeline
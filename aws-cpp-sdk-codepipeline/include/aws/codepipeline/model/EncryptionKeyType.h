@@ -33,7 +33,8 @@ namespace EncryptionKeyTypeMapper
 {
 AWS_CODEPIPELINE_API EncryptionKeyType GetEncryptionKeyTypeForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForEncryptionKeyType(EncryptionKeyType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForEncryptionKeyType(EncryptionKeyType value);
 } // namespace EncryptionKeyTypeMapper
 } // namespace Model
 } // namespace CodePipeline
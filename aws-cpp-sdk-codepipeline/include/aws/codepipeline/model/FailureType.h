@@ -38,7 +38,8 @@ namespace FailureTypeMapper
 {
 AWS_CODEPIPELINE_API FailureType GetFailureTypeForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForFailureType(FailureType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForFailureType(FailureType value);
 } // namespace FailureTypeMapper
 } // namespace Model
 } // namespace CodePipeline
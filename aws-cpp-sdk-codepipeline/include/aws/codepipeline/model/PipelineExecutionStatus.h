@@ -36,7 +36,8 @@ namespace PipelineExecutionStatusMapper
 {
 AWS_CODEPIPELINE_API PipelineExecutionStatus GetPipelineExecutionStatusForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForPipelineExecutionStatus(PipelineExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForPipelineExecutionStatus(PipelineExecutionStatus value);
 } // namespace PipelineExecutionStatusMapper
 } // namespace Model
 } // namespace CodePipeline
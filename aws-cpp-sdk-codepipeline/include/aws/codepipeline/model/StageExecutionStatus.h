@@ -35,7 +35,8 @@ namespace StageExecutionStatusMapper
 {
 AWS_CODEPIPELINE_API StageExecutionStatus GetStageExecutionStatusForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForStageExecutionStatus(StageExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForStageExecutionStatus(StageExecutionStatus value);
 } // namespace StageExecutionStatusMapper
 } // namespace Model
 } // namespace CodePipeline
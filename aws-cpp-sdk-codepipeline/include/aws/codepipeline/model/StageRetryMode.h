@@ -33,7 +33,8 @@ namespace StageRetryModeMapper
 {
 AWS_CODEPIPELINE_API StageRetryMode GetStageRetryModeForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForStageRetryMode(StageRetryMode value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForStageRetryMode(StageRetryMode value);
 } // namespace StageRetryModeMapper
 } // namespace Model
 } // namespace CodePipeline
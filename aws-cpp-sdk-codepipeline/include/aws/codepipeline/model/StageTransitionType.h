@@ -34,7 +34,8 @@ namespace StageTransitionTypeMapper
 {
 AWS_CODEPIPELINE_API StageTransitionType GetStageTransitionTypeForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForStageTransitionType(StageTransitionType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForStageTransitionType(StageTransitionType value);
 } // namespace StageTransitionTypeMapper
 } // namespace Model
 } // namespace CodePipeline
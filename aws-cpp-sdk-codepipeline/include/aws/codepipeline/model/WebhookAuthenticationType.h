@@ -35,7 +35,8 @@ namespace WebhookAuthenticationTypeMapper
 {
 AWS_CODEPIPELINE_API WebhookAuthenticationType GetWebhookAuthenticationTypeForName(const Aws::String& name);
 
-AWS_CODEPIPELINE_API Aws::String GetNameForWebhookAuthenticationType(WebhookAuthenticationType value);
+// names of values not modeled point into the enum overflow container
+AWS_CODEPIPELINE_API const char* GetNameForWebhookAuthenticationType(WebhookAuthenticationType value);
 } // namespace WebhookAuthenticationTypeMapper
 } // namespace Model
 } // namespace CodePipeline
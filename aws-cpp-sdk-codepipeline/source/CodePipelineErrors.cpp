@@ -28,31 +28,31 @@ namespace CodePipeline
 namespace CodePipelineErrorMapper
 {
 
-static const int ACTION_TYPE_NOT_FOUND_HASH = HashingUtils::HashString("ActionTypeNotFoundException");
-static const int INVALID_APPROVAL_TOKEN_HASH = HashingUtils::HashString("InvalidApprovalTokenException");
-static const int INVALID_STAGE_DECLARATION_HASH = HashingUtils::HashString("InvalidStageDeclarationException");
-static const int ACTION_NOT_FOUND_HASH = HashingUtils::HashString("ActionNotFoundException");
-static const int INVALID_WEBHOOK_AUTHENTICATION_PARAMETERS_HASH = HashingUtils::HashString("InvalidWebhookAuthenticationParametersException");
-static const int INVALID_ACTION_DECLARATION_HASH = HashingUtils::HashString("InvalidActionDeclarationException");
-static const int WEBHOOK_NOT_FOUND_HASH = HashingUtils::HashString("WebhookNotFoundException");
-static const int INVALID_JOB_HASH = HashingUtils::HashString("InvalidJobException");
-static const int PIPELINE_EXECUTION_NOT_FOUND_HASH = HashingUtils::HashString("PipelineExecutionNotFoundException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int STAGE_NOT_FOUND_HASH = HashingUtils::HashString("StageNotFoundException");
-static const int STAGE_NOT_RETRYABLE_HASH = HashingUtils::HashString("StageNotRetryableException");
-static const int INVALID_BLOCKER_DECLARATION_HASH = HashingUtils::HashString("InvalidBlockerDeclarationException");
-static const int APPROVAL_ALREADY_COMPLETED_HASH = HashingUtils::HashString("ApprovalAlreadyCompletedException");
-static const int INVALID_NONCE_HASH = HashingUtils::HashString("InvalidNonceException");
-static const int INVALID_CLIENT_TOKEN_HASH = HashingUtils::HashString("InvalidClientTokenException");
-static const int PIPELINE_NAME_IN_USE_HASH = HashingUtils::HashString("PipelineNameInUseException");
-static const int JOB_NOT_FOUND_HASH = HashingUtils::HashString("JobNotFoundException");
-static const int INVALID_JOB_STATE_HASH = HashingUtils::HashString("InvalidJobStateException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int INVALID_STRUCTURE_HASH = HashingUtils::HashString("InvalidStructureException");
-static const int INVALID_WEBHOOK_FILTER_PATTERN_HASH = HashingUtils::HashString("InvalidWebhookFilterPatternException");
-static const int PIPELINE_NOT_FOUND_HASH = HashingUtils::HashString("PipelineNotFoundException");
-static const int PIPELINE_VERSION_NOT_FOUND_HASH = HashingUtils::HashString("PipelineVersionNotFoundException");
-static const int NOT_LATEST_PIPELINE_EXECUTION_HASH = HashingUtils::HashString("NotLatestPipelineExecutionException");
+static constexpr int ACTION_TYPE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ActionTypeNotFoundException");
+static constexpr int INVALID_APPROVAL_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidApprovalTokenException");
+static constexpr int INVALID_STAGE_DECLARATION_HASH = HashingUtils::CompileTimeHashString("InvalidStageDeclarationException");
+static constexpr int ACTION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ActionNotFoundException");
+static constexpr int INVALID_WEBHOOK_AUTHENTICATION_PARAMETERS_HASH = HashingUtils::CompileTimeHashString("InvalidWebhookAuthenticationParametersException");
+static constexpr int INVALID_ACTION_DECLARATION_HASH = HashingUtils::CompileTimeHashString("InvalidActionDeclarationException");
+static constexpr int WEBHOOK_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("WebhookNotFoundException");
+static constexpr int INVALID_JOB_HASH = HashingUtils::CompileTimeHashString("InvalidJobException");
+static constexpr int PIPELINE_EXECUTION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("PipelineExecutionNotFoundException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int STAGE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("StageNotFoundException");
+static constexpr int STAGE_NOT_RETRYABLE_HASH = HashingUtils::CompileTimeHashString("StageNotRetryableException");
+static constexpr int INVALID_BLOCKER_DECLARATION_HASH = HashingUtils::CompileTimeHashString("InvalidBlockerDeclarationException");
+static constexpr int APPROVAL_ALREADY_COMPLETED_HASH = HashingUtils::CompileTimeHashString("ApprovalAlreadyCompletedException");
+static constexpr int INVALID_NONCE_HASH = HashingUtils::CompileTimeHashString("InvalidNonceException");
+static constexpr int INVALID_CLIENT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidClientTokenException");
+static constexpr int PIPELINE_NAME_IN_USE_HASH = HashingUtils::CompileTimeHashString("PipelineNameInUseException");
+static constexpr int JOB_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("JobNotFoundException");
+static constexpr int INVALID_JOB_STATE_HASH = HashingUtils::CompileTimeHashString("InvalidJobStateException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int INVALID_STRUCTURE_HASH = HashingUtils::CompileTimeHashString("InvalidStructureException");
+static constexpr int INVALID_WEBHOOK_FILTER_PATTERN_HASH = HashingUtils::CompileTimeHashString("InvalidWebhookFilterPatternException");
+static constexpr int PIPELINE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("PipelineNotFoundException");
+static constexpr int PIPELINE_VERSION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("PipelineVersionNotFoundException");
+static constexpr int NOT_LATEST_PIPELINE_EXECUTION_HASH = HashingUtils::CompileTimeHashString("NotLatestPipelineExecutionException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,40 +30,58 @@ namespace Aws
       namespace ActionCategoryMapper
       {
 
-        static const int Source_HASH = HashingUtils::HashString("Source");
-        static const int Build_HASH = HashingUtils::HashString("Build");
-        static const int Deploy_HASH = HashingUtils::HashString("Deploy");
-        static const int Test_HASH = HashingUtils::HashString("Test");
-        static const int Invoke_HASH = HashingUtils::HashString("Invoke");
-        static const int Approval_HASH = HashingUtils::HashString("Approval");
+        static constexpr int Source_HASH = HashingUtils::CompileTimeHashString("Source");
+        static constexpr int Build_HASH = HashingUtils::CompileTimeHashString("Build");
+        static constexpr int Deploy_HASH = HashingUtils::CompileTimeHashString("Deploy");
+        static constexpr int Test_HASH = HashingUtils::CompileTimeHashString("Test");
+        static constexpr int Invoke_HASH = HashingUtils::CompileTimeHashString("Invoke");
+        static constexpr int Approval_HASH = HashingUtils::CompileTimeHashString("Approval");
 
 
         ActionCategory GetActionCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Source_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionCategory::Source;
-          }
-          else if (hashCode == Build_HASH)
-          {
-            return ActionCategory::Build;
-          }
-          else if (hashCode == Deploy_HASH)
-          {
-            return ActionCategory::Deploy;
-          }
-          else if (hashCode == Test_HASH)
-          {
-            return ActionCategory::Test;
-          }
-          else if (hashCode == Invoke_HASH)
-          {
-            return ActionCategory::Invoke;
-          }
-          else if (hashCode == Approval_HASH)
-          {
-            return ActionCategory::Approval;
+          case Source_HASH:
+            if (name == "Source")
+            {
+              return ActionCategory::Source;
+            }
+            break;
+          case Build_HASH:
+            if (name == "Build")
+            {
+              return ActionCategory::Build;
+            }
+            break;
+          case Deploy_HASH:
+            if (name == "Deploy")
+            {
+              return ActionCategory::Deploy;
+            }
+            break;
+          case Test_HASH:
+            if (name == "Test")
+            {
+              return ActionCategory::Test;
+            }
+            break;
+          case Invoke_HASH:
+            if (name == "Invoke")
+            {
+              return ActionCategory::Invoke;
+            }
+            break;
+          case Approval_HASH:
+            if (name == "Approval")
+            {
+              return ActionCategory::Approval;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ActionCategory::NOT_SET;
         }
 
-        Aws::String GetNameForActionCategory(ActionCategory enumValue)
+        const char* GetNameForActionCategory(ActionCategory enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ActionConfigurationPropertyTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int Number_HASH = HashingUtils::HashString("Number");
-        static const int Boolean_HASH = HashingUtils::HashString("Boolean");
+        static constexpr int String_HASH = HashingUtils::CompileTimeHashString("String");
+        static constexpr int Number_HASH = HashingUtils::CompileTimeHashString("Number");
+        static constexpr int Boolean_HASH = HashingUtils::CompileTimeHashString("Boolean");
 
 
         ActionConfigurationPropertyType GetActionConfigurationPropertyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionConfigurationPropertyType::String;
-          }
-          else if (hashCode == Number_HASH)
-          {
-            return ActionConfigurationPropertyType::Number;
-          }
-          else if (hashCode == Boolean_HASH)
-          {
-            return ActionConfigurationPropertyType::Boolean;
+          case String_HASH:
+            if (name == "String")
+            {
+              return ActionConfigurationPropertyType::String;
+            }
+            break;
+          case Number_HASH:
+            if (name == "Number")
+            {
+              return ActionConfigurationPropertyType::Number;
+            }
+            break;
+          case Boolean_HASH:
+            if (name == "Boolean")
+            {
+              return ActionConfigurationPropertyType::Boolean;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ActionConfigurationPropertyType::NOT_SET;
         }
 
-        Aws::String GetNameForActionConfigurationPropertyType(ActionConfigurationPropertyType enumValue)
+        const char* GetNameForActionConfigurationPropertyType(ActionConfigurationPropertyType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ActionExecutionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         ActionExecutionStatus GetActionExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionExecutionStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return ActionExecutionStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ActionExecutionStatus::Failed;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return ActionExecutionStatus::InProgress;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return ActionExecutionStatus::Succeeded;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return ActionExecutionStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ActionExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForActionExecutionStatus(ActionExecutionStatus enumValue)
+        const char* GetNameForActionExecutionStatus(ActionExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ActionOwnerMapper
       {
 
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int ThirdParty_HASH = HashingUtils::HashString("ThirdParty");
-        static const int Custom_HASH = HashingUtils::HashString("Custom");
+        static constexpr int AWS_HASH = HashingUtils::CompileTimeHashString("AWS");
+        static constexpr int ThirdParty_HASH = HashingUtils::CompileTimeHashString("ThirdParty");
+        static constexpr int Custom_HASH = HashingUtils::CompileTimeHashString("Custom");
 
 
         ActionOwner GetActionOwnerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionOwner::AWS;
-          }
-          else if (hashCode == ThirdParty_HASH)
-          {
-            return ActionOwner::ThirdParty;
-          }
-          else if (hashCode == Custom_HASH)
-          {
-            return ActionOwner::Custom;
+          case AWS_HASH:
+            if (name == "AWS")
+            {
+              return ActionOwner::AWS;
+            }
+            break;
+          case ThirdParty_HASH:
+            if (name == "ThirdParty")
+            {
+              return ActionOwner::ThirdParty;
+            }
+            break;
+          case Custom_HASH:
+            if (name == "Custom")
+            {
+              return ActionOwner::Custom;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ActionOwner::NOT_SET;
         }
 
-        Aws::String GetNameForActionOwner(ActionOwner enumValue)
+        const char* GetNameForActionOwner(ActionOwner enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
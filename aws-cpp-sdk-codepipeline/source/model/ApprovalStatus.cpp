@@ -30,20 +30,30 @@ namespace Aws
       namespace ApprovalStatusMapper
       {
 
-        static const int Approved_HASH = HashingUtils::HashString("Approved");
-        static const int Rejected_HASH = HashingUtils::HashString("Rejected");
+        static constexpr int Approved_HASH = HashingUtils::CompileTimeHashString("Approved");
+        static constexpr int Rejected_HASH = HashingUtils::CompileTimeHashString("Rejected");
 
 
         ApprovalStatus GetApprovalStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Approved_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ApprovalStatus::Approved;
-          }
-          else if (hashCode == Rejected_HASH)
-          {
-            return ApprovalStatus::Rejected;
+          case Approved_HASH:
+            if (name == "Approved")
+            {
+              return ApprovalStatus::Approved;
+            }
+            break;
+          case Rejected_HASH:
+            if (name == "Rejected")
+            {
+              return ApprovalStatus::Rejected;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ApprovalStatus::NOT_SET;
         }
 
-        Aws::String GetNameForApprovalStatus(ApprovalStatus enumValue)
+        const char* GetNameForApprovalStatus(ApprovalStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
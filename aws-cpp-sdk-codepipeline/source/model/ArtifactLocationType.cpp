@@ -30,15 +30,23 @@ namespace Aws
       namespace ArtifactLocationTypeMapper
       {
 
-        static const int S3_HASH = HashingUtils::HashString("S3");
+        static constexpr int S3_HASH = HashingUtils::CompileTimeHashString("S3");
 
 
         ArtifactLocationType GetArtifactLocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S3_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ArtifactLocationType::S3;
+          case S3_HASH:
+            if (name == "S3")
+            {
+              return ArtifactLocationType::S3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ArtifactLocationType::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactLocationType(ArtifactLocationType enumValue)
+        const char* GetNameForArtifactLocationType(ArtifactLocationType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace BlockerTypeMapper
       {
 
-        static const int Schedule_HASH = HashingUtils::HashString("Schedule");
+        static constexpr int Schedule_HASH = HashingUtils::CompileTimeHashString("Schedule");
 
 
         BlockerType GetBlockerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Schedule_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BlockerType::Schedule;
+          case Schedule_HASH:
+            if (name == "Schedule")
+            {
+              return BlockerType::Schedule;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return BlockerType::NOT_SET;
         }
 
-        Aws::String GetNameForBlockerType(BlockerType enumValue)
+        const char* GetNameForBlockerType(BlockerType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace EncryptionKeyTypeMapper
       {
 
-        static const int KMS_HASH = HashingUtils::HashString("KMS");
+        static constexpr int KMS_HASH = HashingUtils::CompileTimeHashString("KMS");
 
 
         EncryptionKeyType GetEncryptionKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KMS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EncryptionKeyType::KMS;
+          case KMS_HASH:
+            if (name == "KMS")
+            {
+              return EncryptionKeyType::KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return EncryptionKeyType::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionKeyType(EncryptionKeyType enumValue)
+        const char* GetNameForEncryptionKeyType(EncryptionKeyType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
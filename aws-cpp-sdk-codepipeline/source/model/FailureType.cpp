@@ -30,40 +30,58 @@ namespace Aws
       namespace FailureTypeMapper
       {
 
-        static const int JobFailed_HASH = HashingUtils::HashString("JobFailed");
-        static const int ConfigurationError_HASH = HashingUtils::HashString("ConfigurationError");
-        static const int PermissionError_HASH = HashingUtils::HashString("PermissionError");
-        static const int RevisionOutOfSync_HASH = HashingUtils::HashString("RevisionOutOfSync");
-        static const int RevisionUnavailable_HASH = HashingUtils::HashString("RevisionUnavailable");
-        static const int SystemUnavailable_HASH = HashingUtils::HashString("SystemUnavailable");
+        static constexpr int JobFailed_HASH = HashingUtils::CompileTimeHashString("JobFailed");
+        static constexpr int ConfigurationError_HASH = HashingUtils::CompileTimeHashString("ConfigurationError");
+        static constexpr int PermissionError_HASH = HashingUtils::CompileTimeHashString("PermissionError");
+        static constexpr int RevisionOutOfSync_HASH = HashingUtils::CompileTimeHashString("RevisionOutOfSync");
+        static constexpr int RevisionUnavailable_HASH = HashingUtils::CompileTimeHashString("RevisionUnavailable");
+        static constexpr int SystemUnavailable_HASH = HashingUtils::CompileTimeHashString("SystemUnavailable");
 
 
         FailureType GetFailureTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JobFailed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FailureType::JobFailed;
-          }
-          else if (hashCode == ConfigurationError_HASH)
-          {
-            return FailureType::ConfigurationError;
-          }
-          else if (hashCode == PermissionError_HASH)
-          {
-            return FailureType::PermissionError;
-          }
-          else if (hashCode == RevisionOutOfSync_HASH)
-          {
-            return FailureType::RevisionOutOfSync;
-          }
-          else if (hashCode == RevisionUnavailable_HASH)
-          {
-            return FailureType::RevisionUnavailable;
-          }
-          else if (hashCode == SystemUnavailable_HASH)
-          {
-            return FailureType::SystemUnavailable;
+          case JobFailed_HASH:
+            if (name == "JobFailed")
+            {
+              return FailureType::JobFailed;
+            }
+            break;
+          case ConfigurationError_HASH:
+            if (name == "ConfigurationError")
+            {
+              return FailureType::ConfigurationError;
+            }
+            break;
+          case PermissionError_HASH:
+            if (name == "PermissionError")
+            {
+              return FailureType::PermissionError;
+            }
+            break;
+          case RevisionOutOfSync_HASH:
+            if (name == "RevisionOutOfSync")
+            {
+              return FailureType::RevisionOutOfSync;
+            }
+            break;
+          case RevisionUnavailable_HASH:
+            if (name == "RevisionUnavailable")
+            {
+              return FailureType::RevisionUnavailable;
+            }
+            break;
+          case SystemUnavailable_HASH:
+            if (name == "SystemUnavailable")
+            {
+              return FailureType::SystemUnavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return FailureType::NOT_SET;
         }
 
-        Aws::String GetNameForFailureType(FailureType enumValue)
+        const char* GetNameForFailureType(FailureType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
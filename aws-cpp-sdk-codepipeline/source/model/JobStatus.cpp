@@ -30,45 +30,65 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Queued_HASH = HashingUtils::HashString("Queued");
-        static const int Dispatched_HASH = HashingUtils::HashString("Dispatched");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Created_HASH = HashingUtils::CompileTimeHashString("Created");
+        static constexpr int Queued_HASH = HashingUtils::CompileTimeHashString("Queued");
+        static constexpr int Dispatched_HASH = HashingUtils::CompileTimeHashString("Dispatched");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int TimedOut_HASH = HashingUtils::CompileTimeHashString("TimedOut");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Created_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobStatus::Created;
-          }
-          else if (hashCode == Queued_HASH)
-          {
-            return JobStatus::Queued;
-          }
-          else if (hashCode == Dispatched_HASH)
-          {
-            return JobStatus::Dispatched;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return JobStatus::InProgress;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return JobStatus::TimedOut;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return JobStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return JobStatus::Failed;
+          case Created_HASH:
+            if (name == "Created")
+            {
+              return JobStatus::Created;
+            }
+            break;
+          case Queued_HASH:
+            if (name == "Queued")
+            {
+              return JobStatus::Queued;
+            }
+            break;
+          case Dispatched_HASH:
+            if (name == "Dispatched")
+            {
+              return JobStatus::Dispatched;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return JobStatus::InProgress;
+            }
+            break;
+          case TimedOut_HASH:
+            if (name == "TimedOut")
+            {
+              return JobStatus::TimedOut;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return JobStatus::Succeeded;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return JobStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatus(JobStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
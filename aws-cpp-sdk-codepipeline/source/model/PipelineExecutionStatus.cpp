@@ -30,30 +30,44 @@ namespace Aws
       namespace PipelineExecutionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Superseded_HASH = HashingUtils::HashString("Superseded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
+        static constexpr int Superseded_HASH = HashingUtils::CompileTimeHashString("Superseded");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         PipelineExecutionStatus GetPipelineExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PipelineExecutionStatus::InProgress;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return PipelineExecutionStatus::Succeeded;
-          }
-          else if (hashCode == Superseded_HASH)
-          {
-            return PipelineExecutionStatus::Superseded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return PipelineExecutionStatus::Failed;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return PipelineExecutionStatus::InProgress;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return PipelineExecutionStatus::Succeeded;
+            }
+            break;
+          case Superseded_HASH:
+            if (name == "Superseded")
+            {
+              return PipelineExecutionStatus::Superseded;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return PipelineExecutionStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return PipelineExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPipelineExecutionStatus(PipelineExecutionStatus enumValue)
+        const char* GetNameForPipelineExecutionStatus(PipelineExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace StageExecutionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
 
 
         StageExecutionStatus GetStageExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StageExecutionStatus::InProgress;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return StageExecutionStatus::Failed;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return StageExecutionStatus::Succeeded;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return StageExecutionStatus::InProgress;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return StageExecutionStatus::Failed;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return StageExecutionStatus::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return StageExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStageExecutionStatus(StageExecutionStatus enumValue)
+        const char* GetNameForStageExecutionStatus(StageExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
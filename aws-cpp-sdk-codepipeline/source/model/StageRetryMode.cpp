@@ -30,15 +30,23 @@ namespace Aws
       namespace StageRetryModeMapper
       {
 
-        static const int FAILED_ACTIONS_HASH = HashingUtils::HashString("FAILED_ACTIONS");
+        static constexpr int FAILED_ACTIONS_HASH = HashingUtils::CompileTimeHashString("FAILED_ACTIONS");
 
 
         StageRetryMode GetStageRetryModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAILED_ACTIONS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StageRetryMode::FAILED_ACTIONS;
+          case FAILED_ACTIONS_HASH:
+            if (name == "FAILED_ACTIONS")
+            {
+              return StageRetryMode::FAILED_ACTIONS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return StageRetryMode::NOT_SET;
         }
 
-        Aws::String GetNameForStageRetryMode(StageRetryMode enumValue)
+        const char* GetNameForStageRetryMode(StageRetryMode enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
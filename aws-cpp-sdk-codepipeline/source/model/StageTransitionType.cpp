@@ -30,20 +30,30 @@ namespace Aws
       namespace StageTransitionTypeMapper
       {
 
-        static const int Inbound_HASH = HashingUtils::HashString("Inbound");
-        static const int Outbound_HASH = HashingUtils::HashString("Outbound");
+        static constexpr int Inbound_HASH = HashingUtils::CompileTimeHashString("Inbound");
+        static constexpr int Outbound_HASH = HashingUtils::CompileTimeHashString("Outbound");
 
 
         StageTransitionType GetStageTransitionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Inbound_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StageTransitionType::Inbound;
-          }
-          else if (hashCode == Outbound_HASH)
-          {
-            return StageTransitionType::Outbound;
+          case Inbound_HASH:
+            if (name == "Inbound")
+            {
+              return StageTransitionType::Inbound;
+            }
+            break;
+          case Outbound_HASH:
+            if (name == "Outbound")
+            {
+              return StageTransitionType::Outbound;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return StageTransitionType::NOT_SET;
         }
 
-        Aws::String GetNameForStageTransitionType(StageTransitionType enumValue)
+        const char* GetNameForStageTransitionType(StageTransitionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace WebhookAuthenticationTypeMapper
       {
 
-        static const int GITHUB_HMAC_HASH = HashingUtils::HashString("GITHUB_HMAC");
-        static const int IP_HASH = HashingUtils::HashString("IP");
-        static const int UNAUTHENTICATED_HASH = HashingUtils::HashString("UNAUTHENTICATED");
+        static constexpr int GITHUB_HMAC_HASH = HashingUtils::CompileTimeHashString("GITHUB_HMAC");
+        static constexpr int IP_HASH = HashingUtils::CompileTimeHashString("IP");
+        static constexpr int UNAUTHENTICATED_HASH = HashingUtils::CompileTimeHashString("UNAUTHENTICATED");
 
 
         WebhookAuthenticationType GetWebhookAuthenticationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GITHUB_HMAC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WebhookAuthenticationType::GITHUB_HMAC;
-          }
-          else if (hashCode == IP_HASH)
-          {
-            return WebhookAuthenticationType::IP;
-          }
-          else if (hashCode == UNAUTHENTICATED_HASH)
-          {
-            return WebhookAuthenticationType::UNAUTHENTICATED;
+          case GITHUB_HMAC_HASH:
+            if (name == "GITHUB_HMAC")
+            {
+              return WebhookAuthenticationType::GITHUB_HMAC;
+            }
+            break;
+          case IP_HASH:
+            if (name == "IP")
+            {
+              return WebhookAuthenticationType::IP;
+            }
+            break;
+          case UNAUTHENTICATED_HASH:
+            if (name == "UNAUTHENTICATED")
+            {
+              return WebhookAuthenticationType::UNAUTHENTICATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return WebhookAuthenticationType::NOT_SET;
         }
 
-        Aws::String GetNameForWebhookAuthenticationType(WebhookAuthenticationType enumValue)
+        const char* GetNameForWebhookAuthenticationType(WebhookAuthenticationType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
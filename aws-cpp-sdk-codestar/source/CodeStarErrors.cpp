@@ -28,18 +28,18 @@ namespace CodeStar
 namespace CodeStarErrorMapper
 {
 
-static const int TEAM_MEMBER_NOT_FOUND_HASH = HashingUtils::HashString("TeamMemberNotFoundException");
-static const int INVALID_SERVICE_ROLE_HASH = HashingUtils::HashString("InvalidServiceRoleException");
-static const int PROJECT_NOT_FOUND_HASH = HashingUtils::HashString("ProjectNotFoundException");
-static const int TEAM_MEMBER_ALREADY_ASSOCIATED_HASH = HashingUtils::HashString("TeamMemberAlreadyAssociatedException");
-static const int PROJECT_ALREADY_EXISTS_HASH = HashingUtils::HashString("ProjectAlreadyExistsException");
-static const int USER_PROFILE_ALREADY_EXISTS_HASH = HashingUtils::HashString("UserProfileAlreadyExistsException");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int PROJECT_CREATION_FAILED_HASH = HashingUtils::HashString("ProjectCreationFailedException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int PROJECT_CONFIGURATION_HASH = HashingUtils::HashString("ProjectConfigurationException");
-static const int USER_PROFILE_NOT_FOUND_HASH = HashingUtils::HashString("UserProfileNotFoundException");
+static constexpr int TEAM_MEMBER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("TeamMemberNotFoundException");
+static constexpr int INVALID_SERVICE_ROLE_HASH = HashingUtils::CompileTimeHashString("InvalidServiceRoleException");
+static constexpr int PROJECT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ProjectNotFoundException");
+static constexpr int TEAM_MEMBER_ALREADY_ASSOCIATED_HASH = HashingUtils::CompileTimeHashString("TeamMemberAlreadyAssociatedException");
+static constexpr int PROJECT_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ProjectAlreadyExistsException");
+static constexpr int USER_PROFILE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("UserProfileAlreadyExistsException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int PROJECT_CREATION_FAILED_HASH = HashingUtils::CompileTimeHashString("ProjectCreationFailedException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int PROJECT_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("ProjectConfigurationException");
+static constexpr int USER_PROFILE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("UserProfileNotFoundException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -34,7 +34,8 @@ namespace AmbiguousRoleResolutionTypeMapper
 {
 AWS_COGNITOIDENTITY_API AmbiguousRoleResolutionType GetAmbiguousRoleResolutionTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITY_API Aws::String GetNameForAmbiguousRoleResolutionType(AmbiguousRoleResolutionType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITY_API const char* GetNameForAmbiguousRoleResolutionType(AmbiguousRoleResolutionType value);
 } // namespace AmbiguousRoleResolutionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentity
@@ -34,7 +34,8 @@ namespace ErrorCodeMapper
 {
 AWS_COGNITOIDENTITY_API ErrorCode GetErrorCodeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITY_API Aws::String GetNameForErrorCode(ErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITY_API const char* GetNameForErrorCode(ErrorCode value);
 } // namespace ErrorCodeMapper
 } // namespace Model
 } // namespace CognitoIdentity
@@ -36,7 +36,8 @@ namespace MappingRuleMatchTypeMapper
 {
 AWS_COGNITOIDENTITY_API MappingRuleMatchType GetMappingRuleMatchTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITY_API Aws::String GetNameForMappingRuleMatchType(MappingRuleMatchType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITY_API const char* GetNameForMappingRuleMatchType(MappingRuleMatchType value);
 } // namespace MappingRuleMatchTypeMapper
 } // namespace Model
 } // namespace CognitoIdentity
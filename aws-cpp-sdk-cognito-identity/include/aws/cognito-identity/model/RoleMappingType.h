@@ -34,7 +34,8 @@ namespace RoleMappingTypeMapper
 {
 AWS_COGNITOIDENTITY_API RoleMappingType GetRoleMappingTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITY_API Aws::String GetNameForRoleMappingType(RoleMappingType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITY_API const char* GetNameForRoleMappingType(RoleMappingType value);
 } // namespace RoleMappingTypeMapper
 } // namespace Model
 } // namespace CognitoIdentity
@@ -28,16 +28,16 @@ namespace CognitoIdentity
 namespace CognitoIdentityErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int RESOURCE_CONFLICT_HASH = HashingUtils::HashString("ResourceConflictException");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int INVALID_IDENTITY_POOL_CONFIGURATION_HASH = HashingUtils::HashString("InvalidIdentityPoolConfigurationException");
-static const int EXTERNAL_SERVICE_HASH = HashingUtils::HashString("ExternalServiceException");
-static const int DEVELOPER_USER_ALREADY_REGISTERED_HASH = HashingUtils::HashString("DeveloperUserAlreadyRegisteredException");
-static const int NOT_AUTHORIZED_HASH = HashingUtils::HashString("NotAuthorizedException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalErrorException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int RESOURCE_CONFLICT_HASH = HashingUtils::CompileTimeHashString("ResourceConflictException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int INVALID_IDENTITY_POOL_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("InvalidIdentityPoolConfigurationException");
+static constexpr int EXTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("ExternalServiceException");
+static constexpr int DEVELOPER_USER_ALREADY_REGISTERED_HASH = HashingUtils::CompileTimeHashString("DeveloperUserAlreadyRegisteredException");
+static constexpr int NOT_AUTHORIZED_HASH = HashingUtils::CompileTimeHashString("NotAuthorizedException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalErrorException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
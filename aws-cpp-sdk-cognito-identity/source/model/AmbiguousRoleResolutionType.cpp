@@ -30,20 +30,30 @@ namespace Aws
       namespace AmbiguousRoleResolutionTypeMapper
       {
 
-        static const int AuthenticatedRole_HASH = HashingUtils::HashString("AuthenticatedRole");
-        static const int Deny_HASH = HashingUtils::HashString("Deny");
+        static constexpr int AuthenticatedRole_HASH = HashingUtils::CompileTimeHashString("AuthenticatedRole");
+        static constexpr int Deny_HASH = HashingUtils::CompileTimeHashString("Deny");
 
 
         AmbiguousRoleResolutionType GetAmbiguousRoleResolutionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AuthenticatedRole_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AmbiguousRoleResolutionType::AuthenticatedRole;
-          }
-          else if (hashCode == Deny_HASH)
-          {
-            return AmbiguousRoleResolutionType::Deny;
+          case AuthenticatedRole_HASH:
+            if (name == "AuthenticatedRole")
+            {
+              return AmbiguousRoleResolutionType::AuthenticatedRole;
+            }
+            break;
+          case Deny_HASH:
+            if (name == "Deny")
+            {
+              return AmbiguousRoleResolutionType::Deny;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AmbiguousRoleResolutionType::NOT_SET;
         }
 
-        Aws::String GetNameForAmbiguousRoleResolutionType(AmbiguousRoleResolutionType enumValue)
+        const char* GetNameForAmbiguousRoleResolutionType(AmbiguousRoleResolutionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int AccessDenied_HASH = HashingUtils::HashString("AccessDenied");
-        static const int InternalServerError_HASH = HashingUtils::HashString("InternalServerError");
+        static constexpr int AccessDenied_HASH = HashingUtils::CompileTimeHashString("AccessDenied");
+        static constexpr int InternalServerError_HASH = HashingUtils::CompileTimeHashString("InternalServerError");
 
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AccessDenied_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ErrorCode::AccessDenied;
-          }
-          else if (hashCode == InternalServerError_HASH)
-          {
-            return ErrorCode::InternalServerError;
+          case AccessDenied_HASH:
+            if (name == "AccessDenied")
+            {
+              return ErrorCode::AccessDenied;
+            }
+            break;
+          case InternalServerError_HASH:
+            if (name == "InternalServerError")
+            {
+              return ErrorCode::InternalServerError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCode(ErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace MappingRuleMatchTypeMapper
       {
 
-        static const int Equals_HASH = HashingUtils::HashString("Equals");
-        static const int Contains_HASH = HashingUtils::HashString("Contains");
-        static const int StartsWith_HASH = HashingUtils::HashString("StartsWith");
-        static const int NotEqual_HASH = HashingUtils::HashString("NotEqual");
+        static constexpr int Equals_HASH = HashingUtils::CompileTimeHashString("Equals");
+        static constexpr int Contains_HASH = HashingUtils::CompileTimeHashString("Contains");
+        static constexpr int StartsWith_HASH = HashingUtils::CompileTimeHashString("StartsWith");
+        static constexpr int NotEqual_HASH = HashingUtils::CompileTimeHashString("NotEqual");
 
 
         MappingRuleMatchType GetMappingRuleMatchTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Equals_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MappingRuleMatchType::Equals;
-          }
-          else if (hashCode == Contains_HASH)
-          {
-            return MappingRuleMatchType::Contains;
-          }
-          else if (hashCode == StartsWith_HASH)
-          {
-            return MappingRuleMatchType::StartsWith;
-          }
-          else if (hashCode == NotEqual_HASH)
-          {
-            return MappingRuleMatchType::NotEqual;
+          case Equals_HASH:
+            if (name == "Equals")
+            {
+              return MappingRuleMatchType::Equals;
+            }
+            break;
+          case Contains_HASH:
+            if (name == "Contains")
+            {
+              return MappingRuleMatchType::Contains;
+            }
+            break;
+          case StartsWith_HASH:
+            if (name == "StartsWith")
+            {
+              return MappingRuleMatchType::StartsWith;
+            }
+            break;
+          case NotEqual_HASH:
+            if (name == "NotEqual")
+            {
+              return MappingRuleMatchType::NotEqual;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return MappingRuleMatchType::NOT_SET;
         }
 
-        Aws::String GetNameForMappingRuleMatchType(MappingRuleMatchType enumValue)
+        const char* GetNameForMappingRuleMatchType(MappingRuleMatchType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace RoleMappingTypeMapper
       {
 
-        static const int Token_HASH = HashingUtils::HashString("Token");
-        static const int Rules_HASH = HashingUtils::HashString("Rules");
+        static constexpr int Token_HASH = HashingUtils::CompileTimeHashString("Token");
+        static constexpr int Rules_HASH = HashingUtils::CompileTimeHashString("Rules");
 
 
         RoleMappingType GetRoleMappingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Token_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RoleMappingType::Token;
-          }
-          else if (hashCode == Rules_HASH)
-          {
-            return RoleMappingType::Rules;
+          case Token_HASH:
+            if (name == "Token")
+            {
+              return RoleMappingType::Token;
+            }
+            break;
+          case Rules_HASH:
+            if (name == "Rules")
+            {
+              return RoleMappingType::Rules;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RoleMappingType::NOT_SET;
         }
 
-        Aws::String GetNameForRoleMappingType(RoleMappingType enumValue)
+        const char* GetNameForRoleMappingType(RoleMappingType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
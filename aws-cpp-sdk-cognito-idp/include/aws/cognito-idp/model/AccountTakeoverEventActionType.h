@@ -36,7 +36,8 @@ namespace AccountTakeoverEventActionTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API AccountTakeoverEventActionType GetAccountTakeoverEventActionTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAccountTakeoverEventActionType(AccountTakeoverEventActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAccountTakeoverEventActionType(AccountTakeoverEventActionType value);
 } // namespace AccountTakeoverEventActionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,7 +35,8 @@ namespace AdvancedSecurityModeTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API AdvancedSecurityModeType GetAdvancedSecurityModeTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAdvancedSecurityModeType(AdvancedSecurityModeType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAdvancedSecurityModeType(AdvancedSecurityModeType value);
 } // namespace AdvancedSecurityModeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,7 +35,8 @@ namespace AliasAttributeTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API AliasAttributeType GetAliasAttributeTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAliasAttributeType(AliasAttributeType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAliasAttributeType(AliasAttributeType value);
 } // namespace AliasAttributeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
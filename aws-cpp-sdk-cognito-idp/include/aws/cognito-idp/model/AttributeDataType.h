@@ -36,7 +36,8 @@ namespace AttributeDataTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API AttributeDataType GetAttributeDataTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAttributeDataType(AttributeDataType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAttributeDataType(AttributeDataType value);
 } // namespace AttributeDataTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -38,7 +38,8 @@ namespace AuthFlowTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API AuthFlowType GetAuthFlowTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForAuthFlowType(AuthFlowType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForAuthFlowType(AuthFlowType value);
 } // namespace AuthFlowTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -34,7 +34,8 @@ namespace ChallengeNameMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API ChallengeName GetChallengeNameForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForChallengeName(ChallengeName value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForChallengeName(ChallengeName value);
 } // namespace ChallengeNameMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
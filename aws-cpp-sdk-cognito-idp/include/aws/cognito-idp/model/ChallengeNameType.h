@@ -42,7 +42,8 @@ namespace ChallengeNameTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API ChallengeNameType GetChallengeNameTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForChallengeNameType(ChallengeNameType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForChallengeNameType(ChallengeNameType value);
 } // namespace ChallengeNameTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
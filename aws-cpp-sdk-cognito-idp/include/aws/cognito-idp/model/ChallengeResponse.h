@@ -34,7 +34,8 @@ namespace ChallengeResponseMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API ChallengeResponse GetChallengeResponseForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForChallengeResponse(ChallengeResponse value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForChallengeResponse(ChallengeResponse value);
 } // namespace ChallengeResponseMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -34,7 +34,8 @@ namespace CompromisedCredentialsEventActionTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API CompromisedCredentialsEventActionType GetCompromisedCredentialsEventActionTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForCompromisedCredentialsEventActionType(CompromisedCredentialsEventActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForCompromisedCredentialsEventActionType(CompromisedCredentialsEventActionType value);
 } // namespace CompromisedCredentialsEventActionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -34,7 +34,8 @@ namespace DefaultEmailOptionTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API DefaultEmailOptionType GetDefaultEmailOptionTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForDefaultEmailOptionType(DefaultEmailOptionType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForDefaultEmailOptionType(DefaultEmailOptionType value);
 } // namespace DefaultEmailOptionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -34,7 +34,8 @@ namespace DeliveryMediumTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API DeliveryMediumType GetDeliveryMediumTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForDeliveryMediumType(DeliveryMediumType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForDeliveryMediumType(DeliveryMediumType value);
 } // namespace DeliveryMediumTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -34,7 +34,8 @@ namespace DeviceRememberedStatusTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API DeviceRememberedStatusType GetDeviceRememberedStatusTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForDeviceRememberedStatusType(DeviceRememberedStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForDeviceRememberedStatusType(DeviceRememberedStatusType value);
 } // namespace DeviceRememberedStatusTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
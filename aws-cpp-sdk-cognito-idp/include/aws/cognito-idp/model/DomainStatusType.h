@@ -37,7 +37,8 @@ namespace DomainStatusTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API DomainStatusType GetDomainStatusTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForDomainStatusType(DomainStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForDomainStatusType(DomainStatusType value);
 } // namespace DomainStatusTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,7 +35,8 @@ namespace EventFilterTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API EventFilterType GetEventFilterTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForEventFilterType(EventFilterType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForEventFilterType(EventFilterType value);
 } // namespace EventFilterTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -34,7 +34,8 @@ namespace EventResponseTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API EventResponseType GetEventResponseTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForEventResponseType(EventResponseType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForEventResponseType(EventResponseType value);
 } // namespace EventResponseTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
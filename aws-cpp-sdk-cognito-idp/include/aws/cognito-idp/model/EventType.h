@@ -35,7 +35,8 @@ namespace EventTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API EventType GetEventTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForEventType(EventType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForEventType(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
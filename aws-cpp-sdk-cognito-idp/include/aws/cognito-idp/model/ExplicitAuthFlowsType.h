@@ -35,7 +35,8 @@ namespace ExplicitAuthFlowsTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API ExplicitAuthFlowsType GetExplicitAuthFlowsTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForExplicitAuthFlowsType(ExplicitAuthFlowsType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForExplicitAuthFlowsType(ExplicitAuthFlowsType value);
 } // namespace ExplicitAuthFlowsTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
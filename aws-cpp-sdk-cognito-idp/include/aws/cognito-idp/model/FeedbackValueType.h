@@ -34,7 +34,8 @@ namespace FeedbackValueTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API FeedbackValueType GetFeedbackValueTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForFeedbackValueType(FeedbackValueType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForFeedbackValueType(FeedbackValueType value);
 } // namespace FeedbackValueTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
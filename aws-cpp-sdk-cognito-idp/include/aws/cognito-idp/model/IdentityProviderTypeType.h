@@ -37,7 +37,8 @@ namespace IdentityProviderTypeTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API IdentityProviderTypeType GetIdentityProviderTypeTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForIdentityProviderTypeType(IdentityProviderTypeType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForIdentityProviderTypeType(IdentityProviderTypeType value);
 } // namespace IdentityProviderTypeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -34,7 +34,8 @@ namespace MessageActionTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API MessageActionType GetMessageActionTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForMessageActionType(MessageActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForMessageActionType(MessageActionType value);
 } // namespace MessageActionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
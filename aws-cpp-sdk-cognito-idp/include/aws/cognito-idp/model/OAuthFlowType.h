@@ -35,7 +35,8 @@ namespace OAuthFlowTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API OAuthFlowType GetOAuthFlowTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForOAuthFlowType(OAuthFlowType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForOAuthFlowType(OAuthFlowType value);
 } // namespace OAuthFlowTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,7 +35,8 @@ namespace RiskDecisionTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API RiskDecisionType GetRiskDecisionTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForRiskDecisionType(RiskDecisionType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForRiskDecisionType(RiskDecisionType value);
 } // namespace RiskDecisionTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,7 +35,8 @@ namespace RiskLevelTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API RiskLevelType GetRiskLevelTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForRiskLevelType(RiskLevelType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForRiskLevelType(RiskLevelType value);
 } // namespace RiskLevelTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
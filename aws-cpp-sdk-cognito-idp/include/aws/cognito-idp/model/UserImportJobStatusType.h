@@ -40,7 +40,8 @@ namespace UserImportJobStatusTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API UserImportJobStatusType GetUserImportJobStatusTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForUserImportJobStatusType(UserImportJobStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForUserImportJobStatusType(UserImportJobStatusType value);
 } // namespace UserImportJobStatusTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -35,7 +35,8 @@ namespace UserPoolMfaTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API UserPoolMfaType GetUserPoolMfaTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForUserPoolMfaType(UserPoolMfaType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForUserPoolMfaType(UserPoolMfaType value);
 } // namespace UserPoolMfaTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -39,7 +39,8 @@ namespace UserStatusTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API UserStatusType GetUserStatusTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForUserStatusType(UserStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForUserStatusType(UserStatusType value);
 } // namespace UserStatusTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
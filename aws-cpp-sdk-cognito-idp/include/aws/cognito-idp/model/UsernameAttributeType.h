@@ -34,7 +34,8 @@ namespace UsernameAttributeTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API UsernameAttributeType GetUsernameAttributeTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForUsernameAttributeType(UsernameAttributeType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForUsernameAttributeType(UsernameAttributeType value);
 } // namespace UsernameAttributeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -34,7 +34,8 @@ namespace VerifiedAttributeTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API VerifiedAttributeType GetVerifiedAttributeTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForVerifiedAttributeType(VerifiedAttributeType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForVerifiedAttributeType(VerifiedAttributeType value);
 } // namespace VerifiedAttributeTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
@@ -34,7 +34,8 @@ namespace VerifySoftwareTokenResponseTypeMapper
 {
 AWS_COGNITOIDENTITYPROVIDER_API VerifySoftwareTokenResponseType GetVerifySoftwareTokenResponseTypeForName(const Aws::String& name);
 
-AWS_COGNITOIDENTITYPROVIDER_API Aws::String GetNameForVerifySoftwareTokenResponseType(VerifySoftwareTokenResponseType value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOIDENTITYPROVIDER_API const char* GetNameForVerifySoftwareTokenResponseType(VerifySoftwareTokenResponseType value);
 } // namespace VerifySoftwareTokenResponseTypeMapper
 } // namespace Model
 } // namespace CognitoIdentityProvider
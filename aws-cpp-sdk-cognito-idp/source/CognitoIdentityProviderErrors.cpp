@@ -28,42 +28,42 @@ namespace CognitoIdentityProvider
 namespace CognitoIdentityProviderErrorMapper
 {
 
-static const int INVALID_SMS_ROLE_ACCESS_POLICY_HASH = HashingUtils::HashString("InvalidSmsRoleAccessPolicyException");
-static const int INVALID_USER_POOL_CONFIGURATION_HASH = HashingUtils::HashString("InvalidUserPoolConfigurationException");
-static const int INVALID_EMAIL_ROLE_ACCESS_POLICY_HASH = HashingUtils::HashString("InvalidEmailRoleAccessPolicyException");
-static const int USERNAME_EXISTS_HASH = HashingUtils::HashString("UsernameExistsException");
-static const int SCOPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ScopeDoesNotExistException");
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalErrorException");
-static const int USER_POOL_ADD_ON_NOT_ENABLED_HASH = HashingUtils::HashString("UserPoolAddOnNotEnabledException");
-static const int CODE_DELIVERY_FAILURE_HASH = HashingUtils::HashString("CodeDeliveryFailureException");
-static const int USER_IMPORT_IN_PROGRESS_HASH = HashingUtils::HashString("UserImportInProgressException");
-static const int SOFTWARE_TOKEN_M_F_A_NOT_FOUND_HASH = HashingUtils::HashString("SoftwareTokenMFANotFoundException");
-static const int ALIAS_EXISTS_HASH = HashingUtils::HashString("AliasExistsException");
-static const int CODE_MISMATCH_HASH = HashingUtils::HashString("CodeMismatchException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
-static const int PRECONDITION_NOT_MET_HASH = HashingUtils::HashString("PreconditionNotMetException");
-static const int USER_NOT_FOUND_HASH = HashingUtils::HashString("UserNotFoundException");
-static const int ENABLE_SOFTWARE_TOKEN_M_F_A_HASH = HashingUtils::HashString("EnableSoftwareTokenMFAException");
-static const int UNSUPPORTED_USER_STATE_HASH = HashingUtils::HashString("UnsupportedUserStateException");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int PASSWORD_RESET_REQUIRED_HASH = HashingUtils::HashString("PasswordResetRequiredException");
-static const int NOT_AUTHORIZED_HASH = HashingUtils::HashString("NotAuthorizedException");
-static const int UNEXPECTED_LAMBDA_HASH = HashingUtils::HashString("UnexpectedLambdaException");
-static const int DUPLICATE_PROVIDER_HASH = HashingUtils::HashString("DuplicateProviderException");
-static const int M_F_A_METHOD_NOT_FOUND_HASH = HashingUtils::HashString("MFAMethodNotFoundException");
-static const int USER_POOL_TAGGING_HASH = HashingUtils::HashString("UserPoolTaggingException");
-static const int GROUP_EXISTS_HASH = HashingUtils::HashString("GroupExistsException");
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int USER_NOT_CONFIRMED_HASH = HashingUtils::HashString("UserNotConfirmedException");
-static const int UNSUPPORTED_IDENTITY_PROVIDER_HASH = HashingUtils::HashString("UnsupportedIdentityProviderException");
-static const int INVALID_SMS_ROLE_TRUST_RELATIONSHIP_HASH = HashingUtils::HashString("InvalidSmsRoleTrustRelationshipException");
-static const int USER_LAMBDA_VALIDATION_HASH = HashingUtils::HashString("UserLambdaValidationException");
-static const int INVALID_PASSWORD_HASH = HashingUtils::HashString("InvalidPasswordException");
-static const int INVALID_LAMBDA_RESPONSE_HASH = HashingUtils::HashString("InvalidLambdaResponseException");
-static const int EXPIRED_CODE_HASH = HashingUtils::HashString("ExpiredCodeException");
-static const int TOO_MANY_FAILED_ATTEMPTS_HASH = HashingUtils::HashString("TooManyFailedAttemptsException");
-static const int INVALID_O_AUTH_FLOW_HASH = HashingUtils::HashString("InvalidOAuthFlowException");
+static constexpr int INVALID_SMS_ROLE_ACCESS_POLICY_HASH = HashingUtils::CompileTimeHashString("InvalidSmsRoleAccessPolicyException");
+static constexpr int INVALID_USER_POOL_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("InvalidUserPoolConfigurationException");
+static constexpr int INVALID_EMAIL_ROLE_ACCESS_POLICY_HASH = HashingUtils::CompileTimeHashString("InvalidEmailRoleAccessPolicyException");
+static constexpr int USERNAME_EXISTS_HASH = HashingUtils::CompileTimeHashString("UsernameExistsException");
+static constexpr int SCOPE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ScopeDoesNotExistException");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalErrorException");
+static constexpr int USER_POOL_ADD_ON_NOT_ENABLED_HASH = HashingUtils::CompileTimeHashString("UserPoolAddOnNotEnabledException");
+static constexpr int CODE_DELIVERY_FAILURE_HASH = HashingUtils::CompileTimeHashString("CodeDeliveryFailureException");
+static constexpr int USER_IMPORT_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("UserImportInProgressException");
+static constexpr int SOFTWARE_TOKEN_M_F_A_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SoftwareTokenMFANotFoundException");
+static constexpr int ALIAS_EXISTS_HASH = HashingUtils::CompileTimeHashString("AliasExistsException");
+static constexpr int CODE_MISMATCH_HASH = HashingUtils::CompileTimeHashString("CodeMismatchException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
+static constexpr int PRECONDITION_NOT_MET_HASH = HashingUtils::CompileTimeHashString("PreconditionNotMetException");
+static constexpr int USER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("UserNotFoundException");
+static constexpr int ENABLE_SOFTWARE_TOKEN_M_F_A_HASH = HashingUtils::CompileTimeHashString("EnableSoftwareTokenMFAException");
+static constexpr int UNSUPPORTED_USER_STATE_HASH = HashingUtils::CompileTimeHashString("UnsupportedUserStateException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int PASSWORD_RESET_REQUIRED_HASH = HashingUtils::CompileTimeHashString("PasswordResetRequiredException");
+static constexpr int NOT_AUTHORIZED_HASH = HashingUtils::CompileTimeHashString("NotAuthorizedException");
+static constexpr int UNEXPECTED_LAMBDA_HASH = HashingUtils::CompileTimeHashString("UnexpectedLambdaException");
+static constexpr int DUPLICATE_PROVIDER_HASH = HashingUtils::CompileTimeHashString("DuplicateProviderException");
+static constexpr int M_F_A_METHOD_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("MFAMethodNotFoundException");
+static constexpr int USER_POOL_TAGGING_HASH = HashingUtils::CompileTimeHashString("UserPoolTaggingException");
+static constexpr int GROUP_EXISTS_HASH = HashingUtils::CompileTimeHashString("GroupExistsException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int USER_NOT_CONFIRMED_HASH = HashingUtils::CompileTimeHashString("UserNotConfirmedException");
+static constexpr int UNSUPPORTED_IDENTITY_PROVIDER_HASH = HashingUtils::CompileTimeHashString("UnsupportedIdentityProviderException");
+static constexpr int INVALID_SMS_ROLE_TRUST_RELATIONSHIP_HASH = HashingUtils::CompileTimeHashString("InvalidSmsRoleTrustRelationshipException");
+static constexpr int USER_LAMBDA_VALIDATION_HASH = HashingUtils::CompileTimeHashString("UserLambdaValidationException");
+static constexpr int INVALID_PASSWORD_HASH = HashingUtils::CompileTimeHashString("InvalidPasswordException");
+static constexpr int INVALID_LAMBDA_RESPONSE_HASH = HashingUtils::CompileTimeHashString("InvalidLambdaResponseException");
+static constexpr int EXPIRED_CODE_HASH = HashingUtils::CompileTimeHashString("ExpiredCodeException");
+static constexpr int TOO_MANY_FAILED_ATTEMPTS_HASH = HashingUtils::CompileTimeHashString("TooManyFailedAttemptsException");
+static constexpr int INVALID_O_AUTH_FLOW_HASH = HashingUtils::CompileTimeHashString("InvalidOAuthFlowException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
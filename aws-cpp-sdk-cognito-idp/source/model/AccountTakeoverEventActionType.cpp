@@ -30,30 +30,44 @@ namespace Aws
       namespace AccountTakeoverEventActionTypeMapper
       {
 
-        static const int BLOCK_HASH = HashingUtils::HashString("BLOCK");
-        static const int MFA_IF_CONFIGURED_HASH = HashingUtils::HashString("MFA_IF_CONFIGURED");
-        static const int MFA_REQUIRED_HASH = HashingUtils::HashString("MFA_REQUIRED");
-        static const int NO_ACTION_HASH = HashingUtils::HashString("NO_ACTION");
+        static constexpr int BLOCK_HASH = HashingUtils::CompileTimeHashString("BLOCK");
+        static constexpr int MFA_IF_CONFIGURED_HASH = HashingUtils::CompileTimeHashString("MFA_IF_CONFIGURED");
+        static constexpr int MFA_REQUIRED_HASH = HashingUtils::CompileTimeHashString("MFA_REQUIRED");
+        static constexpr int NO_ACTION_HASH = HashingUtils::CompileTimeHashString("NO_ACTION");
 
 
         AccountTakeoverEventActionType GetAccountTakeoverEventActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLOCK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccountTakeoverEventActionType::BLOCK;
-          }
-          else if (hashCode == MFA_IF_CONFIGURED_HASH)
-          {
-            return AccountTakeoverEventActionType::MFA_IF_CONFIGURED;
-          }
-          else if (hashCode == MFA_REQUIRED_HASH)
-          {
-            return AccountTakeoverEventActionType::MFA_REQUIRED;
-          }
-          else if (hashCode == NO_ACTION_HASH)
-          {
-            return AccountTakeoverEventActionType::NO_ACTION;
+          case BLOCK_HASH:
+            if (name == "BLOCK")
+            {
+              return AccountTakeoverEventActionType::BLOCK;
+            }
+            break;
+          case MFA_IF_CONFIGURED_HASH:
+            if (name == "MFA_IF_CONFIGURED")
+            {
+              return AccountTakeoverEventActionType::MFA_IF_CONFIGURED;
+            }
+            break;
+          case MFA_REQUIRED_HASH:
+            if (name == "MFA_REQUIRED")
+            {
+              return AccountTakeoverEventActionType::MFA_REQUIRED;
+            }
+            break;
+          case NO_ACTION_HASH:
+            if (name == "NO_ACTION")
+            {
+              return AccountTakeoverEventActionType::NO_ACTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AccountTakeoverEventActionType::NOT_SET;
         }
 
-        Aws::String GetNameForAccountTakeoverEventActionType(AccountTakeoverEventActionType enumValue)
+        const char* GetNameForAccountTakeoverEventActionType(AccountTakeoverEventActionType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
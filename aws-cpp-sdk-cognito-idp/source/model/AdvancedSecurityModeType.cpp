@@ -30,25 +30,37 @@ namespace Aws
       namespace AdvancedSecurityModeTypeMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int AUDIT_HASH = HashingUtils::HashString("AUDIT");
-        static const int ENFORCED_HASH = HashingUtils::HashString("ENFORCED");
+        static constexpr int OFF_HASH = HashingUtils::CompileTimeHashString("OFF");
+        static constexpr int AUDIT_HASH = HashingUtils::CompileTimeHashString("AUDIT");
+        static constexpr int ENFORCED_HASH = HashingUtils::CompileTimeHashString("ENFORCED");
 
 
         AdvancedSecurityModeType GetAdvancedSecurityModeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AdvancedSecurityModeType::OFF;
-          }
-          else if (hashCode == AUDIT_HASH)
-          {
-            return AdvancedSecurityModeType::AUDIT;
-          }
-          else if (hashCode == ENFORCED_HASH)
-          {
-            return AdvancedSecurityModeType::ENFORCED;
+          case OFF_HASH:
+            if (name == "OFF")
+            {
+              return AdvancedSecurityModeType::OFF;
+            }
+            break;
+          case AUDIT_HASH:
+            if (name == "AUDIT")
+            {
+              return AdvancedSecurityModeType::AUDIT;
+            }
+            break;
+          case ENFORCED_HASH:
+            if (name == "ENFORCED")
+            {
+              return AdvancedSecurityModeType::ENFORCED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AdvancedSecurityModeType::NOT_SET;
         }
 
-        Aws::String GetNameForAdvancedSecurityModeType(AdvancedSecurityModeType enumValue)
+        const char* GetNameForAdvancedSecurityModeType(AdvancedSecurityModeType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AliasAttributeTypeMapper
       {
 
-        static const int phone_number_HASH = HashingUtils::HashString("phone_number");
-        static const int email_HASH = HashingUtils::HashString("email");
-        static const int preferred_username_HASH = HashingUtils::HashString("preferred_username");
+        static constexpr int phone_number_HASH = HashingUtils::CompileTimeHashString("phone_number");
+        static constexpr int email_HASH = HashingUtils::CompileTimeHashString("email");
+        static constexpr int preferred_username_HASH = HashingUtils::CompileTimeHashString("preferred_username");
 
 
         AliasAttributeType GetAliasAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == phone_number_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AliasAttributeType::phone_number;
-          }
-          else if (hashCode == email_HASH)
-          {
-            return AliasAttributeType::email;
-          }
-          else if (hashCode == preferred_username_HASH)
-          {
-            return AliasAttributeType::preferred_username;
+          case phone_number_HASH:
+            if (name == "phone_number")
+            {
+              return AliasAttributeType::phone_number;
+            }
+            break;
+          case email_HASH:
+            if (name == "email")
+            {
+              return AliasAttributeType::email;
+            }
+            break;
+          case preferred_username_HASH:
+            if (name == "preferred_username")
+            {
+              return AliasAttributeType::preferred_username;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AliasAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForAliasAttributeType(AliasAttributeType enumValue)
+        const char* GetNameForAliasAttributeType(AliasAttributeType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
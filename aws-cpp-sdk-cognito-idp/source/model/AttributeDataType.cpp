@@ -30,30 +30,44 @@ namespace Aws
       namespace AttributeDataTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int Number_HASH = HashingUtils::HashString("Number");
-        static const int DateTime_HASH = HashingUtils::HashString("DateTime");
-        static const int Boolean_HASH = HashingUtils::HashString("Boolean");
+        static constexpr int String_HASH = HashingUtils::CompileTimeHashString("String");
+        static constexpr int Number_HASH = HashingUtils::CompileTimeHashString("Number");
+        static constexpr int DateTime_HASH = HashingUtils::CompileTimeHashString("DateTime");
+        static constexpr int Boolean_HASH = HashingUtils::CompileTimeHashString("Boolean");
 
 
         AttributeDataType GetAttributeDataTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AttributeDataType::String;
-          }
-          else if (hashCode == Number_HASH)
-          {
-            return AttributeDataType::Number;
-          }
-          else if (hashCode == DateTime_HASH)
-          {
-            return AttributeDataType::DateTime;
-          }
-          else if (hashCode == Boolean_HASH)
-          {
-            return AttributeDataType::Boolean;
+          case String_HASH:
+            if (name == "String")
+            {
+              return AttributeDataType::String;
+            }
+            break;
+          case Number_HASH:
+            if (name == "Number")
+            {
+              return AttributeDataType::Number;
+            }
+            break;
+          case DateTime_HASH:
+            if (name == "DateTime")
+            {
+              return AttributeDataType::DateTime;
+            }
+            break;
+          case Boolean_HASH:
+            if (name == "Boolean")
+            {
+              return AttributeDataType::Boolean;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AttributeDataType::NOT_SET;
         }
 
-        Aws::String GetNameForAttributeDataType(AttributeDataType enumValue)
+        const char* GetNameForAttributeDataType(AttributeDataType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
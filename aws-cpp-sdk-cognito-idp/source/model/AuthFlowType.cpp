@@ -30,40 +30,58 @@ namespace Aws
       namespace AuthFlowTypeMapper
       {
 
-        static const int USER_SRP_AUTH_HASH = HashingUtils::HashString("USER_SRP_AUTH");
-        static const int REFRESH_TOKEN_AUTH_HASH = HashingUtils::HashString("REFRESH_TOKEN_AUTH");
-        static const int REFRESH_TOKEN_HASH = HashingUtils::HashString("REFRESH_TOKEN");
-        static const int CUSTOM_AUTH_HASH = HashingUtils::HashString("CUSTOM_AUTH");
-        static const int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::HashString("ADMIN_NO_SRP_AUTH");
-        static const int USER_PASSWORD_AUTH_HASH = HashingUtils::HashString("USER_PASSWORD_AUTH");
+        static constexpr int USER_SRP_AUTH_HASH = HashingUtils::CompileTimeHashString("USER_SRP_AUTH");
+        static constexpr int REFRESH_TOKEN_AUTH_HASH = HashingUtils::CompileTimeHashString("REFRESH_TOKEN_AUTH");
+        static constexpr int REFRESH_TOKEN_HASH = HashingUtils::CompileTimeHashString("REFRESH_TOKEN");
+        static constexpr int CUSTOM_AUTH_HASH = HashingUtils::CompileTimeHashString("CUSTOM_AUTH");
+        static constexpr int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::CompileTimeHashString("ADMIN_NO_SRP_AUTH");
+        static constexpr int USER_PASSWORD_AUTH_HASH = HashingUtils::CompileTimeHashString("USER_PASSWORD_AUTH");
 
 
         AuthFlowType GetAuthFlowTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_SRP_AUTH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthFlowType::USER_SRP_AUTH;
-          }
-          else if (hashCode == REFRESH_TOKEN_AUTH_HASH)
-          {
-            return AuthFlowType::REFRESH_TOKEN_AUTH;
-          }
-          else if (hashCode == REFRESH_TOKEN_HASH)
-          {
-            return AuthFlowType::REFRESH_TOKEN;
-          }
-          else if (hashCode == CUSTOM_AUTH_HASH)
-          {
-            return AuthFlowType::CUSTOM_AUTH;
-          }
-          else if (hashCode == ADMIN_NO_SRP_AUTH_HASH)
-          {
-            return AuthFlowType::ADMIN_NO_SRP_AUTH;
-          }
-          else if (hashCode == USER_PASSWORD_AUTH_HASH)
-          {
-            return AuthFlowType::USER_PASSWORD_AUTH;
+          case USER_SRP_AUTH_HASH:
+            if (name == "USER_SRP_AUTH")
+            {
+              return AuthFlowType::USER_SRP_AUTH;
+            }
+            break;
+          case REFRESH_TOKEN_AUTH_HASH:
+            if (name == "REFRESH_TOKEN_AUTH")
+            {
+              return AuthFlowType::REFRESH_TOKEN_AUTH;
+            }
+            break;
+          case REFRESH_TOKEN_HASH:
+            if (name == "REFRESH_TOKEN")
+            {
+              return AuthFlowType::REFRESH_TOKEN;
+            }
+            break;
+          case CUSTOM_AUTH_HASH:
+            if (name == "CUSTOM_AUTH")
+            {
+              return AuthFlowType::CUSTOM_AUTH;
+            }
+            break;
+          case ADMIN_NO_SRP_AUTH_HASH:
+            if (name == "ADMIN_NO_SRP_AUTH")
+            {
+              return AuthFlowType::ADMIN_NO_SRP_AUTH;
+            }
+            break;
+          case USER_PASSWORD_AUTH_HASH:
+            if (name == "USER_PASSWORD_AUTH")
+            {
+              return AuthFlowType::USER_PASSWORD_AUTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return AuthFlowType::NOT_SET;
         }
 
-        Aws::String GetNameForAuthFlowType(AuthFlowType enumValue)
+        const char* GetNameForAuthFlowType(AuthFlowType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ChallengeNameMapper
       {
 
-        static const int Password_HASH = HashingUtils::HashString("Password");
-        static const int Mfa_HASH = HashingUtils::HashString("Mfa");
+        static constexpr int Password_HASH = HashingUtils::CompileTimeHashString("Password");
+        static constexpr int Mfa_HASH = HashingUtils::CompileTimeHashString("Mfa");
 
 
         ChallengeName GetChallengeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Password_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChallengeName::Password;
-          }
-          else if (hashCode == Mfa_HASH)
-          {
-            return ChallengeName::Mfa;
+          case Password_HASH:
+            if (name == "Password")
+            {
+              return ChallengeName::Password;
+            }
+            break;
+          case Mfa_HASH:
+            if (name == "Mfa")
+            {
+              return ChallengeName::Mfa;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ChallengeName::NOT_SET;
         }
 
-        Aws::String GetNameForChallengeName(ChallengeName enumValue)
+        const char* GetNameForChallengeName(ChallengeName enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
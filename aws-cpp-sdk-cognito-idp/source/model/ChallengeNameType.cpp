@@ -30,60 +30,86 @@ namespace Aws
       namespace ChallengeNameTypeMapper
       {
 
-        static const int SMS_MFA_HASH = HashingUtils::HashString("SMS_MFA");
-        static const int SOFTWARE_TOKEN_MFA_HASH = HashingUtils::HashString("SOFTWARE_TOKEN_MFA");
-        static const int SELECT_MFA_TYPE_HASH = HashingUtils::HashString("SELECT_MFA_TYPE");
-        static const int MFA_SETUP_HASH = HashingUtils::HashString("MFA_SETUP");
-        static const int PASSWORD_VERIFIER_HASH = HashingUtils::HashString("PASSWORD_VERIFIER");
-        static const int CUSTOM_CHALLENGE_HASH = HashingUtils::HashString("CUSTOM_CHALLENGE");
-        static const int DEVICE_SRP_AUTH_HASH = HashingUtils::HashString("DEVICE_SRP_AUTH");
-        static const int DEVICE_PASSWORD_VERIFIER_HASH = HashingUtils::HashString("DEVICE_PASSWORD_VERIFIER");
-        static const int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::HashString("ADMIN_NO_SRP_AUTH");
-        static const int NEW_PASSWORD_REQUIRED_HASH = HashingUtils::HashString("NEW_PASSWORD_REQUIRED");
+        static constexpr int SMS_MFA_HASH = HashingUtils::CompileTimeHashString("SMS_MFA");
+        static constexpr int SOFTWARE_TOKEN_MFA_HASH = HashingUtils::CompileTimeHashString("SOFTWARE_TOKEN_MFA");
+        static constexpr int SELECT_MFA_TYPE_HASH = HashingUtils::CompileTimeHashString("SELECT_MFA_TYPE");
+        static constexpr int MFA_SETUP_HASH = HashingUtils::CompileTimeHashString("MFA_SETUP");
+        static constexpr int PASSWORD_VERIFIER_HASH = HashingUtils::CompileTimeHashString("PASSWORD_VERIFIER");
+        static constexpr int CUSTOM_CHALLENGE_HASH = HashingUtils::CompileTimeHashString("CUSTOM_CHALLENGE");
+        static constexpr int DEVICE_SRP_AUTH_HASH = HashingUtils::CompileTimeHashString("DEVICE_SRP_AUTH");
+        static constexpr int DEVICE_PASSWORD_VERIFIER_HASH = HashingUtils::CompileTimeHashString("DEVICE_PASSWORD_VERIFIER");
+        static constexpr int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::CompileTimeHashString("ADMIN_NO_SRP_AUTH");
+        static constexpr int NEW_PASSWORD_REQUIRED_HASH = HashingUtils::CompileTimeHashString("NEW_PASSWORD_REQUIRED");
 
 
         ChallengeNameType GetChallengeNameTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SMS_MFA_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChallengeNameType::SMS_MFA;
-          }
-          else if (hashCode == SOFTWARE_TOKEN_MFA_HASH)
-          {
-            return ChallengeNameType::SOFTWARE_TOKEN_MFA;
-          }
-          else if (hashCode == SELECT_MFA_TYPE_HASH)
-          {
-            return ChallengeNameType::SELECT_MFA_TYPE;
-          }
-          else if (hashCode == MFA_SETUP_HASH)
-          {
-            return ChallengeNameType::MFA_SETUP;
-          }
-          else if (hashCode == PASSWORD_VERIFIER_HASH)
-          {
-            return ChallengeNameType::PASSWORD_VERIFIER;
-          }
-          else if (hashCode == CUSTOM_CHALLENGE_HASH)
-          {
-            return ChallengeNameType::CUSTOM_CHALLENGE;
-          }
-          else if (hashCode == DEVICE_SRP_AUTH_HASH)
-          {
-            return ChallengeNameType::DEVICE_SRP_AUTH;
-          }
-          else if (hashCode == DEVICE_PASSWORD_VERIFIER_HASH)
-          {
-            return ChallengeNameType::DEVICE_PASSWORD_VERIFIER;
-          }
-          else if (hashCode == ADMIN_NO_SRP_AUTH_HASH)
-          {
-            return ChallengeNameType::ADMIN_NO_SRP_AUTH;
-          }
-          else if (hashCode == NEW_PASSWORD_REQUIRED_HASH)
-          {
-            return ChallengeNameType::NEW_PASSWORD_REQUIRED;
+          case SMS_MFA_HASH:
+            if (name == "SMS_MFA")
+            {
+              return ChallengeNameType::SMS_MFA;
+            }
+            break;
+          case SOFTWARE_TOKEN_MFA_HASH:
+            if (name == "SOFTWARE_TOKEN_MFA")
+            {
+              return ChallengeNameType::SOFTWARE_TOKEN_MFA;
+            }
+            break;
+          case SELECT_MFA_TYPE_HASH:
+            if (name == "SELECT_MFA_TYPE")
+            {
+              return ChallengeNameType::SELECT_MFA_TYPE;
+            }
+            break;
+          case MFA_SETUP_HASH:
+            if (name == "MFA_SETUP")
+            {
+              return ChallengeNameType::MFA_SETUP;
+            }
+            break;
+          case PASSWORD_VERIFIER_HASH:
+            if (name == "PASSWORD_VERIFIER")
+            {
+              return ChallengeNameType::PASSWORD_VERIFIER;
+            }
+            break;
+          case CUSTOM_CHALLENGE_HASH:
+            if (name == "CUSTOM_CHALLENGE")
+            {
+              return ChallengeNameType::CUSTOM_CHALLENGE;
+            }
+            break;
+          case DEVICE_SRP_AUTH_HASH:
+            if (name == "DEVICE_SRP_AUTH")
+            {
+              return ChallengeNameType::DEVICE_SRP_AUTH;
+            }
+            break;
+          case DEVICE_PASSWORD_VERIFIER_HASH:
+            if (name == "DEVICE_PASSWORD_VERIFIER")
+            {
+              return ChallengeNameType::DEVICE_PASSWORD_VERIFIER;
+            }
+            break;
+          case ADMIN_NO_SRP_AUTH_HASH:
+            if (name == "ADMIN_NO_SRP_AUTH")
+            {
+              return ChallengeNameType::ADMIN_NO_SRP_AUTH;
+            }
+            break;
+          case NEW_PASSWORD_REQUIRED_HASH:
+            if (name == "NEW_PASSWORD_REQUIRED")
+            {
+              return ChallengeNameType::NEW_PASSWORD_REQUIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return ChallengeNameType::NOT_SET;
         }
 
-        Aws::String GetNameForChallengeNameType(ChallengeNameType enumValue)
+        const char* GetNameForChallengeNameType(ChallengeNameType enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
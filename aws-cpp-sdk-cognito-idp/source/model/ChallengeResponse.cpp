@@ -30,20 +30,30 @@ namespace Aws
       namespace ChallengeResponseMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failure_HASH = HashingUtils::HashString("Failure");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int Failure_HASH = HashingUtils::CompileTimeHashString("Failure");
 
 
         ChallengeResponse GetChallengeResponseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChallengeResponse::Success;
-          }
-          else if (hashCode == Failure_HASH)
-          {
-            return ChallengeResponse::Failure;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return ChallengeResponse::Success;
+            }
+            break;
+          case Failure_HASH:
+            if (name == "Failure")
+            {
+              return ChallengeResponse::Failure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ChallengeResponse::NOT_SET;
         }
 
-        Aws::String GetNameForChallengeResponse(ChallengeResponse enumValue)
+        const char* GetNameForChallengeResponse(ChallengeResponse enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
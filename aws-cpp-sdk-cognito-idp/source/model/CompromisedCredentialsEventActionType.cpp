@@ -30,20 +30,30 @@ namespace Aws
       namespace CompromisedCredentialsEventActionTypeMapper
       {
 
-        static const int BLOCK_HASH = HashingUtils::HashString("BLOCK");
-        static const int NO_ACTION_HASH = HashingUtils::HashString("NO_ACTION");
+        static constexpr int BLOCK_HASH = HashingUtils::CompileTimeHashString("BLOCK");
+        static constexpr int NO_ACTION_HASH = HashingUtils::CompileTimeHashString("NO_ACTION");
 
 
         CompromisedCredentialsEventActionType GetCompromisedCredentialsEventActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLOCK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CompromisedCredentialsEventActionType::BLOCK;
-          }
-          else if (hashCode == NO_ACTION_HASH)
-          {
-            return CompromisedCredentialsEventActionType::NO_ACTION;
+          case BLOCK_HASH:
+            if (name == "BLOCK")
+            {
+              return CompromisedCredentialsEventActionType::BLOCK;
+            }
+            break;
+          case NO_ACTION_HASH:
+            if (name == "NO_ACTION")
+            {
+              return CompromisedCredentialsEventActionType::NO_ACTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CompromisedCredentialsEventActionType::NOT_SET;
         }
 
-        Aws::String GetNameForCompromisedCredentialsEventActionType(CompromisedCredentialsEventActionType enumValue)
+        const char* GetNameForCompromisedCredentialsEventActionType(CompromisedCredentialsEventActionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
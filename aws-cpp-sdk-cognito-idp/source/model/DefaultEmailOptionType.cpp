@@ -30,20 +30,30 @@ namespace Aws
       namespace DefaultEmailOptionTypeMapper
       {
 
-        static const int CONFIRM_WITH_LINK_HASH = HashingUtils::HashString("CONFIRM_WITH_LINK");
-        static const int CONFIRM_WITH_CODE_HASH = HashingUtils::HashString("CONFIRM_WITH_CODE");
+        static constexpr int CONFIRM_WITH_LINK_HASH = HashingUtils::CompileTimeHashString("CONFIRM_WITH_LINK");
+        static constexpr int CONFIRM_WITH_CODE_HASH = HashingUtils::CompileTimeHashString("CONFIRM_WITH_CODE");
 
 
         DefaultEmailOptionType GetDefaultEmailOptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONFIRM_WITH_LINK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DefaultEmailOptionType::CONFIRM_WITH_LINK;
-          }
-          else if (hashCode == CONFIRM_WITH_CODE_HASH)
-          {
-            return DefaultEmailOptionType::CONFIRM_WITH_CODE;
+          case CONFIRM_WITH_LINK_HASH:
+            if (name == "CONFIRM_WITH_LINK")
+            {
+              return DefaultEmailOptionType::CONFIRM_WITH_LINK;
+            }
+            break;
+          case CONFIRM_WITH_CODE_HASH:
+            if (name == "CONFIRM_WITH_CODE")
+            {
+              return DefaultEmailOptionType::CONFIRM_WITH_CODE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DefaultEmailOptionType::NOT_SET;
         }
 
-        Aws::String GetNameForDefaultEmailOptionType(DefaultEmailOptionType enumValue)
+        const char* GetNameForDefaultEmailOptionType(DefaultEmailOptionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DeliveryMediumTypeMapper
       {
 
-        static const int SMS_HASH = HashingUtils::HashString("SMS");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
+        static constexpr int SMS_HASH = HashingUtils::CompileTimeHashString("SMS");
+        static constexpr int EMAIL_HASH = HashingUtils::CompileTimeHashString("EMAIL");
 
 
         DeliveryMediumType GetDeliveryMediumTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SMS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeliveryMediumType::SMS;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
-            return DeliveryMediumType::EMAIL;
+          case SMS_HASH:
+            if (name == "SMS")
+            {
+              return DeliveryMediumType::SMS;
+            }
+            break;
+          case EMAIL_HASH:
+            if (name == "EMAIL")
+            {
+              return DeliveryMediumType::EMAIL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeliveryMediumType::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryMediumType(DeliveryMediumType enumValue)
+        const char* GetNameForDeliveryMediumType(DeliveryMediumType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
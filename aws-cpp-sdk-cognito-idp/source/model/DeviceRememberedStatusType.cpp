@@ -30,20 +30,30 @@ namespace Aws
       namespace DeviceRememberedStatusTypeMapper
       {
 
-        static const int remembered_HASH = HashingUtils::HashString("remembered");
-        static const int not_remembered_HASH = HashingUtils::HashString("not_remembered");
+        static constexpr int remembered_HASH = HashingUtils::CompileTimeHashString("remembered");
+        static constexpr int not_remembered_HASH = HashingUtils::CompileTimeHashString("not_remembered");
 
 
         DeviceRememberedStatusType GetDeviceRememberedStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == remembered_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeviceRememberedStatusType::remembered;
-          }
-          else if (hashCode == not_remembered_HASH)
-          {
-            return DeviceRememberedStatusType::not_remembered;
+          case remembered_HASH:
+            if (name == "remembered")
+            {
+              return DeviceRememberedStatusType::remembered;
+            }
+            break;
+          case not_remembered_HASH:
+            if (name == "not_remembered")
+            {
+              return DeviceRememberedStatusType::not_remembered;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeviceRememberedStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceRememberedStatusType(DeviceRememberedStatusType enumValue)
+        const char* GetNameForDeviceRememberedStatusType(DeviceRememberedStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace DomainStatusTypeMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         DomainStatusType GetDomainStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DomainStatusType::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return DomainStatusType::DELETING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return DomainStatusType::UPDATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return DomainStatusType::ACTIVE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DomainStatusType::FAILED;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return DomainStatusType::CREATING;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return DomainStatusType::DELETING;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return DomainStatusType::UPDATING;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return DomainStatusType::ACTIVE;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return DomainStatusType::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return DomainStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForDomainStatusType(DomainStatusType enumValue)
+        const char* GetNameForDomainStatusType(DomainStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace EventFilterTypeMapper
       {
 
-        static const int SIGN_IN_HASH = HashingUtils::HashString("SIGN_IN");
-        static const int PASSWORD_CHANGE_HASH = HashingUtils::HashString("PASSWORD_CHANGE");
-        static const int SIGN_UP_HASH = HashingUtils::HashString("SIGN_UP");
+        static constexpr int SIGN_IN_HASH = HashingUtils::CompileTimeHashString("SIGN_IN");
+        static constexpr int PASSWORD_CHANGE_HASH = HashingUtils::CompileTimeHashString("PASSWORD_CHANGE");
+        static constexpr int SIGN_UP_HASH = HashingUtils::CompileTimeHashString("SIGN_UP");
 
 
         EventFilterType GetEventFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIGN_IN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventFilterType::SIGN_IN;
-          }
-          else if (hashCode == PASSWORD_CHANGE_HASH)
-          {
-            return EventFilterType::PASSWORD_CHANGE;
-          }
-          else if (hashCode == SIGN_UP_HASH)
-          {
-            return EventFilterType::SIGN_UP;
+          case SIGN_IN_HASH:
+            if (name == "SIGN_IN")
+            {
+              return EventFilterType::SIGN_IN;
+            }
+            break;
+          case PASSWORD_CHANGE_HASH:
+            if (name == "PASSWORD_CHANGE")
+            {
+              return EventFilterType::PASSWORD_CHANGE;
+            }
+            break;
+          case SIGN_UP_HASH:
+            if (name == "SIGN_UP")
+            {
+              return EventFilterType::SIGN_UP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return EventFilterType::NOT_SET;
         }
 
-        Aws::String GetNameForEventFilterType(EventFilterType enumValue)
+        const char* GetNameForEventFilterType(EventFilterType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
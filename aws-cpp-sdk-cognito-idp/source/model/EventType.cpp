@@ -30,25 +30,37 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int SignIn_HASH = HashingUtils::HashString("SignIn");
-        static const int SignUp_HASH = HashingUtils::HashString("SignUp");
-        static const int ForgotPassword_HASH = HashingUtils::HashString("ForgotPassword");
+        static constexpr int SignIn_HASH = HashingUtils::CompileTimeHashString("SignIn");
+        static constexpr int SignUp_HASH = HashingUtils::CompileTimeHashString("SignUp");
+        static constexpr int ForgotPassword_HASH = HashingUtils::CompileTimeHashString("ForgotPassword");
 
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SignIn_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventType::SignIn;
-          }
-          else if (hashCode == SignUp_HASH)
-          {
-            return EventType::SignUp;
-          }
-          else if (hashCode == ForgotPassword_HASH)
-          {
-            return EventType::ForgotPassword;
+          case SignIn_HASH:
+            if (name == "SignIn")
+            {
+              return EventType::SignIn;
+            }
+            break;
+          case SignUp_HASH:
+            if (name == "SignUp")
+            {
+              return EventType::SignUp;
+            }
+            break;
+          case ForgotPassword_HASH:
+            if (name == "ForgotPassword")
+            {
+              return EventType::ForgotPassword;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventType(EventType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ExplicitAuthFlowsTypeMapper
       {
 
-        static const int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::HashString("ADMIN_NO_SRP_AUTH");
-        static const int CUSTOM_AUTH_FLOW_ONLY_HASH = HashingUtils::HashString("CUSTOM_AUTH_FLOW_ONLY");
-        static const int USER_PASSWORD_AUTH_HASH = HashingUtils::HashString("USER_PASSWORD_AUTH");
+        static constexpr int ADMIN_NO_SRP_AUTH_HASH = HashingUtils::CompileTimeHashString("ADMIN_NO_SRP_AUTH");
+        static constexpr int CUSTOM_AUTH_FLOW_ONLY_HASH = HashingUtils::CompileTimeHashString("CUSTOM_AUTH_FLOW_ONLY");
+        static constexpr int USER_PASSWORD_AUTH_HASH = HashingUtils::CompileTimeHashString("USER_PASSWORD_AUTH");
 
 
         ExplicitAuthFlowsType GetExplicitAuthFlowsTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADMIN_NO_SRP_AUTH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExplicitAuthFlowsType::ADMIN_NO_SRP_AUTH;
-          }
-          else if (hashCode == CUSTOM_AUTH_FLOW_ONLY_HASH)
-          {
-            return ExplicitAuthFlowsType::CUSTOM_AUTH_FLOW_ONLY;
-          }
-          else if (hashCode == USER_PASSWORD_AUTH_HASH)
-          {
-            return ExplicitAuthFlowsType::USER_PASSWORD_AUTH;
+          case ADMIN_NO_SRP_AUTH_HASH:
+            if (name == "ADMIN_NO_SRP_AUTH")
+            {
+              return ExplicitAuthFlowsType::ADMIN_NO_SRP_AUTH;
+            }
+            break;
+          case CUSTOM_AUTH_FLOW_ONLY_HASH:
+            if (name == "CUSTOM_AUTH_FLOW_ONLY")
+            {
+              return ExplicitAuthFlowsType::CUSTOM_AUTH_FLOW_ONLY;
+            }
+            break;
+          case USER_PASSWORD_AUTH_HASH:
+            if (name == "USER_PASSWORD_AUTH")
+            {
+              return ExplicitAuthFlowsType::USER_PASSWORD_AUTH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ExplicitAuthFlowsType::NOT_SET;
         }
 
-        Aws::String GetNameForExplicitAuthFlowsType(ExplicitAuthFlowsType enumValue)
+        const char* GetNameForExplicitAuthFlowsType(ExplicitAuthFlowsType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
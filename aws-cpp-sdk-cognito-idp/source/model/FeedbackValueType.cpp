@@ -30,20 +30,30 @@ namespace Aws
       namespace FeedbackValueTypeMapper
       {
 
-        static const int Valid_HASH = HashingUtils::HashString("Valid");
-        static const int Invalid_HASH = HashingUtils::HashString("Invalid");
+        static constexpr int Valid_HASH = HashingUtils::CompileTimeHashString("Valid");
+        static constexpr int Invalid_HASH = HashingUtils::CompileTimeHashString("Invalid");
 
 
         FeedbackValueType GetFeedbackValueTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Valid_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FeedbackValueType::Valid;
-          }
-          else if (hashCode == Invalid_HASH)
-          {
-            return FeedbackValueType::Invalid;
+          case Valid_HASH:
+            if (name == "Valid")
+            {
+              return FeedbackValueType::Valid;
+            }
+            break;
+          case Invalid_HASH:
+            if (name == "Invalid")
+            {
+              return FeedbackValueType::Invalid;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FeedbackValueType::NOT_SET;
         }
 
-        Aws::String GetNameForFeedbackValueType(FeedbackValueType enumValue)
+        const char* GetNameForFeedbackValueType(FeedbackValueType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
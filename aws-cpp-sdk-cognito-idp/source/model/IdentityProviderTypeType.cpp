@@ -30,35 +30,51 @@ namespace Aws
       namespace IdentityProviderTypeTypeMapper
       {
 
-        static const int SAML_HASH = HashingUtils::HashString("SAML");
-        static const int Facebook_HASH = HashingUtils::HashString("Facebook");
-        static const int Google_HASH = HashingUtils::HashString("Google");
-        static const int LoginWithAmazon_HASH = HashingUtils::HashString("LoginWithAmazon");
-        static const int OIDC_HASH = HashingUtils::HashString("OIDC");
+        static constexpr int SAML_HASH = HashingUtils::CompileTimeHashString("SAML");
+        static constexpr int Facebook_HASH = HashingUtils::CompileTimeHashString("Facebook");
+        static constexpr int Google_HASH = HashingUtils::CompileTimeHashString("Google");
+        static constexpr int LoginWithAmazon_HASH = HashingUtils::CompileTimeHashString("LoginWithAmazon");
+        static constexpr int OIDC_HASH = HashingUtils::CompileTimeHashString("OIDC");
 
 
         IdentityProviderTypeType GetIdentityProviderTypeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SAML_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IdentityProviderTypeType::SAML;
-          }
-          else if (hashCode == Facebook_HASH)
-          {
-            return IdentityProviderTypeType::Facebook;
-          }
-          else if (hashCode == Google_HASH)
-          {
-            return IdentityProviderTypeType::Google;
-          }
-          else if (hashCode == LoginWithAmazon_HASH)
-          {
-            return IdentityProviderTypeType::LoginWithAmazon;
-          }
-          else if (hashCode == OIDC_HASH)
-          {
-            return IdentityProviderTypeType::OIDC;
+          case SAML_HASH:
+            if (name == "SAML")
+            {
+              return IdentityProviderTypeType::SAML;
+            }
+            break;
+          case Facebook_HASH:
+            if (name == "Facebook")
+            {
+              return IdentityProviderTypeType::Facebook;
+            }
+            break;
+          case Google_HASH:
+            if (name == "Google")
+            {
+              return IdentityProviderTypeType::Google;
+            }
+            break;
+          case LoginWithAmazon_HASH:
+            if (name == "LoginWithAmazon")
+            {
+              return IdentityProviderTypeType::LoginWithAmazon;
+            }
+            break;
+          case OIDC_HASH:
+            if (name == "OIDC")
+            {
+              return IdentityProviderTypeType::OIDC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return IdentityProviderTypeType::NOT_SET;
         }
 
-        Aws::String GetNameForIdentityProviderTypeType(IdentityProviderTypeType enumValue)
+        const char* GetNameForIdentityProviderTypeType(IdentityProviderTypeType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
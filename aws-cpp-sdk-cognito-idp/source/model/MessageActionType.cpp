@@ -30,20 +30,30 @@ namespace Aws
       namespace MessageActionTypeMapper
       {
 
-        static const int RESEND_HASH = HashingUtils::HashString("RESEND");
-        static const int SUPPRESS_HASH = HashingUtils::HashString("SUPPRESS");
+        static constexpr int RESEND_HASH = HashingUtils::CompileTimeHashString("RESEND");
+        static constexpr int SUPPRESS_HASH = HashingUtils::CompileTimeHashString("SUPPRESS");
 
 
         MessageActionType GetMessageActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RESEND_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MessageActionType::RESEND;
-          }
-          else if (hashCode == SUPPRESS_HASH)
-          {
-            return MessageActionType::SUPPRESS;
+          case RESEND_HASH:
+            if (name == "RESEND")
+            {
+              return MessageActionType::RESEND;
+            }
+            break;
+          case SUPPRESS_HASH:
+            if (name == "SUPPRESS")
+            {
+              return MessageActionType::SUPPRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MessageActionType::NOT_SET;
         }
 
-        Aws::String GetNameForMessageActionType(MessageActionType enumValue)
+        const char* GetNameForMessageActionType(MessageActionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace OAuthFlowTypeMapper
       {
 
-        static const int code_HASH = HashingUtils::HashString("code");
-        static const int implicit_HASH = HashingUtils::HashString("implicit");
-        static const int client_credentials_HASH = HashingUtils::HashString("client_credentials");
+        static constexpr int code_HASH = HashingUtils::CompileTimeHashString("code");
+        static constexpr int implicit_HASH = HashingUtils::CompileTimeHashString("implicit");
+        static constexpr int client_credentials_HASH = HashingUtils::CompileTimeHashString("client_credentials");
 
 
         OAuthFlowType GetOAuthFlowTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == code_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OAuthFlowType::code;
-          }
-          else if (hashCode == implicit_HASH)
-          {
-            return OAuthFlowType::implicit;
-          }
-          else if (hashCode == client_credentials_HASH)
-          {
-            return OAuthFlowType::client_credentials;
+          case code_HASH:
+            if (name == "code")
+            {
+              return OAuthFlowType::code;
+            }
+            break;
+          case implicit_HASH:
+            if (name == "implicit")
+            {
+              return OAuthFlowType::implicit;
+            }
+            break;
+          case client_credentials_HASH:
+            if (name == "client_credentials")
+            {
+              return OAuthFlowType::client_credentials;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return OAuthFlowType::NOT_SET;
         }
 
-        Aws::String GetNameForOAuthFlowType(OAuthFlowType enumValue)
+        const char* GetNameForOAuthFlowType(OAuthFlowType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
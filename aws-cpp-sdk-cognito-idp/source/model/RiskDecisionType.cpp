@@ -30,25 +30,37 @@ namespace Aws
       namespace RiskDecisionTypeMapper
       {
 
-        static const int NoRisk_HASH = HashingUtils::HashString("NoRisk");
-        static const int AccountTakeover_HASH = HashingUtils::HashString("AccountTakeover");
-        static const int Block_HASH = HashingUtils::HashString("Block");
+        static constexpr int NoRisk_HASH = HashingUtils::CompileTimeHashString("NoRisk");
+        static constexpr int AccountTakeover_HASH = HashingUtils::CompileTimeHashString("AccountTakeover");
+        static constexpr int Block_HASH = HashingUtils::CompileTimeHashString("Block");
 
 
         RiskDecisionType GetRiskDecisionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoRisk_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RiskDecisionType::NoRisk;
-          }
-          else if (hashCode == AccountTakeover_HASH)
-          {
-            return RiskDecisionType::AccountTakeover;
-          }
-          else if (hashCode == Block_HASH)
-          {
-            return RiskDecisionType::Block;
+          case NoRisk_HASH:
+            if (name == "NoRisk")
+            {
+              return RiskDecisionType::NoRisk;
+            }
+            break;
+          case AccountTakeover_HASH:
+            if (name == "AccountTakeover")
+            {
+              return RiskDecisionType::AccountTakeover;
+            }
+            break;
+          case Block_HASH:
+            if (name == "Block")
+            {
+              return RiskDecisionType::Block;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RiskDecisionType::NOT_SET;
         }
 
-        Aws::String GetNameForRiskDecisionType(RiskDecisionType enumValue)
+        const char* GetNameForRiskDecisionType(RiskDecisionType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
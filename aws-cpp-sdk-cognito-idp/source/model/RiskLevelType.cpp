@@ -30,25 +30,37 @@ namespace Aws
       namespace RiskLevelTypeMapper
       {
 
-        static const int Low_HASH = HashingUtils::HashString("Low");
-        static const int Medium_HASH = HashingUtils::HashString("Medium");
-        static const int High_HASH = HashingUtils::HashString("High");
+        static constexpr int Low_HASH = HashingUtils::CompileTimeHashString("Low");
+        static constexpr int Medium_HASH = HashingUtils::CompileTimeHashString("Medium");
+        static constexpr int High_HASH = HashingUtils::CompileTimeHashString("High");
 
 
         RiskLevelType GetRiskLevelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Low_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RiskLevelType::Low;
-          }
-          else if (hashCode == Medium_HASH)
-          {
-            return RiskLevelType::Medium;
-          }
-          else if (hashCode == High_HASH)
-          {
-            return RiskLevelType::High;
+          case Low_HASH:
+            if (name == "Low")
+            {
+              return RiskLevelType::Low;
+            }
+            break;
+          case Medium_HASH:
+            if (name == "Medium")
+            {
+              return RiskLevelType::Medium;
+            }
+            break;
+          case High_HASH:
+            if (name == "High")
+            {
+              return RiskLevelType::High;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RiskLevelType::NOT_SET;
         }
 
-        Aws::String GetNameForRiskLevelType(RiskLevelType enumValue)
+        const char* GetNameForRiskLevelType(RiskLevelType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
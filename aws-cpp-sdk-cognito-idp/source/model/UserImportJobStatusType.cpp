@@ -30,50 +30,72 @@ namespace Aws
       namespace UserImportJobStatusTypeMapper
       {
 
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Expired_HASH = HashingUtils::HashString("Expired");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
+        static constexpr int Created_HASH = HashingUtils::CompileTimeHashString("Created");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Stopping_HASH = HashingUtils::CompileTimeHashString("Stopping");
+        static constexpr int Expired_HASH = HashingUtils::CompileTimeHashString("Expired");
+        static constexpr int Stopped_HASH = HashingUtils::CompileTimeHashString("Stopped");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
 
 
         UserImportJobStatusType GetUserImportJobStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Created_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UserImportJobStatusType::Created;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return UserImportJobStatusType::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return UserImportJobStatusType::InProgress;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return UserImportJobStatusType::Stopping;
-          }
-          else if (hashCode == Expired_HASH)
-          {
-            return UserImportJobStatusType::Expired;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return UserImportJobStatusType::Stopped;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return UserImportJobStatusType::Failed;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return UserImportJobStatusType::Succeeded;
+          case Created_HASH:
+            if (name == "Created")
+            {
+              return UserImportJobStatusType::Created;
+            }
+            break;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return UserImportJobStatusType::Pending;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return UserImportJobStatusType::InProgress;
+            }
+            break;
+          case Stopping_HASH:
+            if (name == "Stopping")
+            {
+              return UserImportJobStatusType::Stopping;
+            }
+            break;
+          case Expired_HASH:
+            if (name == "Expired")
+            {
+              return UserImportJobStatusType::Expired;
+            }
+            break;
+          case Stopped_HASH:
+            if (name == "Stopped")
+            {
+              return UserImportJobStatusType::Stopped;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return UserImportJobStatusType::Failed;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return UserImportJobStatusType::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return UserImportJobStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForUserImportJobStatusType(UserImportJobStatusType enumValue)
+        const char* GetNameForUserImportJobStatusType(UserImportJobStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace UserPoolMfaTypeMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int ON_HASH = HashingUtils::HashString("ON");
-        static const int OPTIONAL_HASH = HashingUtils::HashString("OPTIONAL");
+        static constexpr int OFF_HASH = HashingUtils::CompileTimeHashString("OFF");
+        static constexpr int ON_HASH = HashingUtils::CompileTimeHashString("ON");
+        static constexpr int OPTIONAL_HASH = HashingUtils::CompileTimeHashString("OPTIONAL");
 
 
         UserPoolMfaType GetUserPoolMfaTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UserPoolMfaType::OFF;
-          }
-          else if (hashCode == ON_HASH)
-          {
-            return UserPoolMfaType::ON;
-          }
-          else if (hashCode == OPTIONAL_HASH)
-          {
-            return UserPoolMfaType::OPTIONAL;
+          case OFF_HASH:
+            if (name == "OFF")
+            {
+              return UserPoolMfaType::OFF;
+            }
+            break;
+          case ON_HASH:
+            if (name == "ON")
+            {
+              return UserPoolMfaType::ON;
+            }
+            break;
+          case OPTIONAL_HASH:
+            if (name == "OPTIONAL")
+            {
+              return UserPoolMfaType::OPTIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return UserPoolMfaType::NOT_SET;
         }
 
-        Aws::String GetNameForUserPoolMfaType(UserPoolMfaType enumValue)
+        const char* GetNameForUserPoolMfaType(UserPoolMfaType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace UserStatusTypeMapper
       {
 
-        static const int UNCONFIRMED_HASH = HashingUtils::HashString("UNCONFIRMED");
-        static const int CONFIRMED_HASH = HashingUtils::HashString("CONFIRMED");
-        static const int ARCHIVED_HASH = HashingUtils::HashString("ARCHIVED");
-        static const int COMPROMISED_HASH = HashingUtils::HashString("COMPROMISED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int RESET_REQUIRED_HASH = HashingUtils::HashString("RESET_REQUIRED");
-        static const int FORCE_CHANGE_PASSWORD_HASH = HashingUtils::HashString("FORCE_CHANGE_PASSWORD");
+        static constexpr int UNCONFIRMED_HASH = HashingUtils::CompileTimeHashString("UNCONFIRMED");
+        static constexpr int CONFIRMED_HASH = HashingUtils::CompileTimeHashString("CONFIRMED");
+        static constexpr int ARCHIVED_HASH = HashingUtils::CompileTimeHashString("ARCHIVED");
+        static constexpr int COMPROMISED_HASH = HashingUtils::CompileTimeHashString("COMPROMISED");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
+        static constexpr int RESET_REQUIRED_HASH = HashingUtils::CompileTimeHashString("RESET_REQUIRED");
+        static constexpr int FORCE_CHANGE_PASSWORD_HASH = HashingUtils::CompileTimeHashString("FORCE_CHANGE_PASSWORD");
 
 
         UserStatusType GetUserStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNCONFIRMED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UserStatusType::UNCONFIRMED;
-          }
-          else if (hashCode == CONFIRMED_HASH)
-          {
-            return UserStatusType::CONFIRMED;
-          }
-          else if (hashCode == ARCHIVED_HASH)
-          {
-            return UserStatusType::ARCHIVED;
-          }
-          else if (hashCode == COMPROMISED_HASH)
-          {
-            return UserStatusType::COMPROMISED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return UserStatusType::UNKNOWN;
-          }
-          else if (hashCode == RESET_REQUIRED_HASH)
-          {
-            return UserStatusType::RESET_REQUIRED;
-          }
-          else if (hashCode == FORCE_CHANGE_PASSWORD_HASH)
-          {
-            return UserStatusType::FORCE_CHANGE_PASSWORD;
+          case UNCONFIRMED_HASH:
+            if (name == "UNCONFIRMED")
+            {
+              return UserStatusType::UNCONFIRMED;
+            }
+            break;
+          case CONFIRMED_HASH:
+            if (name == "CONFIRMED")
+            {
+              return UserStatusType::CONFIRMED;
+            }
+            break;
+          case ARCHIVED_HASH:
+            if (name == "ARCHIVED")
+            {
+              return UserStatusType::ARCHIVED;
+            }
+            break;
+          case COMPROMISED_HASH:
+            if (name == "COMPROMISED")
+            {
+              return UserStatusType::COMPROMISED;
+            }
+            break;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return UserStatusType::UNKNOWN;
+            }
+            break;
+          case RESET_REQUIRED_HASH:
+            if (name == "RESET_REQUIRED")
+            {
+              return UserStatusType::RESET_REQUIRED;
+            }
+            break;
+          case FORCE_CHANGE_PASSWORD_HASH:
+            if (name == "FORCE_CHANGE_PASSWORD")
+            {
+              return UserStatusType::FORCE_CHANGE_PASSWORD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return UserStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForUserStatusType(UserStatusType enumValue)
+        const char* GetNameForUserStatusType(UserStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace UsernameAttributeTypeMapper
       {
 
-        static const int phone_number_HASH = HashingUtils::HashString("phone_number");
-        static const int email_HASH = HashingUtils::HashString("email");
+        static constexpr int phone_number_HASH = HashingUtils::CompileTimeHashString("phone_number");
+        static constexpr int email_HASH = HashingUtils::CompileTimeHashString("email");
 
 
         UsernameAttributeType GetUsernameAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == phone_number_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UsernameAttributeType::phone_number;
-          }
-          else if (hashCode == email_HASH)
-          {
-            return UsernameAttributeType::email;
+          case phone_number_HASH:
+            if (name == "phone_number")
+            {
+              return UsernameAttributeType::phone_number;
+            }
+            break;
+          case email_HASH:
+            if (name == "email")
+            {
+              return UsernameAttributeType::email;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return UsernameAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForUsernameAttributeType(UsernameAttributeType enumValue)
+        const char* GetNameForUsernameAttributeType(UsernameAttributeType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
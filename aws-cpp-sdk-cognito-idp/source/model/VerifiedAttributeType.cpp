@@ -30,20 +30,30 @@ namespace Aws
       namespace VerifiedAttributeTypeMapper
       {
 
-        static const int phone_number_HASH = HashingUtils::HashString("phone_number");
-        static const int email_HASH = HashingUtils::HashString("email");
+        static constexpr int phone_number_HASH = HashingUtils::CompileTimeHashString("phone_number");
+        static constexpr int email_HASH = HashingUtils::CompileTimeHashString("email");
 
 
         VerifiedAttributeType GetVerifiedAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == phone_number_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VerifiedAttributeType::phone_number;
-          }
-          else if (hashCode == email_HASH)
-          {
-            return VerifiedAttributeType::email;
+          case phone_number_HASH:
+            if (name == "phone_number")
+            {
+              return VerifiedAttributeType::phone_number;
+            }
+            break;
+          case email_HASH:
+            if (name == "email")
+            {
+              return VerifiedAttributeType::email;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return VerifiedAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForVerifiedAttributeType(VerifiedAttributeType enumValue)
+        const char* GetNameForVerifiedAttributeType(VerifiedAttributeType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
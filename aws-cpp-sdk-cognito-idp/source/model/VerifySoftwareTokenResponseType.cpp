@@ -30,20 +30,30 @@ namespace Aws
       namespace VerifySoftwareTokenResponseTypeMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
 
 
         VerifySoftwareTokenResponseType GetVerifySoftwareTokenResponseTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VerifySoftwareTokenResponseType::SUCCESS;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return VerifySoftwareTokenResponseType::ERROR_;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return VerifySoftwareTokenResponseType::SUCCESS;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return VerifySoftwareTokenResponseType::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return VerifySoftwareTokenResponseType::NOT_SET;
         }
 
-        Aws::String GetNameForVerifySoftwareTokenResponseType(VerifySoftwareTokenResponseType enumValue)
+        const char* GetNameForVerifySoftwareTokenResponseType(VerifySoftwareTokenResponseType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
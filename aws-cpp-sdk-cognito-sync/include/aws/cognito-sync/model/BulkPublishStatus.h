@@ -36,7 +36,8 @@ namespace BulkPublishStatusMapper
 {
 AWS_COGNITOSYNC_API BulkPublishStatus GetBulkPublishStatusForName(const Aws::String& name);
 
-AWS_COGNITOSYNC_API Aws::String GetNameForBulkPublishStatus(BulkPublishStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOSYNC_API const char* GetNameForBulkPublishStatus(BulkPublishStatus value);
 } // namespace BulkPublishStatusMapper
 } // namespace Model
 } // namespace CognitoSync
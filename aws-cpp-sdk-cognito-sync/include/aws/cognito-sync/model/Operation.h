@@ -34,7 +34,8 @@ namespace OperationMapper
 {
 AWS_COGNITOSYNC_API Operation GetOperationForName(const Aws::String& name);
 
-AWS_COGNITOSYNC_API Aws::String GetNameForOperation(Operation value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOSYNC_API const char* GetNameForOperation(Operation value);
 } // namespace OperationMapper
 } // namespace Model
 } // namespace CognitoSync
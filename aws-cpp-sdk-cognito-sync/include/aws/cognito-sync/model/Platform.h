@@ -36,7 +36,8 @@ namespace PlatformMapper
 {
 AWS_COGNITOSYNC_API Platform GetPlatformForName(const Aws::String& name);
 
-AWS_COGNITOSYNC_API Aws::String GetNameForPlatform(Platform value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOSYNC_API const char* GetNameForPlatform(Platform value);
 } // namespace PlatformMapper
 } // namespace Model
 } // namespace CognitoSync
@@ -34,7 +34,8 @@ namespace StreamingStatusMapper
 {
 AWS_COGNITOSYNC_API StreamingStatus GetStreamingStatusForName(const Aws::String& name);
 
-AWS_COGNITOSYNC_API Aws::String GetNameForStreamingStatus(StreamingStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_COGNITOSYNC_API const char* GetNameForStreamingStatus(StreamingStatus value);
 } // namespace StreamingStatusMapper
 } // namespace Model
 } // namespace CognitoSync
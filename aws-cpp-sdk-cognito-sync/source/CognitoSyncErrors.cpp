@@ -28,18 +28,18 @@ namespace CognitoSync
 namespace CognitoSyncErrorMapper
 {
 
-static const int LAMBDA_THROTTLED_HASH = HashingUtils::HashString("LambdaThrottled");
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameter");
-static const int INVALID_CONFIGURATION_HASH = HashingUtils::HashString("InvalidConfiguration");
-static const int RESOURCE_CONFLICT_HASH = HashingUtils::HashString("ResourceConflict");
-static const int ALREADY_STREAMED_HASH = HashingUtils::HashString("AlreadyStreamed");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModification");
-static const int INVALID_LAMBDA_FUNCTION_OUTPUT_HASH = HashingUtils::HashString("InvalidLambdaFunctionOutput");
-static const int NOT_AUTHORIZED_HASH = HashingUtils::HashString("NotAuthorizedError");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceeded");
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalError");
-static const int DUPLICATE_REQUEST_HASH = HashingUtils::HashString("DuplicateRequest");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequests");
+static constexpr int LAMBDA_THROTTLED_HASH = HashingUtils::CompileTimeHashString("LambdaThrottled");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameter");
+static constexpr int INVALID_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("InvalidConfiguration");
+static constexpr int RESOURCE_CONFLICT_HASH = HashingUtils::CompileTimeHashString("ResourceConflict");
+static constexpr int ALREADY_STREAMED_HASH = HashingUtils::CompileTimeHashString("AlreadyStreamed");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModification");
+static constexpr int INVALID_LAMBDA_FUNCTION_OUTPUT_HASH = HashingUtils::CompileTimeHashString("InvalidLambdaFunctionOutput");
+static constexpr int NOT_AUTHORIZED_HASH = HashingUtils::CompileTimeHashString("NotAuthorizedError");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceeded");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalError");
+static constexpr int DUPLICATE_REQUEST_HASH = HashingUtils::CompileTimeHashString("DuplicateRequest");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequests");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
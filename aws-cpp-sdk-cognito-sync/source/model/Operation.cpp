@@ -30,20 +30,30 @@ namespace Aws
       namespace OperationMapper
       {
 
-        static const int replace_HASH = HashingUtils::HashString("replace");
-        static const int remove_HASH = HashingUtils::HashString("remove");
+        static constexpr int replace_HASH = HashingUtils::CompileTimeHashString("replace");
+        static constexpr int remove_HASH = HashingUtils::CompileTimeHashString("remove");
 
 
         Operation GetOperationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == replace_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Operation::replace;
-          }
-          else if (hashCode == remove_HASH)
-          {
-            return Operation::remove;
+          case replace_HASH:
+            if (name == "replace")
+            {
+              return Operation::replace;
+            }
+            break;
+          case remove_HASH:
+            if (name == "remove")
+            {
+              return Operation::remove;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Operation::NOT_SET;
         }
 
-        Aws::String GetNameForOperation(Operation enumValue)
+        const char* GetNameForOperation(Operation enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
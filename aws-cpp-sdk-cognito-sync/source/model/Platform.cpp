@@ -30,30 +30,44 @@ namespace Aws
       namespace PlatformMapper
       {
 
-        static const int APNS_HASH = HashingUtils::HashString("APNS");
-        static const int APNS_SANDBOX_HASH = HashingUtils::HashString("APNS_SANDBOX");
-        static const int GCM_HASH = HashingUtils::HashString("GCM");
-        static const int ADM_HASH = HashingUtils::HashString("ADM");
+        static constexpr int APNS_HASH = HashingUtils::CompileTimeHashString("APNS");
+        static constexpr int APNS_SANDBOX_HASH = HashingUtils::CompileTimeHashString("APNS_SANDBOX");
+        static constexpr int GCM_HASH = HashingUtils::CompileTimeHashString("GCM");
+        static constexpr int ADM_HASH = HashingUtils::CompileTimeHashString("ADM");
 
 
         Platform GetPlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == APNS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Platform::APNS;
-          }
-          else if (hashCode == APNS_SANDBOX_HASH)
-          {
-            return Platform::APNS_SANDBOX;
-          }
-          else if (hashCode == GCM_HASH)
-          {
-            return Platform::GCM;
-          }
-          else if (hashCode == ADM_HASH)
-          {
-            return Platform::ADM;
+          case APNS_HASH:
+            if (name == "APNS")
+            {
+              return Platform::APNS;
+            }
+            break;
+          case APNS_SANDBOX_HASH:
+            if (name == "APNS_SANDBOX")
+            {
+              return Platform::APNS_SANDBOX;
+            }
+            break;
+          case GCM_HASH:
+            if (name == "GCM")
+            {
+              return Platform::GCM;
+            }
+            break;
+          case ADM_HASH:
+            if (name == "ADM")
+            {
+              return Platform::ADM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return Platform::NOT_SET;
         }
 
-        Aws::String GetNameForPlatform(Platform enumValue)
+        const char* GetNameForPlatform(Platform enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -41,7 +41,8 @@ namespace EntityTypeMapper
 {
 AWS_COMPREHEND_API EntityType GetEntityTypeForName(const Aws::String& name);
 
-AWS_COMPREHEND_API Aws::String GetNameForEntityType(EntityType value);
+// names of values not modeled point into the enum overflow container
+AWS_COMPREHEND_API const char* GetNameForEntityType(EntityType value);
 } // namespace EntityTypeMapper
 } // namespace Model
 } // namespace Comprehend
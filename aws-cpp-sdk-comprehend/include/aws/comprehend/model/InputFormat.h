@@ -34,7 +34,8 @@ namespace InputFormatMapper
 {
 AWS_COMPREHEND_API InputFormat GetInputFormatForName(const Aws::String& name);
 
-AWS_COMPREHEND_API Aws::String GetNameForInputFormat(InputFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_COMPREHEND_API const char* GetNameForInputFormat(InputFormat value);
 } // namespace InputFormatMapper
 } // namespace Model
 } // namespace Comprehend
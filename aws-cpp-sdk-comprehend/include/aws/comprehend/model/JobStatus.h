@@ -38,7 +38,8 @@ namespace JobStatusMapper
 {
 AWS_COMPREHEND_API JobStatus GetJobStatusForName(const Aws::String& name);
 
-AWS_COMPREHEND_API Aws::String GetNameForJobStatus(JobStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_COMPREHEND_API const char* GetNameForJobStatus(JobStatus value);
 } // namespace JobStatusMapper
 } // namespace Model
 } // namespace Comprehend
@@ -34,7 +34,8 @@ namespace LanguageCodeMapper
 {
 AWS_COMPREHEND_API LanguageCode GetLanguageCodeForName(const Aws::String& name);
 
-AWS_COMPREHEND_API Aws::String GetNameForLanguageCode(LanguageCode value);
+// names of values not modeled point into the enum overflow container
+AWS_COMPREHEND_API const char* GetNameForLanguageCode(LanguageCode value);
 } // namespace LanguageCodeMapper
 } // namespace Model
 } // namespace Comprehend
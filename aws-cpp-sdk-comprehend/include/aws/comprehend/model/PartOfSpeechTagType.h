@@ -49,7 +49,8 @@ namespace PartOfSpeechTagTypeMapper
 {
 AWS_COMPREHEND_API PartOfSpeechTagType GetPartOfSpeechTagTypeForName(const Aws::String& name);
 
-AWS_COMPREHEND_API Aws::String GetNameForPartOfSpeechTagType(PartOfSpeechTagType value);
+// names of values not modeled point into the enum overflow container
+AWS_COMPREHEND_API const char* GetNameForPartOfSpeechTagType(PartOfSpeechTagType value);
 } // namespace PartOfSpeechTagTypeMapper
 } // namespace Model
 } // namespace Comprehend
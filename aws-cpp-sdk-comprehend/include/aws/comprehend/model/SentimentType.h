@@ -36,7 +36,8 @@ namespace SentimentTypeMapper
 {
 AWS_COMPREHEND_API SentimentType GetSentimentTypeForName(const Aws::String& name);
 
-AWS_COMPREHEND_API Aws::String GetNameForSentimentType(SentimentType value);
+// names of values not modeled point into the enum overflow container
+AWS_COMPREHEND_API const char* GetNameForSentimentType(SentimentType value);
 } // namespace SentimentTypeMapper
 } // namespace Model
 } // namespace Comprehend
@@ -33,7 +33,8 @@ namespace SyntaxLanguageCodeMapper
 {
 AWS_COMPREHEND_API SyntaxLanguageCode GetSyntaxLanguageCodeForName(const Aws::String& name);
 
-AWS_COMPREHEND_API Aws::String GetNameForSyntaxLanguageCode(SyntaxLanguageCode value);
+// names of values not modeled point into the enum overflow container
+AWS_COMPREHEND_API const char* GetNameForSyntaxLanguageCode(SyntaxLanguageCode value);
 } // namespace SyntaxLanguageCodeMapper
 } // namespace Model
 } // namespace Comprehend
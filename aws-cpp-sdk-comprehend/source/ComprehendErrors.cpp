@@ -28,14 +28,14 @@ namespace Comprehend
 namespace ComprehendErrorMapper
 {
 
-static const int BATCH_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("BatchSizeLimitExceededException");
-static const int INTERNAL_SERVER_HASH = HashingUtils::HashString("InternalServerException");
-static const int JOB_NOT_FOUND_HASH = HashingUtils::HashString("JobNotFoundException");
-static const int TEXT_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TextSizeLimitExceededException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int UNSUPPORTED_LANGUAGE_HASH = HashingUtils::HashString("UnsupportedLanguageException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
-static const int INVALID_FILTER_HASH = HashingUtils::HashString("InvalidFilterException");
+static constexpr int BATCH_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("BatchSizeLimitExceededException");
+static constexpr int INTERNAL_SERVER_HASH = HashingUtils::CompileTimeHashString("InternalServerException");
+static constexpr int JOB_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("JobNotFoundException");
+static constexpr int TEXT_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TextSizeLimitExceededException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int UNSUPPORTED_LANGUAGE_HASH = HashingUtils::CompileTimeHashString("UnsupportedLanguageException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
+static constexpr int INVALID_FILTER_HASH = HashingUtils::CompileTimeHashString("InvalidFilterException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,55 +30,79 @@ namespace Aws
       namespace EntityTypeMapper
       {
 
-        static const int PERSON_HASH = HashingUtils::HashString("PERSON");
-        static const int LOCATION_HASH = HashingUtils::HashString("LOCATION");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
-        static const int COMMERCIAL_ITEM_HASH = HashingUtils::HashString("COMMERCIAL_ITEM");
-        static const int EVENT_HASH = HashingUtils::HashString("EVENT");
-        static const int DATE_HASH = HashingUtils::HashString("DATE");
-        static const int QUANTITY_HASH = HashingUtils::HashString("QUANTITY");
-        static const int TITLE_HASH = HashingUtils::HashString("TITLE");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
+        static constexpr int PERSON_HASH = HashingUtils::CompileTimeHashString("PERSON");
+        static constexpr int LOCATION_HASH = HashingUtils::CompileTimeHashString("LOCATION");
+        static constexpr int ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION");
+        static constexpr int COMMERCIAL_ITEM_HASH = HashingUtils::CompileTimeHashString("COMMERCIAL_ITEM");
+        static constexpr int EVENT_HASH = HashingUtils::CompileTimeHashString("EVENT");
+        static constexpr int DATE_HASH = HashingUtils::CompileTimeHashString("DATE");
+        static constexpr int QUANTITY_HASH = HashingUtils::CompileTimeHashString("QUANTITY");
+        static constexpr int TITLE_HASH = HashingUtils::CompileTimeHashString("TITLE");
+        static constexpr int OTHER_HASH = HashingUtils::CompileTimeHashString("OTHER");
 
 
         EntityType GetEntityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PERSON_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EntityType::PERSON;
-          }
-          else if (hashCode == LOCATION_HASH)
-          {
-            return EntityType::LOCATION;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
-          {
-            return EntityType::ORGANIZATION;
-          }
-          else if (hashCode == COMMERCIAL_ITEM_HASH)
-          {
-            return EntityType::COMMERCIAL_ITEM;
-          }
-          else if (hashCode == EVENT_HASH)
-          {
-            return EntityType::EVENT;
-          }
-          else if (hashCode == DATE_HASH)
-          {
-            return EntityType::DATE;
-          }
-          else if (hashCode == QUANTITY_HASH)
-          {
-            return EntityType::QUANTITY;
-          }
-          else if (hashCode == TITLE_HASH)
-          {
-            return EntityType::TITLE;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return EntityType::OTHER;
+          case PERSON_HASH:
+            if (name == "PERSON")
+            {
+              return EntityType::PERSON;
+            }
+            break;
+          case LOCATION_HASH:
+            if (name == "LOCATION")
+            {
+              return EntityType::LOCATION;
+            }
+            break;
+          case ORGANIZATION_HASH:
+            if (name == "ORGANIZATION")
+            {
+              return EntityType::ORGANIZATION;
+            }
+            break;
+          case COMMERCIAL_ITEM_HASH:
+            if (name == "COMMERCIAL_ITEM")
+            {
+              return EntityType::COMMERCIAL_ITEM;
+            }
+            break;
+          case EVENT_HASH:
+            if (name == "EVENT")
+            {
+              return EntityType::EVENT;
+            }
+            break;
+          case DATE_HASH:
+            if (name == "DATE")
+            {
+              return EntityType::DATE;
+            }
+            break;
+          case QUANTITY_HASH:
+            if (name == "QUANTITY")
+            {
+              return EntityType::QUANTITY;
+            }
+            break;
+          case TITLE_HASH:
+            if (name == "TITLE")
+            {
+              return EntityType::TITLE;
+            }
+            break;
+          case OTHER_HASH:
+            if (name == "OTHER")
+            {
+              return EntityType::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return EntityType::NOT_SET;
         }
 
-        Aws::String GetNameForEntityType(EntityType enumValue)
+        const char* GetNameForEntityType(EntityType enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
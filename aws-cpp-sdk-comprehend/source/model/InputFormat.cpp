@@ -30,20 +30,30 @@ namespace Aws
       namespace InputFormatMapper
       {
 
-        static const int ONE_DOC_PER_FILE_HASH = HashingUtils::HashString("ONE_DOC_PER_FILE");
-        static const int ONE_DOC_PER_LINE_HASH = HashingUtils::HashString("ONE_DOC_PER_LINE");
+        static constexpr int ONE_DOC_PER_FILE_HASH = HashingUtils::CompileTimeHashString("ONE_DOC_PER_FILE");
+        static constexpr int ONE_DOC_PER_LINE_HASH = HashingUtils::CompileTimeHashString("ONE_DOC_PER_LINE");
 
 
         InputFormat GetInputFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONE_DOC_PER_FILE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputFormat::ONE_DOC_PER_FILE;
-          }
-          else if (hashCode == ONE_DOC_PER_LINE_HASH)
-          {
-            return InputFormat::ONE_DOC_PER_LINE;
+          case ONE_DOC_PER_FILE_HASH:
+            if (name == "ONE_DOC_PER_FILE")
+            {
+              return InputFormat::ONE_DOC_PER_FILE;
+            }
+            break;
+          case ONE_DOC_PER_LINE_HASH:
+            if (name == "ONE_DOC_PER_LINE")
+            {
+              return InputFormat::ONE_DOC_PER_LINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InputFormat::NOT_SET;
         }
 
-        Aws::String GetNameForInputFormat(InputFormat enumValue)
+        const char* GetNameForInputFormat(InputFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
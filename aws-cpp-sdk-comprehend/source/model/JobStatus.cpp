@@ -30,40 +30,58 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int STOP_REQUESTED_HASH = HashingUtils::HashString("STOP_REQUESTED");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
+        static constexpr int SUBMITTED_HASH = HashingUtils::CompileTimeHashString("SUBMITTED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int STOP_REQUESTED_HASH = HashingUtils::CompileTimeHashString("STOP_REQUESTED");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
 
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobStatus::SUBMITTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return JobStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return JobStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobStatus::FAILED;
-          }
-          else if (hashCode == STOP_REQUESTED_HASH)
-          {
-            return JobStatus::STOP_REQUESTED;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return JobStatus::STOPPED;
+          case SUBMITTED_HASH:
+            if (name == "SUBMITTED")
+            {
+              return JobStatus::SUBMITTED;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return JobStatus::IN_PROGRESS;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return JobStatus::COMPLETED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return JobStatus::FAILED;
+            }
+            break;
+          case STOP_REQUESTED_HASH:
+            if (name == "STOP_REQUESTED")
+            {
+              return JobStatus::STOP_REQUESTED;
+            }
+            break;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return JobStatus::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatus(JobStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace LanguageCodeMapper
       {
 
-        static const int en_HASH = HashingUtils::HashString("en");
-        static const int es_HASH = HashingUtils::HashString("es");
+        static constexpr int en_HASH = HashingUtils::CompileTimeHashString("en");
+        static constexpr int es_HASH = HashingUtils::CompileTimeHashString("es");
 
 
         LanguageCode GetLanguageCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LanguageCode::en;
-          }
-          else if (hashCode == es_HASH)
-          {
-            return LanguageCode::es;
+          case en_HASH:
+            if (name == "en")
+            {
+              return LanguageCode::en;
+            }
+            break;
+          case es_HASH:
+            if (name == "es")
+            {
+              return LanguageCode::es;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LanguageCode::NOT_SET;
         }
 
-        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
+        const char* GetNameForLanguageCode(LanguageCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
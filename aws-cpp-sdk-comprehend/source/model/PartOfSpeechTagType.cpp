@@ -30,95 +30,135 @@ namespace Aws
       namespace PartOfSpeechTagTypeMapper
       {
 
-        static const int ADJ_HASH = HashingUtils::HashString("ADJ");
-        static const int ADP_HASH = HashingUtils::HashString("ADP");
-        static const int ADV_HASH = HashingUtils::HashString("ADV");
-        static const int AUX_HASH = HashingUtils::HashString("AUX");
-        static const int CONJ_HASH = HashingUtils::HashString("CONJ");
-        static const int DET_HASH = HashingUtils::HashString("DET");
-        static const int INTJ_HASH = HashingUtils::HashString("INTJ");
-        static const int NOUN_HASH = HashingUtils::HashString("NOUN");
-        static const int NUM_HASH = HashingUtils::HashString("NUM");
-        static const int O_HASH = HashingUtils::HashString("O");
-        static const int PART_HASH = HashingUtils::HashString("PART");
-        static const int PRON_HASH = HashingUtils::HashString("PRON");
-        static const int PROPN_HASH = HashingUtils::HashString("PROPN");
-        static const int PUNCT_HASH = HashingUtils::HashString("PUNCT");
-        static const int SCONJ_HASH = HashingUtils::HashString("SCONJ");
-        static const int SYM_HASH = HashingUtils::HashString("SYM");
-        static const int VERB_HASH = HashingUtils::HashString("VERB");
+        static constexpr int ADJ_HASH = HashingUtils::CompileTimeHashString("ADJ");
+        static constexpr int ADP_HASH = HashingUtils::CompileTimeHashString("ADP");
+        static constexpr int ADV_HASH = HashingUtils::CompileTimeHashString("ADV");
+        static constexpr int AUX_HASH = HashingUtils::CompileTimeHashString("AUX");
+        static constexpr int CONJ_HASH = HashingUtils::CompileTimeHashString("CONJ");
+        static constexpr int DET_HASH = HashingUtils::CompileTimeHashString("DET");
+        static constexpr int INTJ_HASH = HashingUtils::CompileTimeHashString("INTJ");
+        static constexpr int NOUN_HASH = HashingUtils::CompileTimeHashString("NOUN");
+        static constexpr int NUM_HASH = HashingUtils::CompileTimeHashString("NUM");
+        static constexpr int O_HASH = HashingUtils::CompileTimeHashString("O");
+        static constexpr int PART_HASH = HashingUtils::CompileTimeHashString("PART");
+        static constexpr int PRON_HASH = HashingUtils::CompileTimeHashString("PRON");
+        static constexpr int PROPN_HASH = HashingUtils::CompileTimeHashString("PROPN");
+        static constexpr int PUNCT_HASH = HashingUtils::CompileTimeHashString("PUNCT");
+        static constexpr int SCONJ_HASH = HashingUtils::CompileTimeHashString("SCONJ");
+        static constexpr int SYM_HASH = HashingUtils::CompileTimeHashString("SYM");
+        static constexpr int VERB_HASH = HashingUtils::CompileTimeHashString("VERB");
 
 
         PartOfSpeechTagType GetPartOfSpeechTagTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADJ_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PartOfSpeechTagType::ADJ;
-          }
-          else if (hashCode == ADP_HASH)
-          {
-            return PartOfSpeechTagType::ADP;
-          }
-          else if (hashCode == ADV_HASH)
-          {
-            return PartOfSpeechTagType::ADV;
-          }
-          else if (hashCode == AUX_HASH)
-          {
-            return PartOfSpeechTagType::AUX;
-          }
-          else if (hashCode == CONJ_HASH)
-          {
-            return PartOfSpeechTagType::CONJ;
-          }
-          else if (hashCode == DET_HASH)
-          {
-            return PartOfSpeechTagType::DET;
-          }
-          else if (hashCode == INTJ_HASH)
-          {
-            return PartOfSpeechTagType::INTJ;
-          }
-          else if (hashCode == NOUN_HASH)
-          {
-            return PartOfSpeechTagType::NOUN;
-          }
-          else if (hashCode == NUM_HASH)
-          {
-            return PartOfSpeechTagType::NUM;
-          }
-          else if (hashCode == O_HASH)
-          {
-            return PartOfSpeechTagType::O;
-          }
-          else if (hashCode == PART_HASH)
-          {
-            return PartOfSpeechTagType::PART;
-          }
-          else if (hashCode == PRON_HASH)
-          {
-            return PartOfSpeechTagType::PRON;
-          }
-          else if (hashCode == PROPN_HASH)
-          {
-            return PartOfSpeechTagType::PROPN;
-          }
-          else if (hashCode == PUNCT_HASH)
-          {
-            return PartOfSpeechTagType::PUNCT;
-          }
-          else if (hashCode == SCONJ_HASH)
-          {
-            return PartOfSpeechTagType::SCONJ;
-          }
-          else if (hashCode == SYM_HASH)
-          {
-            return PartOfSpeechTagType::SYM;
-          }
-          else if (hashCode == VERB_HASH)
-          {
-            return PartOfSpeechTagType::VERB;
+          case ADJ_HASH:
+            if (name == "ADJ")
+            {
+              return PartOfSpeechTagType::ADJ;
+            }
+            break;
+          case ADP_HASH:
+            if (name == "ADP")
+            {
+              return PartOfSpeechTagType::ADP;
+            }
+            break;
+          case ADV_HASH:
+            if (name == "ADV")
+            {
+              return PartOfSpeechTagType::ADV;
+            }
+            break;
+          case AUX_HASH:
+            if (name == "AUX")
+            {
+              return PartOfSpeechTagType::AUX;
+            }
+            break;
+          case CONJ_HASH:
+            if (name == "CONJ")
+            {
+              return PartOfSpeechTagType::CONJ;
+            }
+            break;
+          case DET_HASH:
+            if (name == "DET")
+            {
+              return PartOfSpeechTagType::DET;
+            }
+            break;
+          case INTJ_HASH:
+            if (name == "INTJ")
+            {
+              return PartOfSpeechTagType::INTJ;
+            }
+            break;
+          case NOUN_HASH:
+            if (name == "NOUN")
+            {
+              return PartOfSpeechTagType::NOUN;
+            }
+            break;
+          case NUM_HASH:
+            if (name == "NUM")
+            {
+              return PartOfSpeechTagType::NUM;
+            }
+            break;
+          case O_HASH:
+            if (name == "O")
+            {
+              return PartOfSpeechTagType::O;
+            }
+            break;
+          case PART_HASH:
+            if (name == "PART")
+            {
+              return PartOfSpeechTagType::PART;
+            }
+            break;
+          case PRON_HASH:
+            if (name == "PRON")
+            {
+              return PartOfSpeechTagType::PRON;
+            }
+            break;
+          case PROPN_HASH:
+            if (name == "PROPN")
+            {
+              return PartOfSpeechTagType::PROPN;
+            }
+            break;
+          case PUNCT_HASH:
+            if (name == "PUNCT")
+            {
+              return PartOfSpeechTagType::PUNCT;
+            }
+            break;
+          case SCONJ_HASH:
+            if (name == "SCONJ")
+            {
+              return PartOfSpeechTagType::SCONJ;
+            }
+            break;
+          case SYM_HASH:
+            if (name == "SYM")
+            {
+              return PartOfSpeechTagType::SYM;
+            }
+            break;
+          case VERB_HASH:
+            if (name == "VERB")
+            {
+              return PartOfSpeechTagType::VERB;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,7 +170,7 @@ namespace Aws
           return PartOfSpeechTagType::NOT_SET;
         }
 
-        Aws::String GetNameForPartOfSpeechTagType(PartOfSpeechTagType enumValue)
+        const char* GetNameForPartOfSpeechTagType(PartOfSpeechTagType enumValue)
         {
           switch(enumValue)
           {
@@ -172,7 +212,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
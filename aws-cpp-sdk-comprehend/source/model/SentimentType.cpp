@@ -30,30 +30,44 @@ namespace Aws
       namespace SentimentTypeMapper
       {
 
-        static const int POSITIVE_HASH = HashingUtils::HashString("POSITIVE");
-        static const int NEGATIVE_HASH = HashingUtils::HashString("NEGATIVE");
-        static const int NEUTRAL_HASH = HashingUtils::HashString("NEUTRAL");
-        static const int MIXED_HASH = HashingUtils::HashString("MIXED");
+        static constexpr int POSITIVE_HASH = HashingUtils::CompileTimeHashString("POSITIVE");
+        static constexpr int NEGATIVE_HASH = HashingUtils::CompileTimeHashString("NEGATIVE");
+        static constexpr int NEUTRAL_HASH = HashingUtils::CompileTimeHashString("NEUTRAL");
+        static constexpr int MIXED_HASH = HashingUtils::CompileTimeHashString("MIXED");
 
 
         SentimentType GetSentimentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == POSITIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SentimentType::POSITIVE;
-          }
-          else if (hashCode == NEGATIVE_HASH)
-          {
-            return SentimentType::NEGATIVE;
-          }
-          else if (hashCode == NEUTRAL_HASH)
-          {
-            return SentimentType::NEUTRAL;
-          }
-          else if (hashCode == MIXED_HASH)
-          {
-            return SentimentType::MIXED;
+          case POSITIVE_HASH:
+            if (name == "POSITIVE")
+            {
+              return SentimentType::POSITIVE;
+            }
+            break;
+          case NEGATIVE_HASH:
+            if (name == "NEGATIVE")
+            {
+              return SentimentType::NEGATIVE;
+            }
+            break;
+          case NEUTRAL_HASH:
+            if (name == "NEUTRAL")
+            {
+              return SentimentType::NEUTRAL;
+            }
+            break;
+          case MIXED_HASH:
+            if (name == "MIXED")
+            {
+              return SentimentType::MIXED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return SentimentType::NOT_SET;
         }
 
-        Aws::String GetNameForSentimentType(SentimentType enumValue)
+        const char* GetNameForSentimentType(SentimentType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace SyntaxLanguageCodeMapper
       {
 
-        static const int en_HASH = HashingUtils::HashString("en");
+        static constexpr int en_HASH = HashingUtils::CompileTimeHashString("en");
 
 
         SyntaxLanguageCode GetSyntaxLanguageCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SyntaxLanguageCode::en;
+          case en_HASH:
+            if (name == "en")
+            {
+              return SyntaxLanguageCode::en;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return SyntaxLanguageCode::NOT_SET;
         }
 
-        Aws::String GetNameForSyntaxLanguageCode(SyntaxLanguageCode enumValue)
+        const char* GetNameForSyntaxLanguageCode(SyntaxLanguageCode enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace AggregatedSourceStatusTypeMapper
 {
 AWS_CONFIGSERVICE_API AggregatedSourceStatusType GetAggregatedSourceStatusTypeForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForAggregatedSourceStatusType(AggregatedSourceStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForAggregatedSourceStatusType(AggregatedSourceStatusType value);
 } // namespace AggregatedSourceStatusTypeMapper
 } // namespace Model
 } // namespace ConfigService
@@ -34,7 +34,8 @@ namespace AggregatedSourceTypeMapper
 {
 AWS_CONFIGSERVICE_API AggregatedSourceType GetAggregatedSourceTypeForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForAggregatedSourceType(AggregatedSourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForAggregatedSourceType(AggregatedSourceType value);
 } // namespace AggregatedSourceTypeMapper
 } // namespace Model
 } // namespace ConfigService
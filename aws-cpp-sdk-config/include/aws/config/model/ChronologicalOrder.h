@@ -34,7 +34,8 @@ namespace ChronologicalOrderMapper
 {
 AWS_CONFIGSERVICE_API ChronologicalOrder GetChronologicalOrderForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForChronologicalOrder(ChronologicalOrder value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForChronologicalOrder(ChronologicalOrder value);
 } // namespace ChronologicalOrderMapper
 } // namespace Model
 } // namespace ConfigService
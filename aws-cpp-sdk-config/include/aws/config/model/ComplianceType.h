@@ -36,7 +36,8 @@ namespace ComplianceTypeMapper
 {
 AWS_CONFIGSERVICE_API ComplianceType GetComplianceTypeForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForComplianceType(ComplianceType value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForComplianceType(ComplianceType value);
 } // namespace ComplianceTypeMapper
 } // namespace Model
 } // namespace ConfigService
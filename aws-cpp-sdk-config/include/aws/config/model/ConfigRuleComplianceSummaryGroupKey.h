@@ -34,7 +34,8 @@ namespace ConfigRuleComplianceSummaryGroupKeyMapper
 {
 AWS_CONFIGSERVICE_API ConfigRuleComplianceSummaryGroupKey GetConfigRuleComplianceSummaryGroupKeyForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForConfigRuleComplianceSummaryGroupKey(ConfigRuleComplianceSummaryGroupKey value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForConfigRuleComplianceSummaryGroupKey(ConfigRuleComplianceSummaryGroupKey value);
 } // namespace ConfigRuleComplianceSummaryGroupKeyMapper
 } // namespace Model
 } // namespace ConfigService
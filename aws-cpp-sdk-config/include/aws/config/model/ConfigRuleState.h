@@ -36,7 +36,8 @@ namespace ConfigRuleStateMapper
 {
 AWS_CONFIGSERVICE_API ConfigRuleState GetConfigRuleStateForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForConfigRuleState(ConfigRuleState value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForConfigRuleState(ConfigRuleState value);
 } // namespace ConfigRuleStateMapper
 } // namespace Model
 } // namespace ConfigService
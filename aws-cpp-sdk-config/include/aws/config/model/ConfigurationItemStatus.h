@@ -37,7 +37,8 @@ namespace ConfigurationItemStatusMapper
 {
 AWS_CONFIGSERVICE_API ConfigurationItemStatus GetConfigurationItemStatusForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForConfigurationItemStatus(ConfigurationItemStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForConfigurationItemStatus(ConfigurationItemStatus value);
 } // namespace ConfigurationItemStatusMapper
 } // namespace Model
 } // namespace ConfigService
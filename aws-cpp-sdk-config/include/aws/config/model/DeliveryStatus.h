@@ -35,7 +35,8 @@ namespace DeliveryStatusMapper
 {
 AWS_CONFIGSERVICE_API DeliveryStatus GetDeliveryStatusForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForDeliveryStatus(DeliveryStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForDeliveryStatus(DeliveryStatus value);
 } // namespace DeliveryStatusMapper
 } // namespace Model
 } // namespace ConfigService
@@ -33,7 +33,8 @@ namespace EventSourceMapper
 {
 AWS_CONFIGSERVICE_API EventSource GetEventSourceForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForEventSource(EventSource value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForEventSource(EventSource value);
 } // namespace EventSourceMapper
 } // namespace Model
 } // namespace ConfigService
@@ -37,7 +37,8 @@ namespace MaximumExecutionFrequencyMapper
 {
 AWS_CONFIGSERVICE_API MaximumExecutionFrequency GetMaximumExecutionFrequencyForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForMaximumExecutionFrequency(MaximumExecutionFrequency value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForMaximumExecutionFrequency(MaximumExecutionFrequency value);
 } // namespace MaximumExecutionFrequencyMapper
 } // namespace Model
 } // namespace ConfigService
@@ -36,7 +36,8 @@ namespace MessageTypeMapper
 {
 AWS_CONFIGSERVICE_API MessageType GetMessageTypeForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForMessageType(MessageType value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForMessageType(MessageType value);
 } // namespace MessageTypeMapper
 } // namespace Model
 } // namespace ConfigService
@@ -34,7 +34,8 @@ namespace OwnerMapper
 {
 AWS_CONFIGSERVICE_API Owner GetOwnerForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForOwner(Owner value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForOwner(Owner value);
 } // namespace OwnerMapper
 } // namespace Model
 } // namespace ConfigService
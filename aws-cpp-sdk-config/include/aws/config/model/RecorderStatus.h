@@ -35,7 +35,8 @@ namespace RecorderStatusMapper
 {
 AWS_CONFIGSERVICE_API RecorderStatus GetRecorderStatusForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForRecorderStatus(RecorderStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForRecorderStatus(RecorderStatus value);
 } // namespace RecorderStatusMapper
 } // namespace Model
 } // namespace ConfigService
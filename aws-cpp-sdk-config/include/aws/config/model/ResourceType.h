@@ -90,7 +90,8 @@ namespace ResourceTypeMapper
 {
 AWS_CONFIGSERVICE_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
-AWS_CONFIGSERVICE_API Aws::String GetNameForResourceType(ResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_CONFIGSERVICE_API const char* GetNameForResourceType(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace ConfigService
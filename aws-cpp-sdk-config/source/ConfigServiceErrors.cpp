@@ -28,38 +28,38 @@ namespace ConfigService
 namespace ConfigServiceErrorMapper
 {
 
-static const int NO_SUCH_DELIVERY_CHANNEL_HASH = HashingUtils::HashString("NoSuchDeliveryChannelException");
-static const int NO_SUCH_CONFIG_RULE_HASH = HashingUtils::HashString("NoSuchConfigRuleException");
-static const int NO_AVAILABLE_CONFIGURATION_RECORDER_HASH = HashingUtils::HashString("NoAvailableConfigurationRecorderException");
-static const int NO_AVAILABLE_ORGANIZATION_HASH = HashingUtils::HashString("NoAvailableOrganizationException");
-static const int NO_SUCH_RETENTION_CONFIGURATION_HASH = HashingUtils::HashString("NoSuchRetentionConfigurationException");
-static const int INVALID_LIMIT_HASH = HashingUtils::HashString("InvalidLimitException");
-static const int INVALID_RECORDING_GROUP_HASH = HashingUtils::HashString("InvalidRecordingGroupException");
-static const int INVALID_S_N_S_TOPIC_A_R_N_HASH = HashingUtils::HashString("InvalidSNSTopicARNException");
-static const int MAX_NUMBER_OF_DELIVERY_CHANNELS_EXCEEDED_HASH = HashingUtils::HashString("MaxNumberOfDeliveryChannelsExceededException");
-static const int INVALID_RESULT_TOKEN_HASH = HashingUtils::HashString("InvalidResultTokenException");
-static const int INVALID_ROLE_HASH = HashingUtils::HashString("InvalidRoleException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int INVALID_CONFIGURATION_RECORDER_NAME_HASH = HashingUtils::HashString("InvalidConfigurationRecorderNameException");
-static const int INVALID_S3_KEY_PREFIX_HASH = HashingUtils::HashString("InvalidS3KeyPrefixException");
-static const int NO_SUCH_CONFIGURATION_RECORDER_HASH = HashingUtils::HashString("NoSuchConfigurationRecorderException");
-static const int INVALID_DELIVERY_CHANNEL_NAME_HASH = HashingUtils::HashString("InvalidDeliveryChannelNameException");
-static const int LAST_DELIVERY_CHANNEL_DELETE_FAILED_HASH = HashingUtils::HashString("LastDeliveryChannelDeleteFailedException");
-static const int ORGANIZATION_ALL_FEATURES_NOT_ENABLED_HASH = HashingUtils::HashString("OrganizationAllFeaturesNotEnabledException");
-static const int MAX_NUMBER_OF_CONFIGURATION_RECORDERS_EXCEEDED_HASH = HashingUtils::HashString("MaxNumberOfConfigurationRecordersExceededException");
-static const int MAX_NUMBER_OF_CONFIG_RULES_EXCEEDED_HASH = HashingUtils::HashString("MaxNumberOfConfigRulesExceededException");
-static const int NO_RUNNING_CONFIGURATION_RECORDER_HASH = HashingUtils::HashString("NoRunningConfigurationRecorderException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int RESOURCE_NOT_DISCOVERED_HASH = HashingUtils::HashString("ResourceNotDiscoveredException");
-static const int INSUFFICIENT_PERMISSIONS_HASH = HashingUtils::HashString("InsufficientPermissionsException");
-static const int INSUFFICIENT_DELIVERY_POLICY_HASH = HashingUtils::HashString("InsufficientDeliveryPolicyException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int MAX_NUMBER_OF_RETENTION_CONFIGURATIONS_EXCEEDED_HASH = HashingUtils::HashString("MaxNumberOfRetentionConfigurationsExceededException");
-static const int NO_AVAILABLE_DELIVERY_CHANNEL_HASH = HashingUtils::HashString("NoAvailableDeliveryChannelException");
-static const int NO_SUCH_CONFIGURATION_AGGREGATOR_HASH = HashingUtils::HashString("NoSuchConfigurationAggregatorException");
-static const int ORGANIZATION_ACCESS_DENIED_HASH = HashingUtils::HashString("OrganizationAccessDeniedException");
-static const int NO_SUCH_BUCKET_HASH = HashingUtils::HashString("NoSuchBucketException");
-static const int INVALID_TIME_RANGE_HASH = HashingUtils::HashString("InvalidTimeRangeException");
+static constexpr int NO_SUCH_DELIVERY_CHANNEL_HASH = HashingUtils::CompileTimeHashString("NoSuchDeliveryChannelException");
+static constexpr int NO_SUCH_CONFIG_RULE_HASH = HashingUtils::CompileTimeHashString("NoSuchConfigRuleException");
+static constexpr int NO_AVAILABLE_CONFIGURATION_RECORDER_HASH = HashingUtils::CompileTimeHashString("NoAvailableConfigurationRecorderException");
+static constexpr int NO_AVAILABLE_ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("NoAvailableOrganizationException");
+static constexpr int NO_SUCH_RETENTION_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("NoSuchRetentionConfigurationException");
+static constexpr int INVALID_LIMIT_HASH = HashingUtils::CompileTimeHashString("InvalidLimitException");
+static constexpr int INVALID_RECORDING_GROUP_HASH = HashingUtils::CompileTimeHashString("InvalidRecordingGroupException");
+static constexpr int INVALID_S_N_S_TOPIC_A_R_N_HASH = HashingUtils::CompileTimeHashString("InvalidSNSTopicARNException");
+static constexpr int MAX_NUMBER_OF_DELIVERY_CHANNELS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxNumberOfDeliveryChannelsExceededException");
+static constexpr int INVALID_RESULT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidResultTokenException");
+static constexpr int INVALID_ROLE_HASH = HashingUtils::CompileTimeHashString("InvalidRoleException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int INVALID_CONFIGURATION_RECORDER_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidConfigurationRecorderNameException");
+static constexpr int INVALID_S3_KEY_PREFIX_HASH = HashingUtils::CompileTimeHashString("InvalidS3KeyPrefixException");
+static constexpr int NO_SUCH_CONFIGURATION_RECORDER_HASH = HashingUtils::CompileTimeHashString("NoSuchConfigurationRecorderException");
+static constexpr int INVALID_DELIVERY_CHANNEL_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidDeliveryChannelNameException");
+static constexpr int LAST_DELIVERY_CHANNEL_DELETE_FAILED_HASH = HashingUtils::CompileTimeHashString("LastDeliveryChannelDeleteFailedException");
+static constexpr int ORGANIZATION_ALL_FEATURES_NOT_ENABLED_HASH = HashingUtils::CompileTimeHashString("OrganizationAllFeaturesNotEnabledException");
+static constexpr int MAX_NUMBER_OF_CONFIGURATION_RECORDERS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxNumberOfConfigurationRecordersExceededException");
+static constexpr int MAX_NUMBER_OF_CONFIG_RULES_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxNumberOfConfigRulesExceededException");
+static constexpr int NO_RUNNING_CONFIGURATION_RECORDER_HASH = HashingUtils::CompileTimeHashString("NoRunningConfigurationRecorderException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int RESOURCE_NOT_DISCOVERED_HASH = HashingUtils::CompileTimeHashString("ResourceNotDiscoveredException");
+static constexpr int INSUFFICIENT_PERMISSIONS_HASH = HashingUtils::CompileTimeHashString("InsufficientPermissionsException");
+static constexpr int INSUFFICIENT_DELIVERY_POLICY_HASH = HashingUtils::CompileTimeHashString("InsufficientDeliveryPolicyException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int MAX_NUMBER_OF_RETENTION_CONFIGURATIONS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxNumberOfRetentionConfigurationsExceededException");
+static constexpr int NO_AVAILABLE_DELIVERY_CHANNEL_HASH = HashingUtils::CompileTimeHashString("NoAvailableDeliveryChannelException");
+static constexpr int NO_SUCH_CONFIGURATION_AGGREGATOR_HASH = HashingUtils::CompileTimeHashString("NoSuchConfigurationAggregatorException");
+static constexpr int ORGANIZATION_ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("OrganizationAccessDeniedException");
+static constexpr int NO_SUCH_BUCKET_HASH = HashingUtils::CompileTimeHashString("NoSuchBucketException");
+static constexpr int INVALID_TIME_RANGE_HASH = HashingUtils::CompileTimeHashString("InvalidTimeRangeException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
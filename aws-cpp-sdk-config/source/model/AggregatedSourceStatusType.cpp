@@ -30,25 +30,37 @@ namespace Aws
       namespace AggregatedSourceStatusTypeMapper
       {
 
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int OUTDATED_HASH = HashingUtils::HashString("OUTDATED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int OUTDATED_HASH = HashingUtils::CompileTimeHashString("OUTDATED");
 
 
         AggregatedSourceStatusType GetAggregatedSourceStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAILED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AggregatedSourceStatusType::FAILED;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return AggregatedSourceStatusType::SUCCEEDED;
-          }
-          else if (hashCode == OUTDATED_HASH)
-          {
-            return AggregatedSourceStatusType::OUTDATED;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return AggregatedSourceStatusType::FAILED;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return AggregatedSourceStatusType::SUCCEEDED;
+            }
+            break;
+          case OUTDATED_HASH:
+            if (name == "OUTDATED")
+            {
+              return AggregatedSourceStatusType::OUTDATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AggregatedSourceStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForAggregatedSourceStatusType(AggregatedSourceStatusType enumValue)
+        const char* GetNameForAggregatedSourceStatusType(AggregatedSourceStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
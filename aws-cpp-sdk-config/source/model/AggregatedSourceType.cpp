@@ -30,20 +30,30 @@ namespace Aws
       namespace AggregatedSourceTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
+        static constexpr int ACCOUNT_HASH = HashingUtils::CompileTimeHashString("ACCOUNT");
+        static constexpr int ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION");
 
 
         AggregatedSourceType GetAggregatedSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AggregatedSourceType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
-          {
-            return AggregatedSourceType::ORGANIZATION;
+          case ACCOUNT_HASH:
+            if (name == "ACCOUNT")
+            {
+              return AggregatedSourceType::ACCOUNT;
+            }
+            break;
+          case ORGANIZATION_HASH:
+            if (name == "ORGANIZATION")
+            {
+              return AggregatedSourceType::ORGANIZATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AggregatedSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForAggregatedSourceType(AggregatedSourceType enumValue)
+        const char* GetNameForAggregatedSourceType(AggregatedSourceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ChronologicalOrderMapper
       {
 
-        static const int Reverse_HASH = HashingUtils::HashString("Reverse");
-        static const int Forward_HASH = HashingUtils::HashString("Forward");
+        static constexpr int Reverse_HASH = HashingUtils::CompileTimeHashString("Reverse");
+        static constexpr int Forward_HASH = HashingUtils::CompileTimeHashString("Forward");
 
 
         ChronologicalOrder GetChronologicalOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Reverse_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChronologicalOrder::Reverse;
-          }
-          else if (hashCode == Forward_HASH)
-          {
-            return ChronologicalOrder::Forward;
+          case Reverse_HASH:
+            if (name == "Reverse")
+            {
+              return ChronologicalOrder::Reverse;
+            }
+            break;
+          case Forward_HASH:
+            if (name == "Forward")
+            {
+              return ChronologicalOrder::Forward;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ChronologicalOrder::NOT_SET;
         }
 
-        Aws::String GetNameForChronologicalOrder(ChronologicalOrder enumValue)
+        const char* GetNameForChronologicalOrder(ChronologicalOrder enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ComplianceTypeMapper
       {
 
-        static const int COMPLIANT_HASH = HashingUtils::HashString("COMPLIANT");
-        static const int NON_COMPLIANT_HASH = HashingUtils::HashString("NON_COMPLIANT");
-        static const int NOT_APPLICABLE_HASH = HashingUtils::HashString("NOT_APPLICABLE");
-        static const int INSUFFICIENT_DATA_HASH = HashingUtils::HashString("INSUFFICIENT_DATA");
+        static constexpr int COMPLIANT_HASH = HashingUtils::CompileTimeHashString("COMPLIANT");
+        static constexpr int NON_COMPLIANT_HASH = HashingUtils::CompileTimeHashString("NON_COMPLIANT");
+        static constexpr int NOT_APPLICABLE_HASH = HashingUtils::CompileTimeHashString("NOT_APPLICABLE");
+        static constexpr int INSUFFICIENT_DATA_HASH = HashingUtils::CompileTimeHashString("INSUFFICIENT_DATA");
 
 
         ComplianceType GetComplianceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLIANT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComplianceType::COMPLIANT;
-          }
-          else if (hashCode == NON_COMPLIANT_HASH)
-          {
-            return ComplianceType::NON_COMPLIANT;
-          }
-          else if (hashCode == NOT_APPLICABLE_HASH)
-          {
-            return ComplianceType::NOT_APPLICABLE;
-          }
-          else if (hashCode == INSUFFICIENT_DATA_HASH)
-          {
-            return ComplianceType::INSUFFICIENT_DATA;
+          case COMPLIANT_HASH:
+            if (name == "COMPLIANT")
+            {
+              return ComplianceType::COMPLIANT;
+            }
+            break;
+          case NON_COMPLIANT_HASH:
+            if (name == "NON_COMPLIANT")
+            {
+              return ComplianceType::NON_COMPLIANT;
+            }
+            break;
+          case NOT_APPLICABLE_HASH:
+            if (name == "NOT_APPLICABLE")
+            {
+              return ComplianceType::NOT_APPLICABLE;
+            }
+            break;
+          case INSUFFICIENT_DATA_HASH:
+            if (name == "INSUFFICIENT_DATA")
+            {
+              return ComplianceType::INSUFFICIENT_DATA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ComplianceType::NOT_SET;
         }
 
-        Aws::String GetNameForComplianceType(ComplianceType enumValue)
+        const char* GetNameForComplianceType(ComplianceType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
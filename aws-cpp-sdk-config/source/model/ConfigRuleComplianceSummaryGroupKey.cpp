@@ -30,20 +30,30 @@ namespace Aws
       namespace ConfigRuleComplianceSummaryGroupKeyMapper
       {
 
-        static const int ACCOUNT_ID_HASH = HashingUtils::HashString("ACCOUNT_ID");
-        static const int AWS_REGION_HASH = HashingUtils::HashString("AWS_REGION");
+        static constexpr int ACCOUNT_ID_HASH = HashingUtils::CompileTimeHashString("ACCOUNT_ID");
+        static constexpr int AWS_REGION_HASH = HashingUtils::CompileTimeHashString("AWS_REGION");
 
 
         ConfigRuleComplianceSummaryGroupKey GetConfigRuleComplianceSummaryGroupKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_ID_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConfigRuleComplianceSummaryGroupKey::ACCOUNT_ID;
-          }
-          else if (hashCode == AWS_REGION_HASH)
-          {
-            return ConfigRuleComplianceSummaryGroupKey::AWS_REGION;
+          case ACCOUNT_ID_HASH:
+            if (name == "ACCOUNT_ID")
+            {
+              return ConfigRuleComplianceSummaryGroupKey::ACCOUNT_ID;
+            }
+            break;
+          case AWS_REGION_HASH:
+            if (name == "AWS_REGION")
+            {
+              return ConfigRuleComplianceSummaryGroupKey::AWS_REGION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ConfigRuleComplianceSummaryGroupKey::NOT_SET;
         }
 
-        Aws::String GetNameForConfigRuleComplianceSummaryGroupKey(ConfigRuleComplianceSummaryGroupKey enumValue)
+        const char* GetNameForConfigRuleComplianceSummaryGroupKey(ConfigRuleComplianceSummaryGroupKey enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ConfigRuleStateMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETING_RESULTS_HASH = HashingUtils::HashString("DELETING_RESULTS");
-        static const int EVALUATING_HASH = HashingUtils::HashString("EVALUATING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int DELETING_RESULTS_HASH = HashingUtils::CompileTimeHashString("DELETING_RESULTS");
+        static constexpr int EVALUATING_HASH = HashingUtils::CompileTimeHashString("EVALUATING");
 
 
         ConfigRuleState GetConfigRuleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConfigRuleState::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ConfigRuleState::DELETING;
-          }
-          else if (hashCode == DELETING_RESULTS_HASH)
-          {
-            return ConfigRuleState::DELETING_RESULTS;
-          }
-          else if (hashCode == EVALUATING_HASH)
-          {
-            return ConfigRuleState::EVALUATING;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ConfigRuleState::ACTIVE;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ConfigRuleState::DELETING;
+            }
+            break;
+          case DELETING_RESULTS_HASH:
+            if (name == "DELETING_RESULTS")
+            {
+              return ConfigRuleState::DELETING_RESULTS;
+            }
+            break;
+          case EVALUATING_HASH:
+            if (name == "EVALUATING")
+            {
+              return ConfigRuleState::EVALUATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ConfigRuleState::NOT_SET;
         }
 
-        Aws::String GetNameForConfigRuleState(ConfigRuleState enumValue)
+        const char* GetNameForConfigRuleState(ConfigRuleState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace ConfigurationItemStatusMapper
       {
 
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int ResourceDiscovered_HASH = HashingUtils::HashString("ResourceDiscovered");
-        static const int ResourceNotRecorded_HASH = HashingUtils::HashString("ResourceNotRecorded");
-        static const int ResourceDeleted_HASH = HashingUtils::HashString("ResourceDeleted");
-        static const int ResourceDeletedNotRecorded_HASH = HashingUtils::HashString("ResourceDeletedNotRecorded");
+        static constexpr int OK_HASH = HashingUtils::CompileTimeHashString("OK");
+        static constexpr int ResourceDiscovered_HASH = HashingUtils::CompileTimeHashString("ResourceDiscovered");
+        static constexpr int ResourceNotRecorded_HASH = HashingUtils::CompileTimeHashString("ResourceNotRecorded");
+        static constexpr int ResourceDeleted_HASH = HashingUtils::CompileTimeHashString("ResourceDeleted");
+        static constexpr int ResourceDeletedNotRecorded_HASH = HashingUtils::CompileTimeHashString("ResourceDeletedNotRecorded");
 
 
         ConfigurationItemStatus GetConfigurationItemStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConfigurationItemStatus::OK;
-          }
-          else if (hashCode == ResourceDiscovered_HASH)
-          {
-            return ConfigurationItemStatus::ResourceDiscovered;
-          }
-          else if (hashCode == ResourceNotRecorded_HASH)
-          {
-            return ConfigurationItemStatus::ResourceNotRecorded;
-          }
-          else if (hashCode == ResourceDeleted_HASH)
-          {
-            return ConfigurationItemStatus::ResourceDeleted;
-          }
-          else if (hashCode == ResourceDeletedNotRecorded_HASH)
-          {
-            return ConfigurationItemStatus::ResourceDeletedNotRecorded;
+          case OK_HASH:
+            if (name == "OK")
+            {
+              return ConfigurationItemStatus::OK;
+            }
+            break;
+          case ResourceDiscovered_HASH:
+            if (name == "ResourceDiscovered")
+            {
+              return ConfigurationItemStatus::ResourceDiscovered;
+            }
+            break;
+          case ResourceNotRecorded_HASH:
+            if (name == "ResourceNotRecorded")
+            {
+              return ConfigurationItemStatus::ResourceNotRecorded;
+            }
+            break;
+          case ResourceDeleted_HASH:
+            if (name == "ResourceDeleted")
+            {
+              return ConfigurationItemStatus::ResourceDeleted;
+            }
+            break;
+          case ResourceDeletedNotRecorded_HASH:
+            if (name == "ResourceDeletedNotRecorded")
+            {
+              return ConfigurationItemStatus::ResourceDeletedNotRecorded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ConfigurationItemStatus::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationItemStatus(ConfigurationItemStatus enumValue)
+        const char* GetNameForConfigurationItemStatus(ConfigurationItemStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
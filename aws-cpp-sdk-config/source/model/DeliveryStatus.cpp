@@ -30,25 +30,37 @@ namespace Aws
       namespace DeliveryStatusMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failure_HASH = HashingUtils::HashString("Failure");
-        static const int Not_Applicable_HASH = HashingUtils::HashString("Not_Applicable");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int Failure_HASH = HashingUtils::CompileTimeHashString("Failure");
+        static constexpr int Not_Applicable_HASH = HashingUtils::CompileTimeHashString("Not_Applicable");
 
 
         DeliveryStatus GetDeliveryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeliveryStatus::Success;
-          }
-          else if (hashCode == Failure_HASH)
-          {
-            return DeliveryStatus::Failure;
-          }
-          else if (hashCode == Not_Applicable_HASH)
-          {
-            return DeliveryStatus::Not_Applicable;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return DeliveryStatus::Success;
+            }
+            break;
+          case Failure_HASH:
+            if (name == "Failure")
+            {
+              return DeliveryStatus::Failure;
+            }
+            break;
+          case Not_Applicable_HASH:
+            if (name == "Not_Applicable")
+            {
+              return DeliveryStatus::Not_Applicable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DeliveryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryStatus(DeliveryStatus enumValue)
+        const char* GetNameForDeliveryStatus(DeliveryStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
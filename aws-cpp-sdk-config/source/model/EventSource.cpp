@@ -30,15 +30,23 @@ namespace Aws
       namespace EventSourceMapper
       {
 
-        static const int aws_config_HASH = HashingUtils::HashString("aws.config");
+        static constexpr int aws_config_HASH = HashingUtils::CompileTimeHashString("aws.config");
 
 
         EventSource GetEventSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_config_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventSource::aws_config;
+          case aws_config_HASH:
+            if (name == "aws.config")
+            {
+              return EventSource::aws_config;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return EventSource::NOT_SET;
         }
 
-        Aws::String GetNameForEventSource(EventSource enumValue)
+        const char* GetNameForEventSource(EventSource enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
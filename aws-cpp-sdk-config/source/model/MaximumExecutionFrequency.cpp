@@ -30,35 +30,51 @@ namespace Aws
       namespace MaximumExecutionFrequencyMapper
       {
 
-        static const int One_Hour_HASH = HashingUtils::HashString("One_Hour");
-        static const int Three_Hours_HASH = HashingUtils::HashString("Three_Hours");
-        static const int Six_Hours_HASH = HashingUtils::HashString("Six_Hours");
-        static const int Twelve_Hours_HASH = HashingUtils::HashString("Twelve_Hours");
-        static const int TwentyFour_Hours_HASH = HashingUtils::HashString("TwentyFour_Hours");
+        static constexpr int One_Hour_HASH = HashingUtils::CompileTimeHashString("One_Hour");
+        static constexpr int Three_Hours_HASH = HashingUtils::CompileTimeHashString("Three_Hours");
+        static constexpr int Six_Hours_HASH = HashingUtils::CompileTimeHashString("Six_Hours");
+        static constexpr int Twelve_Hours_HASH = HashingUtils::CompileTimeHashString("Twelve_Hours");
+        static constexpr int TwentyFour_Hours_HASH = HashingUtils::CompileTimeHashString("TwentyFour_Hours");
 
 
         MaximumExecutionFrequency GetMaximumExecutionFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == One_Hour_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MaximumExecutionFrequency::One_Hour;
-          }
-          else if (hashCode == Three_Hours_HASH)
-          {
-            return MaximumExecutionFrequency::Three_Hours;
-          }
-          else if (hashCode == Six_Hours_HASH)
-          {
-            return MaximumExecutionFrequency::Six_Hours;
-          }
-          else if (hashCode == Twelve_Hours_HASH)
-          {
-            return MaximumExecutionFrequency::Twelve_Hours;
-          }
-          else if (hashCode == TwentyFour_Hours_HASH)
-          {
-            return MaximumExecutionFrequency::TwentyFour_Hours;
+          case One_Hour_HASH:
+            if (name == "One_Hour")
+            {
+              return MaximumExecutionFrequency::One_Hour;
+            }
+            break;
+          case Three_Hours_HASH:
+            if (name == "Three_Hours")
+            {
+              return MaximumExecutionFrequency::Three_Hours;
+            }
+            break;
+          case Six_Hours_HASH:
+            if (name == "Six_Hours")
+            {
+              return MaximumExecutionFrequency::Six_Hours;
+            }
+            break;
+          case Twelve_Hours_HASH:
+            if (name == "Twelve_Hours")
+            {
+              return MaximumExecutionFrequency::Twelve_Hours;
+            }
+            break;
+          case TwentyFour_Hours_HASH:
+            if (name == "TwentyFour_Hours")
+            {
+              return MaximumExecutionFrequency::TwentyFour_Hours;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return MaximumExecutionFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForMaximumExecutionFrequency(MaximumExecutionFrequency enumValue)
+        const char* GetNameForMaximumExecutionFrequency(MaximumExecutionFrequency enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
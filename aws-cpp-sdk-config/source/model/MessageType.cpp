@@ -30,30 +30,44 @@ namespace Aws
       namespace MessageTypeMapper
       {
 
-        static const int ConfigurationItemChangeNotification_HASH = HashingUtils::HashString("ConfigurationItemChangeNotification");
-        static const int ConfigurationSnapshotDeliveryCompleted_HASH = HashingUtils::HashString("ConfigurationSnapshotDeliveryCompleted");
-        static const int ScheduledNotification_HASH = HashingUtils::HashString("ScheduledNotification");
-        static const int OversizedConfigurationItemChangeNotification_HASH = HashingUtils::HashString("OversizedConfigurationItemChangeNotification");
+        static constexpr int ConfigurationItemChangeNotification_HASH = HashingUtils::CompileTimeHashString("ConfigurationItemChangeNotification");
+        static constexpr int ConfigurationSnapshotDeliveryCompleted_HASH = HashingUtils::CompileTimeHashString("ConfigurationSnapshotDeliveryCompleted");
+        static constexpr int ScheduledNotification_HASH = HashingUtils::CompileTimeHashString("ScheduledNotification");
+        static constexpr int OversizedConfigurationItemChangeNotification_HASH = HashingUtils::CompileTimeHashString("OversizedConfigurationItemChangeNotification");
 
 
         MessageType GetMessageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ConfigurationItemChangeNotification_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MessageType::ConfigurationItemChangeNotification;
-          }
-          else if (hashCode == ConfigurationSnapshotDeliveryCompleted_HASH)
-          {
-            return MessageType::ConfigurationSnapshotDeliveryCompleted;
-          }
-          else if (hashCode == ScheduledNotification_HASH)
-          {
-            return MessageType::ScheduledNotification;
-          }
-          else if (hashCode == OversizedConfigurationItemChangeNotification_HASH)
-          {
-            return MessageType::OversizedConfigurationItemChangeNotification;
+          case ConfigurationItemChangeNotification_HASH:
+            if (name == "ConfigurationItemChangeNotification")
+            {
+              return MessageType::ConfigurationItemChangeNotification;
+            }
+            break;
+          case ConfigurationSnapshotDeliveryCompleted_HASH:
+            if (name == "ConfigurationSnapshotDeliveryCompleted")
+            {
+              return MessageType::ConfigurationSnapshotDeliveryCompleted;
+            }
+            break;
+          case ScheduledNotification_HASH:
+            if (name == "ScheduledNotification")
+            {
+              return MessageType::ScheduledNotification;
+            }
+            break;
+          case OversizedConfigurationItemChangeNotification_HASH:
+            if (name == "OversizedConfigurationItemChangeNotification")
+            {
+              return MessageType::OversizedConfigurationItemChangeNotification;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return MessageType::NOT_SET;
         }
 
-        Aws::String GetNameForMessageType(MessageType enumValue)
+        const char* GetNameForMessageType(MessageType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
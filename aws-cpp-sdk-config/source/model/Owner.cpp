@@ -30,20 +30,30 @@ namespace Aws
       namespace OwnerMapper
       {
 
-        static const int CUSTOM_LAMBDA_HASH = HashingUtils::HashString("CUSTOM_LAMBDA");
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
+        static constexpr int CUSTOM_LAMBDA_HASH = HashingUtils::CompileTimeHashString("CUSTOM_LAMBDA");
+        static constexpr int AWS_HASH = HashingUtils::CompileTimeHashString("AWS");
 
 
         Owner GetOwnerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CUSTOM_LAMBDA_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Owner::CUSTOM_LAMBDA;
-          }
-          else if (hashCode == AWS_HASH)
-          {
-            return Owner::AWS;
+          case CUSTOM_LAMBDA_HASH:
+            if (name == "CUSTOM_LAMBDA")
+            {
+              return Owner::CUSTOM_LAMBDA;
+            }
+            break;
+          case AWS_HASH:
+            if (name == "AWS")
+            {
+              return Owner::AWS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Owner::NOT_SET;
         }
 
-        Aws::String GetNameForOwner(Owner enumValue)
+        const char* GetNameForOwner(Owner enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
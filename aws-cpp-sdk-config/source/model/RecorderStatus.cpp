@@ -30,25 +30,37 @@ namespace Aws
       namespace RecorderStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failure_HASH = HashingUtils::HashString("Failure");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int Failure_HASH = HashingUtils::CompileTimeHashString("Failure");
 
 
         RecorderStatus GetRecorderStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RecorderStatus::Pending;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return RecorderStatus::Success;
-          }
-          else if (hashCode == Failure_HASH)
-          {
-            return RecorderStatus::Failure;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return RecorderStatus::Pending;
+            }
+            break;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return RecorderStatus::Success;
+            }
+            break;
+          case Failure_HASH:
+            if (name == "Failure")
+            {
+              return RecorderStatus::Failure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RecorderStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRecorderStatus(RecorderStatus enumValue)
+        const char* GetNameForRecorderStatus(RecorderStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
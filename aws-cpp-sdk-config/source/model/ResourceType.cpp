@@ -30,300 +30,422 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int AWS_EC2_CustomerGateway_HASH = HashingUtils::HashString("AWS::EC2::CustomerGateway");
-        static const int AWS_EC2_EIP_HASH = HashingUtils::HashString("AWS::EC2::EIP");
-        static const int AWS_EC2_Host_HASH = HashingUtils::HashString("AWS::EC2::Host");
-        static const int AWS_EC2_Instance_HASH = HashingUtils::HashString("AWS::EC2::Instance");
-        static const int AWS_EC2_InternetGateway_HASH = HashingUtils::HashString("AWS::EC2::InternetGateway");
-        static const int AWS_EC2_NetworkAcl_HASH = HashingUtils::HashString("AWS::EC2::NetworkAcl");
-        static const int AWS_EC2_NetworkInterface_HASH = HashingUtils::HashString("AWS::EC2::NetworkInterface");
-        static const int AWS_EC2_RouteTable_HASH = HashingUtils::HashString("AWS::EC2::RouteTable");
-        static const int AWS_EC2_SecurityGroup_HASH = HashingUtils::HashString("AWS::EC2::SecurityGroup");
-        static const int AWS_EC2_Subnet_HASH = HashingUtils::HashString("AWS::EC2::Subnet");
-        static const int AWS_CloudTrail_Trail_HASH = HashingUtils::HashString("AWS::CloudTrail::Trail");
-        static const int AWS_EC2_Volume_HASH = HashingUtils::HashString("AWS::EC2::Volume");
-        static const int AWS_EC2_VPC_HASH = HashingUtils::HashString("AWS::EC2::VPC");
-        static const int AWS_EC2_VPNConnection_HASH = HashingUtils::HashString("AWS::EC2::VPNConnection");
-        static const int AWS_EC2_VPNGateway_HASH = HashingUtils::HashString("AWS::EC2::VPNGateway");
-        static const int AWS_IAM_Group_HASH = HashingUtils::HashString("AWS::IAM::Group");
-        static const int AWS_IAM_Policy_HASH = HashingUtils::HashString("AWS::IAM::Policy");
-        static const int AWS_IAM_Role_HASH = HashingUtils::HashString("AWS::IAM::Role");
-        static const int AWS_IAM_User_HASH = HashingUtils::HashString("AWS::IAM::User");
-        static const int AWS_ACM_Certificate_HASH = HashingUtils::HashString("AWS::ACM::Certificate");
-        static const int AWS_RDS_DBInstance_HASH = HashingUtils::HashString("AWS::RDS::DBInstance");
-        static const int AWS_RDS_DBSubnetGroup_HASH = HashingUtils::HashString("AWS::RDS::DBSubnetGroup");
-        static const int AWS_RDS_DBSecurityGroup_HASH = HashingUtils::HashString("AWS::RDS::DBSecurityGroup");
-        static const int AWS_RDS_DBSnapshot_HASH = HashingUtils::HashString("AWS::RDS::DBSnapshot");
-        static const int AWS_RDS_EventSubscription_HASH = HashingUtils::HashString("AWS::RDS::EventSubscription");
-        static const int AWS_ElasticLoadBalancingV2_LoadBalancer_HASH = HashingUtils::HashString("AWS::ElasticLoadBalancingV2::LoadBalancer");
-        static const int AWS_S3_Bucket_HASH = HashingUtils::HashString("AWS::S3::Bucket");
-        static const int AWS_SSM_ManagedInstanceInventory_HASH = HashingUtils::HashString("AWS::SSM::ManagedInstanceInventory");
-        static const int AWS_Redshift_Cluster_HASH = HashingUtils::HashString("AWS::Redshift::Cluster");
-        static const int AWS_Redshift_ClusterSnapshot_HASH = HashingUtils::HashString("AWS::Redshift::ClusterSnapshot");
-        static const int AWS_Redshift_ClusterParameterGroup_HASH = HashingUtils::HashString("AWS::Redshift::ClusterParameterGroup");
-        static const int AWS_Redshift_ClusterSecurityGroup_HASH = HashingUtils::HashString("AWS::Redshift::ClusterSecurityGroup");
-        static const int AWS_Redshift_ClusterSubnetGroup_HASH = HashingUtils::HashString("AWS::Redshift::ClusterSubnetGroup");
-        static const int AWS_Redshift_EventSubscription_HASH = HashingUtils::HashString("AWS::Redshift::EventSubscription");
-        static const int AWS_CloudWatch_Alarm_HASH = HashingUtils::HashString("AWS::CloudWatch::Alarm");
-        static const int AWS_CloudFormation_Stack_HASH = HashingUtils::HashString("AWS::CloudFormation::Stack");
-        static const int AWS_DynamoDB_Table_HASH = HashingUtils::HashString("AWS::DynamoDB::Table");
-        static const int AWS_AutoScaling_AutoScalingGroup_HASH = HashingUtils::HashString("AWS::AutoScaling::AutoScalingGroup");
-        static const int AWS_AutoScaling_LaunchConfiguration_HASH = HashingUtils::HashString("AWS::AutoScaling::LaunchConfiguration");
-        static const int AWS_AutoScaling_ScalingPolicy_HASH = HashingUtils::HashString("AWS::AutoScaling::ScalingPolicy");
-        static const int AWS_AutoScaling_ScheduledAction_HASH = HashingUtils::HashString("AWS::AutoScaling::ScheduledAction");
-        static const int AWS_CodeBuild_Project_HASH = HashingUtils::HashString("AWS::CodeBuild::Project");
-        static const int AWS_WAF_RateBasedRule_HASH = HashingUtils::HashString("AWS::WAF::RateBasedRule");
-        static const int AWS_WAF_Rule_HASH = HashingUtils::HashString("AWS::WAF::Rule");
-        static const int AWS_WAF_WebACL_HASH = HashingUtils::HashString("AWS::WAF::WebACL");
-        static const int AWS_WAFRegional_RateBasedRule_HASH = HashingUtils::HashString("AWS::WAFRegional::RateBasedRule");
-        static const int AWS_WAFRegional_Rule_HASH = HashingUtils::HashString("AWS::WAFRegional::Rule");
-        static const int AWS_WAFRegional_WebACL_HASH = HashingUtils::HashString("AWS::WAFRegional::WebACL");
-        static const int AWS_CloudFront_Distribution_HASH = HashingUtils::HashString("AWS::CloudFront::Distribution");
-        static const int AWS_CloudFront_StreamingDistribution_HASH = HashingUtils::HashString("AWS::CloudFront::StreamingDistribution");
-        static const int AWS_WAF_RuleGroup_HASH = HashingUtils::HashString("AWS::WAF::RuleGroup");
-        static const int AWS_WAFRegional_RuleGroup_HASH = HashingUtils::HashString("AWS::WAFRegional::RuleGroup");
-        static const int AWS_Lambda_Function_HASH = HashingUtils::HashString("AWS::Lambda::Function");
-        static const int AWS_ElasticBeanstalk_Application_HASH = HashingUtils::HashString("AWS::ElasticBeanstalk::Application");
-        static const int AWS_ElasticBeanstalk_ApplicationVersion_HASH = HashingUtils::HashString("AWS::ElasticBeanstalk::ApplicationVersion");
-        static const int AWS_ElasticBeanstalk_Environment_HASH = HashingUtils::HashString("AWS::ElasticBeanstalk::Environment");
-        static const int AWS_ElasticLoadBalancing_LoadBalancer_HASH = HashingUtils::HashString("AWS::ElasticLoadBalancing::LoadBalancer");
-        static const int AWS_XRay_EncryptionConfig_HASH = HashingUtils::HashString("AWS::XRay::EncryptionConfig");
+        static constexpr int AWS_EC2_CustomerGateway_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::CustomerGateway");
+        static constexpr int AWS_EC2_EIP_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::EIP");
+        static constexpr int AWS_EC2_Host_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::Host");
+        static constexpr int AWS_EC2_Instance_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::Instance");
+        static constexpr int AWS_EC2_InternetGateway_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::InternetGateway");
+        static constexpr int AWS_EC2_NetworkAcl_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::NetworkAcl");
+        static constexpr int AWS_EC2_NetworkInterface_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::NetworkInterface");
+        static constexpr int AWS_EC2_RouteTable_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::RouteTable");
+        static constexpr int AWS_EC2_SecurityGroup_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::SecurityGroup");
+        static constexpr int AWS_EC2_Subnet_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::Subnet");
+        static constexpr int AWS_CloudTrail_Trail_HASH = HashingUtils::CompileTimeHashString("AWS::CloudTrail::Trail");
+        static constexpr int AWS_EC2_Volume_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::Volume");
+        static constexpr int AWS_EC2_VPC_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::VPC");
+        static constexpr int AWS_EC2_VPNConnection_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::VPNConnection");
+        static constexpr int AWS_EC2_VPNGateway_HASH = HashingUtils::CompileTimeHashString("AWS::EC2::VPNGateway");
+        static constexpr int AWS_IAM_Group_HASH = HashingUtils::CompileTimeHashString("AWS::IAM::Group");
+        static constexpr int AWS_IAM_Policy_HASH = HashingUtils::CompileTimeHashString("AWS::IAM::Policy");
+        static constexpr int AWS_IAM_Role_HASH = HashingUtils::CompileTimeHashString("AWS::IAM::Role");
+        static constexpr int AWS_IAM_User_HASH = HashingUtils::CompileTimeHashString("AWS::IAM::User");
+        static constexpr int AWS_ACM_Certificate_HASH = HashingUtils::CompileTimeHashString("AWS::ACM::Certificate");
+        static constexpr int AWS_RDS_DBInstance_HASH = HashingUtils::CompileTimeHashString("AWS::RDS::DBInstance");
+        static constexpr int AWS_RDS_DBSubnetGroup_HASH = HashingUtils::CompileTimeHashString("AWS::RDS::DBSubnetGroup");
+        static constexpr int AWS_RDS_DBSecurityGroup_HASH = HashingUtils::CompileTimeHashString("AWS::RDS::DBSecurityGroup");
+        static constexpr int AWS_RDS_DBSnapshot_HASH = HashingUtils::CompileTimeHashString("AWS::RDS::DBSnapshot");
+        static constexpr int AWS_RDS_EventSubscription_HASH = HashingUtils::CompileTimeHashString("AWS::RDS::EventSubscription");
+        static constexpr int AWS_ElasticLoadBalancingV2_LoadBalancer_HASH = HashingUtils::CompileTimeHashString("AWS::ElasticLoadBalancingV2::LoadBalancer");
+        static constexpr int AWS_S3_Bucket_HASH = HashingUtils::CompileTimeHashString("AWS::S3::Bucket");
+        static constexpr int AWS_SSM_ManagedInstanceInventory_HASH = HashingUtils::CompileTimeHashString("AWS::SSM::ManagedInstanceInventory");
+        static constexpr int AWS_Redshift_Cluster_HASH = HashingUtils::CompileTimeHashString("AWS::Redshift::Cluster");
+        static constexpr int AWS_Redshift_ClusterSnapshot_HASH = HashingUtils::CompileTimeHashString("AWS::Redshift::ClusterSnapshot");
+        static constexpr int AWS_Redshift_ClusterParameterGroup_HASH = HashingUtils::CompileTimeHashString("AWS::Redshift::ClusterParameterGroup");
+        static constexpr int AWS_Redshift_ClusterSecurityGroup_HASH = HashingUtils::CompileTimeHashString("AWS::Redshift::ClusterSecurityGroup");
+        static constexpr int AWS_Redshift_ClusterSubnetGroup_HASH = HashingUtils::CompileTimeHashString("AWS::Redshift::ClusterSubnetGroup");
+        static constexpr int AWS_Redshift_EventSubscription_HASH = HashingUtils::CompileTimeHashString("AWS::Redshift::EventSubscription");
+        static constexpr int AWS_CloudWatch_Alarm_HASH = HashingUtils::CompileTimeHashString("AWS::CloudWatch::Alarm");
+        static constexpr int AWS_CloudFormation_Stack_HASH = HashingUtils::CompileTimeHashString("AWS::CloudFormation::Stack");
+        static constexpr int AWS_DynamoDB_Table_HASH = HashingUtils::CompileTimeHashString("AWS::DynamoDB::Table");
+        static constexpr int AWS_AutoScaling_AutoScalingGroup_HASH = HashingUtils::CompileTimeHashString("AWS::AutoScaling::AutoScalingGroup");
+        static constexpr int AWS_AutoScaling_LaunchConfiguration_HASH = HashingUtils::CompileTimeHashString("AWS::AutoScaling::LaunchConfiguration");
+        static constexpr int AWS_AutoScaling_ScalingPolicy_HASH = HashingUtils::CompileTimeHashString("AWS::AutoScaling::ScalingPolicy");
+        static constexpr int AWS_AutoScaling_ScheduledAction_HASH = HashingUtils::CompileTimeHashString("AWS::AutoScaling::ScheduledAction");
+        static constexpr int AWS_CodeBuild_Project_HASH = HashingUtils::CompileTimeHashString("AWS::CodeBuild::Project");
+        static constexpr int AWS_WAF_RateBasedRule_HASH = HashingUtils::CompileTimeHashString("AWS::WAF::RateBasedRule");
+        static constexpr int AWS_WAF_Rule_HASH = HashingUtils::CompileTimeHashString("AWS::WAF::Rule");
+        static constexpr int AWS_WAF_WebACL_HASH = HashingUtils::CompileTimeHashString("AWS::WAF::WebACL");
+        static constexpr int AWS_WAFRegional_RateBasedRule_HASH = HashingUtils::CompileTimeHashString("AWS::WAFRegional::RateBasedRule");
+        static constexpr int AWS_WAFRegional_Rule_HASH = HashingUtils::CompileTimeHashString("AWS::WAFRegional::Rule");
+        static constexpr int AWS_WAFRegional_WebACL_HASH = HashingUtils::CompileTimeHashString("AWS::WAFRegional::WebACL");
+        static constexpr int AWS_CloudFront_Distribution_HASH = HashingUtils::CompileTimeHashString("AWS::CloudFront::Distribution");
+        static constexpr int AWS_CloudFront_StreamingDistribution_HASH = HashingUtils::CompileTimeHashString("AWS::CloudFront::StreamingDistribution");
+        static constexpr int AWS_WAF_RuleGroup_HASH = HashingUtils::CompileTimeHashString("AWS::WAF::RuleGroup");
+        static constexpr int AWS_WAFRegional_RuleGroup_HASH = HashingUtils::CompileTimeHashString("AWS::WAFRegional::RuleGroup");
+        static constexpr int AWS_Lambda_Function_HASH = HashingUtils::CompileTimeHashString("AWS::Lambda::Function");
+        static constexpr int AWS_ElasticBeanstalk_Application_HASH = HashingUtils::CompileTimeHashString("AWS::ElasticBeanstalk::Application");
+        static constexpr int AWS_ElasticBeanstalk_ApplicationVersion_HASH = HashingUtils::CompileTimeHashString("AWS::ElasticBeanstalk::ApplicationVersion");
+        static constexpr int AWS_ElasticBeanstalk_Environment_HASH = HashingUtils::CompileTimeHashString("AWS::ElasticBeanstalk::Environment");
+        static constexpr int AWS_ElasticLoadBalancing_LoadBalancer_HASH = HashingUtils::CompileTimeHashString("AWS::ElasticLoadBalancing::LoadBalancer");
+        static constexpr int AWS_XRay_EncryptionConfig_HASH = HashingUtils::CompileTimeHashString("AWS::XRay::EncryptionConfig");
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_EC2_CustomerGateway_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceType::AWS_EC2_CustomerGateway;
-          }
-          else if (hashCode == AWS_EC2_EIP_HASH)
-          {
-            return ResourceType::AWS_EC2_EIP;
-          }
-          else if (hashCode == AWS_EC2_Host_HASH)
-          {
-            return ResourceType::AWS_EC2_Host;
-          }
-          else if (hashCode == AWS_EC2_Instance_HASH)
-          {
-            return ResourceType::AWS_EC2_Instance;
-          }
-          else if (hashCode == AWS_EC2_InternetGateway_HASH)
-          {
-            return ResourceType::AWS_EC2_InternetGateway;
-          }
-          else if (hashCode == AWS_EC2_NetworkAcl_HASH)
-          {
-            return ResourceType::AWS_EC2_NetworkAcl;
-          }
-          else if (hashCode == AWS_EC2_NetworkInterface_HASH)
-          {
-            return ResourceType::AWS_EC2_NetworkInterface;
-          }
-          else if (hashCode == AWS_EC2_RouteTable_HASH)
-          {
-            return ResourceType::AWS_EC2_RouteTable;
-          }
-          else if (hashCode == AWS_EC2_SecurityGroup_HASH)
-          {
-            return ResourceType::AWS_EC2_SecurityGroup;
-          }
-          else if (hashCode == AWS_EC2_Subnet_HASH)
-          {
-            return ResourceType::AWS_EC2_Subnet;
-          }
-          else if (hashCode == AWS_CloudTrail_Trail_HASH)
-          {
-            return ResourceType::AWS_CloudTrail_Trail;
-          }
-          else if (hashCode == AWS_EC2_Volume_HASH)
-          {
-            return ResourceType::AWS_EC2_Volume;
-          }
-          else if (hashCode == AWS_EC2_VPC_HASH)
-          {
-            return ResourceType::AWS_EC2_VPC;
-          }
-          else if (hashCode == AWS_EC2_VPNConnection_HASH)
-          {
-            return ResourceType::AWS_EC2_VPNConnection;
-          }
-          else if (hashCode == AWS_EC2_VPNGateway_HASH)
-          {
-            return ResourceType::AWS_EC2_VPNGateway;
-          }
-          else if (hashCode == AWS_IAM_Group_HASH)
-          {
-            return ResourceType::AWS_IAM_Group;
-          }
-          else if (hashCode == AWS_IAM_Policy_HASH)
-          {
-            return ResourceType::AWS_IAM_Policy;
-          }
-          else if (hashCode == AWS_IAM_Role_HASH)
-          {
-            return ResourceType::AWS_IAM_Role;
-          }
-          else if (hashCode == AWS_IAM_User_HASH)
-          {
-            return ResourceType::AWS_IAM_User;
-          }
-          else if (hashCode == AWS_ACM_Certificate_HASH)
-          {
-            return ResourceType::AWS_ACM_Certificate;
-          }
-          else if (hashCode == AWS_RDS_DBInstance_HASH)
-          {
-            return ResourceType::AWS_RDS_DBInstance;
-          }
-          else if (hashCode == AWS_RDS_DBSubnetGroup_HASH)
-          {
-            return ResourceType::AWS_RDS_DBSubnetGroup;
-          }
-          else if (hashCode == AWS_RDS_DBSecurityGroup_HASH)
-          {
-            return ResourceType::AWS_RDS_DBSecurityGroup;
-          }
-          else if (hashCode == AWS_RDS_DBSnapshot_HASH)
-          {
-            return ResourceType::AWS_RDS_DBSnapshot;
-          }
-          else if (hashCode == AWS_RDS_EventSubscription_HASH)
-          {
-            return ResourceType::AWS_RDS_EventSubscription;
-          }
-          else if (hashCode == AWS_ElasticLoadBalancingV2_LoadBalancer_HASH)
-          {
-            return ResourceType::AWS_ElasticLoadBalancingV2_LoadBalancer;
-          }
-          else if (hashCode == AWS_S3_Bucket_HASH)
-          {
-            return ResourceType::AWS_S3_Bucket;
-          }
-          else if (hashCode == AWS_SSM_ManagedInstanceInventory_HASH)
-          {
-            return ResourceType::AWS_SSM_ManagedInstanceInventory;
-          }
-          else if (hashCode == AWS_Redshift_Cluster_HASH)
-          {
-            return ResourceType::AWS_Redshift_Cluster;
-          }
-          else if (hashCode == AWS_Redshift_ClusterSnapshot_HASH)
-          {
-            return ResourceType::AWS_Redshift_ClusterSnapshot;
-          }
-          else if (hashCode == AWS_Redshift_ClusterParameterGroup_HASH)
-          {
-            return ResourceType::AWS_Redshift_ClusterParameterGroup;
-          }
-          else if (hashCode == AWS_Redshift_ClusterSecurityGroup_HASH)
-          {
-            return ResourceType::AWS_Redshift_ClusterSecurityGroup;
-          }
-          else if (hashCode == AWS_Redshift_ClusterSubnetGroup_HASH)
-          {
-            return ResourceType::AWS_Redshift_ClusterSubnetGroup;
-          }
-          else if (hashCode == AWS_Redshift_EventSubscription_HASH)
-          {
-            return ResourceType::AWS_Redshift_EventSubscription;
-          }
-          else if (hashCode == AWS_CloudWatch_Alarm_HASH)
-          {
-            return ResourceType::AWS_CloudWatch_Alarm;
-          }
-          else if (hashCode == AWS_CloudFormation_Stack_HASH)
-          {
-            return ResourceType::AWS_CloudFormation_Stack;
-          }
-          else if (hashCode == AWS_DynamoDB_Table_HASH)
-          {
-            return ResourceType::AWS_DynamoDB_Table;
-          }
-          else if (hashCode == AWS_AutoScaling_AutoScalingGroup_HASH)
-          {
-            return ResourceType::AWS_AutoScaling_AutoScalingGroup;
-          }
-          else if (hashCode == AWS_AutoScaling_LaunchConfiguration_HASH)
-          {
-            return ResourceType::AWS_AutoScaling_LaunchConfiguration;
-          }
-          else if (hashCode == AWS_AutoScaling_ScalingPolicy_HASH)
-          {
-            return ResourceType::AWS_AutoScaling_ScalingPolicy;
-          }
-          else if (hashCode == AWS_AutoScaling_ScheduledAction_HASH)
-          {
-            return ResourceType::AWS_AutoScaling_ScheduledAction;
-          }
-          else if (hashCode == AWS_CodeBuild_Project_HASH)
-          {
-            return ResourceType::AWS_CodeBuild_Project;
-          }
-          else if (hashCode == AWS_WAF_RateBasedRule_HASH)
-          {
-            return ResourceType::AWS_WAF_RateBasedRule;
-          }
-          else if (hashCode == AWS_WAF_Rule_HASH)
-          {
-            return ResourceType::AWS_WAF_Rule;
-          }
-          else if (hashCode == AWS_WAF_WebACL_HASH)
-          {
-            return ResourceType::AWS_WAF_WebACL;
-          }
-          else if (hashCode == AWS_WAFRegional_RateBasedRule_HASH)
-          {
-            return ResourceType::AWS_WAFRegional_RateBasedRule;
-          }
-          else if (hashCode == AWS_WAFRegional_Rule_HASH)
-          {
-            return ResourceType::AWS_WAFRegional_Rule;
-          }
-          else if (hashCode == AWS_WAFRegional_WebACL_HASH)
-          {
-            return ResourceType::AWS_WAFRegional_WebACL;
-          }
-          else if (hashCode == AWS_CloudFront_Distribution_HASH)
-          {
-            return ResourceType::AWS_CloudFront_Distribution;
-          }
-          else if (hashCode == AWS_CloudFront_StreamingDistribution_HASH)
-          {
-            return ResourceType::AWS_CloudFront_StreamingDistribution;
-          }
-          else if (hashCode == AWS_WAF_RuleGroup_HASH)
-          {
-            return ResourceType::AWS_WAF_RuleGroup;
-          }
-          else if (hashCode == AWS_WAFRegional_RuleGroup_HASH)
-          {
-            return ResourceType::AWS_WAFRegional_RuleGroup;
-          }
-          else if (hashCode == AWS_Lambda_Function_HASH)
-          {
-            return ResourceType::AWS_Lambda_Function;
-          }
-          else if (hashCode == AWS_ElasticBeanstalk_Application_HASH)
-          {
-            return ResourceType::AWS_ElasticBeanstalk_Application;
-          }
-          else if (hashCode == AWS_ElasticBeanstalk_ApplicationVersion_HASH)
-          {
-            return ResourceType::AWS_ElasticBeanstalk_ApplicationVersion;
-          }
-          else if (hashCode == AWS_ElasticBeanstalk_Environment_HASH)
-          {
-            return ResourceType::AWS_ElasticBeanstalk_Environment;
-          }
-          else if (hashCode == AWS_ElasticLoadBalancing_LoadBalancer_HASH)
-          {
-            return ResourceType::AWS_ElasticLoadBalancing_LoadBalancer;
-          }
-          else if (hashCode == AWS_XRay_EncryptionConfig_HASH)
-          {
-            return ResourceType::AWS_XRay_EncryptionConfig;
+          case AWS_EC2_CustomerGateway_HASH:
+            if (name == "AWS::EC2::CustomerGateway")
+            {
+              return ResourceType::AWS_EC2_CustomerGateway;
+            }
+            break;
+          case AWS_EC2_EIP_HASH:
+            if (name == "AWS::EC2::EIP")
+            {
+              return ResourceType::AWS_EC2_EIP;
+            }
+            break;
+          case AWS_EC2_Host_HASH:
+            if (name == "AWS::EC2::Host")
+            {
+              return ResourceType::AWS_EC2_Host;
+            }
+            break;
+          case AWS_EC2_Instance_HASH:
+            if (name == "AWS::EC2::Instance")
+            {
+              return ResourceType::AWS_EC2_Instance;
+            }
+            break;
+          case AWS_EC2_InternetGateway_HASH:
+            if (name == "AWS::EC2::InternetGateway")
+            {
+              return ResourceType::AWS_EC2_InternetGateway;
+            }
+            break;
+          case AWS_EC2_NetworkAcl_HASH:
+            if (name == "AWS::EC2::NetworkAcl")
+            {
+              return ResourceType::AWS_EC2_NetworkAcl;
+            }
+            break;
+          case AWS_EC2_NetworkInterface_HASH:
+            if (name == "AWS::EC2::NetworkInterface")
+            {
+              return ResourceType::AWS_EC2_NetworkInterface;
+            }
+            break;
+          case AWS_EC2_RouteTable_HASH:
+            if (name == "AWS::EC2::RouteTable")
+            {
+              return ResourceType::AWS_EC2_RouteTable;
+            }
+            break;
+          case AWS_EC2_SecurityGroup_HASH:
+            if (name == "AWS::EC2::SecurityGroup")
+            {
+              return ResourceType::AWS_EC2_SecurityGroup;
+            }
+            break;
+          case AWS_EC2_Subnet_HASH:
+            if (name == "AWS::EC2::Subnet")
+            {
+              return ResourceType::AWS_EC2_Subnet;
+            }
+            break;
+          case AWS_CloudTrail_Trail_HASH:
+            if (name == "AWS::CloudTrail::Trail")
+            {
+              return ResourceType::AWS_CloudTrail_Trail;
+            }
+            break;
+          case AWS_EC2_Volume_HASH:
+            if (name == "AWS::EC2::Volume")
+            {
+              return ResourceType::AWS_EC2_Volume;
+            }
+            break;
+          case AWS_EC2_VPC_HASH:
+            if (name == "AWS::EC2::VPC")
+            {
+              return ResourceType::AWS_EC2_VPC;
+            }
+            break;
+          case AWS_EC2_VPNConnection_HASH:
+            if (name == "AWS::EC2::VPNConnection")
+            {
+              return ResourceType::AWS_EC2_VPNConnection;
+            }
+            break;
+          case AWS_EC2_VPNGateway_HASH:
+            if (name == "AWS::EC2::VPNGateway")
+            {
+              return ResourceType::AWS_EC2_VPNGateway;
+            }
+            break;
+          case AWS_IAM_Group_HASH:
+            if (name == "AWS::IAM::Group")
+            {
+              return ResourceType::AWS_IAM_Group;
+            }
+            break;
+          case AWS_IAM_Policy_HASH:
+            if (name == "AWS::IAM::Policy")
+            {
+              return ResourceType::AWS_IAM_Policy;
+            }
+            break;
+          case AWS_IAM_Role_HASH:
+            if (name == "AWS::IAM::Role")
+            {
+              return ResourceType::AWS_IAM_Role;
+            }
+            break;
+          case AWS_IAM_User_HASH:
+            if (name == "AWS::IAM::User")
+            {
+              return ResourceType::AWS_IAM_User;
+            }
+            break;
+          case AWS_ACM_Certificate_HASH:
+            if (name == "AWS::ACM::Certificate")
+            {
+              return ResourceType::AWS_ACM_Certificate;
+            }
+            break;
+          case AWS_RDS_DBInstance_HASH:
+            if (name == "AWS::RDS::DBInstance")
+            {
+              return ResourceType::AWS_RDS_DBInstance;
+            }
+            break;
+          case AWS_RDS_DBSubnetGroup_HASH:
+            if (name == "AWS::RDS::DBSubnetGroup")
+            {
+              return ResourceType::AWS_RDS_DBSubnetGroup;
+            }
+            break;
+          case AWS_RDS_DBSecurityGroup_HASH:
+            if (name == "AWS::RDS::DBSecurityGroup")
+            {
+              return ResourceType::AWS_RDS_DBSecurityGroup;
+            }
+            break;
+          case AWS_RDS_DBSnapshot_HASH:
+            if (name == "AWS::RDS::DBSnapshot")
+            {
+              return ResourceType::AWS_RDS_DBSnapshot;
+            }
+            break;
+          case AWS_RDS_EventSubscription_HASH:
+            if (name == "AWS::RDS::EventSubscription")
+            {
+              return ResourceType::AWS_RDS_EventSubscription;
+            }
+            break;
+          case AWS_ElasticLoadBalancingV2_LoadBalancer_HASH:
+            if (name == "AWS::ElasticLoadBalancingV2::LoadBalancer")
+            {
+              return ResourceType::AWS_ElasticLoadBalancingV2_LoadBalancer;
+            }
+            break;
+          case AWS_S3_Bucket_HASH:
+            if (name == "AWS::S3::Bucket")
+            {
+              return ResourceType::AWS_S3_Bucket;
+            }
+            break;
+          case AWS_SSM_ManagedInstanceInventory_HASH:
+            if (name == "AWS::SSM::ManagedInstanceInventory")
+            {
+              return ResourceType::AWS_SSM_ManagedInstanceInventory;
+            }
+            break;
+          case AWS_Redshift_Cluster_HASH:
+            if (name == "AWS::Redshift::Cluster")
+            {
+              return ResourceType::AWS_Redshift_Cluster;
+            }
+            break;
+          case AWS_Redshift_ClusterSnapshot_HASH:
+            if (name == "AWS::Redshift::ClusterSnapshot")
+            {
+              return ResourceType::AWS_Redshift_ClusterSnapshot;
+            }
+            break;
+          case AWS_Redshift_ClusterParameterGroup_HASH:
+            if (name == "AWS::Redshift::ClusterParameterGroup")
+            {
+              return ResourceType::AWS_Redshift_ClusterParameterGroup;
+            }
+            break;
+          case AWS_Redshift_ClusterSecurityGroup_HASH:
+            if (name == "AWS::Redshift::ClusterSecurityGroup")
+            {
+              return ResourceType::AWS_Redshift_ClusterSecurityGroup;
+            }
+            break;
+          case AWS_Redshift_ClusterSubnetGroup_HASH:
+            if (name == "AWS::Redshift::ClusterSubnetGroup")
+            {
+              return ResourceType::AWS_Redshift_ClusterSubnetGroup;
+            }
+            break;
+          case AWS_Redshift_EventSubscription_HASH:
+            if (name == "AWS::Redshift::EventSubscription")
+            {
+              return ResourceType::AWS_Redshift_EventSubscription;
+            }
+            break;
+          case AWS_CloudWatch_Alarm_HASH:
+            if (name == "AWS::CloudWatch::Alarm")
+            {
+              return ResourceType::AWS_CloudWatch_Alarm;
+            }
+            break;
+          case AWS_CloudFormation_Stack_HASH:
+            if (name == "AWS::CloudFormation::Stack")
+            {
+              return ResourceType::AWS_CloudFormation_Stack;
+            }
+            break;
+          case AWS_DynamoDB_Table_HASH:
+            if (name == "AWS::DynamoDB::Table")
+            {
+              return ResourceType::AWS_DynamoDB_Table;
+            }
+            break;
+          case AWS_AutoScaling_AutoScalingGroup_HASH:
+            if (name == "AWS::AutoScaling::AutoScalingGroup")
+            {
+              return ResourceType::AWS_AutoScaling_AutoScalingGroup;
+            }
+            break;
+          case AWS_AutoScaling_LaunchConfiguration_HASH:
+            if (name == "AWS::AutoScaling::LaunchConfiguration")
+            {
+              return ResourceType::AWS_AutoScaling_LaunchConfiguration;
+            }
+            break;
+          case AWS_AutoScaling_ScalingPolicy_HASH:
+            if (name == "AWS::AutoScaling::ScalingPolicy")
+            {
+              return ResourceType::AWS_AutoScaling_ScalingPolicy;
+            }
+            break;
+          case AWS_AutoScaling_ScheduledAction_HASH:
+            if (name == "AWS::AutoScaling::ScheduledAction")
+            {
+              return ResourceType::AWS_AutoScaling_ScheduledAction;
+            }
+            break;
+          case AWS_CodeBuild_Project_HASH:
+            if (name == "AWS::CodeBuild::Project")
+            {
+              return ResourceType::AWS_CodeBuild_Project;
+            }
+            break;
+          case AWS_WAF_RateBasedRule_HASH:
+            if (name == "AWS::WAF::RateBasedRule")
+            {
+              return ResourceType::AWS_WAF_RateBasedRule;
+            }
+            break;
+          case AWS_WAF_Rule_HASH:
+            if (name == "AWS::WAF::Rule")
+            {
+              return ResourceType::AWS_WAF_Rule;
+            }
+            break;
+          case AWS_WAF_WebACL_HASH:
+            if (name == "AWS::WAF::WebACL")
+            {
+              return ResourceType::AWS_WAF_WebACL;
+            }
+            break;
+          case AWS_WAFRegional_RateBasedRule_HASH:
+            if (name == "AWS::WAFRegional::RateBasedRule")
+            {
+              return ResourceType::AWS_WAFRegional_RateBasedRule;
+            }
+            break;
+          case AWS_WAFRegional_Rule_HASH:
+            if (name == "AWS::WAFRegional::Rule")
+            {
+              return ResourceType::AWS_WAFRegional_Rule;
+            }
+            break;
+          case AWS_WAFRegional_WebACL_HASH:
+            if (name == "AWS::WAFRegional::WebACL")
+            {
+              return ResourceType::AWS_WAFRegional_WebACL;
+            }
+            break;
+          case AWS_CloudFront_Distribution_HASH:
+            if (name == "AWS::CloudFront::Distribution")
+            {
+              return ResourceType::AWS_CloudFront_Distribution;
+            }
+            break;
+          case AWS_CloudFront_StreamingDistribution_HASH:
+            if (name == "AWS::CloudFront::StreamingDistribution")
+            {
+              return ResourceType::AWS_CloudFront_StreamingDistribution;
+            }
+            break;
+          case AWS_WAF_RuleGroup_HASH:
+            if (name == "AWS::WAF::RuleGroup")
+            {
+              return ResourceType::AWS_WAF_RuleGroup;
+            }
+            break;
+          case AWS_WAFRegional_RuleGroup_HASH:
+            if (name == "AWS::WAFRegional::RuleGroup")
+            {
+              return ResourceType::AWS_WAFRegional_RuleGroup;
+            }
+            break;
+          case AWS_Lambda_Function_HASH:
+            if (name == "AWS::Lambda::Function")
+            {
+              return ResourceType::AWS_Lambda_Function;
+            }
+            break;
+          case AWS_ElasticBeanstalk_Application_HASH:
+            if (name == "AWS::ElasticBeanstalk::Application")
+            {
+              return ResourceType::AWS_ElasticBeanstalk_Application;
+            }
+            break;
+          case AWS_ElasticBeanstalk_ApplicationVersion_HASH:
+            if (name == "AWS::ElasticBeanstalk::ApplicationVersion")
+            {
+              return ResourceType::AWS_ElasticBeanstalk_ApplicationVersion;
+            }
+            break;
+          case AWS_ElasticBeanstalk_Environment_HASH:
+            if (name == "AWS::ElasticBeanstalk::Environment")
+            {
+              return ResourceType::AWS_ElasticBeanstalk_Environment;
+            }
+            break;
+          case AWS_ElasticLoadBalancing_LoadBalancer_HASH:
+            if (name == "AWS::ElasticLoadBalancing::LoadBalancer")
+            {
+              return ResourceType::AWS_ElasticLoadBalancing_LoadBalancer;
+            }
+            break;
+          case AWS_XRay_EncryptionConfig_HASH:
+            if (name == "AWS::XRay::EncryptionConfig")
+            {
+              return ResourceType::AWS_XRay_EncryptionConfig;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -335,7 +457,7 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceType(ResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -459,7 +581,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace PhoneTypeMapper
 {
 AWS_CONNECT_API PhoneType GetPhoneTypeForName(const Aws::String& name);
 
-AWS_CONNECT_API Aws::String GetNameForPhoneType(PhoneType value);
+// names of values not modeled point into the enum overflow container
+AWS_CONNECT_API const char* GetNameForPhoneType(PhoneType value);
 } // namespace PhoneTypeMapper
 } // namespace Model
 } // namespace Connect
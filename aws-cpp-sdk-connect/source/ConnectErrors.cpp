@@ -28,15 +28,15 @@ namespace Connect
 namespace ConnectErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int USER_NOT_FOUND_HASH = HashingUtils::HashString("UserNotFoundException");
-static const int OUTBOUND_CONTACT_NOT_PERMITTED_HASH = HashingUtils::HashString("OutboundContactNotPermittedException");
-static const int DESTINATION_NOT_ALLOWED_HASH = HashingUtils::HashString("DestinationNotAllowedException");
-static const int CONTACT_NOT_FOUND_HASH = HashingUtils::HashString("ContactNotFoundException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int DUPLICATE_RESOURCE_HASH = HashingUtils::HashString("DuplicateResourceException");
-static const int INTERNAL_SERVICE_HASH = HashingUtils::HashString("InternalServiceException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int USER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("UserNotFoundException");
+static constexpr int OUTBOUND_CONTACT_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OutboundContactNotPermittedException");
+static constexpr int DESTINATION_NOT_ALLOWED_HASH = HashingUtils::CompileTimeHashString("DestinationNotAllowedException");
+static constexpr int CONTACT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ContactNotFoundException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int DUPLICATE_RESOURCE_HASH = HashingUtils::CompileTimeHashString("DuplicateResourceException");
+static constexpr int INTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace PhoneTypeMapper
       {
 
-        static const int SOFT_PHONE_HASH = HashingUtils::HashString("SOFT_PHONE");
-        static const int DESK_PHONE_HASH = HashingUtils::HashString("DESK_PHONE");
+        static constexpr int SOFT_PHONE_HASH = HashingUtils::CompileTimeHashString("SOFT_PHONE");
+        static constexpr int DESK_PHONE_HASH = HashingUtils::CompileTimeHashString("DESK_PHONE");
 
 
         PhoneType GetPhoneTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SOFT_PHONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PhoneType::SOFT_PHONE;
-          }
-          else if (hashCode == DESK_PHONE_HASH)
-          {
-            return PhoneType::DESK_PHONE;
+          case SOFT_PHONE_HASH:
+            if (name == "SOFT_PHONE")
+            {
+              return PhoneType::SOFT_PHONE;
+            }
+            break;
+          case DESK_PHONE_HASH:
+            if (name == "DESK_PHONE")
+            {
+              return PhoneType::DESK_PHONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PhoneType::NOT_SET;
         }
 
-        Aws::String GetNameForPhoneType(PhoneType enumValue)
+        const char* GetNameForPhoneType(PhoneType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
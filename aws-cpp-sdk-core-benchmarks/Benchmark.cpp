@@ -0,0 +1,196 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/Version.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/Array.h>
+#include <cassert>
+
+using namespace Aws::Benchmarks;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+
+namespace
+{
+    struct RegisteredBenchmark
+    {
+        const char* name;
+        BenchmarkFunction function;
+    };
+
+    static const size_t MAX_BENCHMARKS = 256;
+
+    // Filled during static initialization, before any memory system is installed, hence a plain array.
+    struct BenchmarkRegistry
+    {
+        RegisteredBenchmark benchmarks[MAX_BENCHMARKS];
+        size_t count;
+    };
+
+    BenchmarkRegistry& GetRegistry()
+    {
+        static BenchmarkRegistry registry;
+        return registry;
+    }
+
+    // Large enough for the fastest benchmarks to get above the clock resolution within a few rounds.
+    static const uint64_t MAX_ROUND_GROWTH = 10;
+
+    volatile const void* s_optimizationSink = nullptr;
+}
+
+BenchmarkState::BenchmarkState(std::chrono::nanoseconds minTime) :
+    m_minTime(minTime),
+    m_roundIterations(0),
+    m_remainingIterations(0),
+    m_bytesPerIteration(0),
+    m_started(false),
+    m_pausedTime(0),
+    m_elapsed(0)
+{
+}
+
+bool BenchmarkState::NextRound()
+{
+    auto now = std::chrono::steady_clock::now();
+    if (m_started)
+    {
+        m_elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_roundStart) - m_pausedTime;
+        if (m_elapsed >= m_minTime)
+        {
+            return false;
+        }
+
+        // aim a bit past the minimum time so that most benchmarks are done in the next round
+        uint64_t growth = MAX_ROUND_GROWTH;
+        if (m_elapsed.count() > 0)
+        {
+            double predicted = 1.4 * static_cast<double>(m_minTime.count()) / static_cast<double>(m_elapsed.count());
+            growth = predicted < 2.0 ? 2 : (predicted > MAX_ROUND_GROWTH ? MAX_ROUND_GROWTH : static_cast<uint64_t>(predicted));
+        }
+        m_roundIterations *= growth;
+    }
+    else
+    {
+        // the first round is a single iteration, it doubles as a warm up
+        m_started = true;
+        m_roundIterations = 1;
+    }
+
+    m_remainingIterations = m_roundIterations - 1;
+    m_pausedTime = std::chrono::nanoseconds(0);
+    m_roundStart = std::chrono::steady_clock::now();
+    return true;
+}
+
+void BenchmarkState::PauseTiming()
+{
+    m_pauseStart = std::chrono::steady_clock::now();
+}
+
+void BenchmarkState::ResumeTiming()
+{
+    m_pausedTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_pauseStart);
+}
+
+BenchmarkRegistration::BenchmarkRegistration(const char* name, BenchmarkFunction function)
+{
+    BenchmarkRegistry& registry = GetRegistry();
+    assert(registry.count < MAX_BENCHMARKS);
+    if (registry.count < MAX_BENCHMARKS)
+    {
+        registry.benchmarks[registry.count].name = name;
+        registry.benchmarks[registry.count].function = function;
+        ++registry.count;
+    }
+}
+
+namespace Aws
+{
+    namespace Benchmarks
+    {
+        Aws::Vector<BenchmarkResult> RunBenchmarks(const Aws::String& filter, std::chrono::nanoseconds minTime)
+        {
+            Aws::Vector<BenchmarkResult> results;
+            const BenchmarkRegistry& registry = GetRegistry();
+            for (size_t i = 0; i < registry.count; ++i)
+            {
+                const RegisteredBenchmark& benchmark = registry.benchmarks[i];
+                if (!filter.empty() && Aws::String(benchmark.name).find(filter) == Aws::String::npos)
+                {
+                    continue;
+                }
+
+                BenchmarkState state(minTime);
+                benchmark.function(state);
+
+                BenchmarkResult result;
+                result.name = benchmark.name;
+                result.iterations = state.GetIterations();
+                double elapsedNs = static_cast<double>(state.GetElapsedTime().count());
+                result.nanosecondsPerIteration = result.iterations ? elapsedNs / static_cast<double>(result.iterations) : 0.0;
+                result.bytesPerSecond = elapsedNs > 0.0 ?
+                    static_cast<double>(state.GetBytesPerIteration()) * static_cast<double>(result.iterations) * 1e9 / elapsedNs : 0.0;
+                results.push_back(result);
+            }
+            return results;
+        }
+
+        Aws::Vector<Aws::String> ListBenchmarks()
+        {
+            Aws::Vector<Aws::String> names;
+            const BenchmarkRegistry& registry = GetRegistry();
+            for (size_t i = 0; i < registry.count; ++i)
+            {
+                names.push_back(registry.benchmarks[i].name);
+            }
+            return names;
+        }
+
+        JsonValue ResultsToJson(const Aws::Vector<BenchmarkResult>& results)
+        {
+            Array<JsonValue> benchmarks(results.size());
+            for (size_t i = 0; i < results.size(); ++i)
+            {
+                const BenchmarkResult& result = results[i];
+                JsonValue benchmark;
+                benchmark.WithString("name", result.name)
+                    .WithInt64("iterations", static_cast<long long>(result.iterations))
+                    .WithDouble("nanosecondsPerIteration", result.nanosecondsPerIteration);
+                if (result.bytesPerSecond > 0.0)
+                {
+                    benchmark.WithDouble("bytesPerSecond", result.bytesPerSecond);
+                }
+                benchmarks[i] = std::move(benchmark);
+            }
+
+            JsonValue context;
+            context.WithString("sdkVersion", Aws::Version::GetVersionString())
+                .WithString("compiler", Aws::Version::GetCompilerVersionString())
+                .WithString("date", DateTime::Now().ToGmtString(DateFormat::ISO_8601));
+
+            JsonValue report;
+            report.WithObject("context", std::move(context))
+                .WithArray("benchmarks", std::move(benchmarks));
+            return report;
+        }
+
+        void DoNotOptimize(const void* value)
+        {
+            s_optimizationSink = value;
+        }
+    } // namespace Benchmarks
+} // namespace Aws
@@ -0,0 +1,127 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/Aws.h>
+#include <aws/core/utils/StringUtils.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+/**
+ * Usage: aws-cpp-sdk-core-benchmarks [--filter=<substring>] [--min_time_ms=<ms>] [--output=<file>] [--list]
+ *
+ * Prints a summary table to stdout; with --output, the results are also written to <file> as json
+ * so that they can be compared across builds and releases.
+ */
+static const char FILTER_ARG[] = "--filter=";
+static const char MIN_TIME_ARG[] = "--min_time_ms=";
+static const char OUTPUT_ARG[] = "--output=";
+static const char LIST_ARG[] = "--list";
+static const long long DEFAULT_MIN_TIME_MS = 500;
+
+static bool ArgumentStartsWith(const Aws::String& argument, const char* prefix, Aws::String& value)
+{
+    Aws::String prefixString(prefix);
+    if (argument.compare(0, prefixString.size(), prefixString) == 0)
+    {
+        value = argument.substr(prefixString.size());
+        return true;
+    }
+    return false;
+}
+
+static int RunWithArguments(int argc, char** argv)
+{
+    Aws::String filter;
+    Aws::String outputFile;
+    long long minTimeMs = DEFAULT_MIN_TIME_MS;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        Aws::String argument(argv[i]);
+        Aws::String value;
+        if (ArgumentStartsWith(argument, FILTER_ARG, value))
+        {
+            filter = value;
+        }
+        else if (ArgumentStartsWith(argument, MIN_TIME_ARG, value))
+        {
+            minTimeMs = Aws::Utils::StringUtils::ConvertToInt64(value.c_str());
+        }
+        else if (ArgumentStartsWith(argument, OUTPUT_ARG, value))
+        {
+            outputFile = value;
+        }
+        else if (argument == LIST_ARG)
+        {
+            listOnly = true;
+        }
+        else
+        {
+            std::cerr << "Unknown argument " << argument << std::endl;
+            std::cerr << "Usage: " << argv[0] << " [--filter=<substring>] [--min_time_ms=<ms>] [--output=<file>] [--list]" << std::endl;
+            return 1;
+        }
+    }
+
+    if (listOnly)
+    {
+        for (const auto& name : Aws::Benchmarks::ListBenchmarks())
+        {
+            std::cout << name << std::endl;
+        }
+        return 0;
+    }
+
+    auto results = Aws::Benchmarks::RunBenchmarks(filter, std::chrono::milliseconds(minTimeMs > 0 ? minTimeMs : DEFAULT_MIN_TIME_MS));
+
+    std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(14) << "Iterations"
+        << std::setw(16) << "ns/iteration" << std::setw(14) << "MB/s" << std::endl;
+    for (const auto& result : results)
+    {
+        std::cout << std::left << std::setw(48) << result.name << std::right << std::setw(14) << result.iterations
+            << std::setw(16) << std::fixed << std::setprecision(1) << result.nanosecondsPerIteration;
+        if (result.bytesPerSecond > 0.0)
+        {
+            std::cout << std::setw(14) << result.bytesPerSecond / (1024.0 * 1024.0);
+        }
+        std::cout << std::endl;
+    }
+
+    if (!outputFile.empty())
+    {
+        std::ofstream output(outputFile.c_str(), std::ios_base::out | std::ios_base::trunc);
+        if (!output.good())
+        {
+            std::cerr << "Unable to open " << outputFile << " for writing" << std::endl;
+            return 1;
+        }
+        output << Aws::Benchmarks::ResultsToJson(results).View().WriteReadable();
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    Aws::SDKOptions options;
+    options.loggingOptions.logLevel = Aws::Utils::Logging::LogLevel::Off;
+    Aws::InitAPI(options);
+    int retVal = RunWithArguments(argc, argv);
+    Aws::ShutdownAPI(options);
+    return retVal;
+}
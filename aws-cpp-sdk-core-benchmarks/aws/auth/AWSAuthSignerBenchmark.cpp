@@ -0,0 +1,83 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+static const char ALLOCATION_TAG[] = "AWSAuthSignerBenchmark";
+
+static std::shared_ptr<AWSAuthV4Signer> CreateSigner()
+{
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY");
+    return Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider, "dynamodb", "us-east-1");
+}
+
+// shaped like a DynamoDB PutItem call
+static std::shared_ptr<StandardHttpRequest> CreateRequest(size_t bodySize)
+{
+    auto request = Aws::MakeShared<StandardHttpRequest>(ALLOCATION_TAG, URI("https://dynamodb.us-east-1.amazonaws.com/"), HttpMethod::HTTP_POST);
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << Aws::String(bodySize, 'x');
+    request->AddContentBody(body);
+    request->SetContentType("application/x-amz-json-1.0");
+    request->SetContentLength(Aws::Utils::StringUtils::to_string(bodySize));
+    request->SetHeaderValue("x-amz-target", "DynamoDB_20120810.PutItem");
+    request->SetUserAgent("aws-sdk-cpp/benchmark");
+    return request;
+}
+
+AWS_BENCHMARK(AWSAuthV4Signer, SignHeadersOnly)
+{
+    auto signer = CreateSigner();
+    auto request = CreateRequest(1024);
+    while (state.KeepRunning())
+    {
+        bool signedRequest = signer->SignRequest(*request, false);
+        Aws::Benchmarks::DoNotOptimize(signedRequest);
+    }
+}
+
+AWS_BENCHMARK(AWSAuthV4Signer, SignWith64KBPayload)
+{
+    const size_t bodySize = 64 * 1024;
+    auto signer = CreateSigner();
+    auto request = CreateRequest(bodySize);
+    state.SetBytesPerIteration(bodySize);
+    while (state.KeepRunning())
+    {
+        bool signedRequest = signer->SignRequest(*request, true);
+        Aws::Benchmarks::DoNotOptimize(signedRequest);
+    }
+}
+
+AWS_BENCHMARK(AWSAuthV4Signer, PresignUrl)
+{
+    auto signer = CreateSigner();
+    while (state.KeepRunning())
+    {
+        StandardHttpRequest request(URI("https://dynamodb.us-east-1.amazonaws.com/?Action=ListTables"), HttpMethod::HTTP_GET);
+        bool signedRequest = signer->PresignRequest(request, 900);
+        Aws::Benchmarks::DoNotOptimize(signedRequest);
+    }
+}
@@ -0,0 +1,117 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/AmazonSerializableWebServiceRequest.h>
+#include <aws/core/AmazonWebServiceResult.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/AWSErrorMarshaller.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils::Json;
+
+static const char ALLOCATION_TAG[] = "AWSClientBenchmark";
+
+// Shaped like a generated DynamoDB GetItem request.
+class GetItemRequestMock : public Aws::AmazonSerializableWebServiceRequest
+{
+public:
+    Aws::String SerializePayload() const override
+    {
+        JsonValue payload;
+        payload.WithString("TableName", "benchmark-table")
+            .WithObject("Key", JsonValue().WithObject("Id", JsonValue().WithString("S", "customer-42")))
+            .WithBool("ConsistentRead", true);
+        return payload.View().WriteCompact();
+    }
+
+    HeaderValueCollection GetHeaders() const override
+    {
+        HeaderValueCollection headers;
+        headers.emplace(CONTENT_TYPE_HEADER, Aws::AMZN_JSON_CONTENT_TYPE_1_0);
+        headers.emplace("x-amz-target", "DynamoDB_20120810.GetItem");
+        return headers;
+    }
+
+    const char* GetServiceRequestName() const override { return "GetItem"; }
+};
+
+class JsonClientMock : public AWSJsonClient
+{
+public:
+    JsonClientMock(const ClientConfiguration& config) : AWSJsonClient(config,
+        Aws::MakeShared<Aws::Client::AWSAuthV4Signer>(ALLOCATION_TAG,
+            Aws::MakeShared<Aws::Auth::SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "AKIDEXAMPLE", "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY"),
+            "dynamodb", "us-east-1"),
+        Aws::MakeShared<JsonErrorMarshaller>(ALLOCATION_TAG))
+    {
+    }
+
+    JsonOutcome GetItem(const GetItemRequestMock& request) const
+    {
+        return MakeRequest(URI("https://dynamodb.us-east-1.amazonaws.com/"), request, HttpMethod::HTTP_POST);
+    }
+};
+
+AWS_BENCHMARK(AWSJsonClient, RoundTripAgainstMockHttpClient)
+{
+    auto mockHttpClient = Aws::MakeShared<MockHttpClient>(ALLOCATION_TAG);
+    auto mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(ALLOCATION_TAG);
+    mockHttpClientFactory->SetClient(mockHttpClient);
+    SetHttpClientFactory(mockHttpClientFactory);
+
+    {
+        ClientConfiguration config;
+        JsonClientMock client(config);
+        GetItemRequestMock request;
+        StandardHttpRequest responseRequest(URI("https://dynamodb.us-east-1.amazonaws.com/"), HttpMethod::HTTP_POST);
+        responseRequest.SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        const Aws::String responseBody = "{\"Item\":{\"Id\":{\"S\":\"customer-42\"},\"Name\":{\"S\":\"A reasonably long display name\"},"
+            "\"CreatedAt\":{\"N\":\"1498848754\"},\"Active\":{\"BOOL\":true}}}";
+
+        while (state.KeepRunning())
+        {
+            // a fresh response every time, as an actual http client would produce
+            auto response = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, responseRequest);
+            response->SetResponseCode(HttpResponseCode::OK);
+            response->AddHeader("x-amzn-RequestId", "KEIDQ4O9S3PKD8N4JOTDFPSB8FVV4KQNSO5AEMVJF66Q9ASUAAJG");
+            response->GetResponseBody() << responseBody;
+            mockHttpClient->AddResponseToReturn(response);
+
+            auto outcome = client.GetItem(request);
+            Aws::Benchmarks::DoNotOptimize(outcome);
+
+            // the mock keeps a copy of every request it sees
+            mockHttpClient->Reset();
+        }
+    }
+
+    mockHttpClient = nullptr;
+    mockHttpClientFactory = nullptr;
+    CleanupHttp();
+    InitHttp();
+}
@@ -0,0 +1,77 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/http/URI.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Http;
+using namespace Aws::Utils;
+
+static const char S3_LIST_URI[] = "https://benchmark-bucket.s3.us-west-2.amazonaws.com:443/?list-type=2&prefix=logs%2F2017%2F06&max-keys=1000&continuation-token=1ueGcxLPRx1Tr%2FXYExHnhbYLgveDs2J%2FwbyF";
+static const char OBJECT_KEY[] = "logs/2017/06/30/application server (eu-west-1)/stdout+stderr [rotated].log.gz";
+
+AWS_BENCHMARK(URI, Parse)
+{
+    while (state.KeepRunning())
+    {
+        URI uri(S3_LIST_URI);
+        Aws::Benchmarks::DoNotOptimize(uri);
+    }
+}
+
+AWS_BENCHMARK(URI, ParseQueryStringParameters)
+{
+    const URI uri(S3_LIST_URI);
+    while (state.KeepRunning())
+    {
+        auto parameters = uri.GetQueryStringParameters();
+        Aws::Benchmarks::DoNotOptimize(parameters);
+    }
+}
+
+AWS_BENCHMARK(URI, BuildObjectUri)
+{
+    while (state.KeepRunning())
+    {
+        URI uri("https://benchmark-bucket.s3.us-west-2.amazonaws.com");
+        uri.SetPath(uri.GetPath() + "/" + OBJECT_KEY);
+        uri.AddQueryStringParameter("versionId", "3HL4kqtJlcpXroDTDmjVBH40Nrjfkd");
+        uri.AddQueryStringParameter("partNumber", "7");
+        Aws::String uriString = uri.GetURIString();
+        Aws::Benchmarks::DoNotOptimize(uriString);
+    }
+}
+
+AWS_BENCHMARK(URI, URLEncodePath)
+{
+    const Aws::String path = Aws::String("/") + OBJECT_KEY;
+    state.SetBytesPerIteration(path.size());
+    while (state.KeepRunning())
+    {
+        Aws::String encoded = URI::URLEncodePath(path);
+        Aws::Benchmarks::DoNotOptimize(encoded);
+    }
+}
+
+AWS_BENCHMARK(URI, URLEncodeQueryValue)
+{
+    state.SetBytesPerIteration(sizeof(OBJECT_KEY) - 1);
+    while (state.KeepRunning())
+    {
+        Aws::String encoded = StringUtils::URLEncode(OBJECT_KEY);
+        Aws::Benchmarks::DoNotOptimize(encoded);
+    }
+}
@@ -0,0 +1,145 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <chrono>
+#include <cstddef>
+#include <stdint.h>
+
+namespace Aws
+{
+    namespace Benchmarks
+    {
+        /**
+         * Passed to every benchmark. The body of a benchmark is a loop of the form
+         *
+         *     while (state.KeepRunning())
+         *     {
+         *         // code being measured
+         *     }
+         *
+         * The loop is run in rounds of growing iteration counts until a round lasts at least the minimum time,
+         * only that last round is reported. The clock is read once per round, not once per iteration.
+         */
+        class BenchmarkState
+        {
+        public:
+            BenchmarkState(std::chrono::nanoseconds minTime);
+
+            inline bool KeepRunning()
+            {
+                if (m_remainingIterations > 0)
+                {
+                    --m_remainingIterations;
+                    return true;
+                }
+                return NextRound();
+            }
+
+            /**
+             * Excludes the time spent between PauseTiming() and ResumeTiming() from the measurement.
+             * Both calls read the clock, so only use them around work much longer than that.
+             */
+            void PauseTiming();
+            void ResumeTiming();
+
+            /**
+             * Number of bytes processed by one iteration, used to report a throughput.
+             */
+            void SetBytesPerIteration(uint64_t bytes) { m_bytesPerIteration = bytes; }
+
+            uint64_t GetIterations() const { return m_roundIterations; }
+            std::chrono::nanoseconds GetElapsedTime() const { return m_elapsed; }
+            uint64_t GetBytesPerIteration() const { return m_bytesPerIteration; }
+
+        private:
+            bool NextRound();
+
+            const std::chrono::nanoseconds m_minTime;
+            uint64_t m_roundIterations;
+            uint64_t m_remainingIterations;
+            uint64_t m_bytesPerIteration;
+            bool m_started;
+            std::chrono::steady_clock::time_point m_roundStart;
+            std::chrono::steady_clock::time_point m_pauseStart;
+            std::chrono::nanoseconds m_pausedTime;
+            std::chrono::nanoseconds m_elapsed;
+        };
+
+        typedef void (*BenchmarkFunction)(BenchmarkState&);
+
+        /**
+         * Static registration hook used by AWS_BENCHMARK. It does not allocate, so it is safe to run before InitAPI().
+         */
+        class BenchmarkRegistration
+        {
+        public:
+            BenchmarkRegistration(const char* name, BenchmarkFunction function);
+        };
+
+        struct BenchmarkResult
+        {
+            Aws::String name;
+            uint64_t iterations;
+            double nanosecondsPerIteration;
+            double bytesPerSecond;
+        };
+
+        /**
+         * Runs every registered benchmark whose name contains filter (all of them when filter is empty), in registration order.
+         */
+        Aws::Vector<BenchmarkResult> RunBenchmarks(const Aws::String& filter, std::chrono::nanoseconds minTime);
+
+        /**
+         * Returns the names of the registered benchmarks.
+         */
+        Aws::Vector<Aws::String> ListBenchmarks();
+
+        /**
+         * Machine readable report: the SDK version and compiler the results were obtained with, and one entry per benchmark.
+         */
+        Aws::Utils::Json::JsonValue ResultsToJson(const Aws::Vector<BenchmarkResult>& results);
+
+        /**
+         * Keeps the compiler from optimizing away the computation of value.
+         */
+        void DoNotOptimize(const void* value);
+
+        template<typename T>
+        inline void DoNotOptimize(const T& value)
+        {
+            DoNotOptimize(static_cast<const void*>(&value));
+        }
+    } // namespace Benchmarks
+} // namespace Aws
+
+#define AWS_BENCHMARK_FUNCTION_NAME(group, name) Benchmark_##group##_##name
+
+/**
+ * Defines and registers a benchmark named "group.name", e.g.
+ *
+ *     AWS_BENCHMARK(Base64, Encode64KB)
+ *     {
+ *         while (state.KeepRunning()) { ... }
+ *     }
+ */
+#define AWS_BENCHMARK(group, name) \
+    static void AWS_BENCHMARK_FUNCTION_NAME(group, name)(Aws::Benchmarks::BenchmarkState& state); \
+    static Aws::Benchmarks::BenchmarkRegistration AWS_BENCHMARK_FUNCTION_NAME(group, name##_Registration)(#group "." #name, &AWS_BENCHMARK_FUNCTION_NAME(group, name)); \
+    static void AWS_BENCHMARK_FUNCTION_NAME(group, name)(Aws::Benchmarks::BenchmarkState& state)
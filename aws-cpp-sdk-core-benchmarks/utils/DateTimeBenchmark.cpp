@@ -0,0 +1,66 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/utils/DateTime.h>
+
+using namespace Aws::Utils;
+
+AWS_BENCHMARK(DateTime, ParseISO8601)
+{
+    while (state.KeepRunning())
+    {
+        DateTime dateTime("2017-06-30T18:52:34.000Z", DateFormat::ISO_8601);
+        Aws::Benchmarks::DoNotOptimize(dateTime);
+    }
+}
+
+AWS_BENCHMARK(DateTime, ParseRFC822)
+{
+    while (state.KeepRunning())
+    {
+        DateTime dateTime("Fri, 30 Jun 2017 18:52:34 GMT", DateFormat::RFC822);
+        Aws::Benchmarks::DoNotOptimize(dateTime);
+    }
+}
+
+AWS_BENCHMARK(DateTime, ParseAutoDetect)
+{
+    while (state.KeepRunning())
+    {
+        DateTime dateTime("Fri, 30 Jun 2017 18:52:34 GMT", DateFormat::AutoDetect);
+        Aws::Benchmarks::DoNotOptimize(dateTime);
+    }
+}
+
+AWS_BENCHMARK(DateTime, ToGmtStringISO8601)
+{
+    const DateTime dateTime("2017-06-30T18:52:34.000Z", DateFormat::ISO_8601);
+    while (state.KeepRunning())
+    {
+        Aws::String formatted = dateTime.ToGmtString(DateFormat::ISO_8601);
+        Aws::Benchmarks::DoNotOptimize(formatted);
+    }
+}
+
+AWS_BENCHMARK(DateTime, ToGmtStringRFC822)
+{
+    const DateTime dateTime("2017-06-30T18:52:34.000Z", DateFormat::ISO_8601);
+    while (state.KeepRunning())
+    {
+        Aws::String formatted = dateTime.ToGmtString(DateFormat::RFC822);
+        Aws::Benchmarks::DoNotOptimize(formatted);
+    }
+}
@@ -0,0 +1,97 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/utils/HashingUtils.h>
+
+using namespace Aws::Utils;
+
+static ByteBuffer CreateBuffer(size_t length)
+{
+    ByteBuffer buffer(length);
+    for (size_t i = 0; i < length; ++i)
+    {
+        buffer[i] = static_cast<unsigned char>(i * 31 + 7);
+    }
+    return buffer;
+}
+
+AWS_BENCHMARK(Base64, Encode64KB)
+{
+    const ByteBuffer buffer = CreateBuffer(64 * 1024);
+    state.SetBytesPerIteration(buffer.GetLength());
+    while (state.KeepRunning())
+    {
+        Aws::String encoded = HashingUtils::Base64Encode(buffer);
+        Aws::Benchmarks::DoNotOptimize(encoded);
+    }
+}
+
+AWS_BENCHMARK(Base64, Decode64KB)
+{
+    const Aws::String encoded = HashingUtils::Base64Encode(CreateBuffer(64 * 1024));
+    state.SetBytesPerIteration(encoded.size());
+    while (state.KeepRunning())
+    {
+        ByteBuffer decoded = HashingUtils::Base64Decode(encoded);
+        Aws::Benchmarks::DoNotOptimize(decoded);
+    }
+}
+
+// the size of a SHA256 digest, what the signer and checksums hex encode
+AWS_BENCHMARK(Hex, Encode32Bytes)
+{
+    const ByteBuffer buffer = CreateBuffer(32);
+    state.SetBytesPerIteration(buffer.GetLength());
+    while (state.KeepRunning())
+    {
+        Aws::String encoded = HashingUtils::HexEncode(buffer);
+        Aws::Benchmarks::DoNotOptimize(encoded);
+    }
+}
+
+AWS_BENCHMARK(Hex, Encode64KB)
+{
+    const ByteBuffer buffer = CreateBuffer(64 * 1024);
+    state.SetBytesPerIteration(buffer.GetLength());
+    while (state.KeepRunning())
+    {
+        Aws::String encoded = HashingUtils::HexEncode(buffer);
+        Aws::Benchmarks::DoNotOptimize(encoded);
+    }
+}
+
+AWS_BENCHMARK(Hex, Decode64KB)
+{
+    const Aws::String encoded = HashingUtils::HexEncode(CreateBuffer(64 * 1024));
+    state.SetBytesPerIteration(encoded.size());
+    while (state.KeepRunning())
+    {
+        ByteBuffer decoded = HashingUtils::HexDecode(encoded);
+        Aws::Benchmarks::DoNotOptimize(decoded);
+    }
+}
+
+AWS_BENCHMARK(Sha256, Hash64KB)
+{
+    const ByteBuffer buffer = CreateBuffer(64 * 1024);
+    const Aws::String data(reinterpret_cast<const char*>(buffer.GetUnderlyingData()), buffer.GetLength());
+    state.SetBytesPerIteration(data.size());
+    while (state.KeepRunning())
+    {
+        ByteBuffer digest = HashingUtils::CalculateSHA256(data);
+        Aws::Benchmarks::DoNotOptimize(digest);
+    }
+}
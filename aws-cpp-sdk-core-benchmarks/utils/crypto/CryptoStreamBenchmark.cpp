@@ -0,0 +1,153 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#ifndef NO_SYMMETRIC_ENCRYPTION
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/utils/crypto/CryptoStream.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+// what an S3 encryption client streams per object: plain text is encrypted while it's read, cipher text decrypted while it's written
+static const size_t OBJECT_SIZE = 1024 * 1024;
+// the buffer size the streams used to default to
+static const size_t SMALL_BUFFER_SIZE = 1024;
+
+enum class AesMode
+{
+    CBC,
+    CTR,
+    GCM
+};
+
+static std::shared_ptr<SymmetricCipher> CreateCipher(AesMode mode, const CryptoBuffer& key, const CryptoBuffer& iv, const CryptoBuffer& tag)
+{
+    switch (mode)
+    {
+    case AesMode::CBC:
+        return CreateAES_CBCImplementation(key, iv);
+    case AesMode::CTR:
+        return CreateAES_CTRImplementation(key, iv);
+    default:
+        return CreateAES_GCMImplementation(key, iv, tag);
+    }
+}
+
+static size_t IVLength(AesMode mode)
+{
+    return mode == AesMode::GCM ? 12 : 16;
+}
+
+static ByteBuffer CreatePlainText()
+{
+    ByteBuffer buffer(OBJECT_SIZE);
+    for (size_t i = 0; i < OBJECT_SIZE; ++i)
+    {
+        buffer[i] = static_cast<unsigned char>(i * 31 + 7);
+    }
+    return buffer;
+}
+
+static void EncryptStream(AesMode mode, size_t bufferSize, Aws::Benchmarks::BenchmarkState& state)
+{
+    const CryptoBuffer key = SymmetricCipher::GenerateKey();
+    const CryptoBuffer iv = SymmetricCipher::GenerateIV(IVLength(mode));
+    ByteBuffer plainText = CreatePlainText();
+    ByteBuffer chunk(64 * 1024);
+
+    state.SetBytesPerIteration(OBJECT_SIZE);
+    while (state.KeepRunning())
+    {
+        Stream::PreallocatedStreamBuf plainTextBuf(&plainText, plainText.GetLength());
+        Aws::IOStream src(&plainTextBuf);
+        auto cipher = CreateCipher(mode, key, iv, CryptoBuffer());
+        SymmetricCryptoStream cryptoStream(static_cast<Aws::IStream&>(src), CipherMode::Encrypt, *cipher, bufferSize);
+        while (cryptoStream)
+        {
+            cryptoStream.read(reinterpret_cast<char*>(chunk.GetUnderlyingData()), chunk.GetLength());
+        }
+        Aws::Benchmarks::DoNotOptimize(chunk);
+    }
+}
+
+static void DecryptStream(AesMode mode, size_t bufferSize, Aws::Benchmarks::BenchmarkState& state)
+{
+    const CryptoBuffer key = SymmetricCipher::GenerateKey();
+    const CryptoBuffer iv = SymmetricCipher::GenerateIV(IVLength(mode));
+    ByteBuffer plainText = CreatePlainText();
+
+    auto encryptor = CreateCipher(mode, key, iv, CryptoBuffer());
+    CryptoBuffer encryptedText = encryptor->EncryptBuffer(CryptoBuffer(plainText.GetUnderlyingData(), plainText.GetLength()));
+    CryptoBuffer finalBlock = encryptor->FinalizeEncryption();
+    encryptedText = CryptoBuffer({&encryptedText, &finalBlock});
+    const CryptoBuffer tag = encryptor->GetTag();
+
+    state.SetBytesPerIteration(OBJECT_SIZE);
+    while (state.KeepRunning())
+    {
+        Stream::PreallocatedStreamBuf plainTextBuf(&plainText, plainText.GetLength());
+        Aws::IOStream sink(&plainTextBuf);
+        auto cipher = CreateCipher(mode, key, iv, tag);
+        SymmetricCryptoStream cryptoStream(static_cast<Aws::OStream&>(sink), CipherMode::Decrypt, *cipher, bufferSize);
+        cryptoStream.write(reinterpret_cast<const char*>(encryptedText.GetUnderlyingData()), encryptedText.GetLength());
+        cryptoStream.Finalize();
+        Aws::Benchmarks::DoNotOptimize(plainText);
+    }
+}
+
+AWS_BENCHMARK(AesCbc, EncryptStream1MB)
+{
+    EncryptStream(AesMode::CBC, DEFAULT_BUF_SIZE, state);
+}
+
+AWS_BENCHMARK(AesCbc, DecryptStream1MB)
+{
+    DecryptStream(AesMode::CBC, DEFAULT_BUF_SIZE, state);
+}
+
+AWS_BENCHMARK(AesCtr, EncryptStream1MB)
+{
+    EncryptStream(AesMode::CTR, DEFAULT_BUF_SIZE, state);
+}
+
+AWS_BENCHMARK(AesCtr, DecryptStream1MB)
+{
+    DecryptStream(AesMode::CTR, DEFAULT_BUF_SIZE, state);
+}
+
+AWS_BENCHMARK(AesGcm, EncryptStream1MB)
+{
+    EncryptStream(AesMode::GCM, DEFAULT_BUF_SIZE, state);
+}
+
+AWS_BENCHMARK(AesGcm, DecryptStream1MB)
+{
+    DecryptStream(AesMode::GCM, DEFAULT_BUF_SIZE, state);
+}
+
+AWS_BENCHMARK(AesGcm, EncryptStream1MB_1KBBuffer)
+{
+    EncryptStream(AesMode::GCM, SMALL_BUFFER_SIZE, state);
+}
+
+AWS_BENCHMARK(AesGcm, DecryptStream1MB_1KBBuffer)
+{
+    DecryptStream(AesMode::GCM, SMALL_BUFFER_SIZE, state);
+}
+
+#endif // NO_SYMMETRIC_ENCRYPTION
@@ -0,0 +1,94 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Json;
+
+static const size_t ITEM_COUNT = 100;
+
+// A DynamoDB Query response with ITEM_COUNT items of a few typed attributes each.
+static JsonValue BuildQueryResponse()
+{
+    Array<JsonValue> items(ITEM_COUNT);
+    for (size_t i = 0; i < ITEM_COUNT; ++i)
+    {
+        Aws::String index = StringUtils::to_string(i);
+        JsonValue item;
+        item.WithObject("Id", JsonValue().WithString("S", "customer-" + index))
+            .WithObject("CreatedAt", JsonValue().WithString("N", "1498848754" + index))
+            .WithObject("Name", JsonValue().WithString("S", "A reasonably long display name for customer number " + index))
+            .WithObject("Active", JsonValue().WithBool("BOOL", i % 2 == 0))
+            .WithObject("Tags", JsonValue().WithArray("SS", Array<Aws::String>(3)));
+        items[i] = std::move(item);
+    }
+
+    JsonValue response;
+    response.WithArray("Items", std::move(items))
+        .WithInteger("Count", static_cast<int>(ITEM_COUNT))
+        .WithInteger("ScannedCount", static_cast<int>(ITEM_COUNT))
+        .WithObject("LastEvaluatedKey", JsonValue().WithObject("Id", JsonValue().WithString("S", "customer-99")));
+    return response;
+}
+
+AWS_BENCHMARK(Json, BuildQueryResponse)
+{
+    while (state.KeepRunning())
+    {
+        JsonValue response = BuildQueryResponse();
+        Aws::Benchmarks::DoNotOptimize(response);
+    }
+}
+
+AWS_BENCHMARK(Json, ParseQueryResponse)
+{
+    const Aws::String payload = BuildQueryResponse().View().WriteCompact();
+    state.SetBytesPerIteration(payload.size());
+    while (state.KeepRunning())
+    {
+        JsonValue response(payload);
+        Aws::Benchmarks::DoNotOptimize(response);
+    }
+}
+
+AWS_BENCHMARK(Json, ParseAndReadQueryResponse)
+{
+    const Aws::String payload = BuildQueryResponse().View().WriteCompact();
+    state.SetBytesPerIteration(payload.size());
+    while (state.KeepRunning())
+    {
+        JsonValue response(payload);
+        auto items = response.View().GetArray("Items");
+        for (size_t i = 0; i < items.GetLength(); ++i)
+        {
+            Aws::String name = items[i].GetObject("Name").GetString("S");
+            Aws::Benchmarks::DoNotOptimize(name);
+        }
+    }
+}
+
+AWS_BENCHMARK(Json, WriteCompactQueryResponse)
+{
+    const JsonValue response = BuildQueryResponse();
+    state.SetBytesPerIteration(response.View().WriteCompact().size());
+    while (state.KeepRunning())
+    {
+        Aws::String payload = response.View().WriteCompact();
+        Aws::Benchmarks::DoNotOptimize(payload);
+    }
+}
@@ -0,0 +1,69 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/Semaphore.h>
+#include <atomic>
+
+using namespace Aws::Utils::Threading;
+
+static const size_t POOL_SIZE = 4;
+static const size_t BATCH_SIZE = 100;
+
+// Time from Submit() until the task has run and signaled the submitting thread.
+static void MeasureRoundTrip(Executor& executor, Aws::Benchmarks::BenchmarkState& state)
+{
+    Semaphore done(0, 1);
+    while (state.KeepRunning())
+    {
+        executor.Submit([&done]() { done.Release(); });
+        done.WaitOne();
+    }
+}
+
+AWS_BENCHMARK(PooledThreadExecutor, SubmitRoundTrip)
+{
+    PooledThreadExecutor executor(POOL_SIZE);
+    MeasureRoundTrip(executor, state);
+}
+
+AWS_BENCHMARK(PooledThreadExecutor, Submit100Tasks)
+{
+    PooledThreadExecutor executor(POOL_SIZE);
+    Semaphore done(0, 1);
+    std::atomic<size_t> remaining(0);
+    while (state.KeepRunning())
+    {
+        remaining = BATCH_SIZE;
+        for (size_t i = 0; i < BATCH_SIZE; ++i)
+        {
+            executor.Submit([&]()
+            {
+                if (--remaining == 0)
+                {
+                    done.Release();
+                }
+            });
+        }
+        done.WaitOne();
+    }
+}
+
+AWS_BENCHMARK(DefaultExecutor, SubmitRoundTrip)
+{
+    DefaultExecutor executor;
+    MeasureRoundTrip(executor, state);
+}
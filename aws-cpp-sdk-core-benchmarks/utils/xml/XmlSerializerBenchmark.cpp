@@ -0,0 +1,85 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/benchmarks/Benchmark.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+#include <aws/core/utils/StringUtils.h>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Xml;
+
+static const size_t OBJECT_COUNT = 100;
+
+// An S3 ListObjects response listing OBJECT_COUNT keys.
+static XmlDocument BuildListBucketResult()
+{
+    XmlDocument document = XmlDocument::CreateWithRootNode("ListBucketResult");
+    XmlNode root = document.GetRootElement();
+    root.SetAttributeValue("xmlns", "http://s3.amazonaws.com/doc/2006-03-01/");
+    root.CreateChildElement("Name").SetText("benchmark-bucket");
+    root.CreateChildElement("Prefix").SetText("logs/");
+    root.CreateChildElement("MaxKeys").SetText("1000");
+    root.CreateChildElement("IsTruncated").SetText("false");
+    for (size_t i = 0; i < OBJECT_COUNT; ++i)
+    {
+        Aws::String index = StringUtils::to_string(i);
+        XmlNode contents = root.CreateChildElement("Contents");
+        contents.CreateChildElement("Key").SetText("logs/2017/06/30/application-" + index + ".log.gz");
+        contents.CreateChildElement("LastModified").SetText("2017-06-30T18:52:34.000Z");
+        contents.CreateChildElement("ETag").SetText("\"fba9dede5f27731c9771645a39863328\"");
+        contents.CreateChildElement("Size").SetText("43" + index);
+        contents.CreateChildElement("StorageClass").SetText("STANDARD");
+    }
+    return document;
+}
+
+AWS_BENCHMARK(Xml, ParseListBucketResult)
+{
+    const Aws::String payload = BuildListBucketResult().ConvertToString();
+    state.SetBytesPerIteration(payload.size());
+    while (state.KeepRunning())
+    {
+        XmlDocument document = XmlDocument::CreateFromXmlString(payload);
+        Aws::Benchmarks::DoNotOptimize(document);
+    }
+}
+
+AWS_BENCHMARK(Xml, ParseAndReadListBucketResult)
+{
+    const Aws::String payload = BuildListBucketResult().ConvertToString();
+    state.SetBytesPerIteration(payload.size());
+    while (state.KeepRunning())
+    {
+        XmlDocument document = XmlDocument::CreateFromXmlString(payload);
+        XmlNode contents = document.GetRootElement().FirstChild("Contents");
+        while (!contents.IsNull())
+        {
+            Aws::String key = contents.FirstChild("Key").GetText();
+            Aws::Benchmarks::DoNotOptimize(key);
+            contents = contents.NextNode("Contents");
+        }
+    }
+}
+
+AWS_BENCHMARK(Xml, ConvertListBucketResultToString)
+{
+    const XmlDocument document = BuildListBucketResult();
+    state.SetBytesPerIteration(document.ConvertToString().size());
+    while (state.KeepRunning())
+    {
+        Aws::String payload = document.ConvertToString();
+        Aws::Benchmarks::DoNotOptimize(payload);
+    }
+}
@@ -19,6 +19,7 @@
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/client/RequestTracer.h>
 #include <aws/core/AmazonWebServiceRequest.h>
 #include <aws/core/auth/AWSAuthSigner.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
@@ -146,6 +147,20 @@ protected:
     }
 };
 
+class RecordingRequestTracer : public Aws::Client::RequestTracer
+{
+public:
+    void OnTraceEvent(const RequestTraceEvent& event) override
+    {
+        ASSERT_GE(event.duration.count(), 0);
+        m_requestNames.push_back(event.requestName);
+        m_stages.push_back(event.stage);
+    }
+
+    Aws::Vector<Aws::String> m_requestNames;
+    Aws::Vector<RequestTraceStage> m_stages;
+};
+
 class AWSClientTestSuite : public ::testing::Test
 {
 protected:
@@ -285,6 +300,40 @@ TEST_F(AWSClientTestSuite, TestClockChangesAfterSkewHasBeenSet)
     ASSERT_EQ(1, client->GetRequestAttemptedRetries());
 }
 
+TEST_F(AWSClientTestSuite, TestRequestTracerReceivesEveryStageOfEveryAttempt)
+{
+    auto requestTracer = Aws::MakeShared<RecordingRequestTracer>(ALLOCATION_TAG);
+    ClientConfiguration config;
+    config.scheme = Scheme::HTTP;
+    config.retryStrategy = Aws::MakeShared<CountedRetryStrategy>(ALLOCATION_TAG);
+    config.requestTracer = requestTracer;
+    MockAWSClient tracedClient(config);
+
+    // the first attempt gets no response at all, which is retryable
+    mockHttpClient->AddResponseToReturn(nullptr);
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    AmazonWebServiceRequestMock request;
+    auto outcome = tracedClient.MakeRequest(request);
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(1, tracedClient.GetRequestAttemptedRetries());
+
+    // the mock http client doesn't measure anything, so only the client side stages are reported
+    Aws::Vector<RequestTraceStage> expectedStages = {
+        RequestTraceStage::Serialization, RequestTraceStage::CredentialsFetch, RequestTraceStage::Signing, RequestTraceStage::Attempt,
+        RequestTraceStage::ResponseParse, RequestTraceStage::RetrySleep,
+        RequestTraceStage::Serialization, RequestTraceStage::CredentialsFetch, RequestTraceStage::Signing, RequestTraceStage::Attempt };
+    ASSERT_EQ(expectedStages, requestTracer->m_stages);
+    for (const auto& requestName : requestTracer->m_requestNames)
+    {
+        ASSERT_STREQ("AmazonWebServiceRequestMock", requestName.c_str());
+    }
+
+    // nothing is traced by clients configured without a tracer
+    QueueMockResponse(HttpResponseCode::OK, HeaderValueCollection());
+    ASSERT_TRUE(client->MakeRequest(request).IsSuccess());
+    ASSERT_EQ(expectedStages.size(), requestTracer->m_stages.size());
+}
+
 TEST(AWSClientTest, TestBuildHttpRequestWithHeadersOnly)
 {
     HeaderValueCollection headerValues;
@@ -19,6 +19,18 @@
 #include <aws/core/http/HttpClientFactory.h>
 #include <aws/core/http/HttpClient.h>
 #include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/ratelimiter/BandwidthGovernor.h>
+#include <aws/core/utils/StringUtils.h>
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#endif
 
 using namespace Aws::Http;
 TEST(HttpClientTest, TestNullResponse)
@@ -31,3 +43,170 @@ TEST(HttpClientTest, TestNullResponse)
 }
 
 
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+static const char* HTTP_CLIENT_TEST_TAG = "HttpClientTest";
+
+/**
+ * Serves one request on a loopback port as fast as the socket lets it: it reads the request, including a body of
+ * requestBodySize bytes, and answers with a body of responseBodySize bytes.
+ */
+class LoopbackHttpServer
+{
+public:
+    LoopbackHttpServer(size_t requestBodySize, size_t responseBodySize) : m_socket(-1), m_port(0)
+    {
+        m_socket = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if (m_socket < 0 || bind(m_socket, reinterpret_cast<sockaddr*>(&address), length) != 0 || listen(m_socket, 1) != 0 ||
+            getsockname(m_socket, reinterpret_cast<sockaddr*>(&address), &length) != 0)
+        {
+            return;
+        }
+        m_port = ntohs(address.sin_port);
+        m_thread = std::thread([this, requestBodySize, responseBodySize] { Serve(requestBodySize, responseBodySize); });
+    }
+
+    ~LoopbackHttpServer()
+    {
+        if (m_socket >= 0)
+        {
+            // wakes up an accept still waiting if the client never connected
+            shutdown(m_socket, SHUT_RDWR);
+        }
+        if (m_thread.joinable())
+        {
+            m_thread.join();
+        }
+        if (m_socket >= 0)
+        {
+            close(m_socket);
+        }
+    }
+
+    Aws::String GetUri() const
+    {
+        return "http://127.0.0.1:" + Aws::Utils::StringUtils::to_string(m_port) + "/";
+    }
+
+    unsigned short GetPort() const { return m_port; }
+
+private:
+    void Serve(size_t requestBodySize, size_t responseBodySize)
+    {
+        int connection = accept(m_socket, nullptr, nullptr);
+        if (connection < 0)
+        {
+            return;
+        }
+
+        Aws::String received;
+        char buffer[16384];
+        size_t headerEnd = Aws::String::npos;
+        while (headerEnd == Aws::String::npos || received.size() < headerEnd + 4 + requestBodySize)
+        {
+            ssize_t count = recv(connection, buffer, sizeof(buffer), 0);
+            if (count <= 0)
+            {
+                close(connection);
+                return;
+            }
+            received.append(buffer, static_cast<size_t>(count));
+            if (headerEnd == Aws::String::npos)
+            {
+                headerEnd = received.find("\r\n\r\n");
+                // curl waits a second for the go ahead of a request with Expect: 100-continue
+                if (headerEnd != Aws::String::npos && Aws::Utils::StringUtils::ToLower(received.substr(0, headerEnd).c_str()).find("expect: 100-continue") != Aws::String::npos)
+                {
+                    static const char continueResponse[] = "HTTP/1.1 100 Continue\r\n\r\n";
+                    send(connection, continueResponse, sizeof(continueResponse) - 1, MSG_NOSIGNAL);
+                }
+            }
+        }
+
+        Aws::String response = "HTTP/1.1 200 OK\r\nContent-Length: " + Aws::Utils::StringUtils::to_string(responseBodySize) +
+            "\r\nConnection: close\r\n\r\n";
+        response.append(responseBodySize, 'x');
+        for (size_t sent = 0; sent < response.size(); )
+        {
+            ssize_t count = send(connection, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (count <= 0)
+            {
+                break;
+            }
+            sent += static_cast<size_t>(count);
+        }
+        close(connection);
+    }
+
+    int m_socket;
+    unsigned short m_port;
+    std::thread m_thread;
+};
+
+static const int64_t PACED_BYTES_PER_SECOND = 256 * 1024;
+static const int64_t PACED_BURST_BYTES = 16 * 1024;
+static const size_t PACED_BODY_SIZE = 384 * 1024;
+
+// The time a paced transfer of PACED_BODY_SIZE bytes should take is (PACED_BODY_SIZE - PACED_BURST_BYTES) / PACED_BYTES_PER_SECOND,
+// about 1.4 seconds. The transfer must neither beat the rate nor fall far behind it.
+static void AssertPacedAtConfiguredRate(std::chrono::steady_clock::duration elapsed)
+{
+    double seconds = std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() / 1000.0;
+    double expected = static_cast<double>(PACED_BODY_SIZE - PACED_BURST_BYTES) / PACED_BYTES_PER_SECOND;
+    ASSERT_GE(seconds, expected * 0.9);
+    ASSERT_LE(seconds, expected * 1.5 + 0.5);
+}
+
+TEST(HttpClientTest, TestReadRateLimiterPacesDownloadAtItsRate)
+{
+    LoopbackHttpServer server(0, PACED_BODY_SIZE);
+    ASSERT_NE(0, server.GetPort());
+
+    Aws::Client::ClientConfiguration config;
+    config.requestTimeoutMs = 30000;
+    auto httpClient = CreateHttpClient(config);
+    Aws::Utils::RateLimits::BandwidthGovernor governor(PACED_BYTES_PER_SECOND, nullptr, PACED_BURST_BYTES);
+
+    auto request = CreateHttpRequest(server.GetUri(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto start = std::chrono::steady_clock::now();
+    auto response = httpClient->MakeRequest(request, &governor, nullptr);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    response->GetResponseBody().seekg(0, std::ios_base::end);
+    ASSERT_EQ(static_cast<std::streamoff>(PACED_BODY_SIZE), static_cast<std::streamoff>(response->GetResponseBody().tellg()));
+    AssertPacedAtConfiguredRate(elapsed);
+}
+
+TEST(HttpClientTest, TestWriteRateLimiterPacesUploadAtItsRate)
+{
+    LoopbackHttpServer server(PACED_BODY_SIZE, 0);
+    ASSERT_NE(0, server.GetPort());
+
+    Aws::Client::ClientConfiguration config;
+    config.requestTimeoutMs = 30000;
+    auto httpClient = CreateHttpClient(config);
+    // the request's headers are charged too, they fit in the burst
+    Aws::Utils::RateLimits::BandwidthGovernor governor(PACED_BYTES_PER_SECOND, nullptr, PACED_BURST_BYTES);
+
+    auto request = CreateHttpRequest(server.GetUri(), HttpMethod::HTTP_PUT, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto body = Aws::MakeShared<Aws::StringStream>(HTTP_CLIENT_TEST_TAG, Aws::String(PACED_BODY_SIZE, 'x'));
+    request->AddContentBody(body);
+    request->SetContentLength(Aws::Utils::StringUtils::to_string(PACED_BODY_SIZE));
+    auto start = std::chrono::steady_clock::now();
+    auto response = httpClient->MakeRequest(request, nullptr, &governor);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    AssertPacedAtConfiguredRate(elapsed);
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/http/HttpHeaderCollection.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+
+TEST(HttpHeaderCollectionTest, TestNamesAreLowerCasedAndTrimmedOnSet)
+{
+    HttpHeaderCollection headers;
+    headers.Set(" Content-Type ", "  application/json \r\n");
+
+    ASSERT_EQ(1u, headers.size());
+    ASSERT_EQ("content-type", headers.begin()->first);
+    ASSERT_EQ("application/json", headers.begin()->second);
+}
+
+TEST(HttpHeaderCollectionTest, TestLookupIsCaseInsensitive)
+{
+    HttpHeaderCollection headers;
+    headers.Set("X-Amz-Date", "20170630T120000Z");
+
+    ASSERT_TRUE(headers.Contains("x-amz-date"));
+    ASSERT_TRUE(headers.Contains("X-AMZ-DATE"));
+    ASSERT_FALSE(headers.Contains("x-amz-date2"));
+    ASSERT_FALSE(headers.Contains("x-amz-dat"));
+    ASSERT_EQ(nullptr, headers.Find("host"));
+
+    const Aws::String* value = headers.Find(Aws::String("x-AMZ-date"));
+    ASSERT_NE(nullptr, value);
+    ASSERT_EQ("20170630T120000Z", *value);
+}
+
+TEST(HttpHeaderCollectionTest, TestSetReplacesValueOfExistingHeader)
+{
+    HttpHeaderCollection headers;
+    headers.Set("host", "s3.amazonaws.com");
+    headers.Set("Range", "bytes=0-9");
+    headers.Set("HOST", "s3.us-west-2.amazonaws.com");
+
+    ASSERT_EQ(2u, headers.size());
+    ASSERT_EQ("host", headers.begin()->first);
+    ASSERT_EQ("s3.us-west-2.amazonaws.com", *headers.Find("host"));
+}
+
+TEST(HttpHeaderCollectionTest, TestEraseAndClear)
+{
+    HttpHeaderCollection headers;
+    headers.Set("host", "s3.amazonaws.com");
+    headers.Set("range", "bytes=0-9");
+    headers.Set("content-md5", "CY9rzUYh03PK3k6DJie09g==");
+
+    ASSERT_TRUE(headers.Erase("Range"));
+    ASSERT_FALSE(headers.Erase("range"));
+    ASSERT_EQ(2u, headers.size());
+    ASSERT_FALSE(headers.Contains("range"));
+    ASSERT_TRUE(headers.Contains("host"));
+    ASSERT_TRUE(headers.Contains("content-md5"));
+
+    HeaderValueCollection headerMap = headers.ToHeaderValueCollection();
+    ASSERT_EQ(2u, headerMap.size());
+    ASSERT_EQ("CY9rzUYh03PK3k6DJie09g==", headerMap["content-md5"]);
+
+    headers.Clear();
+    ASSERT_TRUE(headers.empty());
+    ASSERT_EQ(headers.begin(), headers.end());
+}
+
+TEST(HttpHeaderCollectionTest, TestStandardRequestAndResponseLookupsIgnoreCase)
+{
+    StandardHttpRequest request(URI("https://s3.amazonaws.com/bucket/key"), HttpMethod::HTTP_GET);
+    request.SetHeaderValue("X-Amz-Security-Token", "token");
+
+    ASSERT_EQ("token", request.GetHeaderValue("x-amz-security-token"));
+    ASSERT_EQ("token", request.GetHeaderValue("X-AMZ-SECURITY-TOKEN"));
+    ASSERT_EQ("", request.GetHeaderValue("x-amz-date"));
+    ASSERT_TRUE(request.HasHeader("Host"));
+    ASSERT_EQ(2u, request.GetHeaderCollection().size());
+    request.DeleteHeader("X-AMZ-SECURITY-TOKEN");
+    ASSERT_FALSE(request.HasHeader("x-amz-security-token"));
+
+    request.SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    StandardHttpResponse response(request);
+    response.AddHeader("ETag", "\"d41d8cd98f00b204e9800998ecf8427e\"");
+    ASSERT_TRUE(response.HasHeader("etag"));
+    ASSERT_EQ("\"d41d8cd98f00b204e9800998ecf8427e\"", response.GetHeader("ETAG"));
+    ASSERT_EQ("", response.GetHeader("content-length"));
+}
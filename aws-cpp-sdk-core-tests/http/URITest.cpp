@@ -230,3 +230,21 @@ TEST(URITest, TestGetRFC3986URLEncodedPath)
     uri = "https://test.com/ሴ";
     EXPECT_STREQ("/%E1%88%B4", URI::URLEncodePathRFC3986(uri.GetPath()).c_str());
 }
+
+TEST(URITest, TestGetURIStringOfAppendedPath)
+{
+    // generated clients append the operation's path to the path of the endpoint
+    URI jsonUri = "https://dynamodb.us-east-1.amazonaws.com";
+    jsonUri.SetPath(jsonUri.GetPath() + "/");
+    EXPECT_STREQ("https://dynamodb.us-east-1.amazonaws.com/", jsonUri.GetURIString().c_str());
+
+    URI restUri = "http://localhost:8000";
+    restUri.SetPath(restUri.GetPath() + "/bucket/" + "key with spaces+plus/ሴ");
+    restUri.AddQueryStringParameter("uploads", "");
+    EXPECT_STREQ("http://localhost:8000/bucket/key%20with%20spaces%2Bplus/%E1%88%B4?uploads=", restUri.GetURIString().c_str());
+    EXPECT_STREQ("http://localhost:8000/bucket/key%20with%20spaces%2Bplus/%E1%88%B4", restUri.GetURIString(false).c_str());
+
+    URI emptySegmentsUri = "https://s3.amazonaws.com";
+    emptySegmentsUri.SetPath(emptySegmentsUri.GetPath() + "//a//b/");
+    EXPECT_STREQ("https://s3.amazonaws.com/a/b/", emptySegmentsUri.GetURIString().c_str());
+}
@@ -29,6 +29,23 @@ TEST(EnumOverflowTest, TestHashRetrieval)
    ASSERT_EQ("", container.RetrieveOverflow(17));
 }
 
+TEST(EnumOverflowTest, TestStoredValuesStayInPlace)
+{
+    EnumParseOverflowContainer container;
+    container.StoreOverflow(15, "fifteen");
+    const char* name = container.RetrieveOverflow(15).c_str();
+
+    container.StoreOverflow(15, "fifteen");
+    container.StoreOverflow(15, "another value with the same hash");
+    for (int hashCode = 0; hashCode < 100; ++hashCode)
+    {
+        container.StoreOverflow(hashCode, "value");
+    }
+
+    ASSERT_EQ(name, container.RetrieveOverflow(15).c_str());
+    ASSERT_STREQ("fifteen", name);
+}
+
 enum class TestEnum
 {
     VALUE1,
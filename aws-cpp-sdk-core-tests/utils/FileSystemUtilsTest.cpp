@@ -15,6 +15,7 @@
 
 #include <aws/core/platform/FileSystem.h>
 #include <aws/core/utils/FileSystemUtils.h>
+#include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/memory/stl/AWSSet.h>
 #include <aws/external/gtest.h>
 #include <fstream>
@@ -160,6 +161,19 @@ TEST_F(DirectoryTreeTest, TestManualDirectoryTraversal)
     ASSERT_FALSE(entry.operator bool());
 }
 
+TEST_F(DirectoryTreeTest, TestDirectoryEntryLastModified)
+{
+    // files were written in SetUp, modification times have a resolution of a second on some platforms
+    auto now = Aws::Utils::DateTime::Now().Millis();
+    auto dir = Aws::FileSystem::OpenDirectory(dir2);
+    ASSERT_TRUE(dir->operator bool());
+
+    auto entry = dir->Next();
+    ASSERT_EQ(Aws::FileSystem::FileType::File, entry.fileType);
+    ASSERT_LE(entry.lastModified, now);
+    ASSERT_GT(entry.lastModified, now - 60 * 1000);
+}
+
 TEST_F(DirectoryTreeTest, TestDirectoryTreeDepthFirstTraversal)
 {
     Aws::FileSystem::DirectoryTree tree(dir1);
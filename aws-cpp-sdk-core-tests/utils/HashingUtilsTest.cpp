@@ -16,6 +16,8 @@
 #include <aws/external/gtest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/Sha256TreeHash.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 
 
@@ -247,6 +249,45 @@ TEST(HashingUtilsTest, TestSHA256TreeHashFromStreamWhenSizeMoreThanOneMB)
     EXPECT_STREQ("ff9ea39186cb33cd5ade7aca078e297a1622f8c1abdd4cc47bcbf66dc5877e1f", HashingUtils::HexEncode(HashingUtils::CalculateSHA256TreeHash(EightMBStream)).c_str());
 }
 
+TEST(HashingUtilsTest, TestSHA256TreeHashOnExecutor)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(4);
+    Aws::String FivePointFiveMBStr(5767168, '0');
+    const unsigned char* buffer = reinterpret_cast<const unsigned char*>(FivePointFiveMBStr.c_str());
+
+    EXPECT_STREQ("154e26c78fd74d0c2c9b3cc4644191619dc4f2cd539ae2a74d5fd07957a3ee6a",
+        HashingUtils::HexEncode(Crypto::Sha256TreeHash::Calculate(buffer, FivePointFiveMBStr.size(), &executor)).c_str());
+
+    // feed the data in pieces that do not line up with leaf boundaries
+    Crypto::Sha256TreeHash treeHash(&executor);
+    size_t pos = 0;
+    size_t pieceSize = 1;
+    while (pos < FivePointFiveMBStr.size())
+    {
+        size_t length = (std::min)(pieceSize, FivePointFiveMBStr.size() - pos);
+        treeHash.Update(buffer + pos, length);
+        pos += length;
+        pieceSize = pieceSize * 7 + 3;
+    }
+    EXPECT_STREQ("154e26c78fd74d0c2c9b3cc4644191619dc4f2cd539ae2a74d5fd07957a3ee6a", HashingUtils::HexEncode(treeHash.GetResult()).c_str());
+
+    treeHash.Reset();
+    EXPECT_STREQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256("")).c_str(), HashingUtils::HexEncode(treeHash.GetResult()).c_str());
+}
+
+TEST(HashingUtilsTest, TestSHA256TreeHashCombineParts)
+{
+    // tree hashes of 2MB parts of an 8MB archive combine into the tree hash of the archive
+    Aws::String TwoMBStr(1024 * 1024 * 2, '0');
+    Aws::Vector<ByteBuffer> partHashes(4, HashingUtils::CalculateSHA256TreeHash(TwoMBStr));
+    EXPECT_STREQ("ff9ea39186cb33cd5ade7aca078e297a1622f8c1abdd4cc47bcbf66dc5877e1f", HashingUtils::HexEncode(Crypto::Sha256TreeHash::CombineTreeHashes(partHashes)).c_str());
+
+    // last part smaller than the others
+    partHashes.resize(2);
+    partHashes.push_back(HashingUtils::CalculateSHA256TreeHash(Aws::String(1024 * 1024 * 3 / 2, '0')));
+    EXPECT_STREQ("154e26c78fd74d0c2c9b3cc4644191619dc4f2cd539ae2a74d5fd07957a3ee6a", HashingUtils::HexEncode(Crypto::Sha256TreeHash::CombineTreeHashes(partHashes)).c_str());
+}
+
 static void TestMD5FromString(const char* value, const char* expectedBase64Hash)
 {
     Aws::String source(value);
@@ -318,3 +359,20 @@ TEST(HashingUtilsTest, TestMD5FromStream)
     TestMD5FromStream( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", "V+30oivjyVWsSdouIQe2eg==" );
 }
 
+
+TEST(HashingUtilsTest, TestCompileTimeHashStringMatchesHashString)
+{
+    static_assert(HashingUtils::CompileTimeHashString("STANDARD") == 2095255229, "CompileTimeHashString should be evaluated at compile time");
+    static constexpr int OVERFLOWING_HASH = HashingUtils::CompileTimeHashString("InvalidSignatureException");
+
+    // the same values as at runtime, including once the hash wrapped around
+    Aws::String standard("STANDARD");
+    Aws::String invalidSignature("InvalidSignatureException");
+    ASSERT_EQ(2095255229, HashingUtils::HashString(standard.c_str()));
+    ASSERT_EQ(-1467169618, OVERFLOWING_HASH);
+    ASSERT_EQ(OVERFLOWING_HASH, HashingUtils::HashString(invalidSignature.c_str()));
+    ASSERT_EQ(0, HashingUtils::HashString(""));
+    ASSERT_EQ(0, HashingUtils::HashString(nullptr));
+    ASSERT_EQ(0, HashingUtils::CompileTimeHashString(""));
+    ASSERT_EQ(0, HashingUtils::CompileTimeHashString(nullptr));
+}
@@ -19,6 +19,7 @@
 #include <aws/core/utils/crypto/CryptoStream.h>
 #include <aws/core/utils/memory/stl/AWSQueue.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/crypto/Factories.h>
 
@@ -725,6 +726,82 @@ TEST(CryptoStreamsTest, TestLiveSymmetricCipher)
         ASSERT_STREQ(data_raw.c_str(), plainTextOutput.c_str());
     }
 }
+
+// buffer sizes that aren't a multiple of the block size, so that CBC holds back partial blocks and CTR and GCM work in place
+static void TestLiveCipherStreamsRoundTrip(const std::function<std::shared_ptr<SymmetricCipher>(const CryptoBuffer&, const CryptoBuffer&, const CryptoBuffer&)>& createCipher,
+    size_t ivLength)
+{
+    const size_t dataLength = 100000;
+    CryptoBuffer plainText(dataLength);
+    for (size_t i = 0; i < dataLength; ++i)
+    {
+        plainText[i] = static_cast<unsigned char>(i * 31 + 7);
+    }
+    CryptoBuffer key = SymmetricCipher::GenerateKey();
+    CryptoBuffer iv = SymmetricCipher::GenerateIV(ivLength);
+
+    auto expectedCipher = createCipher(key, iv, CryptoBuffer());
+    CryptoBuffer expectedBody = expectedCipher->EncryptBuffer(plainText);
+    CryptoBuffer expectedFinal = expectedCipher->FinalizeEncryption();
+    CryptoBuffer expected({&expectedBody, &expectedFinal});
+
+    auto encryptor = createCipher(key, iv, CryptoBuffer());
+    Aws::StringStream is;
+    is.write(reinterpret_cast<const char*>(plainText.GetUnderlyingData()), plainText.GetLength());
+    Aws::String encrypted;
+    {
+        SymmetricCryptoStream stream(static_cast<Aws::IStream&>(is), CipherMode::Encrypt, *encryptor, 1000);
+        char chunk[777];
+        while (stream)
+        {
+            stream.read(chunk, sizeof(chunk));
+            encrypted.append(chunk, static_cast<size_t>(stream.gcount()));
+        }
+    }
+    ASSERT_EQ(expected.GetLength(), encrypted.size());
+    ASSERT_EQ(0, memcmp(expected.GetUnderlyingData(), encrypted.c_str(), encrypted.size()));
+    ASSERT_EQ(expectedCipher->GetTag(), encryptor->GetTag());
+
+    auto decryptor = createCipher(key, iv, encryptor->GetTag());
+    Aws::StringStream os;
+    {
+        SymmetricCryptoStream stream(static_cast<Aws::OStream&>(os), CipherMode::Decrypt, *decryptor, 1000);
+        for (size_t written = 0; written < encrypted.size(); written += 333)
+        {
+            stream.write(encrypted.c_str() + written, (std::min)(static_cast<size_t>(333), encrypted.size() - written));
+        }
+        stream.Finalize();
+    }
+    ASSERT_TRUE(*decryptor);
+    Aws::String decrypted = os.str();
+    ASSERT_EQ(dataLength, decrypted.size());
+    ASSERT_EQ(0, memcmp(plainText.GetUnderlyingData(), decrypted.c_str(), dataLength));
+}
+
+TEST(CryptoStreamsTest, TestLiveCipherStreamsRoundTrip)
+{
+    TestLiveCipherStreamsRoundTrip([](const CryptoBuffer& key, const CryptoBuffer& iv, const CryptoBuffer&) { return CreateAES_CBCImplementation(key, iv); }, 16);
+    TestLiveCipherStreamsRoundTrip([](const CryptoBuffer& key, const CryptoBuffer& iv, const CryptoBuffer&) { return CreateAES_CTRImplementation(key, iv); }, 16);
+    TestLiveCipherStreamsRoundTrip([](const CryptoBuffer& key, const CryptoBuffer& iv, const CryptoBuffer& tag) { return CreateAES_GCMImplementation(key, iv, tag); }, 12);
+}
 #endif
 
+// a cipher without its own EncryptInto() can return more than fits in the buffer, which then has to grow
+TEST(CryptoStreamsTest, TestEncryptIntoGrowsBufferForDefaultImplementation)
+{
+    MockSymmetricCipher cipher;
+    cipher.QueueEncryptDecryptResponse(CryptoBuffer((unsigned char*)TEST_RESPONSE_1, strlen(TEST_RESPONSE_1)));
+
+    CryptoBuffer output(4);
+    output[0] = 'A';
+    size_t outputLength = 0;
+    const unsigned char input[2] = { 'x', 'y' };
+    ASSERT_TRUE(cipher.EncryptInto(input, sizeof(input), output, 1, outputLength));
+    ASSERT_EQ(strlen(TEST_RESPONSE_1), outputLength);
+    ASSERT_EQ(1 + outputLength, output.GetLength());
+    ASSERT_EQ('A', output[0]);
+    ASSERT_EQ(0, memcmp(TEST_RESPONSE_1, output.GetUnderlyingData() + 1, outputLength));
+    ASSERT_EQ(1u, cipher.m_encryptCalledCount);
+}
+
 #endif // NO_SYMMETRIC_ENCRYPTION
@@ -0,0 +1,166 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/memory/PooledMemorySystem.h>
+
+#include <cstring>
+#include <thread>
+
+using namespace Aws::Utils::Memory;
+
+static const char SMALL_TAG[] = "PooledMemorySystemTestSmall";
+static const char LARGE_TAG[] = "PooledMemorySystemTestLarge";
+
+static const AllocationTagStats* FindStats(const Aws::Vector<AllocationTagStats>& stats, const char* tag)
+{
+    for (const auto& tagStats : stats)
+    {
+        if (strcmp(tagStats.allocationTag, tag) == 0)
+        {
+            return &tagStats;
+        }
+    }
+    return nullptr;
+}
+
+TEST(PooledMemorySystemTest, TestAllocateAndReuse)
+{
+    PooledMemorySystem memorySystem;
+
+    void* first = memorySystem.AllocateMemory(24, 1, SMALL_TAG);
+    ASSERT_NE(nullptr, first);
+    ASSERT_EQ(0u, reinterpret_cast<size_t>(first) % 16);
+    memset(first, 0xAB, 24);
+    memorySystem.FreeMemory(first);
+
+    // same size class, same thread: the block is handed out again
+    void* second = memorySystem.AllocateMemory(32, 1, SMALL_TAG);
+    ASSERT_EQ(first, second);
+    memorySystem.FreeMemory(second);
+
+    void* large = memorySystem.AllocateMemory(1024 * 1024, 1, LARGE_TAG);
+    ASSERT_NE(nullptr, large);
+    memset(large, 0xCD, 1024 * 1024);
+    memorySystem.FreeMemory(large);
+
+    void* aligned = memorySystem.AllocateMemory(100, 64, SMALL_TAG);
+    ASSERT_EQ(0u, reinterpret_cast<size_t>(aligned) % 64);
+    memorySystem.FreeMemory(aligned);
+
+    memorySystem.FreeMemory(nullptr);
+    ASSERT_TRUE(memorySystem.GetAllocationTagStats().empty());
+}
+
+TEST(PooledMemorySystemTest, TestCrossThreadFree)
+{
+    PooledMemorySystem memorySystem(true);
+    const size_t allocationCount = 1000;
+    Aws::Vector<void*> blocks(allocationCount);
+
+    std::thread producer([&]()
+    {
+        for (size_t i = 0; i < allocationCount; ++i)
+        {
+            blocks[i] = memorySystem.AllocateMemory(16 + i % 200, 1, SMALL_TAG);
+            memset(blocks[i], static_cast<int>(i), 16 + i % 200);
+        }
+    });
+    producer.join();
+
+    // the producer exited, its pools are handed over to the next thread that needs one
+    std::thread consumer([&]()
+    {
+        for (size_t i = 0; i < allocationCount; ++i)
+        {
+            memorySystem.FreeMemory(blocks[i]);
+        }
+        for (size_t i = 0; i < allocationCount; ++i)
+        {
+            blocks[i] = memorySystem.AllocateMemory(16 + i % 200, 1, SMALL_TAG);
+        }
+    });
+    consumer.join();
+
+    for (size_t i = 0; i < allocationCount; ++i)
+    {
+        memorySystem.FreeMemory(blocks[i]);
+    }
+
+    auto stats = memorySystem.GetAllocationTagStats();
+    const AllocationTagStats* smallStats = FindStats(stats, SMALL_TAG);
+    ASSERT_NE(nullptr, smallStats);
+    ASSERT_EQ(2 * allocationCount, smallStats->allocationCount);
+    ASSERT_EQ(2 * allocationCount, smallStats->freeCount);
+    ASSERT_EQ(0u, smallStats->bytesInUse);
+}
+
+TEST(PooledMemorySystemTest, TestSwitchingMemorySystemsGivesTheCacheBack)
+{
+    PooledMemorySystem firstSystem;
+    PooledMemorySystem secondSystem;
+    std::thread worker([&]()
+    {
+        void* freed = firstSystem.AllocateMemory(24, 1, SMALL_TAG);
+        firstSystem.FreeMemory(freed);
+        secondSystem.FreeMemory(secondSystem.AllocateMemory(24, 1, SMALL_TAG));
+
+        // the worker moved on to the second system, so the next thread allocating from the first adopts its cache
+        std::thread other([&]()
+        {
+            void* reused = firstSystem.AllocateMemory(24, 1, SMALL_TAG);
+            ASSERT_EQ(freed, reused);
+            firstSystem.FreeMemory(reused);
+        });
+        other.join();
+    });
+    worker.join();
+}
+
+TEST(PooledMemorySystemTest, TestArena)
+{
+    PooledMemorySystem memorySystem(true);
+    MemoryArena arena(4096);
+    Aws::Vector<void*> blocks;
+    {
+        ScopedMemoryArena scope(arena);
+        for (size_t i = 0; i < 100; ++i)
+        {
+            void* block = memorySystem.AllocateMemory(100, 1, SMALL_TAG);
+            ASSERT_EQ(0u, reinterpret_cast<size_t>(block) % 16);
+            memset(block, 0xEF, 100);
+            blocks.push_back(block);
+        }
+        void* large = memorySystem.AllocateMemory(16 * 1024, 1, LARGE_TAG);
+        memset(large, 0xEF, 16 * 1024);
+        memorySystem.FreeMemory(large);
+    }
+    ASSERT_GE(arena.GetReservedBytes(), 100u * 100u + 16u * 1024u);
+
+    for (auto block : blocks)
+    {
+        memorySystem.FreeMemory(block);
+    }
+
+    auto stats = memorySystem.GetAllocationTagStats();
+    const AllocationTagStats* smallStats = FindStats(stats, SMALL_TAG);
+    ASSERT_NE(nullptr, smallStats);
+    ASSERT_EQ(100u, smallStats->allocationCount);
+    ASSERT_EQ(100u * 100u, smallStats->bytesAllocated);
+    ASSERT_EQ(0u, smallStats->bytesInUse);
+    const AllocationTagStats* largeStats = FindStats(stats, LARGE_TAG);
+    ASSERT_NE(nullptr, largeStats);
+    ASSERT_EQ(1u, largeStats->allocationCount);
+}
@@ -0,0 +1,137 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+
+#include <aws/core/utils/ratelimiter/BandwidthGovernor.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <thread>
+
+using namespace Aws::Utils::RateLimits;
+
+static const char* ALLOCATION_TAG = "BandwidthGovernorTest";
+
+class BandwidthGovernorTest : public ::testing::Test {
+
+    public:
+
+        static BandwidthGovernor::ClockType::time_point m_currentTime;
+
+        static BandwidthGovernor::ClockType::time_point GetTestTime() { return m_currentTime; }
+
+        static void SetMillisecondsElapsed(int64_t millisecondsElapsed)
+        {
+            m_currentTime = BandwidthGovernor::ClockType::time_point(std::chrono::milliseconds(millisecondsElapsed));
+        }
+
+    protected:
+
+        void SetUp()
+        {
+            SetMillisecondsElapsed(0);
+        }
+
+};
+
+BandwidthGovernor::ClockType::time_point BandwidthGovernorTest::m_currentTime;
+
+TEST_F(BandwidthGovernorTest, TestBurstGoesThroughWithoutDelay)
+{
+    BandwidthGovernor governor(10, nullptr, 0, BandwidthGovernorTest::GetTestTime);
+
+    ASSERT_EQ(0, governor.ApplyCost(0).count());
+    ASSERT_EQ(0, governor.ApplyCost(4).count());
+    ASSERT_EQ(0, governor.ApplyCost(6).count());
+
+    // the burst defaults to one second worth of bytes; everything past it is paced
+    ASSERT_EQ(500, governor.ApplyCost(5).count());
+    ASSERT_EQ(1000, governor.ApplyCost(5).count());
+}
+
+TEST_F(BandwidthGovernorTest, TestIdleTimeRefillsUpToBurst)
+{
+    BandwidthGovernor governor(10, nullptr, 20, BandwidthGovernorTest::GetTestTime);
+
+    ASSERT_EQ(0, governor.ApplyCost(20).count());
+    ASSERT_EQ(1000, governor.ApplyCost(10).count());
+
+    // debt paid and then some, but credit doesn't go beyond the burst
+    SetMillisecondsElapsed(10000);
+    ASSERT_EQ(0, governor.ApplyCost(20).count());
+    ASSERT_EQ(100, governor.ApplyCost(1).count());
+}
+
+TEST_F(BandwidthGovernorTest, TestChildWaitsForParent)
+{
+    auto parent = Aws::MakeShared<BandwidthGovernor>(ALLOCATION_TAG, 10, nullptr, 0, BandwidthGovernorTest::GetTestTime);
+    BandwidthGovernor first(100, parent, 0, BandwidthGovernorTest::GetTestTime);
+    BandwidthGovernor second(100, parent, 0, BandwidthGovernorTest::GetTestTime);
+
+    ASSERT_EQ(parent, first.GetParent());
+    ASSERT_EQ(0, first.ApplyCost(10).count());
+    // within its own budget, but the shared parent is spent
+    ASSERT_EQ(1000, second.ApplyCost(10).count());
+
+    // and the child's own budget still applies
+    BandwidthGovernor slowChild(1, parent, 0, BandwidthGovernorTest::GetTestTime);
+    SetMillisecondsElapsed(100000);
+    ASSERT_EQ(0, slowChild.ApplyCost(1).count());
+    ASSERT_EQ(2000, slowChild.ApplyCost(2).count());
+}
+
+TEST_F(BandwidthGovernorTest, TestSetRate)
+{
+    BandwidthGovernor governor(10, nullptr, 10, BandwidthGovernorTest::GetTestTime);
+
+    ASSERT_EQ(10, governor.GetRate());
+    ASSERT_EQ(0, governor.ApplyCost(10).count());
+    ASSERT_EQ(1000, governor.ApplyCost(10).count());
+
+    // what's owed is kept, and the burst shrinks to 10 bytes at the new rate...
+    governor.SetRate(100);
+    ASSERT_EQ(100, governor.GetRate());
+    ASSERT_EQ(2000, governor.ApplyCost(10).count());
+
+    // ...unless reset
+    governor.SetRate(100, true);
+    ASSERT_EQ(0, governor.ApplyCost(10).count());
+    ASSERT_EQ(100, governor.ApplyCost(10).count());
+}
+
+TEST_F(BandwidthGovernorTest, TestConcurrentCallersShareTheBudget)
+{
+    BandwidthGovernor governor(1000, nullptr, 1000, BandwidthGovernorTest::GetTestTime);
+
+    Aws::Vector<std::thread> threads;
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&governor]()
+        {
+            for (unsigned j = 0; j < 250; ++j)
+            {
+                governor.ApplyCost(10);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // 10000 bytes charged, 1000 of them free: the next byte waits 9 seconds
+    ASSERT_EQ(9001, governor.ApplyCost(1).count());
+}
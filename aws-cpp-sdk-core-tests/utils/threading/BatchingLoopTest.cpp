@@ -0,0 +1,206 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/BatchingLoop.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <atomic>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+namespace
+{
+    /**
+     * Buffers numbers and sends them in batches of up to maxBatchSize, completing each batch on a thread of the executor by
+     * counting its numbers as completed.
+     */
+    class NumberBatcher : private BatchingLoop
+    {
+    public:
+        NumberBatcher(size_t maxBatchSize, size_t maxRequestsInFlight, std::atomic<size_t>& completed) :
+            BatchingLoop(maxRequestsInFlight), m_maxBatchSize(maxBatchSize), m_completed(completed), m_executor(4), m_maxInFlight(0), m_inFlight(0)
+        {
+            StartLoop();
+        }
+
+        ~NumberBatcher()
+        {
+            StopLoop();
+        }
+
+        void Put(int number)
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_pending.push_back(number);
+            if (m_pending.size() >= m_maxBatchSize)
+            {
+                m_signal.notify_all();
+            }
+        }
+
+        void FlushAndWait()
+        {
+            RequestFlush();
+            WaitUntilIdle();
+        }
+
+        Aws::Vector<Aws::Vector<int>> GetBatches() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_batches;
+        }
+
+        size_t GetMaxInFlight() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_maxInFlight;
+        }
+
+        BatchingMetrics GetMetrics() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            BatchingMetrics metrics;
+            CopyLoopMetrics(metrics);
+            return metrics;
+        }
+
+    private:
+        bool HasBufferedEntries() const override
+        {
+            return !m_pending.empty();
+        }
+
+        std::function<void()> TakeRequest(std::chrono::steady_clock::time_point, bool sendAll, WakeUpTime&) override
+        {
+            if (m_pending.empty() || (!sendAll && m_pending.size() < m_maxBatchSize))
+            {
+                return nullptr;
+            }
+
+            Aws::Vector<int> batch;
+            while (!m_pending.empty() && batch.size() < m_maxBatchSize)
+            {
+                batch.push_back(m_pending.front());
+                m_pending.pop_front();
+            }
+            m_batches.push_back(batch);
+            m_maxInFlight = (std::max)(m_maxInFlight, ++m_inFlight);
+            size_t numbers = batch.size();
+            return [this, numbers]() { m_executor.Submit([this, numbers]() { Complete(numbers); }); };
+        }
+
+        void Complete(size_t numbers)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            m_completed += numbers;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                --m_inFlight;
+            }
+            CompleteRequest();
+        }
+
+        size_t m_maxBatchSize;
+        std::atomic<size_t>& m_completed;
+        PooledThreadExecutor m_executor;
+        Aws::Deque<int> m_pending;
+        Aws::Vector<Aws::Vector<int>> m_batches;
+        size_t m_maxInFlight;
+        size_t m_inFlight;
+    };
+}
+
+TEST(BatchingLoop, RetryDelayStaysBetweenHalfAndAllOfTheBackoff)
+{
+    for (unsigned attempt = 1; attempt <= 8; ++attempt)
+    {
+        auto backoff = (std::min)(std::chrono::milliseconds(10 << (attempt - 1)), std::chrono::milliseconds(500));
+        Aws::Set<long long> delays;
+        for (int i = 0; i < 100; ++i)
+        {
+            auto delay = ComputeRetryDelay(attempt, std::chrono::milliseconds(10), std::chrono::milliseconds(500));
+            ASSERT_GE(delay, backoff - backoff / 2);
+            ASSERT_LE(delay, backoff);
+            delays.insert(delay.count());
+        }
+        // retries failed together don't all come back together
+        ASSERT_LT(1u, delays.size());
+    }
+}
+
+TEST(BatchingLoop, RetryQueueHandsBackDueEntriesLastFailedFirst)
+{
+    RetryQueue<int> retries(std::chrono::milliseconds(100), std::chrono::milliseconds(1000));
+    auto failedAt = std::chrono::steady_clock::now();
+    retries.Add(1, 1, failedAt);
+    retries.Add(2, 1, failedAt);
+    retries.Add(3, 1, failedAt);
+    retries.Add(4, 4, failedAt);
+
+    // entries failed together come back together, the later attempt after them
+    WakeUpTime wakeUp;
+    retries.AddWakeUp(wakeUp);
+    ASSERT_TRUE(wakeUp.IsSet());
+    Aws::Vector<int> requeued;
+    retries.TakeDue(wakeUp.Get(), [&requeued](int entry) { requeued.push_back(entry); });
+    Aws::Vector<int> expected = { 3, 2, 1 };
+    ASSERT_EQ(expected, requeued);
+    ASSERT_EQ(1u, retries.size());
+
+    retries.TakeDue(failedAt + std::chrono::milliseconds(800), [&requeued](int entry) { requeued.push_back(entry); });
+    ASSERT_EQ(4, requeued.back());
+    ASSERT_TRUE(retries.empty());
+}
+
+TEST(BatchingLoop, SendsFullBatchesAndFlushesTheRest)
+{
+    std::atomic<size_t> completed(0);
+    NumberBatcher batcher(10, 2, completed);
+    for (int i = 0; i < 45; ++i)
+    {
+        batcher.Put(i);
+    }
+    batcher.FlushAndWait();
+
+    auto batches = batcher.GetBatches();
+    ASSERT_EQ(5u, batches.size());
+    size_t numbers = 0;
+    for (const auto& batch : batches)
+    {
+        ASSERT_GE(10u, batch.size());
+        numbers += batch.size();
+    }
+    ASSERT_EQ(45u, numbers);
+    ASSERT_EQ(45u, completed.load());
+    ASSERT_GE(2u, batcher.GetMaxInFlight());
+
+    auto metrics = batcher.GetMetrics();
+    ASSERT_EQ(5u, metrics.requestsSent);
+    ASSERT_EQ(0u, metrics.requestsInFlight);
+}
+
+TEST(BatchingLoop, StopsAfterSendingWhatIsBuffered)
+{
+    std::atomic<size_t> completed(0);
+    {
+        NumberBatcher batcher(10, 1, completed);
+        batcher.Put(1);
+        batcher.Put(2);
+    }
+    ASSERT_EQ(2u, completed.load());
+}
@@ -18,6 +18,7 @@
 #include <aws/core/utils/threading/Semaphore.h>
 #include <atomic>
 #include <chrono>
+#include <future>
 
 using namespace Aws::Utils::Threading;
 
@@ -48,3 +49,33 @@ TEST(DefaultExecutor, ThreadsDetachIfNotShuttingDown)
     i = i * 10;
     ASSERT_EQ(20, i.load());
 }
+
+TEST(PooledThreadExecutor, RunsMoveOnlyTasks)
+{
+    PooledThreadExecutor exec(2);
+    std::packaged_task<int()> task([] { return 42; });
+    auto future = task.get_future();
+    ASSERT_TRUE(exec.Submit(std::move(task)));
+    ASSERT_EQ(42, future.get());
+
+    std::promise<int> promise;
+    auto sum = promise.get_future();
+    ASSERT_TRUE(exec.Submit([&promise](int a, int b) { promise.set_value(a + b); }, 1, 2));
+    ASSERT_EQ(3, sum.get());
+}
+
+TEST(Task, StoresSmallCallablesInlineAndLargeOnesOnTheHeap)
+{
+    std::atomic<int> i(0);
+    Task small([&i] { i += 1; });
+    Task moved(std::move(small));
+    ASSERT_FALSE(static_cast<bool>(small));
+    moved();
+
+    char payload[Task::INLINE_STORAGE_SIZE * 2] = { 1 };
+    Task large([&i, payload] { i += payload[0] * 10; });
+    Task assigned;
+    assigned = std::move(large);
+    assigned();
+    ASSERT_EQ(11, i.load());
+}
@@ -83,6 +83,7 @@ namespace Aws
         class AWSAuthSigner;
         struct ClientConfiguration;
         class RetryStrategy;
+        class RequestTracer;
 
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
@@ -238,6 +239,11 @@ namespace Aws
              */
             Aws::Client::AWSAuthSigner* GetSignerByName(const char* name) const;
 
+            /**
+             * Gets the tracer from the client configuration, nullptr if none was configured.
+             */
+            RequestTracer* GetRequestTracer() const { return m_requestTracer.get(); }
+
         private:
             void AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const Http::HeaderValueCollection& headerValues) const;
             void AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
@@ -256,6 +262,7 @@ namespace Aws
             Aws::String m_userAgent;
             std::shared_ptr<Aws::Utils::Crypto::Hash> m_hash;
             bool m_enableClockSkewAdjustment;
+            std::shared_ptr<RequestTracer> m_requestTracer;
         };
 
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Json::JsonValue>, AWSError<CoreErrors>> JsonOutcome;
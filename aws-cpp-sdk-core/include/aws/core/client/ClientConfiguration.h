@@ -40,6 +40,7 @@ namespace Aws
     namespace Client
     {
         class RetryStrategy; // forward declare
+        class RequestTracer;
 
         /**
           * This mutable structure is used to configure any of the AWS clients.
@@ -146,6 +147,11 @@ namespace Aws
              * If set to true clock skew will be adjusted after each http attempt, default to true.
              */
             bool enableClockSkewAdjustment;
+            /**
+             * Receives the duration of each phase (serialization, signing, connection, transfer, parsing, retries...) of every call.
+             * Default is none, in which case nothing is timed.
+             */
+            std::shared_ptr<RequestTracer> requestTracer;
         };
 
     } // namespace Client
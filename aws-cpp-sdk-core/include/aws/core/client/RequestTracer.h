@@ -0,0 +1,110 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <chrono>
+
+namespace Aws
+{
+    namespace Client
+    {
+        /**
+         * The phases of a service call that are timed when a RequestTracer is configured.
+         */
+        enum class RequestTraceStage
+        {
+            /**
+             * Building the http request from the service request, including serializing its payload.
+             */
+            Serialization,
+            /**
+             * Getting credentials from the credentials provider. Included in Signing.
+             */
+            CredentialsFetch,
+            /**
+             * Signing the http request.
+             */
+            Signing,
+            /**
+             * Waiting for a connection from the http client's pool.
+             */
+            ConnectionAcquire,
+            /**
+             * Name resolution, as reported by the http client.
+             */
+            DnsLookup,
+            /**
+             * TCP connect, as reported by the http client.
+             */
+            Connect,
+            /**
+             * TLS handshake, as reported by the http client.
+             */
+            TlsHandshake,
+            /**
+             * From the request being sent to the first byte of the response, as reported by the http client.
+             */
+            TimeToFirstByte,
+            /**
+             * Receiving the rest of the response, as reported by the http client.
+             */
+            Transfer,
+            /**
+             * Everything from Serialization to the http response (or error) being available, for one attempt.
+             */
+            Attempt,
+            /**
+             * Parsing the response payload (or the error payload of a failed attempt).
+             */
+            ResponseParse,
+            /**
+             * Waiting before retrying a failed attempt.
+             */
+            RetrySleep
+        };
+
+        /**
+         * A timed phase of a service call.
+         */
+        struct AWS_CORE_API RequestTraceEvent
+        {
+            /**
+             * Name of the operation, e.g. "GetObject". Can be empty for requests not built from an AmazonWebServiceRequest.
+             */
+            const char* requestName;
+            RequestTraceStage stage;
+            std::chrono::microseconds duration;
+        };
+
+        /**
+         * Receives timing events for every call made by the clients it is configured on (see ClientConfiguration::requestTracer).
+         * Events are delivered synchronously on the thread making the call, in the order the stages complete, so a call that
+         * is retried reports the stages of each attempt, each failed one followed by a RetrySleep event.
+         * Stages the http client can't measure are not reported. Implementations must be thread safe and should return quickly.
+         *
+         * When no tracer is configured, nothing is timed.
+         */
+        class AWS_CORE_API RequestTracer
+        {
+        public:
+            virtual ~RequestTracer() = default;
+
+            virtual void OnTraceEvent(const RequestTraceEvent& event) = 0;
+        };
+
+    } // namespace Client
+} // namespace Aws
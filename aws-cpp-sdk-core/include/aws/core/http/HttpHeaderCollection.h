@@ -0,0 +1,83 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Header storage of StandardHttpRequest and StandardHttpResponse.
+         * Names are lower cased (and names and values trimmed) once, when a header is set; lookups are case insensitive
+         * and don't allocate. Headers are kept in a flat vector in insertion order: requests and responses carry a
+         * handful of headers, for which a linear scan beats a tree.
+         */
+        class AWS_CORE_API HttpHeaderCollection
+        {
+        public:
+            typedef Aws::Vector<HeaderValuePair>::const_iterator const_iterator;
+
+            HttpHeaderCollection();
+
+            /**
+             * Returns the value of headerName (in any case), nullptr if it isn't set.
+             */
+            const Aws::String* Find(const char* headerName) const;
+            const Aws::String* Find(const Aws::String& headerName) const;
+
+            inline bool Contains(const char* headerName) const { return Find(headerName) != nullptr; }
+
+            /**
+             * Adds headerName or replaces its value. The stored value is trimmed, the stored name is trimmed and lower cased.
+             */
+            void Set(const char* headerName, const Aws::String& headerValue);
+            void Set(const Aws::String& headerName, const Aws::String& headerValue);
+
+            /**
+             * Removes headerName (in any case). Returns false if it wasn't set.
+             */
+            bool Erase(const char* headerName);
+
+            inline void Clear() { m_headers.clear(); }
+
+            inline std::size_t size() const { return m_headers.size(); }
+            inline bool empty() const { return m_headers.empty(); }
+
+            /**
+             * Iterates over (lower cased name, value) pairs in insertion order.
+             */
+            inline const_iterator begin() const { return m_headers.begin(); }
+            inline const_iterator end() const { return m_headers.end(); }
+
+            /**
+             * Copies the headers into a map, for the APIs exposing HeaderValueCollection.
+             */
+            HeaderValueCollection ToHeaderValueCollection() const;
+
+        private:
+            std::size_t IndexOf(const char* headerName, std::size_t length) const;
+            void Set(const char* headerName, std::size_t length, const Aws::String& headerValue);
+
+            Aws::Vector<HeaderValuePair> m_headers;
+        };
+
+    } // namespace Http
+} // namespace Aws
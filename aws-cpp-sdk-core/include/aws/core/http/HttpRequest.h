@@ -19,9 +19,11 @@
 
 #include <aws/core/http/URI.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/HttpHeaderCollection.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
+#include <chrono>
 #include <memory>
 #include <functional>
 
@@ -73,8 +75,10 @@ namespace Aws
              * Initializes an HttpRequest object with uri and http method.
              */
             HttpRequest(const URI& uri, HttpMethod method) :
-                m_uri(uri), m_method(method)
-            {}
+                m_uri(uri), m_method(method), m_timingsEnabled(false)
+            {
+                ResetTimings();
+            }
 
             virtual ~HttpRequest() {}
 
@@ -82,6 +86,10 @@ namespace Aws
              * Get All headers for this request.
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Get all headers for this request, without copying them. Header names are lower case.
+             */
+            virtual const HttpHeaderCollection& GetHeaderCollection() const = 0;
             /**
              * Get the value for a Header based on its name. (in default StandardHttpRequest implementation, an empty string will be returned if headerName dosen't exist)
              */
@@ -380,12 +388,41 @@ namespace Aws
             inline const DataSentEventHandler& GetDataSentEventHandler() const { return m_onDataSent; }
 
             inline const ContinueRequestHandler& GetContinueRequestHandler() const { return m_continueRequest; }
+
+            /**
+             * Asks the signer and http client to record how long each phase of processing this request takes, see SetTiming().
+             * Off by default, so that nothing is timed unless someone is listening.
+             */
+            inline void EnableTimings() { m_timingsEnabled = true; }
+
+            inline bool AreTimingsEnabled() const { return m_timingsEnabled; }
+
+            /**
+             * Records the duration of a phase. Only meaningful when AreTimingsEnabled().
+             */
+            inline void SetTiming(HttpRequestTiming timing, std::chrono::microseconds duration) { m_timings[static_cast<size_t>(timing)] = duration; }
+
+            /**
+             * Returns the recorded duration of a phase, or a negative duration if it wasn't measured.
+             */
+            inline std::chrono::microseconds GetTiming(HttpRequestTiming timing) const { return m_timings[static_cast<size_t>(timing)]; }
+
+            inline void ResetTimings()
+            {
+                for (auto& timing : m_timings)
+                {
+                    timing = std::chrono::microseconds(-1);
+                }
+            }
+
         private:
             URI m_uri;
             HttpMethod m_method;
             DataReceivedEventHandler m_onDataReceived;
             DataSentEventHandler m_onDataSent;
             ContinueRequestHandler m_continueRequest;
+            bool m_timingsEnabled;
+            std::chrono::microseconds m_timings[static_cast<size_t>(HttpRequestTiming::HttpRequestTimingCount)];
         };
 
     } // namespace Http
@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/http/HttpRequest.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/HttpHeaderCollection.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 
@@ -176,6 +177,10 @@ namespace Aws
              * Get the headers from this response
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Get the headers from this response, without copying them. Header names are lower case.
+             */
+            virtual const HttpHeaderCollection& GetHeaderCollection() const = 0;
             /**
              * Returns true if the response contains a header by headerName
              */
@@ -51,6 +51,21 @@ namespace Aws
             WIN_HTTP_CLIENT
         };
 
+        /**
+         * Durations an http client (or the signer) can record on an HttpRequest while processing it, see HttpRequest::SetTiming().
+         */
+        enum class HttpRequestTiming
+        {
+            CredentialsFetch,
+            ConnectionAcquire,
+            DnsLookup,
+            Connect,
+            TlsHandshake,
+            TimeToFirstByte,
+            Transfer,
+            HttpRequestTimingCount
+        };
+
         namespace HttpMethodMapper
         {
             /**
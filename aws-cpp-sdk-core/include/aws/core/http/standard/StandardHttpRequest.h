@@ -17,6 +17,7 @@
 
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpHeaderCollection.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -42,6 +43,10 @@ namespace Aws
                  * Get All headers for this request.
                  */
                 virtual HeaderValueCollection GetHeaders() const override;
+                /**
+                 * Get all headers for this request, without copying them.
+                 */
+                virtual const HttpHeaderCollection& GetHeaderCollection() const override { return headerMap; }
                 /**
                  * Get the value for a Header based on its name.
                  */                
@@ -84,7 +89,7 @@ namespace Aws
                 virtual void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) override;
 
             private:
-                HeaderValueCollection headerMap;
+                HttpHeaderCollection headerMap;
                 std::shared_ptr<Aws::IOStream> bodyStream;
                 Aws::IOStreamFactory m_responseStreamFactory;
                 static const Aws::String m_emptyHeader;
@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/HttpHeaderCollection.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -56,12 +57,16 @@ namespace Aws
                  * Get the headers from this response
                  */
                 HeaderValueCollection GetHeaders() const;
+                /**
+                 * Get the headers from this response, without copying them.
+                 */
+                const HttpHeaderCollection& GetHeaderCollection() const { return headerMap; }
                 /**
                  * Returns true if the response contains a header by headerName
                  */
                 bool HasHeader(const char* headerName) const;
                 /**
-                 * Returns the value for a header at headerName if it exists.
+                 * Returns the value for a header at headerName if it exists, an empty string otherwise.
                  */
                 const Aws::String& GetHeader(const Aws::String&) const;
                 /**
@@ -81,7 +86,7 @@ namespace Aws
             private:
                 StandardHttpResponse(const StandardHttpResponse&);                
 
-                Aws::Map<Aws::String, Aws::String> headerMap;
+                HttpHeaderCollection headerMap;
                 Utils::Stream::ResponseStream bodyStream;
             };
 
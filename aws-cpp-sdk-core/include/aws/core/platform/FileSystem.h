@@ -112,7 +112,7 @@ namespace FileSystem
 
     struct DirectoryEntry
     {
-        DirectoryEntry() : fileType(FileType::None), fileSize(0) {}
+        DirectoryEntry() : fileType(FileType::None), fileSize(0), lastModified(0) {}
 
         operator bool() const { return !path.empty() && fileType != FileType::None; }
 
@@ -120,6 +120,8 @@ namespace FileSystem
         Aws::String relativePath;
         FileType fileType;
         int64_t fileSize;
+        // milliseconds since the epoch
+        int64_t lastModified;
     };
 
     /**
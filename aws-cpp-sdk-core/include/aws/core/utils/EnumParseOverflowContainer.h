@@ -32,7 +32,14 @@ namespace Aws
         class AWS_CORE_API EnumParseOverflowContainer
         {
         public:
+            /**
+             * The string returned is never modified or freed while the container lives, so it can be kept, or its c_str() handed
+             * out, without holding the lock.
+             */
             const Aws::String& RetrieveOverflow(int hashCode) const;
+            /**
+             * Values are only ever added: once a hash code has a value, storing another one for it is ignored.
+             */
             void StoreOverflow(int hashCode, const Aws::String& value);
 
         private:
@@ -21,6 +21,8 @@
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/Array.h>
 
+#include <cstdint>
+
 namespace Aws
 {
     namespace Utils
@@ -87,8 +89,26 @@ namespace Aws
             */
             static ByteBuffer CalculateMD5(Aws::IOStream& stream);
 
+            /**
+            * Hashes a null terminated string for quick comparisons, e.g. of enum names. Not cryptographically secure.
+            */
             static int HashString(const char* strToHash);
 
+            /**
+            * Same hash as HashString(), as a constexpr so that the hashes of string literals are compile time constants and need
+            * no static initialization. Meant for constants only, HashString() is the faster of the two on strings known at run time.
+            */
+            static constexpr int CompileTimeHashString(const char* strToHash)
+            {
+                return strToHash ? static_cast<int>(HashStringFrom(strToHash, 0)) : 0;
+            }
+
+        private:
+            // single return statement recursion to be a C++11 constexpr, in unsigned arithmetic as overflowing an int isn't constant
+            static constexpr uint32_t HashStringFrom(const char* strToHash, uint32_t hash)
+            {
+                return *strToHash ? HashStringFrom(strToHash + 1, static_cast<uint32_t>(*strToHash) + 31 * hash) : hash;
+            }
         };
 
     } // namespace Utils
@@ -27,6 +27,7 @@ namespace Aws
         {
             static const size_t SYMMETRIC_KEY_LENGTH = 32;
             static const size_t MIN_IV_LENGTH = 12;
+            static const size_t MAX_CIPHER_BLOCK_SIZE = 16;
 
             AWS_CORE_API CryptoBuffer IncrementCTRCounter(const CryptoBuffer& counter, uint32_t numberOfBlocks);
 
@@ -139,6 +140,30 @@ namespace Aws
                  */
                 virtual CryptoBuffer FinalizeDecryption () = 0;
 
+                /**
+                 * Same as EncryptBuffer(), but writes to output, starting at outputOffset, instead of allocating a buffer for every call.
+                 * output is only reallocated (keeping its first outputOffset bytes) when the result doesn't fit; room for length plus
+                 * MAX_CIPHER_BLOCK_SIZE bytes is always enough for the ciphers of this SDK. outputLength is set to the number of bytes written.
+                 * If SupportsInPlace(), data can point to output + outputOffset. Returns false on failure.
+                 * The default implementation calls EncryptBuffer() and copies its result.
+                 */
+                virtual bool EncryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength);
+
+                /**
+                 * Same as DecryptBuffer(), but writes to output, starting at outputOffset, instead of allocating a buffer for every call.
+                 * output is only reallocated (keeping its first outputOffset bytes) when the result doesn't fit; room for length plus
+                 * MAX_CIPHER_BLOCK_SIZE bytes is always enough for the ciphers of this SDK. outputLength is set to the number of bytes written.
+                 * If SupportsInPlace(), data can point to output + outputOffset. Returns false on failure.
+                 * The default implementation calls DecryptBuffer() and copies its result.
+                 */
+                virtual bool DecryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength);
+
+                /**
+                 * Whether EncryptInto() and DecryptInto() can write their output over their input. True for stream modes such
+                 * as CTR and GCM, whose output is always as long as their input.
+                 */
+                virtual bool SupportsInPlace() const { return false; }
+
                 virtual void Reset() = 0;
 
                 /**
@@ -165,7 +190,12 @@ namespace Aws
                 /**
                  * Generates a non-deterministic random symmetric key. Default (and minimum bar for security) is 256 bits.
                  */
-                static CryptoBuffer GenerateKey(size_t keyLengthBytes = SYMMETRIC_KEY_LENGTH);                
+                static CryptoBuffer GenerateKey(size_t keyLengthBytes = SYMMETRIC_KEY_LENGTH);
+
+                /**
+                 * Makes sure buffer holds at least length bytes, reallocating it if needed. Only the first bytesToKeep bytes are kept.
+                 */
+                static void ReserveOutput(CryptoBuffer& buffer, size_t length, size_t bytesToKeep);
 
             protected:
                 SymmetricCipher() : m_failure(false) {}
@@ -25,7 +25,7 @@ namespace Aws
         namespace Crypto
         {
             typedef std::mbstate_t FPOS_TYPE;
-            static const size_t DEFAULT_BUF_SIZE = 1024;
+            static const size_t DEFAULT_BUF_SIZE = 16 * 1024;
             static const size_t PUT_BACK_SIZE = 1;
 
             /**
@@ -68,7 +68,7 @@ namespace Aws
                  * stream to src from
                  * cipher to encrypt or decrypt the src stream with
                  * mode to use cipher in. Encryption or Decyption
-                 * buffersize, the size of the src buffers to read at a time. Defaults to 1kb
+                 * buffersize, the size of the src buffers to read at a time. Defaults to 16kb
                  */
                 SymmetricCryptoBufSrc(Aws::IStream& stream, SymmetricCipher& cipher, CipherMode cipherMode, size_t bufferSize = DEFAULT_BUF_SIZE);
 
@@ -95,8 +95,12 @@ namespace Aws
                 int_type underflow() override;
                 off_type ComputeAbsSeekPosition(off_type, std::ios_base::seekdir,  std::fpos<FPOS_TYPE>);
                 void FinalizeCipher();
+                size_t FillBuffer(size_t readLength);
 
+                /// put back area followed by the cipher output of the last read
                 CryptoBuffer m_isBuf;
+                /// data read from the stream, unless the cipher works in place in m_isBuf
+                CryptoBuffer m_inputBuf;
                 SymmetricCipher& m_cipher;
                 Aws::IStream& m_stream;
                 CipherMode m_cipherMode;
@@ -147,12 +151,16 @@ namespace Aws
                 int sync() override;
                 bool writeOutput(bool finalize);
 
+                /// put area, with room for one more block so that the cipher can work in place
                 CryptoBuffer m_osBuf;
+                /// cipher output, unless the cipher works in place in m_osBuf
+                CryptoBuffer m_cipherOutput;
                 SymmetricCipher& m_cipher;
                 Aws::OStream& m_stream;
                 CipherMode m_cipherMode;
                 bool m_isFinalized;
                 int16_t m_blockOffset;
+                size_t m_bufferSize;
             };
         }
     }
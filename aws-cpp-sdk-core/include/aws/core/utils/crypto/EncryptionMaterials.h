@@ -42,6 +42,7 @@ namespace Aws
 
                 /*
                 * Override this method to control how to encrypt the content encryption key (CEK). This occurs in place.
+                * Implementations may also replace the CEK itself, e.g. with a previously encrypted one.
                 */
                 virtual CryptoOutcome EncryptCEK(ContentCryptoMaterial& contentCryptoMaterial) = 0;
 
@@ -0,0 +1,115 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+        }
+
+        namespace Crypto
+        {
+            /**
+             * Computes the SHA256 Tree Hash used by Amazon Glacier
+             * (see http://docs.aws.amazon.com/amazonglacier/latest/dev/checksum-calculations.html).
+             *
+             * Data can be fed incrementally through Update(), e.g. as the parts of a multipart upload are streamed.
+             * Every complete 1 MB leaf is hashed as soon as it is available; if an executor is supplied, leaves are
+             * hashed concurrently on it, otherwise they are hashed on the calling thread.
+             * The executor must outlive this object, or at least any call to GetResult().
+             */
+            class AWS_CORE_API Sha256TreeHash
+            {
+            public:
+                /**
+                 * Size of a leaf in the tree; each leaf is hashed independently.
+                 */
+                static const size_t TREE_HASH_CHUNK_SIZE = 1024 * 1024;
+
+                /**
+                 * Pass an executor to hash leaves concurrently. nullptr hashes everything on the calling thread.
+                 */
+                Sha256TreeHash(Aws::Utils::Threading::Executor* executor = nullptr);
+                ~Sha256TreeHash();
+
+                Sha256TreeHash(const Sha256TreeHash&) = delete;
+                Sha256TreeHash& operator=(const Sha256TreeHash&) = delete;
+
+                /**
+                 * Appends length bytes of buffer to the data being hashed. The buffer is not referenced after this call returns.
+                 */
+                void Update(const unsigned char* buffer, size_t length);
+
+                /**
+                 * Appends the remaining content of stream to the data being hashed.
+                 */
+                void Update(Aws::IStream& stream);
+
+                /**
+                 * Waits for all pending leaf hashes and returns the tree hash of everything passed to Update() so far (not hex encoded).
+                 * Once called, no more data can be added; call Reset() to start over.
+                 */
+                ByteBuffer GetResult();
+
+                /**
+                 * Discards all state so this object can be used to hash new data.
+                 */
+                void Reset();
+
+                /**
+                 * Calculates the tree hash of a buffer without copying it. If an executor is supplied, leaves are hashed
+                 * concurrently on it. The buffer must stay valid until this call returns. Works with memory mapped files too.
+                 */
+                static ByteBuffer Calculate(const unsigned char* buffer, size_t length, Aws::Utils::Threading::Executor* executor = nullptr);
+
+                /**
+                 * Folds a list of consecutive hashes into their tree hash.
+                 * When every hash covers the same power of two number of megabytes (except possibly the last one, which can be smaller),
+                 * e.g. the tree hashes of the parts of a Glacier multipart upload, the result is the tree hash of the whole archive.
+                 */
+                static ByteBuffer CombineTreeHashes(const Aws::Vector<ByteBuffer>& hashes);
+
+            private:
+                void SubmitCurrentLeaf();
+                void SubmitLeaf(const unsigned char* buffer, size_t length, std::shared_ptr<ByteBuffer> owner);
+                void WaitForPendingLeaves();
+
+                Aws::Utils::Threading::Executor* m_executor;
+                ByteBuffer m_currentLeaf;
+                size_t m_currentLeafLength;
+                Aws::Vector<ByteBuffer> m_leafHashes;
+                size_t m_pendingLeaves;
+                bool m_finalized;
+                std::mutex m_leafHashesMutex;
+                std::condition_variable m_leafHashesSignal;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
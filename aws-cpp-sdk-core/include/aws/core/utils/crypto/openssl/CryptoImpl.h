@@ -171,6 +171,16 @@ namespace Aws
                  */
                 CryptoBuffer FinalizeDecryption() override;
 
+                /**
+                 * Encrypts straight into output with EVP_EncryptUpdate
+                 */
+                bool EncryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength) override;
+
+                /**
+                 * Decrypts straight into output with EVP_DecryptUpdate
+                 */
+                bool DecryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength) override;
+
                 void Reset() override;
 
             protected:
@@ -253,6 +263,8 @@ namespace Aws
 
                 AES_CTR_Cipher_OpenSSL(AES_CTR_Cipher_OpenSSL&& toMove) = default;
 
+                bool SupportsInPlace() const override { return true; }
+
             protected:
                 size_t GetBlockSizeBytes() const override;
 
@@ -303,6 +315,8 @@ namespace Aws
                  */
                 CryptoBuffer FinalizeEncryption() override;
 
+                bool SupportsInPlace() const override { return true; }
+
             protected:
                 size_t GetBlockSizeBytes() const override;
 
@@ -344,6 +358,19 @@ namespace Aws
                 CryptoBuffer DecryptBuffer(const CryptoBuffer&) override;
                 CryptoBuffer FinalizeDecryption() override;
 
+                /**
+                 * Key wrap only produces output on finalization, it doesn't use the EVP update path of OpenSSLCipher.
+                 */
+                bool EncryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength) override
+                {
+                    return SymmetricCipher::EncryptInto(data, length, output, outputOffset, outputLength);
+                }
+
+                bool DecryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength) override
+                {
+                    return SymmetricCipher::DecryptInto(data, length, output, outputOffset, outputLength);
+                }
+
             protected:
                 inline size_t GetBlockSizeBytes() const override { return BlockSizeBytes; }
 
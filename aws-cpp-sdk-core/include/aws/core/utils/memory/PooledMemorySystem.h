@@ -0,0 +1,159 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/MemorySystemInterface.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <mutex>
+#include <stdint.h>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Memory
+        {
+            struct PooledThreadCache;
+            struct PooledThreadCacheBinding;
+            struct PooledTagStats;
+
+            /**
+             * Bump allocator for request scoped object graphs (e.g. a large model result and everything it owns).
+             * While a ScopedMemoryArena is active on a thread, every allocation made on that thread through a PooledMemorySystem
+             * comes from the arena and freeing it is a no-op; all the memory is released at once when the arena is destroyed.
+             * Every object allocated inside the scope must therefore be destroyed before the arena.
+             * An arena is not thread safe, it is meant to be used by one thread at a time.
+             */
+            class AWS_CORE_API MemoryArena
+            {
+            public:
+                /**
+                 * chunkSize is the size of the blocks requested from the system allocator; larger allocations get their own block.
+                 */
+                MemoryArena(std::size_t chunkSize = 64 * 1024);
+                ~MemoryArena();
+
+                MemoryArena(const MemoryArena&) = delete;
+                MemoryArena& operator=(const MemoryArena&) = delete;
+
+                /**
+                 * Returns size bytes aligned on alignment, preceded by headerSize bytes of room for the caller's bookkeeping.
+                 */
+                void* Allocate(std::size_t size, std::size_t alignment, std::size_t headerSize);
+
+                /**
+                 * Total number of bytes requested from the system allocator by this arena.
+                 */
+                std::size_t GetReservedBytes() const { return m_reservedBytes; }
+
+            private:
+                struct Chunk;
+
+                std::size_t m_chunkSize;
+                std::size_t m_reservedBytes;
+                Chunk* m_chunks;
+                char* m_cursor;
+                char* m_end;
+            };
+
+            /**
+             * Routes the allocations of the current thread to arena for the lifetime of this object. Scopes can be nested.
+             */
+            class AWS_CORE_API ScopedMemoryArena
+            {
+            public:
+                ScopedMemoryArena(MemoryArena& arena);
+                ~ScopedMemoryArena();
+
+                ScopedMemoryArena(const ScopedMemoryArena&) = delete;
+                ScopedMemoryArena& operator=(const ScopedMemoryArena&) = delete;
+
+            private:
+                MemoryArena* m_previousArena;
+            };
+
+            /**
+             * Allocation counters for a single allocationTag.
+             */
+            struct AWS_CORE_API AllocationTagStats
+            {
+                const char* allocationTag;
+                uint64_t allocationCount;
+                uint64_t freeCount;
+                uint64_t bytesAllocated;
+                uint64_t bytesInUse;
+            };
+
+            /**
+             * Memory system meant for high throughput services, install it with InitializeAWSMemorySystem().
+             *
+             * Small allocations (up to 4 KB) are served from per-thread size class pools without taking any lock.
+             * A block freed by another thread than the one that allocated it is pushed onto a lock free list owned by the
+             * allocating thread, which reclaims it on its next allocation of that size. Pools of exited threads, and of threads that moved on to
+             * another PooledMemorySystem, are handed to new threads.
+             * Pooled memory is only given back to the system allocator when this object is destroyed.
+             * Larger or over-aligned allocations go straight to malloc.
+             *
+             * When trackAllocationTags is set, allocations and frees are counted per allocationTag (at the cost of
+             * a few atomic increments per call), see GetAllocationTagStats().
+             *
+             * This object must outlive every allocation made through it and every thread that allocated from it.
+             */
+            class AWS_CORE_API PooledMemorySystem : public MemorySystemInterface
+            {
+            public:
+                PooledMemorySystem(bool trackAllocationTags = false);
+                virtual ~PooledMemorySystem();
+
+                PooledMemorySystem(const PooledMemorySystem&) = delete;
+                PooledMemorySystem& operator=(const PooledMemorySystem&) = delete;
+
+                virtual void Begin() override {}
+                virtual void End() override {}
+
+                virtual void* AllocateMemory(std::size_t blockSize, std::size_t alignment, const char *allocationTag = nullptr) override;
+                virtual void FreeMemory(void* memoryPtr) override;
+
+                /**
+                 * Returns the counters of every allocationTag seen so far, tags with the same name are merged.
+                 * Empty unless the memory system was created with trackAllocationTags.
+                 */
+                Aws::Vector<AllocationTagStats> GetAllocationTagStats() const;
+
+            private:
+                PooledThreadCache* GetThreadCache();
+                PooledThreadCache* AcquireThreadCache();
+                void ReleaseThreadCache(PooledThreadCache* cache);
+                uint32_t FindTagSlot(const char* allocationTag);
+                void RecordAllocation(uint32_t tagSlot, std::size_t size);
+                void RecordFree(uint32_t tagSlot, std::size_t size);
+
+                const uint64_t m_id;
+                const bool m_trackAllocationTags;
+                PooledTagStats* m_tagStats;
+                std::mutex m_cachesMutex;
+                PooledThreadCache* m_allCaches;
+                PooledThreadCache* m_idleCaches;
+
+                friend struct PooledThreadCacheBinding;
+            };
+
+        } // namespace Memory
+    } // namespace Utils
+} // namespace Aws
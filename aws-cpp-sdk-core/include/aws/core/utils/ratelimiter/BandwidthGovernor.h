@@ -0,0 +1,164 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace RateLimits
+        {
+            /**
+             * Bandwidth budget meant to be shared: one instance can be set as the read or write rate limiter of any number of
+             * ClientConfigurations (and so of the TransferManagers using those clients) to cap their combined throughput.
+             *
+             * Budgets nest: a governor created with a parent charges every cost to its parent as well, and callers wait for
+             * whichever of the two is further behind. E.g. a process wide governor as the parent of one governor per client
+             * caps each client and all of them together.
+             *
+             * ApplyCost() never blocks or takes a lock; the budget is a single atomic "paid up until" time point advanced
+             * by compare and swap (a GCRA token bucket). Up to burstBytes can go through without any delay.
+             * The http clients call ApplyAndPayForCost(), which sleeps the calling thread for the delay.
+             */
+            class BandwidthGovernor : public RateLimiterInterface
+            {
+            public:
+                using ClockType = std::chrono::steady_clock;
+                using ElapsedTimeFunctionType = std::function< ClockType::time_point() >;
+
+                /**
+                 * bytesPerSecond is the budget of this governor, burstBytes how much can go through without delay after a
+                 * period of inactivity (defaults to one second worth of bytes). All costs are also charged to parent, if set.
+                 */
+                BandwidthGovernor(int64_t bytesPerSecond, const std::shared_ptr<BandwidthGovernor>& parent = nullptr,
+                        int64_t burstBytes = 0, ElapsedTimeFunctionType elapsedTimeFunction = ClockType::now) :
+                    m_elapsedTimeFunction(elapsedTimeFunction),
+                    m_parent(parent),
+                    m_bytesPerSecond(0),
+                    m_burstBytes(burstBytes),
+                    m_paidUntil(0)
+                {
+                    SetRate(bytesPerSecond, true);
+                }
+
+                virtual ~BandwidthGovernor() = default;
+
+                /**
+                 * Charges cost bytes and returns how long they should wait before going through.
+                 */
+                virtual DelayType ApplyCost(int64_t cost) override
+                {
+                    const int64_t now = NowInNanoseconds();
+                    const int64_t bytesPerSecond = m_bytesPerSecond.load(std::memory_order_relaxed);
+                    const int64_t costInNanoseconds = ToNanoseconds(cost, bytesPerSecond);
+                    const int64_t burstInNanoseconds = ToNanoseconds(GetBurstBytes(bytesPerSecond), bytesPerSecond);
+
+                    int64_t paidUntil = m_paidUntil.load(std::memory_order_relaxed);
+                    int64_t newPaidUntil = 0;
+                    do
+                    {
+                        // an idle budget doesn't accumulate credit beyond the burst
+                        newPaidUntil = (std::max)(paidUntil, now) + costInNanoseconds;
+                    } while (!m_paidUntil.compare_exchange_weak(paidUntil, newPaidUntil, std::memory_order_relaxed));
+
+                    // whatever is owed beyond the burst has to be waited out
+                    DelayType delay = std::chrono::duration_cast<DelayType>(
+                        std::chrono::nanoseconds((std::max)(static_cast<int64_t>(0), newPaidUntil - burstInNanoseconds - now)));
+
+                    if (m_parent)
+                    {
+                        delay = (std::max)(delay, m_parent->ApplyCost(cost));
+                    }
+
+                    return delay;
+                }
+
+                /**
+                 * Same as ApplyCost() but then goes ahead and sleeps the current thread.
+                 */
+                virtual void ApplyAndPayForCost(int64_t cost) override
+                {
+                    auto delay = ApplyCost(cost);
+                    if (delay.count() > 0)
+                    {
+                        std::this_thread::sleep_for(delay);
+                    }
+                }
+
+                /**
+                 * Update the bandwidth rate to allow. Unless resetAccumulator is set, what was charged at the previous rate is still owed.
+                 */
+                virtual void SetRate(int64_t rate, bool resetAccumulator = false) override
+                {
+                    // rate must always be positive
+                    rate = (std::max)(static_cast<int64_t>(1), rate);
+                    m_bytesPerSecond.store(rate, std::memory_order_relaxed);
+                    if (resetAccumulator)
+                    {
+                        // start with the full burst available
+                        m_paidUntil.store(NowInNanoseconds(), std::memory_order_relaxed);
+                    }
+                }
+
+                inline int64_t GetRate() const { return m_bytesPerSecond.load(std::memory_order_relaxed); }
+
+                inline const std::shared_ptr<BandwidthGovernor>& GetParent() const { return m_parent; }
+
+            private:
+                static int64_t ToNanoseconds(int64_t bytes, int64_t bytesPerSecond)
+                {
+                    static const int64_t NANOSECONDS_PER_SECOND = 1000000000;
+                    // split to avoid overflowing on large costs
+                    return (bytes / bytesPerSecond) * NANOSECONDS_PER_SECOND + (bytes % bytesPerSecond) * NANOSECONDS_PER_SECOND / bytesPerSecond;
+                }
+
+                int64_t GetBurstBytes(int64_t bytesPerSecond) const
+                {
+                    return m_burstBytes > 0 ? m_burstBytes : bytesPerSecond;
+                }
+
+                int64_t NowInNanoseconds() const
+                {
+                    return std::chrono::duration_cast<std::chrono::nanoseconds>(m_elapsedTimeFunction().time_since_epoch()).count();
+                }
+
+                /// Function that returns the current time
+                ElapsedTimeFunctionType m_elapsedTimeFunction;
+
+                /// Budget every cost is charged to as well
+                std::shared_ptr<BandwidthGovernor> m_parent;
+
+                std::atomic<int64_t> m_bytesPerSecond;
+                const int64_t m_burstBytes;
+
+                /// Time point (in nanoseconds of ClockType) up until which everything charged so far is paid for
+                std::atomic<int64_t> m_paidUntil;
+            };
+
+        } // namespace RateLimits
+    } // namespace Utils
+} // namespace Aws
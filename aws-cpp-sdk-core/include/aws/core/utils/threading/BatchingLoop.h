@@ -0,0 +1,266 @@
+/*
+ * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *  http://aws.amazon.com/apache2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            class Executor;
+
+            /**
+             * Counters every client built on a BatchingLoop keeps, since it was created, and the current depth of its buffers.
+             * What an entry is, a record, a log event, an item, is up to the client.
+             */
+            struct BatchingMetrics
+            {
+                BatchingMetrics() : entriesPut(0), entriesSucceeded(0), entriesFailed(0), entriesRetried(0), requestsSent(0),
+                    entriesBuffered(0), bytesBuffered(0), requestsInFlight(0) {}
+
+                uint64_t entriesPut;
+                uint64_t entriesSucceeded;
+                /**
+                 * Entries given up on, after their last retry or an error retrying wouldn't fix.
+                 */
+                uint64_t entriesFailed;
+                /**
+                 * Entries put back to be sent again, once for each retry.
+                 */
+                uint64_t entriesRetried;
+                uint64_t requestsSent;
+
+                size_t entriesBuffered;
+                size_t bytesBuffered;
+                size_t requestsInFlight;
+            };
+
+            /**
+             * Delay before the given attempt (1 for the first retry) at something that failed: baseDelay doubled for each attempt,
+             * up to maxDelay, of which a random half or more is waited. The randomness keeps clients that failed together, e.g.
+             * because a service throttled all of them, from coming back together.
+             */
+            AWS_CORE_API std::chrono::milliseconds ComputeRetryDelay(unsigned attempt, std::chrono::milliseconds baseDelay, std::chrono::milliseconds maxDelay);
+
+            /**
+             * ComputeRetryDelay() with the random part given, spread is in [0, 1] and picks how much of the other half is waited.
+             */
+            AWS_CORE_API std::chrono::milliseconds ComputeRetryDelay(unsigned attempt, std::chrono::milliseconds baseDelay, std::chrono::milliseconds maxDelay, double spread);
+
+            /**
+             * A random spread for ComputeRetryDelay(), uniform in [0, 1].
+             */
+            AWS_CORE_API double DrawRetrySpread();
+
+            /**
+             * The earliest of the times a BatchingLoop has something to do at, e.g. send a batch whose entries waited long enough.
+             */
+            class WakeUpTime
+            {
+            public:
+                WakeUpTime() : m_isSet(false) {}
+
+                inline void NoLaterThan(std::chrono::steady_clock::time_point time)
+                {
+                    m_time = m_isSet && m_time < time ? m_time : time;
+                    m_isSet = true;
+                }
+
+                inline bool IsSet() const { return m_isSet; }
+                inline std::chrono::steady_clock::time_point Get() const { return m_time; }
+
+            private:
+                bool m_isSet;
+                std::chrono::steady_clock::time_point m_time;
+            };
+
+            /**
+             * Entries waiting out their backoff before being sent again. Not thread safe, the client keeps it under its lock.
+             */
+            template<typename Entry>
+            class RetryQueue
+            {
+            public:
+                RetryQueue(std::chrono::milliseconds baseDelay, std::chrono::milliseconds maxDelay) : m_baseDelay(baseDelay), m_maxDelay(maxDelay), m_spread(0) {}
+
+                /**
+                 * Queues the entry for the given retry, see ComputeRetryDelay(). Entries failed at the same time, e.g. by one response,
+                 * share the random part of their delay, so that they come back together and fill a request again.
+                 */
+                void Add(const Entry& entry, unsigned attempt, std::chrono::steady_clock::time_point failedAt)
+                {
+                    if (m_entries.empty() || failedAt != m_lastFailedAt)
+                    {
+                        m_lastFailedAt = failedAt;
+                        m_spread = DrawRetrySpread();
+                    }
+                    m_entries.emplace_back(failedAt + ComputeRetryDelay(attempt, m_baseDelay, m_maxDelay, m_spread), entry);
+                }
+
+                /**
+                 * Removes the entries due by now and hands them to requeue, the last one to fail first, so that pushing each to the front
+                 * of a buffer puts them back in the order they failed in.
+                 */
+                template<typename Requeue>
+                void TakeDue(std::chrono::steady_clock::time_point now, Requeue requeue)
+                {
+                    Aws::Vector<std::pair<std::chrono::steady_clock::time_point, Entry>> waiting;
+                    for (auto iter = m_entries.rbegin(); iter != m_entries.rend(); ++iter)
+                    {
+                        if (iter->first <= now)
+                        {
+                            requeue(iter->second);
+                        }
+                        else
+                        {
+                            waiting.push_back(*iter);
+                        }
+                    }
+                    m_entries.assign(waiting.rbegin(), waiting.rend());
+                }
+
+                void AddWakeUp(WakeUpTime& wakeUp) const
+                {
+                    for (const auto& entry : m_entries)
+                    {
+                        wakeUp.NoLaterThan(entry.first);
+                    }
+                }
+
+                inline bool empty() const { return m_entries.empty(); }
+                inline size_t size() const { return m_entries.size(); }
+
+            private:
+                std::chrono::milliseconds m_baseDelay;
+                std::chrono::milliseconds m_maxDelay;
+                std::chrono::steady_clock::time_point m_lastFailedAt;
+                double m_spread;
+                Aws::Vector<std::pair<std::chrono::steady_clock::time_point, Entry>> m_entries;
+            };
+
+            /**
+             * Sending loop of a client that buffers entries from any number of threads and sends them in batches, e.g. records put
+             * with PutRecordBatch. The loop waits until the client has a request ready, a flush was asked for or the loop is stopped,
+             * takes the request under the lock and sends it outside of it, keeping at most maxRequestsInFlight in flight.
+             *
+             * The client derives from it, guards its buffers with m_lock and notifies m_signal when it buffers something the loop
+             * may want to send right away. Requests complete asynchronously, the client calls CompleteRequest() once it is done
+             * with each of them.
+             */
+            class AWS_CORE_API BatchingLoop
+            {
+            public:
+                virtual ~BatchingLoop();
+
+                BatchingLoop(const BatchingLoop&) = delete;
+                BatchingLoop& operator=(const BatchingLoop&) = delete;
+
+            protected:
+                /**
+                 * The loop runs on the executor, which it keeps a thread of for as long as it runs, or on a thread of its own without one.
+                 */
+                BatchingLoop(size_t maxRequestsInFlight, Executor* executor = nullptr);
+
+                /**
+                 * Starts the loop, once the client is constructed.
+                 */
+                void StartLoop();
+
+                /**
+                 * Stops the loop after it sent whatever is buffered and all requests completed. The client calls it first thing
+                 * in its destructor, the loop calls back into it until then.
+                 */
+                void StopLoop();
+
+                /**
+                 * Has the loop send what is buffered without waiting for it to be due.
+                 */
+                void RequestFlush();
+
+                /**
+                 * Blocks until nothing is buffered and no request is in flight.
+                 */
+                void WaitUntilIdle();
+
+                /**
+                 * A request taken by TakeRequest() completed, and the client is done with it.
+                 */
+                void CompleteRequest();
+
+                /**
+                 * Whether StopLoop() was called, with m_lock held.
+                 */
+                inline bool IsStopping() const { return !m_running; }
+
+                /**
+                 * Fills the requests sent and in flight, with m_lock held.
+                 */
+                void CopyLoopMetrics(BatchingMetrics& metrics) const;
+
+                /**
+                 * Whether the client has entries waiting to be sent, including those waiting to be retried but not those of
+                 * requests in flight. Called with m_lock held.
+                 */
+                virtual bool HasBufferedEntries() const = 0;
+
+                /**
+                 * Takes the entries of a request out of the buffers if one is ready, or if sendAll is set and anything is, and returns
+                 * a function sending it. Otherwise returns an empty function, with wakeUp set to when a request may be ready.
+                 * Called with m_lock held, the function returned is called without.
+                 */
+                virtual std::function<void()> TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, WakeUpTime& wakeUp) = 0;
+
+                /**
+                 * Work the client has the loop do outside of m_lock before taking requests, e.g. refresh what it knows of the service.
+                 * Returns an empty function if there is none, with wakeUp set to when there may be.
+                 */
+                virtual std::function<void()> TakeHousekeeping(std::chrono::steady_clock::time_point now, WakeUpTime& wakeUp);
+
+                /**
+                 * Called on the thread running the loop before it starts.
+                 */
+                virtual void OnLoopStarted() {}
+
+                mutable std::mutex m_lock;
+                std::condition_variable m_signal;
+
+            private:
+                void Run();
+                bool IsIdle() const;
+
+                size_t m_maxRequestsInFlight;
+                Executor* m_executor;
+                bool m_running;
+                bool m_loopRunning;
+                bool m_flushRequested;
+                size_t m_requestsInFlight;
+                uint64_t m_requestsSent;
+                std::thread m_thread;
+            };
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
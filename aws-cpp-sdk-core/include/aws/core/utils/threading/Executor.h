@@ -20,6 +20,7 @@
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/threading/Semaphore.h>
+#include <aws/core/utils/threading/Task.h>
 #include <functional>
 #include <future>
 #include <mutex>
@@ -42,21 +43,29 @@ namespace Aws
             public:                
                 virtual ~Executor() = default;
 
+                /**
+                 * Send function to the SubmitToThread function. Move only functions are accepted; pass rvalues to avoid copies.
+                 */
+                template<class Fn>
+                bool Submit(Fn&& fn)
+                {
+                    return SubmitToThread(Task(std::forward<Fn>(fn)));
+                }
+
                 /**
                  * Send function and its arguments to the SubmitToThread function.
                  */
-                template<class Fn, class ... Args>
-                bool Submit(Fn&& fn, Args&& ... args)
+                template<class Fn, class Arg, class ... Args>
+                bool Submit(Fn&& fn, Arg&& arg, Args&& ... args)
                 {
-                    std::function<void()> callable{ std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...) };
-                    return SubmitToThread(std::move(callable));
+                    return SubmitToThread(Task(std::bind(std::forward<Fn>(fn), std::forward<Arg>(arg), std::forward<Args>(args)...)));
                 }
 
             protected:
                 /**
                 * To implement your own executor implementation, then simply subclass Executor and implement this method.
                 */
-                virtual bool SubmitToThread(std::function<void()>&&) = 0;
+                virtual bool SubmitToThread(Task&&) = 0;
             };
 
 
@@ -73,7 +82,7 @@ namespace Aws
                 {
                     Free, Locked, Shutdown
                 };
-                bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitToThread(Task&&) override;
                 void Detach(std::thread::id id);
                 std::atomic<State> m_state;
                 Aws::UnorderedMap<std::thread::id, std::thread> m_threads;
@@ -104,10 +113,10 @@ namespace Aws
                 PooledThreadExecutor& operator =(PooledThreadExecutor&&) = delete;
 
             protected:
-                bool SubmitToThread(std::function<void()>&&) override;
+                bool SubmitToThread(Task&&) override;
 
             private:
-                Aws::Queue<std::function<void()>*> m_tasks;
+                Aws::Queue<Task> m_tasks;
                 std::mutex m_queueLock;
                 Aws::Utils::Threading::Semaphore m_sync;
                 Aws::Vector<ThreadTask*> m_threadTaskHandles;
@@ -115,9 +124,9 @@ namespace Aws
                 OverflowPolicy m_overflowPolicy;
 
                 /**
-                 * Once you call this, you are responsible for freeing the memory pointed to by task.
+                 * Moves the next task into task, returns false if there was none.
                  */
-                std::function<void()>* PopTask();
+                bool PopTask(Task& task);
                 bool HasTasks();
 
                 friend class ThreadTask;
@@ -0,0 +1,171 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            static const char* TASK_ALLOCATION_TAG = "Aws::Utils::Threading::Task";
+
+            /**
+             * Move only, type erased void() callable that Executors run.
+             * Unlike std::function, it accepts move only callables (e.g. std::packaged_task or lambdas owning a request)
+             * and stores callables up to INLINE_STORAGE_SIZE bytes inline, without any allocation.
+             */
+            class Task
+            {
+            public:
+                static const std::size_t INLINE_STORAGE_SIZE = 8 * sizeof(void*);
+
+                Task() : m_operations(nullptr)
+                {
+                }
+
+                template<typename Fn, typename = typename std::enable_if<!std::is_same<typename std::decay<Fn>::type, Task>::value>::type>
+                Task(Fn&& fn) : m_operations(nullptr)
+                {
+                    typedef typename std::decay<Fn>::type Callable;
+                    Construct<Callable>(std::forward<Fn>(fn), std::integral_constant<bool, StoredInline<Callable>::value>());
+                }
+
+                Task(Task&& other) : m_operations(other.m_operations)
+                {
+                    if (m_operations)
+                    {
+                        m_operations->move(&m_storage, &other.m_storage);
+                        other.m_operations = nullptr;
+                    }
+                }
+
+                Task& operator=(Task&& other)
+                {
+                    if (this != &other)
+                    {
+                        Reset();
+                        if (other.m_operations)
+                        {
+                            other.m_operations->move(&m_storage, &other.m_storage);
+                            m_operations = other.m_operations;
+                            other.m_operations = nullptr;
+                        }
+                    }
+                    return *this;
+                }
+
+                Task(const Task&) = delete;
+                Task& operator=(const Task&) = delete;
+
+                ~Task()
+                {
+                    Reset();
+                }
+
+                /**
+                 * Runs the callable. Must not be called on an empty task.
+                 */
+                void operator()()
+                {
+                    m_operations->invoke(&m_storage);
+                }
+
+                explicit operator bool() const
+                {
+                    return m_operations != nullptr;
+                }
+
+            private:
+                struct Operations
+                {
+                    void (*invoke)(void* storage);
+                    void (*move)(void* destination, void* source);
+                    void (*destroy)(void* storage);
+                };
+
+                typedef typename std::aligned_storage<INLINE_STORAGE_SIZE, alignof(std::max_align_t)>::type Storage;
+
+                template<typename Callable>
+                struct StoredInline
+                {
+                    static const bool value = sizeof(Callable) <= sizeof(Storage) &&
+                        alignof(Storage) % alignof(Callable) == 0 &&
+                        std::is_nothrow_move_constructible<Callable>::value;
+                };
+
+                template<typename Callable>
+                struct InlineOperations
+                {
+                    static void Invoke(void* storage) { (*static_cast<Callable*>(storage))(); }
+                    static void Move(void* destination, void* source)
+                    {
+                        new (destination) Callable(std::move(*static_cast<Callable*>(source)));
+                        static_cast<Callable*>(source)->~Callable();
+                    }
+                    static void Destroy(void* storage) { static_cast<Callable*>(storage)->~Callable(); }
+                };
+
+                template<typename Callable>
+                struct HeapOperations
+                {
+                    static void Invoke(void* storage) { (**static_cast<Callable**>(storage))(); }
+                    static void Move(void* destination, void* source)
+                    {
+                        *static_cast<Callable**>(destination) = *static_cast<Callable**>(source);
+                        *static_cast<Callable**>(source) = nullptr;
+                    }
+                    static void Destroy(void* storage) { Aws::Delete(*static_cast<Callable**>(storage)); }
+                };
+
+                template<typename Callable, typename Fn>
+                void Construct(Fn&& fn, std::true_type)
+                {
+                    static const Operations operations = { &InlineOperations<Callable>::Invoke, &InlineOperations<Callable>::Move, &InlineOperations<Callable>::Destroy };
+                    new (&m_storage) Callable(std::forward<Fn>(fn));
+                    m_operations = &operations;
+                }
+
+                template<typename Callable, typename Fn>
+                void Construct(Fn&& fn, std::false_type)
+                {
+                    static const Operations operations = { &HeapOperations<Callable>::Invoke, &HeapOperations<Callable>::Move, &HeapOperations<Callable>::Destroy };
+                    *reinterpret_cast<Callable**>(&m_storage) = Aws::New<Callable>(TASK_ALLOCATION_TAG, std::forward<Fn>(fn));
+                    m_operations = &operations;
+                }
+
+                void Reset()
+                {
+                    if (m_operations)
+                    {
+                        m_operations->destroy(&m_storage);
+                        m_operations = nullptr;
+                    }
+                }
+
+                Storage m_storage;
+                const Operations* m_operations;
+            };
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
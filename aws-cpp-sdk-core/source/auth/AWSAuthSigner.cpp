@@ -28,6 +28,8 @@
 #include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <iomanip>
 #include <math.h>
@@ -109,38 +111,71 @@ static Aws::String CanonicalizeRequestSigningString(HttpRequest& request, bool u
     return signingStringStream.str();
 }
 
-static Http::HeaderValueCollection CanonicalizeHeaders(Http::HeaderValueCollection&& headers)
+// Records how long the credentials provider takes when the request is being timed.
+static AWSCredentials GetCredentialsForRequest(AWSCredentialsProvider& credentialsProvider, HttpRequest& request)
 {
-    Http::HeaderValueCollection canonicalHeaders;
-    for (const auto& header : headers)
+    if (!request.AreTimingsEnabled())
     {
-        auto trimmedHeaderName = StringUtils::Trim(header.first.c_str());
-        auto trimmedHeaderValue = StringUtils::Trim(header.second.c_str());
+        return credentialsProvider.GetAWSCredentials();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    AWSCredentials credentials = credentialsProvider.GetAWSCredentials();
+    request.SetTiming(HttpRequestTiming::CredentialsFetch,
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+    return credentials;
+}
 
-        //multiline gets converted to line1,line2,etc...
-        auto headerMultiLine = StringUtils::SplitOnLine(trimmedHeaderValue);
-        Aws::String headerValue = headerMultiLine.size() == 0 ? "" : headerMultiLine[0];
+static Aws::String CanonicalizeHeaderValue(const Aws::String& value)
+{
+    //multiline gets converted to line1,line2,etc...
+    auto headerMultiLine = StringUtils::SplitOnLine(value);
+    Aws::String headerValue = headerMultiLine.size() == 0 ? "" : headerMultiLine[0];
 
-        if (headerMultiLine.size() > 1)
+    if (headerMultiLine.size() > 1)
+    {
+        for(size_t i = 1; i < headerMultiLine.size(); ++i)
         {
-            for(size_t i = 1; i < headerMultiLine.size(); ++i)
-            {
-                headerValue += ",";
-                headerValue += StringUtils::Trim(headerMultiLine[i].c_str());
-            }
+            headerValue += ",";
+            headerValue += StringUtils::Trim(headerMultiLine[i].c_str());
         }
+    }
+
+    //duplicate spaces need to be converted to one.
+    Aws::String::iterator new_end =
+        std::unique(headerValue.begin(), headerValue.end(),
+            [=](char lhs, char rhs) { return (lhs == rhs) && (lhs == ' '); }
+    );
+    headerValue.erase(new_end, headerValue.end());
 
-        //duplicate spaces need to be converted to one.
-        Aws::String::iterator new_end =
-            std::unique(headerValue.begin(), headerValue.end(),
-                [=](char lhs, char rhs) { return (lhs == rhs) && (lhs == ' '); }
-        );
-        headerValue.erase(new_end, headerValue.end());
+    return headerValue;
+}
 
-        canonicalHeaders[trimmedHeaderName] = headerValue;       
+// The collection already stores header names lower cased and names and values trimmed, so most values are canonical as they are.
+static void AppendCanonicalHeaderValue(const Aws::String& value, Aws::String& out)
+{
+    if (value.find('\n') == Aws::String::npos && value.find("  ") == Aws::String::npos)
+    {
+        out.append(value);
+    }
+    else
+    {
+        out.append(CanonicalizeHeaderValue(value));
+    }
+}
+
+static Aws::Vector<const Http::HeaderValuePair*> SortHeadersByName(const Http::HttpHeaderCollection& headers)
+{
+    Aws::Vector<const Http::HeaderValuePair*> sortedHeaders;
+    sortedHeaders.reserve(headers.size());
+    for (const auto& header : headers)
+    {
+        sortedHeaders.push_back(&header);
     }
 
-    return canonicalHeaders;
+    std::sort(sortedHeaders.begin(), sortedHeaders.end(),
+        [](const Http::HeaderValuePair* lhs, const Http::HeaderValuePair* rhs) { return lhs->first < rhs->first; });
+    return sortedHeaders;
 }
 
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
@@ -167,7 +202,8 @@ AWSAuthV4Signer::~AWSAuthV4Signer()
 
 bool AWSAuthV4Signer::ShouldSignHeader(const Aws::String& header) const
 {
-    return m_unsignedHeaders.find(Aws::Utils::StringUtils::ToLower(header.c_str())) == m_unsignedHeaders.cend();
+    // header names coming from HttpHeaderCollection are lower case already
+    return m_unsignedHeaders.find(header) == m_unsignedHeaders.cend();
 }
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
@@ -177,7 +213,7 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody) const
 {
-    AWSCredentials credentials = m_credentialsProvider->GetAWSCredentials();
+    AWSCredentials credentials = GetCredentialsForRequest(*m_credentialsProvider, request);
 
     //don't sign anonymous requests
     if (credentials.GetAWSAccessKeyId().empty() || credentials.GetAWSSecretKey().empty())
@@ -229,23 +265,23 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request, bool signBody
     Aws::String dateHeaderValue = now.ToGmtString(LONG_DATE_FORMAT_STR);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
+    Aws::String canonicalHeadersString;
+    Aws::String signedHeadersValue;
 
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
+    for (const auto* header : SortHeadersByName(request.GetHeaderCollection()))
     {
-        if(ShouldSignHeader(header.first))
+        if(ShouldSignHeader(header->first))
         {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
+            canonicalHeadersString.append(header->first).append(":");
+            AppendCanonicalHeaderValue(header->second, canonicalHeadersString);
+            canonicalHeadersString.append(NEWLINE);
+            signedHeadersValue.append(header->first).append(";");
         }
     }
 
-    Aws::String canonicalHeadersString = headersStream.str();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
 
     //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
     //remove that last semi-colon
     if (!signedHeadersValue.empty())
     {
@@ -307,7 +343,7 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
 
 bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char* region, const char* serviceName, long long expirationTimeInSeconds) const
 {
-    AWSCredentials credentials = m_credentialsProvider->GetAWSCredentials();
+    AWSCredentials credentials = GetCredentialsForRequest(*m_credentialsProvider, request);
 
     //don't sign anonymous requests
     if (credentials.GetAWSAccessKeyId().empty() || credentials.GetAWSSecretKey().empty())
@@ -331,22 +367,23 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, const char
 
     request.SetHeaderValue(Http::HOST_HEADER, request.GetHeaderValue(Http::HOST_HEADER));
 
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-    for (const auto& header : CanonicalizeHeaders(request.GetHeaders()))
+    Aws::String canonicalHeadersString;
+    Aws::String signedHeadersValue;
+
+    for (const auto* header : SortHeadersByName(request.GetHeaderCollection()))
     {
-        if(ShouldSignHeader(header.first))
+        if(ShouldSignHeader(header->first))
         {
-            headersStream << header.first.c_str() << ":" << header.second.c_str() << NEWLINE;
-            signedHeadersStream << header.first.c_str() << ";";
+            canonicalHeadersString.append(header->first).append(":");
+            AppendCanonicalHeaderValue(header->second, canonicalHeadersString);
+            canonicalHeadersString.append(NEWLINE);
+            signedHeadersValue.append(header->first).append(";");
         }
     }
 
-    Aws::String canonicalHeadersString = headersStream.str();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
 
     //calculate signed headers parameter
-    Aws::String signedHeadersValue(signedHeadersStream.str());
     //remove that last semi-colon
     if (!signedHeadersValue.empty())
     {
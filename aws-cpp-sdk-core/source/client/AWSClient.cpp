@@ -39,6 +39,7 @@
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/crypto/Factories.h>
 #include <aws/core/http/URI.h>
+#include <aws/core/client/RequestTracer.h>
 
 using namespace Aws;
 using namespace Aws::Client;
@@ -56,6 +57,48 @@ static const std::chrono::milliseconds TIME_DIFF_MAX = std::chrono::minutes(4);
 //-4 Minutes
 static const std::chrono::milliseconds TIME_DIFF_MIN = std::chrono::minutes(-4);
 
+static std::chrono::steady_clock::time_point TraceStart(const RequestTracer* tracer)
+{
+    return tracer ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+}
+
+static void TraceEvent(RequestTracer* tracer, const char* requestName, RequestTraceStage stage, std::chrono::microseconds duration)
+{
+    RequestTraceEvent event;
+    event.requestName = requestName ? requestName : "";
+    event.stage = stage;
+    event.duration = duration;
+    tracer->OnTraceEvent(event);
+}
+
+static void TraceStage(RequestTracer* tracer, const char* requestName, RequestTraceStage stage, std::chrono::steady_clock::time_point start)
+{
+    if (tracer)
+    {
+        TraceEvent(tracer, requestName, stage, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start));
+    }
+}
+
+// Reports a duration the signer or the http client recorded on the request, if it recorded one.
+static void TraceHttpRequestTiming(RequestTracer* tracer, const char* requestName, const HttpRequest& httpRequest,
+    HttpRequestTiming timing, RequestTraceStage stage)
+{
+    if (tracer && httpRequest.GetTiming(timing).count() >= 0)
+    {
+        TraceEvent(tracer, requestName, stage, httpRequest.GetTiming(timing));
+    }
+}
+
+static void TraceHttpClientTimings(RequestTracer* tracer, const char* requestName, const HttpRequest& httpRequest)
+{
+    TraceHttpRequestTiming(tracer, requestName, httpRequest, HttpRequestTiming::ConnectionAcquire, RequestTraceStage::ConnectionAcquire);
+    TraceHttpRequestTiming(tracer, requestName, httpRequest, HttpRequestTiming::DnsLookup, RequestTraceStage::DnsLookup);
+    TraceHttpRequestTiming(tracer, requestName, httpRequest, HttpRequestTiming::Connect, RequestTraceStage::Connect);
+    TraceHttpRequestTiming(tracer, requestName, httpRequest, HttpRequestTiming::TlsHandshake, RequestTraceStage::TlsHandshake);
+    TraceHttpRequestTiming(tracer, requestName, httpRequest, HttpRequestTiming::TimeToFirstByte, RequestTraceStage::TimeToFirstByte);
+    TraceHttpRequestTiming(tracer, requestName, httpRequest, HttpRequestTiming::Transfer, RequestTraceStage::Transfer);
+}
+
 static CoreErrors GuessBodylessErrorType(Aws::Http::HttpResponseCode responseCode)
 {
     switch (responseCode)
@@ -81,7 +124,8 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_requestTracer(configuration.requestTracer)
 {
 }
 
@@ -96,7 +140,8 @@ AWSClient::AWSClient(const Aws::Client::ClientConfiguration& configuration,
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hash(Aws::Utils::Crypto::CreateMD5Implementation()),
-    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment)
+    m_enableClockSkewAdjustment(configuration.enableClockSkewAdjustment),
+    m_requestTracer(configuration.requestTracer)
 {
 }
 
@@ -195,7 +240,9 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri,
                 request.GetRequestRetryHandler()(request);
             }
 
+            auto sleepStart = TraceStart(m_requestTracer.get());
             m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            TraceStage(m_requestTracer.get(), request.GetServiceRequestName(), RequestTraceStage::RetrySleep, sleepStart);
         }
     }
 }
@@ -212,7 +259,9 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::Http::URI& uri, Ht
         else
         {
             long sleepMillis = m_retryStrategy->CalculateDelayBeforeNextRetry(outcome.GetError(), retries);
+            auto sleepStart = TraceStart(m_requestTracer.get());
             m_httpClient->RetryRequestSleep(std::chrono::milliseconds(sleepMillis));
+            TraceStage(m_requestTracer.get(), requestName, RequestTraceStage::RetrySleep, sleepStart);
         }
     }
 }
@@ -231,23 +280,41 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::Http::URI& uri,
     HttpMethod method,
     const char* signerName) const
 {
+    RequestTracer* tracer = m_requestTracer.get();
+    const char* requestName = request.GetServiceRequestName();
+    auto attemptStart = TraceStart(tracer);
+
     std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
+    if (tracer)
+    {
+        httpRequest->EnableTimings();
+    }
     BuildHttpRequest(request, httpRequest);
+    TraceStage(tracer, requestName, RequestTraceStage::Serialization, attemptStart);
+
     auto signer = GetSignerByName(signerName);
+    auto signingStart = TraceStart(tracer);
     if (!signer->SignRequest(*httpRequest, request.SignBody()))
     {
         AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
         return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
     }
+    TraceHttpRequestTiming(tracer, requestName, *httpRequest, HttpRequestTiming::CredentialsFetch, RequestTraceStage::CredentialsFetch);
+    TraceStage(tracer, requestName, RequestTraceStage::Signing, signingStart);
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
     std::shared_ptr<HttpResponse> httpResponse(
         m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    TraceHttpClientTimings(tracer, requestName, *httpRequest);
+    TraceStage(tracer, requestName, RequestTraceStage::Attempt, attemptStart);
 
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
-        return HttpResponseOutcome(BuildAWSError(httpResponse));
+        auto parseStart = TraceStart(tracer);
+        HttpResponseOutcome errorOutcome(BuildAWSError(httpResponse));
+        TraceStage(tracer, requestName, RequestTraceStage::ResponseParse, parseStart);
+        return errorOutcome;
     }
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
@@ -257,15 +324,23 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::Http::URI& uri,
 
 HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::Http::URI& uri, HttpMethod method, const char* signerName, const char* requestName) const
 {
-    AWS_UNREFERENCED_PARAM(requestName);
+    RequestTracer* tracer = m_requestTracer.get();
+    auto attemptStart = TraceStart(tracer);
 
     std::shared_ptr<HttpRequest> httpRequest(CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod));
+    if (tracer)
+    {
+        httpRequest->EnableTimings();
+    }
     auto signer = GetSignerByName(signerName);
+    auto signingStart = TraceStart(tracer);
     if (!signer->SignRequest(*httpRequest))
     {
         AWS_LOGSTREAM_ERROR(AWS_CLIENT_LOG_TAG, "Request signing failed. Returning error.");
         return HttpResponseOutcome(); // TODO: make a real error when error revamp reaches branch (SIGNING_ERROR)
     }
+    TraceHttpRequestTiming(tracer, requestName, *httpRequest, HttpRequestTiming::CredentialsFetch, RequestTraceStage::CredentialsFetch);
+    TraceStage(tracer, requestName, RequestTraceStage::Signing, signingStart);
 
     //user agent and headers like that shouldn't be signed for the sake of compatibility with proxies which MAY mutate that header.
     AddCommonHeaders(*httpRequest);
@@ -273,11 +348,16 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::Http::URI& uri, Http
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request Successfully signed");
     std::shared_ptr<HttpResponse> httpResponse(
         m_httpClient->MakeRequest(httpRequest, m_readRateLimiter.get(), m_writeRateLimiter.get()));
+    TraceHttpClientTimings(tracer, requestName, *httpRequest);
+    TraceStage(tracer, requestName, RequestTraceStage::Attempt, attemptStart);
 
     if (DoesResponseGenerateError(httpResponse))
     {
         AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned error. Attempting to generate appropriate error codes from response");
-        return HttpResponseOutcome(BuildAWSError(httpResponse));
+        auto parseStart = TraceStart(tracer);
+        HttpResponseOutcome errorOutcome(BuildAWSError(httpResponse));
+        TraceStage(tracer, requestName, RequestTraceStage::ResponseParse, parseStart);
+        return errorOutcome;
     }
 
     AWS_LOGSTREAM_DEBUG(AWS_CLIENT_LOG_TAG, "Request returned successful response.");
@@ -537,13 +617,18 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
     }
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
+    {
+        auto parseStart = TraceStart(GetRequestTracer());
+        JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
+        TraceStage(GetRequestTracer(), request.GetServiceRequestName(), RequestTraceStage::ResponseParse, parseStart);
+
         //this is stupid, but gcc doesn't pick up the covariant on the dereference so we have to give it a little hint.
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(httpOutcome.GetResult()->GetResponseBody()),
-        httpOutcome.GetResult()->GetHeaders(),
-        httpOutcome.GetResult()->GetResponseCode()));
+        return JsonOutcome(AmazonWebServiceResult<JsonValue>(std::move(jsonValue),
+            httpOutcome.GetResult()->GetHeaders(),
+            httpOutcome.GetResult()->GetResponseCode()));
+    }
 
-    else
-        return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
+    return JsonOutcome(AmazonWebServiceResult<JsonValue>(JsonValue(), httpOutcome.GetResult()->GetHeaders()));
 }
 
 JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
@@ -559,7 +644,9 @@ JsonOutcome AWSJsonClient::MakeRequest(const Aws::Http::URI& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
+        auto parseStart = TraceStart(GetRequestTracer());
         JsonValue jsonValue(httpOutcome.GetResult()->GetResponseBody());
+        TraceStage(GetRequestTracer(), requestName, RequestTraceStage::ResponseParse, parseStart);
         if (!jsonValue.WasParseSuccessful())
         {
             return JsonOutcome(AWSError<CoreErrors>(CoreErrors::UNKNOWN, "Json Parser Error", jsonValue.GetErrorMessage(), false));
@@ -635,7 +722,9 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
+        auto parseStart = TraceStart(GetRequestTracer());
         XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
+        TraceStage(GetRequestTracer(), request.GetServiceRequestName(), RequestTraceStage::ResponseParse, parseStart);
 
         if (!xmlDoc.WasParseSuccessful())
         {
@@ -663,8 +752,10 @@ XmlOutcome AWSXMLClient::MakeRequest(const Aws::Http::URI& uri,
 
     if (httpOutcome.GetResult()->GetResponseBody().tellp() > 0)
     {
-        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(
-            XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody()),
+        auto parseStart = TraceStart(GetRequestTracer());
+        XmlDocument xmlDoc = XmlDocument::CreateFromXmlStream(httpOutcome.GetResult()->GetResponseBody());
+        TraceStage(GetRequestTracer(), requestName, RequestTraceStage::ResponseParse, parseStart);
+        return XmlOutcome(AmazonWebServiceResult<XmlDocument>(std::move(xmlDoc),
             httpOutcome.GetResult()->GetHeaders(), httpOutcome.GetResult()->GetResponseCode()));
     }
 
@@ -23,52 +23,52 @@ using namespace Aws::Http;
 
 //we can't use a static map here due to memory allocation ordering. 
 //instead we compute the hash of these strings to avoid so many string compares.
-static const int INCOMPLETE_SIGNATURE_EXCEPTION_HASH = HashingUtils::HashString("IncompleteSignatureException");
-static const int INCOMPLETE_SIGNATURE_HASH = HashingUtils::HashString("IncompleteSignature");
-static const int INVALID_SIGNATURE_EXCEPTION_HASH = HashingUtils::HashString("InvalidSignatureException");
-static const int INVALID_SIGNATURE_HASH = HashingUtils::HashString("InvalidSignature");
-static const int INTERNAL_FAILURE_HASH = HashingUtils::HashString("InternalFailure");
-static const int INTERNAL_SERVER_ERROR_HASH = HashingUtils::HashString("InternalServerError");
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalError");
-static const int INVALID_ACTION_HASH = HashingUtils::HashString("InvalidAction");
-static const int INVALID_CLIENT_TOKEN_ID_HASH = HashingUtils::HashString("InvalidClientTokenId");
-static const int INVALID_CLIENT_TOKEN_ID_EXCEPTION_HASH = HashingUtils::HashString("InvalidClientTokenIdException");
-static const int INVALID_PARAMETER_COMBINATION_HASH = HashingUtils::HashString("InvalidParameterCombination");
-static const int INVALID_PARAMETER_VALUE_HASH = HashingUtils::HashString("InvalidParameterValue");
-static const int INVALID_QUERY_PARAMETER_HASH = HashingUtils::HashString("InvalidQueryParameter");
-static const int INVALID_QUERY_PARAMETER_EXCEPTION_HASH = HashingUtils::HashString("InvalidQueryParameterException");
-static const int MALFORMED_QUERY_STRING_HASH = HashingUtils::HashString("MalformedQueryString");
-static const int MALFORMED_QUERY_STRING_EXCEPTION_HASH = HashingUtils::HashString("MalformedQueryStringException");
-static const int MISSING_AUTHENTICATION_TOKEN_HASH = HashingUtils::HashString("MissingAuthenticationToken");
-static const int MISSING_AUTHENTICATION_TOKEN_EXCEPTION_HASH = HashingUtils::HashString("MissingAuthenticationTokenException");
-static const int MISSING_PARAMETER_HASH = HashingUtils::HashString("MissingParameterException");
-static const int OPT_IN_REQUIRED_HASH = HashingUtils::HashString("OptInRequired");
-static const int REQUEST_EXPIRED_HASH = HashingUtils::HashString("RequestExpired");
-static const int REQUEST_EXPIRED_EXCEPTION_HASH = HashingUtils::HashString("RequestExpiredException");
-static const int SERVICE_UNAVAILABLE_HASH = HashingUtils::HashString("ServiceUnavailable");
-static const int SERVICE_UNAVAILABLE_EXCEPTION_HASH = HashingUtils::HashString("ServiceUnavailableException");
-static const int SERVICE_UNAVAILABLE_ERROR_HASH = HashingUtils::HashString("ServiceUnavailableError");
-static const int THROTTLING_HASH = HashingUtils::HashString("Throttling");
-static const int THROTTLING_EXCEPTION_HASH = HashingUtils::HashString("ThrottlingException");
-static const int THROTTLED_EXCEPTION_HASH = HashingUtils::HashString("ThrottledException");
-static const int VALIDATION_ERROR_HASH = HashingUtils::HashString("ValidationError");
-static const int VALIDATION_ERROR_EXCEPTION_HASH = HashingUtils::HashString("ValidationErrorException");
-static const int VALIDATION_EXCEPTION_HASH = HashingUtils::HashString("ValidationException");
-static const int ACCESS_DENIED_HASH = HashingUtils::HashString("AccessDenied");
-static const int ACCESS_DENIED_EXCEPTION_HASH = HashingUtils::HashString("AccessDeniedException");
-static const int RESOURCE_NOT_FOUND_HASH = HashingUtils::HashString("ResourceNotFound");
-static const int RESOURCE_NOT_FOUND_EXCEPTION_HASH = HashingUtils::HashString("ResourceNotFoundException");
-static const int UNRECOGNIZED_CLIENT_HASH = HashingUtils::HashString("UnrecognizedClient");
-static const int UNRECOGNIZED_CLIENT_EXCEPTION_HASH = HashingUtils::HashString("UnrecognizedClientException");
-static const int SLOW_DOWN_HASH = HashingUtils::HashString("SlowDown");
-static const int SLOW_DOWN_EXCEPTION_HASH = HashingUtils::HashString("SlowDownException");
-static const int SIGNATURE_DOES_NOT_MATCH_HASH = HashingUtils::HashString("SignatureDoesNotMatch");
-static const int SIGNATURE_DOES_NOT_MATCH_EXCEPTION_HASH = HashingUtils::HashString("SignatureDoesNotMatchException");
-static const int INVALID_ACCESS_KEY_ID_HASH = HashingUtils::HashString("InvalidAccessKeyId");
-static const int INVALID_ACCESS_KEY_ID_EXCEPTION_HASH = HashingUtils::HashString("InvalidAccessKeyIdException");
-static const int REQUEST_TIME_TOO_SKEWED_HASH = HashingUtils::HashString("RequestTimeTooSkewed");
-static const int REQUEST_TIME_TOO_SKEWED_EXCEPTION_HASH = HashingUtils::HashString("RequestTimeTooSkewedException");
-static const int REQUEST_TIMEOUT_HASH = HashingUtils::HashString("RequestTimeout");
+static constexpr int INCOMPLETE_SIGNATURE_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("IncompleteSignatureException");
+static constexpr int INCOMPLETE_SIGNATURE_HASH = HashingUtils::CompileTimeHashString("IncompleteSignature");
+static constexpr int INVALID_SIGNATURE_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("InvalidSignatureException");
+static constexpr int INVALID_SIGNATURE_HASH = HashingUtils::CompileTimeHashString("InvalidSignature");
+static constexpr int INTERNAL_FAILURE_HASH = HashingUtils::CompileTimeHashString("InternalFailure");
+static constexpr int INTERNAL_SERVER_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalServerError");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalError");
+static constexpr int INVALID_ACTION_HASH = HashingUtils::CompileTimeHashString("InvalidAction");
+static constexpr int INVALID_CLIENT_TOKEN_ID_HASH = HashingUtils::CompileTimeHashString("InvalidClientTokenId");
+static constexpr int INVALID_CLIENT_TOKEN_ID_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("InvalidClientTokenIdException");
+static constexpr int INVALID_PARAMETER_COMBINATION_HASH = HashingUtils::CompileTimeHashString("InvalidParameterCombination");
+static constexpr int INVALID_PARAMETER_VALUE_HASH = HashingUtils::CompileTimeHashString("InvalidParameterValue");
+static constexpr int INVALID_QUERY_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidQueryParameter");
+static constexpr int INVALID_QUERY_PARAMETER_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("InvalidQueryParameterException");
+static constexpr int MALFORMED_QUERY_STRING_HASH = HashingUtils::CompileTimeHashString("MalformedQueryString");
+static constexpr int MALFORMED_QUERY_STRING_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("MalformedQueryStringException");
+static constexpr int MISSING_AUTHENTICATION_TOKEN_HASH = HashingUtils::CompileTimeHashString("MissingAuthenticationToken");
+static constexpr int MISSING_AUTHENTICATION_TOKEN_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("MissingAuthenticationTokenException");
+static constexpr int MISSING_PARAMETER_HASH = HashingUtils::CompileTimeHashString("MissingParameterException");
+static constexpr int OPT_IN_REQUIRED_HASH = HashingUtils::CompileTimeHashString("OptInRequired");
+static constexpr int REQUEST_EXPIRED_HASH = HashingUtils::CompileTimeHashString("RequestExpired");
+static constexpr int REQUEST_EXPIRED_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("RequestExpiredException");
+static constexpr int SERVICE_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("ServiceUnavailable");
+static constexpr int SERVICE_UNAVAILABLE_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("ServiceUnavailableException");
+static constexpr int SERVICE_UNAVAILABLE_ERROR_HASH = HashingUtils::CompileTimeHashString("ServiceUnavailableError");
+static constexpr int THROTTLING_HASH = HashingUtils::CompileTimeHashString("Throttling");
+static constexpr int THROTTLING_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("ThrottlingException");
+static constexpr int THROTTLED_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("ThrottledException");
+static constexpr int VALIDATION_ERROR_HASH = HashingUtils::CompileTimeHashString("ValidationError");
+static constexpr int VALIDATION_ERROR_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("ValidationErrorException");
+static constexpr int VALIDATION_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("ValidationException");
+static constexpr int ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("AccessDenied");
+static constexpr int ACCESS_DENIED_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("AccessDeniedException");
+static constexpr int RESOURCE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ResourceNotFound");
+static constexpr int RESOURCE_NOT_FOUND_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("ResourceNotFoundException");
+static constexpr int UNRECOGNIZED_CLIENT_HASH = HashingUtils::CompileTimeHashString("UnrecognizedClient");
+static constexpr int UNRECOGNIZED_CLIENT_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("UnrecognizedClientException");
+static constexpr int SLOW_DOWN_HASH = HashingUtils::CompileTimeHashString("SlowDown");
+static constexpr int SLOW_DOWN_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("SlowDownException");
+static constexpr int SIGNATURE_DOES_NOT_MATCH_HASH = HashingUtils::CompileTimeHashString("SignatureDoesNotMatch");
+static constexpr int SIGNATURE_DOES_NOT_MATCH_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("SignatureDoesNotMatchException");
+static constexpr int INVALID_ACCESS_KEY_ID_HASH = HashingUtils::CompileTimeHashString("InvalidAccessKeyId");
+static constexpr int INVALID_ACCESS_KEY_ID_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("InvalidAccessKeyIdException");
+static constexpr int REQUEST_TIME_TOO_SKEWED_HASH = HashingUtils::CompileTimeHashString("RequestTimeTooSkewed");
+static constexpr int REQUEST_TIME_TOO_SKEWED_EXCEPTION_HASH = HashingUtils::CompileTimeHashString("RequestTimeTooSkewedException");
+static constexpr int REQUEST_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("RequestTimeout");
 
 AWSError<CoreErrors> CoreErrorsMapper::GetErrorForName(const char* errorName)
 {
@@ -0,0 +1,154 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/HttpHeaderCollection.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+
+// most requests carry fewer headers than this; reserving up front saves the regrowths while a request is built
+static const std::size_t INITIAL_HEADER_CAPACITY = 16;
+
+static inline char AsciiToLower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+static inline bool IsHeaderWhitespace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+}
+
+// stored names are already lower case, so only the name being looked up needs folding
+static bool EqualsLowerCaseName(const Aws::String& storedName, const char* headerName, std::size_t length)
+{
+    if (storedName.size() != length)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (storedName[i] != AsciiToLower(headerName[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// trims whitespace off both ends of [*begin, *begin + *length)
+static void TrimRange(const char** begin, std::size_t* length)
+{
+    const char* first = *begin;
+    const char* last = first + *length;
+    while (first < last && IsHeaderWhitespace(*first))
+    {
+        ++first;
+    }
+    while (last > first && IsHeaderWhitespace(*(last - 1)))
+    {
+        --last;
+    }
+    *begin = first;
+    *length = static_cast<std::size_t>(last - first);
+}
+
+static void AssignTrimmed(Aws::String& target, const Aws::String& value)
+{
+    const char* begin = value.c_str();
+    std::size_t length = value.size();
+    TrimRange(&begin, &length);
+    target.assign(begin, length);
+}
+
+HttpHeaderCollection::HttpHeaderCollection()
+{
+    m_headers.reserve(INITIAL_HEADER_CAPACITY);
+}
+
+std::size_t HttpHeaderCollection::IndexOf(const char* headerName, std::size_t length) const
+{
+    for (std::size_t i = 0; i < m_headers.size(); ++i)
+    {
+        if (EqualsLowerCaseName(m_headers[i].first, headerName, length))
+        {
+            return i;
+        }
+    }
+    return m_headers.size();
+}
+
+const Aws::String* HttpHeaderCollection::Find(const char* headerName) const
+{
+    std::size_t index = IndexOf(headerName, std::strlen(headerName));
+    return index < m_headers.size() ? &m_headers[index].second : nullptr;
+}
+
+const Aws::String* HttpHeaderCollection::Find(const Aws::String& headerName) const
+{
+    std::size_t index = IndexOf(headerName.c_str(), headerName.size());
+    return index < m_headers.size() ? &m_headers[index].second : nullptr;
+}
+
+void HttpHeaderCollection::Set(const char* headerName, const Aws::String& headerValue)
+{
+    Set(headerName, std::strlen(headerName), headerValue);
+}
+
+void HttpHeaderCollection::Set(const Aws::String& headerName, const Aws::String& headerValue)
+{
+    Set(headerName.c_str(), headerName.size(), headerValue);
+}
+
+void HttpHeaderCollection::Set(const char* headerName, std::size_t length, const Aws::String& headerValue)
+{
+    TrimRange(&headerName, &length);
+
+    std::size_t index = IndexOf(headerName, length);
+    if (index < m_headers.size())
+    {
+        // reuses the storage of the previous value
+        AssignTrimmed(m_headers[index].second, headerValue);
+        return;
+    }
+
+    m_headers.emplace_back();
+    HeaderValuePair& header = m_headers.back();
+    header.first.resize(length);
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        header.first[i] = AsciiToLower(headerName[i]);
+    }
+    AssignTrimmed(header.second, headerValue);
+}
+
+bool HttpHeaderCollection::Erase(const char* headerName)
+{
+    std::size_t index = IndexOf(headerName, std::strlen(headerName));
+    if (index == m_headers.size())
+    {
+        return false;
+    }
+
+    m_headers.erase(m_headers.begin() + index);
+    return true;
+}
+
+HeaderValueCollection HttpHeaderCollection::ToHeaderValueCollection() const
+{
+    return HeaderValueCollection(m_headers.begin(), m_headers.end());
+}
@@ -20,6 +20,7 @@
 #include <aws/core/utils/memory/stl/AWSSet.h>
 
 #include <cstdlib>
+#include <cstring>
 #include <cctype>
 #include <cassert>
 #include <algorithm>
@@ -110,53 +111,77 @@ void URI::SetScheme(Scheme value)
     }
 }
 
-Aws::String URI::URLEncodePathRFC3986(const Aws::String& path)
+// characters appearing unescaped in a URL path according to RFC 3986
+static bool IsUnescapedPathCharacter(unsigned char c)
 {
-    if(path.empty())
+    if(std::isalnum(c)) // §2.3 unreserved characters. alnum results in UB if the value of c is not unsigned char & is not EOF
     {
-        return path;
+        return true;
+    }
+    switch(c)
+    {
+        // §2.3 unreserved characters
+        case '-': case '_': case '.': case '~':
+        // The path section of the URL allow reserved characters to appear unescaped
+        // RFC 3986 §2.2 Reserved characters
+        // NOTE: this implementation does not accurately implement the RFC on purpose to accommodate for
+        // discrepancies in the implementations of URL encoding between AWS services for legacy reasons.
+        case '$': case '&': case ',': case '/':
+        case ':': case ';': case '=': case '@':
+            return true;
+        default:
+            return false;
     }
+}
 
-    const Aws::Vector<Aws::String> pathParts = StringUtils::Split(path, '/');
-    Aws::StringStream ss;
-    ss << std::hex << std::uppercase;
+// Appends the RFC 3986 encoding of path to out. Empty segments are dropped, as StringUtils::Split would.
+static void AppendURLEncodedPathRFC3986(const Aws::String& path, Aws::String& out)
+{
+    static const char HEX_DIGITS[] = "0123456789ABCDEF";
 
-    // escape characters appearing in a URL path according to RFC 3986
-    for (const auto& segment : pathParts)
+    bool inSegment = false;
+    for(unsigned char c : path)
     {
-        ss << '/';
-        for(unsigned char c : segment) // alnum results in UB if the value of c is not unsigned char & is not EOF
+        if(c == '/')
         {
-            if(std::isalnum(c)) // §2.3 unreserved characters
-            {
-                ss << c;
-                continue;
-            }
-            switch(c)
-            {
-                // §2.3 unreserved characters
-                case '-': case '_': case '.': case '~':
-                // The path section of the URL allow reserved characters to appear unescaped
-                // RFC 3986 §2.2 Reserved characters
-                // NOTE: this implementation does not accurately implement the RFC on purpose to accommodate for
-                // discrepancies in the implementations of URL encoding between AWS services for legacy reasons.
-                case '$': case '&': case ',': case '/':
-                case ':': case ';': case '=': case '@':
-                    ss << c;
-                    break;
-                default:
-                    ss << '%' << std::setw(2) << (int)((unsigned char)c) << std::setw(0);
-            }
+            inSegment = false;
+            continue;
+        }
+        if(!inSegment)
+        {
+            out.push_back('/');
+            inSegment = true;
+        }
+        if(IsUnescapedPathCharacter(c))
+        {
+            out.push_back(static_cast<char>(c));
+        }
+        else
+        {
+            out.push_back('%');
+            out.push_back(HEX_DIGITS[c >> 4]);
+            out.push_back(HEX_DIGITS[c & 0x0F]);
         }
     }
 
     //if the last character was also a slash, then add that back here.
     if (path.back() == '/')
     {
-        ss << '/';
+        out.push_back('/');
     }
+}
 
-    return ss.str();
+Aws::String URI::URLEncodePathRFC3986(const Aws::String& path)
+{
+    if(path.empty())
+    {
+        return path;
+    }
+
+    Aws::String encodedPath;
+    encodedPath.reserve(path.size() + path.size() / 2);
+    AppendURLEncodedPathRFC3986(path, encodedPath);
+    return encodedPath;
 }
 
 Aws::String URI::URLEncodePath(const Aws::String& path)
@@ -323,29 +348,30 @@ Aws::String URI::GetURIString(bool includeQueryString) const
 {
     assert(m_authority.size() > 0);
 
-    Aws::StringStream ss;
-    ss << SchemeMapper::ToString(m_scheme) << SEPARATOR << m_authority;
+    const char* scheme = SchemeMapper::ToString(m_scheme);
+    Aws::String uriString;
+    // rendered into a single buffer; leave room for a port and some escaping of the path
+    uriString.reserve(strlen(scheme) + strlen(SEPARATOR) + m_authority.size() + 6 + m_path.size() * 2 +
+        (includeQueryString ? m_queryString.size() : 0));
+    uriString.append(scheme).append(SEPARATOR).append(m_authority);
 
-    if (m_scheme == Scheme::HTTP && m_port != HTTP_DEFAULT_PORT)
-    {
-        ss << ":" << m_port;
-    }
-    else if (m_scheme == Scheme::HTTPS && m_port != HTTPS_DEFAULT_PORT)
+    if ((m_scheme == Scheme::HTTP && m_port != HTTP_DEFAULT_PORT) || (m_scheme == Scheme::HTTPS && m_port != HTTPS_DEFAULT_PORT))
     {
-        ss << ":" << m_port;
+        uriString.push_back(':');
+        uriString.append(StringUtils::to_string(m_port));
     }
 
-    if(m_path != "/")
+    if(m_path != "/" && !m_path.empty())
     {
-        ss << URLEncodePathRFC3986(m_path);
+        AppendURLEncodedPathRFC3986(m_path, uriString);
     }
 
     if(includeQueryString)
     {
-        ss << m_queryString;
+        uriString.append(m_queryString);
     }
 
-    return ss.str();
+    return uriString;
 }
 
 void URI::ParseURIParts(const Aws::String& uri)
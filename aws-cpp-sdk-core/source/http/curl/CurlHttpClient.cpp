@@ -20,7 +20,9 @@
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
 #include <cassert>
+#include <cstring>
 #include <algorithm>
+#include <chrono>
 
 
 using namespace Aws::Client;
@@ -299,13 +301,42 @@ CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
 }
 
 
+static std::chrono::microseconds SecondsToMicroseconds(double seconds)
+{
+    return std::chrono::microseconds(static_cast<std::chrono::microseconds::rep>(seconds * 1000000.0));
+}
+
+// curl reports each phase as the time elapsed since the start of the transfer, turn those into durations.
+static void RecordCurlTimings(CURL* connectionHandle, HttpRequest& request)
+{
+    double nameLookup = 0.0, connect = 0.0, appConnect = 0.0, preTransfer = 0.0, startTransfer = 0.0, total = 0.0;
+    curl_easy_getinfo(connectionHandle, CURLINFO_NAMELOOKUP_TIME, &nameLookup);
+    curl_easy_getinfo(connectionHandle, CURLINFO_CONNECT_TIME, &connect);
+    curl_easy_getinfo(connectionHandle, CURLINFO_APPCONNECT_TIME, &appConnect);
+    curl_easy_getinfo(connectionHandle, CURLINFO_PRETRANSFER_TIME, &preTransfer);
+    curl_easy_getinfo(connectionHandle, CURLINFO_STARTTRANSFER_TIME, &startTransfer);
+    curl_easy_getinfo(connectionHandle, CURLINFO_TOTAL_TIME, &total);
+
+    request.SetTiming(HttpRequestTiming::DnsLookup, SecondsToMicroseconds(nameLookup));
+    request.SetTiming(HttpRequestTiming::Connect, SecondsToMicroseconds((std::max)(connect - nameLookup, 0.0)));
+    //no handshake on plain http or on a reused connection
+    if (appConnect > 0.0)
+    {
+        request.SetTiming(HttpRequestTiming::TlsHandshake, SecondsToMicroseconds((std::max)(appConnect - connect, 0.0)));
+    }
+    if (startTransfer > 0.0)
+    {
+        request.SetTiming(HttpRequestTiming::TimeToFirstByte, SecondsToMicroseconds((std::max)(startTransfer - preTransfer, 0.0)));
+        request.SetTiming(HttpRequestTiming::Transfer, SecondsToMicroseconds((std::max)(total - startTransfer, 0.0)));
+    }
+}
+
 void CurlHttpClient::MakeRequestInternal(HttpRequest& request, 
         std::shared_ptr<StandardHttpResponse>& response,
         Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, 
         Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
 {
-    URI uri = request.GetUri();
-    Aws::String url = uri.GetURIString();
+    Aws::String url = request.GetURIString();
 
     AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Making request to " << url);
     struct curl_slist* headers = NULL;
@@ -315,15 +346,12 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
         writeLimiter->ApplyAndPayForCost(request.GetSize());
     }
 
-    Aws::StringStream headerStream;
-    HeaderValueCollection requestHeaders = request.GetHeaders();
+    Aws::String headerString;
 
     AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, "Including headers:");
-    for (auto& requestHeader : requestHeaders)
+    for (const auto& requestHeader : request.GetHeaderCollection())
     {
-        headerStream.str("");
-        headerStream << requestHeader.first << ": " << requestHeader.second;
-        Aws::String headerString = headerStream.str();
+        headerString.assign(requestHeader.first).append(": ").append(requestHeader.second);
         AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, headerString);
         headers = curl_slist_append(headers, headerString.c_str());
     }
@@ -339,7 +367,14 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
         headers = curl_slist_append(headers, "content-type:");
     }
 
+    const bool recordTimings = request.AreTimingsEnabled();
+    auto acquireStart = recordTimings ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
     CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+    if (recordTimings)
+    {
+        request.SetTiming(HttpRequestTiming::ConnectionAcquire,
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - acquireStart));
+    }
 
     if (connectionHandle)
     {
@@ -427,6 +462,10 @@ void CurlHttpClient::MakeRequestInternal(HttpRequest& request,
         }
 
         CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
+        if (recordTimings)
+        {
+            RecordCurlTimings(connectionHandle, request);
+        }
         bool shouldContinueRequest = ContinueRequest(request);
         if (curlResponseCode != CURLE_OK && shouldContinueRequest)
         {
@@ -539,12 +578,14 @@ size_t CurlHttpClient::WriteHeader(char* ptr, size_t size, size_t nmemb, void* u
     {
         AWS_LOGSTREAM_TRACE(CURL_HTTP_CLIENT_TAG, ptr);
         HttpResponse* response = (HttpResponse*) userdata;
-        Aws::String headerLine(ptr);
-        Aws::Vector<Aws::String> keyValuePair = StringUtils::Split(headerLine, ':', 2);
+        // header lines aren't null terminated; AddHeader trims the name and the value (and the line's trailing CRLF)
+        const size_t length = size * nmemb;
+        const char* separator = static_cast<const char*>(memchr(ptr, ':', length));
 
-        if (keyValuePair.size() == 2)
+        if (separator)
         {
-            response->AddHeader(StringUtils::Trim(keyValuePair[0].c_str()), StringUtils::Trim(keyValuePair[1].c_str()));
+            const char* lineEnd = ptr + length;
+            response->AddHeader(Aws::String(static_cast<const char*>(ptr), separator), Aws::String(separator + 1, lineEnd));
         }
 
         return size * nmemb;
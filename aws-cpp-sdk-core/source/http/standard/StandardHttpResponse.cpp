@@ -15,7 +15,6 @@
 
 #include <aws/core/http/standard/StandardHttpResponse.h>
 
-#include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 
 #include <istream>
@@ -24,33 +23,25 @@ using namespace Aws::Http;
 using namespace Aws::Http::Standard;
 using namespace Aws::Utils;
 
+static const Aws::String EMPTY_HEADER;
 
 HeaderValueCollection StandardHttpResponse::GetHeaders() const
 {
-    HeaderValueCollection headerValueCollection;
-
-    for (Aws::Map<Aws::String, Aws::String>::const_iterator iter = headerMap.begin(); iter != headerMap.end(); ++iter)
-    {
-        headerValueCollection.emplace(HeaderValuePair(iter->first, iter->second));
-    }
-
-    return headerValueCollection;
+    return headerMap.ToHeaderValueCollection();
 }
 
 bool StandardHttpResponse::HasHeader(const char* headerName) const
 {
-    return headerMap.find(StringUtils::ToLower(headerName)) != headerMap.end();
+    return headerMap.Contains(headerName);
 }
 
 const Aws::String& StandardHttpResponse::GetHeader(const Aws::String& headerName) const
 {
-    Aws::Map<Aws::String, Aws::String>::const_iterator foundValue = headerMap.find(StringUtils::ToLower(headerName.c_str()));
-    return foundValue->second;
+    const Aws::String* headerValue = headerMap.Find(headerName);
+    return headerValue ? *headerValue : EMPTY_HEADER;
 }
 
 void StandardHttpResponse::AddHeader(const Aws::String& headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName.c_str())] = headerValue;
+    headerMap.Set(headerName, headerValue);
 }
-
-
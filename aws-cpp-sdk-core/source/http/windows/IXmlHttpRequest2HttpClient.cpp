@@ -341,8 +341,7 @@ namespace Aws
                                         Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
                                         Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
         {
-            auto uri = request.GetUri();
-            auto fullUriString = uri.GetURIString();
+            auto fullUriString = request.GetURIString();
             AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Making " << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod()) 
                         << " request to url: " << fullUriString);
 
@@ -361,13 +360,13 @@ namespace Aws
             if (FAILED(hrResult))
             {
                 AWS_LOGSTREAM_ERROR(CLASS_TAG, "Error opening http request with status code " << hrResult);
-                AWS_LOGSTREAM_DEBUG(CLASS_TAG, "The http request is: " << uri.GetURIString());
+                AWS_LOGSTREAM_DEBUG(CLASS_TAG, "The http request is: " << fullUriString);
                 response = nullptr;
                 return;
             }
 
             AWS_LOGSTREAM_TRACE(CLASS_TAG, "Setting http headers:");
-            for (auto& header : request.GetHeaders())
+            for (const auto& header : request.GetHeaderCollection())
             {
                 AWS_LOGSTREAM_TRACE(CLASS_TAG, header.first << ": " << header.second);
                 hrResult = requestHandle->SetRequestHeader(Aws::Utils::StringUtils::ToWString(header.first.c_str()).c_str(),
@@ -76,16 +76,16 @@ void* WinSyncHttpClient::AllocateWindowsHttpRequest(const Aws::Http::HttpRequest
 
 void WinSyncHttpClient::AddHeadersToRequest(const HttpRequest& request, void* hHttpRequest) const
 {
-    if(request.GetHeaders().size() > 0)
+    const HttpHeaderCollection& headers = request.GetHeaderCollection();
+    if(!headers.empty())
     {
-        Aws::StringStream ss;
+        Aws::String headerString;
         AWS_LOGSTREAM_DEBUG(GetLogTag(), "with headers:");
-        for (auto& header : request.GetHeaders())
+        for (const auto& header : headers)
         {
-            ss << header.first << ": " << header.second << "\r\n";
+            headerString.append(header.first).append(": ").append(header.second).append("\r\n");
         }
 
-        Aws::String headerString = ss.str();
         AWS_LOGSTREAM_DEBUG(GetLogTag(), headerString);
 
         DoAddHeaders(hHttpRequest, headerString);
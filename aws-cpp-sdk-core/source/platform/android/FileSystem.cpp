@@ -141,6 +141,7 @@ static const char* FILE_SYSTEM_UTILS_LOG_TAG = "FileSystem";
 
                entry.fileSize = static_cast<int64_t>(dirInfo.st_size);
                AWS_LOGSTREAM_DEBUG(FILE_SYSTEM_UTILS_LOG_TAG, "file size detected as " << entry.fileSize);
+               entry.lastModified = static_cast<int64_t>(dirInfo.st_mtime) * 1000;
             }
             else
             {
@@ -121,6 +121,12 @@ private:
         fileSize.LowPart = ffd.nFileSizeLow;
         entry.fileSize = static_cast<int64_t>(fileSize.QuadPart);
 
+        // FILETIME counts 100ns intervals since 1601
+        ULARGE_INTEGER lastWriteTime;
+        lastWriteTime.HighPart = ffd.ftLastWriteTime.dwHighDateTime;
+        lastWriteTime.LowPart = ffd.ftLastWriteTime.dwLowDateTime;
+        entry.lastModified = static_cast<int64_t>((lastWriteTime.QuadPart - 116444736000000000ULL) / 10000);
+
         if (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
         {
             entry.fileType = FileType::Directory;
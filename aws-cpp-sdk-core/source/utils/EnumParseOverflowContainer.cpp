@@ -40,6 +40,9 @@ const Aws::String& EnumParseOverflowContainer::RetrieveOverflow(int hashCode) co
 void EnumParseOverflowContainer::StoreOverflow(int hashCode, const Aws::String& value)
 {
     WriterLockGuard guard(m_overflowLock);
-    AWS_LOGSTREAM_WARN(LOG_TAG, "Encountered enum member " << value << " which is not modeled in your clients. You should update your clients when you get a chance.");
-    m_overflowMap[hashCode] = value;
+    // never assign over a stored value, names handed out by RetrieveOverflow would dangle
+    if (m_overflowMap.emplace(hashCode, value).second)
+    {
+        AWS_LOGSTREAM_WARN(LOG_TAG, "Encountered enum member " << value << " which is not modeled in your clients. You should update your clients when you get a chance.");
+    }
 }
@@ -18,10 +18,10 @@
 #include <aws/core/utils/base64/Base64.h>
 #include <aws/core/utils/crypto/Sha256.h>
 #include <aws/core/utils/crypto/Sha256HMAC.h>
+#include <aws/core/utils/crypto/Sha256TreeHash.h>
 #include <aws/core/utils/crypto/MD5.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
-#include <aws/core/utils/memory/stl/AWSList.h>
 
 #include <iomanip>
 
@@ -32,9 +32,6 @@ using namespace Aws::Utils::Crypto;
 // internal buffers are fixed-size arrays, so this is harmless memory-management wise
 static Aws::Utils::Base64::Base64 s_base64;
 
-// Aws Glacier Tree Hash calculates hash value for each 1MB data
-const static size_t TREE_HASH_ONE_MB = 1024 * 1024;
-
 Aws::String HashingUtils::Base64Encode(const ByteBuffer& message)
 {
     return s_base64.Encode(message);
@@ -63,62 +60,13 @@ ByteBuffer HashingUtils::CalculateSHA256(Aws::IOStream& stream)
     return hash.Calculate(stream).GetResult();
 }
 
-/**
- * This function is only used by HashingUtils::CalculateSHA256TreeHash() in this cpp file
- * It's a helper function be used to compute the TreeHash defined at:
- * http://docs.aws.amazon.com/amazonglacier/latest/dev/checksum-calculations.html
- */
-static ByteBuffer TreeHashFinalCompute(Aws::List<ByteBuffer>& input)
-{
-    Sha256 hash;
-    assert(input.size() != 0);
-
-    // O(n) time complexity of merging (n + n/2 + n/4 + n/8 +...+ 1)
-    while (input.size() > 1)
-    {
-        auto iter = input.begin();
-        // if only one element left, just left it there
-        while (std::next(iter) != input.end())
-        {
-            // if >= two elements
-            Aws::String str(reinterpret_cast<char*>(iter->GetUnderlyingData()), iter->GetLength());
-            // list erase returns iterator of next element next to the erased element or end() if erased the last one
-            // list insert inserts element before pos, here we erase two elements, and insert a new element
-            iter = input.erase(iter);
-            str.append(reinterpret_cast<char*>(iter->GetUnderlyingData()), iter->GetLength());
-            iter = input.erase(iter);
-            input.insert(iter, hash.Calculate(str).GetResult());
-
-            if (iter == input.end()) break;
-        } // while process to the last element
-    } // while the list has only one element left
-
-    return *(input.begin());
-}
-
 ByteBuffer HashingUtils::CalculateSHA256TreeHash(const Aws::String& str)
 {
-    Sha256 hash;
-    if (str.size() == 0)
-    {
-        return hash.Calculate(str).GetResult();
-    }
-
-    Aws::List<ByteBuffer> input;
-    size_t pos = 0;
-    while (pos < str.size())
-    {
-        input.push_back(hash.Calculate(Aws::String(str, pos, TREE_HASH_ONE_MB)).GetResult());
-        pos += TREE_HASH_ONE_MB;
-    }
-
-    return TreeHashFinalCompute(input);
+    return Sha256TreeHash::Calculate(reinterpret_cast<const unsigned char*>(str.c_str()), str.size());
 }
 
 ByteBuffer HashingUtils::CalculateSHA256TreeHash(Aws::IOStream& stream)
 {
-    Sha256 hash;
-    Aws::List<ByteBuffer> input;
     auto currentPos = stream.tellg();
     if (currentPos == std::ios::pos_type(-1))
     {
@@ -126,24 +74,14 @@ ByteBuffer HashingUtils::CalculateSHA256TreeHash(Aws::IOStream& stream)
         stream.clear();
     }
     stream.seekg(0, stream.beg);
-    Array<char> streamBuffer(TREE_HASH_ONE_MB);
-    while (stream.good())
-    {
-        stream.read(streamBuffer.GetUnderlyingData(), TREE_HASH_ONE_MB);
-        auto bytesRead = stream.gcount();
-        if (bytesRead > 0)
-        {
-            input.push_back(hash.Calculate(Aws::String(reinterpret_cast<char*>(streamBuffer.GetUnderlyingData()), static_cast<size_t>(bytesRead))).GetResult());
-        }
-    }
+
+    Sha256TreeHash treeHash;
+    treeHash.Update(stream);
+
     stream.clear();
     stream.seekg(currentPos, stream.beg);
 
-    if (input.size() == 0)
-    {
-        return hash.Calculate("").GetResult();
-    }
-    return TreeHashFinalCompute(input);
+    return treeHash.GetResult();
 }
 
 Aws::String HashingUtils::HexEncode(const ByteBuffer& message)
@@ -234,11 +172,12 @@ int HashingUtils::HashString(const char* strToHash)
     if (!strToHash)
         return 0;
 
-    int hash = 0;
+    // unsigned so that wrapping around is defined, the result is the same as CompileTimeHashString's
+    uint32_t hash = 0;
     while (char charValue = *strToHash++)
     {
-        hash = charValue + 31 * hash;    
+        hash = static_cast<uint32_t>(charValue) + 31 * hash;
     }
 
-    return hash;
+    return static_cast<int>(hash);
 }
@@ -17,8 +17,10 @@
 #include <aws/core/utils/crypto/Factories.h>
 #include <aws/core/utils/crypto/SecureRandom.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <algorithm>
 #include <cstdlib>
 #include <climits>
+#include <cstring>
 
 //if you are reading this, you are witnessing pure brilliance.
 #define IS_BIG_ENDIAN (*(uint16_t*)"\0\xff" < 0x100)
@@ -102,6 +104,43 @@ namespace Aws
                 }
             }
 
+            static void CopyCipherOutput(const CryptoBuffer& result, CryptoBuffer& output, size_t outputOffset, size_t& outputLength)
+            {
+                outputLength = result.GetLength();
+                if (outputLength > 0)
+                {
+                    SymmetricCipher::ReserveOutput(output, outputOffset + outputLength, outputOffset);
+                    memcpy(output.GetUnderlyingData() + outputOffset, result.GetUnderlyingData(), outputLength);
+                }
+            }
+
+            bool SymmetricCipher::EncryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength)
+            {
+                CopyCipherOutput(EncryptBuffer(CryptoBuffer(data, length)), output, outputOffset, outputLength);
+                return Good();
+            }
+
+            bool SymmetricCipher::DecryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength)
+            {
+                CopyCipherOutput(DecryptBuffer(CryptoBuffer(data, length)), output, outputOffset, outputLength);
+                return Good();
+            }
+
+            void SymmetricCipher::ReserveOutput(CryptoBuffer& buffer, size_t length, size_t bytesToKeep)
+            {
+                if (buffer.GetLength() >= length)
+                {
+                    return;
+                }
+
+                CryptoBuffer reserved(length);
+                if (bytesToKeep > 0)
+                {
+                    memcpy(reserved.GetUnderlyingData(), buffer.GetUnderlyingData(), (std::min)(bytesToKeep, buffer.GetLength()));
+                }
+                buffer = std::move(reserved);
+            }
+
             /**
              * Generate random number per 4 bytes and use each byte for the byte in the iv
              */
@@ -27,9 +27,9 @@ namespace Aws
         {
             namespace ContentCryptoSchemeMapper
             {
-                static const int cryptoScheme_CBC_HASH = HashingUtils::HashString("AES/CBC/PKCS5Padding");
-                static const int cryptoScheme_CTR_HASH = HashingUtils::HashString("AES/CTR/NoPadding");
-                static const int cryptoScheme_GCM_HASH = HashingUtils::HashString("AES/GCM/NoPadding");
+                static constexpr int cryptoScheme_CBC_HASH = HashingUtils::CompileTimeHashString("AES/CBC/PKCS5Padding");
+                static constexpr int cryptoScheme_CTR_HASH = HashingUtils::CompileTimeHashString("AES/CTR/NoPadding");
+                static constexpr int cryptoScheme_GCM_HASH = HashingUtils::CompileTimeHashString("AES/GCM/NoPadding");
 
                 ContentCryptoScheme GetContentCryptoSchemeForName(const Aws::String& name)
                 {
@@ -14,6 +14,7 @@
   */
 
 #include <aws/core/utils/crypto/CryptoBuf.h>
+#include <cstring>
 
 namespace Aws
 {
@@ -23,10 +24,11 @@ namespace Aws
         {
             SymmetricCryptoBufSrc::SymmetricCryptoBufSrc(Aws::IStream& stream, SymmetricCipher& cipher, CipherMode cipherMode, size_t bufferSize)
                     :
-                    m_isBuf(PUT_BACK_SIZE), m_cipher(cipher), m_stream(stream), m_cipherMode(cipherMode), m_isFinalized(false),
+                    m_isBuf(PUT_BACK_SIZE + bufferSize + MAX_CIPHER_BLOCK_SIZE), m_inputBuf(cipher.SupportsInPlace() ? 0 : bufferSize),
+                    m_cipher(cipher), m_stream(stream), m_cipherMode(cipherMode), m_isFinalized(false),
                     m_bufferSize(bufferSize), m_putBack(PUT_BACK_SIZE)
             {
-                char* end = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_isBuf.GetLength());
+                char* end = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_putBack);
                 setg(end, end, end);
             }
 
@@ -60,64 +62,28 @@ namespace Aws
                         index = 0;
                     }
 
-                    CryptoBuffer cryptoBuffer;
+                    size_t lastLength = 0;
                     while (m_cipher && index < seekTo && !m_isFinalized)
                     {
                         size_t max_read = std::min<size_t>(static_cast<size_t>(seekTo - index), m_bufferSize);
-
-                        Aws::Utils::Array<char> buf(max_read);
-                        size_t readSize(0);
-                        if(m_stream)
-                        {
-                            m_stream.read(buf.GetUnderlyingData(), max_read);
-                            readSize = static_cast<size_t>(m_stream.gcount());
-                        }
-
-                        if (readSize > 0)
-                        {
-                            if (m_cipherMode == CipherMode::Encrypt)
-                            {
-                                cryptoBuffer = m_cipher.EncryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                            }
-                            else
-                            {
-                                cryptoBuffer = m_cipher.DecryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                            }
-                        }
-                        else
-                        {
-                            if (m_cipherMode == CipherMode::Encrypt)
-                            {
-                                cryptoBuffer = m_cipher.FinalizeEncryption();
-                            }
-                            else
-                            {
-                                cryptoBuffer = m_cipher.FinalizeDecryption();
-                            }
-
-                            m_isFinalized = true;
-                        }
-
-                        index += cryptoBuffer.GetLength();
+                        lastLength = FillBuffer(max_read);
+                        index += lastLength;
                     }
 
-                    if (cryptoBuffer.GetLength() && m_cipher)
+                    char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
+                    if (lastLength && m_cipher)
                     {
-                        CryptoBuffer putBackArea(m_putBack);
-                                                
-                        m_isBuf = CryptoBuffer({&putBackArea, &cryptoBuffer});
+                        memset(baseBufPtr, 0, m_putBack);
                         //in the very unlikely case that the cipher had less output than the source stream.
                         assert(seekTo <= index);
-                        size_t newBufferPos = index > seekTo ? cryptoBuffer.GetLength() - (index - seekTo) : cryptoBuffer.GetLength();
-                        char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
-                        setg(baseBufPtr, baseBufPtr + m_putBack + newBufferPos, baseBufPtr + m_isBuf.GetLength());
+                        size_t newBufferPos = index > seekTo ? lastLength - (index - seekTo) : lastLength;
+                        setg(baseBufPtr, baseBufPtr + m_putBack + newBufferPos, baseBufPtr + m_putBack + lastLength);
 
                         return pos_type(seekTo);
                     }
                     else if (seekTo == 0)
                     {
-                        m_isBuf = CryptoBuffer(m_putBack);
-                        char* end = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData() + m_isBuf.GetLength());
+                        char* end = baseBufPtr + m_putBack;
                         setg(end, end, end);
                         return pos_type(seekTo);
                     }
@@ -144,61 +110,82 @@ namespace Aws
                 }
 
                 char* baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
-                CryptoBuffer putBackArea(m_putBack);
 
                 //eback is properly set after the first fill. So this guarantees we are on the second or later fill.
                 if (eback() == baseBufPtr)
                 {
                     //just fill in the last bit of the previous buffer into the put back area so that it has some data in it
-                    memcpy(putBackArea.GetUnderlyingData(), egptr() - m_putBack, m_putBack);
+                    memmove(baseBufPtr, egptr() - m_putBack, m_putBack);
+                }
+                else
+                {
+                    memset(baseBufPtr, 0, m_putBack);
+                }
+
+                size_t newDataLength = 0;
+                while (!newDataLength && !m_isFinalized && m_cipher)
+                {
+                    newDataLength = FillBuffer(m_bufferSize);
                 }
 
-                CryptoBuffer newDataBuf;
+                if (newDataLength > 0)
+                {
+                    // the cipher may have had to grow the buffer
+                    baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
+                    setg(baseBufPtr, baseBufPtr + m_putBack, baseBufPtr + m_putBack + newDataLength);
+
+                    return traits_type::to_int_type(*gptr());
+                }
+
+                return traits_type::eof();
+            }
 
-                while(!newDataBuf.GetLength() && !m_isFinalized)
+            size_t SymmetricCryptoBufSrc::FillBuffer(size_t readLength)
+            {
+                // stream modes are transformed where they are read to, right after the put back area
+                unsigned char* input = m_cipher.SupportsInPlace() ? m_isBuf.GetUnderlyingData() + m_putBack : m_inputBuf.GetUnderlyingData();
+
+                size_t readSize(0);
+                if (m_stream)
                 {
-                    Aws::Utils::Array<char> buf(m_bufferSize);
-                    m_stream.read(buf.GetUnderlyingData(), m_bufferSize);
-                    size_t readSize = static_cast<size_t>(m_stream.gcount());
+                    m_stream.read(reinterpret_cast<char*>(input), readLength);
+                    readSize = static_cast<size_t>(m_stream.gcount());
+                }
 
-                    if (readSize > 0)
+                size_t outputLength(0);
+                if (readSize > 0)
+                {
+                    if (m_cipherMode == CipherMode::Encrypt)
                     {
-                        if (m_cipherMode == CipherMode::Encrypt)
-                        {
-                            newDataBuf = m_cipher.EncryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                        }
-                        else
-                        {
-                            newDataBuf = m_cipher.DecryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(buf.GetUnderlyingData()), readSize));
-                        }
+                        m_cipher.EncryptInto(input, readSize, m_isBuf, m_putBack, outputLength);
                     }
                     else
                     {
-                        if (m_cipherMode == CipherMode::Encrypt)
-                        {
-                            newDataBuf = m_cipher.FinalizeEncryption();
-                        }
-                        else
-                        {
-                            newDataBuf = m_cipher.FinalizeDecryption();
-                        }
-
-                        m_isFinalized = true;
+                        m_cipher.DecryptInto(input, readSize, m_isBuf, m_putBack, outputLength);
                     }
                 }
-
-
-                if(newDataBuf.GetLength() > 0)
+                else
                 {
-                    m_isBuf = CryptoBuffer({&putBackArea, &newDataBuf});
-
-                    baseBufPtr = reinterpret_cast<char*>(m_isBuf.GetUnderlyingData());
-                    setg(baseBufPtr, baseBufPtr + m_putBack, baseBufPtr + m_isBuf.GetLength());
+                    CryptoBuffer finalBuffer;
+                    if (m_cipherMode == CipherMode::Encrypt)
+                    {
+                        finalBuffer = m_cipher.FinalizeEncryption();
+                    }
+                    else
+                    {
+                        finalBuffer = m_cipher.FinalizeDecryption();
+                    }
 
-                    return traits_type::to_int_type(*gptr());
+                    m_isFinalized = true;
+                    outputLength = finalBuffer.GetLength();
+                    if (outputLength > 0)
+                    {
+                        SymmetricCipher::ReserveOutput(m_isBuf, m_putBack + outputLength, m_putBack);
+                        memcpy(m_isBuf.GetUnderlyingData() + m_putBack, finalBuffer.GetUnderlyingData(), outputLength);
+                    }
                 }
 
-                return traits_type::eof();
+                return outputLength;
             }
 
             SymmetricCryptoBufSrc::off_type SymmetricCryptoBufSrc::ComputeAbsSeekPosition(off_type pos, std::ios_base::seekdir dir,  std::fpos<FPOS_TYPE> curPos)
@@ -238,7 +225,8 @@ namespace Aws
 
             SymmetricCryptoBufSink::SymmetricCryptoBufSink(Aws::OStream& stream, SymmetricCipher& cipher, CipherMode cipherMode, size_t bufferSize, int16_t blockOffset)
                     :
-                    m_osBuf(bufferSize), m_cipher(cipher), m_stream(stream), m_cipherMode(cipherMode), m_isFinalized(false), m_blockOffset(blockOffset)
+                    m_osBuf(bufferSize + MAX_CIPHER_BLOCK_SIZE), m_cipherOutput(cipher.SupportsInPlace() ? 0 : bufferSize + MAX_CIPHER_BLOCK_SIZE),
+                    m_cipher(cipher), m_stream(stream), m_cipherMode(cipherMode), m_isFinalized(false), m_blockOffset(blockOffset), m_bufferSize(bufferSize)
             {
                 assert(m_blockOffset < 16 && m_blockOffset >= 0);
                 char* outputBase = reinterpret_cast<char*>(m_osBuf.GetUnderlyingData());
@@ -262,19 +250,21 @@ namespace Aws
             {
                 if(!m_isFinalized)
                 {
-                    CryptoBuffer cryptoBuf;
+                    // stream modes are transformed right in the put area
+                    CryptoBuffer& output = m_cipher.SupportsInPlace() ? m_osBuf : m_cipherOutput;
+                    size_t outputLength(0);
                     if (pptr() > pbase())
                     {
+                        const unsigned char* data = reinterpret_cast<unsigned char*>(pbase());
+                        size_t length = static_cast<size_t>(pptr() - pbase());
                         if (m_cipherMode == CipherMode::Encrypt)
                         {
-                            cryptoBuf = m_cipher.EncryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(pbase()), pptr() - pbase()));
+                            m_cipher.EncryptInto(data, length, output, 0, outputLength);
                         }
                         else
                         {
-                            cryptoBuf = m_cipher.DecryptBuffer(CryptoBuffer(reinterpret_cast<unsigned char*>(pbase()), pptr() - pbase()));
+                            m_cipher.DecryptInto(data, length, output, 0, outputLength);
                         }
-
-                        pbump(-(static_cast<int>(pptr() - pbase())));
                     }
                     if(finalize)
                     {
@@ -287,27 +277,29 @@ namespace Aws
                         {
                             finalBuffer = m_cipher.FinalizeDecryption();
                         }
-                        if(cryptoBuf.GetLength())
+                        if(finalBuffer.GetLength())
                         {
-                            cryptoBuf = CryptoBuffer({&cryptoBuf, &finalBuffer});
-                        }
-                        else
-                        {
-                            cryptoBuf = std::move(finalBuffer);
+                            SymmetricCipher::ReserveOutput(output, outputLength + finalBuffer.GetLength(), outputLength);
+                            memcpy(output.GetUnderlyingData() + outputLength, finalBuffer.GetUnderlyingData(), finalBuffer.GetLength());
+                            outputLength += finalBuffer.GetLength();
                         }
 
                         m_isFinalized = true;
                     }
 
+                    //the put area may have been reallocated, and is empty again either way.
+                    char* outputBase = reinterpret_cast<char*>(m_osBuf.GetUnderlyingData());
+                    setp(outputBase, outputBase + m_bufferSize - 1);
+
                     if (m_cipher)
                     {
-                        if(cryptoBuf.GetLength())
+                        if(outputLength)
                         {
                             //allow mid block decryption. We have to decrypt it, but we don't have to write it to the stream.
                             //the assumption here is that tellp() will always be 0 or >= 16 bytes. The block offset should only 
                             //be the offset of the first block read.
                             auto blockOffset = m_stream.tellp() > m_blockOffset ? 0 : m_blockOffset;
-                            m_stream.write(reinterpret_cast<char*>(cryptoBuf.GetUnderlyingData() + blockOffset), cryptoBuf.GetLength() - blockOffset);
+                            m_stream.write(reinterpret_cast<char*>(output.GetUnderlyingData() + blockOffset), outputLength - blockOffset);
                         }
                         return true;
                     }
@@ -27,8 +27,8 @@ namespace Aws
         {
             namespace KeyWrapAlgorithmMapper
             {
-                static const int keyWrapAlgorithm_KMS_HASH = HashingUtils::HashString("kms");
-                static const int keyWrapAlgorithm_KeyWrap_HASH = HashingUtils::HashString("AESWrap");
+                static constexpr int keyWrapAlgorithm_KMS_HASH = HashingUtils::CompileTimeHashString("kms");
+                static constexpr int keyWrapAlgorithm_KeyWrap_HASH = HashingUtils::CompileTimeHashString("AESWrap");
 
                 KeyWrapAlgorithm GetKeyWrapAlgorithmForName(const Aws::String& name)
                 {
@@ -0,0 +1,271 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/Sha256TreeHash.h>
+#include <aws/core/utils/crypto/Sha256.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <istream>
+#include <streambuf>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* TREE_HASH_LOG_TAG = "Sha256TreeHash";
+
+namespace
+{
+    /**
+     * Read only view over a caller owned buffer, so a leaf can be hashed in place instead of being copied into a string first.
+     * Seeking is supported since hash implementations rewind the stream before reading it.
+     */
+    class ReadOnlyBufferStreamBuf : public std::streambuf
+    {
+    public:
+        ReadOnlyBufferStreamBuf(const unsigned char* buffer, size_t length)
+        {
+            char* begin = const_cast<char*>(reinterpret_cast<const char*>(buffer));
+            setg(begin, begin, begin + length);
+        }
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+        {
+            if (dir == std::ios_base::beg)
+            {
+                return seekpos(off, which);
+            }
+            else if (dir == std::ios_base::end)
+            {
+                return seekpos((egptr() - eback()) + off, which);
+            }
+            return seekpos((gptr() - eback()) + off, which);
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+        {
+            if (!(which & std::ios_base::in) || pos < 0 || pos > (egptr() - eback()))
+            {
+                return pos_type(off_type(-1));
+            }
+            setg(eback(), eback() + static_cast<size_t>(pos), egptr());
+            return pos;
+        }
+    };
+
+    ByteBuffer HashLeaf(const unsigned char* buffer, size_t length)
+    {
+        ReadOnlyBufferStreamBuf streamBuf(buffer, length);
+        Aws::IStream stream(&streamBuf);
+        Sha256 hash;
+        return hash.Calculate(stream).GetResult();
+    }
+
+    ByteBuffer HashPair(const ByteBuffer& left, const ByteBuffer& right)
+    {
+        unsigned char concatenated[64];
+        assert(left.GetLength() == 32 && right.GetLength() == 32);
+        std::copy(left.GetUnderlyingData(), left.GetUnderlyingData() + 32, concatenated);
+        std::copy(right.GetUnderlyingData(), right.GetUnderlyingData() + 32, concatenated + 32);
+        return HashLeaf(concatenated, sizeof(concatenated));
+    }
+}
+
+Sha256TreeHash::Sha256TreeHash(Aws::Utils::Threading::Executor* executor) :
+    m_executor(executor),
+    m_currentLeafLength(0),
+    m_pendingLeaves(0),
+    m_finalized(false)
+{
+}
+
+Sha256TreeHash::~Sha256TreeHash()
+{
+    // leaf tasks reference this object, so they must be drained before it goes away.
+    WaitForPendingLeaves();
+}
+
+void Sha256TreeHash::Update(const unsigned char* buffer, size_t length)
+{
+    assert(!m_finalized);
+    while (length > 0)
+    {
+        if (m_currentLeafLength == 0 && length >= TREE_HASH_CHUNK_SIZE && !m_executor)
+        {
+            // hashing synchronously, the caller's buffer is still valid, so skip the copy for whole leaves.
+            SubmitLeaf(buffer, TREE_HASH_CHUNK_SIZE, nullptr);
+            buffer += TREE_HASH_CHUNK_SIZE;
+            length -= TREE_HASH_CHUNK_SIZE;
+            continue;
+        }
+
+        if (m_currentLeaf.GetLength() == 0)
+        {
+            m_currentLeaf = ByteBuffer(TREE_HASH_CHUNK_SIZE);
+        }
+        size_t toCopy = (std::min)(length, TREE_HASH_CHUNK_SIZE - m_currentLeafLength);
+        std::copy(buffer, buffer + toCopy, m_currentLeaf.GetUnderlyingData() + m_currentLeafLength);
+        m_currentLeafLength += toCopy;
+        buffer += toCopy;
+        length -= toCopy;
+
+        if (m_currentLeafLength == TREE_HASH_CHUNK_SIZE)
+        {
+            SubmitCurrentLeaf();
+        }
+    }
+}
+
+void Sha256TreeHash::Update(Aws::IStream& stream)
+{
+    assert(!m_finalized);
+    while (stream.good())
+    {
+        if (m_currentLeaf.GetLength() == 0)
+        {
+            m_currentLeaf = ByteBuffer(TREE_HASH_CHUNK_SIZE);
+        }
+        stream.read(reinterpret_cast<char*>(m_currentLeaf.GetUnderlyingData() + m_currentLeafLength), TREE_HASH_CHUNK_SIZE - m_currentLeafLength);
+        auto bytesRead = stream.gcount();
+        if (bytesRead > 0)
+        {
+            m_currentLeafLength += static_cast<size_t>(bytesRead);
+        }
+
+        if (m_currentLeafLength == TREE_HASH_CHUNK_SIZE)
+        {
+            SubmitCurrentLeaf();
+        }
+    }
+}
+
+ByteBuffer Sha256TreeHash::GetResult()
+{
+    if (!m_finalized)
+    {
+        if (m_currentLeafLength > 0)
+        {
+            // the last leaf is hashed here, no need to hand it over to the executor.
+            Aws::Utils::Threading::Executor* executor = m_executor;
+            m_executor = nullptr;
+            SubmitLeaf(m_currentLeaf.GetUnderlyingData(), m_currentLeafLength, nullptr);
+            m_executor = executor;
+            m_currentLeafLength = 0;
+        }
+        m_finalized = true;
+    }
+
+    WaitForPendingLeaves();
+
+    if (m_leafHashes.empty())
+    {
+        Sha256 hash;
+        return hash.Calculate("").GetResult();
+    }
+    return CombineTreeHashes(m_leafHashes);
+}
+
+void Sha256TreeHash::Reset()
+{
+    WaitForPendingLeaves();
+    m_leafHashes.clear();
+    m_currentLeafLength = 0;
+    m_finalized = false;
+}
+
+ByteBuffer Sha256TreeHash::Calculate(const unsigned char* buffer, size_t length, Aws::Utils::Threading::Executor* executor)
+{
+    if (length == 0)
+    {
+        Sha256 hash;
+        return hash.Calculate("").GetResult();
+    }
+
+    Sha256TreeHash treeHash(executor);
+    for (size_t pos = 0; pos < length; pos += TREE_HASH_CHUNK_SIZE)
+    {
+        // the buffer outlives this call, so leaves can be hashed in place even when they run on the executor.
+        size_t leafLength = length - pos < TREE_HASH_CHUNK_SIZE ? length - pos : TREE_HASH_CHUNK_SIZE;
+        treeHash.SubmitLeaf(buffer + pos, leafLength, nullptr);
+    }
+    treeHash.m_finalized = true;
+    return treeHash.GetResult();
+}
+
+ByteBuffer Sha256TreeHash::CombineTreeHashes(const Aws::Vector<ByteBuffer>& hashes)
+{
+    assert(!hashes.empty());
+    Aws::Vector<ByteBuffer> level(hashes);
+
+    // O(n) time complexity of merging (n + n/2 + n/4 + n/8 +...+ 1)
+    while (level.size() > 1)
+    {
+        size_t merged = 0;
+        for (size_t i = 0; i + 1 < level.size(); i += 2)
+        {
+            level[merged++] = HashPair(level[i], level[i + 1]);
+        }
+        // if only one element left, it is promoted to the next level as is
+        if (level.size() % 2 == 1)
+        {
+            level[merged++] = std::move(level.back());
+        }
+        level.resize(merged);
+    }
+
+    return level.front();
+}
+
+void Sha256TreeHash::SubmitLeaf(const unsigned char* buffer, size_t length, std::shared_ptr<ByteBuffer> owner)
+{
+    size_t index = 0;
+    {
+        std::lock_guard<std::mutex> locker(m_leafHashesMutex);
+        index = m_leafHashes.size();
+        m_leafHashes.emplace_back();
+        ++m_pendingLeaves;
+    }
+
+    auto hashLeaf = [this, buffer, length, owner, index]()
+    {
+        ByteBuffer leafHash = HashLeaf(buffer, length);
+        std::lock_guard<std::mutex> locker(m_leafHashesMutex);
+        m_leafHashes[index] = std::move(leafHash);
+        --m_pendingLeaves;
+        m_leafHashesSignal.notify_all();
+    };
+
+    if (!m_executor || !m_executor->Submit(hashLeaf))
+    {
+        hashLeaf();
+    }
+}
+
+void Sha256TreeHash::SubmitCurrentLeaf()
+{
+    // ownership of the leaf moves to the hashing task, a new buffer is allocated on the next Update().
+    auto leaf = Aws::MakeShared<ByteBuffer>(TREE_HASH_LOG_TAG, std::move(m_currentLeaf));
+    SubmitLeaf(leaf->GetUnderlyingData(), m_currentLeafLength, leaf);
+    m_currentLeaf = ByteBuffer();
+    m_currentLeafLength = 0;
+}
+
+void Sha256TreeHash::WaitForPendingLeaves()
+{
+    std::unique_lock<std::mutex> locker(m_leafHashesMutex);
+    m_leafHashesSignal.wait(locker, [this]() { return m_pendingLeaves == 0; });
+}
@@ -476,6 +476,56 @@ namespace Aws
                 return CryptoBuffer(finalBlock.GetUnderlyingData(), static_cast<size_t>(writtenSize));
             }
 
+            bool OpenSSLCipher::EncryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength)
+            {
+                outputLength = 0;
+                if (m_failure)
+                {
+                    AWS_LOGSTREAM_FATAL(OPENSSL_LOG_TAG, "Cipher not properly initialized for encryption. Aborting");
+                    return false;
+                }
+
+                // block modes can release a block held back from the previous call; stream modes write exactly length bytes,
+                // which in place calls always have room for
+                ReserveOutput(output, outputOffset + length + (SupportsInPlace() ? 0 : GetBlockSizeBytes()), outputOffset);
+
+                int lengthWritten = 0;
+                if (!EVP_EncryptUpdate(m_encryptor_ctx, output.GetUnderlyingData() + outputOffset, &lengthWritten, data, static_cast<int>(length)))
+                {
+                    m_failure = true;
+                    LogErrors();
+                    return false;
+                }
+
+                outputLength = static_cast<size_t>(lengthWritten);
+                return true;
+            }
+
+            bool OpenSSLCipher::DecryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength)
+            {
+                outputLength = 0;
+                if (m_failure)
+                {
+                    AWS_LOGSTREAM_FATAL(OPENSSL_LOG_TAG, "Cipher not properly initialized for decryption. Aborting");
+                    return false;
+                }
+
+                // block modes can release a block held back from the previous call; stream modes write exactly length bytes,
+                // which in place calls always have room for
+                ReserveOutput(output, outputOffset + length + (SupportsInPlace() ? 0 : GetBlockSizeBytes()), outputOffset);
+
+                int lengthWritten = 0;
+                if (!EVP_DecryptUpdate(m_decryptor_ctx, output.GetUnderlyingData() + outputOffset, &lengthWritten, data, static_cast<int>(length)))
+                {
+                    m_failure = true;
+                    LogErrors();
+                    return false;
+                }
+
+                outputLength = static_cast<size_t>(lengthWritten);
+                return true;
+            }
+
             void OpenSSLCipher::Reset()
             {
                 Cleanup();
@@ -0,0 +1,601 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/memory/PooledMemorySystem.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace Aws::Utils::Memory;
+
+namespace
+{
+    // every block is preceded by a BlockHeader; 16 bytes keeps the payload aligned the same way malloc does
+    const std::size_t BLOCK_HEADER_SIZE = 16;
+    // large and arena blocks carry a LargeHeader in front of their BlockHeader
+    const std::size_t LARGE_HEADER_SIZE = 16;
+
+    // payload sizes of the pools are 16, 32, 64 ... 4096 bytes
+    const std::size_t SIZE_CLASS_COUNT = 9;
+    const std::size_t SMALLEST_SIZE_CLASS = 16;
+    const std::size_t LARGEST_SIZE_CLASS = SMALLEST_SIZE_CLASS << (SIZE_CLASS_COUNT - 1);
+    const std::size_t POOL_CHUNK_SIZE = 64 * 1024;
+
+    const uint32_t LARGE_BLOCK = 0xFFFFFFFF;
+    const uint32_t ARENA_BLOCK = 0xFFFFFFFE;
+
+    // slot 0 collects untagged allocations and tags that did not fit in the table
+    const uint32_t TAG_SLOT_COUNT = 1024;
+    const char* UNTAGGED = "Untagged";
+
+    std::atomic<uint64_t> s_nextMemorySystemId(1);
+
+    struct BlockHeader
+    {
+        void* owner;
+        uint32_t sizeClass;
+        uint32_t tagSlot;
+    };
+    static_assert(sizeof(BlockHeader) <= BLOCK_HEADER_SIZE, "BlockHeader must fit in BLOCK_HEADER_SIZE");
+
+    struct LargeHeader
+    {
+        void* rawMemory;
+        std::size_t size;
+    };
+    static_assert(sizeof(LargeHeader) <= LARGE_HEADER_SIZE, "LargeHeader must fit in LARGE_HEADER_SIZE");
+
+    // free blocks reuse the space of their header to link to each other
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct PoolChunk
+    {
+        PoolChunk* next;
+    };
+
+    inline BlockHeader* GetBlockHeader(void* memoryPtr)
+    {
+        return reinterpret_cast<BlockHeader*>(static_cast<char*>(memoryPtr) - BLOCK_HEADER_SIZE);
+    }
+
+    inline LargeHeader* GetLargeHeader(void* memoryPtr)
+    {
+        return reinterpret_cast<LargeHeader*>(static_cast<char*>(memoryPtr) - BLOCK_HEADER_SIZE - LARGE_HEADER_SIZE);
+    }
+
+    inline uint32_t GetSizeClass(std::size_t size)
+    {
+        uint32_t sizeClass = 0;
+        std::size_t classSize = SMALLEST_SIZE_CLASS;
+        while (classSize < size)
+        {
+            classSize <<= 1;
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    inline std::size_t GetSizeClassBytes(uint32_t sizeClass)
+    {
+        return SMALLEST_SIZE_CLASS << sizeClass;
+    }
+
+    inline char* AlignUp(char* ptr, std::size_t alignment)
+    {
+        std::size_t misalignment = reinterpret_cast<std::size_t>(ptr) % alignment;
+        return misalignment ? ptr + (alignment - misalignment) : ptr;
+    }
+
+    // the arena a thread currently allocates from, see ScopedMemoryArena
+    thread_local MemoryArena* s_currentArena = nullptr;
+}
+
+namespace Aws
+{
+namespace Utils
+{
+namespace Memory
+{
+    struct PooledTagStats
+    {
+        std::atomic<const char*> allocationTag;
+        std::atomic<uint64_t> allocationCount;
+        std::atomic<uint64_t> freeCount;
+        std::atomic<uint64_t> bytesAllocated;
+        std::atomic<uint64_t> bytesFreed;
+    };
+
+    /**
+     * Pools of one thread. Only the owning thread touches the local free lists and chunk cursors,
+     * other threads give blocks back through the lock free remote lists.
+     */
+    struct PooledThreadCache
+    {
+        FreeBlock* localFree[SIZE_CLASS_COUNT];
+        std::atomic<FreeBlock*> remoteFree[SIZE_CLASS_COUNT];
+        char* chunkCursor[SIZE_CLASS_COUNT];
+        char* chunkEnd[SIZE_CLASS_COUNT];
+        PoolChunk* chunks;
+        PooledThreadCache* nextIdle;
+        PooledThreadCache* nextCache;
+
+        PooledThreadCache() : chunks(nullptr), nextIdle(nullptr), nextCache(nullptr)
+        {
+            for (std::size_t i = 0; i < SIZE_CLASS_COUNT; ++i)
+            {
+                localFree[i] = nullptr;
+                remoteFree[i].store(nullptr, std::memory_order_relaxed);
+                chunkCursor[i] = nullptr;
+                chunkEnd[i] = nullptr;
+            }
+        }
+
+        ~PooledThreadCache()
+        {
+            while (chunks)
+            {
+                PoolChunk* next = chunks->next;
+                free(chunks);
+                chunks = next;
+            }
+        }
+
+        FreeBlock* PopBlock(uint32_t sizeClass)
+        {
+            FreeBlock* block = localFree[sizeClass];
+            if (!block)
+            {
+                // adopt everything other threads gave back in one go
+                block = remoteFree[sizeClass].exchange(nullptr, std::memory_order_acquire);
+            }
+            if (block)
+            {
+                localFree[sizeClass] = block->next;
+                return block;
+            }
+
+            std::size_t blockBytes = BLOCK_HEADER_SIZE + GetSizeClassBytes(sizeClass);
+            if (chunkCursor[sizeClass] == nullptr || chunkCursor[sizeClass] + blockBytes > chunkEnd[sizeClass])
+            {
+                PoolChunk* chunk = static_cast<PoolChunk*>(malloc(POOL_CHUNK_SIZE));
+                if (!chunk)
+                {
+                    return nullptr;
+                }
+                chunk->next = chunks;
+                chunks = chunk;
+                chunkCursor[sizeClass] = reinterpret_cast<char*>(chunk) + BLOCK_HEADER_SIZE;
+                chunkEnd[sizeClass] = reinterpret_cast<char*>(chunk) + POOL_CHUNK_SIZE;
+            }
+
+            block = reinterpret_cast<FreeBlock*>(chunkCursor[sizeClass]);
+            chunkCursor[sizeClass] += blockBytes;
+            return block;
+        }
+
+        void PushLocal(uint32_t sizeClass, FreeBlock* block)
+        {
+            block->next = localFree[sizeClass];
+            localFree[sizeClass] = block;
+        }
+
+        void PushRemote(uint32_t sizeClass, FreeBlock* block)
+        {
+            FreeBlock* head = remoteFree[sizeClass].load(std::memory_order_relaxed);
+            do
+            {
+                block->next = head;
+            } while (!remoteFree[sizeClass].compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+        }
+    };
+
+    /**
+     * Ties the calling thread to its cache and gives the cache back to the memory system when the thread exits.
+     */
+    struct PooledThreadCacheBinding
+    {
+        PooledMemorySystem* memorySystem;
+        uint64_t memorySystemId;
+        PooledThreadCache* cache;
+
+        ~PooledThreadCacheBinding()
+        {
+            Release();
+        }
+
+        void Release()
+        {
+            // unbind first: a thread_local destroyed after this one may still free memory, and must not push onto a cache
+            // another thread has adopted in the meantime
+            PooledMemorySystem* boundSystem = memorySystem;
+            PooledThreadCache* boundCache = cache;
+            memorySystem = nullptr;
+            memorySystemId = 0;
+            cache = nullptr;
+            if (boundSystem && boundCache)
+            {
+                boundSystem->ReleaseThreadCache(boundCache);
+            }
+        }
+    };
+
+    static thread_local PooledThreadCacheBinding s_threadCacheBinding = { nullptr, 0, nullptr };
+
+    struct MemoryArena::Chunk
+    {
+        Chunk* next;
+    };
+
+    MemoryArena::MemoryArena(std::size_t chunkSize) :
+        m_chunkSize(chunkSize),
+        m_reservedBytes(0),
+        m_chunks(nullptr),
+        m_cursor(nullptr),
+        m_end(nullptr)
+    {
+    }
+
+    MemoryArena::~MemoryArena()
+    {
+        while (m_chunks)
+        {
+            Chunk* next = m_chunks->next;
+            free(m_chunks);
+            m_chunks = next;
+        }
+    }
+
+    void* MemoryArena::Allocate(std::size_t size, std::size_t alignment, std::size_t headerSize)
+    {
+        char* memory = m_cursor ? AlignUp(m_cursor + headerSize, alignment) : nullptr;
+        if (!memory || memory + size > m_end)
+        {
+            std::size_t required = sizeof(Chunk) + headerSize + alignment + size;
+            std::size_t chunkSize = required > m_chunkSize ? required : m_chunkSize;
+            Chunk* chunk = static_cast<Chunk*>(malloc(chunkSize));
+            if (!chunk)
+            {
+                return nullptr;
+            }
+            m_reservedBytes += chunkSize;
+
+            if (required > m_chunkSize && m_chunks)
+            {
+                // oversized allocation: keep bumping in the current chunk afterwards
+                chunk->next = m_chunks->next;
+                m_chunks->next = chunk;
+                return AlignUp(reinterpret_cast<char*>(chunk + 1) + headerSize, alignment);
+            }
+
+            chunk->next = m_chunks;
+            m_chunks = chunk;
+            m_cursor = reinterpret_cast<char*>(chunk + 1);
+            m_end = reinterpret_cast<char*>(chunk) + chunkSize;
+            memory = AlignUp(m_cursor + headerSize, alignment);
+        }
+
+        m_cursor = memory + size;
+        return memory;
+    }
+
+    ScopedMemoryArena::ScopedMemoryArena(MemoryArena& arena) :
+        m_previousArena(s_currentArena)
+    {
+        s_currentArena = &arena;
+    }
+
+    ScopedMemoryArena::~ScopedMemoryArena()
+    {
+        s_currentArena = m_previousArena;
+    }
+
+    PooledMemorySystem::PooledMemorySystem(bool trackAllocationTags) :
+        m_id(s_nextMemorySystemId++),
+        m_trackAllocationTags(trackAllocationTags),
+        m_tagStats(nullptr),
+        m_allCaches(nullptr),
+        m_idleCaches(nullptr)
+    {
+        if (m_trackAllocationTags)
+        {
+            m_tagStats = static_cast<PooledTagStats*>(malloc(sizeof(PooledTagStats) * TAG_SLOT_COUNT));
+            assert(m_tagStats);
+            for (uint32_t i = 0; i < TAG_SLOT_COUNT; ++i)
+            {
+                PooledTagStats* stats = new (m_tagStats + i) PooledTagStats;
+                stats->allocationTag.store(nullptr, std::memory_order_relaxed);
+                stats->allocationCount.store(0, std::memory_order_relaxed);
+                stats->freeCount.store(0, std::memory_order_relaxed);
+                stats->bytesAllocated.store(0, std::memory_order_relaxed);
+                stats->bytesFreed.store(0, std::memory_order_relaxed);
+            }
+            m_tagStats[0].allocationTag.store(UNTAGGED, std::memory_order_relaxed);
+        }
+    }
+
+    PooledMemorySystem::~PooledMemorySystem()
+    {
+        if (s_threadCacheBinding.memorySystemId == m_id)
+        {
+            s_threadCacheBinding.memorySystem = nullptr;
+            s_threadCacheBinding.cache = nullptr;
+        }
+
+        while (m_allCaches)
+        {
+            PooledThreadCache* next = m_allCaches->nextCache;
+            m_allCaches->~PooledThreadCache();
+            free(m_allCaches);
+            m_allCaches = next;
+        }
+
+        if (m_tagStats)
+        {
+            for (uint32_t i = 0; i < TAG_SLOT_COUNT; ++i)
+            {
+                m_tagStats[i].~PooledTagStats();
+            }
+            free(m_tagStats);
+        }
+    }
+
+    void* PooledMemorySystem::AllocateMemory(std::size_t blockSize, std::size_t alignment, const char* allocationTag)
+    {
+        uint32_t tagSlot = m_trackAllocationTags ? FindTagSlot(allocationTag) : 0;
+        if (alignment < BLOCK_HEADER_SIZE)
+        {
+            alignment = BLOCK_HEADER_SIZE;
+        }
+
+        MemoryArena* arena = s_currentArena;
+        if (arena)
+        {
+            void* memory = arena->Allocate(blockSize, alignment, BLOCK_HEADER_SIZE + LARGE_HEADER_SIZE);
+            if (!memory)
+            {
+                return nullptr;
+            }
+            LargeHeader* largeHeader = GetLargeHeader(memory);
+            largeHeader->rawMemory = nullptr;
+            largeHeader->size = blockSize;
+            BlockHeader* header = GetBlockHeader(memory);
+            header->owner = arena;
+            header->sizeClass = ARENA_BLOCK;
+            header->tagSlot = tagSlot;
+            RecordAllocation(tagSlot, blockSize);
+            return memory;
+        }
+
+        if (alignment == BLOCK_HEADER_SIZE && blockSize <= LARGEST_SIZE_CLASS)
+        {
+            uint32_t sizeClass = GetSizeClass(blockSize);
+            PooledThreadCache* cache = GetThreadCache();
+            FreeBlock* block = cache ? cache->PopBlock(sizeClass) : nullptr;
+            if (!block)
+            {
+                return nullptr;
+            }
+            BlockHeader* header = reinterpret_cast<BlockHeader*>(block);
+            header->owner = cache;
+            header->sizeClass = sizeClass;
+            header->tagSlot = tagSlot;
+            RecordAllocation(tagSlot, GetSizeClassBytes(sizeClass));
+            return reinterpret_cast<char*>(header) + BLOCK_HEADER_SIZE;
+        }
+
+        char* rawMemory = static_cast<char*>(malloc(LARGE_HEADER_SIZE + BLOCK_HEADER_SIZE + alignment + blockSize));
+        if (!rawMemory)
+        {
+            return nullptr;
+        }
+        void* memory = AlignUp(rawMemory + LARGE_HEADER_SIZE + BLOCK_HEADER_SIZE, alignment);
+        LargeHeader* largeHeader = GetLargeHeader(memory);
+        largeHeader->rawMemory = rawMemory;
+        largeHeader->size = blockSize;
+        BlockHeader* header = GetBlockHeader(memory);
+        header->owner = nullptr;
+        header->sizeClass = LARGE_BLOCK;
+        header->tagSlot = tagSlot;
+        RecordAllocation(tagSlot, blockSize);
+        return memory;
+    }
+
+    void PooledMemorySystem::FreeMemory(void* memoryPtr)
+    {
+        if (!memoryPtr)
+        {
+            return;
+        }
+
+        BlockHeader* header = GetBlockHeader(memoryPtr);
+        uint32_t sizeClass = header->sizeClass;
+        if (sizeClass == ARENA_BLOCK)
+        {
+            // released with the arena
+            RecordFree(header->tagSlot, GetLargeHeader(memoryPtr)->size);
+            return;
+        }
+
+        if (sizeClass == LARGE_BLOCK)
+        {
+            LargeHeader* largeHeader = GetLargeHeader(memoryPtr);
+            RecordFree(header->tagSlot, largeHeader->size);
+            free(largeHeader->rawMemory);
+            return;
+        }
+
+        assert(sizeClass < SIZE_CLASS_COUNT);
+        RecordFree(header->tagSlot, GetSizeClassBytes(sizeClass));
+        PooledThreadCache* owner = static_cast<PooledThreadCache*>(header->owner);
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(header);
+        if (s_threadCacheBinding.memorySystemId == m_id && s_threadCacheBinding.cache == owner)
+        {
+            owner->PushLocal(sizeClass, block);
+        }
+        else
+        {
+            owner->PushRemote(sizeClass, block);
+        }
+    }
+
+    Aws::Vector<AllocationTagStats> PooledMemorySystem::GetAllocationTagStats() const
+    {
+        Aws::Vector<AllocationTagStats> result;
+        if (!m_trackAllocationTags)
+        {
+            return result;
+        }
+
+        for (uint32_t i = 0; i < TAG_SLOT_COUNT; ++i)
+        {
+            const char* allocationTag = m_tagStats[i].allocationTag.load(std::memory_order_acquire);
+            if (!allocationTag)
+            {
+                continue;
+            }
+
+            uint64_t allocationCount = m_tagStats[i].allocationCount.load(std::memory_order_relaxed);
+            uint64_t freeCount = m_tagStats[i].freeCount.load(std::memory_order_relaxed);
+            uint64_t bytesAllocated = m_tagStats[i].bytesAllocated.load(std::memory_order_relaxed);
+            uint64_t bytesFreed = m_tagStats[i].bytesFreed.load(std::memory_order_relaxed);
+            if (allocationCount == 0 && freeCount == 0)
+            {
+                continue;
+            }
+
+            // the same tag name can live at different addresses in different translation units
+            auto existing = std::find_if(result.begin(), result.end(),
+                [allocationTag](const AllocationTagStats& stats) { return strcmp(stats.allocationTag, allocationTag) == 0; });
+            if (existing == result.end())
+            {
+                AllocationTagStats stats = { allocationTag, 0, 0, 0, 0 };
+                existing = result.insert(result.end(), stats);
+            }
+            existing->allocationCount += allocationCount;
+            existing->freeCount += freeCount;
+            existing->bytesAllocated += bytesAllocated;
+            existing->bytesInUse += bytesAllocated - bytesFreed;
+        }
+
+        return result;
+    }
+
+    PooledThreadCache* PooledMemorySystem::GetThreadCache()
+    {
+        PooledThreadCacheBinding& binding = s_threadCacheBinding;
+        if (binding.memorySystemId == m_id)
+        {
+            return binding.cache;
+        }
+
+        // first allocation of this thread from this memory system; the cache of the one it used before goes back to that system's pool
+        binding.Release();
+        PooledThreadCache* cache = AcquireThreadCache();
+        if (cache)
+        {
+            binding.memorySystem = this;
+            binding.memorySystemId = m_id;
+            binding.cache = cache;
+        }
+        return cache;
+    }
+
+    PooledThreadCache* PooledMemorySystem::AcquireThreadCache()
+    {
+        std::lock_guard<std::mutex> locker(m_cachesMutex);
+        if (m_idleCaches)
+        {
+            PooledThreadCache* cache = m_idleCaches;
+            m_idleCaches = cache->nextIdle;
+            cache->nextIdle = nullptr;
+            return cache;
+        }
+
+        void* rawMemory = malloc(sizeof(PooledThreadCache));
+        if (!rawMemory)
+        {
+            return nullptr;
+        }
+        PooledThreadCache* cache = new (rawMemory) PooledThreadCache;
+        cache->nextCache = m_allCaches;
+        m_allCaches = cache;
+        return cache;
+    }
+
+    void PooledMemorySystem::ReleaseThreadCache(PooledThreadCache* cache)
+    {
+        // blocks of the cache stay valid; whoever adopts it next also adopts the frees that happen in the meantime
+        std::lock_guard<std::mutex> locker(m_cachesMutex);
+        cache->nextIdle = m_idleCaches;
+        m_idleCaches = cache;
+    }
+
+    uint32_t PooledMemorySystem::FindTagSlot(const char* allocationTag)
+    {
+        if (!allocationTag)
+        {
+            return 0;
+        }
+
+        uint32_t slot = static_cast<uint32_t>((reinterpret_cast<std::size_t>(allocationTag) >> 3) % (TAG_SLOT_COUNT - 1)) + 1;
+        for (uint32_t probe = 0; probe < TAG_SLOT_COUNT - 1; ++probe)
+        {
+            const char* slotTag = m_tagStats[slot].allocationTag.load(std::memory_order_acquire);
+            if (slotTag == allocationTag)
+            {
+                return slot;
+            }
+            if (!slotTag)
+            {
+                const char* expected = nullptr;
+                if (m_tagStats[slot].allocationTag.compare_exchange_strong(expected, allocationTag, std::memory_order_acq_rel) ||
+                    expected == allocationTag)
+                {
+                    return slot;
+                }
+            }
+            slot = slot + 1 < TAG_SLOT_COUNT ? slot + 1 : 1;
+        }
+
+        return 0;
+    }
+
+    void PooledMemorySystem::RecordAllocation(uint32_t tagSlot, std::size_t size)
+    {
+        if (m_trackAllocationTags)
+        {
+            m_tagStats[tagSlot].allocationCount.fetch_add(1, std::memory_order_relaxed);
+            m_tagStats[tagSlot].bytesAllocated.fetch_add(size, std::memory_order_relaxed);
+        }
+    }
+
+    void PooledMemorySystem::RecordFree(uint32_t tagSlot, std::size_t size)
+    {
+        if (m_trackAllocationTags)
+        {
+            m_tagStats[tagSlot].freeCount.fetch_add(1, std::memory_order_relaxed);
+            m_tagStats[tagSlot].bytesFreed.fetch_add(size, std::memory_order_relaxed);
+        }
+    }
+
+} // namespace Memory
+} // namespace Utils
+} // namespace Aws
@@ -0,0 +1,188 @@
+/*
+ * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *  http://aws.amazon.com/apache2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <aws/core/utils/threading/BatchingLoop.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <algorithm>
+#include <random>
+
+using namespace Aws::Utils::Threading;
+
+static const char* CLASS_TAG = "BatchingLoop";
+
+std::chrono::milliseconds Aws::Utils::Threading::ComputeRetryDelay(unsigned attempt, std::chrono::milliseconds baseDelay, std::chrono::milliseconds maxDelay)
+{
+    return ComputeRetryDelay(attempt, baseDelay, maxDelay, DrawRetrySpread());
+}
+
+std::chrono::milliseconds Aws::Utils::Threading::ComputeRetryDelay(unsigned attempt, std::chrono::milliseconds baseDelay, std::chrono::milliseconds maxDelay, double spread)
+{
+    attempt = (std::max)(attempt, 1u);
+    std::chrono::milliseconds delay(baseDelay.count() << (std::min)(attempt - 1, 20u));
+    delay = (std::max)((std::min)(delay, maxDelay), std::chrono::milliseconds(0));
+    spread = (std::max)((std::min)(spread, 1.0), 0.0);
+    auto half = delay / 2;
+    return delay - half + std::chrono::milliseconds(static_cast<long long>(spread * half.count() + 0.5));
+}
+
+double Aws::Utils::Threading::DrawRetrySpread()
+{
+    // seeded once per thread, so that neither threads nor processes started together draw the same delays
+    static thread_local std::mt19937 generator(std::random_device{}());
+    return std::uniform_real_distribution<double>(0.0, 1.0)(generator);
+}
+
+BatchingLoop::BatchingLoop(size_t maxRequestsInFlight, Executor* executor) :
+    m_maxRequestsInFlight((std::max)(maxRequestsInFlight, static_cast<size_t>(1))),
+    m_executor(executor),
+    m_running(true),
+    m_loopRunning(false),
+    m_flushRequested(false),
+    m_requestsInFlight(0),
+    m_requestsSent(0)
+{
+}
+
+BatchingLoop::~BatchingLoop()
+{
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void BatchingLoop::StartLoop()
+{
+    m_loopRunning = true;
+    if (m_executor)
+    {
+        if (m_executor->Submit([this]() { Run(); }))
+        {
+            return;
+        }
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to submit the sending loop to the executor, running it on a thread of its own.");
+    }
+    m_thread = std::thread(&BatchingLoop::Run, this);
+}
+
+void BatchingLoop::StopLoop()
+{
+    std::unique_lock<std::mutex> locker(m_lock);
+    m_running = false;
+    m_signal.notify_all();
+    m_signal.wait(locker, [this]() { return !m_loopRunning; });
+    locker.unlock();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void BatchingLoop::RequestFlush()
+{
+    std::lock_guard<std::mutex> locker(m_lock);
+    m_flushRequested = true;
+    m_signal.notify_all();
+}
+
+void BatchingLoop::WaitUntilIdle()
+{
+    std::unique_lock<std::mutex> locker(m_lock);
+    m_signal.wait(locker, [this]() { return IsIdle(); });
+}
+
+void BatchingLoop::CompleteRequest()
+{
+    // nothing of the client is touched after this, so once the lock is released StopLoop() may return and the client go
+    std::lock_guard<std::mutex> locker(m_lock);
+    --m_requestsInFlight;
+    m_signal.notify_all();
+}
+
+void BatchingLoop::CopyLoopMetrics(BatchingMetrics& metrics) const
+{
+    metrics.requestsSent = m_requestsSent;
+    metrics.requestsInFlight = m_requestsInFlight;
+}
+
+std::function<void()> BatchingLoop::TakeHousekeeping(std::chrono::steady_clock::time_point, WakeUpTime&)
+{
+    return nullptr;
+}
+
+bool BatchingLoop::IsIdle() const
+{
+    return !HasBufferedEntries() && m_requestsInFlight == 0;
+}
+
+void BatchingLoop::Run()
+{
+    OnLoopStarted();
+    std::unique_lock<std::mutex> locker(m_lock);
+    while (true)
+    {
+        auto now = std::chrono::steady_clock::now();
+        WakeUpTime wakeUp;
+        auto housekeeping = TakeHousekeeping(now, wakeUp);
+        if (housekeeping)
+        {
+            locker.unlock();
+            housekeeping();
+            locker.lock();
+            continue;
+        }
+
+        if (m_requestsInFlight < m_maxRequestsInFlight)
+        {
+            auto request = TakeRequest(now, !m_running || m_flushRequested, wakeUp);
+            if (request)
+            {
+                ++m_requestsInFlight;
+                ++m_requestsSent;
+                // the entries taken may make room for threads waiting to buffer theirs
+                m_signal.notify_all();
+                locker.unlock();
+                request();
+                locker.lock();
+                continue;
+            }
+        }
+
+        // a flush lasts until the buffers run empty, retries included
+        if (!HasBufferedEntries())
+        {
+            m_flushRequested = false;
+        }
+
+        if (!m_running && IsIdle())
+        {
+            break;
+        }
+
+        if (wakeUp.IsSet())
+        {
+            m_signal.wait_until(locker, wakeUp.Get());
+        }
+        else
+        {
+            m_signal.wait(locker);
+        }
+    }
+
+    m_loopRunning = false;
+    m_signal.notify_all();
+}
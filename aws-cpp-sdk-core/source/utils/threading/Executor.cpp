@@ -22,11 +22,11 @@ static const char* POOLED_CLASS_TAG = "PooledThreadExecutor";
 
 using namespace Aws::Utils::Threading;
 
-bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
+bool DefaultExecutor::SubmitToThread(Task&& fx)
 {
-    auto main = [fx, this] { 
-        fx(); 
-        Detach(std::this_thread::get_id()); 
+    auto main = [this](Task& task) {
+        task();
+        Detach(std::this_thread::get_id());
     };
 
     State expected;
@@ -35,7 +35,7 @@ bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
         expected = State::Free;
         if(m_state.compare_exchange_strong(expected, State::Locked))
         {
-            std::thread t(main);
+            std::thread t(std::bind(main, std::move(fx)));
             const auto id = t.get_id(); // copy the id before we std::move the thread
             m_threads.emplace(id, std::move(t));
             m_state = State::Free;
@@ -108,22 +108,13 @@ PooledThreadExecutor::~PooledThreadExecutor()
 
     while(m_tasks.size() > 0)
     {
-        std::function<void()>* fn = m_tasks.front();
         m_tasks.pop();
-
-        if(fn)
-        {
-            Aws::Delete(fn);
-        }
     }
 
 }
 
-bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
+bool PooledThreadExecutor::SubmitToThread(Task&& fn)
 {
-    //avoid the need to do copies inside the lock. Instead lets do a pointer push.
-    std::function<void()>* fnCpy = Aws::New<std::function<void()>>(POOLED_CLASS_TAG, std::forward<std::function<void()>>(fn));
-
     {
         std::lock_guard<std::mutex> locker(m_queueLock);
 
@@ -132,7 +123,8 @@ bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
             return false;
         }
 
-        m_tasks.push(fnCpy);
+        // moving a task only moves its inline storage or pointer, it is cheap enough to do inside the lock.
+        m_tasks.push(std::move(fn));
     }
 
     m_sync.Release();
@@ -140,21 +132,18 @@ bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fn)
     return true;
 }
 
-std::function<void()>* PooledThreadExecutor::PopTask()
+bool PooledThreadExecutor::PopTask(Task& task)
 {
     std::lock_guard<std::mutex> locker(m_queueLock);
 
     if (m_tasks.size() > 0)
     {
-        std::function<void()>* fn = m_tasks.front();
-        if (fn)
-        {           
-            m_tasks.pop();
-            return fn;
-        }
+        task = std::move(m_tasks.front());
+        m_tasks.pop();
+        return true;
     }
 
-    return nullptr;
+    return false;
 }
 
 bool PooledThreadExecutor::HasTasks()
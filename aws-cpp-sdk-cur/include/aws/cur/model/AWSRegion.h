@@ -40,7 +40,8 @@ namespace AWSRegionMapper
 {
 AWS_COSTANDUSAGEREPORTSERVICE_API AWSRegion GetAWSRegionForName(const Aws::String& name);
 
-AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForAWSRegion(AWSRegion value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForAWSRegion(AWSRegion value);
 } // namespace AWSRegionMapper
 } // namespace Model
 } // namespace CostandUsageReportService
@@ -34,7 +34,8 @@ namespace AdditionalArtifactMapper
 {
 AWS_COSTANDUSAGEREPORTSERVICE_API AdditionalArtifact GetAdditionalArtifactForName(const Aws::String& name);
 
-AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForAdditionalArtifact(AdditionalArtifact value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForAdditionalArtifact(AdditionalArtifact value);
 } // namespace AdditionalArtifactMapper
 } // namespace Model
 } // namespace CostandUsageReportService
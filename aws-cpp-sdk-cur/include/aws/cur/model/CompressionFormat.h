@@ -34,7 +34,8 @@ namespace CompressionFormatMapper
 {
 AWS_COSTANDUSAGEREPORTSERVICE_API CompressionFormat GetCompressionFormatForName(const Aws::String& name);
 
-AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForCompressionFormat(CompressionFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForCompressionFormat(CompressionFormat value);
 } // namespace CompressionFormatMapper
 } // namespace Model
 } // namespace CostandUsageReportService
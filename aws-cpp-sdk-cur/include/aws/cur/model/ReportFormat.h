@@ -33,7 +33,8 @@ namespace ReportFormatMapper
 {
 AWS_COSTANDUSAGEREPORTSERVICE_API ReportFormat GetReportFormatForName(const Aws::String& name);
 
-AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForReportFormat(ReportFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForReportFormat(ReportFormat value);
 } // namespace ReportFormatMapper
 } // namespace Model
 } // namespace CostandUsageReportService
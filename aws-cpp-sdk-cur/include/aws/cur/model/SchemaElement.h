@@ -33,7 +33,8 @@ namespace SchemaElementMapper
 {
 AWS_COSTANDUSAGEREPORTSERVICE_API SchemaElement GetSchemaElementForName(const Aws::String& name);
 
-AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForSchemaElement(SchemaElement value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForSchemaElement(SchemaElement value);
 } // namespace SchemaElementMapper
 } // namespace Model
 } // namespace CostandUsageReportService
@@ -34,7 +34,8 @@ namespace TimeUnitMapper
 {
 AWS_COSTANDUSAGEREPORTSERVICE_API TimeUnit GetTimeUnitForName(const Aws::String& name);
 
-AWS_COSTANDUSAGEREPORTSERVICE_API Aws::String GetNameForTimeUnit(TimeUnit value);
+// names of values not modeled point into the enum overflow container
+AWS_COSTANDUSAGEREPORTSERVICE_API const char* GetNameForTimeUnit(TimeUnit value);
 } // namespace TimeUnitMapper
 } // namespace Model
 } // namespace CostandUsageReportService
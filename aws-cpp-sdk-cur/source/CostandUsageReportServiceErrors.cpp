@@ -28,9 +28,9 @@ namespace CostandUsageReportService
 namespace CostandUsageReportServiceErrorMapper
 {
 
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalErrorException");
-static const int REPORT_LIMIT_REACHED_HASH = HashingUtils::HashString("ReportLimitReachedException");
-static const int DUPLICATE_REPORT_NAME_HASH = HashingUtils::HashString("DuplicateReportNameException");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalErrorException");
+static constexpr int REPORT_LIMIT_REACHED_HASH = HashingUtils::CompileTimeHashString("ReportLimitReachedException");
+static constexpr int DUPLICATE_REPORT_NAME_HASH = HashingUtils::CompileTimeHashString("DuplicateReportNameException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,50 +30,72 @@ namespace Aws
       namespace AWSRegionMapper
       {
 
-        static const int us_east_1_HASH = HashingUtils::HashString("us-east-1");
-        static const int us_west_1_HASH = HashingUtils::HashString("us-west-1");
-        static const int us_west_2_HASH = HashingUtils::HashString("us-west-2");
-        static const int eu_central_1_HASH = HashingUtils::HashString("eu-central-1");
-        static const int eu_west_1_HASH = HashingUtils::HashString("eu-west-1");
-        static const int ap_southeast_1_HASH = HashingUtils::HashString("ap-southeast-1");
-        static const int ap_southeast_2_HASH = HashingUtils::HashString("ap-southeast-2");
-        static const int ap_northeast_1_HASH = HashingUtils::HashString("ap-northeast-1");
+        static constexpr int us_east_1_HASH = HashingUtils::CompileTimeHashString("us-east-1");
+        static constexpr int us_west_1_HASH = HashingUtils::CompileTimeHashString("us-west-1");
+        static constexpr int us_west_2_HASH = HashingUtils::CompileTimeHashString("us-west-2");
+        static constexpr int eu_central_1_HASH = HashingUtils::CompileTimeHashString("eu-central-1");
+        static constexpr int eu_west_1_HASH = HashingUtils::CompileTimeHashString("eu-west-1");
+        static constexpr int ap_southeast_1_HASH = HashingUtils::CompileTimeHashString("ap-southeast-1");
+        static constexpr int ap_southeast_2_HASH = HashingUtils::CompileTimeHashString("ap-southeast-2");
+        static constexpr int ap_northeast_1_HASH = HashingUtils::CompileTimeHashString("ap-northeast-1");
 
 
         AWSRegion GetAWSRegionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == us_east_1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AWSRegion::us_east_1;
-          }
-          else if (hashCode == us_west_1_HASH)
-          {
-            return AWSRegion::us_west_1;
-          }
-          else if (hashCode == us_west_2_HASH)
-          {
-            return AWSRegion::us_west_2;
-          }
-          else if (hashCode == eu_central_1_HASH)
-          {
-            return AWSRegion::eu_central_1;
-          }
-          else if (hashCode == eu_west_1_HASH)
-          {
-            return AWSRegion::eu_west_1;
-          }
-          else if (hashCode == ap_southeast_1_HASH)
-          {
-            return AWSRegion::ap_southeast_1;
-          }
-          else if (hashCode == ap_southeast_2_HASH)
-          {
-            return AWSRegion::ap_southeast_2;
-          }
-          else if (hashCode == ap_northeast_1_HASH)
-          {
-            return AWSRegion::ap_northeast_1;
+          case us_east_1_HASH:
+            if (name == "us-east-1")
+            {
+              return AWSRegion::us_east_1;
+            }
+            break;
+          case us_west_1_HASH:
+            if (name == "us-west-1")
+            {
+              return AWSRegion::us_west_1;
+            }
+            break;
+          case us_west_2_HASH:
+            if (name == "us-west-2")
+            {
+              return AWSRegion::us_west_2;
+            }
+            break;
+          case eu_central_1_HASH:
+            if (name == "eu-central-1")
+            {
+              return AWSRegion::eu_central_1;
+            }
+            break;
+          case eu_west_1_HASH:
+            if (name == "eu-west-1")
+            {
+              return AWSRegion::eu_west_1;
+            }
+            break;
+          case ap_southeast_1_HASH:
+            if (name == "ap-southeast-1")
+            {
+              return AWSRegion::ap_southeast_1;
+            }
+            break;
+          case ap_southeast_2_HASH:
+            if (name == "ap-southeast-2")
+            {
+              return AWSRegion::ap_southeast_2;
+            }
+            break;
+          case ap_northeast_1_HASH:
+            if (name == "ap-northeast-1")
+            {
+              return AWSRegion::ap_northeast_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return AWSRegion::NOT_SET;
         }
 
-        Aws::String GetNameForAWSRegion(AWSRegion enumValue)
+        const char* GetNameForAWSRegion(AWSRegion enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AdditionalArtifactMapper
       {
 
-        static const int REDSHIFT_HASH = HashingUtils::HashString("REDSHIFT");
-        static const int QUICKSIGHT_HASH = HashingUtils::HashString("QUICKSIGHT");
+        static constexpr int REDSHIFT_HASH = HashingUtils::CompileTimeHashString("REDSHIFT");
+        static constexpr int QUICKSIGHT_HASH = HashingUtils::CompileTimeHashString("QUICKSIGHT");
 
 
         AdditionalArtifact GetAdditionalArtifactForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REDSHIFT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AdditionalArtifact::REDSHIFT;
-          }
-          else if (hashCode == QUICKSIGHT_HASH)
-          {
-            return AdditionalArtifact::QUICKSIGHT;
+          case REDSHIFT_HASH:
+            if (name == "REDSHIFT")
+            {
+              return AdditionalArtifact::REDSHIFT;
+            }
+            break;
+          case QUICKSIGHT_HASH:
+            if (name == "QUICKSIGHT")
+            {
+              return AdditionalArtifact::QUICKSIGHT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AdditionalArtifact::NOT_SET;
         }
 
-        Aws::String GetNameForAdditionalArtifact(AdditionalArtifact enumValue)
+        const char* GetNameForAdditionalArtifact(AdditionalArtifact enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
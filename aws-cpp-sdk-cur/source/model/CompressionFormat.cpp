@@ -30,20 +30,30 @@ namespace Aws
       namespace CompressionFormatMapper
       {
 
-        static const int ZIP_HASH = HashingUtils::HashString("ZIP");
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
+        static constexpr int ZIP_HASH = HashingUtils::CompileTimeHashString("ZIP");
+        static constexpr int GZIP_HASH = HashingUtils::CompileTimeHashString("GZIP");
 
 
         CompressionFormat GetCompressionFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ZIP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CompressionFormat::ZIP;
-          }
-          else if (hashCode == GZIP_HASH)
-          {
-            return CompressionFormat::GZIP;
+          case ZIP_HASH:
+            if (name == "ZIP")
+            {
+              return CompressionFormat::ZIP;
+            }
+            break;
+          case GZIP_HASH:
+            if (name == "GZIP")
+            {
+              return CompressionFormat::GZIP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CompressionFormat::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionFormat(CompressionFormat enumValue)
+        const char* GetNameForCompressionFormat(CompressionFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
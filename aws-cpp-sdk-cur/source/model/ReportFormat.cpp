@@ -30,15 +30,23 @@ namespace Aws
       namespace ReportFormatMapper
       {
 
-        static const int textORcsv_HASH = HashingUtils::HashString("textORcsv");
+        static constexpr int textORcsv_HASH = HashingUtils::CompileTimeHashString("textORcsv");
 
 
         ReportFormat GetReportFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == textORcsv_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReportFormat::textORcsv;
+          case textORcsv_HASH:
+            if (name == "textORcsv")
+            {
+              return ReportFormat::textORcsv;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ReportFormat::NOT_SET;
         }
 
-        Aws::String GetNameForReportFormat(ReportFormat enumValue)
+        const char* GetNameForReportFormat(ReportFormat enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace SchemaElementMapper
       {
 
-        static const int RESOURCES_HASH = HashingUtils::HashString("RESOURCES");
+        static constexpr int RESOURCES_HASH = HashingUtils::CompileTimeHashString("RESOURCES");
 
 
         SchemaElement GetSchemaElementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RESOURCES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SchemaElement::RESOURCES;
+          case RESOURCES_HASH:
+            if (name == "RESOURCES")
+            {
+              return SchemaElement::RESOURCES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return SchemaElement::NOT_SET;
         }
 
-        Aws::String GetNameForSchemaElement(SchemaElement enumValue)
+        const char* GetNameForSchemaElement(SchemaElement enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
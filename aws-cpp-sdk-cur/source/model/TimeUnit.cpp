@@ -30,20 +30,30 @@ namespace Aws
       namespace TimeUnitMapper
       {
 
-        static const int HOURLY_HASH = HashingUtils::HashString("HOURLY");
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
+        static constexpr int HOURLY_HASH = HashingUtils::CompileTimeHashString("HOURLY");
+        static constexpr int DAILY_HASH = HashingUtils::CompileTimeHashString("DAILY");
 
 
         TimeUnit GetTimeUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOURLY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TimeUnit::HOURLY;
-          }
-          else if (hashCode == DAILY_HASH)
-          {
-            return TimeUnit::DAILY;
+          case HOURLY_HASH:
+            if (name == "HOURLY")
+            {
+              return TimeUnit::HOURLY;
+            }
+            break;
+          case DAILY_HASH:
+            if (name == "DAILY")
+            {
+              return TimeUnit::DAILY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TimeUnit::NOT_SET;
         }
 
-        Aws::String GetNameForTimeUnit(TimeUnit enumValue)
+        const char* GetNameForTimeUnit(TimeUnit enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -37,7 +37,8 @@ namespace OperatorTypeMapper
 {
 AWS_DATAPIPELINE_API OperatorType GetOperatorTypeForName(const Aws::String& name);
 
-AWS_DATAPIPELINE_API Aws::String GetNameForOperatorType(OperatorType value);
+// names of values not modeled point into the enum overflow container
+AWS_DATAPIPELINE_API const char* GetNameForOperatorType(OperatorType value);
 } // namespace OperatorTypeMapper
 } // namespace Model
 } // namespace DataPipeline
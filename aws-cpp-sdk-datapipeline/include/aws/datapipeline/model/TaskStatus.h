@@ -35,7 +35,8 @@ namespace TaskStatusMapper
 {
 AWS_DATAPIPELINE_API TaskStatus GetTaskStatusForName(const Aws::String& name);
 
-AWS_DATAPIPELINE_API Aws::String GetNameForTaskStatus(TaskStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DATAPIPELINE_API const char* GetNameForTaskStatus(TaskStatus value);
 } // namespace TaskStatusMapper
 } // namespace Model
 } // namespace DataPipeline
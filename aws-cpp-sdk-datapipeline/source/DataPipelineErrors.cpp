@@ -28,11 +28,11 @@ namespace DataPipeline
 namespace DataPipelineErrorMapper
 {
 
-static const int INTERNAL_SERVICE_HASH = HashingUtils::HashString("InternalServiceError");
-static const int TASK_NOT_FOUND_HASH = HashingUtils::HashString("TaskNotFoundException");
-static const int PIPELINE_NOT_FOUND_HASH = HashingUtils::HashString("PipelineNotFoundException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int PIPELINE_DELETED_HASH = HashingUtils::HashString("PipelineDeletedException");
+static constexpr int INTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("InternalServiceError");
+static constexpr int TASK_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("TaskNotFoundException");
+static constexpr int PIPELINE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("PipelineNotFoundException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int PIPELINE_DELETED_HASH = HashingUtils::CompileTimeHashString("PipelineDeletedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
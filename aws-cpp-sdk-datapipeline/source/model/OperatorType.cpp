@@ -30,35 +30,51 @@ namespace Aws
       namespace OperatorTypeMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int REF_EQ_HASH = HashingUtils::HashString("REF_EQ");
-        static const int LE_HASH = HashingUtils::HashString("LE");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int BETWEEN_HASH = HashingUtils::HashString("BETWEEN");
+        static constexpr int EQ_HASH = HashingUtils::CompileTimeHashString("EQ");
+        static constexpr int REF_EQ_HASH = HashingUtils::CompileTimeHashString("REF_EQ");
+        static constexpr int LE_HASH = HashingUtils::CompileTimeHashString("LE");
+        static constexpr int GE_HASH = HashingUtils::CompileTimeHashString("GE");
+        static constexpr int BETWEEN_HASH = HashingUtils::CompileTimeHashString("BETWEEN");
 
 
         OperatorType GetOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperatorType::EQ;
-          }
-          else if (hashCode == REF_EQ_HASH)
-          {
-            return OperatorType::REF_EQ;
-          }
-          else if (hashCode == LE_HASH)
-          {
-            return OperatorType::LE;
-          }
-          else if (hashCode == GE_HASH)
-          {
-            return OperatorType::GE;
-          }
-          else if (hashCode == BETWEEN_HASH)
-          {
-            return OperatorType::BETWEEN;
+          case EQ_HASH:
+            if (name == "EQ")
+            {
+              return OperatorType::EQ;
+            }
+            break;
+          case REF_EQ_HASH:
+            if (name == "REF_EQ")
+            {
+              return OperatorType::REF_EQ;
+            }
+            break;
+          case LE_HASH:
+            if (name == "LE")
+            {
+              return OperatorType::LE;
+            }
+            break;
+          case GE_HASH:
+            if (name == "GE")
+            {
+              return OperatorType::GE;
+            }
+            break;
+          case BETWEEN_HASH:
+            if (name == "BETWEEN")
+            {
+              return OperatorType::BETWEEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return OperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForOperatorType(OperatorType enumValue)
+        const char* GetNameForOperatorType(OperatorType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
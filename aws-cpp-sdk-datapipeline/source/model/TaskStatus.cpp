@@ -30,25 +30,37 @@ namespace Aws
       namespace TaskStatusMapper
       {
 
-        static const int FINISHED_HASH = HashingUtils::HashString("FINISHED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int FALSE_HASH = HashingUtils::HashString("FALSE");
+        static constexpr int FINISHED_HASH = HashingUtils::CompileTimeHashString("FINISHED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int FALSE_HASH = HashingUtils::CompileTimeHashString("FALSE");
 
 
         TaskStatus GetTaskStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FINISHED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TaskStatus::FINISHED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return TaskStatus::FAILED;
-          }
-          else if (hashCode == FALSE_HASH)
-          {
-            return TaskStatus::FALSE;
+          case FINISHED_HASH:
+            if (name == "FINISHED")
+            {
+              return TaskStatus::FINISHED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return TaskStatus::FAILED;
+            }
+            break;
+          case FALSE_HASH:
+            if (name == "FALSE")
+            {
+              return TaskStatus::FALSE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TaskStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTaskStatus(TaskStatus enumValue)
+        const char* GetNameForTaskStatus(TaskStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
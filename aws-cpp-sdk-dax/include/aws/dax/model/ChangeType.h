@@ -34,7 +34,8 @@ namespace ChangeTypeMapper
 {
 AWS_DAX_API ChangeType GetChangeTypeForName(const Aws::String& name);
 
-AWS_DAX_API Aws::String GetNameForChangeType(ChangeType value);
+// names of values not modeled point into the enum overflow container
+AWS_DAX_API const char* GetNameForChangeType(ChangeType value);
 } // namespace ChangeTypeMapper
 } // namespace Model
 } // namespace DAX
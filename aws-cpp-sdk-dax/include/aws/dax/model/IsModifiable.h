@@ -35,7 +35,8 @@ namespace IsModifiableMapper
 {
 AWS_DAX_API IsModifiable GetIsModifiableForName(const Aws::String& name);
 
-AWS_DAX_API Aws::String GetNameForIsModifiable(IsModifiable value);
+// names of values not modeled point into the enum overflow container
+AWS_DAX_API const char* GetNameForIsModifiable(IsModifiable value);
 } // namespace IsModifiableMapper
 } // namespace Model
 } // namespace DAX
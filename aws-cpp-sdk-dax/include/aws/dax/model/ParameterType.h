@@ -34,7 +34,8 @@ namespace ParameterTypeMapper
 {
 AWS_DAX_API ParameterType GetParameterTypeForName(const Aws::String& name);
 
-AWS_DAX_API Aws::String GetNameForParameterType(ParameterType value);
+// names of values not modeled point into the enum overflow container
+AWS_DAX_API const char* GetNameForParameterType(ParameterType value);
 } // namespace ParameterTypeMapper
 } // namespace Model
 } // namespace DAX
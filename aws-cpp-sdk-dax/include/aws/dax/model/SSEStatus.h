@@ -36,7 +36,8 @@ namespace SSEStatusMapper
 {
 AWS_DAX_API SSEStatus GetSSEStatusForName(const Aws::String& name);
 
-AWS_DAX_API Aws::String GetNameForSSEStatus(SSEStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DAX_API const char* GetNameForSSEStatus(SSEStatus value);
 } // namespace SSEStatusMapper
 } // namespace Model
 } // namespace DAX
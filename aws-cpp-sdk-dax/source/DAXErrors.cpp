@@ -28,30 +28,30 @@ namespace DAX
 namespace DAXErrorMapper
 {
 
-static const int NODE_QUOTA_FOR_CLUSTER_EXCEEDED_FAULT_HASH = HashingUtils::HashString("NodeQuotaForClusterExceededFault");
-static const int SUBNET_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("SubnetGroupAlreadyExistsFault");
-static const int CLUSTER_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ClusterNotFoundFault");
-static const int INVALID_SUBNET_HASH = HashingUtils::HashString("InvalidSubnet");
-static const int CLUSTER_QUOTA_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ClusterQuotaForCustomerExceededFault");
-static const int TAG_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("TagNotFoundFault");
-static const int SUBNET_GROUP_IN_USE_FAULT_HASH = HashingUtils::HashString("SubnetGroupInUseFault");
-static const int INVALID_A_R_N_FAULT_HASH = HashingUtils::HashString("InvalidARNFault");
-static const int SUBNET_IN_USE_HASH = HashingUtils::HashString("SubnetInUse");
-static const int PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ParameterGroupNotFoundFault");
-static const int PARAMETER_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ParameterGroupQuotaExceededFault");
-static const int SUBNET_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("SubnetQuotaExceededFault");
-static const int INVALID_PARAMETER_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidParameterGroupStateFault");
-static const int SUBNET_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("SubnetGroupQuotaExceededFault");
-static const int TAG_QUOTA_PER_RESOURCE_EXCEEDED_HASH = HashingUtils::HashString("TagQuotaPerResourceExceeded");
-static const int INVALID_V_P_C_NETWORK_STATE_FAULT_HASH = HashingUtils::HashString("InvalidVPCNetworkStateFault");
-static const int SERVICE_LINKED_ROLE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ServiceLinkedRoleNotFoundFault");
-static const int INSUFFICIENT_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::HashString("InsufficientClusterCapacityFault");
-static const int PARAMETER_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ParameterGroupAlreadyExistsFault");
-static const int SUBNET_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SubnetGroupNotFoundFault");
-static const int CLUSTER_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ClusterAlreadyExistsFault");
-static const int NODE_QUOTA_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::HashString("NodeQuotaForCustomerExceededFault");
-static const int NODE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("NodeNotFoundFault");
-static const int INVALID_CLUSTER_STATE_FAULT_HASH = HashingUtils::HashString("InvalidClusterStateFault");
+static constexpr int NODE_QUOTA_FOR_CLUSTER_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("NodeQuotaForClusterExceededFault");
+static constexpr int SUBNET_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("SubnetGroupAlreadyExistsFault");
+static constexpr int CLUSTER_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterNotFoundFault");
+static constexpr int INVALID_SUBNET_HASH = HashingUtils::CompileTimeHashString("InvalidSubnet");
+static constexpr int CLUSTER_QUOTA_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterQuotaForCustomerExceededFault");
+static constexpr int TAG_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("TagNotFoundFault");
+static constexpr int SUBNET_GROUP_IN_USE_FAULT_HASH = HashingUtils::CompileTimeHashString("SubnetGroupInUseFault");
+static constexpr int INVALID_A_R_N_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidARNFault");
+static constexpr int SUBNET_IN_USE_HASH = HashingUtils::CompileTimeHashString("SubnetInUse");
+static constexpr int PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ParameterGroupNotFoundFault");
+static constexpr int PARAMETER_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ParameterGroupQuotaExceededFault");
+static constexpr int SUBNET_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("SubnetQuotaExceededFault");
+static constexpr int INVALID_PARAMETER_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidParameterGroupStateFault");
+static constexpr int SUBNET_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("SubnetGroupQuotaExceededFault");
+static constexpr int TAG_QUOTA_PER_RESOURCE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TagQuotaPerResourceExceeded");
+static constexpr int INVALID_V_P_C_NETWORK_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidVPCNetworkStateFault");
+static constexpr int SERVICE_LINKED_ROLE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ServiceLinkedRoleNotFoundFault");
+static constexpr int INSUFFICIENT_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::CompileTimeHashString("InsufficientClusterCapacityFault");
+static constexpr int PARAMETER_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ParameterGroupAlreadyExistsFault");
+static constexpr int SUBNET_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SubnetGroupNotFoundFault");
+static constexpr int CLUSTER_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterAlreadyExistsFault");
+static constexpr int NODE_QUOTA_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("NodeQuotaForCustomerExceededFault");
+static constexpr int NODE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("NodeNotFoundFault");
+static constexpr int INVALID_CLUSTER_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidClusterStateFault");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
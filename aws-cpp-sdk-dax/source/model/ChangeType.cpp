@@ -30,20 +30,30 @@ namespace Aws
       namespace ChangeTypeMapper
       {
 
-        static const int IMMEDIATE_HASH = HashingUtils::HashString("IMMEDIATE");
-        static const int REQUIRES_REBOOT_HASH = HashingUtils::HashString("REQUIRES_REBOOT");
+        static constexpr int IMMEDIATE_HASH = HashingUtils::CompileTimeHashString("IMMEDIATE");
+        static constexpr int REQUIRES_REBOOT_HASH = HashingUtils::CompileTimeHashString("REQUIRES_REBOOT");
 
 
         ChangeType GetChangeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMMEDIATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeType::IMMEDIATE;
-          }
-          else if (hashCode == REQUIRES_REBOOT_HASH)
-          {
-            return ChangeType::REQUIRES_REBOOT;
+          case IMMEDIATE_HASH:
+            if (name == "IMMEDIATE")
+            {
+              return ChangeType::IMMEDIATE;
+            }
+            break;
+          case REQUIRES_REBOOT_HASH:
+            if (name == "REQUIRES_REBOOT")
+            {
+              return ChangeType::REQUIRES_REBOOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ChangeType::NOT_SET;
         }
 
-        Aws::String GetNameForChangeType(ChangeType enumValue)
+        const char* GetNameForChangeType(ChangeType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
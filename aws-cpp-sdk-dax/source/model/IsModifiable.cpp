@@ -30,25 +30,37 @@ namespace Aws
       namespace IsModifiableMapper
       {
 
-        static const int TRUE_HASH = HashingUtils::HashString("TRUE");
-        static const int FALSE_HASH = HashingUtils::HashString("FALSE");
-        static const int CONDITIONAL_HASH = HashingUtils::HashString("CONDITIONAL");
+        static constexpr int TRUE_HASH = HashingUtils::CompileTimeHashString("TRUE");
+        static constexpr int FALSE_HASH = HashingUtils::CompileTimeHashString("FALSE");
+        static constexpr int CONDITIONAL_HASH = HashingUtils::CompileTimeHashString("CONDITIONAL");
 
 
         IsModifiable GetIsModifiableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRUE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IsModifiable::TRUE;
-          }
-          else if (hashCode == FALSE_HASH)
-          {
-            return IsModifiable::FALSE;
-          }
-          else if (hashCode == CONDITIONAL_HASH)
-          {
-            return IsModifiable::CONDITIONAL;
+          case TRUE_HASH:
+            if (name == "TRUE")
+            {
+              return IsModifiable::TRUE;
+            }
+            break;
+          case FALSE_HASH:
+            if (name == "FALSE")
+            {
+              return IsModifiable::FALSE;
+            }
+            break;
+          case CONDITIONAL_HASH:
+            if (name == "CONDITIONAL")
+            {
+              return IsModifiable::CONDITIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return IsModifiable::NOT_SET;
         }
 
-        Aws::String GetNameForIsModifiable(IsModifiable enumValue)
+        const char* GetNameForIsModifiable(IsModifiable enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
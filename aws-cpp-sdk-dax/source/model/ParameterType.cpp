@@ -30,20 +30,30 @@ namespace Aws
       namespace ParameterTypeMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int NODE_TYPE_SPECIFIC_HASH = HashingUtils::HashString("NODE_TYPE_SPECIFIC");
+        static constexpr int DEFAULT_HASH = HashingUtils::CompileTimeHashString("DEFAULT");
+        static constexpr int NODE_TYPE_SPECIFIC_HASH = HashingUtils::CompileTimeHashString("NODE_TYPE_SPECIFIC");
 
 
         ParameterType GetParameterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ParameterType::DEFAULT;
-          }
-          else if (hashCode == NODE_TYPE_SPECIFIC_HASH)
-          {
-            return ParameterType::NODE_TYPE_SPECIFIC;
+          case DEFAULT_HASH:
+            if (name == "DEFAULT")
+            {
+              return ParameterType::DEFAULT;
+            }
+            break;
+          case NODE_TYPE_SPECIFIC_HASH:
+            if (name == "NODE_TYPE_SPECIFIC")
+            {
+              return ParameterType::NODE_TYPE_SPECIFIC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ParameterType::NOT_SET;
         }
 
-        Aws::String GetNameForParameterType(ParameterType enumValue)
+        const char* GetNameForParameterType(ParameterType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
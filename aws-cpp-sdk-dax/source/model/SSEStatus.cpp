@@ -30,30 +30,44 @@ namespace Aws
       namespace SSEStatusMapper
       {
 
-        static const int ENABLING_HASH = HashingUtils::HashString("ENABLING");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLING_HASH = HashingUtils::HashString("DISABLING");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        static constexpr int ENABLING_HASH = HashingUtils::CompileTimeHashString("ENABLING");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
+        static constexpr int DISABLING_HASH = HashingUtils::CompileTimeHashString("DISABLING");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
 
 
         SSEStatus GetSSEStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SSEStatus::ENABLING;
-          }
-          else if (hashCode == ENABLED_HASH)
-          {
-            return SSEStatus::ENABLED;
-          }
-          else if (hashCode == DISABLING_HASH)
-          {
-            return SSEStatus::DISABLING;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return SSEStatus::DISABLED;
+          case ENABLING_HASH:
+            if (name == "ENABLING")
+            {
+              return SSEStatus::ENABLING;
+            }
+            break;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return SSEStatus::ENABLED;
+            }
+            break;
+          case DISABLING_HASH:
+            if (name == "DISABLING")
+            {
+              return SSEStatus::DISABLING;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return SSEStatus::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return SSEStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSSEStatus(SSEStatus enumValue)
+        const char* GetNameForSSEStatus(SSEStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int CLUSTER_HASH = HashingUtils::HashString("CLUSTER");
-        static const int PARAMETER_GROUP_HASH = HashingUtils::HashString("PARAMETER_GROUP");
-        static const int SUBNET_GROUP_HASH = HashingUtils::HashString("SUBNET_GROUP");
+        static constexpr int CLUSTER_HASH = HashingUtils::CompileTimeHashString("CLUSTER");
+        static constexpr int PARAMETER_GROUP_HASH = HashingUtils::CompileTimeHashString("PARAMETER_GROUP");
+        static constexpr int SUBNET_GROUP_HASH = HashingUtils::CompileTimeHashString("SUBNET_GROUP");
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLUSTER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceType::CLUSTER;
-          }
-          else if (hashCode == PARAMETER_GROUP_HASH)
-          {
-            return SourceType::PARAMETER_GROUP;
-          }
-          else if (hashCode == SUBNET_GROUP_HASH)
-          {
-            return SourceType::SUBNET_GROUP;
+          case CLUSTER_HASH:
+            if (name == "CLUSTER")
+            {
+              return SourceType::CLUSTER;
+            }
+            break;
+          case PARAMETER_GROUP_HASH:
+            if (name == "PARAMETER_GROUP")
+            {
+              return SourceType::PARAMETER_GROUP;
+            }
+            break;
+          case SUBNET_GROUP_HASH:
+            if (name == "SUBNET_GROUP")
+            {
+              return SourceType::SUBNET_GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceType(SourceType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace ArtifactCategoryMapper
 {
 AWS_DEVICEFARM_API ArtifactCategory GetArtifactCategoryForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForArtifactCategory(ArtifactCategory value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForArtifactCategory(ArtifactCategory value);
 } // namespace ArtifactCategoryMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -59,7 +59,8 @@ namespace ArtifactTypeMapper
 {
 AWS_DEVICEFARM_API ArtifactType GetArtifactTypeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForArtifactType(ArtifactType value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForArtifactType(ArtifactType value);
 } // namespace ArtifactTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
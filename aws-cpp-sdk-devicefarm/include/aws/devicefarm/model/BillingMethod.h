@@ -34,7 +34,8 @@ namespace BillingMethodMapper
 {
 AWS_DEVICEFARM_API BillingMethod GetBillingMethodForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForBillingMethod(BillingMethod value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForBillingMethod(BillingMethod value);
 } // namespace BillingMethodMapper
 } // namespace Model
 } // namespace DeviceFarm
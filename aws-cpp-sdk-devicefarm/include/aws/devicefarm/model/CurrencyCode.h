@@ -33,7 +33,8 @@ namespace CurrencyCodeMapper
 {
 AWS_DEVICEFARM_API CurrencyCode GetCurrencyCodeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForCurrencyCode(CurrencyCode value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForCurrencyCode(CurrencyCode value);
 } // namespace CurrencyCodeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -42,7 +42,8 @@ namespace DeviceAttributeMapper
 {
 AWS_DEVICEFARM_API DeviceAttribute GetDeviceAttributeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForDeviceAttribute(DeviceAttribute value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForDeviceAttribute(DeviceAttribute value);
 } // namespace DeviceAttributeMapper
 } // namespace Model
 } // namespace DeviceFarm
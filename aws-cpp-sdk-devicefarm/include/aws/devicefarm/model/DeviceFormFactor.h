@@ -34,7 +34,8 @@ namespace DeviceFormFactorMapper
 {
 AWS_DEVICEFARM_API DeviceFormFactor GetDeviceFormFactorForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForDeviceFormFactor(DeviceFormFactor value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForDeviceFormFactor(DeviceFormFactor value);
 } // namespace DeviceFormFactorMapper
 } // namespace Model
 } // namespace DeviceFarm
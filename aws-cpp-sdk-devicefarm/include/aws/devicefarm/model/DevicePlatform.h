@@ -34,7 +34,8 @@ namespace DevicePlatformMapper
 {
 AWS_DEVICEFARM_API DevicePlatform GetDevicePlatformForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForDevicePlatform(DevicePlatform value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForDevicePlatform(DevicePlatform value);
 } // namespace DevicePlatformMapper
 } // namespace Model
 } // namespace DeviceFarm
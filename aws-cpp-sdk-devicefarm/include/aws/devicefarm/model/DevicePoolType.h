@@ -34,7 +34,8 @@ namespace DevicePoolTypeMapper
 {
 AWS_DEVICEFARM_API DevicePoolType GetDevicePoolTypeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForDevicePoolType(DevicePoolType value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForDevicePoolType(DevicePoolType value);
 } // namespace DevicePoolTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -39,7 +39,8 @@ namespace ExecutionResultMapper
 {
 AWS_DEVICEFARM_API ExecutionResult GetExecutionResultForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForExecutionResult(ExecutionResult value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForExecutionResult(ExecutionResult value);
 } // namespace ExecutionResultMapper
 } // namespace Model
 } // namespace DeviceFarm
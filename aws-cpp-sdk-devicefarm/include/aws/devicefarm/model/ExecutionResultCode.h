@@ -34,7 +34,8 @@ namespace ExecutionResultCodeMapper
 {
 AWS_DEVICEFARM_API ExecutionResultCode GetExecutionResultCodeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForExecutionResultCode(ExecutionResultCode value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForExecutionResultCode(ExecutionResultCode value);
 } // namespace ExecutionResultCodeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -41,7 +41,8 @@ namespace ExecutionStatusMapper
 {
 AWS_DEVICEFARM_API ExecutionStatus GetExecutionStatusForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForExecutionStatus(ExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForExecutionStatus(ExecutionStatus value);
 } // namespace ExecutionStatusMapper
 } // namespace Model
 } // namespace DeviceFarm
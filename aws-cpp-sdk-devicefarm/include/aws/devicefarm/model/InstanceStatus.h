@@ -36,7 +36,8 @@ namespace InstanceStatusMapper
 {
 AWS_DEVICEFARM_API InstanceStatus GetInstanceStatusForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForInstanceStatus(InstanceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForInstanceStatus(InstanceStatus value);
 } // namespace InstanceStatusMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -35,7 +35,8 @@ namespace InteractionModeMapper
 {
 AWS_DEVICEFARM_API InteractionMode GetInteractionModeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForInteractionMode(InteractionMode value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForInteractionMode(InteractionMode value);
 } // namespace InteractionModeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -34,7 +34,8 @@ namespace NetworkProfileTypeMapper
 {
 AWS_DEVICEFARM_API NetworkProfileType GetNetworkProfileTypeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForNetworkProfileType(NetworkProfileType value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForNetworkProfileType(NetworkProfileType value);
 } // namespace NetworkProfileTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -35,7 +35,8 @@ namespace OfferingTransactionTypeMapper
 {
 AWS_DEVICEFARM_API OfferingTransactionType GetOfferingTransactionTypeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForOfferingTransactionType(OfferingTransactionType value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForOfferingTransactionType(OfferingTransactionType value);
 } // namespace OfferingTransactionTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
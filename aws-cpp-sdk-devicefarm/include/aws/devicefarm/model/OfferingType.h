@@ -33,7 +33,8 @@ namespace OfferingTypeMapper
 {
 AWS_DEVICEFARM_API OfferingType GetOfferingTypeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForOfferingType(OfferingType value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForOfferingType(OfferingType value);
 } // namespace OfferingTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -33,7 +33,8 @@ namespace RecurringChargeFrequencyMapper
 {
 AWS_DEVICEFARM_API RecurringChargeFrequency GetRecurringChargeFrequencyForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForRecurringChargeFrequency(RecurringChargeFrequency value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForRecurringChargeFrequency(RecurringChargeFrequency value);
 } // namespace RecurringChargeFrequencyMapper
 } // namespace Model
 } // namespace DeviceFarm
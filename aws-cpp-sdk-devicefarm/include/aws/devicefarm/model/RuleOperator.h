@@ -38,7 +38,8 @@ namespace RuleOperatorMapper
 {
 AWS_DEVICEFARM_API RuleOperator GetRuleOperatorForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForRuleOperator(RuleOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForRuleOperator(RuleOperator value);
 } // namespace RuleOperatorMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -49,7 +49,8 @@ namespace SampleTypeMapper
 {
 AWS_DEVICEFARM_API SampleType GetSampleTypeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForSampleType(SampleType value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForSampleType(SampleType value);
 } // namespace SampleTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
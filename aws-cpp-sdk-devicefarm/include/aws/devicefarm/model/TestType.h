@@ -49,7 +49,8 @@ namespace TestTypeMapper
 {
 AWS_DEVICEFARM_API TestType GetTestTypeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForTestType(TestType value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForTestType(TestType value);
 } // namespace TestTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -36,7 +36,8 @@ namespace UploadStatusMapper
 {
 AWS_DEVICEFARM_API UploadStatus GetUploadStatusForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForUploadStatus(UploadStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForUploadStatus(UploadStatus value);
 } // namespace UploadStatusMapper
 } // namespace Model
 } // namespace DeviceFarm
@@ -48,7 +48,8 @@ namespace UploadTypeMapper
 {
 AWS_DEVICEFARM_API UploadType GetUploadTypeForName(const Aws::String& name);
 
-AWS_DEVICEFARM_API Aws::String GetNameForUploadType(UploadType value);
+// names of values not modeled point into the enum overflow container
+AWS_DEVICEFARM_API const char* GetNameForUploadType(UploadType value);
 } // namespace UploadTypeMapper
 } // namespace Model
 } // namespace DeviceFarm
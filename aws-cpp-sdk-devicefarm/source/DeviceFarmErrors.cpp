@@ -28,13 +28,13 @@ namespace DeviceFarm
 namespace DeviceFarmErrorMapper
 {
 
-static const int SERVICE_ACCOUNT_HASH = HashingUtils::HashString("ServiceAccountException");
-static const int IDEMPOTENCY_HASH = HashingUtils::HashString("IdempotencyException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int ARGUMENT_HASH = HashingUtils::HashString("ArgumentException");
-static const int INVALID_OPERATION_HASH = HashingUtils::HashString("InvalidOperationException");
-static const int NOT_ELIGIBLE_HASH = HashingUtils::HashString("NotEligibleException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
+static constexpr int SERVICE_ACCOUNT_HASH = HashingUtils::CompileTimeHashString("ServiceAccountException");
+static constexpr int IDEMPOTENCY_HASH = HashingUtils::CompileTimeHashString("IdempotencyException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int ARGUMENT_HASH = HashingUtils::CompileTimeHashString("ArgumentException");
+static constexpr int INVALID_OPERATION_HASH = HashingUtils::CompileTimeHashString("InvalidOperationException");
+static constexpr int NOT_ELIGIBLE_HASH = HashingUtils::CompileTimeHashString("NotEligibleException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace ArtifactCategoryMapper
       {
 
-        static const int SCREENSHOT_HASH = HashingUtils::HashString("SCREENSHOT");
-        static const int FILE_HASH = HashingUtils::HashString("FILE");
-        static const int LOG_HASH = HashingUtils::HashString("LOG");
+        static constexpr int SCREENSHOT_HASH = HashingUtils::CompileTimeHashString("SCREENSHOT");
+        static constexpr int FILE_HASH = HashingUtils::CompileTimeHashString("FILE");
+        static constexpr int LOG_HASH = HashingUtils::CompileTimeHashString("LOG");
 
 
         ArtifactCategory GetArtifactCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SCREENSHOT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ArtifactCategory::SCREENSHOT;
-          }
-          else if (hashCode == FILE_HASH)
-          {
-            return ArtifactCategory::FILE;
-          }
-          else if (hashCode == LOG_HASH)
-          {
-            return ArtifactCategory::LOG;
+          case SCREENSHOT_HASH:
+            if (name == "SCREENSHOT")
+            {
+              return ArtifactCategory::SCREENSHOT;
+            }
+            break;
+          case FILE_HASH:
+            if (name == "FILE")
+            {
+              return ArtifactCategory::FILE;
+            }
+            break;
+          case LOG_HASH:
+            if (name == "LOG")
+            {
+              return ArtifactCategory::LOG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ArtifactCategory::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactCategory(ArtifactCategory enumValue)
+        const char* GetNameForArtifactCategory(ArtifactCategory enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
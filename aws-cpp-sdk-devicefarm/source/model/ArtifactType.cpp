@@ -30,145 +30,205 @@ namespace Aws
       namespace ArtifactTypeMapper
       {
 
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int SCREENSHOT_HASH = HashingUtils::HashString("SCREENSHOT");
-        static const int DEVICE_LOG_HASH = HashingUtils::HashString("DEVICE_LOG");
-        static const int MESSAGE_LOG_HASH = HashingUtils::HashString("MESSAGE_LOG");
-        static const int VIDEO_LOG_HASH = HashingUtils::HashString("VIDEO_LOG");
-        static const int RESULT_LOG_HASH = HashingUtils::HashString("RESULT_LOG");
-        static const int SERVICE_LOG_HASH = HashingUtils::HashString("SERVICE_LOG");
-        static const int WEBKIT_LOG_HASH = HashingUtils::HashString("WEBKIT_LOG");
-        static const int INSTRUMENTATION_OUTPUT_HASH = HashingUtils::HashString("INSTRUMENTATION_OUTPUT");
-        static const int EXERCISER_MONKEY_OUTPUT_HASH = HashingUtils::HashString("EXERCISER_MONKEY_OUTPUT");
-        static const int CALABASH_JSON_OUTPUT_HASH = HashingUtils::HashString("CALABASH_JSON_OUTPUT");
-        static const int CALABASH_PRETTY_OUTPUT_HASH = HashingUtils::HashString("CALABASH_PRETTY_OUTPUT");
-        static const int CALABASH_STANDARD_OUTPUT_HASH = HashingUtils::HashString("CALABASH_STANDARD_OUTPUT");
-        static const int CALABASH_JAVA_XML_OUTPUT_HASH = HashingUtils::HashString("CALABASH_JAVA_XML_OUTPUT");
-        static const int AUTOMATION_OUTPUT_HASH = HashingUtils::HashString("AUTOMATION_OUTPUT");
-        static const int APPIUM_SERVER_OUTPUT_HASH = HashingUtils::HashString("APPIUM_SERVER_OUTPUT");
-        static const int APPIUM_JAVA_OUTPUT_HASH = HashingUtils::HashString("APPIUM_JAVA_OUTPUT");
-        static const int APPIUM_JAVA_XML_OUTPUT_HASH = HashingUtils::HashString("APPIUM_JAVA_XML_OUTPUT");
-        static const int APPIUM_PYTHON_OUTPUT_HASH = HashingUtils::HashString("APPIUM_PYTHON_OUTPUT");
-        static const int APPIUM_PYTHON_XML_OUTPUT_HASH = HashingUtils::HashString("APPIUM_PYTHON_XML_OUTPUT");
-        static const int EXPLORER_EVENT_LOG_HASH = HashingUtils::HashString("EXPLORER_EVENT_LOG");
-        static const int EXPLORER_SUMMARY_LOG_HASH = HashingUtils::HashString("EXPLORER_SUMMARY_LOG");
-        static const int APPLICATION_CRASH_REPORT_HASH = HashingUtils::HashString("APPLICATION_CRASH_REPORT");
-        static const int XCTEST_LOG_HASH = HashingUtils::HashString("XCTEST_LOG");
-        static const int VIDEO_HASH = HashingUtils::HashString("VIDEO");
-        static const int CUSTOMER_ARTIFACT_HASH = HashingUtils::HashString("CUSTOMER_ARTIFACT");
-        static const int CUSTOMER_ARTIFACT_LOG_HASH = HashingUtils::HashString("CUSTOMER_ARTIFACT_LOG");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
+        static constexpr int SCREENSHOT_HASH = HashingUtils::CompileTimeHashString("SCREENSHOT");
+        static constexpr int DEVICE_LOG_HASH = HashingUtils::CompileTimeHashString("DEVICE_LOG");
+        static constexpr int MESSAGE_LOG_HASH = HashingUtils::CompileTimeHashString("MESSAGE_LOG");
+        static constexpr int VIDEO_LOG_HASH = HashingUtils::CompileTimeHashString("VIDEO_LOG");
+        static constexpr int RESULT_LOG_HASH = HashingUtils::CompileTimeHashString("RESULT_LOG");
+        static constexpr int SERVICE_LOG_HASH = HashingUtils::CompileTimeHashString("SERVICE_LOG");
+        static constexpr int WEBKIT_LOG_HASH = HashingUtils::CompileTimeHashString("WEBKIT_LOG");
+        static constexpr int INSTRUMENTATION_OUTPUT_HASH = HashingUtils::CompileTimeHashString("INSTRUMENTATION_OUTPUT");
+        static constexpr int EXERCISER_MONKEY_OUTPUT_HASH = HashingUtils::CompileTimeHashString("EXERCISER_MONKEY_OUTPUT");
+        static constexpr int CALABASH_JSON_OUTPUT_HASH = HashingUtils::CompileTimeHashString("CALABASH_JSON_OUTPUT");
+        static constexpr int CALABASH_PRETTY_OUTPUT_HASH = HashingUtils::CompileTimeHashString("CALABASH_PRETTY_OUTPUT");
+        static constexpr int CALABASH_STANDARD_OUTPUT_HASH = HashingUtils::CompileTimeHashString("CALABASH_STANDARD_OUTPUT");
+        static constexpr int CALABASH_JAVA_XML_OUTPUT_HASH = HashingUtils::CompileTimeHashString("CALABASH_JAVA_XML_OUTPUT");
+        static constexpr int AUTOMATION_OUTPUT_HASH = HashingUtils::CompileTimeHashString("AUTOMATION_OUTPUT");
+        static constexpr int APPIUM_SERVER_OUTPUT_HASH = HashingUtils::CompileTimeHashString("APPIUM_SERVER_OUTPUT");
+        static constexpr int APPIUM_JAVA_OUTPUT_HASH = HashingUtils::CompileTimeHashString("APPIUM_JAVA_OUTPUT");
+        static constexpr int APPIUM_JAVA_XML_OUTPUT_HASH = HashingUtils::CompileTimeHashString("APPIUM_JAVA_XML_OUTPUT");
+        static constexpr int APPIUM_PYTHON_OUTPUT_HASH = HashingUtils::CompileTimeHashString("APPIUM_PYTHON_OUTPUT");
+        static constexpr int APPIUM_PYTHON_XML_OUTPUT_HASH = HashingUtils::CompileTimeHashString("APPIUM_PYTHON_XML_OUTPUT");
+        static constexpr int EXPLORER_EVENT_LOG_HASH = HashingUtils::CompileTimeHashString("EXPLORER_EVENT_LOG");
+        static constexpr int EXPLORER_SUMMARY_LOG_HASH = HashingUtils::CompileTimeHashString("EXPLORER_SUMMARY_LOG");
+        static constexpr int APPLICATION_CRASH_REPORT_HASH = HashingUtils::CompileTimeHashString("APPLICATION_CRASH_REPORT");
+        static constexpr int XCTEST_LOG_HASH = HashingUtils::CompileTimeHashString("XCTEST_LOG");
+        static constexpr int VIDEO_HASH = HashingUtils::CompileTimeHashString("VIDEO");
+        static constexpr int CUSTOMER_ARTIFACT_HASH = HashingUtils::CompileTimeHashString("CUSTOMER_ARTIFACT");
+        static constexpr int CUSTOMER_ARTIFACT_LOG_HASH = HashingUtils::CompileTimeHashString("CUSTOMER_ARTIFACT_LOG");
 
 
         ArtifactType GetArtifactTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNKNOWN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ArtifactType::UNKNOWN;
-          }
-          else if (hashCode == SCREENSHOT_HASH)
-          {
-            return ArtifactType::SCREENSHOT;
-          }
-          else if (hashCode == DEVICE_LOG_HASH)
-          {
-            return ArtifactType::DEVICE_LOG;
-          }
-          else if (hashCode == MESSAGE_LOG_HASH)
-          {
-            return ArtifactType::MESSAGE_LOG;
-          }
-          else if (hashCode == VIDEO_LOG_HASH)
-          {
-            return ArtifactType::VIDEO_LOG;
-          }
-          else if (hashCode == RESULT_LOG_HASH)
-          {
-            return ArtifactType::RESULT_LOG;
-          }
-          else if (hashCode == SERVICE_LOG_HASH)
-          {
-            return ArtifactType::SERVICE_LOG;
-          }
-          else if (hashCode == WEBKIT_LOG_HASH)
-          {
-            return ArtifactType::WEBKIT_LOG;
-          }
-          else if (hashCode == INSTRUMENTATION_OUTPUT_HASH)
-          {
-            return ArtifactType::INSTRUMENTATION_OUTPUT;
-          }
-          else if (hashCode == EXERCISER_MONKEY_OUTPUT_HASH)
-          {
-            return ArtifactType::EXERCISER_MONKEY_OUTPUT;
-          }
-          else if (hashCode == CALABASH_JSON_OUTPUT_HASH)
-          {
-            return ArtifactType::CALABASH_JSON_OUTPUT;
-          }
-          else if (hashCode == CALABASH_PRETTY_OUTPUT_HASH)
-          {
-            return ArtifactType::CALABASH_PRETTY_OUTPUT;
-          }
-          else if (hashCode == CALABASH_STANDARD_OUTPUT_HASH)
-          {
-            return ArtifactType::CALABASH_STANDARD_OUTPUT;
-          }
-          else if (hashCode == CALABASH_JAVA_XML_OUTPUT_HASH)
-          {
-            return ArtifactType::CALABASH_JAVA_XML_OUTPUT;
-          }
-          else if (hashCode == AUTOMATION_OUTPUT_HASH)
-          {
-            return ArtifactType::AUTOMATION_OUTPUT;
-          }
-          else if (hashCode == APPIUM_SERVER_OUTPUT_HASH)
-          {
-            return ArtifactType::APPIUM_SERVER_OUTPUT;
-          }
-          else if (hashCode == APPIUM_JAVA_OUTPUT_HASH)
-          {
-            return ArtifactType::APPIUM_JAVA_OUTPUT;
-          }
-          else if (hashCode == APPIUM_JAVA_XML_OUTPUT_HASH)
-          {
-            return ArtifactType::APPIUM_JAVA_XML_OUTPUT;
-          }
-          else if (hashCode == APPIUM_PYTHON_OUTPUT_HASH)
-          {
-            return ArtifactType::APPIUM_PYTHON_OUTPUT;
-          }
-          else if (hashCode == APPIUM_PYTHON_XML_OUTPUT_HASH)
-          {
-            return ArtifactType::APPIUM_PYTHON_XML_OUTPUT;
-          }
-          else if (hashCode == EXPLORER_EVENT_LOG_HASH)
-          {
-            return ArtifactType::EXPLORER_EVENT_LOG;
-          }
-          else if (hashCode == EXPLORER_SUMMARY_LOG_HASH)
-          {
-            return ArtifactType::EXPLORER_SUMMARY_LOG;
-          }
-          else if (hashCode == APPLICATION_CRASH_REPORT_HASH)
-          {
-            return ArtifactType::APPLICATION_CRASH_REPORT;
-          }
-          else if (hashCode == XCTEST_LOG_HASH)
-          {
-            return ArtifactType::XCTEST_LOG;
-          }
-          else if (hashCode == VIDEO_HASH)
-          {
-            return ArtifactType::VIDEO;
-          }
-          else if (hashCode == CUSTOMER_ARTIFACT_HASH)
-          {
-            return ArtifactType::CUSTOMER_ARTIFACT;
-          }
-          else if (hashCode == CUSTOMER_ARTIFACT_LOG_HASH)
-          {
-            return ArtifactType::CUSTOMER_ARTIFACT_LOG;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return ArtifactType::UNKNOWN;
+            }
+            break;
+          case SCREENSHOT_HASH:
+            if (name == "SCREENSHOT")
+            {
+              return ArtifactType::SCREENSHOT;
+            }
+            break;
+          case DEVICE_LOG_HASH:
+            if (name == "DEVICE_LOG")
+            {
+              return ArtifactType::DEVICE_LOG;
+            }
+            break;
+          case MESSAGE_LOG_HASH:
+            if (name == "MESSAGE_LOG")
+            {
+              return ArtifactType::MESSAGE_LOG;
+            }
+            break;
+          case VIDEO_LOG_HASH:
+            if (name == "VIDEO_LOG")
+            {
+              return ArtifactType::VIDEO_LOG;
+            }
+            break;
+          case RESULT_LOG_HASH:
+            if (name == "RESULT_LOG")
+            {
+              return ArtifactType::RESULT_LOG;
+            }
+            break;
+          case SERVICE_LOG_HASH:
+            if (name == "SERVICE_LOG")
+            {
+              return ArtifactType::SERVICE_LOG;
+            }
+            break;
+          case WEBKIT_LOG_HASH:
+            if (name == "WEBKIT_LOG")
+            {
+              return ArtifactType::WEBKIT_LOG;
+            }
+            break;
+          case INSTRUMENTATION_OUTPUT_HASH:
+            if (name == "INSTRUMENTATION_OUTPUT")
+            {
+              return ArtifactType::INSTRUMENTATION_OUTPUT;
+            }
+            break;
+          case EXERCISER_MONKEY_OUTPUT_HASH:
+            if (name == "EXERCISER_MONKEY_OUTPUT")
+            {
+              return ArtifactType::EXERCISER_MONKEY_OUTPUT;
+            }
+            break;
+          case CALABASH_JSON_OUTPUT_HASH:
+            if (name == "CALABASH_JSON_OUTPUT")
+            {
+              return ArtifactType::CALABASH_JSON_OUTPUT;
+            }
+            break;
+          case CALABASH_PRETTY_OUTPUT_HASH:
+            if (name == "CALABASH_PRETTY_OUTPUT")
+            {
+              return ArtifactType::CALABASH_PRETTY_OUTPUT;
+            }
+            break;
+          case CALABASH_STANDARD_OUTPUT_HASH:
+            if (name == "CALABASH_STANDARD_OUTPUT")
+            {
+              return ArtifactType::CALABASH_STANDARD_OUTPUT;
+            }
+            break;
+          case CALABASH_JAVA_XML_OUTPUT_HASH:
+            if (name == "CALABASH_JAVA_XML_OUTPUT")
+            {
+              return ArtifactType::CALABASH_JAVA_XML_OUTPUT;
+            }
+            break;
+          case AUTOMATION_OUTPUT_HASH:
+            if (name == "AUTOMATION_OUTPUT")
+            {
+              return ArtifactType::AUTOMATION_OUTPUT;
+            }
+            break;
+          case APPIUM_SERVER_OUTPUT_HASH:
+            if (name == "APPIUM_SERVER_OUTPUT")
+            {
+              return ArtifactType::APPIUM_SERVER_OUTPUT;
+            }
+            break;
+          case APPIUM_JAVA_OUTPUT_HASH:
+            if (name == "APPIUM_JAVA_OUTPUT")
+            {
+              return ArtifactType::APPIUM_JAVA_OUTPUT;
+            }
+            break;
+          case APPIUM_JAVA_XML_OUTPUT_HASH:
+            if (name == "APPIUM_JAVA_XML_OUTPUT")
+            {
+              return ArtifactType::APPIUM_JAVA_XML_OUTPUT;
+            }
+            break;
+          case APPIUM_PYTHON_OUTPUT_HASH:
+            if (name == "APPIUM_PYTHON_OUTPUT")
+            {
+              return ArtifactType::APPIUM_PYTHON_OUTPUT;
+            }
+            break;
+          case APPIUM_PYTHON_XML_OUTPUT_HASH:
+            if (name == "APPIUM_PYTHON_XML_OUTPUT")
+            {
+              return ArtifactType::APPIUM_PYTHON_XML_OUTPUT;
+            }
+            break;
+          case EXPLORER_EVENT_LOG_HASH:
+            if (name == "EXPLORER_EVENT_LOG")
+            {
+              return ArtifactType::EXPLORER_EVENT_LOG;
+            }
+            break;
+          case EXPLORER_SUMMARY_LOG_HASH:
+            if (name == "EXPLORER_SUMMARY_LOG")
+            {
+              return ArtifactType::EXPLORER_SUMMARY_LOG;
+            }
+            break;
+          case APPLICATION_CRASH_REPORT_HASH:
+            if (name == "APPLICATION_CRASH_REPORT")
+            {
+              return ArtifactType::APPLICATION_CRASH_REPORT;
+            }
+            break;
+          case XCTEST_LOG_HASH:
+            if (name == "XCTEST_LOG")
+            {
+              return ArtifactType::XCTEST_LOG;
+            }
+            break;
+          case VIDEO_HASH:
+            if (name == "VIDEO")
+            {
+              return ArtifactType::VIDEO;
+            }
+            break;
+          case CUSTOMER_ARTIFACT_HASH:
+            if (name == "CUSTOMER_ARTIFACT")
+            {
+              return ArtifactType::CUSTOMER_ARTIFACT;
+            }
+            break;
+          case CUSTOMER_ARTIFACT_LOG_HASH:
+            if (name == "CUSTOMER_ARTIFACT_LOG")
+            {
+              return ArtifactType::CUSTOMER_ARTIFACT_LOG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -180,7 +240,7 @@ namespace Aws
           return ArtifactType::NOT_SET;
         }
 
-        Aws::String GetNameForArtifactType(ArtifactType enumValue)
+        const char* GetNameForArtifactType(ArtifactType enumValue)
         {
           switch(enumValue)
           {
@@ -242,7 +302,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
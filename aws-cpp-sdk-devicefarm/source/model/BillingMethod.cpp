@@ -30,20 +30,30 @@ namespace Aws
       namespace BillingMethodMapper
       {
 
-        static const int METERED_HASH = HashingUtils::HashString("METERED");
-        static const int UNMETERED_HASH = HashingUtils::HashString("UNMETERED");
+        static constexpr int METERED_HASH = HashingUtils::CompileTimeHashString("METERED");
+        static constexpr int UNMETERED_HASH = HashingUtils::CompileTimeHashString("UNMETERED");
 
 
         BillingMethod GetBillingMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == METERED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BillingMethod::METERED;
-          }
-          else if (hashCode == UNMETERED_HASH)
-          {
-            return BillingMethod::UNMETERED;
+          case METERED_HASH:
+            if (name == "METERED")
+            {
+              return BillingMethod::METERED;
+            }
+            break;
+          case UNMETERED_HASH:
+            if (name == "UNMETERED")
+            {
+              return BillingMethod::UNMETERED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BillingMethod::NOT_SET;
         }
 
-        Aws::String GetNameForBillingMethod(BillingMethod enumValue)
+        const char* GetNameForBillingMethod(BillingMethod enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace CurrencyCodeMapper
       {
 
-        static const int USD_HASH = HashingUtils::HashString("USD");
+        static constexpr int USD_HASH = HashingUtils::CompileTimeHashString("USD");
 
 
         CurrencyCode GetCurrencyCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CurrencyCode::USD;
+          case USD_HASH:
+            if (name == "USD")
+            {
+              return CurrencyCode::USD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return CurrencyCode::NOT_SET;
         }
 
-        Aws::String GetNameForCurrencyCode(CurrencyCode enumValue)
+        const char* GetNameForCurrencyCode(CurrencyCode enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
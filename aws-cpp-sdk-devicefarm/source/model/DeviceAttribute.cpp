@@ -30,60 +30,86 @@ namespace Aws
       namespace DeviceAttributeMapper
       {
 
-        static const int ARN_HASH = HashingUtils::HashString("ARN");
-        static const int PLATFORM_HASH = HashingUtils::HashString("PLATFORM");
-        static const int FORM_FACTOR_HASH = HashingUtils::HashString("FORM_FACTOR");
-        static const int MANUFACTURER_HASH = HashingUtils::HashString("MANUFACTURER");
-        static const int REMOTE_ACCESS_ENABLED_HASH = HashingUtils::HashString("REMOTE_ACCESS_ENABLED");
-        static const int REMOTE_DEBUG_ENABLED_HASH = HashingUtils::HashString("REMOTE_DEBUG_ENABLED");
-        static const int APPIUM_VERSION_HASH = HashingUtils::HashString("APPIUM_VERSION");
-        static const int INSTANCE_ARN_HASH = HashingUtils::HashString("INSTANCE_ARN");
-        static const int INSTANCE_LABELS_HASH = HashingUtils::HashString("INSTANCE_LABELS");
-        static const int FLEET_TYPE_HASH = HashingUtils::HashString("FLEET_TYPE");
+        static constexpr int ARN_HASH = HashingUtils::CompileTimeHashString("ARN");
+        static constexpr int PLATFORM_HASH = HashingUtils::CompileTimeHashString("PLATFORM");
+        static constexpr int FORM_FACTOR_HASH = HashingUtils::CompileTimeHashString("FORM_FACTOR");
+        static constexpr int MANUFACTURER_HASH = HashingUtils::CompileTimeHashString("MANUFACTURER");
+        static constexpr int REMOTE_ACCESS_ENABLED_HASH = HashingUtils::CompileTimeHashString("REMOTE_ACCESS_ENABLED");
+        static constexpr int REMOTE_DEBUG_ENABLED_HASH = HashingUtils::CompileTimeHashString("REMOTE_DEBUG_ENABLED");
+        static constexpr int APPIUM_VERSION_HASH = HashingUtils::CompileTimeHashString("APPIUM_VERSION");
+        static constexpr int INSTANCE_ARN_HASH = HashingUtils::CompileTimeHashString("INSTANCE_ARN");
+        static constexpr int INSTANCE_LABELS_HASH = HashingUtils::CompileTimeHashString("INSTANCE_LABELS");
+        static constexpr int FLEET_TYPE_HASH = HashingUtils::CompileTimeHashString("FLEET_TYPE");
 
 
         DeviceAttribute GetDeviceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ARN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeviceAttribute::ARN;
-          }
-          else if (hashCode == PLATFORM_HASH)
-          {
-            return DeviceAttribute::PLATFORM;
-          }
-          else if (hashCode == FORM_FACTOR_HASH)
-          {
-            return DeviceAttribute::FORM_FACTOR;
-          }
-          else if (hashCode == MANUFACTURER_HASH)
-          {
-            return DeviceAttribute::MANUFACTURER;
-          }
-          else if (hashCode == REMOTE_ACCESS_ENABLED_HASH)
-          {
-            return DeviceAttribute::REMOTE_ACCESS_ENABLED;
-          }
-          else if (hashCode == REMOTE_DEBUG_ENABLED_HASH)
-          {
-            return DeviceAttribute::REMOTE_DEBUG_ENABLED;
-          }
-          else if (hashCode == APPIUM_VERSION_HASH)
-          {
-            return DeviceAttribute::APPIUM_VERSION;
-          }
-          else if (hashCode == INSTANCE_ARN_HASH)
-          {
-            return DeviceAttribute::INSTANCE_ARN;
-          }
-          else if (hashCode == INSTANCE_LABELS_HASH)
-          {
-            return DeviceAttribute::INSTANCE_LABELS;
-          }
-          else if (hashCode == FLEET_TYPE_HASH)
-          {
-            return DeviceAttribute::FLEET_TYPE;
+          case ARN_HASH:
+            if (name == "ARN")
+            {
+              return DeviceAttribute::ARN;
+            }
+            break;
+          case PLATFORM_HASH:
+            if (name == "PLATFORM")
+            {
+              return DeviceAttribute::PLATFORM;
+            }
+            break;
+          case FORM_FACTOR_HASH:
+            if (name == "FORM_FACTOR")
+            {
+              return DeviceAttribute::FORM_FACTOR;
+            }
+            break;
+          case MANUFACTURER_HASH:
+            if (name == "MANUFACTURER")
+            {
+              return DeviceAttribute::MANUFACTURER;
+            }
+            break;
+          case REMOTE_ACCESS_ENABLED_HASH:
+            if (name == "REMOTE_ACCESS_ENABLED")
+            {
+              return DeviceAttribute::REMOTE_ACCESS_ENABLED;
+            }
+            break;
+          case REMOTE_DEBUG_ENABLED_HASH:
+            if (name == "REMOTE_DEBUG_ENABLED")
+            {
+              return DeviceAttribute::REMOTE_DEBUG_ENABLED;
+            }
+            break;
+          case APPIUM_VERSION_HASH:
+            if (name == "APPIUM_VERSION")
+            {
+              return DeviceAttribute::APPIUM_VERSION;
+            }
+            break;
+          case INSTANCE_ARN_HASH:
+            if (name == "INSTANCE_ARN")
+            {
+              return DeviceAttribute::INSTANCE_ARN;
+            }
+            break;
+          case INSTANCE_LABELS_HASH:
+            if (name == "INSTANCE_LABELS")
+            {
+              return DeviceAttribute::INSTANCE_LABELS;
+            }
+            break;
+          case FLEET_TYPE_HASH:
+            if (name == "FLEET_TYPE")
+            {
+              return DeviceAttribute::FLEET_TYPE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return DeviceAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceAttribute(DeviceAttribute enumValue)
+        const char* GetNameForDeviceAttribute(DeviceAttribute enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
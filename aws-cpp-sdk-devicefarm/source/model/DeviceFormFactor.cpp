@@ -30,20 +30,30 @@ namespace Aws
       namespace DeviceFormFactorMapper
       {
 
-        static const int PHONE_HASH = HashingUtils::HashString("PHONE");
-        static const int TABLET_HASH = HashingUtils::HashString("TABLET");
+        static constexpr int PHONE_HASH = HashingUtils::CompileTimeHashString("PHONE");
+        static constexpr int TABLET_HASH = HashingUtils::CompileTimeHashString("TABLET");
 
 
         DeviceFormFactor GetDeviceFormFactorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PHONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeviceFormFactor::PHONE;
-          }
-          else if (hashCode == TABLET_HASH)
-          {
-            return DeviceFormFactor::TABLET;
+          case PHONE_HASH:
+            if (name == "PHONE")
+            {
+              return DeviceFormFactor::PHONE;
+            }
+            break;
+          case TABLET_HASH:
+            if (name == "TABLET")
+            {
+              return DeviceFormFactor::TABLET;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeviceFormFactor::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceFormFactor(DeviceFormFactor enumValue)
+        const char* GetNameForDeviceFormFactor(DeviceFormFactor enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
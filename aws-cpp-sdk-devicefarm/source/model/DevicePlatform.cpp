@@ -30,20 +30,30 @@ namespace Aws
       namespace DevicePlatformMapper
       {
 
-        static const int ANDROID__HASH = HashingUtils::HashString("ANDROID");
-        static const int IOS_HASH = HashingUtils::HashString("IOS");
+        static constexpr int ANDROID__HASH = HashingUtils::CompileTimeHashString("ANDROID");
+        static constexpr int IOS_HASH = HashingUtils::CompileTimeHashString("IOS");
 
 
         DevicePlatform GetDevicePlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ANDROID__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DevicePlatform::ANDROID_;
-          }
-          else if (hashCode == IOS_HASH)
-          {
-            return DevicePlatform::IOS;
+          case ANDROID__HASH:
+            if (name == "ANDROID")
+            {
+              return DevicePlatform::ANDROID_;
+            }
+            break;
+          case IOS_HASH:
+            if (name == "IOS")
+            {
+              return DevicePlatform::IOS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DevicePlatform::NOT_SET;
         }
 
-        Aws::String GetNameForDevicePlatform(DevicePlatform enumValue)
+        const char* GetNameForDevicePlatform(DevicePlatform enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
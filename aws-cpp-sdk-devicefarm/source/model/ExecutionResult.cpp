@@ -30,45 +30,65 @@ namespace Aws
       namespace ExecutionResultMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PASSED_HASH = HashingUtils::HashString("PASSED");
-        static const int WARNED_HASH = HashingUtils::HashString("WARNED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SKIPPED_HASH = HashingUtils::HashString("SKIPPED");
-        static const int ERRORED_HASH = HashingUtils::HashString("ERRORED");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int PASSED_HASH = HashingUtils::CompileTimeHashString("PASSED");
+        static constexpr int WARNED_HASH = HashingUtils::CompileTimeHashString("WARNED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int SKIPPED_HASH = HashingUtils::CompileTimeHashString("SKIPPED");
+        static constexpr int ERRORED_HASH = HashingUtils::CompileTimeHashString("ERRORED");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
 
 
         ExecutionResult GetExecutionResultForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExecutionResult::PENDING;
-          }
-          else if (hashCode == PASSED_HASH)
-          {
-            return ExecutionResult::PASSED;
-          }
-          else if (hashCode == WARNED_HASH)
-          {
-            return ExecutionResult::WARNED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ExecutionResult::FAILED;
-          }
-          else if (hashCode == SKIPPED_HASH)
-          {
-            return ExecutionResult::SKIPPED;
-          }
-          else if (hashCode == ERRORED_HASH)
-          {
-            return ExecutionResult::ERRORED;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return ExecutionResult::STOPPED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ExecutionResult::PENDING;
+            }
+            break;
+          case PASSED_HASH:
+            if (name == "PASSED")
+            {
+              return ExecutionResult::PASSED;
+            }
+            break;
+          case WARNED_HASH:
+            if (name == "WARNED")
+            {
+              return ExecutionResult::WARNED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ExecutionResult::FAILED;
+            }
+            break;
+          case SKIPPED_HASH:
+            if (name == "SKIPPED")
+            {
+              return ExecutionResult::SKIPPED;
+            }
+            break;
+          case ERRORED_HASH:
+            if (name == "ERRORED")
+            {
+              return ExecutionResult::ERRORED;
+            }
+            break;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return ExecutionResult::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return ExecutionResult::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionResult(ExecutionResult enumValue)
+        const char* GetNameForExecutionResult(ExecutionResult enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
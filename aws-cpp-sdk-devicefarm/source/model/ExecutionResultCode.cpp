@@ -30,20 +30,30 @@ namespace Aws
       namespace ExecutionResultCodeMapper
       {
 
-        static const int PARSING_FAILED_HASH = HashingUtils::HashString("PARSING_FAILED");
-        static const int VPC_ENDPOINT_SETUP_FAILED_HASH = HashingUtils::HashString("VPC_ENDPOINT_SETUP_FAILED");
+        static constexpr int PARSING_FAILED_HASH = HashingUtils::CompileTimeHashString("PARSING_FAILED");
+        static constexpr int VPC_ENDPOINT_SETUP_FAILED_HASH = HashingUtils::CompileTimeHashString("VPC_ENDPOINT_SETUP_FAILED");
 
 
         ExecutionResultCode GetExecutionResultCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PARSING_FAILED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExecutionResultCode::PARSING_FAILED;
-          }
-          else if (hashCode == VPC_ENDPOINT_SETUP_FAILED_HASH)
-          {
-            return ExecutionResultCode::VPC_ENDPOINT_SETUP_FAILED;
+          case PARSING_FAILED_HASH:
+            if (name == "PARSING_FAILED")
+            {
+              return ExecutionResultCode::PARSING_FAILED;
+            }
+            break;
+          case VPC_ENDPOINT_SETUP_FAILED_HASH:
+            if (name == "VPC_ENDPOINT_SETUP_FAILED")
+            {
+              return ExecutionResultCode::VPC_ENDPOINT_SETUP_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ExecutionResultCode::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionResultCode(ExecutionResultCode enumValue)
+        const char* GetNameForExecutionResultCode(ExecutionResultCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
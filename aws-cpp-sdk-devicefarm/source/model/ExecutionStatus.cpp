@@ -30,55 +30,79 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PENDING_CONCURRENCY_HASH = HashingUtils::HashString("PENDING_CONCURRENCY");
-        static const int PENDING_DEVICE_HASH = HashingUtils::HashString("PENDING_DEVICE");
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int SCHEDULING_HASH = HashingUtils::HashString("SCHEDULING");
-        static const int PREPARING_HASH = HashingUtils::HashString("PREPARING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int PENDING_CONCURRENCY_HASH = HashingUtils::CompileTimeHashString("PENDING_CONCURRENCY");
+        static constexpr int PENDING_DEVICE_HASH = HashingUtils::CompileTimeHashString("PENDING_DEVICE");
+        static constexpr int PROCESSING_HASH = HashingUtils::CompileTimeHashString("PROCESSING");
+        static constexpr int SCHEDULING_HASH = HashingUtils::CompileTimeHashString("SCHEDULING");
+        static constexpr int PREPARING_HASH = HashingUtils::CompileTimeHashString("PREPARING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
 
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExecutionStatus::PENDING;
-          }
-          else if (hashCode == PENDING_CONCURRENCY_HASH)
-          {
-            return ExecutionStatus::PENDING_CONCURRENCY;
-          }
-          else if (hashCode == PENDING_DEVICE_HASH)
-          {
-            return ExecutionStatus::PENDING_DEVICE;
-          }
-          else if (hashCode == PROCESSING_HASH)
-          {
-            return ExecutionStatus::PROCESSING;
-          }
-          else if (hashCode == SCHEDULING_HASH)
-          {
-            return ExecutionStatus::SCHEDULING;
-          }
-          else if (hashCode == PREPARING_HASH)
-          {
-            return ExecutionStatus::PREPARING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ExecutionStatus::RUNNING;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ExecutionStatus::COMPLETED;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return ExecutionStatus::STOPPING;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ExecutionStatus::PENDING;
+            }
+            break;
+          case PENDING_CONCURRENCY_HASH:
+            if (name == "PENDING_CONCURRENCY")
+            {
+              return ExecutionStatus::PENDING_CONCURRENCY;
+            }
+            break;
+          case PENDING_DEVICE_HASH:
+            if (name == "PENDING_DEVICE")
+            {
+              return ExecutionStatus::PENDING_DEVICE;
+            }
+            break;
+          case PROCESSING_HASH:
+            if (name == "PROCESSING")
+            {
+              return ExecutionStatus::PROCESSING;
+            }
+            break;
+          case SCHEDULING_HASH:
+            if (name == "SCHEDULING")
+            {
+              return ExecutionStatus::SCHEDULING;
+            }
+            break;
+          case PREPARING_HASH:
+            if (name == "PREPARING")
+            {
+              return ExecutionStatus::PREPARING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return ExecutionStatus::RUNNING;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return ExecutionStatus::COMPLETED;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return ExecutionStatus::STOPPING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return ExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        const char* GetNameForExecutionStatus(ExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
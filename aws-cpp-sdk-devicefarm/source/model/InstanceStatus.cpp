@@ -30,30 +30,44 @@ namespace Aws
       namespace InstanceStatusMapper
       {
 
-        static const int IN_USE_HASH = HashingUtils::HashString("IN_USE");
-        static const int PREPARING_HASH = HashingUtils::HashString("PREPARING");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int NOT_AVAILABLE_HASH = HashingUtils::HashString("NOT_AVAILABLE");
+        static constexpr int IN_USE_HASH = HashingUtils::CompileTimeHashString("IN_USE");
+        static constexpr int PREPARING_HASH = HashingUtils::CompileTimeHashString("PREPARING");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int NOT_AVAILABLE_HASH = HashingUtils::CompileTimeHashString("NOT_AVAILABLE");
 
 
         InstanceStatus GetInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_USE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceStatus::IN_USE;
-          }
-          else if (hashCode == PREPARING_HASH)
-          {
-            return InstanceStatus::PREPARING;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return InstanceStatus::AVAILABLE;
-          }
-          else if (hashCode == NOT_AVAILABLE_HASH)
-          {
-            return InstanceStatus::NOT_AVAILABLE;
+          case IN_USE_HASH:
+            if (name == "IN_USE")
+            {
+              return InstanceStatus::IN_USE;
+            }
+            break;
+          case PREPARING_HASH:
+            if (name == "PREPARING")
+            {
+              return InstanceStatus::PREPARING;
+            }
+            break;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return InstanceStatus::AVAILABLE;
+            }
+            break;
+          case NOT_AVAILABLE_HASH:
+            if (name == "NOT_AVAILABLE")
+            {
+              return InstanceStatus::NOT_AVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return InstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceStatus(InstanceStatus enumValue)
+        const char* GetNameForInstanceStatus(InstanceStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace InteractionModeMapper
       {
 
-        static const int INTERACTIVE_HASH = HashingUtils::HashString("INTERACTIVE");
-        static const int NO_VIDEO_HASH = HashingUtils::HashString("NO_VIDEO");
-        static const int VIDEO_ONLY_HASH = HashingUtils::HashString("VIDEO_ONLY");
+        static constexpr int INTERACTIVE_HASH = HashingUtils::CompileTimeHashString("INTERACTIVE");
+        static constexpr int NO_VIDEO_HASH = HashingUtils::CompileTimeHashString("NO_VIDEO");
+        static constexpr int VIDEO_ONLY_HASH = HashingUtils::CompileTimeHashString("VIDEO_ONLY");
 
 
         InteractionMode GetInteractionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InteractionMode::INTERACTIVE;
-          }
-          else if (hashCode == NO_VIDEO_HASH)
-          {
-            return InteractionMode::NO_VIDEO;
-          }
-          else if (hashCode == VIDEO_ONLY_HASH)
-          {
-            return InteractionMode::VIDEO_ONLY;
+          case INTERACTIVE_HASH:
+            if (name == "INTERACTIVE")
+            {
+              return InteractionMode::INTERACTIVE;
+            }
+            break;
+          case NO_VIDEO_HASH:
+            if (name == "NO_VIDEO")
+            {
+              return InteractionMode::NO_VIDEO;
+            }
+            break;
+          case VIDEO_ONLY_HASH:
+            if (name == "VIDEO_ONLY")
+            {
+              return InteractionMode::VIDEO_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InteractionMode::NOT_SET;
         }
 
-        Aws::String GetNameForInteractionMode(InteractionMode enumValue)
+        const char* GetNameForInteractionMode(InteractionMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
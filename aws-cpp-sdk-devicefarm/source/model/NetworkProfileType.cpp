@@ -30,20 +30,30 @@ namespace Aws
       namespace NetworkProfileTypeMapper
       {
 
-        static const int CURATED_HASH = HashingUtils::HashString("CURATED");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
+        static constexpr int CURATED_HASH = HashingUtils::CompileTimeHashString("CURATED");
+        static constexpr int PRIVATE__HASH = HashingUtils::CompileTimeHashString("PRIVATE");
 
 
         NetworkProfileType GetNetworkProfileTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CURATED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NetworkProfileType::CURATED;
-          }
-          else if (hashCode == PRIVATE__HASH)
-          {
-            return NetworkProfileType::PRIVATE_;
+          case CURATED_HASH:
+            if (name == "CURATED")
+            {
+              return NetworkProfileType::CURATED;
+            }
+            break;
+          case PRIVATE__HASH:
+            if (name == "PRIVATE")
+            {
+              return NetworkProfileType::PRIVATE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return NetworkProfileType::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkProfileType(NetworkProfileType enumValue)
+        const char* GetNameForNetworkProfileType(NetworkProfileType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
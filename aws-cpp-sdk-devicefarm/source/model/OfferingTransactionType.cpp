@@ -30,25 +30,37 @@ namespace Aws
       namespace OfferingTransactionTypeMapper
       {
 
-        static const int PURCHASE_HASH = HashingUtils::HashString("PURCHASE");
-        static const int RENEW_HASH = HashingUtils::HashString("RENEW");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
+        static constexpr int PURCHASE_HASH = HashingUtils::CompileTimeHashString("PURCHASE");
+        static constexpr int RENEW_HASH = HashingUtils::CompileTimeHashString("RENEW");
+        static constexpr int SYSTEM_HASH = HashingUtils::CompileTimeHashString("SYSTEM");
 
 
         OfferingTransactionType GetOfferingTransactionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PURCHASE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OfferingTransactionType::PURCHASE;
-          }
-          else if (hashCode == RENEW_HASH)
-          {
-            return OfferingTransactionType::RENEW;
-          }
-          else if (hashCode == SYSTEM_HASH)
-          {
-            return OfferingTransactionType::SYSTEM;
+          case PURCHASE_HASH:
+            if (name == "PURCHASE")
+            {
+              return OfferingTransactionType::PURCHASE;
+            }
+            break;
+          case RENEW_HASH:
+            if (name == "RENEW")
+            {
+              return OfferingTransactionType::RENEW;
+            }
+            break;
+          case SYSTEM_HASH:
+            if (name == "SYSTEM")
+            {
+              return OfferingTransactionType::SYSTEM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return OfferingTransactionType::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingTransactionType(OfferingTransactionType enumValue)
+        const char* GetNameForOfferingTransactionType(OfferingTransactionType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
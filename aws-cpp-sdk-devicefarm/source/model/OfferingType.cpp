@@ -30,15 +30,23 @@ namespace Aws
       namespace OfferingTypeMapper
       {
 
-        static const int RECURRING_HASH = HashingUtils::HashString("RECURRING");
+        static constexpr int RECURRING_HASH = HashingUtils::CompileTimeHashString("RECURRING");
 
 
         OfferingType GetOfferingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RECURRING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OfferingType::RECURRING;
+          case RECURRING_HASH:
+            if (name == "RECURRING")
+            {
+              return OfferingType::RECURRING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return OfferingType::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingType(OfferingType enumValue)
+        const char* GetNameForOfferingType(OfferingType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace RecurringChargeFrequencyMapper
       {
 
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
+        static constexpr int MONTHLY_HASH = HashingUtils::CompileTimeHashString("MONTHLY");
 
 
         RecurringChargeFrequency GetRecurringChargeFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MONTHLY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RecurringChargeFrequency::MONTHLY;
+          case MONTHLY_HASH:
+            if (name == "MONTHLY")
+            {
+              return RecurringChargeFrequency::MONTHLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return RecurringChargeFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForRecurringChargeFrequency(RecurringChargeFrequency enumValue)
+        const char* GetNameForRecurringChargeFrequency(RecurringChargeFrequency enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace RuleOperatorMapper
       {
 
-        static const int EQUALS_HASH = HashingUtils::HashString("EQUALS");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int NOT_IN_HASH = HashingUtils::HashString("NOT_IN");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
+        static constexpr int EQUALS_HASH = HashingUtils::CompileTimeHashString("EQUALS");
+        static constexpr int LESS_THAN_HASH = HashingUtils::CompileTimeHashString("LESS_THAN");
+        static constexpr int GREATER_THAN_HASH = HashingUtils::CompileTimeHashString("GREATER_THAN");
+        static constexpr int IN_HASH = HashingUtils::CompileTimeHashString("IN");
+        static constexpr int NOT_IN_HASH = HashingUtils::CompileTimeHashString("NOT_IN");
+        static constexpr int CONTAINS_HASH = HashingUtils::CompileTimeHashString("CONTAINS");
 
 
         RuleOperator GetRuleOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUALS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RuleOperator::EQUALS;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
-            return RuleOperator::LESS_THAN;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
-            return RuleOperator::GREATER_THAN;
-          }
-          else if (hashCode == IN_HASH)
-          {
-            return RuleOperator::IN;
-          }
-          else if (hashCode == NOT_IN_HASH)
-          {
-            return RuleOperator::NOT_IN;
-          }
-          else if (hashCode == CONTAINS_HASH)
-          {
-            return RuleOperator::CONTAINS;
+          case EQUALS_HASH:
+            if (name == "EQUALS")
+            {
+              return RuleOperator::EQUALS;
+            }
+            break;
+          case LESS_THAN_HASH:
+            if (name == "LESS_THAN")
+            {
+              return RuleOperator::LESS_THAN;
+            }
+            break;
+          case GREATER_THAN_HASH:
+            if (name == "GREATER_THAN")
+            {
+              return RuleOperator::GREATER_THAN;
+            }
+            break;
+          case IN_HASH:
+            if (name == "IN")
+            {
+              return RuleOperator::IN;
+            }
+            break;
+          case NOT_IN_HASH:
+            if (name == "NOT_IN")
+            {
+              return RuleOperator::NOT_IN;
+            }
+            break;
+          case CONTAINS_HASH:
+            if (name == "CONTAINS")
+            {
+              return RuleOperator::CONTAINS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return RuleOperator::NOT_SET;
         }
 
-        Aws::String GetNameForRuleOperator(RuleOperator enumValue)
+        const char* GetNameForRuleOperator(RuleOperator enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
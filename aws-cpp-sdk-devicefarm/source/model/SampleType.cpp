@@ -30,95 +30,135 @@ namespace Aws
       namespace SampleTypeMapper
       {
 
-        static const int CPU_HASH = HashingUtils::HashString("CPU");
-        static const int MEMORY_HASH = HashingUtils::HashString("MEMORY");
-        static const int THREADS_HASH = HashingUtils::HashString("THREADS");
-        static const int RX_RATE_HASH = HashingUtils::HashString("RX_RATE");
-        static const int TX_RATE_HASH = HashingUtils::HashString("TX_RATE");
-        static const int RX_HASH = HashingUtils::HashString("RX");
-        static const int TX_HASH = HashingUtils::HashString("TX");
-        static const int NATIVE_FRAMES_HASH = HashingUtils::HashString("NATIVE_FRAMES");
-        static const int NATIVE_FPS_HASH = HashingUtils::HashString("NATIVE_FPS");
-        static const int NATIVE_MIN_DRAWTIME_HASH = HashingUtils::HashString("NATIVE_MIN_DRAWTIME");
-        static const int NATIVE_AVG_DRAWTIME_HASH = HashingUtils::HashString("NATIVE_AVG_DRAWTIME");
-        static const int NATIVE_MAX_DRAWTIME_HASH = HashingUtils::HashString("NATIVE_MAX_DRAWTIME");
-        static const int OPENGL_FRAMES_HASH = HashingUtils::HashString("OPENGL_FRAMES");
-        static const int OPENGL_FPS_HASH = HashingUtils::HashString("OPENGL_FPS");
-        static const int OPENGL_MIN_DRAWTIME_HASH = HashingUtils::HashString("OPENGL_MIN_DRAWTIME");
-        static const int OPENGL_AVG_DRAWTIME_HASH = HashingUtils::HashString("OPENGL_AVG_DRAWTIME");
-        static const int OPENGL_MAX_DRAWTIME_HASH = HashingUtils::HashString("OPENGL_MAX_DRAWTIME");
+        static constexpr int CPU_HASH = HashingUtils::CompileTimeHashString("CPU");
+        static constexpr int MEMORY_HASH = HashingUtils::CompileTimeHashString("MEMORY");
+        static constexpr int THREADS_HASH = HashingUtils::CompileTimeHashString("THREADS");
+        static constexpr int RX_RATE_HASH = HashingUtils::CompileTimeHashString("RX_RATE");
+        static constexpr int TX_RATE_HASH = HashingUtils::CompileTimeHashString("TX_RATE");
+        static constexpr int RX_HASH = HashingUtils::CompileTimeHashString("RX");
+        static constexpr int TX_HASH = HashingUtils::CompileTimeHashString("TX");
+        static constexpr int NATIVE_FRAMES_HASH = HashingUtils::CompileTimeHashString("NATIVE_FRAMES");
+        static constexpr int NATIVE_FPS_HASH = HashingUtils::CompileTimeHashString("NATIVE_FPS");
+        static constexpr int NATIVE_MIN_DRAWTIME_HASH = HashingUtils::CompileTimeHashString("NATIVE_MIN_DRAWTIME");
+        static constexpr int NATIVE_AVG_DRAWTIME_HASH = HashingUtils::CompileTimeHashString("NATIVE_AVG_DRAWTIME");
+        static constexpr int NATIVE_MAX_DRAWTIME_HASH = HashingUtils::CompileTimeHashString("NATIVE_MAX_DRAWTIME");
+        static constexpr int OPENGL_FRAMES_HASH = HashingUtils::CompileTimeHashString("OPENGL_FRAMES");
+        static constexpr int OPENGL_FPS_HASH = HashingUtils::CompileTimeHashString("OPENGL_FPS");
+        static constexpr int OPENGL_MIN_DRAWTIME_HASH = HashingUtils::CompileTimeHashString("OPENGL_MIN_DRAWTIME");
+        static constexpr int OPENGL_AVG_DRAWTIME_HASH = HashingUtils::CompileTimeHashString("OPENGL_AVG_DRAWTIME");
+        static constexpr int OPENGL_MAX_DRAWTIME_HASH = HashingUtils::CompileTimeHashString("OPENGL_MAX_DRAWTIME");
 
 
         SampleType GetSampleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CPU_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SampleType::CPU;
-          }
-          else if (hashCode == MEMORY_HASH)
-          {
-            return SampleType::MEMORY;
-          }
-          else if (hashCode == THREADS_HASH)
-          {
-            return SampleType::THREADS;
-          }
-          else if (hashCode == RX_RATE_HASH)
-          {
-            return SampleType::RX_RATE;
-          }
-          else if (hashCode == TX_RATE_HASH)
-          {
-            return SampleType::TX_RATE;
-          }
-          else if (hashCode == RX_HASH)
-          {
-            return SampleType::RX;
-          }
-          else if (hashCode == TX_HASH)
-          {
-            return SampleType::TX;
-          }
-          else if (hashCode == NATIVE_FRAMES_HASH)
-          {
-            return SampleType::NATIVE_FRAMES;
-          }
-          else if (hashCode == NATIVE_FPS_HASH)
-          {
-            return SampleType::NATIVE_FPS;
-          }
-          else if (hashCode == NATIVE_MIN_DRAWTIME_HASH)
-          {
-            return SampleType::NATIVE_MIN_DRAWTIME;
-          }
-          else if (hashCode == NATIVE_AVG_DRAWTIME_HASH)
-          {
-            return SampleType::NATIVE_AVG_DRAWTIME;
-          }
-          else if (hashCode == NATIVE_MAX_DRAWTIME_HASH)
-          {
-            return SampleType::NATIVE_MAX_DRAWTIME;
-          }
-          else if (hashCode == OPENGL_FRAMES_HASH)
-          {
-            return SampleType::OPENGL_FRAMES;
-          }
-          else if (hashCode == OPENGL_FPS_HASH)
-          {
-            return SampleType::OPENGL_FPS;
-          }
-          else if (hashCode == OPENGL_MIN_DRAWTIME_HASH)
-          {
-            return SampleType::OPENGL_MIN_DRAWTIME;
-          }
-          else if (hashCode == OPENGL_AVG_DRAWTIME_HASH)
-          {
-            return SampleType::OPENGL_AVG_DRAWTIME;
-          }
-          else if (hashCode == OPENGL_MAX_DRAWTIME_HASH)
-          {
-            return SampleType::OPENGL_MAX_DRAWTIME;
+          case CPU_HASH:
+            if (name == "CPU")
+            {
+              return SampleType::CPU;
+            }
+            break;
+          case MEMORY_HASH:
+            if (name == "MEMORY")
+            {
+              return SampleType::MEMORY;
+            }
+            break;
+          case THREADS_HASH:
+            if (name == "THREADS")
+            {
+              return SampleType::THREADS;
+            }
+            break;
+          case RX_RATE_HASH:
+            if (name == "RX_RATE")
+            {
+              return SampleType::RX_RATE;
+            }
+            break;
+          case TX_RATE_HASH:
+            if (name == "TX_RATE")
+            {
+              return SampleType::TX_RATE;
+            }
+            break;
+          case RX_HASH:
+            if (name == "RX")
+            {
+              return SampleType::RX;
+            }
+            break;
+          case TX_HASH:
+            if (name == "TX")
+            {
+              return SampleType::TX;
+            }
+            break;
+          case NATIVE_FRAMES_HASH:
+            if (name == "NATIVE_FRAMES")
+            {
+              return SampleType::NATIVE_FRAMES;
+            }
+            break;
+          case NATIVE_FPS_HASH:
+            if (name == "NATIVE_FPS")
+            {
+              return SampleType::NATIVE_FPS;
+            }
+            break;
+          case NATIVE_MIN_DRAWTIME_HASH:
+            if (name == "NATIVE_MIN_DRAWTIME")
+            {
+              return SampleType::NATIVE_MIN_DRAWTIME;
+            }
+            break;
+          case NATIVE_AVG_DRAWTIME_HASH:
+            if (name == "NATIVE_AVG_DRAWTIME")
+            {
+              return SampleType::NATIVE_AVG_DRAWTIME;
+            }
+            break;
+          case NATIVE_MAX_DRAWTIME_HASH:
+            if (name == "NATIVE_MAX_DRAWTIME")
+            {
+              return SampleType::NATIVE_MAX_DRAWTIME;
+            }
+            break;
+          case OPENGL_FRAMES_HASH:
+            if (name == "OPENGL_FRAMES")
+            {
+              return SampleType::OPENGL_FRAMES;
+            }
+            break;
+          case OPENGL_FPS_HASH:
+            if (name == "OPENGL_FPS")
+            {
+              return SampleType::OPENGL_FPS;
+            }
+            break;
+          case OPENGL_MIN_DRAWTIME_HASH:
+            if (name == "OPENGL_MIN_DRAWTIME")
+            {
+              return SampleType::OPENGL_MIN_DRAWTIME;
+            }
+            break;
+          case OPENGL_AVG_DRAWTIME_HASH:
+            if (name == "OPENGL_AVG_DRAWTIME")
+            {
+              return SampleType::OPENGL_AVG_DRAWTIME;
+            }
+            break;
+          case OPENGL_MAX_DRAWTIME_HASH:
+            if (name == "OPENGL_MAX_DRAWTIME")
+            {
+              return SampleType::OPENGL_MAX_DRAWTIME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,7 +170,7 @@ namespace Aws
           return SampleType::NOT_SET;
         }
 
-        Aws::String GetNameForSampleType(SampleType enumValue)
+        const char* GetNameForSampleType(SampleType enumValue)
         {
           switch(enumValue)
           {
@@ -172,7 +212,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
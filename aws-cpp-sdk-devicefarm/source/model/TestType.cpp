@@ -30,95 +30,135 @@ namespace Aws
       namespace TestTypeMapper
       {
 
-        static const int BUILTIN_FUZZ_HASH = HashingUtils::HashString("BUILTIN_FUZZ");
-        static const int BUILTIN_EXPLORER_HASH = HashingUtils::HashString("BUILTIN_EXPLORER");
-        static const int WEB_PERFORMANCE_PROFILE_HASH = HashingUtils::HashString("WEB_PERFORMANCE_PROFILE");
-        static const int APPIUM_JAVA_JUNIT_HASH = HashingUtils::HashString("APPIUM_JAVA_JUNIT");
-        static const int APPIUM_JAVA_TESTNG_HASH = HashingUtils::HashString("APPIUM_JAVA_TESTNG");
-        static const int APPIUM_PYTHON_HASH = HashingUtils::HashString("APPIUM_PYTHON");
-        static const int APPIUM_WEB_JAVA_JUNIT_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_JUNIT");
-        static const int APPIUM_WEB_JAVA_TESTNG_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_TESTNG");
-        static const int APPIUM_WEB_PYTHON_HASH = HashingUtils::HashString("APPIUM_WEB_PYTHON");
-        static const int CALABASH_HASH = HashingUtils::HashString("CALABASH");
-        static const int INSTRUMENTATION_HASH = HashingUtils::HashString("INSTRUMENTATION");
-        static const int UIAUTOMATION_HASH = HashingUtils::HashString("UIAUTOMATION");
-        static const int UIAUTOMATOR_HASH = HashingUtils::HashString("UIAUTOMATOR");
-        static const int XCTEST_HASH = HashingUtils::HashString("XCTEST");
-        static const int XCTEST_UI_HASH = HashingUtils::HashString("XCTEST_UI");
-        static const int REMOTE_ACCESS_RECORD_HASH = HashingUtils::HashString("REMOTE_ACCESS_RECORD");
-        static const int REMOTE_ACCESS_REPLAY_HASH = HashingUtils::HashString("REMOTE_ACCESS_REPLAY");
+        static constexpr int BUILTIN_FUZZ_HASH = HashingUtils::CompileTimeHashString("BUILTIN_FUZZ");
+        static constexpr int BUILTIN_EXPLORER_HASH = HashingUtils::CompileTimeHashString("BUILTIN_EXPLORER");
+        static constexpr int WEB_PERFORMANCE_PROFILE_HASH = HashingUtils::CompileTimeHashString("WEB_PERFORMANCE_PROFILE");
+        static constexpr int APPIUM_JAVA_JUNIT_HASH = HashingUtils::CompileTimeHashString("APPIUM_JAVA_JUNIT");
+        static constexpr int APPIUM_JAVA_TESTNG_HASH = HashingUtils::CompileTimeHashString("APPIUM_JAVA_TESTNG");
+        static constexpr int APPIUM_PYTHON_HASH = HashingUtils::CompileTimeHashString("APPIUM_PYTHON");
+        static constexpr int APPIUM_WEB_JAVA_JUNIT_HASH = HashingUtils::CompileTimeHashString("APPIUM_WEB_JAVA_JUNIT");
+        static constexpr int APPIUM_WEB_JAVA_TESTNG_HASH = HashingUtils::CompileTimeHashString("APPIUM_WEB_JAVA_TESTNG");
+        static constexpr int APPIUM_WEB_PYTHON_HASH = HashingUtils::CompileTimeHashString("APPIUM_WEB_PYTHON");
+        static constexpr int CALABASH_HASH = HashingUtils::CompileTimeHashString("CALABASH");
+        static constexpr int INSTRUMENTATION_HASH = HashingUtils::CompileTimeHashString("INSTRUMENTATION");
+        static constexpr int UIAUTOMATION_HASH = HashingUtils::CompileTimeHashString("UIAUTOMATION");
+        static constexpr int UIAUTOMATOR_HASH = HashingUtils::CompileTimeHashString("UIAUTOMATOR");
+        static constexpr int XCTEST_HASH = HashingUtils::CompileTimeHashString("XCTEST");
+        static constexpr int XCTEST_UI_HASH = HashingUtils::CompileTimeHashString("XCTEST_UI");
+        static constexpr int REMOTE_ACCESS_RECORD_HASH = HashingUtils::CompileTimeHashString("REMOTE_ACCESS_RECORD");
+        static constexpr int REMOTE_ACCESS_REPLAY_HASH = HashingUtils::CompileTimeHashString("REMOTE_ACCESS_REPLAY");
 
 
         TestType GetTestTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BUILTIN_FUZZ_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TestType::BUILTIN_FUZZ;
-          }
-          else if (hashCode == BUILTIN_EXPLORER_HASH)
-          {
-            return TestType::BUILTIN_EXPLORER;
-          }
-          else if (hashCode == WEB_PERFORMANCE_PROFILE_HASH)
-          {
-            return TestType::WEB_PERFORMANCE_PROFILE;
-          }
-          else if (hashCode == APPIUM_JAVA_JUNIT_HASH)
-          {
-            return TestType::APPIUM_JAVA_JUNIT;
-          }
-          else if (hashCode == APPIUM_JAVA_TESTNG_HASH)
-          {
-            return TestType::APPIUM_JAVA_TESTNG;
-          }
-          else if (hashCode == APPIUM_PYTHON_HASH)
-          {
-            return TestType::APPIUM_PYTHON;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_JUNIT_HASH)
-          {
-            return TestType::APPIUM_WEB_JAVA_JUNIT;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_TESTNG_HASH)
-          {
-            return TestType::APPIUM_WEB_JAVA_TESTNG;
-          }
-          else if (hashCode == APPIUM_WEB_PYTHON_HASH)
-          {
-            return TestType::APPIUM_WEB_PYTHON;
-          }
-          else if (hashCode == CALABASH_HASH)
-          {
-            return TestType::CALABASH;
-          }
-          else if (hashCode == INSTRUMENTATION_HASH)
-          {
-            return TestType::INSTRUMENTATION;
-          }
-          else if (hashCode == UIAUTOMATION_HASH)
-          {
-            return TestType::UIAUTOMATION;
-          }
-          else if (hashCode == UIAUTOMATOR_HASH)
-          {
-            return TestType::UIAUTOMATOR;
-          }
-          else if (hashCode == XCTEST_HASH)
-          {
-            return TestType::XCTEST;
-          }
-          else if (hashCode == XCTEST_UI_HASH)
-          {
-            return TestType::XCTEST_UI;
-          }
-          else if (hashCode == REMOTE_ACCESS_RECORD_HASH)
-          {
-            return TestType::REMOTE_ACCESS_RECORD;
-          }
-          else if (hashCode == REMOTE_ACCESS_REPLAY_HASH)
-          {
-            return TestType::REMOTE_ACCESS_REPLAY;
+          case BUILTIN_FUZZ_HASH:
+            if (name == "BUILTIN_FUZZ")
+            {
+              return TestType::BUILTIN_FUZZ;
+            }
+            break;
+          case BUILTIN_EXPLORER_HASH:
+            if (name == "BUILTIN_EXPLORER")
+            {
+              return TestType::BUILTIN_EXPLORER;
+            }
+            break;
+          case WEB_PERFORMANCE_PROFILE_HASH:
+            if (name == "WEB_PERFORMANCE_PROFILE")
+            {
+              return TestType::WEB_PERFORMANCE_PROFILE;
+            }
+            break;
+          case APPIUM_JAVA_JUNIT_HASH:
+            if (name == "APPIUM_JAVA_JUNIT")
+            {
+              return TestType::APPIUM_JAVA_JUNIT;
+            }
+            break;
+          case APPIUM_JAVA_TESTNG_HASH:
+            if (name == "APPIUM_JAVA_TESTNG")
+            {
+              return TestType::APPIUM_JAVA_TESTNG;
+            }
+            break;
+          case APPIUM_PYTHON_HASH:
+            if (name == "APPIUM_PYTHON")
+            {
+              return TestType::APPIUM_PYTHON;
+            }
+            break;
+          case APPIUM_WEB_JAVA_JUNIT_HASH:
+            if (name == "APPIUM_WEB_JAVA_JUNIT")
+            {
+              return TestType::APPIUM_WEB_JAVA_JUNIT;
+            }
+            break;
+          case APPIUM_WEB_JAVA_TESTNG_HASH:
+            if (name == "APPIUM_WEB_JAVA_TESTNG")
+            {
+              return TestType::APPIUM_WEB_JAVA_TESTNG;
+            }
+            break;
+          case APPIUM_WEB_PYTHON_HASH:
+            if (name == "APPIUM_WEB_PYTHON")
+            {
+              return TestType::APPIUM_WEB_PYTHON;
+            }
+            break;
+          case CALABASH_HASH:
+            if (name == "CALABASH")
+            {
+              return TestType::CALABASH;
+            }
+            break;
+          case INSTRUMENTATION_HASH:
+            if (name == "INSTRUMENTATION")
+            {
+              return TestType::INSTRUMENTATION;
+            }
+            break;
+          case UIAUTOMATION_HASH:
+            if (name == "UIAUTOMATION")
+            {
+              return TestType::UIAUTOMATION;
+            }
+            break;
+          case UIAUTOMATOR_HASH:
+            if (name == "UIAUTOMATOR")
+            {
+              return TestType::UIAUTOMATOR;
+            }
+            break;
+          case XCTEST_HASH:
+            if (name == "XCTEST")
+            {
+              return TestType::XCTEST;
+            }
+            break;
+          case XCTEST_UI_HASH:
+            if (name == "XCTEST_UI")
+            {
+              return TestType::XCTEST_UI;
+            }
+            break;
+          case REMOTE_ACCESS_RECORD_HASH:
+            if (name == "REMOTE_ACCESS_RECORD")
+            {
+              return TestType::REMOTE_ACCESS_RECORD;
+            }
+            break;
+          case REMOTE_ACCESS_REPLAY_HASH:
+            if (name == "REMOTE_ACCESS_REPLAY")
+            {
+              return TestType::REMOTE_ACCESS_REPLAY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,7 +170,7 @@ namespace Aws
           return TestType::NOT_SET;
         }
 
-        Aws::String GetNameForTestType(TestType enumValue)
+        const char* GetNameForTestType(TestType enumValue)
         {
           switch(enumValue)
           {
@@ -172,7 +212,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
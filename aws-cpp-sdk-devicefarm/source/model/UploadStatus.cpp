@@ -30,30 +30,44 @@ namespace Aws
       namespace UploadStatusMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int INITIALIZED_HASH = HashingUtils::CompileTimeHashString("INITIALIZED");
+        static constexpr int PROCESSING_HASH = HashingUtils::CompileTimeHashString("PROCESSING");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         UploadStatus GetUploadStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UploadStatus::INITIALIZED;
-          }
-          else if (hashCode == PROCESSING_HASH)
-          {
-            return UploadStatus::PROCESSING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return UploadStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return UploadStatus::FAILED;
+          case INITIALIZED_HASH:
+            if (name == "INITIALIZED")
+            {
+              return UploadStatus::INITIALIZED;
+            }
+            break;
+          case PROCESSING_HASH:
+            if (name == "PROCESSING")
+            {
+              return UploadStatus::PROCESSING;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return UploadStatus::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return UploadStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return UploadStatus::NOT_SET;
         }
 
-        Aws::String GetNameForUploadStatus(UploadStatus enumValue)
+        const char* GetNameForUploadStatus(UploadStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,90 +30,128 @@ namespace Aws
       namespace UploadTypeMapper
       {
 
-        static const int ANDROID_APP_HASH = HashingUtils::HashString("ANDROID_APP");
-        static const int IOS_APP_HASH = HashingUtils::HashString("IOS_APP");
-        static const int WEB_APP_HASH = HashingUtils::HashString("WEB_APP");
-        static const int EXTERNAL_DATA_HASH = HashingUtils::HashString("EXTERNAL_DATA");
-        static const int APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_JAVA_JUNIT_TEST_PACKAGE");
-        static const int APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_JAVA_TESTNG_TEST_PACKAGE");
-        static const int APPIUM_PYTHON_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_PYTHON_TEST_PACKAGE");
-        static const int APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE");
-        static const int APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE");
-        static const int APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH = HashingUtils::HashString("APPIUM_WEB_PYTHON_TEST_PACKAGE");
-        static const int CALABASH_TEST_PACKAGE_HASH = HashingUtils::HashString("CALABASH_TEST_PACKAGE");
-        static const int INSTRUMENTATION_TEST_PACKAGE_HASH = HashingUtils::HashString("INSTRUMENTATION_TEST_PACKAGE");
-        static const int UIAUTOMATION_TEST_PACKAGE_HASH = HashingUtils::HashString("UIAUTOMATION_TEST_PACKAGE");
-        static const int UIAUTOMATOR_TEST_PACKAGE_HASH = HashingUtils::HashString("UIAUTOMATOR_TEST_PACKAGE");
-        static const int XCTEST_TEST_PACKAGE_HASH = HashingUtils::HashString("XCTEST_TEST_PACKAGE");
-        static const int XCTEST_UI_TEST_PACKAGE_HASH = HashingUtils::HashString("XCTEST_UI_TEST_PACKAGE");
+        static constexpr int ANDROID_APP_HASH = HashingUtils::CompileTimeHashString("ANDROID_APP");
+        static constexpr int IOS_APP_HASH = HashingUtils::CompileTimeHashString("IOS_APP");
+        static constexpr int WEB_APP_HASH = HashingUtils::CompileTimeHashString("WEB_APP");
+        static constexpr int EXTERNAL_DATA_HASH = HashingUtils::CompileTimeHashString("EXTERNAL_DATA");
+        static constexpr int APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("APPIUM_JAVA_JUNIT_TEST_PACKAGE");
+        static constexpr int APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("APPIUM_JAVA_TESTNG_TEST_PACKAGE");
+        static constexpr int APPIUM_PYTHON_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("APPIUM_PYTHON_TEST_PACKAGE");
+        static constexpr int APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE");
+        static constexpr int APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE");
+        static constexpr int APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("APPIUM_WEB_PYTHON_TEST_PACKAGE");
+        static constexpr int CALABASH_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("CALABASH_TEST_PACKAGE");
+        static constexpr int INSTRUMENTATION_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("INSTRUMENTATION_TEST_PACKAGE");
+        static constexpr int UIAUTOMATION_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("UIAUTOMATION_TEST_PACKAGE");
+        static constexpr int UIAUTOMATOR_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("UIAUTOMATOR_TEST_PACKAGE");
+        static constexpr int XCTEST_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("XCTEST_TEST_PACKAGE");
+        static constexpr int XCTEST_UI_TEST_PACKAGE_HASH = HashingUtils::CompileTimeHashString("XCTEST_UI_TEST_PACKAGE");
 
 
         UploadType GetUploadTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ANDROID_APP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UploadType::ANDROID_APP;
-          }
-          else if (hashCode == IOS_APP_HASH)
-          {
-            return UploadType::IOS_APP;
-          }
-          else if (hashCode == WEB_APP_HASH)
-          {
-            return UploadType::WEB_APP;
-          }
-          else if (hashCode == EXTERNAL_DATA_HASH)
-          {
-            return UploadType::EXTERNAL_DATA;
-          }
-          else if (hashCode == APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_JAVA_JUNIT_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_JAVA_TESTNG_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_PYTHON_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_PYTHON_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE;
-          }
-          else if (hashCode == APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH)
-          {
-            return UploadType::APPIUM_WEB_PYTHON_TEST_PACKAGE;
-          }
-          else if (hashCode == CALABASH_TEST_PACKAGE_HASH)
-          {
-            return UploadType::CALABASH_TEST_PACKAGE;
-          }
-          else if (hashCode == INSTRUMENTATION_TEST_PACKAGE_HASH)
-          {
-            return UploadType::INSTRUMENTATION_TEST_PACKAGE;
-          }
-          else if (hashCode == UIAUTOMATION_TEST_PACKAGE_HASH)
-          {
-            return UploadType::UIAUTOMATION_TEST_PACKAGE;
-          }
-          else if (hashCode == UIAUTOMATOR_TEST_PACKAGE_HASH)
-          {
-            return UploadType::UIAUTOMATOR_TEST_PACKAGE;
-          }
-          else if (hashCode == XCTEST_TEST_PACKAGE_HASH)
-          {
-            return UploadType::XCTEST_TEST_PACKAGE;
-          }
-          else if (hashCode == XCTEST_UI_TEST_PACKAGE_HASH)
-          {
-            return UploadType::XCTEST_UI_TEST_PACKAGE;
+          case ANDROID_APP_HASH:
+            if (name == "ANDROID_APP")
+            {
+              return UploadType::ANDROID_APP;
+            }
+            break;
+          case IOS_APP_HASH:
+            if (name == "IOS_APP")
+            {
+              return UploadType::IOS_APP;
+            }
+            break;
+          case WEB_APP_HASH:
+            if (name == "WEB_APP")
+            {
+              return UploadType::WEB_APP;
+            }
+            break;
+          case EXTERNAL_DATA_HASH:
+            if (name == "EXTERNAL_DATA")
+            {
+              return UploadType::EXTERNAL_DATA;
+            }
+            break;
+          case APPIUM_JAVA_JUNIT_TEST_PACKAGE_HASH:
+            if (name == "APPIUM_JAVA_JUNIT_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_JAVA_JUNIT_TEST_PACKAGE;
+            }
+            break;
+          case APPIUM_JAVA_TESTNG_TEST_PACKAGE_HASH:
+            if (name == "APPIUM_JAVA_TESTNG_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_JAVA_TESTNG_TEST_PACKAGE;
+            }
+            break;
+          case APPIUM_PYTHON_TEST_PACKAGE_HASH:
+            if (name == "APPIUM_PYTHON_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_PYTHON_TEST_PACKAGE;
+            }
+            break;
+          case APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE_HASH:
+            if (name == "APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_WEB_JAVA_JUNIT_TEST_PACKAGE;
+            }
+            break;
+          case APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE_HASH:
+            if (name == "APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_WEB_JAVA_TESTNG_TEST_PACKAGE;
+            }
+            break;
+          case APPIUM_WEB_PYTHON_TEST_PACKAGE_HASH:
+            if (name == "APPIUM_WEB_PYTHON_TEST_PACKAGE")
+            {
+              return UploadType::APPIUM_WEB_PYTHON_TEST_PACKAGE;
+            }
+            break;
+          case CALABASH_TEST_PACKAGE_HASH:
+            if (name == "CALABASH_TEST_PACKAGE")
+            {
+              return UploadType::CALABASH_TEST_PACKAGE;
+            }
+            break;
+          case INSTRUMENTATION_TEST_PACKAGE_HASH:
+            if (name == "INSTRUMENTATION_TEST_PACKAGE")
+            {
+              return UploadType::INSTRUMENTATION_TEST_PACKAGE;
+            }
+            break;
+          case UIAUTOMATION_TEST_PACKAGE_HASH:
+            if (name == "UIAUTOMATION_TEST_PACKAGE")
+            {
+              return UploadType::UIAUTOMATION_TEST_PACKAGE;
+            }
+            break;
+          case UIAUTOMATOR_TEST_PACKAGE_HASH:
+            if (name == "UIAUTOMATOR_TEST_PACKAGE")
+            {
+              return UploadType::UIAUTOMATOR_TEST_PACKAGE;
+            }
+            break;
+          case XCTEST_TEST_PACKAGE_HASH:
+            if (name == "XCTEST_TEST_PACKAGE")
+            {
+              return UploadType::XCTEST_TEST_PACKAGE;
+            }
+            break;
+          case XCTEST_UI_TEST_PACKAGE_HASH:
+            if (name == "XCTEST_UI_TEST_PACKAGE")
+            {
+              return UploadType::XCTEST_UI_TEST_PACKAGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -125,7 +163,7 @@ namespace Aws
           return UploadType::NOT_SET;
         }
 
-        Aws::String GetNameForUploadType(UploadType enumValue)
+        const char* GetNameForUploadType(UploadType enumValue)
         {
           switch(enumValue)
           {
@@ -165,7 +203,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
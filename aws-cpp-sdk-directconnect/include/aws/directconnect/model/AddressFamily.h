@@ -34,7 +34,8 @@ namespace AddressFamilyMapper
 {
 AWS_DIRECTCONNECT_API AddressFamily GetAddressFamilyForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForAddressFamily(AddressFamily value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForAddressFamily(AddressFamily value);
 } // namespace AddressFamilyMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -37,7 +37,8 @@ namespace BGPPeerStateMapper
 {
 AWS_DIRECTCONNECT_API BGPPeerState GetBGPPeerStateForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForBGPPeerState(BGPPeerState value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForBGPPeerState(BGPPeerState value);
 } // namespace BGPPeerStateMapper
 } // namespace Model
 } // namespace DirectConnect
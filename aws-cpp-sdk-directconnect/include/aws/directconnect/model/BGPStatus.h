@@ -34,7 +34,8 @@ namespace BGPStatusMapper
 {
 AWS_DIRECTCONNECT_API BGPStatus GetBGPStatusForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForBGPStatus(BGPStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForBGPStatus(BGPStatus value);
 } // namespace BGPStatusMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -40,7 +40,8 @@ namespace ConnectionStateMapper
 {
 AWS_DIRECTCONNECT_API ConnectionState GetConnectionStateForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForConnectionState(ConnectionState value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForConnectionState(ConnectionState value);
 } // namespace ConnectionStateMapper
 } // namespace Model
 } // namespace DirectConnect
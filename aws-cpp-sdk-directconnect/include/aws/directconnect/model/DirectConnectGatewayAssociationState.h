@@ -36,7 +36,8 @@ namespace DirectConnectGatewayAssociationStateMapper
 {
 AWS_DIRECTCONNECT_API DirectConnectGatewayAssociationState GetDirectConnectGatewayAssociationStateForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForDirectConnectGatewayAssociationState(DirectConnectGatewayAssociationState value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForDirectConnectGatewayAssociationState(DirectConnectGatewayAssociationState value);
 } // namespace DirectConnectGatewayAssociationStateMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -36,7 +36,8 @@ namespace DirectConnectGatewayAttachmentStateMapper
 {
 AWS_DIRECTCONNECT_API DirectConnectGatewayAttachmentState GetDirectConnectGatewayAttachmentStateForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForDirectConnectGatewayAttachmentState(DirectConnectGatewayAttachmentState value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForDirectConnectGatewayAttachmentState(DirectConnectGatewayAttachmentState value);
 } // namespace DirectConnectGatewayAttachmentStateMapper
 } // namespace Model
 } // namespace DirectConnect
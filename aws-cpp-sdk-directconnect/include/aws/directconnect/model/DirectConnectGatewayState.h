@@ -36,7 +36,8 @@ namespace DirectConnectGatewayStateMapper
 {
 AWS_DIRECTCONNECT_API DirectConnectGatewayState GetDirectConnectGatewayStateForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForDirectConnectGatewayState(DirectConnectGatewayState value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForDirectConnectGatewayState(DirectConnectGatewayState value);
 } // namespace DirectConnectGatewayStateMapper
 } // namespace Model
 } // namespace DirectConnect
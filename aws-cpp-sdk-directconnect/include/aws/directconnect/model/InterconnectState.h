@@ -38,7 +38,8 @@ namespace InterconnectStateMapper
 {
 AWS_DIRECTCONNECT_API InterconnectState GetInterconnectStateForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForInterconnectState(InterconnectState value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForInterconnectState(InterconnectState value);
 } // namespace InterconnectStateMapper
 } // namespace Model
 } // namespace DirectConnect
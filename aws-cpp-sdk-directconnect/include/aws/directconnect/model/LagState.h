@@ -38,7 +38,8 @@ namespace LagStateMapper
 {
 AWS_DIRECTCONNECT_API LagState GetLagStateForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForLagState(LagState value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForLagState(LagState value);
 } // namespace LagStateMapper
 } // namespace Model
 } // namespace DirectConnect
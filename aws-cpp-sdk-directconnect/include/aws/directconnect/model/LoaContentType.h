@@ -33,7 +33,8 @@ namespace LoaContentTypeMapper
 {
 AWS_DIRECTCONNECT_API LoaContentType GetLoaContentTypeForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForLoaContentType(LoaContentType value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForLoaContentType(LoaContentType value);
 } // namespace LoaContentTypeMapper
 } // namespace Model
 } // namespace DirectConnect
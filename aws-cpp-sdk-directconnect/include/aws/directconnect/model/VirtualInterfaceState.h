@@ -40,7 +40,8 @@ namespace VirtualInterfaceStateMapper
 {
 AWS_DIRECTCONNECT_API VirtualInterfaceState GetVirtualInterfaceStateForName(const Aws::String& name);
 
-AWS_DIRECTCONNECT_API Aws::String GetNameForVirtualInterfaceState(VirtualInterfaceState value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTCONNECT_API const char* GetNameForVirtualInterfaceState(VirtualInterfaceState value);
 } // namespace VirtualInterfaceStateMapper
 } // namespace Model
 } // namespace DirectConnect
@@ -28,10 +28,10 @@ namespace DirectConnect
 namespace DirectConnectErrorMapper
 {
 
-static const int DIRECT_CONNECT_SERVER_HASH = HashingUtils::HashString("DirectConnectServerException");
-static const int TOO_MANY_TAGS_HASH = HashingUtils::HashString("TooManyTagsException");
-static const int DIRECT_CONNECT_CLIENT_HASH = HashingUtils::HashString("DirectConnectClientException");
-static const int DUPLICATE_TAG_KEYS_HASH = HashingUtils::HashString("DuplicateTagKeysException");
+static constexpr int DIRECT_CONNECT_SERVER_HASH = HashingUtils::CompileTimeHashString("DirectConnectServerException");
+static constexpr int TOO_MANY_TAGS_HASH = HashingUtils::CompileTimeHashString("TooManyTagsException");
+static constexpr int DIRECT_CONNECT_CLIENT_HASH = HashingUtils::CompileTimeHashString("DirectConnectClientException");
+static constexpr int DUPLICATE_TAG_KEYS_HASH = HashingUtils::CompileTimeHashString("DuplicateTagKeysException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
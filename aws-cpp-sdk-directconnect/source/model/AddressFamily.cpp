@@ -30,20 +30,30 @@ namespace Aws
       namespace AddressFamilyMapper
       {
 
-        static const int ipv4_HASH = HashingUtils::HashString("ipv4");
-        static const int ipv6_HASH = HashingUtils::HashString("ipv6");
+        static constexpr int ipv4_HASH = HashingUtils::CompileTimeHashString("ipv4");
+        static constexpr int ipv6_HASH = HashingUtils::CompileTimeHashString("ipv6");
 
 
         AddressFamily GetAddressFamilyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ipv4_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AddressFamily::ipv4;
-          }
-          else if (hashCode == ipv6_HASH)
-          {
-            return AddressFamily::ipv6;
+          case ipv4_HASH:
+            if (name == "ipv4")
+            {
+              return AddressFamily::ipv4;
+            }
+            break;
+          case ipv6_HASH:
+            if (name == "ipv6")
+            {
+              return AddressFamily::ipv6;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AddressFamily::NOT_SET;
         }
 
-        Aws::String GetNameForAddressFamily(AddressFamily enumValue)
+        const char* GetNameForAddressFamily(AddressFamily enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
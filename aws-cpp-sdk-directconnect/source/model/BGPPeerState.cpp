@@ -30,35 +30,51 @@ namespace Aws
       namespace BGPPeerStateMapper
       {
 
-        static const int verifying_HASH = HashingUtils::HashString("verifying");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
+        static constexpr int verifying_HASH = HashingUtils::CompileTimeHashString("verifying");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
 
 
         BGPPeerState GetBGPPeerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == verifying_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BGPPeerState::verifying;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return BGPPeerState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return BGPPeerState::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return BGPPeerState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return BGPPeerState::deleted;
+          case verifying_HASH:
+            if (name == "verifying")
+            {
+              return BGPPeerState::verifying;
+            }
+            break;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return BGPPeerState::pending;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return BGPPeerState::available;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return BGPPeerState::deleting;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return BGPPeerState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return BGPPeerState::NOT_SET;
         }
 
-        Aws::String GetNameForBGPPeerState(BGPPeerState enumValue)
+        const char* GetNameForBGPPeerState(BGPPeerState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
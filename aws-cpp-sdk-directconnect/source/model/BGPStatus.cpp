@@ -30,20 +30,30 @@ namespace Aws
       namespace BGPStatusMapper
       {
 
-        static const int up_HASH = HashingUtils::HashString("up");
-        static const int down_HASH = HashingUtils::HashString("down");
+        static constexpr int up_HASH = HashingUtils::CompileTimeHashString("up");
+        static constexpr int down_HASH = HashingUtils::CompileTimeHashString("down");
 
 
         BGPStatus GetBGPStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == up_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BGPStatus::up;
-          }
-          else if (hashCode == down_HASH)
-          {
-            return BGPStatus::down;
+          case up_HASH:
+            if (name == "up")
+            {
+              return BGPStatus::up;
+            }
+            break;
+          case down_HASH:
+            if (name == "down")
+            {
+              return BGPStatus::down;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BGPStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBGPStatus(BGPStatus enumValue)
+        const char* GetNameForBGPStatus(BGPStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace ConnectionStateMapper
       {
 
-        static const int ordering_HASH = HashingUtils::HashString("ordering");
-        static const int requested_HASH = HashingUtils::HashString("requested");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int down_HASH = HashingUtils::HashString("down");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
+        static constexpr int ordering_HASH = HashingUtils::CompileTimeHashString("ordering");
+        static constexpr int requested_HASH = HashingUtils::CompileTimeHashString("requested");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int down_HASH = HashingUtils::CompileTimeHashString("down");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
+        static constexpr int rejected_HASH = HashingUtils::CompileTimeHashString("rejected");
 
 
         ConnectionState GetConnectionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ordering_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConnectionState::ordering;
-          }
-          else if (hashCode == requested_HASH)
-          {
-            return ConnectionState::requested;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return ConnectionState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return ConnectionState::available;
-          }
-          else if (hashCode == down_HASH)
-          {
-            return ConnectionState::down;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return ConnectionState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return ConnectionState::deleted;
-          }
-          else if (hashCode == rejected_HASH)
-          {
-            return ConnectionState::rejected;
+          case ordering_HASH:
+            if (name == "ordering")
+            {
+              return ConnectionState::ordering;
+            }
+            break;
+          case requested_HASH:
+            if (name == "requested")
+            {
+              return ConnectionState::requested;
+            }
+            break;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return ConnectionState::pending;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return ConnectionState::available;
+            }
+            break;
+          case down_HASH:
+            if (name == "down")
+            {
+              return ConnectionState::down;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return ConnectionState::deleting;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return ConnectionState::deleted;
+            }
+            break;
+          case rejected_HASH:
+            if (name == "rejected")
+            {
+              return ConnectionState::rejected;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return ConnectionState::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionState(ConnectionState enumValue)
+        const char* GetNameForConnectionState(ConnectionState enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
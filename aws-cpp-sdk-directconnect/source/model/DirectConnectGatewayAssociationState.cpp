@@ -30,30 +30,44 @@ namespace Aws
       namespace DirectConnectGatewayAssociationStateMapper
       {
 
-        static const int associating_HASH = HashingUtils::HashString("associating");
-        static const int associated_HASH = HashingUtils::HashString("associated");
-        static const int disassociating_HASH = HashingUtils::HashString("disassociating");
-        static const int disassociated_HASH = HashingUtils::HashString("disassociated");
+        static constexpr int associating_HASH = HashingUtils::CompileTimeHashString("associating");
+        static constexpr int associated_HASH = HashingUtils::CompileTimeHashString("associated");
+        static constexpr int disassociating_HASH = HashingUtils::CompileTimeHashString("disassociating");
+        static constexpr int disassociated_HASH = HashingUtils::CompileTimeHashString("disassociated");
 
 
         DirectConnectGatewayAssociationState GetDirectConnectGatewayAssociationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == associating_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DirectConnectGatewayAssociationState::associating;
-          }
-          else if (hashCode == associated_HASH)
-          {
-            return DirectConnectGatewayAssociationState::associated;
-          }
-          else if (hashCode == disassociating_HASH)
-          {
-            return DirectConnectGatewayAssociationState::disassociating;
-          }
-          else if (hashCode == disassociated_HASH)
-          {
-            return DirectConnectGatewayAssociationState::disassociated;
+          case associating_HASH:
+            if (name == "associating")
+            {
+              return DirectConnectGatewayAssociationState::associating;
+            }
+            break;
+          case associated_HASH:
+            if (name == "associated")
+            {
+              return DirectConnectGatewayAssociationState::associated;
+            }
+            break;
+          case disassociating_HASH:
+            if (name == "disassociating")
+            {
+              return DirectConnectGatewayAssociationState::disassociating;
+            }
+            break;
+          case disassociated_HASH:
+            if (name == "disassociated")
+            {
+              return DirectConnectGatewayAssociationState::disassociated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DirectConnectGatewayAssociationState::NOT_SET;
         }
 
-        Aws::String GetNameForDirectConnectGatewayAssociationState(DirectConnectGatewayAssociationState enumValue)
+        const char* GetNameForDirectConnectGatewayAssociationState(DirectConnectGatewayAssociationState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
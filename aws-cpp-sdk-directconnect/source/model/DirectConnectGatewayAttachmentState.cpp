@@ -30,30 +30,44 @@ namespace Aws
       namespace DirectConnectGatewayAttachmentStateMapper
       {
 
-        static const int attaching_HASH = HashingUtils::HashString("attaching");
-        static const int attached_HASH = HashingUtils::HashString("attached");
-        static const int detaching_HASH = HashingUtils::HashString("detaching");
-        static const int detached_HASH = HashingUtils::HashString("detached");
+        static constexpr int attaching_HASH = HashingUtils::CompileTimeHashString("attaching");
+        static constexpr int attached_HASH = HashingUtils::CompileTimeHashString("attached");
+        static constexpr int detaching_HASH = HashingUtils::CompileTimeHashString("detaching");
+        static constexpr int detached_HASH = HashingUtils::CompileTimeHashString("detached");
 
 
         DirectConnectGatewayAttachmentState GetDirectConnectGatewayAttachmentStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == attaching_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DirectConnectGatewayAttachmentState::attaching;
-          }
-          else if (hashCode == attached_HASH)
-          {
-            return DirectConnectGatewayAttachmentState::attached;
-          }
-          else if (hashCode == detaching_HASH)
-          {
-            return DirectConnectGatewayAttachmentState::detaching;
-          }
-          else if (hashCode == detached_HASH)
-          {
-            return DirectConnectGatewayAttachmentState::detached;
+          case attaching_HASH:
+            if (name == "attaching")
+            {
+              return DirectConnectGatewayAttachmentState::attaching;
+            }
+            break;
+          case attached_HASH:
+            if (name == "attached")
+            {
+              return DirectConnectGatewayAttachmentState::attached;
+            }
+            break;
+          case detaching_HASH:
+            if (name == "detaching")
+            {
+              return DirectConnectGatewayAttachmentState::detaching;
+            }
+            break;
+          case detached_HASH:
+            if (name == "detached")
+            {
+              return DirectConnectGatewayAttachmentState::detached;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DirectConnectGatewayAttachmentState::NOT_SET;
         }
 
-        Aws::String GetNameForDirectConnectGatewayAttachmentState(DirectConnectGatewayAttachmentState enumValue)
+        const char* GetNameForDirectConnectGatewayAttachmentState(DirectConnectGatewayAttachmentState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
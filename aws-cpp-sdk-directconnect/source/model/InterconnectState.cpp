@@ -30,40 +30,58 @@ namespace Aws
       namespace InterconnectStateMapper
       {
 
-        static const int requested_HASH = HashingUtils::HashString("requested");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int down_HASH = HashingUtils::HashString("down");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
+        static constexpr int requested_HASH = HashingUtils::CompileTimeHashString("requested");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int down_HASH = HashingUtils::CompileTimeHashString("down");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
 
 
         InterconnectState GetInterconnectStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == requested_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InterconnectState::requested;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return InterconnectState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return InterconnectState::available;
-          }
-          else if (hashCode == down_HASH)
-          {
-            return InterconnectState::down;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return InterconnectState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return InterconnectState::deleted;
+          case requested_HASH:
+            if (name == "requested")
+            {
+              return InterconnectState::requested;
+            }
+            break;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return InterconnectState::pending;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return InterconnectState::available;
+            }
+            break;
+          case down_HASH:
+            if (name == "down")
+            {
+              return InterconnectState::down;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return InterconnectState::deleting;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return InterconnectState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return InterconnectState::NOT_SET;
         }
 
-        Aws::String GetNameForInterconnectState(InterconnectState enumValue)
+        const char* GetNameForInterconnectState(InterconnectState enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
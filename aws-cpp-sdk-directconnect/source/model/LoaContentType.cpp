@@ -30,15 +30,23 @@ namespace Aws
       namespace LoaContentTypeMapper
       {
 
-        static const int application_pdf_HASH = HashingUtils::HashString("application/pdf");
+        static constexpr int application_pdf_HASH = HashingUtils::CompileTimeHashString("application/pdf");
 
 
         LoaContentType GetLoaContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_pdf_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoaContentType::application_pdf;
+          case application_pdf_HASH:
+            if (name == "application/pdf")
+            {
+              return LoaContentType::application_pdf;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return LoaContentType::NOT_SET;
         }
 
-        Aws::String GetNameForLoaContentType(LoaContentType enumValue)
+        const char* GetNameForLoaContentType(LoaContentType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
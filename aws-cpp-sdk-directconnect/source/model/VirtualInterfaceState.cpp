@@ -30,50 +30,72 @@ namespace Aws
       namespace VirtualInterfaceStateMapper
       {
 
-        static const int confirming_HASH = HashingUtils::HashString("confirming");
-        static const int verifying_HASH = HashingUtils::HashString("verifying");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int down_HASH = HashingUtils::HashString("down");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
+        static constexpr int confirming_HASH = HashingUtils::CompileTimeHashString("confirming");
+        static constexpr int verifying_HASH = HashingUtils::CompileTimeHashString("verifying");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int down_HASH = HashingUtils::CompileTimeHashString("down");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
+        static constexpr int rejected_HASH = HashingUtils::CompileTimeHashString("rejected");
 
 
         VirtualInterfaceState GetVirtualInterfaceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == confirming_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VirtualInterfaceState::confirming;
-          }
-          else if (hashCode == verifying_HASH)
-          {
-            return VirtualInterfaceState::verifying;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return VirtualInterfaceState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return VirtualInterfaceState::available;
-          }
-          else if (hashCode == down_HASH)
-          {
-            return VirtualInterfaceState::down;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return VirtualInterfaceState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return VirtualInterfaceState::deleted;
-          }
-          else if (hashCode == rejected_HASH)
-          {
-            return VirtualInterfaceState::rejected;
+          case confirming_HASH:
+            if (name == "confirming")
+            {
+              return VirtualInterfaceState::confirming;
+            }
+            break;
+          case verifying_HASH:
+            if (name == "verifying")
+            {
+              return VirtualInterfaceState::verifying;
+            }
+            break;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return VirtualInterfaceState::pending;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return VirtualInterfaceState::available;
+            }
+            break;
+          case down_HASH:
+            if (name == "down")
+            {
+              return VirtualInterfaceState::down;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return VirtualInterfaceState::deleting;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return VirtualInterfaceState::deleted;
+            }
+            break;
+          case rejected_HASH:
+            if (name == "rejected")
+            {
+              return VirtualInterfaceState::rejected;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return VirtualInterfaceState::NOT_SET;
         }
 
-        Aws::String GetNameForVirtualInterfaceState(VirtualInterfaceState enumValue)
+        const char* GetNameForVirtualInterfaceState(VirtualInterfaceState enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
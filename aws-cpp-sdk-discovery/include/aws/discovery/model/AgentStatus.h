@@ -38,7 +38,8 @@ namespace AgentStatusMapper
 {
 AWS_APPLICATIONDISCOVERYSERVICE_API AgentStatus GetAgentStatusForName(const Aws::String& name);
 
-AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForAgentStatus(AgentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForAgentStatus(AgentStatus value);
 } // namespace AgentStatusMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
@@ -36,7 +36,8 @@ namespace ConfigurationItemTypeMapper
 {
 AWS_APPLICATIONDISCOVERYSERVICE_API ConfigurationItemType GetConfigurationItemTypeForName(const Aws::String& name);
 
-AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForConfigurationItemType(ConfigurationItemType value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForConfigurationItemType(ConfigurationItemType value);
 } // namespace ConfigurationItemTypeMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
@@ -34,7 +34,8 @@ namespace ExportDataFormatMapper
 {
 AWS_APPLICATIONDISCOVERYSERVICE_API ExportDataFormat GetExportDataFormatForName(const Aws::String& name);
 
-AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForExportDataFormat(ExportDataFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForExportDataFormat(ExportDataFormat value);
 } // namespace ExportDataFormatMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
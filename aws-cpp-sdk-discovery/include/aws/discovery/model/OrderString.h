@@ -34,7 +34,8 @@ namespace OrderStringMapper
 {
 AWS_APPLICATIONDISCOVERYSERVICE_API OrderString GetOrderStringForName(const Aws::String& name);
 
-AWS_APPLICATIONDISCOVERYSERVICE_API Aws::String GetNameForOrderString(OrderString value);
+// names of values not modeled point into the enum overflow container
+AWS_APPLICATIONDISCOVERYSERVICE_API const char* GetNameForOrderString(OrderString value);
 } // namespace OrderStringMapper
 } // namespace Model
 } // namespace ApplicationDiscoveryService
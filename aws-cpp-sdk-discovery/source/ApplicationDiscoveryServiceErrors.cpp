@@ -28,10 +28,10 @@ namespace ApplicationDiscoveryService
 namespace ApplicationDiscoveryServiceErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int SERVER_INTERNAL_ERROR_HASH = HashingUtils::HashString("ServerInternalErrorException");
-static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OperationNotPermittedException");
-static const int AUTHORIZATION_ERROR_HASH = HashingUtils::HashString("AuthorizationErrorException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int SERVER_INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("ServerInternalErrorException");
+static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OperationNotPermittedException");
+static constexpr int AUTHORIZATION_ERROR_HASH = HashingUtils::CompileTimeHashString("AuthorizationErrorException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,40 +30,58 @@ namespace Aws
       namespace AgentStatusMapper
       {
 
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
-        static const int BLACKLISTED_HASH = HashingUtils::HashString("BLACKLISTED");
-        static const int SHUTDOWN_HASH = HashingUtils::HashString("SHUTDOWN");
+        static constexpr int HEALTHY_HASH = HashingUtils::CompileTimeHashString("HEALTHY");
+        static constexpr int UNHEALTHY_HASH = HashingUtils::CompileTimeHashString("UNHEALTHY");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
+        static constexpr int BLACKLISTED_HASH = HashingUtils::CompileTimeHashString("BLACKLISTED");
+        static constexpr int SHUTDOWN_HASH = HashingUtils::CompileTimeHashString("SHUTDOWN");
 
 
         AgentStatus GetAgentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEALTHY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AgentStatus::HEALTHY;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return AgentStatus::UNHEALTHY;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return AgentStatus::RUNNING;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return AgentStatus::UNKNOWN;
-          }
-          else if (hashCode == BLACKLISTED_HASH)
-          {
-            return AgentStatus::BLACKLISTED;
-          }
-          else if (hashCode == SHUTDOWN_HASH)
-          {
-            return AgentStatus::SHUTDOWN;
+          case HEALTHY_HASH:
+            if (name == "HEALTHY")
+            {
+              return AgentStatus::HEALTHY;
+            }
+            break;
+          case UNHEALTHY_HASH:
+            if (name == "UNHEALTHY")
+            {
+              return AgentStatus::UNHEALTHY;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return AgentStatus::RUNNING;
+            }
+            break;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return AgentStatus::UNKNOWN;
+            }
+            break;
+          case BLACKLISTED_HASH:
+            if (name == "BLACKLISTED")
+            {
+              return AgentStatus::BLACKLISTED;
+            }
+            break;
+          case SHUTDOWN_HASH:
+            if (name == "SHUTDOWN")
+            {
+              return AgentStatus::SHUTDOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return AgentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAgentStatus(AgentStatus enumValue)
+        const char* GetNameForAgentStatus(AgentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ConfigurationItemTypeMapper
       {
 
-        static const int SERVER_HASH = HashingUtils::HashString("SERVER");
-        static const int PROCESS_HASH = HashingUtils::HashString("PROCESS");
-        static const int CONNECTION_HASH = HashingUtils::HashString("CONNECTION");
-        static const int APPLICATION_HASH = HashingUtils::HashString("APPLICATION");
+        static constexpr int SERVER_HASH = HashingUtils::CompileTimeHashString("SERVER");
+        static constexpr int PROCESS_HASH = HashingUtils::CompileTimeHashString("PROCESS");
+        static constexpr int CONNECTION_HASH = HashingUtils::CompileTimeHashString("CONNECTION");
+        static constexpr int APPLICATION_HASH = HashingUtils::CompileTimeHashString("APPLICATION");
 
 
         ConfigurationItemType GetConfigurationItemTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SERVER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConfigurationItemType::SERVER;
-          }
-          else if (hashCode == PROCESS_HASH)
-          {
-            return ConfigurationItemType::PROCESS;
-          }
-          else if (hashCode == CONNECTION_HASH)
-          {
-            return ConfigurationItemType::CONNECTION;
-          }
-          else if (hashCode == APPLICATION_HASH)
-          {
-            return ConfigurationItemType::APPLICATION;
+          case SERVER_HASH:
+            if (name == "SERVER")
+            {
+              return ConfigurationItemType::SERVER;
+            }
+            break;
+          case PROCESS_HASH:
+            if (name == "PROCESS")
+            {
+              return ConfigurationItemType::PROCESS;
+            }
+            break;
+          case CONNECTION_HASH:
+            if (name == "CONNECTION")
+            {
+              return ConfigurationItemType::CONNECTION;
+            }
+            break;
+          case APPLICATION_HASH:
+            if (name == "APPLICATION")
+            {
+              return ConfigurationItemType::APPLICATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ConfigurationItemType::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationItemType(ConfigurationItemType enumValue)
+        const char* GetNameForConfigurationItemType(ConfigurationItemType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ExportDataFormatMapper
       {
 
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-        static const int GRAPHML_HASH = HashingUtils::HashString("GRAPHML");
+        static constexpr int CSV_HASH = HashingUtils::CompileTimeHashString("CSV");
+        static constexpr int GRAPHML_HASH = HashingUtils::CompileTimeHashString("GRAPHML");
 
 
         ExportDataFormat GetExportDataFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CSV_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExportDataFormat::CSV;
-          }
-          else if (hashCode == GRAPHML_HASH)
-          {
-            return ExportDataFormat::GRAPHML;
+          case CSV_HASH:
+            if (name == "CSV")
+            {
+              return ExportDataFormat::CSV;
+            }
+            break;
+          case GRAPHML_HASH:
+            if (name == "GRAPHML")
+            {
+              return ExportDataFormat::GRAPHML;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ExportDataFormat::NOT_SET;
         }
 
-        Aws::String GetNameForExportDataFormat(ExportDataFormat enumValue)
+        const char* GetNameForExportDataFormat(ExportDataFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
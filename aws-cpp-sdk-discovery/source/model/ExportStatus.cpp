@@ -30,25 +30,37 @@ namespace Aws
       namespace ExportStatusMapper
       {
 
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
 
 
         ExportStatus GetExportStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FAILED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExportStatus::FAILED;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return ExportStatus::SUCCEEDED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return ExportStatus::IN_PROGRESS;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ExportStatus::FAILED;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return ExportStatus::SUCCEEDED;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return ExportStatus::IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ExportStatus::NOT_SET;
         }
 
-        Aws::String GetNameForExportStatus(ExportStatus enumValue)
+        const char* GetNameForExportStatus(ExportStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
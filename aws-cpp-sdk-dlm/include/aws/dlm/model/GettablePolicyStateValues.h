@@ -35,7 +35,8 @@ namespace GettablePolicyStateValuesMapper
 {
 AWS_DLM_API GettablePolicyStateValues GetGettablePolicyStateValuesForName(const Aws::String& name);
 
-AWS_DLM_API Aws::String GetNameForGettablePolicyStateValues(GettablePolicyStateValues value);
+// names of values not modeled point into the enum overflow container
+AWS_DLM_API const char* GetNameForGettablePolicyStateValues(GettablePolicyStateValues value);
 } // namespace GettablePolicyStateValuesMapper
 } // namespace Model
 } // namespace DLM
@@ -33,7 +33,8 @@ namespace IntervalUnitValuesMapper
 {
 AWS_DLM_API IntervalUnitValues GetIntervalUnitValuesForName(const Aws::String& name);
 
-AWS_DLM_API Aws::String GetNameForIntervalUnitValues(IntervalUnitValues value);
+// names of values not modeled point into the enum overflow container
+AWS_DLM_API const char* GetNameForIntervalUnitValues(IntervalUnitValues value);
 } // namespace IntervalUnitValuesMapper
 } // namespace Model
 } // namespace DLM
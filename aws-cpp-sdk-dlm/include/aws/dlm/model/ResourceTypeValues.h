@@ -33,7 +33,8 @@ namespace ResourceTypeValuesMapper
 {
 AWS_DLM_API ResourceTypeValues GetResourceTypeValuesForName(const Aws::String& name);
 
-AWS_DLM_API Aws::String GetNameForResourceTypeValues(ResourceTypeValues value);
+// names of values not modeled point into the enum overflow container
+AWS_DLM_API const char* GetNameForResourceTypeValues(ResourceTypeValues value);
 } // namespace ResourceTypeValuesMapper
 } // namespace Model
 } // namespace DLM
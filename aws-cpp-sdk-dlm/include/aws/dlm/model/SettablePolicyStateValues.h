@@ -34,7 +34,8 @@ namespace SettablePolicyStateValuesMapper
 {
 AWS_DLM_API SettablePolicyStateValues GetSettablePolicyStateValuesForName(const Aws::String& name);
 
-AWS_DLM_API Aws::String GetNameForSettablePolicyStateValues(SettablePolicyStateValues value);
+// names of values not modeled point into the enum overflow container
+AWS_DLM_API const char* GetNameForSettablePolicyStateValues(SettablePolicyStateValues value);
 } // namespace SettablePolicyStateValuesMapper
 } // namespace Model
 } // namespace DLM
@@ -30,25 +30,37 @@ namespace Aws
       namespace GettablePolicyStateValuesMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
 
 
         GettablePolicyStateValues GetGettablePolicyStateValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GettablePolicyStateValues::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return GettablePolicyStateValues::DISABLED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return GettablePolicyStateValues::ERROR_;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return GettablePolicyStateValues::ENABLED;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return GettablePolicyStateValues::DISABLED;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return GettablePolicyStateValues::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return GettablePolicyStateValues::NOT_SET;
         }
 
-        Aws::String GetNameForGettablePolicyStateValues(GettablePolicyStateValues enumValue)
+        const char* GetNameForGettablePolicyStateValues(GettablePolicyStateValues enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
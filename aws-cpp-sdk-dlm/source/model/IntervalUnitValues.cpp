@@ -30,15 +30,23 @@ namespace Aws
       namespace IntervalUnitValuesMapper
       {
 
-        static const int HOURS_HASH = HashingUtils::HashString("HOURS");
+        static constexpr int HOURS_HASH = HashingUtils::CompileTimeHashString("HOURS");
 
 
         IntervalUnitValues GetIntervalUnitValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOURS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IntervalUnitValues::HOURS;
+          case HOURS_HASH:
+            if (name == "HOURS")
+            {
+              return IntervalUnitValues::HOURS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return IntervalUnitValues::NOT_SET;
         }
 
-        Aws::String GetNameForIntervalUnitValues(IntervalUnitValues enumValue)
+        const char* GetNameForIntervalUnitValues(IntervalUnitValues enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ResourceTypeValuesMapper
       {
 
-        static const int VOLUME_HASH = HashingUtils::HashString("VOLUME");
+        static constexpr int VOLUME_HASH = HashingUtils::CompileTimeHashString("VOLUME");
 
 
         ResourceTypeValues GetResourceTypeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VOLUME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceTypeValues::VOLUME;
+          case VOLUME_HASH:
+            if (name == "VOLUME")
+            {
+              return ResourceTypeValues::VOLUME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ResourceTypeValues::NOT_SET;
         }
 
-        Aws::String GetNameForResourceTypeValues(ResourceTypeValues enumValue)
+        const char* GetNameForResourceTypeValues(ResourceTypeValues enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
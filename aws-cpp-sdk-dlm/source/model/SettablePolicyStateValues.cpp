@@ -30,20 +30,30 @@ namespace Aws
       namespace SettablePolicyStateValuesMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
 
 
         SettablePolicyStateValues GetSettablePolicyStateValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SettablePolicyStateValues::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return SettablePolicyStateValues::DISABLED;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return SettablePolicyStateValues::ENABLED;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return SettablePolicyStateValues::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SettablePolicyStateValues::NOT_SET;
         }
 
-        Aws::String GetNameForSettablePolicyStateValues(SettablePolicyStateValues enumValue)
+        const char* GetNameForSettablePolicyStateValues(SettablePolicyStateValues enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
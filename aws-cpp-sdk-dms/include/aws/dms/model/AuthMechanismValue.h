@@ -35,7 +35,8 @@ namespace AuthMechanismValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API AuthMechanismValue GetAuthMechanismValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForAuthMechanismValue(AuthMechanismValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForAuthMechanismValue(AuthMechanismValue value);
 } // namespace AuthMechanismValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -34,7 +34,8 @@ namespace AuthTypeValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API AuthTypeValue GetAuthTypeValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForAuthTypeValue(AuthTypeValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForAuthTypeValue(AuthTypeValue value);
 } // namespace AuthTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
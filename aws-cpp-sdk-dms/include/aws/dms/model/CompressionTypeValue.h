@@ -34,7 +34,8 @@ namespace CompressionTypeValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API CompressionTypeValue GetCompressionTypeValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForCompressionTypeValue(CompressionTypeValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForCompressionTypeValue(CompressionTypeValue value);
 } // namespace CompressionTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -36,7 +36,8 @@ namespace DmsSslModeValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API DmsSslModeValue GetDmsSslModeValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForDmsSslModeValue(DmsSslModeValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForDmsSslModeValue(DmsSslModeValue value);
 } // namespace DmsSslModeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -35,7 +35,8 @@ namespace MigrationTypeValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API MigrationTypeValue GetMigrationTypeValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForMigrationTypeValue(MigrationTypeValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForMigrationTypeValue(MigrationTypeValue value);
 } // namespace MigrationTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -34,7 +34,8 @@ namespace NestingLevelValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API NestingLevelValue GetNestingLevelValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForNestingLevelValue(NestingLevelValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForNestingLevelValue(NestingLevelValue value);
 } // namespace NestingLevelValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
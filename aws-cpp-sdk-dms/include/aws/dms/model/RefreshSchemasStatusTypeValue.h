@@ -35,7 +35,8 @@ namespace RefreshSchemasStatusTypeValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API RefreshSchemasStatusTypeValue GetRefreshSchemasStatusTypeValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForRefreshSchemasStatusTypeValue(RefreshSchemasStatusTypeValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForRefreshSchemasStatusTypeValue(RefreshSchemasStatusTypeValue value);
 } // namespace RefreshSchemasStatusTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
@@ -34,7 +34,8 @@ namespace ReloadOptionValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API ReloadOptionValue GetReloadOptionValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForReloadOptionValue(ReloadOptionValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForReloadOptionValue(ReloadOptionValue value);
 } // namespace ReloadOptionValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
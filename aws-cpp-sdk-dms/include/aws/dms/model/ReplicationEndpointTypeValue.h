@@ -34,7 +34,8 @@ namespace ReplicationEndpointTypeValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API ReplicationEndpointTypeValue GetReplicationEndpointTypeValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForReplicationEndpointTypeValue(ReplicationEndpointTypeValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForReplicationEndpointTypeValue(ReplicationEndpointTypeValue value);
 } // namespace ReplicationEndpointTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
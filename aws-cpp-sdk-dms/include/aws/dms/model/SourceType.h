@@ -33,7 +33,8 @@ namespace SourceTypeMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API SourceType GetSourceTypeForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForSourceType(SourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForSourceType(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
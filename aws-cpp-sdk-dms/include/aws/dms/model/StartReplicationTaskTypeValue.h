@@ -35,7 +35,8 @@ namespace StartReplicationTaskTypeValueMapper
 {
 AWS_DATABASEMIGRATIONSERVICE_API StartReplicationTaskTypeValue GetStartReplicationTaskTypeValueForName(const Aws::String& name);
 
-AWS_DATABASEMIGRATIONSERVICE_API Aws::String GetNameForStartReplicationTaskTypeValue(StartReplicationTaskTypeValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DATABASEMIGRATIONSERVICE_API const char* GetNameForStartReplicationTaskTypeValue(StartReplicationTaskTypeValue value);
 } // namespace StartReplicationTaskTypeValueMapper
 } // namespace Model
 } // namespace DatabaseMigrationService
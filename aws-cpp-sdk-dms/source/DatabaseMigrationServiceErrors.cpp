@@ -28,21 +28,21 @@ namespace DatabaseMigrationService
 namespace DatabaseMigrationServiceErrorMapper
 {
 
-static const int INVALID_RESOURCE_STATE_FAULT_HASH = HashingUtils::HashString("InvalidResourceStateFault");
-static const int S_N_S_NO_AUTHORIZATION_FAULT_HASH = HashingUtils::HashString("SNSNoAuthorizationFault");
-static const int INSUFFICIENT_RESOURCE_CAPACITY_FAULT_HASH = HashingUtils::HashString("InsufficientResourceCapacityFault");
-static const int UPGRADE_DEPENDENCY_FAILURE_FAULT_HASH = HashingUtils::HashString("UpgradeDependencyFailureFault");
-static const int RESOURCE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ResourceQuotaExceededFault");
-static const int RESOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ResourceNotFoundFault");
-static const int INVALID_SUBNET_HASH = HashingUtils::HashString("InvalidSubnet");
-static const int SUBNET_ALREADY_IN_USE_HASH = HashingUtils::HashString("SubnetAlreadyInUse");
-static const int ACCESS_DENIED_FAULT_HASH = HashingUtils::HashString("AccessDeniedFault");
-static const int RESOURCE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ResourceAlreadyExistsFault");
-static const int S_N_S_INVALID_TOPIC_FAULT_HASH = HashingUtils::HashString("SNSInvalidTopicFault");
-static const int K_M_S_KEY_NOT_ACCESSIBLE_FAULT_HASH = HashingUtils::HashString("KMSKeyNotAccessibleFault");
-static const int INVALID_CERTIFICATE_FAULT_HASH = HashingUtils::HashString("InvalidCertificateFault");
-static const int STORAGE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("StorageQuotaExceededFault");
-static const int REPLICATION_SUBNET_GROUP_DOES_NOT_COVER_ENOUGH_A_ZS_HASH = HashingUtils::HashString("ReplicationSubnetGroupDoesNotCoverEnoughAZs");
+static constexpr int INVALID_RESOURCE_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidResourceStateFault");
+static constexpr int S_N_S_NO_AUTHORIZATION_FAULT_HASH = HashingUtils::CompileTimeHashString("SNSNoAuthorizationFault");
+static constexpr int INSUFFICIENT_RESOURCE_CAPACITY_FAULT_HASH = HashingUtils::CompileTimeHashString("InsufficientResourceCapacityFault");
+static constexpr int UPGRADE_DEPENDENCY_FAILURE_FAULT_HASH = HashingUtils::CompileTimeHashString("UpgradeDependencyFailureFault");
+static constexpr int RESOURCE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ResourceQuotaExceededFault");
+static constexpr int RESOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ResourceNotFoundFault");
+static constexpr int INVALID_SUBNET_HASH = HashingUtils::CompileTimeHashString("InvalidSubnet");
+static constexpr int SUBNET_ALREADY_IN_USE_HASH = HashingUtils::CompileTimeHashString("SubnetAlreadyInUse");
+static constexpr int ACCESS_DENIED_FAULT_HASH = HashingUtils::CompileTimeHashString("AccessDeniedFault");
+static constexpr int RESOURCE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyExistsFault");
+static constexpr int S_N_S_INVALID_TOPIC_FAULT_HASH = HashingUtils::CompileTimeHashString("SNSInvalidTopicFault");
+static constexpr int K_M_S_KEY_NOT_ACCESSIBLE_FAULT_HASH = HashingUtils::CompileTimeHashString("KMSKeyNotAccessibleFault");
+static constexpr int INVALID_CERTIFICATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidCertificateFault");
+static constexpr int STORAGE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("StorageQuotaExceededFault");
+static constexpr int REPLICATION_SUBNET_GROUP_DOES_NOT_COVER_ENOUGH_A_ZS_HASH = HashingUtils::CompileTimeHashString("ReplicationSubnetGroupDoesNotCoverEnoughAZs");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
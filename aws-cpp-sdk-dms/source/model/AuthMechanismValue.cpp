@@ -30,25 +30,37 @@ namespace Aws
       namespace AuthMechanismValueMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-        static const int mongodb_cr_HASH = HashingUtils::HashString("mongodb_cr");
-        static const int scram_sha_1_HASH = HashingUtils::HashString("scram_sha_1");
+        static constexpr int default__HASH = HashingUtils::CompileTimeHashString("default");
+        static constexpr int mongodb_cr_HASH = HashingUtils::CompileTimeHashString("mongodb_cr");
+        static constexpr int scram_sha_1_HASH = HashingUtils::CompileTimeHashString("scram_sha_1");
 
 
         AuthMechanismValue GetAuthMechanismValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthMechanismValue::default_;
-          }
-          else if (hashCode == mongodb_cr_HASH)
-          {
-            return AuthMechanismValue::mongodb_cr;
-          }
-          else if (hashCode == scram_sha_1_HASH)
-          {
-            return AuthMechanismValue::scram_sha_1;
+          case default__HASH:
+            if (name == "default")
+            {
+              return AuthMechanismValue::default_;
+            }
+            break;
+          case mongodb_cr_HASH:
+            if (name == "mongodb_cr")
+            {
+              return AuthMechanismValue::mongodb_cr;
+            }
+            break;
+          case scram_sha_1_HASH:
+            if (name == "scram_sha_1")
+            {
+              return AuthMechanismValue::scram_sha_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AuthMechanismValue::NOT_SET;
         }
 
-        Aws::String GetNameForAuthMechanismValue(AuthMechanismValue enumValue)
+        const char* GetNameForAuthMechanismValue(AuthMechanismValue enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AuthTypeValueMapper
       {
 
-        static const int no_HASH = HashingUtils::HashString("no");
-        static const int password_HASH = HashingUtils::HashString("password");
+        static constexpr int no_HASH = HashingUtils::CompileTimeHashString("no");
+        static constexpr int password_HASH = HashingUtils::CompileTimeHashString("password");
 
 
         AuthTypeValue GetAuthTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == no_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthTypeValue::no;
-          }
-          else if (hashCode == password_HASH)
-          {
-            return AuthTypeValue::password;
+          case no_HASH:
+            if (name == "no")
+            {
+              return AuthTypeValue::no;
+            }
+            break;
+          case password_HASH:
+            if (name == "password")
+            {
+              return AuthTypeValue::password;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AuthTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForAuthTypeValue(AuthTypeValue enumValue)
+        const char* GetNameForAuthTypeValue(AuthTypeValue enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
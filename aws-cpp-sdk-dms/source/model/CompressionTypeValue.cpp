@@ -30,20 +30,30 @@ namespace Aws
       namespace CompressionTypeValueMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int gzip_HASH = HashingUtils::HashString("gzip");
+        static constexpr int none_HASH = HashingUtils::CompileTimeHashString("none");
+        static constexpr int gzip_HASH = HashingUtils::CompileTimeHashString("gzip");
 
 
         CompressionTypeValue GetCompressionTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CompressionTypeValue::none;
-          }
-          else if (hashCode == gzip_HASH)
-          {
-            return CompressionTypeValue::gzip;
+          case none_HASH:
+            if (name == "none")
+            {
+              return CompressionTypeValue::none;
+            }
+            break;
+          case gzip_HASH:
+            if (name == "gzip")
+            {
+              return CompressionTypeValue::gzip;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CompressionTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionTypeValue(CompressionTypeValue enumValue)
+        const char* GetNameForCompressionTypeValue(CompressionTypeValue enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace DmsSslModeValueMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int require_HASH = HashingUtils::HashString("require");
-        static const int verify_ca_HASH = HashingUtils::HashString("verify-ca");
-        static const int verify_full_HASH = HashingUtils::HashString("verify-full");
+        static constexpr int none_HASH = HashingUtils::CompileTimeHashString("none");
+        static constexpr int require_HASH = HashingUtils::CompileTimeHashString("require");
+        static constexpr int verify_ca_HASH = HashingUtils::CompileTimeHashString("verify-ca");
+        static constexpr int verify_full_HASH = HashingUtils::CompileTimeHashString("verify-full");
 
 
         DmsSslModeValue GetDmsSslModeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DmsSslModeValue::none;
-          }
-          else if (hashCode == require_HASH)
-          {
-            return DmsSslModeValue::require;
-          }
-          else if (hashCode == verify_ca_HASH)
-          {
-            return DmsSslModeValue::verify_ca;
-          }
-          else if (hashCode == verify_full_HASH)
-          {
-            return DmsSslModeValue::verify_full;
+          case none_HASH:
+            if (name == "none")
+            {
+              return DmsSslModeValue::none;
+            }
+            break;
+          case require_HASH:
+            if (name == "require")
+            {
+              return DmsSslModeValue::require;
+            }
+            break;
+          case verify_ca_HASH:
+            if (name == "verify-ca")
+            {
+              return DmsSslModeValue::verify_ca;
+            }
+            break;
+          case verify_full_HASH:
+            if (name == "verify-full")
+            {
+              return DmsSslModeValue::verify_full;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DmsSslModeValue::NOT_SET;
         }
 
-        Aws::String GetNameForDmsSslModeValue(DmsSslModeValue enumValue)
+        const char* GetNameForDmsSslModeValue(DmsSslModeValue enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace MigrationTypeValueMapper
       {
 
-        static const int full_load_HASH = HashingUtils::HashString("full-load");
-        static const int cdc_HASH = HashingUtils::HashString("cdc");
-        static const int full_load_and_cdc_HASH = HashingUtils::HashString("full-load-and-cdc");
+        static constexpr int full_load_HASH = HashingUtils::CompileTimeHashString("full-load");
+        static constexpr int cdc_HASH = HashingUtils::CompileTimeHashString("cdc");
+        static constexpr int full_load_and_cdc_HASH = HashingUtils::CompileTimeHashString("full-load-and-cdc");
 
 
         MigrationTypeValue GetMigrationTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == full_load_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MigrationTypeValue::full_load;
-          }
-          else if (hashCode == cdc_HASH)
-          {
-            return MigrationTypeValue::cdc;
-          }
-          else if (hashCode == full_load_and_cdc_HASH)
-          {
-            return MigrationTypeValue::full_load_and_cdc;
+          case full_load_HASH:
+            if (name == "full-load")
+            {
+              return MigrationTypeValue::full_load;
+            }
+            break;
+          case cdc_HASH:
+            if (name == "cdc")
+            {
+              return MigrationTypeValue::cdc;
+            }
+            break;
+          case full_load_and_cdc_HASH:
+            if (name == "full-load-and-cdc")
+            {
+              return MigrationTypeValue::full_load_and_cdc;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return MigrationTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForMigrationTypeValue(MigrationTypeValue enumValue)
+        const char* GetNameForMigrationTypeValue(MigrationTypeValue enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace NestingLevelValueMapper
       {
 
-        static const int none_HASH = HashingUtils::HashString("none");
-        static const int one_HASH = HashingUtils::HashString("one");
+        static constexpr int none_HASH = HashingUtils::CompileTimeHashString("none");
+        static constexpr int one_HASH = HashingUtils::CompileTimeHashString("one");
 
 
         NestingLevelValue GetNestingLevelValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == none_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NestingLevelValue::none;
-          }
-          else if (hashCode == one_HASH)
-          {
-            return NestingLevelValue::one;
+          case none_HASH:
+            if (name == "none")
+            {
+              return NestingLevelValue::none;
+            }
+            break;
+          case one_HASH:
+            if (name == "one")
+            {
+              return NestingLevelValue::one;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return NestingLevelValue::NOT_SET;
         }
 
-        Aws::String GetNameForNestingLevelValue(NestingLevelValue enumValue)
+        const char* GetNameForNestingLevelValue(NestingLevelValue enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace RefreshSchemasStatusTypeValueMapper
       {
 
-        static const int successful_HASH = HashingUtils::HashString("successful");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int refreshing_HASH = HashingUtils::HashString("refreshing");
+        static constexpr int successful_HASH = HashingUtils::CompileTimeHashString("successful");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int refreshing_HASH = HashingUtils::CompileTimeHashString("refreshing");
 
 
         RefreshSchemasStatusTypeValue GetRefreshSchemasStatusTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == successful_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RefreshSchemasStatusTypeValue::successful;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return RefreshSchemasStatusTypeValue::failed;
-          }
-          else if (hashCode == refreshing_HASH)
-          {
-            return RefreshSchemasStatusTypeValue::refreshing;
+          case successful_HASH:
+            if (name == "successful")
+            {
+              return RefreshSchemasStatusTypeValue::successful;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return RefreshSchemasStatusTypeValue::failed;
+            }
+            break;
+          case refreshing_HASH:
+            if (name == "refreshing")
+            {
+              return RefreshSchemasStatusTypeValue::refreshing;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RefreshSchemasStatusTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForRefreshSchemasStatusTypeValue(RefreshSchemasStatusTypeValue enumValue)
+        const char* GetNameForRefreshSchemasStatusTypeValue(RefreshSchemasStatusTypeValue enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ReloadOptionValueMapper
       {
 
-        static const int data_reload_HASH = HashingUtils::HashString("data-reload");
-        static const int validate_only_HASH = HashingUtils::HashString("validate-only");
+        static constexpr int data_reload_HASH = HashingUtils::CompileTimeHashString("data-reload");
+        static constexpr int validate_only_HASH = HashingUtils::CompileTimeHashString("validate-only");
 
 
         ReloadOptionValue GetReloadOptionValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == data_reload_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReloadOptionValue::data_reload;
-          }
-          else if (hashCode == validate_only_HASH)
-          {
-            return ReloadOptionValue::validate_only;
+          case data_reload_HASH:
+            if (name == "data-reload")
+            {
+              return ReloadOptionValue::data_reload;
+            }
+            break;
+          case validate_only_HASH:
+            if (name == "validate-only")
+            {
+              return ReloadOptionValue::validate_only;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReloadOptionValue::NOT_SET;
         }
 
-        Aws::String GetNameForReloadOptionValue(ReloadOptionValue enumValue)
+        const char* GetNameForReloadOptionValue(ReloadOptionValue enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ReplicationEndpointTypeValueMapper
       {
 
-        static const int source_HASH = HashingUtils::HashString("source");
-        static const int target_HASH = HashingUtils::HashString("target");
+        static constexpr int source_HASH = HashingUtils::CompileTimeHashString("source");
+        static constexpr int target_HASH = HashingUtils::CompileTimeHashString("target");
 
 
         ReplicationEndpointTypeValue GetReplicationEndpointTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == source_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReplicationEndpointTypeValue::source;
-          }
-          else if (hashCode == target_HASH)
-          {
-            return ReplicationEndpointTypeValue::target;
+          case source_HASH:
+            if (name == "source")
+            {
+              return ReplicationEndpointTypeValue::source;
+            }
+            break;
+          case target_HASH:
+            if (name == "target")
+            {
+              return ReplicationEndpointTypeValue::target;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReplicationEndpointTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationEndpointTypeValue(ReplicationEndpointTypeValue enumValue)
+        const char* GetNameForReplicationEndpointTypeValue(ReplicationEndpointTypeValue enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
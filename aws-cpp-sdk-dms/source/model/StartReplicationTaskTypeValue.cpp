@@ -30,25 +30,37 @@ namespace Aws
       namespace StartReplicationTaskTypeValueMapper
       {
 
-        static const int start_replication_HASH = HashingUtils::HashString("start-replication");
-        static const int resume_processing_HASH = HashingUtils::HashString("resume-processing");
-        static const int reload_target_HASH = HashingUtils::HashString("reload-target");
+        static constexpr int start_replication_HASH = HashingUtils::CompileTimeHashString("start-replication");
+        static constexpr int resume_processing_HASH = HashingUtils::CompileTimeHashString("resume-processing");
+        static constexpr int reload_target_HASH = HashingUtils::CompileTimeHashString("reload-target");
 
 
         StartReplicationTaskTypeValue GetStartReplicationTaskTypeValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == start_replication_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StartReplicationTaskTypeValue::start_replication;
-          }
-          else if (hashCode == resume_processing_HASH)
-          {
-            return StartReplicationTaskTypeValue::resume_processing;
-          }
-          else if (hashCode == reload_target_HASH)
-          {
-            return StartReplicationTaskTypeValue::reload_target;
+          case start_replication_HASH:
+            if (name == "start-replication")
+            {
+              return StartReplicationTaskTypeValue::start_replication;
+            }
+            break;
+          case resume_processing_HASH:
+            if (name == "resume-processing")
+            {
+              return StartReplicationTaskTypeValue::resume_processing;
+            }
+            break;
+          case reload_target_HASH:
+            if (name == "reload-target")
+            {
+              return StartReplicationTaskTypeValue::reload_target;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return StartReplicationTaskTypeValue::NOT_SET;
         }
 
-        Aws::String GetNameForStartReplicationTaskTypeValue(StartReplicationTaskTypeValue enumValue)
+        const char* GetNameForStartReplicationTaskTypeValue(StartReplicationTaskTypeValue enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace DirectoryEditionMapper
 {
 AWS_DIRECTORYSERVICE_API DirectoryEdition GetDirectoryEditionForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForDirectoryEdition(DirectoryEdition value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForDirectoryEdition(DirectoryEdition value);
 } // namespace DirectoryEditionMapper
 } // namespace Model
 } // namespace DirectoryService
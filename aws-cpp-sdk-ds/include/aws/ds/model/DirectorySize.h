@@ -34,7 +34,8 @@ namespace DirectorySizeMapper
 {
 AWS_DIRECTORYSERVICE_API DirectorySize GetDirectorySizeForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForDirectorySize(DirectorySize value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForDirectorySize(DirectorySize value);
 } // namespace DirectorySizeMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -43,7 +43,8 @@ namespace DirectoryStageMapper
 {
 AWS_DIRECTORYSERVICE_API DirectoryStage GetDirectoryStageForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForDirectoryStage(DirectoryStage value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForDirectoryStage(DirectoryStage value);
 } // namespace DirectoryStageMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -35,7 +35,8 @@ namespace DirectoryTypeMapper
 {
 AWS_DIRECTORYSERVICE_API DirectoryType GetDirectoryTypeForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForDirectoryType(DirectoryType value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForDirectoryType(DirectoryType value);
 } // namespace DirectoryTypeMapper
 } // namespace Model
 } // namespace DirectoryService
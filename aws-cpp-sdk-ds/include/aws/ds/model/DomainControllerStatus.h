@@ -39,7 +39,8 @@ namespace DomainControllerStatusMapper
 {
 AWS_DIRECTORYSERVICE_API DomainControllerStatus GetDomainControllerStatusForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForDomainControllerStatus(DomainControllerStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForDomainControllerStatus(DomainControllerStatus value);
 } // namespace DomainControllerStatusMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -38,7 +38,8 @@ namespace IpRouteStatusMsgMapper
 {
 AWS_DIRECTORYSERVICE_API IpRouteStatusMsg GetIpRouteStatusMsgForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForIpRouteStatusMsg(IpRouteStatusMsg value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForIpRouteStatusMsg(IpRouteStatusMsg value);
 } // namespace IpRouteStatusMsgMapper
 } // namespace Model
 } // namespace DirectoryService
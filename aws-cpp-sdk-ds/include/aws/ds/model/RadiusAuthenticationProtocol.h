@@ -36,7 +36,8 @@ namespace RadiusAuthenticationProtocolMapper
 {
 AWS_DIRECTORYSERVICE_API RadiusAuthenticationProtocol GetRadiusAuthenticationProtocolForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForRadiusAuthenticationProtocol(RadiusAuthenticationProtocol value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForRadiusAuthenticationProtocol(RadiusAuthenticationProtocol value);
 } // namespace RadiusAuthenticationProtocolMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -35,7 +35,8 @@ namespace RadiusStatusMapper
 {
 AWS_DIRECTORYSERVICE_API RadiusStatus GetRadiusStatusForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForRadiusStatus(RadiusStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForRadiusStatus(RadiusStatus value);
 } // namespace RadiusStatusMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -33,7 +33,8 @@ namespace ReplicationScopeMapper
 {
 AWS_DIRECTORYSERVICE_API ReplicationScope GetReplicationScopeForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForReplicationScope(ReplicationScope value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForReplicationScope(ReplicationScope value);
 } // namespace ReplicationScopeMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -41,7 +41,8 @@ namespace SchemaExtensionStatusMapper
 {
 AWS_DIRECTORYSERVICE_API SchemaExtensionStatus GetSchemaExtensionStatusForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForSchemaExtensionStatus(SchemaExtensionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForSchemaExtensionStatus(SchemaExtensionStatus value);
 } // namespace SchemaExtensionStatusMapper
 } // namespace Model
 } // namespace DirectoryService
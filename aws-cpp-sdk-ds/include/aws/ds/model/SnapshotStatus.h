@@ -35,7 +35,8 @@ namespace SnapshotStatusMapper
 {
 AWS_DIRECTORYSERVICE_API SnapshotStatus GetSnapshotStatusForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForSnapshotStatus(SnapshotStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForSnapshotStatus(SnapshotStatus value);
 } // namespace SnapshotStatusMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -34,7 +34,8 @@ namespace SnapshotTypeMapper
 {
 AWS_DIRECTORYSERVICE_API SnapshotType GetSnapshotTypeForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForSnapshotType(SnapshotType value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForSnapshotType(SnapshotType value);
 } // namespace SnapshotTypeMapper
 } // namespace Model
 } // namespace DirectoryService
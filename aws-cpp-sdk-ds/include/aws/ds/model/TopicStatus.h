@@ -36,7 +36,8 @@ namespace TopicStatusMapper
 {
 AWS_DIRECTORYSERVICE_API TopicStatus GetTopicStatusForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForTopicStatus(TopicStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForTopicStatus(TopicStatus value);
 } // namespace TopicStatusMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -35,7 +35,8 @@ namespace TrustDirectionMapper
 {
 AWS_DIRECTORYSERVICE_API TrustDirection GetTrustDirectionForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForTrustDirection(TrustDirection value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForTrustDirection(TrustDirection value);
 } // namespace TrustDirectionMapper
 } // namespace Model
 } // namespace DirectoryService
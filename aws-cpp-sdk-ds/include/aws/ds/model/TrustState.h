@@ -40,7 +40,8 @@ namespace TrustStateMapper
 {
 AWS_DIRECTORYSERVICE_API TrustState GetTrustStateForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForTrustState(TrustState value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForTrustState(TrustState value);
 } // namespace TrustStateMapper
 } // namespace Model
 } // namespace DirectoryService
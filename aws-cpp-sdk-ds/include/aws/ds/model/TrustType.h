@@ -33,7 +33,8 @@ namespace TrustTypeMapper
 {
 AWS_DIRECTORYSERVICE_API TrustType GetTrustTypeForName(const Aws::String& name);
 
-AWS_DIRECTORYSERVICE_API Aws::String GetNameForTrustType(TrustType value);
+// names of values not modeled point into the enum overflow container
+AWS_DIRECTORYSERVICE_API const char* GetNameForTrustType(TrustType value);
 } // namespace TrustTypeMapper
 } // namespace Model
 } // namespace DirectoryService
@@ -28,23 +28,23 @@ namespace DirectoryService
 namespace DirectoryServiceErrorMapper
 {
 
-static const int IP_ROUTE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("IpRouteLimitExceededException");
-static const int AUTHENTICATION_FAILED_HASH = HashingUtils::HashString("AuthenticationFailedException");
-static const int ENTITY_ALREADY_EXISTS_HASH = HashingUtils::HashString("EntityAlreadyExistsException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int DOMAIN_CONTROLLER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DomainControllerLimitExceededException");
-static const int DIRECTORY_UNAVAILABLE_HASH = HashingUtils::HashString("DirectoryUnavailableException");
-static const int USER_DOES_NOT_EXIST_HASH = HashingUtils::HashString("UserDoesNotExistException");
-static const int ENTITY_DOES_NOT_EXIST_HASH = HashingUtils::HashString("EntityDoesNotExistException");
-static const int INSUFFICIENT_PERMISSIONS_HASH = HashingUtils::HashString("InsufficientPermissionsException");
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int SERVICE_HASH = HashingUtils::HashString("ServiceException");
-static const int SNAPSHOT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("SnapshotLimitExceededException");
-static const int INVALID_PASSWORD_HASH = HashingUtils::HashString("InvalidPasswordException");
-static const int TAG_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TagLimitExceededException");
-static const int DIRECTORY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DirectoryLimitExceededException");
-static const int CLIENT_HASH = HashingUtils::HashString("ClientException");
-static const int UNSUPPORTED_OPERATION_HASH = HashingUtils::HashString("UnsupportedOperationException");
+static constexpr int IP_ROUTE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("IpRouteLimitExceededException");
+static constexpr int AUTHENTICATION_FAILED_HASH = HashingUtils::CompileTimeHashString("AuthenticationFailedException");
+static constexpr int ENTITY_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("EntityAlreadyExistsException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int DOMAIN_CONTROLLER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DomainControllerLimitExceededException");
+static constexpr int DIRECTORY_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("DirectoryUnavailableException");
+static constexpr int USER_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("UserDoesNotExistException");
+static constexpr int ENTITY_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("EntityDoesNotExistException");
+static constexpr int INSUFFICIENT_PERMISSIONS_HASH = HashingUtils::CompileTimeHashString("InsufficientPermissionsException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int SERVICE_HASH = HashingUtils::CompileTimeHashString("ServiceException");
+static constexpr int SNAPSHOT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("SnapshotLimitExceededException");
+static constexpr int INVALID_PASSWORD_HASH = HashingUtils::CompileTimeHashString("InvalidPasswordException");
+static constexpr int TAG_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TagLimitExceededException");
+static constexpr int DIRECTORY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DirectoryLimitExceededException");
+static constexpr int CLIENT_HASH = HashingUtils::CompileTimeHashString("ClientException");
+static constexpr int UNSUPPORTED_OPERATION_HASH = HashingUtils::CompileTimeHashString("UnsupportedOperationException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace DirectoryEditionMapper
       {
 
-        static const int Enterprise_HASH = HashingUtils::HashString("Enterprise");
-        static const int Standard_HASH = HashingUtils::HashString("Standard");
+        static constexpr int Enterprise_HASH = HashingUtils::CompileTimeHashString("Enterprise");
+        static constexpr int Standard_HASH = HashingUtils::CompileTimeHashString("Standard");
 
 
         DirectoryEdition GetDirectoryEditionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enterprise_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DirectoryEdition::Enterprise;
-          }
-          else if (hashCode == Standard_HASH)
-          {
-            return DirectoryEdition::Standard;
+          case Enterprise_HASH:
+            if (name == "Enterprise")
+            {
+              return DirectoryEdition::Enterprise;
+            }
+            break;
+          case Standard_HASH:
+            if (name == "Standard")
+            {
+              return DirectoryEdition::Standard;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DirectoryEdition::NOT_SET;
         }
 
-        Aws::String GetNameForDirectoryEdition(DirectoryEdition enumValue)
+        const char* GetNameForDirectoryEdition(DirectoryEdition enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DirectorySizeMapper
       {
 
-        static const int Small_HASH = HashingUtils::HashString("Small");
-        static const int Large_HASH = HashingUtils::HashString("Large");
+        static constexpr int Small_HASH = HashingUtils::CompileTimeHashString("Small");
+        static constexpr int Large_HASH = HashingUtils::CompileTimeHashString("Large");
 
 
         DirectorySize GetDirectorySizeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Small_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DirectorySize::Small;
-          }
-          else if (hashCode == Large_HASH)
-          {
-            return DirectorySize::Large;
+          case Small_HASH:
+            if (name == "Small")
+            {
+              return DirectorySize::Small;
+            }
+            break;
+          case Large_HASH:
+            if (name == "Large")
+            {
+              return DirectorySize::Large;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DirectorySize::NOT_SET;
         }
 
-        Aws::String GetNameForDirectorySize(DirectorySize enumValue)
+        const char* GetNameForDirectorySize(DirectorySize enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,65 +30,93 @@ namespace Aws
       namespace DirectoryStageMapper
       {
 
-        static const int Requested_HASH = HashingUtils::HashString("Requested");
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Inoperable_HASH = HashingUtils::HashString("Inoperable");
-        static const int Impaired_HASH = HashingUtils::HashString("Impaired");
-        static const int Restoring_HASH = HashingUtils::HashString("Restoring");
-        static const int RestoreFailed_HASH = HashingUtils::HashString("RestoreFailed");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Requested_HASH = HashingUtils::CompileTimeHashString("Requested");
+        static constexpr int Creating_HASH = HashingUtils::CompileTimeHashString("Creating");
+        static constexpr int Created_HASH = HashingUtils::CompileTimeHashString("Created");
+        static constexpr int Active_HASH = HashingUtils::CompileTimeHashString("Active");
+        static constexpr int Inoperable_HASH = HashingUtils::CompileTimeHashString("Inoperable");
+        static constexpr int Impaired_HASH = HashingUtils::CompileTimeHashString("Impaired");
+        static constexpr int Restoring_HASH = HashingUtils::CompileTimeHashString("Restoring");
+        static constexpr int RestoreFailed_HASH = HashingUtils::CompileTimeHashString("RestoreFailed");
+        static constexpr int Deleting_HASH = HashingUtils::CompileTimeHashString("Deleting");
+        static constexpr int Deleted_HASH = HashingUtils::CompileTimeHashString("Deleted");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         DirectoryStage GetDirectoryStageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Requested_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DirectoryStage::Requested;
-          }
-          else if (hashCode == Creating_HASH)
-          {
-            return DirectoryStage::Creating;
-          }
-          else if (hashCode == Created_HASH)
-          {
-            return DirectoryStage::Created;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return DirectoryStage::Active;
-          }
-          else if (hashCode == Inoperable_HASH)
-          {
-            return DirectoryStage::Inoperable;
-          }
-          else if (hashCode == Impaired_HASH)
-          {
-            return DirectoryStage::Impaired;
-          }
-          else if (hashCode == Restoring_HASH)
-          {
-            return DirectoryStage::Restoring;
-          }
-          else if (hashCode == RestoreFailed_HASH)
-          {
-            return DirectoryStage::RestoreFailed;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return DirectoryStage::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return DirectoryStage::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DirectoryStage::Failed;
+          case Requested_HASH:
+            if (name == "Requested")
+            {
+              return DirectoryStage::Requested;
+            }
+            break;
+          case Creating_HASH:
+            if (name == "Creating")
+            {
+              return DirectoryStage::Creating;
+            }
+            break;
+          case Created_HASH:
+            if (name == "Created")
+            {
+              return DirectoryStage::Created;
+            }
+            break;
+          case Active_HASH:
+            if (name == "Active")
+            {
+              return DirectoryStage::Active;
+            }
+            break;
+          case Inoperable_HASH:
+            if (name == "Inoperable")
+            {
+              return DirectoryStage::Inoperable;
+            }
+            break;
+          case Impaired_HASH:
+            if (name == "Impaired")
+            {
+              return DirectoryStage::Impaired;
+            }
+            break;
+          case Restoring_HASH:
+            if (name == "Restoring")
+            {
+              return DirectoryStage::Restoring;
+            }
+            break;
+          case RestoreFailed_HASH:
+            if (name == "RestoreFailed")
+            {
+              return DirectoryStage::RestoreFailed;
+            }
+            break;
+          case Deleting_HASH:
+            if (name == "Deleting")
+            {
+              return DirectoryStage::Deleting;
+            }
+            break;
+          case Deleted_HASH:
+            if (name == "Deleted")
+            {
+              return DirectoryStage::Deleted;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return DirectoryStage::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return DirectoryStage::NOT_SET;
         }
 
-        Aws::String GetNameForDirectoryStage(DirectoryStage enumValue)
+        const char* GetNameForDirectoryStage(DirectoryStage enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace DirectoryTypeMapper
       {
 
-        static const int SimpleAD_HASH = HashingUtils::HashString("SimpleAD");
-        static const int ADConnector_HASH = HashingUtils::HashString("ADConnector");
-        static const int MicrosoftAD_HASH = HashingUtils::HashString("MicrosoftAD");
+        static constexpr int SimpleAD_HASH = HashingUtils::CompileTimeHashString("SimpleAD");
+        static constexpr int ADConnector_HASH = HashingUtils::CompileTimeHashString("ADConnector");
+        static constexpr int MicrosoftAD_HASH = HashingUtils::CompileTimeHashString("MicrosoftAD");
 
 
         DirectoryType GetDirectoryTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SimpleAD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DirectoryType::SimpleAD;
-          }
-          else if (hashCode == ADConnector_HASH)
-          {
-            return DirectoryType::ADConnector;
-          }
-          else if (hashCode == MicrosoftAD_HASH)
-          {
-            return DirectoryType::MicrosoftAD;
+          case SimpleAD_HASH:
+            if (name == "SimpleAD")
+            {
+              return DirectoryType::SimpleAD;
+            }
+            break;
+          case ADConnector_HASH:
+            if (name == "ADConnector")
+            {
+              return DirectoryType::ADConnector;
+            }
+            break;
+          case MicrosoftAD_HASH:
+            if (name == "MicrosoftAD")
+            {
+              return DirectoryType::MicrosoftAD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DirectoryType::NOT_SET;
         }
 
-        Aws::String GetNameForDirectoryType(DirectoryType enumValue)
+        const char* GetNameForDirectoryType(DirectoryType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
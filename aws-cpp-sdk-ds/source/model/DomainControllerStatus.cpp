@@ -30,45 +30,65 @@ namespace Aws
       namespace DomainControllerStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Impaired_HASH = HashingUtils::HashString("Impaired");
-        static const int Restoring_HASH = HashingUtils::HashString("Restoring");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Creating_HASH = HashingUtils::CompileTimeHashString("Creating");
+        static constexpr int Active_HASH = HashingUtils::CompileTimeHashString("Active");
+        static constexpr int Impaired_HASH = HashingUtils::CompileTimeHashString("Impaired");
+        static constexpr int Restoring_HASH = HashingUtils::CompileTimeHashString("Restoring");
+        static constexpr int Deleting_HASH = HashingUtils::CompileTimeHashString("Deleting");
+        static constexpr int Deleted_HASH = HashingUtils::CompileTimeHashString("Deleted");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         DomainControllerStatus GetDomainControllerStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DomainControllerStatus::Creating;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return DomainControllerStatus::Active;
-          }
-          else if (hashCode == Impaired_HASH)
-          {
-            return DomainControllerStatus::Impaired;
-          }
-          else if (hashCode == Restoring_HASH)
-          {
-            return DomainControllerStatus::Restoring;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return DomainControllerStatus::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return DomainControllerStatus::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DomainControllerStatus::Failed;
+          case Creating_HASH:
+            if (name == "Creating")
+            {
+              return DomainControllerStatus::Creating;
+            }
+            break;
+          case Active_HASH:
+            if (name == "Active")
+            {
+              return DomainControllerStatus::Active;
+            }
+            break;
+          case Impaired_HASH:
+            if (name == "Impaired")
+            {
+              return DomainControllerStatus::Impaired;
+            }
+            break;
+          case Restoring_HASH:
+            if (name == "Restoring")
+            {
+              return DomainControllerStatus::Restoring;
+            }
+            break;
+          case Deleting_HASH:
+            if (name == "Deleting")
+            {
+              return DomainControllerStatus::Deleting;
+            }
+            break;
+          case Deleted_HASH:
+            if (name == "Deleted")
+            {
+              return DomainControllerStatus::Deleted;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return DomainControllerStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return DomainControllerStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDomainControllerStatus(DomainControllerStatus enumValue)
+        const char* GetNameForDomainControllerStatus(DomainControllerStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace IpRouteStatusMsgMapper
       {
 
-        static const int Adding_HASH = HashingUtils::HashString("Adding");
-        static const int Added_HASH = HashingUtils::HashString("Added");
-        static const int Removing_HASH = HashingUtils::HashString("Removing");
-        static const int Removed_HASH = HashingUtils::HashString("Removed");
-        static const int AddFailed_HASH = HashingUtils::HashString("AddFailed");
-        static const int RemoveFailed_HASH = HashingUtils::HashString("RemoveFailed");
+        static constexpr int Adding_HASH = HashingUtils::CompileTimeHashString("Adding");
+        static constexpr int Added_HASH = HashingUtils::CompileTimeHashString("Added");
+        static constexpr int Removing_HASH = HashingUtils::CompileTimeHashString("Removing");
+        static constexpr int Removed_HASH = HashingUtils::CompileTimeHashString("Removed");
+        static constexpr int AddFailed_HASH = HashingUtils::CompileTimeHashString("AddFailed");
+        static constexpr int RemoveFailed_HASH = HashingUtils::CompileTimeHashString("RemoveFailed");
 
 
         IpRouteStatusMsg GetIpRouteStatusMsgForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Adding_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IpRouteStatusMsg::Adding;
-          }
-          else if (hashCode == Added_HASH)
-          {
-            return IpRouteStatusMsg::Added;
-          }
-          else if (hashCode == Removing_HASH)
-          {
-            return IpRouteStatusMsg::Removing;
-          }
-          else if (hashCode == Removed_HASH)
-          {
-            return IpRouteStatusMsg::Removed;
-          }
-          else if (hashCode == AddFailed_HASH)
-          {
-            return IpRouteStatusMsg::AddFailed;
-          }
-          else if (hashCode == RemoveFailed_HASH)
-          {
-            return IpRouteStatusMsg::RemoveFailed;
+          case Adding_HASH:
+            if (name == "Adding")
+            {
+              return IpRouteStatusMsg::Adding;
+            }
+            break;
+          case Added_HASH:
+            if (name == "Added")
+            {
+              return IpRouteStatusMsg::Added;
+            }
+            break;
+          case Removing_HASH:
+            if (name == "Removing")
+            {
+              return IpRouteStatusMsg::Removing;
+            }
+            break;
+          case Removed_HASH:
+            if (name == "Removed")
+            {
+              return IpRouteStatusMsg::Removed;
+            }
+            break;
+          case AddFailed_HASH:
+            if (name == "AddFailed")
+            {
+              return IpRouteStatusMsg::AddFailed;
+            }
+            break;
+          case RemoveFailed_HASH:
+            if (name == "RemoveFailed")
+            {
+              return IpRouteStatusMsg::RemoveFailed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return IpRouteStatusMsg::NOT_SET;
         }
 
-        Aws::String GetNameForIpRouteStatusMsg(IpRouteStatusMsg enumValue)
+        const char* GetNameForIpRouteStatusMsg(IpRouteStatusMsg enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace RadiusAuthenticationProtocolMapper
       {
 
-        static const int PAP_HASH = HashingUtils::HashString("PAP");
-        static const int CHAP_HASH = HashingUtils::HashString("CHAP");
-        static const int MS_CHAPv1_HASH = HashingUtils::HashString("MS-CHAPv1");
-        static const int MS_CHAPv2_HASH = HashingUtils::HashString("MS-CHAPv2");
+        static constexpr int PAP_HASH = HashingUtils::CompileTimeHashString("PAP");
+        static constexpr int CHAP_HASH = HashingUtils::CompileTimeHashString("CHAP");
+        static constexpr int MS_CHAPv1_HASH = HashingUtils::CompileTimeHashString("MS-CHAPv1");
+        static constexpr int MS_CHAPv2_HASH = HashingUtils::CompileTimeHashString("MS-CHAPv2");
 
 
         RadiusAuthenticationProtocol GetRadiusAuthenticationProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PAP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RadiusAuthenticationProtocol::PAP;
-          }
-          else if (hashCode == CHAP_HASH)
-          {
-            return RadiusAuthenticationProtocol::CHAP;
-          }
-          else if (hashCode == MS_CHAPv1_HASH)
-          {
-            return RadiusAuthenticationProtocol::MS_CHAPv1;
-          }
-          else if (hashCode == MS_CHAPv2_HASH)
-          {
-            return RadiusAuthenticationProtocol::MS_CHAPv2;
+          case PAP_HASH:
+            if (name == "PAP")
+            {
+              return RadiusAuthenticationProtocol::PAP;
+            }
+            break;
+          case CHAP_HASH:
+            if (name == "CHAP")
+            {
+              return RadiusAuthenticationProtocol::CHAP;
+            }
+            break;
+          case MS_CHAPv1_HASH:
+            if (name == "MS-CHAPv1")
+            {
+              return RadiusAuthenticationProtocol::MS_CHAPv1;
+            }
+            break;
+          case MS_CHAPv2_HASH:
+            if (name == "MS-CHAPv2")
+            {
+              return RadiusAuthenticationProtocol::MS_CHAPv2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return RadiusAuthenticationProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForRadiusAuthenticationProtocol(RadiusAuthenticationProtocol enumValue)
+        const char* GetNameForRadiusAuthenticationProtocol(RadiusAuthenticationProtocol enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace RadiusStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Creating_HASH = HashingUtils::CompileTimeHashString("Creating");
+        static constexpr int Completed_HASH = HashingUtils::CompileTimeHashString("Completed");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         RadiusStatus GetRadiusStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RadiusStatus::Creating;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return RadiusStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return RadiusStatus::Failed;
+          case Creating_HASH:
+            if (name == "Creating")
+            {
+              return RadiusStatus::Creating;
+            }
+            break;
+          case Completed_HASH:
+            if (name == "Completed")
+            {
+              return RadiusStatus::Completed;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return RadiusStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RadiusStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRadiusStatus(RadiusStatus enumValue)
+        const char* GetNameForRadiusStatus(RadiusStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ReplicationScopeMapper
       {
 
-        static const int Domain_HASH = HashingUtils::HashString("Domain");
+        static constexpr int Domain_HASH = HashingUtils::CompileTimeHashString("Domain");
 
 
         ReplicationScope GetReplicationScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Domain_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReplicationScope::Domain;
+          case Domain_HASH:
+            if (name == "Domain")
+            {
+              return ReplicationScope::Domain;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ReplicationScope::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationScope(ReplicationScope enumValue)
+        const char* GetNameForReplicationScope(ReplicationScope enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,55 +30,79 @@ namespace Aws
       namespace SchemaExtensionStatusMapper
       {
 
-        static const int Initializing_HASH = HashingUtils::HashString("Initializing");
-        static const int CreatingSnapshot_HASH = HashingUtils::HashString("CreatingSnapshot");
-        static const int UpdatingSchema_HASH = HashingUtils::HashString("UpdatingSchema");
-        static const int Replicating_HASH = HashingUtils::HashString("Replicating");
-        static const int CancelInProgress_HASH = HashingUtils::HashString("CancelInProgress");
-        static const int RollbackInProgress_HASH = HashingUtils::HashString("RollbackInProgress");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
+        static constexpr int Initializing_HASH = HashingUtils::CompileTimeHashString("Initializing");
+        static constexpr int CreatingSnapshot_HASH = HashingUtils::CompileTimeHashString("CreatingSnapshot");
+        static constexpr int UpdatingSchema_HASH = HashingUtils::CompileTimeHashString("UpdatingSchema");
+        static constexpr int Replicating_HASH = HashingUtils::CompileTimeHashString("Replicating");
+        static constexpr int CancelInProgress_HASH = HashingUtils::CompileTimeHashString("CancelInProgress");
+        static constexpr int RollbackInProgress_HASH = HashingUtils::CompileTimeHashString("RollbackInProgress");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Completed_HASH = HashingUtils::CompileTimeHashString("Completed");
 
 
         SchemaExtensionStatus GetSchemaExtensionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Initializing_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SchemaExtensionStatus::Initializing;
-          }
-          else if (hashCode == CreatingSnapshot_HASH)
-          {
-            return SchemaExtensionStatus::CreatingSnapshot;
-          }
-          else if (hashCode == UpdatingSchema_HASH)
-          {
-            return SchemaExtensionStatus::UpdatingSchema;
-          }
-          else if (hashCode == Replicating_HASH)
-          {
-            return SchemaExtensionStatus::Replicating;
-          }
-          else if (hashCode == CancelInProgress_HASH)
-          {
-            return SchemaExtensionStatus::CancelInProgress;
-          }
-          else if (hashCode == RollbackInProgress_HASH)
-          {
-            return SchemaExtensionStatus::RollbackInProgress;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return SchemaExtensionStatus::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return SchemaExtensionStatus::Failed;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return SchemaExtensionStatus::Completed;
+          case Initializing_HASH:
+            if (name == "Initializing")
+            {
+              return SchemaExtensionStatus::Initializing;
+            }
+            break;
+          case CreatingSnapshot_HASH:
+            if (name == "CreatingSnapshot")
+            {
+              return SchemaExtensionStatus::CreatingSnapshot;
+            }
+            break;
+          case UpdatingSchema_HASH:
+            if (name == "UpdatingSchema")
+            {
+              return SchemaExtensionStatus::UpdatingSchema;
+            }
+            break;
+          case Replicating_HASH:
+            if (name == "Replicating")
+            {
+              return SchemaExtensionStatus::Replicating;
+            }
+            break;
+          case CancelInProgress_HASH:
+            if (name == "CancelInProgress")
+            {
+              return SchemaExtensionStatus::CancelInProgress;
+            }
+            break;
+          case RollbackInProgress_HASH:
+            if (name == "RollbackInProgress")
+            {
+              return SchemaExtensionStatus::RollbackInProgress;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return SchemaExtensionStatus::Cancelled;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return SchemaExtensionStatus::Failed;
+            }
+            break;
+          case Completed_HASH:
+            if (name == "Completed")
+            {
+              return SchemaExtensionStatus::Completed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return SchemaExtensionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSchemaExtensionStatus(SchemaExtensionStatus enumValue)
+        const char* GetNameForSchemaExtensionStatus(SchemaExtensionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SnapshotTypeMapper
       {
 
-        static const int Auto_HASH = HashingUtils::HashString("Auto");
-        static const int Manual_HASH = HashingUtils::HashString("Manual");
+        static constexpr int Auto_HASH = HashingUtils::CompileTimeHashString("Auto");
+        static constexpr int Manual_HASH = HashingUtils::CompileTimeHashString("Manual");
 
 
         SnapshotType GetSnapshotTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Auto_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SnapshotType::Auto;
-          }
-          else if (hashCode == Manual_HASH)
-          {
-            return SnapshotType::Manual;
+          case Auto_HASH:
+            if (name == "Auto")
+            {
+              return SnapshotType::Auto;
+            }
+            break;
+          case Manual_HASH:
+            if (name == "Manual")
+            {
+              return SnapshotType::Manual;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SnapshotType::NOT_SET;
         }
 
-        Aws::String GetNameForSnapshotType(SnapshotType enumValue)
+        const char* GetNameForSnapshotType(SnapshotType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
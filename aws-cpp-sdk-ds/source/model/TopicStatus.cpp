@@ -30,30 +30,44 @@ namespace Aws
       namespace TopicStatusMapper
       {
 
-        static const int Registered_HASH = HashingUtils::HashString("Registered");
-        static const int Topic_not_found_HASH = HashingUtils::HashString("Topic not found");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
+        static constexpr int Registered_HASH = HashingUtils::CompileTimeHashString("Registered");
+        static constexpr int Topic_not_found_HASH = HashingUtils::CompileTimeHashString("Topic not found");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Deleted_HASH = HashingUtils::CompileTimeHashString("Deleted");
 
 
         TopicStatus GetTopicStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Registered_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TopicStatus::Registered;
-          }
-          else if (hashCode == Topic_not_found_HASH)
-          {
-            return TopicStatus::Topic_not_found;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return TopicStatus::Failed;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return TopicStatus::Deleted;
+          case Registered_HASH:
+            if (name == "Registered")
+            {
+              return TopicStatus::Registered;
+            }
+            break;
+          case Topic_not_found_HASH:
+            if (name == "Topic not found")
+            {
+              return TopicStatus::Topic_not_found;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return TopicStatus::Failed;
+            }
+            break;
+          case Deleted_HASH:
+            if (name == "Deleted")
+            {
+              return TopicStatus::Deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return TopicStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTopicStatus(TopicStatus enumValue)
+        const char* GetNameForTopicStatus(TopicStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace TrustDirectionMapper
       {
 
-        static const int One_Way_Outgoing_HASH = HashingUtils::HashString("One-Way: Outgoing");
-        static const int One_Way_Incoming_HASH = HashingUtils::HashString("One-Way: Incoming");
-        static const int Two_Way_HASH = HashingUtils::HashString("Two-Way");
+        static constexpr int One_Way_Outgoing_HASH = HashingUtils::CompileTimeHashString("One-Way: Outgoing");
+        static constexpr int One_Way_Incoming_HASH = HashingUtils::CompileTimeHashString("One-Way: Incoming");
+        static constexpr int Two_Way_HASH = HashingUtils::CompileTimeHashString("Two-Way");
 
 
         TrustDirection GetTrustDirectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == One_Way_Outgoing_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TrustDirection::One_Way_Outgoing;
-          }
-          else if (hashCode == One_Way_Incoming_HASH)
-          {
-            return TrustDirection::One_Way_Incoming;
-          }
-          else if (hashCode == Two_Way_HASH)
-          {
-            return TrustDirection::Two_Way;
+          case One_Way_Outgoing_HASH:
+            if (name == "One-Way: Outgoing")
+            {
+              return TrustDirection::One_Way_Outgoing;
+            }
+            break;
+          case One_Way_Incoming_HASH:
+            if (name == "One-Way: Incoming")
+            {
+              return TrustDirection::One_Way_Incoming;
+            }
+            break;
+          case Two_Way_HASH:
+            if (name == "Two-Way")
+            {
+              return TrustDirection::Two_Way;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TrustDirection::NOT_SET;
         }
 
-        Aws::String GetNameForTrustDirection(TrustDirection enumValue)
+        const char* GetNameForTrustDirection(TrustDirection enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
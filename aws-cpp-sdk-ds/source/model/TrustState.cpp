@@ -30,50 +30,72 @@ namespace Aws
       namespace TrustStateMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Created_HASH = HashingUtils::HashString("Created");
-        static const int Verifying_HASH = HashingUtils::HashString("Verifying");
-        static const int VerifyFailed_HASH = HashingUtils::HashString("VerifyFailed");
-        static const int Verified_HASH = HashingUtils::HashString("Verified");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Creating_HASH = HashingUtils::CompileTimeHashString("Creating");
+        static constexpr int Created_HASH = HashingUtils::CompileTimeHashString("Created");
+        static constexpr int Verifying_HASH = HashingUtils::CompileTimeHashString("Verifying");
+        static constexpr int VerifyFailed_HASH = HashingUtils::CompileTimeHashString("VerifyFailed");
+        static constexpr int Verified_HASH = HashingUtils::CompileTimeHashString("Verified");
+        static constexpr int Deleting_HASH = HashingUtils::CompileTimeHashString("Deleting");
+        static constexpr int Deleted_HASH = HashingUtils::CompileTimeHashString("Deleted");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         TrustState GetTrustStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TrustState::Creating;
-          }
-          else if (hashCode == Created_HASH)
-          {
-            return TrustState::Created;
-          }
-          else if (hashCode == Verifying_HASH)
-          {
-            return TrustState::Verifying;
-          }
-          else if (hashCode == VerifyFailed_HASH)
-          {
-            return TrustState::VerifyFailed;
-          }
-          else if (hashCode == Verified_HASH)
-          {
-            return TrustState::Verified;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return TrustState::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return TrustState::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return TrustState::Failed;
+          case Creating_HASH:
+            if (name == "Creating")
+            {
+              return TrustState::Creating;
+            }
+            break;
+          case Created_HASH:
+            if (name == "Created")
+            {
+              return TrustState::Created;
+            }
+            break;
+          case Verifying_HASH:
+            if (name == "Verifying")
+            {
+              return TrustState::Verifying;
+            }
+            break;
+          case VerifyFailed_HASH:
+            if (name == "VerifyFailed")
+            {
+              return TrustState::VerifyFailed;
+            }
+            break;
+          case Verified_HASH:
+            if (name == "Verified")
+            {
+              return TrustState::Verified;
+            }
+            break;
+          case Deleting_HASH:
+            if (name == "Deleting")
+            {
+              return TrustState::Deleting;
+            }
+            break;
+          case Deleted_HASH:
+            if (name == "Deleted")
+            {
+              return TrustState::Deleted;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return TrustState::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return TrustState::NOT_SET;
         }
 
-        Aws::String GetNameForTrustState(TrustState enumValue)
+        const char* GetNameForTrustState(TrustState enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
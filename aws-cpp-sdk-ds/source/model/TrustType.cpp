@@ -30,15 +30,23 @@ namespace Aws
       namespace TrustTypeMapper
       {
 
-        static const int Forest_HASH = HashingUtils::HashString("Forest");
+        static constexpr int Forest_HASH = HashingUtils::CompileTimeHashString("Forest");
 
 
         TrustType GetTrustTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Forest_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TrustType::Forest;
+          case Forest_HASH:
+            if (name == "Forest")
+            {
+              return TrustType::Forest;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return TrustType::NOT_SET;
         }
 
-        Aws::String GetNameForTrustType(TrustType enumValue)
+        const char* GetNameForTrustType(TrustType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
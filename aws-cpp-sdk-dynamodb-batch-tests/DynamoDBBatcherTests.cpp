@@ -0,0 +1,596 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/dynamodb-batch/DynamoDBBatcher.h>
+#include <aws/dynamodb/model/BatchGetItemRequest.h>
+#include <aws/dynamodb/model/BatchGetItemResult.h>
+#include <aws/dynamodb/model/BatchWriteItemRequest.h>
+#include <aws/dynamodb/model/BatchWriteItemResult.h>
+#include <aws/dynamodb/model/ConsumedCapacity.h>
+#include <aws/dynamodb/model/DescribeTableRequest.h>
+#include <aws/dynamodb/model/DescribeTableResult.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/testing/BatchingClientTest.h>
+
+#include <thread>
+
+using namespace Aws::DynamoDBBatch;
+using namespace Aws::DynamoDB;
+using namespace Aws::DynamoDB::Model;
+using namespace Aws::Utils;
+
+static const char* KEY_NAME = "id";
+
+/**
+ * DynamoDB client keeping the items of its tables in memory, keyed by the string attribute "id". It leaves the first half of
+ * the entries of a request unprocessed while told to, all of them if told so, and fails requests when told to. Like DynamoDB,
+ * it rejects requests naming a key twice. DescribeTable is throttled as often as told to, and fails for good if told so.
+ */
+class MockDynamoDBClient : public Aws::Testing::MockServiceClient<DynamoDBClient>
+{
+public:
+    MockDynamoDBClient() : m_unprocessedRequests(0), m_leaveAllUnprocessed(false), m_failAll(false), m_requestDelay(0), m_inFlight(0), m_maxInFlight(0) {}
+
+    DescribeTableOutcome DescribeTable(const DescribeTableRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_describedTables.push_back(request.GetTableName());
+        if (m_describeTableNotFound)
+        {
+            return Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::RESOURCE_NOT_FOUND, "ResourceNotFoundException", "Requested resource not found.", false);
+        }
+        if (m_describeTableThrottles > 0)
+        {
+            --m_describeTableThrottles;
+            return Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::THROTTLING, "ThrottlingException", "Rate exceeded.", true);
+        }
+        DescribeTableResult result;
+        result.SetTable(TableDescription().WithTableName(request.GetTableName()).AddKeySchema(KeySchemaElement().WithAttributeName(KEY_NAME).WithKeyType(KeyType::HASH)));
+        return result;
+    }
+
+    BatchWriteItemOutcome BatchWriteItem(const BatchWriteItemRequest& request) const override
+    {
+        bool leaveUnprocessed = StartRequest();
+        std::this_thread::sleep_for(m_requestDelay);
+        std::lock_guard<std::mutex> locker(m_lock);
+        --m_inFlight;
+        m_writeRequests.push_back(request);
+        if (m_failAll)
+        {
+            return Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::VALIDATION, "ValidationException", "Bad request.", false);
+        }
+        for (const auto& table : request.GetRequestItems())
+        {
+            Aws::Vector<AttributeMap> keys;
+            for (const auto& writeRequest : table.second)
+            {
+                const auto& item = writeRequest.GetPutRequest().GetItem();
+                keys.push_back(item.empty() ? writeRequest.GetDeleteRequest().GetKey() : item);
+            }
+            if (HasDuplicateKeys(keys))
+            {
+                ++m_duplicateKeyRequests;
+                return Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::VALIDATION, "ValidationException", "Provided list of item keys contains duplicates", false);
+            }
+        }
+
+        BatchWriteItemResult result;
+        Aws::Map<Aws::String, Aws::Vector<WriteRequest>> unprocessedItems;
+        for (const auto& table : request.GetRequestItems())
+        {
+            size_t unprocessed = leaveUnprocessed ? (m_leaveAllUnprocessed ? table.second.size() : table.second.size() / 2) : 0;
+            for (size_t i = 0; i < table.second.size(); ++i)
+            {
+                const auto& writeRequest = table.second[i];
+                if (i < unprocessed)
+                {
+                    unprocessedItems[table.first].push_back(writeRequest);
+                    continue;
+                }
+
+                const auto& item = writeRequest.GetPutRequest().GetItem();
+                if (item.empty())
+                {
+                    m_tables[table.first].erase(writeRequest.GetDeleteRequest().GetKey().at(KEY_NAME).GetS());
+                }
+                else
+                {
+                    m_tables[table.first][item.at(KEY_NAME).GetS()] = item;
+                }
+            }
+            result.AddConsumedCapacity(ConsumedCapacity().WithTableName(table.first).WithCapacityUnits(static_cast<double>(table.second.size() - unprocessed)));
+        }
+        result.SetUnprocessedItems(unprocessedItems);
+        return BatchWriteItemOutcome(result);
+    }
+
+    BatchGetItemOutcome BatchGetItem(const BatchGetItemRequest& request) const override
+    {
+        bool leaveUnprocessed = StartRequest();
+        std::this_thread::sleep_for(m_requestDelay);
+        std::lock_guard<std::mutex> locker(m_lock);
+        --m_inFlight;
+        m_getRequests.push_back(request);
+        if (m_failAll)
+        {
+            return Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::VALIDATION, "ValidationException", "Bad request.", false);
+        }
+        for (const auto& table : request.GetRequestItems())
+        {
+            if (HasDuplicateKeys(table.second.GetKeys()))
+            {
+                ++m_duplicateKeyRequests;
+                return Aws::Client::AWSError<DynamoDBErrors>(DynamoDBErrors::VALIDATION, "ValidationException", "Provided list of item keys contains duplicates", false);
+            }
+        }
+
+        BatchGetItemResult result;
+        for (const auto& table : request.GetRequestItems())
+        {
+            const auto& keys = table.second.GetKeys();
+            size_t unprocessed = leaveUnprocessed ? (m_leaveAllUnprocessed ? keys.size() : keys.size() / 2) : 0;
+            KeysAndAttributes unprocessedKeys;
+            Aws::Vector<AttributeMap> items;
+            for (size_t i = 0; i < keys.size(); ++i)
+            {
+                if (i < unprocessed)
+                {
+                    unprocessedKeys.AddKeys(keys[i]);
+                    continue;
+                }
+
+                auto item = m_tables[table.first].find(keys[i].at(KEY_NAME).GetS());
+                if (item != m_tables[table.first].end())
+                {
+                    items.push_back(item->second);
+                }
+            }
+            result.AddResponses(table.first, items);
+            if (unprocessed > 0)
+            {
+                result.AddUnprocessedKeys(table.first, unprocessedKeys);
+            }
+            result.AddConsumedCapacity(ConsumedCapacity().WithTableName(table.first).WithCapacityUnits(0.5 * (keys.size() - unprocessed)));
+        }
+        return BatchGetItemOutcome(result);
+    }
+
+    Aws::Vector<BatchWriteItemRequest> GetWriteRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_writeRequests;
+    }
+
+    Aws::Vector<BatchGetItemRequest> GetGetRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_getRequests;
+    }
+
+    Aws::Vector<Aws::String> GetDescribedTables() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_describedTables;
+    }
+
+    size_t GetMaxInFlight() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_maxInFlight;
+    }
+
+    mutable Aws::Map<Aws::String, Aws::Map<Aws::String, AttributeMap>> m_tables;
+    mutable size_t m_unprocessedRequests;
+    bool m_leaveAllUnprocessed;
+    bool m_failAll;
+    std::chrono::milliseconds m_requestDelay;
+    mutable size_t m_duplicateKeyRequests = 0;
+    mutable size_t m_describeTableThrottles = 0;
+    bool m_describeTableNotFound = false;
+
+private:
+    static bool HasDuplicateKeys(const Aws::Vector<AttributeMap>& keys)
+    {
+        Aws::Set<Aws::String> ids;
+        for (const auto& key : keys)
+        {
+            if (!ids.insert(key.at(KEY_NAME).GetS()).second)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool StartRequest() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_maxInFlight = (std::max)(m_maxInFlight, ++m_inFlight);
+        if (m_unprocessedRequests == 0)
+        {
+            return false;
+        }
+        --m_unprocessedRequests;
+        return true;
+    }
+
+    mutable Aws::Vector<BatchWriteItemRequest> m_writeRequests;
+    mutable Aws::Vector<BatchGetItemRequest> m_getRequests;
+    mutable Aws::Vector<Aws::String> m_describedTables;
+    mutable size_t m_inFlight;
+    mutable size_t m_maxInFlight;
+};
+
+class DynamoDBBatcherTest : public Aws::Testing::BatchingClientTest<MockDynamoDBClient, EntryResult>
+{
+protected:
+    void SetUp() override
+    {
+        BatchingClientTest::SetUp();
+        m_configuration.dynamoDBClient = m_client;
+        m_configuration.retryBaseDelay = std::chrono::milliseconds(5);
+        m_configuration.entryCompletedCallback = [this](const DynamoDBBatcher*, const EntryResult& result) { AddResult(result); };
+    }
+
+    void TearDown() override
+    {
+        m_configuration = DynamoDBBatcherConfiguration();
+        BatchingClientTest::TearDown();
+    }
+
+    static AttributeMap MakeKey(const Aws::String& id)
+    {
+        AttributeMap key;
+        key[KEY_NAME] = AttributeValue(id);
+        return key;
+    }
+
+    static AttributeMap MakeItem(const Aws::String& id, const Aws::String& value)
+    {
+        AttributeMap item = MakeKey(id);
+        item["value"] = AttributeValue(value);
+        return item;
+    }
+
+    DynamoDBBatcherConfiguration m_configuration;
+};
+
+TEST_F(DynamoDBBatcherTest, TestPacksWritesOfAllTablesIntoFullRequests)
+{
+    m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+    m_client->m_requestDelay = std::chrono::milliseconds(50);
+    m_client->m_tables["Orders"]["order-gone"] = MakeItem("order-gone", "old");
+    {
+        DynamoDBBatcher batcher(m_configuration);
+        for (size_t i = 0; i < 99; ++i)
+        {
+            Aws::String id = StringUtils::to_string(i);
+            ASSERT_TRUE(batcher.Put(i % 3 == 0 ? "Orders" : "Customers", MakeItem(id, "value" + id)));
+        }
+        ASSERT_TRUE(batcher.Delete("Orders", MakeKey("order-gone")));
+
+        // full requests go out without waiting for maxBufferedTime, the last one with FlushAndWait()
+        batcher.FlushAndWait();
+        auto metrics = batcher.GetMetrics();
+        ASSERT_EQ(100u, metrics.entriesSucceeded);
+        ASSERT_EQ(0u, metrics.entriesBuffered);
+        ASSERT_EQ(4u, metrics.writeRequestsSent);
+        ASSERT_EQ(100, metrics.writeCapacityUnits);
+        ASSERT_EQ(34, metrics.writeCapacityUnitsByTable["Orders"]);
+        ASSERT_EQ(66, metrics.writeCapacityUnitsByTable["Customers"]);
+    }
+
+    for (const auto& request : m_client->GetWriteRequests())
+    {
+        size_t writes = 0;
+        for (const auto& table : request.GetRequestItems())
+        {
+            writes += table.second.size();
+        }
+        ASSERT_EQ(25u, writes);
+        ASSERT_EQ(2u, request.GetRequestItems().size());
+        ASSERT_EQ(ReturnConsumedCapacity::TOTAL, request.GetReturnConsumedCapacity());
+    }
+    ASSERT_LT(1u, m_client->GetMaxInFlight());
+    ASSERT_EQ(2u, m_client->GetDescribedTables().size());
+
+    ASSERT_EQ(33u, m_client->m_tables["Orders"].size());
+    ASSERT_EQ(66u, m_client->m_tables["Customers"].size());
+    ASSERT_EQ("value98", m_client->m_tables["Customers"]["98"].at("value").GetS());
+
+    auto results = GetResults();
+    ASSERT_EQ(100u, results.size());
+    for (const auto& result : results)
+    {
+        ASSERT_TRUE(result.successful);
+        ASSERT_EQ(1u, result.attempts);
+        if (result.operation == BatchOperation::Delete)
+        {
+            ASSERT_EQ("order-gone", result.attributes.at(KEY_NAME).GetS());
+        }
+    }
+}
+
+TEST_F(DynamoDBBatcherTest, TestRetriesUnprocessedItems)
+{
+    m_client->m_unprocessedRequests = 3;
+    m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+    m_configuration.maxRequestsInFlight = 1;
+    DynamoDBBatcher batcher(m_configuration);
+    for (size_t i = 0; i < 20; ++i)
+    {
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem(StringUtils::to_string(i), "value")));
+    }
+    batcher.FlushAndWait();
+
+    auto metrics = batcher.GetMetrics();
+    ASSERT_EQ(20u, metrics.entriesSucceeded);
+    ASSERT_EQ(0u, metrics.entriesFailed);
+    // half of the first request, then of whatever the retries were sent in
+    ASSERT_LE(10u, metrics.entriesUnprocessed);
+    ASSERT_EQ(metrics.entriesUnprocessed, metrics.entriesRetried);
+    ASSERT_EQ(20, metrics.writeCapacityUnits);
+    ASSERT_EQ(20u, m_client->m_tables["Orders"].size());
+
+    size_t retried = 0;
+    for (const auto& result : GetResults())
+    {
+        ASSERT_TRUE(result.successful);
+        retried += result.attempts > 1 ? 1 : 0;
+    }
+    ASSERT_EQ(10u, retried);
+}
+
+TEST_F(DynamoDBBatcherTest, TestGetsFindItemsByKeyAndRetryUnprocessedKeys)
+{
+    for (size_t i = 0; i < 150; i += 2)
+    {
+        Aws::String id = StringUtils::to_string(i);
+        m_client->m_tables["Orders"][id] = MakeItem(id, "value" + id);
+    }
+    m_client->m_unprocessedRequests = 1;
+    m_configuration.consistentRead = true;
+    m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+    m_configuration.maxRequestsInFlight = 1;
+
+    DynamoDBBatcher batcher(m_configuration);
+    for (size_t i = 0; i < 150; ++i)
+    {
+        ASSERT_TRUE(batcher.Get("Orders", MakeKey(StringUtils::to_string(i))));
+    }
+    batcher.FlushAndWait();
+
+    auto results = GetResults();
+    ASSERT_EQ(150u, results.size());
+    for (const auto& result : results)
+    {
+        ASSERT_TRUE(result.successful);
+        ASSERT_EQ(BatchOperation::Get, result.operation);
+        const auto& id = result.attributes.at(KEY_NAME).GetS();
+        if (StringUtils::ConvertToInt32(id.c_str()) % 2 == 0)
+        {
+            ASSERT_EQ("value" + id, result.item.at("value").GetS());
+        }
+        else
+        {
+            ASSERT_TRUE(result.item.empty());
+        }
+    }
+
+    auto requests = m_client->GetGetRequests();
+    ASSERT_LE(2u, requests.size());
+    for (const auto& request : requests)
+    {
+        ASSERT_GE(100u, request.GetRequestItems().at("Orders").GetKeys().size());
+        ASSERT_TRUE(request.GetRequestItems().at("Orders").GetConsistentRead());
+    }
+
+    auto metrics = batcher.GetMetrics();
+    ASSERT_EQ(50u, metrics.entriesUnprocessed);
+    ASSERT_EQ(75, metrics.readCapacityUnits);
+    ASSERT_EQ(75, metrics.readCapacityUnitsByTable["Orders"]);
+}
+
+TEST_F(DynamoDBBatcherTest, TestKeepsIdenticalEntriesInSeparateRequests)
+{
+    m_client->m_tables["Orders"]["1"] = MakeItem("1", "value");
+    m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+    DynamoDBBatcher batcher(m_configuration);
+    for (size_t i = 0; i < 3; ++i)
+    {
+        ASSERT_TRUE(batcher.Get("Orders", MakeKey("1")));
+    }
+    ASSERT_TRUE(batcher.Get("Orders", MakeKey("2")));
+    batcher.FlushAndWait();
+
+    auto requests = m_client->GetGetRequests();
+    ASSERT_EQ(3u, requests.size());
+    size_t keys = 0;
+    for (const auto& request : requests)
+    {
+        keys += request.GetRequestItems().at("Orders").GetKeys().size();
+    }
+    ASSERT_EQ(4u, keys);
+
+    size_t found = 0;
+    for (const auto& result : GetResults())
+    {
+        found += result.item.empty() ? 0 : 1;
+    }
+    ASSERT_EQ(3u, found);
+}
+
+TEST_F(DynamoDBBatcherTest, TestKeepsPutsOfTheSameItemInSeparateRequests)
+{
+    m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+    m_configuration.maxRequestsInFlight = 1;
+    DynamoDBBatcher batcher(m_configuration);
+    ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "value")));
+    ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "value")));
+    ASSERT_TRUE(batcher.Put("Customers", MakeItem("1", "value")));
+    batcher.FlushAndWait();
+
+    // the same key in another table is another item
+    auto requests = m_client->GetWriteRequests();
+    ASSERT_EQ(2u, requests.size());
+    ASSERT_EQ(2u, requests[0].GetRequestItems().size());
+    ASSERT_EQ(0u, m_client->m_duplicateKeyRequests);
+    ASSERT_EQ(3u, batcher.GetMetrics().entriesSucceeded);
+}
+
+TEST_F(DynamoDBBatcherTest, TestHoldsEntriesWhileDescribeTableIsRetried)
+{
+    m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+    m_client->m_describeTableThrottles = 2;
+    {
+        DynamoDBBatcher batcher(m_configuration);
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "first")));
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "second")));
+        batcher.FlushAndWait();
+        ASSERT_EQ(2u, batcher.GetMetrics().entriesSucceeded);
+    }
+
+    // once the key schema is known the puts are of the same item, and are sent one after the other
+    Aws::Vector<Aws::String> expected = { "Orders", "Orders", "Orders" };
+    ASSERT_EQ(expected, m_client->GetDescribedTables());
+    ASSERT_EQ(2u, m_client->GetWriteRequests().size());
+    ASSERT_EQ(0u, m_client->m_duplicateKeyRequests);
+    ASSERT_EQ("second", m_client->m_tables["Orders"]["1"].at("value").GetS());
+}
+
+TEST_F(DynamoDBBatcherTest, TestTellsEntriesApartByAllAttributesOfTablesThatCantBeDescribed)
+{
+    m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+    m_client->m_describeTableNotFound = true;
+    {
+        DynamoDBBatcher batcher(m_configuration);
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "value")));
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("2", "value")));
+        batcher.FlushAndWait();
+        ASSERT_EQ(2u, batcher.GetMetrics().entriesSucceeded);
+    }
+
+    ASSERT_EQ(1u, m_client->GetDescribedTables().size());
+    ASSERT_EQ(1u, m_client->GetWriteRequests().size());
+}
+
+TEST_F(DynamoDBBatcherTest, TestAppliesWritesToTheSameKeyInOrder)
+{
+    m_configuration.keyAttributeNames["Orders"] = { KEY_NAME };
+    m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+    m_client->m_requestDelay = std::chrono::milliseconds(20);
+    m_client->m_unprocessedRequests = 1;
+    {
+        DynamoDBBatcher batcher(m_configuration);
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "first")));
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("2", "other")));
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "second")));
+        ASSERT_TRUE(batcher.Delete("Orders", MakeKey("1")));
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "third")));
+        batcher.FlushAndWait();
+        ASSERT_EQ(5u, batcher.GetMetrics().entriesSucceeded);
+        ASSERT_EQ(0u, batcher.GetMetrics().entriesFailed);
+    }
+
+    // the first write of each request is left unprocessed the first time, the later writes to its key wait for its retry
+    ASSERT_EQ(0u, m_client->m_duplicateKeyRequests);
+    ASSERT_TRUE(m_client->GetDescribedTables().empty());
+    Aws::Vector<Aws::String> writesOfFirstKey;
+    for (const auto& request : m_client->GetWriteRequests())
+    {
+        for (const auto& writeRequest : request.GetRequestItems().at("Orders"))
+        {
+            const auto& item = writeRequest.GetPutRequest().GetItem();
+            if (item.empty())
+            {
+                writesOfFirstKey.push_back("delete");
+            }
+            else if (item.at(KEY_NAME).GetS() == "1")
+            {
+                writesOfFirstKey.push_back(item.at("value").GetS());
+            }
+        }
+    }
+    Aws::Vector<Aws::String> expected = { "first", "first", "second", "delete", "third" };
+    ASSERT_EQ(expected, writesOfFirstKey);
+    ASSERT_EQ("third", m_client->m_tables["Orders"]["1"].at("value").GetS());
+    ASSERT_EQ("other", m_client->m_tables["Orders"]["2"].at("value").GetS());
+}
+
+TEST_F(DynamoDBBatcherTest, TestFailsEntriesLeftUnprocessedAfterMaxRetries)
+{
+    m_client->m_unprocessedRequests = 100;
+    m_client->m_leaveAllUnprocessed = true;
+    m_configuration.maxRetries = 2;
+    {
+        DynamoDBBatcher batcher(m_configuration);
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "value")));
+        ASSERT_TRUE(batcher.Get("Orders", MakeKey("2")));
+        batcher.FlushAndWait();
+
+        auto metrics = batcher.GetMetrics();
+        ASSERT_EQ(6u, metrics.entriesUnprocessed);
+        ASSERT_EQ(4u, metrics.entriesRetried);
+        ASSERT_EQ(2u, metrics.entriesFailed);
+    }
+
+    ASSERT_EQ(3u, m_client->GetWriteRequests().size());
+    ASSERT_EQ(3u, m_client->GetGetRequests().size());
+    ASSERT_TRUE(m_client->m_tables["Orders"].empty());
+
+    auto results = GetResults();
+    ASSERT_EQ(2u, results.size());
+    for (const auto& result : results)
+    {
+        ASSERT_FALSE(result.successful);
+        ASSERT_EQ(3u, result.attempts);
+        ASSERT_EQ(result.operation == BatchOperation::Get ? "UnprocessedKeys" : "UnprocessedItems", result.errorCode);
+    }
+}
+
+TEST_F(DynamoDBBatcherTest, TestFailsEntriesOnErrorsNotWorthRetrying)
+{
+    m_client->m_failAll = true;
+    {
+        DynamoDBBatcher batcher(m_configuration);
+        ASSERT_TRUE(batcher.Put("Orders", MakeItem("1", "value")));
+        ASSERT_TRUE(batcher.Get("Orders", MakeKey("1")));
+    }
+
+    auto results = GetResults();
+    ASSERT_EQ(2u, results.size());
+    for (const auto& result : results)
+    {
+        ASSERT_FALSE(result.successful);
+        ASSERT_EQ(1u, result.attempts);
+        ASSERT_EQ("ValidationException", result.errorCode);
+        ASSERT_EQ("1", result.attributes.at(KEY_NAME).GetS());
+    }
+}
+
+TEST_F(DynamoDBBatcherTest, TestRejectsInvalidEntries)
+{
+    DynamoDBBatcher batcher(m_configuration);
+    ASSERT_FALSE(batcher.Put("", MakeItem("1", "value")));
+    ASSERT_FALSE(batcher.Delete("Orders", AttributeMap()));
+    ASSERT_FALSE(batcher.Get("Orders", AttributeMap()));
+    batcher.FlushAndWait();
+    ASSERT_EQ(0u, batcher.GetMetrics().entriesPut);
+    ASSERT_TRUE(GetResults().empty());
+}
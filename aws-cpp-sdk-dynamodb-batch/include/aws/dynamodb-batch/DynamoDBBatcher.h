@@ -0,0 +1,256 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/dynamodb-batch/DynamoDBBatch_EXPORTS.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/dynamodb/model/AttributeValue.h>
+#include <aws/dynamodb/model/ReturnConsumedCapacity.h>
+#include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/BatchingLoop.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace Aws
+{
+    namespace DynamoDBBatch
+    {
+        class DynamoDBBatcher;
+        struct BatchEntry;
+        struct BatchContext;
+        struct EntryQueue;
+
+        enum class BatchOperation
+        {
+            Put,
+            Delete,
+            Get
+        };
+
+        typedef Aws::Map<Aws::String, Aws::DynamoDB::Model::AttributeValue> AttributeMap;
+
+        /**
+         * What became of an entry given to DynamoDBBatcher::Put(), Delete() or Get().
+         */
+        struct EntryResult
+        {
+            EntryResult() : operation(BatchOperation::Put), successful(false), attempts(0) {}
+
+            std::shared_ptr<const Aws::Client::AsyncCallerContext> context;
+            BatchOperation operation;
+            Aws::String tableName;
+            /**
+             * The item of a put, the key of a delete or a get.
+             */
+            AttributeMap attributes;
+            bool successful;
+            /**
+             * The item a successful get read, empty if the table has no item with the key.
+             */
+            AttributeMap item;
+            /**
+             * Number of requests the entry was sent in.
+             */
+            unsigned attempts;
+            /**
+             * Error of the last attempt if the entry failed.
+             */
+            Aws::String errorCode;
+            Aws::String errorMessage;
+        };
+
+        typedef std::function<void(const DynamoDBBatcher*, const EntryResult&)> EntryCompletedCallback;
+
+        /**
+         * Entries are the puts, deletes and gets given to the batcher, those waiting for a retry count as buffered. Their size isn't
+         * tracked, bytesBuffered stays 0.
+         */
+        struct DynamoDBBatcherMetrics : public Aws::Utils::Threading::BatchingMetrics
+        {
+            DynamoDBBatcherMetrics() : entriesUnprocessed(0), writeRequestsSent(0), getRequestsSent(0), readCapacityUnits(0), writeCapacityUnits(0) {}
+
+            /**
+             * Entries DynamoDB returned as UnprocessedItems or UnprocessedKeys, each time it did.
+             */
+            uint64_t entriesUnprocessed;
+            /**
+             * BatchWriteItem and BatchGetItem requests, which add up to requestsSent.
+             */
+            uint64_t writeRequestsSent;
+            uint64_t getRequestsSent;
+
+            /**
+             * Capacity units consumed, as reported by DynamoDB when returnConsumedCapacity asks for it.
+             */
+            double readCapacityUnits;
+            double writeCapacityUnits;
+            Aws::Map<Aws::String, double> readCapacityUnitsByTable;
+            Aws::Map<Aws::String, double> writeCapacityUnitsByTable;
+        };
+
+        struct AWS_DYNAMODB_BATCH_API DynamoDBBatcherConfiguration
+        {
+            DynamoDBBatcherConfiguration();
+
+            std::shared_ptr<Aws::DynamoDB::DynamoDBClient> dynamoDBClient;
+
+            /**
+             * How long an entry may wait in the buffer for others to share a request with. Defaults to 20 milliseconds.
+             */
+            std::chrono::milliseconds maxBufferedTime;
+            /**
+             * A request is sent before maxBufferedTime is up once this many writes or gets are buffered, at most the 25 writes
+             * BatchWriteItem and the 100 keys BatchGetItem take.
+             */
+            size_t maxWritesPerRequest;
+            size_t maxGetsPerRequest;
+            /**
+             * Put(), Delete() and Get() block while this many entries are waiting to be sent. Defaults to 10000.
+             */
+            size_t maxBufferedEntries;
+            /**
+             * BatchWriteItem and BatchGetItem requests in flight together. Defaults to 8.
+             */
+            size_t maxRequestsInFlight;
+
+            /**
+             * Names of the key attributes of each table, its partition key and its sort key if it has one. Tables not listed are
+             * described with DescribeTable before their first entry is sent, their entries waiting while DescribeTable is retried
+             * like a request. If it fails with an error not worth retrying, or after maxRetries, their entries are told apart by all
+             * of their attributes.
+             */
+            Aws::Map<Aws::String, Aws::Vector<Aws::String>> keyAttributeNames;
+
+            /**
+             * Gets read with strongly consistent reads. Off by default.
+             */
+            bool consistentRead;
+            /**
+             * Defaults to TOTAL, which fills the capacity units of the metrics.
+             */
+            Aws::DynamoDB::Model::ReturnConsumedCapacity returnConsumedCapacity;
+
+            /**
+             * Entries DynamoDB leaves unprocessed, and those of requests failed with an error worth retrying, are sent again after
+             * a backoff doubling from retryBaseDelay up to maxRetryDelay, at most maxRetries times. Defaults to 10 retries from
+             * 50 milliseconds up to 5 seconds.
+             */
+            unsigned maxRetries;
+            std::chrono::milliseconds retryBaseDelay;
+            std::chrono::milliseconds maxRetryDelay;
+
+            /**
+             * Called once for every entry accepted, on success or after it failed for good.
+             */
+            EntryCompletedCallback entryCompletedCallback;
+        };
+
+        /**
+         * Writes and reads items of DynamoDB tables with BatchWriteItem and BatchGetItem, packing the puts, deletes and gets of any
+         * number of threads, whatever their table, into requests of up to 25 writes or 100 keys and retrying only the entries
+         * DynamoDB left unprocessed.
+         *
+         * Put(), Delete() and Get() return as soon as the entry is buffered, results are reported through the entryCompletedCallback.
+         * Requests are sent from a thread of the batcher, the requests themselves run on the executor of the client, several at once.
+         * Entries are told apart by table and key, the key attributes being taken from keyAttributeNames or DescribeTable. An entry
+         * waits while an earlier entry for the same item is in flight or waiting for a retry, so entries for one item never share a
+         * request, which DynamoDB would reject, and writes to an item are applied in the order they were given.
+         * The items a get read are matched to its key by the key attribute values, which should be given as DynamoDB returns them,
+         * e.g. numbers without leading zeros.
+         */
+        class AWS_DYNAMODB_BATCH_API DynamoDBBatcher : private Aws::Utils::Threading::BatchingLoop
+        {
+        public:
+            DynamoDBBatcher(const DynamoDBBatcherConfiguration& configuration);
+
+            /**
+             * Sends the entries still buffered and waits for them, including their retries.
+             */
+            ~DynamoDBBatcher();
+
+            DynamoDBBatcher(const DynamoDBBatcher&) = delete;
+            DynamoDBBatcher& operator=(const DynamoDBBatcher&) = delete;
+
+            /**
+             * Buffers a put of the item, blocking while maxBufferedEntries are buffered. Returns false, and doesn't call the callback,
+             * if the table name or the item is empty, or the batcher is being destroyed.
+             */
+            bool Put(const Aws::String& tableName, const AttributeMap& item, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
+            /**
+             * Buffers a delete of the item with the key, as Put() does.
+             */
+            bool Delete(const Aws::String& tableName, const AttributeMap& key, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
+            /**
+             * Buffers a get of the item with the key, as Put() does.
+             */
+            bool Get(const Aws::String& tableName, const AttributeMap& key, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
+            /**
+             * Sends the entries buffered so far without waiting for maxBufferedTime. Does not block.
+             */
+            void Flush();
+
+            /**
+             * Sends the entries buffered so far and blocks until all entries have completed.
+             */
+            void FlushAndWait();
+
+            DynamoDBBatcherMetrics GetMetrics() const;
+
+            inline const DynamoDBBatcherConfiguration& GetConfiguration() const { return m_configuration; }
+
+        private:
+            bool Add(BatchOperation operation, const Aws::String& tableName, const AttributeMap& attributes,
+                     const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context);
+            bool HasBufferedEntries() const override;
+            std::function<void()> TakeHousekeeping(std::chrono::steady_clock::time_point now, Aws::Utils::Threading::WakeUpTime& wakeUp) override;
+            void DescribeKeySchema(const Aws::String& tableName);
+            Aws::String MakeEntryId(const Aws::String& tableName, const AttributeMap& attributes) const;
+            std::function<void()> TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, Aws::Utils::Threading::WakeUpTime& wakeUp) override;
+            std::shared_ptr<BatchContext> TakeBatch(EntryQueue& queue);
+            void SendBatch(const std::shared_ptr<BatchContext>& batch);
+            void OnBatchWriteItemOutcome(const Aws::DynamoDB::DynamoDBClient*, const Aws::DynamoDB::Model::BatchWriteItemRequest&,
+                                         const Aws::DynamoDB::Model::BatchWriteItemOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
+            void OnBatchGetItemOutcome(const Aws::DynamoDB::DynamoDBClient*, const Aws::DynamoDB::Model::BatchGetItemRequest&,
+                                       const Aws::DynamoDB::Model::BatchGetItemOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
+            void RetryOrFail(std::chrono::steady_clock::time_point failedAt, const std::shared_ptr<BatchEntry>& entry, const Aws::String& errorCode,
+                             const Aws::String& errorMessage, bool retryable, Aws::Vector<EntryResult>& failed);
+            void CompleteBatch(Aws::Vector<EntryResult>& results);
+            size_t BufferedEntries() const;
+
+            DynamoDBBatcherConfiguration m_configuration;
+
+            std::shared_ptr<EntryQueue> m_writes;
+            std::shared_ptr<EntryQueue> m_gets;
+            // the queue looked at first alternates, so that a steady stream of writes doesn't hold back gets, nor the other way round
+            size_t m_firstQueue;
+            // key attributes of the tables known, empty for a table that couldn't be described
+            Aws::Map<Aws::String, Aws::Vector<Aws::String>> m_keyAttributeNames;
+            // tables whose entries wait for DescribeTable, with when it is due and how often it failed
+            Aws::Map<Aws::String, std::chrono::steady_clock::time_point> m_tablesToDescribe;
+            Aws::Map<Aws::String, unsigned> m_describeTableFailures;
+            DynamoDBBatcherMetrics m_metrics;
+        };
+    }
+}
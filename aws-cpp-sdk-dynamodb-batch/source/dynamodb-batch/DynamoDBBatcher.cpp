@@ -0,0 +1,604 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/dynamodb-batch/DynamoDBBatcher.h>
+#include <aws/dynamodb/model/BatchGetItemRequest.h>
+#include <aws/dynamodb/model/BatchGetItemResult.h>
+#include <aws/dynamodb/model/BatchWriteItemRequest.h>
+#include <aws/dynamodb/model/BatchWriteItemResult.h>
+#include <aws/dynamodb/model/ConsumedCapacity.h>
+#include <aws/dynamodb/model/DescribeTableRequest.h>
+#include <aws/dynamodb/model/DescribeTableResult.h>
+#include <aws/dynamodb/model/KeysAndAttributes.h>
+#include <aws/dynamodb/model/WriteRequest.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+
+#include <algorithm>
+
+using namespace Aws::Client;
+using namespace Aws::DynamoDB;
+using namespace Aws::DynamoDB::Model;
+using namespace Aws::Utils::Threading;
+
+namespace Aws
+{
+    namespace DynamoDBBatch
+    {
+        static const char* CLASS_TAG = "DynamoDBBatcher";
+
+        // limits of BatchWriteItem and BatchGetItem
+        static const size_t MAX_WRITES_PER_REQUEST = 25;
+        static const size_t MAX_GETS_PER_REQUEST = 100;
+
+        struct BatchEntry
+        {
+            BatchEntry() : operation(BatchOperation::Put), attempts(0) {}
+
+            BatchOperation operation;
+            Aws::String tableName;
+            AttributeMap attributes;
+            // the table and key, which is how DynamoDB tells entries apart, set once the key attributes of the table are known
+            Aws::String id;
+            std::shared_ptr<const AsyncCallerContext> context;
+            unsigned attempts;
+            std::chrono::steady_clock::time_point deadline;
+        };
+
+        struct BatchContext : public AsyncCallerContext
+        {
+            BatchContext() : writes(false) {}
+
+            bool writes;
+            Aws::Map<Aws::String, std::shared_ptr<BatchEntry>> entries;
+        };
+
+        struct EntryQueue
+        {
+            EntryQueue(bool writes, size_t maxEntriesPerRequest, std::chrono::milliseconds retryBaseDelay, std::chrono::milliseconds maxRetryDelay) :
+                writes(writes), maxEntriesPerRequest(maxEntriesPerRequest), retries(retryBaseDelay, maxRetryDelay) {}
+
+            bool writes;
+            size_t maxEntriesPerRequest;
+            // entries ready to be sent, oldest first
+            Aws::Deque<std::shared_ptr<BatchEntry>> pending;
+            RetryQueue<std::shared_ptr<BatchEntry>> retries;
+            // ids of the entries in flight or waiting for a retry, later entries with the same id wait for them
+            Aws::Set<Aws::String> idsInFlight;
+        };
+
+        static void AddConsumedCapacity(const Aws::Vector<ConsumedCapacity>& consumedCapacity, double& total, Aws::Map<Aws::String, double>& byTable)
+        {
+            for (const auto& capacity : consumedCapacity)
+            {
+                total += capacity.GetCapacityUnits();
+                byTable[capacity.GetTableName()] += capacity.GetCapacityUnits();
+            }
+        }
+
+        DynamoDBBatcherConfiguration::DynamoDBBatcherConfiguration() :
+            maxBufferedTime(20),
+            maxWritesPerRequest(MAX_WRITES_PER_REQUEST),
+            maxGetsPerRequest(MAX_GETS_PER_REQUEST),
+            maxBufferedEntries(10000),
+            maxRequestsInFlight(8),
+            consistentRead(false),
+            returnConsumedCapacity(ReturnConsumedCapacity::TOTAL),
+            maxRetries(10),
+            retryBaseDelay(50),
+            maxRetryDelay(5000)
+        {
+        }
+
+        DynamoDBBatcher::DynamoDBBatcher(const DynamoDBBatcherConfiguration& configuration) :
+            BatchingLoop(configuration.maxRequestsInFlight),
+            m_configuration(configuration),
+            m_firstQueue(0),
+            m_keyAttributeNames(configuration.keyAttributeNames)
+        {
+            m_configuration.maxWritesPerRequest = (std::max)((std::min)(m_configuration.maxWritesPerRequest, MAX_WRITES_PER_REQUEST), static_cast<size_t>(1));
+            m_configuration.maxGetsPerRequest = (std::max)((std::min)(m_configuration.maxGetsPerRequest, MAX_GETS_PER_REQUEST), static_cast<size_t>(1));
+            m_configuration.maxBufferedEntries = (std::max)(m_configuration.maxBufferedEntries, static_cast<size_t>(1));
+            m_configuration.maxRequestsInFlight = (std::max)(m_configuration.maxRequestsInFlight, static_cast<size_t>(1));
+
+            m_writes = Aws::MakeShared<EntryQueue>(CLASS_TAG, true, m_configuration.maxWritesPerRequest, m_configuration.retryBaseDelay, m_configuration.maxRetryDelay);
+            m_gets = Aws::MakeShared<EntryQueue>(CLASS_TAG, false, m_configuration.maxGetsPerRequest, m_configuration.retryBaseDelay, m_configuration.maxRetryDelay);
+            StartLoop();
+        }
+
+        DynamoDBBatcher::~DynamoDBBatcher()
+        {
+            StopLoop();
+        }
+
+        bool DynamoDBBatcher::Put(const Aws::String& tableName, const AttributeMap& item, const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            return Add(BatchOperation::Put, tableName, item, context);
+        }
+
+        bool DynamoDBBatcher::Delete(const Aws::String& tableName, const AttributeMap& key, const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            return Add(BatchOperation::Delete, tableName, key, context);
+        }
+
+        bool DynamoDBBatcher::Get(const Aws::String& tableName, const AttributeMap& key, const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            return Add(BatchOperation::Get, tableName, key, context);
+        }
+
+        bool DynamoDBBatcher::Add(BatchOperation operation, const Aws::String& tableName, const AttributeMap& attributes,
+                                  const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            if (tableName.empty() || attributes.empty())
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Entry of table " << tableName << " with " << attributes.size() << " attributes can't be sent to DynamoDB.");
+                return false;
+            }
+
+            auto entry = Aws::MakeShared<BatchEntry>(CLASS_TAG);
+            entry->operation = operation;
+            entry->tableName = tableName;
+            entry->attributes = attributes;
+            entry->context = context;
+
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this]() { return IsStopping() || BufferedEntries() < m_configuration.maxBufferedEntries; });
+            if (IsStopping())
+            {
+                return false;
+            }
+
+            bool describe = m_keyAttributeNames.find(tableName) == m_keyAttributeNames.end() && m_tablesToDescribe.emplace(tableName, std::chrono::steady_clock::time_point()).second;
+            EntryQueue& queue = operation == BatchOperation::Get ? *m_gets : *m_writes;
+            bool wasEmpty = queue.pending.empty();
+            entry->deadline = std::chrono::steady_clock::now() + m_configuration.maxBufferedTime;
+            queue.pending.push_back(entry);
+            ++m_metrics.entriesPut;
+
+            // an entry behind others in its queue is due no earlier than the first, which the loop is already waiting on, a new table
+            // is described right away
+            if (describe || wasEmpty || queue.pending.size() >= queue.maxEntriesPerRequest)
+            {
+                m_signal.notify_all();
+            }
+            return true;
+        }
+
+        void DynamoDBBatcher::Flush()
+        {
+            RequestFlush();
+        }
+
+        void DynamoDBBatcher::FlushAndWait()
+        {
+            RequestFlush();
+            WaitUntilIdle();
+        }
+
+        DynamoDBBatcherMetrics DynamoDBBatcher::GetMetrics() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            DynamoDBBatcherMetrics metrics = m_metrics;
+            CopyLoopMetrics(metrics);
+            metrics.entriesBuffered = BufferedEntries();
+            return metrics;
+        }
+
+        size_t DynamoDBBatcher::BufferedEntries() const
+        {
+            return m_writes->pending.size() + m_writes->retries.size() + m_gets->pending.size() + m_gets->retries.size();
+        }
+
+        bool DynamoDBBatcher::HasBufferedEntries() const
+        {
+            return BufferedEntries() > 0;
+        }
+
+        std::function<void()> DynamoDBBatcher::TakeHousekeeping(std::chrono::steady_clock::time_point now, WakeUpTime& wakeUp)
+        {
+            // tables are described before requests are taken, so that ids can be made for their entries, those of a table whose
+            // DescribeTable waits for a retry are held back
+            for (const auto& table : m_tablesToDescribe)
+            {
+                if (table.second <= now)
+                {
+                    Aws::String tableName = table.first;
+                    return [this, tableName]() { DescribeKeySchema(tableName); };
+                }
+                wakeUp.NoLaterThan(table.second);
+            }
+            return nullptr;
+        }
+
+        void DynamoDBBatcher::DescribeKeySchema(const Aws::String& tableName)
+        {
+            DescribeTableRequest describeTableRequest;
+            describeTableRequest.SetTableName(tableName);
+            auto describeTableOutcome = m_configuration.dynamoDBClient->DescribeTable(describeTableRequest);
+
+            Aws::Vector<Aws::String> keyAttributeNames;
+            if (describeTableOutcome.IsSuccess())
+            {
+                for (const auto& keySchemaElement : describeTableOutcome.GetResult().GetTable().GetKeySchema())
+                {
+                    keyAttributeNames.push_back(keySchemaElement.GetAttributeName());
+                }
+            }
+
+            std::lock_guard<std::mutex> locker(m_lock);
+            if (!describeTableOutcome.IsSuccess())
+            {
+                const auto& error = describeTableOutcome.GetError();
+                unsigned failures = ++m_describeTableFailures[tableName];
+                if (error.ShouldRetry() && failures <= m_configuration.maxRetries)
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Unable to describe table " << tableName << ", retrying. " << error);
+                    m_tablesToDescribe[tableName] = std::chrono::steady_clock::now() +
+                        ComputeRetryDelay(failures, m_configuration.retryBaseDelay, m_configuration.maxRetryDelay);
+                    return;
+                }
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to describe table " << tableName << ", its entries are told apart by all of their attributes. " << error);
+            }
+
+            m_keyAttributeNames[tableName] = keyAttributeNames;
+            m_tablesToDescribe.erase(tableName);
+            m_describeTableFailures.erase(tableName);
+        }
+
+        Aws::String DynamoDBBatcher::MakeEntryId(const Aws::String& tableName, const AttributeMap& attributes) const
+        {
+            // attributes are serialized in the order of their names, so equal keys make equal ids
+            Aws::Utils::Json::JsonValue json;
+            auto keyAttributeNames = m_keyAttributeNames.find(tableName);
+            if (keyAttributeNames == m_keyAttributeNames.end() || keyAttributeNames->second.empty())
+            {
+                for (const auto& attribute : attributes)
+                {
+                    json.WithObject(attribute.first, attribute.second.Jsonize());
+                }
+            }
+            else
+            {
+                for (const auto& name : keyAttributeNames->second)
+                {
+                    auto attribute = attributes.find(name);
+                    if (attribute != attributes.end())
+                    {
+                        json.WithObject(attribute->first, attribute->second.Jsonize());
+                    }
+                }
+            }
+
+            Aws::String id(tableName);
+            id.push_back('\0');
+            id.append(json.View().WriteCompact());
+            return id;
+        }
+
+        std::function<void()> DynamoDBBatcher::TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, WakeUpTime& wakeUp)
+        {
+            EntryQueue* queues[] = { m_writes.get(), m_gets.get() };
+            for (auto queue : queues)
+            {
+                // retries go back to the front of their queue, in the order they failed, ahead of later entries with the same id
+                queue->retries.TakeDue(now, [queue, now](const std::shared_ptr<BatchEntry>& entry)
+                {
+                    entry->deadline = now;
+                    queue->pending.push_front(entry);
+                    queue->idsInFlight.erase(entry->id);
+                });
+                queue->retries.AddWakeUp(wakeUp);
+            }
+
+            for (size_t i = 0; i < 2; ++i)
+            {
+                EntryQueue& queue = *queues[(m_firstQueue + i) % 2];
+                if (queue.pending.empty())
+                {
+                    continue;
+                }
+
+                bool ready = sendAll || queue.pending.front()->deadline <= now || queue.pending.size() >= queue.maxEntriesPerRequest;
+                if (!ready)
+                {
+                    wakeUp.NoLaterThan(queue.pending.front()->deadline);
+                    continue;
+                }
+
+                auto batch = TakeBatch(queue);
+                if (batch->entries.empty())
+                {
+                    // every entry waits for an earlier one with the same id, whose completion wakes the loop, or for its table to be described
+                    continue;
+                }
+                m_firstQueue = (m_firstQueue + i + 1) % 2;
+                ++(batch->writes ? m_metrics.writeRequestsSent : m_metrics.getRequestsSent);
+                return [this, batch]() { SendBatch(batch); };
+            }
+            return nullptr;
+        }
+
+        std::shared_ptr<BatchContext> DynamoDBBatcher::TakeBatch(EntryQueue& queue)
+        {
+            auto batch = Aws::MakeShared<BatchContext>(CLASS_TAG);
+            batch->writes = queue.writes;
+
+            // an entry for an item taken already, in this request or an earlier one, waits until that completes: DynamoDB rejects
+            // a request naming a key twice, and a write sent with an earlier one could be applied before it
+            Aws::Deque<std::shared_ptr<BatchEntry>> skipped;
+            while (!queue.pending.empty() && batch->entries.size() < queue.maxEntriesPerRequest)
+            {
+                auto entry = queue.pending.front();
+                queue.pending.pop_front();
+                if (m_tablesToDescribe.find(entry->tableName) != m_tablesToDescribe.end())
+                {
+                    skipped.push_back(entry);
+                    continue;
+                }
+                if (entry->id.empty())
+                {
+                    entry->id = MakeEntryId(entry->tableName, entry->attributes);
+                }
+                if (!queue.idsInFlight.insert(entry->id).second)
+                {
+                    skipped.push_back(entry);
+                    continue;
+                }
+                batch->entries.emplace(entry->id, entry);
+                ++entry->attempts;
+            }
+            queue.pending.insert(queue.pending.begin(), skipped.begin(), skipped.end());
+            return batch;
+        }
+
+        void DynamoDBBatcher::SendBatch(const std::shared_ptr<BatchContext>& batch)
+        {
+            AWS_LOGSTREAM_TRACE(CLASS_TAG, "Sending " << batch->entries.size() << (batch->writes ? " writes." : " gets."));
+            if (batch->writes)
+            {
+                Aws::Map<Aws::String, Aws::Vector<WriteRequest>> requestItems;
+                for (const auto& entry : batch->entries)
+                {
+                    const auto& batchEntry = *entry.second;
+                    if (batchEntry.operation == BatchOperation::Put)
+                    {
+                        requestItems[batchEntry.tableName].push_back(WriteRequest().WithPutRequest(PutRequest().WithItem(batchEntry.attributes)));
+                    }
+                    else
+                    {
+                        requestItems[batchEntry.tableName].push_back(WriteRequest().WithDeleteRequest(DeleteRequest().WithKey(batchEntry.attributes)));
+                    }
+                }
+
+                BatchWriteItemRequest batchWriteItemRequest;
+                batchWriteItemRequest.SetRequestItems(requestItems);
+                batchWriteItemRequest.SetReturnConsumedCapacity(m_configuration.returnConsumedCapacity);
+                m_configuration.dynamoDBClient->BatchWriteItemAsync(batchWriteItemRequest, std::bind(&DynamoDBBatcher::OnBatchWriteItemOutcome, this, std::placeholders::_1,
+                                                                                                   std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), batch);
+                return;
+            }
+
+            Aws::Map<Aws::String, KeysAndAttributes> requestItems;
+            for (const auto& entry : batch->entries)
+            {
+                auto& keysAndAttributes = requestItems[entry.second->tableName];
+                keysAndAttributes.AddKeys(entry.second->attributes);
+                if (m_configuration.consistentRead)
+                {
+                    keysAndAttributes.SetConsistentRead(true);
+                }
+            }
+
+            BatchGetItemRequest batchGetItemRequest;
+            batchGetItemRequest.SetRequestItems(requestItems);
+            batchGetItemRequest.SetReturnConsumedCapacity(m_configuration.returnConsumedCapacity);
+            m_configuration.dynamoDBClient->BatchGetItemAsync(batchGetItemRequest, std::bind(&DynamoDBBatcher::OnBatchGetItemOutcome, this, std::placeholders::_1,
+                                                                                           std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), batch);
+        }
+
+        void DynamoDBBatcher::RetryOrFail(std::chrono::steady_clock::time_point failedAt, const std::shared_ptr<BatchEntry>& entry, const Aws::String& errorCode,
+                                          const Aws::String& errorMessage, bool retryable, Aws::Vector<EntryResult>& failed)
+        {
+            auto& queue = entry->operation == BatchOperation::Get ? *m_gets : *m_writes;
+            if (retryable && entry->attempts <= m_configuration.maxRetries)
+            {
+                queue.retries.Add(entry, entry->attempts, failedAt);
+                ++m_metrics.entriesRetried;
+                return;
+            }
+            queue.idsInFlight.erase(entry->id);
+
+            EntryResult result;
+            result.context = entry->context;
+            result.operation = entry->operation;
+            result.tableName = entry->tableName;
+            result.attributes = std::move(entry->attributes);
+            result.attempts = entry->attempts;
+            result.errorCode = errorCode;
+            result.errorMessage = errorMessage;
+            failed.push_back(std::move(result));
+            ++m_metrics.entriesFailed;
+        }
+
+        void DynamoDBBatcher::OnBatchWriteItemOutcome(const DynamoDBClient*, const BatchWriteItemRequest&, const BatchWriteItemOutcome& batchWriteItemOutcome,
+                                                      const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            auto batch = std::static_pointer_cast<const BatchContext>(context);
+            Aws::Vector<EntryResult> results;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                // the items DynamoDB left unprocessed are retried together, rather than one request each
+                auto failedAt = std::chrono::steady_clock::now();
+                if (!batchWriteItemOutcome.IsSuccess())
+                {
+                    const auto& error = batchWriteItemOutcome.GetError();
+                    AWS_LOGSTREAM_ERROR(CLASS_TAG, "BatchWriteItem of " << batch->entries.size() << " writes failed. " << error);
+                    for (const auto& entry : batch->entries)
+                    {
+                        RetryOrFail(failedAt, entry.second, error.GetExceptionName(), error.GetMessage(), error.ShouldRetry(), results);
+                    }
+                }
+                else
+                {
+                    const auto& result = batchWriteItemOutcome.GetResult();
+                    AddConsumedCapacity(result.GetConsumedCapacity(), m_metrics.writeCapacityUnits, m_metrics.writeCapacityUnitsByTable);
+
+                    Aws::Set<Aws::String> unprocessed;
+                    for (const auto& table : result.GetUnprocessedItems())
+                    {
+                        for (const auto& writeRequest : table.second)
+                        {
+                            const auto& item = writeRequest.GetPutRequest().GetItem();
+                            unprocessed.insert(MakeEntryId(table.first, item.empty() ? writeRequest.GetDeleteRequest().GetKey() : item));
+                        }
+                    }
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "BatchWriteItem completed with " << unprocessed.size() << " of " << batch->entries.size() << " writes unprocessed.");
+
+                    for (const auto& entry : batch->entries)
+                    {
+                        if (unprocessed.count(entry.first) != 0)
+                        {
+                            ++m_metrics.entriesUnprocessed;
+                            RetryOrFail(failedAt, entry.second, "UnprocessedItems", "DynamoDB left the write unprocessed.", true, results);
+                            continue;
+                        }
+
+                        EntryResult entryResult;
+                        entryResult.context = entry.second->context;
+                        entryResult.operation = entry.second->operation;
+                        entryResult.tableName = entry.second->tableName;
+                        entryResult.attributes = std::move(entry.second->attributes);
+                        entryResult.successful = true;
+                        entryResult.attempts = entry.second->attempts;
+                        results.push_back(std::move(entryResult));
+                        m_writes->idsInFlight.erase(entry.first);
+                        ++m_metrics.entriesSucceeded;
+                    }
+                }
+            }
+
+            CompleteBatch(results);
+        }
+
+        void DynamoDBBatcher::OnBatchGetItemOutcome(const DynamoDBClient*, const BatchGetItemRequest&, const BatchGetItemOutcome& batchGetItemOutcome,
+                                                    const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            auto batch = std::static_pointer_cast<const BatchContext>(context);
+            Aws::Vector<EntryResult> results;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                auto failedAt = std::chrono::steady_clock::now();
+                if (!batchGetItemOutcome.IsSuccess())
+                {
+                    const auto& error = batchGetItemOutcome.GetError();
+                    AWS_LOGSTREAM_ERROR(CLASS_TAG, "BatchGetItem of " << batch->entries.size() << " keys failed. " << error);
+                    for (const auto& entry : batch->entries)
+                    {
+                        RetryOrFail(failedAt, entry.second, error.GetExceptionName(), error.GetMessage(), error.ShouldRetry(), results);
+                    }
+                }
+                else
+                {
+                    const auto& result = batchGetItemOutcome.GetResult();
+                    AddConsumedCapacity(result.GetConsumedCapacity(), m_metrics.readCapacityUnits, m_metrics.readCapacityUnitsByTable);
+
+                    // the attribute names of a key asked for are the key attributes of its table, which pick the key out of the items read
+                    Aws::Map<Aws::String, const AttributeMap*> keysByTable;
+                    for (const auto& entry : batch->entries)
+                    {
+                        keysByTable.emplace(entry.second->tableName, &entry.second->attributes);
+                    }
+                    Aws::Map<Aws::String, const AttributeMap*> items;
+                    for (const auto& table : result.GetResponses())
+                    {
+                        auto key = keysByTable.find(table.first);
+                        if (key == keysByTable.end())
+                        {
+                            continue;
+                        }
+                        for (const auto& item : table.second)
+                        {
+                            AttributeMap itemKey;
+                            for (const auto& keyAttribute : *key->second)
+                            {
+                                auto attribute = item.find(keyAttribute.first);
+                                if (attribute != item.end())
+                                {
+                                    itemKey.emplace(attribute->first, attribute->second);
+                                }
+                            }
+                            items.emplace(MakeEntryId(table.first, itemKey), &item);
+                        }
+                    }
+
+                    Aws::Set<Aws::String> unprocessed;
+                    for (const auto& table : result.GetUnprocessedKeys())
+                    {
+                        for (const auto& key : table.second.GetKeys())
+                        {
+                            unprocessed.insert(MakeEntryId(table.first, key));
+                        }
+                    }
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "BatchGetItem completed with " << items.size() << " items read and " << unprocessed.size() << " of "
+                            << batch->entries.size() << " keys unprocessed.");
+
+                    for (const auto& entry : batch->entries)
+                    {
+                        if (unprocessed.count(entry.first) != 0)
+                        {
+                            ++m_metrics.entriesUnprocessed;
+                            RetryOrFail(failedAt, entry.second, "UnprocessedKeys", "DynamoDB left the key unprocessed.", true, results);
+                            continue;
+                        }
+
+                        EntryResult entryResult;
+                        entryResult.context = entry.second->context;
+                        entryResult.operation = entry.second->operation;
+                        entryResult.tableName = entry.second->tableName;
+                        entryResult.attributes = std::move(entry.second->attributes);
+                        entryResult.successful = true;
+                        entryResult.attempts = entry.second->attempts;
+                        auto item = items.find(entry.first);
+                        if (item != items.end())
+                        {
+                            entryResult.item = *item->second;
+                        }
+                        results.push_back(std::move(entryResult));
+                        m_gets->idsInFlight.erase(entry.first);
+                        ++m_metrics.entriesSucceeded;
+                    }
+                }
+            }
+
+            CompleteBatch(results);
+        }
+
+        void DynamoDBBatcher::CompleteBatch(Aws::Vector<EntryResult>& results)
+        {
+            if (m_configuration.entryCompletedCallback)
+            {
+                for (const auto& result : results)
+                {
+                    m_configuration.entryCompletedCallback(this, result);
+                }
+            }
+
+            CompleteRequest();
+        }
+    }
+}
@@ -35,7 +35,8 @@ namespace AttributeActionMapper
 {
 AWS_DYNAMODB_API AttributeAction GetAttributeActionForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForAttributeAction(AttributeAction value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForAttributeAction(AttributeAction value);
 } // namespace AttributeActionMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -35,7 +35,8 @@ namespace BackupStatusMapper
 {
 AWS_DYNAMODB_API BackupStatus GetBackupStatusForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForBackupStatus(BackupStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForBackupStatus(BackupStatus value);
 } // namespace BackupStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -34,7 +34,8 @@ namespace BackupTypeMapper
 {
 AWS_DYNAMODB_API BackupType GetBackupTypeForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForBackupType(BackupType value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForBackupType(BackupType value);
 } // namespace BackupTypeMapper
 } // namespace Model
 } // namespace DynamoDB
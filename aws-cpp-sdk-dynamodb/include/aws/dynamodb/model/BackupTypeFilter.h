@@ -35,7 +35,8 @@ namespace BackupTypeFilterMapper
 {
 AWS_DYNAMODB_API BackupTypeFilter GetBackupTypeFilterForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForBackupTypeFilter(BackupTypeFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForBackupTypeFilter(BackupTypeFilter value);
 } // namespace BackupTypeFilterMapper
 } // namespace Model
 } // namespace DynamoDB
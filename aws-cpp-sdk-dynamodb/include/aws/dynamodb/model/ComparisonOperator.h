@@ -45,7 +45,8 @@ namespace ComparisonOperatorMapper
 {
 AWS_DYNAMODB_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForComparisonOperator(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -34,7 +34,8 @@ namespace ConditionalOperatorMapper
 {
 AWS_DYNAMODB_API ConditionalOperator GetConditionalOperatorForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForConditionalOperator(ConditionalOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForConditionalOperator(ConditionalOperator value);
 } // namespace ConditionalOperatorMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -34,7 +34,8 @@ namespace ContinuousBackupsStatusMapper
 {
 AWS_DYNAMODB_API ContinuousBackupsStatus GetContinuousBackupsStatusForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForContinuousBackupsStatus(ContinuousBackupsStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForContinuousBackupsStatus(ContinuousBackupsStatus value);
 } // namespace ContinuousBackupsStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -36,7 +36,8 @@ namespace GlobalTableStatusMapper
 {
 AWS_DYNAMODB_API GlobalTableStatus GetGlobalTableStatusForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForGlobalTableStatus(GlobalTableStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForGlobalTableStatus(GlobalTableStatus value);
 } // namespace GlobalTableStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -36,7 +36,8 @@ namespace IndexStatusMapper
 {
 AWS_DYNAMODB_API IndexStatus GetIndexStatusForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForIndexStatus(IndexStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForIndexStatus(IndexStatus value);
 } // namespace IndexStatusMapper
 } // namespace Model
 } // namespace DynamoDB
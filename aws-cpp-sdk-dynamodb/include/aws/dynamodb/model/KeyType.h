@@ -34,7 +34,8 @@ namespace KeyTypeMapper
 {
 AWS_DYNAMODB_API KeyType GetKeyTypeForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForKeyType(KeyType value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForKeyType(KeyType value);
 } // namespace KeyTypeMapper
 } // namespace Model
 } // namespace DynamoDB
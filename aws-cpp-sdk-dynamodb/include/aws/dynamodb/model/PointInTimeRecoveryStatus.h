@@ -34,7 +34,8 @@ namespace PointInTimeRecoveryStatusMapper
 {
 AWS_DYNAMODB_API PointInTimeRecoveryStatus GetPointInTimeRecoveryStatusForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForPointInTimeRecoveryStatus(PointInTimeRecoveryStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForPointInTimeRecoveryStatus(PointInTimeRecoveryStatus value);
 } // namespace PointInTimeRecoveryStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -35,7 +35,8 @@ namespace ProjectionTypeMapper
 {
 AWS_DYNAMODB_API ProjectionType GetProjectionTypeForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForProjectionType(ProjectionType value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForProjectionType(ProjectionType value);
 } // namespace ProjectionTypeMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -36,7 +36,8 @@ namespace ReplicaStatusMapper
 {
 AWS_DYNAMODB_API ReplicaStatus GetReplicaStatusForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForReplicaStatus(ReplicaStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForReplicaStatus(ReplicaStatus value);
 } // namespace ReplicaStatusMapper
 } // namespace Model
 } // namespace DynamoDB
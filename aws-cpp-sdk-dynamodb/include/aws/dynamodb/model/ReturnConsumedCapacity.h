@@ -35,7 +35,8 @@ namespace ReturnConsumedCapacityMapper
 {
 AWS_DYNAMODB_API ReturnConsumedCapacity GetReturnConsumedCapacityForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForReturnConsumedCapacity(ReturnConsumedCapacity value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForReturnConsumedCapacity(ReturnConsumedCapacity value);
 } // namespace ReturnConsumedCapacityMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -34,7 +34,8 @@ namespace ReturnItemCollectionMetricsMapper
 {
 AWS_DYNAMODB_API ReturnItemCollectionMetrics GetReturnItemCollectionMetricsForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForReturnItemCollectionMetrics(ReturnItemCollectionMetrics value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForReturnItemCollectionMetrics(ReturnItemCollectionMetrics value);
 } // namespace ReturnItemCollectionMetricsMapper
 } // namespace Model
 } // namespace DynamoDB
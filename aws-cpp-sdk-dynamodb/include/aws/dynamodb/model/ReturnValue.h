@@ -37,7 +37,8 @@ namespace ReturnValueMapper
 {
 AWS_DYNAMODB_API ReturnValue GetReturnValueForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForReturnValue(ReturnValue value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForReturnValue(ReturnValue value);
 } // namespace ReturnValueMapper
 } // namespace Model
 } // namespace DynamoDB
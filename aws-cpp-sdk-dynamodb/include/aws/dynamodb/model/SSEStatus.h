@@ -36,7 +36,8 @@ namespace SSEStatusMapper
 {
 AWS_DYNAMODB_API SSEStatus GetSSEStatusForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForSSEStatus(SSEStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForSSEStatus(SSEStatus value);
 } // namespace SSEStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -34,7 +34,8 @@ namespace SSETypeMapper
 {
 AWS_DYNAMODB_API SSEType GetSSETypeForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForSSEType(SSEType value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForSSEType(SSEType value);
 } // namespace SSETypeMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -35,7 +35,8 @@ namespace ScalarAttributeTypeMapper
 {
 AWS_DYNAMODB_API ScalarAttributeType GetScalarAttributeTypeForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForScalarAttributeType(ScalarAttributeType value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForScalarAttributeType(ScalarAttributeType value);
 } // namespace ScalarAttributeTypeMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -36,7 +36,8 @@ namespace SelectMapper
 {
 AWS_DYNAMODB_API Select GetSelectForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForSelect(Select value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForSelect(Select value);
 } // namespace SelectMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -36,7 +36,8 @@ namespace StreamViewTypeMapper
 {
 AWS_DYNAMODB_API StreamViewType GetStreamViewTypeForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForStreamViewType(StreamViewType value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForStreamViewType(StreamViewType value);
 } // namespace StreamViewTypeMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -36,7 +36,8 @@ namespace TableStatusMapper
 {
 AWS_DYNAMODB_API TableStatus GetTableStatusForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForTableStatus(TableStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForTableStatus(TableStatus value);
 } // namespace TableStatusMapper
 } // namespace Model
 } // namespace DynamoDB
@@ -36,7 +36,8 @@ namespace TimeToLiveStatusMapper
 {
 AWS_DYNAMODB_API TimeToLiveStatus GetTimeToLiveStatusForName(const Aws::String& name);
 
-AWS_DYNAMODB_API Aws::String GetNameForTimeToLiveStatus(TimeToLiveStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODB_API const char* GetNameForTimeToLiveStatus(TimeToLiveStatus value);
 } // namespace TimeToLiveStatusMapper
 } // namespace Model
 } // namespace DynamoDB
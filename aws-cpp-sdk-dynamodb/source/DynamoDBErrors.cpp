@@ -28,24 +28,24 @@ namespace DynamoDB
 namespace DynamoDBErrorMapper
 {
 
-static const int TABLE_ALREADY_EXISTS_HASH = HashingUtils::HashString("TableAlreadyExistsException");
-static const int ITEM_COLLECTION_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ItemCollectionSizeLimitExceededException");
-static const int CONDITIONAL_CHECK_FAILED_HASH = HashingUtils::HashString("ConditionalCheckFailedException");
-static const int POINT_IN_TIME_RECOVERY_UNAVAILABLE_HASH = HashingUtils::HashString("PointInTimeRecoveryUnavailableException");
-static const int BACKUP_NOT_FOUND_HASH = HashingUtils::HashString("BackupNotFoundException");
-static const int REPLICA_NOT_FOUND_HASH = HashingUtils::HashString("ReplicaNotFoundException");
-static const int CONTINUOUS_BACKUPS_UNAVAILABLE_HASH = HashingUtils::HashString("ContinuousBackupsUnavailableException");
-static const int GLOBAL_TABLE_ALREADY_EXISTS_HASH = HashingUtils::HashString("GlobalTableAlreadyExistsException");
-static const int TABLE_NOT_FOUND_HASH = HashingUtils::HashString("TableNotFoundException");
-static const int BACKUP_IN_USE_HASH = HashingUtils::HashString("BackupInUseException");
-static const int TABLE_IN_USE_HASH = HashingUtils::HashString("TableInUseException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int INVALID_RESTORE_TIME_HASH = HashingUtils::HashString("InvalidRestoreTimeException");
-static const int INDEX_NOT_FOUND_HASH = HashingUtils::HashString("IndexNotFoundException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int REPLICA_ALREADY_EXISTS_HASH = HashingUtils::HashString("ReplicaAlreadyExistsException");
-static const int PROVISIONED_THROUGHPUT_EXCEEDED_HASH = HashingUtils::HashString("ProvisionedThroughputExceededException");
-static const int GLOBAL_TABLE_NOT_FOUND_HASH = HashingUtils::HashString("GlobalTableNotFoundException");
+static constexpr int TABLE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("TableAlreadyExistsException");
+static constexpr int ITEM_COLLECTION_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ItemCollectionSizeLimitExceededException");
+static constexpr int CONDITIONAL_CHECK_FAILED_HASH = HashingUtils::CompileTimeHashString("ConditionalCheckFailedException");
+static constexpr int POINT_IN_TIME_RECOVERY_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("PointInTimeRecoveryUnavailableException");
+static constexpr int BACKUP_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("BackupNotFoundException");
+static constexpr int REPLICA_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ReplicaNotFoundException");
+static constexpr int CONTINUOUS_BACKUPS_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("ContinuousBackupsUnavailableException");
+static constexpr int GLOBAL_TABLE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("GlobalTableAlreadyExistsException");
+static constexpr int TABLE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("TableNotFoundException");
+static constexpr int BACKUP_IN_USE_HASH = HashingUtils::CompileTimeHashString("BackupInUseException");
+static constexpr int TABLE_IN_USE_HASH = HashingUtils::CompileTimeHashString("TableInUseException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int INVALID_RESTORE_TIME_HASH = HashingUtils::CompileTimeHashString("InvalidRestoreTimeException");
+static constexpr int INDEX_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("IndexNotFoundException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int REPLICA_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ReplicaAlreadyExistsException");
+static constexpr int PROVISIONED_THROUGHPUT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ProvisionedThroughputExceededException");
+static constexpr int GLOBAL_TABLE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("GlobalTableNotFoundException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
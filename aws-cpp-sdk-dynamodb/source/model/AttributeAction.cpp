@@ -30,25 +30,37 @@ namespace Aws
       namespace AttributeActionMapper
       {
 
-        static const int ADD_HASH = HashingUtils::HashString("ADD");
-        static const int PUT_HASH = HashingUtils::HashString("PUT");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
+        static constexpr int ADD_HASH = HashingUtils::CompileTimeHashString("ADD");
+        static constexpr int PUT_HASH = HashingUtils::CompileTimeHashString("PUT");
+        static constexpr int DELETE__HASH = HashingUtils::CompileTimeHashString("DELETE");
 
 
         AttributeAction GetAttributeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AttributeAction::ADD;
-          }
-          else if (hashCode == PUT_HASH)
-          {
-            return AttributeAction::PUT;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return AttributeAction::DELETE_;
+          case ADD_HASH:
+            if (name == "ADD")
+            {
+              return AttributeAction::ADD;
+            }
+            break;
+          case PUT_HASH:
+            if (name == "PUT")
+            {
+              return AttributeAction::PUT;
+            }
+            break;
+          case DELETE__HASH:
+            if (name == "DELETE")
+            {
+              return AttributeAction::DELETE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AttributeAction::NOT_SET;
         }
 
-        Aws::String GetNameForAttributeAction(AttributeAction enumValue)
+        const char* GetNameForAttributeAction(AttributeAction enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace BackupStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
 
 
         BackupStatus GetBackupStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BackupStatus::CREATING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return BackupStatus::DELETED;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return BackupStatus::AVAILABLE;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return BackupStatus::CREATING;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return BackupStatus::DELETED;
+            }
+            break;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return BackupStatus::AVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return BackupStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBackupStatus(BackupStatus enumValue)
+        const char* GetNameForBackupStatus(BackupStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace BackupTypeMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
+        static constexpr int USER_HASH = HashingUtils::CompileTimeHashString("USER");
+        static constexpr int SYSTEM_HASH = HashingUtils::CompileTimeHashString("SYSTEM");
 
 
         BackupType GetBackupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BackupType::USER;
-          }
-          else if (hashCode == SYSTEM_HASH)
-          {
-            return BackupType::SYSTEM;
+          case USER_HASH:
+            if (name == "USER")
+            {
+              return BackupType::USER;
+            }
+            break;
+          case SYSTEM_HASH:
+            if (name == "SYSTEM")
+            {
+              return BackupType::SYSTEM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BackupType::NOT_SET;
         }
 
-        Aws::String GetNameForBackupType(BackupType enumValue)
+        const char* GetNameForBackupType(BackupType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace BackupTypeFilterMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        static constexpr int USER_HASH = HashingUtils::CompileTimeHashString("USER");
+        static constexpr int SYSTEM_HASH = HashingUtils::CompileTimeHashString("SYSTEM");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
 
 
         BackupTypeFilter GetBackupTypeFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BackupTypeFilter::USER;
-          }
-          else if (hashCode == SYSTEM_HASH)
-          {
-            return BackupTypeFilter::SYSTEM;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return BackupTypeFilter::ALL;
+          case USER_HASH:
+            if (name == "USER")
+            {
+              return BackupTypeFilter::USER;
+            }
+            break;
+          case SYSTEM_HASH:
+            if (name == "SYSTEM")
+            {
+              return BackupTypeFilter::SYSTEM;
+            }
+            break;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return BackupTypeFilter::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return BackupTypeFilter::NOT_SET;
         }
 
-        Aws::String GetNameForBackupTypeFilter(BackupTypeFilter enumValue)
+        const char* GetNameForBackupTypeFilter(BackupTypeFilter enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,75 +30,107 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int NE_HASH = HashingUtils::HashString("NE");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int LE_HASH = HashingUtils::HashString("LE");
-        static const int LT_HASH = HashingUtils::HashString("LT");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int GT_HASH = HashingUtils::HashString("GT");
-        static const int BETWEEN_HASH = HashingUtils::HashString("BETWEEN");
-        static const int NOT_NULL_HASH = HashingUtils::HashString("NOT_NULL");
-        static const int NULL__HASH = HashingUtils::HashString("NULL");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-        static const int NOT_CONTAINS_HASH = HashingUtils::HashString("NOT_CONTAINS");
-        static const int BEGINS_WITH_HASH = HashingUtils::HashString("BEGINS_WITH");
+        static constexpr int EQ_HASH = HashingUtils::CompileTimeHashString("EQ");
+        static constexpr int NE_HASH = HashingUtils::CompileTimeHashString("NE");
+        static constexpr int IN_HASH = HashingUtils::CompileTimeHashString("IN");
+        static constexpr int LE_HASH = HashingUtils::CompileTimeHashString("LE");
+        static constexpr int LT_HASH = HashingUtils::CompileTimeHashString("LT");
+        static constexpr int GE_HASH = HashingUtils::CompileTimeHashString("GE");
+        static constexpr int GT_HASH = HashingUtils::CompileTimeHashString("GT");
+        static constexpr int BETWEEN_HASH = HashingUtils::CompileTimeHashString("BETWEEN");
+        static constexpr int NOT_NULL_HASH = HashingUtils::CompileTimeHashString("NOT_NULL");
+        static constexpr int NULL__HASH = HashingUtils::CompileTimeHashString("NULL");
+        static constexpr int CONTAINS_HASH = HashingUtils::CompileTimeHashString("CONTAINS");
+        static constexpr int NOT_CONTAINS_HASH = HashingUtils::CompileTimeHashString("NOT_CONTAINS");
+        static constexpr int BEGINS_WITH_HASH = HashingUtils::CompileTimeHashString("BEGINS_WITH");
 
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComparisonOperator::EQ;
-          }
-          else if (hashCode == NE_HASH)
-          {
-            return ComparisonOperator::NE;
-          }
-          else if (hashCode == IN_HASH)
-          {
-            return ComparisonOperator::IN;
-          }
-          else if (hashCode == LE_HASH)
-          {
-            return ComparisonOperator::LE;
-          }
-          else if (hashCode == LT_HASH)
-          {
-            return ComparisonOperator::LT;
-          }
-          else if (hashCode == GE_HASH)
-          {
-            return ComparisonOperator::GE;
-          }
-          else if (hashCode == GT_HASH)
-          {
-            return ComparisonOperator::GT;
-          }
-          else if (hashCode == BETWEEN_HASH)
-          {
-            return ComparisonOperator::BETWEEN;
-          }
-          else if (hashCode == NOT_NULL_HASH)
-          {
-            return ComparisonOperator::NOT_NULL;
-          }
-          else if (hashCode == NULL__HASH)
-          {
-            return ComparisonOperator::NULL_;
-          }
-          else if (hashCode == CONTAINS_HASH)
-          {
-            return ComparisonOperator::CONTAINS;
-          }
-          else if (hashCode == NOT_CONTAINS_HASH)
-          {
-            return ComparisonOperator::NOT_CONTAINS;
-          }
-          else if (hashCode == BEGINS_WITH_HASH)
-          {
-            return ComparisonOperator::BEGINS_WITH;
+          case EQ_HASH:
+            if (name == "EQ")
+            {
+              return ComparisonOperator::EQ;
+            }
+            break;
+          case NE_HASH:
+            if (name == "NE")
+            {
+              return ComparisonOperator::NE;
+            }
+            break;
+          case IN_HASH:
+            if (name == "IN")
+            {
+              return ComparisonOperator::IN;
+            }
+            break;
+          case LE_HASH:
+            if (name == "LE")
+            {
+              return ComparisonOperator::LE;
+            }
+            break;
+          case LT_HASH:
+            if (name == "LT")
+            {
+              return ComparisonOperator::LT;
+            }
+            break;
+          case GE_HASH:
+            if (name == "GE")
+            {
+              return ComparisonOperator::GE;
+            }
+            break;
+          case GT_HASH:
+            if (name == "GT")
+            {
+              return ComparisonOperator::GT;
+            }
+            break;
+          case BETWEEN_HASH:
+            if (name == "BETWEEN")
+            {
+              return ComparisonOperator::BETWEEN;
+            }
+            break;
+          case NOT_NULL_HASH:
+            if (name == "NOT_NULL")
+            {
+              return ComparisonOperator::NOT_NULL;
+            }
+            break;
+          case NULL__HASH:
+            if (name == "NULL")
+            {
+              return ComparisonOperator::NULL_;
+            }
+            break;
+          case CONTAINS_HASH:
+            if (name == "CONTAINS")
+            {
+              return ComparisonOperator::CONTAINS;
+            }
+            break;
+          case NOT_CONTAINS_HASH:
+            if (name == "NOT_CONTAINS")
+            {
+              return ComparisonOperator::NOT_CONTAINS;
+            }
+            break;
+          case BEGINS_WITH_HASH:
+            if (name == "BEGINS_WITH")
+            {
+              return ComparisonOperator::BEGINS_WITH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,7 +142,7 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperator(ComparisonOperator enumValue)
         {
           switch(enumValue)
           {
@@ -144,7 +176,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
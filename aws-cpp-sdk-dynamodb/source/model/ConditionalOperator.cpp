@@ -30,20 +30,30 @@ namespace Aws
       namespace ConditionalOperatorMapper
       {
 
-        static const int AND_HASH = HashingUtils::HashString("AND");
-        static const int OR_HASH = HashingUtils::HashString("OR");
+        static constexpr int AND_HASH = HashingUtils::CompileTimeHashString("AND");
+        static constexpr int OR_HASH = HashingUtils::CompileTimeHashString("OR");
 
 
         ConditionalOperator GetConditionalOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AND_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConditionalOperator::AND;
-          }
-          else if (hashCode == OR_HASH)
-          {
-            return ConditionalOperator::OR;
+          case AND_HASH:
+            if (name == "AND")
+            {
+              return ConditionalOperator::AND;
+            }
+            break;
+          case OR_HASH:
+            if (name == "OR")
+            {
+              return ConditionalOperator::OR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ConditionalOperator::NOT_SET;
         }
 
-        Aws::String GetNameForConditionalOperator(ConditionalOperator enumValue)
+        const char* GetNameForConditionalOperator(ConditionalOperator enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ContinuousBackupsStatusMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
 
 
         ContinuousBackupsStatus GetContinuousBackupsStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContinuousBackupsStatus::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return ContinuousBackupsStatus::DISABLED;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return ContinuousBackupsStatus::ENABLED;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return ContinuousBackupsStatus::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ContinuousBackupsStatus::NOT_SET;
         }
 
-        Aws::String GetNameForContinuousBackupsStatus(ContinuousBackupsStatus enumValue)
+        const char* GetNameForContinuousBackupsStatus(ContinuousBackupsStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace GlobalTableStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
 
 
         GlobalTableStatus GetGlobalTableStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GlobalTableStatus::CREATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return GlobalTableStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return GlobalTableStatus::DELETING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return GlobalTableStatus::UPDATING;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return GlobalTableStatus::CREATING;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return GlobalTableStatus::ACTIVE;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return GlobalTableStatus::DELETING;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return GlobalTableStatus::UPDATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return GlobalTableStatus::NOT_SET;
         }
 
-        Aws::String GetNameForGlobalTableStatus(GlobalTableStatus enumValue)
+        const char* GetNameForGlobalTableStatus(GlobalTableStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ProjectionTypeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int KEYS_ONLY_HASH = HashingUtils::HashString("KEYS_ONLY");
-        static const int INCLUDE_HASH = HashingUtils::HashString("INCLUDE");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
+        static constexpr int KEYS_ONLY_HASH = HashingUtils::CompileTimeHashString("KEYS_ONLY");
+        static constexpr int INCLUDE_HASH = HashingUtils::CompileTimeHashString("INCLUDE");
 
 
         ProjectionType GetProjectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProjectionType::ALL;
-          }
-          else if (hashCode == KEYS_ONLY_HASH)
-          {
-            return ProjectionType::KEYS_ONLY;
-          }
-          else if (hashCode == INCLUDE_HASH)
-          {
-            return ProjectionType::INCLUDE;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return ProjectionType::ALL;
+            }
+            break;
+          case KEYS_ONLY_HASH:
+            if (name == "KEYS_ONLY")
+            {
+              return ProjectionType::KEYS_ONLY;
+            }
+            break;
+          case INCLUDE_HASH:
+            if (name == "INCLUDE")
+            {
+              return ProjectionType::INCLUDE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ProjectionType::NOT_SET;
         }
 
-        Aws::String GetNameForProjectionType(ProjectionType enumValue)
+        const char* GetNameForProjectionType(ProjectionType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ReturnConsumedCapacityMapper
       {
 
-        static const int INDEXES_HASH = HashingUtils::HashString("INDEXES");
-        static const int TOTAL_HASH = HashingUtils::HashString("TOTAL");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int INDEXES_HASH = HashingUtils::CompileTimeHashString("INDEXES");
+        static constexpr int TOTAL_HASH = HashingUtils::CompileTimeHashString("TOTAL");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         ReturnConsumedCapacity GetReturnConsumedCapacityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INDEXES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReturnConsumedCapacity::INDEXES;
-          }
-          else if (hashCode == TOTAL_HASH)
-          {
-            return ReturnConsumedCapacity::TOTAL;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return ReturnConsumedCapacity::NONE;
+          case INDEXES_HASH:
+            if (name == "INDEXES")
+            {
+              return ReturnConsumedCapacity::INDEXES;
+            }
+            break;
+          case TOTAL_HASH:
+            if (name == "TOTAL")
+            {
+              return ReturnConsumedCapacity::TOTAL;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return ReturnConsumedCapacity::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ReturnConsumedCapacity::NOT_SET;
         }
 
-        Aws::String GetNameForReturnConsumedCapacity(ReturnConsumedCapacity enumValue)
+        const char* GetNameForReturnConsumedCapacity(ReturnConsumedCapacity enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
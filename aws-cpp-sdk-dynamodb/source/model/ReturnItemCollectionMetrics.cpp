@@ -30,20 +30,30 @@ namespace Aws
       namespace ReturnItemCollectionMetricsMapper
       {
 
-        static const int SIZE_HASH = HashingUtils::HashString("SIZE");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int SIZE_HASH = HashingUtils::CompileTimeHashString("SIZE");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         ReturnItemCollectionMetrics GetReturnItemCollectionMetricsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIZE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReturnItemCollectionMetrics::SIZE;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return ReturnItemCollectionMetrics::NONE;
+          case SIZE_HASH:
+            if (name == "SIZE")
+            {
+              return ReturnItemCollectionMetrics::SIZE;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return ReturnItemCollectionMetrics::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReturnItemCollectionMetrics::NOT_SET;
         }
 
-        Aws::String GetNameForReturnItemCollectionMetrics(ReturnItemCollectionMetrics enumValue)
+        const char* GetNameForReturnItemCollectionMetrics(ReturnItemCollectionMetrics enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace ReturnValueMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int ALL_OLD_HASH = HashingUtils::HashString("ALL_OLD");
-        static const int UPDATED_OLD_HASH = HashingUtils::HashString("UPDATED_OLD");
-        static const int ALL_NEW_HASH = HashingUtils::HashString("ALL_NEW");
-        static const int UPDATED_NEW_HASH = HashingUtils::HashString("UPDATED_NEW");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int ALL_OLD_HASH = HashingUtils::CompileTimeHashString("ALL_OLD");
+        static constexpr int UPDATED_OLD_HASH = HashingUtils::CompileTimeHashString("UPDATED_OLD");
+        static constexpr int ALL_NEW_HASH = HashingUtils::CompileTimeHashString("ALL_NEW");
+        static constexpr int UPDATED_NEW_HASH = HashingUtils::CompileTimeHashString("UPDATED_NEW");
 
 
         ReturnValue GetReturnValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReturnValue::NONE;
-          }
-          else if (hashCode == ALL_OLD_HASH)
-          {
-            return ReturnValue::ALL_OLD;
-          }
-          else if (hashCode == UPDATED_OLD_HASH)
-          {
-            return ReturnValue::UPDATED_OLD;
-          }
-          else if (hashCode == ALL_NEW_HASH)
-          {
-            return ReturnValue::ALL_NEW;
-          }
-          else if (hashCode == UPDATED_NEW_HASH)
-          {
-            return ReturnValue::UPDATED_NEW;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return ReturnValue::NONE;
+            }
+            break;
+          case ALL_OLD_HASH:
+            if (name == "ALL_OLD")
+            {
+              return ReturnValue::ALL_OLD;
+            }
+            break;
+          case UPDATED_OLD_HASH:
+            if (name == "UPDATED_OLD")
+            {
+              return ReturnValue::UPDATED_OLD;
+            }
+            break;
+          case ALL_NEW_HASH:
+            if (name == "ALL_NEW")
+            {
+              return ReturnValue::ALL_NEW;
+            }
+            break;
+          case UPDATED_NEW_HASH:
+            if (name == "UPDATED_NEW")
+            {
+              return ReturnValue::UPDATED_NEW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ReturnValue::NOT_SET;
         }
 
-        Aws::String GetNameForReturnValue(ReturnValue enumValue)
+        const char* GetNameForReturnValue(ReturnValue enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
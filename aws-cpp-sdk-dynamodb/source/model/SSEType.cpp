@@ -30,20 +30,30 @@ namespace Aws
       namespace SSETypeMapper
       {
 
-        static const int AES256_HASH = HashingUtils::HashString("AES256");
-        static const int KMS_HASH = HashingUtils::HashString("KMS");
+        static constexpr int AES256_HASH = HashingUtils::CompileTimeHashString("AES256");
+        static constexpr int KMS_HASH = HashingUtils::CompileTimeHashString("KMS");
 
 
         SSEType GetSSETypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES256_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SSEType::AES256;
-          }
-          else if (hashCode == KMS_HASH)
-          {
-            return SSEType::KMS;
+          case AES256_HASH:
+            if (name == "AES256")
+            {
+              return SSEType::AES256;
+            }
+            break;
+          case KMS_HASH:
+            if (name == "KMS")
+            {
+              return SSEType::KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SSEType::NOT_SET;
         }
 
-        Aws::String GetNameForSSEType(SSEType enumValue)
+        const char* GetNameForSSEType(SSEType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
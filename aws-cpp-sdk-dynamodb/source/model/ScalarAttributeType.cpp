@@ -30,25 +30,37 @@ namespace Aws
       namespace ScalarAttributeTypeMapper
       {
 
-        static const int S_HASH = HashingUtils::HashString("S");
-        static const int N_HASH = HashingUtils::HashString("N");
-        static const int B_HASH = HashingUtils::HashString("B");
+        static constexpr int S_HASH = HashingUtils::CompileTimeHashString("S");
+        static constexpr int N_HASH = HashingUtils::CompileTimeHashString("N");
+        static constexpr int B_HASH = HashingUtils::CompileTimeHashString("B");
 
 
         ScalarAttributeType GetScalarAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == S_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalarAttributeType::S;
-          }
-          else if (hashCode == N_HASH)
-          {
-            return ScalarAttributeType::N;
-          }
-          else if (hashCode == B_HASH)
-          {
-            return ScalarAttributeType::B;
+          case S_HASH:
+            if (name == "S")
+            {
+              return ScalarAttributeType::S;
+            }
+            break;
+          case N_HASH:
+            if (name == "N")
+            {
+              return ScalarAttributeType::N;
+            }
+            break;
+          case B_HASH:
+            if (name == "B")
+            {
+              return ScalarAttributeType::B;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ScalarAttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForScalarAttributeType(ScalarAttributeType enumValue)
+        const char* GetNameForScalarAttributeType(ScalarAttributeType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
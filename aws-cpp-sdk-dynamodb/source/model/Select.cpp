@@ -30,30 +30,44 @@ namespace Aws
       namespace SelectMapper
       {
 
-        static const int ALL_ATTRIBUTES_HASH = HashingUtils::HashString("ALL_ATTRIBUTES");
-        static const int ALL_PROJECTED_ATTRIBUTES_HASH = HashingUtils::HashString("ALL_PROJECTED_ATTRIBUTES");
-        static const int SPECIFIC_ATTRIBUTES_HASH = HashingUtils::HashString("SPECIFIC_ATTRIBUTES");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
+        static constexpr int ALL_ATTRIBUTES_HASH = HashingUtils::CompileTimeHashString("ALL_ATTRIBUTES");
+        static constexpr int ALL_PROJECTED_ATTRIBUTES_HASH = HashingUtils::CompileTimeHashString("ALL_PROJECTED_ATTRIBUTES");
+        static constexpr int SPECIFIC_ATTRIBUTES_HASH = HashingUtils::CompileTimeHashString("SPECIFIC_ATTRIBUTES");
+        static constexpr int COUNT_HASH = HashingUtils::CompileTimeHashString("COUNT");
 
 
         Select GetSelectForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_ATTRIBUTES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Select::ALL_ATTRIBUTES;
-          }
-          else if (hashCode == ALL_PROJECTED_ATTRIBUTES_HASH)
-          {
-            return Select::ALL_PROJECTED_ATTRIBUTES;
-          }
-          else if (hashCode == SPECIFIC_ATTRIBUTES_HASH)
-          {
-            return Select::SPECIFIC_ATTRIBUTES;
-          }
-          else if (hashCode == COUNT_HASH)
-          {
-            return Select::COUNT;
+          case ALL_ATTRIBUTES_HASH:
+            if (name == "ALL_ATTRIBUTES")
+            {
+              return Select::ALL_ATTRIBUTES;
+            }
+            break;
+          case ALL_PROJECTED_ATTRIBUTES_HASH:
+            if (name == "ALL_PROJECTED_ATTRIBUTES")
+            {
+              return Select::ALL_PROJECTED_ATTRIBUTES;
+            }
+            break;
+          case SPECIFIC_ATTRIBUTES_HASH:
+            if (name == "SPECIFIC_ATTRIBUTES")
+            {
+              return Select::SPECIFIC_ATTRIBUTES;
+            }
+            break;
+          case COUNT_HASH:
+            if (name == "COUNT")
+            {
+              return Select::COUNT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return Select::NOT_SET;
         }
 
-        Aws::String GetNameForSelect(Select enumValue)
+        const char* GetNameForSelect(Select enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace StreamViewTypeMapper
       {
 
-        static const int NEW_IMAGE_HASH = HashingUtils::HashString("NEW_IMAGE");
-        static const int OLD_IMAGE_HASH = HashingUtils::HashString("OLD_IMAGE");
-        static const int NEW_AND_OLD_IMAGES_HASH = HashingUtils::HashString("NEW_AND_OLD_IMAGES");
-        static const int KEYS_ONLY_HASH = HashingUtils::HashString("KEYS_ONLY");
+        static constexpr int NEW_IMAGE_HASH = HashingUtils::CompileTimeHashString("NEW_IMAGE");
+        static constexpr int OLD_IMAGE_HASH = HashingUtils::CompileTimeHashString("OLD_IMAGE");
+        static constexpr int NEW_AND_OLD_IMAGES_HASH = HashingUtils::CompileTimeHashString("NEW_AND_OLD_IMAGES");
+        static constexpr int KEYS_ONLY_HASH = HashingUtils::CompileTimeHashString("KEYS_ONLY");
 
 
         StreamViewType GetStreamViewTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NEW_IMAGE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StreamViewType::NEW_IMAGE;
-          }
-          else if (hashCode == OLD_IMAGE_HASH)
-          {
-            return StreamViewType::OLD_IMAGE;
-          }
-          else if (hashCode == NEW_AND_OLD_IMAGES_HASH)
-          {
-            return StreamViewType::NEW_AND_OLD_IMAGES;
-          }
-          else if (hashCode == KEYS_ONLY_HASH)
-          {
-            return StreamViewType::KEYS_ONLY;
+          case NEW_IMAGE_HASH:
+            if (name == "NEW_IMAGE")
+            {
+              return StreamViewType::NEW_IMAGE;
+            }
+            break;
+          case OLD_IMAGE_HASH:
+            if (name == "OLD_IMAGE")
+            {
+              return StreamViewType::OLD_IMAGE;
+            }
+            break;
+          case NEW_AND_OLD_IMAGES_HASH:
+            if (name == "NEW_AND_OLD_IMAGES")
+            {
+              return StreamViewType::NEW_AND_OLD_IMAGES;
+            }
+            break;
+          case KEYS_ONLY_HASH:
+            if (name == "KEYS_ONLY")
+            {
+              return StreamViewType::KEYS_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return StreamViewType::NOT_SET;
         }
 
-        Aws::String GetNameForStreamViewType(StreamViewType enumValue)
+        const char* GetNameForStreamViewType(StreamViewType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace OperationTypeMapper
 {
 AWS_DYNAMODBSTREAMS_API OperationType GetOperationTypeForName(const Aws::String& name);
 
-AWS_DYNAMODBSTREAMS_API Aws::String GetNameForOperationType(OperationType value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODBSTREAMS_API const char* GetNameForOperationType(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace DynamoDBStreams
@@ -36,7 +36,8 @@ namespace ShardIteratorTypeMapper
 {
 AWS_DYNAMODBSTREAMS_API ShardIteratorType GetShardIteratorTypeForName(const Aws::String& name);
 
-AWS_DYNAMODBSTREAMS_API Aws::String GetNameForShardIteratorType(ShardIteratorType value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODBSTREAMS_API const char* GetNameForShardIteratorType(ShardIteratorType value);
 } // namespace ShardIteratorTypeMapper
 } // namespace Model
 } // namespace DynamoDBStreams
@@ -36,7 +36,8 @@ namespace StreamStatusMapper
 {
 AWS_DYNAMODBSTREAMS_API StreamStatus GetStreamStatusForName(const Aws::String& name);
 
-AWS_DYNAMODBSTREAMS_API Aws::String GetNameForStreamStatus(StreamStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_DYNAMODBSTREAMS_API const char* GetNameForStreamStatus(StreamStatus value);
 } // namespace StreamStatusMapper
 } // namespace Model
 } // namespace DynamoDBStreams
@@ -28,9 +28,9 @@ namespace DynamoDBStreams
 namespace DynamoDBStreamsErrorMapper
 {
 
-static const int TRIMMED_DATA_ACCESS_HASH = HashingUtils::HashString("TrimmedDataAccessException");
-static const int EXPIRED_ITERATOR_HASH = HashingUtils::HashString("ExpiredIteratorException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
+static constexpr int TRIMMED_DATA_ACCESS_HASH = HashingUtils::CompileTimeHashString("TrimmedDataAccessException");
+static constexpr int EXPIRED_ITERATOR_HASH = HashingUtils::CompileTimeHashString("ExpiredIteratorException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace KeyTypeMapper
       {
 
-        static const int HASH_HASH = HashingUtils::HashString("HASH");
-        static const int RANGE_HASH = HashingUtils::HashString("RANGE");
+        static constexpr int HASH_HASH = HashingUtils::CompileTimeHashString("HASH");
+        static constexpr int RANGE_HASH = HashingUtils::CompileTimeHashString("RANGE");
 
 
         KeyType GetKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HASH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return KeyType::HASH;
-          }
-          else if (hashCode == RANGE_HASH)
-          {
-            return KeyType::RANGE;
+          case HASH_HASH:
+            if (name == "HASH")
+            {
+              return KeyType::HASH;
+            }
+            break;
+          case RANGE_HASH:
+            if (name == "RANGE")
+            {
+              return KeyType::RANGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return KeyType::NOT_SET;
         }
 
-        Aws::String GetNameForKeyType(KeyType enumValue)
+        const char* GetNameForKeyType(KeyType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
-        static const int MODIFY_HASH = HashingUtils::HashString("MODIFY");
-        static const int REMOVE_HASH = HashingUtils::HashString("REMOVE");
+        static constexpr int INSERT_HASH = HashingUtils::CompileTimeHashString("INSERT");
+        static constexpr int MODIFY_HASH = HashingUtils::CompileTimeHashString("MODIFY");
+        static constexpr int REMOVE_HASH = HashingUtils::CompileTimeHashString("REMOVE");
 
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSERT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationType::INSERT;
-          }
-          else if (hashCode == MODIFY_HASH)
-          {
-            return OperationType::MODIFY;
-          }
-          else if (hashCode == REMOVE_HASH)
-          {
-            return OperationType::REMOVE;
+          case INSERT_HASH:
+            if (name == "INSERT")
+            {
+              return OperationType::INSERT;
+            }
+            break;
+          case MODIFY_HASH:
+            if (name == "MODIFY")
+            {
+              return OperationType::MODIFY;
+            }
+            break;
+          case REMOVE_HASH:
+            if (name == "REMOVE")
+            {
+              return OperationType::REMOVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationType(OperationType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
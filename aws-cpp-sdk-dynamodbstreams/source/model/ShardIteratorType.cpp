@@ -30,30 +30,44 @@ namespace Aws
       namespace ShardIteratorTypeMapper
       {
 
-        static const int TRIM_HORIZON_HASH = HashingUtils::HashString("TRIM_HORIZON");
-        static const int LATEST_HASH = HashingUtils::HashString("LATEST");
-        static const int AT_SEQUENCE_NUMBER_HASH = HashingUtils::HashString("AT_SEQUENCE_NUMBER");
-        static const int AFTER_SEQUENCE_NUMBER_HASH = HashingUtils::HashString("AFTER_SEQUENCE_NUMBER");
+        static constexpr int TRIM_HORIZON_HASH = HashingUtils::CompileTimeHashString("TRIM_HORIZON");
+        static constexpr int LATEST_HASH = HashingUtils::CompileTimeHashString("LATEST");
+        static constexpr int AT_SEQUENCE_NUMBER_HASH = HashingUtils::CompileTimeHashString("AT_SEQUENCE_NUMBER");
+        static constexpr int AFTER_SEQUENCE_NUMBER_HASH = HashingUtils::CompileTimeHashString("AFTER_SEQUENCE_NUMBER");
 
 
         ShardIteratorType GetShardIteratorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRIM_HORIZON_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ShardIteratorType::TRIM_HORIZON;
-          }
-          else if (hashCode == LATEST_HASH)
-          {
-            return ShardIteratorType::LATEST;
-          }
-          else if (hashCode == AT_SEQUENCE_NUMBER_HASH)
-          {
-            return ShardIteratorType::AT_SEQUENCE_NUMBER;
-          }
-          else if (hashCode == AFTER_SEQUENCE_NUMBER_HASH)
-          {
-            return ShardIteratorType::AFTER_SEQUENCE_NUMBER;
+          case TRIM_HORIZON_HASH:
+            if (name == "TRIM_HORIZON")
+            {
+              return ShardIteratorType::TRIM_HORIZON;
+            }
+            break;
+          case LATEST_HASH:
+            if (name == "LATEST")
+            {
+              return ShardIteratorType::LATEST;
+            }
+            break;
+          case AT_SEQUENCE_NUMBER_HASH:
+            if (name == "AT_SEQUENCE_NUMBER")
+            {
+              return ShardIteratorType::AT_SEQUENCE_NUMBER;
+            }
+            break;
+          case AFTER_SEQUENCE_NUMBER_HASH:
+            if (name == "AFTER_SEQUENCE_NUMBER")
+            {
+              return ShardIteratorType::AFTER_SEQUENCE_NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ShardIteratorType::NOT_SET;
         }
 
-        Aws::String GetNameForShardIteratorType(ShardIteratorType enumValue)
+        const char* GetNameForShardIteratorType(ShardIteratorType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
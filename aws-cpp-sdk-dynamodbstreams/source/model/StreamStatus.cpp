@@ -30,30 +30,44 @@ namespace Aws
       namespace StreamStatusMapper
       {
 
-        static const int ENABLING_HASH = HashingUtils::HashString("ENABLING");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLING_HASH = HashingUtils::HashString("DISABLING");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        static constexpr int ENABLING_HASH = HashingUtils::CompileTimeHashString("ENABLING");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
+        static constexpr int DISABLING_HASH = HashingUtils::CompileTimeHashString("DISABLING");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
 
 
         StreamStatus GetStreamStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StreamStatus::ENABLING;
-          }
-          else if (hashCode == ENABLED_HASH)
-          {
-            return StreamStatus::ENABLED;
-          }
-          else if (hashCode == DISABLING_HASH)
-          {
-            return StreamStatus::DISABLING;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return StreamStatus::DISABLED;
+          case ENABLING_HASH:
+            if (name == "ENABLING")
+            {
+              return StreamStatus::ENABLING;
+            }
+            break;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return StreamStatus::ENABLED;
+            }
+            break;
+          case DISABLING_HASH:
+            if (name == "DISABLING")
+            {
+              return StreamStatus::DISABLING;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return StreamStatus::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return StreamStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStreamStatus(StreamStatus enumValue)
+        const char* GetNameForStreamStatus(StreamStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
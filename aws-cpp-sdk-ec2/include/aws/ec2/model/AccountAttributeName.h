@@ -34,7 +34,8 @@ namespace AccountAttributeNameMapper
 {
 AWS_EC2_API AccountAttributeName GetAccountAttributeNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForAccountAttributeName(AccountAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForAccountAttributeName(AccountAttributeName value);
 } // namespace AccountAttributeNameMapper
 } // namespace Model
 } // namespace EC2
@@ -36,7 +36,8 @@ namespace ActivityStatusMapper
 {
 AWS_EC2_API ActivityStatus GetActivityStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForActivityStatus(ActivityStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForActivityStatus(ActivityStatus value);
 } // namespace ActivityStatusMapper
 } // namespace Model
 } // namespace EC2
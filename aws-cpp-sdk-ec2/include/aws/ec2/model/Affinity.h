@@ -34,7 +34,8 @@ namespace AffinityMapper
 {
 AWS_EC2_API Affinity GetAffinityForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForAffinity(Affinity value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForAffinity(Affinity value);
 } // namespace AffinityMapper
 } // namespace Model
 } // namespace EC2
@@ -37,7 +37,8 @@ namespace AllocationStateMapper
 {
 AWS_EC2_API AllocationState GetAllocationStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForAllocationState(AllocationState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForAllocationState(AllocationState value);
 } // namespace AllocationStateMapper
 } // namespace Model
 } // namespace EC2
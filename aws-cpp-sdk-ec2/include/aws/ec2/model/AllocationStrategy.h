@@ -34,7 +34,8 @@ namespace AllocationStrategyMapper
 {
 AWS_EC2_API AllocationStrategy GetAllocationStrategyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForAllocationStrategy(AllocationStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForAllocationStrategy(AllocationStrategy value);
 } // namespace AllocationStrategyMapper
 } // namespace Model
 } // namespace EC2
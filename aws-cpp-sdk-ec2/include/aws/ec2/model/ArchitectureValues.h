@@ -34,7 +34,8 @@ namespace ArchitectureValuesMapper
 {
 AWS_EC2_API ArchitectureValues GetArchitectureValuesForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForArchitectureValues(ArchitectureValues value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForArchitectureValues(ArchitectureValues value);
 } // namespace ArchitectureValuesMapper
 } // namespace Model
 } // namespace EC2
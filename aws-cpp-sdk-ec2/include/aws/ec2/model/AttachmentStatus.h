@@ -36,7 +36,8 @@ namespace AttachmentStatusMapper
 {
 AWS_EC2_API AttachmentStatus GetAttachmentStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForAttachmentStatus(AttachmentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForAttachmentStatus(AttachmentStatus value);
 } // namespace AttachmentStatusMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace AutoPlacementMapper
 {
 AWS_EC2_API AutoPlacement GetAutoPlacementForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForAutoPlacement(AutoPlacement value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForAutoPlacement(AutoPlacement value);
 } // namespace AutoPlacementMapper
 } // namespace Model
 } // namespace EC2
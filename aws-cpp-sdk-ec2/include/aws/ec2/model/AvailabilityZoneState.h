@@ -36,7 +36,8 @@ namespace AvailabilityZoneStateMapper
 {
 AWS_EC2_API AvailabilityZoneState GetAvailabilityZoneStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForAvailabilityZoneState(AvailabilityZoneState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForAvailabilityZoneState(AvailabilityZoneState value);
 } // namespace AvailabilityZoneStateMapper
 } // namespace Model
 } // namespace EC2
@@ -39,7 +39,8 @@ namespace BatchStateMapper
 {
 AWS_EC2_API BatchState GetBatchStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForBatchState(BatchState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForBatchState(BatchState value);
 } // namespace BatchStateMapper
 } // namespace Model
 } // namespace EC2
@@ -39,7 +39,8 @@ namespace BundleTaskStateMapper
 {
 AWS_EC2_API BundleTaskState GetBundleTaskStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForBundleTaskState(BundleTaskState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForBundleTaskState(BundleTaskState value);
 } // namespace BundleTaskStateMapper
 } // namespace Model
 } // namespace EC2
@@ -36,7 +36,8 @@ namespace CancelBatchErrorCodeMapper
 {
 AWS_EC2_API CancelBatchErrorCode GetCancelBatchErrorCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForCancelBatchErrorCode(CancelBatchErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForCancelBatchErrorCode(CancelBatchErrorCode value);
 } // namespace CancelBatchErrorCodeMapper
 } // namespace Model
 } // namespace EC2
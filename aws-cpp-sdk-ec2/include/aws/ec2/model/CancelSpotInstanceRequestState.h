@@ -37,7 +37,8 @@ namespace CancelSpotInstanceRequestStateMapper
 {
 AWS_EC2_API CancelSpotInstanceRequestState GetCancelSpotInstanceRequestStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForCancelSpotInstanceRequestState(CancelSpotInstanceRequestState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForCancelSpotInstanceRequestState(CancelSpotInstanceRequestState value);
 } // namespace CancelSpotInstanceRequestStateMapper
 } // namespace Model
 } // namespace EC2
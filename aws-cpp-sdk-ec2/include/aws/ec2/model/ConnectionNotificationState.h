@@ -34,7 +34,8 @@ namespace ConnectionNotificationStateMapper
 {
 AWS_EC2_API ConnectionNotificationState GetConnectionNotificationStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForConnectionNotificationState(ConnectionNotificationState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForConnectionNotificationState(ConnectionNotificationState value);
 } // namespace ConnectionNotificationStateMapper
 } // namespace Model
 } // namespace EC2
@@ -33,7 +33,8 @@ namespace ConnectionNotificationTypeMapper
 {
 AWS_EC2_API ConnectionNotificationType GetConnectionNotificationTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForConnectionNotificationType(ConnectionNotificationType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForConnectionNotificationType(ConnectionNotificationType value);
 } // namespace ConnectionNotificationTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -33,7 +33,8 @@ namespace ContainerFormatMapper
 {
 AWS_EC2_API ContainerFormat GetContainerFormatForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForContainerFormat(ContainerFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForContainerFormat(ContainerFormat value);
 } // namespace ContainerFormatMapper
 } // namespace Model
 } // namespace EC2
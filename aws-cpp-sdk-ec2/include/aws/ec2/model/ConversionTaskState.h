@@ -36,7 +36,8 @@ namespace ConversionTaskStateMapper
 {
 AWS_EC2_API ConversionTaskState GetConversionTaskStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForConversionTaskState(ConversionTaskState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForConversionTaskState(ConversionTaskState value);
 } // namespace ConversionTaskStateMapper
 } // namespace Model
 } // namespace EC2
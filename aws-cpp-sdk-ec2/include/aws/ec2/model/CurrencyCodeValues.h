@@ -33,7 +33,8 @@ namespace CurrencyCodeValuesMapper
 {
 AWS_EC2_API CurrencyCodeValues GetCurrencyCodeValuesForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForCurrencyCodeValues(CurrencyCodeValues value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForCurrencyCodeValues(CurrencyCodeValues value);
 } // namespace CurrencyCodeValuesMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace DatafeedSubscriptionStateMapper
 {
 AWS_EC2_API DatafeedSubscriptionState GetDatafeedSubscriptionStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForDatafeedSubscriptionState(DatafeedSubscriptionState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForDatafeedSubscriptionState(DatafeedSubscriptionState value);
 } // namespace DatafeedSubscriptionStateMapper
 } // namespace Model
 } // namespace EC2
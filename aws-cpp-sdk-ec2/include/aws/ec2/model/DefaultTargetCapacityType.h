@@ -34,7 +34,8 @@ namespace DefaultTargetCapacityTypeMapper
 {
 AWS_EC2_API DefaultTargetCapacityType GetDefaultTargetCapacityTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForDefaultTargetCapacityType(DefaultTargetCapacityType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForDefaultTargetCapacityType(DefaultTargetCapacityType value);
 } // namespace DefaultTargetCapacityTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -36,7 +36,8 @@ namespace DeleteFleetErrorCodeMapper
 {
 AWS_EC2_API DeleteFleetErrorCode GetDeleteFleetErrorCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForDeleteFleetErrorCode(DeleteFleetErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForDeleteFleetErrorCode(DeleteFleetErrorCode value);
 } // namespace DeleteFleetErrorCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace DeviceTypeMapper
 {
 AWS_EC2_API DeviceType GetDeviceTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForDeviceType(DeviceType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForDeviceType(DeviceType value);
 } // namespace DeviceTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -35,7 +35,8 @@ namespace DiskImageFormatMapper
 {
 AWS_EC2_API DiskImageFormat GetDiskImageFormatForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForDiskImageFormat(DiskImageFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForDiskImageFormat(DiskImageFormat value);
 } // namespace DiskImageFormatMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace DomainTypeMapper
 {
 AWS_EC2_API DomainType GetDomainTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForDomainType(DomainType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForDomainType(DomainType value);
 } // namespace DomainTypeMapper
 } // namespace Model
 } // namespace EC2
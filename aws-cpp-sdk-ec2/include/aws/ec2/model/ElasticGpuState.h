@@ -33,7 +33,8 @@ namespace ElasticGpuStateMapper
 {
 AWS_EC2_API ElasticGpuState GetElasticGpuStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForElasticGpuState(ElasticGpuState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForElasticGpuState(ElasticGpuState value);
 } // namespace ElasticGpuStateMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace ElasticGpuStatusMapper
 {
 AWS_EC2_API ElasticGpuStatus GetElasticGpuStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForElasticGpuStatus(ElasticGpuStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForElasticGpuStatus(ElasticGpuStatus value);
 } // namespace ElasticGpuStatusMapper
 } // namespace Model
 } // namespace EC2
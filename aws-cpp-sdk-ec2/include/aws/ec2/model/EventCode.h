@@ -37,7 +37,8 @@ namespace EventCodeMapper
 {
 AWS_EC2_API EventCode GetEventCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForEventCode(EventCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForEventCode(EventCode value);
 } // namespace EventCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -35,7 +35,8 @@ namespace EventTypeMapper
 {
 AWS_EC2_API EventType GetEventTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForEventType(EventType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForEventType(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace ExcessCapacityTerminationPolicyMapper
 {
 AWS_EC2_API ExcessCapacityTerminationPolicy GetExcessCapacityTerminationPolicyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForExcessCapacityTerminationPolicy(ExcessCapacityTerminationPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForExcessCapacityTerminationPolicy(ExcessCapacityTerminationPolicy value);
 } // namespace ExcessCapacityTerminationPolicyMapper
 } // namespace Model
 } // namespace EC2
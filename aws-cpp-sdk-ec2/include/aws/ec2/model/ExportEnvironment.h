@@ -35,7 +35,8 @@ namespace ExportEnvironmentMapper
 {
 AWS_EC2_API ExportEnvironment GetExportEnvironmentForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForExportEnvironment(ExportEnvironment value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForExportEnvironment(ExportEnvironment value);
 } // namespace ExportEnvironmentMapper
 } // namespace Model
 } // namespace EC2
@@ -36,7 +36,8 @@ namespace ExportTaskStateMapper
 {
 AWS_EC2_API ExportTaskState GetExportTaskStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForExportTaskState(ExportTaskState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForExportTaskState(ExportTaskState value);
 } // namespace ExportTaskStateMapper
 } // namespace Model
 } // namespace EC2
@@ -36,7 +36,8 @@ namespace FleetActivityStatusMapper
 {
 AWS_EC2_API FleetActivityStatus GetFleetActivityStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForFleetActivityStatus(FleetActivityStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForFleetActivityStatus(FleetActivityStatus value);
 } // namespace FleetActivityStatusMapper
 } // namespace Model
 } // namespace EC2
@@ -35,7 +35,8 @@ namespace FleetEventTypeMapper
 {
 AWS_EC2_API FleetEventType GetFleetEventTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForFleetEventType(FleetEventType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForFleetEventType(FleetEventType value);
 } // namespace FleetEventTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace FleetExcessCapacityTerminationPolicyMapper
 {
 AWS_EC2_API FleetExcessCapacityTerminationPolicy GetFleetExcessCapacityTerminationPolicyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForFleetExcessCapacityTerminationPolicy(FleetExcessCapacityTerminationPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForFleetExcessCapacityTerminationPolicy(FleetExcessCapacityTerminationPolicy value);
 } // namespace FleetExcessCapacityTerminationPolicyMapper
 } // namespace Model
 } // namespace EC2
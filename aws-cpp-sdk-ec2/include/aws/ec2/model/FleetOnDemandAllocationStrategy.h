@@ -34,7 +34,8 @@ namespace FleetOnDemandAllocationStrategyMapper
 {
 AWS_EC2_API FleetOnDemandAllocationStrategy GetFleetOnDemandAllocationStrategyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForFleetOnDemandAllocationStrategy(FleetOnDemandAllocationStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForFleetOnDemandAllocationStrategy(FleetOnDemandAllocationStrategy value);
 } // namespace FleetOnDemandAllocationStrategyMapper
 } // namespace Model
 } // namespace EC2
@@ -39,7 +39,8 @@ namespace FleetStateCodeMapper
 {
 AWS_EC2_API FleetStateCode GetFleetStateCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForFleetStateCode(FleetStateCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForFleetStateCode(FleetStateCode value);
 } // namespace FleetStateCodeMapper
 } // namespace Model
 } // namespace EC2
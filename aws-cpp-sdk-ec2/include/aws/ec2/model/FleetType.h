@@ -34,7 +34,8 @@ namespace FleetTypeMapper
 {
 AWS_EC2_API FleetType GetFleetTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForFleetType(FleetType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForFleetType(FleetType value);
 } // namespace FleetTypeMapper
 } // namespace Model
 } // namespace EC2
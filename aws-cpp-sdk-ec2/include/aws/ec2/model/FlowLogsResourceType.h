@@ -35,7 +35,8 @@ namespace FlowLogsResourceTypeMapper
 {
 AWS_EC2_API FlowLogsResourceType GetFlowLogsResourceTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForFlowLogsResourceType(FlowLogsResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForFlowLogsResourceType(FlowLogsResourceType value);
 } // namespace FlowLogsResourceTypeMapper
 } // namespace Model
 } // namespace EC2
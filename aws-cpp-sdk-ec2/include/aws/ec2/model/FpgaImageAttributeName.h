@@ -36,7 +36,8 @@ namespace FpgaImageAttributeNameMapper
 {
 AWS_EC2_API FpgaImageAttributeName GetFpgaImageAttributeNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForFpgaImageAttributeName(FpgaImageAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForFpgaImageAttributeName(FpgaImageAttributeName value);
 } // namespace FpgaImageAttributeNameMapper
 } // namespace Model
 } // namespace EC2
@@ -36,7 +36,8 @@ namespace FpgaImageStateCodeMapper
 {
 AWS_EC2_API FpgaImageStateCode GetFpgaImageStateCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForFpgaImageStateCode(FpgaImageStateCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForFpgaImageStateCode(FpgaImageStateCode value);
 } // namespace FpgaImageStateCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -33,7 +33,8 @@ namespace GatewayTypeMapper
 {
 AWS_EC2_API GatewayType GetGatewayTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForGatewayType(GatewayType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForGatewayType(GatewayType value);
 } // namespace GatewayTypeMapper
 } // namespace Model
 } // namespace EC2
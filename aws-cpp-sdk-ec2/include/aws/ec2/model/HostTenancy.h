@@ -34,7 +34,8 @@ namespace HostTenancyMapper
 {
 AWS_EC2_API HostTenancy GetHostTenancyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForHostTenancy(HostTenancy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForHostTenancy(HostTenancy value);
 } // namespace HostTenancyMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace HypervisorTypeMapper
 {
 AWS_EC2_API HypervisorType GetHypervisorTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForHypervisorType(HypervisorType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForHypervisorType(HypervisorType value);
 } // namespace HypervisorTypeMapper
 } // namespace Model
 } // namespace EC2
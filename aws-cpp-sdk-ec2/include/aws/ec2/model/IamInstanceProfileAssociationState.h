@@ -36,7 +36,8 @@ namespace IamInstanceProfileAssociationStateMapper
 {
 AWS_EC2_API IamInstanceProfileAssociationState GetIamInstanceProfileAssociationStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForIamInstanceProfileAssociationState(IamInstanceProfileAssociationState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForIamInstanceProfileAssociationState(IamInstanceProfileAssociationState value);
 } // namespace IamInstanceProfileAssociationStateMapper
 } // namespace Model
 } // namespace EC2
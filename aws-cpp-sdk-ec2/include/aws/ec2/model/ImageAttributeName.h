@@ -39,7 +39,8 @@ namespace ImageAttributeNameMapper
 {
 AWS_EC2_API ImageAttributeName GetImageAttributeNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForImageAttributeName(ImageAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForImageAttributeName(ImageAttributeName value);
 } // namespace ImageAttributeNameMapper
 } // namespace Model
 } // namespace EC2
@@ -39,7 +39,8 @@ namespace ImageStateMapper
 {
 AWS_EC2_API ImageState GetImageStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForImageState(ImageState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForImageState(ImageState value);
 } // namespace ImageStateMapper
 } // namespace Model
 } // namespace EC2
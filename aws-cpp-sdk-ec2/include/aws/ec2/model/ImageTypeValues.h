@@ -35,7 +35,8 @@ namespace ImageTypeValuesMapper
 {
 AWS_EC2_API ImageTypeValues GetImageTypeValuesForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForImageTypeValues(ImageTypeValues value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForImageTypeValues(ImageTypeValues value);
 } // namespace ImageTypeValuesMapper
 } // namespace Model
 } // namespace EC2
@@ -46,7 +46,8 @@ namespace InstanceAttributeNameMapper
 {
 AWS_EC2_API InstanceAttributeName GetInstanceAttributeNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForInstanceAttributeName(InstanceAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForInstanceAttributeName(InstanceAttributeName value);
 } // namespace InstanceAttributeNameMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace InstanceHealthStatusMapper
 {
 AWS_EC2_API InstanceHealthStatus GetInstanceHealthStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForInstanceHealthStatus(InstanceHealthStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForInstanceHealthStatus(InstanceHealthStatus value);
 } // namespace InstanceHealthStatusMapper
 } // namespace Model
 } // namespace EC2
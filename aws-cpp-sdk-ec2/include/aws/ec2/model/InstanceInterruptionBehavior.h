@@ -35,7 +35,8 @@ namespace InstanceInterruptionBehaviorMapper
 {
 AWS_EC2_API InstanceInterruptionBehavior GetInstanceInterruptionBehaviorForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForInstanceInterruptionBehavior(InstanceInterruptionBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForInstanceInterruptionBehavior(InstanceInterruptionBehavior value);
 } // namespace InstanceInterruptionBehaviorMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace InstanceLifecycleTypeMapper
 {
 AWS_EC2_API InstanceLifecycleType GetInstanceLifecycleTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForInstanceLifecycleType(InstanceLifecycleType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForInstanceLifecycleType(InstanceLifecycleType value);
 } // namespace InstanceLifecycleTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -38,7 +38,8 @@ namespace InstanceStateNameMapper
 {
 AWS_EC2_API InstanceStateName GetInstanceStateNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForInstanceStateName(InstanceStateName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForInstanceStateName(InstanceStateName value);
 } // namespace InstanceStateNameMapper
 } // namespace Model
 } // namespace EC2
@@ -174,7 +174,8 @@ namespace InstanceTypeMapper
 {
 AWS_EC2_API InstanceType GetInstanceTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForInstanceType(InstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForInstanceType(InstanceType value);
 } // namespace InstanceTypeMapper
 } // namespace Model
 } // namespace EC2
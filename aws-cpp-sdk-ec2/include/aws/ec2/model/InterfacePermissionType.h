@@ -34,7 +34,8 @@ namespace InterfacePermissionTypeMapper
 {
 AWS_EC2_API InterfacePermissionType GetInterfacePermissionTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForInterfacePermissionType(InterfacePermissionType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForInterfacePermissionType(InterfacePermissionType value);
 } // namespace InterfacePermissionTypeMapper
 } // namespace Model
 } // namespace EC2
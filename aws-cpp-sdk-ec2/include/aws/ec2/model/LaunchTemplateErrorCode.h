@@ -38,7 +38,8 @@ namespace LaunchTemplateErrorCodeMapper
 {
 AWS_EC2_API LaunchTemplateErrorCode GetLaunchTemplateErrorCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForLaunchTemplateErrorCode(LaunchTemplateErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForLaunchTemplateErrorCode(LaunchTemplateErrorCode value);
 } // namespace LaunchTemplateErrorCodeMapper
 } // namespace Model
 } // namespace EC2
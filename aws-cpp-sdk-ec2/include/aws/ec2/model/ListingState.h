@@ -36,7 +36,8 @@ namespace ListingStateMapper
 {
 AWS_EC2_API ListingState GetListingStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForListingState(ListingState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForListingState(ListingState value);
 } // namespace ListingStateMapper
 } // namespace Model
 } // namespace EC2
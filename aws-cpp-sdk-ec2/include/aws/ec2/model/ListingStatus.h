@@ -36,7 +36,8 @@ namespace ListingStatusMapper
 {
 AWS_EC2_API ListingStatus GetListingStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForListingStatus(ListingStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForListingStatus(ListingStatus value);
 } // namespace ListingStatusMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace LogDestinationTypeMapper
 {
 AWS_EC2_API LogDestinationType GetLogDestinationTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForLogDestinationType(LogDestinationType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForLogDestinationType(LogDestinationType value);
 } // namespace LogDestinationTypeMapper
 } // namespace Model
 } // namespace EC2
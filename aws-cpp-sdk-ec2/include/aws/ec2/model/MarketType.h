@@ -33,7 +33,8 @@ namespace MarketTypeMapper
 {
 AWS_EC2_API MarketType GetMarketTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForMarketType(MarketType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForMarketType(MarketType value);
 } // namespace MarketTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -36,7 +36,8 @@ namespace MonitoringStateMapper
 {
 AWS_EC2_API MonitoringState GetMonitoringStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForMonitoringState(MonitoringState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForMonitoringState(MonitoringState value);
 } // namespace MonitoringStateMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace MoveStatusMapper
 {
 AWS_EC2_API MoveStatus GetMoveStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForMoveStatus(MoveStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForMoveStatus(MoveStatus value);
 } // namespace MoveStatusMapper
 } // namespace Model
 } // namespace EC2
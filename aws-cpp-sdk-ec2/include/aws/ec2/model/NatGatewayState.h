@@ -37,7 +37,8 @@ namespace NatGatewayStateMapper
 {
 AWS_EC2_API NatGatewayState GetNatGatewayStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForNatGatewayState(NatGatewayState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForNatGatewayState(NatGatewayState value);
 } // namespace NatGatewayStateMapper
 } // namespace Model
 } // namespace EC2
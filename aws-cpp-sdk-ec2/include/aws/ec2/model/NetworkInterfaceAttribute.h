@@ -36,7 +36,8 @@ namespace NetworkInterfaceAttributeMapper
 {
 AWS_EC2_API NetworkInterfaceAttribute GetNetworkInterfaceAttributeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForNetworkInterfaceAttribute(NetworkInterfaceAttribute value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForNetworkInterfaceAttribute(NetworkInterfaceAttribute value);
 } // namespace NetworkInterfaceAttributeMapper
 } // namespace Model
 } // namespace EC2
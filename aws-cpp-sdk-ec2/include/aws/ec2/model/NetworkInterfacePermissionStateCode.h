@@ -36,7 +36,8 @@ namespace NetworkInterfacePermissionStateCodeMapper
 {
 AWS_EC2_API NetworkInterfacePermissionStateCode GetNetworkInterfacePermissionStateCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForNetworkInterfacePermissionStateCode(NetworkInterfacePermissionStateCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForNetworkInterfacePermissionStateCode(NetworkInterfacePermissionStateCode value);
 } // namespace NetworkInterfacePermissionStateCodeMapper
 } // namespace Model
 } // namespace EC2
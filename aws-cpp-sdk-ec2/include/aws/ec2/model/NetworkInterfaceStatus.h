@@ -37,7 +37,8 @@ namespace NetworkInterfaceStatusMapper
 {
 AWS_EC2_API NetworkInterfaceStatus GetNetworkInterfaceStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForNetworkInterfaceStatus(NetworkInterfaceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForNetworkInterfaceStatus(NetworkInterfaceStatus value);
 } // namespace NetworkInterfaceStatusMapper
 } // namespace Model
 } // namespace EC2
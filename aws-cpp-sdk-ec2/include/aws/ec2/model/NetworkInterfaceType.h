@@ -34,7 +34,8 @@ namespace NetworkInterfaceTypeMapper
 {
 AWS_EC2_API NetworkInterfaceType GetNetworkInterfaceTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForNetworkInterfaceType(NetworkInterfaceType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForNetworkInterfaceType(NetworkInterfaceType value);
 } // namespace NetworkInterfaceTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace OfferingClassTypeMapper
 {
 AWS_EC2_API OfferingClassType GetOfferingClassTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForOfferingClassType(OfferingClassType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForOfferingClassType(OfferingClassType value);
 } // namespace OfferingClassTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -38,7 +38,8 @@ namespace OfferingTypeValuesMapper
 {
 AWS_EC2_API OfferingTypeValues GetOfferingTypeValuesForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForOfferingTypeValues(OfferingTypeValues value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForOfferingTypeValues(OfferingTypeValues value);
 } // namespace OfferingTypeValuesMapper
 } // namespace Model
 } // namespace EC2
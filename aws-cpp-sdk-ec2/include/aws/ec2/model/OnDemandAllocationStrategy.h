@@ -34,7 +34,8 @@ namespace OnDemandAllocationStrategyMapper
 {
 AWS_EC2_API OnDemandAllocationStrategy GetOnDemandAllocationStrategyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForOnDemandAllocationStrategy(OnDemandAllocationStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForOnDemandAllocationStrategy(OnDemandAllocationStrategy value);
 } // namespace OnDemandAllocationStrategyMapper
 } // namespace Model
 } // namespace EC2
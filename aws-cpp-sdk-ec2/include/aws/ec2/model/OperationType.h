@@ -34,7 +34,8 @@ namespace OperationTypeMapper
 {
 AWS_EC2_API OperationType GetOperationTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForOperationType(OperationType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForOperationType(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace EC2
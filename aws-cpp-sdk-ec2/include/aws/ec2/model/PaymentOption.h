@@ -35,7 +35,8 @@ namespace PaymentOptionMapper
 {
 AWS_EC2_API PaymentOption GetPaymentOptionForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForPaymentOption(PaymentOption value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForPaymentOption(PaymentOption value);
 } // namespace PaymentOptionMapper
 } // namespace Model
 } // namespace EC2
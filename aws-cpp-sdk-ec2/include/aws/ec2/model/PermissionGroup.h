@@ -33,7 +33,8 @@ namespace PermissionGroupMapper
 {
 AWS_EC2_API PermissionGroup GetPermissionGroupForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForPermissionGroup(PermissionGroup value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForPermissionGroup(PermissionGroup value);
 } // namespace PermissionGroupMapper
 } // namespace Model
 } // namespace EC2
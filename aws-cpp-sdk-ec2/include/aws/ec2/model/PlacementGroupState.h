@@ -36,7 +36,8 @@ namespace PlacementGroupStateMapper
 {
 AWS_EC2_API PlacementGroupState GetPlacementGroupStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForPlacementGroupState(PlacementGroupState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForPlacementGroupState(PlacementGroupState value);
 } // namespace PlacementGroupStateMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace PlacementStrategyMapper
 {
 AWS_EC2_API PlacementStrategy GetPlacementStrategyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForPlacementStrategy(PlacementStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForPlacementStrategy(PlacementStrategy value);
 } // namespace PlacementStrategyMapper
 } // namespace Model
 } // namespace EC2
@@ -33,7 +33,8 @@ namespace PlatformValuesMapper
 {
 AWS_EC2_API PlatformValues GetPlatformValuesForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForPlatformValues(PlatformValues value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForPlatformValues(PlatformValues value);
 } // namespace PlatformValuesMapper
 } // namespace Model
 } // namespace EC2
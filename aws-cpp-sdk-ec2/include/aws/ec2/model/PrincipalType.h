@@ -38,7 +38,8 @@ namespace PrincipalTypeMapper
 {
 AWS_EC2_API PrincipalType GetPrincipalTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForPrincipalType(PrincipalType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForPrincipalType(PrincipalType value);
 } // namespace PrincipalTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace ProductCodeValuesMapper
 {
 AWS_EC2_API ProductCodeValues GetProductCodeValuesForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForProductCodeValues(ProductCodeValues value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForProductCodeValues(ProductCodeValues value);
 } // namespace ProductCodeValuesMapper
 } // namespace Model
 } // namespace EC2
@@ -36,7 +36,8 @@ namespace RIProductDescriptionMapper
 {
 AWS_EC2_API RIProductDescription GetRIProductDescriptionForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForRIProductDescription(RIProductDescription value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForRIProductDescription(RIProductDescription value);
 } // namespace RIProductDescriptionMapper
 } // namespace Model
 } // namespace EC2
@@ -33,7 +33,8 @@ namespace RecurringChargeFrequencyMapper
 {
 AWS_EC2_API RecurringChargeFrequency GetRecurringChargeFrequencyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForRecurringChargeFrequency(RecurringChargeFrequency value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForRecurringChargeFrequency(RecurringChargeFrequency value);
 } // namespace RecurringChargeFrequencyMapper
 } // namespace Model
 } // namespace EC2
@@ -41,7 +41,8 @@ namespace ReportInstanceReasonCodesMapper
 {
 AWS_EC2_API ReportInstanceReasonCodes GetReportInstanceReasonCodesForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForReportInstanceReasonCodes(ReportInstanceReasonCodes value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForReportInstanceReasonCodes(ReportInstanceReasonCodes value);
 } // namespace ReportInstanceReasonCodesMapper
 } // namespace Model
 } // namespace EC2
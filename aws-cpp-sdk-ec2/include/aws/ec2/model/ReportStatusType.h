@@ -34,7 +34,8 @@ namespace ReportStatusTypeMapper
 {
 AWS_EC2_API ReportStatusType GetReportStatusTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForReportStatusType(ReportStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForReportStatusType(ReportStatusType value);
 } // namespace ReportStatusTypeMapper
 } // namespace Model
 } // namespace EC2
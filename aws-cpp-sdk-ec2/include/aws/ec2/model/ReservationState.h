@@ -36,7 +36,8 @@ namespace ReservationStateMapper
 {
 AWS_EC2_API ReservationState GetReservationStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForReservationState(ReservationState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForReservationState(ReservationState value);
 } // namespace ReservationStateMapper
 } // namespace Model
 } // namespace EC2
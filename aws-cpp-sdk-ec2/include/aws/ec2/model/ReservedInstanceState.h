@@ -36,7 +36,8 @@ namespace ReservedInstanceStateMapper
 {
 AWS_EC2_API ReservedInstanceState GetReservedInstanceStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForReservedInstanceState(ReservedInstanceState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForReservedInstanceState(ReservedInstanceState value);
 } // namespace ReservedInstanceStateMapper
 } // namespace Model
 } // namespace EC2
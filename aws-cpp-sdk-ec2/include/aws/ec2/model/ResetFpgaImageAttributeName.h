@@ -33,7 +33,8 @@ namespace ResetFpgaImageAttributeNameMapper
 {
 AWS_EC2_API ResetFpgaImageAttributeName GetResetFpgaImageAttributeNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForResetFpgaImageAttributeName(ResetFpgaImageAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForResetFpgaImageAttributeName(ResetFpgaImageAttributeName value);
 } // namespace ResetFpgaImageAttributeNameMapper
 } // namespace Model
 } // namespace EC2
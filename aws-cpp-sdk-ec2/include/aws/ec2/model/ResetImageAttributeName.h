@@ -33,7 +33,8 @@ namespace ResetImageAttributeNameMapper
 {
 AWS_EC2_API ResetImageAttributeName GetResetImageAttributeNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForResetImageAttributeName(ResetImageAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForResetImageAttributeName(ResetImageAttributeName value);
 } // namespace ResetImageAttributeNameMapper
 } // namespace Model
 } // namespace EC2
@@ -49,7 +49,8 @@ namespace ResourceTypeMapper
 {
 AWS_EC2_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForResourceType(ResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForResourceType(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace EC2
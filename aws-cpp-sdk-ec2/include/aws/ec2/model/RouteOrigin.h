@@ -35,7 +35,8 @@ namespace RouteOriginMapper
 {
 AWS_EC2_API RouteOrigin GetRouteOriginForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForRouteOrigin(RouteOrigin value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForRouteOrigin(RouteOrigin value);
 } // namespace RouteOriginMapper
 } // namespace Model
 } // namespace EC2
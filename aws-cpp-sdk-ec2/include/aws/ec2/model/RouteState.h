@@ -34,7 +34,8 @@ namespace RouteStateMapper
 {
 AWS_EC2_API RouteState GetRouteStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForRouteState(RouteState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForRouteState(RouteState value);
 } // namespace RouteStateMapper
 } // namespace Model
 } // namespace EC2
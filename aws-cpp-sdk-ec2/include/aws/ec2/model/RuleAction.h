@@ -34,7 +34,8 @@ namespace RuleActionMapper
 {
 AWS_EC2_API RuleAction GetRuleActionForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForRuleAction(RuleAction value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForRuleAction(RuleAction value);
 } // namespace RuleActionMapper
 } // namespace Model
 } // namespace EC2
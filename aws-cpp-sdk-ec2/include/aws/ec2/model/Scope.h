@@ -34,7 +34,8 @@ namespace ScopeMapper
 {
 AWS_EC2_API Scope GetScopeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForScope(Scope value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForScope(Scope value);
 } // namespace ScopeMapper
 } // namespace Model
 } // namespace EC2
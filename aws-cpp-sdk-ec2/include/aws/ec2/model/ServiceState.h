@@ -37,7 +37,8 @@ namespace ServiceStateMapper
 {
 AWS_EC2_API ServiceState GetServiceStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForServiceState(ServiceState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForServiceState(ServiceState value);
 } // namespace ServiceStateMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace ServiceTypeMapper
 {
 AWS_EC2_API ServiceType GetServiceTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForServiceType(ServiceType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForServiceType(ServiceType value);
 } // namespace ServiceTypeMapper
 } // namespace Model
 } // namespace EC2
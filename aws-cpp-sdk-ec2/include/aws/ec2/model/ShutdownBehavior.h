@@ -34,7 +34,8 @@ namespace ShutdownBehaviorMapper
 {
 AWS_EC2_API ShutdownBehavior GetShutdownBehaviorForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForShutdownBehavior(ShutdownBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForShutdownBehavior(ShutdownBehavior value);
 } // namespace ShutdownBehaviorMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace SnapshotAttributeNameMapper
 {
 AWS_EC2_API SnapshotAttributeName GetSnapshotAttributeNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForSnapshotAttributeName(SnapshotAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForSnapshotAttributeName(SnapshotAttributeName value);
 } // namespace SnapshotAttributeNameMapper
 } // namespace Model
 } // namespace EC2
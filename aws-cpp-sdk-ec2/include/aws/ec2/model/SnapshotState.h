@@ -35,7 +35,8 @@ namespace SnapshotStateMapper
 {
 AWS_EC2_API SnapshotState GetSnapshotStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForSnapshotState(SnapshotState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForSnapshotState(SnapshotState value);
 } // namespace SnapshotStateMapper
 } // namespace Model
 } // namespace EC2
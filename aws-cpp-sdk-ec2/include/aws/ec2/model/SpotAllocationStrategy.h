@@ -34,7 +34,8 @@ namespace SpotAllocationStrategyMapper
 {
 AWS_EC2_API SpotAllocationStrategy GetSpotAllocationStrategyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForSpotAllocationStrategy(SpotAllocationStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForSpotAllocationStrategy(SpotAllocationStrategy value);
 } // namespace SpotAllocationStrategyMapper
 } // namespace Model
 } // namespace EC2
@@ -35,7 +35,8 @@ namespace SpotInstanceInterruptionBehaviorMapper
 {
 AWS_EC2_API SpotInstanceInterruptionBehavior GetSpotInstanceInterruptionBehaviorForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForSpotInstanceInterruptionBehavior(SpotInstanceInterruptionBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForSpotInstanceInterruptionBehavior(SpotInstanceInterruptionBehavior value);
 } // namespace SpotInstanceInterruptionBehaviorMapper
 } // namespace Model
 } // namespace EC2
@@ -38,7 +38,8 @@ namespace SpotInstanceStateMapper
 {
 AWS_EC2_API SpotInstanceState GetSpotInstanceStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForSpotInstanceState(SpotInstanceState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForSpotInstanceState(SpotInstanceState value);
 } // namespace SpotInstanceStateMapper
 } // namespace Model
 } // namespace EC2
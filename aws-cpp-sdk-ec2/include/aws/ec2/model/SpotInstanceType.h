@@ -34,7 +34,8 @@ namespace SpotInstanceTypeMapper
 {
 AWS_EC2_API SpotInstanceType GetSpotInstanceTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForSpotInstanceType(SpotInstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForSpotInstanceType(SpotInstanceType value);
 } // namespace SpotInstanceTypeMapper
 } // namespace Model
 } // namespace EC2
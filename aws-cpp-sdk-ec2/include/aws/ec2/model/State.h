@@ -40,7 +40,8 @@ namespace StateMapper
 {
 AWS_EC2_API State GetStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForState(State value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForState(State value);
 } // namespace StateMapper
 } // namespace Model
 } // namespace EC2
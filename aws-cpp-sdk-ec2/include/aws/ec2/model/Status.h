@@ -35,7 +35,8 @@ namespace StatusMapper
 {
 AWS_EC2_API Status GetStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForStatus(Status value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForStatus(Status value);
 } // namespace StatusMapper
 } // namespace Model
 } // namespace EC2
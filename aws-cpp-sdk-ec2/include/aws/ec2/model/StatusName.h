@@ -33,7 +33,8 @@ namespace StatusNameMapper
 {
 AWS_EC2_API StatusName GetStatusNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForStatusName(StatusName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForStatusName(StatusName value);
 } // namespace StatusNameMapper
 } // namespace Model
 } // namespace EC2
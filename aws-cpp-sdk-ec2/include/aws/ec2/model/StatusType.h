@@ -36,7 +36,8 @@ namespace StatusTypeMapper
 {
 AWS_EC2_API StatusType GetStatusTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForStatusType(StatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForStatusType(StatusType value);
 } // namespace StatusTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -38,7 +38,8 @@ namespace SubnetCidrBlockStateCodeMapper
 {
 AWS_EC2_API SubnetCidrBlockStateCode GetSubnetCidrBlockStateCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForSubnetCidrBlockStateCode(SubnetCidrBlockStateCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForSubnetCidrBlockStateCode(SubnetCidrBlockStateCode value);
 } // namespace SubnetCidrBlockStateCodeMapper
 } // namespace Model
 } // namespace EC2
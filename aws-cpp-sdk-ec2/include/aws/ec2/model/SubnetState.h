@@ -34,7 +34,8 @@ namespace SubnetStateMapper
 {
 AWS_EC2_API SubnetState GetSubnetStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForSubnetState(SubnetState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForSubnetState(SubnetState value);
 } // namespace SubnetStateMapper
 } // namespace Model
 } // namespace EC2
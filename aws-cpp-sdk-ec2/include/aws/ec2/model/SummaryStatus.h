@@ -37,7 +37,8 @@ namespace SummaryStatusMapper
 {
 AWS_EC2_API SummaryStatus GetSummaryStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForSummaryStatus(SummaryStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForSummaryStatus(SummaryStatus value);
 } // namespace SummaryStatusMapper
 } // namespace Model
 } // namespace EC2
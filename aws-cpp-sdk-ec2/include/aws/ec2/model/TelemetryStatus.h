@@ -34,7 +34,8 @@ namespace TelemetryStatusMapper
 {
 AWS_EC2_API TelemetryStatus GetTelemetryStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForTelemetryStatus(TelemetryStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForTelemetryStatus(TelemetryStatus value);
 } // namespace TelemetryStatusMapper
 } // namespace Model
 } // namespace EC2
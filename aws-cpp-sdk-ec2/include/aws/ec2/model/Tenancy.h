@@ -35,7 +35,8 @@ namespace TenancyMapper
 {
 AWS_EC2_API Tenancy GetTenancyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForTenancy(Tenancy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForTenancy(Tenancy value);
 } // namespace TenancyMapper
 } // namespace Model
 } // namespace EC2
@@ -35,7 +35,8 @@ namespace TrafficTypeMapper
 {
 AWS_EC2_API TrafficType GetTrafficTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForTrafficType(TrafficType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForTrafficType(TrafficType value);
 } // namespace TrafficTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -36,7 +36,8 @@ namespace UnsuccessfulInstanceCreditSpecificationErrorCodeMapper
 {
 AWS_EC2_API UnsuccessfulInstanceCreditSpecificationErrorCode GetUnsuccessfulInstanceCreditSpecificationErrorCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForUnsuccessfulInstanceCreditSpecificationErrorCode(UnsuccessfulInstanceCreditSpecificationErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForUnsuccessfulInstanceCreditSpecificationErrorCode(UnsuccessfulInstanceCreditSpecificationErrorCode value);
 } // namespace UnsuccessfulInstanceCreditSpecificationErrorCodeMapper
 } // namespace Model
 } // namespace EC2
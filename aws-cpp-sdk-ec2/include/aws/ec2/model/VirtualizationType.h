@@ -34,7 +34,8 @@ namespace VirtualizationTypeMapper
 {
 AWS_EC2_API VirtualizationType GetVirtualizationTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVirtualizationType(VirtualizationType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVirtualizationType(VirtualizationType value);
 } // namespace VirtualizationTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -37,7 +37,8 @@ namespace VolumeAttachmentStateMapper
 {
 AWS_EC2_API VolumeAttachmentState GetVolumeAttachmentStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVolumeAttachmentState(VolumeAttachmentState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVolumeAttachmentState(VolumeAttachmentState value);
 } // namespace VolumeAttachmentStateMapper
 } // namespace Model
 } // namespace EC2
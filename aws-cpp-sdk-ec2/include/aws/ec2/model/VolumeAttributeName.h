@@ -34,7 +34,8 @@ namespace VolumeAttributeNameMapper
 {
 AWS_EC2_API VolumeAttributeName GetVolumeAttributeNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVolumeAttributeName(VolumeAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVolumeAttributeName(VolumeAttributeName value);
 } // namespace VolumeAttributeNameMapper
 } // namespace Model
 } // namespace EC2
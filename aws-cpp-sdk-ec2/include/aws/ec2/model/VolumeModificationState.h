@@ -36,7 +36,8 @@ namespace VolumeModificationStateMapper
 {
 AWS_EC2_API VolumeModificationState GetVolumeModificationStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVolumeModificationState(VolumeModificationState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVolumeModificationState(VolumeModificationState value);
 } // namespace VolumeModificationStateMapper
 } // namespace Model
 } // namespace EC2
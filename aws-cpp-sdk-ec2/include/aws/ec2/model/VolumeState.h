@@ -38,7 +38,8 @@ namespace VolumeStateMapper
 {
 AWS_EC2_API VolumeState GetVolumeStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVolumeState(VolumeState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVolumeState(VolumeState value);
 } // namespace VolumeStateMapper
 } // namespace Model
 } // namespace EC2
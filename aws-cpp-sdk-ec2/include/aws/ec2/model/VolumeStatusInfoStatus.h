@@ -35,7 +35,8 @@ namespace VolumeStatusInfoStatusMapper
 {
 AWS_EC2_API VolumeStatusInfoStatus GetVolumeStatusInfoStatusForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVolumeStatusInfoStatus(VolumeStatusInfoStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVolumeStatusInfoStatus(VolumeStatusInfoStatus value);
 } // namespace VolumeStatusInfoStatusMapper
 } // namespace Model
 } // namespace EC2
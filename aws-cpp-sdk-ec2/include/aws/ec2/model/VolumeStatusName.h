@@ -34,7 +34,8 @@ namespace VolumeStatusNameMapper
 {
 AWS_EC2_API VolumeStatusName GetVolumeStatusNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVolumeStatusName(VolumeStatusName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVolumeStatusName(VolumeStatusName value);
 } // namespace VolumeStatusNameMapper
 } // namespace Model
 } // namespace EC2
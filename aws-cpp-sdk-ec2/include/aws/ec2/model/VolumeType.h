@@ -37,7 +37,8 @@ namespace VolumeTypeMapper
 {
 AWS_EC2_API VolumeType GetVolumeTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVolumeType(VolumeType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVolumeType(VolumeType value);
 } // namespace VolumeTypeMapper
 } // namespace Model
 } // namespace EC2
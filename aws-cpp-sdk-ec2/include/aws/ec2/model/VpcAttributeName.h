@@ -34,7 +34,8 @@ namespace VpcAttributeNameMapper
 {
 AWS_EC2_API VpcAttributeName GetVpcAttributeNameForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVpcAttributeName(VpcAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVpcAttributeName(VpcAttributeName value);
 } // namespace VpcAttributeNameMapper
 } // namespace Model
 } // namespace EC2
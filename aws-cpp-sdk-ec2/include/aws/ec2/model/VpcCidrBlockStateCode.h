@@ -38,7 +38,8 @@ namespace VpcCidrBlockStateCodeMapper
 {
 AWS_EC2_API VpcCidrBlockStateCode GetVpcCidrBlockStateCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVpcCidrBlockStateCode(VpcCidrBlockStateCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVpcCidrBlockStateCode(VpcCidrBlockStateCode value);
 } // namespace VpcCidrBlockStateCodeMapper
 } // namespace Model
 } // namespace EC2
@@ -34,7 +34,8 @@ namespace VpcEndpointTypeMapper
 {
 AWS_EC2_API VpcEndpointType GetVpcEndpointTypeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVpcEndpointType(VpcEndpointType value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVpcEndpointType(VpcEndpointType value);
 } // namespace VpcEndpointTypeMapper
 } // namespace Model
 } // namespace EC2
@@ -41,7 +41,8 @@ namespace VpcPeeringConnectionStateReasonCodeMapper
 {
 AWS_EC2_API VpcPeeringConnectionStateReasonCode GetVpcPeeringConnectionStateReasonCodeForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVpcPeeringConnectionStateReasonCode(VpcPeeringConnectionStateReasonCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVpcPeeringConnectionStateReasonCode(VpcPeeringConnectionStateReasonCode value);
 } // namespace VpcPeeringConnectionStateReasonCodeMapper
 } // namespace Model
 } // namespace EC2
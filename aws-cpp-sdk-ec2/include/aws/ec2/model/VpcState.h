@@ -34,7 +34,8 @@ namespace VpcStateMapper
 {
 AWS_EC2_API VpcState GetVpcStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVpcState(VpcState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVpcState(VpcState value);
 } // namespace VpcStateMapper
 } // namespace Model
 } // namespace EC2
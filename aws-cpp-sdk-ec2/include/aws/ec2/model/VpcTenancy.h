@@ -33,7 +33,8 @@ namespace VpcTenancyMapper
 {
 AWS_EC2_API VpcTenancy GetVpcTenancyForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVpcTenancy(VpcTenancy value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVpcTenancy(VpcTenancy value);
 } // namespace VpcTenancyMapper
 } // namespace Model
 } // namespace EC2
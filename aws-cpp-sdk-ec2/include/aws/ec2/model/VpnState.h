@@ -36,7 +36,8 @@ namespace VpnStateMapper
 {
 AWS_EC2_API VpnState GetVpnStateForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVpnState(VpnState value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVpnState(VpnState value);
 } // namespace VpnStateMapper
 } // namespace Model
 } // namespace EC2
@@ -33,7 +33,8 @@ namespace VpnStaticRouteSourceMapper
 {
 AWS_EC2_API VpnStaticRouteSource GetVpnStaticRouteSourceForName(const Aws::String& name);
 
-AWS_EC2_API Aws::String GetNameForVpnStaticRouteSource(VpnStaticRouteSource value);
+// names of values not modeled point into the enum overflow container
+AWS_EC2_API const char* GetNameForVpnStaticRouteSource(VpnStaticRouteSource value);
 } // namespace VpnStaticRouteSourceMapper
 } // namespace Model
 } // namespace EC2
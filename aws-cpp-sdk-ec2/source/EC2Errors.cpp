@@ -28,179 +28,179 @@ namespace EC2
 namespace EC2ErrorMapper
 {
 
-static const int INVALID_A_M_I_NAME__DUPLICATE_HASH = HashingUtils::HashString("InvalidAMIName.Duplicate");
-static const int BUNDLING_IN_PROGRESS_HASH = HashingUtils::HashString("BundlingInProgress");
-static const int INVALID_BLOCK_DEVICE_MAPPING_HASH = HashingUtils::HashString("InvalidBlockDeviceMapping");
-static const int INCORRECT_STATE_HASH = HashingUtils::HashString("IncorrectState");
-static const int INVALID_KEY__FORMAT_HASH = HashingUtils::HashString("InvalidKey.Format");
-static const int INVALID_RESERVED_INSTANCES_ID_HASH = HashingUtils::HashString("InvalidReservedInstancesId");
-static const int INVALID_VPC__RANGE_HASH = HashingUtils::HashString("InvalidVpc.Range");
-static const int ROUTE_ALREADY_EXISTS_HASH = HashingUtils::HashString("RouteAlreadyExists");
-static const int INVALID_A_M_I_I_D__MALFORMED_HASH = HashingUtils::HashString("InvalidAMIID.Malformed");
-static const int CANNOT_DELETE_HASH = HashingUtils::HashString("CannotDelete");
-static const int INVALID_FORMAT_HASH = HashingUtils::HashString("InvalidFormat");
-static const int INVALID_CUSTOMER_GATEWAY_ID__MALFORMED_HASH = HashingUtils::HashString("InvalidCustomerGatewayId.Malformed");
-static const int LEGACY_SECURITY_GROUP_HASH = HashingUtils::HashString("LegacySecurityGroup");
-static const int INVALID_I_P_ADDRESS__IN_USE_HASH = HashingUtils::HashString("InvalidIPAddress.InUse");
-static const int INVALID_SNAPSHOT__IN_USE_HASH = HashingUtils::HashString("InvalidSnapshot.InUse");
-static const int INVALID_INTERFACE__IP_ADDRESS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("InvalidInterface.IpAddressLimitExceeded");
-static const int INVALID_SNAPSHOT__NOT_FOUND_HASH = HashingUtils::HashString("InvalidSnapshot.NotFound");
-static const int ROUTE_TABLE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("RouteTableLimitExceeded");
-static const int PENDING_SNAPSHOT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("PendingSnapshotLimitExceeded");
-static const int INVALID_SPOT_INSTANCE_REQUEST_I_D__MALFORMED_HASH = HashingUtils::HashString("InvalidSpotInstanceRequestID.Malformed");
-static const int RESERVED_INSTANCES_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ReservedInstancesLimitExceeded");
-static const int INVALID_VPC_ENDPOINT_ID__NOT_FOUND_HASH = HashingUtils::HashString("InvalidVpcEndpointId.NotFound");
-static const int INVALID_ZONE__NOT_FOUND_HASH = HashingUtils::HashString("InvalidZone.NotFound");
-static const int VOLUME_IN_USE_HASH = HashingUtils::HashString("VolumeInUse");
-static const int INVALID_A_M_I_I_D__UNAVAILABLE_HASH = HashingUtils::HashString("InvalidAMIID.Unavailable");
-static const int ROUTE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("RouteLimitExceeded");
-static const int NON_E_B_S_INSTANCE_HASH = HashingUtils::HashString("NonEBSInstance");
-static const int FLOW_LOG_ALREADY_EXISTS_HASH = HashingUtils::HashString("FlowLogAlreadyExists");
-static const int INVALID_VOLUME_I_D__ZONE_MISMATCH_HASH = HashingUtils::HashString("InvalidVolumeID.ZoneMismatch");
-static const int INVALID_KEY_PAIR__FORMAT_HASH = HashingUtils::HashString("InvalidKeyPair.Format");
-static const int INVALID_KEY_PAIR__NOT_FOUND_HASH = HashingUtils::HashString("InvalidKeyPair.NotFound");
-static const int INVALID_INSTANCE_I_D__NOT_LINKABLE_HASH = HashingUtils::HashString("InvalidInstanceID.NotLinkable");
-static const int INVALID_VPC_ENDPOINT_ID__MALFORMED_HASH = HashingUtils::HashString("InvalidVpcEndpointId.Malformed");
-static const int INVALID_SPOT_FLEET_REQUEST_ID__MALFORMED_HASH = HashingUtils::HashString("InvalidSpotFleetRequestId.Malformed");
-static const int INVALID_RESERVED_INSTANCES_OFFERING_ID_HASH = HashingUtils::HashString("InvalidReservedInstancesOfferingId");
-static const int TAG_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TagLimitExceeded");
-static const int DISK_IMAGE_SIZE_TOO_LARGE_HASH = HashingUtils::HashString("DiskImageSizeTooLarge");
-static const int INVALID_A_M_I_ATTRIBUTE_ITEM_VALUE_HASH = HashingUtils::HashString("InvalidAMIAttributeItemValue");
-static const int V_P_C_RESOURCE_NOT_SPECIFIED_HASH = HashingUtils::HashString("VPCResourceNotSpecified");
-static const int INSUFFICIENT_RESERVED_INSTANCES_CAPACITY_HASH = HashingUtils::HashString("InsufficientReservedInstancesCapacity");
-static const int CONCURRENT_SNAPSHOT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ConcurrentSnapshotLimitExceeded");
-static const int INSUFFICIENT_FREE_ADDRESSES_IN_SUBNET_HASH = HashingUtils::HashString("InsufficientFreeAddressesInSubnet");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequest");
-static const int INVALID_GROUP__IN_USE_HASH = HashingUtils::HashString("InvalidGroup.InUse");
-static const int INVALID_SPOT_DATAFEED__NOT_FOUND_HASH = HashingUtils::HashString("InvalidSpotDatafeed.NotFound");
-static const int INVALID_STATE_TRANSITION_HASH = HashingUtils::HashString("InvalidStateTransition");
-static const int ADDRESS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AddressLimitExceeded");
-static const int VOLUME_TYPE_NOT_AVAILABLE_IN_ZONE_HASH = HashingUtils::HashString("VolumeTypeNotAvailableInZone");
-static const int VPN_GATEWAY_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("VpnGatewayAttachmentLimitExceeded");
-static const int INVALID_SPOT_FLEET_REQUEST_CONFIG_HASH = HashingUtils::HashString("InvalidSpotFleetRequestConfig");
-static const int CUSTOMER_GATEWAY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("CustomerGatewayLimitExceeded");
-static const int INVALID_GROUP_ID__MALFORMED_HASH = HashingUtils::HashString("InvalidGroupId.Malformed");
-static const int INVALID_VPC_PEERING_CONNECTION_ID__MALFORMED_HASH = HashingUtils::HashString("InvalidVpcPeeringConnectionId.Malformed");
-static const int INVALID_GROUP__RESERVED_HASH = HashingUtils::HashString("InvalidGroup.Reserved");
-static const int NETWORK_ACL_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("NetworkAclLimitExceeded");
-static const int INVALID_SECURITY__REQUEST_HAS_EXPIRED_HASH = HashingUtils::HashString("InvalidSecurity.RequestHasExpired");
-static const int VPC_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("VpcLimitExceeded");
-static const int INSTANCE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("InstanceLimitExceeded");
-static const int RESOURCE_COUNT_EXCEEDED_HASH = HashingUtils::HashString("ResourceCountExceeded");
-static const int UNKNOWN_VOLUME_TYPE_HASH = HashingUtils::HashString("UnknownVolumeType");
-static const int INVALID_I_D_HASH = HashingUtils::HashString("InvalidID");
-static const int SECURITY_GROUPS_PER_INSTANCE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("SecurityGroupsPerInstanceLimitExceeded");
-static const int INVALID_PERMISSION__NOT_FOUND_HASH = HashingUtils::HashString("InvalidPermission.NotFound");
-static const int INSTANCE_ALREADY_LINKED_HASH = HashingUtils::HashString("InstanceAlreadyLinked");
-static const int INVALID_RESERVATION_I_D__MALFORMED_HASH = HashingUtils::HashString("InvalidReservationID.Malformed");
-static const int INVALID_INSTANCE_TYPE_HASH = HashingUtils::HashString("InvalidInstanceType");
-static const int INVALID_PERMISSION__DUPLICATE_HASH = HashingUtils::HashString("InvalidPermission.Duplicate");
-static const int INVALID_VPC_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidVpcID.NotFound");
-static const int INVALID_ATTACHMENT_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidAttachmentID.NotFound");
-static const int INVALID_KEY_PAIR__DUPLICATE_HASH = HashingUtils::HashString("InvalidKeyPair.Duplicate");
-static const int PRIVATE_IP_ADDRESS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("PrivateIpAddressLimitExceeded");
-static const int INVALID_ROUTE_TABLE_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidRouteTableID.NotFound");
-static const int INVALID_PERMISSION__MALFORMED_HASH = HashingUtils::HashString("InvalidPermission.Malformed");
-static const int INVALID_ROUTE_TABLE_ID__MALFORMED_HASH = HashingUtils::HashString("InvalidRouteTableId.Malformed");
-static const int MAX_SPOT_FLEET_REQUEST_COUNT_EXCEEDED_HASH = HashingUtils::HashString("MaxSpotFleetRequestCountExceeded");
-static const int INVALID_VOLUME__ZONE_MISMATCH_HASH = HashingUtils::HashString("InvalidVolume.ZoneMismatch");
-static const int ACTIVE_VPC_PEERING_CONNECTION_PER_VPC_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ActiveVpcPeeringConnectionPerVpcLimitExceeded");
-static const int MAX_I_O_P_S_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("MaxIOPSLimitExceeded");
-static const int UNSUPPORTED_HASH = HashingUtils::HashString("Unsupported");
-static const int INVALID_DHCP_OPTION_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidDhcpOptionID.NotFound");
-static const int INVALID_PREFIX_LIST_ID__MALFORMED_HASH = HashingUtils::HashString("InvalidPrefixListId.Malformed");
-static const int VOLUME_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("VolumeLimitExceeded");
-static const int INVALID_VPN_CONNECTION_I_D_HASH = HashingUtils::HashString("InvalidVpnConnectionID");
-static const int INVALID_GATEWAY_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidGatewayID.NotFound");
-static const int INVALID_DEVICE__IN_USE_HASH = HashingUtils::HashString("InvalidDevice.InUse");
-static const int INVALID_GROUP__NOT_FOUND_HASH = HashingUtils::HashString("InvalidGroup.NotFound");
-static const int INVALID_SPOT_FLEET_REQUEST_ID__NOT_FOUND_HASH = HashingUtils::HashString("InvalidSpotFleetRequestId.NotFound");
-static const int FILTER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("FilterLimitExceeded");
-static const int VPC_ENDPOINT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("VpcEndpointLimitExceeded");
-static const int INVALID_VOLUME__NOT_FOUND_HASH = HashingUtils::HashString("InvalidVolume.NotFound");
-static const int INVALID_INSTANCE_ATTRIBUTE_VALUE_HASH = HashingUtils::HashString("InvalidInstanceAttributeValue");
-static const int SECURITY_GROUPS_PER_INTERFACE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("SecurityGroupsPerInterfaceLimitExceeded");
-static const int MAX_SPOT_INSTANCE_COUNT_EXCEEDED_HASH = HashingUtils::HashString("MaxSpotInstanceCountExceeded");
-static const int SNAPSHOT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("SnapshotLimitExceeded");
-static const int INVALID_ATTACHMENT__NOT_FOUND_HASH = HashingUtils::HashString("InvalidAttachment.NotFound");
-static const int INVALID_CUSTOMER_GATEWAY__DUPLICATE_IP_ADDRESS_HASH = HashingUtils::HashString("InvalidCustomerGateway.DuplicateIpAddress");
-static const int INVALID_VPN_GATEWAY_ATTACHMENT__NOT_FOUND_HASH = HashingUtils::HashString("InvalidVpnGatewayAttachment.NotFound");
-static const int INVALID_DHCP_OPTIONS_ID__MALFORMED_HASH = HashingUtils::HashString("InvalidDhcpOptionsId.Malformed");
-static const int NETWORK_ACL_ENTRY_ALREADY_EXISTS_HASH = HashingUtils::HashString("NetworkAclEntryAlreadyExists");
-static const int INVALID_STATE_HASH = HashingUtils::HashString("InvalidState");
-static const int UNSUPPORTED_OPERATION_HASH = HashingUtils::HashString("UnsupportedOperation");
-static const int VPN_GATEWAY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("VpnGatewayLimitExceeded");
-static const int INVALID_ADDRESS__NOT_FOUND_HASH = HashingUtils::HashString("InvalidAddress.NotFound");
-static const int INVALID_PREFIX_LIST_ID__NOT_FOUND_HASH = HashingUtils::HashString("InvalidPrefixListId.NotFound");
-static const int INTERNET_GATEWAY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("InternetGatewayLimitExceeded");
-static const int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ResourceLimitExceeded");
-static const int CONCURRENT_TAG_ACCESS_HASH = HashingUtils::HashString("ConcurrentTagAccess");
-static const int INVALID_INSTANCE_I_D_HASH = HashingUtils::HashString("InvalidInstanceID");
-static const int INVALID_ROUTE__MALFORMED_HASH = HashingUtils::HashString("InvalidRoute.Malformed");
-static const int INVALID_SUBNET_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidSubnetID.NotFound");
-static const int INVALID_NETWORK_INTERFACE_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidNetworkInterfaceID.NotFound");
-static const int V_P_C_ID_NOT_SPECIFIED_HASH = HashingUtils::HashString("VPCIdNotSpecified");
-static const int GATEWAY__NOT_ATTACHED_HASH = HashingUtils::HashString("Gateway.NotAttached");
-static const int INVALID_CUSTOMER_GATEWAY_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidCustomerGatewayID.NotFound");
-static const int INVALID_GROUP__DUPLICATE_HASH = HashingUtils::HashString("InvalidGroup.Duplicate");
-static const int NOT_EXPORTABLE_HASH = HashingUtils::HashString("NotExportable");
-static const int SECURITY_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("SecurityGroupLimitExceeded");
-static const int INVALID_SECURITY_GROUP_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidSecurityGroupID.NotFound");
-static const int NETWORK_ACL_ENTRY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("NetworkAclEntryLimitExceeded");
-static const int INVALID_PLACEMENT_GROUP__DUPLICATE_HASH = HashingUtils::HashString("InvalidPlacementGroup.Duplicate");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInput");
-static const int INVALID_USER_I_D__MALFORMED_HASH = HashingUtils::HashString("InvalidUserID.Malformed");
-static const int REQUEST_RESOURCE_COUNT_EXCEEDED_HASH = HashingUtils::HashString("RequestResourceCountExceeded");
-static const int INVALID_NETWORK_ACL_ENTRY__NOT_FOUND_HASH = HashingUtils::HashString("InvalidNetworkAclEntry.NotFound");
-static const int INVALID_SERVICE_NAME_HASH = HashingUtils::HashString("InvalidServiceName");
-static const int INVALID_INTERNET_GATEWAY_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidInternetGatewayID.NotFound");
-static const int INVALID_POLICY_DOCUMENT_HASH = HashingUtils::HashString("InvalidPolicyDocument");
-static const int INVALID_FLOW_LOG_ID__NOT_FOUND_HASH = HashingUtils::HashString("InvalidFlowLogId.NotFound");
-static const int INVALID_CONVERSION_TASK_ID_HASH = HashingUtils::HashString("InvalidConversionTaskId");
-static const int INVALID_SNAPSHOT_I_D__MALFORMED_HASH = HashingUtils::HashString("InvalidSnapshotID.Malformed");
-static const int FLOW_LOGS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("FlowLogsLimitExceeded");
-static const int INVALID_ADDRESS_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidAddressID.NotFound");
-static const int INVALID_VPC_STATE_HASH = HashingUtils::HashString("InvalidVpcState");
-static const int INVALID_ADDRESS__MALFORMED_HASH = HashingUtils::HashString("InvalidAddress.Malformed");
-static const int INVALID_NETWORK_INTERFACE_ATTACHMENT_I_D__MALFORMED_HASH = HashingUtils::HashString("InvalidNetworkInterfaceAttachmentID.Malformed");
-static const int VPC_CIDR_CONFLICT_HASH = HashingUtils::HashString("VpcCidrConflict");
-static const int INVALID_FILTER_HASH = HashingUtils::HashString("InvalidFilter");
-static const int INVALID_MANIFEST_HASH = HashingUtils::HashString("InvalidManifest");
-static const int OUTSTANDING_VPC_PEERING_CONNECTION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OutstandingVpcPeeringConnectionLimitExceeded");
-static const int DEPENDENCY_VIOLATION_HASH = HashingUtils::HashString("DependencyViolation");
-static const int INVALID_SPOT_INSTANCE_REQUEST_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidSpotInstanceRequestID.NotFound");
-static const int RESOURCE__ALREADY_ASSOCIATED_HASH = HashingUtils::HashString("Resource.AlreadyAssociated");
-static const int INVALID_NETWORK_ACL_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidNetworkAclID.NotFound");
-static const int INVALID_A_M_I_NAME__MALFORMED_HASH = HashingUtils::HashString("InvalidAMIName.Malformed");
-static const int INVALID_RESERVATION_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidReservationID.NotFound");
-static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OperationNotPermitted");
-static const int INVALID_NETWORK_INTERFACE_ID__MALFORMED_HASH = HashingUtils::HashString("InvalidNetworkInterfaceId.Malformed");
-static const int INVALID_SUBNET__CONFLICT_HASH = HashingUtils::HashString("InvalidSubnet.Conflict");
-static const int VPN_CONNECTION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("VpnConnectionLimitExceeded");
-static const int DRY_RUN_OPERATION_HASH = HashingUtils::HashString("DryRunOperation");
-static const int INVALID_VPN_CONNECTION_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidVpnConnectionID.NotFound");
-static const int INVALID_ROUTE__NOT_FOUND_HASH = HashingUtils::HashString("InvalidRoute.NotFound");
-static const int INVALID_OPTION__CONFLICT_HASH = HashingUtils::HashString("InvalidOption.Conflict");
-static const int INVALID_VPN_GATEWAY_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidVpnGatewayID.NotFound");
-static const int ENCRYPTED_VOLUMES_NOT_SUPPORTED_HASH = HashingUtils::HashString("EncryptedVolumesNotSupported");
-static const int INVALID_PLACEMENT_GROUP__UNKNOWN_HASH = HashingUtils::HashString("InvalidPlacementGroup.Unknown");
-static const int SUBNET_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("SubnetLimitExceeded");
-static const int INVALID_DHCP_OPTIONS_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidDhcpOptionsID.NotFound");
-static const int RULES_PER_SECURITY_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("RulesPerSecurityGroupLimitExceeded");
-static const int INVALID_INSTANCE_I_D__MALFORMED_HASH = HashingUtils::HashString("InvalidInstanceID.Malformed");
-static const int INVALID_EXPORT_TASK_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidExportTaskID.NotFound");
-static const int INVALID_ALLOCATION_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidAllocationID.NotFound");
-static const int VPC_PEERING_CONNECTION_ALREADY_EXISTS_HASH = HashingUtils::HashString("VpcPeeringConnectionAlreadyExists");
-static const int INCORRECT_INSTANCE_STATE_HASH = HashingUtils::HashString("IncorrectInstanceState");
-static const int INVALID_VOLUME_I_D__MALFORMED_HASH = HashingUtils::HashString("InvalidVolumeID.Malformed");
-static const int INVALID_VPC_PEERING_CONNECTION_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidVpcPeeringConnectionID.NotFound");
-static const int INVALID_BUNDLE_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidBundleID.NotFound");
-static const int ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AttachmentLimitExceeded");
-static const int INVALID_A_M_I_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidAMIID.NotFound");
-static const int INVALID_INSTANCE_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidInstanceID.NotFound");
-static const int INVALID_ASSOCIATION_I_D__NOT_FOUND_HASH = HashingUtils::HashString("InvalidAssociationID.NotFound");
-static const int INVALID_PLACEMENT_GROUP__IN_USE_HASH = HashingUtils::HashString("InvalidPlacementGroup.InUse");
-static const int INVALID_VOLUME_I_D__DUPLICATE_HASH = HashingUtils::HashString("InvalidVolumeID.Duplicate");
+static constexpr int INVALID_A_M_I_NAME__DUPLICATE_HASH = HashingUtils::CompileTimeHashString("InvalidAMIName.Duplicate");
+static constexpr int BUNDLING_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("BundlingInProgress");
+static constexpr int INVALID_BLOCK_DEVICE_MAPPING_HASH = HashingUtils::CompileTimeHashString("InvalidBlockDeviceMapping");
+static constexpr int INCORRECT_STATE_HASH = HashingUtils::CompileTimeHashString("IncorrectState");
+static constexpr int INVALID_KEY__FORMAT_HASH = HashingUtils::CompileTimeHashString("InvalidKey.Format");
+static constexpr int INVALID_RESERVED_INSTANCES_ID_HASH = HashingUtils::CompileTimeHashString("InvalidReservedInstancesId");
+static constexpr int INVALID_VPC__RANGE_HASH = HashingUtils::CompileTimeHashString("InvalidVpc.Range");
+static constexpr int ROUTE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("RouteAlreadyExists");
+static constexpr int INVALID_A_M_I_I_D__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidAMIID.Malformed");
+static constexpr int CANNOT_DELETE_HASH = HashingUtils::CompileTimeHashString("CannotDelete");
+static constexpr int INVALID_FORMAT_HASH = HashingUtils::CompileTimeHashString("InvalidFormat");
+static constexpr int INVALID_CUSTOMER_GATEWAY_ID__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidCustomerGatewayId.Malformed");
+static constexpr int LEGACY_SECURITY_GROUP_HASH = HashingUtils::CompileTimeHashString("LegacySecurityGroup");
+static constexpr int INVALID_I_P_ADDRESS__IN_USE_HASH = HashingUtils::CompileTimeHashString("InvalidIPAddress.InUse");
+static constexpr int INVALID_SNAPSHOT__IN_USE_HASH = HashingUtils::CompileTimeHashString("InvalidSnapshot.InUse");
+static constexpr int INVALID_INTERFACE__IP_ADDRESS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("InvalidInterface.IpAddressLimitExceeded");
+static constexpr int INVALID_SNAPSHOT__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidSnapshot.NotFound");
+static constexpr int ROUTE_TABLE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("RouteTableLimitExceeded");
+static constexpr int PENDING_SNAPSHOT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("PendingSnapshotLimitExceeded");
+static constexpr int INVALID_SPOT_INSTANCE_REQUEST_I_D__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidSpotInstanceRequestID.Malformed");
+static constexpr int RESERVED_INSTANCES_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ReservedInstancesLimitExceeded");
+static constexpr int INVALID_VPC_ENDPOINT_ID__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidVpcEndpointId.NotFound");
+static constexpr int INVALID_ZONE__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidZone.NotFound");
+static constexpr int VOLUME_IN_USE_HASH = HashingUtils::CompileTimeHashString("VolumeInUse");
+static constexpr int INVALID_A_M_I_I_D__UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("InvalidAMIID.Unavailable");
+static constexpr int ROUTE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("RouteLimitExceeded");
+static constexpr int NON_E_B_S_INSTANCE_HASH = HashingUtils::CompileTimeHashString("NonEBSInstance");
+static constexpr int FLOW_LOG_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("FlowLogAlreadyExists");
+static constexpr int INVALID_VOLUME_I_D__ZONE_MISMATCH_HASH = HashingUtils::CompileTimeHashString("InvalidVolumeID.ZoneMismatch");
+static constexpr int INVALID_KEY_PAIR__FORMAT_HASH = HashingUtils::CompileTimeHashString("InvalidKeyPair.Format");
+static constexpr int INVALID_KEY_PAIR__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidKeyPair.NotFound");
+static constexpr int INVALID_INSTANCE_I_D__NOT_LINKABLE_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceID.NotLinkable");
+static constexpr int INVALID_VPC_ENDPOINT_ID__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidVpcEndpointId.Malformed");
+static constexpr int INVALID_SPOT_FLEET_REQUEST_ID__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidSpotFleetRequestId.Malformed");
+static constexpr int INVALID_RESERVED_INSTANCES_OFFERING_ID_HASH = HashingUtils::CompileTimeHashString("InvalidReservedInstancesOfferingId");
+static constexpr int TAG_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TagLimitExceeded");
+static constexpr int DISK_IMAGE_SIZE_TOO_LARGE_HASH = HashingUtils::CompileTimeHashString("DiskImageSizeTooLarge");
+static constexpr int INVALID_A_M_I_ATTRIBUTE_ITEM_VALUE_HASH = HashingUtils::CompileTimeHashString("InvalidAMIAttributeItemValue");
+static constexpr int V_P_C_RESOURCE_NOT_SPECIFIED_HASH = HashingUtils::CompileTimeHashString("VPCResourceNotSpecified");
+static constexpr int INSUFFICIENT_RESERVED_INSTANCES_CAPACITY_HASH = HashingUtils::CompileTimeHashString("InsufficientReservedInstancesCapacity");
+static constexpr int CONCURRENT_SNAPSHOT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ConcurrentSnapshotLimitExceeded");
+static constexpr int INSUFFICIENT_FREE_ADDRESSES_IN_SUBNET_HASH = HashingUtils::CompileTimeHashString("InsufficientFreeAddressesInSubnet");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequest");
+static constexpr int INVALID_GROUP__IN_USE_HASH = HashingUtils::CompileTimeHashString("InvalidGroup.InUse");
+static constexpr int INVALID_SPOT_DATAFEED__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidSpotDatafeed.NotFound");
+static constexpr int INVALID_STATE_TRANSITION_HASH = HashingUtils::CompileTimeHashString("InvalidStateTransition");
+static constexpr int ADDRESS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AddressLimitExceeded");
+static constexpr int VOLUME_TYPE_NOT_AVAILABLE_IN_ZONE_HASH = HashingUtils::CompileTimeHashString("VolumeTypeNotAvailableInZone");
+static constexpr int VPN_GATEWAY_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("VpnGatewayAttachmentLimitExceeded");
+static constexpr int INVALID_SPOT_FLEET_REQUEST_CONFIG_HASH = HashingUtils::CompileTimeHashString("InvalidSpotFleetRequestConfig");
+static constexpr int CUSTOMER_GATEWAY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CustomerGatewayLimitExceeded");
+static constexpr int INVALID_GROUP_ID__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidGroupId.Malformed");
+static constexpr int INVALID_VPC_PEERING_CONNECTION_ID__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidVpcPeeringConnectionId.Malformed");
+static constexpr int INVALID_GROUP__RESERVED_HASH = HashingUtils::CompileTimeHashString("InvalidGroup.Reserved");
+static constexpr int NETWORK_ACL_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NetworkAclLimitExceeded");
+static constexpr int INVALID_SECURITY__REQUEST_HAS_EXPIRED_HASH = HashingUtils::CompileTimeHashString("InvalidSecurity.RequestHasExpired");
+static constexpr int VPC_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("VpcLimitExceeded");
+static constexpr int INSTANCE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("InstanceLimitExceeded");
+static constexpr int RESOURCE_COUNT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceCountExceeded");
+static constexpr int UNKNOWN_VOLUME_TYPE_HASH = HashingUtils::CompileTimeHashString("UnknownVolumeType");
+static constexpr int INVALID_I_D_HASH = HashingUtils::CompileTimeHashString("InvalidID");
+static constexpr int SECURITY_GROUPS_PER_INSTANCE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("SecurityGroupsPerInstanceLimitExceeded");
+static constexpr int INVALID_PERMISSION__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidPermission.NotFound");
+static constexpr int INSTANCE_ALREADY_LINKED_HASH = HashingUtils::CompileTimeHashString("InstanceAlreadyLinked");
+static constexpr int INVALID_RESERVATION_I_D__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidReservationID.Malformed");
+static constexpr int INVALID_INSTANCE_TYPE_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceType");
+static constexpr int INVALID_PERMISSION__DUPLICATE_HASH = HashingUtils::CompileTimeHashString("InvalidPermission.Duplicate");
+static constexpr int INVALID_VPC_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidVpcID.NotFound");
+static constexpr int INVALID_ATTACHMENT_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidAttachmentID.NotFound");
+static constexpr int INVALID_KEY_PAIR__DUPLICATE_HASH = HashingUtils::CompileTimeHashString("InvalidKeyPair.Duplicate");
+static constexpr int PRIVATE_IP_ADDRESS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("PrivateIpAddressLimitExceeded");
+static constexpr int INVALID_ROUTE_TABLE_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidRouteTableID.NotFound");
+static constexpr int INVALID_PERMISSION__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidPermission.Malformed");
+static constexpr int INVALID_ROUTE_TABLE_ID__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidRouteTableId.Malformed");
+static constexpr int MAX_SPOT_FLEET_REQUEST_COUNT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxSpotFleetRequestCountExceeded");
+static constexpr int INVALID_VOLUME__ZONE_MISMATCH_HASH = HashingUtils::CompileTimeHashString("InvalidVolume.ZoneMismatch");
+static constexpr int ACTIVE_VPC_PEERING_CONNECTION_PER_VPC_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ActiveVpcPeeringConnectionPerVpcLimitExceeded");
+static constexpr int MAX_I_O_P_S_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxIOPSLimitExceeded");
+static constexpr int UNSUPPORTED_HASH = HashingUtils::CompileTimeHashString("Unsupported");
+static constexpr int INVALID_DHCP_OPTION_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidDhcpOptionID.NotFound");
+static constexpr int INVALID_PREFIX_LIST_ID__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidPrefixListId.Malformed");
+static constexpr int VOLUME_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("VolumeLimitExceeded");
+static constexpr int INVALID_VPN_CONNECTION_I_D_HASH = HashingUtils::CompileTimeHashString("InvalidVpnConnectionID");
+static constexpr int INVALID_GATEWAY_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidGatewayID.NotFound");
+static constexpr int INVALID_DEVICE__IN_USE_HASH = HashingUtils::CompileTimeHashString("InvalidDevice.InUse");
+static constexpr int INVALID_GROUP__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidGroup.NotFound");
+static constexpr int INVALID_SPOT_FLEET_REQUEST_ID__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidSpotFleetRequestId.NotFound");
+static constexpr int FILTER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("FilterLimitExceeded");
+static constexpr int VPC_ENDPOINT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("VpcEndpointLimitExceeded");
+static constexpr int INVALID_VOLUME__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidVolume.NotFound");
+static constexpr int INVALID_INSTANCE_ATTRIBUTE_VALUE_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceAttributeValue");
+static constexpr int SECURITY_GROUPS_PER_INTERFACE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("SecurityGroupsPerInterfaceLimitExceeded");
+static constexpr int MAX_SPOT_INSTANCE_COUNT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxSpotInstanceCountExceeded");
+static constexpr int SNAPSHOT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("SnapshotLimitExceeded");
+static constexpr int INVALID_ATTACHMENT__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidAttachment.NotFound");
+static constexpr int INVALID_CUSTOMER_GATEWAY__DUPLICATE_IP_ADDRESS_HASH = HashingUtils::CompileTimeHashString("InvalidCustomerGateway.DuplicateIpAddress");
+static constexpr int INVALID_VPN_GATEWAY_ATTACHMENT__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidVpnGatewayAttachment.NotFound");
+static constexpr int INVALID_DHCP_OPTIONS_ID__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidDhcpOptionsId.Malformed");
+static constexpr int NETWORK_ACL_ENTRY_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("NetworkAclEntryAlreadyExists");
+static constexpr int INVALID_STATE_HASH = HashingUtils::CompileTimeHashString("InvalidState");
+static constexpr int UNSUPPORTED_OPERATION_HASH = HashingUtils::CompileTimeHashString("UnsupportedOperation");
+static constexpr int VPN_GATEWAY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("VpnGatewayLimitExceeded");
+static constexpr int INVALID_ADDRESS__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidAddress.NotFound");
+static constexpr int INVALID_PREFIX_LIST_ID__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidPrefixListId.NotFound");
+static constexpr int INTERNET_GATEWAY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("InternetGatewayLimitExceeded");
+static constexpr int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceLimitExceeded");
+static constexpr int CONCURRENT_TAG_ACCESS_HASH = HashingUtils::CompileTimeHashString("ConcurrentTagAccess");
+static constexpr int INVALID_INSTANCE_I_D_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceID");
+static constexpr int INVALID_ROUTE__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidRoute.Malformed");
+static constexpr int INVALID_SUBNET_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidSubnetID.NotFound");
+static constexpr int INVALID_NETWORK_INTERFACE_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidNetworkInterfaceID.NotFound");
+static constexpr int V_P_C_ID_NOT_SPECIFIED_HASH = HashingUtils::CompileTimeHashString("VPCIdNotSpecified");
+static constexpr int GATEWAY__NOT_ATTACHED_HASH = HashingUtils::CompileTimeHashString("Gateway.NotAttached");
+static constexpr int INVALID_CUSTOMER_GATEWAY_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidCustomerGatewayID.NotFound");
+static constexpr int INVALID_GROUP__DUPLICATE_HASH = HashingUtils::CompileTimeHashString("InvalidGroup.Duplicate");
+static constexpr int NOT_EXPORTABLE_HASH = HashingUtils::CompileTimeHashString("NotExportable");
+static constexpr int SECURITY_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("SecurityGroupLimitExceeded");
+static constexpr int INVALID_SECURITY_GROUP_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidSecurityGroupID.NotFound");
+static constexpr int NETWORK_ACL_ENTRY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NetworkAclEntryLimitExceeded");
+static constexpr int INVALID_PLACEMENT_GROUP__DUPLICATE_HASH = HashingUtils::CompileTimeHashString("InvalidPlacementGroup.Duplicate");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInput");
+static constexpr int INVALID_USER_I_D__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidUserID.Malformed");
+static constexpr int REQUEST_RESOURCE_COUNT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("RequestResourceCountExceeded");
+static constexpr int INVALID_NETWORK_ACL_ENTRY__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidNetworkAclEntry.NotFound");
+static constexpr int INVALID_SERVICE_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidServiceName");
+static constexpr int INVALID_INTERNET_GATEWAY_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidInternetGatewayID.NotFound");
+static constexpr int INVALID_POLICY_DOCUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidPolicyDocument");
+static constexpr int INVALID_FLOW_LOG_ID__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidFlowLogId.NotFound");
+static constexpr int INVALID_CONVERSION_TASK_ID_HASH = HashingUtils::CompileTimeHashString("InvalidConversionTaskId");
+static constexpr int INVALID_SNAPSHOT_I_D__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidSnapshotID.Malformed");
+static constexpr int FLOW_LOGS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("FlowLogsLimitExceeded");
+static constexpr int INVALID_ADDRESS_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidAddressID.NotFound");
+static constexpr int INVALID_VPC_STATE_HASH = HashingUtils::CompileTimeHashString("InvalidVpcState");
+static constexpr int INVALID_ADDRESS__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidAddress.Malformed");
+static constexpr int INVALID_NETWORK_INTERFACE_ATTACHMENT_I_D__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidNetworkInterfaceAttachmentID.Malformed");
+static constexpr int VPC_CIDR_CONFLICT_HASH = HashingUtils::CompileTimeHashString("VpcCidrConflict");
+static constexpr int INVALID_FILTER_HASH = HashingUtils::CompileTimeHashString("InvalidFilter");
+static constexpr int INVALID_MANIFEST_HASH = HashingUtils::CompileTimeHashString("InvalidManifest");
+static constexpr int OUTSTANDING_VPC_PEERING_CONNECTION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("OutstandingVpcPeeringConnectionLimitExceeded");
+static constexpr int DEPENDENCY_VIOLATION_HASH = HashingUtils::CompileTimeHashString("DependencyViolation");
+static constexpr int INVALID_SPOT_INSTANCE_REQUEST_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidSpotInstanceRequestID.NotFound");
+static constexpr int RESOURCE__ALREADY_ASSOCIATED_HASH = HashingUtils::CompileTimeHashString("Resource.AlreadyAssociated");
+static constexpr int INVALID_NETWORK_ACL_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidNetworkAclID.NotFound");
+static constexpr int INVALID_A_M_I_NAME__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidAMIName.Malformed");
+static constexpr int INVALID_RESERVATION_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidReservationID.NotFound");
+static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OperationNotPermitted");
+static constexpr int INVALID_NETWORK_INTERFACE_ID__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidNetworkInterfaceId.Malformed");
+static constexpr int INVALID_SUBNET__CONFLICT_HASH = HashingUtils::CompileTimeHashString("InvalidSubnet.Conflict");
+static constexpr int VPN_CONNECTION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("VpnConnectionLimitExceeded");
+static constexpr int DRY_RUN_OPERATION_HASH = HashingUtils::CompileTimeHashString("DryRunOperation");
+static constexpr int INVALID_VPN_CONNECTION_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidVpnConnectionID.NotFound");
+static constexpr int INVALID_ROUTE__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidRoute.NotFound");
+static constexpr int INVALID_OPTION__CONFLICT_HASH = HashingUtils::CompileTimeHashString("InvalidOption.Conflict");
+static constexpr int INVALID_VPN_GATEWAY_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidVpnGatewayID.NotFound");
+static constexpr int ENCRYPTED_VOLUMES_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("EncryptedVolumesNotSupported");
+static constexpr int INVALID_PLACEMENT_GROUP__UNKNOWN_HASH = HashingUtils::CompileTimeHashString("InvalidPlacementGroup.Unknown");
+static constexpr int SUBNET_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("SubnetLimitExceeded");
+static constexpr int INVALID_DHCP_OPTIONS_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidDhcpOptionsID.NotFound");
+static constexpr int RULES_PER_SECURITY_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("RulesPerSecurityGroupLimitExceeded");
+static constexpr int INVALID_INSTANCE_I_D__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceID.Malformed");
+static constexpr int INVALID_EXPORT_TASK_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidExportTaskID.NotFound");
+static constexpr int INVALID_ALLOCATION_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidAllocationID.NotFound");
+static constexpr int VPC_PEERING_CONNECTION_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("VpcPeeringConnectionAlreadyExists");
+static constexpr int INCORRECT_INSTANCE_STATE_HASH = HashingUtils::CompileTimeHashString("IncorrectInstanceState");
+static constexpr int INVALID_VOLUME_I_D__MALFORMED_HASH = HashingUtils::CompileTimeHashString("InvalidVolumeID.Malformed");
+static constexpr int INVALID_VPC_PEERING_CONNECTION_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidVpcPeeringConnectionID.NotFound");
+static constexpr int INVALID_BUNDLE_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidBundleID.NotFound");
+static constexpr int ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AttachmentLimitExceeded");
+static constexpr int INVALID_A_M_I_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidAMIID.NotFound");
+static constexpr int INVALID_INSTANCE_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceID.NotFound");
+static constexpr int INVALID_ASSOCIATION_I_D__NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InvalidAssociationID.NotFound");
+static constexpr int INVALID_PLACEMENT_GROUP__IN_USE_HASH = HashingUtils::CompileTimeHashString("InvalidPlacementGroup.InUse");
+static constexpr int INVALID_VOLUME_I_D__DUPLICATE_HASH = HashingUtils::CompileTimeHashString("InvalidVolumeID.Duplicate");
 
 
 /*
@@ -30,20 +30,30 @@ namespace Aws
       namespace AccountAttributeNameMapper
       {
 
-        static const int supported_platforms_HASH = HashingUtils::HashString("supported-platforms");
-        static const int default_vpc_HASH = HashingUtils::HashString("default-vpc");
+        static constexpr int supported_platforms_HASH = HashingUtils::CompileTimeHashString("supported-platforms");
+        static constexpr int default_vpc_HASH = HashingUtils::CompileTimeHashString("default-vpc");
 
 
         AccountAttributeName GetAccountAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == supported_platforms_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccountAttributeName::supported_platforms;
-          }
-          else if (hashCode == default_vpc_HASH)
-          {
-            return AccountAttributeName::default_vpc;
+          case supported_platforms_HASH:
+            if (name == "supported-platforms")
+            {
+              return AccountAttributeName::supported_platforms;
+            }
+            break;
+          case default_vpc_HASH:
+            if (name == "default-vpc")
+            {
+              return AccountAttributeName::default_vpc;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AccountAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForAccountAttributeName(AccountAttributeName enumValue)
+        const char* GetNameForAccountAttributeName(AccountAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ActivityStatusMapper
       {
 
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int pending_fulfillment_HASH = HashingUtils::HashString("pending_fulfillment");
-        static const int pending_termination_HASH = HashingUtils::HashString("pending_termination");
-        static const int fulfilled_HASH = HashingUtils::HashString("fulfilled");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
+        static constexpr int pending_fulfillment_HASH = HashingUtils::CompileTimeHashString("pending_fulfillment");
+        static constexpr int pending_termination_HASH = HashingUtils::CompileTimeHashString("pending_termination");
+        static constexpr int fulfilled_HASH = HashingUtils::CompileTimeHashString("fulfilled");
 
 
         ActivityStatus GetActivityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == error_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActivityStatus::error;
-          }
-          else if (hashCode == pending_fulfillment_HASH)
-          {
-            return ActivityStatus::pending_fulfillment;
-          }
-          else if (hashCode == pending_termination_HASH)
-          {
-            return ActivityStatus::pending_termination;
-          }
-          else if (hashCode == fulfilled_HASH)
-          {
-            return ActivityStatus::fulfilled;
+          case error_HASH:
+            if (name == "error")
+            {
+              return ActivityStatus::error;
+            }
+            break;
+          case pending_fulfillment_HASH:
+            if (name == "pending_fulfillment")
+            {
+              return ActivityStatus::pending_fulfillment;
+            }
+            break;
+          case pending_termination_HASH:
+            if (name == "pending_termination")
+            {
+              return ActivityStatus::pending_termination;
+            }
+            break;
+          case fulfilled_HASH:
+            if (name == "fulfilled")
+            {
+              return ActivityStatus::fulfilled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ActivityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForActivityStatus(ActivityStatus enumValue)
+        const char* GetNameForActivityStatus(ActivityStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
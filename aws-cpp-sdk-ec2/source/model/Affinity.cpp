@@ -30,20 +30,30 @@ namespace Aws
       namespace AffinityMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-        static const int host_HASH = HashingUtils::HashString("host");
+        static constexpr int default__HASH = HashingUtils::CompileTimeHashString("default");
+        static constexpr int host_HASH = HashingUtils::CompileTimeHashString("host");
 
 
         Affinity GetAffinityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Affinity::default_;
-          }
-          else if (hashCode == host_HASH)
-          {
-            return Affinity::host;
+          case default__HASH:
+            if (name == "default")
+            {
+              return Affinity::default_;
+            }
+            break;
+          case host_HASH:
+            if (name == "host")
+            {
+              return Affinity::host;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Affinity::NOT_SET;
         }
 
-        Aws::String GetNameForAffinity(Affinity enumValue)
+        const char* GetNameForAffinity(Affinity enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
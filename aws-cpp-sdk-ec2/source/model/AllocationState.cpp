@@ -30,35 +30,51 @@ namespace Aws
       namespace AllocationStateMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int under_assessment_HASH = HashingUtils::HashString("under-assessment");
-        static const int permanent_failure_HASH = HashingUtils::HashString("permanent-failure");
-        static const int released_HASH = HashingUtils::HashString("released");
-        static const int released_permanent_failure_HASH = HashingUtils::HashString("released-permanent-failure");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int under_assessment_HASH = HashingUtils::CompileTimeHashString("under-assessment");
+        static constexpr int permanent_failure_HASH = HashingUtils::CompileTimeHashString("permanent-failure");
+        static constexpr int released_HASH = HashingUtils::CompileTimeHashString("released");
+        static constexpr int released_permanent_failure_HASH = HashingUtils::CompileTimeHashString("released-permanent-failure");
 
 
         AllocationState GetAllocationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AllocationState::available;
-          }
-          else if (hashCode == under_assessment_HASH)
-          {
-            return AllocationState::under_assessment;
-          }
-          else if (hashCode == permanent_failure_HASH)
-          {
-            return AllocationState::permanent_failure;
-          }
-          else if (hashCode == released_HASH)
-          {
-            return AllocationState::released;
-          }
-          else if (hashCode == released_permanent_failure_HASH)
-          {
-            return AllocationState::released_permanent_failure;
+          case available_HASH:
+            if (name == "available")
+            {
+              return AllocationState::available;
+            }
+            break;
+          case under_assessment_HASH:
+            if (name == "under-assessment")
+            {
+              return AllocationState::under_assessment;
+            }
+            break;
+          case permanent_failure_HASH:
+            if (name == "permanent-failure")
+            {
+              return AllocationState::permanent_failure;
+            }
+            break;
+          case released_HASH:
+            if (name == "released")
+            {
+              return AllocationState::released;
+            }
+            break;
+          case released_permanent_failure_HASH:
+            if (name == "released-permanent-failure")
+            {
+              return AllocationState::released_permanent_failure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return AllocationState::NOT_SET;
         }
 
-        Aws::String GetNameForAllocationState(AllocationState enumValue)
+        const char* GetNameForAllocationState(AllocationState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AllocationStrategyMapper
       {
 
-        static const int lowestPrice_HASH = HashingUtils::HashString("lowestPrice");
-        static const int diversified_HASH = HashingUtils::HashString("diversified");
+        static constexpr int lowestPrice_HASH = HashingUtils::CompileTimeHashString("lowestPrice");
+        static constexpr int diversified_HASH = HashingUtils::CompileTimeHashString("diversified");
 
 
         AllocationStrategy GetAllocationStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == lowestPrice_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AllocationStrategy::lowestPrice;
-          }
-          else if (hashCode == diversified_HASH)
-          {
-            return AllocationStrategy::diversified;
+          case lowestPrice_HASH:
+            if (name == "lowestPrice")
+            {
+              return AllocationStrategy::lowestPrice;
+            }
+            break;
+          case diversified_HASH:
+            if (name == "diversified")
+            {
+              return AllocationStrategy::diversified;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AllocationStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForAllocationStrategy(AllocationStrategy enumValue)
+        const char* GetNameForAllocationStrategy(AllocationStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ArchitectureValuesMapper
       {
 
-        static const int i386_HASH = HashingUtils::HashString("i386");
-        static const int x86_64_HASH = HashingUtils::HashString("x86_64");
+        static constexpr int i386_HASH = HashingUtils::CompileTimeHashString("i386");
+        static constexpr int x86_64_HASH = HashingUtils::CompileTimeHashString("x86_64");
 
 
         ArchitectureValues GetArchitectureValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == i386_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ArchitectureValues::i386;
-          }
-          else if (hashCode == x86_64_HASH)
-          {
-            return ArchitectureValues::x86_64;
+          case i386_HASH:
+            if (name == "i386")
+            {
+              return ArchitectureValues::i386;
+            }
+            break;
+          case x86_64_HASH:
+            if (name == "x86_64")
+            {
+              return ArchitectureValues::x86_64;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ArchitectureValues::NOT_SET;
         }
 
-        Aws::String GetNameForArchitectureValues(ArchitectureValues enumValue)
+        const char* GetNameForArchitectureValues(ArchitectureValues enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
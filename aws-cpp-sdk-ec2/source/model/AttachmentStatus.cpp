@@ -30,30 +30,44 @@ namespace Aws
       namespace AttachmentStatusMapper
       {
 
-        static const int attaching_HASH = HashingUtils::HashString("attaching");
-        static const int attached_HASH = HashingUtils::HashString("attached");
-        static const int detaching_HASH = HashingUtils::HashString("detaching");
-        static const int detached_HASH = HashingUtils::HashString("detached");
+        static constexpr int attaching_HASH = HashingUtils::CompileTimeHashString("attaching");
+        static constexpr int attached_HASH = HashingUtils::CompileTimeHashString("attached");
+        static constexpr int detaching_HASH = HashingUtils::CompileTimeHashString("detaching");
+        static constexpr int detached_HASH = HashingUtils::CompileTimeHashString("detached");
 
 
         AttachmentStatus GetAttachmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == attaching_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AttachmentStatus::attaching;
-          }
-          else if (hashCode == attached_HASH)
-          {
-            return AttachmentStatus::attached;
-          }
-          else if (hashCode == detaching_HASH)
-          {
-            return AttachmentStatus::detaching;
-          }
-          else if (hashCode == detached_HASH)
-          {
-            return AttachmentStatus::detached;
+          case attaching_HASH:
+            if (name == "attaching")
+            {
+              return AttachmentStatus::attaching;
+            }
+            break;
+          case attached_HASH:
+            if (name == "attached")
+            {
+              return AttachmentStatus::attached;
+            }
+            break;
+          case detaching_HASH:
+            if (name == "detaching")
+            {
+              return AttachmentStatus::detaching;
+            }
+            break;
+          case detached_HASH:
+            if (name == "detached")
+            {
+              return AttachmentStatus::detached;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AttachmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAttachmentStatus(AttachmentStatus enumValue)
+        const char* GetNameForAttachmentStatus(AttachmentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
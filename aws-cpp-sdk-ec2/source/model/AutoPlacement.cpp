@@ -30,20 +30,30 @@ namespace Aws
       namespace AutoPlacementMapper
       {
 
-        static const int on_HASH = HashingUtils::HashString("on");
-        static const int off_HASH = HashingUtils::HashString("off");
+        static constexpr int on_HASH = HashingUtils::CompileTimeHashString("on");
+        static constexpr int off_HASH = HashingUtils::CompileTimeHashString("off");
 
 
         AutoPlacement GetAutoPlacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == on_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AutoPlacement::on;
-          }
-          else if (hashCode == off_HASH)
-          {
-            return AutoPlacement::off;
+          case on_HASH:
+            if (name == "on")
+            {
+              return AutoPlacement::on;
+            }
+            break;
+          case off_HASH:
+            if (name == "off")
+            {
+              return AutoPlacement::off;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AutoPlacement::NOT_SET;
         }
 
-        Aws::String GetNameForAutoPlacement(AutoPlacement enumValue)
+        const char* GetNameForAutoPlacement(AutoPlacement enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
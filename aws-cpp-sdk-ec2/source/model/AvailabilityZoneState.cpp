@@ -30,30 +30,44 @@ namespace Aws
       namespace AvailabilityZoneStateMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int information_HASH = HashingUtils::HashString("information");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-        static const int unavailable_HASH = HashingUtils::HashString("unavailable");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int information_HASH = HashingUtils::CompileTimeHashString("information");
+        static constexpr int impaired_HASH = HashingUtils::CompileTimeHashString("impaired");
+        static constexpr int unavailable_HASH = HashingUtils::CompileTimeHashString("unavailable");
 
 
         AvailabilityZoneState GetAvailabilityZoneStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AvailabilityZoneState::available;
-          }
-          else if (hashCode == information_HASH)
-          {
-            return AvailabilityZoneState::information;
-          }
-          else if (hashCode == impaired_HASH)
-          {
-            return AvailabilityZoneState::impaired;
-          }
-          else if (hashCode == unavailable_HASH)
-          {
-            return AvailabilityZoneState::unavailable;
+          case available_HASH:
+            if (name == "available")
+            {
+              return AvailabilityZoneState::available;
+            }
+            break;
+          case information_HASH:
+            if (name == "information")
+            {
+              return AvailabilityZoneState::information;
+            }
+            break;
+          case impaired_HASH:
+            if (name == "impaired")
+            {
+              return AvailabilityZoneState::impaired;
+            }
+            break;
+          case unavailable_HASH:
+            if (name == "unavailable")
+            {
+              return AvailabilityZoneState::unavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AvailabilityZoneState::NOT_SET;
         }
 
-        Aws::String GetNameForAvailabilityZoneState(AvailabilityZoneState enumValue)
+        const char* GetNameForAvailabilityZoneState(AvailabilityZoneState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace BatchStateMapper
       {
 
-        static const int submitted_HASH = HashingUtils::HashString("submitted");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int cancelled_running_HASH = HashingUtils::HashString("cancelled_running");
-        static const int cancelled_terminating_HASH = HashingUtils::HashString("cancelled_terminating");
-        static const int modifying_HASH = HashingUtils::HashString("modifying");
+        static constexpr int submitted_HASH = HashingUtils::CompileTimeHashString("submitted");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int cancelled_HASH = HashingUtils::CompileTimeHashString("cancelled");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int cancelled_running_HASH = HashingUtils::CompileTimeHashString("cancelled_running");
+        static constexpr int cancelled_terminating_HASH = HashingUtils::CompileTimeHashString("cancelled_terminating");
+        static constexpr int modifying_HASH = HashingUtils::CompileTimeHashString("modifying");
 
 
         BatchState GetBatchStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == submitted_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BatchState::submitted;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return BatchState::active;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return BatchState::cancelled;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return BatchState::failed;
-          }
-          else if (hashCode == cancelled_running_HASH)
-          {
-            return BatchState::cancelled_running;
-          }
-          else if (hashCode == cancelled_terminating_HASH)
-          {
-            return BatchState::cancelled_terminating;
-          }
-          else if (hashCode == modifying_HASH)
-          {
-            return BatchState::modifying;
+          case submitted_HASH:
+            if (name == "submitted")
+            {
+              return BatchState::submitted;
+            }
+            break;
+          case active_HASH:
+            if (name == "active")
+            {
+              return BatchState::active;
+            }
+            break;
+          case cancelled_HASH:
+            if (name == "cancelled")
+            {
+              return BatchState::cancelled;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return BatchState::failed;
+            }
+            break;
+          case cancelled_running_HASH:
+            if (name == "cancelled_running")
+            {
+              return BatchState::cancelled_running;
+            }
+            break;
+          case cancelled_terminating_HASH:
+            if (name == "cancelled_terminating")
+            {
+              return BatchState::cancelled_terminating;
+            }
+            break;
+          case modifying_HASH:
+            if (name == "modifying")
+            {
+              return BatchState::modifying;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return BatchState::NOT_SET;
         }
 
-        Aws::String GetNameForBatchState(BatchState enumValue)
+        const char* GetNameForBatchState(BatchState enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace BundleTaskStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int waiting_for_shutdown_HASH = HashingUtils::HashString("waiting-for-shutdown");
-        static const int bundling_HASH = HashingUtils::HashString("bundling");
-        static const int storing_HASH = HashingUtils::HashString("storing");
-        static const int cancelling_HASH = HashingUtils::HashString("cancelling");
-        static const int complete_HASH = HashingUtils::HashString("complete");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int waiting_for_shutdown_HASH = HashingUtils::CompileTimeHashString("waiting-for-shutdown");
+        static constexpr int bundling_HASH = HashingUtils::CompileTimeHashString("bundling");
+        static constexpr int storing_HASH = HashingUtils::CompileTimeHashString("storing");
+        static constexpr int cancelling_HASH = HashingUtils::CompileTimeHashString("cancelling");
+        static constexpr int complete_HASH = HashingUtils::CompileTimeHashString("complete");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
 
 
         BundleTaskState GetBundleTaskStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BundleTaskState::pending;
-          }
-          else if (hashCode == waiting_for_shutdown_HASH)
-          {
-            return BundleTaskState::waiting_for_shutdown;
-          }
-          else if (hashCode == bundling_HASH)
-          {
-            return BundleTaskState::bundling;
-          }
-          else if (hashCode == storing_HASH)
-          {
-            return BundleTaskState::storing;
-          }
-          else if (hashCode == cancelling_HASH)
-          {
-            return BundleTaskState::cancelling;
-          }
-          else if (hashCode == complete_HASH)
-          {
-            return BundleTaskState::complete;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return BundleTaskState::failed;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return BundleTaskState::pending;
+            }
+            break;
+          case waiting_for_shutdown_HASH:
+            if (name == "waiting-for-shutdown")
+            {
+              return BundleTaskState::waiting_for_shutdown;
+            }
+            break;
+          case bundling_HASH:
+            if (name == "bundling")
+            {
+              return BundleTaskState::bundling;
+            }
+            break;
+          case storing_HASH:
+            if (name == "storing")
+            {
+              return BundleTaskState::storing;
+            }
+            break;
+          case cancelling_HASH:
+            if (name == "cancelling")
+            {
+              return BundleTaskState::cancelling;
+            }
+            break;
+          case complete_HASH:
+            if (name == "complete")
+            {
+              return BundleTaskState::complete;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return BundleTaskState::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return BundleTaskState::NOT_SET;
         }
 
-        Aws::String GetNameForBundleTaskState(BundleTaskState enumValue)
+        const char* GetNameForBundleTaskState(BundleTaskState enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
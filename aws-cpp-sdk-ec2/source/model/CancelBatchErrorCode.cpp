@@ -30,30 +30,44 @@ namespace Aws
       namespace CancelBatchErrorCodeMapper
       {
 
-        static const int fleetRequestIdDoesNotExist_HASH = HashingUtils::HashString("fleetRequestIdDoesNotExist");
-        static const int fleetRequestIdMalformed_HASH = HashingUtils::HashString("fleetRequestIdMalformed");
-        static const int fleetRequestNotInCancellableState_HASH = HashingUtils::HashString("fleetRequestNotInCancellableState");
-        static const int unexpectedError_HASH = HashingUtils::HashString("unexpectedError");
+        static constexpr int fleetRequestIdDoesNotExist_HASH = HashingUtils::CompileTimeHashString("fleetRequestIdDoesNotExist");
+        static constexpr int fleetRequestIdMalformed_HASH = HashingUtils::CompileTimeHashString("fleetRequestIdMalformed");
+        static constexpr int fleetRequestNotInCancellableState_HASH = HashingUtils::CompileTimeHashString("fleetRequestNotInCancellableState");
+        static constexpr int unexpectedError_HASH = HashingUtils::CompileTimeHashString("unexpectedError");
 
 
         CancelBatchErrorCode GetCancelBatchErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == fleetRequestIdDoesNotExist_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CancelBatchErrorCode::fleetRequestIdDoesNotExist;
-          }
-          else if (hashCode == fleetRequestIdMalformed_HASH)
-          {
-            return CancelBatchErrorCode::fleetRequestIdMalformed;
-          }
-          else if (hashCode == fleetRequestNotInCancellableState_HASH)
-          {
-            return CancelBatchErrorCode::fleetRequestNotInCancellableState;
-          }
-          else if (hashCode == unexpectedError_HASH)
-          {
-            return CancelBatchErrorCode::unexpectedError;
+          case fleetRequestIdDoesNotExist_HASH:
+            if (name == "fleetRequestIdDoesNotExist")
+            {
+              return CancelBatchErrorCode::fleetRequestIdDoesNotExist;
+            }
+            break;
+          case fleetRequestIdMalformed_HASH:
+            if (name == "fleetRequestIdMalformed")
+            {
+              return CancelBatchErrorCode::fleetRequestIdMalformed;
+            }
+            break;
+          case fleetRequestNotInCancellableState_HASH:
+            if (name == "fleetRequestNotInCancellableState")
+            {
+              return CancelBatchErrorCode::fleetRequestNotInCancellableState;
+            }
+            break;
+          case unexpectedError_HASH:
+            if (name == "unexpectedError")
+            {
+              return CancelBatchErrorCode::unexpectedError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return CancelBatchErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForCancelBatchErrorCode(CancelBatchErrorCode enumValue)
+        const char* GetNameForCancelBatchErrorCode(CancelBatchErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
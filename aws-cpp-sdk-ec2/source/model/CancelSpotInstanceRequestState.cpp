@@ -30,35 +30,51 @@ namespace Aws
       namespace CancelSpotInstanceRequestStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int completed_HASH = HashingUtils::HashString("completed");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int open_HASH = HashingUtils::CompileTimeHashString("open");
+        static constexpr int closed_HASH = HashingUtils::CompileTimeHashString("closed");
+        static constexpr int cancelled_HASH = HashingUtils::CompileTimeHashString("cancelled");
+        static constexpr int completed_HASH = HashingUtils::CompileTimeHashString("completed");
 
 
         CancelSpotInstanceRequestState GetCancelSpotInstanceRequestStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CancelSpotInstanceRequestState::active;
-          }
-          else if (hashCode == open_HASH)
-          {
-            return CancelSpotInstanceRequestState::open;
-          }
-          else if (hashCode == closed_HASH)
-          {
-            return CancelSpotInstanceRequestState::closed;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return CancelSpotInstanceRequestState::cancelled;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return CancelSpotInstanceRequestState::completed;
+          case active_HASH:
+            if (name == "active")
+            {
+              return CancelSpotInstanceRequestState::active;
+            }
+            break;
+          case open_HASH:
+            if (name == "open")
+            {
+              return CancelSpotInstanceRequestState::open;
+            }
+            break;
+          case closed_HASH:
+            if (name == "closed")
+            {
+              return CancelSpotInstanceRequestState::closed;
+            }
+            break;
+          case cancelled_HASH:
+            if (name == "cancelled")
+            {
+              return CancelSpotInstanceRequestState::cancelled;
+            }
+            break;
+          case completed_HASH:
+            if (name == "completed")
+            {
+              return CancelSpotInstanceRequestState::completed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return CancelSpotInstanceRequestState::NOT_SET;
         }
 
-        Aws::String GetNameForCancelSpotInstanceRequestState(CancelSpotInstanceRequestState enumValue)
+        const char* GetNameForCancelSpotInstanceRequestState(CancelSpotInstanceRequestState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ConnectionNotificationStateMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Disabled_HASH = HashingUtils::HashString("Disabled");
+        static constexpr int Enabled_HASH = HashingUtils::CompileTimeHashString("Enabled");
+        static constexpr int Disabled_HASH = HashingUtils::CompileTimeHashString("Disabled");
 
 
         ConnectionNotificationState GetConnectionNotificationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConnectionNotificationState::Enabled;
-          }
-          else if (hashCode == Disabled_HASH)
-          {
-            return ConnectionNotificationState::Disabled;
+          case Enabled_HASH:
+            if (name == "Enabled")
+            {
+              return ConnectionNotificationState::Enabled;
+            }
+            break;
+          case Disabled_HASH:
+            if (name == "Disabled")
+            {
+              return ConnectionNotificationState::Disabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ConnectionNotificationState::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionNotificationState(ConnectionNotificationState enumValue)
+        const char* GetNameForConnectionNotificationState(ConnectionNotificationState enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ConnectionNotificationTypeMapper
       {
 
-        static const int Topic_HASH = HashingUtils::HashString("Topic");
+        static constexpr int Topic_HASH = HashingUtils::CompileTimeHashString("Topic");
 
 
         ConnectionNotificationType GetConnectionNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Topic_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConnectionNotificationType::Topic;
+          case Topic_HASH:
+            if (name == "Topic")
+            {
+              return ConnectionNotificationType::Topic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ConnectionNotificationType::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionNotificationType(ConnectionNotificationType enumValue)
+        const char* GetNameForConnectionNotificationType(ConnectionNotificationType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
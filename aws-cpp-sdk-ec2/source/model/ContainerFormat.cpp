@@ -30,15 +30,23 @@ namespace Aws
       namespace ContainerFormatMapper
       {
 
-        static const int ova_HASH = HashingUtils::HashString("ova");
+        static constexpr int ova_HASH = HashingUtils::CompileTimeHashString("ova");
 
 
         ContainerFormat GetContainerFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ova_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContainerFormat::ova;
+          case ova_HASH:
+            if (name == "ova")
+            {
+              return ContainerFormat::ova;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ContainerFormat::NOT_SET;
         }
 
-        Aws::String GetNameForContainerFormat(ContainerFormat enumValue)
+        const char* GetNameForContainerFormat(ContainerFormat enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
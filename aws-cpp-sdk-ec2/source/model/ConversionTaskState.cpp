@@ -30,30 +30,44 @@ namespace Aws
       namespace ConversionTaskStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int cancelling_HASH = HashingUtils::HashString("cancelling");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int completed_HASH = HashingUtils::HashString("completed");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int cancelling_HASH = HashingUtils::CompileTimeHashString("cancelling");
+        static constexpr int cancelled_HASH = HashingUtils::CompileTimeHashString("cancelled");
+        static constexpr int completed_HASH = HashingUtils::CompileTimeHashString("completed");
 
 
         ConversionTaskState GetConversionTaskStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConversionTaskState::active;
-          }
-          else if (hashCode == cancelling_HASH)
-          {
-            return ConversionTaskState::cancelling;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return ConversionTaskState::cancelled;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return ConversionTaskState::completed;
+          case active_HASH:
+            if (name == "active")
+            {
+              return ConversionTaskState::active;
+            }
+            break;
+          case cancelling_HASH:
+            if (name == "cancelling")
+            {
+              return ConversionTaskState::cancelling;
+            }
+            break;
+          case cancelled_HASH:
+            if (name == "cancelled")
+            {
+              return ConversionTaskState::cancelled;
+            }
+            break;
+          case completed_HASH:
+            if (name == "completed")
+            {
+              return ConversionTaskState::completed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ConversionTaskState::NOT_SET;
         }
 
-        Aws::String GetNameForConversionTaskState(ConversionTaskState enumValue)
+        const char* GetNameForConversionTaskState(ConversionTaskState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
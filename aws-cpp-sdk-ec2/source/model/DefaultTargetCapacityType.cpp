@@ -30,20 +30,30 @@ namespace Aws
       namespace DefaultTargetCapacityTypeMapper
       {
 
-        static const int spot_HASH = HashingUtils::HashString("spot");
-        static const int on_demand_HASH = HashingUtils::HashString("on-demand");
+        static constexpr int spot_HASH = HashingUtils::CompileTimeHashString("spot");
+        static constexpr int on_demand_HASH = HashingUtils::CompileTimeHashString("on-demand");
 
 
         DefaultTargetCapacityType GetDefaultTargetCapacityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == spot_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DefaultTargetCapacityType::spot;
-          }
-          else if (hashCode == on_demand_HASH)
-          {
-            return DefaultTargetCapacityType::on_demand;
+          case spot_HASH:
+            if (name == "spot")
+            {
+              return DefaultTargetCapacityType::spot;
+            }
+            break;
+          case on_demand_HASH:
+            if (name == "on-demand")
+            {
+              return DefaultTargetCapacityType::on_demand;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DefaultTargetCapacityType::NOT_SET;
         }
 
-        Aws::String GetNameForDefaultTargetCapacityType(DefaultTargetCapacityType enumValue)
+        const char* GetNameForDefaultTargetCapacityType(DefaultTargetCapacityType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace DeleteFleetErrorCodeMapper
       {
 
-        static const int fleetIdDoesNotExist_HASH = HashingUtils::HashString("fleetIdDoesNotExist");
-        static const int fleetIdMalformed_HASH = HashingUtils::HashString("fleetIdMalformed");
-        static const int fleetNotInDeletableState_HASH = HashingUtils::HashString("fleetNotInDeletableState");
-        static const int unexpectedError_HASH = HashingUtils::HashString("unexpectedError");
+        static constexpr int fleetIdDoesNotExist_HASH = HashingUtils::CompileTimeHashString("fleetIdDoesNotExist");
+        static constexpr int fleetIdMalformed_HASH = HashingUtils::CompileTimeHashString("fleetIdMalformed");
+        static constexpr int fleetNotInDeletableState_HASH = HashingUtils::CompileTimeHashString("fleetNotInDeletableState");
+        static constexpr int unexpectedError_HASH = HashingUtils::CompileTimeHashString("unexpectedError");
 
 
         DeleteFleetErrorCode GetDeleteFleetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == fleetIdDoesNotExist_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeleteFleetErrorCode::fleetIdDoesNotExist;
-          }
-          else if (hashCode == fleetIdMalformed_HASH)
-          {
-            return DeleteFleetErrorCode::fleetIdMalformed;
-          }
-          else if (hashCode == fleetNotInDeletableState_HASH)
-          {
-            return DeleteFleetErrorCode::fleetNotInDeletableState;
-          }
-          else if (hashCode == unexpectedError_HASH)
-          {
-            return DeleteFleetErrorCode::unexpectedError;
+          case fleetIdDoesNotExist_HASH:
+            if (name == "fleetIdDoesNotExist")
+            {
+              return DeleteFleetErrorCode::fleetIdDoesNotExist;
+            }
+            break;
+          case fleetIdMalformed_HASH:
+            if (name == "fleetIdMalformed")
+            {
+              return DeleteFleetErrorCode::fleetIdMalformed;
+            }
+            break;
+          case fleetNotInDeletableState_HASH:
+            if (name == "fleetNotInDeletableState")
+            {
+              return DeleteFleetErrorCode::fleetNotInDeletableState;
+            }
+            break;
+          case unexpectedError_HASH:
+            if (name == "unexpectedError")
+            {
+              return DeleteFleetErrorCode::unexpectedError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DeleteFleetErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForDeleteFleetErrorCode(DeleteFleetErrorCode enumValue)
+        const char* GetNameForDeleteFleetErrorCode(DeleteFleetErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -70,7 +70,7 @@ Aws::String DescribeSpotPriceHistoryRequest::SerializePayload() const
     for(auto& item : m_instanceTypes)
     {
       ss << "InstanceType." << instanceTypesCount << "="
-          << StringUtils::URLEncode(InstanceTypeMapper::GetNameForInstanceType(item).c_str()) << "&";
+          << StringUtils::URLEncode(InstanceTypeMapper::GetNameForInstanceType(item)) << "&";
       instanceTypesCount++;
     }
   }
@@ -30,20 +30,30 @@ namespace Aws
       namespace DeviceTypeMapper
       {
 
-        static const int ebs_HASH = HashingUtils::HashString("ebs");
-        static const int instance_store_HASH = HashingUtils::HashString("instance-store");
+        static constexpr int ebs_HASH = HashingUtils::CompileTimeHashString("ebs");
+        static constexpr int instance_store_HASH = HashingUtils::CompileTimeHashString("instance-store");
 
 
         DeviceType GetDeviceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ebs_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeviceType::ebs;
-          }
-          else if (hashCode == instance_store_HASH)
-          {
-            return DeviceType::instance_store;
+          case ebs_HASH:
+            if (name == "ebs")
+            {
+              return DeviceType::ebs;
+            }
+            break;
+          case instance_store_HASH:
+            if (name == "instance-store")
+            {
+              return DeviceType::instance_store;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeviceType::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceType(DeviceType enumValue)
+        const char* GetNameForDeviceType(DeviceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace DiskImageFormatMapper
       {
 
-        static const int VMDK_HASH = HashingUtils::HashString("VMDK");
-        static const int RAW_HASH = HashingUtils::HashString("RAW");
-        static const int VHD_HASH = HashingUtils::HashString("VHD");
+        static constexpr int VMDK_HASH = HashingUtils::CompileTimeHashString("VMDK");
+        static constexpr int RAW_HASH = HashingUtils::CompileTimeHashString("RAW");
+        static constexpr int VHD_HASH = HashingUtils::CompileTimeHashString("VHD");
 
 
         DiskImageFormat GetDiskImageFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VMDK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DiskImageFormat::VMDK;
-          }
-          else if (hashCode == RAW_HASH)
-          {
-            return DiskImageFormat::RAW;
-          }
-          else if (hashCode == VHD_HASH)
-          {
-            return DiskImageFormat::VHD;
+          case VMDK_HASH:
+            if (name == "VMDK")
+            {
+              return DiskImageFormat::VMDK;
+            }
+            break;
+          case RAW_HASH:
+            if (name == "RAW")
+            {
+              return DiskImageFormat::RAW;
+            }
+            break;
+          case VHD_HASH:
+            if (name == "VHD")
+            {
+              return DiskImageFormat::VHD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DiskImageFormat::NOT_SET;
         }
 
-        Aws::String GetNameForDiskImageFormat(DiskImageFormat enumValue)
+        const char* GetNameForDiskImageFormat(DiskImageFormat enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
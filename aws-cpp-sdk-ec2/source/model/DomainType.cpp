@@ -30,20 +30,30 @@ namespace Aws
       namespace DomainTypeMapper
       {
 
-        static const int vpc_HASH = HashingUtils::HashString("vpc");
-        static const int standard_HASH = HashingUtils::HashString("standard");
+        static constexpr int vpc_HASH = HashingUtils::CompileTimeHashString("vpc");
+        static constexpr int standard_HASH = HashingUtils::CompileTimeHashString("standard");
 
 
         DomainType GetDomainTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == vpc_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DomainType::vpc;
-          }
-          else if (hashCode == standard_HASH)
-          {
-            return DomainType::standard;
+          case vpc_HASH:
+            if (name == "vpc")
+            {
+              return DomainType::vpc;
+            }
+            break;
+          case standard_HASH:
+            if (name == "standard")
+            {
+              return DomainType::standard;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DomainType::NOT_SET;
         }
 
-        Aws::String GetNameForDomainType(DomainType enumValue)
+        const char* GetNameForDomainType(DomainType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
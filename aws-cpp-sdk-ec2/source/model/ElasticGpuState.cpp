@@ -30,15 +30,23 @@ namespace Aws
       namespace ElasticGpuStateMapper
       {
 
-        static const int ATTACHED_HASH = HashingUtils::HashString("ATTACHED");
+        static constexpr int ATTACHED_HASH = HashingUtils::CompileTimeHashString("ATTACHED");
 
 
         ElasticGpuState GetElasticGpuStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ATTACHED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ElasticGpuState::ATTACHED;
+          case ATTACHED_HASH:
+            if (name == "ATTACHED")
+            {
+              return ElasticGpuState::ATTACHED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ElasticGpuState::NOT_SET;
         }
 
-        Aws::String GetNameForElasticGpuState(ElasticGpuState enumValue)
+        const char* GetNameForElasticGpuState(ElasticGpuState enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ElasticGpuStatusMapper
       {
 
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int IMPAIRED_HASH = HashingUtils::HashString("IMPAIRED");
+        static constexpr int OK_HASH = HashingUtils::CompileTimeHashString("OK");
+        static constexpr int IMPAIRED_HASH = HashingUtils::CompileTimeHashString("IMPAIRED");
 
 
         ElasticGpuStatus GetElasticGpuStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ElasticGpuStatus::OK;
-          }
-          else if (hashCode == IMPAIRED_HASH)
-          {
-            return ElasticGpuStatus::IMPAIRED;
+          case OK_HASH:
+            if (name == "OK")
+            {
+              return ElasticGpuStatus::OK;
+            }
+            break;
+          case IMPAIRED_HASH:
+            if (name == "IMPAIRED")
+            {
+              return ElasticGpuStatus::IMPAIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ElasticGpuStatus::NOT_SET;
         }
 
-        Aws::String GetNameForElasticGpuStatus(ElasticGpuStatus enumValue)
+        const char* GetNameForElasticGpuStatus(ElasticGpuStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace EventCodeMapper
       {
 
-        static const int instance_reboot_HASH = HashingUtils::HashString("instance-reboot");
-        static const int system_reboot_HASH = HashingUtils::HashString("system-reboot");
-        static const int system_maintenance_HASH = HashingUtils::HashString("system-maintenance");
-        static const int instance_retirement_HASH = HashingUtils::HashString("instance-retirement");
-        static const int instance_stop_HASH = HashingUtils::HashString("instance-stop");
+        static constexpr int instance_reboot_HASH = HashingUtils::CompileTimeHashString("instance-reboot");
+        static constexpr int system_reboot_HASH = HashingUtils::CompileTimeHashString("system-reboot");
+        static constexpr int system_maintenance_HASH = HashingUtils::CompileTimeHashString("system-maintenance");
+        static constexpr int instance_retirement_HASH = HashingUtils::CompileTimeHashString("instance-retirement");
+        static constexpr int instance_stop_HASH = HashingUtils::CompileTimeHashString("instance-stop");
 
 
         EventCode GetEventCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_reboot_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventCode::instance_reboot;
-          }
-          else if (hashCode == system_reboot_HASH)
-          {
-            return EventCode::system_reboot;
-          }
-          else if (hashCode == system_maintenance_HASH)
-          {
-            return EventCode::system_maintenance;
-          }
-          else if (hashCode == instance_retirement_HASH)
-          {
-            return EventCode::instance_retirement;
-          }
-          else if (hashCode == instance_stop_HASH)
-          {
-            return EventCode::instance_stop;
+          case instance_reboot_HASH:
+            if (name == "instance-reboot")
+            {
+              return EventCode::instance_reboot;
+            }
+            break;
+          case system_reboot_HASH:
+            if (name == "system-reboot")
+            {
+              return EventCode::system_reboot;
+            }
+            break;
+          case system_maintenance_HASH:
+            if (name == "system-maintenance")
+            {
+              return EventCode::system_maintenance;
+            }
+            break;
+          case instance_retirement_HASH:
+            if (name == "instance-retirement")
+            {
+              return EventCode::instance_retirement;
+            }
+            break;
+          case instance_stop_HASH:
+            if (name == "instance-stop")
+            {
+              return EventCode::instance_stop;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return EventCode::NOT_SET;
         }
 
-        Aws::String GetNameForEventCode(EventCode enumValue)
+        const char* GetNameForEventCode(EventCode enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int instanceChange_HASH = HashingUtils::HashString("instanceChange");
-        static const int fleetRequestChange_HASH = HashingUtils::HashString("fleetRequestChange");
-        static const int error_HASH = HashingUtils::HashString("error");
+        static constexpr int instanceChange_HASH = HashingUtils::CompileTimeHashString("instanceChange");
+        static constexpr int fleetRequestChange_HASH = HashingUtils::CompileTimeHashString("fleetRequestChange");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
 
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instanceChange_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventType::instanceChange;
-          }
-          else if (hashCode == fleetRequestChange_HASH)
-          {
-            return EventType::fleetRequestChange;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return EventType::error;
+          case instanceChange_HASH:
+            if (name == "instanceChange")
+            {
+              return EventType::instanceChange;
+            }
+            break;
+          case fleetRequestChange_HASH:
+            if (name == "fleetRequestChange")
+            {
+              return EventType::fleetRequestChange;
+            }
+            break;
+          case error_HASH:
+            if (name == "error")
+            {
+              return EventType::error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventType(EventType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
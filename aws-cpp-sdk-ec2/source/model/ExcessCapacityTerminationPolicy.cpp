@@ -30,20 +30,30 @@ namespace Aws
       namespace ExcessCapacityTerminationPolicyMapper
       {
 
-        static const int noTermination_HASH = HashingUtils::HashString("noTermination");
-        static const int default__HASH = HashingUtils::HashString("default");
+        static constexpr int noTermination_HASH = HashingUtils::CompileTimeHashString("noTermination");
+        static constexpr int default__HASH = HashingUtils::CompileTimeHashString("default");
 
 
         ExcessCapacityTerminationPolicy GetExcessCapacityTerminationPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == noTermination_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExcessCapacityTerminationPolicy::noTermination;
-          }
-          else if (hashCode == default__HASH)
-          {
-            return ExcessCapacityTerminationPolicy::default_;
+          case noTermination_HASH:
+            if (name == "noTermination")
+            {
+              return ExcessCapacityTerminationPolicy::noTermination;
+            }
+            break;
+          case default__HASH:
+            if (name == "default")
+            {
+              return ExcessCapacityTerminationPolicy::default_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ExcessCapacityTerminationPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForExcessCapacityTerminationPolicy(ExcessCapacityTerminationPolicy enumValue)
+        const char* GetNameForExcessCapacityTerminationPolicy(ExcessCapacityTerminationPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ExportEnvironmentMapper
       {
 
-        static const int citrix_HASH = HashingUtils::HashString("citrix");
-        static const int vmware_HASH = HashingUtils::HashString("vmware");
-        static const int microsoft_HASH = HashingUtils::HashString("microsoft");
+        static constexpr int citrix_HASH = HashingUtils::CompileTimeHashString("citrix");
+        static constexpr int vmware_HASH = HashingUtils::CompileTimeHashString("vmware");
+        static constexpr int microsoft_HASH = HashingUtils::CompileTimeHashString("microsoft");
 
 
         ExportEnvironment GetExportEnvironmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == citrix_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExportEnvironment::citrix;
-          }
-          else if (hashCode == vmware_HASH)
-          {
-            return ExportEnvironment::vmware;
-          }
-          else if (hashCode == microsoft_HASH)
-          {
-            return ExportEnvironment::microsoft;
+          case citrix_HASH:
+            if (name == "citrix")
+            {
+              return ExportEnvironment::citrix;
+            }
+            break;
+          case vmware_HASH:
+            if (name == "vmware")
+            {
+              return ExportEnvironment::vmware;
+            }
+            break;
+          case microsoft_HASH:
+            if (name == "microsoft")
+            {
+              return ExportEnvironment::microsoft;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ExportEnvironment::NOT_SET;
         }
 
-        Aws::String GetNameForExportEnvironment(ExportEnvironment enumValue)
+        const char* GetNameForExportEnvironment(ExportEnvironment enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
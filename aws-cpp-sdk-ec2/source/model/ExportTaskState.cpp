@@ -30,30 +30,44 @@ namespace Aws
       namespace ExportTaskStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int cancelling_HASH = HashingUtils::HashString("cancelling");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int completed_HASH = HashingUtils::HashString("completed");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int cancelling_HASH = HashingUtils::CompileTimeHashString("cancelling");
+        static constexpr int cancelled_HASH = HashingUtils::CompileTimeHashString("cancelled");
+        static constexpr int completed_HASH = HashingUtils::CompileTimeHashString("completed");
 
 
         ExportTaskState GetExportTaskStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExportTaskState::active;
-          }
-          else if (hashCode == cancelling_HASH)
-          {
-            return ExportTaskState::cancelling;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return ExportTaskState::cancelled;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return ExportTaskState::completed;
+          case active_HASH:
+            if (name == "active")
+            {
+              return ExportTaskState::active;
+            }
+            break;
+          case cancelling_HASH:
+            if (name == "cancelling")
+            {
+              return ExportTaskState::cancelling;
+            }
+            break;
+          case cancelled_HASH:
+            if (name == "cancelled")
+            {
+              return ExportTaskState::cancelled;
+            }
+            break;
+          case completed_HASH:
+            if (name == "completed")
+            {
+              return ExportTaskState::completed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ExportTaskState::NOT_SET;
         }
 
-        Aws::String GetNameForExportTaskState(ExportTaskState enumValue)
+        const char* GetNameForExportTaskState(ExportTaskState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
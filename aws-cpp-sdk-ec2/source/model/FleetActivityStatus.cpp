@@ -30,30 +30,44 @@ namespace Aws
       namespace FleetActivityStatusMapper
       {
 
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int pending_fulfillment_HASH = HashingUtils::HashString("pending-fulfillment");
-        static const int pending_termination_HASH = HashingUtils::HashString("pending-termination");
-        static const int fulfilled_HASH = HashingUtils::HashString("fulfilled");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
+        static constexpr int pending_fulfillment_HASH = HashingUtils::CompileTimeHashString("pending-fulfillment");
+        static constexpr int pending_termination_HASH = HashingUtils::CompileTimeHashString("pending-termination");
+        static constexpr int fulfilled_HASH = HashingUtils::CompileTimeHashString("fulfilled");
 
 
         FleetActivityStatus GetFleetActivityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == error_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetActivityStatus::error;
-          }
-          else if (hashCode == pending_fulfillment_HASH)
-          {
-            return FleetActivityStatus::pending_fulfillment;
-          }
-          else if (hashCode == pending_termination_HASH)
-          {
-            return FleetActivityStatus::pending_termination;
-          }
-          else if (hashCode == fulfilled_HASH)
-          {
-            return FleetActivityStatus::fulfilled;
+          case error_HASH:
+            if (name == "error")
+            {
+              return FleetActivityStatus::error;
+            }
+            break;
+          case pending_fulfillment_HASH:
+            if (name == "pending-fulfillment")
+            {
+              return FleetActivityStatus::pending_fulfillment;
+            }
+            break;
+          case pending_termination_HASH:
+            if (name == "pending-termination")
+            {
+              return FleetActivityStatus::pending_termination;
+            }
+            break;
+          case fulfilled_HASH:
+            if (name == "fulfilled")
+            {
+              return FleetActivityStatus::fulfilled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return FleetActivityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForFleetActivityStatus(FleetActivityStatus enumValue)
+        const char* GetNameForFleetActivityStatus(FleetActivityStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
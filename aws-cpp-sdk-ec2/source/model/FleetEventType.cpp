@@ -30,25 +30,37 @@ namespace Aws
       namespace FleetEventTypeMapper
       {
 
-        static const int instance_change_HASH = HashingUtils::HashString("instance-change");
-        static const int fleet_change_HASH = HashingUtils::HashString("fleet-change");
-        static const int service_error_HASH = HashingUtils::HashString("service-error");
+        static constexpr int instance_change_HASH = HashingUtils::CompileTimeHashString("instance-change");
+        static constexpr int fleet_change_HASH = HashingUtils::CompileTimeHashString("fleet-change");
+        static constexpr int service_error_HASH = HashingUtils::CompileTimeHashString("service-error");
 
 
         FleetEventType GetFleetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_change_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetEventType::instance_change;
-          }
-          else if (hashCode == fleet_change_HASH)
-          {
-            return FleetEventType::fleet_change;
-          }
-          else if (hashCode == service_error_HASH)
-          {
-            return FleetEventType::service_error;
+          case instance_change_HASH:
+            if (name == "instance-change")
+            {
+              return FleetEventType::instance_change;
+            }
+            break;
+          case fleet_change_HASH:
+            if (name == "fleet-change")
+            {
+              return FleetEventType::fleet_change;
+            }
+            break;
+          case service_error_HASH:
+            if (name == "service-error")
+            {
+              return FleetEventType::service_error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FleetEventType::NOT_SET;
         }
 
-        Aws::String GetNameForFleetEventType(FleetEventType enumValue)
+        const char* GetNameForFleetEventType(FleetEventType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace FleetExcessCapacityTerminationPolicyMapper
       {
 
-        static const int no_termination_HASH = HashingUtils::HashString("no-termination");
-        static const int termination_HASH = HashingUtils::HashString("termination");
+        static constexpr int no_termination_HASH = HashingUtils::CompileTimeHashString("no-termination");
+        static constexpr int termination_HASH = HashingUtils::CompileTimeHashString("termination");
 
 
         FleetExcessCapacityTerminationPolicy GetFleetExcessCapacityTerminationPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == no_termination_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetExcessCapacityTerminationPolicy::no_termination;
-          }
-          else if (hashCode == termination_HASH)
-          {
-            return FleetExcessCapacityTerminationPolicy::termination;
+          case no_termination_HASH:
+            if (name == "no-termination")
+            {
+              return FleetExcessCapacityTerminationPolicy::no_termination;
+            }
+            break;
+          case termination_HASH:
+            if (name == "termination")
+            {
+              return FleetExcessCapacityTerminationPolicy::termination;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FleetExcessCapacityTerminationPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForFleetExcessCapacityTerminationPolicy(FleetExcessCapacityTerminationPolicy enumValue)
+        const char* GetNameForFleetExcessCapacityTerminationPolicy(FleetExcessCapacityTerminationPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
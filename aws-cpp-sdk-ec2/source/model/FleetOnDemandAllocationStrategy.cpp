@@ -30,20 +30,30 @@ namespace Aws
       namespace FleetOnDemandAllocationStrategyMapper
       {
 
-        static const int lowest_price_HASH = HashingUtils::HashString("lowest-price");
-        static const int prioritized_HASH = HashingUtils::HashString("prioritized");
+        static constexpr int lowest_price_HASH = HashingUtils::CompileTimeHashString("lowest-price");
+        static constexpr int prioritized_HASH = HashingUtils::CompileTimeHashString("prioritized");
 
 
         FleetOnDemandAllocationStrategy GetFleetOnDemandAllocationStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == lowest_price_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetOnDemandAllocationStrategy::lowest_price;
-          }
-          else if (hashCode == prioritized_HASH)
-          {
-            return FleetOnDemandAllocationStrategy::prioritized;
+          case lowest_price_HASH:
+            if (name == "lowest-price")
+            {
+              return FleetOnDemandAllocationStrategy::lowest_price;
+            }
+            break;
+          case prioritized_HASH:
+            if (name == "prioritized")
+            {
+              return FleetOnDemandAllocationStrategy::prioritized;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FleetOnDemandAllocationStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForFleetOnDemandAllocationStrategy(FleetOnDemandAllocationStrategy enumValue)
+        const char* GetNameForFleetOnDemandAllocationStrategy(FleetOnDemandAllocationStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace FleetStateCodeMapper
       {
 
-        static const int submitted_HASH = HashingUtils::HashString("submitted");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int deleted_running_HASH = HashingUtils::HashString("deleted-running");
-        static const int deleted_terminating_HASH = HashingUtils::HashString("deleted-terminating");
-        static const int modifying_HASH = HashingUtils::HashString("modifying");
+        static constexpr int submitted_HASH = HashingUtils::CompileTimeHashString("submitted");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int deleted_running_HASH = HashingUtils::CompileTimeHashString("deleted-running");
+        static constexpr int deleted_terminating_HASH = HashingUtils::CompileTimeHashString("deleted-terminating");
+        static constexpr int modifying_HASH = HashingUtils::CompileTimeHashString("modifying");
 
 
         FleetStateCode GetFleetStateCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == submitted_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetStateCode::submitted;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return FleetStateCode::active;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return FleetStateCode::deleted;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return FleetStateCode::failed;
-          }
-          else if (hashCode == deleted_running_HASH)
-          {
-            return FleetStateCode::deleted_running;
-          }
-          else if (hashCode == deleted_terminating_HASH)
-          {
-            return FleetStateCode::deleted_terminating;
-          }
-          else if (hashCode == modifying_HASH)
-          {
-            return FleetStateCode::modifying;
+          case submitted_HASH:
+            if (name == "submitted")
+            {
+              return FleetStateCode::submitted;
+            }
+            break;
+          case active_HASH:
+            if (name == "active")
+            {
+              return FleetStateCode::active;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return FleetStateCode::deleted;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return FleetStateCode::failed;
+            }
+            break;
+          case deleted_running_HASH:
+            if (name == "deleted-running")
+            {
+              return FleetStateCode::deleted_running;
+            }
+            break;
+          case deleted_terminating_HASH:
+            if (name == "deleted-terminating")
+            {
+              return FleetStateCode::deleted_terminating;
+            }
+            break;
+          case modifying_HASH:
+            if (name == "modifying")
+            {
+              return FleetStateCode::modifying;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return FleetStateCode::NOT_SET;
         }
 
-        Aws::String GetNameForFleetStateCode(FleetStateCode enumValue)
+        const char* GetNameForFleetStateCode(FleetStateCode enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
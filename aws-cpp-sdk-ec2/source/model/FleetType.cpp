@@ -30,20 +30,30 @@ namespace Aws
       namespace FleetTypeMapper
       {
 
-        static const int request_HASH = HashingUtils::HashString("request");
-        static const int maintain_HASH = HashingUtils::HashString("maintain");
+        static constexpr int request_HASH = HashingUtils::CompileTimeHashString("request");
+        static constexpr int maintain_HASH = HashingUtils::CompileTimeHashString("maintain");
 
 
         FleetType GetFleetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == request_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetType::request;
-          }
-          else if (hashCode == maintain_HASH)
-          {
-            return FleetType::maintain;
+          case request_HASH:
+            if (name == "request")
+            {
+              return FleetType::request;
+            }
+            break;
+          case maintain_HASH:
+            if (name == "maintain")
+            {
+              return FleetType::maintain;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FleetType::NOT_SET;
         }
 
-        Aws::String GetNameForFleetType(FleetType enumValue)
+        const char* GetNameForFleetType(FleetType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace FlowLogsResourceTypeMapper
       {
 
-        static const int VPC_HASH = HashingUtils::HashString("VPC");
-        static const int Subnet_HASH = HashingUtils::HashString("Subnet");
-        static const int NetworkInterface_HASH = HashingUtils::HashString("NetworkInterface");
+        static constexpr int VPC_HASH = HashingUtils::CompileTimeHashString("VPC");
+        static constexpr int Subnet_HASH = HashingUtils::CompileTimeHashString("Subnet");
+        static constexpr int NetworkInterface_HASH = HashingUtils::CompileTimeHashString("NetworkInterface");
 
 
         FlowLogsResourceType GetFlowLogsResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VPC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FlowLogsResourceType::VPC;
-          }
-          else if (hashCode == Subnet_HASH)
-          {
-            return FlowLogsResourceType::Subnet;
-          }
-          else if (hashCode == NetworkInterface_HASH)
-          {
-            return FlowLogsResourceType::NetworkInterface;
+          case VPC_HASH:
+            if (name == "VPC")
+            {
+              return FlowLogsResourceType::VPC;
+            }
+            break;
+          case Subnet_HASH:
+            if (name == "Subnet")
+            {
+              return FlowLogsResourceType::Subnet;
+            }
+            break;
+          case NetworkInterface_HASH:
+            if (name == "NetworkInterface")
+            {
+              return FlowLogsResourceType::NetworkInterface;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FlowLogsResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForFlowLogsResourceType(FlowLogsResourceType enumValue)
+        const char* GetNameForFlowLogsResourceType(FlowLogsResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace FpgaImageAttributeNameMapper
       {
 
-        static const int description_HASH = HashingUtils::HashString("description");
-        static const int name_HASH = HashingUtils::HashString("name");
-        static const int loadPermission_HASH = HashingUtils::HashString("loadPermission");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
+        static constexpr int description_HASH = HashingUtils::CompileTimeHashString("description");
+        static constexpr int name_HASH = HashingUtils::CompileTimeHashString("name");
+        static constexpr int loadPermission_HASH = HashingUtils::CompileTimeHashString("loadPermission");
+        static constexpr int productCodes_HASH = HashingUtils::CompileTimeHashString("productCodes");
 
 
         FpgaImageAttributeName GetFpgaImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == description_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FpgaImageAttributeName::description;
-          }
-          else if (hashCode == name_HASH)
-          {
-            return FpgaImageAttributeName::name;
-          }
-          else if (hashCode == loadPermission_HASH)
-          {
-            return FpgaImageAttributeName::loadPermission;
-          }
-          else if (hashCode == productCodes_HASH)
-          {
-            return FpgaImageAttributeName::productCodes;
+          case description_HASH:
+            if (name == "description")
+            {
+              return FpgaImageAttributeName::description;
+            }
+            break;
+          case name_HASH:
+            if (name == "name")
+            {
+              return FpgaImageAttributeName::name;
+            }
+            break;
+          case loadPermission_HASH:
+            if (name == "loadPermission")
+            {
+              return FpgaImageAttributeName::loadPermission;
+            }
+            break;
+          case productCodes_HASH:
+            if (name == "productCodes")
+            {
+              return FpgaImageAttributeName::productCodes;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return FpgaImageAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForFpgaImageAttributeName(FpgaImageAttributeName enumValue)
+        const char* GetNameForFpgaImageAttributeName(FpgaImageAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace FpgaImageStateCodeMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int unavailable_HASH = HashingUtils::HashString("unavailable");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int unavailable_HASH = HashingUtils::CompileTimeHashString("unavailable");
 
 
         FpgaImageStateCode GetFpgaImageStateCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FpgaImageStateCode::pending;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return FpgaImageStateCode::failed;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return FpgaImageStateCode::available;
-          }
-          else if (hashCode == unavailable_HASH)
-          {
-            return FpgaImageStateCode::unavailable;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return FpgaImageStateCode::pending;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return FpgaImageStateCode::failed;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return FpgaImageStateCode::available;
+            }
+            break;
+          case unavailable_HASH:
+            if (name == "unavailable")
+            {
+              return FpgaImageStateCode::unavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return FpgaImageStateCode::NOT_SET;
         }
 
-        Aws::String GetNameForFpgaImageStateCode(FpgaImageStateCode enumValue)
+        const char* GetNameForFpgaImageStateCode(FpgaImageStateCode enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace GatewayTypeMapper
       {
 
-        static const int ipsec_1_HASH = HashingUtils::HashString("ipsec.1");
+        static constexpr int ipsec_1_HASH = HashingUtils::CompileTimeHashString("ipsec.1");
 
 
         GatewayType GetGatewayTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ipsec_1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GatewayType::ipsec_1;
+          case ipsec_1_HASH:
+            if (name == "ipsec.1")
+            {
+              return GatewayType::ipsec_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return GatewayType::NOT_SET;
         }
 
-        Aws::String GetNameForGatewayType(GatewayType enumValue)
+        const char* GetNameForGatewayType(GatewayType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
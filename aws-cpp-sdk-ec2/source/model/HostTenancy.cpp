@@ -30,20 +30,30 @@ namespace Aws
       namespace HostTenancyMapper
       {
 
-        static const int dedicated_HASH = HashingUtils::HashString("dedicated");
-        static const int host_HASH = HashingUtils::HashString("host");
+        static constexpr int dedicated_HASH = HashingUtils::CompileTimeHashString("dedicated");
+        static constexpr int host_HASH = HashingUtils::CompileTimeHashString("host");
 
 
         HostTenancy GetHostTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == dedicated_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HostTenancy::dedicated;
-          }
-          else if (hashCode == host_HASH)
-          {
-            return HostTenancy::host;
+          case dedicated_HASH:
+            if (name == "dedicated")
+            {
+              return HostTenancy::dedicated;
+            }
+            break;
+          case host_HASH:
+            if (name == "host")
+            {
+              return HostTenancy::host;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HostTenancy::NOT_SET;
         }
 
-        Aws::String GetNameForHostTenancy(HostTenancy enumValue)
+        const char* GetNameForHostTenancy(HostTenancy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HypervisorTypeMapper
       {
 
-        static const int ovm_HASH = HashingUtils::HashString("ovm");
-        static const int xen_HASH = HashingUtils::HashString("xen");
+        static constexpr int ovm_HASH = HashingUtils::CompileTimeHashString("ovm");
+        static constexpr int xen_HASH = HashingUtils::CompileTimeHashString("xen");
 
 
         HypervisorType GetHypervisorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ovm_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HypervisorType::ovm;
-          }
-          else if (hashCode == xen_HASH)
-          {
-            return HypervisorType::xen;
+          case ovm_HASH:
+            if (name == "ovm")
+            {
+              return HypervisorType::ovm;
+            }
+            break;
+          case xen_HASH:
+            if (name == "xen")
+            {
+              return HypervisorType::xen;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HypervisorType::NOT_SET;
         }
 
-        Aws::String GetNameForHypervisorType(HypervisorType enumValue)
+        const char* GetNameForHypervisorType(HypervisorType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace ImageAttributeNameMapper
       {
 
-        static const int description_HASH = HashingUtils::HashString("description");
-        static const int kernel_HASH = HashingUtils::HashString("kernel");
-        static const int ramdisk_HASH = HashingUtils::HashString("ramdisk");
-        static const int launchPermission_HASH = HashingUtils::HashString("launchPermission");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-        static const int blockDeviceMapping_HASH = HashingUtils::HashString("blockDeviceMapping");
-        static const int sriovNetSupport_HASH = HashingUtils::HashString("sriovNetSupport");
+        static constexpr int description_HASH = HashingUtils::CompileTimeHashString("description");
+        static constexpr int kernel_HASH = HashingUtils::CompileTimeHashString("kernel");
+        static constexpr int ramdisk_HASH = HashingUtils::CompileTimeHashString("ramdisk");
+        static constexpr int launchPermission_HASH = HashingUtils::CompileTimeHashString("launchPermission");
+        static constexpr int productCodes_HASH = HashingUtils::CompileTimeHashString("productCodes");
+        static constexpr int blockDeviceMapping_HASH = HashingUtils::CompileTimeHashString("blockDeviceMapping");
+        static constexpr int sriovNetSupport_HASH = HashingUtils::CompileTimeHashString("sriovNetSupport");
 
 
         ImageAttributeName GetImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == description_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ImageAttributeName::description;
-          }
-          else if (hashCode == kernel_HASH)
-          {
-            return ImageAttributeName::kernel;
-          }
-          else if (hashCode == ramdisk_HASH)
-          {
-            return ImageAttributeName::ramdisk;
-          }
-          else if (hashCode == launchPermission_HASH)
-          {
-            return ImageAttributeName::launchPermission;
-          }
-          else if (hashCode == productCodes_HASH)
-          {
-            return ImageAttributeName::productCodes;
-          }
-          else if (hashCode == blockDeviceMapping_HASH)
-          {
-            return ImageAttributeName::blockDeviceMapping;
-          }
-          else if (hashCode == sriovNetSupport_HASH)
-          {
-            return ImageAttributeName::sriovNetSupport;
+          case description_HASH:
+            if (name == "description")
+            {
+              return ImageAttributeName::description;
+            }
+            break;
+          case kernel_HASH:
+            if (name == "kernel")
+            {
+              return ImageAttributeName::kernel;
+            }
+            break;
+          case ramdisk_HASH:
+            if (name == "ramdisk")
+            {
+              return ImageAttributeName::ramdisk;
+            }
+            break;
+          case launchPermission_HASH:
+            if (name == "launchPermission")
+            {
+              return ImageAttributeName::launchPermission;
+            }
+            break;
+          case productCodes_HASH:
+            if (name == "productCodes")
+            {
+              return ImageAttributeName::productCodes;
+            }
+            break;
+          case blockDeviceMapping_HASH:
+            if (name == "blockDeviceMapping")
+            {
+              return ImageAttributeName::blockDeviceMapping;
+            }
+            break;
+          case sriovNetSupport_HASH:
+            if (name == "sriovNetSupport")
+            {
+              return ImageAttributeName::sriovNetSupport;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return ImageAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForImageAttributeName(ImageAttributeName enumValue)
+        const char* GetNameForImageAttributeName(ImageAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
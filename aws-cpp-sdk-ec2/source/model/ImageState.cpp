@@ -30,45 +30,65 @@ namespace Aws
       namespace ImageStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int invalid_HASH = HashingUtils::HashString("invalid");
-        static const int deregistered_HASH = HashingUtils::HashString("deregistered");
-        static const int transient_HASH = HashingUtils::HashString("transient");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int error_HASH = HashingUtils::HashString("error");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int invalid_HASH = HashingUtils::CompileTimeHashString("invalid");
+        static constexpr int deregistered_HASH = HashingUtils::CompileTimeHashString("deregistered");
+        static constexpr int transient_HASH = HashingUtils::CompileTimeHashString("transient");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
 
 
         ImageState GetImageStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ImageState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return ImageState::available;
-          }
-          else if (hashCode == invalid_HASH)
-          {
-            return ImageState::invalid;
-          }
-          else if (hashCode == deregistered_HASH)
-          {
-            return ImageState::deregistered;
-          }
-          else if (hashCode == transient_HASH)
-          {
-            return ImageState::transient;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return ImageState::failed;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return ImageState::error;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return ImageState::pending;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return ImageState::available;
+            }
+            break;
+          case invalid_HASH:
+            if (name == "invalid")
+            {
+              return ImageState::invalid;
+            }
+            break;
+          case deregistered_HASH:
+            if (name == "deregistered")
+            {
+              return ImageState::deregistered;
+            }
+            break;
+          case transient_HASH:
+            if (name == "transient")
+            {
+              return ImageState::transient;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return ImageState::failed;
+            }
+            break;
+          case error_HASH:
+            if (name == "error")
+            {
+              return ImageState::error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return ImageState::NOT_SET;
         }
 
-        Aws::String GetNameForImageState(ImageState enumValue)
+        const char* GetNameForImageState(ImageState enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
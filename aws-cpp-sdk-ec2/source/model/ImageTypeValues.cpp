@@ -30,25 +30,37 @@ namespace Aws
       namespace ImageTypeValuesMapper
       {
 
-        static const int machine_HASH = HashingUtils::HashString("machine");
-        static const int kernel_HASH = HashingUtils::HashString("kernel");
-        static const int ramdisk_HASH = HashingUtils::HashString("ramdisk");
+        static constexpr int machine_HASH = HashingUtils::CompileTimeHashString("machine");
+        static constexpr int kernel_HASH = HashingUtils::CompileTimeHashString("kernel");
+        static constexpr int ramdisk_HASH = HashingUtils::CompileTimeHashString("ramdisk");
 
 
         ImageTypeValues GetImageTypeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == machine_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ImageTypeValues::machine;
-          }
-          else if (hashCode == kernel_HASH)
-          {
-            return ImageTypeValues::kernel;
-          }
-          else if (hashCode == ramdisk_HASH)
-          {
-            return ImageTypeValues::ramdisk;
+          case machine_HASH:
+            if (name == "machine")
+            {
+              return ImageTypeValues::machine;
+            }
+            break;
+          case kernel_HASH:
+            if (name == "kernel")
+            {
+              return ImageTypeValues::kernel;
+            }
+            break;
+          case ramdisk_HASH:
+            if (name == "ramdisk")
+            {
+              return ImageTypeValues::ramdisk;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ImageTypeValues::NOT_SET;
         }
 
-        Aws::String GetNameForImageTypeValues(ImageTypeValues enumValue)
+        const char* GetNameForImageTypeValues(ImageTypeValues enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,80 +30,114 @@ namespace Aws
       namespace InstanceAttributeNameMapper
       {
 
-        static const int instanceType_HASH = HashingUtils::HashString("instanceType");
-        static const int kernel_HASH = HashingUtils::HashString("kernel");
-        static const int ramdisk_HASH = HashingUtils::HashString("ramdisk");
-        static const int userData_HASH = HashingUtils::HashString("userData");
-        static const int disableApiTermination_HASH = HashingUtils::HashString("disableApiTermination");
-        static const int instanceInitiatedShutdownBehavior_HASH = HashingUtils::HashString("instanceInitiatedShutdownBehavior");
-        static const int rootDeviceName_HASH = HashingUtils::HashString("rootDeviceName");
-        static const int blockDeviceMapping_HASH = HashingUtils::HashString("blockDeviceMapping");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-        static const int sourceDestCheck_HASH = HashingUtils::HashString("sourceDestCheck");
-        static const int groupSet_HASH = HashingUtils::HashString("groupSet");
-        static const int ebsOptimized_HASH = HashingUtils::HashString("ebsOptimized");
-        static const int sriovNetSupport_HASH = HashingUtils::HashString("sriovNetSupport");
-        static const int enaSupport_HASH = HashingUtils::HashString("enaSupport");
+        static constexpr int instanceType_HASH = HashingUtils::CompileTimeHashString("instanceType");
+        static constexpr int kernel_HASH = HashingUtils::CompileTimeHashString("kernel");
+        static constexpr int ramdisk_HASH = HashingUtils::CompileTimeHashString("ramdisk");
+        static constexpr int userData_HASH = HashingUtils::CompileTimeHashString("userData");
+        static constexpr int disableApiTermination_HASH = HashingUtils::CompileTimeHashString("disableApiTermination");
+        static constexpr int instanceInitiatedShutdownBehavior_HASH = HashingUtils::CompileTimeHashString("instanceInitiatedShutdownBehavior");
+        static constexpr int rootDeviceName_HASH = HashingUtils::CompileTimeHashString("rootDeviceName");
+        static constexpr int blockDeviceMapping_HASH = HashingUtils::CompileTimeHashString("blockDeviceMapping");
+        static constexpr int productCodes_HASH = HashingUtils::CompileTimeHashString("productCodes");
+        static constexpr int sourceDestCheck_HASH = HashingUtils::CompileTimeHashString("sourceDestCheck");
+        static constexpr int groupSet_HASH = HashingUtils::CompileTimeHashString("groupSet");
+        static constexpr int ebsOptimized_HASH = HashingUtils::CompileTimeHashString("ebsOptimized");
+        static constexpr int sriovNetSupport_HASH = HashingUtils::CompileTimeHashString("sriovNetSupport");
+        static constexpr int enaSupport_HASH = HashingUtils::CompileTimeHashString("enaSupport");
 
 
         InstanceAttributeName GetInstanceAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instanceType_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceAttributeName::instanceType;
-          }
-          else if (hashCode == kernel_HASH)
-          {
-            return InstanceAttributeName::kernel;
-          }
-          else if (hashCode == ramdisk_HASH)
-          {
-            return InstanceAttributeName::ramdisk;
-          }
-          else if (hashCode == userData_HASH)
-          {
-            return InstanceAttributeName::userData;
-          }
-          else if (hashCode == disableApiTermination_HASH)
-          {
-            return InstanceAttributeName::disableApiTermination;
-          }
-          else if (hashCode == instanceInitiatedShutdownBehavior_HASH)
-          {
-            return InstanceAttributeName::instanceInitiatedShutdownBehavior;
-          }
-          else if (hashCode == rootDeviceName_HASH)
-          {
-            return InstanceAttributeName::rootDeviceName;
-          }
-          else if (hashCode == blockDeviceMapping_HASH)
-          {
-            return InstanceAttributeName::blockDeviceMapping;
-          }
-          else if (hashCode == productCodes_HASH)
-          {
-            return InstanceAttributeName::productCodes;
-          }
-          else if (hashCode == sourceDestCheck_HASH)
-          {
-            return InstanceAttributeName::sourceDestCheck;
-          }
-          else if (hashCode == groupSet_HASH)
-          {
-            return InstanceAttributeName::groupSet;
-          }
-          else if (hashCode == ebsOptimized_HASH)
-          {
-            return InstanceAttributeName::ebsOptimized;
-          }
-          else if (hashCode == sriovNetSupport_HASH)
-          {
-            return InstanceAttributeName::sriovNetSupport;
-          }
-          else if (hashCode == enaSupport_HASH)
-          {
-            return InstanceAttributeName::enaSupport;
+          case instanceType_HASH:
+            if (name == "instanceType")
+            {
+              return InstanceAttributeName::instanceType;
+            }
+            break;
+          case kernel_HASH:
+            if (name == "kernel")
+            {
+              return InstanceAttributeName::kernel;
+            }
+            break;
+          case ramdisk_HASH:
+            if (name == "ramdisk")
+            {
+              return InstanceAttributeName::ramdisk;
+            }
+            break;
+          case userData_HASH:
+            if (name == "userData")
+            {
+              return InstanceAttributeName::userData;
+            }
+            break;
+          case disableApiTermination_HASH:
+            if (name == "disableApiTermination")
+            {
+              return InstanceAttributeName::disableApiTermination;
+            }
+            break;
+          case instanceInitiatedShutdownBehavior_HASH:
+            if (name == "instanceInitiatedShutdownBehavior")
+            {
+              return InstanceAttributeName::instanceInitiatedShutdownBehavior;
+            }
+            break;
+          case rootDeviceName_HASH:
+            if (name == "rootDeviceName")
+            {
+              return InstanceAttributeName::rootDeviceName;
+            }
+            break;
+          case blockDeviceMapping_HASH:
+            if (name == "blockDeviceMapping")
+            {
+              return InstanceAttributeName::blockDeviceMapping;
+            }
+            break;
+          case productCodes_HASH:
+            if (name == "productCodes")
+            {
+              return InstanceAttributeName::productCodes;
+            }
+            break;
+          case sourceDestCheck_HASH:
+            if (name == "sourceDestCheck")
+            {
+              return InstanceAttributeName::sourceDestCheck;
+            }
+            break;
+          case groupSet_HASH:
+            if (name == "groupSet")
+            {
+              return InstanceAttributeName::groupSet;
+            }
+            break;
+          case ebsOptimized_HASH:
+            if (name == "ebsOptimized")
+            {
+              return InstanceAttributeName::ebsOptimized;
+            }
+            break;
+          case sriovNetSupport_HASH:
+            if (name == "sriovNetSupport")
+            {
+              return InstanceAttributeName::sriovNetSupport;
+            }
+            break;
+          case enaSupport_HASH:
+            if (name == "enaSupport")
+            {
+              return InstanceAttributeName::enaSupport;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -115,7 +149,7 @@ namespace Aws
           return InstanceAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceAttributeName(InstanceAttributeName enumValue)
+        const char* GetNameForInstanceAttributeName(InstanceAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -151,7 +185,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
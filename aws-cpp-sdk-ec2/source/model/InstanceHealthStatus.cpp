@@ -30,20 +30,30 @@ namespace Aws
       namespace InstanceHealthStatusMapper
       {
 
-        static const int healthy_HASH = HashingUtils::HashString("healthy");
-        static const int unhealthy_HASH = HashingUtils::HashString("unhealthy");
+        static constexpr int healthy_HASH = HashingUtils::CompileTimeHashString("healthy");
+        static constexpr int unhealthy_HASH = HashingUtils::CompileTimeHashString("unhealthy");
 
 
         InstanceHealthStatus GetInstanceHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == healthy_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceHealthStatus::healthy;
-          }
-          else if (hashCode == unhealthy_HASH)
-          {
-            return InstanceHealthStatus::unhealthy;
+          case healthy_HASH:
+            if (name == "healthy")
+            {
+              return InstanceHealthStatus::healthy;
+            }
+            break;
+          case unhealthy_HASH:
+            if (name == "unhealthy")
+            {
+              return InstanceHealthStatus::unhealthy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InstanceHealthStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceHealthStatus(InstanceHealthStatus enumValue)
+        const char* GetNameForInstanceHealthStatus(InstanceHealthStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace InstanceInterruptionBehaviorMapper
       {
 
-        static const int hibernate_HASH = HashingUtils::HashString("hibernate");
-        static const int stop_HASH = HashingUtils::HashString("stop");
-        static const int terminate_HASH = HashingUtils::HashString("terminate");
+        static constexpr int hibernate_HASH = HashingUtils::CompileTimeHashString("hibernate");
+        static constexpr int stop_HASH = HashingUtils::CompileTimeHashString("stop");
+        static constexpr int terminate_HASH = HashingUtils::CompileTimeHashString("terminate");
 
 
         InstanceInterruptionBehavior GetInstanceInterruptionBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == hibernate_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceInterruptionBehavior::hibernate;
-          }
-          else if (hashCode == stop_HASH)
-          {
-            return InstanceInterruptionBehavior::stop;
-          }
-          else if (hashCode == terminate_HASH)
-          {
-            return InstanceInterruptionBehavior::terminate;
+          case hibernate_HASH:
+            if (name == "hibernate")
+            {
+              return InstanceInterruptionBehavior::hibernate;
+            }
+            break;
+          case stop_HASH:
+            if (name == "stop")
+            {
+              return InstanceInterruptionBehavior::stop;
+            }
+            break;
+          case terminate_HASH:
+            if (name == "terminate")
+            {
+              return InstanceInterruptionBehavior::terminate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InstanceInterruptionBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceInterruptionBehavior(InstanceInterruptionBehavior enumValue)
+        const char* GetNameForInstanceInterruptionBehavior(InstanceInterruptionBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
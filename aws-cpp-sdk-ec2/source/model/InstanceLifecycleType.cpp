@@ -30,20 +30,30 @@ namespace Aws
       namespace InstanceLifecycleTypeMapper
       {
 
-        static const int spot_HASH = HashingUtils::HashString("spot");
-        static const int scheduled_HASH = HashingUtils::HashString("scheduled");
+        static constexpr int spot_HASH = HashingUtils::CompileTimeHashString("spot");
+        static constexpr int scheduled_HASH = HashingUtils::CompileTimeHashString("scheduled");
 
 
         InstanceLifecycleType GetInstanceLifecycleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == spot_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceLifecycleType::spot;
-          }
-          else if (hashCode == scheduled_HASH)
-          {
-            return InstanceLifecycleType::scheduled;
+          case spot_HASH:
+            if (name == "spot")
+            {
+              return InstanceLifecycleType::spot;
+            }
+            break;
+          case scheduled_HASH:
+            if (name == "scheduled")
+            {
+              return InstanceLifecycleType::scheduled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InstanceLifecycleType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceLifecycleType(InstanceLifecycleType enumValue)
+        const char* GetNameForInstanceLifecycleType(InstanceLifecycleType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
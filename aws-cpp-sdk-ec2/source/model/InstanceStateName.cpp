@@ -30,40 +30,58 @@ namespace Aws
       namespace InstanceStateNameMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int running_HASH = HashingUtils::HashString("running");
-        static const int shutting_down_HASH = HashingUtils::HashString("shutting-down");
-        static const int terminated_HASH = HashingUtils::HashString("terminated");
-        static const int stopping_HASH = HashingUtils::HashString("stopping");
-        static const int stopped_HASH = HashingUtils::HashString("stopped");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int running_HASH = HashingUtils::CompileTimeHashString("running");
+        static constexpr int shutting_down_HASH = HashingUtils::CompileTimeHashString("shutting-down");
+        static constexpr int terminated_HASH = HashingUtils::CompileTimeHashString("terminated");
+        static constexpr int stopping_HASH = HashingUtils::CompileTimeHashString("stopping");
+        static constexpr int stopped_HASH = HashingUtils::CompileTimeHashString("stopped");
 
 
         InstanceStateName GetInstanceStateNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceStateName::pending;
-          }
-          else if (hashCode == running_HASH)
-          {
-            return InstanceStateName::running;
-          }
-          else if (hashCode == shutting_down_HASH)
-          {
-            return InstanceStateName::shutting_down;
-          }
-          else if (hashCode == terminated_HASH)
-          {
-            return InstanceStateName::terminated;
-          }
-          else if (hashCode == stopping_HASH)
-          {
-            return InstanceStateName::stopping;
-          }
-          else if (hashCode == stopped_HASH)
-          {
-            return InstanceStateName::stopped;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return InstanceStateName::pending;
+            }
+            break;
+          case running_HASH:
+            if (name == "running")
+            {
+              return InstanceStateName::running;
+            }
+            break;
+          case shutting_down_HASH:
+            if (name == "shutting-down")
+            {
+              return InstanceStateName::shutting_down;
+            }
+            break;
+          case terminated_HASH:
+            if (name == "terminated")
+            {
+              return InstanceStateName::terminated;
+            }
+            break;
+          case stopping_HASH:
+            if (name == "stopping")
+            {
+              return InstanceStateName::stopping;
+            }
+            break;
+          case stopped_HASH:
+            if (name == "stopped")
+            {
+              return InstanceStateName::stopped;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return InstanceStateName::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceStateName(InstanceStateName enumValue)
+        const char* GetNameForInstanceStateName(InstanceStateName enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,1356 +30,1318 @@ namespace Aws
       namespace InstanceTypeMapper
       {
 
-        static const int t1_micro_HASH = HashingUtils::HashString("t1.micro");
-        static const int t2_nano_HASH = HashingUtils::HashString("t2.nano");
-        static const int t2_micro_HASH = HashingUtils::HashString("t2.micro");
-        static const int t2_small_HASH = HashingUtils::HashString("t2.small");
-        static const int t2_medium_HASH = HashingUtils::HashString("t2.medium");
-        static const int t2_large_HASH = HashingUtils::HashString("t2.large");
-        static const int t2_xlarge_HASH = HashingUtils::HashString("t2.xlarge");
-        static const int t2_2xlarge_HASH = HashingUtils::HashString("t2.2xlarge");
-        static const int m1_small_HASH = HashingUtils::HashString("m1.small");
-        static const int m1_medium_HASH = HashingUtils::HashString("m1.medium");
-        static const int m1_large_HASH = HashingUtils::HashString("m1.large");
-        static const int m1_xlarge_HASH = HashingUtils::HashString("m1.xlarge");
-        static const int m3_medium_HASH = HashingUtils::HashString("m3.medium");
-        static const int m3_large_HASH = HashingUtils::HashString("m3.large");
-        static const int m3_xlarge_HASH = HashingUtils::HashString("m3.xlarge");
-        static const int m3_2xlarge_HASH = HashingUtils::HashString("m3.2xlarge");
-        static const int m4_large_HASH = HashingUtils::HashString("m4.large");
-        static const int m4_xlarge_HASH = HashingUtils::HashString("m4.xlarge");
-        static const int m4_2xlarge_HASH = HashingUtils::HashString("m4.2xlarge");
-        static const int m4_4xlarge_HASH = HashingUtils::HashString("m4.4xlarge");
-        static const int m4_10xlarge_HASH = HashingUtils::HashString("m4.10xlarge");
-        static const int m4_16xlarge_HASH = HashingUtils::HashString("m4.16xlarge");
-        static const int m2_xlarge_HASH = HashingUtils::HashString("m2.xlarge");
-        static const int m2_2xlarge_HASH = HashingUtils::HashString("m2.2xlarge");
-        static const int m2_4xlarge_HASH = HashingUtils::HashString("m2.4xlarge");
-        static const int cr1_8xlarge_HASH = HashingUtils::HashString("cr1.8xlarge");
-        static const int r3_large_HASH = HashingUtils::HashString("r3.large");
-        static const int r3_xlarge_HASH = HashingUtils::HashString("r3.xlarge");
-        static const int r3_2xlarge_HASH = HashingUtils::HashString("r3.2xlarge");
-        static const int r3_4xlarge_HASH = HashingUtils::HashString("r3.4xlarge");
-        static const int r3_8xlarge_HASH = HashingUtils::HashString("r3.8xlarge");
-        static const int r4_large_HASH = HashingUtils::HashString("r4.large");
-        static const int r4_xlarge_HASH = HashingUtils::HashString("r4.xlarge");
-        static const int r4_2xlarge_HASH = HashingUtils::HashString("r4.2xlarge");
-        static const int r4_4xlarge_HASH = HashingUtils::HashString("r4.4xlarge");
-        static const int r4_8xlarge_HASH = HashingUtils::HashString("r4.8xlarge");
-        static const int r4_16xlarge_HASH = HashingUtils::HashString("r4.16xlarge");
-        static const int r5_large_HASH = HashingUtils::HashString("r5.large");
-        static const int r5_xlarge_HASH = HashingUtils::HashString("r5.xlarge");
-        static const int r5_2xlarge_HASH = HashingUtils::HashString("r5.2xlarge");
-        static const int r5_4xlarge_HASH = HashingUtils::HashString("r5.4xlarge");
-        static const int r5_8xlarge_HASH = HashingUtils::HashString("r5.8xlarge");
-        static const int r5_12xlarge_HASH = HashingUtils::HashString("r5.12xlarge");
-        static const int r5_16xlarge_HASH = HashingUtils::HashString("r5.16xlarge");
-        static const int r5_24xlarge_HASH = HashingUtils::HashString("r5.24xlarge");
-        static const int r5_metal_HASH = HashingUtils::HashString("r5.metal");
-        static const int r5d_large_HASH = HashingUtils::HashString("r5d.large");
-        static const int r5d_xlarge_HASH = HashingUtils::HashString("r5d.xlarge");
-        static const int r5d_2xlarge_HASH = HashingUtils::HashString("r5d.2xlarge");
-        static const int r5d_4xlarge_HASH = HashingUtils::HashString("r5d.4xlarge");
-        static const int r5d_8xlarge_HASH = HashingUtils::HashString("r5d.8xlarge");
-        static const int r5d_12xlarge_HASH = HashingUtils::HashString("r5d.12xlarge");
-        static const int r5d_16xlarge_HASH = HashingUtils::HashString("r5d.16xlarge");
-        static const int r5d_24xlarge_HASH = HashingUtils::HashString("r5d.24xlarge");
-        static const int r5d_metal_HASH = HashingUtils::HashString("r5d.metal");
-        static const int x1_16xlarge_HASH = HashingUtils::HashString("x1.16xlarge");
-        static const int x1_32xlarge_HASH = HashingUtils::HashString("x1.32xlarge");
-        static const int x1e_xlarge_HASH = HashingUtils::HashString("x1e.xlarge");
-        static const int x1e_2xlarge_HASH = HashingUtils::HashString("x1e.2xlarge");
-        static const int x1e_4xlarge_HASH = HashingUtils::HashString("x1e.4xlarge");
-        static const int x1e_8xlarge_HASH = HashingUtils::HashString("x1e.8xlarge");
-        static const int x1e_16xlarge_HASH = HashingUtils::HashString("x1e.16xlarge");
-        static const int x1e_32xlarge_HASH = HashingUtils::HashString("x1e.32xlarge");
-        static const int i2_xlarge_HASH = HashingUtils::HashString("i2.xlarge");
-        static const int i2_2xlarge_HASH = HashingUtils::HashString("i2.2xlarge");
-        static const int i2_4xlarge_HASH = HashingUtils::HashString("i2.4xlarge");
-        static const int i2_8xlarge_HASH = HashingUtils::HashString("i2.8xlarge");
-        static const int i3_large_HASH = HashingUtils::HashString("i3.large");
-        static const int i3_xlarge_HASH = HashingUtils::HashString("i3.xlarge");
-        static const int i3_2xlarge_HASH = HashingUtils::HashString("i3.2xlarge");
-        static const int i3_4xlarge_HASH = HashingUtils::HashString("i3.4xlarge");
-        static const int i3_8xlarge_HASH = HashingUtils::HashString("i3.8xlarge");
-        static const int i3_16xlarge_HASH = HashingUtils::HashString("i3.16xlarge");
-        static const int i3_metal_HASH = HashingUtils::HashString("i3.metal");
-        static const int hi1_4xlarge_HASH = HashingUtils::HashString("hi1.4xlarge");
-        static const int hs1_8xlarge_HASH = HashingUtils::HashString("hs1.8xlarge");
-        static const int c1_medium_HASH = HashingUtils::HashString("c1.medium");
-        static const int c1_xlarge_HASH = HashingUtils::HashString("c1.xlarge");
-        static const int c3_large_HASH = HashingUtils::HashString("c3.large");
-        static const int c3_xlarge_HASH = HashingUtils::HashString("c3.xlarge");
-        static const int c3_2xlarge_HASH = HashingUtils::HashString("c3.2xlarge");
-        static const int c3_4xlarge_HASH = HashingUtils::HashString("c3.4xlarge");
-        static const int c3_8xlarge_HASH = HashingUtils::HashString("c3.8xlarge");
-        static const int c4_large_HASH = HashingUtils::HashString("c4.large");
-        static const int c4_xlarge_HASH = HashingUtils::HashString("c4.xlarge");
-        static const int c4_2xlarge_HASH = HashingUtils::HashString("c4.2xlarge");
-        static const int c4_4xlarge_HASH = HashingUtils::HashString("c4.4xlarge");
-        static const int c4_8xlarge_HASH = HashingUtils::HashString("c4.8xlarge");
-        static const int c5_large_HASH = HashingUtils::HashString("c5.large");
-        static const int c5_xlarge_HASH = HashingUtils::HashString("c5.xlarge");
-        static const int c5_2xlarge_HASH = HashingUtils::HashString("c5.2xlarge");
-        static const int c5_4xlarge_HASH = HashingUtils::HashString("c5.4xlarge");
-        static const int c5_9xlarge_HASH = HashingUtils::HashString("c5.9xlarge");
-        static const int c5_18xlarge_HASH = HashingUtils::HashString("c5.18xlarge");
-        static const int c5d_large_HASH = HashingUtils::HashString("c5d.large");
-        static const int c5d_xlarge_HASH = HashingUtils::HashString("c5d.xlarge");
-        static const int c5d_2xlarge_HASH = HashingUtils::HashString("c5d.2xlarge");
-        static const int c5d_4xlarge_HASH = HashingUtils::HashString("c5d.4xlarge");
-        static const int c5d_9xlarge_HASH = HashingUtils::HashString("c5d.9xlarge");
-        static const int c5d_18xlarge_HASH = HashingUtils::HashString("c5d.18xlarge");
-        static const int cc1_4xlarge_HASH = HashingUtils::HashString("cc1.4xlarge");
-        static const int cc2_8xlarge_HASH = HashingUtils::HashString("cc2.8xlarge");
-        static const int g2_2xlarge_HASH = HashingUtils::HashString("g2.2xlarge");
-        static const int g2_8xlarge_HASH = HashingUtils::HashString("g2.8xlarge");
-        static const int g3_4xlarge_HASH = HashingUtils::HashString("g3.4xlarge");
-        static const int g3_8xlarge_HASH = HashingUtils::HashString("g3.8xlarge");
-        static const int g3_16xlarge_HASH = HashingUtils::HashString("g3.16xlarge");
-        static const int cg1_4xlarge_HASH = HashingUtils::HashString("cg1.4xlarge");
-        static const int p2_xlarge_HASH = HashingUtils::HashString("p2.xlarge");
-        static const int p2_8xlarge_HASH = HashingUtils::HashString("p2.8xlarge");
-        static const int p2_16xlarge_HASH = HashingUtils::HashString("p2.16xlarge");
-        static const int p3_2xlarge_HASH = HashingUtils::HashString("p3.2xlarge");
-        static const int p3_8xlarge_HASH = HashingUtils::HashString("p3.8xlarge");
-        static const int p3_16xlarge_HASH = HashingUtils::HashString("p3.16xlarge");
-        static const int d2_xlarge_HASH = HashingUtils::HashString("d2.xlarge");
-        static const int d2_2xlarge_HASH = HashingUtils::HashString("d2.2xlarge");
-        static const int d2_4xlarge_HASH = HashingUtils::HashString("d2.4xlarge");
-        static const int d2_8xlarge_HASH = HashingUtils::HashString("d2.8xlarge");
-        static const int f1_2xlarge_HASH = HashingUtils::HashString("f1.2xlarge");
-        static const int f1_16xlarge_HASH = HashingUtils::HashString("f1.16xlarge");
-        static const int m5_large_HASH = HashingUtils::HashString("m5.large");
-        static const int m5_xlarge_HASH = HashingUtils::HashString("m5.xlarge");
-        static const int m5_2xlarge_HASH = HashingUtils::HashString("m5.2xlarge");
-        static const int m5_4xlarge_HASH = HashingUtils::HashString("m5.4xlarge");
-        static const int m5_12xlarge_HASH = HashingUtils::HashString("m5.12xlarge");
-        static const int m5_24xlarge_HASH = HashingUtils::HashString("m5.24xlarge");
-        static const int m5d_large_HASH = HashingUtils::HashString("m5d.large");
-        static const int m5d_xlarge_HASH = HashingUtils::HashString("m5d.xlarge");
-        static const int m5d_2xlarge_HASH = HashingUtils::HashString("m5d.2xlarge");
-        static const int m5d_4xlarge_HASH = HashingUtils::HashString("m5d.4xlarge");
-        static const int m5d_12xlarge_HASH = HashingUtils::HashString("m5d.12xlarge");
-        static const int m5d_24xlarge_HASH = HashingUtils::HashString("m5d.24xlarge");
-        static const int h1_2xlarge_HASH = HashingUtils::HashString("h1.2xlarge");
-        static const int h1_4xlarge_HASH = HashingUtils::HashString("h1.4xlarge");
-        static const int h1_8xlarge_HASH = HashingUtils::HashString("h1.8xlarge");
-        static const int h1_16xlarge_HASH = HashingUtils::HashString("h1.16xlarge");
-        static const int z1d_large_HASH = HashingUtils::HashString("z1d.large");
-        static const int z1d_xlarge_HASH = HashingUtils::HashString("z1d.xlarge");
-        static const int z1d_2xlarge_HASH = HashingUtils::HashString("z1d.2xlarge");
-        static const int z1d_3xlarge_HASH = HashingUtils::HashString("z1d.3xlarge");
-        static const int z1d_6xlarge_HASH = HashingUtils::HashString("z1d.6xlarge");
-        static const int z1d_12xlarge_HASH = HashingUtils::HashString("z1d.12xlarge");
+        static constexpr int t1_micro_HASH = HashingUtils::CompileTimeHashString("t1.micro");
+        static constexpr int t2_nano_HASH = HashingUtils::CompileTimeHashString("t2.nano");
+        static constexpr int t2_micro_HASH = HashingUtils::CompileTimeHashString("t2.micro");
+        static constexpr int t2_small_HASH = HashingUtils::CompileTimeHashString("t2.small");
+        static constexpr int t2_medium_HASH = HashingUtils::CompileTimeHashString("t2.medium");
+        static constexpr int t2_large_HASH = HashingUtils::CompileTimeHashString("t2.large");
+        static constexpr int t2_xlarge_HASH = HashingUtils::CompileTimeHashString("t2.xlarge");
+        static constexpr int t2_2xlarge_HASH = HashingUtils::CompileTimeHashString("t2.2xlarge");
+        static constexpr int m1_small_HASH = HashingUtils::CompileTimeHashString("m1.small");
+        static constexpr int m1_medium_HASH = HashingUtils::CompileTimeHashString("m1.medium");
+        static constexpr int m1_large_HASH = HashingUtils::CompileTimeHashString("m1.large");
+        static constexpr int m1_xlarge_HASH = HashingUtils::CompileTimeHashString("m1.xlarge");
+        static constexpr int m3_medium_HASH = HashingUtils::CompileTimeHashString("m3.medium");
+        static constexpr int m3_large_HASH = HashingUtils::CompileTimeHashString("m3.large");
+        static constexpr int m3_xlarge_HASH = HashingUtils::CompileTimeHashString("m3.xlarge");
+        static constexpr int m3_2xlarge_HASH = HashingUtils::CompileTimeHashString("m3.2xlarge");
+        static constexpr int m4_large_HASH = HashingUtils::CompileTimeHashString("m4.large");
+        static constexpr int m4_xlarge_HASH = HashingUtils::CompileTimeHashString("m4.xlarge");
+        static constexpr int m4_2xlarge_HASH = HashingUtils::CompileTimeHashString("m4.2xlarge");
+        static constexpr int m4_4xlarge_HASH = HashingUtils::CompileTimeHashString("m4.4xlarge");
+        static constexpr int m4_10xlarge_HASH = HashingUtils::CompileTimeHashString("m4.10xlarge");
+        static constexpr int m4_16xlarge_HASH = HashingUtils::CompileTimeHashString("m4.16xlarge");
+        static constexpr int m2_xlarge_HASH = HashingUtils::CompileTimeHashString("m2.xlarge");
+        static constexpr int m2_2xlarge_HASH = HashingUtils::CompileTimeHashString("m2.2xlarge");
+        static constexpr int m2_4xlarge_HASH = HashingUtils::CompileTimeHashString("m2.4xlarge");
+        static constexpr int cr1_8xlarge_HASH = HashingUtils::CompileTimeHashString("cr1.8xlarge");
+        static constexpr int r3_large_HASH = HashingUtils::CompileTimeHashString("r3.large");
+        static constexpr int r3_xlarge_HASH = HashingUtils::CompileTimeHashString("r3.xlarge");
+        static constexpr int r3_2xlarge_HASH = HashingUtils::CompileTimeHashString("r3.2xlarge");
+        static constexpr int r3_4xlarge_HASH = HashingUtils::CompileTimeHashString("r3.4xlarge");
+        static constexpr int r3_8xlarge_HASH = HashingUtils::CompileTimeHashString("r3.8xlarge");
+        static constexpr int r4_large_HASH = HashingUtils::CompileTimeHashString("r4.large");
+        static constexpr int r4_xlarge_HASH = HashingUtils::CompileTimeHashString("r4.xlarge");
+        static constexpr int r4_2xlarge_HASH = HashingUtils::CompileTimeHashString("r4.2xlarge");
+        static constexpr int r4_4xlarge_HASH = HashingUtils::CompileTimeHashString("r4.4xlarge");
+        static constexpr int r4_8xlarge_HASH = HashingUtils::CompileTimeHashString("r4.8xlarge");
+        static constexpr int r4_16xlarge_HASH = HashingUtils::CompileTimeHashString("r4.16xlarge");
+        static constexpr int r5_large_HASH = HashingUtils::CompileTimeHashString("r5.large");
+        static constexpr int r5_xlarge_HASH = HashingUtils::CompileTimeHashString("r5.xlarge");
+        static constexpr int r5_2xlarge_HASH = HashingUtils::CompileTimeHashString("r5.2xlarge");
+        static constexpr int r5_4xlarge_HASH = HashingUtils::CompileTimeHashString("r5.4xlarge");
+        static constexpr int r5_8xlarge_HASH = HashingUtils::CompileTimeHashString("r5.8xlarge");
+        static constexpr int r5_12xlarge_HASH = HashingUtils::CompileTimeHashString("r5.12xlarge");
+        static constexpr int r5_16xlarge_HASH = HashingUtils::CompileTimeHashString("r5.16xlarge");
+        static constexpr int r5_24xlarge_HASH = HashingUtils::CompileTimeHashString("r5.24xlarge");
+        static constexpr int r5_metal_HASH = HashingUtils::CompileTimeHashString("r5.metal");
+        static constexpr int r5d_large_HASH = HashingUtils::CompileTimeHashString("r5d.large");
+        static constexpr int r5d_xlarge_HASH = HashingUtils::CompileTimeHashString("r5d.xlarge");
+        static constexpr int r5d_2xlarge_HASH = HashingUtils::CompileTimeHashString("r5d.2xlarge");
+        static constexpr int r5d_4xlarge_HASH = HashingUtils::CompileTimeHashString("r5d.4xlarge");
+        static constexpr int r5d_8xlarge_HASH = HashingUtils::CompileTimeHashString("r5d.8xlarge");
+        static constexpr int r5d_12xlarge_HASH = HashingUtils::CompileTimeHashString("r5d.12xlarge");
+        static constexpr int r5d_16xlarge_HASH = HashingUtils::CompileTimeHashString("r5d.16xlarge");
+        static constexpr int r5d_24xlarge_HASH = HashingUtils::CompileTimeHashString("r5d.24xlarge");
+        static constexpr int r5d_metal_HASH = HashingUtils::CompileTimeHashString("r5d.metal");
+        static constexpr int x1_16xlarge_HASH = HashingUtils::CompileTimeHashString("x1.16xlarge");
+        static constexpr int x1_32xlarge_HASH = HashingUtils::CompileTimeHashString("x1.32xlarge");
+        static constexpr int x1e_xlarge_HASH = HashingUtils::CompileTimeHashString("x1e.xlarge");
+        static constexpr int x1e_2xlarge_HASH = HashingUtils::CompileTimeHashString("x1e.2xlarge");
+        static constexpr int x1e_4xlarge_HASH = HashingUtils::CompileTimeHashString("x1e.4xlarge");
+        static constexpr int x1e_8xlarge_HASH = HashingUtils::CompileTimeHashString("x1e.8xlarge");
+        static constexpr int x1e_16xlarge_HASH = HashingUtils::CompileTimeHashString("x1e.16xlarge");
+        static constexpr int x1e_32xlarge_HASH = HashingUtils::CompileTimeHashString("x1e.32xlarge");
+        static constexpr int i2_xlarge_HASH = HashingUtils::CompileTimeHashString("i2.xlarge");
+        static constexpr int i2_2xlarge_HASH = HashingUtils::CompileTimeHashString("i2.2xlarge");
+        static constexpr int i2_4xlarge_HASH = HashingUtils::CompileTimeHashString("i2.4xlarge");
+        static constexpr int i2_8xlarge_HASH = HashingUtils::CompileTimeHashString("i2.8xlarge");
+        static constexpr int i3_large_HASH = HashingUtils::CompileTimeHashString("i3.large");
+        static constexpr int i3_xlarge_HASH = HashingUtils::CompileTimeHashString("i3.xlarge");
+        static constexpr int i3_2xlarge_HASH = HashingUtils::CompileTimeHashString("i3.2xlarge");
+        static constexpr int i3_4xlarge_HASH = HashingUtils::CompileTimeHashString("i3.4xlarge");
+        static constexpr int i3_8xlarge_HASH = HashingUtils::CompileTimeHashString("i3.8xlarge");
+        static constexpr int i3_16xlarge_HASH = HashingUtils::CompileTimeHashString("i3.16xlarge");
+        static constexpr int i3_metal_HASH = HashingUtils::CompileTimeHashString("i3.metal");
+        static constexpr int hi1_4xlarge_HASH = HashingUtils::CompileTimeHashString("hi1.4xlarge");
+        static constexpr int hs1_8xlarge_HASH = HashingUtils::CompileTimeHashString("hs1.8xlarge");
+        static constexpr int c1_medium_HASH = HashingUtils::CompileTimeHashString("c1.medium");
+        static constexpr int c1_xlarge_HASH = HashingUtils::CompileTimeHashString("c1.xlarge");
+        static constexpr int c3_large_HASH = HashingUtils::CompileTimeHashString("c3.large");
+        static constexpr int c3_xlarge_HASH = HashingUtils::CompileTimeHashString("c3.xlarge");
+        static constexpr int c3_2xlarge_HASH = HashingUtils::CompileTimeHashString("c3.2xlarge");
+        static constexpr int c3_4xlarge_HASH = HashingUtils::CompileTimeHashString("c3.4xlarge");
+        static constexpr int c3_8xlarge_HASH = HashingUtils::CompileTimeHashString("c3.8xlarge");
+        static constexpr int c4_large_HASH = HashingUtils::CompileTimeHashString("c4.large");
+        static constexpr int c4_xlarge_HASH = HashingUtils::CompileTimeHashString("c4.xlarge");
+        static constexpr int c4_2xlarge_HASH = HashingUtils::CompileTimeHashString("c4.2xlarge");
+        static constexpr int c4_4xlarge_HASH = HashingUtils::CompileTimeHashString("c4.4xlarge");
+        static constexpr int c4_8xlarge_HASH = HashingUtils::CompileTimeHashString("c4.8xlarge");
+        static constexpr int c5_large_HASH = HashingUtils::CompileTimeHashString("c5.large");
+        static constexpr int c5_xlarge_HASH = HashingUtils::CompileTimeHashString("c5.xlarge");
+        static constexpr int c5_2xlarge_HASH = HashingUtils::CompileTimeHashString("c5.2xlarge");
+        static constexpr int c5_4xlarge_HASH = HashingUtils::CompileTimeHashString("c5.4xlarge");
+        static constexpr int c5_9xlarge_HASH = HashingUtils::CompileTimeHashString("c5.9xlarge");
+        static constexpr int c5_18xlarge_HASH = HashingUtils::CompileTimeHashString("c5.18xlarge");
+        static constexpr int c5d_large_HASH = HashingUtils::CompileTimeHashString("c5d.large");
+        static constexpr int c5d_xlarge_HASH = HashingUtils::CompileTimeHashString("c5d.xlarge");
+        static constexpr int c5d_2xlarge_HASH = HashingUtils::CompileTimeHashString("c5d.2xlarge");
+        static constexpr int c5d_4xlarge_HASH = HashingUtils::CompileTimeHashString("c5d.4xlarge");
+        static constexpr int c5d_9xlarge_HASH = HashingUtils::CompileTimeHashString("c5d.9xlarge");
+        static constexpr int c5d_18xlarge_HASH = HashingUtils::CompileTimeHashString("c5d.18xlarge");
+        static constexpr int cc1_4xlarge_HASH = HashingUtils::CompileTimeHashString("cc1.4xlarge");
+        static constexpr int cc2_8xlarge_HASH = HashingUtils::CompileTimeHashString("cc2.8xlarge");
+        static constexpr int g2_2xlarge_HASH = HashingUtils::CompileTimeHashString("g2.2xlarge");
+        static constexpr int g2_8xlarge_HASH = HashingUtils::CompileTimeHashString("g2.8xlarge");
+        static constexpr int g3_4xlarge_HASH = HashingUtils::CompileTimeHashString("g3.4xlarge");
+        static constexpr int g3_8xlarge_HASH = HashingUtils::CompileTimeHashString("g3.8xlarge");
+        static constexpr int g3_16xlarge_HASH = HashingUtils::CompileTimeHashString("g3.16xlarge");
+        static constexpr int cg1_4xlarge_HASH = HashingUtils::CompileTimeHashString("cg1.4xlarge");
+        static constexpr int p2_xlarge_HASH = HashingUtils::CompileTimeHashString("p2.xlarge");
+        static constexpr int p2_8xlarge_HASH = HashingUtils::CompileTimeHashString("p2.8xlarge");
+        static constexpr int p2_16xlarge_HASH = HashingUtils::CompileTimeHashString("p2.16xlarge");
+        static constexpr int p3_2xlarge_HASH = HashingUtils::CompileTimeHashString("p3.2xlarge");
+        static constexpr int p3_8xlarge_HASH = HashingUtils::CompileTimeHashString("p3.8xlarge");
+        static constexpr int p3_16xlarge_HASH = HashingUtils::CompileTimeHashString("p3.16xlarge");
+        static constexpr int d2_xlarge_HASH = HashingUtils::CompileTimeHashString("d2.xlarge");
+        static constexpr int d2_2xlarge_HASH = HashingUtils::CompileTimeHashString("d2.2xlarge");
+        static constexpr int d2_4xlarge_HASH = HashingUtils::CompileTimeHashString("d2.4xlarge");
+        static constexpr int d2_8xlarge_HASH = HashingUtils::CompileTimeHashString("d2.8xlarge");
+        static constexpr int f1_2xlarge_HASH = HashingUtils::CompileTimeHashString("f1.2xlarge");
+        static constexpr int f1_16xlarge_HASH = HashingUtils::CompileTimeHashString("f1.16xlarge");
+        static constexpr int m5_large_HASH = HashingUtils::CompileTimeHashString("m5.large");
+        static constexpr int m5_xlarge_HASH = HashingUtils::CompileTimeHashString("m5.xlarge");
+        static constexpr int m5_2xlarge_HASH = HashingUtils::CompileTimeHashString("m5.2xlarge");
+        static constexpr int m5_4xlarge_HASH = HashingUtils::CompileTimeHashString("m5.4xlarge");
+        static constexpr int m5_12xlarge_HASH = HashingUtils::CompileTimeHashString("m5.12xlarge");
+        static constexpr int m5_24xlarge_HASH = HashingUtils::CompileTimeHashString("m5.24xlarge");
+        static constexpr int m5d_large_HASH = HashingUtils::CompileTimeHashString("m5d.large");
+        static constexpr int m5d_xlarge_HASH = HashingUtils::CompileTimeHashString("m5d.xlarge");
+        static constexpr int m5d_2xlarge_HASH = HashingUtils::CompileTimeHashString("m5d.2xlarge");
+        static constexpr int m5d_4xlarge_HASH = HashingUtils::CompileTimeHashString("m5d.4xlarge");
+        static constexpr int m5d_12xlarge_HASH = HashingUtils::CompileTimeHashString("m5d.12xlarge");
+        static constexpr int m5d_24xlarge_HASH = HashingUtils::CompileTimeHashString("m5d.24xlarge");
+        static constexpr int h1_2xlarge_HASH = HashingUtils::CompileTimeHashString("h1.2xlarge");
+        static constexpr int h1_4xlarge_HASH = HashingUtils::CompileTimeHashString("h1.4xlarge");
+        static constexpr int h1_8xlarge_HASH = HashingUtils::CompileTimeHashString("h1.8xlarge");
+        static constexpr int h1_16xlarge_HASH = HashingUtils::CompileTimeHashString("h1.16xlarge");
+        static constexpr int z1d_large_HASH = HashingUtils::CompileTimeHashString("z1d.large");
+        static constexpr int z1d_xlarge_HASH = HashingUtils::CompileTimeHashString("z1d.xlarge");
+        static constexpr int z1d_2xlarge_HASH = HashingUtils::CompileTimeHashString("z1d.2xlarge");
+        static constexpr int z1d_3xlarge_HASH = HashingUtils::CompileTimeHashString("z1d.3xlarge");
+        static constexpr int z1d_6xlarge_HASH = HashingUtils::CompileTimeHashString("z1d.6xlarge");
+        static constexpr int z1d_12xlarge_HASH = HashingUtils::CompileTimeHashString("z1d.12xlarge");
 
-        /*
-        The if-else chains in this file are converted into a jump table by the compiler,
-        which allows constant time lookup. The chain has been broken into helper functions
-        because MSVC has a maximum of 122 chained if-else blocks.
-        */
-        static bool GetEnumForNameHelper0(int hashCode, InstanceType& enumValue)
-        {
-          if (hashCode == t1_micro_HASH)
-          {
-            enumValue = InstanceType::t1_micro;
-            return true;
-          }
-          else if (hashCode == t2_nano_HASH)
-          {
-            enumValue = InstanceType::t2_nano;
-            return true;
-          }
-          else if (hashCode == t2_micro_HASH)
-          {
-            enumValue = InstanceType::t2_micro;
-            return true;
-          }
-          else if (hashCode == t2_small_HASH)
-          {
-            enumValue = InstanceType::t2_small;
-            return true;
-          }
-          else if (hashCode == t2_medium_HASH)
-          {
-            enumValue = InstanceType::t2_medium;
-            return true;
-          }
-          else if (hashCode == t2_large_HASH)
-          {
-            enumValue = InstanceType::t2_large;
-            return true;
-          }
-          else if (hashCode == t2_xlarge_HASH)
-          {
-            enumValue = InstanceType::t2_xlarge;
-            return true;
-          }
-          else if (hashCode == t2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::t2_2xlarge;
-            return true;
-          }
-          else if (hashCode == m1_small_HASH)
-          {
-            enumValue = InstanceType::m1_small;
-            return true;
-          }
-          else if (hashCode == m1_medium_HASH)
-          {
-            enumValue = InstanceType::m1_medium;
-            return true;
-          }
-          else if (hashCode == m1_large_HASH)
-          {
-            enumValue = InstanceType::m1_large;
-            return true;
-          }
-          else if (hashCode == m1_xlarge_HASH)
-          {
-            enumValue = InstanceType::m1_xlarge;
-            return true;
-          }
-          else if (hashCode == m3_medium_HASH)
-          {
-            enumValue = InstanceType::m3_medium;
-            return true;
-          }
-          else if (hashCode == m3_large_HASH)
-          {
-            enumValue = InstanceType::m3_large;
-            return true;
-          }
-          else if (hashCode == m3_xlarge_HASH)
-          {
-            enumValue = InstanceType::m3_xlarge;
-            return true;
-          }
-          else if (hashCode == m3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m3_2xlarge;
-            return true;
-          }
-          else if (hashCode == m4_large_HASH)
-          {
-            enumValue = InstanceType::m4_large;
-            return true;
-          }
-          else if (hashCode == m4_xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_xlarge;
-            return true;
-          }
-          else if (hashCode == m4_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_2xlarge;
-            return true;
-          }
-          else if (hashCode == m4_4xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_4xlarge;
-            return true;
-          }
-          else if (hashCode == m4_10xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_10xlarge;
-            return true;
-          }
-          else if (hashCode == m4_16xlarge_HASH)
-          {
-            enumValue = InstanceType::m4_16xlarge;
-            return true;
-          }
-          else if (hashCode == m2_xlarge_HASH)
-          {
-            enumValue = InstanceType::m2_xlarge;
-            return true;
-          }
-          else if (hashCode == m2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m2_2xlarge;
-            return true;
-          }
-          else if (hashCode == m2_4xlarge_HASH)
-          {
-            enumValue = InstanceType::m2_4xlarge;
-            return true;
-          }
-          else if (hashCode == cr1_8xlarge_HASH)
-          {
-            enumValue = InstanceType::cr1_8xlarge;
-            return true;
-          }
-          else if (hashCode == r3_large_HASH)
-          {
-            enumValue = InstanceType::r3_large;
-            return true;
-          }
-          else if (hashCode == r3_xlarge_HASH)
-          {
-            enumValue = InstanceType::r3_xlarge;
-            return true;
-          }
-          else if (hashCode == r3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::r3_2xlarge;
-            return true;
-          }
-          else if (hashCode == r3_4xlarge_HASH)
-          {
-            enumValue = InstanceType::r3_4xlarge;
-            return true;
-          }
-          else if (hashCode == r3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::r3_8xlarge;
-            return true;
-          }
-          else if (hashCode == r4_large_HASH)
-          {
-            enumValue = InstanceType::r4_large;
-            return true;
-          }
-          else if (hashCode == r4_xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_xlarge;
-            return true;
-          }
-          else if (hashCode == r4_2xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_2xlarge;
-            return true;
-          }
-          else if (hashCode == r4_4xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_4xlarge;
-            return true;
-          }
-          else if (hashCode == r4_8xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_8xlarge;
-            return true;
-          }
-          else if (hashCode == r4_16xlarge_HASH)
-          {
-            enumValue = InstanceType::r4_16xlarge;
-            return true;
-          }
-          else if (hashCode == r5_large_HASH)
-          {
-            enumValue = InstanceType::r5_large;
-            return true;
-          }
-          else if (hashCode == r5_xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_xlarge;
-            return true;
-          }
-          else if (hashCode == r5_2xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_2xlarge;
-            return true;
-          }
-          else if (hashCode == r5_4xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_4xlarge;
-            return true;
-          }
-          else if (hashCode == r5_8xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_8xlarge;
-            return true;
-          }
-          else if (hashCode == r5_12xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_12xlarge;
-            return true;
-          }
-          else if (hashCode == r5_16xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_16xlarge;
-            return true;
-          }
-          else if (hashCode == r5_24xlarge_HASH)
-          {
-            enumValue = InstanceType::r5_24xlarge;
-            return true;
-          }
-          else if (hashCode == r5_metal_HASH)
-          {
-            enumValue = InstanceType::r5_metal;
-            return true;
-          }
-          else if (hashCode == r5d_large_HASH)
-          {
-            enumValue = InstanceType::r5d_large;
-            return true;
-          }
-          else if (hashCode == r5d_xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_2xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_2xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_4xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_4xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_8xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_8xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_12xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_12xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_16xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_16xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_24xlarge_HASH)
-          {
-            enumValue = InstanceType::r5d_24xlarge;
-            return true;
-          }
-          else if (hashCode == r5d_metal_HASH)
-          {
-            enumValue = InstanceType::r5d_metal;
-            return true;
-          }
-          else if (hashCode == x1_16xlarge_HASH)
-          {
-            enumValue = InstanceType::x1_16xlarge;
-            return true;
-          }
-          else if (hashCode == x1_32xlarge_HASH)
-          {
-            enumValue = InstanceType::x1_32xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_2xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_2xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_4xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_4xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_8xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_8xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_16xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_16xlarge;
-            return true;
-          }
-          else if (hashCode == x1e_32xlarge_HASH)
-          {
-            enumValue = InstanceType::x1e_32xlarge;
-            return true;
-          }
-          else if (hashCode == i2_xlarge_HASH)
-          {
-            enumValue = InstanceType::i2_xlarge;
-            return true;
-          }
-          else if (hashCode == i2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::i2_2xlarge;
-            return true;
-          }
-          else if (hashCode == i2_4xlarge_HASH)
-          {
-            enumValue = InstanceType::i2_4xlarge;
-            return true;
-          }
-          else if (hashCode == i2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::i2_8xlarge;
-            return true;
-          }
-          else if (hashCode == i3_large_HASH)
-          {
-            enumValue = InstanceType::i3_large;
-            return true;
-          }
-          else if (hashCode == i3_xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_xlarge;
-            return true;
-          }
-          else if (hashCode == i3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_2xlarge;
-            return true;
-          }
-          else if (hashCode == i3_4xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_4xlarge;
-            return true;
-          }
-          else if (hashCode == i3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_8xlarge;
-            return true;
-          }
-          else if (hashCode == i3_16xlarge_HASH)
-          {
-            enumValue = InstanceType::i3_16xlarge;
-            return true;
-          }
-          else if (hashCode == i3_metal_HASH)
-          {
-            enumValue = InstanceType::i3_metal;
-            return true;
-          }
-          else if (hashCode == hi1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::hi1_4xlarge;
-            return true;
-          }
-          else if (hashCode == hs1_8xlarge_HASH)
-          {
-            enumValue = InstanceType::hs1_8xlarge;
-            return true;
-          }
-          else if (hashCode == c1_medium_HASH)
-          {
-            enumValue = InstanceType::c1_medium;
-            return true;
-          }
-          else if (hashCode == c1_xlarge_HASH)
-          {
-            enumValue = InstanceType::c1_xlarge;
-            return true;
-          }
-          else if (hashCode == c3_large_HASH)
-          {
-            enumValue = InstanceType::c3_large;
-            return true;
-          }
-          else if (hashCode == c3_xlarge_HASH)
-          {
-            enumValue = InstanceType::c3_xlarge;
-            return true;
-          }
-          else if (hashCode == c3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::c3_2xlarge;
-            return true;
-          }
-          else if (hashCode == c3_4xlarge_HASH)
-          {
-            enumValue = InstanceType::c3_4xlarge;
-            return true;
-          }
-          else if (hashCode == c3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::c3_8xlarge;
-            return true;
-          }
-          else if (hashCode == c4_large_HASH)
-          {
-            enumValue = InstanceType::c4_large;
-            return true;
-          }
-          else if (hashCode == c4_xlarge_HASH)
-          {
-            enumValue = InstanceType::c4_xlarge;
-            return true;
-          }
-          else if (hashCode == c4_2xlarge_HASH)
-          {
-            enumValue = InstanceType::c4_2xlarge;
-            return true;
-          }
-          else if (hashCode == c4_4xlarge_HASH)
-          {
-            enumValue = InstanceType::c4_4xlarge;
-            return true;
-          }
-          else if (hashCode == c4_8xlarge_HASH)
-          {
-            enumValue = InstanceType::c4_8xlarge;
-            return true;
-          }
-          else if (hashCode == c5_large_HASH)
-          {
-            enumValue = InstanceType::c5_large;
-            return true;
-          }
-          else if (hashCode == c5_xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_xlarge;
-            return true;
-          }
-          else if (hashCode == c5_2xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_2xlarge;
-            return true;
-          }
-          else if (hashCode == c5_4xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_4xlarge;
-            return true;
-          }
-          else if (hashCode == c5_9xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_9xlarge;
-            return true;
-          }
-          else if (hashCode == c5_18xlarge_HASH)
-          {
-            enumValue = InstanceType::c5_18xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_large_HASH)
-          {
-            enumValue = InstanceType::c5d_large;
-            return true;
-          }
-          else if (hashCode == c5d_xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_2xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_2xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_4xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_4xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_9xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_9xlarge;
-            return true;
-          }
-          else if (hashCode == c5d_18xlarge_HASH)
-          {
-            enumValue = InstanceType::c5d_18xlarge;
-            return true;
-          }
-          else if (hashCode == cc1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::cc1_4xlarge;
-            return true;
-          }
-          else if (hashCode == cc2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::cc2_8xlarge;
-            return true;
-          }
-          else if (hashCode == g2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::g2_2xlarge;
-            return true;
-          }
-          else if (hashCode == g2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::g2_8xlarge;
-            return true;
-          }
-          else if (hashCode == g3_4xlarge_HASH)
-          {
-            enumValue = InstanceType::g3_4xlarge;
-            return true;
-          }
-          else if (hashCode == g3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::g3_8xlarge;
-            return true;
-          }
-          else if (hashCode == g3_16xlarge_HASH)
-          {
-            enumValue = InstanceType::g3_16xlarge;
-            return true;
-          }
-          else if (hashCode == cg1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::cg1_4xlarge;
-            return true;
-          }
-          else if (hashCode == p2_xlarge_HASH)
-          {
-            enumValue = InstanceType::p2_xlarge;
-            return true;
-          }
-          else if (hashCode == p2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::p2_8xlarge;
-            return true;
-          }
-          else if (hashCode == p2_16xlarge_HASH)
-          {
-            enumValue = InstanceType::p2_16xlarge;
-            return true;
-          }
-          else if (hashCode == p3_2xlarge_HASH)
-          {
-            enumValue = InstanceType::p3_2xlarge;
-            return true;
-          }
-          else if (hashCode == p3_8xlarge_HASH)
-          {
-            enumValue = InstanceType::p3_8xlarge;
-            return true;
-          }
-          else if (hashCode == p3_16xlarge_HASH)
-          {
-            enumValue = InstanceType::p3_16xlarge;
-            return true;
-          }
-          else if (hashCode == d2_xlarge_HASH)
-          {
-            enumValue = InstanceType::d2_xlarge;
-            return true;
-          }
-          else if (hashCode == d2_2xlarge_HASH)
-          {
-            enumValue = InstanceType::d2_2xlarge;
-            return true;
-          }
-          else if (hashCode == d2_4xlarge_HASH)
-          {
-            enumValue = InstanceType::d2_4xlarge;
-            return true;
-          }
-          else if (hashCode == d2_8xlarge_HASH)
-          {
-            enumValue = InstanceType::d2_8xlarge;
-            return true;
-          }
-          else if (hashCode == f1_2xlarge_HASH)
-          {
-            enumValue = InstanceType::f1_2xlarge;
-            return true;
-          }
-          else if (hashCode == f1_16xlarge_HASH)
-          {
-            enumValue = InstanceType::f1_16xlarge;
-            return true;
-          }
-          else if (hashCode == m5_large_HASH)
-          {
-            enumValue = InstanceType::m5_large;
-            return true;
-          }
-          else if (hashCode == m5_xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_xlarge;
-            return true;
-          }
-          return false;
-        }
-        static bool GetEnumForNameHelper1(int hashCode, InstanceType& enumValue)
+
+        InstanceType GetInstanceTypeForName(const Aws::String& name)
         {
-          if (hashCode == m5_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_2xlarge;
-            return true;
-          }
-          else if (hashCode == m5_4xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_4xlarge;
-            return true;
-          }
-          else if (hashCode == m5_12xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_12xlarge;
-            return true;
-          }
-          else if (hashCode == m5_24xlarge_HASH)
-          {
-            enumValue = InstanceType::m5_24xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_large_HASH)
-          {
-            enumValue = InstanceType::m5d_large;
-            return true;
-          }
-          else if (hashCode == m5d_xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_2xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_2xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_4xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_4xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_12xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_12xlarge;
-            return true;
-          }
-          else if (hashCode == m5d_24xlarge_HASH)
-          {
-            enumValue = InstanceType::m5d_24xlarge;
-            return true;
-          }
-          else if (hashCode == h1_2xlarge_HASH)
-          {
-            enumValue = InstanceType::h1_2xlarge;
-            return true;
-          }
-          else if (hashCode == h1_4xlarge_HASH)
-          {
-            enumValue = InstanceType::h1_4xlarge;
-            return true;
-          }
-          else if (hashCode == h1_8xlarge_HASH)
-          {
-            enumValue = InstanceType::h1_8xlarge;
-            return true;
-          }
-          else if (hashCode == h1_16xlarge_HASH)
-          {
-            enumValue = InstanceType::h1_16xlarge;
-            return true;
-          }
-          else if (hashCode == z1d_large_HASH)
-          {
-            enumValue = InstanceType::z1d_large;
-            return true;
-          }
-          else if (hashCode == z1d_xlarge_HASH)
-          {
-            enumValue = InstanceType::z1d_xlarge;
-            return true;
-          }
-          else if (hashCode == z1d_2xlarge_HASH)
-          {
-            enumValue = InstanceType::z1d_2xlarge;
-            return true;
-          }
-          else if (hashCode == z1d_3xlarge_HASH)
-          {
-            enumValue = InstanceType::z1d_3xlarge;
-            return true;
-          }
-          else if (hashCode == z1d_6xlarge_HASH)
-          {
-            enumValue = InstanceType::z1d_6xlarge;
-            return true;
+          int hashCode = HashingUtils::HashString(name.c_str());
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
+          {
+          case t1_micro_HASH:
+            if (name == "t1.micro")
+            {
+              return InstanceType::t1_micro;
+            }
+            break;
+          case t2_nano_HASH:
+            if (name == "t2.nano")
+            {
+              return InstanceType::t2_nano;
+            }
+            break;
+          case t2_micro_HASH:
+            if (name == "t2.micro")
+            {
+              return InstanceType::t2_micro;
+            }
+            break;
+          case t2_small_HASH:
+            if (name == "t2.small")
+            {
+              return InstanceType::t2_small;
+            }
+            break;
+          case t2_medium_HASH:
+            if (name == "t2.medium")
+            {
+              return InstanceType::t2_medium;
+            }
+            break;
+          case t2_large_HASH:
+            if (name == "t2.large")
+            {
+              return InstanceType::t2_large;
+            }
+            break;
+          case t2_xlarge_HASH:
+            if (name == "t2.xlarge")
+            {
+              return InstanceType::t2_xlarge;
+            }
+            break;
+          case t2_2xlarge_HASH:
+            if (name == "t2.2xlarge")
+            {
+              return InstanceType::t2_2xlarge;
+            }
+            break;
+          case m1_small_HASH:
+            if (name == "m1.small")
+            {
+              return InstanceType::m1_small;
+            }
+            break;
+          case m1_medium_HASH:
+            if (name == "m1.medium")
+            {
+              return InstanceType::m1_medium;
+            }
+            break;
+          case m1_large_HASH:
+            if (name == "m1.large")
+            {
+              return InstanceType::m1_large;
+            }
+            break;
+          case m1_xlarge_HASH:
+            if (name == "m1.xlarge")
+            {
+              return InstanceType::m1_xlarge;
+            }
+            break;
+          case m3_medium_HASH:
+            if (name == "m3.medium")
+            {
+              return InstanceType::m3_medium;
+            }
+            break;
+          case m3_large_HASH:
+            if (name == "m3.large")
+            {
+              return InstanceType::m3_large;
+            }
+            break;
+          case m3_xlarge_HASH:
+            if (name == "m3.xlarge")
+            {
+              return InstanceType::m3_xlarge;
+            }
+            break;
+          case m3_2xlarge_HASH:
+            if (name == "m3.2xlarge")
+            {
+              return InstanceType::m3_2xlarge;
+            }
+            break;
+          case m4_large_HASH:
+            if (name == "m4.large")
+            {
+              return InstanceType::m4_large;
+            }
+            break;
+          case m4_xlarge_HASH:
+            if (name == "m4.xlarge")
+            {
+              return InstanceType::m4_xlarge;
+            }
+            break;
+          case m4_2xlarge_HASH:
+            if (name == "m4.2xlarge")
+            {
+              return InstanceType::m4_2xlarge;
+            }
+            break;
+          case m4_4xlarge_HASH:
+            if (name == "m4.4xlarge")
+            {
+              return InstanceType::m4_4xlarge;
+            }
+            break;
+          case m4_10xlarge_HASH:
+            if (name == "m4.10xlarge")
+            {
+              return InstanceType::m4_10xlarge;
+            }
+            break;
+          case m4_16xlarge_HASH:
+            if (name == "m4.16xlarge")
+            {
+              return InstanceType::m4_16xlarge;
+            }
+            break;
+          case m2_xlarge_HASH:
+            if (name == "m2.xlarge")
+            {
+              return InstanceType::m2_xlarge;
+            }
+            break;
+          case m2_2xlarge_HASH:
+            if (name == "m2.2xlarge")
+            {
+              return InstanceType::m2_2xlarge;
+            }
+            break;
+          case m2_4xlarge_HASH:
+            if (name == "m2.4xlarge")
+            {
+              return InstanceType::m2_4xlarge;
+            }
+            break;
+          case cr1_8xlarge_HASH:
+            if (name == "cr1.8xlarge")
+            {
+              return InstanceType::cr1_8xlarge;
+            }
+            break;
+          case r3_large_HASH:
+            if (name == "r3.large")
+            {
+              return InstanceType::r3_large;
+            }
+            break;
+          case r3_xlarge_HASH:
+            if (name == "r3.xlarge")
+            {
+              return InstanceType::r3_xlarge;
+            }
+            break;
+          case r3_2xlarge_HASH:
+            if (name == "r3.2xlarge")
+            {
+              return InstanceType::r3_2xlarge;
+            }
+            break;
+          case r3_4xlarge_HASH:
+            if (name == "r3.4xlarge")
+            {
+              return InstanceType::r3_4xlarge;
+            }
+            break;
+          case r3_8xlarge_HASH:
+            if (name == "r3.8xlarge")
+            {
+              return InstanceType::r3_8xlarge;
+            }
+            break;
+          case r4_large_HASH:
+            if (name == "r4.large")
+            {
+              return InstanceType::r4_large;
+            }
+            break;
+          case r4_xlarge_HASH:
+            if (name == "r4.xlarge")
+            {
+              return InstanceType::r4_xlarge;
+            }
+            break;
+          case r4_2xlarge_HASH:
+            if (name == "r4.2xlarge")
+            {
+              return InstanceType::r4_2xlarge;
+            }
+            break;
+          case r4_4xlarge_HASH:
+            if (name == "r4.4xlarge")
+            {
+              return InstanceType::r4_4xlarge;
+            }
+            break;
+          case r4_8xlarge_HASH:
+            if (name == "r4.8xlarge")
+            {
+              return InstanceType::r4_8xlarge;
+            }
+            break;
+          case r4_16xlarge_HASH:
+            if (name == "r4.16xlarge")
+            {
+              return InstanceType::r4_16xlarge;
+            }
+            break;
+          case r5_large_HASH:
+            if (name == "r5.large")
+            {
+              return InstanceType::r5_large;
+            }
+            break;
+          case r5_xlarge_HASH:
+            if (name == "r5.xlarge")
+            {
+              return InstanceType::r5_xlarge;
+            }
+            break;
+          case r5_2xlarge_HASH:
+            if (name == "r5.2xlarge")
+            {
+              return InstanceType::r5_2xlarge;
+            }
+            break;
+          case r5_4xlarge_HASH:
+            if (name == "r5.4xlarge")
+            {
+              return InstanceType::r5_4xlarge;
+            }
+            break;
+          case r5_8xlarge_HASH:
+            if (name == "r5.8xlarge")
+            {
+              return InstanceType::r5_8xlarge;
+            }
+            break;
+          case r5_12xlarge_HASH:
+            if (name == "r5.12xlarge")
+            {
+              return InstanceType::r5_12xlarge;
+            }
+            break;
+          case r5_16xlarge_HASH:
+            if (name == "r5.16xlarge")
+            {
+              return InstanceType::r5_16xlarge;
+            }
+            break;
+          case r5_24xlarge_HASH:
+            if (name == "r5.24xlarge")
+            {
+              return InstanceType::r5_24xlarge;
+            }
+            break;
+          case r5_metal_HASH:
+            if (name == "r5.metal")
+            {
+              return InstanceType::r5_metal;
+            }
+            break;
+          case r5d_large_HASH:
+            if (name == "r5d.large")
+            {
+              return InstanceType::r5d_large;
+            }
+            break;
+          case r5d_xlarge_HASH:
+            if (name == "r5d.xlarge")
+            {
+              return InstanceType::r5d_xlarge;
+            }
+            break;
+          case r5d_2xlarge_HASH:
+            if (name == "r5d.2xlarge")
+            {
+              return InstanceType::r5d_2xlarge;
+            }
+            break;
+          case r5d_4xlarge_HASH:
+            if (name == "r5d.4xlarge")
+            {
+              return InstanceType::r5d_4xlarge;
+            }
+            break;
+          case r5d_8xlarge_HASH:
+            if (name == "r5d.8xlarge")
+            {
+              return InstanceType::r5d_8xlarge;
+            }
+            break;
+          case r5d_12xlarge_HASH:
+            if (name == "r5d.12xlarge")
+            {
+              return InstanceType::r5d_12xlarge;
+            }
+            break;
+          case r5d_16xlarge_HASH:
+            if (name == "r5d.16xlarge")
+            {
+              return InstanceType::r5d_16xlarge;
+            }
+            break;
+          case r5d_24xlarge_HASH:
+            if (name == "r5d.24xlarge")
+            {
+              return InstanceType::r5d_24xlarge;
+            }
+            break;
+          case r5d_metal_HASH:
+            if (name == "r5d.metal")
+            {
+              return InstanceType::r5d_metal;
+            }
+            break;
+          case x1_16xlarge_HASH:
+            if (name == "x1.16xlarge")
+            {
+              return InstanceType::x1_16xlarge;
+            }
+            break;
+          case x1_32xlarge_HASH:
+            if (name == "x1.32xlarge")
+            {
+              return InstanceType::x1_32xlarge;
+            }
+            break;
+          case x1e_xlarge_HASH:
+            if (name == "x1e.xlarge")
+            {
+              return InstanceType::x1e_xlarge;
+            }
+            break;
+          case x1e_2xlarge_HASH:
+            if (name == "x1e.2xlarge")
+            {
+              return InstanceType::x1e_2xlarge;
+            }
+            break;
+          case x1e_4xlarge_HASH:
+            if (name == "x1e.4xlarge")
+            {
+              return InstanceType::x1e_4xlarge;
+            }
+            break;
+          case x1e_8xlarge_HASH:
+            if (name == "x1e.8xlarge")
+            {
+              return InstanceType::x1e_8xlarge;
+            }
+            break;
+          case x1e_16xlarge_HASH:
+            if (name == "x1e.16xlarge")
+            {
+              return InstanceType::x1e_16xlarge;
+            }
+            break;
+          case x1e_32xlarge_HASH:
+            if (name == "x1e.32xlarge")
+            {
+              return InstanceType::x1e_32xlarge;
+            }
+            break;
+          case i2_xlarge_HASH:
+            if (name == "i2.xlarge")
+            {
+              return InstanceType::i2_xlarge;
+            }
+            break;
+          case i2_2xlarge_HASH:
+            if (name == "i2.2xlarge")
+            {
+              return InstanceType::i2_2xlarge;
+            }
+            break;
+          case i2_4xlarge_HASH:
+            if (name == "i2.4xlarge")
+            {
+              return InstanceType::i2_4xlarge;
+            }
+            break;
+          case i2_8xlarge_HASH:
+            if (name == "i2.8xlarge")
+            {
+              return InstanceType::i2_8xlarge;
+            }
+            break;
+          case i3_large_HASH:
+            if (name == "i3.large")
+            {
+              return InstanceType::i3_large;
+            }
+            break;
+          case i3_xlarge_HASH:
+            if (name == "i3.xlarge")
+            {
+              return InstanceType::i3_xlarge;
+            }
+            break;
+          case i3_2xlarge_HASH:
+            if (name == "i3.2xlarge")
+            {
+              return InstanceType::i3_2xlarge;
+            }
+            break;
+          case i3_4xlarge_HASH:
+            if (name == "i3.4xlarge")
+            {
+              return InstanceType::i3_4xlarge;
+            }
+            break;
+          case i3_8xlarge_HASH:
+            if (name == "i3.8xlarge")
+            {
+              return InstanceType::i3_8xlarge;
+            }
+            break;
+          case i3_16xlarge_HASH:
+            if (name == "i3.16xlarge")
+            {
+              return InstanceType::i3_16xlarge;
+            }
+            break;
+          case i3_metal_HASH:
+            if (name == "i3.metal")
+            {
+              return InstanceType::i3_metal;
+            }
+            break;
+          case hi1_4xlarge_HASH:
+            if (name == "hi1.4xlarge")
+            {
+              return InstanceType::hi1_4xlarge;
+            }
+            break;
+          case hs1_8xlarge_HASH:
+            if (name == "hs1.8xlarge")
+            {
+              return InstanceType::hs1_8xlarge;
+            }
+            break;
+          case c1_medium_HASH:
+            if (name == "c1.medium")
+            {
+              return InstanceType::c1_medium;
+            }
+            break;
+          case c1_xlarge_HASH:
+            if (name == "c1.xlarge")
+            {
+              return InstanceType::c1_xlarge;
+            }
+            break;
+          case c3_large_HASH:
+            if (name == "c3.large")
+            {
+              return InstanceType::c3_large;
+            }
+            break;
+          case c3_xlarge_HASH:
+            if (name == "c3.xlarge")
+            {
+              return InstanceType::c3_xlarge;
+            }
+            break;
+          case c3_2xlarge_HASH:
+            if (name == "c3.2xlarge")
+            {
+              return InstanceType::c3_2xlarge;
+            }
+            break;
+          case c3_4xlarge_HASH:
+            if (name == "c3.4xlarge")
+            {
+              return InstanceType::c3_4xlarge;
+            }
+            break;
+          case c3_8xlarge_HASH:
+            if (name == "c3.8xlarge")
+            {
+              return InstanceType::c3_8xlarge;
+            }
+            break;
+          case c4_large_HASH:
+            if (name == "c4.large")
+            {
+              return InstanceType::c4_large;
+            }
+            break;
+          case c4_xlarge_HASH:
+            if (name == "c4.xlarge")
+            {
+              return InstanceType::c4_xlarge;
+            }
+            break;
+          case c4_2xlarge_HASH:
+            if (name == "c4.2xlarge")
+            {
+              return InstanceType::c4_2xlarge;
+            }
+            break;
+          case c4_4xlarge_HASH:
+            if (name == "c4.4xlarge")
+            {
+              return InstanceType::c4_4xlarge;
+            }
+            break;
+          case c4_8xlarge_HASH:
+            if (name == "c4.8xlarge")
+            {
+              return InstanceType::c4_8xlarge;
+            }
+            break;
+          case c5_large_HASH:
+            if (name == "c5.large")
+            {
+              return InstanceType::c5_large;
+            }
+            break;
+          case c5_xlarge_HASH:
+            if (name == "c5.xlarge")
+            {
+              return InstanceType::c5_xlarge;
+            }
+            break;
+          case c5_2xlarge_HASH:
+            if (name == "c5.2xlarge")
+            {
+              return InstanceType::c5_2xlarge;
+            }
+            break;
+          case c5_4xlarge_HASH:
+            if (name == "c5.4xlarge")
+            {
+              return InstanceType::c5_4xlarge;
+            }
+            break;
+          case c5_9xlarge_HASH:
+            if (name == "c5.9xlarge")
+            {
+              return InstanceType::c5_9xlarge;
+            }
+            break;
+          case c5_18xlarge_HASH:
+            if (name == "c5.18xlarge")
+            {
+              return InstanceType::c5_18xlarge;
+            }
+            break;
+          case c5d_large_HASH:
+            if (name == "c5d.large")
+            {
+              return InstanceType::c5d_large;
+            }
+            break;
+          case c5d_xlarge_HASH:
+            if (name == "c5d.xlarge")
+            {
+              return InstanceType::c5d_xlarge;
+            }
+            break;
+          case c5d_2xlarge_HASH:
+            if (name == "c5d.2xlarge")
+            {
+              return InstanceType::c5d_2xlarge;
+            }
+            break;
+          case c5d_4xlarge_HASH:
+            if (name == "c5d.4xlarge")
+            {
+              return InstanceType::c5d_4xlarge;
+            }
+            break;
+          case c5d_9xlarge_HASH:
+            if (name == "c5d.9xlarge")
+            {
+              return InstanceType::c5d_9xlarge;
+            }
+            break;
+          case c5d_18xlarge_HASH:
+            if (name == "c5d.18xlarge")
+            {
+              return InstanceType::c5d_18xlarge;
+            }
+            break;
+          case cc1_4xlarge_HASH:
+            if (name == "cc1.4xlarge")
+            {
+              return InstanceType::cc1_4xlarge;
+            }
+            break;
+          case cc2_8xlarge_HASH:
+            if (name == "cc2.8xlarge")
+            {
+              return InstanceType::cc2_8xlarge;
+            }
+            break;
+          case g2_2xlarge_HASH:
+            if (name == "g2.2xlarge")
+            {
+              return InstanceType::g2_2xlarge;
+            }
+            break;
+          case g2_8xlarge_HASH:
+            if (name == "g2.8xlarge")
+            {
+              return InstanceType::g2_8xlarge;
+            }
+            break;
+          case g3_4xlarge_HASH:
+            if (name == "g3.4xlarge")
+            {
+              return InstanceType::g3_4xlarge;
+            }
+            break;
+          case g3_8xlarge_HASH:
+            if (name == "g3.8xlarge")
+            {
+              return InstanceType::g3_8xlarge;
+            }
+            break;
+          case g3_16xlarge_HASH:
+            if (name == "g3.16xlarge")
+            {
+              return InstanceType::g3_16xlarge;
+            }
+            break;
+          case cg1_4xlarge_HASH:
+            if (name == "cg1.4xlarge")
+            {
+              return InstanceType::cg1_4xlarge;
+            }
+            break;
+          case p2_xlarge_HASH:
+            if (name == "p2.xlarge")
+            {
+              return InstanceType::p2_xlarge;
+            }
+            break;
+          case p2_8xlarge_HASH:
+            if (name == "p2.8xlarge")
+            {
+              return InstanceType::p2_8xlarge;
+            }
+            break;
+          case p2_16xlarge_HASH:
+            if (name == "p2.16xlarge")
+            {
+              return InstanceType::p2_16xlarge;
+            }
+            break;
+          case p3_2xlarge_HASH:
+            if (name == "p3.2xlarge")
+            {
+              return InstanceType::p3_2xlarge;
+            }
+            break;
+          case p3_8xlarge_HASH:
+            if (name == "p3.8xlarge")
+            {
+              return InstanceType::p3_8xlarge;
+            }
+            break;
+          case p3_16xlarge_HASH:
+            if (name == "p3.16xlarge")
+            {
+              return InstanceType::p3_16xlarge;
+            }
+            break;
+          case d2_xlarge_HASH:
+            if (name == "d2.xlarge")
+            {
+              return InstanceType::d2_xlarge;
+            }
+            break;
+          case d2_2xlarge_HASH:
+            if (name == "d2.2xlarge")
+            {
+              return InstanceType::d2_2xlarge;
+            }
+            break;
+          case d2_4xlarge_HASH:
+            if (name == "d2.4xlarge")
+            {
+              return InstanceType::d2_4xlarge;
+            }
+            break;
+          case d2_8xlarge_HASH:
+            if (name == "d2.8xlarge")
+            {
+              return InstanceType::d2_8xlarge;
+            }
+            break;
+          case f1_2xlarge_HASH:
+            if (name == "f1.2xlarge")
+            {
+              return InstanceType::f1_2xlarge;
+            }
+            break;
+          case f1_16xlarge_HASH:
+            if (name == "f1.16xlarge")
+            {
+              return InstanceType::f1_16xlarge;
+            }
+            break;
+          case m5_large_HASH:
+            if (name == "m5.large")
+            {
+              return InstanceType::m5_large;
+            }
+            break;
+          case m5_xlarge_HASH:
+            if (name == "m5.xlarge")
+            {
+              return InstanceType::m5_xlarge;
+            }
+            break;
+          case m5_2xlarge_HASH:
+            if (name == "m5.2xlarge")
+            {
+              return InstanceType::m5_2xlarge;
+            }
+            break;
+          case m5_4xlarge_HASH:
+            if (name == "m5.4xlarge")
+            {
+              return InstanceType::m5_4xlarge;
+            }
+            break;
+          case m5_12xlarge_HASH:
+            if (name == "m5.12xlarge")
+            {
+              return InstanceType::m5_12xlarge;
+            }
+            break;
+          case m5_24xlarge_HASH:
+            if (name == "m5.24xlarge")
+            {
+              return InstanceType::m5_24xlarge;
+            }
+            break;
+          case m5d_large_HASH:
+            if (name == "m5d.large")
+            {
+              return InstanceType::m5d_large;
+            }
+            break;
+          case m5d_xlarge_HASH:
+            if (name == "m5d.xlarge")
+            {
+              return InstanceType::m5d_xlarge;
+            }
+            break;
+          case m5d_2xlarge_HASH:
+            if (name == "m5d.2xlarge")
+            {
+              return InstanceType::m5d_2xlarge;
+            }
+            break;
+          case m5d_4xlarge_HASH:
+            if (name == "m5d.4xlarge")
+            {
+              return InstanceType::m5d_4xlarge;
+            }
+            break;
+          case m5d_12xlarge_HASH:
+            if (name == "m5d.12xlarge")
+            {
+              return InstanceType::m5d_12xlarge;
+            }
+            break;
+          case m5d_24xlarge_HASH:
+            if (name == "m5d.24xlarge")
+            {
+              return InstanceType::m5d_24xlarge;
+            }
+            break;
+          case h1_2xlarge_HASH:
+            if (name == "h1.2xlarge")
+            {
+              return InstanceType::h1_2xlarge;
+            }
+            break;
+          case h1_4xlarge_HASH:
+            if (name == "h1.4xlarge")
+            {
+              return InstanceType::h1_4xlarge;
+            }
+            break;
+          case h1_8xlarge_HASH:
+            if (name == "h1.8xlarge")
+            {
+              return InstanceType::h1_8xlarge;
+            }
+            break;
+          case h1_16xlarge_HASH:
+            if (name == "h1.16xlarge")
+            {
+              return InstanceType::h1_16xlarge;
+            }
+            break;
+          case z1d_large_HASH:
+            if (name == "z1d.large")
+            {
+              return InstanceType::z1d_large;
+            }
+            break;
+          case z1d_xlarge_HASH:
+            if (name == "z1d.xlarge")
+            {
+              return InstanceType::z1d_xlarge;
+            }
+            break;
+          case z1d_2xlarge_HASH:
+            if (name == "z1d.2xlarge")
+            {
+              return InstanceType::z1d_2xlarge;
+            }
+            break;
+          case z1d_3xlarge_HASH:
+            if (name == "z1d.3xlarge")
+            {
+              return InstanceType::z1d_3xlarge;
+            }
+            break;
+          case z1d_6xlarge_HASH:
+            if (name == "z1d.6xlarge")
+            {
+              return InstanceType::z1d_6xlarge;
+            }
+            break;
+          case z1d_12xlarge_HASH:
+            if (name == "z1d.12xlarge")
+            {
+              return InstanceType::z1d_12xlarge;
+            }
+            break;
+          default:
+            break;
           }
-          else if (hashCode == z1d_12xlarge_HASH)
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
           {
-            enumValue = InstanceType::z1d_12xlarge;
-            return true;
+            overflowContainer->StoreOverflow(hashCode, name);
+            return static_cast<InstanceType>(hashCode);
           }
-          return false;
+
+          return InstanceType::NOT_SET;
         }
 
-        static bool GetNameForEnumHelper0(InstanceType enumValue, Aws::String& value)
+        const char* GetNameForInstanceType(InstanceType enumValue)
         {
           switch(enumValue)
           {
           case InstanceType::t1_micro:
-            value = "t1.micro";
-            return true;
+            return "t1.micro";
           case InstanceType::t2_nano:
-            value = "t2.nano";
-            return true;
+            return "t2.nano";
           case InstanceType::t2_micro:
-            value = "t2.micro";
-            return true;
+            return "t2.micro";
           case InstanceType::t2_small:
-            value = "t2.small";
-            return true;
+            return "t2.small";
           case InstanceType::t2_medium:
-            value = "t2.medium";
-            return true;
+            return "t2.medium";
           case InstanceType::t2_large:
-            value = "t2.large";
-            return true;
+            return "t2.large";
           case InstanceType::t2_xlarge:
-            value = "t2.xlarge";
-            return true;
+            return "t2.xlarge";
           case InstanceType::t2_2xlarge:
-            value = "t2.2xlarge";
-            return true;
+            return "t2.2xlarge";
           case InstanceType::m1_small:
-            value = "m1.small";
-            return true;
+            return "m1.small";
           case InstanceType::m1_medium:
-            value = "m1.medium";
-            return true;
+            return "m1.medium";
           case InstanceType::m1_large:
-            value = "m1.large";
-            return true;
+            return "m1.large";
           case InstanceType::m1_xlarge:
-            value = "m1.xlarge";
-            return true;
+            return "m1.xlarge";
           case InstanceType::m3_medium:
-            value = "m3.medium";
-            return true;
+            return "m3.medium";
           case InstanceType::m3_large:
-            value = "m3.large";
-            return true;
+            return "m3.large";
           case InstanceType::m3_xlarge:
-            value = "m3.xlarge";
-            return true;
+            return "m3.xlarge";
           case InstanceType::m3_2xlarge:
-            value = "m3.2xlarge";
-            return true;
+            return "m3.2xlarge";
           case InstanceType::m4_large:
-            value = "m4.large";
-            return true;
+            return "m4.large";
           case InstanceType::m4_xlarge:
-            value = "m4.xlarge";
-            return true;
+            return "m4.xlarge";
           case InstanceType::m4_2xlarge:
-            value = "m4.2xlarge";
-            return true;
+            return "m4.2xlarge";
           case InstanceType::m4_4xlarge:
-            value = "m4.4xlarge";
-            return true;
+            return "m4.4xlarge";
           case InstanceType::m4_10xlarge:
-            value = "m4.10xlarge";
-            return true;
+            return "m4.10xlarge";
           case InstanceType::m4_16xlarge:
-            value = "m4.16xlarge";
-            return true;
+            return "m4.16xlarge";
           case InstanceType::m2_xlarge:
-            value = "m2.xlarge";
-            return true;
+            return "m2.xlarge";
           case InstanceType::m2_2xlarge:
-            value = "m2.2xlarge";
-            return true;
+            return "m2.2xlarge";
           case InstanceType::m2_4xlarge:
-            value = "m2.4xlarge";
-            return true;
+            return "m2.4xlarge";
           case InstanceType::cr1_8xlarge:
-            value = "cr1.8xlarge";
-            return true;
+            return "cr1.8xlarge";
           case InstanceType::r3_large:
-            value = "r3.large";
-            return true;
+            return "r3.large";
           case InstanceType::r3_xlarge:
-            value = "r3.xlarge";
-            return true;
+            return "r3.xlarge";
           case InstanceType::r3_2xlarge:
-            value = "r3.2xlarge";
-            return true;
+            return "r3.2xlarge";
           case InstanceType::r3_4xlarge:
-            value = "r3.4xlarge";
-            return true;
+            return "r3.4xlarge";
           case InstanceType::r3_8xlarge:
-            value = "r3.8xlarge";
-            return true;
+            return "r3.8xlarge";
           case InstanceType::r4_large:
-            value = "r4.large";
-            return true;
+            return "r4.large";
           case InstanceType::r4_xlarge:
-            value = "r4.xlarge";
-            return true;
+            return "r4.xlarge";
           case InstanceType::r4_2xlarge:
-            value = "r4.2xlarge";
-            return true;
+            return "r4.2xlarge";
           case InstanceType::r4_4xlarge:
-            value = "r4.4xlarge";
-            return true;
+            return "r4.4xlarge";
           case InstanceType::r4_8xlarge:
-            value = "r4.8xlarge";
-            return true;
+            return "r4.8xlarge";
           case InstanceType::r4_16xlarge:
-            value = "r4.16xlarge";
-            return true;
+            return "r4.16xlarge";
           case InstanceType::r5_large:
-            value = "r5.large";
-            return true;
+            return "r5.large";
           case InstanceType::r5_xlarge:
-            value = "r5.xlarge";
-            return true;
+            return "r5.xlarge";
           case InstanceType::r5_2xlarge:
-            value = "r5.2xlarge";
-            return true;
+            return "r5.2xlarge";
           case InstanceType::r5_4xlarge:
-            value = "r5.4xlarge";
-            return true;
+            return "r5.4xlarge";
           case InstanceType::r5_8xlarge:
-            value = "r5.8xlarge";
-            return true;
+            return "r5.8xlarge";
           case InstanceType::r5_12xlarge:
-            value = "r5.12xlarge";
-            return true;
+            return "r5.12xlarge";
           case InstanceType::r5_16xlarge:
-            value = "r5.16xlarge";
-            return true;
+            return "r5.16xlarge";
           case InstanceType::r5_24xlarge:
-            value = "r5.24xlarge";
-            return true;
+            return "r5.24xlarge";
           case InstanceType::r5_metal:
-            value = "r5.metal";
-            return true;
+            return "r5.metal";
           case InstanceType::r5d_large:
-            value = "r5d.large";
-            return true;
+            return "r5d.large";
           case InstanceType::r5d_xlarge:
-            value = "r5d.xlarge";
-            return true;
+            return "r5d.xlarge";
           case InstanceType::r5d_2xlarge:
-            value = "r5d.2xlarge";
-            return true;
+            return "r5d.2xlarge";
           case InstanceType::r5d_4xlarge:
-            value = "r5d.4xlarge";
-            return true;
+            return "r5d.4xlarge";
           case InstanceType::r5d_8xlarge:
-            value = "r5d.8xlarge";
-            return true;
+            return "r5d.8xlarge";
           case InstanceType::r5d_12xlarge:
-            value = "r5d.12xlarge";
-            return true;
+            return "r5d.12xlarge";
           case InstanceType::r5d_16xlarge:
-            value = "r5d.16xlarge";
-            return true;
+            return "r5d.16xlarge";
           case InstanceType::r5d_24xlarge:
-            value = "r5d.24xlarge";
-            return true;
+            return "r5d.24xlarge";
           case InstanceType::r5d_metal:
-            value = "r5d.metal";
-            return true;
+            return "r5d.metal";
           case InstanceType::x1_16xlarge:
-            value = "x1.16xlarge";
-            return true;
+            return "x1.16xlarge";
           case InstanceType::x1_32xlarge:
-            value = "x1.32xlarge";
-            return true;
+            return "x1.32xlarge";
           case InstanceType::x1e_xlarge:
-            value = "x1e.xlarge";
-            return true;
+            return "x1e.xlarge";
           case InstanceType::x1e_2xlarge:
-            value = "x1e.2xlarge";
-            return true;
+            return "x1e.2xlarge";
           case InstanceType::x1e_4xlarge:
-            value = "x1e.4xlarge";
-            return true;
+            return "x1e.4xlarge";
           case InstanceType::x1e_8xlarge:
-            value = "x1e.8xlarge";
-            return true;
+            return "x1e.8xlarge";
           case InstanceType::x1e_16xlarge:
-            value = "x1e.16xlarge";
-            return true;
+            return "x1e.16xlarge";
           case InstanceType::x1e_32xlarge:
-            value = "x1e.32xlarge";
-            return true;
+            return "x1e.32xlarge";
           case InstanceType::i2_xlarge:
-            value = "i2.xlarge";
-            return true;
+            return "i2.xlarge";
           case InstanceType::i2_2xlarge:
-            value = "i2.2xlarge";
-            return true;
+            return "i2.2xlarge";
           case InstanceType::i2_4xlarge:
-            value = "i2.4xlarge";
-            return true;
+            return "i2.4xlarge";
           case InstanceType::i2_8xlarge:
-            value = "i2.8xlarge";
-            return true;
+            return "i2.8xlarge";
           case InstanceType::i3_large:
-            value = "i3.large";
-            return true;
+            return "i3.large";
           case InstanceType::i3_xlarge:
-            value = "i3.xlarge";
-            return true;
+            return "i3.xlarge";
           case InstanceType::i3_2xlarge:
-            value = "i3.2xlarge";
-            return true;
+            return "i3.2xlarge";
           case InstanceType::i3_4xlarge:
-            value = "i3.4xlarge";
-            return true;
+            return "i3.4xlarge";
           case InstanceType::i3_8xlarge:
-            value = "i3.8xlarge";
-            return true;
+            return "i3.8xlarge";
           case InstanceType::i3_16xlarge:
-            value = "i3.16xlarge";
-            return true;
+            return "i3.16xlarge";
           case InstanceType::i3_metal:
-            value = "i3.metal";
-            return true;
+            return "i3.metal";
           case InstanceType::hi1_4xlarge:
-            value = "hi1.4xlarge";
-            return true;
+            return "hi1.4xlarge";
           case InstanceType::hs1_8xlarge:
-            value = "hs1.8xlarge";
-            return true;
+            return "hs1.8xlarge";
           case InstanceType::c1_medium:
-            value = "c1.medium";
-            return true;
+            return "c1.medium";
           case InstanceType::c1_xlarge:
-            value = "c1.xlarge";
-            return true;
+            return "c1.xlarge";
           case InstanceType::c3_large:
-            value = "c3.large";
-            return true;
+            return "c3.large";
           case InstanceType::c3_xlarge:
-            value = "c3.xlarge";
-            return true;
+            return "c3.xlarge";
           case InstanceType::c3_2xlarge:
-            value = "c3.2xlarge";
-            return true;
+            return "c3.2xlarge";
           case InstanceType::c3_4xlarge:
-            value = "c3.4xlarge";
-            return true;
+            return "c3.4xlarge";
           case InstanceType::c3_8xlarge:
-            value = "c3.8xlarge";
-            return true;
+            return "c3.8xlarge";
           case InstanceType::c4_large:
-            value = "c4.large";
-            return true;
+            return "c4.large";
           case InstanceType::c4_xlarge:
-            value = "c4.xlarge";
-            return true;
+            return "c4.xlarge";
           case InstanceType::c4_2xlarge:
-            value = "c4.2xlarge";
-            return true;
+            return "c4.2xlarge";
           case InstanceType::c4_4xlarge:
-            value = "c4.4xlarge";
-            return true;
+            return "c4.4xlarge";
           case InstanceType::c4_8xlarge:
-            value = "c4.8xlarge";
-            return true;
+            return "c4.8xlarge";
           case InstanceType::c5_large:
-            value = "c5.large";
-            return true;
+            return "c5.large";
           case InstanceType::c5_xlarge:
-            value = "c5.xlarge";
-            return true;
+            return "c5.xlarge";
           case InstanceType::c5_2xlarge:
-            value = "c5.2xlarge";
-            return true;
+            return "c5.2xlarge";
           case InstanceType::c5_4xlarge:
-            value = "c5.4xlarge";
-            return true;
+            return "c5.4xlarge";
           case InstanceType::c5_9xlarge:
-            value = "c5.9xlarge";
-            return true;
+            return "c5.9xlarge";
           case InstanceType::c5_18xlarge:
-            value = "c5.18xlarge";
-            return true;
+            return "c5.18xlarge";
           case InstanceType::c5d_large:
-            value = "c5d.large";
-            return true;
+            return "c5d.large";
           case InstanceType::c5d_xlarge:
-            value = "c5d.xlarge";
-            return true;
+            return "c5d.xlarge";
           case InstanceType::c5d_2xlarge:
-            value = "c5d.2xlarge";
-            return true;
+            return "c5d.2xlarge";
           case InstanceType::c5d_4xlarge:
-            value = "c5d.4xlarge";
-            return true;
+            return "c5d.4xlarge";
           case InstanceType::c5d_9xlarge:
-            value = "c5d.9xlarge";
-            return true;
+            return "c5d.9xlarge";
           case InstanceType::c5d_18xlarge:
-            value = "c5d.18xlarge";
-            return true;
+            return "c5d.18xlarge";
           case InstanceType::cc1_4xlarge:
-            value = "cc1.4xlarge";
-            return true;
+            return "cc1.4xlarge";
           case InstanceType::cc2_8xlarge:
-            value = "cc2.8xlarge";
-            return true;
+            return "cc2.8xlarge";
           case InstanceType::g2_2xlarge:
-            value = "g2.2xlarge";
-            return true;
+            return "g2.2xlarge";
           case InstanceType::g2_8xlarge:
-            value = "g2.8xlarge";
-            return true;
+            return "g2.8xlarge";
           case InstanceType::g3_4xlarge:
-            value = "g3.4xlarge";
-            return true;
+            return "g3.4xlarge";
           case InstanceType::g3_8xlarge:
-            value = "g3.8xlarge";
-            return true;
+            return "g3.8xlarge";
           case InstanceType::g3_16xlarge:
-            value = "g3.16xlarge";
-            return true;
+            return "g3.16xlarge";
           case InstanceType::cg1_4xlarge:
-            value = "cg1.4xlarge";
-            return true;
+            return "cg1.4xlarge";
           case InstanceType::p2_xlarge:
-            value = "p2.xlarge";
-            return true;
+            return "p2.xlarge";
           case InstanceType::p2_8xlarge:
-            value = "p2.8xlarge";
-            return true;
+            return "p2.8xlarge";
           case InstanceType::p2_16xlarge:
-            value = "p2.16xlarge";
-            return true;
+            return "p2.16xlarge";
           case InstanceType::p3_2xlarge:
-            value = "p3.2xlarge";
-            return true;
+            return "p3.2xlarge";
           case InstanceType::p3_8xlarge:
-            value = "p3.8xlarge";
-            return true;
+            return "p3.8xlarge";
           case InstanceType::p3_16xlarge:
-            value = "p3.16xlarge";
-            return true;
+            return "p3.16xlarge";
           case InstanceType::d2_xlarge:
-            value = "d2.xlarge";
-            return true;
+            return "d2.xlarge";
           case InstanceType::d2_2xlarge:
-            value = "d2.2xlarge";
-            return true;
+            return "d2.2xlarge";
           case InstanceType::d2_4xlarge:
-            value = "d2.4xlarge";
-            return true;
+            return "d2.4xlarge";
           case InstanceType::d2_8xlarge:
-            value = "d2.8xlarge";
-            return true;
+            return "d2.8xlarge";
           case InstanceType::f1_2xlarge:
-            value = "f1.2xlarge";
-            return true;
+            return "f1.2xlarge";
           case InstanceType::f1_16xlarge:
-            value = "f1.16xlarge";
-            return true;
+            return "f1.16xlarge";
           case InstanceType::m5_large:
-            value = "m5.large";
-            return true;
+            return "m5.large";
           case InstanceType::m5_xlarge:
-            value = "m5.xlarge";
-            return true;
-          default:
-            return false;
-          }
-        }
-        static bool GetNameForEnumHelper1(InstanceType enumValue, Aws::String& value)
-        {
-          switch(enumValue)
-          {
+            return "m5.xlarge";
           case InstanceType::m5_2xlarge:
-            value = "m5.2xlarge";
-            return true;
+            return "m5.2xlarge";
           case InstanceType::m5_4xlarge:
-            value = "m5.4xlarge";
-            return true;
+            return "m5.4xlarge";
           case InstanceType::m5_12xlarge:
-            value = "m5.12xlarge";
-            return true;
+            return "m5.12xlarge";
           case InstanceType::m5_24xlarge:
-            value = "m5.24xlarge";
-            return true;
+            return "m5.24xlarge";
           case InstanceType::m5d_large:
-            value = "m5d.large";
-            return true;
+            return "m5d.large";
           case InstanceType::m5d_xlarge:
-            value = "m5d.xlarge";
-            return true;
+            return "m5d.xlarge";
           case InstanceType::m5d_2xlarge:
-            value = "m5d.2xlarge";
-            return true;
+            return "m5d.2xlarge";
           case InstanceType::m5d_4xlarge:
-            value = "m5d.4xlarge";
-            return true;
+            return "m5d.4xlarge";
           case InstanceType::m5d_12xlarge:
-            value = "m5d.12xlarge";
-            return true;
+            return "m5d.12xlarge";
           case InstanceType::m5d_24xlarge:
-            value = "m5d.24xlarge";
-            return true;
+            return "m5d.24xlarge";
           case InstanceType::h1_2xlarge:
-            value = "h1.2xlarge";
-            return true;
+            return "h1.2xlarge";
           case InstanceType::h1_4xlarge:
-            value = "h1.4xlarge";
-            return true;
+            return "h1.4xlarge";
           case InstanceType::h1_8xlarge:
-            value = "h1.8xlarge";
-            return true;
+            return "h1.8xlarge";
           case InstanceType::h1_16xlarge:
-            value = "h1.16xlarge";
-            return true;
+            return "h1.16xlarge";
           case InstanceType::z1d_large:
-            value = "z1d.large";
-            return true;
+            return "z1d.large";
           case InstanceType::z1d_xlarge:
-            value = "z1d.xlarge";
-            return true;
+            return "z1d.xlarge";
           case InstanceType::z1d_2xlarge:
-            value = "z1d.2xlarge";
-            return true;
+            return "z1d.2xlarge";
           case InstanceType::z1d_3xlarge:
-            value = "z1d.3xlarge";
-            return true;
+            return "z1d.3xlarge";
           case InstanceType::z1d_6xlarge:
-            value = "z1d.6xlarge";
-            return true;
+            return "z1d.6xlarge";
           case InstanceType::z1d_12xlarge:
-            value = "z1d.12xlarge";
-            return true;
+            return "z1d.12xlarge";
           default:
-            return false;
-          }
-        }
-
-        InstanceType GetInstanceTypeForName(const Aws::String& name)
-        {
-          int hashCode = HashingUtils::HashString(name.c_str());
-          InstanceType enumValue;
-          if (GetEnumForNameHelper0(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          else if (GetEnumForNameHelper1(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            overflowContainer->StoreOverflow(hashCode, name);
-            return static_cast<InstanceType>(hashCode);
-          }
-
-          return InstanceType::NOT_SET;
-        }
+            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+            if(overflowContainer)
+            {
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
+            }
 
-        Aws::String GetNameForInstanceType(InstanceType enumValue)
-        {
-          Aws::String value;
-          if (GetNameForEnumHelper0(enumValue, value))
-          {
-            return value;
-          }
-          else if (GetNameForEnumHelper1(enumValue, value))
-          {
-            return value;
+            return "";
           }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-          }
-
-          return "";
         }
 
       } // namespace InstanceTypeMapper
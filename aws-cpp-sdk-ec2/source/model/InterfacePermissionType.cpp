@@ -30,20 +30,30 @@ namespace Aws
       namespace InterfacePermissionTypeMapper
       {
 
-        static const int INSTANCE_ATTACH_HASH = HashingUtils::HashString("INSTANCE-ATTACH");
-        static const int EIP_ASSOCIATE_HASH = HashingUtils::HashString("EIP-ASSOCIATE");
+        static constexpr int INSTANCE_ATTACH_HASH = HashingUtils::CompileTimeHashString("INSTANCE-ATTACH");
+        static constexpr int EIP_ASSOCIATE_HASH = HashingUtils::CompileTimeHashString("EIP-ASSOCIATE");
 
 
         InterfacePermissionType GetInterfacePermissionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTANCE_ATTACH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InterfacePermissionType::INSTANCE_ATTACH;
-          }
-          else if (hashCode == EIP_ASSOCIATE_HASH)
-          {
-            return InterfacePermissionType::EIP_ASSOCIATE;
+          case INSTANCE_ATTACH_HASH:
+            if (name == "INSTANCE-ATTACH")
+            {
+              return InterfacePermissionType::INSTANCE_ATTACH;
+            }
+            break;
+          case EIP_ASSOCIATE_HASH:
+            if (name == "EIP-ASSOCIATE")
+            {
+              return InterfacePermissionType::EIP_ASSOCIATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InterfacePermissionType::NOT_SET;
         }
 
-        Aws::String GetNameForInterfacePermissionType(InterfacePermissionType enumValue)
+        const char* GetNameForInterfacePermissionType(InterfacePermissionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
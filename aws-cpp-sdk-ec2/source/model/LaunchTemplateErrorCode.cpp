@@ -30,40 +30,58 @@ namespace Aws
       namespace LaunchTemplateErrorCodeMapper
       {
 
-        static const int launchTemplateIdDoesNotExist_HASH = HashingUtils::HashString("launchTemplateIdDoesNotExist");
-        static const int launchTemplateIdMalformed_HASH = HashingUtils::HashString("launchTemplateIdMalformed");
-        static const int launchTemplateNameDoesNotExist_HASH = HashingUtils::HashString("launchTemplateNameDoesNotExist");
-        static const int launchTemplateNameMalformed_HASH = HashingUtils::HashString("launchTemplateNameMalformed");
-        static const int launchTemplateVersionDoesNotExist_HASH = HashingUtils::HashString("launchTemplateVersionDoesNotExist");
-        static const int unexpectedError_HASH = HashingUtils::HashString("unexpectedError");
+        static constexpr int launchTemplateIdDoesNotExist_HASH = HashingUtils::CompileTimeHashString("launchTemplateIdDoesNotExist");
+        static constexpr int launchTemplateIdMalformed_HASH = HashingUtils::CompileTimeHashString("launchTemplateIdMalformed");
+        static constexpr int launchTemplateNameDoesNotExist_HASH = HashingUtils::CompileTimeHashString("launchTemplateNameDoesNotExist");
+        static constexpr int launchTemplateNameMalformed_HASH = HashingUtils::CompileTimeHashString("launchTemplateNameMalformed");
+        static constexpr int launchTemplateVersionDoesNotExist_HASH = HashingUtils::CompileTimeHashString("launchTemplateVersionDoesNotExist");
+        static constexpr int unexpectedError_HASH = HashingUtils::CompileTimeHashString("unexpectedError");
 
 
         LaunchTemplateErrorCode GetLaunchTemplateErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == launchTemplateIdDoesNotExist_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LaunchTemplateErrorCode::launchTemplateIdDoesNotExist;
-          }
-          else if (hashCode == launchTemplateIdMalformed_HASH)
-          {
-            return LaunchTemplateErrorCode::launchTemplateIdMalformed;
-          }
-          else if (hashCode == launchTemplateNameDoesNotExist_HASH)
-          {
-            return LaunchTemplateErrorCode::launchTemplateNameDoesNotExist;
-          }
-          else if (hashCode == launchTemplateNameMalformed_HASH)
-          {
-            return LaunchTemplateErrorCode::launchTemplateNameMalformed;
-          }
-          else if (hashCode == launchTemplateVersionDoesNotExist_HASH)
-          {
-            return LaunchTemplateErrorCode::launchTemplateVersionDoesNotExist;
-          }
-          else if (hashCode == unexpectedError_HASH)
-          {
-            return LaunchTemplateErrorCode::unexpectedError;
+          case launchTemplateIdDoesNotExist_HASH:
+            if (name == "launchTemplateIdDoesNotExist")
+            {
+              return LaunchTemplateErrorCode::launchTemplateIdDoesNotExist;
+            }
+            break;
+          case launchTemplateIdMalformed_HASH:
+            if (name == "launchTemplateIdMalformed")
+            {
+              return LaunchTemplateErrorCode::launchTemplateIdMalformed;
+            }
+            break;
+          case launchTemplateNameDoesNotExist_HASH:
+            if (name == "launchTemplateNameDoesNotExist")
+            {
+              return LaunchTemplateErrorCode::launchTemplateNameDoesNotExist;
+            }
+            break;
+          case launchTemplateNameMalformed_HASH:
+            if (name == "launchTemplateNameMalformed")
+            {
+              return LaunchTemplateErrorCode::launchTemplateNameMalformed;
+            }
+            break;
+          case launchTemplateVersionDoesNotExist_HASH:
+            if (name == "launchTemplateVersionDoesNotExist")
+            {
+              return LaunchTemplateErrorCode::launchTemplateVersionDoesNotExist;
+            }
+            break;
+          case unexpectedError_HASH:
+            if (name == "unexpectedError")
+            {
+              return LaunchTemplateErrorCode::unexpectedError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return LaunchTemplateErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForLaunchTemplateErrorCode(LaunchTemplateErrorCode enumValue)
+        const char* GetNameForLaunchTemplateErrorCode(LaunchTemplateErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
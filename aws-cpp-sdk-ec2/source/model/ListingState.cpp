@@ -30,30 +30,44 @@ namespace Aws
       namespace ListingStateMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int sold_HASH = HashingUtils::HashString("sold");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int pending_HASH = HashingUtils::HashString("pending");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int sold_HASH = HashingUtils::CompileTimeHashString("sold");
+        static constexpr int cancelled_HASH = HashingUtils::CompileTimeHashString("cancelled");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
 
 
         ListingState GetListingStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ListingState::available;
-          }
-          else if (hashCode == sold_HASH)
-          {
-            return ListingState::sold;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return ListingState::cancelled;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return ListingState::pending;
+          case available_HASH:
+            if (name == "available")
+            {
+              return ListingState::available;
+            }
+            break;
+          case sold_HASH:
+            if (name == "sold")
+            {
+              return ListingState::sold;
+            }
+            break;
+          case cancelled_HASH:
+            if (name == "cancelled")
+            {
+              return ListingState::cancelled;
+            }
+            break;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return ListingState::pending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ListingState::NOT_SET;
         }
 
-        Aws::String GetNameForListingState(ListingState enumValue)
+        const char* GetNameForListingState(ListingState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ListingStatusMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int closed_HASH = HashingUtils::HashString("closed");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int cancelled_HASH = HashingUtils::CompileTimeHashString("cancelled");
+        static constexpr int closed_HASH = HashingUtils::CompileTimeHashString("closed");
 
 
         ListingStatus GetListingStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ListingStatus::active;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return ListingStatus::pending;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return ListingStatus::cancelled;
-          }
-          else if (hashCode == closed_HASH)
-          {
-            return ListingStatus::closed;
+          case active_HASH:
+            if (name == "active")
+            {
+              return ListingStatus::active;
+            }
+            break;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return ListingStatus::pending;
+            }
+            break;
+          case cancelled_HASH:
+            if (name == "cancelled")
+            {
+              return ListingStatus::cancelled;
+            }
+            break;
+          case closed_HASH:
+            if (name == "closed")
+            {
+              return ListingStatus::closed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ListingStatus::NOT_SET;
         }
 
-        Aws::String GetNameForListingStatus(ListingStatus enumValue)
+        const char* GetNameForListingStatus(ListingStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
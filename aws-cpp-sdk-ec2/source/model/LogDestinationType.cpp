@@ -30,20 +30,30 @@ namespace Aws
       namespace LogDestinationTypeMapper
       {
 
-        static const int cloud_watch_logs_HASH = HashingUtils::HashString("cloud-watch-logs");
-        static const int s3_HASH = HashingUtils::HashString("s3");
+        static constexpr int cloud_watch_logs_HASH = HashingUtils::CompileTimeHashString("cloud-watch-logs");
+        static constexpr int s3_HASH = HashingUtils::CompileTimeHashString("s3");
 
 
         LogDestinationType GetLogDestinationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cloud_watch_logs_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LogDestinationType::cloud_watch_logs;
-          }
-          else if (hashCode == s3_HASH)
-          {
-            return LogDestinationType::s3;
+          case cloud_watch_logs_HASH:
+            if (name == "cloud-watch-logs")
+            {
+              return LogDestinationType::cloud_watch_logs;
+            }
+            break;
+          case s3_HASH:
+            if (name == "s3")
+            {
+              return LogDestinationType::s3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LogDestinationType::NOT_SET;
         }
 
-        Aws::String GetNameForLogDestinationType(LogDestinationType enumValue)
+        const char* GetNameForLogDestinationType(LogDestinationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace MarketTypeMapper
       {
 
-        static const int spot_HASH = HashingUtils::HashString("spot");
+        static constexpr int spot_HASH = HashingUtils::CompileTimeHashString("spot");
 
 
         MarketType GetMarketTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == spot_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MarketType::spot;
+          case spot_HASH:
+            if (name == "spot")
+            {
+              return MarketType::spot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return MarketType::NOT_SET;
         }
 
-        Aws::String GetNameForMarketType(MarketType enumValue)
+        const char* GetNameForMarketType(MarketType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
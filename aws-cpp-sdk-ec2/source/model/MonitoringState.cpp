@@ -30,30 +30,44 @@ namespace Aws
       namespace MonitoringStateMapper
       {
 
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
-        static const int disabling_HASH = HashingUtils::HashString("disabling");
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int pending_HASH = HashingUtils::HashString("pending");
+        static constexpr int disabled_HASH = HashingUtils::CompileTimeHashString("disabled");
+        static constexpr int disabling_HASH = HashingUtils::CompileTimeHashString("disabling");
+        static constexpr int enabled_HASH = HashingUtils::CompileTimeHashString("enabled");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
 
 
         MonitoringState GetMonitoringStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == disabled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MonitoringState::disabled;
-          }
-          else if (hashCode == disabling_HASH)
-          {
-            return MonitoringState::disabling;
-          }
-          else if (hashCode == enabled_HASH)
-          {
-            return MonitoringState::enabled;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return MonitoringState::pending;
+          case disabled_HASH:
+            if (name == "disabled")
+            {
+              return MonitoringState::disabled;
+            }
+            break;
+          case disabling_HASH:
+            if (name == "disabling")
+            {
+              return MonitoringState::disabling;
+            }
+            break;
+          case enabled_HASH:
+            if (name == "enabled")
+            {
+              return MonitoringState::enabled;
+            }
+            break;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return MonitoringState::pending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return MonitoringState::NOT_SET;
         }
 
-        Aws::String GetNameForMonitoringState(MonitoringState enumValue)
+        const char* GetNameForMonitoringState(MonitoringState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
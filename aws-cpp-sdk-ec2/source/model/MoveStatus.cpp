@@ -30,20 +30,30 @@ namespace Aws
       namespace MoveStatusMapper
       {
 
-        static const int movingToVpc_HASH = HashingUtils::HashString("movingToVpc");
-        static const int restoringToClassic_HASH = HashingUtils::HashString("restoringToClassic");
+        static constexpr int movingToVpc_HASH = HashingUtils::CompileTimeHashString("movingToVpc");
+        static constexpr int restoringToClassic_HASH = HashingUtils::CompileTimeHashString("restoringToClassic");
 
 
         MoveStatus GetMoveStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == movingToVpc_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MoveStatus::movingToVpc;
-          }
-          else if (hashCode == restoringToClassic_HASH)
-          {
-            return MoveStatus::restoringToClassic;
+          case movingToVpc_HASH:
+            if (name == "movingToVpc")
+            {
+              return MoveStatus::movingToVpc;
+            }
+            break;
+          case restoringToClassic_HASH:
+            if (name == "restoringToClassic")
+            {
+              return MoveStatus::restoringToClassic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MoveStatus::NOT_SET;
         }
 
-        Aws::String GetNameForMoveStatus(MoveStatus enumValue)
+        const char* GetNameForMoveStatus(MoveStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace NatGatewayStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
 
 
         NatGatewayState GetNatGatewayStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NatGatewayState::pending;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return NatGatewayState::failed;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return NatGatewayState::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return NatGatewayState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return NatGatewayState::deleted;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return NatGatewayState::pending;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return NatGatewayState::failed;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return NatGatewayState::available;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return NatGatewayState::deleting;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return NatGatewayState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return NatGatewayState::NOT_SET;
         }
 
-        Aws::String GetNameForNatGatewayState(NatGatewayState enumValue)
+        const char* GetNameForNatGatewayState(NatGatewayState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace NetworkInterfaceAttributeMapper
       {
 
-        static const int description_HASH = HashingUtils::HashString("description");
-        static const int groupSet_HASH = HashingUtils::HashString("groupSet");
-        static const int sourceDestCheck_HASH = HashingUtils::HashString("sourceDestCheck");
-        static const int attachment_HASH = HashingUtils::HashString("attachment");
+        static constexpr int description_HASH = HashingUtils::CompileTimeHashString("description");
+        static constexpr int groupSet_HASH = HashingUtils::CompileTimeHashString("groupSet");
+        static constexpr int sourceDestCheck_HASH = HashingUtils::CompileTimeHashString("sourceDestCheck");
+        static constexpr int attachment_HASH = HashingUtils::CompileTimeHashString("attachment");
 
 
         NetworkInterfaceAttribute GetNetworkInterfaceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == description_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NetworkInterfaceAttribute::description;
-          }
-          else if (hashCode == groupSet_HASH)
-          {
-            return NetworkInterfaceAttribute::groupSet;
-          }
-          else if (hashCode == sourceDestCheck_HASH)
-          {
-            return NetworkInterfaceAttribute::sourceDestCheck;
-          }
-          else if (hashCode == attachment_HASH)
-          {
-            return NetworkInterfaceAttribute::attachment;
+          case description_HASH:
+            if (name == "description")
+            {
+              return NetworkInterfaceAttribute::description;
+            }
+            break;
+          case groupSet_HASH:
+            if (name == "groupSet")
+            {
+              return NetworkInterfaceAttribute::groupSet;
+            }
+            break;
+          case sourceDestCheck_HASH:
+            if (name == "sourceDestCheck")
+            {
+              return NetworkInterfaceAttribute::sourceDestCheck;
+            }
+            break;
+          case attachment_HASH:
+            if (name == "attachment")
+            {
+              return NetworkInterfaceAttribute::attachment;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return NetworkInterfaceAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInterfaceAttribute(NetworkInterfaceAttribute enumValue)
+        const char* GetNameForNetworkInterfaceAttribute(NetworkInterfaceAttribute enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
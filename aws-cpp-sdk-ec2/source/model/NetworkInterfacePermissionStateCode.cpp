@@ -30,30 +30,44 @@ namespace Aws
       namespace NetworkInterfacePermissionStateCodeMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int granted_HASH = HashingUtils::HashString("granted");
-        static const int revoking_HASH = HashingUtils::HashString("revoking");
-        static const int revoked_HASH = HashingUtils::HashString("revoked");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int granted_HASH = HashingUtils::CompileTimeHashString("granted");
+        static constexpr int revoking_HASH = HashingUtils::CompileTimeHashString("revoking");
+        static constexpr int revoked_HASH = HashingUtils::CompileTimeHashString("revoked");
 
 
         NetworkInterfacePermissionStateCode GetNetworkInterfacePermissionStateCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NetworkInterfacePermissionStateCode::pending;
-          }
-          else if (hashCode == granted_HASH)
-          {
-            return NetworkInterfacePermissionStateCode::granted;
-          }
-          else if (hashCode == revoking_HASH)
-          {
-            return NetworkInterfacePermissionStateCode::revoking;
-          }
-          else if (hashCode == revoked_HASH)
-          {
-            return NetworkInterfacePermissionStateCode::revoked;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return NetworkInterfacePermissionStateCode::pending;
+            }
+            break;
+          case granted_HASH:
+            if (name == "granted")
+            {
+              return NetworkInterfacePermissionStateCode::granted;
+            }
+            break;
+          case revoking_HASH:
+            if (name == "revoking")
+            {
+              return NetworkInterfacePermissionStateCode::revoking;
+            }
+            break;
+          case revoked_HASH:
+            if (name == "revoked")
+            {
+              return NetworkInterfacePermissionStateCode::revoked;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return NetworkInterfacePermissionStateCode::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInterfacePermissionStateCode(NetworkInterfacePermissionStateCode enumValue)
+        const char* GetNameForNetworkInterfacePermissionStateCode(NetworkInterfacePermissionStateCode enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
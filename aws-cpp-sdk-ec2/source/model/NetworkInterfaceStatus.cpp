@@ -30,35 +30,51 @@ namespace Aws
       namespace NetworkInterfaceStatusMapper
       {
 
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int associated_HASH = HashingUtils::HashString("associated");
-        static const int attaching_HASH = HashingUtils::HashString("attaching");
-        static const int in_use_HASH = HashingUtils::HashString("in-use");
-        static const int detaching_HASH = HashingUtils::HashString("detaching");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int associated_HASH = HashingUtils::CompileTimeHashString("associated");
+        static constexpr int attaching_HASH = HashingUtils::CompileTimeHashString("attaching");
+        static constexpr int in_use_HASH = HashingUtils::CompileTimeHashString("in-use");
+        static constexpr int detaching_HASH = HashingUtils::CompileTimeHashString("detaching");
 
 
         NetworkInterfaceStatus GetNetworkInterfaceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == available_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NetworkInterfaceStatus::available;
-          }
-          else if (hashCode == associated_HASH)
-          {
-            return NetworkInterfaceStatus::associated;
-          }
-          else if (hashCode == attaching_HASH)
-          {
-            return NetworkInterfaceStatus::attaching;
-          }
-          else if (hashCode == in_use_HASH)
-          {
-            return NetworkInterfaceStatus::in_use;
-          }
-          else if (hashCode == detaching_HASH)
-          {
-            return NetworkInterfaceStatus::detaching;
+          case available_HASH:
+            if (name == "available")
+            {
+              return NetworkInterfaceStatus::available;
+            }
+            break;
+          case associated_HASH:
+            if (name == "associated")
+            {
+              return NetworkInterfaceStatus::associated;
+            }
+            break;
+          case attaching_HASH:
+            if (name == "attaching")
+            {
+              return NetworkInterfaceStatus::attaching;
+            }
+            break;
+          case in_use_HASH:
+            if (name == "in-use")
+            {
+              return NetworkInterfaceStatus::in_use;
+            }
+            break;
+          case detaching_HASH:
+            if (name == "detaching")
+            {
+              return NetworkInterfaceStatus::detaching;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return NetworkInterfaceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInterfaceStatus(NetworkInterfaceStatus enumValue)
+        const char* GetNameForNetworkInterfaceStatus(NetworkInterfaceStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace NetworkInterfaceTypeMapper
       {
 
-        static const int interface_HASH = HashingUtils::HashString("interface");
-        static const int natGateway_HASH = HashingUtils::HashString("natGateway");
+        static constexpr int interface_HASH = HashingUtils::CompileTimeHashString("interface");
+        static constexpr int natGateway_HASH = HashingUtils::CompileTimeHashString("natGateway");
 
 
         NetworkInterfaceType GetNetworkInterfaceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == interface_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NetworkInterfaceType::interface;
-          }
-          else if (hashCode == natGateway_HASH)
-          {
-            return NetworkInterfaceType::natGateway;
+          case interface_HASH:
+            if (name == "interface")
+            {
+              return NetworkInterfaceType::interface;
+            }
+            break;
+          case natGateway_HASH:
+            if (name == "natGateway")
+            {
+              return NetworkInterfaceType::natGateway;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return NetworkInterfaceType::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInterfaceType(NetworkInterfaceType enumValue)
+        const char* GetNameForNetworkInterfaceType(NetworkInterfaceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
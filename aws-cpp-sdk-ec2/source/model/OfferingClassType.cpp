@@ -30,20 +30,30 @@ namespace Aws
       namespace OfferingClassTypeMapper
       {
 
-        static const int standard_HASH = HashingUtils::HashString("standard");
-        static const int convertible_HASH = HashingUtils::HashString("convertible");
+        static constexpr int standard_HASH = HashingUtils::CompileTimeHashString("standard");
+        static constexpr int convertible_HASH = HashingUtils::CompileTimeHashString("convertible");
 
 
         OfferingClassType GetOfferingClassTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == standard_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OfferingClassType::standard;
-          }
-          else if (hashCode == convertible_HASH)
-          {
-            return OfferingClassType::convertible;
+          case standard_HASH:
+            if (name == "standard")
+            {
+              return OfferingClassType::standard;
+            }
+            break;
+          case convertible_HASH:
+            if (name == "convertible")
+            {
+              return OfferingClassType::convertible;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OfferingClassType::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingClassType(OfferingClassType enumValue)
+        const char* GetNameForOfferingClassType(OfferingClassType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace OfferingTypeValuesMapper
       {
 
-        static const int Heavy_Utilization_HASH = HashingUtils::HashString("Heavy Utilization");
-        static const int Medium_Utilization_HASH = HashingUtils::HashString("Medium Utilization");
-        static const int Light_Utilization_HASH = HashingUtils::HashString("Light Utilization");
-        static const int No_Upfront_HASH = HashingUtils::HashString("No Upfront");
-        static const int Partial_Upfront_HASH = HashingUtils::HashString("Partial Upfront");
-        static const int All_Upfront_HASH = HashingUtils::HashString("All Upfront");
+        static constexpr int Heavy_Utilization_HASH = HashingUtils::CompileTimeHashString("Heavy Utilization");
+        static constexpr int Medium_Utilization_HASH = HashingUtils::CompileTimeHashString("Medium Utilization");
+        static constexpr int Light_Utilization_HASH = HashingUtils::CompileTimeHashString("Light Utilization");
+        static constexpr int No_Upfront_HASH = HashingUtils::CompileTimeHashString("No Upfront");
+        static constexpr int Partial_Upfront_HASH = HashingUtils::CompileTimeHashString("Partial Upfront");
+        static constexpr int All_Upfront_HASH = HashingUtils::CompileTimeHashString("All Upfront");
 
 
         OfferingTypeValues GetOfferingTypeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Heavy_Utilization_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OfferingTypeValues::Heavy_Utilization;
-          }
-          else if (hashCode == Medium_Utilization_HASH)
-          {
-            return OfferingTypeValues::Medium_Utilization;
-          }
-          else if (hashCode == Light_Utilization_HASH)
-          {
-            return OfferingTypeValues::Light_Utilization;
-          }
-          else if (hashCode == No_Upfront_HASH)
-          {
-            return OfferingTypeValues::No_Upfront;
-          }
-          else if (hashCode == Partial_Upfront_HASH)
-          {
-            return OfferingTypeValues::Partial_Upfront;
-          }
-          else if (hashCode == All_Upfront_HASH)
-          {
-            return OfferingTypeValues::All_Upfront;
+          case Heavy_Utilization_HASH:
+            if (name == "Heavy Utilization")
+            {
+              return OfferingTypeValues::Heavy_Utilization;
+            }
+            break;
+          case Medium_Utilization_HASH:
+            if (name == "Medium Utilization")
+            {
+              return OfferingTypeValues::Medium_Utilization;
+            }
+            break;
+          case Light_Utilization_HASH:
+            if (name == "Light Utilization")
+            {
+              return OfferingTypeValues::Light_Utilization;
+            }
+            break;
+          case No_Upfront_HASH:
+            if (name == "No Upfront")
+            {
+              return OfferingTypeValues::No_Upfront;
+            }
+            break;
+          case Partial_Upfront_HASH:
+            if (name == "Partial Upfront")
+            {
+              return OfferingTypeValues::Partial_Upfront;
+            }
+            break;
+          case All_Upfront_HASH:
+            if (name == "All Upfront")
+            {
+              return OfferingTypeValues::All_Upfront;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return OfferingTypeValues::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingTypeValues(OfferingTypeValues enumValue)
+        const char* GetNameForOfferingTypeValues(OfferingTypeValues enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace OnDemandAllocationStrategyMapper
       {
 
-        static const int lowestPrice_HASH = HashingUtils::HashString("lowestPrice");
-        static const int prioritized_HASH = HashingUtils::HashString("prioritized");
+        static constexpr int lowestPrice_HASH = HashingUtils::CompileTimeHashString("lowestPrice");
+        static constexpr int prioritized_HASH = HashingUtils::CompileTimeHashString("prioritized");
 
 
         OnDemandAllocationStrategy GetOnDemandAllocationStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == lowestPrice_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OnDemandAllocationStrategy::lowestPrice;
-          }
-          else if (hashCode == prioritized_HASH)
-          {
-            return OnDemandAllocationStrategy::prioritized;
+          case lowestPrice_HASH:
+            if (name == "lowestPrice")
+            {
+              return OnDemandAllocationStrategy::lowestPrice;
+            }
+            break;
+          case prioritized_HASH:
+            if (name == "prioritized")
+            {
+              return OnDemandAllocationStrategy::prioritized;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OnDemandAllocationStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForOnDemandAllocationStrategy(OnDemandAllocationStrategy enumValue)
+        const char* GetNameForOnDemandAllocationStrategy(OnDemandAllocationStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int add_HASH = HashingUtils::HashString("add");
-        static const int remove_HASH = HashingUtils::HashString("remove");
+        static constexpr int add_HASH = HashingUtils::CompileTimeHashString("add");
+        static constexpr int remove_HASH = HashingUtils::CompileTimeHashString("remove");
 
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == add_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationType::add;
-          }
-          else if (hashCode == remove_HASH)
-          {
-            return OperationType::remove;
+          case add_HASH:
+            if (name == "add")
+            {
+              return OperationType::add;
+            }
+            break;
+          case remove_HASH:
+            if (name == "remove")
+            {
+              return OperationType::remove;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationType(OperationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace PaymentOptionMapper
       {
 
-        static const int AllUpfront_HASH = HashingUtils::HashString("AllUpfront");
-        static const int PartialUpfront_HASH = HashingUtils::HashString("PartialUpfront");
-        static const int NoUpfront_HASH = HashingUtils::HashString("NoUpfront");
+        static constexpr int AllUpfront_HASH = HashingUtils::CompileTimeHashString("AllUpfront");
+        static constexpr int PartialUpfront_HASH = HashingUtils::CompileTimeHashString("PartialUpfront");
+        static constexpr int NoUpfront_HASH = HashingUtils::CompileTimeHashString("NoUpfront");
 
 
         PaymentOption GetPaymentOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AllUpfront_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PaymentOption::AllUpfront;
-          }
-          else if (hashCode == PartialUpfront_HASH)
-          {
-            return PaymentOption::PartialUpfront;
-          }
-          else if (hashCode == NoUpfront_HASH)
-          {
-            return PaymentOption::NoUpfront;
+          case AllUpfront_HASH:
+            if (name == "AllUpfront")
+            {
+              return PaymentOption::AllUpfront;
+            }
+            break;
+          case PartialUpfront_HASH:
+            if (name == "PartialUpfront")
+            {
+              return PaymentOption::PartialUpfront;
+            }
+            break;
+          case NoUpfront_HASH:
+            if (name == "NoUpfront")
+            {
+              return PaymentOption::NoUpfront;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PaymentOption::NOT_SET;
         }
 
-        Aws::String GetNameForPaymentOption(PaymentOption enumValue)
+        const char* GetNameForPaymentOption(PaymentOption enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
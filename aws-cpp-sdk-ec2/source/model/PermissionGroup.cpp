@@ -30,15 +30,23 @@ namespace Aws
       namespace PermissionGroupMapper
       {
 
-        static const int all_HASH = HashingUtils::HashString("all");
+        static constexpr int all_HASH = HashingUtils::CompileTimeHashString("all");
 
 
         PermissionGroup GetPermissionGroupForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == all_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PermissionGroup::all;
+          case all_HASH:
+            if (name == "all")
+            {
+              return PermissionGroup::all;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return PermissionGroup::NOT_SET;
         }
 
-        Aws::String GetNameForPermissionGroup(PermissionGroup enumValue)
+        const char* GetNameForPermissionGroup(PermissionGroup enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PlacementStrategyMapper
       {
 
-        static const int cluster_HASH = HashingUtils::HashString("cluster");
-        static const int spread_HASH = HashingUtils::HashString("spread");
+        static constexpr int cluster_HASH = HashingUtils::CompileTimeHashString("cluster");
+        static constexpr int spread_HASH = HashingUtils::CompileTimeHashString("spread");
 
 
         PlacementStrategy GetPlacementStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cluster_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlacementStrategy::cluster;
-          }
-          else if (hashCode == spread_HASH)
-          {
-            return PlacementStrategy::spread;
+          case cluster_HASH:
+            if (name == "cluster")
+            {
+              return PlacementStrategy::cluster;
+            }
+            break;
+          case spread_HASH:
+            if (name == "spread")
+            {
+              return PlacementStrategy::spread;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PlacementStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForPlacementStrategy(PlacementStrategy enumValue)
+        const char* GetNameForPlacementStrategy(PlacementStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
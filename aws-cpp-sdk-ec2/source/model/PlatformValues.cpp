@@ -30,15 +30,23 @@ namespace Aws
       namespace PlatformValuesMapper
       {
 
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
+        static constexpr int Windows_HASH = HashingUtils::CompileTimeHashString("Windows");
 
 
         PlatformValues GetPlatformValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Windows_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlatformValues::Windows;
+          case Windows_HASH:
+            if (name == "Windows")
+            {
+              return PlatformValues::Windows;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return PlatformValues::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformValues(PlatformValues enumValue)
+        const char* GetNameForPlatformValues(PlatformValues enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace PrincipalTypeMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int Service_HASH = HashingUtils::HashString("Service");
-        static const int OrganizationUnit_HASH = HashingUtils::HashString("OrganizationUnit");
-        static const int Account_HASH = HashingUtils::HashString("Account");
-        static const int User_HASH = HashingUtils::HashString("User");
-        static const int Role_HASH = HashingUtils::HashString("Role");
+        static constexpr int All_HASH = HashingUtils::CompileTimeHashString("All");
+        static constexpr int Service_HASH = HashingUtils::CompileTimeHashString("Service");
+        static constexpr int OrganizationUnit_HASH = HashingUtils::CompileTimeHashString("OrganizationUnit");
+        static constexpr int Account_HASH = HashingUtils::CompileTimeHashString("Account");
+        static constexpr int User_HASH = HashingUtils::CompileTimeHashString("User");
+        static constexpr int Role_HASH = HashingUtils::CompileTimeHashString("Role");
 
 
         PrincipalType GetPrincipalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PrincipalType::All;
-          }
-          else if (hashCode == Service_HASH)
-          {
-            return PrincipalType::Service;
-          }
-          else if (hashCode == OrganizationUnit_HASH)
-          {
-            return PrincipalType::OrganizationUnit;
-          }
-          else if (hashCode == Account_HASH)
-          {
-            return PrincipalType::Account;
-          }
-          else if (hashCode == User_HASH)
-          {
-            return PrincipalType::User;
-          }
-          else if (hashCode == Role_HASH)
-          {
-            return PrincipalType::Role;
+          case All_HASH:
+            if (name == "All")
+            {
+              return PrincipalType::All;
+            }
+            break;
+          case Service_HASH:
+            if (name == "Service")
+            {
+              return PrincipalType::Service;
+            }
+            break;
+          case OrganizationUnit_HASH:
+            if (name == "OrganizationUnit")
+            {
+              return PrincipalType::OrganizationUnit;
+            }
+            break;
+          case Account_HASH:
+            if (name == "Account")
+            {
+              return PrincipalType::Account;
+            }
+            break;
+          case User_HASH:
+            if (name == "User")
+            {
+              return PrincipalType::User;
+            }
+            break;
+          case Role_HASH:
+            if (name == "Role")
+            {
+              return PrincipalType::Role;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return PrincipalType::NOT_SET;
         }
 
-        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        const char* GetNameForPrincipalType(PrincipalType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
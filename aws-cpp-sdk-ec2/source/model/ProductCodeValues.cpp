@@ -30,20 +30,30 @@ namespace Aws
       namespace ProductCodeValuesMapper
       {
 
-        static const int devpay_HASH = HashingUtils::HashString("devpay");
-        static const int marketplace_HASH = HashingUtils::HashString("marketplace");
+        static constexpr int devpay_HASH = HashingUtils::CompileTimeHashString("devpay");
+        static constexpr int marketplace_HASH = HashingUtils::CompileTimeHashString("marketplace");
 
 
         ProductCodeValues GetProductCodeValuesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == devpay_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProductCodeValues::devpay;
-          }
-          else if (hashCode == marketplace_HASH)
-          {
-            return ProductCodeValues::marketplace;
+          case devpay_HASH:
+            if (name == "devpay")
+            {
+              return ProductCodeValues::devpay;
+            }
+            break;
+          case marketplace_HASH:
+            if (name == "marketplace")
+            {
+              return ProductCodeValues::marketplace;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ProductCodeValues::NOT_SET;
         }
 
-        Aws::String GetNameForProductCodeValues(ProductCodeValues enumValue)
+        const char* GetNameForProductCodeValues(ProductCodeValues enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
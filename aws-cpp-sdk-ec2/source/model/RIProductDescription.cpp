@@ -30,30 +30,44 @@ namespace Aws
       namespace RIProductDescriptionMapper
       {
 
-        static const int Linux_UNIX_HASH = HashingUtils::HashString("Linux/UNIX");
-        static const int Linux_UNIX_Amazon_VPC_HASH = HashingUtils::HashString("Linux/UNIX (Amazon VPC)");
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
-        static const int Windows_Amazon_VPC_HASH = HashingUtils::HashString("Windows (Amazon VPC)");
+        static constexpr int Linux_UNIX_HASH = HashingUtils::CompileTimeHashString("Linux/UNIX");
+        static constexpr int Linux_UNIX_Amazon_VPC_HASH = HashingUtils::CompileTimeHashString("Linux/UNIX (Amazon VPC)");
+        static constexpr int Windows_HASH = HashingUtils::CompileTimeHashString("Windows");
+        static constexpr int Windows_Amazon_VPC_HASH = HashingUtils::CompileTimeHashString("Windows (Amazon VPC)");
 
 
         RIProductDescription GetRIProductDescriptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Linux_UNIX_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RIProductDescription::Linux_UNIX;
-          }
-          else if (hashCode == Linux_UNIX_Amazon_VPC_HASH)
-          {
-            return RIProductDescription::Linux_UNIX_Amazon_VPC;
-          }
-          else if (hashCode == Windows_HASH)
-          {
-            return RIProductDescription::Windows;
-          }
-          else if (hashCode == Windows_Amazon_VPC_HASH)
-          {
-            return RIProductDescription::Windows_Amazon_VPC;
+          case Linux_UNIX_HASH:
+            if (name == "Linux/UNIX")
+            {
+              return RIProductDescription::Linux_UNIX;
+            }
+            break;
+          case Linux_UNIX_Amazon_VPC_HASH:
+            if (name == "Linux/UNIX (Amazon VPC)")
+            {
+              return RIProductDescription::Linux_UNIX_Amazon_VPC;
+            }
+            break;
+          case Windows_HASH:
+            if (name == "Windows")
+            {
+              return RIProductDescription::Windows;
+            }
+            break;
+          case Windows_Amazon_VPC_HASH:
+            if (name == "Windows (Amazon VPC)")
+            {
+              return RIProductDescription::Windows_Amazon_VPC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return RIProductDescription::NOT_SET;
         }
 
-        Aws::String GetNameForRIProductDescription(RIProductDescription enumValue)
+        const char* GetNameForRIProductDescription(RIProductDescription enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace RecurringChargeFrequencyMapper
       {
 
-        static const int Hourly_HASH = HashingUtils::HashString("Hourly");
+        static constexpr int Hourly_HASH = HashingUtils::CompileTimeHashString("Hourly");
 
 
         RecurringChargeFrequency GetRecurringChargeFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Hourly_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RecurringChargeFrequency::Hourly;
+          case Hourly_HASH:
+            if (name == "Hourly")
+            {
+              return RecurringChargeFrequency::Hourly;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return RecurringChargeFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForRecurringChargeFrequency(RecurringChargeFrequency enumValue)
+        const char* GetNameForRecurringChargeFrequency(RecurringChargeFrequency enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,55 +30,79 @@ namespace Aws
       namespace ReportInstanceReasonCodesMapper
       {
 
-        static const int instance_stuck_in_state_HASH = HashingUtils::HashString("instance-stuck-in-state");
-        static const int unresponsive_HASH = HashingUtils::HashString("unresponsive");
-        static const int not_accepting_credentials_HASH = HashingUtils::HashString("not-accepting-credentials");
-        static const int password_not_available_HASH = HashingUtils::HashString("password-not-available");
-        static const int performance_network_HASH = HashingUtils::HashString("performance-network");
-        static const int performance_instance_store_HASH = HashingUtils::HashString("performance-instance-store");
-        static const int performance_ebs_volume_HASH = HashingUtils::HashString("performance-ebs-volume");
-        static const int performance_other_HASH = HashingUtils::HashString("performance-other");
-        static const int other_HASH = HashingUtils::HashString("other");
+        static constexpr int instance_stuck_in_state_HASH = HashingUtils::CompileTimeHashString("instance-stuck-in-state");
+        static constexpr int unresponsive_HASH = HashingUtils::CompileTimeHashString("unresponsive");
+        static constexpr int not_accepting_credentials_HASH = HashingUtils::CompileTimeHashString("not-accepting-credentials");
+        static constexpr int password_not_available_HASH = HashingUtils::CompileTimeHashString("password-not-available");
+        static constexpr int performance_network_HASH = HashingUtils::CompileTimeHashString("performance-network");
+        static constexpr int performance_instance_store_HASH = HashingUtils::CompileTimeHashString("performance-instance-store");
+        static constexpr int performance_ebs_volume_HASH = HashingUtils::CompileTimeHashString("performance-ebs-volume");
+        static constexpr int performance_other_HASH = HashingUtils::CompileTimeHashString("performance-other");
+        static constexpr int other_HASH = HashingUtils::CompileTimeHashString("other");
 
 
         ReportInstanceReasonCodes GetReportInstanceReasonCodesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_stuck_in_state_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReportInstanceReasonCodes::instance_stuck_in_state;
-          }
-          else if (hashCode == unresponsive_HASH)
-          {
-            return ReportInstanceReasonCodes::unresponsive;
-          }
-          else if (hashCode == not_accepting_credentials_HASH)
-          {
-            return ReportInstanceReasonCodes::not_accepting_credentials;
-          }
-          else if (hashCode == password_not_available_HASH)
-          {
-            return ReportInstanceReasonCodes::password_not_available;
-          }
-          else if (hashCode == performance_network_HASH)
-          {
-            return ReportInstanceReasonCodes::performance_network;
-          }
-          else if (hashCode == performance_instance_store_HASH)
-          {
-            return ReportInstanceReasonCodes::performance_instance_store;
-          }
-          else if (hashCode == performance_ebs_volume_HASH)
-          {
-            return ReportInstanceReasonCodes::performance_ebs_volume;
-          }
-          else if (hashCode == performance_other_HASH)
-          {
-            return ReportInstanceReasonCodes::performance_other;
-          }
-          else if (hashCode == other_HASH)
-          {
-            return ReportInstanceReasonCodes::other;
+          case instance_stuck_in_state_HASH:
+            if (name == "instance-stuck-in-state")
+            {
+              return ReportInstanceReasonCodes::instance_stuck_in_state;
+            }
+            break;
+          case unresponsive_HASH:
+            if (name == "unresponsive")
+            {
+              return ReportInstanceReasonCodes::unresponsive;
+            }
+            break;
+          case not_accepting_credentials_HASH:
+            if (name == "not-accepting-credentials")
+            {
+              return ReportInstanceReasonCodes::not_accepting_credentials;
+            }
+            break;
+          case password_not_available_HASH:
+            if (name == "password-not-available")
+            {
+              return ReportInstanceReasonCodes::password_not_available;
+            }
+            break;
+          case performance_network_HASH:
+            if (name == "performance-network")
+            {
+              return ReportInstanceReasonCodes::performance_network;
+            }
+            break;
+          case performance_instance_store_HASH:
+            if (name == "performance-instance-store")
+            {
+              return ReportInstanceReasonCodes::performance_instance_store;
+            }
+            break;
+          case performance_ebs_volume_HASH:
+            if (name == "performance-ebs-volume")
+            {
+              return ReportInstanceReasonCodes::performance_ebs_volume;
+            }
+            break;
+          case performance_other_HASH:
+            if (name == "performance-other")
+            {
+              return ReportInstanceReasonCodes::performance_other;
+            }
+            break;
+          case other_HASH:
+            if (name == "other")
+            {
+              return ReportInstanceReasonCodes::other;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return ReportInstanceReasonCodes::NOT_SET;
         }
 
-        Aws::String GetNameForReportInstanceReasonCodes(ReportInstanceReasonCodes enumValue)
+        const char* GetNameForReportInstanceReasonCodes(ReportInstanceReasonCodes enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -69,7 +69,7 @@ Aws::String ReportInstanceStatusRequest::SerializePayload() const
     for(auto& item : m_reasonCodes)
     {
       ss << "ReasonCode." << reasonCodesCount << "="
-          << StringUtils::URLEncode(ReportInstanceReasonCodesMapper::GetNameForReportInstanceReasonCodes(item).c_str()) << "&";
+          << StringUtils::URLEncode(ReportInstanceReasonCodesMapper::GetNameForReportInstanceReasonCodes(item)) << "&";
       reasonCodesCount++;
     }
   }
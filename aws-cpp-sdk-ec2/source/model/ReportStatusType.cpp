@@ -30,20 +30,30 @@ namespace Aws
       namespace ReportStatusTypeMapper
       {
 
-        static const int ok_HASH = HashingUtils::HashString("ok");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
+        static constexpr int ok_HASH = HashingUtils::CompileTimeHashString("ok");
+        static constexpr int impaired_HASH = HashingUtils::CompileTimeHashString("impaired");
 
 
         ReportStatusType GetReportStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ok_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReportStatusType::ok;
-          }
-          else if (hashCode == impaired_HASH)
-          {
-            return ReportStatusType::impaired;
+          case ok_HASH:
+            if (name == "ok")
+            {
+              return ReportStatusType::ok;
+            }
+            break;
+          case impaired_HASH:
+            if (name == "impaired")
+            {
+              return ReportStatusType::impaired;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReportStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForReportStatusType(ReportStatusType enumValue)
+        const char* GetNameForReportStatusType(ReportStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
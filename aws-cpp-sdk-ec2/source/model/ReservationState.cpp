@@ -30,30 +30,44 @@ namespace Aws
       namespace ReservationStateMapper
       {
 
-        static const int payment_pending_HASH = HashingUtils::HashString("payment-pending");
-        static const int payment_failed_HASH = HashingUtils::HashString("payment-failed");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int retired_HASH = HashingUtils::HashString("retired");
+        static constexpr int payment_pending_HASH = HashingUtils::CompileTimeHashString("payment-pending");
+        static constexpr int payment_failed_HASH = HashingUtils::CompileTimeHashString("payment-failed");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int retired_HASH = HashingUtils::CompileTimeHashString("retired");
 
 
         ReservationState GetReservationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == payment_pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservationState::payment_pending;
-          }
-          else if (hashCode == payment_failed_HASH)
-          {
-            return ReservationState::payment_failed;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return ReservationState::active;
-          }
-          else if (hashCode == retired_HASH)
-          {
-            return ReservationState::retired;
+          case payment_pending_HASH:
+            if (name == "payment-pending")
+            {
+              return ReservationState::payment_pending;
+            }
+            break;
+          case payment_failed_HASH:
+            if (name == "payment-failed")
+            {
+              return ReservationState::payment_failed;
+            }
+            break;
+          case active_HASH:
+            if (name == "active")
+            {
+              return ReservationState::active;
+            }
+            break;
+          case retired_HASH:
+            if (name == "retired")
+            {
+              return ReservationState::retired;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ReservationState::NOT_SET;
         }
 
-        Aws::String GetNameForReservationState(ReservationState enumValue)
+        const char* GetNameForReservationState(ReservationState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
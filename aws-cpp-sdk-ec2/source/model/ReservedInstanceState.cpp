@@ -30,30 +30,44 @@ namespace Aws
       namespace ReservedInstanceStateMapper
       {
 
-        static const int payment_pending_HASH = HashingUtils::HashString("payment-pending");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int payment_failed_HASH = HashingUtils::HashString("payment-failed");
-        static const int retired_HASH = HashingUtils::HashString("retired");
+        static constexpr int payment_pending_HASH = HashingUtils::CompileTimeHashString("payment-pending");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int payment_failed_HASH = HashingUtils::CompileTimeHashString("payment-failed");
+        static constexpr int retired_HASH = HashingUtils::CompileTimeHashString("retired");
 
 
         ReservedInstanceState GetReservedInstanceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == payment_pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservedInstanceState::payment_pending;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return ReservedInstanceState::active;
-          }
-          else if (hashCode == payment_failed_HASH)
-          {
-            return ReservedInstanceState::payment_failed;
-          }
-          else if (hashCode == retired_HASH)
-          {
-            return ReservedInstanceState::retired;
+          case payment_pending_HASH:
+            if (name == "payment-pending")
+            {
+              return ReservedInstanceState::payment_pending;
+            }
+            break;
+          case active_HASH:
+            if (name == "active")
+            {
+              return ReservedInstanceState::active;
+            }
+            break;
+          case payment_failed_HASH:
+            if (name == "payment-failed")
+            {
+              return ReservedInstanceState::payment_failed;
+            }
+            break;
+          case retired_HASH:
+            if (name == "retired")
+            {
+              return ReservedInstanceState::retired;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ReservedInstanceState::NOT_SET;
         }
 
-        Aws::String GetNameForReservedInstanceState(ReservedInstanceState enumValue)
+        const char* GetNameForReservedInstanceState(ReservedInstanceState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ResetFpgaImageAttributeNameMapper
       {
 
-        static const int loadPermission_HASH = HashingUtils::HashString("loadPermission");
+        static constexpr int loadPermission_HASH = HashingUtils::CompileTimeHashString("loadPermission");
 
 
         ResetFpgaImageAttributeName GetResetFpgaImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == loadPermission_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResetFpgaImageAttributeName::loadPermission;
+          case loadPermission_HASH:
+            if (name == "loadPermission")
+            {
+              return ResetFpgaImageAttributeName::loadPermission;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ResetFpgaImageAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForResetFpgaImageAttributeName(ResetFpgaImageAttributeName enumValue)
+        const char* GetNameForResetFpgaImageAttributeName(ResetFpgaImageAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ResetImageAttributeNameMapper
       {
 
-        static const int launchPermission_HASH = HashingUtils::HashString("launchPermission");
+        static constexpr int launchPermission_HASH = HashingUtils::CompileTimeHashString("launchPermission");
 
 
         ResetImageAttributeName GetResetImageAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == launchPermission_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResetImageAttributeName::launchPermission;
+          case launchPermission_HASH:
+            if (name == "launchPermission")
+            {
+              return ResetImageAttributeName::launchPermission;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ResetImageAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForResetImageAttributeName(ResetImageAttributeName enumValue)
+        const char* GetNameForResetImageAttributeName(ResetImageAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
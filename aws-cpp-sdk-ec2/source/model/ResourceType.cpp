@@ -30,95 +30,135 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int customer_gateway_HASH = HashingUtils::HashString("customer-gateway");
-        static const int dhcp_options_HASH = HashingUtils::HashString("dhcp-options");
-        static const int image_HASH = HashingUtils::HashString("image");
-        static const int instance_HASH = HashingUtils::HashString("instance");
-        static const int internet_gateway_HASH = HashingUtils::HashString("internet-gateway");
-        static const int network_acl_HASH = HashingUtils::HashString("network-acl");
-        static const int network_interface_HASH = HashingUtils::HashString("network-interface");
-        static const int reserved_instances_HASH = HashingUtils::HashString("reserved-instances");
-        static const int route_table_HASH = HashingUtils::HashString("route-table");
-        static const int snapshot_HASH = HashingUtils::HashString("snapshot");
-        static const int spot_instances_request_HASH = HashingUtils::HashString("spot-instances-request");
-        static const int subnet_HASH = HashingUtils::HashString("subnet");
-        static const int security_group_HASH = HashingUtils::HashString("security-group");
-        static const int volume_HASH = HashingUtils::HashString("volume");
-        static const int vpc_HASH = HashingUtils::HashString("vpc");
-        static const int vpn_connection_HASH = HashingUtils::HashString("vpn-connection");
-        static const int vpn_gateway_HASH = HashingUtils::HashString("vpn-gateway");
+        static constexpr int customer_gateway_HASH = HashingUtils::CompileTimeHashString("customer-gateway");
+        static constexpr int dhcp_options_HASH = HashingUtils::CompileTimeHashString("dhcp-options");
+        static constexpr int image_HASH = HashingUtils::CompileTimeHashString("image");
+        static constexpr int instance_HASH = HashingUtils::CompileTimeHashString("instance");
+        static constexpr int internet_gateway_HASH = HashingUtils::CompileTimeHashString("internet-gateway");
+        static constexpr int network_acl_HASH = HashingUtils::CompileTimeHashString("network-acl");
+        static constexpr int network_interface_HASH = HashingUtils::CompileTimeHashString("network-interface");
+        static constexpr int reserved_instances_HASH = HashingUtils::CompileTimeHashString("reserved-instances");
+        static constexpr int route_table_HASH = HashingUtils::CompileTimeHashString("route-table");
+        static constexpr int snapshot_HASH = HashingUtils::CompileTimeHashString("snapshot");
+        static constexpr int spot_instances_request_HASH = HashingUtils::CompileTimeHashString("spot-instances-request");
+        static constexpr int subnet_HASH = HashingUtils::CompileTimeHashString("subnet");
+        static constexpr int security_group_HASH = HashingUtils::CompileTimeHashString("security-group");
+        static constexpr int volume_HASH = HashingUtils::CompileTimeHashString("volume");
+        static constexpr int vpc_HASH = HashingUtils::CompileTimeHashString("vpc");
+        static constexpr int vpn_connection_HASH = HashingUtils::CompileTimeHashString("vpn-connection");
+        static constexpr int vpn_gateway_HASH = HashingUtils::CompileTimeHashString("vpn-gateway");
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == customer_gateway_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceType::customer_gateway;
-          }
-          else if (hashCode == dhcp_options_HASH)
-          {
-            return ResourceType::dhcp_options;
-          }
-          else if (hashCode == image_HASH)
-          {
-            return ResourceType::image;
-          }
-          else if (hashCode == instance_HASH)
-          {
-            return ResourceType::instance;
-          }
-          else if (hashCode == internet_gateway_HASH)
-          {
-            return ResourceType::internet_gateway;
-          }
-          else if (hashCode == network_acl_HASH)
-          {
-            return ResourceType::network_acl;
-          }
-          else if (hashCode == network_interface_HASH)
-          {
-            return ResourceType::network_interface;
-          }
-          else if (hashCode == reserved_instances_HASH)
-          {
-            return ResourceType::reserved_instances;
-          }
-          else if (hashCode == route_table_HASH)
-          {
-            return ResourceType::route_table;
-          }
-          else if (hashCode == snapshot_HASH)
-          {
-            return ResourceType::snapshot;
-          }
-          else if (hashCode == spot_instances_request_HASH)
-          {
-            return ResourceType::spot_instances_request;
-          }
-          else if (hashCode == subnet_HASH)
-          {
-            return ResourceType::subnet;
-          }
-          else if (hashCode == security_group_HASH)
-          {
-            return ResourceType::security_group;
-          }
-          else if (hashCode == volume_HASH)
-          {
-            return ResourceType::volume;
-          }
-          else if (hashCode == vpc_HASH)
-          {
-            return ResourceType::vpc;
-          }
-          else if (hashCode == vpn_connection_HASH)
-          {
-            return ResourceType::vpn_connection;
-          }
-          else if (hashCode == vpn_gateway_HASH)
-          {
-            return ResourceType::vpn_gateway;
+          case customer_gateway_HASH:
+            if (name == "customer-gateway")
+            {
+              return ResourceType::customer_gateway;
+            }
+            break;
+          case dhcp_options_HASH:
+            if (name == "dhcp-options")
+            {
+              return ResourceType::dhcp_options;
+            }
+            break;
+          case image_HASH:
+            if (name == "image")
+            {
+              return ResourceType::image;
+            }
+            break;
+          case instance_HASH:
+            if (name == "instance")
+            {
+              return ResourceType::instance;
+            }
+            break;
+          case internet_gateway_HASH:
+            if (name == "internet-gateway")
+            {
+              return ResourceType::internet_gateway;
+            }
+            break;
+          case network_acl_HASH:
+            if (name == "network-acl")
+            {
+              return ResourceType::network_acl;
+            }
+            break;
+          case network_interface_HASH:
+            if (name == "network-interface")
+            {
+              return ResourceType::network_interface;
+            }
+            break;
+          case reserved_instances_HASH:
+            if (name == "reserved-instances")
+            {
+              return ResourceType::reserved_instances;
+            }
+            break;
+          case route_table_HASH:
+            if (name == "route-table")
+            {
+              return ResourceType::route_table;
+            }
+            break;
+          case snapshot_HASH:
+            if (name == "snapshot")
+            {
+              return ResourceType::snapshot;
+            }
+            break;
+          case spot_instances_request_HASH:
+            if (name == "spot-instances-request")
+            {
+              return ResourceType::spot_instances_request;
+            }
+            break;
+          case subnet_HASH:
+            if (name == "subnet")
+            {
+              return ResourceType::subnet;
+            }
+            break;
+          case security_group_HASH:
+            if (name == "security-group")
+            {
+              return ResourceType::security_group;
+            }
+            break;
+          case volume_HASH:
+            if (name == "volume")
+            {
+              return ResourceType::volume;
+            }
+            break;
+          case vpc_HASH:
+            if (name == "vpc")
+            {
+              return ResourceType::vpc;
+            }
+            break;
+          case vpn_connection_HASH:
+            if (name == "vpn-connection")
+            {
+              return ResourceType::vpn_connection;
+            }
+            break;
+          case vpn_gateway_HASH:
+            if (name == "vpn-gateway")
+            {
+              return ResourceType::vpn_gateway;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,7 +170,7 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceType(ResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -172,7 +212,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace RouteOriginMapper
       {
 
-        static const int CreateRouteTable_HASH = HashingUtils::HashString("CreateRouteTable");
-        static const int CreateRoute_HASH = HashingUtils::HashString("CreateRoute");
-        static const int EnableVgwRoutePropagation_HASH = HashingUtils::HashString("EnableVgwRoutePropagation");
+        static constexpr int CreateRouteTable_HASH = HashingUtils::CompileTimeHashString("CreateRouteTable");
+        static constexpr int CreateRoute_HASH = HashingUtils::CompileTimeHashString("CreateRoute");
+        static constexpr int EnableVgwRoutePropagation_HASH = HashingUtils::CompileTimeHashString("EnableVgwRoutePropagation");
 
 
         RouteOrigin GetRouteOriginForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreateRouteTable_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RouteOrigin::CreateRouteTable;
-          }
-          else if (hashCode == CreateRoute_HASH)
-          {
-            return RouteOrigin::CreateRoute;
-          }
-          else if (hashCode == EnableVgwRoutePropagation_HASH)
-          {
-            return RouteOrigin::EnableVgwRoutePropagation;
+          case CreateRouteTable_HASH:
+            if (name == "CreateRouteTable")
+            {
+              return RouteOrigin::CreateRouteTable;
+            }
+            break;
+          case CreateRoute_HASH:
+            if (name == "CreateRoute")
+            {
+              return RouteOrigin::CreateRoute;
+            }
+            break;
+          case EnableVgwRoutePropagation_HASH:
+            if (name == "EnableVgwRoutePropagation")
+            {
+              return RouteOrigin::EnableVgwRoutePropagation;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RouteOrigin::NOT_SET;
         }
 
-        Aws::String GetNameForRouteOrigin(RouteOrigin enumValue)
+        const char* GetNameForRouteOrigin(RouteOrigin enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
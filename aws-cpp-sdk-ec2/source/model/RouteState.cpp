@@ -30,20 +30,30 @@ namespace Aws
       namespace RouteStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int blackhole_HASH = HashingUtils::HashString("blackhole");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int blackhole_HASH = HashingUtils::CompileTimeHashString("blackhole");
 
 
         RouteState GetRouteStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RouteState::active;
-          }
-          else if (hashCode == blackhole_HASH)
-          {
-            return RouteState::blackhole;
+          case active_HASH:
+            if (name == "active")
+            {
+              return RouteState::active;
+            }
+            break;
+          case blackhole_HASH:
+            if (name == "blackhole")
+            {
+              return RouteState::blackhole;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RouteState::NOT_SET;
         }
 
-        Aws::String GetNameForRouteState(RouteState enumValue)
+        const char* GetNameForRouteState(RouteState enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
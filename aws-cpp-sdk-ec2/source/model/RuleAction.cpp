@@ -30,20 +30,30 @@ namespace Aws
       namespace RuleActionMapper
       {
 
-        static const int allow_HASH = HashingUtils::HashString("allow");
-        static const int deny_HASH = HashingUtils::HashString("deny");
+        static constexpr int allow_HASH = HashingUtils::CompileTimeHashString("allow");
+        static constexpr int deny_HASH = HashingUtils::CompileTimeHashString("deny");
 
 
         RuleAction GetRuleActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == allow_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RuleAction::allow;
-          }
-          else if (hashCode == deny_HASH)
-          {
-            return RuleAction::deny;
+          case allow_HASH:
+            if (name == "allow")
+            {
+              return RuleAction::allow;
+            }
+            break;
+          case deny_HASH:
+            if (name == "deny")
+            {
+              return RuleAction::deny;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RuleAction::NOT_SET;
         }
 
-        Aws::String GetNameForRuleAction(RuleAction enumValue)
+        const char* GetNameForRuleAction(RuleAction enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
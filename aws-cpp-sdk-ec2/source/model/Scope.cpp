@@ -30,20 +30,30 @@ namespace Aws
       namespace ScopeMapper
       {
 
-        static const int Availability_Zone_HASH = HashingUtils::HashString("Availability Zone");
-        static const int Region_HASH = HashingUtils::HashString("Region");
+        static constexpr int Availability_Zone_HASH = HashingUtils::CompileTimeHashString("Availability Zone");
+        static constexpr int Region_HASH = HashingUtils::CompileTimeHashString("Region");
 
 
         Scope GetScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Availability_Zone_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Scope::Availability_Zone;
-          }
-          else if (hashCode == Region_HASH)
-          {
-            return Scope::Region;
+          case Availability_Zone_HASH:
+            if (name == "Availability Zone")
+            {
+              return Scope::Availability_Zone;
+            }
+            break;
+          case Region_HASH:
+            if (name == "Region")
+            {
+              return Scope::Region;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Scope::NOT_SET;
         }
 
-        Aws::String GetNameForScope(Scope enumValue)
+        const char* GetNameForScope(Scope enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace ServiceStateMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Available_HASH = HashingUtils::HashString("Available");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Available_HASH = HashingUtils::CompileTimeHashString("Available");
+        static constexpr int Deleting_HASH = HashingUtils::CompileTimeHashString("Deleting");
+        static constexpr int Deleted_HASH = HashingUtils::CompileTimeHashString("Deleted");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         ServiceState GetServiceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServiceState::Pending;
-          }
-          else if (hashCode == Available_HASH)
-          {
-            return ServiceState::Available;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return ServiceState::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return ServiceState::Deleted;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ServiceState::Failed;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return ServiceState::Pending;
+            }
+            break;
+          case Available_HASH:
+            if (name == "Available")
+            {
+              return ServiceState::Available;
+            }
+            break;
+          case Deleting_HASH:
+            if (name == "Deleting")
+            {
+              return ServiceState::Deleting;
+            }
+            break;
+          case Deleted_HASH:
+            if (name == "Deleted")
+            {
+              return ServiceState::Deleted;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return ServiceState::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ServiceState::NOT_SET;
         }
 
-        Aws::String GetNameForServiceState(ServiceState enumValue)
+        const char* GetNameForServiceState(ServiceState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ServiceTypeMapper
       {
 
-        static const int Interface_HASH = HashingUtils::HashString("Interface");
-        static const int Gateway_HASH = HashingUtils::HashString("Gateway");
+        static constexpr int Interface_HASH = HashingUtils::CompileTimeHashString("Interface");
+        static constexpr int Gateway_HASH = HashingUtils::CompileTimeHashString("Gateway");
 
 
         ServiceType GetServiceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Interface_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServiceType::Interface;
-          }
-          else if (hashCode == Gateway_HASH)
-          {
-            return ServiceType::Gateway;
+          case Interface_HASH:
+            if (name == "Interface")
+            {
+              return ServiceType::Interface;
+            }
+            break;
+          case Gateway_HASH:
+            if (name == "Gateway")
+            {
+              return ServiceType::Gateway;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ServiceType::NOT_SET;
         }
 
-        Aws::String GetNameForServiceType(ServiceType enumValue)
+        const char* GetNameForServiceType(ServiceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
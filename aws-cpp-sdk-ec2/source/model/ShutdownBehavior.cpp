@@ -30,20 +30,30 @@ namespace Aws
       namespace ShutdownBehaviorMapper
       {
 
-        static const int stop_HASH = HashingUtils::HashString("stop");
-        static const int terminate_HASH = HashingUtils::HashString("terminate");
+        static constexpr int stop_HASH = HashingUtils::CompileTimeHashString("stop");
+        static constexpr int terminate_HASH = HashingUtils::CompileTimeHashString("terminate");
 
 
         ShutdownBehavior GetShutdownBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == stop_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ShutdownBehavior::stop;
-          }
-          else if (hashCode == terminate_HASH)
-          {
-            return ShutdownBehavior::terminate;
+          case stop_HASH:
+            if (name == "stop")
+            {
+              return ShutdownBehavior::stop;
+            }
+            break;
+          case terminate_HASH:
+            if (name == "terminate")
+            {
+              return ShutdownBehavior::terminate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ShutdownBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForShutdownBehavior(ShutdownBehavior enumValue)
+        const char* GetNameForShutdownBehavior(ShutdownBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
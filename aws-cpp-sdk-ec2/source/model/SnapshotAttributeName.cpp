@@ -30,20 +30,30 @@ namespace Aws
       namespace SnapshotAttributeNameMapper
       {
 
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
-        static const int createVolumePermission_HASH = HashingUtils::HashString("createVolumePermission");
+        static constexpr int productCodes_HASH = HashingUtils::CompileTimeHashString("productCodes");
+        static constexpr int createVolumePermission_HASH = HashingUtils::CompileTimeHashString("createVolumePermission");
 
 
         SnapshotAttributeName GetSnapshotAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == productCodes_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SnapshotAttributeName::productCodes;
-          }
-          else if (hashCode == createVolumePermission_HASH)
-          {
-            return SnapshotAttributeName::createVolumePermission;
+          case productCodes_HASH:
+            if (name == "productCodes")
+            {
+              return SnapshotAttributeName::productCodes;
+            }
+            break;
+          case createVolumePermission_HASH:
+            if (name == "createVolumePermission")
+            {
+              return SnapshotAttributeName::createVolumePermission;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SnapshotAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForSnapshotAttributeName(SnapshotAttributeName enumValue)
+        const char* GetNameForSnapshotAttributeName(SnapshotAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
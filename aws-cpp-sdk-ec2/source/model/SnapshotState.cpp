@@ -30,25 +30,37 @@ namespace Aws
       namespace SnapshotStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-        static const int error_HASH = HashingUtils::HashString("error");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int completed_HASH = HashingUtils::CompileTimeHashString("completed");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
 
 
         SnapshotState GetSnapshotStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SnapshotState::pending;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return SnapshotState::completed;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return SnapshotState::error;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return SnapshotState::pending;
+            }
+            break;
+          case completed_HASH:
+            if (name == "completed")
+            {
+              return SnapshotState::completed;
+            }
+            break;
+          case error_HASH:
+            if (name == "error")
+            {
+              return SnapshotState::error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return SnapshotState::NOT_SET;
         }
 
-        Aws::String GetNameForSnapshotState(SnapshotState enumValue)
+        const char* GetNameForSnapshotState(SnapshotState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SpotAllocationStrategyMapper
       {
 
-        static const int lowest_price_HASH = HashingUtils::HashString("lowest-price");
-        static const int diversified_HASH = HashingUtils::HashString("diversified");
+        static constexpr int lowest_price_HASH = HashingUtils::CompileTimeHashString("lowest-price");
+        static constexpr int diversified_HASH = HashingUtils::CompileTimeHashString("diversified");
 
 
         SpotAllocationStrategy GetSpotAllocationStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == lowest_price_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SpotAllocationStrategy::lowest_price;
-          }
-          else if (hashCode == diversified_HASH)
-          {
-            return SpotAllocationStrategy::diversified;
+          case lowest_price_HASH:
+            if (name == "lowest-price")
+            {
+              return SpotAllocationStrategy::lowest_price;
+            }
+            break;
+          case diversified_HASH:
+            if (name == "diversified")
+            {
+              return SpotAllocationStrategy::diversified;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SpotAllocationStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForSpotAllocationStrategy(SpotAllocationStrategy enumValue)
+        const char* GetNameForSpotAllocationStrategy(SpotAllocationStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
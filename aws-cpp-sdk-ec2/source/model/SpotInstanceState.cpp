@@ -30,40 +30,58 @@ namespace Aws
       namespace SpotInstanceStateMapper
       {
 
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-        static const int cancelled_HASH = HashingUtils::HashString("cancelled");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
+        static constexpr int open_HASH = HashingUtils::CompileTimeHashString("open");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int closed_HASH = HashingUtils::CompileTimeHashString("closed");
+        static constexpr int cancelled_HASH = HashingUtils::CompileTimeHashString("cancelled");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int disabled_HASH = HashingUtils::CompileTimeHashString("disabled");
 
 
         SpotInstanceState GetSpotInstanceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == open_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SpotInstanceState::open;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return SpotInstanceState::active;
-          }
-          else if (hashCode == closed_HASH)
-          {
-            return SpotInstanceState::closed;
-          }
-          else if (hashCode == cancelled_HASH)
-          {
-            return SpotInstanceState::cancelled;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return SpotInstanceState::failed;
-          }
-          else if (hashCode == disabled_HASH)
-          {
-            return SpotInstanceState::disabled;
+          case open_HASH:
+            if (name == "open")
+            {
+              return SpotInstanceState::open;
+            }
+            break;
+          case active_HASH:
+            if (name == "active")
+            {
+              return SpotInstanceState::active;
+            }
+            break;
+          case closed_HASH:
+            if (name == "closed")
+            {
+              return SpotInstanceState::closed;
+            }
+            break;
+          case cancelled_HASH:
+            if (name == "cancelled")
+            {
+              return SpotInstanceState::cancelled;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return SpotInstanceState::failed;
+            }
+            break;
+          case disabled_HASH:
+            if (name == "disabled")
+            {
+              return SpotInstanceState::disabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return SpotInstanceState::NOT_SET;
         }
 
-        Aws::String GetNameForSpotInstanceState(SpotInstanceState enumValue)
+        const char* GetNameForSpotInstanceState(SpotInstanceState enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
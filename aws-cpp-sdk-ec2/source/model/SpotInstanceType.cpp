@@ -30,20 +30,30 @@ namespace Aws
       namespace SpotInstanceTypeMapper
       {
 
-        static const int one_time_HASH = HashingUtils::HashString("one-time");
-        static const int persistent_HASH = HashingUtils::HashString("persistent");
+        static constexpr int one_time_HASH = HashingUtils::CompileTimeHashString("one-time");
+        static constexpr int persistent_HASH = HashingUtils::CompileTimeHashString("persistent");
 
 
         SpotInstanceType GetSpotInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == one_time_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SpotInstanceType::one_time;
-          }
-          else if (hashCode == persistent_HASH)
-          {
-            return SpotInstanceType::persistent;
+          case one_time_HASH:
+            if (name == "one-time")
+            {
+              return SpotInstanceType::one_time;
+            }
+            break;
+          case persistent_HASH:
+            if (name == "persistent")
+            {
+              return SpotInstanceType::persistent;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SpotInstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForSpotInstanceType(SpotInstanceType enumValue)
+        const char* GetNameForSpotInstanceType(SpotInstanceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace StateMapper
       {
 
-        static const int PendingAcceptance_HASH = HashingUtils::HashString("PendingAcceptance");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Available_HASH = HashingUtils::HashString("Available");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
-        static const int Rejected_HASH = HashingUtils::HashString("Rejected");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Expired_HASH = HashingUtils::HashString("Expired");
+        static constexpr int PendingAcceptance_HASH = HashingUtils::CompileTimeHashString("PendingAcceptance");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Available_HASH = HashingUtils::CompileTimeHashString("Available");
+        static constexpr int Deleting_HASH = HashingUtils::CompileTimeHashString("Deleting");
+        static constexpr int Deleted_HASH = HashingUtils::CompileTimeHashString("Deleted");
+        static constexpr int Rejected_HASH = HashingUtils::CompileTimeHashString("Rejected");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Expired_HASH = HashingUtils::CompileTimeHashString("Expired");
 
 
         State GetStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PendingAcceptance_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return State::PendingAcceptance;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return State::Pending;
-          }
-          else if (hashCode == Available_HASH)
-          {
-            return State::Available;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return State::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return State::Deleted;
-          }
-          else if (hashCode == Rejected_HASH)
-          {
-            return State::Rejected;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return State::Failed;
-          }
-          else if (hashCode == Expired_HASH)
-          {
-            return State::Expired;
+          case PendingAcceptance_HASH:
+            if (name == "PendingAcceptance")
+            {
+              return State::PendingAcceptance;
+            }
+            break;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return State::Pending;
+            }
+            break;
+          case Available_HASH:
+            if (name == "Available")
+            {
+              return State::Available;
+            }
+            break;
+          case Deleting_HASH:
+            if (name == "Deleting")
+            {
+              return State::Deleting;
+            }
+            break;
+          case Deleted_HASH:
+            if (name == "Deleted")
+            {
+              return State::Deleted;
+            }
+            break;
+          case Rejected_HASH:
+            if (name == "Rejected")
+            {
+              return State::Rejected;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return State::Failed;
+            }
+            break;
+          case Expired_HASH:
+            if (name == "Expired")
+            {
+              return State::Expired;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return State::NOT_SET;
         }
 
-        Aws::String GetNameForState(State enumValue)
+        const char* GetNameForState(State enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
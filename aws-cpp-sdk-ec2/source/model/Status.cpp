@@ -30,25 +30,37 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int MoveInProgress_HASH = HashingUtils::HashString("MoveInProgress");
-        static const int InVpc_HASH = HashingUtils::HashString("InVpc");
-        static const int InClassic_HASH = HashingUtils::HashString("InClassic");
+        static constexpr int MoveInProgress_HASH = HashingUtils::CompileTimeHashString("MoveInProgress");
+        static constexpr int InVpc_HASH = HashingUtils::CompileTimeHashString("InVpc");
+        static constexpr int InClassic_HASH = HashingUtils::CompileTimeHashString("InClassic");
 
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MoveInProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Status::MoveInProgress;
-          }
-          else if (hashCode == InVpc_HASH)
-          {
-            return Status::InVpc;
-          }
-          else if (hashCode == InClassic_HASH)
-          {
-            return Status::InClassic;
+          case MoveInProgress_HASH:
+            if (name == "MoveInProgress")
+            {
+              return Status::MoveInProgress;
+            }
+            break;
+          case InVpc_HASH:
+            if (name == "InVpc")
+            {
+              return Status::InVpc;
+            }
+            break;
+          case InClassic_HASH:
+            if (name == "InClassic")
+            {
+              return Status::InClassic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatus(Status enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace StatusNameMapper
       {
 
-        static const int reachability_HASH = HashingUtils::HashString("reachability");
+        static constexpr int reachability_HASH = HashingUtils::CompileTimeHashString("reachability");
 
 
         StatusName GetStatusNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == reachability_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StatusName::reachability;
+          case reachability_HASH:
+            if (name == "reachability")
+            {
+              return StatusName::reachability;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return StatusName::NOT_SET;
         }
 
-        Aws::String GetNameForStatusName(StatusName enumValue)
+        const char* GetNameForStatusName(StatusName enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace StatusTypeMapper
       {
 
-        static const int passed_HASH = HashingUtils::HashString("passed");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int insufficient_data_HASH = HashingUtils::HashString("insufficient-data");
-        static const int initializing_HASH = HashingUtils::HashString("initializing");
+        static constexpr int passed_HASH = HashingUtils::CompileTimeHashString("passed");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int insufficient_data_HASH = HashingUtils::CompileTimeHashString("insufficient-data");
+        static constexpr int initializing_HASH = HashingUtils::CompileTimeHashString("initializing");
 
 
         StatusType GetStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == passed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StatusType::passed;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return StatusType::failed;
-          }
-          else if (hashCode == insufficient_data_HASH)
-          {
-            return StatusType::insufficient_data;
-          }
-          else if (hashCode == initializing_HASH)
-          {
-            return StatusType::initializing;
+          case passed_HASH:
+            if (name == "passed")
+            {
+              return StatusType::passed;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return StatusType::failed;
+            }
+            break;
+          case insufficient_data_HASH:
+            if (name == "insufficient-data")
+            {
+              return StatusType::insufficient_data;
+            }
+            break;
+          case initializing_HASH:
+            if (name == "initializing")
+            {
+              return StatusType::initializing;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return StatusType::NOT_SET;
         }
 
-        Aws::String GetNameForStatusType(StatusType enumValue)
+        const char* GetNameForStatusType(StatusType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
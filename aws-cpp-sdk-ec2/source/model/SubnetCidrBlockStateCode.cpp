@@ -30,40 +30,58 @@ namespace Aws
       namespace SubnetCidrBlockStateCodeMapper
       {
 
-        static const int associating_HASH = HashingUtils::HashString("associating");
-        static const int associated_HASH = HashingUtils::HashString("associated");
-        static const int disassociating_HASH = HashingUtils::HashString("disassociating");
-        static const int disassociated_HASH = HashingUtils::HashString("disassociated");
-        static const int failing_HASH = HashingUtils::HashString("failing");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        static constexpr int associating_HASH = HashingUtils::CompileTimeHashString("associating");
+        static constexpr int associated_HASH = HashingUtils::CompileTimeHashString("associated");
+        static constexpr int disassociating_HASH = HashingUtils::CompileTimeHashString("disassociating");
+        static constexpr int disassociated_HASH = HashingUtils::CompileTimeHashString("disassociated");
+        static constexpr int failing_HASH = HashingUtils::CompileTimeHashString("failing");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
 
 
         SubnetCidrBlockStateCode GetSubnetCidrBlockStateCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == associating_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SubnetCidrBlockStateCode::associating;
-          }
-          else if (hashCode == associated_HASH)
-          {
-            return SubnetCidrBlockStateCode::associated;
-          }
-          else if (hashCode == disassociating_HASH)
-          {
-            return SubnetCidrBlockStateCode::disassociating;
-          }
-          else if (hashCode == disassociated_HASH)
-          {
-            return SubnetCidrBlockStateCode::disassociated;
-          }
-          else if (hashCode == failing_HASH)
-          {
-            return SubnetCidrBlockStateCode::failing;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return SubnetCidrBlockStateCode::failed;
+          case associating_HASH:
+            if (name == "associating")
+            {
+              return SubnetCidrBlockStateCode::associating;
+            }
+            break;
+          case associated_HASH:
+            if (name == "associated")
+            {
+              return SubnetCidrBlockStateCode::associated;
+            }
+            break;
+          case disassociating_HASH:
+            if (name == "disassociating")
+            {
+              return SubnetCidrBlockStateCode::disassociating;
+            }
+            break;
+          case disassociated_HASH:
+            if (name == "disassociated")
+            {
+              return SubnetCidrBlockStateCode::disassociated;
+            }
+            break;
+          case failing_HASH:
+            if (name == "failing")
+            {
+              return SubnetCidrBlockStateCode::failing;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return SubnetCidrBlockStateCode::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return SubnetCidrBlockStateCode::NOT_SET;
         }
 
-        Aws::String GetNameForSubnetCidrBlockStateCode(SubnetCidrBlockStateCode enumValue)
+        const char* GetNameForSubnetCidrBlockStateCode(SubnetCidrBlockStateCode enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
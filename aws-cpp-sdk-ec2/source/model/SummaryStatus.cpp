@@ -30,35 +30,51 @@ namespace Aws
       namespace SummaryStatusMapper
       {
 
-        static const int ok_HASH = HashingUtils::HashString("ok");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-        static const int insufficient_data_HASH = HashingUtils::HashString("insufficient-data");
-        static const int not_applicable_HASH = HashingUtils::HashString("not-applicable");
-        static const int initializing_HASH = HashingUtils::HashString("initializing");
+        static constexpr int ok_HASH = HashingUtils::CompileTimeHashString("ok");
+        static constexpr int impaired_HASH = HashingUtils::CompileTimeHashString("impaired");
+        static constexpr int insufficient_data_HASH = HashingUtils::CompileTimeHashString("insufficient-data");
+        static constexpr int not_applicable_HASH = HashingUtils::CompileTimeHashString("not-applicable");
+        static constexpr int initializing_HASH = HashingUtils::CompileTimeHashString("initializing");
 
 
         SummaryStatus GetSummaryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ok_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SummaryStatus::ok;
-          }
-          else if (hashCode == impaired_HASH)
-          {
-            return SummaryStatus::impaired;
-          }
-          else if (hashCode == insufficient_data_HASH)
-          {
-            return SummaryStatus::insufficient_data;
-          }
-          else if (hashCode == not_applicable_HASH)
-          {
-            return SummaryStatus::not_applicable;
-          }
-          else if (hashCode == initializing_HASH)
-          {
-            return SummaryStatus::initializing;
+          case ok_HASH:
+            if (name == "ok")
+            {
+              return SummaryStatus::ok;
+            }
+            break;
+          case impaired_HASH:
+            if (name == "impaired")
+            {
+              return SummaryStatus::impaired;
+            }
+            break;
+          case insufficient_data_HASH:
+            if (name == "insufficient-data")
+            {
+              return SummaryStatus::insufficient_data;
+            }
+            break;
+          case not_applicable_HASH:
+            if (name == "not-applicable")
+            {
+              return SummaryStatus::not_applicable;
+            }
+            break;
+          case initializing_HASH:
+            if (name == "initializing")
+            {
+              return SummaryStatus::initializing;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return SummaryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSummaryStatus(SummaryStatus enumValue)
+        const char* GetNameForSummaryStatus(SummaryStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace TelemetryStatusMapper
       {
 
-        static const int UP_HASH = HashingUtils::HashString("UP");
-        static const int DOWN_HASH = HashingUtils::HashString("DOWN");
+        static constexpr int UP_HASH = HashingUtils::CompileTimeHashString("UP");
+        static constexpr int DOWN_HASH = HashingUtils::CompileTimeHashString("DOWN");
 
 
         TelemetryStatus GetTelemetryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TelemetryStatus::UP;
-          }
-          else if (hashCode == DOWN_HASH)
-          {
-            return TelemetryStatus::DOWN;
+          case UP_HASH:
+            if (name == "UP")
+            {
+              return TelemetryStatus::UP;
+            }
+            break;
+          case DOWN_HASH:
+            if (name == "DOWN")
+            {
+              return TelemetryStatus::DOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TelemetryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTelemetryStatus(TelemetryStatus enumValue)
+        const char* GetNameForTelemetryStatus(TelemetryStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace TenancyMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
-        static const int dedicated_HASH = HashingUtils::HashString("dedicated");
-        static const int host_HASH = HashingUtils::HashString("host");
+        static constexpr int default__HASH = HashingUtils::CompileTimeHashString("default");
+        static constexpr int dedicated_HASH = HashingUtils::CompileTimeHashString("dedicated");
+        static constexpr int host_HASH = HashingUtils::CompileTimeHashString("host");
 
 
         Tenancy GetTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Tenancy::default_;
-          }
-          else if (hashCode == dedicated_HASH)
-          {
-            return Tenancy::dedicated;
-          }
-          else if (hashCode == host_HASH)
-          {
-            return Tenancy::host;
+          case default__HASH:
+            if (name == "default")
+            {
+              return Tenancy::default_;
+            }
+            break;
+          case dedicated_HASH:
+            if (name == "dedicated")
+            {
+              return Tenancy::dedicated;
+            }
+            break;
+          case host_HASH:
+            if (name == "host")
+            {
+              return Tenancy::host;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Tenancy::NOT_SET;
         }
 
-        Aws::String GetNameForTenancy(Tenancy enumValue)
+        const char* GetNameForTenancy(Tenancy enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
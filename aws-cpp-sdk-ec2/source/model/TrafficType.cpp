@@ -30,25 +30,37 @@ namespace Aws
       namespace TrafficTypeMapper
       {
 
-        static const int ACCEPT_HASH = HashingUtils::HashString("ACCEPT");
-        static const int REJECT_HASH = HashingUtils::HashString("REJECT");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        static constexpr int ACCEPT_HASH = HashingUtils::CompileTimeHashString("ACCEPT");
+        static constexpr int REJECT_HASH = HashingUtils::CompileTimeHashString("REJECT");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
 
 
         TrafficType GetTrafficTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCEPT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TrafficType::ACCEPT;
-          }
-          else if (hashCode == REJECT_HASH)
-          {
-            return TrafficType::REJECT;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return TrafficType::ALL;
+          case ACCEPT_HASH:
+            if (name == "ACCEPT")
+            {
+              return TrafficType::ACCEPT;
+            }
+            break;
+          case REJECT_HASH:
+            if (name == "REJECT")
+            {
+              return TrafficType::REJECT;
+            }
+            break;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return TrafficType::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TrafficType::NOT_SET;
         }
 
-        Aws::String GetNameForTrafficType(TrafficType enumValue)
+        const char* GetNameForTrafficType(TrafficType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
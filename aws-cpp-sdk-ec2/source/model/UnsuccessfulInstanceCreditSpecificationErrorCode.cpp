@@ -30,30 +30,44 @@ namespace Aws
       namespace UnsuccessfulInstanceCreditSpecificationErrorCodeMapper
       {
 
-        static const int InvalidInstanceID_Malformed_HASH = HashingUtils::HashString("InvalidInstanceID.Malformed");
-        static const int InvalidInstanceID_NotFound_HASH = HashingUtils::HashString("InvalidInstanceID.NotFound");
-        static const int IncorrectInstanceState_HASH = HashingUtils::HashString("IncorrectInstanceState");
-        static const int InstanceCreditSpecification_NotSupported_HASH = HashingUtils::HashString("InstanceCreditSpecification.NotSupported");
+        static constexpr int InvalidInstanceID_Malformed_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceID.Malformed");
+        static constexpr int InvalidInstanceID_NotFound_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceID.NotFound");
+        static constexpr int IncorrectInstanceState_HASH = HashingUtils::CompileTimeHashString("IncorrectInstanceState");
+        static constexpr int InstanceCreditSpecification_NotSupported_HASH = HashingUtils::CompileTimeHashString("InstanceCreditSpecification.NotSupported");
 
 
         UnsuccessfulInstanceCreditSpecificationErrorCode GetUnsuccessfulInstanceCreditSpecificationErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvalidInstanceID_Malformed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_Malformed;
-          }
-          else if (hashCode == InvalidInstanceID_NotFound_HASH)
-          {
-            return UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_NotFound;
-          }
-          else if (hashCode == IncorrectInstanceState_HASH)
-          {
-            return UnsuccessfulInstanceCreditSpecificationErrorCode::IncorrectInstanceState;
-          }
-          else if (hashCode == InstanceCreditSpecification_NotSupported_HASH)
-          {
-            return UnsuccessfulInstanceCreditSpecificationErrorCode::InstanceCreditSpecification_NotSupported;
+          case InvalidInstanceID_Malformed_HASH:
+            if (name == "InvalidInstanceID.Malformed")
+            {
+              return UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_Malformed;
+            }
+            break;
+          case InvalidInstanceID_NotFound_HASH:
+            if (name == "InvalidInstanceID.NotFound")
+            {
+              return UnsuccessfulInstanceCreditSpecificationErrorCode::InvalidInstanceID_NotFound;
+            }
+            break;
+          case IncorrectInstanceState_HASH:
+            if (name == "IncorrectInstanceState")
+            {
+              return UnsuccessfulInstanceCreditSpecificationErrorCode::IncorrectInstanceState;
+            }
+            break;
+          case InstanceCreditSpecification_NotSupported_HASH:
+            if (name == "InstanceCreditSpecification.NotSupported")
+            {
+              return UnsuccessfulInstanceCreditSpecificationErrorCode::InstanceCreditSpecification_NotSupported;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return UnsuccessfulInstanceCreditSpecificationErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForUnsuccessfulInstanceCreditSpecificationErrorCode(UnsuccessfulInstanceCreditSpecificationErrorCode enumValue)
+        const char* GetNameForUnsuccessfulInstanceCreditSpecificationErrorCode(UnsuccessfulInstanceCreditSpecificationErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace VirtualizationTypeMapper
       {
 
-        static const int hvm_HASH = HashingUtils::HashString("hvm");
-        static const int paravirtual_HASH = HashingUtils::HashString("paravirtual");
+        static constexpr int hvm_HASH = HashingUtils::CompileTimeHashString("hvm");
+        static constexpr int paravirtual_HASH = HashingUtils::CompileTimeHashString("paravirtual");
 
 
         VirtualizationType GetVirtualizationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == hvm_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VirtualizationType::hvm;
-          }
-          else if (hashCode == paravirtual_HASH)
-          {
-            return VirtualizationType::paravirtual;
+          case hvm_HASH:
+            if (name == "hvm")
+            {
+              return VirtualizationType::hvm;
+            }
+            break;
+          case paravirtual_HASH:
+            if (name == "paravirtual")
+            {
+              return VirtualizationType::paravirtual;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return VirtualizationType::NOT_SET;
         }
 
-        Aws::String GetNameForVirtualizationType(VirtualizationType enumValue)
+        const char* GetNameForVirtualizationType(VirtualizationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
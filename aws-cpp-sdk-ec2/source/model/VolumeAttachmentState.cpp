@@ -30,35 +30,51 @@ namespace Aws
       namespace VolumeAttachmentStateMapper
       {
 
-        static const int attaching_HASH = HashingUtils::HashString("attaching");
-        static const int attached_HASH = HashingUtils::HashString("attached");
-        static const int detaching_HASH = HashingUtils::HashString("detaching");
-        static const int detached_HASH = HashingUtils::HashString("detached");
-        static const int busy_HASH = HashingUtils::HashString("busy");
+        static constexpr int attaching_HASH = HashingUtils::CompileTimeHashString("attaching");
+        static constexpr int attached_HASH = HashingUtils::CompileTimeHashString("attached");
+        static constexpr int detaching_HASH = HashingUtils::CompileTimeHashString("detaching");
+        static constexpr int detached_HASH = HashingUtils::CompileTimeHashString("detached");
+        static constexpr int busy_HASH = HashingUtils::CompileTimeHashString("busy");
 
 
         VolumeAttachmentState GetVolumeAttachmentStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == attaching_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VolumeAttachmentState::attaching;
-          }
-          else if (hashCode == attached_HASH)
-          {
-            return VolumeAttachmentState::attached;
-          }
-          else if (hashCode == detaching_HASH)
-          {
-            return VolumeAttachmentState::detaching;
-          }
-          else if (hashCode == detached_HASH)
-          {
-            return VolumeAttachmentState::detached;
-          }
-          else if (hashCode == busy_HASH)
-          {
-            return VolumeAttachmentState::busy;
+          case attaching_HASH:
+            if (name == "attaching")
+            {
+              return VolumeAttachmentState::attaching;
+            }
+            break;
+          case attached_HASH:
+            if (name == "attached")
+            {
+              return VolumeAttachmentState::attached;
+            }
+            break;
+          case detaching_HASH:
+            if (name == "detaching")
+            {
+              return VolumeAttachmentState::detaching;
+            }
+            break;
+          case detached_HASH:
+            if (name == "detached")
+            {
+              return VolumeAttachmentState::detached;
+            }
+            break;
+          case busy_HASH:
+            if (name == "busy")
+            {
+              return VolumeAttachmentState::busy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return VolumeAttachmentState::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeAttachmentState(VolumeAttachmentState enumValue)
+        const char* GetNameForVolumeAttachmentState(VolumeAttachmentState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
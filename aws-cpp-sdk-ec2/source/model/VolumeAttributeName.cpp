@@ -30,20 +30,30 @@ namespace Aws
       namespace VolumeAttributeNameMapper
       {
 
-        static const int autoEnableIO_HASH = HashingUtils::HashString("autoEnableIO");
-        static const int productCodes_HASH = HashingUtils::HashString("productCodes");
+        static constexpr int autoEnableIO_HASH = HashingUtils::CompileTimeHashString("autoEnableIO");
+        static constexpr int productCodes_HASH = HashingUtils::CompileTimeHashString("productCodes");
 
 
         VolumeAttributeName GetVolumeAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == autoEnableIO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VolumeAttributeName::autoEnableIO;
-          }
-          else if (hashCode == productCodes_HASH)
-          {
-            return VolumeAttributeName::productCodes;
+          case autoEnableIO_HASH:
+            if (name == "autoEnableIO")
+            {
+              return VolumeAttributeName::autoEnableIO;
+            }
+            break;
+          case productCodes_HASH:
+            if (name == "productCodes")
+            {
+              return VolumeAttributeName::productCodes;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return VolumeAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeAttributeName(VolumeAttributeName enumValue)
+        const char* GetNameForVolumeAttributeName(VolumeAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace VolumeModificationStateMapper
       {
 
-        static const int modifying_HASH = HashingUtils::HashString("modifying");
-        static const int optimizing_HASH = HashingUtils::HashString("optimizing");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        static constexpr int modifying_HASH = HashingUtils::CompileTimeHashString("modifying");
+        static constexpr int optimizing_HASH = HashingUtils::CompileTimeHashString("optimizing");
+        static constexpr int completed_HASH = HashingUtils::CompileTimeHashString("completed");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
 
 
         VolumeModificationState GetVolumeModificationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == modifying_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VolumeModificationState::modifying;
-          }
-          else if (hashCode == optimizing_HASH)
-          {
-            return VolumeModificationState::optimizing;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return VolumeModificationState::completed;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return VolumeModificationState::failed;
+          case modifying_HASH:
+            if (name == "modifying")
+            {
+              return VolumeModificationState::modifying;
+            }
+            break;
+          case optimizing_HASH:
+            if (name == "optimizing")
+            {
+              return VolumeModificationState::optimizing;
+            }
+            break;
+          case completed_HASH:
+            if (name == "completed")
+            {
+              return VolumeModificationState::completed;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return VolumeModificationState::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return VolumeModificationState::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeModificationState(VolumeModificationState enumValue)
+        const char* GetNameForVolumeModificationState(VolumeModificationState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace VolumeStateMapper
       {
 
-        static const int creating_HASH = HashingUtils::HashString("creating");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int in_use_HASH = HashingUtils::HashString("in-use");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int error_HASH = HashingUtils::HashString("error");
+        static constexpr int creating_HASH = HashingUtils::CompileTimeHashString("creating");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int in_use_HASH = HashingUtils::CompileTimeHashString("in-use");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
 
 
         VolumeState GetVolumeStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == creating_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VolumeState::creating;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return VolumeState::available;
-          }
-          else if (hashCode == in_use_HASH)
-          {
-            return VolumeState::in_use;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return VolumeState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return VolumeState::deleted;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return VolumeState::error;
+          case creating_HASH:
+            if (name == "creating")
+            {
+              return VolumeState::creating;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return VolumeState::available;
+            }
+            break;
+          case in_use_HASH:
+            if (name == "in-use")
+            {
+              return VolumeState::in_use;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return VolumeState::deleting;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return VolumeState::deleted;
+            }
+            break;
+          case error_HASH:
+            if (name == "error")
+            {
+              return VolumeState::error;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return VolumeState::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeState(VolumeState enumValue)
+        const char* GetNameForVolumeState(VolumeState enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
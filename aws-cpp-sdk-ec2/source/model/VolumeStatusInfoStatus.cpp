@@ -30,25 +30,37 @@ namespace Aws
       namespace VolumeStatusInfoStatusMapper
       {
 
-        static const int ok_HASH = HashingUtils::HashString("ok");
-        static const int impaired_HASH = HashingUtils::HashString("impaired");
-        static const int insufficient_data_HASH = HashingUtils::HashString("insufficient-data");
+        static constexpr int ok_HASH = HashingUtils::CompileTimeHashString("ok");
+        static constexpr int impaired_HASH = HashingUtils::CompileTimeHashString("impaired");
+        static constexpr int insufficient_data_HASH = HashingUtils::CompileTimeHashString("insufficient-data");
 
 
         VolumeStatusInfoStatus GetVolumeStatusInfoStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ok_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VolumeStatusInfoStatus::ok;
-          }
-          else if (hashCode == impaired_HASH)
-          {
-            return VolumeStatusInfoStatus::impaired;
-          }
-          else if (hashCode == insufficient_data_HASH)
-          {
-            return VolumeStatusInfoStatus::insufficient_data;
+          case ok_HASH:
+            if (name == "ok")
+            {
+              return VolumeStatusInfoStatus::ok;
+            }
+            break;
+          case impaired_HASH:
+            if (name == "impaired")
+            {
+              return VolumeStatusInfoStatus::impaired;
+            }
+            break;
+          case insufficient_data_HASH:
+            if (name == "insufficient-data")
+            {
+              return VolumeStatusInfoStatus::insufficient_data;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return VolumeStatusInfoStatus::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeStatusInfoStatus(VolumeStatusInfoStatus enumValue)
+        const char* GetNameForVolumeStatusInfoStatus(VolumeStatusInfoStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
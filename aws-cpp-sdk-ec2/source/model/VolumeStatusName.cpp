@@ -30,20 +30,30 @@ namespace Aws
       namespace VolumeStatusNameMapper
       {
 
-        static const int io_enabled_HASH = HashingUtils::HashString("io-enabled");
-        static const int io_performance_HASH = HashingUtils::HashString("io-performance");
+        static constexpr int io_enabled_HASH = HashingUtils::CompileTimeHashString("io-enabled");
+        static constexpr int io_performance_HASH = HashingUtils::CompileTimeHashString("io-performance");
 
 
         VolumeStatusName GetVolumeStatusNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == io_enabled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VolumeStatusName::io_enabled;
-          }
-          else if (hashCode == io_performance_HASH)
-          {
-            return VolumeStatusName::io_performance;
+          case io_enabled_HASH:
+            if (name == "io-enabled")
+            {
+              return VolumeStatusName::io_enabled;
+            }
+            break;
+          case io_performance_HASH:
+            if (name == "io-performance")
+            {
+              return VolumeStatusName::io_performance;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return VolumeStatusName::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeStatusName(VolumeStatusName enumValue)
+        const char* GetNameForVolumeStatusName(VolumeStatusName enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
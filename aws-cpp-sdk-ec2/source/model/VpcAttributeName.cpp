@@ -30,20 +30,30 @@ namespace Aws
       namespace VpcAttributeNameMapper
       {
 
-        static const int enableDnsSupport_HASH = HashingUtils::HashString("enableDnsSupport");
-        static const int enableDnsHostnames_HASH = HashingUtils::HashString("enableDnsHostnames");
+        static constexpr int enableDnsSupport_HASH = HashingUtils::CompileTimeHashString("enableDnsSupport");
+        static constexpr int enableDnsHostnames_HASH = HashingUtils::CompileTimeHashString("enableDnsHostnames");
 
 
         VpcAttributeName GetVpcAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enableDnsSupport_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VpcAttributeName::enableDnsSupport;
-          }
-          else if (hashCode == enableDnsHostnames_HASH)
-          {
-            return VpcAttributeName::enableDnsHostnames;
+          case enableDnsSupport_HASH:
+            if (name == "enableDnsSupport")
+            {
+              return VpcAttributeName::enableDnsSupport;
+            }
+            break;
+          case enableDnsHostnames_HASH:
+            if (name == "enableDnsHostnames")
+            {
+              return VpcAttributeName::enableDnsHostnames;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return VpcAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForVpcAttributeName(VpcAttributeName enumValue)
+        const char* GetNameForVpcAttributeName(VpcAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,55 +30,79 @@ namespace Aws
       namespace VpcPeeringConnectionStateReasonCodeMapper
       {
 
-        static const int initiating_request_HASH = HashingUtils::HashString("initiating-request");
-        static const int pending_acceptance_HASH = HashingUtils::HashString("pending-acceptance");
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
-        static const int rejected_HASH = HashingUtils::HashString("rejected");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int expired_HASH = HashingUtils::HashString("expired");
-        static const int provisioning_HASH = HashingUtils::HashString("provisioning");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
+        static constexpr int initiating_request_HASH = HashingUtils::CompileTimeHashString("initiating-request");
+        static constexpr int pending_acceptance_HASH = HashingUtils::CompileTimeHashString("pending-acceptance");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
+        static constexpr int rejected_HASH = HashingUtils::CompileTimeHashString("rejected");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int expired_HASH = HashingUtils::CompileTimeHashString("expired");
+        static constexpr int provisioning_HASH = HashingUtils::CompileTimeHashString("provisioning");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
 
 
         VpcPeeringConnectionStateReasonCode GetVpcPeeringConnectionStateReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == initiating_request_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VpcPeeringConnectionStateReasonCode::initiating_request;
-          }
-          else if (hashCode == pending_acceptance_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::pending_acceptance;
-          }
-          else if (hashCode == active_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::active;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::deleted;
-          }
-          else if (hashCode == rejected_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::rejected;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::failed;
-          }
-          else if (hashCode == expired_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::expired;
-          }
-          else if (hashCode == provisioning_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::provisioning;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return VpcPeeringConnectionStateReasonCode::deleting;
+          case initiating_request_HASH:
+            if (name == "initiating-request")
+            {
+              return VpcPeeringConnectionStateReasonCode::initiating_request;
+            }
+            break;
+          case pending_acceptance_HASH:
+            if (name == "pending-acceptance")
+            {
+              return VpcPeeringConnectionStateReasonCode::pending_acceptance;
+            }
+            break;
+          case active_HASH:
+            if (name == "active")
+            {
+              return VpcPeeringConnectionStateReasonCode::active;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return VpcPeeringConnectionStateReasonCode::deleted;
+            }
+            break;
+          case rejected_HASH:
+            if (name == "rejected")
+            {
+              return VpcPeeringConnectionStateReasonCode::rejected;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return VpcPeeringConnectionStateReasonCode::failed;
+            }
+            break;
+          case expired_HASH:
+            if (name == "expired")
+            {
+              return VpcPeeringConnectionStateReasonCode::expired;
+            }
+            break;
+          case provisioning_HASH:
+            if (name == "provisioning")
+            {
+              return VpcPeeringConnectionStateReasonCode::provisioning;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return VpcPeeringConnectionStateReasonCode::deleting;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return VpcPeeringConnectionStateReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForVpcPeeringConnectionStateReasonCode(VpcPeeringConnectionStateReasonCode enumValue)
+        const char* GetNameForVpcPeeringConnectionStateReasonCode(VpcPeeringConnectionStateReasonCode enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace VpcStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
 
 
         VpcState GetVpcStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VpcState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return VpcState::available;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return VpcState::pending;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return VpcState::available;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return VpcState::NOT_SET;
         }
 
-        Aws::String GetNameForVpcState(VpcState enumValue)
+        const char* GetNameForVpcState(VpcState enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace VpcTenancyMapper
       {
 
-        static const int default__HASH = HashingUtils::HashString("default");
+        static constexpr int default__HASH = HashingUtils::CompileTimeHashString("default");
 
 
         VpcTenancy GetVpcTenancyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == default__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VpcTenancy::default_;
+          case default__HASH:
+            if (name == "default")
+            {
+              return VpcTenancy::default_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return VpcTenancy::NOT_SET;
         }
 
-        Aws::String GetNameForVpcTenancy(VpcTenancy enumValue)
+        const char* GetNameForVpcTenancy(VpcTenancy enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
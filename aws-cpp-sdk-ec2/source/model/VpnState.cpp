@@ -30,30 +30,44 @@ namespace Aws
       namespace VpnStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
 
 
         VpnState GetVpnStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VpnState::pending;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return VpnState::available;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return VpnState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return VpnState::deleted;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return VpnState::pending;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return VpnState::available;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return VpnState::deleting;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return VpnState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return VpnState::NOT_SET;
         }
 
-        Aws::String GetNameForVpnState(VpnState enumValue)
+        const char* GetNameForVpnState(VpnState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace VpnStaticRouteSourceMapper
       {
 
-        static const int Static_HASH = HashingUtils::HashString("Static");
+        static constexpr int Static_HASH = HashingUtils::CompileTimeHashString("Static");
 
 
         VpnStaticRouteSource GetVpnStaticRouteSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Static_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VpnStaticRouteSource::Static;
+          case Static_HASH:
+            if (name == "Static")
+            {
+              return VpnStaticRouteSource::Static;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return VpnStaticRouteSource::NOT_SET;
         }
 
-        Aws::String GetNameForVpnStaticRouteSource(VpnStaticRouteSource enumValue)
+        const char* GetNameForVpnStaticRouteSource(VpnStaticRouteSource enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -33,7 +33,8 @@ namespace ImageActionTypeMapper
 {
 AWS_ECR_API ImageActionType GetImageActionTypeForName(const Aws::String& name);
 
-AWS_ECR_API Aws::String GetNameForImageActionType(ImageActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_ECR_API const char* GetNameForImageActionType(ImageActionType value);
 } // namespace ImageActionTypeMapper
 } // namespace Model
 } // namespace ECR
@@ -37,7 +37,8 @@ namespace ImageFailureCodeMapper
 {
 AWS_ECR_API ImageFailureCode GetImageFailureCodeForName(const Aws::String& name);
 
-AWS_ECR_API Aws::String GetNameForImageFailureCode(ImageFailureCode value);
+// names of values not modeled point into the enum overflow container
+AWS_ECR_API const char* GetNameForImageFailureCode(ImageFailureCode value);
 } // namespace ImageFailureCodeMapper
 } // namespace Model
 } // namespace ECR
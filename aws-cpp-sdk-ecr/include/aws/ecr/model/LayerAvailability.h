@@ -34,7 +34,8 @@ namespace LayerAvailabilityMapper
 {
 AWS_ECR_API LayerAvailability GetLayerAvailabilityForName(const Aws::String& name);
 
-AWS_ECR_API Aws::String GetNameForLayerAvailability(LayerAvailability value);
+// names of values not modeled point into the enum overflow container
+AWS_ECR_API const char* GetNameForLayerAvailability(LayerAvailability value);
 } // namespace LayerAvailabilityMapper
 } // namespace Model
 } // namespace ECR
@@ -34,7 +34,8 @@ namespace LayerFailureCodeMapper
 {
 AWS_ECR_API LayerFailureCode GetLayerFailureCodeForName(const Aws::String& name);
 
-AWS_ECR_API Aws::String GetNameForLayerFailureCode(LayerFailureCode value);
+// names of values not modeled point into the enum overflow container
+AWS_ECR_API const char* GetNameForLayerFailureCode(LayerFailureCode value);
 } // namespace LayerFailureCodeMapper
 } // namespace Model
 } // namespace ECR
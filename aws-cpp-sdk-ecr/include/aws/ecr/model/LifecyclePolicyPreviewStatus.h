@@ -36,7 +36,8 @@ namespace LifecyclePolicyPreviewStatusMapper
 {
 AWS_ECR_API LifecyclePolicyPreviewStatus GetLifecyclePolicyPreviewStatusForName(const Aws::String& name);
 
-AWS_ECR_API Aws::String GetNameForLifecyclePolicyPreviewStatus(LifecyclePolicyPreviewStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ECR_API const char* GetNameForLifecyclePolicyPreviewStatus(LifecyclePolicyPreviewStatus value);
 } // namespace LifecyclePolicyPreviewStatusMapper
 } // namespace Model
 } // namespace ECR
@@ -34,7 +34,8 @@ namespace TagStatusMapper
 {
 AWS_ECR_API TagStatus GetTagStatusForName(const Aws::String& name);
 
-AWS_ECR_API Aws::String GetNameForTagStatus(TagStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ECR_API const char* GetNameForTagStatus(TagStatus value);
 } // namespace TagStatusMapper
 } // namespace Model
 } // namespace ECR
@@ -28,26 +28,26 @@ namespace ECR
 namespace ECRErrorMapper
 {
 
-static const int LAYERS_NOT_FOUND_HASH = HashingUtils::HashString("LayersNotFoundException");
-static const int SERVER_HASH = HashingUtils::HashString("ServerException");
-static const int INVALID_LAYER_HASH = HashingUtils::HashString("InvalidLayerException");
-static const int INVALID_LAYER_PART_HASH = HashingUtils::HashString("InvalidLayerPartException");
-static const int REPOSITORY_NOT_FOUND_HASH = HashingUtils::HashString("RepositoryNotFoundException");
-static const int LAYER_PART_TOO_SMALL_HASH = HashingUtils::HashString("LayerPartTooSmallException");
-static const int REPOSITORY_NOT_EMPTY_HASH = HashingUtils::HashString("RepositoryNotEmptyException");
-static const int REPOSITORY_ALREADY_EXISTS_HASH = HashingUtils::HashString("RepositoryAlreadyExistsException");
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int LIFECYCLE_POLICY_NOT_FOUND_HASH = HashingUtils::HashString("LifecyclePolicyNotFoundException");
-static const int LIFECYCLE_POLICY_PREVIEW_IN_PROGRESS_HASH = HashingUtils::HashString("LifecyclePolicyPreviewInProgressException");
-static const int EMPTY_UPLOAD_HASH = HashingUtils::HashString("EmptyUploadException");
-static const int LIFECYCLE_POLICY_PREVIEW_NOT_FOUND_HASH = HashingUtils::HashString("LifecyclePolicyPreviewNotFoundException");
-static const int IMAGE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ImageAlreadyExistsException");
-static const int LAYER_INACCESSIBLE_HASH = HashingUtils::HashString("LayerInaccessibleException");
-static const int REPOSITORY_POLICY_NOT_FOUND_HASH = HashingUtils::HashString("RepositoryPolicyNotFoundException");
-static const int LAYER_ALREADY_EXISTS_HASH = HashingUtils::HashString("LayerAlreadyExistsException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int IMAGE_NOT_FOUND_HASH = HashingUtils::HashString("ImageNotFoundException");
-static const int UPLOAD_NOT_FOUND_HASH = HashingUtils::HashString("UploadNotFoundException");
+static constexpr int LAYERS_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("LayersNotFoundException");
+static constexpr int SERVER_HASH = HashingUtils::CompileTimeHashString("ServerException");
+static constexpr int INVALID_LAYER_HASH = HashingUtils::CompileTimeHashString("InvalidLayerException");
+static constexpr int INVALID_LAYER_PART_HASH = HashingUtils::CompileTimeHashString("InvalidLayerPartException");
+static constexpr int REPOSITORY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("RepositoryNotFoundException");
+static constexpr int LAYER_PART_TOO_SMALL_HASH = HashingUtils::CompileTimeHashString("LayerPartTooSmallException");
+static constexpr int REPOSITORY_NOT_EMPTY_HASH = HashingUtils::CompileTimeHashString("RepositoryNotEmptyException");
+static constexpr int REPOSITORY_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("RepositoryAlreadyExistsException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int LIFECYCLE_POLICY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("LifecyclePolicyNotFoundException");
+static constexpr int LIFECYCLE_POLICY_PREVIEW_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("LifecyclePolicyPreviewInProgressException");
+static constexpr int EMPTY_UPLOAD_HASH = HashingUtils::CompileTimeHashString("EmptyUploadException");
+static constexpr int LIFECYCLE_POLICY_PREVIEW_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("LifecyclePolicyPreviewNotFoundException");
+static constexpr int IMAGE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ImageAlreadyExistsException");
+static constexpr int LAYER_INACCESSIBLE_HASH = HashingUtils::CompileTimeHashString("LayerInaccessibleException");
+static constexpr int REPOSITORY_POLICY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("RepositoryPolicyNotFoundException");
+static constexpr int LAYER_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("LayerAlreadyExistsException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int IMAGE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ImageNotFoundException");
+static constexpr int UPLOAD_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("UploadNotFoundException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,15 +30,23 @@ namespace Aws
       namespace ImageActionTypeMapper
       {
 
-        static const int EXPIRE_HASH = HashingUtils::HashString("EXPIRE");
+        static constexpr int EXPIRE_HASH = HashingUtils::CompileTimeHashString("EXPIRE");
 
 
         ImageActionType GetImageActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXPIRE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ImageActionType::EXPIRE;
+          case EXPIRE_HASH:
+            if (name == "EXPIRE")
+            {
+              return ImageActionType::EXPIRE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ImageActionType::NOT_SET;
         }
 
-        Aws::String GetNameForImageActionType(ImageActionType enumValue)
+        const char* GetNameForImageActionType(ImageActionType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace ImageFailureCodeMapper
       {
 
-        static const int InvalidImageDigest_HASH = HashingUtils::HashString("InvalidImageDigest");
-        static const int InvalidImageTag_HASH = HashingUtils::HashString("InvalidImageTag");
-        static const int ImageTagDoesNotMatchDigest_HASH = HashingUtils::HashString("ImageTagDoesNotMatchDigest");
-        static const int ImageNotFound_HASH = HashingUtils::HashString("ImageNotFound");
-        static const int MissingDigestAndTag_HASH = HashingUtils::HashString("MissingDigestAndTag");
+        static constexpr int InvalidImageDigest_HASH = HashingUtils::CompileTimeHashString("InvalidImageDigest");
+        static constexpr int InvalidImageTag_HASH = HashingUtils::CompileTimeHashString("InvalidImageTag");
+        static constexpr int ImageTagDoesNotMatchDigest_HASH = HashingUtils::CompileTimeHashString("ImageTagDoesNotMatchDigest");
+        static constexpr int ImageNotFound_HASH = HashingUtils::CompileTimeHashString("ImageNotFound");
+        static constexpr int MissingDigestAndTag_HASH = HashingUtils::CompileTimeHashString("MissingDigestAndTag");
 
 
         ImageFailureCode GetImageFailureCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvalidImageDigest_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ImageFailureCode::InvalidImageDigest;
-          }
-          else if (hashCode == InvalidImageTag_HASH)
-          {
-            return ImageFailureCode::InvalidImageTag;
-          }
-          else if (hashCode == ImageTagDoesNotMatchDigest_HASH)
-          {
-            return ImageFailureCode::ImageTagDoesNotMatchDigest;
-          }
-          else if (hashCode == ImageNotFound_HASH)
-          {
-            return ImageFailureCode::ImageNotFound;
-          }
-          else if (hashCode == MissingDigestAndTag_HASH)
-          {
-            return ImageFailureCode::MissingDigestAndTag;
+          case InvalidImageDigest_HASH:
+            if (name == "InvalidImageDigest")
+            {
+              return ImageFailureCode::InvalidImageDigest;
+            }
+            break;
+          case InvalidImageTag_HASH:
+            if (name == "InvalidImageTag")
+            {
+              return ImageFailureCode::InvalidImageTag;
+            }
+            break;
+          case ImageTagDoesNotMatchDigest_HASH:
+            if (name == "ImageTagDoesNotMatchDigest")
+            {
+              return ImageFailureCode::ImageTagDoesNotMatchDigest;
+            }
+            break;
+          case ImageNotFound_HASH:
+            if (name == "ImageNotFound")
+            {
+              return ImageFailureCode::ImageNotFound;
+            }
+            break;
+          case MissingDigestAndTag_HASH:
+            if (name == "MissingDigestAndTag")
+            {
+              return ImageFailureCode::MissingDigestAndTag;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ImageFailureCode::NOT_SET;
         }
 
-        Aws::String GetNameForImageFailureCode(ImageFailureCode enumValue)
+        const char* GetNameForImageFailureCode(ImageFailureCode enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace LayerAvailabilityMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("UNAVAILABLE");
 
 
         LayerAvailability GetLayerAvailabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LayerAvailability::AVAILABLE;
-          }
-          else if (hashCode == UNAVAILABLE_HASH)
-          {
-            return LayerAvailability::UNAVAILABLE;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return LayerAvailability::AVAILABLE;
+            }
+            break;
+          case UNAVAILABLE_HASH:
+            if (name == "UNAVAILABLE")
+            {
+              return LayerAvailability::UNAVAILABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LayerAvailability::NOT_SET;
         }
 
-        Aws::String GetNameForLayerAvailability(LayerAvailability enumValue)
+        const char* GetNameForLayerAvailability(LayerAvailability enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
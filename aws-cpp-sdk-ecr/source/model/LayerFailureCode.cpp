@@ -30,20 +30,30 @@ namespace Aws
       namespace LayerFailureCodeMapper
       {
 
-        static const int InvalidLayerDigest_HASH = HashingUtils::HashString("InvalidLayerDigest");
-        static const int MissingLayerDigest_HASH = HashingUtils::HashString("MissingLayerDigest");
+        static constexpr int InvalidLayerDigest_HASH = HashingUtils::CompileTimeHashString("InvalidLayerDigest");
+        static constexpr int MissingLayerDigest_HASH = HashingUtils::CompileTimeHashString("MissingLayerDigest");
 
 
         LayerFailureCode GetLayerFailureCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvalidLayerDigest_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LayerFailureCode::InvalidLayerDigest;
-          }
-          else if (hashCode == MissingLayerDigest_HASH)
-          {
-            return LayerFailureCode::MissingLayerDigest;
+          case InvalidLayerDigest_HASH:
+            if (name == "InvalidLayerDigest")
+            {
+              return LayerFailureCode::InvalidLayerDigest;
+            }
+            break;
+          case MissingLayerDigest_HASH:
+            if (name == "MissingLayerDigest")
+            {
+              return LayerFailureCode::MissingLayerDigest;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LayerFailureCode::NOT_SET;
         }
 
-        Aws::String GetNameForLayerFailureCode(LayerFailureCode enumValue)
+        const char* GetNameForLayerFailureCode(LayerFailureCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
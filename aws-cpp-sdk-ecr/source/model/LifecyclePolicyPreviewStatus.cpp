@@ -30,30 +30,44 @@ namespace Aws
       namespace LifecyclePolicyPreviewStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int COMPLETE_HASH = HashingUtils::CompileTimeHashString("COMPLETE");
+        static constexpr int EXPIRED_HASH = HashingUtils::CompileTimeHashString("EXPIRED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         LifecyclePolicyPreviewStatus GetLifecyclePolicyPreviewStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LifecyclePolicyPreviewStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETE_HASH)
-          {
-            return LifecyclePolicyPreviewStatus::COMPLETE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return LifecyclePolicyPreviewStatus::EXPIRED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return LifecyclePolicyPreviewStatus::FAILED;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return LifecyclePolicyPreviewStatus::IN_PROGRESS;
+            }
+            break;
+          case COMPLETE_HASH:
+            if (name == "COMPLETE")
+            {
+              return LifecyclePolicyPreviewStatus::COMPLETE;
+            }
+            break;
+          case EXPIRED_HASH:
+            if (name == "EXPIRED")
+            {
+              return LifecyclePolicyPreviewStatus::EXPIRED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return LifecyclePolicyPreviewStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return LifecyclePolicyPreviewStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLifecyclePolicyPreviewStatus(LifecyclePolicyPreviewStatus enumValue)
+        const char* GetNameForLifecyclePolicyPreviewStatus(LifecyclePolicyPreviewStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
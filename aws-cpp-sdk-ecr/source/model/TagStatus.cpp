@@ -30,20 +30,30 @@ namespace Aws
       namespace TagStatusMapper
       {
 
-        static const int TAGGED_HASH = HashingUtils::HashString("TAGGED");
-        static const int UNTAGGED_HASH = HashingUtils::HashString("UNTAGGED");
+        static constexpr int TAGGED_HASH = HashingUtils::CompileTimeHashString("TAGGED");
+        static constexpr int UNTAGGED_HASH = HashingUtils::CompileTimeHashString("UNTAGGED");
 
 
         TagStatus GetTagStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TAGGED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TagStatus::TAGGED;
-          }
-          else if (hashCode == UNTAGGED_HASH)
-          {
-            return TagStatus::UNTAGGED;
+          case TAGGED_HASH:
+            if (name == "TAGGED")
+            {
+              return TagStatus::TAGGED;
+            }
+            break;
+          case UNTAGGED_HASH:
+            if (name == "UNTAGGED")
+            {
+              return TagStatus::UNTAGGED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TagStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTagStatus(TagStatus enumValue)
+        const char* GetNameForTagStatus(TagStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -38,7 +38,8 @@ namespace AgentUpdateStatusMapper
 {
 AWS_ECS_API AgentUpdateStatus GetAgentUpdateStatusForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForAgentUpdateStatus(AgentUpdateStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForAgentUpdateStatus(AgentUpdateStatus value);
 } // namespace AgentUpdateStatusMapper
 } // namespace Model
 } // namespace ECS
@@ -34,7 +34,8 @@ namespace AssignPublicIpMapper
 {
 AWS_ECS_API AssignPublicIp GetAssignPublicIpForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForAssignPublicIp(AssignPublicIp value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForAssignPublicIp(AssignPublicIp value);
 } // namespace AssignPublicIpMapper
 } // namespace Model
 } // namespace ECS
@@ -33,7 +33,8 @@ namespace ClusterFieldMapper
 {
 AWS_ECS_API ClusterField GetClusterFieldForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForClusterField(ClusterField value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForClusterField(ClusterField value);
 } // namespace ClusterFieldMapper
 } // namespace Model
 } // namespace ECS
@@ -34,7 +34,8 @@ namespace CompatibilityMapper
 {
 AWS_ECS_API Compatibility GetCompatibilityForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForCompatibility(Compatibility value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForCompatibility(Compatibility value);
 } // namespace CompatibilityMapper
 } // namespace Model
 } // namespace ECS
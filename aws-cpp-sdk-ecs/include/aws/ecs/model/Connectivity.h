@@ -34,7 +34,8 @@ namespace ConnectivityMapper
 {
 AWS_ECS_API Connectivity GetConnectivityForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForConnectivity(Connectivity value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForConnectivity(Connectivity value);
 } // namespace ConnectivityMapper
 } // namespace Model
 } // namespace ECS
@@ -34,7 +34,8 @@ namespace ContainerInstanceStatusMapper
 {
 AWS_ECS_API ContainerInstanceStatus GetContainerInstanceStatusForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForContainerInstanceStatus(ContainerInstanceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForContainerInstanceStatus(ContainerInstanceStatus value);
 } // namespace ContainerInstanceStatusMapper
 } // namespace Model
 } // namespace ECS
@@ -35,7 +35,8 @@ namespace DesiredStatusMapper
 {
 AWS_ECS_API DesiredStatus GetDesiredStatusForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForDesiredStatus(DesiredStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForDesiredStatus(DesiredStatus value);
 } // namespace DesiredStatusMapper
 } // namespace Model
 } // namespace ECS
@@ -35,7 +35,8 @@ namespace DeviceCgroupPermissionMapper
 {
 AWS_ECS_API DeviceCgroupPermission GetDeviceCgroupPermissionForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForDeviceCgroupPermission(DeviceCgroupPermission value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForDeviceCgroupPermission(DeviceCgroupPermission value);
 } // namespace DeviceCgroupPermissionMapper
 } // namespace Model
 } // namespace ECS
@@ -35,7 +35,8 @@ namespace HealthStatusMapper
 {
 AWS_ECS_API HealthStatus GetHealthStatusForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForHealthStatus(HealthStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForHealthStatus(HealthStatus value);
 } // namespace HealthStatusMapper
 } // namespace Model
 } // namespace ECS
@@ -34,7 +34,8 @@ namespace LaunchTypeMapper
 {
 AWS_ECS_API LaunchType GetLaunchTypeForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForLaunchType(LaunchType value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForLaunchType(LaunchType value);
 } // namespace LaunchTypeMapper
 } // namespace Model
 } // namespace ECS
@@ -39,7 +39,8 @@ namespace LogDriverMapper
 {
 AWS_ECS_API LogDriver GetLogDriverForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForLogDriver(LogDriver value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForLogDriver(LogDriver value);
 } // namespace LogDriverMapper
 } // namespace Model
 } // namespace ECS
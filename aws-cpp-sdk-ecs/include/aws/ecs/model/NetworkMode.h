@@ -36,7 +36,8 @@ namespace NetworkModeMapper
 {
 AWS_ECS_API NetworkMode GetNetworkModeForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForNetworkMode(NetworkMode value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForNetworkMode(NetworkMode value);
 } // namespace NetworkModeMapper
 } // namespace Model
 } // namespace ECS
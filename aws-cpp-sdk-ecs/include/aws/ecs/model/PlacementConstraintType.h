@@ -34,7 +34,8 @@ namespace PlacementConstraintTypeMapper
 {
 AWS_ECS_API PlacementConstraintType GetPlacementConstraintTypeForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForPlacementConstraintType(PlacementConstraintType value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForPlacementConstraintType(PlacementConstraintType value);
 } // namespace PlacementConstraintTypeMapper
 } // namespace Model
 } // namespace ECS
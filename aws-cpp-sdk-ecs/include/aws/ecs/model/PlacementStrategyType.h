@@ -35,7 +35,8 @@ namespace PlacementStrategyTypeMapper
 {
 AWS_ECS_API PlacementStrategyType GetPlacementStrategyTypeForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForPlacementStrategyType(PlacementStrategyType value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForPlacementStrategyType(PlacementStrategyType value);
 } // namespace PlacementStrategyTypeMapper
 } // namespace Model
 } // namespace ECS
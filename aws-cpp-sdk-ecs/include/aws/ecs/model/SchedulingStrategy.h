@@ -34,7 +34,8 @@ namespace SchedulingStrategyMapper
 {
 AWS_ECS_API SchedulingStrategy GetSchedulingStrategyForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForSchedulingStrategy(SchedulingStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForSchedulingStrategy(SchedulingStrategy value);
 } // namespace SchedulingStrategyMapper
 } // namespace Model
 } // namespace ECS
@@ -34,7 +34,8 @@ namespace ScopeMapper
 {
 AWS_ECS_API Scope GetScopeForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForScope(Scope value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForScope(Scope value);
 } // namespace ScopeMapper
 } // namespace Model
 } // namespace ECS
@@ -33,7 +33,8 @@ namespace TargetTypeMapper
 {
 AWS_ECS_API TargetType GetTargetTypeForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForTargetType(TargetType value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForTargetType(TargetType value);
 } // namespace TargetTypeMapper
 } // namespace Model
 } // namespace ECS
@@ -35,7 +35,8 @@ namespace TaskDefinitionFamilyStatusMapper
 {
 AWS_ECS_API TaskDefinitionFamilyStatus GetTaskDefinitionFamilyStatusForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForTaskDefinitionFamilyStatus(TaskDefinitionFamilyStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForTaskDefinitionFamilyStatus(TaskDefinitionFamilyStatus value);
 } // namespace TaskDefinitionFamilyStatusMapper
 } // namespace Model
 } // namespace ECS
@@ -33,7 +33,8 @@ namespace TaskDefinitionPlacementConstraintTypeMapper
 {
 AWS_ECS_API TaskDefinitionPlacementConstraintType GetTaskDefinitionPlacementConstraintTypeForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForTaskDefinitionPlacementConstraintType(TaskDefinitionPlacementConstraintType value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForTaskDefinitionPlacementConstraintType(TaskDefinitionPlacementConstraintType value);
 } // namespace TaskDefinitionPlacementConstraintTypeMapper
 } // namespace Model
 } // namespace ECS
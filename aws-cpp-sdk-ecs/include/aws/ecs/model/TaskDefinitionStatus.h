@@ -34,7 +34,8 @@ namespace TaskDefinitionStatusMapper
 {
 AWS_ECS_API TaskDefinitionStatus GetTaskDefinitionStatusForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForTaskDefinitionStatus(TaskDefinitionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForTaskDefinitionStatus(TaskDefinitionStatus value);
 } // namespace TaskDefinitionStatusMapper
 } // namespace Model
 } // namespace ECS
@@ -34,7 +34,8 @@ namespace TransportProtocolMapper
 {
 AWS_ECS_API TransportProtocol GetTransportProtocolForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForTransportProtocol(TransportProtocol value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForTransportProtocol(TransportProtocol value);
 } // namespace TransportProtocolMapper
 } // namespace Model
 } // namespace ECS
@@ -47,7 +47,8 @@ namespace UlimitNameMapper
 {
 AWS_ECS_API UlimitName GetUlimitNameForName(const Aws::String& name);
 
-AWS_ECS_API Aws::String GetNameForUlimitName(UlimitName value);
+// names of values not modeled point into the enum overflow container
+AWS_ECS_API const char* GetNameForUlimitName(UlimitName value);
 } // namespace UlimitNameMapper
 } // namespace Model
 } // namespace ECS
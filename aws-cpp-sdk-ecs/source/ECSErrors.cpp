@@ -28,24 +28,24 @@ namespace ECS
 namespace ECSErrorMapper
 {
 
-static const int PLATFORM_TASK_DEFINITION_INCOMPATIBILITY_HASH = HashingUtils::HashString("PlatformTaskDefinitionIncompatibilityException");
-static const int MISSING_VERSION_HASH = HashingUtils::HashString("MissingVersionException");
-static const int SERVER_HASH = HashingUtils::HashString("ServerException");
-static const int NO_UPDATE_AVAILABLE_HASH = HashingUtils::HashString("NoUpdateAvailableException");
-static const int UNSUPPORTED_FEATURE_HASH = HashingUtils::HashString("UnsupportedFeatureException");
-static const int TARGET_NOT_FOUND_HASH = HashingUtils::HashString("TargetNotFoundException");
-static const int BLOCKED_HASH = HashingUtils::HashString("BlockedException");
-static const int CLUSTER_CONTAINS_CONTAINER_INSTANCES_HASH = HashingUtils::HashString("ClusterContainsContainerInstancesException");
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int PLATFORM_UNKNOWN_HASH = HashingUtils::HashString("PlatformUnknownException");
-static const int SERVICE_NOT_ACTIVE_HASH = HashingUtils::HashString("ServiceNotActiveException");
-static const int CLUSTER_NOT_FOUND_HASH = HashingUtils::HashString("ClusterNotFoundException");
-static const int CLUSTER_CONTAINS_SERVICES_HASH = HashingUtils::HashString("ClusterContainsServicesException");
-static const int CLUSTER_CONTAINS_TASKS_HASH = HashingUtils::HashString("ClusterContainsTasksException");
-static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UpdateInProgressException");
-static const int SERVICE_NOT_FOUND_HASH = HashingUtils::HashString("ServiceNotFoundException");
-static const int ATTRIBUTE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AttributeLimitExceededException");
-static const int CLIENT_HASH = HashingUtils::HashString("ClientException");
+static constexpr int PLATFORM_TASK_DEFINITION_INCOMPATIBILITY_HASH = HashingUtils::CompileTimeHashString("PlatformTaskDefinitionIncompatibilityException");
+static constexpr int MISSING_VERSION_HASH = HashingUtils::CompileTimeHashString("MissingVersionException");
+static constexpr int SERVER_HASH = HashingUtils::CompileTimeHashString("ServerException");
+static constexpr int NO_UPDATE_AVAILABLE_HASH = HashingUtils::CompileTimeHashString("NoUpdateAvailableException");
+static constexpr int UNSUPPORTED_FEATURE_HASH = HashingUtils::CompileTimeHashString("UnsupportedFeatureException");
+static constexpr int TARGET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("TargetNotFoundException");
+static constexpr int BLOCKED_HASH = HashingUtils::CompileTimeHashString("BlockedException");
+static constexpr int CLUSTER_CONTAINS_CONTAINER_INSTANCES_HASH = HashingUtils::CompileTimeHashString("ClusterContainsContainerInstancesException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int PLATFORM_UNKNOWN_HASH = HashingUtils::CompileTimeHashString("PlatformUnknownException");
+static constexpr int SERVICE_NOT_ACTIVE_HASH = HashingUtils::CompileTimeHashString("ServiceNotActiveException");
+static constexpr int CLUSTER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ClusterNotFoundException");
+static constexpr int CLUSTER_CONTAINS_SERVICES_HASH = HashingUtils::CompileTimeHashString("ClusterContainsServicesException");
+static constexpr int CLUSTER_CONTAINS_TASKS_HASH = HashingUtils::CompileTimeHashString("ClusterContainsTasksException");
+static constexpr int UPDATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("UpdateInProgressException");
+static constexpr int SERVICE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ServiceNotFoundException");
+static constexpr int ATTRIBUTE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AttributeLimitExceededException");
+static constexpr int CLIENT_HASH = HashingUtils::CompileTimeHashString("ClientException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
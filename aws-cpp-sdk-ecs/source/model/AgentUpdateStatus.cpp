@@ -30,40 +30,58 @@ namespace Aws
       namespace AgentUpdateStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int STAGING_HASH = HashingUtils::HashString("STAGING");
-        static const int STAGED_HASH = HashingUtils::HashString("STAGED");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int UPDATED_HASH = HashingUtils::HashString("UPDATED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int STAGING_HASH = HashingUtils::CompileTimeHashString("STAGING");
+        static constexpr int STAGED_HASH = HashingUtils::CompileTimeHashString("STAGED");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
+        static constexpr int UPDATED_HASH = HashingUtils::CompileTimeHashString("UPDATED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         AgentUpdateStatus GetAgentUpdateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AgentUpdateStatus::PENDING;
-          }
-          else if (hashCode == STAGING_HASH)
-          {
-            return AgentUpdateStatus::STAGING;
-          }
-          else if (hashCode == STAGED_HASH)
-          {
-            return AgentUpdateStatus::STAGED;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return AgentUpdateStatus::UPDATING;
-          }
-          else if (hashCode == UPDATED_HASH)
-          {
-            return AgentUpdateStatus::UPDATED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AgentUpdateStatus::FAILED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return AgentUpdateStatus::PENDING;
+            }
+            break;
+          case STAGING_HASH:
+            if (name == "STAGING")
+            {
+              return AgentUpdateStatus::STAGING;
+            }
+            break;
+          case STAGED_HASH:
+            if (name == "STAGED")
+            {
+              return AgentUpdateStatus::STAGED;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return AgentUpdateStatus::UPDATING;
+            }
+            break;
+          case UPDATED_HASH:
+            if (name == "UPDATED")
+            {
+              return AgentUpdateStatus::UPDATED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return AgentUpdateStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return AgentUpdateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAgentUpdateStatus(AgentUpdateStatus enumValue)
+        const char* GetNameForAgentUpdateStatus(AgentUpdateStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ClusterFieldMapper
       {
 
-        static const int STATISTICS_HASH = HashingUtils::HashString("STATISTICS");
+        static constexpr int STATISTICS_HASH = HashingUtils::CompileTimeHashString("STATISTICS");
 
 
         ClusterField GetClusterFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STATISTICS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ClusterField::STATISTICS;
+          case STATISTICS_HASH:
+            if (name == "STATISTICS")
+            {
+              return ClusterField::STATISTICS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ClusterField::NOT_SET;
         }
 
-        Aws::String GetNameForClusterField(ClusterField enumValue)
+        const char* GetNameForClusterField(ClusterField enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
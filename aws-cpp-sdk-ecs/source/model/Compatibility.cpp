@@ -30,20 +30,30 @@ namespace Aws
       namespace CompatibilityMapper
       {
 
-        static const int EC2_HASH = HashingUtils::HashString("EC2");
-        static const int FARGATE_HASH = HashingUtils::HashString("FARGATE");
+        static constexpr int EC2_HASH = HashingUtils::CompileTimeHashString("EC2");
+        static constexpr int FARGATE_HASH = HashingUtils::CompileTimeHashString("FARGATE");
 
 
         Compatibility GetCompatibilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EC2_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Compatibility::EC2;
-          }
-          else if (hashCode == FARGATE_HASH)
-          {
-            return Compatibility::FARGATE;
+          case EC2_HASH:
+            if (name == "EC2")
+            {
+              return Compatibility::EC2;
+            }
+            break;
+          case FARGATE_HASH:
+            if (name == "FARGATE")
+            {
+              return Compatibility::FARGATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Compatibility::NOT_SET;
         }
 
-        Aws::String GetNameForCompatibility(Compatibility enumValue)
+        const char* GetNameForCompatibility(Compatibility enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
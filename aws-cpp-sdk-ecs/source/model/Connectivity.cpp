@@ -30,20 +30,30 @@ namespace Aws
       namespace ConnectivityMapper
       {
 
-        static const int CONNECTED_HASH = HashingUtils::HashString("CONNECTED");
-        static const int DISCONNECTED_HASH = HashingUtils::HashString("DISCONNECTED");
+        static constexpr int CONNECTED_HASH = HashingUtils::CompileTimeHashString("CONNECTED");
+        static constexpr int DISCONNECTED_HASH = HashingUtils::CompileTimeHashString("DISCONNECTED");
 
 
         Connectivity GetConnectivityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONNECTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Connectivity::CONNECTED;
-          }
-          else if (hashCode == DISCONNECTED_HASH)
-          {
-            return Connectivity::DISCONNECTED;
+          case CONNECTED_HASH:
+            if (name == "CONNECTED")
+            {
+              return Connectivity::CONNECTED;
+            }
+            break;
+          case DISCONNECTED_HASH:
+            if (name == "DISCONNECTED")
+            {
+              return Connectivity::DISCONNECTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Connectivity::NOT_SET;
         }
 
-        Aws::String GetNameForConnectivity(Connectivity enumValue)
+        const char* GetNameForConnectivity(Connectivity enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ContainerInstanceStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DRAINING_HASH = HashingUtils::HashString("DRAINING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DRAINING_HASH = HashingUtils::CompileTimeHashString("DRAINING");
 
 
         ContainerInstanceStatus GetContainerInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContainerInstanceStatus::ACTIVE;
-          }
-          else if (hashCode == DRAINING_HASH)
-          {
-            return ContainerInstanceStatus::DRAINING;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ContainerInstanceStatus::ACTIVE;
+            }
+            break;
+          case DRAINING_HASH:
+            if (name == "DRAINING")
+            {
+              return ContainerInstanceStatus::DRAINING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ContainerInstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForContainerInstanceStatus(ContainerInstanceStatus enumValue)
+        const char* GetNameForContainerInstanceStatus(ContainerInstanceStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
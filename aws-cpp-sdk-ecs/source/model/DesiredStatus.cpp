@@ -30,25 +30,37 @@ namespace Aws
       namespace DesiredStatusMapper
       {
 
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
 
 
         DesiredStatus GetDesiredStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUNNING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DesiredStatus::RUNNING;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return DesiredStatus::PENDING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return DesiredStatus::STOPPED;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return DesiredStatus::RUNNING;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return DesiredStatus::PENDING;
+            }
+            break;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return DesiredStatus::STOPPED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DesiredStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDesiredStatus(DesiredStatus enumValue)
+        const char* GetNameForDesiredStatus(DesiredStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace DeviceCgroupPermissionMapper
       {
 
-        static const int read_HASH = HashingUtils::HashString("read");
-        static const int write_HASH = HashingUtils::HashString("write");
-        static const int mknod_HASH = HashingUtils::HashString("mknod");
+        static constexpr int read_HASH = HashingUtils::CompileTimeHashString("read");
+        static constexpr int write_HASH = HashingUtils::CompileTimeHashString("write");
+        static constexpr int mknod_HASH = HashingUtils::CompileTimeHashString("mknod");
 
 
         DeviceCgroupPermission GetDeviceCgroupPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == read_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeviceCgroupPermission::read;
-          }
-          else if (hashCode == write_HASH)
-          {
-            return DeviceCgroupPermission::write;
-          }
-          else if (hashCode == mknod_HASH)
-          {
-            return DeviceCgroupPermission::mknod;
+          case read_HASH:
+            if (name == "read")
+            {
+              return DeviceCgroupPermission::read;
+            }
+            break;
+          case write_HASH:
+            if (name == "write")
+            {
+              return DeviceCgroupPermission::write;
+            }
+            break;
+          case mknod_HASH:
+            if (name == "mknod")
+            {
+              return DeviceCgroupPermission::mknod;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DeviceCgroupPermission::NOT_SET;
         }
 
-        Aws::String GetNameForDeviceCgroupPermission(DeviceCgroupPermission enumValue)
+        const char* GetNameForDeviceCgroupPermission(DeviceCgroupPermission enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace HealthStatusMapper
       {
 
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
+        static constexpr int HEALTHY_HASH = HashingUtils::CompileTimeHashString("HEALTHY");
+        static constexpr int UNHEALTHY_HASH = HashingUtils::CompileTimeHashString("UNHEALTHY");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
 
 
         HealthStatus GetHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEALTHY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HealthStatus::HEALTHY;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return HealthStatus::UNHEALTHY;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return HealthStatus::UNKNOWN;
+          case HEALTHY_HASH:
+            if (name == "HEALTHY")
+            {
+              return HealthStatus::HEALTHY;
+            }
+            break;
+          case UNHEALTHY_HASH:
+            if (name == "UNHEALTHY")
+            {
+              return HealthStatus::UNHEALTHY;
+            }
+            break;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return HealthStatus::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return HealthStatus::NOT_SET;
         }
 
-        Aws::String GetNameForHealthStatus(HealthStatus enumValue)
+        const char* GetNameForHealthStatus(HealthStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace LaunchTypeMapper
       {
 
-        static const int EC2_HASH = HashingUtils::HashString("EC2");
-        static const int FARGATE_HASH = HashingUtils::HashString("FARGATE");
+        static constexpr int EC2_HASH = HashingUtils::CompileTimeHashString("EC2");
+        static constexpr int FARGATE_HASH = HashingUtils::CompileTimeHashString("FARGATE");
 
 
         LaunchType GetLaunchTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EC2_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LaunchType::EC2;
-          }
-          else if (hashCode == FARGATE_HASH)
-          {
-            return LaunchType::FARGATE;
+          case EC2_HASH:
+            if (name == "EC2")
+            {
+              return LaunchType::EC2;
+            }
+            break;
+          case FARGATE_HASH:
+            if (name == "FARGATE")
+            {
+              return LaunchType::FARGATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LaunchType::NOT_SET;
         }
 
-        Aws::String GetNameForLaunchType(LaunchType enumValue)
+        const char* GetNameForLaunchType(LaunchType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
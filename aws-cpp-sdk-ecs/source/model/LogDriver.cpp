@@ -30,45 +30,65 @@ namespace Aws
       namespace LogDriverMapper
       {
 
-        static const int json_file_HASH = HashingUtils::HashString("json-file");
-        static const int syslog_HASH = HashingUtils::HashString("syslog");
-        static const int journald_HASH = HashingUtils::HashString("journald");
-        static const int gelf_HASH = HashingUtils::HashString("gelf");
-        static const int fluentd_HASH = HashingUtils::HashString("fluentd");
-        static const int awslogs_HASH = HashingUtils::HashString("awslogs");
-        static const int splunk_HASH = HashingUtils::HashString("splunk");
+        static constexpr int json_file_HASH = HashingUtils::CompileTimeHashString("json-file");
+        static constexpr int syslog_HASH = HashingUtils::CompileTimeHashString("syslog");
+        static constexpr int journald_HASH = HashingUtils::CompileTimeHashString("journald");
+        static constexpr int gelf_HASH = HashingUtils::CompileTimeHashString("gelf");
+        static constexpr int fluentd_HASH = HashingUtils::CompileTimeHashString("fluentd");
+        static constexpr int awslogs_HASH = HashingUtils::CompileTimeHashString("awslogs");
+        static constexpr int splunk_HASH = HashingUtils::CompileTimeHashString("splunk");
 
 
         LogDriver GetLogDriverForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == json_file_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LogDriver::json_file;
-          }
-          else if (hashCode == syslog_HASH)
-          {
-            return LogDriver::syslog;
-          }
-          else if (hashCode == journald_HASH)
-          {
-            return LogDriver::journald;
-          }
-          else if (hashCode == gelf_HASH)
-          {
-            return LogDriver::gelf;
-          }
-          else if (hashCode == fluentd_HASH)
-          {
-            return LogDriver::fluentd;
-          }
-          else if (hashCode == awslogs_HASH)
-          {
-            return LogDriver::awslogs;
-          }
-          else if (hashCode == splunk_HASH)
-          {
-            return LogDriver::splunk;
+          case json_file_HASH:
+            if (name == "json-file")
+            {
+              return LogDriver::json_file;
+            }
+            break;
+          case syslog_HASH:
+            if (name == "syslog")
+            {
+              return LogDriver::syslog;
+            }
+            break;
+          case journald_HASH:
+            if (name == "journald")
+            {
+              return LogDriver::journald;
+            }
+            break;
+          case gelf_HASH:
+            if (name == "gelf")
+            {
+              return LogDriver::gelf;
+            }
+            break;
+          case fluentd_HASH:
+            if (name == "fluentd")
+            {
+              return LogDriver::fluentd;
+            }
+            break;
+          case awslogs_HASH:
+            if (name == "awslogs")
+            {
+              return LogDriver::awslogs;
+            }
+            break;
+          case splunk_HASH:
+            if (name == "splunk")
+            {
+              return LogDriver::splunk;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return LogDriver::NOT_SET;
         }
 
-        Aws::String GetNameForLogDriver(LogDriver enumValue)
+        const char* GetNameForLogDriver(LogDriver enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
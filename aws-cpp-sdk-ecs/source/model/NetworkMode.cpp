@@ -30,30 +30,44 @@ namespace Aws
       namespace NetworkModeMapper
       {
 
-        static const int bridge_HASH = HashingUtils::HashString("bridge");
-        static const int host_HASH = HashingUtils::HashString("host");
-        static const int awsvpc_HASH = HashingUtils::HashString("awsvpc");
-        static const int none_HASH = HashingUtils::HashString("none");
+        static constexpr int bridge_HASH = HashingUtils::CompileTimeHashString("bridge");
+        static constexpr int host_HASH = HashingUtils::CompileTimeHashString("host");
+        static constexpr int awsvpc_HASH = HashingUtils::CompileTimeHashString("awsvpc");
+        static constexpr int none_HASH = HashingUtils::CompileTimeHashString("none");
 
 
         NetworkMode GetNetworkModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == bridge_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NetworkMode::bridge;
-          }
-          else if (hashCode == host_HASH)
-          {
-            return NetworkMode::host;
-          }
-          else if (hashCode == awsvpc_HASH)
-          {
-            return NetworkMode::awsvpc;
-          }
-          else if (hashCode == none_HASH)
-          {
-            return NetworkMode::none;
+          case bridge_HASH:
+            if (name == "bridge")
+            {
+              return NetworkMode::bridge;
+            }
+            break;
+          case host_HASH:
+            if (name == "host")
+            {
+              return NetworkMode::host;
+            }
+            break;
+          case awsvpc_HASH:
+            if (name == "awsvpc")
+            {
+              return NetworkMode::awsvpc;
+            }
+            break;
+          case none_HASH:
+            if (name == "none")
+            {
+              return NetworkMode::none;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return NetworkMode::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkMode(NetworkMode enumValue)
+        const char* GetNameForNetworkMode(NetworkMode enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
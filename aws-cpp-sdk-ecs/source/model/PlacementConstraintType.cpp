@@ -30,20 +30,30 @@ namespace Aws
       namespace PlacementConstraintTypeMapper
       {
 
-        static const int distinctInstance_HASH = HashingUtils::HashString("distinctInstance");
-        static const int memberOf_HASH = HashingUtils::HashString("memberOf");
+        static constexpr int distinctInstance_HASH = HashingUtils::CompileTimeHashString("distinctInstance");
+        static constexpr int memberOf_HASH = HashingUtils::CompileTimeHashString("memberOf");
 
 
         PlacementConstraintType GetPlacementConstraintTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == distinctInstance_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlacementConstraintType::distinctInstance;
-          }
-          else if (hashCode == memberOf_HASH)
-          {
-            return PlacementConstraintType::memberOf;
+          case distinctInstance_HASH:
+            if (name == "distinctInstance")
+            {
+              return PlacementConstraintType::distinctInstance;
+            }
+            break;
+          case memberOf_HASH:
+            if (name == "memberOf")
+            {
+              return PlacementConstraintType::memberOf;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PlacementConstraintType::NOT_SET;
         }
 
-        Aws::String GetNameForPlacementConstraintType(PlacementConstraintType enumValue)
+        const char* GetNameForPlacementConstraintType(PlacementConstraintType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
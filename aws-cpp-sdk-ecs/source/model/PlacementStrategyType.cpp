@@ -30,25 +30,37 @@ namespace Aws
       namespace PlacementStrategyTypeMapper
       {
 
-        static const int random_HASH = HashingUtils::HashString("random");
-        static const int spread_HASH = HashingUtils::HashString("spread");
-        static const int binpack_HASH = HashingUtils::HashString("binpack");
+        static constexpr int random_HASH = HashingUtils::CompileTimeHashString("random");
+        static constexpr int spread_HASH = HashingUtils::CompileTimeHashString("spread");
+        static constexpr int binpack_HASH = HashingUtils::CompileTimeHashString("binpack");
 
 
         PlacementStrategyType GetPlacementStrategyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == random_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlacementStrategyType::random;
-          }
-          else if (hashCode == spread_HASH)
-          {
-            return PlacementStrategyType::spread;
-          }
-          else if (hashCode == binpack_HASH)
-          {
-            return PlacementStrategyType::binpack;
+          case random_HASH:
+            if (name == "random")
+            {
+              return PlacementStrategyType::random;
+            }
+            break;
+          case spread_HASH:
+            if (name == "spread")
+            {
+              return PlacementStrategyType::spread;
+            }
+            break;
+          case binpack_HASH:
+            if (name == "binpack")
+            {
+              return PlacementStrategyType::binpack;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PlacementStrategyType::NOT_SET;
         }
 
-        Aws::String GetNameForPlacementStrategyType(PlacementStrategyType enumValue)
+        const char* GetNameForPlacementStrategyType(PlacementStrategyType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SchedulingStrategyMapper
       {
 
-        static const int REPLICA_HASH = HashingUtils::HashString("REPLICA");
-        static const int DAEMON_HASH = HashingUtils::HashString("DAEMON");
+        static constexpr int REPLICA_HASH = HashingUtils::CompileTimeHashString("REPLICA");
+        static constexpr int DAEMON_HASH = HashingUtils::CompileTimeHashString("DAEMON");
 
 
         SchedulingStrategy GetSchedulingStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REPLICA_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SchedulingStrategy::REPLICA;
-          }
-          else if (hashCode == DAEMON_HASH)
-          {
-            return SchedulingStrategy::DAEMON;
+          case REPLICA_HASH:
+            if (name == "REPLICA")
+            {
+              return SchedulingStrategy::REPLICA;
+            }
+            break;
+          case DAEMON_HASH:
+            if (name == "DAEMON")
+            {
+              return SchedulingStrategy::DAEMON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SchedulingStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForSchedulingStrategy(SchedulingStrategy enumValue)
+        const char* GetNameForSchedulingStrategy(SchedulingStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
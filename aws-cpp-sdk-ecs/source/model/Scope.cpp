@@ -30,20 +30,30 @@ namespace Aws
       namespace ScopeMapper
       {
 
-        static const int task_HASH = HashingUtils::HashString("task");
-        static const int shared_HASH = HashingUtils::HashString("shared");
+        static constexpr int task_HASH = HashingUtils::CompileTimeHashString("task");
+        static constexpr int shared_HASH = HashingUtils::CompileTimeHashString("shared");
 
 
         Scope GetScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == task_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Scope::task;
-          }
-          else if (hashCode == shared_HASH)
-          {
-            return Scope::shared;
+          case task_HASH:
+            if (name == "task")
+            {
+              return Scope::task;
+            }
+            break;
+          case shared_HASH:
+            if (name == "shared")
+            {
+              return Scope::shared;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Scope::NOT_SET;
         }
 
-        Aws::String GetNameForScope(Scope enumValue)
+        const char* GetNameForScope(Scope enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
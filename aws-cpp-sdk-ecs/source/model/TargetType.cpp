@@ -30,15 +30,23 @@ namespace Aws
       namespace TargetTypeMapper
       {
 
-        static const int container_instance_HASH = HashingUtils::HashString("container-instance");
+        static constexpr int container_instance_HASH = HashingUtils::CompileTimeHashString("container-instance");
 
 
         TargetType GetTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == container_instance_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TargetType::container_instance;
+          case container_instance_HASH:
+            if (name == "container-instance")
+            {
+              return TargetType::container_instance;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return TargetType::NOT_SET;
         }
 
-        Aws::String GetNameForTargetType(TargetType enumValue)
+        const char* GetNameForTargetType(TargetType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace TaskDefinitionFamilyStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int INACTIVE_HASH = HashingUtils::CompileTimeHashString("INACTIVE");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
 
 
         TaskDefinitionFamilyStatus GetTaskDefinitionFamilyStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TaskDefinitionFamilyStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return TaskDefinitionFamilyStatus::INACTIVE;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return TaskDefinitionFamilyStatus::ALL;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return TaskDefinitionFamilyStatus::ACTIVE;
+            }
+            break;
+          case INACTIVE_HASH:
+            if (name == "INACTIVE")
+            {
+              return TaskDefinitionFamilyStatus::INACTIVE;
+            }
+            break;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return TaskDefinitionFamilyStatus::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TaskDefinitionFamilyStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTaskDefinitionFamilyStatus(TaskDefinitionFamilyStatus enumValue)
+        const char* GetNameForTaskDefinitionFamilyStatus(TaskDefinitionFamilyStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace TaskDefinitionPlacementConstraintTypeMapper
       {
 
-        static const int memberOf_HASH = HashingUtils::HashString("memberOf");
+        static constexpr int memberOf_HASH = HashingUtils::CompileTimeHashString("memberOf");
 
 
         TaskDefinitionPlacementConstraintType GetTaskDefinitionPlacementConstraintTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == memberOf_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TaskDefinitionPlacementConstraintType::memberOf;
+          case memberOf_HASH:
+            if (name == "memberOf")
+            {
+              return TaskDefinitionPlacementConstraintType::memberOf;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return TaskDefinitionPlacementConstraintType::NOT_SET;
         }
 
-        Aws::String GetNameForTaskDefinitionPlacementConstraintType(TaskDefinitionPlacementConstraintType enumValue)
+        const char* GetNameForTaskDefinitionPlacementConstraintType(TaskDefinitionPlacementConstraintType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace TransportProtocolMapper
       {
 
-        static const int tcp_HASH = HashingUtils::HashString("tcp");
-        static const int udp_HASH = HashingUtils::HashString("udp");
+        static constexpr int tcp_HASH = HashingUtils::CompileTimeHashString("tcp");
+        static constexpr int udp_HASH = HashingUtils::CompileTimeHashString("udp");
 
 
         TransportProtocol GetTransportProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tcp_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TransportProtocol::tcp;
-          }
-          else if (hashCode == udp_HASH)
-          {
-            return TransportProtocol::udp;
+          case tcp_HASH:
+            if (name == "tcp")
+            {
+              return TransportProtocol::tcp;
+            }
+            break;
+          case udp_HASH:
+            if (name == "udp")
+            {
+              return TransportProtocol::udp;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TransportProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForTransportProtocol(TransportProtocol enumValue)
+        const char* GetNameForTransportProtocol(TransportProtocol enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
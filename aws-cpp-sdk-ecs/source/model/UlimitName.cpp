@@ -30,85 +30,121 @@ namespace Aws
       namespace UlimitNameMapper
       {
 
-        static const int core_HASH = HashingUtils::HashString("core");
-        static const int cpu_HASH = HashingUtils::HashString("cpu");
-        static const int data_HASH = HashingUtils::HashString("data");
-        static const int fsize_HASH = HashingUtils::HashString("fsize");
-        static const int locks_HASH = HashingUtils::HashString("locks");
-        static const int memlock_HASH = HashingUtils::HashString("memlock");
-        static const int msgqueue_HASH = HashingUtils::HashString("msgqueue");
-        static const int nice_HASH = HashingUtils::HashString("nice");
-        static const int nofile_HASH = HashingUtils::HashString("nofile");
-        static const int nproc_HASH = HashingUtils::HashString("nproc");
-        static const int rss_HASH = HashingUtils::HashString("rss");
-        static const int rtprio_HASH = HashingUtils::HashString("rtprio");
-        static const int rttime_HASH = HashingUtils::HashString("rttime");
-        static const int sigpending_HASH = HashingUtils::HashString("sigpending");
-        static const int stack_HASH = HashingUtils::HashString("stack");
+        static constexpr int core_HASH = HashingUtils::CompileTimeHashString("core");
+        static constexpr int cpu_HASH = HashingUtils::CompileTimeHashString("cpu");
+        static constexpr int data_HASH = HashingUtils::CompileTimeHashString("data");
+        static constexpr int fsize_HASH = HashingUtils::CompileTimeHashString("fsize");
+        static constexpr int locks_HASH = HashingUtils::CompileTimeHashString("locks");
+        static constexpr int memlock_HASH = HashingUtils::CompileTimeHashString("memlock");
+        static constexpr int msgqueue_HASH = HashingUtils::CompileTimeHashString("msgqueue");
+        static constexpr int nice_HASH = HashingUtils::CompileTimeHashString("nice");
+        static constexpr int nofile_HASH = HashingUtils::CompileTimeHashString("nofile");
+        static constexpr int nproc_HASH = HashingUtils::CompileTimeHashString("nproc");
+        static constexpr int rss_HASH = HashingUtils::CompileTimeHashString("rss");
+        static constexpr int rtprio_HASH = HashingUtils::CompileTimeHashString("rtprio");
+        static constexpr int rttime_HASH = HashingUtils::CompileTimeHashString("rttime");
+        static constexpr int sigpending_HASH = HashingUtils::CompileTimeHashString("sigpending");
+        static constexpr int stack_HASH = HashingUtils::CompileTimeHashString("stack");
 
 
         UlimitName GetUlimitNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == core_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UlimitName::core;
-          }
-          else if (hashCode == cpu_HASH)
-          {
-            return UlimitName::cpu;
-          }
-          else if (hashCode == data_HASH)
-          {
-            return UlimitName::data;
-          }
-          else if (hashCode == fsize_HASH)
-          {
-            return UlimitName::fsize;
-          }
-          else if (hashCode == locks_HASH)
-          {
-            return UlimitName::locks;
-          }
-          else if (hashCode == memlock_HASH)
-          {
-            return UlimitName::memlock;
-          }
-          else if (hashCode == msgqueue_HASH)
-          {
-            return UlimitName::msgqueue;
-          }
-          else if (hashCode == nice_HASH)
-          {
-            return UlimitName::nice;
-          }
-          else if (hashCode == nofile_HASH)
-          {
-            return UlimitName::nofile;
-          }
-          else if (hashCode == nproc_HASH)
-          {
-            return UlimitName::nproc;
-          }
-          else if (hashCode == rss_HASH)
-          {
-            return UlimitName::rss;
-          }
-          else if (hashCode == rtprio_HASH)
-          {
-            return UlimitName::rtprio;
-          }
-          else if (hashCode == rttime_HASH)
-          {
-            return UlimitName::rttime;
-          }
-          else if (hashCode == sigpending_HASH)
-          {
-            return UlimitName::sigpending;
-          }
-          else if (hashCode == stack_HASH)
-          {
-            return UlimitName::stack;
+          case core_HASH:
+            if (name == "core")
+            {
+              return UlimitName::core;
+            }
+            break;
+          case cpu_HASH:
+            if (name == "cpu")
+            {
+              return UlimitName::cpu;
+            }
+            break;
+          case data_HASH:
+            if (name == "data")
+            {
+              return UlimitName::data;
+            }
+            break;
+          case fsize_HASH:
+            if (name == "fsize")
+            {
+              return UlimitName::fsize;
+            }
+            break;
+          case locks_HASH:
+            if (name == "locks")
+            {
+              return UlimitName::locks;
+            }
+            break;
+          case memlock_HASH:
+            if (name == "memlock")
+            {
+              return UlimitName::memlock;
+            }
+            break;
+          case msgqueue_HASH:
+            if (name == "msgqueue")
+            {
+              return UlimitName::msgqueue;
+            }
+            break;
+          case nice_HASH:
+            if (name == "nice")
+            {
+              return UlimitName::nice;
+            }
+            break;
+          case nofile_HASH:
+            if (name == "nofile")
+            {
+              return UlimitName::nofile;
+            }
+            break;
+          case nproc_HASH:
+            if (name == "nproc")
+            {
+              return UlimitName::nproc;
+            }
+            break;
+          case rss_HASH:
+            if (name == "rss")
+            {
+              return UlimitName::rss;
+            }
+            break;
+          case rtprio_HASH:
+            if (name == "rtprio")
+            {
+              return UlimitName::rtprio;
+            }
+            break;
+          case rttime_HASH:
+            if (name == "rttime")
+            {
+              return UlimitName::rttime;
+            }
+            break;
+          case sigpending_HASH:
+            if (name == "sigpending")
+            {
+              return UlimitName::sigpending;
+            }
+            break;
+          case stack_HASH:
+            if (name == "stack")
+            {
+              return UlimitName::stack;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -120,7 +156,7 @@ namespace Aws
           return UlimitName::NOT_SET;
         }
 
-        Aws::String GetNameForUlimitName(UlimitName enumValue)
+        const char* GetNameForUlimitName(UlimitName enumValue)
         {
           switch(enumValue)
           {
@@ -158,7 +194,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
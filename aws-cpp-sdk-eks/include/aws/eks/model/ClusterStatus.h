@@ -36,7 +36,8 @@ namespace ClusterStatusMapper
 {
 AWS_EKS_API ClusterStatus GetClusterStatusForName(const Aws::String& name);
 
-AWS_EKS_API Aws::String GetNameForClusterStatus(ClusterStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EKS_API const char* GetNameForClusterStatus(ClusterStatus value);
 } // namespace ClusterStatusMapper
 } // namespace Model
 } // namespace EKS
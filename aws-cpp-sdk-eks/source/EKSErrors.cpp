@@ -28,12 +28,12 @@ namespace EKS
 namespace EKSErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ResourceLimitExceededException");
-static const int SERVER_HASH = HashingUtils::HashString("ServerException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int UNSUPPORTED_AVAILABILITY_ZONE_HASH = HashingUtils::HashString("UnsupportedAvailabilityZoneException");
-static const int CLIENT_HASH = HashingUtils::HashString("ClientException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceLimitExceededException");
+static constexpr int SERVER_HASH = HashingUtils::CompileTimeHashString("ServerException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int UNSUPPORTED_AVAILABILITY_ZONE_HASH = HashingUtils::CompileTimeHashString("UnsupportedAvailabilityZoneException");
+static constexpr int CLIENT_HASH = HashingUtils::CompileTimeHashString("ClientException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
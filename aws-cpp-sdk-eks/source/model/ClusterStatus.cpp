@@ -30,30 +30,44 @@ namespace Aws
       namespace ClusterStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         ClusterStatus GetClusterStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ClusterStatus::CREATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return ClusterStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ClusterStatus::DELETING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ClusterStatus::FAILED;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return ClusterStatus::CREATING;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ClusterStatus::ACTIVE;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ClusterStatus::DELETING;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ClusterStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ClusterStatus::NOT_SET;
         }
 
-        Aws::String GetNameForClusterStatus(ClusterStatus enumValue)
+        const char* GetNameForClusterStatus(ClusterStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
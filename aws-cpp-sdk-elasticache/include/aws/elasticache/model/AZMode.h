@@ -34,7 +34,8 @@ namespace AZModeMapper
 {
 AWS_ELASTICACHE_API AZMode GetAZModeForName(const Aws::String& name);
 
-AWS_ELASTICACHE_API Aws::String GetNameForAZMode(AZMode value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICACHE_API const char* GetNameForAZMode(AZMode value);
 } // namespace AZModeMapper
 } // namespace Model
 } // namespace ElastiCache
@@ -36,7 +36,8 @@ namespace AutomaticFailoverStatusMapper
 {
 AWS_ELASTICACHE_API AutomaticFailoverStatus GetAutomaticFailoverStatusForName(const Aws::String& name);
 
-AWS_ELASTICACHE_API Aws::String GetNameForAutomaticFailoverStatus(AutomaticFailoverStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICACHE_API const char* GetNameForAutomaticFailoverStatus(AutomaticFailoverStatus value);
 } // namespace AutomaticFailoverStatusMapper
 } // namespace Model
 } // namespace ElastiCache
@@ -34,7 +34,8 @@ namespace ChangeTypeMapper
 {
 AWS_ELASTICACHE_API ChangeType GetChangeTypeForName(const Aws::String& name);
 
-AWS_ELASTICACHE_API Aws::String GetNameForChangeType(ChangeType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICACHE_API const char* GetNameForChangeType(ChangeType value);
 } // namespace ChangeTypeMapper
 } // namespace Model
 } // namespace ElastiCache
@@ -34,7 +34,8 @@ namespace PendingAutomaticFailoverStatusMapper
 {
 AWS_ELASTICACHE_API PendingAutomaticFailoverStatus GetPendingAutomaticFailoverStatusForName(const Aws::String& name);
 
-AWS_ELASTICACHE_API Aws::String GetNameForPendingAutomaticFailoverStatus(PendingAutomaticFailoverStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICACHE_API const char* GetNameForPendingAutomaticFailoverStatus(PendingAutomaticFailoverStatus value);
 } // namespace PendingAutomaticFailoverStatusMapper
 } // namespace Model
 } // namespace ElastiCache
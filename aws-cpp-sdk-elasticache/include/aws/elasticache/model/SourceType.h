@@ -37,7 +37,8 @@ namespace SourceTypeMapper
 {
 AWS_ELASTICACHE_API SourceType GetSourceTypeForName(const Aws::String& name);
 
-AWS_ELASTICACHE_API Aws::String GetNameForSourceType(SourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICACHE_API const char* GetNameForSourceType(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace ElastiCache
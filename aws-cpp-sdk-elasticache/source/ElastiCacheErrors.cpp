@@ -28,50 +28,50 @@ namespace ElastiCache
 namespace ElastiCacheErrorMapper
 {
 
-static const int A_P_I_CALL_RATE_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::HashString("APICallRateForCustomerExceeded");
-static const int SNAPSHOT_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SnapshotNotFoundFault");
-static const int CACHE_PARAMETER_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("CacheParameterGroupAlreadyExists");
-static const int SNAPSHOT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("SnapshotQuotaExceededFault");
-static const int INVALID_REPLICATION_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidReplicationGroupState");
-static const int INSUFFICIENT_CACHE_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::HashString("InsufficientCacheClusterCapacity");
-static const int RESERVED_CACHE_NODE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ReservedCacheNodeQuotaExceeded");
-static const int INVALID_CACHE_CLUSTER_STATE_FAULT_HASH = HashingUtils::HashString("InvalidCacheClusterState");
-static const int REPLICATION_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ReplicationGroupAlreadyExists");
-static const int CACHE_SUBNET_GROUP_IN_USE_HASH = HashingUtils::HashString("CacheSubnetGroupInUse");
-static const int TAG_QUOTA_PER_RESOURCE_EXCEEDED_HASH = HashingUtils::HashString("TagQuotaPerResourceExceeded");
-static const int INVALID_SNAPSHOT_STATE_FAULT_HASH = HashingUtils::HashString("InvalidSnapshotState");
-static const int INVALID_V_P_C_NETWORK_STATE_FAULT_HASH = HashingUtils::HashString("InvalidVPCNetworkStateFault");
-static const int NODE_GROUPS_PER_REPLICATION_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("NodeGroupsPerReplicationGroupQuotaExceeded");
-static const int NODE_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("NodeGroupNotFoundFault");
-static const int INVALID_CACHE_PARAMETER_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidCacheParameterGroupState");
-static const int TEST_FAILOVER_NOT_AVAILABLE_FAULT_HASH = HashingUtils::HashString("TestFailoverNotAvailableFault");
-static const int NODE_QUOTA_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::HashString("NodeQuotaForCustomerExceeded");
-static const int AUTHORIZATION_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("AuthorizationNotFound");
-static const int CACHE_PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("CacheParameterGroupNotFound");
-static const int NODE_QUOTA_FOR_CLUSTER_EXCEEDED_FAULT_HASH = HashingUtils::HashString("NodeQuotaForClusterExceeded");
-static const int SNAPSHOT_FEATURE_NOT_SUPPORTED_FAULT_HASH = HashingUtils::HashString("SnapshotFeatureNotSupportedFault");
-static const int CACHE_SUBNET_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("CacheSubnetGroupNotFoundFault");
-static const int CACHE_CLUSTER_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("CacheClusterNotFound");
-static const int INVALID_SUBNET_HASH = HashingUtils::HashString("InvalidSubnet");
-static const int AUTHORIZATION_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("AuthorizationAlreadyExists");
-static const int CLUSTER_QUOTA_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ClusterQuotaForCustomerExceeded");
-static const int RESERVED_CACHE_NODES_OFFERING_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ReservedCacheNodesOfferingNotFound");
-static const int RESERVED_CACHE_NODE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ReservedCacheNodeNotFound");
-static const int TAG_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("TagNotFound");
-static const int INVALID_A_R_N_FAULT_HASH = HashingUtils::HashString("InvalidARN");
-static const int CACHE_SECURITY_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("CacheSecurityGroupNotFound");
-static const int SUBNET_IN_USE_HASH = HashingUtils::HashString("SubnetInUse");
-static const int SNAPSHOT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("SnapshotAlreadyExistsFault");
-static const int CACHE_CLUSTER_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("CacheClusterAlreadyExists");
-static const int CACHE_SECURITY_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("QuotaExceeded.CacheSecurityGroup");
-static const int CACHE_PARAMETER_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("CacheParameterGroupQuotaExceeded");
-static const int CACHE_SUBNET_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("CacheSubnetGroupQuotaExceeded");
-static const int CACHE_SECURITY_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("CacheSecurityGroupAlreadyExists");
-static const int RESERVED_CACHE_NODE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ReservedCacheNodeAlreadyExists");
-static const int INVALID_CACHE_SECURITY_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidCacheSecurityGroupState");
-static const int REPLICATION_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ReplicationGroupNotFoundFault");
-static const int CACHE_SUBNET_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("CacheSubnetGroupAlreadyExists");
-static const int CACHE_SUBNET_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("CacheSubnetQuotaExceededFault");
+static constexpr int A_P_I_CALL_RATE_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("APICallRateForCustomerExceeded");
+static constexpr int SNAPSHOT_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotNotFoundFault");
+static constexpr int CACHE_PARAMETER_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheParameterGroupAlreadyExists");
+static constexpr int SNAPSHOT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotQuotaExceededFault");
+static constexpr int INVALID_REPLICATION_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidReplicationGroupState");
+static constexpr int INSUFFICIENT_CACHE_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::CompileTimeHashString("InsufficientCacheClusterCapacity");
+static constexpr int RESERVED_CACHE_NODE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ReservedCacheNodeQuotaExceeded");
+static constexpr int INVALID_CACHE_CLUSTER_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidCacheClusterState");
+static constexpr int REPLICATION_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ReplicationGroupAlreadyExists");
+static constexpr int CACHE_SUBNET_GROUP_IN_USE_HASH = HashingUtils::CompileTimeHashString("CacheSubnetGroupInUse");
+static constexpr int TAG_QUOTA_PER_RESOURCE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TagQuotaPerResourceExceeded");
+static constexpr int INVALID_SNAPSHOT_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidSnapshotState");
+static constexpr int INVALID_V_P_C_NETWORK_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidVPCNetworkStateFault");
+static constexpr int NODE_GROUPS_PER_REPLICATION_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("NodeGroupsPerReplicationGroupQuotaExceeded");
+static constexpr int NODE_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("NodeGroupNotFoundFault");
+static constexpr int INVALID_CACHE_PARAMETER_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidCacheParameterGroupState");
+static constexpr int TEST_FAILOVER_NOT_AVAILABLE_FAULT_HASH = HashingUtils::CompileTimeHashString("TestFailoverNotAvailableFault");
+static constexpr int NODE_QUOTA_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("NodeQuotaForCustomerExceeded");
+static constexpr int AUTHORIZATION_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("AuthorizationNotFound");
+static constexpr int CACHE_PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheParameterGroupNotFound");
+static constexpr int NODE_QUOTA_FOR_CLUSTER_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("NodeQuotaForClusterExceeded");
+static constexpr int SNAPSHOT_FEATURE_NOT_SUPPORTED_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotFeatureNotSupportedFault");
+static constexpr int CACHE_SUBNET_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheSubnetGroupNotFoundFault");
+static constexpr int CACHE_CLUSTER_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheClusterNotFound");
+static constexpr int INVALID_SUBNET_HASH = HashingUtils::CompileTimeHashString("InvalidSubnet");
+static constexpr int AUTHORIZATION_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("AuthorizationAlreadyExists");
+static constexpr int CLUSTER_QUOTA_FOR_CUSTOMER_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterQuotaForCustomerExceeded");
+static constexpr int RESERVED_CACHE_NODES_OFFERING_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ReservedCacheNodesOfferingNotFound");
+static constexpr int RESERVED_CACHE_NODE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ReservedCacheNodeNotFound");
+static constexpr int TAG_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("TagNotFound");
+static constexpr int INVALID_A_R_N_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidARN");
+static constexpr int CACHE_SECURITY_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheSecurityGroupNotFound");
+static constexpr int SUBNET_IN_USE_HASH = HashingUtils::CompileTimeHashString("SubnetInUse");
+static constexpr int SNAPSHOT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotAlreadyExistsFault");
+static constexpr int CACHE_CLUSTER_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheClusterAlreadyExists");
+static constexpr int CACHE_SECURITY_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("QuotaExceeded.CacheSecurityGroup");
+static constexpr int CACHE_PARAMETER_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheParameterGroupQuotaExceeded");
+static constexpr int CACHE_SUBNET_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheSubnetGroupQuotaExceeded");
+static constexpr int CACHE_SECURITY_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheSecurityGroupAlreadyExists");
+static constexpr int RESERVED_CACHE_NODE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ReservedCacheNodeAlreadyExists");
+static constexpr int INVALID_CACHE_SECURITY_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidCacheSecurityGroupState");
+static constexpr int REPLICATION_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ReplicationGroupNotFoundFault");
+static constexpr int CACHE_SUBNET_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheSubnetGroupAlreadyExists");
+static constexpr int CACHE_SUBNET_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("CacheSubnetQuotaExceededFault");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace AZModeMapper
       {
 
-        static const int single_az_HASH = HashingUtils::HashString("single-az");
-        static const int cross_az_HASH = HashingUtils::HashString("cross-az");
+        static constexpr int single_az_HASH = HashingUtils::CompileTimeHashString("single-az");
+        static constexpr int cross_az_HASH = HashingUtils::CompileTimeHashString("cross-az");
 
 
         AZMode GetAZModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == single_az_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AZMode::single_az;
-          }
-          else if (hashCode == cross_az_HASH)
-          {
-            return AZMode::cross_az;
+          case single_az_HASH:
+            if (name == "single-az")
+            {
+              return AZMode::single_az;
+            }
+            break;
+          case cross_az_HASH:
+            if (name == "cross-az")
+            {
+              return AZMode::cross_az;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AZMode::NOT_SET;
         }
 
-        Aws::String GetNameForAZMode(AZMode enumValue)
+        const char* GetNameForAZMode(AZMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
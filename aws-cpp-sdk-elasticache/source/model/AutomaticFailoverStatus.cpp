@@ -30,30 +30,44 @@ namespace Aws
       namespace AutomaticFailoverStatusMapper
       {
 
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
-        static const int enabling_HASH = HashingUtils::HashString("enabling");
-        static const int disabling_HASH = HashingUtils::HashString("disabling");
+        static constexpr int enabled_HASH = HashingUtils::CompileTimeHashString("enabled");
+        static constexpr int disabled_HASH = HashingUtils::CompileTimeHashString("disabled");
+        static constexpr int enabling_HASH = HashingUtils::CompileTimeHashString("enabling");
+        static constexpr int disabling_HASH = HashingUtils::CompileTimeHashString("disabling");
 
 
         AutomaticFailoverStatus GetAutomaticFailoverStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enabled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AutomaticFailoverStatus::enabled;
-          }
-          else if (hashCode == disabled_HASH)
-          {
-            return AutomaticFailoverStatus::disabled;
-          }
-          else if (hashCode == enabling_HASH)
-          {
-            return AutomaticFailoverStatus::enabling;
-          }
-          else if (hashCode == disabling_HASH)
-          {
-            return AutomaticFailoverStatus::disabling;
+          case enabled_HASH:
+            if (name == "enabled")
+            {
+              return AutomaticFailoverStatus::enabled;
+            }
+            break;
+          case disabled_HASH:
+            if (name == "disabled")
+            {
+              return AutomaticFailoverStatus::disabled;
+            }
+            break;
+          case enabling_HASH:
+            if (name == "enabling")
+            {
+              return AutomaticFailoverStatus::enabling;
+            }
+            break;
+          case disabling_HASH:
+            if (name == "disabling")
+            {
+              return AutomaticFailoverStatus::disabling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AutomaticFailoverStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAutomaticFailoverStatus(AutomaticFailoverStatus enumValue)
+        const char* GetNameForAutomaticFailoverStatus(AutomaticFailoverStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
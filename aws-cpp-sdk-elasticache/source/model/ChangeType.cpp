@@ -30,20 +30,30 @@ namespace Aws
       namespace ChangeTypeMapper
       {
 
-        static const int immediate_HASH = HashingUtils::HashString("immediate");
-        static const int requires_reboot_HASH = HashingUtils::HashString("requires-reboot");
+        static constexpr int immediate_HASH = HashingUtils::CompileTimeHashString("immediate");
+        static constexpr int requires_reboot_HASH = HashingUtils::CompileTimeHashString("requires-reboot");
 
 
         ChangeType GetChangeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == immediate_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeType::immediate;
-          }
-          else if (hashCode == requires_reboot_HASH)
-          {
-            return ChangeType::requires_reboot;
+          case immediate_HASH:
+            if (name == "immediate")
+            {
+              return ChangeType::immediate;
+            }
+            break;
+          case requires_reboot_HASH:
+            if (name == "requires-reboot")
+            {
+              return ChangeType::requires_reboot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ChangeType::NOT_SET;
         }
 
-        Aws::String GetNameForChangeType(ChangeType enumValue)
+        const char* GetNameForChangeType(ChangeType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PendingAutomaticFailoverStatusMapper
       {
 
-        static const int enabled_HASH = HashingUtils::HashString("enabled");
-        static const int disabled_HASH = HashingUtils::HashString("disabled");
+        static constexpr int enabled_HASH = HashingUtils::CompileTimeHashString("enabled");
+        static constexpr int disabled_HASH = HashingUtils::CompileTimeHashString("disabled");
 
 
         PendingAutomaticFailoverStatus GetPendingAutomaticFailoverStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == enabled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PendingAutomaticFailoverStatus::enabled;
-          }
-          else if (hashCode == disabled_HASH)
-          {
-            return PendingAutomaticFailoverStatus::disabled;
+          case enabled_HASH:
+            if (name == "enabled")
+            {
+              return PendingAutomaticFailoverStatus::enabled;
+            }
+            break;
+          case disabled_HASH:
+            if (name == "disabled")
+            {
+              return PendingAutomaticFailoverStatus::disabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PendingAutomaticFailoverStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPendingAutomaticFailoverStatus(PendingAutomaticFailoverStatus enumValue)
+        const char* GetNameForPendingAutomaticFailoverStatus(PendingAutomaticFailoverStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int cache_cluster_HASH = HashingUtils::HashString("cache-cluster");
-        static const int cache_parameter_group_HASH = HashingUtils::HashString("cache-parameter-group");
-        static const int cache_security_group_HASH = HashingUtils::HashString("cache-security-group");
-        static const int cache_subnet_group_HASH = HashingUtils::HashString("cache-subnet-group");
-        static const int replication_group_HASH = HashingUtils::HashString("replication-group");
+        static constexpr int cache_cluster_HASH = HashingUtils::CompileTimeHashString("cache-cluster");
+        static constexpr int cache_parameter_group_HASH = HashingUtils::CompileTimeHashString("cache-parameter-group");
+        static constexpr int cache_security_group_HASH = HashingUtils::CompileTimeHashString("cache-security-group");
+        static constexpr int cache_subnet_group_HASH = HashingUtils::CompileTimeHashString("cache-subnet-group");
+        static constexpr int replication_group_HASH = HashingUtils::CompileTimeHashString("replication-group");
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cache_cluster_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceType::cache_cluster;
-          }
-          else if (hashCode == cache_parameter_group_HASH)
-          {
-            return SourceType::cache_parameter_group;
-          }
-          else if (hashCode == cache_security_group_HASH)
-          {
-            return SourceType::cache_security_group;
-          }
-          else if (hashCode == cache_subnet_group_HASH)
-          {
-            return SourceType::cache_subnet_group;
-          }
-          else if (hashCode == replication_group_HASH)
-          {
-            return SourceType::replication_group;
+          case cache_cluster_HASH:
+            if (name == "cache-cluster")
+            {
+              return SourceType::cache_cluster;
+            }
+            break;
+          case cache_parameter_group_HASH:
+            if (name == "cache-parameter-group")
+            {
+              return SourceType::cache_parameter_group;
+            }
+            break;
+          case cache_security_group_HASH:
+            if (name == "cache-security-group")
+            {
+              return SourceType::cache_security_group;
+            }
+            break;
+          case cache_subnet_group_HASH:
+            if (name == "cache-subnet-group")
+            {
+              return SourceType::cache_subnet_group;
+            }
+            break;
+          case replication_group_HASH:
+            if (name == "replication-group")
+            {
+              return SourceType::replication_group;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceType(SourceType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
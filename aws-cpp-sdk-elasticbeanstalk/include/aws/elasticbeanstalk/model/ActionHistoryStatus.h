@@ -35,7 +35,8 @@ namespace ActionHistoryStatusMapper
 {
 AWS_ELASTICBEANSTALK_API ActionHistoryStatus GetActionHistoryStatusForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForActionHistoryStatus(ActionHistoryStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForActionHistoryStatus(ActionHistoryStatus value);
 } // namespace ActionHistoryStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
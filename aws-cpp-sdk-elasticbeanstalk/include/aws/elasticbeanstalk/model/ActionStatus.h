@@ -36,7 +36,8 @@ namespace ActionStatusMapper
 {
 AWS_ELASTICBEANSTALK_API ActionStatus GetActionStatusForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForActionStatus(ActionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForActionStatus(ActionStatus value);
 } // namespace ActionStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -35,7 +35,8 @@ namespace ActionTypeMapper
 {
 AWS_ELASTICBEANSTALK_API ActionType GetActionTypeForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForActionType(ActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForActionType(ActionType value);
 } // namespace ActionTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
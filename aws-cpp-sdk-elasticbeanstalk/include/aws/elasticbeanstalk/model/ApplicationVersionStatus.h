@@ -37,7 +37,8 @@ namespace ApplicationVersionStatusMapper
 {
 AWS_ELASTICBEANSTALK_API ApplicationVersionStatus GetApplicationVersionStatusForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForApplicationVersionStatus(ApplicationVersionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForApplicationVersionStatus(ApplicationVersionStatus value);
 } // namespace ApplicationVersionStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -35,7 +35,8 @@ namespace ComputeTypeMapper
 {
 AWS_ELASTICBEANSTALK_API ComputeType GetComputeTypeForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForComputeType(ComputeType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForComputeType(ComputeType value);
 } // namespace ComputeTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -35,7 +35,8 @@ namespace ConfigurationDeploymentStatusMapper
 {
 AWS_ELASTICBEANSTALK_API ConfigurationDeploymentStatus GetConfigurationDeploymentStatusForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForConfigurationDeploymentStatus(ConfigurationDeploymentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForConfigurationDeploymentStatus(ConfigurationDeploymentStatus value);
 } // namespace ConfigurationDeploymentStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
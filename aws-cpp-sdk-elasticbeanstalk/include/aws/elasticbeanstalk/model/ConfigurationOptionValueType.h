@@ -34,7 +34,8 @@ namespace ConfigurationOptionValueTypeMapper
 {
 AWS_ELASTICBEANSTALK_API ConfigurationOptionValueType GetConfigurationOptionValueTypeForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForConfigurationOptionValueType(ConfigurationOptionValueType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForConfigurationOptionValueType(ConfigurationOptionValueType value);
 } // namespace ConfigurationOptionValueTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -36,7 +36,8 @@ namespace EnvironmentHealthMapper
 {
 AWS_ELASTICBEANSTALK_API EnvironmentHealth GetEnvironmentHealthForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentHealth(EnvironmentHealth value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentHealth(EnvironmentHealth value);
 } // namespace EnvironmentHealthMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
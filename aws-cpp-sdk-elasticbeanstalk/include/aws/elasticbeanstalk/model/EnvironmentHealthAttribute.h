@@ -40,7 +40,8 @@ namespace EnvironmentHealthAttributeMapper
 {
 AWS_ELASTICBEANSTALK_API EnvironmentHealthAttribute GetEnvironmentHealthAttributeForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentHealthAttribute(EnvironmentHealthAttribute value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentHealthAttribute(EnvironmentHealthAttribute value);
 } // namespace EnvironmentHealthAttributeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
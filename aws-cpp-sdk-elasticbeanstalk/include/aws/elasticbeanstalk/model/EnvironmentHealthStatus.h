@@ -41,7 +41,8 @@ namespace EnvironmentHealthStatusMapper
 {
 AWS_ELASTICBEANSTALK_API EnvironmentHealthStatus GetEnvironmentHealthStatusForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentHealthStatus(EnvironmentHealthStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentHealthStatus(EnvironmentHealthStatus value);
 } // namespace EnvironmentHealthStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
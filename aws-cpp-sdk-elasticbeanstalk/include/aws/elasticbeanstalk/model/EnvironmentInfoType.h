@@ -34,7 +34,8 @@ namespace EnvironmentInfoTypeMapper
 {
 AWS_ELASTICBEANSTALK_API EnvironmentInfoType GetEnvironmentInfoTypeForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentInfoType(EnvironmentInfoType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentInfoType(EnvironmentInfoType value);
 } // namespace EnvironmentInfoTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -37,7 +37,8 @@ namespace EnvironmentStatusMapper
 {
 AWS_ELASTICBEANSTALK_API EnvironmentStatus GetEnvironmentStatusForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForEnvironmentStatus(EnvironmentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForEnvironmentStatus(EnvironmentStatus value);
 } // namespace EnvironmentStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
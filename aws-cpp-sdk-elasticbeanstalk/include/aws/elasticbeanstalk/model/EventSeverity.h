@@ -38,7 +38,8 @@ namespace EventSeverityMapper
 {
 AWS_ELASTICBEANSTALK_API EventSeverity GetEventSeverityForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForEventSeverity(EventSeverity value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForEventSeverity(EventSeverity value);
 } // namespace EventSeverityMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -39,7 +39,8 @@ namespace FailureTypeMapper
 {
 AWS_ELASTICBEANSTALK_API FailureType GetFailureTypeForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForFailureType(FailureType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForFailureType(FailureType value);
 } // namespace FailureTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
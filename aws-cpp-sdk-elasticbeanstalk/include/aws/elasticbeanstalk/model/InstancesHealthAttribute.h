@@ -43,7 +43,8 @@ namespace InstancesHealthAttributeMapper
 {
 AWS_ELASTICBEANSTALK_API InstancesHealthAttribute GetInstancesHealthAttributeForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForInstancesHealthAttribute(InstancesHealthAttribute value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForInstancesHealthAttribute(InstancesHealthAttribute value);
 } // namespace InstancesHealthAttributeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -37,7 +37,8 @@ namespace PlatformStatusMapper
 {
 AWS_ELASTICBEANSTALK_API PlatformStatus GetPlatformStatusForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForPlatformStatus(PlatformStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForPlatformStatus(PlatformStatus value);
 } // namespace PlatformStatusMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -34,7 +34,8 @@ namespace SourceRepositoryMapper
 {
 AWS_ELASTICBEANSTALK_API SourceRepository GetSourceRepositoryForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForSourceRepository(SourceRepository value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForSourceRepository(SourceRepository value);
 } // namespace SourceRepositoryMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
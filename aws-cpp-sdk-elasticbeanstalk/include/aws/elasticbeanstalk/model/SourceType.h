@@ -34,7 +34,8 @@ namespace SourceTypeMapper
 {
 AWS_ELASTICBEANSTALK_API SourceType GetSourceTypeForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForSourceType(SourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForSourceType(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -34,7 +34,8 @@ namespace ValidationSeverityMapper
 {
 AWS_ELASTICBEANSTALK_API ValidationSeverity GetValidationSeverityForName(const Aws::String& name);
 
-AWS_ELASTICBEANSTALK_API Aws::String GetNameForValidationSeverity(ValidationSeverity value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICBEANSTALK_API const char* GetNameForValidationSeverity(ValidationSeverity value);
 } // namespace ValidationSeverityMapper
 } // namespace Model
 } // namespace ElasticBeanstalk
@@ -28,24 +28,24 @@ namespace ElasticBeanstalk
 namespace ElasticBeanstalkErrorMapper
 {
 
-static const int SOURCE_BUNDLE_DELETION_HASH = HashingUtils::HashString("SourceBundleDeletionFailure");
-static const int INSUFFICIENT_PRIVILEGES_HASH = HashingUtils::HashString("InsufficientPrivilegesException");
-static const int MANAGED_ACTION_INVALID_STATE_HASH = HashingUtils::HashString("ManagedActionInvalidStateException");
-static const int TOO_MANY_APPLICATION_VERSIONS_HASH = HashingUtils::HashString("TooManyApplicationVersionsException");
-static const int TOO_MANY_PLATFORMS_HASH = HashingUtils::HashString("TooManyPlatformsException");
-static const int TOO_MANY_TAGS_HASH = HashingUtils::HashString("TooManyTagsException");
-static const int CODE_BUILD_NOT_IN_SERVICE_REGION_HASH = HashingUtils::HashString("CodeBuildNotInServiceRegionException");
-static const int TOO_MANY_CONFIGURATION_TEMPLATES_HASH = HashingUtils::HashString("TooManyConfigurationTemplatesException");
-static const int S3_LOCATION_NOT_IN_SERVICE_REGION_HASH = HashingUtils::HashString("S3LocationNotInServiceRegionException");
-static const int TOO_MANY_APPLICATIONS_HASH = HashingUtils::HashString("TooManyApplicationsException");
-static const int OPERATION_IN_PROGRESS_HASH = HashingUtils::HashString("OperationInProgressFailure");
-static const int S3_SUBSCRIPTION_REQUIRED_HASH = HashingUtils::HashString("S3SubscriptionRequiredException");
-static const int TOO_MANY_BUCKETS_HASH = HashingUtils::HashString("TooManyBucketsException");
-static const int TOO_MANY_ENVIRONMENTS_HASH = HashingUtils::HashString("TooManyEnvironmentsException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int ELASTIC_BEANSTALK_SERVICE_HASH = HashingUtils::HashString("ElasticBeanstalkServiceException");
-static const int RESOURCE_TYPE_NOT_SUPPORTED_HASH = HashingUtils::HashString("ResourceTypeNotSupportedException");
-static const int PLATFORM_VERSION_STILL_REFERENCED_HASH = HashingUtils::HashString("PlatformVersionStillReferencedException");
+static constexpr int SOURCE_BUNDLE_DELETION_HASH = HashingUtils::CompileTimeHashString("SourceBundleDeletionFailure");
+static constexpr int INSUFFICIENT_PRIVILEGES_HASH = HashingUtils::CompileTimeHashString("InsufficientPrivilegesException");
+static constexpr int MANAGED_ACTION_INVALID_STATE_HASH = HashingUtils::CompileTimeHashString("ManagedActionInvalidStateException");
+static constexpr int TOO_MANY_APPLICATION_VERSIONS_HASH = HashingUtils::CompileTimeHashString("TooManyApplicationVersionsException");
+static constexpr int TOO_MANY_PLATFORMS_HASH = HashingUtils::CompileTimeHashString("TooManyPlatformsException");
+static constexpr int TOO_MANY_TAGS_HASH = HashingUtils::CompileTimeHashString("TooManyTagsException");
+static constexpr int CODE_BUILD_NOT_IN_SERVICE_REGION_HASH = HashingUtils::CompileTimeHashString("CodeBuildNotInServiceRegionException");
+static constexpr int TOO_MANY_CONFIGURATION_TEMPLATES_HASH = HashingUtils::CompileTimeHashString("TooManyConfigurationTemplatesException");
+static constexpr int S3_LOCATION_NOT_IN_SERVICE_REGION_HASH = HashingUtils::CompileTimeHashString("S3LocationNotInServiceRegionException");
+static constexpr int TOO_MANY_APPLICATIONS_HASH = HashingUtils::CompileTimeHashString("TooManyApplicationsException");
+static constexpr int OPERATION_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("OperationInProgressFailure");
+static constexpr int S3_SUBSCRIPTION_REQUIRED_HASH = HashingUtils::CompileTimeHashString("S3SubscriptionRequiredException");
+static constexpr int TOO_MANY_BUCKETS_HASH = HashingUtils::CompileTimeHashString("TooManyBucketsException");
+static constexpr int TOO_MANY_ENVIRONMENTS_HASH = HashingUtils::CompileTimeHashString("TooManyEnvironmentsException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int ELASTIC_BEANSTALK_SERVICE_HASH = HashingUtils::CompileTimeHashString("ElasticBeanstalkServiceException");
+static constexpr int RESOURCE_TYPE_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("ResourceTypeNotSupportedException");
+static constexpr int PLATFORM_VERSION_STILL_REFERENCED_HASH = HashingUtils::CompileTimeHashString("PlatformVersionStillReferencedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace ActionHistoryStatusMapper
       {
 
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        static constexpr int Completed_HASH = HashingUtils::CompileTimeHashString("Completed");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Unknown_HASH = HashingUtils::CompileTimeHashString("Unknown");
 
 
         ActionHistoryStatus GetActionHistoryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Completed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionHistoryStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ActionHistoryStatus::Failed;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return ActionHistoryStatus::Unknown;
+          case Completed_HASH:
+            if (name == "Completed")
+            {
+              return ActionHistoryStatus::Completed;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return ActionHistoryStatus::Failed;
+            }
+            break;
+          case Unknown_HASH:
+            if (name == "Unknown")
+            {
+              return ActionHistoryStatus::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ActionHistoryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForActionHistoryStatus(ActionHistoryStatus enumValue)
+        const char* GetNameForActionHistoryStatus(ActionHistoryStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ActionStatusMapper
       {
 
-        static const int Scheduled_HASH = HashingUtils::HashString("Scheduled");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Running_HASH = HashingUtils::HashString("Running");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        static constexpr int Scheduled_HASH = HashingUtils::CompileTimeHashString("Scheduled");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Running_HASH = HashingUtils::CompileTimeHashString("Running");
+        static constexpr int Unknown_HASH = HashingUtils::CompileTimeHashString("Unknown");
 
 
         ActionStatus GetActionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Scheduled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionStatus::Scheduled;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return ActionStatus::Pending;
-          }
-          else if (hashCode == Running_HASH)
-          {
-            return ActionStatus::Running;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return ActionStatus::Unknown;
+          case Scheduled_HASH:
+            if (name == "Scheduled")
+            {
+              return ActionStatus::Scheduled;
+            }
+            break;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return ActionStatus::Pending;
+            }
+            break;
+          case Running_HASH:
+            if (name == "Running")
+            {
+              return ActionStatus::Running;
+            }
+            break;
+          case Unknown_HASH:
+            if (name == "Unknown")
+            {
+              return ActionStatus::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ActionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForActionStatus(ActionStatus enumValue)
+        const char* GetNameForActionStatus(ActionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ActionTypeMapper
       {
 
-        static const int InstanceRefresh_HASH = HashingUtils::HashString("InstanceRefresh");
-        static const int PlatformUpdate_HASH = HashingUtils::HashString("PlatformUpdate");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        static constexpr int InstanceRefresh_HASH = HashingUtils::CompileTimeHashString("InstanceRefresh");
+        static constexpr int PlatformUpdate_HASH = HashingUtils::CompileTimeHashString("PlatformUpdate");
+        static constexpr int Unknown_HASH = HashingUtils::CompileTimeHashString("Unknown");
 
 
         ActionType GetActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceRefresh_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionType::InstanceRefresh;
-          }
-          else if (hashCode == PlatformUpdate_HASH)
-          {
-            return ActionType::PlatformUpdate;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return ActionType::Unknown;
+          case InstanceRefresh_HASH:
+            if (name == "InstanceRefresh")
+            {
+              return ActionType::InstanceRefresh;
+            }
+            break;
+          case PlatformUpdate_HASH:
+            if (name == "PlatformUpdate")
+            {
+              return ActionType::PlatformUpdate;
+            }
+            break;
+          case Unknown_HASH:
+            if (name == "Unknown")
+            {
+              return ActionType::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ActionType::NOT_SET;
         }
 
-        Aws::String GetNameForActionType(ActionType enumValue)
+        const char* GetNameForActionType(ActionType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
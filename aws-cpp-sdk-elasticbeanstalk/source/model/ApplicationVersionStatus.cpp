@@ -30,35 +30,51 @@ namespace Aws
       namespace ApplicationVersionStatusMapper
       {
 
-        static const int Processed_HASH = HashingUtils::HashString("Processed");
-        static const int Unprocessed_HASH = HashingUtils::HashString("Unprocessed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Processing_HASH = HashingUtils::HashString("Processing");
-        static const int Building_HASH = HashingUtils::HashString("Building");
+        static constexpr int Processed_HASH = HashingUtils::CompileTimeHashString("Processed");
+        static constexpr int Unprocessed_HASH = HashingUtils::CompileTimeHashString("Unprocessed");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Processing_HASH = HashingUtils::CompileTimeHashString("Processing");
+        static constexpr int Building_HASH = HashingUtils::CompileTimeHashString("Building");
 
 
         ApplicationVersionStatus GetApplicationVersionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Processed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ApplicationVersionStatus::Processed;
-          }
-          else if (hashCode == Unprocessed_HASH)
-          {
-            return ApplicationVersionStatus::Unprocessed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ApplicationVersionStatus::Failed;
-          }
-          else if (hashCode == Processing_HASH)
-          {
-            return ApplicationVersionStatus::Processing;
-          }
-          else if (hashCode == Building_HASH)
-          {
-            return ApplicationVersionStatus::Building;
+          case Processed_HASH:
+            if (name == "Processed")
+            {
+              return ApplicationVersionStatus::Processed;
+            }
+            break;
+          case Unprocessed_HASH:
+            if (name == "Unprocessed")
+            {
+              return ApplicationVersionStatus::Unprocessed;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return ApplicationVersionStatus::Failed;
+            }
+            break;
+          case Processing_HASH:
+            if (name == "Processing")
+            {
+              return ApplicationVersionStatus::Processing;
+            }
+            break;
+          case Building_HASH:
+            if (name == "Building")
+            {
+              return ApplicationVersionStatus::Building;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ApplicationVersionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForApplicationVersionStatus(ApplicationVersionStatus enumValue)
+        const char* GetNameForApplicationVersionStatus(ApplicationVersionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ComputeTypeMapper
       {
 
-        static const int BUILD_GENERAL1_SMALL_HASH = HashingUtils::HashString("BUILD_GENERAL1_SMALL");
-        static const int BUILD_GENERAL1_MEDIUM_HASH = HashingUtils::HashString("BUILD_GENERAL1_MEDIUM");
-        static const int BUILD_GENERAL1_LARGE_HASH = HashingUtils::HashString("BUILD_GENERAL1_LARGE");
+        static constexpr int BUILD_GENERAL1_SMALL_HASH = HashingUtils::CompileTimeHashString("BUILD_GENERAL1_SMALL");
+        static constexpr int BUILD_GENERAL1_MEDIUM_HASH = HashingUtils::CompileTimeHashString("BUILD_GENERAL1_MEDIUM");
+        static constexpr int BUILD_GENERAL1_LARGE_HASH = HashingUtils::CompileTimeHashString("BUILD_GENERAL1_LARGE");
 
 
         ComputeType GetComputeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BUILD_GENERAL1_SMALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComputeType::BUILD_GENERAL1_SMALL;
-          }
-          else if (hashCode == BUILD_GENERAL1_MEDIUM_HASH)
-          {
-            return ComputeType::BUILD_GENERAL1_MEDIUM;
-          }
-          else if (hashCode == BUILD_GENERAL1_LARGE_HASH)
-          {
-            return ComputeType::BUILD_GENERAL1_LARGE;
+          case BUILD_GENERAL1_SMALL_HASH:
+            if (name == "BUILD_GENERAL1_SMALL")
+            {
+              return ComputeType::BUILD_GENERAL1_SMALL;
+            }
+            break;
+          case BUILD_GENERAL1_MEDIUM_HASH:
+            if (name == "BUILD_GENERAL1_MEDIUM")
+            {
+              return ComputeType::BUILD_GENERAL1_MEDIUM;
+            }
+            break;
+          case BUILD_GENERAL1_LARGE_HASH:
+            if (name == "BUILD_GENERAL1_LARGE")
+            {
+              return ComputeType::BUILD_GENERAL1_LARGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ComputeType::NOT_SET;
         }
 
-        Aws::String GetNameForComputeType(ComputeType enumValue)
+        const char* GetNameForComputeType(ComputeType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ConfigurationDeploymentStatusMapper
       {
 
-        static const int deployed_HASH = HashingUtils::HashString("deployed");
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        static constexpr int deployed_HASH = HashingUtils::CompileTimeHashString("deployed");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
 
 
         ConfigurationDeploymentStatus GetConfigurationDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == deployed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConfigurationDeploymentStatus::deployed;
-          }
-          else if (hashCode == pending_HASH)
-          {
-            return ConfigurationDeploymentStatus::pending;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return ConfigurationDeploymentStatus::failed;
+          case deployed_HASH:
+            if (name == "deployed")
+            {
+              return ConfigurationDeploymentStatus::deployed;
+            }
+            break;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return ConfigurationDeploymentStatus::pending;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return ConfigurationDeploymentStatus::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ConfigurationDeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationDeploymentStatus(ConfigurationDeploymentStatus enumValue)
+        const char* GetNameForConfigurationDeploymentStatus(ConfigurationDeploymentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
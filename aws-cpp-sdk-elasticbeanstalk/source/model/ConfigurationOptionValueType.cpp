@@ -30,20 +30,30 @@ namespace Aws
       namespace ConfigurationOptionValueTypeMapper
       {
 
-        static const int Scalar_HASH = HashingUtils::HashString("Scalar");
-        static const int List_HASH = HashingUtils::HashString("List");
+        static constexpr int Scalar_HASH = HashingUtils::CompileTimeHashString("Scalar");
+        static constexpr int List_HASH = HashingUtils::CompileTimeHashString("List");
 
 
         ConfigurationOptionValueType GetConfigurationOptionValueTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Scalar_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConfigurationOptionValueType::Scalar;
-          }
-          else if (hashCode == List_HASH)
-          {
-            return ConfigurationOptionValueType::List;
+          case Scalar_HASH:
+            if (name == "Scalar")
+            {
+              return ConfigurationOptionValueType::Scalar;
+            }
+            break;
+          case List_HASH:
+            if (name == "List")
+            {
+              return ConfigurationOptionValueType::List;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ConfigurationOptionValueType::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationOptionValueType(ConfigurationOptionValueType enumValue)
+        const char* GetNameForConfigurationOptionValueType(ConfigurationOptionValueType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace EnvironmentHealthMapper
       {
 
-        static const int Green_HASH = HashingUtils::HashString("Green");
-        static const int Yellow_HASH = HashingUtils::HashString("Yellow");
-        static const int Red_HASH = HashingUtils::HashString("Red");
-        static const int Grey_HASH = HashingUtils::HashString("Grey");
+        static constexpr int Green_HASH = HashingUtils::CompileTimeHashString("Green");
+        static constexpr int Yellow_HASH = HashingUtils::CompileTimeHashString("Yellow");
+        static constexpr int Red_HASH = HashingUtils::CompileTimeHashString("Red");
+        static constexpr int Grey_HASH = HashingUtils::CompileTimeHashString("Grey");
 
 
         EnvironmentHealth GetEnvironmentHealthForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Green_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnvironmentHealth::Green;
-          }
-          else if (hashCode == Yellow_HASH)
-          {
-            return EnvironmentHealth::Yellow;
-          }
-          else if (hashCode == Red_HASH)
-          {
-            return EnvironmentHealth::Red;
-          }
-          else if (hashCode == Grey_HASH)
-          {
-            return EnvironmentHealth::Grey;
+          case Green_HASH:
+            if (name == "Green")
+            {
+              return EnvironmentHealth::Green;
+            }
+            break;
+          case Yellow_HASH:
+            if (name == "Yellow")
+            {
+              return EnvironmentHealth::Yellow;
+            }
+            break;
+          case Red_HASH:
+            if (name == "Red")
+            {
+              return EnvironmentHealth::Red;
+            }
+            break;
+          case Grey_HASH:
+            if (name == "Grey")
+            {
+              return EnvironmentHealth::Grey;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return EnvironmentHealth::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentHealth(EnvironmentHealth enumValue)
+        const char* GetNameForEnvironmentHealth(EnvironmentHealth enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace EnvironmentHealthAttributeMapper
       {
 
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Color_HASH = HashingUtils::HashString("Color");
-        static const int Causes_HASH = HashingUtils::HashString("Causes");
-        static const int ApplicationMetrics_HASH = HashingUtils::HashString("ApplicationMetrics");
-        static const int InstancesHealth_HASH = HashingUtils::HashString("InstancesHealth");
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int HealthStatus_HASH = HashingUtils::HashString("HealthStatus");
-        static const int RefreshedAt_HASH = HashingUtils::HashString("RefreshedAt");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
+        static constexpr int Color_HASH = HashingUtils::CompileTimeHashString("Color");
+        static constexpr int Causes_HASH = HashingUtils::CompileTimeHashString("Causes");
+        static constexpr int ApplicationMetrics_HASH = HashingUtils::CompileTimeHashString("ApplicationMetrics");
+        static constexpr int InstancesHealth_HASH = HashingUtils::CompileTimeHashString("InstancesHealth");
+        static constexpr int All_HASH = HashingUtils::CompileTimeHashString("All");
+        static constexpr int HealthStatus_HASH = HashingUtils::CompileTimeHashString("HealthStatus");
+        static constexpr int RefreshedAt_HASH = HashingUtils::CompileTimeHashString("RefreshedAt");
 
 
         EnvironmentHealthAttribute GetEnvironmentHealthAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Status_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnvironmentHealthAttribute::Status;
-          }
-          else if (hashCode == Color_HASH)
-          {
-            return EnvironmentHealthAttribute::Color;
-          }
-          else if (hashCode == Causes_HASH)
-          {
-            return EnvironmentHealthAttribute::Causes;
-          }
-          else if (hashCode == ApplicationMetrics_HASH)
-          {
-            return EnvironmentHealthAttribute::ApplicationMetrics;
-          }
-          else if (hashCode == InstancesHealth_HASH)
-          {
-            return EnvironmentHealthAttribute::InstancesHealth;
-          }
-          else if (hashCode == All_HASH)
-          {
-            return EnvironmentHealthAttribute::All;
-          }
-          else if (hashCode == HealthStatus_HASH)
-          {
-            return EnvironmentHealthAttribute::HealthStatus;
-          }
-          else if (hashCode == RefreshedAt_HASH)
-          {
-            return EnvironmentHealthAttribute::RefreshedAt;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return EnvironmentHealthAttribute::Status;
+            }
+            break;
+          case Color_HASH:
+            if (name == "Color")
+            {
+              return EnvironmentHealthAttribute::Color;
+            }
+            break;
+          case Causes_HASH:
+            if (name == "Causes")
+            {
+              return EnvironmentHealthAttribute::Causes;
+            }
+            break;
+          case ApplicationMetrics_HASH:
+            if (name == "ApplicationMetrics")
+            {
+              return EnvironmentHealthAttribute::ApplicationMetrics;
+            }
+            break;
+          case InstancesHealth_HASH:
+            if (name == "InstancesHealth")
+            {
+              return EnvironmentHealthAttribute::InstancesHealth;
+            }
+            break;
+          case All_HASH:
+            if (name == "All")
+            {
+              return EnvironmentHealthAttribute::All;
+            }
+            break;
+          case HealthStatus_HASH:
+            if (name == "HealthStatus")
+            {
+              return EnvironmentHealthAttribute::HealthStatus;
+            }
+            break;
+          case RefreshedAt_HASH:
+            if (name == "RefreshedAt")
+            {
+              return EnvironmentHealthAttribute::RefreshedAt;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return EnvironmentHealthAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentHealthAttribute(EnvironmentHealthAttribute enumValue)
+        const char* GetNameForEnvironmentHealthAttribute(EnvironmentHealthAttribute enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
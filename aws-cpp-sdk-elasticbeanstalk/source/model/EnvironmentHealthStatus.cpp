@@ -30,55 +30,79 @@ namespace Aws
       namespace EnvironmentHealthStatusMapper
       {
 
-        static const int NoData_HASH = HashingUtils::HashString("NoData");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Ok_HASH = HashingUtils::HashString("Ok");
-        static const int Info_HASH = HashingUtils::HashString("Info");
-        static const int Warning_HASH = HashingUtils::HashString("Warning");
-        static const int Degraded_HASH = HashingUtils::HashString("Degraded");
-        static const int Severe_HASH = HashingUtils::HashString("Severe");
-        static const int Suspended_HASH = HashingUtils::HashString("Suspended");
+        static constexpr int NoData_HASH = HashingUtils::CompileTimeHashString("NoData");
+        static constexpr int Unknown_HASH = HashingUtils::CompileTimeHashString("Unknown");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Ok_HASH = HashingUtils::CompileTimeHashString("Ok");
+        static constexpr int Info_HASH = HashingUtils::CompileTimeHashString("Info");
+        static constexpr int Warning_HASH = HashingUtils::CompileTimeHashString("Warning");
+        static constexpr int Degraded_HASH = HashingUtils::CompileTimeHashString("Degraded");
+        static constexpr int Severe_HASH = HashingUtils::CompileTimeHashString("Severe");
+        static constexpr int Suspended_HASH = HashingUtils::CompileTimeHashString("Suspended");
 
 
         EnvironmentHealthStatus GetEnvironmentHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoData_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnvironmentHealthStatus::NoData;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return EnvironmentHealthStatus::Unknown;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return EnvironmentHealthStatus::Pending;
-          }
-          else if (hashCode == Ok_HASH)
-          {
-            return EnvironmentHealthStatus::Ok;
-          }
-          else if (hashCode == Info_HASH)
-          {
-            return EnvironmentHealthStatus::Info;
-          }
-          else if (hashCode == Warning_HASH)
-          {
-            return EnvironmentHealthStatus::Warning;
-          }
-          else if (hashCode == Degraded_HASH)
-          {
-            return EnvironmentHealthStatus::Degraded;
-          }
-          else if (hashCode == Severe_HASH)
-          {
-            return EnvironmentHealthStatus::Severe;
-          }
-          else if (hashCode == Suspended_HASH)
-          {
-            return EnvironmentHealthStatus::Suspended;
+          case NoData_HASH:
+            if (name == "NoData")
+            {
+              return EnvironmentHealthStatus::NoData;
+            }
+            break;
+          case Unknown_HASH:
+            if (name == "Unknown")
+            {
+              return EnvironmentHealthStatus::Unknown;
+            }
+            break;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return EnvironmentHealthStatus::Pending;
+            }
+            break;
+          case Ok_HASH:
+            if (name == "Ok")
+            {
+              return EnvironmentHealthStatus::Ok;
+            }
+            break;
+          case Info_HASH:
+            if (name == "Info")
+            {
+              return EnvironmentHealthStatus::Info;
+            }
+            break;
+          case Warning_HASH:
+            if (name == "Warning")
+            {
+              return EnvironmentHealthStatus::Warning;
+            }
+            break;
+          case Degraded_HASH:
+            if (name == "Degraded")
+            {
+              return EnvironmentHealthStatus::Degraded;
+            }
+            break;
+          case Severe_HASH:
+            if (name == "Severe")
+            {
+              return EnvironmentHealthStatus::Severe;
+            }
+            break;
+          case Suspended_HASH:
+            if (name == "Suspended")
+            {
+              return EnvironmentHealthStatus::Suspended;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return EnvironmentHealthStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentHealthStatus(EnvironmentHealthStatus enumValue)
+        const char* GetNameForEnvironmentHealthStatus(EnvironmentHealthStatus enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
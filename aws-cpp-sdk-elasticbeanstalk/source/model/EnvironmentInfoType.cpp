@@ -30,20 +30,30 @@ namespace Aws
       namespace EnvironmentInfoTypeMapper
       {
 
-        static const int tail_HASH = HashingUtils::HashString("tail");
-        static const int bundle_HASH = HashingUtils::HashString("bundle");
+        static constexpr int tail_HASH = HashingUtils::CompileTimeHashString("tail");
+        static constexpr int bundle_HASH = HashingUtils::CompileTimeHashString("bundle");
 
 
         EnvironmentInfoType GetEnvironmentInfoTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tail_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnvironmentInfoType::tail;
-          }
-          else if (hashCode == bundle_HASH)
-          {
-            return EnvironmentInfoType::bundle;
+          case tail_HASH:
+            if (name == "tail")
+            {
+              return EnvironmentInfoType::tail;
+            }
+            break;
+          case bundle_HASH:
+            if (name == "bundle")
+            {
+              return EnvironmentInfoType::bundle;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EnvironmentInfoType::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentInfoType(EnvironmentInfoType enumValue)
+        const char* GetNameForEnvironmentInfoType(EnvironmentInfoType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace EnvironmentStatusMapper
       {
 
-        static const int Launching_HASH = HashingUtils::HashString("Launching");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
-        static const int Terminating_HASH = HashingUtils::HashString("Terminating");
-        static const int Terminated_HASH = HashingUtils::HashString("Terminated");
+        static constexpr int Launching_HASH = HashingUtils::CompileTimeHashString("Launching");
+        static constexpr int Updating_HASH = HashingUtils::CompileTimeHashString("Updating");
+        static constexpr int Ready_HASH = HashingUtils::CompileTimeHashString("Ready");
+        static constexpr int Terminating_HASH = HashingUtils::CompileTimeHashString("Terminating");
+        static constexpr int Terminated_HASH = HashingUtils::CompileTimeHashString("Terminated");
 
 
         EnvironmentStatus GetEnvironmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Launching_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EnvironmentStatus::Launching;
-          }
-          else if (hashCode == Updating_HASH)
-          {
-            return EnvironmentStatus::Updating;
-          }
-          else if (hashCode == Ready_HASH)
-          {
-            return EnvironmentStatus::Ready;
-          }
-          else if (hashCode == Terminating_HASH)
-          {
-            return EnvironmentStatus::Terminating;
-          }
-          else if (hashCode == Terminated_HASH)
-          {
-            return EnvironmentStatus::Terminated;
+          case Launching_HASH:
+            if (name == "Launching")
+            {
+              return EnvironmentStatus::Launching;
+            }
+            break;
+          case Updating_HASH:
+            if (name == "Updating")
+            {
+              return EnvironmentStatus::Updating;
+            }
+            break;
+          case Ready_HASH:
+            if (name == "Ready")
+            {
+              return EnvironmentStatus::Ready;
+            }
+            break;
+          case Terminating_HASH:
+            if (name == "Terminating")
+            {
+              return EnvironmentStatus::Terminating;
+            }
+            break;
+          case Terminated_HASH:
+            if (name == "Terminated")
+            {
+              return EnvironmentStatus::Terminated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return EnvironmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEnvironmentStatus(EnvironmentStatus enumValue)
+        const char* GetNameForEnvironmentStatus(EnvironmentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace EventSeverityMapper
       {
 
-        static const int TRACE_HASH = HashingUtils::HashString("TRACE");
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int FATAL_HASH = HashingUtils::HashString("FATAL");
+        static constexpr int TRACE_HASH = HashingUtils::CompileTimeHashString("TRACE");
+        static constexpr int DEBUG__HASH = HashingUtils::CompileTimeHashString("DEBUG");
+        static constexpr int INFO_HASH = HashingUtils::CompileTimeHashString("INFO");
+        static constexpr int WARN_HASH = HashingUtils::CompileTimeHashString("WARN");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int FATAL_HASH = HashingUtils::CompileTimeHashString("FATAL");
 
 
         EventSeverity GetEventSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRACE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventSeverity::TRACE;
-          }
-          else if (hashCode == DEBUG__HASH)
-          {
-            return EventSeverity::DEBUG_;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return EventSeverity::INFO;
-          }
-          else if (hashCode == WARN_HASH)
-          {
-            return EventSeverity::WARN;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return EventSeverity::ERROR_;
-          }
-          else if (hashCode == FATAL_HASH)
-          {
-            return EventSeverity::FATAL;
+          case TRACE_HASH:
+            if (name == "TRACE")
+            {
+              return EventSeverity::TRACE;
+            }
+            break;
+          case DEBUG__HASH:
+            if (name == "DEBUG")
+            {
+              return EventSeverity::DEBUG_;
+            }
+            break;
+          case INFO_HASH:
+            if (name == "INFO")
+            {
+              return EventSeverity::INFO;
+            }
+            break;
+          case WARN_HASH:
+            if (name == "WARN")
+            {
+              return EventSeverity::WARN;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return EventSeverity::ERROR_;
+            }
+            break;
+          case FATAL_HASH:
+            if (name == "FATAL")
+            {
+              return EventSeverity::FATAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return EventSeverity::NOT_SET;
         }
 
-        Aws::String GetNameForEventSeverity(EventSeverity enumValue)
+        const char* GetNameForEventSeverity(EventSeverity enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
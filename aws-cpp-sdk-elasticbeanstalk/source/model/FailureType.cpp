@@ -30,45 +30,65 @@ namespace Aws
       namespace FailureTypeMapper
       {
 
-        static const int UpdateCancelled_HASH = HashingUtils::HashString("UpdateCancelled");
-        static const int CancellationFailed_HASH = HashingUtils::HashString("CancellationFailed");
-        static const int RollbackFailed_HASH = HashingUtils::HashString("RollbackFailed");
-        static const int RollbackSuccessful_HASH = HashingUtils::HashString("RollbackSuccessful");
-        static const int InternalFailure_HASH = HashingUtils::HashString("InternalFailure");
-        static const int InvalidEnvironmentState_HASH = HashingUtils::HashString("InvalidEnvironmentState");
-        static const int PermissionsError_HASH = HashingUtils::HashString("PermissionsError");
+        static constexpr int UpdateCancelled_HASH = HashingUtils::CompileTimeHashString("UpdateCancelled");
+        static constexpr int CancellationFailed_HASH = HashingUtils::CompileTimeHashString("CancellationFailed");
+        static constexpr int RollbackFailed_HASH = HashingUtils::CompileTimeHashString("RollbackFailed");
+        static constexpr int RollbackSuccessful_HASH = HashingUtils::CompileTimeHashString("RollbackSuccessful");
+        static constexpr int InternalFailure_HASH = HashingUtils::CompileTimeHashString("InternalFailure");
+        static constexpr int InvalidEnvironmentState_HASH = HashingUtils::CompileTimeHashString("InvalidEnvironmentState");
+        static constexpr int PermissionsError_HASH = HashingUtils::CompileTimeHashString("PermissionsError");
 
 
         FailureType GetFailureTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UpdateCancelled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FailureType::UpdateCancelled;
-          }
-          else if (hashCode == CancellationFailed_HASH)
-          {
-            return FailureType::CancellationFailed;
-          }
-          else if (hashCode == RollbackFailed_HASH)
-          {
-            return FailureType::RollbackFailed;
-          }
-          else if (hashCode == RollbackSuccessful_HASH)
-          {
-            return FailureType::RollbackSuccessful;
-          }
-          else if (hashCode == InternalFailure_HASH)
-          {
-            return FailureType::InternalFailure;
-          }
-          else if (hashCode == InvalidEnvironmentState_HASH)
-          {
-            return FailureType::InvalidEnvironmentState;
-          }
-          else if (hashCode == PermissionsError_HASH)
-          {
-            return FailureType::PermissionsError;
+          case UpdateCancelled_HASH:
+            if (name == "UpdateCancelled")
+            {
+              return FailureType::UpdateCancelled;
+            }
+            break;
+          case CancellationFailed_HASH:
+            if (name == "CancellationFailed")
+            {
+              return FailureType::CancellationFailed;
+            }
+            break;
+          case RollbackFailed_HASH:
+            if (name == "RollbackFailed")
+            {
+              return FailureType::RollbackFailed;
+            }
+            break;
+          case RollbackSuccessful_HASH:
+            if (name == "RollbackSuccessful")
+            {
+              return FailureType::RollbackSuccessful;
+            }
+            break;
+          case InternalFailure_HASH:
+            if (name == "InternalFailure")
+            {
+              return FailureType::InternalFailure;
+            }
+            break;
+          case InvalidEnvironmentState_HASH:
+            if (name == "InvalidEnvironmentState")
+            {
+              return FailureType::InvalidEnvironmentState;
+            }
+            break;
+          case PermissionsError_HASH:
+            if (name == "PermissionsError")
+            {
+              return FailureType::PermissionsError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return FailureType::NOT_SET;
         }
 
-        Aws::String GetNameForFailureType(FailureType enumValue)
+        const char* GetNameForFailureType(FailureType enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
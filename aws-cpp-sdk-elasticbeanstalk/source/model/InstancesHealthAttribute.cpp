@@ -30,65 +30,93 @@ namespace Aws
       namespace InstancesHealthAttributeMapper
       {
 
-        static const int HealthStatus_HASH = HashingUtils::HashString("HealthStatus");
-        static const int Color_HASH = HashingUtils::HashString("Color");
-        static const int Causes_HASH = HashingUtils::HashString("Causes");
-        static const int ApplicationMetrics_HASH = HashingUtils::HashString("ApplicationMetrics");
-        static const int RefreshedAt_HASH = HashingUtils::HashString("RefreshedAt");
-        static const int LaunchedAt_HASH = HashingUtils::HashString("LaunchedAt");
-        static const int System_HASH = HashingUtils::HashString("System");
-        static const int Deployment_HASH = HashingUtils::HashString("Deployment");
-        static const int AvailabilityZone_HASH = HashingUtils::HashString("AvailabilityZone");
-        static const int InstanceType_HASH = HashingUtils::HashString("InstanceType");
-        static const int All_HASH = HashingUtils::HashString("All");
+        static constexpr int HealthStatus_HASH = HashingUtils::CompileTimeHashString("HealthStatus");
+        static constexpr int Color_HASH = HashingUtils::CompileTimeHashString("Color");
+        static constexpr int Causes_HASH = HashingUtils::CompileTimeHashString("Causes");
+        static constexpr int ApplicationMetrics_HASH = HashingUtils::CompileTimeHashString("ApplicationMetrics");
+        static constexpr int RefreshedAt_HASH = HashingUtils::CompileTimeHashString("RefreshedAt");
+        static constexpr int LaunchedAt_HASH = HashingUtils::CompileTimeHashString("LaunchedAt");
+        static constexpr int System_HASH = HashingUtils::CompileTimeHashString("System");
+        static constexpr int Deployment_HASH = HashingUtils::CompileTimeHashString("Deployment");
+        static constexpr int AvailabilityZone_HASH = HashingUtils::CompileTimeHashString("AvailabilityZone");
+        static constexpr int InstanceType_HASH = HashingUtils::CompileTimeHashString("InstanceType");
+        static constexpr int All_HASH = HashingUtils::CompileTimeHashString("All");
 
 
         InstancesHealthAttribute GetInstancesHealthAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HealthStatus_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstancesHealthAttribute::HealthStatus;
-          }
-          else if (hashCode == Color_HASH)
-          {
-            return InstancesHealthAttribute::Color;
-          }
-          else if (hashCode == Causes_HASH)
-          {
-            return InstancesHealthAttribute::Causes;
-          }
-          else if (hashCode == ApplicationMetrics_HASH)
-          {
-            return InstancesHealthAttribute::ApplicationMetrics;
-          }
-          else if (hashCode == RefreshedAt_HASH)
-          {
-            return InstancesHealthAttribute::RefreshedAt;
-          }
-          else if (hashCode == LaunchedAt_HASH)
-          {
-            return InstancesHealthAttribute::LaunchedAt;
-          }
-          else if (hashCode == System_HASH)
-          {
-            return InstancesHealthAttribute::System;
-          }
-          else if (hashCode == Deployment_HASH)
-          {
-            return InstancesHealthAttribute::Deployment;
-          }
-          else if (hashCode == AvailabilityZone_HASH)
-          {
-            return InstancesHealthAttribute::AvailabilityZone;
-          }
-          else if (hashCode == InstanceType_HASH)
-          {
-            return InstancesHealthAttribute::InstanceType;
-          }
-          else if (hashCode == All_HASH)
-          {
-            return InstancesHealthAttribute::All;
+          case HealthStatus_HASH:
+            if (name == "HealthStatus")
+            {
+              return InstancesHealthAttribute::HealthStatus;
+            }
+            break;
+          case Color_HASH:
+            if (name == "Color")
+            {
+              return InstancesHealthAttribute::Color;
+            }
+            break;
+          case Causes_HASH:
+            if (name == "Causes")
+            {
+              return InstancesHealthAttribute::Causes;
+            }
+            break;
+          case ApplicationMetrics_HASH:
+            if (name == "ApplicationMetrics")
+            {
+              return InstancesHealthAttribute::ApplicationMetrics;
+            }
+            break;
+          case RefreshedAt_HASH:
+            if (name == "RefreshedAt")
+            {
+              return InstancesHealthAttribute::RefreshedAt;
+            }
+            break;
+          case LaunchedAt_HASH:
+            if (name == "LaunchedAt")
+            {
+              return InstancesHealthAttribute::LaunchedAt;
+            }
+            break;
+          case System_HASH:
+            if (name == "System")
+            {
+              return InstancesHealthAttribute::System;
+            }
+            break;
+          case Deployment_HASH:
+            if (name == "Deployment")
+            {
+              return InstancesHealthAttribute::Deployment;
+            }
+            break;
+          case AvailabilityZone_HASH:
+            if (name == "AvailabilityZone")
+            {
+              return InstancesHealthAttribute::AvailabilityZone;
+            }
+            break;
+          case InstanceType_HASH:
+            if (name == "InstanceType")
+            {
+              return InstancesHealthAttribute::InstanceType;
+            }
+            break;
+          case All_HASH:
+            if (name == "All")
+            {
+              return InstancesHealthAttribute::All;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return InstancesHealthAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForInstancesHealthAttribute(InstancesHealthAttribute enumValue)
+        const char* GetNameForInstancesHealthAttribute(InstancesHealthAttribute enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace PlatformStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Ready_HASH = HashingUtils::HashString("Ready");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Deleted_HASH = HashingUtils::HashString("Deleted");
+        static constexpr int Creating_HASH = HashingUtils::CompileTimeHashString("Creating");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Ready_HASH = HashingUtils::CompileTimeHashString("Ready");
+        static constexpr int Deleting_HASH = HashingUtils::CompileTimeHashString("Deleting");
+        static constexpr int Deleted_HASH = HashingUtils::CompileTimeHashString("Deleted");
 
 
         PlatformStatus GetPlatformStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlatformStatus::Creating;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return PlatformStatus::Failed;
-          }
-          else if (hashCode == Ready_HASH)
-          {
-            return PlatformStatus::Ready;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return PlatformStatus::Deleting;
-          }
-          else if (hashCode == Deleted_HASH)
-          {
-            return PlatformStatus::Deleted;
+          case Creating_HASH:
+            if (name == "Creating")
+            {
+              return PlatformStatus::Creating;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return PlatformStatus::Failed;
+            }
+            break;
+          case Ready_HASH:
+            if (name == "Ready")
+            {
+              return PlatformStatus::Ready;
+            }
+            break;
+          case Deleting_HASH:
+            if (name == "Deleting")
+            {
+              return PlatformStatus::Deleting;
+            }
+            break;
+          case Deleted_HASH:
+            if (name == "Deleted")
+            {
+              return PlatformStatus::Deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return PlatformStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformStatus(PlatformStatus enumValue)
+        const char* GetNameForPlatformStatus(PlatformStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
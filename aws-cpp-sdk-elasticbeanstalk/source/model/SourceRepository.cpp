@@ -30,20 +30,30 @@ namespace Aws
       namespace SourceRepositoryMapper
       {
 
-        static const int CodeCommit_HASH = HashingUtils::HashString("CodeCommit");
-        static const int S3_HASH = HashingUtils::HashString("S3");
+        static constexpr int CodeCommit_HASH = HashingUtils::CompileTimeHashString("CodeCommit");
+        static constexpr int S3_HASH = HashingUtils::CompileTimeHashString("S3");
 
 
         SourceRepository GetSourceRepositoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CodeCommit_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceRepository::CodeCommit;
-          }
-          else if (hashCode == S3_HASH)
-          {
-            return SourceRepository::S3;
+          case CodeCommit_HASH:
+            if (name == "CodeCommit")
+            {
+              return SourceRepository::CodeCommit;
+            }
+            break;
+          case S3_HASH:
+            if (name == "S3")
+            {
+              return SourceRepository::S3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SourceRepository::NOT_SET;
         }
 
-        Aws::String GetNameForSourceRepository(SourceRepository enumValue)
+        const char* GetNameForSourceRepository(SourceRepository enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
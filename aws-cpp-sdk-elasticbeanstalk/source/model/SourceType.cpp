@@ -30,20 +30,30 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int Git_HASH = HashingUtils::HashString("Git");
-        static const int Zip_HASH = HashingUtils::HashString("Zip");
+        static constexpr int Git_HASH = HashingUtils::CompileTimeHashString("Git");
+        static constexpr int Zip_HASH = HashingUtils::CompileTimeHashString("Zip");
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Git_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceType::Git;
-          }
-          else if (hashCode == Zip_HASH)
-          {
-            return SourceType::Zip;
+          case Git_HASH:
+            if (name == "Git")
+            {
+              return SourceType::Git;
+            }
+            break;
+          case Zip_HASH:
+            if (name == "Zip")
+            {
+              return SourceType::Zip;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceType(SourceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ValidationSeverityMapper
       {
 
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int warning_HASH = HashingUtils::HashString("warning");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
+        static constexpr int warning_HASH = HashingUtils::CompileTimeHashString("warning");
 
 
         ValidationSeverity GetValidationSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == error_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ValidationSeverity::error;
-          }
-          else if (hashCode == warning_HASH)
-          {
-            return ValidationSeverity::warning;
+          case error_HASH:
+            if (name == "error")
+            {
+              return ValidationSeverity::error;
+            }
+            break;
+          case warning_HASH:
+            if (name == "warning")
+            {
+              return ValidationSeverity::warning;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ValidationSeverity::NOT_SET;
         }
 
-        Aws::String GetNameForValidationSeverity(ValidationSeverity enumValue)
+        const char* GetNameForValidationSeverity(ValidationSeverity enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -37,7 +37,8 @@ namespace LifeCycleStateMapper
 {
 AWS_EFS_API LifeCycleState GetLifeCycleStateForName(const Aws::String& name);
 
-AWS_EFS_API Aws::String GetNameForLifeCycleState(LifeCycleState value);
+// names of values not modeled point into the enum overflow container
+AWS_EFS_API const char* GetNameForLifeCycleState(LifeCycleState value);
 } // namespace LifeCycleStateMapper
 } // namespace Model
 } // namespace EFS
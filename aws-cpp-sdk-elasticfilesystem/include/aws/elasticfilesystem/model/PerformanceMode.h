@@ -34,7 +34,8 @@ namespace PerformanceModeMapper
 {
 AWS_EFS_API PerformanceMode GetPerformanceModeForName(const Aws::String& name);
 
-AWS_EFS_API Aws::String GetNameForPerformanceMode(PerformanceMode value);
+// names of values not modeled point into the enum overflow container
+AWS_EFS_API const char* GetNameForPerformanceMode(PerformanceMode value);
 } // namespace PerformanceModeMapper
 } // namespace Model
 } // namespace EFS
@@ -34,7 +34,8 @@ namespace ThroughputModeMapper
 {
 AWS_EFS_API ThroughputMode GetThroughputModeForName(const Aws::String& name);
 
-AWS_EFS_API Aws::String GetNameForThroughputMode(ThroughputMode value);
+// names of values not modeled point into the enum overflow container
+AWS_EFS_API const char* GetNameForThroughputMode(ThroughputMode value);
 } // namespace ThroughputModeMapper
 } // namespace Model
 } // namespace EFS
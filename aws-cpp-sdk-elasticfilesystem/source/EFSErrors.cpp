@@ -28,26 +28,26 @@ namespace EFS
 namespace EFSErrorMapper
 {
 
-static const int UNSUPPORTED_AVAILABILITY_ZONE_HASH = HashingUtils::HashString("UnsupportedAvailabilityZone");
-static const int FILE_SYSTEM_ALREADY_EXISTS_HASH = HashingUtils::HashString("FileSystemAlreadyExists");
-static const int INSUFFICIENT_THROUGHPUT_CAPACITY_HASH = HashingUtils::HashString("InsufficientThroughputCapacity");
-static const int SECURITY_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("SecurityGroupLimitExceeded");
-static const int FILE_SYSTEM_NOT_FOUND_HASH = HashingUtils::HashString("FileSystemNotFound");
-static const int SECURITY_GROUP_NOT_FOUND_HASH = HashingUtils::HashString("SecurityGroupNotFound");
-static const int NO_FREE_ADDRESSES_IN_SUBNET_HASH = HashingUtils::HashString("NoFreeAddressesInSubnet");
-static const int DEPENDENCY_TIMEOUT_HASH = HashingUtils::HashString("DependencyTimeout");
-static const int MOUNT_TARGET_NOT_FOUND_HASH = HashingUtils::HashString("MountTargetNotFound");
-static const int NETWORK_INTERFACE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("NetworkInterfaceLimitExceeded");
-static const int INCORRECT_FILE_SYSTEM_LIFE_CYCLE_STATE_HASH = HashingUtils::HashString("IncorrectFileSystemLifeCycleState");
-static const int MOUNT_TARGET_CONFLICT_HASH = HashingUtils::HashString("MountTargetConflict");
-static const int IP_ADDRESS_IN_USE_HASH = HashingUtils::HashString("IpAddressInUse");
-static const int FILE_SYSTEM_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("FileSystemLimitExceeded");
-static const int BAD_REQUEST_HASH = HashingUtils::HashString("BadRequest");
-static const int FILE_SYSTEM_IN_USE_HASH = HashingUtils::HashString("FileSystemInUse");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequests");
-static const int SUBNET_NOT_FOUND_HASH = HashingUtils::HashString("SubnetNotFound");
-static const int INCORRECT_MOUNT_TARGET_STATE_HASH = HashingUtils::HashString("IncorrectMountTargetState");
-static const int THROUGHPUT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ThroughputLimitExceeded");
+static constexpr int UNSUPPORTED_AVAILABILITY_ZONE_HASH = HashingUtils::CompileTimeHashString("UnsupportedAvailabilityZone");
+static constexpr int FILE_SYSTEM_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("FileSystemAlreadyExists");
+static constexpr int INSUFFICIENT_THROUGHPUT_CAPACITY_HASH = HashingUtils::CompileTimeHashString("InsufficientThroughputCapacity");
+static constexpr int SECURITY_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("SecurityGroupLimitExceeded");
+static constexpr int FILE_SYSTEM_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("FileSystemNotFound");
+static constexpr int SECURITY_GROUP_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SecurityGroupNotFound");
+static constexpr int NO_FREE_ADDRESSES_IN_SUBNET_HASH = HashingUtils::CompileTimeHashString("NoFreeAddressesInSubnet");
+static constexpr int DEPENDENCY_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("DependencyTimeout");
+static constexpr int MOUNT_TARGET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("MountTargetNotFound");
+static constexpr int NETWORK_INTERFACE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NetworkInterfaceLimitExceeded");
+static constexpr int INCORRECT_FILE_SYSTEM_LIFE_CYCLE_STATE_HASH = HashingUtils::CompileTimeHashString("IncorrectFileSystemLifeCycleState");
+static constexpr int MOUNT_TARGET_CONFLICT_HASH = HashingUtils::CompileTimeHashString("MountTargetConflict");
+static constexpr int IP_ADDRESS_IN_USE_HASH = HashingUtils::CompileTimeHashString("IpAddressInUse");
+static constexpr int FILE_SYSTEM_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("FileSystemLimitExceeded");
+static constexpr int BAD_REQUEST_HASH = HashingUtils::CompileTimeHashString("BadRequest");
+static constexpr int FILE_SYSTEM_IN_USE_HASH = HashingUtils::CompileTimeHashString("FileSystemInUse");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequests");
+static constexpr int SUBNET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SubnetNotFound");
+static constexpr int INCORRECT_MOUNT_TARGET_STATE_HASH = HashingUtils::CompileTimeHashString("IncorrectMountTargetState");
+static constexpr int THROUGHPUT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ThroughputLimitExceeded");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
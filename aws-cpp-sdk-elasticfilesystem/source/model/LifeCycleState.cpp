@@ -30,35 +30,51 @@ namespace Aws
       namespace LifeCycleStateMapper
       {
 
-        static const int creating_HASH = HashingUtils::HashString("creating");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int updating_HASH = HashingUtils::HashString("updating");
-        static const int deleting_HASH = HashingUtils::HashString("deleting");
-        static const int deleted_HASH = HashingUtils::HashString("deleted");
+        static constexpr int creating_HASH = HashingUtils::CompileTimeHashString("creating");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int updating_HASH = HashingUtils::CompileTimeHashString("updating");
+        static constexpr int deleting_HASH = HashingUtils::CompileTimeHashString("deleting");
+        static constexpr int deleted_HASH = HashingUtils::CompileTimeHashString("deleted");
 
 
         LifeCycleState GetLifeCycleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == creating_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LifeCycleState::creating;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return LifeCycleState::available;
-          }
-          else if (hashCode == updating_HASH)
-          {
-            return LifeCycleState::updating;
-          }
-          else if (hashCode == deleting_HASH)
-          {
-            return LifeCycleState::deleting;
-          }
-          else if (hashCode == deleted_HASH)
-          {
-            return LifeCycleState::deleted;
+          case creating_HASH:
+            if (name == "creating")
+            {
+              return LifeCycleState::creating;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return LifeCycleState::available;
+            }
+            break;
+          case updating_HASH:
+            if (name == "updating")
+            {
+              return LifeCycleState::updating;
+            }
+            break;
+          case deleting_HASH:
+            if (name == "deleting")
+            {
+              return LifeCycleState::deleting;
+            }
+            break;
+          case deleted_HASH:
+            if (name == "deleted")
+            {
+              return LifeCycleState::deleted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return LifeCycleState::NOT_SET;
         }
 
-        Aws::String GetNameForLifeCycleState(LifeCycleState enumValue)
+        const char* GetNameForLifeCycleState(LifeCycleState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PerformanceModeMapper
       {
 
-        static const int generalPurpose_HASH = HashingUtils::HashString("generalPurpose");
-        static const int maxIO_HASH = HashingUtils::HashString("maxIO");
+        static constexpr int generalPurpose_HASH = HashingUtils::CompileTimeHashString("generalPurpose");
+        static constexpr int maxIO_HASH = HashingUtils::CompileTimeHashString("maxIO");
 
 
         PerformanceMode GetPerformanceModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == generalPurpose_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PerformanceMode::generalPurpose;
-          }
-          else if (hashCode == maxIO_HASH)
-          {
-            return PerformanceMode::maxIO;
+          case generalPurpose_HASH:
+            if (name == "generalPurpose")
+            {
+              return PerformanceMode::generalPurpose;
+            }
+            break;
+          case maxIO_HASH:
+            if (name == "maxIO")
+            {
+              return PerformanceMode::maxIO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PerformanceMode::NOT_SET;
         }
 
-        Aws::String GetNameForPerformanceMode(PerformanceMode enumValue)
+        const char* GetNameForPerformanceMode(PerformanceMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
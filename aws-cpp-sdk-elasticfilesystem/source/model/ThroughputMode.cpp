@@ -30,20 +30,30 @@ namespace Aws
       namespace ThroughputModeMapper
       {
 
-        static const int bursting_HASH = HashingUtils::HashString("bursting");
-        static const int provisioned_HASH = HashingUtils::HashString("provisioned");
+        static constexpr int bursting_HASH = HashingUtils::CompileTimeHashString("bursting");
+        static constexpr int provisioned_HASH = HashingUtils::CompileTimeHashString("provisioned");
 
 
         ThroughputMode GetThroughputModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == bursting_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ThroughputMode::bursting;
-          }
-          else if (hashCode == provisioned_HASH)
-          {
-            return ThroughputMode::provisioned;
+          case bursting_HASH:
+            if (name == "bursting")
+            {
+              return ThroughputMode::bursting;
+            }
+            break;
+          case provisioned_HASH:
+            if (name == "provisioned")
+            {
+              return ThroughputMode::provisioned;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ThroughputMode::NOT_SET;
         }
 
-        Aws::String GetNameForThroughputMode(ThroughputMode enumValue)
+        const char* GetNameForThroughputMode(ThroughputMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
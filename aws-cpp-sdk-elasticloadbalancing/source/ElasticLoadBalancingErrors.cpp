@@ -28,28 +28,28 @@ namespace ElasticLoadBalancing
 namespace ElasticLoadBalancingErrorMapper
 {
 
-static const int TOO_MANY_TAGS_HASH = HashingUtils::HashString("TooManyTags");
-static const int SUBNET_NOT_FOUND_HASH = HashingUtils::HashString("SubnetNotFound");
-static const int DUPLICATE_LISTENER_HASH = HashingUtils::HashString("DuplicateListener");
-static const int LOAD_BALANCER_ATTRIBUTE_NOT_FOUND_HASH = HashingUtils::HashString("LoadBalancerAttributeNotFound");
-static const int POLICY_NOT_FOUND_HASH = HashingUtils::HashString("PolicyNotFound");
-static const int TOO_MANY_ACCESS_POINTS_HASH = HashingUtils::HashString("TooManyLoadBalancers");
-static const int UNSUPPORTED_PROTOCOL_HASH = HashingUtils::HashString("UnsupportedProtocol");
-static const int ACCESS_POINT_NOT_FOUND_HASH = HashingUtils::HashString("LoadBalancerNotFound");
-static const int INVALID_SUBNET_HASH = HashingUtils::HashString("InvalidSubnet");
-static const int INVALID_CONFIGURATION_REQUEST_HASH = HashingUtils::HashString("InvalidConfigurationRequest");
-static const int DUPLICATE_ACCESS_POINT_NAME_HASH = HashingUtils::HashString("DuplicateLoadBalancerName");
-static const int DUPLICATE_POLICY_NAME_HASH = HashingUtils::HashString("DuplicatePolicyName");
-static const int TOO_MANY_POLICIES_HASH = HashingUtils::HashString("TooManyPolicies");
-static const int INVALID_END_POINT_HASH = HashingUtils::HashString("InvalidInstance");
-static const int CERTIFICATE_NOT_FOUND_HASH = HashingUtils::HashString("CertificateNotFound");
-static const int INVALID_SCHEME_HASH = HashingUtils::HashString("InvalidScheme");
-static const int DEPENDENCY_THROTTLE_HASH = HashingUtils::HashString("DependencyThrottle");
-static const int POLICY_TYPE_NOT_FOUND_HASH = HashingUtils::HashString("PolicyTypeNotFound");
-static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OperationNotPermitted");
-static const int DUPLICATE_TAG_KEYS_HASH = HashingUtils::HashString("DuplicateTagKeys");
-static const int LISTENER_NOT_FOUND_HASH = HashingUtils::HashString("ListenerNotFound");
-static const int INVALID_SECURITY_GROUP_HASH = HashingUtils::HashString("InvalidSecurityGroup");
+static constexpr int TOO_MANY_TAGS_HASH = HashingUtils::CompileTimeHashString("TooManyTags");
+static constexpr int SUBNET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SubnetNotFound");
+static constexpr int DUPLICATE_LISTENER_HASH = HashingUtils::CompileTimeHashString("DuplicateListener");
+static constexpr int LOAD_BALANCER_ATTRIBUTE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("LoadBalancerAttributeNotFound");
+static constexpr int POLICY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("PolicyNotFound");
+static constexpr int TOO_MANY_ACCESS_POINTS_HASH = HashingUtils::CompileTimeHashString("TooManyLoadBalancers");
+static constexpr int UNSUPPORTED_PROTOCOL_HASH = HashingUtils::CompileTimeHashString("UnsupportedProtocol");
+static constexpr int ACCESS_POINT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("LoadBalancerNotFound");
+static constexpr int INVALID_SUBNET_HASH = HashingUtils::CompileTimeHashString("InvalidSubnet");
+static constexpr int INVALID_CONFIGURATION_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidConfigurationRequest");
+static constexpr int DUPLICATE_ACCESS_POINT_NAME_HASH = HashingUtils::CompileTimeHashString("DuplicateLoadBalancerName");
+static constexpr int DUPLICATE_POLICY_NAME_HASH = HashingUtils::CompileTimeHashString("DuplicatePolicyName");
+static constexpr int TOO_MANY_POLICIES_HASH = HashingUtils::CompileTimeHashString("TooManyPolicies");
+static constexpr int INVALID_END_POINT_HASH = HashingUtils::CompileTimeHashString("InvalidInstance");
+static constexpr int CERTIFICATE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("CertificateNotFound");
+static constexpr int INVALID_SCHEME_HASH = HashingUtils::CompileTimeHashString("InvalidScheme");
+static constexpr int DEPENDENCY_THROTTLE_HASH = HashingUtils::CompileTimeHashString("DependencyThrottle");
+static constexpr int POLICY_TYPE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("PolicyTypeNotFound");
+static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OperationNotPermitted");
+static constexpr int DUPLICATE_TAG_KEYS_HASH = HashingUtils::CompileTimeHashString("DuplicateTagKeys");
+static constexpr int LISTENER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ListenerNotFound");
+static constexpr int INVALID_SECURITY_GROUP_HASH = HashingUtils::CompileTimeHashString("InvalidSecurityGroup");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
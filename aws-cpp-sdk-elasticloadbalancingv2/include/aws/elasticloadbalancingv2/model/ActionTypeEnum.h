@@ -37,7 +37,8 @@ namespace ActionTypeEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API ActionTypeEnum GetActionTypeEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForActionTypeEnum(ActionTypeEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForActionTypeEnum(ActionTypeEnum value);
 } // namespace ActionTypeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -35,7 +35,8 @@ namespace AuthenticateCognitoActionConditionalBehaviorEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API AuthenticateCognitoActionConditionalBehaviorEnum GetAuthenticateCognitoActionConditionalBehaviorEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForAuthenticateCognitoActionConditionalBehaviorEnum(AuthenticateCognitoActionConditionalBehaviorEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForAuthenticateCognitoActionConditionalBehaviorEnum(AuthenticateCognitoActionConditionalBehaviorEnum value);
 } // namespace AuthenticateCognitoActionConditionalBehaviorEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
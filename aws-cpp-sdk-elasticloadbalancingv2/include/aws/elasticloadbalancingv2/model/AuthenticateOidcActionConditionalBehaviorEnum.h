@@ -35,7 +35,8 @@ namespace AuthenticateOidcActionConditionalBehaviorEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API AuthenticateOidcActionConditionalBehaviorEnum GetAuthenticateOidcActionConditionalBehaviorEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForAuthenticateOidcActionConditionalBehaviorEnum(AuthenticateOidcActionConditionalBehaviorEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForAuthenticateOidcActionConditionalBehaviorEnum(AuthenticateOidcActionConditionalBehaviorEnum value);
 } // namespace AuthenticateOidcActionConditionalBehaviorEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
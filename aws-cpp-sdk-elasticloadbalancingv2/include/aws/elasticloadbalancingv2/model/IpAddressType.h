@@ -34,7 +34,8 @@ namespace IpAddressTypeMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API IpAddressType GetIpAddressTypeForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForIpAddressType(IpAddressType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForIpAddressType(IpAddressType value);
 } // namespace IpAddressTypeMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -34,7 +34,8 @@ namespace LoadBalancerSchemeEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API LoadBalancerSchemeEnum GetLoadBalancerSchemeEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForLoadBalancerSchemeEnum(LoadBalancerSchemeEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForLoadBalancerSchemeEnum(LoadBalancerSchemeEnum value);
 } // namespace LoadBalancerSchemeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -36,7 +36,8 @@ namespace LoadBalancerStateEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API LoadBalancerStateEnum GetLoadBalancerStateEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForLoadBalancerStateEnum(LoadBalancerStateEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForLoadBalancerStateEnum(LoadBalancerStateEnum value);
 } // namespace LoadBalancerStateEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
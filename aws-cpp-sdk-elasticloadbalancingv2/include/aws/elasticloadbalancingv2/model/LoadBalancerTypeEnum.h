@@ -34,7 +34,8 @@ namespace LoadBalancerTypeEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API LoadBalancerTypeEnum GetLoadBalancerTypeEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForLoadBalancerTypeEnum(LoadBalancerTypeEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForLoadBalancerTypeEnum(LoadBalancerTypeEnum value);
 } // namespace LoadBalancerTypeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
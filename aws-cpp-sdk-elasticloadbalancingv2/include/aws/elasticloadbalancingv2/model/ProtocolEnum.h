@@ -35,7 +35,8 @@ namespace ProtocolEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API ProtocolEnum GetProtocolEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForProtocolEnum(ProtocolEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForProtocolEnum(ProtocolEnum value);
 } // namespace ProtocolEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
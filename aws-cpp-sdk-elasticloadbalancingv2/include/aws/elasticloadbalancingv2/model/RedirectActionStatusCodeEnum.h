@@ -34,7 +34,8 @@ namespace RedirectActionStatusCodeEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API RedirectActionStatusCodeEnum GetRedirectActionStatusCodeEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForRedirectActionStatusCodeEnum(RedirectActionStatusCodeEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForRedirectActionStatusCodeEnum(RedirectActionStatusCodeEnum value);
 } // namespace RedirectActionStatusCodeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
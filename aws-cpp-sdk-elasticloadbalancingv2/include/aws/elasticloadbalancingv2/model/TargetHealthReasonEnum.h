@@ -43,7 +43,8 @@ namespace TargetHealthReasonEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API TargetHealthReasonEnum GetTargetHealthReasonEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForTargetHealthReasonEnum(TargetHealthReasonEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForTargetHealthReasonEnum(TargetHealthReasonEnum value);
 } // namespace TargetHealthReasonEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
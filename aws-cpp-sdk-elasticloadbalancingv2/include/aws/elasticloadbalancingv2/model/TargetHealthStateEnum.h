@@ -38,7 +38,8 @@ namespace TargetHealthStateEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API TargetHealthStateEnum GetTargetHealthStateEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForTargetHealthStateEnum(TargetHealthStateEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForTargetHealthStateEnum(TargetHealthStateEnum value);
 } // namespace TargetHealthStateEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
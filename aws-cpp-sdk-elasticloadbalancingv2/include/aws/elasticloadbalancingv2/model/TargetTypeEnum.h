@@ -34,7 +34,8 @@ namespace TargetTypeEnumMapper
 {
 AWS_ELASTICLOADBALANCINGV2_API TargetTypeEnum GetTargetTypeEnumForName(const Aws::String& name);
 
-AWS_ELASTICLOADBALANCINGV2_API Aws::String GetNameForTargetTypeEnum(TargetTypeEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICLOADBALANCINGV2_API const char* GetNameForTargetTypeEnum(TargetTypeEnum value);
 } // namespace TargetTypeEnumMapper
 } // namespace Model
 } // namespace ElasticLoadBalancingv2
@@ -28,41 +28,41 @@ namespace ElasticLoadBalancingv2
 namespace ElasticLoadBalancingv2ErrorMapper
 {
 
-static const int INVALID_LOAD_BALANCER_ACTION_HASH = HashingUtils::HashString("InvalidLoadBalancerAction");
-static const int LOAD_BALANCER_NOT_FOUND_HASH = HashingUtils::HashString("LoadBalancerNotFound");
-static const int PRIORITY_IN_USE_HASH = HashingUtils::HashString("PriorityInUse");
-static const int INVALID_SUBNET_HASH = HashingUtils::HashString("InvalidSubnet");
-static const int TOO_MANY_TARGET_GROUPS_HASH = HashingUtils::HashString("TooManyTargetGroups");
-static const int INVALID_CONFIGURATION_REQUEST_HASH = HashingUtils::HashString("InvalidConfigurationRequest");
-static const int INVALID_TARGET_HASH = HashingUtils::HashString("InvalidTarget");
-static const int TOO_MANY_LOAD_BALANCERS_HASH = HashingUtils::HashString("TooManyLoadBalancers");
-static const int CERTIFICATE_NOT_FOUND_HASH = HashingUtils::HashString("CertificateNotFound");
-static const int TARGET_GROUP_ASSOCIATION_LIMIT_HASH = HashingUtils::HashString("TargetGroupAssociationLimit");
-static const int DUPLICATE_TAG_KEYS_HASH = HashingUtils::HashString("DuplicateTagKeys");
-static const int INVALID_SECURITY_GROUP_HASH = HashingUtils::HashString("InvalidSecurityGroup");
-static const int INCOMPATIBLE_PROTOCOLS_HASH = HashingUtils::HashString("IncompatibleProtocols");
-static const int TOO_MANY_TARGETS_HASH = HashingUtils::HashString("TooManyTargets");
-static const int TOO_MANY_TAGS_HASH = HashingUtils::HashString("TooManyTags");
-static const int TARGET_GROUP_NOT_FOUND_HASH = HashingUtils::HashString("TargetGroupNotFound");
-static const int SUBNET_NOT_FOUND_HASH = HashingUtils::HashString("SubnetNotFound");
-static const int AVAILABILITY_ZONE_NOT_SUPPORTED_HASH = HashingUtils::HashString("AvailabilityZoneNotSupported");
-static const int DUPLICATE_LISTENER_HASH = HashingUtils::HashString("DuplicateListener");
-static const int TOO_MANY_REGISTRATIONS_FOR_TARGET_ID_HASH = HashingUtils::HashString("TooManyRegistrationsForTargetId");
-static const int UNSUPPORTED_PROTOCOL_HASH = HashingUtils::HashString("UnsupportedProtocol");
-static const int RULE_NOT_FOUND_HASH = HashingUtils::HashString("RuleNotFound");
-static const int TOO_MANY_ACTIONS_HASH = HashingUtils::HashString("TooManyActions");
-static const int ALLOCATION_ID_NOT_FOUND_HASH = HashingUtils::HashString("AllocationIdNotFound");
-static const int TOO_MANY_LISTENERS_HASH = HashingUtils::HashString("TooManyListeners");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUse");
-static const int INVALID_SCHEME_HASH = HashingUtils::HashString("InvalidScheme");
-static const int DUPLICATE_LOAD_BALANCER_NAME_HASH = HashingUtils::HashString("DuplicateLoadBalancerName");
-static const int DUPLICATE_TARGET_GROUP_NAME_HASH = HashingUtils::HashString("DuplicateTargetGroupName");
-static const int S_S_L_POLICY_NOT_FOUND_HASH = HashingUtils::HashString("SSLPolicyNotFound");
-static const int TOO_MANY_CERTIFICATES_HASH = HashingUtils::HashString("TooManyCertificates");
-static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OperationNotPermitted");
-static const int TOO_MANY_RULES_HASH = HashingUtils::HashString("TooManyRules");
-static const int LISTENER_NOT_FOUND_HASH = HashingUtils::HashString("ListenerNotFound");
-static const int HEALTH_UNAVAILABLE_HASH = HashingUtils::HashString("HealthUnavailable");
+static constexpr int INVALID_LOAD_BALANCER_ACTION_HASH = HashingUtils::CompileTimeHashString("InvalidLoadBalancerAction");
+static constexpr int LOAD_BALANCER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("LoadBalancerNotFound");
+static constexpr int PRIORITY_IN_USE_HASH = HashingUtils::CompileTimeHashString("PriorityInUse");
+static constexpr int INVALID_SUBNET_HASH = HashingUtils::CompileTimeHashString("InvalidSubnet");
+static constexpr int TOO_MANY_TARGET_GROUPS_HASH = HashingUtils::CompileTimeHashString("TooManyTargetGroups");
+static constexpr int INVALID_CONFIGURATION_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidConfigurationRequest");
+static constexpr int INVALID_TARGET_HASH = HashingUtils::CompileTimeHashString("InvalidTarget");
+static constexpr int TOO_MANY_LOAD_BALANCERS_HASH = HashingUtils::CompileTimeHashString("TooManyLoadBalancers");
+static constexpr int CERTIFICATE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("CertificateNotFound");
+static constexpr int TARGET_GROUP_ASSOCIATION_LIMIT_HASH = HashingUtils::CompileTimeHashString("TargetGroupAssociationLimit");
+static constexpr int DUPLICATE_TAG_KEYS_HASH = HashingUtils::CompileTimeHashString("DuplicateTagKeys");
+static constexpr int INVALID_SECURITY_GROUP_HASH = HashingUtils::CompileTimeHashString("InvalidSecurityGroup");
+static constexpr int INCOMPATIBLE_PROTOCOLS_HASH = HashingUtils::CompileTimeHashString("IncompatibleProtocols");
+static constexpr int TOO_MANY_TARGETS_HASH = HashingUtils::CompileTimeHashString("TooManyTargets");
+static constexpr int TOO_MANY_TAGS_HASH = HashingUtils::CompileTimeHashString("TooManyTags");
+static constexpr int TARGET_GROUP_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("TargetGroupNotFound");
+static constexpr int SUBNET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SubnetNotFound");
+static constexpr int AVAILABILITY_ZONE_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("AvailabilityZoneNotSupported");
+static constexpr int DUPLICATE_LISTENER_HASH = HashingUtils::CompileTimeHashString("DuplicateListener");
+static constexpr int TOO_MANY_REGISTRATIONS_FOR_TARGET_ID_HASH = HashingUtils::CompileTimeHashString("TooManyRegistrationsForTargetId");
+static constexpr int UNSUPPORTED_PROTOCOL_HASH = HashingUtils::CompileTimeHashString("UnsupportedProtocol");
+static constexpr int RULE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("RuleNotFound");
+static constexpr int TOO_MANY_ACTIONS_HASH = HashingUtils::CompileTimeHashString("TooManyActions");
+static constexpr int ALLOCATION_ID_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("AllocationIdNotFound");
+static constexpr int TOO_MANY_LISTENERS_HASH = HashingUtils::CompileTimeHashString("TooManyListeners");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUse");
+static constexpr int INVALID_SCHEME_HASH = HashingUtils::CompileTimeHashString("InvalidScheme");
+static constexpr int DUPLICATE_LOAD_BALANCER_NAME_HASH = HashingUtils::CompileTimeHashString("DuplicateLoadBalancerName");
+static constexpr int DUPLICATE_TARGET_GROUP_NAME_HASH = HashingUtils::CompileTimeHashString("DuplicateTargetGroupName");
+static constexpr int S_S_L_POLICY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SSLPolicyNotFound");
+static constexpr int TOO_MANY_CERTIFICATES_HASH = HashingUtils::CompileTimeHashString("TooManyCertificates");
+static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OperationNotPermitted");
+static constexpr int TOO_MANY_RULES_HASH = HashingUtils::CompileTimeHashString("TooManyRules");
+static constexpr int LISTENER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ListenerNotFound");
+static constexpr int HEALTH_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("HealthUnavailable");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,35 +30,51 @@ namespace Aws
       namespace ActionTypeEnumMapper
       {
 
-        static const int forward_HASH = HashingUtils::HashString("forward");
-        static const int authenticate_oidc_HASH = HashingUtils::HashString("authenticate-oidc");
-        static const int authenticate_cognito_HASH = HashingUtils::HashString("authenticate-cognito");
-        static const int redirect_HASH = HashingUtils::HashString("redirect");
-        static const int fixed_response_HASH = HashingUtils::HashString("fixed-response");
+        static constexpr int forward_HASH = HashingUtils::CompileTimeHashString("forward");
+        static constexpr int authenticate_oidc_HASH = HashingUtils::CompileTimeHashString("authenticate-oidc");
+        static constexpr int authenticate_cognito_HASH = HashingUtils::CompileTimeHashString("authenticate-cognito");
+        static constexpr int redirect_HASH = HashingUtils::CompileTimeHashString("redirect");
+        static constexpr int fixed_response_HASH = HashingUtils::CompileTimeHashString("fixed-response");
 
 
         ActionTypeEnum GetActionTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == forward_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionTypeEnum::forward;
-          }
-          else if (hashCode == authenticate_oidc_HASH)
-          {
-            return ActionTypeEnum::authenticate_oidc;
-          }
-          else if (hashCode == authenticate_cognito_HASH)
-          {
-            return ActionTypeEnum::authenticate_cognito;
-          }
-          else if (hashCode == redirect_HASH)
-          {
-            return ActionTypeEnum::redirect;
-          }
-          else if (hashCode == fixed_response_HASH)
-          {
-            return ActionTypeEnum::fixed_response;
+          case forward_HASH:
+            if (name == "forward")
+            {
+              return ActionTypeEnum::forward;
+            }
+            break;
+          case authenticate_oidc_HASH:
+            if (name == "authenticate-oidc")
+            {
+              return ActionTypeEnum::authenticate_oidc;
+            }
+            break;
+          case authenticate_cognito_HASH:
+            if (name == "authenticate-cognito")
+            {
+              return ActionTypeEnum::authenticate_cognito;
+            }
+            break;
+          case redirect_HASH:
+            if (name == "redirect")
+            {
+              return ActionTypeEnum::redirect;
+            }
+            break;
+          case fixed_response_HASH:
+            if (name == "fixed-response")
+            {
+              return ActionTypeEnum::fixed_response;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ActionTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForActionTypeEnum(ActionTypeEnum enumValue)
+        const char* GetNameForActionTypeEnum(ActionTypeEnum enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
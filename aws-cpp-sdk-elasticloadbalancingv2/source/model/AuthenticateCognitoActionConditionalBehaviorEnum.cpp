@@ -30,25 +30,37 @@ namespace Aws
       namespace AuthenticateCognitoActionConditionalBehaviorEnumMapper
       {
 
-        static const int deny_HASH = HashingUtils::HashString("deny");
-        static const int allow_HASH = HashingUtils::HashString("allow");
-        static const int authenticate_HASH = HashingUtils::HashString("authenticate");
+        static constexpr int deny_HASH = HashingUtils::CompileTimeHashString("deny");
+        static constexpr int allow_HASH = HashingUtils::CompileTimeHashString("allow");
+        static constexpr int authenticate_HASH = HashingUtils::CompileTimeHashString("authenticate");
 
 
         AuthenticateCognitoActionConditionalBehaviorEnum GetAuthenticateCognitoActionConditionalBehaviorEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == deny_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthenticateCognitoActionConditionalBehaviorEnum::deny;
-          }
-          else if (hashCode == allow_HASH)
-          {
-            return AuthenticateCognitoActionConditionalBehaviorEnum::allow;
-          }
-          else if (hashCode == authenticate_HASH)
-          {
-            return AuthenticateCognitoActionConditionalBehaviorEnum::authenticate;
+          case deny_HASH:
+            if (name == "deny")
+            {
+              return AuthenticateCognitoActionConditionalBehaviorEnum::deny;
+            }
+            break;
+          case allow_HASH:
+            if (name == "allow")
+            {
+              return AuthenticateCognitoActionConditionalBehaviorEnum::allow;
+            }
+            break;
+          case authenticate_HASH:
+            if (name == "authenticate")
+            {
+              return AuthenticateCognitoActionConditionalBehaviorEnum::authenticate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AuthenticateCognitoActionConditionalBehaviorEnum::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticateCognitoActionConditionalBehaviorEnum(AuthenticateCognitoActionConditionalBehaviorEnum enumValue)
+        const char* GetNameForAuthenticateCognitoActionConditionalBehaviorEnum(AuthenticateCognitoActionConditionalBehaviorEnum enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
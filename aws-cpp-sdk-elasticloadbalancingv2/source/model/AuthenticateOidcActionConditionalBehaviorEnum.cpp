@@ -30,25 +30,37 @@ namespace Aws
       namespace AuthenticateOidcActionConditionalBehaviorEnumMapper
       {
 
-        static const int deny_HASH = HashingUtils::HashString("deny");
-        static const int allow_HASH = HashingUtils::HashString("allow");
-        static const int authenticate_HASH = HashingUtils::HashString("authenticate");
+        static constexpr int deny_HASH = HashingUtils::CompileTimeHashString("deny");
+        static constexpr int allow_HASH = HashingUtils::CompileTimeHashString("allow");
+        static constexpr int authenticate_HASH = HashingUtils::CompileTimeHashString("authenticate");
 
 
         AuthenticateOidcActionConditionalBehaviorEnum GetAuthenticateOidcActionConditionalBehaviorEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == deny_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthenticateOidcActionConditionalBehaviorEnum::deny;
-          }
-          else if (hashCode == allow_HASH)
-          {
-            return AuthenticateOidcActionConditionalBehaviorEnum::allow;
-          }
-          else if (hashCode == authenticate_HASH)
-          {
-            return AuthenticateOidcActionConditionalBehaviorEnum::authenticate;
+          case deny_HASH:
+            if (name == "deny")
+            {
+              return AuthenticateOidcActionConditionalBehaviorEnum::deny;
+            }
+            break;
+          case allow_HASH:
+            if (name == "allow")
+            {
+              return AuthenticateOidcActionConditionalBehaviorEnum::allow;
+            }
+            break;
+          case authenticate_HASH:
+            if (name == "authenticate")
+            {
+              return AuthenticateOidcActionConditionalBehaviorEnum::authenticate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AuthenticateOidcActionConditionalBehaviorEnum::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticateOidcActionConditionalBehaviorEnum(AuthenticateOidcActionConditionalBehaviorEnum enumValue)
+        const char* GetNameForAuthenticateOidcActionConditionalBehaviorEnum(AuthenticateOidcActionConditionalBehaviorEnum enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
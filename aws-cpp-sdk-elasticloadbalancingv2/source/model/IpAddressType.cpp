@@ -30,20 +30,30 @@ namespace Aws
       namespace IpAddressTypeMapper
       {
 
-        static const int ipv4_HASH = HashingUtils::HashString("ipv4");
-        static const int dualstack_HASH = HashingUtils::HashString("dualstack");
+        static constexpr int ipv4_HASH = HashingUtils::CompileTimeHashString("ipv4");
+        static constexpr int dualstack_HASH = HashingUtils::CompileTimeHashString("dualstack");
 
 
         IpAddressType GetIpAddressTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ipv4_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IpAddressType::ipv4;
-          }
-          else if (hashCode == dualstack_HASH)
-          {
-            return IpAddressType::dualstack;
+          case ipv4_HASH:
+            if (name == "ipv4")
+            {
+              return IpAddressType::ipv4;
+            }
+            break;
+          case dualstack_HASH:
+            if (name == "dualstack")
+            {
+              return IpAddressType::dualstack;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return IpAddressType::NOT_SET;
         }
 
-        Aws::String GetNameForIpAddressType(IpAddressType enumValue)
+        const char* GetNameForIpAddressType(IpAddressType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
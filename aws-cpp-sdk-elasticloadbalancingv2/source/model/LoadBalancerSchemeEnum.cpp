@@ -30,20 +30,30 @@ namespace Aws
       namespace LoadBalancerSchemeEnumMapper
       {
 
-        static const int internet_facing_HASH = HashingUtils::HashString("internet-facing");
-        static const int internal_HASH = HashingUtils::HashString("internal");
+        static constexpr int internet_facing_HASH = HashingUtils::CompileTimeHashString("internet-facing");
+        static constexpr int internal_HASH = HashingUtils::CompileTimeHashString("internal");
 
 
         LoadBalancerSchemeEnum GetLoadBalancerSchemeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == internet_facing_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerSchemeEnum::internet_facing;
-          }
-          else if (hashCode == internal_HASH)
-          {
-            return LoadBalancerSchemeEnum::internal;
+          case internet_facing_HASH:
+            if (name == "internet-facing")
+            {
+              return LoadBalancerSchemeEnum::internet_facing;
+            }
+            break;
+          case internal_HASH:
+            if (name == "internal")
+            {
+              return LoadBalancerSchemeEnum::internal;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LoadBalancerSchemeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerSchemeEnum(LoadBalancerSchemeEnum enumValue)
+        const char* GetNameForLoadBalancerSchemeEnum(LoadBalancerSchemeEnum enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace LoadBalancerStateEnumMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int provisioning_HASH = HashingUtils::HashString("provisioning");
-        static const int active_impaired_HASH = HashingUtils::HashString("active_impaired");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int provisioning_HASH = HashingUtils::CompileTimeHashString("provisioning");
+        static constexpr int active_impaired_HASH = HashingUtils::CompileTimeHashString("active_impaired");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
 
 
         LoadBalancerStateEnum GetLoadBalancerStateEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerStateEnum::active;
-          }
-          else if (hashCode == provisioning_HASH)
-          {
-            return LoadBalancerStateEnum::provisioning;
-          }
-          else if (hashCode == active_impaired_HASH)
-          {
-            return LoadBalancerStateEnum::active_impaired;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return LoadBalancerStateEnum::failed;
+          case active_HASH:
+            if (name == "active")
+            {
+              return LoadBalancerStateEnum::active;
+            }
+            break;
+          case provisioning_HASH:
+            if (name == "provisioning")
+            {
+              return LoadBalancerStateEnum::provisioning;
+            }
+            break;
+          case active_impaired_HASH:
+            if (name == "active_impaired")
+            {
+              return LoadBalancerStateEnum::active_impaired;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return LoadBalancerStateEnum::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return LoadBalancerStateEnum::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerStateEnum(LoadBalancerStateEnum enumValue)
+        const char* GetNameForLoadBalancerStateEnum(LoadBalancerStateEnum enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace LoadBalancerTypeEnumMapper
       {
 
-        static const int application_HASH = HashingUtils::HashString("application");
-        static const int network_HASH = HashingUtils::HashString("network");
+        static constexpr int application_HASH = HashingUtils::CompileTimeHashString("application");
+        static constexpr int network_HASH = HashingUtils::CompileTimeHashString("network");
 
 
         LoadBalancerTypeEnum GetLoadBalancerTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerTypeEnum::application;
-          }
-          else if (hashCode == network_HASH)
-          {
-            return LoadBalancerTypeEnum::network;
+          case application_HASH:
+            if (name == "application")
+            {
+              return LoadBalancerTypeEnum::application;
+            }
+            break;
+          case network_HASH:
+            if (name == "network")
+            {
+              return LoadBalancerTypeEnum::network;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LoadBalancerTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTypeEnum(LoadBalancerTypeEnum enumValue)
+        const char* GetNameForLoadBalancerTypeEnum(LoadBalancerTypeEnum enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
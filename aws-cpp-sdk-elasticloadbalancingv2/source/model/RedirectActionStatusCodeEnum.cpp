@@ -30,20 +30,30 @@ namespace Aws
       namespace RedirectActionStatusCodeEnumMapper
       {
 
-        static const int HTTP_301_HASH = HashingUtils::HashString("HTTP_301");
-        static const int HTTP_302_HASH = HashingUtils::HashString("HTTP_302");
+        static constexpr int HTTP_301_HASH = HashingUtils::CompileTimeHashString("HTTP_301");
+        static constexpr int HTTP_302_HASH = HashingUtils::CompileTimeHashString("HTTP_302");
 
 
         RedirectActionStatusCodeEnum GetRedirectActionStatusCodeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_301_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RedirectActionStatusCodeEnum::HTTP_301;
-          }
-          else if (hashCode == HTTP_302_HASH)
-          {
-            return RedirectActionStatusCodeEnum::HTTP_302;
+          case HTTP_301_HASH:
+            if (name == "HTTP_301")
+            {
+              return RedirectActionStatusCodeEnum::HTTP_301;
+            }
+            break;
+          case HTTP_302_HASH:
+            if (name == "HTTP_302")
+            {
+              return RedirectActionStatusCodeEnum::HTTP_302;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RedirectActionStatusCodeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForRedirectActionStatusCodeEnum(RedirectActionStatusCodeEnum enumValue)
+        const char* GetNameForRedirectActionStatusCodeEnum(RedirectActionStatusCodeEnum enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
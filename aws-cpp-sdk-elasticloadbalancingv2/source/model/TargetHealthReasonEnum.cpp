@@ -30,65 +30,93 @@ namespace Aws
       namespace TargetHealthReasonEnumMapper
       {
 
-        static const int Elb_RegistrationInProgress_HASH = HashingUtils::HashString("Elb.RegistrationInProgress");
-        static const int Elb_InitialHealthChecking_HASH = HashingUtils::HashString("Elb.InitialHealthChecking");
-        static const int Target_ResponseCodeMismatch_HASH = HashingUtils::HashString("Target.ResponseCodeMismatch");
-        static const int Target_Timeout_HASH = HashingUtils::HashString("Target.Timeout");
-        static const int Target_FailedHealthChecks_HASH = HashingUtils::HashString("Target.FailedHealthChecks");
-        static const int Target_NotRegistered_HASH = HashingUtils::HashString("Target.NotRegistered");
-        static const int Target_NotInUse_HASH = HashingUtils::HashString("Target.NotInUse");
-        static const int Target_DeregistrationInProgress_HASH = HashingUtils::HashString("Target.DeregistrationInProgress");
-        static const int Target_InvalidState_HASH = HashingUtils::HashString("Target.InvalidState");
-        static const int Target_IpUnusable_HASH = HashingUtils::HashString("Target.IpUnusable");
-        static const int Elb_InternalError_HASH = HashingUtils::HashString("Elb.InternalError");
+        static constexpr int Elb_RegistrationInProgress_HASH = HashingUtils::CompileTimeHashString("Elb.RegistrationInProgress");
+        static constexpr int Elb_InitialHealthChecking_HASH = HashingUtils::CompileTimeHashString("Elb.InitialHealthChecking");
+        static constexpr int Target_ResponseCodeMismatch_HASH = HashingUtils::CompileTimeHashString("Target.ResponseCodeMismatch");
+        static constexpr int Target_Timeout_HASH = HashingUtils::CompileTimeHashString("Target.Timeout");
+        static constexpr int Target_FailedHealthChecks_HASH = HashingUtils::CompileTimeHashString("Target.FailedHealthChecks");
+        static constexpr int Target_NotRegistered_HASH = HashingUtils::CompileTimeHashString("Target.NotRegistered");
+        static constexpr int Target_NotInUse_HASH = HashingUtils::CompileTimeHashString("Target.NotInUse");
+        static constexpr int Target_DeregistrationInProgress_HASH = HashingUtils::CompileTimeHashString("Target.DeregistrationInProgress");
+        static constexpr int Target_InvalidState_HASH = HashingUtils::CompileTimeHashString("Target.InvalidState");
+        static constexpr int Target_IpUnusable_HASH = HashingUtils::CompileTimeHashString("Target.IpUnusable");
+        static constexpr int Elb_InternalError_HASH = HashingUtils::CompileTimeHashString("Elb.InternalError");
 
 
         TargetHealthReasonEnum GetTargetHealthReasonEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Elb_RegistrationInProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TargetHealthReasonEnum::Elb_RegistrationInProgress;
-          }
-          else if (hashCode == Elb_InitialHealthChecking_HASH)
-          {
-            return TargetHealthReasonEnum::Elb_InitialHealthChecking;
-          }
-          else if (hashCode == Target_ResponseCodeMismatch_HASH)
-          {
-            return TargetHealthReasonEnum::Target_ResponseCodeMismatch;
-          }
-          else if (hashCode == Target_Timeout_HASH)
-          {
-            return TargetHealthReasonEnum::Target_Timeout;
-          }
-          else if (hashCode == Target_FailedHealthChecks_HASH)
-          {
-            return TargetHealthReasonEnum::Target_FailedHealthChecks;
-          }
-          else if (hashCode == Target_NotRegistered_HASH)
-          {
-            return TargetHealthReasonEnum::Target_NotRegistered;
-          }
-          else if (hashCode == Target_NotInUse_HASH)
-          {
-            return TargetHealthReasonEnum::Target_NotInUse;
-          }
-          else if (hashCode == Target_DeregistrationInProgress_HASH)
-          {
-            return TargetHealthReasonEnum::Target_DeregistrationInProgress;
-          }
-          else if (hashCode == Target_InvalidState_HASH)
-          {
-            return TargetHealthReasonEnum::Target_InvalidState;
-          }
-          else if (hashCode == Target_IpUnusable_HASH)
-          {
-            return TargetHealthReasonEnum::Target_IpUnusable;
-          }
-          else if (hashCode == Elb_InternalError_HASH)
-          {
-            return TargetHealthReasonEnum::Elb_InternalError;
+          case Elb_RegistrationInProgress_HASH:
+            if (name == "Elb.RegistrationInProgress")
+            {
+              return TargetHealthReasonEnum::Elb_RegistrationInProgress;
+            }
+            break;
+          case Elb_InitialHealthChecking_HASH:
+            if (name == "Elb.InitialHealthChecking")
+            {
+              return TargetHealthReasonEnum::Elb_InitialHealthChecking;
+            }
+            break;
+          case Target_ResponseCodeMismatch_HASH:
+            if (name == "Target.ResponseCodeMismatch")
+            {
+              return TargetHealthReasonEnum::Target_ResponseCodeMismatch;
+            }
+            break;
+          case Target_Timeout_HASH:
+            if (name == "Target.Timeout")
+            {
+              return TargetHealthReasonEnum::Target_Timeout;
+            }
+            break;
+          case Target_FailedHealthChecks_HASH:
+            if (name == "Target.FailedHealthChecks")
+            {
+              return TargetHealthReasonEnum::Target_FailedHealthChecks;
+            }
+            break;
+          case Target_NotRegistered_HASH:
+            if (name == "Target.NotRegistered")
+            {
+              return TargetHealthReasonEnum::Target_NotRegistered;
+            }
+            break;
+          case Target_NotInUse_HASH:
+            if (name == "Target.NotInUse")
+            {
+              return TargetHealthReasonEnum::Target_NotInUse;
+            }
+            break;
+          case Target_DeregistrationInProgress_HASH:
+            if (name == "Target.DeregistrationInProgress")
+            {
+              return TargetHealthReasonEnum::Target_DeregistrationInProgress;
+            }
+            break;
+          case Target_InvalidState_HASH:
+            if (name == "Target.InvalidState")
+            {
+              return TargetHealthReasonEnum::Target_InvalidState;
+            }
+            break;
+          case Target_IpUnusable_HASH:
+            if (name == "Target.IpUnusable")
+            {
+              return TargetHealthReasonEnum::Target_IpUnusable;
+            }
+            break;
+          case Elb_InternalError_HASH:
+            if (name == "Elb.InternalError")
+            {
+              return TargetHealthReasonEnum::Elb_InternalError;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return TargetHealthReasonEnum::NOT_SET;
         }
 
-        Aws::String GetNameForTargetHealthReasonEnum(TargetHealthReasonEnum enumValue)
+        const char* GetNameForTargetHealthReasonEnum(TargetHealthReasonEnum enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
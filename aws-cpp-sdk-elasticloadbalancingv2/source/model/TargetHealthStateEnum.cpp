@@ -30,40 +30,58 @@ namespace Aws
       namespace TargetHealthStateEnumMapper
       {
 
-        static const int initial_HASH = HashingUtils::HashString("initial");
-        static const int healthy_HASH = HashingUtils::HashString("healthy");
-        static const int unhealthy_HASH = HashingUtils::HashString("unhealthy");
-        static const int unused_HASH = HashingUtils::HashString("unused");
-        static const int draining_HASH = HashingUtils::HashString("draining");
-        static const int unavailable_HASH = HashingUtils::HashString("unavailable");
+        static constexpr int initial_HASH = HashingUtils::CompileTimeHashString("initial");
+        static constexpr int healthy_HASH = HashingUtils::CompileTimeHashString("healthy");
+        static constexpr int unhealthy_HASH = HashingUtils::CompileTimeHashString("unhealthy");
+        static constexpr int unused_HASH = HashingUtils::CompileTimeHashString("unused");
+        static constexpr int draining_HASH = HashingUtils::CompileTimeHashString("draining");
+        static constexpr int unavailable_HASH = HashingUtils::CompileTimeHashString("unavailable");
 
 
         TargetHealthStateEnum GetTargetHealthStateEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == initial_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TargetHealthStateEnum::initial;
-          }
-          else if (hashCode == healthy_HASH)
-          {
-            return TargetHealthStateEnum::healthy;
-          }
-          else if (hashCode == unhealthy_HASH)
-          {
-            return TargetHealthStateEnum::unhealthy;
-          }
-          else if (hashCode == unused_HASH)
-          {
-            return TargetHealthStateEnum::unused;
-          }
-          else if (hashCode == draining_HASH)
-          {
-            return TargetHealthStateEnum::draining;
-          }
-          else if (hashCode == unavailable_HASH)
-          {
-            return TargetHealthStateEnum::unavailable;
+          case initial_HASH:
+            if (name == "initial")
+            {
+              return TargetHealthStateEnum::initial;
+            }
+            break;
+          case healthy_HASH:
+            if (name == "healthy")
+            {
+              return TargetHealthStateEnum::healthy;
+            }
+            break;
+          case unhealthy_HASH:
+            if (name == "unhealthy")
+            {
+              return TargetHealthStateEnum::unhealthy;
+            }
+            break;
+          case unused_HASH:
+            if (name == "unused")
+            {
+              return TargetHealthStateEnum::unused;
+            }
+            break;
+          case draining_HASH:
+            if (name == "draining")
+            {
+              return TargetHealthStateEnum::draining;
+            }
+            break;
+          case unavailable_HASH:
+            if (name == "unavailable")
+            {
+              return TargetHealthStateEnum::unavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return TargetHealthStateEnum::NOT_SET;
         }
 
-        Aws::String GetNameForTargetHealthStateEnum(TargetHealthStateEnum enumValue)
+        const char* GetNameForTargetHealthStateEnum(TargetHealthStateEnum enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
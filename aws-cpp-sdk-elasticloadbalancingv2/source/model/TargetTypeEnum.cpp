@@ -30,20 +30,30 @@ namespace Aws
       namespace TargetTypeEnumMapper
       {
 
-        static const int instance_HASH = HashingUtils::HashString("instance");
-        static const int ip_HASH = HashingUtils::HashString("ip");
+        static constexpr int instance_HASH = HashingUtils::CompileTimeHashString("instance");
+        static constexpr int ip_HASH = HashingUtils::CompileTimeHashString("ip");
 
 
         TargetTypeEnum GetTargetTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == instance_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TargetTypeEnum::instance;
-          }
-          else if (hashCode == ip_HASH)
-          {
-            return TargetTypeEnum::ip;
+          case instance_HASH:
+            if (name == "instance")
+            {
+              return TargetTypeEnum::instance;
+            }
+            break;
+          case ip_HASH:
+            if (name == "ip")
+            {
+              return TargetTypeEnum::ip;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TargetTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForTargetTypeEnum(TargetTypeEnum enumValue)
+        const char* GetNameForTargetTypeEnum(TargetTypeEnum enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -36,7 +36,8 @@ namespace ActionOnFailureMapper
 {
 AWS_EMR_API ActionOnFailure GetActionOnFailureForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForActionOnFailure(ActionOnFailure value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForActionOnFailure(ActionOnFailure value);
 } // namespace ActionOnFailureMapper
 } // namespace Model
 } // namespace EMR
@@ -35,7 +35,8 @@ namespace AdjustmentTypeMapper
 {
 AWS_EMR_API AdjustmentType GetAdjustmentTypeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForAdjustmentType(AdjustmentType value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForAdjustmentType(AdjustmentType value);
 } // namespace AdjustmentTypeMapper
 } // namespace Model
 } // namespace EMR
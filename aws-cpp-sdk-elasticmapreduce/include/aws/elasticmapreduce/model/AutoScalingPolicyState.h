@@ -38,7 +38,8 @@ namespace AutoScalingPolicyStateMapper
 {
 AWS_EMR_API AutoScalingPolicyState GetAutoScalingPolicyStateForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForAutoScalingPolicyState(AutoScalingPolicyState value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForAutoScalingPolicyState(AutoScalingPolicyState value);
 } // namespace AutoScalingPolicyStateMapper
 } // namespace Model
 } // namespace EMR
@@ -35,7 +35,8 @@ namespace AutoScalingPolicyStateChangeReasonCodeMapper
 {
 AWS_EMR_API AutoScalingPolicyStateChangeReasonCode GetAutoScalingPolicyStateChangeReasonCodeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForAutoScalingPolicyStateChangeReasonCode(AutoScalingPolicyStateChangeReasonCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForAutoScalingPolicyStateChangeReasonCode(AutoScalingPolicyStateChangeReasonCode value);
 } // namespace AutoScalingPolicyStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
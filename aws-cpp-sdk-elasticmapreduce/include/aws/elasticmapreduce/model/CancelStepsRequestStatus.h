@@ -34,7 +34,8 @@ namespace CancelStepsRequestStatusMapper
 {
 AWS_EMR_API CancelStepsRequestStatus GetCancelStepsRequestStatusForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForCancelStepsRequestStatus(CancelStepsRequestStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForCancelStepsRequestStatus(CancelStepsRequestStatus value);
 } // namespace CancelStepsRequestStatusMapper
 } // namespace Model
 } // namespace EMR
@@ -39,7 +39,8 @@ namespace ClusterStateMapper
 {
 AWS_EMR_API ClusterState GetClusterStateForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForClusterState(ClusterState value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForClusterState(ClusterState value);
 } // namespace ClusterStateMapper
 } // namespace Model
 } // namespace EMR
@@ -40,7 +40,8 @@ namespace ClusterStateChangeReasonCodeMapper
 {
 AWS_EMR_API ClusterStateChangeReasonCode GetClusterStateChangeReasonCodeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForClusterStateChangeReasonCode(ClusterStateChangeReasonCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForClusterStateChangeReasonCode(ClusterStateChangeReasonCode value);
 } // namespace ClusterStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
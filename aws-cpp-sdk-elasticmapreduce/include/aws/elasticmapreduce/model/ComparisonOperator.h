@@ -36,7 +36,8 @@ namespace ComparisonOperatorMapper
 {
 AWS_EMR_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForComparisonOperator(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace EMR
@@ -34,7 +34,8 @@ namespace InstanceCollectionTypeMapper
 {
 AWS_EMR_API InstanceCollectionType GetInstanceCollectionTypeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceCollectionType(InstanceCollectionType value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceCollectionType(InstanceCollectionType value);
 } // namespace InstanceCollectionTypeMapper
 } // namespace Model
 } // namespace EMR
@@ -39,7 +39,8 @@ namespace InstanceFleetStateMapper
 {
 AWS_EMR_API InstanceFleetState GetInstanceFleetStateForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceFleetState(InstanceFleetState value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceFleetState(InstanceFleetState value);
 } // namespace InstanceFleetStateMapper
 } // namespace Model
 } // namespace EMR
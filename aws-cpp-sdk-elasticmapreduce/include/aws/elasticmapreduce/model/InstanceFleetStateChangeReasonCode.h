@@ -36,7 +36,8 @@ namespace InstanceFleetStateChangeReasonCodeMapper
 {
 AWS_EMR_API InstanceFleetStateChangeReasonCode GetInstanceFleetStateChangeReasonCodeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceFleetStateChangeReasonCode(InstanceFleetStateChangeReasonCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceFleetStateChangeReasonCode(InstanceFleetStateChangeReasonCode value);
 } // namespace InstanceFleetStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
@@ -35,7 +35,8 @@ namespace InstanceFleetTypeMapper
 {
 AWS_EMR_API InstanceFleetType GetInstanceFleetTypeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceFleetType(InstanceFleetType value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceFleetType(InstanceFleetType value);
 } // namespace InstanceFleetTypeMapper
 } // namespace Model
 } // namespace EMR
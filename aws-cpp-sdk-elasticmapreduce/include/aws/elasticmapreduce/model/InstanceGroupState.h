@@ -42,7 +42,8 @@ namespace InstanceGroupStateMapper
 {
 AWS_EMR_API InstanceGroupState GetInstanceGroupStateForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceGroupState(InstanceGroupState value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceGroupState(InstanceGroupState value);
 } // namespace InstanceGroupStateMapper
 } // namespace Model
 } // namespace EMR
@@ -36,7 +36,8 @@ namespace InstanceGroupStateChangeReasonCodeMapper
 {
 AWS_EMR_API InstanceGroupStateChangeReasonCode GetInstanceGroupStateChangeReasonCodeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceGroupStateChangeReasonCode(InstanceGroupStateChangeReasonCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceGroupStateChangeReasonCode(InstanceGroupStateChangeReasonCode value);
 } // namespace InstanceGroupStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
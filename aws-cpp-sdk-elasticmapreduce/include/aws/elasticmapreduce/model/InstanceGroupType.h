@@ -35,7 +35,8 @@ namespace InstanceGroupTypeMapper
 {
 AWS_EMR_API InstanceGroupType GetInstanceGroupTypeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceGroupType(InstanceGroupType value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceGroupType(InstanceGroupType value);
 } // namespace InstanceGroupTypeMapper
 } // namespace Model
 } // namespace EMR
@@ -35,7 +35,8 @@ namespace InstanceRoleTypeMapper
 {
 AWS_EMR_API InstanceRoleType GetInstanceRoleTypeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceRoleType(InstanceRoleType value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceRoleType(InstanceRoleType value);
 } // namespace InstanceRoleTypeMapper
 } // namespace Model
 } // namespace EMR
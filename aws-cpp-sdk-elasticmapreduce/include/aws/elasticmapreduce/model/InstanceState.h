@@ -37,7 +37,8 @@ namespace InstanceStateMapper
 {
 AWS_EMR_API InstanceState GetInstanceStateForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceState(InstanceState value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceState(InstanceState value);
 } // namespace InstanceStateMapper
 } // namespace Model
 } // namespace EMR
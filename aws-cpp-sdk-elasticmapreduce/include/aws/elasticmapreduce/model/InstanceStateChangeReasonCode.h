@@ -37,7 +37,8 @@ namespace InstanceStateChangeReasonCodeMapper
 {
 AWS_EMR_API InstanceStateChangeReasonCode GetInstanceStateChangeReasonCodeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForInstanceStateChangeReasonCode(InstanceStateChangeReasonCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForInstanceStateChangeReasonCode(InstanceStateChangeReasonCode value);
 } // namespace InstanceStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
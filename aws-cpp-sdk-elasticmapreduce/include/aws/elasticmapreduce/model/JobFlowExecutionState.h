@@ -40,7 +40,8 @@ namespace JobFlowExecutionStateMapper
 {
 AWS_EMR_API JobFlowExecutionState GetJobFlowExecutionStateForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForJobFlowExecutionState(JobFlowExecutionState value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForJobFlowExecutionState(JobFlowExecutionState value);
 } // namespace JobFlowExecutionStateMapper
 } // namespace Model
 } // namespace EMR
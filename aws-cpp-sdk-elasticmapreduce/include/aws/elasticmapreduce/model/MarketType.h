@@ -34,7 +34,8 @@ namespace MarketTypeMapper
 {
 AWS_EMR_API MarketType GetMarketTypeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForMarketType(MarketType value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForMarketType(MarketType value);
 } // namespace MarketTypeMapper
 } // namespace Model
 } // namespace EMR
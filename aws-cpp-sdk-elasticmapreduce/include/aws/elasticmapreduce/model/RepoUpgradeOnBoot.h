@@ -34,7 +34,8 @@ namespace RepoUpgradeOnBootMapper
 {
 AWS_EMR_API RepoUpgradeOnBoot GetRepoUpgradeOnBootForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForRepoUpgradeOnBoot(RepoUpgradeOnBoot value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForRepoUpgradeOnBoot(RepoUpgradeOnBoot value);
 } // namespace RepoUpgradeOnBootMapper
 } // namespace Model
 } // namespace EMR
@@ -34,7 +34,8 @@ namespace ScaleDownBehaviorMapper
 {
 AWS_EMR_API ScaleDownBehavior GetScaleDownBehaviorForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForScaleDownBehavior(ScaleDownBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForScaleDownBehavior(ScaleDownBehavior value);
 } // namespace ScaleDownBehaviorMapper
 } // namespace Model
 } // namespace EMR
@@ -34,7 +34,8 @@ namespace SpotProvisioningTimeoutActionMapper
 {
 AWS_EMR_API SpotProvisioningTimeoutAction GetSpotProvisioningTimeoutActionForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForSpotProvisioningTimeoutAction(SpotProvisioningTimeoutAction value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForSpotProvisioningTimeoutAction(SpotProvisioningTimeoutAction value);
 } // namespace SpotProvisioningTimeoutActionMapper
 } // namespace Model
 } // namespace EMR
@@ -37,7 +37,8 @@ namespace StatisticMapper
 {
 AWS_EMR_API Statistic GetStatisticForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForStatistic(Statistic value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForStatistic(Statistic value);
 } // namespace StatisticMapper
 } // namespace Model
 } // namespace EMR
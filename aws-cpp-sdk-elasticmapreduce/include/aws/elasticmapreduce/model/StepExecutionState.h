@@ -39,7 +39,8 @@ namespace StepExecutionStateMapper
 {
 AWS_EMR_API StepExecutionState GetStepExecutionStateForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForStepExecutionState(StepExecutionState value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForStepExecutionState(StepExecutionState value);
 } // namespace StepExecutionStateMapper
 } // namespace Model
 } // namespace EMR
@@ -39,7 +39,8 @@ namespace StepStateMapper
 {
 AWS_EMR_API StepState GetStepStateForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForStepState(StepState value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForStepState(StepState value);
 } // namespace StepStateMapper
 } // namespace Model
 } // namespace EMR
@@ -33,7 +33,8 @@ namespace StepStateChangeReasonCodeMapper
 {
 AWS_EMR_API StepStateChangeReasonCode GetStepStateChangeReasonCodeForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForStepStateChangeReasonCode(StepStateChangeReasonCode value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForStepStateChangeReasonCode(StepStateChangeReasonCode value);
 } // namespace StepStateChangeReasonCodeMapper
 } // namespace Model
 } // namespace EMR
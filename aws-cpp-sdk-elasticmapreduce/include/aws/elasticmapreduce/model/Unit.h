@@ -59,7 +59,8 @@ namespace UnitMapper
 {
 AWS_EMR_API Unit GetUnitForName(const Aws::String& name);
 
-AWS_EMR_API Aws::String GetNameForUnit(Unit value);
+// names of values not modeled point into the enum overflow container
+AWS_EMR_API const char* GetNameForUnit(Unit value);
 } // namespace UnitMapper
 } // namespace Model
 } // namespace EMR
@@ -30,30 +30,44 @@ namespace Aws
       namespace ActionOnFailureMapper
       {
 
-        static const int TERMINATE_JOB_FLOW_HASH = HashingUtils::HashString("TERMINATE_JOB_FLOW");
-        static const int TERMINATE_CLUSTER_HASH = HashingUtils::HashString("TERMINATE_CLUSTER");
-        static const int CANCEL_AND_WAIT_HASH = HashingUtils::HashString("CANCEL_AND_WAIT");
-        static const int CONTINUE_HASH = HashingUtils::HashString("CONTINUE");
+        static constexpr int TERMINATE_JOB_FLOW_HASH = HashingUtils::CompileTimeHashString("TERMINATE_JOB_FLOW");
+        static constexpr int TERMINATE_CLUSTER_HASH = HashingUtils::CompileTimeHashString("TERMINATE_CLUSTER");
+        static constexpr int CANCEL_AND_WAIT_HASH = HashingUtils::CompileTimeHashString("CANCEL_AND_WAIT");
+        static constexpr int CONTINUE_HASH = HashingUtils::CompileTimeHashString("CONTINUE");
 
 
         ActionOnFailure GetActionOnFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_JOB_FLOW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionOnFailure::TERMINATE_JOB_FLOW;
-          }
-          else if (hashCode == TERMINATE_CLUSTER_HASH)
-          {
-            return ActionOnFailure::TERMINATE_CLUSTER;
-          }
-          else if (hashCode == CANCEL_AND_WAIT_HASH)
-          {
-            return ActionOnFailure::CANCEL_AND_WAIT;
-          }
-          else if (hashCode == CONTINUE_HASH)
-          {
-            return ActionOnFailure::CONTINUE;
+          case TERMINATE_JOB_FLOW_HASH:
+            if (name == "TERMINATE_JOB_FLOW")
+            {
+              return ActionOnFailure::TERMINATE_JOB_FLOW;
+            }
+            break;
+          case TERMINATE_CLUSTER_HASH:
+            if (name == "TERMINATE_CLUSTER")
+            {
+              return ActionOnFailure::TERMINATE_CLUSTER;
+            }
+            break;
+          case CANCEL_AND_WAIT_HASH:
+            if (name == "CANCEL_AND_WAIT")
+            {
+              return ActionOnFailure::CANCEL_AND_WAIT;
+            }
+            break;
+          case CONTINUE_HASH:
+            if (name == "CONTINUE")
+            {
+              return ActionOnFailure::CONTINUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ActionOnFailure::NOT_SET;
         }
 
-        Aws::String GetNameForActionOnFailure(ActionOnFailure enumValue)
+        const char* GetNameForActionOnFailure(ActionOnFailure enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
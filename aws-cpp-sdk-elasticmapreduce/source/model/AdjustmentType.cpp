@@ -30,25 +30,37 @@ namespace Aws
       namespace AdjustmentTypeMapper
       {
 
-        static const int CHANGE_IN_CAPACITY_HASH = HashingUtils::HashString("CHANGE_IN_CAPACITY");
-        static const int PERCENT_CHANGE_IN_CAPACITY_HASH = HashingUtils::HashString("PERCENT_CHANGE_IN_CAPACITY");
-        static const int EXACT_CAPACITY_HASH = HashingUtils::HashString("EXACT_CAPACITY");
+        static constexpr int CHANGE_IN_CAPACITY_HASH = HashingUtils::CompileTimeHashString("CHANGE_IN_CAPACITY");
+        static constexpr int PERCENT_CHANGE_IN_CAPACITY_HASH = HashingUtils::CompileTimeHashString("PERCENT_CHANGE_IN_CAPACITY");
+        static constexpr int EXACT_CAPACITY_HASH = HashingUtils::CompileTimeHashString("EXACT_CAPACITY");
 
 
         AdjustmentType GetAdjustmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHANGE_IN_CAPACITY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AdjustmentType::CHANGE_IN_CAPACITY;
-          }
-          else if (hashCode == PERCENT_CHANGE_IN_CAPACITY_HASH)
-          {
-            return AdjustmentType::PERCENT_CHANGE_IN_CAPACITY;
-          }
-          else if (hashCode == EXACT_CAPACITY_HASH)
-          {
-            return AdjustmentType::EXACT_CAPACITY;
+          case CHANGE_IN_CAPACITY_HASH:
+            if (name == "CHANGE_IN_CAPACITY")
+            {
+              return AdjustmentType::CHANGE_IN_CAPACITY;
+            }
+            break;
+          case PERCENT_CHANGE_IN_CAPACITY_HASH:
+            if (name == "PERCENT_CHANGE_IN_CAPACITY")
+            {
+              return AdjustmentType::PERCENT_CHANGE_IN_CAPACITY;
+            }
+            break;
+          case EXACT_CAPACITY_HASH:
+            if (name == "EXACT_CAPACITY")
+            {
+              return AdjustmentType::EXACT_CAPACITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AdjustmentType::NOT_SET;
         }
 
-        Aws::String GetNameForAdjustmentType(AdjustmentType enumValue)
+        const char* GetNameForAdjustmentType(AdjustmentType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
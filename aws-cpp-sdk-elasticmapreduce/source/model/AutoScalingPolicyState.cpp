@@ -30,40 +30,58 @@ namespace Aws
       namespace AutoScalingPolicyStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int ATTACHING_HASH = HashingUtils::HashString("ATTACHING");
-        static const int ATTACHED_HASH = HashingUtils::HashString("ATTACHED");
-        static const int DETACHING_HASH = HashingUtils::HashString("DETACHING");
-        static const int DETACHED_HASH = HashingUtils::HashString("DETACHED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int ATTACHING_HASH = HashingUtils::CompileTimeHashString("ATTACHING");
+        static constexpr int ATTACHED_HASH = HashingUtils::CompileTimeHashString("ATTACHED");
+        static constexpr int DETACHING_HASH = HashingUtils::CompileTimeHashString("DETACHING");
+        static constexpr int DETACHED_HASH = HashingUtils::CompileTimeHashString("DETACHED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         AutoScalingPolicyState GetAutoScalingPolicyStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AutoScalingPolicyState::PENDING;
-          }
-          else if (hashCode == ATTACHING_HASH)
-          {
-            return AutoScalingPolicyState::ATTACHING;
-          }
-          else if (hashCode == ATTACHED_HASH)
-          {
-            return AutoScalingPolicyState::ATTACHED;
-          }
-          else if (hashCode == DETACHING_HASH)
-          {
-            return AutoScalingPolicyState::DETACHING;
-          }
-          else if (hashCode == DETACHED_HASH)
-          {
-            return AutoScalingPolicyState::DETACHED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AutoScalingPolicyState::FAILED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return AutoScalingPolicyState::PENDING;
+            }
+            break;
+          case ATTACHING_HASH:
+            if (name == "ATTACHING")
+            {
+              return AutoScalingPolicyState::ATTACHING;
+            }
+            break;
+          case ATTACHED_HASH:
+            if (name == "ATTACHED")
+            {
+              return AutoScalingPolicyState::ATTACHED;
+            }
+            break;
+          case DETACHING_HASH:
+            if (name == "DETACHING")
+            {
+              return AutoScalingPolicyState::DETACHING;
+            }
+            break;
+          case DETACHED_HASH:
+            if (name == "DETACHED")
+            {
+              return AutoScalingPolicyState::DETACHED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return AutoScalingPolicyState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return AutoScalingPolicyState::NOT_SET;
         }
 
-        Aws::String GetNameForAutoScalingPolicyState(AutoScalingPolicyState enumValue)
+        const char* GetNameForAutoScalingPolicyState(AutoScalingPolicyState enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
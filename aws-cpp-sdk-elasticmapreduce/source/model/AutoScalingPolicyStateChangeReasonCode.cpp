@@ -30,25 +30,37 @@ namespace Aws
       namespace AutoScalingPolicyStateChangeReasonCodeMapper
       {
 
-        static const int USER_REQUEST_HASH = HashingUtils::HashString("USER_REQUEST");
-        static const int PROVISION_FAILURE_HASH = HashingUtils::HashString("PROVISION_FAILURE");
-        static const int CLEANUP_FAILURE_HASH = HashingUtils::HashString("CLEANUP_FAILURE");
+        static constexpr int USER_REQUEST_HASH = HashingUtils::CompileTimeHashString("USER_REQUEST");
+        static constexpr int PROVISION_FAILURE_HASH = HashingUtils::CompileTimeHashString("PROVISION_FAILURE");
+        static constexpr int CLEANUP_FAILURE_HASH = HashingUtils::CompileTimeHashString("CLEANUP_FAILURE");
 
 
         AutoScalingPolicyStateChangeReasonCode GetAutoScalingPolicyStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_REQUEST_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AutoScalingPolicyStateChangeReasonCode::USER_REQUEST;
-          }
-          else if (hashCode == PROVISION_FAILURE_HASH)
-          {
-            return AutoScalingPolicyStateChangeReasonCode::PROVISION_FAILURE;
-          }
-          else if (hashCode == CLEANUP_FAILURE_HASH)
-          {
-            return AutoScalingPolicyStateChangeReasonCode::CLEANUP_FAILURE;
+          case USER_REQUEST_HASH:
+            if (name == "USER_REQUEST")
+            {
+              return AutoScalingPolicyStateChangeReasonCode::USER_REQUEST;
+            }
+            break;
+          case PROVISION_FAILURE_HASH:
+            if (name == "PROVISION_FAILURE")
+            {
+              return AutoScalingPolicyStateChangeReasonCode::PROVISION_FAILURE;
+            }
+            break;
+          case CLEANUP_FAILURE_HASH:
+            if (name == "CLEANUP_FAILURE")
+            {
+              return AutoScalingPolicyStateChangeReasonCode::CLEANUP_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AutoScalingPolicyStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForAutoScalingPolicyStateChangeReasonCode(AutoScalingPolicyStateChangeReasonCode enumValue)
+        const char* GetNameForAutoScalingPolicyStateChangeReasonCode(AutoScalingPolicyStateChangeReasonCode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
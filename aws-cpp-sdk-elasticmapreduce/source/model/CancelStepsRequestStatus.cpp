@@ -30,20 +30,30 @@ namespace Aws
       namespace CancelStepsRequestStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int SUBMITTED_HASH = HashingUtils::CompileTimeHashString("SUBMITTED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         CancelStepsRequestStatus GetCancelStepsRequestStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CancelStepsRequestStatus::SUBMITTED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return CancelStepsRequestStatus::FAILED;
+          case SUBMITTED_HASH:
+            if (name == "SUBMITTED")
+            {
+              return CancelStepsRequestStatus::SUBMITTED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return CancelStepsRequestStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CancelStepsRequestStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCancelStepsRequestStatus(CancelStepsRequestStatus enumValue)
+        const char* GetNameForCancelStepsRequestStatus(CancelStepsRequestStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace ClusterStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int WAITING_HASH = HashingUtils::HashString("WAITING");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int TERMINATED_WITH_ERRORS_HASH = HashingUtils::HashString("TERMINATED_WITH_ERRORS");
+        static constexpr int STARTING_HASH = HashingUtils::CompileTimeHashString("STARTING");
+        static constexpr int BOOTSTRAPPING_HASH = HashingUtils::CompileTimeHashString("BOOTSTRAPPING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int WAITING_HASH = HashingUtils::CompileTimeHashString("WAITING");
+        static constexpr int TERMINATING_HASH = HashingUtils::CompileTimeHashString("TERMINATING");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
+        static constexpr int TERMINATED_WITH_ERRORS_HASH = HashingUtils::CompileTimeHashString("TERMINATED_WITH_ERRORS");
 
 
         ClusterState GetClusterStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ClusterState::STARTING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return ClusterState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ClusterState::RUNNING;
-          }
-          else if (hashCode == WAITING_HASH)
-          {
-            return ClusterState::WAITING;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return ClusterState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return ClusterState::TERMINATED;
-          }
-          else if (hashCode == TERMINATED_WITH_ERRORS_HASH)
-          {
-            return ClusterState::TERMINATED_WITH_ERRORS;
+          case STARTING_HASH:
+            if (name == "STARTING")
+            {
+              return ClusterState::STARTING;
+            }
+            break;
+          case BOOTSTRAPPING_HASH:
+            if (name == "BOOTSTRAPPING")
+            {
+              return ClusterState::BOOTSTRAPPING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return ClusterState::RUNNING;
+            }
+            break;
+          case WAITING_HASH:
+            if (name == "WAITING")
+            {
+              return ClusterState::WAITING;
+            }
+            break;
+          case TERMINATING_HASH:
+            if (name == "TERMINATING")
+            {
+              return ClusterState::TERMINATING;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return ClusterState::TERMINATED;
+            }
+            break;
+          case TERMINATED_WITH_ERRORS_HASH:
+            if (name == "TERMINATED_WITH_ERRORS")
+            {
+              return ClusterState::TERMINATED_WITH_ERRORS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return ClusterState::NOT_SET;
         }
 
-        Aws::String GetNameForClusterState(ClusterState enumValue)
+        const char* GetNameForClusterState(ClusterState enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace ClusterStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int VALIDATION_ERROR_HASH = HashingUtils::HashString("VALIDATION_ERROR");
-        static const int INSTANCE_FAILURE_HASH = HashingUtils::HashString("INSTANCE_FAILURE");
-        static const int INSTANCE_FLEET_TIMEOUT_HASH = HashingUtils::HashString("INSTANCE_FLEET_TIMEOUT");
-        static const int BOOTSTRAP_FAILURE_HASH = HashingUtils::HashString("BOOTSTRAP_FAILURE");
-        static const int USER_REQUEST_HASH = HashingUtils::HashString("USER_REQUEST");
-        static const int STEP_FAILURE_HASH = HashingUtils::HashString("STEP_FAILURE");
-        static const int ALL_STEPS_COMPLETED_HASH = HashingUtils::HashString("ALL_STEPS_COMPLETED");
+        static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_ERROR");
+        static constexpr int VALIDATION_ERROR_HASH = HashingUtils::CompileTimeHashString("VALIDATION_ERROR");
+        static constexpr int INSTANCE_FAILURE_HASH = HashingUtils::CompileTimeHashString("INSTANCE_FAILURE");
+        static constexpr int INSTANCE_FLEET_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("INSTANCE_FLEET_TIMEOUT");
+        static constexpr int BOOTSTRAP_FAILURE_HASH = HashingUtils::CompileTimeHashString("BOOTSTRAP_FAILURE");
+        static constexpr int USER_REQUEST_HASH = HashingUtils::CompileTimeHashString("USER_REQUEST");
+        static constexpr int STEP_FAILURE_HASH = HashingUtils::CompileTimeHashString("STEP_FAILURE");
+        static constexpr int ALL_STEPS_COMPLETED_HASH = HashingUtils::CompileTimeHashString("ALL_STEPS_COMPLETED");
 
 
         ClusterStateChangeReasonCode GetClusterStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ClusterStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == VALIDATION_ERROR_HASH)
-          {
-            return ClusterStateChangeReasonCode::VALIDATION_ERROR;
-          }
-          else if (hashCode == INSTANCE_FAILURE_HASH)
-          {
-            return ClusterStateChangeReasonCode::INSTANCE_FAILURE;
-          }
-          else if (hashCode == INSTANCE_FLEET_TIMEOUT_HASH)
-          {
-            return ClusterStateChangeReasonCode::INSTANCE_FLEET_TIMEOUT;
-          }
-          else if (hashCode == BOOTSTRAP_FAILURE_HASH)
-          {
-            return ClusterStateChangeReasonCode::BOOTSTRAP_FAILURE;
-          }
-          else if (hashCode == USER_REQUEST_HASH)
-          {
-            return ClusterStateChangeReasonCode::USER_REQUEST;
-          }
-          else if (hashCode == STEP_FAILURE_HASH)
-          {
-            return ClusterStateChangeReasonCode::STEP_FAILURE;
-          }
-          else if (hashCode == ALL_STEPS_COMPLETED_HASH)
-          {
-            return ClusterStateChangeReasonCode::ALL_STEPS_COMPLETED;
+          case INTERNAL_ERROR_HASH:
+            if (name == "INTERNAL_ERROR")
+            {
+              return ClusterStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case VALIDATION_ERROR_HASH:
+            if (name == "VALIDATION_ERROR")
+            {
+              return ClusterStateChangeReasonCode::VALIDATION_ERROR;
+            }
+            break;
+          case INSTANCE_FAILURE_HASH:
+            if (name == "INSTANCE_FAILURE")
+            {
+              return ClusterStateChangeReasonCode::INSTANCE_FAILURE;
+            }
+            break;
+          case INSTANCE_FLEET_TIMEOUT_HASH:
+            if (name == "INSTANCE_FLEET_TIMEOUT")
+            {
+              return ClusterStateChangeReasonCode::INSTANCE_FLEET_TIMEOUT;
+            }
+            break;
+          case BOOTSTRAP_FAILURE_HASH:
+            if (name == "BOOTSTRAP_FAILURE")
+            {
+              return ClusterStateChangeReasonCode::BOOTSTRAP_FAILURE;
+            }
+            break;
+          case USER_REQUEST_HASH:
+            if (name == "USER_REQUEST")
+            {
+              return ClusterStateChangeReasonCode::USER_REQUEST;
+            }
+            break;
+          case STEP_FAILURE_HASH:
+            if (name == "STEP_FAILURE")
+            {
+              return ClusterStateChangeReasonCode::STEP_FAILURE;
+            }
+            break;
+          case ALL_STEPS_COMPLETED_HASH:
+            if (name == "ALL_STEPS_COMPLETED")
+            {
+              return ClusterStateChangeReasonCode::ALL_STEPS_COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return ClusterStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForClusterStateChangeReasonCode(ClusterStateChangeReasonCode enumValue)
+        const char* GetNameForClusterStateChangeReasonCode(ClusterStateChangeReasonCode enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
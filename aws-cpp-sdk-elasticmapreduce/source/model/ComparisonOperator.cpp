@@ -30,30 +30,44 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int GREATER_THAN_OR_EQUAL_HASH = HashingUtils::HashString("GREATER_THAN_OR_EQUAL");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int LESS_THAN_OR_EQUAL_HASH = HashingUtils::HashString("LESS_THAN_OR_EQUAL");
+        static constexpr int GREATER_THAN_OR_EQUAL_HASH = HashingUtils::CompileTimeHashString("GREATER_THAN_OR_EQUAL");
+        static constexpr int GREATER_THAN_HASH = HashingUtils::CompileTimeHashString("GREATER_THAN");
+        static constexpr int LESS_THAN_HASH = HashingUtils::CompileTimeHashString("LESS_THAN");
+        static constexpr int LESS_THAN_OR_EQUAL_HASH = HashingUtils::CompileTimeHashString("LESS_THAN_OR_EQUAL");
 
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GREATER_THAN_OR_EQUAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComparisonOperator::GREATER_THAN_OR_EQUAL;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
-            return ComparisonOperator::GREATER_THAN;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
-            return ComparisonOperator::LESS_THAN;
-          }
-          else if (hashCode == LESS_THAN_OR_EQUAL_HASH)
-          {
-            return ComparisonOperator::LESS_THAN_OR_EQUAL;
+          case GREATER_THAN_OR_EQUAL_HASH:
+            if (name == "GREATER_THAN_OR_EQUAL")
+            {
+              return ComparisonOperator::GREATER_THAN_OR_EQUAL;
+            }
+            break;
+          case GREATER_THAN_HASH:
+            if (name == "GREATER_THAN")
+            {
+              return ComparisonOperator::GREATER_THAN;
+            }
+            break;
+          case LESS_THAN_HASH:
+            if (name == "LESS_THAN")
+            {
+              return ComparisonOperator::LESS_THAN;
+            }
+            break;
+          case LESS_THAN_OR_EQUAL_HASH:
+            if (name == "LESS_THAN_OR_EQUAL")
+            {
+              return ComparisonOperator::LESS_THAN_OR_EQUAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperator(ComparisonOperator enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace InstanceCollectionTypeMapper
       {
 
-        static const int INSTANCE_FLEET_HASH = HashingUtils::HashString("INSTANCE_FLEET");
-        static const int INSTANCE_GROUP_HASH = HashingUtils::HashString("INSTANCE_GROUP");
+        static constexpr int INSTANCE_FLEET_HASH = HashingUtils::CompileTimeHashString("INSTANCE_FLEET");
+        static constexpr int INSTANCE_GROUP_HASH = HashingUtils::CompileTimeHashString("INSTANCE_GROUP");
 
 
         InstanceCollectionType GetInstanceCollectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTANCE_FLEET_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceCollectionType::INSTANCE_FLEET;
-          }
-          else if (hashCode == INSTANCE_GROUP_HASH)
-          {
-            return InstanceCollectionType::INSTANCE_GROUP;
+          case INSTANCE_FLEET_HASH:
+            if (name == "INSTANCE_FLEET")
+            {
+              return InstanceCollectionType::INSTANCE_FLEET;
+            }
+            break;
+          case INSTANCE_GROUP_HASH:
+            if (name == "INSTANCE_GROUP")
+            {
+              return InstanceCollectionType::INSTANCE_GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InstanceCollectionType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceCollectionType(InstanceCollectionType enumValue)
+        const char* GetNameForInstanceCollectionType(InstanceCollectionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
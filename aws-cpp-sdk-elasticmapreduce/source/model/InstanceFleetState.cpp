@@ -30,45 +30,65 @@ namespace Aws
       namespace InstanceFleetStateMapper
       {
 
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int RESIZING_HASH = HashingUtils::HashString("RESIZING");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
+        static constexpr int PROVISIONING_HASH = HashingUtils::CompileTimeHashString("PROVISIONING");
+        static constexpr int BOOTSTRAPPING_HASH = HashingUtils::CompileTimeHashString("BOOTSTRAPPING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int RESIZING_HASH = HashingUtils::CompileTimeHashString("RESIZING");
+        static constexpr int SUSPENDED_HASH = HashingUtils::CompileTimeHashString("SUSPENDED");
+        static constexpr int TERMINATING_HASH = HashingUtils::CompileTimeHashString("TERMINATING");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
 
 
         InstanceFleetState GetInstanceFleetStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROVISIONING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceFleetState::PROVISIONING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return InstanceFleetState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return InstanceFleetState::RUNNING;
-          }
-          else if (hashCode == RESIZING_HASH)
-          {
-            return InstanceFleetState::RESIZING;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
-            return InstanceFleetState::SUSPENDED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return InstanceFleetState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return InstanceFleetState::TERMINATED;
+          case PROVISIONING_HASH:
+            if (name == "PROVISIONING")
+            {
+              return InstanceFleetState::PROVISIONING;
+            }
+            break;
+          case BOOTSTRAPPING_HASH:
+            if (name == "BOOTSTRAPPING")
+            {
+              return InstanceFleetState::BOOTSTRAPPING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return InstanceFleetState::RUNNING;
+            }
+            break;
+          case RESIZING_HASH:
+            if (name == "RESIZING")
+            {
+              return InstanceFleetState::RESIZING;
+            }
+            break;
+          case SUSPENDED_HASH:
+            if (name == "SUSPENDED")
+            {
+              return InstanceFleetState::SUSPENDED;
+            }
+            break;
+          case TERMINATING_HASH:
+            if (name == "TERMINATING")
+            {
+              return InstanceFleetState::TERMINATING;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return InstanceFleetState::TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return InstanceFleetState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceFleetState(InstanceFleetState enumValue)
+        const char* GetNameForInstanceFleetState(InstanceFleetState enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
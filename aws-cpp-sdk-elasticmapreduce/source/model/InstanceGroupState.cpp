@@ -30,60 +30,86 @@ namespace Aws
       namespace InstanceGroupStateMapper
       {
 
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int RESIZING_HASH = HashingUtils::HashString("RESIZING");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int ARRESTED_HASH = HashingUtils::HashString("ARRESTED");
-        static const int SHUTTING_DOWN_HASH = HashingUtils::HashString("SHUTTING_DOWN");
-        static const int ENDED_HASH = HashingUtils::HashString("ENDED");
+        static constexpr int PROVISIONING_HASH = HashingUtils::CompileTimeHashString("PROVISIONING");
+        static constexpr int BOOTSTRAPPING_HASH = HashingUtils::CompileTimeHashString("BOOTSTRAPPING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int RESIZING_HASH = HashingUtils::CompileTimeHashString("RESIZING");
+        static constexpr int SUSPENDED_HASH = HashingUtils::CompileTimeHashString("SUSPENDED");
+        static constexpr int TERMINATING_HASH = HashingUtils::CompileTimeHashString("TERMINATING");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
+        static constexpr int ARRESTED_HASH = HashingUtils::CompileTimeHashString("ARRESTED");
+        static constexpr int SHUTTING_DOWN_HASH = HashingUtils::CompileTimeHashString("SHUTTING_DOWN");
+        static constexpr int ENDED_HASH = HashingUtils::CompileTimeHashString("ENDED");
 
 
         InstanceGroupState GetInstanceGroupStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROVISIONING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceGroupState::PROVISIONING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return InstanceGroupState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return InstanceGroupState::RUNNING;
-          }
-          else if (hashCode == RESIZING_HASH)
-          {
-            return InstanceGroupState::RESIZING;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
-            return InstanceGroupState::SUSPENDED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return InstanceGroupState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return InstanceGroupState::TERMINATED;
-          }
-          else if (hashCode == ARRESTED_HASH)
-          {
-            return InstanceGroupState::ARRESTED;
-          }
-          else if (hashCode == SHUTTING_DOWN_HASH)
-          {
-            return InstanceGroupState::SHUTTING_DOWN;
-          }
-          else if (hashCode == ENDED_HASH)
-          {
-            return InstanceGroupState::ENDED;
+          case PROVISIONING_HASH:
+            if (name == "PROVISIONING")
+            {
+              return InstanceGroupState::PROVISIONING;
+            }
+            break;
+          case BOOTSTRAPPING_HASH:
+            if (name == "BOOTSTRAPPING")
+            {
+              return InstanceGroupState::BOOTSTRAPPING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return InstanceGroupState::RUNNING;
+            }
+            break;
+          case RESIZING_HASH:
+            if (name == "RESIZING")
+            {
+              return InstanceGroupState::RESIZING;
+            }
+            break;
+          case SUSPENDED_HASH:
+            if (name == "SUSPENDED")
+            {
+              return InstanceGroupState::SUSPENDED;
+            }
+            break;
+          case TERMINATING_HASH:
+            if (name == "TERMINATING")
+            {
+              return InstanceGroupState::TERMINATING;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return InstanceGroupState::TERMINATED;
+            }
+            break;
+          case ARRESTED_HASH:
+            if (name == "ARRESTED")
+            {
+              return InstanceGroupState::ARRESTED;
+            }
+            break;
+          case SHUTTING_DOWN_HASH:
+            if (name == "SHUTTING_DOWN")
+            {
+              return InstanceGroupState::SHUTTING_DOWN;
+            }
+            break;
+          case ENDED_HASH:
+            if (name == "ENDED")
+            {
+              return InstanceGroupState::ENDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return InstanceGroupState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceGroupState(InstanceGroupState enumValue)
+        const char* GetNameForInstanceGroupState(InstanceGroupState enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
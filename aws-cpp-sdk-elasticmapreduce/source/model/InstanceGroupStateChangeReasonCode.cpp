@@ -30,30 +30,44 @@ namespace Aws
       namespace InstanceGroupStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int VALIDATION_ERROR_HASH = HashingUtils::HashString("VALIDATION_ERROR");
-        static const int INSTANCE_FAILURE_HASH = HashingUtils::HashString("INSTANCE_FAILURE");
-        static const int CLUSTER_TERMINATED_HASH = HashingUtils::HashString("CLUSTER_TERMINATED");
+        static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_ERROR");
+        static constexpr int VALIDATION_ERROR_HASH = HashingUtils::CompileTimeHashString("VALIDATION_ERROR");
+        static constexpr int INSTANCE_FAILURE_HASH = HashingUtils::CompileTimeHashString("INSTANCE_FAILURE");
+        static constexpr int CLUSTER_TERMINATED_HASH = HashingUtils::CompileTimeHashString("CLUSTER_TERMINATED");
 
 
         InstanceGroupStateChangeReasonCode GetInstanceGroupStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceGroupStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == VALIDATION_ERROR_HASH)
-          {
-            return InstanceGroupStateChangeReasonCode::VALIDATION_ERROR;
-          }
-          else if (hashCode == INSTANCE_FAILURE_HASH)
-          {
-            return InstanceGroupStateChangeReasonCode::INSTANCE_FAILURE;
-          }
-          else if (hashCode == CLUSTER_TERMINATED_HASH)
-          {
-            return InstanceGroupStateChangeReasonCode::CLUSTER_TERMINATED;
+          case INTERNAL_ERROR_HASH:
+            if (name == "INTERNAL_ERROR")
+            {
+              return InstanceGroupStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case VALIDATION_ERROR_HASH:
+            if (name == "VALIDATION_ERROR")
+            {
+              return InstanceGroupStateChangeReasonCode::VALIDATION_ERROR;
+            }
+            break;
+          case INSTANCE_FAILURE_HASH:
+            if (name == "INSTANCE_FAILURE")
+            {
+              return InstanceGroupStateChangeReasonCode::INSTANCE_FAILURE;
+            }
+            break;
+          case CLUSTER_TERMINATED_HASH:
+            if (name == "CLUSTER_TERMINATED")
+            {
+              return InstanceGroupStateChangeReasonCode::CLUSTER_TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return InstanceGroupStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceGroupStateChangeReasonCode(InstanceGroupStateChangeReasonCode enumValue)
+        const char* GetNameForInstanceGroupStateChangeReasonCode(InstanceGroupStateChangeReasonCode enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace InstanceGroupTypeMapper
       {
 
-        static const int MASTER_HASH = HashingUtils::HashString("MASTER");
-        static const int CORE_HASH = HashingUtils::HashString("CORE");
-        static const int TASK_HASH = HashingUtils::HashString("TASK");
+        static constexpr int MASTER_HASH = HashingUtils::CompileTimeHashString("MASTER");
+        static constexpr int CORE_HASH = HashingUtils::CompileTimeHashString("CORE");
+        static constexpr int TASK_HASH = HashingUtils::CompileTimeHashString("TASK");
 
 
         InstanceGroupType GetInstanceGroupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MASTER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceGroupType::MASTER;
-          }
-          else if (hashCode == CORE_HASH)
-          {
-            return InstanceGroupType::CORE;
-          }
-          else if (hashCode == TASK_HASH)
-          {
-            return InstanceGroupType::TASK;
+          case MASTER_HASH:
+            if (name == "MASTER")
+            {
+              return InstanceGroupType::MASTER;
+            }
+            break;
+          case CORE_HASH:
+            if (name == "CORE")
+            {
+              return InstanceGroupType::CORE;
+            }
+            break;
+          case TASK_HASH:
+            if (name == "TASK")
+            {
+              return InstanceGroupType::TASK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InstanceGroupType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceGroupType(InstanceGroupType enumValue)
+        const char* GetNameForInstanceGroupType(InstanceGroupType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace InstanceStateMapper
       {
 
-        static const int AWAITING_FULFILLMENT_HASH = HashingUtils::HashString("AWAITING_FULFILLMENT");
-        static const int PROVISIONING_HASH = HashingUtils::HashString("PROVISIONING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
+        static constexpr int AWAITING_FULFILLMENT_HASH = HashingUtils::CompileTimeHashString("AWAITING_FULFILLMENT");
+        static constexpr int PROVISIONING_HASH = HashingUtils::CompileTimeHashString("PROVISIONING");
+        static constexpr int BOOTSTRAPPING_HASH = HashingUtils::CompileTimeHashString("BOOTSTRAPPING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
 
 
         InstanceState GetInstanceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWAITING_FULFILLMENT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceState::AWAITING_FULFILLMENT;
-          }
-          else if (hashCode == PROVISIONING_HASH)
-          {
-            return InstanceState::PROVISIONING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return InstanceState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return InstanceState::RUNNING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return InstanceState::TERMINATED;
+          case AWAITING_FULFILLMENT_HASH:
+            if (name == "AWAITING_FULFILLMENT")
+            {
+              return InstanceState::AWAITING_FULFILLMENT;
+            }
+            break;
+          case PROVISIONING_HASH:
+            if (name == "PROVISIONING")
+            {
+              return InstanceState::PROVISIONING;
+            }
+            break;
+          case BOOTSTRAPPING_HASH:
+            if (name == "BOOTSTRAPPING")
+            {
+              return InstanceState::BOOTSTRAPPING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return InstanceState::RUNNING;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return InstanceState::TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return InstanceState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceState(InstanceState enumValue)
+        const char* GetNameForInstanceState(InstanceState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace InstanceStateChangeReasonCodeMapper
       {
 
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
-        static const int VALIDATION_ERROR_HASH = HashingUtils::HashString("VALIDATION_ERROR");
-        static const int INSTANCE_FAILURE_HASH = HashingUtils::HashString("INSTANCE_FAILURE");
-        static const int BOOTSTRAP_FAILURE_HASH = HashingUtils::HashString("BOOTSTRAP_FAILURE");
-        static const int CLUSTER_TERMINATED_HASH = HashingUtils::HashString("CLUSTER_TERMINATED");
+        static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_ERROR");
+        static constexpr int VALIDATION_ERROR_HASH = HashingUtils::CompileTimeHashString("VALIDATION_ERROR");
+        static constexpr int INSTANCE_FAILURE_HASH = HashingUtils::CompileTimeHashString("INSTANCE_FAILURE");
+        static constexpr int BOOTSTRAP_FAILURE_HASH = HashingUtils::CompileTimeHashString("BOOTSTRAP_FAILURE");
+        static constexpr int CLUSTER_TERMINATED_HASH = HashingUtils::CompileTimeHashString("CLUSTER_TERMINATED");
 
 
         InstanceStateChangeReasonCode GetInstanceStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERNAL_ERROR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceStateChangeReasonCode::INTERNAL_ERROR;
-          }
-          else if (hashCode == VALIDATION_ERROR_HASH)
-          {
-            return InstanceStateChangeReasonCode::VALIDATION_ERROR;
-          }
-          else if (hashCode == INSTANCE_FAILURE_HASH)
-          {
-            return InstanceStateChangeReasonCode::INSTANCE_FAILURE;
-          }
-          else if (hashCode == BOOTSTRAP_FAILURE_HASH)
-          {
-            return InstanceStateChangeReasonCode::BOOTSTRAP_FAILURE;
-          }
-          else if (hashCode == CLUSTER_TERMINATED_HASH)
-          {
-            return InstanceStateChangeReasonCode::CLUSTER_TERMINATED;
+          case INTERNAL_ERROR_HASH:
+            if (name == "INTERNAL_ERROR")
+            {
+              return InstanceStateChangeReasonCode::INTERNAL_ERROR;
+            }
+            break;
+          case VALIDATION_ERROR_HASH:
+            if (name == "VALIDATION_ERROR")
+            {
+              return InstanceStateChangeReasonCode::VALIDATION_ERROR;
+            }
+            break;
+          case INSTANCE_FAILURE_HASH:
+            if (name == "INSTANCE_FAILURE")
+            {
+              return InstanceStateChangeReasonCode::INSTANCE_FAILURE;
+            }
+            break;
+          case BOOTSTRAP_FAILURE_HASH:
+            if (name == "BOOTSTRAP_FAILURE")
+            {
+              return InstanceStateChangeReasonCode::BOOTSTRAP_FAILURE;
+            }
+            break;
+          case CLUSTER_TERMINATED_HASH:
+            if (name == "CLUSTER_TERMINATED")
+            {
+              return InstanceStateChangeReasonCode::CLUSTER_TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return InstanceStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceStateChangeReasonCode(InstanceStateChangeReasonCode enumValue)
+        const char* GetNameForInstanceStateChangeReasonCode(InstanceStateChangeReasonCode enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
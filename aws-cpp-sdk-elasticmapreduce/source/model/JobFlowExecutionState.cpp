@@ -30,50 +30,72 @@ namespace Aws
       namespace JobFlowExecutionStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int BOOTSTRAPPING_HASH = HashingUtils::HashString("BOOTSTRAPPING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int WAITING_HASH = HashingUtils::HashString("WAITING");
-        static const int SHUTTING_DOWN_HASH = HashingUtils::HashString("SHUTTING_DOWN");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int STARTING_HASH = HashingUtils::CompileTimeHashString("STARTING");
+        static constexpr int BOOTSTRAPPING_HASH = HashingUtils::CompileTimeHashString("BOOTSTRAPPING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int WAITING_HASH = HashingUtils::CompileTimeHashString("WAITING");
+        static constexpr int SHUTTING_DOWN_HASH = HashingUtils::CompileTimeHashString("SHUTTING_DOWN");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         JobFlowExecutionState GetJobFlowExecutionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobFlowExecutionState::STARTING;
-          }
-          else if (hashCode == BOOTSTRAPPING_HASH)
-          {
-            return JobFlowExecutionState::BOOTSTRAPPING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return JobFlowExecutionState::RUNNING;
-          }
-          else if (hashCode == WAITING_HASH)
-          {
-            return JobFlowExecutionState::WAITING;
-          }
-          else if (hashCode == SHUTTING_DOWN_HASH)
-          {
-            return JobFlowExecutionState::SHUTTING_DOWN;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return JobFlowExecutionState::TERMINATED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return JobFlowExecutionState::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobFlowExecutionState::FAILED;
+          case STARTING_HASH:
+            if (name == "STARTING")
+            {
+              return JobFlowExecutionState::STARTING;
+            }
+            break;
+          case BOOTSTRAPPING_HASH:
+            if (name == "BOOTSTRAPPING")
+            {
+              return JobFlowExecutionState::BOOTSTRAPPING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return JobFlowExecutionState::RUNNING;
+            }
+            break;
+          case WAITING_HASH:
+            if (name == "WAITING")
+            {
+              return JobFlowExecutionState::WAITING;
+            }
+            break;
+          case SHUTTING_DOWN_HASH:
+            if (name == "SHUTTING_DOWN")
+            {
+              return JobFlowExecutionState::SHUTTING_DOWN;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return JobFlowExecutionState::TERMINATED;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return JobFlowExecutionState::COMPLETED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return JobFlowExecutionState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return JobFlowExecutionState::NOT_SET;
         }
 
-        Aws::String GetNameForJobFlowExecutionState(JobFlowExecutionState enumValue)
+        const char* GetNameForJobFlowExecutionState(JobFlowExecutionState enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace RepoUpgradeOnBootMapper
       {
 
-        static const int SECURITY_HASH = HashingUtils::HashString("SECURITY");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int SECURITY_HASH = HashingUtils::CompileTimeHashString("SECURITY");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         RepoUpgradeOnBoot GetRepoUpgradeOnBootForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SECURITY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RepoUpgradeOnBoot::SECURITY;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return RepoUpgradeOnBoot::NONE;
+          case SECURITY_HASH:
+            if (name == "SECURITY")
+            {
+              return RepoUpgradeOnBoot::SECURITY;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return RepoUpgradeOnBoot::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RepoUpgradeOnBoot::NOT_SET;
         }
 
-        Aws::String GetNameForRepoUpgradeOnBoot(RepoUpgradeOnBoot enumValue)
+        const char* GetNameForRepoUpgradeOnBoot(RepoUpgradeOnBoot enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
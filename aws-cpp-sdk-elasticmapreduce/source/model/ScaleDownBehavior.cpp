@@ -30,20 +30,30 @@ namespace Aws
       namespace ScaleDownBehaviorMapper
       {
 
-        static const int TERMINATE_AT_INSTANCE_HOUR_HASH = HashingUtils::HashString("TERMINATE_AT_INSTANCE_HOUR");
-        static const int TERMINATE_AT_TASK_COMPLETION_HASH = HashingUtils::HashString("TERMINATE_AT_TASK_COMPLETION");
+        static constexpr int TERMINATE_AT_INSTANCE_HOUR_HASH = HashingUtils::CompileTimeHashString("TERMINATE_AT_INSTANCE_HOUR");
+        static constexpr int TERMINATE_AT_TASK_COMPLETION_HASH = HashingUtils::CompileTimeHashString("TERMINATE_AT_TASK_COMPLETION");
 
 
         ScaleDownBehavior GetScaleDownBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_AT_INSTANCE_HOUR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScaleDownBehavior::TERMINATE_AT_INSTANCE_HOUR;
-          }
-          else if (hashCode == TERMINATE_AT_TASK_COMPLETION_HASH)
-          {
-            return ScaleDownBehavior::TERMINATE_AT_TASK_COMPLETION;
+          case TERMINATE_AT_INSTANCE_HOUR_HASH:
+            if (name == "TERMINATE_AT_INSTANCE_HOUR")
+            {
+              return ScaleDownBehavior::TERMINATE_AT_INSTANCE_HOUR;
+            }
+            break;
+          case TERMINATE_AT_TASK_COMPLETION_HASH:
+            if (name == "TERMINATE_AT_TASK_COMPLETION")
+            {
+              return ScaleDownBehavior::TERMINATE_AT_TASK_COMPLETION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ScaleDownBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForScaleDownBehavior(ScaleDownBehavior enumValue)
+        const char* GetNameForScaleDownBehavior(ScaleDownBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SpotProvisioningTimeoutActionMapper
       {
 
-        static const int SWITCH_TO_ON_DEMAND_HASH = HashingUtils::HashString("SWITCH_TO_ON_DEMAND");
-        static const int TERMINATE_CLUSTER_HASH = HashingUtils::HashString("TERMINATE_CLUSTER");
+        static constexpr int SWITCH_TO_ON_DEMAND_HASH = HashingUtils::CompileTimeHashString("SWITCH_TO_ON_DEMAND");
+        static constexpr int TERMINATE_CLUSTER_HASH = HashingUtils::CompileTimeHashString("TERMINATE_CLUSTER");
 
 
         SpotProvisioningTimeoutAction GetSpotProvisioningTimeoutActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SWITCH_TO_ON_DEMAND_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SpotProvisioningTimeoutAction::SWITCH_TO_ON_DEMAND;
-          }
-          else if (hashCode == TERMINATE_CLUSTER_HASH)
-          {
-            return SpotProvisioningTimeoutAction::TERMINATE_CLUSTER;
+          case SWITCH_TO_ON_DEMAND_HASH:
+            if (name == "SWITCH_TO_ON_DEMAND")
+            {
+              return SpotProvisioningTimeoutAction::SWITCH_TO_ON_DEMAND;
+            }
+            break;
+          case TERMINATE_CLUSTER_HASH:
+            if (name == "TERMINATE_CLUSTER")
+            {
+              return SpotProvisioningTimeoutAction::TERMINATE_CLUSTER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SpotProvisioningTimeoutAction::NOT_SET;
         }
 
-        Aws::String GetNameForSpotProvisioningTimeoutAction(SpotProvisioningTimeoutAction enumValue)
+        const char* GetNameForSpotProvisioningTimeoutAction(SpotProvisioningTimeoutAction enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace StatisticMapper
       {
 
-        static const int SAMPLE_COUNT_HASH = HashingUtils::HashString("SAMPLE_COUNT");
-        static const int AVERAGE_HASH = HashingUtils::HashString("AVERAGE");
-        static const int SUM_HASH = HashingUtils::HashString("SUM");
-        static const int MINIMUM_HASH = HashingUtils::HashString("MINIMUM");
-        static const int MAXIMUM_HASH = HashingUtils::HashString("MAXIMUM");
+        static constexpr int SAMPLE_COUNT_HASH = HashingUtils::CompileTimeHashString("SAMPLE_COUNT");
+        static constexpr int AVERAGE_HASH = HashingUtils::CompileTimeHashString("AVERAGE");
+        static constexpr int SUM_HASH = HashingUtils::CompileTimeHashString("SUM");
+        static constexpr int MINIMUM_HASH = HashingUtils::CompileTimeHashString("MINIMUM");
+        static constexpr int MAXIMUM_HASH = HashingUtils::CompileTimeHashString("MAXIMUM");
 
 
         Statistic GetStatisticForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SAMPLE_COUNT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Statistic::SAMPLE_COUNT;
-          }
-          else if (hashCode == AVERAGE_HASH)
-          {
-            return Statistic::AVERAGE;
-          }
-          else if (hashCode == SUM_HASH)
-          {
-            return Statistic::SUM;
-          }
-          else if (hashCode == MINIMUM_HASH)
-          {
-            return Statistic::MINIMUM;
-          }
-          else if (hashCode == MAXIMUM_HASH)
-          {
-            return Statistic::MAXIMUM;
+          case SAMPLE_COUNT_HASH:
+            if (name == "SAMPLE_COUNT")
+            {
+              return Statistic::SAMPLE_COUNT;
+            }
+            break;
+          case AVERAGE_HASH:
+            if (name == "AVERAGE")
+            {
+              return Statistic::AVERAGE;
+            }
+            break;
+          case SUM_HASH:
+            if (name == "SUM")
+            {
+              return Statistic::SUM;
+            }
+            break;
+          case MINIMUM_HASH:
+            if (name == "MINIMUM")
+            {
+              return Statistic::MINIMUM;
+            }
+            break;
+          case MAXIMUM_HASH:
+            if (name == "MAXIMUM")
+            {
+              return Statistic::MAXIMUM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Statistic::NOT_SET;
         }
 
-        Aws::String GetNameForStatistic(Statistic enumValue)
+        const char* GetNameForStatistic(Statistic enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
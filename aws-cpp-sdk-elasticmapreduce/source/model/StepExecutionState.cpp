@@ -30,45 +30,65 @@ namespace Aws
       namespace StepExecutionStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int CONTINUE_HASH = HashingUtils::HashString("CONTINUE");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int INTERRUPTED_HASH = HashingUtils::HashString("INTERRUPTED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int CONTINUE_HASH = HashingUtils::CompileTimeHashString("CONTINUE");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int CANCELLED_HASH = HashingUtils::CompileTimeHashString("CANCELLED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int INTERRUPTED_HASH = HashingUtils::CompileTimeHashString("INTERRUPTED");
 
 
         StepExecutionState GetStepExecutionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StepExecutionState::PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return StepExecutionState::RUNNING;
-          }
-          else if (hashCode == CONTINUE_HASH)
-          {
-            return StepExecutionState::CONTINUE;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return StepExecutionState::COMPLETED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return StepExecutionState::CANCELLED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StepExecutionState::FAILED;
-          }
-          else if (hashCode == INTERRUPTED_HASH)
-          {
-            return StepExecutionState::INTERRUPTED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return StepExecutionState::PENDING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return StepExecutionState::RUNNING;
+            }
+            break;
+          case CONTINUE_HASH:
+            if (name == "CONTINUE")
+            {
+              return StepExecutionState::CONTINUE;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return StepExecutionState::COMPLETED;
+            }
+            break;
+          case CANCELLED_HASH:
+            if (name == "CANCELLED")
+            {
+              return StepExecutionState::CANCELLED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return StepExecutionState::FAILED;
+            }
+            break;
+          case INTERRUPTED_HASH:
+            if (name == "INTERRUPTED")
+            {
+              return StepExecutionState::INTERRUPTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return StepExecutionState::NOT_SET;
         }
 
-        Aws::String GetNameForStepExecutionState(StepExecutionState enumValue)
+        const char* GetNameForStepExecutionState(StepExecutionState enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace StepStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int CANCEL_PENDING_HASH = HashingUtils::HashString("CANCEL_PENDING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int INTERRUPTED_HASH = HashingUtils::HashString("INTERRUPTED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int CANCEL_PENDING_HASH = HashingUtils::CompileTimeHashString("CANCEL_PENDING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int CANCELLED_HASH = HashingUtils::CompileTimeHashString("CANCELLED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int INTERRUPTED_HASH = HashingUtils::CompileTimeHashString("INTERRUPTED");
 
 
         StepState GetStepStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StepState::PENDING;
-          }
-          else if (hashCode == CANCEL_PENDING_HASH)
-          {
-            return StepState::CANCEL_PENDING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return StepState::RUNNING;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return StepState::COMPLETED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return StepState::CANCELLED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StepState::FAILED;
-          }
-          else if (hashCode == INTERRUPTED_HASH)
-          {
-            return StepState::INTERRUPTED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return StepState::PENDING;
+            }
+            break;
+          case CANCEL_PENDING_HASH:
+            if (name == "CANCEL_PENDING")
+            {
+              return StepState::CANCEL_PENDING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return StepState::RUNNING;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return StepState::COMPLETED;
+            }
+            break;
+          case CANCELLED_HASH:
+            if (name == "CANCELLED")
+            {
+              return StepState::CANCELLED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return StepState::FAILED;
+            }
+            break;
+          case INTERRUPTED_HASH:
+            if (name == "INTERRUPTED")
+            {
+              return StepState::INTERRUPTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return StepState::NOT_SET;
         }
 
-        Aws::String GetNameForStepState(StepState enumValue)
+        const char* GetNameForStepState(StepState enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace StepStateChangeReasonCodeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         StepStateChangeReasonCode GetStepStateChangeReasonCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StepStateChangeReasonCode::NONE;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return StepStateChangeReasonCode::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return StepStateChangeReasonCode::NOT_SET;
         }
 
-        Aws::String GetNameForStepStateChangeReasonCode(StepStateChangeReasonCode enumValue)
+        const char* GetNameForStepStateChangeReasonCode(StepStateChangeReasonCode enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,145 +30,205 @@ namespace Aws
       namespace UnitMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SECONDS_HASH = HashingUtils::HashString("SECONDS");
-        static const int MICRO_SECONDS_HASH = HashingUtils::HashString("MICRO_SECONDS");
-        static const int MILLI_SECONDS_HASH = HashingUtils::HashString("MILLI_SECONDS");
-        static const int BYTES_HASH = HashingUtils::HashString("BYTES");
-        static const int KILO_BYTES_HASH = HashingUtils::HashString("KILO_BYTES");
-        static const int MEGA_BYTES_HASH = HashingUtils::HashString("MEGA_BYTES");
-        static const int GIGA_BYTES_HASH = HashingUtils::HashString("GIGA_BYTES");
-        static const int TERA_BYTES_HASH = HashingUtils::HashString("TERA_BYTES");
-        static const int BITS_HASH = HashingUtils::HashString("BITS");
-        static const int KILO_BITS_HASH = HashingUtils::HashString("KILO_BITS");
-        static const int MEGA_BITS_HASH = HashingUtils::HashString("MEGA_BITS");
-        static const int GIGA_BITS_HASH = HashingUtils::HashString("GIGA_BITS");
-        static const int TERA_BITS_HASH = HashingUtils::HashString("TERA_BITS");
-        static const int PERCENT_HASH = HashingUtils::HashString("PERCENT");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
-        static const int BYTES_PER_SECOND_HASH = HashingUtils::HashString("BYTES_PER_SECOND");
-        static const int KILO_BYTES_PER_SECOND_HASH = HashingUtils::HashString("KILO_BYTES_PER_SECOND");
-        static const int MEGA_BYTES_PER_SECOND_HASH = HashingUtils::HashString("MEGA_BYTES_PER_SECOND");
-        static const int GIGA_BYTES_PER_SECOND_HASH = HashingUtils::HashString("GIGA_BYTES_PER_SECOND");
-        static const int TERA_BYTES_PER_SECOND_HASH = HashingUtils::HashString("TERA_BYTES_PER_SECOND");
-        static const int BITS_PER_SECOND_HASH = HashingUtils::HashString("BITS_PER_SECOND");
-        static const int KILO_BITS_PER_SECOND_HASH = HashingUtils::HashString("KILO_BITS_PER_SECOND");
-        static const int MEGA_BITS_PER_SECOND_HASH = HashingUtils::HashString("MEGA_BITS_PER_SECOND");
-        static const int GIGA_BITS_PER_SECOND_HASH = HashingUtils::HashString("GIGA_BITS_PER_SECOND");
-        static const int TERA_BITS_PER_SECOND_HASH = HashingUtils::HashString("TERA_BITS_PER_SECOND");
-        static const int COUNT_PER_SECOND_HASH = HashingUtils::HashString("COUNT_PER_SECOND");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int SECONDS_HASH = HashingUtils::CompileTimeHashString("SECONDS");
+        static constexpr int MICRO_SECONDS_HASH = HashingUtils::CompileTimeHashString("MICRO_SECONDS");
+        static constexpr int MILLI_SECONDS_HASH = HashingUtils::CompileTimeHashString("MILLI_SECONDS");
+        static constexpr int BYTES_HASH = HashingUtils::CompileTimeHashString("BYTES");
+        static constexpr int KILO_BYTES_HASH = HashingUtils::CompileTimeHashString("KILO_BYTES");
+        static constexpr int MEGA_BYTES_HASH = HashingUtils::CompileTimeHashString("MEGA_BYTES");
+        static constexpr int GIGA_BYTES_HASH = HashingUtils::CompileTimeHashString("GIGA_BYTES");
+        static constexpr int TERA_BYTES_HASH = HashingUtils::CompileTimeHashString("TERA_BYTES");
+        static constexpr int BITS_HASH = HashingUtils::CompileTimeHashString("BITS");
+        static constexpr int KILO_BITS_HASH = HashingUtils::CompileTimeHashString("KILO_BITS");
+        static constexpr int MEGA_BITS_HASH = HashingUtils::CompileTimeHashString("MEGA_BITS");
+        static constexpr int GIGA_BITS_HASH = HashingUtils::CompileTimeHashString("GIGA_BITS");
+        static constexpr int TERA_BITS_HASH = HashingUtils::CompileTimeHashString("TERA_BITS");
+        static constexpr int PERCENT_HASH = HashingUtils::CompileTimeHashString("PERCENT");
+        static constexpr int COUNT_HASH = HashingUtils::CompileTimeHashString("COUNT");
+        static constexpr int BYTES_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("BYTES_PER_SECOND");
+        static constexpr int KILO_BYTES_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("KILO_BYTES_PER_SECOND");
+        static constexpr int MEGA_BYTES_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("MEGA_BYTES_PER_SECOND");
+        static constexpr int GIGA_BYTES_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("GIGA_BYTES_PER_SECOND");
+        static constexpr int TERA_BYTES_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("TERA_BYTES_PER_SECOND");
+        static constexpr int BITS_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("BITS_PER_SECOND");
+        static constexpr int KILO_BITS_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("KILO_BITS_PER_SECOND");
+        static constexpr int MEGA_BITS_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("MEGA_BITS_PER_SECOND");
+        static constexpr int GIGA_BITS_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("GIGA_BITS_PER_SECOND");
+        static constexpr int TERA_BITS_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("TERA_BITS_PER_SECOND");
+        static constexpr int COUNT_PER_SECOND_HASH = HashingUtils::CompileTimeHashString("COUNT_PER_SECOND");
 
 
         Unit GetUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Unit::NONE;
-          }
-          else if (hashCode == SECONDS_HASH)
-          {
-            return Unit::SECONDS;
-          }
-          else if (hashCode == MICRO_SECONDS_HASH)
-          {
-            return Unit::MICRO_SECONDS;
-          }
-          else if (hashCode == MILLI_SECONDS_HASH)
-          {
-            return Unit::MILLI_SECONDS;
-          }
-          else if (hashCode == BYTES_HASH)
-          {
-            return Unit::BYTES;
-          }
-          else if (hashCode == KILO_BYTES_HASH)
-          {
-            return Unit::KILO_BYTES;
-          }
-          else if (hashCode == MEGA_BYTES_HASH)
-          {
-            return Unit::MEGA_BYTES;
-          }
-          else if (hashCode == GIGA_BYTES_HASH)
-          {
-            return Unit::GIGA_BYTES;
-          }
-          else if (hashCode == TERA_BYTES_HASH)
-          {
-            return Unit::TERA_BYTES;
-          }
-          else if (hashCode == BITS_HASH)
-          {
-            return Unit::BITS;
-          }
-          else if (hashCode == KILO_BITS_HASH)
-          {
-            return Unit::KILO_BITS;
-          }
-          else if (hashCode == MEGA_BITS_HASH)
-          {
-            return Unit::MEGA_BITS;
-          }
-          else if (hashCode == GIGA_BITS_HASH)
-          {
-            return Unit::GIGA_BITS;
-          }
-          else if (hashCode == TERA_BITS_HASH)
-          {
-            return Unit::TERA_BITS;
-          }
-          else if (hashCode == PERCENT_HASH)
-          {
-            return Unit::PERCENT;
-          }
-          else if (hashCode == COUNT_HASH)
-          {
-            return Unit::COUNT;
-          }
-          else if (hashCode == BYTES_PER_SECOND_HASH)
-          {
-            return Unit::BYTES_PER_SECOND;
-          }
-          else if (hashCode == KILO_BYTES_PER_SECOND_HASH)
-          {
-            return Unit::KILO_BYTES_PER_SECOND;
-          }
-          else if (hashCode == MEGA_BYTES_PER_SECOND_HASH)
-          {
-            return Unit::MEGA_BYTES_PER_SECOND;
-          }
-          else if (hashCode == GIGA_BYTES_PER_SECOND_HASH)
-          {
-            return Unit::GIGA_BYTES_PER_SECOND;
-          }
-          else if (hashCode == TERA_BYTES_PER_SECOND_HASH)
-          {
-            return Unit::TERA_BYTES_PER_SECOND;
-          }
-          else if (hashCode == BITS_PER_SECOND_HASH)
-          {
-            return Unit::BITS_PER_SECOND;
-          }
-          else if (hashCode == KILO_BITS_PER_SECOND_HASH)
-          {
-            return Unit::KILO_BITS_PER_SECOND;
-          }
-          else if (hashCode == MEGA_BITS_PER_SECOND_HASH)
-          {
-            return Unit::MEGA_BITS_PER_SECOND;
-          }
-          else if (hashCode == GIGA_BITS_PER_SECOND_HASH)
-          {
-            return Unit::GIGA_BITS_PER_SECOND;
-          }
-          else if (hashCode == TERA_BITS_PER_SECOND_HASH)
-          {
-            return Unit::TERA_BITS_PER_SECOND;
-          }
-          else if (hashCode == COUNT_PER_SECOND_HASH)
-          {
-            return Unit::COUNT_PER_SECOND;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return Unit::NONE;
+            }
+            break;
+          case SECONDS_HASH:
+            if (name == "SECONDS")
+            {
+              return Unit::SECONDS;
+            }
+            break;
+          case MICRO_SECONDS_HASH:
+            if (name == "MICRO_SECONDS")
+            {
+              return Unit::MICRO_SECONDS;
+            }
+            break;
+          case MILLI_SECONDS_HASH:
+            if (name == "MILLI_SECONDS")
+            {
+              return Unit::MILLI_SECONDS;
+            }
+            break;
+          case BYTES_HASH:
+            if (name == "BYTES")
+            {
+              return Unit::BYTES;
+            }
+            break;
+          case KILO_BYTES_HASH:
+            if (name == "KILO_BYTES")
+            {
+              return Unit::KILO_BYTES;
+            }
+            break;
+          case MEGA_BYTES_HASH:
+            if (name == "MEGA_BYTES")
+            {
+              return Unit::MEGA_BYTES;
+            }
+            break;
+          case GIGA_BYTES_HASH:
+            if (name == "GIGA_BYTES")
+            {
+              return Unit::GIGA_BYTES;
+            }
+            break;
+          case TERA_BYTES_HASH:
+            if (name == "TERA_BYTES")
+            {
+              return Unit::TERA_BYTES;
+            }
+            break;
+          case BITS_HASH:
+            if (name == "BITS")
+            {
+              return Unit::BITS;
+            }
+            break;
+          case KILO_BITS_HASH:
+            if (name == "KILO_BITS")
+            {
+              return Unit::KILO_BITS;
+            }
+            break;
+          case MEGA_BITS_HASH:
+            if (name == "MEGA_BITS")
+            {
+              return Unit::MEGA_BITS;
+            }
+            break;
+          case GIGA_BITS_HASH:
+            if (name == "GIGA_BITS")
+            {
+              return Unit::GIGA_BITS;
+            }
+            break;
+          case TERA_BITS_HASH:
+            if (name == "TERA_BITS")
+            {
+              return Unit::TERA_BITS;
+            }
+            break;
+          case PERCENT_HASH:
+            if (name == "PERCENT")
+            {
+              return Unit::PERCENT;
+            }
+            break;
+          case COUNT_HASH:
+            if (name == "COUNT")
+            {
+              return Unit::COUNT;
+            }
+            break;
+          case BYTES_PER_SECOND_HASH:
+            if (name == "BYTES_PER_SECOND")
+            {
+              return Unit::BYTES_PER_SECOND;
+            }
+            break;
+          case KILO_BYTES_PER_SECOND_HASH:
+            if (name == "KILO_BYTES_PER_SECOND")
+            {
+              return Unit::KILO_BYTES_PER_SECOND;
+            }
+            break;
+          case MEGA_BYTES_PER_SECOND_HASH:
+            if (name == "MEGA_BYTES_PER_SECOND")
+            {
+              return Unit::MEGA_BYTES_PER_SECOND;
+            }
+            break;
+          case GIGA_BYTES_PER_SECOND_HASH:
+            if (name == "GIGA_BYTES_PER_SECOND")
+            {
+              return Unit::GIGA_BYTES_PER_SECOND;
+            }
+            break;
+          case TERA_BYTES_PER_SECOND_HASH:
+            if (name == "TERA_BYTES_PER_SECOND")
+            {
+              return Unit::TERA_BYTES_PER_SECOND;
+            }
+            break;
+          case BITS_PER_SECOND_HASH:
+            if (name == "BITS_PER_SECOND")
+            {
+              return Unit::BITS_PER_SECOND;
+            }
+            break;
+          case KILO_BITS_PER_SECOND_HASH:
+            if (name == "KILO_BITS_PER_SECOND")
+            {
+              return Unit::KILO_BITS_PER_SECOND;
+            }
+            break;
+          case MEGA_BITS_PER_SECOND_HASH:
+            if (name == "MEGA_BITS_PER_SECOND")
+            {
+              return Unit::MEGA_BITS_PER_SECOND;
+            }
+            break;
+          case GIGA_BITS_PER_SECOND_HASH:
+            if (name == "GIGA_BITS_PER_SECOND")
+            {
+              return Unit::GIGA_BITS_PER_SECOND;
+            }
+            break;
+          case TERA_BITS_PER_SECOND_HASH:
+            if (name == "TERA_BITS_PER_SECOND")
+            {
+              return Unit::TERA_BITS_PER_SECOND;
+            }
+            break;
+          case COUNT_PER_SECOND_HASH:
+            if (name == "COUNT_PER_SECOND")
+            {
+              return Unit::COUNT_PER_SECOND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -180,7 +240,7 @@ namespace Aws
           return Unit::NOT_SET;
         }
 
-        Aws::String GetNameForUnit(Unit enumValue)
+        const char* GetNameForUnit(Unit enumValue)
         {
           switch(enumValue)
           {
@@ -242,7 +302,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -28,10 +28,10 @@ namespace ElasticTranscoder
 namespace ElasticTranscoderErrorMapper
 {
 
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int INCOMPATIBLE_VERSION_HASH = HashingUtils::HashString("IncompatibleVersionException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int INTERNAL_SERVICE_HASH = HashingUtils::HashString("InternalServiceException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int INCOMPATIBLE_VERSION_HASH = HashingUtils::CompileTimeHashString("IncompatibleVersionException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int INTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -34,7 +34,8 @@ namespace BehaviorOnMXFailureMapper
 {
 AWS_SES_API BehaviorOnMXFailure GetBehaviorOnMXFailureForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForBehaviorOnMXFailure(BehaviorOnMXFailure value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForBehaviorOnMXFailure(BehaviorOnMXFailure value);
 } // namespace BehaviorOnMXFailureMapper
 } // namespace Model
 } // namespace SES
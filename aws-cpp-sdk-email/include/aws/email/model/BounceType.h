@@ -38,7 +38,8 @@ namespace BounceTypeMapper
 {
 AWS_SES_API BounceType GetBounceTypeForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForBounceType(BounceType value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForBounceType(BounceType value);
 } // namespace BounceTypeMapper
 } // namespace Model
 } // namespace SES
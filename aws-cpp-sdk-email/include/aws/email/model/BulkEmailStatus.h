@@ -46,7 +46,8 @@ namespace BulkEmailStatusMapper
 {
 AWS_SES_API BulkEmailStatus GetBulkEmailStatusForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForBulkEmailStatus(BulkEmailStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForBulkEmailStatus(BulkEmailStatus value);
 } // namespace BulkEmailStatusMapper
 } // namespace Model
 } // namespace SES
@@ -35,7 +35,8 @@ namespace ConfigurationSetAttributeMapper
 {
 AWS_SES_API ConfigurationSetAttribute GetConfigurationSetAttributeForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForConfigurationSetAttribute(ConfigurationSetAttribute value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForConfigurationSetAttribute(ConfigurationSetAttribute value);
 } // namespace ConfigurationSetAttributeMapper
 } // namespace Model
 } // namespace SES
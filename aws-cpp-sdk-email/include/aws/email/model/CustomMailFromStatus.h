@@ -36,7 +36,8 @@ namespace CustomMailFromStatusMapper
 {
 AWS_SES_API CustomMailFromStatus GetCustomMailFromStatusForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForCustomMailFromStatus(CustomMailFromStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForCustomMailFromStatus(CustomMailFromStatus value);
 } // namespace CustomMailFromStatusMapper
 } // namespace Model
 } // namespace SES
@@ -35,7 +35,8 @@ namespace DimensionValueSourceMapper
 {
 AWS_SES_API DimensionValueSource GetDimensionValueSourceForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForDimensionValueSource(DimensionValueSource value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForDimensionValueSource(DimensionValueSource value);
 } // namespace DimensionValueSourceMapper
 } // namespace Model
 } // namespace SES
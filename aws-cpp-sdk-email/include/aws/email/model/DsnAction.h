@@ -37,7 +37,8 @@ namespace DsnActionMapper
 {
 AWS_SES_API DsnAction GetDsnActionForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForDsnAction(DsnAction value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForDsnAction(DsnAction value);
 } // namespace DsnActionMapper
 } // namespace Model
 } // namespace SES
@@ -40,7 +40,8 @@ namespace EventTypeMapper
 {
 AWS_SES_API EventType GetEventTypeForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForEventType(EventType value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForEventType(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace SES
@@ -34,7 +34,8 @@ namespace IdentityTypeMapper
 {
 AWS_SES_API IdentityType GetIdentityTypeForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForIdentityType(IdentityType value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForIdentityType(IdentityType value);
 } // namespace IdentityTypeMapper
 } // namespace Model
 } // namespace SES
@@ -34,7 +34,8 @@ namespace InvocationTypeMapper
 {
 AWS_SES_API InvocationType GetInvocationTypeForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForInvocationType(InvocationType value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForInvocationType(InvocationType value);
 } // namespace InvocationTypeMapper
 } // namespace Model
 } // namespace SES
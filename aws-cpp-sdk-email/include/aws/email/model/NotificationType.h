@@ -35,7 +35,8 @@ namespace NotificationTypeMapper
 {
 AWS_SES_API NotificationType GetNotificationTypeForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForNotificationType(NotificationType value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForNotificationType(NotificationType value);
 } // namespace NotificationTypeMapper
 } // namespace Model
 } // namespace SES
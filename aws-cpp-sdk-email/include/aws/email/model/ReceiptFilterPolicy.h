@@ -34,7 +34,8 @@ namespace ReceiptFilterPolicyMapper
 {
 AWS_SES_API ReceiptFilterPolicy GetReceiptFilterPolicyForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForReceiptFilterPolicy(ReceiptFilterPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForReceiptFilterPolicy(ReceiptFilterPolicy value);
 } // namespace ReceiptFilterPolicyMapper
 } // namespace Model
 } // namespace SES
@@ -34,7 +34,8 @@ namespace SNSActionEncodingMapper
 {
 AWS_SES_API SNSActionEncoding GetSNSActionEncodingForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForSNSActionEncoding(SNSActionEncoding value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForSNSActionEncoding(SNSActionEncoding value);
 } // namespace SNSActionEncodingMapper
 } // namespace Model
 } // namespace SES
@@ -33,7 +33,8 @@ namespace StopScopeMapper
 {
 AWS_SES_API StopScope GetStopScopeForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForStopScope(StopScope value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForStopScope(StopScope value);
 } // namespace StopScopeMapper
 } // namespace Model
 } // namespace SES
@@ -34,7 +34,8 @@ namespace TlsPolicyMapper
 {
 AWS_SES_API TlsPolicy GetTlsPolicyForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForTlsPolicy(TlsPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForTlsPolicy(TlsPolicy value);
 } // namespace TlsPolicyMapper
 } // namespace Model
 } // namespace SES
@@ -37,7 +37,8 @@ namespace VerificationStatusMapper
 {
 AWS_SES_API VerificationStatus GetVerificationStatusForName(const Aws::String& name);
 
-AWS_SES_API Aws::String GetNameForVerificationStatus(VerificationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SES_API const char* GetNameForVerificationStatus(VerificationStatus value);
 } // namespace VerificationStatusMapper
 } // namespace Model
 } // namespace SES
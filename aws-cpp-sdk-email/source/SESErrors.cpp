@@ -28,39 +28,39 @@ namespace SES
 namespace SESErrorMapper
 {
 
-static const int ALREADY_EXISTS_HASH = HashingUtils::HashString("AlreadyExists");
-static const int CUSTOM_VERIFICATION_EMAIL_INVALID_CONTENT_HASH = HashingUtils::HashString("CustomVerificationEmailInvalidContent");
-static const int INVALID_TEMPLATE_HASH = HashingUtils::HashString("InvalidTemplate");
-static const int INVALID_RENDERING_PARAMETER_HASH = HashingUtils::HashString("InvalidRenderingParameter");
-static const int FROM_EMAIL_ADDRESS_NOT_VERIFIED_HASH = HashingUtils::HashString("FromEmailAddressNotVerified");
-static const int RULE_SET_DOES_NOT_EXIST_HASH = HashingUtils::HashString("RuleSetDoesNotExist");
-static const int INVALID_SNS_TOPIC_HASH = HashingUtils::HashString("InvalidSnsTopic");
-static const int MESSAGE_REJECTED_HASH = HashingUtils::HashString("MessageRejected");
-static const int MAIL_FROM_DOMAIN_NOT_VERIFIED_HASH = HashingUtils::HashString("MailFromDomainNotVerifiedException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceeded");
-static const int CUSTOM_VERIFICATION_EMAIL_TEMPLATE_ALREADY_EXISTS_HASH = HashingUtils::HashString("CustomVerificationEmailTemplateAlreadyExists");
-static const int RULE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("RuleDoesNotExist");
-static const int INVALID_FIREHOSE_DESTINATION_HASH = HashingUtils::HashString("InvalidFirehoseDestination");
-static const int CANNOT_DELETE_HASH = HashingUtils::HashString("CannotDelete");
-static const int ACCOUNT_SENDING_PAUSED_HASH = HashingUtils::HashString("AccountSendingPausedException");
-static const int INVALID_CLOUD_WATCH_DESTINATION_HASH = HashingUtils::HashString("InvalidCloudWatchDestination");
-static const int PRODUCTION_ACCESS_NOT_GRANTED_HASH = HashingUtils::HashString("ProductionAccessNotGranted");
-static const int CONFIGURATION_SET_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ConfigurationSetDoesNotExist");
-static const int INVALID_TRACKING_OPTIONS_HASH = HashingUtils::HashString("InvalidTrackingOptions");
-static const int CONFIGURATION_SET_SENDING_PAUSED_HASH = HashingUtils::HashString("ConfigurationSetSendingPausedException");
-static const int INVALID_S3_CONFIGURATION_HASH = HashingUtils::HashString("InvalidS3Configuration");
-static const int INVALID_LAMBDA_FUNCTION_HASH = HashingUtils::HashString("InvalidLambdaFunction");
-static const int EVENT_DESTINATION_DOES_NOT_EXIST_HASH = HashingUtils::HashString("EventDestinationDoesNotExist");
-static const int INVALID_CONFIGURATION_SET_HASH = HashingUtils::HashString("InvalidConfigurationSet");
-static const int MISSING_RENDERING_ATTRIBUTE_HASH = HashingUtils::HashString("MissingRenderingAttribute");
-static const int TRACKING_OPTIONS_ALREADY_EXISTS_HASH = HashingUtils::HashString("TrackingOptionsAlreadyExistsException");
-static const int INVALID_S_N_S_DESTINATION_HASH = HashingUtils::HashString("InvalidSNSDestination");
-static const int CUSTOM_VERIFICATION_EMAIL_TEMPLATE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("CustomVerificationEmailTemplateDoesNotExist");
-static const int INVALID_POLICY_HASH = HashingUtils::HashString("InvalidPolicy");
-static const int TEMPLATE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("TemplateDoesNotExist");
-static const int TRACKING_OPTIONS_DOES_NOT_EXIST_HASH = HashingUtils::HashString("TrackingOptionsDoesNotExistException");
-static const int CONFIGURATION_SET_ALREADY_EXISTS_HASH = HashingUtils::HashString("ConfigurationSetAlreadyExists");
-static const int EVENT_DESTINATION_ALREADY_EXISTS_HASH = HashingUtils::HashString("EventDestinationAlreadyExists");
+static constexpr int ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("AlreadyExists");
+static constexpr int CUSTOM_VERIFICATION_EMAIL_INVALID_CONTENT_HASH = HashingUtils::CompileTimeHashString("CustomVerificationEmailInvalidContent");
+static constexpr int INVALID_TEMPLATE_HASH = HashingUtils::CompileTimeHashString("InvalidTemplate");
+static constexpr int INVALID_RENDERING_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidRenderingParameter");
+static constexpr int FROM_EMAIL_ADDRESS_NOT_VERIFIED_HASH = HashingUtils::CompileTimeHashString("FromEmailAddressNotVerified");
+static constexpr int RULE_SET_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("RuleSetDoesNotExist");
+static constexpr int INVALID_SNS_TOPIC_HASH = HashingUtils::CompileTimeHashString("InvalidSnsTopic");
+static constexpr int MESSAGE_REJECTED_HASH = HashingUtils::CompileTimeHashString("MessageRejected");
+static constexpr int MAIL_FROM_DOMAIN_NOT_VERIFIED_HASH = HashingUtils::CompileTimeHashString("MailFromDomainNotVerifiedException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceeded");
+static constexpr int CUSTOM_VERIFICATION_EMAIL_TEMPLATE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("CustomVerificationEmailTemplateAlreadyExists");
+static constexpr int RULE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("RuleDoesNotExist");
+static constexpr int INVALID_FIREHOSE_DESTINATION_HASH = HashingUtils::CompileTimeHashString("InvalidFirehoseDestination");
+static constexpr int CANNOT_DELETE_HASH = HashingUtils::CompileTimeHashString("CannotDelete");
+static constexpr int ACCOUNT_SENDING_PAUSED_HASH = HashingUtils::CompileTimeHashString("AccountSendingPausedException");
+static constexpr int INVALID_CLOUD_WATCH_DESTINATION_HASH = HashingUtils::CompileTimeHashString("InvalidCloudWatchDestination");
+static constexpr int PRODUCTION_ACCESS_NOT_GRANTED_HASH = HashingUtils::CompileTimeHashString("ProductionAccessNotGranted");
+static constexpr int CONFIGURATION_SET_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ConfigurationSetDoesNotExist");
+static constexpr int INVALID_TRACKING_OPTIONS_HASH = HashingUtils::CompileTimeHashString("InvalidTrackingOptions");
+static constexpr int CONFIGURATION_SET_SENDING_PAUSED_HASH = HashingUtils::CompileTimeHashString("ConfigurationSetSendingPausedException");
+static constexpr int INVALID_S3_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("InvalidS3Configuration");
+static constexpr int INVALID_LAMBDA_FUNCTION_HASH = HashingUtils::CompileTimeHashString("InvalidLambdaFunction");
+static constexpr int EVENT_DESTINATION_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("EventDestinationDoesNotExist");
+static constexpr int INVALID_CONFIGURATION_SET_HASH = HashingUtils::CompileTimeHashString("InvalidConfigurationSet");
+static constexpr int MISSING_RENDERING_ATTRIBUTE_HASH = HashingUtils::CompileTimeHashString("MissingRenderingAttribute");
+static constexpr int TRACKING_OPTIONS_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("TrackingOptionsAlreadyExistsException");
+static constexpr int INVALID_S_N_S_DESTINATION_HASH = HashingUtils::CompileTimeHashString("InvalidSNSDestination");
+static constexpr int CUSTOM_VERIFICATION_EMAIL_TEMPLATE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("CustomVerificationEmailTemplateDoesNotExist");
+static constexpr int INVALID_POLICY_HASH = HashingUtils::CompileTimeHashString("InvalidPolicy");
+static constexpr int TEMPLATE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("TemplateDoesNotExist");
+static constexpr int TRACKING_OPTIONS_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("TrackingOptionsDoesNotExistException");
+static constexpr int CONFIGURATION_SET_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ConfigurationSetAlreadyExists");
+static constexpr int EVENT_DESTINATION_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("EventDestinationAlreadyExists");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace BehaviorOnMXFailureMapper
       {
 
-        static const int UseDefaultValue_HASH = HashingUtils::HashString("UseDefaultValue");
-        static const int RejectMessage_HASH = HashingUtils::HashString("RejectMessage");
+        static constexpr int UseDefaultValue_HASH = HashingUtils::CompileTimeHashString("UseDefaultValue");
+        static constexpr int RejectMessage_HASH = HashingUtils::CompileTimeHashString("RejectMessage");
 
 
         BehaviorOnMXFailure GetBehaviorOnMXFailureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UseDefaultValue_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BehaviorOnMXFailure::UseDefaultValue;
-          }
-          else if (hashCode == RejectMessage_HASH)
-          {
-            return BehaviorOnMXFailure::RejectMessage;
+          case UseDefaultValue_HASH:
+            if (name == "UseDefaultValue")
+            {
+              return BehaviorOnMXFailure::UseDefaultValue;
+            }
+            break;
+          case RejectMessage_HASH:
+            if (name == "RejectMessage")
+            {
+              return BehaviorOnMXFailure::RejectMessage;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BehaviorOnMXFailure::NOT_SET;
         }
 
-        Aws::String GetNameForBehaviorOnMXFailure(BehaviorOnMXFailure enumValue)
+        const char* GetNameForBehaviorOnMXFailure(BehaviorOnMXFailure enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace BounceTypeMapper
       {
 
-        static const int DoesNotExist_HASH = HashingUtils::HashString("DoesNotExist");
-        static const int MessageTooLarge_HASH = HashingUtils::HashString("MessageTooLarge");
-        static const int ExceededQuota_HASH = HashingUtils::HashString("ExceededQuota");
-        static const int ContentRejected_HASH = HashingUtils::HashString("ContentRejected");
-        static const int Undefined_HASH = HashingUtils::HashString("Undefined");
-        static const int TemporaryFailure_HASH = HashingUtils::HashString("TemporaryFailure");
+        static constexpr int DoesNotExist_HASH = HashingUtils::CompileTimeHashString("DoesNotExist");
+        static constexpr int MessageTooLarge_HASH = HashingUtils::CompileTimeHashString("MessageTooLarge");
+        static constexpr int ExceededQuota_HASH = HashingUtils::CompileTimeHashString("ExceededQuota");
+        static constexpr int ContentRejected_HASH = HashingUtils::CompileTimeHashString("ContentRejected");
+        static constexpr int Undefined_HASH = HashingUtils::CompileTimeHashString("Undefined");
+        static constexpr int TemporaryFailure_HASH = HashingUtils::CompileTimeHashString("TemporaryFailure");
 
 
         BounceType GetBounceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DoesNotExist_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BounceType::DoesNotExist;
-          }
-          else if (hashCode == MessageTooLarge_HASH)
-          {
-            return BounceType::MessageTooLarge;
-          }
-          else if (hashCode == ExceededQuota_HASH)
-          {
-            return BounceType::ExceededQuota;
-          }
-          else if (hashCode == ContentRejected_HASH)
-          {
-            return BounceType::ContentRejected;
-          }
-          else if (hashCode == Undefined_HASH)
-          {
-            return BounceType::Undefined;
-          }
-          else if (hashCode == TemporaryFailure_HASH)
-          {
-            return BounceType::TemporaryFailure;
+          case DoesNotExist_HASH:
+            if (name == "DoesNotExist")
+            {
+              return BounceType::DoesNotExist;
+            }
+            break;
+          case MessageTooLarge_HASH:
+            if (name == "MessageTooLarge")
+            {
+              return BounceType::MessageTooLarge;
+            }
+            break;
+          case ExceededQuota_HASH:
+            if (name == "ExceededQuota")
+            {
+              return BounceType::ExceededQuota;
+            }
+            break;
+          case ContentRejected_HASH:
+            if (name == "ContentRejected")
+            {
+              return BounceType::ContentRejected;
+            }
+            break;
+          case Undefined_HASH:
+            if (name == "Undefined")
+            {
+              return BounceType::Undefined;
+            }
+            break;
+          case TemporaryFailure_HASH:
+            if (name == "TemporaryFailure")
+            {
+              return BounceType::TemporaryFailure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return BounceType::NOT_SET;
         }
 
-        Aws::String GetNameForBounceType(BounceType enumValue)
+        const char* GetNameForBounceType(BounceType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
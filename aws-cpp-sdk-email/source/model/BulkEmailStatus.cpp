@@ -30,80 +30,114 @@ namespace Aws
       namespace BulkEmailStatusMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int MessageRejected_HASH = HashingUtils::HashString("MessageRejected");
-        static const int MailFromDomainNotVerified_HASH = HashingUtils::HashString("MailFromDomainNotVerified");
-        static const int ConfigurationSetDoesNotExist_HASH = HashingUtils::HashString("ConfigurationSetDoesNotExist");
-        static const int TemplateDoesNotExist_HASH = HashingUtils::HashString("TemplateDoesNotExist");
-        static const int AccountSuspended_HASH = HashingUtils::HashString("AccountSuspended");
-        static const int AccountThrottled_HASH = HashingUtils::HashString("AccountThrottled");
-        static const int AccountDailyQuotaExceeded_HASH = HashingUtils::HashString("AccountDailyQuotaExceeded");
-        static const int InvalidSendingPoolName_HASH = HashingUtils::HashString("InvalidSendingPoolName");
-        static const int AccountSendingPaused_HASH = HashingUtils::HashString("AccountSendingPaused");
-        static const int ConfigurationSetSendingPaused_HASH = HashingUtils::HashString("ConfigurationSetSendingPaused");
-        static const int InvalidParameterValue_HASH = HashingUtils::HashString("InvalidParameterValue");
-        static const int TransientFailure_HASH = HashingUtils::HashString("TransientFailure");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int MessageRejected_HASH = HashingUtils::CompileTimeHashString("MessageRejected");
+        static constexpr int MailFromDomainNotVerified_HASH = HashingUtils::CompileTimeHashString("MailFromDomainNotVerified");
+        static constexpr int ConfigurationSetDoesNotExist_HASH = HashingUtils::CompileTimeHashString("ConfigurationSetDoesNotExist");
+        static constexpr int TemplateDoesNotExist_HASH = HashingUtils::CompileTimeHashString("TemplateDoesNotExist");
+        static constexpr int AccountSuspended_HASH = HashingUtils::CompileTimeHashString("AccountSuspended");
+        static constexpr int AccountThrottled_HASH = HashingUtils::CompileTimeHashString("AccountThrottled");
+        static constexpr int AccountDailyQuotaExceeded_HASH = HashingUtils::CompileTimeHashString("AccountDailyQuotaExceeded");
+        static constexpr int InvalidSendingPoolName_HASH = HashingUtils::CompileTimeHashString("InvalidSendingPoolName");
+        static constexpr int AccountSendingPaused_HASH = HashingUtils::CompileTimeHashString("AccountSendingPaused");
+        static constexpr int ConfigurationSetSendingPaused_HASH = HashingUtils::CompileTimeHashString("ConfigurationSetSendingPaused");
+        static constexpr int InvalidParameterValue_HASH = HashingUtils::CompileTimeHashString("InvalidParameterValue");
+        static constexpr int TransientFailure_HASH = HashingUtils::CompileTimeHashString("TransientFailure");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         BulkEmailStatus GetBulkEmailStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BulkEmailStatus::Success;
-          }
-          else if (hashCode == MessageRejected_HASH)
-          {
-            return BulkEmailStatus::MessageRejected;
-          }
-          else if (hashCode == MailFromDomainNotVerified_HASH)
-          {
-            return BulkEmailStatus::MailFromDomainNotVerified;
-          }
-          else if (hashCode == ConfigurationSetDoesNotExist_HASH)
-          {
-            return BulkEmailStatus::ConfigurationSetDoesNotExist;
-          }
-          else if (hashCode == TemplateDoesNotExist_HASH)
-          {
-            return BulkEmailStatus::TemplateDoesNotExist;
-          }
-          else if (hashCode == AccountSuspended_HASH)
-          {
-            return BulkEmailStatus::AccountSuspended;
-          }
-          else if (hashCode == AccountThrottled_HASH)
-          {
-            return BulkEmailStatus::AccountThrottled;
-          }
-          else if (hashCode == AccountDailyQuotaExceeded_HASH)
-          {
-            return BulkEmailStatus::AccountDailyQuotaExceeded;
-          }
-          else if (hashCode == InvalidSendingPoolName_HASH)
-          {
-            return BulkEmailStatus::InvalidSendingPoolName;
-          }
-          else if (hashCode == AccountSendingPaused_HASH)
-          {
-            return BulkEmailStatus::AccountSendingPaused;
-          }
-          else if (hashCode == ConfigurationSetSendingPaused_HASH)
-          {
-            return BulkEmailStatus::ConfigurationSetSendingPaused;
-          }
-          else if (hashCode == InvalidParameterValue_HASH)
-          {
-            return BulkEmailStatus::InvalidParameterValue;
-          }
-          else if (hashCode == TransientFailure_HASH)
-          {
-            return BulkEmailStatus::TransientFailure;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return BulkEmailStatus::Failed;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return BulkEmailStatus::Success;
+            }
+            break;
+          case MessageRejected_HASH:
+            if (name == "MessageRejected")
+            {
+              return BulkEmailStatus::MessageRejected;
+            }
+            break;
+          case MailFromDomainNotVerified_HASH:
+            if (name == "MailFromDomainNotVerified")
+            {
+              return BulkEmailStatus::MailFromDomainNotVerified;
+            }
+            break;
+          case ConfigurationSetDoesNotExist_HASH:
+            if (name == "ConfigurationSetDoesNotExist")
+            {
+              return BulkEmailStatus::ConfigurationSetDoesNotExist;
+            }
+            break;
+          case TemplateDoesNotExist_HASH:
+            if (name == "TemplateDoesNotExist")
+            {
+              return BulkEmailStatus::TemplateDoesNotExist;
+            }
+            break;
+          case AccountSuspended_HASH:
+            if (name == "AccountSuspended")
+            {
+              return BulkEmailStatus::AccountSuspended;
+            }
+            break;
+          case AccountThrottled_HASH:
+            if (name == "AccountThrottled")
+            {
+              return BulkEmailStatus::AccountThrottled;
+            }
+            break;
+          case AccountDailyQuotaExceeded_HASH:
+            if (name == "AccountDailyQuotaExceeded")
+            {
+              return BulkEmailStatus::AccountDailyQuotaExceeded;
+            }
+            break;
+          case InvalidSendingPoolName_HASH:
+            if (name == "InvalidSendingPoolName")
+            {
+              return BulkEmailStatus::InvalidSendingPoolName;
+            }
+            break;
+          case AccountSendingPaused_HASH:
+            if (name == "AccountSendingPaused")
+            {
+              return BulkEmailStatus::AccountSendingPaused;
+            }
+            break;
+          case ConfigurationSetSendingPaused_HASH:
+            if (name == "ConfigurationSetSendingPaused")
+            {
+              return BulkEmailStatus::ConfigurationSetSendingPaused;
+            }
+            break;
+          case InvalidParameterValue_HASH:
+            if (name == "InvalidParameterValue")
+            {
+              return BulkEmailStatus::InvalidParameterValue;
+            }
+            break;
+          case TransientFailure_HASH:
+            if (name == "TransientFailure")
+            {
+              return BulkEmailStatus::TransientFailure;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return BulkEmailStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -115,7 +149,7 @@ namespace Aws
           return BulkEmailStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBulkEmailStatus(BulkEmailStatus enumValue)
+        const char* GetNameForBulkEmailStatus(BulkEmailStatus enumValue)
         {
           switch(enumValue)
           {
@@ -151,7 +185,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
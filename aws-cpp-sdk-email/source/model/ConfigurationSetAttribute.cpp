@@ -30,25 +30,37 @@ namespace Aws
       namespace ConfigurationSetAttributeMapper
       {
 
-        static const int eventDestinations_HASH = HashingUtils::HashString("eventDestinations");
-        static const int trackingOptions_HASH = HashingUtils::HashString("trackingOptions");
-        static const int reputationOptions_HASH = HashingUtils::HashString("reputationOptions");
+        static constexpr int eventDestinations_HASH = HashingUtils::CompileTimeHashString("eventDestinations");
+        static constexpr int trackingOptions_HASH = HashingUtils::CompileTimeHashString("trackingOptions");
+        static constexpr int reputationOptions_HASH = HashingUtils::CompileTimeHashString("reputationOptions");
 
 
         ConfigurationSetAttribute GetConfigurationSetAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == eventDestinations_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConfigurationSetAttribute::eventDestinations;
-          }
-          else if (hashCode == trackingOptions_HASH)
-          {
-            return ConfigurationSetAttribute::trackingOptions;
-          }
-          else if (hashCode == reputationOptions_HASH)
-          {
-            return ConfigurationSetAttribute::reputationOptions;
+          case eventDestinations_HASH:
+            if (name == "eventDestinations")
+            {
+              return ConfigurationSetAttribute::eventDestinations;
+            }
+            break;
+          case trackingOptions_HASH:
+            if (name == "trackingOptions")
+            {
+              return ConfigurationSetAttribute::trackingOptions;
+            }
+            break;
+          case reputationOptions_HASH:
+            if (name == "reputationOptions")
+            {
+              return ConfigurationSetAttribute::reputationOptions;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ConfigurationSetAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForConfigurationSetAttribute(ConfigurationSetAttribute enumValue)
+        const char* GetNameForConfigurationSetAttribute(ConfigurationSetAttribute enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
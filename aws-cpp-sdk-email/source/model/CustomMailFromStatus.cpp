@@ -30,30 +30,44 @@ namespace Aws
       namespace CustomMailFromStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int TemporaryFailure_HASH = HashingUtils::HashString("TemporaryFailure");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int TemporaryFailure_HASH = HashingUtils::CompileTimeHashString("TemporaryFailure");
 
 
         CustomMailFromStatus GetCustomMailFromStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CustomMailFromStatus::Pending;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return CustomMailFromStatus::Success;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return CustomMailFromStatus::Failed;
-          }
-          else if (hashCode == TemporaryFailure_HASH)
-          {
-            return CustomMailFromStatus::TemporaryFailure;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return CustomMailFromStatus::Pending;
+            }
+            break;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return CustomMailFromStatus::Success;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return CustomMailFromStatus::Failed;
+            }
+            break;
+          case TemporaryFailure_HASH:
+            if (name == "TemporaryFailure")
+            {
+              return CustomMailFromStatus::TemporaryFailure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return CustomMailFromStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCustomMailFromStatus(CustomMailFromStatus enumValue)
+        const char* GetNameForCustomMailFromStatus(CustomMailFromStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace DimensionValueSourceMapper
       {
 
-        static const int messageTag_HASH = HashingUtils::HashString("messageTag");
-        static const int emailHeader_HASH = HashingUtils::HashString("emailHeader");
-        static const int linkTag_HASH = HashingUtils::HashString("linkTag");
+        static constexpr int messageTag_HASH = HashingUtils::CompileTimeHashString("messageTag");
+        static constexpr int emailHeader_HASH = HashingUtils::CompileTimeHashString("emailHeader");
+        static constexpr int linkTag_HASH = HashingUtils::CompileTimeHashString("linkTag");
 
 
         DimensionValueSource GetDimensionValueSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == messageTag_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DimensionValueSource::messageTag;
-          }
-          else if (hashCode == emailHeader_HASH)
-          {
-            return DimensionValueSource::emailHeader;
-          }
-          else if (hashCode == linkTag_HASH)
-          {
-            return DimensionValueSource::linkTag;
+          case messageTag_HASH:
+            if (name == "messageTag")
+            {
+              return DimensionValueSource::messageTag;
+            }
+            break;
+          case emailHeader_HASH:
+            if (name == "emailHeader")
+            {
+              return DimensionValueSource::emailHeader;
+            }
+            break;
+          case linkTag_HASH:
+            if (name == "linkTag")
+            {
+              return DimensionValueSource::linkTag;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DimensionValueSource::NOT_SET;
         }
 
-        Aws::String GetNameForDimensionValueSource(DimensionValueSource enumValue)
+        const char* GetNameForDimensionValueSource(DimensionValueSource enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace DsnActionMapper
       {
 
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int delayed_HASH = HashingUtils::HashString("delayed");
-        static const int delivered_HASH = HashingUtils::HashString("delivered");
-        static const int relayed_HASH = HashingUtils::HashString("relayed");
-        static const int expanded_HASH = HashingUtils::HashString("expanded");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int delayed_HASH = HashingUtils::CompileTimeHashString("delayed");
+        static constexpr int delivered_HASH = HashingUtils::CompileTimeHashString("delivered");
+        static constexpr int relayed_HASH = HashingUtils::CompileTimeHashString("relayed");
+        static constexpr int expanded_HASH = HashingUtils::CompileTimeHashString("expanded");
 
 
         DsnAction GetDsnActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == failed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DsnAction::failed;
-          }
-          else if (hashCode == delayed_HASH)
-          {
-            return DsnAction::delayed;
-          }
-          else if (hashCode == delivered_HASH)
-          {
-            return DsnAction::delivered;
-          }
-          else if (hashCode == relayed_HASH)
-          {
-            return DsnAction::relayed;
-          }
-          else if (hashCode == expanded_HASH)
-          {
-            return DsnAction::expanded;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return DsnAction::failed;
+            }
+            break;
+          case delayed_HASH:
+            if (name == "delayed")
+            {
+              return DsnAction::delayed;
+            }
+            break;
+          case delivered_HASH:
+            if (name == "delivered")
+            {
+              return DsnAction::delivered;
+            }
+            break;
+          case relayed_HASH:
+            if (name == "relayed")
+            {
+              return DsnAction::relayed;
+            }
+            break;
+          case expanded_HASH:
+            if (name == "expanded")
+            {
+              return DsnAction::expanded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return DsnAction::NOT_SET;
         }
 
-        Aws::String GetNameForDsnAction(DsnAction enumValue)
+        const char* GetNameForDsnAction(DsnAction enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int send_HASH = HashingUtils::HashString("send");
-        static const int reject_HASH = HashingUtils::HashString("reject");
-        static const int bounce_HASH = HashingUtils::HashString("bounce");
-        static const int complaint_HASH = HashingUtils::HashString("complaint");
-        static const int delivery_HASH = HashingUtils::HashString("delivery");
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int click_HASH = HashingUtils::HashString("click");
-        static const int renderingFailure_HASH = HashingUtils::HashString("renderingFailure");
+        static constexpr int send_HASH = HashingUtils::CompileTimeHashString("send");
+        static constexpr int reject_HASH = HashingUtils::CompileTimeHashString("reject");
+        static constexpr int bounce_HASH = HashingUtils::CompileTimeHashString("bounce");
+        static constexpr int complaint_HASH = HashingUtils::CompileTimeHashString("complaint");
+        static constexpr int delivery_HASH = HashingUtils::CompileTimeHashString("delivery");
+        static constexpr int open_HASH = HashingUtils::CompileTimeHashString("open");
+        static constexpr int click_HASH = HashingUtils::CompileTimeHashString("click");
+        static constexpr int renderingFailure_HASH = HashingUtils::CompileTimeHashString("renderingFailure");
 
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == send_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventType::send;
-          }
-          else if (hashCode == reject_HASH)
-          {
-            return EventType::reject;
-          }
-          else if (hashCode == bounce_HASH)
-          {
-            return EventType::bounce;
-          }
-          else if (hashCode == complaint_HASH)
-          {
-            return EventType::complaint;
-          }
-          else if (hashCode == delivery_HASH)
-          {
-            return EventType::delivery;
-          }
-          else if (hashCode == open_HASH)
-          {
-            return EventType::open;
-          }
-          else if (hashCode == click_HASH)
-          {
-            return EventType::click;
-          }
-          else if (hashCode == renderingFailure_HASH)
-          {
-            return EventType::renderingFailure;
+          case send_HASH:
+            if (name == "send")
+            {
+              return EventType::send;
+            }
+            break;
+          case reject_HASH:
+            if (name == "reject")
+            {
+              return EventType::reject;
+            }
+            break;
+          case bounce_HASH:
+            if (name == "bounce")
+            {
+              return EventType::bounce;
+            }
+            break;
+          case complaint_HASH:
+            if (name == "complaint")
+            {
+              return EventType::complaint;
+            }
+            break;
+          case delivery_HASH:
+            if (name == "delivery")
+            {
+              return EventType::delivery;
+            }
+            break;
+          case open_HASH:
+            if (name == "open")
+            {
+              return EventType::open;
+            }
+            break;
+          case click_HASH:
+            if (name == "click")
+            {
+              return EventType::click;
+            }
+            break;
+          case renderingFailure_HASH:
+            if (name == "renderingFailure")
+            {
+              return EventType::renderingFailure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventType(EventType enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
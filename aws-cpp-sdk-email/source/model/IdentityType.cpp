@@ -30,20 +30,30 @@ namespace Aws
       namespace IdentityTypeMapper
       {
 
-        static const int EmailAddress_HASH = HashingUtils::HashString("EmailAddress");
-        static const int Domain_HASH = HashingUtils::HashString("Domain");
+        static constexpr int EmailAddress_HASH = HashingUtils::CompileTimeHashString("EmailAddress");
+        static constexpr int Domain_HASH = HashingUtils::CompileTimeHashString("Domain");
 
 
         IdentityType GetIdentityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EmailAddress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IdentityType::EmailAddress;
-          }
-          else if (hashCode == Domain_HASH)
-          {
-            return IdentityType::Domain;
+          case EmailAddress_HASH:
+            if (name == "EmailAddress")
+            {
+              return IdentityType::EmailAddress;
+            }
+            break;
+          case Domain_HASH:
+            if (name == "Domain")
+            {
+              return IdentityType::Domain;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return IdentityType::NOT_SET;
         }
 
-        Aws::String GetNameForIdentityType(IdentityType enumValue)
+        const char* GetNameForIdentityType(IdentityType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
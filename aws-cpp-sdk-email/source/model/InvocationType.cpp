@@ -30,20 +30,30 @@ namespace Aws
       namespace InvocationTypeMapper
       {
 
-        static const int Event_HASH = HashingUtils::HashString("Event");
-        static const int RequestResponse_HASH = HashingUtils::HashString("RequestResponse");
+        static constexpr int Event_HASH = HashingUtils::CompileTimeHashString("Event");
+        static constexpr int RequestResponse_HASH = HashingUtils::CompileTimeHashString("RequestResponse");
 
 
         InvocationType GetInvocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Event_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InvocationType::Event;
-          }
-          else if (hashCode == RequestResponse_HASH)
-          {
-            return InvocationType::RequestResponse;
+          case Event_HASH:
+            if (name == "Event")
+            {
+              return InvocationType::Event;
+            }
+            break;
+          case RequestResponse_HASH:
+            if (name == "RequestResponse")
+            {
+              return InvocationType::RequestResponse;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InvocationType::NOT_SET;
         }
 
-        Aws::String GetNameForInvocationType(InvocationType enumValue)
+        const char* GetNameForInvocationType(InvocationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace NotificationTypeMapper
       {
 
-        static const int Bounce_HASH = HashingUtils::HashString("Bounce");
-        static const int Complaint_HASH = HashingUtils::HashString("Complaint");
-        static const int Delivery_HASH = HashingUtils::HashString("Delivery");
+        static constexpr int Bounce_HASH = HashingUtils::CompileTimeHashString("Bounce");
+        static constexpr int Complaint_HASH = HashingUtils::CompileTimeHashString("Complaint");
+        static constexpr int Delivery_HASH = HashingUtils::CompileTimeHashString("Delivery");
 
 
         NotificationType GetNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Bounce_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotificationType::Bounce;
-          }
-          else if (hashCode == Complaint_HASH)
-          {
-            return NotificationType::Complaint;
-          }
-          else if (hashCode == Delivery_HASH)
-          {
-            return NotificationType::Delivery;
+          case Bounce_HASH:
+            if (name == "Bounce")
+            {
+              return NotificationType::Bounce;
+            }
+            break;
+          case Complaint_HASH:
+            if (name == "Complaint")
+            {
+              return NotificationType::Complaint;
+            }
+            break;
+          case Delivery_HASH:
+            if (name == "Delivery")
+            {
+              return NotificationType::Delivery;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return NotificationType::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationType(NotificationType enumValue)
+        const char* GetNameForNotificationType(NotificationType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
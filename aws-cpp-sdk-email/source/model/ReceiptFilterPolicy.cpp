@@ -30,20 +30,30 @@ namespace Aws
       namespace ReceiptFilterPolicyMapper
       {
 
-        static const int Block_HASH = HashingUtils::HashString("Block");
-        static const int Allow_HASH = HashingUtils::HashString("Allow");
+        static constexpr int Block_HASH = HashingUtils::CompileTimeHashString("Block");
+        static constexpr int Allow_HASH = HashingUtils::CompileTimeHashString("Allow");
 
 
         ReceiptFilterPolicy GetReceiptFilterPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Block_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReceiptFilterPolicy::Block;
-          }
-          else if (hashCode == Allow_HASH)
-          {
-            return ReceiptFilterPolicy::Allow;
+          case Block_HASH:
+            if (name == "Block")
+            {
+              return ReceiptFilterPolicy::Block;
+            }
+            break;
+          case Allow_HASH:
+            if (name == "Allow")
+            {
+              return ReceiptFilterPolicy::Allow;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReceiptFilterPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForReceiptFilterPolicy(ReceiptFilterPolicy enumValue)
+        const char* GetNameForReceiptFilterPolicy(ReceiptFilterPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
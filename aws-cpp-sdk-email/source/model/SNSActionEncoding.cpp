@@ -30,20 +30,30 @@ namespace Aws
       namespace SNSActionEncodingMapper
       {
 
-        static const int UTF_8_HASH = HashingUtils::HashString("UTF-8");
-        static const int Base64_HASH = HashingUtils::HashString("Base64");
+        static constexpr int UTF_8_HASH = HashingUtils::CompileTimeHashString("UTF-8");
+        static constexpr int Base64_HASH = HashingUtils::CompileTimeHashString("Base64");
 
 
         SNSActionEncoding GetSNSActionEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UTF_8_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SNSActionEncoding::UTF_8;
-          }
-          else if (hashCode == Base64_HASH)
-          {
-            return SNSActionEncoding::Base64;
+          case UTF_8_HASH:
+            if (name == "UTF-8")
+            {
+              return SNSActionEncoding::UTF_8;
+            }
+            break;
+          case Base64_HASH:
+            if (name == "Base64")
+            {
+              return SNSActionEncoding::Base64;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SNSActionEncoding::NOT_SET;
         }
 
-        Aws::String GetNameForSNSActionEncoding(SNSActionEncoding enumValue)
+        const char* GetNameForSNSActionEncoding(SNSActionEncoding enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace StopScopeMapper
       {
 
-        static const int RuleSet_HASH = HashingUtils::HashString("RuleSet");
+        static constexpr int RuleSet_HASH = HashingUtils::CompileTimeHashString("RuleSet");
 
 
         StopScope GetStopScopeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RuleSet_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StopScope::RuleSet;
+          case RuleSet_HASH:
+            if (name == "RuleSet")
+            {
+              return StopScope::RuleSet;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return StopScope::NOT_SET;
         }
 
-        Aws::String GetNameForStopScope(StopScope enumValue)
+        const char* GetNameForStopScope(StopScope enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
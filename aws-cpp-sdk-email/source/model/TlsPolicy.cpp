@@ -30,20 +30,30 @@ namespace Aws
       namespace TlsPolicyMapper
       {
 
-        static const int Require_HASH = HashingUtils::HashString("Require");
-        static const int Optional_HASH = HashingUtils::HashString("Optional");
+        static constexpr int Require_HASH = HashingUtils::CompileTimeHashString("Require");
+        static constexpr int Optional_HASH = HashingUtils::CompileTimeHashString("Optional");
 
 
         TlsPolicy GetTlsPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Require_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TlsPolicy::Require;
-          }
-          else if (hashCode == Optional_HASH)
-          {
-            return TlsPolicy::Optional;
+          case Require_HASH:
+            if (name == "Require")
+            {
+              return TlsPolicy::Require;
+            }
+            break;
+          case Optional_HASH:
+            if (name == "Optional")
+            {
+              return TlsPolicy::Optional;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TlsPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForTlsPolicy(TlsPolicy enumValue)
+        const char* GetNameForTlsPolicy(TlsPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
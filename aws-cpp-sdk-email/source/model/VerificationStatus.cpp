@@ -30,35 +30,51 @@ namespace Aws
       namespace VerificationStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int TemporaryFailure_HASH = HashingUtils::HashString("TemporaryFailure");
-        static const int NotStarted_HASH = HashingUtils::HashString("NotStarted");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int TemporaryFailure_HASH = HashingUtils::CompileTimeHashString("TemporaryFailure");
+        static constexpr int NotStarted_HASH = HashingUtils::CompileTimeHashString("NotStarted");
 
 
         VerificationStatus GetVerificationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VerificationStatus::Pending;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return VerificationStatus::Success;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return VerificationStatus::Failed;
-          }
-          else if (hashCode == TemporaryFailure_HASH)
-          {
-            return VerificationStatus::TemporaryFailure;
-          }
-          else if (hashCode == NotStarted_HASH)
-          {
-            return VerificationStatus::NotStarted;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return VerificationStatus::Pending;
+            }
+            break;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return VerificationStatus::Success;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return VerificationStatus::Failed;
+            }
+            break;
+          case TemporaryFailure_HASH:
+            if (name == "TemporaryFailure")
+            {
+              return VerificationStatus::TemporaryFailure;
+            }
+            break;
+          case NotStarted_HASH:
+            if (name == "NotStarted")
+            {
+              return VerificationStatus::NotStarted;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return VerificationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForVerificationStatus(VerificationStatus enumValue)
+        const char* GetNameForVerificationStatus(VerificationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -72,7 +72,8 @@ namespace ESPartitionInstanceTypeMapper
 {
 AWS_ELASTICSEARCHSERVICE_API ESPartitionInstanceType GetESPartitionInstanceTypeForName(const Aws::String& name);
 
-AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForESPartitionInstanceType(ESPartitionInstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForESPartitionInstanceType(ESPartitionInstanceType value);
 } // namespace ESPartitionInstanceTypeMapper
 } // namespace Model
 } // namespace ElasticsearchService
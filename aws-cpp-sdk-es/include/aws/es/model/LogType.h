@@ -35,7 +35,8 @@ namespace LogTypeMapper
 {
 AWS_ELASTICSEARCHSERVICE_API LogType GetLogTypeForName(const Aws::String& name);
 
-AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForLogType(LogType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForLogType(LogType value);
 } // namespace LogTypeMapper
 } // namespace Model
 } // namespace ElasticsearchService
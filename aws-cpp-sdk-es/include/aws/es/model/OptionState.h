@@ -35,7 +35,8 @@ namespace OptionStateMapper
 {
 AWS_ELASTICSEARCHSERVICE_API OptionState GetOptionStateForName(const Aws::String& name);
 
-AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForOptionState(OptionState value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForOptionState(OptionState value);
 } // namespace OptionStateMapper
 } // namespace Model
 } // namespace ElasticsearchService
@@ -35,7 +35,8 @@ namespace ReservedElasticsearchInstancePaymentOptionMapper
 {
 AWS_ELASTICSEARCHSERVICE_API ReservedElasticsearchInstancePaymentOption GetReservedElasticsearchInstancePaymentOptionForName(const Aws::String& name);
 
-AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForReservedElasticsearchInstancePaymentOption(ReservedElasticsearchInstancePaymentOption value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForReservedElasticsearchInstancePaymentOption(ReservedElasticsearchInstancePaymentOption value);
 } // namespace ReservedElasticsearchInstancePaymentOptionMapper
 } // namespace Model
 } // namespace ElasticsearchService
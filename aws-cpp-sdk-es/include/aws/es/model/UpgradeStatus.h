@@ -36,7 +36,8 @@ namespace UpgradeStatusMapper
 {
 AWS_ELASTICSEARCHSERVICE_API UpgradeStatus GetUpgradeStatusForName(const Aws::String& name);
 
-AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForUpgradeStatus(UpgradeStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForUpgradeStatus(UpgradeStatus value);
 } // namespace UpgradeStatusMapper
 } // namespace Model
 } // namespace ElasticsearchService
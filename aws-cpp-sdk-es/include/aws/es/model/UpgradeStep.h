@@ -35,7 +35,8 @@ namespace UpgradeStepMapper
 {
 AWS_ELASTICSEARCHSERVICE_API UpgradeStep GetUpgradeStepForName(const Aws::String& name);
 
-AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForUpgradeStep(UpgradeStep value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForUpgradeStep(UpgradeStep value);
 } // namespace UpgradeStepMapper
 } // namespace Model
 } // namespace ElasticsearchService
@@ -35,7 +35,8 @@ namespace VolumeTypeMapper
 {
 AWS_ELASTICSEARCHSERVICE_API VolumeType GetVolumeTypeForName(const Aws::String& name);
 
-AWS_ELASTICSEARCHSERVICE_API Aws::String GetNameForVolumeType(VolumeType value);
+// names of values not modeled point into the enum overflow container
+AWS_ELASTICSEARCHSERVICE_API const char* GetNameForVolumeType(VolumeType value);
 } // namespace VolumeTypeMapper
 } // namespace Model
 } // namespace ElasticsearchService
@@ -28,12 +28,12 @@ namespace ElasticsearchService
 namespace ElasticsearchServiceErrorMapper
 {
 
-static const int BASE_HASH = HashingUtils::HashString("BaseException");
-static const int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ResourceAlreadyExistsException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int INTERNAL_HASH = HashingUtils::HashString("InternalException");
-static const int DISABLED_OPERATION_HASH = HashingUtils::HashString("DisabledOperationException");
-static const int INVALID_TYPE_HASH = HashingUtils::HashString("InvalidTypeException");
+static constexpr int BASE_HASH = HashingUtils::CompileTimeHashString("BaseException");
+static constexpr int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyExistsException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int INTERNAL_HASH = HashingUtils::CompileTimeHashString("InternalException");
+static constexpr int DISABLED_OPERATION_HASH = HashingUtils::CompileTimeHashString("DisabledOperationException");
+static constexpr int INVALID_TYPE_HASH = HashingUtils::CompileTimeHashString("InvalidTypeException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
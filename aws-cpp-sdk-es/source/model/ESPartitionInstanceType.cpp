@@ -30,210 +30,296 @@ namespace Aws
       namespace ESPartitionInstanceTypeMapper
       {
 
-        static const int m3_medium_elasticsearch_HASH = HashingUtils::HashString("m3.medium.elasticsearch");
-        static const int m3_large_elasticsearch_HASH = HashingUtils::HashString("m3.large.elasticsearch");
-        static const int m3_xlarge_elasticsearch_HASH = HashingUtils::HashString("m3.xlarge.elasticsearch");
-        static const int m3_2xlarge_elasticsearch_HASH = HashingUtils::HashString("m3.2xlarge.elasticsearch");
-        static const int m4_large_elasticsearch_HASH = HashingUtils::HashString("m4.large.elasticsearch");
-        static const int m4_xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.xlarge.elasticsearch");
-        static const int m4_2xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.2xlarge.elasticsearch");
-        static const int m4_4xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.4xlarge.elasticsearch");
-        static const int m4_10xlarge_elasticsearch_HASH = HashingUtils::HashString("m4.10xlarge.elasticsearch");
-        static const int t2_micro_elasticsearch_HASH = HashingUtils::HashString("t2.micro.elasticsearch");
-        static const int t2_small_elasticsearch_HASH = HashingUtils::HashString("t2.small.elasticsearch");
-        static const int t2_medium_elasticsearch_HASH = HashingUtils::HashString("t2.medium.elasticsearch");
-        static const int r3_large_elasticsearch_HASH = HashingUtils::HashString("r3.large.elasticsearch");
-        static const int r3_xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.xlarge.elasticsearch");
-        static const int r3_2xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.2xlarge.elasticsearch");
-        static const int r3_4xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.4xlarge.elasticsearch");
-        static const int r3_8xlarge_elasticsearch_HASH = HashingUtils::HashString("r3.8xlarge.elasticsearch");
-        static const int i2_xlarge_elasticsearch_HASH = HashingUtils::HashString("i2.xlarge.elasticsearch");
-        static const int i2_2xlarge_elasticsearch_HASH = HashingUtils::HashString("i2.2xlarge.elasticsearch");
-        static const int d2_xlarge_elasticsearch_HASH = HashingUtils::HashString("d2.xlarge.elasticsearch");
-        static const int d2_2xlarge_elasticsearch_HASH = HashingUtils::HashString("d2.2xlarge.elasticsearch");
-        static const int d2_4xlarge_elasticsearch_HASH = HashingUtils::HashString("d2.4xlarge.elasticsearch");
-        static const int d2_8xlarge_elasticsearch_HASH = HashingUtils::HashString("d2.8xlarge.elasticsearch");
-        static const int c4_large_elasticsearch_HASH = HashingUtils::HashString("c4.large.elasticsearch");
-        static const int c4_xlarge_elasticsearch_HASH = HashingUtils::HashString("c4.xlarge.elasticsearch");
-        static const int c4_2xlarge_elasticsearch_HASH = HashingUtils::HashString("c4.2xlarge.elasticsearch");
-        static const int c4_4xlarge_elasticsearch_HASH = HashingUtils::HashString("c4.4xlarge.elasticsearch");
-        static const int c4_8xlarge_elasticsearch_HASH = HashingUtils::HashString("c4.8xlarge.elasticsearch");
-        static const int r4_large_elasticsearch_HASH = HashingUtils::HashString("r4.large.elasticsearch");
-        static const int r4_xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.xlarge.elasticsearch");
-        static const int r4_2xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.2xlarge.elasticsearch");
-        static const int r4_4xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.4xlarge.elasticsearch");
-        static const int r4_8xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.8xlarge.elasticsearch");
-        static const int r4_16xlarge_elasticsearch_HASH = HashingUtils::HashString("r4.16xlarge.elasticsearch");
-        static const int i3_large_elasticsearch_HASH = HashingUtils::HashString("i3.large.elasticsearch");
-        static const int i3_xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.xlarge.elasticsearch");
-        static const int i3_2xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.2xlarge.elasticsearch");
-        static const int i3_4xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.4xlarge.elasticsearch");
-        static const int i3_8xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.8xlarge.elasticsearch");
-        static const int i3_16xlarge_elasticsearch_HASH = HashingUtils::HashString("i3.16xlarge.elasticsearch");
+        static constexpr int m3_medium_elasticsearch_HASH = HashingUtils::CompileTimeHashString("m3.medium.elasticsearch");
+        static constexpr int m3_large_elasticsearch_HASH = HashingUtils::CompileTimeHashString("m3.large.elasticsearch");
+        static constexpr int m3_xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("m3.xlarge.elasticsearch");
+        static constexpr int m3_2xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("m3.2xlarge.elasticsearch");
+        static constexpr int m4_large_elasticsearch_HASH = HashingUtils::CompileTimeHashString("m4.large.elasticsearch");
+        static constexpr int m4_xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("m4.xlarge.elasticsearch");
+        static constexpr int m4_2xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("m4.2xlarge.elasticsearch");
+        static constexpr int m4_4xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("m4.4xlarge.elasticsearch");
+        static constexpr int m4_10xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("m4.10xlarge.elasticsearch");
+        static constexpr int t2_micro_elasticsearch_HASH = HashingUtils::CompileTimeHashString("t2.micro.elasticsearch");
+        static constexpr int t2_small_elasticsearch_HASH = HashingUtils::CompileTimeHashString("t2.small.elasticsearch");
+        static constexpr int t2_medium_elasticsearch_HASH = HashingUtils::CompileTimeHashString("t2.medium.elasticsearch");
+        static constexpr int r3_large_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r3.large.elasticsearch");
+        static constexpr int r3_xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r3.xlarge.elasticsearch");
+        static constexpr int r3_2xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r3.2xlarge.elasticsearch");
+        static constexpr int r3_4xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r3.4xlarge.elasticsearch");
+        static constexpr int r3_8xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r3.8xlarge.elasticsearch");
+        static constexpr int i2_xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("i2.xlarge.elasticsearch");
+        static constexpr int i2_2xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("i2.2xlarge.elasticsearch");
+        static constexpr int d2_xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("d2.xlarge.elasticsearch");
+        static constexpr int d2_2xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("d2.2xlarge.elasticsearch");
+        static constexpr int d2_4xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("d2.4xlarge.elasticsearch");
+        static constexpr int d2_8xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("d2.8xlarge.elasticsearch");
+        static constexpr int c4_large_elasticsearch_HASH = HashingUtils::CompileTimeHashString("c4.large.elasticsearch");
+        static constexpr int c4_xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("c4.xlarge.elasticsearch");
+        static constexpr int c4_2xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("c4.2xlarge.elasticsearch");
+        static constexpr int c4_4xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("c4.4xlarge.elasticsearch");
+        static constexpr int c4_8xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("c4.8xlarge.elasticsearch");
+        static constexpr int r4_large_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r4.large.elasticsearch");
+        static constexpr int r4_xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r4.xlarge.elasticsearch");
+        static constexpr int r4_2xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r4.2xlarge.elasticsearch");
+        static constexpr int r4_4xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r4.4xlarge.elasticsearch");
+        static constexpr int r4_8xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r4.8xlarge.elasticsearch");
+        static constexpr int r4_16xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("r4.16xlarge.elasticsearch");
+        static constexpr int i3_large_elasticsearch_HASH = HashingUtils::CompileTimeHashString("i3.large.elasticsearch");
+        static constexpr int i3_xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("i3.xlarge.elasticsearch");
+        static constexpr int i3_2xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("i3.2xlarge.elasticsearch");
+        static constexpr int i3_4xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("i3.4xlarge.elasticsearch");
+        static constexpr int i3_8xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("i3.8xlarge.elasticsearch");
+        static constexpr int i3_16xlarge_elasticsearch_HASH = HashingUtils::CompileTimeHashString("i3.16xlarge.elasticsearch");
 
 
         ESPartitionInstanceType GetESPartitionInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == m3_medium_elasticsearch_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ESPartitionInstanceType::m3_medium_elasticsearch;
-          }
-          else if (hashCode == m3_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m3_large_elasticsearch;
-          }
-          else if (hashCode == m3_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m3_xlarge_elasticsearch;
-          }
-          else if (hashCode == m3_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m3_2xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_large_elasticsearch;
-          }
-          else if (hashCode == m4_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_2xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_4xlarge_elasticsearch;
-          }
-          else if (hashCode == m4_10xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::m4_10xlarge_elasticsearch;
-          }
-          else if (hashCode == t2_micro_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::t2_micro_elasticsearch;
-          }
-          else if (hashCode == t2_small_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::t2_small_elasticsearch;
-          }
-          else if (hashCode == t2_medium_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::t2_medium_elasticsearch;
-          }
-          else if (hashCode == r3_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_large_elasticsearch;
-          }
-          else if (hashCode == r3_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_xlarge_elasticsearch;
-          }
-          else if (hashCode == r3_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_2xlarge_elasticsearch;
-          }
-          else if (hashCode == r3_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_4xlarge_elasticsearch;
-          }
-          else if (hashCode == r3_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r3_8xlarge_elasticsearch;
-          }
-          else if (hashCode == i2_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i2_xlarge_elasticsearch;
-          }
-          else if (hashCode == i2_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i2_2xlarge_elasticsearch;
-          }
-          else if (hashCode == d2_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::d2_xlarge_elasticsearch;
-          }
-          else if (hashCode == d2_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::d2_2xlarge_elasticsearch;
-          }
-          else if (hashCode == d2_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::d2_4xlarge_elasticsearch;
-          }
-          else if (hashCode == d2_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::d2_8xlarge_elasticsearch;
-          }
-          else if (hashCode == c4_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_large_elasticsearch;
-          }
-          else if (hashCode == c4_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_xlarge_elasticsearch;
-          }
-          else if (hashCode == c4_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_2xlarge_elasticsearch;
-          }
-          else if (hashCode == c4_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_4xlarge_elasticsearch;
-          }
-          else if (hashCode == c4_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::c4_8xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_large_elasticsearch;
-          }
-          else if (hashCode == r4_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_2xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_4xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_8xlarge_elasticsearch;
-          }
-          else if (hashCode == r4_16xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::r4_16xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_large_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_large_elasticsearch;
-          }
-          else if (hashCode == i3_xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_2xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_2xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_4xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_4xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_8xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_8xlarge_elasticsearch;
-          }
-          else if (hashCode == i3_16xlarge_elasticsearch_HASH)
-          {
-            return ESPartitionInstanceType::i3_16xlarge_elasticsearch;
+          case m3_medium_elasticsearch_HASH:
+            if (name == "m3.medium.elasticsearch")
+            {
+              return ESPartitionInstanceType::m3_medium_elasticsearch;
+            }
+            break;
+          case m3_large_elasticsearch_HASH:
+            if (name == "m3.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::m3_large_elasticsearch;
+            }
+            break;
+          case m3_xlarge_elasticsearch_HASH:
+            if (name == "m3.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m3_xlarge_elasticsearch;
+            }
+            break;
+          case m3_2xlarge_elasticsearch_HASH:
+            if (name == "m3.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m3_2xlarge_elasticsearch;
+            }
+            break;
+          case m4_large_elasticsearch_HASH:
+            if (name == "m4.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_large_elasticsearch;
+            }
+            break;
+          case m4_xlarge_elasticsearch_HASH:
+            if (name == "m4.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_xlarge_elasticsearch;
+            }
+            break;
+          case m4_2xlarge_elasticsearch_HASH:
+            if (name == "m4.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_2xlarge_elasticsearch;
+            }
+            break;
+          case m4_4xlarge_elasticsearch_HASH:
+            if (name == "m4.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_4xlarge_elasticsearch;
+            }
+            break;
+          case m4_10xlarge_elasticsearch_HASH:
+            if (name == "m4.10xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::m4_10xlarge_elasticsearch;
+            }
+            break;
+          case t2_micro_elasticsearch_HASH:
+            if (name == "t2.micro.elasticsearch")
+            {
+              return ESPartitionInstanceType::t2_micro_elasticsearch;
+            }
+            break;
+          case t2_small_elasticsearch_HASH:
+            if (name == "t2.small.elasticsearch")
+            {
+              return ESPartitionInstanceType::t2_small_elasticsearch;
+            }
+            break;
+          case t2_medium_elasticsearch_HASH:
+            if (name == "t2.medium.elasticsearch")
+            {
+              return ESPartitionInstanceType::t2_medium_elasticsearch;
+            }
+            break;
+          case r3_large_elasticsearch_HASH:
+            if (name == "r3.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_large_elasticsearch;
+            }
+            break;
+          case r3_xlarge_elasticsearch_HASH:
+            if (name == "r3.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_xlarge_elasticsearch;
+            }
+            break;
+          case r3_2xlarge_elasticsearch_HASH:
+            if (name == "r3.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_2xlarge_elasticsearch;
+            }
+            break;
+          case r3_4xlarge_elasticsearch_HASH:
+            if (name == "r3.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_4xlarge_elasticsearch;
+            }
+            break;
+          case r3_8xlarge_elasticsearch_HASH:
+            if (name == "r3.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r3_8xlarge_elasticsearch;
+            }
+            break;
+          case i2_xlarge_elasticsearch_HASH:
+            if (name == "i2.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i2_xlarge_elasticsearch;
+            }
+            break;
+          case i2_2xlarge_elasticsearch_HASH:
+            if (name == "i2.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i2_2xlarge_elasticsearch;
+            }
+            break;
+          case d2_xlarge_elasticsearch_HASH:
+            if (name == "d2.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::d2_xlarge_elasticsearch;
+            }
+            break;
+          case d2_2xlarge_elasticsearch_HASH:
+            if (name == "d2.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::d2_2xlarge_elasticsearch;
+            }
+            break;
+          case d2_4xlarge_elasticsearch_HASH:
+            if (name == "d2.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::d2_4xlarge_elasticsearch;
+            }
+            break;
+          case d2_8xlarge_elasticsearch_HASH:
+            if (name == "d2.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::d2_8xlarge_elasticsearch;
+            }
+            break;
+          case c4_large_elasticsearch_HASH:
+            if (name == "c4.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_large_elasticsearch;
+            }
+            break;
+          case c4_xlarge_elasticsearch_HASH:
+            if (name == "c4.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_xlarge_elasticsearch;
+            }
+            break;
+          case c4_2xlarge_elasticsearch_HASH:
+            if (name == "c4.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_2xlarge_elasticsearch;
+            }
+            break;
+          case c4_4xlarge_elasticsearch_HASH:
+            if (name == "c4.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_4xlarge_elasticsearch;
+            }
+            break;
+          case c4_8xlarge_elasticsearch_HASH:
+            if (name == "c4.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::c4_8xlarge_elasticsearch;
+            }
+            break;
+          case r4_large_elasticsearch_HASH:
+            if (name == "r4.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_large_elasticsearch;
+            }
+            break;
+          case r4_xlarge_elasticsearch_HASH:
+            if (name == "r4.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_xlarge_elasticsearch;
+            }
+            break;
+          case r4_2xlarge_elasticsearch_HASH:
+            if (name == "r4.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_2xlarge_elasticsearch;
+            }
+            break;
+          case r4_4xlarge_elasticsearch_HASH:
+            if (name == "r4.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_4xlarge_elasticsearch;
+            }
+            break;
+          case r4_8xlarge_elasticsearch_HASH:
+            if (name == "r4.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_8xlarge_elasticsearch;
+            }
+            break;
+          case r4_16xlarge_elasticsearch_HASH:
+            if (name == "r4.16xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::r4_16xlarge_elasticsearch;
+            }
+            break;
+          case i3_large_elasticsearch_HASH:
+            if (name == "i3.large.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_large_elasticsearch;
+            }
+            break;
+          case i3_xlarge_elasticsearch_HASH:
+            if (name == "i3.xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_xlarge_elasticsearch;
+            }
+            break;
+          case i3_2xlarge_elasticsearch_HASH:
+            if (name == "i3.2xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_2xlarge_elasticsearch;
+            }
+            break;
+          case i3_4xlarge_elasticsearch_HASH:
+            if (name == "i3.4xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_4xlarge_elasticsearch;
+            }
+            break;
+          case i3_8xlarge_elasticsearch_HASH:
+            if (name == "i3.8xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_8xlarge_elasticsearch;
+            }
+            break;
+          case i3_16xlarge_elasticsearch_HASH:
+            if (name == "i3.16xlarge.elasticsearch")
+            {
+              return ESPartitionInstanceType::i3_16xlarge_elasticsearch;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -245,7 +331,7 @@ namespace Aws
           return ESPartitionInstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForESPartitionInstanceType(ESPartitionInstanceType enumValue)
+        const char* GetNameForESPartitionInstanceType(ESPartitionInstanceType enumValue)
         {
           switch(enumValue)
           {
@@ -333,7 +419,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace LogTypeMapper
       {
 
-        static const int INDEX_SLOW_LOGS_HASH = HashingUtils::HashString("INDEX_SLOW_LOGS");
-        static const int SEARCH_SLOW_LOGS_HASH = HashingUtils::HashString("SEARCH_SLOW_LOGS");
-        static const int ES_APPLICATION_LOGS_HASH = HashingUtils::HashString("ES_APPLICATION_LOGS");
+        static constexpr int INDEX_SLOW_LOGS_HASH = HashingUtils::CompileTimeHashString("INDEX_SLOW_LOGS");
+        static constexpr int SEARCH_SLOW_LOGS_HASH = HashingUtils::CompileTimeHashString("SEARCH_SLOW_LOGS");
+        static constexpr int ES_APPLICATION_LOGS_HASH = HashingUtils::CompileTimeHashString("ES_APPLICATION_LOGS");
 
 
         LogType GetLogTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INDEX_SLOW_LOGS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LogType::INDEX_SLOW_LOGS;
-          }
-          else if (hashCode == SEARCH_SLOW_LOGS_HASH)
-          {
-            return LogType::SEARCH_SLOW_LOGS;
-          }
-          else if (hashCode == ES_APPLICATION_LOGS_HASH)
-          {
-            return LogType::ES_APPLICATION_LOGS;
+          case INDEX_SLOW_LOGS_HASH:
+            if (name == "INDEX_SLOW_LOGS")
+            {
+              return LogType::INDEX_SLOW_LOGS;
+            }
+            break;
+          case SEARCH_SLOW_LOGS_HASH:
+            if (name == "SEARCH_SLOW_LOGS")
+            {
+              return LogType::SEARCH_SLOW_LOGS;
+            }
+            break;
+          case ES_APPLICATION_LOGS_HASH:
+            if (name == "ES_APPLICATION_LOGS")
+            {
+              return LogType::ES_APPLICATION_LOGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return LogType::NOT_SET;
         }
 
-        Aws::String GetNameForLogType(LogType enumValue)
+        const char* GetNameForLogType(LogType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace OptionStateMapper
       {
 
-        static const int RequiresIndexDocuments_HASH = HashingUtils::HashString("RequiresIndexDocuments");
-        static const int Processing_HASH = HashingUtils::HashString("Processing");
-        static const int Active_HASH = HashingUtils::HashString("Active");
+        static constexpr int RequiresIndexDocuments_HASH = HashingUtils::CompileTimeHashString("RequiresIndexDocuments");
+        static constexpr int Processing_HASH = HashingUtils::CompileTimeHashString("Processing");
+        static constexpr int Active_HASH = HashingUtils::CompileTimeHashString("Active");
 
 
         OptionState GetOptionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RequiresIndexDocuments_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OptionState::RequiresIndexDocuments;
-          }
-          else if (hashCode == Processing_HASH)
-          {
-            return OptionState::Processing;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return OptionState::Active;
+          case RequiresIndexDocuments_HASH:
+            if (name == "RequiresIndexDocuments")
+            {
+              return OptionState::RequiresIndexDocuments;
+            }
+            break;
+          case Processing_HASH:
+            if (name == "Processing")
+            {
+              return OptionState::Processing;
+            }
+            break;
+          case Active_HASH:
+            if (name == "Active")
+            {
+              return OptionState::Active;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return OptionState::NOT_SET;
         }
 
-        Aws::String GetNameForOptionState(OptionState enumValue)
+        const char* GetNameForOptionState(OptionState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
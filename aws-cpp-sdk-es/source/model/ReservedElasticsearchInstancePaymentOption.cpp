@@ -30,25 +30,37 @@ namespace Aws
       namespace ReservedElasticsearchInstancePaymentOptionMapper
       {
 
-        static const int ALL_UPFRONT_HASH = HashingUtils::HashString("ALL_UPFRONT");
-        static const int PARTIAL_UPFRONT_HASH = HashingUtils::HashString("PARTIAL_UPFRONT");
-        static const int NO_UPFRONT_HASH = HashingUtils::HashString("NO_UPFRONT");
+        static constexpr int ALL_UPFRONT_HASH = HashingUtils::CompileTimeHashString("ALL_UPFRONT");
+        static constexpr int PARTIAL_UPFRONT_HASH = HashingUtils::CompileTimeHashString("PARTIAL_UPFRONT");
+        static constexpr int NO_UPFRONT_HASH = HashingUtils::CompileTimeHashString("NO_UPFRONT");
 
 
         ReservedElasticsearchInstancePaymentOption GetReservedElasticsearchInstancePaymentOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_UPFRONT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservedElasticsearchInstancePaymentOption::ALL_UPFRONT;
-          }
-          else if (hashCode == PARTIAL_UPFRONT_HASH)
-          {
-            return ReservedElasticsearchInstancePaymentOption::PARTIAL_UPFRONT;
-          }
-          else if (hashCode == NO_UPFRONT_HASH)
-          {
-            return ReservedElasticsearchInstancePaymentOption::NO_UPFRONT;
+          case ALL_UPFRONT_HASH:
+            if (name == "ALL_UPFRONT")
+            {
+              return ReservedElasticsearchInstancePaymentOption::ALL_UPFRONT;
+            }
+            break;
+          case PARTIAL_UPFRONT_HASH:
+            if (name == "PARTIAL_UPFRONT")
+            {
+              return ReservedElasticsearchInstancePaymentOption::PARTIAL_UPFRONT;
+            }
+            break;
+          case NO_UPFRONT_HASH:
+            if (name == "NO_UPFRONT")
+            {
+              return ReservedElasticsearchInstancePaymentOption::NO_UPFRONT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ReservedElasticsearchInstancePaymentOption::NOT_SET;
         }
 
-        Aws::String GetNameForReservedElasticsearchInstancePaymentOption(ReservedElasticsearchInstancePaymentOption enumValue)
+        const char* GetNameForReservedElasticsearchInstancePaymentOption(ReservedElasticsearchInstancePaymentOption enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace UpgradeStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int SUCCEEDED_WITH_ISSUES_HASH = HashingUtils::HashString("SUCCEEDED_WITH_ISSUES");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int SUCCEEDED_WITH_ISSUES_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED_WITH_ISSUES");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         UpgradeStatus GetUpgradeStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UpgradeStatus::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return UpgradeStatus::SUCCEEDED;
-          }
-          else if (hashCode == SUCCEEDED_WITH_ISSUES_HASH)
-          {
-            return UpgradeStatus::SUCCEEDED_WITH_ISSUES;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return UpgradeStatus::FAILED;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return UpgradeStatus::IN_PROGRESS;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return UpgradeStatus::SUCCEEDED;
+            }
+            break;
+          case SUCCEEDED_WITH_ISSUES_HASH:
+            if (name == "SUCCEEDED_WITH_ISSUES")
+            {
+              return UpgradeStatus::SUCCEEDED_WITH_ISSUES;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return UpgradeStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return UpgradeStatus::NOT_SET;
         }
 
-        Aws::String GetNameForUpgradeStatus(UpgradeStatus enumValue)
+        const char* GetNameForUpgradeStatus(UpgradeStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
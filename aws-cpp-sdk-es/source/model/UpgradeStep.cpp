@@ -30,25 +30,37 @@ namespace Aws
       namespace UpgradeStepMapper
       {
 
-        static const int PRE_UPGRADE_CHECK_HASH = HashingUtils::HashString("PRE_UPGRADE_CHECK");
-        static const int SNAPSHOT_HASH = HashingUtils::HashString("SNAPSHOT");
-        static const int UPGRADE_HASH = HashingUtils::HashString("UPGRADE");
+        static constexpr int PRE_UPGRADE_CHECK_HASH = HashingUtils::CompileTimeHashString("PRE_UPGRADE_CHECK");
+        static constexpr int SNAPSHOT_HASH = HashingUtils::CompileTimeHashString("SNAPSHOT");
+        static constexpr int UPGRADE_HASH = HashingUtils::CompileTimeHashString("UPGRADE");
 
 
         UpgradeStep GetUpgradeStepForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRE_UPGRADE_CHECK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UpgradeStep::PRE_UPGRADE_CHECK;
-          }
-          else if (hashCode == SNAPSHOT_HASH)
-          {
-            return UpgradeStep::SNAPSHOT;
-          }
-          else if (hashCode == UPGRADE_HASH)
-          {
-            return UpgradeStep::UPGRADE;
+          case PRE_UPGRADE_CHECK_HASH:
+            if (name == "PRE_UPGRADE_CHECK")
+            {
+              return UpgradeStep::PRE_UPGRADE_CHECK;
+            }
+            break;
+          case SNAPSHOT_HASH:
+            if (name == "SNAPSHOT")
+            {
+              return UpgradeStep::SNAPSHOT;
+            }
+            break;
+          case UPGRADE_HASH:
+            if (name == "UPGRADE")
+            {
+              return UpgradeStep::UPGRADE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return UpgradeStep::NOT_SET;
         }
 
-        Aws::String GetNameForUpgradeStep(UpgradeStep enumValue)
+        const char* GetNameForUpgradeStep(UpgradeStep enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
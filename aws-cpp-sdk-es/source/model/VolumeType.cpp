@@ -30,25 +30,37 @@ namespace Aws
       namespace VolumeTypeMapper
       {
 
-        static const int standard_HASH = HashingUtils::HashString("standard");
-        static const int gp2_HASH = HashingUtils::HashString("gp2");
-        static const int io1_HASH = HashingUtils::HashString("io1");
+        static constexpr int standard_HASH = HashingUtils::CompileTimeHashString("standard");
+        static constexpr int gp2_HASH = HashingUtils::CompileTimeHashString("gp2");
+        static constexpr int io1_HASH = HashingUtils::CompileTimeHashString("io1");
 
 
         VolumeType GetVolumeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == standard_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VolumeType::standard;
-          }
-          else if (hashCode == gp2_HASH)
-          {
-            return VolumeType::gp2;
-          }
-          else if (hashCode == io1_HASH)
-          {
-            return VolumeType::io1;
+          case standard_HASH:
+            if (name == "standard")
+            {
+              return VolumeType::standard;
+            }
+            break;
+          case gp2_HASH:
+            if (name == "gp2")
+            {
+              return VolumeType::gp2;
+            }
+            break;
+          case io1_HASH:
+            if (name == "io1")
+            {
+              return VolumeType::io1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return VolumeType::NOT_SET;
         }
 
-        Aws::String GetNameForVolumeType(VolumeType enumValue)
+        const char* GetNameForVolumeType(VolumeType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
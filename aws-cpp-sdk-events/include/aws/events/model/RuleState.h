@@ -34,7 +34,8 @@ namespace RuleStateMapper
 {
 AWS_CLOUDWATCHEVENTS_API RuleState GetRuleStateForName(const Aws::String& name);
 
-AWS_CLOUDWATCHEVENTS_API Aws::String GetNameForRuleState(RuleState value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDWATCHEVENTS_API const char* GetNameForRuleState(RuleState value);
 } // namespace RuleStateMapper
 } // namespace Model
 } // namespace CloudWatchEvents
@@ -28,11 +28,11 @@ namespace CloudWatchEvents
 namespace CloudWatchEventsErrorMapper
 {
 
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int POLICY_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("PolicyLengthExceededException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int INTERNAL_HASH = HashingUtils::HashString("InternalException");
-static const int INVALID_EVENT_PATTERN_HASH = HashingUtils::HashString("InvalidEventPatternException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int POLICY_LENGTH_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("PolicyLengthExceededException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int INTERNAL_HASH = HashingUtils::CompileTimeHashString("InternalException");
+static constexpr int INVALID_EVENT_PATTERN_HASH = HashingUtils::CompileTimeHashString("InvalidEventPatternException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
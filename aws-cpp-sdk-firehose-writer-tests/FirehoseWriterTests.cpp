@@ -0,0 +1,287 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/firehose-writer/FirehoseWriter.h>
+#include <aws/firehose/model/PutRecordBatchRequest.h>
+#include <aws/firehose/model/PutRecordBatchResult.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/testing/BatchingClientTest.h>
+
+#include <thread>
+
+using namespace Aws::FirehoseWriter;
+using namespace Aws::Firehose;
+using namespace Aws::Firehose::Model;
+using namespace Aws::Utils;
+
+static const char* DELIVERY_STREAM_NAME = "FirehoseWriterTestStream";
+
+/**
+ * Firehose client answering PutRecordBatch synchronously, failing every other record of the first requests it is told to,
+ * or whole requests with the error it is given.
+ */
+class MockFirehoseClient : public Aws::Testing::MockServiceClient<FirehoseClient>
+{
+public:
+    MockFirehoseClient() : m_failedRequests(0), m_requestsToFail(0), m_failAllRecords(false),
+        m_requestError(FirehoseErrors::UNKNOWN), m_failRequests(false) {}
+
+    void PutRecordBatchAsync(const PutRecordBatchRequest& request, const PutRecordBatchResponseReceivedHandler& handler,
+                             const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+    {
+        PutRecordBatchResult result;
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_requests.push_back(request);
+            if (m_failRequests)
+            {
+                bool retryable = m_requestError == FirehoseErrors::SERVICE_UNAVAILABLE;
+                handler(this, request, Aws::Client::AWSError<FirehoseErrors>(m_requestError, "Error", "Request failed", retryable), context);
+                return;
+            }
+
+            bool failRequest = m_failAllRecords || m_failedRequests < m_requestsToFail;
+            m_failedRequests += failRequest ? 1 : 0;
+
+            int failed = 0;
+            for (size_t i = 0; i < request.GetRecords().size(); ++i)
+            {
+                if (failRequest && (m_failAllRecords || i % 2 == 1))
+                {
+                    result.AddRequestResponses(PutRecordBatchResponseEntry().WithErrorCode("ServiceUnavailableException").WithErrorMessage("Slow down."));
+                    ++failed;
+                    continue;
+                }
+                result.AddRequestResponses(PutRecordBatchResponseEntry().WithRecordId(StringUtils::to_string(++m_recordId)));
+            }
+            result.SetFailedPutCount(failed);
+        }
+        handler(this, request, PutRecordBatchOutcome(result), context);
+    }
+
+    Aws::Vector<PutRecordBatchRequest> GetRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_requests;
+    }
+
+    mutable size_t m_failedRequests;
+    size_t m_requestsToFail;
+    bool m_failAllRecords;
+    FirehoseErrors m_requestError;
+    bool m_failRequests;
+
+private:
+    mutable Aws::Vector<PutRecordBatchRequest> m_requests;
+    mutable unsigned m_recordId = 0;
+};
+
+class FirehoseWriterTest : public Aws::Testing::BatchingClientTest<MockFirehoseClient, RecordResult>
+{
+protected:
+    void SetUp() override
+    {
+        BatchingClientTest::SetUp();
+        m_configuration.firehoseClient = m_client;
+        m_configuration.deliveryStreamName = DELIVERY_STREAM_NAME;
+        m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+        m_configuration.retryBaseDelay = std::chrono::milliseconds(1);
+        m_configuration.recordCompletedCallback = [this](const FirehoseWriter*, const RecordResult& result) { AddResult(result); };
+    }
+
+    void TearDown() override
+    {
+        m_configuration = FirehoseWriterConfiguration();
+        BatchingClientTest::TearDown();
+    }
+
+    FirehoseWriterConfiguration m_configuration;
+};
+
+TEST_F(FirehoseWriterTest, TestBatchesRecordsIntoFullRequests)
+{
+    {
+        FirehoseWriter writer(m_configuration);
+        for (size_t i = 0; i < 1200; ++i)
+        {
+            ASSERT_TRUE(writer.Put(MakeData(i)));
+        }
+        writer.FlushAndWait();
+
+        auto metrics = writer.GetMetrics();
+        ASSERT_EQ(1200u, metrics.entriesPut);
+        ASSERT_EQ(1200u, metrics.entriesSucceeded);
+        ASSERT_EQ(3u, metrics.requestsSent);
+        ASSERT_EQ(0u, metrics.entriesBuffered);
+        ASSERT_EQ(0u, metrics.bytesBuffered);
+    }
+
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(3u, requests.size());
+    ASSERT_EQ(500u, requests[0].GetRecords().size());
+    ASSERT_EQ(500u, requests[1].GetRecords().size());
+    ASSERT_EQ(200u, requests[2].GetRecords().size());
+    ASSERT_EQ(DELIVERY_STREAM_NAME, requests[0].GetDeliveryStreamName());
+    ASSERT_EQ("record 0", ToString(requests[0].GetRecords()[0].GetData()));
+    ASSERT_EQ("record 1199", ToString(requests[2].GetRecords()[199].GetData()));
+
+    ASSERT_EQ(1200u, m_results.size());
+    for (const auto& result : m_results)
+    {
+        ASSERT_TRUE(result.successful);
+        ASSERT_EQ(1u, result.attempts);
+        ASSERT_FALSE(result.recordId.empty());
+    }
+}
+
+TEST_F(FirehoseWriterTest, TestSplitsRequestsBySize)
+{
+    {
+        FirehoseWriter writer(m_configuration);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            ASSERT_TRUE(writer.Put(ByteBuffer(1000 * 1024)));
+        }
+    }
+
+    // 4 records of 1000KB fit in a 4MB request, 5 don't
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(3u, requests.size());
+    ASSERT_EQ(4u, requests[0].GetRecords().size());
+    ASSERT_EQ(4u, requests[1].GetRecords().size());
+    ASSERT_EQ(2u, requests[2].GetRecords().size());
+    ASSERT_EQ(10u, m_results.size());
+}
+
+TEST_F(FirehoseWriterTest, TestSendsOnceMaxBufferedTimeIsUp)
+{
+    m_configuration.maxBufferedTime = std::chrono::milliseconds(10);
+    FirehoseWriter writer(m_configuration);
+    ASSERT_TRUE(writer.Put(MakeData(0)));
+    for (size_t i = 0; i < 500 && writer.GetMetrics().entriesSucceeded == 0; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(1u, writer.GetMetrics().entriesSucceeded);
+    ASSERT_EQ(1u, m_client->GetRequests().size());
+}
+
+TEST_F(FirehoseWriterTest, TestRetriesOnlyFailedRecords)
+{
+    m_client->m_requestsToFail = 1;
+    {
+        FirehoseWriter writer(m_configuration);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            ASSERT_TRUE(writer.Put(MakeData(i)));
+        }
+        writer.FlushAndWait();
+        ASSERT_EQ(5u, writer.GetMetrics().entriesRetried);
+    }
+
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(2u, requests.size());
+    ASSERT_EQ(10u, requests[0].GetRecords().size());
+    ASSERT_EQ(5u, requests[1].GetRecords().size());
+    for (size_t i = 0; i < 5; ++i)
+    {
+        ASSERT_EQ(ToString(requests[0].GetRecords()[i * 2 + 1].GetData()), ToString(requests[1].GetRecords()[i].GetData()));
+    }
+
+    ASSERT_EQ(10u, m_results.size());
+    size_t retried = 0;
+    for (const auto& result : m_results)
+    {
+        ASSERT_TRUE(result.successful);
+        retried += result.attempts == 2 ? 1 : 0;
+    }
+    ASSERT_EQ(5u, retried);
+}
+
+TEST_F(FirehoseWriterTest, TestFailsRecordsAfterMaxRetries)
+{
+    m_client->m_failAllRecords = true;
+    m_configuration.maxRetries = 2;
+    {
+        FirehoseWriter writer(m_configuration);
+        ASSERT_TRUE(writer.Put(MakeData(0)));
+        writer.FlushAndWait();
+        ASSERT_EQ(1u, writer.GetMetrics().entriesFailed);
+    }
+
+    ASSERT_EQ(3u, m_client->GetRequests().size());
+    ASSERT_EQ(1u, m_results.size());
+    ASSERT_FALSE(m_results[0].successful);
+    ASSERT_EQ(3u, m_results[0].attempts);
+    ASSERT_EQ("ServiceUnavailableException", m_results[0].errorCode);
+}
+
+TEST_F(FirehoseWriterTest, TestRetriesFailedRequestsOnlyIfRetryable)
+{
+    m_client->m_failRequests = true;
+    m_client->m_requestError = FirehoseErrors::SERVICE_UNAVAILABLE;
+    m_configuration.maxRetries = 1;
+    {
+        FirehoseWriter writer(m_configuration);
+        ASSERT_TRUE(writer.Put(MakeData(0)));
+        ASSERT_TRUE(writer.Put(MakeData(1)));
+        writer.FlushAndWait();
+        ASSERT_EQ(2u, writer.GetMetrics().entriesFailed);
+    }
+    ASSERT_EQ(2u, m_client->GetRequests().size());
+    ASSERT_EQ(2u, m_results.size());
+
+    m_client->m_requestError = FirehoseErrors::RESOURCE_NOT_FOUND;
+    {
+        FirehoseWriter writer(m_configuration);
+        ASSERT_TRUE(writer.Put(MakeData(0)));
+        writer.FlushAndWait();
+    }
+    ASSERT_EQ(3u, m_client->GetRequests().size());
+    ASSERT_EQ(3u, m_results.size());
+    ASSERT_FALSE(m_results[2].successful);
+    ASSERT_EQ(1u, m_results[2].attempts);
+}
+
+TEST_F(FirehoseWriterTest, TestPutBlocksWhileBufferIsFull)
+{
+    m_configuration.maxBufferedBytes = 15;
+    FirehoseWriter writer(m_configuration);
+    std::thread putter([&writer]()
+    {
+        writer.Put(MakeData(0));
+        writer.Put(MakeData(1));
+    });
+
+    // the second record doesn't fit until the first is sent, which waits for maxBufferedTime or a flush
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(1u, writer.GetMetrics().entriesPut);
+    writer.Flush();
+    putter.join();
+    writer.FlushAndWait();
+    ASSERT_EQ(2u, writer.GetMetrics().entriesSucceeded);
+}
+
+TEST_F(FirehoseWriterTest, TestRejectsInvalidRecords)
+{
+    FirehoseWriter writer(m_configuration);
+    ASSERT_FALSE(writer.Put(ByteBuffer()));
+    ASSERT_FALSE(writer.Put(ByteBuffer(1000 * 1024 + 1)));
+    ASSERT_TRUE(writer.Put(MakeData(0)));
+    writer.FlushAndWait();
+    ASSERT_EQ(1u, writer.GetMetrics().entriesPut);
+}
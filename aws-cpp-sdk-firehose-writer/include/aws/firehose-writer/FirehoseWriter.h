@@ -0,0 +1,180 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/firehose-writer/FirehoseWriter_EXPORTS.h>
+#include <aws/firehose/FirehoseClient.h>
+#include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/BatchingLoop.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace Aws
+{
+    namespace FirehoseWriter
+    {
+        class FirehoseWriter;
+        struct BufferedRecord;
+        struct PutRecordBatchContext;
+
+        /**
+         * What became of a record given to FirehoseWriter::Put().
+         */
+        struct RecordResult
+        {
+            RecordResult() : successful(false), attempts(0) {}
+
+            std::shared_ptr<const Aws::Client::AsyncCallerContext> context;
+            bool successful;
+            /**
+             * Id Firehose gave the record, set on success.
+             */
+            Aws::String recordId;
+            /**
+             * Number of PutRecordBatch requests the record was sent in.
+             */
+            unsigned attempts;
+            /**
+             * Error of the last attempt if the record failed.
+             */
+            Aws::String errorCode;
+            Aws::String errorMessage;
+        };
+
+        typedef std::function<void(const FirehoseWriter*, const RecordResult&)> RecordCompletedCallback;
+
+        /**
+         * Entries are the records given to Put(), those waiting for a retry count as buffered.
+         */
+        struct FirehoseWriterMetrics : public Aws::Utils::Threading::BatchingMetrics
+        {
+            FirehoseWriterMetrics() : recordsSent(0), bytesSent(0) {}
+
+            /**
+             * Records sent in PutRecordBatch requests, a record sent again counts again.
+             */
+            uint64_t recordsSent;
+            uint64_t bytesSent;
+        };
+
+        struct AWS_FIREHOSE_WRITER_API FirehoseWriterConfiguration
+        {
+            FirehoseWriterConfiguration();
+
+            std::shared_ptr<Aws::Firehose::FirehoseClient> firehoseClient;
+            Aws::String deliveryStreamName;
+
+            /**
+             * How long a record may wait in the buffer for others to share a request with. Defaults to 100 milliseconds.
+             */
+            std::chrono::milliseconds maxBufferedTime;
+            /**
+             * A request is sent before maxBufferedTime is up once this many bytes or records are buffered, at most 4MB and 500 records,
+             * which is what a PutRecordBatch request takes.
+             */
+            size_t maxBytesPerRequest;
+            size_t maxRecordsPerRequest;
+            /**
+             * Put() blocks while this many bytes of records are waiting to be sent. Defaults to 64MB.
+             */
+            size_t maxBufferedBytes;
+            /**
+             * Defaults to 16.
+             */
+            size_t maxRequestsInFlight;
+
+            /**
+             * Records Firehose fails, e.g. with ServiceUnavailableException when the delivery stream is over its throughput, are sent again
+             * after a backoff doubling from retryBaseDelay up to maxRetryDelay, at most maxRetries times. Defaults to 10 retries from
+             * 100 milliseconds up to 5 seconds.
+             */
+            unsigned maxRetries;
+            std::chrono::milliseconds retryBaseDelay;
+            std::chrono::milliseconds maxRetryDelay;
+
+            /**
+             * Called once for every record Put() accepted, on success or after it failed for good.
+             */
+            RecordCompletedCallback recordCompletedCallback;
+        };
+
+        /**
+         * Sends records to a Kinesis Firehose delivery stream with PutRecordBatch, batching records from any number of threads into
+         * requests of up to 500 records or 4MB and retrying only the records of a request that failed.
+         *
+         * Put() returns as soon as the record is buffered, results are reported through the recordCompletedCallback.
+         * Requests are sent from a thread of the writer, PutRecordBatch runs on the executor of the client.
+         */
+        class AWS_FIREHOSE_WRITER_API FirehoseWriter : private Aws::Utils::Threading::BatchingLoop
+        {
+        public:
+            FirehoseWriter(const FirehoseWriterConfiguration& configuration);
+
+            /**
+             * Sends the records still buffered and waits for them, including their retries.
+             */
+            ~FirehoseWriter();
+
+            FirehoseWriter(const FirehoseWriter&) = delete;
+            FirehoseWriter& operator=(const FirehoseWriter&) = delete;
+
+            /**
+             * Buffers a record for the delivery stream, blocking while maxBufferedBytes are buffered. Returns false, and doesn't call
+             * the callback, if the record is empty or larger than the 1000KB Firehose takes, or the writer is being destroyed.
+             */
+            bool Put(const Aws::Utils::ByteBuffer& data, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
+            /**
+             * Sends the records buffered so far without waiting for maxBufferedTime. Does not block.
+             */
+            void Flush();
+
+            /**
+             * Sends the records buffered so far and blocks until all records have completed.
+             */
+            void FlushAndWait();
+
+            FirehoseWriterMetrics GetMetrics() const;
+
+            inline const FirehoseWriterConfiguration& GetConfiguration() const { return m_configuration; }
+
+        private:
+            bool HasBufferedEntries() const override;
+            std::function<void()> TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, Aws::Utils::Threading::WakeUpTime& wakeUp) override;
+            std::shared_ptr<PutRecordBatchContext> TakeRecords();
+            void SendRequest(const std::shared_ptr<PutRecordBatchContext>& context);
+            void OnPutRecordBatchOutcome(const Aws::Firehose::FirehoseClient*, const Aws::Firehose::Model::PutRecordBatchRequest&,
+                                         const Aws::Firehose::Model::PutRecordBatchOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
+            void RetryOrFail(std::chrono::steady_clock::time_point failedAt, const std::shared_ptr<BufferedRecord>& record, const Aws::String& errorCode,
+                             const Aws::String& errorMessage, bool retryable, Aws::Vector<RecordResult>& failed);
+
+            FirehoseWriterConfiguration m_configuration;
+
+            // records ready to be sent, oldest first
+            Aws::Deque<std::shared_ptr<BufferedRecord>> m_pending;
+            size_t m_pendingBytes;
+            Aws::Utils::Threading::RetryQueue<std::shared_ptr<BufferedRecord>> m_retries;
+            size_t m_retryBytes;
+            FirehoseWriterMetrics m_metrics;
+        };
+    }
+}
@@ -0,0 +1,297 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/firehose-writer/FirehoseWriter.h>
+#include <aws/firehose/model/PutRecordBatchRequest.h>
+#include <aws/firehose/model/PutRecordBatchResult.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+
+using namespace Aws::Client;
+using namespace Aws::Utils::Threading;
+using namespace Aws::Firehose;
+using namespace Aws::Firehose::Model;
+
+namespace Aws
+{
+    namespace FirehoseWriter
+    {
+        static const char* CLASS_TAG = "FirehoseWriter";
+
+        // limits of PutRecordBatch
+        static const size_t MAX_RECORDS_PER_REQUEST = 500;
+        static const size_t MAX_BYTES_PER_REQUEST = 4 * 1024 * 1024;
+        static const size_t MAX_RECORD_SIZE = 1000 * 1024;
+
+        struct BufferedRecord
+        {
+            BufferedRecord() : attempts(0) {}
+
+            Aws::Utils::ByteBuffer data;
+            std::shared_ptr<const AsyncCallerContext> context;
+            unsigned attempts;
+            std::chrono::steady_clock::time_point deadline;
+        };
+
+        struct PutRecordBatchContext : public AsyncCallerContext
+        {
+            PutRecordBatchContext() : bytes(0) {}
+
+            Aws::Vector<std::shared_ptr<BufferedRecord>> records;
+            size_t bytes;
+        };
+
+        FirehoseWriterConfiguration::FirehoseWriterConfiguration() :
+            maxBufferedTime(100),
+            maxBytesPerRequest(MAX_BYTES_PER_REQUEST),
+            maxRecordsPerRequest(MAX_RECORDS_PER_REQUEST),
+            maxBufferedBytes(64 * 1024 * 1024),
+            maxRequestsInFlight(16),
+            maxRetries(10),
+            retryBaseDelay(100),
+            maxRetryDelay(5000)
+        {
+        }
+
+        FirehoseWriter::FirehoseWriter(const FirehoseWriterConfiguration& configuration) :
+            BatchingLoop(configuration.maxRequestsInFlight),
+            m_configuration(configuration),
+            m_pendingBytes(0),
+            m_retries(configuration.retryBaseDelay, configuration.maxRetryDelay),
+            m_retryBytes(0)
+        {
+            m_configuration.maxRecordsPerRequest = (std::max)((std::min)(m_configuration.maxRecordsPerRequest, MAX_RECORDS_PER_REQUEST), static_cast<size_t>(1));
+            m_configuration.maxBytesPerRequest = (std::max)((std::min)(m_configuration.maxBytesPerRequest, MAX_BYTES_PER_REQUEST), static_cast<size_t>(1));
+            m_configuration.maxRequestsInFlight = (std::max)(m_configuration.maxRequestsInFlight, static_cast<size_t>(1));
+
+            StartLoop();
+        }
+
+        FirehoseWriter::~FirehoseWriter()
+        {
+            StopLoop();
+        }
+
+        bool FirehoseWriter::Put(const Aws::Utils::ByteBuffer& data, const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            if (data.GetLength() == 0 || data.GetLength() > MAX_RECORD_SIZE)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Record of " << data.GetLength() << " bytes exceeds the limits of Firehose.");
+                return false;
+            }
+
+            auto record = Aws::MakeShared<BufferedRecord>(CLASS_TAG);
+            record->data = data;
+            record->context = context;
+
+            size_t size = data.GetLength();
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this, size]()
+            {
+                size_t buffered = m_pendingBytes + m_retryBytes;
+                return IsStopping() || buffered == 0 || buffered + size <= m_configuration.maxBufferedBytes;
+            });
+            if (IsStopping())
+            {
+                return false;
+            }
+
+            bool wasEmpty = m_pending.empty();
+            record->deadline = std::chrono::steady_clock::now() + m_configuration.maxBufferedTime;
+            m_pending.push_back(record);
+            m_pendingBytes += size;
+            ++m_metrics.entriesPut;
+
+            // records only go out early when they fill a PutRecordBatch, otherwise the loop is asleep until the first of them is due
+            if (wasEmpty || m_pendingBytes >= m_configuration.maxBytesPerRequest || m_pending.size() >= m_configuration.maxRecordsPerRequest)
+            {
+                m_signal.notify_all();
+            }
+            return true;
+        }
+
+        void FirehoseWriter::Flush()
+        {
+            RequestFlush();
+        }
+
+        void FirehoseWriter::FlushAndWait()
+        {
+            RequestFlush();
+            WaitUntilIdle();
+        }
+
+        FirehoseWriterMetrics FirehoseWriter::GetMetrics() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            FirehoseWriterMetrics metrics = m_metrics;
+            CopyLoopMetrics(metrics);
+            metrics.entriesBuffered = m_pending.size() + m_retries.size();
+            metrics.bytesBuffered = m_pendingBytes + m_retryBytes;
+            return metrics;
+        }
+
+        bool FirehoseWriter::HasBufferedEntries() const
+        {
+            return !m_pending.empty() || !m_retries.empty();
+        }
+
+        std::function<void()> FirehoseWriter::TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, WakeUpTime& wakeUp)
+        {
+            // retried records go ahead of those not sent yet, they are due already
+            m_retries.TakeDue(now, [this, now](const std::shared_ptr<BufferedRecord>& record)
+            {
+                record->deadline = now;
+                m_pending.push_front(record);
+                m_pendingBytes += record->data.GetLength();
+                m_retryBytes -= record->data.GetLength();
+            });
+            m_retries.AddWakeUp(wakeUp);
+            if (m_pending.empty())
+            {
+                return nullptr;
+            }
+
+            bool ready = sendAll || m_pending.front()->deadline <= now ||
+                m_pendingBytes >= m_configuration.maxBytesPerRequest || m_pending.size() >= m_configuration.maxRecordsPerRequest;
+            if (!ready)
+            {
+                wakeUp.NoLaterThan(m_pending.front()->deadline);
+                return nullptr;
+            }
+
+            auto request = TakeRecords();
+            m_metrics.recordsSent += request->records.size();
+            m_metrics.bytesSent += request->bytes;
+            return [this, request]() { SendRequest(request); };
+        }
+
+        std::shared_ptr<PutRecordBatchContext> FirehoseWriter::TakeRecords()
+        {
+            auto context = Aws::MakeShared<PutRecordBatchContext>(CLASS_TAG);
+            while (!m_pending.empty() && context->records.size() < m_configuration.maxRecordsPerRequest)
+            {
+                const auto& record = m_pending.front();
+                size_t size = record->data.GetLength();
+                if (context->bytes + size > m_configuration.maxBytesPerRequest && !context->records.empty())
+                {
+                    break;
+                }
+
+                ++record->attempts;
+                m_pendingBytes -= size;
+                context->bytes += size;
+                context->records.push_back(record);
+                m_pending.pop_front();
+            }
+            return context;
+        }
+
+        void FirehoseWriter::SendRequest(const std::shared_ptr<PutRecordBatchContext>& context)
+        {
+            PutRecordBatchRequest putRecordBatchRequest;
+            putRecordBatchRequest.SetDeliveryStreamName(m_configuration.deliveryStreamName);
+            for (const auto& record : context->records)
+            {
+                putRecordBatchRequest.AddRecords(Record().WithData(record->data));
+            }
+
+            AWS_LOGSTREAM_TRACE(CLASS_TAG, "Sending " << context->records.size() << " records of " << context->bytes << " bytes to delivery stream "
+                    << m_configuration.deliveryStreamName);
+            m_configuration.firehoseClient->PutRecordBatchAsync(putRecordBatchRequest, std::bind(&FirehoseWriter::OnPutRecordBatchOutcome, this, std::placeholders::_1,
+                                                                                               std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), context);
+        }
+
+        void FirehoseWriter::RetryOrFail(std::chrono::steady_clock::time_point failedAt, const std::shared_ptr<BufferedRecord>& record, const Aws::String& errorCode,
+                                         const Aws::String& errorMessage, bool retryable, Aws::Vector<RecordResult>& failed)
+        {
+            if (retryable && record->attempts <= m_configuration.maxRetries)
+            {
+                m_retries.Add(record, record->attempts, failedAt);
+                m_retryBytes += record->data.GetLength();
+                ++m_metrics.entriesRetried;
+                return;
+            }
+
+            RecordResult result;
+            result.context = record->context;
+            result.attempts = record->attempts;
+            result.errorCode = errorCode;
+            result.errorMessage = errorMessage;
+            failed.push_back(result);
+            ++m_metrics.entriesFailed;
+        }
+
+        void FirehoseWriter::OnPutRecordBatchOutcome(const FirehoseClient*, const PutRecordBatchRequest&, const PutRecordBatchOutcome& putRecordBatchOutcome,
+                                                     const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            auto request = std::static_pointer_cast<const PutRecordBatchContext>(context);
+            Aws::Vector<RecordResult> results;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                // records failed by one response wait out the same backoff, so they go out again in one PutRecordBatch
+                auto failedAt = std::chrono::steady_clock::now();
+                if (!putRecordBatchOutcome.IsSuccess())
+                {
+                    const auto& error = putRecordBatchOutcome.GetError();
+                    AWS_LOGSTREAM_ERROR(CLASS_TAG, "PutRecordBatch of " << request->records.size() << " records to delivery stream "
+                            << m_configuration.deliveryStreamName << " failed. " << error);
+                    for (const auto& record : request->records)
+                    {
+                        RetryOrFail(failedAt, record, error.GetExceptionName(), error.GetMessage(), error.ShouldRetry(), results);
+                    }
+                }
+                else
+                {
+                    const auto& entries = putRecordBatchOutcome.GetResult().GetRequestResponses();
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "PutRecordBatch to delivery stream " << m_configuration.deliveryStreamName << " completed with "
+                            << putRecordBatchOutcome.GetResult().GetFailedPutCount() << " of " << entries.size() << " records failed.");
+                    for (size_t i = 0; i < request->records.size(); ++i)
+                    {
+                        const auto& record = request->records[i];
+                        if (i >= entries.size() || !entries[i].GetErrorCode().empty())
+                        {
+                            // PutRecordBatch fails records with ServiceUnavailableException or InternalFailure, both worth trying again
+                            Aws::String errorCode = i < entries.size() ? entries[i].GetErrorCode() : "InternalFailure";
+                            Aws::String errorMessage = i < entries.size() ? entries[i].GetErrorMessage() : "No result returned for the record.";
+                            RetryOrFail(failedAt, record, errorCode, errorMessage, true, results);
+                            continue;
+                        }
+
+                        RecordResult result;
+                        result.context = record->context;
+                        result.successful = true;
+                        result.recordId = entries[i].GetRecordId();
+                        result.attempts = record->attempts;
+                        results.push_back(result);
+                        ++m_metrics.entriesSucceeded;
+                    }
+                }
+            }
+
+            if (m_configuration.recordCompletedCallback)
+            {
+                for (const auto& result : results)
+                {
+                    m_configuration.recordCompletedCallback(this, result);
+                }
+            }
+
+            CompleteRequest();
+        }
+    }
+}
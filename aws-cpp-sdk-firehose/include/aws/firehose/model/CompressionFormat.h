@@ -36,7 +36,8 @@ namespace CompressionFormatMapper
 {
 AWS_FIREHOSE_API CompressionFormat GetCompressionFormatForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForCompressionFormat(CompressionFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForCompressionFormat(CompressionFormat value);
 } // namespace CompressionFormatMapper
 } // namespace Model
 } // namespace Firehose
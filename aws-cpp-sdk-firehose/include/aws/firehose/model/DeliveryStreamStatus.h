@@ -35,7 +35,8 @@ namespace DeliveryStreamStatusMapper
 {
 AWS_FIREHOSE_API DeliveryStreamStatus GetDeliveryStreamStatusForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForDeliveryStreamStatus(DeliveryStreamStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForDeliveryStreamStatus(DeliveryStreamStatus value);
 } // namespace DeliveryStreamStatusMapper
 } // namespace Model
 } // namespace Firehose
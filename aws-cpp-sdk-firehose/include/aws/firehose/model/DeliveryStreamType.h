@@ -34,7 +34,8 @@ namespace DeliveryStreamTypeMapper
 {
 AWS_FIREHOSE_API DeliveryStreamType GetDeliveryStreamTypeForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForDeliveryStreamType(DeliveryStreamType value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForDeliveryStreamType(DeliveryStreamType value);
 } // namespace DeliveryStreamTypeMapper
 } // namespace Model
 } // namespace Firehose
@@ -37,7 +37,8 @@ namespace ElasticsearchIndexRotationPeriodMapper
 {
 AWS_FIREHOSE_API ElasticsearchIndexRotationPeriod GetElasticsearchIndexRotationPeriodForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForElasticsearchIndexRotationPeriod(ElasticsearchIndexRotationPeriod value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForElasticsearchIndexRotationPeriod(ElasticsearchIndexRotationPeriod value);
 } // namespace ElasticsearchIndexRotationPeriodMapper
 } // namespace Model
 } // namespace Firehose
@@ -34,7 +34,8 @@ namespace ElasticsearchS3BackupModeMapper
 {
 AWS_FIREHOSE_API ElasticsearchS3BackupMode GetElasticsearchS3BackupModeForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForElasticsearchS3BackupMode(ElasticsearchS3BackupMode value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForElasticsearchS3BackupMode(ElasticsearchS3BackupMode value);
 } // namespace ElasticsearchS3BackupModeMapper
 } // namespace Model
 } // namespace Firehose
@@ -34,7 +34,8 @@ namespace HECEndpointTypeMapper
 {
 AWS_FIREHOSE_API HECEndpointType GetHECEndpointTypeForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForHECEndpointType(HECEndpointType value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForHECEndpointType(HECEndpointType value);
 } // namespace HECEndpointTypeMapper
 } // namespace Model
 } // namespace Firehose
@@ -33,7 +33,8 @@ namespace NoEncryptionConfigMapper
 {
 AWS_FIREHOSE_API NoEncryptionConfig GetNoEncryptionConfigForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForNoEncryptionConfig(NoEncryptionConfig value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForNoEncryptionConfig(NoEncryptionConfig value);
 } // namespace NoEncryptionConfigMapper
 } // namespace Model
 } // namespace Firehose
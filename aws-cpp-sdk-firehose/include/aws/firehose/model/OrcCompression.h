@@ -35,7 +35,8 @@ namespace OrcCompressionMapper
 {
 AWS_FIREHOSE_API OrcCompression GetOrcCompressionForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForOrcCompression(OrcCompression value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForOrcCompression(OrcCompression value);
 } // namespace OrcCompressionMapper
 } // namespace Model
 } // namespace Firehose
@@ -34,7 +34,8 @@ namespace OrcFormatVersionMapper
 {
 AWS_FIREHOSE_API OrcFormatVersion GetOrcFormatVersionForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForOrcFormatVersion(OrcFormatVersion value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForOrcFormatVersion(OrcFormatVersion value);
 } // namespace OrcFormatVersionMapper
 } // namespace Model
 } // namespace Firehose
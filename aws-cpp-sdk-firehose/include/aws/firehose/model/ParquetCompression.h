@@ -35,7 +35,8 @@ namespace ParquetCompressionMapper
 {
 AWS_FIREHOSE_API ParquetCompression GetParquetCompressionForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForParquetCompression(ParquetCompression value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForParquetCompression(ParquetCompression value);
 } // namespace ParquetCompressionMapper
 } // namespace Model
 } // namespace Firehose
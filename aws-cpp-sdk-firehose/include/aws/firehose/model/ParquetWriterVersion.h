@@ -34,7 +34,8 @@ namespace ParquetWriterVersionMapper
 {
 AWS_FIREHOSE_API ParquetWriterVersion GetParquetWriterVersionForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForParquetWriterVersion(ParquetWriterVersion value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForParquetWriterVersion(ParquetWriterVersion value);
 } // namespace ParquetWriterVersionMapper
 } // namespace Model
 } // namespace Firehose
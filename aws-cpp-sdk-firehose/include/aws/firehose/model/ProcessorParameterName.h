@@ -37,7 +37,8 @@ namespace ProcessorParameterNameMapper
 {
 AWS_FIREHOSE_API ProcessorParameterName GetProcessorParameterNameForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForProcessorParameterName(ProcessorParameterName value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForProcessorParameterName(ProcessorParameterName value);
 } // namespace ProcessorParameterNameMapper
 } // namespace Model
 } // namespace Firehose
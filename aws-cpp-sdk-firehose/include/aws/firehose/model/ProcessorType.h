@@ -33,7 +33,8 @@ namespace ProcessorTypeMapper
 {
 AWS_FIREHOSE_API ProcessorType GetProcessorTypeForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForProcessorType(ProcessorType value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForProcessorType(ProcessorType value);
 } // namespace ProcessorTypeMapper
 } // namespace Model
 } // namespace Firehose
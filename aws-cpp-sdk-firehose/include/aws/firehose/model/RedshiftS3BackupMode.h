@@ -34,7 +34,8 @@ namespace RedshiftS3BackupModeMapper
 {
 AWS_FIREHOSE_API RedshiftS3BackupMode GetRedshiftS3BackupModeForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForRedshiftS3BackupMode(RedshiftS3BackupMode value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForRedshiftS3BackupMode(RedshiftS3BackupMode value);
 } // namespace RedshiftS3BackupModeMapper
 } // namespace Model
 } // namespace Firehose
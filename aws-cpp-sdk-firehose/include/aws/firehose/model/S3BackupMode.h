@@ -34,7 +34,8 @@ namespace S3BackupModeMapper
 {
 AWS_FIREHOSE_API S3BackupMode GetS3BackupModeForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForS3BackupMode(S3BackupMode value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForS3BackupMode(S3BackupMode value);
 } // namespace S3BackupModeMapper
 } // namespace Model
 } // namespace Firehose
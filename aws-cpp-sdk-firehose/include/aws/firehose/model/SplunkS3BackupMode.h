@@ -34,7 +34,8 @@ namespace SplunkS3BackupModeMapper
 {
 AWS_FIREHOSE_API SplunkS3BackupMode GetSplunkS3BackupModeForName(const Aws::String& name);
 
-AWS_FIREHOSE_API Aws::String GetNameForSplunkS3BackupMode(SplunkS3BackupMode value);
+// names of values not modeled point into the enum overflow container
+AWS_FIREHOSE_API const char* GetNameForSplunkS3BackupMode(SplunkS3BackupMode value);
 } // namespace SplunkS3BackupModeMapper
 } // namespace Model
 } // namespace Firehose
@@ -30,30 +30,44 @@ namespace Aws
       namespace CompressionFormatMapper
       {
 
-        static const int UNCOMPRESSED_HASH = HashingUtils::HashString("UNCOMPRESSED");
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int ZIP_HASH = HashingUtils::HashString("ZIP");
-        static const int Snappy_HASH = HashingUtils::HashString("Snappy");
+        static constexpr int UNCOMPRESSED_HASH = HashingUtils::CompileTimeHashString("UNCOMPRESSED");
+        static constexpr int GZIP_HASH = HashingUtils::CompileTimeHashString("GZIP");
+        static constexpr int ZIP_HASH = HashingUtils::CompileTimeHashString("ZIP");
+        static constexpr int Snappy_HASH = HashingUtils::CompileTimeHashString("Snappy");
 
 
         CompressionFormat GetCompressionFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNCOMPRESSED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CompressionFormat::UNCOMPRESSED;
-          }
-          else if (hashCode == GZIP_HASH)
-          {
-            return CompressionFormat::GZIP;
-          }
-          else if (hashCode == ZIP_HASH)
-          {
-            return CompressionFormat::ZIP;
-          }
-          else if (hashCode == Snappy_HASH)
-          {
-            return CompressionFormat::Snappy;
+          case UNCOMPRESSED_HASH:
+            if (name == "UNCOMPRESSED")
+            {
+              return CompressionFormat::UNCOMPRESSED;
+            }
+            break;
+          case GZIP_HASH:
+            if (name == "GZIP")
+            {
+              return CompressionFormat::GZIP;
+            }
+            break;
+          case ZIP_HASH:
+            if (name == "ZIP")
+            {
+              return CompressionFormat::ZIP;
+            }
+            break;
+          case Snappy_HASH:
+            if (name == "Snappy")
+            {
+              return CompressionFormat::Snappy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return CompressionFormat::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionFormat(CompressionFormat enumValue)
+        const char* GetNameForCompressionFormat(CompressionFormat enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace DeliveryStreamStatusMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
 
 
         DeliveryStreamStatus GetDeliveryStreamStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeliveryStreamStatus::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return DeliveryStreamStatus::DELETING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return DeliveryStreamStatus::ACTIVE;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return DeliveryStreamStatus::CREATING;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return DeliveryStreamStatus::DELETING;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return DeliveryStreamStatus::ACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DeliveryStreamStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryStreamStatus(DeliveryStreamStatus enumValue)
+        const char* GetNameForDeliveryStreamStatus(DeliveryStreamStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DeliveryStreamTypeMapper
       {
 
-        static const int DirectPut_HASH = HashingUtils::HashString("DirectPut");
-        static const int KinesisStreamAsSource_HASH = HashingUtils::HashString("KinesisStreamAsSource");
+        static constexpr int DirectPut_HASH = HashingUtils::CompileTimeHashString("DirectPut");
+        static constexpr int KinesisStreamAsSource_HASH = HashingUtils::CompileTimeHashString("KinesisStreamAsSource");
 
 
         DeliveryStreamType GetDeliveryStreamTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DirectPut_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeliveryStreamType::DirectPut;
-          }
-          else if (hashCode == KinesisStreamAsSource_HASH)
-          {
-            return DeliveryStreamType::KinesisStreamAsSource;
+          case DirectPut_HASH:
+            if (name == "DirectPut")
+            {
+              return DeliveryStreamType::DirectPut;
+            }
+            break;
+          case KinesisStreamAsSource_HASH:
+            if (name == "KinesisStreamAsSource")
+            {
+              return DeliveryStreamType::KinesisStreamAsSource;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeliveryStreamType::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryStreamType(DeliveryStreamType enumValue)
+        const char* GetNameForDeliveryStreamType(DeliveryStreamType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
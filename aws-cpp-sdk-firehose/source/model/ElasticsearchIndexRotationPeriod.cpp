@@ -30,35 +30,51 @@ namespace Aws
       namespace ElasticsearchIndexRotationPeriodMapper
       {
 
-        static const int NoRotation_HASH = HashingUtils::HashString("NoRotation");
-        static const int OneHour_HASH = HashingUtils::HashString("OneHour");
-        static const int OneDay_HASH = HashingUtils::HashString("OneDay");
-        static const int OneWeek_HASH = HashingUtils::HashString("OneWeek");
-        static const int OneMonth_HASH = HashingUtils::HashString("OneMonth");
+        static constexpr int NoRotation_HASH = HashingUtils::CompileTimeHashString("NoRotation");
+        static constexpr int OneHour_HASH = HashingUtils::CompileTimeHashString("OneHour");
+        static constexpr int OneDay_HASH = HashingUtils::CompileTimeHashString("OneDay");
+        static constexpr int OneWeek_HASH = HashingUtils::CompileTimeHashString("OneWeek");
+        static constexpr int OneMonth_HASH = HashingUtils::CompileTimeHashString("OneMonth");
 
 
         ElasticsearchIndexRotationPeriod GetElasticsearchIndexRotationPeriodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoRotation_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ElasticsearchIndexRotationPeriod::NoRotation;
-          }
-          else if (hashCode == OneHour_HASH)
-          {
-            return ElasticsearchIndexRotationPeriod::OneHour;
-          }
-          else if (hashCode == OneDay_HASH)
-          {
-            return ElasticsearchIndexRotationPeriod::OneDay;
-          }
-          else if (hashCode == OneWeek_HASH)
-          {
-            return ElasticsearchIndexRotationPeriod::OneWeek;
-          }
-          else if (hashCode == OneMonth_HASH)
-          {
-            return ElasticsearchIndexRotationPeriod::OneMonth;
+          case NoRotation_HASH:
+            if (name == "NoRotation")
+            {
+              return ElasticsearchIndexRotationPeriod::NoRotation;
+            }
+            break;
+          case OneHour_HASH:
+            if (name == "OneHour")
+            {
+              return ElasticsearchIndexRotationPeriod::OneHour;
+            }
+            break;
+          case OneDay_HASH:
+            if (name == "OneDay")
+            {
+              return ElasticsearchIndexRotationPeriod::OneDay;
+            }
+            break;
+          case OneWeek_HASH:
+            if (name == "OneWeek")
+            {
+              return ElasticsearchIndexRotationPeriod::OneWeek;
+            }
+            break;
+          case OneMonth_HASH:
+            if (name == "OneMonth")
+            {
+              return ElasticsearchIndexRotationPeriod::OneMonth;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ElasticsearchIndexRotationPeriod::NOT_SET;
         }
 
-        Aws::String GetNameForElasticsearchIndexRotationPeriod(ElasticsearchIndexRotationPeriod enumValue)
+        const char* GetNameForElasticsearchIndexRotationPeriod(ElasticsearchIndexRotationPeriod enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
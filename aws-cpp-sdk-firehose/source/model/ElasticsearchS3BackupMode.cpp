@@ -30,20 +30,30 @@ namespace Aws
       namespace ElasticsearchS3BackupModeMapper
       {
 
-        static const int FailedDocumentsOnly_HASH = HashingUtils::HashString("FailedDocumentsOnly");
-        static const int AllDocuments_HASH = HashingUtils::HashString("AllDocuments");
+        static constexpr int FailedDocumentsOnly_HASH = HashingUtils::CompileTimeHashString("FailedDocumentsOnly");
+        static constexpr int AllDocuments_HASH = HashingUtils::CompileTimeHashString("AllDocuments");
 
 
         ElasticsearchS3BackupMode GetElasticsearchS3BackupModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FailedDocumentsOnly_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ElasticsearchS3BackupMode::FailedDocumentsOnly;
-          }
-          else if (hashCode == AllDocuments_HASH)
-          {
-            return ElasticsearchS3BackupMode::AllDocuments;
+          case FailedDocumentsOnly_HASH:
+            if (name == "FailedDocumentsOnly")
+            {
+              return ElasticsearchS3BackupMode::FailedDocumentsOnly;
+            }
+            break;
+          case AllDocuments_HASH:
+            if (name == "AllDocuments")
+            {
+              return ElasticsearchS3BackupMode::AllDocuments;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ElasticsearchS3BackupMode::NOT_SET;
         }
 
-        Aws::String GetNameForElasticsearchS3BackupMode(ElasticsearchS3BackupMode enumValue)
+        const char* GetNameForElasticsearchS3BackupMode(ElasticsearchS3BackupMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HECEndpointTypeMapper
       {
 
-        static const int Raw_HASH = HashingUtils::HashString("Raw");
-        static const int Event_HASH = HashingUtils::HashString("Event");
+        static constexpr int Raw_HASH = HashingUtils::CompileTimeHashString("Raw");
+        static constexpr int Event_HASH = HashingUtils::CompileTimeHashString("Event");
 
 
         HECEndpointType GetHECEndpointTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Raw_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HECEndpointType::Raw;
-          }
-          else if (hashCode == Event_HASH)
-          {
-            return HECEndpointType::Event;
+          case Raw_HASH:
+            if (name == "Raw")
+            {
+              return HECEndpointType::Raw;
+            }
+            break;
+          case Event_HASH:
+            if (name == "Event")
+            {
+              return HECEndpointType::Event;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HECEndpointType::NOT_SET;
         }
 
-        Aws::String GetNameForHECEndpointType(HECEndpointType enumValue)
+        const char* GetNameForHECEndpointType(HECEndpointType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace NoEncryptionConfigMapper
       {
 
-        static const int NoEncryption_HASH = HashingUtils::HashString("NoEncryption");
+        static constexpr int NoEncryption_HASH = HashingUtils::CompileTimeHashString("NoEncryption");
 
 
         NoEncryptionConfig GetNoEncryptionConfigForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoEncryption_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NoEncryptionConfig::NoEncryption;
+          case NoEncryption_HASH:
+            if (name == "NoEncryption")
+            {
+              return NoEncryptionConfig::NoEncryption;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return NoEncryptionConfig::NOT_SET;
         }
 
-        Aws::String GetNameForNoEncryptionConfig(NoEncryptionConfig enumValue)
+        const char* GetNameForNoEncryptionConfig(NoEncryptionConfig enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
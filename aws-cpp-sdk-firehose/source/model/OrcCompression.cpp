@@ -30,25 +30,37 @@ namespace Aws
       namespace OrcCompressionMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int ZLIB_HASH = HashingUtils::HashString("ZLIB");
-        static const int SNAPPY_HASH = HashingUtils::HashString("SNAPPY");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int ZLIB_HASH = HashingUtils::CompileTimeHashString("ZLIB");
+        static constexpr int SNAPPY_HASH = HashingUtils::CompileTimeHashString("SNAPPY");
 
 
         OrcCompression GetOrcCompressionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OrcCompression::NONE;
-          }
-          else if (hashCode == ZLIB_HASH)
-          {
-            return OrcCompression::ZLIB;
-          }
-          else if (hashCode == SNAPPY_HASH)
-          {
-            return OrcCompression::SNAPPY;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return OrcCompression::NONE;
+            }
+            break;
+          case ZLIB_HASH:
+            if (name == "ZLIB")
+            {
+              return OrcCompression::ZLIB;
+            }
+            break;
+          case SNAPPY_HASH:
+            if (name == "SNAPPY")
+            {
+              return OrcCompression::SNAPPY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return OrcCompression::NOT_SET;
         }
 
-        Aws::String GetNameForOrcCompression(OrcCompression enumValue)
+        const char* GetNameForOrcCompression(OrcCompression enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
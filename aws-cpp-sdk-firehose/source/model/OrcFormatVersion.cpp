@@ -30,20 +30,30 @@ namespace Aws
       namespace OrcFormatVersionMapper
       {
 
-        static const int V0_11_HASH = HashingUtils::HashString("V0_11");
-        static const int V0_12_HASH = HashingUtils::HashString("V0_12");
+        static constexpr int V0_11_HASH = HashingUtils::CompileTimeHashString("V0_11");
+        static constexpr int V0_12_HASH = HashingUtils::CompileTimeHashString("V0_12");
 
 
         OrcFormatVersion GetOrcFormatVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == V0_11_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OrcFormatVersion::V0_11;
-          }
-          else if (hashCode == V0_12_HASH)
-          {
-            return OrcFormatVersion::V0_12;
+          case V0_11_HASH:
+            if (name == "V0_11")
+            {
+              return OrcFormatVersion::V0_11;
+            }
+            break;
+          case V0_12_HASH:
+            if (name == "V0_12")
+            {
+              return OrcFormatVersion::V0_12;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OrcFormatVersion::NOT_SET;
         }
 
-        Aws::String GetNameForOrcFormatVersion(OrcFormatVersion enumValue)
+        const char* GetNameForOrcFormatVersion(OrcFormatVersion enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
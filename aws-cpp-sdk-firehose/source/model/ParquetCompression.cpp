@@ -30,25 +30,37 @@ namespace Aws
       namespace ParquetCompressionMapper
       {
 
-        static const int UNCOMPRESSED_HASH = HashingUtils::HashString("UNCOMPRESSED");
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int SNAPPY_HASH = HashingUtils::HashString("SNAPPY");
+        static constexpr int UNCOMPRESSED_HASH = HashingUtils::CompileTimeHashString("UNCOMPRESSED");
+        static constexpr int GZIP_HASH = HashingUtils::CompileTimeHashString("GZIP");
+        static constexpr int SNAPPY_HASH = HashingUtils::CompileTimeHashString("SNAPPY");
 
 
         ParquetCompression GetParquetCompressionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNCOMPRESSED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ParquetCompression::UNCOMPRESSED;
-          }
-          else if (hashCode == GZIP_HASH)
-          {
-            return ParquetCompression::GZIP;
-          }
-          else if (hashCode == SNAPPY_HASH)
-          {
-            return ParquetCompression::SNAPPY;
+          case UNCOMPRESSED_HASH:
+            if (name == "UNCOMPRESSED")
+            {
+              return ParquetCompression::UNCOMPRESSED;
+            }
+            break;
+          case GZIP_HASH:
+            if (name == "GZIP")
+            {
+              return ParquetCompression::GZIP;
+            }
+            break;
+          case SNAPPY_HASH:
+            if (name == "SNAPPY")
+            {
+              return ParquetCompression::SNAPPY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ParquetCompression::NOT_SET;
         }
 
-        Aws::String GetNameForParquetCompression(ParquetCompression enumValue)
+        const char* GetNameForParquetCompression(ParquetCompression enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
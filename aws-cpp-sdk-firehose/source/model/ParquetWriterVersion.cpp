@@ -30,20 +30,30 @@ namespace Aws
       namespace ParquetWriterVersionMapper
       {
 
-        static const int V1_HASH = HashingUtils::HashString("V1");
-        static const int V2_HASH = HashingUtils::HashString("V2");
+        static constexpr int V1_HASH = HashingUtils::CompileTimeHashString("V1");
+        static constexpr int V2_HASH = HashingUtils::CompileTimeHashString("V2");
 
 
         ParquetWriterVersion GetParquetWriterVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == V1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ParquetWriterVersion::V1;
-          }
-          else if (hashCode == V2_HASH)
-          {
-            return ParquetWriterVersion::V2;
+          case V1_HASH:
+            if (name == "V1")
+            {
+              return ParquetWriterVersion::V1;
+            }
+            break;
+          case V2_HASH:
+            if (name == "V2")
+            {
+              return ParquetWriterVersion::V2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ParquetWriterVersion::NOT_SET;
         }
 
-        Aws::String GetNameForParquetWriterVersion(ParquetWriterVersion enumValue)
+        const char* GetNameForParquetWriterVersion(ParquetWriterVersion enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
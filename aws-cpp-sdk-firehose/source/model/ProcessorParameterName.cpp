@@ -30,35 +30,51 @@ namespace Aws
       namespace ProcessorParameterNameMapper
       {
 
-        static const int LambdaArn_HASH = HashingUtils::HashString("LambdaArn");
-        static const int NumberOfRetries_HASH = HashingUtils::HashString("NumberOfRetries");
-        static const int RoleArn_HASH = HashingUtils::HashString("RoleArn");
-        static const int BufferSizeInMBs_HASH = HashingUtils::HashString("BufferSizeInMBs");
-        static const int BufferIntervalInSeconds_HASH = HashingUtils::HashString("BufferIntervalInSeconds");
+        static constexpr int LambdaArn_HASH = HashingUtils::CompileTimeHashString("LambdaArn");
+        static constexpr int NumberOfRetries_HASH = HashingUtils::CompileTimeHashString("NumberOfRetries");
+        static constexpr int RoleArn_HASH = HashingUtils::CompileTimeHashString("RoleArn");
+        static constexpr int BufferSizeInMBs_HASH = HashingUtils::CompileTimeHashString("BufferSizeInMBs");
+        static constexpr int BufferIntervalInSeconds_HASH = HashingUtils::CompileTimeHashString("BufferIntervalInSeconds");
 
 
         ProcessorParameterName GetProcessorParameterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LambdaArn_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProcessorParameterName::LambdaArn;
-          }
-          else if (hashCode == NumberOfRetries_HASH)
-          {
-            return ProcessorParameterName::NumberOfRetries;
-          }
-          else if (hashCode == RoleArn_HASH)
-          {
-            return ProcessorParameterName::RoleArn;
-          }
-          else if (hashCode == BufferSizeInMBs_HASH)
-          {
-            return ProcessorParameterName::BufferSizeInMBs;
-          }
-          else if (hashCode == BufferIntervalInSeconds_HASH)
-          {
-            return ProcessorParameterName::BufferIntervalInSeconds;
+          case LambdaArn_HASH:
+            if (name == "LambdaArn")
+            {
+              return ProcessorParameterName::LambdaArn;
+            }
+            break;
+          case NumberOfRetries_HASH:
+            if (name == "NumberOfRetries")
+            {
+              return ProcessorParameterName::NumberOfRetries;
+            }
+            break;
+          case RoleArn_HASH:
+            if (name == "RoleArn")
+            {
+              return ProcessorParameterName::RoleArn;
+            }
+            break;
+          case BufferSizeInMBs_HASH:
+            if (name == "BufferSizeInMBs")
+            {
+              return ProcessorParameterName::BufferSizeInMBs;
+            }
+            break;
+          case BufferIntervalInSeconds_HASH:
+            if (name == "BufferIntervalInSeconds")
+            {
+              return ProcessorParameterName::BufferIntervalInSeconds;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ProcessorParameterName::NOT_SET;
         }
 
-        Aws::String GetNameForProcessorParameterName(ProcessorParameterName enumValue)
+        const char* GetNameForProcessorParameterName(ProcessorParameterName enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
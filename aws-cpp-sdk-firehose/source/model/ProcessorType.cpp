@@ -30,15 +30,23 @@ namespace Aws
       namespace ProcessorTypeMapper
       {
 
-        static const int Lambda_HASH = HashingUtils::HashString("Lambda");
+        static constexpr int Lambda_HASH = HashingUtils::CompileTimeHashString("Lambda");
 
 
         ProcessorType GetProcessorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Lambda_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProcessorType::Lambda;
+          case Lambda_HASH:
+            if (name == "Lambda")
+            {
+              return ProcessorType::Lambda;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ProcessorType::NOT_SET;
         }
 
-        Aws::String GetNameForProcessorType(ProcessorType enumValue)
+        const char* GetNameForProcessorType(ProcessorType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace S3BackupModeMapper
       {
 
-        static const int Disabled_HASH = HashingUtils::HashString("Disabled");
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
+        static constexpr int Disabled_HASH = HashingUtils::CompileTimeHashString("Disabled");
+        static constexpr int Enabled_HASH = HashingUtils::CompileTimeHashString("Enabled");
 
 
         S3BackupMode GetS3BackupModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Disabled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return S3BackupMode::Disabled;
-          }
-          else if (hashCode == Enabled_HASH)
-          {
-            return S3BackupMode::Enabled;
+          case Disabled_HASH:
+            if (name == "Disabled")
+            {
+              return S3BackupMode::Disabled;
+            }
+            break;
+          case Enabled_HASH:
+            if (name == "Enabled")
+            {
+              return S3BackupMode::Enabled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return S3BackupMode::NOT_SET;
         }
 
-        Aws::String GetNameForS3BackupMode(S3BackupMode enumValue)
+        const char* GetNameForS3BackupMode(S3BackupMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SplunkS3BackupModeMapper
       {
 
-        static const int FailedEventsOnly_HASH = HashingUtils::HashString("FailedEventsOnly");
-        static const int AllEvents_HASH = HashingUtils::HashString("AllEvents");
+        static constexpr int FailedEventsOnly_HASH = HashingUtils::CompileTimeHashString("FailedEventsOnly");
+        static constexpr int AllEvents_HASH = HashingUtils::CompileTimeHashString("AllEvents");
 
 
         SplunkS3BackupMode GetSplunkS3BackupModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FailedEventsOnly_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SplunkS3BackupMode::FailedEventsOnly;
-          }
-          else if (hashCode == AllEvents_HASH)
-          {
-            return SplunkS3BackupMode::AllEvents;
+          case FailedEventsOnly_HASH:
+            if (name == "FailedEventsOnly")
+            {
+              return SplunkS3BackupMode::FailedEventsOnly;
+            }
+            break;
+          case AllEvents_HASH:
+            if (name == "AllEvents")
+            {
+              return SplunkS3BackupMode::AllEvents;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SplunkS3BackupMode::NOT_SET;
         }
 
-        Aws::String GetNameForSplunkS3BackupMode(SplunkS3BackupMode enumValue)
+        const char* GetNameForSplunkS3BackupMode(SplunkS3BackupMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
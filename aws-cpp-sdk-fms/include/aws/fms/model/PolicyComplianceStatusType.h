@@ -34,7 +34,8 @@ namespace PolicyComplianceStatusTypeMapper
 {
 AWS_FMS_API PolicyComplianceStatusType GetPolicyComplianceStatusTypeForName(const Aws::String& name);
 
-AWS_FMS_API Aws::String GetNameForPolicyComplianceStatusType(PolicyComplianceStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_FMS_API const char* GetNameForPolicyComplianceStatusType(PolicyComplianceStatusType value);
 } // namespace PolicyComplianceStatusTypeMapper
 } // namespace Model
 } // namespace FMS
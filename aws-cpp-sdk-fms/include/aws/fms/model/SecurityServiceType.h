@@ -33,7 +33,8 @@ namespace SecurityServiceTypeMapper
 {
 AWS_FMS_API SecurityServiceType GetSecurityServiceTypeForName(const Aws::String& name);
 
-AWS_FMS_API Aws::String GetNameForSecurityServiceType(SecurityServiceType value);
+// names of values not modeled point into the enum overflow container
+AWS_FMS_API const char* GetNameForSecurityServiceType(SecurityServiceType value);
 } // namespace SecurityServiceTypeMapper
 } // namespace Model
 } // namespace FMS
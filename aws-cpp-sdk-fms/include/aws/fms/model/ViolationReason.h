@@ -35,7 +35,8 @@ namespace ViolationReasonMapper
 {
 AWS_FMS_API ViolationReason GetViolationReasonForName(const Aws::String& name);
 
-AWS_FMS_API Aws::String GetNameForViolationReason(ViolationReason value);
+// names of values not modeled point into the enum overflow container
+AWS_FMS_API const char* GetNameForViolationReason(ViolationReason value);
 } // namespace ViolationReasonMapper
 } // namespace Model
 } // namespace FMS
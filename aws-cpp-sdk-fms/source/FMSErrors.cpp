@@ -28,10 +28,10 @@ namespace FMS
 namespace FMSErrorMapper
 {
 
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInputException");
-static const int INVALID_OPERATION_HASH = HashingUtils::HashString("InvalidOperationException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalErrorException");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInputException");
+static constexpr int INVALID_OPERATION_HASH = HashingUtils::CompileTimeHashString("InvalidOperationException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalErrorException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
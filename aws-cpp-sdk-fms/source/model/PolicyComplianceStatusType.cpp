@@ -30,20 +30,30 @@ namespace Aws
       namespace PolicyComplianceStatusTypeMapper
       {
 
-        static const int COMPLIANT_HASH = HashingUtils::HashString("COMPLIANT");
-        static const int NON_COMPLIANT_HASH = HashingUtils::HashString("NON_COMPLIANT");
+        static constexpr int COMPLIANT_HASH = HashingUtils::CompileTimeHashString("COMPLIANT");
+        static constexpr int NON_COMPLIANT_HASH = HashingUtils::CompileTimeHashString("NON_COMPLIANT");
 
 
         PolicyComplianceStatusType GetPolicyComplianceStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLIANT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PolicyComplianceStatusType::COMPLIANT;
-          }
-          else if (hashCode == NON_COMPLIANT_HASH)
-          {
-            return PolicyComplianceStatusType::NON_COMPLIANT;
+          case COMPLIANT_HASH:
+            if (name == "COMPLIANT")
+            {
+              return PolicyComplianceStatusType::COMPLIANT;
+            }
+            break;
+          case NON_COMPLIANT_HASH:
+            if (name == "NON_COMPLIANT")
+            {
+              return PolicyComplianceStatusType::NON_COMPLIANT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PolicyComplianceStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyComplianceStatusType(PolicyComplianceStatusType enumValue)
+        const char* GetNameForPolicyComplianceStatusType(PolicyComplianceStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace SecurityServiceTypeMapper
       {
 
-        static const int WAF_HASH = HashingUtils::HashString("WAF");
+        static constexpr int WAF_HASH = HashingUtils::CompileTimeHashString("WAF");
 
 
         SecurityServiceType GetSecurityServiceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WAF_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SecurityServiceType::WAF;
+          case WAF_HASH:
+            if (name == "WAF")
+            {
+              return SecurityServiceType::WAF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return SecurityServiceType::NOT_SET;
         }
 
-        Aws::String GetNameForSecurityServiceType(SecurityServiceType enumValue)
+        const char* GetNameForSecurityServiceType(SecurityServiceType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
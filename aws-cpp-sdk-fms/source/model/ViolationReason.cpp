@@ -30,25 +30,37 @@ namespace Aws
       namespace ViolationReasonMapper
       {
 
-        static const int WEB_ACL_MISSING_RULE_GROUP_HASH = HashingUtils::HashString("WEB_ACL_MISSING_RULE_GROUP");
-        static const int RESOURCE_MISSING_WEB_ACL_HASH = HashingUtils::HashString("RESOURCE_MISSING_WEB_ACL");
-        static const int RESOURCE_INCORRECT_WEB_ACL_HASH = HashingUtils::HashString("RESOURCE_INCORRECT_WEB_ACL");
+        static constexpr int WEB_ACL_MISSING_RULE_GROUP_HASH = HashingUtils::CompileTimeHashString("WEB_ACL_MISSING_RULE_GROUP");
+        static constexpr int RESOURCE_MISSING_WEB_ACL_HASH = HashingUtils::CompileTimeHashString("RESOURCE_MISSING_WEB_ACL");
+        static constexpr int RESOURCE_INCORRECT_WEB_ACL_HASH = HashingUtils::CompileTimeHashString("RESOURCE_INCORRECT_WEB_ACL");
 
 
         ViolationReason GetViolationReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WEB_ACL_MISSING_RULE_GROUP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ViolationReason::WEB_ACL_MISSING_RULE_GROUP;
-          }
-          else if (hashCode == RESOURCE_MISSING_WEB_ACL_HASH)
-          {
-            return ViolationReason::RESOURCE_MISSING_WEB_ACL;
-          }
-          else if (hashCode == RESOURCE_INCORRECT_WEB_ACL_HASH)
-          {
-            return ViolationReason::RESOURCE_INCORRECT_WEB_ACL;
+          case WEB_ACL_MISSING_RULE_GROUP_HASH:
+            if (name == "WEB_ACL_MISSING_RULE_GROUP")
+            {
+              return ViolationReason::WEB_ACL_MISSING_RULE_GROUP;
+            }
+            break;
+          case RESOURCE_MISSING_WEB_ACL_HASH:
+            if (name == "RESOURCE_MISSING_WEB_ACL")
+            {
+              return ViolationReason::RESOURCE_MISSING_WEB_ACL;
+            }
+            break;
+          case RESOURCE_INCORRECT_WEB_ACL_HASH:
+            if (name == "RESOURCE_INCORRECT_WEB_ACL")
+            {
+              return ViolationReason::RESOURCE_INCORRECT_WEB_ACL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ViolationReason::NOT_SET;
         }
 
-        Aws::String GetNameForViolationReason(ViolationReason enumValue)
+        const char* GetNameForViolationReason(ViolationReason enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
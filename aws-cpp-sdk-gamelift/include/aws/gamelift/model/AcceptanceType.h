@@ -34,7 +34,8 @@ namespace AcceptanceTypeMapper
 {
 AWS_GAMELIFT_API AcceptanceType GetAcceptanceTypeForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForAcceptanceType(AcceptanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForAcceptanceType(AcceptanceType value);
 } // namespace AcceptanceTypeMapper
 } // namespace Model
 } // namespace GameLift
@@ -35,7 +35,8 @@ namespace BuildStatusMapper
 {
 AWS_GAMELIFT_API BuildStatus GetBuildStatusForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForBuildStatus(BuildStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForBuildStatus(BuildStatus value);
 } // namespace BuildStatusMapper
 } // namespace Model
 } // namespace GameLift
@@ -36,7 +36,8 @@ namespace ComparisonOperatorTypeMapper
 {
 AWS_GAMELIFT_API ComparisonOperatorType GetComparisonOperatorTypeForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForComparisonOperatorType(ComparisonOperatorType value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForComparisonOperatorType(ComparisonOperatorType value);
 } // namespace ComparisonOperatorTypeMapper
 } // namespace Model
 } // namespace GameLift
@@ -66,7 +66,8 @@ namespace EC2InstanceTypeMapper
 {
 AWS_GAMELIFT_API EC2InstanceType GetEC2InstanceTypeForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForEC2InstanceType(EC2InstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForEC2InstanceType(EC2InstanceType value);
 } // namespace EC2InstanceTypeMapper
 } // namespace Model
 } // namespace GameLift
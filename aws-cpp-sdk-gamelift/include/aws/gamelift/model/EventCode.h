@@ -65,7 +65,8 @@ namespace EventCodeMapper
 {
 AWS_GAMELIFT_API EventCode GetEventCodeForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForEventCode(EventCode value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForEventCode(EventCode value);
 } // namespace EventCodeMapper
 } // namespace Model
 } // namespace GameLift
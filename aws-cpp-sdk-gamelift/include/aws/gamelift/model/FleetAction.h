@@ -33,7 +33,8 @@ namespace FleetActionMapper
 {
 AWS_GAMELIFT_API FleetAction GetFleetActionForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForFleetAction(FleetAction value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForFleetAction(FleetAction value);
 } // namespace FleetActionMapper
 } // namespace Model
 } // namespace GameLift
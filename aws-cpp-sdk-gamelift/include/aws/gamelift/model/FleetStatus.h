@@ -41,7 +41,8 @@ namespace FleetStatusMapper
 {
 AWS_GAMELIFT_API FleetStatus GetFleetStatusForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForFleetStatus(FleetStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForFleetStatus(FleetStatus value);
 } // namespace FleetStatusMapper
 } // namespace Model
 } // namespace GameLift
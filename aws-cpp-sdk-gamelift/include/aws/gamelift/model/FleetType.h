@@ -34,7 +34,8 @@ namespace FleetTypeMapper
 {
 AWS_GAMELIFT_API FleetType GetFleetTypeForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForFleetType(FleetType value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForFleetType(FleetType value);
 } // namespace FleetTypeMapper
 } // namespace Model
 } // namespace GameLift
@@ -36,7 +36,8 @@ namespace GameSessionPlacementStateMapper
 {
 AWS_GAMELIFT_API GameSessionPlacementState GetGameSessionPlacementStateForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForGameSessionPlacementState(GameSessionPlacementState value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForGameSessionPlacementState(GameSessionPlacementState value);
 } // namespace GameSessionPlacementStateMapper
 } // namespace Model
 } // namespace GameLift
@@ -37,7 +37,8 @@ namespace GameSessionStatusMapper
 {
 AWS_GAMELIFT_API GameSessionStatus GetGameSessionStatusForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForGameSessionStatus(GameSessionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForGameSessionStatus(GameSessionStatus value);
 } // namespace GameSessionStatusMapper
 } // namespace Model
 } // namespace GameLift
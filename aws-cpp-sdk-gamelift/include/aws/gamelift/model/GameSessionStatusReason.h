@@ -33,7 +33,8 @@ namespace GameSessionStatusReasonMapper
 {
 AWS_GAMELIFT_API GameSessionStatusReason GetGameSessionStatusReasonForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForGameSessionStatusReason(GameSessionStatusReason value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForGameSessionStatusReason(GameSessionStatusReason value);
 } // namespace GameSessionStatusReasonMapper
 } // namespace Model
 } // namespace GameLift
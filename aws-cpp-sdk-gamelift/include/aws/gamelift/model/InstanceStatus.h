@@ -35,7 +35,8 @@ namespace InstanceStatusMapper
 {
 AWS_GAMELIFT_API InstanceStatus GetInstanceStatusForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForInstanceStatus(InstanceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForInstanceStatus(InstanceStatus value);
 } // namespace InstanceStatusMapper
 } // namespace Model
 } // namespace GameLift
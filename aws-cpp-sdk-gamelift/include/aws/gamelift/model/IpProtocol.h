@@ -34,7 +34,8 @@ namespace IpProtocolMapper
 {
 AWS_GAMELIFT_API IpProtocol GetIpProtocolForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForIpProtocol(IpProtocol value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForIpProtocol(IpProtocol value);
 } // namespace IpProtocolMapper
 } // namespace Model
 } // namespace GameLift
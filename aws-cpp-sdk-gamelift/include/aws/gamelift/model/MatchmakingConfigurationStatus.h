@@ -40,7 +40,8 @@ namespace MatchmakingConfigurationStatusMapper
 {
 AWS_GAMELIFT_API MatchmakingConfigurationStatus GetMatchmakingConfigurationStatusForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForMatchmakingConfigurationStatus(MatchmakingConfigurationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForMatchmakingConfigurationStatus(MatchmakingConfigurationStatus value);
 } // namespace MatchmakingConfigurationStatusMapper
 } // namespace Model
 } // namespace GameLift
@@ -43,7 +43,8 @@ namespace MetricNameMapper
 {
 AWS_GAMELIFT_API MetricName GetMetricNameForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForMetricName(MetricName value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForMetricName(MetricName value);
 } // namespace MetricNameMapper
 } // namespace Model
 } // namespace GameLift
@@ -34,7 +34,8 @@ namespace OperatingSystemMapper
 {
 AWS_GAMELIFT_API OperatingSystem GetOperatingSystemForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForOperatingSystem(OperatingSystem value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForOperatingSystem(OperatingSystem value);
 } // namespace OperatingSystemMapper
 } // namespace Model
 } // namespace GameLift
@@ -34,7 +34,8 @@ namespace PlayerSessionCreationPolicyMapper
 {
 AWS_GAMELIFT_API PlayerSessionCreationPolicy GetPlayerSessionCreationPolicyForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForPlayerSessionCreationPolicy(PlayerSessionCreationPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForPlayerSessionCreationPolicy(PlayerSessionCreationPolicy value);
 } // namespace PlayerSessionCreationPolicyMapper
 } // namespace Model
 } // namespace GameLift
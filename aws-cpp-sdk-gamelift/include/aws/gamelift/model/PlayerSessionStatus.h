@@ -36,7 +36,8 @@ namespace PlayerSessionStatusMapper
 {
 AWS_GAMELIFT_API PlayerSessionStatus GetPlayerSessionStatusForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForPlayerSessionStatus(PlayerSessionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForPlayerSessionStatus(PlayerSessionStatus value);
 } // namespace PlayerSessionStatusMapper
 } // namespace Model
 } // namespace GameLift
@@ -34,7 +34,8 @@ namespace ProtectionPolicyMapper
 {
 AWS_GAMELIFT_API ProtectionPolicy GetProtectionPolicyForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForProtectionPolicy(ProtectionPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForProtectionPolicy(ProtectionPolicy value);
 } // namespace ProtectionPolicyMapper
 } // namespace Model
 } // namespace GameLift
@@ -34,7 +34,8 @@ namespace RoutingStrategyTypeMapper
 {
 AWS_GAMELIFT_API RoutingStrategyType GetRoutingStrategyTypeForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForRoutingStrategyType(RoutingStrategyType value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForRoutingStrategyType(RoutingStrategyType value);
 } // namespace RoutingStrategyTypeMapper
 } // namespace Model
 } // namespace GameLift
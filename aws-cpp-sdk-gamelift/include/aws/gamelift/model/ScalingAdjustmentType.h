@@ -35,7 +35,8 @@ namespace ScalingAdjustmentTypeMapper
 {
 AWS_GAMELIFT_API ScalingAdjustmentType GetScalingAdjustmentTypeForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForScalingAdjustmentType(ScalingAdjustmentType value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForScalingAdjustmentType(ScalingAdjustmentType value);
 } // namespace ScalingAdjustmentTypeMapper
 } // namespace Model
 } // namespace GameLift
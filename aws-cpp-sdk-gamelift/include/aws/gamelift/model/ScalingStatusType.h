@@ -39,7 +39,8 @@ namespace ScalingStatusTypeMapper
 {
 AWS_GAMELIFT_API ScalingStatusType GetScalingStatusTypeForName(const Aws::String& name);
 
-AWS_GAMELIFT_API Aws::String GetNameForScalingStatusType(ScalingStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_GAMELIFT_API const char* GetNameForScalingStatusType(ScalingStatusType value);
 } // namespace ScalingStatusTypeMapper
 } // namespace Model
 } // namespace GameLift
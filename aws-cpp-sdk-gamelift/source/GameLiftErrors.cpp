@@ -28,19 +28,19 @@ namespace GameLift
 namespace GameLiftErrorMapper
 {
 
-static const int TERMINAL_ROUTING_STRATEGY_HASH = HashingUtils::HashString("TerminalRoutingStrategyException");
-static const int CONFLICT_HASH = HashingUtils::HashString("ConflictException");
-static const int INVALID_GAME_SESSION_STATUS_HASH = HashingUtils::HashString("InvalidGameSessionStatusException");
-static const int INTERNAL_SERVICE_HASH = HashingUtils::HashString("InternalServiceException");
-static const int UNSUPPORTED_REGION_HASH = HashingUtils::HashString("UnsupportedRegionException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int GAME_SESSION_FULL_HASH = HashingUtils::HashString("GameSessionFullException");
-static const int UNAUTHORIZED_HASH = HashingUtils::HashString("UnauthorizedException");
-static const int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::HashString("IdempotentParameterMismatchException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int FLEET_CAPACITY_EXCEEDED_HASH = HashingUtils::HashString("FleetCapacityExceededException");
-static const int INVALID_FLEET_STATUS_HASH = HashingUtils::HashString("InvalidFleetStatusException");
+static constexpr int TERMINAL_ROUTING_STRATEGY_HASH = HashingUtils::CompileTimeHashString("TerminalRoutingStrategyException");
+static constexpr int CONFLICT_HASH = HashingUtils::CompileTimeHashString("ConflictException");
+static constexpr int INVALID_GAME_SESSION_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidGameSessionStatusException");
+static constexpr int INTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
+static constexpr int UNSUPPORTED_REGION_HASH = HashingUtils::CompileTimeHashString("UnsupportedRegionException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int GAME_SESSION_FULL_HASH = HashingUtils::CompileTimeHashString("GameSessionFullException");
+static constexpr int UNAUTHORIZED_HASH = HashingUtils::CompileTimeHashString("UnauthorizedException");
+static constexpr int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::CompileTimeHashString("IdempotentParameterMismatchException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int FLEET_CAPACITY_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("FleetCapacityExceededException");
+static constexpr int INVALID_FLEET_STATUS_HASH = HashingUtils::CompileTimeHashString("InvalidFleetStatusException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace AcceptanceTypeMapper
       {
 
-        static const int ACCEPT_HASH = HashingUtils::HashString("ACCEPT");
-        static const int REJECT_HASH = HashingUtils::HashString("REJECT");
+        static constexpr int ACCEPT_HASH = HashingUtils::CompileTimeHashString("ACCEPT");
+        static constexpr int REJECT_HASH = HashingUtils::CompileTimeHashString("REJECT");
 
 
         AcceptanceType GetAcceptanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCEPT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AcceptanceType::ACCEPT;
-          }
-          else if (hashCode == REJECT_HASH)
-          {
-            return AcceptanceType::REJECT;
+          case ACCEPT_HASH:
+            if (name == "ACCEPT")
+            {
+              return AcceptanceType::ACCEPT;
+            }
+            break;
+          case REJECT_HASH:
+            if (name == "REJECT")
+            {
+              return AcceptanceType::REJECT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AcceptanceType::NOT_SET;
         }
 
-        Aws::String GetNameForAcceptanceType(AcceptanceType enumValue)
+        const char* GetNameForAcceptanceType(AcceptanceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace BuildStatusMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int INITIALIZED_HASH = HashingUtils::CompileTimeHashString("INITIALIZED");
+        static constexpr int READY_HASH = HashingUtils::CompileTimeHashString("READY");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         BuildStatus GetBuildStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BuildStatus::INITIALIZED;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return BuildStatus::READY;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return BuildStatus::FAILED;
+          case INITIALIZED_HASH:
+            if (name == "INITIALIZED")
+            {
+              return BuildStatus::INITIALIZED;
+            }
+            break;
+          case READY_HASH:
+            if (name == "READY")
+            {
+              return BuildStatus::READY;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return BuildStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return BuildStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBuildStatus(BuildStatus enumValue)
+        const char* GetNameForBuildStatus(BuildStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
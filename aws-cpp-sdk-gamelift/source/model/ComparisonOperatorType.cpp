@@ -30,30 +30,44 @@ namespace Aws
       namespace ComparisonOperatorTypeMapper
       {
 
-        static const int GreaterThanOrEqualToThreshold_HASH = HashingUtils::HashString("GreaterThanOrEqualToThreshold");
-        static const int GreaterThanThreshold_HASH = HashingUtils::HashString("GreaterThanThreshold");
-        static const int LessThanThreshold_HASH = HashingUtils::HashString("LessThanThreshold");
-        static const int LessThanOrEqualToThreshold_HASH = HashingUtils::HashString("LessThanOrEqualToThreshold");
+        static constexpr int GreaterThanOrEqualToThreshold_HASH = HashingUtils::CompileTimeHashString("GreaterThanOrEqualToThreshold");
+        static constexpr int GreaterThanThreshold_HASH = HashingUtils::CompileTimeHashString("GreaterThanThreshold");
+        static constexpr int LessThanThreshold_HASH = HashingUtils::CompileTimeHashString("LessThanThreshold");
+        static constexpr int LessThanOrEqualToThreshold_HASH = HashingUtils::CompileTimeHashString("LessThanOrEqualToThreshold");
 
 
         ComparisonOperatorType GetComparisonOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GreaterThanOrEqualToThreshold_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComparisonOperatorType::GreaterThanOrEqualToThreshold;
-          }
-          else if (hashCode == GreaterThanThreshold_HASH)
-          {
-            return ComparisonOperatorType::GreaterThanThreshold;
-          }
-          else if (hashCode == LessThanThreshold_HASH)
-          {
-            return ComparisonOperatorType::LessThanThreshold;
-          }
-          else if (hashCode == LessThanOrEqualToThreshold_HASH)
-          {
-            return ComparisonOperatorType::LessThanOrEqualToThreshold;
+          case GreaterThanOrEqualToThreshold_HASH:
+            if (name == "GreaterThanOrEqualToThreshold")
+            {
+              return ComparisonOperatorType::GreaterThanOrEqualToThreshold;
+            }
+            break;
+          case GreaterThanThreshold_HASH:
+            if (name == "GreaterThanThreshold")
+            {
+              return ComparisonOperatorType::GreaterThanThreshold;
+            }
+            break;
+          case LessThanThreshold_HASH:
+            if (name == "LessThanThreshold")
+            {
+              return ComparisonOperatorType::LessThanThreshold;
+            }
+            break;
+          case LessThanOrEqualToThreshold_HASH:
+            if (name == "LessThanOrEqualToThreshold")
+            {
+              return ComparisonOperatorType::LessThanOrEqualToThreshold;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ComparisonOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperatorType(ComparisonOperatorType enumValue)
+        const char* GetNameForComparisonOperatorType(ComparisonOperatorType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
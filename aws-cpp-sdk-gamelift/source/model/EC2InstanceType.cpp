@@ -30,180 +30,254 @@ namespace Aws
       namespace EC2InstanceTypeMapper
       {
 
-        static const int t2_micro_HASH = HashingUtils::HashString("t2.micro");
-        static const int t2_small_HASH = HashingUtils::HashString("t2.small");
-        static const int t2_medium_HASH = HashingUtils::HashString("t2.medium");
-        static const int t2_large_HASH = HashingUtils::HashString("t2.large");
-        static const int c3_large_HASH = HashingUtils::HashString("c3.large");
-        static const int c3_xlarge_HASH = HashingUtils::HashString("c3.xlarge");
-        static const int c3_2xlarge_HASH = HashingUtils::HashString("c3.2xlarge");
-        static const int c3_4xlarge_HASH = HashingUtils::HashString("c3.4xlarge");
-        static const int c3_8xlarge_HASH = HashingUtils::HashString("c3.8xlarge");
-        static const int c4_large_HASH = HashingUtils::HashString("c4.large");
-        static const int c4_xlarge_HASH = HashingUtils::HashString("c4.xlarge");
-        static const int c4_2xlarge_HASH = HashingUtils::HashString("c4.2xlarge");
-        static const int c4_4xlarge_HASH = HashingUtils::HashString("c4.4xlarge");
-        static const int c4_8xlarge_HASH = HashingUtils::HashString("c4.8xlarge");
-        static const int r3_large_HASH = HashingUtils::HashString("r3.large");
-        static const int r3_xlarge_HASH = HashingUtils::HashString("r3.xlarge");
-        static const int r3_2xlarge_HASH = HashingUtils::HashString("r3.2xlarge");
-        static const int r3_4xlarge_HASH = HashingUtils::HashString("r3.4xlarge");
-        static const int r3_8xlarge_HASH = HashingUtils::HashString("r3.8xlarge");
-        static const int r4_large_HASH = HashingUtils::HashString("r4.large");
-        static const int r4_xlarge_HASH = HashingUtils::HashString("r4.xlarge");
-        static const int r4_2xlarge_HASH = HashingUtils::HashString("r4.2xlarge");
-        static const int r4_4xlarge_HASH = HashingUtils::HashString("r4.4xlarge");
-        static const int r4_8xlarge_HASH = HashingUtils::HashString("r4.8xlarge");
-        static const int r4_16xlarge_HASH = HashingUtils::HashString("r4.16xlarge");
-        static const int m3_medium_HASH = HashingUtils::HashString("m3.medium");
-        static const int m3_large_HASH = HashingUtils::HashString("m3.large");
-        static const int m3_xlarge_HASH = HashingUtils::HashString("m3.xlarge");
-        static const int m3_2xlarge_HASH = HashingUtils::HashString("m3.2xlarge");
-        static const int m4_large_HASH = HashingUtils::HashString("m4.large");
-        static const int m4_xlarge_HASH = HashingUtils::HashString("m4.xlarge");
-        static const int m4_2xlarge_HASH = HashingUtils::HashString("m4.2xlarge");
-        static const int m4_4xlarge_HASH = HashingUtils::HashString("m4.4xlarge");
-        static const int m4_10xlarge_HASH = HashingUtils::HashString("m4.10xlarge");
+        static constexpr int t2_micro_HASH = HashingUtils::CompileTimeHashString("t2.micro");
+        static constexpr int t2_small_HASH = HashingUtils::CompileTimeHashString("t2.small");
+        static constexpr int t2_medium_HASH = HashingUtils::CompileTimeHashString("t2.medium");
+        static constexpr int t2_large_HASH = HashingUtils::CompileTimeHashString("t2.large");
+        static constexpr int c3_large_HASH = HashingUtils::CompileTimeHashString("c3.large");
+        static constexpr int c3_xlarge_HASH = HashingUtils::CompileTimeHashString("c3.xlarge");
+        static constexpr int c3_2xlarge_HASH = HashingUtils::CompileTimeHashString("c3.2xlarge");
+        static constexpr int c3_4xlarge_HASH = HashingUtils::CompileTimeHashString("c3.4xlarge");
+        static constexpr int c3_8xlarge_HASH = HashingUtils::CompileTimeHashString("c3.8xlarge");
+        static constexpr int c4_large_HASH = HashingUtils::CompileTimeHashString("c4.large");
+        static constexpr int c4_xlarge_HASH = HashingUtils::CompileTimeHashString("c4.xlarge");
+        static constexpr int c4_2xlarge_HASH = HashingUtils::CompileTimeHashString("c4.2xlarge");
+        static constexpr int c4_4xlarge_HASH = HashingUtils::CompileTimeHashString("c4.4xlarge");
+        static constexpr int c4_8xlarge_HASH = HashingUtils::CompileTimeHashString("c4.8xlarge");
+        static constexpr int r3_large_HASH = HashingUtils::CompileTimeHashString("r3.large");
+        static constexpr int r3_xlarge_HASH = HashingUtils::CompileTimeHashString("r3.xlarge");
+        static constexpr int r3_2xlarge_HASH = HashingUtils::CompileTimeHashString("r3.2xlarge");
+        static constexpr int r3_4xlarge_HASH = HashingUtils::CompileTimeHashString("r3.4xlarge");
+        static constexpr int r3_8xlarge_HASH = HashingUtils::CompileTimeHashString("r3.8xlarge");
+        static constexpr int r4_large_HASH = HashingUtils::CompileTimeHashString("r4.large");
+        static constexpr int r4_xlarge_HASH = HashingUtils::CompileTimeHashString("r4.xlarge");
+        static constexpr int r4_2xlarge_HASH = HashingUtils::CompileTimeHashString("r4.2xlarge");
+        static constexpr int r4_4xlarge_HASH = HashingUtils::CompileTimeHashString("r4.4xlarge");
+        static constexpr int r4_8xlarge_HASH = HashingUtils::CompileTimeHashString("r4.8xlarge");
+        static constexpr int r4_16xlarge_HASH = HashingUtils::CompileTimeHashString("r4.16xlarge");
+        static constexpr int m3_medium_HASH = HashingUtils::CompileTimeHashString("m3.medium");
+        static constexpr int m3_large_HASH = HashingUtils::CompileTimeHashString("m3.large");
+        static constexpr int m3_xlarge_HASH = HashingUtils::CompileTimeHashString("m3.xlarge");
+        static constexpr int m3_2xlarge_HASH = HashingUtils::CompileTimeHashString("m3.2xlarge");
+        static constexpr int m4_large_HASH = HashingUtils::CompileTimeHashString("m4.large");
+        static constexpr int m4_xlarge_HASH = HashingUtils::CompileTimeHashString("m4.xlarge");
+        static constexpr int m4_2xlarge_HASH = HashingUtils::CompileTimeHashString("m4.2xlarge");
+        static constexpr int m4_4xlarge_HASH = HashingUtils::CompileTimeHashString("m4.4xlarge");
+        static constexpr int m4_10xlarge_HASH = HashingUtils::CompileTimeHashString("m4.10xlarge");
 
 
         EC2InstanceType GetEC2InstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == t2_micro_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EC2InstanceType::t2_micro;
-          }
-          else if (hashCode == t2_small_HASH)
-          {
-            return EC2InstanceType::t2_small;
-          }
-          else if (hashCode == t2_medium_HASH)
-          {
-            return EC2InstanceType::t2_medium;
-          }
-          else if (hashCode == t2_large_HASH)
-          {
-            return EC2InstanceType::t2_large;
-          }
-          else if (hashCode == c3_large_HASH)
-          {
-            return EC2InstanceType::c3_large;
-          }
-          else if (hashCode == c3_xlarge_HASH)
-          {
-            return EC2InstanceType::c3_xlarge;
-          }
-          else if (hashCode == c3_2xlarge_HASH)
-          {
-            return EC2InstanceType::c3_2xlarge;
-          }
-          else if (hashCode == c3_4xlarge_HASH)
-          {
-            return EC2InstanceType::c3_4xlarge;
-          }
-          else if (hashCode == c3_8xlarge_HASH)
-          {
-            return EC2InstanceType::c3_8xlarge;
-          }
-          else if (hashCode == c4_large_HASH)
-          {
-            return EC2InstanceType::c4_large;
-          }
-          else if (hashCode == c4_xlarge_HASH)
-          {
-            return EC2InstanceType::c4_xlarge;
-          }
-          else if (hashCode == c4_2xlarge_HASH)
-          {
-            return EC2InstanceType::c4_2xlarge;
-          }
-          else if (hashCode == c4_4xlarge_HASH)
-          {
-            return EC2InstanceType::c4_4xlarge;
-          }
-          else if (hashCode == c4_8xlarge_HASH)
-          {
-            return EC2InstanceType::c4_8xlarge;
-          }
-          else if (hashCode == r3_large_HASH)
-          {
-            return EC2InstanceType::r3_large;
-          }
-          else if (hashCode == r3_xlarge_HASH)
-          {
-            return EC2InstanceType::r3_xlarge;
-          }
-          else if (hashCode == r3_2xlarge_HASH)
-          {
-            return EC2InstanceType::r3_2xlarge;
-          }
-          else if (hashCode == r3_4xlarge_HASH)
-          {
-            return EC2InstanceType::r3_4xlarge;
-          }
-          else if (hashCode == r3_8xlarge_HASH)
-          {
-            return EC2InstanceType::r3_8xlarge;
-          }
-          else if (hashCode == r4_large_HASH)
-          {
-            return EC2InstanceType::r4_large;
-          }
-          else if (hashCode == r4_xlarge_HASH)
-          {
-            return EC2InstanceType::r4_xlarge;
-          }
-          else if (hashCode == r4_2xlarge_HASH)
-          {
-            return EC2InstanceType::r4_2xlarge;
-          }
-          else if (hashCode == r4_4xlarge_HASH)
-          {
-            return EC2InstanceType::r4_4xlarge;
-          }
-          else if (hashCode == r4_8xlarge_HASH)
-          {
-            return EC2InstanceType::r4_8xlarge;
-          }
-          else if (hashCode == r4_16xlarge_HASH)
-          {
-            return EC2InstanceType::r4_16xlarge;
-          }
-          else if (hashCode == m3_medium_HASH)
-          {
-            return EC2InstanceType::m3_medium;
-          }
-          else if (hashCode == m3_large_HASH)
-          {
-            return EC2InstanceType::m3_large;
-          }
-          else if (hashCode == m3_xlarge_HASH)
-          {
-            return EC2InstanceType::m3_xlarge;
-          }
-          else if (hashCode == m3_2xlarge_HASH)
-          {
-            return EC2InstanceType::m3_2xlarge;
-          }
-          else if (hashCode == m4_large_HASH)
-          {
-            return EC2InstanceType::m4_large;
-          }
-          else if (hashCode == m4_xlarge_HASH)
-          {
-            return EC2InstanceType::m4_xlarge;
-          }
-          else if (hashCode == m4_2xlarge_HASH)
-          {
-            return EC2InstanceType::m4_2xlarge;
-          }
-          else if (hashCode == m4_4xlarge_HASH)
-          {
-            return EC2InstanceType::m4_4xlarge;
-          }
-          else if (hashCode == m4_10xlarge_HASH)
-          {
-            return EC2InstanceType::m4_10xlarge;
+          case t2_micro_HASH:
+            if (name == "t2.micro")
+            {
+              return EC2InstanceType::t2_micro;
+            }
+            break;
+          case t2_small_HASH:
+            if (name == "t2.small")
+            {
+              return EC2InstanceType::t2_small;
+            }
+            break;
+          case t2_medium_HASH:
+            if (name == "t2.medium")
+            {
+              return EC2InstanceType::t2_medium;
+            }
+            break;
+          case t2_large_HASH:
+            if (name == "t2.large")
+            {
+              return EC2InstanceType::t2_large;
+            }
+            break;
+          case c3_large_HASH:
+            if (name == "c3.large")
+            {
+              return EC2InstanceType::c3_large;
+            }
+            break;
+          case c3_xlarge_HASH:
+            if (name == "c3.xlarge")
+            {
+              return EC2InstanceType::c3_xlarge;
+            }
+            break;
+          case c3_2xlarge_HASH:
+            if (name == "c3.2xlarge")
+            {
+              return EC2InstanceType::c3_2xlarge;
+            }
+            break;
+          case c3_4xlarge_HASH:
+            if (name == "c3.4xlarge")
+            {
+              return EC2InstanceType::c3_4xlarge;
+            }
+            break;
+          case c3_8xlarge_HASH:
+            if (name == "c3.8xlarge")
+            {
+              return EC2InstanceType::c3_8xlarge;
+            }
+            break;
+          case c4_large_HASH:
+            if (name == "c4.large")
+            {
+              return EC2InstanceType::c4_large;
+            }
+            break;
+          case c4_xlarge_HASH:
+            if (name == "c4.xlarge")
+            {
+              return EC2InstanceType::c4_xlarge;
+            }
+            break;
+          case c4_2xlarge_HASH:
+            if (name == "c4.2xlarge")
+            {
+              return EC2InstanceType::c4_2xlarge;
+            }
+            break;
+          case c4_4xlarge_HASH:
+            if (name == "c4.4xlarge")
+            {
+              return EC2InstanceType::c4_4xlarge;
+            }
+            break;
+          case c4_8xlarge_HASH:
+            if (name == "c4.8xlarge")
+            {
+              return EC2InstanceType::c4_8xlarge;
+            }
+            break;
+          case r3_large_HASH:
+            if (name == "r3.large")
+            {
+              return EC2InstanceType::r3_large;
+            }
+            break;
+          case r3_xlarge_HASH:
+            if (name == "r3.xlarge")
+            {
+              return EC2InstanceType::r3_xlarge;
+            }
+            break;
+          case r3_2xlarge_HASH:
+            if (name == "r3.2xlarge")
+            {
+              return EC2InstanceType::r3_2xlarge;
+            }
+            break;
+          case r3_4xlarge_HASH:
+            if (name == "r3.4xlarge")
+            {
+              return EC2InstanceType::r3_4xlarge;
+            }
+            break;
+          case r3_8xlarge_HASH:
+            if (name == "r3.8xlarge")
+            {
+              return EC2InstanceType::r3_8xlarge;
+            }
+            break;
+          case r4_large_HASH:
+            if (name == "r4.large")
+            {
+              return EC2InstanceType::r4_large;
+            }
+            break;
+          case r4_xlarge_HASH:
+            if (name == "r4.xlarge")
+            {
+              return EC2InstanceType::r4_xlarge;
+            }
+            break;
+          case r4_2xlarge_HASH:
+            if (name == "r4.2xlarge")
+            {
+              return EC2InstanceType::r4_2xlarge;
+            }
+            break;
+          case r4_4xlarge_HASH:
+            if (name == "r4.4xlarge")
+            {
+              return EC2InstanceType::r4_4xlarge;
+            }
+            break;
+          case r4_8xlarge_HASH:
+            if (name == "r4.8xlarge")
+            {
+              return EC2InstanceType::r4_8xlarge;
+            }
+            break;
+          case r4_16xlarge_HASH:
+            if (name == "r4.16xlarge")
+            {
+              return EC2InstanceType::r4_16xlarge;
+            }
+            break;
+          case m3_medium_HASH:
+            if (name == "m3.medium")
+            {
+              return EC2InstanceType::m3_medium;
+            }
+            break;
+          case m3_large_HASH:
+            if (name == "m3.large")
+            {
+              return EC2InstanceType::m3_large;
+            }
+            break;
+          case m3_xlarge_HASH:
+            if (name == "m3.xlarge")
+            {
+              return EC2InstanceType::m3_xlarge;
+            }
+            break;
+          case m3_2xlarge_HASH:
+            if (name == "m3.2xlarge")
+            {
+              return EC2InstanceType::m3_2xlarge;
+            }
+            break;
+          case m4_large_HASH:
+            if (name == "m4.large")
+            {
+              return EC2InstanceType::m4_large;
+            }
+            break;
+          case m4_xlarge_HASH:
+            if (name == "m4.xlarge")
+            {
+              return EC2InstanceType::m4_xlarge;
+            }
+            break;
+          case m4_2xlarge_HASH:
+            if (name == "m4.2xlarge")
+            {
+              return EC2InstanceType::m4_2xlarge;
+            }
+            break;
+          case m4_4xlarge_HASH:
+            if (name == "m4.4xlarge")
+            {
+              return EC2InstanceType::m4_4xlarge;
+            }
+            break;
+          case m4_10xlarge_HASH:
+            if (name == "m4.10xlarge")
+            {
+              return EC2InstanceType::m4_10xlarge;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -215,7 +289,7 @@ namespace Aws
           return EC2InstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForEC2InstanceType(EC2InstanceType enumValue)
+        const char* GetNameForEC2InstanceType(EC2InstanceType enumValue)
         {
           switch(enumValue)
           {
@@ -291,7 +365,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
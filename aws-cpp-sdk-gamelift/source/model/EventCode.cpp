@@ -30,175 +30,247 @@ namespace Aws
       namespace EventCodeMapper
       {
 
-        static const int GENERIC_EVENT_HASH = HashingUtils::HashString("GENERIC_EVENT");
-        static const int FLEET_CREATED_HASH = HashingUtils::HashString("FLEET_CREATED");
-        static const int FLEET_DELETED_HASH = HashingUtils::HashString("FLEET_DELETED");
-        static const int FLEET_SCALING_EVENT_HASH = HashingUtils::HashString("FLEET_SCALING_EVENT");
-        static const int FLEET_STATE_DOWNLOADING_HASH = HashingUtils::HashString("FLEET_STATE_DOWNLOADING");
-        static const int FLEET_STATE_VALIDATING_HASH = HashingUtils::HashString("FLEET_STATE_VALIDATING");
-        static const int FLEET_STATE_BUILDING_HASH = HashingUtils::HashString("FLEET_STATE_BUILDING");
-        static const int FLEET_STATE_ACTIVATING_HASH = HashingUtils::HashString("FLEET_STATE_ACTIVATING");
-        static const int FLEET_STATE_ACTIVE_HASH = HashingUtils::HashString("FLEET_STATE_ACTIVE");
-        static const int FLEET_STATE_ERROR_HASH = HashingUtils::HashString("FLEET_STATE_ERROR");
-        static const int FLEET_INITIALIZATION_FAILED_HASH = HashingUtils::HashString("FLEET_INITIALIZATION_FAILED");
-        static const int FLEET_BINARY_DOWNLOAD_FAILED_HASH = HashingUtils::HashString("FLEET_BINARY_DOWNLOAD_FAILED");
-        static const int FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND_HASH = HashingUtils::HashString("FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND");
-        static const int FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE_HASH = HashingUtils::HashString("FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE");
-        static const int FLEET_VALIDATION_TIMED_OUT_HASH = HashingUtils::HashString("FLEET_VALIDATION_TIMED_OUT");
-        static const int FLEET_ACTIVATION_FAILED_HASH = HashingUtils::HashString("FLEET_ACTIVATION_FAILED");
-        static const int FLEET_ACTIVATION_FAILED_NO_INSTANCES_HASH = HashingUtils::HashString("FLEET_ACTIVATION_FAILED_NO_INSTANCES");
-        static const int FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED_HASH = HashingUtils::HashString("FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED");
-        static const int SERVER_PROCESS_INVALID_PATH_HASH = HashingUtils::HashString("SERVER_PROCESS_INVALID_PATH");
-        static const int SERVER_PROCESS_SDK_INITIALIZATION_TIMEOUT_HASH = HashingUtils::HashString("SERVER_PROCESS_SDK_INITIALIZATION_TIMEOUT");
-        static const int SERVER_PROCESS_PROCESS_READY_TIMEOUT_HASH = HashingUtils::HashString("SERVER_PROCESS_PROCESS_READY_TIMEOUT");
-        static const int SERVER_PROCESS_CRASHED_HASH = HashingUtils::HashString("SERVER_PROCESS_CRASHED");
-        static const int SERVER_PROCESS_TERMINATED_UNHEALTHY_HASH = HashingUtils::HashString("SERVER_PROCESS_TERMINATED_UNHEALTHY");
-        static const int SERVER_PROCESS_FORCE_TERMINATED_HASH = HashingUtils::HashString("SERVER_PROCESS_FORCE_TERMINATED");
-        static const int SERVER_PROCESS_PROCESS_EXIT_TIMEOUT_HASH = HashingUtils::HashString("SERVER_PROCESS_PROCESS_EXIT_TIMEOUT");
-        static const int GAME_SESSION_ACTIVATION_TIMEOUT_HASH = HashingUtils::HashString("GAME_SESSION_ACTIVATION_TIMEOUT");
-        static const int FLEET_CREATION_EXTRACTING_BUILD_HASH = HashingUtils::HashString("FLEET_CREATION_EXTRACTING_BUILD");
-        static const int FLEET_CREATION_RUNNING_INSTALLER_HASH = HashingUtils::HashString("FLEET_CREATION_RUNNING_INSTALLER");
-        static const int FLEET_CREATION_VALIDATING_RUNTIME_CONFIG_HASH = HashingUtils::HashString("FLEET_CREATION_VALIDATING_RUNTIME_CONFIG");
-        static const int FLEET_VPC_PEERING_SUCCEEDED_HASH = HashingUtils::HashString("FLEET_VPC_PEERING_SUCCEEDED");
-        static const int FLEET_VPC_PEERING_FAILED_HASH = HashingUtils::HashString("FLEET_VPC_PEERING_FAILED");
-        static const int FLEET_VPC_PEERING_DELETED_HASH = HashingUtils::HashString("FLEET_VPC_PEERING_DELETED");
-        static const int INSTANCE_INTERRUPTED_HASH = HashingUtils::HashString("INSTANCE_INTERRUPTED");
+        static constexpr int GENERIC_EVENT_HASH = HashingUtils::CompileTimeHashString("GENERIC_EVENT");
+        static constexpr int FLEET_CREATED_HASH = HashingUtils::CompileTimeHashString("FLEET_CREATED");
+        static constexpr int FLEET_DELETED_HASH = HashingUtils::CompileTimeHashString("FLEET_DELETED");
+        static constexpr int FLEET_SCALING_EVENT_HASH = HashingUtils::CompileTimeHashString("FLEET_SCALING_EVENT");
+        static constexpr int FLEET_STATE_DOWNLOADING_HASH = HashingUtils::CompileTimeHashString("FLEET_STATE_DOWNLOADING");
+        static constexpr int FLEET_STATE_VALIDATING_HASH = HashingUtils::CompileTimeHashString("FLEET_STATE_VALIDATING");
+        static constexpr int FLEET_STATE_BUILDING_HASH = HashingUtils::CompileTimeHashString("FLEET_STATE_BUILDING");
+        static constexpr int FLEET_STATE_ACTIVATING_HASH = HashingUtils::CompileTimeHashString("FLEET_STATE_ACTIVATING");
+        static constexpr int FLEET_STATE_ACTIVE_HASH = HashingUtils::CompileTimeHashString("FLEET_STATE_ACTIVE");
+        static constexpr int FLEET_STATE_ERROR_HASH = HashingUtils::CompileTimeHashString("FLEET_STATE_ERROR");
+        static constexpr int FLEET_INITIALIZATION_FAILED_HASH = HashingUtils::CompileTimeHashString("FLEET_INITIALIZATION_FAILED");
+        static constexpr int FLEET_BINARY_DOWNLOAD_FAILED_HASH = HashingUtils::CompileTimeHashString("FLEET_BINARY_DOWNLOAD_FAILED");
+        static constexpr int FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND");
+        static constexpr int FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE_HASH = HashingUtils::CompileTimeHashString("FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE");
+        static constexpr int FLEET_VALIDATION_TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("FLEET_VALIDATION_TIMED_OUT");
+        static constexpr int FLEET_ACTIVATION_FAILED_HASH = HashingUtils::CompileTimeHashString("FLEET_ACTIVATION_FAILED");
+        static constexpr int FLEET_ACTIVATION_FAILED_NO_INSTANCES_HASH = HashingUtils::CompileTimeHashString("FLEET_ACTIVATION_FAILED_NO_INSTANCES");
+        static constexpr int FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED_HASH = HashingUtils::CompileTimeHashString("FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED");
+        static constexpr int SERVER_PROCESS_INVALID_PATH_HASH = HashingUtils::CompileTimeHashString("SERVER_PROCESS_INVALID_PATH");
+        static constexpr int SERVER_PROCESS_SDK_INITIALIZATION_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("SERVER_PROCESS_SDK_INITIALIZATION_TIMEOUT");
+        static constexpr int SERVER_PROCESS_PROCESS_READY_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("SERVER_PROCESS_PROCESS_READY_TIMEOUT");
+        static constexpr int SERVER_PROCESS_CRASHED_HASH = HashingUtils::CompileTimeHashString("SERVER_PROCESS_CRASHED");
+        static constexpr int SERVER_PROCESS_TERMINATED_UNHEALTHY_HASH = HashingUtils::CompileTimeHashString("SERVER_PROCESS_TERMINATED_UNHEALTHY");
+        static constexpr int SERVER_PROCESS_FORCE_TERMINATED_HASH = HashingUtils::CompileTimeHashString("SERVER_PROCESS_FORCE_TERMINATED");
+        static constexpr int SERVER_PROCESS_PROCESS_EXIT_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("SERVER_PROCESS_PROCESS_EXIT_TIMEOUT");
+        static constexpr int GAME_SESSION_ACTIVATION_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("GAME_SESSION_ACTIVATION_TIMEOUT");
+        static constexpr int FLEET_CREATION_EXTRACTING_BUILD_HASH = HashingUtils::CompileTimeHashString("FLEET_CREATION_EXTRACTING_BUILD");
+        static constexpr int FLEET_CREATION_RUNNING_INSTALLER_HASH = HashingUtils::CompileTimeHashString("FLEET_CREATION_RUNNING_INSTALLER");
+        static constexpr int FLEET_CREATION_VALIDATING_RUNTIME_CONFIG_HASH = HashingUtils::CompileTimeHashString("FLEET_CREATION_VALIDATING_RUNTIME_CONFIG");
+        static constexpr int FLEET_VPC_PEERING_SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("FLEET_VPC_PEERING_SUCCEEDED");
+        static constexpr int FLEET_VPC_PEERING_FAILED_HASH = HashingUtils::CompileTimeHashString("FLEET_VPC_PEERING_FAILED");
+        static constexpr int FLEET_VPC_PEERING_DELETED_HASH = HashingUtils::CompileTimeHashString("FLEET_VPC_PEERING_DELETED");
+        static constexpr int INSTANCE_INTERRUPTED_HASH = HashingUtils::CompileTimeHashString("INSTANCE_INTERRUPTED");
 
 
         EventCode GetEventCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GENERIC_EVENT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventCode::GENERIC_EVENT;
-          }
-          else if (hashCode == FLEET_CREATED_HASH)
-          {
-            return EventCode::FLEET_CREATED;
-          }
-          else if (hashCode == FLEET_DELETED_HASH)
-          {
-            return EventCode::FLEET_DELETED;
-          }
-          else if (hashCode == FLEET_SCALING_EVENT_HASH)
-          {
-            return EventCode::FLEET_SCALING_EVENT;
-          }
-          else if (hashCode == FLEET_STATE_DOWNLOADING_HASH)
-          {
-            return EventCode::FLEET_STATE_DOWNLOADING;
-          }
-          else if (hashCode == FLEET_STATE_VALIDATING_HASH)
-          {
-            return EventCode::FLEET_STATE_VALIDATING;
-          }
-          else if (hashCode == FLEET_STATE_BUILDING_HASH)
-          {
-            return EventCode::FLEET_STATE_BUILDING;
-          }
-          else if (hashCode == FLEET_STATE_ACTIVATING_HASH)
-          {
-            return EventCode::FLEET_STATE_ACTIVATING;
-          }
-          else if (hashCode == FLEET_STATE_ACTIVE_HASH)
-          {
-            return EventCode::FLEET_STATE_ACTIVE;
-          }
-          else if (hashCode == FLEET_STATE_ERROR_HASH)
-          {
-            return EventCode::FLEET_STATE_ERROR;
-          }
-          else if (hashCode == FLEET_INITIALIZATION_FAILED_HASH)
-          {
-            return EventCode::FLEET_INITIALIZATION_FAILED;
-          }
-          else if (hashCode == FLEET_BINARY_DOWNLOAD_FAILED_HASH)
-          {
-            return EventCode::FLEET_BINARY_DOWNLOAD_FAILED;
-          }
-          else if (hashCode == FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND_HASH)
-          {
-            return EventCode::FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND;
-          }
-          else if (hashCode == FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE_HASH)
-          {
-            return EventCode::FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE;
-          }
-          else if (hashCode == FLEET_VALIDATION_TIMED_OUT_HASH)
-          {
-            return EventCode::FLEET_VALIDATION_TIMED_OUT;
-          }
-          else if (hashCode == FLEET_ACTIVATION_FAILED_HASH)
-          {
-            return EventCode::FLEET_ACTIVATION_FAILED;
-          }
-          else if (hashCode == FLEET_ACTIVATION_FAILED_NO_INSTANCES_HASH)
-          {
-            return EventCode::FLEET_ACTIVATION_FAILED_NO_INSTANCES;
-          }
-          else if (hashCode == FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED_HASH)
-          {
-            return EventCode::FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED;
-          }
-          else if (hashCode == SERVER_PROCESS_INVALID_PATH_HASH)
-          {
-            return EventCode::SERVER_PROCESS_INVALID_PATH;
-          }
-          else if (hashCode == SERVER_PROCESS_SDK_INITIALIZATION_TIMEOUT_HASH)
-          {
-            return EventCode::SERVER_PROCESS_SDK_INITIALIZATION_TIMEOUT;
-          }
-          else if (hashCode == SERVER_PROCESS_PROCESS_READY_TIMEOUT_HASH)
-          {
-            return EventCode::SERVER_PROCESS_PROCESS_READY_TIMEOUT;
-          }
-          else if (hashCode == SERVER_PROCESS_CRASHED_HASH)
-          {
-            return EventCode::SERVER_PROCESS_CRASHED;
-          }
-          else if (hashCode == SERVER_PROCESS_TERMINATED_UNHEALTHY_HASH)
-          {
-            return EventCode::SERVER_PROCESS_TERMINATED_UNHEALTHY;
-          }
-          else if (hashCode == SERVER_PROCESS_FORCE_TERMINATED_HASH)
-          {
-            return EventCode::SERVER_PROCESS_FORCE_TERMINATED;
-          }
-          else if (hashCode == SERVER_PROCESS_PROCESS_EXIT_TIMEOUT_HASH)
-          {
-            return EventCode::SERVER_PROCESS_PROCESS_EXIT_TIMEOUT;
-          }
-          else if (hashCode == GAME_SESSION_ACTIVATION_TIMEOUT_HASH)
-          {
-            return EventCode::GAME_SESSION_ACTIVATION_TIMEOUT;
-          }
-          else if (hashCode == FLEET_CREATION_EXTRACTING_BUILD_HASH)
-          {
-            return EventCode::FLEET_CREATION_EXTRACTING_BUILD;
-          }
-          else if (hashCode == FLEET_CREATION_RUNNING_INSTALLER_HASH)
-          {
-            return EventCode::FLEET_CREATION_RUNNING_INSTALLER;
-          }
-          else if (hashCode == FLEET_CREATION_VALIDATING_RUNTIME_CONFIG_HASH)
-          {
-            return EventCode::FLEET_CREATION_VALIDATING_RUNTIME_CONFIG;
-          }
-          else if (hashCode == FLEET_VPC_PEERING_SUCCEEDED_HASH)
-          {
-            return EventCode::FLEET_VPC_PEERING_SUCCEEDED;
-          }
-          else if (hashCode == FLEET_VPC_PEERING_FAILED_HASH)
-          {
-            return EventCode::FLEET_VPC_PEERING_FAILED;
-          }
-          else if (hashCode == FLEET_VPC_PEERING_DELETED_HASH)
-          {
-            return EventCode::FLEET_VPC_PEERING_DELETED;
-          }
-          else if (hashCode == INSTANCE_INTERRUPTED_HASH)
-          {
-            return EventCode::INSTANCE_INTERRUPTED;
+          case GENERIC_EVENT_HASH:
+            if (name == "GENERIC_EVENT")
+            {
+              return EventCode::GENERIC_EVENT;
+            }
+            break;
+          case FLEET_CREATED_HASH:
+            if (name == "FLEET_CREATED")
+            {
+              return EventCode::FLEET_CREATED;
+            }
+            break;
+          case FLEET_DELETED_HASH:
+            if (name == "FLEET_DELETED")
+            {
+              return EventCode::FLEET_DELETED;
+            }
+            break;
+          case FLEET_SCALING_EVENT_HASH:
+            if (name == "FLEET_SCALING_EVENT")
+            {
+              return EventCode::FLEET_SCALING_EVENT;
+            }
+            break;
+          case FLEET_STATE_DOWNLOADING_HASH:
+            if (name == "FLEET_STATE_DOWNLOADING")
+            {
+              return EventCode::FLEET_STATE_DOWNLOADING;
+            }
+            break;
+          case FLEET_STATE_VALIDATING_HASH:
+            if (name == "FLEET_STATE_VALIDATING")
+            {
+              return EventCode::FLEET_STATE_VALIDATING;
+            }
+            break;
+          case FLEET_STATE_BUILDING_HASH:
+            if (name == "FLEET_STATE_BUILDING")
+            {
+              return EventCode::FLEET_STATE_BUILDING;
+            }
+            break;
+          case FLEET_STATE_ACTIVATING_HASH:
+            if (name == "FLEET_STATE_ACTIVATING")
+            {
+              return EventCode::FLEET_STATE_ACTIVATING;
+            }
+            break;
+          case FLEET_STATE_ACTIVE_HASH:
+            if (name == "FLEET_STATE_ACTIVE")
+            {
+              return EventCode::FLEET_STATE_ACTIVE;
+            }
+            break;
+          case FLEET_STATE_ERROR_HASH:
+            if (name == "FLEET_STATE_ERROR")
+            {
+              return EventCode::FLEET_STATE_ERROR;
+            }
+            break;
+          case FLEET_INITIALIZATION_FAILED_HASH:
+            if (name == "FLEET_INITIALIZATION_FAILED")
+            {
+              return EventCode::FLEET_INITIALIZATION_FAILED;
+            }
+            break;
+          case FLEET_BINARY_DOWNLOAD_FAILED_HASH:
+            if (name == "FLEET_BINARY_DOWNLOAD_FAILED")
+            {
+              return EventCode::FLEET_BINARY_DOWNLOAD_FAILED;
+            }
+            break;
+          case FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND_HASH:
+            if (name == "FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND")
+            {
+              return EventCode::FLEET_VALIDATION_LAUNCH_PATH_NOT_FOUND;
+            }
+            break;
+          case FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE_HASH:
+            if (name == "FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE")
+            {
+              return EventCode::FLEET_VALIDATION_EXECUTABLE_RUNTIME_FAILURE;
+            }
+            break;
+          case FLEET_VALIDATION_TIMED_OUT_HASH:
+            if (name == "FLEET_VALIDATION_TIMED_OUT")
+            {
+              return EventCode::FLEET_VALIDATION_TIMED_OUT;
+            }
+            break;
+          case FLEET_ACTIVATION_FAILED_HASH:
+            if (name == "FLEET_ACTIVATION_FAILED")
+            {
+              return EventCode::FLEET_ACTIVATION_FAILED;
+            }
+            break;
+          case FLEET_ACTIVATION_FAILED_NO_INSTANCES_HASH:
+            if (name == "FLEET_ACTIVATION_FAILED_NO_INSTANCES")
+            {
+              return EventCode::FLEET_ACTIVATION_FAILED_NO_INSTANCES;
+            }
+            break;
+          case FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED_HASH:
+            if (name == "FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED")
+            {
+              return EventCode::FLEET_NEW_GAME_SESSION_PROTECTION_POLICY_UPDATED;
+            }
+            break;
+          case SERVER_PROCESS_INVALID_PATH_HASH:
+            if (name == "SERVER_PROCESS_INVALID_PATH")
+            {
+              return EventCode::SERVER_PROCESS_INVALID_PATH;
+            }
+            break;
+          case SERVER_PROCESS_SDK_INITIALIZATION_TIMEOUT_HASH:
+            if (name == "SERVER_PROCESS_SDK_INITIALIZATION_TIMEOUT")
+            {
+              return EventCode::SERVER_PROCESS_SDK_INITIALIZATION_TIMEOUT;
+            }
+            break;
+          case SERVER_PROCESS_PROCESS_READY_TIMEOUT_HASH:
+            if (name == "SERVER_PROCESS_PROCESS_READY_TIMEOUT")
+            {
+              return EventCode::SERVER_PROCESS_PROCESS_READY_TIMEOUT;
+            }
+            break;
+          case SERVER_PROCESS_CRASHED_HASH:
+            if (name == "SERVER_PROCESS_CRASHED")
+            {
+              return EventCode::SERVER_PROCESS_CRASHED;
+            }
+            break;
+          case SERVER_PROCESS_TERMINATED_UNHEALTHY_HASH:
+            if (name == "SERVER_PROCESS_TERMINATED_UNHEALTHY")
+            {
+              return EventCode::SERVER_PROCESS_TERMINATED_UNHEALTHY;
+            }
+            break;
+          case SERVER_PROCESS_FORCE_TERMINATED_HASH:
+            if (name == "SERVER_PROCESS_FORCE_TERMINATED")
+            {
+              return EventCode::SERVER_PROCESS_FORCE_TERMINATED;
+            }
+            break;
+          case SERVER_PROCESS_PROCESS_EXIT_TIMEOUT_HASH:
+            if (name == "SERVER_PROCESS_PROCESS_EXIT_TIMEOUT")
+            {
+              return EventCode::SERVER_PROCESS_PROCESS_EXIT_TIMEOUT;
+            }
+            break;
+          case GAME_SESSION_ACTIVATION_TIMEOUT_HASH:
+            if (name == "GAME_SESSION_ACTIVATION_TIMEOUT")
+            {
+              return EventCode::GAME_SESSION_ACTIVATION_TIMEOUT;
+            }
+            break;
+          case FLEET_CREATION_EXTRACTING_BUILD_HASH:
+            if (name == "FLEET_CREATION_EXTRACTING_BUILD")
+            {
+              return EventCode::FLEET_CREATION_EXTRACTING_BUILD;
+            }
+            break;
+          case FLEET_CREATION_RUNNING_INSTALLER_HASH:
+            if (name == "FLEET_CREATION_RUNNING_INSTALLER")
+            {
+              return EventCode::FLEET_CREATION_RUNNING_INSTALLER;
+            }
+            break;
+          case FLEET_CREATION_VALIDATING_RUNTIME_CONFIG_HASH:
+            if (name == "FLEET_CREATION_VALIDATING_RUNTIME_CONFIG")
+            {
+              return EventCode::FLEET_CREATION_VALIDATING_RUNTIME_CONFIG;
+            }
+            break;
+          case FLEET_VPC_PEERING_SUCCEEDED_HASH:
+            if (name == "FLEET_VPC_PEERING_SUCCEEDED")
+            {
+              return EventCode::FLEET_VPC_PEERING_SUCCEEDED;
+            }
+            break;
+          case FLEET_VPC_PEERING_FAILED_HASH:
+            if (name == "FLEET_VPC_PEERING_FAILED")
+            {
+              return EventCode::FLEET_VPC_PEERING_FAILED;
+            }
+            break;
+          case FLEET_VPC_PEERING_DELETED_HASH:
+            if (name == "FLEET_VPC_PEERING_DELETED")
+            {
+              return EventCode::FLEET_VPC_PEERING_DELETED;
+            }
+            break;
+          case INSTANCE_INTERRUPTED_HASH:
+            if (name == "INSTANCE_INTERRUPTED")
+            {
+              return EventCode::INSTANCE_INTERRUPTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -210,7 +282,7 @@ namespace Aws
           return EventCode::NOT_SET;
         }
 
-        Aws::String GetNameForEventCode(EventCode enumValue)
+        const char* GetNameForEventCode(EventCode enumValue)
         {
           switch(enumValue)
           {
@@ -284,7 +356,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
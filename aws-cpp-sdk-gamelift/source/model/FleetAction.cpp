@@ -30,15 +30,23 @@ namespace Aws
       namespace FleetActionMapper
       {
 
-        static const int AUTO_SCALING_HASH = HashingUtils::HashString("AUTO_SCALING");
+        static constexpr int AUTO_SCALING_HASH = HashingUtils::CompileTimeHashString("AUTO_SCALING");
 
 
         FleetAction GetFleetActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_SCALING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetAction::AUTO_SCALING;
+          case AUTO_SCALING_HASH:
+            if (name == "AUTO_SCALING")
+            {
+              return FleetAction::AUTO_SCALING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return FleetAction::NOT_SET;
         }
 
-        Aws::String GetNameForFleetAction(FleetAction enumValue)
+        const char* GetNameForFleetAction(FleetAction enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
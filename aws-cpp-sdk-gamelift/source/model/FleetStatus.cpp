@@ -30,55 +30,79 @@ namespace Aws
       namespace FleetStatusMapper
       {
 
-        static const int NEW__HASH = HashingUtils::HashString("NEW");
-        static const int DOWNLOADING_HASH = HashingUtils::HashString("DOWNLOADING");
-        static const int VALIDATING_HASH = HashingUtils::HashString("VALIDATING");
-        static const int BUILDING_HASH = HashingUtils::HashString("BUILDING");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
+        static constexpr int NEW__HASH = HashingUtils::CompileTimeHashString("NEW");
+        static constexpr int DOWNLOADING_HASH = HashingUtils::CompileTimeHashString("DOWNLOADING");
+        static constexpr int VALIDATING_HASH = HashingUtils::CompileTimeHashString("VALIDATING");
+        static constexpr int BUILDING_HASH = HashingUtils::CompileTimeHashString("BUILDING");
+        static constexpr int ACTIVATING_HASH = HashingUtils::CompileTimeHashString("ACTIVATING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
 
 
         FleetStatus GetFleetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NEW__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetStatus::NEW_;
-          }
-          else if (hashCode == DOWNLOADING_HASH)
-          {
-            return FleetStatus::DOWNLOADING;
-          }
-          else if (hashCode == VALIDATING_HASH)
-          {
-            return FleetStatus::VALIDATING;
-          }
-          else if (hashCode == BUILDING_HASH)
-          {
-            return FleetStatus::BUILDING;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
-            return FleetStatus::ACTIVATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return FleetStatus::ACTIVE;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return FleetStatus::DELETING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return FleetStatus::ERROR_;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return FleetStatus::TERMINATED;
+          case NEW__HASH:
+            if (name == "NEW")
+            {
+              return FleetStatus::NEW_;
+            }
+            break;
+          case DOWNLOADING_HASH:
+            if (name == "DOWNLOADING")
+            {
+              return FleetStatus::DOWNLOADING;
+            }
+            break;
+          case VALIDATING_HASH:
+            if (name == "VALIDATING")
+            {
+              return FleetStatus::VALIDATING;
+            }
+            break;
+          case BUILDING_HASH:
+            if (name == "BUILDING")
+            {
+              return FleetStatus::BUILDING;
+            }
+            break;
+          case ACTIVATING_HASH:
+            if (name == "ACTIVATING")
+            {
+              return FleetStatus::ACTIVATING;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return FleetStatus::ACTIVE;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return FleetStatus::DELETING;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return FleetStatus::ERROR_;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return FleetStatus::TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return FleetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForFleetStatus(FleetStatus enumValue)
+        const char* GetNameForFleetStatus(FleetStatus enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
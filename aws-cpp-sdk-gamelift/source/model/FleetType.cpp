@@ -30,20 +30,30 @@ namespace Aws
       namespace FleetTypeMapper
       {
 
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
-        static const int SPOT_HASH = HashingUtils::HashString("SPOT");
+        static constexpr int ON_DEMAND_HASH = HashingUtils::CompileTimeHashString("ON_DEMAND");
+        static constexpr int SPOT_HASH = HashingUtils::CompileTimeHashString("SPOT");
 
 
         FleetType GetFleetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ON_DEMAND_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FleetType::ON_DEMAND;
-          }
-          else if (hashCode == SPOT_HASH)
-          {
-            return FleetType::SPOT;
+          case ON_DEMAND_HASH:
+            if (name == "ON_DEMAND")
+            {
+              return FleetType::ON_DEMAND;
+            }
+            break;
+          case SPOT_HASH:
+            if (name == "SPOT")
+            {
+              return FleetType::SPOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FleetType::NOT_SET;
         }
 
-        Aws::String GetNameForFleetType(FleetType enumValue)
+        const char* GetNameForFleetType(FleetType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
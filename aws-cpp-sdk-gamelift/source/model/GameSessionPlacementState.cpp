@@ -30,30 +30,44 @@ namespace Aws
       namespace GameSessionPlacementStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int FULFILLED_HASH = HashingUtils::HashString("FULFILLED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int FULFILLED_HASH = HashingUtils::CompileTimeHashString("FULFILLED");
+        static constexpr int CANCELLED_HASH = HashingUtils::CompileTimeHashString("CANCELLED");
+        static constexpr int TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("TIMED_OUT");
 
 
         GameSessionPlacementState GetGameSessionPlacementStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GameSessionPlacementState::PENDING;
-          }
-          else if (hashCode == FULFILLED_HASH)
-          {
-            return GameSessionPlacementState::FULFILLED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return GameSessionPlacementState::CANCELLED;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return GameSessionPlacementState::TIMED_OUT;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return GameSessionPlacementState::PENDING;
+            }
+            break;
+          case FULFILLED_HASH:
+            if (name == "FULFILLED")
+            {
+              return GameSessionPlacementState::FULFILLED;
+            }
+            break;
+          case CANCELLED_HASH:
+            if (name == "CANCELLED")
+            {
+              return GameSessionPlacementState::CANCELLED;
+            }
+            break;
+          case TIMED_OUT_HASH:
+            if (name == "TIMED_OUT")
+            {
+              return GameSessionPlacementState::TIMED_OUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return GameSessionPlacementState::NOT_SET;
         }
 
-        Aws::String GetNameForGameSessionPlacementState(GameSessionPlacementState enumValue)
+        const char* GetNameForGameSessionPlacementState(GameSessionPlacementState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace GameSessionStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int ACTIVATING_HASH = HashingUtils::CompileTimeHashString("ACTIVATING");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
+        static constexpr int TERMINATING_HASH = HashingUtils::CompileTimeHashString("TERMINATING");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
 
 
         GameSessionStatus GetGameSessionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GameSessionStatus::ACTIVE;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
-            return GameSessionStatus::ACTIVATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return GameSessionStatus::TERMINATED;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return GameSessionStatus::TERMINATING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return GameSessionStatus::ERROR_;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return GameSessionStatus::ACTIVE;
+            }
+            break;
+          case ACTIVATING_HASH:
+            if (name == "ACTIVATING")
+            {
+              return GameSessionStatus::ACTIVATING;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return GameSessionStatus::TERMINATED;
+            }
+            break;
+          case TERMINATING_HASH:
+            if (name == "TERMINATING")
+            {
+              return GameSessionStatus::TERMINATING;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return GameSessionStatus::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return GameSessionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForGameSessionStatus(GameSessionStatus enumValue)
+        const char* GetNameForGameSessionStatus(GameSessionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
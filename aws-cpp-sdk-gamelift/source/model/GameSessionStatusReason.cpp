@@ -30,15 +30,23 @@ namespace Aws
       namespace GameSessionStatusReasonMapper
       {
 
-        static const int INTERRUPTED_HASH = HashingUtils::HashString("INTERRUPTED");
+        static constexpr int INTERRUPTED_HASH = HashingUtils::CompileTimeHashString("INTERRUPTED");
 
 
         GameSessionStatusReason GetGameSessionStatusReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERRUPTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GameSessionStatusReason::INTERRUPTED;
+          case INTERRUPTED_HASH:
+            if (name == "INTERRUPTED")
+            {
+              return GameSessionStatusReason::INTERRUPTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return GameSessionStatusReason::NOT_SET;
         }
 
-        Aws::String GetNameForGameSessionStatusReason(GameSessionStatusReason enumValue)
+        const char* GetNameForGameSessionStatusReason(GameSessionStatusReason enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace IpProtocolMapper
       {
 
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
-        static const int UDP_HASH = HashingUtils::HashString("UDP");
+        static constexpr int TCP_HASH = HashingUtils::CompileTimeHashString("TCP");
+        static constexpr int UDP_HASH = HashingUtils::CompileTimeHashString("UDP");
 
 
         IpProtocol GetIpProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TCP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IpProtocol::TCP;
-          }
-          else if (hashCode == UDP_HASH)
-          {
-            return IpProtocol::UDP;
+          case TCP_HASH:
+            if (name == "TCP")
+            {
+              return IpProtocol::TCP;
+            }
+            break;
+          case UDP_HASH:
+            if (name == "UDP")
+            {
+              return IpProtocol::UDP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return IpProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForIpProtocol(IpProtocol enumValue)
+        const char* GetNameForIpProtocol(IpProtocol enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
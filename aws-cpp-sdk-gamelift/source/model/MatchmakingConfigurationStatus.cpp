@@ -30,50 +30,72 @@ namespace Aws
       namespace MatchmakingConfigurationStatusMapper
       {
 
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int PLACING_HASH = HashingUtils::HashString("PLACING");
-        static const int QUEUED_HASH = HashingUtils::HashString("QUEUED");
-        static const int REQUIRES_ACCEPTANCE_HASH = HashingUtils::HashString("REQUIRES_ACCEPTANCE");
-        static const int SEARCHING_HASH = HashingUtils::HashString("SEARCHING");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
+        static constexpr int CANCELLED_HASH = HashingUtils::CompileTimeHashString("CANCELLED");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int PLACING_HASH = HashingUtils::CompileTimeHashString("PLACING");
+        static constexpr int QUEUED_HASH = HashingUtils::CompileTimeHashString("QUEUED");
+        static constexpr int REQUIRES_ACCEPTANCE_HASH = HashingUtils::CompileTimeHashString("REQUIRES_ACCEPTANCE");
+        static constexpr int SEARCHING_HASH = HashingUtils::CompileTimeHashString("SEARCHING");
+        static constexpr int TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("TIMED_OUT");
 
 
         MatchmakingConfigurationStatus GetMatchmakingConfigurationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CANCELLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MatchmakingConfigurationStatus::CANCELLED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return MatchmakingConfigurationStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return MatchmakingConfigurationStatus::FAILED;
-          }
-          else if (hashCode == PLACING_HASH)
-          {
-            return MatchmakingConfigurationStatus::PLACING;
-          }
-          else if (hashCode == QUEUED_HASH)
-          {
-            return MatchmakingConfigurationStatus::QUEUED;
-          }
-          else if (hashCode == REQUIRES_ACCEPTANCE_HASH)
-          {
-            return MatchmakingConfigurationStatus::REQUIRES_ACCEPTANCE;
-          }
-          else if (hashCode == SEARCHING_HASH)
-          {
-            return MatchmakingConfigurationStatus::SEARCHING;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return MatchmakingConfigurationStatus::TIMED_OUT;
+          case CANCELLED_HASH:
+            if (name == "CANCELLED")
+            {
+              return MatchmakingConfigurationStatus::CANCELLED;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return MatchmakingConfigurationStatus::COMPLETED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return MatchmakingConfigurationStatus::FAILED;
+            }
+            break;
+          case PLACING_HASH:
+            if (name == "PLACING")
+            {
+              return MatchmakingConfigurationStatus::PLACING;
+            }
+            break;
+          case QUEUED_HASH:
+            if (name == "QUEUED")
+            {
+              return MatchmakingConfigurationStatus::QUEUED;
+            }
+            break;
+          case REQUIRES_ACCEPTANCE_HASH:
+            if (name == "REQUIRES_ACCEPTANCE")
+            {
+              return MatchmakingConfigurationStatus::REQUIRES_ACCEPTANCE;
+            }
+            break;
+          case SEARCHING_HASH:
+            if (name == "SEARCHING")
+            {
+              return MatchmakingConfigurationStatus::SEARCHING;
+            }
+            break;
+          case TIMED_OUT_HASH:
+            if (name == "TIMED_OUT")
+            {
+              return MatchmakingConfigurationStatus::TIMED_OUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return MatchmakingConfigurationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForMatchmakingConfigurationStatus(MatchmakingConfigurationStatus enumValue)
+        const char* GetNameForMatchmakingConfigurationStatus(MatchmakingConfigurationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
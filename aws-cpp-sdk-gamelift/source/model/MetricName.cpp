@@ -30,65 +30,93 @@ namespace Aws
       namespace MetricNameMapper
       {
 
-        static const int ActivatingGameSessions_HASH = HashingUtils::HashString("ActivatingGameSessions");
-        static const int ActiveGameSessions_HASH = HashingUtils::HashString("ActiveGameSessions");
-        static const int ActiveInstances_HASH = HashingUtils::HashString("ActiveInstances");
-        static const int AvailableGameSessions_HASH = HashingUtils::HashString("AvailableGameSessions");
-        static const int AvailablePlayerSessions_HASH = HashingUtils::HashString("AvailablePlayerSessions");
-        static const int CurrentPlayerSessions_HASH = HashingUtils::HashString("CurrentPlayerSessions");
-        static const int IdleInstances_HASH = HashingUtils::HashString("IdleInstances");
-        static const int PercentAvailableGameSessions_HASH = HashingUtils::HashString("PercentAvailableGameSessions");
-        static const int PercentIdleInstances_HASH = HashingUtils::HashString("PercentIdleInstances");
-        static const int QueueDepth_HASH = HashingUtils::HashString("QueueDepth");
-        static const int WaitTime_HASH = HashingUtils::HashString("WaitTime");
+        static constexpr int ActivatingGameSessions_HASH = HashingUtils::CompileTimeHashString("ActivatingGameSessions");
+        static constexpr int ActiveGameSessions_HASH = HashingUtils::CompileTimeHashString("ActiveGameSessions");
+        static constexpr int ActiveInstances_HASH = HashingUtils::CompileTimeHashString("ActiveInstances");
+        static constexpr int AvailableGameSessions_HASH = HashingUtils::CompileTimeHashString("AvailableGameSessions");
+        static constexpr int AvailablePlayerSessions_HASH = HashingUtils::CompileTimeHashString("AvailablePlayerSessions");
+        static constexpr int CurrentPlayerSessions_HASH = HashingUtils::CompileTimeHashString("CurrentPlayerSessions");
+        static constexpr int IdleInstances_HASH = HashingUtils::CompileTimeHashString("IdleInstances");
+        static constexpr int PercentAvailableGameSessions_HASH = HashingUtils::CompileTimeHashString("PercentAvailableGameSessions");
+        static constexpr int PercentIdleInstances_HASH = HashingUtils::CompileTimeHashString("PercentIdleInstances");
+        static constexpr int QueueDepth_HASH = HashingUtils::CompileTimeHashString("QueueDepth");
+        static constexpr int WaitTime_HASH = HashingUtils::CompileTimeHashString("WaitTime");
 
 
         MetricName GetMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivatingGameSessions_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MetricName::ActivatingGameSessions;
-          }
-          else if (hashCode == ActiveGameSessions_HASH)
-          {
-            return MetricName::ActiveGameSessions;
-          }
-          else if (hashCode == ActiveInstances_HASH)
-          {
-            return MetricName::ActiveInstances;
-          }
-          else if (hashCode == AvailableGameSessions_HASH)
-          {
-            return MetricName::AvailableGameSessions;
-          }
-          else if (hashCode == AvailablePlayerSessions_HASH)
-          {
-            return MetricName::AvailablePlayerSessions;
-          }
-          else if (hashCode == CurrentPlayerSessions_HASH)
-          {
-            return MetricName::CurrentPlayerSessions;
-          }
-          else if (hashCode == IdleInstances_HASH)
-          {
-            return MetricName::IdleInstances;
-          }
-          else if (hashCode == PercentAvailableGameSessions_HASH)
-          {
-            return MetricName::PercentAvailableGameSessions;
-          }
-          else if (hashCode == PercentIdleInstances_HASH)
-          {
-            return MetricName::PercentIdleInstances;
-          }
-          else if (hashCode == QueueDepth_HASH)
-          {
-            return MetricName::QueueDepth;
-          }
-          else if (hashCode == WaitTime_HASH)
-          {
-            return MetricName::WaitTime;
+          case ActivatingGameSessions_HASH:
+            if (name == "ActivatingGameSessions")
+            {
+              return MetricName::ActivatingGameSessions;
+            }
+            break;
+          case ActiveGameSessions_HASH:
+            if (name == "ActiveGameSessions")
+            {
+              return MetricName::ActiveGameSessions;
+            }
+            break;
+          case ActiveInstances_HASH:
+            if (name == "ActiveInstances")
+            {
+              return MetricName::ActiveInstances;
+            }
+            break;
+          case AvailableGameSessions_HASH:
+            if (name == "AvailableGameSessions")
+            {
+              return MetricName::AvailableGameSessions;
+            }
+            break;
+          case AvailablePlayerSessions_HASH:
+            if (name == "AvailablePlayerSessions")
+            {
+              return MetricName::AvailablePlayerSessions;
+            }
+            break;
+          case CurrentPlayerSessions_HASH:
+            if (name == "CurrentPlayerSessions")
+            {
+              return MetricName::CurrentPlayerSessions;
+            }
+            break;
+          case IdleInstances_HASH:
+            if (name == "IdleInstances")
+            {
+              return MetricName::IdleInstances;
+            }
+            break;
+          case PercentAvailableGameSessions_HASH:
+            if (name == "PercentAvailableGameSessions")
+            {
+              return MetricName::PercentAvailableGameSessions;
+            }
+            break;
+          case PercentIdleInstances_HASH:
+            if (name == "PercentIdleInstances")
+            {
+              return MetricName::PercentIdleInstances;
+            }
+            break;
+          case QueueDepth_HASH:
+            if (name == "QueueDepth")
+            {
+              return MetricName::QueueDepth;
+            }
+            break;
+          case WaitTime_HASH:
+            if (name == "WaitTime")
+            {
+              return MetricName::WaitTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return MetricName::NOT_SET;
         }
 
-        Aws::String GetNameForMetricName(MetricName enumValue)
+        const char* GetNameForMetricName(MetricName enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace OperatingSystemMapper
       {
 
-        static const int WINDOWS_2012_HASH = HashingUtils::HashString("WINDOWS_2012");
-        static const int AMAZON_LINUX_HASH = HashingUtils::HashString("AMAZON_LINUX");
+        static constexpr int WINDOWS_2012_HASH = HashingUtils::CompileTimeHashString("WINDOWS_2012");
+        static constexpr int AMAZON_LINUX_HASH = HashingUtils::CompileTimeHashString("AMAZON_LINUX");
 
 
         OperatingSystem GetOperatingSystemForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_2012_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperatingSystem::WINDOWS_2012;
-          }
-          else if (hashCode == AMAZON_LINUX_HASH)
-          {
-            return OperatingSystem::AMAZON_LINUX;
+          case WINDOWS_2012_HASH:
+            if (name == "WINDOWS_2012")
+            {
+              return OperatingSystem::WINDOWS_2012;
+            }
+            break;
+          case AMAZON_LINUX_HASH:
+            if (name == "AMAZON_LINUX")
+            {
+              return OperatingSystem::AMAZON_LINUX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OperatingSystem::NOT_SET;
         }
 
-        Aws::String GetNameForOperatingSystem(OperatingSystem enumValue)
+        const char* GetNameForOperatingSystem(OperatingSystem enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
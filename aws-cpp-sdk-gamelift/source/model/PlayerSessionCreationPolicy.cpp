@@ -30,20 +30,30 @@ namespace Aws
       namespace PlayerSessionCreationPolicyMapper
       {
 
-        static const int ACCEPT_ALL_HASH = HashingUtils::HashString("ACCEPT_ALL");
-        static const int DENY_ALL_HASH = HashingUtils::HashString("DENY_ALL");
+        static constexpr int ACCEPT_ALL_HASH = HashingUtils::CompileTimeHashString("ACCEPT_ALL");
+        static constexpr int DENY_ALL_HASH = HashingUtils::CompileTimeHashString("DENY_ALL");
 
 
         PlayerSessionCreationPolicy GetPlayerSessionCreationPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCEPT_ALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlayerSessionCreationPolicy::ACCEPT_ALL;
-          }
-          else if (hashCode == DENY_ALL_HASH)
-          {
-            return PlayerSessionCreationPolicy::DENY_ALL;
+          case ACCEPT_ALL_HASH:
+            if (name == "ACCEPT_ALL")
+            {
+              return PlayerSessionCreationPolicy::ACCEPT_ALL;
+            }
+            break;
+          case DENY_ALL_HASH:
+            if (name == "DENY_ALL")
+            {
+              return PlayerSessionCreationPolicy::DENY_ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PlayerSessionCreationPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForPlayerSessionCreationPolicy(PlayerSessionCreationPolicy enumValue)
+        const char* GetNameForPlayerSessionCreationPolicy(PlayerSessionCreationPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace PlayerSessionStatusMapper
       {
 
-        static const int RESERVED_HASH = HashingUtils::HashString("RESERVED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int TIMEDOUT_HASH = HashingUtils::HashString("TIMEDOUT");
+        static constexpr int RESERVED_HASH = HashingUtils::CompileTimeHashString("RESERVED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int TIMEDOUT_HASH = HashingUtils::CompileTimeHashString("TIMEDOUT");
 
 
         PlayerSessionStatus GetPlayerSessionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RESERVED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlayerSessionStatus::RESERVED;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return PlayerSessionStatus::ACTIVE;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return PlayerSessionStatus::COMPLETED;
-          }
-          else if (hashCode == TIMEDOUT_HASH)
-          {
-            return PlayerSessionStatus::TIMEDOUT;
+          case RESERVED_HASH:
+            if (name == "RESERVED")
+            {
+              return PlayerSessionStatus::RESERVED;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return PlayerSessionStatus::ACTIVE;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return PlayerSessionStatus::COMPLETED;
+            }
+            break;
+          case TIMEDOUT_HASH:
+            if (name == "TIMEDOUT")
+            {
+              return PlayerSessionStatus::TIMEDOUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return PlayerSessionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPlayerSessionStatus(PlayerSessionStatus enumValue)
+        const char* GetNameForPlayerSessionStatus(PlayerSessionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
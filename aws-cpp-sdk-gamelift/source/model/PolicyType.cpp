@@ -30,20 +30,30 @@ namespace Aws
       namespace PolicyTypeMapper
       {
 
-        static const int RuleBased_HASH = HashingUtils::HashString("RuleBased");
-        static const int TargetBased_HASH = HashingUtils::HashString("TargetBased");
+        static constexpr int RuleBased_HASH = HashingUtils::CompileTimeHashString("RuleBased");
+        static constexpr int TargetBased_HASH = HashingUtils::CompileTimeHashString("TargetBased");
 
 
         PolicyType GetPolicyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RuleBased_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PolicyType::RuleBased;
-          }
-          else if (hashCode == TargetBased_HASH)
-          {
-            return PolicyType::TargetBased;
+          case RuleBased_HASH:
+            if (name == "RuleBased")
+            {
+              return PolicyType::RuleBased;
+            }
+            break;
+          case TargetBased_HASH:
+            if (name == "TargetBased")
+            {
+              return PolicyType::TargetBased;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PolicyType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyType(PolicyType enumValue)
+        const char* GetNameForPolicyType(PolicyType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
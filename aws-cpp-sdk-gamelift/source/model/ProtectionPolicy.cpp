@@ -30,20 +30,30 @@ namespace Aws
       namespace ProtectionPolicyMapper
       {
 
-        static const int NoProtection_HASH = HashingUtils::HashString("NoProtection");
-        static const int FullProtection_HASH = HashingUtils::HashString("FullProtection");
+        static constexpr int NoProtection_HASH = HashingUtils::CompileTimeHashString("NoProtection");
+        static constexpr int FullProtection_HASH = HashingUtils::CompileTimeHashString("FullProtection");
 
 
         ProtectionPolicy GetProtectionPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NoProtection_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProtectionPolicy::NoProtection;
-          }
-          else if (hashCode == FullProtection_HASH)
-          {
-            return ProtectionPolicy::FullProtection;
+          case NoProtection_HASH:
+            if (name == "NoProtection")
+            {
+              return ProtectionPolicy::NoProtection;
+            }
+            break;
+          case FullProtection_HASH:
+            if (name == "FullProtection")
+            {
+              return ProtectionPolicy::FullProtection;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ProtectionPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForProtectionPolicy(ProtectionPolicy enumValue)
+        const char* GetNameForProtectionPolicy(ProtectionPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace RoutingStrategyTypeMapper
       {
 
-        static const int SIMPLE_HASH = HashingUtils::HashString("SIMPLE");
-        static const int TERMINAL_HASH = HashingUtils::HashString("TERMINAL");
+        static constexpr int SIMPLE_HASH = HashingUtils::CompileTimeHashString("SIMPLE");
+        static constexpr int TERMINAL_HASH = HashingUtils::CompileTimeHashString("TERMINAL");
 
 
         RoutingStrategyType GetRoutingStrategyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIMPLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RoutingStrategyType::SIMPLE;
-          }
-          else if (hashCode == TERMINAL_HASH)
-          {
-            return RoutingStrategyType::TERMINAL;
+          case SIMPLE_HASH:
+            if (name == "SIMPLE")
+            {
+              return RoutingStrategyType::SIMPLE;
+            }
+            break;
+          case TERMINAL_HASH:
+            if (name == "TERMINAL")
+            {
+              return RoutingStrategyType::TERMINAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RoutingStrategyType::NOT_SET;
         }
 
-        Aws::String GetNameForRoutingStrategyType(RoutingStrategyType enumValue)
+        const char* GetNameForRoutingStrategyType(RoutingStrategyType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
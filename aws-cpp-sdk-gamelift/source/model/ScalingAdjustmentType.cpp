@@ -30,25 +30,37 @@ namespace Aws
       namespace ScalingAdjustmentTypeMapper
       {
 
-        static const int ChangeInCapacity_HASH = HashingUtils::HashString("ChangeInCapacity");
-        static const int ExactCapacity_HASH = HashingUtils::HashString("ExactCapacity");
-        static const int PercentChangeInCapacity_HASH = HashingUtils::HashString("PercentChangeInCapacity");
+        static constexpr int ChangeInCapacity_HASH = HashingUtils::CompileTimeHashString("ChangeInCapacity");
+        static constexpr int ExactCapacity_HASH = HashingUtils::CompileTimeHashString("ExactCapacity");
+        static constexpr int PercentChangeInCapacity_HASH = HashingUtils::CompileTimeHashString("PercentChangeInCapacity");
 
 
         ScalingAdjustmentType GetScalingAdjustmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ChangeInCapacity_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalingAdjustmentType::ChangeInCapacity;
-          }
-          else if (hashCode == ExactCapacity_HASH)
-          {
-            return ScalingAdjustmentType::ExactCapacity;
-          }
-          else if (hashCode == PercentChangeInCapacity_HASH)
-          {
-            return ScalingAdjustmentType::PercentChangeInCapacity;
+          case ChangeInCapacity_HASH:
+            if (name == "ChangeInCapacity")
+            {
+              return ScalingAdjustmentType::ChangeInCapacity;
+            }
+            break;
+          case ExactCapacity_HASH:
+            if (name == "ExactCapacity")
+            {
+              return ScalingAdjustmentType::ExactCapacity;
+            }
+            break;
+          case PercentChangeInCapacity_HASH:
+            if (name == "PercentChangeInCapacity")
+            {
+              return ScalingAdjustmentType::PercentChangeInCapacity;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ScalingAdjustmentType::NOT_SET;
         }
 
-        Aws::String GetNameForScalingAdjustmentType(ScalingAdjustmentType enumValue)
+        const char* GetNameForScalingAdjustmentType(ScalingAdjustmentType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
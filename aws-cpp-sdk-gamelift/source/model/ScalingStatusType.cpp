@@ -30,45 +30,65 @@ namespace Aws
       namespace ScalingStatusTypeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int UPDATE_REQUESTED_HASH = HashingUtils::HashString("UPDATE_REQUESTED");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETE_REQUESTED_HASH = HashingUtils::HashString("DELETE_REQUESTED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int UPDATE_REQUESTED_HASH = HashingUtils::CompileTimeHashString("UPDATE_REQUESTED");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
+        static constexpr int DELETE_REQUESTED_HASH = HashingUtils::CompileTimeHashString("DELETE_REQUESTED");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
 
 
         ScalingStatusType GetScalingStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalingStatusType::ACTIVE;
-          }
-          else if (hashCode == UPDATE_REQUESTED_HASH)
-          {
-            return ScalingStatusType::UPDATE_REQUESTED;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return ScalingStatusType::UPDATING;
-          }
-          else if (hashCode == DELETE_REQUESTED_HASH)
-          {
-            return ScalingStatusType::DELETE_REQUESTED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ScalingStatusType::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ScalingStatusType::DELETED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return ScalingStatusType::ERROR_;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ScalingStatusType::ACTIVE;
+            }
+            break;
+          case UPDATE_REQUESTED_HASH:
+            if (name == "UPDATE_REQUESTED")
+            {
+              return ScalingStatusType::UPDATE_REQUESTED;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return ScalingStatusType::UPDATING;
+            }
+            break;
+          case DELETE_REQUESTED_HASH:
+            if (name == "DELETE_REQUESTED")
+            {
+              return ScalingStatusType::DELETE_REQUESTED;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ScalingStatusType::DELETING;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return ScalingStatusType::DELETED;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return ScalingStatusType::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return ScalingStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForScalingStatusType(ScalingStatusType enumValue)
+        const char* GetNameForScalingStatusType(ScalingStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
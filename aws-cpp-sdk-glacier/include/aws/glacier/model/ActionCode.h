@@ -35,7 +35,8 @@ namespace ActionCodeMapper
 {
 AWS_GLACIER_API ActionCode GetActionCodeForName(const Aws::String& name);
 
-AWS_GLACIER_API Aws::String GetNameForActionCode(ActionCode value);
+// names of values not modeled point into the enum overflow container
+AWS_GLACIER_API const char* GetNameForActionCode(ActionCode value);
 } // namespace ActionCodeMapper
 } // namespace Model
 } // namespace Glacier
@@ -39,7 +39,8 @@ namespace CannedACLMapper
 {
 AWS_GLACIER_API CannedACL GetCannedACLForName(const Aws::String& name);
 
-AWS_GLACIER_API Aws::String GetNameForCannedACL(CannedACL value);
+// names of values not modeled point into the enum overflow container
+AWS_GLACIER_API const char* GetNameForCannedACL(CannedACL value);
 } // namespace CannedACLMapper
 } // namespace Model
 } // namespace Glacier
@@ -35,7 +35,8 @@ namespace FileHeaderInfoMapper
 {
 AWS_GLACIER_API FileHeaderInfo GetFileHeaderInfoForName(const Aws::String& name);
 
-AWS_GLACIER_API Aws::String GetNameForFileHeaderInfo(FileHeaderInfo value);
+// names of values not modeled point into the enum overflow container
+AWS_GLACIER_API const char* GetNameForFileHeaderInfo(FileHeaderInfo value);
 } // namespace FileHeaderInfoMapper
 } // namespace Model
 } // namespace Glacier
@@ -37,7 +37,8 @@ namespace PermissionMapper
 {
 AWS_GLACIER_API Permission GetPermissionForName(const Aws::String& name);
 
-AWS_GLACIER_API Aws::String GetNameForPermission(Permission value);
+// names of values not modeled point into the enum overflow container
+AWS_GLACIER_API const char* GetNameForPermission(Permission value);
 } // namespace PermissionMapper
 } // namespace Model
 } // namespace Glacier
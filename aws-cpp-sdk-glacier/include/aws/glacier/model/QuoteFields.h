@@ -34,7 +34,8 @@ namespace QuoteFieldsMapper
 {
 AWS_GLACIER_API QuoteFields GetQuoteFieldsForName(const Aws::String& name);
 
-AWS_GLACIER_API Aws::String GetNameForQuoteFields(QuoteFields value);
+// names of values not modeled point into the enum overflow container
+AWS_GLACIER_API const char* GetNameForQuoteFields(QuoteFields value);
 } // namespace QuoteFieldsMapper
 } // namespace Model
 } // namespace Glacier
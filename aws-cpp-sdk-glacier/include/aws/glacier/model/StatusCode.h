@@ -35,7 +35,8 @@ namespace StatusCodeMapper
 {
 AWS_GLACIER_API StatusCode GetStatusCodeForName(const Aws::String& name);
 
-AWS_GLACIER_API Aws::String GetNameForStatusCode(StatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_GLACIER_API const char* GetNameForStatusCode(StatusCode value);
 } // namespace StatusCodeMapper
 } // namespace Model
 } // namespace Glacier
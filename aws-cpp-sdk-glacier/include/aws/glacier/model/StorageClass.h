@@ -35,7 +35,8 @@ namespace StorageClassMapper
 {
 AWS_GLACIER_API StorageClass GetStorageClassForName(const Aws::String& name);
 
-AWS_GLACIER_API Aws::String GetNameForStorageClass(StorageClass value);
+// names of values not modeled point into the enum overflow container
+AWS_GLACIER_API const char* GetNameForStorageClass(StorageClass value);
 } // namespace StorageClassMapper
 } // namespace Model
 } // namespace Glacier
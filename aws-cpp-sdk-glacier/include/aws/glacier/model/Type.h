@@ -35,7 +35,8 @@ namespace TypeMapper
 {
 AWS_GLACIER_API Type GetTypeForName(const Aws::String& name);
 
-AWS_GLACIER_API Aws::String GetNameForType(Type value);
+// names of values not modeled point into the enum overflow container
+AWS_GLACIER_API const char* GetNameForType(Type value);
 } // namespace TypeMapper
 } // namespace Model
 } // namespace Glacier
@@ -28,11 +28,11 @@ namespace Glacier
 namespace GlacierErrorMapper
 {
 
-static const int REQUEST_TIMEOUT_HASH = HashingUtils::HashString("RequestTimeoutException");
-static const int MISSING_PARAMETER_VALUE_HASH = HashingUtils::HashString("MissingParameterValueException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int POLICY_ENFORCED_HASH = HashingUtils::HashString("PolicyEnforcedException");
-static const int INSUFFICIENT_CAPACITY_HASH = HashingUtils::HashString("InsufficientCapacityException");
+static constexpr int REQUEST_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("RequestTimeoutException");
+static constexpr int MISSING_PARAMETER_VALUE_HASH = HashingUtils::CompileTimeHashString("MissingParameterValueException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int POLICY_ENFORCED_HASH = HashingUtils::CompileTimeHashString("PolicyEnforcedException");
+static constexpr int INSUFFICIENT_CAPACITY_HASH = HashingUtils::CompileTimeHashString("InsufficientCapacityException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
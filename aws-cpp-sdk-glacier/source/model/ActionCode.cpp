@@ -30,25 +30,37 @@ namespace Aws
       namespace ActionCodeMapper
       {
 
-        static const int ArchiveRetrieval_HASH = HashingUtils::HashString("ArchiveRetrieval");
-        static const int InventoryRetrieval_HASH = HashingUtils::HashString("InventoryRetrieval");
-        static const int Select_HASH = HashingUtils::HashString("Select");
+        static constexpr int ArchiveRetrieval_HASH = HashingUtils::CompileTimeHashString("ArchiveRetrieval");
+        static constexpr int InventoryRetrieval_HASH = HashingUtils::CompileTimeHashString("InventoryRetrieval");
+        static constexpr int Select_HASH = HashingUtils::CompileTimeHashString("Select");
 
 
         ActionCode GetActionCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ArchiveRetrieval_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionCode::ArchiveRetrieval;
-          }
-          else if (hashCode == InventoryRetrieval_HASH)
-          {
-            return ActionCode::InventoryRetrieval;
-          }
-          else if (hashCode == Select_HASH)
-          {
-            return ActionCode::Select;
+          case ArchiveRetrieval_HASH:
+            if (name == "ArchiveRetrieval")
+            {
+              return ActionCode::ArchiveRetrieval;
+            }
+            break;
+          case InventoryRetrieval_HASH:
+            if (name == "InventoryRetrieval")
+            {
+              return ActionCode::InventoryRetrieval;
+            }
+            break;
+          case Select_HASH:
+            if (name == "Select")
+            {
+              return ActionCode::Select;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ActionCode::NOT_SET;
         }
 
-        Aws::String GetNameForActionCode(ActionCode enumValue)
+        const char* GetNameForActionCode(ActionCode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace CannedACLMapper
       {
 
-        static const int private__HASH = HashingUtils::HashString("private");
-        static const int public_read_HASH = HashingUtils::HashString("public-read");
-        static const int public_read_write_HASH = HashingUtils::HashString("public-read-write");
-        static const int aws_exec_read_HASH = HashingUtils::HashString("aws-exec-read");
-        static const int authenticated_read_HASH = HashingUtils::HashString("authenticated-read");
-        static const int bucket_owner_read_HASH = HashingUtils::HashString("bucket-owner-read");
-        static const int bucket_owner_full_control_HASH = HashingUtils::HashString("bucket-owner-full-control");
+        static constexpr int private__HASH = HashingUtils::CompileTimeHashString("private");
+        static constexpr int public_read_HASH = HashingUtils::CompileTimeHashString("public-read");
+        static constexpr int public_read_write_HASH = HashingUtils::CompileTimeHashString("public-read-write");
+        static constexpr int aws_exec_read_HASH = HashingUtils::CompileTimeHashString("aws-exec-read");
+        static constexpr int authenticated_read_HASH = HashingUtils::CompileTimeHashString("authenticated-read");
+        static constexpr int bucket_owner_read_HASH = HashingUtils::CompileTimeHashString("bucket-owner-read");
+        static constexpr int bucket_owner_full_control_HASH = HashingUtils::CompileTimeHashString("bucket-owner-full-control");
 
 
         CannedACL GetCannedACLForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == private__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CannedACL::private_;
-          }
-          else if (hashCode == public_read_HASH)
-          {
-            return CannedACL::public_read;
-          }
-          else if (hashCode == public_read_write_HASH)
-          {
-            return CannedACL::public_read_write;
-          }
-          else if (hashCode == aws_exec_read_HASH)
-          {
-            return CannedACL::aws_exec_read;
-          }
-          else if (hashCode == authenticated_read_HASH)
-          {
-            return CannedACL::authenticated_read;
-          }
-          else if (hashCode == bucket_owner_read_HASH)
-          {
-            return CannedACL::bucket_owner_read;
-          }
-          else if (hashCode == bucket_owner_full_control_HASH)
-          {
-            return CannedACL::bucket_owner_full_control;
+          case private__HASH:
+            if (name == "private")
+            {
+              return CannedACL::private_;
+            }
+            break;
+          case public_read_HASH:
+            if (name == "public-read")
+            {
+              return CannedACL::public_read;
+            }
+            break;
+          case public_read_write_HASH:
+            if (name == "public-read-write")
+            {
+              return CannedACL::public_read_write;
+            }
+            break;
+          case aws_exec_read_HASH:
+            if (name == "aws-exec-read")
+            {
+              return CannedACL::aws_exec_read;
+            }
+            break;
+          case authenticated_read_HASH:
+            if (name == "authenticated-read")
+            {
+              return CannedACL::authenticated_read;
+            }
+            break;
+          case bucket_owner_read_HASH:
+            if (name == "bucket-owner-read")
+            {
+              return CannedACL::bucket_owner_read;
+            }
+            break;
+          case bucket_owner_full_control_HASH:
+            if (name == "bucket-owner-full-control")
+            {
+              return CannedACL::bucket_owner_full_control;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return CannedACL::NOT_SET;
         }
 
-        Aws::String GetNameForCannedACL(CannedACL enumValue)
+        const char* GetNameForCannedACL(CannedACL enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
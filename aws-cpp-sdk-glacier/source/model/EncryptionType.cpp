@@ -30,20 +30,30 @@ namespace Aws
       namespace EncryptionTypeMapper
       {
 
-        static const int aws_kms_HASH = HashingUtils::HashString("aws:kms");
-        static const int AES256_HASH = HashingUtils::HashString("AES256");
+        static constexpr int aws_kms_HASH = HashingUtils::CompileTimeHashString("aws:kms");
+        static constexpr int AES256_HASH = HashingUtils::CompileTimeHashString("AES256");
 
 
         EncryptionType GetEncryptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_kms_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EncryptionType::aws_kms;
-          }
-          else if (hashCode == AES256_HASH)
-          {
-            return EncryptionType::AES256;
+          case aws_kms_HASH:
+            if (name == "aws:kms")
+            {
+              return EncryptionType::aws_kms;
+            }
+            break;
+          case AES256_HASH:
+            if (name == "AES256")
+            {
+              return EncryptionType::AES256;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EncryptionType::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionType(EncryptionType enumValue)
+        const char* GetNameForEncryptionType(EncryptionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
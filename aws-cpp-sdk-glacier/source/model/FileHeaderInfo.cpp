@@ -30,25 +30,37 @@ namespace Aws
       namespace FileHeaderInfoMapper
       {
 
-        static const int USE_HASH = HashingUtils::HashString("USE");
-        static const int IGNORE_HASH = HashingUtils::HashString("IGNORE");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int USE_HASH = HashingUtils::CompileTimeHashString("USE");
+        static constexpr int IGNORE_HASH = HashingUtils::CompileTimeHashString("IGNORE");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         FileHeaderInfo GetFileHeaderInfoForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FileHeaderInfo::USE;
-          }
-          else if (hashCode == IGNORE_HASH)
-          {
-            return FileHeaderInfo::IGNORE;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return FileHeaderInfo::NONE;
+          case USE_HASH:
+            if (name == "USE")
+            {
+              return FileHeaderInfo::USE;
+            }
+            break;
+          case IGNORE_HASH:
+            if (name == "IGNORE")
+            {
+              return FileHeaderInfo::IGNORE;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return FileHeaderInfo::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FileHeaderInfo::NOT_SET;
         }
 
-        Aws::String GetNameForFileHeaderInfo(FileHeaderInfo enumValue)
+        const char* GetNameForFileHeaderInfo(FileHeaderInfo enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
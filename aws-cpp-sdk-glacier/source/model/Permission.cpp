@@ -30,35 +30,51 @@ namespace Aws
       namespace PermissionMapper
       {
 
-        static const int FULL_CONTROL_HASH = HashingUtils::HashString("FULL_CONTROL");
-        static const int WRITE_HASH = HashingUtils::HashString("WRITE");
-        static const int WRITE_ACP_HASH = HashingUtils::HashString("WRITE_ACP");
-        static const int READ_HASH = HashingUtils::HashString("READ");
-        static const int READ_ACP_HASH = HashingUtils::HashString("READ_ACP");
+        static constexpr int FULL_CONTROL_HASH = HashingUtils::CompileTimeHashString("FULL_CONTROL");
+        static constexpr int WRITE_HASH = HashingUtils::CompileTimeHashString("WRITE");
+        static constexpr int WRITE_ACP_HASH = HashingUtils::CompileTimeHashString("WRITE_ACP");
+        static constexpr int READ_HASH = HashingUtils::CompileTimeHashString("READ");
+        static constexpr int READ_ACP_HASH = HashingUtils::CompileTimeHashString("READ_ACP");
 
 
         Permission GetPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_CONTROL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Permission::FULL_CONTROL;
-          }
-          else if (hashCode == WRITE_HASH)
-          {
-            return Permission::WRITE;
-          }
-          else if (hashCode == WRITE_ACP_HASH)
-          {
-            return Permission::WRITE_ACP;
-          }
-          else if (hashCode == READ_HASH)
-          {
-            return Permission::READ;
-          }
-          else if (hashCode == READ_ACP_HASH)
-          {
-            return Permission::READ_ACP;
+          case FULL_CONTROL_HASH:
+            if (name == "FULL_CONTROL")
+            {
+              return Permission::FULL_CONTROL;
+            }
+            break;
+          case WRITE_HASH:
+            if (name == "WRITE")
+            {
+              return Permission::WRITE;
+            }
+            break;
+          case WRITE_ACP_HASH:
+            if (name == "WRITE_ACP")
+            {
+              return Permission::WRITE_ACP;
+            }
+            break;
+          case READ_HASH:
+            if (name == "READ")
+            {
+              return Permission::READ;
+            }
+            break;
+          case READ_ACP_HASH:
+            if (name == "READ_ACP")
+            {
+              return Permission::READ_ACP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Permission::NOT_SET;
         }
 
-        Aws::String GetNameForPermission(Permission enumValue)
+        const char* GetNameForPermission(Permission enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
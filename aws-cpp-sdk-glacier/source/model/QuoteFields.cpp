@@ -30,20 +30,30 @@ namespace Aws
       namespace QuoteFieldsMapper
       {
 
-        static const int ALWAYS_HASH = HashingUtils::HashString("ALWAYS");
-        static const int ASNEEDED_HASH = HashingUtils::HashString("ASNEEDED");
+        static constexpr int ALWAYS_HASH = HashingUtils::CompileTimeHashString("ALWAYS");
+        static constexpr int ASNEEDED_HASH = HashingUtils::CompileTimeHashString("ASNEEDED");
 
 
         QuoteFields GetQuoteFieldsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALWAYS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QuoteFields::ALWAYS;
-          }
-          else if (hashCode == ASNEEDED_HASH)
-          {
-            return QuoteFields::ASNEEDED;
+          case ALWAYS_HASH:
+            if (name == "ALWAYS")
+            {
+              return QuoteFields::ALWAYS;
+            }
+            break;
+          case ASNEEDED_HASH:
+            if (name == "ASNEEDED")
+            {
+              return QuoteFields::ASNEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return QuoteFields::NOT_SET;
         }
 
-        Aws::String GetNameForQuoteFields(QuoteFields enumValue)
+        const char* GetNameForQuoteFields(QuoteFields enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
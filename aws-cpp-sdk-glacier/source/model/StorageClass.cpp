@@ -30,25 +30,37 @@ namespace Aws
       namespace StorageClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int REDUCED_REDUNDANCY_HASH = HashingUtils::HashString("REDUCED_REDUNDANCY");
-        static const int STANDARD_IA_HASH = HashingUtils::HashString("STANDARD_IA");
+        static constexpr int STANDARD_HASH = HashingUtils::CompileTimeHashString("STANDARD");
+        static constexpr int REDUCED_REDUNDANCY_HASH = HashingUtils::CompileTimeHashString("REDUCED_REDUNDANCY");
+        static constexpr int STANDARD_IA_HASH = HashingUtils::CompileTimeHashString("STANDARD_IA");
 
 
         StorageClass GetStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StorageClass::STANDARD;
-          }
-          else if (hashCode == REDUCED_REDUNDANCY_HASH)
-          {
-            return StorageClass::REDUCED_REDUNDANCY;
-          }
-          else if (hashCode == STANDARD_IA_HASH)
-          {
-            return StorageClass::STANDARD_IA;
+          case STANDARD_HASH:
+            if (name == "STANDARD")
+            {
+              return StorageClass::STANDARD;
+            }
+            break;
+          case REDUCED_REDUNDANCY_HASH:
+            if (name == "REDUCED_REDUNDANCY")
+            {
+              return StorageClass::REDUCED_REDUNDANCY;
+            }
+            break;
+          case STANDARD_IA_HASH:
+            if (name == "STANDARD_IA")
+            {
+              return StorageClass::STANDARD_IA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return StorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForStorageClass(StorageClass enumValue)
+        const char* GetNameForStorageClass(StorageClass enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace TypeMapper
       {
 
-        static const int AmazonCustomerByEmail_HASH = HashingUtils::HashString("AmazonCustomerByEmail");
-        static const int CanonicalUser_HASH = HashingUtils::HashString("CanonicalUser");
-        static const int Group_HASH = HashingUtils::HashString("Group");
+        static constexpr int AmazonCustomerByEmail_HASH = HashingUtils::CompileTimeHashString("AmazonCustomerByEmail");
+        static constexpr int CanonicalUser_HASH = HashingUtils::CompileTimeHashString("CanonicalUser");
+        static constexpr int Group_HASH = HashingUtils::CompileTimeHashString("Group");
 
 
         Type GetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AmazonCustomerByEmail_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Type::AmazonCustomerByEmail;
-          }
-          else if (hashCode == CanonicalUser_HASH)
-          {
-            return Type::CanonicalUser;
-          }
-          else if (hashCode == Group_HASH)
-          {
-            return Type::Group;
+          case AmazonCustomerByEmail_HASH:
+            if (name == "AmazonCustomerByEmail")
+            {
+              return Type::AmazonCustomerByEmail;
+            }
+            break;
+          case CanonicalUser_HASH:
+            if (name == "CanonicalUser")
+            {
+              return Type::CanonicalUser;
+            }
+            break;
+          case Group_HASH:
+            if (name == "Group")
+            {
+              return Type::Group;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Type::NOT_SET;
         }
 
-        Aws::String GetNameForType(Type enumValue)
+        const char* GetNameForType(Type enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -43,7 +43,8 @@ namespace ConnectionPropertyKeyMapper
 {
 AWS_GLUE_API ConnectionPropertyKey GetConnectionPropertyKeyForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForConnectionPropertyKey(ConnectionPropertyKey value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForConnectionPropertyKey(ConnectionPropertyKey value);
 } // namespace ConnectionPropertyKeyMapper
 } // namespace Model
 } // namespace Glue
@@ -35,7 +35,8 @@ namespace CrawlerStateMapper
 {
 AWS_GLUE_API CrawlerState GetCrawlerStateForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForCrawlerState(CrawlerState value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForCrawlerState(CrawlerState value);
 } // namespace CrawlerStateMapper
 } // namespace Model
 } // namespace Glue
@@ -35,7 +35,8 @@ namespace DeleteBehaviorMapper
 {
 AWS_GLUE_API DeleteBehavior GetDeleteBehaviorForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForDeleteBehavior(DeleteBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForDeleteBehavior(DeleteBehavior value);
 } // namespace DeleteBehaviorMapper
 } // namespace Model
 } // namespace Glue
@@ -39,7 +39,8 @@ namespace JobRunStateMapper
 {
 AWS_GLUE_API JobRunState GetJobRunStateForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForJobRunState(JobRunState value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForJobRunState(JobRunState value);
 } // namespace JobRunStateMapper
 } // namespace Model
 } // namespace Glue
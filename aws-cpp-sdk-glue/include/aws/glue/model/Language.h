@@ -34,7 +34,8 @@ namespace LanguageMapper
 {
 AWS_GLUE_API Language GetLanguageForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForLanguage(Language value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForLanguage(Language value);
 } // namespace LanguageMapper
 } // namespace Model
 } // namespace Glue
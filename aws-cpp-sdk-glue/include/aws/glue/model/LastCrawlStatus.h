@@ -35,7 +35,8 @@ namespace LastCrawlStatusMapper
 {
 AWS_GLUE_API LastCrawlStatus GetLastCrawlStatusForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForLastCrawlStatus(LastCrawlStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForLastCrawlStatus(LastCrawlStatus value);
 } // namespace LastCrawlStatusMapper
 } // namespace Model
 } // namespace Glue
@@ -34,7 +34,8 @@ namespace LogicalMapper
 {
 AWS_GLUE_API Logical GetLogicalForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForLogical(Logical value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForLogical(Logical value);
 } // namespace LogicalMapper
 } // namespace Model
 } // namespace Glue
@@ -33,7 +33,8 @@ namespace LogicalOperatorMapper
 {
 AWS_GLUE_API LogicalOperator GetLogicalOperatorForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForLogicalOperator(LogicalOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForLogicalOperator(LogicalOperator value);
 } // namespace LogicalOperatorMapper
 } // namespace Model
 } // namespace Glue
@@ -35,7 +35,8 @@ namespace PrincipalTypeMapper
 {
 AWS_GLUE_API PrincipalType GetPrincipalTypeForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForPrincipalType(PrincipalType value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForPrincipalType(PrincipalType value);
 } // namespace PrincipalTypeMapper
 } // namespace Model
 } // namespace Glue
@@ -35,7 +35,8 @@ namespace ScheduleStateMapper
 {
 AWS_GLUE_API ScheduleState GetScheduleStateForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForScheduleState(ScheduleState value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForScheduleState(ScheduleState value);
 } // namespace ScheduleStateMapper
 } // namespace Model
 } // namespace Glue
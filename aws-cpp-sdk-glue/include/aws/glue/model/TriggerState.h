@@ -40,7 +40,8 @@ namespace TriggerStateMapper
 {
 AWS_GLUE_API TriggerState GetTriggerStateForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForTriggerState(TriggerState value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForTriggerState(TriggerState value);
 } // namespace TriggerStateMapper
 } // namespace Model
 } // namespace Glue
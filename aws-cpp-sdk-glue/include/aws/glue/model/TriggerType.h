@@ -35,7 +35,8 @@ namespace TriggerTypeMapper
 {
 AWS_GLUE_API TriggerType GetTriggerTypeForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForTriggerType(TriggerType value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForTriggerType(TriggerType value);
 } // namespace TriggerTypeMapper
 } // namespace Model
 } // namespace Glue
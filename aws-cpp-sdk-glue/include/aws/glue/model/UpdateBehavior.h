@@ -34,7 +34,8 @@ namespace UpdateBehaviorMapper
 {
 AWS_GLUE_API UpdateBehavior GetUpdateBehaviorForName(const Aws::String& name);
 
-AWS_GLUE_API Aws::String GetNameForUpdateBehavior(UpdateBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_GLUE_API const char* GetNameForUpdateBehavior(UpdateBehavior value);
 } // namespace UpdateBehaviorMapper
 } // namespace Model
 } // namespace Glue
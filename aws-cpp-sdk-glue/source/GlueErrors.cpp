@@ -28,23 +28,23 @@ namespace Glue
 namespace GlueErrorMapper
 {
 
-static const int OPERATION_TIMEOUT_HASH = HashingUtils::HashString("OperationTimeoutException");
-static const int ALREADY_EXISTS_HASH = HashingUtils::HashString("AlreadyExistsException");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int CRAWLER_NOT_RUNNING_HASH = HashingUtils::HashString("CrawlerNotRunningException");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInputException");
-static const int SCHEDULER_NOT_RUNNING_HASH = HashingUtils::HashString("SchedulerNotRunningException");
-static const int ENTITY_NOT_FOUND_HASH = HashingUtils::HashString("EntityNotFoundException");
-static const int SCHEDULER_TRANSITIONING_HASH = HashingUtils::HashString("SchedulerTransitioningException");
-static const int SCHEDULER_RUNNING_HASH = HashingUtils::HashString("SchedulerRunningException");
-static const int VERSION_MISMATCH_HASH = HashingUtils::HashString("VersionMismatchException");
-static const int INTERNAL_SERVICE_HASH = HashingUtils::HashString("InternalServiceException");
-static const int RESOURCE_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ResourceNumberLimitExceededException");
-static const int CRAWLER_RUNNING_HASH = HashingUtils::HashString("CrawlerRunningException");
-static const int CRAWLER_STOPPING_HASH = HashingUtils::HashString("CrawlerStoppingException");
-static const int NO_SCHEDULE_HASH = HashingUtils::HashString("NoScheduleException");
-static const int CONCURRENT_RUNS_EXCEEDED_HASH = HashingUtils::HashString("ConcurrentRunsExceededException");
-static const int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::HashString("IdempotentParameterMismatchException");
+static constexpr int OPERATION_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("OperationTimeoutException");
+static constexpr int ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("AlreadyExistsException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int CRAWLER_NOT_RUNNING_HASH = HashingUtils::CompileTimeHashString("CrawlerNotRunningException");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInputException");
+static constexpr int SCHEDULER_NOT_RUNNING_HASH = HashingUtils::CompileTimeHashString("SchedulerNotRunningException");
+static constexpr int ENTITY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("EntityNotFoundException");
+static constexpr int SCHEDULER_TRANSITIONING_HASH = HashingUtils::CompileTimeHashString("SchedulerTransitioningException");
+static constexpr int SCHEDULER_RUNNING_HASH = HashingUtils::CompileTimeHashString("SchedulerRunningException");
+static constexpr int VERSION_MISMATCH_HASH = HashingUtils::CompileTimeHashString("VersionMismatchException");
+static constexpr int INTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
+static constexpr int RESOURCE_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceNumberLimitExceededException");
+static constexpr int CRAWLER_RUNNING_HASH = HashingUtils::CompileTimeHashString("CrawlerRunningException");
+static constexpr int CRAWLER_STOPPING_HASH = HashingUtils::CompileTimeHashString("CrawlerStoppingException");
+static constexpr int NO_SCHEDULE_HASH = HashingUtils::CompileTimeHashString("NoScheduleException");
+static constexpr int CONCURRENT_RUNS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ConcurrentRunsExceededException");
+static constexpr int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::CompileTimeHashString("IdempotentParameterMismatchException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,65 +30,93 @@ namespace Aws
       namespace ConnectionPropertyKeyMapper
       {
 
-        static const int HOST_HASH = HashingUtils::HashString("HOST");
-        static const int PORT_HASH = HashingUtils::HashString("PORT");
-        static const int USERNAME_HASH = HashingUtils::HashString("USERNAME");
-        static const int PASSWORD_HASH = HashingUtils::HashString("PASSWORD");
-        static const int JDBC_DRIVER_JAR_URI_HASH = HashingUtils::HashString("JDBC_DRIVER_JAR_URI");
-        static const int JDBC_DRIVER_CLASS_NAME_HASH = HashingUtils::HashString("JDBC_DRIVER_CLASS_NAME");
-        static const int JDBC_ENGINE_HASH = HashingUtils::HashString("JDBC_ENGINE");
-        static const int JDBC_ENGINE_VERSION_HASH = HashingUtils::HashString("JDBC_ENGINE_VERSION");
-        static const int CONFIG_FILES_HASH = HashingUtils::HashString("CONFIG_FILES");
-        static const int INSTANCE_ID_HASH = HashingUtils::HashString("INSTANCE_ID");
-        static const int JDBC_CONNECTION_URL_HASH = HashingUtils::HashString("JDBC_CONNECTION_URL");
+        static constexpr int HOST_HASH = HashingUtils::CompileTimeHashString("HOST");
+        static constexpr int PORT_HASH = HashingUtils::CompileTimeHashString("PORT");
+        static constexpr int USERNAME_HASH = HashingUtils::CompileTimeHashString("USERNAME");
+        static constexpr int PASSWORD_HASH = HashingUtils::CompileTimeHashString("PASSWORD");
+        static constexpr int JDBC_DRIVER_JAR_URI_HASH = HashingUtils::CompileTimeHashString("JDBC_DRIVER_JAR_URI");
+        static constexpr int JDBC_DRIVER_CLASS_NAME_HASH = HashingUtils::CompileTimeHashString("JDBC_DRIVER_CLASS_NAME");
+        static constexpr int JDBC_ENGINE_HASH = HashingUtils::CompileTimeHashString("JDBC_ENGINE");
+        static constexpr int JDBC_ENGINE_VERSION_HASH = HashingUtils::CompileTimeHashString("JDBC_ENGINE_VERSION");
+        static constexpr int CONFIG_FILES_HASH = HashingUtils::CompileTimeHashString("CONFIG_FILES");
+        static constexpr int INSTANCE_ID_HASH = HashingUtils::CompileTimeHashString("INSTANCE_ID");
+        static constexpr int JDBC_CONNECTION_URL_HASH = HashingUtils::CompileTimeHashString("JDBC_CONNECTION_URL");
 
 
         ConnectionPropertyKey GetConnectionPropertyKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HOST_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConnectionPropertyKey::HOST;
-          }
-          else if (hashCode == PORT_HASH)
-          {
-            return ConnectionPropertyKey::PORT;
-          }
-          else if (hashCode == USERNAME_HASH)
-          {
-            return ConnectionPropertyKey::USERNAME;
-          }
-          else if (hashCode == PASSWORD_HASH)
-          {
-            return ConnectionPropertyKey::PASSWORD;
-          }
-          else if (hashCode == JDBC_DRIVER_JAR_URI_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_DRIVER_JAR_URI;
-          }
-          else if (hashCode == JDBC_DRIVER_CLASS_NAME_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_DRIVER_CLASS_NAME;
-          }
-          else if (hashCode == JDBC_ENGINE_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_ENGINE;
-          }
-          else if (hashCode == JDBC_ENGINE_VERSION_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_ENGINE_VERSION;
-          }
-          else if (hashCode == CONFIG_FILES_HASH)
-          {
-            return ConnectionPropertyKey::CONFIG_FILES;
-          }
-          else if (hashCode == INSTANCE_ID_HASH)
-          {
-            return ConnectionPropertyKey::INSTANCE_ID;
-          }
-          else if (hashCode == JDBC_CONNECTION_URL_HASH)
-          {
-            return ConnectionPropertyKey::JDBC_CONNECTION_URL;
+          case HOST_HASH:
+            if (name == "HOST")
+            {
+              return ConnectionPropertyKey::HOST;
+            }
+            break;
+          case PORT_HASH:
+            if (name == "PORT")
+            {
+              return ConnectionPropertyKey::PORT;
+            }
+            break;
+          case USERNAME_HASH:
+            if (name == "USERNAME")
+            {
+              return ConnectionPropertyKey::USERNAME;
+            }
+            break;
+          case PASSWORD_HASH:
+            if (name == "PASSWORD")
+            {
+              return ConnectionPropertyKey::PASSWORD;
+            }
+            break;
+          case JDBC_DRIVER_JAR_URI_HASH:
+            if (name == "JDBC_DRIVER_JAR_URI")
+            {
+              return ConnectionPropertyKey::JDBC_DRIVER_JAR_URI;
+            }
+            break;
+          case JDBC_DRIVER_CLASS_NAME_HASH:
+            if (name == "JDBC_DRIVER_CLASS_NAME")
+            {
+              return ConnectionPropertyKey::JDBC_DRIVER_CLASS_NAME;
+            }
+            break;
+          case JDBC_ENGINE_HASH:
+            if (name == "JDBC_ENGINE")
+            {
+              return ConnectionPropertyKey::JDBC_ENGINE;
+            }
+            break;
+          case JDBC_ENGINE_VERSION_HASH:
+            if (name == "JDBC_ENGINE_VERSION")
+            {
+              return ConnectionPropertyKey::JDBC_ENGINE_VERSION;
+            }
+            break;
+          case CONFIG_FILES_HASH:
+            if (name == "CONFIG_FILES")
+            {
+              return ConnectionPropertyKey::CONFIG_FILES;
+            }
+            break;
+          case INSTANCE_ID_HASH:
+            if (name == "INSTANCE_ID")
+            {
+              return ConnectionPropertyKey::INSTANCE_ID;
+            }
+            break;
+          case JDBC_CONNECTION_URL_HASH:
+            if (name == "JDBC_CONNECTION_URL")
+            {
+              return ConnectionPropertyKey::JDBC_CONNECTION_URL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return ConnectionPropertyKey::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionPropertyKey(ConnectionPropertyKey enumValue)
+        const char* GetNameForConnectionPropertyKey(ConnectionPropertyKey enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ConnectionTypeMapper
       {
 
-        static const int JDBC_HASH = HashingUtils::HashString("JDBC");
-        static const int SFTP_HASH = HashingUtils::HashString("SFTP");
+        static constexpr int JDBC_HASH = HashingUtils::CompileTimeHashString("JDBC");
+        static constexpr int SFTP_HASH = HashingUtils::CompileTimeHashString("SFTP");
 
 
         ConnectionType GetConnectionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JDBC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConnectionType::JDBC;
-          }
-          else if (hashCode == SFTP_HASH)
-          {
-            return ConnectionType::SFTP;
+          case JDBC_HASH:
+            if (name == "JDBC")
+            {
+              return ConnectionType::JDBC;
+            }
+            break;
+          case SFTP_HASH:
+            if (name == "SFTP")
+            {
+              return ConnectionType::SFTP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ConnectionType::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionType(ConnectionType enumValue)
+        const char* GetNameForConnectionType(ConnectionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
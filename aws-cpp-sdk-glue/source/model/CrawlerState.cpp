@@ -30,25 +30,37 @@ namespace Aws
       namespace CrawlerStateMapper
       {
 
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
+        static constexpr int READY_HASH = HashingUtils::CompileTimeHashString("READY");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
 
 
         CrawlerState GetCrawlerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == READY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CrawlerState::READY;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return CrawlerState::RUNNING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return CrawlerState::STOPPING;
+          case READY_HASH:
+            if (name == "READY")
+            {
+              return CrawlerState::READY;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return CrawlerState::RUNNING;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return CrawlerState::STOPPING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return CrawlerState::NOT_SET;
         }
 
-        Aws::String GetNameForCrawlerState(CrawlerState enumValue)
+        const char* GetNameForCrawlerState(CrawlerState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
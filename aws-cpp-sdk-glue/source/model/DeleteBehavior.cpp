@@ -30,25 +30,37 @@ namespace Aws
       namespace DeleteBehaviorMapper
       {
 
-        static const int LOG_HASH = HashingUtils::HashString("LOG");
-        static const int DELETE_FROM_DATABASE_HASH = HashingUtils::HashString("DELETE_FROM_DATABASE");
-        static const int DEPRECATE_IN_DATABASE_HASH = HashingUtils::HashString("DEPRECATE_IN_DATABASE");
+        static constexpr int LOG_HASH = HashingUtils::CompileTimeHashString("LOG");
+        static constexpr int DELETE_FROM_DATABASE_HASH = HashingUtils::CompileTimeHashString("DELETE_FROM_DATABASE");
+        static constexpr int DEPRECATE_IN_DATABASE_HASH = HashingUtils::CompileTimeHashString("DEPRECATE_IN_DATABASE");
 
 
         DeleteBehavior GetDeleteBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOG_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeleteBehavior::LOG;
-          }
-          else if (hashCode == DELETE_FROM_DATABASE_HASH)
-          {
-            return DeleteBehavior::DELETE_FROM_DATABASE;
-          }
-          else if (hashCode == DEPRECATE_IN_DATABASE_HASH)
-          {
-            return DeleteBehavior::DEPRECATE_IN_DATABASE;
+          case LOG_HASH:
+            if (name == "LOG")
+            {
+              return DeleteBehavior::LOG;
+            }
+            break;
+          case DELETE_FROM_DATABASE_HASH:
+            if (name == "DELETE_FROM_DATABASE")
+            {
+              return DeleteBehavior::DELETE_FROM_DATABASE;
+            }
+            break;
+          case DEPRECATE_IN_DATABASE_HASH:
+            if (name == "DEPRECATE_IN_DATABASE")
+            {
+              return DeleteBehavior::DEPRECATE_IN_DATABASE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DeleteBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForDeleteBehavior(DeleteBehavior enumValue)
+        const char* GetNameForDeleteBehavior(DeleteBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace JobRunStateMapper
       {
 
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int TIMEOUT_HASH = HashingUtils::HashString("TIMEOUT");
+        static constexpr int STARTING_HASH = HashingUtils::CompileTimeHashString("STARTING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int TIMEOUT_HASH = HashingUtils::CompileTimeHashString("TIMEOUT");
 
 
         JobRunState GetJobRunStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobRunState::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return JobRunState::RUNNING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return JobRunState::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return JobRunState::STOPPED;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return JobRunState::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobRunState::FAILED;
-          }
-          else if (hashCode == TIMEOUT_HASH)
-          {
-            return JobRunState::TIMEOUT;
+          case STARTING_HASH:
+            if (name == "STARTING")
+            {
+              return JobRunState::STARTING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return JobRunState::RUNNING;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return JobRunState::STOPPING;
+            }
+            break;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return JobRunState::STOPPED;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return JobRunState::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return JobRunState::FAILED;
+            }
+            break;
+          case TIMEOUT_HASH:
+            if (name == "TIMEOUT")
+            {
+              return JobRunState::TIMEOUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return JobRunState::NOT_SET;
         }
 
-        Aws::String GetNameForJobRunState(JobRunState enumValue)
+        const char* GetNameForJobRunState(JobRunState enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
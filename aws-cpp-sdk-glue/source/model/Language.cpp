@@ -30,20 +30,30 @@ namespace Aws
       namespace LanguageMapper
       {
 
-        static const int PYTHON_HASH = HashingUtils::HashString("PYTHON");
-        static const int SCALA_HASH = HashingUtils::HashString("SCALA");
+        static constexpr int PYTHON_HASH = HashingUtils::CompileTimeHashString("PYTHON");
+        static constexpr int SCALA_HASH = HashingUtils::CompileTimeHashString("SCALA");
 
 
         Language GetLanguageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PYTHON_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Language::PYTHON;
-          }
-          else if (hashCode == SCALA_HASH)
-          {
-            return Language::SCALA;
+          case PYTHON_HASH:
+            if (name == "PYTHON")
+            {
+              return Language::PYTHON;
+            }
+            break;
+          case SCALA_HASH:
+            if (name == "SCALA")
+            {
+              return Language::SCALA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Language::NOT_SET;
         }
 
-        Aws::String GetNameForLanguage(Language enumValue)
+        const char* GetNameForLanguage(Language enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace LastCrawlStatusMapper
       {
 
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int CANCELLED_HASH = HashingUtils::CompileTimeHashString("CANCELLED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         LastCrawlStatus GetLastCrawlStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LastCrawlStatus::SUCCEEDED;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return LastCrawlStatus::CANCELLED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return LastCrawlStatus::FAILED;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return LastCrawlStatus::SUCCEEDED;
+            }
+            break;
+          case CANCELLED_HASH:
+            if (name == "CANCELLED")
+            {
+              return LastCrawlStatus::CANCELLED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return LastCrawlStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return LastCrawlStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLastCrawlStatus(LastCrawlStatus enumValue)
+        const char* GetNameForLastCrawlStatus(LastCrawlStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
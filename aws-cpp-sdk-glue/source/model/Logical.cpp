@@ -30,20 +30,30 @@ namespace Aws
       namespace LogicalMapper
       {
 
-        static const int AND_HASH = HashingUtils::HashString("AND");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
+        static constexpr int AND_HASH = HashingUtils::CompileTimeHashString("AND");
+        static constexpr int ANY_HASH = HashingUtils::CompileTimeHashString("ANY");
 
 
         Logical GetLogicalForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AND_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Logical::AND;
-          }
-          else if (hashCode == ANY_HASH)
-          {
-            return Logical::ANY;
+          case AND_HASH:
+            if (name == "AND")
+            {
+              return Logical::AND;
+            }
+            break;
+          case ANY_HASH:
+            if (name == "ANY")
+            {
+              return Logical::ANY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Logical::NOT_SET;
         }
 
-        Aws::String GetNameForLogical(Logical enumValue)
+        const char* GetNameForLogical(Logical enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace LogicalOperatorMapper
       {
 
-        static const int EQUALS_HASH = HashingUtils::HashString("EQUALS");
+        static constexpr int EQUALS_HASH = HashingUtils::CompileTimeHashString("EQUALS");
 
 
         LogicalOperator GetLogicalOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUALS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LogicalOperator::EQUALS;
+          case EQUALS_HASH:
+            if (name == "EQUALS")
+            {
+              return LogicalOperator::EQUALS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return LogicalOperator::NOT_SET;
         }
 
-        Aws::String GetNameForLogicalOperator(LogicalOperator enumValue)
+        const char* GetNameForLogicalOperator(LogicalOperator enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
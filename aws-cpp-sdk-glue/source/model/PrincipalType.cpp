@@ -30,25 +30,37 @@ namespace Aws
       namespace PrincipalTypeMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int ROLE_HASH = HashingUtils::HashString("ROLE");
-        static const int GROUP_HASH = HashingUtils::HashString("GROUP");
+        static constexpr int USER_HASH = HashingUtils::CompileTimeHashString("USER");
+        static constexpr int ROLE_HASH = HashingUtils::CompileTimeHashString("ROLE");
+        static constexpr int GROUP_HASH = HashingUtils::CompileTimeHashString("GROUP");
 
 
         PrincipalType GetPrincipalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PrincipalType::USER;
-          }
-          else if (hashCode == ROLE_HASH)
-          {
-            return PrincipalType::ROLE;
-          }
-          else if (hashCode == GROUP_HASH)
-          {
-            return PrincipalType::GROUP;
+          case USER_HASH:
+            if (name == "USER")
+            {
+              return PrincipalType::USER;
+            }
+            break;
+          case ROLE_HASH:
+            if (name == "ROLE")
+            {
+              return PrincipalType::ROLE;
+            }
+            break;
+          case GROUP_HASH:
+            if (name == "GROUP")
+            {
+              return PrincipalType::GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PrincipalType::NOT_SET;
         }
 
-        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        const char* GetNameForPrincipalType(PrincipalType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
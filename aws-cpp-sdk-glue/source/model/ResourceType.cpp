@@ -30,25 +30,37 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int JAR_HASH = HashingUtils::HashString("JAR");
-        static const int FILE_HASH = HashingUtils::HashString("FILE");
-        static const int ARCHIVE_HASH = HashingUtils::HashString("ARCHIVE");
+        static constexpr int JAR_HASH = HashingUtils::CompileTimeHashString("JAR");
+        static constexpr int FILE_HASH = HashingUtils::CompileTimeHashString("FILE");
+        static constexpr int ARCHIVE_HASH = HashingUtils::CompileTimeHashString("ARCHIVE");
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JAR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceType::JAR;
-          }
-          else if (hashCode == FILE_HASH)
-          {
-            return ResourceType::FILE;
-          }
-          else if (hashCode == ARCHIVE_HASH)
-          {
-            return ResourceType::ARCHIVE;
+          case JAR_HASH:
+            if (name == "JAR")
+            {
+              return ResourceType::JAR;
+            }
+            break;
+          case FILE_HASH:
+            if (name == "FILE")
+            {
+              return ResourceType::FILE;
+            }
+            break;
+          case ARCHIVE_HASH:
+            if (name == "ARCHIVE")
+            {
+              return ResourceType::ARCHIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceType(ResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
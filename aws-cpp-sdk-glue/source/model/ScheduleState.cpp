@@ -30,25 +30,37 @@ namespace Aws
       namespace ScheduleStateMapper
       {
 
-        static const int SCHEDULED_HASH = HashingUtils::HashString("SCHEDULED");
-        static const int NOT_SCHEDULED_HASH = HashingUtils::HashString("NOT_SCHEDULED");
-        static const int TRANSITIONING_HASH = HashingUtils::HashString("TRANSITIONING");
+        static constexpr int SCHEDULED_HASH = HashingUtils::CompileTimeHashString("SCHEDULED");
+        static constexpr int NOT_SCHEDULED_HASH = HashingUtils::CompileTimeHashString("NOT_SCHEDULED");
+        static constexpr int TRANSITIONING_HASH = HashingUtils::CompileTimeHashString("TRANSITIONING");
 
 
         ScheduleState GetScheduleStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SCHEDULED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScheduleState::SCHEDULED;
-          }
-          else if (hashCode == NOT_SCHEDULED_HASH)
-          {
-            return ScheduleState::NOT_SCHEDULED;
-          }
-          else if (hashCode == TRANSITIONING_HASH)
-          {
-            return ScheduleState::TRANSITIONING;
+          case SCHEDULED_HASH:
+            if (name == "SCHEDULED")
+            {
+              return ScheduleState::SCHEDULED;
+            }
+            break;
+          case NOT_SCHEDULED_HASH:
+            if (name == "NOT_SCHEDULED")
+            {
+              return ScheduleState::NOT_SCHEDULED;
+            }
+            break;
+          case TRANSITIONING_HASH:
+            if (name == "TRANSITIONING")
+            {
+              return ScheduleState::TRANSITIONING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ScheduleState::NOT_SET;
         }
 
-        Aws::String GetNameForScheduleState(ScheduleState enumValue)
+        const char* GetNameForScheduleState(ScheduleState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
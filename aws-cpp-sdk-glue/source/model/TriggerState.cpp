@@ -30,50 +30,72 @@ namespace Aws
       namespace TriggerStateMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int ACTIVATED_HASH = HashingUtils::HashString("ACTIVATED");
-        static const int DEACTIVATING_HASH = HashingUtils::HashString("DEACTIVATING");
-        static const int DEACTIVATED_HASH = HashingUtils::HashString("DEACTIVATED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int CREATED_HASH = HashingUtils::CompileTimeHashString("CREATED");
+        static constexpr int ACTIVATING_HASH = HashingUtils::CompileTimeHashString("ACTIVATING");
+        static constexpr int ACTIVATED_HASH = HashingUtils::CompileTimeHashString("ACTIVATED");
+        static constexpr int DEACTIVATING_HASH = HashingUtils::CompileTimeHashString("DEACTIVATING");
+        static constexpr int DEACTIVATED_HASH = HashingUtils::CompileTimeHashString("DEACTIVATED");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
 
 
         TriggerState GetTriggerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TriggerState::CREATING;
-          }
-          else if (hashCode == CREATED_HASH)
-          {
-            return TriggerState::CREATED;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
-            return TriggerState::ACTIVATING;
-          }
-          else if (hashCode == ACTIVATED_HASH)
-          {
-            return TriggerState::ACTIVATED;
-          }
-          else if (hashCode == DEACTIVATING_HASH)
-          {
-            return TriggerState::DEACTIVATING;
-          }
-          else if (hashCode == DEACTIVATED_HASH)
-          {
-            return TriggerState::DEACTIVATED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return TriggerState::DELETING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return TriggerState::UPDATING;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return TriggerState::CREATING;
+            }
+            break;
+          case CREATED_HASH:
+            if (name == "CREATED")
+            {
+              return TriggerState::CREATED;
+            }
+            break;
+          case ACTIVATING_HASH:
+            if (name == "ACTIVATING")
+            {
+              return TriggerState::ACTIVATING;
+            }
+            break;
+          case ACTIVATED_HASH:
+            if (name == "ACTIVATED")
+            {
+              return TriggerState::ACTIVATED;
+            }
+            break;
+          case DEACTIVATING_HASH:
+            if (name == "DEACTIVATING")
+            {
+              return TriggerState::DEACTIVATING;
+            }
+            break;
+          case DEACTIVATED_HASH:
+            if (name == "DEACTIVATED")
+            {
+              return TriggerState::DEACTIVATED;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return TriggerState::DELETING;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return TriggerState::UPDATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return TriggerState::NOT_SET;
         }
 
-        Aws::String GetNameForTriggerState(TriggerState enumValue)
+        const char* GetNameForTriggerState(TriggerState enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
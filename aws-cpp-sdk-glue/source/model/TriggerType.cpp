@@ -30,25 +30,37 @@ namespace Aws
       namespace TriggerTypeMapper
       {
 
-        static const int SCHEDULED_HASH = HashingUtils::HashString("SCHEDULED");
-        static const int CONDITIONAL_HASH = HashingUtils::HashString("CONDITIONAL");
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
+        static constexpr int SCHEDULED_HASH = HashingUtils::CompileTimeHashString("SCHEDULED");
+        static constexpr int CONDITIONAL_HASH = HashingUtils::CompileTimeHashString("CONDITIONAL");
+        static constexpr int ON_DEMAND_HASH = HashingUtils::CompileTimeHashString("ON_DEMAND");
 
 
         TriggerType GetTriggerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SCHEDULED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TriggerType::SCHEDULED;
-          }
-          else if (hashCode == CONDITIONAL_HASH)
-          {
-            return TriggerType::CONDITIONAL;
-          }
-          else if (hashCode == ON_DEMAND_HASH)
-          {
-            return TriggerType::ON_DEMAND;
+          case SCHEDULED_HASH:
+            if (name == "SCHEDULED")
+            {
+              return TriggerType::SCHEDULED;
+            }
+            break;
+          case CONDITIONAL_HASH:
+            if (name == "CONDITIONAL")
+            {
+              return TriggerType::CONDITIONAL;
+            }
+            break;
+          case ON_DEMAND_HASH:
+            if (name == "ON_DEMAND")
+            {
+              return TriggerType::ON_DEMAND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TriggerType::NOT_SET;
         }
 
-        Aws::String GetNameForTriggerType(TriggerType enumValue)
+        const char* GetNameForTriggerType(TriggerType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
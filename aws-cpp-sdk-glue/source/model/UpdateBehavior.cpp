@@ -30,20 +30,30 @@ namespace Aws
       namespace UpdateBehaviorMapper
       {
 
-        static const int LOG_HASH = HashingUtils::HashString("LOG");
-        static const int UPDATE_IN_DATABASE_HASH = HashingUtils::HashString("UPDATE_IN_DATABASE");
+        static constexpr int LOG_HASH = HashingUtils::CompileTimeHashString("LOG");
+        static constexpr int UPDATE_IN_DATABASE_HASH = HashingUtils::CompileTimeHashString("UPDATE_IN_DATABASE");
 
 
         UpdateBehavior GetUpdateBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOG_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UpdateBehavior::LOG;
-          }
-          else if (hashCode == UPDATE_IN_DATABASE_HASH)
-          {
-            return UpdateBehavior::UPDATE_IN_DATABASE;
+          case LOG_HASH:
+            if (name == "LOG")
+            {
+              return UpdateBehavior::LOG;
+            }
+            break;
+          case UPDATE_IN_DATABASE_HASH:
+            if (name == "UPDATE_IN_DATABASE")
+            {
+              return UpdateBehavior::UPDATE_IN_DATABASE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return UpdateBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateBehavior(UpdateBehavior enumValue)
+        const char* GetNameForUpdateBehavior(UpdateBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
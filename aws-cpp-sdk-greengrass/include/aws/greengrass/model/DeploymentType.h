@@ -36,7 +36,8 @@ namespace DeploymentTypeMapper
 {
 AWS_GREENGRASS_API DeploymentType GetDeploymentTypeForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForDeploymentType(DeploymentType value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForDeploymentType(DeploymentType value);
 } // namespace DeploymentTypeMapper
 } // namespace Model
 } // namespace Greengrass
@@ -34,7 +34,8 @@ namespace EncodingTypeMapper
 {
 AWS_GREENGRASS_API EncodingType GetEncodingTypeForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForEncodingType(EncodingType value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForEncodingType(EncodingType value);
 } // namespace EncodingTypeMapper
 } // namespace Model
 } // namespace Greengrass
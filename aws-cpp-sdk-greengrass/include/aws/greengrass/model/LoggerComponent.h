@@ -34,7 +34,8 @@ namespace LoggerComponentMapper
 {
 AWS_GREENGRASS_API LoggerComponent GetLoggerComponentForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForLoggerComponent(LoggerComponent value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForLoggerComponent(LoggerComponent value);
 } // namespace LoggerComponentMapper
 } // namespace Model
 } // namespace Greengrass
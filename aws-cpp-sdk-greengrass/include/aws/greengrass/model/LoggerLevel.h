@@ -37,7 +37,8 @@ namespace LoggerLevelMapper
 {
 AWS_GREENGRASS_API LoggerLevel GetLoggerLevelForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForLoggerLevel(LoggerLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForLoggerLevel(LoggerLevel value);
 } // namespace LoggerLevelMapper
 } // namespace Model
 } // namespace Greengrass
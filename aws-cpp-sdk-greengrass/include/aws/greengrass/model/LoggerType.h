@@ -34,7 +34,8 @@ namespace LoggerTypeMapper
 {
 AWS_GREENGRASS_API LoggerType GetLoggerTypeForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForLoggerType(LoggerType value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForLoggerType(LoggerType value);
 } // namespace LoggerTypeMapper
 } // namespace Model
 } // namespace Greengrass
@@ -34,7 +34,8 @@ namespace PermissionMapper
 {
 AWS_GREENGRASS_API Permission GetPermissionForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForPermission(Permission value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForPermission(Permission value);
 } // namespace PermissionMapper
 } // namespace Model
 } // namespace Greengrass
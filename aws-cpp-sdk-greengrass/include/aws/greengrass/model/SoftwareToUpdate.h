@@ -34,7 +34,8 @@ namespace SoftwareToUpdateMapper
 {
 AWS_GREENGRASS_API SoftwareToUpdate GetSoftwareToUpdateForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForSoftwareToUpdate(SoftwareToUpdate value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForSoftwareToUpdate(SoftwareToUpdate value);
 } // namespace SoftwareToUpdateMapper
 } // namespace Model
 } // namespace Greengrass
@@ -40,7 +40,8 @@ namespace UpdateAgentLogLevelMapper
 {
 AWS_GREENGRASS_API UpdateAgentLogLevel GetUpdateAgentLogLevelForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForUpdateAgentLogLevel(UpdateAgentLogLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForUpdateAgentLogLevel(UpdateAgentLogLevel value);
 } // namespace UpdateAgentLogLevelMapper
 } // namespace Model
 } // namespace Greengrass
@@ -35,7 +35,8 @@ namespace UpdateTargetsArchitectureMapper
 {
 AWS_GREENGRASS_API UpdateTargetsArchitecture GetUpdateTargetsArchitectureForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForUpdateTargetsArchitecture(UpdateTargetsArchitecture value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForUpdateTargetsArchitecture(UpdateTargetsArchitecture value);
 } // namespace UpdateTargetsArchitectureMapper
 } // namespace Model
 } // namespace Greengrass
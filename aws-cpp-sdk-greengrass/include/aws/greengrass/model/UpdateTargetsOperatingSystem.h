@@ -35,7 +35,8 @@ namespace UpdateTargetsOperatingSystemMapper
 {
 AWS_GREENGRASS_API UpdateTargetsOperatingSystem GetUpdateTargetsOperatingSystemForName(const Aws::String& name);
 
-AWS_GREENGRASS_API Aws::String GetNameForUpdateTargetsOperatingSystem(UpdateTargetsOperatingSystem value);
+// names of values not modeled point into the enum overflow container
+AWS_GREENGRASS_API const char* GetNameForUpdateTargetsOperatingSystem(UpdateTargetsOperatingSystem value);
 } // namespace UpdateTargetsOperatingSystemMapper
 } // namespace Model
 } // namespace Greengrass
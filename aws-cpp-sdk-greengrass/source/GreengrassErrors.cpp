@@ -28,8 +28,8 @@ namespace Greengrass
 namespace GreengrassErrorMapper
 {
 
-static const int BAD_REQUEST_HASH = HashingUtils::HashString("BadRequestException");
-static const int INTERNAL_SERVER_ERROR_HASH = HashingUtils::HashString("InternalServerErrorException");
+static constexpr int BAD_REQUEST_HASH = HashingUtils::CompileTimeHashString("BadRequestException");
+static constexpr int INTERNAL_SERVER_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalServerErrorException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,30 +30,44 @@ namespace Aws
       namespace DeploymentTypeMapper
       {
 
-        static const int NewDeployment_HASH = HashingUtils::HashString("NewDeployment");
-        static const int Redeployment_HASH = HashingUtils::HashString("Redeployment");
-        static const int ResetDeployment_HASH = HashingUtils::HashString("ResetDeployment");
-        static const int ForceResetDeployment_HASH = HashingUtils::HashString("ForceResetDeployment");
+        static constexpr int NewDeployment_HASH = HashingUtils::CompileTimeHashString("NewDeployment");
+        static constexpr int Redeployment_HASH = HashingUtils::CompileTimeHashString("Redeployment");
+        static constexpr int ResetDeployment_HASH = HashingUtils::CompileTimeHashString("ResetDeployment");
+        static constexpr int ForceResetDeployment_HASH = HashingUtils::CompileTimeHashString("ForceResetDeployment");
 
 
         DeploymentType GetDeploymentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NewDeployment_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeploymentType::NewDeployment;
-          }
-          else if (hashCode == Redeployment_HASH)
-          {
-            return DeploymentType::Redeployment;
-          }
-          else if (hashCode == ResetDeployment_HASH)
-          {
-            return DeploymentType::ResetDeployment;
-          }
-          else if (hashCode == ForceResetDeployment_HASH)
-          {
-            return DeploymentType::ForceResetDeployment;
+          case NewDeployment_HASH:
+            if (name == "NewDeployment")
+            {
+              return DeploymentType::NewDeployment;
+            }
+            break;
+          case Redeployment_HASH:
+            if (name == "Redeployment")
+            {
+              return DeploymentType::Redeployment;
+            }
+            break;
+          case ResetDeployment_HASH:
+            if (name == "ResetDeployment")
+            {
+              return DeploymentType::ResetDeployment;
+            }
+            break;
+          case ForceResetDeployment_HASH:
+            if (name == "ForceResetDeployment")
+            {
+              return DeploymentType::ForceResetDeployment;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DeploymentType::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentType(DeploymentType enumValue)
+        const char* GetNameForDeploymentType(DeploymentType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace EncodingTypeMapper
       {
 
-        static const int binary_HASH = HashingUtils::HashString("binary");
-        static const int json_HASH = HashingUtils::HashString("json");
+        static constexpr int binary_HASH = HashingUtils::CompileTimeHashString("binary");
+        static constexpr int json_HASH = HashingUtils::CompileTimeHashString("json");
 
 
         EncodingType GetEncodingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == binary_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EncodingType::binary;
-          }
-          else if (hashCode == json_HASH)
-          {
-            return EncodingType::json;
+          case binary_HASH:
+            if (name == "binary")
+            {
+              return EncodingType::binary;
+            }
+            break;
+          case json_HASH:
+            if (name == "json")
+            {
+              return EncodingType::json;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EncodingType::NOT_SET;
         }
 
-        Aws::String GetNameForEncodingType(EncodingType enumValue)
+        const char* GetNameForEncodingType(EncodingType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
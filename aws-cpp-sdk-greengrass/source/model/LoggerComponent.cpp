@@ -30,20 +30,30 @@ namespace Aws
       namespace LoggerComponentMapper
       {
 
-        static const int GreengrassSystem_HASH = HashingUtils::HashString("GreengrassSystem");
-        static const int Lambda_HASH = HashingUtils::HashString("Lambda");
+        static constexpr int GreengrassSystem_HASH = HashingUtils::CompileTimeHashString("GreengrassSystem");
+        static constexpr int Lambda_HASH = HashingUtils::CompileTimeHashString("Lambda");
 
 
         LoggerComponent GetLoggerComponentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GreengrassSystem_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoggerComponent::GreengrassSystem;
-          }
-          else if (hashCode == Lambda_HASH)
-          {
-            return LoggerComponent::Lambda;
+          case GreengrassSystem_HASH:
+            if (name == "GreengrassSystem")
+            {
+              return LoggerComponent::GreengrassSystem;
+            }
+            break;
+          case Lambda_HASH:
+            if (name == "Lambda")
+            {
+              return LoggerComponent::Lambda;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LoggerComponent::NOT_SET;
         }
 
-        Aws::String GetNameForLoggerComponent(LoggerComponent enumValue)
+        const char* GetNameForLoggerComponent(LoggerComponent enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace LoggerLevelMapper
       {
 
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int FATAL_HASH = HashingUtils::HashString("FATAL");
+        static constexpr int DEBUG__HASH = HashingUtils::CompileTimeHashString("DEBUG");
+        static constexpr int INFO_HASH = HashingUtils::CompileTimeHashString("INFO");
+        static constexpr int WARN_HASH = HashingUtils::CompileTimeHashString("WARN");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int FATAL_HASH = HashingUtils::CompileTimeHashString("FATAL");
 
 
         LoggerLevel GetLoggerLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEBUG__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoggerLevel::DEBUG_;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return LoggerLevel::INFO;
-          }
-          else if (hashCode == WARN_HASH)
-          {
-            return LoggerLevel::WARN;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return LoggerLevel::ERROR_;
-          }
-          else if (hashCode == FATAL_HASH)
-          {
-            return LoggerLevel::FATAL;
+          case DEBUG__HASH:
+            if (name == "DEBUG")
+            {
+              return LoggerLevel::DEBUG_;
+            }
+            break;
+          case INFO_HASH:
+            if (name == "INFO")
+            {
+              return LoggerLevel::INFO;
+            }
+            break;
+          case WARN_HASH:
+            if (name == "WARN")
+            {
+              return LoggerLevel::WARN;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return LoggerLevel::ERROR_;
+            }
+            break;
+          case FATAL_HASH:
+            if (name == "FATAL")
+            {
+              return LoggerLevel::FATAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return LoggerLevel::NOT_SET;
         }
 
-        Aws::String GetNameForLoggerLevel(LoggerLevel enumValue)
+        const char* GetNameForLoggerLevel(LoggerLevel enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
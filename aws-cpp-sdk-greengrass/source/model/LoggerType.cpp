@@ -30,20 +30,30 @@ namespace Aws
       namespace LoggerTypeMapper
       {
 
-        static const int FileSystem_HASH = HashingUtils::HashString("FileSystem");
-        static const int AWSCloudWatch_HASH = HashingUtils::HashString("AWSCloudWatch");
+        static constexpr int FileSystem_HASH = HashingUtils::CompileTimeHashString("FileSystem");
+        static constexpr int AWSCloudWatch_HASH = HashingUtils::CompileTimeHashString("AWSCloudWatch");
 
 
         LoggerType GetLoggerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FileSystem_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoggerType::FileSystem;
-          }
-          else if (hashCode == AWSCloudWatch_HASH)
-          {
-            return LoggerType::AWSCloudWatch;
+          case FileSystem_HASH:
+            if (name == "FileSystem")
+            {
+              return LoggerType::FileSystem;
+            }
+            break;
+          case AWSCloudWatch_HASH:
+            if (name == "AWSCloudWatch")
+            {
+              return LoggerType::AWSCloudWatch;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LoggerType::NOT_SET;
         }
 
-        Aws::String GetNameForLoggerType(LoggerType enumValue)
+        const char* GetNameForLoggerType(LoggerType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PermissionMapper
       {
 
-        static const int ro_HASH = HashingUtils::HashString("ro");
-        static const int rw_HASH = HashingUtils::HashString("rw");
+        static constexpr int ro_HASH = HashingUtils::CompileTimeHashString("ro");
+        static constexpr int rw_HASH = HashingUtils::CompileTimeHashString("rw");
 
 
         Permission GetPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ro_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Permission::ro;
-          }
-          else if (hashCode == rw_HASH)
-          {
-            return Permission::rw;
+          case ro_HASH:
+            if (name == "ro")
+            {
+              return Permission::ro;
+            }
+            break;
+          case rw_HASH:
+            if (name == "rw")
+            {
+              return Permission::rw;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Permission::NOT_SET;
         }
 
-        Aws::String GetNameForPermission(Permission enumValue)
+        const char* GetNameForPermission(Permission enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SoftwareToUpdateMapper
       {
 
-        static const int core_HASH = HashingUtils::HashString("core");
-        static const int ota_agent_HASH = HashingUtils::HashString("ota_agent");
+        static constexpr int core_HASH = HashingUtils::CompileTimeHashString("core");
+        static constexpr int ota_agent_HASH = HashingUtils::CompileTimeHashString("ota_agent");
 
 
         SoftwareToUpdate GetSoftwareToUpdateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == core_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SoftwareToUpdate::core;
-          }
-          else if (hashCode == ota_agent_HASH)
-          {
-            return SoftwareToUpdate::ota_agent;
+          case core_HASH:
+            if (name == "core")
+            {
+              return SoftwareToUpdate::core;
+            }
+            break;
+          case ota_agent_HASH:
+            if (name == "ota_agent")
+            {
+              return SoftwareToUpdate::ota_agent;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SoftwareToUpdate::NOT_SET;
         }
 
-        Aws::String GetNameForSoftwareToUpdate(SoftwareToUpdate enumValue)
+        const char* GetNameForSoftwareToUpdate(SoftwareToUpdate enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace UpdateAgentLogLevelMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int TRACE_HASH = HashingUtils::HashString("TRACE");
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int VERBOSE_HASH = HashingUtils::HashString("VERBOSE");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int FATAL_HASH = HashingUtils::HashString("FATAL");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int TRACE_HASH = HashingUtils::CompileTimeHashString("TRACE");
+        static constexpr int DEBUG__HASH = HashingUtils::CompileTimeHashString("DEBUG");
+        static constexpr int VERBOSE_HASH = HashingUtils::CompileTimeHashString("VERBOSE");
+        static constexpr int INFO_HASH = HashingUtils::CompileTimeHashString("INFO");
+        static constexpr int WARN_HASH = HashingUtils::CompileTimeHashString("WARN");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int FATAL_HASH = HashingUtils::CompileTimeHashString("FATAL");
 
 
         UpdateAgentLogLevel GetUpdateAgentLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UpdateAgentLogLevel::NONE;
-          }
-          else if (hashCode == TRACE_HASH)
-          {
-            return UpdateAgentLogLevel::TRACE;
-          }
-          else if (hashCode == DEBUG__HASH)
-          {
-            return UpdateAgentLogLevel::DEBUG_;
-          }
-          else if (hashCode == VERBOSE_HASH)
-          {
-            return UpdateAgentLogLevel::VERBOSE;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return UpdateAgentLogLevel::INFO;
-          }
-          else if (hashCode == WARN_HASH)
-          {
-            return UpdateAgentLogLevel::WARN;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return UpdateAgentLogLevel::ERROR_;
-          }
-          else if (hashCode == FATAL_HASH)
-          {
-            return UpdateAgentLogLevel::FATAL;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return UpdateAgentLogLevel::NONE;
+            }
+            break;
+          case TRACE_HASH:
+            if (name == "TRACE")
+            {
+              return UpdateAgentLogLevel::TRACE;
+            }
+            break;
+          case DEBUG__HASH:
+            if (name == "DEBUG")
+            {
+              return UpdateAgentLogLevel::DEBUG_;
+            }
+            break;
+          case VERBOSE_HASH:
+            if (name == "VERBOSE")
+            {
+              return UpdateAgentLogLevel::VERBOSE;
+            }
+            break;
+          case INFO_HASH:
+            if (name == "INFO")
+            {
+              return UpdateAgentLogLevel::INFO;
+            }
+            break;
+          case WARN_HASH:
+            if (name == "WARN")
+            {
+              return UpdateAgentLogLevel::WARN;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return UpdateAgentLogLevel::ERROR_;
+            }
+            break;
+          case FATAL_HASH:
+            if (name == "FATAL")
+            {
+              return UpdateAgentLogLevel::FATAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return UpdateAgentLogLevel::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateAgentLogLevel(UpdateAgentLogLevel enumValue)
+        const char* GetNameForUpdateAgentLogLevel(UpdateAgentLogLevel enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
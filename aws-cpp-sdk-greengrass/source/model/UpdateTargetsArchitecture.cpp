@@ -30,25 +30,37 @@ namespace Aws
       namespace UpdateTargetsArchitectureMapper
       {
 
-        static const int armv7l_HASH = HashingUtils::HashString("armv7l");
-        static const int x86_64_HASH = HashingUtils::HashString("x86_64");
-        static const int aarch64_HASH = HashingUtils::HashString("aarch64");
+        static constexpr int armv7l_HASH = HashingUtils::CompileTimeHashString("armv7l");
+        static constexpr int x86_64_HASH = HashingUtils::CompileTimeHashString("x86_64");
+        static constexpr int aarch64_HASH = HashingUtils::CompileTimeHashString("aarch64");
 
 
         UpdateTargetsArchitecture GetUpdateTargetsArchitectureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == armv7l_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UpdateTargetsArchitecture::armv7l;
-          }
-          else if (hashCode == x86_64_HASH)
-          {
-            return UpdateTargetsArchitecture::x86_64;
-          }
-          else if (hashCode == aarch64_HASH)
-          {
-            return UpdateTargetsArchitecture::aarch64;
+          case armv7l_HASH:
+            if (name == "armv7l")
+            {
+              return UpdateTargetsArchitecture::armv7l;
+            }
+            break;
+          case x86_64_HASH:
+            if (name == "x86_64")
+            {
+              return UpdateTargetsArchitecture::x86_64;
+            }
+            break;
+          case aarch64_HASH:
+            if (name == "aarch64")
+            {
+              return UpdateTargetsArchitecture::aarch64;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return UpdateTargetsArchitecture::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateTargetsArchitecture(UpdateTargetsArchitecture enumValue)
+        const char* GetNameForUpdateTargetsArchitecture(UpdateTargetsArchitecture enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
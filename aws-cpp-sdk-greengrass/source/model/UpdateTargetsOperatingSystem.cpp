@@ -30,25 +30,37 @@ namespace Aws
       namespace UpdateTargetsOperatingSystemMapper
       {
 
-        static const int ubuntu_HASH = HashingUtils::HashString("ubuntu");
-        static const int raspbian_HASH = HashingUtils::HashString("raspbian");
-        static const int amazon_linux_HASH = HashingUtils::HashString("amazon_linux");
+        static constexpr int ubuntu_HASH = HashingUtils::CompileTimeHashString("ubuntu");
+        static constexpr int raspbian_HASH = HashingUtils::CompileTimeHashString("raspbian");
+        static constexpr int amazon_linux_HASH = HashingUtils::CompileTimeHashString("amazon_linux");
 
 
         UpdateTargetsOperatingSystem GetUpdateTargetsOperatingSystemForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ubuntu_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UpdateTargetsOperatingSystem::ubuntu;
-          }
-          else if (hashCode == raspbian_HASH)
-          {
-            return UpdateTargetsOperatingSystem::raspbian;
-          }
-          else if (hashCode == amazon_linux_HASH)
-          {
-            return UpdateTargetsOperatingSystem::amazon_linux;
+          case ubuntu_HASH:
+            if (name == "ubuntu")
+            {
+              return UpdateTargetsOperatingSystem::ubuntu;
+            }
+            break;
+          case raspbian_HASH:
+            if (name == "raspbian")
+            {
+              return UpdateTargetsOperatingSystem::raspbian;
+            }
+            break;
+          case amazon_linux_HASH:
+            if (name == "amazon_linux")
+            {
+              return UpdateTargetsOperatingSystem::amazon_linux;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return UpdateTargetsOperatingSystem::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateTargetsOperatingSystem(UpdateTargetsOperatingSystem enumValue)
+        const char* GetNameForUpdateTargetsOperatingSystem(UpdateTargetsOperatingSystem enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace DetectorStatusMapper
 {
 AWS_GUARDDUTY_API DetectorStatus GetDetectorStatusForName(const Aws::String& name);
 
-AWS_GUARDDUTY_API Aws::String GetNameForDetectorStatus(DetectorStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GUARDDUTY_API const char* GetNameForDetectorStatus(DetectorStatus value);
 } // namespace DetectorStatusMapper
 } // namespace Model
 } // namespace GuardDuty
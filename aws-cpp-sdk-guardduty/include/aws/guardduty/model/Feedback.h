@@ -34,7 +34,8 @@ namespace FeedbackMapper
 {
 AWS_GUARDDUTY_API Feedback GetFeedbackForName(const Aws::String& name);
 
-AWS_GUARDDUTY_API Aws::String GetNameForFeedback(Feedback value);
+// names of values not modeled point into the enum overflow container
+AWS_GUARDDUTY_API const char* GetNameForFeedback(Feedback value);
 } // namespace FeedbackMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -34,7 +34,8 @@ namespace FilterActionMapper
 {
 AWS_GUARDDUTY_API FilterAction GetFilterActionForName(const Aws::String& name);
 
-AWS_GUARDDUTY_API Aws::String GetNameForFilterAction(FilterAction value);
+// names of values not modeled point into the enum overflow container
+AWS_GUARDDUTY_API const char* GetNameForFilterAction(FilterAction value);
 } // namespace FilterActionMapper
 } // namespace Model
 } // namespace GuardDuty
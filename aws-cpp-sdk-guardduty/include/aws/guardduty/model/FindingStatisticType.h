@@ -33,7 +33,8 @@ namespace FindingStatisticTypeMapper
 {
 AWS_GUARDDUTY_API FindingStatisticType GetFindingStatisticTypeForName(const Aws::String& name);
 
-AWS_GUARDDUTY_API Aws::String GetNameForFindingStatisticType(FindingStatisticType value);
+// names of values not modeled point into the enum overflow container
+AWS_GUARDDUTY_API const char* GetNameForFindingStatisticType(FindingStatisticType value);
 } // namespace FindingStatisticTypeMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -38,7 +38,8 @@ namespace IpSetFormatMapper
 {
 AWS_GUARDDUTY_API IpSetFormat GetIpSetFormatForName(const Aws::String& name);
 
-AWS_GUARDDUTY_API Aws::String GetNameForIpSetFormat(IpSetFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_GUARDDUTY_API const char* GetNameForIpSetFormat(IpSetFormat value);
 } // namespace IpSetFormatMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -39,7 +39,8 @@ namespace IpSetStatusMapper
 {
 AWS_GUARDDUTY_API IpSetStatus GetIpSetStatusForName(const Aws::String& name);
 
-AWS_GUARDDUTY_API Aws::String GetNameForIpSetStatus(IpSetStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GUARDDUTY_API const char* GetNameForIpSetStatus(IpSetStatus value);
 } // namespace IpSetStatusMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -34,7 +34,8 @@ namespace OrderByMapper
 {
 AWS_GUARDDUTY_API OrderBy GetOrderByForName(const Aws::String& name);
 
-AWS_GUARDDUTY_API Aws::String GetNameForOrderBy(OrderBy value);
+// names of values not modeled point into the enum overflow container
+AWS_GUARDDUTY_API const char* GetNameForOrderBy(OrderBy value);
 } // namespace OrderByMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -38,7 +38,8 @@ namespace ThreatIntelSetFormatMapper
 {
 AWS_GUARDDUTY_API ThreatIntelSetFormat GetThreatIntelSetFormatForName(const Aws::String& name);
 
-AWS_GUARDDUTY_API Aws::String GetNameForThreatIntelSetFormat(ThreatIntelSetFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_GUARDDUTY_API const char* GetNameForThreatIntelSetFormat(ThreatIntelSetFormat value);
 } // namespace ThreatIntelSetFormatMapper
 } // namespace Model
 } // namespace GuardDuty
@@ -39,7 +39,8 @@ namespace ThreatIntelSetStatusMapper
 {
 AWS_GUARDDUTY_API ThreatIntelSetStatus GetThreatIntelSetStatusForName(const Aws::String& name);
 
-AWS_GUARDDUTY_API Aws::String GetNameForThreatIntelSetStatus(ThreatIntelSetStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_GUARDDUTY_API const char* GetNameForThreatIntelSetStatus(ThreatIntelSetStatus value);
 } // namespace ThreatIntelSetStatusMapper
 } // namespace Model
 } // namespace GuardDuty
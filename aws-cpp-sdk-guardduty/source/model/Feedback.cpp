@@ -30,20 +30,30 @@ namespace Aws
       namespace FeedbackMapper
       {
 
-        static const int USEFUL_HASH = HashingUtils::HashString("USEFUL");
-        static const int NOT_USEFUL_HASH = HashingUtils::HashString("NOT_USEFUL");
+        static constexpr int USEFUL_HASH = HashingUtils::CompileTimeHashString("USEFUL");
+        static constexpr int NOT_USEFUL_HASH = HashingUtils::CompileTimeHashString("NOT_USEFUL");
 
 
         Feedback GetFeedbackForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USEFUL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Feedback::USEFUL;
-          }
-          else if (hashCode == NOT_USEFUL_HASH)
-          {
-            return Feedback::NOT_USEFUL;
+          case USEFUL_HASH:
+            if (name == "USEFUL")
+            {
+              return Feedback::USEFUL;
+            }
+            break;
+          case NOT_USEFUL_HASH:
+            if (name == "NOT_USEFUL")
+            {
+              return Feedback::NOT_USEFUL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Feedback::NOT_SET;
         }
 
-        Aws::String GetNameForFeedback(Feedback enumValue)
+        const char* GetNameForFeedback(Feedback enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
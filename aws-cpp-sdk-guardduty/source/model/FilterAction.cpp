@@ -30,20 +30,30 @@ namespace Aws
       namespace FilterActionMapper
       {
 
-        static const int NOOP_HASH = HashingUtils::HashString("NOOP");
-        static const int ARCHIVE_HASH = HashingUtils::HashString("ARCHIVE");
+        static constexpr int NOOP_HASH = HashingUtils::CompileTimeHashString("NOOP");
+        static constexpr int ARCHIVE_HASH = HashingUtils::CompileTimeHashString("ARCHIVE");
 
 
         FilterAction GetFilterActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOOP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FilterAction::NOOP;
-          }
-          else if (hashCode == ARCHIVE_HASH)
-          {
-            return FilterAction::ARCHIVE;
+          case NOOP_HASH:
+            if (name == "NOOP")
+            {
+              return FilterAction::NOOP;
+            }
+            break;
+          case ARCHIVE_HASH:
+            if (name == "ARCHIVE")
+            {
+              return FilterAction::ARCHIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FilterAction::NOT_SET;
         }
 
-        Aws::String GetNameForFilterAction(FilterAction enumValue)
+        const char* GetNameForFilterAction(FilterAction enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace FindingStatisticTypeMapper
       {
 
-        static const int COUNT_BY_SEVERITY_HASH = HashingUtils::HashString("COUNT_BY_SEVERITY");
+        static constexpr int COUNT_BY_SEVERITY_HASH = HashingUtils::CompileTimeHashString("COUNT_BY_SEVERITY");
 
 
         FindingStatisticType GetFindingStatisticTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COUNT_BY_SEVERITY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FindingStatisticType::COUNT_BY_SEVERITY;
+          case COUNT_BY_SEVERITY_HASH:
+            if (name == "COUNT_BY_SEVERITY")
+            {
+              return FindingStatisticType::COUNT_BY_SEVERITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return FindingStatisticType::NOT_SET;
         }
 
-        Aws::String GetNameForFindingStatisticType(FindingStatisticType enumValue)
+        const char* GetNameForFindingStatisticType(FindingStatisticType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
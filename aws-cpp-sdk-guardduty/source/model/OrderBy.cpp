@@ -30,20 +30,30 @@ namespace Aws
       namespace OrderByMapper
       {
 
-        static const int ASC_HASH = HashingUtils::HashString("ASC");
-        static const int DESC_HASH = HashingUtils::HashString("DESC");
+        static constexpr int ASC_HASH = HashingUtils::CompileTimeHashString("ASC");
+        static constexpr int DESC_HASH = HashingUtils::CompileTimeHashString("DESC");
 
 
         OrderBy GetOrderByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OrderBy::ASC;
-          }
-          else if (hashCode == DESC_HASH)
-          {
-            return OrderBy::DESC;
+          case ASC_HASH:
+            if (name == "ASC")
+            {
+              return OrderBy::ASC;
+            }
+            break;
+          case DESC_HASH:
+            if (name == "DESC")
+            {
+              return OrderBy::DESC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OrderBy::NOT_SET;
         }
 
-        Aws::String GetNameForOrderBy(OrderBy enumValue)
+        const char* GetNameForOrderBy(OrderBy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
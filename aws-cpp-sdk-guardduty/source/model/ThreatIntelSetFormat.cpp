@@ -30,40 +30,58 @@ namespace Aws
       namespace ThreatIntelSetFormatMapper
       {
 
-        static const int TXT_HASH = HashingUtils::HashString("TXT");
-        static const int STIX_HASH = HashingUtils::HashString("STIX");
-        static const int OTX_CSV_HASH = HashingUtils::HashString("OTX_CSV");
-        static const int ALIEN_VAULT_HASH = HashingUtils::HashString("ALIEN_VAULT");
-        static const int PROOF_POINT_HASH = HashingUtils::HashString("PROOF_POINT");
-        static const int FIRE_EYE_HASH = HashingUtils::HashString("FIRE_EYE");
+        static constexpr int TXT_HASH = HashingUtils::CompileTimeHashString("TXT");
+        static constexpr int STIX_HASH = HashingUtils::CompileTimeHashString("STIX");
+        static constexpr int OTX_CSV_HASH = HashingUtils::CompileTimeHashString("OTX_CSV");
+        static constexpr int ALIEN_VAULT_HASH = HashingUtils::CompileTimeHashString("ALIEN_VAULT");
+        static constexpr int PROOF_POINT_HASH = HashingUtils::CompileTimeHashString("PROOF_POINT");
+        static constexpr int FIRE_EYE_HASH = HashingUtils::CompileTimeHashString("FIRE_EYE");
 
 
         ThreatIntelSetFormat GetThreatIntelSetFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TXT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ThreatIntelSetFormat::TXT;
-          }
-          else if (hashCode == STIX_HASH)
-          {
-            return ThreatIntelSetFormat::STIX;
-          }
-          else if (hashCode == OTX_CSV_HASH)
-          {
-            return ThreatIntelSetFormat::OTX_CSV;
-          }
-          else if (hashCode == ALIEN_VAULT_HASH)
-          {
-            return ThreatIntelSetFormat::ALIEN_VAULT;
-          }
-          else if (hashCode == PROOF_POINT_HASH)
-          {
-            return ThreatIntelSetFormat::PROOF_POINT;
-          }
-          else if (hashCode == FIRE_EYE_HASH)
-          {
-            return ThreatIntelSetFormat::FIRE_EYE;
+          case TXT_HASH:
+            if (name == "TXT")
+            {
+              return ThreatIntelSetFormat::TXT;
+            }
+            break;
+          case STIX_HASH:
+            if (name == "STIX")
+            {
+              return ThreatIntelSetFormat::STIX;
+            }
+            break;
+          case OTX_CSV_HASH:
+            if (name == "OTX_CSV")
+            {
+              return ThreatIntelSetFormat::OTX_CSV;
+            }
+            break;
+          case ALIEN_VAULT_HASH:
+            if (name == "ALIEN_VAULT")
+            {
+              return ThreatIntelSetFormat::ALIEN_VAULT;
+            }
+            break;
+          case PROOF_POINT_HASH:
+            if (name == "PROOF_POINT")
+            {
+              return ThreatIntelSetFormat::PROOF_POINT;
+            }
+            break;
+          case FIRE_EYE_HASH:
+            if (name == "FIRE_EYE")
+            {
+              return ThreatIntelSetFormat::FIRE_EYE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ThreatIntelSetFormat::NOT_SET;
         }
 
-        Aws::String GetNameForThreatIntelSetFormat(ThreatIntelSetFormat enumValue)
+        const char* GetNameForThreatIntelSetFormat(ThreatIntelSetFormat enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
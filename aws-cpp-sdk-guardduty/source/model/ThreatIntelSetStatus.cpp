@@ -30,45 +30,65 @@ namespace Aws
       namespace ThreatIntelSetStatusMapper
       {
 
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int ACTIVATING_HASH = HashingUtils::HashString("ACTIVATING");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int DEACTIVATING_HASH = HashingUtils::HashString("DEACTIVATING");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int DELETE_PENDING_HASH = HashingUtils::HashString("DELETE_PENDING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int INACTIVE_HASH = HashingUtils::CompileTimeHashString("INACTIVE");
+        static constexpr int ACTIVATING_HASH = HashingUtils::CompileTimeHashString("ACTIVATING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int DEACTIVATING_HASH = HashingUtils::CompileTimeHashString("DEACTIVATING");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int DELETE_PENDING_HASH = HashingUtils::CompileTimeHashString("DELETE_PENDING");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         ThreatIntelSetStatus GetThreatIntelSetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ThreatIntelSetStatus::INACTIVE;
-          }
-          else if (hashCode == ACTIVATING_HASH)
-          {
-            return ThreatIntelSetStatus::ACTIVATING;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return ThreatIntelSetStatus::ACTIVE;
-          }
-          else if (hashCode == DEACTIVATING_HASH)
-          {
-            return ThreatIntelSetStatus::DEACTIVATING;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return ThreatIntelSetStatus::ERROR_;
-          }
-          else if (hashCode == DELETE_PENDING_HASH)
-          {
-            return ThreatIntelSetStatus::DELETE_PENDING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ThreatIntelSetStatus::DELETED;
+          case INACTIVE_HASH:
+            if (name == "INACTIVE")
+            {
+              return ThreatIntelSetStatus::INACTIVE;
+            }
+            break;
+          case ACTIVATING_HASH:
+            if (name == "ACTIVATING")
+            {
+              return ThreatIntelSetStatus::ACTIVATING;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ThreatIntelSetStatus::ACTIVE;
+            }
+            break;
+          case DEACTIVATING_HASH:
+            if (name == "DEACTIVATING")
+            {
+              return ThreatIntelSetStatus::DEACTIVATING;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return ThreatIntelSetStatus::ERROR_;
+            }
+            break;
+          case DELETE_PENDING_HASH:
+            if (name == "DELETE_PENDING")
+            {
+              return ThreatIntelSetStatus::DELETE_PENDING;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return ThreatIntelSetStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return ThreatIntelSetStatus::NOT_SET;
         }
 
-        Aws::String GetNameForThreatIntelSetStatus(ThreatIntelSetStatus enumValue)
+        const char* GetNameForThreatIntelSetStatus(ThreatIntelSetStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
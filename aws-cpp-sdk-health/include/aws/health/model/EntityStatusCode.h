@@ -35,7 +35,8 @@ namespace EntityStatusCodeMapper
 {
 AWS_HEALTH_API EntityStatusCode GetEntityStatusCodeForName(const Aws::String& name);
 
-AWS_HEALTH_API Aws::String GetNameForEntityStatusCode(EntityStatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_HEALTH_API const char* GetNameForEntityStatusCode(EntityStatusCode value);
 } // namespace EntityStatusCodeMapper
 } // namespace Model
 } // namespace Health
@@ -33,7 +33,8 @@ namespace EventAggregateFieldMapper
 {
 AWS_HEALTH_API EventAggregateField GetEventAggregateFieldForName(const Aws::String& name);
 
-AWS_HEALTH_API Aws::String GetNameForEventAggregateField(EventAggregateField value);
+// names of values not modeled point into the enum overflow container
+AWS_HEALTH_API const char* GetNameForEventAggregateField(EventAggregateField value);
 } // namespace EventAggregateFieldMapper
 } // namespace Model
 } // namespace Health
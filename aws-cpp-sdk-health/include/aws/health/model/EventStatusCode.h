@@ -35,7 +35,8 @@ namespace EventStatusCodeMapper
 {
 AWS_HEALTH_API EventStatusCode GetEventStatusCodeForName(const Aws::String& name);
 
-AWS_HEALTH_API Aws::String GetNameForEventStatusCode(EventStatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_HEALTH_API const char* GetNameForEventStatusCode(EventStatusCode value);
 } // namespace EventStatusCodeMapper
 } // namespace Model
 } // namespace Health
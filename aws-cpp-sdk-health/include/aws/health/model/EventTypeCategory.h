@@ -35,7 +35,8 @@ namespace EventTypeCategoryMapper
 {
 AWS_HEALTH_API EventTypeCategory GetEventTypeCategoryForName(const Aws::String& name);
 
-AWS_HEALTH_API Aws::String GetNameForEventTypeCategory(EventTypeCategory value);
+// names of values not modeled point into the enum overflow container
+AWS_HEALTH_API const char* GetNameForEventTypeCategory(EventTypeCategory value);
 } // namespace EventTypeCategoryMapper
 } // namespace Model
 } // namespace Health
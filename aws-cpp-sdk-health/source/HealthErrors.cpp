@@ -28,8 +28,8 @@ namespace Health
 namespace HealthErrorMapper
 {
 
-static const int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::HashString("InvalidPaginationToken");
-static const int UNSUPPORTED_LOCALE_HASH = HashingUtils::HashString("UnsupportedLocale");
+static constexpr int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidPaginationToken");
+static constexpr int UNSUPPORTED_LOCALE_HASH = HashingUtils::CompileTimeHashString("UnsupportedLocale");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
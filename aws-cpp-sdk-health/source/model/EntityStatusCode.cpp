@@ -30,25 +30,37 @@ namespace Aws
       namespace EntityStatusCodeMapper
       {
 
-        static const int IMPAIRED_HASH = HashingUtils::HashString("IMPAIRED");
-        static const int UNIMPAIRED_HASH = HashingUtils::HashString("UNIMPAIRED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
+        static constexpr int IMPAIRED_HASH = HashingUtils::CompileTimeHashString("IMPAIRED");
+        static constexpr int UNIMPAIRED_HASH = HashingUtils::CompileTimeHashString("UNIMPAIRED");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
 
 
         EntityStatusCode GetEntityStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMPAIRED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EntityStatusCode::IMPAIRED;
-          }
-          else if (hashCode == UNIMPAIRED_HASH)
-          {
-            return EntityStatusCode::UNIMPAIRED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return EntityStatusCode::UNKNOWN;
+          case IMPAIRED_HASH:
+            if (name == "IMPAIRED")
+            {
+              return EntityStatusCode::IMPAIRED;
+            }
+            break;
+          case UNIMPAIRED_HASH:
+            if (name == "UNIMPAIRED")
+            {
+              return EntityStatusCode::UNIMPAIRED;
+            }
+            break;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return EntityStatusCode::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return EntityStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForEntityStatusCode(EntityStatusCode enumValue)
+        const char* GetNameForEntityStatusCode(EntityStatusCode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace EventAggregateFieldMapper
       {
 
-        static const int eventTypeCategory_HASH = HashingUtils::HashString("eventTypeCategory");
+        static constexpr int eventTypeCategory_HASH = HashingUtils::CompileTimeHashString("eventTypeCategory");
 
 
         EventAggregateField GetEventAggregateFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == eventTypeCategory_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventAggregateField::eventTypeCategory;
+          case eventTypeCategory_HASH:
+            if (name == "eventTypeCategory")
+            {
+              return EventAggregateField::eventTypeCategory;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return EventAggregateField::NOT_SET;
         }
 
-        Aws::String GetNameForEventAggregateField(EventAggregateField enumValue)
+        const char* GetNameForEventAggregateField(EventAggregateField enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace EventStatusCodeMapper
       {
 
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int closed_HASH = HashingUtils::HashString("closed");
-        static const int upcoming_HASH = HashingUtils::HashString("upcoming");
+        static constexpr int open_HASH = HashingUtils::CompileTimeHashString("open");
+        static constexpr int closed_HASH = HashingUtils::CompileTimeHashString("closed");
+        static constexpr int upcoming_HASH = HashingUtils::CompileTimeHashString("upcoming");
 
 
         EventStatusCode GetEventStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == open_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventStatusCode::open;
-          }
-          else if (hashCode == closed_HASH)
-          {
-            return EventStatusCode::closed;
-          }
-          else if (hashCode == upcoming_HASH)
-          {
-            return EventStatusCode::upcoming;
+          case open_HASH:
+            if (name == "open")
+            {
+              return EventStatusCode::open;
+            }
+            break;
+          case closed_HASH:
+            if (name == "closed")
+            {
+              return EventStatusCode::closed;
+            }
+            break;
+          case upcoming_HASH:
+            if (name == "upcoming")
+            {
+              return EventStatusCode::upcoming;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return EventStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForEventStatusCode(EventStatusCode enumValue)
+        const char* GetNameForEventStatusCode(EventStatusCode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
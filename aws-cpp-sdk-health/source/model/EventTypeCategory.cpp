@@ -30,25 +30,37 @@ namespace Aws
       namespace EventTypeCategoryMapper
       {
 
-        static const int issue_HASH = HashingUtils::HashString("issue");
-        static const int accountNotification_HASH = HashingUtils::HashString("accountNotification");
-        static const int scheduledChange_HASH = HashingUtils::HashString("scheduledChange");
+        static constexpr int issue_HASH = HashingUtils::CompileTimeHashString("issue");
+        static constexpr int accountNotification_HASH = HashingUtils::CompileTimeHashString("accountNotification");
+        static constexpr int scheduledChange_HASH = HashingUtils::CompileTimeHashString("scheduledChange");
 
 
         EventTypeCategory GetEventTypeCategoryForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == issue_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventTypeCategory::issue;
-          }
-          else if (hashCode == accountNotification_HASH)
-          {
-            return EventTypeCategory::accountNotification;
-          }
-          else if (hashCode == scheduledChange_HASH)
-          {
-            return EventTypeCategory::scheduledChange;
+          case issue_HASH:
+            if (name == "issue")
+            {
+              return EventTypeCategory::issue;
+            }
+            break;
+          case accountNotification_HASH:
+            if (name == "accountNotification")
+            {
+              return EventTypeCategory::accountNotification;
+            }
+            break;
+          case scheduledChange_HASH:
+            if (name == "scheduledChange")
+            {
+              return EventTypeCategory::scheduledChange;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return EventTypeCategory::NOT_SET;
         }
 
-        Aws::String GetNameForEventTypeCategory(EventTypeCategory enumValue)
+        const char* GetNameForEventTypeCategory(EventTypeCategory enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace AssignmentStatusTypeMapper
 {
 AWS_IAM_API AssignmentStatusType GetAssignmentStatusTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForAssignmentStatusType(AssignmentStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForAssignmentStatusType(AssignmentStatusType value);
 } // namespace AssignmentStatusTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -44,7 +44,8 @@ namespace ContextKeyTypeEnumMapper
 {
 AWS_IAM_API ContextKeyTypeEnum GetContextKeyTypeEnumForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForContextKeyTypeEnum(ContextKeyTypeEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForContextKeyTypeEnum(ContextKeyTypeEnum value);
 } // namespace ContextKeyTypeEnumMapper
 } // namespace Model
 } // namespace IAM
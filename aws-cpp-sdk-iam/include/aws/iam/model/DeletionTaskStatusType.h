@@ -36,7 +36,8 @@ namespace DeletionTaskStatusTypeMapper
 {
 AWS_IAM_API DeletionTaskStatusType GetDeletionTaskStatusTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForDeletionTaskStatusType(DeletionTaskStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForDeletionTaskStatusType(DeletionTaskStatusType value);
 } // namespace DeletionTaskStatusTypeMapper
 } // namespace Model
 } // namespace IAM
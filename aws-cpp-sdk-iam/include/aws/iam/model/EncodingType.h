@@ -34,7 +34,8 @@ namespace EncodingTypeMapper
 {
 AWS_IAM_API EncodingType GetEncodingTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForEncodingType(EncodingType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForEncodingType(EncodingType value);
 } // namespace EncodingTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -37,7 +37,8 @@ namespace EntityTypeMapper
 {
 AWS_IAM_API EntityType GetEntityTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForEntityType(EntityType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForEntityType(EntityType value);
 } // namespace EntityTypeMapper
 } // namespace Model
 } // namespace IAM
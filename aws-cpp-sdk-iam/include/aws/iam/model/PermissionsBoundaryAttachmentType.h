@@ -33,7 +33,8 @@ namespace PermissionsBoundaryAttachmentTypeMapper
 {
 AWS_IAM_API PermissionsBoundaryAttachmentType GetPermissionsBoundaryAttachmentTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForPermissionsBoundaryAttachmentType(PermissionsBoundaryAttachmentType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForPermissionsBoundaryAttachmentType(PermissionsBoundaryAttachmentType value);
 } // namespace PermissionsBoundaryAttachmentTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -35,7 +35,8 @@ namespace PolicyEvaluationDecisionTypeMapper
 {
 AWS_IAM_API PolicyEvaluationDecisionType GetPolicyEvaluationDecisionTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForPolicyEvaluationDecisionType(PolicyEvaluationDecisionType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForPolicyEvaluationDecisionType(PolicyEvaluationDecisionType value);
 } // namespace PolicyEvaluationDecisionTypeMapper
 } // namespace Model
 } // namespace IAM
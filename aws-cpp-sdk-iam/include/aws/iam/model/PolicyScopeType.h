@@ -35,7 +35,8 @@ namespace PolicyScopeTypeMapper
 {
 AWS_IAM_API PolicyScopeType GetPolicyScopeTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForPolicyScopeType(PolicyScopeType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForPolicyScopeType(PolicyScopeType value);
 } // namespace PolicyScopeTypeMapper
 } // namespace Model
 } // namespace IAM
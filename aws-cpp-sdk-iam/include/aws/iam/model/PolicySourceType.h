@@ -39,7 +39,8 @@ namespace PolicySourceTypeMapper
 {
 AWS_IAM_API PolicySourceType GetPolicySourceTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForPolicySourceType(PolicySourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForPolicySourceType(PolicySourceType value);
 } // namespace PolicySourceTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -34,7 +34,8 @@ namespace PolicyUsageTypeMapper
 {
 AWS_IAM_API PolicyUsageType GetPolicyUsageTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForPolicyUsageType(PolicyUsageType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForPolicyUsageType(PolicyUsageType value);
 } // namespace PolicyUsageTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -33,7 +33,8 @@ namespace ReportFormatTypeMapper
 {
 AWS_IAM_API ReportFormatType GetReportFormatTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForReportFormatType(ReportFormatType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForReportFormatType(ReportFormatType value);
 } // namespace ReportFormatTypeMapper
 } // namespace Model
 } // namespace IAM
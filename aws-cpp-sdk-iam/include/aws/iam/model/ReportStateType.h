@@ -35,7 +35,8 @@ namespace ReportStateTypeMapper
 {
 AWS_IAM_API ReportStateType GetReportStateTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForReportStateType(ReportStateType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForReportStateType(ReportStateType value);
 } // namespace ReportStateTypeMapper
 } // namespace Model
 } // namespace IAM
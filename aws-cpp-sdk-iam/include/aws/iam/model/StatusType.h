@@ -34,7 +34,8 @@ namespace StatusTypeMapper
 {
 AWS_IAM_API StatusType GetStatusTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForStatusType(StatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForStatusType(StatusType value);
 } // namespace StatusTypeMapper
 } // namespace Model
 } // namespace IAM
@@ -57,7 +57,8 @@ namespace SummaryKeyTypeMapper
 {
 AWS_IAM_API SummaryKeyType GetSummaryKeyTypeForName(const Aws::String& name);
 
-AWS_IAM_API Aws::String GetNameForSummaryKeyType(SummaryKeyType value);
+// names of values not modeled point into the enum overflow container
+AWS_IAM_API const char* GetNameForSummaryKeyType(SummaryKeyType value);
 } // namespace SummaryKeyTypeMapper
 } // namespace Model
 } // namespace IAM
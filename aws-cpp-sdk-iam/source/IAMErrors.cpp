@@ -28,31 +28,31 @@ namespace IAM
 namespace IAMErrorMapper
 {
 
-static const int CREDENTIAL_REPORT_NOT_PRESENT_HASH = HashingUtils::HashString("ReportNotPresent");
-static const int DUPLICATE_CERTIFICATE_HASH = HashingUtils::HashString("DuplicateCertificate");
-static const int PASSWORD_POLICY_VIOLATION_HASH = HashingUtils::HashString("PasswordPolicyViolation");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInput");
-static const int UNRECOGNIZED_PUBLIC_KEY_ENCODING_HASH = HashingUtils::HashString("UnrecognizedPublicKeyEncoding");
-static const int CREDENTIAL_REPORT_EXPIRED_HASH = HashingUtils::HashString("ReportExpired");
-static const int NO_SUCH_ENTITY_HASH = HashingUtils::HashString("NoSuchEntity");
-static const int KEY_PAIR_MISMATCH_HASH = HashingUtils::HashString("KeyPairMismatch");
-static const int MALFORMED_CERTIFICATE_HASH = HashingUtils::HashString("MalformedCertificate");
-static const int CREDENTIAL_REPORT_NOT_READY_HASH = HashingUtils::HashString("ReportInProgress");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceeded");
-static const int ENTITY_TEMPORARILY_UNMODIFIABLE_HASH = HashingUtils::HashString("EntityTemporarilyUnmodifiable");
-static const int SERVICE_FAILURE_HASH = HashingUtils::HashString("ServiceFailure");
-static const int ENTITY_ALREADY_EXISTS_HASH = HashingUtils::HashString("EntityAlreadyExists");
-static const int POLICY_EVALUATION_HASH = HashingUtils::HashString("PolicyEvaluation");
-static const int INVALID_USER_TYPE_HASH = HashingUtils::HashString("InvalidUserType");
-static const int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::HashString("MalformedPolicyDocument");
-static const int SERVICE_NOT_SUPPORTED_HASH = HashingUtils::HashString("NotSupportedService");
-static const int UNMODIFIABLE_ENTITY_HASH = HashingUtils::HashString("UnmodifiableEntity");
-static const int INVALID_AUTHENTICATION_CODE_HASH = HashingUtils::HashString("InvalidAuthenticationCode");
-static const int POLICY_NOT_ATTACHABLE_HASH = HashingUtils::HashString("PolicyNotAttachable");
-static const int DELETE_CONFLICT_HASH = HashingUtils::HashString("DeleteConflict");
-static const int DUPLICATE_S_S_H_PUBLIC_KEY_HASH = HashingUtils::HashString("DuplicateSSHPublicKey");
-static const int INVALID_CERTIFICATE_HASH = HashingUtils::HashString("InvalidCertificate");
-static const int INVALID_PUBLIC_KEY_HASH = HashingUtils::HashString("InvalidPublicKey");
+static constexpr int CREDENTIAL_REPORT_NOT_PRESENT_HASH = HashingUtils::CompileTimeHashString("ReportNotPresent");
+static constexpr int DUPLICATE_CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("DuplicateCertificate");
+static constexpr int PASSWORD_POLICY_VIOLATION_HASH = HashingUtils::CompileTimeHashString("PasswordPolicyViolation");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInput");
+static constexpr int UNRECOGNIZED_PUBLIC_KEY_ENCODING_HASH = HashingUtils::CompileTimeHashString("UnrecognizedPublicKeyEncoding");
+static constexpr int CREDENTIAL_REPORT_EXPIRED_HASH = HashingUtils::CompileTimeHashString("ReportExpired");
+static constexpr int NO_SUCH_ENTITY_HASH = HashingUtils::CompileTimeHashString("NoSuchEntity");
+static constexpr int KEY_PAIR_MISMATCH_HASH = HashingUtils::CompileTimeHashString("KeyPairMismatch");
+static constexpr int MALFORMED_CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("MalformedCertificate");
+static constexpr int CREDENTIAL_REPORT_NOT_READY_HASH = HashingUtils::CompileTimeHashString("ReportInProgress");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceeded");
+static constexpr int ENTITY_TEMPORARILY_UNMODIFIABLE_HASH = HashingUtils::CompileTimeHashString("EntityTemporarilyUnmodifiable");
+static constexpr int SERVICE_FAILURE_HASH = HashingUtils::CompileTimeHashString("ServiceFailure");
+static constexpr int ENTITY_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("EntityAlreadyExists");
+static constexpr int POLICY_EVALUATION_HASH = HashingUtils::CompileTimeHashString("PolicyEvaluation");
+static constexpr int INVALID_USER_TYPE_HASH = HashingUtils::CompileTimeHashString("InvalidUserType");
+static constexpr int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::CompileTimeHashString("MalformedPolicyDocument");
+static constexpr int SERVICE_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("NotSupportedService");
+static constexpr int UNMODIFIABLE_ENTITY_HASH = HashingUtils::CompileTimeHashString("UnmodifiableEntity");
+static constexpr int INVALID_AUTHENTICATION_CODE_HASH = HashingUtils::CompileTimeHashString("InvalidAuthenticationCode");
+static constexpr int POLICY_NOT_ATTACHABLE_HASH = HashingUtils::CompileTimeHashString("PolicyNotAttachable");
+static constexpr int DELETE_CONFLICT_HASH = HashingUtils::CompileTimeHashString("DeleteConflict");
+static constexpr int DUPLICATE_S_S_H_PUBLIC_KEY_HASH = HashingUtils::CompileTimeHashString("DuplicateSSHPublicKey");
+static constexpr int INVALID_CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("InvalidCertificate");
+static constexpr int INVALID_PUBLIC_KEY_HASH = HashingUtils::CompileTimeHashString("InvalidPublicKey");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace AssignmentStatusTypeMapper
       {
 
-        static const int Assigned_HASH = HashingUtils::HashString("Assigned");
-        static const int Unassigned_HASH = HashingUtils::HashString("Unassigned");
-        static const int Any_HASH = HashingUtils::HashString("Any");
+        static constexpr int Assigned_HASH = HashingUtils::CompileTimeHashString("Assigned");
+        static constexpr int Unassigned_HASH = HashingUtils::CompileTimeHashString("Unassigned");
+        static constexpr int Any_HASH = HashingUtils::CompileTimeHashString("Any");
 
 
         AssignmentStatusType GetAssignmentStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Assigned_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssignmentStatusType::Assigned;
-          }
-          else if (hashCode == Unassigned_HASH)
-          {
-            return AssignmentStatusType::Unassigned;
-          }
-          else if (hashCode == Any_HASH)
-          {
-            return AssignmentStatusType::Any;
+          case Assigned_HASH:
+            if (name == "Assigned")
+            {
+              return AssignmentStatusType::Assigned;
+            }
+            break;
+          case Unassigned_HASH:
+            if (name == "Unassigned")
+            {
+              return AssignmentStatusType::Unassigned;
+            }
+            break;
+          case Any_HASH:
+            if (name == "Any")
+            {
+              return AssignmentStatusType::Any;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AssignmentStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForAssignmentStatusType(AssignmentStatusType enumValue)
+        const char* GetNameForAssignmentStatusType(AssignmentStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
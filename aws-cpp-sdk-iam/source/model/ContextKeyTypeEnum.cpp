@@ -30,70 +30,100 @@ namespace Aws
       namespace ContextKeyTypeEnumMapper
       {
 
-        static const int string_HASH = HashingUtils::HashString("string");
-        static const int stringList_HASH = HashingUtils::HashString("stringList");
-        static const int numeric_HASH = HashingUtils::HashString("numeric");
-        static const int numericList_HASH = HashingUtils::HashString("numericList");
-        static const int boolean_HASH = HashingUtils::HashString("boolean");
-        static const int booleanList_HASH = HashingUtils::HashString("booleanList");
-        static const int ip_HASH = HashingUtils::HashString("ip");
-        static const int ipList_HASH = HashingUtils::HashString("ipList");
-        static const int binary_HASH = HashingUtils::HashString("binary");
-        static const int binaryList_HASH = HashingUtils::HashString("binaryList");
-        static const int date_HASH = HashingUtils::HashString("date");
-        static const int dateList_HASH = HashingUtils::HashString("dateList");
+        static constexpr int string_HASH = HashingUtils::CompileTimeHashString("string");
+        static constexpr int stringList_HASH = HashingUtils::CompileTimeHashString("stringList");
+        static constexpr int numeric_HASH = HashingUtils::CompileTimeHashString("numeric");
+        static constexpr int numericList_HASH = HashingUtils::CompileTimeHashString("numericList");
+        static constexpr int boolean_HASH = HashingUtils::CompileTimeHashString("boolean");
+        static constexpr int booleanList_HASH = HashingUtils::CompileTimeHashString("booleanList");
+        static constexpr int ip_HASH = HashingUtils::CompileTimeHashString("ip");
+        static constexpr int ipList_HASH = HashingUtils::CompileTimeHashString("ipList");
+        static constexpr int binary_HASH = HashingUtils::CompileTimeHashString("binary");
+        static constexpr int binaryList_HASH = HashingUtils::CompileTimeHashString("binaryList");
+        static constexpr int date_HASH = HashingUtils::CompileTimeHashString("date");
+        static constexpr int dateList_HASH = HashingUtils::CompileTimeHashString("dateList");
 
 
         ContextKeyTypeEnum GetContextKeyTypeEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == string_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContextKeyTypeEnum::string;
-          }
-          else if (hashCode == stringList_HASH)
-          {
-            return ContextKeyTypeEnum::stringList;
-          }
-          else if (hashCode == numeric_HASH)
-          {
-            return ContextKeyTypeEnum::numeric;
-          }
-          else if (hashCode == numericList_HASH)
-          {
-            return ContextKeyTypeEnum::numericList;
-          }
-          else if (hashCode == boolean_HASH)
-          {
-            return ContextKeyTypeEnum::boolean;
-          }
-          else if (hashCode == booleanList_HASH)
-          {
-            return ContextKeyTypeEnum::booleanList;
-          }
-          else if (hashCode == ip_HASH)
-          {
-            return ContextKeyTypeEnum::ip;
-          }
-          else if (hashCode == ipList_HASH)
-          {
-            return ContextKeyTypeEnum::ipList;
-          }
-          else if (hashCode == binary_HASH)
-          {
-            return ContextKeyTypeEnum::binary;
-          }
-          else if (hashCode == binaryList_HASH)
-          {
-            return ContextKeyTypeEnum::binaryList;
-          }
-          else if (hashCode == date_HASH)
-          {
-            return ContextKeyTypeEnum::date;
-          }
-          else if (hashCode == dateList_HASH)
-          {
-            return ContextKeyTypeEnum::dateList;
+          case string_HASH:
+            if (name == "string")
+            {
+              return ContextKeyTypeEnum::string;
+            }
+            break;
+          case stringList_HASH:
+            if (name == "stringList")
+            {
+              return ContextKeyTypeEnum::stringList;
+            }
+            break;
+          case numeric_HASH:
+            if (name == "numeric")
+            {
+              return ContextKeyTypeEnum::numeric;
+            }
+            break;
+          case numericList_HASH:
+            if (name == "numericList")
+            {
+              return ContextKeyTypeEnum::numericList;
+            }
+            break;
+          case boolean_HASH:
+            if (name == "boolean")
+            {
+              return ContextKeyTypeEnum::boolean;
+            }
+            break;
+          case booleanList_HASH:
+            if (name == "booleanList")
+            {
+              return ContextKeyTypeEnum::booleanList;
+            }
+            break;
+          case ip_HASH:
+            if (name == "ip")
+            {
+              return ContextKeyTypeEnum::ip;
+            }
+            break;
+          case ipList_HASH:
+            if (name == "ipList")
+            {
+              return ContextKeyTypeEnum::ipList;
+            }
+            break;
+          case binary_HASH:
+            if (name == "binary")
+            {
+              return ContextKeyTypeEnum::binary;
+            }
+            break;
+          case binaryList_HASH:
+            if (name == "binaryList")
+            {
+              return ContextKeyTypeEnum::binaryList;
+            }
+            break;
+          case date_HASH:
+            if (name == "date")
+            {
+              return ContextKeyTypeEnum::date;
+            }
+            break;
+          case dateList_HASH:
+            if (name == "dateList")
+            {
+              return ContextKeyTypeEnum::dateList;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return ContextKeyTypeEnum::NOT_SET;
         }
 
-        Aws::String GetNameForContextKeyTypeEnum(ContextKeyTypeEnum enumValue)
+        const char* GetNameForContextKeyTypeEnum(ContextKeyTypeEnum enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace DeletionTaskStatusTypeMapper
       {
 
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int NOT_STARTED_HASH = HashingUtils::HashString("NOT_STARTED");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int NOT_STARTED_HASH = HashingUtils::CompileTimeHashString("NOT_STARTED");
 
 
         DeletionTaskStatusType GetDeletionTaskStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeletionTaskStatusType::SUCCEEDED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return DeletionTaskStatusType::IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return DeletionTaskStatusType::FAILED;
-          }
-          else if (hashCode == NOT_STARTED_HASH)
-          {
-            return DeletionTaskStatusType::NOT_STARTED;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return DeletionTaskStatusType::SUCCEEDED;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return DeletionTaskStatusType::IN_PROGRESS;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return DeletionTaskStatusType::FAILED;
+            }
+            break;
+          case NOT_STARTED_HASH:
+            if (name == "NOT_STARTED")
+            {
+              return DeletionTaskStatusType::NOT_STARTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DeletionTaskStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForDeletionTaskStatusType(DeletionTaskStatusType enumValue)
+        const char* GetNameForDeletionTaskStatusType(DeletionTaskStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
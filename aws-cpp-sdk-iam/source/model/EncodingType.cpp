@@ -30,20 +30,30 @@ namespace Aws
       namespace EncodingTypeMapper
       {
 
-        static const int SSH_HASH = HashingUtils::HashString("SSH");
-        static const int PEM_HASH = HashingUtils::HashString("PEM");
+        static constexpr int SSH_HASH = HashingUtils::CompileTimeHashString("SSH");
+        static constexpr int PEM_HASH = HashingUtils::CompileTimeHashString("PEM");
 
 
         EncodingType GetEncodingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SSH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EncodingType::SSH;
-          }
-          else if (hashCode == PEM_HASH)
-          {
-            return EncodingType::PEM;
+          case SSH_HASH:
+            if (name == "SSH")
+            {
+              return EncodingType::SSH;
+            }
+            break;
+          case PEM_HASH:
+            if (name == "PEM")
+            {
+              return EncodingType::PEM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EncodingType::NOT_SET;
         }
 
-        Aws::String GetNameForEncodingType(EncodingType enumValue)
+        const char* GetNameForEncodingType(EncodingType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace EntityTypeMapper
       {
 
-        static const int User_HASH = HashingUtils::HashString("User");
-        static const int Role_HASH = HashingUtils::HashString("Role");
-        static const int Group_HASH = HashingUtils::HashString("Group");
-        static const int LocalManagedPolicy_HASH = HashingUtils::HashString("LocalManagedPolicy");
-        static const int AWSManagedPolicy_HASH = HashingUtils::HashString("AWSManagedPolicy");
+        static constexpr int User_HASH = HashingUtils::CompileTimeHashString("User");
+        static constexpr int Role_HASH = HashingUtils::CompileTimeHashString("Role");
+        static constexpr int Group_HASH = HashingUtils::CompileTimeHashString("Group");
+        static constexpr int LocalManagedPolicy_HASH = HashingUtils::CompileTimeHashString("LocalManagedPolicy");
+        static constexpr int AWSManagedPolicy_HASH = HashingUtils::CompileTimeHashString("AWSManagedPolicy");
 
 
         EntityType GetEntityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == User_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EntityType::User;
-          }
-          else if (hashCode == Role_HASH)
-          {
-            return EntityType::Role;
-          }
-          else if (hashCode == Group_HASH)
-          {
-            return EntityType::Group;
-          }
-          else if (hashCode == LocalManagedPolicy_HASH)
-          {
-            return EntityType::LocalManagedPolicy;
-          }
-          else if (hashCode == AWSManagedPolicy_HASH)
-          {
-            return EntityType::AWSManagedPolicy;
+          case User_HASH:
+            if (name == "User")
+            {
+              return EntityType::User;
+            }
+            break;
+          case Role_HASH:
+            if (name == "Role")
+            {
+              return EntityType::Role;
+            }
+            break;
+          case Group_HASH:
+            if (name == "Group")
+            {
+              return EntityType::Group;
+            }
+            break;
+          case LocalManagedPolicy_HASH:
+            if (name == "LocalManagedPolicy")
+            {
+              return EntityType::LocalManagedPolicy;
+            }
+            break;
+          case AWSManagedPolicy_HASH:
+            if (name == "AWSManagedPolicy")
+            {
+              return EntityType::AWSManagedPolicy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return EntityType::NOT_SET;
         }
 
-        Aws::String GetNameForEntityType(EntityType enumValue)
+        const char* GetNameForEntityType(EntityType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
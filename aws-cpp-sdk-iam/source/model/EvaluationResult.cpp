@@ -196,7 +196,7 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
         oStream << location << index << locationValue << ".EvalDecisionDetails.entry." << evalDecisionDetailsIdx << ".key="
             << StringUtils::URLEncode(item.first.c_str()) << "&";
         oStream << location << index << locationValue << ".EvalDecisionDetails.entry." << evalDecisionDetailsIdx << ".value="
-            << StringUtils::URLEncode(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second).c_str()) << "&";
+            << StringUtils::URLEncode(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second)) << "&";
         evalDecisionDetailsIdx++;
       }
   }
@@ -260,7 +260,7 @@ void EvaluationResult::OutputToStream(Aws::OStream& oStream, const char* locatio
         oStream << location << ".EvalDecisionDetails.entry."  << evalDecisionDetailsIdx << ".key="
             << StringUtils::URLEncode(item.first.c_str()) << "&";
         oStream << location <<  ".EvalDecisionDetails.entry." << evalDecisionDetailsIdx << ".value="
-            << StringUtils::URLEncode(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second).c_str()) << "&";
+            << StringUtils::URLEncode(PolicyEvaluationDecisionTypeMapper::GetNameForPolicyEvaluationDecisionType(item.second)) << "&";
         evalDecisionDetailsIdx++;
       }
 
@@ -30,15 +30,23 @@ namespace Aws
       namespace PermissionsBoundaryAttachmentTypeMapper
       {
 
-        static const int PermissionsBoundaryPolicy_HASH = HashingUtils::HashString("PermissionsBoundaryPolicy");
+        static constexpr int PermissionsBoundaryPolicy_HASH = HashingUtils::CompileTimeHashString("PermissionsBoundaryPolicy");
 
 
         PermissionsBoundaryAttachmentType GetPermissionsBoundaryAttachmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PermissionsBoundaryPolicy_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PermissionsBoundaryAttachmentType::PermissionsBoundaryPolicy;
+          case PermissionsBoundaryPolicy_HASH:
+            if (name == "PermissionsBoundaryPolicy")
+            {
+              return PermissionsBoundaryAttachmentType::PermissionsBoundaryPolicy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return PermissionsBoundaryAttachmentType::NOT_SET;
         }
 
-        Aws::String GetNameForPermissionsBoundaryAttachmentType(PermissionsBoundaryAttachmentType enumValue)
+        const char* GetNameForPermissionsBoundaryAttachmentType(PermissionsBoundaryAttachmentType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
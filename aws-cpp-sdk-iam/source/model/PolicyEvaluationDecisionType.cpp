@@ -30,25 +30,37 @@ namespace Aws
       namespace PolicyEvaluationDecisionTypeMapper
       {
 
-        static const int allowed_HASH = HashingUtils::HashString("allowed");
-        static const int explicitDeny_HASH = HashingUtils::HashString("explicitDeny");
-        static const int implicitDeny_HASH = HashingUtils::HashString("implicitDeny");
+        static constexpr int allowed_HASH = HashingUtils::CompileTimeHashString("allowed");
+        static constexpr int explicitDeny_HASH = HashingUtils::CompileTimeHashString("explicitDeny");
+        static constexpr int implicitDeny_HASH = HashingUtils::CompileTimeHashString("implicitDeny");
 
 
         PolicyEvaluationDecisionType GetPolicyEvaluationDecisionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == allowed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PolicyEvaluationDecisionType::allowed;
-          }
-          else if (hashCode == explicitDeny_HASH)
-          {
-            return PolicyEvaluationDecisionType::explicitDeny;
-          }
-          else if (hashCode == implicitDeny_HASH)
-          {
-            return PolicyEvaluationDecisionType::implicitDeny;
+          case allowed_HASH:
+            if (name == "allowed")
+            {
+              return PolicyEvaluationDecisionType::allowed;
+            }
+            break;
+          case explicitDeny_HASH:
+            if (name == "explicitDeny")
+            {
+              return PolicyEvaluationDecisionType::explicitDeny;
+            }
+            break;
+          case implicitDeny_HASH:
+            if (name == "implicitDeny")
+            {
+              return PolicyEvaluationDecisionType::implicitDeny;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PolicyEvaluationDecisionType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyEvaluationDecisionType(PolicyEvaluationDecisionType enumValue)
+        const char* GetNameForPolicyEvaluationDecisionType(PolicyEvaluationDecisionType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
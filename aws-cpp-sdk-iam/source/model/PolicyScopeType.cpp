@@ -30,25 +30,37 @@ namespace Aws
       namespace PolicyScopeTypeMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int Local_HASH = HashingUtils::HashString("Local");
+        static constexpr int All_HASH = HashingUtils::CompileTimeHashString("All");
+        static constexpr int AWS_HASH = HashingUtils::CompileTimeHashString("AWS");
+        static constexpr int Local_HASH = HashingUtils::CompileTimeHashString("Local");
 
 
         PolicyScopeType GetPolicyScopeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PolicyScopeType::All;
-          }
-          else if (hashCode == AWS_HASH)
-          {
-            return PolicyScopeType::AWS;
-          }
-          else if (hashCode == Local_HASH)
-          {
-            return PolicyScopeType::Local;
+          case All_HASH:
+            if (name == "All")
+            {
+              return PolicyScopeType::All;
+            }
+            break;
+          case AWS_HASH:
+            if (name == "AWS")
+            {
+              return PolicyScopeType::AWS;
+            }
+            break;
+          case Local_HASH:
+            if (name == "Local")
+            {
+              return PolicyScopeType::Local;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PolicyScopeType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyScopeType(PolicyScopeType enumValue)
+        const char* GetNameForPolicyScopeType(PolicyScopeType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace PolicySourceTypeMapper
       {
 
-        static const int user_HASH = HashingUtils::HashString("user");
-        static const int group_HASH = HashingUtils::HashString("group");
-        static const int role_HASH = HashingUtils::HashString("role");
-        static const int aws_managed_HASH = HashingUtils::HashString("aws-managed");
-        static const int user_managed_HASH = HashingUtils::HashString("user-managed");
-        static const int resource_HASH = HashingUtils::HashString("resource");
-        static const int none_HASH = HashingUtils::HashString("none");
+        static constexpr int user_HASH = HashingUtils::CompileTimeHashString("user");
+        static constexpr int group_HASH = HashingUtils::CompileTimeHashString("group");
+        static constexpr int role_HASH = HashingUtils::CompileTimeHashString("role");
+        static constexpr int aws_managed_HASH = HashingUtils::CompileTimeHashString("aws-managed");
+        static constexpr int user_managed_HASH = HashingUtils::CompileTimeHashString("user-managed");
+        static constexpr int resource_HASH = HashingUtils::CompileTimeHashString("resource");
+        static constexpr int none_HASH = HashingUtils::CompileTimeHashString("none");
 
 
         PolicySourceType GetPolicySourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == user_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PolicySourceType::user;
-          }
-          else if (hashCode == group_HASH)
-          {
-            return PolicySourceType::group;
-          }
-          else if (hashCode == role_HASH)
-          {
-            return PolicySourceType::role;
-          }
-          else if (hashCode == aws_managed_HASH)
-          {
-            return PolicySourceType::aws_managed;
-          }
-          else if (hashCode == user_managed_HASH)
-          {
-            return PolicySourceType::user_managed;
-          }
-          else if (hashCode == resource_HASH)
-          {
-            return PolicySourceType::resource;
-          }
-          else if (hashCode == none_HASH)
-          {
-            return PolicySourceType::none;
+          case user_HASH:
+            if (name == "user")
+            {
+              return PolicySourceType::user;
+            }
+            break;
+          case group_HASH:
+            if (name == "group")
+            {
+              return PolicySourceType::group;
+            }
+            break;
+          case role_HASH:
+            if (name == "role")
+            {
+              return PolicySourceType::role;
+            }
+            break;
+          case aws_managed_HASH:
+            if (name == "aws-managed")
+            {
+              return PolicySourceType::aws_managed;
+            }
+            break;
+          case user_managed_HASH:
+            if (name == "user-managed")
+            {
+              return PolicySourceType::user_managed;
+            }
+            break;
+          case resource_HASH:
+            if (name == "resource")
+            {
+              return PolicySourceType::resource;
+            }
+            break;
+          case none_HASH:
+            if (name == "none")
+            {
+              return PolicySourceType::none;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return PolicySourceType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicySourceType(PolicySourceType enumValue)
+        const char* GetNameForPolicySourceType(PolicySourceType enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PolicyUsageTypeMapper
       {
 
-        static const int PermissionsPolicy_HASH = HashingUtils::HashString("PermissionsPolicy");
-        static const int PermissionsBoundary_HASH = HashingUtils::HashString("PermissionsBoundary");
+        static constexpr int PermissionsPolicy_HASH = HashingUtils::CompileTimeHashString("PermissionsPolicy");
+        static constexpr int PermissionsBoundary_HASH = HashingUtils::CompileTimeHashString("PermissionsBoundary");
 
 
         PolicyUsageType GetPolicyUsageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PermissionsPolicy_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PolicyUsageType::PermissionsPolicy;
-          }
-          else if (hashCode == PermissionsBoundary_HASH)
-          {
-            return PolicyUsageType::PermissionsBoundary;
+          case PermissionsPolicy_HASH:
+            if (name == "PermissionsPolicy")
+            {
+              return PolicyUsageType::PermissionsPolicy;
+            }
+            break;
+          case PermissionsBoundary_HASH:
+            if (name == "PermissionsBoundary")
+            {
+              return PolicyUsageType::PermissionsBoundary;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PolicyUsageType::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyUsageType(PolicyUsageType enumValue)
+        const char* GetNameForPolicyUsageType(PolicyUsageType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
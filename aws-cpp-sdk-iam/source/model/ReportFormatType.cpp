@@ -30,15 +30,23 @@ namespace Aws
       namespace ReportFormatTypeMapper
       {
 
-        static const int text_csv_HASH = HashingUtils::HashString("text/csv");
+        static constexpr int text_csv_HASH = HashingUtils::CompileTimeHashString("text/csv");
 
 
         ReportFormatType GetReportFormatTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == text_csv_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReportFormatType::text_csv;
+          case text_csv_HASH:
+            if (name == "text/csv")
+            {
+              return ReportFormatType::text_csv;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ReportFormatType::NOT_SET;
         }
 
-        Aws::String GetNameForReportFormatType(ReportFormatType enumValue)
+        const char* GetNameForReportFormatType(ReportFormatType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
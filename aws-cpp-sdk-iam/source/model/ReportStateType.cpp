@@ -30,25 +30,37 @@ namespace Aws
       namespace ReportStateTypeMapper
       {
 
-        static const int STARTED_HASH = HashingUtils::HashString("STARTED");
-        static const int INPROGRESS_HASH = HashingUtils::HashString("INPROGRESS");
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
+        static constexpr int STARTED_HASH = HashingUtils::CompileTimeHashString("STARTED");
+        static constexpr int INPROGRESS_HASH = HashingUtils::CompileTimeHashString("INPROGRESS");
+        static constexpr int COMPLETE_HASH = HashingUtils::CompileTimeHashString("COMPLETE");
 
 
         ReportStateType GetReportStateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STARTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReportStateType::STARTED;
-          }
-          else if (hashCode == INPROGRESS_HASH)
-          {
-            return ReportStateType::INPROGRESS;
-          }
-          else if (hashCode == COMPLETE_HASH)
-          {
-            return ReportStateType::COMPLETE;
+          case STARTED_HASH:
+            if (name == "STARTED")
+            {
+              return ReportStateType::STARTED;
+            }
+            break;
+          case INPROGRESS_HASH:
+            if (name == "INPROGRESS")
+            {
+              return ReportStateType::INPROGRESS;
+            }
+            break;
+          case COMPLETE_HASH:
+            if (name == "COMPLETE")
+            {
+              return ReportStateType::COMPLETE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ReportStateType::NOT_SET;
         }
 
-        Aws::String GetNameForReportStateType(ReportStateType enumValue)
+        const char* GetNameForReportStateType(ReportStateType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
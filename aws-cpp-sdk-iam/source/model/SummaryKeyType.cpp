@@ -30,135 +30,191 @@ namespace Aws
       namespace SummaryKeyTypeMapper
       {
 
-        static const int Users_HASH = HashingUtils::HashString("Users");
-        static const int UsersQuota_HASH = HashingUtils::HashString("UsersQuota");
-        static const int Groups_HASH = HashingUtils::HashString("Groups");
-        static const int GroupsQuota_HASH = HashingUtils::HashString("GroupsQuota");
-        static const int ServerCertificates_HASH = HashingUtils::HashString("ServerCertificates");
-        static const int ServerCertificatesQuota_HASH = HashingUtils::HashString("ServerCertificatesQuota");
-        static const int UserPolicySizeQuota_HASH = HashingUtils::HashString("UserPolicySizeQuota");
-        static const int GroupPolicySizeQuota_HASH = HashingUtils::HashString("GroupPolicySizeQuota");
-        static const int GroupsPerUserQuota_HASH = HashingUtils::HashString("GroupsPerUserQuota");
-        static const int SigningCertificatesPerUserQuota_HASH = HashingUtils::HashString("SigningCertificatesPerUserQuota");
-        static const int AccessKeysPerUserQuota_HASH = HashingUtils::HashString("AccessKeysPerUserQuota");
-        static const int MFADevices_HASH = HashingUtils::HashString("MFADevices");
-        static const int MFADevicesInUse_HASH = HashingUtils::HashString("MFADevicesInUse");
-        static const int AccountMFAEnabled_HASH = HashingUtils::HashString("AccountMFAEnabled");
-        static const int AccountAccessKeysPresent_HASH = HashingUtils::HashString("AccountAccessKeysPresent");
-        static const int AccountSigningCertificatesPresent_HASH = HashingUtils::HashString("AccountSigningCertificatesPresent");
-        static const int AttachedPoliciesPerGroupQuota_HASH = HashingUtils::HashString("AttachedPoliciesPerGroupQuota");
-        static const int AttachedPoliciesPerRoleQuota_HASH = HashingUtils::HashString("AttachedPoliciesPerRoleQuota");
-        static const int AttachedPoliciesPerUserQuota_HASH = HashingUtils::HashString("AttachedPoliciesPerUserQuota");
-        static const int Policies_HASH = HashingUtils::HashString("Policies");
-        static const int PoliciesQuota_HASH = HashingUtils::HashString("PoliciesQuota");
-        static const int PolicySizeQuota_HASH = HashingUtils::HashString("PolicySizeQuota");
-        static const int PolicyVersionsInUse_HASH = HashingUtils::HashString("PolicyVersionsInUse");
-        static const int PolicyVersionsInUseQuota_HASH = HashingUtils::HashString("PolicyVersionsInUseQuota");
-        static const int VersionsPerPolicyQuota_HASH = HashingUtils::HashString("VersionsPerPolicyQuota");
+        static constexpr int Users_HASH = HashingUtils::CompileTimeHashString("Users");
+        static constexpr int UsersQuota_HASH = HashingUtils::CompileTimeHashString("UsersQuota");
+        static constexpr int Groups_HASH = HashingUtils::CompileTimeHashString("Groups");
+        static constexpr int GroupsQuota_HASH = HashingUtils::CompileTimeHashString("GroupsQuota");
+        static constexpr int ServerCertificates_HASH = HashingUtils::CompileTimeHashString("ServerCertificates");
+        static constexpr int ServerCertificatesQuota_HASH = HashingUtils::CompileTimeHashString("ServerCertificatesQuota");
+        static constexpr int UserPolicySizeQuota_HASH = HashingUtils::CompileTimeHashString("UserPolicySizeQuota");
+        static constexpr int GroupPolicySizeQuota_HASH = HashingUtils::CompileTimeHashString("GroupPolicySizeQuota");
+        static constexpr int GroupsPerUserQuota_HASH = HashingUtils::CompileTimeHashString("GroupsPerUserQuota");
+        static constexpr int SigningCertificatesPerUserQuota_HASH = HashingUtils::CompileTimeHashString("SigningCertificatesPerUserQuota");
+        static constexpr int AccessKeysPerUserQuota_HASH = HashingUtils::CompileTimeHashString("AccessKeysPerUserQuota");
+        static constexpr int MFADevices_HASH = HashingUtils::CompileTimeHashString("MFADevices");
+        static constexpr int MFADevicesInUse_HASH = HashingUtils::CompileTimeHashString("MFADevicesInUse");
+        static constexpr int AccountMFAEnabled_HASH = HashingUtils::CompileTimeHashString("AccountMFAEnabled");
+        static constexpr int AccountAccessKeysPresent_HASH = HashingUtils::CompileTimeHashString("AccountAccessKeysPresent");
+        static constexpr int AccountSigningCertificatesPresent_HASH = HashingUtils::CompileTimeHashString("AccountSigningCertificatesPresent");
+        static constexpr int AttachedPoliciesPerGroupQuota_HASH = HashingUtils::CompileTimeHashString("AttachedPoliciesPerGroupQuota");
+        static constexpr int AttachedPoliciesPerRoleQuota_HASH = HashingUtils::CompileTimeHashString("AttachedPoliciesPerRoleQuota");
+        static constexpr int AttachedPoliciesPerUserQuota_HASH = HashingUtils::CompileTimeHashString("AttachedPoliciesPerUserQuota");
+        static constexpr int Policies_HASH = HashingUtils::CompileTimeHashString("Policies");
+        static constexpr int PoliciesQuota_HASH = HashingUtils::CompileTimeHashString("PoliciesQuota");
+        static constexpr int PolicySizeQuota_HASH = HashingUtils::CompileTimeHashString("PolicySizeQuota");
+        static constexpr int PolicyVersionsInUse_HASH = HashingUtils::CompileTimeHashString("PolicyVersionsInUse");
+        static constexpr int PolicyVersionsInUseQuota_HASH = HashingUtils::CompileTimeHashString("PolicyVersionsInUseQuota");
+        static constexpr int VersionsPerPolicyQuota_HASH = HashingUtils::CompileTimeHashString("VersionsPerPolicyQuota");
 
 
         SummaryKeyType GetSummaryKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Users_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SummaryKeyType::Users;
-          }
-          else if (hashCode == UsersQuota_HASH)
-          {
-            return SummaryKeyType::UsersQuota;
-          }
-          else if (hashCode == Groups_HASH)
-          {
-            return SummaryKeyType::Groups;
-          }
-          else if (hashCode == GroupsQuota_HASH)
-          {
-            return SummaryKeyType::GroupsQuota;
-          }
-          else if (hashCode == ServerCertificates_HASH)
-          {
-            return SummaryKeyType::ServerCertificates;
-          }
-          else if (hashCode == ServerCertificatesQuota_HASH)
-          {
-            return SummaryKeyType::ServerCertificatesQuota;
-          }
-          else if (hashCode == UserPolicySizeQuota_HASH)
-          {
-            return SummaryKeyType::UserPolicySizeQuota;
-          }
-          else if (hashCode == GroupPolicySizeQuota_HASH)
-          {
-            return SummaryKeyType::GroupPolicySizeQuota;
-          }
-          else if (hashCode == GroupsPerUserQuota_HASH)
-          {
-            return SummaryKeyType::GroupsPerUserQuota;
-          }
-          else if (hashCode == SigningCertificatesPerUserQuota_HASH)
-          {
-            return SummaryKeyType::SigningCertificatesPerUserQuota;
-          }
-          else if (hashCode == AccessKeysPerUserQuota_HASH)
-          {
-            return SummaryKeyType::AccessKeysPerUserQuota;
-          }
-          else if (hashCode == MFADevices_HASH)
-          {
-            return SummaryKeyType::MFADevices;
-          }
-          else if (hashCode == MFADevicesInUse_HASH)
-          {
-            return SummaryKeyType::MFADevicesInUse;
-          }
-          else if (hashCode == AccountMFAEnabled_HASH)
-          {
-            return SummaryKeyType::AccountMFAEnabled;
-          }
-          else if (hashCode == AccountAccessKeysPresent_HASH)
-          {
-            return SummaryKeyType::AccountAccessKeysPresent;
-          }
-          else if (hashCode == AccountSigningCertificatesPresent_HASH)
-          {
-            return SummaryKeyType::AccountSigningCertificatesPresent;
-          }
-          else if (hashCode == AttachedPoliciesPerGroupQuota_HASH)
-          {
-            return SummaryKeyType::AttachedPoliciesPerGroupQuota;
-          }
-          else if (hashCode == AttachedPoliciesPerRoleQuota_HASH)
-          {
-            return SummaryKeyType::AttachedPoliciesPerRoleQuota;
-          }
-          else if (hashCode == AttachedPoliciesPerUserQuota_HASH)
-          {
-            return SummaryKeyType::AttachedPoliciesPerUserQuota;
-          }
-          else if (hashCode == Policies_HASH)
-          {
-            return SummaryKeyType::Policies;
-          }
-          else if (hashCode == PoliciesQuota_HASH)
-          {
-            return SummaryKeyType::PoliciesQuota;
-          }
-          else if (hashCode == PolicySizeQuota_HASH)
-          {
-            return SummaryKeyType::PolicySizeQuota;
-          }
-          else if (hashCode == PolicyVersionsInUse_HASH)
-          {
-            return SummaryKeyType::PolicyVersionsInUse;
-          }
-          else if (hashCode == PolicyVersionsInUseQuota_HASH)
-          {
-            return SummaryKeyType::PolicyVersionsInUseQuota;
-          }
-          else if (hashCode == VersionsPerPolicyQuota_HASH)
-          {
-            return SummaryKeyType::VersionsPerPolicyQuota;
+          case Users_HASH:
+            if (name == "Users")
+            {
+              return SummaryKeyType::Users;
+            }
+            break;
+          case UsersQuota_HASH:
+            if (name == "UsersQuota")
+            {
+              return SummaryKeyType::UsersQuota;
+            }
+            break;
+          case Groups_HASH:
+            if (name == "Groups")
+            {
+              return SummaryKeyType::Groups;
+            }
+            break;
+          case GroupsQuota_HASH:
+            if (name == "GroupsQuota")
+            {
+              return SummaryKeyType::GroupsQuota;
+            }
+            break;
+          case ServerCertificates_HASH:
+            if (name == "ServerCertificates")
+            {
+              return SummaryKeyType::ServerCertificates;
+            }
+            break;
+          case ServerCertificatesQuota_HASH:
+            if (name == "ServerCertificatesQuota")
+            {
+              return SummaryKeyType::ServerCertificatesQuota;
+            }
+            break;
+          case UserPolicySizeQuota_HASH:
+            if (name == "UserPolicySizeQuota")
+            {
+              return SummaryKeyType::UserPolicySizeQuota;
+            }
+            break;
+          case GroupPolicySizeQuota_HASH:
+            if (name == "GroupPolicySizeQuota")
+            {
+              return SummaryKeyType::GroupPolicySizeQuota;
+            }
+            break;
+          case GroupsPerUserQuota_HASH:
+            if (name == "GroupsPerUserQuota")
+            {
+              return SummaryKeyType::GroupsPerUserQuota;
+            }
+            break;
+          case SigningCertificatesPerUserQuota_HASH:
+            if (name == "SigningCertificatesPerUserQuota")
+            {
+              return SummaryKeyType::SigningCertificatesPerUserQuota;
+            }
+            break;
+          case AccessKeysPerUserQuota_HASH:
+            if (name == "AccessKeysPerUserQuota")
+            {
+              return SummaryKeyType::AccessKeysPerUserQuota;
+            }
+            break;
+          case MFADevices_HASH:
+            if (name == "MFADevices")
+            {
+              return SummaryKeyType::MFADevices;
+            }
+            break;
+          case MFADevicesInUse_HASH:
+            if (name == "MFADevicesInUse")
+            {
+              return SummaryKeyType::MFADevicesInUse;
+            }
+            break;
+          case AccountMFAEnabled_HASH:
+            if (name == "AccountMFAEnabled")
+            {
+              return SummaryKeyType::AccountMFAEnabled;
+            }
+            break;
+          case AccountAccessKeysPresent_HASH:
+            if (name == "AccountAccessKeysPresent")
+            {
+              return SummaryKeyType::AccountAccessKeysPresent;
+            }
+            break;
+          case AccountSigningCertificatesPresent_HASH:
+            if (name == "AccountSigningCertificatesPresent")
+            {
+              return SummaryKeyType::AccountSigningCertificatesPresent;
+            }
+            break;
+          case AttachedPoliciesPerGroupQuota_HASH:
+            if (name == "AttachedPoliciesPerGroupQuota")
+            {
+              return SummaryKeyType::AttachedPoliciesPerGroupQuota;
+            }
+            break;
+          case AttachedPoliciesPerRoleQuota_HASH:
+            if (name == "AttachedPoliciesPerRoleQuota")
+            {
+              return SummaryKeyType::AttachedPoliciesPerRoleQuota;
+            }
+            break;
+          case AttachedPoliciesPerUserQuota_HASH:
+            if (name == "AttachedPoliciesPerUserQuota")
+            {
+              return SummaryKeyType::AttachedPoliciesPerUserQuota;
+            }
+            break;
+          case Policies_HASH:
+            if (name == "Policies")
+            {
+              return SummaryKeyType::Policies;
+            }
+            break;
+          case PoliciesQuota_HASH:
+            if (name == "PoliciesQuota")
+            {
+              return SummaryKeyType::PoliciesQuota;
+            }
+            break;
+          case PolicySizeQuota_HASH:
+            if (name == "PolicySizeQuota")
+            {
+              return SummaryKeyType::PolicySizeQuota;
+            }
+            break;
+          case PolicyVersionsInUse_HASH:
+            if (name == "PolicyVersionsInUse")
+            {
+              return SummaryKeyType::PolicyVersionsInUse;
+            }
+            break;
+          case PolicyVersionsInUseQuota_HASH:
+            if (name == "PolicyVersionsInUseQuota")
+            {
+              return SummaryKeyType::PolicyVersionsInUseQuota;
+            }
+            break;
+          case VersionsPerPolicyQuota_HASH:
+            if (name == "VersionsPerPolicyQuota")
+            {
+              return SummaryKeyType::VersionsPerPolicyQuota;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -170,7 +226,7 @@ namespace Aws
           return SummaryKeyType::NOT_SET;
         }
 
-        Aws::String GetNameForSummaryKeyType(SummaryKeyType enumValue)
+        const char* GetNameForSummaryKeyType(SummaryKeyType enumValue)
         {
           switch(enumValue)
           {
@@ -228,7 +284,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
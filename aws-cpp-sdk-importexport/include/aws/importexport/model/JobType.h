@@ -34,7 +34,8 @@ namespace JobTypeMapper
 {
 AWS_IMPORTEXPORT_API JobType GetJobTypeForName(const Aws::String& name);
 
-AWS_IMPORTEXPORT_API Aws::String GetNameForJobType(JobType value);
+// names of values not modeled point into the enum overflow container
+AWS_IMPORTEXPORT_API const char* GetNameForJobType(JobType value);
 } // namespace JobTypeMapper
 } // namespace Model
 } // namespace ImportExport
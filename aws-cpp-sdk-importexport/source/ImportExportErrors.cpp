@@ -28,24 +28,24 @@ namespace ImportExport
 namespace ImportExportErrorMapper
 {
 
-static const int UNABLE_TO_CANCEL_JOB_ID_HASH = HashingUtils::HashString("UnableToCancelJobIdException");
-static const int MISSING_CUSTOMS_HASH = HashingUtils::HashString("MissingCustomsException");
-static const int INVALID_VERSION_HASH = HashingUtils::HashString("InvalidVersionException");
-static const int INVALID_JOB_ID_HASH = HashingUtils::HashString("InvalidJobIdException");
-static const int CREATE_JOB_QUOTA_EXCEEDED_HASH = HashingUtils::HashString("CreateJobQuotaExceededException");
-static const int UNABLE_TO_UPDATE_JOB_ID_HASH = HashingUtils::HashString("UnableToUpdateJobIdException");
-static const int EXPIRED_JOB_ID_HASH = HashingUtils::HashString("ExpiredJobIdException");
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int INVALID_MANIFEST_FIELD_HASH = HashingUtils::HashString("InvalidManifestFieldException");
-static const int INVALID_CUSTOMS_HASH = HashingUtils::HashString("InvalidCustomsException");
-static const int MULTIPLE_REGIONS_HASH = HashingUtils::HashString("MultipleRegionsException");
-static const int CANCELED_JOB_ID_HASH = HashingUtils::HashString("CanceledJobIdException");
-static const int INVALID_ADDRESS_HASH = HashingUtils::HashString("InvalidAddressException");
-static const int NO_SUCH_BUCKET_HASH = HashingUtils::HashString("NoSuchBucketException");
-static const int MALFORMED_MANIFEST_HASH = HashingUtils::HashString("MalformedManifestException");
-static const int INVALID_FILE_SYSTEM_HASH = HashingUtils::HashString("InvalidFileSystemException");
-static const int BUCKET_PERMISSION_HASH = HashingUtils::HashString("BucketPermissionException");
-static const int MISSING_MANIFEST_FIELD_HASH = HashingUtils::HashString("MissingManifestFieldException");
+static constexpr int UNABLE_TO_CANCEL_JOB_ID_HASH = HashingUtils::CompileTimeHashString("UnableToCancelJobIdException");
+static constexpr int MISSING_CUSTOMS_HASH = HashingUtils::CompileTimeHashString("MissingCustomsException");
+static constexpr int INVALID_VERSION_HASH = HashingUtils::CompileTimeHashString("InvalidVersionException");
+static constexpr int INVALID_JOB_ID_HASH = HashingUtils::CompileTimeHashString("InvalidJobIdException");
+static constexpr int CREATE_JOB_QUOTA_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CreateJobQuotaExceededException");
+static constexpr int UNABLE_TO_UPDATE_JOB_ID_HASH = HashingUtils::CompileTimeHashString("UnableToUpdateJobIdException");
+static constexpr int EXPIRED_JOB_ID_HASH = HashingUtils::CompileTimeHashString("ExpiredJobIdException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int INVALID_MANIFEST_FIELD_HASH = HashingUtils::CompileTimeHashString("InvalidManifestFieldException");
+static constexpr int INVALID_CUSTOMS_HASH = HashingUtils::CompileTimeHashString("InvalidCustomsException");
+static constexpr int MULTIPLE_REGIONS_HASH = HashingUtils::CompileTimeHashString("MultipleRegionsException");
+static constexpr int CANCELED_JOB_ID_HASH = HashingUtils::CompileTimeHashString("CanceledJobIdException");
+static constexpr int INVALID_ADDRESS_HASH = HashingUtils::CompileTimeHashString("InvalidAddressException");
+static constexpr int NO_SUCH_BUCKET_HASH = HashingUtils::CompileTimeHashString("NoSuchBucketException");
+static constexpr int MALFORMED_MANIFEST_HASH = HashingUtils::CompileTimeHashString("MalformedManifestException");
+static constexpr int INVALID_FILE_SYSTEM_HASH = HashingUtils::CompileTimeHashString("InvalidFileSystemException");
+static constexpr int BUCKET_PERMISSION_HASH = HashingUtils::CompileTimeHashString("BucketPermissionException");
+static constexpr int MISSING_MANIFEST_FIELD_HASH = HashingUtils::CompileTimeHashString("MissingManifestFieldException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace JobTypeMapper
       {
 
-        static const int Import_HASH = HashingUtils::HashString("Import");
-        static const int Export_HASH = HashingUtils::HashString("Export");
+        static constexpr int Import_HASH = HashingUtils::CompileTimeHashString("Import");
+        static constexpr int Export_HASH = HashingUtils::CompileTimeHashString("Export");
 
 
         JobType GetJobTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Import_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobType::Import;
-          }
-          else if (hashCode == Export_HASH)
-          {
-            return JobType::Export;
+          case Import_HASH:
+            if (name == "Import")
+            {
+              return JobType::Import;
+            }
+            break;
+          case Export_HASH:
+            if (name == "Export")
+            {
+              return JobType::Export;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return JobType::NOT_SET;
         }
 
-        Aws::String GetNameForJobType(JobType enumValue)
+        const char* GetNameForJobType(JobType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -40,7 +40,8 @@ namespace AccessDeniedErrorCodeMapper
 {
 AWS_INSPECTOR_API AccessDeniedErrorCode GetAccessDeniedErrorCodeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForAccessDeniedErrorCode(AccessDeniedErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForAccessDeniedErrorCode(AccessDeniedErrorCode value);
 } // namespace AccessDeniedErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
@@ -35,7 +35,8 @@ namespace AgentHealthMapper
 {
 AWS_INSPECTOR_API AgentHealth GetAgentHealthForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForAgentHealth(AgentHealth value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForAgentHealth(AgentHealth value);
 } // namespace AgentHealthMapper
 } // namespace Model
 } // namespace Inspector
@@ -38,7 +38,8 @@ namespace AgentHealthCodeMapper
 {
 AWS_INSPECTOR_API AgentHealthCode GetAgentHealthCodeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForAgentHealthCode(AgentHealthCode value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForAgentHealthCode(AgentHealthCode value);
 } // namespace AgentHealthCodeMapper
 } // namespace Model
 } // namespace Inspector
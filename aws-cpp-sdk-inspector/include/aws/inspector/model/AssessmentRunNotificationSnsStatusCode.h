@@ -36,7 +36,8 @@ namespace AssessmentRunNotificationSnsStatusCodeMapper
 {
 AWS_INSPECTOR_API AssessmentRunNotificationSnsStatusCode GetAssessmentRunNotificationSnsStatusCodeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForAssessmentRunNotificationSnsStatusCode(AssessmentRunNotificationSnsStatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForAssessmentRunNotificationSnsStatusCode(AssessmentRunNotificationSnsStatusCode value);
 } // namespace AssessmentRunNotificationSnsStatusCodeMapper
 } // namespace Model
 } // namespace Inspector
@@ -45,7 +45,8 @@ namespace AssessmentRunStateMapper
 {
 AWS_INSPECTOR_API AssessmentRunState GetAssessmentRunStateForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForAssessmentRunState(AssessmentRunState value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForAssessmentRunState(AssessmentRunState value);
 } // namespace AssessmentRunStateMapper
 } // namespace Model
 } // namespace Inspector
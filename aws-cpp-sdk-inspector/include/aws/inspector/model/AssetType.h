@@ -33,7 +33,8 @@ namespace AssetTypeMapper
 {
 AWS_INSPECTOR_API AssetType GetAssetTypeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForAssetType(AssetType value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForAssetType(AssetType value);
 } // namespace AssetTypeMapper
 } // namespace Model
 } // namespace Inspector
@@ -38,7 +38,8 @@ namespace FailedItemErrorCodeMapper
 {
 AWS_INSPECTOR_API FailedItemErrorCode GetFailedItemErrorCodeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForFailedItemErrorCode(FailedItemErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForFailedItemErrorCode(FailedItemErrorCode value);
 } // namespace FailedItemErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
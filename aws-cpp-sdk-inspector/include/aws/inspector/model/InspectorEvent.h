@@ -37,7 +37,8 @@ namespace InspectorEventMapper
 {
 AWS_INSPECTOR_API InspectorEvent GetInspectorEventForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForInspectorEvent(InspectorEvent value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForInspectorEvent(InspectorEvent value);
 } // namespace InspectorEventMapper
 } // namespace Model
 } // namespace Inspector
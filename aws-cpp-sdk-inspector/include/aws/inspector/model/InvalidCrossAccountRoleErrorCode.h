@@ -34,7 +34,8 @@ namespace InvalidCrossAccountRoleErrorCodeMapper
 {
 AWS_INSPECTOR_API InvalidCrossAccountRoleErrorCode GetInvalidCrossAccountRoleErrorCodeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForInvalidCrossAccountRoleErrorCode(InvalidCrossAccountRoleErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForInvalidCrossAccountRoleErrorCode(InvalidCrossAccountRoleErrorCode value);
 } // namespace InvalidCrossAccountRoleErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
@@ -86,7 +86,8 @@ namespace InvalidInputErrorCodeMapper
 {
 AWS_INSPECTOR_API InvalidInputErrorCode GetInvalidInputErrorCodeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForInvalidInputErrorCode(InvalidInputErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForInvalidInputErrorCode(InvalidInputErrorCode value);
 } // namespace InvalidInputErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
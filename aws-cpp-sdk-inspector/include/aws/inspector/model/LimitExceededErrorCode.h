@@ -37,7 +37,8 @@ namespace LimitExceededErrorCodeMapper
 {
 AWS_INSPECTOR_API LimitExceededErrorCode GetLimitExceededErrorCodeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForLimitExceededErrorCode(LimitExceededErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForLimitExceededErrorCode(LimitExceededErrorCode value);
 } // namespace LimitExceededErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
@@ -33,7 +33,8 @@ namespace LocaleMapper
 {
 AWS_INSPECTOR_API Locale GetLocaleForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForLocale(Locale value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForLocale(Locale value);
 } // namespace LocaleMapper
 } // namespace Model
 } // namespace Inspector
@@ -40,7 +40,8 @@ namespace NoSuchEntityErrorCodeMapper
 {
 AWS_INSPECTOR_API NoSuchEntityErrorCode GetNoSuchEntityErrorCodeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForNoSuchEntityErrorCode(NoSuchEntityErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForNoSuchEntityErrorCode(NoSuchEntityErrorCode value);
 } // namespace NoSuchEntityErrorCodeMapper
 } // namespace Model
 } // namespace Inspector
@@ -34,7 +34,8 @@ namespace PreviewStatusMapper
 {
 AWS_INSPECTOR_API PreviewStatus GetPreviewStatusForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForPreviewStatus(PreviewStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForPreviewStatus(PreviewStatus value);
 } // namespace PreviewStatusMapper
 } // namespace Model
 } // namespace Inspector
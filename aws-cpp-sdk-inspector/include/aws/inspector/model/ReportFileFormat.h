@@ -34,7 +34,8 @@ namespace ReportFileFormatMapper
 {
 AWS_INSPECTOR_API ReportFileFormat GetReportFileFormatForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForReportFileFormat(ReportFileFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForReportFileFormat(ReportFileFormat value);
 } // namespace ReportFileFormatMapper
 } // namespace Model
 } // namespace Inspector
@@ -35,7 +35,8 @@ namespace ReportStatusMapper
 {
 AWS_INSPECTOR_API ReportStatus GetReportStatusForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForReportStatus(ReportStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForReportStatus(ReportStatus value);
 } // namespace ReportStatusMapper
 } // namespace Model
 } // namespace Inspector
@@ -34,7 +34,8 @@ namespace ReportTypeMapper
 {
 AWS_INSPECTOR_API ReportType GetReportTypeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForReportType(ReportType value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForReportType(ReportType value);
 } // namespace ReportTypeMapper
 } // namespace Model
 } // namespace Inspector
@@ -34,7 +34,8 @@ namespace ScopeTypeMapper
 {
 AWS_INSPECTOR_API ScopeType GetScopeTypeForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForScopeType(ScopeType value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForScopeType(ScopeType value);
 } // namespace ScopeTypeMapper
 } // namespace Model
 } // namespace Inspector
@@ -37,7 +37,8 @@ namespace SeverityMapper
 {
 AWS_INSPECTOR_API Severity GetSeverityForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForSeverity(Severity value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForSeverity(Severity value);
 } // namespace SeverityMapper
 } // namespace Model
 } // namespace Inspector
@@ -34,7 +34,8 @@ namespace StopActionMapper
 {
 AWS_INSPECTOR_API StopAction GetStopActionForName(const Aws::String& name);
 
-AWS_INSPECTOR_API Aws::String GetNameForStopAction(StopAction value);
+// names of values not modeled point into the enum overflow container
+AWS_INSPECTOR_API const char* GetNameForStopAction(StopAction value);
 } // namespace StopActionMapper
 } // namespace Model
 } // namespace Inspector
@@ -28,16 +28,16 @@ namespace Inspector
 namespace InspectorErrorMapper
 {
 
-static const int ASSESSMENT_RUN_IN_PROGRESS_HASH = HashingUtils::HashString("AssessmentRunInProgressException");
-static const int AGENTS_ALREADY_RUNNING_ASSESSMENT_HASH = HashingUtils::HashString("AgentsAlreadyRunningAssessmentException");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInputException");
-static const int PREVIEW_GENERATION_IN_PROGRESS_HASH = HashingUtils::HashString("PreviewGenerationInProgressException");
-static const int UNSUPPORTED_FEATURE_HASH = HashingUtils::HashString("UnsupportedFeatureException");
-static const int INVALID_CROSS_ACCOUNT_ROLE_HASH = HashingUtils::HashString("InvalidCrossAccountRoleException");
-static const int NO_SUCH_ENTITY_HASH = HashingUtils::HashString("NoSuchEntityException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int INTERNAL_HASH = HashingUtils::HashString("InternalException");
-static const int SERVICE_TEMPORARILY_UNAVAILABLE_HASH = HashingUtils::HashString("ServiceTemporarilyUnavailableException");
+static constexpr int ASSESSMENT_RUN_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("AssessmentRunInProgressException");
+static constexpr int AGENTS_ALREADY_RUNNING_ASSESSMENT_HASH = HashingUtils::CompileTimeHashString("AgentsAlreadyRunningAssessmentException");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInputException");
+static constexpr int PREVIEW_GENERATION_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("PreviewGenerationInProgressException");
+static constexpr int UNSUPPORTED_FEATURE_HASH = HashingUtils::CompileTimeHashString("UnsupportedFeatureException");
+static constexpr int INVALID_CROSS_ACCOUNT_ROLE_HASH = HashingUtils::CompileTimeHashString("InvalidCrossAccountRoleException");
+static constexpr int NO_SUCH_ENTITY_HASH = HashingUtils::CompileTimeHashString("NoSuchEntityException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int INTERNAL_HASH = HashingUtils::CompileTimeHashString("InternalException");
+static constexpr int SERVICE_TEMPORARILY_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("ServiceTemporarilyUnavailableException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
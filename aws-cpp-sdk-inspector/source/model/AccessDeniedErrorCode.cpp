@@ -30,50 +30,72 @@ namespace Aws
       namespace AccessDeniedErrorCodeMapper
       {
 
-        static const int ACCESS_DENIED_TO_ASSESSMENT_TARGET_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_ASSESSMENT_TARGET");
-        static const int ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE");
-        static const int ACCESS_DENIED_TO_ASSESSMENT_RUN_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_ASSESSMENT_RUN");
-        static const int ACCESS_DENIED_TO_FINDING_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_FINDING");
-        static const int ACCESS_DENIED_TO_RESOURCE_GROUP_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_RESOURCE_GROUP");
-        static const int ACCESS_DENIED_TO_RULES_PACKAGE_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_RULES_PACKAGE");
-        static const int ACCESS_DENIED_TO_SNS_TOPIC_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_SNS_TOPIC");
-        static const int ACCESS_DENIED_TO_IAM_ROLE_HASH = HashingUtils::HashString("ACCESS_DENIED_TO_IAM_ROLE");
+        static constexpr int ACCESS_DENIED_TO_ASSESSMENT_TARGET_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED_TO_ASSESSMENT_TARGET");
+        static constexpr int ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE");
+        static constexpr int ACCESS_DENIED_TO_ASSESSMENT_RUN_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED_TO_ASSESSMENT_RUN");
+        static constexpr int ACCESS_DENIED_TO_FINDING_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED_TO_FINDING");
+        static constexpr int ACCESS_DENIED_TO_RESOURCE_GROUP_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED_TO_RESOURCE_GROUP");
+        static constexpr int ACCESS_DENIED_TO_RULES_PACKAGE_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED_TO_RULES_PACKAGE");
+        static constexpr int ACCESS_DENIED_TO_SNS_TOPIC_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED_TO_SNS_TOPIC");
+        static constexpr int ACCESS_DENIED_TO_IAM_ROLE_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED_TO_IAM_ROLE");
 
 
         AccessDeniedErrorCode GetAccessDeniedErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCESS_DENIED_TO_ASSESSMENT_TARGET_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TARGET;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_ASSESSMENT_RUN_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_RUN;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_FINDING_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_FINDING;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_RESOURCE_GROUP_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_RESOURCE_GROUP;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_RULES_PACKAGE_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_RULES_PACKAGE;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_SNS_TOPIC_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_SNS_TOPIC;
-          }
-          else if (hashCode == ACCESS_DENIED_TO_IAM_ROLE_HASH)
-          {
-            return AccessDeniedErrorCode::ACCESS_DENIED_TO_IAM_ROLE;
+          case ACCESS_DENIED_TO_ASSESSMENT_TARGET_HASH:
+            if (name == "ACCESS_DENIED_TO_ASSESSMENT_TARGET")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TARGET;
+            }
+            break;
+          case ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE_HASH:
+            if (name == "ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_TEMPLATE;
+            }
+            break;
+          case ACCESS_DENIED_TO_ASSESSMENT_RUN_HASH:
+            if (name == "ACCESS_DENIED_TO_ASSESSMENT_RUN")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_ASSESSMENT_RUN;
+            }
+            break;
+          case ACCESS_DENIED_TO_FINDING_HASH:
+            if (name == "ACCESS_DENIED_TO_FINDING")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_FINDING;
+            }
+            break;
+          case ACCESS_DENIED_TO_RESOURCE_GROUP_HASH:
+            if (name == "ACCESS_DENIED_TO_RESOURCE_GROUP")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_RESOURCE_GROUP;
+            }
+            break;
+          case ACCESS_DENIED_TO_RULES_PACKAGE_HASH:
+            if (name == "ACCESS_DENIED_TO_RULES_PACKAGE")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_RULES_PACKAGE;
+            }
+            break;
+          case ACCESS_DENIED_TO_SNS_TOPIC_HASH:
+            if (name == "ACCESS_DENIED_TO_SNS_TOPIC")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_SNS_TOPIC;
+            }
+            break;
+          case ACCESS_DENIED_TO_IAM_ROLE_HASH:
+            if (name == "ACCESS_DENIED_TO_IAM_ROLE")
+            {
+              return AccessDeniedErrorCode::ACCESS_DENIED_TO_IAM_ROLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return AccessDeniedErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForAccessDeniedErrorCode(AccessDeniedErrorCode enumValue)
+        const char* GetNameForAccessDeniedErrorCode(AccessDeniedErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
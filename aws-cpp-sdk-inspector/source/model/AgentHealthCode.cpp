@@ -30,40 +30,58 @@ namespace Aws
       namespace AgentHealthCodeMapper
       {
 
-        static const int IDLE_HASH = HashingUtils::HashString("IDLE");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SHUTDOWN_HASH = HashingUtils::HashString("SHUTDOWN");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int THROTTLED_HASH = HashingUtils::HashString("THROTTLED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
+        static constexpr int IDLE_HASH = HashingUtils::CompileTimeHashString("IDLE");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int SHUTDOWN_HASH = HashingUtils::CompileTimeHashString("SHUTDOWN");
+        static constexpr int UNHEALTHY_HASH = HashingUtils::CompileTimeHashString("UNHEALTHY");
+        static constexpr int THROTTLED_HASH = HashingUtils::CompileTimeHashString("THROTTLED");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
 
 
         AgentHealthCode GetAgentHealthCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IDLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AgentHealthCode::IDLE;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return AgentHealthCode::RUNNING;
-          }
-          else if (hashCode == SHUTDOWN_HASH)
-          {
-            return AgentHealthCode::SHUTDOWN;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return AgentHealthCode::UNHEALTHY;
-          }
-          else if (hashCode == THROTTLED_HASH)
-          {
-            return AgentHealthCode::THROTTLED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return AgentHealthCode::UNKNOWN;
+          case IDLE_HASH:
+            if (name == "IDLE")
+            {
+              return AgentHealthCode::IDLE;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return AgentHealthCode::RUNNING;
+            }
+            break;
+          case SHUTDOWN_HASH:
+            if (name == "SHUTDOWN")
+            {
+              return AgentHealthCode::SHUTDOWN;
+            }
+            break;
+          case UNHEALTHY_HASH:
+            if (name == "UNHEALTHY")
+            {
+              return AgentHealthCode::UNHEALTHY;
+            }
+            break;
+          case THROTTLED_HASH:
+            if (name == "THROTTLED")
+            {
+              return AgentHealthCode::THROTTLED;
+            }
+            break;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return AgentHealthCode::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return AgentHealthCode::NOT_SET;
         }
 
-        Aws::String GetNameForAgentHealthCode(AgentHealthCode enumValue)
+        const char* GetNameForAgentHealthCode(AgentHealthCode enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
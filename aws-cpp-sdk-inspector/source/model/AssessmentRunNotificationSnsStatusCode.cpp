@@ -30,30 +30,44 @@ namespace Aws
       namespace AssessmentRunNotificationSnsStatusCodeMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int TOPIC_DOES_NOT_EXIST_HASH = HashingUtils::HashString("TOPIC_DOES_NOT_EXIST");
-        static const int ACCESS_DENIED_HASH = HashingUtils::HashString("ACCESS_DENIED");
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int TOPIC_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("TOPIC_DOES_NOT_EXIST");
+        static constexpr int ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED");
+        static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_ERROR");
 
 
         AssessmentRunNotificationSnsStatusCode GetAssessmentRunNotificationSnsStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssessmentRunNotificationSnsStatusCode::SUCCESS;
-          }
-          else if (hashCode == TOPIC_DOES_NOT_EXIST_HASH)
-          {
-            return AssessmentRunNotificationSnsStatusCode::TOPIC_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ACCESS_DENIED_HASH)
-          {
-            return AssessmentRunNotificationSnsStatusCode::ACCESS_DENIED;
-          }
-          else if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return AssessmentRunNotificationSnsStatusCode::INTERNAL_ERROR;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return AssessmentRunNotificationSnsStatusCode::SUCCESS;
+            }
+            break;
+          case TOPIC_DOES_NOT_EXIST_HASH:
+            if (name == "TOPIC_DOES_NOT_EXIST")
+            {
+              return AssessmentRunNotificationSnsStatusCode::TOPIC_DOES_NOT_EXIST;
+            }
+            break;
+          case ACCESS_DENIED_HASH:
+            if (name == "ACCESS_DENIED")
+            {
+              return AssessmentRunNotificationSnsStatusCode::ACCESS_DENIED;
+            }
+            break;
+          case INTERNAL_ERROR_HASH:
+            if (name == "INTERNAL_ERROR")
+            {
+              return AssessmentRunNotificationSnsStatusCode::INTERNAL_ERROR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AssessmentRunNotificationSnsStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForAssessmentRunNotificationSnsStatusCode(AssessmentRunNotificationSnsStatusCode enumValue)
+        const char* GetNameForAssessmentRunNotificationSnsStatusCode(AssessmentRunNotificationSnsStatusCode enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
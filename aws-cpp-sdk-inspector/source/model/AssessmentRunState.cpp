@@ -30,75 +30,107 @@ namespace Aws
       namespace AssessmentRunStateMapper
       {
 
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int START_DATA_COLLECTION_PENDING_HASH = HashingUtils::HashString("START_DATA_COLLECTION_PENDING");
-        static const int START_DATA_COLLECTION_IN_PROGRESS_HASH = HashingUtils::HashString("START_DATA_COLLECTION_IN_PROGRESS");
-        static const int COLLECTING_DATA_HASH = HashingUtils::HashString("COLLECTING_DATA");
-        static const int STOP_DATA_COLLECTION_PENDING_HASH = HashingUtils::HashString("STOP_DATA_COLLECTION_PENDING");
-        static const int DATA_COLLECTED_HASH = HashingUtils::HashString("DATA_COLLECTED");
-        static const int START_EVALUATING_RULES_PENDING_HASH = HashingUtils::HashString("START_EVALUATING_RULES_PENDING");
-        static const int EVALUATING_RULES_HASH = HashingUtils::HashString("EVALUATING_RULES");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int COMPLETED_WITH_ERRORS_HASH = HashingUtils::HashString("COMPLETED_WITH_ERRORS");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
+        static constexpr int CREATED_HASH = HashingUtils::CompileTimeHashString("CREATED");
+        static constexpr int START_DATA_COLLECTION_PENDING_HASH = HashingUtils::CompileTimeHashString("START_DATA_COLLECTION_PENDING");
+        static constexpr int START_DATA_COLLECTION_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("START_DATA_COLLECTION_IN_PROGRESS");
+        static constexpr int COLLECTING_DATA_HASH = HashingUtils::CompileTimeHashString("COLLECTING_DATA");
+        static constexpr int STOP_DATA_COLLECTION_PENDING_HASH = HashingUtils::CompileTimeHashString("STOP_DATA_COLLECTION_PENDING");
+        static constexpr int DATA_COLLECTED_HASH = HashingUtils::CompileTimeHashString("DATA_COLLECTED");
+        static constexpr int START_EVALUATING_RULES_PENDING_HASH = HashingUtils::CompileTimeHashString("START_EVALUATING_RULES_PENDING");
+        static constexpr int EVALUATING_RULES_HASH = HashingUtils::CompileTimeHashString("EVALUATING_RULES");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int COMPLETED_WITH_ERRORS_HASH = HashingUtils::CompileTimeHashString("COMPLETED_WITH_ERRORS");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
 
 
         AssessmentRunState GetAssessmentRunStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssessmentRunState::CREATED;
-          }
-          else if (hashCode == START_DATA_COLLECTION_PENDING_HASH)
-          {
-            return AssessmentRunState::START_DATA_COLLECTION_PENDING;
-          }
-          else if (hashCode == START_DATA_COLLECTION_IN_PROGRESS_HASH)
-          {
-            return AssessmentRunState::START_DATA_COLLECTION_IN_PROGRESS;
-          }
-          else if (hashCode == COLLECTING_DATA_HASH)
-          {
-            return AssessmentRunState::COLLECTING_DATA;
-          }
-          else if (hashCode == STOP_DATA_COLLECTION_PENDING_HASH)
-          {
-            return AssessmentRunState::STOP_DATA_COLLECTION_PENDING;
-          }
-          else if (hashCode == DATA_COLLECTED_HASH)
-          {
-            return AssessmentRunState::DATA_COLLECTED;
-          }
-          else if (hashCode == START_EVALUATING_RULES_PENDING_HASH)
-          {
-            return AssessmentRunState::START_EVALUATING_RULES_PENDING;
-          }
-          else if (hashCode == EVALUATING_RULES_HASH)
-          {
-            return AssessmentRunState::EVALUATING_RULES;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AssessmentRunState::FAILED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return AssessmentRunState::ERROR_;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return AssessmentRunState::COMPLETED;
-          }
-          else if (hashCode == COMPLETED_WITH_ERRORS_HASH)
-          {
-            return AssessmentRunState::COMPLETED_WITH_ERRORS;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return AssessmentRunState::CANCELED;
+          case CREATED_HASH:
+            if (name == "CREATED")
+            {
+              return AssessmentRunState::CREATED;
+            }
+            break;
+          case START_DATA_COLLECTION_PENDING_HASH:
+            if (name == "START_DATA_COLLECTION_PENDING")
+            {
+              return AssessmentRunState::START_DATA_COLLECTION_PENDING;
+            }
+            break;
+          case START_DATA_COLLECTION_IN_PROGRESS_HASH:
+            if (name == "START_DATA_COLLECTION_IN_PROGRESS")
+            {
+              return AssessmentRunState::START_DATA_COLLECTION_IN_PROGRESS;
+            }
+            break;
+          case COLLECTING_DATA_HASH:
+            if (name == "COLLECTING_DATA")
+            {
+              return AssessmentRunState::COLLECTING_DATA;
+            }
+            break;
+          case STOP_DATA_COLLECTION_PENDING_HASH:
+            if (name == "STOP_DATA_COLLECTION_PENDING")
+            {
+              return AssessmentRunState::STOP_DATA_COLLECTION_PENDING;
+            }
+            break;
+          case DATA_COLLECTED_HASH:
+            if (name == "DATA_COLLECTED")
+            {
+              return AssessmentRunState::DATA_COLLECTED;
+            }
+            break;
+          case START_EVALUATING_RULES_PENDING_HASH:
+            if (name == "START_EVALUATING_RULES_PENDING")
+            {
+              return AssessmentRunState::START_EVALUATING_RULES_PENDING;
+            }
+            break;
+          case EVALUATING_RULES_HASH:
+            if (name == "EVALUATING_RULES")
+            {
+              return AssessmentRunState::EVALUATING_RULES;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return AssessmentRunState::FAILED;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return AssessmentRunState::ERROR_;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return AssessmentRunState::COMPLETED;
+            }
+            break;
+          case COMPLETED_WITH_ERRORS_HASH:
+            if (name == "COMPLETED_WITH_ERRORS")
+            {
+              return AssessmentRunState::COMPLETED_WITH_ERRORS;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return AssessmentRunState::CANCELED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,7 +142,7 @@ namespace Aws
           return AssessmentRunState::NOT_SET;
         }
 
-        Aws::String GetNameForAssessmentRunState(AssessmentRunState enumValue)
+        const char* GetNameForAssessmentRunState(AssessmentRunState enumValue)
         {
           switch(enumValue)
           {
@@ -144,7 +176,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
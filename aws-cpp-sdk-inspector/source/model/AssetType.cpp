@@ -30,15 +30,23 @@ namespace Aws
       namespace AssetTypeMapper
       {
 
-        static const int ec2_instance_HASH = HashingUtils::HashString("ec2-instance");
+        static constexpr int ec2_instance_HASH = HashingUtils::CompileTimeHashString("ec2-instance");
 
 
         AssetType GetAssetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ec2_instance_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssetType::ec2_instance;
+          case ec2_instance_HASH:
+            if (name == "ec2-instance")
+            {
+              return AssetType::ec2_instance;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return AssetType::NOT_SET;
         }
 
-        Aws::String GetNameForAssetType(AssetType enumValue)
+        const char* GetNameForAssetType(AssetType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace FailedItemErrorCodeMapper
       {
 
-        static const int INVALID_ARN_HASH = HashingUtils::HashString("INVALID_ARN");
-        static const int DUPLICATE_ARN_HASH = HashingUtils::HashString("DUPLICATE_ARN");
-        static const int ITEM_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ITEM_DOES_NOT_EXIST");
-        static const int ACCESS_DENIED_HASH = HashingUtils::HashString("ACCESS_DENIED");
-        static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LIMIT_EXCEEDED");
-        static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("INTERNAL_ERROR");
+        static constexpr int INVALID_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_ARN");
+        static constexpr int DUPLICATE_ARN_HASH = HashingUtils::CompileTimeHashString("DUPLICATE_ARN");
+        static constexpr int ITEM_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ITEM_DOES_NOT_EXIST");
+        static constexpr int ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("ACCESS_DENIED");
+        static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LIMIT_EXCEEDED");
+        static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("INTERNAL_ERROR");
 
 
         FailedItemErrorCode GetFailedItemErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_ARN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FailedItemErrorCode::INVALID_ARN;
-          }
-          else if (hashCode == DUPLICATE_ARN_HASH)
-          {
-            return FailedItemErrorCode::DUPLICATE_ARN;
-          }
-          else if (hashCode == ITEM_DOES_NOT_EXIST_HASH)
-          {
-            return FailedItemErrorCode::ITEM_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ACCESS_DENIED_HASH)
-          {
-            return FailedItemErrorCode::ACCESS_DENIED;
-          }
-          else if (hashCode == LIMIT_EXCEEDED_HASH)
-          {
-            return FailedItemErrorCode::LIMIT_EXCEEDED;
-          }
-          else if (hashCode == INTERNAL_ERROR_HASH)
-          {
-            return FailedItemErrorCode::INTERNAL_ERROR;
+          case INVALID_ARN_HASH:
+            if (name == "INVALID_ARN")
+            {
+              return FailedItemErrorCode::INVALID_ARN;
+            }
+            break;
+          case DUPLICATE_ARN_HASH:
+            if (name == "DUPLICATE_ARN")
+            {
+              return FailedItemErrorCode::DUPLICATE_ARN;
+            }
+            break;
+          case ITEM_DOES_NOT_EXIST_HASH:
+            if (name == "ITEM_DOES_NOT_EXIST")
+            {
+              return FailedItemErrorCode::ITEM_DOES_NOT_EXIST;
+            }
+            break;
+          case ACCESS_DENIED_HASH:
+            if (name == "ACCESS_DENIED")
+            {
+              return FailedItemErrorCode::ACCESS_DENIED;
+            }
+            break;
+          case LIMIT_EXCEEDED_HASH:
+            if (name == "LIMIT_EXCEEDED")
+            {
+              return FailedItemErrorCode::LIMIT_EXCEEDED;
+            }
+            break;
+          case INTERNAL_ERROR_HASH:
+            if (name == "INTERNAL_ERROR")
+            {
+              return FailedItemErrorCode::INTERNAL_ERROR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return FailedItemErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForFailedItemErrorCode(FailedItemErrorCode enumValue)
+        const char* GetNameForFailedItemErrorCode(FailedItemErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
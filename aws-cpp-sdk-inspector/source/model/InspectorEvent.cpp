@@ -30,35 +30,51 @@ namespace Aws
       namespace InspectorEventMapper
       {
 
-        static const int ASSESSMENT_RUN_STARTED_HASH = HashingUtils::HashString("ASSESSMENT_RUN_STARTED");
-        static const int ASSESSMENT_RUN_COMPLETED_HASH = HashingUtils::HashString("ASSESSMENT_RUN_COMPLETED");
-        static const int ASSESSMENT_RUN_STATE_CHANGED_HASH = HashingUtils::HashString("ASSESSMENT_RUN_STATE_CHANGED");
-        static const int FINDING_REPORTED_HASH = HashingUtils::HashString("FINDING_REPORTED");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
+        static constexpr int ASSESSMENT_RUN_STARTED_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_RUN_STARTED");
+        static constexpr int ASSESSMENT_RUN_COMPLETED_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_RUN_COMPLETED");
+        static constexpr int ASSESSMENT_RUN_STATE_CHANGED_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_RUN_STATE_CHANGED");
+        static constexpr int FINDING_REPORTED_HASH = HashingUtils::CompileTimeHashString("FINDING_REPORTED");
+        static constexpr int OTHER_HASH = HashingUtils::CompileTimeHashString("OTHER");
 
 
         InspectorEvent GetInspectorEventForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSESSMENT_RUN_STARTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InspectorEvent::ASSESSMENT_RUN_STARTED;
-          }
-          else if (hashCode == ASSESSMENT_RUN_COMPLETED_HASH)
-          {
-            return InspectorEvent::ASSESSMENT_RUN_COMPLETED;
-          }
-          else if (hashCode == ASSESSMENT_RUN_STATE_CHANGED_HASH)
-          {
-            return InspectorEvent::ASSESSMENT_RUN_STATE_CHANGED;
-          }
-          else if (hashCode == FINDING_REPORTED_HASH)
-          {
-            return InspectorEvent::FINDING_REPORTED;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return InspectorEvent::OTHER;
+          case ASSESSMENT_RUN_STARTED_HASH:
+            if (name == "ASSESSMENT_RUN_STARTED")
+            {
+              return InspectorEvent::ASSESSMENT_RUN_STARTED;
+            }
+            break;
+          case ASSESSMENT_RUN_COMPLETED_HASH:
+            if (name == "ASSESSMENT_RUN_COMPLETED")
+            {
+              return InspectorEvent::ASSESSMENT_RUN_COMPLETED;
+            }
+            break;
+          case ASSESSMENT_RUN_STATE_CHANGED_HASH:
+            if (name == "ASSESSMENT_RUN_STATE_CHANGED")
+            {
+              return InspectorEvent::ASSESSMENT_RUN_STATE_CHANGED;
+            }
+            break;
+          case FINDING_REPORTED_HASH:
+            if (name == "FINDING_REPORTED")
+            {
+              return InspectorEvent::FINDING_REPORTED;
+            }
+            break;
+          case OTHER_HASH:
+            if (name == "OTHER")
+            {
+              return InspectorEvent::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return InspectorEvent::NOT_SET;
         }
 
-        Aws::String GetNameForInspectorEvent(InspectorEvent enumValue)
+        const char* GetNameForInspectorEvent(InspectorEvent enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,280 +30,394 @@ namespace Aws
       namespace InvalidInputErrorCodeMapper
       {
 
-        static const int INVALID_ASSESSMENT_TARGET_ARN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TARGET_ARN");
-        static const int INVALID_ASSESSMENT_TEMPLATE_ARN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_ARN");
-        static const int INVALID_ASSESSMENT_RUN_ARN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_ARN");
-        static const int INVALID_FINDING_ARN_HASH = HashingUtils::HashString("INVALID_FINDING_ARN");
-        static const int INVALID_RESOURCE_GROUP_ARN_HASH = HashingUtils::HashString("INVALID_RESOURCE_GROUP_ARN");
-        static const int INVALID_RULES_PACKAGE_ARN_HASH = HashingUtils::HashString("INVALID_RULES_PACKAGE_ARN");
-        static const int INVALID_RESOURCE_ARN_HASH = HashingUtils::HashString("INVALID_RESOURCE_ARN");
-        static const int INVALID_SNS_TOPIC_ARN_HASH = HashingUtils::HashString("INVALID_SNS_TOPIC_ARN");
-        static const int INVALID_IAM_ROLE_ARN_HASH = HashingUtils::HashString("INVALID_IAM_ROLE_ARN");
-        static const int INVALID_ASSESSMENT_TARGET_NAME_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TARGET_NAME");
-        static const int INVALID_ASSESSMENT_TARGET_NAME_PATTERN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TARGET_NAME_PATTERN");
-        static const int INVALID_ASSESSMENT_TEMPLATE_NAME_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_NAME");
-        static const int INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN");
-        static const int INVALID_ASSESSMENT_TEMPLATE_DURATION_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_DURATION");
-        static const int INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_DURATION_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_DURATION_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_START_TIME_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_START_TIME_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE");
-        static const int INVALID_ASSESSMENT_RUN_STATE_HASH = HashingUtils::HashString("INVALID_ASSESSMENT_RUN_STATE");
-        static const int INVALID_TAG_HASH = HashingUtils::HashString("INVALID_TAG");
-        static const int INVALID_TAG_KEY_HASH = HashingUtils::HashString("INVALID_TAG_KEY");
-        static const int INVALID_TAG_VALUE_HASH = HashingUtils::HashString("INVALID_TAG_VALUE");
-        static const int INVALID_RESOURCE_GROUP_TAG_KEY_HASH = HashingUtils::HashString("INVALID_RESOURCE_GROUP_TAG_KEY");
-        static const int INVALID_RESOURCE_GROUP_TAG_VALUE_HASH = HashingUtils::HashString("INVALID_RESOURCE_GROUP_TAG_VALUE");
-        static const int INVALID_ATTRIBUTE_HASH = HashingUtils::HashString("INVALID_ATTRIBUTE");
-        static const int INVALID_USER_ATTRIBUTE_HASH = HashingUtils::HashString("INVALID_USER_ATTRIBUTE");
-        static const int INVALID_USER_ATTRIBUTE_KEY_HASH = HashingUtils::HashString("INVALID_USER_ATTRIBUTE_KEY");
-        static const int INVALID_USER_ATTRIBUTE_VALUE_HASH = HashingUtils::HashString("INVALID_USER_ATTRIBUTE_VALUE");
-        static const int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::HashString("INVALID_PAGINATION_TOKEN");
-        static const int INVALID_MAX_RESULTS_HASH = HashingUtils::HashString("INVALID_MAX_RESULTS");
-        static const int INVALID_AGENT_ID_HASH = HashingUtils::HashString("INVALID_AGENT_ID");
-        static const int INVALID_AUTO_SCALING_GROUP_HASH = HashingUtils::HashString("INVALID_AUTO_SCALING_GROUP");
-        static const int INVALID_RULE_NAME_HASH = HashingUtils::HashString("INVALID_RULE_NAME");
-        static const int INVALID_SEVERITY_HASH = HashingUtils::HashString("INVALID_SEVERITY");
-        static const int INVALID_LOCALE_HASH = HashingUtils::HashString("INVALID_LOCALE");
-        static const int INVALID_EVENT_HASH = HashingUtils::HashString("INVALID_EVENT");
-        static const int ASSESSMENT_TARGET_NAME_ALREADY_TAKEN_HASH = HashingUtils::HashString("ASSESSMENT_TARGET_NAME_ALREADY_TAKEN");
-        static const int ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN_HASH = HashingUtils::HashString("ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN");
-        static const int INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS");
-        static const int INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS");
-        static const int INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS");
-        static const int INVALID_NUMBER_OF_FINDING_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_FINDING_ARNS");
-        static const int INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS");
-        static const int INVALID_NUMBER_OF_RULES_PACKAGE_ARNS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_RULES_PACKAGE_ARNS");
-        static const int INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES");
-        static const int INVALID_NUMBER_OF_TAGS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_TAGS");
-        static const int INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS");
-        static const int INVALID_NUMBER_OF_ATTRIBUTES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_ATTRIBUTES");
-        static const int INVALID_NUMBER_OF_USER_ATTRIBUTES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_USER_ATTRIBUTES");
-        static const int INVALID_NUMBER_OF_AGENT_IDS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_AGENT_IDS");
-        static const int INVALID_NUMBER_OF_AUTO_SCALING_GROUPS_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_AUTO_SCALING_GROUPS");
-        static const int INVALID_NUMBER_OF_RULE_NAMES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_RULE_NAMES");
-        static const int INVALID_NUMBER_OF_SEVERITIES_HASH = HashingUtils::HashString("INVALID_NUMBER_OF_SEVERITIES");
+        static constexpr int INVALID_ASSESSMENT_TARGET_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_TARGET_ARN");
+        static constexpr int INVALID_ASSESSMENT_TEMPLATE_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_TEMPLATE_ARN");
+        static constexpr int INVALID_ASSESSMENT_RUN_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_RUN_ARN");
+        static constexpr int INVALID_FINDING_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_FINDING_ARN");
+        static constexpr int INVALID_RESOURCE_GROUP_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_RESOURCE_GROUP_ARN");
+        static constexpr int INVALID_RULES_PACKAGE_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_RULES_PACKAGE_ARN");
+        static constexpr int INVALID_RESOURCE_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_RESOURCE_ARN");
+        static constexpr int INVALID_SNS_TOPIC_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_SNS_TOPIC_ARN");
+        static constexpr int INVALID_IAM_ROLE_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_IAM_ROLE_ARN");
+        static constexpr int INVALID_ASSESSMENT_TARGET_NAME_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_TARGET_NAME");
+        static constexpr int INVALID_ASSESSMENT_TARGET_NAME_PATTERN_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_TARGET_NAME_PATTERN");
+        static constexpr int INVALID_ASSESSMENT_TEMPLATE_NAME_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_TEMPLATE_NAME");
+        static constexpr int INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN");
+        static constexpr int INVALID_ASSESSMENT_TEMPLATE_DURATION_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_TEMPLATE_DURATION");
+        static constexpr int INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE");
+        static constexpr int INVALID_ASSESSMENT_RUN_DURATION_RANGE_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_RUN_DURATION_RANGE");
+        static constexpr int INVALID_ASSESSMENT_RUN_START_TIME_RANGE_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_RUN_START_TIME_RANGE");
+        static constexpr int INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE");
+        static constexpr int INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE");
+        static constexpr int INVALID_ASSESSMENT_RUN_STATE_HASH = HashingUtils::CompileTimeHashString("INVALID_ASSESSMENT_RUN_STATE");
+        static constexpr int INVALID_TAG_HASH = HashingUtils::CompileTimeHashString("INVALID_TAG");
+        static constexpr int INVALID_TAG_KEY_HASH = HashingUtils::CompileTimeHashString("INVALID_TAG_KEY");
+        static constexpr int INVALID_TAG_VALUE_HASH = HashingUtils::CompileTimeHashString("INVALID_TAG_VALUE");
+        static constexpr int INVALID_RESOURCE_GROUP_TAG_KEY_HASH = HashingUtils::CompileTimeHashString("INVALID_RESOURCE_GROUP_TAG_KEY");
+        static constexpr int INVALID_RESOURCE_GROUP_TAG_VALUE_HASH = HashingUtils::CompileTimeHashString("INVALID_RESOURCE_GROUP_TAG_VALUE");
+        static constexpr int INVALID_ATTRIBUTE_HASH = HashingUtils::CompileTimeHashString("INVALID_ATTRIBUTE");
+        static constexpr int INVALID_USER_ATTRIBUTE_HASH = HashingUtils::CompileTimeHashString("INVALID_USER_ATTRIBUTE");
+        static constexpr int INVALID_USER_ATTRIBUTE_KEY_HASH = HashingUtils::CompileTimeHashString("INVALID_USER_ATTRIBUTE_KEY");
+        static constexpr int INVALID_USER_ATTRIBUTE_VALUE_HASH = HashingUtils::CompileTimeHashString("INVALID_USER_ATTRIBUTE_VALUE");
+        static constexpr int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::CompileTimeHashString("INVALID_PAGINATION_TOKEN");
+        static constexpr int INVALID_MAX_RESULTS_HASH = HashingUtils::CompileTimeHashString("INVALID_MAX_RESULTS");
+        static constexpr int INVALID_AGENT_ID_HASH = HashingUtils::CompileTimeHashString("INVALID_AGENT_ID");
+        static constexpr int INVALID_AUTO_SCALING_GROUP_HASH = HashingUtils::CompileTimeHashString("INVALID_AUTO_SCALING_GROUP");
+        static constexpr int INVALID_RULE_NAME_HASH = HashingUtils::CompileTimeHashString("INVALID_RULE_NAME");
+        static constexpr int INVALID_SEVERITY_HASH = HashingUtils::CompileTimeHashString("INVALID_SEVERITY");
+        static constexpr int INVALID_LOCALE_HASH = HashingUtils::CompileTimeHashString("INVALID_LOCALE");
+        static constexpr int INVALID_EVENT_HASH = HashingUtils::CompileTimeHashString("INVALID_EVENT");
+        static constexpr int ASSESSMENT_TARGET_NAME_ALREADY_TAKEN_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_TARGET_NAME_ALREADY_TAKEN");
+        static constexpr int ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN");
+        static constexpr int INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS");
+        static constexpr int INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS");
+        static constexpr int INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS");
+        static constexpr int INVALID_NUMBER_OF_FINDING_ARNS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_FINDING_ARNS");
+        static constexpr int INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS");
+        static constexpr int INVALID_NUMBER_OF_RULES_PACKAGE_ARNS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_RULES_PACKAGE_ARNS");
+        static constexpr int INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES");
+        static constexpr int INVALID_NUMBER_OF_TAGS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_TAGS");
+        static constexpr int INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS");
+        static constexpr int INVALID_NUMBER_OF_ATTRIBUTES_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_ATTRIBUTES");
+        static constexpr int INVALID_NUMBER_OF_USER_ATTRIBUTES_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_USER_ATTRIBUTES");
+        static constexpr int INVALID_NUMBER_OF_AGENT_IDS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_AGENT_IDS");
+        static constexpr int INVALID_NUMBER_OF_AUTO_SCALING_GROUPS_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_AUTO_SCALING_GROUPS");
+        static constexpr int INVALID_NUMBER_OF_RULE_NAMES_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_RULE_NAMES");
+        static constexpr int INVALID_NUMBER_OF_SEVERITIES_HASH = HashingUtils::CompileTimeHashString("INVALID_NUMBER_OF_SEVERITIES");
 
 
         InvalidInputErrorCode GetInvalidInputErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_ASSESSMENT_TARGET_ARN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_ARN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_ARN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_ARN;
-          }
-          else if (hashCode == INVALID_FINDING_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_FINDING_ARN;
-          }
-          else if (hashCode == INVALID_RESOURCE_GROUP_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_ARN;
-          }
-          else if (hashCode == INVALID_RULES_PACKAGE_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RULES_PACKAGE_ARN;
-          }
-          else if (hashCode == INVALID_RESOURCE_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RESOURCE_ARN;
-          }
-          else if (hashCode == INVALID_SNS_TOPIC_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_SNS_TOPIC_ARN;
-          }
-          else if (hashCode == INVALID_IAM_ROLE_ARN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_IAM_ROLE_ARN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TARGET_NAME_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TARGET_NAME_PATTERN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME_PATTERN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_NAME_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_DURATION_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_DURATION_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_DURATION_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_START_TIME_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_START_TIME_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE;
-          }
-          else if (hashCode == INVALID_ASSESSMENT_RUN_STATE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE;
-          }
-          else if (hashCode == INVALID_TAG_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_TAG;
-          }
-          else if (hashCode == INVALID_TAG_KEY_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_TAG_KEY;
-          }
-          else if (hashCode == INVALID_TAG_VALUE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_TAG_VALUE;
-          }
-          else if (hashCode == INVALID_RESOURCE_GROUP_TAG_KEY_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_KEY;
-          }
-          else if (hashCode == INVALID_RESOURCE_GROUP_TAG_VALUE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_VALUE;
-          }
-          else if (hashCode == INVALID_ATTRIBUTE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_ATTRIBUTE;
-          }
-          else if (hashCode == INVALID_USER_ATTRIBUTE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE;
-          }
-          else if (hashCode == INVALID_USER_ATTRIBUTE_KEY_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_KEY;
-          }
-          else if (hashCode == INVALID_USER_ATTRIBUTE_VALUE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_VALUE;
-          }
-          else if (hashCode == INVALID_PAGINATION_TOKEN_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_PAGINATION_TOKEN;
-          }
-          else if (hashCode == INVALID_MAX_RESULTS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_MAX_RESULTS;
-          }
-          else if (hashCode == INVALID_AGENT_ID_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_AGENT_ID;
-          }
-          else if (hashCode == INVALID_AUTO_SCALING_GROUP_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_AUTO_SCALING_GROUP;
-          }
-          else if (hashCode == INVALID_RULE_NAME_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_RULE_NAME;
-          }
-          else if (hashCode == INVALID_SEVERITY_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_SEVERITY;
-          }
-          else if (hashCode == INVALID_LOCALE_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_LOCALE;
-          }
-          else if (hashCode == INVALID_EVENT_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_EVENT;
-          }
-          else if (hashCode == ASSESSMENT_TARGET_NAME_ALREADY_TAKEN_HASH)
-          {
-            return InvalidInputErrorCode::ASSESSMENT_TARGET_NAME_ALREADY_TAKEN;
-          }
-          else if (hashCode == ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN_HASH)
-          {
-            return InvalidInputErrorCode::ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_FINDING_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_FINDING_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_RULES_PACKAGE_ARNS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_RULES_PACKAGE_ARNS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_TAGS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_TAGS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_ATTRIBUTES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_ATTRIBUTES;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_USER_ATTRIBUTES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_USER_ATTRIBUTES;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_AGENT_IDS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_AGENT_IDS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_AUTO_SCALING_GROUPS_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_AUTO_SCALING_GROUPS;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_RULE_NAMES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_RULE_NAMES;
-          }
-          else if (hashCode == INVALID_NUMBER_OF_SEVERITIES_HASH)
-          {
-            return InvalidInputErrorCode::INVALID_NUMBER_OF_SEVERITIES;
+          case INVALID_ASSESSMENT_TARGET_ARN_HASH:
+            if (name == "INVALID_ASSESSMENT_TARGET_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_ARN;
+            }
+            break;
+          case INVALID_ASSESSMENT_TEMPLATE_ARN_HASH:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_ARN;
+            }
+            break;
+          case INVALID_ASSESSMENT_RUN_ARN_HASH:
+            if (name == "INVALID_ASSESSMENT_RUN_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_ARN;
+            }
+            break;
+          case INVALID_FINDING_ARN_HASH:
+            if (name == "INVALID_FINDING_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_FINDING_ARN;
+            }
+            break;
+          case INVALID_RESOURCE_GROUP_ARN_HASH:
+            if (name == "INVALID_RESOURCE_GROUP_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_ARN;
+            }
+            break;
+          case INVALID_RULES_PACKAGE_ARN_HASH:
+            if (name == "INVALID_RULES_PACKAGE_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_RULES_PACKAGE_ARN;
+            }
+            break;
+          case INVALID_RESOURCE_ARN_HASH:
+            if (name == "INVALID_RESOURCE_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_RESOURCE_ARN;
+            }
+            break;
+          case INVALID_SNS_TOPIC_ARN_HASH:
+            if (name == "INVALID_SNS_TOPIC_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_SNS_TOPIC_ARN;
+            }
+            break;
+          case INVALID_IAM_ROLE_ARN_HASH:
+            if (name == "INVALID_IAM_ROLE_ARN")
+            {
+              return InvalidInputErrorCode::INVALID_IAM_ROLE_ARN;
+            }
+            break;
+          case INVALID_ASSESSMENT_TARGET_NAME_HASH:
+            if (name == "INVALID_ASSESSMENT_TARGET_NAME")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME;
+            }
+            break;
+          case INVALID_ASSESSMENT_TARGET_NAME_PATTERN_HASH:
+            if (name == "INVALID_ASSESSMENT_TARGET_NAME_PATTERN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TARGET_NAME_PATTERN;
+            }
+            break;
+          case INVALID_ASSESSMENT_TEMPLATE_NAME_HASH:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_NAME")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME;
+            }
+            break;
+          case INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN_HASH:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_NAME_PATTERN;
+            }
+            break;
+          case INVALID_ASSESSMENT_TEMPLATE_DURATION_HASH:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_DURATION")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION;
+            }
+            break;
+          case INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE_HASH:
+            if (name == "INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_TEMPLATE_DURATION_RANGE;
+            }
+            break;
+          case INVALID_ASSESSMENT_RUN_DURATION_RANGE_HASH:
+            if (name == "INVALID_ASSESSMENT_RUN_DURATION_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_DURATION_RANGE;
+            }
+            break;
+          case INVALID_ASSESSMENT_RUN_START_TIME_RANGE_HASH:
+            if (name == "INVALID_ASSESSMENT_RUN_START_TIME_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_START_TIME_RANGE;
+            }
+            break;
+          case INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE_HASH:
+            if (name == "INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_COMPLETION_TIME_RANGE;
+            }
+            break;
+          case INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE_HASH:
+            if (name == "INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE_CHANGE_TIME_RANGE;
+            }
+            break;
+          case INVALID_ASSESSMENT_RUN_STATE_HASH:
+            if (name == "INVALID_ASSESSMENT_RUN_STATE")
+            {
+              return InvalidInputErrorCode::INVALID_ASSESSMENT_RUN_STATE;
+            }
+            break;
+          case INVALID_TAG_HASH:
+            if (name == "INVALID_TAG")
+            {
+              return InvalidInputErrorCode::INVALID_TAG;
+            }
+            break;
+          case INVALID_TAG_KEY_HASH:
+            if (name == "INVALID_TAG_KEY")
+            {
+              return InvalidInputErrorCode::INVALID_TAG_KEY;
+            }
+            break;
+          case INVALID_TAG_VALUE_HASH:
+            if (name == "INVALID_TAG_VALUE")
+            {
+              return InvalidInputErrorCode::INVALID_TAG_VALUE;
+            }
+            break;
+          case INVALID_RESOURCE_GROUP_TAG_KEY_HASH:
+            if (name == "INVALID_RESOURCE_GROUP_TAG_KEY")
+            {
+              return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_KEY;
+            }
+            break;
+          case INVALID_RESOURCE_GROUP_TAG_VALUE_HASH:
+            if (name == "INVALID_RESOURCE_GROUP_TAG_VALUE")
+            {
+              return InvalidInputErrorCode::INVALID_RESOURCE_GROUP_TAG_VALUE;
+            }
+            break;
+          case INVALID_ATTRIBUTE_HASH:
+            if (name == "INVALID_ATTRIBUTE")
+            {
+              return InvalidInputErrorCode::INVALID_ATTRIBUTE;
+            }
+            break;
+          case INVALID_USER_ATTRIBUTE_HASH:
+            if (name == "INVALID_USER_ATTRIBUTE")
+            {
+              return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE;
+            }
+            break;
+          case INVALID_USER_ATTRIBUTE_KEY_HASH:
+            if (name == "INVALID_USER_ATTRIBUTE_KEY")
+            {
+              return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_KEY;
+            }
+            break;
+          case INVALID_USER_ATTRIBUTE_VALUE_HASH:
+            if (name == "INVALID_USER_ATTRIBUTE_VALUE")
+            {
+              return InvalidInputErrorCode::INVALID_USER_ATTRIBUTE_VALUE;
+            }
+            break;
+          case INVALID_PAGINATION_TOKEN_HASH:
+            if (name == "INVALID_PAGINATION_TOKEN")
+            {
+              return InvalidInputErrorCode::INVALID_PAGINATION_TOKEN;
+            }
+            break;
+          case INVALID_MAX_RESULTS_HASH:
+            if (name == "INVALID_MAX_RESULTS")
+            {
+              return InvalidInputErrorCode::INVALID_MAX_RESULTS;
+            }
+            break;
+          case INVALID_AGENT_ID_HASH:
+            if (name == "INVALID_AGENT_ID")
+            {
+              return InvalidInputErrorCode::INVALID_AGENT_ID;
+            }
+            break;
+          case INVALID_AUTO_SCALING_GROUP_HASH:
+            if (name == "INVALID_AUTO_SCALING_GROUP")
+            {
+              return InvalidInputErrorCode::INVALID_AUTO_SCALING_GROUP;
+            }
+            break;
+          case INVALID_RULE_NAME_HASH:
+            if (name == "INVALID_RULE_NAME")
+            {
+              return InvalidInputErrorCode::INVALID_RULE_NAME;
+            }
+            break;
+          case INVALID_SEVERITY_HASH:
+            if (name == "INVALID_SEVERITY")
+            {
+              return InvalidInputErrorCode::INVALID_SEVERITY;
+            }
+            break;
+          case INVALID_LOCALE_HASH:
+            if (name == "INVALID_LOCALE")
+            {
+              return InvalidInputErrorCode::INVALID_LOCALE;
+            }
+            break;
+          case INVALID_EVENT_HASH:
+            if (name == "INVALID_EVENT")
+            {
+              return InvalidInputErrorCode::INVALID_EVENT;
+            }
+            break;
+          case ASSESSMENT_TARGET_NAME_ALREADY_TAKEN_HASH:
+            if (name == "ASSESSMENT_TARGET_NAME_ALREADY_TAKEN")
+            {
+              return InvalidInputErrorCode::ASSESSMENT_TARGET_NAME_ALREADY_TAKEN;
+            }
+            break;
+          case ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN_HASH:
+            if (name == "ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN")
+            {
+              return InvalidInputErrorCode::ASSESSMENT_TEMPLATE_NAME_ALREADY_TAKEN;
+            }
+            break;
+          case INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS_HASH:
+            if (name == "INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TARGET_ARNS;
+            }
+            break;
+          case INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS_HASH:
+            if (name == "INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_TEMPLATE_ARNS;
+            }
+            break;
+          case INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS_HASH:
+            if (name == "INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_ARNS;
+            }
+            break;
+          case INVALID_NUMBER_OF_FINDING_ARNS_HASH:
+            if (name == "INVALID_NUMBER_OF_FINDING_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_FINDING_ARNS;
+            }
+            break;
+          case INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS_HASH:
+            if (name == "INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_ARNS;
+            }
+            break;
+          case INVALID_NUMBER_OF_RULES_PACKAGE_ARNS_HASH:
+            if (name == "INVALID_NUMBER_OF_RULES_PACKAGE_ARNS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_RULES_PACKAGE_ARNS;
+            }
+            break;
+          case INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES_HASH:
+            if (name == "INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ASSESSMENT_RUN_STATES;
+            }
+            break;
+          case INVALID_NUMBER_OF_TAGS_HASH:
+            if (name == "INVALID_NUMBER_OF_TAGS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_TAGS;
+            }
+            break;
+          case INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS_HASH:
+            if (name == "INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_RESOURCE_GROUP_TAGS;
+            }
+            break;
+          case INVALID_NUMBER_OF_ATTRIBUTES_HASH:
+            if (name == "INVALID_NUMBER_OF_ATTRIBUTES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_ATTRIBUTES;
+            }
+            break;
+          case INVALID_NUMBER_OF_USER_ATTRIBUTES_HASH:
+            if (name == "INVALID_NUMBER_OF_USER_ATTRIBUTES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_USER_ATTRIBUTES;
+            }
+            break;
+          case INVALID_NUMBER_OF_AGENT_IDS_HASH:
+            if (name == "INVALID_NUMBER_OF_AGENT_IDS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_AGENT_IDS;
+            }
+            break;
+          case INVALID_NUMBER_OF_AUTO_SCALING_GROUPS_HASH:
+            if (name == "INVALID_NUMBER_OF_AUTO_SCALING_GROUPS")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_AUTO_SCALING_GROUPS;
+            }
+            break;
+          case INVALID_NUMBER_OF_RULE_NAMES_HASH:
+            if (name == "INVALID_NUMBER_OF_RULE_NAMES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_RULE_NAMES;
+            }
+            break;
+          case INVALID_NUMBER_OF_SEVERITIES_HASH:
+            if (name == "INVALID_NUMBER_OF_SEVERITIES")
+            {
+              return InvalidInputErrorCode::INVALID_NUMBER_OF_SEVERITIES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -315,7 +429,7 @@ namespace Aws
           return InvalidInputErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForInvalidInputErrorCode(InvalidInputErrorCode enumValue)
+        const char* GetNameForInvalidInputErrorCode(InvalidInputErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -431,7 +545,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace LimitExceededErrorCodeMapper
       {
 
-        static const int ASSESSMENT_TARGET_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ASSESSMENT_TARGET_LIMIT_EXCEEDED");
-        static const int ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED");
-        static const int ASSESSMENT_RUN_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ASSESSMENT_RUN_LIMIT_EXCEEDED");
-        static const int RESOURCE_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("RESOURCE_GROUP_LIMIT_EXCEEDED");
-        static const int EVENT_SUBSCRIPTION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("EVENT_SUBSCRIPTION_LIMIT_EXCEEDED");
+        static constexpr int ASSESSMENT_TARGET_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_TARGET_LIMIT_EXCEEDED");
+        static constexpr int ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED");
+        static constexpr int ASSESSMENT_RUN_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_RUN_LIMIT_EXCEEDED");
+        static constexpr int RESOURCE_GROUP_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("RESOURCE_GROUP_LIMIT_EXCEEDED");
+        static constexpr int EVENT_SUBSCRIPTION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("EVENT_SUBSCRIPTION_LIMIT_EXCEEDED");
 
 
         LimitExceededErrorCode GetLimitExceededErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSESSMENT_TARGET_LIMIT_EXCEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LimitExceededErrorCode::ASSESSMENT_TARGET_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED_HASH)
-          {
-            return LimitExceededErrorCode::ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ASSESSMENT_RUN_LIMIT_EXCEEDED_HASH)
-          {
-            return LimitExceededErrorCode::ASSESSMENT_RUN_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == RESOURCE_GROUP_LIMIT_EXCEEDED_HASH)
-          {
-            return LimitExceededErrorCode::RESOURCE_GROUP_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == EVENT_SUBSCRIPTION_LIMIT_EXCEEDED_HASH)
-          {
-            return LimitExceededErrorCode::EVENT_SUBSCRIPTION_LIMIT_EXCEEDED;
+          case ASSESSMENT_TARGET_LIMIT_EXCEEDED_HASH:
+            if (name == "ASSESSMENT_TARGET_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::ASSESSMENT_TARGET_LIMIT_EXCEEDED;
+            }
+            break;
+          case ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED_HASH:
+            if (name == "ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::ASSESSMENT_TEMPLATE_LIMIT_EXCEEDED;
+            }
+            break;
+          case ASSESSMENT_RUN_LIMIT_EXCEEDED_HASH:
+            if (name == "ASSESSMENT_RUN_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::ASSESSMENT_RUN_LIMIT_EXCEEDED;
+            }
+            break;
+          case RESOURCE_GROUP_LIMIT_EXCEEDED_HASH:
+            if (name == "RESOURCE_GROUP_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::RESOURCE_GROUP_LIMIT_EXCEEDED;
+            }
+            break;
+          case EVENT_SUBSCRIPTION_LIMIT_EXCEEDED_HASH:
+            if (name == "EVENT_SUBSCRIPTION_LIMIT_EXCEEDED")
+            {
+              return LimitExceededErrorCode::EVENT_SUBSCRIPTION_LIMIT_EXCEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return LimitExceededErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForLimitExceededErrorCode(LimitExceededErrorCode enumValue)
+        const char* GetNameForLimitExceededErrorCode(LimitExceededErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
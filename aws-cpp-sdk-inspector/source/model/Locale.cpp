@@ -30,15 +30,23 @@ namespace Aws
       namespace LocaleMapper
       {
 
-        static const int EN_US_HASH = HashingUtils::HashString("EN_US");
+        static constexpr int EN_US_HASH = HashingUtils::CompileTimeHashString("EN_US");
 
 
         Locale GetLocaleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EN_US_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Locale::EN_US;
+          case EN_US_HASH:
+            if (name == "EN_US")
+            {
+              return Locale::EN_US;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return Locale::NOT_SET;
         }
 
-        Aws::String GetNameForLocale(Locale enumValue)
+        const char* GetNameForLocale(Locale enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace NoSuchEntityErrorCodeMapper
       {
 
-        static const int ASSESSMENT_TARGET_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ASSESSMENT_TARGET_DOES_NOT_EXIST");
-        static const int ASSESSMENT_TEMPLATE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ASSESSMENT_TEMPLATE_DOES_NOT_EXIST");
-        static const int ASSESSMENT_RUN_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ASSESSMENT_RUN_DOES_NOT_EXIST");
-        static const int FINDING_DOES_NOT_EXIST_HASH = HashingUtils::HashString("FINDING_DOES_NOT_EXIST");
-        static const int RESOURCE_GROUP_DOES_NOT_EXIST_HASH = HashingUtils::HashString("RESOURCE_GROUP_DOES_NOT_EXIST");
-        static const int RULES_PACKAGE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("RULES_PACKAGE_DOES_NOT_EXIST");
-        static const int SNS_TOPIC_DOES_NOT_EXIST_HASH = HashingUtils::HashString("SNS_TOPIC_DOES_NOT_EXIST");
-        static const int IAM_ROLE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("IAM_ROLE_DOES_NOT_EXIST");
+        static constexpr int ASSESSMENT_TARGET_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_TARGET_DOES_NOT_EXIST");
+        static constexpr int ASSESSMENT_TEMPLATE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_TEMPLATE_DOES_NOT_EXIST");
+        static constexpr int ASSESSMENT_RUN_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ASSESSMENT_RUN_DOES_NOT_EXIST");
+        static constexpr int FINDING_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("FINDING_DOES_NOT_EXIST");
+        static constexpr int RESOURCE_GROUP_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("RESOURCE_GROUP_DOES_NOT_EXIST");
+        static constexpr int RULES_PACKAGE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("RULES_PACKAGE_DOES_NOT_EXIST");
+        static constexpr int SNS_TOPIC_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("SNS_TOPIC_DOES_NOT_EXIST");
+        static constexpr int IAM_ROLE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("IAM_ROLE_DOES_NOT_EXIST");
 
 
         NoSuchEntityErrorCode GetNoSuchEntityErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSESSMENT_TARGET_DOES_NOT_EXIST_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NoSuchEntityErrorCode::ASSESSMENT_TARGET_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ASSESSMENT_TEMPLATE_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::ASSESSMENT_TEMPLATE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ASSESSMENT_RUN_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::ASSESSMENT_RUN_DOES_NOT_EXIST;
-          }
-          else if (hashCode == FINDING_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::FINDING_DOES_NOT_EXIST;
-          }
-          else if (hashCode == RESOURCE_GROUP_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::RESOURCE_GROUP_DOES_NOT_EXIST;
-          }
-          else if (hashCode == RULES_PACKAGE_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::RULES_PACKAGE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == SNS_TOPIC_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::SNS_TOPIC_DOES_NOT_EXIST;
-          }
-          else if (hashCode == IAM_ROLE_DOES_NOT_EXIST_HASH)
-          {
-            return NoSuchEntityErrorCode::IAM_ROLE_DOES_NOT_EXIST;
+          case ASSESSMENT_TARGET_DOES_NOT_EXIST_HASH:
+            if (name == "ASSESSMENT_TARGET_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::ASSESSMENT_TARGET_DOES_NOT_EXIST;
+            }
+            break;
+          case ASSESSMENT_TEMPLATE_DOES_NOT_EXIST_HASH:
+            if (name == "ASSESSMENT_TEMPLATE_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::ASSESSMENT_TEMPLATE_DOES_NOT_EXIST;
+            }
+            break;
+          case ASSESSMENT_RUN_DOES_NOT_EXIST_HASH:
+            if (name == "ASSESSMENT_RUN_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::ASSESSMENT_RUN_DOES_NOT_EXIST;
+            }
+            break;
+          case FINDING_DOES_NOT_EXIST_HASH:
+            if (name == "FINDING_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::FINDING_DOES_NOT_EXIST;
+            }
+            break;
+          case RESOURCE_GROUP_DOES_NOT_EXIST_HASH:
+            if (name == "RESOURCE_GROUP_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::RESOURCE_GROUP_DOES_NOT_EXIST;
+            }
+            break;
+          case RULES_PACKAGE_DOES_NOT_EXIST_HASH:
+            if (name == "RULES_PACKAGE_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::RULES_PACKAGE_DOES_NOT_EXIST;
+            }
+            break;
+          case SNS_TOPIC_DOES_NOT_EXIST_HASH:
+            if (name == "SNS_TOPIC_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::SNS_TOPIC_DOES_NOT_EXIST;
+            }
+            break;
+          case IAM_ROLE_DOES_NOT_EXIST_HASH:
+            if (name == "IAM_ROLE_DOES_NOT_EXIST")
+            {
+              return NoSuchEntityErrorCode::IAM_ROLE_DOES_NOT_EXIST;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return NoSuchEntityErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForNoSuchEntityErrorCode(NoSuchEntityErrorCode enumValue)
+        const char* GetNameForNoSuchEntityErrorCode(NoSuchEntityErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
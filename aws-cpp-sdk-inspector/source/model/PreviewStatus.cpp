@@ -30,20 +30,30 @@ namespace Aws
       namespace PreviewStatusMapper
       {
 
-        static const int WORK_IN_PROGRESS_HASH = HashingUtils::HashString("WORK_IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
+        static constexpr int WORK_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("WORK_IN_PROGRESS");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
 
 
         PreviewStatus GetPreviewStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WORK_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PreviewStatus::WORK_IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return PreviewStatus::COMPLETED;
+          case WORK_IN_PROGRESS_HASH:
+            if (name == "WORK_IN_PROGRESS")
+            {
+              return PreviewStatus::WORK_IN_PROGRESS;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return PreviewStatus::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PreviewStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPreviewStatus(PreviewStatus enumValue)
+        const char* GetNameForPreviewStatus(PreviewStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
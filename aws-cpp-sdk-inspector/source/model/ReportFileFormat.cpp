@@ -30,20 +30,30 @@ namespace Aws
       namespace ReportFileFormatMapper
       {
 
-        static const int HTML_HASH = HashingUtils::HashString("HTML");
-        static const int PDF_HASH = HashingUtils::HashString("PDF");
+        static constexpr int HTML_HASH = HashingUtils::CompileTimeHashString("HTML");
+        static constexpr int PDF_HASH = HashingUtils::CompileTimeHashString("PDF");
 
 
         ReportFileFormat GetReportFileFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTML_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReportFileFormat::HTML;
-          }
-          else if (hashCode == PDF_HASH)
-          {
-            return ReportFileFormat::PDF;
+          case HTML_HASH:
+            if (name == "HTML")
+            {
+              return ReportFileFormat::HTML;
+            }
+            break;
+          case PDF_HASH:
+            if (name == "PDF")
+            {
+              return ReportFileFormat::PDF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReportFileFormat::NOT_SET;
         }
 
-        Aws::String GetNameForReportFileFormat(ReportFileFormat enumValue)
+        const char* GetNameForReportFileFormat(ReportFileFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ReportStatusMapper
       {
 
-        static const int WORK_IN_PROGRESS_HASH = HashingUtils::HashString("WORK_IN_PROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
+        static constexpr int WORK_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("WORK_IN_PROGRESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
 
 
         ReportStatus GetReportStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WORK_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReportStatus::WORK_IN_PROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ReportStatus::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ReportStatus::COMPLETED;
+          case WORK_IN_PROGRESS_HASH:
+            if (name == "WORK_IN_PROGRESS")
+            {
+              return ReportStatus::WORK_IN_PROGRESS;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ReportStatus::FAILED;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return ReportStatus::COMPLETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ReportStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReportStatus(ReportStatus enumValue)
+        const char* GetNameForReportStatus(ReportStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
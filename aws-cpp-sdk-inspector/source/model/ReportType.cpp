@@ -30,20 +30,30 @@ namespace Aws
       namespace ReportTypeMapper
       {
 
-        static const int FINDING_HASH = HashingUtils::HashString("FINDING");
-        static const int FULL_HASH = HashingUtils::HashString("FULL");
+        static constexpr int FINDING_HASH = HashingUtils::CompileTimeHashString("FINDING");
+        static constexpr int FULL_HASH = HashingUtils::CompileTimeHashString("FULL");
 
 
         ReportType GetReportTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FINDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReportType::FINDING;
-          }
-          else if (hashCode == FULL_HASH)
-          {
-            return ReportType::FULL;
+          case FINDING_HASH:
+            if (name == "FINDING")
+            {
+              return ReportType::FINDING;
+            }
+            break;
+          case FULL_HASH:
+            if (name == "FULL")
+            {
+              return ReportType::FULL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReportType::NOT_SET;
         }
 
-        Aws::String GetNameForReportType(ReportType enumValue)
+        const char* GetNameForReportType(ReportType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ScopeTypeMapper
       {
 
-        static const int INSTANCE_ID_HASH = HashingUtils::HashString("INSTANCE_ID");
-        static const int RULES_PACKAGE_ARN_HASH = HashingUtils::HashString("RULES_PACKAGE_ARN");
+        static constexpr int INSTANCE_ID_HASH = HashingUtils::CompileTimeHashString("INSTANCE_ID");
+        static constexpr int RULES_PACKAGE_ARN_HASH = HashingUtils::CompileTimeHashString("RULES_PACKAGE_ARN");
 
 
         ScopeType GetScopeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTANCE_ID_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScopeType::INSTANCE_ID;
-          }
-          else if (hashCode == RULES_PACKAGE_ARN_HASH)
-          {
-            return ScopeType::RULES_PACKAGE_ARN;
+          case INSTANCE_ID_HASH:
+            if (name == "INSTANCE_ID")
+            {
+              return ScopeType::INSTANCE_ID;
+            }
+            break;
+          case RULES_PACKAGE_ARN_HASH:
+            if (name == "RULES_PACKAGE_ARN")
+            {
+              return ScopeType::RULES_PACKAGE_ARN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ScopeType::NOT_SET;
         }
 
-        Aws::String GetNameForScopeType(ScopeType enumValue)
+        const char* GetNameForScopeType(ScopeType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
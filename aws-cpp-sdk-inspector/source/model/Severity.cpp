@@ -30,35 +30,51 @@ namespace Aws
       namespace SeverityMapper
       {
 
-        static const int Low_HASH = HashingUtils::HashString("Low");
-        static const int Medium_HASH = HashingUtils::HashString("Medium");
-        static const int High_HASH = HashingUtils::HashString("High");
-        static const int Informational_HASH = HashingUtils::HashString("Informational");
-        static const int Undefined_HASH = HashingUtils::HashString("Undefined");
+        static constexpr int Low_HASH = HashingUtils::CompileTimeHashString("Low");
+        static constexpr int Medium_HASH = HashingUtils::CompileTimeHashString("Medium");
+        static constexpr int High_HASH = HashingUtils::CompileTimeHashString("High");
+        static constexpr int Informational_HASH = HashingUtils::CompileTimeHashString("Informational");
+        static constexpr int Undefined_HASH = HashingUtils::CompileTimeHashString("Undefined");
 
 
         Severity GetSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Low_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Severity::Low;
-          }
-          else if (hashCode == Medium_HASH)
-          {
-            return Severity::Medium;
-          }
-          else if (hashCode == High_HASH)
-          {
-            return Severity::High;
-          }
-          else if (hashCode == Informational_HASH)
-          {
-            return Severity::Informational;
-          }
-          else if (hashCode == Undefined_HASH)
-          {
-            return Severity::Undefined;
+          case Low_HASH:
+            if (name == "Low")
+            {
+              return Severity::Low;
+            }
+            break;
+          case Medium_HASH:
+            if (name == "Medium")
+            {
+              return Severity::Medium;
+            }
+            break;
+          case High_HASH:
+            if (name == "High")
+            {
+              return Severity::High;
+            }
+            break;
+          case Informational_HASH:
+            if (name == "Informational")
+            {
+              return Severity::Informational;
+            }
+            break;
+          case Undefined_HASH:
+            if (name == "Undefined")
+            {
+              return Severity::Undefined;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Severity::NOT_SET;
         }
 
-        Aws::String GetNameForSeverity(Severity enumValue)
+        const char* GetNameForSeverity(Severity enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace StopActionMapper
       {
 
-        static const int START_EVALUATION_HASH = HashingUtils::HashString("START_EVALUATION");
-        static const int SKIP_EVALUATION_HASH = HashingUtils::HashString("SKIP_EVALUATION");
+        static constexpr int START_EVALUATION_HASH = HashingUtils::CompileTimeHashString("START_EVALUATION");
+        static constexpr int SKIP_EVALUATION_HASH = HashingUtils::CompileTimeHashString("SKIP_EVALUATION");
 
 
         StopAction GetStopActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == START_EVALUATION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StopAction::START_EVALUATION;
-          }
-          else if (hashCode == SKIP_EVALUATION_HASH)
-          {
-            return StopAction::SKIP_EVALUATION;
+          case START_EVALUATION_HASH:
+            if (name == "START_EVALUATION")
+            {
+              return StopAction::START_EVALUATION;
+            }
+            break;
+          case SKIP_EVALUATION_HASH:
+            if (name == "SKIP_EVALUATION")
+            {
+              return StopAction::SKIP_EVALUATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return StopAction::NOT_SET;
         }
 
-        Aws::String GetNameForStopAction(StopAction enumValue)
+        const char* GetNameForStopAction(StopAction enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
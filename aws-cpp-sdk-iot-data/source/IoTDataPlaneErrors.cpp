@@ -28,12 +28,12 @@ namespace IoTDataPlane
 namespace IoTDataPlaneErrorMapper
 {
 
-static const int METHOD_NOT_ALLOWED_HASH = HashingUtils::HashString("MethodNotAllowedException");
-static const int CONFLICT_HASH = HashingUtils::HashString("ConflictException");
-static const int UNSUPPORTED_DOCUMENT_ENCODING_HASH = HashingUtils::HashString("UnsupportedDocumentEncodingException");
-static const int UNAUTHORIZED_HASH = HashingUtils::HashString("UnauthorizedException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int REQUEST_ENTITY_TOO_LARGE_HASH = HashingUtils::HashString("RequestEntityTooLargeException");
+static constexpr int METHOD_NOT_ALLOWED_HASH = HashingUtils::CompileTimeHashString("MethodNotAllowedException");
+static constexpr int CONFLICT_HASH = HashingUtils::CompileTimeHashString("ConflictException");
+static constexpr int UNSUPPORTED_DOCUMENT_ENCODING_HASH = HashingUtils::CompileTimeHashString("UnsupportedDocumentEncodingException");
+static constexpr int UNAUTHORIZED_HASH = HashingUtils::CompileTimeHashString("UnauthorizedException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int REQUEST_ENTITY_TOO_LARGE_HASH = HashingUtils::CompileTimeHashString("RequestEntityTooLargeException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
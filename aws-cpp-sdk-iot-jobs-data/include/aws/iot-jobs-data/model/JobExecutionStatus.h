@@ -39,7 +39,8 @@ namespace JobExecutionStatusMapper
 {
 AWS_IOTJOBSDATAPLANE_API JobExecutionStatus GetJobExecutionStatusForName(const Aws::String& name);
 
-AWS_IOTJOBSDATAPLANE_API Aws::String GetNameForJobExecutionStatus(JobExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOTJOBSDATAPLANE_API const char* GetNameForJobExecutionStatus(JobExecutionStatus value);
 } // namespace JobExecutionStatusMapper
 } // namespace Model
 } // namespace IoTJobsDataPlane
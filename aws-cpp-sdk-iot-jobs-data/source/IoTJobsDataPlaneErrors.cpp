@@ -28,10 +28,10 @@ namespace IoTJobsDataPlane
 namespace IoTJobsDataPlaneErrorMapper
 {
 
-static const int TERMINAL_STATE_HASH = HashingUtils::HashString("TerminalStateException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int CERTIFICATE_VALIDATION_HASH = HashingUtils::HashString("CertificateValidationException");
-static const int INVALID_STATE_TRANSITION_HASH = HashingUtils::HashString("InvalidStateTransitionException");
+static constexpr int TERMINAL_STATE_HASH = HashingUtils::CompileTimeHashString("TerminalStateException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int CERTIFICATE_VALIDATION_HASH = HashingUtils::CompileTimeHashString("CertificateValidationException");
+static constexpr int INVALID_STATE_TRANSITION_HASH = HashingUtils::CompileTimeHashString("InvalidStateTransitionException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,45 +30,65 @@ namespace Aws
       namespace JobExecutionStatusMapper
       {
 
-        static const int QUEUED_HASH = HashingUtils::HashString("QUEUED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int REJECTED_HASH = HashingUtils::HashString("REJECTED");
-        static const int REMOVED_HASH = HashingUtils::HashString("REMOVED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
+        static constexpr int QUEUED_HASH = HashingUtils::CompileTimeHashString("QUEUED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int REJECTED_HASH = HashingUtils::CompileTimeHashString("REJECTED");
+        static constexpr int REMOVED_HASH = HashingUtils::CompileTimeHashString("REMOVED");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
 
 
         JobExecutionStatus GetJobExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == QUEUED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobExecutionStatus::QUEUED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return JobExecutionStatus::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return JobExecutionStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobExecutionStatus::FAILED;
-          }
-          else if (hashCode == REJECTED_HASH)
-          {
-            return JobExecutionStatus::REJECTED;
-          }
-          else if (hashCode == REMOVED_HASH)
-          {
-            return JobExecutionStatus::REMOVED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return JobExecutionStatus::CANCELED;
+          case QUEUED_HASH:
+            if (name == "QUEUED")
+            {
+              return JobExecutionStatus::QUEUED;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return JobExecutionStatus::IN_PROGRESS;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return JobExecutionStatus::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return JobExecutionStatus::FAILED;
+            }
+            break;
+          case REJECTED_HASH:
+            if (name == "REJECTED")
+            {
+              return JobExecutionStatus::REJECTED;
+            }
+            break;
+          case REMOVED_HASH:
+            if (name == "REMOVED")
+            {
+              return JobExecutionStatus::REMOVED;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return JobExecutionStatus::CANCELED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return JobExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobExecutionStatus(JobExecutionStatus enumValue)
+        const char* GetNameForJobExecutionStatus(JobExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
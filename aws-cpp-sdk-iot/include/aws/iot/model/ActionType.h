@@ -36,7 +36,8 @@ namespace ActionTypeMapper
 {
 AWS_IOT_API ActionType GetActionTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForActionType(ActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForActionType(ActionType value);
 } // namespace ActionTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -33,7 +33,8 @@ namespace AlertTargetTypeMapper
 {
 AWS_IOT_API AlertTargetType GetAlertTargetTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAlertTargetType(AlertTargetType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAlertTargetType(AlertTargetType value);
 } // namespace AlertTargetTypeMapper
 } // namespace Model
 } // namespace IoT
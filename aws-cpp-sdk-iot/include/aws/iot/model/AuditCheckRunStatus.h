@@ -38,7 +38,8 @@ namespace AuditCheckRunStatusMapper
 {
 AWS_IOT_API AuditCheckRunStatus GetAuditCheckRunStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAuditCheckRunStatus(AuditCheckRunStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAuditCheckRunStatus(AuditCheckRunStatus value);
 } // namespace AuditCheckRunStatusMapper
 } // namespace Model
 } // namespace IoT
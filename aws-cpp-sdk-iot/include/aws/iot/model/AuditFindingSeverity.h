@@ -36,7 +36,8 @@ namespace AuditFindingSeverityMapper
 {
 AWS_IOT_API AuditFindingSeverity GetAuditFindingSeverityForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAuditFindingSeverity(AuditFindingSeverity value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAuditFindingSeverity(AuditFindingSeverity value);
 } // namespace AuditFindingSeverityMapper
 } // namespace Model
 } // namespace IoT
@@ -36,7 +36,8 @@ namespace AuditFrequencyMapper
 {
 AWS_IOT_API AuditFrequency GetAuditFrequencyForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAuditFrequency(AuditFrequency value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAuditFrequency(AuditFrequency value);
 } // namespace AuditFrequencyMapper
 } // namespace Model
 } // namespace IoT
@@ -33,7 +33,8 @@ namespace AuditNotificationTypeMapper
 {
 AWS_IOT_API AuditNotificationType GetAuditNotificationTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAuditNotificationType(AuditNotificationType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAuditNotificationType(AuditNotificationType value);
 } // namespace AuditNotificationTypeMapper
 } // namespace Model
 } // namespace IoT
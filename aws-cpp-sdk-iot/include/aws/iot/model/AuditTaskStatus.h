@@ -36,7 +36,8 @@ namespace AuditTaskStatusMapper
 {
 AWS_IOT_API AuditTaskStatus GetAuditTaskStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAuditTaskStatus(AuditTaskStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAuditTaskStatus(AuditTaskStatus value);
 } // namespace AuditTaskStatusMapper
 } // namespace Model
 } // namespace IoT
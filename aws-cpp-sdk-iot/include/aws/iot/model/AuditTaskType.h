@@ -34,7 +34,8 @@ namespace AuditTaskTypeMapper
 {
 AWS_IOT_API AuditTaskType GetAuditTaskTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAuditTaskType(AuditTaskType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAuditTaskType(AuditTaskType value);
 } // namespace AuditTaskTypeMapper
 } // namespace Model
 } // namespace IoT
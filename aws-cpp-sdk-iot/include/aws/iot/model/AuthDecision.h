@@ -35,7 +35,8 @@ namespace AuthDecisionMapper
 {
 AWS_IOT_API AuthDecision GetAuthDecisionForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAuthDecision(AuthDecision value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAuthDecision(AuthDecision value);
 } // namespace AuthDecisionMapper
 } // namespace Model
 } // namespace IoT
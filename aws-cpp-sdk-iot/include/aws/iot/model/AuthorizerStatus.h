@@ -34,7 +34,8 @@ namespace AuthorizerStatusMapper
 {
 AWS_IOT_API AuthorizerStatus GetAuthorizerStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAuthorizerStatus(AuthorizerStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAuthorizerStatus(AuthorizerStatus value);
 } // namespace AuthorizerStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -34,7 +34,8 @@ namespace AutoRegistrationStatusMapper
 {
 AWS_IOT_API AutoRegistrationStatus GetAutoRegistrationStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForAutoRegistrationStatus(AutoRegistrationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForAutoRegistrationStatus(AutoRegistrationStatus value);
 } // namespace AutoRegistrationStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -34,7 +34,8 @@ namespace CACertificateStatusMapper
 {
 AWS_IOT_API CACertificateStatus GetCACertificateStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForCACertificateStatus(CACertificateStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForCACertificateStatus(CACertificateStatus value);
 } // namespace CACertificateStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -40,7 +40,8 @@ namespace CannedAccessControlListMapper
 {
 AWS_IOT_API CannedAccessControlList GetCannedAccessControlListForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForCannedAccessControlList(CannedAccessControlList value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForCannedAccessControlList(CannedAccessControlList value);
 } // namespace CannedAccessControlListMapper
 } // namespace Model
 } // namespace IoT
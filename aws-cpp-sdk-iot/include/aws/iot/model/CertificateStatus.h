@@ -38,7 +38,8 @@ namespace CertificateStatusMapper
 {
 AWS_IOT_API CertificateStatus GetCertificateStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForCertificateStatus(CertificateStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForCertificateStatus(CertificateStatus value);
 } // namespace CertificateStatusMapper
 } // namespace Model
 } // namespace IoT
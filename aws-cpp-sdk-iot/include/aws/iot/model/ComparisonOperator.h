@@ -40,7 +40,8 @@ namespace ComparisonOperatorMapper
 {
 AWS_IOT_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForComparisonOperator(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace IoT
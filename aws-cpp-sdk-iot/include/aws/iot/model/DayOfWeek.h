@@ -39,7 +39,8 @@ namespace DayOfWeekMapper
 {
 AWS_IOT_API DayOfWeek GetDayOfWeekForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForDayOfWeek(DayOfWeek value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForDayOfWeek(DayOfWeek value);
 } // namespace DayOfWeekMapper
 } // namespace Model
 } // namespace IoT
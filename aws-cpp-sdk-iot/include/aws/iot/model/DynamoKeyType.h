@@ -34,7 +34,8 @@ namespace DynamoKeyTypeMapper
 {
 AWS_IOT_API DynamoKeyType GetDynamoKeyTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForDynamoKeyType(DynamoKeyType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForDynamoKeyType(DynamoKeyType value);
 } // namespace DynamoKeyTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -43,7 +43,8 @@ namespace EventTypeMapper
 {
 AWS_IOT_API EventType GetEventTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForEventType(EventType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForEventType(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -35,7 +35,8 @@ namespace IndexStatusMapper
 {
 AWS_IOT_API IndexStatus GetIndexStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForIndexStatus(IndexStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForIndexStatus(IndexStatus value);
 } // namespace IndexStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -39,7 +39,8 @@ namespace JobExecutionStatusMapper
 {
 AWS_IOT_API JobExecutionStatus GetJobExecutionStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForJobExecutionStatus(JobExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForJobExecutionStatus(JobExecutionStatus value);
 } // namespace JobExecutionStatusMapper
 } // namespace Model
 } // namespace IoT
@@ -36,7 +36,8 @@ namespace JobStatusMapper
 {
 AWS_IOT_API JobStatus GetJobStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForJobStatus(JobStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForJobStatus(JobStatus value);
 } // namespace JobStatusMapper
 } // namespace Model
 } // namespace IoT
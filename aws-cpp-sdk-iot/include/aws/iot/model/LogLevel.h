@@ -37,7 +37,8 @@ namespace LogLevelMapper
 {
 AWS_IOT_API LogLevel GetLogLevelForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForLogLevel(LogLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForLogLevel(LogLevel value);
 } // namespace LogLevelMapper
 } // namespace Model
 } // namespace IoT
@@ -34,7 +34,8 @@ namespace LogTargetTypeMapper
 {
 AWS_IOT_API LogTargetType GetLogTargetTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForLogTargetType(LogTargetType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForLogTargetType(LogTargetType value);
 } // namespace LogTargetTypeMapper
 } // namespace Model
 } // namespace IoT
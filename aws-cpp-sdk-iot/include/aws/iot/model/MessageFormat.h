@@ -34,7 +34,8 @@ namespace MessageFormatMapper
 {
 AWS_IOT_API MessageFormat GetMessageFormatForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForMessageFormat(MessageFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForMessageFormat(MessageFormat value);
 } // namespace MessageFormatMapper
 } // namespace Model
 } // namespace IoT
@@ -36,7 +36,8 @@ namespace OTAUpdateStatusMapper
 {
 AWS_IOT_API OTAUpdateStatus GetOTAUpdateStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForOTAUpdateStatus(OTAUpdateStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForOTAUpdateStatus(OTAUpdateStatus value);
 } // namespace OTAUpdateStatusMapper
 } // namespace Model
 } // namespace IoT
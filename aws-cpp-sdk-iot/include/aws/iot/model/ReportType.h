@@ -34,7 +34,8 @@ namespace ReportTypeMapper
 {
 AWS_IOT_API ReportType GetReportTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForReportType(ReportType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForReportType(ReportType value);
 } // namespace ReportTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -38,7 +38,8 @@ namespace ResourceTypeMapper
 {
 AWS_IOT_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForResourceType(ResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForResourceType(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -37,7 +37,8 @@ namespace StatusMapper
 {
 AWS_IOT_API Status GetStatusForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForStatus(Status value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForStatus(Status value);
 } // namespace StatusMapper
 } // namespace Model
 } // namespace IoT
@@ -34,7 +34,8 @@ namespace TargetSelectionMapper
 {
 AWS_IOT_API TargetSelection GetTargetSelectionForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForTargetSelection(TargetSelection value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForTargetSelection(TargetSelection value);
 } // namespace TargetSelectionMapper
 } // namespace Model
 } // namespace IoT
@@ -35,7 +35,8 @@ namespace ThingIndexingModeMapper
 {
 AWS_IOT_API ThingIndexingMode GetThingIndexingModeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForThingIndexingMode(ThingIndexingMode value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForThingIndexingMode(ThingIndexingMode value);
 } // namespace ThingIndexingModeMapper
 } // namespace Model
 } // namespace IoT
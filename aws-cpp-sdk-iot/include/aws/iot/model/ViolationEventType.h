@@ -35,7 +35,8 @@ namespace ViolationEventTypeMapper
 {
 AWS_IOT_API ViolationEventType GetViolationEventTypeForName(const Aws::String& name);
 
-AWS_IOT_API Aws::String GetNameForViolationEventType(ViolationEventType value);
+// names of values not modeled point into the enum overflow container
+AWS_IOT_API const char* GetNameForViolationEventType(ViolationEventType value);
 } // namespace ViolationEventTypeMapper
 } // namespace Model
 } // namespace IoT
@@ -28,29 +28,29 @@ namespace IoT
 namespace IoTErrorMapper
 {
 
-static const int TRANSFER_ALREADY_COMPLETED_HASH = HashingUtils::HashString("TransferAlreadyCompletedException");
-static const int NOT_CONFIGURED_HASH = HashingUtils::HashString("NotConfiguredException");
-static const int CONFLICTING_RESOURCE_UPDATE_HASH = HashingUtils::HashString("ConflictingResourceUpdateException");
-static const int SQL_PARSE_HASH = HashingUtils::HashString("SqlParseException");
-static const int VERSION_CONFLICT_HASH = HashingUtils::HashString("VersionConflictException");
-static const int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ResourceAlreadyExistsException");
-static const int REGISTRATION_CODE_VALIDATION_HASH = HashingUtils::HashString("RegistrationCodeValidationException");
-static const int CERTIFICATE_CONFLICT_HASH = HashingUtils::HashString("CertificateConflictException");
-static const int INTERNAL_HASH = HashingUtils::HashString("InternalException");
-static const int MALFORMED_POLICY_HASH = HashingUtils::HashString("MalformedPolicyException");
-static const int VERSIONS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("VersionsLimitExceededException");
-static const int TRANSFER_CONFLICT_HASH = HashingUtils::HashString("TransferConflictException");
-static const int INDEX_NOT_READY_HASH = HashingUtils::HashString("IndexNotReadyException");
-static const int UNAUTHORIZED_HASH = HashingUtils::HashString("UnauthorizedException");
-static const int RESOURCE_REGISTRATION_FAILURE_HASH = HashingUtils::HashString("ResourceRegistrationFailureException");
-static const int DELETE_CONFLICT_HASH = HashingUtils::HashString("DeleteConflictException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int CERTIFICATE_STATE_HASH = HashingUtils::HashString("CertificateStateException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int INVALID_STATE_TRANSITION_HASH = HashingUtils::HashString("InvalidStateTransitionException");
-static const int CERTIFICATE_VALIDATION_HASH = HashingUtils::HashString("CertificateValidationException");
-static const int INVALID_RESPONSE_HASH = HashingUtils::HashString("InvalidResponseException");
-static const int INVALID_QUERY_HASH = HashingUtils::HashString("InvalidQueryException");
+static constexpr int TRANSFER_ALREADY_COMPLETED_HASH = HashingUtils::CompileTimeHashString("TransferAlreadyCompletedException");
+static constexpr int NOT_CONFIGURED_HASH = HashingUtils::CompileTimeHashString("NotConfiguredException");
+static constexpr int CONFLICTING_RESOURCE_UPDATE_HASH = HashingUtils::CompileTimeHashString("ConflictingResourceUpdateException");
+static constexpr int SQL_PARSE_HASH = HashingUtils::CompileTimeHashString("SqlParseException");
+static constexpr int VERSION_CONFLICT_HASH = HashingUtils::CompileTimeHashString("VersionConflictException");
+static constexpr int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyExistsException");
+static constexpr int REGISTRATION_CODE_VALIDATION_HASH = HashingUtils::CompileTimeHashString("RegistrationCodeValidationException");
+static constexpr int CERTIFICATE_CONFLICT_HASH = HashingUtils::CompileTimeHashString("CertificateConflictException");
+static constexpr int INTERNAL_HASH = HashingUtils::CompileTimeHashString("InternalException");
+static constexpr int MALFORMED_POLICY_HASH = HashingUtils::CompileTimeHashString("MalformedPolicyException");
+static constexpr int VERSIONS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("VersionsLimitExceededException");
+static constexpr int TRANSFER_CONFLICT_HASH = HashingUtils::CompileTimeHashString("TransferConflictException");
+static constexpr int INDEX_NOT_READY_HASH = HashingUtils::CompileTimeHashString("IndexNotReadyException");
+static constexpr int UNAUTHORIZED_HASH = HashingUtils::CompileTimeHashString("UnauthorizedException");
+static constexpr int RESOURCE_REGISTRATION_FAILURE_HASH = HashingUtils::CompileTimeHashString("ResourceRegistrationFailureException");
+static constexpr int DELETE_CONFLICT_HASH = HashingUtils::CompileTimeHashString("DeleteConflictException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int CERTIFICATE_STATE_HASH = HashingUtils::CompileTimeHashString("CertificateStateException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int INVALID_STATE_TRANSITION_HASH = HashingUtils::CompileTimeHashString("InvalidStateTransitionException");
+static constexpr int CERTIFICATE_VALIDATION_HASH = HashingUtils::CompileTimeHashString("CertificateValidationException");
+static constexpr int INVALID_RESPONSE_HASH = HashingUtils::CompileTimeHashString("InvalidResponseException");
+static constexpr int INVALID_QUERY_HASH = HashingUtils::CompileTimeHashString("InvalidQueryException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
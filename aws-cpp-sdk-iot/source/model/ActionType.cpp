@@ -30,30 +30,44 @@ namespace Aws
       namespace ActionTypeMapper
       {
 
-        static const int PUBLISH_HASH = HashingUtils::HashString("PUBLISH");
-        static const int SUBSCRIBE_HASH = HashingUtils::HashString("SUBSCRIBE");
-        static const int RECEIVE_HASH = HashingUtils::HashString("RECEIVE");
-        static const int CONNECT_HASH = HashingUtils::HashString("CONNECT");
+        static constexpr int PUBLISH_HASH = HashingUtils::CompileTimeHashString("PUBLISH");
+        static constexpr int SUBSCRIBE_HASH = HashingUtils::CompileTimeHashString("SUBSCRIBE");
+        static constexpr int RECEIVE_HASH = HashingUtils::CompileTimeHashString("RECEIVE");
+        static constexpr int CONNECT_HASH = HashingUtils::CompileTimeHashString("CONNECT");
 
 
         ActionType GetActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUBLISH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionType::PUBLISH;
-          }
-          else if (hashCode == SUBSCRIBE_HASH)
-          {
-            return ActionType::SUBSCRIBE;
-          }
-          else if (hashCode == RECEIVE_HASH)
-          {
-            return ActionType::RECEIVE;
-          }
-          else if (hashCode == CONNECT_HASH)
-          {
-            return ActionType::CONNECT;
+          case PUBLISH_HASH:
+            if (name == "PUBLISH")
+            {
+              return ActionType::PUBLISH;
+            }
+            break;
+          case SUBSCRIBE_HASH:
+            if (name == "SUBSCRIBE")
+            {
+              return ActionType::SUBSCRIBE;
+            }
+            break;
+          case RECEIVE_HASH:
+            if (name == "RECEIVE")
+            {
+              return ActionType::RECEIVE;
+            }
+            break;
+          case CONNECT_HASH:
+            if (name == "CONNECT")
+            {
+              return ActionType::CONNECT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ActionType::NOT_SET;
         }
 
-        Aws::String GetNameForActionType(ActionType enumValue)
+        const char* GetNameForActionType(ActionType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace AuditCheckRunStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int WAITING_FOR_DATA_COLLECTION_HASH = HashingUtils::HashString("WAITING_FOR_DATA_COLLECTION");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int COMPLETED_COMPLIANT_HASH = HashingUtils::HashString("COMPLETED_COMPLIANT");
-        static const int COMPLETED_NON_COMPLIANT_HASH = HashingUtils::HashString("COMPLETED_NON_COMPLIANT");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int WAITING_FOR_DATA_COLLECTION_HASH = HashingUtils::CompileTimeHashString("WAITING_FOR_DATA_COLLECTION");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
+        static constexpr int COMPLETED_COMPLIANT_HASH = HashingUtils::CompileTimeHashString("COMPLETED_COMPLIANT");
+        static constexpr int COMPLETED_NON_COMPLIANT_HASH = HashingUtils::CompileTimeHashString("COMPLETED_NON_COMPLIANT");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         AuditCheckRunStatus GetAuditCheckRunStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuditCheckRunStatus::IN_PROGRESS;
-          }
-          else if (hashCode == WAITING_FOR_DATA_COLLECTION_HASH)
-          {
-            return AuditCheckRunStatus::WAITING_FOR_DATA_COLLECTION;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return AuditCheckRunStatus::CANCELED;
-          }
-          else if (hashCode == COMPLETED_COMPLIANT_HASH)
-          {
-            return AuditCheckRunStatus::COMPLETED_COMPLIANT;
-          }
-          else if (hashCode == COMPLETED_NON_COMPLIANT_HASH)
-          {
-            return AuditCheckRunStatus::COMPLETED_NON_COMPLIANT;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AuditCheckRunStatus::FAILED;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return AuditCheckRunStatus::IN_PROGRESS;
+            }
+            break;
+          case WAITING_FOR_DATA_COLLECTION_HASH:
+            if (name == "WAITING_FOR_DATA_COLLECTION")
+            {
+              return AuditCheckRunStatus::WAITING_FOR_DATA_COLLECTION;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return AuditCheckRunStatus::CANCELED;
+            }
+            break;
+          case COMPLETED_COMPLIANT_HASH:
+            if (name == "COMPLETED_COMPLIANT")
+            {
+              return AuditCheckRunStatus::COMPLETED_COMPLIANT;
+            }
+            break;
+          case COMPLETED_NON_COMPLIANT_HASH:
+            if (name == "COMPLETED_NON_COMPLIANT")
+            {
+              return AuditCheckRunStatus::COMPLETED_NON_COMPLIANT;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return AuditCheckRunStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return AuditCheckRunStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAuditCheckRunStatus(AuditCheckRunStatus enumValue)
+        const char* GetNameForAuditCheckRunStatus(AuditCheckRunStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace AuditFindingSeverityMapper
       {
 
-        static const int CRITICAL_HASH = HashingUtils::HashString("CRITICAL");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
+        static constexpr int CRITICAL_HASH = HashingUtils::CompileTimeHashString("CRITICAL");
+        static constexpr int HIGH_HASH = HashingUtils::CompileTimeHashString("HIGH");
+        static constexpr int MEDIUM_HASH = HashingUtils::CompileTimeHashString("MEDIUM");
+        static constexpr int LOW_HASH = HashingUtils::CompileTimeHashString("LOW");
 
 
         AuditFindingSeverity GetAuditFindingSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CRITICAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuditFindingSeverity::CRITICAL;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return AuditFindingSeverity::HIGH;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return AuditFindingSeverity::MEDIUM;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return AuditFindingSeverity::LOW;
+          case CRITICAL_HASH:
+            if (name == "CRITICAL")
+            {
+              return AuditFindingSeverity::CRITICAL;
+            }
+            break;
+          case HIGH_HASH:
+            if (name == "HIGH")
+            {
+              return AuditFindingSeverity::HIGH;
+            }
+            break;
+          case MEDIUM_HASH:
+            if (name == "MEDIUM")
+            {
+              return AuditFindingSeverity::MEDIUM;
+            }
+            break;
+          case LOW_HASH:
+            if (name == "LOW")
+            {
+              return AuditFindingSeverity::LOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AuditFindingSeverity::NOT_SET;
         }
 
-        Aws::String GetNameForAuditFindingSeverity(AuditFindingSeverity enumValue)
+        const char* GetNameForAuditFindingSeverity(AuditFindingSeverity enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
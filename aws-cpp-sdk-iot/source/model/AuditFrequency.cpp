@@ -30,30 +30,44 @@ namespace Aws
       namespace AuditFrequencyMapper
       {
 
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
-        static const int WEEKLY_HASH = HashingUtils::HashString("WEEKLY");
-        static const int BIWEEKLY_HASH = HashingUtils::HashString("BIWEEKLY");
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
+        static constexpr int DAILY_HASH = HashingUtils::CompileTimeHashString("DAILY");
+        static constexpr int WEEKLY_HASH = HashingUtils::CompileTimeHashString("WEEKLY");
+        static constexpr int BIWEEKLY_HASH = HashingUtils::CompileTimeHashString("BIWEEKLY");
+        static constexpr int MONTHLY_HASH = HashingUtils::CompileTimeHashString("MONTHLY");
 
 
         AuditFrequency GetAuditFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DAILY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuditFrequency::DAILY;
-          }
-          else if (hashCode == WEEKLY_HASH)
-          {
-            return AuditFrequency::WEEKLY;
-          }
-          else if (hashCode == BIWEEKLY_HASH)
-          {
-            return AuditFrequency::BIWEEKLY;
-          }
-          else if (hashCode == MONTHLY_HASH)
-          {
-            return AuditFrequency::MONTHLY;
+          case DAILY_HASH:
+            if (name == "DAILY")
+            {
+              return AuditFrequency::DAILY;
+            }
+            break;
+          case WEEKLY_HASH:
+            if (name == "WEEKLY")
+            {
+              return AuditFrequency::WEEKLY;
+            }
+            break;
+          case BIWEEKLY_HASH:
+            if (name == "BIWEEKLY")
+            {
+              return AuditFrequency::BIWEEKLY;
+            }
+            break;
+          case MONTHLY_HASH:
+            if (name == "MONTHLY")
+            {
+              return AuditFrequency::MONTHLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AuditFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForAuditFrequency(AuditFrequency enumValue)
+        const char* GetNameForAuditFrequency(AuditFrequency enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace AuditNotificationTypeMapper
       {
 
-        static const int SNS_HASH = HashingUtils::HashString("SNS");
+        static constexpr int SNS_HASH = HashingUtils::CompileTimeHashString("SNS");
 
 
         AuditNotificationType GetAuditNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SNS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuditNotificationType::SNS;
+          case SNS_HASH:
+            if (name == "SNS")
+            {
+              return AuditNotificationType::SNS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return AuditNotificationType::NOT_SET;
         }
 
-        Aws::String GetNameForAuditNotificationType(AuditNotificationType enumValue)
+        const char* GetNameForAuditNotificationType(AuditNotificationType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace AuditTaskStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
 
 
         AuditTaskStatus GetAuditTaskStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuditTaskStatus::IN_PROGRESS;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return AuditTaskStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return AuditTaskStatus::FAILED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return AuditTaskStatus::CANCELED;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return AuditTaskStatus::IN_PROGRESS;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return AuditTaskStatus::COMPLETED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return AuditTaskStatus::FAILED;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return AuditTaskStatus::CANCELED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AuditTaskStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAuditTaskStatus(AuditTaskStatus enumValue)
+        const char* GetNameForAuditTaskStatus(AuditTaskStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AuditTaskTypeMapper
       {
 
-        static const int ON_DEMAND_AUDIT_TASK_HASH = HashingUtils::HashString("ON_DEMAND_AUDIT_TASK");
-        static const int SCHEDULED_AUDIT_TASK_HASH = HashingUtils::HashString("SCHEDULED_AUDIT_TASK");
+        static constexpr int ON_DEMAND_AUDIT_TASK_HASH = HashingUtils::CompileTimeHashString("ON_DEMAND_AUDIT_TASK");
+        static constexpr int SCHEDULED_AUDIT_TASK_HASH = HashingUtils::CompileTimeHashString("SCHEDULED_AUDIT_TASK");
 
 
         AuditTaskType GetAuditTaskTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ON_DEMAND_AUDIT_TASK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuditTaskType::ON_DEMAND_AUDIT_TASK;
-          }
-          else if (hashCode == SCHEDULED_AUDIT_TASK_HASH)
-          {
-            return AuditTaskType::SCHEDULED_AUDIT_TASK;
+          case ON_DEMAND_AUDIT_TASK_HASH:
+            if (name == "ON_DEMAND_AUDIT_TASK")
+            {
+              return AuditTaskType::ON_DEMAND_AUDIT_TASK;
+            }
+            break;
+          case SCHEDULED_AUDIT_TASK_HASH:
+            if (name == "SCHEDULED_AUDIT_TASK")
+            {
+              return AuditTaskType::SCHEDULED_AUDIT_TASK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AuditTaskType::NOT_SET;
         }
 
-        Aws::String GetNameForAuditTaskType(AuditTaskType enumValue)
+        const char* GetNameForAuditTaskType(AuditTaskType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
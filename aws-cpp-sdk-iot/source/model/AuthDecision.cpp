@@ -30,25 +30,37 @@ namespace Aws
       namespace AuthDecisionMapper
       {
 
-        static const int ALLOWED_HASH = HashingUtils::HashString("ALLOWED");
-        static const int EXPLICIT_DENY_HASH = HashingUtils::HashString("EXPLICIT_DENY");
-        static const int IMPLICIT_DENY_HASH = HashingUtils::HashString("IMPLICIT_DENY");
+        static constexpr int ALLOWED_HASH = HashingUtils::CompileTimeHashString("ALLOWED");
+        static constexpr int EXPLICIT_DENY_HASH = HashingUtils::CompileTimeHashString("EXPLICIT_DENY");
+        static constexpr int IMPLICIT_DENY_HASH = HashingUtils::CompileTimeHashString("IMPLICIT_DENY");
 
 
         AuthDecision GetAuthDecisionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALLOWED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthDecision::ALLOWED;
-          }
-          else if (hashCode == EXPLICIT_DENY_HASH)
-          {
-            return AuthDecision::EXPLICIT_DENY;
-          }
-          else if (hashCode == IMPLICIT_DENY_HASH)
-          {
-            return AuthDecision::IMPLICIT_DENY;
+          case ALLOWED_HASH:
+            if (name == "ALLOWED")
+            {
+              return AuthDecision::ALLOWED;
+            }
+            break;
+          case EXPLICIT_DENY_HASH:
+            if (name == "EXPLICIT_DENY")
+            {
+              return AuthDecision::EXPLICIT_DENY;
+            }
+            break;
+          case IMPLICIT_DENY_HASH:
+            if (name == "IMPLICIT_DENY")
+            {
+              return AuthDecision::IMPLICIT_DENY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AuthDecision::NOT_SET;
         }
 
-        Aws::String GetNameForAuthDecision(AuthDecision enumValue)
+        const char* GetNameForAuthDecision(AuthDecision enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
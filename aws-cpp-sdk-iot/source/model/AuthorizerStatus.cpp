@@ -30,20 +30,30 @@ namespace Aws
       namespace AuthorizerStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int INACTIVE_HASH = HashingUtils::CompileTimeHashString("INACTIVE");
 
 
         AuthorizerStatus GetAuthorizerStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthorizerStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return AuthorizerStatus::INACTIVE;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return AuthorizerStatus::ACTIVE;
+            }
+            break;
+          case INACTIVE_HASH:
+            if (name == "INACTIVE")
+            {
+              return AuthorizerStatus::INACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AuthorizerStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAuthorizerStatus(AuthorizerStatus enumValue)
+        const char* GetNameForAuthorizerStatus(AuthorizerStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AutoRegistrationStatusMapper
       {
 
-        static const int ENABLE_HASH = HashingUtils::HashString("ENABLE");
-        static const int DISABLE_HASH = HashingUtils::HashString("DISABLE");
+        static constexpr int ENABLE_HASH = HashingUtils::CompileTimeHashString("ENABLE");
+        static constexpr int DISABLE_HASH = HashingUtils::CompileTimeHashString("DISABLE");
 
 
         AutoRegistrationStatus GetAutoRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AutoRegistrationStatus::ENABLE;
-          }
-          else if (hashCode == DISABLE_HASH)
-          {
-            return AutoRegistrationStatus::DISABLE;
+          case ENABLE_HASH:
+            if (name == "ENABLE")
+            {
+              return AutoRegistrationStatus::ENABLE;
+            }
+            break;
+          case DISABLE_HASH:
+            if (name == "DISABLE")
+            {
+              return AutoRegistrationStatus::DISABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AutoRegistrationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAutoRegistrationStatus(AutoRegistrationStatus enumValue)
+        const char* GetNameForAutoRegistrationStatus(AutoRegistrationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
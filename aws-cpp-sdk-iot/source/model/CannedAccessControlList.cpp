@@ -30,50 +30,72 @@ namespace Aws
       namespace CannedAccessControlListMapper
       {
 
-        static const int private__HASH = HashingUtils::HashString("private");
-        static const int public_read_HASH = HashingUtils::HashString("public-read");
-        static const int public_read_write_HASH = HashingUtils::HashString("public-read-write");
-        static const int aws_exec_read_HASH = HashingUtils::HashString("aws-exec-read");
-        static const int authenticated_read_HASH = HashingUtils::HashString("authenticated-read");
-        static const int bucket_owner_read_HASH = HashingUtils::HashString("bucket-owner-read");
-        static const int bucket_owner_full_control_HASH = HashingUtils::HashString("bucket-owner-full-control");
-        static const int log_delivery_write_HASH = HashingUtils::HashString("log-delivery-write");
+        static constexpr int private__HASH = HashingUtils::CompileTimeHashString("private");
+        static constexpr int public_read_HASH = HashingUtils::CompileTimeHashString("public-read");
+        static constexpr int public_read_write_HASH = HashingUtils::CompileTimeHashString("public-read-write");
+        static constexpr int aws_exec_read_HASH = HashingUtils::CompileTimeHashString("aws-exec-read");
+        static constexpr int authenticated_read_HASH = HashingUtils::CompileTimeHashString("authenticated-read");
+        static constexpr int bucket_owner_read_HASH = HashingUtils::CompileTimeHashString("bucket-owner-read");
+        static constexpr int bucket_owner_full_control_HASH = HashingUtils::CompileTimeHashString("bucket-owner-full-control");
+        static constexpr int log_delivery_write_HASH = HashingUtils::CompileTimeHashString("log-delivery-write");
 
 
         CannedAccessControlList GetCannedAccessControlListForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == private__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CannedAccessControlList::private_;
-          }
-          else if (hashCode == public_read_HASH)
-          {
-            return CannedAccessControlList::public_read;
-          }
-          else if (hashCode == public_read_write_HASH)
-          {
-            return CannedAccessControlList::public_read_write;
-          }
-          else if (hashCode == aws_exec_read_HASH)
-          {
-            return CannedAccessControlList::aws_exec_read;
-          }
-          else if (hashCode == authenticated_read_HASH)
-          {
-            return CannedAccessControlList::authenticated_read;
-          }
-          else if (hashCode == bucket_owner_read_HASH)
-          {
-            return CannedAccessControlList::bucket_owner_read;
-          }
-          else if (hashCode == bucket_owner_full_control_HASH)
-          {
-            return CannedAccessControlList::bucket_owner_full_control;
-          }
-          else if (hashCode == log_delivery_write_HASH)
-          {
-            return CannedAccessControlList::log_delivery_write;
+          case private__HASH:
+            if (name == "private")
+            {
+              return CannedAccessControlList::private_;
+            }
+            break;
+          case public_read_HASH:
+            if (name == "public-read")
+            {
+              return CannedAccessControlList::public_read;
+            }
+            break;
+          case public_read_write_HASH:
+            if (name == "public-read-write")
+            {
+              return CannedAccessControlList::public_read_write;
+            }
+            break;
+          case aws_exec_read_HASH:
+            if (name == "aws-exec-read")
+            {
+              return CannedAccessControlList::aws_exec_read;
+            }
+            break;
+          case authenticated_read_HASH:
+            if (name == "authenticated-read")
+            {
+              return CannedAccessControlList::authenticated_read;
+            }
+            break;
+          case bucket_owner_read_HASH:
+            if (name == "bucket-owner-read")
+            {
+              return CannedAccessControlList::bucket_owner_read;
+            }
+            break;
+          case bucket_owner_full_control_HASH:
+            if (name == "bucket-owner-full-control")
+            {
+              return CannedAccessControlList::bucket_owner_full_control;
+            }
+            break;
+          case log_delivery_write_HASH:
+            if (name == "log-delivery-write")
+            {
+              return CannedAccessControlList::log_delivery_write;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return CannedAccessControlList::NOT_SET;
         }
 
-        Aws::String GetNameForCannedAccessControlList(CannedAccessControlList enumValue)
+        const char* GetNameForCannedAccessControlList(CannedAccessControlList enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
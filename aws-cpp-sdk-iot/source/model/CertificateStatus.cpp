@@ -30,40 +30,58 @@ namespace Aws
       namespace CertificateStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int REVOKED_HASH = HashingUtils::HashString("REVOKED");
-        static const int PENDING_TRANSFER_HASH = HashingUtils::HashString("PENDING_TRANSFER");
-        static const int REGISTER_INACTIVE_HASH = HashingUtils::HashString("REGISTER_INACTIVE");
-        static const int PENDING_ACTIVATION_HASH = HashingUtils::HashString("PENDING_ACTIVATION");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int INACTIVE_HASH = HashingUtils::CompileTimeHashString("INACTIVE");
+        static constexpr int REVOKED_HASH = HashingUtils::CompileTimeHashString("REVOKED");
+        static constexpr int PENDING_TRANSFER_HASH = HashingUtils::CompileTimeHashString("PENDING_TRANSFER");
+        static constexpr int REGISTER_INACTIVE_HASH = HashingUtils::CompileTimeHashString("REGISTER_INACTIVE");
+        static constexpr int PENDING_ACTIVATION_HASH = HashingUtils::CompileTimeHashString("PENDING_ACTIVATION");
 
 
         CertificateStatus GetCertificateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CertificateStatus::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return CertificateStatus::INACTIVE;
-          }
-          else if (hashCode == REVOKED_HASH)
-          {
-            return CertificateStatus::REVOKED;
-          }
-          else if (hashCode == PENDING_TRANSFER_HASH)
-          {
-            return CertificateStatus::PENDING_TRANSFER;
-          }
-          else if (hashCode == REGISTER_INACTIVE_HASH)
-          {
-            return CertificateStatus::REGISTER_INACTIVE;
-          }
-          else if (hashCode == PENDING_ACTIVATION_HASH)
-          {
-            return CertificateStatus::PENDING_ACTIVATION;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return CertificateStatus::ACTIVE;
+            }
+            break;
+          case INACTIVE_HASH:
+            if (name == "INACTIVE")
+            {
+              return CertificateStatus::INACTIVE;
+            }
+            break;
+          case REVOKED_HASH:
+            if (name == "REVOKED")
+            {
+              return CertificateStatus::REVOKED;
+            }
+            break;
+          case PENDING_TRANSFER_HASH:
+            if (name == "PENDING_TRANSFER")
+            {
+              return CertificateStatus::PENDING_TRANSFER;
+            }
+            break;
+          case REGISTER_INACTIVE_HASH:
+            if (name == "REGISTER_INACTIVE")
+            {
+              return CertificateStatus::REGISTER_INACTIVE;
+            }
+            break;
+          case PENDING_ACTIVATION_HASH:
+            if (name == "PENDING_ACTIVATION")
+            {
+              return CertificateStatus::PENDING_ACTIVATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return CertificateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCertificateStatus(CertificateStatus enumValue)
+        const char* GetNameForCertificateStatus(CertificateStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
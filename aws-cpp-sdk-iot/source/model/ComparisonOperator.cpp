@@ -30,50 +30,72 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int less_than_HASH = HashingUtils::HashString("less-than");
-        static const int less_than_equals_HASH = HashingUtils::HashString("less-than-equals");
-        static const int greater_than_HASH = HashingUtils::HashString("greater-than");
-        static const int greater_than_equals_HASH = HashingUtils::HashString("greater-than-equals");
-        static const int in_cidr_set_HASH = HashingUtils::HashString("in-cidr-set");
-        static const int not_in_cidr_set_HASH = HashingUtils::HashString("not-in-cidr-set");
-        static const int in_port_set_HASH = HashingUtils::HashString("in-port-set");
-        static const int not_in_port_set_HASH = HashingUtils::HashString("not-in-port-set");
+        static constexpr int less_than_HASH = HashingUtils::CompileTimeHashString("less-than");
+        static constexpr int less_than_equals_HASH = HashingUtils::CompileTimeHashString("less-than-equals");
+        static constexpr int greater_than_HASH = HashingUtils::CompileTimeHashString("greater-than");
+        static constexpr int greater_than_equals_HASH = HashingUtils::CompileTimeHashString("greater-than-equals");
+        static constexpr int in_cidr_set_HASH = HashingUtils::CompileTimeHashString("in-cidr-set");
+        static constexpr int not_in_cidr_set_HASH = HashingUtils::CompileTimeHashString("not-in-cidr-set");
+        static constexpr int in_port_set_HASH = HashingUtils::CompileTimeHashString("in-port-set");
+        static constexpr int not_in_port_set_HASH = HashingUtils::CompileTimeHashString("not-in-port-set");
 
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == less_than_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComparisonOperator::less_than;
-          }
-          else if (hashCode == less_than_equals_HASH)
-          {
-            return ComparisonOperator::less_than_equals;
-          }
-          else if (hashCode == greater_than_HASH)
-          {
-            return ComparisonOperator::greater_than;
-          }
-          else if (hashCode == greater_than_equals_HASH)
-          {
-            return ComparisonOperator::greater_than_equals;
-          }
-          else if (hashCode == in_cidr_set_HASH)
-          {
-            return ComparisonOperator::in_cidr_set;
-          }
-          else if (hashCode == not_in_cidr_set_HASH)
-          {
-            return ComparisonOperator::not_in_cidr_set;
-          }
-          else if (hashCode == in_port_set_HASH)
-          {
-            return ComparisonOperator::in_port_set;
-          }
-          else if (hashCode == not_in_port_set_HASH)
-          {
-            return ComparisonOperator::not_in_port_set;
+          case less_than_HASH:
+            if (name == "less-than")
+            {
+              return ComparisonOperator::less_than;
+            }
+            break;
+          case less_than_equals_HASH:
+            if (name == "less-than-equals")
+            {
+              return ComparisonOperator::less_than_equals;
+            }
+            break;
+          case greater_than_HASH:
+            if (name == "greater-than")
+            {
+              return ComparisonOperator::greater_than;
+            }
+            break;
+          case greater_than_equals_HASH:
+            if (name == "greater-than-equals")
+            {
+              return ComparisonOperator::greater_than_equals;
+            }
+            break;
+          case in_cidr_set_HASH:
+            if (name == "in-cidr-set")
+            {
+              return ComparisonOperator::in_cidr_set;
+            }
+            break;
+          case not_in_cidr_set_HASH:
+            if (name == "not-in-cidr-set")
+            {
+              return ComparisonOperator::not_in_cidr_set;
+            }
+            break;
+          case in_port_set_HASH:
+            if (name == "in-port-set")
+            {
+              return ComparisonOperator::in_port_set;
+            }
+            break;
+          case not_in_port_set_HASH:
+            if (name == "not-in-port-set")
+            {
+              return ComparisonOperator::not_in_port_set;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperator(ComparisonOperator enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace DayOfWeekMapper
       {
 
-        static const int SUN_HASH = HashingUtils::HashString("SUN");
-        static const int MON_HASH = HashingUtils::HashString("MON");
-        static const int TUE_HASH = HashingUtils::HashString("TUE");
-        static const int WED_HASH = HashingUtils::HashString("WED");
-        static const int THU_HASH = HashingUtils::HashString("THU");
-        static const int FRI_HASH = HashingUtils::HashString("FRI");
-        static const int SAT_HASH = HashingUtils::HashString("SAT");
+        static constexpr int SUN_HASH = HashingUtils::CompileTimeHashString("SUN");
+        static constexpr int MON_HASH = HashingUtils::CompileTimeHashString("MON");
+        static constexpr int TUE_HASH = HashingUtils::CompileTimeHashString("TUE");
+        static constexpr int WED_HASH = HashingUtils::CompileTimeHashString("WED");
+        static constexpr int THU_HASH = HashingUtils::CompileTimeHashString("THU");
+        static constexpr int FRI_HASH = HashingUtils::CompileTimeHashString("FRI");
+        static constexpr int SAT_HASH = HashingUtils::CompileTimeHashString("SAT");
 
 
         DayOfWeek GetDayOfWeekForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DayOfWeek::SUN;
-          }
-          else if (hashCode == MON_HASH)
-          {
-            return DayOfWeek::MON;
-          }
-          else if (hashCode == TUE_HASH)
-          {
-            return DayOfWeek::TUE;
-          }
-          else if (hashCode == WED_HASH)
-          {
-            return DayOfWeek::WED;
-          }
-          else if (hashCode == THU_HASH)
-          {
-            return DayOfWeek::THU;
-          }
-          else if (hashCode == FRI_HASH)
-          {
-            return DayOfWeek::FRI;
-          }
-          else if (hashCode == SAT_HASH)
-          {
-            return DayOfWeek::SAT;
+          case SUN_HASH:
+            if (name == "SUN")
+            {
+              return DayOfWeek::SUN;
+            }
+            break;
+          case MON_HASH:
+            if (name == "MON")
+            {
+              return DayOfWeek::MON;
+            }
+            break;
+          case TUE_HASH:
+            if (name == "TUE")
+            {
+              return DayOfWeek::TUE;
+            }
+            break;
+          case WED_HASH:
+            if (name == "WED")
+            {
+              return DayOfWeek::WED;
+            }
+            break;
+          case THU_HASH:
+            if (name == "THU")
+            {
+              return DayOfWeek::THU;
+            }
+            break;
+          case FRI_HASH:
+            if (name == "FRI")
+            {
+              return DayOfWeek::FRI;
+            }
+            break;
+          case SAT_HASH:
+            if (name == "SAT")
+            {
+              return DayOfWeek::SAT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return DayOfWeek::NOT_SET;
         }
 
-        Aws::String GetNameForDayOfWeek(DayOfWeek enumValue)
+        const char* GetNameForDayOfWeek(DayOfWeek enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DynamoKeyTypeMapper
       {
 
-        static const int STRING_HASH = HashingUtils::HashString("STRING");
-        static const int NUMBER_HASH = HashingUtils::HashString("NUMBER");
+        static constexpr int STRING_HASH = HashingUtils::CompileTimeHashString("STRING");
+        static constexpr int NUMBER_HASH = HashingUtils::CompileTimeHashString("NUMBER");
 
 
         DynamoKeyType GetDynamoKeyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STRING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DynamoKeyType::STRING;
-          }
-          else if (hashCode == NUMBER_HASH)
-          {
-            return DynamoKeyType::NUMBER;
+          case STRING_HASH:
+            if (name == "STRING")
+            {
+              return DynamoKeyType::STRING;
+            }
+            break;
+          case NUMBER_HASH:
+            if (name == "NUMBER")
+            {
+              return DynamoKeyType::NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DynamoKeyType::NOT_SET;
         }
 
-        Aws::String GetNameForDynamoKeyType(DynamoKeyType enumValue)
+        const char* GetNameForDynamoKeyType(DynamoKeyType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,65 +30,93 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int THING_HASH = HashingUtils::HashString("THING");
-        static const int THING_GROUP_HASH = HashingUtils::HashString("THING_GROUP");
-        static const int THING_TYPE_HASH = HashingUtils::HashString("THING_TYPE");
-        static const int THING_GROUP_MEMBERSHIP_HASH = HashingUtils::HashString("THING_GROUP_MEMBERSHIP");
-        static const int THING_GROUP_HIERARCHY_HASH = HashingUtils::HashString("THING_GROUP_HIERARCHY");
-        static const int THING_TYPE_ASSOCIATION_HASH = HashingUtils::HashString("THING_TYPE_ASSOCIATION");
-        static const int JOB_HASH = HashingUtils::HashString("JOB");
-        static const int JOB_EXECUTION_HASH = HashingUtils::HashString("JOB_EXECUTION");
-        static const int POLICY_HASH = HashingUtils::HashString("POLICY");
-        static const int CERTIFICATE_HASH = HashingUtils::HashString("CERTIFICATE");
-        static const int CA_CERTIFICATE_HASH = HashingUtils::HashString("CA_CERTIFICATE");
+        static constexpr int THING_HASH = HashingUtils::CompileTimeHashString("THING");
+        static constexpr int THING_GROUP_HASH = HashingUtils::CompileTimeHashString("THING_GROUP");
+        static constexpr int THING_TYPE_HASH = HashingUtils::CompileTimeHashString("THING_TYPE");
+        static constexpr int THING_GROUP_MEMBERSHIP_HASH = HashingUtils::CompileTimeHashString("THING_GROUP_MEMBERSHIP");
+        static constexpr int THING_GROUP_HIERARCHY_HASH = HashingUtils::CompileTimeHashString("THING_GROUP_HIERARCHY");
+        static constexpr int THING_TYPE_ASSOCIATION_HASH = HashingUtils::CompileTimeHashString("THING_TYPE_ASSOCIATION");
+        static constexpr int JOB_HASH = HashingUtils::CompileTimeHashString("JOB");
+        static constexpr int JOB_EXECUTION_HASH = HashingUtils::CompileTimeHashString("JOB_EXECUTION");
+        static constexpr int POLICY_HASH = HashingUtils::CompileTimeHashString("POLICY");
+        static constexpr int CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("CERTIFICATE");
+        static constexpr int CA_CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("CA_CERTIFICATE");
 
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == THING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventType::THING;
-          }
-          else if (hashCode == THING_GROUP_HASH)
-          {
-            return EventType::THING_GROUP;
-          }
-          else if (hashCode == THING_TYPE_HASH)
-          {
-            return EventType::THING_TYPE;
-          }
-          else if (hashCode == THING_GROUP_MEMBERSHIP_HASH)
-          {
-            return EventType::THING_GROUP_MEMBERSHIP;
-          }
-          else if (hashCode == THING_GROUP_HIERARCHY_HASH)
-          {
-            return EventType::THING_GROUP_HIERARCHY;
-          }
-          else if (hashCode == THING_TYPE_ASSOCIATION_HASH)
-          {
-            return EventType::THING_TYPE_ASSOCIATION;
-          }
-          else if (hashCode == JOB_HASH)
-          {
-            return EventType::JOB;
-          }
-          else if (hashCode == JOB_EXECUTION_HASH)
-          {
-            return EventType::JOB_EXECUTION;
-          }
-          else if (hashCode == POLICY_HASH)
-          {
-            return EventType::POLICY;
-          }
-          else if (hashCode == CERTIFICATE_HASH)
-          {
-            return EventType::CERTIFICATE;
-          }
-          else if (hashCode == CA_CERTIFICATE_HASH)
-          {
-            return EventType::CA_CERTIFICATE;
+          case THING_HASH:
+            if (name == "THING")
+            {
+              return EventType::THING;
+            }
+            break;
+          case THING_GROUP_HASH:
+            if (name == "THING_GROUP")
+            {
+              return EventType::THING_GROUP;
+            }
+            break;
+          case THING_TYPE_HASH:
+            if (name == "THING_TYPE")
+            {
+              return EventType::THING_TYPE;
+            }
+            break;
+          case THING_GROUP_MEMBERSHIP_HASH:
+            if (name == "THING_GROUP_MEMBERSHIP")
+            {
+              return EventType::THING_GROUP_MEMBERSHIP;
+            }
+            break;
+          case THING_GROUP_HIERARCHY_HASH:
+            if (name == "THING_GROUP_HIERARCHY")
+            {
+              return EventType::THING_GROUP_HIERARCHY;
+            }
+            break;
+          case THING_TYPE_ASSOCIATION_HASH:
+            if (name == "THING_TYPE_ASSOCIATION")
+            {
+              return EventType::THING_TYPE_ASSOCIATION;
+            }
+            break;
+          case JOB_HASH:
+            if (name == "JOB")
+            {
+              return EventType::JOB;
+            }
+            break;
+          case JOB_EXECUTION_HASH:
+            if (name == "JOB_EXECUTION")
+            {
+              return EventType::JOB_EXECUTION;
+            }
+            break;
+          case POLICY_HASH:
+            if (name == "POLICY")
+            {
+              return EventType::POLICY;
+            }
+            break;
+          case CERTIFICATE_HASH:
+            if (name == "CERTIFICATE")
+            {
+              return EventType::CERTIFICATE;
+            }
+            break;
+          case CA_CERTIFICATE_HASH:
+            if (name == "CA_CERTIFICATE")
+            {
+              return EventType::CA_CERTIFICATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventType(EventType enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
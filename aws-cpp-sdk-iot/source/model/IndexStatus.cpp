@@ -30,25 +30,37 @@ namespace Aws
       namespace IndexStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int BUILDING_HASH = HashingUtils::HashString("BUILDING");
-        static const int REBUILDING_HASH = HashingUtils::HashString("REBUILDING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int BUILDING_HASH = HashingUtils::CompileTimeHashString("BUILDING");
+        static constexpr int REBUILDING_HASH = HashingUtils::CompileTimeHashString("REBUILDING");
 
 
         IndexStatus GetIndexStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IndexStatus::ACTIVE;
-          }
-          else if (hashCode == BUILDING_HASH)
-          {
-            return IndexStatus::BUILDING;
-          }
-          else if (hashCode == REBUILDING_HASH)
-          {
-            return IndexStatus::REBUILDING;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return IndexStatus::ACTIVE;
+            }
+            break;
+          case BUILDING_HASH:
+            if (name == "BUILDING")
+            {
+              return IndexStatus::BUILDING;
+            }
+            break;
+          case REBUILDING_HASH:
+            if (name == "REBUILDING")
+            {
+              return IndexStatus::REBUILDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return IndexStatus::NOT_SET;
         }
 
-        Aws::String GetNameForIndexStatus(IndexStatus enumValue)
+        const char* GetNameForIndexStatus(IndexStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
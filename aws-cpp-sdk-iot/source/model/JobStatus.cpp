@@ -30,30 +30,44 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int DELETION_IN_PROGRESS_HASH = HashingUtils::HashString("DELETION_IN_PROGRESS");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int DELETION_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("DELETION_IN_PROGRESS");
 
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobStatus::IN_PROGRESS;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return JobStatus::CANCELED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return JobStatus::COMPLETED;
-          }
-          else if (hashCode == DELETION_IN_PROGRESS_HASH)
-          {
-            return JobStatus::DELETION_IN_PROGRESS;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return JobStatus::IN_PROGRESS;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return JobStatus::CANCELED;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return JobStatus::COMPLETED;
+            }
+            break;
+          case DELETION_IN_PROGRESS_HASH:
+            if (name == "DELETION_IN_PROGRESS")
+            {
+              return JobStatus::DELETION_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatus(JobStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
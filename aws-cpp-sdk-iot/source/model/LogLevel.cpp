@@ -30,35 +30,51 @@ namespace Aws
       namespace LogLevelMapper
       {
 
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int WARN_HASH = HashingUtils::HashString("WARN");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        static constexpr int DEBUG__HASH = HashingUtils::CompileTimeHashString("DEBUG");
+        static constexpr int INFO_HASH = HashingUtils::CompileTimeHashString("INFO");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int WARN_HASH = HashingUtils::CompileTimeHashString("WARN");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
 
 
         LogLevel GetLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEBUG__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LogLevel::DEBUG_;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return LogLevel::INFO;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return LogLevel::ERROR_;
-          }
-          else if (hashCode == WARN_HASH)
-          {
-            return LogLevel::WARN;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return LogLevel::DISABLED;
+          case DEBUG__HASH:
+            if (name == "DEBUG")
+            {
+              return LogLevel::DEBUG_;
+            }
+            break;
+          case INFO_HASH:
+            if (name == "INFO")
+            {
+              return LogLevel::INFO;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return LogLevel::ERROR_;
+            }
+            break;
+          case WARN_HASH:
+            if (name == "WARN")
+            {
+              return LogLevel::WARN;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return LogLevel::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return LogLevel::NOT_SET;
         }
 
-        Aws::String GetNameForLogLevel(LogLevel enumValue)
+        const char* GetNameForLogLevel(LogLevel enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace LogTargetTypeMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int THING_GROUP_HASH = HashingUtils::HashString("THING_GROUP");
+        static constexpr int DEFAULT_HASH = HashingUtils::CompileTimeHashString("DEFAULT");
+        static constexpr int THING_GROUP_HASH = HashingUtils::CompileTimeHashString("THING_GROUP");
 
 
         LogTargetType GetLogTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LogTargetType::DEFAULT;
-          }
-          else if (hashCode == THING_GROUP_HASH)
-          {
-            return LogTargetType::THING_GROUP;
+          case DEFAULT_HASH:
+            if (name == "DEFAULT")
+            {
+              return LogTargetType::DEFAULT;
+            }
+            break;
+          case THING_GROUP_HASH:
+            if (name == "THING_GROUP")
+            {
+              return LogTargetType::THING_GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LogTargetType::NOT_SET;
         }
 
-        Aws::String GetNameForLogTargetType(LogTargetType enumValue)
+        const char* GetNameForLogTargetType(LogTargetType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace MessageFormatMapper
       {
 
-        static const int RAW_HASH = HashingUtils::HashString("RAW");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
+        static constexpr int RAW_HASH = HashingUtils::CompileTimeHashString("RAW");
+        static constexpr int JSON_HASH = HashingUtils::CompileTimeHashString("JSON");
 
 
         MessageFormat GetMessageFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RAW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MessageFormat::RAW;
-          }
-          else if (hashCode == JSON_HASH)
-          {
-            return MessageFormat::JSON;
+          case RAW_HASH:
+            if (name == "RAW")
+            {
+              return MessageFormat::RAW;
+            }
+            break;
+          case JSON_HASH:
+            if (name == "JSON")
+            {
+              return MessageFormat::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MessageFormat::NOT_SET;
         }
 
-        Aws::String GetNameForMessageFormat(MessageFormat enumValue)
+        const char* GetNameForMessageFormat(MessageFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace OTAUpdateStatusMapper
       {
 
-        static const int CREATE_PENDING_HASH = HashingUtils::HashString("CREATE_PENDING");
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_COMPLETE_HASH = HashingUtils::HashString("CREATE_COMPLETE");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
+        static constexpr int CREATE_PENDING_HASH = HashingUtils::CompileTimeHashString("CREATE_PENDING");
+        static constexpr int CREATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATE_IN_PROGRESS");
+        static constexpr int CREATE_COMPLETE_HASH = HashingUtils::CompileTimeHashString("CREATE_COMPLETE");
+        static constexpr int CREATE_FAILED_HASH = HashingUtils::CompileTimeHashString("CREATE_FAILED");
 
 
         OTAUpdateStatus GetOTAUpdateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OTAUpdateStatus::CREATE_PENDING;
-          }
-          else if (hashCode == CREATE_IN_PROGRESS_HASH)
-          {
-            return OTAUpdateStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_COMPLETE_HASH)
-          {
-            return OTAUpdateStatus::CREATE_COMPLETE;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
-            return OTAUpdateStatus::CREATE_FAILED;
+          case CREATE_PENDING_HASH:
+            if (name == "CREATE_PENDING")
+            {
+              return OTAUpdateStatus::CREATE_PENDING;
+            }
+            break;
+          case CREATE_IN_PROGRESS_HASH:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return OTAUpdateStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case CREATE_COMPLETE_HASH:
+            if (name == "CREATE_COMPLETE")
+            {
+              return OTAUpdateStatus::CREATE_COMPLETE;
+            }
+            break;
+          case CREATE_FAILED_HASH:
+            if (name == "CREATE_FAILED")
+            {
+              return OTAUpdateStatus::CREATE_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return OTAUpdateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForOTAUpdateStatus(OTAUpdateStatus enumValue)
+        const char* GetNameForOTAUpdateStatus(OTAUpdateStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ReportTypeMapper
       {
 
-        static const int ERRORS_HASH = HashingUtils::HashString("ERRORS");
-        static const int RESULTS_HASH = HashingUtils::HashString("RESULTS");
+        static constexpr int ERRORS_HASH = HashingUtils::CompileTimeHashString("ERRORS");
+        static constexpr int RESULTS_HASH = HashingUtils::CompileTimeHashString("RESULTS");
 
 
         ReportType GetReportTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ERRORS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReportType::ERRORS;
-          }
-          else if (hashCode == RESULTS_HASH)
-          {
-            return ReportType::RESULTS;
+          case ERRORS_HASH:
+            if (name == "ERRORS")
+            {
+              return ReportType::ERRORS;
+            }
+            break;
+          case RESULTS_HASH:
+            if (name == "RESULTS")
+            {
+              return ReportType::RESULTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReportType::NOT_SET;
         }
 
-        Aws::String GetNameForReportType(ReportType enumValue)
+        const char* GetNameForReportType(ReportType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
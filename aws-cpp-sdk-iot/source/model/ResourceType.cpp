@@ -30,40 +30,58 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int DEVICE_CERTIFICATE_HASH = HashingUtils::HashString("DEVICE_CERTIFICATE");
-        static const int CA_CERTIFICATE_HASH = HashingUtils::HashString("CA_CERTIFICATE");
-        static const int IOT_POLICY_HASH = HashingUtils::HashString("IOT_POLICY");
-        static const int COGNITO_IDENTITY_POOL_HASH = HashingUtils::HashString("COGNITO_IDENTITY_POOL");
-        static const int CLIENT_ID_HASH = HashingUtils::HashString("CLIENT_ID");
-        static const int ACCOUNT_SETTINGS_HASH = HashingUtils::HashString("ACCOUNT_SETTINGS");
+        static constexpr int DEVICE_CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("DEVICE_CERTIFICATE");
+        static constexpr int CA_CERTIFICATE_HASH = HashingUtils::CompileTimeHashString("CA_CERTIFICATE");
+        static constexpr int IOT_POLICY_HASH = HashingUtils::CompileTimeHashString("IOT_POLICY");
+        static constexpr int COGNITO_IDENTITY_POOL_HASH = HashingUtils::CompileTimeHashString("COGNITO_IDENTITY_POOL");
+        static constexpr int CLIENT_ID_HASH = HashingUtils::CompileTimeHashString("CLIENT_ID");
+        static constexpr int ACCOUNT_SETTINGS_HASH = HashingUtils::CompileTimeHashString("ACCOUNT_SETTINGS");
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEVICE_CERTIFICATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceType::DEVICE_CERTIFICATE;
-          }
-          else if (hashCode == CA_CERTIFICATE_HASH)
-          {
-            return ResourceType::CA_CERTIFICATE;
-          }
-          else if (hashCode == IOT_POLICY_HASH)
-          {
-            return ResourceType::IOT_POLICY;
-          }
-          else if (hashCode == COGNITO_IDENTITY_POOL_HASH)
-          {
-            return ResourceType::COGNITO_IDENTITY_POOL;
-          }
-          else if (hashCode == CLIENT_ID_HASH)
-          {
-            return ResourceType::CLIENT_ID;
-          }
-          else if (hashCode == ACCOUNT_SETTINGS_HASH)
-          {
-            return ResourceType::ACCOUNT_SETTINGS;
+          case DEVICE_CERTIFICATE_HASH:
+            if (name == "DEVICE_CERTIFICATE")
+            {
+              return ResourceType::DEVICE_CERTIFICATE;
+            }
+            break;
+          case CA_CERTIFICATE_HASH:
+            if (name == "CA_CERTIFICATE")
+            {
+              return ResourceType::CA_CERTIFICATE;
+            }
+            break;
+          case IOT_POLICY_HASH:
+            if (name == "IOT_POLICY")
+            {
+              return ResourceType::IOT_POLICY;
+            }
+            break;
+          case COGNITO_IDENTITY_POOL_HASH:
+            if (name == "COGNITO_IDENTITY_POOL")
+            {
+              return ResourceType::COGNITO_IDENTITY_POOL;
+            }
+            break;
+          case CLIENT_ID_HASH:
+            if (name == "CLIENT_ID")
+            {
+              return ResourceType::CLIENT_ID;
+            }
+            break;
+          case ACCOUNT_SETTINGS_HASH:
+            if (name == "ACCOUNT_SETTINGS")
+            {
+              return ResourceType::ACCOUNT_SETTINGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceType(ResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Cancelling_HASH = HashingUtils::HashString("Cancelling");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Completed_HASH = HashingUtils::CompileTimeHashString("Completed");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
+        static constexpr int Cancelling_HASH = HashingUtils::CompileTimeHashString("Cancelling");
 
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Status::InProgress;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return Status::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return Status::Failed;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return Status::Cancelled;
-          }
-          else if (hashCode == Cancelling_HASH)
-          {
-            return Status::Cancelling;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return Status::InProgress;
+            }
+            break;
+          case Completed_HASH:
+            if (name == "Completed")
+            {
+              return Status::Completed;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return Status::Failed;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return Status::Cancelled;
+            }
+            break;
+          case Cancelling_HASH:
+            if (name == "Cancelling")
+            {
+              return Status::Cancelling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatus(Status enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace TargetSelectionMapper
       {
 
-        static const int CONTINUOUS_HASH = HashingUtils::HashString("CONTINUOUS");
-        static const int SNAPSHOT_HASH = HashingUtils::HashString("SNAPSHOT");
+        static constexpr int CONTINUOUS_HASH = HashingUtils::CompileTimeHashString("CONTINUOUS");
+        static constexpr int SNAPSHOT_HASH = HashingUtils::CompileTimeHashString("SNAPSHOT");
 
 
         TargetSelection GetTargetSelectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONTINUOUS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TargetSelection::CONTINUOUS;
-          }
-          else if (hashCode == SNAPSHOT_HASH)
-          {
-            return TargetSelection::SNAPSHOT;
+          case CONTINUOUS_HASH:
+            if (name == "CONTINUOUS")
+            {
+              return TargetSelection::CONTINUOUS;
+            }
+            break;
+          case SNAPSHOT_HASH:
+            if (name == "SNAPSHOT")
+            {
+              return TargetSelection::SNAPSHOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TargetSelection::NOT_SET;
         }
 
-        Aws::String GetNameForTargetSelection(TargetSelection enumValue)
+        const char* GetNameForTargetSelection(TargetSelection enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
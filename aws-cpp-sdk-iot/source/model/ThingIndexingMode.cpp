@@ -30,25 +30,37 @@ namespace Aws
       namespace ThingIndexingModeMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int REGISTRY_HASH = HashingUtils::HashString("REGISTRY");
-        static const int REGISTRY_AND_SHADOW_HASH = HashingUtils::HashString("REGISTRY_AND_SHADOW");
+        static constexpr int OFF_HASH = HashingUtils::CompileTimeHashString("OFF");
+        static constexpr int REGISTRY_HASH = HashingUtils::CompileTimeHashString("REGISTRY");
+        static constexpr int REGISTRY_AND_SHADOW_HASH = HashingUtils::CompileTimeHashString("REGISTRY_AND_SHADOW");
 
 
         ThingIndexingMode GetThingIndexingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ThingIndexingMode::OFF;
-          }
-          else if (hashCode == REGISTRY_HASH)
-          {
-            return ThingIndexingMode::REGISTRY;
-          }
-          else if (hashCode == REGISTRY_AND_SHADOW_HASH)
-          {
-            return ThingIndexingMode::REGISTRY_AND_SHADOW;
+          case OFF_HASH:
+            if (name == "OFF")
+            {
+              return ThingIndexingMode::OFF;
+            }
+            break;
+          case REGISTRY_HASH:
+            if (name == "REGISTRY")
+            {
+              return ThingIndexingMode::REGISTRY;
+            }
+            break;
+          case REGISTRY_AND_SHADOW_HASH:
+            if (name == "REGISTRY_AND_SHADOW")
+            {
+              return ThingIndexingMode::REGISTRY_AND_SHADOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ThingIndexingMode::NOT_SET;
         }
 
-        Aws::String GetNameForThingIndexingMode(ThingIndexingMode enumValue)
+        const char* GetNameForThingIndexingMode(ThingIndexingMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ViolationEventTypeMapper
       {
 
-        static const int in_alarm_HASH = HashingUtils::HashString("in-alarm");
-        static const int alarm_cleared_HASH = HashingUtils::HashString("alarm-cleared");
-        static const int alarm_invalidated_HASH = HashingUtils::HashString("alarm-invalidated");
+        static constexpr int in_alarm_HASH = HashingUtils::CompileTimeHashString("in-alarm");
+        static constexpr int alarm_cleared_HASH = HashingUtils::CompileTimeHashString("alarm-cleared");
+        static constexpr int alarm_invalidated_HASH = HashingUtils::CompileTimeHashString("alarm-invalidated");
 
 
         ViolationEventType GetViolationEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == in_alarm_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ViolationEventType::in_alarm;
-          }
-          else if (hashCode == alarm_cleared_HASH)
-          {
-            return ViolationEventType::alarm_cleared;
-          }
-          else if (hashCode == alarm_invalidated_HASH)
-          {
-            return ViolationEventType::alarm_invalidated;
+          case in_alarm_HASH:
+            if (name == "in-alarm")
+            {
+              return ViolationEventType::in_alarm;
+            }
+            break;
+          case alarm_cleared_HASH:
+            if (name == "alarm-cleared")
+            {
+              return ViolationEventType::alarm_cleared;
+            }
+            break;
+          case alarm_invalidated_HASH:
+            if (name == "alarm-invalidated")
+            {
+              return ViolationEventType::alarm_invalidated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ViolationEventType::NOT_SET;
         }
 
-        Aws::String GetNameForViolationEventType(ViolationEventType enumValue)
+        const char* GetNameForViolationEventType(ViolationEventType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -28,11 +28,11 @@ namespace IoT1ClickDevicesService
 namespace IoT1ClickDevicesServiceErrorMapper
 {
 
-static const int FORBIDDEN_HASH = HashingUtils::HashString("ForbiddenException");
-static const int RESOURCE_CONFLICT_HASH = HashingUtils::HashString("ResourceConflictException");
-static const int PRECONDITION_FAILED_HASH = HashingUtils::HashString("PreconditionFailedException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int RANGE_NOT_SATISFIABLE_HASH = HashingUtils::HashString("RangeNotSatisfiableException");
+static constexpr int FORBIDDEN_HASH = HashingUtils::CompileTimeHashString("ForbiddenException");
+static constexpr int RESOURCE_CONFLICT_HASH = HashingUtils::CompileTimeHashString("ResourceConflictException");
+static constexpr int PRECONDITION_FAILED_HASH = HashingUtils::CompileTimeHashString("PreconditionFailedException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int RANGE_NOT_SATISFIABLE_HASH = HashingUtils::CompileTimeHashString("RangeNotSatisfiableException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -35,7 +35,8 @@ namespace ChannelStatusMapper
 {
 AWS_IOTANALYTICS_API ChannelStatus GetChannelStatusForName(const Aws::String& name);
 
-AWS_IOTANALYTICS_API Aws::String GetNameForChannelStatus(ChannelStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOTANALYTICS_API const char* GetNameForChannelStatus(ChannelStatus value);
 } // namespace ChannelStatusMapper
 } // namespace Model
 } // namespace IoTAnalytics
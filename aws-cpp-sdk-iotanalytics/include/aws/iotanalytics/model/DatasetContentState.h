@@ -35,7 +35,8 @@ namespace DatasetContentStateMapper
 {
 AWS_IOTANALYTICS_API DatasetContentState GetDatasetContentStateForName(const Aws::String& name);
 
-AWS_IOTANALYTICS_API Aws::String GetNameForDatasetContentState(DatasetContentState value);
+// names of values not modeled point into the enum overflow container
+AWS_IOTANALYTICS_API const char* GetNameForDatasetContentState(DatasetContentState value);
 } // namespace DatasetContentStateMapper
 } // namespace Model
 } // namespace IoTAnalytics
@@ -35,7 +35,8 @@ namespace DatasetStatusMapper
 {
 AWS_IOTANALYTICS_API DatasetStatus GetDatasetStatusForName(const Aws::String& name);
 
-AWS_IOTANALYTICS_API Aws::String GetNameForDatasetStatus(DatasetStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOTANALYTICS_API const char* GetNameForDatasetStatus(DatasetStatus value);
 } // namespace DatasetStatusMapper
 } // namespace Model
 } // namespace IoTAnalytics
@@ -35,7 +35,8 @@ namespace DatastoreStatusMapper
 {
 AWS_IOTANALYTICS_API DatastoreStatus GetDatastoreStatusForName(const Aws::String& name);
 
-AWS_IOTANALYTICS_API Aws::String GetNameForDatastoreStatus(DatastoreStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOTANALYTICS_API const char* GetNameForDatastoreStatus(DatastoreStatus value);
 } // namespace DatastoreStatusMapper
 } // namespace Model
 } // namespace IoTAnalytics
@@ -33,7 +33,8 @@ namespace LoggingLevelMapper
 {
 AWS_IOTANALYTICS_API LoggingLevel GetLoggingLevelForName(const Aws::String& name);
 
-AWS_IOTANALYTICS_API Aws::String GetNameForLoggingLevel(LoggingLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_IOTANALYTICS_API const char* GetNameForLoggingLevel(LoggingLevel value);
 } // namespace LoggingLevelMapper
 } // namespace Model
 } // namespace IoTAnalytics
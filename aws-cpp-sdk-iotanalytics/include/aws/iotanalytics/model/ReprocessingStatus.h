@@ -36,7 +36,8 @@ namespace ReprocessingStatusMapper
 {
 AWS_IOTANALYTICS_API ReprocessingStatus GetReprocessingStatusForName(const Aws::String& name);
 
-AWS_IOTANALYTICS_API Aws::String GetNameForReprocessingStatus(ReprocessingStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_IOTANALYTICS_API const char* GetNameForReprocessingStatus(ReprocessingStatus value);
 } // namespace ReprocessingStatusMapper
 } // namespace Model
 } // namespace IoTAnalytics
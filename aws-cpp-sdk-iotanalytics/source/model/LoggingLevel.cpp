@@ -30,15 +30,23 @@ namespace Aws
       namespace LoggingLevelMapper
       {
 
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
 
 
         LoggingLevel GetLoggingLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ERROR__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoggingLevel::ERROR_;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return LoggingLevel::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return LoggingLevel::NOT_SET;
         }
 
-        Aws::String GetNameForLoggingLevel(LoggingLevel enumValue)
+        const char* GetNameForLoggingLevel(LoggingLevel enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
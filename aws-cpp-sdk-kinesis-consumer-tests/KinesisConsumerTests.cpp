@@ -0,0 +1,522 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/kinesis-consumer/KinesisConsumer.h>
+#include <aws/kinesis/model/GetRecordsRequest.h>
+#include <aws/kinesis/model/GetRecordsResult.h>
+#include <aws/kinesis/model/GetShardIteratorRequest.h>
+#include <aws/kinesis/model/GetShardIteratorResult.h>
+#include <aws/kinesis/model/ListShardsRequest.h>
+#include <aws/kinesis/model/ListShardsResult.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <cstring>
+#include <thread>
+
+using namespace Aws::KinesisConsumer;
+using namespace Aws::Kinesis;
+using namespace Aws::Kinesis::Model;
+using namespace Aws::Utils;
+
+static const char* ALLOC_TAG = "KinesisConsumerTests";
+static const char* STREAM_NAME = "KinesisConsumerTestStream";
+static const std::chrono::seconds WAIT_TIMEOUT(10);
+
+/**
+ * Kinesis client serving a stream from memory. Shard iterators are "shardId/position", sequence numbers count the records
+ * of a shard from 1, and closed shards stop returning a next iterator once they have been read to their end.
+ */
+class MockKinesisClient : public KinesisClient
+{
+public:
+    MockKinesisClient() : KinesisClient(Aws::Auth::AWSCredentials("", "")) {}
+
+    void AddShard(const Aws::String& shardId, size_t records, bool closed, const Aws::String& parentShardId = "", const Aws::String& adjacentParentShardId = "")
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        Shard shard;
+        shard.SetShardId(shardId);
+        shard.SetParentShardId(parentShardId);
+        shard.SetAdjacentParentShardId(adjacentParentShardId);
+        shard.SetSequenceNumberRange(SequenceNumberRange().WithStartingSequenceNumber("1").WithEndingSequenceNumber(closed ? StringUtils::to_string(records) : ""));
+        m_shards.push_back(shard);
+
+        for (size_t i = 1; i <= records; ++i)
+        {
+            Aws::String data = shardId + " record " + StringUtils::to_string(i);
+            AppendRecord(shardId, Record().WithPartitionKey("key").WithData(ByteBuffer(reinterpret_cast<const unsigned char*>(data.c_str()), data.size())));
+        }
+        m_closed[shardId] = closed;
+    }
+
+    void AddRecord(const Aws::String& shardId, Record record)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        AppendRecord(shardId, record);
+    }
+
+    // closes a shard, as a split or merge does, once it has been read to its end the consumer lists the stream again
+    void CloseShard(const Aws::String& shardId)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_closed[shardId] = true;
+    }
+
+    ListShardsOutcome ListShards(const ListShardsRequest&) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return ListShardsResult().WithShards(m_shards);
+    }
+
+    GetShardIteratorOutcome GetShardIterator(const GetShardIteratorRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_iteratorRequests.push_back(request);
+        size_t position = 0;
+        if (request.GetShardIteratorType() == ShardIteratorType::AFTER_SEQUENCE_NUMBER)
+        {
+            position = static_cast<size_t>(StringUtils::ConvertToInt64(request.GetStartingSequenceNumber().c_str()));
+        }
+        else if (request.GetShardIteratorType() == ShardIteratorType::LATEST)
+        {
+            position = m_records[request.GetShardId()].size();
+        }
+        return GetShardIteratorResult().WithShardIterator(request.GetShardId() + "/" + StringUtils::to_string(position));
+    }
+
+    GetRecordsOutcome GetRecords(const GetRecordsRequest& request) const override
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        ++m_getRecordsCalls;
+        m_signal.notify_all();
+        if (m_expireCall == m_getRecordsCalls)
+        {
+            return Aws::Client::AWSError<KinesisErrors>(KinesisErrors::EXPIRED_ITERATOR, false);
+        }
+
+        auto separator = request.GetShardIterator().find('/');
+        Aws::String shardId = request.GetShardIterator().substr(0, separator);
+        auto position = static_cast<size_t>(StringUtils::ConvertToInt64(request.GetShardIterator().substr(separator + 1).c_str()));
+        const auto& records = m_records[shardId];
+
+        GetRecordsResult result;
+        size_t end = (std::min)(records.size(), position + static_cast<size_t>(request.GetLimit()));
+        for (size_t i = position; i < end; ++i)
+        {
+            result.AddRecords(records[i]);
+        }
+        result.SetMillisBehindLatest(static_cast<long long>(records.size() - end));
+        if (end < records.size() || !m_closed[shardId])
+        {
+            result.SetNextShardIterator(shardId + "/" + StringUtils::to_string(end));
+        }
+        return result;
+    }
+
+    bool WaitForGetRecordsCalls(size_t calls) const
+    {
+        std::unique_lock<std::mutex> locker(m_lock);
+        return m_signal.wait_for(locker, WAIT_TIMEOUT, [&]() { return m_getRecordsCalls >= calls; });
+    }
+
+    Aws::Vector<GetShardIteratorRequest> GetIteratorRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_iteratorRequests;
+    }
+
+    size_t m_expireCall = 0;
+
+private:
+    void AppendRecord(const Aws::String& shardId, Record record)
+    {
+        auto& records = m_records[shardId];
+        record.SetSequenceNumber(StringUtils::to_string(records.size() + 1));
+        records.push_back(record);
+    }
+
+    Aws::Vector<Shard> m_shards;
+    mutable Aws::Map<Aws::String, Aws::Vector<Record>> m_records;
+    mutable Aws::Map<Aws::String, bool> m_closed;
+
+    mutable std::mutex m_lock;
+    mutable std::condition_variable m_signal;
+    mutable size_t m_getRecordsCalls = 0;
+    mutable Aws::Vector<GetShardIteratorRequest> m_iteratorRequests;
+};
+
+class KinesisConsumerTest : public ::testing::Test
+{
+protected:
+    KinesisConsumerTest() : m_configuration(&m_executor) {}
+
+    void SetUp() override
+    {
+        m_client = Aws::MakeShared<MockKinesisClient>(ALLOC_TAG);
+        m_checkpointFile = Aws::FileSystem::CreateTempFilePath();
+        m_configuration.kinesisClient = m_client;
+        m_configuration.streamName = STREAM_NAME;
+        m_configuration.checkpointStore = Aws::MakeShared<FileCheckpointStore>(ALLOC_TAG, m_checkpointFile);
+        m_configuration.maxRecordsPerFetch = 10;
+        m_configuration.minTimeBetweenFetches = std::chrono::milliseconds(0);
+        m_configuration.idleTimeBetweenFetches = std::chrono::milliseconds(10);
+        m_configuration.recordsReceivedCallback = [this](const KinesisConsumer*, const Aws::String& shardId, const Aws::Vector<UserRecord>& records, long long)
+        {
+            std::lock_guard<std::mutex> locker(m_recordsLock);
+            for (const auto& record : records)
+            {
+                m_records.emplace_back(shardId, record);
+            }
+            m_recordsSignal.notify_all();
+        };
+    }
+
+    void TearDown() override
+    {
+        m_configuration.checkpointStore = nullptr;
+        m_configuration.kinesisClient = nullptr;
+        m_configuration.recordsReceivedCallback = nullptr;
+        m_client = nullptr;
+        m_records.clear();
+        Aws::FileSystem::RemoveFileIfExists(m_checkpointFile.c_str());
+    }
+
+    bool WaitForRecords(size_t count)
+    {
+        std::unique_lock<std::mutex> locker(m_recordsLock);
+        return m_recordsSignal.wait_for(locker, WAIT_TIMEOUT, [&]() { return m_records.size() >= count; });
+    }
+
+    Aws::Vector<UserRecord> GetRecords(const Aws::String& shardId)
+    {
+        std::lock_guard<std::mutex> locker(m_recordsLock);
+        Aws::Vector<UserRecord> records;
+        for (const auto& record : m_records)
+        {
+            if (record.first == shardId)
+            {
+                records.push_back(record.second);
+            }
+        }
+        return records;
+    }
+
+    Aws::Utils::Threading::DefaultExecutor m_executor;
+    std::shared_ptr<MockKinesisClient> m_client;
+    Aws::String m_checkpointFile;
+    KinesisConsumerConfiguration m_configuration;
+
+    std::mutex m_recordsLock;
+    std::condition_variable m_recordsSignal;
+    Aws::Vector<std::pair<Aws::String, UserRecord>> m_records;
+};
+
+TEST_F(KinesisConsumerTest, TestReadsEveryShardAndCheckpoints)
+{
+    m_client->AddShard("shardId-000000000000", 25, false);
+    m_client->AddShard("shardId-000000000001", 25, false);
+    {
+        KinesisConsumer consumer(m_configuration);
+        ASSERT_TRUE(consumer.Start());
+        ASSERT_TRUE(WaitForRecords(50));
+        ASSERT_EQ(2u, consumer.GetActiveShards().size());
+    }
+
+    for (const char* shardId : { "shardId-000000000000", "shardId-000000000001" })
+    {
+        auto records = GetRecords(shardId);
+        ASSERT_EQ(25u, records.size());
+        for (size_t i = 0; i < records.size(); ++i)
+        {
+            ASSERT_EQ(StringUtils::to_string(i + 1), records[i].sequenceNumber);
+            ASSERT_FALSE(records[i].aggregated);
+        }
+    }
+
+    FileCheckpointStore checkpoints(m_checkpointFile);
+    ASSERT_EQ("25", checkpoints.GetCheckpoint("shardId-000000000000"));
+    ASSERT_EQ("25", checkpoints.GetCheckpoint("shardId-000000000001"));
+}
+
+TEST_F(KinesisConsumerTest, TestResumesFromCheckpoint)
+{
+    m_client->AddShard("shardId-000000000000", 25, false);
+    m_configuration.checkpointStore->SetCheckpoint("shardId-000000000000", "20");
+    {
+        KinesisConsumer consumer(m_configuration);
+        ASSERT_TRUE(consumer.Start());
+        ASSERT_TRUE(WaitForRecords(5));
+    }
+
+    auto records = GetRecords("shardId-000000000000");
+    ASSERT_EQ(5u, records.size());
+    ASSERT_EQ("21", records.front().sequenceNumber);
+
+    auto iteratorRequests = m_client->GetIteratorRequests();
+    ASSERT_EQ(1u, iteratorRequests.size());
+    ASSERT_EQ(ShardIteratorType::AFTER_SEQUENCE_NUMBER, iteratorRequests[0].GetShardIteratorType());
+    ASSERT_EQ("20", iteratorRequests[0].GetStartingSequenceNumber());
+}
+
+TEST_F(KinesisConsumerTest, TestReadsChildShardsOnceParentsAreFinished)
+{
+    // shard 0 was split into 1 and 2, which were merged into 3
+    m_client->AddShard("shardId-000000000000", 15, true);
+    m_client->AddShard("shardId-000000000001", 5, true, "shardId-000000000000");
+    m_client->AddShard("shardId-000000000002", 5, true, "shardId-000000000000");
+    m_client->AddShard("shardId-000000000003", 5, false, "shardId-000000000001", "shardId-000000000002");
+    {
+        KinesisConsumer consumer(m_configuration);
+        ASSERT_TRUE(consumer.Start());
+        ASSERT_TRUE(WaitForRecords(30));
+
+        Aws::Vector<Aws::String> active;
+        for (auto start = std::chrono::steady_clock::now(); std::chrono::steady_clock::now() - start < WAIT_TIMEOUT; )
+        {
+            active = consumer.GetActiveShards();
+            if (active.size() == 1)
+            {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_EQ(1u, active.size());
+        ASSERT_EQ("shardId-000000000003", active[0]);
+    }
+
+    std::lock_guard<std::mutex> locker(m_recordsLock);
+    ASSERT_EQ(30u, m_records.size());
+    for (size_t i = 0; i < m_records.size(); ++i)
+    {
+        if (i < 15)
+        {
+            ASSERT_EQ("shardId-000000000000", m_records[i].first);
+        }
+        else if (i < 25)
+        {
+            ASSERT_NE("shardId-000000000000", m_records[i].first);
+            ASSERT_NE("shardId-000000000003", m_records[i].first);
+        }
+        else
+        {
+            ASSERT_EQ("shardId-000000000003", m_records[i].first);
+        }
+    }
+
+    FileCheckpointStore checkpoints(m_checkpointFile);
+    ASSERT_EQ(SHARD_END_CHECKPOINT, checkpoints.GetCheckpoint("shardId-000000000000"));
+    ASSERT_EQ(SHARD_END_CHECKPOINT, checkpoints.GetCheckpoint("shardId-000000000002"));
+    ASSERT_EQ("5", checkpoints.GetCheckpoint("shardId-000000000003"));
+}
+
+TEST_F(KinesisConsumerTest, TestReadsChildrenOfShardSplitWhileReadingFromTrimHorizon)
+{
+    m_configuration.initialPosition = ShardIteratorType::LATEST;
+    m_client->AddShard("shardId-000000000000", 0, false);
+    {
+        KinesisConsumer consumer(m_configuration);
+        ASSERT_TRUE(consumer.Start());
+        ASSERT_TRUE(m_client->WaitForGetRecordsCalls(1));
+
+        // records arrive, then the shard is split, and its children are written to before the consumer gets to them
+        for (size_t i = 1; i <= 5; ++i)
+        {
+            Aws::String data = "shardId-000000000000 record " + StringUtils::to_string(i);
+            m_client->AddRecord("shardId-000000000000", Record().WithPartitionKey("key").WithData(ByteBuffer(reinterpret_cast<const unsigned char*>(data.c_str()), data.size())));
+        }
+        m_client->AddShard("shardId-000000000001", 5, false, "shardId-000000000000");
+        m_client->AddShard("shardId-000000000002", 5, false, "shardId-000000000000");
+        m_client->CloseShard("shardId-000000000000");
+        ASSERT_TRUE(WaitForRecords(15));
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_recordsLock);
+        ASSERT_EQ(15u, m_records.size());
+        for (size_t i = 0; i < 5; ++i)
+        {
+            ASSERT_EQ("shardId-000000000000", m_records[i].first);
+        }
+    }
+    for (const char* shardId : { "shardId-000000000001", "shardId-000000000002" })
+    {
+        auto records = GetRecords(shardId);
+        ASSERT_EQ(5u, records.size());
+        ASSERT_EQ("1", records.front().sequenceNumber);
+    }
+
+    for (const auto& request : m_client->GetIteratorRequests())
+    {
+        auto expected = request.GetShardId() == "shardId-000000000000" ? ShardIteratorType::LATEST : ShardIteratorType::TRIM_HORIZON;
+        ASSERT_EQ(expected, request.GetShardIteratorType());
+    }
+}
+
+TEST_F(KinesisConsumerTest, TestRenewsExpiredIterator)
+{
+    m_client->AddShard("shardId-000000000000", 25, false);
+    m_client->m_expireCall = 2;
+    {
+        KinesisConsumer consumer(m_configuration);
+        ASSERT_TRUE(consumer.Start());
+        ASSERT_TRUE(WaitForRecords(25));
+    }
+
+    auto records = GetRecords("shardId-000000000000");
+    ASSERT_EQ(25u, records.size());
+    ASSERT_EQ("25", records.back().sequenceNumber);
+
+    auto iteratorRequests = m_client->GetIteratorRequests();
+    ASSERT_EQ(2u, iteratorRequests.size());
+    ASSERT_EQ(ShardIteratorType::TRIM_HORIZON, iteratorRequests[0].GetShardIteratorType());
+    ASSERT_EQ(ShardIteratorType::AFTER_SEQUENCE_NUMBER, iteratorRequests[1].GetShardIteratorType());
+    ASSERT_EQ("10", iteratorRequests[1].GetStartingSequenceNumber());
+}
+
+TEST_F(KinesisConsumerTest, TestFetchesNextBatchWhileProcessing)
+{
+    m_client->AddShard("shardId-000000000000", 25, false);
+    bool fetchedDuringCallback = false;
+    auto recordsReceived = m_configuration.recordsReceivedCallback;
+    m_configuration.recordsReceivedCallback = [&](const KinesisConsumer* consumer, const Aws::String& shardId, const Aws::Vector<UserRecord>& records, long long millisBehindLatest)
+    {
+        if (records.front().sequenceNumber == "1")
+        {
+            fetchedDuringCallback = m_client->WaitForGetRecordsCalls(2);
+        }
+        recordsReceived(consumer, shardId, records, millisBehindLatest);
+    };
+    {
+        KinesisConsumer consumer(m_configuration);
+        ASSERT_TRUE(consumer.Start());
+        ASSERT_TRUE(WaitForRecords(25));
+    }
+    ASSERT_TRUE(fetchedDuringCallback);
+}
+
+static void AppendVarint(Aws::String& buffer, size_t value)
+{
+    for (; value >= 0x80; value >>= 7)
+    {
+        buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+    }
+    buffer.push_back(static_cast<char>(value));
+}
+
+static void AppendLengthDelimited(Aws::String& buffer, char tag, const Aws::String& value)
+{
+    buffer.push_back(tag);
+    AppendVarint(buffer, value.size());
+    buffer.append(value);
+}
+
+TEST_F(KinesisConsumerTest, TestDeaggregatesRecords)
+{
+    Aws::String protobuf;
+    AppendLengthDelimited(protobuf, 0x0A, "first");
+    AppendLengthDelimited(protobuf, 0x0A, "second");
+    AppendLengthDelimited(protobuf, 0x12, "12345");
+    for (size_t i = 0; i < 3; ++i)
+    {
+        Aws::String record;
+        record.push_back(0x08);
+        AppendVarint(record, i % 2);
+        if (i == 2)
+        {
+            record.push_back(0x10);
+            AppendVarint(record, 0);
+        }
+        AppendLengthDelimited(record, 0x1A, "data " + StringUtils::to_string(i));
+        AppendLengthDelimited(protobuf, 0x1A, record);
+    }
+
+    static const unsigned char magic[] = { 0xF3, 0x89, 0x9A, 0xC2 };
+    auto checksum = HashingUtils::CalculateMD5(protobuf);
+    ByteBuffer data(sizeof(magic) + protobuf.size() + checksum.GetLength());
+    std::memcpy(data.GetUnderlyingData(), magic, sizeof(magic));
+    std::memcpy(data.GetUnderlyingData() + sizeof(magic), protobuf.c_str(), protobuf.size());
+    std::memcpy(data.GetUnderlyingData() + sizeof(magic) + protobuf.size(), checksum.GetUnderlyingData(), checksum.GetLength());
+
+    m_client->AddShard("shardId-000000000000", 1, false);
+    m_client->AddRecord("shardId-000000000000", Record().WithPartitionKey("first").WithData(data));
+    {
+        KinesisConsumer consumer(m_configuration);
+        ASSERT_TRUE(consumer.Start());
+        ASSERT_TRUE(WaitForRecords(4));
+    }
+
+    auto records = GetRecords("shardId-000000000000");
+    ASSERT_EQ(4u, records.size());
+    ASSERT_FALSE(records[0].aggregated);
+    ASSERT_EQ("1", records[0].sequenceNumber);
+    for (size_t i = 1; i < 4; ++i)
+    {
+        ASSERT_TRUE(records[i].aggregated);
+        ASSERT_EQ("2", records[i].sequenceNumber);
+        ASSERT_EQ(i - 1, records[i].subSequenceNumber);
+        ASSERT_EQ(i == 2 ? "second" : "first", records[i].partitionKey);
+        ASSERT_EQ("data " + StringUtils::to_string(i - 1), Aws::String(reinterpret_cast<const char*>(records[i].data.GetUnderlyingData()), records[i].data.GetLength()));
+    }
+    ASSERT_EQ("12345", records[3].explicitHashKey);
+}
+
+TEST_F(KinesisConsumerTest, TestReadsChildrenOfShardSplitBeforeStartingFromLatest)
+{
+    // shard 0 was split before the consumer started, nothing was read from it, so its children are joined at LATEST too
+    m_configuration.initialPosition = ShardIteratorType::LATEST;
+    m_client->AddShard("shardId-000000000000", 5, true);
+    m_client->AddShard("shardId-000000000001", 5, false, "shardId-000000000000");
+    m_client->AddShard("shardId-000000000002", 5, false, "shardId-000000000000");
+    {
+        KinesisConsumer consumer(m_configuration);
+        ASSERT_TRUE(consumer.Start());
+
+        Aws::Vector<Aws::String> active;
+        for (auto start = std::chrono::steady_clock::now(); std::chrono::steady_clock::now() - start < WAIT_TIMEOUT; )
+        {
+            active = consumer.GetActiveShards();
+            if (active.size() == 2)
+            {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_EQ(2u, active.size());
+
+        Aws::String data = "shardId-000000000001 record 6";
+        m_client->AddRecord("shardId-000000000001", Record().WithPartitionKey("key").WithData(ByteBuffer(reinterpret_cast<const unsigned char*>(data.c_str()), data.size())));
+        ASSERT_TRUE(WaitForRecords(1));
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_recordsLock);
+        ASSERT_EQ(1u, m_records.size());
+        ASSERT_EQ("shardId-000000000001", m_records[0].first);
+        ASSERT_EQ("6", m_records[0].second.sequenceNumber);
+    }
+
+    auto iteratorRequests = m_client->GetIteratorRequests();
+    ASSERT_EQ(3u, iteratorRequests.size());
+    for (const auto& request : iteratorRequests)
+    {
+        ASSERT_EQ(ShardIteratorType::LATEST, request.GetShardIteratorType());
+    }
+}
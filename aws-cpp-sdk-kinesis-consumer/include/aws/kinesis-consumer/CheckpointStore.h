@@ -0,0 +1,75 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/kinesis-consumer/KinesisConsumer_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <mutex>
+
+namespace Aws
+{
+    namespace KinesisConsumer
+    {
+        /**
+         * Checkpoint of a shard that has been read to its end, after a split or merge.
+         */
+        static const char SHARD_END_CHECKPOINT[] = "SHARD_END";
+
+        /**
+         * Where KinesisConsumer keeps the sequence number of the last record processed in each shard, so that it picks up
+         * from there when it is restarted. Implementations must be thread safe, shards are checkpointed concurrently.
+         */
+        class AWS_KINESIS_CONSUMER_API CheckpointStore
+        {
+        public:
+            virtual ~CheckpointStore() = default;
+
+            /**
+             * Returns the checkpoint of the shard, empty if it has none.
+             */
+            virtual Aws::String GetCheckpoint(const Aws::String& shardId) = 0;
+
+            /**
+             * Returns false if the checkpoint could not be stored.
+             */
+            virtual bool SetCheckpoint(const Aws::String& shardId, const Aws::String& checkpoint) = 0;
+        };
+
+        /**
+         * Keeps the checkpoints of a consumer in a local file, one line per shard. The file is read on construction
+         * and rewritten on every checkpoint, by writing it aside and renaming it so that a crash never leaves a partial file.
+         */
+        class AWS_KINESIS_CONSUMER_API FileCheckpointStore : public CheckpointStore
+        {
+        public:
+            FileCheckpointStore(const Aws::String& fileName);
+
+            Aws::String GetCheckpoint(const Aws::String& shardId) override;
+            bool SetCheckpoint(const Aws::String& shardId, const Aws::String& checkpoint) override;
+
+            inline const Aws::String& GetFileName() const { return m_fileName; }
+
+        private:
+            bool WriteFile() const;
+
+            Aws::String m_fileName;
+            std::mutex m_checkpointLock;
+            Aws::Map<Aws::String, Aws::String> m_checkpoints;
+        };
+    }
+}
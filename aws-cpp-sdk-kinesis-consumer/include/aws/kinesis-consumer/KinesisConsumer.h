@@ -0,0 +1,180 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/kinesis-consumer/KinesisConsumer_EXPORTS.h>
+#include <aws/kinesis-consumer/CheckpointStore.h>
+#include <aws/kinesis/KinesisClient.h>
+#include <aws/kinesis/model/ShardIteratorType.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace KinesisConsumer
+    {
+        class KinesisConsumer;
+        struct ShardState;
+
+        /**
+         * A record read from the stream. Records aggregated by the Kinesis Producer Library are handed out one by one,
+         * sharing the sequence number of the Kinesis record they were sent in.
+         */
+        struct UserRecord
+        {
+            UserRecord() : subSequenceNumber(0), aggregated(false) {}
+
+            Aws::String partitionKey;
+            Aws::String explicitHashKey;
+            Aws::Utils::ByteBuffer data;
+            Aws::String sequenceNumber;
+            size_t subSequenceNumber;
+            bool aggregated;
+            Aws::Utils::DateTime approximateArrivalTimestamp;
+        };
+
+        /**
+         * Called with each batch of records read from a shard, in order. The next batch of the shard is being fetched meanwhile,
+         * but is not handed out before this call returns. Batches of different shards are processed concurrently.
+         * millisBehindLatest is how far the batch is from the tip of the stream.
+         */
+        typedef std::function<void(const KinesisConsumer*, const Aws::String& shardId, const Aws::Vector<UserRecord>& records,
+                                   long long millisBehindLatest)> RecordsReceivedCallback;
+
+        struct AWS_KINESIS_CONSUMER_API KinesisConsumerConfiguration
+        {
+            KinesisConsumerConfiguration(Aws::Utils::Threading::Executor* executor);
+
+            std::shared_ptr<Aws::Kinesis::KinesisClient> kinesisClient;
+            Aws::String streamName;
+
+            /**
+             * Runs the read loop of every shard being read. A read loop holds its thread for as long as its shard is read, so a pooled
+             * executor needs a thread for each open shard; the loops of further shards wait for a thread to free up and their shards
+             * are not read meanwhile. GetRecords runs on the executor of the client, so that the next batch is fetched while the callback
+             * processes the last one. The two must be separate executors: a read loop waits for the GetRecords it queued on the client's
+             * executor, which never runs if the read loops hold all of its threads.
+             */
+            Aws::Utils::Threading::Executor* executor;
+
+            /**
+             * Where progress is kept. Without a store every start reads shards from initialPosition.
+             */
+            std::shared_ptr<CheckpointStore> checkpointStore;
+
+            /**
+             * Where shards without a checkpoint are read from, TRIM_HORIZON (the default) or LATEST. Children of a shard that was split or merged
+             * are read from TRIM_HORIZON once their parents have been read, so that no record written to them in between is skipped, unless
+             * the consumer joined their parents at LATEST after they were closed, in which case the children are read from LATEST as well.
+             */
+            Aws::Kinesis::Model::ShardIteratorType initialPosition;
+
+            /**
+             * At most 10000 records are returned per GetRecords. Defaults to 10000.
+             */
+            int maxRecordsPerFetch;
+
+            /**
+             * Each shard allows 5 GetRecords a second, so fetches are spaced by at least minTimeBetweenFetches, 200 milliseconds
+             * by default, and by idleTimeBetweenFetches, 1 second by default, once a fetch comes back empty.
+             */
+            std::chrono::milliseconds minTimeBetweenFetches;
+            std::chrono::milliseconds idleTimeBetweenFetches;
+
+            /**
+             * Failed calls are retried after a backoff doubling from retryBaseDelay up to maxRetryDelay, for as long as the consumer runs.
+             * Defaults to 100 milliseconds up to 5 seconds.
+             */
+            std::chrono::milliseconds retryBaseDelay;
+            std::chrono::milliseconds maxRetryDelay;
+
+            /**
+             * Unpacks records aggregated by the Kinesis Producer Library. On by default.
+             */
+            bool deaggregationEnabled;
+
+            RecordsReceivedCallback recordsReceivedCallback;
+        };
+
+        /**
+         * Reads every shard of a Kinesis stream, the way the Kinesis Client Library does for a single worker.
+         *
+         * Each open shard gets a read loop on the executor that keeps the next GetRecords in flight while the callback processes
+         * the current batch, renews the shard iterator when it expires, and checkpoints the last record of each batch once the
+         * callback returns, so records are processed at least once. When a shard is closed by a split or merge and read to its end,
+         * the stream is listed again and its children are read, each only once all of its parents have been read to their end,
+         * which keeps the records of a partition key in order.
+         */
+        class AWS_KINESIS_CONSUMER_API KinesisConsumer
+        {
+        public:
+            KinesisConsumer(const KinesisConsumerConfiguration& configuration);
+
+            /**
+             * Stops the consumer.
+             */
+            ~KinesisConsumer();
+
+            KinesisConsumer(const KinesisConsumer&) = delete;
+            KinesisConsumer& operator=(const KinesisConsumer&) = delete;
+
+            /**
+             * Lists the shards of the stream and starts reading them. Returns false if the shards could not be listed.
+             */
+            bool Start();
+
+            /**
+             * Stops reading and waits for the callbacks in progress to return. Batches already fetched but not handed out are dropped,
+             * they are read again from the checkpoint on the next start. Must not be called from the callback.
+             */
+            void Stop();
+
+            /**
+             * Shards currently being read.
+             */
+            Aws::Vector<Aws::String> GetActiveShards() const;
+
+            inline const KinesisConsumerConfiguration& GetConfiguration() const { return m_configuration; }
+
+        private:
+            bool SyncShards();
+            void ReadShard(const std::shared_ptr<ShardState>& shard);
+            Aws::String GetShardIterator(const std::shared_ptr<ShardState>& shard);
+            void ProcessRecords(const std::shared_ptr<ShardState>& shard, const Aws::Vector<Aws::Kinesis::Model::Record>& records, long long millisBehindLatest);
+            void FinishShard(const std::shared_ptr<ShardState>& shard);
+            bool IsRunning() const;
+            bool WaitUnlessStopped(std::chrono::steady_clock::time_point until);
+
+            KinesisConsumerConfiguration m_configuration;
+
+            mutable std::mutex m_lock;
+            std::condition_variable m_signal;
+            bool m_running;
+            size_t m_shardsReading;
+            Aws::Map<Aws::String, std::shared_ptr<ShardState>> m_shards;
+        };
+    }
+}
@@ -0,0 +1,84 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/kinesis-consumer/CheckpointStore.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/UUID.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <fstream>
+
+namespace Aws
+{
+    namespace KinesisConsumer
+    {
+        static const char* CLASS_TAG = "FileCheckpointStore";
+
+        FileCheckpointStore::FileCheckpointStore(const Aws::String& fileName) : m_fileName(fileName)
+        {
+            Aws::IFStream file(m_fileName.c_str(), std::ios_base::in);
+            Aws::String shardId, checkpoint;
+            while (file >> shardId >> checkpoint)
+            {
+                m_checkpoints[shardId] = checkpoint;
+            }
+            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Loaded " << m_checkpoints.size() << " checkpoints from " << m_fileName);
+        }
+
+        Aws::String FileCheckpointStore::GetCheckpoint(const Aws::String& shardId)
+        {
+            std::lock_guard<std::mutex> locker(m_checkpointLock);
+            auto iter = m_checkpoints.find(shardId);
+            return iter == m_checkpoints.end() ? "" : iter->second;
+        }
+
+        bool FileCheckpointStore::SetCheckpoint(const Aws::String& shardId, const Aws::String& checkpoint)
+        {
+            std::lock_guard<std::mutex> locker(m_checkpointLock);
+            m_checkpoints[shardId] = checkpoint;
+            return WriteFile();
+        }
+
+        bool FileCheckpointStore::WriteFile() const
+        {
+            Aws::String tempFileName = m_fileName + "." + Aws::String(Aws::Utils::UUID::RandomUUID()) + ".tmp";
+            bool written(false);
+            {
+                Aws::OFStream file(tempFileName.c_str(), std::ios_base::out | std::ios_base::trunc);
+                for (const auto& checkpoint : m_checkpoints)
+                {
+                    file << checkpoint.first << " " << checkpoint.second << "\n";
+                }
+                file.close();
+                written = !file.fail();
+            }
+
+            if (!written)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to write checkpoints to " << tempFileName);
+                Aws::FileSystem::RemoveFileIfExists(tempFileName.c_str());
+                return false;
+            }
+            if (!Aws::FileSystem::RelocateFileOrDirectory(tempFileName.c_str(), m_fileName.c_str()))
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to move checkpoints to " << m_fileName);
+                Aws::FileSystem::RemoveFileIfExists(tempFileName.c_str());
+                return false;
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,607 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/kinesis-consumer/KinesisConsumer.h>
+#include <aws/kinesis/model/GetRecordsRequest.h>
+#include <aws/kinesis/model/GetRecordsResult.h>
+#include <aws/kinesis/model/GetShardIteratorRequest.h>
+#include <aws/kinesis/model/GetShardIteratorResult.h>
+#include <aws/kinesis/model/ListShardsRequest.h>
+#include <aws/kinesis/model/ListShardsResult.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace Aws::Kinesis;
+using namespace Aws::Kinesis::Model;
+
+namespace Aws
+{
+    namespace KinesisConsumer
+    {
+        static const char* CLASS_TAG = "KinesisConsumer";
+
+        static const int MAX_RECORDS_PER_FETCH = 10000;
+
+        // framing of aggregated records, as written by the Kinesis Producer Library
+        static const unsigned char AGGREGATED_RECORD_MAGIC[] = { 0xF3, 0x89, 0x9A, 0xC2 };
+        static const size_t AGGREGATED_RECORD_MAGIC_SIZE = sizeof(AGGREGATED_RECORD_MAGIC);
+        static const size_t AGGREGATED_RECORD_CHECKSUM_SIZE = 16;
+        // protobuf fields of AggregatedRecord and Record
+        static const uint64_t PARTITION_KEY_TABLE_FIELD = 1;
+        static const uint64_t EXPLICIT_HASH_KEY_TABLE_FIELD = 2;
+        static const uint64_t RECORDS_FIELD = 3;
+        static const uint64_t PARTITION_KEY_INDEX_FIELD = 1;
+        static const uint64_t EXPLICIT_HASH_KEY_INDEX_FIELD = 2;
+        static const uint64_t DATA_FIELD = 3;
+        static const uint64_t VARINT_WIRE_TYPE = 0;
+        static const uint64_t LENGTH_DELIMITED_WIRE_TYPE = 2;
+
+        enum class ShardStatus
+        {
+            WAITING,
+            READING,
+            FINISHED
+        };
+
+        struct ShardState
+        {
+            ShardState(const Shard& shard) :
+                shardId(shard.GetShardId()), parentShardId(shard.GetParentShardId()), adjacentParentShardId(shard.GetAdjacentParentShardId()),
+                status(ShardStatus::WAITING), readFromTrimHorizon(false), readWithoutGap(false)
+            {
+            }
+
+            Aws::String shardId;
+            Aws::String parentShardId;
+            Aws::String adjacentParentShardId;
+            ShardStatus status;
+            // set for children whose parents were read without a gap, their records follow on from their parents'
+            bool readFromTrimHorizon;
+            // set once the shard is read from a checkpoint or TRIM_HORIZON, or from LATEST while it is still open, rather than
+            // joined at LATEST after it was closed; only touched by the shard's read loop until it is FINISHED
+            bool readWithoutGap;
+            // last record handed out, where an expired iterator is renewed from; only touched by the shard's read loop
+            Aws::String lastSequenceNumber;
+        };
+
+        /**
+         * Reads the fields of a protobuf message, as far as aggregated records need.
+         */
+        class ProtobufReader
+        {
+        public:
+            ProtobufReader(const unsigned char* data, size_t length) : m_position(data), m_end(data + length) {}
+
+            inline bool AtEnd() const { return m_position == m_end; }
+
+            /**
+             * Reads the next field. Varints are returned in value, length delimited fields in data and length, with data set.
+             */
+            bool ReadField(uint64_t& field, uint64_t& value, const unsigned char*& data, size_t& length)
+            {
+                uint64_t tag;
+                if (!ReadVarint(tag) || !ReadVarint(value))
+                {
+                    return false;
+                }
+
+                field = tag >> 3;
+                data = nullptr;
+                length = 0;
+                uint64_t wireType = tag & 0x07;
+                if (wireType == VARINT_WIRE_TYPE)
+                {
+                    return true;
+                }
+                if (wireType != LENGTH_DELIMITED_WIRE_TYPE || value > static_cast<uint64_t>(m_end - m_position))
+                {
+                    return false;
+                }
+
+                data = m_position;
+                length = static_cast<size_t>(value);
+                m_position += length;
+                return true;
+            }
+
+        private:
+            bool ReadVarint(uint64_t& value)
+            {
+                value = 0;
+                for (unsigned shift = 0; shift < 64 && m_position < m_end; shift += 7)
+                {
+                    unsigned char byte = *m_position++;
+                    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                    if (!(byte & 0x80))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            const unsigned char* m_position;
+            const unsigned char* m_end;
+        };
+
+        /**
+         * Appends the user records of a Kinesis record aggregated by the Kinesis Producer Library.
+         * Returns false, appending nothing, if the record isn't one.
+         */
+        static bool Deaggregate(const Record& record, Aws::Vector<UserRecord>& userRecords)
+        {
+            const auto& data = record.GetData();
+            if (data.GetLength() <= AGGREGATED_RECORD_MAGIC_SIZE + AGGREGATED_RECORD_CHECKSUM_SIZE ||
+                std::memcmp(data.GetUnderlyingData(), AGGREGATED_RECORD_MAGIC, AGGREGATED_RECORD_MAGIC_SIZE) != 0)
+            {
+                return false;
+            }
+
+            const unsigned char* protobuf = data.GetUnderlyingData() + AGGREGATED_RECORD_MAGIC_SIZE;
+            size_t protobufLength = data.GetLength() - AGGREGATED_RECORD_MAGIC_SIZE - AGGREGATED_RECORD_CHECKSUM_SIZE;
+            auto checksum = Aws::Utils::HashingUtils::CalculateMD5(Aws::String(reinterpret_cast<const char*>(protobuf), protobufLength));
+            if (std::memcmp(checksum.GetUnderlyingData(), protobuf + protobufLength, AGGREGATED_RECORD_CHECKSUM_SIZE) != 0)
+            {
+                return false;
+            }
+
+            // the key tables may come after the records that index them
+            Aws::Vector<Aws::String> partitionKeys;
+            Aws::Vector<Aws::String> explicitHashKeys;
+            Aws::Vector<std::pair<uint64_t, uint64_t>> keyIndexes;
+            Aws::Vector<UserRecord> aggregated;
+            ProtobufReader reader(protobuf, protobufLength);
+            while (!reader.AtEnd())
+            {
+                uint64_t field, value;
+                const unsigned char* fieldData;
+                size_t fieldLength;
+                if (!reader.ReadField(field, value, fieldData, fieldLength))
+                {
+                    return false;
+                }
+                if (!fieldData)
+                {
+                    continue;
+                }
+
+                if (field == PARTITION_KEY_TABLE_FIELD)
+                {
+                    partitionKeys.emplace_back(reinterpret_cast<const char*>(fieldData), fieldLength);
+                }
+                else if (field == EXPLICIT_HASH_KEY_TABLE_FIELD)
+                {
+                    explicitHashKeys.emplace_back(reinterpret_cast<const char*>(fieldData), fieldLength);
+                }
+                else if (field == RECORDS_FIELD)
+                {
+                    UserRecord userRecord;
+                    std::pair<uint64_t, uint64_t> indexes((std::numeric_limits<uint64_t>::max)(), (std::numeric_limits<uint64_t>::max)());
+                    ProtobufReader recordReader(fieldData, fieldLength);
+                    while (!recordReader.AtEnd())
+                    {
+                        const unsigned char* recordData;
+                        size_t recordLength;
+                        if (!recordReader.ReadField(field, value, recordData, recordLength))
+                        {
+                            return false;
+                        }
+
+                        if (field == PARTITION_KEY_INDEX_FIELD && !recordData)
+                        {
+                            indexes.first = value;
+                        }
+                        else if (field == EXPLICIT_HASH_KEY_INDEX_FIELD && !recordData)
+                        {
+                            indexes.second = value;
+                        }
+                        else if (field == DATA_FIELD && recordData)
+                        {
+                            userRecord.data = Aws::Utils::ByteBuffer(recordData, recordLength);
+                        }
+                    }
+                    aggregated.push_back(userRecord);
+                    keyIndexes.push_back(indexes);
+                }
+            }
+
+            for (size_t i = 0; i < aggregated.size(); ++i)
+            {
+                if (keyIndexes[i].first >= partitionKeys.size())
+                {
+                    return false;
+                }
+                aggregated[i].partitionKey = partitionKeys[static_cast<size_t>(keyIndexes[i].first)];
+                if (keyIndexes[i].second < explicitHashKeys.size())
+                {
+                    aggregated[i].explicitHashKey = explicitHashKeys[static_cast<size_t>(keyIndexes[i].second)];
+                }
+                aggregated[i].sequenceNumber = record.GetSequenceNumber();
+                aggregated[i].subSequenceNumber = i;
+                aggregated[i].aggregated = true;
+                aggregated[i].approximateArrivalTimestamp = record.GetApproximateArrivalTimestamp();
+            }
+
+            userRecords.insert(userRecords.end(), aggregated.begin(), aggregated.end());
+            return true;
+        }
+
+        KinesisConsumerConfiguration::KinesisConsumerConfiguration(Aws::Utils::Threading::Executor* executor) :
+            executor(executor),
+            initialPosition(ShardIteratorType::TRIM_HORIZON),
+            maxRecordsPerFetch(MAX_RECORDS_PER_FETCH),
+            minTimeBetweenFetches(200),
+            idleTimeBetweenFetches(1000),
+            retryBaseDelay(100),
+            maxRetryDelay(5000),
+            deaggregationEnabled(true)
+        {
+        }
+
+        KinesisConsumer::KinesisConsumer(const KinesisConsumerConfiguration& configuration) :
+            m_configuration(configuration), m_running(false), m_shardsReading(0)
+        {
+            m_configuration.maxRecordsPerFetch = (std::max)((std::min)(m_configuration.maxRecordsPerFetch, MAX_RECORDS_PER_FETCH), 1);
+        }
+
+        KinesisConsumer::~KinesisConsumer()
+        {
+            Stop();
+        }
+
+        bool KinesisConsumer::Start()
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (m_running)
+                {
+                    return true;
+                }
+                m_running = true;
+            }
+
+            if (!SyncShards())
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                m_running = false;
+                return false;
+            }
+            return true;
+        }
+
+        void KinesisConsumer::Stop()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_running = false;
+            m_signal.notify_all();
+            m_signal.wait(locker, [this]() { return m_shardsReading == 0; });
+        }
+
+        Aws::Vector<Aws::String> KinesisConsumer::GetActiveShards() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            Aws::Vector<Aws::String> shardIds;
+            for (const auto& shard : m_shards)
+            {
+                if (shard.second->status == ShardStatus::READING)
+                {
+                    shardIds.push_back(shard.first);
+                }
+            }
+            return shardIds;
+        }
+
+        static std::chrono::milliseconds GetRetryDelay(const KinesisConsumerConfiguration& configuration, unsigned failures)
+        {
+            std::chrono::milliseconds delay(configuration.retryBaseDelay.count() << (std::min)(failures - 1, 20u));
+            return (std::min)(delay, configuration.maxRetryDelay);
+        }
+
+        bool KinesisConsumer::IsRunning() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_running;
+        }
+
+        bool KinesisConsumer::WaitUnlessStopped(std::chrono::steady_clock::time_point until)
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait_until(locker, until, [this]() { return !m_running; });
+            return m_running;
+        }
+
+        bool KinesisConsumer::SyncShards()
+        {
+            Aws::Vector<std::shared_ptr<ShardState>> listed;
+            ListShardsRequest listShardsRequest;
+            listShardsRequest.SetStreamName(m_configuration.streamName);
+            while (true)
+            {
+                auto listShardsOutcome = m_configuration.kinesisClient->ListShards(listShardsRequest);
+                if (!listShardsOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to list the shards of stream " << m_configuration.streamName << ". " << listShardsOutcome.GetError());
+                    return false;
+                }
+
+                for (const auto& shard : listShardsOutcome.GetResult().GetShards())
+                {
+                    auto state = Aws::MakeShared<ShardState>(CLASS_TAG, shard);
+                    if (m_configuration.checkpointStore && m_configuration.checkpointStore->GetCheckpoint(state->shardId) == SHARD_END_CHECKPOINT)
+                    {
+                        state->status = ShardStatus::FINISHED;
+                        state->readWithoutGap = true;
+                    }
+                    listed.push_back(state);
+                }
+
+                if (listShardsOutcome.GetResult().GetNextToken().empty())
+                {
+                    break;
+                }
+                listShardsRequest = ListShardsRequest();
+                listShardsRequest.SetNextToken(listShardsOutcome.GetResult().GetNextToken());
+            }
+
+            Aws::Vector<std::shared_ptr<ShardState>> ready;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (!m_running)
+                {
+                    return true;
+                }
+
+                for (const auto& shard : listed)
+                {
+                    m_shards.emplace(shard->shardId, shard);
+                }
+
+                // parents that are no longer listed have aged out of the stream
+                auto parentFinished = [this](const Aws::String& shardId)
+                {
+                    auto parent = m_shards.find(shardId);
+                    return shardId.empty() || parent == m_shards.end() || parent->second->status == ShardStatus::FINISHED;
+                };
+                // children of a shard joined at LATEST after it was closed start at initialPosition too, there is nothing to follow on from
+                auto parentReadWithoutGap = [this](const Aws::String& shardId)
+                {
+                    auto parent = shardId.empty() ? m_shards.end() : m_shards.find(shardId);
+                    return parent != m_shards.end() && parent->second->readWithoutGap;
+                };
+                for (const auto& shard : m_shards)
+                {
+                    if (shard.second->status == ShardStatus::WAITING && parentFinished(shard.second->parentShardId) && parentFinished(shard.second->adjacentParentShardId))
+                    {
+                        shard.second->readFromTrimHorizon = parentReadWithoutGap(shard.second->parentShardId) || parentReadWithoutGap(shard.second->adjacentParentShardId);
+                        shard.second->status = ShardStatus::READING;
+                        ++m_shardsReading;
+                        ready.push_back(shard.second);
+                    }
+                }
+            }
+
+            for (const auto& shard : ready)
+            {
+                AWS_LOGSTREAM_INFO(CLASS_TAG, "Reading shard " << shard->shardId << " of stream " << m_configuration.streamName);
+                if (!m_configuration.executor->Submit([this, shard]() { ReadShard(shard); }))
+                {
+                    AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to schedule the read loop of shard " << shard->shardId);
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    shard->status = ShardStatus::WAITING;
+                    --m_shardsReading;
+                    m_signal.notify_all();
+                }
+            }
+            return true;
+        }
+
+        Aws::String KinesisConsumer::GetShardIterator(const std::shared_ptr<ShardState>& shard)
+        {
+            GetShardIteratorRequest getShardIteratorRequest;
+            getShardIteratorRequest.SetStreamName(m_configuration.streamName);
+            getShardIteratorRequest.SetShardId(shard->shardId);
+
+            Aws::String checkpoint = shard->lastSequenceNumber;
+            if (checkpoint.empty() && m_configuration.checkpointStore)
+            {
+                checkpoint = m_configuration.checkpointStore->GetCheckpoint(shard->shardId);
+            }
+            if (checkpoint.empty())
+            {
+                getShardIteratorRequest.SetShardIteratorType(shard->readFromTrimHorizon ? ShardIteratorType::TRIM_HORIZON : m_configuration.initialPosition);
+                shard->readWithoutGap = shard->readWithoutGap || getShardIteratorRequest.GetShardIteratorType() == ShardIteratorType::TRIM_HORIZON;
+            }
+            else
+            {
+                shard->readWithoutGap = true;
+                getShardIteratorRequest.SetShardIteratorType(ShardIteratorType::AFTER_SEQUENCE_NUMBER);
+                getShardIteratorRequest.SetStartingSequenceNumber(checkpoint);
+            }
+
+            for (unsigned failures = 1; ; ++failures)
+            {
+                auto getShardIteratorOutcome = m_configuration.kinesisClient->GetShardIterator(getShardIteratorRequest);
+                if (getShardIteratorOutcome.IsSuccess())
+                {
+                    return getShardIteratorOutcome.GetResult().GetShardIterator();
+                }
+
+                AWS_LOGSTREAM_WARN(CLASS_TAG, "Unable to get an iterator for shard " << shard->shardId << ". " << getShardIteratorOutcome.GetError());
+                if (!WaitUnlessStopped(std::chrono::steady_clock::now() + GetRetryDelay(m_configuration, failures)))
+                {
+                    return "";
+                }
+            }
+        }
+
+        void KinesisConsumer::ReadShard(const std::shared_ptr<ShardState>& shard)
+        {
+            auto fetch = [this](const Aws::String& iterator)
+            {
+                GetRecordsRequest getRecordsRequest;
+                getRecordsRequest.SetShardIterator(iterator);
+                getRecordsRequest.SetLimit(m_configuration.maxRecordsPerFetch);
+                return m_configuration.kinesisClient->GetRecordsCallable(getRecordsRequest);
+            };
+
+            Aws::String iterator = GetShardIterator(shard);
+            GetRecordsOutcomeCallable nextBatch;
+            auto lastFetch = std::chrono::steady_clock::now();
+            if (!iterator.empty())
+            {
+                nextBatch = fetch(iterator);
+            }
+
+            unsigned failures = 0;
+            while (nextBatch.valid())
+            {
+                auto getRecordsOutcome = nextBatch.get();
+                if (!IsRunning())
+                {
+                    break;
+                }
+
+                if (!getRecordsOutcome.IsSuccess())
+                {
+                    const auto& error = getRecordsOutcome.GetError();
+                    if (error.GetErrorType() == KinesisErrors::EXPIRED_ITERATOR)
+                    {
+                        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Iterator of shard " << shard->shardId << " expired, renewing it.");
+                        iterator = GetShardIterator(shard);
+                    }
+                    else
+                    {
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, "Unable to get records from shard " << shard->shardId << ". " << error);
+                        if (!WaitUnlessStopped(std::chrono::steady_clock::now() + GetRetryDelay(m_configuration, ++failures)))
+                        {
+                            break;
+                        }
+                    }
+
+                    if (!iterator.empty())
+                    {
+                        nextBatch = fetch(iterator);
+                        lastFetch = std::chrono::steady_clock::now();
+                    }
+                    continue;
+                }
+
+                failures = 0;
+                const auto& result = getRecordsOutcome.GetResult();
+                iterator = result.GetNextShardIterator();
+                // a shard that is still open is followed from wherever it was joined, up to its end once it is closed
+                shard->readWithoutGap = shard->readWithoutGap || !iterator.empty();
+                auto nextFetch = lastFetch + (result.GetRecords().empty() ? m_configuration.idleTimeBetweenFetches : m_configuration.minTimeBetweenFetches);
+
+                // the next batch is fetched while this one is processed, unless the shard's read limit holds it back
+                if (!iterator.empty() && std::chrono::steady_clock::now() >= nextFetch)
+                {
+                    nextBatch = fetch(iterator);
+                    lastFetch = std::chrono::steady_clock::now();
+                }
+
+                ProcessRecords(shard, result.GetRecords(), result.GetMillisBehindLatest());
+
+                if (iterator.empty())
+                {
+                    FinishShard(shard);
+                    break;
+                }
+
+                if (!nextBatch.valid())
+                {
+                    if (!WaitUnlessStopped(nextFetch))
+                    {
+                        break;
+                    }
+                    nextBatch = fetch(iterator);
+                    lastFetch = std::chrono::steady_clock::now();
+                }
+            }
+
+            std::lock_guard<std::mutex> locker(m_lock);
+            if (shard->status == ShardStatus::READING)
+            {
+                shard->status = ShardStatus::WAITING;
+            }
+            --m_shardsReading;
+            m_signal.notify_all();
+        }
+
+        void KinesisConsumer::ProcessRecords(const std::shared_ptr<ShardState>& shard, const Aws::Vector<Record>& records, long long millisBehindLatest)
+        {
+            if (records.empty())
+            {
+                return;
+            }
+
+            Aws::Vector<UserRecord> userRecords;
+            userRecords.reserve(records.size());
+            for (const auto& record : records)
+            {
+                if (m_configuration.deaggregationEnabled && Deaggregate(record, userRecords))
+                {
+                    continue;
+                }
+
+                UserRecord userRecord;
+                userRecord.partitionKey = record.GetPartitionKey();
+                userRecord.data = record.GetData();
+                userRecord.sequenceNumber = record.GetSequenceNumber();
+                userRecord.approximateArrivalTimestamp = record.GetApproximateArrivalTimestamp();
+                userRecords.push_back(userRecord);
+            }
+
+            if (m_configuration.recordsReceivedCallback)
+            {
+                m_configuration.recordsReceivedCallback(this, shard->shardId, userRecords, millisBehindLatest);
+            }
+
+            shard->lastSequenceNumber = records.back().GetSequenceNumber();
+            if (m_configuration.checkpointStore && !m_configuration.checkpointStore->SetCheckpoint(shard->shardId, shard->lastSequenceNumber))
+            {
+                AWS_LOGSTREAM_WARN(CLASS_TAG, "Unable to checkpoint shard " << shard->shardId << " at " << shard->lastSequenceNumber);
+            }
+        }
+
+        void KinesisConsumer::FinishShard(const std::shared_ptr<ShardState>& shard)
+        {
+            AWS_LOGSTREAM_INFO(CLASS_TAG, "Shard " << shard->shardId << " of stream " << m_configuration.streamName << " has been read to its end.");
+            if (m_configuration.checkpointStore && !m_configuration.checkpointStore->SetCheckpoint(shard->shardId, SHARD_END_CHECKPOINT))
+            {
+                AWS_LOGSTREAM_WARN(CLASS_TAG, "Unable to checkpoint the end of shard " << shard->shardId);
+            }
+
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                shard->status = ShardStatus::FINISHED;
+            }
+
+            // the shards that replace it are listed once it is closed
+            for (unsigned failures = 1; !SyncShards(); ++failures)
+            {
+                if (!WaitUnlessStopped(std::chrono::steady_clock::now() + GetRetryDelay(m_configuration, failures)))
+                {
+                    break;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,524 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/kinesis-producer/KinesisProducer.h>
+#include <aws/kinesis/model/ListShardsRequest.h>
+#include <aws/kinesis/model/ListShardsResult.h>
+#include <aws/kinesis/model/PutRecordsRequest.h>
+#include <aws/kinesis/model/PutRecordsResult.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/testing/BatchingClientTest.h>
+
+#include <cstring>
+#include <thread>
+
+using namespace Aws::KinesisProducer;
+using namespace Aws::Kinesis;
+using namespace Aws::Kinesis::Model;
+using namespace Aws::Utils;
+
+static const char* STREAM_NAME = "KinesisProducerTestStream";
+// the two shards of the mocked stream split the hash key space at 2^127, the second is split again at 3 * 2^126 by a reshard
+static const char* SPLIT_HASH_KEY = "170141183460469231731687303715884105728";
+static const char* LAST_HASH_KEY_OF_FIRST_SHARD = "170141183460469231731687303715884105727";
+static const char* RESHARD_SPLIT_HASH_KEY = "255211775190703847597530955573826158592";
+static const char* LAST_HASH_KEY_OF_RESHARD_SPLIT = "255211775190703847597530955573826158591";
+static const char* LAST_HASH_KEY = "340282366920938463463374607431768211455";
+
+/**
+ * Kinesis client answering PutRecords synchronously, putting records on the shard their hash key falls in
+ * and failing the records of the first requests it is told to. Reshard() splits the second shard in two.
+ */
+class MockKinesisClient : public Aws::Testing::MockServiceClient<KinesisClient>
+{
+public:
+    MockKinesisClient() : m_listShardsCalls(0), m_failedRequests(0), m_requestsToFail(0), m_failAllRecords(false), m_resharded(false) {}
+
+    ListShardsOutcome ListShards(const ListShardsRequest&) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        ++m_listShardsCalls;
+        if (!m_shardsKnown)
+        {
+            return Aws::Client::AWSError<KinesisErrors>(KinesisErrors::ACCESS_DENIED, false);
+        }
+
+        ListShardsResult result;
+        Shard first;
+        first.SetShardId("shardId-000000000000");
+        first.SetHashKeyRange(HashKeyRange().WithStartingHashKey("0").WithEndingHashKey(LAST_HASH_KEY_OF_FIRST_SHARD));
+        first.SetSequenceNumberRange(SequenceNumberRange().WithStartingSequenceNumber("1"));
+        Shard second;
+        second.SetShardId("shardId-000000000001");
+        second.SetHashKeyRange(HashKeyRange().WithStartingHashKey(SPLIT_HASH_KEY).WithEndingHashKey(LAST_HASH_KEY));
+        second.SetSequenceNumberRange(SequenceNumberRange().WithStartingSequenceNumber("1"));
+        if (m_resharded)
+        {
+            // the parent stays listed, closed, next to its children
+            second.SetSequenceNumberRange(SequenceNumberRange().WithStartingSequenceNumber("1").WithEndingSequenceNumber("100"));
+            Shard third;
+            third.SetShardId("shardId-000000000002");
+            third.SetParentShardId("shardId-000000000001");
+            third.SetHashKeyRange(HashKeyRange().WithStartingHashKey(SPLIT_HASH_KEY).WithEndingHashKey(LAST_HASH_KEY_OF_RESHARD_SPLIT));
+            third.SetSequenceNumberRange(SequenceNumberRange().WithStartingSequenceNumber("101"));
+            Shard fourth;
+            fourth.SetShardId("shardId-000000000003");
+            fourth.SetParentShardId("shardId-000000000001");
+            fourth.SetHashKeyRange(HashKeyRange().WithStartingHashKey(RESHARD_SPLIT_HASH_KEY).WithEndingHashKey(LAST_HASH_KEY));
+            fourth.SetSequenceNumberRange(SequenceNumberRange().WithStartingSequenceNumber("101"));
+            result.AddShards(fourth);
+            result.AddShards(third);
+        }
+        result.AddShards(second);
+        result.AddShards(first);
+        return result;
+    }
+
+    void Reshard()
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_resharded = true;
+    }
+
+    void PutRecordsAsync(const PutRecordsRequest& request, const PutRecordsResponseReceivedHandler& handler,
+                         const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+    {
+        PutRecordsResult result;
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            m_requests.push_back(request);
+            bool failRequest = m_failAllRecords || m_failedRequests < m_requestsToFail;
+            m_failedRequests += failRequest ? 1 : 0;
+
+            int failed = 0;
+            for (size_t i = 0; i < request.GetRecords().size(); ++i)
+            {
+                const auto& entry = request.GetRecords()[i];
+                if (failRequest && (m_failAllRecords || i % 2 == 1))
+                {
+                    result.AddRecords(PutRecordsResultEntry().WithErrorCode("ProvisionedThroughputExceededException").WithErrorMessage("Rate exceeded for shard"));
+                    ++failed;
+                    continue;
+                }
+                result.AddRecords(PutRecordsResultEntry().WithShardId(GetShardId(entry)).WithSequenceNumber(StringUtils::to_string(++m_sequenceNumber)));
+            }
+            result.SetFailedRecordCount(failed);
+        }
+        handler(this, request, PutRecordsOutcome(result), context);
+    }
+
+    Aws::String GetShardId(const PutRecordsRequestEntry& entry) const
+    {
+        // the quarter of the hash key space the record falls in
+        unsigned quarter = 0;
+        if (entry.GetExplicitHashKey().empty())
+        {
+            quarter = HashingUtils::CalculateMD5(entry.GetPartitionKey())[0] >> 6;
+        }
+        else if (!IsBelow(entry.GetExplicitHashKey(), SPLIT_HASH_KEY))
+        {
+            quarter = IsBelow(entry.GetExplicitHashKey(), RESHARD_SPLIT_HASH_KEY) ? 2 : 3;
+        }
+
+        if (quarter < 2)
+        {
+            return "shardId-000000000000";
+        }
+        if (!m_resharded)
+        {
+            return "shardId-000000000001";
+        }
+        return quarter == 2 ? "shardId-000000000002" : "shardId-000000000003";
+    }
+
+    Aws::Vector<PutRecordsRequest> GetRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_requests;
+    }
+
+    bool m_shardsKnown = false;
+    mutable size_t m_listShardsCalls;
+    mutable size_t m_failedRequests;
+    size_t m_requestsToFail;
+    bool m_failAllRecords;
+
+private:
+    static bool IsBelow(const Aws::String& hashKey, const Aws::String& otherHashKey)
+    {
+        return hashKey.size() < otherHashKey.size() || (hashKey.size() == otherHashKey.size() && hashKey < otherHashKey);
+    }
+
+    bool m_resharded;
+    mutable Aws::Vector<PutRecordsRequest> m_requests;
+    mutable unsigned m_sequenceNumber = 0;
+};
+
+class KinesisProducerTest : public Aws::Testing::BatchingClientTest<MockKinesisClient, UserRecordResult>
+{
+protected:
+    void SetUp() override
+    {
+        BatchingClientTest::SetUp();
+        m_configuration.kinesisClient = m_client;
+        m_configuration.streamName = STREAM_NAME;
+        m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+        m_configuration.retryBaseDelay = std::chrono::milliseconds(1);
+        m_configuration.userRecordCompletedCallback = [this](const KinesisProducer*, const UserRecordResult& result) { AddResult(result); };
+    }
+
+    void TearDown() override
+    {
+        m_configuration = KinesisProducerConfiguration();
+        BatchingClientTest::TearDown();
+    }
+
+    KinesisProducerConfiguration m_configuration;
+};
+
+static uint64_t ReadVarint(const unsigned char*& position)
+{
+    uint64_t value = 0;
+    for (unsigned shift = 0; ; shift += 7)
+    {
+        unsigned char byte = *position++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            return value;
+        }
+    }
+}
+
+// partition keys and data of the user records in an aggregated Kinesis record, empty if it isn't one
+static Aws::Vector<std::pair<Aws::String, Aws::String>> Deaggregate(const ByteBuffer& data)
+{
+    static const unsigned char magic[] = { 0xF3, 0x89, 0x9A, 0xC2 };
+    Aws::Vector<std::pair<Aws::String, Aws::String>> records;
+    if (data.GetLength() <= sizeof(magic) + 16 || std::memcmp(data.GetUnderlyingData(), magic, sizeof(magic)) != 0)
+    {
+        return records;
+    }
+
+    Aws::String protobuf(reinterpret_cast<const char*>(data.GetUnderlyingData()) + sizeof(magic), data.GetLength() - sizeof(magic) - 16);
+    auto checksum = HashingUtils::CalculateMD5(protobuf);
+    EXPECT_EQ(0, std::memcmp(checksum.GetUnderlyingData(), data.GetUnderlyingData() + data.GetLength() - 16, 16));
+
+    Aws::Vector<Aws::String> partitionKeys;
+    auto position = reinterpret_cast<const unsigned char*>(protobuf.c_str());
+    auto end = position + protobuf.size();
+    while (position < end)
+    {
+        unsigned char tag = *position++;
+        auto length = static_cast<size_t>(ReadVarint(position));
+        Aws::String field(reinterpret_cast<const char*>(position), length);
+        position += length;
+        if (tag == 0x0A)
+        {
+            partitionKeys.push_back(field);
+        }
+        else if (tag == 0x1A)
+        {
+            auto recordPosition = reinterpret_cast<const unsigned char*>(field.c_str());
+            auto recordEnd = recordPosition + field.size();
+            std::pair<Aws::String, Aws::String> record;
+            while (recordPosition < recordEnd)
+            {
+                unsigned char recordTag = *recordPosition++;
+                if (recordTag == 0x08)
+                {
+                    record.first = partitionKeys[static_cast<size_t>(ReadVarint(recordPosition))];
+                }
+                else if (recordTag == 0x10)
+                {
+                    ReadVarint(recordPosition);
+                }
+                else
+                {
+                    EXPECT_EQ(0x1A, recordTag);
+                    auto dataLength = static_cast<size_t>(ReadVarint(recordPosition));
+                    record.second.assign(reinterpret_cast<const char*>(recordPosition), dataLength);
+                    recordPosition += dataLength;
+                }
+            }
+            records.push_back(record);
+        }
+    }
+    return records;
+}
+
+TEST_F(KinesisProducerTest, TestBatchesRecordsIntoFullRequests)
+{
+    {
+        KinesisProducer producer(m_configuration);
+        for (size_t i = 0; i < 1200; ++i)
+        {
+            ASSERT_TRUE(producer.Put(MakeKey(i), MakeData(i)));
+        }
+        producer.FlushAndWait();
+
+        auto metrics = producer.GetMetrics();
+        ASSERT_EQ(1200u, metrics.entriesPut);
+        ASSERT_EQ(1200u, metrics.entriesSucceeded);
+        ASSERT_EQ(3u, metrics.requestsSent);
+        ASSERT_EQ(0u, metrics.entriesBuffered);
+        ASSERT_EQ(0u, metrics.bytesBuffered);
+    }
+
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(3u, requests.size());
+    ASSERT_EQ(500u, requests[0].GetRecords().size());
+    ASSERT_EQ(500u, requests[1].GetRecords().size());
+    ASSERT_EQ(200u, requests[2].GetRecords().size());
+    ASSERT_EQ(STREAM_NAME, requests[0].GetStreamName());
+
+    ASSERT_EQ(1200u, m_results.size());
+    for (const auto& result : m_results)
+    {
+        ASSERT_TRUE(result.successful);
+        ASSERT_FALSE(result.aggregated);
+        ASSERT_EQ(1u, result.attempts);
+        ASSERT_FALSE(result.sequenceNumber.empty());
+    }
+}
+
+TEST_F(KinesisProducerTest, TestDestructorSendsBufferedRecords)
+{
+    {
+        KinesisProducer producer(m_configuration);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            ASSERT_TRUE(producer.Put(MakeKey(i), MakeData(i)));
+        }
+    }
+
+    ASSERT_EQ(1u, m_client->GetRequests().size());
+    ASSERT_EQ(10u, m_results.size());
+}
+
+TEST_F(KinesisProducerTest, TestRetriesOnlyFailedRecords)
+{
+    m_client->m_requestsToFail = 1;
+    {
+        KinesisProducer producer(m_configuration);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            ASSERT_TRUE(producer.Put(MakeKey(i), MakeData(i)));
+        }
+        producer.FlushAndWait();
+        ASSERT_EQ(5u, producer.GetMetrics().entriesRetried);
+    }
+
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(2u, requests.size());
+    ASSERT_EQ(10u, requests[0].GetRecords().size());
+    ASSERT_EQ(5u, requests[1].GetRecords().size());
+    for (size_t i = 0; i < 5; ++i)
+    {
+        ASSERT_EQ(requests[0].GetRecords()[i * 2 + 1].GetPartitionKey(), requests[1].GetRecords()[i].GetPartitionKey());
+    }
+
+    ASSERT_EQ(10u, m_results.size());
+    size_t retried = 0;
+    for (const auto& result : m_results)
+    {
+        ASSERT_TRUE(result.successful);
+        retried += result.attempts == 2 ? 1 : 0;
+    }
+    ASSERT_EQ(5u, retried);
+}
+
+TEST_F(KinesisProducerTest, TestFailsRecordsAfterMaxRetries)
+{
+    m_client->m_failAllRecords = true;
+    m_configuration.maxRetries = 2;
+    {
+        KinesisProducer producer(m_configuration);
+        ASSERT_TRUE(producer.Put("key", MakeData(0)));
+        producer.FlushAndWait();
+        ASSERT_EQ(1u, producer.GetMetrics().entriesFailed);
+    }
+
+    ASSERT_EQ(3u, m_client->GetRequests().size());
+    ASSERT_EQ(1u, m_results.size());
+    ASSERT_FALSE(m_results[0].successful);
+    ASSERT_EQ(3u, m_results[0].attempts);
+    ASSERT_EQ("ProvisionedThroughputExceededException", m_results[0].errorCode);
+}
+
+TEST_F(KinesisProducerTest, TestAggregatesRecordsOfTheSameShard)
+{
+    m_client->m_shardsKnown = true;
+    m_configuration.aggregationEnabled = true;
+    {
+        KinesisProducer producer(m_configuration);
+        for (size_t i = 0; i < 100; ++i)
+        {
+            ASSERT_TRUE(producer.Put(MakeKey(i % 20), MakeData(i)));
+        }
+        ASSERT_TRUE(producer.Put("explicit", MakeData(100), SPLIT_HASH_KEY));
+        producer.FlushAndWait();
+    }
+
+    // one aggregated record per shard, and no shard map refresh since every record went where it was predicted
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(1u, requests.size());
+    ASSERT_EQ(2u, requests[0].GetRecords().size());
+    ASSERT_EQ(1u, m_client->m_listShardsCalls);
+
+    Aws::Map<Aws::String, Aws::String> dataByIndex;
+    for (const auto& entry : requests[0].GetRecords())
+    {
+        Aws::String shardId = m_client->GetShardId(entry);
+        for (const auto& record : Deaggregate(entry.GetData()))
+        {
+            PutRecordsRequestEntry userEntry;
+            userEntry.SetPartitionKey(record.first);
+            if (record.first == "explicit")
+            {
+                userEntry.SetExplicitHashKey(SPLIT_HASH_KEY);
+            }
+            ASSERT_EQ(shardId, m_client->GetShardId(userEntry));
+            dataByIndex[record.second] = record.first;
+        }
+    }
+    ASSERT_EQ(101u, dataByIndex.size());
+    ASSERT_EQ("key7", dataByIndex["record 27"]);
+
+    ASSERT_EQ(101u, m_results.size());
+    Aws::Map<Aws::String, size_t> recordsPerSequenceNumber;
+    for (const auto& result : m_results)
+    {
+        ASSERT_TRUE(result.successful);
+        ASSERT_TRUE(result.aggregated);
+        ASSERT_FALSE(result.shardId.empty());
+        ++recordsPerSequenceNumber[result.sequenceNumber];
+    }
+    ASSERT_EQ(2u, recordsPerSequenceNumber.size());
+}
+
+TEST_F(KinesisProducerTest, TestRefreshesShardMapAfterReshard)
+{
+    m_client->m_shardsKnown = true;
+    m_configuration.aggregationEnabled = true;
+    KinesisProducer producer(m_configuration);
+    for (size_t i = 0; i < 40; ++i)
+    {
+        ASSERT_TRUE(producer.Put(MakeKey(i % 20), MakeData(i)));
+    }
+    producer.FlushAndWait();
+    ASSERT_EQ(2u, m_client->GetRequests().back().GetRecords().size());
+
+    // the records aggregated for the split shard land on one of its children, which has the shards listed again
+    m_client->Reshard();
+    for (size_t i = 40; i < 80; ++i)
+    {
+        ASSERT_TRUE(producer.Put(MakeKey(i % 20), MakeData(i)));
+    }
+    producer.FlushAndWait();
+    for (size_t i = 0; i < 500 && m_client->m_listShardsCalls < 2; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(2u, m_client->m_listShardsCalls);
+
+    for (size_t i = 80; i < 120; ++i)
+    {
+        ASSERT_TRUE(producer.Put(MakeKey(i % 20), MakeData(i)));
+    }
+    producer.FlushAndWait();
+
+    // one aggregated record per open shard, each holding only records of its shard
+    auto request = m_client->GetRequests().back();
+    ASSERT_EQ(3u, request.GetRecords().size());
+    for (const auto& entry : request.GetRecords())
+    {
+        Aws::String shardId = m_client->GetShardId(entry);
+        ASSERT_NE("shardId-000000000001", shardId);
+        for (const auto& record : Deaggregate(entry.GetData()))
+        {
+            ASSERT_EQ(shardId, m_client->GetShardId(PutRecordsRequestEntry().WithPartitionKey(record.first)));
+        }
+    }
+
+    auto results = GetResults();
+    ASSERT_EQ(120u, results.size());
+    for (size_t i = 80; i < results.size(); ++i)
+    {
+        ASSERT_TRUE(results[i].successful);
+        ASSERT_NE("shardId-000000000001", results[i].shardId);
+    }
+    ASSERT_EQ(0u, producer.GetMetrics().entriesFailed);
+}
+
+TEST_F(KinesisProducerTest, TestHoldsBackRecordsOverTheRateLimitOfAShard)
+{
+    m_client->m_shardsKnown = true;
+    KinesisProducer producer(m_configuration);
+    for (size_t i = 0; i < 500 && m_client->m_listShardsCalls < 1; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(1u, m_client->m_listShardsCalls);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    auto recordsSent = [this]()
+    {
+        size_t records = 0;
+        for (const auto& request : m_client->GetRequests())
+        {
+            records += request.GetRecords().size();
+        }
+        return records;
+    };
+
+    // twice the 1000 records a second the first shard accepts, the second half of them trickle out as its budget refills
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        ASSERT_TRUE(producer.Put(MakeKey(i), MakeData(i), "0"));
+    }
+    producer.Flush();
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    auto sent = recordsSent();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    ASSERT_LE(sent, 1000u + static_cast<size_t>(elapsed.count()) + 1);
+    ASSERT_LT(sent, 2000u);
+
+    producer.FlushAndWait();
+    elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    ASSERT_GE(elapsed.count(), 950);
+    ASSERT_EQ(2000u, recordsSent());
+
+    auto metrics = producer.GetMetrics();
+    ASSERT_EQ(2000u, metrics.entriesSucceeded);
+    ASSERT_EQ(0u, metrics.entriesRetried);
+}
+
+TEST_F(KinesisProducerTest, TestRejectsInvalidRecords)
+{
+    KinesisProducer producer(m_configuration);
+    ASSERT_FALSE(producer.Put("", MakeData(0)));
+    ASSERT_FALSE(producer.Put(Aws::String(257, 'k'), MakeData(0)));
+    ASSERT_FALSE(producer.Put("key", ByteBuffer(1024 * 1024)));
+    ASSERT_FALSE(producer.Put("key", MakeData(0), "12ab"));
+    ASSERT_FALSE(producer.Put("key", MakeData(0), "340282366920938463463374607431768211456"));
+    ASSERT_TRUE(producer.Put("key", MakeData(0), LAST_HASH_KEY));
+    producer.FlushAndWait();
+    ASSERT_EQ(1u, producer.GetMetrics().entriesPut);
+}
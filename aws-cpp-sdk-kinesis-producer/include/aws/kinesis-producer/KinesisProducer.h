@@ -0,0 +1,214 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/kinesis-producer/KinesisProducer_EXPORTS.h>
+#include <aws/kinesis/KinesisClient.h>
+#include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/BatchingLoop.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace Aws
+{
+    namespace KinesisProducer
+    {
+        class KinesisProducer;
+        struct ShardBuffer;
+        struct UserRecord;
+        struct PutRecordsContext;
+
+        /**
+         * What became of a record given to KinesisProducer::Put().
+         */
+        struct UserRecordResult
+        {
+            UserRecordResult() : successful(false), subSequenceNumber(0), aggregated(false), attempts(0) {}
+
+            Aws::String partitionKey;
+            std::shared_ptr<const Aws::Client::AsyncCallerContext> context;
+            bool successful;
+            Aws::String shardId;
+            Aws::String sequenceNumber;
+            /**
+             * Index of the record within the aggregated Kinesis record it was sent in, 0 if it was sent on its own.
+             */
+            size_t subSequenceNumber;
+            bool aggregated;
+            /**
+             * Number of PutRecords requests the record was sent in.
+             */
+            unsigned attempts;
+            /**
+             * Error of the last attempt if the record failed.
+             */
+            Aws::String errorCode;
+            Aws::String errorMessage;
+        };
+
+        typedef std::function<void(const KinesisProducer*, const UserRecordResult&)> UserRecordCompletedCallback;
+
+        /**
+         * Entries are the user records given to Put(), those waiting for a retry count as buffered, and bytes are their data and
+         * partition keys.
+         */
+        struct KinesisProducerMetrics : public Aws::Utils::Threading::BatchingMetrics
+        {
+            KinesisProducerMetrics() : kinesisRecordsSent(0), bytesSent(0) {}
+
+            /**
+             * Kinesis records sent, each aggregated record counts once however many user records it holds. Retries count again.
+             */
+            uint64_t kinesisRecordsSent;
+            /**
+             * Data and partition keys of the Kinesis records sent.
+             */
+            uint64_t bytesSent;
+        };
+
+        struct AWS_KINESIS_PRODUCER_API KinesisProducerConfiguration
+        {
+            KinesisProducerConfiguration();
+
+            std::shared_ptr<Aws::Kinesis::KinesisClient> kinesisClient;
+            Aws::String streamName;
+
+            /**
+             * How long a record may wait in the buffer for others to share a request with. Defaults to 100 milliseconds.
+             */
+            std::chrono::milliseconds maxBufferedTime;
+            /**
+             * A request is sent before maxBufferedTime is up once this many bytes or records are buffered, at most 5MB and 500 records,
+             * which is what a PutRecords request takes.
+             */
+            size_t maxBytesPerRequest;
+            size_t maxRecordsPerRequest;
+            /**
+             * Put() blocks while this many bytes of records are waiting to be sent. Defaults to 64MB.
+             */
+            size_t maxBufferedBytes;
+            /**
+             * Defaults to 16.
+             */
+            size_t maxRequestsInFlight;
+
+            /**
+             * Packs records bound for the same shard into aggregated Kinesis records of up to maxAggregatedRecordSize bytes,
+             * in the format of the Kinesis Producer Library, so consumers need to deaggregate them. Off by default.
+             */
+            bool aggregationEnabled;
+            size_t maxAggregatedRecordSize;
+
+            /**
+             * Shards accept 1MB and 1000 records a second. Records for a shard are held back once it has been sent this percentage of that
+             * over the last second, rather than have them throttled and retried. The shard of a record is predicted from the MD5 of its
+             * partition key and the hash key ranges the stream reports, and refreshed when Kinesis puts a record elsewhere, e.g. after
+             * resharding. Defaults to 100, 0 turns limiting off.
+             */
+            unsigned rateLimitPercent;
+
+            /**
+             * Records Kinesis fails, e.g. because the shard is throttled, are sent again after a backoff doubling from retryBaseDelay
+             * up to maxRetryDelay, at most maxRetries times. Defaults to 10 retries from 100 milliseconds up to 5 seconds.
+             */
+            unsigned maxRetries;
+            std::chrono::milliseconds retryBaseDelay;
+            std::chrono::milliseconds maxRetryDelay;
+
+            /**
+             * Called once for every record Put() accepted, on success or after it failed for good.
+             */
+            UserRecordCompletedCallback userRecordCompletedCallback;
+        };
+
+        /**
+         * Sends records to a Kinesis stream with PutRecords, batching records from any number of threads into requests of up to
+         * 500 records or 5MB, grouped by the shard each record is predicted to go to, optionally aggregating small records,
+         * and retrying only the records of a request that failed.
+         *
+         * Put() returns as soon as the record is buffered, results are reported through the userRecordCompletedCallback.
+         * Requests are sent from a thread of the producer, PutRecords runs on the executor of the client.
+         */
+        class AWS_KINESIS_PRODUCER_API KinesisProducer : private Aws::Utils::Threading::BatchingLoop
+        {
+        public:
+            KinesisProducer(const KinesisProducerConfiguration& configuration);
+
+            /**
+             * Sends the records still buffered and waits for them, including their retries.
+             */
+            ~KinesisProducer();
+
+            KinesisProducer(const KinesisProducer&) = delete;
+            KinesisProducer& operator=(const KinesisProducer&) = delete;
+
+            /**
+             * Buffers a record for the stream, blocking while maxBufferedBytes are buffered. explicitHashKey, a decimal 128 bit number,
+             * overrides the hash of the partition key in choosing the shard. Returns false, and doesn't call the callback, if the record
+             * isn't valid for Kinesis or the producer is being destroyed.
+             */
+            bool Put(const Aws::String& partitionKey, const Aws::Utils::ByteBuffer& data, const Aws::String& explicitHashKey = "",
+                     const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr);
+
+            /**
+             * Sends the records buffered so far without waiting for maxBufferedTime. Does not block.
+             */
+            void Flush();
+
+            /**
+             * Sends the records buffered so far and blocks until all records have completed.
+             */
+            void FlushAndWait();
+
+            KinesisProducerMetrics GetMetrics() const;
+
+            inline const KinesisProducerConfiguration& GetConfiguration() const { return m_configuration; }
+
+        private:
+            bool HasBufferedEntries() const override;
+            std::function<void()> TakeHousekeeping(std::chrono::steady_clock::time_point now, Aws::Utils::Threading::WakeUpTime& wakeUp) override;
+            std::function<void()> TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, Aws::Utils::Threading::WakeUpTime& wakeUp) override;
+            void RefreshShardMap();
+            std::shared_ptr<PutRecordsContext> TakeRecords(std::chrono::steady_clock::time_point now);
+            void SendRequest(const std::shared_ptr<PutRecordsContext>& context);
+            void OnPutRecordsOutcome(const Aws::Kinesis::KinesisClient*, const Aws::Kinesis::Model::PutRecordsRequest&,
+                                     const Aws::Kinesis::Model::PutRecordsOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
+            bool RetryOrFail(std::chrono::steady_clock::time_point failedAt, const std::shared_ptr<UserRecord>& record, const Aws::String& errorCode,
+                             const Aws::String& errorMessage, bool retryable, Aws::Vector<UserRecordResult>& failed);
+            ShardBuffer& GetShardBuffer(const std::shared_ptr<UserRecord>& record);
+
+            KinesisProducerConfiguration m_configuration;
+
+            bool m_shardMapStale;
+            std::chrono::steady_clock::time_point m_lastShardMapRefresh;
+            // open shards sorted by their starting hash key, records are kept here when the shard map isn't known
+            Aws::Vector<std::shared_ptr<ShardBuffer>> m_shards;
+            std::shared_ptr<ShardBuffer> m_unknownShard;
+            size_t m_nextShard;
+            // records in the shard buffers, ready to be sent
+            size_t m_pendingRecords;
+            size_t m_pendingBytes;
+            Aws::Utils::Threading::RetryQueue<std::shared_ptr<UserRecord>> m_retries;
+            size_t m_retryBytes;
+            KinesisProducerMetrics m_metrics;
+        };
+    }
+}
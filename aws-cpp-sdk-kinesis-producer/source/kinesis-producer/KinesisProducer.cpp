@@ -0,0 +1,811 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/kinesis-producer/KinesisProducer.h>
+#include <aws/kinesis/model/ListShardsRequest.h>
+#include <aws/kinesis/model/ListShardsResult.h>
+#include <aws/kinesis/model/PutRecordsRequest.h>
+#include <aws/kinesis/model/PutRecordsResult.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+using namespace Aws::Client;
+using namespace Aws::Utils::Threading;
+using namespace Aws::Kinesis;
+using namespace Aws::Kinesis::Model;
+
+namespace Aws
+{
+    namespace KinesisProducer
+    {
+        static const char* CLASS_TAG = "KinesisProducer";
+
+        // limits of PutRecords
+        static const size_t MAX_RECORDS_PER_REQUEST = 500;
+        static const size_t MAX_BYTES_PER_REQUEST = 5 * 1024 * 1024;
+        static const size_t MAX_RECORD_SIZE = 1024 * 1024;
+        static const size_t MAX_PARTITION_KEY_LENGTH = 256;
+
+        // what a shard takes per second
+        static const double SHARD_BYTES_PER_SECOND = 1024 * 1024;
+        static const double SHARD_RECORDS_PER_SECOND = 1000;
+        // how long to wait when everything buffered is for shards at their rate limit
+        static const std::chrono::milliseconds RATE_LIMIT_WAIT(25);
+        static const std::chrono::seconds MIN_SHARD_MAP_REFRESH_INTERVAL(1);
+
+        // framing of aggregated records, as written by the Kinesis Producer Library
+        static const unsigned char AGGREGATED_RECORD_MAGIC[] = { 0xF3, 0x89, 0x9A, 0xC2 };
+        static const size_t AGGREGATED_RECORD_MAGIC_SIZE = sizeof(AGGREGATED_RECORD_MAGIC);
+        static const size_t AGGREGATED_RECORD_CHECKSUM_SIZE = 16;
+        // protobuf tags of AggregatedRecord and Record
+        static const char PARTITION_KEY_TABLE_TAG = 0x0A;
+        static const char EXPLICIT_HASH_KEY_TABLE_TAG = 0x12;
+        static const char RECORDS_TAG = 0x1A;
+        static const char PARTITION_KEY_INDEX_TAG = 0x08;
+        static const char EXPLICIT_HASH_KEY_INDEX_TAG = 0x10;
+        static const char DATA_TAG = 0x1A;
+
+        // 128 bit hash key, big endian so that keys compare like the numbers they are
+        typedef std::array<unsigned char, 16> HashKey;
+
+        struct UserRecord
+        {
+            UserRecord() : attempts(0) {}
+
+            size_t GetSize() const { return data.GetLength() + partitionKey.size(); }
+
+            Aws::String partitionKey;
+            Aws::String explicitHashKey;
+            Aws::Utils::ByteBuffer data;
+            std::shared_ptr<const AsyncCallerContext> context;
+            HashKey hashKey;
+            unsigned attempts;
+            std::chrono::steady_clock::time_point deadline;
+        };
+
+        struct ShardBuffer
+        {
+            ShardBuffer(const Aws::String& id, const HashKey& start, const HashKey& end) :
+                shardId(id), startingHashKey(start), endingHashKey(end), byteTokens(0), recordTokens(0)
+            {
+            }
+
+            Aws::String shardId;
+            HashKey startingHashKey;
+            HashKey endingHashKey;
+            Aws::Deque<std::shared_ptr<UserRecord>> records;
+            double byteTokens;
+            double recordTokens;
+            std::chrono::steady_clock::time_point lastRefill;
+        };
+
+        static size_t VarintSize(uint64_t value)
+        {
+            size_t size = 1;
+            for (; value >= 0x80; value >>= 7)
+            {
+                ++size;
+            }
+            return size;
+        }
+
+        static void AppendVarint(Aws::String& buffer, uint64_t value)
+        {
+            for (; value >= 0x80; value >>= 7)
+            {
+                buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            }
+            buffer.push_back(static_cast<char>(value));
+        }
+
+        static void AppendLengthDelimited(Aws::String& buffer, char tag, const char* data, size_t length)
+        {
+            buffer.push_back(tag);
+            AppendVarint(buffer, length);
+            buffer.append(data, length);
+        }
+
+        static size_t LengthDelimitedSize(size_t length)
+        {
+            return 1 + VarintSize(length) + length;
+        }
+
+        /**
+         * User records sent as one Kinesis record, in the aggregated format if there is more than one.
+         */
+        class KinesisRecord
+        {
+        public:
+            KinesisRecord() : m_protobufSize(0) {}
+
+            inline bool IsEmpty() const { return m_userRecords.empty(); }
+            inline const Aws::Vector<std::shared_ptr<UserRecord>>& GetUserRecords() const { return m_userRecords; }
+
+            /**
+             * Data and partition key bytes of the Kinesis record once record is added.
+             */
+            size_t GetSizeWith(const UserRecord& record) const
+            {
+                if (IsEmpty())
+                {
+                    return record.GetSize();
+                }
+                return GetAggregatedSize(m_protobufSize + GetProtobufGrowth(record));
+            }
+
+            size_t GetSize() const
+            {
+                return m_userRecords.size() == 1 ? m_userRecords.front()->GetSize() : GetAggregatedSize(m_protobufSize);
+            }
+
+            void Add(const std::shared_ptr<UserRecord>& record)
+            {
+                m_protobufSize += GetProtobufGrowth(*record);
+                if (m_partitionKeyIndex.find(record->partitionKey) == m_partitionKeyIndex.end())
+                {
+                    m_partitionKeyIndex[record->partitionKey] = m_partitionKeys.size();
+                    m_partitionKeys.push_back(record->partitionKey);
+                }
+                if (!record->explicitHashKey.empty() && m_explicitHashKeyIndex.find(record->explicitHashKey) == m_explicitHashKeyIndex.end())
+                {
+                    m_explicitHashKeyIndex[record->explicitHashKey] = m_explicitHashKeys.size();
+                    m_explicitHashKeys.push_back(record->explicitHashKey);
+                }
+                m_userRecords.push_back(record);
+            }
+
+            PutRecordsRequestEntry ToEntry() const
+            {
+                const UserRecord& first = *m_userRecords.front();
+                PutRecordsRequestEntry entry;
+                entry.SetPartitionKey(first.partitionKey);
+                if (!first.explicitHashKey.empty())
+                {
+                    entry.SetExplicitHashKey(first.explicitHashKey);
+                }
+
+                if (m_userRecords.size() == 1)
+                {
+                    entry.SetData(first.data);
+                    return entry;
+                }
+
+                Aws::String protobuf;
+                protobuf.reserve(m_protobufSize);
+                for (const auto& partitionKey : m_partitionKeys)
+                {
+                    AppendLengthDelimited(protobuf, PARTITION_KEY_TABLE_TAG, partitionKey.c_str(), partitionKey.size());
+                }
+                for (const auto& explicitHashKey : m_explicitHashKeys)
+                {
+                    AppendLengthDelimited(protobuf, EXPLICIT_HASH_KEY_TABLE_TAG, explicitHashKey.c_str(), explicitHashKey.size());
+                }
+
+                Aws::String record;
+                for (const auto& userRecord : m_userRecords)
+                {
+                    record.clear();
+                    record.push_back(PARTITION_KEY_INDEX_TAG);
+                    AppendVarint(record, m_partitionKeyIndex.find(userRecord->partitionKey)->second);
+                    if (!userRecord->explicitHashKey.empty())
+                    {
+                        record.push_back(EXPLICIT_HASH_KEY_INDEX_TAG);
+                        AppendVarint(record, m_explicitHashKeyIndex.find(userRecord->explicitHashKey)->second);
+                    }
+                    AppendLengthDelimited(record, DATA_TAG, reinterpret_cast<const char*>(userRecord->data.GetUnderlyingData()), userRecord->data.GetLength());
+                    AppendLengthDelimited(protobuf, RECORDS_TAG, record.c_str(), record.size());
+                }
+
+                auto checksum = Aws::Utils::HashingUtils::CalculateMD5(protobuf);
+                Aws::Utils::ByteBuffer data(AGGREGATED_RECORD_MAGIC_SIZE + protobuf.size() + checksum.GetLength());
+                std::memcpy(data.GetUnderlyingData(), AGGREGATED_RECORD_MAGIC, AGGREGATED_RECORD_MAGIC_SIZE);
+                std::memcpy(data.GetUnderlyingData() + AGGREGATED_RECORD_MAGIC_SIZE, protobuf.c_str(), protobuf.size());
+                std::memcpy(data.GetUnderlyingData() + AGGREGATED_RECORD_MAGIC_SIZE + protobuf.size(), checksum.GetUnderlyingData(), checksum.GetLength());
+                entry.SetData(data);
+                return entry;
+            }
+
+        private:
+            size_t GetAggregatedSize(size_t protobufSize) const
+            {
+                return AGGREGATED_RECORD_MAGIC_SIZE + protobufSize + AGGREGATED_RECORD_CHECKSUM_SIZE + m_userRecords.front()->partitionKey.size();
+            }
+
+            // bytes the AggregatedRecord message grows by with record, including the key table entries it adds
+            size_t GetProtobufGrowth(const UserRecord& record) const
+            {
+                size_t growth = 0;
+                size_t partitionKeyIndex = m_partitionKeys.size();
+                auto partitionKeyIter = m_partitionKeyIndex.find(record.partitionKey);
+                if (partitionKeyIter != m_partitionKeyIndex.end())
+                {
+                    partitionKeyIndex = partitionKeyIter->second;
+                }
+                else
+                {
+                    growth += LengthDelimitedSize(record.partitionKey.size());
+                }
+
+                size_t recordSize = 1 + VarintSize(partitionKeyIndex) + LengthDelimitedSize(record.data.GetLength());
+                if (!record.explicitHashKey.empty())
+                {
+                    size_t explicitHashKeyIndex = m_explicitHashKeys.size();
+                    auto explicitHashKeyIter = m_explicitHashKeyIndex.find(record.explicitHashKey);
+                    if (explicitHashKeyIter != m_explicitHashKeyIndex.end())
+                    {
+                        explicitHashKeyIndex = explicitHashKeyIter->second;
+                    }
+                    else
+                    {
+                        growth += LengthDelimitedSize(record.explicitHashKey.size());
+                    }
+                    recordSize += 1 + VarintSize(explicitHashKeyIndex);
+                }
+
+                return growth + LengthDelimitedSize(recordSize);
+            }
+
+            size_t m_protobufSize;
+            Aws::Vector<std::shared_ptr<UserRecord>> m_userRecords;
+            Aws::Vector<Aws::String> m_partitionKeys;
+            Aws::Map<Aws::String, size_t> m_partitionKeyIndex;
+            Aws::Vector<Aws::String> m_explicitHashKeys;
+            Aws::Map<Aws::String, size_t> m_explicitHashKeyIndex;
+        };
+
+        struct PutRecordsContext : public AsyncCallerContext
+        {
+            PutRecordsContext() : bytes(0) {}
+
+            Aws::Vector<KinesisRecord> records;
+            // shards the records were predicted to go to, empty if unknown
+            Aws::Vector<Aws::String> shardIds;
+            size_t bytes;
+        };
+
+        static bool ParseHashKey(const Aws::String& decimal, HashKey& key)
+        {
+            key.fill(0);
+            if (decimal.empty())
+            {
+                return false;
+            }
+
+            for (char digit : decimal)
+            {
+                if (digit < '0' || digit > '9')
+                {
+                    return false;
+                }
+
+                unsigned carry = static_cast<unsigned>(digit - '0');
+                for (size_t i = key.size(); i > 0; --i)
+                {
+                    unsigned value = key[i - 1] * 10u + carry;
+                    key[i - 1] = static_cast<unsigned char>(value & 0xFF);
+                    carry = value >> 8;
+                }
+
+                if (carry)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static HashKey HashPartitionKey(const Aws::String& partitionKey)
+        {
+            HashKey key;
+            auto md5 = Aws::Utils::HashingUtils::CalculateMD5(partitionKey);
+            std::memcpy(key.data(), md5.GetUnderlyingData(), key.size());
+            return key;
+        }
+
+        static ShardBuffer* FindShard(const Aws::Vector<std::shared_ptr<ShardBuffer>>& shards, const HashKey& key)
+        {
+            auto iter = std::upper_bound(shards.begin(), shards.end(), key,
+                [](const HashKey& value, const std::shared_ptr<ShardBuffer>& shard) { return value < shard->startingHashKey; });
+            if (iter == shards.begin())
+            {
+                return nullptr;
+            }
+            --iter;
+            return key <= (*iter)->endingHashKey ? iter->get() : nullptr;
+        }
+
+        static void RefillTokens(ShardBuffer& shard, std::chrono::steady_clock::time_point now, unsigned rateLimitPercent)
+        {
+            double rate = rateLimitPercent / 100.0;
+            double elapsed = std::chrono::duration<double>(now - shard.lastRefill).count();
+            shard.lastRefill = now;
+            shard.byteTokens = (std::min)(shard.byteTokens + elapsed * rate * SHARD_BYTES_PER_SECOND, rate * SHARD_BYTES_PER_SECOND);
+            shard.recordTokens = (std::min)(shard.recordTokens + elapsed * rate * SHARD_RECORDS_PER_SECOND, rate * SHARD_RECORDS_PER_SECOND);
+        }
+
+        KinesisProducerConfiguration::KinesisProducerConfiguration() :
+            maxBufferedTime(100),
+            maxBytesPerRequest(MAX_BYTES_PER_REQUEST),
+            maxRecordsPerRequest(MAX_RECORDS_PER_REQUEST),
+            maxBufferedBytes(64 * 1024 * 1024),
+            maxRequestsInFlight(16),
+            aggregationEnabled(false),
+            maxAggregatedRecordSize(51200),
+            rateLimitPercent(100),
+            maxRetries(10),
+            retryBaseDelay(100),
+            maxRetryDelay(5000)
+        {
+        }
+
+        KinesisProducer::KinesisProducer(const KinesisProducerConfiguration& configuration) :
+            BatchingLoop(configuration.maxRequestsInFlight),
+            m_configuration(configuration),
+            m_shardMapStale(true),
+            m_nextShard(0),
+            m_pendingRecords(0),
+            m_pendingBytes(0),
+            m_retries(configuration.retryBaseDelay, configuration.maxRetryDelay),
+            m_retryBytes(0)
+        {
+            m_configuration.maxRecordsPerRequest = (std::max)((std::min)(m_configuration.maxRecordsPerRequest, MAX_RECORDS_PER_REQUEST), static_cast<size_t>(1));
+            m_configuration.maxBytesPerRequest = (std::max)((std::min)(m_configuration.maxBytesPerRequest, MAX_BYTES_PER_REQUEST), static_cast<size_t>(1));
+            m_configuration.maxRequestsInFlight = (std::max)(m_configuration.maxRequestsInFlight, static_cast<size_t>(1));
+            m_configuration.maxAggregatedRecordSize = (std::min)(m_configuration.maxAggregatedRecordSize, MAX_RECORD_SIZE);
+
+            HashKey lowest, highest;
+            lowest.fill(0);
+            highest.fill(0xFF);
+            m_unknownShard = Aws::MakeShared<ShardBuffer>(CLASS_TAG, "", lowest, highest);
+
+            StartLoop();
+        }
+
+        KinesisProducer::~KinesisProducer()
+        {
+            StopLoop();
+        }
+
+        bool KinesisProducer::Put(const Aws::String& partitionKey, const Aws::Utils::ByteBuffer& data, const Aws::String& explicitHashKey,
+                                  const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            if (partitionKey.empty() || partitionKey.size() > MAX_PARTITION_KEY_LENGTH || data.GetLength() + partitionKey.size() > MAX_RECORD_SIZE)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Record with partition key of " << partitionKey.size() << " characters and " << data.GetLength()
+                        << " bytes of data exceeds the limits of Kinesis.");
+                return false;
+            }
+
+            auto record = Aws::MakeShared<UserRecord>(CLASS_TAG);
+            record->partitionKey = partitionKey;
+            record->explicitHashKey = explicitHashKey;
+            record->data = data;
+            record->context = context;
+            if (explicitHashKey.empty())
+            {
+                record->hashKey = HashPartitionKey(partitionKey);
+            }
+            else if (!ParseHashKey(explicitHashKey, record->hashKey))
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Explicit hash key " << explicitHashKey << " is not a 128 bit decimal number.");
+                return false;
+            }
+
+            size_t size = record->GetSize();
+            std::unique_lock<std::mutex> locker(m_lock);
+            m_signal.wait(locker, [this, size]()
+            {
+                size_t buffered = m_pendingBytes + m_retryBytes;
+                return IsStopping() || buffered == 0 || buffered + size <= m_configuration.maxBufferedBytes;
+            });
+            if (IsStopping())
+            {
+                return false;
+            }
+
+            bool wasEmpty = m_pendingRecords == 0;
+            record->deadline = std::chrono::steady_clock::now() + m_configuration.maxBufferedTime;
+            GetShardBuffer(record).records.push_back(record);
+            ++m_pendingRecords;
+            m_pendingBytes += size;
+            ++m_metrics.entriesPut;
+
+            // with aggregation the record count says nothing of how full a request is, only the bytes do
+            if (wasEmpty || m_pendingBytes >= m_configuration.maxBytesPerRequest ||
+                (!m_configuration.aggregationEnabled && m_pendingRecords >= m_configuration.maxRecordsPerRequest))
+            {
+                m_signal.notify_all();
+            }
+            return true;
+        }
+
+        void KinesisProducer::Flush()
+        {
+            RequestFlush();
+        }
+
+        void KinesisProducer::FlushAndWait()
+        {
+            RequestFlush();
+            WaitUntilIdle();
+        }
+
+        KinesisProducerMetrics KinesisProducer::GetMetrics() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            KinesisProducerMetrics metrics = m_metrics;
+            CopyLoopMetrics(metrics);
+            metrics.entriesBuffered = m_pendingRecords + m_retries.size();
+            metrics.bytesBuffered = m_pendingBytes + m_retryBytes;
+            return metrics;
+        }
+
+        bool KinesisProducer::HasBufferedEntries() const
+        {
+            return m_pendingRecords > 0 || !m_retries.empty();
+        }
+
+        ShardBuffer& KinesisProducer::GetShardBuffer(const std::shared_ptr<UserRecord>& record)
+        {
+            ShardBuffer* shard = FindShard(m_shards, record->hashKey);
+            return shard ? *shard : *m_unknownShard;
+        }
+
+        std::function<void()> KinesisProducer::TakeHousekeeping(std::chrono::steady_clock::time_point now, WakeUpTime& wakeUp)
+        {
+            if (!m_shardMapStale)
+            {
+                return nullptr;
+            }
+
+            // resharding is rare, a stream whose shards keep being mispredicted isn't listed more than once a second
+            if (now - m_lastShardMapRefresh < MIN_SHARD_MAP_REFRESH_INTERVAL)
+            {
+                wakeUp.NoLaterThan(m_lastShardMapRefresh + MIN_SHARD_MAP_REFRESH_INTERVAL);
+                return nullptr;
+            }
+
+            m_shardMapStale = false;
+            m_lastShardMapRefresh = now;
+            return [this]() { RefreshShardMap(); };
+        }
+
+        std::function<void()> KinesisProducer::TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, WakeUpTime& wakeUp)
+        {
+            // retries go back to the front of their shard's buffer, which may not be the shard they failed on after resharding
+            m_retries.TakeDue(now, [this, now](const std::shared_ptr<UserRecord>& record)
+            {
+                record->deadline = now;
+                GetShardBuffer(record).records.push_front(record);
+                ++m_pendingRecords;
+                m_pendingBytes += record->GetSize();
+                m_retryBytes -= record->GetSize();
+            });
+            m_retries.AddWakeUp(wakeUp);
+            if (m_pendingRecords == 0)
+            {
+                return nullptr;
+            }
+
+            auto oldestDeadline = std::chrono::steady_clock::time_point::max();
+            for (const auto& shard : m_shards)
+            {
+                if (!shard->records.empty())
+                {
+                    oldestDeadline = (std::min)(oldestDeadline, shard->records.front()->deadline);
+                }
+            }
+            if (!m_unknownShard->records.empty())
+            {
+                oldestDeadline = (std::min)(oldestDeadline, m_unknownShard->records.front()->deadline);
+            }
+
+            bool ready = sendAll || oldestDeadline <= now || m_pendingBytes >= m_configuration.maxBytesPerRequest ||
+                (!m_configuration.aggregationEnabled && m_pendingRecords >= m_configuration.maxRecordsPerRequest);
+            if (!ready)
+            {
+                wakeUp.NoLaterThan(oldestDeadline);
+                return nullptr;
+            }
+
+            auto request = TakeRecords(now);
+            if (!request)
+            {
+                // every shard with records buffered is at its rate limit
+                wakeUp.NoLaterThan(now + RATE_LIMIT_WAIT);
+                return nullptr;
+            }
+
+            m_metrics.kinesisRecordsSent += request->records.size();
+            m_metrics.bytesSent += request->bytes;
+            return [this, request]() { SendRequest(request); };
+        }
+
+        void KinesisProducer::RefreshShardMap()
+        {
+            Aws::Vector<std::shared_ptr<ShardBuffer>> shards;
+            ListShardsRequest listShardsRequest;
+            listShardsRequest.SetStreamName(m_configuration.streamName);
+            while (true)
+            {
+                auto listShardsOutcome = m_configuration.kinesisClient->ListShards(listShardsRequest);
+                if (!listShardsOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "Unable to list the shards of stream " << m_configuration.streamName << ", records are sent without predicting their shard. "
+                            << listShardsOutcome.GetError());
+                    std::lock_guard<std::mutex> locker(m_lock);
+                    m_shardMapStale = true;
+                    return;
+                }
+
+                for (const auto& shard : listShardsOutcome.GetResult().GetShards())
+                {
+                    // shards closed by resharding take no more records
+                    if (!shard.GetSequenceNumberRange().GetEndingSequenceNumber().empty())
+                    {
+                        continue;
+                    }
+
+                    HashKey start, end;
+                    if (ParseHashKey(shard.GetHashKeyRange().GetStartingHashKey(), start) && ParseHashKey(shard.GetHashKeyRange().GetEndingHashKey(), end))
+                    {
+                        shards.push_back(Aws::MakeShared<ShardBuffer>(CLASS_TAG, shard.GetShardId(), start, end));
+                    }
+                }
+
+                if (listShardsOutcome.GetResult().GetNextToken().empty())
+                {
+                    break;
+                }
+                listShardsRequest = ListShardsRequest();
+                listShardsRequest.SetNextToken(listShardsOutcome.GetResult().GetNextToken());
+            }
+
+            std::sort(shards.begin(), shards.end(),
+                [](const std::shared_ptr<ShardBuffer>& lhs, const std::shared_ptr<ShardBuffer>& rhs) { return lhs->startingHashKey < rhs->startingHashKey; });
+            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Stream " << m_configuration.streamName << " has " << shards.size() << " open shards.");
+
+            std::lock_guard<std::mutex> locker(m_lock);
+            auto now = std::chrono::steady_clock::now();
+            for (auto& shard : shards)
+            {
+                shard->lastRefill = now;
+                shard->byteTokens = m_configuration.rateLimitPercent / 100.0 * SHARD_BYTES_PER_SECOND;
+                shard->recordTokens = m_configuration.rateLimitPercent / 100.0 * SHARD_RECORDS_PER_SECOND;
+                for (const auto& previous : m_shards)
+                {
+                    if (previous->shardId == shard->shardId)
+                    {
+                        shard->lastRefill = previous->lastRefill;
+                        shard->byteTokens = previous->byteTokens;
+                        shard->recordTokens = previous->recordTokens;
+                    }
+                }
+            }
+
+            auto previousShards = m_shards;
+            previousShards.push_back(m_unknownShard);
+            m_shards = shards;
+            m_unknownShard = Aws::MakeShared<ShardBuffer>(CLASS_TAG, "", m_unknownShard->startingHashKey, m_unknownShard->endingHashKey);
+            for (const auto& previous : previousShards)
+            {
+                for (const auto& record : previous->records)
+                {
+                    GetShardBuffer(record).records.push_back(record);
+                }
+            }
+        }
+
+        std::shared_ptr<PutRecordsContext> KinesisProducer::TakeRecords(std::chrono::steady_clock::time_point now)
+        {
+            Aws::Vector<ShardBuffer*> shards;
+            for (const auto& shard : m_shards)
+            {
+                shards.push_back(shard.get());
+            }
+            shards.push_back(m_unknownShard.get());
+
+            // one Kinesis record per shard in turn, so that a busy shard doesn't crowd out the others
+            auto context = Aws::MakeShared<PutRecordsContext>(CLASS_TAG);
+            bool added = true;
+            while (added && context->records.size() < m_configuration.maxRecordsPerRequest)
+            {
+                added = false;
+                for (size_t i = 0; i < shards.size() && context->records.size() < m_configuration.maxRecordsPerRequest; ++i)
+                {
+                    ShardBuffer& shard = *shards[(m_nextShard + i) % shards.size()];
+                    if (shard.records.empty())
+                    {
+                        continue;
+                    }
+
+                    bool known = !shard.shardId.empty();
+                    bool rateLimited = known && m_configuration.rateLimitPercent > 0;
+                    if (rateLimited)
+                    {
+                        RefillTokens(shard, now, m_configuration.rateLimitPercent);
+                        if (shard.byteTokens <= 0 || shard.recordTokens <= 0)
+                        {
+                            continue;
+                        }
+                    }
+
+                    // records are only aggregated when it's known they go to the same shard
+                    bool aggregate = known && m_configuration.aggregationEnabled;
+                    KinesisRecord kinesisRecord;
+                    while (!shard.records.empty())
+                    {
+                        const auto& record = shard.records.front();
+                        size_t size = kinesisRecord.GetSizeWith(*record);
+                        if (!kinesisRecord.IsEmpty() && (!aggregate || size > m_configuration.maxAggregatedRecordSize))
+                        {
+                            break;
+                        }
+                        if (context->bytes + size > m_configuration.maxBytesPerRequest && !(context->records.empty() && kinesisRecord.IsEmpty()))
+                        {
+                            break;
+                        }
+
+                        ++record->attempts;
+                        --m_pendingRecords;
+                        m_pendingBytes -= record->GetSize();
+                        kinesisRecord.Add(record);
+                        shard.records.pop_front();
+                    }
+
+                    if (kinesisRecord.IsEmpty())
+                    {
+                        continue;
+                    }
+
+                    size_t size = kinesisRecord.GetSize();
+                    if (rateLimited)
+                    {
+                        shard.byteTokens -= size;
+                        shard.recordTokens -= 1;
+                    }
+                    context->bytes += size;
+                    context->shardIds.push_back(shard.shardId);
+                    context->records.push_back(std::move(kinesisRecord));
+                    added = true;
+                }
+            }
+
+            m_nextShard = (m_nextShard + 1) % shards.size();
+            return context->records.empty() ? nullptr : context;
+        }
+
+        void KinesisProducer::SendRequest(const std::shared_ptr<PutRecordsContext>& context)
+        {
+            PutRecordsRequest putRecordsRequest;
+            putRecordsRequest.SetStreamName(m_configuration.streamName);
+            for (const auto& record : context->records)
+            {
+                putRecordsRequest.AddRecords(record.ToEntry());
+            }
+
+            AWS_LOGSTREAM_TRACE(CLASS_TAG, "Sending " << context->records.size() << " records of " << context->bytes << " bytes to stream " << m_configuration.streamName);
+            m_configuration.kinesisClient->PutRecordsAsync(putRecordsRequest, std::bind(&KinesisProducer::OnPutRecordsOutcome, this, std::placeholders::_1,
+                                                                                        std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), context);
+        }
+
+        bool KinesisProducer::RetryOrFail(std::chrono::steady_clock::time_point failedAt, const std::shared_ptr<UserRecord>& record, const Aws::String& errorCode,
+                                          const Aws::String& errorMessage, bool retryable, Aws::Vector<UserRecordResult>& failed)
+        {
+            if (retryable && record->attempts <= m_configuration.maxRetries)
+            {
+                m_retries.Add(record, record->attempts, failedAt);
+                m_retryBytes += record->GetSize();
+                ++m_metrics.entriesRetried;
+                return true;
+            }
+
+            UserRecordResult result;
+            result.partitionKey = record->partitionKey;
+            result.context = record->context;
+            result.attempts = record->attempts;
+            result.errorCode = errorCode;
+            result.errorMessage = errorMessage;
+            failed.push_back(result);
+            ++m_metrics.entriesFailed;
+            return false;
+        }
+
+        void KinesisProducer::OnPutRecordsOutcome(const KinesisClient*, const PutRecordsRequest&, const PutRecordsOutcome& putRecordsOutcome,
+                                                  const std::shared_ptr<const AsyncCallerContext>& context)
+        {
+            auto request = std::static_pointer_cast<const PutRecordsContext>(context);
+            Aws::Vector<UserRecordResult> results;
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                auto failedAt = std::chrono::steady_clock::now();
+                if (!putRecordsOutcome.IsSuccess())
+                {
+                    const auto& error = putRecordsOutcome.GetError();
+                    AWS_LOGSTREAM_ERROR(CLASS_TAG, "PutRecords of " << request->records.size() << " records to stream " << m_configuration.streamName
+                            << " failed. " << error);
+                    bool retryable = error.ShouldRetry() || error.GetErrorType() == KinesisErrors::PROVISIONED_THROUGHPUT_EXCEEDED;
+                    for (const auto& record : request->records)
+                    {
+                        for (const auto& userRecord : record.GetUserRecords())
+                        {
+                            RetryOrFail(failedAt, userRecord, error.GetExceptionName(), error.GetMessage(), retryable, results);
+                        }
+                    }
+                }
+                else
+                {
+                    const auto& entries = putRecordsOutcome.GetResult().GetRecords();
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "PutRecords to stream " << m_configuration.streamName << " completed with "
+                            << putRecordsOutcome.GetResult().GetFailedRecordCount() << " of " << entries.size() << " records failed.");
+                    for (size_t i = 0; i < request->records.size(); ++i)
+                    {
+                        const auto& userRecords = request->records[i].GetUserRecords();
+                        if (i >= entries.size() || !entries[i].GetErrorCode().empty())
+                        {
+                            // PutRecords fails records with ProvisionedThroughputExceededException or InternalFailure, both worth trying again
+                            Aws::String errorCode = i < entries.size() ? entries[i].GetErrorCode() : "InternalFailure";
+                            Aws::String errorMessage = i < entries.size() ? entries[i].GetErrorMessage() : "No result returned for the record.";
+                            for (const auto& userRecord : userRecords)
+                            {
+                                RetryOrFail(failedAt, userRecord, errorCode, errorMessage, true, results);
+                            }
+                            continue;
+                        }
+
+                        if (!request->shardIds[i].empty() && request->shardIds[i] != entries[i].GetShardId())
+                        {
+                            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Record predicted for shard " << request->shardIds[i] << " went to shard " << entries[i].GetShardId()
+                                    << ", refreshing the shard map of stream " << m_configuration.streamName);
+                            m_shardMapStale = true;
+                        }
+
+                        for (size_t j = 0; j < userRecords.size(); ++j)
+                        {
+                            UserRecordResult result;
+                            result.partitionKey = userRecords[j]->partitionKey;
+                            result.context = userRecords[j]->context;
+                            result.successful = true;
+                            result.shardId = entries[i].GetShardId();
+                            result.sequenceNumber = entries[i].GetSequenceNumber();
+                            result.aggregated = userRecords.size() > 1;
+                            result.subSequenceNumber = result.aggregated ? j : 0;
+                            result.attempts = userRecords[j]->attempts;
+                            results.push_back(result);
+                        }
+                        m_metrics.entriesSucceeded += userRecords.size();
+                    }
+                }
+            }
+
+            if (m_configuration.userRecordCompletedCallback)
+            {
+                for (const auto& result : results)
+                {
+                    m_configuration.userRecordCompletedCallback(this, result);
+                }
+            }
+
+            CompleteRequest();
+        }
+    }
+}
@@ -34,7 +34,8 @@ namespace DiscontinuityModeMapper
 {
 AWS_KINESISVIDEOARCHIVEDMEDIA_API DiscontinuityMode GetDiscontinuityModeForName(const Aws::String& name);
 
-AWS_KINESISVIDEOARCHIVEDMEDIA_API Aws::String GetNameForDiscontinuityMode(DiscontinuityMode value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISVIDEOARCHIVEDMEDIA_API const char* GetNameForDiscontinuityMode(DiscontinuityMode value);
 } // namespace DiscontinuityModeMapper
 } // namespace Model
 } // namespace KinesisVideoArchivedMedia
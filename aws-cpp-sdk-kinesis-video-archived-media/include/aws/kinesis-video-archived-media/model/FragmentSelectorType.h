@@ -34,7 +34,8 @@ namespace FragmentSelectorTypeMapper
 {
 AWS_KINESISVIDEOARCHIVEDMEDIA_API FragmentSelectorType GetFragmentSelectorTypeForName(const Aws::String& name);
 
-AWS_KINESISVIDEOARCHIVEDMEDIA_API Aws::String GetNameForFragmentSelectorType(FragmentSelectorType value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISVIDEOARCHIVEDMEDIA_API const char* GetNameForFragmentSelectorType(FragmentSelectorType value);
 } // namespace FragmentSelectorTypeMapper
 } // namespace Model
 } // namespace KinesisVideoArchivedMedia
@@ -34,7 +34,8 @@ namespace HLSFragmentSelectorTypeMapper
 {
 AWS_KINESISVIDEOARCHIVEDMEDIA_API HLSFragmentSelectorType GetHLSFragmentSelectorTypeForName(const Aws::String& name);
 
-AWS_KINESISVIDEOARCHIVEDMEDIA_API Aws::String GetNameForHLSFragmentSelectorType(HLSFragmentSelectorType value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISVIDEOARCHIVEDMEDIA_API const char* GetNameForHLSFragmentSelectorType(HLSFragmentSelectorType value);
 } // namespace HLSFragmentSelectorTypeMapper
 } // namespace Model
 } // namespace KinesisVideoArchivedMedia
@@ -34,7 +34,8 @@ namespace PlaybackModeMapper
 {
 AWS_KINESISVIDEOARCHIVEDMEDIA_API PlaybackMode GetPlaybackModeForName(const Aws::String& name);
 
-AWS_KINESISVIDEOARCHIVEDMEDIA_API Aws::String GetNameForPlaybackMode(PlaybackMode value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISVIDEOARCHIVEDMEDIA_API const char* GetNameForPlaybackMode(PlaybackMode value);
 } // namespace PlaybackModeMapper
 } // namespace Model
 } // namespace KinesisVideoArchivedMedia
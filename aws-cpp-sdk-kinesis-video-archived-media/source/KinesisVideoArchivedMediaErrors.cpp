@@ -28,13 +28,13 @@ namespace KinesisVideoArchivedMedia
 namespace KinesisVideoArchivedMediaErrorMapper
 {
 
-static const int INVALID_ARGUMENT_HASH = HashingUtils::HashString("InvalidArgumentException");
-static const int CLIENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ClientLimitExceededException");
-static const int UNSUPPORTED_STREAM_MEDIA_TYPE_HASH = HashingUtils::HashString("UnsupportedStreamMediaTypeException");
-static const int MISSING_CODEC_PRIVATE_DATA_HASH = HashingUtils::HashString("MissingCodecPrivateDataException");
-static const int NOT_AUTHORIZED_HASH = HashingUtils::HashString("NotAuthorizedException");
-static const int INVALID_CODEC_PRIVATE_DATA_HASH = HashingUtils::HashString("InvalidCodecPrivateDataException");
-static const int NO_DATA_RETENTION_HASH = HashingUtils::HashString("NoDataRetentionException");
+static constexpr int INVALID_ARGUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidArgumentException");
+static constexpr int CLIENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ClientLimitExceededException");
+static constexpr int UNSUPPORTED_STREAM_MEDIA_TYPE_HASH = HashingUtils::CompileTimeHashString("UnsupportedStreamMediaTypeException");
+static constexpr int MISSING_CODEC_PRIVATE_DATA_HASH = HashingUtils::CompileTimeHashString("MissingCodecPrivateDataException");
+static constexpr int NOT_AUTHORIZED_HASH = HashingUtils::CompileTimeHashString("NotAuthorizedException");
+static constexpr int INVALID_CODEC_PRIVATE_DATA_HASH = HashingUtils::CompileTimeHashString("InvalidCodecPrivateDataException");
+static constexpr int NO_DATA_RETENTION_HASH = HashingUtils::CompileTimeHashString("NoDataRetentionException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace DiscontinuityModeMapper
       {
 
-        static const int ALWAYS_HASH = HashingUtils::HashString("ALWAYS");
-        static const int NEVER_HASH = HashingUtils::HashString("NEVER");
+        static constexpr int ALWAYS_HASH = HashingUtils::CompileTimeHashString("ALWAYS");
+        static constexpr int NEVER_HASH = HashingUtils::CompileTimeHashString("NEVER");
 
 
         DiscontinuityMode GetDiscontinuityModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALWAYS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DiscontinuityMode::ALWAYS;
-          }
-          else if (hashCode == NEVER_HASH)
-          {
-            return DiscontinuityMode::NEVER;
+          case ALWAYS_HASH:
+            if (name == "ALWAYS")
+            {
+              return DiscontinuityMode::ALWAYS;
+            }
+            break;
+          case NEVER_HASH:
+            if (name == "NEVER")
+            {
+              return DiscontinuityMode::NEVER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DiscontinuityMode::NOT_SET;
         }
 
-        Aws::String GetNameForDiscontinuityMode(DiscontinuityMode enumValue)
+        const char* GetNameForDiscontinuityMode(DiscontinuityMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HLSFragmentSelectorTypeMapper
       {
 
-        static const int PRODUCER_TIMESTAMP_HASH = HashingUtils::HashString("PRODUCER_TIMESTAMP");
-        static const int SERVER_TIMESTAMP_HASH = HashingUtils::HashString("SERVER_TIMESTAMP");
+        static constexpr int PRODUCER_TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("PRODUCER_TIMESTAMP");
+        static constexpr int SERVER_TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("SERVER_TIMESTAMP");
 
 
         HLSFragmentSelectorType GetHLSFragmentSelectorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRODUCER_TIMESTAMP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HLSFragmentSelectorType::PRODUCER_TIMESTAMP;
-          }
-          else if (hashCode == SERVER_TIMESTAMP_HASH)
-          {
-            return HLSFragmentSelectorType::SERVER_TIMESTAMP;
+          case PRODUCER_TIMESTAMP_HASH:
+            if (name == "PRODUCER_TIMESTAMP")
+            {
+              return HLSFragmentSelectorType::PRODUCER_TIMESTAMP;
+            }
+            break;
+          case SERVER_TIMESTAMP_HASH:
+            if (name == "SERVER_TIMESTAMP")
+            {
+              return HLSFragmentSelectorType::SERVER_TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HLSFragmentSelectorType::NOT_SET;
         }
 
-        Aws::String GetNameForHLSFragmentSelectorType(HLSFragmentSelectorType enumValue)
+        const char* GetNameForHLSFragmentSelectorType(HLSFragmentSelectorType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
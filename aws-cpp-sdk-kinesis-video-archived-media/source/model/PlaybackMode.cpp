@@ -30,20 +30,30 @@ namespace Aws
       namespace PlaybackModeMapper
       {
 
-        static const int LIVE_HASH = HashingUtils::HashString("LIVE");
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
+        static constexpr int LIVE_HASH = HashingUtils::CompileTimeHashString("LIVE");
+        static constexpr int ON_DEMAND_HASH = HashingUtils::CompileTimeHashString("ON_DEMAND");
 
 
         PlaybackMode GetPlaybackModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlaybackMode::LIVE;
-          }
-          else if (hashCode == ON_DEMAND_HASH)
-          {
-            return PlaybackMode::ON_DEMAND;
+          case LIVE_HASH:
+            if (name == "LIVE")
+            {
+              return PlaybackMode::LIVE;
+            }
+            break;
+          case ON_DEMAND_HASH:
+            if (name == "ON_DEMAND")
+            {
+              return PlaybackMode::ON_DEMAND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PlaybackMode::NOT_SET;
         }
 
-        Aws::String GetNameForPlaybackMode(PlaybackMode enumValue)
+        const char* GetNameForPlaybackMode(PlaybackMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
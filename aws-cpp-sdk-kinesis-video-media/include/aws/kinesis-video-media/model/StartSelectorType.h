@@ -38,7 +38,8 @@ namespace StartSelectorTypeMapper
 {
 AWS_KINESISVIDEOMEDIA_API StartSelectorType GetStartSelectorTypeForName(const Aws::String& name);
 
-AWS_KINESISVIDEOMEDIA_API Aws::String GetNameForStartSelectorType(StartSelectorType value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISVIDEOMEDIA_API const char* GetNameForStartSelectorType(StartSelectorType value);
 } // namespace StartSelectorTypeMapper
 } // namespace Model
 } // namespace KinesisVideoMedia
@@ -28,11 +28,11 @@ namespace KinesisVideoMedia
 namespace KinesisVideoMediaErrorMapper
 {
 
-static const int CLIENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ClientLimitExceededException");
-static const int INVALID_ARGUMENT_HASH = HashingUtils::HashString("InvalidArgumentException");
-static const int CONNECTION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ConnectionLimitExceededException");
-static const int NOT_AUTHORIZED_HASH = HashingUtils::HashString("NotAuthorizedException");
-static const int INVALID_ENDPOINT_HASH = HashingUtils::HashString("InvalidEndpointException");
+static constexpr int CLIENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ClientLimitExceededException");
+static constexpr int INVALID_ARGUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidArgumentException");
+static constexpr int CONNECTION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ConnectionLimitExceededException");
+static constexpr int NOT_AUTHORIZED_HASH = HashingUtils::CompileTimeHashString("NotAuthorizedException");
+static constexpr int INVALID_ENDPOINT_HASH = HashingUtils::CompileTimeHashString("InvalidEndpointException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,40 +30,58 @@ namespace Aws
       namespace StartSelectorTypeMapper
       {
 
-        static const int FRAGMENT_NUMBER_HASH = HashingUtils::HashString("FRAGMENT_NUMBER");
-        static const int SERVER_TIMESTAMP_HASH = HashingUtils::HashString("SERVER_TIMESTAMP");
-        static const int PRODUCER_TIMESTAMP_HASH = HashingUtils::HashString("PRODUCER_TIMESTAMP");
-        static const int NOW_HASH = HashingUtils::HashString("NOW");
-        static const int EARLIEST_HASH = HashingUtils::HashString("EARLIEST");
-        static const int CONTINUATION_TOKEN_HASH = HashingUtils::HashString("CONTINUATION_TOKEN");
+        static constexpr int FRAGMENT_NUMBER_HASH = HashingUtils::CompileTimeHashString("FRAGMENT_NUMBER");
+        static constexpr int SERVER_TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("SERVER_TIMESTAMP");
+        static constexpr int PRODUCER_TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("PRODUCER_TIMESTAMP");
+        static constexpr int NOW_HASH = HashingUtils::CompileTimeHashString("NOW");
+        static constexpr int EARLIEST_HASH = HashingUtils::CompileTimeHashString("EARLIEST");
+        static constexpr int CONTINUATION_TOKEN_HASH = HashingUtils::CompileTimeHashString("CONTINUATION_TOKEN");
 
 
         StartSelectorType GetStartSelectorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FRAGMENT_NUMBER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StartSelectorType::FRAGMENT_NUMBER;
-          }
-          else if (hashCode == SERVER_TIMESTAMP_HASH)
-          {
-            return StartSelectorType::SERVER_TIMESTAMP;
-          }
-          else if (hashCode == PRODUCER_TIMESTAMP_HASH)
-          {
-            return StartSelectorType::PRODUCER_TIMESTAMP;
-          }
-          else if (hashCode == NOW_HASH)
-          {
-            return StartSelectorType::NOW;
-          }
-          else if (hashCode == EARLIEST_HASH)
-          {
-            return StartSelectorType::EARLIEST;
-          }
-          else if (hashCode == CONTINUATION_TOKEN_HASH)
-          {
-            return StartSelectorType::CONTINUATION_TOKEN;
+          case FRAGMENT_NUMBER_HASH:
+            if (name == "FRAGMENT_NUMBER")
+            {
+              return StartSelectorType::FRAGMENT_NUMBER;
+            }
+            break;
+          case SERVER_TIMESTAMP_HASH:
+            if (name == "SERVER_TIMESTAMP")
+            {
+              return StartSelectorType::SERVER_TIMESTAMP;
+            }
+            break;
+          case PRODUCER_TIMESTAMP_HASH:
+            if (name == "PRODUCER_TIMESTAMP")
+            {
+              return StartSelectorType::PRODUCER_TIMESTAMP;
+            }
+            break;
+          case NOW_HASH:
+            if (name == "NOW")
+            {
+              return StartSelectorType::NOW;
+            }
+            break;
+          case EARLIEST_HASH:
+            if (name == "EARLIEST")
+            {
+              return StartSelectorType::EARLIEST;
+            }
+            break;
+          case CONTINUATION_TOKEN_HASH:
+            if (name == "CONTINUATION_TOKEN")
+            {
+              return StartSelectorType::CONTINUATION_TOKEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return StartSelectorType::NOT_SET;
         }
 
-        Aws::String GetNameForStartSelectorType(StartSelectorType enumValue)
+        const char* GetNameForStartSelectorType(StartSelectorType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace ConsumerStatusMapper
 {
 AWS_KINESIS_API ConsumerStatus GetConsumerStatusForName(const Aws::String& name);
 
-AWS_KINESIS_API Aws::String GetNameForConsumerStatus(ConsumerStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESIS_API const char* GetNameForConsumerStatus(ConsumerStatus value);
 } // namespace ConsumerStatusMapper
 } // namespace Model
 } // namespace Kinesis
@@ -40,7 +40,8 @@ namespace MetricsNameMapper
 {
 AWS_KINESIS_API MetricsName GetMetricsNameForName(const Aws::String& name);
 
-AWS_KINESIS_API Aws::String GetNameForMetricsName(MetricsName value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESIS_API const char* GetNameForMetricsName(MetricsName value);
 } // namespace MetricsNameMapper
 } // namespace Model
 } // namespace Kinesis
@@ -33,7 +33,8 @@ namespace ScalingTypeMapper
 {
 AWS_KINESIS_API ScalingType GetScalingTypeForName(const Aws::String& name);
 
-AWS_KINESIS_API Aws::String GetNameForScalingType(ScalingType value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESIS_API const char* GetNameForScalingType(ScalingType value);
 } // namespace ScalingTypeMapper
 } // namespace Model
 } // namespace Kinesis
@@ -37,7 +37,8 @@ namespace ShardIteratorTypeMapper
 {
 AWS_KINESIS_API ShardIteratorType GetShardIteratorTypeForName(const Aws::String& name);
 
-AWS_KINESIS_API Aws::String GetNameForShardIteratorType(ShardIteratorType value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESIS_API const char* GetNameForShardIteratorType(ShardIteratorType value);
 } // namespace ShardIteratorTypeMapper
 } // namespace Model
 } // namespace Kinesis
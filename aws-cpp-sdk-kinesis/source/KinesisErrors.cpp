@@ -28,18 +28,18 @@ namespace Kinesis
 namespace KinesisErrorMapper
 {
 
-static const int K_M_S_ACCESS_DENIED_HASH = HashingUtils::HashString("KMSAccessDeniedException");
-static const int K_M_S_NOT_FOUND_HASH = HashingUtils::HashString("KMSNotFoundException");
-static const int INVALID_ARGUMENT_HASH = HashingUtils::HashString("InvalidArgumentException");
-static const int K_M_S_OPT_IN_REQUIRED_HASH = HashingUtils::HashString("KMSOptInRequired");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int K_M_S_DISABLED_HASH = HashingUtils::HashString("KMSDisabledException");
-static const int K_M_S_INVALID_STATE_HASH = HashingUtils::HashString("KMSInvalidStateException");
-static const int EXPIRED_ITERATOR_HASH = HashingUtils::HashString("ExpiredIteratorException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int EXPIRED_NEXT_TOKEN_HASH = HashingUtils::HashString("ExpiredNextTokenException");
-static const int K_M_S_THROTTLING_HASH = HashingUtils::HashString("KMSThrottlingException");
-static const int PROVISIONED_THROUGHPUT_EXCEEDED_HASH = HashingUtils::HashString("ProvisionedThroughputExceededException");
+static constexpr int K_M_S_ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("KMSAccessDeniedException");
+static constexpr int K_M_S_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("KMSNotFoundException");
+static constexpr int INVALID_ARGUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidArgumentException");
+static constexpr int K_M_S_OPT_IN_REQUIRED_HASH = HashingUtils::CompileTimeHashString("KMSOptInRequired");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int K_M_S_DISABLED_HASH = HashingUtils::CompileTimeHashString("KMSDisabledException");
+static constexpr int K_M_S_INVALID_STATE_HASH = HashingUtils::CompileTimeHashString("KMSInvalidStateException");
+static constexpr int EXPIRED_ITERATOR_HASH = HashingUtils::CompileTimeHashString("ExpiredIteratorException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int EXPIRED_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("ExpiredNextTokenException");
+static constexpr int K_M_S_THROTTLING_HASH = HashingUtils::CompileTimeHashString("KMSThrottlingException");
+static constexpr int PROVISIONED_THROUGHPUT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ProvisionedThroughputExceededException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,50 +30,72 @@ namespace Aws
       namespace MetricsNameMapper
       {
 
-        static const int IncomingBytes_HASH = HashingUtils::HashString("IncomingBytes");
-        static const int IncomingRecords_HASH = HashingUtils::HashString("IncomingRecords");
-        static const int OutgoingBytes_HASH = HashingUtils::HashString("OutgoingBytes");
-        static const int OutgoingRecords_HASH = HashingUtils::HashString("OutgoingRecords");
-        static const int WriteProvisionedThroughputExceeded_HASH = HashingUtils::HashString("WriteProvisionedThroughputExceeded");
-        static const int ReadProvisionedThroughputExceeded_HASH = HashingUtils::HashString("ReadProvisionedThroughputExceeded");
-        static const int IteratorAgeMilliseconds_HASH = HashingUtils::HashString("IteratorAgeMilliseconds");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        static constexpr int IncomingBytes_HASH = HashingUtils::CompileTimeHashString("IncomingBytes");
+        static constexpr int IncomingRecords_HASH = HashingUtils::CompileTimeHashString("IncomingRecords");
+        static constexpr int OutgoingBytes_HASH = HashingUtils::CompileTimeHashString("OutgoingBytes");
+        static constexpr int OutgoingRecords_HASH = HashingUtils::CompileTimeHashString("OutgoingRecords");
+        static constexpr int WriteProvisionedThroughputExceeded_HASH = HashingUtils::CompileTimeHashString("WriteProvisionedThroughputExceeded");
+        static constexpr int ReadProvisionedThroughputExceeded_HASH = HashingUtils::CompileTimeHashString("ReadProvisionedThroughputExceeded");
+        static constexpr int IteratorAgeMilliseconds_HASH = HashingUtils::CompileTimeHashString("IteratorAgeMilliseconds");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
 
 
         MetricsName GetMetricsNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IncomingBytes_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MetricsName::IncomingBytes;
-          }
-          else if (hashCode == IncomingRecords_HASH)
-          {
-            return MetricsName::IncomingRecords;
-          }
-          else if (hashCode == OutgoingBytes_HASH)
-          {
-            return MetricsName::OutgoingBytes;
-          }
-          else if (hashCode == OutgoingRecords_HASH)
-          {
-            return MetricsName::OutgoingRecords;
-          }
-          else if (hashCode == WriteProvisionedThroughputExceeded_HASH)
-          {
-            return MetricsName::WriteProvisionedThroughputExceeded;
-          }
-          else if (hashCode == ReadProvisionedThroughputExceeded_HASH)
-          {
-            return MetricsName::ReadProvisionedThroughputExceeded;
-          }
-          else if (hashCode == IteratorAgeMilliseconds_HASH)
-          {
-            return MetricsName::IteratorAgeMilliseconds;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return MetricsName::ALL;
+          case IncomingBytes_HASH:
+            if (name == "IncomingBytes")
+            {
+              return MetricsName::IncomingBytes;
+            }
+            break;
+          case IncomingRecords_HASH:
+            if (name == "IncomingRecords")
+            {
+              return MetricsName::IncomingRecords;
+            }
+            break;
+          case OutgoingBytes_HASH:
+            if (name == "OutgoingBytes")
+            {
+              return MetricsName::OutgoingBytes;
+            }
+            break;
+          case OutgoingRecords_HASH:
+            if (name == "OutgoingRecords")
+            {
+              return MetricsName::OutgoingRecords;
+            }
+            break;
+          case WriteProvisionedThroughputExceeded_HASH:
+            if (name == "WriteProvisionedThroughputExceeded")
+            {
+              return MetricsName::WriteProvisionedThroughputExceeded;
+            }
+            break;
+          case ReadProvisionedThroughputExceeded_HASH:
+            if (name == "ReadProvisionedThroughputExceeded")
+            {
+              return MetricsName::ReadProvisionedThroughputExceeded;
+            }
+            break;
+          case IteratorAgeMilliseconds_HASH:
+            if (name == "IteratorAgeMilliseconds")
+            {
+              return MetricsName::IteratorAgeMilliseconds;
+            }
+            break;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return MetricsName::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return MetricsName::NOT_SET;
         }
 
-        Aws::String GetNameForMetricsName(MetricsName enumValue)
+        const char* GetNameForMetricsName(MetricsName enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
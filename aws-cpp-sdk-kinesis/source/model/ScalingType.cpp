@@ -30,15 +30,23 @@ namespace Aws
       namespace ScalingTypeMapper
       {
 
-        static const int UNIFORM_SCALING_HASH = HashingUtils::HashString("UNIFORM_SCALING");
+        static constexpr int UNIFORM_SCALING_HASH = HashingUtils::CompileTimeHashString("UNIFORM_SCALING");
 
 
         ScalingType GetScalingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNIFORM_SCALING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalingType::UNIFORM_SCALING;
+          case UNIFORM_SCALING_HASH:
+            if (name == "UNIFORM_SCALING")
+            {
+              return ScalingType::UNIFORM_SCALING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ScalingType::NOT_SET;
         }
 
-        Aws::String GetNameForScalingType(ScalingType enumValue)
+        const char* GetNameForScalingType(ScalingType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -38,7 +38,8 @@ namespace ApplicationStatusMapper
 {
 AWS_KINESISANALYTICS_API ApplicationStatus GetApplicationStatusForName(const Aws::String& name);
 
-AWS_KINESISANALYTICS_API Aws::String GetNameForApplicationStatus(ApplicationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISANALYTICS_API const char* GetNameForApplicationStatus(ApplicationStatus value);
 } // namespace ApplicationStatusMapper
 } // namespace Model
 } // namespace KinesisAnalytics
@@ -35,7 +35,8 @@ namespace InputStartingPositionMapper
 {
 AWS_KINESISANALYTICS_API InputStartingPosition GetInputStartingPositionForName(const Aws::String& name);
 
-AWS_KINESISANALYTICS_API Aws::String GetNameForInputStartingPosition(InputStartingPosition value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISANALYTICS_API const char* GetNameForInputStartingPosition(InputStartingPosition value);
 } // namespace InputStartingPositionMapper
 } // namespace Model
 } // namespace KinesisAnalytics
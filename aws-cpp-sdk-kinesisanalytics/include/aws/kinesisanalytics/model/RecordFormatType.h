@@ -34,7 +34,8 @@ namespace RecordFormatTypeMapper
 {
 AWS_KINESISANALYTICS_API RecordFormatType GetRecordFormatTypeForName(const Aws::String& name);
 
-AWS_KINESISANALYTICS_API Aws::String GetNameForRecordFormatType(RecordFormatType value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISANALYTICS_API const char* GetNameForRecordFormatType(RecordFormatType value);
 } // namespace RecordFormatTypeMapper
 } // namespace Model
 } // namespace KinesisAnalytics
@@ -28,14 +28,14 @@ namespace KinesisAnalytics
 namespace KinesisAnalyticsErrorMapper
 {
 
-static const int INVALID_APPLICATION_CONFIGURATION_HASH = HashingUtils::HashString("InvalidApplicationConfigurationException");
-static const int INVALID_ARGUMENT_HASH = HashingUtils::HashString("InvalidArgumentException");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int UNABLE_TO_DETECT_SCHEMA_HASH = HashingUtils::HashString("UnableToDetectSchemaException");
-static const int RESOURCE_PROVISIONED_THROUGHPUT_EXCEEDED_HASH = HashingUtils::HashString("ResourceProvisionedThroughputExceededException");
-static const int CODE_VALIDATION_HASH = HashingUtils::HashString("CodeValidationException");
+static constexpr int INVALID_APPLICATION_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("InvalidApplicationConfigurationException");
+static constexpr int INVALID_ARGUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidArgumentException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int UNABLE_TO_DETECT_SCHEMA_HASH = HashingUtils::CompileTimeHashString("UnableToDetectSchemaException");
+static constexpr int RESOURCE_PROVISIONED_THROUGHPUT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceProvisionedThroughputExceededException");
+static constexpr int CODE_VALIDATION_HASH = HashingUtils::CompileTimeHashString("CodeValidationException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,40 +30,58 @@ namespace Aws
       namespace ApplicationStatusMapper
       {
 
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int STARTING_HASH = HashingUtils::CompileTimeHashString("STARTING");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
+        static constexpr int READY_HASH = HashingUtils::CompileTimeHashString("READY");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
 
 
         ApplicationStatus GetApplicationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DELETING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ApplicationStatus::DELETING;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return ApplicationStatus::STARTING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return ApplicationStatus::STOPPING;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return ApplicationStatus::READY;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ApplicationStatus::RUNNING;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return ApplicationStatus::UPDATING;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ApplicationStatus::DELETING;
+            }
+            break;
+          case STARTING_HASH:
+            if (name == "STARTING")
+            {
+              return ApplicationStatus::STARTING;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return ApplicationStatus::STOPPING;
+            }
+            break;
+          case READY_HASH:
+            if (name == "READY")
+            {
+              return ApplicationStatus::READY;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return ApplicationStatus::RUNNING;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return ApplicationStatus::UPDATING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ApplicationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForApplicationStatus(ApplicationStatus enumValue)
+        const char* GetNameForApplicationStatus(ApplicationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace InputStartingPositionMapper
       {
 
-        static const int NOW_HASH = HashingUtils::HashString("NOW");
-        static const int TRIM_HORIZON_HASH = HashingUtils::HashString("TRIM_HORIZON");
-        static const int LAST_STOPPED_POINT_HASH = HashingUtils::HashString("LAST_STOPPED_POINT");
+        static constexpr int NOW_HASH = HashingUtils::CompileTimeHashString("NOW");
+        static constexpr int TRIM_HORIZON_HASH = HashingUtils::CompileTimeHashString("TRIM_HORIZON");
+        static constexpr int LAST_STOPPED_POINT_HASH = HashingUtils::CompileTimeHashString("LAST_STOPPED_POINT");
 
 
         InputStartingPosition GetInputStartingPositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputStartingPosition::NOW;
-          }
-          else if (hashCode == TRIM_HORIZON_HASH)
-          {
-            return InputStartingPosition::TRIM_HORIZON;
-          }
-          else if (hashCode == LAST_STOPPED_POINT_HASH)
-          {
-            return InputStartingPosition::LAST_STOPPED_POINT;
+          case NOW_HASH:
+            if (name == "NOW")
+            {
+              return InputStartingPosition::NOW;
+            }
+            break;
+          case TRIM_HORIZON_HASH:
+            if (name == "TRIM_HORIZON")
+            {
+              return InputStartingPosition::TRIM_HORIZON;
+            }
+            break;
+          case LAST_STOPPED_POINT_HASH:
+            if (name == "LAST_STOPPED_POINT")
+            {
+              return InputStartingPosition::LAST_STOPPED_POINT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InputStartingPosition::NOT_SET;
         }
 
-        Aws::String GetNameForInputStartingPosition(InputStartingPosition enumValue)
+        const char* GetNameForInputStartingPosition(InputStartingPosition enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -37,7 +37,8 @@ namespace APINameMapper
 {
 AWS_KINESISVIDEO_API APIName GetAPINameForName(const Aws::String& name);
 
-AWS_KINESISVIDEO_API Aws::String GetNameForAPIName(APIName value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISVIDEO_API const char* GetNameForAPIName(APIName value);
 } // namespace APINameMapper
 } // namespace Model
 } // namespace KinesisVideo
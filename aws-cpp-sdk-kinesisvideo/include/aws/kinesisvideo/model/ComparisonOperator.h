@@ -33,7 +33,8 @@ namespace ComparisonOperatorMapper
 {
 AWS_KINESISVIDEO_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
-AWS_KINESISVIDEO_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISVIDEO_API const char* GetNameForComparisonOperator(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace KinesisVideo
@@ -36,7 +36,8 @@ namespace StatusMapper
 {
 AWS_KINESISVIDEO_API Status GetStatusForName(const Aws::String& name);
 
-AWS_KINESISVIDEO_API Aws::String GetNameForStatus(Status value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISVIDEO_API const char* GetNameForStatus(Status value);
 } // namespace StatusMapper
 } // namespace Model
 } // namespace KinesisVideo
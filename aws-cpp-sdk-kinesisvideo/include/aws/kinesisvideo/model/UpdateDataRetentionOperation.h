@@ -34,7 +34,8 @@ namespace UpdateDataRetentionOperationMapper
 {
 AWS_KINESISVIDEO_API UpdateDataRetentionOperation GetUpdateDataRetentionOperationForName(const Aws::String& name);
 
-AWS_KINESISVIDEO_API Aws::String GetNameForUpdateDataRetentionOperation(UpdateDataRetentionOperation value);
+// names of values not modeled point into the enum overflow container
+AWS_KINESISVIDEO_API const char* GetNameForUpdateDataRetentionOperation(UpdateDataRetentionOperation value);
 } // namespace UpdateDataRetentionOperationMapper
 } // namespace Model
 } // namespace KinesisVideo
@@ -28,16 +28,16 @@ namespace KinesisVideo
 namespace KinesisVideoErrorMapper
 {
 
-static const int DEVICE_STREAM_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DeviceStreamLimitExceededException");
-static const int INVALID_ARGUMENT_HASH = HashingUtils::HashString("InvalidArgumentException");
-static const int CLIENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ClientLimitExceededException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int ACCOUNT_STREAM_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AccountStreamLimitExceededException");
-static const int NOT_AUTHORIZED_HASH = HashingUtils::HashString("NotAuthorizedException");
-static const int VERSION_MISMATCH_HASH = HashingUtils::HashString("VersionMismatchException");
-static const int INVALID_DEVICE_HASH = HashingUtils::HashString("InvalidDeviceException");
-static const int TAGS_PER_RESOURCE_EXCEEDED_LIMIT_HASH = HashingUtils::HashString("TagsPerResourceExceededLimitException");
-static const int INVALID_RESOURCE_FORMAT_HASH = HashingUtils::HashString("InvalidResourceFormatException");
+static constexpr int DEVICE_STREAM_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DeviceStreamLimitExceededException");
+static constexpr int INVALID_ARGUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidArgumentException");
+static constexpr int CLIENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ClientLimitExceededException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int ACCOUNT_STREAM_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AccountStreamLimitExceededException");
+static constexpr int NOT_AUTHORIZED_HASH = HashingUtils::CompileTimeHashString("NotAuthorizedException");
+static constexpr int VERSION_MISMATCH_HASH = HashingUtils::CompileTimeHashString("VersionMismatchException");
+static constexpr int INVALID_DEVICE_HASH = HashingUtils::CompileTimeHashString("InvalidDeviceException");
+static constexpr int TAGS_PER_RESOURCE_EXCEEDED_LIMIT_HASH = HashingUtils::CompileTimeHashString("TagsPerResourceExceededLimitException");
+static constexpr int INVALID_RESOURCE_FORMAT_HASH = HashingUtils::CompileTimeHashString("InvalidResourceFormatException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
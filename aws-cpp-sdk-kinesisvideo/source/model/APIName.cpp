@@ -30,35 +30,51 @@ namespace Aws
       namespace APINameMapper
       {
 
-        static const int PUT_MEDIA_HASH = HashingUtils::HashString("PUT_MEDIA");
-        static const int GET_MEDIA_HASH = HashingUtils::HashString("GET_MEDIA");
-        static const int LIST_FRAGMENTS_HASH = HashingUtils::HashString("LIST_FRAGMENTS");
-        static const int GET_MEDIA_FOR_FRAGMENT_LIST_HASH = HashingUtils::HashString("GET_MEDIA_FOR_FRAGMENT_LIST");
-        static const int GET_HLS_STREAMING_SESSION_URL_HASH = HashingUtils::HashString("GET_HLS_STREAMING_SESSION_URL");
+        static constexpr int PUT_MEDIA_HASH = HashingUtils::CompileTimeHashString("PUT_MEDIA");
+        static constexpr int GET_MEDIA_HASH = HashingUtils::CompileTimeHashString("GET_MEDIA");
+        static constexpr int LIST_FRAGMENTS_HASH = HashingUtils::CompileTimeHashString("LIST_FRAGMENTS");
+        static constexpr int GET_MEDIA_FOR_FRAGMENT_LIST_HASH = HashingUtils::CompileTimeHashString("GET_MEDIA_FOR_FRAGMENT_LIST");
+        static constexpr int GET_HLS_STREAMING_SESSION_URL_HASH = HashingUtils::CompileTimeHashString("GET_HLS_STREAMING_SESSION_URL");
 
 
         APIName GetAPINameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUT_MEDIA_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return APIName::PUT_MEDIA;
-          }
-          else if (hashCode == GET_MEDIA_HASH)
-          {
-            return APIName::GET_MEDIA;
-          }
-          else if (hashCode == LIST_FRAGMENTS_HASH)
-          {
-            return APIName::LIST_FRAGMENTS;
-          }
-          else if (hashCode == GET_MEDIA_FOR_FRAGMENT_LIST_HASH)
-          {
-            return APIName::GET_MEDIA_FOR_FRAGMENT_LIST;
-          }
-          else if (hashCode == GET_HLS_STREAMING_SESSION_URL_HASH)
-          {
-            return APIName::GET_HLS_STREAMING_SESSION_URL;
+          case PUT_MEDIA_HASH:
+            if (name == "PUT_MEDIA")
+            {
+              return APIName::PUT_MEDIA;
+            }
+            break;
+          case GET_MEDIA_HASH:
+            if (name == "GET_MEDIA")
+            {
+              return APIName::GET_MEDIA;
+            }
+            break;
+          case LIST_FRAGMENTS_HASH:
+            if (name == "LIST_FRAGMENTS")
+            {
+              return APIName::LIST_FRAGMENTS;
+            }
+            break;
+          case GET_MEDIA_FOR_FRAGMENT_LIST_HASH:
+            if (name == "GET_MEDIA_FOR_FRAGMENT_LIST")
+            {
+              return APIName::GET_MEDIA_FOR_FRAGMENT_LIST;
+            }
+            break;
+          case GET_HLS_STREAMING_SESSION_URL_HASH:
+            if (name == "GET_HLS_STREAMING_SESSION_URL")
+            {
+              return APIName::GET_HLS_STREAMING_SESSION_URL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return APIName::NOT_SET;
         }
 
-        Aws::String GetNameForAPIName(APIName enumValue)
+        const char* GetNameForAPIName(APIName enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int BEGINS_WITH_HASH = HashingUtils::HashString("BEGINS_WITH");
+        static constexpr int BEGINS_WITH_HASH = HashingUtils::CompileTimeHashString("BEGINS_WITH");
 
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BEGINS_WITH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComparisonOperator::BEGINS_WITH;
+          case BEGINS_WITH_HASH:
+            if (name == "BEGINS_WITH")
+            {
+              return ComparisonOperator::BEGINS_WITH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperator(ComparisonOperator enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace UpdateDataRetentionOperationMapper
       {
 
-        static const int INCREASE_DATA_RETENTION_HASH = HashingUtils::HashString("INCREASE_DATA_RETENTION");
-        static const int DECREASE_DATA_RETENTION_HASH = HashingUtils::HashString("DECREASE_DATA_RETENTION");
+        static constexpr int INCREASE_DATA_RETENTION_HASH = HashingUtils::CompileTimeHashString("INCREASE_DATA_RETENTION");
+        static constexpr int DECREASE_DATA_RETENTION_HASH = HashingUtils::CompileTimeHashString("DECREASE_DATA_RETENTION");
 
 
         UpdateDataRetentionOperation GetUpdateDataRetentionOperationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INCREASE_DATA_RETENTION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UpdateDataRetentionOperation::INCREASE_DATA_RETENTION;
-          }
-          else if (hashCode == DECREASE_DATA_RETENTION_HASH)
-          {
-            return UpdateDataRetentionOperation::DECREASE_DATA_RETENTION;
+          case INCREASE_DATA_RETENTION_HASH:
+            if (name == "INCREASE_DATA_RETENTION")
+            {
+              return UpdateDataRetentionOperation::INCREASE_DATA_RETENTION;
+            }
+            break;
+          case DECREASE_DATA_RETENTION_HASH:
+            if (name == "DECREASE_DATA_RETENTION")
+            {
+              return UpdateDataRetentionOperation::DECREASE_DATA_RETENTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return UpdateDataRetentionOperation::NOT_SET;
         }
 
-        Aws::String GetNameForUpdateDataRetentionOperation(UpdateDataRetentionOperation enumValue)
+        const char* GetNameForUpdateDataRetentionOperation(UpdateDataRetentionOperation enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
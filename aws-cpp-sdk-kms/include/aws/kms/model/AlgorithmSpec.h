@@ -35,7 +35,8 @@ namespace AlgorithmSpecMapper
 {
 AWS_KMS_API AlgorithmSpec GetAlgorithmSpecForName(const Aws::String& name);
 
-AWS_KMS_API Aws::String GetNameForAlgorithmSpec(AlgorithmSpec value);
+// names of values not modeled point into the enum overflow container
+AWS_KMS_API const char* GetNameForAlgorithmSpec(AlgorithmSpec value);
 } // namespace AlgorithmSpecMapper
 } // namespace Model
 } // namespace KMS
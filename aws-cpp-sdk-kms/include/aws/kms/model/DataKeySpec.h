@@ -34,7 +34,8 @@ namespace DataKeySpecMapper
 {
 AWS_KMS_API DataKeySpec GetDataKeySpecForName(const Aws::String& name);
 
-AWS_KMS_API Aws::String GetNameForDataKeySpec(DataKeySpec value);
+// names of values not modeled point into the enum overflow container
+AWS_KMS_API const char* GetNameForDataKeySpec(DataKeySpec value);
 } // namespace DataKeySpecMapper
 } // namespace Model
 } // namespace KMS
@@ -34,7 +34,8 @@ namespace ExpirationModelTypeMapper
 {
 AWS_KMS_API ExpirationModelType GetExpirationModelTypeForName(const Aws::String& name);
 
-AWS_KMS_API Aws::String GetNameForExpirationModelType(ExpirationModelType value);
+// names of values not modeled point into the enum overflow container
+AWS_KMS_API const char* GetNameForExpirationModelType(ExpirationModelType value);
 } // namespace ExpirationModelTypeMapper
 } // namespace Model
 } // namespace KMS
@@ -41,7 +41,8 @@ namespace GrantOperationMapper
 {
 AWS_KMS_API GrantOperation GetGrantOperationForName(const Aws::String& name);
 
-AWS_KMS_API Aws::String GetNameForGrantOperation(GrantOperation value);
+// names of values not modeled point into the enum overflow container
+AWS_KMS_API const char* GetNameForGrantOperation(GrantOperation value);
 } // namespace GrantOperationMapper
 } // namespace Model
 } // namespace KMS
@@ -34,7 +34,8 @@ namespace KeyManagerTypeMapper
 {
 AWS_KMS_API KeyManagerType GetKeyManagerTypeForName(const Aws::String& name);
 
-AWS_KMS_API Aws::String GetNameForKeyManagerType(KeyManagerType value);
+// names of values not modeled point into the enum overflow container
+AWS_KMS_API const char* GetNameForKeyManagerType(KeyManagerType value);
 } // namespace KeyManagerTypeMapper
 } // namespace Model
 } // namespace KMS
@@ -36,7 +36,8 @@ namespace KeyStateMapper
 {
 AWS_KMS_API KeyState GetKeyStateForName(const Aws::String& name);
 
-AWS_KMS_API Aws::String GetNameForKeyState(KeyState value);
+// names of values not modeled point into the enum overflow container
+AWS_KMS_API const char* GetNameForKeyState(KeyState value);
 } // namespace KeyStateMapper
 } // namespace Model
 } // namespace KMS
@@ -33,7 +33,8 @@ namespace KeyUsageTypeMapper
 {
 AWS_KMS_API KeyUsageType GetKeyUsageTypeForName(const Aws::String& name);
 
-AWS_KMS_API Aws::String GetNameForKeyUsageType(KeyUsageType value);
+// names of values not modeled point into the enum overflow container
+AWS_KMS_API const char* GetNameForKeyUsageType(KeyUsageType value);
 } // namespace KeyUsageTypeMapper
 } // namespace Model
 } // namespace KMS
@@ -34,7 +34,8 @@ namespace OriginTypeMapper
 {
 AWS_KMS_API OriginType GetOriginTypeForName(const Aws::String& name);
 
-AWS_KMS_API Aws::String GetNameForOriginType(OriginType value);
+// names of values not modeled point into the enum overflow container
+AWS_KMS_API const char* GetNameForOriginType(OriginType value);
 } // namespace OriginTypeMapper
 } // namespace Model
 } // namespace KMS
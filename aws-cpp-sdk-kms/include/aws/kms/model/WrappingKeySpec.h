@@ -33,7 +33,8 @@ namespace WrappingKeySpecMapper
 {
 AWS_KMS_API WrappingKeySpec GetWrappingKeySpecForName(const Aws::String& name);
 
-AWS_KMS_API Aws::String GetNameForWrappingKeySpec(WrappingKeySpec value);
+// names of values not modeled point into the enum overflow container
+AWS_KMS_API const char* GetNameForWrappingKeySpec(WrappingKeySpec value);
 } // namespace WrappingKeySpecMapper
 } // namespace Model
 } // namespace KMS
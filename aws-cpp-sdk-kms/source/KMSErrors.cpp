@@ -28,27 +28,27 @@ namespace KMS
 namespace KMSErrorMapper
 {
 
-static const int INVALID_KEY_USAGE_HASH = HashingUtils::HashString("InvalidKeyUsageException");
-static const int ALREADY_EXISTS_HASH = HashingUtils::HashString("AlreadyExistsException");
-static const int DISABLED_HASH = HashingUtils::HashString("DisabledException");
-static const int INVALID_GRANT_ID_HASH = HashingUtils::HashString("InvalidGrantIdException");
-static const int DEPENDENCY_TIMEOUT_HASH = HashingUtils::HashString("DependencyTimeoutException");
-static const int INVALID_GRANT_TOKEN_HASH = HashingUtils::HashString("InvalidGrantTokenException");
-static const int K_M_S_INTERNAL_HASH = HashingUtils::HashString("KMSInternalException");
-static const int KEY_UNAVAILABLE_HASH = HashingUtils::HashString("KeyUnavailableException");
-static const int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::HashString("MalformedPolicyDocumentException");
-static const int TAG_HASH = HashingUtils::HashString("TagException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int INVALID_ARN_HASH = HashingUtils::HashString("InvalidArnException");
-static const int K_M_S_INVALID_STATE_HASH = HashingUtils::HashString("KMSInvalidStateException");
-static const int INCORRECT_KEY_MATERIAL_HASH = HashingUtils::HashString("IncorrectKeyMaterialException");
-static const int INVALID_MARKER_HASH = HashingUtils::HashString("InvalidMarkerException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int EXPIRED_IMPORT_TOKEN_HASH = HashingUtils::HashString("ExpiredImportTokenException");
-static const int INVALID_CIPHERTEXT_HASH = HashingUtils::HashString("InvalidCiphertextException");
-static const int INVALID_ALIAS_NAME_HASH = HashingUtils::HashString("InvalidAliasNameException");
-static const int UNSUPPORTED_OPERATION_HASH = HashingUtils::HashString("UnsupportedOperationException");
-static const int INVALID_IMPORT_TOKEN_HASH = HashingUtils::HashString("InvalidImportTokenException");
+static constexpr int INVALID_KEY_USAGE_HASH = HashingUtils::CompileTimeHashString("InvalidKeyUsageException");
+static constexpr int ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("AlreadyExistsException");
+static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DisabledException");
+static constexpr int INVALID_GRANT_ID_HASH = HashingUtils::CompileTimeHashString("InvalidGrantIdException");
+static constexpr int DEPENDENCY_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("DependencyTimeoutException");
+static constexpr int INVALID_GRANT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidGrantTokenException");
+static constexpr int K_M_S_INTERNAL_HASH = HashingUtils::CompileTimeHashString("KMSInternalException");
+static constexpr int KEY_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("KeyUnavailableException");
+static constexpr int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::CompileTimeHashString("MalformedPolicyDocumentException");
+static constexpr int TAG_HASH = HashingUtils::CompileTimeHashString("TagException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int INVALID_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidArnException");
+static constexpr int K_M_S_INVALID_STATE_HASH = HashingUtils::CompileTimeHashString("KMSInvalidStateException");
+static constexpr int INCORRECT_KEY_MATERIAL_HASH = HashingUtils::CompileTimeHashString("IncorrectKeyMaterialException");
+static constexpr int INVALID_MARKER_HASH = HashingUtils::CompileTimeHashString("InvalidMarkerException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int EXPIRED_IMPORT_TOKEN_HASH = HashingUtils::CompileTimeHashString("ExpiredImportTokenException");
+static constexpr int INVALID_CIPHERTEXT_HASH = HashingUtils::CompileTimeHashString("InvalidCiphertextException");
+static constexpr int INVALID_ALIAS_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidAliasNameException");
+static constexpr int UNSUPPORTED_OPERATION_HASH = HashingUtils::CompileTimeHashString("UnsupportedOperationException");
+static constexpr int INVALID_IMPORT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidImportTokenException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace AlgorithmSpecMapper
       {
 
-        static const int RSAES_PKCS1_V1_5_HASH = HashingUtils::HashString("RSAES_PKCS1_V1_5");
-        static const int RSAES_OAEP_SHA_1_HASH = HashingUtils::HashString("RSAES_OAEP_SHA_1");
-        static const int RSAES_OAEP_SHA_256_HASH = HashingUtils::HashString("RSAES_OAEP_SHA_256");
+        static constexpr int RSAES_PKCS1_V1_5_HASH = HashingUtils::CompileTimeHashString("RSAES_PKCS1_V1_5");
+        static constexpr int RSAES_OAEP_SHA_1_HASH = HashingUtils::CompileTimeHashString("RSAES_OAEP_SHA_1");
+        static constexpr int RSAES_OAEP_SHA_256_HASH = HashingUtils::CompileTimeHashString("RSAES_OAEP_SHA_256");
 
 
         AlgorithmSpec GetAlgorithmSpecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSAES_PKCS1_V1_5_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AlgorithmSpec::RSAES_PKCS1_V1_5;
-          }
-          else if (hashCode == RSAES_OAEP_SHA_1_HASH)
-          {
-            return AlgorithmSpec::RSAES_OAEP_SHA_1;
-          }
-          else if (hashCode == RSAES_OAEP_SHA_256_HASH)
-          {
-            return AlgorithmSpec::RSAES_OAEP_SHA_256;
+          case RSAES_PKCS1_V1_5_HASH:
+            if (name == "RSAES_PKCS1_V1_5")
+            {
+              return AlgorithmSpec::RSAES_PKCS1_V1_5;
+            }
+            break;
+          case RSAES_OAEP_SHA_1_HASH:
+            if (name == "RSAES_OAEP_SHA_1")
+            {
+              return AlgorithmSpec::RSAES_OAEP_SHA_1;
+            }
+            break;
+          case RSAES_OAEP_SHA_256_HASH:
+            if (name == "RSAES_OAEP_SHA_256")
+            {
+              return AlgorithmSpec::RSAES_OAEP_SHA_256;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AlgorithmSpec::NOT_SET;
         }
 
-        Aws::String GetNameForAlgorithmSpec(AlgorithmSpec enumValue)
+        const char* GetNameForAlgorithmSpec(AlgorithmSpec enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DataKeySpecMapper
       {
 
-        static const int AES_256_HASH = HashingUtils::HashString("AES_256");
-        static const int AES_128_HASH = HashingUtils::HashString("AES_128");
+        static constexpr int AES_256_HASH = HashingUtils::CompileTimeHashString("AES_256");
+        static constexpr int AES_128_HASH = HashingUtils::CompileTimeHashString("AES_128");
 
 
         DataKeySpec GetDataKeySpecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES_256_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DataKeySpec::AES_256;
-          }
-          else if (hashCode == AES_128_HASH)
-          {
-            return DataKeySpec::AES_128;
+          case AES_256_HASH:
+            if (name == "AES_256")
+            {
+              return DataKeySpec::AES_256;
+            }
+            break;
+          case AES_128_HASH:
+            if (name == "AES_128")
+            {
+              return DataKeySpec::AES_128;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DataKeySpec::NOT_SET;
         }
 
-        Aws::String GetNameForDataKeySpec(DataKeySpec enumValue)
+        const char* GetNameForDataKeySpec(DataKeySpec enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ExpirationModelTypeMapper
       {
 
-        static const int KEY_MATERIAL_EXPIRES_HASH = HashingUtils::HashString("KEY_MATERIAL_EXPIRES");
-        static const int KEY_MATERIAL_DOES_NOT_EXPIRE_HASH = HashingUtils::HashString("KEY_MATERIAL_DOES_NOT_EXPIRE");
+        static constexpr int KEY_MATERIAL_EXPIRES_HASH = HashingUtils::CompileTimeHashString("KEY_MATERIAL_EXPIRES");
+        static constexpr int KEY_MATERIAL_DOES_NOT_EXPIRE_HASH = HashingUtils::CompileTimeHashString("KEY_MATERIAL_DOES_NOT_EXPIRE");
 
 
         ExpirationModelType GetExpirationModelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == KEY_MATERIAL_EXPIRES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExpirationModelType::KEY_MATERIAL_EXPIRES;
-          }
-          else if (hashCode == KEY_MATERIAL_DOES_NOT_EXPIRE_HASH)
-          {
-            return ExpirationModelType::KEY_MATERIAL_DOES_NOT_EXPIRE;
+          case KEY_MATERIAL_EXPIRES_HASH:
+            if (name == "KEY_MATERIAL_EXPIRES")
+            {
+              return ExpirationModelType::KEY_MATERIAL_EXPIRES;
+            }
+            break;
+          case KEY_MATERIAL_DOES_NOT_EXPIRE_HASH:
+            if (name == "KEY_MATERIAL_DOES_NOT_EXPIRE")
+            {
+              return ExpirationModelType::KEY_MATERIAL_DOES_NOT_EXPIRE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ExpirationModelType::NOT_SET;
         }
 
-        Aws::String GetNameForExpirationModelType(ExpirationModelType enumValue)
+        const char* GetNameForExpirationModelType(ExpirationModelType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,55 +30,79 @@ namespace Aws
       namespace GrantOperationMapper
       {
 
-        static const int Decrypt_HASH = HashingUtils::HashString("Decrypt");
-        static const int Encrypt_HASH = HashingUtils::HashString("Encrypt");
-        static const int GenerateDataKey_HASH = HashingUtils::HashString("GenerateDataKey");
-        static const int GenerateDataKeyWithoutPlaintext_HASH = HashingUtils::HashString("GenerateDataKeyWithoutPlaintext");
-        static const int ReEncryptFrom_HASH = HashingUtils::HashString("ReEncryptFrom");
-        static const int ReEncryptTo_HASH = HashingUtils::HashString("ReEncryptTo");
-        static const int CreateGrant_HASH = HashingUtils::HashString("CreateGrant");
-        static const int RetireGrant_HASH = HashingUtils::HashString("RetireGrant");
-        static const int DescribeKey_HASH = HashingUtils::HashString("DescribeKey");
+        static constexpr int Decrypt_HASH = HashingUtils::CompileTimeHashString("Decrypt");
+        static constexpr int Encrypt_HASH = HashingUtils::CompileTimeHashString("Encrypt");
+        static constexpr int GenerateDataKey_HASH = HashingUtils::CompileTimeHashString("GenerateDataKey");
+        static constexpr int GenerateDataKeyWithoutPlaintext_HASH = HashingUtils::CompileTimeHashString("GenerateDataKeyWithoutPlaintext");
+        static constexpr int ReEncryptFrom_HASH = HashingUtils::CompileTimeHashString("ReEncryptFrom");
+        static constexpr int ReEncryptTo_HASH = HashingUtils::CompileTimeHashString("ReEncryptTo");
+        static constexpr int CreateGrant_HASH = HashingUtils::CompileTimeHashString("CreateGrant");
+        static constexpr int RetireGrant_HASH = HashingUtils::CompileTimeHashString("RetireGrant");
+        static constexpr int DescribeKey_HASH = HashingUtils::CompileTimeHashString("DescribeKey");
 
 
         GrantOperation GetGrantOperationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Decrypt_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GrantOperation::Decrypt;
-          }
-          else if (hashCode == Encrypt_HASH)
-          {
-            return GrantOperation::Encrypt;
-          }
-          else if (hashCode == GenerateDataKey_HASH)
-          {
-            return GrantOperation::GenerateDataKey;
-          }
-          else if (hashCode == GenerateDataKeyWithoutPlaintext_HASH)
-          {
-            return GrantOperation::GenerateDataKeyWithoutPlaintext;
-          }
-          else if (hashCode == ReEncryptFrom_HASH)
-          {
-            return GrantOperation::ReEncryptFrom;
-          }
-          else if (hashCode == ReEncryptTo_HASH)
-          {
-            return GrantOperation::ReEncryptTo;
-          }
-          else if (hashCode == CreateGrant_HASH)
-          {
-            return GrantOperation::CreateGrant;
-          }
-          else if (hashCode == RetireGrant_HASH)
-          {
-            return GrantOperation::RetireGrant;
-          }
-          else if (hashCode == DescribeKey_HASH)
-          {
-            return GrantOperation::DescribeKey;
+          case Decrypt_HASH:
+            if (name == "Decrypt")
+            {
+              return GrantOperation::Decrypt;
+            }
+            break;
+          case Encrypt_HASH:
+            if (name == "Encrypt")
+            {
+              return GrantOperation::Encrypt;
+            }
+            break;
+          case GenerateDataKey_HASH:
+            if (name == "GenerateDataKey")
+            {
+              return GrantOperation::GenerateDataKey;
+            }
+            break;
+          case GenerateDataKeyWithoutPlaintext_HASH:
+            if (name == "GenerateDataKeyWithoutPlaintext")
+            {
+              return GrantOperation::GenerateDataKeyWithoutPlaintext;
+            }
+            break;
+          case ReEncryptFrom_HASH:
+            if (name == "ReEncryptFrom")
+            {
+              return GrantOperation::ReEncryptFrom;
+            }
+            break;
+          case ReEncryptTo_HASH:
+            if (name == "ReEncryptTo")
+            {
+              return GrantOperation::ReEncryptTo;
+            }
+            break;
+          case CreateGrant_HASH:
+            if (name == "CreateGrant")
+            {
+              return GrantOperation::CreateGrant;
+            }
+            break;
+          case RetireGrant_HASH:
+            if (name == "RetireGrant")
+            {
+              return GrantOperation::RetireGrant;
+            }
+            break;
+          case DescribeKey_HASH:
+            if (name == "DescribeKey")
+            {
+              return GrantOperation::DescribeKey;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return GrantOperation::NOT_SET;
         }
 
-        Aws::String GetNameForGrantOperation(GrantOperation enumValue)
+        const char* GetNameForGrantOperation(GrantOperation enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace KeyManagerTypeMapper
       {
 
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int CUSTOMER_HASH = HashingUtils::HashString("CUSTOMER");
+        static constexpr int AWS_HASH = HashingUtils::CompileTimeHashString("AWS");
+        static constexpr int CUSTOMER_HASH = HashingUtils::CompileTimeHashString("CUSTOMER");
 
 
         KeyManagerType GetKeyManagerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return KeyManagerType::AWS;
-          }
-          else if (hashCode == CUSTOMER_HASH)
-          {
-            return KeyManagerType::CUSTOMER;
+          case AWS_HASH:
+            if (name == "AWS")
+            {
+              return KeyManagerType::AWS;
+            }
+            break;
+          case CUSTOMER_HASH:
+            if (name == "CUSTOMER")
+            {
+              return KeyManagerType::CUSTOMER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return KeyManagerType::NOT_SET;
         }
 
-        Aws::String GetNameForKeyManagerType(KeyManagerType enumValue)
+        const char* GetNameForKeyManagerType(KeyManagerType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
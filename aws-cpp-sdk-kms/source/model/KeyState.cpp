@@ -30,30 +30,44 @@ namespace Aws
       namespace KeyStateMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Disabled_HASH = HashingUtils::HashString("Disabled");
-        static const int PendingDeletion_HASH = HashingUtils::HashString("PendingDeletion");
-        static const int PendingImport_HASH = HashingUtils::HashString("PendingImport");
+        static constexpr int Enabled_HASH = HashingUtils::CompileTimeHashString("Enabled");
+        static constexpr int Disabled_HASH = HashingUtils::CompileTimeHashString("Disabled");
+        static constexpr int PendingDeletion_HASH = HashingUtils::CompileTimeHashString("PendingDeletion");
+        static constexpr int PendingImport_HASH = HashingUtils::CompileTimeHashString("PendingImport");
 
 
         KeyState GetKeyStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return KeyState::Enabled;
-          }
-          else if (hashCode == Disabled_HASH)
-          {
-            return KeyState::Disabled;
-          }
-          else if (hashCode == PendingDeletion_HASH)
-          {
-            return KeyState::PendingDeletion;
-          }
-          else if (hashCode == PendingImport_HASH)
-          {
-            return KeyState::PendingImport;
+          case Enabled_HASH:
+            if (name == "Enabled")
+            {
+              return KeyState::Enabled;
+            }
+            break;
+          case Disabled_HASH:
+            if (name == "Disabled")
+            {
+              return KeyState::Disabled;
+            }
+            break;
+          case PendingDeletion_HASH:
+            if (name == "PendingDeletion")
+            {
+              return KeyState::PendingDeletion;
+            }
+            break;
+          case PendingImport_HASH:
+            if (name == "PendingImport")
+            {
+              return KeyState::PendingImport;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return KeyState::NOT_SET;
         }
 
-        Aws::String GetNameForKeyState(KeyState enumValue)
+        const char* GetNameForKeyState(KeyState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
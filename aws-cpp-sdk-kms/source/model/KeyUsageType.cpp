@@ -30,15 +30,23 @@ namespace Aws
       namespace KeyUsageTypeMapper
       {
 
-        static const int ENCRYPT_DECRYPT_HASH = HashingUtils::HashString("ENCRYPT_DECRYPT");
+        static constexpr int ENCRYPT_DECRYPT_HASH = HashingUtils::CompileTimeHashString("ENCRYPT_DECRYPT");
 
 
         KeyUsageType GetKeyUsageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENCRYPT_DECRYPT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return KeyUsageType::ENCRYPT_DECRYPT;
+          case ENCRYPT_DECRYPT_HASH:
+            if (name == "ENCRYPT_DECRYPT")
+            {
+              return KeyUsageType::ENCRYPT_DECRYPT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return KeyUsageType::NOT_SET;
         }
 
-        Aws::String GetNameForKeyUsageType(KeyUsageType enumValue)
+        const char* GetNameForKeyUsageType(KeyUsageType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace OriginTypeMapper
       {
 
-        static const int AWS_KMS_HASH = HashingUtils::HashString("AWS_KMS");
-        static const int EXTERNAL_HASH = HashingUtils::HashString("EXTERNAL");
+        static constexpr int AWS_KMS_HASH = HashingUtils::CompileTimeHashString("AWS_KMS");
+        static constexpr int EXTERNAL_HASH = HashingUtils::CompileTimeHashString("EXTERNAL");
 
 
         OriginType GetOriginTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_KMS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OriginType::AWS_KMS;
-          }
-          else if (hashCode == EXTERNAL_HASH)
-          {
-            return OriginType::EXTERNAL;
+          case AWS_KMS_HASH:
+            if (name == "AWS_KMS")
+            {
+              return OriginType::AWS_KMS;
+            }
+            break;
+          case EXTERNAL_HASH:
+            if (name == "EXTERNAL")
+            {
+              return OriginType::EXTERNAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OriginType::NOT_SET;
         }
 
-        Aws::String GetNameForOriginType(OriginType enumValue)
+        const char* GetNameForOriginType(OriginType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
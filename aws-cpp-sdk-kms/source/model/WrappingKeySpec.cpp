@@ -30,15 +30,23 @@ namespace Aws
       namespace WrappingKeySpecMapper
       {
 
-        static const int RSA_2048_HASH = HashingUtils::HashString("RSA_2048");
+        static constexpr int RSA_2048_HASH = HashingUtils::CompileTimeHashString("RSA_2048");
 
 
         WrappingKeySpec GetWrappingKeySpecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RSA_2048_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WrappingKeySpec::RSA_2048;
+          case RSA_2048_HASH:
+            if (name == "RSA_2048")
+            {
+              return WrappingKeySpec::RSA_2048;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return WrappingKeySpec::NOT_SET;
         }
 
-        Aws::String GetNameForWrappingKeySpec(WrappingKeySpec enumValue)
+        const char* GetNameForWrappingKeySpec(WrappingKeySpec enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
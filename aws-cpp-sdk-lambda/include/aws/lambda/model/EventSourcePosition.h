@@ -35,7 +35,8 @@ namespace EventSourcePositionMapper
 {
 AWS_LAMBDA_API EventSourcePosition GetEventSourcePositionForName(const Aws::String& name);
 
-AWS_LAMBDA_API Aws::String GetNameForEventSourcePosition(EventSourcePosition value);
+// names of values not modeled point into the enum overflow container
+AWS_LAMBDA_API const char* GetNameForEventSourcePosition(EventSourcePosition value);
 } // namespace EventSourcePositionMapper
 } // namespace Model
 } // namespace Lambda
@@ -33,7 +33,8 @@ namespace FunctionVersionMapper
 {
 AWS_LAMBDA_API FunctionVersion GetFunctionVersionForName(const Aws::String& name);
 
-AWS_LAMBDA_API Aws::String GetNameForFunctionVersion(FunctionVersion value);
+// names of values not modeled point into the enum overflow container
+AWS_LAMBDA_API const char* GetNameForFunctionVersion(FunctionVersion value);
 } // namespace FunctionVersionMapper
 } // namespace Model
 } // namespace Lambda
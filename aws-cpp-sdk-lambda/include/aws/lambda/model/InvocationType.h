@@ -35,7 +35,8 @@ namespace InvocationTypeMapper
 {
 AWS_LAMBDA_API InvocationType GetInvocationTypeForName(const Aws::String& name);
 
-AWS_LAMBDA_API Aws::String GetNameForInvocationType(InvocationType value);
+// names of values not modeled point into the enum overflow container
+AWS_LAMBDA_API const char* GetNameForInvocationType(InvocationType value);
 } // namespace InvocationTypeMapper
 } // namespace Model
 } // namespace Lambda
@@ -34,7 +34,8 @@ namespace LogTypeMapper
 {
 AWS_LAMBDA_API LogType GetLogTypeForName(const Aws::String& name);
 
-AWS_LAMBDA_API Aws::String GetNameForLogType(LogType value);
+// names of values not modeled point into the enum overflow container
+AWS_LAMBDA_API const char* GetNameForLogType(LogType value);
 } // namespace LogTypeMapper
 } // namespace Model
 } // namespace Lambda
@@ -44,7 +44,8 @@ namespace RuntimeMapper
 {
 AWS_LAMBDA_API Runtime GetRuntimeForName(const Aws::String& name);
 
-AWS_LAMBDA_API Aws::String GetNameForRuntime(Runtime value);
+// names of values not modeled point into the enum overflow container
+AWS_LAMBDA_API const char* GetNameForRuntime(Runtime value);
 } // namespace RuntimeMapper
 } // namespace Model
 } // namespace Lambda
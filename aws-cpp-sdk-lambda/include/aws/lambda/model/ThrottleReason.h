@@ -37,7 +37,8 @@ namespace ThrottleReasonMapper
 {
 AWS_LAMBDA_API ThrottleReason GetThrottleReasonForName(const Aws::String& name);
 
-AWS_LAMBDA_API Aws::String GetNameForThrottleReason(ThrottleReason value);
+// names of values not modeled point into the enum overflow container
+AWS_LAMBDA_API const char* GetNameForThrottleReason(ThrottleReason value);
 } // namespace ThrottleReasonMapper
 } // namespace Model
 } // namespace Lambda
@@ -34,7 +34,8 @@ namespace TracingModeMapper
 {
 AWS_LAMBDA_API TracingMode GetTracingModeForName(const Aws::String& name);
 
-AWS_LAMBDA_API Aws::String GetNameForTracingMode(TracingMode value);
+// names of values not modeled point into the enum overflow container
+AWS_LAMBDA_API const char* GetNameForTracingMode(TracingMode value);
 } // namespace TracingModeMapper
 } // namespace Model
 } // namespace Lambda
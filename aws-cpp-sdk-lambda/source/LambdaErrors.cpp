@@ -28,29 +28,29 @@ namespace Lambda
 namespace LambdaErrorMapper
 {
 
-static const int E_C2_UNEXPECTED_HASH = HashingUtils::HashString("EC2UnexpectedException");
-static const int POLICY_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("PolicyLengthExceededException");
-static const int K_M_S_DISABLED_HASH = HashingUtils::HashString("KMSDisabledException");
-static const int INVALID_RUNTIME_HASH = HashingUtils::HashString("InvalidRuntimeException");
-static const int INVALID_SECURITY_GROUP_I_D_HASH = HashingUtils::HashString("InvalidSecurityGroupIDException");
-static const int E_C2_ACCESS_DENIED_HASH = HashingUtils::HashString("EC2AccessDeniedException");
-static const int INVALID_SUBNET_I_D_HASH = HashingUtils::HashString("InvalidSubnetIDException");
-static const int REQUEST_TOO_LARGE_HASH = HashingUtils::HashString("RequestTooLargeException");
-static const int K_M_S_ACCESS_DENIED_HASH = HashingUtils::HashString("KMSAccessDeniedException");
-static const int K_M_S_NOT_FOUND_HASH = HashingUtils::HashString("KMSNotFoundException");
-static const int RESOURCE_CONFLICT_HASH = HashingUtils::HashString("ResourceConflictException");
-static const int E_N_I_LIMIT_REACHED_HASH = HashingUtils::HashString("ENILimitReachedException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int SERVICE_HASH = HashingUtils::HashString("ServiceException");
-static const int UNSUPPORTED_MEDIA_TYPE_HASH = HashingUtils::HashString("UnsupportedMediaTypeException");
-static const int E_C2_THROTTLED_HASH = HashingUtils::HashString("EC2ThrottledException");
-static const int K_M_S_INVALID_STATE_HASH = HashingUtils::HashString("KMSInvalidStateException");
-static const int PRECONDITION_FAILED_HASH = HashingUtils::HashString("PreconditionFailedException");
-static const int INVALID_REQUEST_CONTENT_HASH = HashingUtils::HashString("InvalidRequestContentException");
-static const int CODE_STORAGE_EXCEEDED_HASH = HashingUtils::HashString("CodeStorageExceededException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
-static const int INVALID_ZIP_FILE_HASH = HashingUtils::HashString("InvalidZipFileException");
-static const int SUBNET_I_P_ADDRESS_LIMIT_REACHED_HASH = HashingUtils::HashString("SubnetIPAddressLimitReachedException");
+static constexpr int E_C2_UNEXPECTED_HASH = HashingUtils::CompileTimeHashString("EC2UnexpectedException");
+static constexpr int POLICY_LENGTH_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("PolicyLengthExceededException");
+static constexpr int K_M_S_DISABLED_HASH = HashingUtils::CompileTimeHashString("KMSDisabledException");
+static constexpr int INVALID_RUNTIME_HASH = HashingUtils::CompileTimeHashString("InvalidRuntimeException");
+static constexpr int INVALID_SECURITY_GROUP_I_D_HASH = HashingUtils::CompileTimeHashString("InvalidSecurityGroupIDException");
+static constexpr int E_C2_ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("EC2AccessDeniedException");
+static constexpr int INVALID_SUBNET_I_D_HASH = HashingUtils::CompileTimeHashString("InvalidSubnetIDException");
+static constexpr int REQUEST_TOO_LARGE_HASH = HashingUtils::CompileTimeHashString("RequestTooLargeException");
+static constexpr int K_M_S_ACCESS_DENIED_HASH = HashingUtils::CompileTimeHashString("KMSAccessDeniedException");
+static constexpr int K_M_S_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("KMSNotFoundException");
+static constexpr int RESOURCE_CONFLICT_HASH = HashingUtils::CompileTimeHashString("ResourceConflictException");
+static constexpr int E_N_I_LIMIT_REACHED_HASH = HashingUtils::CompileTimeHashString("ENILimitReachedException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int SERVICE_HASH = HashingUtils::CompileTimeHashString("ServiceException");
+static constexpr int UNSUPPORTED_MEDIA_TYPE_HASH = HashingUtils::CompileTimeHashString("UnsupportedMediaTypeException");
+static constexpr int E_C2_THROTTLED_HASH = HashingUtils::CompileTimeHashString("EC2ThrottledException");
+static constexpr int K_M_S_INVALID_STATE_HASH = HashingUtils::CompileTimeHashString("KMSInvalidStateException");
+static constexpr int PRECONDITION_FAILED_HASH = HashingUtils::CompileTimeHashString("PreconditionFailedException");
+static constexpr int INVALID_REQUEST_CONTENT_HASH = HashingUtils::CompileTimeHashString("InvalidRequestContentException");
+static constexpr int CODE_STORAGE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CodeStorageExceededException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
+static constexpr int INVALID_ZIP_FILE_HASH = HashingUtils::CompileTimeHashString("InvalidZipFileException");
+static constexpr int SUBNET_I_P_ADDRESS_LIMIT_REACHED_HASH = HashingUtils::CompileTimeHashString("SubnetIPAddressLimitReachedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace EventSourcePositionMapper
       {
 
-        static const int TRIM_HORIZON_HASH = HashingUtils::HashString("TRIM_HORIZON");
-        static const int LATEST_HASH = HashingUtils::HashString("LATEST");
-        static const int AT_TIMESTAMP_HASH = HashingUtils::HashString("AT_TIMESTAMP");
+        static constexpr int TRIM_HORIZON_HASH = HashingUtils::CompileTimeHashString("TRIM_HORIZON");
+        static constexpr int LATEST_HASH = HashingUtils::CompileTimeHashString("LATEST");
+        static constexpr int AT_TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("AT_TIMESTAMP");
 
 
         EventSourcePosition GetEventSourcePositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRIM_HORIZON_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventSourcePosition::TRIM_HORIZON;
-          }
-          else if (hashCode == LATEST_HASH)
-          {
-            return EventSourcePosition::LATEST;
-          }
-          else if (hashCode == AT_TIMESTAMP_HASH)
-          {
-            return EventSourcePosition::AT_TIMESTAMP;
+          case TRIM_HORIZON_HASH:
+            if (name == "TRIM_HORIZON")
+            {
+              return EventSourcePosition::TRIM_HORIZON;
+            }
+            break;
+          case LATEST_HASH:
+            if (name == "LATEST")
+            {
+              return EventSourcePosition::LATEST;
+            }
+            break;
+          case AT_TIMESTAMP_HASH:
+            if (name == "AT_TIMESTAMP")
+            {
+              return EventSourcePosition::AT_TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return EventSourcePosition::NOT_SET;
         }
 
-        Aws::String GetNameForEventSourcePosition(EventSourcePosition enumValue)
+        const char* GetNameForEventSourcePosition(EventSourcePosition enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
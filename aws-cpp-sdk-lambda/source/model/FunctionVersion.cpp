@@ -30,15 +30,23 @@ namespace Aws
       namespace FunctionVersionMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
 
 
         FunctionVersion GetFunctionVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FunctionVersion::ALL;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return FunctionVersion::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return FunctionVersion::NOT_SET;
         }
 
-        Aws::String GetNameForFunctionVersion(FunctionVersion enumValue)
+        const char* GetNameForFunctionVersion(FunctionVersion enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace InvocationTypeMapper
       {
 
-        static const int Event_HASH = HashingUtils::HashString("Event");
-        static const int RequestResponse_HASH = HashingUtils::HashString("RequestResponse");
-        static const int DryRun_HASH = HashingUtils::HashString("DryRun");
+        static constexpr int Event_HASH = HashingUtils::CompileTimeHashString("Event");
+        static constexpr int RequestResponse_HASH = HashingUtils::CompileTimeHashString("RequestResponse");
+        static constexpr int DryRun_HASH = HashingUtils::CompileTimeHashString("DryRun");
 
 
         InvocationType GetInvocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Event_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InvocationType::Event;
-          }
-          else if (hashCode == RequestResponse_HASH)
-          {
-            return InvocationType::RequestResponse;
-          }
-          else if (hashCode == DryRun_HASH)
-          {
-            return InvocationType::DryRun;
+          case Event_HASH:
+            if (name == "Event")
+            {
+              return InvocationType::Event;
+            }
+            break;
+          case RequestResponse_HASH:
+            if (name == "RequestResponse")
+            {
+              return InvocationType::RequestResponse;
+            }
+            break;
+          case DryRun_HASH:
+            if (name == "DryRun")
+            {
+              return InvocationType::DryRun;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InvocationType::NOT_SET;
         }
 
-        Aws::String GetNameForInvocationType(InvocationType enumValue)
+        const char* GetNameForInvocationType(InvocationType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
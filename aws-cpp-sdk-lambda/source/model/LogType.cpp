@@ -30,20 +30,30 @@ namespace Aws
       namespace LogTypeMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int Tail_HASH = HashingUtils::HashString("Tail");
+        static constexpr int None_HASH = HashingUtils::CompileTimeHashString("None");
+        static constexpr int Tail_HASH = HashingUtils::CompileTimeHashString("Tail");
 
 
         LogType GetLogTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LogType::None;
-          }
-          else if (hashCode == Tail_HASH)
-          {
-            return LogType::Tail;
+          case None_HASH:
+            if (name == "None")
+            {
+              return LogType::None;
+            }
+            break;
+          case Tail_HASH:
+            if (name == "Tail")
+            {
+              return LogType::Tail;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LogType::NOT_SET;
         }
 
-        Aws::String GetNameForLogType(LogType enumValue)
+        const char* GetNameForLogType(LogType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,70 +30,100 @@ namespace Aws
       namespace RuntimeMapper
       {
 
-        static const int nodejs_HASH = HashingUtils::HashString("nodejs");
-        static const int nodejs4_3_HASH = HashingUtils::HashString("nodejs4.3");
-        static const int nodejs6_10_HASH = HashingUtils::HashString("nodejs6.10");
-        static const int nodejs8_10_HASH = HashingUtils::HashString("nodejs8.10");
-        static const int java8_HASH = HashingUtils::HashString("java8");
-        static const int python2_7_HASH = HashingUtils::HashString("python2.7");
-        static const int python3_6_HASH = HashingUtils::HashString("python3.6");
-        static const int dotnetcore1_0_HASH = HashingUtils::HashString("dotnetcore1.0");
-        static const int dotnetcore2_0_HASH = HashingUtils::HashString("dotnetcore2.0");
-        static const int dotnetcore2_1_HASH = HashingUtils::HashString("dotnetcore2.1");
-        static const int nodejs4_3_edge_HASH = HashingUtils::HashString("nodejs4.3-edge");
-        static const int go1_x_HASH = HashingUtils::HashString("go1.x");
+        static constexpr int nodejs_HASH = HashingUtils::CompileTimeHashString("nodejs");
+        static constexpr int nodejs4_3_HASH = HashingUtils::CompileTimeHashString("nodejs4.3");
+        static constexpr int nodejs6_10_HASH = HashingUtils::CompileTimeHashString("nodejs6.10");
+        static constexpr int nodejs8_10_HASH = HashingUtils::CompileTimeHashString("nodejs8.10");
+        static constexpr int java8_HASH = HashingUtils::CompileTimeHashString("java8");
+        static constexpr int python2_7_HASH = HashingUtils::CompileTimeHashString("python2.7");
+        static constexpr int python3_6_HASH = HashingUtils::CompileTimeHashString("python3.6");
+        static constexpr int dotnetcore1_0_HASH = HashingUtils::CompileTimeHashString("dotnetcore1.0");
+        static constexpr int dotnetcore2_0_HASH = HashingUtils::CompileTimeHashString("dotnetcore2.0");
+        static constexpr int dotnetcore2_1_HASH = HashingUtils::CompileTimeHashString("dotnetcore2.1");
+        static constexpr int nodejs4_3_edge_HASH = HashingUtils::CompileTimeHashString("nodejs4.3-edge");
+        static constexpr int go1_x_HASH = HashingUtils::CompileTimeHashString("go1.x");
 
 
         Runtime GetRuntimeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == nodejs_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Runtime::nodejs;
-          }
-          else if (hashCode == nodejs4_3_HASH)
-          {
-            return Runtime::nodejs4_3;
-          }
-          else if (hashCode == nodejs6_10_HASH)
-          {
-            return Runtime::nodejs6_10;
-          }
-          else if (hashCode == nodejs8_10_HASH)
-          {
-            return Runtime::nodejs8_10;
-          }
-          else if (hashCode == java8_HASH)
-          {
-            return Runtime::java8;
-          }
-          else if (hashCode == python2_7_HASH)
-          {
-            return Runtime::python2_7;
-          }
-          else if (hashCode == python3_6_HASH)
-          {
-            return Runtime::python3_6;
-          }
-          else if (hashCode == dotnetcore1_0_HASH)
-          {
-            return Runtime::dotnetcore1_0;
-          }
-          else if (hashCode == dotnetcore2_0_HASH)
-          {
-            return Runtime::dotnetcore2_0;
-          }
-          else if (hashCode == dotnetcore2_1_HASH)
-          {
-            return Runtime::dotnetcore2_1;
-          }
-          else if (hashCode == nodejs4_3_edge_HASH)
-          {
-            return Runtime::nodejs4_3_edge;
-          }
-          else if (hashCode == go1_x_HASH)
-          {
-            return Runtime::go1_x;
+          case nodejs_HASH:
+            if (name == "nodejs")
+            {
+              return Runtime::nodejs;
+            }
+            break;
+          case nodejs4_3_HASH:
+            if (name == "nodejs4.3")
+            {
+              return Runtime::nodejs4_3;
+            }
+            break;
+          case nodejs6_10_HASH:
+            if (name == "nodejs6.10")
+            {
+              return Runtime::nodejs6_10;
+            }
+            break;
+          case nodejs8_10_HASH:
+            if (name == "nodejs8.10")
+            {
+              return Runtime::nodejs8_10;
+            }
+            break;
+          case java8_HASH:
+            if (name == "java8")
+            {
+              return Runtime::java8;
+            }
+            break;
+          case python2_7_HASH:
+            if (name == "python2.7")
+            {
+              return Runtime::python2_7;
+            }
+            break;
+          case python3_6_HASH:
+            if (name == "python3.6")
+            {
+              return Runtime::python3_6;
+            }
+            break;
+          case dotnetcore1_0_HASH:
+            if (name == "dotnetcore1.0")
+            {
+              return Runtime::dotnetcore1_0;
+            }
+            break;
+          case dotnetcore2_0_HASH:
+            if (name == "dotnetcore2.0")
+            {
+              return Runtime::dotnetcore2_0;
+            }
+            break;
+          case dotnetcore2_1_HASH:
+            if (name == "dotnetcore2.1")
+            {
+              return Runtime::dotnetcore2_1;
+            }
+            break;
+          case nodejs4_3_edge_HASH:
+            if (name == "nodejs4.3-edge")
+            {
+              return Runtime::nodejs4_3_edge;
+            }
+            break;
+          case go1_x_HASH:
+            if (name == "go1.x")
+            {
+              return Runtime::go1_x;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return Runtime::NOT_SET;
         }
 
-        Aws::String GetNameForRuntime(Runtime enumValue)
+        const char* GetNameForRuntime(Runtime enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
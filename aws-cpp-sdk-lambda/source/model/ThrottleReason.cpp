@@ -30,35 +30,51 @@ namespace Aws
       namespace ThrottleReasonMapper
       {
 
-        static const int ConcurrentInvocationLimitExceeded_HASH = HashingUtils::HashString("ConcurrentInvocationLimitExceeded");
-        static const int FunctionInvocationRateLimitExceeded_HASH = HashingUtils::HashString("FunctionInvocationRateLimitExceeded");
-        static const int ReservedFunctionConcurrentInvocationLimitExceeded_HASH = HashingUtils::HashString("ReservedFunctionConcurrentInvocationLimitExceeded");
-        static const int ReservedFunctionInvocationRateLimitExceeded_HASH = HashingUtils::HashString("ReservedFunctionInvocationRateLimitExceeded");
-        static const int CallerRateLimitExceeded_HASH = HashingUtils::HashString("CallerRateLimitExceeded");
+        static constexpr int ConcurrentInvocationLimitExceeded_HASH = HashingUtils::CompileTimeHashString("ConcurrentInvocationLimitExceeded");
+        static constexpr int FunctionInvocationRateLimitExceeded_HASH = HashingUtils::CompileTimeHashString("FunctionInvocationRateLimitExceeded");
+        static constexpr int ReservedFunctionConcurrentInvocationLimitExceeded_HASH = HashingUtils::CompileTimeHashString("ReservedFunctionConcurrentInvocationLimitExceeded");
+        static constexpr int ReservedFunctionInvocationRateLimitExceeded_HASH = HashingUtils::CompileTimeHashString("ReservedFunctionInvocationRateLimitExceeded");
+        static constexpr int CallerRateLimitExceeded_HASH = HashingUtils::CompileTimeHashString("CallerRateLimitExceeded");
 
 
         ThrottleReason GetThrottleReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ConcurrentInvocationLimitExceeded_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ThrottleReason::ConcurrentInvocationLimitExceeded;
-          }
-          else if (hashCode == FunctionInvocationRateLimitExceeded_HASH)
-          {
-            return ThrottleReason::FunctionInvocationRateLimitExceeded;
-          }
-          else if (hashCode == ReservedFunctionConcurrentInvocationLimitExceeded_HASH)
-          {
-            return ThrottleReason::ReservedFunctionConcurrentInvocationLimitExceeded;
-          }
-          else if (hashCode == ReservedFunctionInvocationRateLimitExceeded_HASH)
-          {
-            return ThrottleReason::ReservedFunctionInvocationRateLimitExceeded;
-          }
-          else if (hashCode == CallerRateLimitExceeded_HASH)
-          {
-            return ThrottleReason::CallerRateLimitExceeded;
+          case ConcurrentInvocationLimitExceeded_HASH:
+            if (name == "ConcurrentInvocationLimitExceeded")
+            {
+              return ThrottleReason::ConcurrentInvocationLimitExceeded;
+            }
+            break;
+          case FunctionInvocationRateLimitExceeded_HASH:
+            if (name == "FunctionInvocationRateLimitExceeded")
+            {
+              return ThrottleReason::FunctionInvocationRateLimitExceeded;
+            }
+            break;
+          case ReservedFunctionConcurrentInvocationLimitExceeded_HASH:
+            if (name == "ReservedFunctionConcurrentInvocationLimitExceeded")
+            {
+              return ThrottleReason::ReservedFunctionConcurrentInvocationLimitExceeded;
+            }
+            break;
+          case ReservedFunctionInvocationRateLimitExceeded_HASH:
+            if (name == "ReservedFunctionInvocationRateLimitExceeded")
+            {
+              return ThrottleReason::ReservedFunctionInvocationRateLimitExceeded;
+            }
+            break;
+          case CallerRateLimitExceeded_HASH:
+            if (name == "CallerRateLimitExceeded")
+            {
+              return ThrottleReason::CallerRateLimitExceeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ThrottleReason::NOT_SET;
         }
 
-        Aws::String GetNameForThrottleReason(ThrottleReason enumValue)
+        const char* GetNameForThrottleReason(ThrottleReason enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace TracingModeMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int PassThrough_HASH = HashingUtils::HashString("PassThrough");
+        static constexpr int Active_HASH = HashingUtils::CompileTimeHashString("Active");
+        static constexpr int PassThrough_HASH = HashingUtils::CompileTimeHashString("PassThrough");
 
 
         TracingMode GetTracingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TracingMode::Active;
-          }
-          else if (hashCode == PassThrough_HASH)
-          {
-            return TracingMode::PassThrough;
+          case Active_HASH:
+            if (name == "Active")
+            {
+              return TracingMode::Active;
+            }
+            break;
+          case PassThrough_HASH:
+            if (name == "PassThrough")
+            {
+              return TracingMode::PassThrough;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TracingMode::NOT_SET;
         }
 
-        Aws::String GetNameForTracingMode(TracingMode enumValue)
+        const char* GetNameForTracingMode(TracingMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
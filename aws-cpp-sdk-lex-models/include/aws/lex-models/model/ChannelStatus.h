@@ -35,7 +35,8 @@ namespace ChannelStatusMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API ChannelStatus GetChannelStatusForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForChannelStatus(ChannelStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForChannelStatus(ChannelStatus value);
 } // namespace ChannelStatusMapper
 } // namespace Model
 } // namespace LexModelBuildingService
@@ -36,7 +36,8 @@ namespace ChannelTypeMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API ChannelType GetChannelTypeForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForChannelType(ChannelType value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForChannelType(ChannelType value);
 } // namespace ChannelTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
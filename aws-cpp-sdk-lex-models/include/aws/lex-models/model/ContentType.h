@@ -35,7 +35,8 @@ namespace ContentTypeMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API ContentType GetContentTypeForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForContentType(ContentType value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForContentType(ContentType value);
 } // namespace ContentTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
@@ -35,7 +35,8 @@ namespace ExportStatusMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API ExportStatus GetExportStatusForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForExportStatus(ExportStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForExportStatus(ExportStatus value);
 } // namespace ExportStatusMapper
 } // namespace Model
 } // namespace LexModelBuildingService
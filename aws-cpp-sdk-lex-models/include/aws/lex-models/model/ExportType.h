@@ -34,7 +34,8 @@ namespace ExportTypeMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API ExportType GetExportTypeForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForExportType(ExportType value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForExportType(ExportType value);
 } // namespace ExportTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
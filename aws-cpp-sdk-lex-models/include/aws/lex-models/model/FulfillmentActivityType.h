@@ -34,7 +34,8 @@ namespace FulfillmentActivityTypeMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API FulfillmentActivityType GetFulfillmentActivityTypeForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForFulfillmentActivityType(FulfillmentActivityType value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForFulfillmentActivityType(FulfillmentActivityType value);
 } // namespace FulfillmentActivityTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
@@ -35,7 +35,8 @@ namespace ImportStatusMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API ImportStatus GetImportStatusForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForImportStatus(ImportStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForImportStatus(ImportStatus value);
 } // namespace ImportStatusMapper
 } // namespace Model
 } // namespace LexModelBuildingService
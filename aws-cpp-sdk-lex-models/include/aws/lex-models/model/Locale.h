@@ -35,7 +35,8 @@ namespace LocaleMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API Locale GetLocaleForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForLocale(Locale value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForLocale(Locale value);
 } // namespace LocaleMapper
 } // namespace Model
 } // namespace LexModelBuildingService
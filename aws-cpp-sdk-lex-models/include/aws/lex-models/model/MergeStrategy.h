@@ -34,7 +34,8 @@ namespace MergeStrategyMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API MergeStrategy GetMergeStrategyForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForMergeStrategy(MergeStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForMergeStrategy(MergeStrategy value);
 } // namespace MergeStrategyMapper
 } // namespace Model
 } // namespace LexModelBuildingService
@@ -34,7 +34,8 @@ namespace ProcessBehaviorMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API ProcessBehavior GetProcessBehaviorForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForProcessBehavior(ProcessBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForProcessBehavior(ProcessBehavior value);
 } // namespace ProcessBehaviorMapper
 } // namespace Model
 } // namespace LexModelBuildingService
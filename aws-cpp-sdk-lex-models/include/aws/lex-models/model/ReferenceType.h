@@ -36,7 +36,8 @@ namespace ReferenceTypeMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API ReferenceType GetReferenceTypeForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForReferenceType(ReferenceType value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForReferenceType(ReferenceType value);
 } // namespace ReferenceTypeMapper
 } // namespace Model
 } // namespace LexModelBuildingService
@@ -34,7 +34,8 @@ namespace SlotConstraintMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API SlotConstraint GetSlotConstraintForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForSlotConstraint(SlotConstraint value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForSlotConstraint(SlotConstraint value);
 } // namespace SlotConstraintMapper
 } // namespace Model
 } // namespace LexModelBuildingService
@@ -34,7 +34,8 @@ namespace SlotValueSelectionStrategyMapper
 {
 AWS_LEXMODELBUILDINGSERVICE_API SlotValueSelectionStrategy GetSlotValueSelectionStrategyForName(const Aws::String& name);
 
-AWS_LEXMODELBUILDINGSERVICE_API Aws::String GetNameForSlotValueSelectionStrategy(SlotValueSelectionStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXMODELBUILDINGSERVICE_API const char* GetNameForSlotValueSelectionStrategy(SlotValueSelectionStrategy value);
 } // namespace SlotValueSelectionStrategyMapper
 } // namespace Model
 } // namespace LexModelBuildingService
@@ -30,25 +30,37 @@ namespace Aws
       namespace ChannelStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int CREATED_HASH = HashingUtils::CompileTimeHashString("CREATED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         ChannelStatus GetChannelStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChannelStatus::IN_PROGRESS;
-          }
-          else if (hashCode == CREATED_HASH)
-          {
-            return ChannelStatus::CREATED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ChannelStatus::FAILED;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return ChannelStatus::IN_PROGRESS;
+            }
+            break;
+          case CREATED_HASH:
+            if (name == "CREATED")
+            {
+              return ChannelStatus::CREATED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ChannelStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ChannelStatus::NOT_SET;
         }
 
-        Aws::String GetNameForChannelStatus(ChannelStatus enumValue)
+        const char* GetNameForChannelStatus(ChannelStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ChannelTypeMapper
       {
 
-        static const int Facebook_HASH = HashingUtils::HashString("Facebook");
-        static const int Slack_HASH = HashingUtils::HashString("Slack");
-        static const int Twilio_Sms_HASH = HashingUtils::HashString("Twilio-Sms");
-        static const int Kik_HASH = HashingUtils::HashString("Kik");
+        static constexpr int Facebook_HASH = HashingUtils::CompileTimeHashString("Facebook");
+        static constexpr int Slack_HASH = HashingUtils::CompileTimeHashString("Slack");
+        static constexpr int Twilio_Sms_HASH = HashingUtils::CompileTimeHashString("Twilio-Sms");
+        static constexpr int Kik_HASH = HashingUtils::CompileTimeHashString("Kik");
 
 
         ChannelType GetChannelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Facebook_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChannelType::Facebook;
-          }
-          else if (hashCode == Slack_HASH)
-          {
-            return ChannelType::Slack;
-          }
-          else if (hashCode == Twilio_Sms_HASH)
-          {
-            return ChannelType::Twilio_Sms;
-          }
-          else if (hashCode == Kik_HASH)
-          {
-            return ChannelType::Kik;
+          case Facebook_HASH:
+            if (name == "Facebook")
+            {
+              return ChannelType::Facebook;
+            }
+            break;
+          case Slack_HASH:
+            if (name == "Slack")
+            {
+              return ChannelType::Slack;
+            }
+            break;
+          case Twilio_Sms_HASH:
+            if (name == "Twilio-Sms")
+            {
+              return ChannelType::Twilio_Sms;
+            }
+            break;
+          case Kik_HASH:
+            if (name == "Kik")
+            {
+              return ChannelType::Kik;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ChannelType::NOT_SET;
         }
 
-        Aws::String GetNameForChannelType(ChannelType enumValue)
+        const char* GetNameForChannelType(ChannelType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ContentTypeMapper
       {
 
-        static const int PlainText_HASH = HashingUtils::HashString("PlainText");
-        static const int SSML_HASH = HashingUtils::HashString("SSML");
-        static const int CustomPayload_HASH = HashingUtils::HashString("CustomPayload");
+        static constexpr int PlainText_HASH = HashingUtils::CompileTimeHashString("PlainText");
+        static constexpr int SSML_HASH = HashingUtils::CompileTimeHashString("SSML");
+        static constexpr int CustomPayload_HASH = HashingUtils::CompileTimeHashString("CustomPayload");
 
 
         ContentType GetContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PlainText_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContentType::PlainText;
-          }
-          else if (hashCode == SSML_HASH)
-          {
-            return ContentType::SSML;
-          }
-          else if (hashCode == CustomPayload_HASH)
-          {
-            return ContentType::CustomPayload;
+          case PlainText_HASH:
+            if (name == "PlainText")
+            {
+              return ContentType::PlainText;
+            }
+            break;
+          case SSML_HASH:
+            if (name == "SSML")
+            {
+              return ContentType::SSML;
+            }
+            break;
+          case CustomPayload_HASH:
+            if (name == "CustomPayload")
+            {
+              return ContentType::CustomPayload;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ContentType::NOT_SET;
         }
 
-        Aws::String GetNameForContentType(ContentType enumValue)
+        const char* GetNameForContentType(ContentType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
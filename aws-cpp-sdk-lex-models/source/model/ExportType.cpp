@@ -30,20 +30,30 @@ namespace Aws
       namespace ExportTypeMapper
       {
 
-        static const int ALEXA_SKILLS_KIT_HASH = HashingUtils::HashString("ALEXA_SKILLS_KIT");
-        static const int LEX_HASH = HashingUtils::HashString("LEX");
+        static constexpr int ALEXA_SKILLS_KIT_HASH = HashingUtils::CompileTimeHashString("ALEXA_SKILLS_KIT");
+        static constexpr int LEX_HASH = HashingUtils::CompileTimeHashString("LEX");
 
 
         ExportType GetExportTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALEXA_SKILLS_KIT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExportType::ALEXA_SKILLS_KIT;
-          }
-          else if (hashCode == LEX_HASH)
-          {
-            return ExportType::LEX;
+          case ALEXA_SKILLS_KIT_HASH:
+            if (name == "ALEXA_SKILLS_KIT")
+            {
+              return ExportType::ALEXA_SKILLS_KIT;
+            }
+            break;
+          case LEX_HASH:
+            if (name == "LEX")
+            {
+              return ExportType::LEX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ExportType::NOT_SET;
         }
 
-        Aws::String GetNameForExportType(ExportType enumValue)
+        const char* GetNameForExportType(ExportType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
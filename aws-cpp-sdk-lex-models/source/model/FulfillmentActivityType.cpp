@@ -30,20 +30,30 @@ namespace Aws
       namespace FulfillmentActivityTypeMapper
       {
 
-        static const int ReturnIntent_HASH = HashingUtils::HashString("ReturnIntent");
-        static const int CodeHook_HASH = HashingUtils::HashString("CodeHook");
+        static constexpr int ReturnIntent_HASH = HashingUtils::CompileTimeHashString("ReturnIntent");
+        static constexpr int CodeHook_HASH = HashingUtils::CompileTimeHashString("CodeHook");
 
 
         FulfillmentActivityType GetFulfillmentActivityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ReturnIntent_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FulfillmentActivityType::ReturnIntent;
-          }
-          else if (hashCode == CodeHook_HASH)
-          {
-            return FulfillmentActivityType::CodeHook;
+          case ReturnIntent_HASH:
+            if (name == "ReturnIntent")
+            {
+              return FulfillmentActivityType::ReturnIntent;
+            }
+            break;
+          case CodeHook_HASH:
+            if (name == "CodeHook")
+            {
+              return FulfillmentActivityType::CodeHook;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FulfillmentActivityType::NOT_SET;
         }
 
-        Aws::String GetNameForFulfillmentActivityType(FulfillmentActivityType enumValue)
+        const char* GetNameForFulfillmentActivityType(FulfillmentActivityType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace LocaleMapper
       {
 
-        static const int en_US_HASH = HashingUtils::HashString("en-US");
-        static const int en_GB_HASH = HashingUtils::HashString("en-GB");
-        static const int de_DE_HASH = HashingUtils::HashString("de-DE");
+        static constexpr int en_US_HASH = HashingUtils::CompileTimeHashString("en-US");
+        static constexpr int en_GB_HASH = HashingUtils::CompileTimeHashString("en-GB");
+        static constexpr int de_DE_HASH = HashingUtils::CompileTimeHashString("de-DE");
 
 
         Locale GetLocaleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_US_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Locale::en_US;
-          }
-          else if (hashCode == en_GB_HASH)
-          {
-            return Locale::en_GB;
-          }
-          else if (hashCode == de_DE_HASH)
-          {
-            return Locale::de_DE;
+          case en_US_HASH:
+            if (name == "en-US")
+            {
+              return Locale::en_US;
+            }
+            break;
+          case en_GB_HASH:
+            if (name == "en-GB")
+            {
+              return Locale::en_GB;
+            }
+            break;
+          case de_DE_HASH:
+            if (name == "de-DE")
+            {
+              return Locale::de_DE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Locale::NOT_SET;
         }
 
-        Aws::String GetNameForLocale(Locale enumValue)
+        const char* GetNameForLocale(Locale enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace MergeStrategyMapper
       {
 
-        static const int OVERWRITE_LATEST_HASH = HashingUtils::HashString("OVERWRITE_LATEST");
-        static const int FAIL_ON_CONFLICT_HASH = HashingUtils::HashString("FAIL_ON_CONFLICT");
+        static constexpr int OVERWRITE_LATEST_HASH = HashingUtils::CompileTimeHashString("OVERWRITE_LATEST");
+        static constexpr int FAIL_ON_CONFLICT_HASH = HashingUtils::CompileTimeHashString("FAIL_ON_CONFLICT");
 
 
         MergeStrategy GetMergeStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OVERWRITE_LATEST_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MergeStrategy::OVERWRITE_LATEST;
-          }
-          else if (hashCode == FAIL_ON_CONFLICT_HASH)
-          {
-            return MergeStrategy::FAIL_ON_CONFLICT;
+          case OVERWRITE_LATEST_HASH:
+            if (name == "OVERWRITE_LATEST")
+            {
+              return MergeStrategy::OVERWRITE_LATEST;
+            }
+            break;
+          case FAIL_ON_CONFLICT_HASH:
+            if (name == "FAIL_ON_CONFLICT")
+            {
+              return MergeStrategy::FAIL_ON_CONFLICT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MergeStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForMergeStrategy(MergeStrategy enumValue)
+        const char* GetNameForMergeStrategy(MergeStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ProcessBehaviorMapper
       {
 
-        static const int SAVE_HASH = HashingUtils::HashString("SAVE");
-        static const int BUILD_HASH = HashingUtils::HashString("BUILD");
+        static constexpr int SAVE_HASH = HashingUtils::CompileTimeHashString("SAVE");
+        static constexpr int BUILD_HASH = HashingUtils::CompileTimeHashString("BUILD");
 
 
         ProcessBehavior GetProcessBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SAVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProcessBehavior::SAVE;
-          }
-          else if (hashCode == BUILD_HASH)
-          {
-            return ProcessBehavior::BUILD;
+          case SAVE_HASH:
+            if (name == "SAVE")
+            {
+              return ProcessBehavior::SAVE;
+            }
+            break;
+          case BUILD_HASH:
+            if (name == "BUILD")
+            {
+              return ProcessBehavior::BUILD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ProcessBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForProcessBehavior(ProcessBehavior enumValue)
+        const char* GetNameForProcessBehavior(ProcessBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
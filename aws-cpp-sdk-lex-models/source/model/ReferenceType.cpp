@@ -30,30 +30,44 @@ namespace Aws
       namespace ReferenceTypeMapper
       {
 
-        static const int Intent_HASH = HashingUtils::HashString("Intent");
-        static const int Bot_HASH = HashingUtils::HashString("Bot");
-        static const int BotAlias_HASH = HashingUtils::HashString("BotAlias");
-        static const int BotChannel_HASH = HashingUtils::HashString("BotChannel");
+        static constexpr int Intent_HASH = HashingUtils::CompileTimeHashString("Intent");
+        static constexpr int Bot_HASH = HashingUtils::CompileTimeHashString("Bot");
+        static constexpr int BotAlias_HASH = HashingUtils::CompileTimeHashString("BotAlias");
+        static constexpr int BotChannel_HASH = HashingUtils::CompileTimeHashString("BotChannel");
 
 
         ReferenceType GetReferenceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Intent_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReferenceType::Intent;
-          }
-          else if (hashCode == Bot_HASH)
-          {
-            return ReferenceType::Bot;
-          }
-          else if (hashCode == BotAlias_HASH)
-          {
-            return ReferenceType::BotAlias;
-          }
-          else if (hashCode == BotChannel_HASH)
-          {
-            return ReferenceType::BotChannel;
+          case Intent_HASH:
+            if (name == "Intent")
+            {
+              return ReferenceType::Intent;
+            }
+            break;
+          case Bot_HASH:
+            if (name == "Bot")
+            {
+              return ReferenceType::Bot;
+            }
+            break;
+          case BotAlias_HASH:
+            if (name == "BotAlias")
+            {
+              return ReferenceType::BotAlias;
+            }
+            break;
+          case BotChannel_HASH:
+            if (name == "BotChannel")
+            {
+              return ReferenceType::BotChannel;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ReferenceType::NOT_SET;
         }
 
-        Aws::String GetNameForReferenceType(ReferenceType enumValue)
+        const char* GetNameForReferenceType(ReferenceType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
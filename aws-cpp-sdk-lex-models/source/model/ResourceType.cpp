@@ -30,25 +30,37 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int BOT_HASH = HashingUtils::HashString("BOT");
-        static const int INTENT_HASH = HashingUtils::HashString("INTENT");
-        static const int SLOT_TYPE_HASH = HashingUtils::HashString("SLOT_TYPE");
+        static constexpr int BOT_HASH = HashingUtils::CompileTimeHashString("BOT");
+        static constexpr int INTENT_HASH = HashingUtils::CompileTimeHashString("INTENT");
+        static constexpr int SLOT_TYPE_HASH = HashingUtils::CompileTimeHashString("SLOT_TYPE");
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BOT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceType::BOT;
-          }
-          else if (hashCode == INTENT_HASH)
-          {
-            return ResourceType::INTENT;
-          }
-          else if (hashCode == SLOT_TYPE_HASH)
-          {
-            return ResourceType::SLOT_TYPE;
+          case BOT_HASH:
+            if (name == "BOT")
+            {
+              return ResourceType::BOT;
+            }
+            break;
+          case INTENT_HASH:
+            if (name == "INTENT")
+            {
+              return ResourceType::INTENT;
+            }
+            break;
+          case SLOT_TYPE_HASH:
+            if (name == "SLOT_TYPE")
+            {
+              return ResourceType::SLOT_TYPE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceType(ResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SlotConstraintMapper
       {
 
-        static const int Required_HASH = HashingUtils::HashString("Required");
-        static const int Optional_HASH = HashingUtils::HashString("Optional");
+        static constexpr int Required_HASH = HashingUtils::CompileTimeHashString("Required");
+        static constexpr int Optional_HASH = HashingUtils::CompileTimeHashString("Optional");
 
 
         SlotConstraint GetSlotConstraintForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Required_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SlotConstraint::Required;
-          }
-          else if (hashCode == Optional_HASH)
-          {
-            return SlotConstraint::Optional;
+          case Required_HASH:
+            if (name == "Required")
+            {
+              return SlotConstraint::Required;
+            }
+            break;
+          case Optional_HASH:
+            if (name == "Optional")
+            {
+              return SlotConstraint::Optional;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SlotConstraint::NOT_SET;
         }
 
-        Aws::String GetNameForSlotConstraint(SlotConstraint enumValue)
+        const char* GetNameForSlotConstraint(SlotConstraint enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
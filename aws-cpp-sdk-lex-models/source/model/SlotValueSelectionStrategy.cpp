@@ -30,20 +30,30 @@ namespace Aws
       namespace SlotValueSelectionStrategyMapper
       {
 
-        static const int ORIGINAL_VALUE_HASH = HashingUtils::HashString("ORIGINAL_VALUE");
-        static const int TOP_RESOLUTION_HASH = HashingUtils::HashString("TOP_RESOLUTION");
+        static constexpr int ORIGINAL_VALUE_HASH = HashingUtils::CompileTimeHashString("ORIGINAL_VALUE");
+        static constexpr int TOP_RESOLUTION_HASH = HashingUtils::CompileTimeHashString("TOP_RESOLUTION");
 
 
         SlotValueSelectionStrategy GetSlotValueSelectionStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ORIGINAL_VALUE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SlotValueSelectionStrategy::ORIGINAL_VALUE;
-          }
-          else if (hashCode == TOP_RESOLUTION_HASH)
-          {
-            return SlotValueSelectionStrategy::TOP_RESOLUTION;
+          case ORIGINAL_VALUE_HASH:
+            if (name == "ORIGINAL_VALUE")
+            {
+              return SlotValueSelectionStrategy::ORIGINAL_VALUE;
+            }
+            break;
+          case TOP_RESOLUTION_HASH:
+            if (name == "TOP_RESOLUTION")
+            {
+              return SlotValueSelectionStrategy::TOP_RESOLUTION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SlotValueSelectionStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForSlotValueSelectionStrategy(SlotValueSelectionStrategy enumValue)
+        const char* GetNameForSlotValueSelectionStrategy(SlotValueSelectionStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace StatusMapper
       {
 
-        static const int BUILDING_HASH = HashingUtils::HashString("BUILDING");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int NOT_BUILT_HASH = HashingUtils::HashString("NOT_BUILT");
+        static constexpr int BUILDING_HASH = HashingUtils::CompileTimeHashString("BUILDING");
+        static constexpr int READY_HASH = HashingUtils::CompileTimeHashString("READY");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int NOT_BUILT_HASH = HashingUtils::CompileTimeHashString("NOT_BUILT");
 
 
         Status GetStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BUILDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Status::BUILDING;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return Status::READY;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return Status::FAILED;
-          }
-          else if (hashCode == NOT_BUILT_HASH)
-          {
-            return Status::NOT_BUILT;
+          case BUILDING_HASH:
+            if (name == "BUILDING")
+            {
+              return Status::BUILDING;
+            }
+            break;
+          case READY_HASH:
+            if (name == "READY")
+            {
+              return Status::READY;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return Status::FAILED;
+            }
+            break;
+          case NOT_BUILT_HASH:
+            if (name == "NOT_BUILT")
+            {
+              return Status::NOT_BUILT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return Status::NOT_SET;
         }
 
-        Aws::String GetNameForStatus(Status enumValue)
+        const char* GetNameForStatus(Status enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
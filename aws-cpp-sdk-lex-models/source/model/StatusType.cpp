@@ -30,20 +30,30 @@ namespace Aws
       namespace StatusTypeMapper
       {
 
-        static const int Detected_HASH = HashingUtils::HashString("Detected");
-        static const int Missed_HASH = HashingUtils::HashString("Missed");
+        static constexpr int Detected_HASH = HashingUtils::CompileTimeHashString("Detected");
+        static constexpr int Missed_HASH = HashingUtils::CompileTimeHashString("Missed");
 
 
         StatusType GetStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Detected_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StatusType::Detected;
-          }
-          else if (hashCode == Missed_HASH)
-          {
-            return StatusType::Missed;
+          case Detected_HASH:
+            if (name == "Detected")
+            {
+              return StatusType::Detected;
+            }
+            break;
+          case Missed_HASH:
+            if (name == "Missed")
+            {
+              return StatusType::Missed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return StatusType::NOT_SET;
         }
 
-        Aws::String GetNameForStatusType(StatusType enumValue)
+        const char* GetNameForStatusType(StatusType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
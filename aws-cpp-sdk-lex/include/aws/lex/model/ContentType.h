@@ -33,7 +33,8 @@ namespace ContentTypeMapper
 {
 AWS_LEXRUNTIMESERVICE_API ContentType GetContentTypeForName(const Aws::String& name);
 
-AWS_LEXRUNTIMESERVICE_API Aws::String GetNameForContentType(ContentType value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXRUNTIMESERVICE_API const char* GetNameForContentType(ContentType value);
 } // namespace ContentTypeMapper
 } // namespace Model
 } // namespace LexRuntimeService
@@ -38,7 +38,8 @@ namespace DialogStateMapper
 {
 AWS_LEXRUNTIMESERVICE_API DialogState GetDialogStateForName(const Aws::String& name);
 
-AWS_LEXRUNTIMESERVICE_API Aws::String GetNameForDialogState(DialogState value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXRUNTIMESERVICE_API const char* GetNameForDialogState(DialogState value);
 } // namespace DialogStateMapper
 } // namespace Model
 } // namespace LexRuntimeService
@@ -36,7 +36,8 @@ namespace MessageFormatTypeMapper
 {
 AWS_LEXRUNTIMESERVICE_API MessageFormatType GetMessageFormatTypeForName(const Aws::String& name);
 
-AWS_LEXRUNTIMESERVICE_API Aws::String GetNameForMessageFormatType(MessageFormatType value);
+// names of values not modeled point into the enum overflow container
+AWS_LEXRUNTIMESERVICE_API const char* GetNameForMessageFormatType(MessageFormatType value);
 } // namespace MessageFormatTypeMapper
 } // namespace Model
 } // namespace LexRuntimeService
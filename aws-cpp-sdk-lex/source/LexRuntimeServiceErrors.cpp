@@ -28,16 +28,16 @@ namespace LexRuntimeService
 namespace LexRuntimeServiceErrorMapper
 {
 
-static const int REQUEST_TIMEOUT_HASH = HashingUtils::HashString("RequestTimeoutException");
-static const int DEPENDENCY_FAILED_HASH = HashingUtils::HashString("DependencyFailedException");
-static const int CONFLICT_HASH = HashingUtils::HashString("ConflictException");
-static const int BAD_GATEWAY_HASH = HashingUtils::HashString("BadGatewayException");
-static const int NOT_ACCEPTABLE_HASH = HashingUtils::HashString("NotAcceptableException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int UNSUPPORTED_MEDIA_TYPE_HASH = HashingUtils::HashString("UnsupportedMediaTypeException");
-static const int BAD_REQUEST_HASH = HashingUtils::HashString("BadRequestException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int LOOP_DETECTED_HASH = HashingUtils::HashString("LoopDetectedException");
+static constexpr int REQUEST_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("RequestTimeoutException");
+static constexpr int DEPENDENCY_FAILED_HASH = HashingUtils::CompileTimeHashString("DependencyFailedException");
+static constexpr int CONFLICT_HASH = HashingUtils::CompileTimeHashString("ConflictException");
+static constexpr int BAD_GATEWAY_HASH = HashingUtils::CompileTimeHashString("BadGatewayException");
+static constexpr int NOT_ACCEPTABLE_HASH = HashingUtils::CompileTimeHashString("NotAcceptableException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int UNSUPPORTED_MEDIA_TYPE_HASH = HashingUtils::CompileTimeHashString("UnsupportedMediaTypeException");
+static constexpr int BAD_REQUEST_HASH = HashingUtils::CompileTimeHashString("BadRequestException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int LOOP_DETECTED_HASH = HashingUtils::CompileTimeHashString("LoopDetectedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,15 +30,23 @@ namespace Aws
       namespace ContentTypeMapper
       {
 
-        static const int application_vnd_amazonaws_card_generic_HASH = HashingUtils::HashString("application/vnd.amazonaws.card.generic");
+        static constexpr int application_vnd_amazonaws_card_generic_HASH = HashingUtils::CompileTimeHashString("application/vnd.amazonaws.card.generic");
 
 
         ContentType GetContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == application_vnd_amazonaws_card_generic_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContentType::application_vnd_amazonaws_card_generic;
+          case application_vnd_amazonaws_card_generic_HASH:
+            if (name == "application/vnd.amazonaws.card.generic")
+            {
+              return ContentType::application_vnd_amazonaws_card_generic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ContentType::NOT_SET;
         }
 
-        Aws::String GetNameForContentType(ContentType enumValue)
+        const char* GetNameForContentType(ContentType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace DialogStateMapper
       {
 
-        static const int ElicitIntent_HASH = HashingUtils::HashString("ElicitIntent");
-        static const int ConfirmIntent_HASH = HashingUtils::HashString("ConfirmIntent");
-        static const int ElicitSlot_HASH = HashingUtils::HashString("ElicitSlot");
-        static const int Fulfilled_HASH = HashingUtils::HashString("Fulfilled");
-        static const int ReadyForFulfillment_HASH = HashingUtils::HashString("ReadyForFulfillment");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int ElicitIntent_HASH = HashingUtils::CompileTimeHashString("ElicitIntent");
+        static constexpr int ConfirmIntent_HASH = HashingUtils::CompileTimeHashString("ConfirmIntent");
+        static constexpr int ElicitSlot_HASH = HashingUtils::CompileTimeHashString("ElicitSlot");
+        static constexpr int Fulfilled_HASH = HashingUtils::CompileTimeHashString("Fulfilled");
+        static constexpr int ReadyForFulfillment_HASH = HashingUtils::CompileTimeHashString("ReadyForFulfillment");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         DialogState GetDialogStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ElicitIntent_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DialogState::ElicitIntent;
-          }
-          else if (hashCode == ConfirmIntent_HASH)
-          {
-            return DialogState::ConfirmIntent;
-          }
-          else if (hashCode == ElicitSlot_HASH)
-          {
-            return DialogState::ElicitSlot;
-          }
-          else if (hashCode == Fulfilled_HASH)
-          {
-            return DialogState::Fulfilled;
-          }
-          else if (hashCode == ReadyForFulfillment_HASH)
-          {
-            return DialogState::ReadyForFulfillment;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return DialogState::Failed;
+          case ElicitIntent_HASH:
+            if (name == "ElicitIntent")
+            {
+              return DialogState::ElicitIntent;
+            }
+            break;
+          case ConfirmIntent_HASH:
+            if (name == "ConfirmIntent")
+            {
+              return DialogState::ConfirmIntent;
+            }
+            break;
+          case ElicitSlot_HASH:
+            if (name == "ElicitSlot")
+            {
+              return DialogState::ElicitSlot;
+            }
+            break;
+          case Fulfilled_HASH:
+            if (name == "Fulfilled")
+            {
+              return DialogState::Fulfilled;
+            }
+            break;
+          case ReadyForFulfillment_HASH:
+            if (name == "ReadyForFulfillment")
+            {
+              return DialogState::ReadyForFulfillment;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return DialogState::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return DialogState::NOT_SET;
         }
 
-        Aws::String GetNameForDialogState(DialogState enumValue)
+        const char* GetNameForDialogState(DialogState enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
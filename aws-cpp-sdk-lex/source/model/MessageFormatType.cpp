@@ -30,30 +30,44 @@ namespace Aws
       namespace MessageFormatTypeMapper
       {
 
-        static const int PlainText_HASH = HashingUtils::HashString("PlainText");
-        static const int CustomPayload_HASH = HashingUtils::HashString("CustomPayload");
-        static const int SSML_HASH = HashingUtils::HashString("SSML");
-        static const int Composite_HASH = HashingUtils::HashString("Composite");
+        static constexpr int PlainText_HASH = HashingUtils::CompileTimeHashString("PlainText");
+        static constexpr int CustomPayload_HASH = HashingUtils::CompileTimeHashString("CustomPayload");
+        static constexpr int SSML_HASH = HashingUtils::CompileTimeHashString("SSML");
+        static constexpr int Composite_HASH = HashingUtils::CompileTimeHashString("Composite");
 
 
         MessageFormatType GetMessageFormatTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PlainText_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MessageFormatType::PlainText;
-          }
-          else if (hashCode == CustomPayload_HASH)
-          {
-            return MessageFormatType::CustomPayload;
-          }
-          else if (hashCode == SSML_HASH)
-          {
-            return MessageFormatType::SSML;
-          }
-          else if (hashCode == Composite_HASH)
-          {
-            return MessageFormatType::Composite;
+          case PlainText_HASH:
+            if (name == "PlainText")
+            {
+              return MessageFormatType::PlainText;
+            }
+            break;
+          case CustomPayload_HASH:
+            if (name == "CustomPayload")
+            {
+              return MessageFormatType::CustomPayload;
+            }
+            break;
+          case SSML_HASH:
+            if (name == "SSML")
+            {
+              return MessageFormatType::SSML;
+            }
+            break;
+          case Composite_HASH:
+            if (name == "Composite")
+            {
+              return MessageFormatType::Composite;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return MessageFormatType::NOT_SET;
         }
 
-        Aws::String GetNameForMessageFormatType(MessageFormatType enumValue)
+        const char* GetNameForMessageFormatType(MessageFormatType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
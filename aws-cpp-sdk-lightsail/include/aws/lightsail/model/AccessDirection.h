@@ -34,7 +34,8 @@ namespace AccessDirectionMapper
 {
 AWS_LIGHTSAIL_API AccessDirection GetAccessDirectionForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForAccessDirection(AccessDirection value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForAccessDirection(AccessDirection value);
 } // namespace AccessDirectionMapper
 } // namespace Model
 } // namespace Lightsail
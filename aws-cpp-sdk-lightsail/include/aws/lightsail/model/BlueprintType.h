@@ -34,7 +34,8 @@ namespace BlueprintTypeMapper
 {
 AWS_LIGHTSAIL_API BlueprintType GetBlueprintTypeForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForBlueprintType(BlueprintType value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForBlueprintType(BlueprintType value);
 } // namespace BlueprintTypeMapper
 } // namespace Model
 } // namespace Lightsail
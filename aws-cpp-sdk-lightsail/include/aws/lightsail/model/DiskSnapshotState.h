@@ -36,7 +36,8 @@ namespace DiskSnapshotStateMapper
 {
 AWS_LIGHTSAIL_API DiskSnapshotState GetDiskSnapshotStateForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForDiskSnapshotState(DiskSnapshotState value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForDiskSnapshotState(DiskSnapshotState value);
 } // namespace DiskSnapshotStateMapper
 } // namespace Model
 } // namespace Lightsail
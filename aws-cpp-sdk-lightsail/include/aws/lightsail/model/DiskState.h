@@ -37,7 +37,8 @@ namespace DiskStateMapper
 {
 AWS_LIGHTSAIL_API DiskState GetDiskStateForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForDiskState(DiskState value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForDiskState(DiskState value);
 } // namespace DiskStateMapper
 } // namespace Model
 } // namespace Lightsail
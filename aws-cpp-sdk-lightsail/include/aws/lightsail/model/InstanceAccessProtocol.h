@@ -34,7 +34,8 @@ namespace InstanceAccessProtocolMapper
 {
 AWS_LIGHTSAIL_API InstanceAccessProtocol GetInstanceAccessProtocolForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForInstanceAccessProtocol(InstanceAccessProtocol value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForInstanceAccessProtocol(InstanceAccessProtocol value);
 } // namespace InstanceAccessProtocolMapper
 } // namespace Model
 } // namespace Lightsail
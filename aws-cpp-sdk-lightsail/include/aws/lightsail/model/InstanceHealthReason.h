@@ -43,7 +43,8 @@ namespace InstanceHealthReasonMapper
 {
 AWS_LIGHTSAIL_API InstanceHealthReason GetInstanceHealthReasonForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForInstanceHealthReason(InstanceHealthReason value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForInstanceHealthReason(InstanceHealthReason value);
 } // namespace InstanceHealthReasonMapper
 } // namespace Model
 } // namespace Lightsail
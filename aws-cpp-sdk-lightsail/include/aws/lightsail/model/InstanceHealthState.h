@@ -38,7 +38,8 @@ namespace InstanceHealthStateMapper
 {
 AWS_LIGHTSAIL_API InstanceHealthState GetInstanceHealthStateForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForInstanceHealthState(InstanceHealthState value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForInstanceHealthState(InstanceHealthState value);
 } // namespace InstanceHealthStateMapper
 } // namespace Model
 } // namespace Lightsail
@@ -38,7 +38,8 @@ namespace InstanceMetricNameMapper
 {
 AWS_LIGHTSAIL_API InstanceMetricName GetInstanceMetricNameForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForInstanceMetricName(InstanceMetricName value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForInstanceMetricName(InstanceMetricName value);
 } // namespace InstanceMetricNameMapper
 } // namespace Model
 } // namespace Lightsail
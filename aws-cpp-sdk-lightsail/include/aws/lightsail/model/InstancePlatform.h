@@ -34,7 +34,8 @@ namespace InstancePlatformMapper
 {
 AWS_LIGHTSAIL_API InstancePlatform GetInstancePlatformForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForInstancePlatform(InstancePlatform value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForInstancePlatform(InstancePlatform value);
 } // namespace InstancePlatformMapper
 } // namespace Model
 } // namespace Lightsail
@@ -35,7 +35,8 @@ namespace InstanceSnapshotStateMapper
 {
 AWS_LIGHTSAIL_API InstanceSnapshotState GetInstanceSnapshotStateForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForInstanceSnapshotState(InstanceSnapshotState value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForInstanceSnapshotState(InstanceSnapshotState value);
 } // namespace InstanceSnapshotStateMapper
 } // namespace Model
 } // namespace Lightsail
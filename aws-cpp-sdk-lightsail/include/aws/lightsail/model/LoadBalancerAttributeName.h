@@ -35,7 +35,8 @@ namespace LoadBalancerAttributeNameMapper
 {
 AWS_LIGHTSAIL_API LoadBalancerAttributeName GetLoadBalancerAttributeNameForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerAttributeName(LoadBalancerAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerAttributeName(LoadBalancerAttributeName value);
 } // namespace LoadBalancerAttributeNameMapper
 } // namespace Model
 } // namespace Lightsail
@@ -44,7 +44,8 @@ namespace LoadBalancerMetricNameMapper
 {
 AWS_LIGHTSAIL_API LoadBalancerMetricName GetLoadBalancerMetricNameForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerMetricName(LoadBalancerMetricName value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerMetricName(LoadBalancerMetricName value);
 } // namespace LoadBalancerMetricNameMapper
 } // namespace Model
 } // namespace Lightsail
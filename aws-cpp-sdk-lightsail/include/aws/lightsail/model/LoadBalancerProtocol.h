@@ -34,7 +34,8 @@ namespace LoadBalancerProtocolMapper
 {
 AWS_LIGHTSAIL_API LoadBalancerProtocol GetLoadBalancerProtocolForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerProtocol(LoadBalancerProtocol value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerProtocol(LoadBalancerProtocol value);
 } // namespace LoadBalancerProtocolMapper
 } // namespace Model
 } // namespace Lightsail
@@ -37,7 +37,8 @@ namespace LoadBalancerStateMapper
 {
 AWS_LIGHTSAIL_API LoadBalancerState GetLoadBalancerStateForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerState(LoadBalancerState value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerState(LoadBalancerState value);
 } // namespace LoadBalancerStateMapper
 } // namespace Model
 } // namespace Lightsail
@@ -35,7 +35,8 @@ namespace LoadBalancerTlsCertificateDomainStatusMapper
 {
 AWS_LIGHTSAIL_API LoadBalancerTlsCertificateDomainStatus GetLoadBalancerTlsCertificateDomainStatusForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerTlsCertificateDomainStatus(LoadBalancerTlsCertificateDomainStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerTlsCertificateDomainStatus(LoadBalancerTlsCertificateDomainStatus value);
 } // namespace LoadBalancerTlsCertificateDomainStatusMapper
 } // namespace Model
 } // namespace Lightsail
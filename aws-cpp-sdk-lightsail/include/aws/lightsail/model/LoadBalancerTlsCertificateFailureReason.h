@@ -37,7 +37,8 @@ namespace LoadBalancerTlsCertificateFailureReasonMapper
 {
 AWS_LIGHTSAIL_API LoadBalancerTlsCertificateFailureReason GetLoadBalancerTlsCertificateFailureReasonForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerTlsCertificateFailureReason(LoadBalancerTlsCertificateFailureReason value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerTlsCertificateFailureReason(LoadBalancerTlsCertificateFailureReason value);
 } // namespace LoadBalancerTlsCertificateFailureReasonMapper
 } // namespace Model
 } // namespace Lightsail
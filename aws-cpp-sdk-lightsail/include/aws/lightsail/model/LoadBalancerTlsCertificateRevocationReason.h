@@ -42,7 +42,8 @@ namespace LoadBalancerTlsCertificateRevocationReasonMapper
 {
 AWS_LIGHTSAIL_API LoadBalancerTlsCertificateRevocationReason GetLoadBalancerTlsCertificateRevocationReasonForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerTlsCertificateRevocationReason(LoadBalancerTlsCertificateRevocationReason value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerTlsCertificateRevocationReason(LoadBalancerTlsCertificateRevocationReason value);
 } // namespace LoadBalancerTlsCertificateRevocationReasonMapper
 } // namespace Model
 } // namespace Lightsail
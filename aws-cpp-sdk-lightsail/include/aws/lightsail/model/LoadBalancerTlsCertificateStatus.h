@@ -40,7 +40,8 @@ namespace LoadBalancerTlsCertificateStatusMapper
 {
 AWS_LIGHTSAIL_API LoadBalancerTlsCertificateStatus GetLoadBalancerTlsCertificateStatusForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForLoadBalancerTlsCertificateStatus(LoadBalancerTlsCertificateStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForLoadBalancerTlsCertificateStatus(LoadBalancerTlsCertificateStatus value);
 } // namespace LoadBalancerTlsCertificateStatusMapper
 } // namespace Model
 } // namespace Lightsail
@@ -59,7 +59,8 @@ namespace MetricUnitMapper
 {
 AWS_LIGHTSAIL_API MetricUnit GetMetricUnitForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForMetricUnit(MetricUnit value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForMetricUnit(MetricUnit value);
 } // namespace MetricUnitMapper
 } // namespace Model
 } // namespace Lightsail
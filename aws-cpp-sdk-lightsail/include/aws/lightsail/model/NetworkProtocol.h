@@ -35,7 +35,8 @@ namespace NetworkProtocolMapper
 {
 AWS_LIGHTSAIL_API NetworkProtocol GetNetworkProtocolForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForNetworkProtocol(NetworkProtocol value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForNetworkProtocol(NetworkProtocol value);
 } // namespace NetworkProtocolMapper
 } // namespace Model
 } // namespace Lightsail
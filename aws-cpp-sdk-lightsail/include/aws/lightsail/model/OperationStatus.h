@@ -37,7 +37,8 @@ namespace OperationStatusMapper
 {
 AWS_LIGHTSAIL_API OperationStatus GetOperationStatusForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForOperationStatus(OperationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForOperationStatus(OperationStatus value);
 } // namespace OperationStatusMapper
 } // namespace Model
 } // namespace Lightsail
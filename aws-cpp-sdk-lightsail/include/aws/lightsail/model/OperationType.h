@@ -66,7 +66,8 @@ namespace OperationTypeMapper
 {
 AWS_LIGHTSAIL_API OperationType GetOperationTypeForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForOperationType(OperationType value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForOperationType(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace Lightsail
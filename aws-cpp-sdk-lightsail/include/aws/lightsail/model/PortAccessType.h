@@ -34,7 +34,8 @@ namespace PortAccessTypeMapper
 {
 AWS_LIGHTSAIL_API PortAccessType GetPortAccessTypeForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForPortAccessType(PortAccessType value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForPortAccessType(PortAccessType value);
 } // namespace PortAccessTypeMapper
 } // namespace Model
 } // namespace Lightsail
@@ -34,7 +34,8 @@ namespace PortStateMapper
 {
 AWS_LIGHTSAIL_API PortState GetPortStateForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForPortState(PortState value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForPortState(PortState value);
 } // namespace PortStateMapper
 } // namespace Model
 } // namespace Lightsail
@@ -44,7 +44,8 @@ namespace RegionNameMapper
 {
 AWS_LIGHTSAIL_API RegionName GetRegionNameForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForRegionName(RegionName value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForRegionName(RegionName value);
 } // namespace RegionNameMapper
 } // namespace Model
 } // namespace Lightsail
@@ -42,7 +42,8 @@ namespace ResourceTypeMapper
 {
 AWS_LIGHTSAIL_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
-AWS_LIGHTSAIL_API Aws::String GetNameForResourceType(ResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_LIGHTSAIL_API const char* GetNameForResourceType(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace Lightsail
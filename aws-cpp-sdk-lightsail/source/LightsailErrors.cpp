@@ -28,12 +28,12 @@ namespace Lightsail
 namespace LightsailErrorMapper
 {
 
-static const int UNAUTHENTICATED_HASH = HashingUtils::HashString("UnauthenticatedException");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInputException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int SERVICE_HASH = HashingUtils::HashString("ServiceException");
-static const int ACCOUNT_SETUP_IN_PROGRESS_HASH = HashingUtils::HashString("AccountSetupInProgressException");
-static const int OPERATION_FAILURE_HASH = HashingUtils::HashString("OperationFailureException");
+static constexpr int UNAUTHENTICATED_HASH = HashingUtils::CompileTimeHashString("UnauthenticatedException");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInputException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int SERVICE_HASH = HashingUtils::CompileTimeHashString("ServiceException");
+static constexpr int ACCOUNT_SETUP_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("AccountSetupInProgressException");
+static constexpr int OPERATION_FAILURE_HASH = HashingUtils::CompileTimeHashString("OperationFailureException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
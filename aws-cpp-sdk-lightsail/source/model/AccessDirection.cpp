@@ -30,20 +30,30 @@ namespace Aws
       namespace AccessDirectionMapper
       {
 
-        static const int inbound_HASH = HashingUtils::HashString("inbound");
-        static const int outbound_HASH = HashingUtils::HashString("outbound");
+        static constexpr int inbound_HASH = HashingUtils::CompileTimeHashString("inbound");
+        static constexpr int outbound_HASH = HashingUtils::CompileTimeHashString("outbound");
 
 
         AccessDirection GetAccessDirectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == inbound_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccessDirection::inbound;
-          }
-          else if (hashCode == outbound_HASH)
-          {
-            return AccessDirection::outbound;
+          case inbound_HASH:
+            if (name == "inbound")
+            {
+              return AccessDirection::inbound;
+            }
+            break;
+          case outbound_HASH:
+            if (name == "outbound")
+            {
+              return AccessDirection::outbound;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AccessDirection::NOT_SET;
         }
 
-        Aws::String GetNameForAccessDirection(AccessDirection enumValue)
+        const char* GetNameForAccessDirection(AccessDirection enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace BlueprintTypeMapper
       {
 
-        static const int os_HASH = HashingUtils::HashString("os");
-        static const int app_HASH = HashingUtils::HashString("app");
+        static constexpr int os_HASH = HashingUtils::CompileTimeHashString("os");
+        static constexpr int app_HASH = HashingUtils::CompileTimeHashString("app");
 
 
         BlueprintType GetBlueprintTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == os_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BlueprintType::os;
-          }
-          else if (hashCode == app_HASH)
-          {
-            return BlueprintType::app;
+          case os_HASH:
+            if (name == "os")
+            {
+              return BlueprintType::os;
+            }
+            break;
+          case app_HASH:
+            if (name == "app")
+            {
+              return BlueprintType::app;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BlueprintType::NOT_SET;
         }
 
-        Aws::String GetNameForBlueprintType(BlueprintType enumValue)
+        const char* GetNameForBlueprintType(BlueprintType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
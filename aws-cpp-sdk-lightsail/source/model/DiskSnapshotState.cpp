@@ -30,30 +30,44 @@ namespace Aws
       namespace DiskSnapshotStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int unknown_HASH = HashingUtils::HashString("unknown");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int completed_HASH = HashingUtils::CompileTimeHashString("completed");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
+        static constexpr int unknown_HASH = HashingUtils::CompileTimeHashString("unknown");
 
 
         DiskSnapshotState GetDiskSnapshotStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DiskSnapshotState::pending;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return DiskSnapshotState::completed;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return DiskSnapshotState::error;
-          }
-          else if (hashCode == unknown_HASH)
-          {
-            return DiskSnapshotState::unknown;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return DiskSnapshotState::pending;
+            }
+            break;
+          case completed_HASH:
+            if (name == "completed")
+            {
+              return DiskSnapshotState::completed;
+            }
+            break;
+          case error_HASH:
+            if (name == "error")
+            {
+              return DiskSnapshotState::error;
+            }
+            break;
+          case unknown_HASH:
+            if (name == "unknown")
+            {
+              return DiskSnapshotState::unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DiskSnapshotState::NOT_SET;
         }
 
-        Aws::String GetNameForDiskSnapshotState(DiskSnapshotState enumValue)
+        const char* GetNameForDiskSnapshotState(DiskSnapshotState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
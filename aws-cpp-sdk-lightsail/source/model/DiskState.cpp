@@ -30,35 +30,51 @@ namespace Aws
       namespace DiskStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int available_HASH = HashingUtils::HashString("available");
-        static const int in_use_HASH = HashingUtils::HashString("in-use");
-        static const int unknown_HASH = HashingUtils::HashString("unknown");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
+        static constexpr int in_use_HASH = HashingUtils::CompileTimeHashString("in-use");
+        static constexpr int unknown_HASH = HashingUtils::CompileTimeHashString("unknown");
 
 
         DiskState GetDiskStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DiskState::pending;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return DiskState::error;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return DiskState::available;
-          }
-          else if (hashCode == in_use_HASH)
-          {
-            return DiskState::in_use;
-          }
-          else if (hashCode == unknown_HASH)
-          {
-            return DiskState::unknown;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return DiskState::pending;
+            }
+            break;
+          case error_HASH:
+            if (name == "error")
+            {
+              return DiskState::error;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return DiskState::available;
+            }
+            break;
+          case in_use_HASH:
+            if (name == "in-use")
+            {
+              return DiskState::in_use;
+            }
+            break;
+          case unknown_HASH:
+            if (name == "unknown")
+            {
+              return DiskState::unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return DiskState::NOT_SET;
         }
 
-        Aws::String GetNameForDiskState(DiskState enumValue)
+        const char* GetNameForDiskState(DiskState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace InstanceAccessProtocolMapper
       {
 
-        static const int ssh_HASH = HashingUtils::HashString("ssh");
-        static const int rdp_HASH = HashingUtils::HashString("rdp");
+        static constexpr int ssh_HASH = HashingUtils::CompileTimeHashString("ssh");
+        static constexpr int rdp_HASH = HashingUtils::CompileTimeHashString("rdp");
 
 
         InstanceAccessProtocol GetInstanceAccessProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ssh_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceAccessProtocol::ssh;
-          }
-          else if (hashCode == rdp_HASH)
-          {
-            return InstanceAccessProtocol::rdp;
+          case ssh_HASH:
+            if (name == "ssh")
+            {
+              return InstanceAccessProtocol::ssh;
+            }
+            break;
+          case rdp_HASH:
+            if (name == "rdp")
+            {
+              return InstanceAccessProtocol::rdp;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InstanceAccessProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceAccessProtocol(InstanceAccessProtocol enumValue)
+        const char* GetNameForInstanceAccessProtocol(InstanceAccessProtocol enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,65 +30,93 @@ namespace Aws
       namespace InstanceHealthReasonMapper
       {
 
-        static const int Lb_RegistrationInProgress_HASH = HashingUtils::HashString("Lb.RegistrationInProgress");
-        static const int Lb_InitialHealthChecking_HASH = HashingUtils::HashString("Lb.InitialHealthChecking");
-        static const int Lb_InternalError_HASH = HashingUtils::HashString("Lb.InternalError");
-        static const int Instance_ResponseCodeMismatch_HASH = HashingUtils::HashString("Instance.ResponseCodeMismatch");
-        static const int Instance_Timeout_HASH = HashingUtils::HashString("Instance.Timeout");
-        static const int Instance_FailedHealthChecks_HASH = HashingUtils::HashString("Instance.FailedHealthChecks");
-        static const int Instance_NotRegistered_HASH = HashingUtils::HashString("Instance.NotRegistered");
-        static const int Instance_NotInUse_HASH = HashingUtils::HashString("Instance.NotInUse");
-        static const int Instance_DeregistrationInProgress_HASH = HashingUtils::HashString("Instance.DeregistrationInProgress");
-        static const int Instance_InvalidState_HASH = HashingUtils::HashString("Instance.InvalidState");
-        static const int Instance_IpUnusable_HASH = HashingUtils::HashString("Instance.IpUnusable");
+        static constexpr int Lb_RegistrationInProgress_HASH = HashingUtils::CompileTimeHashString("Lb.RegistrationInProgress");
+        static constexpr int Lb_InitialHealthChecking_HASH = HashingUtils::CompileTimeHashString("Lb.InitialHealthChecking");
+        static constexpr int Lb_InternalError_HASH = HashingUtils::CompileTimeHashString("Lb.InternalError");
+        static constexpr int Instance_ResponseCodeMismatch_HASH = HashingUtils::CompileTimeHashString("Instance.ResponseCodeMismatch");
+        static constexpr int Instance_Timeout_HASH = HashingUtils::CompileTimeHashString("Instance.Timeout");
+        static constexpr int Instance_FailedHealthChecks_HASH = HashingUtils::CompileTimeHashString("Instance.FailedHealthChecks");
+        static constexpr int Instance_NotRegistered_HASH = HashingUtils::CompileTimeHashString("Instance.NotRegistered");
+        static constexpr int Instance_NotInUse_HASH = HashingUtils::CompileTimeHashString("Instance.NotInUse");
+        static constexpr int Instance_DeregistrationInProgress_HASH = HashingUtils::CompileTimeHashString("Instance.DeregistrationInProgress");
+        static constexpr int Instance_InvalidState_HASH = HashingUtils::CompileTimeHashString("Instance.InvalidState");
+        static constexpr int Instance_IpUnusable_HASH = HashingUtils::CompileTimeHashString("Instance.IpUnusable");
 
 
         InstanceHealthReason GetInstanceHealthReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Lb_RegistrationInProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceHealthReason::Lb_RegistrationInProgress;
-          }
-          else if (hashCode == Lb_InitialHealthChecking_HASH)
-          {
-            return InstanceHealthReason::Lb_InitialHealthChecking;
-          }
-          else if (hashCode == Lb_InternalError_HASH)
-          {
-            return InstanceHealthReason::Lb_InternalError;
-          }
-          else if (hashCode == Instance_ResponseCodeMismatch_HASH)
-          {
-            return InstanceHealthReason::Instance_ResponseCodeMismatch;
-          }
-          else if (hashCode == Instance_Timeout_HASH)
-          {
-            return InstanceHealthReason::Instance_Timeout;
-          }
-          else if (hashCode == Instance_FailedHealthChecks_HASH)
-          {
-            return InstanceHealthReason::Instance_FailedHealthChecks;
-          }
-          else if (hashCode == Instance_NotRegistered_HASH)
-          {
-            return InstanceHealthReason::Instance_NotRegistered;
-          }
-          else if (hashCode == Instance_NotInUse_HASH)
-          {
-            return InstanceHealthReason::Instance_NotInUse;
-          }
-          else if (hashCode == Instance_DeregistrationInProgress_HASH)
-          {
-            return InstanceHealthReason::Instance_DeregistrationInProgress;
-          }
-          else if (hashCode == Instance_InvalidState_HASH)
-          {
-            return InstanceHealthReason::Instance_InvalidState;
-          }
-          else if (hashCode == Instance_IpUnusable_HASH)
-          {
-            return InstanceHealthReason::Instance_IpUnusable;
+          case Lb_RegistrationInProgress_HASH:
+            if (name == "Lb.RegistrationInProgress")
+            {
+              return InstanceHealthReason::Lb_RegistrationInProgress;
+            }
+            break;
+          case Lb_InitialHealthChecking_HASH:
+            if (name == "Lb.InitialHealthChecking")
+            {
+              return InstanceHealthReason::Lb_InitialHealthChecking;
+            }
+            break;
+          case Lb_InternalError_HASH:
+            if (name == "Lb.InternalError")
+            {
+              return InstanceHealthReason::Lb_InternalError;
+            }
+            break;
+          case Instance_ResponseCodeMismatch_HASH:
+            if (name == "Instance.ResponseCodeMismatch")
+            {
+              return InstanceHealthReason::Instance_ResponseCodeMismatch;
+            }
+            break;
+          case Instance_Timeout_HASH:
+            if (name == "Instance.Timeout")
+            {
+              return InstanceHealthReason::Instance_Timeout;
+            }
+            break;
+          case Instance_FailedHealthChecks_HASH:
+            if (name == "Instance.FailedHealthChecks")
+            {
+              return InstanceHealthReason::Instance_FailedHealthChecks;
+            }
+            break;
+          case Instance_NotRegistered_HASH:
+            if (name == "Instance.NotRegistered")
+            {
+              return InstanceHealthReason::Instance_NotRegistered;
+            }
+            break;
+          case Instance_NotInUse_HASH:
+            if (name == "Instance.NotInUse")
+            {
+              return InstanceHealthReason::Instance_NotInUse;
+            }
+            break;
+          case Instance_DeregistrationInProgress_HASH:
+            if (name == "Instance.DeregistrationInProgress")
+            {
+              return InstanceHealthReason::Instance_DeregistrationInProgress;
+            }
+            break;
+          case Instance_InvalidState_HASH:
+            if (name == "Instance.InvalidState")
+            {
+              return InstanceHealthReason::Instance_InvalidState;
+            }
+            break;
+          case Instance_IpUnusable_HASH:
+            if (name == "Instance.IpUnusable")
+            {
+              return InstanceHealthReason::Instance_IpUnusable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return InstanceHealthReason::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceHealthReason(InstanceHealthReason enumValue)
+        const char* GetNameForInstanceHealthReason(InstanceHealthReason enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace InstanceHealthStateMapper
       {
 
-        static const int initial_HASH = HashingUtils::HashString("initial");
-        static const int healthy_HASH = HashingUtils::HashString("healthy");
-        static const int unhealthy_HASH = HashingUtils::HashString("unhealthy");
-        static const int unused_HASH = HashingUtils::HashString("unused");
-        static const int draining_HASH = HashingUtils::HashString("draining");
-        static const int unavailable_HASH = HashingUtils::HashString("unavailable");
+        static constexpr int initial_HASH = HashingUtils::CompileTimeHashString("initial");
+        static constexpr int healthy_HASH = HashingUtils::CompileTimeHashString("healthy");
+        static constexpr int unhealthy_HASH = HashingUtils::CompileTimeHashString("unhealthy");
+        static constexpr int unused_HASH = HashingUtils::CompileTimeHashString("unused");
+        static constexpr int draining_HASH = HashingUtils::CompileTimeHashString("draining");
+        static constexpr int unavailable_HASH = HashingUtils::CompileTimeHashString("unavailable");
 
 
         InstanceHealthState GetInstanceHealthStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == initial_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceHealthState::initial;
-          }
-          else if (hashCode == healthy_HASH)
-          {
-            return InstanceHealthState::healthy;
-          }
-          else if (hashCode == unhealthy_HASH)
-          {
-            return InstanceHealthState::unhealthy;
-          }
-          else if (hashCode == unused_HASH)
-          {
-            return InstanceHealthState::unused;
-          }
-          else if (hashCode == draining_HASH)
-          {
-            return InstanceHealthState::draining;
-          }
-          else if (hashCode == unavailable_HASH)
-          {
-            return InstanceHealthState::unavailable;
+          case initial_HASH:
+            if (name == "initial")
+            {
+              return InstanceHealthState::initial;
+            }
+            break;
+          case healthy_HASH:
+            if (name == "healthy")
+            {
+              return InstanceHealthState::healthy;
+            }
+            break;
+          case unhealthy_HASH:
+            if (name == "unhealthy")
+            {
+              return InstanceHealthState::unhealthy;
+            }
+            break;
+          case unused_HASH:
+            if (name == "unused")
+            {
+              return InstanceHealthState::unused;
+            }
+            break;
+          case draining_HASH:
+            if (name == "draining")
+            {
+              return InstanceHealthState::draining;
+            }
+            break;
+          case unavailable_HASH:
+            if (name == "unavailable")
+            {
+              return InstanceHealthState::unavailable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return InstanceHealthState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceHealthState(InstanceHealthState enumValue)
+        const char* GetNameForInstanceHealthState(InstanceHealthState enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
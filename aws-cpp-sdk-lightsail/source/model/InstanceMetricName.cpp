@@ -30,40 +30,58 @@ namespace Aws
       namespace InstanceMetricNameMapper
       {
 
-        static const int CPUUtilization_HASH = HashingUtils::HashString("CPUUtilization");
-        static const int NetworkIn_HASH = HashingUtils::HashString("NetworkIn");
-        static const int NetworkOut_HASH = HashingUtils::HashString("NetworkOut");
-        static const int StatusCheckFailed_HASH = HashingUtils::HashString("StatusCheckFailed");
-        static const int StatusCheckFailed_Instance_HASH = HashingUtils::HashString("StatusCheckFailed_Instance");
-        static const int StatusCheckFailed_System_HASH = HashingUtils::HashString("StatusCheckFailed_System");
+        static constexpr int CPUUtilization_HASH = HashingUtils::CompileTimeHashString("CPUUtilization");
+        static constexpr int NetworkIn_HASH = HashingUtils::CompileTimeHashString("NetworkIn");
+        static constexpr int NetworkOut_HASH = HashingUtils::CompileTimeHashString("NetworkOut");
+        static constexpr int StatusCheckFailed_HASH = HashingUtils::CompileTimeHashString("StatusCheckFailed");
+        static constexpr int StatusCheckFailed_Instance_HASH = HashingUtils::CompileTimeHashString("StatusCheckFailed_Instance");
+        static constexpr int StatusCheckFailed_System_HASH = HashingUtils::CompileTimeHashString("StatusCheckFailed_System");
 
 
         InstanceMetricName GetInstanceMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CPUUtilization_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceMetricName::CPUUtilization;
-          }
-          else if (hashCode == NetworkIn_HASH)
-          {
-            return InstanceMetricName::NetworkIn;
-          }
-          else if (hashCode == NetworkOut_HASH)
-          {
-            return InstanceMetricName::NetworkOut;
-          }
-          else if (hashCode == StatusCheckFailed_HASH)
-          {
-            return InstanceMetricName::StatusCheckFailed;
-          }
-          else if (hashCode == StatusCheckFailed_Instance_HASH)
-          {
-            return InstanceMetricName::StatusCheckFailed_Instance;
-          }
-          else if (hashCode == StatusCheckFailed_System_HASH)
-          {
-            return InstanceMetricName::StatusCheckFailed_System;
+          case CPUUtilization_HASH:
+            if (name == "CPUUtilization")
+            {
+              return InstanceMetricName::CPUUtilization;
+            }
+            break;
+          case NetworkIn_HASH:
+            if (name == "NetworkIn")
+            {
+              return InstanceMetricName::NetworkIn;
+            }
+            break;
+          case NetworkOut_HASH:
+            if (name == "NetworkOut")
+            {
+              return InstanceMetricName::NetworkOut;
+            }
+            break;
+          case StatusCheckFailed_HASH:
+            if (name == "StatusCheckFailed")
+            {
+              return InstanceMetricName::StatusCheckFailed;
+            }
+            break;
+          case StatusCheckFailed_Instance_HASH:
+            if (name == "StatusCheckFailed_Instance")
+            {
+              return InstanceMetricName::StatusCheckFailed_Instance;
+            }
+            break;
+          case StatusCheckFailed_System_HASH:
+            if (name == "StatusCheckFailed_System")
+            {
+              return InstanceMetricName::StatusCheckFailed_System;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return InstanceMetricName::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceMetricName(InstanceMetricName enumValue)
+        const char* GetNameForInstanceMetricName(InstanceMetricName enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
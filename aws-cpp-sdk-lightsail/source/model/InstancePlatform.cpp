@@ -30,20 +30,30 @@ namespace Aws
       namespace InstancePlatformMapper
       {
 
-        static const int LINUX_UNIX_HASH = HashingUtils::HashString("LINUX_UNIX");
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
+        static constexpr int LINUX_UNIX_HASH = HashingUtils::CompileTimeHashString("LINUX_UNIX");
+        static constexpr int WINDOWS_HASH = HashingUtils::CompileTimeHashString("WINDOWS");
 
 
         InstancePlatform GetInstancePlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LINUX_UNIX_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstancePlatform::LINUX_UNIX;
-          }
-          else if (hashCode == WINDOWS_HASH)
-          {
-            return InstancePlatform::WINDOWS;
+          case LINUX_UNIX_HASH:
+            if (name == "LINUX_UNIX")
+            {
+              return InstancePlatform::LINUX_UNIX;
+            }
+            break;
+          case WINDOWS_HASH:
+            if (name == "WINDOWS")
+            {
+              return InstancePlatform::WINDOWS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InstancePlatform::NOT_SET;
         }
 
-        Aws::String GetNameForInstancePlatform(InstancePlatform enumValue)
+        const char* GetNameForInstancePlatform(InstancePlatform enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace InstanceSnapshotStateMapper
       {
 
-        static const int pending_HASH = HashingUtils::HashString("pending");
-        static const int error_HASH = HashingUtils::HashString("error");
-        static const int available_HASH = HashingUtils::HashString("available");
+        static constexpr int pending_HASH = HashingUtils::CompileTimeHashString("pending");
+        static constexpr int error_HASH = HashingUtils::CompileTimeHashString("error");
+        static constexpr int available_HASH = HashingUtils::CompileTimeHashString("available");
 
 
         InstanceSnapshotState GetInstanceSnapshotStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceSnapshotState::pending;
-          }
-          else if (hashCode == error_HASH)
-          {
-            return InstanceSnapshotState::error;
-          }
-          else if (hashCode == available_HASH)
-          {
-            return InstanceSnapshotState::available;
+          case pending_HASH:
+            if (name == "pending")
+            {
+              return InstanceSnapshotState::pending;
+            }
+            break;
+          case error_HASH:
+            if (name == "error")
+            {
+              return InstanceSnapshotState::error;
+            }
+            break;
+          case available_HASH:
+            if (name == "available")
+            {
+              return InstanceSnapshotState::available;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InstanceSnapshotState::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceSnapshotState(InstanceSnapshotState enumValue)
+        const char* GetNameForInstanceSnapshotState(InstanceSnapshotState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
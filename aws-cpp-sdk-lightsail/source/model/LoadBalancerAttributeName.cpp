@@ -30,25 +30,37 @@ namespace Aws
       namespace LoadBalancerAttributeNameMapper
       {
 
-        static const int HealthCheckPath_HASH = HashingUtils::HashString("HealthCheckPath");
-        static const int SessionStickinessEnabled_HASH = HashingUtils::HashString("SessionStickinessEnabled");
-        static const int SessionStickiness_LB_CookieDurationSeconds_HASH = HashingUtils::HashString("SessionStickiness_LB_CookieDurationSeconds");
+        static constexpr int HealthCheckPath_HASH = HashingUtils::CompileTimeHashString("HealthCheckPath");
+        static constexpr int SessionStickinessEnabled_HASH = HashingUtils::CompileTimeHashString("SessionStickinessEnabled");
+        static constexpr int SessionStickiness_LB_CookieDurationSeconds_HASH = HashingUtils::CompileTimeHashString("SessionStickiness_LB_CookieDurationSeconds");
 
 
         LoadBalancerAttributeName GetLoadBalancerAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HealthCheckPath_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerAttributeName::HealthCheckPath;
-          }
-          else if (hashCode == SessionStickinessEnabled_HASH)
-          {
-            return LoadBalancerAttributeName::SessionStickinessEnabled;
-          }
-          else if (hashCode == SessionStickiness_LB_CookieDurationSeconds_HASH)
-          {
-            return LoadBalancerAttributeName::SessionStickiness_LB_CookieDurationSeconds;
+          case HealthCheckPath_HASH:
+            if (name == "HealthCheckPath")
+            {
+              return LoadBalancerAttributeName::HealthCheckPath;
+            }
+            break;
+          case SessionStickinessEnabled_HASH:
+            if (name == "SessionStickinessEnabled")
+            {
+              return LoadBalancerAttributeName::SessionStickinessEnabled;
+            }
+            break;
+          case SessionStickiness_LB_CookieDurationSeconds_HASH:
+            if (name == "SessionStickiness_LB_CookieDurationSeconds")
+            {
+              return LoadBalancerAttributeName::SessionStickiness_LB_CookieDurationSeconds;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return LoadBalancerAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerAttributeName(LoadBalancerAttributeName enumValue)
+        const char* GetNameForLoadBalancerAttributeName(LoadBalancerAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
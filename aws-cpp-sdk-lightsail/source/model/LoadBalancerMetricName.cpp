@@ -30,70 +30,100 @@ namespace Aws
       namespace LoadBalancerMetricNameMapper
       {
 
-        static const int ClientTLSNegotiationErrorCount_HASH = HashingUtils::HashString("ClientTLSNegotiationErrorCount");
-        static const int HealthyHostCount_HASH = HashingUtils::HashString("HealthyHostCount");
-        static const int UnhealthyHostCount_HASH = HashingUtils::HashString("UnhealthyHostCount");
-        static const int HTTPCode_LB_4XX_Count_HASH = HashingUtils::HashString("HTTPCode_LB_4XX_Count");
-        static const int HTTPCode_LB_5XX_Count_HASH = HashingUtils::HashString("HTTPCode_LB_5XX_Count");
-        static const int HTTPCode_Instance_2XX_Count_HASH = HashingUtils::HashString("HTTPCode_Instance_2XX_Count");
-        static const int HTTPCode_Instance_3XX_Count_HASH = HashingUtils::HashString("HTTPCode_Instance_3XX_Count");
-        static const int HTTPCode_Instance_4XX_Count_HASH = HashingUtils::HashString("HTTPCode_Instance_4XX_Count");
-        static const int HTTPCode_Instance_5XX_Count_HASH = HashingUtils::HashString("HTTPCode_Instance_5XX_Count");
-        static const int InstanceResponseTime_HASH = HashingUtils::HashString("InstanceResponseTime");
-        static const int RejectedConnectionCount_HASH = HashingUtils::HashString("RejectedConnectionCount");
-        static const int RequestCount_HASH = HashingUtils::HashString("RequestCount");
+        static constexpr int ClientTLSNegotiationErrorCount_HASH = HashingUtils::CompileTimeHashString("ClientTLSNegotiationErrorCount");
+        static constexpr int HealthyHostCount_HASH = HashingUtils::CompileTimeHashString("HealthyHostCount");
+        static constexpr int UnhealthyHostCount_HASH = HashingUtils::CompileTimeHashString("UnhealthyHostCount");
+        static constexpr int HTTPCode_LB_4XX_Count_HASH = HashingUtils::CompileTimeHashString("HTTPCode_LB_4XX_Count");
+        static constexpr int HTTPCode_LB_5XX_Count_HASH = HashingUtils::CompileTimeHashString("HTTPCode_LB_5XX_Count");
+        static constexpr int HTTPCode_Instance_2XX_Count_HASH = HashingUtils::CompileTimeHashString("HTTPCode_Instance_2XX_Count");
+        static constexpr int HTTPCode_Instance_3XX_Count_HASH = HashingUtils::CompileTimeHashString("HTTPCode_Instance_3XX_Count");
+        static constexpr int HTTPCode_Instance_4XX_Count_HASH = HashingUtils::CompileTimeHashString("HTTPCode_Instance_4XX_Count");
+        static constexpr int HTTPCode_Instance_5XX_Count_HASH = HashingUtils::CompileTimeHashString("HTTPCode_Instance_5XX_Count");
+        static constexpr int InstanceResponseTime_HASH = HashingUtils::CompileTimeHashString("InstanceResponseTime");
+        static constexpr int RejectedConnectionCount_HASH = HashingUtils::CompileTimeHashString("RejectedConnectionCount");
+        static constexpr int RequestCount_HASH = HashingUtils::CompileTimeHashString("RequestCount");
 
 
         LoadBalancerMetricName GetLoadBalancerMetricNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ClientTLSNegotiationErrorCount_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerMetricName::ClientTLSNegotiationErrorCount;
-          }
-          else if (hashCode == HealthyHostCount_HASH)
-          {
-            return LoadBalancerMetricName::HealthyHostCount;
-          }
-          else if (hashCode == UnhealthyHostCount_HASH)
-          {
-            return LoadBalancerMetricName::UnhealthyHostCount;
-          }
-          else if (hashCode == HTTPCode_LB_4XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_LB_4XX_Count;
-          }
-          else if (hashCode == HTTPCode_LB_5XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_LB_5XX_Count;
-          }
-          else if (hashCode == HTTPCode_Instance_2XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_Instance_2XX_Count;
-          }
-          else if (hashCode == HTTPCode_Instance_3XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_Instance_3XX_Count;
-          }
-          else if (hashCode == HTTPCode_Instance_4XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_Instance_4XX_Count;
-          }
-          else if (hashCode == HTTPCode_Instance_5XX_Count_HASH)
-          {
-            return LoadBalancerMetricName::HTTPCode_Instance_5XX_Count;
-          }
-          else if (hashCode == InstanceResponseTime_HASH)
-          {
-            return LoadBalancerMetricName::InstanceResponseTime;
-          }
-          else if (hashCode == RejectedConnectionCount_HASH)
-          {
-            return LoadBalancerMetricName::RejectedConnectionCount;
-          }
-          else if (hashCode == RequestCount_HASH)
-          {
-            return LoadBalancerMetricName::RequestCount;
+          case ClientTLSNegotiationErrorCount_HASH:
+            if (name == "ClientTLSNegotiationErrorCount")
+            {
+              return LoadBalancerMetricName::ClientTLSNegotiationErrorCount;
+            }
+            break;
+          case HealthyHostCount_HASH:
+            if (name == "HealthyHostCount")
+            {
+              return LoadBalancerMetricName::HealthyHostCount;
+            }
+            break;
+          case UnhealthyHostCount_HASH:
+            if (name == "UnhealthyHostCount")
+            {
+              return LoadBalancerMetricName::UnhealthyHostCount;
+            }
+            break;
+          case HTTPCode_LB_4XX_Count_HASH:
+            if (name == "HTTPCode_LB_4XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_LB_4XX_Count;
+            }
+            break;
+          case HTTPCode_LB_5XX_Count_HASH:
+            if (name == "HTTPCode_LB_5XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_LB_5XX_Count;
+            }
+            break;
+          case HTTPCode_Instance_2XX_Count_HASH:
+            if (name == "HTTPCode_Instance_2XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_Instance_2XX_Count;
+            }
+            break;
+          case HTTPCode_Instance_3XX_Count_HASH:
+            if (name == "HTTPCode_Instance_3XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_Instance_3XX_Count;
+            }
+            break;
+          case HTTPCode_Instance_4XX_Count_HASH:
+            if (name == "HTTPCode_Instance_4XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_Instance_4XX_Count;
+            }
+            break;
+          case HTTPCode_Instance_5XX_Count_HASH:
+            if (name == "HTTPCode_Instance_5XX_Count")
+            {
+              return LoadBalancerMetricName::HTTPCode_Instance_5XX_Count;
+            }
+            break;
+          case InstanceResponseTime_HASH:
+            if (name == "InstanceResponseTime")
+            {
+              return LoadBalancerMetricName::InstanceResponseTime;
+            }
+            break;
+          case RejectedConnectionCount_HASH:
+            if (name == "RejectedConnectionCount")
+            {
+              return LoadBalancerMetricName::RejectedConnectionCount;
+            }
+            break;
+          case RequestCount_HASH:
+            if (name == "RequestCount")
+            {
+              return LoadBalancerMetricName::RequestCount;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return LoadBalancerMetricName::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerMetricName(LoadBalancerMetricName enumValue)
+        const char* GetNameForLoadBalancerMetricName(LoadBalancerMetricName enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
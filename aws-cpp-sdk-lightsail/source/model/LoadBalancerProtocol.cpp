@@ -30,20 +30,30 @@ namespace Aws
       namespace LoadBalancerProtocolMapper
       {
 
-        static const int HTTP_HTTPS_HASH = HashingUtils::HashString("HTTP_HTTPS");
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
+        static constexpr int HTTP_HTTPS_HASH = HashingUtils::CompileTimeHashString("HTTP_HTTPS");
+        static constexpr int HTTP_HASH = HashingUtils::CompileTimeHashString("HTTP");
 
 
         LoadBalancerProtocol GetLoadBalancerProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HTTPS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerProtocol::HTTP_HTTPS;
-          }
-          else if (hashCode == HTTP_HASH)
-          {
-            return LoadBalancerProtocol::HTTP;
+          case HTTP_HTTPS_HASH:
+            if (name == "HTTP_HTTPS")
+            {
+              return LoadBalancerProtocol::HTTP_HTTPS;
+            }
+            break;
+          case HTTP_HASH:
+            if (name == "HTTP")
+            {
+              return LoadBalancerProtocol::HTTP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LoadBalancerProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerProtocol(LoadBalancerProtocol enumValue)
+        const char* GetNameForLoadBalancerProtocol(LoadBalancerProtocol enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
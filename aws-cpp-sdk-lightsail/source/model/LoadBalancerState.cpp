@@ -30,35 +30,51 @@ namespace Aws
       namespace LoadBalancerStateMapper
       {
 
-        static const int active_HASH = HashingUtils::HashString("active");
-        static const int provisioning_HASH = HashingUtils::HashString("provisioning");
-        static const int active_impaired_HASH = HashingUtils::HashString("active_impaired");
-        static const int failed_HASH = HashingUtils::HashString("failed");
-        static const int unknown_HASH = HashingUtils::HashString("unknown");
+        static constexpr int active_HASH = HashingUtils::CompileTimeHashString("active");
+        static constexpr int provisioning_HASH = HashingUtils::CompileTimeHashString("provisioning");
+        static constexpr int active_impaired_HASH = HashingUtils::CompileTimeHashString("active_impaired");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
+        static constexpr int unknown_HASH = HashingUtils::CompileTimeHashString("unknown");
 
 
         LoadBalancerState GetLoadBalancerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerState::active;
-          }
-          else if (hashCode == provisioning_HASH)
-          {
-            return LoadBalancerState::provisioning;
-          }
-          else if (hashCode == active_impaired_HASH)
-          {
-            return LoadBalancerState::active_impaired;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return LoadBalancerState::failed;
-          }
-          else if (hashCode == unknown_HASH)
-          {
-            return LoadBalancerState::unknown;
+          case active_HASH:
+            if (name == "active")
+            {
+              return LoadBalancerState::active;
+            }
+            break;
+          case provisioning_HASH:
+            if (name == "provisioning")
+            {
+              return LoadBalancerState::provisioning;
+            }
+            break;
+          case active_impaired_HASH:
+            if (name == "active_impaired")
+            {
+              return LoadBalancerState::active_impaired;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return LoadBalancerState::failed;
+            }
+            break;
+          case unknown_HASH:
+            if (name == "unknown")
+            {
+              return LoadBalancerState::unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return LoadBalancerState::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerState(LoadBalancerState enumValue)
+        const char* GetNameForLoadBalancerState(LoadBalancerState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace LoadBalancerTlsCertificateDomainStatusMapper
       {
 
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
+        static constexpr int PENDING_VALIDATION_HASH = HashingUtils::CompileTimeHashString("PENDING_VALIDATION");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
 
 
         LoadBalancerTlsCertificateDomainStatus GetLoadBalancerTlsCertificateDomainStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VALIDATION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerTlsCertificateDomainStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return LoadBalancerTlsCertificateDomainStatus::FAILED;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return LoadBalancerTlsCertificateDomainStatus::SUCCESS;
+          case PENDING_VALIDATION_HASH:
+            if (name == "PENDING_VALIDATION")
+            {
+              return LoadBalancerTlsCertificateDomainStatus::PENDING_VALIDATION;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return LoadBalancerTlsCertificateDomainStatus::FAILED;
+            }
+            break;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return LoadBalancerTlsCertificateDomainStatus::SUCCESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return LoadBalancerTlsCertificateDomainStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTlsCertificateDomainStatus(LoadBalancerTlsCertificateDomainStatus enumValue)
+        const char* GetNameForLoadBalancerTlsCertificateDomainStatus(LoadBalancerTlsCertificateDomainStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace LoadBalancerTlsCertificateFailureReasonMapper
       {
 
-        static const int NO_AVAILABLE_CONTACTS_HASH = HashingUtils::HashString("NO_AVAILABLE_CONTACTS");
-        static const int ADDITIONAL_VERIFICATION_REQUIRED_HASH = HashingUtils::HashString("ADDITIONAL_VERIFICATION_REQUIRED");
-        static const int DOMAIN_NOT_ALLOWED_HASH = HashingUtils::HashString("DOMAIN_NOT_ALLOWED");
-        static const int INVALID_PUBLIC_DOMAIN_HASH = HashingUtils::HashString("INVALID_PUBLIC_DOMAIN");
-        static const int OTHER_HASH = HashingUtils::HashString("OTHER");
+        static constexpr int NO_AVAILABLE_CONTACTS_HASH = HashingUtils::CompileTimeHashString("NO_AVAILABLE_CONTACTS");
+        static constexpr int ADDITIONAL_VERIFICATION_REQUIRED_HASH = HashingUtils::CompileTimeHashString("ADDITIONAL_VERIFICATION_REQUIRED");
+        static constexpr int DOMAIN_NOT_ALLOWED_HASH = HashingUtils::CompileTimeHashString("DOMAIN_NOT_ALLOWED");
+        static constexpr int INVALID_PUBLIC_DOMAIN_HASH = HashingUtils::CompileTimeHashString("INVALID_PUBLIC_DOMAIN");
+        static constexpr int OTHER_HASH = HashingUtils::CompileTimeHashString("OTHER");
 
 
         LoadBalancerTlsCertificateFailureReason GetLoadBalancerTlsCertificateFailureReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_AVAILABLE_CONTACTS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerTlsCertificateFailureReason::NO_AVAILABLE_CONTACTS;
-          }
-          else if (hashCode == ADDITIONAL_VERIFICATION_REQUIRED_HASH)
-          {
-            return LoadBalancerTlsCertificateFailureReason::ADDITIONAL_VERIFICATION_REQUIRED;
-          }
-          else if (hashCode == DOMAIN_NOT_ALLOWED_HASH)
-          {
-            return LoadBalancerTlsCertificateFailureReason::DOMAIN_NOT_ALLOWED;
-          }
-          else if (hashCode == INVALID_PUBLIC_DOMAIN_HASH)
-          {
-            return LoadBalancerTlsCertificateFailureReason::INVALID_PUBLIC_DOMAIN;
-          }
-          else if (hashCode == OTHER_HASH)
-          {
-            return LoadBalancerTlsCertificateFailureReason::OTHER;
+          case NO_AVAILABLE_CONTACTS_HASH:
+            if (name == "NO_AVAILABLE_CONTACTS")
+            {
+              return LoadBalancerTlsCertificateFailureReason::NO_AVAILABLE_CONTACTS;
+            }
+            break;
+          case ADDITIONAL_VERIFICATION_REQUIRED_HASH:
+            if (name == "ADDITIONAL_VERIFICATION_REQUIRED")
+            {
+              return LoadBalancerTlsCertificateFailureReason::ADDITIONAL_VERIFICATION_REQUIRED;
+            }
+            break;
+          case DOMAIN_NOT_ALLOWED_HASH:
+            if (name == "DOMAIN_NOT_ALLOWED")
+            {
+              return LoadBalancerTlsCertificateFailureReason::DOMAIN_NOT_ALLOWED;
+            }
+            break;
+          case INVALID_PUBLIC_DOMAIN_HASH:
+            if (name == "INVALID_PUBLIC_DOMAIN")
+            {
+              return LoadBalancerTlsCertificateFailureReason::INVALID_PUBLIC_DOMAIN;
+            }
+            break;
+          case OTHER_HASH:
+            if (name == "OTHER")
+            {
+              return LoadBalancerTlsCertificateFailureReason::OTHER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return LoadBalancerTlsCertificateFailureReason::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTlsCertificateFailureReason(LoadBalancerTlsCertificateFailureReason enumValue)
+        const char* GetNameForLoadBalancerTlsCertificateFailureReason(LoadBalancerTlsCertificateFailureReason enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
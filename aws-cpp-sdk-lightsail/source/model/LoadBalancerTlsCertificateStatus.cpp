@@ -30,50 +30,72 @@ namespace Aws
       namespace LoadBalancerTlsCertificateStatusMapper
       {
 
-        static const int PENDING_VALIDATION_HASH = HashingUtils::HashString("PENDING_VALIDATION");
-        static const int ISSUED_HASH = HashingUtils::HashString("ISSUED");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int VALIDATION_TIMED_OUT_HASH = HashingUtils::HashString("VALIDATION_TIMED_OUT");
-        static const int REVOKED_HASH = HashingUtils::HashString("REVOKED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
+        static constexpr int PENDING_VALIDATION_HASH = HashingUtils::CompileTimeHashString("PENDING_VALIDATION");
+        static constexpr int ISSUED_HASH = HashingUtils::CompileTimeHashString("ISSUED");
+        static constexpr int INACTIVE_HASH = HashingUtils::CompileTimeHashString("INACTIVE");
+        static constexpr int EXPIRED_HASH = HashingUtils::CompileTimeHashString("EXPIRED");
+        static constexpr int VALIDATION_TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("VALIDATION_TIMED_OUT");
+        static constexpr int REVOKED_HASH = HashingUtils::CompileTimeHashString("REVOKED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
 
 
         LoadBalancerTlsCertificateStatus GetLoadBalancerTlsCertificateStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_VALIDATION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LoadBalancerTlsCertificateStatus::PENDING_VALIDATION;
-          }
-          else if (hashCode == ISSUED_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::ISSUED;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::INACTIVE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::EXPIRED;
-          }
-          else if (hashCode == VALIDATION_TIMED_OUT_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::VALIDATION_TIMED_OUT;
-          }
-          else if (hashCode == REVOKED_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::REVOKED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::FAILED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return LoadBalancerTlsCertificateStatus::UNKNOWN;
+          case PENDING_VALIDATION_HASH:
+            if (name == "PENDING_VALIDATION")
+            {
+              return LoadBalancerTlsCertificateStatus::PENDING_VALIDATION;
+            }
+            break;
+          case ISSUED_HASH:
+            if (name == "ISSUED")
+            {
+              return LoadBalancerTlsCertificateStatus::ISSUED;
+            }
+            break;
+          case INACTIVE_HASH:
+            if (name == "INACTIVE")
+            {
+              return LoadBalancerTlsCertificateStatus::INACTIVE;
+            }
+            break;
+          case EXPIRED_HASH:
+            if (name == "EXPIRED")
+            {
+              return LoadBalancerTlsCertificateStatus::EXPIRED;
+            }
+            break;
+          case VALIDATION_TIMED_OUT_HASH:
+            if (name == "VALIDATION_TIMED_OUT")
+            {
+              return LoadBalancerTlsCertificateStatus::VALIDATION_TIMED_OUT;
+            }
+            break;
+          case REVOKED_HASH:
+            if (name == "REVOKED")
+            {
+              return LoadBalancerTlsCertificateStatus::REVOKED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return LoadBalancerTlsCertificateStatus::FAILED;
+            }
+            break;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return LoadBalancerTlsCertificateStatus::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return LoadBalancerTlsCertificateStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLoadBalancerTlsCertificateStatus(LoadBalancerTlsCertificateStatus enumValue)
+        const char* GetNameForLoadBalancerTlsCertificateStatus(LoadBalancerTlsCertificateStatus enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
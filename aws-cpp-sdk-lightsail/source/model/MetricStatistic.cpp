@@ -30,35 +30,51 @@ namespace Aws
       namespace MetricStatisticMapper
       {
 
-        static const int Minimum_HASH = HashingUtils::HashString("Minimum");
-        static const int Maximum_HASH = HashingUtils::HashString("Maximum");
-        static const int Sum_HASH = HashingUtils::HashString("Sum");
-        static const int Average_HASH = HashingUtils::HashString("Average");
-        static const int SampleCount_HASH = HashingUtils::HashString("SampleCount");
+        static constexpr int Minimum_HASH = HashingUtils::CompileTimeHashString("Minimum");
+        static constexpr int Maximum_HASH = HashingUtils::CompileTimeHashString("Maximum");
+        static constexpr int Sum_HASH = HashingUtils::CompileTimeHashString("Sum");
+        static constexpr int Average_HASH = HashingUtils::CompileTimeHashString("Average");
+        static constexpr int SampleCount_HASH = HashingUtils::CompileTimeHashString("SampleCount");
 
 
         MetricStatistic GetMetricStatisticForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Minimum_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MetricStatistic::Minimum;
-          }
-          else if (hashCode == Maximum_HASH)
-          {
-            return MetricStatistic::Maximum;
-          }
-          else if (hashCode == Sum_HASH)
-          {
-            return MetricStatistic::Sum;
-          }
-          else if (hashCode == Average_HASH)
-          {
-            return MetricStatistic::Average;
-          }
-          else if (hashCode == SampleCount_HASH)
-          {
-            return MetricStatistic::SampleCount;
+          case Minimum_HASH:
+            if (name == "Minimum")
+            {
+              return MetricStatistic::Minimum;
+            }
+            break;
+          case Maximum_HASH:
+            if (name == "Maximum")
+            {
+              return MetricStatistic::Maximum;
+            }
+            break;
+          case Sum_HASH:
+            if (name == "Sum")
+            {
+              return MetricStatistic::Sum;
+            }
+            break;
+          case Average_HASH:
+            if (name == "Average")
+            {
+              return MetricStatistic::Average;
+            }
+            break;
+          case SampleCount_HASH:
+            if (name == "SampleCount")
+            {
+              return MetricStatistic::SampleCount;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return MetricStatistic::NOT_SET;
         }
 
-        Aws::String GetNameForMetricStatistic(MetricStatistic enumValue)
+        const char* GetNameForMetricStatistic(MetricStatistic enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,145 +30,205 @@ namespace Aws
       namespace MetricUnitMapper
       {
 
-        static const int Seconds_HASH = HashingUtils::HashString("Seconds");
-        static const int Microseconds_HASH = HashingUtils::HashString("Microseconds");
-        static const int Milliseconds_HASH = HashingUtils::HashString("Milliseconds");
-        static const int Bytes_HASH = HashingUtils::HashString("Bytes");
-        static const int Kilobytes_HASH = HashingUtils::HashString("Kilobytes");
-        static const int Megabytes_HASH = HashingUtils::HashString("Megabytes");
-        static const int Gigabytes_HASH = HashingUtils::HashString("Gigabytes");
-        static const int Terabytes_HASH = HashingUtils::HashString("Terabytes");
-        static const int Bits_HASH = HashingUtils::HashString("Bits");
-        static const int Kilobits_HASH = HashingUtils::HashString("Kilobits");
-        static const int Megabits_HASH = HashingUtils::HashString("Megabits");
-        static const int Gigabits_HASH = HashingUtils::HashString("Gigabits");
-        static const int Terabits_HASH = HashingUtils::HashString("Terabits");
-        static const int Percent_HASH = HashingUtils::HashString("Percent");
-        static const int Count_HASH = HashingUtils::HashString("Count");
-        static const int Bytes_Second_HASH = HashingUtils::HashString("Bytes/Second");
-        static const int Kilobytes_Second_HASH = HashingUtils::HashString("Kilobytes/Second");
-        static const int Megabytes_Second_HASH = HashingUtils::HashString("Megabytes/Second");
-        static const int Gigabytes_Second_HASH = HashingUtils::HashString("Gigabytes/Second");
-        static const int Terabytes_Second_HASH = HashingUtils::HashString("Terabytes/Second");
-        static const int Bits_Second_HASH = HashingUtils::HashString("Bits/Second");
-        static const int Kilobits_Second_HASH = HashingUtils::HashString("Kilobits/Second");
-        static const int Megabits_Second_HASH = HashingUtils::HashString("Megabits/Second");
-        static const int Gigabits_Second_HASH = HashingUtils::HashString("Gigabits/Second");
-        static const int Terabits_Second_HASH = HashingUtils::HashString("Terabits/Second");
-        static const int Count_Second_HASH = HashingUtils::HashString("Count/Second");
-        static const int None_HASH = HashingUtils::HashString("None");
+        static constexpr int Seconds_HASH = HashingUtils::CompileTimeHashString("Seconds");
+        static constexpr int Microseconds_HASH = HashingUtils::CompileTimeHashString("Microseconds");
+        static constexpr int Milliseconds_HASH = HashingUtils::CompileTimeHashString("Milliseconds");
+        static constexpr int Bytes_HASH = HashingUtils::CompileTimeHashString("Bytes");
+        static constexpr int Kilobytes_HASH = HashingUtils::CompileTimeHashString("Kilobytes");
+        static constexpr int Megabytes_HASH = HashingUtils::CompileTimeHashString("Megabytes");
+        static constexpr int Gigabytes_HASH = HashingUtils::CompileTimeHashString("Gigabytes");
+        static constexpr int Terabytes_HASH = HashingUtils::CompileTimeHashString("Terabytes");
+        static constexpr int Bits_HASH = HashingUtils::CompileTimeHashString("Bits");
+        static constexpr int Kilobits_HASH = HashingUtils::CompileTimeHashString("Kilobits");
+        static constexpr int Megabits_HASH = HashingUtils::CompileTimeHashString("Megabits");
+        static constexpr int Gigabits_HASH = HashingUtils::CompileTimeHashString("Gigabits");
+        static constexpr int Terabits_HASH = HashingUtils::CompileTimeHashString("Terabits");
+        static constexpr int Percent_HASH = HashingUtils::CompileTimeHashString("Percent");
+        static constexpr int Count_HASH = HashingUtils::CompileTimeHashString("Count");
+        static constexpr int Bytes_Second_HASH = HashingUtils::CompileTimeHashString("Bytes/Second");
+        static constexpr int Kilobytes_Second_HASH = HashingUtils::CompileTimeHashString("Kilobytes/Second");
+        static constexpr int Megabytes_Second_HASH = HashingUtils::CompileTimeHashString("Megabytes/Second");
+        static constexpr int Gigabytes_Second_HASH = HashingUtils::CompileTimeHashString("Gigabytes/Second");
+        static constexpr int Terabytes_Second_HASH = HashingUtils::CompileTimeHashString("Terabytes/Second");
+        static constexpr int Bits_Second_HASH = HashingUtils::CompileTimeHashString("Bits/Second");
+        static constexpr int Kilobits_Second_HASH = HashingUtils::CompileTimeHashString("Kilobits/Second");
+        static constexpr int Megabits_Second_HASH = HashingUtils::CompileTimeHashString("Megabits/Second");
+        static constexpr int Gigabits_Second_HASH = HashingUtils::CompileTimeHashString("Gigabits/Second");
+        static constexpr int Terabits_Second_HASH = HashingUtils::CompileTimeHashString("Terabits/Second");
+        static constexpr int Count_Second_HASH = HashingUtils::CompileTimeHashString("Count/Second");
+        static constexpr int None_HASH = HashingUtils::CompileTimeHashString("None");
 
 
         MetricUnit GetMetricUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Seconds_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MetricUnit::Seconds;
-          }
-          else if (hashCode == Microseconds_HASH)
-          {
-            return MetricUnit::Microseconds;
-          }
-          else if (hashCode == Milliseconds_HASH)
-          {
-            return MetricUnit::Milliseconds;
-          }
-          else if (hashCode == Bytes_HASH)
-          {
-            return MetricUnit::Bytes;
-          }
-          else if (hashCode == Kilobytes_HASH)
-          {
-            return MetricUnit::Kilobytes;
-          }
-          else if (hashCode == Megabytes_HASH)
-          {
-            return MetricUnit::Megabytes;
-          }
-          else if (hashCode == Gigabytes_HASH)
-          {
-            return MetricUnit::Gigabytes;
-          }
-          else if (hashCode == Terabytes_HASH)
-          {
-            return MetricUnit::Terabytes;
-          }
-          else if (hashCode == Bits_HASH)
-          {
-            return MetricUnit::Bits;
-          }
-          else if (hashCode == Kilobits_HASH)
-          {
-            return MetricUnit::Kilobits;
-          }
-          else if (hashCode == Megabits_HASH)
-          {
-            return MetricUnit::Megabits;
-          }
-          else if (hashCode == Gigabits_HASH)
-          {
-            return MetricUnit::Gigabits;
-          }
-          else if (hashCode == Terabits_HASH)
-          {
-            return MetricUnit::Terabits;
-          }
-          else if (hashCode == Percent_HASH)
-          {
-            return MetricUnit::Percent;
-          }
-          else if (hashCode == Count_HASH)
-          {
-            return MetricUnit::Count;
-          }
-          else if (hashCode == Bytes_Second_HASH)
-          {
-            return MetricUnit::Bytes_Second;
-          }
-          else if (hashCode == Kilobytes_Second_HASH)
-          {
-            return MetricUnit::Kilobytes_Second;
-          }
-          else if (hashCode == Megabytes_Second_HASH)
-          {
-            return MetricUnit::Megabytes_Second;
-          }
-          else if (hashCode == Gigabytes_Second_HASH)
-          {
-            return MetricUnit::Gigabytes_Second;
-          }
-          else if (hashCode == Terabytes_Second_HASH)
-          {
-            return MetricUnit::Terabytes_Second;
-          }
-          else if (hashCode == Bits_Second_HASH)
-          {
-            return MetricUnit::Bits_Second;
-          }
-          else if (hashCode == Kilobits_Second_HASH)
-          {
-            return MetricUnit::Kilobits_Second;
-          }
-          else if (hashCode == Megabits_Second_HASH)
-          {
-            return MetricUnit::Megabits_Second;
-          }
-          else if (hashCode == Gigabits_Second_HASH)
-          {
-            return MetricUnit::Gigabits_Second;
-          }
-          else if (hashCode == Terabits_Second_HASH)
-          {
-            return MetricUnit::Terabits_Second;
-          }
-          else if (hashCode == Count_Second_HASH)
-          {
-            return MetricUnit::Count_Second;
-          }
-          else if (hashCode == None_HASH)
-          {
-            return MetricUnit::None;
+          case Seconds_HASH:
+            if (name == "Seconds")
+            {
+              return MetricUnit::Seconds;
+            }
+            break;
+          case Microseconds_HASH:
+            if (name == "Microseconds")
+            {
+              return MetricUnit::Microseconds;
+            }
+            break;
+          case Milliseconds_HASH:
+            if (name == "Milliseconds")
+            {
+              return MetricUnit::Milliseconds;
+            }
+            break;
+          case Bytes_HASH:
+            if (name == "Bytes")
+            {
+              return MetricUnit::Bytes;
+            }
+            break;
+          case Kilobytes_HASH:
+            if (name == "Kilobytes")
+            {
+              return MetricUnit::Kilobytes;
+            }
+            break;
+          case Megabytes_HASH:
+            if (name == "Megabytes")
+            {
+              return MetricUnit::Megabytes;
+            }
+            break;
+          case Gigabytes_HASH:
+            if (name == "Gigabytes")
+            {
+              return MetricUnit::Gigabytes;
+            }
+            break;
+          case Terabytes_HASH:
+            if (name == "Terabytes")
+            {
+              return MetricUnit::Terabytes;
+            }
+            break;
+          case Bits_HASH:
+            if (name == "Bits")
+            {
+              return MetricUnit::Bits;
+            }
+            break;
+          case Kilobits_HASH:
+            if (name == "Kilobits")
+            {
+              return MetricUnit::Kilobits;
+            }
+            break;
+          case Megabits_HASH:
+            if (name == "Megabits")
+            {
+              return MetricUnit::Megabits;
+            }
+            break;
+          case Gigabits_HASH:
+            if (name == "Gigabits")
+            {
+              return MetricUnit::Gigabits;
+            }
+            break;
+          case Terabits_HASH:
+            if (name == "Terabits")
+            {
+              return MetricUnit::Terabits;
+            }
+            break;
+          case Percent_HASH:
+            if (name == "Percent")
+            {
+              return MetricUnit::Percent;
+            }
+            break;
+          case Count_HASH:
+            if (name == "Count")
+            {
+              return MetricUnit::Count;
+            }
+            break;
+          case Bytes_Second_HASH:
+            if (name == "Bytes/Second")
+            {
+              return MetricUnit::Bytes_Second;
+            }
+            break;
+          case Kilobytes_Second_HASH:
+            if (name == "Kilobytes/Second")
+            {
+              return MetricUnit::Kilobytes_Second;
+            }
+            break;
+          case Megabytes_Second_HASH:
+            if (name == "Megabytes/Second")
+            {
+              return MetricUnit::Megabytes_Second;
+            }
+            break;
+          case Gigabytes_Second_HASH:
+            if (name == "Gigabytes/Second")
+            {
+              return MetricUnit::Gigabytes_Second;
+            }
+            break;
+          case Terabytes_Second_HASH:
+            if (name == "Terabytes/Second")
+            {
+              return MetricUnit::Terabytes_Second;
+            }
+            break;
+          case Bits_Second_HASH:
+            if (name == "Bits/Second")
+            {
+              return MetricUnit::Bits_Second;
+            }
+            break;
+          case Kilobits_Second_HASH:
+            if (name == "Kilobits/Second")
+            {
+              return MetricUnit::Kilobits_Second;
+            }
+            break;
+          case Megabits_Second_HASH:
+            if (name == "Megabits/Second")
+            {
+              return MetricUnit::Megabits_Second;
+            }
+            break;
+          case Gigabits_Second_HASH:
+            if (name == "Gigabits/Second")
+            {
+              return MetricUnit::Gigabits_Second;
+            }
+            break;
+          case Terabits_Second_HASH:
+            if (name == "Terabits/Second")
+            {
+              return MetricUnit::Terabits_Second;
+            }
+            break;
+          case Count_Second_HASH:
+            if (name == "Count/Second")
+            {
+              return MetricUnit::Count_Second;
+            }
+            break;
+          case None_HASH:
+            if (name == "None")
+            {
+              return MetricUnit::None;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -180,7 +240,7 @@ namespace Aws
           return MetricUnit::NOT_SET;
         }
 
-        Aws::String GetNameForMetricUnit(MetricUnit enumValue)
+        const char* GetNameForMetricUnit(MetricUnit enumValue)
         {
           switch(enumValue)
           {
@@ -242,7 +302,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
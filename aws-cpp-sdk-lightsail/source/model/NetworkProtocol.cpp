@@ -30,25 +30,37 @@ namespace Aws
       namespace NetworkProtocolMapper
       {
 
-        static const int tcp_HASH = HashingUtils::HashString("tcp");
-        static const int all_HASH = HashingUtils::HashString("all");
-        static const int udp_HASH = HashingUtils::HashString("udp");
+        static constexpr int tcp_HASH = HashingUtils::CompileTimeHashString("tcp");
+        static constexpr int all_HASH = HashingUtils::CompileTimeHashString("all");
+        static constexpr int udp_HASH = HashingUtils::CompileTimeHashString("udp");
 
 
         NetworkProtocol GetNetworkProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == tcp_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NetworkProtocol::tcp;
-          }
-          else if (hashCode == all_HASH)
-          {
-            return NetworkProtocol::all;
-          }
-          else if (hashCode == udp_HASH)
-          {
-            return NetworkProtocol::udp;
+          case tcp_HASH:
+            if (name == "tcp")
+            {
+              return NetworkProtocol::tcp;
+            }
+            break;
+          case all_HASH:
+            if (name == "all")
+            {
+              return NetworkProtocol::all;
+            }
+            break;
+          case udp_HASH:
+            if (name == "udp")
+            {
+              return NetworkProtocol::udp;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return NetworkProtocol::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkProtocol(NetworkProtocol enumValue)
+        const char* GetNameForNetworkProtocol(NetworkProtocol enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
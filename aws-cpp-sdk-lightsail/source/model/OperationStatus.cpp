@@ -30,35 +30,51 @@ namespace Aws
       namespace OperationStatusMapper
       {
 
-        static const int NotStarted_HASH = HashingUtils::HashString("NotStarted");
-        static const int Started_HASH = HashingUtils::HashString("Started");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
+        static constexpr int NotStarted_HASH = HashingUtils::CompileTimeHashString("NotStarted");
+        static constexpr int Started_HASH = HashingUtils::CompileTimeHashString("Started");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Completed_HASH = HashingUtils::CompileTimeHashString("Completed");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
 
 
         OperationStatus GetOperationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NotStarted_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationStatus::NotStarted;
-          }
-          else if (hashCode == Started_HASH)
-          {
-            return OperationStatus::Started;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return OperationStatus::Failed;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return OperationStatus::Completed;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return OperationStatus::Succeeded;
+          case NotStarted_HASH:
+            if (name == "NotStarted")
+            {
+              return OperationStatus::NotStarted;
+            }
+            break;
+          case Started_HASH:
+            if (name == "Started")
+            {
+              return OperationStatus::Started;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return OperationStatus::Failed;
+            }
+            break;
+          case Completed_HASH:
+            if (name == "Completed")
+            {
+              return OperationStatus::Completed;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return OperationStatus::Succeeded;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return OperationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForOperationStatus(OperationStatus enumValue)
+        const char* GetNameForOperationStatus(OperationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,180 +30,254 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int DeleteInstance_HASH = HashingUtils::HashString("DeleteInstance");
-        static const int CreateInstance_HASH = HashingUtils::HashString("CreateInstance");
-        static const int StopInstance_HASH = HashingUtils::HashString("StopInstance");
-        static const int StartInstance_HASH = HashingUtils::HashString("StartInstance");
-        static const int RebootInstance_HASH = HashingUtils::HashString("RebootInstance");
-        static const int OpenInstancePublicPorts_HASH = HashingUtils::HashString("OpenInstancePublicPorts");
-        static const int PutInstancePublicPorts_HASH = HashingUtils::HashString("PutInstancePublicPorts");
-        static const int CloseInstancePublicPorts_HASH = HashingUtils::HashString("CloseInstancePublicPorts");
-        static const int AllocateStaticIp_HASH = HashingUtils::HashString("AllocateStaticIp");
-        static const int ReleaseStaticIp_HASH = HashingUtils::HashString("ReleaseStaticIp");
-        static const int AttachStaticIp_HASH = HashingUtils::HashString("AttachStaticIp");
-        static const int DetachStaticIp_HASH = HashingUtils::HashString("DetachStaticIp");
-        static const int UpdateDomainEntry_HASH = HashingUtils::HashString("UpdateDomainEntry");
-        static const int DeleteDomainEntry_HASH = HashingUtils::HashString("DeleteDomainEntry");
-        static const int CreateDomain_HASH = HashingUtils::HashString("CreateDomain");
-        static const int DeleteDomain_HASH = HashingUtils::HashString("DeleteDomain");
-        static const int CreateInstanceSnapshot_HASH = HashingUtils::HashString("CreateInstanceSnapshot");
-        static const int DeleteInstanceSnapshot_HASH = HashingUtils::HashString("DeleteInstanceSnapshot");
-        static const int CreateInstancesFromSnapshot_HASH = HashingUtils::HashString("CreateInstancesFromSnapshot");
-        static const int CreateLoadBalancer_HASH = HashingUtils::HashString("CreateLoadBalancer");
-        static const int DeleteLoadBalancer_HASH = HashingUtils::HashString("DeleteLoadBalancer");
-        static const int AttachInstancesToLoadBalancer_HASH = HashingUtils::HashString("AttachInstancesToLoadBalancer");
-        static const int DetachInstancesFromLoadBalancer_HASH = HashingUtils::HashString("DetachInstancesFromLoadBalancer");
-        static const int UpdateLoadBalancerAttribute_HASH = HashingUtils::HashString("UpdateLoadBalancerAttribute");
-        static const int CreateLoadBalancerTlsCertificate_HASH = HashingUtils::HashString("CreateLoadBalancerTlsCertificate");
-        static const int DeleteLoadBalancerTlsCertificate_HASH = HashingUtils::HashString("DeleteLoadBalancerTlsCertificate");
-        static const int AttachLoadBalancerTlsCertificate_HASH = HashingUtils::HashString("AttachLoadBalancerTlsCertificate");
-        static const int CreateDisk_HASH = HashingUtils::HashString("CreateDisk");
-        static const int DeleteDisk_HASH = HashingUtils::HashString("DeleteDisk");
-        static const int AttachDisk_HASH = HashingUtils::HashString("AttachDisk");
-        static const int DetachDisk_HASH = HashingUtils::HashString("DetachDisk");
-        static const int CreateDiskSnapshot_HASH = HashingUtils::HashString("CreateDiskSnapshot");
-        static const int DeleteDiskSnapshot_HASH = HashingUtils::HashString("DeleteDiskSnapshot");
-        static const int CreateDiskFromSnapshot_HASH = HashingUtils::HashString("CreateDiskFromSnapshot");
+        static constexpr int DeleteInstance_HASH = HashingUtils::CompileTimeHashString("DeleteInstance");
+        static constexpr int CreateInstance_HASH = HashingUtils::CompileTimeHashString("CreateInstance");
+        static constexpr int StopInstance_HASH = HashingUtils::CompileTimeHashString("StopInstance");
+        static constexpr int StartInstance_HASH = HashingUtils::CompileTimeHashString("StartInstance");
+        static constexpr int RebootInstance_HASH = HashingUtils::CompileTimeHashString("RebootInstance");
+        static constexpr int OpenInstancePublicPorts_HASH = HashingUtils::CompileTimeHashString("OpenInstancePublicPorts");
+        static constexpr int PutInstancePublicPorts_HASH = HashingUtils::CompileTimeHashString("PutInstancePublicPorts");
+        static constexpr int CloseInstancePublicPorts_HASH = HashingUtils::CompileTimeHashString("CloseInstancePublicPorts");
+        static constexpr int AllocateStaticIp_HASH = HashingUtils::CompileTimeHashString("AllocateStaticIp");
+        static constexpr int ReleaseStaticIp_HASH = HashingUtils::CompileTimeHashString("ReleaseStaticIp");
+        static constexpr int AttachStaticIp_HASH = HashingUtils::CompileTimeHashString("AttachStaticIp");
+        static constexpr int DetachStaticIp_HASH = HashingUtils::CompileTimeHashString("DetachStaticIp");
+        static constexpr int UpdateDomainEntry_HASH = HashingUtils::CompileTimeHashString("UpdateDomainEntry");
+        static constexpr int DeleteDomainEntry_HASH = HashingUtils::CompileTimeHashString("DeleteDomainEntry");
+        static constexpr int CreateDomain_HASH = HashingUtils::CompileTimeHashString("CreateDomain");
+        static constexpr int DeleteDomain_HASH = HashingUtils::CompileTimeHashString("DeleteDomain");
+        static constexpr int CreateInstanceSnapshot_HASH = HashingUtils::CompileTimeHashString("CreateInstanceSnapshot");
+        static constexpr int DeleteInstanceSnapshot_HASH = HashingUtils::CompileTimeHashString("DeleteInstanceSnapshot");
+        static constexpr int CreateInstancesFromSnapshot_HASH = HashingUtils::CompileTimeHashString("CreateInstancesFromSnapshot");
+        static constexpr int CreateLoadBalancer_HASH = HashingUtils::CompileTimeHashString("CreateLoadBalancer");
+        static constexpr int DeleteLoadBalancer_HASH = HashingUtils::CompileTimeHashString("DeleteLoadBalancer");
+        static constexpr int AttachInstancesToLoadBalancer_HASH = HashingUtils::CompileTimeHashString("AttachInstancesToLoadBalancer");
+        static constexpr int DetachInstancesFromLoadBalancer_HASH = HashingUtils::CompileTimeHashString("DetachInstancesFromLoadBalancer");
+        static constexpr int UpdateLoadBalancerAttribute_HASH = HashingUtils::CompileTimeHashString("UpdateLoadBalancerAttribute");
+        static constexpr int CreateLoadBalancerTlsCertificate_HASH = HashingUtils::CompileTimeHashString("CreateLoadBalancerTlsCertificate");
+        static constexpr int DeleteLoadBalancerTlsCertificate_HASH = HashingUtils::CompileTimeHashString("DeleteLoadBalancerTlsCertificate");
+        static constexpr int AttachLoadBalancerTlsCertificate_HASH = HashingUtils::CompileTimeHashString("AttachLoadBalancerTlsCertificate");
+        static constexpr int CreateDisk_HASH = HashingUtils::CompileTimeHashString("CreateDisk");
+        static constexpr int DeleteDisk_HASH = HashingUtils::CompileTimeHashString("DeleteDisk");
+        static constexpr int AttachDisk_HASH = HashingUtils::CompileTimeHashString("AttachDisk");
+        static constexpr int DetachDisk_HASH = HashingUtils::CompileTimeHashString("DetachDisk");
+        static constexpr int CreateDiskSnapshot_HASH = HashingUtils::CompileTimeHashString("CreateDiskSnapshot");
+        static constexpr int DeleteDiskSnapshot_HASH = HashingUtils::CompileTimeHashString("DeleteDiskSnapshot");
+        static constexpr int CreateDiskFromSnapshot_HASH = HashingUtils::CompileTimeHashString("CreateDiskFromSnapshot");
 
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DeleteInstance_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationType::DeleteInstance;
-          }
-          else if (hashCode == CreateInstance_HASH)
-          {
-            return OperationType::CreateInstance;
-          }
-          else if (hashCode == StopInstance_HASH)
-          {
-            return OperationType::StopInstance;
-          }
-          else if (hashCode == StartInstance_HASH)
-          {
-            return OperationType::StartInstance;
-          }
-          else if (hashCode == RebootInstance_HASH)
-          {
-            return OperationType::RebootInstance;
-          }
-          else if (hashCode == OpenInstancePublicPorts_HASH)
-          {
-            return OperationType::OpenInstancePublicPorts;
-          }
-          else if (hashCode == PutInstancePublicPorts_HASH)
-          {
-            return OperationType::PutInstancePublicPorts;
-          }
-          else if (hashCode == CloseInstancePublicPorts_HASH)
-          {
-            return OperationType::CloseInstancePublicPorts;
-          }
-          else if (hashCode == AllocateStaticIp_HASH)
-          {
-            return OperationType::AllocateStaticIp;
-          }
-          else if (hashCode == ReleaseStaticIp_HASH)
-          {
-            return OperationType::ReleaseStaticIp;
-          }
-          else if (hashCode == AttachStaticIp_HASH)
-          {
-            return OperationType::AttachStaticIp;
-          }
-          else if (hashCode == DetachStaticIp_HASH)
-          {
-            return OperationType::DetachStaticIp;
-          }
-          else if (hashCode == UpdateDomainEntry_HASH)
-          {
-            return OperationType::UpdateDomainEntry;
-          }
-          else if (hashCode == DeleteDomainEntry_HASH)
-          {
-            return OperationType::DeleteDomainEntry;
-          }
-          else if (hashCode == CreateDomain_HASH)
-          {
-            return OperationType::CreateDomain;
-          }
-          else if (hashCode == DeleteDomain_HASH)
-          {
-            return OperationType::DeleteDomain;
-          }
-          else if (hashCode == CreateInstanceSnapshot_HASH)
-          {
-            return OperationType::CreateInstanceSnapshot;
-          }
-          else if (hashCode == DeleteInstanceSnapshot_HASH)
-          {
-            return OperationType::DeleteInstanceSnapshot;
-          }
-          else if (hashCode == CreateInstancesFromSnapshot_HASH)
-          {
-            return OperationType::CreateInstancesFromSnapshot;
-          }
-          else if (hashCode == CreateLoadBalancer_HASH)
-          {
-            return OperationType::CreateLoadBalancer;
-          }
-          else if (hashCode == DeleteLoadBalancer_HASH)
-          {
-            return OperationType::DeleteLoadBalancer;
-          }
-          else if (hashCode == AttachInstancesToLoadBalancer_HASH)
-          {
-            return OperationType::AttachInstancesToLoadBalancer;
-          }
-          else if (hashCode == DetachInstancesFromLoadBalancer_HASH)
-          {
-            return OperationType::DetachInstancesFromLoadBalancer;
-          }
-          else if (hashCode == UpdateLoadBalancerAttribute_HASH)
-          {
-            return OperationType::UpdateLoadBalancerAttribute;
-          }
-          else if (hashCode == CreateLoadBalancerTlsCertificate_HASH)
-          {
-            return OperationType::CreateLoadBalancerTlsCertificate;
-          }
-          else if (hashCode == DeleteLoadBalancerTlsCertificate_HASH)
-          {
-            return OperationType::DeleteLoadBalancerTlsCertificate;
-          }
-          else if (hashCode == AttachLoadBalancerTlsCertificate_HASH)
-          {
-            return OperationType::AttachLoadBalancerTlsCertificate;
-          }
-          else if (hashCode == CreateDisk_HASH)
-          {
-            return OperationType::CreateDisk;
-          }
-          else if (hashCode == DeleteDisk_HASH)
-          {
-            return OperationType::DeleteDisk;
-          }
-          else if (hashCode == AttachDisk_HASH)
-          {
-            return OperationType::AttachDisk;
-          }
-          else if (hashCode == DetachDisk_HASH)
-          {
-            return OperationType::DetachDisk;
-          }
-          else if (hashCode == CreateDiskSnapshot_HASH)
-          {
-            return OperationType::CreateDiskSnapshot;
-          }
-          else if (hashCode == DeleteDiskSnapshot_HASH)
-          {
-            return OperationType::DeleteDiskSnapshot;
-          }
-          else if (hashCode == CreateDiskFromSnapshot_HASH)
-          {
-            return OperationType::CreateDiskFromSnapshot;
+          case DeleteInstance_HASH:
+            if (name == "DeleteInstance")
+            {
+              return OperationType::DeleteInstance;
+            }
+            break;
+          case CreateInstance_HASH:
+            if (name == "CreateInstance")
+            {
+              return OperationType::CreateInstance;
+            }
+            break;
+          case StopInstance_HASH:
+            if (name == "StopInstance")
+            {
+              return OperationType::StopInstance;
+            }
+            break;
+          case StartInstance_HASH:
+            if (name == "StartInstance")
+            {
+              return OperationType::StartInstance;
+            }
+            break;
+          case RebootInstance_HASH:
+            if (name == "RebootInstance")
+            {
+              return OperationType::RebootInstance;
+            }
+            break;
+          case OpenInstancePublicPorts_HASH:
+            if (name == "OpenInstancePublicPorts")
+            {
+              return OperationType::OpenInstancePublicPorts;
+            }
+            break;
+          case PutInstancePublicPorts_HASH:
+            if (name == "PutInstancePublicPorts")
+            {
+              return OperationType::PutInstancePublicPorts;
+            }
+            break;
+          case CloseInstancePublicPorts_HASH:
+            if (name == "CloseInstancePublicPorts")
+            {
+              return OperationType::CloseInstancePublicPorts;
+            }
+            break;
+          case AllocateStaticIp_HASH:
+            if (name == "AllocateStaticIp")
+            {
+              return OperationType::AllocateStaticIp;
+            }
+            break;
+          case ReleaseStaticIp_HASH:
+            if (name == "ReleaseStaticIp")
+            {
+              return OperationType::ReleaseStaticIp;
+            }
+            break;
+          case AttachStaticIp_HASH:
+            if (name == "AttachStaticIp")
+            {
+              return OperationType::AttachStaticIp;
+            }
+            break;
+          case DetachStaticIp_HASH:
+            if (name == "DetachStaticIp")
+            {
+              return OperationType::DetachStaticIp;
+            }
+            break;
+          case UpdateDomainEntry_HASH:
+            if (name == "UpdateDomainEntry")
+            {
+              return OperationType::UpdateDomainEntry;
+            }
+            break;
+          case DeleteDomainEntry_HASH:
+            if (name == "DeleteDomainEntry")
+            {
+              return OperationType::DeleteDomainEntry;
+            }
+            break;
+          case CreateDomain_HASH:
+            if (name == "CreateDomain")
+            {
+              return OperationType::CreateDomain;
+            }
+            break;
+          case DeleteDomain_HASH:
+            if (name == "DeleteDomain")
+            {
+              return OperationType::DeleteDomain;
+            }
+            break;
+          case CreateInstanceSnapshot_HASH:
+            if (name == "CreateInstanceSnapshot")
+            {
+              return OperationType::CreateInstanceSnapshot;
+            }
+            break;
+          case DeleteInstanceSnapshot_HASH:
+            if (name == "DeleteInstanceSnapshot")
+            {
+              return OperationType::DeleteInstanceSnapshot;
+            }
+            break;
+          case CreateInstancesFromSnapshot_HASH:
+            if (name == "CreateInstancesFromSnapshot")
+            {
+              return OperationType::CreateInstancesFromSnapshot;
+            }
+            break;
+          case CreateLoadBalancer_HASH:
+            if (name == "CreateLoadBalancer")
+            {
+              return OperationType::CreateLoadBalancer;
+            }
+            break;
+          case DeleteLoadBalancer_HASH:
+            if (name == "DeleteLoadBalancer")
+            {
+              return OperationType::DeleteLoadBalancer;
+            }
+            break;
+          case AttachInstancesToLoadBalancer_HASH:
+            if (name == "AttachInstancesToLoadBalancer")
+            {
+              return OperationType::AttachInstancesToLoadBalancer;
+            }
+            break;
+          case DetachInstancesFromLoadBalancer_HASH:
+            if (name == "DetachInstancesFromLoadBalancer")
+            {
+              return OperationType::DetachInstancesFromLoadBalancer;
+            }
+            break;
+          case UpdateLoadBalancerAttribute_HASH:
+            if (name == "UpdateLoadBalancerAttribute")
+            {
+              return OperationType::UpdateLoadBalancerAttribute;
+            }
+            break;
+          case CreateLoadBalancerTlsCertificate_HASH:
+            if (name == "CreateLoadBalancerTlsCertificate")
+            {
+              return OperationType::CreateLoadBalancerTlsCertificate;
+            }
+            break;
+          case DeleteLoadBalancerTlsCertificate_HASH:
+            if (name == "DeleteLoadBalancerTlsCertificate")
+            {
+              return OperationType::DeleteLoadBalancerTlsCertificate;
+            }
+            break;
+          case AttachLoadBalancerTlsCertificate_HASH:
+            if (name == "AttachLoadBalancerTlsCertificate")
+            {
+              return OperationType::AttachLoadBalancerTlsCertificate;
+            }
+            break;
+          case CreateDisk_HASH:
+            if (name == "CreateDisk")
+            {
+              return OperationType::CreateDisk;
+            }
+            break;
+          case DeleteDisk_HASH:
+            if (name == "DeleteDisk")
+            {
+              return OperationType::DeleteDisk;
+            }
+            break;
+          case AttachDisk_HASH:
+            if (name == "AttachDisk")
+            {
+              return OperationType::AttachDisk;
+            }
+            break;
+          case DetachDisk_HASH:
+            if (name == "DetachDisk")
+            {
+              return OperationType::DetachDisk;
+            }
+            break;
+          case CreateDiskSnapshot_HASH:
+            if (name == "CreateDiskSnapshot")
+            {
+              return OperationType::CreateDiskSnapshot;
+            }
+            break;
+          case DeleteDiskSnapshot_HASH:
+            if (name == "DeleteDiskSnapshot")
+            {
+              return OperationType::DeleteDiskSnapshot;
+            }
+            break;
+          case CreateDiskFromSnapshot_HASH:
+            if (name == "CreateDiskFromSnapshot")
+            {
+              return OperationType::CreateDiskFromSnapshot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -215,7 +289,7 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationType(OperationType enumValue)
         {
           switch(enumValue)
           {
@@ -291,7 +365,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
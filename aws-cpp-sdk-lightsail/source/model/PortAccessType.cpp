@@ -30,20 +30,30 @@ namespace Aws
       namespace PortAccessTypeMapper
       {
 
-        static const int Public_HASH = HashingUtils::HashString("Public");
-        static const int Private_HASH = HashingUtils::HashString("Private");
+        static constexpr int Public_HASH = HashingUtils::CompileTimeHashString("Public");
+        static constexpr int Private_HASH = HashingUtils::CompileTimeHashString("Private");
 
 
         PortAccessType GetPortAccessTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Public_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PortAccessType::Public;
-          }
-          else if (hashCode == Private_HASH)
-          {
-            return PortAccessType::Private;
+          case Public_HASH:
+            if (name == "Public")
+            {
+              return PortAccessType::Public;
+            }
+            break;
+          case Private_HASH:
+            if (name == "Private")
+            {
+              return PortAccessType::Private;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PortAccessType::NOT_SET;
         }
 
-        Aws::String GetNameForPortAccessType(PortAccessType enumValue)
+        const char* GetNameForPortAccessType(PortAccessType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PortStateMapper
       {
 
-        static const int open_HASH = HashingUtils::HashString("open");
-        static const int closed_HASH = HashingUtils::HashString("closed");
+        static constexpr int open_HASH = HashingUtils::CompileTimeHashString("open");
+        static constexpr int closed_HASH = HashingUtils::CompileTimeHashString("closed");
 
 
         PortState GetPortStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == open_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PortState::open;
-          }
-          else if (hashCode == closed_HASH)
-          {
-            return PortState::closed;
+          case open_HASH:
+            if (name == "open")
+            {
+              return PortState::open;
+            }
+            break;
+          case closed_HASH:
+            if (name == "closed")
+            {
+              return PortState::closed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PortState::NOT_SET;
         }
 
-        Aws::String GetNameForPortState(PortState enumValue)
+        const char* GetNameForPortState(PortState enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
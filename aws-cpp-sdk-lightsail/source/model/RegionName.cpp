@@ -30,70 +30,100 @@ namespace Aws
       namespace RegionNameMapper
       {
 
-        static const int us_east_1_HASH = HashingUtils::HashString("us-east-1");
-        static const int us_east_2_HASH = HashingUtils::HashString("us-east-2");
-        static const int us_west_1_HASH = HashingUtils::HashString("us-west-1");
-        static const int us_west_2_HASH = HashingUtils::HashString("us-west-2");
-        static const int eu_central_1_HASH = HashingUtils::HashString("eu-central-1");
-        static const int eu_west_1_HASH = HashingUtils::HashString("eu-west-1");
-        static const int eu_west_2_HASH = HashingUtils::HashString("eu-west-2");
-        static const int ap_south_1_HASH = HashingUtils::HashString("ap-south-1");
-        static const int ap_southeast_1_HASH = HashingUtils::HashString("ap-southeast-1");
-        static const int ap_southeast_2_HASH = HashingUtils::HashString("ap-southeast-2");
-        static const int ap_northeast_1_HASH = HashingUtils::HashString("ap-northeast-1");
-        static const int ap_northeast_2_HASH = HashingUtils::HashString("ap-northeast-2");
+        static constexpr int us_east_1_HASH = HashingUtils::CompileTimeHashString("us-east-1");
+        static constexpr int us_east_2_HASH = HashingUtils::CompileTimeHashString("us-east-2");
+        static constexpr int us_west_1_HASH = HashingUtils::CompileTimeHashString("us-west-1");
+        static constexpr int us_west_2_HASH = HashingUtils::CompileTimeHashString("us-west-2");
+        static constexpr int eu_central_1_HASH = HashingUtils::CompileTimeHashString("eu-central-1");
+        static constexpr int eu_west_1_HASH = HashingUtils::CompileTimeHashString("eu-west-1");
+        static constexpr int eu_west_2_HASH = HashingUtils::CompileTimeHashString("eu-west-2");
+        static constexpr int ap_south_1_HASH = HashingUtils::CompileTimeHashString("ap-south-1");
+        static constexpr int ap_southeast_1_HASH = HashingUtils::CompileTimeHashString("ap-southeast-1");
+        static constexpr int ap_southeast_2_HASH = HashingUtils::CompileTimeHashString("ap-southeast-2");
+        static constexpr int ap_northeast_1_HASH = HashingUtils::CompileTimeHashString("ap-northeast-1");
+        static constexpr int ap_northeast_2_HASH = HashingUtils::CompileTimeHashString("ap-northeast-2");
 
 
         RegionName GetRegionNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == us_east_1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RegionName::us_east_1;
-          }
-          else if (hashCode == us_east_2_HASH)
-          {
-            return RegionName::us_east_2;
-          }
-          else if (hashCode == us_west_1_HASH)
-          {
-            return RegionName::us_west_1;
-          }
-          else if (hashCode == us_west_2_HASH)
-          {
-            return RegionName::us_west_2;
-          }
-          else if (hashCode == eu_central_1_HASH)
-          {
-            return RegionName::eu_central_1;
-          }
-          else if (hashCode == eu_west_1_HASH)
-          {
-            return RegionName::eu_west_1;
-          }
-          else if (hashCode == eu_west_2_HASH)
-          {
-            return RegionName::eu_west_2;
-          }
-          else if (hashCode == ap_south_1_HASH)
-          {
-            return RegionName::ap_south_1;
-          }
-          else if (hashCode == ap_southeast_1_HASH)
-          {
-            return RegionName::ap_southeast_1;
-          }
-          else if (hashCode == ap_southeast_2_HASH)
-          {
-            return RegionName::ap_southeast_2;
-          }
-          else if (hashCode == ap_northeast_1_HASH)
-          {
-            return RegionName::ap_northeast_1;
-          }
-          else if (hashCode == ap_northeast_2_HASH)
-          {
-            return RegionName::ap_northeast_2;
+          case us_east_1_HASH:
+            if (name == "us-east-1")
+            {
+              return RegionName::us_east_1;
+            }
+            break;
+          case us_east_2_HASH:
+            if (name == "us-east-2")
+            {
+              return RegionName::us_east_2;
+            }
+            break;
+          case us_west_1_HASH:
+            if (name == "us-west-1")
+            {
+              return RegionName::us_west_1;
+            }
+            break;
+          case us_west_2_HASH:
+            if (name == "us-west-2")
+            {
+              return RegionName::us_west_2;
+            }
+            break;
+          case eu_central_1_HASH:
+            if (name == "eu-central-1")
+            {
+              return RegionName::eu_central_1;
+            }
+            break;
+          case eu_west_1_HASH:
+            if (name == "eu-west-1")
+            {
+              return RegionName::eu_west_1;
+            }
+            break;
+          case eu_west_2_HASH:
+            if (name == "eu-west-2")
+            {
+              return RegionName::eu_west_2;
+            }
+            break;
+          case ap_south_1_HASH:
+            if (name == "ap-south-1")
+            {
+              return RegionName::ap_south_1;
+            }
+            break;
+          case ap_southeast_1_HASH:
+            if (name == "ap-southeast-1")
+            {
+              return RegionName::ap_southeast_1;
+            }
+            break;
+          case ap_southeast_2_HASH:
+            if (name == "ap-southeast-2")
+            {
+              return RegionName::ap_southeast_2;
+            }
+            break;
+          case ap_northeast_1_HASH:
+            if (name == "ap-northeast-1")
+            {
+              return RegionName::ap_northeast_1;
+            }
+            break;
+          case ap_northeast_2_HASH:
+            if (name == "ap-northeast-2")
+            {
+              return RegionName::ap_northeast_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return RegionName::NOT_SET;
         }
 
-        Aws::String GetNameForRegionName(RegionName enumValue)
+        const char* GetNameForRegionName(RegionName enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,60 +30,86 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int Instance_HASH = HashingUtils::HashString("Instance");
-        static const int StaticIp_HASH = HashingUtils::HashString("StaticIp");
-        static const int KeyPair_HASH = HashingUtils::HashString("KeyPair");
-        static const int InstanceSnapshot_HASH = HashingUtils::HashString("InstanceSnapshot");
-        static const int Domain_HASH = HashingUtils::HashString("Domain");
-        static const int PeeredVpc_HASH = HashingUtils::HashString("PeeredVpc");
-        static const int LoadBalancer_HASH = HashingUtils::HashString("LoadBalancer");
-        static const int LoadBalancerTlsCertificate_HASH = HashingUtils::HashString("LoadBalancerTlsCertificate");
-        static const int Disk_HASH = HashingUtils::HashString("Disk");
-        static const int DiskSnapshot_HASH = HashingUtils::HashString("DiskSnapshot");
+        static constexpr int Instance_HASH = HashingUtils::CompileTimeHashString("Instance");
+        static constexpr int StaticIp_HASH = HashingUtils::CompileTimeHashString("StaticIp");
+        static constexpr int KeyPair_HASH = HashingUtils::CompileTimeHashString("KeyPair");
+        static constexpr int InstanceSnapshot_HASH = HashingUtils::CompileTimeHashString("InstanceSnapshot");
+        static constexpr int Domain_HASH = HashingUtils::CompileTimeHashString("Domain");
+        static constexpr int PeeredVpc_HASH = HashingUtils::CompileTimeHashString("PeeredVpc");
+        static constexpr int LoadBalancer_HASH = HashingUtils::CompileTimeHashString("LoadBalancer");
+        static constexpr int LoadBalancerTlsCertificate_HASH = HashingUtils::CompileTimeHashString("LoadBalancerTlsCertificate");
+        static constexpr int Disk_HASH = HashingUtils::CompileTimeHashString("Disk");
+        static constexpr int DiskSnapshot_HASH = HashingUtils::CompileTimeHashString("DiskSnapshot");
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Instance_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceType::Instance;
-          }
-          else if (hashCode == StaticIp_HASH)
-          {
-            return ResourceType::StaticIp;
-          }
-          else if (hashCode == KeyPair_HASH)
-          {
-            return ResourceType::KeyPair;
-          }
-          else if (hashCode == InstanceSnapshot_HASH)
-          {
-            return ResourceType::InstanceSnapshot;
-          }
-          else if (hashCode == Domain_HASH)
-          {
-            return ResourceType::Domain;
-          }
-          else if (hashCode == PeeredVpc_HASH)
-          {
-            return ResourceType::PeeredVpc;
-          }
-          else if (hashCode == LoadBalancer_HASH)
-          {
-            return ResourceType::LoadBalancer;
-          }
-          else if (hashCode == LoadBalancerTlsCertificate_HASH)
-          {
-            return ResourceType::LoadBalancerTlsCertificate;
-          }
-          else if (hashCode == Disk_HASH)
-          {
-            return ResourceType::Disk;
-          }
-          else if (hashCode == DiskSnapshot_HASH)
-          {
-            return ResourceType::DiskSnapshot;
+          case Instance_HASH:
+            if (name == "Instance")
+            {
+              return ResourceType::Instance;
+            }
+            break;
+          case StaticIp_HASH:
+            if (name == "StaticIp")
+            {
+              return ResourceType::StaticIp;
+            }
+            break;
+          case KeyPair_HASH:
+            if (name == "KeyPair")
+            {
+              return ResourceType::KeyPair;
+            }
+            break;
+          case InstanceSnapshot_HASH:
+            if (name == "InstanceSnapshot")
+            {
+              return ResourceType::InstanceSnapshot;
+            }
+            break;
+          case Domain_HASH:
+            if (name == "Domain")
+            {
+              return ResourceType::Domain;
+            }
+            break;
+          case PeeredVpc_HASH:
+            if (name == "PeeredVpc")
+            {
+              return ResourceType::PeeredVpc;
+            }
+            break;
+          case LoadBalancer_HASH:
+            if (name == "LoadBalancer")
+            {
+              return ResourceType::LoadBalancer;
+            }
+            break;
+          case LoadBalancerTlsCertificate_HASH:
+            if (name == "LoadBalancerTlsCertificate")
+            {
+              return ResourceType::LoadBalancerTlsCertificate;
+            }
+            break;
+          case Disk_HASH:
+            if (name == "Disk")
+            {
+              return ResourceType::Disk;
+            }
+            break;
+          case DiskSnapshot_HASH:
+            if (name == "DiskSnapshot")
+            {
+              return ResourceType::DiskSnapshot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceType(ResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
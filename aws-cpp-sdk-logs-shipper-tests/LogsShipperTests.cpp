@@ -0,0 +1,463 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/logs-shipper/LogsShipper.h>
+#include <aws/logs-shipper/CloudWatchLogSystem.h>
+#include <aws/logs/model/CreateLogGroupRequest.h>
+#include <aws/logs/model/CreateLogStreamRequest.h>
+#include <aws/logs/model/DescribeLogStreamsRequest.h>
+#include <aws/logs/model/DescribeLogStreamsResult.h>
+#include <aws/logs/model/PutLogEventsRequest.h>
+#include <aws/logs/model/PutLogEventsResult.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/testing/BatchingClientTest.h>
+
+using namespace Aws::LogsShipper;
+using namespace Aws::CloudWatchLogs;
+using namespace Aws::CloudWatchLogs::Model;
+using namespace Aws::Utils;
+
+static const char* ALLOC_TAG = "LogsShipperTests";
+static const char* LOG_GROUP_NAME = "LogsShipperTestGroup";
+
+/**
+ * CloudWatch Logs client keeping log streams in memory, checking the sequence token and timestamp order of every PutLogEvents.
+ * DescribeLogStreams fails as many times as it is told to.
+ */
+class MockCloudWatchLogsClient : public Aws::Testing::MockServiceClient<CloudWatchLogsClient>
+{
+public:
+    struct Stream
+    {
+        Stream() : nextToken(0) {}
+
+        unsigned nextToken;
+        Aws::Vector<InputLogEvent> events;
+    };
+
+    MockCloudWatchLogsClient() : m_groupExists(true), m_failAll(false), m_acceptButReportDuplicate(false), m_hideExpectedToken(false) {}
+
+    PutLogEventsOutcome PutLogEvents(const PutLogEventsRequest& request) const override
+    {
+        if (m_onPutLogEvents)
+        {
+            m_onPutLogEvents();
+        }
+
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_requests.push_back(request);
+        if (m_failAll)
+        {
+            return Aws::Client::AWSError<CloudWatchLogsErrors>(CloudWatchLogsErrors::SERVICE_UNAVAILABLE, "ServiceUnavailableException", "Try again.", true);
+        }
+
+        auto iter = m_streams.find(request.GetLogStreamName());
+        if (!m_groupExists || iter == m_streams.end())
+        {
+            return Aws::Client::AWSError<CloudWatchLogsErrors>(CloudWatchLogsErrors::RESOURCE_NOT_FOUND, "ResourceNotFoundException",
+                                                              "The specified log stream does not exist.", false);
+        }
+
+        auto& stream = iter->second;
+        Aws::String expectedToken = stream.nextToken == 0 ? "" : StringUtils::to_string(stream.nextToken);
+        if (request.GetSequenceToken() != expectedToken)
+        {
+            Aws::String message = "The given sequenceToken is invalid.";
+            if (!m_hideExpectedToken)
+            {
+                message += " The next expected sequenceToken is: " + (expectedToken.empty() ? Aws::String("null") : expectedToken);
+            }
+            return Aws::Client::AWSError<CloudWatchLogsErrors>(CloudWatchLogsErrors::INVALID_SEQUENCE_TOKEN, "InvalidSequenceTokenException", message, false);
+        }
+
+        for (size_t i = 1; i < request.GetLogEvents().size(); ++i)
+        {
+            EXPECT_LE(request.GetLogEvents()[i - 1].GetTimestamp(), request.GetLogEvents()[i].GetTimestamp());
+        }
+        stream.events.insert(stream.events.end(), request.GetLogEvents().begin(), request.GetLogEvents().end());
+        ++stream.nextToken;
+
+        if (m_acceptButReportDuplicate)
+        {
+            m_acceptButReportDuplicate = false;
+            return Aws::Client::AWSError<CloudWatchLogsErrors>(CloudWatchLogsErrors::DATA_ALREADY_ACCEPTED, "DataAlreadyAcceptedException",
+                                                              "The given batch of log events has already been accepted. The next batch can be sent with sequenceToken: "
+                                                              + StringUtils::to_string(stream.nextToken), false);
+        }
+
+        PutLogEventsResult result;
+        result.SetNextSequenceToken(StringUtils::to_string(stream.nextToken));
+        return result;
+    }
+
+    CreateLogGroupOutcome CreateLogGroup(const CreateLogGroupRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        EXPECT_EQ(LOG_GROUP_NAME, request.GetLogGroupName());
+        m_groupExists = true;
+        return CreateLogGroupOutcome(Aws::NoResult());
+    }
+
+    CreateLogStreamOutcome CreateLogStream(const CreateLogStreamRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        if (!m_groupExists)
+        {
+            return Aws::Client::AWSError<CloudWatchLogsErrors>(CloudWatchLogsErrors::RESOURCE_NOT_FOUND, "ResourceNotFoundException",
+                                                              "The specified log group does not exist.", false);
+        }
+        if (m_streams.find(request.GetLogStreamName()) != m_streams.end())
+        {
+            return Aws::Client::AWSError<CloudWatchLogsErrors>(CloudWatchLogsErrors::RESOURCE_ALREADY_EXISTS, "ResourceAlreadyExistsException",
+                                                              "The specified log stream already exists.", false);
+        }
+        m_streams[request.GetLogStreamName()];
+        return CreateLogStreamOutcome(Aws::NoResult());
+    }
+
+    DescribeLogStreamsOutcome DescribeLogStreams(const DescribeLogStreamsRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        ++m_describeCalls;
+        if (m_describeFailures > 0)
+        {
+            --m_describeFailures;
+            return Aws::Client::AWSError<CloudWatchLogsErrors>(CloudWatchLogsErrors::THROTTLING, "ThrottlingException", "Rate exceeded", true);
+        }
+
+        DescribeLogStreamsResult result;
+        for (const auto& stream : m_streams)
+        {
+            if (stream.first.find(request.GetLogStreamNamePrefix()) == 0)
+            {
+                LogStream logStream;
+                logStream.SetLogStreamName(stream.first);
+                if (stream.second.nextToken > 0)
+                {
+                    logStream.SetUploadSequenceToken(StringUtils::to_string(stream.second.nextToken));
+                }
+                result.AddLogStreams(logStream);
+            }
+        }
+        return result;
+    }
+
+    // what another writer to the stream would do
+    void AddStream(const Aws::String& name, unsigned nextToken)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_streams[name].nextToken = nextToken;
+    }
+
+    Stream GetStream(const Aws::String& name) const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        auto iter = m_streams.find(name);
+        return iter == m_streams.end() ? Stream() : iter->second;
+    }
+
+    Aws::Vector<PutLogEventsRequest> GetRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_requests;
+    }
+
+    mutable bool m_groupExists;
+    bool m_failAll;
+    mutable bool m_acceptButReportDuplicate;
+    bool m_hideExpectedToken;
+    mutable size_t m_describeCalls = 0;
+    mutable size_t m_describeFailures = 0;
+    std::function<void()> m_onPutLogEvents;
+
+private:
+    mutable Aws::Map<Aws::String, Stream> m_streams;
+    mutable Aws::Vector<PutLogEventsRequest> m_requests;
+};
+
+class LogsShipperTest : public Aws::Testing::MockClientTest<MockCloudWatchLogsClient>
+{
+protected:
+    LogsShipperTest() : m_configuration(&m_executor) {}
+
+    void SetUp() override
+    {
+        MockClientTest::SetUp();
+        m_configuration.logsClient = m_client;
+        m_configuration.logGroupName = LOG_GROUP_NAME;
+        m_configuration.maxBufferedTime = std::chrono::milliseconds(10000);
+        m_configuration.retryBaseDelay = std::chrono::milliseconds(1);
+    }
+
+    void TearDown() override
+    {
+        m_configuration = LogsShipperConfiguration(&m_executor);
+        MockClientTest::TearDown();
+    }
+
+    static DateTime MakeTimestamp(int64_t millis)
+    {
+        return DateTime(static_cast<int64_t>(1500000000000LL + millis));
+    }
+
+    Aws::Utils::Threading::DefaultExecutor m_executor;
+    LogsShipperConfiguration m_configuration;
+};
+
+TEST_F(LogsShipperTest, TestBatchesEventsOfEachStreamInTimestampOrder)
+{
+    m_client->AddStream("first", 0);
+    m_client->AddStream("second", 0);
+    {
+        LogsShipper shipper(m_configuration);
+        for (size_t i = 0; i < 25000; ++i)
+        {
+            // a little out of order, like events logged by different threads
+            ASSERT_TRUE(shipper.Put("first", "event " + StringUtils::to_string(i), MakeTimestamp(i % 3 == 0 ? i + 2 : i)));
+        }
+        for (size_t i = 0; i < 10; ++i)
+        {
+            ASSERT_TRUE(shipper.Put("second", "event " + StringUtils::to_string(i), MakeTimestamp(i)));
+        }
+        shipper.FlushAndWait();
+
+        auto metrics = shipper.GetMetrics();
+        ASSERT_EQ(25010u, metrics.entriesPut);
+        ASSERT_EQ(25010u, metrics.entriesSucceeded);
+        ASSERT_EQ(0u, metrics.entriesBuffered);
+        ASSERT_EQ(0u, metrics.bytesBuffered);
+    }
+
+    ASSERT_EQ(25000u, m_client->GetStream("first").events.size());
+    ASSERT_EQ(10u, m_client->GetStream("second").events.size());
+    ASSERT_EQ("event 9", m_client->GetStream("second").events[9].GetMessage());
+
+    size_t firstRequests = 0;
+    for (const auto& request : m_client->GetRequests())
+    {
+        ASSERT_EQ(LOG_GROUP_NAME, request.GetLogGroupName());
+        ASSERT_LE(request.GetLogEvents().size(), 10000u);
+        firstRequests += request.GetLogStreamName() == "first" ? 1 : 0;
+    }
+    ASSERT_EQ(3u, firstRequests);
+}
+
+TEST_F(LogsShipperTest, TestSplitsBatchesBySize)
+{
+    m_client->AddStream("stream", 0);
+    {
+        LogsShipper shipper(m_configuration);
+        for (size_t i = 0; i < 25; ++i)
+        {
+            ASSERT_TRUE(shipper.Put("stream", Aws::String(100 * 1024, 'x'), MakeTimestamp(i)));
+        }
+    }
+
+    // 10 events of 100KB and their overhead fit in 1MB, 11 don't
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(3u, requests.size());
+    ASSERT_EQ(10u, requests[0].GetLogEvents().size());
+    ASSERT_EQ(10u, requests[1].GetLogEvents().size());
+    ASSERT_EQ(5u, requests[2].GetLogEvents().size());
+}
+
+TEST_F(LogsShipperTest, TestCreatesMissingLogGroupAndStream)
+{
+    m_client->m_groupExists = false;
+    {
+        LogsShipper shipper(m_configuration);
+        ASSERT_TRUE(shipper.Put("stream", "first event", MakeTimestamp(0)));
+        shipper.FlushAndWait();
+        ASSERT_TRUE(shipper.Put("stream", "second event", MakeTimestamp(1)));
+        shipper.FlushAndWait();
+        ASSERT_EQ(2u, shipper.GetMetrics().entriesSucceeded);
+    }
+
+    ASSERT_TRUE(m_client->m_groupExists);
+    auto stream = m_client->GetStream("stream");
+    ASSERT_EQ(2u, stream.events.size());
+    ASSERT_EQ("first event", stream.events[0].GetMessage());
+    ASSERT_EQ("second event", stream.events[1].GetMessage());
+    ASSERT_EQ(3u, m_client->GetRequests().size());
+}
+
+TEST_F(LogsShipperTest, TestRecoversSequenceTokenFromOtherWriters)
+{
+    m_client->AddStream("stream", 5);
+    {
+        LogsShipper shipper(m_configuration);
+        ASSERT_TRUE(shipper.Put("stream", "first event", MakeTimestamp(0)));
+        shipper.FlushAndWait();
+
+        m_client->AddStream("stream", 42);
+        ASSERT_TRUE(shipper.Put("stream", "second event", MakeTimestamp(1)));
+        shipper.FlushAndWait();
+        ASSERT_EQ(2u, shipper.GetMetrics().entriesSucceeded);
+        ASSERT_EQ(2u, shipper.GetMetrics().entriesRetried);
+    }
+
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(4u, requests.size());
+    ASSERT_EQ("", requests[0].GetSequenceToken());
+    ASSERT_EQ("5", requests[1].GetSequenceToken());
+    ASSERT_EQ("6", requests[2].GetSequenceToken());
+    ASSERT_EQ("42", requests[3].GetSequenceToken());
+    ASSERT_EQ(0u, m_client->m_describeCalls);
+}
+
+TEST_F(LogsShipperTest, TestDescribesStreamWhenErrorHasNoToken)
+{
+    m_client->AddStream("stream", 7);
+    m_client->m_hideExpectedToken = true;
+    {
+        LogsShipper shipper(m_configuration);
+        ASSERT_TRUE(shipper.Put("stream", "event", MakeTimestamp(0)));
+        shipper.FlushAndWait();
+        ASSERT_EQ(1u, shipper.GetMetrics().entriesSucceeded);
+    }
+
+    ASSERT_EQ(1u, m_client->m_describeCalls);
+    ASSERT_EQ(1u, m_client->GetStream("stream").events.size());
+}
+
+TEST_F(LogsShipperTest, TestDescribesOnlyTheStreamAndRetriesWhenDescribeFails)
+{
+    m_client->AddStream("stream", 7);
+    m_client->AddStream("stream-2", 3);
+    m_client->m_hideExpectedToken = true;
+    m_client->m_describeFailures = 1;
+    {
+        LogsShipper shipper(m_configuration);
+        ASSERT_TRUE(shipper.Put("stream", "event", MakeTimestamp(0)));
+        shipper.FlushAndWait();
+        ASSERT_EQ(1u, shipper.GetMetrics().entriesSucceeded);
+    }
+
+    // the token is still unknown after the first describe, and taken from the stream of the same name, not the prefix, after the second
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(3u, requests.size());
+    ASSERT_EQ("", requests[1].GetSequenceToken());
+    ASSERT_EQ("7", requests[2].GetSequenceToken());
+    ASSERT_EQ(2u, m_client->m_describeCalls);
+    ASSERT_EQ(1u, m_client->GetStream("stream").events.size());
+    ASSERT_TRUE(m_client->GetStream("stream-2").events.empty());
+}
+
+TEST_F(LogsShipperTest, TestBacksOffWhileAnotherWriterKeepsTakingTheToken)
+{
+    m_client->AddStream("stream", 1);
+    unsigned otherWriterToken = 1;
+    m_client->m_onPutLogEvents = [this, &otherWriterToken]() { m_client->AddStream("stream", ++otherWriterToken); };
+    m_configuration.retryBaseDelay = std::chrono::milliseconds(20);
+    m_configuration.maxRetries = 3;
+    auto start = std::chrono::steady_clock::now();
+    {
+        LogsShipper shipper(m_configuration);
+        ASSERT_TRUE(shipper.Put("stream", "event", MakeTimestamp(0)));
+        shipper.FlushAndWait();
+        ASSERT_EQ(1u, shipper.GetMetrics().entriesFailed);
+        ASSERT_EQ(3u, shipper.GetMetrics().entriesRetried);
+    }
+
+    // each retry waits at least half of a backoff of 20, 40 and 80 milliseconds, even with the token recovered
+    ASSERT_LE(std::chrono::milliseconds(70), std::chrono::steady_clock::now() - start);
+    ASSERT_EQ(4u, m_client->GetRequests().size());
+    ASSERT_TRUE(m_client->GetStream("stream").events.empty());
+}
+
+TEST_F(LogsShipperTest, TestDataAlreadyAcceptedCountsAsSent)
+{
+    m_client->AddStream("stream", 0);
+    m_client->m_acceptButReportDuplicate = true;
+    {
+        LogsShipper shipper(m_configuration);
+        ASSERT_TRUE(shipper.Put("stream", "first event", MakeTimestamp(0)));
+        shipper.FlushAndWait();
+        ASSERT_TRUE(shipper.Put("stream", "second event", MakeTimestamp(1)));
+        shipper.FlushAndWait();
+        ASSERT_EQ(0u, shipper.GetMetrics().entriesRetried);
+    }
+
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(2u, requests.size());
+    ASSERT_EQ("1", requests[1].GetSequenceToken());
+    ASSERT_EQ(2u, m_client->GetStream("stream").events.size());
+}
+
+TEST_F(LogsShipperTest, TestGivesUpAfterMaxRetries)
+{
+    m_client->m_failAll = true;
+    m_configuration.maxRetries = 2;
+    {
+        LogsShipper shipper(m_configuration);
+        ASSERT_TRUE(shipper.Put("stream", "event", MakeTimestamp(0)));
+        ASSERT_TRUE(shipper.Put("stream", "event", MakeTimestamp(1)));
+        shipper.FlushAndWait();
+
+        auto metrics = shipper.GetMetrics();
+        ASSERT_EQ(2u, metrics.entriesFailed);
+        ASSERT_EQ(0u, metrics.entriesSucceeded);
+        ASSERT_EQ(0u, metrics.entriesBuffered);
+    }
+    ASSERT_EQ(3u, m_client->GetRequests().size());
+}
+
+TEST_F(LogsShipperTest, TestDropsEventsWhenBufferIsFull)
+{
+    m_client->AddStream("stream", 0);
+    m_configuration.maxBufferedBytes = 100;
+    LogsShipper shipper(m_configuration);
+    ASSERT_TRUE(shipper.Put("stream", Aws::String(50, 'x'), MakeTimestamp(0)));
+    ASSERT_FALSE(shipper.Put("stream", Aws::String(50, 'x'), MakeTimestamp(1)));
+    ASSERT_FALSE(shipper.Put("stream", ""));
+    ASSERT_FALSE(shipper.Put("stream", Aws::String(256 * 1024, 'x')));
+    ASSERT_EQ(1u, shipper.GetMetrics().eventsDropped);
+
+    shipper.FlushAndWait();
+    ASSERT_TRUE(shipper.Put("stream", Aws::String(50, 'x'), MakeTimestamp(1)));
+    shipper.FlushAndWait();
+    ASSERT_EQ(2u, shipper.GetMetrics().entriesSucceeded);
+}
+
+TEST_F(LogsShipperTest, TestLogSystemShipsStatementsButNotItsOwn)
+{
+    m_client->AddStream("sdk", 0);
+    auto shipper = Aws::MakeShared<LogsShipper>(ALLOC_TAG, m_configuration);
+    CloudWatchLogSystem logSystem(Logging::LogLevel::Info, shipper, "sdk");
+    m_client->m_onPutLogEvents = [&logSystem]()
+    {
+        Aws::OStringStream message;
+        message << "logged while shipping";
+        logSystem.LogStream(Logging::LogLevel::Info, "Client", message);
+    };
+
+    Aws::OStringStream message;
+    message << "hello";
+    logSystem.LogStream(Logging::LogLevel::Info, "Test", message);
+    logSystem.Log(Logging::LogLevel::Warn, "Test", "%d bottles", 99);
+    shipper->FlushAndWait();
+
+    auto stream = m_client->GetStream("sdk");
+    ASSERT_EQ(2u, stream.events.size());
+    ASSERT_EQ(0u, stream.events[0].GetMessage().find("[INFO] "));
+    ASSERT_NE(Aws::String::npos, stream.events[0].GetMessage().find("Test"));
+    ASSERT_EQ('o', stream.events[0].GetMessage().back());
+    ASSERT_NE(Aws::String::npos, stream.events[1].GetMessage().find("99 bottles"));
+    shipper = nullptr;
+}
@@ -0,0 +1,52 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/logs-shipper/LogsShipper_EXPORTS.h>
+#include <aws/logs-shipper/LogsShipper.h>
+#include <aws/core/utils/logging/FormattedLogSystem.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace LogsShipper
+    {
+        /**
+         * Log system that ships the SDK's logs to a CloudWatch Logs stream through a LogsShipper. Install it with
+         * Aws::Utils::Logging::InitializeAWSLogging() once the shipper is created, and shut logging down before destroying the shipper.
+         *
+         * Logging never waits on CloudWatch Logs: statements are dropped when the shipper's buffer is full, and statements logged while
+         * the shipper sends, including those of the client it sends with, are not shipped.
+         */
+        class AWS_LOGS_SHIPPER_API CloudWatchLogSystem : public Aws::Utils::Logging::FormattedLogSystem
+        {
+        public:
+            using Base = FormattedLogSystem;
+
+            CloudWatchLogSystem(Aws::Utils::Logging::LogLevel logLevel, const std::shared_ptr<LogsShipper>& shipper, const Aws::String& logStreamName);
+
+            inline const Aws::String& GetLogStreamName() const { return m_logStreamName; }
+
+        protected:
+            void ProcessFormattedStatement(Aws::String&& statement) override;
+
+        private:
+            std::shared_ptr<LogsShipper> m_shipper;
+            Aws::String m_logStreamName;
+        };
+    }
+}
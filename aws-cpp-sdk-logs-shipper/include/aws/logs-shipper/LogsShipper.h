@@ -0,0 +1,167 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/logs-shipper/LogsShipper_EXPORTS.h>
+#include <aws/logs/CloudWatchLogsClient.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/threading/BatchingLoop.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace Aws
+{
+    namespace LogsShipper
+    {
+        struct LogStreamQueue;
+        struct PutLogEventsContext;
+        enum class BatchStatus;
+
+        /**
+         * Entries are log events. Events CloudWatch Logs rejected for being too old or too far in the future count as succeeded, and
+         * events stay counted as buffered while their request is in flight, since a failed request goes back to its stream.
+         * A request put back for a retry counts each of its events as retried.
+         */
+        struct LogsShipperMetrics : public Aws::Utils::Threading::BatchingMetrics
+        {
+            LogsShipperMetrics() : eventsDropped(0) {}
+
+            /**
+             * Events Put() turned away because maxBufferedBytes were buffered.
+             */
+            uint64_t eventsDropped;
+        };
+
+        struct AWS_LOGS_SHIPPER_API LogsShipperConfiguration
+        {
+            LogsShipperConfiguration(Aws::Utils::Threading::Executor* executor);
+
+            std::shared_ptr<Aws::CloudWatchLogs::CloudWatchLogsClient> logsClient;
+            Aws::String logGroupName;
+
+            /**
+             * Runs PutLogEvents, one request at a time for each log stream, so it needs a thread for each stream being sent to.
+             */
+            Aws::Utils::Threading::Executor* executor;
+
+            /**
+             * How long an event may wait in the buffer for others to share a request with. Defaults to 1 second.
+             */
+            std::chrono::milliseconds maxBufferedTime;
+            /**
+             * A request is sent before maxBufferedTime is up once a stream has this many events or bytes buffered, at most 10000 events
+             * and 1MB, which is what a PutLogEvents request takes. Each event counts for its message plus 26 bytes.
+             */
+            size_t maxEventsPerRequest;
+            size_t maxBytesPerRequest;
+            /**
+             * Events are dropped, rather than have Put() block the thread logging them, while this many bytes are waiting to be sent
+             * across all streams. Defaults to 16MB.
+             */
+            size_t maxBufferedBytes;
+            /**
+             * Requests sent at once across all streams. Defaults to 8.
+             */
+            size_t maxRequestsInFlight;
+
+            /**
+             * Creates the log stream, and the log group if needed, when CloudWatch Logs doesn't know it. On by default.
+             */
+            bool createLogStreams;
+
+            /**
+             * Failed requests are sent again after a backoff doubling from retryBaseDelay up to maxRetryDelay, at most maxRetries times,
+             * before their events are given up on. Defaults to 10 retries from 100 milliseconds up to 5 seconds.
+             */
+            unsigned maxRetries;
+            std::chrono::milliseconds retryBaseDelay;
+            std::chrono::milliseconds maxRetryDelay;
+        };
+
+        /**
+         * Sends log events to the log streams of a CloudWatch Logs group with PutLogEvents, buffering the events of any number of threads
+         * in a queue per stream.
+         *
+         * Each request takes the oldest events of a stream, sorted by timestamp, up to 10000 events, 1MB or a span of 24 hours.
+         * A stream only has one request in flight, since each request needs the sequence token returned by the previous one,
+         * but its next batch builds up meanwhile and goes out as soon as the token comes back, and streams are sent to concurrently.
+         * The sequence token of a stream is learned from its first request and recovered from InvalidSequenceTokenException and
+         * DataAlreadyAcceptedException when something else wrote to the stream.
+         */
+        class AWS_LOGS_SHIPPER_API LogsShipper : private Aws::Utils::Threading::BatchingLoop
+        {
+        public:
+            LogsShipper(const LogsShipperConfiguration& configuration);
+
+            /**
+             * Sends the events still buffered and waits for them, including their retries.
+             */
+            ~LogsShipper();
+
+            LogsShipper(const LogsShipper&) = delete;
+            LogsShipper& operator=(const LogsShipper&) = delete;
+
+            /**
+             * Buffers an event for the log stream. Returns false if the message is empty or longer than the 256KB CloudWatch Logs takes,
+             * if maxBufferedBytes are buffered, or if the shipper is being destroyed. Never blocks.
+             */
+            bool Put(const Aws::String& logStreamName, const Aws::String& message, const Aws::Utils::DateTime& timestamp = Aws::Utils::DateTime::Now());
+
+            /**
+             * Sends the events buffered so far without waiting for maxBufferedTime. Does not block.
+             */
+            void Flush();
+
+            /**
+             * Sends the events buffered so far and blocks until all of them have been sent or given up on.
+             */
+            void FlushAndWait();
+
+            LogsShipperMetrics GetMetrics() const;
+
+            inline const LogsShipperConfiguration& GetConfiguration() const { return m_configuration; }
+
+            /**
+             * Whether the calling thread is one the shipper is sending from. Log systems shipping the SDK's own logs drop what is logged
+             * there, which would otherwise keep feeding itself.
+             */
+            static bool IsShippingThread();
+
+        private:
+            bool HasBufferedEntries() const override;
+            std::function<void()> TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, Aws::Utils::Threading::WakeUpTime& wakeUp) override;
+            void OnLoopStarted() override;
+            std::shared_ptr<PutLogEventsContext> TakeBatch(const std::shared_ptr<LogStreamQueue>& stream);
+            void SubmitBatch(const std::shared_ptr<PutLogEventsContext>& context);
+            void SendBatch(const std::shared_ptr<PutLogEventsContext>& context);
+            void RecoverSequenceToken(const std::shared_ptr<PutLogEventsContext>& context, const Aws::String& errorMessage);
+            void CreateLogStream(const Aws::String& logStreamName);
+            void CompleteBatch(const std::shared_ptr<PutLogEventsContext>& context, BatchStatus status);
+
+            LogsShipperConfiguration m_configuration;
+
+            Aws::Map<Aws::String, std::shared_ptr<LogStreamQueue>> m_streams;
+            size_t m_bufferedEvents;
+            size_t m_bufferedBytes;
+            LogsShipperMetrics m_metrics;
+        };
+    }
+}
@@ -0,0 +1,56 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/logs-shipper/CloudWatchLogSystem.h>
+
+using namespace Aws::Utils::Logging;
+
+namespace Aws
+{
+    namespace LogsShipper
+    {
+        // what CloudWatch Logs takes of a message
+        static const size_t MAX_MESSAGE_SIZE = 256 * 1024 - 26;
+
+        CloudWatchLogSystem::CloudWatchLogSystem(LogLevel logLevel, const std::shared_ptr<LogsShipper>& shipper, const Aws::String& logStreamName) :
+            Base(logLevel),
+            m_shipper(shipper),
+            m_logStreamName(logStreamName)
+        {
+        }
+
+        void CloudWatchLogSystem::ProcessFormattedStatement(Aws::String&& statement)
+        {
+            if (LogsShipper::IsShippingThread())
+            {
+                return;
+            }
+
+            // each statement is an event of its own, the line break is implied
+            if (!statement.empty() && statement.back() == '\n')
+            {
+                statement.pop_back();
+            }
+            if (statement.size() > MAX_MESSAGE_SIZE)
+            {
+                statement.resize(MAX_MESSAGE_SIZE);
+            }
+            if (!statement.empty())
+            {
+                m_shipper->Put(m_logStreamName, statement);
+            }
+        }
+    }
+}
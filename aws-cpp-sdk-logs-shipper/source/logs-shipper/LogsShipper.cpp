@@ -0,0 +1,478 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/logs-shipper/LogsShipper.h>
+#include <aws/logs/model/CreateLogGroupRequest.h>
+#include <aws/logs/model/CreateLogStreamRequest.h>
+#include <aws/logs/model/DescribeLogStreamsRequest.h>
+#include <aws/logs/model/DescribeLogStreamsResult.h>
+#include <aws/logs/model/InputLogEvent.h>
+#include <aws/logs/model/PutLogEventsRequest.h>
+#include <aws/logs/model/PutLogEventsResult.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <algorithm>
+
+using namespace Aws::CloudWatchLogs;
+using namespace Aws::CloudWatchLogs::Model;
+using namespace Aws::Utils::Threading;
+
+namespace Aws
+{
+    namespace LogsShipper
+    {
+        static const char* CLASS_TAG = "LogsShipper";
+
+        // limits of PutLogEvents, each event counts for its message plus EVENT_OVERHEAD bytes
+        static const size_t MAX_EVENTS_PER_REQUEST = 10000;
+        static const size_t MAX_BYTES_PER_REQUEST = 1024 * 1024;
+        static const size_t EVENT_OVERHEAD = 26;
+        static const size_t MAX_MESSAGE_SIZE = 256 * 1024 - EVENT_OVERHEAD;
+        static const long long MAX_BATCH_SPAN_MILLIS = 24 * 60 * 60 * 1000LL;
+
+        // InvalidSequenceTokenException and DataAlreadyAcceptedException end with "sequenceToken...: " and the token the stream expects next
+        static const char SEQUENCE_TOKEN_MARKER[] = "sequenceToken";
+        static const char NULL_SEQUENCE_TOKEN[] = "null";
+
+        static thread_local bool s_isShippingThread = false;
+
+        // marks the thread as sending for as long as it's in scope
+        class ShippingThreadScope
+        {
+        public:
+            ShippingThreadScope() : m_previous(s_isShippingThread) { s_isShippingThread = true; }
+            ~ShippingThreadScope() { s_isShippingThread = m_previous; }
+
+        private:
+            bool m_previous;
+        };
+
+        enum class BatchStatus
+        {
+            SENT,
+            RETRY,
+            FAILED
+        };
+
+        struct LogStreamQueue
+        {
+            LogStreamQueue(const Aws::String& logStreamName) : name(logStreamName), bytes(0), ordered(true), sending(false), attempts(0) {}
+
+            Aws::String name;
+            Aws::Deque<InputLogEvent> events;
+            size_t bytes;
+            // whether events are in timestamp order, they are sorted before a batch is taken otherwise
+            bool ordered;
+            // when the oldest buffered event is due to be sent
+            std::chrono::steady_clock::time_point deadline;
+            Aws::String sequenceToken;
+            bool sending;
+            // failed requests in a row
+            unsigned attempts;
+            std::chrono::steady_clock::time_point retryAt;
+        };
+
+        struct PutLogEventsContext
+        {
+            PutLogEventsContext() : bytes(0) {}
+
+            std::shared_ptr<LogStreamQueue> stream;
+            Aws::Vector<InputLogEvent> events;
+            size_t bytes;
+            // token to send the batch with, and once it completes the token for the next batch
+            Aws::String sequenceToken;
+        };
+
+        LogsShipperConfiguration::LogsShipperConfiguration(Aws::Utils::Threading::Executor* executor) :
+            executor(executor),
+            maxBufferedTime(1000),
+            maxEventsPerRequest(MAX_EVENTS_PER_REQUEST),
+            maxBytesPerRequest(MAX_BYTES_PER_REQUEST),
+            maxBufferedBytes(16 * 1024 * 1024),
+            maxRequestsInFlight(8),
+            createLogStreams(true),
+            maxRetries(10),
+            retryBaseDelay(100),
+            maxRetryDelay(5000)
+        {
+        }
+
+        LogsShipper::LogsShipper(const LogsShipperConfiguration& configuration) :
+            BatchingLoop(configuration.maxRequestsInFlight),
+            m_configuration(configuration),
+            m_bufferedEvents(0),
+            m_bufferedBytes(0)
+        {
+            m_configuration.maxEventsPerRequest = (std::max)((std::min)(m_configuration.maxEventsPerRequest, MAX_EVENTS_PER_REQUEST), static_cast<size_t>(1));
+            m_configuration.maxBytesPerRequest = (std::max)((std::min)(m_configuration.maxBytesPerRequest, MAX_BYTES_PER_REQUEST), static_cast<size_t>(1));
+            m_configuration.maxRequestsInFlight = (std::max)(m_configuration.maxRequestsInFlight, static_cast<size_t>(1));
+
+            StartLoop();
+        }
+
+        LogsShipper::~LogsShipper()
+        {
+            StopLoop();
+        }
+
+        bool LogsShipper::IsShippingThread()
+        {
+            return s_isShippingThread;
+        }
+
+        bool LogsShipper::Put(const Aws::String& logStreamName, const Aws::String& message, const Aws::Utils::DateTime& timestamp)
+        {
+            if (message.empty() || message.size() > MAX_MESSAGE_SIZE)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Log event of " << message.size() << " bytes exceeds the limits of CloudWatch Logs.");
+                return false;
+            }
+
+            InputLogEvent event;
+            event.SetMessage(message);
+            event.SetTimestamp(timestamp.Millis());
+            size_t size = message.size() + EVENT_OVERHEAD;
+
+            std::lock_guard<std::mutex> locker(m_lock);
+            if (IsStopping())
+            {
+                return false;
+            }
+            if (m_bufferedBytes + size > m_configuration.maxBufferedBytes)
+            {
+                ++m_metrics.eventsDropped;
+                return false;
+            }
+
+            auto& stream = m_streams[logStreamName];
+            if (!stream)
+            {
+                stream = Aws::MakeShared<LogStreamQueue>(CLASS_TAG, logStreamName);
+            }
+
+            bool wasEmpty = stream->events.empty();
+            if (wasEmpty)
+            {
+                stream->deadline = std::chrono::steady_clock::now() + m_configuration.maxBufferedTime;
+            }
+            else if (event.GetTimestamp() < stream->events.back().GetTimestamp())
+            {
+                stream->ordered = false;
+            }
+            stream->events.push_back(std::move(event));
+            stream->bytes += size;
+            ++m_bufferedEvents;
+            m_bufferedBytes += size;
+            ++m_metrics.entriesPut;
+
+            // the loop has nothing new to look at until the stream's first event starts its deadline or the stream fills a request
+            if (wasEmpty || stream->bytes >= m_configuration.maxBytesPerRequest || stream->events.size() >= m_configuration.maxEventsPerRequest)
+            {
+                m_signal.notify_all();
+            }
+            return true;
+        }
+
+        void LogsShipper::Flush()
+        {
+            RequestFlush();
+        }
+
+        void LogsShipper::FlushAndWait()
+        {
+            RequestFlush();
+            WaitUntilIdle();
+        }
+
+        LogsShipperMetrics LogsShipper::GetMetrics() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            LogsShipperMetrics metrics = m_metrics;
+            CopyLoopMetrics(metrics);
+            metrics.entriesBuffered = m_bufferedEvents;
+            metrics.bytesBuffered = m_bufferedBytes;
+            return metrics;
+        }
+
+        void LogsShipper::OnLoopStarted()
+        {
+            // what the loop logs, e.g. that a batch couldn't be submitted, is the shipper's own and mustn't be shipped back to it
+            s_isShippingThread = true;
+        }
+
+        bool LogsShipper::HasBufferedEntries() const
+        {
+            // m_bufferedEvents includes the events of requests in flight, which aren't waiting to be sent
+            for (const auto& entry : m_streams)
+            {
+                if (!entry.second->events.empty())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::function<void()> LogsShipper::TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, WakeUpTime& wakeUp)
+        {
+            for (const auto& entry : m_streams)
+            {
+                const auto& stream = entry.second;
+                // a stream is looked at again once its request completes
+                if (stream->events.empty() || stream->sending)
+                {
+                    continue;
+                }
+
+                if (stream->retryAt > now)
+                {
+                    wakeUp.NoLaterThan(stream->retryAt);
+                    continue;
+                }
+
+                bool ready = sendAll || stream->deadline <= now ||
+                    stream->bytes >= m_configuration.maxBytesPerRequest || stream->events.size() >= m_configuration.maxEventsPerRequest;
+                if (!ready)
+                {
+                    wakeUp.NoLaterThan(stream->deadline);
+                    continue;
+                }
+
+                auto batch = TakeBatch(stream);
+                return [this, batch]() { SubmitBatch(batch); };
+            }
+            return nullptr;
+        }
+
+        std::shared_ptr<PutLogEventsContext> LogsShipper::TakeBatch(const std::shared_ptr<LogStreamQueue>& stream)
+        {
+            // PutLogEvents wants events in timestamp order, and events logged by different threads may come in slightly out of it
+            if (!stream->ordered)
+            {
+                std::stable_sort(stream->events.begin(), stream->events.end(),
+                    [](const InputLogEvent& lhs, const InputLogEvent& rhs) { return lhs.GetTimestamp() < rhs.GetTimestamp(); });
+                stream->ordered = true;
+            }
+
+            auto context = Aws::MakeShared<PutLogEventsContext>(CLASS_TAG);
+            context->stream = stream;
+            context->sequenceToken = stream->sequenceToken;
+            long long firstTimestamp = stream->events.front().GetTimestamp();
+            while (!stream->events.empty() && context->events.size() < m_configuration.maxEventsPerRequest)
+            {
+                auto& event = stream->events.front();
+                size_t size = event.GetMessage().size() + EVENT_OVERHEAD;
+                if (context->bytes + size > m_configuration.maxBytesPerRequest && !context->events.empty())
+                {
+                    break;
+                }
+                if (event.GetTimestamp() - firstTimestamp > MAX_BATCH_SPAN_MILLIS)
+                {
+                    break;
+                }
+
+                context->bytes += size;
+                context->events.push_back(std::move(event));
+                stream->events.pop_front();
+            }
+
+            stream->bytes -= context->bytes;
+            stream->sending = true;
+            return context;
+        }
+
+        void LogsShipper::SubmitBatch(const std::shared_ptr<PutLogEventsContext>& context)
+        {
+            // PutLogEvents runs on the executor, the sequence token it gets back is what the next batch of the stream is sent with
+            if (!m_configuration.executor->Submit([this, context]() { ShippingThreadScope scope; SendBatch(context); }))
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to submit PutLogEvents for log stream " << context->stream->name << " to the executor.");
+                CompleteBatch(context, BatchStatus::RETRY);
+            }
+        }
+
+        void LogsShipper::SendBatch(const std::shared_ptr<PutLogEventsContext>& context)
+        {
+            PutLogEventsRequest putLogEventsRequest;
+            putLogEventsRequest.SetLogGroupName(m_configuration.logGroupName);
+            putLogEventsRequest.SetLogStreamName(context->stream->name);
+            putLogEventsRequest.SetLogEvents(context->events);
+            if (!context->sequenceToken.empty())
+            {
+                putLogEventsRequest.SetSequenceToken(context->sequenceToken);
+            }
+
+            AWS_LOGSTREAM_TRACE(CLASS_TAG, "Sending " << context->events.size() << " events of " << context->bytes << " bytes to log stream " << context->stream->name);
+            auto putLogEventsOutcome = m_configuration.logsClient->PutLogEvents(putLogEventsRequest);
+            if (putLogEventsOutcome.IsSuccess())
+            {
+                const auto& rejected = putLogEventsOutcome.GetResult().GetRejectedLogEventsInfo();
+                if (rejected.GetTooNewLogEventStartIndex() > 0 || rejected.GetTooOldLogEventEndIndex() > 0 || rejected.GetExpiredLogEventEndIndex() > 0)
+                {
+                    AWS_LOGSTREAM_WARN(CLASS_TAG, "CloudWatch Logs rejected events sent to log stream " << context->stream->name
+                            << " for being too old or too far in the future.");
+                }
+                context->sequenceToken = putLogEventsOutcome.GetResult().GetNextSequenceToken();
+                CompleteBatch(context, BatchStatus::SENT);
+                return;
+            }
+
+            const auto& error = putLogEventsOutcome.GetError();
+            switch (error.GetErrorType())
+            {
+            case CloudWatchLogsErrors::INVALID_SEQUENCE_TOKEN:
+                // something else wrote to the stream, or this is the first batch sent to an existing stream
+                // writers racing for the stream back off like on any other error, rather than taking turns invalidating each other's token
+                AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Sequence token of log stream " << context->stream->name << " is out of date, recovering it.");
+                RecoverSequenceToken(context, error.GetMessage());
+                CompleteBatch(context, BatchStatus::RETRY);
+                return;
+            case CloudWatchLogsErrors::DATA_ALREADY_ACCEPTED:
+                // a previous attempt made it after all
+                RecoverSequenceToken(context, error.GetMessage());
+                CompleteBatch(context, BatchStatus::SENT);
+                return;
+            case CloudWatchLogsErrors::RESOURCE_NOT_FOUND:
+                if (m_configuration.createLogStreams)
+                {
+                    CreateLogStream(context->stream->name);
+                    context->sequenceToken.clear();
+                    CompleteBatch(context, BatchStatus::RETRY);
+                    return;
+                }
+                break;
+            default:
+                break;
+            }
+
+            AWS_LOGSTREAM_ERROR(CLASS_TAG, "PutLogEvents of " << context->events.size() << " events to log stream " << context->stream->name
+                    << " failed. " << error);
+            // the batch would fail the same way again unless the error is transient
+            CompleteBatch(context, error.ShouldRetry() ? BatchStatus::RETRY : BatchStatus::FAILED);
+        }
+
+        void LogsShipper::RecoverSequenceToken(const std::shared_ptr<PutLogEventsContext>& context, const Aws::String& errorMessage)
+        {
+            auto marker = errorMessage.rfind(SEQUENCE_TOKEN_MARKER);
+            auto colon = marker == Aws::String::npos ? Aws::String::npos : errorMessage.find(':', marker);
+            auto start = colon == Aws::String::npos ? Aws::String::npos : errorMessage.find_first_not_of(' ', colon + 1);
+            if (start != Aws::String::npos)
+            {
+                auto end = errorMessage.find_first_of(" \t\r\n", start);
+                Aws::String token = errorMessage.substr(start, end == Aws::String::npos ? Aws::String::npos : end - start);
+                context->sequenceToken = token == NULL_SEQUENCE_TOKEN ? "" : token;
+                return;
+            }
+
+            DescribeLogStreamsRequest describeLogStreamsRequest;
+            describeLogStreamsRequest.SetLogGroupName(m_configuration.logGroupName);
+            describeLogStreamsRequest.SetLogStreamNamePrefix(context->stream->name);
+            auto describeLogStreamsOutcome = m_configuration.logsClient->DescribeLogStreams(describeLogStreamsRequest);
+            if (!describeLogStreamsOutcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to describe log stream " << context->stream->name << ". " << describeLogStreamsOutcome.GetError());
+                return;
+            }
+
+            // the prefix may match other streams too
+            for (const auto& logStream : describeLogStreamsOutcome.GetResult().GetLogStreams())
+            {
+                if (logStream.GetLogStreamName() == context->stream->name)
+                {
+                    context->sequenceToken = logStream.GetUploadSequenceToken();
+                    return;
+                }
+            }
+            AWS_LOGSTREAM_WARN(CLASS_TAG, "Log stream " << context->stream->name << " wasn't described, retrying with the sequence token it had.");
+        }
+
+        void LogsShipper::CreateLogStream(const Aws::String& logStreamName)
+        {
+            CreateLogStreamRequest createLogStreamRequest;
+            createLogStreamRequest.SetLogGroupName(m_configuration.logGroupName);
+            createLogStreamRequest.SetLogStreamName(logStreamName);
+            auto createLogStreamOutcome = m_configuration.logsClient->CreateLogStream(createLogStreamRequest);
+            if (!createLogStreamOutcome.IsSuccess() && createLogStreamOutcome.GetError().GetErrorType() == CloudWatchLogsErrors::RESOURCE_NOT_FOUND)
+            {
+                AWS_LOGSTREAM_INFO(CLASS_TAG, "Creating log group " << m_configuration.logGroupName);
+                CreateLogGroupRequest createLogGroupRequest;
+                createLogGroupRequest.SetLogGroupName(m_configuration.logGroupName);
+                auto createLogGroupOutcome = m_configuration.logsClient->CreateLogGroup(createLogGroupRequest);
+                if (!createLogGroupOutcome.IsSuccess() && createLogGroupOutcome.GetError().GetErrorType() != CloudWatchLogsErrors::RESOURCE_ALREADY_EXISTS)
+                {
+                    AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to create log group " << m_configuration.logGroupName << ". " << createLogGroupOutcome.GetError());
+                    return;
+                }
+                createLogStreamOutcome = m_configuration.logsClient->CreateLogStream(createLogStreamRequest);
+            }
+
+            if (!createLogStreamOutcome.IsSuccess() && createLogStreamOutcome.GetError().GetErrorType() != CloudWatchLogsErrors::RESOURCE_ALREADY_EXISTS)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to create log stream " << logStreamName << ". " << createLogStreamOutcome.GetError());
+                return;
+            }
+            AWS_LOGSTREAM_INFO(CLASS_TAG, "Created log stream " << logStreamName << " in log group " << m_configuration.logGroupName);
+        }
+
+        void LogsShipper::CompleteBatch(const std::shared_ptr<PutLogEventsContext>& context, BatchStatus status)
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            auto& stream = *context->stream;
+            stream.sequenceToken = context->sequenceToken;
+            stream.sending = false;
+
+            bool release = true;
+            if (status == BatchStatus::SENT)
+            {
+                stream.attempts = 0;
+                m_metrics.entriesSucceeded += context->events.size();
+            }
+            else if (status == BatchStatus::FAILED || ++stream.attempts > m_configuration.maxRetries)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Giving up on " << context->events.size() << " events for log stream " << stream.name << ".");
+                stream.attempts = 0;
+                m_metrics.entriesFailed += context->events.size();
+            }
+            else
+            {
+                // the batch goes back to the front of its stream, and stays counted as buffered
+                release = false;
+                if (!stream.events.empty() && stream.events.front().GetTimestamp() < context->events.back().GetTimestamp())
+                {
+                    stream.ordered = false;
+                }
+                stream.events.insert(stream.events.begin(), context->events.begin(), context->events.end());
+                stream.bytes += context->bytes;
+
+                // the batch was due already, it only waits out the backoff
+                stream.retryAt = std::chrono::steady_clock::now() + ComputeRetryDelay(stream.attempts, m_configuration.retryBaseDelay, m_configuration.maxRetryDelay);
+                stream.deadline = stream.retryAt;
+                m_metrics.entriesRetried += context->events.size();
+            }
+
+            if (release)
+            {
+                m_bufferedEvents -= context->events.size();
+                m_bufferedBytes -= context->bytes;
+            }
+            locker.unlock();
+
+            CompleteRequest();
+        }
+    }
+}
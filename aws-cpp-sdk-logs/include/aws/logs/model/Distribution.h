@@ -34,7 +34,8 @@ namespace DistributionMapper
 {
 AWS_CLOUDWATCHLOGS_API Distribution GetDistributionForName(const Aws::String& name);
 
-AWS_CLOUDWATCHLOGS_API Aws::String GetNameForDistribution(Distribution value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDWATCHLOGS_API const char* GetNameForDistribution(Distribution value);
 } // namespace DistributionMapper
 } // namespace Model
 } // namespace CloudWatchLogs
@@ -38,7 +38,8 @@ namespace ExportTaskStatusCodeMapper
 {
 AWS_CLOUDWATCHLOGS_API ExportTaskStatusCode GetExportTaskStatusCodeForName(const Aws::String& name);
 
-AWS_CLOUDWATCHLOGS_API Aws::String GetNameForExportTaskStatusCode(ExportTaskStatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDWATCHLOGS_API const char* GetNameForExportTaskStatusCode(ExportTaskStatusCode value);
 } // namespace ExportTaskStatusCodeMapper
 } // namespace Model
 } // namespace CloudWatchLogs
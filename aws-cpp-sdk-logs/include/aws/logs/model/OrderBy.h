@@ -34,7 +34,8 @@ namespace OrderByMapper
 {
 AWS_CLOUDWATCHLOGS_API OrderBy GetOrderByForName(const Aws::String& name);
 
-AWS_CLOUDWATCHLOGS_API Aws::String GetNameForOrderBy(OrderBy value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDWATCHLOGS_API const char* GetNameForOrderBy(OrderBy value);
 } // namespace OrderByMapper
 } // namespace Model
 } // namespace CloudWatchLogs
@@ -28,13 +28,13 @@ namespace CloudWatchLogs
 namespace CloudWatchLogsErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int OPERATION_ABORTED_HASH = HashingUtils::HashString("OperationAbortedException");
-static const int INVALID_SEQUENCE_TOKEN_HASH = HashingUtils::HashString("InvalidSequenceTokenException");
-static const int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ResourceAlreadyExistsException");
-static const int INVALID_OPERATION_HASH = HashingUtils::HashString("InvalidOperationException");
-static const int DATA_ALREADY_ACCEPTED_HASH = HashingUtils::HashString("DataAlreadyAcceptedException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int OPERATION_ABORTED_HASH = HashingUtils::CompileTimeHashString("OperationAbortedException");
+static constexpr int INVALID_SEQUENCE_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidSequenceTokenException");
+static constexpr int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyExistsException");
+static constexpr int INVALID_OPERATION_HASH = HashingUtils::CompileTimeHashString("InvalidOperationException");
+static constexpr int DATA_ALREADY_ACCEPTED_HASH = HashingUtils::CompileTimeHashString("DataAlreadyAcceptedException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace DistributionMapper
       {
 
-        static const int Random_HASH = HashingUtils::HashString("Random");
-        static const int ByLogStream_HASH = HashingUtils::HashString("ByLogStream");
+        static constexpr int Random_HASH = HashingUtils::CompileTimeHashString("Random");
+        static constexpr int ByLogStream_HASH = HashingUtils::CompileTimeHashString("ByLogStream");
 
 
         Distribution GetDistributionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Random_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Distribution::Random;
-          }
-          else if (hashCode == ByLogStream_HASH)
-          {
-            return Distribution::ByLogStream;
+          case Random_HASH:
+            if (name == "Random")
+            {
+              return Distribution::Random;
+            }
+            break;
+          case ByLogStream_HASH:
+            if (name == "ByLogStream")
+            {
+              return Distribution::ByLogStream;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Distribution::NOT_SET;
         }
 
-        Aws::String GetNameForDistribution(Distribution enumValue)
+        const char* GetNameForDistribution(Distribution enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
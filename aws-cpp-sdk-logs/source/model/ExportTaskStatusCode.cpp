@@ -30,40 +30,58 @@ namespace Aws
       namespace ExportTaskStatusCodeMapper
       {
 
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int PENDING_CANCEL_HASH = HashingUtils::HashString("PENDING_CANCEL");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
+        static constexpr int CANCELLED_HASH = HashingUtils::CompileTimeHashString("CANCELLED");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int PENDING_CANCEL_HASH = HashingUtils::CompileTimeHashString("PENDING_CANCEL");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
 
 
         ExportTaskStatusCode GetExportTaskStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CANCELLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExportTaskStatusCode::CANCELLED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ExportTaskStatusCode::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ExportTaskStatusCode::FAILED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return ExportTaskStatusCode::PENDING;
-          }
-          else if (hashCode == PENDING_CANCEL_HASH)
-          {
-            return ExportTaskStatusCode::PENDING_CANCEL;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ExportTaskStatusCode::RUNNING;
+          case CANCELLED_HASH:
+            if (name == "CANCELLED")
+            {
+              return ExportTaskStatusCode::CANCELLED;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return ExportTaskStatusCode::COMPLETED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ExportTaskStatusCode::FAILED;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ExportTaskStatusCode::PENDING;
+            }
+            break;
+          case PENDING_CANCEL_HASH:
+            if (name == "PENDING_CANCEL")
+            {
+              return ExportTaskStatusCode::PENDING_CANCEL;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return ExportTaskStatusCode::RUNNING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ExportTaskStatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForExportTaskStatusCode(ExportTaskStatusCode enumValue)
+        const char* GetNameForExportTaskStatusCode(ExportTaskStatusCode enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace OrderByMapper
       {
 
-        static const int LogStreamName_HASH = HashingUtils::HashString("LogStreamName");
-        static const int LastEventTime_HASH = HashingUtils::HashString("LastEventTime");
+        static constexpr int LogStreamName_HASH = HashingUtils::CompileTimeHashString("LogStreamName");
+        static constexpr int LastEventTime_HASH = HashingUtils::CompileTimeHashString("LastEventTime");
 
 
         OrderBy GetOrderByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LogStreamName_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OrderBy::LogStreamName;
-          }
-          else if (hashCode == LastEventTime_HASH)
-          {
-            return OrderBy::LastEventTime;
+          case LogStreamName_HASH:
+            if (name == "LogStreamName")
+            {
+              return OrderBy::LogStreamName;
+            }
+            break;
+          case LastEventTime_HASH:
+            if (name == "LastEventTime")
+            {
+              return OrderBy::LastEventTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OrderBy::NOT_SET;
         }
 
-        Aws::String GetNameForOrderBy(OrderBy enumValue)
+        const char* GetNameForOrderBy(OrderBy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -33,7 +33,8 @@ namespace AlgorithmMapper
 {
 AWS_MACHINELEARNING_API Algorithm GetAlgorithmForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForAlgorithm(Algorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForAlgorithm(Algorithm value);
 } // namespace AlgorithmMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -40,7 +40,8 @@ namespace BatchPredictionFilterVariableMapper
 {
 AWS_MACHINELEARNING_API BatchPredictionFilterVariable GetBatchPredictionFilterVariableForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForBatchPredictionFilterVariable(BatchPredictionFilterVariable value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForBatchPredictionFilterVariable(BatchPredictionFilterVariable value);
 } // namespace BatchPredictionFilterVariableMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -38,7 +38,8 @@ namespace DataSourceFilterVariableMapper
 {
 AWS_MACHINELEARNING_API DataSourceFilterVariable GetDataSourceFilterVariableForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForDataSourceFilterVariable(DataSourceFilterVariable value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForDataSourceFilterVariable(DataSourceFilterVariable value);
 } // namespace DataSourceFilterVariableMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -34,7 +34,8 @@ namespace DetailsAttributesMapper
 {
 AWS_MACHINELEARNING_API DetailsAttributes GetDetailsAttributesForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForDetailsAttributes(DetailsAttributes value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForDetailsAttributes(DetailsAttributes value);
 } // namespace DetailsAttributesMapper
 } // namespace Model
 } // namespace MachineLearning
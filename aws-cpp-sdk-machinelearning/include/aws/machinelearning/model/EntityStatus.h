@@ -37,7 +37,8 @@ namespace EntityStatusMapper
 {
 AWS_MACHINELEARNING_API EntityStatus GetEntityStatusForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForEntityStatus(EntityStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForEntityStatus(EntityStatus value);
 } // namespace EntityStatusMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -40,7 +40,8 @@ namespace EvaluationFilterVariableMapper
 {
 AWS_MACHINELEARNING_API EvaluationFilterVariable GetEvaluationFilterVariableForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForEvaluationFilterVariable(EvaluationFilterVariable value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForEvaluationFilterVariable(EvaluationFilterVariable value);
 } // namespace EvaluationFilterVariableMapper
 } // namespace Model
 } // namespace MachineLearning
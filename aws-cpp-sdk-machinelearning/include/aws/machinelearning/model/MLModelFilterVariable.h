@@ -42,7 +42,8 @@ namespace MLModelFilterVariableMapper
 {
 AWS_MACHINELEARNING_API MLModelFilterVariable GetMLModelFilterVariableForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForMLModelFilterVariable(MLModelFilterVariable value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForMLModelFilterVariable(MLModelFilterVariable value);
 } // namespace MLModelFilterVariableMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -35,7 +35,8 @@ namespace MLModelTypeMapper
 {
 AWS_MACHINELEARNING_API MLModelType GetMLModelTypeForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForMLModelType(MLModelType value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForMLModelType(MLModelType value);
 } // namespace MLModelTypeMapper
 } // namespace Model
 } // namespace MachineLearning
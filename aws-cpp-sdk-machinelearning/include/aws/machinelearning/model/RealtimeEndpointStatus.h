@@ -36,7 +36,8 @@ namespace RealtimeEndpointStatusMapper
 {
 AWS_MACHINELEARNING_API RealtimeEndpointStatus GetRealtimeEndpointStatusForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForRealtimeEndpointStatus(RealtimeEndpointStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForRealtimeEndpointStatus(RealtimeEndpointStatus value);
 } // namespace RealtimeEndpointStatusMapper
 } // namespace Model
 } // namespace MachineLearning
@@ -36,7 +36,8 @@ namespace TaggableResourceTypeMapper
 {
 AWS_MACHINELEARNING_API TaggableResourceType GetTaggableResourceTypeForName(const Aws::String& name);
 
-AWS_MACHINELEARNING_API Aws::String GetNameForTaggableResourceType(TaggableResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_MACHINELEARNING_API const char* GetNameForTaggableResourceType(TaggableResourceType value);
 } // namespace TaggableResourceTypeMapper
 } // namespace Model
 } // namespace MachineLearning
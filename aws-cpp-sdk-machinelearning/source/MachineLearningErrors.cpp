@@ -28,13 +28,13 @@ namespace MachineLearning
 namespace MachineLearningErrorMapper
 {
 
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInputException");
-static const int INVALID_TAG_HASH = HashingUtils::HashString("InvalidTagException");
-static const int INTERNAL_SERVER_HASH = HashingUtils::HashString("InternalServerException");
-static const int TAG_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TagLimitExceededException");
-static const int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::HashString("IdempotentParameterMismatchException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int PREDICTOR_NOT_MOUNTED_HASH = HashingUtils::HashString("PredictorNotMountedException");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInputException");
+static constexpr int INVALID_TAG_HASH = HashingUtils::CompileTimeHashString("InvalidTagException");
+static constexpr int INTERNAL_SERVER_HASH = HashingUtils::CompileTimeHashString("InternalServerException");
+static constexpr int TAG_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TagLimitExceededException");
+static constexpr int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::CompileTimeHashString("IdempotentParameterMismatchException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int PREDICTOR_NOT_MOUNTED_HASH = HashingUtils::CompileTimeHashString("PredictorNotMountedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,15 +30,23 @@ namespace Aws
       namespace AlgorithmMapper
       {
 
-        static const int sgd_HASH = HashingUtils::HashString("sgd");
+        static constexpr int sgd_HASH = HashingUtils::CompileTimeHashString("sgd");
 
 
         Algorithm GetAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == sgd_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Algorithm::sgd;
+          case sgd_HASH:
+            if (name == "sgd")
+            {
+              return Algorithm::sgd;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return Algorithm::NOT_SET;
         }
 
-        Aws::String GetNameForAlgorithm(Algorithm enumValue)
+        const char* GetNameForAlgorithm(Algorithm enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
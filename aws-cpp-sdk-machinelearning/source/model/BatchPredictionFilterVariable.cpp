@@ -30,50 +30,72 @@ namespace Aws
       namespace BatchPredictionFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
-        static const int MLModelId_HASH = HashingUtils::HashString("MLModelId");
-        static const int DataSourceId_HASH = HashingUtils::HashString("DataSourceId");
-        static const int DataURI_HASH = HashingUtils::HashString("DataURI");
+        static constexpr int CreatedAt_HASH = HashingUtils::CompileTimeHashString("CreatedAt");
+        static constexpr int LastUpdatedAt_HASH = HashingUtils::CompileTimeHashString("LastUpdatedAt");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int IAMUser_HASH = HashingUtils::CompileTimeHashString("IAMUser");
+        static constexpr int MLModelId_HASH = HashingUtils::CompileTimeHashString("MLModelId");
+        static constexpr int DataSourceId_HASH = HashingUtils::CompileTimeHashString("DataSourceId");
+        static constexpr int DataURI_HASH = HashingUtils::CompileTimeHashString("DataURI");
 
 
         BatchPredictionFilterVariable GetBatchPredictionFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BatchPredictionFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
-            return BatchPredictionFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return BatchPredictionFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return BatchPredictionFilterVariable::Name;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
-            return BatchPredictionFilterVariable::IAMUser;
-          }
-          else if (hashCode == MLModelId_HASH)
-          {
-            return BatchPredictionFilterVariable::MLModelId;
-          }
-          else if (hashCode == DataSourceId_HASH)
-          {
-            return BatchPredictionFilterVariable::DataSourceId;
-          }
-          else if (hashCode == DataURI_HASH)
-          {
-            return BatchPredictionFilterVariable::DataURI;
+          case CreatedAt_HASH:
+            if (name == "CreatedAt")
+            {
+              return BatchPredictionFilterVariable::CreatedAt;
+            }
+            break;
+          case LastUpdatedAt_HASH:
+            if (name == "LastUpdatedAt")
+            {
+              return BatchPredictionFilterVariable::LastUpdatedAt;
+            }
+            break;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return BatchPredictionFilterVariable::Status;
+            }
+            break;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return BatchPredictionFilterVariable::Name;
+            }
+            break;
+          case IAMUser_HASH:
+            if (name == "IAMUser")
+            {
+              return BatchPredictionFilterVariable::IAMUser;
+            }
+            break;
+          case MLModelId_HASH:
+            if (name == "MLModelId")
+            {
+              return BatchPredictionFilterVariable::MLModelId;
+            }
+            break;
+          case DataSourceId_HASH:
+            if (name == "DataSourceId")
+            {
+              return BatchPredictionFilterVariable::DataSourceId;
+            }
+            break;
+          case DataURI_HASH:
+            if (name == "DataURI")
+            {
+              return BatchPredictionFilterVariable::DataURI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return BatchPredictionFilterVariable::NOT_SET;
         }
 
-        Aws::String GetNameForBatchPredictionFilterVariable(BatchPredictionFilterVariable enumValue)
+        const char* GetNameForBatchPredictionFilterVariable(BatchPredictionFilterVariable enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace DataSourceFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int DataLocationS3_HASH = HashingUtils::HashString("DataLocationS3");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
+        static constexpr int CreatedAt_HASH = HashingUtils::CompileTimeHashString("CreatedAt");
+        static constexpr int LastUpdatedAt_HASH = HashingUtils::CompileTimeHashString("LastUpdatedAt");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int DataLocationS3_HASH = HashingUtils::CompileTimeHashString("DataLocationS3");
+        static constexpr int IAMUser_HASH = HashingUtils::CompileTimeHashString("IAMUser");
 
 
         DataSourceFilterVariable GetDataSourceFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DataSourceFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
-            return DataSourceFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return DataSourceFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return DataSourceFilterVariable::Name;
-          }
-          else if (hashCode == DataLocationS3_HASH)
-          {
-            return DataSourceFilterVariable::DataLocationS3;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
-            return DataSourceFilterVariable::IAMUser;
+          case CreatedAt_HASH:
+            if (name == "CreatedAt")
+            {
+              return DataSourceFilterVariable::CreatedAt;
+            }
+            break;
+          case LastUpdatedAt_HASH:
+            if (name == "LastUpdatedAt")
+            {
+              return DataSourceFilterVariable::LastUpdatedAt;
+            }
+            break;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return DataSourceFilterVariable::Status;
+            }
+            break;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return DataSourceFilterVariable::Name;
+            }
+            break;
+          case DataLocationS3_HASH:
+            if (name == "DataLocationS3")
+            {
+              return DataSourceFilterVariable::DataLocationS3;
+            }
+            break;
+          case IAMUser_HASH:
+            if (name == "IAMUser")
+            {
+              return DataSourceFilterVariable::IAMUser;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return DataSourceFilterVariable::NOT_SET;
         }
 
-        Aws::String GetNameForDataSourceFilterVariable(DataSourceFilterVariable enumValue)
+        const char* GetNameForDataSourceFilterVariable(DataSourceFilterVariable enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
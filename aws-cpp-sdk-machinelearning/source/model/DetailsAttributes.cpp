@@ -30,20 +30,30 @@ namespace Aws
       namespace DetailsAttributesMapper
       {
 
-        static const int PredictiveModelType_HASH = HashingUtils::HashString("PredictiveModelType");
-        static const int Algorithm_HASH = HashingUtils::HashString("Algorithm");
+        static constexpr int PredictiveModelType_HASH = HashingUtils::CompileTimeHashString("PredictiveModelType");
+        static constexpr int Algorithm_HASH = HashingUtils::CompileTimeHashString("Algorithm");
 
 
         DetailsAttributes GetDetailsAttributesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PredictiveModelType_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DetailsAttributes::PredictiveModelType;
-          }
-          else if (hashCode == Algorithm_HASH)
-          {
-            return DetailsAttributes::Algorithm;
+          case PredictiveModelType_HASH:
+            if (name == "PredictiveModelType")
+            {
+              return DetailsAttributes::PredictiveModelType;
+            }
+            break;
+          case Algorithm_HASH:
+            if (name == "Algorithm")
+            {
+              return DetailsAttributes::Algorithm;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DetailsAttributes::NOT_SET;
         }
 
-        Aws::String GetNameForDetailsAttributes(DetailsAttributes enumValue)
+        const char* GetNameForDetailsAttributes(DetailsAttributes enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
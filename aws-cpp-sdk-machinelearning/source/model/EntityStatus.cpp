@@ -30,35 +30,51 @@ namespace Aws
       namespace EntityStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int INPROGRESS_HASH = HashingUtils::HashString("INPROGRESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int INPROGRESS_HASH = HashingUtils::CompileTimeHashString("INPROGRESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         EntityStatus GetEntityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EntityStatus::PENDING;
-          }
-          else if (hashCode == INPROGRESS_HASH)
-          {
-            return EntityStatus::INPROGRESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return EntityStatus::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return EntityStatus::COMPLETED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return EntityStatus::DELETED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return EntityStatus::PENDING;
+            }
+            break;
+          case INPROGRESS_HASH:
+            if (name == "INPROGRESS")
+            {
+              return EntityStatus::INPROGRESS;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return EntityStatus::FAILED;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return EntityStatus::COMPLETED;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return EntityStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return EntityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEntityStatus(EntityStatus enumValue)
+        const char* GetNameForEntityStatus(EntityStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace EvaluationFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
-        static const int MLModelId_HASH = HashingUtils::HashString("MLModelId");
-        static const int DataSourceId_HASH = HashingUtils::HashString("DataSourceId");
-        static const int DataURI_HASH = HashingUtils::HashString("DataURI");
+        static constexpr int CreatedAt_HASH = HashingUtils::CompileTimeHashString("CreatedAt");
+        static constexpr int LastUpdatedAt_HASH = HashingUtils::CompileTimeHashString("LastUpdatedAt");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int IAMUser_HASH = HashingUtils::CompileTimeHashString("IAMUser");
+        static constexpr int MLModelId_HASH = HashingUtils::CompileTimeHashString("MLModelId");
+        static constexpr int DataSourceId_HASH = HashingUtils::CompileTimeHashString("DataSourceId");
+        static constexpr int DataURI_HASH = HashingUtils::CompileTimeHashString("DataURI");
 
 
         EvaluationFilterVariable GetEvaluationFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EvaluationFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
-            return EvaluationFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return EvaluationFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return EvaluationFilterVariable::Name;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
-            return EvaluationFilterVariable::IAMUser;
-          }
-          else if (hashCode == MLModelId_HASH)
-          {
-            return EvaluationFilterVariable::MLModelId;
-          }
-          else if (hashCode == DataSourceId_HASH)
-          {
-            return EvaluationFilterVariable::DataSourceId;
-          }
-          else if (hashCode == DataURI_HASH)
-          {
-            return EvaluationFilterVariable::DataURI;
+          case CreatedAt_HASH:
+            if (name == "CreatedAt")
+            {
+              return EvaluationFilterVariable::CreatedAt;
+            }
+            break;
+          case LastUpdatedAt_HASH:
+            if (name == "LastUpdatedAt")
+            {
+              return EvaluationFilterVariable::LastUpdatedAt;
+            }
+            break;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return EvaluationFilterVariable::Status;
+            }
+            break;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return EvaluationFilterVariable::Name;
+            }
+            break;
+          case IAMUser_HASH:
+            if (name == "IAMUser")
+            {
+              return EvaluationFilterVariable::IAMUser;
+            }
+            break;
+          case MLModelId_HASH:
+            if (name == "MLModelId")
+            {
+              return EvaluationFilterVariable::MLModelId;
+            }
+            break;
+          case DataSourceId_HASH:
+            if (name == "DataSourceId")
+            {
+              return EvaluationFilterVariable::DataSourceId;
+            }
+            break;
+          case DataURI_HASH:
+            if (name == "DataURI")
+            {
+              return EvaluationFilterVariable::DataURI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return EvaluationFilterVariable::NOT_SET;
         }
 
-        Aws::String GetNameForEvaluationFilterVariable(EvaluationFilterVariable enumValue)
+        const char* GetNameForEvaluationFilterVariable(EvaluationFilterVariable enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
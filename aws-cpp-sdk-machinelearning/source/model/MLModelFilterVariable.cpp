@@ -30,60 +30,86 @@ namespace Aws
       namespace MLModelFilterVariableMapper
       {
 
-        static const int CreatedAt_HASH = HashingUtils::HashString("CreatedAt");
-        static const int LastUpdatedAt_HASH = HashingUtils::HashString("LastUpdatedAt");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int IAMUser_HASH = HashingUtils::HashString("IAMUser");
-        static const int TrainingDataSourceId_HASH = HashingUtils::HashString("TrainingDataSourceId");
-        static const int RealtimeEndpointStatus_HASH = HashingUtils::HashString("RealtimeEndpointStatus");
-        static const int MLModelType_HASH = HashingUtils::HashString("MLModelType");
-        static const int Algorithm_HASH = HashingUtils::HashString("Algorithm");
-        static const int TrainingDataURI_HASH = HashingUtils::HashString("TrainingDataURI");
+        static constexpr int CreatedAt_HASH = HashingUtils::CompileTimeHashString("CreatedAt");
+        static constexpr int LastUpdatedAt_HASH = HashingUtils::CompileTimeHashString("LastUpdatedAt");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int IAMUser_HASH = HashingUtils::CompileTimeHashString("IAMUser");
+        static constexpr int TrainingDataSourceId_HASH = HashingUtils::CompileTimeHashString("TrainingDataSourceId");
+        static constexpr int RealtimeEndpointStatus_HASH = HashingUtils::CompileTimeHashString("RealtimeEndpointStatus");
+        static constexpr int MLModelType_HASH = HashingUtils::CompileTimeHashString("MLModelType");
+        static constexpr int Algorithm_HASH = HashingUtils::CompileTimeHashString("Algorithm");
+        static constexpr int TrainingDataURI_HASH = HashingUtils::CompileTimeHashString("TrainingDataURI");
 
 
         MLModelFilterVariable GetMLModelFilterVariableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CreatedAt_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MLModelFilterVariable::CreatedAt;
-          }
-          else if (hashCode == LastUpdatedAt_HASH)
-          {
-            return MLModelFilterVariable::LastUpdatedAt;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return MLModelFilterVariable::Status;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return MLModelFilterVariable::Name;
-          }
-          else if (hashCode == IAMUser_HASH)
-          {
-            return MLModelFilterVariable::IAMUser;
-          }
-          else if (hashCode == TrainingDataSourceId_HASH)
-          {
-            return MLModelFilterVariable::TrainingDataSourceId;
-          }
-          else if (hashCode == RealtimeEndpointStatus_HASH)
-          {
-            return MLModelFilterVariable::RealtimeEndpointStatus;
-          }
-          else if (hashCode == MLModelType_HASH)
-          {
-            return MLModelFilterVariable::MLModelType;
-          }
-          else if (hashCode == Algorithm_HASH)
-          {
-            return MLModelFilterVariable::Algorithm;
-          }
-          else if (hashCode == TrainingDataURI_HASH)
-          {
-            return MLModelFilterVariable::TrainingDataURI;
+          case CreatedAt_HASH:
+            if (name == "CreatedAt")
+            {
+              return MLModelFilterVariable::CreatedAt;
+            }
+            break;
+          case LastUpdatedAt_HASH:
+            if (name == "LastUpdatedAt")
+            {
+              return MLModelFilterVariable::LastUpdatedAt;
+            }
+            break;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return MLModelFilterVariable::Status;
+            }
+            break;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return MLModelFilterVariable::Name;
+            }
+            break;
+          case IAMUser_HASH:
+            if (name == "IAMUser")
+            {
+              return MLModelFilterVariable::IAMUser;
+            }
+            break;
+          case TrainingDataSourceId_HASH:
+            if (name == "TrainingDataSourceId")
+            {
+              return MLModelFilterVariable::TrainingDataSourceId;
+            }
+            break;
+          case RealtimeEndpointStatus_HASH:
+            if (name == "RealtimeEndpointStatus")
+            {
+              return MLModelFilterVariable::RealtimeEndpointStatus;
+            }
+            break;
+          case MLModelType_HASH:
+            if (name == "MLModelType")
+            {
+              return MLModelFilterVariable::MLModelType;
+            }
+            break;
+          case Algorithm_HASH:
+            if (name == "Algorithm")
+            {
+              return MLModelFilterVariable::Algorithm;
+            }
+            break;
+          case TrainingDataURI_HASH:
+            if (name == "TrainingDataURI")
+            {
+              return MLModelFilterVariable::TrainingDataURI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return MLModelFilterVariable::NOT_SET;
         }
 
-        Aws::String GetNameForMLModelFilterVariable(MLModelFilterVariable enumValue)
+        const char* GetNameForMLModelFilterVariable(MLModelFilterVariable enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
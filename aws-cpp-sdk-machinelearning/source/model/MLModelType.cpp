@@ -30,25 +30,37 @@ namespace Aws
       namespace MLModelTypeMapper
       {
 
-        static const int REGRESSION_HASH = HashingUtils::HashString("REGRESSION");
-        static const int BINARY_HASH = HashingUtils::HashString("BINARY");
-        static const int MULTICLASS_HASH = HashingUtils::HashString("MULTICLASS");
+        static constexpr int REGRESSION_HASH = HashingUtils::CompileTimeHashString("REGRESSION");
+        static constexpr int BINARY_HASH = HashingUtils::CompileTimeHashString("BINARY");
+        static constexpr int MULTICLASS_HASH = HashingUtils::CompileTimeHashString("MULTICLASS");
 
 
         MLModelType GetMLModelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGRESSION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MLModelType::REGRESSION;
-          }
-          else if (hashCode == BINARY_HASH)
-          {
-            return MLModelType::BINARY;
-          }
-          else if (hashCode == MULTICLASS_HASH)
-          {
-            return MLModelType::MULTICLASS;
+          case REGRESSION_HASH:
+            if (name == "REGRESSION")
+            {
+              return MLModelType::REGRESSION;
+            }
+            break;
+          case BINARY_HASH:
+            if (name == "BINARY")
+            {
+              return MLModelType::BINARY;
+            }
+            break;
+          case MULTICLASS_HASH:
+            if (name == "MULTICLASS")
+            {
+              return MLModelType::MULTICLASS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return MLModelType::NOT_SET;
         }
 
-        Aws::String GetNameForMLModelType(MLModelType enumValue)
+        const char* GetNameForMLModelType(MLModelType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace RealtimeEndpointStatusMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int READY_HASH = HashingUtils::CompileTimeHashString("READY");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         RealtimeEndpointStatus GetRealtimeEndpointStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RealtimeEndpointStatus::NONE;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return RealtimeEndpointStatus::READY;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return RealtimeEndpointStatus::UPDATING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return RealtimeEndpointStatus::FAILED;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return RealtimeEndpointStatus::NONE;
+            }
+            break;
+          case READY_HASH:
+            if (name == "READY")
+            {
+              return RealtimeEndpointStatus::READY;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return RealtimeEndpointStatus::UPDATING;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return RealtimeEndpointStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return RealtimeEndpointStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRealtimeEndpointStatus(RealtimeEndpointStatus enumValue)
+        const char* GetNameForRealtimeEndpointStatus(RealtimeEndpointStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SortOrderMapper
       {
 
-        static const int asc_HASH = HashingUtils::HashString("asc");
-        static const int dsc_HASH = HashingUtils::HashString("dsc");
+        static constexpr int asc_HASH = HashingUtils::CompileTimeHashString("asc");
+        static constexpr int dsc_HASH = HashingUtils::CompileTimeHashString("dsc");
 
 
         SortOrder GetSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == asc_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SortOrder::asc;
-          }
-          else if (hashCode == dsc_HASH)
-          {
-            return SortOrder::dsc;
+          case asc_HASH:
+            if (name == "asc")
+            {
+              return SortOrder::asc;
+            }
+            break;
+          case dsc_HASH:
+            if (name == "dsc")
+            {
+              return SortOrder::dsc;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SortOrder::NOT_SET;
         }
 
-        Aws::String GetNameForSortOrder(SortOrder enumValue)
+        const char* GetNameForSortOrder(SortOrder enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace TaggableResourceTypeMapper
       {
 
-        static const int BatchPrediction_HASH = HashingUtils::HashString("BatchPrediction");
-        static const int DataSource_HASH = HashingUtils::HashString("DataSource");
-        static const int Evaluation_HASH = HashingUtils::HashString("Evaluation");
-        static const int MLModel_HASH = HashingUtils::HashString("MLModel");
+        static constexpr int BatchPrediction_HASH = HashingUtils::CompileTimeHashString("BatchPrediction");
+        static constexpr int DataSource_HASH = HashingUtils::CompileTimeHashString("DataSource");
+        static constexpr int Evaluation_HASH = HashingUtils::CompileTimeHashString("Evaluation");
+        static constexpr int MLModel_HASH = HashingUtils::CompileTimeHashString("MLModel");
 
 
         TaggableResourceType GetTaggableResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BatchPrediction_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TaggableResourceType::BatchPrediction;
-          }
-          else if (hashCode == DataSource_HASH)
-          {
-            return TaggableResourceType::DataSource;
-          }
-          else if (hashCode == Evaluation_HASH)
-          {
-            return TaggableResourceType::Evaluation;
-          }
-          else if (hashCode == MLModel_HASH)
-          {
-            return TaggableResourceType::MLModel;
+          case BatchPrediction_HASH:
+            if (name == "BatchPrediction")
+            {
+              return TaggableResourceType::BatchPrediction;
+            }
+            break;
+          case DataSource_HASH:
+            if (name == "DataSource")
+            {
+              return TaggableResourceType::DataSource;
+            }
+            break;
+          case Evaluation_HASH:
+            if (name == "Evaluation")
+            {
+              return TaggableResourceType::Evaluation;
+            }
+            break;
+          case MLModel_HASH:
+            if (name == "MLModel")
+            {
+              return TaggableResourceType::MLModel;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return TaggableResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForTaggableResourceType(TaggableResourceType enumValue)
+        const char* GetNameForTaggableResourceType(TaggableResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -33,7 +33,8 @@ namespace S3ContinuousClassificationTypeMapper
 {
 AWS_MACIE_API S3ContinuousClassificationType GetS3ContinuousClassificationTypeForName(const Aws::String& name);
 
-AWS_MACIE_API Aws::String GetNameForS3ContinuousClassificationType(S3ContinuousClassificationType value);
+// names of values not modeled point into the enum overflow container
+AWS_MACIE_API const char* GetNameForS3ContinuousClassificationType(S3ContinuousClassificationType value);
 } // namespace S3ContinuousClassificationTypeMapper
 } // namespace Model
 } // namespace Macie
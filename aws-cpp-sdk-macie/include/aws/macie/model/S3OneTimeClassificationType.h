@@ -34,7 +34,8 @@ namespace S3OneTimeClassificationTypeMapper
 {
 AWS_MACIE_API S3OneTimeClassificationType GetS3OneTimeClassificationTypeForName(const Aws::String& name);
 
-AWS_MACIE_API Aws::String GetNameForS3OneTimeClassificationType(S3OneTimeClassificationType value);
+// names of values not modeled point into the enum overflow container
+AWS_MACIE_API const char* GetNameForS3OneTimeClassificationType(S3OneTimeClassificationType value);
 } // namespace S3OneTimeClassificationTypeMapper
 } // namespace Model
 } // namespace Macie
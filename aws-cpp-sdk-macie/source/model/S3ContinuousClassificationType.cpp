@@ -30,15 +30,23 @@ namespace Aws
       namespace S3ContinuousClassificationTypeMapper
       {
 
-        static const int FULL_HASH = HashingUtils::HashString("FULL");
+        static constexpr int FULL_HASH = HashingUtils::CompileTimeHashString("FULL");
 
 
         S3ContinuousClassificationType GetS3ContinuousClassificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return S3ContinuousClassificationType::FULL;
+          case FULL_HASH:
+            if (name == "FULL")
+            {
+              return S3ContinuousClassificationType::FULL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return S3ContinuousClassificationType::NOT_SET;
         }
 
-        Aws::String GetNameForS3ContinuousClassificationType(S3ContinuousClassificationType enumValue)
+        const char* GetNameForS3ContinuousClassificationType(S3ContinuousClassificationType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
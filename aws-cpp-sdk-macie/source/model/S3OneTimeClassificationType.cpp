@@ -30,20 +30,30 @@ namespace Aws
       namespace S3OneTimeClassificationTypeMapper
       {
 
-        static const int FULL_HASH = HashingUtils::HashString("FULL");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int FULL_HASH = HashingUtils::CompileTimeHashString("FULL");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         S3OneTimeClassificationType GetS3OneTimeClassificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return S3OneTimeClassificationType::FULL;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return S3OneTimeClassificationType::NONE;
+          case FULL_HASH:
+            if (name == "FULL")
+            {
+              return S3OneTimeClassificationType::FULL;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return S3OneTimeClassificationType::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return S3OneTimeClassificationType::NOT_SET;
         }
 
-        Aws::String GetNameForS3OneTimeClassificationType(S3OneTimeClassificationType enumValue)
+        const char* GetNameForS3OneTimeClassificationType(S3OneTimeClassificationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
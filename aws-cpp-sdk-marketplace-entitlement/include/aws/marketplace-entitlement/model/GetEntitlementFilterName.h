@@ -34,7 +34,8 @@ namespace GetEntitlementFilterNameMapper
 {
 AWS_MARKETPLACEENTITLEMENTSERVICE_API GetEntitlementFilterName GetGetEntitlementFilterNameForName(const Aws::String& name);
 
-AWS_MARKETPLACEENTITLEMENTSERVICE_API Aws::String GetNameForGetEntitlementFilterName(GetEntitlementFilterName value);
+// names of values not modeled point into the enum overflow container
+AWS_MARKETPLACEENTITLEMENTSERVICE_API const char* GetNameForGetEntitlementFilterName(GetEntitlementFilterName value);
 } // namespace GetEntitlementFilterNameMapper
 } // namespace Model
 } // namespace MarketplaceEntitlementService
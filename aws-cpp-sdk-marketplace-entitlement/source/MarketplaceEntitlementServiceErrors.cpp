@@ -28,8 +28,8 @@ namespace MarketplaceEntitlementService
 namespace MarketplaceEntitlementServiceErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::HashString("InternalServiceErrorException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalServiceErrorException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace GetEntitlementFilterNameMapper
       {
 
-        static const int CUSTOMER_IDENTIFIER_HASH = HashingUtils::HashString("CUSTOMER_IDENTIFIER");
-        static const int DIMENSION_HASH = HashingUtils::HashString("DIMENSION");
+        static constexpr int CUSTOMER_IDENTIFIER_HASH = HashingUtils::CompileTimeHashString("CUSTOMER_IDENTIFIER");
+        static constexpr int DIMENSION_HASH = HashingUtils::CompileTimeHashString("DIMENSION");
 
 
         GetEntitlementFilterName GetGetEntitlementFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CUSTOMER_IDENTIFIER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GetEntitlementFilterName::CUSTOMER_IDENTIFIER;
-          }
-          else if (hashCode == DIMENSION_HASH)
-          {
-            return GetEntitlementFilterName::DIMENSION;
+          case CUSTOMER_IDENTIFIER_HASH:
+            if (name == "CUSTOMER_IDENTIFIER")
+            {
+              return GetEntitlementFilterName::CUSTOMER_IDENTIFIER;
+            }
+            break;
+          case DIMENSION_HASH:
+            if (name == "DIMENSION")
+            {
+              return GetEntitlementFilterName::DIMENSION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return GetEntitlementFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForGetEntitlementFilterName(GetEntitlementFilterName enumValue)
+        const char* GetNameForGetEntitlementFilterName(GetEntitlementFilterName enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -53,7 +53,8 @@ namespace DataSetTypeMapper
 {
 AWS_MARKETPLACECOMMERCEANALYTICS_API DataSetType GetDataSetTypeForName(const Aws::String& name);
 
-AWS_MARKETPLACECOMMERCEANALYTICS_API Aws::String GetNameForDataSetType(DataSetType value);
+// names of values not modeled point into the enum overflow container
+AWS_MARKETPLACECOMMERCEANALYTICS_API const char* GetNameForDataSetType(DataSetType value);
 } // namespace DataSetTypeMapper
 } // namespace Model
 } // namespace MarketplaceCommerceAnalytics
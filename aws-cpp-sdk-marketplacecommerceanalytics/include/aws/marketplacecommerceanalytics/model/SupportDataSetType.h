@@ -34,7 +34,8 @@ namespace SupportDataSetTypeMapper
 {
 AWS_MARKETPLACECOMMERCEANALYTICS_API SupportDataSetType GetSupportDataSetTypeForName(const Aws::String& name);
 
-AWS_MARKETPLACECOMMERCEANALYTICS_API Aws::String GetNameForSupportDataSetType(SupportDataSetType value);
+// names of values not modeled point into the enum overflow container
+AWS_MARKETPLACECOMMERCEANALYTICS_API const char* GetNameForSupportDataSetType(SupportDataSetType value);
 } // namespace SupportDataSetTypeMapper
 } // namespace Model
 } // namespace MarketplaceCommerceAnalytics
@@ -28,7 +28,7 @@ namespace MarketplaceCommerceAnalytics
 namespace MarketplaceCommerceAnalyticsErrorMapper
 {
 
-static const int MARKETPLACE_COMMERCE_ANALYTICS_HASH = HashingUtils::HashString("MarketplaceCommerceAnalyticsException");
+static constexpr int MARKETPLACE_COMMERCE_ANALYTICS_HASH = HashingUtils::CompileTimeHashString("MarketplaceCommerceAnalyticsException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,115 +30,163 @@ namespace Aws
       namespace DataSetTypeMapper
       {
 
-        static const int customer_subscriber_hourly_monthly_subscriptions_HASH = HashingUtils::HashString("customer_subscriber_hourly_monthly_subscriptions");
-        static const int customer_subscriber_annual_subscriptions_HASH = HashingUtils::HashString("customer_subscriber_annual_subscriptions");
-        static const int daily_business_usage_by_instance_type_HASH = HashingUtils::HashString("daily_business_usage_by_instance_type");
-        static const int daily_business_fees_HASH = HashingUtils::HashString("daily_business_fees");
-        static const int daily_business_free_trial_conversions_HASH = HashingUtils::HashString("daily_business_free_trial_conversions");
-        static const int daily_business_new_instances_HASH = HashingUtils::HashString("daily_business_new_instances");
-        static const int daily_business_new_product_subscribers_HASH = HashingUtils::HashString("daily_business_new_product_subscribers");
-        static const int daily_business_canceled_product_subscribers_HASH = HashingUtils::HashString("daily_business_canceled_product_subscribers");
-        static const int monthly_revenue_billing_and_revenue_data_HASH = HashingUtils::HashString("monthly_revenue_billing_and_revenue_data");
-        static const int monthly_revenue_annual_subscriptions_HASH = HashingUtils::HashString("monthly_revenue_annual_subscriptions");
-        static const int disbursed_amount_by_product_HASH = HashingUtils::HashString("disbursed_amount_by_product");
-        static const int disbursed_amount_by_product_with_uncollected_funds_HASH = HashingUtils::HashString("disbursed_amount_by_product_with_uncollected_funds");
-        static const int disbursed_amount_by_instance_hours_HASH = HashingUtils::HashString("disbursed_amount_by_instance_hours");
-        static const int disbursed_amount_by_customer_geo_HASH = HashingUtils::HashString("disbursed_amount_by_customer_geo");
-        static const int disbursed_amount_by_age_of_uncollected_funds_HASH = HashingUtils::HashString("disbursed_amount_by_age_of_uncollected_funds");
-        static const int disbursed_amount_by_age_of_disbursed_funds_HASH = HashingUtils::HashString("disbursed_amount_by_age_of_disbursed_funds");
-        static const int customer_profile_by_industry_HASH = HashingUtils::HashString("customer_profile_by_industry");
-        static const int customer_profile_by_revenue_HASH = HashingUtils::HashString("customer_profile_by_revenue");
-        static const int customer_profile_by_geography_HASH = HashingUtils::HashString("customer_profile_by_geography");
-        static const int sales_compensation_billed_revenue_HASH = HashingUtils::HashString("sales_compensation_billed_revenue");
-        static const int us_sales_and_use_tax_records_HASH = HashingUtils::HashString("us_sales_and_use_tax_records");
+        static constexpr int customer_subscriber_hourly_monthly_subscriptions_HASH = HashingUtils::CompileTimeHashString("customer_subscriber_hourly_monthly_subscriptions");
+        static constexpr int customer_subscriber_annual_subscriptions_HASH = HashingUtils::CompileTimeHashString("customer_subscriber_annual_subscriptions");
+        static constexpr int daily_business_usage_by_instance_type_HASH = HashingUtils::CompileTimeHashString("daily_business_usage_by_instance_type");
+        static constexpr int daily_business_fees_HASH = HashingUtils::CompileTimeHashString("daily_business_fees");
+        static constexpr int daily_business_free_trial_conversions_HASH = HashingUtils::CompileTimeHashString("daily_business_free_trial_conversions");
+        static constexpr int daily_business_new_instances_HASH = HashingUtils::CompileTimeHashString("daily_business_new_instances");
+        static constexpr int daily_business_new_product_subscribers_HASH = HashingUtils::CompileTimeHashString("daily_business_new_product_subscribers");
+        static constexpr int daily_business_canceled_product_subscribers_HASH = HashingUtils::CompileTimeHashString("daily_business_canceled_product_subscribers");
+        static constexpr int monthly_revenue_billing_and_revenue_data_HASH = HashingUtils::CompileTimeHashString("monthly_revenue_billing_and_revenue_data");
+        static constexpr int monthly_revenue_annual_subscriptions_HASH = HashingUtils::CompileTimeHashString("monthly_revenue_annual_subscriptions");
+        static constexpr int disbursed_amount_by_product_HASH = HashingUtils::CompileTimeHashString("disbursed_amount_by_product");
+        static constexpr int disbursed_amount_by_product_with_uncollected_funds_HASH = HashingUtils::CompileTimeHashString("disbursed_amount_by_product_with_uncollected_funds");
+        static constexpr int disbursed_amount_by_instance_hours_HASH = HashingUtils::CompileTimeHashString("disbursed_amount_by_instance_hours");
+        static constexpr int disbursed_amount_by_customer_geo_HASH = HashingUtils::CompileTimeHashString("disbursed_amount_by_customer_geo");
+        static constexpr int disbursed_amount_by_age_of_uncollected_funds_HASH = HashingUtils::CompileTimeHashString("disbursed_amount_by_age_of_uncollected_funds");
+        static constexpr int disbursed_amount_by_age_of_disbursed_funds_HASH = HashingUtils::CompileTimeHashString("disbursed_amount_by_age_of_disbursed_funds");
+        static constexpr int customer_profile_by_industry_HASH = HashingUtils::CompileTimeHashString("customer_profile_by_industry");
+        static constexpr int customer_profile_by_revenue_HASH = HashingUtils::CompileTimeHashString("customer_profile_by_revenue");
+        static constexpr int customer_profile_by_geography_HASH = HashingUtils::CompileTimeHashString("customer_profile_by_geography");
+        static constexpr int sales_compensation_billed_revenue_HASH = HashingUtils::CompileTimeHashString("sales_compensation_billed_revenue");
+        static constexpr int us_sales_and_use_tax_records_HASH = HashingUtils::CompileTimeHashString("us_sales_and_use_tax_records");
 
 
         DataSetType GetDataSetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == customer_subscriber_hourly_monthly_subscriptions_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DataSetType::customer_subscriber_hourly_monthly_subscriptions;
-          }
-          else if (hashCode == customer_subscriber_annual_subscriptions_HASH)
-          {
-            return DataSetType::customer_subscriber_annual_subscriptions;
-          }
-          else if (hashCode == daily_business_usage_by_instance_type_HASH)
-          {
-            return DataSetType::daily_business_usage_by_instance_type;
-          }
-          else if (hashCode == daily_business_fees_HASH)
-          {
-            return DataSetType::daily_business_fees;
-          }
-          else if (hashCode == daily_business_free_trial_conversions_HASH)
-          {
-            return DataSetType::daily_business_free_trial_conversions;
-          }
-          else if (hashCode == daily_business_new_instances_HASH)
-          {
-            return DataSetType::daily_business_new_instances;
-          }
-          else if (hashCode == daily_business_new_product_subscribers_HASH)
-          {
-            return DataSetType::daily_business_new_product_subscribers;
-          }
-          else if (hashCode == daily_business_canceled_product_subscribers_HASH)
-          {
-            return DataSetType::daily_business_canceled_product_subscribers;
-          }
-          else if (hashCode == monthly_revenue_billing_and_revenue_data_HASH)
-          {
-            return DataSetType::monthly_revenue_billing_and_revenue_data;
-          }
-          else if (hashCode == monthly_revenue_annual_subscriptions_HASH)
-          {
-            return DataSetType::monthly_revenue_annual_subscriptions;
-          }
-          else if (hashCode == disbursed_amount_by_product_HASH)
-          {
-            return DataSetType::disbursed_amount_by_product;
-          }
-          else if (hashCode == disbursed_amount_by_product_with_uncollected_funds_HASH)
-          {
-            return DataSetType::disbursed_amount_by_product_with_uncollected_funds;
-          }
-          else if (hashCode == disbursed_amount_by_instance_hours_HASH)
-          {
-            return DataSetType::disbursed_amount_by_instance_hours;
-          }
-          else if (hashCode == disbursed_amount_by_customer_geo_HASH)
-          {
-            return DataSetType::disbursed_amount_by_customer_geo;
-          }
-          else if (hashCode == disbursed_amount_by_age_of_uncollected_funds_HASH)
-          {
-            return DataSetType::disbursed_amount_by_age_of_uncollected_funds;
-          }
-          else if (hashCode == disbursed_amount_by_age_of_disbursed_funds_HASH)
-          {
-            return DataSetType::disbursed_amount_by_age_of_disbursed_funds;
-          }
-          else if (hashCode == customer_profile_by_industry_HASH)
-          {
-            return DataSetType::customer_profile_by_industry;
-          }
-          else if (hashCode == customer_profile_by_revenue_HASH)
-          {
-            return DataSetType::customer_profile_by_revenue;
-          }
-          else if (hashCode == customer_profile_by_geography_HASH)
-          {
-            return DataSetType::customer_profile_by_geography;
-          }
-          else if (hashCode == sales_compensation_billed_revenue_HASH)
-          {
-            return DataSetType::sales_compensation_billed_revenue;
-          }
-          else if (hashCode == us_sales_and_use_tax_records_HASH)
-          {
-            return DataSetType::us_sales_and_use_tax_records;
+          case customer_subscriber_hourly_monthly_subscriptions_HASH:
+            if (name == "customer_subscriber_hourly_monthly_subscriptions")
+            {
+              return DataSetType::customer_subscriber_hourly_monthly_subscriptions;
+            }
+            break;
+          case customer_subscriber_annual_subscriptions_HASH:
+            if (name == "customer_subscriber_annual_subscriptions")
+            {
+              return DataSetType::customer_subscriber_annual_subscriptions;
+            }
+            break;
+          case daily_business_usage_by_instance_type_HASH:
+            if (name == "daily_business_usage_by_instance_type")
+            {
+              return DataSetType::daily_business_usage_by_instance_type;
+            }
+            break;
+          case daily_business_fees_HASH:
+            if (name == "daily_business_fees")
+            {
+              return DataSetType::daily_business_fees;
+            }
+            break;
+          case daily_business_free_trial_conversions_HASH:
+            if (name == "daily_business_free_trial_conversions")
+            {
+              return DataSetType::daily_business_free_trial_conversions;
+            }
+            break;
+          case daily_business_new_instances_HASH:
+            if (name == "daily_business_new_instances")
+            {
+              return DataSetType::daily_business_new_instances;
+            }
+            break;
+          case daily_business_new_product_subscribers_HASH:
+            if (name == "daily_business_new_product_subscribers")
+            {
+              return DataSetType::daily_business_new_product_subscribers;
+            }
+            break;
+          case daily_business_canceled_product_subscribers_HASH:
+            if (name == "daily_business_canceled_product_subscribers")
+            {
+              return DataSetType::daily_business_canceled_product_subscribers;
+            }
+            break;
+          case monthly_revenue_billing_and_revenue_data_HASH:
+            if (name == "monthly_revenue_billing_and_revenue_data")
+            {
+              return DataSetType::monthly_revenue_billing_and_revenue_data;
+            }
+            break;
+          case monthly_revenue_annual_subscriptions_HASH:
+            if (name == "monthly_revenue_annual_subscriptions")
+            {
+              return DataSetType::monthly_revenue_annual_subscriptions;
+            }
+            break;
+          case disbursed_amount_by_product_HASH:
+            if (name == "disbursed_amount_by_product")
+            {
+              return DataSetType::disbursed_amount_by_product;
+            }
+            break;
+          case disbursed_amount_by_product_with_uncollected_funds_HASH:
+            if (name == "disbursed_amount_by_product_with_uncollected_funds")
+            {
+              return DataSetType::disbursed_amount_by_product_with_uncollected_funds;
+            }
+            break;
+          case disbursed_amount_by_instance_hours_HASH:
+            if (name == "disbursed_amount_by_instance_hours")
+            {
+              return DataSetType::disbursed_amount_by_instance_hours;
+            }
+            break;
+          case disbursed_amount_by_customer_geo_HASH:
+            if (name == "disbursed_amount_by_customer_geo")
+            {
+              return DataSetType::disbursed_amount_by_customer_geo;
+            }
+            break;
+          case disbursed_amount_by_age_of_uncollected_funds_HASH:
+            if (name == "disbursed_amount_by_age_of_uncollected_funds")
+            {
+              return DataSetType::disbursed_amount_by_age_of_uncollected_funds;
+            }
+            break;
+          case disbursed_amount_by_age_of_disbursed_funds_HASH:
+            if (name == "disbursed_amount_by_age_of_disbursed_funds")
+            {
+              return DataSetType::disbursed_amount_by_age_of_disbursed_funds;
+            }
+            break;
+          case customer_profile_by_industry_HASH:
+            if (name == "customer_profile_by_industry")
+            {
+              return DataSetType::customer_profile_by_industry;
+            }
+            break;
+          case customer_profile_by_revenue_HASH:
+            if (name == "customer_profile_by_revenue")
+            {
+              return DataSetType::customer_profile_by_revenue;
+            }
+            break;
+          case customer_profile_by_geography_HASH:
+            if (name == "customer_profile_by_geography")
+            {
+              return DataSetType::customer_profile_by_geography;
+            }
+            break;
+          case sales_compensation_billed_revenue_HASH:
+            if (name == "sales_compensation_billed_revenue")
+            {
+              return DataSetType::sales_compensation_billed_revenue;
+            }
+            break;
+          case us_sales_and_use_tax_records_HASH:
+            if (name == "us_sales_and_use_tax_records")
+            {
+              return DataSetType::us_sales_and_use_tax_records;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -150,7 +198,7 @@ namespace Aws
           return DataSetType::NOT_SET;
         }
 
-        Aws::String GetNameForDataSetType(DataSetType enumValue)
+        const char* GetNameForDataSetType(DataSetType enumValue)
         {
           switch(enumValue)
           {
@@ -200,7 +248,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SupportDataSetTypeMapper
       {
 
-        static const int customer_support_contacts_data_HASH = HashingUtils::HashString("customer_support_contacts_data");
-        static const int test_customer_support_contacts_data_HASH = HashingUtils::HashString("test_customer_support_contacts_data");
+        static constexpr int customer_support_contacts_data_HASH = HashingUtils::CompileTimeHashString("customer_support_contacts_data");
+        static constexpr int test_customer_support_contacts_data_HASH = HashingUtils::CompileTimeHashString("test_customer_support_contacts_data");
 
 
         SupportDataSetType GetSupportDataSetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == customer_support_contacts_data_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SupportDataSetType::customer_support_contacts_data;
-          }
-          else if (hashCode == test_customer_support_contacts_data_HASH)
-          {
-            return SupportDataSetType::test_customer_support_contacts_data;
+          case customer_support_contacts_data_HASH:
+            if (name == "customer_support_contacts_data")
+            {
+              return SupportDataSetType::customer_support_contacts_data;
+            }
+            break;
+          case test_customer_support_contacts_data_HASH:
+            if (name == "test_customer_support_contacts_data")
+            {
+              return SupportDataSetType::test_customer_support_contacts_data;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SupportDataSetType::NOT_SET;
         }
 
-        Aws::String GetNameForSupportDataSetType(SupportDataSetType enumValue)
+        const char* GetNameForSupportDataSetType(SupportDataSetType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace AacAudioDescriptionBroadcasterMixMapper
 {
 AWS_MEDIACONVERT_API AacAudioDescriptionBroadcasterMix GetAacAudioDescriptionBroadcasterMixForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAacAudioDescriptionBroadcasterMix(AacAudioDescriptionBroadcasterMix value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAacAudioDescriptionBroadcasterMix(AacAudioDescriptionBroadcasterMix value);
 } // namespace AacAudioDescriptionBroadcasterMixMapper
 } // namespace Model
 } // namespace MediaConvert
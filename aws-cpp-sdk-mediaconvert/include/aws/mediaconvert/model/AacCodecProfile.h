@@ -35,7 +35,8 @@ namespace AacCodecProfileMapper
 {
 AWS_MEDIACONVERT_API AacCodecProfile GetAacCodecProfileForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAacCodecProfile(AacCodecProfile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAacCodecProfile(AacCodecProfile value);
 } // namespace AacCodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
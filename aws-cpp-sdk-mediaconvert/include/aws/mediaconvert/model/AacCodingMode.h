@@ -37,7 +37,8 @@ namespace AacCodingModeMapper
 {
 AWS_MEDIACONVERT_API AacCodingMode GetAacCodingModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAacCodingMode(AacCodingMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAacCodingMode(AacCodingMode value);
 } // namespace AacCodingModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace AacRateControlModeMapper
 {
 AWS_MEDIACONVERT_API AacRateControlMode GetAacRateControlModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAacRateControlMode(AacRateControlMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAacRateControlMode(AacRateControlMode value);
 } // namespace AacRateControlModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace AacRawFormatMapper
 {
 AWS_MEDIACONVERT_API AacRawFormat GetAacRawFormatForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAacRawFormat(AacRawFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAacRawFormat(AacRawFormat value);
 } // namespace AacRawFormatMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace AacSpecificationMapper
 {
 AWS_MEDIACONVERT_API AacSpecification GetAacSpecificationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAacSpecification(AacSpecification value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAacSpecification(AacSpecification value);
 } // namespace AacSpecificationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,7 +36,8 @@ namespace AacVbrQualityMapper
 {
 AWS_MEDIACONVERT_API AacVbrQuality GetAacVbrQualityForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAacVbrQuality(AacVbrQuality value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAacVbrQuality(AacVbrQuality value);
 } // namespace AacVbrQualityMapper
 } // namespace Model
 } // namespace MediaConvert
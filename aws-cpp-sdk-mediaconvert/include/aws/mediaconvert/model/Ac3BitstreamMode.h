@@ -40,7 +40,8 @@ namespace Ac3BitstreamModeMapper
 {
 AWS_MEDIACONVERT_API Ac3BitstreamMode GetAc3BitstreamModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAc3BitstreamMode(Ac3BitstreamMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAc3BitstreamMode(Ac3BitstreamMode value);
 } // namespace Ac3BitstreamModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,7 +36,8 @@ namespace Ac3CodingModeMapper
 {
 AWS_MEDIACONVERT_API Ac3CodingMode GetAc3CodingModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAc3CodingMode(Ac3CodingMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAc3CodingMode(Ac3CodingMode value);
 } // namespace Ac3CodingModeMapper
 } // namespace Model
 } // namespace MediaConvert
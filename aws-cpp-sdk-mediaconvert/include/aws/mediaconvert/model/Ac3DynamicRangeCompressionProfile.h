@@ -34,7 +34,8 @@ namespace Ac3DynamicRangeCompressionProfileMapper
 {
 AWS_MEDIACONVERT_API Ac3DynamicRangeCompressionProfile GetAc3DynamicRangeCompressionProfileForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAc3DynamicRangeCompressionProfile(Ac3DynamicRangeCompressionProfile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAc3DynamicRangeCompressionProfile(Ac3DynamicRangeCompressionProfile value);
 } // namespace Ac3DynamicRangeCompressionProfileMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Ac3LfeFilterMapper
 {
 AWS_MEDIACONVERT_API Ac3LfeFilter GetAc3LfeFilterForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAc3LfeFilter(Ac3LfeFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAc3LfeFilter(Ac3LfeFilter value);
 } // namespace Ac3LfeFilterMapper
 } // namespace Model
 } // namespace MediaConvert
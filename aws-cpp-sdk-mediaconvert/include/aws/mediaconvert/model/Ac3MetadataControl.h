@@ -34,7 +34,8 @@ namespace Ac3MetadataControlMapper
 {
 AWS_MEDIACONVERT_API Ac3MetadataControl GetAc3MetadataControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAc3MetadataControl(Ac3MetadataControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAc3MetadataControl(Ac3MetadataControl value);
 } // namespace Ac3MetadataControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace AfdSignalingMapper
 {
 AWS_MEDIACONVERT_API AfdSignaling GetAfdSignalingForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAfdSignaling(AfdSignaling value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAfdSignaling(AfdSignaling value);
 } // namespace AfdSignalingMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace AntiAliasMapper
 {
 AWS_MEDIACONVERT_API AntiAlias GetAntiAliasForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAntiAlias(AntiAlias value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAntiAlias(AntiAlias value);
 } // namespace AntiAliasMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -39,7 +39,8 @@ namespace AudioCodecMapper
 {
 AWS_MEDIACONVERT_API AudioCodec GetAudioCodecForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAudioCodec(AudioCodec value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAudioCodec(AudioCodec value);
 } // namespace AudioCodecMapper
 } // namespace Model
 } // namespace MediaConvert
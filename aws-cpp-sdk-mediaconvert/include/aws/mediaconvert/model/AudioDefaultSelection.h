@@ -34,7 +34,8 @@ namespace AudioDefaultSelectionMapper
 {
 AWS_MEDIACONVERT_API AudioDefaultSelection GetAudioDefaultSelectionForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAudioDefaultSelection(AudioDefaultSelection value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAudioDefaultSelection(AudioDefaultSelection value);
 } // namespace AudioDefaultSelectionMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace AudioLanguageCodeControlMapper
 {
 AWS_MEDIACONVERT_API AudioLanguageCodeControl GetAudioLanguageCodeControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAudioLanguageCodeControl(AudioLanguageCodeControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAudioLanguageCodeControl(AudioLanguageCodeControl value);
 } // namespace AudioLanguageCodeControlMapper
 } // namespace Model
 } // namespace MediaConvert
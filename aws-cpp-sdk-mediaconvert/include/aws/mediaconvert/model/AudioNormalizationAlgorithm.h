@@ -34,7 +34,8 @@ namespace AudioNormalizationAlgorithmMapper
 {
 AWS_MEDIACONVERT_API AudioNormalizationAlgorithm GetAudioNormalizationAlgorithmForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAudioNormalizationAlgorithm(AudioNormalizationAlgorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAudioNormalizationAlgorithm(AudioNormalizationAlgorithm value);
 } // namespace AudioNormalizationAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace AudioNormalizationAlgorithmControlMapper
 {
 AWS_MEDIACONVERT_API AudioNormalizationAlgorithmControl GetAudioNormalizationAlgorithmControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl value);
 } // namespace AudioNormalizationAlgorithmControlMapper
 } // namespace Model
 } // namespace MediaConvert
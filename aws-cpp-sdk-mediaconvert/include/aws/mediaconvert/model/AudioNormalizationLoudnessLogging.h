@@ -34,7 +34,8 @@ namespace AudioNormalizationLoudnessLoggingMapper
 {
 AWS_MEDIACONVERT_API AudioNormalizationLoudnessLogging GetAudioNormalizationLoudnessLoggingForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAudioNormalizationLoudnessLogging(AudioNormalizationLoudnessLogging value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAudioNormalizationLoudnessLogging(AudioNormalizationLoudnessLogging value);
 } // namespace AudioNormalizationLoudnessLoggingMapper
 } // namespace Model
 } // namespace MediaConvert
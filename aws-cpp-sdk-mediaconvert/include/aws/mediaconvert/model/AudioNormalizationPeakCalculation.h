@@ -34,7 +34,8 @@ namespace AudioNormalizationPeakCalculationMapper
 {
 AWS_MEDIACONVERT_API AudioNormalizationPeakCalculation GetAudioNormalizationPeakCalculationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAudioNormalizationPeakCalculation(AudioNormalizationPeakCalculation value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAudioNormalizationPeakCalculation(AudioNormalizationPeakCalculation value);
 } // namespace AudioNormalizationPeakCalculationMapper
 } // namespace Model
 } // namespace MediaConvert
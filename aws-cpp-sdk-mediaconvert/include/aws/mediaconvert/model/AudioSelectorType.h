@@ -35,7 +35,8 @@ namespace AudioSelectorTypeMapper
 {
 AWS_MEDIACONVERT_API AudioSelectorType GetAudioSelectorTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAudioSelectorType(AudioSelectorType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAudioSelectorType(AudioSelectorType value);
 } // namespace AudioSelectorTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace AudioTypeControlMapper
 {
 AWS_MEDIACONVERT_API AudioTypeControl GetAudioTypeControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForAudioTypeControl(AudioTypeControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForAudioTypeControl(AudioTypeControl value);
 } // namespace AudioTypeControlMapper
 } // namespace Model
 } // namespace MediaConvert
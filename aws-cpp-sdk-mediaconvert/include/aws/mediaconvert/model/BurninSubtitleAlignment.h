@@ -34,7 +34,8 @@ namespace BurninSubtitleAlignmentMapper
 {
 AWS_MEDIACONVERT_API BurninSubtitleAlignment GetBurninSubtitleAlignmentForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleAlignment(BurninSubtitleAlignment value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleAlignment(BurninSubtitleAlignment value);
 } // namespace BurninSubtitleAlignmentMapper
 } // namespace Model
 } // namespace MediaConvert
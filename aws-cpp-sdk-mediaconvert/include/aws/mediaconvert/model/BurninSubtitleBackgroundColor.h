@@ -35,7 +35,8 @@ namespace BurninSubtitleBackgroundColorMapper
 {
 AWS_MEDIACONVERT_API BurninSubtitleBackgroundColor GetBurninSubtitleBackgroundColorForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleBackgroundColor(BurninSubtitleBackgroundColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleBackgroundColor(BurninSubtitleBackgroundColor value);
 } // namespace BurninSubtitleBackgroundColorMapper
 } // namespace Model
 } // namespace MediaConvert
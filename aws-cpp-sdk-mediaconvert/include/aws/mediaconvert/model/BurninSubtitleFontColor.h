@@ -38,7 +38,8 @@ namespace BurninSubtitleFontColorMapper
 {
 AWS_MEDIACONVERT_API BurninSubtitleFontColor GetBurninSubtitleFontColorForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleFontColor(BurninSubtitleFontColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleFontColor(BurninSubtitleFontColor value);
 } // namespace BurninSubtitleFontColorMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -38,7 +38,8 @@ namespace BurninSubtitleOutlineColorMapper
 {
 AWS_MEDIACONVERT_API BurninSubtitleOutlineColor GetBurninSubtitleOutlineColorForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleOutlineColor(BurninSubtitleOutlineColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleOutlineColor(BurninSubtitleOutlineColor value);
 } // namespace BurninSubtitleOutlineColorMapper
 } // namespace Model
 } // namespace MediaConvert
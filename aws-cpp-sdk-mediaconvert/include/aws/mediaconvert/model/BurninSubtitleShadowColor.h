@@ -35,7 +35,8 @@ namespace BurninSubtitleShadowColorMapper
 {
 AWS_MEDIACONVERT_API BurninSubtitleShadowColor GetBurninSubtitleShadowColorForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleShadowColor(BurninSubtitleShadowColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleShadowColor(BurninSubtitleShadowColor value);
 } // namespace BurninSubtitleShadowColorMapper
 } // namespace Model
 } // namespace MediaConvert
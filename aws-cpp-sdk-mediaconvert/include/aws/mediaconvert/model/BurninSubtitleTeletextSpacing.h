@@ -34,7 +34,8 @@ namespace BurninSubtitleTeletextSpacingMapper
 {
 AWS_MEDIACONVERT_API BurninSubtitleTeletextSpacing GetBurninSubtitleTeletextSpacingForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForBurninSubtitleTeletextSpacing(BurninSubtitleTeletextSpacing value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForBurninSubtitleTeletextSpacing(BurninSubtitleTeletextSpacing value);
 } // namespace BurninSubtitleTeletextSpacingMapper
 } // namespace Model
 } // namespace MediaConvert
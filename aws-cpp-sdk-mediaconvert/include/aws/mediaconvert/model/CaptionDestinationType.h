@@ -40,7 +40,8 @@ namespace CaptionDestinationTypeMapper
 {
 AWS_MEDIACONVERT_API CaptionDestinationType GetCaptionDestinationTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCaptionDestinationType(CaptionDestinationType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCaptionDestinationType(CaptionDestinationType value);
 } // namespace CaptionDestinationTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -41,7 +41,8 @@ namespace CaptionSourceTypeMapper
 {
 AWS_MEDIACONVERT_API CaptionSourceType GetCaptionSourceTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCaptionSourceType(CaptionSourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCaptionSourceType(CaptionSourceType value);
 } // namespace CaptionSourceTypeMapper
 } // namespace Model
 } // namespace MediaConvert
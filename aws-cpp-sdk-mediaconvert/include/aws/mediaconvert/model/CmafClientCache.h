@@ -34,7 +34,8 @@ namespace CmafClientCacheMapper
 {
 AWS_MEDIACONVERT_API CmafClientCache GetCmafClientCacheForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafClientCache(CmafClientCache value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafClientCache(CmafClientCache value);
 } // namespace CmafClientCacheMapper
 } // namespace Model
 } // namespace MediaConvert
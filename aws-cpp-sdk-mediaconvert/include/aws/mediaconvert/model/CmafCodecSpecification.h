@@ -34,7 +34,8 @@ namespace CmafCodecSpecificationMapper
 {
 AWS_MEDIACONVERT_API CmafCodecSpecification GetCmafCodecSpecificationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafCodecSpecification(CmafCodecSpecification value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafCodecSpecification(CmafCodecSpecification value);
 } // namespace CmafCodecSpecificationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -33,7 +33,8 @@ namespace CmafEncryptionTypeMapper
 {
 AWS_MEDIACONVERT_API CmafEncryptionType GetCmafEncryptionTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafEncryptionType(CmafEncryptionType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafEncryptionType(CmafEncryptionType value);
 } // namespace CmafEncryptionTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace CmafInitializationVectorInManifestMapper
 {
 AWS_MEDIACONVERT_API CmafInitializationVectorInManifest GetCmafInitializationVectorInManifestForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafInitializationVectorInManifest(CmafInitializationVectorInManifest value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafInitializationVectorInManifest(CmafInitializationVectorInManifest value);
 } // namespace CmafInitializationVectorInManifestMapper
 } // namespace Model
 } // namespace MediaConvert
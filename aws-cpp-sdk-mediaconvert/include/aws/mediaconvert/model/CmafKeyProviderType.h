@@ -33,7 +33,8 @@ namespace CmafKeyProviderTypeMapper
 {
 AWS_MEDIACONVERT_API CmafKeyProviderType GetCmafKeyProviderTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafKeyProviderType(CmafKeyProviderType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafKeyProviderType(CmafKeyProviderType value);
 } // namespace CmafKeyProviderTypeMapper
 } // namespace Model
 } // namespace MediaConvert
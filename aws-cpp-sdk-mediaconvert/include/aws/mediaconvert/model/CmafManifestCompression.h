@@ -34,7 +34,8 @@ namespace CmafManifestCompressionMapper
 {
 AWS_MEDIACONVERT_API CmafManifestCompression GetCmafManifestCompressionForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafManifestCompression(CmafManifestCompression value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafManifestCompression(CmafManifestCompression value);
 } // namespace CmafManifestCompressionMapper
 } // namespace Model
 } // namespace MediaConvert
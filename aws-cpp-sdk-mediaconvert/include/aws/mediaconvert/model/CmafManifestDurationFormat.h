@@ -34,7 +34,8 @@ namespace CmafManifestDurationFormatMapper
 {
 AWS_MEDIACONVERT_API CmafManifestDurationFormat GetCmafManifestDurationFormatForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafManifestDurationFormat(CmafManifestDurationFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafManifestDurationFormat(CmafManifestDurationFormat value);
 } // namespace CmafManifestDurationFormatMapper
 } // namespace Model
 } // namespace MediaConvert
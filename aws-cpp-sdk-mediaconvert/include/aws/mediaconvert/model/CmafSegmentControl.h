@@ -34,7 +34,8 @@ namespace CmafSegmentControlMapper
 {
 AWS_MEDIACONVERT_API CmafSegmentControl GetCmafSegmentControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafSegmentControl(CmafSegmentControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafSegmentControl(CmafSegmentControl value);
 } // namespace CmafSegmentControlMapper
 } // namespace Model
 } // namespace MediaConvert
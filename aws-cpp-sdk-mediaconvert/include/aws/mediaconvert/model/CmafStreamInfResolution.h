@@ -34,7 +34,8 @@ namespace CmafStreamInfResolutionMapper
 {
 AWS_MEDIACONVERT_API CmafStreamInfResolution GetCmafStreamInfResolutionForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafStreamInfResolution(CmafStreamInfResolution value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafStreamInfResolution(CmafStreamInfResolution value);
 } // namespace CmafStreamInfResolutionMapper
 } // namespace Model
 } // namespace MediaConvert
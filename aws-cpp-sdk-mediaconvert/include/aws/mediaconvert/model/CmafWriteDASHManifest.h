@@ -34,7 +34,8 @@ namespace CmafWriteDASHManifestMapper
 {
 AWS_MEDIACONVERT_API CmafWriteDASHManifest GetCmafWriteDASHManifestForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafWriteDASHManifest(CmafWriteDASHManifest value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafWriteDASHManifest(CmafWriteDASHManifest value);
 } // namespace CmafWriteDASHManifestMapper
 } // namespace Model
 } // namespace MediaConvert
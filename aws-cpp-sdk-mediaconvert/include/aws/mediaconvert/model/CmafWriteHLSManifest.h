@@ -34,7 +34,8 @@ namespace CmafWriteHLSManifestMapper
 {
 AWS_MEDIACONVERT_API CmafWriteHLSManifest GetCmafWriteHLSManifestForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForCmafWriteHLSManifest(CmafWriteHLSManifest value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForCmafWriteHLSManifest(CmafWriteHLSManifest value);
 } // namespace CmafWriteHLSManifestMapper
 } // namespace Model
 } // namespace MediaConvert
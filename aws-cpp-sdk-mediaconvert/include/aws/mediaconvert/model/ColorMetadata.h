@@ -34,7 +34,8 @@ namespace ColorMetadataMapper
 {
 AWS_MEDIACONVERT_API ColorMetadata GetColorMetadataForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForColorMetadata(ColorMetadata value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForColorMetadata(ColorMetadata value);
 } // namespace ColorMetadataMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -37,7 +37,8 @@ namespace ColorSpaceMapper
 {
 AWS_MEDIACONVERT_API ColorSpace GetColorSpaceForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForColorSpace(ColorSpace value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForColorSpace(ColorSpace value);
 } // namespace ColorSpaceMapper
 } // namespace Model
 } // namespace MediaConvert
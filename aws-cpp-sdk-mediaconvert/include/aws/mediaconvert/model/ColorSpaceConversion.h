@@ -37,7 +37,8 @@ namespace ColorSpaceConversionMapper
 {
 AWS_MEDIACONVERT_API ColorSpaceConversion GetColorSpaceConversionForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForColorSpaceConversion(ColorSpaceConversion value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForColorSpaceConversion(ColorSpaceConversion value);
 } // namespace ColorSpaceConversionMapper
 } // namespace Model
 } // namespace MediaConvert
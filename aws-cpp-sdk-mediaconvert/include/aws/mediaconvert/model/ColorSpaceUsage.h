@@ -34,7 +34,8 @@ namespace ColorSpaceUsageMapper
 {
 AWS_MEDIACONVERT_API ColorSpaceUsage GetColorSpaceUsageForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForColorSpaceUsage(ColorSpaceUsage value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForColorSpaceUsage(ColorSpaceUsage value);
 } // namespace ColorSpaceUsageMapper
 } // namespace Model
 } // namespace MediaConvert
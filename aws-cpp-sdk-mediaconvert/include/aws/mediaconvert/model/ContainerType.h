@@ -42,7 +42,8 @@ namespace ContainerTypeMapper
 {
 AWS_MEDIACONVERT_API ContainerType GetContainerTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForContainerType(ContainerType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForContainerType(ContainerType value);
 } // namespace ContainerTypeMapper
 } // namespace Model
 } // namespace MediaConvert
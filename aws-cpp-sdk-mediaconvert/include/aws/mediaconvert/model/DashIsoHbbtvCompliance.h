@@ -34,7 +34,8 @@ namespace DashIsoHbbtvComplianceMapper
 {
 AWS_MEDIACONVERT_API DashIsoHbbtvCompliance GetDashIsoHbbtvComplianceForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDashIsoHbbtvCompliance(DashIsoHbbtvCompliance value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDashIsoHbbtvCompliance(DashIsoHbbtvCompliance value);
 } // namespace DashIsoHbbtvComplianceMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace DashIsoSegmentControlMapper
 {
 AWS_MEDIACONVERT_API DashIsoSegmentControl GetDashIsoSegmentControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDashIsoSegmentControl(DashIsoSegmentControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDashIsoSegmentControl(DashIsoSegmentControl value);
 } // namespace DashIsoSegmentControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,7 +36,8 @@ namespace DeinterlaceAlgorithmMapper
 {
 AWS_MEDIACONVERT_API DeinterlaceAlgorithm GetDeinterlaceAlgorithmForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDeinterlaceAlgorithm(DeinterlaceAlgorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDeinterlaceAlgorithm(DeinterlaceAlgorithm value);
 } // namespace DeinterlaceAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace DeinterlacerControlMapper
 {
 AWS_MEDIACONVERT_API DeinterlacerControl GetDeinterlacerControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDeinterlacerControl(DeinterlacerControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDeinterlacerControl(DeinterlacerControl value);
 } // namespace DeinterlacerControlMapper
 } // namespace Model
 } // namespace MediaConvert
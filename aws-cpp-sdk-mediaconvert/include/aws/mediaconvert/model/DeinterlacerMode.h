@@ -35,7 +35,8 @@ namespace DeinterlacerModeMapper
 {
 AWS_MEDIACONVERT_API DeinterlacerMode GetDeinterlacerModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDeinterlacerMode(DeinterlacerMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDeinterlacerMode(DeinterlacerMode value);
 } // namespace DeinterlacerModeMapper
 } // namespace Model
 } // namespace MediaConvert
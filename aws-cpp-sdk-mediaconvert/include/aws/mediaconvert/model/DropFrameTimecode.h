@@ -34,7 +34,8 @@ namespace DropFrameTimecodeMapper
 {
 AWS_MEDIACONVERT_API DropFrameTimecode GetDropFrameTimecodeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDropFrameTimecode(DropFrameTimecode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDropFrameTimecode(DropFrameTimecode value);
 } // namespace DropFrameTimecodeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace DvbSubtitleAlignmentMapper
 {
 AWS_MEDIACONVERT_API DvbSubtitleAlignment GetDvbSubtitleAlignmentForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleAlignment(DvbSubtitleAlignment value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleAlignment(DvbSubtitleAlignment value);
 } // namespace DvbSubtitleAlignmentMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace DvbSubtitleBackgroundColorMapper
 {
 AWS_MEDIACONVERT_API DvbSubtitleBackgroundColor GetDvbSubtitleBackgroundColorForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleBackgroundColor(DvbSubtitleBackgroundColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleBackgroundColor(DvbSubtitleBackgroundColor value);
 } // namespace DvbSubtitleBackgroundColorMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -38,7 +38,8 @@ namespace DvbSubtitleFontColorMapper
 {
 AWS_MEDIACONVERT_API DvbSubtitleFontColor GetDvbSubtitleFontColorForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleFontColor(DvbSubtitleFontColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleFontColor(DvbSubtitleFontColor value);
 } // namespace DvbSubtitleFontColorMapper
 } // namespace Model
 } // namespace MediaConvert
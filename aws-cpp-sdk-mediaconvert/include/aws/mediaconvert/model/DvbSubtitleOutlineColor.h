@@ -38,7 +38,8 @@ namespace DvbSubtitleOutlineColorMapper
 {
 AWS_MEDIACONVERT_API DvbSubtitleOutlineColor GetDvbSubtitleOutlineColorForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleOutlineColor(DvbSubtitleOutlineColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleOutlineColor(DvbSubtitleOutlineColor value);
 } // namespace DvbSubtitleOutlineColorMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace DvbSubtitleShadowColorMapper
 {
 AWS_MEDIACONVERT_API DvbSubtitleShadowColor GetDvbSubtitleShadowColorForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleShadowColor(DvbSubtitleShadowColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleShadowColor(DvbSubtitleShadowColor value);
 } // namespace DvbSubtitleShadowColorMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace DvbSubtitleTeletextSpacingMapper
 {
 AWS_MEDIACONVERT_API DvbSubtitleTeletextSpacing GetDvbSubtitleTeletextSpacingForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForDvbSubtitleTeletextSpacing(DvbSubtitleTeletextSpacing value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForDvbSubtitleTeletextSpacing(DvbSubtitleTeletextSpacing value);
 } // namespace DvbSubtitleTeletextSpacingMapper
 } // namespace Model
 } // namespace MediaConvert
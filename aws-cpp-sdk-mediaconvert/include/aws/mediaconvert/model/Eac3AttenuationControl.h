@@ -34,7 +34,8 @@ namespace Eac3AttenuationControlMapper
 {
 AWS_MEDIACONVERT_API Eac3AttenuationControl GetEac3AttenuationControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForEac3AttenuationControl(Eac3AttenuationControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForEac3AttenuationControl(Eac3AttenuationControl value);
 } // namespace Eac3AttenuationControlMapper
 } // namespace Model
 } // namespace MediaConvert
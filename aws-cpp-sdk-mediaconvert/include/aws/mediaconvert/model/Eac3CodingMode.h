@@ -35,7 +35,8 @@ namespace Eac3CodingModeMapper
 {
 AWS_MEDIACONVERT_API Eac3CodingMode GetEac3CodingModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForEac3CodingMode(Eac3CodingMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForEac3CodingMode(Eac3CodingMode value);
 } // namespace Eac3CodingModeMapper
 } // namespace Model
 } // namespace MediaConvert
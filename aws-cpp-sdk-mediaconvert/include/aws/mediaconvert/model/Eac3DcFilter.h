@@ -34,7 +34,8 @@ namespace Eac3DcFilterMapper
 {
 AWS_MEDIACONVERT_API Eac3DcFilter GetEac3DcFilterForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForEac3DcFilter(Eac3DcFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForEac3DcFilter(Eac3DcFilter value);
 } // namespace Eac3DcFilterMapper
 } // namespace Model
 } // namespace MediaConvert
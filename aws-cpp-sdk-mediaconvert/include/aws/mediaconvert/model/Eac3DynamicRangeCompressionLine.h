@@ -38,7 +38,8 @@ namespace Eac3DynamicRangeCompressionLineMapper
 {
 AWS_MEDIACONVERT_API Eac3DynamicRangeCompressionLine GetEac3DynamicRangeCompressionLineForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForEac3DynamicRangeCompressionLine(Eac3DynamicRangeCompressionLine value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForEac3DynamicRangeCompressionLine(Eac3DynamicRangeCompressionLine value);
 } // namespace Eac3DynamicRangeCompressionLineMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -38,7 +38,8 @@ namespace Eac3DynamicRangeCompressionRfMapper
 {
 AWS_MEDIACONVERT_API Eac3DynamicRangeCompressionRf GetEac3DynamicRangeCompressionRfForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForEac3DynamicRangeCompressionRf(Eac3DynamicRangeCompressionRf value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForEac3DynamicRangeCompressionRf(Eac3DynamicRangeCompressionRf value);
 } // namespace Eac3DynamicRangeCompressionRfMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,7 +36,8 @@ namespace Eac3StereoDownmixMapper
 {
 AWS_MEDIACONVERT_API Eac3StereoDownmix GetEac3StereoDownmixForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForEac3StereoDownmix(Eac3StereoDownmix value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForEac3StereoDownmix(Eac3StereoDownmix value);
 } // namespace Eac3StereoDownmixMapper
 } // namespace Model
 } // namespace MediaConvert
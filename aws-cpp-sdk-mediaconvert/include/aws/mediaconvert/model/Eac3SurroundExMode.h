@@ -35,7 +35,8 @@ namespace Eac3SurroundExModeMapper
 {
 AWS_MEDIACONVERT_API Eac3SurroundExMode GetEac3SurroundExModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForEac3SurroundExMode(Eac3SurroundExMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForEac3SurroundExMode(Eac3SurroundExMode value);
 } // namespace Eac3SurroundExModeMapper
 } // namespace Model
 } // namespace MediaConvert
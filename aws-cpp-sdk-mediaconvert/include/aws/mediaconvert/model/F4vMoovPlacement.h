@@ -34,7 +34,8 @@ namespace F4vMoovPlacementMapper
 {
 AWS_MEDIACONVERT_API F4vMoovPlacement GetF4vMoovPlacementForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForF4vMoovPlacement(F4vMoovPlacement value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForF4vMoovPlacement(F4vMoovPlacement value);
 } // namespace F4vMoovPlacementMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace FileSourceConvert608To708Mapper
 {
 AWS_MEDIACONVERT_API FileSourceConvert608To708 GetFileSourceConvert608To708ForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForFileSourceConvert608To708(FileSourceConvert608To708 value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForFileSourceConvert608To708(FileSourceConvert608To708 value);
 } // namespace FileSourceConvert608To708Mapper
 } // namespace Model
 } // namespace MediaConvert
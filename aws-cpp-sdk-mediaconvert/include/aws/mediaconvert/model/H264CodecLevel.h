@@ -49,7 +49,8 @@ namespace H264CodecLevelMapper
 {
 AWS_MEDIACONVERT_API H264CodecLevel GetH264CodecLevelForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264CodecLevel(H264CodecLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264CodecLevel(H264CodecLevel value);
 } // namespace H264CodecLevelMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -38,7 +38,8 @@ namespace H264CodecProfileMapper
 {
 AWS_MEDIACONVERT_API H264CodecProfile GetH264CodecProfileForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264CodecProfile(H264CodecProfile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264CodecProfile(H264CodecProfile value);
 } // namespace H264CodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
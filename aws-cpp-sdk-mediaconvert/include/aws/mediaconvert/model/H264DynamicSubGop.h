@@ -34,7 +34,8 @@ namespace H264DynamicSubGopMapper
 {
 AWS_MEDIACONVERT_API H264DynamicSubGop GetH264DynamicSubGopForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264DynamicSubGop(H264DynamicSubGop value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264DynamicSubGop(H264DynamicSubGop value);
 } // namespace H264DynamicSubGopMapper
 } // namespace Model
 } // namespace MediaConvert
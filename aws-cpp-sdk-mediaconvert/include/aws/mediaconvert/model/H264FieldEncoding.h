@@ -34,7 +34,8 @@ namespace H264FieldEncodingMapper
 {
 AWS_MEDIACONVERT_API H264FieldEncoding GetH264FieldEncodingForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264FieldEncoding(H264FieldEncoding value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264FieldEncoding(H264FieldEncoding value);
 } // namespace H264FieldEncodingMapper
 } // namespace Model
 } // namespace MediaConvert
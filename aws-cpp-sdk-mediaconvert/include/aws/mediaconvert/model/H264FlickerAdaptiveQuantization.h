@@ -34,7 +34,8 @@ namespace H264FlickerAdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API H264FlickerAdaptiveQuantization GetH264FlickerAdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264FlickerAdaptiveQuantization(H264FlickerAdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264FlickerAdaptiveQuantization(H264FlickerAdaptiveQuantization value);
 } // namespace H264FlickerAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H264FramerateConversionAlgorithmMapper
 {
 AWS_MEDIACONVERT_API H264FramerateConversionAlgorithm GetH264FramerateConversionAlgorithmForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264FramerateConversionAlgorithm(H264FramerateConversionAlgorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264FramerateConversionAlgorithm(H264FramerateConversionAlgorithm value);
 } // namespace H264FramerateConversionAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -37,7 +37,8 @@ namespace H264InterlaceModeMapper
 {
 AWS_MEDIACONVERT_API H264InterlaceMode GetH264InterlaceModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264InterlaceMode(H264InterlaceMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264InterlaceMode(H264InterlaceMode value);
 } // namespace H264InterlaceModeMapper
 } // namespace Model
 } // namespace MediaConvert
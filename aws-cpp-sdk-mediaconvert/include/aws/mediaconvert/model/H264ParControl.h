@@ -34,7 +34,8 @@ namespace H264ParControlMapper
 {
 AWS_MEDIACONVERT_API H264ParControl GetH264ParControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264ParControl(H264ParControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264ParControl(H264ParControl value);
 } // namespace H264ParControlMapper
 } // namespace Model
 } // namespace MediaConvert
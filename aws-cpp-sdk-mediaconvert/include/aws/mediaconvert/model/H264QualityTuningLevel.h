@@ -35,7 +35,8 @@ namespace H264QualityTuningLevelMapper
 {
 AWS_MEDIACONVERT_API H264QualityTuningLevel GetH264QualityTuningLevelForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264QualityTuningLevel(H264QualityTuningLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264QualityTuningLevel(H264QualityTuningLevel value);
 } // namespace H264QualityTuningLevelMapper
 } // namespace Model
 } // namespace MediaConvert
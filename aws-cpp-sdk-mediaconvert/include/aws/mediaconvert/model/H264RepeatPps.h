@@ -34,7 +34,8 @@ namespace H264RepeatPpsMapper
 {
 AWS_MEDIACONVERT_API H264RepeatPps GetH264RepeatPpsForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264RepeatPps(H264RepeatPps value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264RepeatPps(H264RepeatPps value);
 } // namespace H264RepeatPpsMapper
 } // namespace Model
 } // namespace MediaConvert
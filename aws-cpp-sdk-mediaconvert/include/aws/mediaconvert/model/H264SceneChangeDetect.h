@@ -34,7 +34,8 @@ namespace H264SceneChangeDetectMapper
 {
 AWS_MEDIACONVERT_API H264SceneChangeDetect GetH264SceneChangeDetectForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264SceneChangeDetect(H264SceneChangeDetect value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264SceneChangeDetect(H264SceneChangeDetect value);
 } // namespace H264SceneChangeDetectMapper
 } // namespace Model
 } // namespace MediaConvert
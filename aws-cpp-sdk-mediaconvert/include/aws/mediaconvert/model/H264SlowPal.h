@@ -34,7 +34,8 @@ namespace H264SlowPalMapper
 {
 AWS_MEDIACONVERT_API H264SlowPal GetH264SlowPalForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264SlowPal(H264SlowPal value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264SlowPal(H264SlowPal value);
 } // namespace H264SlowPalMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H264SpatialAdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API H264SpatialAdaptiveQuantization GetH264SpatialAdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264SpatialAdaptiveQuantization(H264SpatialAdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264SpatialAdaptiveQuantization(H264SpatialAdaptiveQuantization value);
 } // namespace H264SpatialAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace H264TelecineMapper
 {
 AWS_MEDIACONVERT_API H264Telecine GetH264TelecineForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264Telecine(H264Telecine value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264Telecine(H264Telecine value);
 } // namespace H264TelecineMapper
 } // namespace Model
 } // namespace MediaConvert
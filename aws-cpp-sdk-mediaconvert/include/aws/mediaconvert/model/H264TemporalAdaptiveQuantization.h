@@ -34,7 +34,8 @@ namespace H264TemporalAdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API H264TemporalAdaptiveQuantization GetH264TemporalAdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264TemporalAdaptiveQuantization(H264TemporalAdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264TemporalAdaptiveQuantization(H264TemporalAdaptiveQuantization value);
 } // namespace H264TemporalAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
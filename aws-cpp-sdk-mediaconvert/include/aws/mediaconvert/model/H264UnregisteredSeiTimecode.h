@@ -34,7 +34,8 @@ namespace H264UnregisteredSeiTimecodeMapper
 {
 AWS_MEDIACONVERT_API H264UnregisteredSeiTimecode GetH264UnregisteredSeiTimecodeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH264UnregisteredSeiTimecode(H264UnregisteredSeiTimecode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH264UnregisteredSeiTimecode(H264UnregisteredSeiTimecode value);
 } // namespace H264UnregisteredSeiTimecodeMapper
 } // namespace Model
 } // namespace MediaConvert
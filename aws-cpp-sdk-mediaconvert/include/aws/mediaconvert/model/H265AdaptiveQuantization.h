@@ -38,7 +38,8 @@ namespace H265AdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API H265AdaptiveQuantization GetH265AdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265AdaptiveQuantization(H265AdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265AdaptiveQuantization(H265AdaptiveQuantization value);
 } // namespace H265AdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H265AlternateTransferFunctionSeiMapper
 {
 AWS_MEDIACONVERT_API H265AlternateTransferFunctionSei GetH265AlternateTransferFunctionSeiForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265AlternateTransferFunctionSei(H265AlternateTransferFunctionSei value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265AlternateTransferFunctionSei(H265AlternateTransferFunctionSei value);
 } // namespace H265AlternateTransferFunctionSeiMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -46,7 +46,8 @@ namespace H265CodecLevelMapper
 {
 AWS_MEDIACONVERT_API H265CodecLevel GetH265CodecLevelForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265CodecLevel(H265CodecLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265CodecLevel(H265CodecLevel value);
 } // namespace H265CodecLevelMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -40,7 +40,8 @@ namespace H265CodecProfileMapper
 {
 AWS_MEDIACONVERT_API H265CodecProfile GetH265CodecProfileForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265CodecProfile(H265CodecProfile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265CodecProfile(H265CodecProfile value);
 } // namespace H265CodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
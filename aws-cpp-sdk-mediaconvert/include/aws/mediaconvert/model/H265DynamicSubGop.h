@@ -34,7 +34,8 @@ namespace H265DynamicSubGopMapper
 {
 AWS_MEDIACONVERT_API H265DynamicSubGop GetH265DynamicSubGopForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265DynamicSubGop(H265DynamicSubGop value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265DynamicSubGop(H265DynamicSubGop value);
 } // namespace H265DynamicSubGopMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H265FlickerAdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API H265FlickerAdaptiveQuantization GetH265FlickerAdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265FlickerAdaptiveQuantization(H265FlickerAdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265FlickerAdaptiveQuantization(H265FlickerAdaptiveQuantization value);
 } // namespace H265FlickerAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
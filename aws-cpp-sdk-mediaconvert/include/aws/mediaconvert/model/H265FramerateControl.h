@@ -34,7 +34,8 @@ namespace H265FramerateControlMapper
 {
 AWS_MEDIACONVERT_API H265FramerateControl GetH265FramerateControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265FramerateControl(H265FramerateControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265FramerateControl(H265FramerateControl value);
 } // namespace H265FramerateControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H265FramerateConversionAlgorithmMapper
 {
 AWS_MEDIACONVERT_API H265FramerateConversionAlgorithm GetH265FramerateConversionAlgorithmForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265FramerateConversionAlgorithm(H265FramerateConversionAlgorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265FramerateConversionAlgorithm(H265FramerateConversionAlgorithm value);
 } // namespace H265FramerateConversionAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
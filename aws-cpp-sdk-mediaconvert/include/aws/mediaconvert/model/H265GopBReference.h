@@ -34,7 +34,8 @@ namespace H265GopBReferenceMapper
 {
 AWS_MEDIACONVERT_API H265GopBReference GetH265GopBReferenceForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265GopBReference(H265GopBReference value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265GopBReference(H265GopBReference value);
 } // namespace H265GopBReferenceMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H265GopSizeUnitsMapper
 {
 AWS_MEDIACONVERT_API H265GopSizeUnits GetH265GopSizeUnitsForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265GopSizeUnits(H265GopSizeUnits value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265GopSizeUnits(H265GopSizeUnits value);
 } // namespace H265GopSizeUnitsMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -37,7 +37,8 @@ namespace H265InterlaceModeMapper
 {
 AWS_MEDIACONVERT_API H265InterlaceMode GetH265InterlaceModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265InterlaceMode(H265InterlaceMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265InterlaceMode(H265InterlaceMode value);
 } // namespace H265InterlaceModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H265ParControlMapper
 {
 AWS_MEDIACONVERT_API H265ParControl GetH265ParControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265ParControl(H265ParControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265ParControl(H265ParControl value);
 } // namespace H265ParControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace H265QualityTuningLevelMapper
 {
 AWS_MEDIACONVERT_API H265QualityTuningLevel GetH265QualityTuningLevelForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265QualityTuningLevel(H265QualityTuningLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265QualityTuningLevel(H265QualityTuningLevel value);
 } // namespace H265QualityTuningLevelMapper
 } // namespace Model
 } // namespace MediaConvert
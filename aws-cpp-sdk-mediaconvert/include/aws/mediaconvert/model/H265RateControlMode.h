@@ -35,7 +35,8 @@ namespace H265RateControlModeMapper
 {
 AWS_MEDIACONVERT_API H265RateControlMode GetH265RateControlModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265RateControlMode(H265RateControlMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265RateControlMode(H265RateControlMode value);
 } // namespace H265RateControlModeMapper
 } // namespace Model
 } // namespace MediaConvert
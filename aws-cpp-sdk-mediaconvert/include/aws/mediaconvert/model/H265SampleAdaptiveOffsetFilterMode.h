@@ -35,7 +35,8 @@ namespace H265SampleAdaptiveOffsetFilterModeMapper
 {
 AWS_MEDIACONVERT_API H265SampleAdaptiveOffsetFilterMode GetH265SampleAdaptiveOffsetFilterModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265SampleAdaptiveOffsetFilterMode(H265SampleAdaptiveOffsetFilterMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265SampleAdaptiveOffsetFilterMode(H265SampleAdaptiveOffsetFilterMode value);
 } // namespace H265SampleAdaptiveOffsetFilterModeMapper
 } // namespace Model
 } // namespace MediaConvert
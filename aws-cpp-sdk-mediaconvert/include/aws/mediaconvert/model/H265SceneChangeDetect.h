@@ -34,7 +34,8 @@ namespace H265SceneChangeDetectMapper
 {
 AWS_MEDIACONVERT_API H265SceneChangeDetect GetH265SceneChangeDetectForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265SceneChangeDetect(H265SceneChangeDetect value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265SceneChangeDetect(H265SceneChangeDetect value);
 } // namespace H265SceneChangeDetectMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H265SlowPalMapper
 {
 AWS_MEDIACONVERT_API H265SlowPal GetH265SlowPalForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265SlowPal(H265SlowPal value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265SlowPal(H265SlowPal value);
 } // namespace H265SlowPalMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H265SpatialAdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API H265SpatialAdaptiveQuantization GetH265SpatialAdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265SpatialAdaptiveQuantization(H265SpatialAdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265SpatialAdaptiveQuantization(H265SpatialAdaptiveQuantization value);
 } // namespace H265SpatialAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace H265TelecineMapper
 {
 AWS_MEDIACONVERT_API H265Telecine GetH265TelecineForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265Telecine(H265Telecine value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265Telecine(H265Telecine value);
 } // namespace H265TelecineMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H265TemporalAdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API H265TemporalAdaptiveQuantization GetH265TemporalAdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265TemporalAdaptiveQuantization(H265TemporalAdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265TemporalAdaptiveQuantization(H265TemporalAdaptiveQuantization value);
 } // namespace H265TemporalAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
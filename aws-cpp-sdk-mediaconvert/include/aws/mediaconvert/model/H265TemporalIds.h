@@ -34,7 +34,8 @@ namespace H265TemporalIdsMapper
 {
 AWS_MEDIACONVERT_API H265TemporalIds GetH265TemporalIdsForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265TemporalIds(H265TemporalIds value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265TemporalIds(H265TemporalIds value);
 } // namespace H265TemporalIdsMapper
 } // namespace Model
 } // namespace MediaConvert
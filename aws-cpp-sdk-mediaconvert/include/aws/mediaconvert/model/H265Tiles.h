@@ -34,7 +34,8 @@ namespace H265TilesMapper
 {
 AWS_MEDIACONVERT_API H265Tiles GetH265TilesForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265Tiles(H265Tiles value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265Tiles(H265Tiles value);
 } // namespace H265TilesMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace H265UnregisteredSeiTimecodeMapper
 {
 AWS_MEDIACONVERT_API H265UnregisteredSeiTimecode GetH265UnregisteredSeiTimecodeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265UnregisteredSeiTimecode(H265UnregisteredSeiTimecode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265UnregisteredSeiTimecode(H265UnregisteredSeiTimecode value);
 } // namespace H265UnregisteredSeiTimecodeMapper
 } // namespace Model
 } // namespace MediaConvert
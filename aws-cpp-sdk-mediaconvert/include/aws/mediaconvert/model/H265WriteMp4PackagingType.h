@@ -34,7 +34,8 @@ namespace H265WriteMp4PackagingTypeMapper
 {
 AWS_MEDIACONVERT_API H265WriteMp4PackagingType GetH265WriteMp4PackagingTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForH265WriteMp4PackagingType(H265WriteMp4PackagingType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForH265WriteMp4PackagingType(H265WriteMp4PackagingType value);
 } // namespace H265WriteMp4PackagingTypeMapper
 } // namespace Model
 } // namespace MediaConvert
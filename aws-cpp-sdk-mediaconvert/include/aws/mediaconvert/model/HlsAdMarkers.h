@@ -34,7 +34,8 @@ namespace HlsAdMarkersMapper
 {
 AWS_MEDIACONVERT_API HlsAdMarkers GetHlsAdMarkersForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsAdMarkers(HlsAdMarkers value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsAdMarkers(HlsAdMarkers value);
 } // namespace HlsAdMarkersMapper
 } // namespace Model
 } // namespace MediaConvert
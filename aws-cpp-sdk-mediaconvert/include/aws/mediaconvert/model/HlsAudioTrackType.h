@@ -36,7 +36,8 @@ namespace HlsAudioTrackTypeMapper
 {
 AWS_MEDIACONVERT_API HlsAudioTrackType GetHlsAudioTrackTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsAudioTrackType(HlsAudioTrackType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsAudioTrackType(HlsAudioTrackType value);
 } // namespace HlsAudioTrackTypeMapper
 } // namespace Model
 } // namespace MediaConvert
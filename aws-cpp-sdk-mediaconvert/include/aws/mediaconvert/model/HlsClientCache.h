@@ -34,7 +34,8 @@ namespace HlsClientCacheMapper
 {
 AWS_MEDIACONVERT_API HlsClientCache GetHlsClientCacheForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsClientCache(HlsClientCache value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsClientCache(HlsClientCache value);
 } // namespace HlsClientCacheMapper
 } // namespace Model
 } // namespace MediaConvert
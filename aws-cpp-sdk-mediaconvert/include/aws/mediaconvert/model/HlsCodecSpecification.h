@@ -34,7 +34,8 @@ namespace HlsCodecSpecificationMapper
 {
 AWS_MEDIACONVERT_API HlsCodecSpecification GetHlsCodecSpecificationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsCodecSpecification(HlsCodecSpecification value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsCodecSpecification(HlsCodecSpecification value);
 } // namespace HlsCodecSpecificationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace HlsEncryptionTypeMapper
 {
 AWS_MEDIACONVERT_API HlsEncryptionType GetHlsEncryptionTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsEncryptionType(HlsEncryptionType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsEncryptionType(HlsEncryptionType value);
 } // namespace HlsEncryptionTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace HlsIFrameOnlyManifestMapper
 {
 AWS_MEDIACONVERT_API HlsIFrameOnlyManifest GetHlsIFrameOnlyManifestForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsIFrameOnlyManifest(HlsIFrameOnlyManifest value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsIFrameOnlyManifest(HlsIFrameOnlyManifest value);
 } // namespace HlsIFrameOnlyManifestMapper
 } // namespace Model
 } // namespace MediaConvert
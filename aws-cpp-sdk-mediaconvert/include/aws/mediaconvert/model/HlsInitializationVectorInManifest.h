@@ -34,7 +34,8 @@ namespace HlsInitializationVectorInManifestMapper
 {
 AWS_MEDIACONVERT_API HlsInitializationVectorInManifest GetHlsInitializationVectorInManifestForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsInitializationVectorInManifest(HlsInitializationVectorInManifest value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsInitializationVectorInManifest(HlsInitializationVectorInManifest value);
 } // namespace HlsInitializationVectorInManifestMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace HlsKeyProviderTypeMapper
 {
 AWS_MEDIACONVERT_API HlsKeyProviderType GetHlsKeyProviderTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsKeyProviderType(HlsKeyProviderType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsKeyProviderType(HlsKeyProviderType value);
 } // namespace HlsKeyProviderTypeMapper
 } // namespace Model
 } // namespace MediaConvert
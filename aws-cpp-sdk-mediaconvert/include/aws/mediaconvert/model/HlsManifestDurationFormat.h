@@ -34,7 +34,8 @@ namespace HlsManifestDurationFormatMapper
 {
 AWS_MEDIACONVERT_API HlsManifestDurationFormat GetHlsManifestDurationFormatForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsManifestDurationFormat(HlsManifestDurationFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsManifestDurationFormat(HlsManifestDurationFormat value);
 } // namespace HlsManifestDurationFormatMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace HlsOutputSelectionMapper
 {
 AWS_MEDIACONVERT_API HlsOutputSelection GetHlsOutputSelectionForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsOutputSelection(HlsOutputSelection value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsOutputSelection(HlsOutputSelection value);
 } // namespace HlsOutputSelectionMapper
 } // namespace Model
 } // namespace MediaConvert
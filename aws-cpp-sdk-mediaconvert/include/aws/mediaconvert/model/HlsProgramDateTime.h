@@ -34,7 +34,8 @@ namespace HlsProgramDateTimeMapper
 {
 AWS_MEDIACONVERT_API HlsProgramDateTime GetHlsProgramDateTimeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsProgramDateTime(HlsProgramDateTime value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsProgramDateTime(HlsProgramDateTime value);
 } // namespace HlsProgramDateTimeMapper
 } // namespace Model
 } // namespace MediaConvert
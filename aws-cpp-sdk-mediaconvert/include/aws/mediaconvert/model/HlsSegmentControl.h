@@ -34,7 +34,8 @@ namespace HlsSegmentControlMapper
 {
 AWS_MEDIACONVERT_API HlsSegmentControl GetHlsSegmentControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsSegmentControl(HlsSegmentControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsSegmentControl(HlsSegmentControl value);
 } // namespace HlsSegmentControlMapper
 } // namespace Model
 } // namespace MediaConvert
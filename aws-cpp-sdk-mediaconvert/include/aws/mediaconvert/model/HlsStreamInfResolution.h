@@ -34,7 +34,8 @@ namespace HlsStreamInfResolutionMapper
 {
 AWS_MEDIACONVERT_API HlsStreamInfResolution GetHlsStreamInfResolutionForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForHlsStreamInfResolution(HlsStreamInfResolution value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForHlsStreamInfResolution(HlsStreamInfResolution value);
 } // namespace HlsStreamInfResolutionMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace InputDeblockFilterMapper
 {
 AWS_MEDIACONVERT_API InputDeblockFilter GetInputDeblockFilterForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForInputDeblockFilter(InputDeblockFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForInputDeblockFilter(InputDeblockFilter value);
 } // namespace InputDeblockFilterMapper
 } // namespace Model
 } // namespace MediaConvert
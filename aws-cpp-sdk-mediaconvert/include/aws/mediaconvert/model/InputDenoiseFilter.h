@@ -34,7 +34,8 @@ namespace InputDenoiseFilterMapper
 {
 AWS_MEDIACONVERT_API InputDenoiseFilter GetInputDenoiseFilterForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForInputDenoiseFilter(InputDenoiseFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForInputDenoiseFilter(InputDenoiseFilter value);
 } // namespace InputDenoiseFilterMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace InputFilterEnableMapper
 {
 AWS_MEDIACONVERT_API InputFilterEnable GetInputFilterEnableForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForInputFilterEnable(InputFilterEnable value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForInputFilterEnable(InputFilterEnable value);
 } // namespace InputFilterEnableMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace InputPsiControlMapper
 {
 AWS_MEDIACONVERT_API InputPsiControl GetInputPsiControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForInputPsiControl(InputPsiControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForInputPsiControl(InputPsiControl value);
 } // namespace InputPsiControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace InputTimecodeSourceMapper
 {
 AWS_MEDIACONVERT_API InputTimecodeSource GetInputTimecodeSourceForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForInputTimecodeSource(InputTimecodeSource value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForInputTimecodeSource(InputTimecodeSource value);
 } // namespace InputTimecodeSourceMapper
 } // namespace Model
 } // namespace MediaConvert
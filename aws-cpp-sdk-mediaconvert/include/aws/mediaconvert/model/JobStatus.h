@@ -37,7 +37,8 @@ namespace JobStatusMapper
 {
 AWS_MEDIACONVERT_API JobStatus GetJobStatusForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForJobStatus(JobStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForJobStatus(JobStatus value);
 } // namespace JobStatusMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace JobTemplateListByMapper
 {
 AWS_MEDIACONVERT_API JobTemplateListBy GetJobTemplateListByForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForJobTemplateListBy(JobTemplateListBy value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForJobTemplateListBy(JobTemplateListBy value);
 } // namespace JobTemplateListByMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -223,7 +223,8 @@ namespace LanguageCodeMapper
 {
 AWS_MEDIACONVERT_API LanguageCode GetLanguageCodeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForLanguageCode(LanguageCode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForLanguageCode(LanguageCode value);
 } // namespace LanguageCodeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace M2tsAudioBufferModelMapper
 {
 AWS_MEDIACONVERT_API M2tsAudioBufferModel GetM2tsAudioBufferModelForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM2tsAudioBufferModel(M2tsAudioBufferModel value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM2tsAudioBufferModel(M2tsAudioBufferModel value);
 } // namespace M2tsAudioBufferModelMapper
 } // namespace Model
 } // namespace MediaConvert
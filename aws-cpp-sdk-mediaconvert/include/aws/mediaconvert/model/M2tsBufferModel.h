@@ -34,7 +34,8 @@ namespace M2tsBufferModelMapper
 {
 AWS_MEDIACONVERT_API M2tsBufferModel GetM2tsBufferModelForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM2tsBufferModel(M2tsBufferModel value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM2tsBufferModel(M2tsBufferModel value);
 } // namespace M2tsBufferModelMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace M2tsEbpAudioIntervalMapper
 {
 AWS_MEDIACONVERT_API M2tsEbpAudioInterval GetM2tsEbpAudioIntervalForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM2tsEbpAudioInterval(M2tsEbpAudioInterval value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM2tsEbpAudioInterval(M2tsEbpAudioInterval value);
 } // namespace M2tsEbpAudioIntervalMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace M2tsEbpPlacementMapper
 {
 AWS_MEDIACONVERT_API M2tsEbpPlacement GetM2tsEbpPlacementForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM2tsEbpPlacement(M2tsEbpPlacement value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM2tsEbpPlacement(M2tsEbpPlacement value);
 } // namespace M2tsEbpPlacementMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace M2tsEsRateInPesMapper
 {
 AWS_MEDIACONVERT_API M2tsEsRateInPes GetM2tsEsRateInPesForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM2tsEsRateInPes(M2tsEsRateInPes value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM2tsEsRateInPes(M2tsEsRateInPes value);
 } // namespace M2tsEsRateInPesMapper
 } // namespace Model
 } // namespace MediaConvert
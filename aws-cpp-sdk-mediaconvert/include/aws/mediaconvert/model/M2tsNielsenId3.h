@@ -34,7 +34,8 @@ namespace M2tsNielsenId3Mapper
 {
 AWS_MEDIACONVERT_API M2tsNielsenId3 GetM2tsNielsenId3ForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM2tsNielsenId3(M2tsNielsenId3 value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM2tsNielsenId3(M2tsNielsenId3 value);
 } // namespace M2tsNielsenId3Mapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace M2tsPcrControlMapper
 {
 AWS_MEDIACONVERT_API M2tsPcrControl GetM2tsPcrControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM2tsPcrControl(M2tsPcrControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM2tsPcrControl(M2tsPcrControl value);
 } // namespace M2tsPcrControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace M2tsScte35SourceMapper
 {
 AWS_MEDIACONVERT_API M2tsScte35Source GetM2tsScte35SourceForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM2tsScte35Source(M2tsScte35Source value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM2tsScte35Source(M2tsScte35Source value);
 } // namespace M2tsScte35SourceMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace M3u8NielsenId3Mapper
 {
 AWS_MEDIACONVERT_API M3u8NielsenId3 GetM3u8NielsenId3ForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM3u8NielsenId3(M3u8NielsenId3 value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM3u8NielsenId3(M3u8NielsenId3 value);
 } // namespace M3u8NielsenId3Mapper
 } // namespace Model
 } // namespace MediaConvert
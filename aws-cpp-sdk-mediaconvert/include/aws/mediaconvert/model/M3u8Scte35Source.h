@@ -34,7 +34,8 @@ namespace M3u8Scte35SourceMapper
 {
 AWS_MEDIACONVERT_API M3u8Scte35Source GetM3u8Scte35SourceForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForM3u8Scte35Source(M3u8Scte35Source value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForM3u8Scte35Source(M3u8Scte35Source value);
 } // namespace M3u8Scte35SourceMapper
 } // namespace Model
 } // namespace MediaConvert
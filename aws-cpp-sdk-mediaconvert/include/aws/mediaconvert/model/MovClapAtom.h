@@ -34,7 +34,8 @@ namespace MovClapAtomMapper
 {
 AWS_MEDIACONVERT_API MovClapAtom GetMovClapAtomForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMovClapAtom(MovClapAtom value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMovClapAtom(MovClapAtom value);
 } // namespace MovClapAtomMapper
 } // namespace Model
 } // namespace MediaConvert
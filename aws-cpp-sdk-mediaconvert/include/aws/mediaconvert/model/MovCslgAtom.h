@@ -34,7 +34,8 @@ namespace MovCslgAtomMapper
 {
 AWS_MEDIACONVERT_API MovCslgAtom GetMovCslgAtomForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMovCslgAtom(MovCslgAtom value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMovCslgAtom(MovCslgAtom value);
 } // namespace MovCslgAtomMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace MovMpeg2FourCCControlMapper
 {
 AWS_MEDIACONVERT_API MovMpeg2FourCCControl GetMovMpeg2FourCCControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMovMpeg2FourCCControl(MovMpeg2FourCCControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMovMpeg2FourCCControl(MovMpeg2FourCCControl value);
 } // namespace MovMpeg2FourCCControlMapper
 } // namespace Model
 } // namespace MediaConvert
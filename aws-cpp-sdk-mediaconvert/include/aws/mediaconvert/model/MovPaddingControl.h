@@ -34,7 +34,8 @@ namespace MovPaddingControlMapper
 {
 AWS_MEDIACONVERT_API MovPaddingControl GetMovPaddingControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMovPaddingControl(MovPaddingControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMovPaddingControl(MovPaddingControl value);
 } // namespace MovPaddingControlMapper
 } // namespace Model
 } // namespace MediaConvert
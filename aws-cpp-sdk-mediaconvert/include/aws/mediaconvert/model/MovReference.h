@@ -34,7 +34,8 @@ namespace MovReferenceMapper
 {
 AWS_MEDIACONVERT_API MovReference GetMovReferenceForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMovReference(MovReference value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMovReference(MovReference value);
 } // namespace MovReferenceMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Mp4CslgAtomMapper
 {
 AWS_MEDIACONVERT_API Mp4CslgAtom GetMp4CslgAtomForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMp4CslgAtom(Mp4CslgAtom value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMp4CslgAtom(Mp4CslgAtom value);
 } // namespace Mp4CslgAtomMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Mp4FreeSpaceBoxMapper
 {
 AWS_MEDIACONVERT_API Mp4FreeSpaceBox GetMp4FreeSpaceBoxForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMp4FreeSpaceBox(Mp4FreeSpaceBox value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMp4FreeSpaceBox(Mp4FreeSpaceBox value);
 } // namespace Mp4FreeSpaceBoxMapper
 } // namespace Model
 } // namespace MediaConvert
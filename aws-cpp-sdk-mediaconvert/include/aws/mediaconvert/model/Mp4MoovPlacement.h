@@ -34,7 +34,8 @@ namespace Mp4MoovPlacementMapper
 {
 AWS_MEDIACONVERT_API Mp4MoovPlacement GetMp4MoovPlacementForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMp4MoovPlacement(Mp4MoovPlacement value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMp4MoovPlacement(Mp4MoovPlacement value);
 } // namespace Mp4MoovPlacementMapper
 } // namespace Model
 } // namespace MediaConvert
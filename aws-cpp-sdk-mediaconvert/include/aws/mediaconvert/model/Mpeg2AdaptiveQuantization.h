@@ -36,7 +36,8 @@ namespace Mpeg2AdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API Mpeg2AdaptiveQuantization GetMpeg2AdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2AdaptiveQuantization(Mpeg2AdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2AdaptiveQuantization(Mpeg2AdaptiveQuantization value);
 } // namespace Mpeg2AdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
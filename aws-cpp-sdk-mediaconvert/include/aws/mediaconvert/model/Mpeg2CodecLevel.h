@@ -37,7 +37,8 @@ namespace Mpeg2CodecLevelMapper
 {
 AWS_MEDIACONVERT_API Mpeg2CodecLevel GetMpeg2CodecLevelForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2CodecLevel(Mpeg2CodecLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2CodecLevel(Mpeg2CodecLevel value);
 } // namespace Mpeg2CodecLevelMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Mpeg2CodecProfileMapper
 {
 AWS_MEDIACONVERT_API Mpeg2CodecProfile GetMpeg2CodecProfileForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2CodecProfile(Mpeg2CodecProfile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2CodecProfile(Mpeg2CodecProfile value);
 } // namespace Mpeg2CodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Mpeg2DynamicSubGopMapper
 {
 AWS_MEDIACONVERT_API Mpeg2DynamicSubGop GetMpeg2DynamicSubGopForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2DynamicSubGop(Mpeg2DynamicSubGop value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2DynamicSubGop(Mpeg2DynamicSubGop value);
 } // namespace Mpeg2DynamicSubGopMapper
 } // namespace Model
 } // namespace MediaConvert
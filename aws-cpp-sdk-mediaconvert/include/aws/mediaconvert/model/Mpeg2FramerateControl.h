@@ -34,7 +34,8 @@ namespace Mpeg2FramerateControlMapper
 {
 AWS_MEDIACONVERT_API Mpeg2FramerateControl GetMpeg2FramerateControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2FramerateControl(Mpeg2FramerateControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2FramerateControl(Mpeg2FramerateControl value);
 } // namespace Mpeg2FramerateControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Mpeg2FramerateConversionAlgorithmMapper
 {
 AWS_MEDIACONVERT_API Mpeg2FramerateConversionAlgorithm GetMpeg2FramerateConversionAlgorithmForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2FramerateConversionAlgorithm(Mpeg2FramerateConversionAlgorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2FramerateConversionAlgorithm(Mpeg2FramerateConversionAlgorithm value);
 } // namespace Mpeg2FramerateConversionAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
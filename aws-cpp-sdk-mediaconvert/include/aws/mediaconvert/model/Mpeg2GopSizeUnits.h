@@ -34,7 +34,8 @@ namespace Mpeg2GopSizeUnitsMapper
 {
 AWS_MEDIACONVERT_API Mpeg2GopSizeUnits GetMpeg2GopSizeUnitsForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2GopSizeUnits(Mpeg2GopSizeUnits value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2GopSizeUnits(Mpeg2GopSizeUnits value);
 } // namespace Mpeg2GopSizeUnitsMapper
 } // namespace Model
 } // namespace MediaConvert
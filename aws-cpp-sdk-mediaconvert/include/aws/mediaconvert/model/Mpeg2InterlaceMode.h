@@ -37,7 +37,8 @@ namespace Mpeg2InterlaceModeMapper
 {
 AWS_MEDIACONVERT_API Mpeg2InterlaceMode GetMpeg2InterlaceModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2InterlaceMode(Mpeg2InterlaceMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2InterlaceMode(Mpeg2InterlaceMode value);
 } // namespace Mpeg2InterlaceModeMapper
 } // namespace Model
 } // namespace MediaConvert
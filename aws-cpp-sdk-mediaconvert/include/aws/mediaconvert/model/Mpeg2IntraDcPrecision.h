@@ -37,7 +37,8 @@ namespace Mpeg2IntraDcPrecisionMapper
 {
 AWS_MEDIACONVERT_API Mpeg2IntraDcPrecision GetMpeg2IntraDcPrecisionForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2IntraDcPrecision(Mpeg2IntraDcPrecision value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2IntraDcPrecision(Mpeg2IntraDcPrecision value);
 } // namespace Mpeg2IntraDcPrecisionMapper
 } // namespace Model
 } // namespace MediaConvert
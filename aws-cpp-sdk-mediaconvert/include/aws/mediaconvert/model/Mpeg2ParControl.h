@@ -34,7 +34,8 @@ namespace Mpeg2ParControlMapper
 {
 AWS_MEDIACONVERT_API Mpeg2ParControl GetMpeg2ParControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2ParControl(Mpeg2ParControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2ParControl(Mpeg2ParControl value);
 } // namespace Mpeg2ParControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Mpeg2QualityTuningLevelMapper
 {
 AWS_MEDIACONVERT_API Mpeg2QualityTuningLevel GetMpeg2QualityTuningLevelForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2QualityTuningLevel(Mpeg2QualityTuningLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2QualityTuningLevel(Mpeg2QualityTuningLevel value);
 } // namespace Mpeg2QualityTuningLevelMapper
 } // namespace Model
 } // namespace MediaConvert
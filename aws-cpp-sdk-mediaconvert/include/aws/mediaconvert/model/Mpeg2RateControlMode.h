@@ -34,7 +34,8 @@ namespace Mpeg2RateControlModeMapper
 {
 AWS_MEDIACONVERT_API Mpeg2RateControlMode GetMpeg2RateControlModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2RateControlMode(Mpeg2RateControlMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2RateControlMode(Mpeg2RateControlMode value);
 } // namespace Mpeg2RateControlModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Mpeg2SceneChangeDetectMapper
 {
 AWS_MEDIACONVERT_API Mpeg2SceneChangeDetect GetMpeg2SceneChangeDetectForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2SceneChangeDetect(Mpeg2SceneChangeDetect value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2SceneChangeDetect(Mpeg2SceneChangeDetect value);
 } // namespace Mpeg2SceneChangeDetectMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Mpeg2SlowPalMapper
 {
 AWS_MEDIACONVERT_API Mpeg2SlowPal GetMpeg2SlowPalForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2SlowPal(Mpeg2SlowPal value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2SlowPal(Mpeg2SlowPal value);
 } // namespace Mpeg2SlowPalMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace Mpeg2SpatialAdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API Mpeg2SpatialAdaptiveQuantization GetMpeg2SpatialAdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2SpatialAdaptiveQuantization(Mpeg2SpatialAdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2SpatialAdaptiveQuantization(Mpeg2SpatialAdaptiveQuantization value);
 } // namespace Mpeg2SpatialAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
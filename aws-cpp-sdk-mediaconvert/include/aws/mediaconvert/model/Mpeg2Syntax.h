@@ -34,7 +34,8 @@ namespace Mpeg2SyntaxMapper
 {
 AWS_MEDIACONVERT_API Mpeg2Syntax GetMpeg2SyntaxForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2Syntax(Mpeg2Syntax value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2Syntax(Mpeg2Syntax value);
 } // namespace Mpeg2SyntaxMapper
 } // namespace Model
 } // namespace MediaConvert
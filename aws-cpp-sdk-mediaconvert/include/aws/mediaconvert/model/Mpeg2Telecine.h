@@ -35,7 +35,8 @@ namespace Mpeg2TelecineMapper
 {
 AWS_MEDIACONVERT_API Mpeg2Telecine GetMpeg2TelecineForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2Telecine(Mpeg2Telecine value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2Telecine(Mpeg2Telecine value);
 } // namespace Mpeg2TelecineMapper
 } // namespace Model
 } // namespace MediaConvert
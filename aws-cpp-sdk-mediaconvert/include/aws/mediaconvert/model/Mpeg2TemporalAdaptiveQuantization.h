@@ -34,7 +34,8 @@ namespace Mpeg2TemporalAdaptiveQuantizationMapper
 {
 AWS_MEDIACONVERT_API Mpeg2TemporalAdaptiveQuantization GetMpeg2TemporalAdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMpeg2TemporalAdaptiveQuantization(Mpeg2TemporalAdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMpeg2TemporalAdaptiveQuantization(Mpeg2TemporalAdaptiveQuantization value);
 } // namespace Mpeg2TemporalAdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace MsSmoothAudioDeduplicationMapper
 {
 AWS_MEDIACONVERT_API MsSmoothAudioDeduplication GetMsSmoothAudioDeduplicationForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMsSmoothAudioDeduplication(MsSmoothAudioDeduplication value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMsSmoothAudioDeduplication(MsSmoothAudioDeduplication value);
 } // namespace MsSmoothAudioDeduplicationMapper
 } // namespace Model
 } // namespace MediaConvert
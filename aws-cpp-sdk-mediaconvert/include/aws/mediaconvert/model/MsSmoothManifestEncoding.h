@@ -34,7 +34,8 @@ namespace MsSmoothManifestEncodingMapper
 {
 AWS_MEDIACONVERT_API MsSmoothManifestEncoding GetMsSmoothManifestEncodingForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForMsSmoothManifestEncoding(MsSmoothManifestEncoding value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForMsSmoothManifestEncoding(MsSmoothManifestEncoding value);
 } // namespace MsSmoothManifestEncodingMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -39,7 +39,8 @@ namespace NoiseReducerFilterMapper
 {
 AWS_MEDIACONVERT_API NoiseReducerFilter GetNoiseReducerFilterForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForNoiseReducerFilter(NoiseReducerFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForNoiseReducerFilter(NoiseReducerFilter value);
 } // namespace NoiseReducerFilterMapper
 } // namespace Model
 } // namespace MediaConvert
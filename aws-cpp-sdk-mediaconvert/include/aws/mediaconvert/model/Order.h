@@ -34,7 +34,8 @@ namespace OrderMapper
 {
 AWS_MEDIACONVERT_API Order GetOrderForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForOrder(Order value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForOrder(Order value);
 } // namespace OrderMapper
 } // namespace Model
 } // namespace MediaConvert
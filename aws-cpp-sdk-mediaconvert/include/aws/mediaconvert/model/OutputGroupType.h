@@ -37,7 +37,8 @@ namespace OutputGroupTypeMapper
 {
 AWS_MEDIACONVERT_API OutputGroupType GetOutputGroupTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForOutputGroupType(OutputGroupType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForOutputGroupType(OutputGroupType value);
 } // namespace OutputGroupTypeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,7 +36,8 @@ namespace OutputSdtMapper
 {
 AWS_MEDIACONVERT_API OutputSdt GetOutputSdtForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForOutputSdt(OutputSdt value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForOutputSdt(OutputSdt value);
 } // namespace OutputSdtMapper
 } // namespace Model
 } // namespace MediaConvert
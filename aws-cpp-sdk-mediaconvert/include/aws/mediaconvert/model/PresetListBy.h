@@ -35,7 +35,8 @@ namespace PresetListByMapper
 {
 AWS_MEDIACONVERT_API PresetListBy GetPresetListByForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForPresetListBy(PresetListBy value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForPresetListBy(PresetListBy value);
 } // namespace PresetListByMapper
 } // namespace Model
 } // namespace MediaConvert
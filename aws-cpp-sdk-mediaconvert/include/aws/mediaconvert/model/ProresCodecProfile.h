@@ -36,7 +36,8 @@ namespace ProresCodecProfileMapper
 {
 AWS_MEDIACONVERT_API ProresCodecProfile GetProresCodecProfileForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForProresCodecProfile(ProresCodecProfile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForProresCodecProfile(ProresCodecProfile value);
 } // namespace ProresCodecProfileMapper
 } // namespace Model
 } // namespace MediaConvert
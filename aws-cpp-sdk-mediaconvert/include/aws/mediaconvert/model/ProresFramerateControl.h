@@ -34,7 +34,8 @@ namespace ProresFramerateControlMapper
 {
 AWS_MEDIACONVERT_API ProresFramerateControl GetProresFramerateControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForProresFramerateControl(ProresFramerateControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForProresFramerateControl(ProresFramerateControl value);
 } // namespace ProresFramerateControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace ProresFramerateConversionAlgorithmMapper
 {
 AWS_MEDIACONVERT_API ProresFramerateConversionAlgorithm GetProresFramerateConversionAlgorithmForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForProresFramerateConversionAlgorithm(ProresFramerateConversionAlgorithm value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForProresFramerateConversionAlgorithm(ProresFramerateConversionAlgorithm value);
 } // namespace ProresFramerateConversionAlgorithmMapper
 } // namespace Model
 } // namespace MediaConvert
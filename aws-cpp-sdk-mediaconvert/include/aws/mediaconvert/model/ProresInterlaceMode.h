@@ -37,7 +37,8 @@ namespace ProresInterlaceModeMapper
 {
 AWS_MEDIACONVERT_API ProresInterlaceMode GetProresInterlaceModeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForProresInterlaceMode(ProresInterlaceMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForProresInterlaceMode(ProresInterlaceMode value);
 } // namespace ProresInterlaceModeMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace ProresParControlMapper
 {
 AWS_MEDIACONVERT_API ProresParControl GetProresParControlForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForProresParControl(ProresParControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForProresParControl(ProresParControl value);
 } // namespace ProresParControlMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace ProresSlowPalMapper
 {
 AWS_MEDIACONVERT_API ProresSlowPal GetProresSlowPalForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForProresSlowPal(ProresSlowPal value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForProresSlowPal(ProresSlowPal value);
 } // namespace ProresSlowPalMapper
 } // namespace Model
 } // namespace MediaConvert
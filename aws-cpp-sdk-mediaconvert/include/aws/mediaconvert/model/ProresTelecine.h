@@ -34,7 +34,8 @@ namespace ProresTelecineMapper
 {
 AWS_MEDIACONVERT_API ProresTelecine GetProresTelecineForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForProresTelecine(ProresTelecine value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForProresTelecine(ProresTelecine value);
 } // namespace ProresTelecineMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace QueueListByMapper
 {
 AWS_MEDIACONVERT_API QueueListBy GetQueueListByForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForQueueListBy(QueueListBy value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForQueueListBy(QueueListBy value);
 } // namespace QueueListByMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace QueueStatusMapper
 {
 AWS_MEDIACONVERT_API QueueStatus GetQueueStatusForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForQueueStatus(QueueStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForQueueStatus(QueueStatus value);
 } // namespace QueueStatusMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -35,7 +35,8 @@ namespace RespondToAfdMapper
 {
 AWS_MEDIACONVERT_API RespondToAfd GetRespondToAfdForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForRespondToAfd(RespondToAfd value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForRespondToAfd(RespondToAfd value);
 } // namespace RespondToAfdMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace ScalingBehaviorMapper
 {
 AWS_MEDIACONVERT_API ScalingBehavior GetScalingBehaviorForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForScalingBehavior(ScalingBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForScalingBehavior(ScalingBehavior value);
 } // namespace ScalingBehaviorMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -36,7 +36,8 @@ namespace SccDestinationFramerateMapper
 {
 AWS_MEDIACONVERT_API SccDestinationFramerate GetSccDestinationFramerateForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForSccDestinationFramerate(SccDestinationFramerate value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForSccDestinationFramerate(SccDestinationFramerate value);
 } // namespace SccDestinationFramerateMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -41,7 +41,8 @@ namespace TimecodeBurninPositionMapper
 {
 AWS_MEDIACONVERT_API TimecodeBurninPosition GetTimecodeBurninPositionForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForTimecodeBurninPosition(TimecodeBurninPosition value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForTimecodeBurninPosition(TimecodeBurninPosition value);
 } // namespace TimecodeBurninPositionMapper
 } // namespace Model
 } // namespace MediaConvert
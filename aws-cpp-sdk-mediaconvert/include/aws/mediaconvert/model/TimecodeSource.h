@@ -35,7 +35,8 @@ namespace TimecodeSourceMapper
 {
 AWS_MEDIACONVERT_API TimecodeSource GetTimecodeSourceForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForTimecodeSource(TimecodeSource value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForTimecodeSource(TimecodeSource value);
 } // namespace TimecodeSourceMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace TimedMetadataMapper
 {
 AWS_MEDIACONVERT_API TimedMetadata GetTimedMetadataForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForTimedMetadata(TimedMetadata value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForTimedMetadata(TimedMetadata value);
 } // namespace TimedMetadataMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace TtmlStylePassthroughMapper
 {
 AWS_MEDIACONVERT_API TtmlStylePassthrough GetTtmlStylePassthroughForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForTtmlStylePassthrough(TtmlStylePassthrough value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForTtmlStylePassthrough(TtmlStylePassthrough value);
 } // namespace TtmlStylePassthroughMapper
 } // namespace Model
 } // namespace MediaConvert
@@ -34,7 +34,8 @@ namespace TypeMapper
 {
 AWS_MEDIACONVERT_API Type GetTypeForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForType(Type value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForType(Type value);
 } // namespace TypeMapper
 } // namespace Model
 } // namespace MediaConvert
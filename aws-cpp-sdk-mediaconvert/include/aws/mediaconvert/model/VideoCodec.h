@@ -37,7 +37,8 @@ namespace VideoCodecMapper
 {
 AWS_MEDIACONVERT_API VideoCodec GetVideoCodecForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForVideoCodec(VideoCodec value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForVideoCodec(VideoCodec value);
 } // namespace VideoCodecMapper
 } // namespace Model
 } // namespace MediaConvert
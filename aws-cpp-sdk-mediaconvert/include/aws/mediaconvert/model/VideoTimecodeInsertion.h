@@ -34,7 +34,8 @@ namespace VideoTimecodeInsertionMapper
 {
 AWS_MEDIACONVERT_API VideoTimecodeInsertion GetVideoTimecodeInsertionForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForVideoTimecodeInsertion(VideoTimecodeInsertion value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForVideoTimecodeInsertion(VideoTimecodeInsertion value);
 } // namespace VideoTimecodeInsertionMapper
 } // namespace Model
 } // namespace MediaConvert
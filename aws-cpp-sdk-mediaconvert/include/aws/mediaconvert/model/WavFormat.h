@@ -34,7 +34,8 @@ namespace WavFormatMapper
 {
 AWS_MEDIACONVERT_API WavFormat GetWavFormatForName(const Aws::String& name);
 
-AWS_MEDIACONVERT_API Aws::String GetNameForWavFormat(WavFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIACONVERT_API const char* GetNameForWavFormat(WavFormat value);
 } // namespace WavFormatMapper
 } // namespace Model
 } // namespace MediaConvert
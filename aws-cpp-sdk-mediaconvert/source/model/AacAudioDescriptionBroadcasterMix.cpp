@@ -30,20 +30,30 @@ namespace Aws
       namespace AacAudioDescriptionBroadcasterMixMapper
       {
 
-        static const int BROADCASTER_MIXED_AD_HASH = HashingUtils::HashString("BROADCASTER_MIXED_AD");
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
+        static constexpr int BROADCASTER_MIXED_AD_HASH = HashingUtils::CompileTimeHashString("BROADCASTER_MIXED_AD");
+        static constexpr int NORMAL_HASH = HashingUtils::CompileTimeHashString("NORMAL");
 
 
         AacAudioDescriptionBroadcasterMix GetAacAudioDescriptionBroadcasterMixForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BROADCASTER_MIXED_AD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AacAudioDescriptionBroadcasterMix::BROADCASTER_MIXED_AD;
-          }
-          else if (hashCode == NORMAL_HASH)
-          {
-            return AacAudioDescriptionBroadcasterMix::NORMAL;
+          case BROADCASTER_MIXED_AD_HASH:
+            if (name == "BROADCASTER_MIXED_AD")
+            {
+              return AacAudioDescriptionBroadcasterMix::BROADCASTER_MIXED_AD;
+            }
+            break;
+          case NORMAL_HASH:
+            if (name == "NORMAL")
+            {
+              return AacAudioDescriptionBroadcasterMix::NORMAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AacAudioDescriptionBroadcasterMix::NOT_SET;
         }
 
-        Aws::String GetNameForAacAudioDescriptionBroadcasterMix(AacAudioDescriptionBroadcasterMix enumValue)
+        const char* GetNameForAacAudioDescriptionBroadcasterMix(AacAudioDescriptionBroadcasterMix enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AacCodecProfileMapper
       {
 
-        static const int LC_HASH = HashingUtils::HashString("LC");
-        static const int HEV1_HASH = HashingUtils::HashString("HEV1");
-        static const int HEV2_HASH = HashingUtils::HashString("HEV2");
+        static constexpr int LC_HASH = HashingUtils::CompileTimeHashString("LC");
+        static constexpr int HEV1_HASH = HashingUtils::CompileTimeHashString("HEV1");
+        static constexpr int HEV2_HASH = HashingUtils::CompileTimeHashString("HEV2");
 
 
         AacCodecProfile GetAacCodecProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AacCodecProfile::LC;
-          }
-          else if (hashCode == HEV1_HASH)
-          {
-            return AacCodecProfile::HEV1;
-          }
-          else if (hashCode == HEV2_HASH)
-          {
-            return AacCodecProfile::HEV2;
+          case LC_HASH:
+            if (name == "LC")
+            {
+              return AacCodecProfile::LC;
+            }
+            break;
+          case HEV1_HASH:
+            if (name == "HEV1")
+            {
+              return AacCodecProfile::HEV1;
+            }
+            break;
+          case HEV2_HASH:
+            if (name == "HEV2")
+            {
+              return AacCodecProfile::HEV2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AacCodecProfile::NOT_SET;
         }
 
-        Aws::String GetNameForAacCodecProfile(AacCodecProfile enumValue)
+        const char* GetNameForAacCodecProfile(AacCodecProfile enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
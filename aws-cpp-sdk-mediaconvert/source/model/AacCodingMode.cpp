@@ -30,35 +30,51 @@ namespace Aws
       namespace AacCodingModeMapper
       {
 
-        static const int AD_RECEIVER_MIX_HASH = HashingUtils::HashString("AD_RECEIVER_MIX");
-        static const int CODING_MODE_1_0_HASH = HashingUtils::HashString("CODING_MODE_1_0");
-        static const int CODING_MODE_1_1_HASH = HashingUtils::HashString("CODING_MODE_1_1");
-        static const int CODING_MODE_2_0_HASH = HashingUtils::HashString("CODING_MODE_2_0");
-        static const int CODING_MODE_5_1_HASH = HashingUtils::HashString("CODING_MODE_5_1");
+        static constexpr int AD_RECEIVER_MIX_HASH = HashingUtils::CompileTimeHashString("AD_RECEIVER_MIX");
+        static constexpr int CODING_MODE_1_0_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_1_0");
+        static constexpr int CODING_MODE_1_1_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_1_1");
+        static constexpr int CODING_MODE_2_0_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_2_0");
+        static constexpr int CODING_MODE_5_1_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_5_1");
 
 
         AacCodingMode GetAacCodingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AD_RECEIVER_MIX_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AacCodingMode::AD_RECEIVER_MIX;
-          }
-          else if (hashCode == CODING_MODE_1_0_HASH)
-          {
-            return AacCodingMode::CODING_MODE_1_0;
-          }
-          else if (hashCode == CODING_MODE_1_1_HASH)
-          {
-            return AacCodingMode::CODING_MODE_1_1;
-          }
-          else if (hashCode == CODING_MODE_2_0_HASH)
-          {
-            return AacCodingMode::CODING_MODE_2_0;
-          }
-          else if (hashCode == CODING_MODE_5_1_HASH)
-          {
-            return AacCodingMode::CODING_MODE_5_1;
+          case AD_RECEIVER_MIX_HASH:
+            if (name == "AD_RECEIVER_MIX")
+            {
+              return AacCodingMode::AD_RECEIVER_MIX;
+            }
+            break;
+          case CODING_MODE_1_0_HASH:
+            if (name == "CODING_MODE_1_0")
+            {
+              return AacCodingMode::CODING_MODE_1_0;
+            }
+            break;
+          case CODING_MODE_1_1_HASH:
+            if (name == "CODING_MODE_1_1")
+            {
+              return AacCodingMode::CODING_MODE_1_1;
+            }
+            break;
+          case CODING_MODE_2_0_HASH:
+            if (name == "CODING_MODE_2_0")
+            {
+              return AacCodingMode::CODING_MODE_2_0;
+            }
+            break;
+          case CODING_MODE_5_1_HASH:
+            if (name == "CODING_MODE_5_1")
+            {
+              return AacCodingMode::CODING_MODE_5_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return AacCodingMode::NOT_SET;
         }
 
-        Aws::String GetNameForAacCodingMode(AacCodingMode enumValue)
+        const char* GetNameForAacCodingMode(AacCodingMode enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AacRawFormatMapper
       {
 
-        static const int LATM_LOAS_HASH = HashingUtils::HashString("LATM_LOAS");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int LATM_LOAS_HASH = HashingUtils::CompileTimeHashString("LATM_LOAS");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         AacRawFormat GetAacRawFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LATM_LOAS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AacRawFormat::LATM_LOAS;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return AacRawFormat::NONE;
+          case LATM_LOAS_HASH:
+            if (name == "LATM_LOAS")
+            {
+              return AacRawFormat::LATM_LOAS;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return AacRawFormat::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AacRawFormat::NOT_SET;
         }
 
-        Aws::String GetNameForAacRawFormat(AacRawFormat enumValue)
+        const char* GetNameForAacRawFormat(AacRawFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
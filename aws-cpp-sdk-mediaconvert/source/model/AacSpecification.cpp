@@ -30,20 +30,30 @@ namespace Aws
       namespace AacSpecificationMapper
       {
 
-        static const int MPEG2_HASH = HashingUtils::HashString("MPEG2");
-        static const int MPEG4_HASH = HashingUtils::HashString("MPEG4");
+        static constexpr int MPEG2_HASH = HashingUtils::CompileTimeHashString("MPEG2");
+        static constexpr int MPEG4_HASH = HashingUtils::CompileTimeHashString("MPEG4");
 
 
         AacSpecification GetAacSpecificationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MPEG2_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AacSpecification::MPEG2;
-          }
-          else if (hashCode == MPEG4_HASH)
-          {
-            return AacSpecification::MPEG4;
+          case MPEG2_HASH:
+            if (name == "MPEG2")
+            {
+              return AacSpecification::MPEG2;
+            }
+            break;
+          case MPEG4_HASH:
+            if (name == "MPEG4")
+            {
+              return AacSpecification::MPEG4;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AacSpecification::NOT_SET;
         }
 
-        Aws::String GetNameForAacSpecification(AacSpecification enumValue)
+        const char* GetNameForAacSpecification(AacSpecification enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Ac3DynamicRangeCompressionProfileMapper
       {
 
-        static const int FILM_STANDARD_HASH = HashingUtils::HashString("FILM_STANDARD");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int FILM_STANDARD_HASH = HashingUtils::CompileTimeHashString("FILM_STANDARD");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         Ac3DynamicRangeCompressionProfile GetAc3DynamicRangeCompressionProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FILM_STANDARD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Ac3DynamicRangeCompressionProfile::FILM_STANDARD;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return Ac3DynamicRangeCompressionProfile::NONE;
+          case FILM_STANDARD_HASH:
+            if (name == "FILM_STANDARD")
+            {
+              return Ac3DynamicRangeCompressionProfile::FILM_STANDARD;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return Ac3DynamicRangeCompressionProfile::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Ac3DynamicRangeCompressionProfile::NOT_SET;
         }
 
-        Aws::String GetNameForAc3DynamicRangeCompressionProfile(Ac3DynamicRangeCompressionProfile enumValue)
+        const char* GetNameForAc3DynamicRangeCompressionProfile(Ac3DynamicRangeCompressionProfile enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Ac3MetadataControlMapper
       {
 
-        static const int FOLLOW_INPUT_HASH = HashingUtils::HashString("FOLLOW_INPUT");
-        static const int USE_CONFIGURED_HASH = HashingUtils::HashString("USE_CONFIGURED");
+        static constexpr int FOLLOW_INPUT_HASH = HashingUtils::CompileTimeHashString("FOLLOW_INPUT");
+        static constexpr int USE_CONFIGURED_HASH = HashingUtils::CompileTimeHashString("USE_CONFIGURED");
 
 
         Ac3MetadataControl GetAc3MetadataControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_INPUT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Ac3MetadataControl::FOLLOW_INPUT;
-          }
-          else if (hashCode == USE_CONFIGURED_HASH)
-          {
-            return Ac3MetadataControl::USE_CONFIGURED;
+          case FOLLOW_INPUT_HASH:
+            if (name == "FOLLOW_INPUT")
+            {
+              return Ac3MetadataControl::FOLLOW_INPUT;
+            }
+            break;
+          case USE_CONFIGURED_HASH:
+            if (name == "USE_CONFIGURED")
+            {
+              return Ac3MetadataControl::USE_CONFIGURED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Ac3MetadataControl::NOT_SET;
         }
 
-        Aws::String GetNameForAc3MetadataControl(Ac3MetadataControl enumValue)
+        const char* GetNameForAc3MetadataControl(Ac3MetadataControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AfdSignalingMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int FIXED_HASH = HashingUtils::HashString("FIXED");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int AUTO_HASH = HashingUtils::CompileTimeHashString("AUTO");
+        static constexpr int FIXED_HASH = HashingUtils::CompileTimeHashString("FIXED");
 
 
         AfdSignaling GetAfdSignalingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AfdSignaling::NONE;
-          }
-          else if (hashCode == AUTO_HASH)
-          {
-            return AfdSignaling::AUTO;
-          }
-          else if (hashCode == FIXED_HASH)
-          {
-            return AfdSignaling::FIXED;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return AfdSignaling::NONE;
+            }
+            break;
+          case AUTO_HASH:
+            if (name == "AUTO")
+            {
+              return AfdSignaling::AUTO;
+            }
+            break;
+          case FIXED_HASH:
+            if (name == "FIXED")
+            {
+              return AfdSignaling::FIXED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AfdSignaling::NOT_SET;
         }
 
-        Aws::String GetNameForAfdSignaling(AfdSignaling enumValue)
+        const char* GetNameForAfdSignaling(AfdSignaling enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
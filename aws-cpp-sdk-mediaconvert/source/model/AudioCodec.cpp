@@ -30,45 +30,65 @@ namespace Aws
       namespace AudioCodecMapper
       {
 
-        static const int AAC_HASH = HashingUtils::HashString("AAC");
-        static const int MP2_HASH = HashingUtils::HashString("MP2");
-        static const int WAV_HASH = HashingUtils::HashString("WAV");
-        static const int AIFF_HASH = HashingUtils::HashString("AIFF");
-        static const int AC3_HASH = HashingUtils::HashString("AC3");
-        static const int EAC3_HASH = HashingUtils::HashString("EAC3");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
+        static constexpr int AAC_HASH = HashingUtils::CompileTimeHashString("AAC");
+        static constexpr int MP2_HASH = HashingUtils::CompileTimeHashString("MP2");
+        static constexpr int WAV_HASH = HashingUtils::CompileTimeHashString("WAV");
+        static constexpr int AIFF_HASH = HashingUtils::CompileTimeHashString("AIFF");
+        static constexpr int AC3_HASH = HashingUtils::CompileTimeHashString("AC3");
+        static constexpr int EAC3_HASH = HashingUtils::CompileTimeHashString("EAC3");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
 
 
         AudioCodec GetAudioCodecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AAC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioCodec::AAC;
-          }
-          else if (hashCode == MP2_HASH)
-          {
-            return AudioCodec::MP2;
-          }
-          else if (hashCode == WAV_HASH)
-          {
-            return AudioCodec::WAV;
-          }
-          else if (hashCode == AIFF_HASH)
-          {
-            return AudioCodec::AIFF;
-          }
-          else if (hashCode == AC3_HASH)
-          {
-            return AudioCodec::AC3;
-          }
-          else if (hashCode == EAC3_HASH)
-          {
-            return AudioCodec::EAC3;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return AudioCodec::PASSTHROUGH;
+          case AAC_HASH:
+            if (name == "AAC")
+            {
+              return AudioCodec::AAC;
+            }
+            break;
+          case MP2_HASH:
+            if (name == "MP2")
+            {
+              return AudioCodec::MP2;
+            }
+            break;
+          case WAV_HASH:
+            if (name == "WAV")
+            {
+              return AudioCodec::WAV;
+            }
+            break;
+          case AIFF_HASH:
+            if (name == "AIFF")
+            {
+              return AudioCodec::AIFF;
+            }
+            break;
+          case AC3_HASH:
+            if (name == "AC3")
+            {
+              return AudioCodec::AC3;
+            }
+            break;
+          case EAC3_HASH:
+            if (name == "EAC3")
+            {
+              return AudioCodec::EAC3;
+            }
+            break;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return AudioCodec::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return AudioCodec::NOT_SET;
         }
 
-        Aws::String GetNameForAudioCodec(AudioCodec enumValue)
+        const char* GetNameForAudioCodec(AudioCodec enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AudioDefaultSelectionMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int NOT_DEFAULT_HASH = HashingUtils::HashString("NOT_DEFAULT");
+        static constexpr int DEFAULT_HASH = HashingUtils::CompileTimeHashString("DEFAULT");
+        static constexpr int NOT_DEFAULT_HASH = HashingUtils::CompileTimeHashString("NOT_DEFAULT");
 
 
         AudioDefaultSelection GetAudioDefaultSelectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioDefaultSelection::DEFAULT;
-          }
-          else if (hashCode == NOT_DEFAULT_HASH)
-          {
-            return AudioDefaultSelection::NOT_DEFAULT;
+          case DEFAULT_HASH:
+            if (name == "DEFAULT")
+            {
+              return AudioDefaultSelection::DEFAULT;
+            }
+            break;
+          case NOT_DEFAULT_HASH:
+            if (name == "NOT_DEFAULT")
+            {
+              return AudioDefaultSelection::NOT_DEFAULT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AudioDefaultSelection::NOT_SET;
         }
 
-        Aws::String GetNameForAudioDefaultSelection(AudioDefaultSelection enumValue)
+        const char* GetNameForAudioDefaultSelection(AudioDefaultSelection enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AudioNormalizationAlgorithmControlMapper
       {
 
-        static const int CORRECT_AUDIO_HASH = HashingUtils::HashString("CORRECT_AUDIO");
-        static const int MEASURE_ONLY_HASH = HashingUtils::HashString("MEASURE_ONLY");
+        static constexpr int CORRECT_AUDIO_HASH = HashingUtils::CompileTimeHashString("CORRECT_AUDIO");
+        static constexpr int MEASURE_ONLY_HASH = HashingUtils::CompileTimeHashString("MEASURE_ONLY");
 
 
         AudioNormalizationAlgorithmControl GetAudioNormalizationAlgorithmControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CORRECT_AUDIO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioNormalizationAlgorithmControl::CORRECT_AUDIO;
-          }
-          else if (hashCode == MEASURE_ONLY_HASH)
-          {
-            return AudioNormalizationAlgorithmControl::MEASURE_ONLY;
+          case CORRECT_AUDIO_HASH:
+            if (name == "CORRECT_AUDIO")
+            {
+              return AudioNormalizationAlgorithmControl::CORRECT_AUDIO;
+            }
+            break;
+          case MEASURE_ONLY_HASH:
+            if (name == "MEASURE_ONLY")
+            {
+              return AudioNormalizationAlgorithmControl::MEASURE_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AudioNormalizationAlgorithmControl::NOT_SET;
         }
 
-        Aws::String GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl enumValue)
+        const char* GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AudioNormalizationLoudnessLoggingMapper
       {
 
-        static const int LOG_HASH = HashingUtils::HashString("LOG");
-        static const int DONT_LOG_HASH = HashingUtils::HashString("DONT_LOG");
+        static constexpr int LOG_HASH = HashingUtils::CompileTimeHashString("LOG");
+        static constexpr int DONT_LOG_HASH = HashingUtils::CompileTimeHashString("DONT_LOG");
 
 
         AudioNormalizationLoudnessLogging GetAudioNormalizationLoudnessLoggingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOG_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioNormalizationLoudnessLogging::LOG;
-          }
-          else if (hashCode == DONT_LOG_HASH)
-          {
-            return AudioNormalizationLoudnessLogging::DONT_LOG;
+          case LOG_HASH:
+            if (name == "LOG")
+            {
+              return AudioNormalizationLoudnessLogging::LOG;
+            }
+            break;
+          case DONT_LOG_HASH:
+            if (name == "DONT_LOG")
+            {
+              return AudioNormalizationLoudnessLogging::DONT_LOG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AudioNormalizationLoudnessLogging::NOT_SET;
         }
 
-        Aws::String GetNameForAudioNormalizationLoudnessLogging(AudioNormalizationLoudnessLogging enumValue)
+        const char* GetNameForAudioNormalizationLoudnessLogging(AudioNormalizationLoudnessLogging enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AudioNormalizationPeakCalculationMapper
       {
 
-        static const int TRUE_PEAK_HASH = HashingUtils::HashString("TRUE_PEAK");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int TRUE_PEAK_HASH = HashingUtils::CompileTimeHashString("TRUE_PEAK");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         AudioNormalizationPeakCalculation GetAudioNormalizationPeakCalculationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRUE_PEAK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioNormalizationPeakCalculation::TRUE_PEAK;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return AudioNormalizationPeakCalculation::NONE;
+          case TRUE_PEAK_HASH:
+            if (name == "TRUE_PEAK")
+            {
+              return AudioNormalizationPeakCalculation::TRUE_PEAK;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return AudioNormalizationPeakCalculation::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AudioNormalizationPeakCalculation::NOT_SET;
         }
 
-        Aws::String GetNameForAudioNormalizationPeakCalculation(AudioNormalizationPeakCalculation enumValue)
+        const char* GetNameForAudioNormalizationPeakCalculation(AudioNormalizationPeakCalculation enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AudioSelectorTypeMapper
       {
 
-        static const int PID_HASH = HashingUtils::HashString("PID");
-        static const int TRACK_HASH = HashingUtils::HashString("TRACK");
-        static const int LANGUAGE_CODE_HASH = HashingUtils::HashString("LANGUAGE_CODE");
+        static constexpr int PID_HASH = HashingUtils::CompileTimeHashString("PID");
+        static constexpr int TRACK_HASH = HashingUtils::CompileTimeHashString("TRACK");
+        static constexpr int LANGUAGE_CODE_HASH = HashingUtils::CompileTimeHashString("LANGUAGE_CODE");
 
 
         AudioSelectorType GetAudioSelectorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PID_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioSelectorType::PID;
-          }
-          else if (hashCode == TRACK_HASH)
-          {
-            return AudioSelectorType::TRACK;
-          }
-          else if (hashCode == LANGUAGE_CODE_HASH)
-          {
-            return AudioSelectorType::LANGUAGE_CODE;
+          case PID_HASH:
+            if (name == "PID")
+            {
+              return AudioSelectorType::PID;
+            }
+            break;
+          case TRACK_HASH:
+            if (name == "TRACK")
+            {
+              return AudioSelectorType::TRACK;
+            }
+            break;
+          case LANGUAGE_CODE_HASH:
+            if (name == "LANGUAGE_CODE")
+            {
+              return AudioSelectorType::LANGUAGE_CODE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AudioSelectorType::NOT_SET;
         }
 
-        Aws::String GetNameForAudioSelectorType(AudioSelectorType enumValue)
+        const char* GetNameForAudioSelectorType(AudioSelectorType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
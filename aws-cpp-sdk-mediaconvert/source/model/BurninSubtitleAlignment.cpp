@@ -30,20 +30,30 @@ namespace Aws
       namespace BurninSubtitleAlignmentMapper
       {
 
-        static const int CENTERED_HASH = HashingUtils::HashString("CENTERED");
-        static const int LEFT_HASH = HashingUtils::HashString("LEFT");
+        static constexpr int CENTERED_HASH = HashingUtils::CompileTimeHashString("CENTERED");
+        static constexpr int LEFT_HASH = HashingUtils::CompileTimeHashString("LEFT");
 
 
         BurninSubtitleAlignment GetBurninSubtitleAlignmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CENTERED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BurninSubtitleAlignment::CENTERED;
-          }
-          else if (hashCode == LEFT_HASH)
-          {
-            return BurninSubtitleAlignment::LEFT;
+          case CENTERED_HASH:
+            if (name == "CENTERED")
+            {
+              return BurninSubtitleAlignment::CENTERED;
+            }
+            break;
+          case LEFT_HASH:
+            if (name == "LEFT")
+            {
+              return BurninSubtitleAlignment::LEFT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BurninSubtitleAlignment::NOT_SET;
         }
 
-        Aws::String GetNameForBurninSubtitleAlignment(BurninSubtitleAlignment enumValue)
+        const char* GetNameForBurninSubtitleAlignment(BurninSubtitleAlignment enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
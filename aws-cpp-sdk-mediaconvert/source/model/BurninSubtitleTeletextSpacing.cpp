@@ -30,20 +30,30 @@ namespace Aws
       namespace BurninSubtitleTeletextSpacingMapper
       {
 
-        static const int FIXED_GRID_HASH = HashingUtils::HashString("FIXED_GRID");
-        static const int PROPORTIONAL_HASH = HashingUtils::HashString("PROPORTIONAL");
+        static constexpr int FIXED_GRID_HASH = HashingUtils::CompileTimeHashString("FIXED_GRID");
+        static constexpr int PROPORTIONAL_HASH = HashingUtils::CompileTimeHashString("PROPORTIONAL");
 
 
         BurninSubtitleTeletextSpacing GetBurninSubtitleTeletextSpacingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FIXED_GRID_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BurninSubtitleTeletextSpacing::FIXED_GRID;
-          }
-          else if (hashCode == PROPORTIONAL_HASH)
-          {
-            return BurninSubtitleTeletextSpacing::PROPORTIONAL;
+          case FIXED_GRID_HASH:
+            if (name == "FIXED_GRID")
+            {
+              return BurninSubtitleTeletextSpacing::FIXED_GRID;
+            }
+            break;
+          case PROPORTIONAL_HASH:
+            if (name == "PROPORTIONAL")
+            {
+              return BurninSubtitleTeletextSpacing::PROPORTIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BurninSubtitleTeletextSpacing::NOT_SET;
         }
 
-        Aws::String GetNameForBurninSubtitleTeletextSpacing(BurninSubtitleTeletextSpacing enumValue)
+        const char* GetNameForBurninSubtitleTeletextSpacing(BurninSubtitleTeletextSpacing enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
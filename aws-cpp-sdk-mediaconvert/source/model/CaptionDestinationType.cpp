@@ -30,50 +30,72 @@ namespace Aws
       namespace CaptionDestinationTypeMapper
       {
 
-        static const int BURN_IN_HASH = HashingUtils::HashString("BURN_IN");
-        static const int DVB_SUB_HASH = HashingUtils::HashString("DVB_SUB");
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int SCC_HASH = HashingUtils::HashString("SCC");
-        static const int SRT_HASH = HashingUtils::HashString("SRT");
-        static const int TELETEXT_HASH = HashingUtils::HashString("TELETEXT");
-        static const int TTML_HASH = HashingUtils::HashString("TTML");
-        static const int WEBVTT_HASH = HashingUtils::HashString("WEBVTT");
+        static constexpr int BURN_IN_HASH = HashingUtils::CompileTimeHashString("BURN_IN");
+        static constexpr int DVB_SUB_HASH = HashingUtils::CompileTimeHashString("DVB_SUB");
+        static constexpr int EMBEDDED_HASH = HashingUtils::CompileTimeHashString("EMBEDDED");
+        static constexpr int SCC_HASH = HashingUtils::CompileTimeHashString("SCC");
+        static constexpr int SRT_HASH = HashingUtils::CompileTimeHashString("SRT");
+        static constexpr int TELETEXT_HASH = HashingUtils::CompileTimeHashString("TELETEXT");
+        static constexpr int TTML_HASH = HashingUtils::CompileTimeHashString("TTML");
+        static constexpr int WEBVTT_HASH = HashingUtils::CompileTimeHashString("WEBVTT");
 
 
         CaptionDestinationType GetCaptionDestinationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BURN_IN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CaptionDestinationType::BURN_IN;
-          }
-          else if (hashCode == DVB_SUB_HASH)
-          {
-            return CaptionDestinationType::DVB_SUB;
-          }
-          else if (hashCode == EMBEDDED_HASH)
-          {
-            return CaptionDestinationType::EMBEDDED;
-          }
-          else if (hashCode == SCC_HASH)
-          {
-            return CaptionDestinationType::SCC;
-          }
-          else if (hashCode == SRT_HASH)
-          {
-            return CaptionDestinationType::SRT;
-          }
-          else if (hashCode == TELETEXT_HASH)
-          {
-            return CaptionDestinationType::TELETEXT;
-          }
-          else if (hashCode == TTML_HASH)
-          {
-            return CaptionDestinationType::TTML;
-          }
-          else if (hashCode == WEBVTT_HASH)
-          {
-            return CaptionDestinationType::WEBVTT;
+          case BURN_IN_HASH:
+            if (name == "BURN_IN")
+            {
+              return CaptionDestinationType::BURN_IN;
+            }
+            break;
+          case DVB_SUB_HASH:
+            if (name == "DVB_SUB")
+            {
+              return CaptionDestinationType::DVB_SUB;
+            }
+            break;
+          case EMBEDDED_HASH:
+            if (name == "EMBEDDED")
+            {
+              return CaptionDestinationType::EMBEDDED;
+            }
+            break;
+          case SCC_HASH:
+            if (name == "SCC")
+            {
+              return CaptionDestinationType::SCC;
+            }
+            break;
+          case SRT_HASH:
+            if (name == "SRT")
+            {
+              return CaptionDestinationType::SRT;
+            }
+            break;
+          case TELETEXT_HASH:
+            if (name == "TELETEXT")
+            {
+              return CaptionDestinationType::TELETEXT;
+            }
+            break;
+          case TTML_HASH:
+            if (name == "TTML")
+            {
+              return CaptionDestinationType::TTML;
+            }
+            break;
+          case WEBVTT_HASH:
+            if (name == "WEBVTT")
+            {
+              return CaptionDestinationType::WEBVTT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return CaptionDestinationType::NOT_SET;
         }
 
-        Aws::String GetNameForCaptionDestinationType(CaptionDestinationType enumValue)
+        const char* GetNameForCaptionDestinationType(CaptionDestinationType enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
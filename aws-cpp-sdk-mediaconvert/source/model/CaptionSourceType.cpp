@@ -30,55 +30,79 @@ namespace Aws
       namespace CaptionSourceTypeMapper
       {
 
-        static const int ANCILLARY_HASH = HashingUtils::HashString("ANCILLARY");
-        static const int DVB_SUB_HASH = HashingUtils::HashString("DVB_SUB");
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int SCC_HASH = HashingUtils::HashString("SCC");
-        static const int TTML_HASH = HashingUtils::HashString("TTML");
-        static const int STL_HASH = HashingUtils::HashString("STL");
-        static const int SRT_HASH = HashingUtils::HashString("SRT");
-        static const int TELETEXT_HASH = HashingUtils::HashString("TELETEXT");
-        static const int NULL_SOURCE_HASH = HashingUtils::HashString("NULL_SOURCE");
+        static constexpr int ANCILLARY_HASH = HashingUtils::CompileTimeHashString("ANCILLARY");
+        static constexpr int DVB_SUB_HASH = HashingUtils::CompileTimeHashString("DVB_SUB");
+        static constexpr int EMBEDDED_HASH = HashingUtils::CompileTimeHashString("EMBEDDED");
+        static constexpr int SCC_HASH = HashingUtils::CompileTimeHashString("SCC");
+        static constexpr int TTML_HASH = HashingUtils::CompileTimeHashString("TTML");
+        static constexpr int STL_HASH = HashingUtils::CompileTimeHashString("STL");
+        static constexpr int SRT_HASH = HashingUtils::CompileTimeHashString("SRT");
+        static constexpr int TELETEXT_HASH = HashingUtils::CompileTimeHashString("TELETEXT");
+        static constexpr int NULL_SOURCE_HASH = HashingUtils::CompileTimeHashString("NULL_SOURCE");
 
 
         CaptionSourceType GetCaptionSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ANCILLARY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CaptionSourceType::ANCILLARY;
-          }
-          else if (hashCode == DVB_SUB_HASH)
-          {
-            return CaptionSourceType::DVB_SUB;
-          }
-          else if (hashCode == EMBEDDED_HASH)
-          {
-            return CaptionSourceType::EMBEDDED;
-          }
-          else if (hashCode == SCC_HASH)
-          {
-            return CaptionSourceType::SCC;
-          }
-          else if (hashCode == TTML_HASH)
-          {
-            return CaptionSourceType::TTML;
-          }
-          else if (hashCode == STL_HASH)
-          {
-            return CaptionSourceType::STL;
-          }
-          else if (hashCode == SRT_HASH)
-          {
-            return CaptionSourceType::SRT;
-          }
-          else if (hashCode == TELETEXT_HASH)
-          {
-            return CaptionSourceType::TELETEXT;
-          }
-          else if (hashCode == NULL_SOURCE_HASH)
-          {
-            return CaptionSourceType::NULL_SOURCE;
+          case ANCILLARY_HASH:
+            if (name == "ANCILLARY")
+            {
+              return CaptionSourceType::ANCILLARY;
+            }
+            break;
+          case DVB_SUB_HASH:
+            if (name == "DVB_SUB")
+            {
+              return CaptionSourceType::DVB_SUB;
+            }
+            break;
+          case EMBEDDED_HASH:
+            if (name == "EMBEDDED")
+            {
+              return CaptionSourceType::EMBEDDED;
+            }
+            break;
+          case SCC_HASH:
+            if (name == "SCC")
+            {
+              return CaptionSourceType::SCC;
+            }
+            break;
+          case TTML_HASH:
+            if (name == "TTML")
+            {
+              return CaptionSourceType::TTML;
+            }
+            break;
+          case STL_HASH:
+            if (name == "STL")
+            {
+              return CaptionSourceType::STL;
+            }
+            break;
+          case SRT_HASH:
+            if (name == "SRT")
+            {
+              return CaptionSourceType::SRT;
+            }
+            break;
+          case TELETEXT_HASH:
+            if (name == "TELETEXT")
+            {
+              return CaptionSourceType::TELETEXT;
+            }
+            break;
+          case NULL_SOURCE_HASH:
+            if (name == "NULL_SOURCE")
+            {
+              return CaptionSourceType::NULL_SOURCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return CaptionSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForCaptionSourceType(CaptionSourceType enumValue)
+        const char* GetNameForCaptionSourceType(CaptionSourceType enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
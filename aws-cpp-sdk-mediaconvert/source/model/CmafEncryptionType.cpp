@@ -30,15 +30,23 @@ namespace Aws
       namespace CmafEncryptionTypeMapper
       {
 
-        static const int SAMPLE_AES_HASH = HashingUtils::HashString("SAMPLE_AES");
+        static constexpr int SAMPLE_AES_HASH = HashingUtils::CompileTimeHashString("SAMPLE_AES");
 
 
         CmafEncryptionType GetCmafEncryptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SAMPLE_AES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CmafEncryptionType::SAMPLE_AES;
+          case SAMPLE_AES_HASH:
+            if (name == "SAMPLE_AES")
+            {
+              return CmafEncryptionType::SAMPLE_AES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return CmafEncryptionType::NOT_SET;
         }
 
-        Aws::String GetNameForCmafEncryptionType(CmafEncryptionType enumValue)
+        const char* GetNameForCmafEncryptionType(CmafEncryptionType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
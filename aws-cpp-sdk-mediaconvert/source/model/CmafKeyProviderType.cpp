@@ -30,15 +30,23 @@ namespace Aws
       namespace CmafKeyProviderTypeMapper
       {
 
-        static const int STATIC_KEY_HASH = HashingUtils::HashString("STATIC_KEY");
+        static constexpr int STATIC_KEY_HASH = HashingUtils::CompileTimeHashString("STATIC_KEY");
 
 
         CmafKeyProviderType GetCmafKeyProviderTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STATIC_KEY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CmafKeyProviderType::STATIC_KEY;
+          case STATIC_KEY_HASH:
+            if (name == "STATIC_KEY")
+            {
+              return CmafKeyProviderType::STATIC_KEY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return CmafKeyProviderType::NOT_SET;
         }
 
-        Aws::String GetNameForCmafKeyProviderType(CmafKeyProviderType enumValue)
+        const char* GetNameForCmafKeyProviderType(CmafKeyProviderType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
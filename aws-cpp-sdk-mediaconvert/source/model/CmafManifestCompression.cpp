@@ -30,20 +30,30 @@ namespace Aws
       namespace CmafManifestCompressionMapper
       {
 
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int GZIP_HASH = HashingUtils::CompileTimeHashString("GZIP");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         CmafManifestCompression GetCmafManifestCompressionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GZIP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CmafManifestCompression::GZIP;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return CmafManifestCompression::NONE;
+          case GZIP_HASH:
+            if (name == "GZIP")
+            {
+              return CmafManifestCompression::GZIP;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return CmafManifestCompression::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CmafManifestCompression::NOT_SET;
         }
 
-        Aws::String GetNameForCmafManifestCompression(CmafManifestCompression enumValue)
+        const char* GetNameForCmafManifestCompression(CmafManifestCompression enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace ColorSpaceMapper
       {
 
-        static const int FOLLOW_HASH = HashingUtils::HashString("FOLLOW");
-        static const int REC_601_HASH = HashingUtils::HashString("REC_601");
-        static const int REC_709_HASH = HashingUtils::HashString("REC_709");
-        static const int HDR10_HASH = HashingUtils::HashString("HDR10");
-        static const int HLG_2020_HASH = HashingUtils::HashString("HLG_2020");
+        static constexpr int FOLLOW_HASH = HashingUtils::CompileTimeHashString("FOLLOW");
+        static constexpr int REC_601_HASH = HashingUtils::CompileTimeHashString("REC_601");
+        static constexpr int REC_709_HASH = HashingUtils::CompileTimeHashString("REC_709");
+        static constexpr int HDR10_HASH = HashingUtils::CompileTimeHashString("HDR10");
+        static constexpr int HLG_2020_HASH = HashingUtils::CompileTimeHashString("HLG_2020");
 
 
         ColorSpace GetColorSpaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ColorSpace::FOLLOW;
-          }
-          else if (hashCode == REC_601_HASH)
-          {
-            return ColorSpace::REC_601;
-          }
-          else if (hashCode == REC_709_HASH)
-          {
-            return ColorSpace::REC_709;
-          }
-          else if (hashCode == HDR10_HASH)
-          {
-            return ColorSpace::HDR10;
-          }
-          else if (hashCode == HLG_2020_HASH)
-          {
-            return ColorSpace::HLG_2020;
+          case FOLLOW_HASH:
+            if (name == "FOLLOW")
+            {
+              return ColorSpace::FOLLOW;
+            }
+            break;
+          case REC_601_HASH:
+            if (name == "REC_601")
+            {
+              return ColorSpace::REC_601;
+            }
+            break;
+          case REC_709_HASH:
+            if (name == "REC_709")
+            {
+              return ColorSpace::REC_709;
+            }
+            break;
+          case HDR10_HASH:
+            if (name == "HDR10")
+            {
+              return ColorSpace::HDR10;
+            }
+            break;
+          case HLG_2020_HASH:
+            if (name == "HLG_2020")
+            {
+              return ColorSpace::HLG_2020;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ColorSpace::NOT_SET;
         }
 
-        Aws::String GetNameForColorSpace(ColorSpace enumValue)
+        const char* GetNameForColorSpace(ColorSpace enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
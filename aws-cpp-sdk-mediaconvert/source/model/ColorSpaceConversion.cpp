@@ -30,35 +30,51 @@ namespace Aws
       namespace ColorSpaceConversionMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int FORCE_601_HASH = HashingUtils::HashString("FORCE_601");
-        static const int FORCE_709_HASH = HashingUtils::HashString("FORCE_709");
-        static const int FORCE_HDR10_HASH = HashingUtils::HashString("FORCE_HDR10");
-        static const int FORCE_HLG_2020_HASH = HashingUtils::HashString("FORCE_HLG_2020");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int FORCE_601_HASH = HashingUtils::CompileTimeHashString("FORCE_601");
+        static constexpr int FORCE_709_HASH = HashingUtils::CompileTimeHashString("FORCE_709");
+        static constexpr int FORCE_HDR10_HASH = HashingUtils::CompileTimeHashString("FORCE_HDR10");
+        static constexpr int FORCE_HLG_2020_HASH = HashingUtils::CompileTimeHashString("FORCE_HLG_2020");
 
 
         ColorSpaceConversion GetColorSpaceConversionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ColorSpaceConversion::NONE;
-          }
-          else if (hashCode == FORCE_601_HASH)
-          {
-            return ColorSpaceConversion::FORCE_601;
-          }
-          else if (hashCode == FORCE_709_HASH)
-          {
-            return ColorSpaceConversion::FORCE_709;
-          }
-          else if (hashCode == FORCE_HDR10_HASH)
-          {
-            return ColorSpaceConversion::FORCE_HDR10;
-          }
-          else if (hashCode == FORCE_HLG_2020_HASH)
-          {
-            return ColorSpaceConversion::FORCE_HLG_2020;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return ColorSpaceConversion::NONE;
+            }
+            break;
+          case FORCE_601_HASH:
+            if (name == "FORCE_601")
+            {
+              return ColorSpaceConversion::FORCE_601;
+            }
+            break;
+          case FORCE_709_HASH:
+            if (name == "FORCE_709")
+            {
+              return ColorSpaceConversion::FORCE_709;
+            }
+            break;
+          case FORCE_HDR10_HASH:
+            if (name == "FORCE_HDR10")
+            {
+              return ColorSpaceConversion::FORCE_HDR10;
+            }
+            break;
+          case FORCE_HLG_2020_HASH:
+            if (name == "FORCE_HLG_2020")
+            {
+              return ColorSpaceConversion::FORCE_HLG_2020;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ColorSpaceConversion::NOT_SET;
         }
 
-        Aws::String GetNameForColorSpaceConversion(ColorSpaceConversion enumValue)
+        const char* GetNameForColorSpaceConversion(ColorSpaceConversion enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
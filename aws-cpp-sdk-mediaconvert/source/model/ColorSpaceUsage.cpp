@@ -30,20 +30,30 @@ namespace Aws
       namespace ColorSpaceUsageMapper
       {
 
-        static const int FORCE_HASH = HashingUtils::HashString("FORCE");
-        static const int FALLBACK_HASH = HashingUtils::HashString("FALLBACK");
+        static constexpr int FORCE_HASH = HashingUtils::CompileTimeHashString("FORCE");
+        static constexpr int FALLBACK_HASH = HashingUtils::CompileTimeHashString("FALLBACK");
 
 
         ColorSpaceUsage GetColorSpaceUsageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FORCE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ColorSpaceUsage::FORCE;
-          }
-          else if (hashCode == FALLBACK_HASH)
-          {
-            return ColorSpaceUsage::FALLBACK;
+          case FORCE_HASH:
+            if (name == "FORCE")
+            {
+              return ColorSpaceUsage::FORCE;
+            }
+            break;
+          case FALLBACK_HASH:
+            if (name == "FALLBACK")
+            {
+              return ColorSpaceUsage::FALLBACK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ColorSpaceUsage::NOT_SET;
         }
 
-        Aws::String GetNameForColorSpaceUsage(ColorSpaceUsage enumValue)
+        const char* GetNameForColorSpaceUsage(ColorSpaceUsage enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
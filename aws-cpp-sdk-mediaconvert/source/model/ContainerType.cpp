@@ -30,60 +30,86 @@ namespace Aws
       namespace ContainerTypeMapper
       {
 
-        static const int F4V_HASH = HashingUtils::HashString("F4V");
-        static const int ISMV_HASH = HashingUtils::HashString("ISMV");
-        static const int M2TS_HASH = HashingUtils::HashString("M2TS");
-        static const int M3U8_HASH = HashingUtils::HashString("M3U8");
-        static const int CMFC_HASH = HashingUtils::HashString("CMFC");
-        static const int MOV_HASH = HashingUtils::HashString("MOV");
-        static const int MP4_HASH = HashingUtils::HashString("MP4");
-        static const int MPD_HASH = HashingUtils::HashString("MPD");
-        static const int MXF_HASH = HashingUtils::HashString("MXF");
-        static const int RAW_HASH = HashingUtils::HashString("RAW");
+        static constexpr int F4V_HASH = HashingUtils::CompileTimeHashString("F4V");
+        static constexpr int ISMV_HASH = HashingUtils::CompileTimeHashString("ISMV");
+        static constexpr int M2TS_HASH = HashingUtils::CompileTimeHashString("M2TS");
+        static constexpr int M3U8_HASH = HashingUtils::CompileTimeHashString("M3U8");
+        static constexpr int CMFC_HASH = HashingUtils::CompileTimeHashString("CMFC");
+        static constexpr int MOV_HASH = HashingUtils::CompileTimeHashString("MOV");
+        static constexpr int MP4_HASH = HashingUtils::CompileTimeHashString("MP4");
+        static constexpr int MPD_HASH = HashingUtils::CompileTimeHashString("MPD");
+        static constexpr int MXF_HASH = HashingUtils::CompileTimeHashString("MXF");
+        static constexpr int RAW_HASH = HashingUtils::CompileTimeHashString("RAW");
 
 
         ContainerType GetContainerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == F4V_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContainerType::F4V;
-          }
-          else if (hashCode == ISMV_HASH)
-          {
-            return ContainerType::ISMV;
-          }
-          else if (hashCode == M2TS_HASH)
-          {
-            return ContainerType::M2TS;
-          }
-          else if (hashCode == M3U8_HASH)
-          {
-            return ContainerType::M3U8;
-          }
-          else if (hashCode == CMFC_HASH)
-          {
-            return ContainerType::CMFC;
-          }
-          else if (hashCode == MOV_HASH)
-          {
-            return ContainerType::MOV;
-          }
-          else if (hashCode == MP4_HASH)
-          {
-            return ContainerType::MP4;
-          }
-          else if (hashCode == MPD_HASH)
-          {
-            return ContainerType::MPD;
-          }
-          else if (hashCode == MXF_HASH)
-          {
-            return ContainerType::MXF;
-          }
-          else if (hashCode == RAW_HASH)
-          {
-            return ContainerType::RAW;
+          case F4V_HASH:
+            if (name == "F4V")
+            {
+              return ContainerType::F4V;
+            }
+            break;
+          case ISMV_HASH:
+            if (name == "ISMV")
+            {
+              return ContainerType::ISMV;
+            }
+            break;
+          case M2TS_HASH:
+            if (name == "M2TS")
+            {
+              return ContainerType::M2TS;
+            }
+            break;
+          case M3U8_HASH:
+            if (name == "M3U8")
+            {
+              return ContainerType::M3U8;
+            }
+            break;
+          case CMFC_HASH:
+            if (name == "CMFC")
+            {
+              return ContainerType::CMFC;
+            }
+            break;
+          case MOV_HASH:
+            if (name == "MOV")
+            {
+              return ContainerType::MOV;
+            }
+            break;
+          case MP4_HASH:
+            if (name == "MP4")
+            {
+              return ContainerType::MP4;
+            }
+            break;
+          case MPD_HASH:
+            if (name == "MPD")
+            {
+              return ContainerType::MPD;
+            }
+            break;
+          case MXF_HASH:
+            if (name == "MXF")
+            {
+              return ContainerType::MXF;
+            }
+            break;
+          case RAW_HASH:
+            if (name == "RAW")
+            {
+              return ContainerType::RAW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return ContainerType::NOT_SET;
         }
 
-        Aws::String GetNameForContainerType(ContainerType enumValue)
+        const char* GetNameForContainerType(ContainerType enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
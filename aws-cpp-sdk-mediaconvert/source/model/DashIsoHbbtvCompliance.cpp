@@ -30,20 +30,30 @@ namespace Aws
       namespace DashIsoHbbtvComplianceMapper
       {
 
-        static const int HBBTV_1_5_HASH = HashingUtils::HashString("HBBTV_1_5");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int HBBTV_1_5_HASH = HashingUtils::CompileTimeHashString("HBBTV_1_5");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         DashIsoHbbtvCompliance GetDashIsoHbbtvComplianceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HBBTV_1_5_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DashIsoHbbtvCompliance::HBBTV_1_5;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return DashIsoHbbtvCompliance::NONE;
+          case HBBTV_1_5_HASH:
+            if (name == "HBBTV_1_5")
+            {
+              return DashIsoHbbtvCompliance::HBBTV_1_5;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return DashIsoHbbtvCompliance::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DashIsoHbbtvCompliance::NOT_SET;
         }
 
-        Aws::String GetNameForDashIsoHbbtvCompliance(DashIsoHbbtvCompliance enumValue)
+        const char* GetNameForDashIsoHbbtvCompliance(DashIsoHbbtvCompliance enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace DeinterlaceAlgorithmMapper
       {
 
-        static const int INTERPOLATE_HASH = HashingUtils::HashString("INTERPOLATE");
-        static const int INTERPOLATE_TICKER_HASH = HashingUtils::HashString("INTERPOLATE_TICKER");
-        static const int BLEND_HASH = HashingUtils::HashString("BLEND");
-        static const int BLEND_TICKER_HASH = HashingUtils::HashString("BLEND_TICKER");
+        static constexpr int INTERPOLATE_HASH = HashingUtils::CompileTimeHashString("INTERPOLATE");
+        static constexpr int INTERPOLATE_TICKER_HASH = HashingUtils::CompileTimeHashString("INTERPOLATE_TICKER");
+        static constexpr int BLEND_HASH = HashingUtils::CompileTimeHashString("BLEND");
+        static constexpr int BLEND_TICKER_HASH = HashingUtils::CompileTimeHashString("BLEND_TICKER");
 
 
         DeinterlaceAlgorithm GetDeinterlaceAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERPOLATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeinterlaceAlgorithm::INTERPOLATE;
-          }
-          else if (hashCode == INTERPOLATE_TICKER_HASH)
-          {
-            return DeinterlaceAlgorithm::INTERPOLATE_TICKER;
-          }
-          else if (hashCode == BLEND_HASH)
-          {
-            return DeinterlaceAlgorithm::BLEND;
-          }
-          else if (hashCode == BLEND_TICKER_HASH)
-          {
-            return DeinterlaceAlgorithm::BLEND_TICKER;
+          case INTERPOLATE_HASH:
+            if (name == "INTERPOLATE")
+            {
+              return DeinterlaceAlgorithm::INTERPOLATE;
+            }
+            break;
+          case INTERPOLATE_TICKER_HASH:
+            if (name == "INTERPOLATE_TICKER")
+            {
+              return DeinterlaceAlgorithm::INTERPOLATE_TICKER;
+            }
+            break;
+          case BLEND_HASH:
+            if (name == "BLEND")
+            {
+              return DeinterlaceAlgorithm::BLEND;
+            }
+            break;
+          case BLEND_TICKER_HASH:
+            if (name == "BLEND_TICKER")
+            {
+              return DeinterlaceAlgorithm::BLEND_TICKER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DeinterlaceAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForDeinterlaceAlgorithm(DeinterlaceAlgorithm enumValue)
+        const char* GetNameForDeinterlaceAlgorithm(DeinterlaceAlgorithm enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DeinterlacerControlMapper
       {
 
-        static const int FORCE_ALL_FRAMES_HASH = HashingUtils::HashString("FORCE_ALL_FRAMES");
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
+        static constexpr int FORCE_ALL_FRAMES_HASH = HashingUtils::CompileTimeHashString("FORCE_ALL_FRAMES");
+        static constexpr int NORMAL_HASH = HashingUtils::CompileTimeHashString("NORMAL");
 
 
         DeinterlacerControl GetDeinterlacerControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FORCE_ALL_FRAMES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeinterlacerControl::FORCE_ALL_FRAMES;
-          }
-          else if (hashCode == NORMAL_HASH)
-          {
-            return DeinterlacerControl::NORMAL;
+          case FORCE_ALL_FRAMES_HASH:
+            if (name == "FORCE_ALL_FRAMES")
+            {
+              return DeinterlacerControl::FORCE_ALL_FRAMES;
+            }
+            break;
+          case NORMAL_HASH:
+            if (name == "NORMAL")
+            {
+              return DeinterlacerControl::NORMAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeinterlacerControl::NOT_SET;
         }
 
-        Aws::String GetNameForDeinterlacerControl(DeinterlacerControl enumValue)
+        const char* GetNameForDeinterlacerControl(DeinterlacerControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
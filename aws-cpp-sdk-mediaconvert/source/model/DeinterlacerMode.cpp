@@ -30,25 +30,37 @@ namespace Aws
       namespace DeinterlacerModeMapper
       {
 
-        static const int DEINTERLACE_HASH = HashingUtils::HashString("DEINTERLACE");
-        static const int INVERSE_TELECINE_HASH = HashingUtils::HashString("INVERSE_TELECINE");
-        static const int ADAPTIVE_HASH = HashingUtils::HashString("ADAPTIVE");
+        static constexpr int DEINTERLACE_HASH = HashingUtils::CompileTimeHashString("DEINTERLACE");
+        static constexpr int INVERSE_TELECINE_HASH = HashingUtils::CompileTimeHashString("INVERSE_TELECINE");
+        static constexpr int ADAPTIVE_HASH = HashingUtils::CompileTimeHashString("ADAPTIVE");
 
 
         DeinterlacerMode GetDeinterlacerModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEINTERLACE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeinterlacerMode::DEINTERLACE;
-          }
-          else if (hashCode == INVERSE_TELECINE_HASH)
-          {
-            return DeinterlacerMode::INVERSE_TELECINE;
-          }
-          else if (hashCode == ADAPTIVE_HASH)
-          {
-            return DeinterlacerMode::ADAPTIVE;
+          case DEINTERLACE_HASH:
+            if (name == "DEINTERLACE")
+            {
+              return DeinterlacerMode::DEINTERLACE;
+            }
+            break;
+          case INVERSE_TELECINE_HASH:
+            if (name == "INVERSE_TELECINE")
+            {
+              return DeinterlacerMode::INVERSE_TELECINE;
+            }
+            break;
+          case ADAPTIVE_HASH:
+            if (name == "ADAPTIVE")
+            {
+              return DeinterlacerMode::ADAPTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DeinterlacerMode::NOT_SET;
         }
 
-        Aws::String GetNameForDeinterlacerMode(DeinterlacerMode enumValue)
+        const char* GetNameForDeinterlacerMode(DeinterlacerMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
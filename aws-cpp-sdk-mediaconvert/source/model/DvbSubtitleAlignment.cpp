@@ -30,20 +30,30 @@ namespace Aws
       namespace DvbSubtitleAlignmentMapper
       {
 
-        static const int CENTERED_HASH = HashingUtils::HashString("CENTERED");
-        static const int LEFT_HASH = HashingUtils::HashString("LEFT");
+        static constexpr int CENTERED_HASH = HashingUtils::CompileTimeHashString("CENTERED");
+        static constexpr int LEFT_HASH = HashingUtils::CompileTimeHashString("LEFT");
 
 
         DvbSubtitleAlignment GetDvbSubtitleAlignmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CENTERED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DvbSubtitleAlignment::CENTERED;
-          }
-          else if (hashCode == LEFT_HASH)
-          {
-            return DvbSubtitleAlignment::LEFT;
+          case CENTERED_HASH:
+            if (name == "CENTERED")
+            {
+              return DvbSubtitleAlignment::CENTERED;
+            }
+            break;
+          case LEFT_HASH:
+            if (name == "LEFT")
+            {
+              return DvbSubtitleAlignment::LEFT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DvbSubtitleAlignment::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubtitleAlignment(DvbSubtitleAlignment enumValue)
+        const char* GetNameForDvbSubtitleAlignment(DvbSubtitleAlignment enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace DvbSubtitleFontColorMapper
       {
 
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
+        static constexpr int WHITE_HASH = HashingUtils::CompileTimeHashString("WHITE");
+        static constexpr int BLACK_HASH = HashingUtils::CompileTimeHashString("BLACK");
+        static constexpr int YELLOW_HASH = HashingUtils::CompileTimeHashString("YELLOW");
+        static constexpr int RED_HASH = HashingUtils::CompileTimeHashString("RED");
+        static constexpr int GREEN_HASH = HashingUtils::CompileTimeHashString("GREEN");
+        static constexpr int BLUE_HASH = HashingUtils::CompileTimeHashString("BLUE");
 
 
         DvbSubtitleFontColor GetDvbSubtitleFontColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WHITE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DvbSubtitleFontColor::WHITE;
-          }
-          else if (hashCode == BLACK_HASH)
-          {
-            return DvbSubtitleFontColor::BLACK;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return DvbSubtitleFontColor::YELLOW;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return DvbSubtitleFontColor::RED;
-          }
-          else if (hashCode == GREEN_HASH)
-          {
-            return DvbSubtitleFontColor::GREEN;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return DvbSubtitleFontColor::BLUE;
+          case WHITE_HASH:
+            if (name == "WHITE")
+            {
+              return DvbSubtitleFontColor::WHITE;
+            }
+            break;
+          case BLACK_HASH:
+            if (name == "BLACK")
+            {
+              return DvbSubtitleFontColor::BLACK;
+            }
+            break;
+          case YELLOW_HASH:
+            if (name == "YELLOW")
+            {
+              return DvbSubtitleFontColor::YELLOW;
+            }
+            break;
+          case RED_HASH:
+            if (name == "RED")
+            {
+              return DvbSubtitleFontColor::RED;
+            }
+            break;
+          case GREEN_HASH:
+            if (name == "GREEN")
+            {
+              return DvbSubtitleFontColor::GREEN;
+            }
+            break;
+          case BLUE_HASH:
+            if (name == "BLUE")
+            {
+              return DvbSubtitleFontColor::BLUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return DvbSubtitleFontColor::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubtitleFontColor(DvbSubtitleFontColor enumValue)
+        const char* GetNameForDvbSubtitleFontColor(DvbSubtitleFontColor enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace DvbSubtitleOutlineColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
+        static constexpr int BLACK_HASH = HashingUtils::CompileTimeHashString("BLACK");
+        static constexpr int WHITE_HASH = HashingUtils::CompileTimeHashString("WHITE");
+        static constexpr int YELLOW_HASH = HashingUtils::CompileTimeHashString("YELLOW");
+        static constexpr int RED_HASH = HashingUtils::CompileTimeHashString("RED");
+        static constexpr int GREEN_HASH = HashingUtils::CompileTimeHashString("GREEN");
+        static constexpr int BLUE_HASH = HashingUtils::CompileTimeHashString("BLUE");
 
 
         DvbSubtitleOutlineColor GetDvbSubtitleOutlineColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DvbSubtitleOutlineColor::BLACK;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return DvbSubtitleOutlineColor::WHITE;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return DvbSubtitleOutlineColor::YELLOW;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return DvbSubtitleOutlineColor::RED;
-          }
-          else if (hashCode == GREEN_HASH)
-          {
-            return DvbSubtitleOutlineColor::GREEN;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return DvbSubtitleOutlineColor::BLUE;
+          case BLACK_HASH:
+            if (name == "BLACK")
+            {
+              return DvbSubtitleOutlineColor::BLACK;
+            }
+            break;
+          case WHITE_HASH:
+            if (name == "WHITE")
+            {
+              return DvbSubtitleOutlineColor::WHITE;
+            }
+            break;
+          case YELLOW_HASH:
+            if (name == "YELLOW")
+            {
+              return DvbSubtitleOutlineColor::YELLOW;
+            }
+            break;
+          case RED_HASH:
+            if (name == "RED")
+            {
+              return DvbSubtitleOutlineColor::RED;
+            }
+            break;
+          case GREEN_HASH:
+            if (name == "GREEN")
+            {
+              return DvbSubtitleOutlineColor::GREEN;
+            }
+            break;
+          case BLUE_HASH:
+            if (name == "BLUE")
+            {
+              return DvbSubtitleOutlineColor::BLUE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return DvbSubtitleOutlineColor::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubtitleOutlineColor(DvbSubtitleOutlineColor enumValue)
+        const char* GetNameForDvbSubtitleOutlineColor(DvbSubtitleOutlineColor enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace Eac3CodingModeMapper
       {
 
-        static const int CODING_MODE_1_0_HASH = HashingUtils::HashString("CODING_MODE_1_0");
-        static const int CODING_MODE_2_0_HASH = HashingUtils::HashString("CODING_MODE_2_0");
-        static const int CODING_MODE_3_2_HASH = HashingUtils::HashString("CODING_MODE_3_2");
+        static constexpr int CODING_MODE_1_0_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_1_0");
+        static constexpr int CODING_MODE_2_0_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_2_0");
+        static constexpr int CODING_MODE_3_2_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_3_2");
 
 
         Eac3CodingMode GetEac3CodingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODING_MODE_1_0_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3CodingMode::CODING_MODE_1_0;
-          }
-          else if (hashCode == CODING_MODE_2_0_HASH)
-          {
-            return Eac3CodingMode::CODING_MODE_2_0;
-          }
-          else if (hashCode == CODING_MODE_3_2_HASH)
-          {
-            return Eac3CodingMode::CODING_MODE_3_2;
+          case CODING_MODE_1_0_HASH:
+            if (name == "CODING_MODE_1_0")
+            {
+              return Eac3CodingMode::CODING_MODE_1_0;
+            }
+            break;
+          case CODING_MODE_2_0_HASH:
+            if (name == "CODING_MODE_2_0")
+            {
+              return Eac3CodingMode::CODING_MODE_2_0;
+            }
+            break;
+          case CODING_MODE_3_2_HASH:
+            if (name == "CODING_MODE_3_2")
+            {
+              return Eac3CodingMode::CODING_MODE_3_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Eac3CodingMode::NOT_SET;
         }
 
-        Aws::String GetNameForEac3CodingMode(Eac3CodingMode enumValue)
+        const char* GetNameForEac3CodingMode(Eac3CodingMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace Eac3DynamicRangeCompressionRfMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int FILM_STANDARD_HASH = HashingUtils::HashString("FILM_STANDARD");
-        static const int FILM_LIGHT_HASH = HashingUtils::HashString("FILM_LIGHT");
-        static const int MUSIC_STANDARD_HASH = HashingUtils::HashString("MUSIC_STANDARD");
-        static const int MUSIC_LIGHT_HASH = HashingUtils::HashString("MUSIC_LIGHT");
-        static const int SPEECH_HASH = HashingUtils::HashString("SPEECH");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int FILM_STANDARD_HASH = HashingUtils::CompileTimeHashString("FILM_STANDARD");
+        static constexpr int FILM_LIGHT_HASH = HashingUtils::CompileTimeHashString("FILM_LIGHT");
+        static constexpr int MUSIC_STANDARD_HASH = HashingUtils::CompileTimeHashString("MUSIC_STANDARD");
+        static constexpr int MUSIC_LIGHT_HASH = HashingUtils::CompileTimeHashString("MUSIC_LIGHT");
+        static constexpr int SPEECH_HASH = HashingUtils::CompileTimeHashString("SPEECH");
 
 
         Eac3DynamicRangeCompressionRf GetEac3DynamicRangeCompressionRfForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3DynamicRangeCompressionRf::NONE;
-          }
-          else if (hashCode == FILM_STANDARD_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::FILM_STANDARD;
-          }
-          else if (hashCode == FILM_LIGHT_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::FILM_LIGHT;
-          }
-          else if (hashCode == MUSIC_STANDARD_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::MUSIC_STANDARD;
-          }
-          else if (hashCode == MUSIC_LIGHT_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::MUSIC_LIGHT;
-          }
-          else if (hashCode == SPEECH_HASH)
-          {
-            return Eac3DynamicRangeCompressionRf::SPEECH;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return Eac3DynamicRangeCompressionRf::NONE;
+            }
+            break;
+          case FILM_STANDARD_HASH:
+            if (name == "FILM_STANDARD")
+            {
+              return Eac3DynamicRangeCompressionRf::FILM_STANDARD;
+            }
+            break;
+          case FILM_LIGHT_HASH:
+            if (name == "FILM_LIGHT")
+            {
+              return Eac3DynamicRangeCompressionRf::FILM_LIGHT;
+            }
+            break;
+          case MUSIC_STANDARD_HASH:
+            if (name == "MUSIC_STANDARD")
+            {
+              return Eac3DynamicRangeCompressionRf::MUSIC_STANDARD;
+            }
+            break;
+          case MUSIC_LIGHT_HASH:
+            if (name == "MUSIC_LIGHT")
+            {
+              return Eac3DynamicRangeCompressionRf::MUSIC_LIGHT;
+            }
+            break;
+          case SPEECH_HASH:
+            if (name == "SPEECH")
+            {
+              return Eac3DynamicRangeCompressionRf::SPEECH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return Eac3DynamicRangeCompressionRf::NOT_SET;
         }
 
-        Aws::String GetNameForEac3DynamicRangeCompressionRf(Eac3DynamicRangeCompressionRf enumValue)
+        const char* GetNameForEac3DynamicRangeCompressionRf(Eac3DynamicRangeCompressionRf enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Eac3PassthroughControlMapper
       {
 
-        static const int WHEN_POSSIBLE_HASH = HashingUtils::HashString("WHEN_POSSIBLE");
-        static const int NO_PASSTHROUGH_HASH = HashingUtils::HashString("NO_PASSTHROUGH");
+        static constexpr int WHEN_POSSIBLE_HASH = HashingUtils::CompileTimeHashString("WHEN_POSSIBLE");
+        static constexpr int NO_PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("NO_PASSTHROUGH");
 
 
         Eac3PassthroughControl GetEac3PassthroughControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WHEN_POSSIBLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3PassthroughControl::WHEN_POSSIBLE;
-          }
-          else if (hashCode == NO_PASSTHROUGH_HASH)
-          {
-            return Eac3PassthroughControl::NO_PASSTHROUGH;
+          case WHEN_POSSIBLE_HASH:
+            if (name == "WHEN_POSSIBLE")
+            {
+              return Eac3PassthroughControl::WHEN_POSSIBLE;
+            }
+            break;
+          case NO_PASSTHROUGH_HASH:
+            if (name == "NO_PASSTHROUGH")
+            {
+              return Eac3PassthroughControl::NO_PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Eac3PassthroughControl::NOT_SET;
         }
 
-        Aws::String GetNameForEac3PassthroughControl(Eac3PassthroughControl enumValue)
+        const char* GetNameForEac3PassthroughControl(Eac3PassthroughControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
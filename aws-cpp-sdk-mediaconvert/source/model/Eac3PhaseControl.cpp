@@ -30,20 +30,30 @@ namespace Aws
       namespace Eac3PhaseControlMapper
       {
 
-        static const int SHIFT_90_DEGREES_HASH = HashingUtils::HashString("SHIFT_90_DEGREES");
-        static const int NO_SHIFT_HASH = HashingUtils::HashString("NO_SHIFT");
+        static constexpr int SHIFT_90_DEGREES_HASH = HashingUtils::CompileTimeHashString("SHIFT_90_DEGREES");
+        static constexpr int NO_SHIFT_HASH = HashingUtils::CompileTimeHashString("NO_SHIFT");
 
 
         Eac3PhaseControl GetEac3PhaseControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SHIFT_90_DEGREES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3PhaseControl::SHIFT_90_DEGREES;
-          }
-          else if (hashCode == NO_SHIFT_HASH)
-          {
-            return Eac3PhaseControl::NO_SHIFT;
+          case SHIFT_90_DEGREES_HASH:
+            if (name == "SHIFT_90_DEGREES")
+            {
+              return Eac3PhaseControl::SHIFT_90_DEGREES;
+            }
+            break;
+          case NO_SHIFT_HASH:
+            if (name == "NO_SHIFT")
+            {
+              return Eac3PhaseControl::NO_SHIFT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Eac3PhaseControl::NOT_SET;
         }
 
-        Aws::String GetNameForEac3PhaseControl(Eac3PhaseControl enumValue)
+        const char* GetNameForEac3PhaseControl(Eac3PhaseControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
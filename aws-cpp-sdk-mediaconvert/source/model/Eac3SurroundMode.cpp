@@ -30,25 +30,37 @@ namespace Aws
       namespace Eac3SurroundModeMapper
       {
 
-        static const int NOT_INDICATED_HASH = HashingUtils::HashString("NOT_INDICATED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        static constexpr int NOT_INDICATED_HASH = HashingUtils::CompileTimeHashString("NOT_INDICATED");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
 
 
         Eac3SurroundMode GetEac3SurroundModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_INDICATED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3SurroundMode::NOT_INDICATED;
-          }
-          else if (hashCode == ENABLED_HASH)
-          {
-            return Eac3SurroundMode::ENABLED;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return Eac3SurroundMode::DISABLED;
+          case NOT_INDICATED_HASH:
+            if (name == "NOT_INDICATED")
+            {
+              return Eac3SurroundMode::NOT_INDICATED;
+            }
+            break;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return Eac3SurroundMode::ENABLED;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return Eac3SurroundMode::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Eac3SurroundMode::NOT_SET;
         }
 
-        Aws::String GetNameForEac3SurroundMode(Eac3SurroundMode enumValue)
+        const char* GetNameForEac3SurroundMode(Eac3SurroundMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace EmbeddedConvert608To708Mapper
       {
 
-        static const int UPCONVERT_HASH = HashingUtils::HashString("UPCONVERT");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        static constexpr int UPCONVERT_HASH = HashingUtils::CompileTimeHashString("UPCONVERT");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
 
 
         EmbeddedConvert608To708 GetEmbeddedConvert608To708ForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UPCONVERT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EmbeddedConvert608To708::UPCONVERT;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return EmbeddedConvert608To708::DISABLED;
+          case UPCONVERT_HASH:
+            if (name == "UPCONVERT")
+            {
+              return EmbeddedConvert608To708::UPCONVERT;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return EmbeddedConvert608To708::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EmbeddedConvert608To708::NOT_SET;
         }
 
-        Aws::String GetNameForEmbeddedConvert608To708(EmbeddedConvert608To708 enumValue)
+        const char* GetNameForEmbeddedConvert608To708(EmbeddedConvert608To708 enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace F4vMoovPlacementMapper
       {
 
-        static const int PROGRESSIVE_DOWNLOAD_HASH = HashingUtils::HashString("PROGRESSIVE_DOWNLOAD");
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
+        static constexpr int PROGRESSIVE_DOWNLOAD_HASH = HashingUtils::CompileTimeHashString("PROGRESSIVE_DOWNLOAD");
+        static constexpr int NORMAL_HASH = HashingUtils::CompileTimeHashString("NORMAL");
 
 
         F4vMoovPlacement GetF4vMoovPlacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROGRESSIVE_DOWNLOAD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return F4vMoovPlacement::PROGRESSIVE_DOWNLOAD;
-          }
-          else if (hashCode == NORMAL_HASH)
-          {
-            return F4vMoovPlacement::NORMAL;
+          case PROGRESSIVE_DOWNLOAD_HASH:
+            if (name == "PROGRESSIVE_DOWNLOAD")
+            {
+              return F4vMoovPlacement::PROGRESSIVE_DOWNLOAD;
+            }
+            break;
+          case NORMAL_HASH:
+            if (name == "NORMAL")
+            {
+              return F4vMoovPlacement::NORMAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return F4vMoovPlacement::NOT_SET;
         }
 
-        Aws::String GetNameForF4vMoovPlacement(F4vMoovPlacement enumValue)
+        const char* GetNameForF4vMoovPlacement(F4vMoovPlacement enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace FileSourceConvert608To708Mapper
       {
 
-        static const int UPCONVERT_HASH = HashingUtils::HashString("UPCONVERT");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        static constexpr int UPCONVERT_HASH = HashingUtils::CompileTimeHashString("UPCONVERT");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
 
 
         FileSourceConvert608To708 GetFileSourceConvert608To708ForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UPCONVERT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FileSourceConvert608To708::UPCONVERT;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return FileSourceConvert608To708::DISABLED;
+          case UPCONVERT_HASH:
+            if (name == "UPCONVERT")
+            {
+              return FileSourceConvert608To708::UPCONVERT;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return FileSourceConvert608To708::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FileSourceConvert608To708::NOT_SET;
         }
 
-        Aws::String GetNameForFileSourceConvert608To708(FileSourceConvert608To708 enumValue)
+        const char* GetNameForFileSourceConvert608To708(FileSourceConvert608To708 enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace H264AdaptiveQuantizationMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int HIGHER_HASH = HashingUtils::HashString("HIGHER");
-        static const int MAX_HASH = HashingUtils::HashString("MAX");
+        static constexpr int OFF_HASH = HashingUtils::CompileTimeHashString("OFF");
+        static constexpr int LOW_HASH = HashingUtils::CompileTimeHashString("LOW");
+        static constexpr int MEDIUM_HASH = HashingUtils::CompileTimeHashString("MEDIUM");
+        static constexpr int HIGH_HASH = HashingUtils::CompileTimeHashString("HIGH");
+        static constexpr int HIGHER_HASH = HashingUtils::CompileTimeHashString("HIGHER");
+        static constexpr int MAX_HASH = HashingUtils::CompileTimeHashString("MAX");
 
 
         H264AdaptiveQuantization GetH264AdaptiveQuantizationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264AdaptiveQuantization::OFF;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return H264AdaptiveQuantization::LOW;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return H264AdaptiveQuantization::MEDIUM;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return H264AdaptiveQuantization::HIGH;
-          }
-          else if (hashCode == HIGHER_HASH)
-          {
-            return H264AdaptiveQuantization::HIGHER;
-          }
-          else if (hashCode == MAX_HASH)
-          {
-            return H264AdaptiveQuantization::MAX;
+          case OFF_HASH:
+            if (name == "OFF")
+            {
+              return H264AdaptiveQuantization::OFF;
+            }
+            break;
+          case LOW_HASH:
+            if (name == "LOW")
+            {
+              return H264AdaptiveQuantization::LOW;
+            }
+            break;
+          case MEDIUM_HASH:
+            if (name == "MEDIUM")
+            {
+              return H264AdaptiveQuantization::MEDIUM;
+            }
+            break;
+          case HIGH_HASH:
+            if (name == "HIGH")
+            {
+              return H264AdaptiveQuantization::HIGH;
+            }
+            break;
+          case HIGHER_HASH:
+            if (name == "HIGHER")
+            {
+              return H264AdaptiveQuantization::HIGHER;
+            }
+            break;
+          case MAX_HASH:
+            if (name == "MAX")
+            {
+              return H264AdaptiveQuantization::MAX;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return H264AdaptiveQuantization::NOT_SET;
         }
 
-        Aws::String GetNameForH264AdaptiveQuantization(H264AdaptiveQuantization enumValue)
+        const char* GetNameForH264AdaptiveQuantization(H264AdaptiveQuantization enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,95 +30,135 @@ namespace Aws
       namespace H264CodecLevelMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int LEVEL_1_HASH = HashingUtils::HashString("LEVEL_1");
-        static const int LEVEL_1_1_HASH = HashingUtils::HashString("LEVEL_1_1");
-        static const int LEVEL_1_2_HASH = HashingUtils::HashString("LEVEL_1_2");
-        static const int LEVEL_1_3_HASH = HashingUtils::HashString("LEVEL_1_3");
-        static const int LEVEL_2_HASH = HashingUtils::HashString("LEVEL_2");
-        static const int LEVEL_2_1_HASH = HashingUtils::HashString("LEVEL_2_1");
-        static const int LEVEL_2_2_HASH = HashingUtils::HashString("LEVEL_2_2");
-        static const int LEVEL_3_HASH = HashingUtils::HashString("LEVEL_3");
-        static const int LEVEL_3_1_HASH = HashingUtils::HashString("LEVEL_3_1");
-        static const int LEVEL_3_2_HASH = HashingUtils::HashString("LEVEL_3_2");
-        static const int LEVEL_4_HASH = HashingUtils::HashString("LEVEL_4");
-        static const int LEVEL_4_1_HASH = HashingUtils::HashString("LEVEL_4_1");
-        static const int LEVEL_4_2_HASH = HashingUtils::HashString("LEVEL_4_2");
-        static const int LEVEL_5_HASH = HashingUtils::HashString("LEVEL_5");
-        static const int LEVEL_5_1_HASH = HashingUtils::HashString("LEVEL_5_1");
-        static const int LEVEL_5_2_HASH = HashingUtils::HashString("LEVEL_5_2");
+        static constexpr int AUTO_HASH = HashingUtils::CompileTimeHashString("AUTO");
+        static constexpr int LEVEL_1_HASH = HashingUtils::CompileTimeHashString("LEVEL_1");
+        static constexpr int LEVEL_1_1_HASH = HashingUtils::CompileTimeHashString("LEVEL_1_1");
+        static constexpr int LEVEL_1_2_HASH = HashingUtils::CompileTimeHashString("LEVEL_1_2");
+        static constexpr int LEVEL_1_3_HASH = HashingUtils::CompileTimeHashString("LEVEL_1_3");
+        static constexpr int LEVEL_2_HASH = HashingUtils::CompileTimeHashString("LEVEL_2");
+        static constexpr int LEVEL_2_1_HASH = HashingUtils::CompileTimeHashString("LEVEL_2_1");
+        static constexpr int LEVEL_2_2_HASH = HashingUtils::CompileTimeHashString("LEVEL_2_2");
+        static constexpr int LEVEL_3_HASH = HashingUtils::CompileTimeHashString("LEVEL_3");
+        static constexpr int LEVEL_3_1_HASH = HashingUtils::CompileTimeHashString("LEVEL_3_1");
+        static constexpr int LEVEL_3_2_HASH = HashingUtils::CompileTimeHashString("LEVEL_3_2");
+        static constexpr int LEVEL_4_HASH = HashingUtils::CompileTimeHashString("LEVEL_4");
+        static constexpr int LEVEL_4_1_HASH = HashingUtils::CompileTimeHashString("LEVEL_4_1");
+        static constexpr int LEVEL_4_2_HASH = HashingUtils::CompileTimeHashString("LEVEL_4_2");
+        static constexpr int LEVEL_5_HASH = HashingUtils::CompileTimeHashString("LEVEL_5");
+        static constexpr int LEVEL_5_1_HASH = HashingUtils::CompileTimeHashString("LEVEL_5_1");
+        static constexpr int LEVEL_5_2_HASH = HashingUtils::CompileTimeHashString("LEVEL_5_2");
 
 
         H264CodecLevel GetH264CodecLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264CodecLevel::AUTO;
-          }
-          else if (hashCode == LEVEL_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_1;
-          }
-          else if (hashCode == LEVEL_1_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_1_1;
-          }
-          else if (hashCode == LEVEL_1_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_1_2;
-          }
-          else if (hashCode == LEVEL_1_3_HASH)
-          {
-            return H264CodecLevel::LEVEL_1_3;
-          }
-          else if (hashCode == LEVEL_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_2;
-          }
-          else if (hashCode == LEVEL_2_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_2_1;
-          }
-          else if (hashCode == LEVEL_2_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_2_2;
-          }
-          else if (hashCode == LEVEL_3_HASH)
-          {
-            return H264CodecLevel::LEVEL_3;
-          }
-          else if (hashCode == LEVEL_3_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_3_1;
-          }
-          else if (hashCode == LEVEL_3_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_3_2;
-          }
-          else if (hashCode == LEVEL_4_HASH)
-          {
-            return H264CodecLevel::LEVEL_4;
-          }
-          else if (hashCode == LEVEL_4_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_4_1;
-          }
-          else if (hashCode == LEVEL_4_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_4_2;
-          }
-          else if (hashCode == LEVEL_5_HASH)
-          {
-            return H264CodecLevel::LEVEL_5;
-          }
-          else if (hashCode == LEVEL_5_1_HASH)
-          {
-            return H264CodecLevel::LEVEL_5_1;
-          }
-          else if (hashCode == LEVEL_5_2_HASH)
-          {
-            return H264CodecLevel::LEVEL_5_2;
+          case AUTO_HASH:
+            if (name == "AUTO")
+            {
+              return H264CodecLevel::AUTO;
+            }
+            break;
+          case LEVEL_1_HASH:
+            if (name == "LEVEL_1")
+            {
+              return H264CodecLevel::LEVEL_1;
+            }
+            break;
+          case LEVEL_1_1_HASH:
+            if (name == "LEVEL_1_1")
+            {
+              return H264CodecLevel::LEVEL_1_1;
+            }
+            break;
+          case LEVEL_1_2_HASH:
+            if (name == "LEVEL_1_2")
+            {
+              return H264CodecLevel::LEVEL_1_2;
+            }
+            break;
+          case LEVEL_1_3_HASH:
+            if (name == "LEVEL_1_3")
+            {
+              return H264CodecLevel::LEVEL_1_3;
+            }
+            break;
+          case LEVEL_2_HASH:
+            if (name == "LEVEL_2")
+            {
+              return H264CodecLevel::LEVEL_2;
+            }
+            break;
+          case LEVEL_2_1_HASH:
+            if (name == "LEVEL_2_1")
+            {
+              return H264CodecLevel::LEVEL_2_1;
+            }
+            break;
+          case LEVEL_2_2_HASH:
+            if (name == "LEVEL_2_2")
+            {
+              return H264CodecLevel::LEVEL_2_2;
+            }
+            break;
+          case LEVEL_3_HASH:
+            if (name == "LEVEL_3")
+            {
+              return H264CodecLevel::LEVEL_3;
+            }
+            break;
+          case LEVEL_3_1_HASH:
+            if (name == "LEVEL_3_1")
+            {
+              return H264CodecLevel::LEVEL_3_1;
+            }
+            break;
+          case LEVEL_3_2_HASH:
+            if (name == "LEVEL_3_2")
+            {
+              return H264CodecLevel::LEVEL_3_2;
+            }
+            break;
+          case LEVEL_4_HASH:
+            if (name == "LEVEL_4")
+            {
+              return H264CodecLevel::LEVEL_4;
+            }
+            break;
+          case LEVEL_4_1_HASH:
+            if (name == "LEVEL_4_1")
+            {
+              return H264CodecLevel::LEVEL_4_1;
+            }
+            break;
+          case LEVEL_4_2_HASH:
+            if (name == "LEVEL_4_2")
+            {
+              return H264CodecLevel::LEVEL_4_2;
+            }
+            break;
+          case LEVEL_5_HASH:
+            if (name == "LEVEL_5")
+            {
+              return H264CodecLevel::LEVEL_5;
+            }
+            break;
+          case LEVEL_5_1_HASH:
+            if (name == "LEVEL_5_1")
+            {
+              return H264CodecLevel::LEVEL_5_1;
+            }
+            break;
+          case LEVEL_5_2_HASH:
+            if (name == "LEVEL_5_2")
+            {
+              return H264CodecLevel::LEVEL_5_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,7 +170,7 @@ namespace Aws
           return H264CodecLevel::NOT_SET;
         }
 
-        Aws::String GetNameForH264CodecLevel(H264CodecLevel enumValue)
+        const char* GetNameForH264CodecLevel(H264CodecLevel enumValue)
         {
           switch(enumValue)
           {
@@ -172,7 +212,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace H264CodecProfileMapper
       {
 
-        static const int BASELINE_HASH = HashingUtils::HashString("BASELINE");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int HIGH_10BIT_HASH = HashingUtils::HashString("HIGH_10BIT");
-        static const int HIGH_422_HASH = HashingUtils::HashString("HIGH_422");
-        static const int HIGH_422_10BIT_HASH = HashingUtils::HashString("HIGH_422_10BIT");
-        static const int MAIN_HASH = HashingUtils::HashString("MAIN");
+        static constexpr int BASELINE_HASH = HashingUtils::CompileTimeHashString("BASELINE");
+        static constexpr int HIGH_HASH = HashingUtils::CompileTimeHashString("HIGH");
+        static constexpr int HIGH_10BIT_HASH = HashingUtils::CompileTimeHashString("HIGH_10BIT");
+        static constexpr int HIGH_422_HASH = HashingUtils::CompileTimeHashString("HIGH_422");
+        static constexpr int HIGH_422_10BIT_HASH = HashingUtils::CompileTimeHashString("HIGH_422_10BIT");
+        static constexpr int MAIN_HASH = HashingUtils::CompileTimeHashString("MAIN");
 
 
         H264CodecProfile GetH264CodecProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BASELINE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264CodecProfile::BASELINE;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return H264CodecProfile::HIGH;
-          }
-          else if (hashCode == HIGH_10BIT_HASH)
-          {
-            return H264CodecProfile::HIGH_10BIT;
-          }
-          else if (hashCode == HIGH_422_HASH)
-          {
-            return H264CodecProfile::HIGH_422;
-          }
-          else if (hashCode == HIGH_422_10BIT_HASH)
-          {
-            return H264CodecProfile::HIGH_422_10BIT;
-          }
-          else if (hashCode == MAIN_HASH)
-          {
-            return H264CodecProfile::MAIN;
+          case BASELINE_HASH:
+            if (name == "BASELINE")
+            {
+              return H264CodecProfile::BASELINE;
+            }
+            break;
+          case HIGH_HASH:
+            if (name == "HIGH")
+            {
+              return H264CodecProfile::HIGH;
+            }
+            break;
+          case HIGH_10BIT_HASH:
+            if (name == "HIGH_10BIT")
+            {
+              return H264CodecProfile::HIGH_10BIT;
+            }
+            break;
+          case HIGH_422_HASH:
+            if (name == "HIGH_422")
+            {
+              return H264CodecProfile::HIGH_422;
+            }
+            break;
+          case HIGH_422_10BIT_HASH:
+            if (name == "HIGH_422_10BIT")
+            {
+              return H264CodecProfile::HIGH_422_10BIT;
+            }
+            break;
+          case MAIN_HASH:
+            if (name == "MAIN")
+            {
+              return H264CodecProfile::MAIN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return H264CodecProfile::NOT_SET;
         }
 
-        Aws::String GetNameForH264CodecProfile(H264CodecProfile enumValue)
+        const char* GetNameForH264CodecProfile(H264CodecProfile enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace H264DynamicSubGopMapper
       {
 
-        static const int ADAPTIVE_HASH = HashingUtils::HashString("ADAPTIVE");
-        static const int STATIC__HASH = HashingUtils::HashString("STATIC");
+        static constexpr int ADAPTIVE_HASH = HashingUtils::CompileTimeHashString("ADAPTIVE");
+        static constexpr int STATIC__HASH = HashingUtils::CompileTimeHashString("STATIC");
 
 
         H264DynamicSubGop GetH264DynamicSubGopForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADAPTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264DynamicSubGop::ADAPTIVE;
-          }
-          else if (hashCode == STATIC__HASH)
-          {
-            return H264DynamicSubGop::STATIC_;
+          case ADAPTIVE_HASH:
+            if (name == "ADAPTIVE")
+            {
+              return H264DynamicSubGop::ADAPTIVE;
+            }
+            break;
+          case STATIC__HASH:
+            if (name == "STATIC")
+            {
+              return H264DynamicSubGop::STATIC_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264DynamicSubGop::NOT_SET;
         }
 
-        Aws::String GetNameForH264DynamicSubGop(H264DynamicSubGop enumValue)
+        const char* GetNameForH264DynamicSubGop(H264DynamicSubGop enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
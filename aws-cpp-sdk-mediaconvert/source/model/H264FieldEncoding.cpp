@@ -30,20 +30,30 @@ namespace Aws
       namespace H264FieldEncodingMapper
       {
 
-        static const int PAFF_HASH = HashingUtils::HashString("PAFF");
-        static const int FORCE_FIELD_HASH = HashingUtils::HashString("FORCE_FIELD");
+        static constexpr int PAFF_HASH = HashingUtils::CompileTimeHashString("PAFF");
+        static constexpr int FORCE_FIELD_HASH = HashingUtils::CompileTimeHashString("FORCE_FIELD");
 
 
         H264FieldEncoding GetH264FieldEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PAFF_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264FieldEncoding::PAFF;
-          }
-          else if (hashCode == FORCE_FIELD_HASH)
-          {
-            return H264FieldEncoding::FORCE_FIELD;
+          case PAFF_HASH:
+            if (name == "PAFF")
+            {
+              return H264FieldEncoding::PAFF;
+            }
+            break;
+          case FORCE_FIELD_HASH:
+            if (name == "FORCE_FIELD")
+            {
+              return H264FieldEncoding::FORCE_FIELD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264FieldEncoding::NOT_SET;
         }
 
-        Aws::String GetNameForH264FieldEncoding(H264FieldEncoding enumValue)
+        const char* GetNameForH264FieldEncoding(H264FieldEncoding enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
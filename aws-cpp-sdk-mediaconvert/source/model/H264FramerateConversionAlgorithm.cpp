@@ -30,20 +30,30 @@ namespace Aws
       namespace H264FramerateConversionAlgorithmMapper
       {
 
-        static const int DUPLICATE_DROP_HASH = HashingUtils::HashString("DUPLICATE_DROP");
-        static const int INTERPOLATE_HASH = HashingUtils::HashString("INTERPOLATE");
+        static constexpr int DUPLICATE_DROP_HASH = HashingUtils::CompileTimeHashString("DUPLICATE_DROP");
+        static constexpr int INTERPOLATE_HASH = HashingUtils::CompileTimeHashString("INTERPOLATE");
 
 
         H264FramerateConversionAlgorithm GetH264FramerateConversionAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DUPLICATE_DROP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264FramerateConversionAlgorithm::DUPLICATE_DROP;
-          }
-          else if (hashCode == INTERPOLATE_HASH)
-          {
-            return H264FramerateConversionAlgorithm::INTERPOLATE;
+          case DUPLICATE_DROP_HASH:
+            if (name == "DUPLICATE_DROP")
+            {
+              return H264FramerateConversionAlgorithm::DUPLICATE_DROP;
+            }
+            break;
+          case INTERPOLATE_HASH:
+            if (name == "INTERPOLATE")
+            {
+              return H264FramerateConversionAlgorithm::INTERPOLATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264FramerateConversionAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForH264FramerateConversionAlgorithm(H264FramerateConversionAlgorithm enumValue)
+        const char* GetNameForH264FramerateConversionAlgorithm(H264FramerateConversionAlgorithm enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace H264RateControlModeMapper
       {
 
-        static const int VBR_HASH = HashingUtils::HashString("VBR");
-        static const int CBR_HASH = HashingUtils::HashString("CBR");
-        static const int QVBR_HASH = HashingUtils::HashString("QVBR");
+        static constexpr int VBR_HASH = HashingUtils::CompileTimeHashString("VBR");
+        static constexpr int CBR_HASH = HashingUtils::CompileTimeHashString("CBR");
+        static constexpr int QVBR_HASH = HashingUtils::CompileTimeHashString("QVBR");
 
 
         H264RateControlMode GetH264RateControlModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VBR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264RateControlMode::VBR;
-          }
-          else if (hashCode == CBR_HASH)
-          {
-            return H264RateControlMode::CBR;
-          }
-          else if (hashCode == QVBR_HASH)
-          {
-            return H264RateControlMode::QVBR;
+          case VBR_HASH:
+            if (name == "VBR")
+            {
+              return H264RateControlMode::VBR;
+            }
+            break;
+          case CBR_HASH:
+            if (name == "CBR")
+            {
+              return H264RateControlMode::CBR;
+            }
+            break;
+          case QVBR_HASH:
+            if (name == "QVBR")
+            {
+              return H264RateControlMode::QVBR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return H264RateControlMode::NOT_SET;
         }
 
-        Aws::String GetNameForH264RateControlMode(H264RateControlMode enumValue)
+        const char* GetNameForH264RateControlMode(H264RateControlMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace H264SceneChangeDetectMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
 
 
         H264SceneChangeDetect GetH264SceneChangeDetectForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264SceneChangeDetect::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
-          {
-            return H264SceneChangeDetect::ENABLED;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return H264SceneChangeDetect::DISABLED;
+            }
+            break;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return H264SceneChangeDetect::ENABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264SceneChangeDetect::NOT_SET;
         }
 
-        Aws::String GetNameForH264SceneChangeDetect(H264SceneChangeDetect enumValue)
+        const char* GetNameForH264SceneChangeDetect(H264SceneChangeDetect enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace H265CodecProfileMapper
       {
 
-        static const int MAIN_MAIN_HASH = HashingUtils::HashString("MAIN_MAIN");
-        static const int MAIN_HIGH_HASH = HashingUtils::HashString("MAIN_HIGH");
-        static const int MAIN10_MAIN_HASH = HashingUtils::HashString("MAIN10_MAIN");
-        static const int MAIN10_HIGH_HASH = HashingUtils::HashString("MAIN10_HIGH");
-        static const int MAIN_422_8BIT_MAIN_HASH = HashingUtils::HashString("MAIN_422_8BIT_MAIN");
-        static const int MAIN_422_8BIT_HIGH_HASH = HashingUtils::HashString("MAIN_422_8BIT_HIGH");
-        static const int MAIN_422_10BIT_MAIN_HASH = HashingUtils::HashString("MAIN_422_10BIT_MAIN");
-        static const int MAIN_422_10BIT_HIGH_HASH = HashingUtils::HashString("MAIN_422_10BIT_HIGH");
+        static constexpr int MAIN_MAIN_HASH = HashingUtils::CompileTimeHashString("MAIN_MAIN");
+        static constexpr int MAIN_HIGH_HASH = HashingUtils::CompileTimeHashString("MAIN_HIGH");
+        static constexpr int MAIN10_MAIN_HASH = HashingUtils::CompileTimeHashString("MAIN10_MAIN");
+        static constexpr int MAIN10_HIGH_HASH = HashingUtils::CompileTimeHashString("MAIN10_HIGH");
+        static constexpr int MAIN_422_8BIT_MAIN_HASH = HashingUtils::CompileTimeHashString("MAIN_422_8BIT_MAIN");
+        static constexpr int MAIN_422_8BIT_HIGH_HASH = HashingUtils::CompileTimeHashString("MAIN_422_8BIT_HIGH");
+        static constexpr int MAIN_422_10BIT_MAIN_HASH = HashingUtils::CompileTimeHashString("MAIN_422_10BIT_MAIN");
+        static constexpr int MAIN_422_10BIT_HIGH_HASH = HashingUtils::CompileTimeHashString("MAIN_422_10BIT_HIGH");
 
 
         H265CodecProfile GetH265CodecProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAIN_MAIN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H265CodecProfile::MAIN_MAIN;
-          }
-          else if (hashCode == MAIN_HIGH_HASH)
-          {
-            return H265CodecProfile::MAIN_HIGH;
-          }
-          else if (hashCode == MAIN10_MAIN_HASH)
-          {
-            return H265CodecProfile::MAIN10_MAIN;
-          }
-          else if (hashCode == MAIN10_HIGH_HASH)
-          {
-            return H265CodecProfile::MAIN10_HIGH;
-          }
-          else if (hashCode == MAIN_422_8BIT_MAIN_HASH)
-          {
-            return H265CodecProfile::MAIN_422_8BIT_MAIN;
-          }
-          else if (hashCode == MAIN_422_8BIT_HIGH_HASH)
-          {
-            return H265CodecProfile::MAIN_422_8BIT_HIGH;
-          }
-          else if (hashCode == MAIN_422_10BIT_MAIN_HASH)
-          {
-            return H265CodecProfile::MAIN_422_10BIT_MAIN;
-          }
-          else if (hashCode == MAIN_422_10BIT_HIGH_HASH)
-          {
-            return H265CodecProfile::MAIN_422_10BIT_HIGH;
+          case MAIN_MAIN_HASH:
+            if (name == "MAIN_MAIN")
+            {
+              return H265CodecProfile::MAIN_MAIN;
+            }
+            break;
+          case MAIN_HIGH_HASH:
+            if (name == "MAIN_HIGH")
+            {
+              return H265CodecProfile::MAIN_HIGH;
+            }
+            break;
+          case MAIN10_MAIN_HASH:
+            if (name == "MAIN10_MAIN")
+            {
+              return H265CodecProfile::MAIN10_MAIN;
+            }
+            break;
+          case MAIN10_HIGH_HASH:
+            if (name == "MAIN10_HIGH")
+            {
+              return H265CodecProfile::MAIN10_HIGH;
+            }
+            break;
+          case MAIN_422_8BIT_MAIN_HASH:
+            if (name == "MAIN_422_8BIT_MAIN")
+            {
+              return H265CodecProfile::MAIN_422_8BIT_MAIN;
+            }
+            break;
+          case MAIN_422_8BIT_HIGH_HASH:
+            if (name == "MAIN_422_8BIT_HIGH")
+            {
+              return H265CodecProfile::MAIN_422_8BIT_HIGH;
+            }
+            break;
+          case MAIN_422_10BIT_MAIN_HASH:
+            if (name == "MAIN_422_10BIT_MAIN")
+            {
+              return H265CodecProfile::MAIN_422_10BIT_MAIN;
+            }
+            break;
+          case MAIN_422_10BIT_HIGH_HASH:
+            if (name == "MAIN_422_10BIT_HIGH")
+            {
+              return H265CodecProfile::MAIN_422_10BIT_HIGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return H265CodecProfile::NOT_SET;
         }
 
-        Aws::String GetNameForH265CodecProfile(H265CodecProfile enumValue)
+        const char* GetNameForH265CodecProfile(H265CodecProfile enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace H265FramerateControlMapper
       {
 
-        static const int INITIALIZE_FROM_SOURCE_HASH = HashingUtils::HashString("INITIALIZE_FROM_SOURCE");
-        static const int SPECIFIED_HASH = HashingUtils::HashString("SPECIFIED");
+        static constexpr int INITIALIZE_FROM_SOURCE_HASH = HashingUtils::CompileTimeHashString("INITIALIZE_FROM_SOURCE");
+        static constexpr int SPECIFIED_HASH = HashingUtils::CompileTimeHashString("SPECIFIED");
 
 
         H265FramerateControl GetH265FramerateControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZE_FROM_SOURCE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H265FramerateControl::INITIALIZE_FROM_SOURCE;
-          }
-          else if (hashCode == SPECIFIED_HASH)
-          {
-            return H265FramerateControl::SPECIFIED;
+          case INITIALIZE_FROM_SOURCE_HASH:
+            if (name == "INITIALIZE_FROM_SOURCE")
+            {
+              return H265FramerateControl::INITIALIZE_FROM_SOURCE;
+            }
+            break;
+          case SPECIFIED_HASH:
+            if (name == "SPECIFIED")
+            {
+              return H265FramerateControl::SPECIFIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H265FramerateControl::NOT_SET;
         }
 
-        Aws::String GetNameForH265FramerateControl(H265FramerateControl enumValue)
+        const char* GetNameForH265FramerateControl(H265FramerateControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace H265FramerateConversionAlgorithmMapper
       {
 
-        static const int DUPLICATE_DROP_HASH = HashingUtils::HashString("DUPLICATE_DROP");
-        static const int INTERPOLATE_HASH = HashingUtils::HashString("INTERPOLATE");
+        static constexpr int DUPLICATE_DROP_HASH = HashingUtils::CompileTimeHashString("DUPLICATE_DROP");
+        static constexpr int INTERPOLATE_HASH = HashingUtils::CompileTimeHashString("INTERPOLATE");
 
 
         H265FramerateConversionAlgorithm GetH265FramerateConversionAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DUPLICATE_DROP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H265FramerateConversionAlgorithm::DUPLICATE_DROP;
-          }
-          else if (hashCode == INTERPOLATE_HASH)
-          {
-            return H265FramerateConversionAlgorithm::INTERPOLATE;
+          case DUPLICATE_DROP_HASH:
+            if (name == "DUPLICATE_DROP")
+            {
+              return H265FramerateConversionAlgorithm::DUPLICATE_DROP;
+            }
+            break;
+          case INTERPOLATE_HASH:
+            if (name == "INTERPOLATE")
+            {
+              return H265FramerateConversionAlgorithm::INTERPOLATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H265FramerateConversionAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForH265FramerateConversionAlgorithm(H265FramerateConversionAlgorithm enumValue)
+        const char* GetNameForH265FramerateConversionAlgorithm(H265FramerateConversionAlgorithm enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
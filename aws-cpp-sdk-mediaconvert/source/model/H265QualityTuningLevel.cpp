@@ -30,25 +30,37 @@ namespace Aws
       namespace H265QualityTuningLevelMapper
       {
 
-        static const int SINGLE_PASS_HASH = HashingUtils::HashString("SINGLE_PASS");
-        static const int SINGLE_PASS_HQ_HASH = HashingUtils::HashString("SINGLE_PASS_HQ");
-        static const int MULTI_PASS_HQ_HASH = HashingUtils::HashString("MULTI_PASS_HQ");
+        static constexpr int SINGLE_PASS_HASH = HashingUtils::CompileTimeHashString("SINGLE_PASS");
+        static constexpr int SINGLE_PASS_HQ_HASH = HashingUtils::CompileTimeHashString("SINGLE_PASS_HQ");
+        static constexpr int MULTI_PASS_HQ_HASH = HashingUtils::CompileTimeHashString("MULTI_PASS_HQ");
 
 
         H265QualityTuningLevel GetH265QualityTuningLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_PASS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H265QualityTuningLevel::SINGLE_PASS;
-          }
-          else if (hashCode == SINGLE_PASS_HQ_HASH)
-          {
-            return H265QualityTuningLevel::SINGLE_PASS_HQ;
-          }
-          else if (hashCode == MULTI_PASS_HQ_HASH)
-          {
-            return H265QualityTuningLevel::MULTI_PASS_HQ;
+          case SINGLE_PASS_HASH:
+            if (name == "SINGLE_PASS")
+            {
+              return H265QualityTuningLevel::SINGLE_PASS;
+            }
+            break;
+          case SINGLE_PASS_HQ_HASH:
+            if (name == "SINGLE_PASS_HQ")
+            {
+              return H265QualityTuningLevel::SINGLE_PASS_HQ;
+            }
+            break;
+          case MULTI_PASS_HQ_HASH:
+            if (name == "MULTI_PASS_HQ")
+            {
+              return H265QualityTuningLevel::MULTI_PASS_HQ;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return H265QualityTuningLevel::NOT_SET;
         }
 
-        Aws::String GetNameForH265QualityTuningLevel(H265QualityTuningLevel enumValue)
+        const char* GetNameForH265QualityTuningLevel(H265QualityTuningLevel enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
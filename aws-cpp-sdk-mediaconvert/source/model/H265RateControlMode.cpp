@@ -30,25 +30,37 @@ namespace Aws
       namespace H265RateControlModeMapper
       {
 
-        static const int VBR_HASH = HashingUtils::HashString("VBR");
-        static const int CBR_HASH = HashingUtils::HashString("CBR");
-        static const int QVBR_HASH = HashingUtils::HashString("QVBR");
+        static constexpr int VBR_HASH = HashingUtils::CompileTimeHashString("VBR");
+        static constexpr int CBR_HASH = HashingUtils::CompileTimeHashString("CBR");
+        static constexpr int QVBR_HASH = HashingUtils::CompileTimeHashString("QVBR");
 
 
         H265RateControlMode GetH265RateControlModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VBR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H265RateControlMode::VBR;
-          }
-          else if (hashCode == CBR_HASH)
-          {
-            return H265RateControlMode::CBR;
-          }
-          else if (hashCode == QVBR_HASH)
-          {
-            return H265RateControlMode::QVBR;
+          case VBR_HASH:
+            if (name == "VBR")
+            {
+              return H265RateControlMode::VBR;
+            }
+            break;
+          case CBR_HASH:
+            if (name == "CBR")
+            {
+              return H265RateControlMode::CBR;
+            }
+            break;
+          case QVBR_HASH:
+            if (name == "QVBR")
+            {
+              return H265RateControlMode::QVBR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return H265RateControlMode::NOT_SET;
         }
 
-        Aws::String GetNameForH265RateControlMode(H265RateControlMode enumValue)
+        const char* GetNameForH265RateControlMode(H265RateControlMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
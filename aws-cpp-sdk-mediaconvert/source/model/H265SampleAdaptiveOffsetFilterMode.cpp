@@ -30,25 +30,37 @@ namespace Aws
       namespace H265SampleAdaptiveOffsetFilterModeMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int ADAPTIVE_HASH = HashingUtils::HashString("ADAPTIVE");
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
+        static constexpr int DEFAULT_HASH = HashingUtils::CompileTimeHashString("DEFAULT");
+        static constexpr int ADAPTIVE_HASH = HashingUtils::CompileTimeHashString("ADAPTIVE");
+        static constexpr int OFF_HASH = HashingUtils::CompileTimeHashString("OFF");
 
 
         H265SampleAdaptiveOffsetFilterMode GetH265SampleAdaptiveOffsetFilterModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H265SampleAdaptiveOffsetFilterMode::DEFAULT;
-          }
-          else if (hashCode == ADAPTIVE_HASH)
-          {
-            return H265SampleAdaptiveOffsetFilterMode::ADAPTIVE;
-          }
-          else if (hashCode == OFF_HASH)
-          {
-            return H265SampleAdaptiveOffsetFilterMode::OFF;
+          case DEFAULT_HASH:
+            if (name == "DEFAULT")
+            {
+              return H265SampleAdaptiveOffsetFilterMode::DEFAULT;
+            }
+            break;
+          case ADAPTIVE_HASH:
+            if (name == "ADAPTIVE")
+            {
+              return H265SampleAdaptiveOffsetFilterMode::ADAPTIVE;
+            }
+            break;
+          case OFF_HASH:
+            if (name == "OFF")
+            {
+              return H265SampleAdaptiveOffsetFilterMode::OFF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return H265SampleAdaptiveOffsetFilterMode::NOT_SET;
         }
 
-        Aws::String GetNameForH265SampleAdaptiveOffsetFilterMode(H265SampleAdaptiveOffsetFilterMode enumValue)
+        const char* GetNameForH265SampleAdaptiveOffsetFilterMode(H265SampleAdaptiveOffsetFilterMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
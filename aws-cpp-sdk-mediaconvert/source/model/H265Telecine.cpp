@@ -30,25 +30,37 @@ namespace Aws
       namespace H265TelecineMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SOFT_HASH = HashingUtils::HashString("SOFT");
-        static const int HARD_HASH = HashingUtils::HashString("HARD");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int SOFT_HASH = HashingUtils::CompileTimeHashString("SOFT");
+        static constexpr int HARD_HASH = HashingUtils::CompileTimeHashString("HARD");
 
 
         H265Telecine GetH265TelecineForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H265Telecine::NONE;
-          }
-          else if (hashCode == SOFT_HASH)
-          {
-            return H265Telecine::SOFT;
-          }
-          else if (hashCode == HARD_HASH)
-          {
-            return H265Telecine::HARD;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return H265Telecine::NONE;
+            }
+            break;
+          case SOFT_HASH:
+            if (name == "SOFT")
+            {
+              return H265Telecine::SOFT;
+            }
+            break;
+          case HARD_HASH:
+            if (name == "HARD")
+            {
+              return H265Telecine::HARD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return H265Telecine::NOT_SET;
         }
 
-        Aws::String GetNameForH265Telecine(H265Telecine enumValue)
+        const char* GetNameForH265Telecine(H265Telecine enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace H265WriteMp4PackagingTypeMapper
       {
 
-        static const int HVC1_HASH = HashingUtils::HashString("HVC1");
-        static const int HEV1_HASH = HashingUtils::HashString("HEV1");
+        static constexpr int HVC1_HASH = HashingUtils::CompileTimeHashString("HVC1");
+        static constexpr int HEV1_HASH = HashingUtils::CompileTimeHashString("HEV1");
 
 
         H265WriteMp4PackagingType GetH265WriteMp4PackagingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HVC1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H265WriteMp4PackagingType::HVC1;
-          }
-          else if (hashCode == HEV1_HASH)
-          {
-            return H265WriteMp4PackagingType::HEV1;
+          case HVC1_HASH:
+            if (name == "HVC1")
+            {
+              return H265WriteMp4PackagingType::HVC1;
+            }
+            break;
+          case HEV1_HASH:
+            if (name == "HEV1")
+            {
+              return H265WriteMp4PackagingType::HEV1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H265WriteMp4PackagingType::NOT_SET;
         }
 
-        Aws::String GetNameForH265WriteMp4PackagingType(H265WriteMp4PackagingType enumValue)
+        const char* GetNameForH265WriteMp4PackagingType(H265WriteMp4PackagingType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace HlsAudioTrackTypeMapper
       {
 
-        static const int ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT_HASH = HashingUtils::HashString("ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT");
-        static const int ALTERNATE_AUDIO_AUTO_SELECT_HASH = HashingUtils::HashString("ALTERNATE_AUDIO_AUTO_SELECT");
-        static const int ALTERNATE_AUDIO_NOT_AUTO_SELECT_HASH = HashingUtils::HashString("ALTERNATE_AUDIO_NOT_AUTO_SELECT");
-        static const int AUDIO_ONLY_VARIANT_STREAM_HASH = HashingUtils::HashString("AUDIO_ONLY_VARIANT_STREAM");
+        static constexpr int ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT_HASH = HashingUtils::CompileTimeHashString("ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT");
+        static constexpr int ALTERNATE_AUDIO_AUTO_SELECT_HASH = HashingUtils::CompileTimeHashString("ALTERNATE_AUDIO_AUTO_SELECT");
+        static constexpr int ALTERNATE_AUDIO_NOT_AUTO_SELECT_HASH = HashingUtils::CompileTimeHashString("ALTERNATE_AUDIO_NOT_AUTO_SELECT");
+        static constexpr int AUDIO_ONLY_VARIANT_STREAM_HASH = HashingUtils::CompileTimeHashString("AUDIO_ONLY_VARIANT_STREAM");
 
 
         HlsAudioTrackType GetHlsAudioTrackTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT;
-          }
-          else if (hashCode == ALTERNATE_AUDIO_AUTO_SELECT_HASH)
-          {
-            return HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT;
-          }
-          else if (hashCode == ALTERNATE_AUDIO_NOT_AUTO_SELECT_HASH)
-          {
-            return HlsAudioTrackType::ALTERNATE_AUDIO_NOT_AUTO_SELECT;
-          }
-          else if (hashCode == AUDIO_ONLY_VARIANT_STREAM_HASH)
-          {
-            return HlsAudioTrackType::AUDIO_ONLY_VARIANT_STREAM;
+          case ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT_HASH:
+            if (name == "ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT")
+            {
+              return HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT_DEFAULT;
+            }
+            break;
+          case ALTERNATE_AUDIO_AUTO_SELECT_HASH:
+            if (name == "ALTERNATE_AUDIO_AUTO_SELECT")
+            {
+              return HlsAudioTrackType::ALTERNATE_AUDIO_AUTO_SELECT;
+            }
+            break;
+          case ALTERNATE_AUDIO_NOT_AUTO_SELECT_HASH:
+            if (name == "ALTERNATE_AUDIO_NOT_AUTO_SELECT")
+            {
+              return HlsAudioTrackType::ALTERNATE_AUDIO_NOT_AUTO_SELECT;
+            }
+            break;
+          case AUDIO_ONLY_VARIANT_STREAM_HASH:
+            if (name == "AUDIO_ONLY_VARIANT_STREAM")
+            {
+              return HlsAudioTrackType::AUDIO_ONLY_VARIANT_STREAM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return HlsAudioTrackType::NOT_SET;
         }
 
-        Aws::String GetNameForHlsAudioTrackType(HlsAudioTrackType enumValue)
+        const char* GetNameForHlsAudioTrackType(HlsAudioTrackType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
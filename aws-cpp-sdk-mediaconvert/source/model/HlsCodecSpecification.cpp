@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsCodecSpecificationMapper
       {
 
-        static const int RFC_6381_HASH = HashingUtils::HashString("RFC_6381");
-        static const int RFC_4281_HASH = HashingUtils::HashString("RFC_4281");
+        static constexpr int RFC_6381_HASH = HashingUtils::CompileTimeHashString("RFC_6381");
+        static constexpr int RFC_4281_HASH = HashingUtils::CompileTimeHashString("RFC_4281");
 
 
         HlsCodecSpecification GetHlsCodecSpecificationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RFC_6381_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsCodecSpecification::RFC_6381;
-          }
-          else if (hashCode == RFC_4281_HASH)
-          {
-            return HlsCodecSpecification::RFC_4281;
+          case RFC_6381_HASH:
+            if (name == "RFC_6381")
+            {
+              return HlsCodecSpecification::RFC_6381;
+            }
+            break;
+          case RFC_4281_HASH:
+            if (name == "RFC_4281")
+            {
+              return HlsCodecSpecification::RFC_4281;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsCodecSpecification::NOT_SET;
         }
 
-        Aws::String GetNameForHlsCodecSpecification(HlsCodecSpecification enumValue)
+        const char* GetNameForHlsCodecSpecification(HlsCodecSpecification enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
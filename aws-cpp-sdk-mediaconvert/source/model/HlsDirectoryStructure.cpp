@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsDirectoryStructureMapper
       {
 
-        static const int SINGLE_DIRECTORY_HASH = HashingUtils::HashString("SINGLE_DIRECTORY");
-        static const int SUBDIRECTORY_PER_STREAM_HASH = HashingUtils::HashString("SUBDIRECTORY_PER_STREAM");
+        static constexpr int SINGLE_DIRECTORY_HASH = HashingUtils::CompileTimeHashString("SINGLE_DIRECTORY");
+        static constexpr int SUBDIRECTORY_PER_STREAM_HASH = HashingUtils::CompileTimeHashString("SUBDIRECTORY_PER_STREAM");
 
 
         HlsDirectoryStructure GetHlsDirectoryStructureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_DIRECTORY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsDirectoryStructure::SINGLE_DIRECTORY;
-          }
-          else if (hashCode == SUBDIRECTORY_PER_STREAM_HASH)
-          {
-            return HlsDirectoryStructure::SUBDIRECTORY_PER_STREAM;
+          case SINGLE_DIRECTORY_HASH:
+            if (name == "SINGLE_DIRECTORY")
+            {
+              return HlsDirectoryStructure::SINGLE_DIRECTORY;
+            }
+            break;
+          case SUBDIRECTORY_PER_STREAM_HASH:
+            if (name == "SUBDIRECTORY_PER_STREAM")
+            {
+              return HlsDirectoryStructure::SUBDIRECTORY_PER_STREAM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsDirectoryStructure::NOT_SET;
         }
 
-        Aws::String GetNameForHlsDirectoryStructure(HlsDirectoryStructure enumValue)
+        const char* GetNameForHlsDirectoryStructure(HlsDirectoryStructure enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsEncryptionTypeMapper
       {
 
-        static const int AES128_HASH = HashingUtils::HashString("AES128");
-        static const int SAMPLE_AES_HASH = HashingUtils::HashString("SAMPLE_AES");
+        static constexpr int AES128_HASH = HashingUtils::CompileTimeHashString("AES128");
+        static constexpr int SAMPLE_AES_HASH = HashingUtils::CompileTimeHashString("SAMPLE_AES");
 
 
         HlsEncryptionType GetHlsEncryptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES128_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsEncryptionType::AES128;
-          }
-          else if (hashCode == SAMPLE_AES_HASH)
-          {
-            return HlsEncryptionType::SAMPLE_AES;
+          case AES128_HASH:
+            if (name == "AES128")
+            {
+              return HlsEncryptionType::AES128;
+            }
+            break;
+          case SAMPLE_AES_HASH:
+            if (name == "SAMPLE_AES")
+            {
+              return HlsEncryptionType::SAMPLE_AES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsEncryptionType::NOT_SET;
         }
 
-        Aws::String GetNameForHlsEncryptionType(HlsEncryptionType enumValue)
+        const char* GetNameForHlsEncryptionType(HlsEncryptionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
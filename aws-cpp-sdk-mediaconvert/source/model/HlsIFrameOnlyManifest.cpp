@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsIFrameOnlyManifestMapper
       {
 
-        static const int INCLUDE_HASH = HashingUtils::HashString("INCLUDE");
-        static const int EXCLUDE_HASH = HashingUtils::HashString("EXCLUDE");
+        static constexpr int INCLUDE_HASH = HashingUtils::CompileTimeHashString("INCLUDE");
+        static constexpr int EXCLUDE_HASH = HashingUtils::CompileTimeHashString("EXCLUDE");
 
 
         HlsIFrameOnlyManifest GetHlsIFrameOnlyManifestForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INCLUDE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsIFrameOnlyManifest::INCLUDE;
-          }
-          else if (hashCode == EXCLUDE_HASH)
-          {
-            return HlsIFrameOnlyManifest::EXCLUDE;
+          case INCLUDE_HASH:
+            if (name == "INCLUDE")
+            {
+              return HlsIFrameOnlyManifest::INCLUDE;
+            }
+            break;
+          case EXCLUDE_HASH:
+            if (name == "EXCLUDE")
+            {
+              return HlsIFrameOnlyManifest::EXCLUDE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsIFrameOnlyManifest::NOT_SET;
         }
 
-        Aws::String GetNameForHlsIFrameOnlyManifest(HlsIFrameOnlyManifest enumValue)
+        const char* GetNameForHlsIFrameOnlyManifest(HlsIFrameOnlyManifest enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
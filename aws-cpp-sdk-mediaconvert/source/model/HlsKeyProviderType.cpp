@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsKeyProviderTypeMapper
       {
 
-        static const int SPEKE_HASH = HashingUtils::HashString("SPEKE");
-        static const int STATIC_KEY_HASH = HashingUtils::HashString("STATIC_KEY");
+        static constexpr int SPEKE_HASH = HashingUtils::CompileTimeHashString("SPEKE");
+        static constexpr int STATIC_KEY_HASH = HashingUtils::CompileTimeHashString("STATIC_KEY");
 
 
         HlsKeyProviderType GetHlsKeyProviderTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SPEKE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsKeyProviderType::SPEKE;
-          }
-          else if (hashCode == STATIC_KEY_HASH)
-          {
-            return HlsKeyProviderType::STATIC_KEY;
+          case SPEKE_HASH:
+            if (name == "SPEKE")
+            {
+              return HlsKeyProviderType::SPEKE;
+            }
+            break;
+          case STATIC_KEY_HASH:
+            if (name == "STATIC_KEY")
+            {
+              return HlsKeyProviderType::STATIC_KEY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsKeyProviderType::NOT_SET;
         }
 
-        Aws::String GetNameForHlsKeyProviderType(HlsKeyProviderType enumValue)
+        const char* GetNameForHlsKeyProviderType(HlsKeyProviderType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsOutputSelectionMapper
       {
 
-        static const int MANIFESTS_AND_SEGMENTS_HASH = HashingUtils::HashString("MANIFESTS_AND_SEGMENTS");
-        static const int SEGMENTS_ONLY_HASH = HashingUtils::HashString("SEGMENTS_ONLY");
+        static constexpr int MANIFESTS_AND_SEGMENTS_HASH = HashingUtils::CompileTimeHashString("MANIFESTS_AND_SEGMENTS");
+        static constexpr int SEGMENTS_ONLY_HASH = HashingUtils::CompileTimeHashString("SEGMENTS_ONLY");
 
 
         HlsOutputSelection GetHlsOutputSelectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MANIFESTS_AND_SEGMENTS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsOutputSelection::MANIFESTS_AND_SEGMENTS;
-          }
-          else if (hashCode == SEGMENTS_ONLY_HASH)
-          {
-            return HlsOutputSelection::SEGMENTS_ONLY;
+          case MANIFESTS_AND_SEGMENTS_HASH:
+            if (name == "MANIFESTS_AND_SEGMENTS")
+            {
+              return HlsOutputSelection::MANIFESTS_AND_SEGMENTS;
+            }
+            break;
+          case SEGMENTS_ONLY_HASH:
+            if (name == "SEGMENTS_ONLY")
+            {
+              return HlsOutputSelection::SEGMENTS_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsOutputSelection::NOT_SET;
         }
 
-        Aws::String GetNameForHlsOutputSelection(HlsOutputSelection enumValue)
+        const char* GetNameForHlsOutputSelection(HlsOutputSelection enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
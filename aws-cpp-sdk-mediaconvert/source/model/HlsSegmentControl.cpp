@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsSegmentControlMapper
       {
 
-        static const int SINGLE_FILE_HASH = HashingUtils::HashString("SINGLE_FILE");
-        static const int SEGMENTED_FILES_HASH = HashingUtils::HashString("SEGMENTED_FILES");
+        static constexpr int SINGLE_FILE_HASH = HashingUtils::CompileTimeHashString("SINGLE_FILE");
+        static constexpr int SEGMENTED_FILES_HASH = HashingUtils::CompileTimeHashString("SEGMENTED_FILES");
 
 
         HlsSegmentControl GetHlsSegmentControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_FILE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsSegmentControl::SINGLE_FILE;
-          }
-          else if (hashCode == SEGMENTED_FILES_HASH)
-          {
-            return HlsSegmentControl::SEGMENTED_FILES;
+          case SINGLE_FILE_HASH:
+            if (name == "SINGLE_FILE")
+            {
+              return HlsSegmentControl::SINGLE_FILE;
+            }
+            break;
+          case SEGMENTED_FILES_HASH:
+            if (name == "SEGMENTED_FILES")
+            {
+              return HlsSegmentControl::SEGMENTED_FILES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsSegmentControl::NOT_SET;
         }
 
-        Aws::String GetNameForHlsSegmentControl(HlsSegmentControl enumValue)
+        const char* GetNameForHlsSegmentControl(HlsSegmentControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace InputFilterEnableMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int DISABLE_HASH = HashingUtils::HashString("DISABLE");
-        static const int FORCE_HASH = HashingUtils::HashString("FORCE");
+        static constexpr int AUTO_HASH = HashingUtils::CompileTimeHashString("AUTO");
+        static constexpr int DISABLE_HASH = HashingUtils::CompileTimeHashString("DISABLE");
+        static constexpr int FORCE_HASH = HashingUtils::CompileTimeHashString("FORCE");
 
 
         InputFilterEnable GetInputFilterEnableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputFilterEnable::AUTO;
-          }
-          else if (hashCode == DISABLE_HASH)
-          {
-            return InputFilterEnable::DISABLE;
-          }
-          else if (hashCode == FORCE_HASH)
-          {
-            return InputFilterEnable::FORCE;
+          case AUTO_HASH:
+            if (name == "AUTO")
+            {
+              return InputFilterEnable::AUTO;
+            }
+            break;
+          case DISABLE_HASH:
+            if (name == "DISABLE")
+            {
+              return InputFilterEnable::DISABLE;
+            }
+            break;
+          case FORCE_HASH:
+            if (name == "FORCE")
+            {
+              return InputFilterEnable::FORCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InputFilterEnable::NOT_SET;
         }
 
-        Aws::String GetNameForInputFilterEnable(InputFilterEnable enumValue)
+        const char* GetNameForInputFilterEnable(InputFilterEnable enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
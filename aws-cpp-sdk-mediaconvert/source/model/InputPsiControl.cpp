@@ -30,20 +30,30 @@ namespace Aws
       namespace InputPsiControlMapper
       {
 
-        static const int IGNORE_PSI_HASH = HashingUtils::HashString("IGNORE_PSI");
-        static const int USE_PSI_HASH = HashingUtils::HashString("USE_PSI");
+        static constexpr int IGNORE_PSI_HASH = HashingUtils::CompileTimeHashString("IGNORE_PSI");
+        static constexpr int USE_PSI_HASH = HashingUtils::CompileTimeHashString("USE_PSI");
 
 
         InputPsiControl GetInputPsiControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IGNORE_PSI_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputPsiControl::IGNORE_PSI;
-          }
-          else if (hashCode == USE_PSI_HASH)
-          {
-            return InputPsiControl::USE_PSI;
+          case IGNORE_PSI_HASH:
+            if (name == "IGNORE_PSI")
+            {
+              return InputPsiControl::IGNORE_PSI;
+            }
+            break;
+          case USE_PSI_HASH:
+            if (name == "USE_PSI")
+            {
+              return InputPsiControl::USE_PSI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InputPsiControl::NOT_SET;
         }
 
-        Aws::String GetNameForInputPsiControl(InputPsiControl enumValue)
+        const char* GetNameForInputPsiControl(InputPsiControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
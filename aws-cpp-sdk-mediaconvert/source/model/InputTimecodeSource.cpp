@@ -30,25 +30,37 @@ namespace Aws
       namespace InputTimecodeSourceMapper
       {
 
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int ZEROBASED_HASH = HashingUtils::HashString("ZEROBASED");
-        static const int SPECIFIEDSTART_HASH = HashingUtils::HashString("SPECIFIEDSTART");
+        static constexpr int EMBEDDED_HASH = HashingUtils::CompileTimeHashString("EMBEDDED");
+        static constexpr int ZEROBASED_HASH = HashingUtils::CompileTimeHashString("ZEROBASED");
+        static constexpr int SPECIFIEDSTART_HASH = HashingUtils::CompileTimeHashString("SPECIFIEDSTART");
 
 
         InputTimecodeSource GetInputTimecodeSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMBEDDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputTimecodeSource::EMBEDDED;
-          }
-          else if (hashCode == ZEROBASED_HASH)
-          {
-            return InputTimecodeSource::ZEROBASED;
-          }
-          else if (hashCode == SPECIFIEDSTART_HASH)
-          {
-            return InputTimecodeSource::SPECIFIEDSTART;
+          case EMBEDDED_HASH:
+            if (name == "EMBEDDED")
+            {
+              return InputTimecodeSource::EMBEDDED;
+            }
+            break;
+          case ZEROBASED_HASH:
+            if (name == "ZEROBASED")
+            {
+              return InputTimecodeSource::ZEROBASED;
+            }
+            break;
+          case SPECIFIEDSTART_HASH:
+            if (name == "SPECIFIEDSTART")
+            {
+              return InputTimecodeSource::SPECIFIEDSTART;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InputTimecodeSource::NOT_SET;
         }
 
-        Aws::String GetNameForInputTimecodeSource(InputTimecodeSource enumValue)
+        const char* GetNameForInputTimecodeSource(InputTimecodeSource enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int PROGRESSING_HASH = HashingUtils::HashString("PROGRESSING");
-        static const int COMPLETE_HASH = HashingUtils::HashString("COMPLETE");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        static constexpr int SUBMITTED_HASH = HashingUtils::CompileTimeHashString("SUBMITTED");
+        static constexpr int PROGRESSING_HASH = HashingUtils::CompileTimeHashString("PROGRESSING");
+        static constexpr int COMPLETE_HASH = HashingUtils::CompileTimeHashString("COMPLETE");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
 
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobStatus::SUBMITTED;
-          }
-          else if (hashCode == PROGRESSING_HASH)
-          {
-            return JobStatus::PROGRESSING;
-          }
-          else if (hashCode == COMPLETE_HASH)
-          {
-            return JobStatus::COMPLETE;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return JobStatus::CANCELED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return JobStatus::ERROR_;
+          case SUBMITTED_HASH:
+            if (name == "SUBMITTED")
+            {
+              return JobStatus::SUBMITTED;
+            }
+            break;
+          case PROGRESSING_HASH:
+            if (name == "PROGRESSING")
+            {
+              return JobStatus::PROGRESSING;
+            }
+            break;
+          case COMPLETE_HASH:
+            if (name == "COMPLETE")
+            {
+              return JobStatus::COMPLETE;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return JobStatus::CANCELED;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return JobStatus::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatus(JobStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace JobTemplateListByMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int CREATION_DATE_HASH = HashingUtils::HashString("CREATION_DATE");
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
+        static constexpr int NAME_HASH = HashingUtils::CompileTimeHashString("NAME");
+        static constexpr int CREATION_DATE_HASH = HashingUtils::CompileTimeHashString("CREATION_DATE");
+        static constexpr int SYSTEM_HASH = HashingUtils::CompileTimeHashString("SYSTEM");
 
 
         JobTemplateListBy GetJobTemplateListByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobTemplateListBy::NAME;
-          }
-          else if (hashCode == CREATION_DATE_HASH)
-          {
-            return JobTemplateListBy::CREATION_DATE;
-          }
-          else if (hashCode == SYSTEM_HASH)
-          {
-            return JobTemplateListBy::SYSTEM;
+          case NAME_HASH:
+            if (name == "NAME")
+            {
+              return JobTemplateListBy::NAME;
+            }
+            break;
+          case CREATION_DATE_HASH:
+            if (name == "CREATION_DATE")
+            {
+              return JobTemplateListBy::CREATION_DATE;
+            }
+            break;
+          case SYSTEM_HASH:
+            if (name == "SYSTEM")
+            {
+              return JobTemplateListBy::SYSTEM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return JobTemplateListBy::NOT_SET;
         }
 
-        Aws::String GetNameForJobTemplateListBy(JobTemplateListBy enumValue)
+        const char* GetNameForJobTemplateListBy(JobTemplateListBy enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,1797 +30,1759 @@ namespace Aws
       namespace LanguageCodeMapper
       {
 
-        static const int ENG_HASH = HashingUtils::HashString("ENG");
-        static const int SPA_HASH = HashingUtils::HashString("SPA");
-        static const int FRA_HASH = HashingUtils::HashString("FRA");
-        static const int DEU_HASH = HashingUtils::HashString("DEU");
-        static const int GER_HASH = HashingUtils::HashString("GER");
-        static const int ZHO_HASH = HashingUtils::HashString("ZHO");
-        static const int ARA_HASH = HashingUtils::HashString("ARA");
-        static const int HIN_HASH = HashingUtils::HashString("HIN");
-        static const int JPN_HASH = HashingUtils::HashString("JPN");
-        static const int RUS_HASH = HashingUtils::HashString("RUS");
-        static const int POR_HASH = HashingUtils::HashString("POR");
-        static const int ITA_HASH = HashingUtils::HashString("ITA");
-        static const int URD_HASH = HashingUtils::HashString("URD");
-        static const int VIE_HASH = HashingUtils::HashString("VIE");
-        static const int KOR_HASH = HashingUtils::HashString("KOR");
-        static const int PAN_HASH = HashingUtils::HashString("PAN");
-        static const int ABK_HASH = HashingUtils::HashString("ABK");
-        static const int AAR_HASH = HashingUtils::HashString("AAR");
-        static const int AFR_HASH = HashingUtils::HashString("AFR");
-        static const int AKA_HASH = HashingUtils::HashString("AKA");
-        static const int SQI_HASH = HashingUtils::HashString("SQI");
-        static const int AMH_HASH = HashingUtils::HashString("AMH");
-        static const int ARG_HASH = HashingUtils::HashString("ARG");
-        static const int HYE_HASH = HashingUtils::HashString("HYE");
-        static const int ASM_HASH = HashingUtils::HashString("ASM");
-        static const int AVA_HASH = HashingUtils::HashString("AVA");
-        static const int AVE_HASH = HashingUtils::HashString("AVE");
-        static const int AYM_HASH = HashingUtils::HashString("AYM");
-        static const int AZE_HASH = HashingUtils::HashString("AZE");
-        static const int BAM_HASH = HashingUtils::HashString("BAM");
-        static const int BAK_HASH = HashingUtils::HashString("BAK");
-        static const int EUS_HASH = HashingUtils::HashString("EUS");
-        static const int BEL_HASH = HashingUtils::HashString("BEL");
-        static const int BEN_HASH = HashingUtils::HashString("BEN");
-        static const int BIH_HASH = HashingUtils::HashString("BIH");
-        static const int BIS_HASH = HashingUtils::HashString("BIS");
-        static const int BOS_HASH = HashingUtils::HashString("BOS");
-        static const int BRE_HASH = HashingUtils::HashString("BRE");
-        static const int BUL_HASH = HashingUtils::HashString("BUL");
-        static const int MYA_HASH = HashingUtils::HashString("MYA");
-        static const int CAT_HASH = HashingUtils::HashString("CAT");
-        static const int KHM_HASH = HashingUtils::HashString("KHM");
-        static const int CHA_HASH = HashingUtils::HashString("CHA");
-        static const int CHE_HASH = HashingUtils::HashString("CHE");
-        static const int NYA_HASH = HashingUtils::HashString("NYA");
-        static const int CHU_HASH = HashingUtils::HashString("CHU");
-        static const int CHV_HASH = HashingUtils::HashString("CHV");
-        static const int COR_HASH = HashingUtils::HashString("COR");
-        static const int COS_HASH = HashingUtils::HashString("COS");
-        static const int CRE_HASH = HashingUtils::HashString("CRE");
-        static const int HRV_HASH = HashingUtils::HashString("HRV");
-        static const int CES_HASH = HashingUtils::HashString("CES");
-        static const int DAN_HASH = HashingUtils::HashString("DAN");
-        static const int DIV_HASH = HashingUtils::HashString("DIV");
-        static const int NLD_HASH = HashingUtils::HashString("NLD");
-        static const int DZO_HASH = HashingUtils::HashString("DZO");
-        static const int ENM_HASH = HashingUtils::HashString("ENM");
-        static const int EPO_HASH = HashingUtils::HashString("EPO");
-        static const int EST_HASH = HashingUtils::HashString("EST");
-        static const int EWE_HASH = HashingUtils::HashString("EWE");
-        static const int FAO_HASH = HashingUtils::HashString("FAO");
-        static const int FIJ_HASH = HashingUtils::HashString("FIJ");
-        static const int FIN_HASH = HashingUtils::HashString("FIN");
-        static const int FRM_HASH = HashingUtils::HashString("FRM");
-        static const int FUL_HASH = HashingUtils::HashString("FUL");
-        static const int GLA_HASH = HashingUtils::HashString("GLA");
-        static const int GLG_HASH = HashingUtils::HashString("GLG");
-        static const int LUG_HASH = HashingUtils::HashString("LUG");
-        static const int KAT_HASH = HashingUtils::HashString("KAT");
-        static const int ELL_HASH = HashingUtils::HashString("ELL");
-        static const int GRN_HASH = HashingUtils::HashString("GRN");
-        static const int GUJ_HASH = HashingUtils::HashString("GUJ");
-        static const int HAT_HASH = HashingUtils::HashString("HAT");
-        static const int HAU_HASH = HashingUtils::HashString("HAU");
-        static const int HEB_HASH = HashingUtils::HashString("HEB");
-        static const int HER_HASH = HashingUtils::HashString("HER");
-        static const int HMO_HASH = HashingUtils::HashString("HMO");
-        static const int HUN_HASH = HashingUtils::HashString("HUN");
-        static const int ISL_HASH = HashingUtils::HashString("ISL");
-        static const int IDO_HASH = HashingUtils::HashString("IDO");
-        static const int IBO_HASH = HashingUtils::HashString("IBO");
-        static const int IND_HASH = HashingUtils::HashString("IND");
-        static const int INA_HASH = HashingUtils::HashString("INA");
-        static const int ILE_HASH = HashingUtils::HashString("ILE");
-        static const int IKU_HASH = HashingUtils::HashString("IKU");
-        static const int IPK_HASH = HashingUtils::HashString("IPK");
-        static const int GLE_HASH = HashingUtils::HashString("GLE");
-        static const int JAV_HASH = HashingUtils::HashString("JAV");
-        static const int KAL_HASH = HashingUtils::HashString("KAL");
-        static const int KAN_HASH = HashingUtils::HashString("KAN");
-        static const int KAU_HASH = HashingUtils::HashString("KAU");
-        static const int KAS_HASH = HashingUtils::HashString("KAS");
-        static const int KAZ_HASH = HashingUtils::HashString("KAZ");
-        static const int KIK_HASH = HashingUtils::HashString("KIK");
-        static const int KIN_HASH = HashingUtils::HashString("KIN");
-        static const int KIR_HASH = HashingUtils::HashString("KIR");
-        static const int KOM_HASH = HashingUtils::HashString("KOM");
-        static const int KON_HASH = HashingUtils::HashString("KON");
-        static const int KUA_HASH = HashingUtils::HashString("KUA");
-        static const int KUR_HASH = HashingUtils::HashString("KUR");
-        static const int LAO_HASH = HashingUtils::HashString("LAO");
-        static const int LAT_HASH = HashingUtils::HashString("LAT");
-        static const int LAV_HASH = HashingUtils::HashString("LAV");
-        static const int LIM_HASH = HashingUtils::HashString("LIM");
-        static const int LIN_HASH = HashingUtils::HashString("LIN");
-        static const int LIT_HASH = HashingUtils::HashString("LIT");
-        static const int LUB_HASH = HashingUtils::HashString("LUB");
-        static const int LTZ_HASH = HashingUtils::HashString("LTZ");
-        static const int MKD_HASH = HashingUtils::HashString("MKD");
-        static const int MLG_HASH = HashingUtils::HashString("MLG");
-        static const int MSA_HASH = HashingUtils::HashString("MSA");
-        static const int MAL_HASH = HashingUtils::HashString("MAL");
-        static const int MLT_HASH = HashingUtils::HashString("MLT");
-        static const int GLV_HASH = HashingUtils::HashString("GLV");
-        static const int MRI_HASH = HashingUtils::HashString("MRI");
-        static const int MAR_HASH = HashingUtils::HashString("MAR");
-        static const int MAH_HASH = HashingUtils::HashString("MAH");
-        static const int MON_HASH = HashingUtils::HashString("MON");
-        static const int NAU_HASH = HashingUtils::HashString("NAU");
-        static const int NAV_HASH = HashingUtils::HashString("NAV");
-        static const int NDE_HASH = HashingUtils::HashString("NDE");
-        static const int NBL_HASH = HashingUtils::HashString("NBL");
-        static const int NDO_HASH = HashingUtils::HashString("NDO");
-        static const int NEP_HASH = HashingUtils::HashString("NEP");
-        static const int SME_HASH = HashingUtils::HashString("SME");
-        static const int NOR_HASH = HashingUtils::HashString("NOR");
-        static const int NOB_HASH = HashingUtils::HashString("NOB");
-        static const int NNO_HASH = HashingUtils::HashString("NNO");
-        static const int OCI_HASH = HashingUtils::HashString("OCI");
-        static const int OJI_HASH = HashingUtils::HashString("OJI");
-        static const int ORI_HASH = HashingUtils::HashString("ORI");
-        static const int ORM_HASH = HashingUtils::HashString("ORM");
-        static const int OSS_HASH = HashingUtils::HashString("OSS");
-        static const int PLI_HASH = HashingUtils::HashString("PLI");
-        static const int FAS_HASH = HashingUtils::HashString("FAS");
-        static const int POL_HASH = HashingUtils::HashString("POL");
-        static const int PUS_HASH = HashingUtils::HashString("PUS");
-        static const int QUE_HASH = HashingUtils::HashString("QUE");
-        static const int QAA_HASH = HashingUtils::HashString("QAA");
-        static const int RON_HASH = HashingUtils::HashString("RON");
-        static const int ROH_HASH = HashingUtils::HashString("ROH");
-        static const int RUN_HASH = HashingUtils::HashString("RUN");
-        static const int SMO_HASH = HashingUtils::HashString("SMO");
-        static const int SAG_HASH = HashingUtils::HashString("SAG");
-        static const int SAN_HASH = HashingUtils::HashString("SAN");
-        static const int SRD_HASH = HashingUtils::HashString("SRD");
-        static const int SRB_HASH = HashingUtils::HashString("SRB");
-        static const int SNA_HASH = HashingUtils::HashString("SNA");
-        static const int III_HASH = HashingUtils::HashString("III");
-        static const int SND_HASH = HashingUtils::HashString("SND");
-        static const int SIN_HASH = HashingUtils::HashString("SIN");
-        static const int SLK_HASH = HashingUtils::HashString("SLK");
-        static const int SLV_HASH = HashingUtils::HashString("SLV");
-        static const int SOM_HASH = HashingUtils::HashString("SOM");
-        static const int SOT_HASH = HashingUtils::HashString("SOT");
-        static const int SUN_HASH = HashingUtils::HashString("SUN");
-        static const int SWA_HASH = HashingUtils::HashString("SWA");
-        static const int SSW_HASH = HashingUtils::HashString("SSW");
-        static const int SWE_HASH = HashingUtils::HashString("SWE");
-        static const int TGL_HASH = HashingUtils::HashString("TGL");
-        static const int TAH_HASH = HashingUtils::HashString("TAH");
-        static const int TGK_HASH = HashingUtils::HashString("TGK");
-        static const int TAM_HASH = HashingUtils::HashString("TAM");
-        static const int TAT_HASH = HashingUtils::HashString("TAT");
-        static const int TEL_HASH = HashingUtils::HashString("TEL");
-        static const int THA_HASH = HashingUtils::HashString("THA");
-        static const int BOD_HASH = HashingUtils::HashString("BOD");
-        static const int TIR_HASH = HashingUtils::HashString("TIR");
-        static const int TON_HASH = HashingUtils::HashString("TON");
-        static const int TSO_HASH = HashingUtils::HashString("TSO");
-        static const int TSN_HASH = HashingUtils::HashString("TSN");
-        static const int TUR_HASH = HashingUtils::HashString("TUR");
-        static const int TUK_HASH = HashingUtils::HashString("TUK");
-        static const int TWI_HASH = HashingUtils::HashString("TWI");
-        static const int UIG_HASH = HashingUtils::HashString("UIG");
-        static const int UKR_HASH = HashingUtils::HashString("UKR");
-        static const int UZB_HASH = HashingUtils::HashString("UZB");
-        static const int VEN_HASH = HashingUtils::HashString("VEN");
-        static const int VOL_HASH = HashingUtils::HashString("VOL");
-        static const int WLN_HASH = HashingUtils::HashString("WLN");
-        static const int CYM_HASH = HashingUtils::HashString("CYM");
-        static const int FRY_HASH = HashingUtils::HashString("FRY");
-        static const int WOL_HASH = HashingUtils::HashString("WOL");
-        static const int XHO_HASH = HashingUtils::HashString("XHO");
-        static const int YID_HASH = HashingUtils::HashString("YID");
-        static const int YOR_HASH = HashingUtils::HashString("YOR");
-        static const int ZHA_HASH = HashingUtils::HashString("ZHA");
-        static const int ZUL_HASH = HashingUtils::HashString("ZUL");
-        static const int ORJ_HASH = HashingUtils::HashString("ORJ");
-        static const int QPC_HASH = HashingUtils::HashString("QPC");
-        static const int TNG_HASH = HashingUtils::HashString("TNG");
+        static constexpr int ENG_HASH = HashingUtils::CompileTimeHashString("ENG");
+        static constexpr int SPA_HASH = HashingUtils::CompileTimeHashString("SPA");
+        static constexpr int FRA_HASH = HashingUtils::CompileTimeHashString("FRA");
+        static constexpr int DEU_HASH = HashingUtils::CompileTimeHashString("DEU");
+        static constexpr int GER_HASH = HashingUtils::CompileTimeHashString("GER");
+        static constexpr int ZHO_HASH = HashingUtils::CompileTimeHashString("ZHO");
+        static constexpr int ARA_HASH = HashingUtils::CompileTimeHashString("ARA");
+        static constexpr int HIN_HASH = HashingUtils::CompileTimeHashString("HIN");
+        static constexpr int JPN_HASH = HashingUtils::CompileTimeHashString("JPN");
+        static constexpr int RUS_HASH = HashingUtils::CompileTimeHashString("RUS");
+        static constexpr int POR_HASH = HashingUtils::CompileTimeHashString("POR");
+        static constexpr int ITA_HASH = HashingUtils::CompileTimeHashString("ITA");
+        static constexpr int URD_HASH = HashingUtils::CompileTimeHashString("URD");
+        static constexpr int VIE_HASH = HashingUtils::CompileTimeHashString("VIE");
+        static constexpr int KOR_HASH = HashingUtils::CompileTimeHashString("KOR");
+        static constexpr int PAN_HASH = HashingUtils::CompileTimeHashString("PAN");
+        static constexpr int ABK_HASH = HashingUtils::CompileTimeHashString("ABK");
+        static constexpr int AAR_HASH = HashingUtils::CompileTimeHashString("AAR");
+        static constexpr int AFR_HASH = HashingUtils::CompileTimeHashString("AFR");
+        static constexpr int AKA_HASH = HashingUtils::CompileTimeHashString("AKA");
+        static constexpr int SQI_HASH = HashingUtils::CompileTimeHashString("SQI");
+        static constexpr int AMH_HASH = HashingUtils::CompileTimeHashString("AMH");
+        static constexpr int ARG_HASH = HashingUtils::CompileTimeHashString("ARG");
+        static constexpr int HYE_HASH = HashingUtils::CompileTimeHashString("HYE");
+        static constexpr int ASM_HASH = HashingUtils::CompileTimeHashString("ASM");
+        static constexpr int AVA_HASH = HashingUtils::CompileTimeHashString("AVA");
+        static constexpr int AVE_HASH = HashingUtils::CompileTimeHashString("AVE");
+        static constexpr int AYM_HASH = HashingUtils::CompileTimeHashString("AYM");
+        static constexpr int AZE_HASH = HashingUtils::CompileTimeHashString("AZE");
+        static constexpr int BAM_HASH = HashingUtils::CompileTimeHashString("BAM");
+        static constexpr int BAK_HASH = HashingUtils::CompileTimeHashString("BAK");
+        static constexpr int EUS_HASH = HashingUtils::CompileTimeHashString("EUS");
+        static constexpr int BEL_HASH = HashingUtils::CompileTimeHashString("BEL");
+        static constexpr int BEN_HASH = HashingUtils::CompileTimeHashString("BEN");
+        static constexpr int BIH_HASH = HashingUtils::CompileTimeHashString("BIH");
+        static constexpr int BIS_HASH = HashingUtils::CompileTimeHashString("BIS");
+        static constexpr int BOS_HASH = HashingUtils::CompileTimeHashString("BOS");
+        static constexpr int BRE_HASH = HashingUtils::CompileTimeHashString("BRE");
+        static constexpr int BUL_HASH = HashingUtils::CompileTimeHashString("BUL");
+        static constexpr int MYA_HASH = HashingUtils::CompileTimeHashString("MYA");
+        static constexpr int CAT_HASH = HashingUtils::CompileTimeHashString("CAT");
+        static constexpr int KHM_HASH = HashingUtils::CompileTimeHashString("KHM");
+        static constexpr int CHA_HASH = HashingUtils::CompileTimeHashString("CHA");
+        static constexpr int CHE_HASH = HashingUtils::CompileTimeHashString("CHE");
+        static constexpr int NYA_HASH = HashingUtils::CompileTimeHashString("NYA");
+        static constexpr int CHU_HASH = HashingUtils::CompileTimeHashString("CHU");
+        static constexpr int CHV_HASH = HashingUtils::CompileTimeHashString("CHV");
+        static constexpr int COR_HASH = HashingUtils::CompileTimeHashString("COR");
+        static constexpr int COS_HASH = HashingUtils::CompileTimeHashString("COS");
+        static constexpr int CRE_HASH = HashingUtils::CompileTimeHashString("CRE");
+        static constexpr int HRV_HASH = HashingUtils::CompileTimeHashString("HRV");
+        static constexpr int CES_HASH = HashingUtils::CompileTimeHashString("CES");
+        static constexpr int DAN_HASH = HashingUtils::CompileTimeHashString("DAN");
+        static constexpr int DIV_HASH = HashingUtils::CompileTimeHashString("DIV");
+        static constexpr int NLD_HASH = HashingUtils::CompileTimeHashString("NLD");
+        static constexpr int DZO_HASH = HashingUtils::CompileTimeHashString("DZO");
+        static constexpr int ENM_HASH = HashingUtils::CompileTimeHashString("ENM");
+        static constexpr int EPO_HASH = HashingUtils::CompileTimeHashString("EPO");
+        static constexpr int EST_HASH = HashingUtils::CompileTimeHashString("EST");
+        static constexpr int EWE_HASH = HashingUtils::CompileTimeHashString("EWE");
+        static constexpr int FAO_HASH = HashingUtils::CompileTimeHashString("FAO");
+        static constexpr int FIJ_HASH = HashingUtils::CompileTimeHashString("FIJ");
+        static constexpr int FIN_HASH = HashingUtils::CompileTimeHashString("FIN");
+        static constexpr int FRM_HASH = HashingUtils::CompileTimeHashString("FRM");
+        static constexpr int FUL_HASH = HashingUtils::CompileTimeHashString("FUL");
+        static constexpr int GLA_HASH = HashingUtils::CompileTimeHashString("GLA");
+        static constexpr int GLG_HASH = HashingUtils::CompileTimeHashString("GLG");
+        static constexpr int LUG_HASH = HashingUtils::CompileTimeHashString("LUG");
+        static constexpr int KAT_HASH = HashingUtils::CompileTimeHashString("KAT");
+        static constexpr int ELL_HASH = HashingUtils::CompileTimeHashString("ELL");
+        static constexpr int GRN_HASH = HashingUtils::CompileTimeHashString("GRN");
+        static constexpr int GUJ_HASH = HashingUtils::CompileTimeHashString("GUJ");
+        static constexpr int HAT_HASH = HashingUtils::CompileTimeHashString("HAT");
+        static constexpr int HAU_HASH = HashingUtils::CompileTimeHashString("HAU");
+        static constexpr int HEB_HASH = HashingUtils::CompileTimeHashString("HEB");
+        static constexpr int HER_HASH = HashingUtils::CompileTimeHashString("HER");
+        static constexpr int HMO_HASH = HashingUtils::CompileTimeHashString("HMO");
+        static constexpr int HUN_HASH = HashingUtils::CompileTimeHashString("HUN");
+        static constexpr int ISL_HASH = HashingUtils::CompileTimeHashString("ISL");
+        static constexpr int IDO_HASH = HashingUtils::CompileTimeHashString("IDO");
+        static constexpr int IBO_HASH = HashingUtils::CompileTimeHashString("IBO");
+        static constexpr int IND_HASH = HashingUtils::CompileTimeHashString("IND");
+        static constexpr int INA_HASH = HashingUtils::CompileTimeHashString("INA");
+        static constexpr int ILE_HASH = HashingUtils::CompileTimeHashString("ILE");
+        static constexpr int IKU_HASH = HashingUtils::CompileTimeHashString("IKU");
+        static constexpr int IPK_HASH = HashingUtils::CompileTimeHashString("IPK");
+        static constexpr int GLE_HASH = HashingUtils::CompileTimeHashString("GLE");
+        static constexpr int JAV_HASH = HashingUtils::CompileTimeHashString("JAV");
+        static constexpr int KAL_HASH = HashingUtils::CompileTimeHashString("KAL");
+        static constexpr int KAN_HASH = HashingUtils::CompileTimeHashString("KAN");
+        static constexpr int KAU_HASH = HashingUtils::CompileTimeHashString("KAU");
+        static constexpr int KAS_HASH = HashingUtils::CompileTimeHashString("KAS");
+        static constexpr int KAZ_HASH = HashingUtils::CompileTimeHashString("KAZ");
+        static constexpr int KIK_HASH = HashingUtils::CompileTimeHashString("KIK");
+        static constexpr int KIN_HASH = HashingUtils::CompileTimeHashString("KIN");
+        static constexpr int KIR_HASH = HashingUtils::CompileTimeHashString("KIR");
+        static constexpr int KOM_HASH = HashingUtils::CompileTimeHashString("KOM");
+        static constexpr int KON_HASH = HashingUtils::CompileTimeHashString("KON");
+        static constexpr int KUA_HASH = HashingUtils::CompileTimeHashString("KUA");
+        static constexpr int KUR_HASH = HashingUtils::CompileTimeHashString("KUR");
+        static constexpr int LAO_HASH = HashingUtils::CompileTimeHashString("LAO");
+        static constexpr int LAT_HASH = HashingUtils::CompileTimeHashString("LAT");
+        static constexpr int LAV_HASH = HashingUtils::CompileTimeHashString("LAV");
+        static constexpr int LIM_HASH = HashingUtils::CompileTimeHashString("LIM");
+        static constexpr int LIN_HASH = HashingUtils::CompileTimeHashString("LIN");
+        static constexpr int LIT_HASH = HashingUtils::CompileTimeHashString("LIT");
+        static constexpr int LUB_HASH = HashingUtils::CompileTimeHashString("LUB");
+        static constexpr int LTZ_HASH = HashingUtils::CompileTimeHashString("LTZ");
+        static constexpr int MKD_HASH = HashingUtils::CompileTimeHashString("MKD");
+        static constexpr int MLG_HASH = HashingUtils::CompileTimeHashString("MLG");
+        static constexpr int MSA_HASH = HashingUtils::CompileTimeHashString("MSA");
+        static constexpr int MAL_HASH = HashingUtils::CompileTimeHashString("MAL");
+        static constexpr int MLT_HASH = HashingUtils::CompileTimeHashString("MLT");
+        static constexpr int GLV_HASH = HashingUtils::CompileTimeHashString("GLV");
+        static constexpr int MRI_HASH = HashingUtils::CompileTimeHashString("MRI");
+        static constexpr int MAR_HASH = HashingUtils::CompileTimeHashString("MAR");
+        static constexpr int MAH_HASH = HashingUtils::CompileTimeHashString("MAH");
+        static constexpr int MON_HASH = HashingUtils::CompileTimeHashString("MON");
+        static constexpr int NAU_HASH = HashingUtils::CompileTimeHashString("NAU");
+        static constexpr int NAV_HASH = HashingUtils::CompileTimeHashString("NAV");
+        static constexpr int NDE_HASH = HashingUtils::CompileTimeHashString("NDE");
+        static constexpr int NBL_HASH = HashingUtils::CompileTimeHashString("NBL");
+        static constexpr int NDO_HASH = HashingUtils::CompileTimeHashString("NDO");
+        static constexpr int NEP_HASH = HashingUtils::CompileTimeHashString("NEP");
+        static constexpr int SME_HASH = HashingUtils::CompileTimeHashString("SME");
+        static constexpr int NOR_HASH = HashingUtils::CompileTimeHashString("NOR");
+        static constexpr int NOB_HASH = HashingUtils::CompileTimeHashString("NOB");
+        static constexpr int NNO_HASH = HashingUtils::CompileTimeHashString("NNO");
+        static constexpr int OCI_HASH = HashingUtils::CompileTimeHashString("OCI");
+        static constexpr int OJI_HASH = HashingUtils::CompileTimeHashString("OJI");
+        static constexpr int ORI_HASH = HashingUtils::CompileTimeHashString("ORI");
+        static constexpr int ORM_HASH = HashingUtils::CompileTimeHashString("ORM");
+        static constexpr int OSS_HASH = HashingUtils::CompileTimeHashString("OSS");
+        static constexpr int PLI_HASH = HashingUtils::CompileTimeHashString("PLI");
+        static constexpr int FAS_HASH = HashingUtils::CompileTimeHashString("FAS");
+        static constexpr int POL_HASH = HashingUtils::CompileTimeHashString("POL");
+        static constexpr int PUS_HASH = HashingUtils::CompileTimeHashString("PUS");
+        static constexpr int QUE_HASH = HashingUtils::CompileTimeHashString("QUE");
+        static constexpr int QAA_HASH = HashingUtils::CompileTimeHashString("QAA");
+        static constexpr int RON_HASH = HashingUtils::CompileTimeHashString("RON");
+        static constexpr int ROH_HASH = HashingUtils::CompileTimeHashString("ROH");
+        static constexpr int RUN_HASH = HashingUtils::CompileTimeHashString("RUN");
+        static constexpr int SMO_HASH = HashingUtils::CompileTimeHashString("SMO");
+        static constexpr int SAG_HASH = HashingUtils::CompileTimeHashString("SAG");
+        static constexpr int SAN_HASH = HashingUtils::CompileTimeHashString("SAN");
+        static constexpr int SRD_HASH = HashingUtils::CompileTimeHashString("SRD");
+        static constexpr int SRB_HASH = HashingUtils::CompileTimeHashString("SRB");
+        static constexpr int SNA_HASH = HashingUtils::CompileTimeHashString("SNA");
+        static constexpr int III_HASH = HashingUtils::CompileTimeHashString("III");
+        static constexpr int SND_HASH = HashingUtils::CompileTimeHashString("SND");
+        static constexpr int SIN_HASH = HashingUtils::CompileTimeHashString("SIN");
+        static constexpr int SLK_HASH = HashingUtils::CompileTimeHashString("SLK");
+        static constexpr int SLV_HASH = HashingUtils::CompileTimeHashString("SLV");
+        static constexpr int SOM_HASH = HashingUtils::CompileTimeHashString("SOM");
+        static constexpr int SOT_HASH = HashingUtils::CompileTimeHashString("SOT");
+        static constexpr int SUN_HASH = HashingUtils::CompileTimeHashString("SUN");
+        static constexpr int SWA_HASH = HashingUtils::CompileTimeHashString("SWA");
+        static constexpr int SSW_HASH = HashingUtils::CompileTimeHashString("SSW");
+        static constexpr int SWE_HASH = HashingUtils::CompileTimeHashString("SWE");
+        static constexpr int TGL_HASH = HashingUtils::CompileTimeHashString("TGL");
+        static constexpr int TAH_HASH = HashingUtils::CompileTimeHashString("TAH");
+        static constexpr int TGK_HASH = HashingUtils::CompileTimeHashString("TGK");
+        static constexpr int TAM_HASH = HashingUtils::CompileTimeHashString("TAM");
+        static constexpr int TAT_HASH = HashingUtils::CompileTimeHashString("TAT");
+        static constexpr int TEL_HASH = HashingUtils::CompileTimeHashString("TEL");
+        static constexpr int THA_HASH = HashingUtils::CompileTimeHashString("THA");
+        static constexpr int BOD_HASH = HashingUtils::CompileTimeHashString("BOD");
+        static constexpr int TIR_HASH = HashingUtils::CompileTimeHashString("TIR");
+        static constexpr int TON_HASH = HashingUtils::CompileTimeHashString("TON");
+        static constexpr int TSO_HASH = HashingUtils::CompileTimeHashString("TSO");
+        static constexpr int TSN_HASH = HashingUtils::CompileTimeHashString("TSN");
+        static constexpr int TUR_HASH = HashingUtils::CompileTimeHashString("TUR");
+        static constexpr int TUK_HASH = HashingUtils::CompileTimeHashString("TUK");
+        static constexpr int TWI_HASH = HashingUtils::CompileTimeHashString("TWI");
+        static constexpr int UIG_HASH = HashingUtils::CompileTimeHashString("UIG");
+        static constexpr int UKR_HASH = HashingUtils::CompileTimeHashString("UKR");
+        static constexpr int UZB_HASH = HashingUtils::CompileTimeHashString("UZB");
+        static constexpr int VEN_HASH = HashingUtils::CompileTimeHashString("VEN");
+        static constexpr int VOL_HASH = HashingUtils::CompileTimeHashString("VOL");
+        static constexpr int WLN_HASH = HashingUtils::CompileTimeHashString("WLN");
+        static constexpr int CYM_HASH = HashingUtils::CompileTimeHashString("CYM");
+        static constexpr int FRY_HASH = HashingUtils::CompileTimeHashString("FRY");
+        static constexpr int WOL_HASH = HashingUtils::CompileTimeHashString("WOL");
+        static constexpr int XHO_HASH = HashingUtils::CompileTimeHashString("XHO");
+        static constexpr int YID_HASH = HashingUtils::CompileTimeHashString("YID");
+        static constexpr int YOR_HASH = HashingUtils::CompileTimeHashString("YOR");
+        static constexpr int ZHA_HASH = HashingUtils::CompileTimeHashString("ZHA");
+        static constexpr int ZUL_HASH = HashingUtils::CompileTimeHashString("ZUL");
+        static constexpr int ORJ_HASH = HashingUtils::CompileTimeHashString("ORJ");
+        static constexpr int QPC_HASH = HashingUtils::CompileTimeHashString("QPC");
+        static constexpr int TNG_HASH = HashingUtils::CompileTimeHashString("TNG");
 
-        /*
-        The if-else chains in this file are converted into a jump table by the compiler,
-        which allows constant time lookup. The chain has been broken into helper functions
-        because MSVC has a maximum of 122 chained if-else blocks.
-        */
-        static bool GetEnumForNameHelper0(int hashCode, LanguageCode& enumValue)
-        {
-          if (hashCode == ENG_HASH)
-          {
-            enumValue = LanguageCode::ENG;
-            return true;
-          }
-          else if (hashCode == SPA_HASH)
-          {
-            enumValue = LanguageCode::SPA;
-            return true;
-          }
-          else if (hashCode == FRA_HASH)
-          {
-            enumValue = LanguageCode::FRA;
-            return true;
-          }
-          else if (hashCode == DEU_HASH)
-          {
-            enumValue = LanguageCode::DEU;
-            return true;
-          }
-          else if (hashCode == GER_HASH)
-          {
-            enumValue = LanguageCode::GER;
-            return true;
-          }
-          else if (hashCode == ZHO_HASH)
-          {
-            enumValue = LanguageCode::ZHO;
-            return true;
-          }
-          else if (hashCode == ARA_HASH)
-          {
-            enumValue = LanguageCode::ARA;
-            return true;
-          }
-          else if (hashCode == HIN_HASH)
-          {
-            enumValue = LanguageCode::HIN;
-            return true;
-          }
-          else if (hashCode == JPN_HASH)
-          {
-            enumValue = LanguageCode::JPN;
-            return true;
-          }
-          else if (hashCode == RUS_HASH)
-          {
-            enumValue = LanguageCode::RUS;
-            return true;
-          }
-          else if (hashCode == POR_HASH)
-          {
-            enumValue = LanguageCode::POR;
-            return true;
-          }
-          else if (hashCode == ITA_HASH)
-          {
-            enumValue = LanguageCode::ITA;
-            return true;
-          }
-          else if (hashCode == URD_HASH)
-          {
-            enumValue = LanguageCode::URD;
-            return true;
-          }
-          else if (hashCode == VIE_HASH)
-          {
-            enumValue = LanguageCode::VIE;
-            return true;
-          }
-          else if (hashCode == KOR_HASH)
-          {
-            enumValue = LanguageCode::KOR;
-            return true;
-          }
-          else if (hashCode == PAN_HASH)
-          {
-            enumValue = LanguageCode::PAN;
-            return true;
-          }
-          else if (hashCode == ABK_HASH)
-          {
-            enumValue = LanguageCode::ABK;
-            return true;
-          }
-          else if (hashCode == AAR_HASH)
-          {
-            enumValue = LanguageCode::AAR;
-            return true;
-          }
-          else if (hashCode == AFR_HASH)
-          {
-            enumValue = LanguageCode::AFR;
-            return true;
-          }
-          else if (hashCode == AKA_HASH)
-          {
-            enumValue = LanguageCode::AKA;
-            return true;
-          }
-          else if (hashCode == SQI_HASH)
-          {
-            enumValue = LanguageCode::SQI;
-            return true;
-          }
-          else if (hashCode == AMH_HASH)
-          {
-            enumValue = LanguageCode::AMH;
-            return true;
-          }
-          else if (hashCode == ARG_HASH)
-          {
-            enumValue = LanguageCode::ARG;
-            return true;
-          }
-          else if (hashCode == HYE_HASH)
-          {
-            enumValue = LanguageCode::HYE;
-            return true;
-          }
-          else if (hashCode == ASM_HASH)
-          {
-            enumValue = LanguageCode::ASM;
-            return true;
-          }
-          else if (hashCode == AVA_HASH)
-          {
-            enumValue = LanguageCode::AVA;
-            return true;
-          }
-          else if (hashCode == AVE_HASH)
-          {
-            enumValue = LanguageCode::AVE;
-            return true;
-          }
-          else if (hashCode == AYM_HASH)
-          {
-            enumValue = LanguageCode::AYM;
-            return true;
-          }
-          else if (hashCode == AZE_HASH)
-          {
-            enumValue = LanguageCode::AZE;
-            return true;
-          }
-          else if (hashCode == BAM_HASH)
-          {
-            enumValue = LanguageCode::BAM;
-            return true;
-          }
-          else if (hashCode == BAK_HASH)
-          {
-            enumValue = LanguageCode::BAK;
-            return true;
-          }
-          else if (hashCode == EUS_HASH)
-          {
-            enumValue = LanguageCode::EUS;
-            return true;
-          }
-          else if (hashCode == BEL_HASH)
-          {
-            enumValue = LanguageCode::BEL;
-            return true;
-          }
-          else if (hashCode == BEN_HASH)
-          {
-            enumValue = LanguageCode::BEN;
-            return true;
-          }
-          else if (hashCode == BIH_HASH)
-          {
-            enumValue = LanguageCode::BIH;
-            return true;
-          }
-          else if (hashCode == BIS_HASH)
-          {
-            enumValue = LanguageCode::BIS;
-            return true;
-          }
-          else if (hashCode == BOS_HASH)
-          {
-            enumValue = LanguageCode::BOS;
-            return true;
-          }
-          else if (hashCode == BRE_HASH)
-          {
-            enumValue = LanguageCode::BRE;
-            return true;
-          }
-          else if (hashCode == BUL_HASH)
-          {
-            enumValue = LanguageCode::BUL;
-            return true;
-          }
-          else if (hashCode == MYA_HASH)
-          {
-            enumValue = LanguageCode::MYA;
-            return true;
-          }
-          else if (hashCode == CAT_HASH)
-          {
-            enumValue = LanguageCode::CAT;
-            return true;
-          }
-          else if (hashCode == KHM_HASH)
-          {
-            enumValue = LanguageCode::KHM;
-            return true;
-          }
-          else if (hashCode == CHA_HASH)
-          {
-            enumValue = LanguageCode::CHA;
-            return true;
-          }
-          else if (hashCode == CHE_HASH)
-          {
-            enumValue = LanguageCode::CHE;
-            return true;
-          }
-          else if (hashCode == NYA_HASH)
-          {
-            enumValue = LanguageCode::NYA;
-            return true;
-          }
-          else if (hashCode == CHU_HASH)
-          {
-            enumValue = LanguageCode::CHU;
-            return true;
-          }
-          else if (hashCode == CHV_HASH)
-          {
-            enumValue = LanguageCode::CHV;
-            return true;
-          }
-          else if (hashCode == COR_HASH)
-          {
-            enumValue = LanguageCode::COR;
-            return true;
-          }
-          else if (hashCode == COS_HASH)
-          {
-            enumValue = LanguageCode::COS;
-            return true;
-          }
-          else if (hashCode == CRE_HASH)
-          {
-            enumValue = LanguageCode::CRE;
-            return true;
-          }
-          else if (hashCode == HRV_HASH)
-          {
-            enumValue = LanguageCode::HRV;
-            return true;
-          }
-          else if (hashCode == CES_HASH)
-          {
-            enumValue = LanguageCode::CES;
-            return true;
-          }
-          else if (hashCode == DAN_HASH)
-          {
-            enumValue = LanguageCode::DAN;
-            return true;
-          }
-          else if (hashCode == DIV_HASH)
-          {
-            enumValue = LanguageCode::DIV;
-            return true;
-          }
-          else if (hashCode == NLD_HASH)
-          {
-            enumValue = LanguageCode::NLD;
-            return true;
-          }
-          else if (hashCode == DZO_HASH)
-          {
-            enumValue = LanguageCode::DZO;
-            return true;
-          }
-          else if (hashCode == ENM_HASH)
-          {
-            enumValue = LanguageCode::ENM;
-            return true;
-          }
-          else if (hashCode == EPO_HASH)
-          {
-            enumValue = LanguageCode::EPO;
-            return true;
-          }
-          else if (hashCode == EST_HASH)
-          {
-            enumValue = LanguageCode::EST;
-            return true;
-          }
-          else if (hashCode == EWE_HASH)
-          {
-            enumValue = LanguageCode::EWE;
-            return true;
-          }
-          else if (hashCode == FAO_HASH)
-          {
-            enumValue = LanguageCode::FAO;
-            return true;
-          }
-          else if (hashCode == FIJ_HASH)
-          {
-            enumValue = LanguageCode::FIJ;
-            return true;
-          }
-          else if (hashCode == FIN_HASH)
-          {
-            enumValue = LanguageCode::FIN;
-            return true;
-          }
-          else if (hashCode == FRM_HASH)
-          {
-            enumValue = LanguageCode::FRM;
-            return true;
-          }
-          else if (hashCode == FUL_HASH)
-          {
-            enumValue = LanguageCode::FUL;
-            return true;
-          }
-          else if (hashCode == GLA_HASH)
-          {
-            enumValue = LanguageCode::GLA;
-            return true;
-          }
-          else if (hashCode == GLG_HASH)
-          {
-            enumValue = LanguageCode::GLG;
-            return true;
-          }
-          else if (hashCode == LUG_HASH)
-          {
-            enumValue = LanguageCode::LUG;
-            return true;
-          }
-          else if (hashCode == KAT_HASH)
-          {
-            enumValue = LanguageCode::KAT;
-            return true;
-          }
-          else if (hashCode == ELL_HASH)
-          {
-            enumValue = LanguageCode::ELL;
-            return true;
-          }
-          else if (hashCode == GRN_HASH)
-          {
-            enumValue = LanguageCode::GRN;
-            return true;
-          }
-          else if (hashCode == GUJ_HASH)
-          {
-            enumValue = LanguageCode::GUJ;
-            return true;
-          }
-          else if (hashCode == HAT_HASH)
-          {
-            enumValue = LanguageCode::HAT;
-            return true;
-          }
-          else if (hashCode == HAU_HASH)
-          {
-            enumValue = LanguageCode::HAU;
-            return true;
-          }
-          else if (hashCode == HEB_HASH)
-          {
-            enumValue = LanguageCode::HEB;
-            return true;
-          }
-          else if (hashCode == HER_HASH)
-          {
-            enumValue = LanguageCode::HER;
-            return true;
-          }
-          else if (hashCode == HMO_HASH)
-          {
-            enumValue = LanguageCode::HMO;
-            return true;
-          }
-          else if (hashCode == HUN_HASH)
-          {
-            enumValue = LanguageCode::HUN;
-            return true;
-          }
-          else if (hashCode == ISL_HASH)
-          {
-            enumValue = LanguageCode::ISL;
-            return true;
-          }
-          else if (hashCode == IDO_HASH)
-          {
-            enumValue = LanguageCode::IDO;
-            return true;
-          }
-          else if (hashCode == IBO_HASH)
-          {
-            enumValue = LanguageCode::IBO;
-            return true;
-          }
-          else if (hashCode == IND_HASH)
-          {
-            enumValue = LanguageCode::IND;
-            return true;
-          }
-          else if (hashCode == INA_HASH)
-          {
-            enumValue = LanguageCode::INA;
-            return true;
-          }
-          else if (hashCode == ILE_HASH)
-          {
-            enumValue = LanguageCode::ILE;
-            return true;
-          }
-          else if (hashCode == IKU_HASH)
-          {
-            enumValue = LanguageCode::IKU;
-            return true;
-          }
-          else if (hashCode == IPK_HASH)
-          {
-            enumValue = LanguageCode::IPK;
-            return true;
-          }
-          else if (hashCode == GLE_HASH)
-          {
-            enumValue = LanguageCode::GLE;
-            return true;
-          }
-          else if (hashCode == JAV_HASH)
-          {
-            enumValue = LanguageCode::JAV;
-            return true;
-          }
-          else if (hashCode == KAL_HASH)
-          {
-            enumValue = LanguageCode::KAL;
-            return true;
-          }
-          else if (hashCode == KAN_HASH)
-          {
-            enumValue = LanguageCode::KAN;
-            return true;
-          }
-          else if (hashCode == KAU_HASH)
-          {
-            enumValue = LanguageCode::KAU;
-            return true;
-          }
-          else if (hashCode == KAS_HASH)
-          {
-            enumValue = LanguageCode::KAS;
-            return true;
-          }
-          else if (hashCode == KAZ_HASH)
-          {
-            enumValue = LanguageCode::KAZ;
-            return true;
-          }
-          else if (hashCode == KIK_HASH)
-          {
-            enumValue = LanguageCode::KIK;
-            return true;
-          }
-          else if (hashCode == KIN_HASH)
-          {
-            enumValue = LanguageCode::KIN;
-            return true;
-          }
-          else if (hashCode == KIR_HASH)
-          {
-            enumValue = LanguageCode::KIR;
-            return true;
-          }
-          else if (hashCode == KOM_HASH)
-          {
-            enumValue = LanguageCode::KOM;
-            return true;
-          }
-          else if (hashCode == KON_HASH)
-          {
-            enumValue = LanguageCode::KON;
-            return true;
-          }
-          else if (hashCode == KUA_HASH)
-          {
-            enumValue = LanguageCode::KUA;
-            return true;
-          }
-          else if (hashCode == KUR_HASH)
-          {
-            enumValue = LanguageCode::KUR;
-            return true;
-          }
-          else if (hashCode == LAO_HASH)
-          {
-            enumValue = LanguageCode::LAO;
-            return true;
-          }
-          else if (hashCode == LAT_HASH)
-          {
-            enumValue = LanguageCode::LAT;
-            return true;
-          }
-          else if (hashCode == LAV_HASH)
-          {
-            enumValue = LanguageCode::LAV;
-            return true;
-          }
-          else if (hashCode == LIM_HASH)
-          {
-            enumValue = LanguageCode::LIM;
-            return true;
-          }
-          else if (hashCode == LIN_HASH)
-          {
-            enumValue = LanguageCode::LIN;
-            return true;
-          }
-          else if (hashCode == LIT_HASH)
-          {
-            enumValue = LanguageCode::LIT;
-            return true;
-          }
-          else if (hashCode == LUB_HASH)
-          {
-            enumValue = LanguageCode::LUB;
-            return true;
-          }
-          else if (hashCode == LTZ_HASH)
-          {
-            enumValue = LanguageCode::LTZ;
-            return true;
-          }
-          else if (hashCode == MKD_HASH)
-          {
-            enumValue = LanguageCode::MKD;
-            return true;
-          }
-          else if (hashCode == MLG_HASH)
-          {
-            enumValue = LanguageCode::MLG;
-            return true;
-          }
-          else if (hashCode == MSA_HASH)
-          {
-            enumValue = LanguageCode::MSA;
-            return true;
-          }
-          else if (hashCode == MAL_HASH)
-          {
-            enumValue = LanguageCode::MAL;
-            return true;
-          }
-          else if (hashCode == MLT_HASH)
-          {
-            enumValue = LanguageCode::MLT;
-            return true;
-          }
-          else if (hashCode == GLV_HASH)
-          {
-            enumValue = LanguageCode::GLV;
-            return true;
-          }
-          else if (hashCode == MRI_HASH)
-          {
-            enumValue = LanguageCode::MRI;
-            return true;
-          }
-          else if (hashCode == MAR_HASH)
-          {
-            enumValue = LanguageCode::MAR;
-            return true;
-          }
-          else if (hashCode == MAH_HASH)
-          {
-            enumValue = LanguageCode::MAH;
-            return true;
-          }
-          else if (hashCode == MON_HASH)
-          {
-            enumValue = LanguageCode::MON;
-            return true;
-          }
-          else if (hashCode == NAU_HASH)
-          {
-            enumValue = LanguageCode::NAU;
-            return true;
-          }
-          else if (hashCode == NAV_HASH)
-          {
-            enumValue = LanguageCode::NAV;
-            return true;
-          }
-          else if (hashCode == NDE_HASH)
-          {
-            enumValue = LanguageCode::NDE;
-            return true;
-          }
-          else if (hashCode == NBL_HASH)
-          {
-            enumValue = LanguageCode::NBL;
-            return true;
-          }
-          return false;
-        }
-        static bool GetEnumForNameHelper1(int hashCode, LanguageCode& enumValue)
+
+        LanguageCode GetLanguageCodeForName(const Aws::String& name)
         {
-          if (hashCode == NDO_HASH)
-          {
-            enumValue = LanguageCode::NDO;
-            return true;
-          }
-          else if (hashCode == NEP_HASH)
-          {
-            enumValue = LanguageCode::NEP;
-            return true;
-          }
-          else if (hashCode == SME_HASH)
-          {
-            enumValue = LanguageCode::SME;
-            return true;
-          }
-          else if (hashCode == NOR_HASH)
-          {
-            enumValue = LanguageCode::NOR;
-            return true;
-          }
-          else if (hashCode == NOB_HASH)
-          {
-            enumValue = LanguageCode::NOB;
-            return true;
-          }
-          else if (hashCode == NNO_HASH)
-          {
-            enumValue = LanguageCode::NNO;
-            return true;
-          }
-          else if (hashCode == OCI_HASH)
-          {
-            enumValue = LanguageCode::OCI;
-            return true;
-          }
-          else if (hashCode == OJI_HASH)
-          {
-            enumValue = LanguageCode::OJI;
-            return true;
-          }
-          else if (hashCode == ORI_HASH)
-          {
-            enumValue = LanguageCode::ORI;
-            return true;
-          }
-          else if (hashCode == ORM_HASH)
-          {
-            enumValue = LanguageCode::ORM;
-            return true;
-          }
-          else if (hashCode == OSS_HASH)
-          {
-            enumValue = LanguageCode::OSS;
-            return true;
-          }
-          else if (hashCode == PLI_HASH)
-          {
-            enumValue = LanguageCode::PLI;
-            return true;
-          }
-          else if (hashCode == FAS_HASH)
-          {
-            enumValue = LanguageCode::FAS;
-            return true;
-          }
-          else if (hashCode == POL_HASH)
-          {
-            enumValue = LanguageCode::POL;
-            return true;
-          }
-          else if (hashCode == PUS_HASH)
-          {
-            enumValue = LanguageCode::PUS;
-            return true;
-          }
-          else if (hashCode == QUE_HASH)
-          {
-            enumValue = LanguageCode::QUE;
-            return true;
-          }
-          else if (hashCode == QAA_HASH)
-          {
-            enumValue = LanguageCode::QAA;
-            return true;
-          }
-          else if (hashCode == RON_HASH)
-          {
-            enumValue = LanguageCode::RON;
-            return true;
-          }
-          else if (hashCode == ROH_HASH)
-          {
-            enumValue = LanguageCode::ROH;
-            return true;
-          }
-          else if (hashCode == RUN_HASH)
-          {
-            enumValue = LanguageCode::RUN;
-            return true;
-          }
-          else if (hashCode == SMO_HASH)
-          {
-            enumValue = LanguageCode::SMO;
-            return true;
-          }
-          else if (hashCode == SAG_HASH)
-          {
-            enumValue = LanguageCode::SAG;
-            return true;
-          }
-          else if (hashCode == SAN_HASH)
-          {
-            enumValue = LanguageCode::SAN;
-            return true;
-          }
-          else if (hashCode == SRD_HASH)
-          {
-            enumValue = LanguageCode::SRD;
-            return true;
-          }
-          else if (hashCode == SRB_HASH)
-          {
-            enumValue = LanguageCode::SRB;
-            return true;
-          }
-          else if (hashCode == SNA_HASH)
-          {
-            enumValue = LanguageCode::SNA;
-            return true;
-          }
-          else if (hashCode == III_HASH)
-          {
-            enumValue = LanguageCode::III;
-            return true;
-          }
-          else if (hashCode == SND_HASH)
-          {
-            enumValue = LanguageCode::SND;
-            return true;
-          }
-          else if (hashCode == SIN_HASH)
-          {
-            enumValue = LanguageCode::SIN;
-            return true;
-          }
-          else if (hashCode == SLK_HASH)
-          {
-            enumValue = LanguageCode::SLK;
-            return true;
-          }
-          else if (hashCode == SLV_HASH)
-          {
-            enumValue = LanguageCode::SLV;
-            return true;
-          }
-          else if (hashCode == SOM_HASH)
-          {
-            enumValue = LanguageCode::SOM;
-            return true;
-          }
-          else if (hashCode == SOT_HASH)
-          {
-            enumValue = LanguageCode::SOT;
-            return true;
-          }
-          else if (hashCode == SUN_HASH)
-          {
-            enumValue = LanguageCode::SUN;
-            return true;
-          }
-          else if (hashCode == SWA_HASH)
-          {
-            enumValue = LanguageCode::SWA;
-            return true;
-          }
-          else if (hashCode == SSW_HASH)
-          {
-            enumValue = LanguageCode::SSW;
-            return true;
-          }
-          else if (hashCode == SWE_HASH)
-          {
-            enumValue = LanguageCode::SWE;
-            return true;
-          }
-          else if (hashCode == TGL_HASH)
-          {
-            enumValue = LanguageCode::TGL;
-            return true;
-          }
-          else if (hashCode == TAH_HASH)
-          {
-            enumValue = LanguageCode::TAH;
-            return true;
-          }
-          else if (hashCode == TGK_HASH)
-          {
-            enumValue = LanguageCode::TGK;
-            return true;
-          }
-          else if (hashCode == TAM_HASH)
-          {
-            enumValue = LanguageCode::TAM;
-            return true;
-          }
-          else if (hashCode == TAT_HASH)
-          {
-            enumValue = LanguageCode::TAT;
-            return true;
-          }
-          else if (hashCode == TEL_HASH)
-          {
-            enumValue = LanguageCode::TEL;
-            return true;
-          }
-          else if (hashCode == THA_HASH)
-          {
-            enumValue = LanguageCode::THA;
-            return true;
-          }
-          else if (hashCode == BOD_HASH)
-          {
-            enumValue = LanguageCode::BOD;
-            return true;
-          }
-          else if (hashCode == TIR_HASH)
-          {
-            enumValue = LanguageCode::TIR;
-            return true;
-          }
-          else if (hashCode == TON_HASH)
-          {
-            enumValue = LanguageCode::TON;
-            return true;
-          }
-          else if (hashCode == TSO_HASH)
-          {
-            enumValue = LanguageCode::TSO;
-            return true;
-          }
-          else if (hashCode == TSN_HASH)
-          {
-            enumValue = LanguageCode::TSN;
-            return true;
-          }
-          else if (hashCode == TUR_HASH)
-          {
-            enumValue = LanguageCode::TUR;
-            return true;
-          }
-          else if (hashCode == TUK_HASH)
-          {
-            enumValue = LanguageCode::TUK;
-            return true;
-          }
-          else if (hashCode == TWI_HASH)
-          {
-            enumValue = LanguageCode::TWI;
-            return true;
-          }
-          else if (hashCode == UIG_HASH)
-          {
-            enumValue = LanguageCode::UIG;
-            return true;
-          }
-          else if (hashCode == UKR_HASH)
-          {
-            enumValue = LanguageCode::UKR;
-            return true;
-          }
-          else if (hashCode == UZB_HASH)
-          {
-            enumValue = LanguageCode::UZB;
-            return true;
-          }
-          else if (hashCode == VEN_HASH)
-          {
-            enumValue = LanguageCode::VEN;
-            return true;
-          }
-          else if (hashCode == VOL_HASH)
-          {
-            enumValue = LanguageCode::VOL;
-            return true;
-          }
-          else if (hashCode == WLN_HASH)
-          {
-            enumValue = LanguageCode::WLN;
-            return true;
-          }
-          else if (hashCode == CYM_HASH)
-          {
-            enumValue = LanguageCode::CYM;
-            return true;
-          }
-          else if (hashCode == FRY_HASH)
-          {
-            enumValue = LanguageCode::FRY;
-            return true;
-          }
-          else if (hashCode == WOL_HASH)
-          {
-            enumValue = LanguageCode::WOL;
-            return true;
-          }
-          else if (hashCode == XHO_HASH)
-          {
-            enumValue = LanguageCode::XHO;
-            return true;
-          }
-          else if (hashCode == YID_HASH)
-          {
-            enumValue = LanguageCode::YID;
-            return true;
-          }
-          else if (hashCode == YOR_HASH)
-          {
-            enumValue = LanguageCode::YOR;
-            return true;
-          }
-          else if (hashCode == ZHA_HASH)
-          {
-            enumValue = LanguageCode::ZHA;
-            return true;
-          }
-          else if (hashCode == ZUL_HASH)
-          {
-            enumValue = LanguageCode::ZUL;
-            return true;
-          }
-          else if (hashCode == ORJ_HASH)
-          {
-            enumValue = LanguageCode::ORJ;
-            return true;
-          }
-          else if (hashCode == QPC_HASH)
-          {
-            enumValue = LanguageCode::QPC;
-            return true;
+          int hashCode = HashingUtils::HashString(name.c_str());
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
+          {
+          case ENG_HASH:
+            if (name == "ENG")
+            {
+              return LanguageCode::ENG;
+            }
+            break;
+          case SPA_HASH:
+            if (name == "SPA")
+            {
+              return LanguageCode::SPA;
+            }
+            break;
+          case FRA_HASH:
+            if (name == "FRA")
+            {
+              return LanguageCode::FRA;
+            }
+            break;
+          case DEU_HASH:
+            if (name == "DEU")
+            {
+              return LanguageCode::DEU;
+            }
+            break;
+          case GER_HASH:
+            if (name == "GER")
+            {
+              return LanguageCode::GER;
+            }
+            break;
+          case ZHO_HASH:
+            if (name == "ZHO")
+            {
+              return LanguageCode::ZHO;
+            }
+            break;
+          case ARA_HASH:
+            if (name == "ARA")
+            {
+              return LanguageCode::ARA;
+            }
+            break;
+          case HIN_HASH:
+            if (name == "HIN")
+            {
+              return LanguageCode::HIN;
+            }
+            break;
+          case JPN_HASH:
+            if (name == "JPN")
+            {
+              return LanguageCode::JPN;
+            }
+            break;
+          case RUS_HASH:
+            if (name == "RUS")
+            {
+              return LanguageCode::RUS;
+            }
+            break;
+          case POR_HASH:
+            if (name == "POR")
+            {
+              return LanguageCode::POR;
+            }
+            break;
+          case ITA_HASH:
+            if (name == "ITA")
+            {
+              return LanguageCode::ITA;
+            }
+            break;
+          case URD_HASH:
+            if (name == "URD")
+            {
+              return LanguageCode::URD;
+            }
+            break;
+          case VIE_HASH:
+            if (name == "VIE")
+            {
+              return LanguageCode::VIE;
+            }
+            break;
+          case KOR_HASH:
+            if (name == "KOR")
+            {
+              return LanguageCode::KOR;
+            }
+            break;
+          case PAN_HASH:
+            if (name == "PAN")
+            {
+              return LanguageCode::PAN;
+            }
+            break;
+          case ABK_HASH:
+            if (name == "ABK")
+            {
+              return LanguageCode::ABK;
+            }
+            break;
+          case AAR_HASH:
+            if (name == "AAR")
+            {
+              return LanguageCode::AAR;
+            }
+            break;
+          case AFR_HASH:
+            if (name == "AFR")
+            {
+              return LanguageCode::AFR;
+            }
+            break;
+          case AKA_HASH:
+            if (name == "AKA")
+            {
+              return LanguageCode::AKA;
+            }
+            break;
+          case SQI_HASH:
+            if (name == "SQI")
+            {
+              return LanguageCode::SQI;
+            }
+            break;
+          case AMH_HASH:
+            if (name == "AMH")
+            {
+              return LanguageCode::AMH;
+            }
+            break;
+          case ARG_HASH:
+            if (name == "ARG")
+            {
+              return LanguageCode::ARG;
+            }
+            break;
+          case HYE_HASH:
+            if (name == "HYE")
+            {
+              return LanguageCode::HYE;
+            }
+            break;
+          case ASM_HASH:
+            if (name == "ASM")
+            {
+              return LanguageCode::ASM;
+            }
+            break;
+          case AVA_HASH:
+            if (name == "AVA")
+            {
+              return LanguageCode::AVA;
+            }
+            break;
+          case AVE_HASH:
+            if (name == "AVE")
+            {
+              return LanguageCode::AVE;
+            }
+            break;
+          case AYM_HASH:
+            if (name == "AYM")
+            {
+              return LanguageCode::AYM;
+            }
+            break;
+          case AZE_HASH:
+            if (name == "AZE")
+            {
+              return LanguageCode::AZE;
+            }
+            break;
+          case BAM_HASH:
+            if (name == "BAM")
+            {
+              return LanguageCode::BAM;
+            }
+            break;
+          case BAK_HASH:
+            if (name == "BAK")
+            {
+              return LanguageCode::BAK;
+            }
+            break;
+          case EUS_HASH:
+            if (name == "EUS")
+            {
+              return LanguageCode::EUS;
+            }
+            break;
+          case BEL_HASH:
+            if (name == "BEL")
+            {
+              return LanguageCode::BEL;
+            }
+            break;
+          case BEN_HASH:
+            if (name == "BEN")
+            {
+              return LanguageCode::BEN;
+            }
+            break;
+          case BIH_HASH:
+            if (name == "BIH")
+            {
+              return LanguageCode::BIH;
+            }
+            break;
+          case BIS_HASH:
+            if (name == "BIS")
+            {
+              return LanguageCode::BIS;
+            }
+            break;
+          case BOS_HASH:
+            if (name == "BOS")
+            {
+              return LanguageCode::BOS;
+            }
+            break;
+          case BRE_HASH:
+            if (name == "BRE")
+            {
+              return LanguageCode::BRE;
+            }
+            break;
+          case BUL_HASH:
+            if (name == "BUL")
+            {
+              return LanguageCode::BUL;
+            }
+            break;
+          case MYA_HASH:
+            if (name == "MYA")
+            {
+              return LanguageCode::MYA;
+            }
+            break;
+          case CAT_HASH:
+            if (name == "CAT")
+            {
+              return LanguageCode::CAT;
+            }
+            break;
+          case KHM_HASH:
+            if (name == "KHM")
+            {
+              return LanguageCode::KHM;
+            }
+            break;
+          case CHA_HASH:
+            if (name == "CHA")
+            {
+              return LanguageCode::CHA;
+            }
+            break;
+          case CHE_HASH:
+            if (name == "CHE")
+            {
+              return LanguageCode::CHE;
+            }
+            break;
+          case NYA_HASH:
+            if (name == "NYA")
+            {
+              return LanguageCode::NYA;
+            }
+            break;
+          case CHU_HASH:
+            if (name == "CHU")
+            {
+              return LanguageCode::CHU;
+            }
+            break;
+          case CHV_HASH:
+            if (name == "CHV")
+            {
+              return LanguageCode::CHV;
+            }
+            break;
+          case COR_HASH:
+            if (name == "COR")
+            {
+              return LanguageCode::COR;
+            }
+            break;
+          case COS_HASH:
+            if (name == "COS")
+            {
+              return LanguageCode::COS;
+            }
+            break;
+          case CRE_HASH:
+            if (name == "CRE")
+            {
+              return LanguageCode::CRE;
+            }
+            break;
+          case HRV_HASH:
+            if (name == "HRV")
+            {
+              return LanguageCode::HRV;
+            }
+            break;
+          case CES_HASH:
+            if (name == "CES")
+            {
+              return LanguageCode::CES;
+            }
+            break;
+          case DAN_HASH:
+            if (name == "DAN")
+            {
+              return LanguageCode::DAN;
+            }
+            break;
+          case DIV_HASH:
+            if (name == "DIV")
+            {
+              return LanguageCode::DIV;
+            }
+            break;
+          case NLD_HASH:
+            if (name == "NLD")
+            {
+              return LanguageCode::NLD;
+            }
+            break;
+          case DZO_HASH:
+            if (name == "DZO")
+            {
+              return LanguageCode::DZO;
+            }
+            break;
+          case ENM_HASH:
+            if (name == "ENM")
+            {
+              return LanguageCode::ENM;
+            }
+            break;
+          case EPO_HASH:
+            if (name == "EPO")
+            {
+              return LanguageCode::EPO;
+            }
+            break;
+          case EST_HASH:
+            if (name == "EST")
+            {
+              return LanguageCode::EST;
+            }
+            break;
+          case EWE_HASH:
+            if (name == "EWE")
+            {
+              return LanguageCode::EWE;
+            }
+            break;
+          case FAO_HASH:
+            if (name == "FAO")
+            {
+              return LanguageCode::FAO;
+            }
+            break;
+          case FIJ_HASH:
+            if (name == "FIJ")
+            {
+              return LanguageCode::FIJ;
+            }
+            break;
+          case FIN_HASH:
+            if (name == "FIN")
+            {
+              return LanguageCode::FIN;
+            }
+            break;
+          case FRM_HASH:
+            if (name == "FRM")
+            {
+              return LanguageCode::FRM;
+            }
+            break;
+          case FUL_HASH:
+            if (name == "FUL")
+            {
+              return LanguageCode::FUL;
+            }
+            break;
+          case GLA_HASH:
+            if (name == "GLA")
+            {
+              return LanguageCode::GLA;
+            }
+            break;
+          case GLG_HASH:
+            if (name == "GLG")
+            {
+              return LanguageCode::GLG;
+            }
+            break;
+          case LUG_HASH:
+            if (name == "LUG")
+            {
+              return LanguageCode::LUG;
+            }
+            break;
+          case KAT_HASH:
+            if (name == "KAT")
+            {
+              return LanguageCode::KAT;
+            }
+            break;
+          case ELL_HASH:
+            if (name == "ELL")
+            {
+              return LanguageCode::ELL;
+            }
+            break;
+          case GRN_HASH:
+            if (name == "GRN")
+            {
+              return LanguageCode::GRN;
+            }
+            break;
+          case GUJ_HASH:
+            if (name == "GUJ")
+            {
+              return LanguageCode::GUJ;
+            }
+            break;
+          case HAT_HASH:
+            if (name == "HAT")
+            {
+              return LanguageCode::HAT;
+            }
+            break;
+          case HAU_HASH:
+            if (name == "HAU")
+            {
+              return LanguageCode::HAU;
+            }
+            break;
+          case HEB_HASH:
+            if (name == "HEB")
+            {
+              return LanguageCode::HEB;
+            }
+            break;
+          case HER_HASH:
+            if (name == "HER")
+            {
+              return LanguageCode::HER;
+            }
+            break;
+          case HMO_HASH:
+            if (name == "HMO")
+            {
+              return LanguageCode::HMO;
+            }
+            break;
+          case HUN_HASH:
+            if (name == "HUN")
+            {
+              return LanguageCode::HUN;
+            }
+            break;
+          case ISL_HASH:
+            if (name == "ISL")
+            {
+              return LanguageCode::ISL;
+            }
+            break;
+          case IDO_HASH:
+            if (name == "IDO")
+            {
+              return LanguageCode::IDO;
+            }
+            break;
+          case IBO_HASH:
+            if (name == "IBO")
+            {
+              return LanguageCode::IBO;
+            }
+            break;
+          case IND_HASH:
+            if (name == "IND")
+            {
+              return LanguageCode::IND;
+            }
+            break;
+          case INA_HASH:
+            if (name == "INA")
+            {
+              return LanguageCode::INA;
+            }
+            break;
+          case ILE_HASH:
+            if (name == "ILE")
+            {
+              return LanguageCode::ILE;
+            }
+            break;
+          case IKU_HASH:
+            if (name == "IKU")
+            {
+              return LanguageCode::IKU;
+            }
+            break;
+          case IPK_HASH:
+            if (name == "IPK")
+            {
+              return LanguageCode::IPK;
+            }
+            break;
+          case GLE_HASH:
+            if (name == "GLE")
+            {
+              return LanguageCode::GLE;
+            }
+            break;
+          case JAV_HASH:
+            if (name == "JAV")
+            {
+              return LanguageCode::JAV;
+            }
+            break;
+          case KAL_HASH:
+            if (name == "KAL")
+            {
+              return LanguageCode::KAL;
+            }
+            break;
+          case KAN_HASH:
+            if (name == "KAN")
+            {
+              return LanguageCode::KAN;
+            }
+            break;
+          case KAU_HASH:
+            if (name == "KAU")
+            {
+              return LanguageCode::KAU;
+            }
+            break;
+          case KAS_HASH:
+            if (name == "KAS")
+            {
+              return LanguageCode::KAS;
+            }
+            break;
+          case KAZ_HASH:
+            if (name == "KAZ")
+            {
+              return LanguageCode::KAZ;
+            }
+            break;
+          case KIK_HASH:
+            if (name == "KIK")
+            {
+              return LanguageCode::KIK;
+            }
+            break;
+          case KIN_HASH:
+            if (name == "KIN")
+            {
+              return LanguageCode::KIN;
+            }
+            break;
+          case KIR_HASH:
+            if (name == "KIR")
+            {
+              return LanguageCode::KIR;
+            }
+            break;
+          case KOM_HASH:
+            if (name == "KOM")
+            {
+              return LanguageCode::KOM;
+            }
+            break;
+          case KON_HASH:
+            if (name == "KON")
+            {
+              return LanguageCode::KON;
+            }
+            break;
+          case KUA_HASH:
+            if (name == "KUA")
+            {
+              return LanguageCode::KUA;
+            }
+            break;
+          case KUR_HASH:
+            if (name == "KUR")
+            {
+              return LanguageCode::KUR;
+            }
+            break;
+          case LAO_HASH:
+            if (name == "LAO")
+            {
+              return LanguageCode::LAO;
+            }
+            break;
+          case LAT_HASH:
+            if (name == "LAT")
+            {
+              return LanguageCode::LAT;
+            }
+            break;
+          case LAV_HASH:
+            if (name == "LAV")
+            {
+              return LanguageCode::LAV;
+            }
+            break;
+          case LIM_HASH:
+            if (name == "LIM")
+            {
+              return LanguageCode::LIM;
+            }
+            break;
+          case LIN_HASH:
+            if (name == "LIN")
+            {
+              return LanguageCode::LIN;
+            }
+            break;
+          case LIT_HASH:
+            if (name == "LIT")
+            {
+              return LanguageCode::LIT;
+            }
+            break;
+          case LUB_HASH:
+            if (name == "LUB")
+            {
+              return LanguageCode::LUB;
+            }
+            break;
+          case LTZ_HASH:
+            if (name == "LTZ")
+            {
+              return LanguageCode::LTZ;
+            }
+            break;
+          case MKD_HASH:
+            if (name == "MKD")
+            {
+              return LanguageCode::MKD;
+            }
+            break;
+          case MLG_HASH:
+            if (name == "MLG")
+            {
+              return LanguageCode::MLG;
+            }
+            break;
+          case MSA_HASH:
+            if (name == "MSA")
+            {
+              return LanguageCode::MSA;
+            }
+            break;
+          case MAL_HASH:
+            if (name == "MAL")
+            {
+              return LanguageCode::MAL;
+            }
+            break;
+          case MLT_HASH:
+            if (name == "MLT")
+            {
+              return LanguageCode::MLT;
+            }
+            break;
+          case GLV_HASH:
+            if (name == "GLV")
+            {
+              return LanguageCode::GLV;
+            }
+            break;
+          case MRI_HASH:
+            if (name == "MRI")
+            {
+              return LanguageCode::MRI;
+            }
+            break;
+          case MAR_HASH:
+            if (name == "MAR")
+            {
+              return LanguageCode::MAR;
+            }
+            break;
+          case MAH_HASH:
+            if (name == "MAH")
+            {
+              return LanguageCode::MAH;
+            }
+            break;
+          case MON_HASH:
+            if (name == "MON")
+            {
+              return LanguageCode::MON;
+            }
+            break;
+          case NAU_HASH:
+            if (name == "NAU")
+            {
+              return LanguageCode::NAU;
+            }
+            break;
+          case NAV_HASH:
+            if (name == "NAV")
+            {
+              return LanguageCode::NAV;
+            }
+            break;
+          case NDE_HASH:
+            if (name == "NDE")
+            {
+              return LanguageCode::NDE;
+            }
+            break;
+          case NBL_HASH:
+            if (name == "NBL")
+            {
+              return LanguageCode::NBL;
+            }
+            break;
+          case NDO_HASH:
+            if (name == "NDO")
+            {
+              return LanguageCode::NDO;
+            }
+            break;
+          case NEP_HASH:
+            if (name == "NEP")
+            {
+              return LanguageCode::NEP;
+            }
+            break;
+          case SME_HASH:
+            if (name == "SME")
+            {
+              return LanguageCode::SME;
+            }
+            break;
+          case NOR_HASH:
+            if (name == "NOR")
+            {
+              return LanguageCode::NOR;
+            }
+            break;
+          case NOB_HASH:
+            if (name == "NOB")
+            {
+              return LanguageCode::NOB;
+            }
+            break;
+          case NNO_HASH:
+            if (name == "NNO")
+            {
+              return LanguageCode::NNO;
+            }
+            break;
+          case OCI_HASH:
+            if (name == "OCI")
+            {
+              return LanguageCode::OCI;
+            }
+            break;
+          case OJI_HASH:
+            if (name == "OJI")
+            {
+              return LanguageCode::OJI;
+            }
+            break;
+          case ORI_HASH:
+            if (name == "ORI")
+            {
+              return LanguageCode::ORI;
+            }
+            break;
+          case ORM_HASH:
+            if (name == "ORM")
+            {
+              return LanguageCode::ORM;
+            }
+            break;
+          case OSS_HASH:
+            if (name == "OSS")
+            {
+              return LanguageCode::OSS;
+            }
+            break;
+          case PLI_HASH:
+            if (name == "PLI")
+            {
+              return LanguageCode::PLI;
+            }
+            break;
+          case FAS_HASH:
+            if (name == "FAS")
+            {
+              return LanguageCode::FAS;
+            }
+            break;
+          case POL_HASH:
+            if (name == "POL")
+            {
+              return LanguageCode::POL;
+            }
+            break;
+          case PUS_HASH:
+            if (name == "PUS")
+            {
+              return LanguageCode::PUS;
+            }
+            break;
+          case QUE_HASH:
+            if (name == "QUE")
+            {
+              return LanguageCode::QUE;
+            }
+            break;
+          case QAA_HASH:
+            if (name == "QAA")
+            {
+              return LanguageCode::QAA;
+            }
+            break;
+          case RON_HASH:
+            if (name == "RON")
+            {
+              return LanguageCode::RON;
+            }
+            break;
+          case ROH_HASH:
+            if (name == "ROH")
+            {
+              return LanguageCode::ROH;
+            }
+            break;
+          case RUN_HASH:
+            if (name == "RUN")
+            {
+              return LanguageCode::RUN;
+            }
+            break;
+          case SMO_HASH:
+            if (name == "SMO")
+            {
+              return LanguageCode::SMO;
+            }
+            break;
+          case SAG_HASH:
+            if (name == "SAG")
+            {
+              return LanguageCode::SAG;
+            }
+            break;
+          case SAN_HASH:
+            if (name == "SAN")
+            {
+              return LanguageCode::SAN;
+            }
+            break;
+          case SRD_HASH:
+            if (name == "SRD")
+            {
+              return LanguageCode::SRD;
+            }
+            break;
+          case SRB_HASH:
+            if (name == "SRB")
+            {
+              return LanguageCode::SRB;
+            }
+            break;
+          case SNA_HASH:
+            if (name == "SNA")
+            {
+              return LanguageCode::SNA;
+            }
+            break;
+          case III_HASH:
+            if (name == "III")
+            {
+              return LanguageCode::III;
+            }
+            break;
+          case SND_HASH:
+            if (name == "SND")
+            {
+              return LanguageCode::SND;
+            }
+            break;
+          case SIN_HASH:
+            if (name == "SIN")
+            {
+              return LanguageCode::SIN;
+            }
+            break;
+          case SLK_HASH:
+            if (name == "SLK")
+            {
+              return LanguageCode::SLK;
+            }
+            break;
+          case SLV_HASH:
+            if (name == "SLV")
+            {
+              return LanguageCode::SLV;
+            }
+            break;
+          case SOM_HASH:
+            if (name == "SOM")
+            {
+              return LanguageCode::SOM;
+            }
+            break;
+          case SOT_HASH:
+            if (name == "SOT")
+            {
+              return LanguageCode::SOT;
+            }
+            break;
+          case SUN_HASH:
+            if (name == "SUN")
+            {
+              return LanguageCode::SUN;
+            }
+            break;
+          case SWA_HASH:
+            if (name == "SWA")
+            {
+              return LanguageCode::SWA;
+            }
+            break;
+          case SSW_HASH:
+            if (name == "SSW")
+            {
+              return LanguageCode::SSW;
+            }
+            break;
+          case SWE_HASH:
+            if (name == "SWE")
+            {
+              return LanguageCode::SWE;
+            }
+            break;
+          case TGL_HASH:
+            if (name == "TGL")
+            {
+              return LanguageCode::TGL;
+            }
+            break;
+          case TAH_HASH:
+            if (name == "TAH")
+            {
+              return LanguageCode::TAH;
+            }
+            break;
+          case TGK_HASH:
+            if (name == "TGK")
+            {
+              return LanguageCode::TGK;
+            }
+            break;
+          case TAM_HASH:
+            if (name == "TAM")
+            {
+              return LanguageCode::TAM;
+            }
+            break;
+          case TAT_HASH:
+            if (name == "TAT")
+            {
+              return LanguageCode::TAT;
+            }
+            break;
+          case TEL_HASH:
+            if (name == "TEL")
+            {
+              return LanguageCode::TEL;
+            }
+            break;
+          case THA_HASH:
+            if (name == "THA")
+            {
+              return LanguageCode::THA;
+            }
+            break;
+          case BOD_HASH:
+            if (name == "BOD")
+            {
+              return LanguageCode::BOD;
+            }
+            break;
+          case TIR_HASH:
+            if (name == "TIR")
+            {
+              return LanguageCode::TIR;
+            }
+            break;
+          case TON_HASH:
+            if (name == "TON")
+            {
+              return LanguageCode::TON;
+            }
+            break;
+          case TSO_HASH:
+            if (name == "TSO")
+            {
+              return LanguageCode::TSO;
+            }
+            break;
+          case TSN_HASH:
+            if (name == "TSN")
+            {
+              return LanguageCode::TSN;
+            }
+            break;
+          case TUR_HASH:
+            if (name == "TUR")
+            {
+              return LanguageCode::TUR;
+            }
+            break;
+          case TUK_HASH:
+            if (name == "TUK")
+            {
+              return LanguageCode::TUK;
+            }
+            break;
+          case TWI_HASH:
+            if (name == "TWI")
+            {
+              return LanguageCode::TWI;
+            }
+            break;
+          case UIG_HASH:
+            if (name == "UIG")
+            {
+              return LanguageCode::UIG;
+            }
+            break;
+          case UKR_HASH:
+            if (name == "UKR")
+            {
+              return LanguageCode::UKR;
+            }
+            break;
+          case UZB_HASH:
+            if (name == "UZB")
+            {
+              return LanguageCode::UZB;
+            }
+            break;
+          case VEN_HASH:
+            if (name == "VEN")
+            {
+              return LanguageCode::VEN;
+            }
+            break;
+          case VOL_HASH:
+            if (name == "VOL")
+            {
+              return LanguageCode::VOL;
+            }
+            break;
+          case WLN_HASH:
+            if (name == "WLN")
+            {
+              return LanguageCode::WLN;
+            }
+            break;
+          case CYM_HASH:
+            if (name == "CYM")
+            {
+              return LanguageCode::CYM;
+            }
+            break;
+          case FRY_HASH:
+            if (name == "FRY")
+            {
+              return LanguageCode::FRY;
+            }
+            break;
+          case WOL_HASH:
+            if (name == "WOL")
+            {
+              return LanguageCode::WOL;
+            }
+            break;
+          case XHO_HASH:
+            if (name == "XHO")
+            {
+              return LanguageCode::XHO;
+            }
+            break;
+          case YID_HASH:
+            if (name == "YID")
+            {
+              return LanguageCode::YID;
+            }
+            break;
+          case YOR_HASH:
+            if (name == "YOR")
+            {
+              return LanguageCode::YOR;
+            }
+            break;
+          case ZHA_HASH:
+            if (name == "ZHA")
+            {
+              return LanguageCode::ZHA;
+            }
+            break;
+          case ZUL_HASH:
+            if (name == "ZUL")
+            {
+              return LanguageCode::ZUL;
+            }
+            break;
+          case ORJ_HASH:
+            if (name == "ORJ")
+            {
+              return LanguageCode::ORJ;
+            }
+            break;
+          case QPC_HASH:
+            if (name == "QPC")
+            {
+              return LanguageCode::QPC;
+            }
+            break;
+          case TNG_HASH:
+            if (name == "TNG")
+            {
+              return LanguageCode::TNG;
+            }
+            break;
+          default:
+            break;
           }
-          else if (hashCode == TNG_HASH)
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
           {
-            enumValue = LanguageCode::TNG;
-            return true;
+            overflowContainer->StoreOverflow(hashCode, name);
+            return static_cast<LanguageCode>(hashCode);
           }
-          return false;
+
+          return LanguageCode::NOT_SET;
         }
 
-        static bool GetNameForEnumHelper0(LanguageCode enumValue, Aws::String& value)
+        const char* GetNameForLanguageCode(LanguageCode enumValue)
         {
           switch(enumValue)
           {
           case LanguageCode::ENG:
-            value = "ENG";
-            return true;
+            return "ENG";
           case LanguageCode::SPA:
-            value = "SPA";
-            return true;
+            return "SPA";
           case LanguageCode::FRA:
-            value = "FRA";
-            return true;
+            return "FRA";
           case LanguageCode::DEU:
-            value = "DEU";
-            return true;
+            return "DEU";
           case LanguageCode::GER:
-            value = "GER";
-            return true;
+            return "GER";
           case LanguageCode::ZHO:
-            value = "ZHO";
-            return true;
+            return "ZHO";
           case LanguageCode::ARA:
-            value = "ARA";
-            return true;
+            return "ARA";
           case LanguageCode::HIN:
-            value = "HIN";
-            return true;
+            return "HIN";
           case LanguageCode::JPN:
-            value = "JPN";
-            return true;
+            return "JPN";
           case LanguageCode::RUS:
-            value = "RUS";
-            return true;
+            return "RUS";
           case LanguageCode::POR:
-            value = "POR";
-            return true;
+            return "POR";
           case LanguageCode::ITA:
-            value = "ITA";
-            return true;
+            return "ITA";
           case LanguageCode::URD:
-            value = "URD";
-            return true;
+            return "URD";
           case LanguageCode::VIE:
-            value = "VIE";
-            return true;
+            return "VIE";
           case LanguageCode::KOR:
-            value = "KOR";
-            return true;
+            return "KOR";
           case LanguageCode::PAN:
-            value = "PAN";
-            return true;
+            return "PAN";
           case LanguageCode::ABK:
-            value = "ABK";
-            return true;
+            return "ABK";
           case LanguageCode::AAR:
-            value = "AAR";
-            return true;
+            return "AAR";
           case LanguageCode::AFR:
-            value = "AFR";
-            return true;
+            return "AFR";
           case LanguageCode::AKA:
-            value = "AKA";
-            return true;
+            return "AKA";
           case LanguageCode::SQI:
-            value = "SQI";
-            return true;
+            return "SQI";
           case LanguageCode::AMH:
-            value = "AMH";
-            return true;
+            return "AMH";
           case LanguageCode::ARG:
-            value = "ARG";
-            return true;
+            return "ARG";
           case LanguageCode::HYE:
-            value = "HYE";
-            return true;
+            return "HYE";
           case LanguageCode::ASM:
-            value = "ASM";
-            return true;
+            return "ASM";
           case LanguageCode::AVA:
-            value = "AVA";
-            return true;
+            return "AVA";
           case LanguageCode::AVE:
-            value = "AVE";
-            return true;
+            return "AVE";
           case LanguageCode::AYM:
-            value = "AYM";
-            return true;
+            return "AYM";
           case LanguageCode::AZE:
-            value = "AZE";
-            return true;
+            return "AZE";
           case LanguageCode::BAM:
-            value = "BAM";
-            return true;
+            return "BAM";
           case LanguageCode::BAK:
-            value = "BAK";
-            return true;
+            return "BAK";
           case LanguageCode::EUS:
-            value = "EUS";
-            return true;
+            return "EUS";
           case LanguageCode::BEL:
-            value = "BEL";
-            return true;
+            return "BEL";
           case LanguageCode::BEN:
-            value = "BEN";
-            return true;
+            return "BEN";
           case LanguageCode::BIH:
-            value = "BIH";
-            return true;
+            return "BIH";
           case LanguageCode::BIS:
-            value = "BIS";
-            return true;
+            return "BIS";
           case LanguageCode::BOS:
-            value = "BOS";
-            return true;
+            return "BOS";
           case LanguageCode::BRE:
-            value = "BRE";
-            return true;
+            return "BRE";
           case LanguageCode::BUL:
-            value = "BUL";
-            return true;
+            return "BUL";
           case LanguageCode::MYA:
-            value = "MYA";
-            return true;
+            return "MYA";
           case LanguageCode::CAT:
-            value = "CAT";
-            return true;
+            return "CAT";
           case LanguageCode::KHM:
-            value = "KHM";
-            return true;
+            return "KHM";
           case LanguageCode::CHA:
-            value = "CHA";
-            return true;
+            return "CHA";
           case LanguageCode::CHE:
-            value = "CHE";
-            return true;
+            return "CHE";
           case LanguageCode::NYA:
-            value = "NYA";
-            return true;
+            return "NYA";
           case LanguageCode::CHU:
-            value = "CHU";
-            return true;
+            return "CHU";
           case LanguageCode::CHV:
-            value = "CHV";
-            return true;
+            return "CHV";
           case LanguageCode::COR:
-            value = "COR";
-            return true;
+            return "COR";
           case LanguageCode::COS:
-            value = "COS";
-            return true;
+            return "COS";
           case LanguageCode::CRE:
-            value = "CRE";
-            return true;
+            return "CRE";
           case LanguageCode::HRV:
-            value = "HRV";
-            return true;
+            return "HRV";
           case LanguageCode::CES:
-            value = "CES";
-            return true;
+            return "CES";
           case LanguageCode::DAN:
-            value = "DAN";
-            return true;
+            return "DAN";
           case LanguageCode::DIV:
-            value = "DIV";
-            return true;
+            return "DIV";
           case LanguageCode::NLD:
-            value = "NLD";
-            return true;
+            return "NLD";
           case LanguageCode::DZO:
-            value = "DZO";
-            return true;
+            return "DZO";
           case LanguageCode::ENM:
-            value = "ENM";
-            return true;
+            return "ENM";
           case LanguageCode::EPO:
-            value = "EPO";
-            return true;
+            return "EPO";
           case LanguageCode::EST:
-            value = "EST";
-            return true;
+            return "EST";
           case LanguageCode::EWE:
-            value = "EWE";
-            return true;
+            return "EWE";
           case LanguageCode::FAO:
-            value = "FAO";
-            return true;
+            return "FAO";
           case LanguageCode::FIJ:
-            value = "FIJ";
-            return true;
+            return "FIJ";
           case LanguageCode::FIN:
-            value = "FIN";
-            return true;
+            return "FIN";
           case LanguageCode::FRM:
-            value = "FRM";
-            return true;
+            return "FRM";
           case LanguageCode::FUL:
-            value = "FUL";
-            return true;
+            return "FUL";
           case LanguageCode::GLA:
-            value = "GLA";
-            return true;
+            return "GLA";
           case LanguageCode::GLG:
-            value = "GLG";
-            return true;
+            return "GLG";
           case LanguageCode::LUG:
-            value = "LUG";
-            return true;
+            return "LUG";
           case LanguageCode::KAT:
-            value = "KAT";
-            return true;
+            return "KAT";
           case LanguageCode::ELL:
-            value = "ELL";
-            return true;
+            return "ELL";
           case LanguageCode::GRN:
-            value = "GRN";
-            return true;
+            return "GRN";
           case LanguageCode::GUJ:
-            value = "GUJ";
-            return true;
+            return "GUJ";
           case LanguageCode::HAT:
-            value = "HAT";
-            return true;
+            return "HAT";
           case LanguageCode::HAU:
-            value = "HAU";
-            return true;
+            return "HAU";
           case LanguageCode::HEB:
-            value = "HEB";
-            return true;
+            return "HEB";
           case LanguageCode::HER:
-            value = "HER";
-            return true;
+            return "HER";
           case LanguageCode::HMO:
-            value = "HMO";
-            return true;
+            return "HMO";
           case LanguageCode::HUN:
-            value = "HUN";
-            return true;
+            return "HUN";
           case LanguageCode::ISL:
-            value = "ISL";
-            return true;
+            return "ISL";
           case LanguageCode::IDO:
-            value = "IDO";
-            return true;
+            return "IDO";
           case LanguageCode::IBO:
-            value = "IBO";
-            return true;
+            return "IBO";
           case LanguageCode::IND:
-            value = "IND";
-            return true;
+            return "IND";
           case LanguageCode::INA:
-            value = "INA";
-            return true;
+            return "INA";
           case LanguageCode::ILE:
-            value = "ILE";
-            return true;
+            return "ILE";
           case LanguageCode::IKU:
-            value = "IKU";
-            return true;
+            return "IKU";
           case LanguageCode::IPK:
-            value = "IPK";
-            return true;
+            return "IPK";
           case LanguageCode::GLE:
-            value = "GLE";
-            return true;
+            return "GLE";
           case LanguageCode::JAV:
-            value = "JAV";
-            return true;
+            return "JAV";
           case LanguageCode::KAL:
-            value = "KAL";
-            return true;
+            return "KAL";
           case LanguageCode::KAN:
-            value = "KAN";
-            return true;
+            return "KAN";
           case LanguageCode::KAU:
-            value = "KAU";
-            return true;
+            return "KAU";
           case LanguageCode::KAS:
-            value = "KAS";
-            return true;
+            return "KAS";
           case LanguageCode::KAZ:
-            value = "KAZ";
-            return true;
+            return "KAZ";
           case LanguageCode::KIK:
-            value = "KIK";
-            return true;
+            return "KIK";
           case LanguageCode::KIN:
-            value = "KIN";
-            return true;
+            return "KIN";
           case LanguageCode::KIR:
-            value = "KIR";
-            return true;
+            return "KIR";
           case LanguageCode::KOM:
-            value = "KOM";
-            return true;
+            return "KOM";
           case LanguageCode::KON:
-            value = "KON";
-            return true;
+            return "KON";
           case LanguageCode::KUA:
-            value = "KUA";
-            return true;
+            return "KUA";
           case LanguageCode::KUR:
-            value = "KUR";
-            return true;
+            return "KUR";
           case LanguageCode::LAO:
-            value = "LAO";
-            return true;
+            return "LAO";
           case LanguageCode::LAT:
-            value = "LAT";
-            return true;
+            return "LAT";
           case LanguageCode::LAV:
-            value = "LAV";
-            return true;
+            return "LAV";
           case LanguageCode::LIM:
-            value = "LIM";
-            return true;
+            return "LIM";
           case LanguageCode::LIN:
-            value = "LIN";
-            return true;
+            return "LIN";
           case LanguageCode::LIT:
-            value = "LIT";
-            return true;
+            return "LIT";
           case LanguageCode::LUB:
-            value = "LUB";
-            return true;
+            return "LUB";
           case LanguageCode::LTZ:
-            value = "LTZ";
-            return true;
+            return "LTZ";
           case LanguageCode::MKD:
-            value = "MKD";
-            return true;
+            return "MKD";
           case LanguageCode::MLG:
-            value = "MLG";
-            return true;
+            return "MLG";
           case LanguageCode::MSA:
-            value = "MSA";
-            return true;
+            return "MSA";
           case LanguageCode::MAL:
-            value = "MAL";
-            return true;
+            return "MAL";
           case LanguageCode::MLT:
-            value = "MLT";
-            return true;
+            return "MLT";
           case LanguageCode::GLV:
-            value = "GLV";
-            return true;
+            return "GLV";
           case LanguageCode::MRI:
-            value = "MRI";
-            return true;
+            return "MRI";
           case LanguageCode::MAR:
-            value = "MAR";
-            return true;
+            return "MAR";
           case LanguageCode::MAH:
-            value = "MAH";
-            return true;
+            return "MAH";
           case LanguageCode::MON:
-            value = "MON";
-            return true;
+            return "MON";
           case LanguageCode::NAU:
-            value = "NAU";
-            return true;
+            return "NAU";
           case LanguageCode::NAV:
-            value = "NAV";
-            return true;
+            return "NAV";
           case LanguageCode::NDE:
-            value = "NDE";
-            return true;
+            return "NDE";
           case LanguageCode::NBL:
-            value = "NBL";
-            return true;
-          default:
-            return false;
-          }
-        }
-        static bool GetNameForEnumHelper1(LanguageCode enumValue, Aws::String& value)
-        {
-          switch(enumValue)
-          {
+            return "NBL";
           case LanguageCode::NDO:
-            value = "NDO";
-            return true;
+            return "NDO";
           case LanguageCode::NEP:
-            value = "NEP";
-            return true;
+            return "NEP";
           case LanguageCode::SME:
-            value = "SME";
-            return true;
+            return "SME";
           case LanguageCode::NOR:
-            value = "NOR";
-            return true;
+            return "NOR";
           case LanguageCode::NOB:
-            value = "NOB";
-            return true;
+            return "NOB";
           case LanguageCode::NNO:
-            value = "NNO";
-            return true;
+            return "NNO";
           case LanguageCode::OCI:
-            value = "OCI";
-            return true;
+            return "OCI";
           case LanguageCode::OJI:
-            value = "OJI";
-            return true;
+            return "OJI";
           case LanguageCode::ORI:
-            value = "ORI";
-            return true;
+            return "ORI";
           case LanguageCode::ORM:
-            value = "ORM";
-            return true;
+            return "ORM";
           case LanguageCode::OSS:
-            value = "OSS";
-            return true;
+            return "OSS";
           case LanguageCode::PLI:
-            value = "PLI";
-            return true;
+            return "PLI";
           case LanguageCode::FAS:
-            value = "FAS";
-            return true;
+            return "FAS";
           case LanguageCode::POL:
-            value = "POL";
-            return true;
+            return "POL";
           case LanguageCode::PUS:
-            value = "PUS";
-            return true;
+            return "PUS";
           case LanguageCode::QUE:
-            value = "QUE";
-            return true;
+            return "QUE";
           case LanguageCode::QAA:
-            value = "QAA";
-            return true;
+            return "QAA";
           case LanguageCode::RON:
-            value = "RON";
-            return true;
+            return "RON";
           case LanguageCode::ROH:
-            value = "ROH";
-            return true;
+            return "ROH";
           case LanguageCode::RUN:
-            value = "RUN";
-            return true;
+            return "RUN";
           case LanguageCode::SMO:
-            value = "SMO";
-            return true;
+            return "SMO";
           case LanguageCode::SAG:
-            value = "SAG";
-            return true;
+            return "SAG";
           case LanguageCode::SAN:
-            value = "SAN";
-            return true;
+            return "SAN";
           case LanguageCode::SRD:
-            value = "SRD";
-            return true;
+            return "SRD";
           case LanguageCode::SRB:
-            value = "SRB";
-            return true;
+            return "SRB";
           case LanguageCode::SNA:
-            value = "SNA";
-            return true;
+            return "SNA";
           case LanguageCode::III:
-            value = "III";
-            return true;
+            return "III";
           case LanguageCode::SND:
-            value = "SND";
-            return true;
+            return "SND";
           case LanguageCode::SIN:
-            value = "SIN";
-            return true;
+            return "SIN";
           case LanguageCode::SLK:
-            value = "SLK";
-            return true;
+            return "SLK";
           case LanguageCode::SLV:
-            value = "SLV";
-            return true;
+            return "SLV";
           case LanguageCode::SOM:
-            value = "SOM";
-            return true;
+            return "SOM";
           case LanguageCode::SOT:
-            value = "SOT";
-            return true;
+            return "SOT";
           case LanguageCode::SUN:
-            value = "SUN";
-            return true;
+            return "SUN";
           case LanguageCode::SWA:
-            value = "SWA";
-            return true;
+            return "SWA";
           case LanguageCode::SSW:
-            value = "SSW";
-            return true;
+            return "SSW";
           case LanguageCode::SWE:
-            value = "SWE";
-            return true;
+            return "SWE";
           case LanguageCode::TGL:
-            value = "TGL";
-            return true;
+            return "TGL";
           case LanguageCode::TAH:
-            value = "TAH";
-            return true;
+            return "TAH";
           case LanguageCode::TGK:
-            value = "TGK";
-            return true;
+            return "TGK";
           case LanguageCode::TAM:
-            value = "TAM";
-            return true;
+            return "TAM";
           case LanguageCode::TAT:
-            value = "TAT";
-            return true;
+            return "TAT";
           case LanguageCode::TEL:
-            value = "TEL";
-            return true;
+            return "TEL";
           case LanguageCode::THA:
-            value = "THA";
-            return true;
+            return "THA";
           case LanguageCode::BOD:
-            value = "BOD";
-            return true;
+            return "BOD";
           case LanguageCode::TIR:
-            value = "TIR";
-            return true;
+            return "TIR";
           case LanguageCode::TON:
-            value = "TON";
-            return true;
+            return "TON";
           case LanguageCode::TSO:
-            value = "TSO";
-            return true;
+            return "TSO";
           case LanguageCode::TSN:
-            value = "TSN";
-            return true;
+            return "TSN";
           case LanguageCode::TUR:
-            value = "TUR";
-            return true;
+            return "TUR";
           case LanguageCode::TUK:
-            value = "TUK";
-            return true;
+            return "TUK";
           case LanguageCode::TWI:
-            value = "TWI";
-            return true;
+            return "TWI";
           case LanguageCode::UIG:
-            value = "UIG";
-            return true;
+            return "UIG";
           case LanguageCode::UKR:
-            value = "UKR";
-            return true;
+            return "UKR";
           case LanguageCode::UZB:
-            value = "UZB";
-            return true;
+            return "UZB";
           case LanguageCode::VEN:
-            value = "VEN";
-            return true;
+            return "VEN";
           case LanguageCode::VOL:
-            value = "VOL";
-            return true;
+            return "VOL";
           case LanguageCode::WLN:
-            value = "WLN";
-            return true;
+            return "WLN";
           case LanguageCode::CYM:
-            value = "CYM";
-            return true;
+            return "CYM";
           case LanguageCode::FRY:
-            value = "FRY";
-            return true;
+            return "FRY";
           case LanguageCode::WOL:
-            value = "WOL";
-            return true;
+            return "WOL";
           case LanguageCode::XHO:
-            value = "XHO";
-            return true;
+            return "XHO";
           case LanguageCode::YID:
-            value = "YID";
-            return true;
+            return "YID";
           case LanguageCode::YOR:
-            value = "YOR";
-            return true;
+            return "YOR";
           case LanguageCode::ZHA:
-            value = "ZHA";
-            return true;
+            return "ZHA";
           case LanguageCode::ZUL:
-            value = "ZUL";
-            return true;
+            return "ZUL";
           case LanguageCode::ORJ:
-            value = "ORJ";
-            return true;
+            return "ORJ";
           case LanguageCode::QPC:
-            value = "QPC";
-            return true;
+            return "QPC";
           case LanguageCode::TNG:
-            value = "TNG";
-            return true;
+            return "TNG";
           default:
-            return false;
-          }
-        }
+            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+            if(overflowContainer)
+            {
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
+            }
 
-        LanguageCode GetLanguageCodeForName(const Aws::String& name)
-        {
-          int hashCode = HashingUtils::HashString(name.c_str());
-          LanguageCode enumValue;
-          if (GetEnumForNameHelper0(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          else if (GetEnumForNameHelper1(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            overflowContainer->StoreOverflow(hashCode, name);
-            return static_cast<LanguageCode>(hashCode);
-          }
-
-          return LanguageCode::NOT_SET;
-        }
-
-        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
-        {
-          Aws::String value;
-          if (GetNameForEnumHelper0(enumValue, value))
-          {
-            return value;
+            return "";
           }
-          else if (GetNameForEnumHelper1(enumValue, value))
-          {
-            return value;
-          }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-          }
-
-          return "";
         }
 
       } // namespace LanguageCodeMapper
@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsAudioBufferModelMapper
       {
 
-        static const int DVB_HASH = HashingUtils::HashString("DVB");
-        static const int ATSC_HASH = HashingUtils::HashString("ATSC");
+        static constexpr int DVB_HASH = HashingUtils::CompileTimeHashString("DVB");
+        static constexpr int ATSC_HASH = HashingUtils::CompileTimeHashString("ATSC");
 
 
         M2tsAudioBufferModel GetM2tsAudioBufferModelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DVB_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsAudioBufferModel::DVB;
-          }
-          else if (hashCode == ATSC_HASH)
-          {
-            return M2tsAudioBufferModel::ATSC;
+          case DVB_HASH:
+            if (name == "DVB")
+            {
+              return M2tsAudioBufferModel::DVB;
+            }
+            break;
+          case ATSC_HASH:
+            if (name == "ATSC")
+            {
+              return M2tsAudioBufferModel::ATSC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsAudioBufferModel::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsAudioBufferModel(M2tsAudioBufferModel enumValue)
+        const char* GetNameForM2tsAudioBufferModel(M2tsAudioBufferModel enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsBufferModelMapper
       {
 
-        static const int MULTIPLEX_HASH = HashingUtils::HashString("MULTIPLEX");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int MULTIPLEX_HASH = HashingUtils::CompileTimeHashString("MULTIPLEX");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         M2tsBufferModel GetM2tsBufferModelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MULTIPLEX_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsBufferModel::MULTIPLEX;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return M2tsBufferModel::NONE;
+          case MULTIPLEX_HASH:
+            if (name == "MULTIPLEX")
+            {
+              return M2tsBufferModel::MULTIPLEX;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return M2tsBufferModel::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsBufferModel::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsBufferModel(M2tsBufferModel enumValue)
+        const char* GetNameForM2tsBufferModel(M2tsBufferModel enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsEbpAudioIntervalMapper
       {
 
-        static const int VIDEO_AND_FIXED_INTERVALS_HASH = HashingUtils::HashString("VIDEO_AND_FIXED_INTERVALS");
-        static const int VIDEO_INTERVAL_HASH = HashingUtils::HashString("VIDEO_INTERVAL");
+        static constexpr int VIDEO_AND_FIXED_INTERVALS_HASH = HashingUtils::CompileTimeHashString("VIDEO_AND_FIXED_INTERVALS");
+        static constexpr int VIDEO_INTERVAL_HASH = HashingUtils::CompileTimeHashString("VIDEO_INTERVAL");
 
 
         M2tsEbpAudioInterval GetM2tsEbpAudioIntervalForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VIDEO_AND_FIXED_INTERVALS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsEbpAudioInterval::VIDEO_AND_FIXED_INTERVALS;
-          }
-          else if (hashCode == VIDEO_INTERVAL_HASH)
-          {
-            return M2tsEbpAudioInterval::VIDEO_INTERVAL;
+          case VIDEO_AND_FIXED_INTERVALS_HASH:
+            if (name == "VIDEO_AND_FIXED_INTERVALS")
+            {
+              return M2tsEbpAudioInterval::VIDEO_AND_FIXED_INTERVALS;
+            }
+            break;
+          case VIDEO_INTERVAL_HASH:
+            if (name == "VIDEO_INTERVAL")
+            {
+              return M2tsEbpAudioInterval::VIDEO_INTERVAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsEbpAudioInterval::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsEbpAudioInterval(M2tsEbpAudioInterval enumValue)
+        const char* GetNameForM2tsEbpAudioInterval(M2tsEbpAudioInterval enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsEbpPlacementMapper
       {
 
-        static const int VIDEO_AND_AUDIO_PIDS_HASH = HashingUtils::HashString("VIDEO_AND_AUDIO_PIDS");
-        static const int VIDEO_PID_HASH = HashingUtils::HashString("VIDEO_PID");
+        static constexpr int VIDEO_AND_AUDIO_PIDS_HASH = HashingUtils::CompileTimeHashString("VIDEO_AND_AUDIO_PIDS");
+        static constexpr int VIDEO_PID_HASH = HashingUtils::CompileTimeHashString("VIDEO_PID");
 
 
         M2tsEbpPlacement GetM2tsEbpPlacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VIDEO_AND_AUDIO_PIDS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsEbpPlacement::VIDEO_AND_AUDIO_PIDS;
-          }
-          else if (hashCode == VIDEO_PID_HASH)
-          {
-            return M2tsEbpPlacement::VIDEO_PID;
+          case VIDEO_AND_AUDIO_PIDS_HASH:
+            if (name == "VIDEO_AND_AUDIO_PIDS")
+            {
+              return M2tsEbpPlacement::VIDEO_AND_AUDIO_PIDS;
+            }
+            break;
+          case VIDEO_PID_HASH:
+            if (name == "VIDEO_PID")
+            {
+              return M2tsEbpPlacement::VIDEO_PID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsEbpPlacement::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsEbpPlacement(M2tsEbpPlacement enumValue)
+        const char* GetNameForM2tsEbpPlacement(M2tsEbpPlacement enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsNielsenId3Mapper
       {
 
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int INSERT_HASH = HashingUtils::CompileTimeHashString("INSERT");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         M2tsNielsenId3 GetM2tsNielsenId3ForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSERT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsNielsenId3::INSERT;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return M2tsNielsenId3::NONE;
+          case INSERT_HASH:
+            if (name == "INSERT")
+            {
+              return M2tsNielsenId3::INSERT;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return M2tsNielsenId3::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsNielsenId3::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsNielsenId3(M2tsNielsenId3 enumValue)
+        const char* GetNameForM2tsNielsenId3(M2tsNielsenId3 enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
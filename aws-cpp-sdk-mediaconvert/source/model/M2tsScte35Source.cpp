@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsScte35SourceMapper
       {
 
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         M2tsScte35Source GetM2tsScte35SourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PASSTHROUGH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsScte35Source::PASSTHROUGH;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return M2tsScte35Source::NONE;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return M2tsScte35Source::PASSTHROUGH;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return M2tsScte35Source::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsScte35Source::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsScte35Source(M2tsScte35Source enumValue)
+        const char* GetNameForM2tsScte35Source(M2tsScte35Source enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
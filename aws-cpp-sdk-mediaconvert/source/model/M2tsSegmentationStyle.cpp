@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsSegmentationStyleMapper
       {
 
-        static const int MAINTAIN_CADENCE_HASH = HashingUtils::HashString("MAINTAIN_CADENCE");
-        static const int RESET_CADENCE_HASH = HashingUtils::HashString("RESET_CADENCE");
+        static constexpr int MAINTAIN_CADENCE_HASH = HashingUtils::CompileTimeHashString("MAINTAIN_CADENCE");
+        static constexpr int RESET_CADENCE_HASH = HashingUtils::CompileTimeHashString("RESET_CADENCE");
 
 
         M2tsSegmentationStyle GetM2tsSegmentationStyleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAINTAIN_CADENCE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsSegmentationStyle::MAINTAIN_CADENCE;
-          }
-          else if (hashCode == RESET_CADENCE_HASH)
-          {
-            return M2tsSegmentationStyle::RESET_CADENCE;
+          case MAINTAIN_CADENCE_HASH:
+            if (name == "MAINTAIN_CADENCE")
+            {
+              return M2tsSegmentationStyle::MAINTAIN_CADENCE;
+            }
+            break;
+          case RESET_CADENCE_HASH:
+            if (name == "RESET_CADENCE")
+            {
+              return M2tsSegmentationStyle::RESET_CADENCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsSegmentationStyle::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsSegmentationStyle(M2tsSegmentationStyle enumValue)
+        const char* GetNameForM2tsSegmentationStyle(M2tsSegmentationStyle enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace M3u8PcrControlMapper
       {
 
-        static const int PCR_EVERY_PES_PACKET_HASH = HashingUtils::HashString("PCR_EVERY_PES_PACKET");
-        static const int CONFIGURED_PCR_PERIOD_HASH = HashingUtils::HashString("CONFIGURED_PCR_PERIOD");
+        static constexpr int PCR_EVERY_PES_PACKET_HASH = HashingUtils::CompileTimeHashString("PCR_EVERY_PES_PACKET");
+        static constexpr int CONFIGURED_PCR_PERIOD_HASH = HashingUtils::CompileTimeHashString("CONFIGURED_PCR_PERIOD");
 
 
         M3u8PcrControl GetM3u8PcrControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PCR_EVERY_PES_PACKET_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M3u8PcrControl::PCR_EVERY_PES_PACKET;
-          }
-          else if (hashCode == CONFIGURED_PCR_PERIOD_HASH)
-          {
-            return M3u8PcrControl::CONFIGURED_PCR_PERIOD;
+          case PCR_EVERY_PES_PACKET_HASH:
+            if (name == "PCR_EVERY_PES_PACKET")
+            {
+              return M3u8PcrControl::PCR_EVERY_PES_PACKET;
+            }
+            break;
+          case CONFIGURED_PCR_PERIOD_HASH:
+            if (name == "CONFIGURED_PCR_PERIOD")
+            {
+              return M3u8PcrControl::CONFIGURED_PCR_PERIOD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M3u8PcrControl::NOT_SET;
         }
 
-        Aws::String GetNameForM3u8PcrControl(M3u8PcrControl enumValue)
+        const char* GetNameForM3u8PcrControl(M3u8PcrControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace MovMpeg2FourCCControlMapper
       {
 
-        static const int XDCAM_HASH = HashingUtils::HashString("XDCAM");
-        static const int MPEG_HASH = HashingUtils::HashString("MPEG");
+        static constexpr int XDCAM_HASH = HashingUtils::CompileTimeHashString("XDCAM");
+        static constexpr int MPEG_HASH = HashingUtils::CompileTimeHashString("MPEG");
 
 
         MovMpeg2FourCCControl GetMovMpeg2FourCCControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == XDCAM_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MovMpeg2FourCCControl::XDCAM;
-          }
-          else if (hashCode == MPEG_HASH)
-          {
-            return MovMpeg2FourCCControl::MPEG;
+          case XDCAM_HASH:
+            if (name == "XDCAM")
+            {
+              return MovMpeg2FourCCControl::XDCAM;
+            }
+            break;
+          case MPEG_HASH:
+            if (name == "MPEG")
+            {
+              return MovMpeg2FourCCControl::MPEG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MovMpeg2FourCCControl::NOT_SET;
         }
 
-        Aws::String GetNameForMovMpeg2FourCCControl(MovMpeg2FourCCControl enumValue)
+        const char* GetNameForMovMpeg2FourCCControl(MovMpeg2FourCCControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
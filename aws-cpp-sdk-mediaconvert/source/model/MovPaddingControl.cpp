@@ -30,20 +30,30 @@ namespace Aws
       namespace MovPaddingControlMapper
       {
 
-        static const int OMNEON_HASH = HashingUtils::HashString("OMNEON");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int OMNEON_HASH = HashingUtils::CompileTimeHashString("OMNEON");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         MovPaddingControl GetMovPaddingControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OMNEON_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MovPaddingControl::OMNEON;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return MovPaddingControl::NONE;
+          case OMNEON_HASH:
+            if (name == "OMNEON")
+            {
+              return MovPaddingControl::OMNEON;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return MovPaddingControl::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MovPaddingControl::NOT_SET;
         }
 
-        Aws::String GetNameForMovPaddingControl(MovPaddingControl enumValue)
+        const char* GetNameForMovPaddingControl(MovPaddingControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
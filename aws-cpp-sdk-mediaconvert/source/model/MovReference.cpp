@@ -30,20 +30,30 @@ namespace Aws
       namespace MovReferenceMapper
       {
 
-        static const int SELF_CONTAINED_HASH = HashingUtils::HashString("SELF_CONTAINED");
-        static const int EXTERNAL_HASH = HashingUtils::HashString("EXTERNAL");
+        static constexpr int SELF_CONTAINED_HASH = HashingUtils::CompileTimeHashString("SELF_CONTAINED");
+        static constexpr int EXTERNAL_HASH = HashingUtils::CompileTimeHashString("EXTERNAL");
 
 
         MovReference GetMovReferenceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SELF_CONTAINED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MovReference::SELF_CONTAINED;
-          }
-          else if (hashCode == EXTERNAL_HASH)
-          {
-            return MovReference::EXTERNAL;
+          case SELF_CONTAINED_HASH:
+            if (name == "SELF_CONTAINED")
+            {
+              return MovReference::SELF_CONTAINED;
+            }
+            break;
+          case EXTERNAL_HASH:
+            if (name == "EXTERNAL")
+            {
+              return MovReference::EXTERNAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MovReference::NOT_SET;
         }
 
-        Aws::String GetNameForMovReference(MovReference enumValue)
+        const char* GetNameForMovReference(MovReference enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace Mpeg2AdaptiveQuantizationMapper
       {
 
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
+        static constexpr int OFF_HASH = HashingUtils::CompileTimeHashString("OFF");
+        static constexpr int LOW_HASH = HashingUtils::CompileTimeHashString("LOW");
+        static constexpr int MEDIUM_HASH = HashingUtils::CompileTimeHashString("MEDIUM");
+        static constexpr int HIGH_HASH = HashingUtils::CompileTimeHashString("HIGH");
 
 
         Mpeg2AdaptiveQuantization GetMpeg2AdaptiveQuantizationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OFF_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2AdaptiveQuantization::OFF;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return Mpeg2AdaptiveQuantization::LOW;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return Mpeg2AdaptiveQuantization::MEDIUM;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return Mpeg2AdaptiveQuantization::HIGH;
+          case OFF_HASH:
+            if (name == "OFF")
+            {
+              return Mpeg2AdaptiveQuantization::OFF;
+            }
+            break;
+          case LOW_HASH:
+            if (name == "LOW")
+            {
+              return Mpeg2AdaptiveQuantization::LOW;
+            }
+            break;
+          case MEDIUM_HASH:
+            if (name == "MEDIUM")
+            {
+              return Mpeg2AdaptiveQuantization::MEDIUM;
+            }
+            break;
+          case HIGH_HASH:
+            if (name == "HIGH")
+            {
+              return Mpeg2AdaptiveQuantization::HIGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return Mpeg2AdaptiveQuantization::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2AdaptiveQuantization(Mpeg2AdaptiveQuantization enumValue)
+        const char* GetNameForMpeg2AdaptiveQuantization(Mpeg2AdaptiveQuantization enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace Mpeg2CodecLevelMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MAIN_HASH = HashingUtils::HashString("MAIN");
-        static const int HIGH1440_HASH = HashingUtils::HashString("HIGH1440");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
+        static constexpr int AUTO_HASH = HashingUtils::CompileTimeHashString("AUTO");
+        static constexpr int LOW_HASH = HashingUtils::CompileTimeHashString("LOW");
+        static constexpr int MAIN_HASH = HashingUtils::CompileTimeHashString("MAIN");
+        static constexpr int HIGH1440_HASH = HashingUtils::CompileTimeHashString("HIGH1440");
+        static constexpr int HIGH_HASH = HashingUtils::CompileTimeHashString("HIGH");
 
 
         Mpeg2CodecLevel GetMpeg2CodecLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2CodecLevel::AUTO;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return Mpeg2CodecLevel::LOW;
-          }
-          else if (hashCode == MAIN_HASH)
-          {
-            return Mpeg2CodecLevel::MAIN;
-          }
-          else if (hashCode == HIGH1440_HASH)
-          {
-            return Mpeg2CodecLevel::HIGH1440;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return Mpeg2CodecLevel::HIGH;
+          case AUTO_HASH:
+            if (name == "AUTO")
+            {
+              return Mpeg2CodecLevel::AUTO;
+            }
+            break;
+          case LOW_HASH:
+            if (name == "LOW")
+            {
+              return Mpeg2CodecLevel::LOW;
+            }
+            break;
+          case MAIN_HASH:
+            if (name == "MAIN")
+            {
+              return Mpeg2CodecLevel::MAIN;
+            }
+            break;
+          case HIGH1440_HASH:
+            if (name == "HIGH1440")
+            {
+              return Mpeg2CodecLevel::HIGH1440;
+            }
+            break;
+          case HIGH_HASH:
+            if (name == "HIGH")
+            {
+              return Mpeg2CodecLevel::HIGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Mpeg2CodecLevel::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2CodecLevel(Mpeg2CodecLevel enumValue)
+        const char* GetNameForMpeg2CodecLevel(Mpeg2CodecLevel enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
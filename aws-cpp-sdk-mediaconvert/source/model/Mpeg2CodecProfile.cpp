@@ -30,20 +30,30 @@ namespace Aws
       namespace Mpeg2CodecProfileMapper
       {
 
-        static const int MAIN_HASH = HashingUtils::HashString("MAIN");
-        static const int PROFILE_422_HASH = HashingUtils::HashString("PROFILE_422");
+        static constexpr int MAIN_HASH = HashingUtils::CompileTimeHashString("MAIN");
+        static constexpr int PROFILE_422_HASH = HashingUtils::CompileTimeHashString("PROFILE_422");
 
 
         Mpeg2CodecProfile GetMpeg2CodecProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAIN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2CodecProfile::MAIN;
-          }
-          else if (hashCode == PROFILE_422_HASH)
-          {
-            return Mpeg2CodecProfile::PROFILE_422;
+          case MAIN_HASH:
+            if (name == "MAIN")
+            {
+              return Mpeg2CodecProfile::MAIN;
+            }
+            break;
+          case PROFILE_422_HASH:
+            if (name == "PROFILE_422")
+            {
+              return Mpeg2CodecProfile::PROFILE_422;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Mpeg2CodecProfile::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2CodecProfile(Mpeg2CodecProfile enumValue)
+        const char* GetNameForMpeg2CodecProfile(Mpeg2CodecProfile enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
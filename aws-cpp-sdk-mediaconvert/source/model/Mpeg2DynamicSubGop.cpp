@@ -30,20 +30,30 @@ namespace Aws
       namespace Mpeg2DynamicSubGopMapper
       {
 
-        static const int ADAPTIVE_HASH = HashingUtils::HashString("ADAPTIVE");
-        static const int STATIC__HASH = HashingUtils::HashString("STATIC");
+        static constexpr int ADAPTIVE_HASH = HashingUtils::CompileTimeHashString("ADAPTIVE");
+        static constexpr int STATIC__HASH = HashingUtils::CompileTimeHashString("STATIC");
 
 
         Mpeg2DynamicSubGop GetMpeg2DynamicSubGopForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADAPTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2DynamicSubGop::ADAPTIVE;
-          }
-          else if (hashCode == STATIC__HASH)
-          {
-            return Mpeg2DynamicSubGop::STATIC_;
+          case ADAPTIVE_HASH:
+            if (name == "ADAPTIVE")
+            {
+              return Mpeg2DynamicSubGop::ADAPTIVE;
+            }
+            break;
+          case STATIC__HASH:
+            if (name == "STATIC")
+            {
+              return Mpeg2DynamicSubGop::STATIC_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Mpeg2DynamicSubGop::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2DynamicSubGop(Mpeg2DynamicSubGop enumValue)
+        const char* GetNameForMpeg2DynamicSubGop(Mpeg2DynamicSubGop enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
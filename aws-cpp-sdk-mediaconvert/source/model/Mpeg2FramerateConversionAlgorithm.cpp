@@ -30,20 +30,30 @@ namespace Aws
       namespace Mpeg2FramerateConversionAlgorithmMapper
       {
 
-        static const int DUPLICATE_DROP_HASH = HashingUtils::HashString("DUPLICATE_DROP");
-        static const int INTERPOLATE_HASH = HashingUtils::HashString("INTERPOLATE");
+        static constexpr int DUPLICATE_DROP_HASH = HashingUtils::CompileTimeHashString("DUPLICATE_DROP");
+        static constexpr int INTERPOLATE_HASH = HashingUtils::CompileTimeHashString("INTERPOLATE");
 
 
         Mpeg2FramerateConversionAlgorithm GetMpeg2FramerateConversionAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DUPLICATE_DROP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2FramerateConversionAlgorithm::DUPLICATE_DROP;
-          }
-          else if (hashCode == INTERPOLATE_HASH)
-          {
-            return Mpeg2FramerateConversionAlgorithm::INTERPOLATE;
+          case DUPLICATE_DROP_HASH:
+            if (name == "DUPLICATE_DROP")
+            {
+              return Mpeg2FramerateConversionAlgorithm::DUPLICATE_DROP;
+            }
+            break;
+          case INTERPOLATE_HASH:
+            if (name == "INTERPOLATE")
+            {
+              return Mpeg2FramerateConversionAlgorithm::INTERPOLATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Mpeg2FramerateConversionAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2FramerateConversionAlgorithm(Mpeg2FramerateConversionAlgorithm enumValue)
+        const char* GetNameForMpeg2FramerateConversionAlgorithm(Mpeg2FramerateConversionAlgorithm enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
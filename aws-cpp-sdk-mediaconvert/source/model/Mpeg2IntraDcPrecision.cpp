@@ -30,35 +30,51 @@ namespace Aws
       namespace Mpeg2IntraDcPrecisionMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int INTRA_DC_PRECISION_8_HASH = HashingUtils::HashString("INTRA_DC_PRECISION_8");
-        static const int INTRA_DC_PRECISION_9_HASH = HashingUtils::HashString("INTRA_DC_PRECISION_9");
-        static const int INTRA_DC_PRECISION_10_HASH = HashingUtils::HashString("INTRA_DC_PRECISION_10");
-        static const int INTRA_DC_PRECISION_11_HASH = HashingUtils::HashString("INTRA_DC_PRECISION_11");
+        static constexpr int AUTO_HASH = HashingUtils::CompileTimeHashString("AUTO");
+        static constexpr int INTRA_DC_PRECISION_8_HASH = HashingUtils::CompileTimeHashString("INTRA_DC_PRECISION_8");
+        static constexpr int INTRA_DC_PRECISION_9_HASH = HashingUtils::CompileTimeHashString("INTRA_DC_PRECISION_9");
+        static constexpr int INTRA_DC_PRECISION_10_HASH = HashingUtils::CompileTimeHashString("INTRA_DC_PRECISION_10");
+        static constexpr int INTRA_DC_PRECISION_11_HASH = HashingUtils::CompileTimeHashString("INTRA_DC_PRECISION_11");
 
 
         Mpeg2IntraDcPrecision GetMpeg2IntraDcPrecisionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2IntraDcPrecision::AUTO;
-          }
-          else if (hashCode == INTRA_DC_PRECISION_8_HASH)
-          {
-            return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_8;
-          }
-          else if (hashCode == INTRA_DC_PRECISION_9_HASH)
-          {
-            return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_9;
-          }
-          else if (hashCode == INTRA_DC_PRECISION_10_HASH)
-          {
-            return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_10;
-          }
-          else if (hashCode == INTRA_DC_PRECISION_11_HASH)
-          {
-            return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_11;
+          case AUTO_HASH:
+            if (name == "AUTO")
+            {
+              return Mpeg2IntraDcPrecision::AUTO;
+            }
+            break;
+          case INTRA_DC_PRECISION_8_HASH:
+            if (name == "INTRA_DC_PRECISION_8")
+            {
+              return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_8;
+            }
+            break;
+          case INTRA_DC_PRECISION_9_HASH:
+            if (name == "INTRA_DC_PRECISION_9")
+            {
+              return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_9;
+            }
+            break;
+          case INTRA_DC_PRECISION_10_HASH:
+            if (name == "INTRA_DC_PRECISION_10")
+            {
+              return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_10;
+            }
+            break;
+          case INTRA_DC_PRECISION_11_HASH:
+            if (name == "INTRA_DC_PRECISION_11")
+            {
+              return Mpeg2IntraDcPrecision::INTRA_DC_PRECISION_11;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Mpeg2IntraDcPrecision::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2IntraDcPrecision(Mpeg2IntraDcPrecision enumValue)
+        const char* GetNameForMpeg2IntraDcPrecision(Mpeg2IntraDcPrecision enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Mpeg2ParControlMapper
       {
 
-        static const int INITIALIZE_FROM_SOURCE_HASH = HashingUtils::HashString("INITIALIZE_FROM_SOURCE");
-        static const int SPECIFIED_HASH = HashingUtils::HashString("SPECIFIED");
+        static constexpr int INITIALIZE_FROM_SOURCE_HASH = HashingUtils::CompileTimeHashString("INITIALIZE_FROM_SOURCE");
+        static constexpr int SPECIFIED_HASH = HashingUtils::CompileTimeHashString("SPECIFIED");
 
 
         Mpeg2ParControl GetMpeg2ParControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZE_FROM_SOURCE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2ParControl::INITIALIZE_FROM_SOURCE;
-          }
-          else if (hashCode == SPECIFIED_HASH)
-          {
-            return Mpeg2ParControl::SPECIFIED;
+          case INITIALIZE_FROM_SOURCE_HASH:
+            if (name == "INITIALIZE_FROM_SOURCE")
+            {
+              return Mpeg2ParControl::INITIALIZE_FROM_SOURCE;
+            }
+            break;
+          case SPECIFIED_HASH:
+            if (name == "SPECIFIED")
+            {
+              return Mpeg2ParControl::SPECIFIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Mpeg2ParControl::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2ParControl(Mpeg2ParControl enumValue)
+        const char* GetNameForMpeg2ParControl(Mpeg2ParControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Mpeg2QualityTuningLevelMapper
       {
 
-        static const int SINGLE_PASS_HASH = HashingUtils::HashString("SINGLE_PASS");
-        static const int MULTI_PASS_HASH = HashingUtils::HashString("MULTI_PASS");
+        static constexpr int SINGLE_PASS_HASH = HashingUtils::CompileTimeHashString("SINGLE_PASS");
+        static constexpr int MULTI_PASS_HASH = HashingUtils::CompileTimeHashString("MULTI_PASS");
 
 
         Mpeg2QualityTuningLevel GetMpeg2QualityTuningLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_PASS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2QualityTuningLevel::SINGLE_PASS;
-          }
-          else if (hashCode == MULTI_PASS_HASH)
-          {
-            return Mpeg2QualityTuningLevel::MULTI_PASS;
+          case SINGLE_PASS_HASH:
+            if (name == "SINGLE_PASS")
+            {
+              return Mpeg2QualityTuningLevel::SINGLE_PASS;
+            }
+            break;
+          case MULTI_PASS_HASH:
+            if (name == "MULTI_PASS")
+            {
+              return Mpeg2QualityTuningLevel::MULTI_PASS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Mpeg2QualityTuningLevel::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2QualityTuningLevel(Mpeg2QualityTuningLevel enumValue)
+        const char* GetNameForMpeg2QualityTuningLevel(Mpeg2QualityTuningLevel enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Mpeg2RateControlModeMapper
       {
 
-        static const int VBR_HASH = HashingUtils::HashString("VBR");
-        static const int CBR_HASH = HashingUtils::HashString("CBR");
+        static constexpr int VBR_HASH = HashingUtils::CompileTimeHashString("VBR");
+        static constexpr int CBR_HASH = HashingUtils::CompileTimeHashString("CBR");
 
 
         Mpeg2RateControlMode GetMpeg2RateControlModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VBR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2RateControlMode::VBR;
-          }
-          else if (hashCode == CBR_HASH)
-          {
-            return Mpeg2RateControlMode::CBR;
+          case VBR_HASH:
+            if (name == "VBR")
+            {
+              return Mpeg2RateControlMode::VBR;
+            }
+            break;
+          case CBR_HASH:
+            if (name == "CBR")
+            {
+              return Mpeg2RateControlMode::CBR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Mpeg2RateControlMode::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2RateControlMode(Mpeg2RateControlMode enumValue)
+        const char* GetNameForMpeg2RateControlMode(Mpeg2RateControlMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Mpeg2SyntaxMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int D_10_HASH = HashingUtils::HashString("D_10");
+        static constexpr int DEFAULT_HASH = HashingUtils::CompileTimeHashString("DEFAULT");
+        static constexpr int D_10_HASH = HashingUtils::CompileTimeHashString("D_10");
 
 
         Mpeg2Syntax GetMpeg2SyntaxForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mpeg2Syntax::DEFAULT;
-          }
-          else if (hashCode == D_10_HASH)
-          {
-            return Mpeg2Syntax::D_10;
+          case DEFAULT_HASH:
+            if (name == "DEFAULT")
+            {
+              return Mpeg2Syntax::DEFAULT;
+            }
+            break;
+          case D_10_HASH:
+            if (name == "D_10")
+            {
+              return Mpeg2Syntax::D_10;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Mpeg2Syntax::NOT_SET;
         }
 
-        Aws::String GetNameForMpeg2Syntax(Mpeg2Syntax enumValue)
+        const char* GetNameForMpeg2Syntax(Mpeg2Syntax enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace MsSmoothAudioDeduplicationMapper
       {
 
-        static const int COMBINE_DUPLICATE_STREAMS_HASH = HashingUtils::HashString("COMBINE_DUPLICATE_STREAMS");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int COMBINE_DUPLICATE_STREAMS_HASH = HashingUtils::CompileTimeHashString("COMBINE_DUPLICATE_STREAMS");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         MsSmoothAudioDeduplication GetMsSmoothAudioDeduplicationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMBINE_DUPLICATE_STREAMS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MsSmoothAudioDeduplication::COMBINE_DUPLICATE_STREAMS;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return MsSmoothAudioDeduplication::NONE;
+          case COMBINE_DUPLICATE_STREAMS_HASH:
+            if (name == "COMBINE_DUPLICATE_STREAMS")
+            {
+              return MsSmoothAudioDeduplication::COMBINE_DUPLICATE_STREAMS;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return MsSmoothAudioDeduplication::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MsSmoothAudioDeduplication::NOT_SET;
         }
 
-        Aws::String GetNameForMsSmoothAudioDeduplication(MsSmoothAudioDeduplication enumValue)
+        const char* GetNameForMsSmoothAudioDeduplication(MsSmoothAudioDeduplication enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace MsSmoothManifestEncodingMapper
       {
 
-        static const int UTF8_HASH = HashingUtils::HashString("UTF8");
-        static const int UTF16_HASH = HashingUtils::HashString("UTF16");
+        static constexpr int UTF8_HASH = HashingUtils::CompileTimeHashString("UTF8");
+        static constexpr int UTF16_HASH = HashingUtils::CompileTimeHashString("UTF16");
 
 
         MsSmoothManifestEncoding GetMsSmoothManifestEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UTF8_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MsSmoothManifestEncoding::UTF8;
-          }
-          else if (hashCode == UTF16_HASH)
-          {
-            return MsSmoothManifestEncoding::UTF16;
+          case UTF8_HASH:
+            if (name == "UTF8")
+            {
+              return MsSmoothManifestEncoding::UTF8;
+            }
+            break;
+          case UTF16_HASH:
+            if (name == "UTF16")
+            {
+              return MsSmoothManifestEncoding::UTF16;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MsSmoothManifestEncoding::NOT_SET;
         }
 
-        Aws::String GetNameForMsSmoothManifestEncoding(MsSmoothManifestEncoding enumValue)
+        const char* GetNameForMsSmoothManifestEncoding(MsSmoothManifestEncoding enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
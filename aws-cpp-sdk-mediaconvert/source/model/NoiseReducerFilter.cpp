@@ -30,45 +30,65 @@ namespace Aws
       namespace NoiseReducerFilterMapper
       {
 
-        static const int BILATERAL_HASH = HashingUtils::HashString("BILATERAL");
-        static const int MEAN_HASH = HashingUtils::HashString("MEAN");
-        static const int GAUSSIAN_HASH = HashingUtils::HashString("GAUSSIAN");
-        static const int LANCZOS_HASH = HashingUtils::HashString("LANCZOS");
-        static const int SHARPEN_HASH = HashingUtils::HashString("SHARPEN");
-        static const int CONSERVE_HASH = HashingUtils::HashString("CONSERVE");
-        static const int SPATIAL_HASH = HashingUtils::HashString("SPATIAL");
+        static constexpr int BILATERAL_HASH = HashingUtils::CompileTimeHashString("BILATERAL");
+        static constexpr int MEAN_HASH = HashingUtils::CompileTimeHashString("MEAN");
+        static constexpr int GAUSSIAN_HASH = HashingUtils::CompileTimeHashString("GAUSSIAN");
+        static constexpr int LANCZOS_HASH = HashingUtils::CompileTimeHashString("LANCZOS");
+        static constexpr int SHARPEN_HASH = HashingUtils::CompileTimeHashString("SHARPEN");
+        static constexpr int CONSERVE_HASH = HashingUtils::CompileTimeHashString("CONSERVE");
+        static constexpr int SPATIAL_HASH = HashingUtils::CompileTimeHashString("SPATIAL");
 
 
         NoiseReducerFilter GetNoiseReducerFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BILATERAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NoiseReducerFilter::BILATERAL;
-          }
-          else if (hashCode == MEAN_HASH)
-          {
-            return NoiseReducerFilter::MEAN;
-          }
-          else if (hashCode == GAUSSIAN_HASH)
-          {
-            return NoiseReducerFilter::GAUSSIAN;
-          }
-          else if (hashCode == LANCZOS_HASH)
-          {
-            return NoiseReducerFilter::LANCZOS;
-          }
-          else if (hashCode == SHARPEN_HASH)
-          {
-            return NoiseReducerFilter::SHARPEN;
-          }
-          else if (hashCode == CONSERVE_HASH)
-          {
-            return NoiseReducerFilter::CONSERVE;
-          }
-          else if (hashCode == SPATIAL_HASH)
-          {
-            return NoiseReducerFilter::SPATIAL;
+          case BILATERAL_HASH:
+            if (name == "BILATERAL")
+            {
+              return NoiseReducerFilter::BILATERAL;
+            }
+            break;
+          case MEAN_HASH:
+            if (name == "MEAN")
+            {
+              return NoiseReducerFilter::MEAN;
+            }
+            break;
+          case GAUSSIAN_HASH:
+            if (name == "GAUSSIAN")
+            {
+              return NoiseReducerFilter::GAUSSIAN;
+            }
+            break;
+          case LANCZOS_HASH:
+            if (name == "LANCZOS")
+            {
+              return NoiseReducerFilter::LANCZOS;
+            }
+            break;
+          case SHARPEN_HASH:
+            if (name == "SHARPEN")
+            {
+              return NoiseReducerFilter::SHARPEN;
+            }
+            break;
+          case CONSERVE_HASH:
+            if (name == "CONSERVE")
+            {
+              return NoiseReducerFilter::CONSERVE;
+            }
+            break;
+          case SPATIAL_HASH:
+            if (name == "SPATIAL")
+            {
+              return NoiseReducerFilter::SPATIAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return NoiseReducerFilter::NOT_SET;
         }
 
-        Aws::String GetNameForNoiseReducerFilter(NoiseReducerFilter enumValue)
+        const char* GetNameForNoiseReducerFilter(NoiseReducerFilter enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
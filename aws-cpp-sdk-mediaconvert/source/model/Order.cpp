@@ -30,20 +30,30 @@ namespace Aws
       namespace OrderMapper
       {
 
-        static const int ASCENDING_HASH = HashingUtils::HashString("ASCENDING");
-        static const int DESCENDING_HASH = HashingUtils::HashString("DESCENDING");
+        static constexpr int ASCENDING_HASH = HashingUtils::CompileTimeHashString("ASCENDING");
+        static constexpr int DESCENDING_HASH = HashingUtils::CompileTimeHashString("DESCENDING");
 
 
         Order GetOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASCENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Order::ASCENDING;
-          }
-          else if (hashCode == DESCENDING_HASH)
-          {
-            return Order::DESCENDING;
+          case ASCENDING_HASH:
+            if (name == "ASCENDING")
+            {
+              return Order::ASCENDING;
+            }
+            break;
+          case DESCENDING_HASH:
+            if (name == "DESCENDING")
+            {
+              return Order::DESCENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Order::NOT_SET;
         }
 
-        Aws::String GetNameForOrder(Order enumValue)
+        const char* GetNameForOrder(Order enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
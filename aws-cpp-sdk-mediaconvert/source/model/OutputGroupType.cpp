@@ -30,35 +30,51 @@ namespace Aws
       namespace OutputGroupTypeMapper
       {
 
-        static const int HLS_GROUP_SETTINGS_HASH = HashingUtils::HashString("HLS_GROUP_SETTINGS");
-        static const int DASH_ISO_GROUP_SETTINGS_HASH = HashingUtils::HashString("DASH_ISO_GROUP_SETTINGS");
-        static const int FILE_GROUP_SETTINGS_HASH = HashingUtils::HashString("FILE_GROUP_SETTINGS");
-        static const int MS_SMOOTH_GROUP_SETTINGS_HASH = HashingUtils::HashString("MS_SMOOTH_GROUP_SETTINGS");
-        static const int CMAF_GROUP_SETTINGS_HASH = HashingUtils::HashString("CMAF_GROUP_SETTINGS");
+        static constexpr int HLS_GROUP_SETTINGS_HASH = HashingUtils::CompileTimeHashString("HLS_GROUP_SETTINGS");
+        static constexpr int DASH_ISO_GROUP_SETTINGS_HASH = HashingUtils::CompileTimeHashString("DASH_ISO_GROUP_SETTINGS");
+        static constexpr int FILE_GROUP_SETTINGS_HASH = HashingUtils::CompileTimeHashString("FILE_GROUP_SETTINGS");
+        static constexpr int MS_SMOOTH_GROUP_SETTINGS_HASH = HashingUtils::CompileTimeHashString("MS_SMOOTH_GROUP_SETTINGS");
+        static constexpr int CMAF_GROUP_SETTINGS_HASH = HashingUtils::CompileTimeHashString("CMAF_GROUP_SETTINGS");
 
 
         OutputGroupType GetOutputGroupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HLS_GROUP_SETTINGS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OutputGroupType::HLS_GROUP_SETTINGS;
-          }
-          else if (hashCode == DASH_ISO_GROUP_SETTINGS_HASH)
-          {
-            return OutputGroupType::DASH_ISO_GROUP_SETTINGS;
-          }
-          else if (hashCode == FILE_GROUP_SETTINGS_HASH)
-          {
-            return OutputGroupType::FILE_GROUP_SETTINGS;
-          }
-          else if (hashCode == MS_SMOOTH_GROUP_SETTINGS_HASH)
-          {
-            return OutputGroupType::MS_SMOOTH_GROUP_SETTINGS;
-          }
-          else if (hashCode == CMAF_GROUP_SETTINGS_HASH)
-          {
-            return OutputGroupType::CMAF_GROUP_SETTINGS;
+          case HLS_GROUP_SETTINGS_HASH:
+            if (name == "HLS_GROUP_SETTINGS")
+            {
+              return OutputGroupType::HLS_GROUP_SETTINGS;
+            }
+            break;
+          case DASH_ISO_GROUP_SETTINGS_HASH:
+            if (name == "DASH_ISO_GROUP_SETTINGS")
+            {
+              return OutputGroupType::DASH_ISO_GROUP_SETTINGS;
+            }
+            break;
+          case FILE_GROUP_SETTINGS_HASH:
+            if (name == "FILE_GROUP_SETTINGS")
+            {
+              return OutputGroupType::FILE_GROUP_SETTINGS;
+            }
+            break;
+          case MS_SMOOTH_GROUP_SETTINGS_HASH:
+            if (name == "MS_SMOOTH_GROUP_SETTINGS")
+            {
+              return OutputGroupType::MS_SMOOTH_GROUP_SETTINGS;
+            }
+            break;
+          case CMAF_GROUP_SETTINGS_HASH:
+            if (name == "CMAF_GROUP_SETTINGS")
+            {
+              return OutputGroupType::CMAF_GROUP_SETTINGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return OutputGroupType::NOT_SET;
         }
 
-        Aws::String GetNameForOutputGroupType(OutputGroupType enumValue)
+        const char* GetNameForOutputGroupType(OutputGroupType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace OutputSdtMapper
       {
 
-        static const int SDT_FOLLOW_HASH = HashingUtils::HashString("SDT_FOLLOW");
-        static const int SDT_FOLLOW_IF_PRESENT_HASH = HashingUtils::HashString("SDT_FOLLOW_IF_PRESENT");
-        static const int SDT_MANUAL_HASH = HashingUtils::HashString("SDT_MANUAL");
-        static const int SDT_NONE_HASH = HashingUtils::HashString("SDT_NONE");
+        static constexpr int SDT_FOLLOW_HASH = HashingUtils::CompileTimeHashString("SDT_FOLLOW");
+        static constexpr int SDT_FOLLOW_IF_PRESENT_HASH = HashingUtils::CompileTimeHashString("SDT_FOLLOW_IF_PRESENT");
+        static constexpr int SDT_MANUAL_HASH = HashingUtils::CompileTimeHashString("SDT_MANUAL");
+        static constexpr int SDT_NONE_HASH = HashingUtils::CompileTimeHashString("SDT_NONE");
 
 
         OutputSdt GetOutputSdtForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SDT_FOLLOW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OutputSdt::SDT_FOLLOW;
-          }
-          else if (hashCode == SDT_FOLLOW_IF_PRESENT_HASH)
-          {
-            return OutputSdt::SDT_FOLLOW_IF_PRESENT;
-          }
-          else if (hashCode == SDT_MANUAL_HASH)
-          {
-            return OutputSdt::SDT_MANUAL;
-          }
-          else if (hashCode == SDT_NONE_HASH)
-          {
-            return OutputSdt::SDT_NONE;
+          case SDT_FOLLOW_HASH:
+            if (name == "SDT_FOLLOW")
+            {
+              return OutputSdt::SDT_FOLLOW;
+            }
+            break;
+          case SDT_FOLLOW_IF_PRESENT_HASH:
+            if (name == "SDT_FOLLOW_IF_PRESENT")
+            {
+              return OutputSdt::SDT_FOLLOW_IF_PRESENT;
+            }
+            break;
+          case SDT_MANUAL_HASH:
+            if (name == "SDT_MANUAL")
+            {
+              return OutputSdt::SDT_MANUAL;
+            }
+            break;
+          case SDT_NONE_HASH:
+            if (name == "SDT_NONE")
+            {
+              return OutputSdt::SDT_NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return OutputSdt::NOT_SET;
         }
 
-        Aws::String GetNameForOutputSdt(OutputSdt enumValue)
+        const char* GetNameForOutputSdt(OutputSdt enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ProresCodecProfileMapper
       {
 
-        static const int APPLE_PRORES_422_HASH = HashingUtils::HashString("APPLE_PRORES_422");
-        static const int APPLE_PRORES_422_HQ_HASH = HashingUtils::HashString("APPLE_PRORES_422_HQ");
-        static const int APPLE_PRORES_422_LT_HASH = HashingUtils::HashString("APPLE_PRORES_422_LT");
-        static const int APPLE_PRORES_422_PROXY_HASH = HashingUtils::HashString("APPLE_PRORES_422_PROXY");
+        static constexpr int APPLE_PRORES_422_HASH = HashingUtils::CompileTimeHashString("APPLE_PRORES_422");
+        static constexpr int APPLE_PRORES_422_HQ_HASH = HashingUtils::CompileTimeHashString("APPLE_PRORES_422_HQ");
+        static constexpr int APPLE_PRORES_422_LT_HASH = HashingUtils::CompileTimeHashString("APPLE_PRORES_422_LT");
+        static constexpr int APPLE_PRORES_422_PROXY_HASH = HashingUtils::CompileTimeHashString("APPLE_PRORES_422_PROXY");
 
 
         ProresCodecProfile GetProresCodecProfileForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == APPLE_PRORES_422_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProresCodecProfile::APPLE_PRORES_422;
-          }
-          else if (hashCode == APPLE_PRORES_422_HQ_HASH)
-          {
-            return ProresCodecProfile::APPLE_PRORES_422_HQ;
-          }
-          else if (hashCode == APPLE_PRORES_422_LT_HASH)
-          {
-            return ProresCodecProfile::APPLE_PRORES_422_LT;
-          }
-          else if (hashCode == APPLE_PRORES_422_PROXY_HASH)
-          {
-            return ProresCodecProfile::APPLE_PRORES_422_PROXY;
+          case APPLE_PRORES_422_HASH:
+            if (name == "APPLE_PRORES_422")
+            {
+              return ProresCodecProfile::APPLE_PRORES_422;
+            }
+            break;
+          case APPLE_PRORES_422_HQ_HASH:
+            if (name == "APPLE_PRORES_422_HQ")
+            {
+              return ProresCodecProfile::APPLE_PRORES_422_HQ;
+            }
+            break;
+          case APPLE_PRORES_422_LT_HASH:
+            if (name == "APPLE_PRORES_422_LT")
+            {
+              return ProresCodecProfile::APPLE_PRORES_422_LT;
+            }
+            break;
+          case APPLE_PRORES_422_PROXY_HASH:
+            if (name == "APPLE_PRORES_422_PROXY")
+            {
+              return ProresCodecProfile::APPLE_PRORES_422_PROXY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ProresCodecProfile::NOT_SET;
         }
 
-        Aws::String GetNameForProresCodecProfile(ProresCodecProfile enumValue)
+        const char* GetNameForProresCodecProfile(ProresCodecProfile enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace ProresInterlaceModeMapper
       {
 
-        static const int PROGRESSIVE_HASH = HashingUtils::HashString("PROGRESSIVE");
-        static const int TOP_FIELD_HASH = HashingUtils::HashString("TOP_FIELD");
-        static const int BOTTOM_FIELD_HASH = HashingUtils::HashString("BOTTOM_FIELD");
-        static const int FOLLOW_TOP_FIELD_HASH = HashingUtils::HashString("FOLLOW_TOP_FIELD");
-        static const int FOLLOW_BOTTOM_FIELD_HASH = HashingUtils::HashString("FOLLOW_BOTTOM_FIELD");
+        static constexpr int PROGRESSIVE_HASH = HashingUtils::CompileTimeHashString("PROGRESSIVE");
+        static constexpr int TOP_FIELD_HASH = HashingUtils::CompileTimeHashString("TOP_FIELD");
+        static constexpr int BOTTOM_FIELD_HASH = HashingUtils::CompileTimeHashString("BOTTOM_FIELD");
+        static constexpr int FOLLOW_TOP_FIELD_HASH = HashingUtils::CompileTimeHashString("FOLLOW_TOP_FIELD");
+        static constexpr int FOLLOW_BOTTOM_FIELD_HASH = HashingUtils::CompileTimeHashString("FOLLOW_BOTTOM_FIELD");
 
 
         ProresInterlaceMode GetProresInterlaceModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROGRESSIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProresInterlaceMode::PROGRESSIVE;
-          }
-          else if (hashCode == TOP_FIELD_HASH)
-          {
-            return ProresInterlaceMode::TOP_FIELD;
-          }
-          else if (hashCode == BOTTOM_FIELD_HASH)
-          {
-            return ProresInterlaceMode::BOTTOM_FIELD;
-          }
-          else if (hashCode == FOLLOW_TOP_FIELD_HASH)
-          {
-            return ProresInterlaceMode::FOLLOW_TOP_FIELD;
-          }
-          else if (hashCode == FOLLOW_BOTTOM_FIELD_HASH)
-          {
-            return ProresInterlaceMode::FOLLOW_BOTTOM_FIELD;
+          case PROGRESSIVE_HASH:
+            if (name == "PROGRESSIVE")
+            {
+              return ProresInterlaceMode::PROGRESSIVE;
+            }
+            break;
+          case TOP_FIELD_HASH:
+            if (name == "TOP_FIELD")
+            {
+              return ProresInterlaceMode::TOP_FIELD;
+            }
+            break;
+          case BOTTOM_FIELD_HASH:
+            if (name == "BOTTOM_FIELD")
+            {
+              return ProresInterlaceMode::BOTTOM_FIELD;
+            }
+            break;
+          case FOLLOW_TOP_FIELD_HASH:
+            if (name == "FOLLOW_TOP_FIELD")
+            {
+              return ProresInterlaceMode::FOLLOW_TOP_FIELD;
+            }
+            break;
+          case FOLLOW_BOTTOM_FIELD_HASH:
+            if (name == "FOLLOW_BOTTOM_FIELD")
+            {
+              return ProresInterlaceMode::FOLLOW_BOTTOM_FIELD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ProresInterlaceMode::NOT_SET;
         }
 
-        Aws::String GetNameForProresInterlaceMode(ProresInterlaceMode enumValue)
+        const char* GetNameForProresInterlaceMode(ProresInterlaceMode enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ProresTelecineMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int HARD_HASH = HashingUtils::HashString("HARD");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int HARD_HASH = HashingUtils::CompileTimeHashString("HARD");
 
 
         ProresTelecine GetProresTelecineForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProresTelecine::NONE;
-          }
-          else if (hashCode == HARD_HASH)
-          {
-            return ProresTelecine::HARD;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return ProresTelecine::NONE;
+            }
+            break;
+          case HARD_HASH:
+            if (name == "HARD")
+            {
+              return ProresTelecine::HARD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ProresTelecine::NOT_SET;
         }
 
-        Aws::String GetNameForProresTelecine(ProresTelecine enumValue)
+        const char* GetNameForProresTelecine(ProresTelecine enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
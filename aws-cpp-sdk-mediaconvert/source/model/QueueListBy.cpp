@@ -30,20 +30,30 @@ namespace Aws
       namespace QueueListByMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int CREATION_DATE_HASH = HashingUtils::HashString("CREATION_DATE");
+        static constexpr int NAME_HASH = HashingUtils::CompileTimeHashString("NAME");
+        static constexpr int CREATION_DATE_HASH = HashingUtils::CompileTimeHashString("CREATION_DATE");
 
 
         QueueListBy GetQueueListByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QueueListBy::NAME;
-          }
-          else if (hashCode == CREATION_DATE_HASH)
-          {
-            return QueueListBy::CREATION_DATE;
+          case NAME_HASH:
+            if (name == "NAME")
+            {
+              return QueueListBy::NAME;
+            }
+            break;
+          case CREATION_DATE_HASH:
+            if (name == "CREATION_DATE")
+            {
+              return QueueListBy::CREATION_DATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return QueueListBy::NOT_SET;
         }
 
-        Aws::String GetNameForQueueListBy(QueueListBy enumValue)
+        const char* GetNameForQueueListBy(QueueListBy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace QueueStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int PAUSED_HASH = HashingUtils::HashString("PAUSED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int PAUSED_HASH = HashingUtils::CompileTimeHashString("PAUSED");
 
 
         QueueStatus GetQueueStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QueueStatus::ACTIVE;
-          }
-          else if (hashCode == PAUSED_HASH)
-          {
-            return QueueStatus::PAUSED;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return QueueStatus::ACTIVE;
+            }
+            break;
+          case PAUSED_HASH:
+            if (name == "PAUSED")
+            {
+              return QueueStatus::PAUSED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return QueueStatus::NOT_SET;
         }
 
-        Aws::String GetNameForQueueStatus(QueueStatus enumValue)
+        const char* GetNameForQueueStatus(QueueStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace RespondToAfdMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int RESPOND_HASH = HashingUtils::HashString("RESPOND");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int RESPOND_HASH = HashingUtils::CompileTimeHashString("RESPOND");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
 
 
         RespondToAfd GetRespondToAfdForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RespondToAfd::NONE;
-          }
-          else if (hashCode == RESPOND_HASH)
-          {
-            return RespondToAfd::RESPOND;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return RespondToAfd::PASSTHROUGH;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return RespondToAfd::NONE;
+            }
+            break;
+          case RESPOND_HASH:
+            if (name == "RESPOND")
+            {
+              return RespondToAfd::RESPOND;
+            }
+            break;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return RespondToAfd::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RespondToAfd::NOT_SET;
         }
 
-        Aws::String GetNameForRespondToAfd(RespondToAfd enumValue)
+        const char* GetNameForRespondToAfd(RespondToAfd enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
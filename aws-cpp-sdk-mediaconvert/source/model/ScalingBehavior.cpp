@@ -30,20 +30,30 @@ namespace Aws
       namespace ScalingBehaviorMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int STRETCH_TO_OUTPUT_HASH = HashingUtils::HashString("STRETCH_TO_OUTPUT");
+        static constexpr int DEFAULT_HASH = HashingUtils::CompileTimeHashString("DEFAULT");
+        static constexpr int STRETCH_TO_OUTPUT_HASH = HashingUtils::CompileTimeHashString("STRETCH_TO_OUTPUT");
 
 
         ScalingBehavior GetScalingBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScalingBehavior::DEFAULT;
-          }
-          else if (hashCode == STRETCH_TO_OUTPUT_HASH)
-          {
-            return ScalingBehavior::STRETCH_TO_OUTPUT;
+          case DEFAULT_HASH:
+            if (name == "DEFAULT")
+            {
+              return ScalingBehavior::DEFAULT;
+            }
+            break;
+          case STRETCH_TO_OUTPUT_HASH:
+            if (name == "STRETCH_TO_OUTPUT")
+            {
+              return ScalingBehavior::STRETCH_TO_OUTPUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ScalingBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForScalingBehavior(ScalingBehavior enumValue)
+        const char* GetNameForScalingBehavior(ScalingBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
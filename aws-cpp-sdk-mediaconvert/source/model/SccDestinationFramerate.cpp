@@ -30,30 +30,44 @@ namespace Aws
       namespace SccDestinationFramerateMapper
       {
 
-        static const int FRAMERATE_23_97_HASH = HashingUtils::HashString("FRAMERATE_23_97");
-        static const int FRAMERATE_24_HASH = HashingUtils::HashString("FRAMERATE_24");
-        static const int FRAMERATE_29_97_DROPFRAME_HASH = HashingUtils::HashString("FRAMERATE_29_97_DROPFRAME");
-        static const int FRAMERATE_29_97_NON_DROPFRAME_HASH = HashingUtils::HashString("FRAMERATE_29_97_NON_DROPFRAME");
+        static constexpr int FRAMERATE_23_97_HASH = HashingUtils::CompileTimeHashString("FRAMERATE_23_97");
+        static constexpr int FRAMERATE_24_HASH = HashingUtils::CompileTimeHashString("FRAMERATE_24");
+        static constexpr int FRAMERATE_29_97_DROPFRAME_HASH = HashingUtils::CompileTimeHashString("FRAMERATE_29_97_DROPFRAME");
+        static constexpr int FRAMERATE_29_97_NON_DROPFRAME_HASH = HashingUtils::CompileTimeHashString("FRAMERATE_29_97_NON_DROPFRAME");
 
 
         SccDestinationFramerate GetSccDestinationFramerateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FRAMERATE_23_97_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SccDestinationFramerate::FRAMERATE_23_97;
-          }
-          else if (hashCode == FRAMERATE_24_HASH)
-          {
-            return SccDestinationFramerate::FRAMERATE_24;
-          }
-          else if (hashCode == FRAMERATE_29_97_DROPFRAME_HASH)
-          {
-            return SccDestinationFramerate::FRAMERATE_29_97_DROPFRAME;
-          }
-          else if (hashCode == FRAMERATE_29_97_NON_DROPFRAME_HASH)
-          {
-            return SccDestinationFramerate::FRAMERATE_29_97_NON_DROPFRAME;
+          case FRAMERATE_23_97_HASH:
+            if (name == "FRAMERATE_23_97")
+            {
+              return SccDestinationFramerate::FRAMERATE_23_97;
+            }
+            break;
+          case FRAMERATE_24_HASH:
+            if (name == "FRAMERATE_24")
+            {
+              return SccDestinationFramerate::FRAMERATE_24;
+            }
+            break;
+          case FRAMERATE_29_97_DROPFRAME_HASH:
+            if (name == "FRAMERATE_29_97_DROPFRAME")
+            {
+              return SccDestinationFramerate::FRAMERATE_29_97_DROPFRAME;
+            }
+            break;
+          case FRAMERATE_29_97_NON_DROPFRAME_HASH:
+            if (name == "FRAMERATE_29_97_NON_DROPFRAME")
+            {
+              return SccDestinationFramerate::FRAMERATE_29_97_NON_DROPFRAME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return SccDestinationFramerate::NOT_SET;
         }
 
-        Aws::String GetNameForSccDestinationFramerate(SccDestinationFramerate enumValue)
+        const char* GetNameForSccDestinationFramerate(SccDestinationFramerate enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
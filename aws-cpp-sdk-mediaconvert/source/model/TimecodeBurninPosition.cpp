@@ -30,55 +30,79 @@ namespace Aws
       namespace TimecodeBurninPositionMapper
       {
 
-        static const int TOP_CENTER_HASH = HashingUtils::HashString("TOP_CENTER");
-        static const int TOP_LEFT_HASH = HashingUtils::HashString("TOP_LEFT");
-        static const int TOP_RIGHT_HASH = HashingUtils::HashString("TOP_RIGHT");
-        static const int MIDDLE_LEFT_HASH = HashingUtils::HashString("MIDDLE_LEFT");
-        static const int MIDDLE_CENTER_HASH = HashingUtils::HashString("MIDDLE_CENTER");
-        static const int MIDDLE_RIGHT_HASH = HashingUtils::HashString("MIDDLE_RIGHT");
-        static const int BOTTOM_LEFT_HASH = HashingUtils::HashString("BOTTOM_LEFT");
-        static const int BOTTOM_CENTER_HASH = HashingUtils::HashString("BOTTOM_CENTER");
-        static const int BOTTOM_RIGHT_HASH = HashingUtils::HashString("BOTTOM_RIGHT");
+        static constexpr int TOP_CENTER_HASH = HashingUtils::CompileTimeHashString("TOP_CENTER");
+        static constexpr int TOP_LEFT_HASH = HashingUtils::CompileTimeHashString("TOP_LEFT");
+        static constexpr int TOP_RIGHT_HASH = HashingUtils::CompileTimeHashString("TOP_RIGHT");
+        static constexpr int MIDDLE_LEFT_HASH = HashingUtils::CompileTimeHashString("MIDDLE_LEFT");
+        static constexpr int MIDDLE_CENTER_HASH = HashingUtils::CompileTimeHashString("MIDDLE_CENTER");
+        static constexpr int MIDDLE_RIGHT_HASH = HashingUtils::CompileTimeHashString("MIDDLE_RIGHT");
+        static constexpr int BOTTOM_LEFT_HASH = HashingUtils::CompileTimeHashString("BOTTOM_LEFT");
+        static constexpr int BOTTOM_CENTER_HASH = HashingUtils::CompileTimeHashString("BOTTOM_CENTER");
+        static constexpr int BOTTOM_RIGHT_HASH = HashingUtils::CompileTimeHashString("BOTTOM_RIGHT");
 
 
         TimecodeBurninPosition GetTimecodeBurninPositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TOP_CENTER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TimecodeBurninPosition::TOP_CENTER;
-          }
-          else if (hashCode == TOP_LEFT_HASH)
-          {
-            return TimecodeBurninPosition::TOP_LEFT;
-          }
-          else if (hashCode == TOP_RIGHT_HASH)
-          {
-            return TimecodeBurninPosition::TOP_RIGHT;
-          }
-          else if (hashCode == MIDDLE_LEFT_HASH)
-          {
-            return TimecodeBurninPosition::MIDDLE_LEFT;
-          }
-          else if (hashCode == MIDDLE_CENTER_HASH)
-          {
-            return TimecodeBurninPosition::MIDDLE_CENTER;
-          }
-          else if (hashCode == MIDDLE_RIGHT_HASH)
-          {
-            return TimecodeBurninPosition::MIDDLE_RIGHT;
-          }
-          else if (hashCode == BOTTOM_LEFT_HASH)
-          {
-            return TimecodeBurninPosition::BOTTOM_LEFT;
-          }
-          else if (hashCode == BOTTOM_CENTER_HASH)
-          {
-            return TimecodeBurninPosition::BOTTOM_CENTER;
-          }
-          else if (hashCode == BOTTOM_RIGHT_HASH)
-          {
-            return TimecodeBurninPosition::BOTTOM_RIGHT;
+          case TOP_CENTER_HASH:
+            if (name == "TOP_CENTER")
+            {
+              return TimecodeBurninPosition::TOP_CENTER;
+            }
+            break;
+          case TOP_LEFT_HASH:
+            if (name == "TOP_LEFT")
+            {
+              return TimecodeBurninPosition::TOP_LEFT;
+            }
+            break;
+          case TOP_RIGHT_HASH:
+            if (name == "TOP_RIGHT")
+            {
+              return TimecodeBurninPosition::TOP_RIGHT;
+            }
+            break;
+          case MIDDLE_LEFT_HASH:
+            if (name == "MIDDLE_LEFT")
+            {
+              return TimecodeBurninPosition::MIDDLE_LEFT;
+            }
+            break;
+          case MIDDLE_CENTER_HASH:
+            if (name == "MIDDLE_CENTER")
+            {
+              return TimecodeBurninPosition::MIDDLE_CENTER;
+            }
+            break;
+          case MIDDLE_RIGHT_HASH:
+            if (name == "MIDDLE_RIGHT")
+            {
+              return TimecodeBurninPosition::MIDDLE_RIGHT;
+            }
+            break;
+          case BOTTOM_LEFT_HASH:
+            if (name == "BOTTOM_LEFT")
+            {
+              return TimecodeBurninPosition::BOTTOM_LEFT;
+            }
+            break;
+          case BOTTOM_CENTER_HASH:
+            if (name == "BOTTOM_CENTER")
+            {
+              return TimecodeBurninPosition::BOTTOM_CENTER;
+            }
+            break;
+          case BOTTOM_RIGHT_HASH:
+            if (name == "BOTTOM_RIGHT")
+            {
+              return TimecodeBurninPosition::BOTTOM_RIGHT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return TimecodeBurninPosition::NOT_SET;
         }
 
-        Aws::String GetNameForTimecodeBurninPosition(TimecodeBurninPosition enumValue)
+        const char* GetNameForTimecodeBurninPosition(TimecodeBurninPosition enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
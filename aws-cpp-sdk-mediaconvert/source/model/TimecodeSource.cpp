@@ -30,25 +30,37 @@ namespace Aws
       namespace TimecodeSourceMapper
       {
 
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int ZEROBASED_HASH = HashingUtils::HashString("ZEROBASED");
-        static const int SPECIFIEDSTART_HASH = HashingUtils::HashString("SPECIFIEDSTART");
+        static constexpr int EMBEDDED_HASH = HashingUtils::CompileTimeHashString("EMBEDDED");
+        static constexpr int ZEROBASED_HASH = HashingUtils::CompileTimeHashString("ZEROBASED");
+        static constexpr int SPECIFIEDSTART_HASH = HashingUtils::CompileTimeHashString("SPECIFIEDSTART");
 
 
         TimecodeSource GetTimecodeSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMBEDDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TimecodeSource::EMBEDDED;
-          }
-          else if (hashCode == ZEROBASED_HASH)
-          {
-            return TimecodeSource::ZEROBASED;
-          }
-          else if (hashCode == SPECIFIEDSTART_HASH)
-          {
-            return TimecodeSource::SPECIFIEDSTART;
+          case EMBEDDED_HASH:
+            if (name == "EMBEDDED")
+            {
+              return TimecodeSource::EMBEDDED;
+            }
+            break;
+          case ZEROBASED_HASH:
+            if (name == "ZEROBASED")
+            {
+              return TimecodeSource::ZEROBASED;
+            }
+            break;
+          case SPECIFIEDSTART_HASH:
+            if (name == "SPECIFIEDSTART")
+            {
+              return TimecodeSource::SPECIFIEDSTART;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TimecodeSource::NOT_SET;
         }
 
-        Aws::String GetNameForTimecodeSource(TimecodeSource enumValue)
+        const char* GetNameForTimecodeSource(TimecodeSource enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
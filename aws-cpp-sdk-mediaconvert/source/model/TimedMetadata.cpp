@@ -30,20 +30,30 @@ namespace Aws
       namespace TimedMetadataMapper
       {
 
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         TimedMetadata GetTimedMetadataForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PASSTHROUGH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TimedMetadata::PASSTHROUGH;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return TimedMetadata::NONE;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return TimedMetadata::PASSTHROUGH;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return TimedMetadata::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TimedMetadata::NOT_SET;
         }
 
-        Aws::String GetNameForTimedMetadata(TimedMetadata enumValue)
+        const char* GetNameForTimedMetadata(TimedMetadata enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
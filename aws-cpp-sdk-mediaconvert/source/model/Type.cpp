@@ -30,20 +30,30 @@ namespace Aws
       namespace TypeMapper
       {
 
-        static const int SYSTEM_HASH = HashingUtils::HashString("SYSTEM");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
+        static constexpr int SYSTEM_HASH = HashingUtils::CompileTimeHashString("SYSTEM");
+        static constexpr int CUSTOM_HASH = HashingUtils::CompileTimeHashString("CUSTOM");
 
 
         Type GetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SYSTEM_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Type::SYSTEM;
-          }
-          else if (hashCode == CUSTOM_HASH)
-          {
-            return Type::CUSTOM;
+          case SYSTEM_HASH:
+            if (name == "SYSTEM")
+            {
+              return Type::SYSTEM;
+            }
+            break;
+          case CUSTOM_HASH:
+            if (name == "CUSTOM")
+            {
+              return Type::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Type::NOT_SET;
         }
 
-        Aws::String GetNameForType(Type enumValue)
+        const char* GetNameForType(Type enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace VideoCodecMapper
       {
 
-        static const int FRAME_CAPTURE_HASH = HashingUtils::HashString("FRAME_CAPTURE");
-        static const int H_264_HASH = HashingUtils::HashString("H_264");
-        static const int H_265_HASH = HashingUtils::HashString("H_265");
-        static const int MPEG2_HASH = HashingUtils::HashString("MPEG2");
-        static const int PRORES_HASH = HashingUtils::HashString("PRORES");
+        static constexpr int FRAME_CAPTURE_HASH = HashingUtils::CompileTimeHashString("FRAME_CAPTURE");
+        static constexpr int H_264_HASH = HashingUtils::CompileTimeHashString("H_264");
+        static constexpr int H_265_HASH = HashingUtils::CompileTimeHashString("H_265");
+        static constexpr int MPEG2_HASH = HashingUtils::CompileTimeHashString("MPEG2");
+        static constexpr int PRORES_HASH = HashingUtils::CompileTimeHashString("PRORES");
 
 
         VideoCodec GetVideoCodecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FRAME_CAPTURE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VideoCodec::FRAME_CAPTURE;
-          }
-          else if (hashCode == H_264_HASH)
-          {
-            return VideoCodec::H_264;
-          }
-          else if (hashCode == H_265_HASH)
-          {
-            return VideoCodec::H_265;
-          }
-          else if (hashCode == MPEG2_HASH)
-          {
-            return VideoCodec::MPEG2;
-          }
-          else if (hashCode == PRORES_HASH)
-          {
-            return VideoCodec::PRORES;
+          case FRAME_CAPTURE_HASH:
+            if (name == "FRAME_CAPTURE")
+            {
+              return VideoCodec::FRAME_CAPTURE;
+            }
+            break;
+          case H_264_HASH:
+            if (name == "H_264")
+            {
+              return VideoCodec::H_264;
+            }
+            break;
+          case H_265_HASH:
+            if (name == "H_265")
+            {
+              return VideoCodec::H_265;
+            }
+            break;
+          case MPEG2_HASH:
+            if (name == "MPEG2")
+            {
+              return VideoCodec::MPEG2;
+            }
+            break;
+          case PRORES_HASH:
+            if (name == "PRORES")
+            {
+              return VideoCodec::PRORES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return VideoCodec::NOT_SET;
         }
 
-        Aws::String GetNameForVideoCodec(VideoCodec enumValue)
+        const char* GetNameForVideoCodec(VideoCodec enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
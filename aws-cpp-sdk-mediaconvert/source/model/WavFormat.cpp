@@ -30,20 +30,30 @@ namespace Aws
       namespace WavFormatMapper
       {
 
-        static const int RIFF_HASH = HashingUtils::HashString("RIFF");
-        static const int RF64_HASH = HashingUtils::HashString("RF64");
+        static constexpr int RIFF_HASH = HashingUtils::CompileTimeHashString("RIFF");
+        static constexpr int RF64_HASH = HashingUtils::CompileTimeHashString("RF64");
 
 
         WavFormat GetWavFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RIFF_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WavFormat::RIFF;
-          }
-          else if (hashCode == RF64_HASH)
-          {
-            return WavFormat::RF64;
+          case RIFF_HASH:
+            if (name == "RIFF")
+            {
+              return WavFormat::RIFF;
+            }
+            break;
+          case RF64_HASH:
+            if (name == "RF64")
+            {
+              return WavFormat::RF64;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return WavFormat::NOT_SET;
         }
 
-        Aws::String GetNameForWavFormat(WavFormat enumValue)
+        const char* GetNameForWavFormat(WavFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -37,7 +37,8 @@ namespace AacCodingModeMapper
 {
 AWS_MEDIALIVE_API AacCodingMode GetAacCodingModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAacCodingMode(AacCodingMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAacCodingMode(AacCodingMode value);
 } // namespace AacCodingModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace AacInputTypeMapper
 {
 AWS_MEDIALIVE_API AacInputType GetAacInputTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAacInputType(AacInputType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAacInputType(AacInputType value);
 } // namespace AacInputTypeMapper
 } // namespace Model
 } // namespace MediaLive
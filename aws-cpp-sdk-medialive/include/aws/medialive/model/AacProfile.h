@@ -35,7 +35,8 @@ namespace AacProfileMapper
 {
 AWS_MEDIALIVE_API AacProfile GetAacProfileForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAacProfile(AacProfile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAacProfile(AacProfile value);
 } // namespace AacProfileMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace AacRawFormatMapper
 {
 AWS_MEDIALIVE_API AacRawFormat GetAacRawFormatForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAacRawFormat(AacRawFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAacRawFormat(AacRawFormat value);
 } // namespace AacRawFormatMapper
 } // namespace Model
 } // namespace MediaLive
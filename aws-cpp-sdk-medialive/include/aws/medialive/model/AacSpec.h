@@ -34,7 +34,8 @@ namespace AacSpecMapper
 {
 AWS_MEDIALIVE_API AacSpec GetAacSpecForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAacSpec(AacSpec value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAacSpec(AacSpec value);
 } // namespace AacSpecMapper
 } // namespace Model
 } // namespace MediaLive
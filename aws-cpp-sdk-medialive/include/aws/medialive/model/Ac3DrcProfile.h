@@ -34,7 +34,8 @@ namespace Ac3DrcProfileMapper
 {
 AWS_MEDIALIVE_API Ac3DrcProfile GetAc3DrcProfileForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAc3DrcProfile(Ac3DrcProfile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAc3DrcProfile(Ac3DrcProfile value);
 } // namespace Ac3DrcProfileMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace AfdSignalingMapper
 {
 AWS_MEDIALIVE_API AfdSignaling GetAfdSignalingForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAfdSignaling(AfdSignaling value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAfdSignaling(AfdSignaling value);
 } // namespace AfdSignalingMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace AudioDescriptionAudioTypeControlMapper
 {
 AWS_MEDIALIVE_API AudioDescriptionAudioTypeControl GetAudioDescriptionAudioTypeControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAudioDescriptionAudioTypeControl(AudioDescriptionAudioTypeControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAudioDescriptionAudioTypeControl(AudioDescriptionAudioTypeControl value);
 } // namespace AudioDescriptionAudioTypeControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace AudioDescriptionLanguageCodeControlMapper
 {
 AWS_MEDIALIVE_API AudioDescriptionLanguageCodeControl GetAudioDescriptionLanguageCodeControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAudioDescriptionLanguageCodeControl(AudioDescriptionLanguageCodeControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAudioDescriptionLanguageCodeControl(AudioDescriptionLanguageCodeControl value);
 } // namespace AudioDescriptionLanguageCodeControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace AudioLanguageSelectionPolicyMapper
 {
 AWS_MEDIALIVE_API AudioLanguageSelectionPolicy GetAudioLanguageSelectionPolicyForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAudioLanguageSelectionPolicy(AudioLanguageSelectionPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAudioLanguageSelectionPolicy(AudioLanguageSelectionPolicy value);
 } // namespace AudioLanguageSelectionPolicyMapper
 } // namespace Model
 } // namespace MediaLive
@@ -33,7 +33,8 @@ namespace AudioNormalizationAlgorithmControlMapper
 {
 AWS_MEDIALIVE_API AudioNormalizationAlgorithmControl GetAudioNormalizationAlgorithmControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl value);
 } // namespace AudioNormalizationAlgorithmControlMapper
 } // namespace Model
 } // namespace MediaLive
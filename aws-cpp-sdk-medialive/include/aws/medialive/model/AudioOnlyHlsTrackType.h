@@ -36,7 +36,8 @@ namespace AudioOnlyHlsTrackTypeMapper
 {
 AWS_MEDIALIVE_API AudioOnlyHlsTrackType GetAudioOnlyHlsTrackTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAudioOnlyHlsTrackType(AudioOnlyHlsTrackType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAudioOnlyHlsTrackType(AudioOnlyHlsTrackType value);
 } // namespace AudioOnlyHlsTrackTypeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,7 +36,8 @@ namespace AudioTypeMapper
 {
 AWS_MEDIALIVE_API AudioType GetAudioTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAudioType(AudioType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAudioType(AudioType value);
 } // namespace AudioTypeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace AuthenticationSchemeMapper
 {
 AWS_MEDIALIVE_API AuthenticationScheme GetAuthenticationSchemeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAuthenticationScheme(AuthenticationScheme value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAuthenticationScheme(AuthenticationScheme value);
 } // namespace AuthenticationSchemeMapper
 } // namespace Model
 } // namespace MediaLive
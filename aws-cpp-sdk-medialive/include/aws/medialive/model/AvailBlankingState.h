@@ -34,7 +34,8 @@ namespace AvailBlankingStateMapper
 {
 AWS_MEDIALIVE_API AvailBlankingState GetAvailBlankingStateForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForAvailBlankingState(AvailBlankingState value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForAvailBlankingState(AvailBlankingState value);
 } // namespace AvailBlankingStateMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace BlackoutSlateNetworkEndBlackoutMapper
 {
 AWS_MEDIALIVE_API BlackoutSlateNetworkEndBlackout GetBlackoutSlateNetworkEndBlackoutForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForBlackoutSlateNetworkEndBlackout(BlackoutSlateNetworkEndBlackout value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForBlackoutSlateNetworkEndBlackout(BlackoutSlateNetworkEndBlackout value);
 } // namespace BlackoutSlateNetworkEndBlackoutMapper
 } // namespace Model
 } // namespace MediaLive
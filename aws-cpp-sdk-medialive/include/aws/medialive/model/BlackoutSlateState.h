@@ -34,7 +34,8 @@ namespace BlackoutSlateStateMapper
 {
 AWS_MEDIALIVE_API BlackoutSlateState GetBlackoutSlateStateForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForBlackoutSlateState(BlackoutSlateState value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForBlackoutSlateState(BlackoutSlateState value);
 } // namespace BlackoutSlateStateMapper
 } // namespace Model
 } // namespace MediaLive
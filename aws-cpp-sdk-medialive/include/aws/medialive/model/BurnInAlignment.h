@@ -35,7 +35,8 @@ namespace BurnInAlignmentMapper
 {
 AWS_MEDIALIVE_API BurnInAlignment GetBurnInAlignmentForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForBurnInAlignment(BurnInAlignment value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForBurnInAlignment(BurnInAlignment value);
 } // namespace BurnInAlignmentMapper
 } // namespace Model
 } // namespace MediaLive
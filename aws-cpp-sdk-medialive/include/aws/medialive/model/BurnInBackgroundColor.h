@@ -35,7 +35,8 @@ namespace BurnInBackgroundColorMapper
 {
 AWS_MEDIALIVE_API BurnInBackgroundColor GetBurnInBackgroundColorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForBurnInBackgroundColor(BurnInBackgroundColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForBurnInBackgroundColor(BurnInBackgroundColor value);
 } // namespace BurnInBackgroundColorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -38,7 +38,8 @@ namespace BurnInFontColorMapper
 {
 AWS_MEDIALIVE_API BurnInFontColor GetBurnInFontColorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForBurnInFontColor(BurnInFontColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForBurnInFontColor(BurnInFontColor value);
 } // namespace BurnInFontColorMapper
 } // namespace Model
 } // namespace MediaLive
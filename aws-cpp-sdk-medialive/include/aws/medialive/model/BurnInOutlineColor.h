@@ -38,7 +38,8 @@ namespace BurnInOutlineColorMapper
 {
 AWS_MEDIALIVE_API BurnInOutlineColor GetBurnInOutlineColorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForBurnInOutlineColor(BurnInOutlineColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForBurnInOutlineColor(BurnInOutlineColor value);
 } // namespace BurnInOutlineColorMapper
 } // namespace Model
 } // namespace MediaLive
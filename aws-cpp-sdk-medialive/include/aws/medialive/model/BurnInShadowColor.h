@@ -35,7 +35,8 @@ namespace BurnInShadowColorMapper
 {
 AWS_MEDIALIVE_API BurnInShadowColor GetBurnInShadowColorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForBurnInShadowColor(BurnInShadowColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForBurnInShadowColor(BurnInShadowColor value);
 } // namespace BurnInShadowColorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace BurnInTeletextGridControlMapper
 {
 AWS_MEDIALIVE_API BurnInTeletextGridControl GetBurnInTeletextGridControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForBurnInTeletextGridControl(BurnInTeletextGridControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForBurnInTeletextGridControl(BurnInTeletextGridControl value);
 } // namespace BurnInTeletextGridControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -41,7 +41,8 @@ namespace ChannelStateMapper
 {
 AWS_MEDIALIVE_API ChannelState GetChannelStateForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForChannelState(ChannelState value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForChannelState(ChannelState value);
 } // namespace ChannelStateMapper
 } // namespace Model
 } // namespace MediaLive
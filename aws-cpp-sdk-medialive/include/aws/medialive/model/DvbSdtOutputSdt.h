@@ -36,7 +36,8 @@ namespace DvbSdtOutputSdtMapper
 {
 AWS_MEDIALIVE_API DvbSdtOutputSdt GetDvbSdtOutputSdtForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForDvbSdtOutputSdt(DvbSdtOutputSdt value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForDvbSdtOutputSdt(DvbSdtOutputSdt value);
 } // namespace DvbSdtOutputSdtMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace DvbSubDestinationAlignmentMapper
 {
 AWS_MEDIALIVE_API DvbSubDestinationAlignment GetDvbSubDestinationAlignmentForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationAlignment(DvbSubDestinationAlignment value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationAlignment(DvbSubDestinationAlignment value);
 } // namespace DvbSubDestinationAlignmentMapper
 } // namespace Model
 } // namespace MediaLive
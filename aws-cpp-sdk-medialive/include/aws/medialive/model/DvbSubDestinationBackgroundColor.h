@@ -35,7 +35,8 @@ namespace DvbSubDestinationBackgroundColorMapper
 {
 AWS_MEDIALIVE_API DvbSubDestinationBackgroundColor GetDvbSubDestinationBackgroundColorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationBackgroundColor(DvbSubDestinationBackgroundColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationBackgroundColor(DvbSubDestinationBackgroundColor value);
 } // namespace DvbSubDestinationBackgroundColorMapper
 } // namespace Model
 } // namespace MediaLive
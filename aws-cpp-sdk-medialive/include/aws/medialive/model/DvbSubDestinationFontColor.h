@@ -38,7 +38,8 @@ namespace DvbSubDestinationFontColorMapper
 {
 AWS_MEDIALIVE_API DvbSubDestinationFontColor GetDvbSubDestinationFontColorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationFontColor(DvbSubDestinationFontColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationFontColor(DvbSubDestinationFontColor value);
 } // namespace DvbSubDestinationFontColorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -38,7 +38,8 @@ namespace DvbSubDestinationOutlineColorMapper
 {
 AWS_MEDIALIVE_API DvbSubDestinationOutlineColor GetDvbSubDestinationOutlineColorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationOutlineColor(DvbSubDestinationOutlineColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationOutlineColor(DvbSubDestinationOutlineColor value);
 } // namespace DvbSubDestinationOutlineColorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace DvbSubDestinationShadowColorMapper
 {
 AWS_MEDIALIVE_API DvbSubDestinationShadowColor GetDvbSubDestinationShadowColorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationShadowColor(DvbSubDestinationShadowColor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationShadowColor(DvbSubDestinationShadowColor value);
 } // namespace DvbSubDestinationShadowColorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace DvbSubDestinationTeletextGridControlMapper
 {
 AWS_MEDIALIVE_API DvbSubDestinationTeletextGridControl GetDvbSubDestinationTeletextGridControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForDvbSubDestinationTeletextGridControl(DvbSubDestinationTeletextGridControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForDvbSubDestinationTeletextGridControl(DvbSubDestinationTeletextGridControl value);
 } // namespace DvbSubDestinationTeletextGridControlMapper
 } // namespace Model
 } // namespace MediaLive
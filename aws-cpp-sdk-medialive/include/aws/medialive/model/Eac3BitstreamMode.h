@@ -37,7 +37,8 @@ namespace Eac3BitstreamModeMapper
 {
 AWS_MEDIALIVE_API Eac3BitstreamMode GetEac3BitstreamModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3BitstreamMode(Eac3BitstreamMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3BitstreamMode(Eac3BitstreamMode value);
 } // namespace Eac3BitstreamModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace Eac3CodingModeMapper
 {
 AWS_MEDIALIVE_API Eac3CodingMode GetEac3CodingModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3CodingMode(Eac3CodingMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3CodingMode(Eac3CodingMode value);
 } // namespace Eac3CodingModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -38,7 +38,8 @@ namespace Eac3DrcLineMapper
 {
 AWS_MEDIALIVE_API Eac3DrcLine GetEac3DrcLineForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3DrcLine(Eac3DrcLine value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3DrcLine(Eac3DrcLine value);
 } // namespace Eac3DrcLineMapper
 } // namespace Model
 } // namespace MediaLive
@@ -38,7 +38,8 @@ namespace Eac3DrcRfMapper
 {
 AWS_MEDIALIVE_API Eac3DrcRf GetEac3DrcRfForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3DrcRf(Eac3DrcRf value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3DrcRf(Eac3DrcRf value);
 } // namespace Eac3DrcRfMapper
 } // namespace Model
 } // namespace MediaLive
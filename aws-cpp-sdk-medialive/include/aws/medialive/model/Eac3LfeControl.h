@@ -34,7 +34,8 @@ namespace Eac3LfeControlMapper
 {
 AWS_MEDIALIVE_API Eac3LfeControl GetEac3LfeControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3LfeControl(Eac3LfeControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3LfeControl(Eac3LfeControl value);
 } // namespace Eac3LfeControlMapper
 } // namespace Model
 } // namespace MediaLive
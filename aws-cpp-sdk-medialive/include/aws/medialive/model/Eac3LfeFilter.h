@@ -34,7 +34,8 @@ namespace Eac3LfeFilterMapper
 {
 AWS_MEDIALIVE_API Eac3LfeFilter GetEac3LfeFilterForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3LfeFilter(Eac3LfeFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3LfeFilter(Eac3LfeFilter value);
 } // namespace Eac3LfeFilterMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace Eac3MetadataControlMapper
 {
 AWS_MEDIALIVE_API Eac3MetadataControl GetEac3MetadataControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3MetadataControl(Eac3MetadataControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3MetadataControl(Eac3MetadataControl value);
 } // namespace Eac3MetadataControlMapper
 } // namespace Model
 } // namespace MediaLive
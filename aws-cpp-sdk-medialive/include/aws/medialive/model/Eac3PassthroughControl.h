@@ -34,7 +34,8 @@ namespace Eac3PassthroughControlMapper
 {
 AWS_MEDIALIVE_API Eac3PassthroughControl GetEac3PassthroughControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3PassthroughControl(Eac3PassthroughControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3PassthroughControl(Eac3PassthroughControl value);
 } // namespace Eac3PassthroughControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace Eac3PhaseControlMapper
 {
 AWS_MEDIALIVE_API Eac3PhaseControl GetEac3PhaseControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3PhaseControl(Eac3PhaseControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3PhaseControl(Eac3PhaseControl value);
 } // namespace Eac3PhaseControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,7 +36,8 @@ namespace Eac3StereoDownmixMapper
 {
 AWS_MEDIALIVE_API Eac3StereoDownmix GetEac3StereoDownmixForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3StereoDownmix(Eac3StereoDownmix value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3StereoDownmix(Eac3StereoDownmix value);
 } // namespace Eac3StereoDownmixMapper
 } // namespace Model
 } // namespace MediaLive
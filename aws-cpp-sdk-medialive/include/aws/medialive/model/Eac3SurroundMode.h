@@ -35,7 +35,8 @@ namespace Eac3SurroundModeMapper
 {
 AWS_MEDIALIVE_API Eac3SurroundMode GetEac3SurroundModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEac3SurroundMode(Eac3SurroundMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEac3SurroundMode(Eac3SurroundMode value);
 } // namespace Eac3SurroundModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace EmbeddedConvert608To708Mapper
 {
 AWS_MEDIALIVE_API EmbeddedConvert608To708 GetEmbeddedConvert608To708ForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEmbeddedConvert608To708(EmbeddedConvert608To708 value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEmbeddedConvert608To708(EmbeddedConvert608To708 value);
 } // namespace EmbeddedConvert608To708Mapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace EmbeddedScte20DetectionMapper
 {
 AWS_MEDIALIVE_API EmbeddedScte20Detection GetEmbeddedScte20DetectionForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForEmbeddedScte20Detection(EmbeddedScte20Detection value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForEmbeddedScte20Detection(EmbeddedScte20Detection value);
 } // namespace EmbeddedScte20DetectionMapper
 } // namespace Model
 } // namespace MediaLive
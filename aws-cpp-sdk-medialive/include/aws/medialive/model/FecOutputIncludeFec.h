@@ -34,7 +34,8 @@ namespace FecOutputIncludeFecMapper
 {
 AWS_MEDIALIVE_API FecOutputIncludeFec GetFecOutputIncludeFecForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForFecOutputIncludeFec(FecOutputIncludeFec value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForFecOutputIncludeFec(FecOutputIncludeFec value);
 } // namespace FecOutputIncludeFecMapper
 } // namespace Model
 } // namespace MediaLive
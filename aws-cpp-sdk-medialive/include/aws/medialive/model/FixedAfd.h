@@ -43,7 +43,8 @@ namespace FixedAfdMapper
 {
 AWS_MEDIALIVE_API FixedAfd GetFixedAfdForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForFixedAfd(FixedAfd value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForFixedAfd(FixedAfd value);
 } // namespace FixedAfdMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace GlobalConfigurationInputEndActionMapper
 {
 AWS_MEDIALIVE_API GlobalConfigurationInputEndAction GetGlobalConfigurationInputEndActionForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForGlobalConfigurationInputEndAction(GlobalConfigurationInputEndAction value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForGlobalConfigurationInputEndAction(GlobalConfigurationInputEndAction value);
 } // namespace GlobalConfigurationInputEndActionMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace GlobalConfigurationLowFramerateInputsMapper
 {
 AWS_MEDIALIVE_API GlobalConfigurationLowFramerateInputs GetGlobalConfigurationLowFramerateInputsForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForGlobalConfigurationLowFramerateInputs(GlobalConfigurationLowFramerateInputs value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForGlobalConfigurationLowFramerateInputs(GlobalConfigurationLowFramerateInputs value);
 } // namespace GlobalConfigurationLowFramerateInputsMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace GlobalConfigurationOutputTimingSourceMapper
 {
 AWS_MEDIALIVE_API GlobalConfigurationOutputTimingSource GetGlobalConfigurationOutputTimingSourceForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForGlobalConfigurationOutputTimingSource(GlobalConfigurationOutputTimingSource value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForGlobalConfigurationOutputTimingSource(GlobalConfigurationOutputTimingSource value);
 } // namespace GlobalConfigurationOutputTimingSourceMapper
 } // namespace Model
 } // namespace MediaLive
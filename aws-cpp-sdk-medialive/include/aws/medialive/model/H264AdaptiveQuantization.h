@@ -38,7 +38,8 @@ namespace H264AdaptiveQuantizationMapper
 {
 AWS_MEDIALIVE_API H264AdaptiveQuantization GetH264AdaptiveQuantizationForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264AdaptiveQuantization(H264AdaptiveQuantization value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264AdaptiveQuantization(H264AdaptiveQuantization value);
 } // namespace H264AdaptiveQuantizationMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace H264ColorMetadataMapper
 {
 AWS_MEDIALIVE_API H264ColorMetadata GetH264ColorMetadataForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264ColorMetadata(H264ColorMetadata value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264ColorMetadata(H264ColorMetadata value);
 } // namespace H264ColorMetadataMapper
 } // namespace Model
 } // namespace MediaLive
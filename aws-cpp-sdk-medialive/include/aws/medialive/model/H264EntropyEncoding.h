@@ -34,7 +34,8 @@ namespace H264EntropyEncodingMapper
 {
 AWS_MEDIALIVE_API H264EntropyEncoding GetH264EntropyEncodingForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264EntropyEncoding(H264EntropyEncoding value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264EntropyEncoding(H264EntropyEncoding value);
 } // namespace H264EntropyEncodingMapper
 } // namespace Model
 } // namespace MediaLive
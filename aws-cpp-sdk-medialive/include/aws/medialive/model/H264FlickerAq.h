@@ -34,7 +34,8 @@ namespace H264FlickerAqMapper
 {
 AWS_MEDIALIVE_API H264FlickerAq GetH264FlickerAqForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264FlickerAq(H264FlickerAq value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264FlickerAq(H264FlickerAq value);
 } // namespace H264FlickerAqMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace H264FramerateControlMapper
 {
 AWS_MEDIALIVE_API H264FramerateControl GetH264FramerateControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264FramerateControl(H264FramerateControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264FramerateControl(H264FramerateControl value);
 } // namespace H264FramerateControlMapper
 } // namespace Model
 } // namespace MediaLive
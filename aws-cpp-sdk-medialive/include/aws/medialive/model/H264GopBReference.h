@@ -34,7 +34,8 @@ namespace H264GopBReferenceMapper
 {
 AWS_MEDIALIVE_API H264GopBReference GetH264GopBReferenceForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264GopBReference(H264GopBReference value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264GopBReference(H264GopBReference value);
 } // namespace H264GopBReferenceMapper
 } // namespace Model
 } // namespace MediaLive
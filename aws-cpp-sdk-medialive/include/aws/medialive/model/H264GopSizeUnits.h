@@ -34,7 +34,8 @@ namespace H264GopSizeUnitsMapper
 {
 AWS_MEDIALIVE_API H264GopSizeUnits GetH264GopSizeUnitsForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264GopSizeUnits(H264GopSizeUnits value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264GopSizeUnits(H264GopSizeUnits value);
 } // namespace H264GopSizeUnitsMapper
 } // namespace Model
 } // namespace MediaLive
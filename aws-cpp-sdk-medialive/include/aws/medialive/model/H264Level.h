@@ -49,7 +49,8 @@ namespace H264LevelMapper
 {
 AWS_MEDIALIVE_API H264Level GetH264LevelForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264Level(H264Level value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264Level(H264Level value);
 } // namespace H264LevelMapper
 } // namespace Model
 } // namespace MediaLive
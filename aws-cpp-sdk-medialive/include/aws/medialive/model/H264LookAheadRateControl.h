@@ -35,7 +35,8 @@ namespace H264LookAheadRateControlMapper
 {
 AWS_MEDIALIVE_API H264LookAheadRateControl GetH264LookAheadRateControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264LookAheadRateControl(H264LookAheadRateControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264LookAheadRateControl(H264LookAheadRateControl value);
 } // namespace H264LookAheadRateControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -38,7 +38,8 @@ namespace H264ProfileMapper
 {
 AWS_MEDIALIVE_API H264Profile GetH264ProfileForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264Profile(H264Profile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264Profile(H264Profile value);
 } // namespace H264ProfileMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace H264RateControlModeMapper
 {
 AWS_MEDIALIVE_API H264RateControlMode GetH264RateControlModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264RateControlMode(H264RateControlMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264RateControlMode(H264RateControlMode value);
 } // namespace H264RateControlModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace H264ScanTypeMapper
 {
 AWS_MEDIALIVE_API H264ScanType GetH264ScanTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264ScanType(H264ScanType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264ScanType(H264ScanType value);
 } // namespace H264ScanTypeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace H264SpatialAqMapper
 {
 AWS_MEDIALIVE_API H264SpatialAq GetH264SpatialAqForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264SpatialAq(H264SpatialAq value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264SpatialAq(H264SpatialAq value);
 } // namespace H264SpatialAqMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace H264SyntaxMapper
 {
 AWS_MEDIALIVE_API H264Syntax GetH264SyntaxForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264Syntax(H264Syntax value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264Syntax(H264Syntax value);
 } // namespace H264SyntaxMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace H264TemporalAqMapper
 {
 AWS_MEDIALIVE_API H264TemporalAq GetH264TemporalAqForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264TemporalAq(H264TemporalAq value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264TemporalAq(H264TemporalAq value);
 } // namespace H264TemporalAqMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace H264TimecodeInsertionBehaviorMapper
 {
 AWS_MEDIALIVE_API H264TimecodeInsertionBehavior GetH264TimecodeInsertionBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForH264TimecodeInsertionBehavior(H264TimecodeInsertionBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForH264TimecodeInsertionBehavior(H264TimecodeInsertionBehavior value);
 } // namespace H264TimecodeInsertionBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
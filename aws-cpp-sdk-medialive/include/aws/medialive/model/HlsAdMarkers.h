@@ -35,7 +35,8 @@ namespace HlsAdMarkersMapper
 {
 AWS_MEDIALIVE_API HlsAdMarkers GetHlsAdMarkersForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsAdMarkers(HlsAdMarkers value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsAdMarkers(HlsAdMarkers value);
 } // namespace HlsAdMarkersMapper
 } // namespace Model
 } // namespace MediaLive
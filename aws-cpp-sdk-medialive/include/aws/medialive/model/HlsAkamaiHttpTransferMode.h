@@ -34,7 +34,8 @@ namespace HlsAkamaiHttpTransferModeMapper
 {
 AWS_MEDIALIVE_API HlsAkamaiHttpTransferMode GetHlsAkamaiHttpTransferModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsAkamaiHttpTransferMode(HlsAkamaiHttpTransferMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsAkamaiHttpTransferMode(HlsAkamaiHttpTransferMode value);
 } // namespace HlsAkamaiHttpTransferModeMapper
 } // namespace Model
 } // namespace MediaLive
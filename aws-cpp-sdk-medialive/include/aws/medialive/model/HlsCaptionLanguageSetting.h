@@ -35,7 +35,8 @@ namespace HlsCaptionLanguageSettingMapper
 {
 AWS_MEDIALIVE_API HlsCaptionLanguageSetting GetHlsCaptionLanguageSettingForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsCaptionLanguageSetting(HlsCaptionLanguageSetting value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsCaptionLanguageSetting(HlsCaptionLanguageSetting value);
 } // namespace HlsCaptionLanguageSettingMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace HlsDirectoryStructureMapper
 {
 AWS_MEDIALIVE_API HlsDirectoryStructure GetHlsDirectoryStructureForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsDirectoryStructure(HlsDirectoryStructure value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsDirectoryStructure(HlsDirectoryStructure value);
 } // namespace HlsDirectoryStructureMapper
 } // namespace Model
 } // namespace MediaLive
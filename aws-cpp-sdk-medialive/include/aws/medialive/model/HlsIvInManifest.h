@@ -34,7 +34,8 @@ namespace HlsIvInManifestMapper
 {
 AWS_MEDIALIVE_API HlsIvInManifest GetHlsIvInManifestForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsIvInManifest(HlsIvInManifest value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsIvInManifest(HlsIvInManifest value);
 } // namespace HlsIvInManifestMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace HlsIvSourceMapper
 {
 AWS_MEDIALIVE_API HlsIvSource GetHlsIvSourceForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsIvSource(HlsIvSource value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsIvSource(HlsIvSource value);
 } // namespace HlsIvSourceMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace HlsManifestCompressionMapper
 {
 AWS_MEDIALIVE_API HlsManifestCompression GetHlsManifestCompressionForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsManifestCompression(HlsManifestCompression value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsManifestCompression(HlsManifestCompression value);
 } // namespace HlsManifestCompressionMapper
 } // namespace Model
 } // namespace MediaLive
@@ -33,7 +33,8 @@ namespace HlsMediaStoreStorageClassMapper
 {
 AWS_MEDIALIVE_API HlsMediaStoreStorageClass GetHlsMediaStoreStorageClassForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsMediaStoreStorageClass(HlsMediaStoreStorageClass value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsMediaStoreStorageClass(HlsMediaStoreStorageClass value);
 } // namespace HlsMediaStoreStorageClassMapper
 } // namespace Model
 } // namespace MediaLive
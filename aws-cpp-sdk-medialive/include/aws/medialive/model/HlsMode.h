@@ -34,7 +34,8 @@ namespace HlsModeMapper
 {
 AWS_MEDIALIVE_API HlsMode GetHlsModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsMode(HlsMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsMode(HlsMode value);
 } // namespace HlsModeMapper
 } // namespace Model
 } // namespace MediaLive
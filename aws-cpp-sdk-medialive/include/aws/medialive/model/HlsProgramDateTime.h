@@ -34,7 +34,8 @@ namespace HlsProgramDateTimeMapper
 {
 AWS_MEDIALIVE_API HlsProgramDateTime GetHlsProgramDateTimeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsProgramDateTime(HlsProgramDateTime value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsProgramDateTime(HlsProgramDateTime value);
 } // namespace HlsProgramDateTimeMapper
 } // namespace Model
 } // namespace MediaLive
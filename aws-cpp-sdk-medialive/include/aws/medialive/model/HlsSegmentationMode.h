@@ -34,7 +34,8 @@ namespace HlsSegmentationModeMapper
 {
 AWS_MEDIALIVE_API HlsSegmentationMode GetHlsSegmentationModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsSegmentationMode(HlsSegmentationMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsSegmentationMode(HlsSegmentationMode value);
 } // namespace HlsSegmentationModeMapper
 } // namespace Model
 } // namespace MediaLive
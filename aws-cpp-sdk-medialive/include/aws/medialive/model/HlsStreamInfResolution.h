@@ -34,7 +34,8 @@ namespace HlsStreamInfResolutionMapper
 {
 AWS_MEDIALIVE_API HlsStreamInfResolution GetHlsStreamInfResolutionForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsStreamInfResolution(HlsStreamInfResolution value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsStreamInfResolution(HlsStreamInfResolution value);
 } // namespace HlsStreamInfResolutionMapper
 } // namespace Model
 } // namespace MediaLive
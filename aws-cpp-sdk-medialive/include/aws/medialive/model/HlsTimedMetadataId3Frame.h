@@ -35,7 +35,8 @@ namespace HlsTimedMetadataId3FrameMapper
 {
 AWS_MEDIALIVE_API HlsTimedMetadataId3Frame GetHlsTimedMetadataId3FrameForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsTimedMetadataId3Frame(HlsTimedMetadataId3Frame value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsTimedMetadataId3Frame(HlsTimedMetadataId3Frame value);
 } // namespace HlsTimedMetadataId3FrameMapper
 } // namespace Model
 } // namespace MediaLive
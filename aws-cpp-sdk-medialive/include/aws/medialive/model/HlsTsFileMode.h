@@ -34,7 +34,8 @@ namespace HlsTsFileModeMapper
 {
 AWS_MEDIALIVE_API HlsTsFileMode GetHlsTsFileModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsTsFileMode(HlsTsFileMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsTsFileMode(HlsTsFileMode value);
 } // namespace HlsTsFileModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace HlsWebdavHttpTransferModeMapper
 {
 AWS_MEDIALIVE_API HlsWebdavHttpTransferMode GetHlsWebdavHttpTransferModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForHlsWebdavHttpTransferMode(HlsWebdavHttpTransferMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForHlsWebdavHttpTransferMode(HlsWebdavHttpTransferMode value);
 } // namespace HlsWebdavHttpTransferModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace InputCodecMapper
 {
 AWS_MEDIALIVE_API InputCodec GetInputCodecForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputCodec(InputCodec value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputCodec(InputCodec value);
 } // namespace InputCodecMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace InputDeblockFilterMapper
 {
 AWS_MEDIALIVE_API InputDeblockFilter GetInputDeblockFilterForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputDeblockFilter(InputDeblockFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputDeblockFilter(InputDeblockFilter value);
 } // namespace InputDeblockFilterMapper
 } // namespace Model
 } // namespace MediaLive
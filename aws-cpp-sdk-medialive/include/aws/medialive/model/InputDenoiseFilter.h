@@ -34,7 +34,8 @@ namespace InputDenoiseFilterMapper
 {
 AWS_MEDIALIVE_API InputDenoiseFilter GetInputDenoiseFilterForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputDenoiseFilter(InputDenoiseFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputDenoiseFilter(InputDenoiseFilter value);
 } // namespace InputDenoiseFilterMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace InputFilterMapper
 {
 AWS_MEDIALIVE_API InputFilter GetInputFilterForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputFilter(InputFilter value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputFilter(InputFilter value);
 } // namespace InputFilterMapper
 } // namespace Model
 } // namespace MediaLive
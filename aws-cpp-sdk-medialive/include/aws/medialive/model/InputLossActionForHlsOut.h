@@ -34,7 +34,8 @@ namespace InputLossActionForHlsOutMapper
 {
 AWS_MEDIALIVE_API InputLossActionForHlsOut GetInputLossActionForHlsOutForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputLossActionForHlsOut(InputLossActionForHlsOut value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputLossActionForHlsOut(InputLossActionForHlsOut value);
 } // namespace InputLossActionForHlsOutMapper
 } // namespace Model
 } // namespace MediaLive
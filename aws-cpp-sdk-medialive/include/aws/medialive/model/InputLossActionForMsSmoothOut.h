@@ -34,7 +34,8 @@ namespace InputLossActionForMsSmoothOutMapper
 {
 AWS_MEDIALIVE_API InputLossActionForMsSmoothOut GetInputLossActionForMsSmoothOutForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputLossActionForMsSmoothOut(InputLossActionForMsSmoothOut value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputLossActionForMsSmoothOut(InputLossActionForMsSmoothOut value);
 } // namespace InputLossActionForMsSmoothOutMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace InputLossActionForUdpOutMapper
 {
 AWS_MEDIALIVE_API InputLossActionForUdpOut GetInputLossActionForUdpOutForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputLossActionForUdpOut(InputLossActionForUdpOut value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputLossActionForUdpOut(InputLossActionForUdpOut value);
 } // namespace InputLossActionForUdpOutMapper
 } // namespace Model
 } // namespace MediaLive
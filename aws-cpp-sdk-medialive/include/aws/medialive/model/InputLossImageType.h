@@ -34,7 +34,8 @@ namespace InputLossImageTypeMapper
 {
 AWS_MEDIALIVE_API InputLossImageType GetInputLossImageTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputLossImageType(InputLossImageType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputLossImageType(InputLossImageType value);
 } // namespace InputLossImageTypeMapper
 } // namespace Model
 } // namespace MediaLive
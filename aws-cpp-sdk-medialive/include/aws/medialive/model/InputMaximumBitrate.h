@@ -35,7 +35,8 @@ namespace InputMaximumBitrateMapper
 {
 AWS_MEDIALIVE_API InputMaximumBitrate GetInputMaximumBitrateForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputMaximumBitrate(InputMaximumBitrate value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputMaximumBitrate(InputMaximumBitrate value);
 } // namespace InputMaximumBitrateMapper
 } // namespace Model
 } // namespace MediaLive
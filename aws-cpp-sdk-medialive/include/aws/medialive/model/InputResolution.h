@@ -35,7 +35,8 @@ namespace InputResolutionMapper
 {
 AWS_MEDIALIVE_API InputResolution GetInputResolutionForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputResolution(InputResolution value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputResolution(InputResolution value);
 } // namespace InputResolutionMapper
 } // namespace Model
 } // namespace MediaLive
@@ -36,7 +36,8 @@ namespace InputSecurityGroupStateMapper
 {
 AWS_MEDIALIVE_API InputSecurityGroupState GetInputSecurityGroupStateForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputSecurityGroupState(InputSecurityGroupState value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputSecurityGroupState(InputSecurityGroupState value);
 } // namespace InputSecurityGroupStateMapper
 } // namespace Model
 } // namespace MediaLive
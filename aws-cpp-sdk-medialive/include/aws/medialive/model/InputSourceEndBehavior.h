@@ -34,7 +34,8 @@ namespace InputSourceEndBehaviorMapper
 {
 AWS_MEDIALIVE_API InputSourceEndBehavior GetInputSourceEndBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputSourceEndBehavior(InputSourceEndBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputSourceEndBehavior(InputSourceEndBehavior value);
 } // namespace InputSourceEndBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
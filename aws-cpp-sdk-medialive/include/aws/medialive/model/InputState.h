@@ -37,7 +37,8 @@ namespace InputStateMapper
 {
 AWS_MEDIALIVE_API InputState GetInputStateForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputState(InputState value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputState(InputState value);
 } // namespace InputStateMapper
 } // namespace Model
 } // namespace MediaLive
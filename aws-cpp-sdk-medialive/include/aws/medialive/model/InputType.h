@@ -37,7 +37,8 @@ namespace InputTypeMapper
 {
 AWS_MEDIALIVE_API InputType GetInputTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForInputType(InputType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForInputType(InputType value);
 } // namespace InputTypeMapper
 } // namespace Model
 } // namespace MediaLive
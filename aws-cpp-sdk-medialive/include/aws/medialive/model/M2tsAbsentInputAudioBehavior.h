@@ -34,7 +34,8 @@ namespace M2tsAbsentInputAudioBehaviorMapper
 {
 AWS_MEDIALIVE_API M2tsAbsentInputAudioBehavior GetM2tsAbsentInputAudioBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsAbsentInputAudioBehavior(M2tsAbsentInputAudioBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsAbsentInputAudioBehavior(M2tsAbsentInputAudioBehavior value);
 } // namespace M2tsAbsentInputAudioBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace M2tsAribMapper
 {
 AWS_MEDIALIVE_API M2tsArib GetM2tsAribForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsArib(M2tsArib value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsArib(M2tsArib value);
 } // namespace M2tsAribMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace M2tsAribCaptionsPidControlMapper
 {
 AWS_MEDIALIVE_API M2tsAribCaptionsPidControl GetM2tsAribCaptionsPidControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsAribCaptionsPidControl(M2tsAribCaptionsPidControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsAribCaptionsPidControl(M2tsAribCaptionsPidControl value);
 } // namespace M2tsAribCaptionsPidControlMapper
 } // namespace Model
 } // namespace MediaLive
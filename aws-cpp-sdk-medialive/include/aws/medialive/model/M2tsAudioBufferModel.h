@@ -34,7 +34,8 @@ namespace M2tsAudioBufferModelMapper
 {
 AWS_MEDIALIVE_API M2tsAudioBufferModel GetM2tsAudioBufferModelForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsAudioBufferModel(M2tsAudioBufferModel value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsAudioBufferModel(M2tsAudioBufferModel value);
 } // namespace M2tsAudioBufferModelMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace M2tsAudioIntervalMapper
 {
 AWS_MEDIALIVE_API M2tsAudioInterval GetM2tsAudioIntervalForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsAudioInterval(M2tsAudioInterval value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsAudioInterval(M2tsAudioInterval value);
 } // namespace M2tsAudioIntervalMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace M2tsAudioStreamTypeMapper
 {
 AWS_MEDIALIVE_API M2tsAudioStreamType GetM2tsAudioStreamTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsAudioStreamType(M2tsAudioStreamType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsAudioStreamType(M2tsAudioStreamType value);
 } // namespace M2tsAudioStreamTypeMapper
 } // namespace Model
 } // namespace MediaLive
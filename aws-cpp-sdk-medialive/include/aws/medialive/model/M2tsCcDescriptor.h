@@ -34,7 +34,8 @@ namespace M2tsCcDescriptorMapper
 {
 AWS_MEDIALIVE_API M2tsCcDescriptor GetM2tsCcDescriptorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsCcDescriptor(M2tsCcDescriptor value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsCcDescriptor(M2tsCcDescriptor value);
 } // namespace M2tsCcDescriptorMapper
 } // namespace Model
 } // namespace MediaLive
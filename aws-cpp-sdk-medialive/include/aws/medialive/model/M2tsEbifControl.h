@@ -34,7 +34,8 @@ namespace M2tsEbifControlMapper
 {
 AWS_MEDIALIVE_API M2tsEbifControl GetM2tsEbifControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsEbifControl(M2tsEbifControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsEbifControl(M2tsEbifControl value);
 } // namespace M2tsEbifControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace M2tsEbpPlacementMapper
 {
 AWS_MEDIALIVE_API M2tsEbpPlacement GetM2tsEbpPlacementForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsEbpPlacement(M2tsEbpPlacement value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsEbpPlacement(M2tsEbpPlacement value);
 } // namespace M2tsEbpPlacementMapper
 } // namespace Model
 } // namespace MediaLive
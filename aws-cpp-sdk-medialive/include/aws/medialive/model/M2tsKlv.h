@@ -34,7 +34,8 @@ namespace M2tsKlvMapper
 {
 AWS_MEDIALIVE_API M2tsKlv GetM2tsKlvForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsKlv(M2tsKlv value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsKlv(M2tsKlv value);
 } // namespace M2tsKlvMapper
 } // namespace Model
 } // namespace MediaLive
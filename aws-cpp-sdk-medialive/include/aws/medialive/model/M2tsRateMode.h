@@ -34,7 +34,8 @@ namespace M2tsRateModeMapper
 {
 AWS_MEDIALIVE_API M2tsRateMode GetM2tsRateModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsRateMode(M2tsRateMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsRateMode(M2tsRateMode value);
 } // namespace M2tsRateModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace M2tsScte35ControlMapper
 {
 AWS_MEDIALIVE_API M2tsScte35Control GetM2tsScte35ControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsScte35Control(M2tsScte35Control value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsScte35Control(M2tsScte35Control value);
 } // namespace M2tsScte35ControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -38,7 +38,8 @@ namespace M2tsSegmentationMarkersMapper
 {
 AWS_MEDIALIVE_API M2tsSegmentationMarkers GetM2tsSegmentationMarkersForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsSegmentationMarkers(M2tsSegmentationMarkers value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsSegmentationMarkers(M2tsSegmentationMarkers value);
 } // namespace M2tsSegmentationMarkersMapper
 } // namespace Model
 } // namespace MediaLive
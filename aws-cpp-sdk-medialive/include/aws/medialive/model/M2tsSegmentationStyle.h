@@ -34,7 +34,8 @@ namespace M2tsSegmentationStyleMapper
 {
 AWS_MEDIALIVE_API M2tsSegmentationStyle GetM2tsSegmentationStyleForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsSegmentationStyle(M2tsSegmentationStyle value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsSegmentationStyle(M2tsSegmentationStyle value);
 } // namespace M2tsSegmentationStyleMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace M2tsTimedMetadataBehaviorMapper
 {
 AWS_MEDIALIVE_API M2tsTimedMetadataBehavior GetM2tsTimedMetadataBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM2tsTimedMetadataBehavior(M2tsTimedMetadataBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM2tsTimedMetadataBehavior(M2tsTimedMetadataBehavior value);
 } // namespace M2tsTimedMetadataBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace M3u8PcrControlMapper
 {
 AWS_MEDIALIVE_API M3u8PcrControl GetM3u8PcrControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM3u8PcrControl(M3u8PcrControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM3u8PcrControl(M3u8PcrControl value);
 } // namespace M3u8PcrControlMapper
 } // namespace Model
 } // namespace MediaLive
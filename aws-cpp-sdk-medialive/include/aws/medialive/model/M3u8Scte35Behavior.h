@@ -34,7 +34,8 @@ namespace M3u8Scte35BehaviorMapper
 {
 AWS_MEDIALIVE_API M3u8Scte35Behavior GetM3u8Scte35BehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM3u8Scte35Behavior(M3u8Scte35Behavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM3u8Scte35Behavior(M3u8Scte35Behavior value);
 } // namespace M3u8Scte35BehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace M3u8TimedMetadataBehaviorMapper
 {
 AWS_MEDIALIVE_API M3u8TimedMetadataBehavior GetM3u8TimedMetadataBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForM3u8TimedMetadataBehavior(M3u8TimedMetadataBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForM3u8TimedMetadataBehavior(M3u8TimedMetadataBehavior value);
 } // namespace M3u8TimedMetadataBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace Mp2CodingModeMapper
 {
 AWS_MEDIALIVE_API Mp2CodingMode GetMp2CodingModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForMp2CodingMode(Mp2CodingMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForMp2CodingMode(Mp2CodingMode value);
 } // namespace Mp2CodingModeMapper
 } // namespace Model
 } // namespace MediaLive
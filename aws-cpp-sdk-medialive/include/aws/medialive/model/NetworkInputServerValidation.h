@@ -34,7 +34,8 @@ namespace NetworkInputServerValidationMapper
 {
 AWS_MEDIALIVE_API NetworkInputServerValidation GetNetworkInputServerValidationForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForNetworkInputServerValidation(NetworkInputServerValidation value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForNetworkInputServerValidation(NetworkInputServerValidation value);
 } // namespace NetworkInputServerValidationMapper
 } // namespace Model
 } // namespace MediaLive
@@ -33,7 +33,8 @@ namespace OfferingDurationUnitsMapper
 {
 AWS_MEDIALIVE_API OfferingDurationUnits GetOfferingDurationUnitsForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForOfferingDurationUnits(OfferingDurationUnits value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForOfferingDurationUnits(OfferingDurationUnits value);
 } // namespace OfferingDurationUnitsMapper
 } // namespace Model
 } // namespace MediaLive
@@ -33,7 +33,8 @@ namespace OfferingTypeMapper
 {
 AWS_MEDIALIVE_API OfferingType GetOfferingTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForOfferingType(OfferingType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForOfferingType(OfferingType value);
 } // namespace OfferingTypeMapper
 } // namespace Model
 } // namespace MediaLive
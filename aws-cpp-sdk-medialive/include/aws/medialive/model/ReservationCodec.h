@@ -36,7 +36,8 @@ namespace ReservationCodecMapper
 {
 AWS_MEDIALIVE_API ReservationCodec GetReservationCodecForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForReservationCodec(ReservationCodec value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForReservationCodec(ReservationCodec value);
 } // namespace ReservationCodecMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace ReservationMaximumBitrateMapper
 {
 AWS_MEDIALIVE_API ReservationMaximumBitrate GetReservationMaximumBitrateForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForReservationMaximumBitrate(ReservationMaximumBitrate value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForReservationMaximumBitrate(ReservationMaximumBitrate value);
 } // namespace ReservationMaximumBitrateMapper
 } // namespace Model
 } // namespace MediaLive
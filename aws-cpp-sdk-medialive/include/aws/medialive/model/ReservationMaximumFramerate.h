@@ -34,7 +34,8 @@ namespace ReservationMaximumFramerateMapper
 {
 AWS_MEDIALIVE_API ReservationMaximumFramerate GetReservationMaximumFramerateForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForReservationMaximumFramerate(ReservationMaximumFramerate value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForReservationMaximumFramerate(ReservationMaximumFramerate value);
 } // namespace ReservationMaximumFramerateMapper
 } // namespace Model
 } // namespace MediaLive
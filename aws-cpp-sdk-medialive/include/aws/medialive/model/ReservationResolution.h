@@ -35,7 +35,8 @@ namespace ReservationResolutionMapper
 {
 AWS_MEDIALIVE_API ReservationResolution GetReservationResolutionForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForReservationResolution(ReservationResolution value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForReservationResolution(ReservationResolution value);
 } // namespace ReservationResolutionMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace ReservationResourceTypeMapper
 {
 AWS_MEDIALIVE_API ReservationResourceType GetReservationResourceTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForReservationResourceType(ReservationResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForReservationResourceType(ReservationResourceType value);
 } // namespace ReservationResourceTypeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace ReservationSpecialFeatureMapper
 {
 AWS_MEDIALIVE_API ReservationSpecialFeature GetReservationSpecialFeatureForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForReservationSpecialFeature(ReservationSpecialFeature value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForReservationSpecialFeature(ReservationSpecialFeature value);
 } // namespace ReservationSpecialFeatureMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace ReservationVideoQualityMapper
 {
 AWS_MEDIALIVE_API ReservationVideoQuality GetReservationVideoQualityForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForReservationVideoQuality(ReservationVideoQuality value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForReservationVideoQuality(ReservationVideoQuality value);
 } // namespace ReservationVideoQualityMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace RtmpCacheFullBehaviorMapper
 {
 AWS_MEDIALIVE_API RtmpCacheFullBehavior GetRtmpCacheFullBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForRtmpCacheFullBehavior(RtmpCacheFullBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForRtmpCacheFullBehavior(RtmpCacheFullBehavior value);
 } // namespace RtmpCacheFullBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
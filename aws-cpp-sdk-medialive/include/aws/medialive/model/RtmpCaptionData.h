@@ -35,7 +35,8 @@ namespace RtmpCaptionDataMapper
 {
 AWS_MEDIALIVE_API RtmpCaptionData GetRtmpCaptionDataForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForRtmpCaptionData(RtmpCaptionData value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForRtmpCaptionData(RtmpCaptionData value);
 } // namespace RtmpCaptionDataMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace RtmpOutputCertificateModeMapper
 {
 AWS_MEDIALIVE_API RtmpOutputCertificateMode GetRtmpOutputCertificateModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForRtmpOutputCertificateMode(RtmpOutputCertificateMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForRtmpOutputCertificateMode(RtmpOutputCertificateMode value);
 } // namespace RtmpOutputCertificateModeMapper
 } // namespace Model
 } // namespace MediaLive
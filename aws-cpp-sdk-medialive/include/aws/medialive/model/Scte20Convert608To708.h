@@ -34,7 +34,8 @@ namespace Scte20Convert608To708Mapper
 {
 AWS_MEDIALIVE_API Scte20Convert608To708 GetScte20Convert608To708ForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForScte20Convert608To708(Scte20Convert608To708 value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForScte20Convert608To708(Scte20Convert608To708 value);
 } // namespace Scte20Convert608To708Mapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace Scte35AposNoRegionalBlackoutBehaviorMapper
 {
 AWS_MEDIALIVE_API Scte35AposNoRegionalBlackoutBehavior GetScte35AposNoRegionalBlackoutBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForScte35AposNoRegionalBlackoutBehavior(Scte35AposNoRegionalBlackoutBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForScte35AposNoRegionalBlackoutBehavior(Scte35AposNoRegionalBlackoutBehavior value);
 } // namespace Scte35AposNoRegionalBlackoutBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
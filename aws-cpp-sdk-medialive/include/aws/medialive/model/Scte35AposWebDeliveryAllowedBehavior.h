@@ -34,7 +34,8 @@ namespace Scte35AposWebDeliveryAllowedBehaviorMapper
 {
 AWS_MEDIALIVE_API Scte35AposWebDeliveryAllowedBehavior GetScte35AposWebDeliveryAllowedBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForScte35AposWebDeliveryAllowedBehavior(Scte35AposWebDeliveryAllowedBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForScte35AposWebDeliveryAllowedBehavior(Scte35AposWebDeliveryAllowedBehavior value);
 } // namespace Scte35AposWebDeliveryAllowedBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace Scte35SpliceInsertNoRegionalBlackoutBehaviorMapper
 {
 AWS_MEDIALIVE_API Scte35SpliceInsertNoRegionalBlackoutBehavior GetScte35SpliceInsertNoRegionalBlackoutBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForScte35SpliceInsertNoRegionalBlackoutBehavior(Scte35SpliceInsertNoRegionalBlackoutBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForScte35SpliceInsertNoRegionalBlackoutBehavior(Scte35SpliceInsertNoRegionalBlackoutBehavior value);
 } // namespace Scte35SpliceInsertNoRegionalBlackoutBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
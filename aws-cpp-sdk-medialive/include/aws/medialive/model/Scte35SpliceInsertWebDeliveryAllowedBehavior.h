@@ -34,7 +34,8 @@ namespace Scte35SpliceInsertWebDeliveryAllowedBehaviorMapper
 {
 AWS_MEDIALIVE_API Scte35SpliceInsertWebDeliveryAllowedBehavior GetScte35SpliceInsertWebDeliveryAllowedBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForScte35SpliceInsertWebDeliveryAllowedBehavior(Scte35SpliceInsertWebDeliveryAllowedBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForScte35SpliceInsertWebDeliveryAllowedBehavior(Scte35SpliceInsertWebDeliveryAllowedBehavior value);
 } // namespace Scte35SpliceInsertWebDeliveryAllowedBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
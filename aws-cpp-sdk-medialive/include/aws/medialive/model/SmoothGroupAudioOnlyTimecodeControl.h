@@ -34,7 +34,8 @@ namespace SmoothGroupAudioOnlyTimecodeControlMapper
 {
 AWS_MEDIALIVE_API SmoothGroupAudioOnlyTimecodeControl GetSmoothGroupAudioOnlyTimecodeControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupAudioOnlyTimecodeControl(SmoothGroupAudioOnlyTimecodeControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupAudioOnlyTimecodeControl(SmoothGroupAudioOnlyTimecodeControl value);
 } // namespace SmoothGroupAudioOnlyTimecodeControlMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace SmoothGroupCertificateModeMapper
 {
 AWS_MEDIALIVE_API SmoothGroupCertificateMode GetSmoothGroupCertificateModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupCertificateMode(SmoothGroupCertificateMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupCertificateMode(SmoothGroupCertificateMode value);
 } // namespace SmoothGroupCertificateModeMapper
 } // namespace Model
 } // namespace MediaLive
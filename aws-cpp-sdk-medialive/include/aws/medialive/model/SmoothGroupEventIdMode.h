@@ -35,7 +35,8 @@ namespace SmoothGroupEventIdModeMapper
 {
 AWS_MEDIALIVE_API SmoothGroupEventIdMode GetSmoothGroupEventIdModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupEventIdMode(SmoothGroupEventIdMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupEventIdMode(SmoothGroupEventIdMode value);
 } // namespace SmoothGroupEventIdModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace SmoothGroupEventStopBehaviorMapper
 {
 AWS_MEDIALIVE_API SmoothGroupEventStopBehavior GetSmoothGroupEventStopBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupEventStopBehavior(SmoothGroupEventStopBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupEventStopBehavior(SmoothGroupEventStopBehavior value);
 } // namespace SmoothGroupEventStopBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
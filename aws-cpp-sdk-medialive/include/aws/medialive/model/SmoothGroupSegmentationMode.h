@@ -34,7 +34,8 @@ namespace SmoothGroupSegmentationModeMapper
 {
 AWS_MEDIALIVE_API SmoothGroupSegmentationMode GetSmoothGroupSegmentationModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupSegmentationMode(SmoothGroupSegmentationMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupSegmentationMode(SmoothGroupSegmentationMode value);
 } // namespace SmoothGroupSegmentationModeMapper
 } // namespace Model
 } // namespace MediaLive
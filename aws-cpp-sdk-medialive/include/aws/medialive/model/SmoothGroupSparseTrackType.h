@@ -34,7 +34,8 @@ namespace SmoothGroupSparseTrackTypeMapper
 {
 AWS_MEDIALIVE_API SmoothGroupSparseTrackType GetSmoothGroupSparseTrackTypeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupSparseTrackType(SmoothGroupSparseTrackType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupSparseTrackType(SmoothGroupSparseTrackType value);
 } // namespace SmoothGroupSparseTrackTypeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace SmoothGroupStreamManifestBehaviorMapper
 {
 AWS_MEDIALIVE_API SmoothGroupStreamManifestBehavior GetSmoothGroupStreamManifestBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupStreamManifestBehavior(SmoothGroupStreamManifestBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupStreamManifestBehavior(SmoothGroupStreamManifestBehavior value);
 } // namespace SmoothGroupStreamManifestBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
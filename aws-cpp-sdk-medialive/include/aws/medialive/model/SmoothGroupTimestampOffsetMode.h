@@ -34,7 +34,8 @@ namespace SmoothGroupTimestampOffsetModeMapper
 {
 AWS_MEDIALIVE_API SmoothGroupTimestampOffsetMode GetSmoothGroupTimestampOffsetModeForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForSmoothGroupTimestampOffsetMode(SmoothGroupTimestampOffsetMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForSmoothGroupTimestampOffsetMode(SmoothGroupTimestampOffsetMode value);
 } // namespace SmoothGroupTimestampOffsetModeMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace TimecodeConfigSourceMapper
 {
 AWS_MEDIALIVE_API TimecodeConfigSource GetTimecodeConfigSourceForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForTimecodeConfigSource(TimecodeConfigSource value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForTimecodeConfigSource(TimecodeConfigSource value);
 } // namespace TimecodeConfigSourceMapper
 } // namespace Model
 } // namespace MediaLive
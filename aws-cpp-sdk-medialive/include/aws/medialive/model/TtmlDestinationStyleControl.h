@@ -34,7 +34,8 @@ namespace TtmlDestinationStyleControlMapper
 {
 AWS_MEDIALIVE_API TtmlDestinationStyleControl GetTtmlDestinationStyleControlForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForTtmlDestinationStyleControl(TtmlDestinationStyleControl value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForTtmlDestinationStyleControl(TtmlDestinationStyleControl value);
 } // namespace TtmlDestinationStyleControlMapper
 } // namespace Model
 } // namespace MediaLive
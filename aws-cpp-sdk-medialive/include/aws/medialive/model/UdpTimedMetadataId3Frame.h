@@ -35,7 +35,8 @@ namespace UdpTimedMetadataId3FrameMapper
 {
 AWS_MEDIALIVE_API UdpTimedMetadataId3Frame GetUdpTimedMetadataId3FrameForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForUdpTimedMetadataId3Frame(UdpTimedMetadataId3Frame value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForUdpTimedMetadataId3Frame(UdpTimedMetadataId3Frame value);
 } // namespace UdpTimedMetadataId3FrameMapper
 } // namespace Model
 } // namespace MediaLive
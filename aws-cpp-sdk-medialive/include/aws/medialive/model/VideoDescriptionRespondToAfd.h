@@ -35,7 +35,8 @@ namespace VideoDescriptionRespondToAfdMapper
 {
 AWS_MEDIALIVE_API VideoDescriptionRespondToAfd GetVideoDescriptionRespondToAfdForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForVideoDescriptionRespondToAfd(VideoDescriptionRespondToAfd value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForVideoDescriptionRespondToAfd(VideoDescriptionRespondToAfd value);
 } // namespace VideoDescriptionRespondToAfdMapper
 } // namespace Model
 } // namespace MediaLive
@@ -34,7 +34,8 @@ namespace VideoDescriptionScalingBehaviorMapper
 {
 AWS_MEDIALIVE_API VideoDescriptionScalingBehavior GetVideoDescriptionScalingBehaviorForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForVideoDescriptionScalingBehavior(VideoDescriptionScalingBehavior value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForVideoDescriptionScalingBehavior(VideoDescriptionScalingBehavior value);
 } // namespace VideoDescriptionScalingBehaviorMapper
 } // namespace Model
 } // namespace MediaLive
@@ -35,7 +35,8 @@ namespace VideoSelectorColorSpaceMapper
 {
 AWS_MEDIALIVE_API VideoSelectorColorSpace GetVideoSelectorColorSpaceForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForVideoSelectorColorSpace(VideoSelectorColorSpace value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForVideoSelectorColorSpace(VideoSelectorColorSpace value);
 } // namespace VideoSelectorColorSpaceMapper
 } // namespace Model
 } // namespace MediaLive
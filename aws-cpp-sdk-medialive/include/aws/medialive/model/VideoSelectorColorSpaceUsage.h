@@ -34,7 +34,8 @@ namespace VideoSelectorColorSpaceUsageMapper
 {
 AWS_MEDIALIVE_API VideoSelectorColorSpaceUsage GetVideoSelectorColorSpaceUsageForName(const Aws::String& name);
 
-AWS_MEDIALIVE_API Aws::String GetNameForVideoSelectorColorSpaceUsage(VideoSelectorColorSpaceUsage value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIALIVE_API const char* GetNameForVideoSelectorColorSpaceUsage(VideoSelectorColorSpaceUsage value);
 } // namespace VideoSelectorColorSpaceUsageMapper
 } // namespace Model
 } // namespace MediaLive
@@ -28,15 +28,15 @@ namespace MediaLive
 namespace MediaLiveErrorMapper
 {
 
-static const int FORBIDDEN_HASH = HashingUtils::HashString("ForbiddenException");
-static const int BAD_GATEWAY_HASH = HashingUtils::HashString("BadGatewayException");
-static const int CONFLICT_HASH = HashingUtils::HashString("ConflictException");
-static const int UNPROCESSABLE_ENTITY_HASH = HashingUtils::HashString("UnprocessableEntityException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int BAD_REQUEST_HASH = HashingUtils::HashString("BadRequestException");
-static const int INTERNAL_SERVER_ERROR_HASH = HashingUtils::HashString("InternalServerErrorException");
-static const int GATEWAY_TIMEOUT_HASH = HashingUtils::HashString("GatewayTimeoutException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
+static constexpr int FORBIDDEN_HASH = HashingUtils::CompileTimeHashString("ForbiddenException");
+static constexpr int BAD_GATEWAY_HASH = HashingUtils::CompileTimeHashString("BadGatewayException");
+static constexpr int CONFLICT_HASH = HashingUtils::CompileTimeHashString("ConflictException");
+static constexpr int UNPROCESSABLE_ENTITY_HASH = HashingUtils::CompileTimeHashString("UnprocessableEntityException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int BAD_REQUEST_HASH = HashingUtils::CompileTimeHashString("BadRequestException");
+static constexpr int INTERNAL_SERVER_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalServerErrorException");
+static constexpr int GATEWAY_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("GatewayTimeoutException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace AacRateControlModeMapper
       {
 
-        static const int CBR_HASH = HashingUtils::HashString("CBR");
-        static const int VBR_HASH = HashingUtils::HashString("VBR");
+        static constexpr int CBR_HASH = HashingUtils::CompileTimeHashString("CBR");
+        static constexpr int VBR_HASH = HashingUtils::CompileTimeHashString("VBR");
 
 
         AacRateControlMode GetAacRateControlModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CBR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AacRateControlMode::CBR;
-          }
-          else if (hashCode == VBR_HASH)
-          {
-            return AacRateControlMode::VBR;
+          case CBR_HASH:
+            if (name == "CBR")
+            {
+              return AacRateControlMode::CBR;
+            }
+            break;
+          case VBR_HASH:
+            if (name == "VBR")
+            {
+              return AacRateControlMode::VBR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AacRateControlMode::NOT_SET;
         }
 
-        Aws::String GetNameForAacRateControlMode(AacRateControlMode enumValue)
+        const char* GetNameForAacRateControlMode(AacRateControlMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
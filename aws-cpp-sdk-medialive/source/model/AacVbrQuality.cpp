@@ -30,30 +30,44 @@ namespace Aws
       namespace AacVbrQualityMapper
       {
 
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MEDIUM_HIGH_HASH = HashingUtils::HashString("MEDIUM_HIGH");
-        static const int MEDIUM_LOW_HASH = HashingUtils::HashString("MEDIUM_LOW");
+        static constexpr int HIGH_HASH = HashingUtils::CompileTimeHashString("HIGH");
+        static constexpr int LOW_HASH = HashingUtils::CompileTimeHashString("LOW");
+        static constexpr int MEDIUM_HIGH_HASH = HashingUtils::CompileTimeHashString("MEDIUM_HIGH");
+        static constexpr int MEDIUM_LOW_HASH = HashingUtils::CompileTimeHashString("MEDIUM_LOW");
 
 
         AacVbrQuality GetAacVbrQualityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HIGH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AacVbrQuality::HIGH;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return AacVbrQuality::LOW;
-          }
-          else if (hashCode == MEDIUM_HIGH_HASH)
-          {
-            return AacVbrQuality::MEDIUM_HIGH;
-          }
-          else if (hashCode == MEDIUM_LOW_HASH)
-          {
-            return AacVbrQuality::MEDIUM_LOW;
+          case HIGH_HASH:
+            if (name == "HIGH")
+            {
+              return AacVbrQuality::HIGH;
+            }
+            break;
+          case LOW_HASH:
+            if (name == "LOW")
+            {
+              return AacVbrQuality::LOW;
+            }
+            break;
+          case MEDIUM_HIGH_HASH:
+            if (name == "MEDIUM_HIGH")
+            {
+              return AacVbrQuality::MEDIUM_HIGH;
+            }
+            break;
+          case MEDIUM_LOW_HASH:
+            if (name == "MEDIUM_LOW")
+            {
+              return AacVbrQuality::MEDIUM_LOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AacVbrQuality::NOT_SET;
         }
 
-        Aws::String GetNameForAacVbrQuality(AacVbrQuality enumValue)
+        const char* GetNameForAacVbrQuality(AacVbrQuality enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
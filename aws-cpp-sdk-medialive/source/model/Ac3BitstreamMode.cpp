@@ -30,50 +30,72 @@ namespace Aws
       namespace Ac3BitstreamModeMapper
       {
 
-        static const int COMMENTARY_HASH = HashingUtils::HashString("COMMENTARY");
-        static const int COMPLETE_MAIN_HASH = HashingUtils::HashString("COMPLETE_MAIN");
-        static const int DIALOGUE_HASH = HashingUtils::HashString("DIALOGUE");
-        static const int EMERGENCY_HASH = HashingUtils::HashString("EMERGENCY");
-        static const int HEARING_IMPAIRED_HASH = HashingUtils::HashString("HEARING_IMPAIRED");
-        static const int MUSIC_AND_EFFECTS_HASH = HashingUtils::HashString("MUSIC_AND_EFFECTS");
-        static const int VISUALLY_IMPAIRED_HASH = HashingUtils::HashString("VISUALLY_IMPAIRED");
-        static const int VOICE_OVER_HASH = HashingUtils::HashString("VOICE_OVER");
+        static constexpr int COMMENTARY_HASH = HashingUtils::CompileTimeHashString("COMMENTARY");
+        static constexpr int COMPLETE_MAIN_HASH = HashingUtils::CompileTimeHashString("COMPLETE_MAIN");
+        static constexpr int DIALOGUE_HASH = HashingUtils::CompileTimeHashString("DIALOGUE");
+        static constexpr int EMERGENCY_HASH = HashingUtils::CompileTimeHashString("EMERGENCY");
+        static constexpr int HEARING_IMPAIRED_HASH = HashingUtils::CompileTimeHashString("HEARING_IMPAIRED");
+        static constexpr int MUSIC_AND_EFFECTS_HASH = HashingUtils::CompileTimeHashString("MUSIC_AND_EFFECTS");
+        static constexpr int VISUALLY_IMPAIRED_HASH = HashingUtils::CompileTimeHashString("VISUALLY_IMPAIRED");
+        static constexpr int VOICE_OVER_HASH = HashingUtils::CompileTimeHashString("VOICE_OVER");
 
 
         Ac3BitstreamMode GetAc3BitstreamModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMMENTARY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Ac3BitstreamMode::COMMENTARY;
-          }
-          else if (hashCode == COMPLETE_MAIN_HASH)
-          {
-            return Ac3BitstreamMode::COMPLETE_MAIN;
-          }
-          else if (hashCode == DIALOGUE_HASH)
-          {
-            return Ac3BitstreamMode::DIALOGUE;
-          }
-          else if (hashCode == EMERGENCY_HASH)
-          {
-            return Ac3BitstreamMode::EMERGENCY;
-          }
-          else if (hashCode == HEARING_IMPAIRED_HASH)
-          {
-            return Ac3BitstreamMode::HEARING_IMPAIRED;
-          }
-          else if (hashCode == MUSIC_AND_EFFECTS_HASH)
-          {
-            return Ac3BitstreamMode::MUSIC_AND_EFFECTS;
-          }
-          else if (hashCode == VISUALLY_IMPAIRED_HASH)
-          {
-            return Ac3BitstreamMode::VISUALLY_IMPAIRED;
-          }
-          else if (hashCode == VOICE_OVER_HASH)
-          {
-            return Ac3BitstreamMode::VOICE_OVER;
+          case COMMENTARY_HASH:
+            if (name == "COMMENTARY")
+            {
+              return Ac3BitstreamMode::COMMENTARY;
+            }
+            break;
+          case COMPLETE_MAIN_HASH:
+            if (name == "COMPLETE_MAIN")
+            {
+              return Ac3BitstreamMode::COMPLETE_MAIN;
+            }
+            break;
+          case DIALOGUE_HASH:
+            if (name == "DIALOGUE")
+            {
+              return Ac3BitstreamMode::DIALOGUE;
+            }
+            break;
+          case EMERGENCY_HASH:
+            if (name == "EMERGENCY")
+            {
+              return Ac3BitstreamMode::EMERGENCY;
+            }
+            break;
+          case HEARING_IMPAIRED_HASH:
+            if (name == "HEARING_IMPAIRED")
+            {
+              return Ac3BitstreamMode::HEARING_IMPAIRED;
+            }
+            break;
+          case MUSIC_AND_EFFECTS_HASH:
+            if (name == "MUSIC_AND_EFFECTS")
+            {
+              return Ac3BitstreamMode::MUSIC_AND_EFFECTS;
+            }
+            break;
+          case VISUALLY_IMPAIRED_HASH:
+            if (name == "VISUALLY_IMPAIRED")
+            {
+              return Ac3BitstreamMode::VISUALLY_IMPAIRED;
+            }
+            break;
+          case VOICE_OVER_HASH:
+            if (name == "VOICE_OVER")
+            {
+              return Ac3BitstreamMode::VOICE_OVER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return Ac3BitstreamMode::NOT_SET;
         }
 
-        Aws::String GetNameForAc3BitstreamMode(Ac3BitstreamMode enumValue)
+        const char* GetNameForAc3BitstreamMode(Ac3BitstreamMode enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
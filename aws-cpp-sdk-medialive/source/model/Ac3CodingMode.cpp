@@ -30,30 +30,44 @@ namespace Aws
       namespace Ac3CodingModeMapper
       {
 
-        static const int CODING_MODE_1_0_HASH = HashingUtils::HashString("CODING_MODE_1_0");
-        static const int CODING_MODE_1_1_HASH = HashingUtils::HashString("CODING_MODE_1_1");
-        static const int CODING_MODE_2_0_HASH = HashingUtils::HashString("CODING_MODE_2_0");
-        static const int CODING_MODE_3_2_LFE_HASH = HashingUtils::HashString("CODING_MODE_3_2_LFE");
+        static constexpr int CODING_MODE_1_0_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_1_0");
+        static constexpr int CODING_MODE_1_1_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_1_1");
+        static constexpr int CODING_MODE_2_0_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_2_0");
+        static constexpr int CODING_MODE_3_2_LFE_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_3_2_LFE");
 
 
         Ac3CodingMode GetAc3CodingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODING_MODE_1_0_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Ac3CodingMode::CODING_MODE_1_0;
-          }
-          else if (hashCode == CODING_MODE_1_1_HASH)
-          {
-            return Ac3CodingMode::CODING_MODE_1_1;
-          }
-          else if (hashCode == CODING_MODE_2_0_HASH)
-          {
-            return Ac3CodingMode::CODING_MODE_2_0;
-          }
-          else if (hashCode == CODING_MODE_3_2_LFE_HASH)
-          {
-            return Ac3CodingMode::CODING_MODE_3_2_LFE;
+          case CODING_MODE_1_0_HASH:
+            if (name == "CODING_MODE_1_0")
+            {
+              return Ac3CodingMode::CODING_MODE_1_0;
+            }
+            break;
+          case CODING_MODE_1_1_HASH:
+            if (name == "CODING_MODE_1_1")
+            {
+              return Ac3CodingMode::CODING_MODE_1_1;
+            }
+            break;
+          case CODING_MODE_2_0_HASH:
+            if (name == "CODING_MODE_2_0")
+            {
+              return Ac3CodingMode::CODING_MODE_2_0;
+            }
+            break;
+          case CODING_MODE_3_2_LFE_HASH:
+            if (name == "CODING_MODE_3_2_LFE")
+            {
+              return Ac3CodingMode::CODING_MODE_3_2_LFE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return Ac3CodingMode::NOT_SET;
         }
 
-        Aws::String GetNameForAc3CodingMode(Ac3CodingMode enumValue)
+        const char* GetNameForAc3CodingMode(Ac3CodingMode enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
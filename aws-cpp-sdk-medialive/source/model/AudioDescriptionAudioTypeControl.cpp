@@ -30,20 +30,30 @@ namespace Aws
       namespace AudioDescriptionAudioTypeControlMapper
       {
 
-        static const int FOLLOW_INPUT_HASH = HashingUtils::HashString("FOLLOW_INPUT");
-        static const int USE_CONFIGURED_HASH = HashingUtils::HashString("USE_CONFIGURED");
+        static constexpr int FOLLOW_INPUT_HASH = HashingUtils::CompileTimeHashString("FOLLOW_INPUT");
+        static constexpr int USE_CONFIGURED_HASH = HashingUtils::CompileTimeHashString("USE_CONFIGURED");
 
 
         AudioDescriptionAudioTypeControl GetAudioDescriptionAudioTypeControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_INPUT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioDescriptionAudioTypeControl::FOLLOW_INPUT;
-          }
-          else if (hashCode == USE_CONFIGURED_HASH)
-          {
-            return AudioDescriptionAudioTypeControl::USE_CONFIGURED;
+          case FOLLOW_INPUT_HASH:
+            if (name == "FOLLOW_INPUT")
+            {
+              return AudioDescriptionAudioTypeControl::FOLLOW_INPUT;
+            }
+            break;
+          case USE_CONFIGURED_HASH:
+            if (name == "USE_CONFIGURED")
+            {
+              return AudioDescriptionAudioTypeControl::USE_CONFIGURED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AudioDescriptionAudioTypeControl::NOT_SET;
         }
 
-        Aws::String GetNameForAudioDescriptionAudioTypeControl(AudioDescriptionAudioTypeControl enumValue)
+        const char* GetNameForAudioDescriptionAudioTypeControl(AudioDescriptionAudioTypeControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AudioLanguageSelectionPolicyMapper
       {
 
-        static const int LOOSE_HASH = HashingUtils::HashString("LOOSE");
-        static const int STRICT_HASH = HashingUtils::HashString("STRICT");
+        static constexpr int LOOSE_HASH = HashingUtils::CompileTimeHashString("LOOSE");
+        static constexpr int STRICT_HASH = HashingUtils::CompileTimeHashString("STRICT");
 
 
         AudioLanguageSelectionPolicy GetAudioLanguageSelectionPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOOSE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioLanguageSelectionPolicy::LOOSE;
-          }
-          else if (hashCode == STRICT_HASH)
-          {
-            return AudioLanguageSelectionPolicy::STRICT;
+          case LOOSE_HASH:
+            if (name == "LOOSE")
+            {
+              return AudioLanguageSelectionPolicy::LOOSE;
+            }
+            break;
+          case STRICT_HASH:
+            if (name == "STRICT")
+            {
+              return AudioLanguageSelectionPolicy::STRICT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AudioLanguageSelectionPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForAudioLanguageSelectionPolicy(AudioLanguageSelectionPolicy enumValue)
+        const char* GetNameForAudioLanguageSelectionPolicy(AudioLanguageSelectionPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AudioNormalizationAlgorithmMapper
       {
 
-        static const int ITU_1770_1_HASH = HashingUtils::HashString("ITU_1770_1");
-        static const int ITU_1770_2_HASH = HashingUtils::HashString("ITU_1770_2");
+        static constexpr int ITU_1770_1_HASH = HashingUtils::CompileTimeHashString("ITU_1770_1");
+        static constexpr int ITU_1770_2_HASH = HashingUtils::CompileTimeHashString("ITU_1770_2");
 
 
         AudioNormalizationAlgorithm GetAudioNormalizationAlgorithmForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ITU_1770_1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioNormalizationAlgorithm::ITU_1770_1;
-          }
-          else if (hashCode == ITU_1770_2_HASH)
-          {
-            return AudioNormalizationAlgorithm::ITU_1770_2;
+          case ITU_1770_1_HASH:
+            if (name == "ITU_1770_1")
+            {
+              return AudioNormalizationAlgorithm::ITU_1770_1;
+            }
+            break;
+          case ITU_1770_2_HASH:
+            if (name == "ITU_1770_2")
+            {
+              return AudioNormalizationAlgorithm::ITU_1770_2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AudioNormalizationAlgorithm::NOT_SET;
         }
 
-        Aws::String GetNameForAudioNormalizationAlgorithm(AudioNormalizationAlgorithm enumValue)
+        const char* GetNameForAudioNormalizationAlgorithm(AudioNormalizationAlgorithm enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace AudioNormalizationAlgorithmControlMapper
       {
 
-        static const int CORRECT_AUDIO_HASH = HashingUtils::HashString("CORRECT_AUDIO");
+        static constexpr int CORRECT_AUDIO_HASH = HashingUtils::CompileTimeHashString("CORRECT_AUDIO");
 
 
         AudioNormalizationAlgorithmControl GetAudioNormalizationAlgorithmControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CORRECT_AUDIO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioNormalizationAlgorithmControl::CORRECT_AUDIO;
+          case CORRECT_AUDIO_HASH:
+            if (name == "CORRECT_AUDIO")
+            {
+              return AudioNormalizationAlgorithmControl::CORRECT_AUDIO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return AudioNormalizationAlgorithmControl::NOT_SET;
         }
 
-        Aws::String GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl enumValue)
+        const char* GetNameForAudioNormalizationAlgorithmControl(AudioNormalizationAlgorithmControl enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace AudioTypeMapper
       {
 
-        static const int CLEAN_EFFECTS_HASH = HashingUtils::HashString("CLEAN_EFFECTS");
-        static const int HEARING_IMPAIRED_HASH = HashingUtils::HashString("HEARING_IMPAIRED");
-        static const int UNDEFINED_HASH = HashingUtils::HashString("UNDEFINED");
-        static const int VISUAL_IMPAIRED_COMMENTARY_HASH = HashingUtils::HashString("VISUAL_IMPAIRED_COMMENTARY");
+        static constexpr int CLEAN_EFFECTS_HASH = HashingUtils::CompileTimeHashString("CLEAN_EFFECTS");
+        static constexpr int HEARING_IMPAIRED_HASH = HashingUtils::CompileTimeHashString("HEARING_IMPAIRED");
+        static constexpr int UNDEFINED_HASH = HashingUtils::CompileTimeHashString("UNDEFINED");
+        static constexpr int VISUAL_IMPAIRED_COMMENTARY_HASH = HashingUtils::CompileTimeHashString("VISUAL_IMPAIRED_COMMENTARY");
 
 
         AudioType GetAudioTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLEAN_EFFECTS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AudioType::CLEAN_EFFECTS;
-          }
-          else if (hashCode == HEARING_IMPAIRED_HASH)
-          {
-            return AudioType::HEARING_IMPAIRED;
-          }
-          else if (hashCode == UNDEFINED_HASH)
-          {
-            return AudioType::UNDEFINED;
-          }
-          else if (hashCode == VISUAL_IMPAIRED_COMMENTARY_HASH)
-          {
-            return AudioType::VISUAL_IMPAIRED_COMMENTARY;
+          case CLEAN_EFFECTS_HASH:
+            if (name == "CLEAN_EFFECTS")
+            {
+              return AudioType::CLEAN_EFFECTS;
+            }
+            break;
+          case HEARING_IMPAIRED_HASH:
+            if (name == "HEARING_IMPAIRED")
+            {
+              return AudioType::HEARING_IMPAIRED;
+            }
+            break;
+          case UNDEFINED_HASH:
+            if (name == "UNDEFINED")
+            {
+              return AudioType::UNDEFINED;
+            }
+            break;
+          case VISUAL_IMPAIRED_COMMENTARY_HASH:
+            if (name == "VISUAL_IMPAIRED_COMMENTARY")
+            {
+              return AudioType::VISUAL_IMPAIRED_COMMENTARY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AudioType::NOT_SET;
         }
 
-        Aws::String GetNameForAudioType(AudioType enumValue)
+        const char* GetNameForAudioType(AudioType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AuthenticationSchemeMapper
       {
 
-        static const int AKAMAI_HASH = HashingUtils::HashString("AKAMAI");
-        static const int COMMON_HASH = HashingUtils::HashString("COMMON");
+        static constexpr int AKAMAI_HASH = HashingUtils::CompileTimeHashString("AKAMAI");
+        static constexpr int COMMON_HASH = HashingUtils::CompileTimeHashString("COMMON");
 
 
         AuthenticationScheme GetAuthenticationSchemeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AKAMAI_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AuthenticationScheme::AKAMAI;
-          }
-          else if (hashCode == COMMON_HASH)
-          {
-            return AuthenticationScheme::COMMON;
+          case AKAMAI_HASH:
+            if (name == "AKAMAI")
+            {
+              return AuthenticationScheme::AKAMAI;
+            }
+            break;
+          case COMMON_HASH:
+            if (name == "COMMON")
+            {
+              return AuthenticationScheme::COMMON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AuthenticationScheme::NOT_SET;
         }
 
-        Aws::String GetNameForAuthenticationScheme(AuthenticationScheme enumValue)
+        const char* GetNameForAuthenticationScheme(AuthenticationScheme enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace BurnInAlignmentMapper
       {
 
-        static const int CENTERED_HASH = HashingUtils::HashString("CENTERED");
-        static const int LEFT_HASH = HashingUtils::HashString("LEFT");
-        static const int SMART_HASH = HashingUtils::HashString("SMART");
+        static constexpr int CENTERED_HASH = HashingUtils::CompileTimeHashString("CENTERED");
+        static constexpr int LEFT_HASH = HashingUtils::CompileTimeHashString("LEFT");
+        static constexpr int SMART_HASH = HashingUtils::CompileTimeHashString("SMART");
 
 
         BurnInAlignment GetBurnInAlignmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CENTERED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BurnInAlignment::CENTERED;
-          }
-          else if (hashCode == LEFT_HASH)
-          {
-            return BurnInAlignment::LEFT;
-          }
-          else if (hashCode == SMART_HASH)
-          {
-            return BurnInAlignment::SMART;
+          case CENTERED_HASH:
+            if (name == "CENTERED")
+            {
+              return BurnInAlignment::CENTERED;
+            }
+            break;
+          case LEFT_HASH:
+            if (name == "LEFT")
+            {
+              return BurnInAlignment::LEFT;
+            }
+            break;
+          case SMART_HASH:
+            if (name == "SMART")
+            {
+              return BurnInAlignment::SMART;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return BurnInAlignment::NOT_SET;
         }
 
-        Aws::String GetNameForBurnInAlignment(BurnInAlignment enumValue)
+        const char* GetNameForBurnInAlignment(BurnInAlignment enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
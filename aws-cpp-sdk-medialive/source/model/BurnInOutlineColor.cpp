@@ -30,40 +30,58 @@ namespace Aws
       namespace BurnInOutlineColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int BLUE_HASH = HashingUtils::HashString("BLUE");
-        static const int GREEN_HASH = HashingUtils::HashString("GREEN");
-        static const int RED_HASH = HashingUtils::HashString("RED");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
-        static const int YELLOW_HASH = HashingUtils::HashString("YELLOW");
+        static constexpr int BLACK_HASH = HashingUtils::CompileTimeHashString("BLACK");
+        static constexpr int BLUE_HASH = HashingUtils::CompileTimeHashString("BLUE");
+        static constexpr int GREEN_HASH = HashingUtils::CompileTimeHashString("GREEN");
+        static constexpr int RED_HASH = HashingUtils::CompileTimeHashString("RED");
+        static constexpr int WHITE_HASH = HashingUtils::CompileTimeHashString("WHITE");
+        static constexpr int YELLOW_HASH = HashingUtils::CompileTimeHashString("YELLOW");
 
 
         BurnInOutlineColor GetBurnInOutlineColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BurnInOutlineColor::BLACK;
-          }
-          else if (hashCode == BLUE_HASH)
-          {
-            return BurnInOutlineColor::BLUE;
-          }
-          else if (hashCode == GREEN_HASH)
-          {
-            return BurnInOutlineColor::GREEN;
-          }
-          else if (hashCode == RED_HASH)
-          {
-            return BurnInOutlineColor::RED;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return BurnInOutlineColor::WHITE;
-          }
-          else if (hashCode == YELLOW_HASH)
-          {
-            return BurnInOutlineColor::YELLOW;
+          case BLACK_HASH:
+            if (name == "BLACK")
+            {
+              return BurnInOutlineColor::BLACK;
+            }
+            break;
+          case BLUE_HASH:
+            if (name == "BLUE")
+            {
+              return BurnInOutlineColor::BLUE;
+            }
+            break;
+          case GREEN_HASH:
+            if (name == "GREEN")
+            {
+              return BurnInOutlineColor::GREEN;
+            }
+            break;
+          case RED_HASH:
+            if (name == "RED")
+            {
+              return BurnInOutlineColor::RED;
+            }
+            break;
+          case WHITE_HASH:
+            if (name == "WHITE")
+            {
+              return BurnInOutlineColor::WHITE;
+            }
+            break;
+          case YELLOW_HASH:
+            if (name == "YELLOW")
+            {
+              return BurnInOutlineColor::YELLOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return BurnInOutlineColor::NOT_SET;
         }
 
-        Aws::String GetNameForBurnInOutlineColor(BurnInOutlineColor enumValue)
+        const char* GetNameForBurnInOutlineColor(BurnInOutlineColor enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
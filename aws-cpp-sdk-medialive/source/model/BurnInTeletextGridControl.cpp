@@ -30,20 +30,30 @@ namespace Aws
       namespace BurnInTeletextGridControlMapper
       {
 
-        static const int FIXED_HASH = HashingUtils::HashString("FIXED");
-        static const int SCALED_HASH = HashingUtils::HashString("SCALED");
+        static constexpr int FIXED_HASH = HashingUtils::CompileTimeHashString("FIXED");
+        static constexpr int SCALED_HASH = HashingUtils::CompileTimeHashString("SCALED");
 
 
         BurnInTeletextGridControl GetBurnInTeletextGridControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FIXED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BurnInTeletextGridControl::FIXED;
-          }
-          else if (hashCode == SCALED_HASH)
-          {
-            return BurnInTeletextGridControl::SCALED;
+          case FIXED_HASH:
+            if (name == "FIXED")
+            {
+              return BurnInTeletextGridControl::FIXED;
+            }
+            break;
+          case SCALED_HASH:
+            if (name == "SCALED")
+            {
+              return BurnInTeletextGridControl::SCALED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BurnInTeletextGridControl::NOT_SET;
         }
 
-        Aws::String GetNameForBurnInTeletextGridControl(BurnInTeletextGridControl enumValue)
+        const char* GetNameForBurnInTeletextGridControl(BurnInTeletextGridControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,55 +30,79 @@ namespace Aws
       namespace ChannelStateMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int IDLE_HASH = HashingUtils::HashString("IDLE");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int RECOVERING_HASH = HashingUtils::HashString("RECOVERING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int CREATE_FAILED_HASH = HashingUtils::CompileTimeHashString("CREATE_FAILED");
+        static constexpr int IDLE_HASH = HashingUtils::CompileTimeHashString("IDLE");
+        static constexpr int STARTING_HASH = HashingUtils::CompileTimeHashString("STARTING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int RECOVERING_HASH = HashingUtils::CompileTimeHashString("RECOVERING");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         ChannelState GetChannelStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChannelState::CREATING;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
-            return ChannelState::CREATE_FAILED;
-          }
-          else if (hashCode == IDLE_HASH)
-          {
-            return ChannelState::IDLE;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return ChannelState::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ChannelState::RUNNING;
-          }
-          else if (hashCode == RECOVERING_HASH)
-          {
-            return ChannelState::RECOVERING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return ChannelState::STOPPING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ChannelState::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ChannelState::DELETED;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return ChannelState::CREATING;
+            }
+            break;
+          case CREATE_FAILED_HASH:
+            if (name == "CREATE_FAILED")
+            {
+              return ChannelState::CREATE_FAILED;
+            }
+            break;
+          case IDLE_HASH:
+            if (name == "IDLE")
+            {
+              return ChannelState::IDLE;
+            }
+            break;
+          case STARTING_HASH:
+            if (name == "STARTING")
+            {
+              return ChannelState::STARTING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return ChannelState::RUNNING;
+            }
+            break;
+          case RECOVERING_HASH:
+            if (name == "RECOVERING")
+            {
+              return ChannelState::RECOVERING;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return ChannelState::STOPPING;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ChannelState::DELETING;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return ChannelState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return ChannelState::NOT_SET;
         }
 
-        Aws::String GetNameForChannelState(ChannelState enumValue)
+        const char* GetNameForChannelState(ChannelState enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace DvbSubDestinationAlignmentMapper
       {
 
-        static const int CENTERED_HASH = HashingUtils::HashString("CENTERED");
-        static const int LEFT_HASH = HashingUtils::HashString("LEFT");
-        static const int SMART_HASH = HashingUtils::HashString("SMART");
+        static constexpr int CENTERED_HASH = HashingUtils::CompileTimeHashString("CENTERED");
+        static constexpr int LEFT_HASH = HashingUtils::CompileTimeHashString("LEFT");
+        static constexpr int SMART_HASH = HashingUtils::CompileTimeHashString("SMART");
 
 
         DvbSubDestinationAlignment GetDvbSubDestinationAlignmentForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CENTERED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DvbSubDestinationAlignment::CENTERED;
-          }
-          else if (hashCode == LEFT_HASH)
-          {
-            return DvbSubDestinationAlignment::LEFT;
-          }
-          else if (hashCode == SMART_HASH)
-          {
-            return DvbSubDestinationAlignment::SMART;
+          case CENTERED_HASH:
+            if (name == "CENTERED")
+            {
+              return DvbSubDestinationAlignment::CENTERED;
+            }
+            break;
+          case LEFT_HASH:
+            if (name == "LEFT")
+            {
+              return DvbSubDestinationAlignment::LEFT;
+            }
+            break;
+          case SMART_HASH:
+            if (name == "SMART")
+            {
+              return DvbSubDestinationAlignment::SMART;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DvbSubDestinationAlignment::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubDestinationAlignment(DvbSubDestinationAlignment enumValue)
+        const char* GetNameForDvbSubDestinationAlignment(DvbSubDestinationAlignment enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
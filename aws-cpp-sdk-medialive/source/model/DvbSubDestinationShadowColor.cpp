@@ -30,25 +30,37 @@ namespace Aws
       namespace DvbSubDestinationShadowColorMapper
       {
 
-        static const int BLACK_HASH = HashingUtils::HashString("BLACK");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int WHITE_HASH = HashingUtils::HashString("WHITE");
+        static constexpr int BLACK_HASH = HashingUtils::CompileTimeHashString("BLACK");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int WHITE_HASH = HashingUtils::CompileTimeHashString("WHITE");
 
 
         DvbSubDestinationShadowColor GetDvbSubDestinationShadowColorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLACK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DvbSubDestinationShadowColor::BLACK;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return DvbSubDestinationShadowColor::NONE;
-          }
-          else if (hashCode == WHITE_HASH)
-          {
-            return DvbSubDestinationShadowColor::WHITE;
+          case BLACK_HASH:
+            if (name == "BLACK")
+            {
+              return DvbSubDestinationShadowColor::BLACK;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return DvbSubDestinationShadowColor::NONE;
+            }
+            break;
+          case WHITE_HASH:
+            if (name == "WHITE")
+            {
+              return DvbSubDestinationShadowColor::WHITE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DvbSubDestinationShadowColor::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubDestinationShadowColor(DvbSubDestinationShadowColor enumValue)
+        const char* GetNameForDvbSubDestinationShadowColor(DvbSubDestinationShadowColor enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
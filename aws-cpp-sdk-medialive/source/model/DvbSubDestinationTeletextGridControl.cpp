@@ -30,20 +30,30 @@ namespace Aws
       namespace DvbSubDestinationTeletextGridControlMapper
       {
 
-        static const int FIXED_HASH = HashingUtils::HashString("FIXED");
-        static const int SCALED_HASH = HashingUtils::HashString("SCALED");
+        static constexpr int FIXED_HASH = HashingUtils::CompileTimeHashString("FIXED");
+        static constexpr int SCALED_HASH = HashingUtils::CompileTimeHashString("SCALED");
 
 
         DvbSubDestinationTeletextGridControl GetDvbSubDestinationTeletextGridControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FIXED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DvbSubDestinationTeletextGridControl::FIXED;
-          }
-          else if (hashCode == SCALED_HASH)
-          {
-            return DvbSubDestinationTeletextGridControl::SCALED;
+          case FIXED_HASH:
+            if (name == "FIXED")
+            {
+              return DvbSubDestinationTeletextGridControl::FIXED;
+            }
+            break;
+          case SCALED_HASH:
+            if (name == "SCALED")
+            {
+              return DvbSubDestinationTeletextGridControl::SCALED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DvbSubDestinationTeletextGridControl::NOT_SET;
         }
 
-        Aws::String GetNameForDvbSubDestinationTeletextGridControl(DvbSubDestinationTeletextGridControl enumValue)
+        const char* GetNameForDvbSubDestinationTeletextGridControl(DvbSubDestinationTeletextGridControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
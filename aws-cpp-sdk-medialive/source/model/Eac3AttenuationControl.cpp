@@ -30,20 +30,30 @@ namespace Aws
       namespace Eac3AttenuationControlMapper
       {
 
-        static const int ATTENUATE_3_DB_HASH = HashingUtils::HashString("ATTENUATE_3_DB");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int ATTENUATE_3_DB_HASH = HashingUtils::CompileTimeHashString("ATTENUATE_3_DB");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         Eac3AttenuationControl GetEac3AttenuationControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ATTENUATE_3_DB_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3AttenuationControl::ATTENUATE_3_DB;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return Eac3AttenuationControl::NONE;
+          case ATTENUATE_3_DB_HASH:
+            if (name == "ATTENUATE_3_DB")
+            {
+              return Eac3AttenuationControl::ATTENUATE_3_DB;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return Eac3AttenuationControl::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Eac3AttenuationControl::NOT_SET;
         }
 
-        Aws::String GetNameForEac3AttenuationControl(Eac3AttenuationControl enumValue)
+        const char* GetNameForEac3AttenuationControl(Eac3AttenuationControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace Eac3BitstreamModeMapper
       {
 
-        static const int COMMENTARY_HASH = HashingUtils::HashString("COMMENTARY");
-        static const int COMPLETE_MAIN_HASH = HashingUtils::HashString("COMPLETE_MAIN");
-        static const int EMERGENCY_HASH = HashingUtils::HashString("EMERGENCY");
-        static const int HEARING_IMPAIRED_HASH = HashingUtils::HashString("HEARING_IMPAIRED");
-        static const int VISUALLY_IMPAIRED_HASH = HashingUtils::HashString("VISUALLY_IMPAIRED");
+        static constexpr int COMMENTARY_HASH = HashingUtils::CompileTimeHashString("COMMENTARY");
+        static constexpr int COMPLETE_MAIN_HASH = HashingUtils::CompileTimeHashString("COMPLETE_MAIN");
+        static constexpr int EMERGENCY_HASH = HashingUtils::CompileTimeHashString("EMERGENCY");
+        static constexpr int HEARING_IMPAIRED_HASH = HashingUtils::CompileTimeHashString("HEARING_IMPAIRED");
+        static constexpr int VISUALLY_IMPAIRED_HASH = HashingUtils::CompileTimeHashString("VISUALLY_IMPAIRED");
 
 
         Eac3BitstreamMode GetEac3BitstreamModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMMENTARY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3BitstreamMode::COMMENTARY;
-          }
-          else if (hashCode == COMPLETE_MAIN_HASH)
-          {
-            return Eac3BitstreamMode::COMPLETE_MAIN;
-          }
-          else if (hashCode == EMERGENCY_HASH)
-          {
-            return Eac3BitstreamMode::EMERGENCY;
-          }
-          else if (hashCode == HEARING_IMPAIRED_HASH)
-          {
-            return Eac3BitstreamMode::HEARING_IMPAIRED;
-          }
-          else if (hashCode == VISUALLY_IMPAIRED_HASH)
-          {
-            return Eac3BitstreamMode::VISUALLY_IMPAIRED;
+          case COMMENTARY_HASH:
+            if (name == "COMMENTARY")
+            {
+              return Eac3BitstreamMode::COMMENTARY;
+            }
+            break;
+          case COMPLETE_MAIN_HASH:
+            if (name == "COMPLETE_MAIN")
+            {
+              return Eac3BitstreamMode::COMPLETE_MAIN;
+            }
+            break;
+          case EMERGENCY_HASH:
+            if (name == "EMERGENCY")
+            {
+              return Eac3BitstreamMode::EMERGENCY;
+            }
+            break;
+          case HEARING_IMPAIRED_HASH:
+            if (name == "HEARING_IMPAIRED")
+            {
+              return Eac3BitstreamMode::HEARING_IMPAIRED;
+            }
+            break;
+          case VISUALLY_IMPAIRED_HASH:
+            if (name == "VISUALLY_IMPAIRED")
+            {
+              return Eac3BitstreamMode::VISUALLY_IMPAIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Eac3BitstreamMode::NOT_SET;
         }
 
-        Aws::String GetNameForEac3BitstreamMode(Eac3BitstreamMode enumValue)
+        const char* GetNameForEac3BitstreamMode(Eac3BitstreamMode enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace Eac3DrcLineMapper
       {
 
-        static const int FILM_LIGHT_HASH = HashingUtils::HashString("FILM_LIGHT");
-        static const int FILM_STANDARD_HASH = HashingUtils::HashString("FILM_STANDARD");
-        static const int MUSIC_LIGHT_HASH = HashingUtils::HashString("MUSIC_LIGHT");
-        static const int MUSIC_STANDARD_HASH = HashingUtils::HashString("MUSIC_STANDARD");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SPEECH_HASH = HashingUtils::HashString("SPEECH");
+        static constexpr int FILM_LIGHT_HASH = HashingUtils::CompileTimeHashString("FILM_LIGHT");
+        static constexpr int FILM_STANDARD_HASH = HashingUtils::CompileTimeHashString("FILM_STANDARD");
+        static constexpr int MUSIC_LIGHT_HASH = HashingUtils::CompileTimeHashString("MUSIC_LIGHT");
+        static constexpr int MUSIC_STANDARD_HASH = HashingUtils::CompileTimeHashString("MUSIC_STANDARD");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int SPEECH_HASH = HashingUtils::CompileTimeHashString("SPEECH");
 
 
         Eac3DrcLine GetEac3DrcLineForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FILM_LIGHT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3DrcLine::FILM_LIGHT;
-          }
-          else if (hashCode == FILM_STANDARD_HASH)
-          {
-            return Eac3DrcLine::FILM_STANDARD;
-          }
-          else if (hashCode == MUSIC_LIGHT_HASH)
-          {
-            return Eac3DrcLine::MUSIC_LIGHT;
-          }
-          else if (hashCode == MUSIC_STANDARD_HASH)
-          {
-            return Eac3DrcLine::MUSIC_STANDARD;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return Eac3DrcLine::NONE;
-          }
-          else if (hashCode == SPEECH_HASH)
-          {
-            return Eac3DrcLine::SPEECH;
+          case FILM_LIGHT_HASH:
+            if (name == "FILM_LIGHT")
+            {
+              return Eac3DrcLine::FILM_LIGHT;
+            }
+            break;
+          case FILM_STANDARD_HASH:
+            if (name == "FILM_STANDARD")
+            {
+              return Eac3DrcLine::FILM_STANDARD;
+            }
+            break;
+          case MUSIC_LIGHT_HASH:
+            if (name == "MUSIC_LIGHT")
+            {
+              return Eac3DrcLine::MUSIC_LIGHT;
+            }
+            break;
+          case MUSIC_STANDARD_HASH:
+            if (name == "MUSIC_STANDARD")
+            {
+              return Eac3DrcLine::MUSIC_STANDARD;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return Eac3DrcLine::NONE;
+            }
+            break;
+          case SPEECH_HASH:
+            if (name == "SPEECH")
+            {
+              return Eac3DrcLine::SPEECH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return Eac3DrcLine::NOT_SET;
         }
 
-        Aws::String GetNameForEac3DrcLine(Eac3DrcLine enumValue)
+        const char* GetNameForEac3DrcLine(Eac3DrcLine enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Eac3LfeControlMapper
       {
 
-        static const int LFE_HASH = HashingUtils::HashString("LFE");
-        static const int NO_LFE_HASH = HashingUtils::HashString("NO_LFE");
+        static constexpr int LFE_HASH = HashingUtils::CompileTimeHashString("LFE");
+        static constexpr int NO_LFE_HASH = HashingUtils::CompileTimeHashString("NO_LFE");
 
 
         Eac3LfeControl GetEac3LfeControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LFE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3LfeControl::LFE;
-          }
-          else if (hashCode == NO_LFE_HASH)
-          {
-            return Eac3LfeControl::NO_LFE;
+          case LFE_HASH:
+            if (name == "LFE")
+            {
+              return Eac3LfeControl::LFE;
+            }
+            break;
+          case NO_LFE_HASH:
+            if (name == "NO_LFE")
+            {
+              return Eac3LfeControl::NO_LFE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Eac3LfeControl::NOT_SET;
         }
 
-        Aws::String GetNameForEac3LfeControl(Eac3LfeControl enumValue)
+        const char* GetNameForEac3LfeControl(Eac3LfeControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace Eac3StereoDownmixMapper
       {
 
-        static const int DPL2_HASH = HashingUtils::HashString("DPL2");
-        static const int LO_RO_HASH = HashingUtils::HashString("LO_RO");
-        static const int LT_RT_HASH = HashingUtils::HashString("LT_RT");
-        static const int NOT_INDICATED_HASH = HashingUtils::HashString("NOT_INDICATED");
+        static constexpr int DPL2_HASH = HashingUtils::CompileTimeHashString("DPL2");
+        static constexpr int LO_RO_HASH = HashingUtils::CompileTimeHashString("LO_RO");
+        static constexpr int LT_RT_HASH = HashingUtils::CompileTimeHashString("LT_RT");
+        static constexpr int NOT_INDICATED_HASH = HashingUtils::CompileTimeHashString("NOT_INDICATED");
 
 
         Eac3StereoDownmix GetEac3StereoDownmixForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DPL2_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3StereoDownmix::DPL2;
-          }
-          else if (hashCode == LO_RO_HASH)
-          {
-            return Eac3StereoDownmix::LO_RO;
-          }
-          else if (hashCode == LT_RT_HASH)
-          {
-            return Eac3StereoDownmix::LT_RT;
-          }
-          else if (hashCode == NOT_INDICATED_HASH)
-          {
-            return Eac3StereoDownmix::NOT_INDICATED;
+          case DPL2_HASH:
+            if (name == "DPL2")
+            {
+              return Eac3StereoDownmix::DPL2;
+            }
+            break;
+          case LO_RO_HASH:
+            if (name == "LO_RO")
+            {
+              return Eac3StereoDownmix::LO_RO;
+            }
+            break;
+          case LT_RT_HASH:
+            if (name == "LT_RT")
+            {
+              return Eac3StereoDownmix::LT_RT;
+            }
+            break;
+          case NOT_INDICATED_HASH:
+            if (name == "NOT_INDICATED")
+            {
+              return Eac3StereoDownmix::NOT_INDICATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return Eac3StereoDownmix::NOT_SET;
         }
 
-        Aws::String GetNameForEac3StereoDownmix(Eac3StereoDownmix enumValue)
+        const char* GetNameForEac3StereoDownmix(Eac3StereoDownmix enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace Eac3SurroundExModeMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int NOT_INDICATED_HASH = HashingUtils::HashString("NOT_INDICATED");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
+        static constexpr int NOT_INDICATED_HASH = HashingUtils::CompileTimeHashString("NOT_INDICATED");
 
 
         Eac3SurroundExMode GetEac3SurroundExModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Eac3SurroundExMode::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
-          {
-            return Eac3SurroundExMode::ENABLED;
-          }
-          else if (hashCode == NOT_INDICATED_HASH)
-          {
-            return Eac3SurroundExMode::NOT_INDICATED;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return Eac3SurroundExMode::DISABLED;
+            }
+            break;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return Eac3SurroundExMode::ENABLED;
+            }
+            break;
+          case NOT_INDICATED_HASH:
+            if (name == "NOT_INDICATED")
+            {
+              return Eac3SurroundExMode::NOT_INDICATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Eac3SurroundExMode::NOT_SET;
         }
 
-        Aws::String GetNameForEac3SurroundExMode(Eac3SurroundExMode enumValue)
+        const char* GetNameForEac3SurroundExMode(Eac3SurroundExMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace EmbeddedScte20DetectionMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int OFF_HASH = HashingUtils::HashString("OFF");
+        static constexpr int AUTO_HASH = HashingUtils::CompileTimeHashString("AUTO");
+        static constexpr int OFF_HASH = HashingUtils::CompileTimeHashString("OFF");
 
 
         EmbeddedScte20Detection GetEmbeddedScte20DetectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EmbeddedScte20Detection::AUTO;
-          }
-          else if (hashCode == OFF_HASH)
-          {
-            return EmbeddedScte20Detection::OFF;
+          case AUTO_HASH:
+            if (name == "AUTO")
+            {
+              return EmbeddedScte20Detection::AUTO;
+            }
+            break;
+          case OFF_HASH:
+            if (name == "OFF")
+            {
+              return EmbeddedScte20Detection::OFF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EmbeddedScte20Detection::NOT_SET;
         }
 
-        Aws::String GetNameForEmbeddedScte20Detection(EmbeddedScte20Detection enumValue)
+        const char* GetNameForEmbeddedScte20Detection(EmbeddedScte20Detection enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace FecOutputIncludeFecMapper
       {
 
-        static const int COLUMN_HASH = HashingUtils::HashString("COLUMN");
-        static const int COLUMN_AND_ROW_HASH = HashingUtils::HashString("COLUMN_AND_ROW");
+        static constexpr int COLUMN_HASH = HashingUtils::CompileTimeHashString("COLUMN");
+        static constexpr int COLUMN_AND_ROW_HASH = HashingUtils::CompileTimeHashString("COLUMN_AND_ROW");
 
 
         FecOutputIncludeFec GetFecOutputIncludeFecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COLUMN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FecOutputIncludeFec::COLUMN;
-          }
-          else if (hashCode == COLUMN_AND_ROW_HASH)
-          {
-            return FecOutputIncludeFec::COLUMN_AND_ROW;
+          case COLUMN_HASH:
+            if (name == "COLUMN")
+            {
+              return FecOutputIncludeFec::COLUMN;
+            }
+            break;
+          case COLUMN_AND_ROW_HASH:
+            if (name == "COLUMN_AND_ROW")
+            {
+              return FecOutputIncludeFec::COLUMN_AND_ROW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FecOutputIncludeFec::NOT_SET;
         }
 
-        Aws::String GetNameForFecOutputIncludeFec(FecOutputIncludeFec enumValue)
+        const char* GetNameForFecOutputIncludeFec(FecOutputIncludeFec enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,65 +30,93 @@ namespace Aws
       namespace FixedAfdMapper
       {
 
-        static const int AFD_0000_HASH = HashingUtils::HashString("AFD_0000");
-        static const int AFD_0010_HASH = HashingUtils::HashString("AFD_0010");
-        static const int AFD_0011_HASH = HashingUtils::HashString("AFD_0011");
-        static const int AFD_0100_HASH = HashingUtils::HashString("AFD_0100");
-        static const int AFD_1000_HASH = HashingUtils::HashString("AFD_1000");
-        static const int AFD_1001_HASH = HashingUtils::HashString("AFD_1001");
-        static const int AFD_1010_HASH = HashingUtils::HashString("AFD_1010");
-        static const int AFD_1011_HASH = HashingUtils::HashString("AFD_1011");
-        static const int AFD_1101_HASH = HashingUtils::HashString("AFD_1101");
-        static const int AFD_1110_HASH = HashingUtils::HashString("AFD_1110");
-        static const int AFD_1111_HASH = HashingUtils::HashString("AFD_1111");
+        static constexpr int AFD_0000_HASH = HashingUtils::CompileTimeHashString("AFD_0000");
+        static constexpr int AFD_0010_HASH = HashingUtils::CompileTimeHashString("AFD_0010");
+        static constexpr int AFD_0011_HASH = HashingUtils::CompileTimeHashString("AFD_0011");
+        static constexpr int AFD_0100_HASH = HashingUtils::CompileTimeHashString("AFD_0100");
+        static constexpr int AFD_1000_HASH = HashingUtils::CompileTimeHashString("AFD_1000");
+        static constexpr int AFD_1001_HASH = HashingUtils::CompileTimeHashString("AFD_1001");
+        static constexpr int AFD_1010_HASH = HashingUtils::CompileTimeHashString("AFD_1010");
+        static constexpr int AFD_1011_HASH = HashingUtils::CompileTimeHashString("AFD_1011");
+        static constexpr int AFD_1101_HASH = HashingUtils::CompileTimeHashString("AFD_1101");
+        static constexpr int AFD_1110_HASH = HashingUtils::CompileTimeHashString("AFD_1110");
+        static constexpr int AFD_1111_HASH = HashingUtils::CompileTimeHashString("AFD_1111");
 
 
         FixedAfd GetFixedAfdForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AFD_0000_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FixedAfd::AFD_0000;
-          }
-          else if (hashCode == AFD_0010_HASH)
-          {
-            return FixedAfd::AFD_0010;
-          }
-          else if (hashCode == AFD_0011_HASH)
-          {
-            return FixedAfd::AFD_0011;
-          }
-          else if (hashCode == AFD_0100_HASH)
-          {
-            return FixedAfd::AFD_0100;
-          }
-          else if (hashCode == AFD_1000_HASH)
-          {
-            return FixedAfd::AFD_1000;
-          }
-          else if (hashCode == AFD_1001_HASH)
-          {
-            return FixedAfd::AFD_1001;
-          }
-          else if (hashCode == AFD_1010_HASH)
-          {
-            return FixedAfd::AFD_1010;
-          }
-          else if (hashCode == AFD_1011_HASH)
-          {
-            return FixedAfd::AFD_1011;
-          }
-          else if (hashCode == AFD_1101_HASH)
-          {
-            return FixedAfd::AFD_1101;
-          }
-          else if (hashCode == AFD_1110_HASH)
-          {
-            return FixedAfd::AFD_1110;
-          }
-          else if (hashCode == AFD_1111_HASH)
-          {
-            return FixedAfd::AFD_1111;
+          case AFD_0000_HASH:
+            if (name == "AFD_0000")
+            {
+              return FixedAfd::AFD_0000;
+            }
+            break;
+          case AFD_0010_HASH:
+            if (name == "AFD_0010")
+            {
+              return FixedAfd::AFD_0010;
+            }
+            break;
+          case AFD_0011_HASH:
+            if (name == "AFD_0011")
+            {
+              return FixedAfd::AFD_0011;
+            }
+            break;
+          case AFD_0100_HASH:
+            if (name == "AFD_0100")
+            {
+              return FixedAfd::AFD_0100;
+            }
+            break;
+          case AFD_1000_HASH:
+            if (name == "AFD_1000")
+            {
+              return FixedAfd::AFD_1000;
+            }
+            break;
+          case AFD_1001_HASH:
+            if (name == "AFD_1001")
+            {
+              return FixedAfd::AFD_1001;
+            }
+            break;
+          case AFD_1010_HASH:
+            if (name == "AFD_1010")
+            {
+              return FixedAfd::AFD_1010;
+            }
+            break;
+          case AFD_1011_HASH:
+            if (name == "AFD_1011")
+            {
+              return FixedAfd::AFD_1011;
+            }
+            break;
+          case AFD_1101_HASH:
+            if (name == "AFD_1101")
+            {
+              return FixedAfd::AFD_1101;
+            }
+            break;
+          case AFD_1110_HASH:
+            if (name == "AFD_1110")
+            {
+              return FixedAfd::AFD_1110;
+            }
+            break;
+          case AFD_1111_HASH:
+            if (name == "AFD_1111")
+            {
+              return FixedAfd::AFD_1111;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return FixedAfd::NOT_SET;
         }
 
-        Aws::String GetNameForFixedAfd(FixedAfd enumValue)
+        const char* GetNameForFixedAfd(FixedAfd enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
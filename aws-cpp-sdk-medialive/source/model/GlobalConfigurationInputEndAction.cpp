@@ -30,20 +30,30 @@ namespace Aws
       namespace GlobalConfigurationInputEndActionMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SWITCH_AND_LOOP_INPUTS_HASH = HashingUtils::HashString("SWITCH_AND_LOOP_INPUTS");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int SWITCH_AND_LOOP_INPUTS_HASH = HashingUtils::CompileTimeHashString("SWITCH_AND_LOOP_INPUTS");
 
 
         GlobalConfigurationInputEndAction GetGlobalConfigurationInputEndActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GlobalConfigurationInputEndAction::NONE;
-          }
-          else if (hashCode == SWITCH_AND_LOOP_INPUTS_HASH)
-          {
-            return GlobalConfigurationInputEndAction::SWITCH_AND_LOOP_INPUTS;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return GlobalConfigurationInputEndAction::NONE;
+            }
+            break;
+          case SWITCH_AND_LOOP_INPUTS_HASH:
+            if (name == "SWITCH_AND_LOOP_INPUTS")
+            {
+              return GlobalConfigurationInputEndAction::SWITCH_AND_LOOP_INPUTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return GlobalConfigurationInputEndAction::NOT_SET;
         }
 
-        Aws::String GetNameForGlobalConfigurationInputEndAction(GlobalConfigurationInputEndAction enumValue)
+        const char* GetNameForGlobalConfigurationInputEndAction(GlobalConfigurationInputEndAction enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace GlobalConfigurationOutputTimingSourceMapper
       {
 
-        static const int INPUT_CLOCK_HASH = HashingUtils::HashString("INPUT_CLOCK");
-        static const int SYSTEM_CLOCK_HASH = HashingUtils::HashString("SYSTEM_CLOCK");
+        static constexpr int INPUT_CLOCK_HASH = HashingUtils::CompileTimeHashString("INPUT_CLOCK");
+        static constexpr int SYSTEM_CLOCK_HASH = HashingUtils::CompileTimeHashString("SYSTEM_CLOCK");
 
 
         GlobalConfigurationOutputTimingSource GetGlobalConfigurationOutputTimingSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INPUT_CLOCK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GlobalConfigurationOutputTimingSource::INPUT_CLOCK;
-          }
-          else if (hashCode == SYSTEM_CLOCK_HASH)
-          {
-            return GlobalConfigurationOutputTimingSource::SYSTEM_CLOCK;
+          case INPUT_CLOCK_HASH:
+            if (name == "INPUT_CLOCK")
+            {
+              return GlobalConfigurationOutputTimingSource::INPUT_CLOCK;
+            }
+            break;
+          case SYSTEM_CLOCK_HASH:
+            if (name == "SYSTEM_CLOCK")
+            {
+              return GlobalConfigurationOutputTimingSource::SYSTEM_CLOCK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return GlobalConfigurationOutputTimingSource::NOT_SET;
         }
 
-        Aws::String GetNameForGlobalConfigurationOutputTimingSource(GlobalConfigurationOutputTimingSource enumValue)
+        const char* GetNameForGlobalConfigurationOutputTimingSource(GlobalConfigurationOutputTimingSource enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace H264ColorMetadataMapper
       {
 
-        static const int IGNORE_HASH = HashingUtils::HashString("IGNORE");
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
+        static constexpr int IGNORE_HASH = HashingUtils::CompileTimeHashString("IGNORE");
+        static constexpr int INSERT_HASH = HashingUtils::CompileTimeHashString("INSERT");
 
 
         H264ColorMetadata GetH264ColorMetadataForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IGNORE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264ColorMetadata::IGNORE;
-          }
-          else if (hashCode == INSERT_HASH)
-          {
-            return H264ColorMetadata::INSERT;
+          case IGNORE_HASH:
+            if (name == "IGNORE")
+            {
+              return H264ColorMetadata::IGNORE;
+            }
+            break;
+          case INSERT_HASH:
+            if (name == "INSERT")
+            {
+              return H264ColorMetadata::INSERT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264ColorMetadata::NOT_SET;
         }
 
-        Aws::String GetNameForH264ColorMetadata(H264ColorMetadata enumValue)
+        const char* GetNameForH264ColorMetadata(H264ColorMetadata enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
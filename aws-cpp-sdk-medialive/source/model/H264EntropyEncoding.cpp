@@ -30,20 +30,30 @@ namespace Aws
       namespace H264EntropyEncodingMapper
       {
 
-        static const int CABAC_HASH = HashingUtils::HashString("CABAC");
-        static const int CAVLC_HASH = HashingUtils::HashString("CAVLC");
+        static constexpr int CABAC_HASH = HashingUtils::CompileTimeHashString("CABAC");
+        static constexpr int CAVLC_HASH = HashingUtils::CompileTimeHashString("CAVLC");
 
 
         H264EntropyEncoding GetH264EntropyEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CABAC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264EntropyEncoding::CABAC;
-          }
-          else if (hashCode == CAVLC_HASH)
-          {
-            return H264EntropyEncoding::CAVLC;
+          case CABAC_HASH:
+            if (name == "CABAC")
+            {
+              return H264EntropyEncoding::CABAC;
+            }
+            break;
+          case CAVLC_HASH:
+            if (name == "CAVLC")
+            {
+              return H264EntropyEncoding::CAVLC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264EntropyEncoding::NOT_SET;
         }
 
-        Aws::String GetNameForH264EntropyEncoding(H264EntropyEncoding enumValue)
+        const char* GetNameForH264EntropyEncoding(H264EntropyEncoding enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace H264GopSizeUnitsMapper
       {
 
-        static const int FRAMES_HASH = HashingUtils::HashString("FRAMES");
-        static const int SECONDS_HASH = HashingUtils::HashString("SECONDS");
+        static constexpr int FRAMES_HASH = HashingUtils::CompileTimeHashString("FRAMES");
+        static constexpr int SECONDS_HASH = HashingUtils::CompileTimeHashString("SECONDS");
 
 
         H264GopSizeUnits GetH264GopSizeUnitsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FRAMES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264GopSizeUnits::FRAMES;
-          }
-          else if (hashCode == SECONDS_HASH)
-          {
-            return H264GopSizeUnits::SECONDS;
+          case FRAMES_HASH:
+            if (name == "FRAMES")
+            {
+              return H264GopSizeUnits::FRAMES;
+            }
+            break;
+          case SECONDS_HASH:
+            if (name == "SECONDS")
+            {
+              return H264GopSizeUnits::SECONDS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264GopSizeUnits::NOT_SET;
         }
 
-        Aws::String GetNameForH264GopSizeUnits(H264GopSizeUnits enumValue)
+        const char* GetNameForH264GopSizeUnits(H264GopSizeUnits enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,95 +30,135 @@ namespace Aws
       namespace H264LevelMapper
       {
 
-        static const int H264_LEVEL_1_HASH = HashingUtils::HashString("H264_LEVEL_1");
-        static const int H264_LEVEL_1_1_HASH = HashingUtils::HashString("H264_LEVEL_1_1");
-        static const int H264_LEVEL_1_2_HASH = HashingUtils::HashString("H264_LEVEL_1_2");
-        static const int H264_LEVEL_1_3_HASH = HashingUtils::HashString("H264_LEVEL_1_3");
-        static const int H264_LEVEL_2_HASH = HashingUtils::HashString("H264_LEVEL_2");
-        static const int H264_LEVEL_2_1_HASH = HashingUtils::HashString("H264_LEVEL_2_1");
-        static const int H264_LEVEL_2_2_HASH = HashingUtils::HashString("H264_LEVEL_2_2");
-        static const int H264_LEVEL_3_HASH = HashingUtils::HashString("H264_LEVEL_3");
-        static const int H264_LEVEL_3_1_HASH = HashingUtils::HashString("H264_LEVEL_3_1");
-        static const int H264_LEVEL_3_2_HASH = HashingUtils::HashString("H264_LEVEL_3_2");
-        static const int H264_LEVEL_4_HASH = HashingUtils::HashString("H264_LEVEL_4");
-        static const int H264_LEVEL_4_1_HASH = HashingUtils::HashString("H264_LEVEL_4_1");
-        static const int H264_LEVEL_4_2_HASH = HashingUtils::HashString("H264_LEVEL_4_2");
-        static const int H264_LEVEL_5_HASH = HashingUtils::HashString("H264_LEVEL_5");
-        static const int H264_LEVEL_5_1_HASH = HashingUtils::HashString("H264_LEVEL_5_1");
-        static const int H264_LEVEL_5_2_HASH = HashingUtils::HashString("H264_LEVEL_5_2");
-        static const int H264_LEVEL_AUTO_HASH = HashingUtils::HashString("H264_LEVEL_AUTO");
+        static constexpr int H264_LEVEL_1_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_1");
+        static constexpr int H264_LEVEL_1_1_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_1_1");
+        static constexpr int H264_LEVEL_1_2_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_1_2");
+        static constexpr int H264_LEVEL_1_3_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_1_3");
+        static constexpr int H264_LEVEL_2_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_2");
+        static constexpr int H264_LEVEL_2_1_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_2_1");
+        static constexpr int H264_LEVEL_2_2_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_2_2");
+        static constexpr int H264_LEVEL_3_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_3");
+        static constexpr int H264_LEVEL_3_1_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_3_1");
+        static constexpr int H264_LEVEL_3_2_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_3_2");
+        static constexpr int H264_LEVEL_4_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_4");
+        static constexpr int H264_LEVEL_4_1_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_4_1");
+        static constexpr int H264_LEVEL_4_2_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_4_2");
+        static constexpr int H264_LEVEL_5_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_5");
+        static constexpr int H264_LEVEL_5_1_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_5_1");
+        static constexpr int H264_LEVEL_5_2_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_5_2");
+        static constexpr int H264_LEVEL_AUTO_HASH = HashingUtils::CompileTimeHashString("H264_LEVEL_AUTO");
 
 
         H264Level GetH264LevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == H264_LEVEL_1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264Level::H264_LEVEL_1;
-          }
-          else if (hashCode == H264_LEVEL_1_1_HASH)
-          {
-            return H264Level::H264_LEVEL_1_1;
-          }
-          else if (hashCode == H264_LEVEL_1_2_HASH)
-          {
-            return H264Level::H264_LEVEL_1_2;
-          }
-          else if (hashCode == H264_LEVEL_1_3_HASH)
-          {
-            return H264Level::H264_LEVEL_1_3;
-          }
-          else if (hashCode == H264_LEVEL_2_HASH)
-          {
-            return H264Level::H264_LEVEL_2;
-          }
-          else if (hashCode == H264_LEVEL_2_1_HASH)
-          {
-            return H264Level::H264_LEVEL_2_1;
-          }
-          else if (hashCode == H264_LEVEL_2_2_HASH)
-          {
-            return H264Level::H264_LEVEL_2_2;
-          }
-          else if (hashCode == H264_LEVEL_3_HASH)
-          {
-            return H264Level::H264_LEVEL_3;
-          }
-          else if (hashCode == H264_LEVEL_3_1_HASH)
-          {
-            return H264Level::H264_LEVEL_3_1;
-          }
-          else if (hashCode == H264_LEVEL_3_2_HASH)
-          {
-            return H264Level::H264_LEVEL_3_2;
-          }
-          else if (hashCode == H264_LEVEL_4_HASH)
-          {
-            return H264Level::H264_LEVEL_4;
-          }
-          else if (hashCode == H264_LEVEL_4_1_HASH)
-          {
-            return H264Level::H264_LEVEL_4_1;
-          }
-          else if (hashCode == H264_LEVEL_4_2_HASH)
-          {
-            return H264Level::H264_LEVEL_4_2;
-          }
-          else if (hashCode == H264_LEVEL_5_HASH)
-          {
-            return H264Level::H264_LEVEL_5;
-          }
-          else if (hashCode == H264_LEVEL_5_1_HASH)
-          {
-            return H264Level::H264_LEVEL_5_1;
-          }
-          else if (hashCode == H264_LEVEL_5_2_HASH)
-          {
-            return H264Level::H264_LEVEL_5_2;
-          }
-          else if (hashCode == H264_LEVEL_AUTO_HASH)
-          {
-            return H264Level::H264_LEVEL_AUTO;
+          case H264_LEVEL_1_HASH:
+            if (name == "H264_LEVEL_1")
+            {
+              return H264Level::H264_LEVEL_1;
+            }
+            break;
+          case H264_LEVEL_1_1_HASH:
+            if (name == "H264_LEVEL_1_1")
+            {
+              return H264Level::H264_LEVEL_1_1;
+            }
+            break;
+          case H264_LEVEL_1_2_HASH:
+            if (name == "H264_LEVEL_1_2")
+            {
+              return H264Level::H264_LEVEL_1_2;
+            }
+            break;
+          case H264_LEVEL_1_3_HASH:
+            if (name == "H264_LEVEL_1_3")
+            {
+              return H264Level::H264_LEVEL_1_3;
+            }
+            break;
+          case H264_LEVEL_2_HASH:
+            if (name == "H264_LEVEL_2")
+            {
+              return H264Level::H264_LEVEL_2;
+            }
+            break;
+          case H264_LEVEL_2_1_HASH:
+            if (name == "H264_LEVEL_2_1")
+            {
+              return H264Level::H264_LEVEL_2_1;
+            }
+            break;
+          case H264_LEVEL_2_2_HASH:
+            if (name == "H264_LEVEL_2_2")
+            {
+              return H264Level::H264_LEVEL_2_2;
+            }
+            break;
+          case H264_LEVEL_3_HASH:
+            if (name == "H264_LEVEL_3")
+            {
+              return H264Level::H264_LEVEL_3;
+            }
+            break;
+          case H264_LEVEL_3_1_HASH:
+            if (name == "H264_LEVEL_3_1")
+            {
+              return H264Level::H264_LEVEL_3_1;
+            }
+            break;
+          case H264_LEVEL_3_2_HASH:
+            if (name == "H264_LEVEL_3_2")
+            {
+              return H264Level::H264_LEVEL_3_2;
+            }
+            break;
+          case H264_LEVEL_4_HASH:
+            if (name == "H264_LEVEL_4")
+            {
+              return H264Level::H264_LEVEL_4;
+            }
+            break;
+          case H264_LEVEL_4_1_HASH:
+            if (name == "H264_LEVEL_4_1")
+            {
+              return H264Level::H264_LEVEL_4_1;
+            }
+            break;
+          case H264_LEVEL_4_2_HASH:
+            if (name == "H264_LEVEL_4_2")
+            {
+              return H264Level::H264_LEVEL_4_2;
+            }
+            break;
+          case H264_LEVEL_5_HASH:
+            if (name == "H264_LEVEL_5")
+            {
+              return H264Level::H264_LEVEL_5;
+            }
+            break;
+          case H264_LEVEL_5_1_HASH:
+            if (name == "H264_LEVEL_5_1")
+            {
+              return H264Level::H264_LEVEL_5_1;
+            }
+            break;
+          case H264_LEVEL_5_2_HASH:
+            if (name == "H264_LEVEL_5_2")
+            {
+              return H264Level::H264_LEVEL_5_2;
+            }
+            break;
+          case H264_LEVEL_AUTO_HASH:
+            if (name == "H264_LEVEL_AUTO")
+            {
+              return H264Level::H264_LEVEL_AUTO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -130,7 +170,7 @@ namespace Aws
           return H264Level::NOT_SET;
         }
 
-        Aws::String GetNameForH264Level(H264Level enumValue)
+        const char* GetNameForH264Level(H264Level enumValue)
         {
           switch(enumValue)
           {
@@ -172,7 +212,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
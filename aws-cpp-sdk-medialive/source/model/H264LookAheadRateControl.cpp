@@ -30,25 +30,37 @@ namespace Aws
       namespace H264LookAheadRateControlMapper
       {
 
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
+        static constexpr int HIGH_HASH = HashingUtils::CompileTimeHashString("HIGH");
+        static constexpr int LOW_HASH = HashingUtils::CompileTimeHashString("LOW");
+        static constexpr int MEDIUM_HASH = HashingUtils::CompileTimeHashString("MEDIUM");
 
 
         H264LookAheadRateControl GetH264LookAheadRateControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HIGH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264LookAheadRateControl::HIGH;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return H264LookAheadRateControl::LOW;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return H264LookAheadRateControl::MEDIUM;
+          case HIGH_HASH:
+            if (name == "HIGH")
+            {
+              return H264LookAheadRateControl::HIGH;
+            }
+            break;
+          case LOW_HASH:
+            if (name == "LOW")
+            {
+              return H264LookAheadRateControl::LOW;
+            }
+            break;
+          case MEDIUM_HASH:
+            if (name == "MEDIUM")
+            {
+              return H264LookAheadRateControl::MEDIUM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return H264LookAheadRateControl::NOT_SET;
         }
 
-        Aws::String GetNameForH264LookAheadRateControl(H264LookAheadRateControl enumValue)
+        const char* GetNameForH264LookAheadRateControl(H264LookAheadRateControl enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
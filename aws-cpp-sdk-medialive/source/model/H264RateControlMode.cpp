@@ -30,20 +30,30 @@ namespace Aws
       namespace H264RateControlModeMapper
       {
 
-        static const int CBR_HASH = HashingUtils::HashString("CBR");
-        static const int VBR_HASH = HashingUtils::HashString("VBR");
+        static constexpr int CBR_HASH = HashingUtils::CompileTimeHashString("CBR");
+        static constexpr int VBR_HASH = HashingUtils::CompileTimeHashString("VBR");
 
 
         H264RateControlMode GetH264RateControlModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CBR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264RateControlMode::CBR;
-          }
-          else if (hashCode == VBR_HASH)
-          {
-            return H264RateControlMode::VBR;
+          case CBR_HASH:
+            if (name == "CBR")
+            {
+              return H264RateControlMode::CBR;
+            }
+            break;
+          case VBR_HASH:
+            if (name == "VBR")
+            {
+              return H264RateControlMode::VBR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264RateControlMode::NOT_SET;
         }
 
-        Aws::String GetNameForH264RateControlMode(H264RateControlMode enumValue)
+        const char* GetNameForH264RateControlMode(H264RateControlMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace H264ScanTypeMapper
       {
 
-        static const int INTERLACED_HASH = HashingUtils::HashString("INTERLACED");
-        static const int PROGRESSIVE_HASH = HashingUtils::HashString("PROGRESSIVE");
+        static constexpr int INTERLACED_HASH = HashingUtils::CompileTimeHashString("INTERLACED");
+        static constexpr int PROGRESSIVE_HASH = HashingUtils::CompileTimeHashString("PROGRESSIVE");
 
 
         H264ScanType GetH264ScanTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INTERLACED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264ScanType::INTERLACED;
-          }
-          else if (hashCode == PROGRESSIVE_HASH)
-          {
-            return H264ScanType::PROGRESSIVE;
+          case INTERLACED_HASH:
+            if (name == "INTERLACED")
+            {
+              return H264ScanType::INTERLACED;
+            }
+            break;
+          case PROGRESSIVE_HASH:
+            if (name == "PROGRESSIVE")
+            {
+              return H264ScanType::PROGRESSIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264ScanType::NOT_SET;
         }
 
-        Aws::String GetNameForH264ScanType(H264ScanType enumValue)
+        const char* GetNameForH264ScanType(H264ScanType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
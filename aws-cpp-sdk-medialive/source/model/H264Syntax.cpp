@@ -30,20 +30,30 @@ namespace Aws
       namespace H264SyntaxMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int RP2027_HASH = HashingUtils::HashString("RP2027");
+        static constexpr int DEFAULT_HASH = HashingUtils::CompileTimeHashString("DEFAULT");
+        static constexpr int RP2027_HASH = HashingUtils::CompileTimeHashString("RP2027");
 
 
         H264Syntax GetH264SyntaxForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264Syntax::DEFAULT;
-          }
-          else if (hashCode == RP2027_HASH)
-          {
-            return H264Syntax::RP2027;
+          case DEFAULT_HASH:
+            if (name == "DEFAULT")
+            {
+              return H264Syntax::DEFAULT;
+            }
+            break;
+          case RP2027_HASH:
+            if (name == "RP2027")
+            {
+              return H264Syntax::RP2027;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264Syntax::NOT_SET;
         }
 
-        Aws::String GetNameForH264Syntax(H264Syntax enumValue)
+        const char* GetNameForH264Syntax(H264Syntax enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace H264TimecodeInsertionBehaviorMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int PIC_TIMING_SEI_HASH = HashingUtils::HashString("PIC_TIMING_SEI");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
+        static constexpr int PIC_TIMING_SEI_HASH = HashingUtils::CompileTimeHashString("PIC_TIMING_SEI");
 
 
         H264TimecodeInsertionBehavior GetH264TimecodeInsertionBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return H264TimecodeInsertionBehavior::DISABLED;
-          }
-          else if (hashCode == PIC_TIMING_SEI_HASH)
-          {
-            return H264TimecodeInsertionBehavior::PIC_TIMING_SEI;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return H264TimecodeInsertionBehavior::DISABLED;
+            }
+            break;
+          case PIC_TIMING_SEI_HASH:
+            if (name == "PIC_TIMING_SEI")
+            {
+              return H264TimecodeInsertionBehavior::PIC_TIMING_SEI;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return H264TimecodeInsertionBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForH264TimecodeInsertionBehavior(H264TimecodeInsertionBehavior enumValue)
+        const char* GetNameForH264TimecodeInsertionBehavior(H264TimecodeInsertionBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
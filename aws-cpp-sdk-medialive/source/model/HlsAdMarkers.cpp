@@ -30,25 +30,37 @@ namespace Aws
       namespace HlsAdMarkersMapper
       {
 
-        static const int ADOBE_HASH = HashingUtils::HashString("ADOBE");
-        static const int ELEMENTAL_HASH = HashingUtils::HashString("ELEMENTAL");
-        static const int ELEMENTAL_SCTE35_HASH = HashingUtils::HashString("ELEMENTAL_SCTE35");
+        static constexpr int ADOBE_HASH = HashingUtils::CompileTimeHashString("ADOBE");
+        static constexpr int ELEMENTAL_HASH = HashingUtils::CompileTimeHashString("ELEMENTAL");
+        static constexpr int ELEMENTAL_SCTE35_HASH = HashingUtils::CompileTimeHashString("ELEMENTAL_SCTE35");
 
 
         HlsAdMarkers GetHlsAdMarkersForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADOBE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsAdMarkers::ADOBE;
-          }
-          else if (hashCode == ELEMENTAL_HASH)
-          {
-            return HlsAdMarkers::ELEMENTAL;
-          }
-          else if (hashCode == ELEMENTAL_SCTE35_HASH)
-          {
-            return HlsAdMarkers::ELEMENTAL_SCTE35;
+          case ADOBE_HASH:
+            if (name == "ADOBE")
+            {
+              return HlsAdMarkers::ADOBE;
+            }
+            break;
+          case ELEMENTAL_HASH:
+            if (name == "ELEMENTAL")
+            {
+              return HlsAdMarkers::ELEMENTAL;
+            }
+            break;
+          case ELEMENTAL_SCTE35_HASH:
+            if (name == "ELEMENTAL_SCTE35")
+            {
+              return HlsAdMarkers::ELEMENTAL_SCTE35;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return HlsAdMarkers::NOT_SET;
         }
 
-        Aws::String GetNameForHlsAdMarkers(HlsAdMarkers enumValue)
+        const char* GetNameForHlsAdMarkers(HlsAdMarkers enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsAkamaiHttpTransferModeMapper
       {
 
-        static const int CHUNKED_HASH = HashingUtils::HashString("CHUNKED");
-        static const int NON_CHUNKED_HASH = HashingUtils::HashString("NON_CHUNKED");
+        static constexpr int CHUNKED_HASH = HashingUtils::CompileTimeHashString("CHUNKED");
+        static constexpr int NON_CHUNKED_HASH = HashingUtils::CompileTimeHashString("NON_CHUNKED");
 
 
         HlsAkamaiHttpTransferMode GetHlsAkamaiHttpTransferModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHUNKED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsAkamaiHttpTransferMode::CHUNKED;
-          }
-          else if (hashCode == NON_CHUNKED_HASH)
-          {
-            return HlsAkamaiHttpTransferMode::NON_CHUNKED;
+          case CHUNKED_HASH:
+            if (name == "CHUNKED")
+            {
+              return HlsAkamaiHttpTransferMode::CHUNKED;
+            }
+            break;
+          case NON_CHUNKED_HASH:
+            if (name == "NON_CHUNKED")
+            {
+              return HlsAkamaiHttpTransferMode::NON_CHUNKED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsAkamaiHttpTransferMode::NOT_SET;
         }
 
-        Aws::String GetNameForHlsAkamaiHttpTransferMode(HlsAkamaiHttpTransferMode enumValue)
+        const char* GetNameForHlsAkamaiHttpTransferMode(HlsAkamaiHttpTransferMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace HlsCaptionLanguageSettingMapper
       {
 
-        static const int INSERT_HASH = HashingUtils::HashString("INSERT");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int OMIT_HASH = HashingUtils::HashString("OMIT");
+        static constexpr int INSERT_HASH = HashingUtils::CompileTimeHashString("INSERT");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int OMIT_HASH = HashingUtils::CompileTimeHashString("OMIT");
 
 
         HlsCaptionLanguageSetting GetHlsCaptionLanguageSettingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSERT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsCaptionLanguageSetting::INSERT;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return HlsCaptionLanguageSetting::NONE;
-          }
-          else if (hashCode == OMIT_HASH)
-          {
-            return HlsCaptionLanguageSetting::OMIT;
+          case INSERT_HASH:
+            if (name == "INSERT")
+            {
+              return HlsCaptionLanguageSetting::INSERT;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return HlsCaptionLanguageSetting::NONE;
+            }
+            break;
+          case OMIT_HASH:
+            if (name == "OMIT")
+            {
+              return HlsCaptionLanguageSetting::OMIT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return HlsCaptionLanguageSetting::NOT_SET;
         }
 
-        Aws::String GetNameForHlsCaptionLanguageSetting(HlsCaptionLanguageSetting enumValue)
+        const char* GetNameForHlsCaptionLanguageSetting(HlsCaptionLanguageSetting enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
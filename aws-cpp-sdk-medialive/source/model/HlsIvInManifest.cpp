@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsIvInManifestMapper
       {
 
-        static const int EXCLUDE_HASH = HashingUtils::HashString("EXCLUDE");
-        static const int INCLUDE_HASH = HashingUtils::HashString("INCLUDE");
+        static constexpr int EXCLUDE_HASH = HashingUtils::CompileTimeHashString("EXCLUDE");
+        static constexpr int INCLUDE_HASH = HashingUtils::CompileTimeHashString("INCLUDE");
 
 
         HlsIvInManifest GetHlsIvInManifestForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXCLUDE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsIvInManifest::EXCLUDE;
-          }
-          else if (hashCode == INCLUDE_HASH)
-          {
-            return HlsIvInManifest::INCLUDE;
+          case EXCLUDE_HASH:
+            if (name == "EXCLUDE")
+            {
+              return HlsIvInManifest::EXCLUDE;
+            }
+            break;
+          case INCLUDE_HASH:
+            if (name == "INCLUDE")
+            {
+              return HlsIvInManifest::INCLUDE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsIvInManifest::NOT_SET;
         }
 
-        Aws::String GetNameForHlsIvInManifest(HlsIvInManifest enumValue)
+        const char* GetNameForHlsIvInManifest(HlsIvInManifest enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
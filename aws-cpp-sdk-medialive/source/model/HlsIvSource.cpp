@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsIvSourceMapper
       {
 
-        static const int EXPLICIT_HASH = HashingUtils::HashString("EXPLICIT");
-        static const int FOLLOWS_SEGMENT_NUMBER_HASH = HashingUtils::HashString("FOLLOWS_SEGMENT_NUMBER");
+        static constexpr int EXPLICIT_HASH = HashingUtils::CompileTimeHashString("EXPLICIT");
+        static constexpr int FOLLOWS_SEGMENT_NUMBER_HASH = HashingUtils::CompileTimeHashString("FOLLOWS_SEGMENT_NUMBER");
 
 
         HlsIvSource GetHlsIvSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXPLICIT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsIvSource::EXPLICIT;
-          }
-          else if (hashCode == FOLLOWS_SEGMENT_NUMBER_HASH)
-          {
-            return HlsIvSource::FOLLOWS_SEGMENT_NUMBER;
+          case EXPLICIT_HASH:
+            if (name == "EXPLICIT")
+            {
+              return HlsIvSource::EXPLICIT;
+            }
+            break;
+          case FOLLOWS_SEGMENT_NUMBER_HASH:
+            if (name == "FOLLOWS_SEGMENT_NUMBER")
+            {
+              return HlsIvSource::FOLLOWS_SEGMENT_NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsIvSource::NOT_SET;
         }
 
-        Aws::String GetNameForHlsIvSource(HlsIvSource enumValue)
+        const char* GetNameForHlsIvSource(HlsIvSource enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsManifestDurationFormatMapper
       {
 
-        static const int FLOATING_POINT_HASH = HashingUtils::HashString("FLOATING_POINT");
-        static const int INTEGER_HASH = HashingUtils::HashString("INTEGER");
+        static constexpr int FLOATING_POINT_HASH = HashingUtils::CompileTimeHashString("FLOATING_POINT");
+        static constexpr int INTEGER_HASH = HashingUtils::CompileTimeHashString("INTEGER");
 
 
         HlsManifestDurationFormat GetHlsManifestDurationFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FLOATING_POINT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsManifestDurationFormat::FLOATING_POINT;
-          }
-          else if (hashCode == INTEGER_HASH)
-          {
-            return HlsManifestDurationFormat::INTEGER;
+          case FLOATING_POINT_HASH:
+            if (name == "FLOATING_POINT")
+            {
+              return HlsManifestDurationFormat::FLOATING_POINT;
+            }
+            break;
+          case INTEGER_HASH:
+            if (name == "INTEGER")
+            {
+              return HlsManifestDurationFormat::INTEGER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsManifestDurationFormat::NOT_SET;
         }
 
-        Aws::String GetNameForHlsManifestDurationFormat(HlsManifestDurationFormat enumValue)
+        const char* GetNameForHlsManifestDurationFormat(HlsManifestDurationFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
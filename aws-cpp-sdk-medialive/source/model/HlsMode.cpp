@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsModeMapper
       {
 
-        static const int LIVE_HASH = HashingUtils::HashString("LIVE");
-        static const int VOD_HASH = HashingUtils::HashString("VOD");
+        static constexpr int LIVE_HASH = HashingUtils::CompileTimeHashString("LIVE");
+        static constexpr int VOD_HASH = HashingUtils::CompileTimeHashString("VOD");
 
 
         HlsMode GetHlsModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsMode::LIVE;
-          }
-          else if (hashCode == VOD_HASH)
-          {
-            return HlsMode::VOD;
+          case LIVE_HASH:
+            if (name == "LIVE")
+            {
+              return HlsMode::LIVE;
+            }
+            break;
+          case VOD_HASH:
+            if (name == "VOD")
+            {
+              return HlsMode::VOD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsMode::NOT_SET;
         }
 
-        Aws::String GetNameForHlsMode(HlsMode enumValue)
+        const char* GetNameForHlsMode(HlsMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsProgramDateTimeMapper
       {
 
-        static const int EXCLUDE_HASH = HashingUtils::HashString("EXCLUDE");
-        static const int INCLUDE_HASH = HashingUtils::HashString("INCLUDE");
+        static constexpr int EXCLUDE_HASH = HashingUtils::CompileTimeHashString("EXCLUDE");
+        static constexpr int INCLUDE_HASH = HashingUtils::CompileTimeHashString("INCLUDE");
 
 
         HlsProgramDateTime GetHlsProgramDateTimeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXCLUDE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsProgramDateTime::EXCLUDE;
-          }
-          else if (hashCode == INCLUDE_HASH)
-          {
-            return HlsProgramDateTime::INCLUDE;
+          case EXCLUDE_HASH:
+            if (name == "EXCLUDE")
+            {
+              return HlsProgramDateTime::EXCLUDE;
+            }
+            break;
+          case INCLUDE_HASH:
+            if (name == "INCLUDE")
+            {
+              return HlsProgramDateTime::INCLUDE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsProgramDateTime::NOT_SET;
         }
 
-        Aws::String GetNameForHlsProgramDateTime(HlsProgramDateTime enumValue)
+        const char* GetNameForHlsProgramDateTime(HlsProgramDateTime enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace HlsTimedMetadataId3FrameMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PRIV_HASH = HashingUtils::HashString("PRIV");
-        static const int TDRL_HASH = HashingUtils::HashString("TDRL");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int PRIV_HASH = HashingUtils::CompileTimeHashString("PRIV");
+        static constexpr int TDRL_HASH = HashingUtils::CompileTimeHashString("TDRL");
 
 
         HlsTimedMetadataId3Frame GetHlsTimedMetadataId3FrameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsTimedMetadataId3Frame::NONE;
-          }
-          else if (hashCode == PRIV_HASH)
-          {
-            return HlsTimedMetadataId3Frame::PRIV;
-          }
-          else if (hashCode == TDRL_HASH)
-          {
-            return HlsTimedMetadataId3Frame::TDRL;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return HlsTimedMetadataId3Frame::NONE;
+            }
+            break;
+          case PRIV_HASH:
+            if (name == "PRIV")
+            {
+              return HlsTimedMetadataId3Frame::PRIV;
+            }
+            break;
+          case TDRL_HASH:
+            if (name == "TDRL")
+            {
+              return HlsTimedMetadataId3Frame::TDRL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return HlsTimedMetadataId3Frame::NOT_SET;
         }
 
-        Aws::String GetNameForHlsTimedMetadataId3Frame(HlsTimedMetadataId3Frame enumValue)
+        const char* GetNameForHlsTimedMetadataId3Frame(HlsTimedMetadataId3Frame enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
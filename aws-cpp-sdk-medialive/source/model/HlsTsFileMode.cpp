@@ -30,20 +30,30 @@ namespace Aws
       namespace HlsTsFileModeMapper
       {
 
-        static const int SEGMENTED_FILES_HASH = HashingUtils::HashString("SEGMENTED_FILES");
-        static const int SINGLE_FILE_HASH = HashingUtils::HashString("SINGLE_FILE");
+        static constexpr int SEGMENTED_FILES_HASH = HashingUtils::CompileTimeHashString("SEGMENTED_FILES");
+        static constexpr int SINGLE_FILE_HASH = HashingUtils::CompileTimeHashString("SINGLE_FILE");
 
 
         HlsTsFileMode GetHlsTsFileModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SEGMENTED_FILES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HlsTsFileMode::SEGMENTED_FILES;
-          }
-          else if (hashCode == SINGLE_FILE_HASH)
-          {
-            return HlsTsFileMode::SINGLE_FILE;
+          case SEGMENTED_FILES_HASH:
+            if (name == "SEGMENTED_FILES")
+            {
+              return HlsTsFileMode::SEGMENTED_FILES;
+            }
+            break;
+          case SINGLE_FILE_HASH:
+            if (name == "SINGLE_FILE")
+            {
+              return HlsTsFileMode::SINGLE_FILE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HlsTsFileMode::NOT_SET;
         }
 
-        Aws::String GetNameForHlsTsFileMode(HlsTsFileMode enumValue)
+        const char* GetNameForHlsTsFileMode(HlsTsFileMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace InputCodecMapper
       {
 
-        static const int MPEG2_HASH = HashingUtils::HashString("MPEG2");
-        static const int AVC_HASH = HashingUtils::HashString("AVC");
-        static const int HEVC_HASH = HashingUtils::HashString("HEVC");
+        static constexpr int MPEG2_HASH = HashingUtils::CompileTimeHashString("MPEG2");
+        static constexpr int AVC_HASH = HashingUtils::CompileTimeHashString("AVC");
+        static constexpr int HEVC_HASH = HashingUtils::CompileTimeHashString("HEVC");
 
 
         InputCodec GetInputCodecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MPEG2_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputCodec::MPEG2;
-          }
-          else if (hashCode == AVC_HASH)
-          {
-            return InputCodec::AVC;
-          }
-          else if (hashCode == HEVC_HASH)
-          {
-            return InputCodec::HEVC;
+          case MPEG2_HASH:
+            if (name == "MPEG2")
+            {
+              return InputCodec::MPEG2;
+            }
+            break;
+          case AVC_HASH:
+            if (name == "AVC")
+            {
+              return InputCodec::AVC;
+            }
+            break;
+          case HEVC_HASH:
+            if (name == "HEVC")
+            {
+              return InputCodec::HEVC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InputCodec::NOT_SET;
         }
 
-        Aws::String GetNameForInputCodec(InputCodec enumValue)
+        const char* GetNameForInputCodec(InputCodec enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace InputFilterMapper
       {
 
-        static const int AUTO_HASH = HashingUtils::HashString("AUTO");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int FORCED_HASH = HashingUtils::HashString("FORCED");
+        static constexpr int AUTO_HASH = HashingUtils::CompileTimeHashString("AUTO");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
+        static constexpr int FORCED_HASH = HashingUtils::CompileTimeHashString("FORCED");
 
 
         InputFilter GetInputFilterForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputFilter::AUTO;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return InputFilter::DISABLED;
-          }
-          else if (hashCode == FORCED_HASH)
-          {
-            return InputFilter::FORCED;
+          case AUTO_HASH:
+            if (name == "AUTO")
+            {
+              return InputFilter::AUTO;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return InputFilter::DISABLED;
+            }
+            break;
+          case FORCED_HASH:
+            if (name == "FORCED")
+            {
+              return InputFilter::FORCED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InputFilter::NOT_SET;
         }
 
-        Aws::String GetNameForInputFilter(InputFilter enumValue)
+        const char* GetNameForInputFilter(InputFilter enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
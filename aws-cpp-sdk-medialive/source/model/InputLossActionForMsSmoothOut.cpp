@@ -30,20 +30,30 @@ namespace Aws
       namespace InputLossActionForMsSmoothOutMapper
       {
 
-        static const int EMIT_OUTPUT_HASH = HashingUtils::HashString("EMIT_OUTPUT");
-        static const int PAUSE_OUTPUT_HASH = HashingUtils::HashString("PAUSE_OUTPUT");
+        static constexpr int EMIT_OUTPUT_HASH = HashingUtils::CompileTimeHashString("EMIT_OUTPUT");
+        static constexpr int PAUSE_OUTPUT_HASH = HashingUtils::CompileTimeHashString("PAUSE_OUTPUT");
 
 
         InputLossActionForMsSmoothOut GetInputLossActionForMsSmoothOutForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMIT_OUTPUT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputLossActionForMsSmoothOut::EMIT_OUTPUT;
-          }
-          else if (hashCode == PAUSE_OUTPUT_HASH)
-          {
-            return InputLossActionForMsSmoothOut::PAUSE_OUTPUT;
+          case EMIT_OUTPUT_HASH:
+            if (name == "EMIT_OUTPUT")
+            {
+              return InputLossActionForMsSmoothOut::EMIT_OUTPUT;
+            }
+            break;
+          case PAUSE_OUTPUT_HASH:
+            if (name == "PAUSE_OUTPUT")
+            {
+              return InputLossActionForMsSmoothOut::PAUSE_OUTPUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InputLossActionForMsSmoothOut::NOT_SET;
         }
 
-        Aws::String GetNameForInputLossActionForMsSmoothOut(InputLossActionForMsSmoothOut enumValue)
+        const char* GetNameForInputLossActionForMsSmoothOut(InputLossActionForMsSmoothOut enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
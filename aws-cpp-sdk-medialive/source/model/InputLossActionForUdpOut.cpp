@@ -30,25 +30,37 @@ namespace Aws
       namespace InputLossActionForUdpOutMapper
       {
 
-        static const int DROP_PROGRAM_HASH = HashingUtils::HashString("DROP_PROGRAM");
-        static const int DROP_TS_HASH = HashingUtils::HashString("DROP_TS");
-        static const int EMIT_PROGRAM_HASH = HashingUtils::HashString("EMIT_PROGRAM");
+        static constexpr int DROP_PROGRAM_HASH = HashingUtils::CompileTimeHashString("DROP_PROGRAM");
+        static constexpr int DROP_TS_HASH = HashingUtils::CompileTimeHashString("DROP_TS");
+        static constexpr int EMIT_PROGRAM_HASH = HashingUtils::CompileTimeHashString("EMIT_PROGRAM");
 
 
         InputLossActionForUdpOut GetInputLossActionForUdpOutForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DROP_PROGRAM_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputLossActionForUdpOut::DROP_PROGRAM;
-          }
-          else if (hashCode == DROP_TS_HASH)
-          {
-            return InputLossActionForUdpOut::DROP_TS;
-          }
-          else if (hashCode == EMIT_PROGRAM_HASH)
-          {
-            return InputLossActionForUdpOut::EMIT_PROGRAM;
+          case DROP_PROGRAM_HASH:
+            if (name == "DROP_PROGRAM")
+            {
+              return InputLossActionForUdpOut::DROP_PROGRAM;
+            }
+            break;
+          case DROP_TS_HASH:
+            if (name == "DROP_TS")
+            {
+              return InputLossActionForUdpOut::DROP_TS;
+            }
+            break;
+          case EMIT_PROGRAM_HASH:
+            if (name == "EMIT_PROGRAM")
+            {
+              return InputLossActionForUdpOut::EMIT_PROGRAM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InputLossActionForUdpOut::NOT_SET;
         }
 
-        Aws::String GetNameForInputLossActionForUdpOut(InputLossActionForUdpOut enumValue)
+        const char* GetNameForInputLossActionForUdpOut(InputLossActionForUdpOut enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace InputLossImageTypeMapper
       {
 
-        static const int COLOR_HASH = HashingUtils::HashString("COLOR");
-        static const int SLATE_HASH = HashingUtils::HashString("SLATE");
+        static constexpr int COLOR_HASH = HashingUtils::CompileTimeHashString("COLOR");
+        static constexpr int SLATE_HASH = HashingUtils::CompileTimeHashString("SLATE");
 
 
         InputLossImageType GetInputLossImageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COLOR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputLossImageType::COLOR;
-          }
-          else if (hashCode == SLATE_HASH)
-          {
-            return InputLossImageType::SLATE;
+          case COLOR_HASH:
+            if (name == "COLOR")
+            {
+              return InputLossImageType::COLOR;
+            }
+            break;
+          case SLATE_HASH:
+            if (name == "SLATE")
+            {
+              return InputLossImageType::SLATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InputLossImageType::NOT_SET;
         }
 
-        Aws::String GetNameForInputLossImageType(InputLossImageType enumValue)
+        const char* GetNameForInputLossImageType(InputLossImageType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
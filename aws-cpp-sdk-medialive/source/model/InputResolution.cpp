@@ -30,25 +30,37 @@ namespace Aws
       namespace InputResolutionMapper
       {
 
-        static const int SD_HASH = HashingUtils::HashString("SD");
-        static const int HD_HASH = HashingUtils::HashString("HD");
-        static const int UHD_HASH = HashingUtils::HashString("UHD");
+        static constexpr int SD_HASH = HashingUtils::CompileTimeHashString("SD");
+        static constexpr int HD_HASH = HashingUtils::CompileTimeHashString("HD");
+        static constexpr int UHD_HASH = HashingUtils::CompileTimeHashString("UHD");
 
 
         InputResolution GetInputResolutionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputResolution::SD;
-          }
-          else if (hashCode == HD_HASH)
-          {
-            return InputResolution::HD;
-          }
-          else if (hashCode == UHD_HASH)
-          {
-            return InputResolution::UHD;
+          case SD_HASH:
+            if (name == "SD")
+            {
+              return InputResolution::SD;
+            }
+            break;
+          case HD_HASH:
+            if (name == "HD")
+            {
+              return InputResolution::HD;
+            }
+            break;
+          case UHD_HASH:
+            if (name == "UHD")
+            {
+              return InputResolution::UHD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InputResolution::NOT_SET;
         }
 
-        Aws::String GetNameForInputResolution(InputResolution enumValue)
+        const char* GetNameForInputResolution(InputResolution enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace InputSecurityGroupStateMapper
       {
 
-        static const int IDLE_HASH = HashingUtils::HashString("IDLE");
-        static const int IN_USE_HASH = HashingUtils::HashString("IN_USE");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int IDLE_HASH = HashingUtils::CompileTimeHashString("IDLE");
+        static constexpr int IN_USE_HASH = HashingUtils::CompileTimeHashString("IN_USE");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         InputSecurityGroupState GetInputSecurityGroupStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IDLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputSecurityGroupState::IDLE;
-          }
-          else if (hashCode == IN_USE_HASH)
-          {
-            return InputSecurityGroupState::IN_USE;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return InputSecurityGroupState::UPDATING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return InputSecurityGroupState::DELETED;
+          case IDLE_HASH:
+            if (name == "IDLE")
+            {
+              return InputSecurityGroupState::IDLE;
+            }
+            break;
+          case IN_USE_HASH:
+            if (name == "IN_USE")
+            {
+              return InputSecurityGroupState::IN_USE;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return InputSecurityGroupState::UPDATING;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return InputSecurityGroupState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return InputSecurityGroupState::NOT_SET;
         }
 
-        Aws::String GetNameForInputSecurityGroupState(InputSecurityGroupState enumValue)
+        const char* GetNameForInputSecurityGroupState(InputSecurityGroupState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace InputSourceEndBehaviorMapper
       {
 
-        static const int CONTINUE_HASH = HashingUtils::HashString("CONTINUE");
-        static const int LOOP_HASH = HashingUtils::HashString("LOOP");
+        static constexpr int CONTINUE_HASH = HashingUtils::CompileTimeHashString("CONTINUE");
+        static constexpr int LOOP_HASH = HashingUtils::CompileTimeHashString("LOOP");
 
 
         InputSourceEndBehavior GetInputSourceEndBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONTINUE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputSourceEndBehavior::CONTINUE;
-          }
-          else if (hashCode == LOOP_HASH)
-          {
-            return InputSourceEndBehavior::LOOP;
+          case CONTINUE_HASH:
+            if (name == "CONTINUE")
+            {
+              return InputSourceEndBehavior::CONTINUE;
+            }
+            break;
+          case LOOP_HASH:
+            if (name == "LOOP")
+            {
+              return InputSourceEndBehavior::LOOP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InputSourceEndBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForInputSourceEndBehavior(InputSourceEndBehavior enumValue)
+        const char* GetNameForInputSourceEndBehavior(InputSourceEndBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace InputStateMapper
       {
 
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DETACHED_HASH = HashingUtils::HashString("DETACHED");
-        static const int ATTACHED_HASH = HashingUtils::HashString("ATTACHED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int DETACHED_HASH = HashingUtils::CompileTimeHashString("DETACHED");
+        static constexpr int ATTACHED_HASH = HashingUtils::CompileTimeHashString("ATTACHED");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         InputState GetInputStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputState::CREATING;
-          }
-          else if (hashCode == DETACHED_HASH)
-          {
-            return InputState::DETACHED;
-          }
-          else if (hashCode == ATTACHED_HASH)
-          {
-            return InputState::ATTACHED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return InputState::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return InputState::DELETED;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return InputState::CREATING;
+            }
+            break;
+          case DETACHED_HASH:
+            if (name == "DETACHED")
+            {
+              return InputState::DETACHED;
+            }
+            break;
+          case ATTACHED_HASH:
+            if (name == "ATTACHED")
+            {
+              return InputState::ATTACHED;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return InputState::DELETING;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return InputState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return InputState::NOT_SET;
         }
 
-        Aws::String GetNameForInputState(InputState enumValue)
+        const char* GetNameForInputState(InputState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
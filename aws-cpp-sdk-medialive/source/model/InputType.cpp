@@ -30,35 +30,51 @@ namespace Aws
       namespace InputTypeMapper
       {
 
-        static const int UDP_PUSH_HASH = HashingUtils::HashString("UDP_PUSH");
-        static const int RTP_PUSH_HASH = HashingUtils::HashString("RTP_PUSH");
-        static const int RTMP_PUSH_HASH = HashingUtils::HashString("RTMP_PUSH");
-        static const int RTMP_PULL_HASH = HashingUtils::HashString("RTMP_PULL");
-        static const int URL_PULL_HASH = HashingUtils::HashString("URL_PULL");
+        static constexpr int UDP_PUSH_HASH = HashingUtils::CompileTimeHashString("UDP_PUSH");
+        static constexpr int RTP_PUSH_HASH = HashingUtils::CompileTimeHashString("RTP_PUSH");
+        static constexpr int RTMP_PUSH_HASH = HashingUtils::CompileTimeHashString("RTMP_PUSH");
+        static constexpr int RTMP_PULL_HASH = HashingUtils::CompileTimeHashString("RTMP_PULL");
+        static constexpr int URL_PULL_HASH = HashingUtils::CompileTimeHashString("URL_PULL");
 
 
         InputType GetInputTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UDP_PUSH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InputType::UDP_PUSH;
-          }
-          else if (hashCode == RTP_PUSH_HASH)
-          {
-            return InputType::RTP_PUSH;
-          }
-          else if (hashCode == RTMP_PUSH_HASH)
-          {
-            return InputType::RTMP_PUSH;
-          }
-          else if (hashCode == RTMP_PULL_HASH)
-          {
-            return InputType::RTMP_PULL;
-          }
-          else if (hashCode == URL_PULL_HASH)
-          {
-            return InputType::URL_PULL;
+          case UDP_PUSH_HASH:
+            if (name == "UDP_PUSH")
+            {
+              return InputType::UDP_PUSH;
+            }
+            break;
+          case RTP_PUSH_HASH:
+            if (name == "RTP_PUSH")
+            {
+              return InputType::RTP_PUSH;
+            }
+            break;
+          case RTMP_PUSH_HASH:
+            if (name == "RTMP_PUSH")
+            {
+              return InputType::RTMP_PUSH;
+            }
+            break;
+          case RTMP_PULL_HASH:
+            if (name == "RTMP_PULL")
+            {
+              return InputType::RTMP_PULL;
+            }
+            break;
+          case URL_PULL_HASH:
+            if (name == "URL_PULL")
+            {
+              return InputType::URL_PULL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return InputType::NOT_SET;
         }
 
-        Aws::String GetNameForInputType(InputType enumValue)
+        const char* GetNameForInputType(InputType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace LogLevelMapper
       {
 
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int WARNING_HASH = HashingUtils::HashString("WARNING");
-        static const int INFO_HASH = HashingUtils::HashString("INFO");
-        static const int DEBUG__HASH = HashingUtils::HashString("DEBUG");
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int WARNING_HASH = HashingUtils::CompileTimeHashString("WARNING");
+        static constexpr int INFO_HASH = HashingUtils::CompileTimeHashString("INFO");
+        static constexpr int DEBUG__HASH = HashingUtils::CompileTimeHashString("DEBUG");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
 
 
         LogLevel GetLogLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ERROR__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LogLevel::ERROR_;
-          }
-          else if (hashCode == WARNING_HASH)
-          {
-            return LogLevel::WARNING;
-          }
-          else if (hashCode == INFO_HASH)
-          {
-            return LogLevel::INFO;
-          }
-          else if (hashCode == DEBUG__HASH)
-          {
-            return LogLevel::DEBUG_;
-          }
-          else if (hashCode == DISABLED_HASH)
-          {
-            return LogLevel::DISABLED;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return LogLevel::ERROR_;
+            }
+            break;
+          case WARNING_HASH:
+            if (name == "WARNING")
+            {
+              return LogLevel::WARNING;
+            }
+            break;
+          case INFO_HASH:
+            if (name == "INFO")
+            {
+              return LogLevel::INFO;
+            }
+            break;
+          case DEBUG__HASH:
+            if (name == "DEBUG")
+            {
+              return LogLevel::DEBUG_;
+            }
+            break;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return LogLevel::DISABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return LogLevel::NOT_SET;
         }
 
-        Aws::String GetNameForLogLevel(LogLevel enumValue)
+        const char* GetNameForLogLevel(LogLevel enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
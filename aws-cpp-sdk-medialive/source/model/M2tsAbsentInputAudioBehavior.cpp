@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsAbsentInputAudioBehaviorMapper
       {
 
-        static const int DROP_HASH = HashingUtils::HashString("DROP");
-        static const int ENCODE_SILENCE_HASH = HashingUtils::HashString("ENCODE_SILENCE");
+        static constexpr int DROP_HASH = HashingUtils::CompileTimeHashString("DROP");
+        static constexpr int ENCODE_SILENCE_HASH = HashingUtils::CompileTimeHashString("ENCODE_SILENCE");
 
 
         M2tsAbsentInputAudioBehavior GetM2tsAbsentInputAudioBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DROP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsAbsentInputAudioBehavior::DROP;
-          }
-          else if (hashCode == ENCODE_SILENCE_HASH)
-          {
-            return M2tsAbsentInputAudioBehavior::ENCODE_SILENCE;
+          case DROP_HASH:
+            if (name == "DROP")
+            {
+              return M2tsAbsentInputAudioBehavior::DROP;
+            }
+            break;
+          case ENCODE_SILENCE_HASH:
+            if (name == "ENCODE_SILENCE")
+            {
+              return M2tsAbsentInputAudioBehavior::ENCODE_SILENCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsAbsentInputAudioBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsAbsentInputAudioBehavior(M2tsAbsentInputAudioBehavior enumValue)
+        const char* GetNameForM2tsAbsentInputAudioBehavior(M2tsAbsentInputAudioBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsAudioStreamTypeMapper
       {
 
-        static const int ATSC_HASH = HashingUtils::HashString("ATSC");
-        static const int DVB_HASH = HashingUtils::HashString("DVB");
+        static constexpr int ATSC_HASH = HashingUtils::CompileTimeHashString("ATSC");
+        static constexpr int DVB_HASH = HashingUtils::CompileTimeHashString("DVB");
 
 
         M2tsAudioStreamType GetM2tsAudioStreamTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ATSC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsAudioStreamType::ATSC;
-          }
-          else if (hashCode == DVB_HASH)
-          {
-            return M2tsAudioStreamType::DVB;
+          case ATSC_HASH:
+            if (name == "ATSC")
+            {
+              return M2tsAudioStreamType::ATSC;
+            }
+            break;
+          case DVB_HASH:
+            if (name == "DVB")
+            {
+              return M2tsAudioStreamType::DVB;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsAudioStreamType::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsAudioStreamType(M2tsAudioStreamType enumValue)
+        const char* GetNameForM2tsAudioStreamType(M2tsAudioStreamType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
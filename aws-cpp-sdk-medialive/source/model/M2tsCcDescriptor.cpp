@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsCcDescriptorMapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
 
 
         M2tsCcDescriptor GetM2tsCcDescriptorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsCcDescriptor::DISABLED;
-          }
-          else if (hashCode == ENABLED_HASH)
-          {
-            return M2tsCcDescriptor::ENABLED;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return M2tsCcDescriptor::DISABLED;
+            }
+            break;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return M2tsCcDescriptor::ENABLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsCcDescriptor::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsCcDescriptor(M2tsCcDescriptor enumValue)
+        const char* GetNameForM2tsCcDescriptor(M2tsCcDescriptor enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsEbifControlMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
 
 
         M2tsEbifControl GetM2tsEbifControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsEbifControl::NONE;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return M2tsEbifControl::PASSTHROUGH;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return M2tsEbifControl::NONE;
+            }
+            break;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return M2tsEbifControl::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsEbifControl::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsEbifControl(M2tsEbifControl enumValue)
+        const char* GetNameForM2tsEbifControl(M2tsEbifControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
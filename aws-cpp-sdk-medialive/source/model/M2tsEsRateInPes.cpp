@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsEsRateInPesMapper
       {
 
-        static const int EXCLUDE_HASH = HashingUtils::HashString("EXCLUDE");
-        static const int INCLUDE_HASH = HashingUtils::HashString("INCLUDE");
+        static constexpr int EXCLUDE_HASH = HashingUtils::CompileTimeHashString("EXCLUDE");
+        static constexpr int INCLUDE_HASH = HashingUtils::CompileTimeHashString("INCLUDE");
 
 
         M2tsEsRateInPes GetM2tsEsRateInPesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXCLUDE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsEsRateInPes::EXCLUDE;
-          }
-          else if (hashCode == INCLUDE_HASH)
-          {
-            return M2tsEsRateInPes::INCLUDE;
+          case EXCLUDE_HASH:
+            if (name == "EXCLUDE")
+            {
+              return M2tsEsRateInPes::EXCLUDE;
+            }
+            break;
+          case INCLUDE_HASH:
+            if (name == "INCLUDE")
+            {
+              return M2tsEsRateInPes::INCLUDE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsEsRateInPes::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsEsRateInPes(M2tsEsRateInPes enumValue)
+        const char* GetNameForM2tsEsRateInPes(M2tsEsRateInPes enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
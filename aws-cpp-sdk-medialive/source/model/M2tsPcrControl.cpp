@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsPcrControlMapper
       {
 
-        static const int CONFIGURED_PCR_PERIOD_HASH = HashingUtils::HashString("CONFIGURED_PCR_PERIOD");
-        static const int PCR_EVERY_PES_PACKET_HASH = HashingUtils::HashString("PCR_EVERY_PES_PACKET");
+        static constexpr int CONFIGURED_PCR_PERIOD_HASH = HashingUtils::CompileTimeHashString("CONFIGURED_PCR_PERIOD");
+        static constexpr int PCR_EVERY_PES_PACKET_HASH = HashingUtils::CompileTimeHashString("PCR_EVERY_PES_PACKET");
 
 
         M2tsPcrControl GetM2tsPcrControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONFIGURED_PCR_PERIOD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsPcrControl::CONFIGURED_PCR_PERIOD;
-          }
-          else if (hashCode == PCR_EVERY_PES_PACKET_HASH)
-          {
-            return M2tsPcrControl::PCR_EVERY_PES_PACKET;
+          case CONFIGURED_PCR_PERIOD_HASH:
+            if (name == "CONFIGURED_PCR_PERIOD")
+            {
+              return M2tsPcrControl::CONFIGURED_PCR_PERIOD;
+            }
+            break;
+          case PCR_EVERY_PES_PACKET_HASH:
+            if (name == "PCR_EVERY_PES_PACKET")
+            {
+              return M2tsPcrControl::PCR_EVERY_PES_PACKET;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsPcrControl::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsPcrControl(M2tsPcrControl enumValue)
+        const char* GetNameForM2tsPcrControl(M2tsPcrControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsRateModeMapper
       {
 
-        static const int CBR_HASH = HashingUtils::HashString("CBR");
-        static const int VBR_HASH = HashingUtils::HashString("VBR");
+        static constexpr int CBR_HASH = HashingUtils::CompileTimeHashString("CBR");
+        static constexpr int VBR_HASH = HashingUtils::CompileTimeHashString("VBR");
 
 
         M2tsRateMode GetM2tsRateModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CBR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsRateMode::CBR;
-          }
-          else if (hashCode == VBR_HASH)
-          {
-            return M2tsRateMode::VBR;
+          case CBR_HASH:
+            if (name == "CBR")
+            {
+              return M2tsRateMode::CBR;
+            }
+            break;
+          case VBR_HASH:
+            if (name == "VBR")
+            {
+              return M2tsRateMode::VBR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsRateMode::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsRateMode(M2tsRateMode enumValue)
+        const char* GetNameForM2tsRateMode(M2tsRateMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
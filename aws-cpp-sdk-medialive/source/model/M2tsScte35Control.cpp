@@ -30,20 +30,30 @@ namespace Aws
       namespace M2tsScte35ControlMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
 
 
         M2tsScte35Control GetM2tsScte35ControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsScte35Control::NONE;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return M2tsScte35Control::PASSTHROUGH;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return M2tsScte35Control::NONE;
+            }
+            break;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return M2tsScte35Control::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M2tsScte35Control::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsScte35Control(M2tsScte35Control enumValue)
+        const char* GetNameForM2tsScte35Control(M2tsScte35Control enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace M2tsSegmentationMarkersMapper
       {
 
-        static const int EBP_HASH = HashingUtils::HashString("EBP");
-        static const int EBP_LEGACY_HASH = HashingUtils::HashString("EBP_LEGACY");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PSI_SEGSTART_HASH = HashingUtils::HashString("PSI_SEGSTART");
-        static const int RAI_ADAPT_HASH = HashingUtils::HashString("RAI_ADAPT");
-        static const int RAI_SEGSTART_HASH = HashingUtils::HashString("RAI_SEGSTART");
+        static constexpr int EBP_HASH = HashingUtils::CompileTimeHashString("EBP");
+        static constexpr int EBP_LEGACY_HASH = HashingUtils::CompileTimeHashString("EBP_LEGACY");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int PSI_SEGSTART_HASH = HashingUtils::CompileTimeHashString("PSI_SEGSTART");
+        static constexpr int RAI_ADAPT_HASH = HashingUtils::CompileTimeHashString("RAI_ADAPT");
+        static constexpr int RAI_SEGSTART_HASH = HashingUtils::CompileTimeHashString("RAI_SEGSTART");
 
 
         M2tsSegmentationMarkers GetM2tsSegmentationMarkersForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EBP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M2tsSegmentationMarkers::EBP;
-          }
-          else if (hashCode == EBP_LEGACY_HASH)
-          {
-            return M2tsSegmentationMarkers::EBP_LEGACY;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return M2tsSegmentationMarkers::NONE;
-          }
-          else if (hashCode == PSI_SEGSTART_HASH)
-          {
-            return M2tsSegmentationMarkers::PSI_SEGSTART;
-          }
-          else if (hashCode == RAI_ADAPT_HASH)
-          {
-            return M2tsSegmentationMarkers::RAI_ADAPT;
-          }
-          else if (hashCode == RAI_SEGSTART_HASH)
-          {
-            return M2tsSegmentationMarkers::RAI_SEGSTART;
+          case EBP_HASH:
+            if (name == "EBP")
+            {
+              return M2tsSegmentationMarkers::EBP;
+            }
+            break;
+          case EBP_LEGACY_HASH:
+            if (name == "EBP_LEGACY")
+            {
+              return M2tsSegmentationMarkers::EBP_LEGACY;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return M2tsSegmentationMarkers::NONE;
+            }
+            break;
+          case PSI_SEGSTART_HASH:
+            if (name == "PSI_SEGSTART")
+            {
+              return M2tsSegmentationMarkers::PSI_SEGSTART;
+            }
+            break;
+          case RAI_ADAPT_HASH:
+            if (name == "RAI_ADAPT")
+            {
+              return M2tsSegmentationMarkers::RAI_ADAPT;
+            }
+            break;
+          case RAI_SEGSTART_HASH:
+            if (name == "RAI_SEGSTART")
+            {
+              return M2tsSegmentationMarkers::RAI_SEGSTART;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return M2tsSegmentationMarkers::NOT_SET;
         }
 
-        Aws::String GetNameForM2tsSegmentationMarkers(M2tsSegmentationMarkers enumValue)
+        const char* GetNameForM2tsSegmentationMarkers(M2tsSegmentationMarkers enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace M3u8TimedMetadataBehaviorMapper
       {
 
-        static const int NO_PASSTHROUGH_HASH = HashingUtils::HashString("NO_PASSTHROUGH");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
+        static constexpr int NO_PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("NO_PASSTHROUGH");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
 
 
         M3u8TimedMetadataBehavior GetM3u8TimedMetadataBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_PASSTHROUGH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return M3u8TimedMetadataBehavior::NO_PASSTHROUGH;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return M3u8TimedMetadataBehavior::PASSTHROUGH;
+          case NO_PASSTHROUGH_HASH:
+            if (name == "NO_PASSTHROUGH")
+            {
+              return M3u8TimedMetadataBehavior::NO_PASSTHROUGH;
+            }
+            break;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return M3u8TimedMetadataBehavior::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return M3u8TimedMetadataBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForM3u8TimedMetadataBehavior(M3u8TimedMetadataBehavior enumValue)
+        const char* GetNameForM3u8TimedMetadataBehavior(M3u8TimedMetadataBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Mp2CodingModeMapper
       {
 
-        static const int CODING_MODE_1_0_HASH = HashingUtils::HashString("CODING_MODE_1_0");
-        static const int CODING_MODE_2_0_HASH = HashingUtils::HashString("CODING_MODE_2_0");
+        static constexpr int CODING_MODE_1_0_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_1_0");
+        static constexpr int CODING_MODE_2_0_HASH = HashingUtils::CompileTimeHashString("CODING_MODE_2_0");
 
 
         Mp2CodingMode GetMp2CodingModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CODING_MODE_1_0_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mp2CodingMode::CODING_MODE_1_0;
-          }
-          else if (hashCode == CODING_MODE_2_0_HASH)
-          {
-            return Mp2CodingMode::CODING_MODE_2_0;
+          case CODING_MODE_1_0_HASH:
+            if (name == "CODING_MODE_1_0")
+            {
+              return Mp2CodingMode::CODING_MODE_1_0;
+            }
+            break;
+          case CODING_MODE_2_0_HASH:
+            if (name == "CODING_MODE_2_0")
+            {
+              return Mp2CodingMode::CODING_MODE_2_0;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Mp2CodingMode::NOT_SET;
         }
 
-        Aws::String GetNameForMp2CodingMode(Mp2CodingMode enumValue)
+        const char* GetNameForMp2CodingMode(Mp2CodingMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace NetworkInputServerValidationMapper
       {
 
-        static const int CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME_HASH = HashingUtils::HashString("CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME");
-        static const int CHECK_CRYPTOGRAPHY_ONLY_HASH = HashingUtils::HashString("CHECK_CRYPTOGRAPHY_ONLY");
+        static constexpr int CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME_HASH = HashingUtils::CompileTimeHashString("CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME");
+        static constexpr int CHECK_CRYPTOGRAPHY_ONLY_HASH = HashingUtils::CompileTimeHashString("CHECK_CRYPTOGRAPHY_ONLY");
 
 
         NetworkInputServerValidation GetNetworkInputServerValidationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME;
-          }
-          else if (hashCode == CHECK_CRYPTOGRAPHY_ONLY_HASH)
-          {
-            return NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_ONLY;
+          case CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME_HASH:
+            if (name == "CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME")
+            {
+              return NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_AND_VALIDATE_NAME;
+            }
+            break;
+          case CHECK_CRYPTOGRAPHY_ONLY_HASH:
+            if (name == "CHECK_CRYPTOGRAPHY_ONLY")
+            {
+              return NetworkInputServerValidation::CHECK_CRYPTOGRAPHY_ONLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return NetworkInputServerValidation::NOT_SET;
         }
 
-        Aws::String GetNameForNetworkInputServerValidation(NetworkInputServerValidation enumValue)
+        const char* GetNameForNetworkInputServerValidation(NetworkInputServerValidation enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
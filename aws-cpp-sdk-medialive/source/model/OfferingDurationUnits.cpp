@@ -30,15 +30,23 @@ namespace Aws
       namespace OfferingDurationUnitsMapper
       {
 
-        static const int MONTHS_HASH = HashingUtils::HashString("MONTHS");
+        static constexpr int MONTHS_HASH = HashingUtils::CompileTimeHashString("MONTHS");
 
 
         OfferingDurationUnits GetOfferingDurationUnitsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MONTHS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OfferingDurationUnits::MONTHS;
+          case MONTHS_HASH:
+            if (name == "MONTHS")
+            {
+              return OfferingDurationUnits::MONTHS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return OfferingDurationUnits::NOT_SET;
         }
 
-        Aws::String GetNameForOfferingDurationUnits(OfferingDurationUnits enumValue)
+        const char* GetNameForOfferingDurationUnits(OfferingDurationUnits enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ReservationCodecMapper
       {
 
-        static const int MPEG2_HASH = HashingUtils::HashString("MPEG2");
-        static const int AVC_HASH = HashingUtils::HashString("AVC");
-        static const int HEVC_HASH = HashingUtils::HashString("HEVC");
-        static const int AUDIO_HASH = HashingUtils::HashString("AUDIO");
+        static constexpr int MPEG2_HASH = HashingUtils::CompileTimeHashString("MPEG2");
+        static constexpr int AVC_HASH = HashingUtils::CompileTimeHashString("AVC");
+        static constexpr int HEVC_HASH = HashingUtils::CompileTimeHashString("HEVC");
+        static constexpr int AUDIO_HASH = HashingUtils::CompileTimeHashString("AUDIO");
 
 
         ReservationCodec GetReservationCodecForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MPEG2_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservationCodec::MPEG2;
-          }
-          else if (hashCode == AVC_HASH)
-          {
-            return ReservationCodec::AVC;
-          }
-          else if (hashCode == HEVC_HASH)
-          {
-            return ReservationCodec::HEVC;
-          }
-          else if (hashCode == AUDIO_HASH)
-          {
-            return ReservationCodec::AUDIO;
+          case MPEG2_HASH:
+            if (name == "MPEG2")
+            {
+              return ReservationCodec::MPEG2;
+            }
+            break;
+          case AVC_HASH:
+            if (name == "AVC")
+            {
+              return ReservationCodec::AVC;
+            }
+            break;
+          case HEVC_HASH:
+            if (name == "HEVC")
+            {
+              return ReservationCodec::HEVC;
+            }
+            break;
+          case AUDIO_HASH:
+            if (name == "AUDIO")
+            {
+              return ReservationCodec::AUDIO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ReservationCodec::NOT_SET;
         }
 
-        Aws::String GetNameForReservationCodec(ReservationCodec enumValue)
+        const char* GetNameForReservationCodec(ReservationCodec enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
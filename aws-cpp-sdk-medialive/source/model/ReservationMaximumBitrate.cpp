@@ -30,25 +30,37 @@ namespace Aws
       namespace ReservationMaximumBitrateMapper
       {
 
-        static const int MAX_10_MBPS_HASH = HashingUtils::HashString("MAX_10_MBPS");
-        static const int MAX_20_MBPS_HASH = HashingUtils::HashString("MAX_20_MBPS");
-        static const int MAX_50_MBPS_HASH = HashingUtils::HashString("MAX_50_MBPS");
+        static constexpr int MAX_10_MBPS_HASH = HashingUtils::CompileTimeHashString("MAX_10_MBPS");
+        static constexpr int MAX_20_MBPS_HASH = HashingUtils::CompileTimeHashString("MAX_20_MBPS");
+        static constexpr int MAX_50_MBPS_HASH = HashingUtils::CompileTimeHashString("MAX_50_MBPS");
 
 
         ReservationMaximumBitrate GetReservationMaximumBitrateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_10_MBPS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservationMaximumBitrate::MAX_10_MBPS;
-          }
-          else if (hashCode == MAX_20_MBPS_HASH)
-          {
-            return ReservationMaximumBitrate::MAX_20_MBPS;
-          }
-          else if (hashCode == MAX_50_MBPS_HASH)
-          {
-            return ReservationMaximumBitrate::MAX_50_MBPS;
+          case MAX_10_MBPS_HASH:
+            if (name == "MAX_10_MBPS")
+            {
+              return ReservationMaximumBitrate::MAX_10_MBPS;
+            }
+            break;
+          case MAX_20_MBPS_HASH:
+            if (name == "MAX_20_MBPS")
+            {
+              return ReservationMaximumBitrate::MAX_20_MBPS;
+            }
+            break;
+          case MAX_50_MBPS_HASH:
+            if (name == "MAX_50_MBPS")
+            {
+              return ReservationMaximumBitrate::MAX_50_MBPS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ReservationMaximumBitrate::NOT_SET;
         }
 
-        Aws::String GetNameForReservationMaximumBitrate(ReservationMaximumBitrate enumValue)
+        const char* GetNameForReservationMaximumBitrate(ReservationMaximumBitrate enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ReservationMaximumFramerateMapper
       {
 
-        static const int MAX_30_FPS_HASH = HashingUtils::HashString("MAX_30_FPS");
-        static const int MAX_60_FPS_HASH = HashingUtils::HashString("MAX_60_FPS");
+        static constexpr int MAX_30_FPS_HASH = HashingUtils::CompileTimeHashString("MAX_30_FPS");
+        static constexpr int MAX_60_FPS_HASH = HashingUtils::CompileTimeHashString("MAX_60_FPS");
 
 
         ReservationMaximumFramerate GetReservationMaximumFramerateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_30_FPS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservationMaximumFramerate::MAX_30_FPS;
-          }
-          else if (hashCode == MAX_60_FPS_HASH)
-          {
-            return ReservationMaximumFramerate::MAX_60_FPS;
+          case MAX_30_FPS_HASH:
+            if (name == "MAX_30_FPS")
+            {
+              return ReservationMaximumFramerate::MAX_30_FPS;
+            }
+            break;
+          case MAX_60_FPS_HASH:
+            if (name == "MAX_60_FPS")
+            {
+              return ReservationMaximumFramerate::MAX_60_FPS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReservationMaximumFramerate::NOT_SET;
         }
 
-        Aws::String GetNameForReservationMaximumFramerate(ReservationMaximumFramerate enumValue)
+        const char* GetNameForReservationMaximumFramerate(ReservationMaximumFramerate enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
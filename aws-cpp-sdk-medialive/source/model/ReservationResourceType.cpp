@@ -30,25 +30,37 @@ namespace Aws
       namespace ReservationResourceTypeMapper
       {
 
-        static const int INPUT_HASH = HashingUtils::HashString("INPUT");
-        static const int OUTPUT_HASH = HashingUtils::HashString("OUTPUT");
-        static const int CHANNEL_HASH = HashingUtils::HashString("CHANNEL");
+        static constexpr int INPUT_HASH = HashingUtils::CompileTimeHashString("INPUT");
+        static constexpr int OUTPUT_HASH = HashingUtils::CompileTimeHashString("OUTPUT");
+        static constexpr int CHANNEL_HASH = HashingUtils::CompileTimeHashString("CHANNEL");
 
 
         ReservationResourceType GetReservationResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INPUT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservationResourceType::INPUT;
-          }
-          else if (hashCode == OUTPUT_HASH)
-          {
-            return ReservationResourceType::OUTPUT;
-          }
-          else if (hashCode == CHANNEL_HASH)
-          {
-            return ReservationResourceType::CHANNEL;
+          case INPUT_HASH:
+            if (name == "INPUT")
+            {
+              return ReservationResourceType::INPUT;
+            }
+            break;
+          case OUTPUT_HASH:
+            if (name == "OUTPUT")
+            {
+              return ReservationResourceType::OUTPUT;
+            }
+            break;
+          case CHANNEL_HASH:
+            if (name == "CHANNEL")
+            {
+              return ReservationResourceType::CHANNEL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ReservationResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForReservationResourceType(ReservationResourceType enumValue)
+        const char* GetNameForReservationResourceType(ReservationResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ReservationSpecialFeatureMapper
       {
 
-        static const int ADVANCED_AUDIO_HASH = HashingUtils::HashString("ADVANCED_AUDIO");
-        static const int AUDIO_NORMALIZATION_HASH = HashingUtils::HashString("AUDIO_NORMALIZATION");
+        static constexpr int ADVANCED_AUDIO_HASH = HashingUtils::CompileTimeHashString("ADVANCED_AUDIO");
+        static constexpr int AUDIO_NORMALIZATION_HASH = HashingUtils::CompileTimeHashString("AUDIO_NORMALIZATION");
 
 
         ReservationSpecialFeature GetReservationSpecialFeatureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADVANCED_AUDIO_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservationSpecialFeature::ADVANCED_AUDIO;
-          }
-          else if (hashCode == AUDIO_NORMALIZATION_HASH)
-          {
-            return ReservationSpecialFeature::AUDIO_NORMALIZATION;
+          case ADVANCED_AUDIO_HASH:
+            if (name == "ADVANCED_AUDIO")
+            {
+              return ReservationSpecialFeature::ADVANCED_AUDIO;
+            }
+            break;
+          case AUDIO_NORMALIZATION_HASH:
+            if (name == "AUDIO_NORMALIZATION")
+            {
+              return ReservationSpecialFeature::AUDIO_NORMALIZATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReservationSpecialFeature::NOT_SET;
         }
 
-        Aws::String GetNameForReservationSpecialFeature(ReservationSpecialFeature enumValue)
+        const char* GetNameForReservationSpecialFeature(ReservationSpecialFeature enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ReservationStateMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int EXPIRED_HASH = HashingUtils::CompileTimeHashString("EXPIRED");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         ReservationState GetReservationStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservationState::ACTIVE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return ReservationState::EXPIRED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return ReservationState::CANCELED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ReservationState::DELETED;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ReservationState::ACTIVE;
+            }
+            break;
+          case EXPIRED_HASH:
+            if (name == "EXPIRED")
+            {
+              return ReservationState::EXPIRED;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return ReservationState::CANCELED;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return ReservationState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ReservationState::NOT_SET;
         }
 
-        Aws::String GetNameForReservationState(ReservationState enumValue)
+        const char* GetNameForReservationState(ReservationState enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
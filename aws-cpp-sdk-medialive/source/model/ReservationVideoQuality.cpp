@@ -30,25 +30,37 @@ namespace Aws
       namespace ReservationVideoQualityMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int ENHANCED_HASH = HashingUtils::HashString("ENHANCED");
-        static const int PREMIUM_HASH = HashingUtils::HashString("PREMIUM");
+        static constexpr int STANDARD_HASH = HashingUtils::CompileTimeHashString("STANDARD");
+        static constexpr int ENHANCED_HASH = HashingUtils::CompileTimeHashString("ENHANCED");
+        static constexpr int PREMIUM_HASH = HashingUtils::CompileTimeHashString("PREMIUM");
 
 
         ReservationVideoQuality GetReservationVideoQualityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservationVideoQuality::STANDARD;
-          }
-          else if (hashCode == ENHANCED_HASH)
-          {
-            return ReservationVideoQuality::ENHANCED;
-          }
-          else if (hashCode == PREMIUM_HASH)
-          {
-            return ReservationVideoQuality::PREMIUM;
+          case STANDARD_HASH:
+            if (name == "STANDARD")
+            {
+              return ReservationVideoQuality::STANDARD;
+            }
+            break;
+          case ENHANCED_HASH:
+            if (name == "ENHANCED")
+            {
+              return ReservationVideoQuality::ENHANCED;
+            }
+            break;
+          case PREMIUM_HASH:
+            if (name == "PREMIUM")
+            {
+              return ReservationVideoQuality::PREMIUM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ReservationVideoQuality::NOT_SET;
         }
 
-        Aws::String GetNameForReservationVideoQuality(ReservationVideoQuality enumValue)
+        const char* GetNameForReservationVideoQuality(ReservationVideoQuality enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
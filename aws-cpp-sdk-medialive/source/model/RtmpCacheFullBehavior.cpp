@@ -30,20 +30,30 @@ namespace Aws
       namespace RtmpCacheFullBehaviorMapper
       {
 
-        static const int DISCONNECT_IMMEDIATELY_HASH = HashingUtils::HashString("DISCONNECT_IMMEDIATELY");
-        static const int WAIT_FOR_SERVER_HASH = HashingUtils::HashString("WAIT_FOR_SERVER");
+        static constexpr int DISCONNECT_IMMEDIATELY_HASH = HashingUtils::CompileTimeHashString("DISCONNECT_IMMEDIATELY");
+        static constexpr int WAIT_FOR_SERVER_HASH = HashingUtils::CompileTimeHashString("WAIT_FOR_SERVER");
 
 
         RtmpCacheFullBehavior GetRtmpCacheFullBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISCONNECT_IMMEDIATELY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RtmpCacheFullBehavior::DISCONNECT_IMMEDIATELY;
-          }
-          else if (hashCode == WAIT_FOR_SERVER_HASH)
-          {
-            return RtmpCacheFullBehavior::WAIT_FOR_SERVER;
+          case DISCONNECT_IMMEDIATELY_HASH:
+            if (name == "DISCONNECT_IMMEDIATELY")
+            {
+              return RtmpCacheFullBehavior::DISCONNECT_IMMEDIATELY;
+            }
+            break;
+          case WAIT_FOR_SERVER_HASH:
+            if (name == "WAIT_FOR_SERVER")
+            {
+              return RtmpCacheFullBehavior::WAIT_FOR_SERVER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RtmpCacheFullBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForRtmpCacheFullBehavior(RtmpCacheFullBehavior enumValue)
+        const char* GetNameForRtmpCacheFullBehavior(RtmpCacheFullBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
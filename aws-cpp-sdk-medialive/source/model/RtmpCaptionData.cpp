@@ -30,25 +30,37 @@ namespace Aws
       namespace RtmpCaptionDataMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int FIELD1_608_HASH = HashingUtils::HashString("FIELD1_608");
-        static const int FIELD1_AND_FIELD2_608_HASH = HashingUtils::HashString("FIELD1_AND_FIELD2_608");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
+        static constexpr int FIELD1_608_HASH = HashingUtils::CompileTimeHashString("FIELD1_608");
+        static constexpr int FIELD1_AND_FIELD2_608_HASH = HashingUtils::CompileTimeHashString("FIELD1_AND_FIELD2_608");
 
 
         RtmpCaptionData GetRtmpCaptionDataForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RtmpCaptionData::ALL;
-          }
-          else if (hashCode == FIELD1_608_HASH)
-          {
-            return RtmpCaptionData::FIELD1_608;
-          }
-          else if (hashCode == FIELD1_AND_FIELD2_608_HASH)
-          {
-            return RtmpCaptionData::FIELD1_AND_FIELD2_608;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return RtmpCaptionData::ALL;
+            }
+            break;
+          case FIELD1_608_HASH:
+            if (name == "FIELD1_608")
+            {
+              return RtmpCaptionData::FIELD1_608;
+            }
+            break;
+          case FIELD1_AND_FIELD2_608_HASH:
+            if (name == "FIELD1_AND_FIELD2_608")
+            {
+              return RtmpCaptionData::FIELD1_AND_FIELD2_608;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RtmpCaptionData::NOT_SET;
         }
 
-        Aws::String GetNameForRtmpCaptionData(RtmpCaptionData enumValue)
+        const char* GetNameForRtmpCaptionData(RtmpCaptionData enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
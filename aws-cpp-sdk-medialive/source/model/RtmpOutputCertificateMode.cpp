@@ -30,20 +30,30 @@ namespace Aws
       namespace RtmpOutputCertificateModeMapper
       {
 
-        static const int SELF_SIGNED_HASH = HashingUtils::HashString("SELF_SIGNED");
-        static const int VERIFY_AUTHENTICITY_HASH = HashingUtils::HashString("VERIFY_AUTHENTICITY");
+        static constexpr int SELF_SIGNED_HASH = HashingUtils::CompileTimeHashString("SELF_SIGNED");
+        static constexpr int VERIFY_AUTHENTICITY_HASH = HashingUtils::CompileTimeHashString("VERIFY_AUTHENTICITY");
 
 
         RtmpOutputCertificateMode GetRtmpOutputCertificateModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SELF_SIGNED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RtmpOutputCertificateMode::SELF_SIGNED;
-          }
-          else if (hashCode == VERIFY_AUTHENTICITY_HASH)
-          {
-            return RtmpOutputCertificateMode::VERIFY_AUTHENTICITY;
+          case SELF_SIGNED_HASH:
+            if (name == "SELF_SIGNED")
+            {
+              return RtmpOutputCertificateMode::SELF_SIGNED;
+            }
+            break;
+          case VERIFY_AUTHENTICITY_HASH:
+            if (name == "VERIFY_AUTHENTICITY")
+            {
+              return RtmpOutputCertificateMode::VERIFY_AUTHENTICITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RtmpOutputCertificateMode::NOT_SET;
         }
 
-        Aws::String GetNameForRtmpOutputCertificateMode(RtmpOutputCertificateMode enumValue)
+        const char* GetNameForRtmpOutputCertificateMode(RtmpOutputCertificateMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace Scte20Convert608To708Mapper
       {
 
-        static const int DISABLED_HASH = HashingUtils::HashString("DISABLED");
-        static const int UPCONVERT_HASH = HashingUtils::HashString("UPCONVERT");
+        static constexpr int DISABLED_HASH = HashingUtils::CompileTimeHashString("DISABLED");
+        static constexpr int UPCONVERT_HASH = HashingUtils::CompileTimeHashString("UPCONVERT");
 
 
         Scte20Convert608To708 GetScte20Convert608To708ForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Scte20Convert608To708::DISABLED;
-          }
-          else if (hashCode == UPCONVERT_HASH)
-          {
-            return Scte20Convert608To708::UPCONVERT;
+          case DISABLED_HASH:
+            if (name == "DISABLED")
+            {
+              return Scte20Convert608To708::DISABLED;
+            }
+            break;
+          case UPCONVERT_HASH:
+            if (name == "UPCONVERT")
+            {
+              return Scte20Convert608To708::UPCONVERT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Scte20Convert608To708::NOT_SET;
         }
 
-        Aws::String GetNameForScte20Convert608To708(Scte20Convert608To708 enumValue)
+        const char* GetNameForScte20Convert608To708(Scte20Convert608To708 enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
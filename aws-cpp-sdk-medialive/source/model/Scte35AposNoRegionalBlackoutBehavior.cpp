@@ -30,20 +30,30 @@ namespace Aws
       namespace Scte35AposNoRegionalBlackoutBehaviorMapper
       {
 
-        static const int FOLLOW_HASH = HashingUtils::HashString("FOLLOW");
-        static const int IGNORE_HASH = HashingUtils::HashString("IGNORE");
+        static constexpr int FOLLOW_HASH = HashingUtils::CompileTimeHashString("FOLLOW");
+        static constexpr int IGNORE_HASH = HashingUtils::CompileTimeHashString("IGNORE");
 
 
         Scte35AposNoRegionalBlackoutBehavior GetScte35AposNoRegionalBlackoutBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Scte35AposNoRegionalBlackoutBehavior::FOLLOW;
-          }
-          else if (hashCode == IGNORE_HASH)
-          {
-            return Scte35AposNoRegionalBlackoutBehavior::IGNORE;
+          case FOLLOW_HASH:
+            if (name == "FOLLOW")
+            {
+              return Scte35AposNoRegionalBlackoutBehavior::FOLLOW;
+            }
+            break;
+          case IGNORE_HASH:
+            if (name == "IGNORE")
+            {
+              return Scte35AposNoRegionalBlackoutBehavior::IGNORE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Scte35AposNoRegionalBlackoutBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForScte35AposNoRegionalBlackoutBehavior(Scte35AposNoRegionalBlackoutBehavior enumValue)
+        const char* GetNameForScte35AposNoRegionalBlackoutBehavior(Scte35AposNoRegionalBlackoutBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
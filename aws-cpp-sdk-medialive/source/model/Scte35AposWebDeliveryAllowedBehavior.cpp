@@ -30,20 +30,30 @@ namespace Aws
       namespace Scte35AposWebDeliveryAllowedBehaviorMapper
       {
 
-        static const int FOLLOW_HASH = HashingUtils::HashString("FOLLOW");
-        static const int IGNORE_HASH = HashingUtils::HashString("IGNORE");
+        static constexpr int FOLLOW_HASH = HashingUtils::CompileTimeHashString("FOLLOW");
+        static constexpr int IGNORE_HASH = HashingUtils::CompileTimeHashString("IGNORE");
 
 
         Scte35AposWebDeliveryAllowedBehavior GetScte35AposWebDeliveryAllowedBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Scte35AposWebDeliveryAllowedBehavior::FOLLOW;
-          }
-          else if (hashCode == IGNORE_HASH)
-          {
-            return Scte35AposWebDeliveryAllowedBehavior::IGNORE;
+          case FOLLOW_HASH:
+            if (name == "FOLLOW")
+            {
+              return Scte35AposWebDeliveryAllowedBehavior::FOLLOW;
+            }
+            break;
+          case IGNORE_HASH:
+            if (name == "IGNORE")
+            {
+              return Scte35AposWebDeliveryAllowedBehavior::IGNORE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Scte35AposWebDeliveryAllowedBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForScte35AposWebDeliveryAllowedBehavior(Scte35AposWebDeliveryAllowedBehavior enumValue)
+        const char* GetNameForScte35AposWebDeliveryAllowedBehavior(Scte35AposWebDeliveryAllowedBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SmoothGroupAudioOnlyTimecodeControlMapper
       {
 
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-        static const int USE_CONFIGURED_CLOCK_HASH = HashingUtils::HashString("USE_CONFIGURED_CLOCK");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
+        static constexpr int USE_CONFIGURED_CLOCK_HASH = HashingUtils::CompileTimeHashString("USE_CONFIGURED_CLOCK");
 
 
         SmoothGroupAudioOnlyTimecodeControl GetSmoothGroupAudioOnlyTimecodeControlForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PASSTHROUGH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SmoothGroupAudioOnlyTimecodeControl::PASSTHROUGH;
-          }
-          else if (hashCode == USE_CONFIGURED_CLOCK_HASH)
-          {
-            return SmoothGroupAudioOnlyTimecodeControl::USE_CONFIGURED_CLOCK;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return SmoothGroupAudioOnlyTimecodeControl::PASSTHROUGH;
+            }
+            break;
+          case USE_CONFIGURED_CLOCK_HASH:
+            if (name == "USE_CONFIGURED_CLOCK")
+            {
+              return SmoothGroupAudioOnlyTimecodeControl::USE_CONFIGURED_CLOCK;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SmoothGroupAudioOnlyTimecodeControl::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupAudioOnlyTimecodeControl(SmoothGroupAudioOnlyTimecodeControl enumValue)
+        const char* GetNameForSmoothGroupAudioOnlyTimecodeControl(SmoothGroupAudioOnlyTimecodeControl enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
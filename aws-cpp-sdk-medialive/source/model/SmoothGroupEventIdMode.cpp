@@ -30,25 +30,37 @@ namespace Aws
       namespace SmoothGroupEventIdModeMapper
       {
 
-        static const int NO_EVENT_ID_HASH = HashingUtils::HashString("NO_EVENT_ID");
-        static const int USE_CONFIGURED_HASH = HashingUtils::HashString("USE_CONFIGURED");
-        static const int USE_TIMESTAMP_HASH = HashingUtils::HashString("USE_TIMESTAMP");
+        static constexpr int NO_EVENT_ID_HASH = HashingUtils::CompileTimeHashString("NO_EVENT_ID");
+        static constexpr int USE_CONFIGURED_HASH = HashingUtils::CompileTimeHashString("USE_CONFIGURED");
+        static constexpr int USE_TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("USE_TIMESTAMP");
 
 
         SmoothGroupEventIdMode GetSmoothGroupEventIdModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NO_EVENT_ID_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SmoothGroupEventIdMode::NO_EVENT_ID;
-          }
-          else if (hashCode == USE_CONFIGURED_HASH)
-          {
-            return SmoothGroupEventIdMode::USE_CONFIGURED;
-          }
-          else if (hashCode == USE_TIMESTAMP_HASH)
-          {
-            return SmoothGroupEventIdMode::USE_TIMESTAMP;
+          case NO_EVENT_ID_HASH:
+            if (name == "NO_EVENT_ID")
+            {
+              return SmoothGroupEventIdMode::NO_EVENT_ID;
+            }
+            break;
+          case USE_CONFIGURED_HASH:
+            if (name == "USE_CONFIGURED")
+            {
+              return SmoothGroupEventIdMode::USE_CONFIGURED;
+            }
+            break;
+          case USE_TIMESTAMP_HASH:
+            if (name == "USE_TIMESTAMP")
+            {
+              return SmoothGroupEventIdMode::USE_TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return SmoothGroupEventIdMode::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupEventIdMode(SmoothGroupEventIdMode enumValue)
+        const char* GetNameForSmoothGroupEventIdMode(SmoothGroupEventIdMode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SmoothGroupEventStopBehaviorMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SEND_EOS_HASH = HashingUtils::HashString("SEND_EOS");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int SEND_EOS_HASH = HashingUtils::CompileTimeHashString("SEND_EOS");
 
 
         SmoothGroupEventStopBehavior GetSmoothGroupEventStopBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SmoothGroupEventStopBehavior::NONE;
-          }
-          else if (hashCode == SEND_EOS_HASH)
-          {
-            return SmoothGroupEventStopBehavior::SEND_EOS;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return SmoothGroupEventStopBehavior::NONE;
+            }
+            break;
+          case SEND_EOS_HASH:
+            if (name == "SEND_EOS")
+            {
+              return SmoothGroupEventStopBehavior::SEND_EOS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SmoothGroupEventStopBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupEventStopBehavior(SmoothGroupEventStopBehavior enumValue)
+        const char* GetNameForSmoothGroupEventStopBehavior(SmoothGroupEventStopBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SmoothGroupSegmentationModeMapper
       {
 
-        static const int USE_INPUT_SEGMENTATION_HASH = HashingUtils::HashString("USE_INPUT_SEGMENTATION");
-        static const int USE_SEGMENT_DURATION_HASH = HashingUtils::HashString("USE_SEGMENT_DURATION");
+        static constexpr int USE_INPUT_SEGMENTATION_HASH = HashingUtils::CompileTimeHashString("USE_INPUT_SEGMENTATION");
+        static constexpr int USE_SEGMENT_DURATION_HASH = HashingUtils::CompileTimeHashString("USE_SEGMENT_DURATION");
 
 
         SmoothGroupSegmentationMode GetSmoothGroupSegmentationModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USE_INPUT_SEGMENTATION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SmoothGroupSegmentationMode::USE_INPUT_SEGMENTATION;
-          }
-          else if (hashCode == USE_SEGMENT_DURATION_HASH)
-          {
-            return SmoothGroupSegmentationMode::USE_SEGMENT_DURATION;
+          case USE_INPUT_SEGMENTATION_HASH:
+            if (name == "USE_INPUT_SEGMENTATION")
+            {
+              return SmoothGroupSegmentationMode::USE_INPUT_SEGMENTATION;
+            }
+            break;
+          case USE_SEGMENT_DURATION_HASH:
+            if (name == "USE_SEGMENT_DURATION")
+            {
+              return SmoothGroupSegmentationMode::USE_SEGMENT_DURATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SmoothGroupSegmentationMode::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupSegmentationMode(SmoothGroupSegmentationMode enumValue)
+        const char* GetNameForSmoothGroupSegmentationMode(SmoothGroupSegmentationMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
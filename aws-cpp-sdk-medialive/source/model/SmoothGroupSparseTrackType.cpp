@@ -30,20 +30,30 @@ namespace Aws
       namespace SmoothGroupSparseTrackTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SCTE_35_HASH = HashingUtils::HashString("SCTE_35");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int SCTE_35_HASH = HashingUtils::CompileTimeHashString("SCTE_35");
 
 
         SmoothGroupSparseTrackType GetSmoothGroupSparseTrackTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SmoothGroupSparseTrackType::NONE;
-          }
-          else if (hashCode == SCTE_35_HASH)
-          {
-            return SmoothGroupSparseTrackType::SCTE_35;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return SmoothGroupSparseTrackType::NONE;
+            }
+            break;
+          case SCTE_35_HASH:
+            if (name == "SCTE_35")
+            {
+              return SmoothGroupSparseTrackType::SCTE_35;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SmoothGroupSparseTrackType::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupSparseTrackType(SmoothGroupSparseTrackType enumValue)
+        const char* GetNameForSmoothGroupSparseTrackType(SmoothGroupSparseTrackType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SmoothGroupStreamManifestBehaviorMapper
       {
 
-        static const int DO_NOT_SEND_HASH = HashingUtils::HashString("DO_NOT_SEND");
-        static const int SEND_HASH = HashingUtils::HashString("SEND");
+        static constexpr int DO_NOT_SEND_HASH = HashingUtils::CompileTimeHashString("DO_NOT_SEND");
+        static constexpr int SEND_HASH = HashingUtils::CompileTimeHashString("SEND");
 
 
         SmoothGroupStreamManifestBehavior GetSmoothGroupStreamManifestBehaviorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DO_NOT_SEND_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SmoothGroupStreamManifestBehavior::DO_NOT_SEND;
-          }
-          else if (hashCode == SEND_HASH)
-          {
-            return SmoothGroupStreamManifestBehavior::SEND;
+          case DO_NOT_SEND_HASH:
+            if (name == "DO_NOT_SEND")
+            {
+              return SmoothGroupStreamManifestBehavior::DO_NOT_SEND;
+            }
+            break;
+          case SEND_HASH:
+            if (name == "SEND")
+            {
+              return SmoothGroupStreamManifestBehavior::SEND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SmoothGroupStreamManifestBehavior::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupStreamManifestBehavior(SmoothGroupStreamManifestBehavior enumValue)
+        const char* GetNameForSmoothGroupStreamManifestBehavior(SmoothGroupStreamManifestBehavior enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
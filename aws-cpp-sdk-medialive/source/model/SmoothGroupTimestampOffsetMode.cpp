@@ -30,20 +30,30 @@ namespace Aws
       namespace SmoothGroupTimestampOffsetModeMapper
       {
 
-        static const int USE_CONFIGURED_OFFSET_HASH = HashingUtils::HashString("USE_CONFIGURED_OFFSET");
-        static const int USE_EVENT_START_DATE_HASH = HashingUtils::HashString("USE_EVENT_START_DATE");
+        static constexpr int USE_CONFIGURED_OFFSET_HASH = HashingUtils::CompileTimeHashString("USE_CONFIGURED_OFFSET");
+        static constexpr int USE_EVENT_START_DATE_HASH = HashingUtils::CompileTimeHashString("USE_EVENT_START_DATE");
 
 
         SmoothGroupTimestampOffsetMode GetSmoothGroupTimestampOffsetModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USE_CONFIGURED_OFFSET_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SmoothGroupTimestampOffsetMode::USE_CONFIGURED_OFFSET;
-          }
-          else if (hashCode == USE_EVENT_START_DATE_HASH)
-          {
-            return SmoothGroupTimestampOffsetMode::USE_EVENT_START_DATE;
+          case USE_CONFIGURED_OFFSET_HASH:
+            if (name == "USE_CONFIGURED_OFFSET")
+            {
+              return SmoothGroupTimestampOffsetMode::USE_CONFIGURED_OFFSET;
+            }
+            break;
+          case USE_EVENT_START_DATE_HASH:
+            if (name == "USE_EVENT_START_DATE")
+            {
+              return SmoothGroupTimestampOffsetMode::USE_EVENT_START_DATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SmoothGroupTimestampOffsetMode::NOT_SET;
         }
 
-        Aws::String GetNameForSmoothGroupTimestampOffsetMode(SmoothGroupTimestampOffsetMode enumValue)
+        const char* GetNameForSmoothGroupTimestampOffsetMode(SmoothGroupTimestampOffsetMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
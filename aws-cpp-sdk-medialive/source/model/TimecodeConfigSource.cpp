@@ -30,25 +30,37 @@ namespace Aws
       namespace TimecodeConfigSourceMapper
       {
 
-        static const int EMBEDDED_HASH = HashingUtils::HashString("EMBEDDED");
-        static const int SYSTEMCLOCK_HASH = HashingUtils::HashString("SYSTEMCLOCK");
-        static const int ZEROBASED_HASH = HashingUtils::HashString("ZEROBASED");
+        static constexpr int EMBEDDED_HASH = HashingUtils::CompileTimeHashString("EMBEDDED");
+        static constexpr int SYSTEMCLOCK_HASH = HashingUtils::CompileTimeHashString("SYSTEMCLOCK");
+        static constexpr int ZEROBASED_HASH = HashingUtils::CompileTimeHashString("ZEROBASED");
 
 
         TimecodeConfigSource GetTimecodeConfigSourceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EMBEDDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TimecodeConfigSource::EMBEDDED;
-          }
-          else if (hashCode == SYSTEMCLOCK_HASH)
-          {
-            return TimecodeConfigSource::SYSTEMCLOCK;
-          }
-          else if (hashCode == ZEROBASED_HASH)
-          {
-            return TimecodeConfigSource::ZEROBASED;
+          case EMBEDDED_HASH:
+            if (name == "EMBEDDED")
+            {
+              return TimecodeConfigSource::EMBEDDED;
+            }
+            break;
+          case SYSTEMCLOCK_HASH:
+            if (name == "SYSTEMCLOCK")
+            {
+              return TimecodeConfigSource::SYSTEMCLOCK;
+            }
+            break;
+          case ZEROBASED_HASH:
+            if (name == "ZEROBASED")
+            {
+              return TimecodeConfigSource::ZEROBASED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TimecodeConfigSource::NOT_SET;
         }
 
-        Aws::String GetNameForTimecodeConfigSource(TimecodeConfigSource enumValue)
+        const char* GetNameForTimecodeConfigSource(TimecodeConfigSource enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
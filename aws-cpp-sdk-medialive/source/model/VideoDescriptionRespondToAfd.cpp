@@ -30,25 +30,37 @@ namespace Aws
       namespace VideoDescriptionRespondToAfdMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
-        static const int RESPOND_HASH = HashingUtils::HashString("RESPOND");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
+        static constexpr int RESPOND_HASH = HashingUtils::CompileTimeHashString("RESPOND");
 
 
         VideoDescriptionRespondToAfd GetVideoDescriptionRespondToAfdForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VideoDescriptionRespondToAfd::NONE;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return VideoDescriptionRespondToAfd::PASSTHROUGH;
-          }
-          else if (hashCode == RESPOND_HASH)
-          {
-            return VideoDescriptionRespondToAfd::RESPOND;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return VideoDescriptionRespondToAfd::NONE;
+            }
+            break;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return VideoDescriptionRespondToAfd::PASSTHROUGH;
+            }
+            break;
+          case RESPOND_HASH:
+            if (name == "RESPOND")
+            {
+              return VideoDescriptionRespondToAfd::RESPOND;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return VideoDescriptionRespondToAfd::NOT_SET;
         }
 
-        Aws::String GetNameForVideoDescriptionRespondToAfd(VideoDescriptionRespondToAfd enumValue)
+        const char* GetNameForVideoDescriptionRespondToAfd(VideoDescriptionRespondToAfd enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace VideoSelectorColorSpaceMapper
       {
 
-        static const int FOLLOW_HASH = HashingUtils::HashString("FOLLOW");
-        static const int REC_601_HASH = HashingUtils::HashString("REC_601");
-        static const int REC_709_HASH = HashingUtils::HashString("REC_709");
+        static constexpr int FOLLOW_HASH = HashingUtils::CompileTimeHashString("FOLLOW");
+        static constexpr int REC_601_HASH = HashingUtils::CompileTimeHashString("REC_601");
+        static constexpr int REC_709_HASH = HashingUtils::CompileTimeHashString("REC_709");
 
 
         VideoSelectorColorSpace GetVideoSelectorColorSpaceForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLLOW_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VideoSelectorColorSpace::FOLLOW;
-          }
-          else if (hashCode == REC_601_HASH)
-          {
-            return VideoSelectorColorSpace::REC_601;
-          }
-          else if (hashCode == REC_709_HASH)
-          {
-            return VideoSelectorColorSpace::REC_709;
+          case FOLLOW_HASH:
+            if (name == "FOLLOW")
+            {
+              return VideoSelectorColorSpace::FOLLOW;
+            }
+            break;
+          case REC_601_HASH:
+            if (name == "REC_601")
+            {
+              return VideoSelectorColorSpace::REC_601;
+            }
+            break;
+          case REC_709_HASH:
+            if (name == "REC_709")
+            {
+              return VideoSelectorColorSpace::REC_709;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return VideoSelectorColorSpace::NOT_SET;
         }
 
-        Aws::String GetNameForVideoSelectorColorSpace(VideoSelectorColorSpace enumValue)
+        const char* GetNameForVideoSelectorColorSpace(VideoSelectorColorSpace enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace VideoSelectorColorSpaceUsageMapper
       {
 
-        static const int FALLBACK_HASH = HashingUtils::HashString("FALLBACK");
-        static const int FORCE_HASH = HashingUtils::HashString("FORCE");
+        static constexpr int FALLBACK_HASH = HashingUtils::CompileTimeHashString("FALLBACK");
+        static constexpr int FORCE_HASH = HashingUtils::CompileTimeHashString("FORCE");
 
 
         VideoSelectorColorSpaceUsage GetVideoSelectorColorSpaceUsageForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FALLBACK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VideoSelectorColorSpaceUsage::FALLBACK;
-          }
-          else if (hashCode == FORCE_HASH)
-          {
-            return VideoSelectorColorSpaceUsage::FORCE;
+          case FALLBACK_HASH:
+            if (name == "FALLBACK")
+            {
+              return VideoSelectorColorSpaceUsage::FALLBACK;
+            }
+            break;
+          case FORCE_HASH:
+            if (name == "FORCE")
+            {
+              return VideoSelectorColorSpaceUsage::FORCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return VideoSelectorColorSpaceUsage::NOT_SET;
         }
 
-        Aws::String GetNameForVideoSelectorColorSpaceUsage(VideoSelectorColorSpaceUsage enumValue)
+        const char* GetNameForVideoSelectorColorSpaceUsage(VideoSelectorColorSpaceUsage enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace AdMarkersMapper
 {
 AWS_MEDIAPACKAGE_API AdMarkers GetAdMarkersForName(const Aws::String& name);
 
-AWS_MEDIAPACKAGE_API Aws::String GetNameForAdMarkers(AdMarkers value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIAPACKAGE_API const char* GetNameForAdMarkers(AdMarkers value);
 } // namespace AdMarkersMapper
 } // namespace Model
 } // namespace MediaPackage
@@ -34,7 +34,8 @@ namespace EncryptionMethodMapper
 {
 AWS_MEDIAPACKAGE_API EncryptionMethod GetEncryptionMethodForName(const Aws::String& name);
 
-AWS_MEDIAPACKAGE_API Aws::String GetNameForEncryptionMethod(EncryptionMethod value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIAPACKAGE_API const char* GetNameForEncryptionMethod(EncryptionMethod value);
 } // namespace EncryptionMethodMapper
 } // namespace Model
 } // namespace MediaPackage
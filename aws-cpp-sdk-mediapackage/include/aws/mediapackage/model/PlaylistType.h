@@ -35,7 +35,8 @@ namespace PlaylistTypeMapper
 {
 AWS_MEDIAPACKAGE_API PlaylistType GetPlaylistTypeForName(const Aws::String& name);
 
-AWS_MEDIAPACKAGE_API Aws::String GetNameForPlaylistType(PlaylistType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIAPACKAGE_API const char* GetNameForPlaylistType(PlaylistType value);
 } // namespace PlaylistTypeMapper
 } // namespace Model
 } // namespace MediaPackage
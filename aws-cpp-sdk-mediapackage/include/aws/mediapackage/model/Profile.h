@@ -34,7 +34,8 @@ namespace ProfileMapper
 {
 AWS_MEDIAPACKAGE_API Profile GetProfileForName(const Aws::String& name);
 
-AWS_MEDIAPACKAGE_API Aws::String GetNameForProfile(Profile value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIAPACKAGE_API const char* GetNameForProfile(Profile value);
 } // namespace ProfileMapper
 } // namespace Model
 } // namespace MediaPackage
@@ -35,7 +35,8 @@ namespace StreamOrderMapper
 {
 AWS_MEDIAPACKAGE_API StreamOrder GetStreamOrderForName(const Aws::String& name);
 
-AWS_MEDIAPACKAGE_API Aws::String GetNameForStreamOrder(StreamOrder value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIAPACKAGE_API const char* GetNameForStreamOrder(StreamOrder value);
 } // namespace StreamOrderMapper
 } // namespace Model
 } // namespace MediaPackage
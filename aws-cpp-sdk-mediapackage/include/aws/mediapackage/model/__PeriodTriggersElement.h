@@ -33,7 +33,8 @@ namespace __PeriodTriggersElementMapper
 {
 AWS_MEDIAPACKAGE_API __PeriodTriggersElement Get__PeriodTriggersElementForName(const Aws::String& name);
 
-AWS_MEDIAPACKAGE_API Aws::String GetNameFor__PeriodTriggersElement(__PeriodTriggersElement value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIAPACKAGE_API const char* GetNameFor__PeriodTriggersElement(__PeriodTriggersElement value);
 } // namespace __PeriodTriggersElementMapper
 } // namespace Model
 } // namespace MediaPackage
@@ -30,25 +30,37 @@ namespace Aws
       namespace AdMarkersMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int SCTE35_ENHANCED_HASH = HashingUtils::HashString("SCTE35_ENHANCED");
-        static const int PASSTHROUGH_HASH = HashingUtils::HashString("PASSTHROUGH");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int SCTE35_ENHANCED_HASH = HashingUtils::CompileTimeHashString("SCTE35_ENHANCED");
+        static constexpr int PASSTHROUGH_HASH = HashingUtils::CompileTimeHashString("PASSTHROUGH");
 
 
         AdMarkers GetAdMarkersForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AdMarkers::NONE;
-          }
-          else if (hashCode == SCTE35_ENHANCED_HASH)
-          {
-            return AdMarkers::SCTE35_ENHANCED;
-          }
-          else if (hashCode == PASSTHROUGH_HASH)
-          {
-            return AdMarkers::PASSTHROUGH;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return AdMarkers::NONE;
+            }
+            break;
+          case SCTE35_ENHANCED_HASH:
+            if (name == "SCTE35_ENHANCED")
+            {
+              return AdMarkers::SCTE35_ENHANCED;
+            }
+            break;
+          case PASSTHROUGH_HASH:
+            if (name == "PASSTHROUGH")
+            {
+              return AdMarkers::PASSTHROUGH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AdMarkers::NOT_SET;
         }
 
-        Aws::String GetNameForAdMarkers(AdMarkers enumValue)
+        const char* GetNameForAdMarkers(AdMarkers enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
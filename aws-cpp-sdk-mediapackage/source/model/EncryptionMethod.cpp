@@ -30,20 +30,30 @@ namespace Aws
       namespace EncryptionMethodMapper
       {
 
-        static const int AES_128_HASH = HashingUtils::HashString("AES_128");
-        static const int SAMPLE_AES_HASH = HashingUtils::HashString("SAMPLE_AES");
+        static constexpr int AES_128_HASH = HashingUtils::CompileTimeHashString("AES_128");
+        static constexpr int SAMPLE_AES_HASH = HashingUtils::CompileTimeHashString("SAMPLE_AES");
 
 
         EncryptionMethod GetEncryptionMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES_128_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EncryptionMethod::AES_128;
-          }
-          else if (hashCode == SAMPLE_AES_HASH)
-          {
-            return EncryptionMethod::SAMPLE_AES;
+          case AES_128_HASH:
+            if (name == "AES_128")
+            {
+              return EncryptionMethod::AES_128;
+            }
+            break;
+          case SAMPLE_AES_HASH:
+            if (name == "SAMPLE_AES")
+            {
+              return EncryptionMethod::SAMPLE_AES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EncryptionMethod::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionMethod(EncryptionMethod enumValue)
+        const char* GetNameForEncryptionMethod(EncryptionMethod enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace PlaylistTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int EVENT_HASH = HashingUtils::HashString("EVENT");
-        static const int VOD_HASH = HashingUtils::HashString("VOD");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int EVENT_HASH = HashingUtils::CompileTimeHashString("EVENT");
+        static constexpr int VOD_HASH = HashingUtils::CompileTimeHashString("VOD");
 
 
         PlaylistType GetPlaylistTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlaylistType::NONE;
-          }
-          else if (hashCode == EVENT_HASH)
-          {
-            return PlaylistType::EVENT;
-          }
-          else if (hashCode == VOD_HASH)
-          {
-            return PlaylistType::VOD;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return PlaylistType::NONE;
+            }
+            break;
+          case EVENT_HASH:
+            if (name == "EVENT")
+            {
+              return PlaylistType::EVENT;
+            }
+            break;
+          case VOD_HASH:
+            if (name == "VOD")
+            {
+              return PlaylistType::VOD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PlaylistType::NOT_SET;
         }
 
-        Aws::String GetNameForPlaylistType(PlaylistType enumValue)
+        const char* GetNameForPlaylistType(PlaylistType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
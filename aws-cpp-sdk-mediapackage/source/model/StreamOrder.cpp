@@ -30,25 +30,37 @@ namespace Aws
       namespace StreamOrderMapper
       {
 
-        static const int ORIGINAL_HASH = HashingUtils::HashString("ORIGINAL");
-        static const int VIDEO_BITRATE_ASCENDING_HASH = HashingUtils::HashString("VIDEO_BITRATE_ASCENDING");
-        static const int VIDEO_BITRATE_DESCENDING_HASH = HashingUtils::HashString("VIDEO_BITRATE_DESCENDING");
+        static constexpr int ORIGINAL_HASH = HashingUtils::CompileTimeHashString("ORIGINAL");
+        static constexpr int VIDEO_BITRATE_ASCENDING_HASH = HashingUtils::CompileTimeHashString("VIDEO_BITRATE_ASCENDING");
+        static constexpr int VIDEO_BITRATE_DESCENDING_HASH = HashingUtils::CompileTimeHashString("VIDEO_BITRATE_DESCENDING");
 
 
         StreamOrder GetStreamOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ORIGINAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StreamOrder::ORIGINAL;
-          }
-          else if (hashCode == VIDEO_BITRATE_ASCENDING_HASH)
-          {
-            return StreamOrder::VIDEO_BITRATE_ASCENDING;
-          }
-          else if (hashCode == VIDEO_BITRATE_DESCENDING_HASH)
-          {
-            return StreamOrder::VIDEO_BITRATE_DESCENDING;
+          case ORIGINAL_HASH:
+            if (name == "ORIGINAL")
+            {
+              return StreamOrder::ORIGINAL;
+            }
+            break;
+          case VIDEO_BITRATE_ASCENDING_HASH:
+            if (name == "VIDEO_BITRATE_ASCENDING")
+            {
+              return StreamOrder::VIDEO_BITRATE_ASCENDING;
+            }
+            break;
+          case VIDEO_BITRATE_DESCENDING_HASH:
+            if (name == "VIDEO_BITRATE_DESCENDING")
+            {
+              return StreamOrder::VIDEO_BITRATE_DESCENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return StreamOrder::NOT_SET;
         }
 
-        Aws::String GetNameForStreamOrder(StreamOrder enumValue)
+        const char* GetNameForStreamOrder(StreamOrder enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace __PeriodTriggersElementMapper
       {
 
-        static const int ADS_HASH = HashingUtils::HashString("ADS");
+        static constexpr int ADS_HASH = HashingUtils::CompileTimeHashString("ADS");
 
 
         __PeriodTriggersElement Get__PeriodTriggersElementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return __PeriodTriggersElement::ADS;
+          case ADS_HASH:
+            if (name == "ADS")
+            {
+              return __PeriodTriggersElement::ADS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return __PeriodTriggersElement::NOT_SET;
         }
 
-        Aws::String GetNameFor__PeriodTriggersElement(__PeriodTriggersElement enumValue)
+        const char* GetNameFor__PeriodTriggersElement(__PeriodTriggersElement enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
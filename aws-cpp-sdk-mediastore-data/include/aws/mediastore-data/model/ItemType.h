@@ -34,7 +34,8 @@ namespace ItemTypeMapper
 {
 AWS_MEDIASTOREDATA_API ItemType GetItemTypeForName(const Aws::String& name);
 
-AWS_MEDIASTOREDATA_API Aws::String GetNameForItemType(ItemType value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIASTOREDATA_API const char* GetNameForItemType(ItemType value);
 } // namespace ItemTypeMapper
 } // namespace Model
 } // namespace MediaStoreData
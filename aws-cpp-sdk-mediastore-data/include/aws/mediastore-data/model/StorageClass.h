@@ -33,7 +33,8 @@ namespace StorageClassMapper
 {
 AWS_MEDIASTOREDATA_API StorageClass GetStorageClassForName(const Aws::String& name);
 
-AWS_MEDIASTOREDATA_API Aws::String GetNameForStorageClass(StorageClass value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIASTOREDATA_API const char* GetNameForStorageClass(StorageClass value);
 } // namespace StorageClassMapper
 } // namespace Model
 } // namespace MediaStoreData
@@ -28,9 +28,9 @@ namespace MediaStoreData
 namespace MediaStoreDataErrorMapper
 {
 
-static const int REQUESTED_RANGE_NOT_SATISFIABLE_HASH = HashingUtils::HashString("RequestedRangeNotSatisfiableException");
-static const int OBJECT_NOT_FOUND_HASH = HashingUtils::HashString("ObjectNotFoundException");
-static const int CONTAINER_NOT_FOUND_HASH = HashingUtils::HashString("ContainerNotFoundException");
+static constexpr int REQUESTED_RANGE_NOT_SATISFIABLE_HASH = HashingUtils::CompileTimeHashString("RequestedRangeNotSatisfiableException");
+static constexpr int OBJECT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ObjectNotFoundException");
+static constexpr int CONTAINER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ContainerNotFoundException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace ItemTypeMapper
       {
 
-        static const int OBJECT_HASH = HashingUtils::HashString("OBJECT");
-        static const int FOLDER_HASH = HashingUtils::HashString("FOLDER");
+        static constexpr int OBJECT_HASH = HashingUtils::CompileTimeHashString("OBJECT");
+        static constexpr int FOLDER_HASH = HashingUtils::CompileTimeHashString("FOLDER");
 
 
         ItemType GetItemTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OBJECT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ItemType::OBJECT;
-          }
-          else if (hashCode == FOLDER_HASH)
-          {
-            return ItemType::FOLDER;
+          case OBJECT_HASH:
+            if (name == "OBJECT")
+            {
+              return ItemType::OBJECT;
+            }
+            break;
+          case FOLDER_HASH:
+            if (name == "FOLDER")
+            {
+              return ItemType::FOLDER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ItemType::NOT_SET;
         }
 
-        Aws::String GetNameForItemType(ItemType enumValue)
+        const char* GetNameForItemType(ItemType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace StorageClassMapper
       {
 
-        static const int TEMPORAL_HASH = HashingUtils::HashString("TEMPORAL");
+        static constexpr int TEMPORAL_HASH = HashingUtils::CompileTimeHashString("TEMPORAL");
 
 
         StorageClass GetStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TEMPORAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StorageClass::TEMPORAL;
+          case TEMPORAL_HASH:
+            if (name == "TEMPORAL")
+            {
+              return StorageClass::TEMPORAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return StorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForStorageClass(StorageClass enumValue)
+        const char* GetNameForStorageClass(StorageClass enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
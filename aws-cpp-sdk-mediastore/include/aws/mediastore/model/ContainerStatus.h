@@ -35,7 +35,8 @@ namespace ContainerStatusMapper
 {
 AWS_MEDIASTORE_API ContainerStatus GetContainerStatusForName(const Aws::String& name);
 
-AWS_MEDIASTORE_API Aws::String GetNameForContainerStatus(ContainerStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIASTORE_API const char* GetNameForContainerStatus(ContainerStatus value);
 } // namespace ContainerStatusMapper
 } // namespace Model
 } // namespace MediaStore
@@ -36,7 +36,8 @@ namespace MethodNameMapper
 {
 AWS_MEDIASTORE_API MethodName GetMethodNameForName(const Aws::String& name);
 
-AWS_MEDIASTORE_API Aws::String GetNameForMethodName(MethodName value);
+// names of values not modeled point into the enum overflow container
+AWS_MEDIASTORE_API const char* GetNameForMethodName(MethodName value);
 } // namespace MethodNameMapper
 } // namespace Model
 } // namespace MediaStore
@@ -28,11 +28,11 @@ namespace MediaStore
 namespace MediaStoreErrorMapper
 {
 
-static const int CONTAINER_IN_USE_HASH = HashingUtils::HashString("ContainerInUseException");
-static const int POLICY_NOT_FOUND_HASH = HashingUtils::HashString("PolicyNotFoundException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int CONTAINER_NOT_FOUND_HASH = HashingUtils::HashString("ContainerNotFoundException");
-static const int CORS_POLICY_NOT_FOUND_HASH = HashingUtils::HashString("CorsPolicyNotFoundException");
+static constexpr int CONTAINER_IN_USE_HASH = HashingUtils::CompileTimeHashString("ContainerInUseException");
+static constexpr int POLICY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("PolicyNotFoundException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int CONTAINER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ContainerNotFoundException");
+static constexpr int CORS_POLICY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("CorsPolicyNotFoundException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
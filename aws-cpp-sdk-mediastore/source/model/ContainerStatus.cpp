@@ -30,25 +30,37 @@ namespace Aws
       namespace ContainerStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
 
 
         ContainerStatus GetContainerStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContainerStatus::ACTIVE;
-          }
-          else if (hashCode == CREATING_HASH)
-          {
-            return ContainerStatus::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ContainerStatus::DELETING;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ContainerStatus::ACTIVE;
+            }
+            break;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return ContainerStatus::CREATING;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ContainerStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ContainerStatus::NOT_SET;
         }
 
-        Aws::String GetNameForContainerStatus(ContainerStatus enumValue)
+        const char* GetNameForContainerStatus(ContainerStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace MethodNameMapper
       {
 
-        static const int PUT_HASH = HashingUtils::HashString("PUT");
-        static const int GET__HASH = HashingUtils::HashString("GET");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-        static const int HEAD_HASH = HashingUtils::HashString("HEAD");
+        static constexpr int PUT_HASH = HashingUtils::CompileTimeHashString("PUT");
+        static constexpr int GET__HASH = HashingUtils::CompileTimeHashString("GET");
+        static constexpr int DELETE__HASH = HashingUtils::CompileTimeHashString("DELETE");
+        static constexpr int HEAD_HASH = HashingUtils::CompileTimeHashString("HEAD");
 
 
         MethodName GetMethodNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MethodName::PUT;
-          }
-          else if (hashCode == GET__HASH)
-          {
-            return MethodName::GET_;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return MethodName::DELETE_;
-          }
-          else if (hashCode == HEAD_HASH)
-          {
-            return MethodName::HEAD;
+          case PUT_HASH:
+            if (name == "PUT")
+            {
+              return MethodName::PUT;
+            }
+            break;
+          case GET__HASH:
+            if (name == "GET")
+            {
+              return MethodName::GET_;
+            }
+            break;
+          case DELETE__HASH:
+            if (name == "DELETE")
+            {
+              return MethodName::DELETE_;
+            }
+            break;
+          case HEAD_HASH:
+            if (name == "HEAD")
+            {
+              return MethodName::HEAD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return MethodName::NOT_SET;
         }
 
-        Aws::String GetNameForMethodName(MethodName enumValue)
+        const char* GetNameForMethodName(MethodName enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -35,7 +35,8 @@ namespace UsageRecordResultStatusMapper
 {
 AWS_MARKETPLACEMETERING_API UsageRecordResultStatus GetUsageRecordResultStatusForName(const Aws::String& name);
 
-AWS_MARKETPLACEMETERING_API Aws::String GetNameForUsageRecordResultStatus(UsageRecordResultStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MARKETPLACEMETERING_API const char* GetNameForUsageRecordResultStatus(UsageRecordResultStatus value);
 } // namespace UsageRecordResultStatusMapper
 } // namespace Model
 } // namespace MarketplaceMetering
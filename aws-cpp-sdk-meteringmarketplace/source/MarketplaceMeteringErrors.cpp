@@ -28,15 +28,15 @@ namespace MarketplaceMetering
 namespace MarketplaceMeteringErrorMapper
 {
 
-static const int INVALID_TOKEN_HASH = HashingUtils::HashString("InvalidTokenException");
-static const int TIMESTAMP_OUT_OF_BOUNDS_HASH = HashingUtils::HashString("TimestampOutOfBoundsException");
-static const int EXPIRED_TOKEN_HASH = HashingUtils::HashString("ExpiredTokenException");
-static const int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::HashString("InternalServiceErrorException");
-static const int INVALID_USAGE_DIMENSION_HASH = HashingUtils::HashString("InvalidUsageDimensionException");
-static const int INVALID_PRODUCT_CODE_HASH = HashingUtils::HashString("InvalidProductCodeException");
-static const int DUPLICATE_REQUEST_HASH = HashingUtils::HashString("DuplicateRequestException");
-static const int INVALID_CUSTOMER_IDENTIFIER_HASH = HashingUtils::HashString("InvalidCustomerIdentifierException");
-static const int INVALID_ENDPOINT_REGION_HASH = HashingUtils::HashString("InvalidEndpointRegionException");
+static constexpr int INVALID_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidTokenException");
+static constexpr int TIMESTAMP_OUT_OF_BOUNDS_HASH = HashingUtils::CompileTimeHashString("TimestampOutOfBoundsException");
+static constexpr int EXPIRED_TOKEN_HASH = HashingUtils::CompileTimeHashString("ExpiredTokenException");
+static constexpr int INTERNAL_SERVICE_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalServiceErrorException");
+static constexpr int INVALID_USAGE_DIMENSION_HASH = HashingUtils::CompileTimeHashString("InvalidUsageDimensionException");
+static constexpr int INVALID_PRODUCT_CODE_HASH = HashingUtils::CompileTimeHashString("InvalidProductCodeException");
+static constexpr int DUPLICATE_REQUEST_HASH = HashingUtils::CompileTimeHashString("DuplicateRequestException");
+static constexpr int INVALID_CUSTOMER_IDENTIFIER_HASH = HashingUtils::CompileTimeHashString("InvalidCustomerIdentifierException");
+static constexpr int INVALID_ENDPOINT_REGION_HASH = HashingUtils::CompileTimeHashString("InvalidEndpointRegionException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
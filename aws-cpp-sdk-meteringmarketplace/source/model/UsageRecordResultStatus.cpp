@@ -30,25 +30,37 @@ namespace Aws
       namespace UsageRecordResultStatusMapper
       {
 
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int CustomerNotSubscribed_HASH = HashingUtils::HashString("CustomerNotSubscribed");
-        static const int DuplicateRecord_HASH = HashingUtils::HashString("DuplicateRecord");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int CustomerNotSubscribed_HASH = HashingUtils::CompileTimeHashString("CustomerNotSubscribed");
+        static constexpr int DuplicateRecord_HASH = HashingUtils::CompileTimeHashString("DuplicateRecord");
 
 
         UsageRecordResultStatus GetUsageRecordResultStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Success_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UsageRecordResultStatus::Success;
-          }
-          else if (hashCode == CustomerNotSubscribed_HASH)
-          {
-            return UsageRecordResultStatus::CustomerNotSubscribed;
-          }
-          else if (hashCode == DuplicateRecord_HASH)
-          {
-            return UsageRecordResultStatus::DuplicateRecord;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return UsageRecordResultStatus::Success;
+            }
+            break;
+          case CustomerNotSubscribed_HASH:
+            if (name == "CustomerNotSubscribed")
+            {
+              return UsageRecordResultStatus::CustomerNotSubscribed;
+            }
+            break;
+          case DuplicateRecord_HASH:
+            if (name == "DuplicateRecord")
+            {
+              return UsageRecordResultStatus::DuplicateRecord;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return UsageRecordResultStatus::NOT_SET;
         }
 
-        Aws::String GetNameForUsageRecordResultStatus(UsageRecordResultStatus enumValue)
+        const char* GetNameForUsageRecordResultStatus(UsageRecordResultStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -0,0 +1,246 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/metric-aggregator/MetricAggregator.h>
+#include <aws/monitoring/model/PutMetricDataRequest.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/testing/BatchingClientTest.h>
+
+#include <limits>
+#include <thread>
+
+using namespace Aws::MetricAggregator;
+using namespace Aws::CloudWatch;
+using namespace Aws::CloudWatch::Model;
+using namespace Aws::Utils;
+
+static const char* METRIC_NAMESPACE = "MetricAggregatorTests";
+
+/**
+ * CloudWatch client keeping the PutMetricData requests it is sent, failing them all when told to.
+ */
+class MockCloudWatchClient : public Aws::Testing::MockServiceClient<CloudWatchClient>
+{
+public:
+    MockCloudWatchClient() : m_failAll(false) {}
+
+    PutMetricDataOutcome PutMetricData(const PutMetricDataRequest& request) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_requests.push_back(request);
+        if (m_failAll)
+        {
+            return Aws::Client::AWSError<CloudWatchErrors>(CloudWatchErrors::INVALID_PARAMETER_VALUE, "InvalidParameterValue", "Bad value.", false);
+        }
+        return PutMetricDataOutcome(Aws::NoResult());
+    }
+
+    Aws::Vector<PutMetricDataRequest> GetRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_requests;
+    }
+
+    // the datum of the metric with the given name across all requests
+    MetricDatum FindDatum(const Aws::String& metricName) const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        for (const auto& request : m_requests)
+        {
+            for (const auto& datum : request.GetMetricData())
+            {
+                if (datum.GetMetricName() == metricName)
+                {
+                    return datum;
+                }
+            }
+        }
+        return MetricDatum();
+    }
+
+    bool m_failAll;
+
+private:
+    mutable Aws::Vector<PutMetricDataRequest> m_requests;
+};
+
+class MetricAggregatorTest : public Aws::Testing::MockClientTest<MockCloudWatchClient>
+{
+protected:
+    MetricAggregatorTest() : m_configuration(nullptr) {}
+
+    void SetUp() override
+    {
+        MockClientTest::SetUp();
+        m_configuration.cloudWatchClient = m_client;
+        m_configuration.metricNamespace = METRIC_NAMESPACE;
+    }
+
+    void TearDown() override
+    {
+        m_configuration = MetricAggregatorConfiguration(nullptr);
+        MockClientTest::TearDown();
+    }
+
+    static Dimension MakeDimension(const Aws::String& name, const Aws::String& value)
+    {
+        return Dimension().WithName(name).WithValue(value);
+    }
+
+    MetricAggregatorConfiguration m_configuration;
+};
+
+TEST_F(MetricAggregatorTest, TestAggregatesSamplesOfManyThreadsPerMetric)
+{
+    MetricAggregator aggregator(m_configuration);
+    Aws::Vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&aggregator, t]()
+        {
+            Aws::Vector<Dimension> dimensions = { MakeDimension("Host", "a"), MakeDimension("Api", "Get") };
+            Aws::Vector<Dimension> reordered = { MakeDimension("Api", "Get"), MakeDimension("Host", "a") };
+            for (int i = 0; i < 10000; ++i)
+            {
+                ASSERT_TRUE(aggregator.Record("Latency", i % 100 + t, StandardUnit::Milliseconds));
+                ASSERT_TRUE(aggregator.Record("Requests", 1, StandardUnit::Count, i % 2 == 0 ? dimensions : reordered));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    ASSERT_TRUE(aggregator.Record("Requests", 1, StandardUnit::Count, { MakeDimension("Host", "b") }));
+    ASSERT_TRUE(aggregator.Flush());
+
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(1u, requests.size());
+    ASSERT_EQ(METRIC_NAMESPACE, requests[0].GetNamespace());
+    ASSERT_EQ(3u, requests[0].GetMetricData().size());
+
+    auto latency = m_client->FindDatum("Latency");
+    ASSERT_EQ(StandardUnit::Milliseconds, latency.GetUnit());
+    ASSERT_EQ(40000, latency.GetStatisticValues().GetSampleCount());
+    ASSERT_EQ(0, latency.GetStatisticValues().GetMinimum());
+    ASSERT_EQ(102, latency.GetStatisticValues().GetMaximum());
+    ASSERT_EQ(4 * 100 * 4950 + 10000 * (0 + 1 + 2 + 3), latency.GetStatisticValues().GetSum());
+
+    size_t requestDatums = 0;
+    for (const auto& datum : requests[0].GetMetricData())
+    {
+        if (datum.GetMetricName() != "Requests")
+        {
+            continue;
+        }
+        ++requestDatums;
+        if (datum.GetDimensions().size() == 2)
+        {
+            ASSERT_EQ("Api", datum.GetDimensions()[0].GetName());
+            ASSERT_EQ(40000, datum.GetStatisticValues().GetSampleCount());
+            ASSERT_EQ(40000, datum.GetStatisticValues().GetSum());
+        }
+        else
+        {
+            ASSERT_EQ(1, datum.GetStatisticValues().GetSampleCount());
+        }
+    }
+    ASSERT_EQ(2u, requestDatums);
+
+    auto metrics = aggregator.GetMetrics();
+    ASSERT_EQ(80001u, metrics.samplesFlushed);
+    ASSERT_EQ(3u, metrics.entriesSucceeded);
+    ASSERT_EQ(1u, metrics.requestsSent);
+
+    // nothing recorded since, nothing to send
+    ASSERT_TRUE(aggregator.Flush());
+    ASSERT_EQ(1u, m_client->GetRequests().size());
+}
+
+TEST_F(MetricAggregatorTest, TestSplitsDatumsIntoRequests)
+{
+    {
+        MetricAggregator aggregator(m_configuration);
+        for (size_t i = 0; i < 45; ++i)
+        {
+            ASSERT_TRUE(aggregator.Record("Metric" + StringUtils::to_string(i), 1.5));
+        }
+    }
+
+    auto requests = m_client->GetRequests();
+    ASSERT_EQ(3u, requests.size());
+    size_t datums = 0;
+    for (const auto& request : requests)
+    {
+        ASSERT_LE(request.GetMetricData().size(), 20u);
+        datums += request.GetMetricData().size();
+    }
+    ASSERT_EQ(45u, datums);
+    ASSERT_EQ(1.5, m_client->FindDatum("Metric44").GetStatisticValues().GetSum());
+}
+
+TEST_F(MetricAggregatorTest, TestFlushesEveryIntervalOnExecutor)
+{
+    Aws::Utils::Threading::DefaultExecutor executor;
+    m_configuration.executor = &executor;
+    m_configuration.flushInterval = std::chrono::milliseconds(20);
+    m_configuration.highResolution = true;
+    {
+        MetricAggregator aggregator(m_configuration);
+        ASSERT_TRUE(aggregator.Record("Metric", 1));
+        for (size_t i = 0; i < 500 && m_client->GetRequests().empty(); ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        ASSERT_EQ(1u, m_client->GetRequests().size());
+        ASSERT_EQ(1, m_client->FindDatum("Metric").GetStorageResolution());
+
+        ASSERT_TRUE(aggregator.Record("Metric", 2));
+    }
+    ASSERT_EQ(2u, m_client->GetRequests().size());
+}
+
+TEST_F(MetricAggregatorTest, TestReportsFailedRequests)
+{
+    m_client->m_failAll = true;
+    MetricAggregator aggregator(m_configuration);
+    ASSERT_TRUE(aggregator.Record("Metric", 1));
+    ASSERT_FALSE(aggregator.Flush());
+
+    auto metrics = aggregator.GetMetrics();
+    ASSERT_EQ(1u, metrics.requestsFailed);
+    ASSERT_EQ(1u, metrics.entriesFailed);
+    ASSERT_EQ(0u, metrics.entriesSucceeded);
+}
+
+TEST_F(MetricAggregatorTest, TestRejectsInvalidSamples)
+{
+    MetricAggregator aggregator(m_configuration);
+    ASSERT_FALSE(aggregator.Record("", 1));
+    ASSERT_FALSE(aggregator.Record("Metric", std::numeric_limits<double>::quiet_NaN()));
+    ASSERT_FALSE(aggregator.Record("Metric", std::numeric_limits<double>::infinity()));
+
+    Aws::Vector<Dimension> dimensions;
+    for (size_t i = 0; i < 11; ++i)
+    {
+        dimensions.push_back(MakeDimension("Name" + StringUtils::to_string(i), "value"));
+    }
+    ASSERT_FALSE(aggregator.Record("Metric", 1, StandardUnit::None, dimensions));
+    ASSERT_TRUE(aggregator.Flush());
+    ASSERT_EQ(0u, m_client->GetRequests().size());
+}
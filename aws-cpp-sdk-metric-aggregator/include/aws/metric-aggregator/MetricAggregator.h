@@ -0,0 +1,146 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/metric-aggregator/MetricAggregator_EXPORTS.h>
+#include <aws/monitoring/CloudWatchClient.h>
+#include <aws/monitoring/model/Dimension.h>
+#include <aws/monitoring/model/MetricDatum.h>
+#include <aws/monitoring/model/StandardUnit.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/BatchingLoop.h>
+#include <aws/core/utils/threading/Executor.h>
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+namespace Aws
+{
+    namespace MetricAggregator
+    {
+        struct ThreadBuffer;
+
+        /**
+         * Entries are metric datums, one per metric each flush with the statistics of its samples, put when the flush takes them.
+         * Datums of failed requests are dropped, never retried, so nothing counts as retried and bytes aren't tracked.
+         */
+        struct MetricAggregatorMetrics : public Aws::Utils::Threading::BatchingMetrics
+        {
+            MetricAggregatorMetrics() : samplesFlushed(0), requestsFailed(0), flushes(0) {}
+
+            uint64_t samplesFlushed;
+            uint64_t requestsFailed;
+            uint64_t flushes;
+        };
+
+        struct AWS_METRIC_AGGREGATOR_API MetricAggregatorConfiguration
+        {
+            MetricAggregatorConfiguration(Aws::Utils::Threading::Executor* executor);
+
+            std::shared_ptr<Aws::CloudWatch::CloudWatchClient> cloudWatchClient;
+            Aws::String metricNamespace;
+
+            /**
+             * Runs the loop flushing every flushInterval, which keeps one of its threads for as long as the aggregator lives.
+             * Without an executor samples are only sent by Flush() and on destruction, from a thread of the aggregator's own.
+             */
+            Aws::Utils::Threading::Executor* executor;
+
+            /**
+             * Defaults to 1 minute, the period of standard resolution metrics.
+             */
+            std::chrono::milliseconds flushInterval;
+
+            /**
+             * PutMetricData takes at most 20 metric datums per request. Defaults to 20.
+             */
+            size_t maxDatumsPerRequest;
+            /**
+             * PutMetricData requests kept in flight on the executor of the client. Defaults to 8.
+             */
+            size_t maxRequestsInFlight;
+
+            /**
+             * Stores the metrics with a resolution of 1 second rather than 1 minute. Off by default.
+             */
+            bool highResolution;
+        };
+
+        /**
+         * Aggregates samples of CloudWatch metrics on the client and sends them with PutMetricData as one statistic set, the sample count,
+         * sum, minimum and maximum, per metric every flushInterval, so that any number of samples costs a handful of requests.
+         *
+         * Each thread recording samples accumulates them in a buffer of its own, whose lock is only ever contended by a flush taking
+         * what the buffer holds, so threads don't serialize on each other. Samples are told apart by metric name, unit and dimensions,
+         * whatever the order of the dimensions.
+         */
+        class AWS_METRIC_AGGREGATOR_API MetricAggregator : private Aws::Utils::Threading::BatchingLoop
+        {
+        public:
+            MetricAggregator(const MetricAggregatorConfiguration& configuration);
+
+            /**
+             * Stops the flush loop and sends what has been recorded since the last flush.
+             */
+            ~MetricAggregator();
+
+            MetricAggregator(const MetricAggregator&) = delete;
+            MetricAggregator& operator=(const MetricAggregator&) = delete;
+
+            /**
+             * Adds a sample to the statistics of the metric. Returns false, dropping the sample, if the metric has no name or more than
+             * the 10 dimensions CloudWatch takes, or if the value is not a finite number.
+             */
+            bool Record(const Aws::String& metricName, double value, Aws::CloudWatch::Model::StandardUnit unit = Aws::CloudWatch::Model::StandardUnit::None,
+                        const Aws::Vector<Aws::CloudWatch::Model::Dimension>& dimensions = Aws::Vector<Aws::CloudWatch::Model::Dimension>());
+
+            /**
+             * Sends the statistics recorded since the last flush and waits for them, and for those of earlier flushes still being sent.
+             * Returns false if any PutMetricData failed meanwhile, the statistics it carried are dropped.
+             */
+            bool Flush();
+
+            MetricAggregatorMetrics GetMetrics() const;
+
+            inline const MetricAggregatorConfiguration& GetConfiguration() const { return m_configuration; }
+
+        private:
+            bool HasBufferedEntries() const override;
+            std::function<void()> TakeRequest(std::chrono::steady_clock::time_point now, bool sendAll, Aws::Utils::Threading::WakeUpTime& wakeUp) override;
+            void TakeStatistics();
+            void OnPutMetricDataOutcome(const Aws::CloudWatch::Model::PutMetricDataRequest& request, const Aws::CloudWatch::Model::PutMetricDataOutcome& outcome);
+            ThreadBuffer& GetThreadBuffer();
+
+            MetricAggregatorConfiguration m_configuration;
+            // tells the buffers of this aggregator from those of one destroyed at the same address
+            uint64_t m_instanceId;
+
+            Aws::Map<std::thread::id, std::shared_ptr<ThreadBuffer>> m_threadBuffers;
+            std::chrono::steady_clock::time_point m_nextFlush;
+            // datums taken from the thread buffers, waiting for a request
+            Aws::Deque<Aws::CloudWatch::Model::MetricDatum> m_pendingDatums;
+            // what Flush() waits for, every datum it took having been sent or failed
+            uint64_t m_datumsTaken;
+            uint64_t m_datumsCompleted;
+            MetricAggregatorMetrics m_metrics;
+        };
+    }
+}
@@ -0,0 +1,325 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/metric-aggregator/MetricAggregator.h>
+#include <aws/monitoring/model/PutMetricDataRequest.h>
+#include <aws/monitoring/model/StatisticSet.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+using namespace Aws::CloudWatch;
+using namespace Aws::CloudWatch::Model;
+using namespace Aws::Utils::Threading;
+
+namespace Aws
+{
+    namespace MetricAggregator
+    {
+        static const char* CLASS_TAG = "MetricAggregator";
+
+        // limits of PutMetricData
+        static const size_t MAX_DATUMS_PER_REQUEST = 20;
+        static const size_t MAX_DIMENSIONS = 10;
+        static const int HIGH_RESOLUTION = 1;
+
+        struct MetricStatistics
+        {
+            MetricStatistics() : unit(StandardUnit::None), sampleCount(0), sum(0), minimum(0), maximum(0) {}
+
+            void Add(double value)
+            {
+                minimum = sampleCount == 0 ? value : (std::min)(minimum, value);
+                maximum = sampleCount == 0 ? value : (std::max)(maximum, value);
+                sum += value;
+                ++sampleCount;
+            }
+
+            void Merge(const MetricStatistics& other)
+            {
+                minimum = sampleCount == 0 ? other.minimum : (std::min)(minimum, other.minimum);
+                maximum = sampleCount == 0 ? other.maximum : (std::max)(maximum, other.maximum);
+                sum += other.sum;
+                sampleCount += other.sampleCount;
+            }
+
+            Aws::String metricName;
+            StandardUnit unit;
+            Aws::Vector<Dimension> dimensions;
+            uint64_t sampleCount;
+            double sum;
+            double minimum;
+            double maximum;
+        };
+
+        struct ThreadBuffer
+        {
+            std::mutex lock;
+            Aws::Map<Aws::String, MetricStatistics> statistics;
+        };
+
+        struct ThreadBufferCache
+        {
+            uint64_t instanceId;
+            ThreadBuffer* buffer;
+        };
+
+        static std::atomic<uint64_t> s_nextInstanceId(1);
+        // the buffer of the aggregator the thread recorded to last, so that recording doesn't look it up
+        static thread_local ThreadBufferCache s_threadBuffer = { 0, nullptr };
+
+        static bool CompareDimensions(const Dimension& lhs, const Dimension& rhs)
+        {
+            return lhs.GetName() < rhs.GetName() || (lhs.GetName() == rhs.GetName() && lhs.GetValue() < rhs.GetValue());
+        }
+
+        // names and values are separated by a character neither can hold
+        static void AppendKeyPart(Aws::String& key, const Aws::String& part)
+        {
+            key.push_back('\0');
+            key.append(part);
+        }
+
+        MetricAggregatorConfiguration::MetricAggregatorConfiguration(Aws::Utils::Threading::Executor* executor) :
+            executor(executor),
+            flushInterval(60000),
+            maxDatumsPerRequest(MAX_DATUMS_PER_REQUEST),
+            maxRequestsInFlight(8),
+            highResolution(false)
+        {
+        }
+
+        MetricAggregator::MetricAggregator(const MetricAggregatorConfiguration& configuration) :
+            BatchingLoop(configuration.maxRequestsInFlight, configuration.executor),
+            m_configuration(configuration),
+            m_instanceId(s_nextInstanceId++),
+            m_nextFlush(std::chrono::steady_clock::now() + configuration.flushInterval),
+            m_datumsTaken(0),
+            m_datumsCompleted(0)
+        {
+            m_configuration.maxDatumsPerRequest = (std::max)((std::min)(m_configuration.maxDatumsPerRequest, MAX_DATUMS_PER_REQUEST), static_cast<size_t>(1));
+            m_configuration.maxRequestsInFlight = (std::max)(m_configuration.maxRequestsInFlight, static_cast<size_t>(1));
+
+            StartLoop();
+        }
+
+        MetricAggregator::~MetricAggregator()
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                TakeStatistics();
+            }
+            StopLoop();
+        }
+
+        bool MetricAggregator::Record(const Aws::String& metricName, double value, StandardUnit unit, const Aws::Vector<Dimension>& dimensions)
+        {
+            if (metricName.empty() || dimensions.size() > MAX_DIMENSIONS || !std::isfinite(value))
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Sample " << value << " of metric " << metricName << " with " << dimensions.size()
+                        << " dimensions exceeds the limits of CloudWatch.");
+                return false;
+            }
+
+            // the same dimensions in another order are the same metric
+            const Aws::Vector<Dimension>* sortedDimensions = &dimensions;
+            Aws::Vector<Dimension> sorted;
+            if (!std::is_sorted(dimensions.begin(), dimensions.end(), CompareDimensions))
+            {
+                sorted = dimensions;
+                std::sort(sorted.begin(), sorted.end(), CompareDimensions);
+                sortedDimensions = &sorted;
+            }
+
+            Aws::String key(metricName);
+            key.push_back('\0');
+            key.push_back(static_cast<char>(unit));
+            for (const auto& dimension : *sortedDimensions)
+            {
+                AppendKeyPart(key, dimension.GetName());
+                AppendKeyPart(key, dimension.GetValue());
+            }
+
+            ThreadBuffer& buffer = GetThreadBuffer();
+            std::lock_guard<std::mutex> locker(buffer.lock);
+            auto& statistics = buffer.statistics[key];
+            if (statistics.sampleCount == 0)
+            {
+                statistics.metricName = metricName;
+                statistics.unit = unit;
+                statistics.dimensions = *sortedDimensions;
+            }
+            statistics.Add(value);
+            return true;
+        }
+
+        ThreadBuffer& MetricAggregator::GetThreadBuffer()
+        {
+            if (s_threadBuffer.instanceId == m_instanceId)
+            {
+                return *s_threadBuffer.buffer;
+            }
+
+            std::lock_guard<std::mutex> locker(m_lock);
+            auto& buffer = m_threadBuffers[std::this_thread::get_id()];
+            if (!buffer)
+            {
+                buffer = Aws::MakeShared<ThreadBuffer>(CLASS_TAG);
+            }
+            s_threadBuffer.instanceId = m_instanceId;
+            s_threadBuffer.buffer = buffer.get();
+            return *buffer;
+        }
+
+        bool MetricAggregator::Flush()
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            uint64_t requestsFailed = m_metrics.requestsFailed;
+            TakeStatistics();
+            uint64_t datumsTaken = m_datumsTaken;
+            m_signal.notify_all();
+            m_signal.wait(locker, [this, datumsTaken]() { return m_datumsCompleted >= datumsTaken; });
+            return m_metrics.requestsFailed == requestsFailed;
+        }
+
+        MetricAggregatorMetrics MetricAggregator::GetMetrics() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            MetricAggregatorMetrics metrics = m_metrics;
+            CopyLoopMetrics(metrics);
+            metrics.entriesBuffered = m_pendingDatums.size();
+            return metrics;
+        }
+
+        void MetricAggregator::TakeStatistics()
+        {
+            // each buffer is only held for as long as it takes to swap its statistics out, Record() never takes m_lock while holding one
+            Aws::Map<Aws::String, MetricStatistics> statistics;
+            uint64_t samples = 0;
+            for (const auto& buffer : m_threadBuffers)
+            {
+                Aws::Map<Aws::String, MetricStatistics> taken;
+                {
+                    std::lock_guard<std::mutex> locker(buffer.second->lock);
+                    taken.swap(buffer.second->statistics);
+                }
+                for (const auto& entry : taken)
+                {
+                    samples += entry.second.sampleCount;
+                    auto iter = statistics.find(entry.first);
+                    if (iter == statistics.end())
+                    {
+                        statistics.emplace(entry.first, entry.second);
+                    }
+                    else
+                    {
+                        iter->second.Merge(entry.second);
+                    }
+                }
+            }
+
+            auto timestamp = Aws::Utils::DateTime::Now();
+            for (const auto& entry : statistics)
+            {
+                const auto& metric = entry.second;
+                MetricDatum datum;
+                datum.SetMetricName(metric.metricName);
+                datum.SetUnit(metric.unit);
+                datum.SetDimensions(metric.dimensions);
+                datum.SetTimestamp(timestamp);
+                datum.SetStatisticValues(StatisticSet().WithSampleCount(static_cast<double>(metric.sampleCount)).WithSum(metric.sum)
+                                                       .WithMinimum(metric.minimum).WithMaximum(metric.maximum));
+                if (m_configuration.highResolution)
+                {
+                    datum.SetStorageResolution(HIGH_RESOLUTION);
+                }
+                m_pendingDatums.push_back(std::move(datum));
+            }
+
+            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Flushing " << samples << " samples of " << statistics.size() << " metrics.");
+            m_datumsTaken += statistics.size();
+            m_metrics.entriesPut += statistics.size();
+            m_metrics.samplesFlushed += samples;
+            ++m_metrics.flushes;
+        }
+
+        bool MetricAggregator::HasBufferedEntries() const
+        {
+            return !m_pendingDatums.empty();
+        }
+
+        std::function<void()> MetricAggregator::TakeRequest(std::chrono::steady_clock::time_point now, bool, WakeUpTime& wakeUp)
+        {
+            // datums go out as soon as they are taken, only taking them waits for the interval
+            if (m_configuration.executor)
+            {
+                if (now >= m_nextFlush)
+                {
+                    TakeStatistics();
+                    // a flush that overran its interval doesn't cause a burst of them
+                    m_nextFlush = (std::max)(m_nextFlush + m_configuration.flushInterval, now);
+                }
+                wakeUp.NoLaterThan(m_nextFlush);
+            }
+
+            if (m_pendingDatums.empty())
+            {
+                return nullptr;
+            }
+
+            PutMetricDataRequest request;
+            request.SetNamespace(m_configuration.metricNamespace);
+            while (!m_pendingDatums.empty() && request.GetMetricData().size() < m_configuration.maxDatumsPerRequest)
+            {
+                request.AddMetricData(std::move(m_pendingDatums.front()));
+                m_pendingDatums.pop_front();
+            }
+
+            return [this, request]()
+            {
+                m_configuration.cloudWatchClient->PutMetricDataAsync(request, [this](const CloudWatchClient*, const PutMetricDataRequest& request,
+                    const PutMetricDataOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+                {
+                    OnPutMetricDataOutcome(request, outcome);
+                });
+            };
+        }
+
+        void MetricAggregator::OnPutMetricDataOutcome(const PutMetricDataRequest& request, const PutMetricDataOutcome& outcome)
+        {
+            size_t datums = request.GetMetricData().size();
+            {
+                std::lock_guard<std::mutex> locker(m_lock);
+                if (outcome.IsSuccess())
+                {
+                    m_metrics.entriesSucceeded += datums;
+                }
+                else
+                {
+                    AWS_LOGSTREAM_ERROR(CLASS_TAG, "PutMetricData of " << datums << " metrics to namespace " << m_configuration.metricNamespace
+                            << " failed. " << outcome.GetError());
+                    ++m_metrics.requestsFailed;
+                    m_metrics.entriesFailed += datums;
+                }
+                m_datumsCompleted += datums;
+            }
+            CompleteRequest();
+        }
+    }
+}
@@ -39,7 +39,8 @@ namespace PlatformMapper
 {
 AWS_MOBILE_API Platform GetPlatformForName(const Aws::String& name);
 
-AWS_MOBILE_API Aws::String GetNameForPlatform(Platform value);
+// names of values not modeled point into the enum overflow container
+AWS_MOBILE_API const char* GetNameForPlatform(Platform value);
 } // namespace PlatformMapper
 } // namespace Model
 } // namespace Mobile
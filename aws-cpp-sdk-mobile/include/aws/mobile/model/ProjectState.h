@@ -35,7 +35,8 @@ namespace ProjectStateMapper
 {
 AWS_MOBILE_API ProjectState GetProjectStateForName(const Aws::String& name);
 
-AWS_MOBILE_API Aws::String GetNameForProjectState(ProjectState value);
+// names of values not modeled point into the enum overflow container
+AWS_MOBILE_API const char* GetNameForProjectState(ProjectState value);
 } // namespace ProjectStateMapper
 } // namespace Model
 } // namespace Mobile
@@ -30,45 +30,65 @@ namespace Aws
       namespace PlatformMapper
       {
 
-        static const int OSX_HASH = HashingUtils::HashString("OSX");
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
-        static const int LINUX_HASH = HashingUtils::HashString("LINUX");
-        static const int OBJC_HASH = HashingUtils::HashString("OBJC");
-        static const int SWIFT_HASH = HashingUtils::HashString("SWIFT");
-        static const int ANDROID__HASH = HashingUtils::HashString("ANDROID");
-        static const int JAVASCRIPT_HASH = HashingUtils::HashString("JAVASCRIPT");
+        static constexpr int OSX_HASH = HashingUtils::CompileTimeHashString("OSX");
+        static constexpr int WINDOWS_HASH = HashingUtils::CompileTimeHashString("WINDOWS");
+        static constexpr int LINUX_HASH = HashingUtils::CompileTimeHashString("LINUX");
+        static constexpr int OBJC_HASH = HashingUtils::CompileTimeHashString("OBJC");
+        static constexpr int SWIFT_HASH = HashingUtils::CompileTimeHashString("SWIFT");
+        static constexpr int ANDROID__HASH = HashingUtils::CompileTimeHashString("ANDROID");
+        static constexpr int JAVASCRIPT_HASH = HashingUtils::CompileTimeHashString("JAVASCRIPT");
 
 
         Platform GetPlatformForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OSX_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Platform::OSX;
-          }
-          else if (hashCode == WINDOWS_HASH)
-          {
-            return Platform::WINDOWS;
-          }
-          else if (hashCode == LINUX_HASH)
-          {
-            return Platform::LINUX;
-          }
-          else if (hashCode == OBJC_HASH)
-          {
-            return Platform::OBJC;
-          }
-          else if (hashCode == SWIFT_HASH)
-          {
-            return Platform::SWIFT;
-          }
-          else if (hashCode == ANDROID__HASH)
-          {
-            return Platform::ANDROID_;
-          }
-          else if (hashCode == JAVASCRIPT_HASH)
-          {
-            return Platform::JAVASCRIPT;
+          case OSX_HASH:
+            if (name == "OSX")
+            {
+              return Platform::OSX;
+            }
+            break;
+          case WINDOWS_HASH:
+            if (name == "WINDOWS")
+            {
+              return Platform::WINDOWS;
+            }
+            break;
+          case LINUX_HASH:
+            if (name == "LINUX")
+            {
+              return Platform::LINUX;
+            }
+            break;
+          case OBJC_HASH:
+            if (name == "OBJC")
+            {
+              return Platform::OBJC;
+            }
+            break;
+          case SWIFT_HASH:
+            if (name == "SWIFT")
+            {
+              return Platform::SWIFT;
+            }
+            break;
+          case ANDROID__HASH:
+            if (name == "ANDROID")
+            {
+              return Platform::ANDROID_;
+            }
+            break;
+          case JAVASCRIPT_HASH:
+            if (name == "JAVASCRIPT")
+            {
+              return Platform::JAVASCRIPT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return Platform::NOT_SET;
         }
 
-        Aws::String GetNameForPlatform(Platform enumValue)
+        const char* GetNameForPlatform(Platform enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
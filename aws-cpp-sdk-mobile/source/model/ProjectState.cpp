@@ -30,25 +30,37 @@ namespace Aws
       namespace ProjectStateMapper
       {
 
-        static const int NORMAL_HASH = HashingUtils::HashString("NORMAL");
-        static const int SYNCING_HASH = HashingUtils::HashString("SYNCING");
-        static const int IMPORTING_HASH = HashingUtils::HashString("IMPORTING");
+        static constexpr int NORMAL_HASH = HashingUtils::CompileTimeHashString("NORMAL");
+        static constexpr int SYNCING_HASH = HashingUtils::CompileTimeHashString("SYNCING");
+        static constexpr int IMPORTING_HASH = HashingUtils::CompileTimeHashString("IMPORTING");
 
 
         ProjectState GetProjectStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NORMAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProjectState::NORMAL;
-          }
-          else if (hashCode == SYNCING_HASH)
-          {
-            return ProjectState::SYNCING;
-          }
-          else if (hashCode == IMPORTING_HASH)
-          {
-            return ProjectState::IMPORTING;
+          case NORMAL_HASH:
+            if (name == "NORMAL")
+            {
+              return ProjectState::NORMAL;
+            }
+            break;
+          case SYNCING_HASH:
+            if (name == "SYNCING")
+            {
+              return ProjectState::SYNCING;
+            }
+            break;
+          case IMPORTING_HASH:
+            if (name == "IMPORTING")
+            {
+              return ProjectState::IMPORTING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ProjectState::NOT_SET;
         }
 
-        Aws::String GetNameForProjectState(ProjectState enumValue)
+        const char* GetNameForProjectState(ProjectState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -28,7 +28,7 @@ namespace MobileAnalytics
 namespace MobileAnalyticsErrorMapper
 {
 
-static const int BAD_REQUEST_HASH = HashingUtils::HashString("BadRequestException");
+static constexpr int BAD_REQUEST_HASH = HashingUtils::CompileTimeHashString("BadRequestException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
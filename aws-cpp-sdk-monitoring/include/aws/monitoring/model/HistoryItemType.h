@@ -35,7 +35,8 @@ namespace HistoryItemTypeMapper
 {
 AWS_CLOUDWATCH_API HistoryItemType GetHistoryItemTypeForName(const Aws::String& name);
 
-AWS_CLOUDWATCH_API Aws::String GetNameForHistoryItemType(HistoryItemType value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDWATCH_API const char* GetNameForHistoryItemType(HistoryItemType value);
 } // namespace HistoryItemTypeMapper
 } // namespace Model
 } // namespace CloudWatch
@@ -34,7 +34,8 @@ namespace ScanByMapper
 {
 AWS_CLOUDWATCH_API ScanBy GetScanByForName(const Aws::String& name);
 
-AWS_CLOUDWATCH_API Aws::String GetNameForScanBy(ScanBy value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDWATCH_API const char* GetNameForScanBy(ScanBy value);
 } // namespace ScanByMapper
 } // namespace Model
 } // namespace CloudWatch
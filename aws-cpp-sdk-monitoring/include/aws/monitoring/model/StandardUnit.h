@@ -59,7 +59,8 @@ namespace StandardUnitMapper
 {
 AWS_CLOUDWATCH_API StandardUnit GetStandardUnitForName(const Aws::String& name);
 
-AWS_CLOUDWATCH_API Aws::String GetNameForStandardUnit(StandardUnit value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDWATCH_API const char* GetNameForStandardUnit(StandardUnit value);
 } // namespace StandardUnitMapper
 } // namespace Model
 } // namespace CloudWatch
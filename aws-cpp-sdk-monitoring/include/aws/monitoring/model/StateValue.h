@@ -35,7 +35,8 @@ namespace StateValueMapper
 {
 AWS_CLOUDWATCH_API StateValue GetStateValueForName(const Aws::String& name);
 
-AWS_CLOUDWATCH_API Aws::String GetNameForStateValue(StateValue value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDWATCH_API const char* GetNameForStateValue(StateValue value);
 } // namespace StateValueMapper
 } // namespace Model
 } // namespace CloudWatch
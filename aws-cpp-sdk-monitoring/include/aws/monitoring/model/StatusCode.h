@@ -35,7 +35,8 @@ namespace StatusCodeMapper
 {
 AWS_CLOUDWATCH_API StatusCode GetStatusCodeForName(const Aws::String& name);
 
-AWS_CLOUDWATCH_API Aws::String GetNameForStatusCode(StatusCode value);
+// names of values not modeled point into the enum overflow container
+AWS_CLOUDWATCH_API const char* GetNameForStatusCode(StatusCode value);
 } // namespace StatusCodeMapper
 } // namespace Model
 } // namespace CloudWatch
@@ -28,13 +28,13 @@ namespace CloudWatch
 namespace CloudWatchErrorMapper
 {
 
-static const int DASHBOARD_NOT_FOUND_HASH = HashingUtils::HashString("ResourceNotFound");
-static const int INVALID_FORMAT_FAULT_HASH = HashingUtils::HashString("InvalidFormat");
-static const int INTERNAL_SERVICE_FAULT_HASH = HashingUtils::HashString("InternalServiceError");
-static const int LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::HashString("LimitExceeded");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextToken");
-static const int MISSING_REQUIRED_PARAMETER_HASH = HashingUtils::HashString("MissingParameter");
-static const int DASHBOARD_INVALID_INPUT_HASH = HashingUtils::HashString("InvalidParameterInput");
+static constexpr int DASHBOARD_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ResourceNotFound");
+static constexpr int INVALID_FORMAT_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidFormat");
+static constexpr int INTERNAL_SERVICE_FAULT_HASH = HashingUtils::CompileTimeHashString("InternalServiceError");
+static constexpr int LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("LimitExceeded");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextToken");
+static constexpr int MISSING_REQUIRED_PARAMETER_HASH = HashingUtils::CompileTimeHashString("MissingParameter");
+static constexpr int DASHBOARD_INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidParameterInput");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
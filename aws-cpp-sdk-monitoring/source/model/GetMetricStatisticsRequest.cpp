@@ -80,7 +80,7 @@ Aws::String GetMetricStatisticsRequest::SerializePayload() const
     for(auto& item : m_statistics)
     {
       ss << "Statistics.member." << statisticsCount << "="
-          << StringUtils::URLEncode(StatisticMapper::GetNameForStatistic(item).c_str()) << "&";
+          << StringUtils::URLEncode(StatisticMapper::GetNameForStatistic(item)) << "&";
       statisticsCount++;
     }
   }
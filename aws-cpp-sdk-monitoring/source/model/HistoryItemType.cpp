@@ -30,25 +30,37 @@ namespace Aws
       namespace HistoryItemTypeMapper
       {
 
-        static const int ConfigurationUpdate_HASH = HashingUtils::HashString("ConfigurationUpdate");
-        static const int StateUpdate_HASH = HashingUtils::HashString("StateUpdate");
-        static const int Action_HASH = HashingUtils::HashString("Action");
+        static constexpr int ConfigurationUpdate_HASH = HashingUtils::CompileTimeHashString("ConfigurationUpdate");
+        static constexpr int StateUpdate_HASH = HashingUtils::CompileTimeHashString("StateUpdate");
+        static constexpr int Action_HASH = HashingUtils::CompileTimeHashString("Action");
 
 
         HistoryItemType GetHistoryItemTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ConfigurationUpdate_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HistoryItemType::ConfigurationUpdate;
-          }
-          else if (hashCode == StateUpdate_HASH)
-          {
-            return HistoryItemType::StateUpdate;
-          }
-          else if (hashCode == Action_HASH)
-          {
-            return HistoryItemType::Action;
+          case ConfigurationUpdate_HASH:
+            if (name == "ConfigurationUpdate")
+            {
+              return HistoryItemType::ConfigurationUpdate;
+            }
+            break;
+          case StateUpdate_HASH:
+            if (name == "StateUpdate")
+            {
+              return HistoryItemType::StateUpdate;
+            }
+            break;
+          case Action_HASH:
+            if (name == "Action")
+            {
+              return HistoryItemType::Action;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return HistoryItemType::NOT_SET;
         }
 
-        Aws::String GetNameForHistoryItemType(HistoryItemType enumValue)
+        const char* GetNameForHistoryItemType(HistoryItemType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
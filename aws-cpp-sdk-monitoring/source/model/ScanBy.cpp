@@ -30,20 +30,30 @@ namespace Aws
       namespace ScanByMapper
       {
 
-        static const int TimestampDescending_HASH = HashingUtils::HashString("TimestampDescending");
-        static const int TimestampAscending_HASH = HashingUtils::HashString("TimestampAscending");
+        static constexpr int TimestampDescending_HASH = HashingUtils::CompileTimeHashString("TimestampDescending");
+        static constexpr int TimestampAscending_HASH = HashingUtils::CompileTimeHashString("TimestampAscending");
 
 
         ScanBy GetScanByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TimestampDescending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScanBy::TimestampDescending;
-          }
-          else if (hashCode == TimestampAscending_HASH)
-          {
-            return ScanBy::TimestampAscending;
+          case TimestampDescending_HASH:
+            if (name == "TimestampDescending")
+            {
+              return ScanBy::TimestampDescending;
+            }
+            break;
+          case TimestampAscending_HASH:
+            if (name == "TimestampAscending")
+            {
+              return ScanBy::TimestampAscending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ScanBy::NOT_SET;
         }
 
-        Aws::String GetNameForScanBy(ScanBy enumValue)
+        const char* GetNameForScanBy(ScanBy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,145 +30,205 @@ namespace Aws
       namespace StandardUnitMapper
       {
 
-        static const int Seconds_HASH = HashingUtils::HashString("Seconds");
-        static const int Microseconds_HASH = HashingUtils::HashString("Microseconds");
-        static const int Milliseconds_HASH = HashingUtils::HashString("Milliseconds");
-        static const int Bytes_HASH = HashingUtils::HashString("Bytes");
-        static const int Kilobytes_HASH = HashingUtils::HashString("Kilobytes");
-        static const int Megabytes_HASH = HashingUtils::HashString("Megabytes");
-        static const int Gigabytes_HASH = HashingUtils::HashString("Gigabytes");
-        static const int Terabytes_HASH = HashingUtils::HashString("Terabytes");
-        static const int Bits_HASH = HashingUtils::HashString("Bits");
-        static const int Kilobits_HASH = HashingUtils::HashString("Kilobits");
-        static const int Megabits_HASH = HashingUtils::HashString("Megabits");
-        static const int Gigabits_HASH = HashingUtils::HashString("Gigabits");
-        static const int Terabits_HASH = HashingUtils::HashString("Terabits");
-        static const int Percent_HASH = HashingUtils::HashString("Percent");
-        static const int Count_HASH = HashingUtils::HashString("Count");
-        static const int Bytes_Second_HASH = HashingUtils::HashString("Bytes/Second");
-        static const int Kilobytes_Second_HASH = HashingUtils::HashString("Kilobytes/Second");
-        static const int Megabytes_Second_HASH = HashingUtils::HashString("Megabytes/Second");
-        static const int Gigabytes_Second_HASH = HashingUtils::HashString("Gigabytes/Second");
-        static const int Terabytes_Second_HASH = HashingUtils::HashString("Terabytes/Second");
-        static const int Bits_Second_HASH = HashingUtils::HashString("Bits/Second");
-        static const int Kilobits_Second_HASH = HashingUtils::HashString("Kilobits/Second");
-        static const int Megabits_Second_HASH = HashingUtils::HashString("Megabits/Second");
-        static const int Gigabits_Second_HASH = HashingUtils::HashString("Gigabits/Second");
-        static const int Terabits_Second_HASH = HashingUtils::HashString("Terabits/Second");
-        static const int Count_Second_HASH = HashingUtils::HashString("Count/Second");
-        static const int None_HASH = HashingUtils::HashString("None");
+        static constexpr int Seconds_HASH = HashingUtils::CompileTimeHashString("Seconds");
+        static constexpr int Microseconds_HASH = HashingUtils::CompileTimeHashString("Microseconds");
+        static constexpr int Milliseconds_HASH = HashingUtils::CompileTimeHashString("Milliseconds");
+        static constexpr int Bytes_HASH = HashingUtils::CompileTimeHashString("Bytes");
+        static constexpr int Kilobytes_HASH = HashingUtils::CompileTimeHashString("Kilobytes");
+        static constexpr int Megabytes_HASH = HashingUtils::CompileTimeHashString("Megabytes");
+        static constexpr int Gigabytes_HASH = HashingUtils::CompileTimeHashString("Gigabytes");
+        static constexpr int Terabytes_HASH = HashingUtils::CompileTimeHashString("Terabytes");
+        static constexpr int Bits_HASH = HashingUtils::CompileTimeHashString("Bits");
+        static constexpr int Kilobits_HASH = HashingUtils::CompileTimeHashString("Kilobits");
+        static constexpr int Megabits_HASH = HashingUtils::CompileTimeHashString("Megabits");
+        static constexpr int Gigabits_HASH = HashingUtils::CompileTimeHashString("Gigabits");
+        static constexpr int Terabits_HASH = HashingUtils::CompileTimeHashString("Terabits");
+        static constexpr int Percent_HASH = HashingUtils::CompileTimeHashString("Percent");
+        static constexpr int Count_HASH = HashingUtils::CompileTimeHashString("Count");
+        static constexpr int Bytes_Second_HASH = HashingUtils::CompileTimeHashString("Bytes/Second");
+        static constexpr int Kilobytes_Second_HASH = HashingUtils::CompileTimeHashString("Kilobytes/Second");
+        static constexpr int Megabytes_Second_HASH = HashingUtils::CompileTimeHashString("Megabytes/Second");
+        static constexpr int Gigabytes_Second_HASH = HashingUtils::CompileTimeHashString("Gigabytes/Second");
+        static constexpr int Terabytes_Second_HASH = HashingUtils::CompileTimeHashString("Terabytes/Second");
+        static constexpr int Bits_Second_HASH = HashingUtils::CompileTimeHashString("Bits/Second");
+        static constexpr int Kilobits_Second_HASH = HashingUtils::CompileTimeHashString("Kilobits/Second");
+        static constexpr int Megabits_Second_HASH = HashingUtils::CompileTimeHashString("Megabits/Second");
+        static constexpr int Gigabits_Second_HASH = HashingUtils::CompileTimeHashString("Gigabits/Second");
+        static constexpr int Terabits_Second_HASH = HashingUtils::CompileTimeHashString("Terabits/Second");
+        static constexpr int Count_Second_HASH = HashingUtils::CompileTimeHashString("Count/Second");
+        static constexpr int None_HASH = HashingUtils::CompileTimeHashString("None");
 
 
         StandardUnit GetStandardUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Seconds_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StandardUnit::Seconds;
-          }
-          else if (hashCode == Microseconds_HASH)
-          {
-            return StandardUnit::Microseconds;
-          }
-          else if (hashCode == Milliseconds_HASH)
-          {
-            return StandardUnit::Milliseconds;
-          }
-          else if (hashCode == Bytes_HASH)
-          {
-            return StandardUnit::Bytes;
-          }
-          else if (hashCode == Kilobytes_HASH)
-          {
-            return StandardUnit::Kilobytes;
-          }
-          else if (hashCode == Megabytes_HASH)
-          {
-            return StandardUnit::Megabytes;
-          }
-          else if (hashCode == Gigabytes_HASH)
-          {
-            return StandardUnit::Gigabytes;
-          }
-          else if (hashCode == Terabytes_HASH)
-          {
-            return StandardUnit::Terabytes;
-          }
-          else if (hashCode == Bits_HASH)
-          {
-            return StandardUnit::Bits;
-          }
-          else if (hashCode == Kilobits_HASH)
-          {
-            return StandardUnit::Kilobits;
-          }
-          else if (hashCode == Megabits_HASH)
-          {
-            return StandardUnit::Megabits;
-          }
-          else if (hashCode == Gigabits_HASH)
-          {
-            return StandardUnit::Gigabits;
-          }
-          else if (hashCode == Terabits_HASH)
-          {
-            return StandardUnit::Terabits;
-          }
-          else if (hashCode == Percent_HASH)
-          {
-            return StandardUnit::Percent;
-          }
-          else if (hashCode == Count_HASH)
-          {
-            return StandardUnit::Count;
-          }
-          else if (hashCode == Bytes_Second_HASH)
-          {
-            return StandardUnit::Bytes_Second;
-          }
-          else if (hashCode == Kilobytes_Second_HASH)
-          {
-            return StandardUnit::Kilobytes_Second;
-          }
-          else if (hashCode == Megabytes_Second_HASH)
-          {
-            return StandardUnit::Megabytes_Second;
-          }
-          else if (hashCode == Gigabytes_Second_HASH)
-          {
-            return StandardUnit::Gigabytes_Second;
-          }
-          else if (hashCode == Terabytes_Second_HASH)
-          {
-            return StandardUnit::Terabytes_Second;
-          }
-          else if (hashCode == Bits_Second_HASH)
-          {
-            return StandardUnit::Bits_Second;
-          }
-          else if (hashCode == Kilobits_Second_HASH)
-          {
-            return StandardUnit::Kilobits_Second;
-          }
-          else if (hashCode == Megabits_Second_HASH)
-          {
-            return StandardUnit::Megabits_Second;
-          }
-          else if (hashCode == Gigabits_Second_HASH)
-          {
-            return StandardUnit::Gigabits_Second;
-          }
-          else if (hashCode == Terabits_Second_HASH)
-          {
-            return StandardUnit::Terabits_Second;
-          }
-          else if (hashCode == Count_Second_HASH)
-          {
-            return StandardUnit::Count_Second;
-          }
-          else if (hashCode == None_HASH)
-          {
-            return StandardUnit::None;
+          case Seconds_HASH:
+            if (name == "Seconds")
+            {
+              return StandardUnit::Seconds;
+            }
+            break;
+          case Microseconds_HASH:
+            if (name == "Microseconds")
+            {
+              return StandardUnit::Microseconds;
+            }
+            break;
+          case Milliseconds_HASH:
+            if (name == "Milliseconds")
+            {
+              return StandardUnit::Milliseconds;
+            }
+            break;
+          case Bytes_HASH:
+            if (name == "Bytes")
+            {
+              return StandardUnit::Bytes;
+            }
+            break;
+          case Kilobytes_HASH:
+            if (name == "Kilobytes")
+            {
+              return StandardUnit::Kilobytes;
+            }
+            break;
+          case Megabytes_HASH:
+            if (name == "Megabytes")
+            {
+              return StandardUnit::Megabytes;
+            }
+            break;
+          case Gigabytes_HASH:
+            if (name == "Gigabytes")
+            {
+              return StandardUnit::Gigabytes;
+            }
+            break;
+          case Terabytes_HASH:
+            if (name == "Terabytes")
+            {
+              return StandardUnit::Terabytes;
+            }
+            break;
+          case Bits_HASH:
+            if (name == "Bits")
+            {
+              return StandardUnit::Bits;
+            }
+            break;
+          case Kilobits_HASH:
+            if (name == "Kilobits")
+            {
+              return StandardUnit::Kilobits;
+            }
+            break;
+          case Megabits_HASH:
+            if (name == "Megabits")
+            {
+              return StandardUnit::Megabits;
+            }
+            break;
+          case Gigabits_HASH:
+            if (name == "Gigabits")
+            {
+              return StandardUnit::Gigabits;
+            }
+            break;
+          case Terabits_HASH:
+            if (name == "Terabits")
+            {
+              return StandardUnit::Terabits;
+            }
+            break;
+          case Percent_HASH:
+            if (name == "Percent")
+            {
+              return StandardUnit::Percent;
+            }
+            break;
+          case Count_HASH:
+            if (name == "Count")
+            {
+              return StandardUnit::Count;
+            }
+            break;
+          case Bytes_Second_HASH:
+            if (name == "Bytes/Second")
+            {
+              return StandardUnit::Bytes_Second;
+            }
+            break;
+          case Kilobytes_Second_HASH:
+            if (name == "Kilobytes/Second")
+            {
+              return StandardUnit::Kilobytes_Second;
+            }
+            break;
+          case Megabytes_Second_HASH:
+            if (name == "Megabytes/Second")
+            {
+              return StandardUnit::Megabytes_Second;
+            }
+            break;
+          case Gigabytes_Second_HASH:
+            if (name == "Gigabytes/Second")
+            {
+              return StandardUnit::Gigabytes_Second;
+            }
+            break;
+          case Terabytes_Second_HASH:
+            if (name == "Terabytes/Second")
+            {
+              return StandardUnit::Terabytes_Second;
+            }
+            break;
+          case Bits_Second_HASH:
+            if (name == "Bits/Second")
+            {
+              return StandardUnit::Bits_Second;
+            }
+            break;
+          case Kilobits_Second_HASH:
+            if (name == "Kilobits/Second")
+            {
+              return StandardUnit::Kilobits_Second;
+            }
+            break;
+          case Megabits_Second_HASH:
+            if (name == "Megabits/Second")
+            {
+              return StandardUnit::Megabits_Second;
+            }
+            break;
+          case Gigabits_Second_HASH:
+            if (name == "Gigabits/Second")
+            {
+              return StandardUnit::Gigabits_Second;
+            }
+            break;
+          case Terabits_Second_HASH:
+            if (name == "Terabits/Second")
+            {
+              return StandardUnit::Terabits_Second;
+            }
+            break;
+          case Count_Second_HASH:
+            if (name == "Count/Second")
+            {
+              return StandardUnit::Count_Second;
+            }
+            break;
+          case None_HASH:
+            if (name == "None")
+            {
+              return StandardUnit::None;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -180,7 +240,7 @@ namespace Aws
           return StandardUnit::NOT_SET;
         }
 
-        Aws::String GetNameForStandardUnit(StandardUnit enumValue)
+        const char* GetNameForStandardUnit(StandardUnit enumValue)
         {
           switch(enumValue)
           {
@@ -242,7 +302,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace StateValueMapper
       {
 
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int ALARM_HASH = HashingUtils::HashString("ALARM");
-        static const int INSUFFICIENT_DATA_HASH = HashingUtils::HashString("INSUFFICIENT_DATA");
+        static constexpr int OK_HASH = HashingUtils::CompileTimeHashString("OK");
+        static constexpr int ALARM_HASH = HashingUtils::CompileTimeHashString("ALARM");
+        static constexpr int INSUFFICIENT_DATA_HASH = HashingUtils::CompileTimeHashString("INSUFFICIENT_DATA");
 
 
         StateValue GetStateValueForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StateValue::OK;
-          }
-          else if (hashCode == ALARM_HASH)
-          {
-            return StateValue::ALARM;
-          }
-          else if (hashCode == INSUFFICIENT_DATA_HASH)
-          {
-            return StateValue::INSUFFICIENT_DATA;
+          case OK_HASH:
+            if (name == "OK")
+            {
+              return StateValue::OK;
+            }
+            break;
+          case ALARM_HASH:
+            if (name == "ALARM")
+            {
+              return StateValue::ALARM;
+            }
+            break;
+          case INSUFFICIENT_DATA_HASH:
+            if (name == "INSUFFICIENT_DATA")
+            {
+              return StateValue::INSUFFICIENT_DATA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return StateValue::NOT_SET;
         }
 
-        Aws::String GetNameForStateValue(StateValue enumValue)
+        const char* GetNameForStateValue(StateValue enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
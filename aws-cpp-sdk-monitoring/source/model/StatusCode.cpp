@@ -30,25 +30,37 @@ namespace Aws
       namespace StatusCodeMapper
       {
 
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int InternalError_HASH = HashingUtils::HashString("InternalError");
-        static const int PartialData_HASH = HashingUtils::HashString("PartialData");
+        static constexpr int Complete_HASH = HashingUtils::CompileTimeHashString("Complete");
+        static constexpr int InternalError_HASH = HashingUtils::CompileTimeHashString("InternalError");
+        static constexpr int PartialData_HASH = HashingUtils::CompileTimeHashString("PartialData");
 
 
         StatusCode GetStatusCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Complete_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StatusCode::Complete;
-          }
-          else if (hashCode == InternalError_HASH)
-          {
-            return StatusCode::InternalError;
-          }
-          else if (hashCode == PartialData_HASH)
-          {
-            return StatusCode::PartialData;
+          case Complete_HASH:
+            if (name == "Complete")
+            {
+              return StatusCode::Complete;
+            }
+            break;
+          case InternalError_HASH:
+            if (name == "InternalError")
+            {
+              return StatusCode::InternalError;
+            }
+            break;
+          case PartialData_HASH:
+            if (name == "PartialData")
+            {
+              return StatusCode::PartialData;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return StatusCode::NOT_SET;
         }
 
-        Aws::String GetNameForStatusCode(StatusCode enumValue)
+        const char* GetNameForStatusCode(StatusCode enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -37,7 +37,8 @@ namespace BrokerStateMapper
 {
 AWS_MQ_API BrokerState GetBrokerStateForName(const Aws::String& name);
 
-AWS_MQ_API Aws::String GetNameForBrokerState(BrokerState value);
+// names of values not modeled point into the enum overflow container
+AWS_MQ_API const char* GetNameForBrokerState(BrokerState value);
 } // namespace BrokerStateMapper
 } // namespace Model
 } // namespace MQ
@@ -35,7 +35,8 @@ namespace ChangeTypeMapper
 {
 AWS_MQ_API ChangeType GetChangeTypeForName(const Aws::String& name);
 
-AWS_MQ_API Aws::String GetNameForChangeType(ChangeType value);
+// names of values not modeled point into the enum overflow container
+AWS_MQ_API const char* GetNameForChangeType(ChangeType value);
 } // namespace ChangeTypeMapper
 } // namespace Model
 } // namespace MQ
@@ -34,7 +34,8 @@ namespace DeploymentModeMapper
 {
 AWS_MQ_API DeploymentMode GetDeploymentModeForName(const Aws::String& name);
 
-AWS_MQ_API Aws::String GetNameForDeploymentMode(DeploymentMode value);
+// names of values not modeled point into the enum overflow container
+AWS_MQ_API const char* GetNameForDeploymentMode(DeploymentMode value);
 } // namespace DeploymentModeMapper
 } // namespace Model
 } // namespace MQ
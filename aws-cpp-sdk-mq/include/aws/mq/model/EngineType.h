@@ -33,7 +33,8 @@ namespace EngineTypeMapper
 {
 AWS_MQ_API EngineType GetEngineTypeForName(const Aws::String& name);
 
-AWS_MQ_API Aws::String GetNameForEngineType(EngineType value);
+// names of values not modeled point into the enum overflow container
+AWS_MQ_API const char* GetNameForEngineType(EngineType value);
 } // namespace EngineTypeMapper
 } // namespace Model
 } // namespace MQ
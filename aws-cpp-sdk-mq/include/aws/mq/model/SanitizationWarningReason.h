@@ -35,7 +35,8 @@ namespace SanitizationWarningReasonMapper
 {
 AWS_MQ_API SanitizationWarningReason GetSanitizationWarningReasonForName(const Aws::String& name);
 
-AWS_MQ_API Aws::String GetNameForSanitizationWarningReason(SanitizationWarningReason value);
+// names of values not modeled point into the enum overflow container
+AWS_MQ_API const char* GetNameForSanitizationWarningReason(SanitizationWarningReason value);
 } // namespace SanitizationWarningReasonMapper
 } // namespace Model
 } // namespace MQ
@@ -30,35 +30,51 @@ namespace Aws
       namespace BrokerStateMapper
       {
 
-        static const int CREATION_IN_PROGRESS_HASH = HashingUtils::HashString("CREATION_IN_PROGRESS");
-        static const int CREATION_FAILED_HASH = HashingUtils::HashString("CREATION_FAILED");
-        static const int DELETION_IN_PROGRESS_HASH = HashingUtils::HashString("DELETION_IN_PROGRESS");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int REBOOT_IN_PROGRESS_HASH = HashingUtils::HashString("REBOOT_IN_PROGRESS");
+        static constexpr int CREATION_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATION_IN_PROGRESS");
+        static constexpr int CREATION_FAILED_HASH = HashingUtils::CompileTimeHashString("CREATION_FAILED");
+        static constexpr int DELETION_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("DELETION_IN_PROGRESS");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int REBOOT_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("REBOOT_IN_PROGRESS");
 
 
         BrokerState GetBrokerStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATION_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BrokerState::CREATION_IN_PROGRESS;
-          }
-          else if (hashCode == CREATION_FAILED_HASH)
-          {
-            return BrokerState::CREATION_FAILED;
-          }
-          else if (hashCode == DELETION_IN_PROGRESS_HASH)
-          {
-            return BrokerState::DELETION_IN_PROGRESS;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return BrokerState::RUNNING;
-          }
-          else if (hashCode == REBOOT_IN_PROGRESS_HASH)
-          {
-            return BrokerState::REBOOT_IN_PROGRESS;
+          case CREATION_IN_PROGRESS_HASH:
+            if (name == "CREATION_IN_PROGRESS")
+            {
+              return BrokerState::CREATION_IN_PROGRESS;
+            }
+            break;
+          case CREATION_FAILED_HASH:
+            if (name == "CREATION_FAILED")
+            {
+              return BrokerState::CREATION_FAILED;
+            }
+            break;
+          case DELETION_IN_PROGRESS_HASH:
+            if (name == "DELETION_IN_PROGRESS")
+            {
+              return BrokerState::DELETION_IN_PROGRESS;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return BrokerState::RUNNING;
+            }
+            break;
+          case REBOOT_IN_PROGRESS_HASH:
+            if (name == "REBOOT_IN_PROGRESS")
+            {
+              return BrokerState::REBOOT_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return BrokerState::NOT_SET;
         }
 
-        Aws::String GetNameForBrokerState(BrokerState enumValue)
+        const char* GetNameForBrokerState(BrokerState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace DayOfWeekMapper
       {
 
-        static const int MONDAY_HASH = HashingUtils::HashString("MONDAY");
-        static const int TUESDAY_HASH = HashingUtils::HashString("TUESDAY");
-        static const int WEDNESDAY_HASH = HashingUtils::HashString("WEDNESDAY");
-        static const int THURSDAY_HASH = HashingUtils::HashString("THURSDAY");
-        static const int FRIDAY_HASH = HashingUtils::HashString("FRIDAY");
-        static const int SATURDAY_HASH = HashingUtils::HashString("SATURDAY");
-        static const int SUNDAY_HASH = HashingUtils::HashString("SUNDAY");
+        static constexpr int MONDAY_HASH = HashingUtils::CompileTimeHashString("MONDAY");
+        static constexpr int TUESDAY_HASH = HashingUtils::CompileTimeHashString("TUESDAY");
+        static constexpr int WEDNESDAY_HASH = HashingUtils::CompileTimeHashString("WEDNESDAY");
+        static constexpr int THURSDAY_HASH = HashingUtils::CompileTimeHashString("THURSDAY");
+        static constexpr int FRIDAY_HASH = HashingUtils::CompileTimeHashString("FRIDAY");
+        static constexpr int SATURDAY_HASH = HashingUtils::CompileTimeHashString("SATURDAY");
+        static constexpr int SUNDAY_HASH = HashingUtils::CompileTimeHashString("SUNDAY");
 
 
         DayOfWeek GetDayOfWeekForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MONDAY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DayOfWeek::MONDAY;
-          }
-          else if (hashCode == TUESDAY_HASH)
-          {
-            return DayOfWeek::TUESDAY;
-          }
-          else if (hashCode == WEDNESDAY_HASH)
-          {
-            return DayOfWeek::WEDNESDAY;
-          }
-          else if (hashCode == THURSDAY_HASH)
-          {
-            return DayOfWeek::THURSDAY;
-          }
-          else if (hashCode == FRIDAY_HASH)
-          {
-            return DayOfWeek::FRIDAY;
-          }
-          else if (hashCode == SATURDAY_HASH)
-          {
-            return DayOfWeek::SATURDAY;
-          }
-          else if (hashCode == SUNDAY_HASH)
-          {
-            return DayOfWeek::SUNDAY;
+          case MONDAY_HASH:
+            if (name == "MONDAY")
+            {
+              return DayOfWeek::MONDAY;
+            }
+            break;
+          case TUESDAY_HASH:
+            if (name == "TUESDAY")
+            {
+              return DayOfWeek::TUESDAY;
+            }
+            break;
+          case WEDNESDAY_HASH:
+            if (name == "WEDNESDAY")
+            {
+              return DayOfWeek::WEDNESDAY;
+            }
+            break;
+          case THURSDAY_HASH:
+            if (name == "THURSDAY")
+            {
+              return DayOfWeek::THURSDAY;
+            }
+            break;
+          case FRIDAY_HASH:
+            if (name == "FRIDAY")
+            {
+              return DayOfWeek::FRIDAY;
+            }
+            break;
+          case SATURDAY_HASH:
+            if (name == "SATURDAY")
+            {
+              return DayOfWeek::SATURDAY;
+            }
+            break;
+          case SUNDAY_HASH:
+            if (name == "SUNDAY")
+            {
+              return DayOfWeek::SUNDAY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return DayOfWeek::NOT_SET;
         }
 
-        Aws::String GetNameForDayOfWeek(DayOfWeek enumValue)
+        const char* GetNameForDayOfWeek(DayOfWeek enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
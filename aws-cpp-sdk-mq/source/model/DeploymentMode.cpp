@@ -30,20 +30,30 @@ namespace Aws
       namespace DeploymentModeMapper
       {
 
-        static const int SINGLE_INSTANCE_HASH = HashingUtils::HashString("SINGLE_INSTANCE");
-        static const int ACTIVE_STANDBY_MULTI_AZ_HASH = HashingUtils::HashString("ACTIVE_STANDBY_MULTI_AZ");
+        static constexpr int SINGLE_INSTANCE_HASH = HashingUtils::CompileTimeHashString("SINGLE_INSTANCE");
+        static constexpr int ACTIVE_STANDBY_MULTI_AZ_HASH = HashingUtils::CompileTimeHashString("ACTIVE_STANDBY_MULTI_AZ");
 
 
         DeploymentMode GetDeploymentModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SINGLE_INSTANCE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeploymentMode::SINGLE_INSTANCE;
-          }
-          else if (hashCode == ACTIVE_STANDBY_MULTI_AZ_HASH)
-          {
-            return DeploymentMode::ACTIVE_STANDBY_MULTI_AZ;
+          case SINGLE_INSTANCE_HASH:
+            if (name == "SINGLE_INSTANCE")
+            {
+              return DeploymentMode::SINGLE_INSTANCE;
+            }
+            break;
+          case ACTIVE_STANDBY_MULTI_AZ_HASH:
+            if (name == "ACTIVE_STANDBY_MULTI_AZ")
+            {
+              return DeploymentMode::ACTIVE_STANDBY_MULTI_AZ;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DeploymentMode::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentMode(DeploymentMode enumValue)
+        const char* GetNameForDeploymentMode(DeploymentMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace EngineTypeMapper
       {
 
-        static const int ACTIVEMQ_HASH = HashingUtils::HashString("ACTIVEMQ");
+        static constexpr int ACTIVEMQ_HASH = HashingUtils::CompileTimeHashString("ACTIVEMQ");
 
 
         EngineType GetEngineTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVEMQ_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EngineType::ACTIVEMQ;
+          case ACTIVEMQ_HASH:
+            if (name == "ACTIVEMQ")
+            {
+              return EngineType::ACTIVEMQ;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return EngineType::NOT_SET;
         }
 
-        Aws::String GetNameForEngineType(EngineType enumValue)
+        const char* GetNameForEngineType(EngineType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace SanitizationWarningReasonMapper
       {
 
-        static const int DISALLOWED_ELEMENT_REMOVED_HASH = HashingUtils::HashString("DISALLOWED_ELEMENT_REMOVED");
-        static const int DISALLOWED_ATTRIBUTE_REMOVED_HASH = HashingUtils::HashString("DISALLOWED_ATTRIBUTE_REMOVED");
-        static const int INVALID_ATTRIBUTE_VALUE_REMOVED_HASH = HashingUtils::HashString("INVALID_ATTRIBUTE_VALUE_REMOVED");
+        static constexpr int DISALLOWED_ELEMENT_REMOVED_HASH = HashingUtils::CompileTimeHashString("DISALLOWED_ELEMENT_REMOVED");
+        static constexpr int DISALLOWED_ATTRIBUTE_REMOVED_HASH = HashingUtils::CompileTimeHashString("DISALLOWED_ATTRIBUTE_REMOVED");
+        static constexpr int INVALID_ATTRIBUTE_VALUE_REMOVED_HASH = HashingUtils::CompileTimeHashString("INVALID_ATTRIBUTE_VALUE_REMOVED");
 
 
         SanitizationWarningReason GetSanitizationWarningReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DISALLOWED_ELEMENT_REMOVED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SanitizationWarningReason::DISALLOWED_ELEMENT_REMOVED;
-          }
-          else if (hashCode == DISALLOWED_ATTRIBUTE_REMOVED_HASH)
-          {
-            return SanitizationWarningReason::DISALLOWED_ATTRIBUTE_REMOVED;
-          }
-          else if (hashCode == INVALID_ATTRIBUTE_VALUE_REMOVED_HASH)
-          {
-            return SanitizationWarningReason::INVALID_ATTRIBUTE_VALUE_REMOVED;
+          case DISALLOWED_ELEMENT_REMOVED_HASH:
+            if (name == "DISALLOWED_ELEMENT_REMOVED")
+            {
+              return SanitizationWarningReason::DISALLOWED_ELEMENT_REMOVED;
+            }
+            break;
+          case DISALLOWED_ATTRIBUTE_REMOVED_HASH:
+            if (name == "DISALLOWED_ATTRIBUTE_REMOVED")
+            {
+              return SanitizationWarningReason::DISALLOWED_ATTRIBUTE_REMOVED;
+            }
+            break;
+          case INVALID_ATTRIBUTE_VALUE_REMOVED_HASH:
+            if (name == "INVALID_ATTRIBUTE_VALUE_REMOVED")
+            {
+              return SanitizationWarningReason::INVALID_ATTRIBUTE_VALUE_REMOVED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return SanitizationWarningReason::NOT_SET;
         }
 
-        Aws::String GetNameForSanitizationWarningReason(SanitizationWarningReason enumValue)
+        const char* GetNameForSanitizationWarningReason(SanitizationWarningReason enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
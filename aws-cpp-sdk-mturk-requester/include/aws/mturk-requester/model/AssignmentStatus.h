@@ -35,7 +35,8 @@ namespace AssignmentStatusMapper
 {
 AWS_MTURK_API AssignmentStatus GetAssignmentStatusForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForAssignmentStatus(AssignmentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForAssignmentStatus(AssignmentStatus value);
 } // namespace AssignmentStatusMapper
 } // namespace Model
 } // namespace MTurk
@@ -42,7 +42,8 @@ namespace ComparatorMapper
 {
 AWS_MTURK_API Comparator GetComparatorForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForComparator(Comparator value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForComparator(Comparator value);
 } // namespace ComparatorMapper
 } // namespace Model
 } // namespace MTurk
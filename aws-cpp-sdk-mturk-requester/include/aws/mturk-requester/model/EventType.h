@@ -44,7 +44,8 @@ namespace EventTypeMapper
 {
 AWS_MTURK_API EventType GetEventTypeForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForEventType(EventType value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForEventType(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace MTurk
@@ -35,7 +35,8 @@ namespace HITAccessActionsMapper
 {
 AWS_MTURK_API HITAccessActions GetHITAccessActionsForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForHITAccessActions(HITAccessActions value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForHITAccessActions(HITAccessActions value);
 } // namespace HITAccessActionsMapper
 } // namespace Model
 } // namespace MTurk
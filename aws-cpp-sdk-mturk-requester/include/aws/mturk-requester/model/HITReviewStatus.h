@@ -36,7 +36,8 @@ namespace HITReviewStatusMapper
 {
 AWS_MTURK_API HITReviewStatus GetHITReviewStatusForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForHITReviewStatus(HITReviewStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForHITReviewStatus(HITReviewStatus value);
 } // namespace HITReviewStatusMapper
 } // namespace Model
 } // namespace MTurk
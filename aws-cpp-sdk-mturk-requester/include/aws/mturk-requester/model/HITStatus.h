@@ -37,7 +37,8 @@ namespace HITStatusMapper
 {
 AWS_MTURK_API HITStatus GetHITStatusForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForHITStatus(HITStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForHITStatus(HITStatus value);
 } // namespace HITStatusMapper
 } // namespace Model
 } // namespace MTurk
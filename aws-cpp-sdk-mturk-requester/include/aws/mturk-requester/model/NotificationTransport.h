@@ -35,7 +35,8 @@ namespace NotificationTransportMapper
 {
 AWS_MTURK_API NotificationTransport GetNotificationTransportForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForNotificationTransport(NotificationTransport value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForNotificationTransport(NotificationTransport value);
 } // namespace NotificationTransportMapper
 } // namespace Model
 } // namespace MTurk
@@ -34,7 +34,8 @@ namespace NotifyWorkersFailureCodeMapper
 {
 AWS_MTURK_API NotifyWorkersFailureCode GetNotifyWorkersFailureCodeForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForNotifyWorkersFailureCode(NotifyWorkersFailureCode value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForNotifyWorkersFailureCode(NotifyWorkersFailureCode value);
 } // namespace NotifyWorkersFailureCodeMapper
 } // namespace Model
 } // namespace MTurk
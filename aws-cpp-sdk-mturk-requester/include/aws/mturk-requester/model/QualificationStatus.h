@@ -34,7 +34,8 @@ namespace QualificationStatusMapper
 {
 AWS_MTURK_API QualificationStatus GetQualificationStatusForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForQualificationStatus(QualificationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForQualificationStatus(QualificationStatus value);
 } // namespace QualificationStatusMapper
 } // namespace Model
 } // namespace MTurk
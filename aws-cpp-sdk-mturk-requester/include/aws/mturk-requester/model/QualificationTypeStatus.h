@@ -34,7 +34,8 @@ namespace QualificationTypeStatusMapper
 {
 AWS_MTURK_API QualificationTypeStatus GetQualificationTypeStatusForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForQualificationTypeStatus(QualificationTypeStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForQualificationTypeStatus(QualificationTypeStatus value);
 } // namespace QualificationTypeStatusMapper
 } // namespace Model
 } // namespace MTurk
@@ -36,7 +36,8 @@ namespace ReviewActionStatusMapper
 {
 AWS_MTURK_API ReviewActionStatus GetReviewActionStatusForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForReviewActionStatus(ReviewActionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForReviewActionStatus(ReviewActionStatus value);
 } // namespace ReviewActionStatusMapper
 } // namespace Model
 } // namespace MTurk
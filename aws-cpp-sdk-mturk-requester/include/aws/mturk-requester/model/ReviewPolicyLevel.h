@@ -34,7 +34,8 @@ namespace ReviewPolicyLevelMapper
 {
 AWS_MTURK_API ReviewPolicyLevel GetReviewPolicyLevelForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForReviewPolicyLevel(ReviewPolicyLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForReviewPolicyLevel(ReviewPolicyLevel value);
 } // namespace ReviewPolicyLevelMapper
 } // namespace Model
 } // namespace MTurk
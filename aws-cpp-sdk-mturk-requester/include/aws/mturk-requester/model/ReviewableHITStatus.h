@@ -34,7 +34,8 @@ namespace ReviewableHITStatusMapper
 {
 AWS_MTURK_API ReviewableHITStatus GetReviewableHITStatusForName(const Aws::String& name);
 
-AWS_MTURK_API Aws::String GetNameForReviewableHITStatus(ReviewableHITStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_MTURK_API const char* GetNameForReviewableHITStatus(ReviewableHITStatus value);
 } // namespace ReviewableHITStatusMapper
 } // namespace Model
 } // namespace MTurk
@@ -28,8 +28,8 @@ namespace MTurk
 namespace MTurkErrorMapper
 {
 
-static const int REQUEST_HASH = HashingUtils::HashString("RequestError");
-static const int SERVICE_FAULT_HASH = HashingUtils::HashString("ServiceFault");
+static constexpr int REQUEST_HASH = HashingUtils::CompileTimeHashString("RequestError");
+static constexpr int SERVICE_FAULT_HASH = HashingUtils::CompileTimeHashString("ServiceFault");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
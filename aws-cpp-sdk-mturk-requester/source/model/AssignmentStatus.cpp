@@ -30,25 +30,37 @@ namespace Aws
       namespace AssignmentStatusMapper
       {
 
-        static const int Submitted_HASH = HashingUtils::HashString("Submitted");
-        static const int Approved_HASH = HashingUtils::HashString("Approved");
-        static const int Rejected_HASH = HashingUtils::HashString("Rejected");
+        static constexpr int Submitted_HASH = HashingUtils::CompileTimeHashString("Submitted");
+        static constexpr int Approved_HASH = HashingUtils::CompileTimeHashString("Approved");
+        static constexpr int Rejected_HASH = HashingUtils::CompileTimeHashString("Rejected");
 
 
         AssignmentStatus GetAssignmentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Submitted_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssignmentStatus::Submitted;
-          }
-          else if (hashCode == Approved_HASH)
-          {
-            return AssignmentStatus::Approved;
-          }
-          else if (hashCode == Rejected_HASH)
-          {
-            return AssignmentStatus::Rejected;
+          case Submitted_HASH:
+            if (name == "Submitted")
+            {
+              return AssignmentStatus::Submitted;
+            }
+            break;
+          case Approved_HASH:
+            if (name == "Approved")
+            {
+              return AssignmentStatus::Approved;
+            }
+            break;
+          case Rejected_HASH:
+            if (name == "Rejected")
+            {
+              return AssignmentStatus::Rejected;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AssignmentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAssignmentStatus(AssignmentStatus enumValue)
+        const char* GetNameForAssignmentStatus(AssignmentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
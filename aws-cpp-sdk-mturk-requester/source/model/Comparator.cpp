@@ -30,60 +30,86 @@ namespace Aws
       namespace ComparatorMapper
       {
 
-        static const int LessThan_HASH = HashingUtils::HashString("LessThan");
-        static const int LessThanOrEqualTo_HASH = HashingUtils::HashString("LessThanOrEqualTo");
-        static const int GreaterThan_HASH = HashingUtils::HashString("GreaterThan");
-        static const int GreaterThanOrEqualTo_HASH = HashingUtils::HashString("GreaterThanOrEqualTo");
-        static const int EqualTo_HASH = HashingUtils::HashString("EqualTo");
-        static const int NotEqualTo_HASH = HashingUtils::HashString("NotEqualTo");
-        static const int Exists_HASH = HashingUtils::HashString("Exists");
-        static const int DoesNotExist_HASH = HashingUtils::HashString("DoesNotExist");
-        static const int In_HASH = HashingUtils::HashString("In");
-        static const int NotIn_HASH = HashingUtils::HashString("NotIn");
+        static constexpr int LessThan_HASH = HashingUtils::CompileTimeHashString("LessThan");
+        static constexpr int LessThanOrEqualTo_HASH = HashingUtils::CompileTimeHashString("LessThanOrEqualTo");
+        static constexpr int GreaterThan_HASH = HashingUtils::CompileTimeHashString("GreaterThan");
+        static constexpr int GreaterThanOrEqualTo_HASH = HashingUtils::CompileTimeHashString("GreaterThanOrEqualTo");
+        static constexpr int EqualTo_HASH = HashingUtils::CompileTimeHashString("EqualTo");
+        static constexpr int NotEqualTo_HASH = HashingUtils::CompileTimeHashString("NotEqualTo");
+        static constexpr int Exists_HASH = HashingUtils::CompileTimeHashString("Exists");
+        static constexpr int DoesNotExist_HASH = HashingUtils::CompileTimeHashString("DoesNotExist");
+        static constexpr int In_HASH = HashingUtils::CompileTimeHashString("In");
+        static constexpr int NotIn_HASH = HashingUtils::CompileTimeHashString("NotIn");
 
 
         Comparator GetComparatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LessThan_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Comparator::LessThan;
-          }
-          else if (hashCode == LessThanOrEqualTo_HASH)
-          {
-            return Comparator::LessThanOrEqualTo;
-          }
-          else if (hashCode == GreaterThan_HASH)
-          {
-            return Comparator::GreaterThan;
-          }
-          else if (hashCode == GreaterThanOrEqualTo_HASH)
-          {
-            return Comparator::GreaterThanOrEqualTo;
-          }
-          else if (hashCode == EqualTo_HASH)
-          {
-            return Comparator::EqualTo;
-          }
-          else if (hashCode == NotEqualTo_HASH)
-          {
-            return Comparator::NotEqualTo;
-          }
-          else if (hashCode == Exists_HASH)
-          {
-            return Comparator::Exists;
-          }
-          else if (hashCode == DoesNotExist_HASH)
-          {
-            return Comparator::DoesNotExist;
-          }
-          else if (hashCode == In_HASH)
-          {
-            return Comparator::In;
-          }
-          else if (hashCode == NotIn_HASH)
-          {
-            return Comparator::NotIn;
+          case LessThan_HASH:
+            if (name == "LessThan")
+            {
+              return Comparator::LessThan;
+            }
+            break;
+          case LessThanOrEqualTo_HASH:
+            if (name == "LessThanOrEqualTo")
+            {
+              return Comparator::LessThanOrEqualTo;
+            }
+            break;
+          case GreaterThan_HASH:
+            if (name == "GreaterThan")
+            {
+              return Comparator::GreaterThan;
+            }
+            break;
+          case GreaterThanOrEqualTo_HASH:
+            if (name == "GreaterThanOrEqualTo")
+            {
+              return Comparator::GreaterThanOrEqualTo;
+            }
+            break;
+          case EqualTo_HASH:
+            if (name == "EqualTo")
+            {
+              return Comparator::EqualTo;
+            }
+            break;
+          case NotEqualTo_HASH:
+            if (name == "NotEqualTo")
+            {
+              return Comparator::NotEqualTo;
+            }
+            break;
+          case Exists_HASH:
+            if (name == "Exists")
+            {
+              return Comparator::Exists;
+            }
+            break;
+          case DoesNotExist_HASH:
+            if (name == "DoesNotExist")
+            {
+              return Comparator::DoesNotExist;
+            }
+            break;
+          case In_HASH:
+            if (name == "In")
+            {
+              return Comparator::In;
+            }
+            break;
+          case NotIn_HASH:
+            if (name == "NotIn")
+            {
+              return Comparator::NotIn;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return Comparator::NOT_SET;
         }
 
-        Aws::String GetNameForComparator(Comparator enumValue)
+        const char* GetNameForComparator(Comparator enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
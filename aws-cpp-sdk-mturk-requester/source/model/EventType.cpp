@@ -30,70 +30,100 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int AssignmentAccepted_HASH = HashingUtils::HashString("AssignmentAccepted");
-        static const int AssignmentAbandoned_HASH = HashingUtils::HashString("AssignmentAbandoned");
-        static const int AssignmentReturned_HASH = HashingUtils::HashString("AssignmentReturned");
-        static const int AssignmentSubmitted_HASH = HashingUtils::HashString("AssignmentSubmitted");
-        static const int AssignmentRejected_HASH = HashingUtils::HashString("AssignmentRejected");
-        static const int AssignmentApproved_HASH = HashingUtils::HashString("AssignmentApproved");
-        static const int HITCreated_HASH = HashingUtils::HashString("HITCreated");
-        static const int HITExpired_HASH = HashingUtils::HashString("HITExpired");
-        static const int HITReviewable_HASH = HashingUtils::HashString("HITReviewable");
-        static const int HITExtended_HASH = HashingUtils::HashString("HITExtended");
-        static const int HITDisposed_HASH = HashingUtils::HashString("HITDisposed");
-        static const int Ping_HASH = HashingUtils::HashString("Ping");
+        static constexpr int AssignmentAccepted_HASH = HashingUtils::CompileTimeHashString("AssignmentAccepted");
+        static constexpr int AssignmentAbandoned_HASH = HashingUtils::CompileTimeHashString("AssignmentAbandoned");
+        static constexpr int AssignmentReturned_HASH = HashingUtils::CompileTimeHashString("AssignmentReturned");
+        static constexpr int AssignmentSubmitted_HASH = HashingUtils::CompileTimeHashString("AssignmentSubmitted");
+        static constexpr int AssignmentRejected_HASH = HashingUtils::CompileTimeHashString("AssignmentRejected");
+        static constexpr int AssignmentApproved_HASH = HashingUtils::CompileTimeHashString("AssignmentApproved");
+        static constexpr int HITCreated_HASH = HashingUtils::CompileTimeHashString("HITCreated");
+        static constexpr int HITExpired_HASH = HashingUtils::CompileTimeHashString("HITExpired");
+        static constexpr int HITReviewable_HASH = HashingUtils::CompileTimeHashString("HITReviewable");
+        static constexpr int HITExtended_HASH = HashingUtils::CompileTimeHashString("HITExtended");
+        static constexpr int HITDisposed_HASH = HashingUtils::CompileTimeHashString("HITDisposed");
+        static constexpr int Ping_HASH = HashingUtils::CompileTimeHashString("Ping");
 
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AssignmentAccepted_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventType::AssignmentAccepted;
-          }
-          else if (hashCode == AssignmentAbandoned_HASH)
-          {
-            return EventType::AssignmentAbandoned;
-          }
-          else if (hashCode == AssignmentReturned_HASH)
-          {
-            return EventType::AssignmentReturned;
-          }
-          else if (hashCode == AssignmentSubmitted_HASH)
-          {
-            return EventType::AssignmentSubmitted;
-          }
-          else if (hashCode == AssignmentRejected_HASH)
-          {
-            return EventType::AssignmentRejected;
-          }
-          else if (hashCode == AssignmentApproved_HASH)
-          {
-            return EventType::AssignmentApproved;
-          }
-          else if (hashCode == HITCreated_HASH)
-          {
-            return EventType::HITCreated;
-          }
-          else if (hashCode == HITExpired_HASH)
-          {
-            return EventType::HITExpired;
-          }
-          else if (hashCode == HITReviewable_HASH)
-          {
-            return EventType::HITReviewable;
-          }
-          else if (hashCode == HITExtended_HASH)
-          {
-            return EventType::HITExtended;
-          }
-          else if (hashCode == HITDisposed_HASH)
-          {
-            return EventType::HITDisposed;
-          }
-          else if (hashCode == Ping_HASH)
-          {
-            return EventType::Ping;
+          case AssignmentAccepted_HASH:
+            if (name == "AssignmentAccepted")
+            {
+              return EventType::AssignmentAccepted;
+            }
+            break;
+          case AssignmentAbandoned_HASH:
+            if (name == "AssignmentAbandoned")
+            {
+              return EventType::AssignmentAbandoned;
+            }
+            break;
+          case AssignmentReturned_HASH:
+            if (name == "AssignmentReturned")
+            {
+              return EventType::AssignmentReturned;
+            }
+            break;
+          case AssignmentSubmitted_HASH:
+            if (name == "AssignmentSubmitted")
+            {
+              return EventType::AssignmentSubmitted;
+            }
+            break;
+          case AssignmentRejected_HASH:
+            if (name == "AssignmentRejected")
+            {
+              return EventType::AssignmentRejected;
+            }
+            break;
+          case AssignmentApproved_HASH:
+            if (name == "AssignmentApproved")
+            {
+              return EventType::AssignmentApproved;
+            }
+            break;
+          case HITCreated_HASH:
+            if (name == "HITCreated")
+            {
+              return EventType::HITCreated;
+            }
+            break;
+          case HITExpired_HASH:
+            if (name == "HITExpired")
+            {
+              return EventType::HITExpired;
+            }
+            break;
+          case HITReviewable_HASH:
+            if (name == "HITReviewable")
+            {
+              return EventType::HITReviewable;
+            }
+            break;
+          case HITExtended_HASH:
+            if (name == "HITExtended")
+            {
+              return EventType::HITExtended;
+            }
+            break;
+          case HITDisposed_HASH:
+            if (name == "HITDisposed")
+            {
+              return EventType::HITDisposed;
+            }
+            break;
+          case Ping_HASH:
+            if (name == "Ping")
+            {
+              return EventType::Ping;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventType(EventType enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace HITAccessActionsMapper
       {
 
-        static const int Accept_HASH = HashingUtils::HashString("Accept");
-        static const int PreviewAndAccept_HASH = HashingUtils::HashString("PreviewAndAccept");
-        static const int DiscoverPreviewAndAccept_HASH = HashingUtils::HashString("DiscoverPreviewAndAccept");
+        static constexpr int Accept_HASH = HashingUtils::CompileTimeHashString("Accept");
+        static constexpr int PreviewAndAccept_HASH = HashingUtils::CompileTimeHashString("PreviewAndAccept");
+        static constexpr int DiscoverPreviewAndAccept_HASH = HashingUtils::CompileTimeHashString("DiscoverPreviewAndAccept");
 
 
         HITAccessActions GetHITAccessActionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Accept_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HITAccessActions::Accept;
-          }
-          else if (hashCode == PreviewAndAccept_HASH)
-          {
-            return HITAccessActions::PreviewAndAccept;
-          }
-          else if (hashCode == DiscoverPreviewAndAccept_HASH)
-          {
-            return HITAccessActions::DiscoverPreviewAndAccept;
+          case Accept_HASH:
+            if (name == "Accept")
+            {
+              return HITAccessActions::Accept;
+            }
+            break;
+          case PreviewAndAccept_HASH:
+            if (name == "PreviewAndAccept")
+            {
+              return HITAccessActions::PreviewAndAccept;
+            }
+            break;
+          case DiscoverPreviewAndAccept_HASH:
+            if (name == "DiscoverPreviewAndAccept")
+            {
+              return HITAccessActions::DiscoverPreviewAndAccept;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return HITAccessActions::NOT_SET;
         }
 
-        Aws::String GetNameForHITAccessActions(HITAccessActions enumValue)
+        const char* GetNameForHITAccessActions(HITAccessActions enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace HITReviewStatusMapper
       {
 
-        static const int NotReviewed_HASH = HashingUtils::HashString("NotReviewed");
-        static const int MarkedForReview_HASH = HashingUtils::HashString("MarkedForReview");
-        static const int ReviewedAppropriate_HASH = HashingUtils::HashString("ReviewedAppropriate");
-        static const int ReviewedInappropriate_HASH = HashingUtils::HashString("ReviewedInappropriate");
+        static constexpr int NotReviewed_HASH = HashingUtils::CompileTimeHashString("NotReviewed");
+        static constexpr int MarkedForReview_HASH = HashingUtils::CompileTimeHashString("MarkedForReview");
+        static constexpr int ReviewedAppropriate_HASH = HashingUtils::CompileTimeHashString("ReviewedAppropriate");
+        static constexpr int ReviewedInappropriate_HASH = HashingUtils::CompileTimeHashString("ReviewedInappropriate");
 
 
         HITReviewStatus GetHITReviewStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NotReviewed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HITReviewStatus::NotReviewed;
-          }
-          else if (hashCode == MarkedForReview_HASH)
-          {
-            return HITReviewStatus::MarkedForReview;
-          }
-          else if (hashCode == ReviewedAppropriate_HASH)
-          {
-            return HITReviewStatus::ReviewedAppropriate;
-          }
-          else if (hashCode == ReviewedInappropriate_HASH)
-          {
-            return HITReviewStatus::ReviewedInappropriate;
+          case NotReviewed_HASH:
+            if (name == "NotReviewed")
+            {
+              return HITReviewStatus::NotReviewed;
+            }
+            break;
+          case MarkedForReview_HASH:
+            if (name == "MarkedForReview")
+            {
+              return HITReviewStatus::MarkedForReview;
+            }
+            break;
+          case ReviewedAppropriate_HASH:
+            if (name == "ReviewedAppropriate")
+            {
+              return HITReviewStatus::ReviewedAppropriate;
+            }
+            break;
+          case ReviewedInappropriate_HASH:
+            if (name == "ReviewedInappropriate")
+            {
+              return HITReviewStatus::ReviewedInappropriate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return HITReviewStatus::NOT_SET;
         }
 
-        Aws::String GetNameForHITReviewStatus(HITReviewStatus enumValue)
+        const char* GetNameForHITReviewStatus(HITReviewStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace HITStatusMapper
       {
 
-        static const int Assignable_HASH = HashingUtils::HashString("Assignable");
-        static const int Unassignable_HASH = HashingUtils::HashString("Unassignable");
-        static const int Reviewable_HASH = HashingUtils::HashString("Reviewable");
-        static const int Reviewing_HASH = HashingUtils::HashString("Reviewing");
-        static const int Disposed_HASH = HashingUtils::HashString("Disposed");
+        static constexpr int Assignable_HASH = HashingUtils::CompileTimeHashString("Assignable");
+        static constexpr int Unassignable_HASH = HashingUtils::CompileTimeHashString("Unassignable");
+        static constexpr int Reviewable_HASH = HashingUtils::CompileTimeHashString("Reviewable");
+        static constexpr int Reviewing_HASH = HashingUtils::CompileTimeHashString("Reviewing");
+        static constexpr int Disposed_HASH = HashingUtils::CompileTimeHashString("Disposed");
 
 
         HITStatus GetHITStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Assignable_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HITStatus::Assignable;
-          }
-          else if (hashCode == Unassignable_HASH)
-          {
-            return HITStatus::Unassignable;
-          }
-          else if (hashCode == Reviewable_HASH)
-          {
-            return HITStatus::Reviewable;
-          }
-          else if (hashCode == Reviewing_HASH)
-          {
-            return HITStatus::Reviewing;
-          }
-          else if (hashCode == Disposed_HASH)
-          {
-            return HITStatus::Disposed;
+          case Assignable_HASH:
+            if (name == "Assignable")
+            {
+              return HITStatus::Assignable;
+            }
+            break;
+          case Unassignable_HASH:
+            if (name == "Unassignable")
+            {
+              return HITStatus::Unassignable;
+            }
+            break;
+          case Reviewable_HASH:
+            if (name == "Reviewable")
+            {
+              return HITStatus::Reviewable;
+            }
+            break;
+          case Reviewing_HASH:
+            if (name == "Reviewing")
+            {
+              return HITStatus::Reviewing;
+            }
+            break;
+          case Disposed_HASH:
+            if (name == "Disposed")
+            {
+              return HITStatus::Disposed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return HITStatus::NOT_SET;
         }
 
-        Aws::String GetNameForHITStatus(HITStatus enumValue)
+        const char* GetNameForHITStatus(HITStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
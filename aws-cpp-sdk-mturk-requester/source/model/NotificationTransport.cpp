@@ -30,25 +30,37 @@ namespace Aws
       namespace NotificationTransportMapper
       {
 
-        static const int Email_HASH = HashingUtils::HashString("Email");
-        static const int SQS_HASH = HashingUtils::HashString("SQS");
-        static const int SNS_HASH = HashingUtils::HashString("SNS");
+        static constexpr int Email_HASH = HashingUtils::CompileTimeHashString("Email");
+        static constexpr int SQS_HASH = HashingUtils::CompileTimeHashString("SQS");
+        static constexpr int SNS_HASH = HashingUtils::CompileTimeHashString("SNS");
 
 
         NotificationTransport GetNotificationTransportForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Email_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotificationTransport::Email;
-          }
-          else if (hashCode == SQS_HASH)
-          {
-            return NotificationTransport::SQS;
-          }
-          else if (hashCode == SNS_HASH)
-          {
-            return NotificationTransport::SNS;
+          case Email_HASH:
+            if (name == "Email")
+            {
+              return NotificationTransport::Email;
+            }
+            break;
+          case SQS_HASH:
+            if (name == "SQS")
+            {
+              return NotificationTransport::SQS;
+            }
+            break;
+          case SNS_HASH:
+            if (name == "SNS")
+            {
+              return NotificationTransport::SNS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return NotificationTransport::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationTransport(NotificationTransport enumValue)
+        const char* GetNameForNotificationTransport(NotificationTransport enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
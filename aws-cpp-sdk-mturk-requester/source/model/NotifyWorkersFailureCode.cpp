@@ -30,20 +30,30 @@ namespace Aws
       namespace NotifyWorkersFailureCodeMapper
       {
 
-        static const int SoftFailure_HASH = HashingUtils::HashString("SoftFailure");
-        static const int HardFailure_HASH = HashingUtils::HashString("HardFailure");
+        static constexpr int SoftFailure_HASH = HashingUtils::CompileTimeHashString("SoftFailure");
+        static constexpr int HardFailure_HASH = HashingUtils::CompileTimeHashString("HardFailure");
 
 
         NotifyWorkersFailureCode GetNotifyWorkersFailureCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SoftFailure_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotifyWorkersFailureCode::SoftFailure;
-          }
-          else if (hashCode == HardFailure_HASH)
-          {
-            return NotifyWorkersFailureCode::HardFailure;
+          case SoftFailure_HASH:
+            if (name == "SoftFailure")
+            {
+              return NotifyWorkersFailureCode::SoftFailure;
+            }
+            break;
+          case HardFailure_HASH:
+            if (name == "HardFailure")
+            {
+              return NotifyWorkersFailureCode::HardFailure;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return NotifyWorkersFailureCode::NOT_SET;
         }
 
-        Aws::String GetNameForNotifyWorkersFailureCode(NotifyWorkersFailureCode enumValue)
+        const char* GetNameForNotifyWorkersFailureCode(NotifyWorkersFailureCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
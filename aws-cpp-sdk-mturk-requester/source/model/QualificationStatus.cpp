@@ -30,20 +30,30 @@ namespace Aws
       namespace QualificationStatusMapper
       {
 
-        static const int Granted_HASH = HashingUtils::HashString("Granted");
-        static const int Revoked_HASH = HashingUtils::HashString("Revoked");
+        static constexpr int Granted_HASH = HashingUtils::CompileTimeHashString("Granted");
+        static constexpr int Revoked_HASH = HashingUtils::CompileTimeHashString("Revoked");
 
 
         QualificationStatus GetQualificationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Granted_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QualificationStatus::Granted;
-          }
-          else if (hashCode == Revoked_HASH)
-          {
-            return QualificationStatus::Revoked;
+          case Granted_HASH:
+            if (name == "Granted")
+            {
+              return QualificationStatus::Granted;
+            }
+            break;
+          case Revoked_HASH:
+            if (name == "Revoked")
+            {
+              return QualificationStatus::Revoked;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return QualificationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForQualificationStatus(QualificationStatus enumValue)
+        const char* GetNameForQualificationStatus(QualificationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
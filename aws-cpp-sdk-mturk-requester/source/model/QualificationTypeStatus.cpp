@@ -30,20 +30,30 @@ namespace Aws
       namespace QualificationTypeStatusMapper
       {
 
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Inactive_HASH = HashingUtils::HashString("Inactive");
+        static constexpr int Active_HASH = HashingUtils::CompileTimeHashString("Active");
+        static constexpr int Inactive_HASH = HashingUtils::CompileTimeHashString("Inactive");
 
 
         QualificationTypeStatus GetQualificationTypeStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Active_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QualificationTypeStatus::Active;
-          }
-          else if (hashCode == Inactive_HASH)
-          {
-            return QualificationTypeStatus::Inactive;
+          case Active_HASH:
+            if (name == "Active")
+            {
+              return QualificationTypeStatus::Active;
+            }
+            break;
+          case Inactive_HASH:
+            if (name == "Inactive")
+            {
+              return QualificationTypeStatus::Inactive;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return QualificationTypeStatus::NOT_SET;
         }
 
-        Aws::String GetNameForQualificationTypeStatus(QualificationTypeStatus enumValue)
+        const char* GetNameForQualificationTypeStatus(QualificationTypeStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
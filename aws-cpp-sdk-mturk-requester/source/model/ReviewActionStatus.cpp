@@ -30,30 +30,44 @@ namespace Aws
       namespace ReviewActionStatusMapper
       {
 
-        static const int Intended_HASH = HashingUtils::HashString("Intended");
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
+        static constexpr int Intended_HASH = HashingUtils::CompileTimeHashString("Intended");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
 
 
         ReviewActionStatus GetReviewActionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Intended_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReviewActionStatus::Intended;
-          }
-          else if (hashCode == Succeeded_HASH)
-          {
-            return ReviewActionStatus::Succeeded;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ReviewActionStatus::Failed;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return ReviewActionStatus::Cancelled;
+          case Intended_HASH:
+            if (name == "Intended")
+            {
+              return ReviewActionStatus::Intended;
+            }
+            break;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return ReviewActionStatus::Succeeded;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return ReviewActionStatus::Failed;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return ReviewActionStatus::Cancelled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ReviewActionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReviewActionStatus(ReviewActionStatus enumValue)
+        const char* GetNameForReviewActionStatus(ReviewActionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
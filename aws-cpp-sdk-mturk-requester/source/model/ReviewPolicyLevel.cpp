@@ -30,20 +30,30 @@ namespace Aws
       namespace ReviewPolicyLevelMapper
       {
 
-        static const int Assignment_HASH = HashingUtils::HashString("Assignment");
-        static const int HIT_HASH = HashingUtils::HashString("HIT");
+        static constexpr int Assignment_HASH = HashingUtils::CompileTimeHashString("Assignment");
+        static constexpr int HIT_HASH = HashingUtils::CompileTimeHashString("HIT");
 
 
         ReviewPolicyLevel GetReviewPolicyLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Assignment_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReviewPolicyLevel::Assignment;
-          }
-          else if (hashCode == HIT_HASH)
-          {
-            return ReviewPolicyLevel::HIT;
+          case Assignment_HASH:
+            if (name == "Assignment")
+            {
+              return ReviewPolicyLevel::Assignment;
+            }
+            break;
+          case HIT_HASH:
+            if (name == "HIT")
+            {
+              return ReviewPolicyLevel::HIT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReviewPolicyLevel::NOT_SET;
         }
 
-        Aws::String GetNameForReviewPolicyLevel(ReviewPolicyLevel enumValue)
+        const char* GetNameForReviewPolicyLevel(ReviewPolicyLevel enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ReviewableHITStatusMapper
       {
 
-        static const int Reviewable_HASH = HashingUtils::HashString("Reviewable");
-        static const int Reviewing_HASH = HashingUtils::HashString("Reviewing");
+        static constexpr int Reviewable_HASH = HashingUtils::CompileTimeHashString("Reviewable");
+        static constexpr int Reviewing_HASH = HashingUtils::CompileTimeHashString("Reviewing");
 
 
         ReviewableHITStatus GetReviewableHITStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Reviewable_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReviewableHITStatus::Reviewable;
-          }
-          else if (hashCode == Reviewing_HASH)
-          {
-            return ReviewableHITStatus::Reviewing;
+          case Reviewable_HASH:
+            if (name == "Reviewable")
+            {
+              return ReviewableHITStatus::Reviewable;
+            }
+            break;
+          case Reviewing_HASH:
+            if (name == "Reviewing")
+            {
+              return ReviewableHITStatus::Reviewing;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReviewableHITStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReviewableHITStatus(ReviewableHITStatus enumValue)
+        const char* GetNameForReviewableHITStatus(ReviewableHITStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
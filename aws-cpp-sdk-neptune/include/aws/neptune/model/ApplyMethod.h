@@ -34,7 +34,8 @@ namespace ApplyMethodMapper
 {
 AWS_NEPTUNE_API ApplyMethod GetApplyMethodForName(const Aws::String& name);
 
-AWS_NEPTUNE_API Aws::String GetNameForApplyMethod(ApplyMethod value);
+// names of values not modeled point into the enum overflow container
+AWS_NEPTUNE_API const char* GetNameForApplyMethod(ApplyMethod value);
 } // namespace ApplyMethodMapper
 } // namespace Model
 } // namespace Neptune
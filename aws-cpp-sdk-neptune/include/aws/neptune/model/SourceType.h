@@ -38,7 +38,8 @@ namespace SourceTypeMapper
 {
 AWS_NEPTUNE_API SourceType GetSourceTypeForName(const Aws::String& name);
 
-AWS_NEPTUNE_API Aws::String GetNameForSourceType(SourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_NEPTUNE_API const char* GetNameForSourceType(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace Neptune
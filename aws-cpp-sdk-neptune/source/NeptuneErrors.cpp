@@ -28,65 +28,65 @@ namespace Neptune
 namespace NeptuneErrorMapper
 {
 
-static const int D_B_SNAPSHOT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("DBSnapshotAlreadyExists");
-static const int PROVISIONED_IOPS_NOT_AVAILABLE_IN_A_Z_FAULT_HASH = HashingUtils::HashString("ProvisionedIopsNotAvailableInAZFault");
-static const int D_B_CLUSTER_PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DBClusterParameterGroupNotFound");
-static const int SNAPSHOT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("SnapshotQuotaExceeded");
-static const int D_B_SECURITY_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DBSecurityGroupNotFound");
-static const int S_N_S_INVALID_TOPIC_FAULT_HASH = HashingUtils::HashString("SNSInvalidTopic");
-static const int D_B_UPGRADE_DEPENDENCY_FAILURE_FAULT_HASH = HashingUtils::HashString("DBUpgradeDependencyFailure");
-static const int INVALID_D_B_SECURITY_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidDBSecurityGroupState");
-static const int INVALID_D_B_CLUSTER_SNAPSHOT_STATE_FAULT_HASH = HashingUtils::HashString("InvalidDBClusterSnapshotStateFault");
-static const int AUTHORIZATION_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("AuthorizationNotFound");
-static const int INVALID_D_B_PARAMETER_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidDBParameterGroupState");
-static const int STORAGE_TYPE_NOT_SUPPORTED_FAULT_HASH = HashingUtils::HashString("StorageTypeNotSupported");
-static const int INVALID_D_B_SUBNET_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidDBSubnetGroupStateFault");
-static const int D_B_CLUSTER_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DBClusterNotFoundFault");
-static const int SUBSCRIPTION_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SubscriptionNotFound");
-static const int INVALID_EVENT_SUBSCRIPTION_STATE_FAULT_HASH = HashingUtils::HashString("InvalidEventSubscriptionState");
-static const int D_B_INSTANCE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DBInstanceNotFound");
-static const int OPTION_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("OptionGroupNotFoundFault");
-static const int D_B_PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DBParameterGroupNotFound");
-static const int D_B_INSTANCE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("DBInstanceAlreadyExists");
-static const int DOMAIN_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DomainNotFoundFault");
-static const int INVALID_D_B_CLUSTER_STATE_FAULT_HASH = HashingUtils::HashString("InvalidDBClusterStateFault");
-static const int INSUFFICIENT_D_B_INSTANCE_CAPACITY_FAULT_HASH = HashingUtils::HashString("InsufficientDBInstanceCapacity");
-static const int D_B_CLUSTER_SNAPSHOT_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DBClusterSnapshotNotFoundFault");
-static const int SHARED_SNAPSHOT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("SharedSnapshotQuotaExceeded");
-static const int D_B_CLUSTER_ROLE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("DBClusterRoleAlreadyExists");
-static const int K_M_S_KEY_NOT_ACCESSIBLE_FAULT_HASH = HashingUtils::HashString("KMSKeyNotAccessibleFault");
-static const int INSUFFICIENT_STORAGE_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::HashString("InsufficientStorageClusterCapacity");
-static const int INSTANCE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("InstanceQuotaExceeded");
-static const int D_B_SUBNET_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("DBSubnetQuotaExceededFault");
-static const int D_B_CLUSTER_ROLE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("DBClusterRoleQuotaExceeded");
-static const int INVALID_D_B_SNAPSHOT_STATE_FAULT_HASH = HashingUtils::HashString("InvalidDBSnapshotState");
-static const int D_B_PARAMETER_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("DBParameterGroupAlreadyExists");
-static const int S_N_S_NO_AUTHORIZATION_FAULT_HASH = HashingUtils::HashString("SNSNoAuthorization");
-static const int S_N_S_TOPIC_ARN_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SNSTopicArnNotFound");
-static const int D_B_CLUSTER_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("DBClusterQuotaExceededFault");
-static const int EVENT_SUBSCRIPTION_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("EventSubscriptionQuotaExceeded");
-static const int SUBNET_ALREADY_IN_USE_HASH = HashingUtils::HashString("SubnetAlreadyInUse");
-static const int INSUFFICIENT_D_B_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::HashString("InsufficientDBClusterCapacityFault");
-static const int INVALID_V_P_C_NETWORK_STATE_FAULT_HASH = HashingUtils::HashString("InvalidVPCNetworkStateFault");
-static const int D_B_SUBNET_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("DBSubnetGroupAlreadyExists");
-static const int D_B_CLUSTER_SNAPSHOT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("DBClusterSnapshotAlreadyExistsFault");
-static const int SOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SourceNotFound");
-static const int D_B_SUBNET_GROUP_DOES_NOT_COVER_ENOUGH_A_ZS_HASH = HashingUtils::HashString("DBSubnetGroupDoesNotCoverEnoughAZs");
-static const int D_B_CLUSTER_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("DBClusterAlreadyExistsFault");
-static const int D_B_SNAPSHOT_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DBSnapshotNotFound");
-static const int SUBSCRIPTION_CATEGORY_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SubscriptionCategoryNotFound");
-static const int RESOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ResourceNotFoundFault");
-static const int INVALID_SUBNET_HASH = HashingUtils::HashString("InvalidSubnet");
-static const int INVALID_D_B_INSTANCE_STATE_FAULT_HASH = HashingUtils::HashString("InvalidDBInstanceState");
-static const int D_B_SUBNET_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("DBSubnetGroupQuotaExceeded");
-static const int D_B_CLUSTER_ROLE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DBClusterRoleNotFound");
-static const int CERTIFICATE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("CertificateNotFound");
-static const int SUBSCRIPTION_ALREADY_EXIST_FAULT_HASH = HashingUtils::HashString("SubscriptionAlreadyExist");
-static const int INVALID_D_B_SUBNET_STATE_FAULT_HASH = HashingUtils::HashString("InvalidDBSubnetStateFault");
-static const int INVALID_RESTORE_FAULT_HASH = HashingUtils::HashString("InvalidRestoreFault");
-static const int D_B_PARAMETER_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("DBParameterGroupQuotaExceeded");
-static const int D_B_SUBNET_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("DBSubnetGroupNotFoundFault");
-static const int STORAGE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("StorageQuotaExceeded");
+static constexpr int D_B_SNAPSHOT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("DBSnapshotAlreadyExists");
+static constexpr int PROVISIONED_IOPS_NOT_AVAILABLE_IN_A_Z_FAULT_HASH = HashingUtils::CompileTimeHashString("ProvisionedIopsNotAvailableInAZFault");
+static constexpr int D_B_CLUSTER_PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DBClusterParameterGroupNotFound");
+static constexpr int SNAPSHOT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotQuotaExceeded");
+static constexpr int D_B_SECURITY_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DBSecurityGroupNotFound");
+static constexpr int S_N_S_INVALID_TOPIC_FAULT_HASH = HashingUtils::CompileTimeHashString("SNSInvalidTopic");
+static constexpr int D_B_UPGRADE_DEPENDENCY_FAILURE_FAULT_HASH = HashingUtils::CompileTimeHashString("DBUpgradeDependencyFailure");
+static constexpr int INVALID_D_B_SECURITY_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidDBSecurityGroupState");
+static constexpr int INVALID_D_B_CLUSTER_SNAPSHOT_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidDBClusterSnapshotStateFault");
+static constexpr int AUTHORIZATION_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("AuthorizationNotFound");
+static constexpr int INVALID_D_B_PARAMETER_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidDBParameterGroupState");
+static constexpr int STORAGE_TYPE_NOT_SUPPORTED_FAULT_HASH = HashingUtils::CompileTimeHashString("StorageTypeNotSupported");
+static constexpr int INVALID_D_B_SUBNET_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidDBSubnetGroupStateFault");
+static constexpr int D_B_CLUSTER_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DBClusterNotFoundFault");
+static constexpr int SUBSCRIPTION_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SubscriptionNotFound");
+static constexpr int INVALID_EVENT_SUBSCRIPTION_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidEventSubscriptionState");
+static constexpr int D_B_INSTANCE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DBInstanceNotFound");
+static constexpr int OPTION_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("OptionGroupNotFoundFault");
+static constexpr int D_B_PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DBParameterGroupNotFound");
+static constexpr int D_B_INSTANCE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("DBInstanceAlreadyExists");
+static constexpr int DOMAIN_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DomainNotFoundFault");
+static constexpr int INVALID_D_B_CLUSTER_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidDBClusterStateFault");
+static constexpr int INSUFFICIENT_D_B_INSTANCE_CAPACITY_FAULT_HASH = HashingUtils::CompileTimeHashString("InsufficientDBInstanceCapacity");
+static constexpr int D_B_CLUSTER_SNAPSHOT_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DBClusterSnapshotNotFoundFault");
+static constexpr int SHARED_SNAPSHOT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("SharedSnapshotQuotaExceeded");
+static constexpr int D_B_CLUSTER_ROLE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("DBClusterRoleAlreadyExists");
+static constexpr int K_M_S_KEY_NOT_ACCESSIBLE_FAULT_HASH = HashingUtils::CompileTimeHashString("KMSKeyNotAccessibleFault");
+static constexpr int INSUFFICIENT_STORAGE_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::CompileTimeHashString("InsufficientStorageClusterCapacity");
+static constexpr int INSTANCE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("InstanceQuotaExceeded");
+static constexpr int D_B_SUBNET_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("DBSubnetQuotaExceededFault");
+static constexpr int D_B_CLUSTER_ROLE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("DBClusterRoleQuotaExceeded");
+static constexpr int INVALID_D_B_SNAPSHOT_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidDBSnapshotState");
+static constexpr int D_B_PARAMETER_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("DBParameterGroupAlreadyExists");
+static constexpr int S_N_S_NO_AUTHORIZATION_FAULT_HASH = HashingUtils::CompileTimeHashString("SNSNoAuthorization");
+static constexpr int S_N_S_TOPIC_ARN_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SNSTopicArnNotFound");
+static constexpr int D_B_CLUSTER_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("DBClusterQuotaExceededFault");
+static constexpr int EVENT_SUBSCRIPTION_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("EventSubscriptionQuotaExceeded");
+static constexpr int SUBNET_ALREADY_IN_USE_HASH = HashingUtils::CompileTimeHashString("SubnetAlreadyInUse");
+static constexpr int INSUFFICIENT_D_B_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::CompileTimeHashString("InsufficientDBClusterCapacityFault");
+static constexpr int INVALID_V_P_C_NETWORK_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidVPCNetworkStateFault");
+static constexpr int D_B_SUBNET_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("DBSubnetGroupAlreadyExists");
+static constexpr int D_B_CLUSTER_SNAPSHOT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("DBClusterSnapshotAlreadyExistsFault");
+static constexpr int SOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SourceNotFound");
+static constexpr int D_B_SUBNET_GROUP_DOES_NOT_COVER_ENOUGH_A_ZS_HASH = HashingUtils::CompileTimeHashString("DBSubnetGroupDoesNotCoverEnoughAZs");
+static constexpr int D_B_CLUSTER_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("DBClusterAlreadyExistsFault");
+static constexpr int D_B_SNAPSHOT_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DBSnapshotNotFound");
+static constexpr int SUBSCRIPTION_CATEGORY_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SubscriptionCategoryNotFound");
+static constexpr int RESOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ResourceNotFoundFault");
+static constexpr int INVALID_SUBNET_HASH = HashingUtils::CompileTimeHashString("InvalidSubnet");
+static constexpr int INVALID_D_B_INSTANCE_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidDBInstanceState");
+static constexpr int D_B_SUBNET_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("DBSubnetGroupQuotaExceeded");
+static constexpr int D_B_CLUSTER_ROLE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DBClusterRoleNotFound");
+static constexpr int CERTIFICATE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("CertificateNotFound");
+static constexpr int SUBSCRIPTION_ALREADY_EXIST_FAULT_HASH = HashingUtils::CompileTimeHashString("SubscriptionAlreadyExist");
+static constexpr int INVALID_D_B_SUBNET_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidDBSubnetStateFault");
+static constexpr int INVALID_RESTORE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidRestoreFault");
+static constexpr int D_B_PARAMETER_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("DBParameterGroupQuotaExceeded");
+static constexpr int D_B_SUBNET_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("DBSubnetGroupNotFoundFault");
+static constexpr int STORAGE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("StorageQuotaExceeded");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,40 +30,58 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int db_instance_HASH = HashingUtils::HashString("db-instance");
-        static const int db_parameter_group_HASH = HashingUtils::HashString("db-parameter-group");
-        static const int db_security_group_HASH = HashingUtils::HashString("db-security-group");
-        static const int db_snapshot_HASH = HashingUtils::HashString("db-snapshot");
-        static const int db_cluster_HASH = HashingUtils::HashString("db-cluster");
-        static const int db_cluster_snapshot_HASH = HashingUtils::HashString("db-cluster-snapshot");
+        static constexpr int db_instance_HASH = HashingUtils::CompileTimeHashString("db-instance");
+        static constexpr int db_parameter_group_HASH = HashingUtils::CompileTimeHashString("db-parameter-group");
+        static constexpr int db_security_group_HASH = HashingUtils::CompileTimeHashString("db-security-group");
+        static constexpr int db_snapshot_HASH = HashingUtils::CompileTimeHashString("db-snapshot");
+        static constexpr int db_cluster_HASH = HashingUtils::CompileTimeHashString("db-cluster");
+        static constexpr int db_cluster_snapshot_HASH = HashingUtils::CompileTimeHashString("db-cluster-snapshot");
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == db_instance_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceType::db_instance;
-          }
-          else if (hashCode == db_parameter_group_HASH)
-          {
-            return SourceType::db_parameter_group;
-          }
-          else if (hashCode == db_security_group_HASH)
-          {
-            return SourceType::db_security_group;
-          }
-          else if (hashCode == db_snapshot_HASH)
-          {
-            return SourceType::db_snapshot;
-          }
-          else if (hashCode == db_cluster_HASH)
-          {
-            return SourceType::db_cluster;
-          }
-          else if (hashCode == db_cluster_snapshot_HASH)
-          {
-            return SourceType::db_cluster_snapshot;
+          case db_instance_HASH:
+            if (name == "db-instance")
+            {
+              return SourceType::db_instance;
+            }
+            break;
+          case db_parameter_group_HASH:
+            if (name == "db-parameter-group")
+            {
+              return SourceType::db_parameter_group;
+            }
+            break;
+          case db_security_group_HASH:
+            if (name == "db-security-group")
+            {
+              return SourceType::db_security_group;
+            }
+            break;
+          case db_snapshot_HASH:
+            if (name == "db-snapshot")
+            {
+              return SourceType::db_snapshot;
+            }
+            break;
+          case db_cluster_HASH:
+            if (name == "db-cluster")
+            {
+              return SourceType::db_cluster;
+            }
+            break;
+          case db_cluster_snapshot_HASH:
+            if (name == "db-cluster-snapshot")
+            {
+              return SourceType::db_cluster_snapshot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceType(SourceType enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -36,7 +36,8 @@ namespace AppAttributesKeysMapper
 {
 AWS_OPSWORKS_API AppAttributesKeys GetAppAttributesKeysForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForAppAttributesKeys(AppAttributesKeys value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForAppAttributesKeys(AppAttributesKeys value);
 } // namespace AppAttributesKeysMapper
 } // namespace Model
 } // namespace OpsWorks
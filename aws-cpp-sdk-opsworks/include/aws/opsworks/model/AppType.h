@@ -39,7 +39,8 @@ namespace AppTypeMapper
 {
 AWS_OPSWORKS_API AppType GetAppTypeForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForAppType(AppType value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForAppType(AppType value);
 } // namespace AppTypeMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -34,7 +34,8 @@ namespace ArchitectureMapper
 {
 AWS_OPSWORKS_API Architecture GetArchitectureForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForArchitecture(Architecture value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForArchitecture(Architecture value);
 } // namespace ArchitectureMapper
 } // namespace Model
 } // namespace OpsWorks
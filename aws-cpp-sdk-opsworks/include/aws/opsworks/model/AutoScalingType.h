@@ -34,7 +34,8 @@ namespace AutoScalingTypeMapper
 {
 AWS_OPSWORKS_API AutoScalingType GetAutoScalingTypeForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForAutoScalingType(AutoScalingType value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForAutoScalingType(AutoScalingType value);
 } // namespace AutoScalingTypeMapper
 } // namespace Model
 } // namespace OpsWorks
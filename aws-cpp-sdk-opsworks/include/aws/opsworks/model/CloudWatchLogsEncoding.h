@@ -124,7 +124,8 @@ namespace CloudWatchLogsEncodingMapper
 {
 AWS_OPSWORKS_API CloudWatchLogsEncoding GetCloudWatchLogsEncodingForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForCloudWatchLogsEncoding(CloudWatchLogsEncoding value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForCloudWatchLogsEncoding(CloudWatchLogsEncoding value);
 } // namespace CloudWatchLogsEncodingMapper
 } // namespace Model
 } // namespace OpsWorks
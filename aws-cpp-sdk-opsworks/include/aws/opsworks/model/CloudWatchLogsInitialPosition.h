@@ -34,7 +34,8 @@ namespace CloudWatchLogsInitialPositionMapper
 {
 AWS_OPSWORKS_API CloudWatchLogsInitialPosition GetCloudWatchLogsInitialPositionForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForCloudWatchLogsInitialPosition(CloudWatchLogsInitialPosition value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForCloudWatchLogsInitialPosition(CloudWatchLogsInitialPosition value);
 } // namespace CloudWatchLogsInitialPositionMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -34,7 +34,8 @@ namespace CloudWatchLogsTimeZoneMapper
 {
 AWS_OPSWORKS_API CloudWatchLogsTimeZone GetCloudWatchLogsTimeZoneForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForCloudWatchLogsTimeZone(CloudWatchLogsTimeZone value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForCloudWatchLogsTimeZone(CloudWatchLogsTimeZone value);
 } // namespace CloudWatchLogsTimeZoneMapper
 } // namespace Model
 } // namespace OpsWorks
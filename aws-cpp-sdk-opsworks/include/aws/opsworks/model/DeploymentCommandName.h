@@ -44,7 +44,8 @@ namespace DeploymentCommandNameMapper
 {
 AWS_OPSWORKS_API DeploymentCommandName GetDeploymentCommandNameForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForDeploymentCommandName(DeploymentCommandName value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForDeploymentCommandName(DeploymentCommandName value);
 } // namespace DeploymentCommandNameMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -57,7 +57,8 @@ namespace LayerAttributesKeysMapper
 {
 AWS_OPSWORKS_API LayerAttributesKeys GetLayerAttributesKeysForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForLayerAttributesKeys(LayerAttributesKeys value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForLayerAttributesKeys(LayerAttributesKeys value);
 } // namespace LayerAttributesKeysMapper
 } // namespace Model
 } // namespace OpsWorks
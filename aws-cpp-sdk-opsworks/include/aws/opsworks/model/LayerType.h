@@ -44,7 +44,8 @@ namespace LayerTypeMapper
 {
 AWS_OPSWORKS_API LayerType GetLayerTypeForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForLayerType(LayerType value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForLayerType(LayerType value);
 } // namespace LayerTypeMapper
 } // namespace Model
 } // namespace OpsWorks
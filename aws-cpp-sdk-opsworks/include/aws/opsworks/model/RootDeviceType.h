@@ -34,7 +34,8 @@ namespace RootDeviceTypeMapper
 {
 AWS_OPSWORKS_API RootDeviceType GetRootDeviceTypeForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForRootDeviceType(RootDeviceType value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForRootDeviceType(RootDeviceType value);
 } // namespace RootDeviceTypeMapper
 } // namespace Model
 } // namespace OpsWorks
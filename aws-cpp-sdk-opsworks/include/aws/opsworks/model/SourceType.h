@@ -36,7 +36,8 @@ namespace SourceTypeMapper
 {
 AWS_OPSWORKS_API SourceType GetSourceTypeForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForSourceType(SourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForSourceType(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -33,7 +33,8 @@ namespace StackAttributesKeysMapper
 {
 AWS_OPSWORKS_API StackAttributesKeys GetStackAttributesKeysForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForStackAttributesKeys(StackAttributesKeys value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForStackAttributesKeys(StackAttributesKeys value);
 } // namespace StackAttributesKeysMapper
 } // namespace Model
 } // namespace OpsWorks
@@ -34,7 +34,8 @@ namespace VirtualizationTypeMapper
 {
 AWS_OPSWORKS_API VirtualizationType GetVirtualizationTypeForName(const Aws::String& name);
 
-AWS_OPSWORKS_API Aws::String GetNameForVirtualizationType(VirtualizationType value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKS_API const char* GetNameForVirtualizationType(VirtualizationType value);
 } // namespace VirtualizationTypeMapper
 } // namespace Model
 } // namespace OpsWorks
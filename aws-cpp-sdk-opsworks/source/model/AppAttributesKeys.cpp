@@ -30,30 +30,44 @@ namespace Aws
       namespace AppAttributesKeysMapper
       {
 
-        static const int DocumentRoot_HASH = HashingUtils::HashString("DocumentRoot");
-        static const int RailsEnv_HASH = HashingUtils::HashString("RailsEnv");
-        static const int AutoBundleOnDeploy_HASH = HashingUtils::HashString("AutoBundleOnDeploy");
-        static const int AwsFlowRubySettings_HASH = HashingUtils::HashString("AwsFlowRubySettings");
+        static constexpr int DocumentRoot_HASH = HashingUtils::CompileTimeHashString("DocumentRoot");
+        static constexpr int RailsEnv_HASH = HashingUtils::CompileTimeHashString("RailsEnv");
+        static constexpr int AutoBundleOnDeploy_HASH = HashingUtils::CompileTimeHashString("AutoBundleOnDeploy");
+        static constexpr int AwsFlowRubySettings_HASH = HashingUtils::CompileTimeHashString("AwsFlowRubySettings");
 
 
         AppAttributesKeys GetAppAttributesKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DocumentRoot_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AppAttributesKeys::DocumentRoot;
-          }
-          else if (hashCode == RailsEnv_HASH)
-          {
-            return AppAttributesKeys::RailsEnv;
-          }
-          else if (hashCode == AutoBundleOnDeploy_HASH)
-          {
-            return AppAttributesKeys::AutoBundleOnDeploy;
-          }
-          else if (hashCode == AwsFlowRubySettings_HASH)
-          {
-            return AppAttributesKeys::AwsFlowRubySettings;
+          case DocumentRoot_HASH:
+            if (name == "DocumentRoot")
+            {
+              return AppAttributesKeys::DocumentRoot;
+            }
+            break;
+          case RailsEnv_HASH:
+            if (name == "RailsEnv")
+            {
+              return AppAttributesKeys::RailsEnv;
+            }
+            break;
+          case AutoBundleOnDeploy_HASH:
+            if (name == "AutoBundleOnDeploy")
+            {
+              return AppAttributesKeys::AutoBundleOnDeploy;
+            }
+            break;
+          case AwsFlowRubySettings_HASH:
+            if (name == "AwsFlowRubySettings")
+            {
+              return AppAttributesKeys::AwsFlowRubySettings;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return AppAttributesKeys::NOT_SET;
         }
 
-        Aws::String GetNameForAppAttributesKeys(AppAttributesKeys enumValue)
+        const char* GetNameForAppAttributesKeys(AppAttributesKeys enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
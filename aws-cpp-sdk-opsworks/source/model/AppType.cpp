@@ -30,45 +30,65 @@ namespace Aws
       namespace AppTypeMapper
       {
 
-        static const int aws_flow_ruby_HASH = HashingUtils::HashString("aws-flow-ruby");
-        static const int java_HASH = HashingUtils::HashString("java");
-        static const int rails_HASH = HashingUtils::HashString("rails");
-        static const int php_HASH = HashingUtils::HashString("php");
-        static const int nodejs_HASH = HashingUtils::HashString("nodejs");
-        static const int static__HASH = HashingUtils::HashString("static");
-        static const int other_HASH = HashingUtils::HashString("other");
+        static constexpr int aws_flow_ruby_HASH = HashingUtils::CompileTimeHashString("aws-flow-ruby");
+        static constexpr int java_HASH = HashingUtils::CompileTimeHashString("java");
+        static constexpr int rails_HASH = HashingUtils::CompileTimeHashString("rails");
+        static constexpr int php_HASH = HashingUtils::CompileTimeHashString("php");
+        static constexpr int nodejs_HASH = HashingUtils::CompileTimeHashString("nodejs");
+        static constexpr int static__HASH = HashingUtils::CompileTimeHashString("static");
+        static constexpr int other_HASH = HashingUtils::CompileTimeHashString("other");
 
 
         AppType GetAppTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_flow_ruby_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AppType::aws_flow_ruby;
-          }
-          else if (hashCode == java_HASH)
-          {
-            return AppType::java;
-          }
-          else if (hashCode == rails_HASH)
-          {
-            return AppType::rails;
-          }
-          else if (hashCode == php_HASH)
-          {
-            return AppType::php;
-          }
-          else if (hashCode == nodejs_HASH)
-          {
-            return AppType::nodejs;
-          }
-          else if (hashCode == static__HASH)
-          {
-            return AppType::static_;
-          }
-          else if (hashCode == other_HASH)
-          {
-            return AppType::other;
+          case aws_flow_ruby_HASH:
+            if (name == "aws-flow-ruby")
+            {
+              return AppType::aws_flow_ruby;
+            }
+            break;
+          case java_HASH:
+            if (name == "java")
+            {
+              return AppType::java;
+            }
+            break;
+          case rails_HASH:
+            if (name == "rails")
+            {
+              return AppType::rails;
+            }
+            break;
+          case php_HASH:
+            if (name == "php")
+            {
+              return AppType::php;
+            }
+            break;
+          case nodejs_HASH:
+            if (name == "nodejs")
+            {
+              return AppType::nodejs;
+            }
+            break;
+          case static__HASH:
+            if (name == "static")
+            {
+              return AppType::static_;
+            }
+            break;
+          case other_HASH:
+            if (name == "other")
+            {
+              return AppType::other;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return AppType::NOT_SET;
         }
 
-        Aws::String GetNameForAppType(AppType enumValue)
+        const char* GetNameForAppType(AppType enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ArchitectureMapper
       {
 
-        static const int x86_64_HASH = HashingUtils::HashString("x86_64");
-        static const int i386_HASH = HashingUtils::HashString("i386");
+        static constexpr int x86_64_HASH = HashingUtils::CompileTimeHashString("x86_64");
+        static constexpr int i386_HASH = HashingUtils::CompileTimeHashString("i386");
 
 
         Architecture GetArchitectureForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == x86_64_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Architecture::x86_64;
-          }
-          else if (hashCode == i386_HASH)
-          {
-            return Architecture::i386;
+          case x86_64_HASH:
+            if (name == "x86_64")
+            {
+              return Architecture::x86_64;
+            }
+            break;
+          case i386_HASH:
+            if (name == "i386")
+            {
+              return Architecture::i386;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Architecture::NOT_SET;
         }
 
-        Aws::String GetNameForArchitecture(Architecture enumValue)
+        const char* GetNameForArchitecture(Architecture enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace AutoScalingTypeMapper
       {
 
-        static const int load_HASH = HashingUtils::HashString("load");
-        static const int timer_HASH = HashingUtils::HashString("timer");
+        static constexpr int load_HASH = HashingUtils::CompileTimeHashString("load");
+        static constexpr int timer_HASH = HashingUtils::CompileTimeHashString("timer");
 
 
         AutoScalingType GetAutoScalingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == load_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AutoScalingType::load;
-          }
-          else if (hashCode == timer_HASH)
-          {
-            return AutoScalingType::timer;
+          case load_HASH:
+            if (name == "load")
+            {
+              return AutoScalingType::load;
+            }
+            break;
+          case timer_HASH:
+            if (name == "timer")
+            {
+              return AutoScalingType::timer;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AutoScalingType::NOT_SET;
         }
 
-        Aws::String GetNameForAutoScalingType(AutoScalingType enumValue)
+        const char* GetNameForAutoScalingType(AutoScalingType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,470 +30,660 @@ namespace Aws
       namespace CloudWatchLogsEncodingMapper
       {
 
-        static const int ascii_HASH = HashingUtils::HashString("ascii");
-        static const int big5_HASH = HashingUtils::HashString("big5");
-        static const int big5hkscs_HASH = HashingUtils::HashString("big5hkscs");
-        static const int cp037_HASH = HashingUtils::HashString("cp037");
-        static const int cp424_HASH = HashingUtils::HashString("cp424");
-        static const int cp437_HASH = HashingUtils::HashString("cp437");
-        static const int cp500_HASH = HashingUtils::HashString("cp500");
-        static const int cp720_HASH = HashingUtils::HashString("cp720");
-        static const int cp737_HASH = HashingUtils::HashString("cp737");
-        static const int cp775_HASH = HashingUtils::HashString("cp775");
-        static const int cp850_HASH = HashingUtils::HashString("cp850");
-        static const int cp852_HASH = HashingUtils::HashString("cp852");
-        static const int cp855_HASH = HashingUtils::HashString("cp855");
-        static const int cp856_HASH = HashingUtils::HashString("cp856");
-        static const int cp857_HASH = HashingUtils::HashString("cp857");
-        static const int cp858_HASH = HashingUtils::HashString("cp858");
-        static const int cp860_HASH = HashingUtils::HashString("cp860");
-        static const int cp861_HASH = HashingUtils::HashString("cp861");
-        static const int cp862_HASH = HashingUtils::HashString("cp862");
-        static const int cp863_HASH = HashingUtils::HashString("cp863");
-        static const int cp864_HASH = HashingUtils::HashString("cp864");
-        static const int cp865_HASH = HashingUtils::HashString("cp865");
-        static const int cp866_HASH = HashingUtils::HashString("cp866");
-        static const int cp869_HASH = HashingUtils::HashString("cp869");
-        static const int cp874_HASH = HashingUtils::HashString("cp874");
-        static const int cp875_HASH = HashingUtils::HashString("cp875");
-        static const int cp932_HASH = HashingUtils::HashString("cp932");
-        static const int cp949_HASH = HashingUtils::HashString("cp949");
-        static const int cp950_HASH = HashingUtils::HashString("cp950");
-        static const int cp1006_HASH = HashingUtils::HashString("cp1006");
-        static const int cp1026_HASH = HashingUtils::HashString("cp1026");
-        static const int cp1140_HASH = HashingUtils::HashString("cp1140");
-        static const int cp1250_HASH = HashingUtils::HashString("cp1250");
-        static const int cp1251_HASH = HashingUtils::HashString("cp1251");
-        static const int cp1252_HASH = HashingUtils::HashString("cp1252");
-        static const int cp1253_HASH = HashingUtils::HashString("cp1253");
-        static const int cp1254_HASH = HashingUtils::HashString("cp1254");
-        static const int cp1255_HASH = HashingUtils::HashString("cp1255");
-        static const int cp1256_HASH = HashingUtils::HashString("cp1256");
-        static const int cp1257_HASH = HashingUtils::HashString("cp1257");
-        static const int cp1258_HASH = HashingUtils::HashString("cp1258");
-        static const int euc_jp_HASH = HashingUtils::HashString("euc_jp");
-        static const int euc_jis_2004_HASH = HashingUtils::HashString("euc_jis_2004");
-        static const int euc_jisx0213_HASH = HashingUtils::HashString("euc_jisx0213");
-        static const int euc_kr_HASH = HashingUtils::HashString("euc_kr");
-        static const int gb2312_HASH = HashingUtils::HashString("gb2312");
-        static const int gbk_HASH = HashingUtils::HashString("gbk");
-        static const int gb18030_HASH = HashingUtils::HashString("gb18030");
-        static const int hz_HASH = HashingUtils::HashString("hz");
-        static const int iso2022_jp_HASH = HashingUtils::HashString("iso2022_jp");
-        static const int iso2022_jp_1_HASH = HashingUtils::HashString("iso2022_jp_1");
-        static const int iso2022_jp_2_HASH = HashingUtils::HashString("iso2022_jp_2");
-        static const int iso2022_jp_2004_HASH = HashingUtils::HashString("iso2022_jp_2004");
-        static const int iso2022_jp_3_HASH = HashingUtils::HashString("iso2022_jp_3");
-        static const int iso2022_jp_ext_HASH = HashingUtils::HashString("iso2022_jp_ext");
-        static const int iso2022_kr_HASH = HashingUtils::HashString("iso2022_kr");
-        static const int latin_1_HASH = HashingUtils::HashString("latin_1");
-        static const int iso8859_2_HASH = HashingUtils::HashString("iso8859_2");
-        static const int iso8859_3_HASH = HashingUtils::HashString("iso8859_3");
-        static const int iso8859_4_HASH = HashingUtils::HashString("iso8859_4");
-        static const int iso8859_5_HASH = HashingUtils::HashString("iso8859_5");
-        static const int iso8859_6_HASH = HashingUtils::HashString("iso8859_6");
-        static const int iso8859_7_HASH = HashingUtils::HashString("iso8859_7");
-        static const int iso8859_8_HASH = HashingUtils::HashString("iso8859_8");
-        static const int iso8859_9_HASH = HashingUtils::HashString("iso8859_9");
-        static const int iso8859_10_HASH = HashingUtils::HashString("iso8859_10");
-        static const int iso8859_13_HASH = HashingUtils::HashString("iso8859_13");
-        static const int iso8859_14_HASH = HashingUtils::HashString("iso8859_14");
-        static const int iso8859_15_HASH = HashingUtils::HashString("iso8859_15");
-        static const int iso8859_16_HASH = HashingUtils::HashString("iso8859_16");
-        static const int johab_HASH = HashingUtils::HashString("johab");
-        static const int koi8_r_HASH = HashingUtils::HashString("koi8_r");
-        static const int koi8_u_HASH = HashingUtils::HashString("koi8_u");
-        static const int mac_cyrillic_HASH = HashingUtils::HashString("mac_cyrillic");
-        static const int mac_greek_HASH = HashingUtils::HashString("mac_greek");
-        static const int mac_iceland_HASH = HashingUtils::HashString("mac_iceland");
-        static const int mac_latin2_HASH = HashingUtils::HashString("mac_latin2");
-        static const int mac_roman_HASH = HashingUtils::HashString("mac_roman");
-        static const int mac_turkish_HASH = HashingUtils::HashString("mac_turkish");
-        static const int ptcp154_HASH = HashingUtils::HashString("ptcp154");
-        static const int shift_jis_HASH = HashingUtils::HashString("shift_jis");
-        static const int shift_jis_2004_HASH = HashingUtils::HashString("shift_jis_2004");
-        static const int shift_jisx0213_HASH = HashingUtils::HashString("shift_jisx0213");
-        static const int utf_32_HASH = HashingUtils::HashString("utf_32");
-        static const int utf_32_be_HASH = HashingUtils::HashString("utf_32_be");
-        static const int utf_32_le_HASH = HashingUtils::HashString("utf_32_le");
-        static const int utf_16_HASH = HashingUtils::HashString("utf_16");
-        static const int utf_16_be_HASH = HashingUtils::HashString("utf_16_be");
-        static const int utf_16_le_HASH = HashingUtils::HashString("utf_16_le");
-        static const int utf_7_HASH = HashingUtils::HashString("utf_7");
-        static const int utf_8_HASH = HashingUtils::HashString("utf_8");
-        static const int utf_8_sig_HASH = HashingUtils::HashString("utf_8_sig");
+        static constexpr int ascii_HASH = HashingUtils::CompileTimeHashString("ascii");
+        static constexpr int big5_HASH = HashingUtils::CompileTimeHashString("big5");
+        static constexpr int big5hkscs_HASH = HashingUtils::CompileTimeHashString("big5hkscs");
+        static constexpr int cp037_HASH = HashingUtils::CompileTimeHashString("cp037");
+        static constexpr int cp424_HASH = HashingUtils::CompileTimeHashString("cp424");
+        static constexpr int cp437_HASH = HashingUtils::CompileTimeHashString("cp437");
+        static constexpr int cp500_HASH = HashingUtils::CompileTimeHashString("cp500");
+        static constexpr int cp720_HASH = HashingUtils::CompileTimeHashString("cp720");
+        static constexpr int cp737_HASH = HashingUtils::CompileTimeHashString("cp737");
+        static constexpr int cp775_HASH = HashingUtils::CompileTimeHashString("cp775");
+        static constexpr int cp850_HASH = HashingUtils::CompileTimeHashString("cp850");
+        static constexpr int cp852_HASH = HashingUtils::CompileTimeHashString("cp852");
+        static constexpr int cp855_HASH = HashingUtils::CompileTimeHashString("cp855");
+        static constexpr int cp856_HASH = HashingUtils::CompileTimeHashString("cp856");
+        static constexpr int cp857_HASH = HashingUtils::CompileTimeHashString("cp857");
+        static constexpr int cp858_HASH = HashingUtils::CompileTimeHashString("cp858");
+        static constexpr int cp860_HASH = HashingUtils::CompileTimeHashString("cp860");
+        static constexpr int cp861_HASH = HashingUtils::CompileTimeHashString("cp861");
+        static constexpr int cp862_HASH = HashingUtils::CompileTimeHashString("cp862");
+        static constexpr int cp863_HASH = HashingUtils::CompileTimeHashString("cp863");
+        static constexpr int cp864_HASH = HashingUtils::CompileTimeHashString("cp864");
+        static constexpr int cp865_HASH = HashingUtils::CompileTimeHashString("cp865");
+        static constexpr int cp866_HASH = HashingUtils::CompileTimeHashString("cp866");
+        static constexpr int cp869_HASH = HashingUtils::CompileTimeHashString("cp869");
+        static constexpr int cp874_HASH = HashingUtils::CompileTimeHashString("cp874");
+        static constexpr int cp875_HASH = HashingUtils::CompileTimeHashString("cp875");
+        static constexpr int cp932_HASH = HashingUtils::CompileTimeHashString("cp932");
+        static constexpr int cp949_HASH = HashingUtils::CompileTimeHashString("cp949");
+        static constexpr int cp950_HASH = HashingUtils::CompileTimeHashString("cp950");
+        static constexpr int cp1006_HASH = HashingUtils::CompileTimeHashString("cp1006");
+        static constexpr int cp1026_HASH = HashingUtils::CompileTimeHashString("cp1026");
+        static constexpr int cp1140_HASH = HashingUtils::CompileTimeHashString("cp1140");
+        static constexpr int cp1250_HASH = HashingUtils::CompileTimeHashString("cp1250");
+        static constexpr int cp1251_HASH = HashingUtils::CompileTimeHashString("cp1251");
+        static constexpr int cp1252_HASH = HashingUtils::CompileTimeHashString("cp1252");
+        static constexpr int cp1253_HASH = HashingUtils::CompileTimeHashString("cp1253");
+        static constexpr int cp1254_HASH = HashingUtils::CompileTimeHashString("cp1254");
+        static constexpr int cp1255_HASH = HashingUtils::CompileTimeHashString("cp1255");
+        static constexpr int cp1256_HASH = HashingUtils::CompileTimeHashString("cp1256");
+        static constexpr int cp1257_HASH = HashingUtils::CompileTimeHashString("cp1257");
+        static constexpr int cp1258_HASH = HashingUtils::CompileTimeHashString("cp1258");
+        static constexpr int euc_jp_HASH = HashingUtils::CompileTimeHashString("euc_jp");
+        static constexpr int euc_jis_2004_HASH = HashingUtils::CompileTimeHashString("euc_jis_2004");
+        static constexpr int euc_jisx0213_HASH = HashingUtils::CompileTimeHashString("euc_jisx0213");
+        static constexpr int euc_kr_HASH = HashingUtils::CompileTimeHashString("euc_kr");
+        static constexpr int gb2312_HASH = HashingUtils::CompileTimeHashString("gb2312");
+        static constexpr int gbk_HASH = HashingUtils::CompileTimeHashString("gbk");
+        static constexpr int gb18030_HASH = HashingUtils::CompileTimeHashString("gb18030");
+        static constexpr int hz_HASH = HashingUtils::CompileTimeHashString("hz");
+        static constexpr int iso2022_jp_HASH = HashingUtils::CompileTimeHashString("iso2022_jp");
+        static constexpr int iso2022_jp_1_HASH = HashingUtils::CompileTimeHashString("iso2022_jp_1");
+        static constexpr int iso2022_jp_2_HASH = HashingUtils::CompileTimeHashString("iso2022_jp_2");
+        static constexpr int iso2022_jp_2004_HASH = HashingUtils::CompileTimeHashString("iso2022_jp_2004");
+        static constexpr int iso2022_jp_3_HASH = HashingUtils::CompileTimeHashString("iso2022_jp_3");
+        static constexpr int iso2022_jp_ext_HASH = HashingUtils::CompileTimeHashString("iso2022_jp_ext");
+        static constexpr int iso2022_kr_HASH = HashingUtils::CompileTimeHashString("iso2022_kr");
+        static constexpr int latin_1_HASH = HashingUtils::CompileTimeHashString("latin_1");
+        static constexpr int iso8859_2_HASH = HashingUtils::CompileTimeHashString("iso8859_2");
+        static constexpr int iso8859_3_HASH = HashingUtils::CompileTimeHashString("iso8859_3");
+        static constexpr int iso8859_4_HASH = HashingUtils::CompileTimeHashString("iso8859_4");
+        static constexpr int iso8859_5_HASH = HashingUtils::CompileTimeHashString("iso8859_5");
+        static constexpr int iso8859_6_HASH = HashingUtils::CompileTimeHashString("iso8859_6");
+        static constexpr int iso8859_7_HASH = HashingUtils::CompileTimeHashString("iso8859_7");
+        static constexpr int iso8859_8_HASH = HashingUtils::CompileTimeHashString("iso8859_8");
+        static constexpr int iso8859_9_HASH = HashingUtils::CompileTimeHashString("iso8859_9");
+        static constexpr int iso8859_10_HASH = HashingUtils::CompileTimeHashString("iso8859_10");
+        static constexpr int iso8859_13_HASH = HashingUtils::CompileTimeHashString("iso8859_13");
+        static constexpr int iso8859_14_HASH = HashingUtils::CompileTimeHashString("iso8859_14");
+        static constexpr int iso8859_15_HASH = HashingUtils::CompileTimeHashString("iso8859_15");
+        static constexpr int iso8859_16_HASH = HashingUtils::CompileTimeHashString("iso8859_16");
+        static constexpr int johab_HASH = HashingUtils::CompileTimeHashString("johab");
+        static constexpr int koi8_r_HASH = HashingUtils::CompileTimeHashString("koi8_r");
+        static constexpr int koi8_u_HASH = HashingUtils::CompileTimeHashString("koi8_u");
+        static constexpr int mac_cyrillic_HASH = HashingUtils::CompileTimeHashString("mac_cyrillic");
+        static constexpr int mac_greek_HASH = HashingUtils::CompileTimeHashString("mac_greek");
+        static constexpr int mac_iceland_HASH = HashingUtils::CompileTimeHashString("mac_iceland");
+        static constexpr int mac_latin2_HASH = HashingUtils::CompileTimeHashString("mac_latin2");
+        static constexpr int mac_roman_HASH = HashingUtils::CompileTimeHashString("mac_roman");
+        static constexpr int mac_turkish_HASH = HashingUtils::CompileTimeHashString("mac_turkish");
+        static constexpr int ptcp154_HASH = HashingUtils::CompileTimeHashString("ptcp154");
+        static constexpr int shift_jis_HASH = HashingUtils::CompileTimeHashString("shift_jis");
+        static constexpr int shift_jis_2004_HASH = HashingUtils::CompileTimeHashString("shift_jis_2004");
+        static constexpr int shift_jisx0213_HASH = HashingUtils::CompileTimeHashString("shift_jisx0213");
+        static constexpr int utf_32_HASH = HashingUtils::CompileTimeHashString("utf_32");
+        static constexpr int utf_32_be_HASH = HashingUtils::CompileTimeHashString("utf_32_be");
+        static constexpr int utf_32_le_HASH = HashingUtils::CompileTimeHashString("utf_32_le");
+        static constexpr int utf_16_HASH = HashingUtils::CompileTimeHashString("utf_16");
+        static constexpr int utf_16_be_HASH = HashingUtils::CompileTimeHashString("utf_16_be");
+        static constexpr int utf_16_le_HASH = HashingUtils::CompileTimeHashString("utf_16_le");
+        static constexpr int utf_7_HASH = HashingUtils::CompileTimeHashString("utf_7");
+        static constexpr int utf_8_HASH = HashingUtils::CompileTimeHashString("utf_8");
+        static constexpr int utf_8_sig_HASH = HashingUtils::CompileTimeHashString("utf_8_sig");
 
 
         CloudWatchLogsEncoding GetCloudWatchLogsEncodingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ascii_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CloudWatchLogsEncoding::ascii;
-          }
-          else if (hashCode == big5_HASH)
-          {
-            return CloudWatchLogsEncoding::big5;
-          }
-          else if (hashCode == big5hkscs_HASH)
-          {
-            return CloudWatchLogsEncoding::big5hkscs;
-          }
-          else if (hashCode == cp037_HASH)
-          {
-            return CloudWatchLogsEncoding::cp037;
-          }
-          else if (hashCode == cp424_HASH)
-          {
-            return CloudWatchLogsEncoding::cp424;
-          }
-          else if (hashCode == cp437_HASH)
-          {
-            return CloudWatchLogsEncoding::cp437;
-          }
-          else if (hashCode == cp500_HASH)
-          {
-            return CloudWatchLogsEncoding::cp500;
-          }
-          else if (hashCode == cp720_HASH)
-          {
-            return CloudWatchLogsEncoding::cp720;
-          }
-          else if (hashCode == cp737_HASH)
-          {
-            return CloudWatchLogsEncoding::cp737;
-          }
-          else if (hashCode == cp775_HASH)
-          {
-            return CloudWatchLogsEncoding::cp775;
-          }
-          else if (hashCode == cp850_HASH)
-          {
-            return CloudWatchLogsEncoding::cp850;
-          }
-          else if (hashCode == cp852_HASH)
-          {
-            return CloudWatchLogsEncoding::cp852;
-          }
-          else if (hashCode == cp855_HASH)
-          {
-            return CloudWatchLogsEncoding::cp855;
-          }
-          else if (hashCode == cp856_HASH)
-          {
-            return CloudWatchLogsEncoding::cp856;
-          }
-          else if (hashCode == cp857_HASH)
-          {
-            return CloudWatchLogsEncoding::cp857;
-          }
-          else if (hashCode == cp858_HASH)
-          {
-            return CloudWatchLogsEncoding::cp858;
-          }
-          else if (hashCode == cp860_HASH)
-          {
-            return CloudWatchLogsEncoding::cp860;
-          }
-          else if (hashCode == cp861_HASH)
-          {
-            return CloudWatchLogsEncoding::cp861;
-          }
-          else if (hashCode == cp862_HASH)
-          {
-            return CloudWatchLogsEncoding::cp862;
-          }
-          else if (hashCode == cp863_HASH)
-          {
-            return CloudWatchLogsEncoding::cp863;
-          }
-          else if (hashCode == cp864_HASH)
-          {
-            return CloudWatchLogsEncoding::cp864;
-          }
-          else if (hashCode == cp865_HASH)
-          {
-            return CloudWatchLogsEncoding::cp865;
-          }
-          else if (hashCode == cp866_HASH)
-          {
-            return CloudWatchLogsEncoding::cp866;
-          }
-          else if (hashCode == cp869_HASH)
-          {
-            return CloudWatchLogsEncoding::cp869;
-          }
-          else if (hashCode == cp874_HASH)
-          {
-            return CloudWatchLogsEncoding::cp874;
-          }
-          else if (hashCode == cp875_HASH)
-          {
-            return CloudWatchLogsEncoding::cp875;
-          }
-          else if (hashCode == cp932_HASH)
-          {
-            return CloudWatchLogsEncoding::cp932;
-          }
-          else if (hashCode == cp949_HASH)
-          {
-            return CloudWatchLogsEncoding::cp949;
-          }
-          else if (hashCode == cp950_HASH)
-          {
-            return CloudWatchLogsEncoding::cp950;
-          }
-          else if (hashCode == cp1006_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1006;
-          }
-          else if (hashCode == cp1026_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1026;
-          }
-          else if (hashCode == cp1140_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1140;
-          }
-          else if (hashCode == cp1250_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1250;
-          }
-          else if (hashCode == cp1251_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1251;
-          }
-          else if (hashCode == cp1252_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1252;
-          }
-          else if (hashCode == cp1253_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1253;
-          }
-          else if (hashCode == cp1254_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1254;
-          }
-          else if (hashCode == cp1255_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1255;
-          }
-          else if (hashCode == cp1256_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1256;
-          }
-          else if (hashCode == cp1257_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1257;
-          }
-          else if (hashCode == cp1258_HASH)
-          {
-            return CloudWatchLogsEncoding::cp1258;
-          }
-          else if (hashCode == euc_jp_HASH)
-          {
-            return CloudWatchLogsEncoding::euc_jp;
-          }
-          else if (hashCode == euc_jis_2004_HASH)
-          {
-            return CloudWatchLogsEncoding::euc_jis_2004;
-          }
-          else if (hashCode == euc_jisx0213_HASH)
-          {
-            return CloudWatchLogsEncoding::euc_jisx0213;
-          }
-          else if (hashCode == euc_kr_HASH)
-          {
-            return CloudWatchLogsEncoding::euc_kr;
-          }
-          else if (hashCode == gb2312_HASH)
-          {
-            return CloudWatchLogsEncoding::gb2312;
-          }
-          else if (hashCode == gbk_HASH)
-          {
-            return CloudWatchLogsEncoding::gbk;
-          }
-          else if (hashCode == gb18030_HASH)
-          {
-            return CloudWatchLogsEncoding::gb18030;
-          }
-          else if (hashCode == hz_HASH)
-          {
-            return CloudWatchLogsEncoding::hz;
-          }
-          else if (hashCode == iso2022_jp_HASH)
-          {
-            return CloudWatchLogsEncoding::iso2022_jp;
-          }
-          else if (hashCode == iso2022_jp_1_HASH)
-          {
-            return CloudWatchLogsEncoding::iso2022_jp_1;
-          }
-          else if (hashCode == iso2022_jp_2_HASH)
-          {
-            return CloudWatchLogsEncoding::iso2022_jp_2;
-          }
-          else if (hashCode == iso2022_jp_2004_HASH)
-          {
-            return CloudWatchLogsEncoding::iso2022_jp_2004;
-          }
-          else if (hashCode == iso2022_jp_3_HASH)
-          {
-            return CloudWatchLogsEncoding::iso2022_jp_3;
-          }
-          else if (hashCode == iso2022_jp_ext_HASH)
-          {
-            return CloudWatchLogsEncoding::iso2022_jp_ext;
-          }
-          else if (hashCode == iso2022_kr_HASH)
-          {
-            return CloudWatchLogsEncoding::iso2022_kr;
-          }
-          else if (hashCode == latin_1_HASH)
-          {
-            return CloudWatchLogsEncoding::latin_1;
-          }
-          else if (hashCode == iso8859_2_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_2;
-          }
-          else if (hashCode == iso8859_3_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_3;
-          }
-          else if (hashCode == iso8859_4_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_4;
-          }
-          else if (hashCode == iso8859_5_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_5;
-          }
-          else if (hashCode == iso8859_6_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_6;
-          }
-          else if (hashCode == iso8859_7_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_7;
-          }
-          else if (hashCode == iso8859_8_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_8;
-          }
-          else if (hashCode == iso8859_9_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_9;
-          }
-          else if (hashCode == iso8859_10_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_10;
-          }
-          else if (hashCode == iso8859_13_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_13;
-          }
-          else if (hashCode == iso8859_14_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_14;
-          }
-          else if (hashCode == iso8859_15_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_15;
-          }
-          else if (hashCode == iso8859_16_HASH)
-          {
-            return CloudWatchLogsEncoding::iso8859_16;
-          }
-          else if (hashCode == johab_HASH)
-          {
-            return CloudWatchLogsEncoding::johab;
-          }
-          else if (hashCode == koi8_r_HASH)
-          {
-            return CloudWatchLogsEncoding::koi8_r;
-          }
-          else if (hashCode == koi8_u_HASH)
-          {
-            return CloudWatchLogsEncoding::koi8_u;
-          }
-          else if (hashCode == mac_cyrillic_HASH)
-          {
-            return CloudWatchLogsEncoding::mac_cyrillic;
-          }
-          else if (hashCode == mac_greek_HASH)
-          {
-            return CloudWatchLogsEncoding::mac_greek;
-          }
-          else if (hashCode == mac_iceland_HASH)
-          {
-            return CloudWatchLogsEncoding::mac_iceland;
-          }
-          else if (hashCode == mac_latin2_HASH)
-          {
-            return CloudWatchLogsEncoding::mac_latin2;
-          }
-          else if (hashCode == mac_roman_HASH)
-          {
-            return CloudWatchLogsEncoding::mac_roman;
-          }
-          else if (hashCode == mac_turkish_HASH)
-          {
-            return CloudWatchLogsEncoding::mac_turkish;
-          }
-          else if (hashCode == ptcp154_HASH)
-          {
-            return CloudWatchLogsEncoding::ptcp154;
-          }
-          else if (hashCode == shift_jis_HASH)
-          {
-            return CloudWatchLogsEncoding::shift_jis;
-          }
-          else if (hashCode == shift_jis_2004_HASH)
-          {
-            return CloudWatchLogsEncoding::shift_jis_2004;
-          }
-          else if (hashCode == shift_jisx0213_HASH)
-          {
-            return CloudWatchLogsEncoding::shift_jisx0213;
-          }
-          else if (hashCode == utf_32_HASH)
-          {
-            return CloudWatchLogsEncoding::utf_32;
-          }
-          else if (hashCode == utf_32_be_HASH)
-          {
-            return CloudWatchLogsEncoding::utf_32_be;
-          }
-          else if (hashCode == utf_32_le_HASH)
-          {
-            return CloudWatchLogsEncoding::utf_32_le;
-          }
-          else if (hashCode == utf_16_HASH)
-          {
-            return CloudWatchLogsEncoding::utf_16;
-          }
-          else if (hashCode == utf_16_be_HASH)
-          {
-            return CloudWatchLogsEncoding::utf_16_be;
-          }
-          else if (hashCode == utf_16_le_HASH)
-          {
-            return CloudWatchLogsEncoding::utf_16_le;
-          }
-          else if (hashCode == utf_7_HASH)
-          {
-            return CloudWatchLogsEncoding::utf_7;
-          }
-          else if (hashCode == utf_8_HASH)
-          {
-            return CloudWatchLogsEncoding::utf_8;
-          }
-          else if (hashCode == utf_8_sig_HASH)
-          {
-            return CloudWatchLogsEncoding::utf_8_sig;
+          case ascii_HASH:
+            if (name == "ascii")
+            {
+              return CloudWatchLogsEncoding::ascii;
+            }
+            break;
+          case big5_HASH:
+            if (name == "big5")
+            {
+              return CloudWatchLogsEncoding::big5;
+            }
+            break;
+          case big5hkscs_HASH:
+            if (name == "big5hkscs")
+            {
+              return CloudWatchLogsEncoding::big5hkscs;
+            }
+            break;
+          case cp037_HASH:
+            if (name == "cp037")
+            {
+              return CloudWatchLogsEncoding::cp037;
+            }
+            break;
+          case cp424_HASH:
+            if (name == "cp424")
+            {
+              return CloudWatchLogsEncoding::cp424;
+            }
+            break;
+          case cp437_HASH:
+            if (name == "cp437")
+            {
+              return CloudWatchLogsEncoding::cp437;
+            }
+            break;
+          case cp500_HASH:
+            if (name == "cp500")
+            {
+              return CloudWatchLogsEncoding::cp500;
+            }
+            break;
+          case cp720_HASH:
+            if (name == "cp720")
+            {
+              return CloudWatchLogsEncoding::cp720;
+            }
+            break;
+          case cp737_HASH:
+            if (name == "cp737")
+            {
+              return CloudWatchLogsEncoding::cp737;
+            }
+            break;
+          case cp775_HASH:
+            if (name == "cp775")
+            {
+              return CloudWatchLogsEncoding::cp775;
+            }
+            break;
+          case cp850_HASH:
+            if (name == "cp850")
+            {
+              return CloudWatchLogsEncoding::cp850;
+            }
+            break;
+          case cp852_HASH:
+            if (name == "cp852")
+            {
+              return CloudWatchLogsEncoding::cp852;
+            }
+            break;
+          case cp855_HASH:
+            if (name == "cp855")
+            {
+              return CloudWatchLogsEncoding::cp855;
+            }
+            break;
+          case cp856_HASH:
+            if (name == "cp856")
+            {
+              return CloudWatchLogsEncoding::cp856;
+            }
+            break;
+          case cp857_HASH:
+            if (name == "cp857")
+            {
+              return CloudWatchLogsEncoding::cp857;
+            }
+            break;
+          case cp858_HASH:
+            if (name == "cp858")
+            {
+              return CloudWatchLogsEncoding::cp858;
+            }
+            break;
+          case cp860_HASH:
+            if (name == "cp860")
+            {
+              return CloudWatchLogsEncoding::cp860;
+            }
+            break;
+          case cp861_HASH:
+            if (name == "cp861")
+            {
+              return CloudWatchLogsEncoding::cp861;
+            }
+            break;
+          case cp862_HASH:
+            if (name == "cp862")
+            {
+              return CloudWatchLogsEncoding::cp862;
+            }
+            break;
+          case cp863_HASH:
+            if (name == "cp863")
+            {
+              return CloudWatchLogsEncoding::cp863;
+            }
+            break;
+          case cp864_HASH:
+            if (name == "cp864")
+            {
+              return CloudWatchLogsEncoding::cp864;
+            }
+            break;
+          case cp865_HASH:
+            if (name == "cp865")
+            {
+              return CloudWatchLogsEncoding::cp865;
+            }
+            break;
+          case cp866_HASH:
+            if (name == "cp866")
+            {
+              return CloudWatchLogsEncoding::cp866;
+            }
+            break;
+          case cp869_HASH:
+            if (name == "cp869")
+            {
+              return CloudWatchLogsEncoding::cp869;
+            }
+            break;
+          case cp874_HASH:
+            if (name == "cp874")
+            {
+              return CloudWatchLogsEncoding::cp874;
+            }
+            break;
+          case cp875_HASH:
+            if (name == "cp875")
+            {
+              return CloudWatchLogsEncoding::cp875;
+            }
+            break;
+          case cp932_HASH:
+            if (name == "cp932")
+            {
+              return CloudWatchLogsEncoding::cp932;
+            }
+            break;
+          case cp949_HASH:
+            if (name == "cp949")
+            {
+              return CloudWatchLogsEncoding::cp949;
+            }
+            break;
+          case cp950_HASH:
+            if (name == "cp950")
+            {
+              return CloudWatchLogsEncoding::cp950;
+            }
+            break;
+          case cp1006_HASH:
+            if (name == "cp1006")
+            {
+              return CloudWatchLogsEncoding::cp1006;
+            }
+            break;
+          case cp1026_HASH:
+            if (name == "cp1026")
+            {
+              return CloudWatchLogsEncoding::cp1026;
+            }
+            break;
+          case cp1140_HASH:
+            if (name == "cp1140")
+            {
+              return CloudWatchLogsEncoding::cp1140;
+            }
+            break;
+          case cp1250_HASH:
+            if (name == "cp1250")
+            {
+              return CloudWatchLogsEncoding::cp1250;
+            }
+            break;
+          case cp1251_HASH:
+            if (name == "cp1251")
+            {
+              return CloudWatchLogsEncoding::cp1251;
+            }
+            break;
+          case cp1252_HASH:
+            if (name == "cp1252")
+            {
+              return CloudWatchLogsEncoding::cp1252;
+            }
+            break;
+          case cp1253_HASH:
+            if (name == "cp1253")
+            {
+              return CloudWatchLogsEncoding::cp1253;
+            }
+            break;
+          case cp1254_HASH:
+            if (name == "cp1254")
+            {
+              return CloudWatchLogsEncoding::cp1254;
+            }
+            break;
+          case cp1255_HASH:
+            if (name == "cp1255")
+            {
+              return CloudWatchLogsEncoding::cp1255;
+            }
+            break;
+          case cp1256_HASH:
+            if (name == "cp1256")
+            {
+              return CloudWatchLogsEncoding::cp1256;
+            }
+            break;
+          case cp1257_HASH:
+            if (name == "cp1257")
+            {
+              return CloudWatchLogsEncoding::cp1257;
+            }
+            break;
+          case cp1258_HASH:
+            if (name == "cp1258")
+            {
+              return CloudWatchLogsEncoding::cp1258;
+            }
+            break;
+          case euc_jp_HASH:
+            if (name == "euc_jp")
+            {
+              return CloudWatchLogsEncoding::euc_jp;
+            }
+            break;
+          case euc_jis_2004_HASH:
+            if (name == "euc_jis_2004")
+            {
+              return CloudWatchLogsEncoding::euc_jis_2004;
+            }
+            break;
+          case euc_jisx0213_HASH:
+            if (name == "euc_jisx0213")
+            {
+              return CloudWatchLogsEncoding::euc_jisx0213;
+            }
+            break;
+          case euc_kr_HASH:
+            if (name == "euc_kr")
+            {
+              return CloudWatchLogsEncoding::euc_kr;
+            }
+            break;
+          case gb2312_HASH:
+            if (name == "gb2312")
+            {
+              return CloudWatchLogsEncoding::gb2312;
+            }
+            break;
+          case gbk_HASH:
+            if (name == "gbk")
+            {
+              return CloudWatchLogsEncoding::gbk;
+            }
+            break;
+          case gb18030_HASH:
+            if (name == "gb18030")
+            {
+              return CloudWatchLogsEncoding::gb18030;
+            }
+            break;
+          case hz_HASH:
+            if (name == "hz")
+            {
+              return CloudWatchLogsEncoding::hz;
+            }
+            break;
+          case iso2022_jp_HASH:
+            if (name == "iso2022_jp")
+            {
+              return CloudWatchLogsEncoding::iso2022_jp;
+            }
+            break;
+          case iso2022_jp_1_HASH:
+            if (name == "iso2022_jp_1")
+            {
+              return CloudWatchLogsEncoding::iso2022_jp_1;
+            }
+            break;
+          case iso2022_jp_2_HASH:
+            if (name == "iso2022_jp_2")
+            {
+              return CloudWatchLogsEncoding::iso2022_jp_2;
+            }
+            break;
+          case iso2022_jp_2004_HASH:
+            if (name == "iso2022_jp_2004")
+            {
+              return CloudWatchLogsEncoding::iso2022_jp_2004;
+            }
+            break;
+          case iso2022_jp_3_HASH:
+            if (name == "iso2022_jp_3")
+            {
+              return CloudWatchLogsEncoding::iso2022_jp_3;
+            }
+            break;
+          case iso2022_jp_ext_HASH:
+            if (name == "iso2022_jp_ext")
+            {
+              return CloudWatchLogsEncoding::iso2022_jp_ext;
+            }
+            break;
+          case iso2022_kr_HASH:
+            if (name == "iso2022_kr")
+            {
+              return CloudWatchLogsEncoding::iso2022_kr;
+            }
+            break;
+          case latin_1_HASH:
+            if (name == "latin_1")
+            {
+              return CloudWatchLogsEncoding::latin_1;
+            }
+            break;
+          case iso8859_2_HASH:
+            if (name == "iso8859_2")
+            {
+              return CloudWatchLogsEncoding::iso8859_2;
+            }
+            break;
+          case iso8859_3_HASH:
+            if (name == "iso8859_3")
+            {
+              return CloudWatchLogsEncoding::iso8859_3;
+            }
+            break;
+          case iso8859_4_HASH:
+            if (name == "iso8859_4")
+            {
+              return CloudWatchLogsEncoding::iso8859_4;
+            }
+            break;
+          case iso8859_5_HASH:
+            if (name == "iso8859_5")
+            {
+              return CloudWatchLogsEncoding::iso8859_5;
+            }
+            break;
+          case iso8859_6_HASH:
+            if (name == "iso8859_6")
+            {
+              return CloudWatchLogsEncoding::iso8859_6;
+            }
+            break;
+          case iso8859_7_HASH:
+            if (name == "iso8859_7")
+            {
+              return CloudWatchLogsEncoding::iso8859_7;
+            }
+            break;
+          case iso8859_8_HASH:
+            if (name == "iso8859_8")
+            {
+              return CloudWatchLogsEncoding::iso8859_8;
+            }
+            break;
+          case iso8859_9_HASH:
+            if (name == "iso8859_9")
+            {
+              return CloudWatchLogsEncoding::iso8859_9;
+            }
+            break;
+          case iso8859_10_HASH:
+            if (name == "iso8859_10")
+            {
+              return CloudWatchLogsEncoding::iso8859_10;
+            }
+            break;
+          case iso8859_13_HASH:
+            if (name == "iso8859_13")
+            {
+              return CloudWatchLogsEncoding::iso8859_13;
+            }
+            break;
+          case iso8859_14_HASH:
+            if (name == "iso8859_14")
+            {
+              return CloudWatchLogsEncoding::iso8859_14;
+            }
+            break;
+          case iso8859_15_HASH:
+            if (name == "iso8859_15")
+            {
+              return CloudWatchLogsEncoding::iso8859_15;
+            }
+            break;
+          case iso8859_16_HASH:
+            if (name == "iso8859_16")
+            {
+              return CloudWatchLogsEncoding::iso8859_16;
+            }
+            break;
+          case johab_HASH:
+            if (name == "johab")
+            {
+              return CloudWatchLogsEncoding::johab;
+            }
+            break;
+          case koi8_r_HASH:
+            if (name == "koi8_r")
+            {
+              return CloudWatchLogsEncoding::koi8_r;
+            }
+            break;
+          case koi8_u_HASH:
+            if (name == "koi8_u")
+            {
+              return CloudWatchLogsEncoding::koi8_u;
+            }
+            break;
+          case mac_cyrillic_HASH:
+            if (name == "mac_cyrillic")
+            {
+              return CloudWatchLogsEncoding::mac_cyrillic;
+            }
+            break;
+          case mac_greek_HASH:
+            if (name == "mac_greek")
+            {
+              return CloudWatchLogsEncoding::mac_greek;
+            }
+            break;
+          case mac_iceland_HASH:
+            if (name == "mac_iceland")
+            {
+              return CloudWatchLogsEncoding::mac_iceland;
+            }
+            break;
+          case mac_latin2_HASH:
+            if (name == "mac_latin2")
+            {
+              return CloudWatchLogsEncoding::mac_latin2;
+            }
+            break;
+          case mac_roman_HASH:
+            if (name == "mac_roman")
+            {
+              return CloudWatchLogsEncoding::mac_roman;
+            }
+            break;
+          case mac_turkish_HASH:
+            if (name == "mac_turkish")
+            {
+              return CloudWatchLogsEncoding::mac_turkish;
+            }
+            break;
+          case ptcp154_HASH:
+            if (name == "ptcp154")
+            {
+              return CloudWatchLogsEncoding::ptcp154;
+            }
+            break;
+          case shift_jis_HASH:
+            if (name == "shift_jis")
+            {
+              return CloudWatchLogsEncoding::shift_jis;
+            }
+            break;
+          case shift_jis_2004_HASH:
+            if (name == "shift_jis_2004")
+            {
+              return CloudWatchLogsEncoding::shift_jis_2004;
+            }
+            break;
+          case shift_jisx0213_HASH:
+            if (name == "shift_jisx0213")
+            {
+              return CloudWatchLogsEncoding::shift_jisx0213;
+            }
+            break;
+          case utf_32_HASH:
+            if (name == "utf_32")
+            {
+              return CloudWatchLogsEncoding::utf_32;
+            }
+            break;
+          case utf_32_be_HASH:
+            if (name == "utf_32_be")
+            {
+              return CloudWatchLogsEncoding::utf_32_be;
+            }
+            break;
+          case utf_32_le_HASH:
+            if (name == "utf_32_le")
+            {
+              return CloudWatchLogsEncoding::utf_32_le;
+            }
+            break;
+          case utf_16_HASH:
+            if (name == "utf_16")
+            {
+              return CloudWatchLogsEncoding::utf_16;
+            }
+            break;
+          case utf_16_be_HASH:
+            if (name == "utf_16_be")
+            {
+              return CloudWatchLogsEncoding::utf_16_be;
+            }
+            break;
+          case utf_16_le_HASH:
+            if (name == "utf_16_le")
+            {
+              return CloudWatchLogsEncoding::utf_16_le;
+            }
+            break;
+          case utf_7_HASH:
+            if (name == "utf_7")
+            {
+              return CloudWatchLogsEncoding::utf_7;
+            }
+            break;
+          case utf_8_HASH:
+            if (name == "utf_8")
+            {
+              return CloudWatchLogsEncoding::utf_8;
+            }
+            break;
+          case utf_8_sig_HASH:
+            if (name == "utf_8_sig")
+            {
+              return CloudWatchLogsEncoding::utf_8_sig;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -505,7 +695,7 @@ namespace Aws
           return CloudWatchLogsEncoding::NOT_SET;
         }
 
-        Aws::String GetNameForCloudWatchLogsEncoding(CloudWatchLogsEncoding enumValue)
+        const char* GetNameForCloudWatchLogsEncoding(CloudWatchLogsEncoding enumValue)
         {
           switch(enumValue)
           {
@@ -697,7 +887,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace CloudWatchLogsInitialPositionMapper
       {
 
-        static const int start_of_file_HASH = HashingUtils::HashString("start_of_file");
-        static const int end_of_file_HASH = HashingUtils::HashString("end_of_file");
+        static constexpr int start_of_file_HASH = HashingUtils::CompileTimeHashString("start_of_file");
+        static constexpr int end_of_file_HASH = HashingUtils::CompileTimeHashString("end_of_file");
 
 
         CloudWatchLogsInitialPosition GetCloudWatchLogsInitialPositionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == start_of_file_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CloudWatchLogsInitialPosition::start_of_file;
-          }
-          else if (hashCode == end_of_file_HASH)
-          {
-            return CloudWatchLogsInitialPosition::end_of_file;
+          case start_of_file_HASH:
+            if (name == "start_of_file")
+            {
+              return CloudWatchLogsInitialPosition::start_of_file;
+            }
+            break;
+          case end_of_file_HASH:
+            if (name == "end_of_file")
+            {
+              return CloudWatchLogsInitialPosition::end_of_file;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CloudWatchLogsInitialPosition::NOT_SET;
         }
 
-        Aws::String GetNameForCloudWatchLogsInitialPosition(CloudWatchLogsInitialPosition enumValue)
+        const char* GetNameForCloudWatchLogsInitialPosition(CloudWatchLogsInitialPosition enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
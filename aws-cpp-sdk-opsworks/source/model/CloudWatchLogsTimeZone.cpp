@@ -30,20 +30,30 @@ namespace Aws
       namespace CloudWatchLogsTimeZoneMapper
       {
 
-        static const int LOCAL_HASH = HashingUtils::HashString("LOCAL");
-        static const int UTC_HASH = HashingUtils::HashString("UTC");
+        static constexpr int LOCAL_HASH = HashingUtils::CompileTimeHashString("LOCAL");
+        static constexpr int UTC_HASH = HashingUtils::CompileTimeHashString("UTC");
 
 
         CloudWatchLogsTimeZone GetCloudWatchLogsTimeZoneForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LOCAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CloudWatchLogsTimeZone::LOCAL;
-          }
-          else if (hashCode == UTC_HASH)
-          {
-            return CloudWatchLogsTimeZone::UTC;
+          case LOCAL_HASH:
+            if (name == "LOCAL")
+            {
+              return CloudWatchLogsTimeZone::LOCAL;
+            }
+            break;
+          case UTC_HASH:
+            if (name == "UTC")
+            {
+              return CloudWatchLogsTimeZone::UTC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CloudWatchLogsTimeZone::NOT_SET;
         }
 
-        Aws::String GetNameForCloudWatchLogsTimeZone(CloudWatchLogsTimeZone enumValue)
+        const char* GetNameForCloudWatchLogsTimeZone(CloudWatchLogsTimeZone enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,70 +30,100 @@ namespace Aws
       namespace DeploymentCommandNameMapper
       {
 
-        static const int install_dependencies_HASH = HashingUtils::HashString("install_dependencies");
-        static const int update_dependencies_HASH = HashingUtils::HashString("update_dependencies");
-        static const int update_custom_cookbooks_HASH = HashingUtils::HashString("update_custom_cookbooks");
-        static const int execute_recipes_HASH = HashingUtils::HashString("execute_recipes");
-        static const int configure_HASH = HashingUtils::HashString("configure");
-        static const int setup_HASH = HashingUtils::HashString("setup");
-        static const int deploy_HASH = HashingUtils::HashString("deploy");
-        static const int rollback_HASH = HashingUtils::HashString("rollback");
-        static const int start_HASH = HashingUtils::HashString("start");
-        static const int stop_HASH = HashingUtils::HashString("stop");
-        static const int restart_HASH = HashingUtils::HashString("restart");
-        static const int undeploy_HASH = HashingUtils::HashString("undeploy");
+        static constexpr int install_dependencies_HASH = HashingUtils::CompileTimeHashString("install_dependencies");
+        static constexpr int update_dependencies_HASH = HashingUtils::CompileTimeHashString("update_dependencies");
+        static constexpr int update_custom_cookbooks_HASH = HashingUtils::CompileTimeHashString("update_custom_cookbooks");
+        static constexpr int execute_recipes_HASH = HashingUtils::CompileTimeHashString("execute_recipes");
+        static constexpr int configure_HASH = HashingUtils::CompileTimeHashString("configure");
+        static constexpr int setup_HASH = HashingUtils::CompileTimeHashString("setup");
+        static constexpr int deploy_HASH = HashingUtils::CompileTimeHashString("deploy");
+        static constexpr int rollback_HASH = HashingUtils::CompileTimeHashString("rollback");
+        static constexpr int start_HASH = HashingUtils::CompileTimeHashString("start");
+        static constexpr int stop_HASH = HashingUtils::CompileTimeHashString("stop");
+        static constexpr int restart_HASH = HashingUtils::CompileTimeHashString("restart");
+        static constexpr int undeploy_HASH = HashingUtils::CompileTimeHashString("undeploy");
 
 
         DeploymentCommandName GetDeploymentCommandNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == install_dependencies_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeploymentCommandName::install_dependencies;
-          }
-          else if (hashCode == update_dependencies_HASH)
-          {
-            return DeploymentCommandName::update_dependencies;
-          }
-          else if (hashCode == update_custom_cookbooks_HASH)
-          {
-            return DeploymentCommandName::update_custom_cookbooks;
-          }
-          else if (hashCode == execute_recipes_HASH)
-          {
-            return DeploymentCommandName::execute_recipes;
-          }
-          else if (hashCode == configure_HASH)
-          {
-            return DeploymentCommandName::configure;
-          }
-          else if (hashCode == setup_HASH)
-          {
-            return DeploymentCommandName::setup;
-          }
-          else if (hashCode == deploy_HASH)
-          {
-            return DeploymentCommandName::deploy;
-          }
-          else if (hashCode == rollback_HASH)
-          {
-            return DeploymentCommandName::rollback;
-          }
-          else if (hashCode == start_HASH)
-          {
-            return DeploymentCommandName::start;
-          }
-          else if (hashCode == stop_HASH)
-          {
-            return DeploymentCommandName::stop;
-          }
-          else if (hashCode == restart_HASH)
-          {
-            return DeploymentCommandName::restart;
-          }
-          else if (hashCode == undeploy_HASH)
-          {
-            return DeploymentCommandName::undeploy;
+          case install_dependencies_HASH:
+            if (name == "install_dependencies")
+            {
+              return DeploymentCommandName::install_dependencies;
+            }
+            break;
+          case update_dependencies_HASH:
+            if (name == "update_dependencies")
+            {
+              return DeploymentCommandName::update_dependencies;
+            }
+            break;
+          case update_custom_cookbooks_HASH:
+            if (name == "update_custom_cookbooks")
+            {
+              return DeploymentCommandName::update_custom_cookbooks;
+            }
+            break;
+          case execute_recipes_HASH:
+            if (name == "execute_recipes")
+            {
+              return DeploymentCommandName::execute_recipes;
+            }
+            break;
+          case configure_HASH:
+            if (name == "configure")
+            {
+              return DeploymentCommandName::configure;
+            }
+            break;
+          case setup_HASH:
+            if (name == "setup")
+            {
+              return DeploymentCommandName::setup;
+            }
+            break;
+          case deploy_HASH:
+            if (name == "deploy")
+            {
+              return DeploymentCommandName::deploy;
+            }
+            break;
+          case rollback_HASH:
+            if (name == "rollback")
+            {
+              return DeploymentCommandName::rollback;
+            }
+            break;
+          case start_HASH:
+            if (name == "start")
+            {
+              return DeploymentCommandName::start;
+            }
+            break;
+          case stop_HASH:
+            if (name == "stop")
+            {
+              return DeploymentCommandName::stop;
+            }
+            break;
+          case restart_HASH:
+            if (name == "restart")
+            {
+              return DeploymentCommandName::restart;
+            }
+            break;
+          case undeploy_HASH:
+            if (name == "undeploy")
+            {
+              return DeploymentCommandName::undeploy;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return DeploymentCommandName::NOT_SET;
         }
 
-        Aws::String GetNameForDeploymentCommandName(DeploymentCommandName enumValue)
+        const char* GetNameForDeploymentCommandName(DeploymentCommandName enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,135 +30,191 @@ namespace Aws
       namespace LayerAttributesKeysMapper
       {
 
-        static const int EcsClusterArn_HASH = HashingUtils::HashString("EcsClusterArn");
-        static const int EnableHaproxyStats_HASH = HashingUtils::HashString("EnableHaproxyStats");
-        static const int HaproxyStatsUrl_HASH = HashingUtils::HashString("HaproxyStatsUrl");
-        static const int HaproxyStatsUser_HASH = HashingUtils::HashString("HaproxyStatsUser");
-        static const int HaproxyStatsPassword_HASH = HashingUtils::HashString("HaproxyStatsPassword");
-        static const int HaproxyHealthCheckUrl_HASH = HashingUtils::HashString("HaproxyHealthCheckUrl");
-        static const int HaproxyHealthCheckMethod_HASH = HashingUtils::HashString("HaproxyHealthCheckMethod");
-        static const int MysqlRootPassword_HASH = HashingUtils::HashString("MysqlRootPassword");
-        static const int MysqlRootPasswordUbiquitous_HASH = HashingUtils::HashString("MysqlRootPasswordUbiquitous");
-        static const int GangliaUrl_HASH = HashingUtils::HashString("GangliaUrl");
-        static const int GangliaUser_HASH = HashingUtils::HashString("GangliaUser");
-        static const int GangliaPassword_HASH = HashingUtils::HashString("GangliaPassword");
-        static const int MemcachedMemory_HASH = HashingUtils::HashString("MemcachedMemory");
-        static const int NodejsVersion_HASH = HashingUtils::HashString("NodejsVersion");
-        static const int RubyVersion_HASH = HashingUtils::HashString("RubyVersion");
-        static const int RubygemsVersion_HASH = HashingUtils::HashString("RubygemsVersion");
-        static const int ManageBundler_HASH = HashingUtils::HashString("ManageBundler");
-        static const int BundlerVersion_HASH = HashingUtils::HashString("BundlerVersion");
-        static const int RailsStack_HASH = HashingUtils::HashString("RailsStack");
-        static const int PassengerVersion_HASH = HashingUtils::HashString("PassengerVersion");
-        static const int Jvm_HASH = HashingUtils::HashString("Jvm");
-        static const int JvmVersion_HASH = HashingUtils::HashString("JvmVersion");
-        static const int JvmOptions_HASH = HashingUtils::HashString("JvmOptions");
-        static const int JavaAppServer_HASH = HashingUtils::HashString("JavaAppServer");
-        static const int JavaAppServerVersion_HASH = HashingUtils::HashString("JavaAppServerVersion");
+        static constexpr int EcsClusterArn_HASH = HashingUtils::CompileTimeHashString("EcsClusterArn");
+        static constexpr int EnableHaproxyStats_HASH = HashingUtils::CompileTimeHashString("EnableHaproxyStats");
+        static constexpr int HaproxyStatsUrl_HASH = HashingUtils::CompileTimeHashString("HaproxyStatsUrl");
+        static constexpr int HaproxyStatsUser_HASH = HashingUtils::CompileTimeHashString("HaproxyStatsUser");
+        static constexpr int HaproxyStatsPassword_HASH = HashingUtils::CompileTimeHashString("HaproxyStatsPassword");
+        static constexpr int HaproxyHealthCheckUrl_HASH = HashingUtils::CompileTimeHashString("HaproxyHealthCheckUrl");
+        static constexpr int HaproxyHealthCheckMethod_HASH = HashingUtils::CompileTimeHashString("HaproxyHealthCheckMethod");
+        static constexpr int MysqlRootPassword_HASH = HashingUtils::CompileTimeHashString("MysqlRootPassword");
+        static constexpr int MysqlRootPasswordUbiquitous_HASH = HashingUtils::CompileTimeHashString("MysqlRootPasswordUbiquitous");
+        static constexpr int GangliaUrl_HASH = HashingUtils::CompileTimeHashString("GangliaUrl");
+        static constexpr int GangliaUser_HASH = HashingUtils::CompileTimeHashString("GangliaUser");
+        static constexpr int GangliaPassword_HASH = HashingUtils::CompileTimeHashString("GangliaPassword");
+        static constexpr int MemcachedMemory_HASH = HashingUtils::CompileTimeHashString("MemcachedMemory");
+        static constexpr int NodejsVersion_HASH = HashingUtils::CompileTimeHashString("NodejsVersion");
+        static constexpr int RubyVersion_HASH = HashingUtils::CompileTimeHashString("RubyVersion");
+        static constexpr int RubygemsVersion_HASH = HashingUtils::CompileTimeHashString("RubygemsVersion");
+        static constexpr int ManageBundler_HASH = HashingUtils::CompileTimeHashString("ManageBundler");
+        static constexpr int BundlerVersion_HASH = HashingUtils::CompileTimeHashString("BundlerVersion");
+        static constexpr int RailsStack_HASH = HashingUtils::CompileTimeHashString("RailsStack");
+        static constexpr int PassengerVersion_HASH = HashingUtils::CompileTimeHashString("PassengerVersion");
+        static constexpr int Jvm_HASH = HashingUtils::CompileTimeHashString("Jvm");
+        static constexpr int JvmVersion_HASH = HashingUtils::CompileTimeHashString("JvmVersion");
+        static constexpr int JvmOptions_HASH = HashingUtils::CompileTimeHashString("JvmOptions");
+        static constexpr int JavaAppServer_HASH = HashingUtils::CompileTimeHashString("JavaAppServer");
+        static constexpr int JavaAppServerVersion_HASH = HashingUtils::CompileTimeHashString("JavaAppServerVersion");
 
 
         LayerAttributesKeys GetLayerAttributesKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EcsClusterArn_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LayerAttributesKeys::EcsClusterArn;
-          }
-          else if (hashCode == EnableHaproxyStats_HASH)
-          {
-            return LayerAttributesKeys::EnableHaproxyStats;
-          }
-          else if (hashCode == HaproxyStatsUrl_HASH)
-          {
-            return LayerAttributesKeys::HaproxyStatsUrl;
-          }
-          else if (hashCode == HaproxyStatsUser_HASH)
-          {
-            return LayerAttributesKeys::HaproxyStatsUser;
-          }
-          else if (hashCode == HaproxyStatsPassword_HASH)
-          {
-            return LayerAttributesKeys::HaproxyStatsPassword;
-          }
-          else if (hashCode == HaproxyHealthCheckUrl_HASH)
-          {
-            return LayerAttributesKeys::HaproxyHealthCheckUrl;
-          }
-          else if (hashCode == HaproxyHealthCheckMethod_HASH)
-          {
-            return LayerAttributesKeys::HaproxyHealthCheckMethod;
-          }
-          else if (hashCode == MysqlRootPassword_HASH)
-          {
-            return LayerAttributesKeys::MysqlRootPassword;
-          }
-          else if (hashCode == MysqlRootPasswordUbiquitous_HASH)
-          {
-            return LayerAttributesKeys::MysqlRootPasswordUbiquitous;
-          }
-          else if (hashCode == GangliaUrl_HASH)
-          {
-            return LayerAttributesKeys::GangliaUrl;
-          }
-          else if (hashCode == GangliaUser_HASH)
-          {
-            return LayerAttributesKeys::GangliaUser;
-          }
-          else if (hashCode == GangliaPassword_HASH)
-          {
-            return LayerAttributesKeys::GangliaPassword;
-          }
-          else if (hashCode == MemcachedMemory_HASH)
-          {
-            return LayerAttributesKeys::MemcachedMemory;
-          }
-          else if (hashCode == NodejsVersion_HASH)
-          {
-            return LayerAttributesKeys::NodejsVersion;
-          }
-          else if (hashCode == RubyVersion_HASH)
-          {
-            return LayerAttributesKeys::RubyVersion;
-          }
-          else if (hashCode == RubygemsVersion_HASH)
-          {
-            return LayerAttributesKeys::RubygemsVersion;
-          }
-          else if (hashCode == ManageBundler_HASH)
-          {
-            return LayerAttributesKeys::ManageBundler;
-          }
-          else if (hashCode == BundlerVersion_HASH)
-          {
-            return LayerAttributesKeys::BundlerVersion;
-          }
-          else if (hashCode == RailsStack_HASH)
-          {
-            return LayerAttributesKeys::RailsStack;
-          }
-          else if (hashCode == PassengerVersion_HASH)
-          {
-            return LayerAttributesKeys::PassengerVersion;
-          }
-          else if (hashCode == Jvm_HASH)
-          {
-            return LayerAttributesKeys::Jvm;
-          }
-          else if (hashCode == JvmVersion_HASH)
-          {
-            return LayerAttributesKeys::JvmVersion;
-          }
-          else if (hashCode == JvmOptions_HASH)
-          {
-            return LayerAttributesKeys::JvmOptions;
-          }
-          else if (hashCode == JavaAppServer_HASH)
-          {
-            return LayerAttributesKeys::JavaAppServer;
-          }
-          else if (hashCode == JavaAppServerVersion_HASH)
-          {
-            return LayerAttributesKeys::JavaAppServerVersion;
+          case EcsClusterArn_HASH:
+            if (name == "EcsClusterArn")
+            {
+              return LayerAttributesKeys::EcsClusterArn;
+            }
+            break;
+          case EnableHaproxyStats_HASH:
+            if (name == "EnableHaproxyStats")
+            {
+              return LayerAttributesKeys::EnableHaproxyStats;
+            }
+            break;
+          case HaproxyStatsUrl_HASH:
+            if (name == "HaproxyStatsUrl")
+            {
+              return LayerAttributesKeys::HaproxyStatsUrl;
+            }
+            break;
+          case HaproxyStatsUser_HASH:
+            if (name == "HaproxyStatsUser")
+            {
+              return LayerAttributesKeys::HaproxyStatsUser;
+            }
+            break;
+          case HaproxyStatsPassword_HASH:
+            if (name == "HaproxyStatsPassword")
+            {
+              return LayerAttributesKeys::HaproxyStatsPassword;
+            }
+            break;
+          case HaproxyHealthCheckUrl_HASH:
+            if (name == "HaproxyHealthCheckUrl")
+            {
+              return LayerAttributesKeys::HaproxyHealthCheckUrl;
+            }
+            break;
+          case HaproxyHealthCheckMethod_HASH:
+            if (name == "HaproxyHealthCheckMethod")
+            {
+              return LayerAttributesKeys::HaproxyHealthCheckMethod;
+            }
+            break;
+          case MysqlRootPassword_HASH:
+            if (name == "MysqlRootPassword")
+            {
+              return LayerAttributesKeys::MysqlRootPassword;
+            }
+            break;
+          case MysqlRootPasswordUbiquitous_HASH:
+            if (name == "MysqlRootPasswordUbiquitous")
+            {
+              return LayerAttributesKeys::MysqlRootPasswordUbiquitous;
+            }
+            break;
+          case GangliaUrl_HASH:
+            if (name == "GangliaUrl")
+            {
+              return LayerAttributesKeys::GangliaUrl;
+            }
+            break;
+          case GangliaUser_HASH:
+            if (name == "GangliaUser")
+            {
+              return LayerAttributesKeys::GangliaUser;
+            }
+            break;
+          case GangliaPassword_HASH:
+            if (name == "GangliaPassword")
+            {
+              return LayerAttributesKeys::GangliaPassword;
+            }
+            break;
+          case MemcachedMemory_HASH:
+            if (name == "MemcachedMemory")
+            {
+              return LayerAttributesKeys::MemcachedMemory;
+            }
+            break;
+          case NodejsVersion_HASH:
+            if (name == "NodejsVersion")
+            {
+              return LayerAttributesKeys::NodejsVersion;
+            }
+            break;
+          case RubyVersion_HASH:
+            if (name == "RubyVersion")
+            {
+              return LayerAttributesKeys::RubyVersion;
+            }
+            break;
+          case RubygemsVersion_HASH:
+            if (name == "RubygemsVersion")
+            {
+              return LayerAttributesKeys::RubygemsVersion;
+            }
+            break;
+          case ManageBundler_HASH:
+            if (name == "ManageBundler")
+            {
+              return LayerAttributesKeys::ManageBundler;
+            }
+            break;
+          case BundlerVersion_HASH:
+            if (name == "BundlerVersion")
+            {
+              return LayerAttributesKeys::BundlerVersion;
+            }
+            break;
+          case RailsStack_HASH:
+            if (name == "RailsStack")
+            {
+              return LayerAttributesKeys::RailsStack;
+            }
+            break;
+          case PassengerVersion_HASH:
+            if (name == "PassengerVersion")
+            {
+              return LayerAttributesKeys::PassengerVersion;
+            }
+            break;
+          case Jvm_HASH:
+            if (name == "Jvm")
+            {
+              return LayerAttributesKeys::Jvm;
+            }
+            break;
+          case JvmVersion_HASH:
+            if (name == "JvmVersion")
+            {
+              return LayerAttributesKeys::JvmVersion;
+            }
+            break;
+          case JvmOptions_HASH:
+            if (name == "JvmOptions")
+            {
+              return LayerAttributesKeys::JvmOptions;
+            }
+            break;
+          case JavaAppServer_HASH:
+            if (name == "JavaAppServer")
+            {
+              return LayerAttributesKeys::JavaAppServer;
+            }
+            break;
+          case JavaAppServerVersion_HASH:
+            if (name == "JavaAppServerVersion")
+            {
+              return LayerAttributesKeys::JavaAppServerVersion;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -170,7 +226,7 @@ namespace Aws
           return LayerAttributesKeys::NOT_SET;
         }
 
-        Aws::String GetNameForLayerAttributesKeys(LayerAttributesKeys enumValue)
+        const char* GetNameForLayerAttributesKeys(LayerAttributesKeys enumValue)
         {
           switch(enumValue)
           {
@@ -228,7 +284,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
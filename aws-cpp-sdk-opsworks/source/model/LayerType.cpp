@@ -30,70 +30,100 @@ namespace Aws
       namespace LayerTypeMapper
       {
 
-        static const int aws_flow_ruby_HASH = HashingUtils::HashString("aws-flow-ruby");
-        static const int ecs_cluster_HASH = HashingUtils::HashString("ecs-cluster");
-        static const int java_app_HASH = HashingUtils::HashString("java-app");
-        static const int lb_HASH = HashingUtils::HashString("lb");
-        static const int web_HASH = HashingUtils::HashString("web");
-        static const int php_app_HASH = HashingUtils::HashString("php-app");
-        static const int rails_app_HASH = HashingUtils::HashString("rails-app");
-        static const int nodejs_app_HASH = HashingUtils::HashString("nodejs-app");
-        static const int memcached_HASH = HashingUtils::HashString("memcached");
-        static const int db_master_HASH = HashingUtils::HashString("db-master");
-        static const int monitoring_master_HASH = HashingUtils::HashString("monitoring-master");
-        static const int custom_HASH = HashingUtils::HashString("custom");
+        static constexpr int aws_flow_ruby_HASH = HashingUtils::CompileTimeHashString("aws-flow-ruby");
+        static constexpr int ecs_cluster_HASH = HashingUtils::CompileTimeHashString("ecs-cluster");
+        static constexpr int java_app_HASH = HashingUtils::CompileTimeHashString("java-app");
+        static constexpr int lb_HASH = HashingUtils::CompileTimeHashString("lb");
+        static constexpr int web_HASH = HashingUtils::CompileTimeHashString("web");
+        static constexpr int php_app_HASH = HashingUtils::CompileTimeHashString("php-app");
+        static constexpr int rails_app_HASH = HashingUtils::CompileTimeHashString("rails-app");
+        static constexpr int nodejs_app_HASH = HashingUtils::CompileTimeHashString("nodejs-app");
+        static constexpr int memcached_HASH = HashingUtils::CompileTimeHashString("memcached");
+        static constexpr int db_master_HASH = HashingUtils::CompileTimeHashString("db-master");
+        static constexpr int monitoring_master_HASH = HashingUtils::CompileTimeHashString("monitoring-master");
+        static constexpr int custom_HASH = HashingUtils::CompileTimeHashString("custom");
 
 
         LayerType GetLayerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == aws_flow_ruby_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LayerType::aws_flow_ruby;
-          }
-          else if (hashCode == ecs_cluster_HASH)
-          {
-            return LayerType::ecs_cluster;
-          }
-          else if (hashCode == java_app_HASH)
-          {
-            return LayerType::java_app;
-          }
-          else if (hashCode == lb_HASH)
-          {
-            return LayerType::lb;
-          }
-          else if (hashCode == web_HASH)
-          {
-            return LayerType::web;
-          }
-          else if (hashCode == php_app_HASH)
-          {
-            return LayerType::php_app;
-          }
-          else if (hashCode == rails_app_HASH)
-          {
-            return LayerType::rails_app;
-          }
-          else if (hashCode == nodejs_app_HASH)
-          {
-            return LayerType::nodejs_app;
-          }
-          else if (hashCode == memcached_HASH)
-          {
-            return LayerType::memcached;
-          }
-          else if (hashCode == db_master_HASH)
-          {
-            return LayerType::db_master;
-          }
-          else if (hashCode == monitoring_master_HASH)
-          {
-            return LayerType::monitoring_master;
-          }
-          else if (hashCode == custom_HASH)
-          {
-            return LayerType::custom;
+          case aws_flow_ruby_HASH:
+            if (name == "aws-flow-ruby")
+            {
+              return LayerType::aws_flow_ruby;
+            }
+            break;
+          case ecs_cluster_HASH:
+            if (name == "ecs-cluster")
+            {
+              return LayerType::ecs_cluster;
+            }
+            break;
+          case java_app_HASH:
+            if (name == "java-app")
+            {
+              return LayerType::java_app;
+            }
+            break;
+          case lb_HASH:
+            if (name == "lb")
+            {
+              return LayerType::lb;
+            }
+            break;
+          case web_HASH:
+            if (name == "web")
+            {
+              return LayerType::web;
+            }
+            break;
+          case php_app_HASH:
+            if (name == "php-app")
+            {
+              return LayerType::php_app;
+            }
+            break;
+          case rails_app_HASH:
+            if (name == "rails-app")
+            {
+              return LayerType::rails_app;
+            }
+            break;
+          case nodejs_app_HASH:
+            if (name == "nodejs-app")
+            {
+              return LayerType::nodejs_app;
+            }
+            break;
+          case memcached_HASH:
+            if (name == "memcached")
+            {
+              return LayerType::memcached;
+            }
+            break;
+          case db_master_HASH:
+            if (name == "db-master")
+            {
+              return LayerType::db_master;
+            }
+            break;
+          case monitoring_master_HASH:
+            if (name == "monitoring-master")
+            {
+              return LayerType::monitoring_master;
+            }
+            break;
+          case custom_HASH:
+            if (name == "custom")
+            {
+              return LayerType::custom;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return LayerType::NOT_SET;
         }
 
-        Aws::String GetNameForLayerType(LayerType enumValue)
+        const char* GetNameForLayerType(LayerType enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace RootDeviceTypeMapper
       {
 
-        static const int ebs_HASH = HashingUtils::HashString("ebs");
-        static const int instance_store_HASH = HashingUtils::HashString("instance-store");
+        static constexpr int ebs_HASH = HashingUtils::CompileTimeHashString("ebs");
+        static constexpr int instance_store_HASH = HashingUtils::CompileTimeHashString("instance-store");
 
 
         RootDeviceType GetRootDeviceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ebs_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RootDeviceType::ebs;
-          }
-          else if (hashCode == instance_store_HASH)
-          {
-            return RootDeviceType::instance_store;
+          case ebs_HASH:
+            if (name == "ebs")
+            {
+              return RootDeviceType::ebs;
+            }
+            break;
+          case instance_store_HASH:
+            if (name == "instance-store")
+            {
+              return RootDeviceType::instance_store;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RootDeviceType::NOT_SET;
         }
 
-        Aws::String GetNameForRootDeviceType(RootDeviceType enumValue)
+        const char* GetNameForRootDeviceType(RootDeviceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int git_HASH = HashingUtils::HashString("git");
-        static const int svn_HASH = HashingUtils::HashString("svn");
-        static const int archive_HASH = HashingUtils::HashString("archive");
-        static const int s3_HASH = HashingUtils::HashString("s3");
+        static constexpr int git_HASH = HashingUtils::CompileTimeHashString("git");
+        static constexpr int svn_HASH = HashingUtils::CompileTimeHashString("svn");
+        static constexpr int archive_HASH = HashingUtils::CompileTimeHashString("archive");
+        static constexpr int s3_HASH = HashingUtils::CompileTimeHashString("s3");
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == git_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceType::git;
-          }
-          else if (hashCode == svn_HASH)
-          {
-            return SourceType::svn;
-          }
-          else if (hashCode == archive_HASH)
-          {
-            return SourceType::archive;
-          }
-          else if (hashCode == s3_HASH)
-          {
-            return SourceType::s3;
+          case git_HASH:
+            if (name == "git")
+            {
+              return SourceType::git;
+            }
+            break;
+          case svn_HASH:
+            if (name == "svn")
+            {
+              return SourceType::svn;
+            }
+            break;
+          case archive_HASH:
+            if (name == "archive")
+            {
+              return SourceType::archive;
+            }
+            break;
+          case s3_HASH:
+            if (name == "s3")
+            {
+              return SourceType::s3;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceType(SourceType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace StackAttributesKeysMapper
       {
 
-        static const int Color_HASH = HashingUtils::HashString("Color");
+        static constexpr int Color_HASH = HashingUtils::CompileTimeHashString("Color");
 
 
         StackAttributesKeys GetStackAttributesKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Color_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StackAttributesKeys::Color;
+          case Color_HASH:
+            if (name == "Color")
+            {
+              return StackAttributesKeys::Color;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return StackAttributesKeys::NOT_SET;
         }
 
-        Aws::String GetNameForStackAttributesKeys(StackAttributesKeys enumValue)
+        const char* GetNameForStackAttributesKeys(StackAttributesKeys enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
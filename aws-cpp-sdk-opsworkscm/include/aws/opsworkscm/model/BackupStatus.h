@@ -36,7 +36,8 @@ namespace BackupStatusMapper
 {
 AWS_OPSWORKSCM_API BackupStatus GetBackupStatusForName(const Aws::String& name);
 
-AWS_OPSWORKSCM_API Aws::String GetNameForBackupStatus(BackupStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKSCM_API const char* GetNameForBackupStatus(BackupStatus value);
 } // namespace BackupStatusMapper
 } // namespace Model
 } // namespace OpsWorksCM
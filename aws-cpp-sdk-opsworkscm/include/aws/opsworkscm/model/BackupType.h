@@ -34,7 +34,8 @@ namespace BackupTypeMapper
 {
 AWS_OPSWORKSCM_API BackupType GetBackupTypeForName(const Aws::String& name);
 
-AWS_OPSWORKSCM_API Aws::String GetNameForBackupType(BackupType value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKSCM_API const char* GetNameForBackupType(BackupType value);
 } // namespace BackupTypeMapper
 } // namespace Model
 } // namespace OpsWorksCM
@@ -34,7 +34,8 @@ namespace MaintenanceStatusMapper
 {
 AWS_OPSWORKSCM_API MaintenanceStatus GetMaintenanceStatusForName(const Aws::String& name);
 
-AWS_OPSWORKSCM_API Aws::String GetNameForMaintenanceStatus(MaintenanceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKSCM_API const char* GetNameForMaintenanceStatus(MaintenanceStatus value);
 } // namespace MaintenanceStatusMapper
 } // namespace Model
 } // namespace OpsWorksCM
@@ -35,7 +35,8 @@ namespace NodeAssociationStatusMapper
 {
 AWS_OPSWORKSCM_API NodeAssociationStatus GetNodeAssociationStatusForName(const Aws::String& name);
 
-AWS_OPSWORKSCM_API Aws::String GetNameForNodeAssociationStatus(NodeAssociationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKSCM_API const char* GetNameForNodeAssociationStatus(NodeAssociationStatus value);
 } // namespace NodeAssociationStatusMapper
 } // namespace Model
 } // namespace OpsWorksCM
@@ -45,7 +45,8 @@ namespace ServerStatusMapper
 {
 AWS_OPSWORKSCM_API ServerStatus GetServerStatusForName(const Aws::String& name);
 
-AWS_OPSWORKSCM_API Aws::String GetNameForServerStatus(ServerStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_OPSWORKSCM_API const char* GetNameForServerStatus(ServerStatus value);
 } // namespace ServerStatusMapper
 } // namespace Model
 } // namespace OpsWorksCM
@@ -30,30 +30,44 @@ namespace Aws
       namespace BackupStatusMapper
       {
 
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int OK_HASH = HashingUtils::HashString("OK");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int OK_HASH = HashingUtils::CompileTimeHashString("OK");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
 
 
         BackupStatus GetBackupStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BackupStatus::IN_PROGRESS;
-          }
-          else if (hashCode == OK_HASH)
-          {
-            return BackupStatus::OK;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return BackupStatus::FAILED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return BackupStatus::DELETING;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return BackupStatus::IN_PROGRESS;
+            }
+            break;
+          case OK_HASH:
+            if (name == "OK")
+            {
+              return BackupStatus::OK;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return BackupStatus::FAILED;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return BackupStatus::DELETING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return BackupStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBackupStatus(BackupStatus enumValue)
+        const char* GetNameForBackupStatus(BackupStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
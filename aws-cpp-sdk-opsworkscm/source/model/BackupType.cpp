@@ -30,20 +30,30 @@ namespace Aws
       namespace BackupTypeMapper
       {
 
-        static const int AUTOMATED_HASH = HashingUtils::HashString("AUTOMATED");
-        static const int MANUAL_HASH = HashingUtils::HashString("MANUAL");
+        static constexpr int AUTOMATED_HASH = HashingUtils::CompileTimeHashString("AUTOMATED");
+        static constexpr int MANUAL_HASH = HashingUtils::CompileTimeHashString("MANUAL");
 
 
         BackupType GetBackupTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTOMATED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BackupType::AUTOMATED;
-          }
-          else if (hashCode == MANUAL_HASH)
-          {
-            return BackupType::MANUAL;
+          case AUTOMATED_HASH:
+            if (name == "AUTOMATED")
+            {
+              return BackupType::AUTOMATED;
+            }
+            break;
+          case MANUAL_HASH:
+            if (name == "MANUAL")
+            {
+              return BackupType::MANUAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BackupType::NOT_SET;
         }
 
-        Aws::String GetNameForBackupType(BackupType enumValue)
+        const char* GetNameForBackupType(BackupType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
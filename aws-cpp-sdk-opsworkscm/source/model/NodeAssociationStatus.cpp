@@ -30,25 +30,37 @@ namespace Aws
       namespace NodeAssociationStatusMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
 
 
         NodeAssociationStatus GetNodeAssociationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NodeAssociationStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return NodeAssociationStatus::FAILED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return NodeAssociationStatus::IN_PROGRESS;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return NodeAssociationStatus::SUCCESS;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return NodeAssociationStatus::FAILED;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return NodeAssociationStatus::IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return NodeAssociationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForNodeAssociationStatus(NodeAssociationStatus enumValue)
+        const char* GetNameForNodeAssociationStatus(NodeAssociationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,75 +30,107 @@ namespace Aws
       namespace ServerStatusMapper
       {
 
-        static const int BACKING_UP_HASH = HashingUtils::HashString("BACKING_UP");
-        static const int CONNECTION_LOST_HASH = HashingUtils::HashString("CONNECTION_LOST");
-        static const int CREATING_HASH = HashingUtils::HashString("CREATING");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int MODIFYING_HASH = HashingUtils::HashString("MODIFYING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int RESTORING_HASH = HashingUtils::HashString("RESTORING");
-        static const int SETUP_HASH = HashingUtils::HashString("SETUP");
-        static const int UNDER_MAINTENANCE_HASH = HashingUtils::HashString("UNDER_MAINTENANCE");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
+        static constexpr int BACKING_UP_HASH = HashingUtils::CompileTimeHashString("BACKING_UP");
+        static constexpr int CONNECTION_LOST_HASH = HashingUtils::CompileTimeHashString("CONNECTION_LOST");
+        static constexpr int CREATING_HASH = HashingUtils::CompileTimeHashString("CREATING");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int MODIFYING_HASH = HashingUtils::CompileTimeHashString("MODIFYING");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int HEALTHY_HASH = HashingUtils::CompileTimeHashString("HEALTHY");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int RESTORING_HASH = HashingUtils::CompileTimeHashString("RESTORING");
+        static constexpr int SETUP_HASH = HashingUtils::CompileTimeHashString("SETUP");
+        static constexpr int UNDER_MAINTENANCE_HASH = HashingUtils::CompileTimeHashString("UNDER_MAINTENANCE");
+        static constexpr int UNHEALTHY_HASH = HashingUtils::CompileTimeHashString("UNHEALTHY");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
 
 
         ServerStatus GetServerStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BACKING_UP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServerStatus::BACKING_UP;
-          }
-          else if (hashCode == CONNECTION_LOST_HASH)
-          {
-            return ServerStatus::CONNECTION_LOST;
-          }
-          else if (hashCode == CREATING_HASH)
-          {
-            return ServerStatus::CREATING;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ServerStatus::DELETING;
-          }
-          else if (hashCode == MODIFYING_HASH)
-          {
-            return ServerStatus::MODIFYING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ServerStatus::FAILED;
-          }
-          else if (hashCode == HEALTHY_HASH)
-          {
-            return ServerStatus::HEALTHY;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return ServerStatus::RUNNING;
-          }
-          else if (hashCode == RESTORING_HASH)
-          {
-            return ServerStatus::RESTORING;
-          }
-          else if (hashCode == SETUP_HASH)
-          {
-            return ServerStatus::SETUP;
-          }
-          else if (hashCode == UNDER_MAINTENANCE_HASH)
-          {
-            return ServerStatus::UNDER_MAINTENANCE;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return ServerStatus::UNHEALTHY;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return ServerStatus::TERMINATED;
+          case BACKING_UP_HASH:
+            if (name == "BACKING_UP")
+            {
+              return ServerStatus::BACKING_UP;
+            }
+            break;
+          case CONNECTION_LOST_HASH:
+            if (name == "CONNECTION_LOST")
+            {
+              return ServerStatus::CONNECTION_LOST;
+            }
+            break;
+          case CREATING_HASH:
+            if (name == "CREATING")
+            {
+              return ServerStatus::CREATING;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ServerStatus::DELETING;
+            }
+            break;
+          case MODIFYING_HASH:
+            if (name == "MODIFYING")
+            {
+              return ServerStatus::MODIFYING;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ServerStatus::FAILED;
+            }
+            break;
+          case HEALTHY_HASH:
+            if (name == "HEALTHY")
+            {
+              return ServerStatus::HEALTHY;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return ServerStatus::RUNNING;
+            }
+            break;
+          case RESTORING_HASH:
+            if (name == "RESTORING")
+            {
+              return ServerStatus::RESTORING;
+            }
+            break;
+          case SETUP_HASH:
+            if (name == "SETUP")
+            {
+              return ServerStatus::SETUP;
+            }
+            break;
+          case UNDER_MAINTENANCE_HASH:
+            if (name == "UNDER_MAINTENANCE")
+            {
+              return ServerStatus::UNDER_MAINTENANCE;
+            }
+            break;
+          case UNHEALTHY_HASH:
+            if (name == "UNHEALTHY")
+            {
+              return ServerStatus::UNHEALTHY;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return ServerStatus::TERMINATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,7 +142,7 @@ namespace Aws
           return ServerStatus::NOT_SET;
         }
 
-        Aws::String GetNameForServerStatus(ServerStatus enumValue)
+        const char* GetNameForServerStatus(ServerStatus enumValue)
         {
           switch(enumValue)
           {
@@ -144,7 +176,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -33,7 +33,8 @@ namespace AccessDeniedForDependencyExceptionReasonMapper
 {
 AWS_ORGANIZATIONS_API AccessDeniedForDependencyExceptionReason GetAccessDeniedForDependencyExceptionReasonForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForAccessDeniedForDependencyExceptionReason(AccessDeniedForDependencyExceptionReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForAccessDeniedForDependencyExceptionReason(AccessDeniedForDependencyExceptionReason value);
 } // namespace AccessDeniedForDependencyExceptionReasonMapper
 } // namespace Model
 } // namespace Organizations
@@ -34,7 +34,8 @@ namespace AccountJoinedMethodMapper
 {
 AWS_ORGANIZATIONS_API AccountJoinedMethod GetAccountJoinedMethodForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForAccountJoinedMethod(AccountJoinedMethod value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForAccountJoinedMethod(AccountJoinedMethod value);
 } // namespace AccountJoinedMethodMapper
 } // namespace Model
 } // namespace Organizations
@@ -34,7 +34,8 @@ namespace AccountStatusMapper
 {
 AWS_ORGANIZATIONS_API AccountStatus GetAccountStatusForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForAccountStatus(AccountStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForAccountStatus(AccountStatus value);
 } // namespace AccountStatusMapper
 } // namespace Model
 } // namespace Organizations
@@ -36,7 +36,8 @@ namespace ActionTypeMapper
 {
 AWS_ORGANIZATIONS_API ActionType GetActionTypeForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForActionType(ActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForActionType(ActionType value);
 } // namespace ActionTypeMapper
 } // namespace Model
 } // namespace Organizations
@@ -34,7 +34,8 @@ namespace ChildTypeMapper
 {
 AWS_ORGANIZATIONS_API ChildType GetChildTypeForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForChildType(ChildType value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForChildType(ChildType value);
 } // namespace ChildTypeMapper
 } // namespace Model
 } // namespace Organizations
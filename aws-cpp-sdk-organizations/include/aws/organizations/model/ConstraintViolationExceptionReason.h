@@ -48,7 +48,8 @@ namespace ConstraintViolationExceptionReasonMapper
 {
 AWS_ORGANIZATIONS_API ConstraintViolationExceptionReason GetConstraintViolationExceptionReasonForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForConstraintViolationExceptionReason(ConstraintViolationExceptionReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForConstraintViolationExceptionReason(ConstraintViolationExceptionReason value);
 } // namespace ConstraintViolationExceptionReasonMapper
 } // namespace Model
 } // namespace Organizations
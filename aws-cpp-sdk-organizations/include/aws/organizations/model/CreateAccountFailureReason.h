@@ -38,7 +38,8 @@ namespace CreateAccountFailureReasonMapper
 {
 AWS_ORGANIZATIONS_API CreateAccountFailureReason GetCreateAccountFailureReasonForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForCreateAccountFailureReason(CreateAccountFailureReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForCreateAccountFailureReason(CreateAccountFailureReason value);
 } // namespace CreateAccountFailureReasonMapper
 } // namespace Model
 } // namespace Organizations
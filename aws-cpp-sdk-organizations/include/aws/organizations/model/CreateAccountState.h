@@ -35,7 +35,8 @@ namespace CreateAccountStateMapper
 {
 AWS_ORGANIZATIONS_API CreateAccountState GetCreateAccountStateForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForCreateAccountState(CreateAccountState value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForCreateAccountState(CreateAccountState value);
 } // namespace CreateAccountStateMapper
 } // namespace Model
 } // namespace Organizations
@@ -40,7 +40,8 @@ namespace HandshakeConstraintViolationExceptionReasonMapper
 {
 AWS_ORGANIZATIONS_API HandshakeConstraintViolationExceptionReason GetHandshakeConstraintViolationExceptionReasonForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForHandshakeConstraintViolationExceptionReason(HandshakeConstraintViolationExceptionReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForHandshakeConstraintViolationExceptionReason(HandshakeConstraintViolationExceptionReason value);
 } // namespace HandshakeConstraintViolationExceptionReasonMapper
 } // namespace Model
 } // namespace Organizations
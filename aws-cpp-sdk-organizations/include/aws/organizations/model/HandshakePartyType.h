@@ -35,7 +35,8 @@ namespace HandshakePartyTypeMapper
 {
 AWS_ORGANIZATIONS_API HandshakePartyType GetHandshakePartyTypeForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForHandshakePartyType(HandshakePartyType value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForHandshakePartyType(HandshakePartyType value);
 } // namespace HandshakePartyTypeMapper
 } // namespace Model
 } // namespace Organizations
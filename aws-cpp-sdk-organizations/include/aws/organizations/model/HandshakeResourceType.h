@@ -40,7 +40,8 @@ namespace HandshakeResourceTypeMapper
 {
 AWS_ORGANIZATIONS_API HandshakeResourceType GetHandshakeResourceTypeForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForHandshakeResourceType(HandshakeResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForHandshakeResourceType(HandshakeResourceType value);
 } // namespace HandshakeResourceTypeMapper
 } // namespace Model
 } // namespace Organizations
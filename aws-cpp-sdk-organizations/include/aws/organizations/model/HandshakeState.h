@@ -38,7 +38,8 @@ namespace HandshakeStateMapper
 {
 AWS_ORGANIZATIONS_API HandshakeState GetHandshakeStateForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForHandshakeState(HandshakeState value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForHandshakeState(HandshakeState value);
 } // namespace HandshakeStateMapper
 } // namespace Model
 } // namespace Organizations
@@ -34,7 +34,8 @@ namespace IAMUserAccessToBillingMapper
 {
 AWS_ORGANIZATIONS_API IAMUserAccessToBilling GetIAMUserAccessToBillingForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForIAMUserAccessToBilling(IAMUserAccessToBilling value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForIAMUserAccessToBilling(IAMUserAccessToBilling value);
 } // namespace IAMUserAccessToBillingMapper
 } // namespace Model
 } // namespace Organizations
@@ -51,7 +51,8 @@ namespace InvalidInputExceptionReasonMapper
 {
 AWS_ORGANIZATIONS_API InvalidInputExceptionReason GetInvalidInputExceptionReasonForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForInvalidInputExceptionReason(InvalidInputExceptionReason value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForInvalidInputExceptionReason(InvalidInputExceptionReason value);
 } // namespace InvalidInputExceptionReasonMapper
 } // namespace Model
 } // namespace Organizations
@@ -34,7 +34,8 @@ namespace OrganizationFeatureSetMapper
 {
 AWS_ORGANIZATIONS_API OrganizationFeatureSet GetOrganizationFeatureSetForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForOrganizationFeatureSet(OrganizationFeatureSet value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForOrganizationFeatureSet(OrganizationFeatureSet value);
 } // namespace OrganizationFeatureSetMapper
 } // namespace Model
 } // namespace Organizations
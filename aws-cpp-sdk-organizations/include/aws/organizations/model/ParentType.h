@@ -34,7 +34,8 @@ namespace ParentTypeMapper
 {
 AWS_ORGANIZATIONS_API ParentType GetParentTypeForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForParentType(ParentType value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForParentType(ParentType value);
 } // namespace ParentTypeMapper
 } // namespace Model
 } // namespace Organizations
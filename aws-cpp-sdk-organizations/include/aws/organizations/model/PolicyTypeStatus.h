@@ -35,7 +35,8 @@ namespace PolicyTypeStatusMapper
 {
 AWS_ORGANIZATIONS_API PolicyTypeStatus GetPolicyTypeStatusForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForPolicyTypeStatus(PolicyTypeStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForPolicyTypeStatus(PolicyTypeStatus value);
 } // namespace PolicyTypeStatusMapper
 } // namespace Model
 } // namespace Organizations
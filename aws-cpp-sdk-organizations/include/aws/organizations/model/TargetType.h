@@ -35,7 +35,8 @@ namespace TargetTypeMapper
 {
 AWS_ORGANIZATIONS_API TargetType GetTargetTypeForName(const Aws::String& name);
 
-AWS_ORGANIZATIONS_API Aws::String GetNameForTargetType(TargetType value);
+// names of values not modeled point into the enum overflow container
+AWS_ORGANIZATIONS_API const char* GetNameForTargetType(TargetType value);
 } // namespace TargetTypeMapper
 } // namespace Model
 } // namespace Organizations
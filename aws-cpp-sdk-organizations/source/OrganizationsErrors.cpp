@@ -28,43 +28,43 @@ namespace Organizations
 namespace OrganizationsErrorMapper
 {
 
-static const int HANDSHAKE_CONSTRAINT_VIOLATION_HASH = HashingUtils::HashString("HandshakeConstraintViolationException");
-static const int INVALID_HANDSHAKE_TRANSITION_HASH = HashingUtils::HashString("InvalidHandshakeTransitionException");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInputException");
-static const int DUPLICATE_POLICY_HASH = HashingUtils::HashString("DuplicatePolicyException");
-static const int TARGET_NOT_FOUND_HASH = HashingUtils::HashString("TargetNotFoundException");
-static const int POLICY_NOT_FOUND_HASH = HashingUtils::HashString("PolicyNotFoundException");
-static const int CHILD_NOT_FOUND_HASH = HashingUtils::HashString("ChildNotFoundException");
-static const int HANDSHAKE_ALREADY_IN_STATE_HASH = HashingUtils::HashString("HandshakeAlreadyInStateException");
-static const int CREATE_ACCOUNT_STATUS_NOT_FOUND_HASH = HashingUtils::HashString("CreateAccountStatusNotFoundException");
-static const int POLICY_TYPE_ALREADY_ENABLED_HASH = HashingUtils::HashString("PolicyTypeAlreadyEnabledException");
-static const int POLICY_NOT_ATTACHED_HASH = HashingUtils::HashString("PolicyNotAttachedException");
-static const int SERVICE_HASH = HashingUtils::HashString("ServiceException");
-static const int FINALIZING_ORGANIZATION_HASH = HashingUtils::HashString("FinalizingOrganizationException");
-static const int ACCESS_DENIED_FOR_DEPENDENCY_HASH = HashingUtils::HashString("AccessDeniedForDependencyException");
-static const int POLICY_IN_USE_HASH = HashingUtils::HashString("PolicyInUseException");
-static const int ALREADY_IN_ORGANIZATION_HASH = HashingUtils::HashString("AlreadyInOrganizationException");
-static const int ACCOUNT_NOT_FOUND_HASH = HashingUtils::HashString("AccountNotFoundException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
-static const int SOURCE_PARENT_NOT_FOUND_HASH = HashingUtils::HashString("SourceParentNotFoundException");
-static const int ORGANIZATIONAL_UNIT_NOT_EMPTY_HASH = HashingUtils::HashString("OrganizationalUnitNotEmptyException");
-static const int DESTINATION_PARENT_NOT_FOUND_HASH = HashingUtils::HashString("DestinationParentNotFoundException");
-static const int POLICY_TYPE_NOT_AVAILABLE_FOR_ORGANIZATION_HASH = HashingUtils::HashString("PolicyTypeNotAvailableForOrganizationException");
-static const int A_W_S_ORGANIZATIONS_NOT_IN_USE_HASH = HashingUtils::HashString("AWSOrganizationsNotInUseException");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int DUPLICATE_POLICY_ATTACHMENT_HASH = HashingUtils::HashString("DuplicatePolicyAttachmentException");
-static const int HANDSHAKE_NOT_FOUND_HASH = HashingUtils::HashString("HandshakeNotFoundException");
-static const int PARENT_NOT_FOUND_HASH = HashingUtils::HashString("ParentNotFoundException");
-static const int MASTER_CANNOT_LEAVE_ORGANIZATION_HASH = HashingUtils::HashString("MasterCannotLeaveOrganizationException");
-static const int DUPLICATE_ACCOUNT_HASH = HashingUtils::HashString("DuplicateAccountException");
-static const int POLICY_TYPE_NOT_ENABLED_HASH = HashingUtils::HashString("PolicyTypeNotEnabledException");
-static const int ROOT_NOT_FOUND_HASH = HashingUtils::HashString("RootNotFoundException");
-static const int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::HashString("MalformedPolicyDocumentException");
-static const int ORGANIZATION_NOT_EMPTY_HASH = HashingUtils::HashString("OrganizationNotEmptyException");
-static const int CONSTRAINT_VIOLATION_HASH = HashingUtils::HashString("ConstraintViolationException");
-static const int ORGANIZATIONAL_UNIT_NOT_FOUND_HASH = HashingUtils::HashString("OrganizationalUnitNotFoundException");
-static const int DUPLICATE_ORGANIZATIONAL_UNIT_HASH = HashingUtils::HashString("DuplicateOrganizationalUnitException");
-static const int DUPLICATE_HANDSHAKE_HASH = HashingUtils::HashString("DuplicateHandshakeException");
+static constexpr int HANDSHAKE_CONSTRAINT_VIOLATION_HASH = HashingUtils::CompileTimeHashString("HandshakeConstraintViolationException");
+static constexpr int INVALID_HANDSHAKE_TRANSITION_HASH = HashingUtils::CompileTimeHashString("InvalidHandshakeTransitionException");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInputException");
+static constexpr int DUPLICATE_POLICY_HASH = HashingUtils::CompileTimeHashString("DuplicatePolicyException");
+static constexpr int TARGET_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("TargetNotFoundException");
+static constexpr int POLICY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("PolicyNotFoundException");
+static constexpr int CHILD_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ChildNotFoundException");
+static constexpr int HANDSHAKE_ALREADY_IN_STATE_HASH = HashingUtils::CompileTimeHashString("HandshakeAlreadyInStateException");
+static constexpr int CREATE_ACCOUNT_STATUS_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("CreateAccountStatusNotFoundException");
+static constexpr int POLICY_TYPE_ALREADY_ENABLED_HASH = HashingUtils::CompileTimeHashString("PolicyTypeAlreadyEnabledException");
+static constexpr int POLICY_NOT_ATTACHED_HASH = HashingUtils::CompileTimeHashString("PolicyNotAttachedException");
+static constexpr int SERVICE_HASH = HashingUtils::CompileTimeHashString("ServiceException");
+static constexpr int FINALIZING_ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("FinalizingOrganizationException");
+static constexpr int ACCESS_DENIED_FOR_DEPENDENCY_HASH = HashingUtils::CompileTimeHashString("AccessDeniedForDependencyException");
+static constexpr int POLICY_IN_USE_HASH = HashingUtils::CompileTimeHashString("PolicyInUseException");
+static constexpr int ALREADY_IN_ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("AlreadyInOrganizationException");
+static constexpr int ACCOUNT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("AccountNotFoundException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
+static constexpr int SOURCE_PARENT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SourceParentNotFoundException");
+static constexpr int ORGANIZATIONAL_UNIT_NOT_EMPTY_HASH = HashingUtils::CompileTimeHashString("OrganizationalUnitNotEmptyException");
+static constexpr int DESTINATION_PARENT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("DestinationParentNotFoundException");
+static constexpr int POLICY_TYPE_NOT_AVAILABLE_FOR_ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("PolicyTypeNotAvailableForOrganizationException");
+static constexpr int A_W_S_ORGANIZATIONS_NOT_IN_USE_HASH = HashingUtils::CompileTimeHashString("AWSOrganizationsNotInUseException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int DUPLICATE_POLICY_ATTACHMENT_HASH = HashingUtils::CompileTimeHashString("DuplicatePolicyAttachmentException");
+static constexpr int HANDSHAKE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("HandshakeNotFoundException");
+static constexpr int PARENT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ParentNotFoundException");
+static constexpr int MASTER_CANNOT_LEAVE_ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("MasterCannotLeaveOrganizationException");
+static constexpr int DUPLICATE_ACCOUNT_HASH = HashingUtils::CompileTimeHashString("DuplicateAccountException");
+static constexpr int POLICY_TYPE_NOT_ENABLED_HASH = HashingUtils::CompileTimeHashString("PolicyTypeNotEnabledException");
+static constexpr int ROOT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("RootNotFoundException");
+static constexpr int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::CompileTimeHashString("MalformedPolicyDocumentException");
+static constexpr int ORGANIZATION_NOT_EMPTY_HASH = HashingUtils::CompileTimeHashString("OrganizationNotEmptyException");
+static constexpr int CONSTRAINT_VIOLATION_HASH = HashingUtils::CompileTimeHashString("ConstraintViolationException");
+static constexpr int ORGANIZATIONAL_UNIT_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("OrganizationalUnitNotFoundException");
+static constexpr int DUPLICATE_ORGANIZATIONAL_UNIT_HASH = HashingUtils::CompileTimeHashString("DuplicateOrganizationalUnitException");
+static constexpr int DUPLICATE_HANDSHAKE_HASH = HashingUtils::CompileTimeHashString("DuplicateHandshakeException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
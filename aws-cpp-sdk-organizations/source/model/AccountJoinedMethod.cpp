@@ -30,20 +30,30 @@ namespace Aws
       namespace AccountJoinedMethodMapper
       {
 
-        static const int INVITED_HASH = HashingUtils::HashString("INVITED");
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
+        static constexpr int INVITED_HASH = HashingUtils::CompileTimeHashString("INVITED");
+        static constexpr int CREATED_HASH = HashingUtils::CompileTimeHashString("CREATED");
 
 
         AccountJoinedMethod GetAccountJoinedMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVITED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccountJoinedMethod::INVITED;
-          }
-          else if (hashCode == CREATED_HASH)
-          {
-            return AccountJoinedMethod::CREATED;
+          case INVITED_HASH:
+            if (name == "INVITED")
+            {
+              return AccountJoinedMethod::INVITED;
+            }
+            break;
+          case CREATED_HASH:
+            if (name == "CREATED")
+            {
+              return AccountJoinedMethod::CREATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AccountJoinedMethod::NOT_SET;
         }
 
-        Aws::String GetNameForAccountJoinedMethod(AccountJoinedMethod enumValue)
+        const char* GetNameForAccountJoinedMethod(AccountJoinedMethod enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
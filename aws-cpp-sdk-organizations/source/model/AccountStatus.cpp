@@ -30,20 +30,30 @@ namespace Aws
       namespace AccountStatusMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int SUSPENDED_HASH = HashingUtils::CompileTimeHashString("SUSPENDED");
 
 
         AccountStatus GetAccountStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccountStatus::ACTIVE;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
-            return AccountStatus::SUSPENDED;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return AccountStatus::ACTIVE;
+            }
+            break;
+          case SUSPENDED_HASH:
+            if (name == "SUSPENDED")
+            {
+              return AccountStatus::SUSPENDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AccountStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAccountStatus(AccountStatus enumValue)
+        const char* GetNameForAccountStatus(AccountStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
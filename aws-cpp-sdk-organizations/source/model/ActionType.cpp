@@ -30,30 +30,44 @@ namespace Aws
       namespace ActionTypeMapper
       {
 
-        static const int INVITE_HASH = HashingUtils::HashString("INVITE");
-        static const int ENABLE_ALL_FEATURES_HASH = HashingUtils::HashString("ENABLE_ALL_FEATURES");
-        static const int APPROVE_ALL_FEATURES_HASH = HashingUtils::HashString("APPROVE_ALL_FEATURES");
-        static const int ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE_HASH = HashingUtils::HashString("ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE");
+        static constexpr int INVITE_HASH = HashingUtils::CompileTimeHashString("INVITE");
+        static constexpr int ENABLE_ALL_FEATURES_HASH = HashingUtils::CompileTimeHashString("ENABLE_ALL_FEATURES");
+        static constexpr int APPROVE_ALL_FEATURES_HASH = HashingUtils::CompileTimeHashString("APPROVE_ALL_FEATURES");
+        static constexpr int ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE_HASH = HashingUtils::CompileTimeHashString("ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE");
 
 
         ActionType GetActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVITE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActionType::INVITE;
-          }
-          else if (hashCode == ENABLE_ALL_FEATURES_HASH)
-          {
-            return ActionType::ENABLE_ALL_FEATURES;
-          }
-          else if (hashCode == APPROVE_ALL_FEATURES_HASH)
-          {
-            return ActionType::APPROVE_ALL_FEATURES;
-          }
-          else if (hashCode == ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE_HASH)
-          {
-            return ActionType::ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE;
+          case INVITE_HASH:
+            if (name == "INVITE")
+            {
+              return ActionType::INVITE;
+            }
+            break;
+          case ENABLE_ALL_FEATURES_HASH:
+            if (name == "ENABLE_ALL_FEATURES")
+            {
+              return ActionType::ENABLE_ALL_FEATURES;
+            }
+            break;
+          case APPROVE_ALL_FEATURES_HASH:
+            if (name == "APPROVE_ALL_FEATURES")
+            {
+              return ActionType::APPROVE_ALL_FEATURES;
+            }
+            break;
+          case ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE_HASH:
+            if (name == "ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE")
+            {
+              return ActionType::ADD_ORGANIZATIONS_SERVICE_LINKED_ROLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ActionType::NOT_SET;
         }
 
-        Aws::String GetNameForActionType(ActionType enumValue)
+        const char* GetNameForActionType(ActionType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ChildTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATIONAL_UNIT_HASH = HashingUtils::HashString("ORGANIZATIONAL_UNIT");
+        static constexpr int ACCOUNT_HASH = HashingUtils::CompileTimeHashString("ACCOUNT");
+        static constexpr int ORGANIZATIONAL_UNIT_HASH = HashingUtils::CompileTimeHashString("ORGANIZATIONAL_UNIT");
 
 
         ChildType GetChildTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChildType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATIONAL_UNIT_HASH)
-          {
-            return ChildType::ORGANIZATIONAL_UNIT;
+          case ACCOUNT_HASH:
+            if (name == "ACCOUNT")
+            {
+              return ChildType::ACCOUNT;
+            }
+            break;
+          case ORGANIZATIONAL_UNIT_HASH:
+            if (name == "ORGANIZATIONAL_UNIT")
+            {
+              return ChildType::ORGANIZATIONAL_UNIT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ChildType::NOT_SET;
         }
 
-        Aws::String GetNameForChildType(ChildType enumValue)
+        const char* GetNameForChildType(ChildType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
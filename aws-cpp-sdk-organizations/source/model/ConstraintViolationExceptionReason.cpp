@@ -30,90 +30,128 @@ namespace Aws
       namespace ConstraintViolationExceptionReasonMapper
       {
 
-        static const int ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ACCOUNT_NUMBER_LIMIT_EXCEEDED");
-        static const int HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("HANDSHAKE_RATE_LIMIT_EXCEEDED");
-        static const int OU_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OU_NUMBER_LIMIT_EXCEEDED");
-        static const int OU_DEPTH_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OU_DEPTH_LIMIT_EXCEEDED");
-        static const int POLICY_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("POLICY_NUMBER_LIMIT_EXCEEDED");
-        static const int MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED");
-        static const int MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED");
-        static const int ACCOUNT_CANNOT_LEAVE_ORGANIZATION_HASH = HashingUtils::HashString("ACCOUNT_CANNOT_LEAVE_ORGANIZATION");
-        static const int ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA_HASH = HashingUtils::HashString("ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA");
-        static const int ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION_HASH = HashingUtils::HashString("ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION");
-        static const int MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH = HashingUtils::HashString("MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED");
-        static const int MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH = HashingUtils::HashString("MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED");
-        static const int ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED");
-        static const int MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE_HASH = HashingUtils::HashString("MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE");
-        static const int MASTER_ACCOUNT_MISSING_CONTACT_INFO_HASH = HashingUtils::HashString("MASTER_ACCOUNT_MISSING_CONTACT_INFO");
-        static const int ORGANIZATION_NOT_IN_ALL_FEATURES_MODE_HASH = HashingUtils::HashString("ORGANIZATION_NOT_IN_ALL_FEATURES_MODE");
+        static constexpr int ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ACCOUNT_NUMBER_LIMIT_EXCEEDED");
+        static constexpr int HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("HANDSHAKE_RATE_LIMIT_EXCEEDED");
+        static constexpr int OU_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("OU_NUMBER_LIMIT_EXCEEDED");
+        static constexpr int OU_DEPTH_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("OU_DEPTH_LIMIT_EXCEEDED");
+        static constexpr int POLICY_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("POLICY_NUMBER_LIMIT_EXCEEDED");
+        static constexpr int MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED");
+        static constexpr int MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED");
+        static constexpr int ACCOUNT_CANNOT_LEAVE_ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("ACCOUNT_CANNOT_LEAVE_ORGANIZATION");
+        static constexpr int ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA_HASH = HashingUtils::CompileTimeHashString("ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA");
+        static constexpr int ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION_HASH = HashingUtils::CompileTimeHashString("ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION");
+        static constexpr int MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH = HashingUtils::CompileTimeHashString("MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED");
+        static constexpr int MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH = HashingUtils::CompileTimeHashString("MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED");
+        static constexpr int ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED");
+        static constexpr int MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE_HASH = HashingUtils::CompileTimeHashString("MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE");
+        static constexpr int MASTER_ACCOUNT_MISSING_CONTACT_INFO_HASH = HashingUtils::CompileTimeHashString("MASTER_ACCOUNT_MISSING_CONTACT_INFO");
+        static constexpr int ORGANIZATION_NOT_IN_ALL_FEATURES_MODE_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION_NOT_IN_ALL_FEATURES_MODE");
 
 
         ConstraintViolationExceptionReason GetConstraintViolationExceptionReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OU_NUMBER_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::OU_NUMBER_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OU_DEPTH_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::OU_DEPTH_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == POLICY_NUMBER_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::POLICY_NUMBER_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ACCOUNT_CANNOT_LEAVE_ORGANIZATION_HASH)
-          {
-            return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_ORGANIZATION;
-          }
-          else if (hashCode == ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA_HASH)
-          {
-            return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA;
-          }
-          else if (hashCode == ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION_HASH)
-          {
-            return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION;
-          }
-          else if (hashCode == MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH)
-          {
-            return ConstraintViolationExceptionReason::MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED;
-          }
-          else if (hashCode == MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH)
-          {
-            return ConstraintViolationExceptionReason::MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED;
-          }
-          else if (hashCode == ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED_HASH)
-          {
-            return ConstraintViolationExceptionReason::ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE_HASH)
-          {
-            return ConstraintViolationExceptionReason::MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE;
-          }
-          else if (hashCode == MASTER_ACCOUNT_MISSING_CONTACT_INFO_HASH)
-          {
-            return ConstraintViolationExceptionReason::MASTER_ACCOUNT_MISSING_CONTACT_INFO;
-          }
-          else if (hashCode == ORGANIZATION_NOT_IN_ALL_FEATURES_MODE_HASH)
-          {
-            return ConstraintViolationExceptionReason::ORGANIZATION_NOT_IN_ALL_FEATURES_MODE;
+          case ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH:
+            if (name == "ACCOUNT_NUMBER_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED;
+            }
+            break;
+          case HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH:
+            if (name == "HANDSHAKE_RATE_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED;
+            }
+            break;
+          case OU_NUMBER_LIMIT_EXCEEDED_HASH:
+            if (name == "OU_NUMBER_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::OU_NUMBER_LIMIT_EXCEEDED;
+            }
+            break;
+          case OU_DEPTH_LIMIT_EXCEEDED_HASH:
+            if (name == "OU_DEPTH_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::OU_DEPTH_LIMIT_EXCEEDED;
+            }
+            break;
+          case POLICY_NUMBER_LIMIT_EXCEEDED_HASH:
+            if (name == "POLICY_NUMBER_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::POLICY_NUMBER_LIMIT_EXCEEDED;
+            }
+            break;
+          case MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH:
+            if (name == "MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::MAX_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED;
+            }
+            break;
+          case MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED_HASH:
+            if (name == "MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::MIN_POLICY_TYPE_ATTACHMENT_LIMIT_EXCEEDED;
+            }
+            break;
+          case ACCOUNT_CANNOT_LEAVE_ORGANIZATION_HASH:
+            if (name == "ACCOUNT_CANNOT_LEAVE_ORGANIZATION")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_ORGANIZATION;
+            }
+            break;
+          case ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA_HASH:
+            if (name == "ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_EULA;
+            }
+            break;
+          case ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION_HASH:
+            if (name == "ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_CANNOT_LEAVE_WITHOUT_PHONE_VERIFICATION;
+            }
+            break;
+          case MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH:
+            if (name == "MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED")
+            {
+              return ConstraintViolationExceptionReason::MASTER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED;
+            }
+            break;
+          case MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED_HASH:
+            if (name == "MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED")
+            {
+              return ConstraintViolationExceptionReason::MEMBER_ACCOUNT_PAYMENT_INSTRUMENT_REQUIRED;
+            }
+            break;
+          case ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED_HASH:
+            if (name == "ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED")
+            {
+              return ConstraintViolationExceptionReason::ACCOUNT_CREATION_RATE_LIMIT_EXCEEDED;
+            }
+            break;
+          case MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE_HASH:
+            if (name == "MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE")
+            {
+              return ConstraintViolationExceptionReason::MASTER_ACCOUNT_ADDRESS_DOES_NOT_MATCH_MARKETPLACE;
+            }
+            break;
+          case MASTER_ACCOUNT_MISSING_CONTACT_INFO_HASH:
+            if (name == "MASTER_ACCOUNT_MISSING_CONTACT_INFO")
+            {
+              return ConstraintViolationExceptionReason::MASTER_ACCOUNT_MISSING_CONTACT_INFO;
+            }
+            break;
+          case ORGANIZATION_NOT_IN_ALL_FEATURES_MODE_HASH:
+            if (name == "ORGANIZATION_NOT_IN_ALL_FEATURES_MODE")
+            {
+              return ConstraintViolationExceptionReason::ORGANIZATION_NOT_IN_ALL_FEATURES_MODE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -125,7 +163,7 @@ namespace Aws
           return ConstraintViolationExceptionReason::NOT_SET;
         }
 
-        Aws::String GetNameForConstraintViolationExceptionReason(ConstraintViolationExceptionReason enumValue)
+        const char* GetNameForConstraintViolationExceptionReason(ConstraintViolationExceptionReason enumValue)
         {
           switch(enumValue)
           {
@@ -165,7 +203,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
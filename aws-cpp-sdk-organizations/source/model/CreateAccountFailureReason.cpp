@@ -30,40 +30,58 @@ namespace Aws
       namespace CreateAccountFailureReasonMapper
       {
 
-        static const int ACCOUNT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ACCOUNT_LIMIT_EXCEEDED");
-        static const int EMAIL_ALREADY_EXISTS_HASH = HashingUtils::HashString("EMAIL_ALREADY_EXISTS");
-        static const int INVALID_ADDRESS_HASH = HashingUtils::HashString("INVALID_ADDRESS");
-        static const int INVALID_EMAIL_HASH = HashingUtils::HashString("INVALID_EMAIL");
-        static const int CONCURRENT_ACCOUNT_MODIFICATION_HASH = HashingUtils::HashString("CONCURRENT_ACCOUNT_MODIFICATION");
-        static const int INTERNAL_FAILURE_HASH = HashingUtils::HashString("INTERNAL_FAILURE");
+        static constexpr int ACCOUNT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ACCOUNT_LIMIT_EXCEEDED");
+        static constexpr int EMAIL_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("EMAIL_ALREADY_EXISTS");
+        static constexpr int INVALID_ADDRESS_HASH = HashingUtils::CompileTimeHashString("INVALID_ADDRESS");
+        static constexpr int INVALID_EMAIL_HASH = HashingUtils::CompileTimeHashString("INVALID_EMAIL");
+        static constexpr int CONCURRENT_ACCOUNT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("CONCURRENT_ACCOUNT_MODIFICATION");
+        static constexpr int INTERNAL_FAILURE_HASH = HashingUtils::CompileTimeHashString("INTERNAL_FAILURE");
 
 
         CreateAccountFailureReason GetCreateAccountFailureReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_LIMIT_EXCEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CreateAccountFailureReason::ACCOUNT_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == EMAIL_ALREADY_EXISTS_HASH)
-          {
-            return CreateAccountFailureReason::EMAIL_ALREADY_EXISTS;
-          }
-          else if (hashCode == INVALID_ADDRESS_HASH)
-          {
-            return CreateAccountFailureReason::INVALID_ADDRESS;
-          }
-          else if (hashCode == INVALID_EMAIL_HASH)
-          {
-            return CreateAccountFailureReason::INVALID_EMAIL;
-          }
-          else if (hashCode == CONCURRENT_ACCOUNT_MODIFICATION_HASH)
-          {
-            return CreateAccountFailureReason::CONCURRENT_ACCOUNT_MODIFICATION;
-          }
-          else if (hashCode == INTERNAL_FAILURE_HASH)
-          {
-            return CreateAccountFailureReason::INTERNAL_FAILURE;
+          case ACCOUNT_LIMIT_EXCEEDED_HASH:
+            if (name == "ACCOUNT_LIMIT_EXCEEDED")
+            {
+              return CreateAccountFailureReason::ACCOUNT_LIMIT_EXCEEDED;
+            }
+            break;
+          case EMAIL_ALREADY_EXISTS_HASH:
+            if (name == "EMAIL_ALREADY_EXISTS")
+            {
+              return CreateAccountFailureReason::EMAIL_ALREADY_EXISTS;
+            }
+            break;
+          case INVALID_ADDRESS_HASH:
+            if (name == "INVALID_ADDRESS")
+            {
+              return CreateAccountFailureReason::INVALID_ADDRESS;
+            }
+            break;
+          case INVALID_EMAIL_HASH:
+            if (name == "INVALID_EMAIL")
+            {
+              return CreateAccountFailureReason::INVALID_EMAIL;
+            }
+            break;
+          case CONCURRENT_ACCOUNT_MODIFICATION_HASH:
+            if (name == "CONCURRENT_ACCOUNT_MODIFICATION")
+            {
+              return CreateAccountFailureReason::CONCURRENT_ACCOUNT_MODIFICATION;
+            }
+            break;
+          case INTERNAL_FAILURE_HASH:
+            if (name == "INTERNAL_FAILURE")
+            {
+              return CreateAccountFailureReason::INTERNAL_FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return CreateAccountFailureReason::NOT_SET;
         }
 
-        Aws::String GetNameForCreateAccountFailureReason(CreateAccountFailureReason enumValue)
+        const char* GetNameForCreateAccountFailureReason(CreateAccountFailureReason enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
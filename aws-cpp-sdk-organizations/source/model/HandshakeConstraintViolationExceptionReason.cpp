@@ -30,50 +30,72 @@ namespace Aws
       namespace HandshakeConstraintViolationExceptionReasonMapper
       {
 
-        static const int ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ACCOUNT_NUMBER_LIMIT_EXCEEDED");
-        static const int HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("HANDSHAKE_RATE_LIMIT_EXCEEDED");
-        static const int ALREADY_IN_AN_ORGANIZATION_HASH = HashingUtils::HashString("ALREADY_IN_AN_ORGANIZATION");
-        static const int ORGANIZATION_ALREADY_HAS_ALL_FEATURES_HASH = HashingUtils::HashString("ORGANIZATION_ALREADY_HAS_ALL_FEATURES");
-        static const int INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES_HASH = HashingUtils::HashString("INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES");
-        static const int PAYMENT_INSTRUMENT_REQUIRED_HASH = HashingUtils::HashString("PAYMENT_INSTRUMENT_REQUIRED");
-        static const int ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD_HASH = HashingUtils::HashString("ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD");
-        static const int ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED");
+        static constexpr int ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ACCOUNT_NUMBER_LIMIT_EXCEEDED");
+        static constexpr int HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("HANDSHAKE_RATE_LIMIT_EXCEEDED");
+        static constexpr int ALREADY_IN_AN_ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("ALREADY_IN_AN_ORGANIZATION");
+        static constexpr int ORGANIZATION_ALREADY_HAS_ALL_FEATURES_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION_ALREADY_HAS_ALL_FEATURES");
+        static constexpr int INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES_HASH = HashingUtils::CompileTimeHashString("INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES");
+        static constexpr int PAYMENT_INSTRUMENT_REQUIRED_HASH = HashingUtils::CompileTimeHashString("PAYMENT_INSTRUMENT_REQUIRED");
+        static constexpr int ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD");
+        static constexpr int ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED");
 
 
         HandshakeConstraintViolationExceptionReason GetHandshakeConstraintViolationExceptionReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HandshakeConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ALREADY_IN_AN_ORGANIZATION_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::ALREADY_IN_AN_ORGANIZATION;
-          }
-          else if (hashCode == ORGANIZATION_ALREADY_HAS_ALL_FEATURES_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::ORGANIZATION_ALREADY_HAS_ALL_FEATURES;
-          }
-          else if (hashCode == INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES;
-          }
-          else if (hashCode == PAYMENT_INSTRUMENT_REQUIRED_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::PAYMENT_INSTRUMENT_REQUIRED;
-          }
-          else if (hashCode == ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD;
-          }
-          else if (hashCode == ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED_HASH)
-          {
-            return HandshakeConstraintViolationExceptionReason::ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED;
+          case ACCOUNT_NUMBER_LIMIT_EXCEEDED_HASH:
+            if (name == "ACCOUNT_NUMBER_LIMIT_EXCEEDED")
+            {
+              return HandshakeConstraintViolationExceptionReason::ACCOUNT_NUMBER_LIMIT_EXCEEDED;
+            }
+            break;
+          case HANDSHAKE_RATE_LIMIT_EXCEEDED_HASH:
+            if (name == "HANDSHAKE_RATE_LIMIT_EXCEEDED")
+            {
+              return HandshakeConstraintViolationExceptionReason::HANDSHAKE_RATE_LIMIT_EXCEEDED;
+            }
+            break;
+          case ALREADY_IN_AN_ORGANIZATION_HASH:
+            if (name == "ALREADY_IN_AN_ORGANIZATION")
+            {
+              return HandshakeConstraintViolationExceptionReason::ALREADY_IN_AN_ORGANIZATION;
+            }
+            break;
+          case ORGANIZATION_ALREADY_HAS_ALL_FEATURES_HASH:
+            if (name == "ORGANIZATION_ALREADY_HAS_ALL_FEATURES")
+            {
+              return HandshakeConstraintViolationExceptionReason::ORGANIZATION_ALREADY_HAS_ALL_FEATURES;
+            }
+            break;
+          case INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES_HASH:
+            if (name == "INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES")
+            {
+              return HandshakeConstraintViolationExceptionReason::INVITE_DISABLED_DURING_ENABLE_ALL_FEATURES;
+            }
+            break;
+          case PAYMENT_INSTRUMENT_REQUIRED_HASH:
+            if (name == "PAYMENT_INSTRUMENT_REQUIRED")
+            {
+              return HandshakeConstraintViolationExceptionReason::PAYMENT_INSTRUMENT_REQUIRED;
+            }
+            break;
+          case ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD_HASH:
+            if (name == "ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD")
+            {
+              return HandshakeConstraintViolationExceptionReason::ORGANIZATION_FROM_DIFFERENT_SELLER_OF_RECORD;
+            }
+            break;
+          case ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED_HASH:
+            if (name == "ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED")
+            {
+              return HandshakeConstraintViolationExceptionReason::ORGANIZATION_MEMBERSHIP_CHANGE_RATE_LIMIT_EXCEEDED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return HandshakeConstraintViolationExceptionReason::NOT_SET;
         }
 
-        Aws::String GetNameForHandshakeConstraintViolationExceptionReason(HandshakeConstraintViolationExceptionReason enumValue)
+        const char* GetNameForHandshakeConstraintViolationExceptionReason(HandshakeConstraintViolationExceptionReason enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace HandshakePartyTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
+        static constexpr int ACCOUNT_HASH = HashingUtils::CompileTimeHashString("ACCOUNT");
+        static constexpr int ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION");
+        static constexpr int EMAIL_HASH = HashingUtils::CompileTimeHashString("EMAIL");
 
 
         HandshakePartyType GetHandshakePartyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HandshakePartyType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
-          {
-            return HandshakePartyType::ORGANIZATION;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
-            return HandshakePartyType::EMAIL;
+          case ACCOUNT_HASH:
+            if (name == "ACCOUNT")
+            {
+              return HandshakePartyType::ACCOUNT;
+            }
+            break;
+          case ORGANIZATION_HASH:
+            if (name == "ORGANIZATION")
+            {
+              return HandshakePartyType::ORGANIZATION;
+            }
+            break;
+          case EMAIL_HASH:
+            if (name == "EMAIL")
+            {
+              return HandshakePartyType::EMAIL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return HandshakePartyType::NOT_SET;
         }
 
-        Aws::String GetNameForHandshakePartyType(HandshakePartyType enumValue)
+        const char* GetNameForHandshakePartyType(HandshakePartyType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace HandshakeResourceTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
-        static const int ORGANIZATION_FEATURE_SET_HASH = HashingUtils::HashString("ORGANIZATION_FEATURE_SET");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-        static const int MASTER_EMAIL_HASH = HashingUtils::HashString("MASTER_EMAIL");
-        static const int MASTER_NAME_HASH = HashingUtils::HashString("MASTER_NAME");
-        static const int NOTES_HASH = HashingUtils::HashString("NOTES");
-        static const int PARENT_HANDSHAKE_HASH = HashingUtils::HashString("PARENT_HANDSHAKE");
+        static constexpr int ACCOUNT_HASH = HashingUtils::CompileTimeHashString("ACCOUNT");
+        static constexpr int ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION");
+        static constexpr int ORGANIZATION_FEATURE_SET_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION_FEATURE_SET");
+        static constexpr int EMAIL_HASH = HashingUtils::CompileTimeHashString("EMAIL");
+        static constexpr int MASTER_EMAIL_HASH = HashingUtils::CompileTimeHashString("MASTER_EMAIL");
+        static constexpr int MASTER_NAME_HASH = HashingUtils::CompileTimeHashString("MASTER_NAME");
+        static constexpr int NOTES_HASH = HashingUtils::CompileTimeHashString("NOTES");
+        static constexpr int PARENT_HANDSHAKE_HASH = HashingUtils::CompileTimeHashString("PARENT_HANDSHAKE");
 
 
         HandshakeResourceType GetHandshakeResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HandshakeResourceType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
-          {
-            return HandshakeResourceType::ORGANIZATION;
-          }
-          else if (hashCode == ORGANIZATION_FEATURE_SET_HASH)
-          {
-            return HandshakeResourceType::ORGANIZATION_FEATURE_SET;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
-            return HandshakeResourceType::EMAIL;
-          }
-          else if (hashCode == MASTER_EMAIL_HASH)
-          {
-            return HandshakeResourceType::MASTER_EMAIL;
-          }
-          else if (hashCode == MASTER_NAME_HASH)
-          {
-            return HandshakeResourceType::MASTER_NAME;
-          }
-          else if (hashCode == NOTES_HASH)
-          {
-            return HandshakeResourceType::NOTES;
-          }
-          else if (hashCode == PARENT_HANDSHAKE_HASH)
-          {
-            return HandshakeResourceType::PARENT_HANDSHAKE;
+          case ACCOUNT_HASH:
+            if (name == "ACCOUNT")
+            {
+              return HandshakeResourceType::ACCOUNT;
+            }
+            break;
+          case ORGANIZATION_HASH:
+            if (name == "ORGANIZATION")
+            {
+              return HandshakeResourceType::ORGANIZATION;
+            }
+            break;
+          case ORGANIZATION_FEATURE_SET_HASH:
+            if (name == "ORGANIZATION_FEATURE_SET")
+            {
+              return HandshakeResourceType::ORGANIZATION_FEATURE_SET;
+            }
+            break;
+          case EMAIL_HASH:
+            if (name == "EMAIL")
+            {
+              return HandshakeResourceType::EMAIL;
+            }
+            break;
+          case MASTER_EMAIL_HASH:
+            if (name == "MASTER_EMAIL")
+            {
+              return HandshakeResourceType::MASTER_EMAIL;
+            }
+            break;
+          case MASTER_NAME_HASH:
+            if (name == "MASTER_NAME")
+            {
+              return HandshakeResourceType::MASTER_NAME;
+            }
+            break;
+          case NOTES_HASH:
+            if (name == "NOTES")
+            {
+              return HandshakeResourceType::NOTES;
+            }
+            break;
+          case PARENT_HANDSHAKE_HASH:
+            if (name == "PARENT_HANDSHAKE")
+            {
+              return HandshakeResourceType::PARENT_HANDSHAKE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return HandshakeResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForHandshakeResourceType(HandshakeResourceType enumValue)
+        const char* GetNameForHandshakeResourceType(HandshakeResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
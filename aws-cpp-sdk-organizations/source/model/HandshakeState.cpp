@@ -30,40 +30,58 @@ namespace Aws
       namespace HandshakeStateMapper
       {
 
-        static const int REQUESTED_HASH = HashingUtils::HashString("REQUESTED");
-        static const int OPEN_HASH = HashingUtils::HashString("OPEN");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int ACCEPTED_HASH = HashingUtils::HashString("ACCEPTED");
-        static const int DECLINED_HASH = HashingUtils::HashString("DECLINED");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
+        static constexpr int REQUESTED_HASH = HashingUtils::CompileTimeHashString("REQUESTED");
+        static constexpr int OPEN_HASH = HashingUtils::CompileTimeHashString("OPEN");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
+        static constexpr int ACCEPTED_HASH = HashingUtils::CompileTimeHashString("ACCEPTED");
+        static constexpr int DECLINED_HASH = HashingUtils::CompileTimeHashString("DECLINED");
+        static constexpr int EXPIRED_HASH = HashingUtils::CompileTimeHashString("EXPIRED");
 
 
         HandshakeState GetHandshakeStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REQUESTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HandshakeState::REQUESTED;
-          }
-          else if (hashCode == OPEN_HASH)
-          {
-            return HandshakeState::OPEN;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return HandshakeState::CANCELED;
-          }
-          else if (hashCode == ACCEPTED_HASH)
-          {
-            return HandshakeState::ACCEPTED;
-          }
-          else if (hashCode == DECLINED_HASH)
-          {
-            return HandshakeState::DECLINED;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return HandshakeState::EXPIRED;
+          case REQUESTED_HASH:
+            if (name == "REQUESTED")
+            {
+              return HandshakeState::REQUESTED;
+            }
+            break;
+          case OPEN_HASH:
+            if (name == "OPEN")
+            {
+              return HandshakeState::OPEN;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return HandshakeState::CANCELED;
+            }
+            break;
+          case ACCEPTED_HASH:
+            if (name == "ACCEPTED")
+            {
+              return HandshakeState::ACCEPTED;
+            }
+            break;
+          case DECLINED_HASH:
+            if (name == "DECLINED")
+            {
+              return HandshakeState::DECLINED;
+            }
+            break;
+          case EXPIRED_HASH:
+            if (name == "EXPIRED")
+            {
+              return HandshakeState::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return HandshakeState::NOT_SET;
         }
 
-        Aws::String GetNameForHandshakeState(HandshakeState enumValue)
+        const char* GetNameForHandshakeState(HandshakeState enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
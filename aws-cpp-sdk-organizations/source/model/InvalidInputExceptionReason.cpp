@@ -30,105 +30,149 @@ namespace Aws
       namespace InvalidInputExceptionReasonMapper
       {
 
-        static const int INVALID_PARTY_TYPE_TARGET_HASH = HashingUtils::HashString("INVALID_PARTY_TYPE_TARGET");
-        static const int INVALID_SYNTAX_ORGANIZATION_ARN_HASH = HashingUtils::HashString("INVALID_SYNTAX_ORGANIZATION_ARN");
-        static const int INVALID_SYNTAX_POLICY_ID_HASH = HashingUtils::HashString("INVALID_SYNTAX_POLICY_ID");
-        static const int INVALID_ENUM_HASH = HashingUtils::HashString("INVALID_ENUM");
-        static const int INVALID_LIST_MEMBER_HASH = HashingUtils::HashString("INVALID_LIST_MEMBER");
-        static const int MAX_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("MAX_LENGTH_EXCEEDED");
-        static const int MAX_VALUE_EXCEEDED_HASH = HashingUtils::HashString("MAX_VALUE_EXCEEDED");
-        static const int MIN_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("MIN_LENGTH_EXCEEDED");
-        static const int MIN_VALUE_EXCEEDED_HASH = HashingUtils::HashString("MIN_VALUE_EXCEEDED");
-        static const int IMMUTABLE_POLICY_HASH = HashingUtils::HashString("IMMUTABLE_POLICY");
-        static const int INVALID_PATTERN_HASH = HashingUtils::HashString("INVALID_PATTERN");
-        static const int INVALID_PATTERN_TARGET_ID_HASH = HashingUtils::HashString("INVALID_PATTERN_TARGET_ID");
-        static const int INPUT_REQUIRED_HASH = HashingUtils::HashString("INPUT_REQUIRED");
-        static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("INVALID_NEXT_TOKEN");
-        static const int MAX_LIMIT_EXCEEDED_FILTER_HASH = HashingUtils::HashString("MAX_LIMIT_EXCEEDED_FILTER");
-        static const int MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS_HASH = HashingUtils::HashString("MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS");
-        static const int INVALID_FULL_NAME_TARGET_HASH = HashingUtils::HashString("INVALID_FULL_NAME_TARGET");
-        static const int UNRECOGNIZED_SERVICE_PRINCIPAL_HASH = HashingUtils::HashString("UNRECOGNIZED_SERVICE_PRINCIPAL");
-        static const int INVALID_ROLE_NAME_HASH = HashingUtils::HashString("INVALID_ROLE_NAME");
+        static constexpr int INVALID_PARTY_TYPE_TARGET_HASH = HashingUtils::CompileTimeHashString("INVALID_PARTY_TYPE_TARGET");
+        static constexpr int INVALID_SYNTAX_ORGANIZATION_ARN_HASH = HashingUtils::CompileTimeHashString("INVALID_SYNTAX_ORGANIZATION_ARN");
+        static constexpr int INVALID_SYNTAX_POLICY_ID_HASH = HashingUtils::CompileTimeHashString("INVALID_SYNTAX_POLICY_ID");
+        static constexpr int INVALID_ENUM_HASH = HashingUtils::CompileTimeHashString("INVALID_ENUM");
+        static constexpr int INVALID_LIST_MEMBER_HASH = HashingUtils::CompileTimeHashString("INVALID_LIST_MEMBER");
+        static constexpr int MAX_LENGTH_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MAX_LENGTH_EXCEEDED");
+        static constexpr int MAX_VALUE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MAX_VALUE_EXCEEDED");
+        static constexpr int MIN_LENGTH_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MIN_LENGTH_EXCEEDED");
+        static constexpr int MIN_VALUE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MIN_VALUE_EXCEEDED");
+        static constexpr int IMMUTABLE_POLICY_HASH = HashingUtils::CompileTimeHashString("IMMUTABLE_POLICY");
+        static constexpr int INVALID_PATTERN_HASH = HashingUtils::CompileTimeHashString("INVALID_PATTERN");
+        static constexpr int INVALID_PATTERN_TARGET_ID_HASH = HashingUtils::CompileTimeHashString("INVALID_PATTERN_TARGET_ID");
+        static constexpr int INPUT_REQUIRED_HASH = HashingUtils::CompileTimeHashString("INPUT_REQUIRED");
+        static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("INVALID_NEXT_TOKEN");
+        static constexpr int MAX_LIMIT_EXCEEDED_FILTER_HASH = HashingUtils::CompileTimeHashString("MAX_LIMIT_EXCEEDED_FILTER");
+        static constexpr int MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS_HASH = HashingUtils::CompileTimeHashString("MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS");
+        static constexpr int INVALID_FULL_NAME_TARGET_HASH = HashingUtils::CompileTimeHashString("INVALID_FULL_NAME_TARGET");
+        static constexpr int UNRECOGNIZED_SERVICE_PRINCIPAL_HASH = HashingUtils::CompileTimeHashString("UNRECOGNIZED_SERVICE_PRINCIPAL");
+        static constexpr int INVALID_ROLE_NAME_HASH = HashingUtils::CompileTimeHashString("INVALID_ROLE_NAME");
 
 
         InvalidInputExceptionReason GetInvalidInputExceptionReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_PARTY_TYPE_TARGET_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InvalidInputExceptionReason::INVALID_PARTY_TYPE_TARGET;
-          }
-          else if (hashCode == INVALID_SYNTAX_ORGANIZATION_ARN_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_SYNTAX_ORGANIZATION_ARN;
-          }
-          else if (hashCode == INVALID_SYNTAX_POLICY_ID_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_SYNTAX_POLICY_ID;
-          }
-          else if (hashCode == INVALID_ENUM_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_ENUM;
-          }
-          else if (hashCode == INVALID_LIST_MEMBER_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_LIST_MEMBER;
-          }
-          else if (hashCode == MAX_LENGTH_EXCEEDED_HASH)
-          {
-            return InvalidInputExceptionReason::MAX_LENGTH_EXCEEDED;
-          }
-          else if (hashCode == MAX_VALUE_EXCEEDED_HASH)
-          {
-            return InvalidInputExceptionReason::MAX_VALUE_EXCEEDED;
-          }
-          else if (hashCode == MIN_LENGTH_EXCEEDED_HASH)
-          {
-            return InvalidInputExceptionReason::MIN_LENGTH_EXCEEDED;
-          }
-          else if (hashCode == MIN_VALUE_EXCEEDED_HASH)
-          {
-            return InvalidInputExceptionReason::MIN_VALUE_EXCEEDED;
-          }
-          else if (hashCode == IMMUTABLE_POLICY_HASH)
-          {
-            return InvalidInputExceptionReason::IMMUTABLE_POLICY;
-          }
-          else if (hashCode == INVALID_PATTERN_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_PATTERN;
-          }
-          else if (hashCode == INVALID_PATTERN_TARGET_ID_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_PATTERN_TARGET_ID;
-          }
-          else if (hashCode == INPUT_REQUIRED_HASH)
-          {
-            return InvalidInputExceptionReason::INPUT_REQUIRED;
-          }
-          else if (hashCode == INVALID_NEXT_TOKEN_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_NEXT_TOKEN;
-          }
-          else if (hashCode == MAX_LIMIT_EXCEEDED_FILTER_HASH)
-          {
-            return InvalidInputExceptionReason::MAX_LIMIT_EXCEEDED_FILTER;
-          }
-          else if (hashCode == MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS_HASH)
-          {
-            return InvalidInputExceptionReason::MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS;
-          }
-          else if (hashCode == INVALID_FULL_NAME_TARGET_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_FULL_NAME_TARGET;
-          }
-          else if (hashCode == UNRECOGNIZED_SERVICE_PRINCIPAL_HASH)
-          {
-            return InvalidInputExceptionReason::UNRECOGNIZED_SERVICE_PRINCIPAL;
-          }
-          else if (hashCode == INVALID_ROLE_NAME_HASH)
-          {
-            return InvalidInputExceptionReason::INVALID_ROLE_NAME;
+          case INVALID_PARTY_TYPE_TARGET_HASH:
+            if (name == "INVALID_PARTY_TYPE_TARGET")
+            {
+              return InvalidInputExceptionReason::INVALID_PARTY_TYPE_TARGET;
+            }
+            break;
+          case INVALID_SYNTAX_ORGANIZATION_ARN_HASH:
+            if (name == "INVALID_SYNTAX_ORGANIZATION_ARN")
+            {
+              return InvalidInputExceptionReason::INVALID_SYNTAX_ORGANIZATION_ARN;
+            }
+            break;
+          case INVALID_SYNTAX_POLICY_ID_HASH:
+            if (name == "INVALID_SYNTAX_POLICY_ID")
+            {
+              return InvalidInputExceptionReason::INVALID_SYNTAX_POLICY_ID;
+            }
+            break;
+          case INVALID_ENUM_HASH:
+            if (name == "INVALID_ENUM")
+            {
+              return InvalidInputExceptionReason::INVALID_ENUM;
+            }
+            break;
+          case INVALID_LIST_MEMBER_HASH:
+            if (name == "INVALID_LIST_MEMBER")
+            {
+              return InvalidInputExceptionReason::INVALID_LIST_MEMBER;
+            }
+            break;
+          case MAX_LENGTH_EXCEEDED_HASH:
+            if (name == "MAX_LENGTH_EXCEEDED")
+            {
+              return InvalidInputExceptionReason::MAX_LENGTH_EXCEEDED;
+            }
+            break;
+          case MAX_VALUE_EXCEEDED_HASH:
+            if (name == "MAX_VALUE_EXCEEDED")
+            {
+              return InvalidInputExceptionReason::MAX_VALUE_EXCEEDED;
+            }
+            break;
+          case MIN_LENGTH_EXCEEDED_HASH:
+            if (name == "MIN_LENGTH_EXCEEDED")
+            {
+              return InvalidInputExceptionReason::MIN_LENGTH_EXCEEDED;
+            }
+            break;
+          case MIN_VALUE_EXCEEDED_HASH:
+            if (name == "MIN_VALUE_EXCEEDED")
+            {
+              return InvalidInputExceptionReason::MIN_VALUE_EXCEEDED;
+            }
+            break;
+          case IMMUTABLE_POLICY_HASH:
+            if (name == "IMMUTABLE_POLICY")
+            {
+              return InvalidInputExceptionReason::IMMUTABLE_POLICY;
+            }
+            break;
+          case INVALID_PATTERN_HASH:
+            if (name == "INVALID_PATTERN")
+            {
+              return InvalidInputExceptionReason::INVALID_PATTERN;
+            }
+            break;
+          case INVALID_PATTERN_TARGET_ID_HASH:
+            if (name == "INVALID_PATTERN_TARGET_ID")
+            {
+              return InvalidInputExceptionReason::INVALID_PATTERN_TARGET_ID;
+            }
+            break;
+          case INPUT_REQUIRED_HASH:
+            if (name == "INPUT_REQUIRED")
+            {
+              return InvalidInputExceptionReason::INPUT_REQUIRED;
+            }
+            break;
+          case INVALID_NEXT_TOKEN_HASH:
+            if (name == "INVALID_NEXT_TOKEN")
+            {
+              return InvalidInputExceptionReason::INVALID_NEXT_TOKEN;
+            }
+            break;
+          case MAX_LIMIT_EXCEEDED_FILTER_HASH:
+            if (name == "MAX_LIMIT_EXCEEDED_FILTER")
+            {
+              return InvalidInputExceptionReason::MAX_LIMIT_EXCEEDED_FILTER;
+            }
+            break;
+          case MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS_HASH:
+            if (name == "MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS")
+            {
+              return InvalidInputExceptionReason::MOVING_ACCOUNT_BETWEEN_DIFFERENT_ROOTS;
+            }
+            break;
+          case INVALID_FULL_NAME_TARGET_HASH:
+            if (name == "INVALID_FULL_NAME_TARGET")
+            {
+              return InvalidInputExceptionReason::INVALID_FULL_NAME_TARGET;
+            }
+            break;
+          case UNRECOGNIZED_SERVICE_PRINCIPAL_HASH:
+            if (name == "UNRECOGNIZED_SERVICE_PRINCIPAL")
+            {
+              return InvalidInputExceptionReason::UNRECOGNIZED_SERVICE_PRINCIPAL;
+            }
+            break;
+          case INVALID_ROLE_NAME_HASH:
+            if (name == "INVALID_ROLE_NAME")
+            {
+              return InvalidInputExceptionReason::INVALID_ROLE_NAME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -140,7 +184,7 @@ namespace Aws
           return InvalidInputExceptionReason::NOT_SET;
         }
 
-        Aws::String GetNameForInvalidInputExceptionReason(InvalidInputExceptionReason enumValue)
+        const char* GetNameForInvalidInputExceptionReason(InvalidInputExceptionReason enumValue)
         {
           switch(enumValue)
           {
@@ -186,7 +230,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
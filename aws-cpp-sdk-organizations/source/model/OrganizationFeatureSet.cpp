@@ -30,20 +30,30 @@ namespace Aws
       namespace OrganizationFeatureSetMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int CONSOLIDATED_BILLING_HASH = HashingUtils::HashString("CONSOLIDATED_BILLING");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
+        static constexpr int CONSOLIDATED_BILLING_HASH = HashingUtils::CompileTimeHashString("CONSOLIDATED_BILLING");
 
 
         OrganizationFeatureSet GetOrganizationFeatureSetForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OrganizationFeatureSet::ALL;
-          }
-          else if (hashCode == CONSOLIDATED_BILLING_HASH)
-          {
-            return OrganizationFeatureSet::CONSOLIDATED_BILLING;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return OrganizationFeatureSet::ALL;
+            }
+            break;
+          case CONSOLIDATED_BILLING_HASH:
+            if (name == "CONSOLIDATED_BILLING")
+            {
+              return OrganizationFeatureSet::CONSOLIDATED_BILLING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OrganizationFeatureSet::NOT_SET;
         }
 
-        Aws::String GetNameForOrganizationFeatureSet(OrganizationFeatureSet enumValue)
+        const char* GetNameForOrganizationFeatureSet(OrganizationFeatureSet enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
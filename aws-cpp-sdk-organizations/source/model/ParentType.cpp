@@ -30,20 +30,30 @@ namespace Aws
       namespace ParentTypeMapper
       {
 
-        static const int ROOT_HASH = HashingUtils::HashString("ROOT");
-        static const int ORGANIZATIONAL_UNIT_HASH = HashingUtils::HashString("ORGANIZATIONAL_UNIT");
+        static constexpr int ROOT_HASH = HashingUtils::CompileTimeHashString("ROOT");
+        static constexpr int ORGANIZATIONAL_UNIT_HASH = HashingUtils::CompileTimeHashString("ORGANIZATIONAL_UNIT");
 
 
         ParentType GetParentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ROOT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ParentType::ROOT;
-          }
-          else if (hashCode == ORGANIZATIONAL_UNIT_HASH)
-          {
-            return ParentType::ORGANIZATIONAL_UNIT;
+          case ROOT_HASH:
+            if (name == "ROOT")
+            {
+              return ParentType::ROOT;
+            }
+            break;
+          case ORGANIZATIONAL_UNIT_HASH:
+            if (name == "ORGANIZATIONAL_UNIT")
+            {
+              return ParentType::ORGANIZATIONAL_UNIT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ParentType::NOT_SET;
         }
 
-        Aws::String GetNameForParentType(ParentType enumValue)
+        const char* GetNameForParentType(ParentType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace PolicyTypeStatusMapper
       {
 
-        static const int ENABLED_HASH = HashingUtils::HashString("ENABLED");
-        static const int PENDING_ENABLE_HASH = HashingUtils::HashString("PENDING_ENABLE");
-        static const int PENDING_DISABLE_HASH = HashingUtils::HashString("PENDING_DISABLE");
+        static constexpr int ENABLED_HASH = HashingUtils::CompileTimeHashString("ENABLED");
+        static constexpr int PENDING_ENABLE_HASH = HashingUtils::CompileTimeHashString("PENDING_ENABLE");
+        static constexpr int PENDING_DISABLE_HASH = HashingUtils::CompileTimeHashString("PENDING_DISABLE");
 
 
         PolicyTypeStatus GetPolicyTypeStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ENABLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PolicyTypeStatus::ENABLED;
-          }
-          else if (hashCode == PENDING_ENABLE_HASH)
-          {
-            return PolicyTypeStatus::PENDING_ENABLE;
-          }
-          else if (hashCode == PENDING_DISABLE_HASH)
-          {
-            return PolicyTypeStatus::PENDING_DISABLE;
+          case ENABLED_HASH:
+            if (name == "ENABLED")
+            {
+              return PolicyTypeStatus::ENABLED;
+            }
+            break;
+          case PENDING_ENABLE_HASH:
+            if (name == "PENDING_ENABLE")
+            {
+              return PolicyTypeStatus::PENDING_ENABLE;
+            }
+            break;
+          case PENDING_DISABLE_HASH:
+            if (name == "PENDING_DISABLE")
+            {
+              return PolicyTypeStatus::PENDING_DISABLE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PolicyTypeStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPolicyTypeStatus(PolicyTypeStatus enumValue)
+        const char* GetNameForPolicyTypeStatus(PolicyTypeStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
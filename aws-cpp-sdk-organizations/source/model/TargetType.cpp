@@ -30,25 +30,37 @@ namespace Aws
       namespace TargetTypeMapper
       {
 
-        static const int ACCOUNT_HASH = HashingUtils::HashString("ACCOUNT");
-        static const int ORGANIZATIONAL_UNIT_HASH = HashingUtils::HashString("ORGANIZATIONAL_UNIT");
-        static const int ROOT_HASH = HashingUtils::HashString("ROOT");
+        static constexpr int ACCOUNT_HASH = HashingUtils::CompileTimeHashString("ACCOUNT");
+        static constexpr int ORGANIZATIONAL_UNIT_HASH = HashingUtils::CompileTimeHashString("ORGANIZATIONAL_UNIT");
+        static constexpr int ROOT_HASH = HashingUtils::CompileTimeHashString("ROOT");
 
 
         TargetType GetTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACCOUNT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TargetType::ACCOUNT;
-          }
-          else if (hashCode == ORGANIZATIONAL_UNIT_HASH)
-          {
-            return TargetType::ORGANIZATIONAL_UNIT;
-          }
-          else if (hashCode == ROOT_HASH)
-          {
-            return TargetType::ROOT;
+          case ACCOUNT_HASH:
+            if (name == "ACCOUNT")
+            {
+              return TargetType::ACCOUNT;
+            }
+            break;
+          case ORGANIZATIONAL_UNIT_HASH:
+            if (name == "ORGANIZATIONAL_UNIT")
+            {
+              return TargetType::ORGANIZATIONAL_UNIT;
+            }
+            break;
+          case ROOT_HASH:
+            if (name == "ROOT")
+            {
+              return TargetType::ROOT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TargetType::NOT_SET;
         }
 
-        Aws::String GetNameForTargetType(TargetType enumValue)
+        const char* GetNameForTargetType(TargetType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
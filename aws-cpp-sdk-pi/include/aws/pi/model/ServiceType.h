@@ -33,7 +33,8 @@ namespace ServiceTypeMapper
 {
 AWS_PI_API ServiceType GetServiceTypeForName(const Aws::String& name);
 
-AWS_PI_API Aws::String GetNameForServiceType(ServiceType value);
+// names of values not modeled point into the enum overflow container
+AWS_PI_API const char* GetNameForServiceType(ServiceType value);
 } // namespace ServiceTypeMapper
 } // namespace Model
 } // namespace PI
@@ -30,15 +30,23 @@ namespace Aws
       namespace ServiceTypeMapper
       {
 
-        static const int RDS_HASH = HashingUtils::HashString("RDS");
+        static constexpr int RDS_HASH = HashingUtils::CompileTimeHashString("RDS");
 
 
         ServiceType GetServiceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RDS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServiceType::RDS;
+          case RDS_HASH:
+            if (name == "RDS")
+            {
+              return ServiceType::RDS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ServiceType::NOT_SET;
         }
 
-        Aws::String GetNameForServiceType(ServiceType enumValue)
+        const char* GetNameForServiceType(ServiceType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
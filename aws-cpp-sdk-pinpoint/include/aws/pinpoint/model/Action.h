@@ -35,7 +35,8 @@ namespace ActionMapper
 {
 AWS_PINPOINT_API Action GetActionForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForAction(Action value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForAction(Action value);
 } // namespace ActionMapper
 } // namespace Model
 } // namespace Pinpoint
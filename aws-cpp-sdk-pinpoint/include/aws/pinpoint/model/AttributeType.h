@@ -34,7 +34,8 @@ namespace AttributeTypeMapper
 {
 AWS_PINPOINT_API AttributeType GetAttributeTypeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForAttributeType(AttributeType value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForAttributeType(AttributeType value);
 } // namespace AttributeTypeMapper
 } // namespace Model
 } // namespace Pinpoint
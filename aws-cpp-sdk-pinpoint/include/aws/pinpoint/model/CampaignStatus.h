@@ -38,7 +38,8 @@ namespace CampaignStatusMapper
 {
 AWS_PINPOINT_API CampaignStatus GetCampaignStatusForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForCampaignStatus(CampaignStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForCampaignStatus(CampaignStatus value);
 } // namespace CampaignStatusMapper
 } // namespace Model
 } // namespace Pinpoint
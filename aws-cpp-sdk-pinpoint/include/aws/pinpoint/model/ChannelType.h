@@ -42,7 +42,8 @@ namespace ChannelTypeMapper
 {
 AWS_PINPOINT_API ChannelType GetChannelTypeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForChannelType(ChannelType value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForChannelType(ChannelType value);
 } // namespace ChannelTypeMapper
 } // namespace Model
 } // namespace Pinpoint
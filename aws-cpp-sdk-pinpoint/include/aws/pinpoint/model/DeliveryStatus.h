@@ -39,7 +39,8 @@ namespace DeliveryStatusMapper
 {
 AWS_PINPOINT_API DeliveryStatus GetDeliveryStatusForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForDeliveryStatus(DeliveryStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForDeliveryStatus(DeliveryStatus value);
 } // namespace DeliveryStatusMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -34,7 +34,8 @@ namespace DimensionTypeMapper
 {
 AWS_PINPOINT_API DimensionType GetDimensionTypeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForDimensionType(DimensionType value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForDimensionType(DimensionType value);
 } // namespace DimensionTypeMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -36,7 +36,8 @@ namespace DurationMapper
 {
 AWS_PINPOINT_API Duration GetDurationForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForDuration(Duration value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForDuration(Duration value);
 } // namespace DurationMapper
 } // namespace Model
 } // namespace Pinpoint
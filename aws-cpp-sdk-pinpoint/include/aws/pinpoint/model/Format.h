@@ -34,7 +34,8 @@ namespace FormatMapper
 {
 AWS_PINPOINT_API Format GetFormatForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForFormat(Format value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForFormat(Format value);
 } // namespace FormatMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -37,7 +37,8 @@ namespace FrequencyMapper
 {
 AWS_PINPOINT_API Frequency GetFrequencyForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForFrequency(Frequency value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForFrequency(Frequency value);
 } // namespace FrequencyMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -35,7 +35,8 @@ namespace IncludeMapper
 {
 AWS_PINPOINT_API Include GetIncludeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForInclude(Include value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForInclude(Include value);
 } // namespace IncludeMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -34,7 +34,8 @@ namespace MessageTypeMapper
 {
 AWS_PINPOINT_API MessageType GetMessageTypeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForMessageType(MessageType value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForMessageType(MessageType value);
 } // namespace MessageTypeMapper
 } // namespace Model
 } // namespace Pinpoint
@@ -34,7 +34,8 @@ namespace ModeMapper
 {
 AWS_PINPOINT_API Mode GetModeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForMode(Mode value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForMode(Mode value);
 } // namespace ModeMapper
 } // namespace Model
 } // namespace Pinpoint
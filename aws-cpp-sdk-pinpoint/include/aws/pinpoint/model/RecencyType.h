@@ -34,7 +34,8 @@ namespace RecencyTypeMapper
 {
 AWS_PINPOINT_API RecencyType GetRecencyTypeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForRecencyType(RecencyType value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForRecencyType(RecencyType value);
 } // namespace RecencyTypeMapper
 } // namespace Model
 } // namespace Pinpoint
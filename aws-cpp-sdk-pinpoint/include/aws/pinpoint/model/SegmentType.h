@@ -34,7 +34,8 @@ namespace SegmentTypeMapper
 {
 AWS_PINPOINT_API SegmentType GetSegmentTypeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForSegmentType(SegmentType value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForSegmentType(SegmentType value);
 } // namespace SegmentTypeMapper
 } // namespace Model
 } // namespace Pinpoint
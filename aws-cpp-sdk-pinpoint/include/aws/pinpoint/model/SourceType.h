@@ -35,7 +35,8 @@ namespace SourceTypeMapper
 {
 AWS_PINPOINT_API SourceType GetSourceTypeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForSourceType(SourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForSourceType(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace Pinpoint
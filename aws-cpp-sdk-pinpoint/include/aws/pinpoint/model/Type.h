@@ -35,7 +35,8 @@ namespace TypeMapper
 {
 AWS_PINPOINT_API Type GetTypeForName(const Aws::String& name);
 
-AWS_PINPOINT_API Aws::String GetNameForType(Type value);
+// names of values not modeled point into the enum overflow container
+AWS_PINPOINT_API const char* GetNameForType(Type value);
 } // namespace TypeMapper
 } // namespace Model
 } // namespace Pinpoint
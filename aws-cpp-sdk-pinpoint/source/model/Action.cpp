@@ -30,25 +30,37 @@ namespace Aws
       namespace ActionMapper
       {
 
-        static const int OPEN_APP_HASH = HashingUtils::HashString("OPEN_APP");
-        static const int DEEP_LINK_HASH = HashingUtils::HashString("DEEP_LINK");
-        static const int URL_HASH = HashingUtils::HashString("URL");
+        static constexpr int OPEN_APP_HASH = HashingUtils::CompileTimeHashString("OPEN_APP");
+        static constexpr int DEEP_LINK_HASH = HashingUtils::CompileTimeHashString("DEEP_LINK");
+        static constexpr int URL_HASH = HashingUtils::CompileTimeHashString("URL");
 
 
         Action GetActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OPEN_APP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Action::OPEN_APP;
-          }
-          else if (hashCode == DEEP_LINK_HASH)
-          {
-            return Action::DEEP_LINK;
-          }
-          else if (hashCode == URL_HASH)
-          {
-            return Action::URL;
+          case OPEN_APP_HASH:
+            if (name == "OPEN_APP")
+            {
+              return Action::OPEN_APP;
+            }
+            break;
+          case DEEP_LINK_HASH:
+            if (name == "DEEP_LINK")
+            {
+              return Action::DEEP_LINK;
+            }
+            break;
+          case URL_HASH:
+            if (name == "URL")
+            {
+              return Action::URL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Action::NOT_SET;
         }
 
-        Aws::String GetNameForAction(Action enumValue)
+        const char* GetNameForAction(Action enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
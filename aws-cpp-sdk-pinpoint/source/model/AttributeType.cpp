@@ -30,20 +30,30 @@ namespace Aws
       namespace AttributeTypeMapper
       {
 
-        static const int INCLUSIVE_HASH = HashingUtils::HashString("INCLUSIVE");
-        static const int EXCLUSIVE_HASH = HashingUtils::HashString("EXCLUSIVE");
+        static constexpr int INCLUSIVE_HASH = HashingUtils::CompileTimeHashString("INCLUSIVE");
+        static constexpr int EXCLUSIVE_HASH = HashingUtils::CompileTimeHashString("EXCLUSIVE");
 
 
         AttributeType GetAttributeTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INCLUSIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AttributeType::INCLUSIVE;
-          }
-          else if (hashCode == EXCLUSIVE_HASH)
-          {
-            return AttributeType::EXCLUSIVE;
+          case INCLUSIVE_HASH:
+            if (name == "INCLUSIVE")
+            {
+              return AttributeType::INCLUSIVE;
+            }
+            break;
+          case EXCLUSIVE_HASH:
+            if (name == "EXCLUSIVE")
+            {
+              return AttributeType::EXCLUSIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AttributeType::NOT_SET;
         }
 
-        Aws::String GetNameForAttributeType(AttributeType enumValue)
+        const char* GetNameForAttributeType(AttributeType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
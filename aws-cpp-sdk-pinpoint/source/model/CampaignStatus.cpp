@@ -30,40 +30,58 @@ namespace Aws
       namespace CampaignStatusMapper
       {
 
-        static const int SCHEDULED_HASH = HashingUtils::HashString("SCHEDULED");
-        static const int EXECUTING_HASH = HashingUtils::HashString("EXECUTING");
-        static const int PENDING_NEXT_RUN_HASH = HashingUtils::HashString("PENDING_NEXT_RUN");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int PAUSED_HASH = HashingUtils::HashString("PAUSED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int SCHEDULED_HASH = HashingUtils::CompileTimeHashString("SCHEDULED");
+        static constexpr int EXECUTING_HASH = HashingUtils::CompileTimeHashString("EXECUTING");
+        static constexpr int PENDING_NEXT_RUN_HASH = HashingUtils::CompileTimeHashString("PENDING_NEXT_RUN");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int PAUSED_HASH = HashingUtils::CompileTimeHashString("PAUSED");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         CampaignStatus GetCampaignStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SCHEDULED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CampaignStatus::SCHEDULED;
-          }
-          else if (hashCode == EXECUTING_HASH)
-          {
-            return CampaignStatus::EXECUTING;
-          }
-          else if (hashCode == PENDING_NEXT_RUN_HASH)
-          {
-            return CampaignStatus::PENDING_NEXT_RUN;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return CampaignStatus::COMPLETED;
-          }
-          else if (hashCode == PAUSED_HASH)
-          {
-            return CampaignStatus::PAUSED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return CampaignStatus::DELETED;
+          case SCHEDULED_HASH:
+            if (name == "SCHEDULED")
+            {
+              return CampaignStatus::SCHEDULED;
+            }
+            break;
+          case EXECUTING_HASH:
+            if (name == "EXECUTING")
+            {
+              return CampaignStatus::EXECUTING;
+            }
+            break;
+          case PENDING_NEXT_RUN_HASH:
+            if (name == "PENDING_NEXT_RUN")
+            {
+              return CampaignStatus::PENDING_NEXT_RUN;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return CampaignStatus::COMPLETED;
+            }
+            break;
+          case PAUSED_HASH:
+            if (name == "PAUSED")
+            {
+              return CampaignStatus::PAUSED;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return CampaignStatus::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return CampaignStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCampaignStatus(CampaignStatus enumValue)
+        const char* GetNameForCampaignStatus(CampaignStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,60 +30,86 @@ namespace Aws
       namespace ChannelTypeMapper
       {
 
-        static const int GCM_HASH = HashingUtils::HashString("GCM");
-        static const int APNS_HASH = HashingUtils::HashString("APNS");
-        static const int APNS_SANDBOX_HASH = HashingUtils::HashString("APNS_SANDBOX");
-        static const int APNS_VOIP_HASH = HashingUtils::HashString("APNS_VOIP");
-        static const int APNS_VOIP_SANDBOX_HASH = HashingUtils::HashString("APNS_VOIP_SANDBOX");
-        static const int ADM_HASH = HashingUtils::HashString("ADM");
-        static const int SMS_HASH = HashingUtils::HashString("SMS");
-        static const int EMAIL_HASH = HashingUtils::HashString("EMAIL");
-        static const int BAIDU_HASH = HashingUtils::HashString("BAIDU");
-        static const int CUSTOM_HASH = HashingUtils::HashString("CUSTOM");
+        static constexpr int GCM_HASH = HashingUtils::CompileTimeHashString("GCM");
+        static constexpr int APNS_HASH = HashingUtils::CompileTimeHashString("APNS");
+        static constexpr int APNS_SANDBOX_HASH = HashingUtils::CompileTimeHashString("APNS_SANDBOX");
+        static constexpr int APNS_VOIP_HASH = HashingUtils::CompileTimeHashString("APNS_VOIP");
+        static constexpr int APNS_VOIP_SANDBOX_HASH = HashingUtils::CompileTimeHashString("APNS_VOIP_SANDBOX");
+        static constexpr int ADM_HASH = HashingUtils::CompileTimeHashString("ADM");
+        static constexpr int SMS_HASH = HashingUtils::CompileTimeHashString("SMS");
+        static constexpr int EMAIL_HASH = HashingUtils::CompileTimeHashString("EMAIL");
+        static constexpr int BAIDU_HASH = HashingUtils::CompileTimeHashString("BAIDU");
+        static constexpr int CUSTOM_HASH = HashingUtils::CompileTimeHashString("CUSTOM");
 
 
         ChannelType GetChannelTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GCM_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChannelType::GCM;
-          }
-          else if (hashCode == APNS_HASH)
-          {
-            return ChannelType::APNS;
-          }
-          else if (hashCode == APNS_SANDBOX_HASH)
-          {
-            return ChannelType::APNS_SANDBOX;
-          }
-          else if (hashCode == APNS_VOIP_HASH)
-          {
-            return ChannelType::APNS_VOIP;
-          }
-          else if (hashCode == APNS_VOIP_SANDBOX_HASH)
-          {
-            return ChannelType::APNS_VOIP_SANDBOX;
-          }
-          else if (hashCode == ADM_HASH)
-          {
-            return ChannelType::ADM;
-          }
-          else if (hashCode == SMS_HASH)
-          {
-            return ChannelType::SMS;
-          }
-          else if (hashCode == EMAIL_HASH)
-          {
-            return ChannelType::EMAIL;
-          }
-          else if (hashCode == BAIDU_HASH)
-          {
-            return ChannelType::BAIDU;
-          }
-          else if (hashCode == CUSTOM_HASH)
-          {
-            return ChannelType::CUSTOM;
+          case GCM_HASH:
+            if (name == "GCM")
+            {
+              return ChannelType::GCM;
+            }
+            break;
+          case APNS_HASH:
+            if (name == "APNS")
+            {
+              return ChannelType::APNS;
+            }
+            break;
+          case APNS_SANDBOX_HASH:
+            if (name == "APNS_SANDBOX")
+            {
+              return ChannelType::APNS_SANDBOX;
+            }
+            break;
+          case APNS_VOIP_HASH:
+            if (name == "APNS_VOIP")
+            {
+              return ChannelType::APNS_VOIP;
+            }
+            break;
+          case APNS_VOIP_SANDBOX_HASH:
+            if (name == "APNS_VOIP_SANDBOX")
+            {
+              return ChannelType::APNS_VOIP_SANDBOX;
+            }
+            break;
+          case ADM_HASH:
+            if (name == "ADM")
+            {
+              return ChannelType::ADM;
+            }
+            break;
+          case SMS_HASH:
+            if (name == "SMS")
+            {
+              return ChannelType::SMS;
+            }
+            break;
+          case EMAIL_HASH:
+            if (name == "EMAIL")
+            {
+              return ChannelType::EMAIL;
+            }
+            break;
+          case BAIDU_HASH:
+            if (name == "BAIDU")
+            {
+              return ChannelType::BAIDU;
+            }
+            break;
+          case CUSTOM_HASH:
+            if (name == "CUSTOM")
+            {
+              return ChannelType::CUSTOM;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -95,7 +121,7 @@ namespace Aws
           return ChannelType::NOT_SET;
         }
 
-        Aws::String GetNameForChannelType(ChannelType enumValue)
+        const char* GetNameForChannelType(ChannelType enumValue)
         {
           switch(enumValue)
           {
@@ -123,7 +149,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace DeliveryStatusMapper
       {
 
-        static const int SUCCESSFUL_HASH = HashingUtils::HashString("SUCCESSFUL");
-        static const int THROTTLED_HASH = HashingUtils::HashString("THROTTLED");
-        static const int TEMPORARY_FAILURE_HASH = HashingUtils::HashString("TEMPORARY_FAILURE");
-        static const int PERMANENT_FAILURE_HASH = HashingUtils::HashString("PERMANENT_FAILURE");
-        static const int UNKNOWN_FAILURE_HASH = HashingUtils::HashString("UNKNOWN_FAILURE");
-        static const int OPT_OUT_HASH = HashingUtils::HashString("OPT_OUT");
-        static const int DUPLICATE_HASH = HashingUtils::HashString("DUPLICATE");
+        static constexpr int SUCCESSFUL_HASH = HashingUtils::CompileTimeHashString("SUCCESSFUL");
+        static constexpr int THROTTLED_HASH = HashingUtils::CompileTimeHashString("THROTTLED");
+        static constexpr int TEMPORARY_FAILURE_HASH = HashingUtils::CompileTimeHashString("TEMPORARY_FAILURE");
+        static constexpr int PERMANENT_FAILURE_HASH = HashingUtils::CompileTimeHashString("PERMANENT_FAILURE");
+        static constexpr int UNKNOWN_FAILURE_HASH = HashingUtils::CompileTimeHashString("UNKNOWN_FAILURE");
+        static constexpr int OPT_OUT_HASH = HashingUtils::CompileTimeHashString("OPT_OUT");
+        static constexpr int DUPLICATE_HASH = HashingUtils::CompileTimeHashString("DUPLICATE");
 
 
         DeliveryStatus GetDeliveryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESSFUL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DeliveryStatus::SUCCESSFUL;
-          }
-          else if (hashCode == THROTTLED_HASH)
-          {
-            return DeliveryStatus::THROTTLED;
-          }
-          else if (hashCode == TEMPORARY_FAILURE_HASH)
-          {
-            return DeliveryStatus::TEMPORARY_FAILURE;
-          }
-          else if (hashCode == PERMANENT_FAILURE_HASH)
-          {
-            return DeliveryStatus::PERMANENT_FAILURE;
-          }
-          else if (hashCode == UNKNOWN_FAILURE_HASH)
-          {
-            return DeliveryStatus::UNKNOWN_FAILURE;
-          }
-          else if (hashCode == OPT_OUT_HASH)
-          {
-            return DeliveryStatus::OPT_OUT;
-          }
-          else if (hashCode == DUPLICATE_HASH)
-          {
-            return DeliveryStatus::DUPLICATE;
+          case SUCCESSFUL_HASH:
+            if (name == "SUCCESSFUL")
+            {
+              return DeliveryStatus::SUCCESSFUL;
+            }
+            break;
+          case THROTTLED_HASH:
+            if (name == "THROTTLED")
+            {
+              return DeliveryStatus::THROTTLED;
+            }
+            break;
+          case TEMPORARY_FAILURE_HASH:
+            if (name == "TEMPORARY_FAILURE")
+            {
+              return DeliveryStatus::TEMPORARY_FAILURE;
+            }
+            break;
+          case PERMANENT_FAILURE_HASH:
+            if (name == "PERMANENT_FAILURE")
+            {
+              return DeliveryStatus::PERMANENT_FAILURE;
+            }
+            break;
+          case UNKNOWN_FAILURE_HASH:
+            if (name == "UNKNOWN_FAILURE")
+            {
+              return DeliveryStatus::UNKNOWN_FAILURE;
+            }
+            break;
+          case OPT_OUT_HASH:
+            if (name == "OPT_OUT")
+            {
+              return DeliveryStatus::OPT_OUT;
+            }
+            break;
+          case DUPLICATE_HASH:
+            if (name == "DUPLICATE")
+            {
+              return DeliveryStatus::DUPLICATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return DeliveryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDeliveryStatus(DeliveryStatus enumValue)
+        const char* GetNameForDeliveryStatus(DeliveryStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DimensionTypeMapper
       {
 
-        static const int INCLUSIVE_HASH = HashingUtils::HashString("INCLUSIVE");
-        static const int EXCLUSIVE_HASH = HashingUtils::HashString("EXCLUSIVE");
+        static constexpr int INCLUSIVE_HASH = HashingUtils::CompileTimeHashString("INCLUSIVE");
+        static constexpr int EXCLUSIVE_HASH = HashingUtils::CompileTimeHashString("EXCLUSIVE");
 
 
         DimensionType GetDimensionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INCLUSIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DimensionType::INCLUSIVE;
-          }
-          else if (hashCode == EXCLUSIVE_HASH)
-          {
-            return DimensionType::EXCLUSIVE;
+          case INCLUSIVE_HASH:
+            if (name == "INCLUSIVE")
+            {
+              return DimensionType::INCLUSIVE;
+            }
+            break;
+          case EXCLUSIVE_HASH:
+            if (name == "EXCLUSIVE")
+            {
+              return DimensionType::EXCLUSIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DimensionType::NOT_SET;
         }
 
-        Aws::String GetNameForDimensionType(DimensionType enumValue)
+        const char* GetNameForDimensionType(DimensionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace DurationMapper
       {
 
-        static const int HR_24_HASH = HashingUtils::HashString("HR_24");
-        static const int DAY_7_HASH = HashingUtils::HashString("DAY_7");
-        static const int DAY_14_HASH = HashingUtils::HashString("DAY_14");
-        static const int DAY_30_HASH = HashingUtils::HashString("DAY_30");
+        static constexpr int HR_24_HASH = HashingUtils::CompileTimeHashString("HR_24");
+        static constexpr int DAY_7_HASH = HashingUtils::CompileTimeHashString("DAY_7");
+        static constexpr int DAY_14_HASH = HashingUtils::CompileTimeHashString("DAY_14");
+        static constexpr int DAY_30_HASH = HashingUtils::CompileTimeHashString("DAY_30");
 
 
         Duration GetDurationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HR_24_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Duration::HR_24;
-          }
-          else if (hashCode == DAY_7_HASH)
-          {
-            return Duration::DAY_7;
-          }
-          else if (hashCode == DAY_14_HASH)
-          {
-            return Duration::DAY_14;
-          }
-          else if (hashCode == DAY_30_HASH)
-          {
-            return Duration::DAY_30;
+          case HR_24_HASH:
+            if (name == "HR_24")
+            {
+              return Duration::HR_24;
+            }
+            break;
+          case DAY_7_HASH:
+            if (name == "DAY_7")
+            {
+              return Duration::DAY_7;
+            }
+            break;
+          case DAY_14_HASH:
+            if (name == "DAY_14")
+            {
+              return Duration::DAY_14;
+            }
+            break;
+          case DAY_30_HASH:
+            if (name == "DAY_30")
+            {
+              return Duration::DAY_30;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return Duration::NOT_SET;
         }
 
-        Aws::String GetNameForDuration(Duration enumValue)
+        const char* GetNameForDuration(Duration enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace FormatMapper
       {
 
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
+        static constexpr int CSV_HASH = HashingUtils::CompileTimeHashString("CSV");
+        static constexpr int JSON_HASH = HashingUtils::CompileTimeHashString("JSON");
 
 
         Format GetFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CSV_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Format::CSV;
-          }
-          else if (hashCode == JSON_HASH)
-          {
-            return Format::JSON;
+          case CSV_HASH:
+            if (name == "CSV")
+            {
+              return Format::CSV;
+            }
+            break;
+          case JSON_HASH:
+            if (name == "JSON")
+            {
+              return Format::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Format::NOT_SET;
         }
 
-        Aws::String GetNameForFormat(Format enumValue)
+        const char* GetNameForFormat(Format enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace FrequencyMapper
       {
 
-        static const int ONCE_HASH = HashingUtils::HashString("ONCE");
-        static const int HOURLY_HASH = HashingUtils::HashString("HOURLY");
-        static const int DAILY_HASH = HashingUtils::HashString("DAILY");
-        static const int WEEKLY_HASH = HashingUtils::HashString("WEEKLY");
-        static const int MONTHLY_HASH = HashingUtils::HashString("MONTHLY");
+        static constexpr int ONCE_HASH = HashingUtils::CompileTimeHashString("ONCE");
+        static constexpr int HOURLY_HASH = HashingUtils::CompileTimeHashString("HOURLY");
+        static constexpr int DAILY_HASH = HashingUtils::CompileTimeHashString("DAILY");
+        static constexpr int WEEKLY_HASH = HashingUtils::CompileTimeHashString("WEEKLY");
+        static constexpr int MONTHLY_HASH = HashingUtils::CompileTimeHashString("MONTHLY");
 
 
         Frequency GetFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ONCE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Frequency::ONCE;
-          }
-          else if (hashCode == HOURLY_HASH)
-          {
-            return Frequency::HOURLY;
-          }
-          else if (hashCode == DAILY_HASH)
-          {
-            return Frequency::DAILY;
-          }
-          else if (hashCode == WEEKLY_HASH)
-          {
-            return Frequency::WEEKLY;
-          }
-          else if (hashCode == MONTHLY_HASH)
-          {
-            return Frequency::MONTHLY;
+          case ONCE_HASH:
+            if (name == "ONCE")
+            {
+              return Frequency::ONCE;
+            }
+            break;
+          case HOURLY_HASH:
+            if (name == "HOURLY")
+            {
+              return Frequency::HOURLY;
+            }
+            break;
+          case DAILY_HASH:
+            if (name == "DAILY")
+            {
+              return Frequency::DAILY;
+            }
+            break;
+          case WEEKLY_HASH:
+            if (name == "WEEKLY")
+            {
+              return Frequency::WEEKLY;
+            }
+            break;
+          case MONTHLY_HASH:
+            if (name == "MONTHLY")
+            {
+              return Frequency::MONTHLY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Frequency::NOT_SET;
         }
 
-        Aws::String GetNameForFrequency(Frequency enumValue)
+        const char* GetNameForFrequency(Frequency enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
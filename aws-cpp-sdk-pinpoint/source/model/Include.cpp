@@ -30,25 +30,37 @@ namespace Aws
       namespace IncludeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
+        static constexpr int ANY_HASH = HashingUtils::CompileTimeHashString("ANY");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         Include GetIncludeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Include::ALL;
-          }
-          else if (hashCode == ANY_HASH)
-          {
-            return Include::ANY;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return Include::NONE;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return Include::ALL;
+            }
+            break;
+          case ANY_HASH:
+            if (name == "ANY")
+            {
+              return Include::ANY;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return Include::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Include::NOT_SET;
         }
 
-        Aws::String GetNameForInclude(Include enumValue)
+        const char* GetNameForInclude(Include enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace JobStatusMapper
       {
 
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int INITIALIZING_HASH = HashingUtils::HashString("INITIALIZING");
-        static const int PROCESSING_HASH = HashingUtils::HashString("PROCESSING");
-        static const int COMPLETING_HASH = HashingUtils::HashString("COMPLETING");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILING_HASH = HashingUtils::HashString("FAILING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int CREATED_HASH = HashingUtils::CompileTimeHashString("CREATED");
+        static constexpr int INITIALIZING_HASH = HashingUtils::CompileTimeHashString("INITIALIZING");
+        static constexpr int PROCESSING_HASH = HashingUtils::CompileTimeHashString("PROCESSING");
+        static constexpr int COMPLETING_HASH = HashingUtils::CompileTimeHashString("COMPLETING");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int FAILING_HASH = HashingUtils::CompileTimeHashString("FAILING");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         JobStatus GetJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobStatus::CREATED;
-          }
-          else if (hashCode == INITIALIZING_HASH)
-          {
-            return JobStatus::INITIALIZING;
-          }
-          else if (hashCode == PROCESSING_HASH)
-          {
-            return JobStatus::PROCESSING;
-          }
-          else if (hashCode == COMPLETING_HASH)
-          {
-            return JobStatus::COMPLETING;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return JobStatus::COMPLETED;
-          }
-          else if (hashCode == FAILING_HASH)
-          {
-            return JobStatus::FAILING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return JobStatus::FAILED;
+          case CREATED_HASH:
+            if (name == "CREATED")
+            {
+              return JobStatus::CREATED;
+            }
+            break;
+          case INITIALIZING_HASH:
+            if (name == "INITIALIZING")
+            {
+              return JobStatus::INITIALIZING;
+            }
+            break;
+          case PROCESSING_HASH:
+            if (name == "PROCESSING")
+            {
+              return JobStatus::PROCESSING;
+            }
+            break;
+          case COMPLETING_HASH:
+            if (name == "COMPLETING")
+            {
+              return JobStatus::COMPLETING;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return JobStatus::COMPLETED;
+            }
+            break;
+          case FAILING_HASH:
+            if (name == "FAILING")
+            {
+              return JobStatus::FAILING;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return JobStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return JobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForJobStatus(JobStatus enumValue)
+        const char* GetNameForJobStatus(JobStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
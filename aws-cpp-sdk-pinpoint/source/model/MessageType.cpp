@@ -30,20 +30,30 @@ namespace Aws
       namespace MessageTypeMapper
       {
 
-        static const int TRANSACTIONAL_HASH = HashingUtils::HashString("TRANSACTIONAL");
-        static const int PROMOTIONAL_HASH = HashingUtils::HashString("PROMOTIONAL");
+        static constexpr int TRANSACTIONAL_HASH = HashingUtils::CompileTimeHashString("TRANSACTIONAL");
+        static constexpr int PROMOTIONAL_HASH = HashingUtils::CompileTimeHashString("PROMOTIONAL");
 
 
         MessageType GetMessageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRANSACTIONAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MessageType::TRANSACTIONAL;
-          }
-          else if (hashCode == PROMOTIONAL_HASH)
-          {
-            return MessageType::PROMOTIONAL;
+          case TRANSACTIONAL_HASH:
+            if (name == "TRANSACTIONAL")
+            {
+              return MessageType::TRANSACTIONAL;
+            }
+            break;
+          case PROMOTIONAL_HASH:
+            if (name == "PROMOTIONAL")
+            {
+              return MessageType::PROMOTIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MessageType::NOT_SET;
         }
 
-        Aws::String GetNameForMessageType(MessageType enumValue)
+        const char* GetNameForMessageType(MessageType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ModeMapper
       {
 
-        static const int DELIVERY_HASH = HashingUtils::HashString("DELIVERY");
-        static const int FILTER_HASH = HashingUtils::HashString("FILTER");
+        static constexpr int DELIVERY_HASH = HashingUtils::CompileTimeHashString("DELIVERY");
+        static constexpr int FILTER_HASH = HashingUtils::CompileTimeHashString("FILTER");
 
 
         Mode GetModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DELIVERY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Mode::DELIVERY;
-          }
-          else if (hashCode == FILTER_HASH)
-          {
-            return Mode::FILTER;
+          case DELIVERY_HASH:
+            if (name == "DELIVERY")
+            {
+              return Mode::DELIVERY;
+            }
+            break;
+          case FILTER_HASH:
+            if (name == "FILTER")
+            {
+              return Mode::FILTER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Mode::NOT_SET;
         }
 
-        Aws::String GetNameForMode(Mode enumValue)
+        const char* GetNameForMode(Mode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace SegmentTypeMapper
       {
 
-        static const int DIMENSIONAL_HASH = HashingUtils::HashString("DIMENSIONAL");
-        static const int IMPORT_HASH = HashingUtils::HashString("IMPORT");
+        static constexpr int DIMENSIONAL_HASH = HashingUtils::CompileTimeHashString("DIMENSIONAL");
+        static constexpr int IMPORT_HASH = HashingUtils::CompileTimeHashString("IMPORT");
 
 
         SegmentType GetSegmentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DIMENSIONAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SegmentType::DIMENSIONAL;
-          }
-          else if (hashCode == IMPORT_HASH)
-          {
-            return SegmentType::IMPORT;
+          case DIMENSIONAL_HASH:
+            if (name == "DIMENSIONAL")
+            {
+              return SegmentType::DIMENSIONAL;
+            }
+            break;
+          case IMPORT_HASH:
+            if (name == "IMPORT")
+            {
+              return SegmentType::IMPORT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SegmentType::NOT_SET;
         }
 
-        Aws::String GetNameForSegmentType(SegmentType enumValue)
+        const char* GetNameForSegmentType(SegmentType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int ANY_HASH = HashingUtils::HashString("ANY");
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
+        static constexpr int ANY_HASH = HashingUtils::CompileTimeHashString("ANY");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceType::ALL;
-          }
-          else if (hashCode == ANY_HASH)
-          {
-            return SourceType::ANY;
-          }
-          else if (hashCode == NONE_HASH)
-          {
-            return SourceType::NONE;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return SourceType::ALL;
+            }
+            break;
+          case ANY_HASH:
+            if (name == "ANY")
+            {
+              return SourceType::ANY;
+            }
+            break;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return SourceType::NONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceType(SourceType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
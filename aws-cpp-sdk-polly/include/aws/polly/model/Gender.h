@@ -34,7 +34,8 @@ namespace GenderMapper
 {
 AWS_POLLY_API Gender GetGenderForName(const Aws::String& name);
 
-AWS_POLLY_API Aws::String GetNameForGender(Gender value);
+// names of values not modeled point into the enum overflow container
+AWS_POLLY_API const char* GetNameForGender(Gender value);
 } // namespace GenderMapper
 } // namespace Model
 } // namespace Polly
@@ -58,7 +58,8 @@ namespace LanguageCodeMapper
 {
 AWS_POLLY_API LanguageCode GetLanguageCodeForName(const Aws::String& name);
 
-AWS_POLLY_API Aws::String GetNameForLanguageCode(LanguageCode value);
+// names of values not modeled point into the enum overflow container
+AWS_POLLY_API const char* GetNameForLanguageCode(LanguageCode value);
 } // namespace LanguageCodeMapper
 } // namespace Model
 } // namespace Polly
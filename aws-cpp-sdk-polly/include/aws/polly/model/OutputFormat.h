@@ -36,7 +36,8 @@ namespace OutputFormatMapper
 {
 AWS_POLLY_API OutputFormat GetOutputFormatForName(const Aws::String& name);
 
-AWS_POLLY_API Aws::String GetNameForOutputFormat(OutputFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_POLLY_API const char* GetNameForOutputFormat(OutputFormat value);
 } // namespace OutputFormatMapper
 } // namespace Model
 } // namespace Polly
@@ -36,7 +36,8 @@ namespace SpeechMarkTypeMapper
 {
 AWS_POLLY_API SpeechMarkType GetSpeechMarkTypeForName(const Aws::String& name);
 
-AWS_POLLY_API Aws::String GetNameForSpeechMarkType(SpeechMarkType value);
+// names of values not modeled point into the enum overflow container
+AWS_POLLY_API const char* GetNameForSpeechMarkType(SpeechMarkType value);
 } // namespace SpeechMarkTypeMapper
 } // namespace Model
 } // namespace Polly
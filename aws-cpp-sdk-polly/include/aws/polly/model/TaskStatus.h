@@ -36,7 +36,8 @@ namespace TaskStatusMapper
 {
 AWS_POLLY_API TaskStatus GetTaskStatusForName(const Aws::String& name);
 
-AWS_POLLY_API Aws::String GetNameForTaskStatus(TaskStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_POLLY_API const char* GetNameForTaskStatus(TaskStatus value);
 } // namespace TaskStatusMapper
 } // namespace Model
 } // namespace Polly
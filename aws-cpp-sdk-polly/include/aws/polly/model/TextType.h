@@ -34,7 +34,8 @@ namespace TextTypeMapper
 {
 AWS_POLLY_API TextType GetTextTypeForName(const Aws::String& name);
 
-AWS_POLLY_API Aws::String GetNameForTextType(TextType value);
+// names of values not modeled point into the enum overflow container
+AWS_POLLY_API const char* GetNameForTextType(TextType value);
 } // namespace TextTypeMapper
 } // namespace Model
 } // namespace Polly
@@ -85,7 +85,8 @@ namespace VoiceIdMapper
 {
 AWS_POLLY_API VoiceId GetVoiceIdForName(const Aws::String& name);
 
-AWS_POLLY_API Aws::String GetNameForVoiceId(VoiceId value);
+// names of values not modeled point into the enum overflow container
+AWS_POLLY_API const char* GetNameForVoiceId(VoiceId value);
 } // namespace VoiceIdMapper
 } // namespace Model
 } // namespace Polly
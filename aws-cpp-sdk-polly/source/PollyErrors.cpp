@@ -28,26 +28,26 @@ namespace Polly
 namespace PollyErrorMapper
 {
 
-static const int LANGUAGE_NOT_SUPPORTED_HASH = HashingUtils::HashString("LanguageNotSupportedException");
-static const int UNSUPPORTED_PLS_LANGUAGE_HASH = HashingUtils::HashString("UnsupportedPlsLanguageException");
-static const int UNSUPPORTED_PLS_ALPHABET_HASH = HashingUtils::HashString("UnsupportedPlsAlphabetException");
-static const int LEXICON_NOT_FOUND_HASH = HashingUtils::HashString("LexiconNotFoundException");
-static const int MAX_LEXEME_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("MaxLexemeLengthExceededException");
-static const int INVALID_SNS_TOPIC_ARN_HASH = HashingUtils::HashString("InvalidSnsTopicArnException");
-static const int MARKS_NOT_SUPPORTED_FOR_FORMAT_HASH = HashingUtils::HashString("MarksNotSupportedForFormatException");
-static const int TEXT_LENGTH_EXCEEDED_HASH = HashingUtils::HashString("TextLengthExceededException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int INVALID_S3_KEY_HASH = HashingUtils::HashString("InvalidS3KeyException");
-static const int LEXICON_SIZE_EXCEEDED_HASH = HashingUtils::HashString("LexiconSizeExceededException");
-static const int INVALID_SSML_HASH = HashingUtils::HashString("InvalidSsmlException");
-static const int MAX_LEXICONS_NUMBER_EXCEEDED_HASH = HashingUtils::HashString("MaxLexiconsNumberExceededException");
-static const int INVALID_LEXICON_HASH = HashingUtils::HashString("InvalidLexiconException");
-static const int INVALID_S3_BUCKET_HASH = HashingUtils::HashString("InvalidS3BucketException");
-static const int INVALID_TASK_ID_HASH = HashingUtils::HashString("InvalidTaskIdException");
-static const int SYNTHESIS_TASK_NOT_FOUND_HASH = HashingUtils::HashString("SynthesisTaskNotFoundException");
-static const int INVALID_SAMPLE_RATE_HASH = HashingUtils::HashString("InvalidSampleRateException");
-static const int SSML_MARKS_NOT_SUPPORTED_FOR_TEXT_TYPE_HASH = HashingUtils::HashString("SsmlMarksNotSupportedForTextTypeException");
-static const int SERVICE_FAILURE_HASH = HashingUtils::HashString("ServiceFailureException");
+static constexpr int LANGUAGE_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("LanguageNotSupportedException");
+static constexpr int UNSUPPORTED_PLS_LANGUAGE_HASH = HashingUtils::CompileTimeHashString("UnsupportedPlsLanguageException");
+static constexpr int UNSUPPORTED_PLS_ALPHABET_HASH = HashingUtils::CompileTimeHashString("UnsupportedPlsAlphabetException");
+static constexpr int LEXICON_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("LexiconNotFoundException");
+static constexpr int MAX_LEXEME_LENGTH_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxLexemeLengthExceededException");
+static constexpr int INVALID_SNS_TOPIC_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidSnsTopicArnException");
+static constexpr int MARKS_NOT_SUPPORTED_FOR_FORMAT_HASH = HashingUtils::CompileTimeHashString("MarksNotSupportedForFormatException");
+static constexpr int TEXT_LENGTH_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TextLengthExceededException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int INVALID_S3_KEY_HASH = HashingUtils::CompileTimeHashString("InvalidS3KeyException");
+static constexpr int LEXICON_SIZE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LexiconSizeExceededException");
+static constexpr int INVALID_SSML_HASH = HashingUtils::CompileTimeHashString("InvalidSsmlException");
+static constexpr int MAX_LEXICONS_NUMBER_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxLexiconsNumberExceededException");
+static constexpr int INVALID_LEXICON_HASH = HashingUtils::CompileTimeHashString("InvalidLexiconException");
+static constexpr int INVALID_S3_BUCKET_HASH = HashingUtils::CompileTimeHashString("InvalidS3BucketException");
+static constexpr int INVALID_TASK_ID_HASH = HashingUtils::CompileTimeHashString("InvalidTaskIdException");
+static constexpr int SYNTHESIS_TASK_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("SynthesisTaskNotFoundException");
+static constexpr int INVALID_SAMPLE_RATE_HASH = HashingUtils::CompileTimeHashString("InvalidSampleRateException");
+static constexpr int SSML_MARKS_NOT_SUPPORTED_FOR_TEXT_TYPE_HASH = HashingUtils::CompileTimeHashString("SsmlMarksNotSupportedForTextTypeException");
+static constexpr int SERVICE_FAILURE_HASH = HashingUtils::CompileTimeHashString("ServiceFailureException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
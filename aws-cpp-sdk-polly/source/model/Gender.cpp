@@ -30,20 +30,30 @@ namespace Aws
       namespace GenderMapper
       {
 
-        static const int Female_HASH = HashingUtils::HashString("Female");
-        static const int Male_HASH = HashingUtils::HashString("Male");
+        static constexpr int Female_HASH = HashingUtils::CompileTimeHashString("Female");
+        static constexpr int Male_HASH = HashingUtils::CompileTimeHashString("Male");
 
 
         Gender GetGenderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Female_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Gender::Female;
-          }
-          else if (hashCode == Male_HASH)
-          {
-            return Gender::Male;
+          case Female_HASH:
+            if (name == "Female")
+            {
+              return Gender::Female;
+            }
+            break;
+          case Male_HASH:
+            if (name == "Male")
+            {
+              return Gender::Male;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Gender::NOT_SET;
         }
 
-        Aws::String GetNameForGender(Gender enumValue)
+        const char* GetNameForGender(Gender enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
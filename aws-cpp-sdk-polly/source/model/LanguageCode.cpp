@@ -30,140 +30,198 @@ namespace Aws
       namespace LanguageCodeMapper
       {
 
-        static const int cy_GB_HASH = HashingUtils::HashString("cy-GB");
-        static const int da_DK_HASH = HashingUtils::HashString("da-DK");
-        static const int de_DE_HASH = HashingUtils::HashString("de-DE");
-        static const int en_AU_HASH = HashingUtils::HashString("en-AU");
-        static const int en_GB_HASH = HashingUtils::HashString("en-GB");
-        static const int en_GB_WLS_HASH = HashingUtils::HashString("en-GB-WLS");
-        static const int en_IN_HASH = HashingUtils::HashString("en-IN");
-        static const int en_US_HASH = HashingUtils::HashString("en-US");
-        static const int es_ES_HASH = HashingUtils::HashString("es-ES");
-        static const int es_US_HASH = HashingUtils::HashString("es-US");
-        static const int fr_CA_HASH = HashingUtils::HashString("fr-CA");
-        static const int fr_FR_HASH = HashingUtils::HashString("fr-FR");
-        static const int is_IS_HASH = HashingUtils::HashString("is-IS");
-        static const int it_IT_HASH = HashingUtils::HashString("it-IT");
-        static const int ja_JP_HASH = HashingUtils::HashString("ja-JP");
-        static const int hi_IN_HASH = HashingUtils::HashString("hi-IN");
-        static const int ko_KR_HASH = HashingUtils::HashString("ko-KR");
-        static const int nb_NO_HASH = HashingUtils::HashString("nb-NO");
-        static const int nl_NL_HASH = HashingUtils::HashString("nl-NL");
-        static const int pl_PL_HASH = HashingUtils::HashString("pl-PL");
-        static const int pt_BR_HASH = HashingUtils::HashString("pt-BR");
-        static const int pt_PT_HASH = HashingUtils::HashString("pt-PT");
-        static const int ro_RO_HASH = HashingUtils::HashString("ro-RO");
-        static const int ru_RU_HASH = HashingUtils::HashString("ru-RU");
-        static const int sv_SE_HASH = HashingUtils::HashString("sv-SE");
-        static const int tr_TR_HASH = HashingUtils::HashString("tr-TR");
+        static constexpr int cy_GB_HASH = HashingUtils::CompileTimeHashString("cy-GB");
+        static constexpr int da_DK_HASH = HashingUtils::CompileTimeHashString("da-DK");
+        static constexpr int de_DE_HASH = HashingUtils::CompileTimeHashString("de-DE");
+        static constexpr int en_AU_HASH = HashingUtils::CompileTimeHashString("en-AU");
+        static constexpr int en_GB_HASH = HashingUtils::CompileTimeHashString("en-GB");
+        static constexpr int en_GB_WLS_HASH = HashingUtils::CompileTimeHashString("en-GB-WLS");
+        static constexpr int en_IN_HASH = HashingUtils::CompileTimeHashString("en-IN");
+        static constexpr int en_US_HASH = HashingUtils::CompileTimeHashString("en-US");
+        static constexpr int es_ES_HASH = HashingUtils::CompileTimeHashString("es-ES");
+        static constexpr int es_US_HASH = HashingUtils::CompileTimeHashString("es-US");
+        static constexpr int fr_CA_HASH = HashingUtils::CompileTimeHashString("fr-CA");
+        static constexpr int fr_FR_HASH = HashingUtils::CompileTimeHashString("fr-FR");
+        static constexpr int is_IS_HASH = HashingUtils::CompileTimeHashString("is-IS");
+        static constexpr int it_IT_HASH = HashingUtils::CompileTimeHashString("it-IT");
+        static constexpr int ja_JP_HASH = HashingUtils::CompileTimeHashString("ja-JP");
+        static constexpr int hi_IN_HASH = HashingUtils::CompileTimeHashString("hi-IN");
+        static constexpr int ko_KR_HASH = HashingUtils::CompileTimeHashString("ko-KR");
+        static constexpr int nb_NO_HASH = HashingUtils::CompileTimeHashString("nb-NO");
+        static constexpr int nl_NL_HASH = HashingUtils::CompileTimeHashString("nl-NL");
+        static constexpr int pl_PL_HASH = HashingUtils::CompileTimeHashString("pl-PL");
+        static constexpr int pt_BR_HASH = HashingUtils::CompileTimeHashString("pt-BR");
+        static constexpr int pt_PT_HASH = HashingUtils::CompileTimeHashString("pt-PT");
+        static constexpr int ro_RO_HASH = HashingUtils::CompileTimeHashString("ro-RO");
+        static constexpr int ru_RU_HASH = HashingUtils::CompileTimeHashString("ru-RU");
+        static constexpr int sv_SE_HASH = HashingUtils::CompileTimeHashString("sv-SE");
+        static constexpr int tr_TR_HASH = HashingUtils::CompileTimeHashString("tr-TR");
 
 
         LanguageCode GetLanguageCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cy_GB_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LanguageCode::cy_GB;
-          }
-          else if (hashCode == da_DK_HASH)
-          {
-            return LanguageCode::da_DK;
-          }
-          else if (hashCode == de_DE_HASH)
-          {
-            return LanguageCode::de_DE;
-          }
-          else if (hashCode == en_AU_HASH)
-          {
-            return LanguageCode::en_AU;
-          }
-          else if (hashCode == en_GB_HASH)
-          {
-            return LanguageCode::en_GB;
-          }
-          else if (hashCode == en_GB_WLS_HASH)
-          {
-            return LanguageCode::en_GB_WLS;
-          }
-          else if (hashCode == en_IN_HASH)
-          {
-            return LanguageCode::en_IN;
-          }
-          else if (hashCode == en_US_HASH)
-          {
-            return LanguageCode::en_US;
-          }
-          else if (hashCode == es_ES_HASH)
-          {
-            return LanguageCode::es_ES;
-          }
-          else if (hashCode == es_US_HASH)
-          {
-            return LanguageCode::es_US;
-          }
-          else if (hashCode == fr_CA_HASH)
-          {
-            return LanguageCode::fr_CA;
-          }
-          else if (hashCode == fr_FR_HASH)
-          {
-            return LanguageCode::fr_FR;
-          }
-          else if (hashCode == is_IS_HASH)
-          {
-            return LanguageCode::is_IS;
-          }
-          else if (hashCode == it_IT_HASH)
-          {
-            return LanguageCode::it_IT;
-          }
-          else if (hashCode == ja_JP_HASH)
-          {
-            return LanguageCode::ja_JP;
-          }
-          else if (hashCode == hi_IN_HASH)
-          {
-            return LanguageCode::hi_IN;
-          }
-          else if (hashCode == ko_KR_HASH)
-          {
-            return LanguageCode::ko_KR;
-          }
-          else if (hashCode == nb_NO_HASH)
-          {
-            return LanguageCode::nb_NO;
-          }
-          else if (hashCode == nl_NL_HASH)
-          {
-            return LanguageCode::nl_NL;
-          }
-          else if (hashCode == pl_PL_HASH)
-          {
-            return LanguageCode::pl_PL;
-          }
-          else if (hashCode == pt_BR_HASH)
-          {
-            return LanguageCode::pt_BR;
-          }
-          else if (hashCode == pt_PT_HASH)
-          {
-            return LanguageCode::pt_PT;
-          }
-          else if (hashCode == ro_RO_HASH)
-          {
-            return LanguageCode::ro_RO;
-          }
-          else if (hashCode == ru_RU_HASH)
-          {
-            return LanguageCode::ru_RU;
-          }
-          else if (hashCode == sv_SE_HASH)
-          {
-            return LanguageCode::sv_SE;
-          }
-          else if (hashCode == tr_TR_HASH)
-          {
-            return LanguageCode::tr_TR;
+          case cy_GB_HASH:
+            if (name == "cy-GB")
+            {
+              return LanguageCode::cy_GB;
+            }
+            break;
+          case da_DK_HASH:
+            if (name == "da-DK")
+            {
+              return LanguageCode::da_DK;
+            }
+            break;
+          case de_DE_HASH:
+            if (name == "de-DE")
+            {
+              return LanguageCode::de_DE;
+            }
+            break;
+          case en_AU_HASH:
+            if (name == "en-AU")
+            {
+              return LanguageCode::en_AU;
+            }
+            break;
+          case en_GB_HASH:
+            if (name == "en-GB")
+            {
+              return LanguageCode::en_GB;
+            }
+            break;
+          case en_GB_WLS_HASH:
+            if (name == "en-GB-WLS")
+            {
+              return LanguageCode::en_GB_WLS;
+            }
+            break;
+          case en_IN_HASH:
+            if (name == "en-IN")
+            {
+              return LanguageCode::en_IN;
+            }
+            break;
+          case en_US_HASH:
+            if (name == "en-US")
+            {
+              return LanguageCode::en_US;
+            }
+            break;
+          case es_ES_HASH:
+            if (name == "es-ES")
+            {
+              return LanguageCode::es_ES;
+            }
+            break;
+          case es_US_HASH:
+            if (name == "es-US")
+            {
+              return LanguageCode::es_US;
+            }
+            break;
+          case fr_CA_HASH:
+            if (name == "fr-CA")
+            {
+              return LanguageCode::fr_CA;
+            }
+            break;
+          case fr_FR_HASH:
+            if (name == "fr-FR")
+            {
+              return LanguageCode::fr_FR;
+            }
+            break;
+          case is_IS_HASH:
+            if (name == "is-IS")
+            {
+              return LanguageCode::is_IS;
+            }
+            break;
+          case it_IT_HASH:
+            if (name == "it-IT")
+            {
+              return LanguageCode::it_IT;
+            }
+            break;
+          case ja_JP_HASH:
+            if (name == "ja-JP")
+            {
+              return LanguageCode::ja_JP;
+            }
+            break;
+          case hi_IN_HASH:
+            if (name == "hi-IN")
+            {
+              return LanguageCode::hi_IN;
+            }
+            break;
+          case ko_KR_HASH:
+            if (name == "ko-KR")
+            {
+              return LanguageCode::ko_KR;
+            }
+            break;
+          case nb_NO_HASH:
+            if (name == "nb-NO")
+            {
+              return LanguageCode::nb_NO;
+            }
+            break;
+          case nl_NL_HASH:
+            if (name == "nl-NL")
+            {
+              return LanguageCode::nl_NL;
+            }
+            break;
+          case pl_PL_HASH:
+            if (name == "pl-PL")
+            {
+              return LanguageCode::pl_PL;
+            }
+            break;
+          case pt_BR_HASH:
+            if (name == "pt-BR")
+            {
+              return LanguageCode::pt_BR;
+            }
+            break;
+          case pt_PT_HASH:
+            if (name == "pt-PT")
+            {
+              return LanguageCode::pt_PT;
+            }
+            break;
+          case ro_RO_HASH:
+            if (name == "ro-RO")
+            {
+              return LanguageCode::ro_RO;
+            }
+            break;
+          case ru_RU_HASH:
+            if (name == "ru-RU")
+            {
+              return LanguageCode::ru_RU;
+            }
+            break;
+          case sv_SE_HASH:
+            if (name == "sv-SE")
+            {
+              return LanguageCode::sv_SE;
+            }
+            break;
+          case tr_TR_HASH:
+            if (name == "tr-TR")
+            {
+              return LanguageCode::tr_TR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -175,7 +233,7 @@ namespace Aws
           return LanguageCode::NOT_SET;
         }
 
-        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
+        const char* GetNameForLanguageCode(LanguageCode enumValue)
         {
           switch(enumValue)
           {
@@ -235,7 +293,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
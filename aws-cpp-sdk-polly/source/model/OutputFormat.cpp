@@ -30,30 +30,44 @@ namespace Aws
       namespace OutputFormatMapper
       {
 
-        static const int json_HASH = HashingUtils::HashString("json");
-        static const int mp3_HASH = HashingUtils::HashString("mp3");
-        static const int ogg_vorbis_HASH = HashingUtils::HashString("ogg_vorbis");
-        static const int pcm_HASH = HashingUtils::HashString("pcm");
+        static constexpr int json_HASH = HashingUtils::CompileTimeHashString("json");
+        static constexpr int mp3_HASH = HashingUtils::CompileTimeHashString("mp3");
+        static constexpr int ogg_vorbis_HASH = HashingUtils::CompileTimeHashString("ogg_vorbis");
+        static constexpr int pcm_HASH = HashingUtils::CompileTimeHashString("pcm");
 
 
         OutputFormat GetOutputFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == json_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OutputFormat::json;
-          }
-          else if (hashCode == mp3_HASH)
-          {
-            return OutputFormat::mp3;
-          }
-          else if (hashCode == ogg_vorbis_HASH)
-          {
-            return OutputFormat::ogg_vorbis;
-          }
-          else if (hashCode == pcm_HASH)
-          {
-            return OutputFormat::pcm;
+          case json_HASH:
+            if (name == "json")
+            {
+              return OutputFormat::json;
+            }
+            break;
+          case mp3_HASH:
+            if (name == "mp3")
+            {
+              return OutputFormat::mp3;
+            }
+            break;
+          case ogg_vorbis_HASH:
+            if (name == "ogg_vorbis")
+            {
+              return OutputFormat::ogg_vorbis;
+            }
+            break;
+          case pcm_HASH:
+            if (name == "pcm")
+            {
+              return OutputFormat::pcm;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return OutputFormat::NOT_SET;
         }
 
-        Aws::String GetNameForOutputFormat(OutputFormat enumValue)
+        const char* GetNameForOutputFormat(OutputFormat enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace SpeechMarkTypeMapper
       {
 
-        static const int sentence_HASH = HashingUtils::HashString("sentence");
-        static const int ssml_HASH = HashingUtils::HashString("ssml");
-        static const int viseme_HASH = HashingUtils::HashString("viseme");
-        static const int word_HASH = HashingUtils::HashString("word");
+        static constexpr int sentence_HASH = HashingUtils::CompileTimeHashString("sentence");
+        static constexpr int ssml_HASH = HashingUtils::CompileTimeHashString("ssml");
+        static constexpr int viseme_HASH = HashingUtils::CompileTimeHashString("viseme");
+        static constexpr int word_HASH = HashingUtils::CompileTimeHashString("word");
 
 
         SpeechMarkType GetSpeechMarkTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == sentence_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SpeechMarkType::sentence;
-          }
-          else if (hashCode == ssml_HASH)
-          {
-            return SpeechMarkType::ssml;
-          }
-          else if (hashCode == viseme_HASH)
-          {
-            return SpeechMarkType::viseme;
-          }
-          else if (hashCode == word_HASH)
-          {
-            return SpeechMarkType::word;
+          case sentence_HASH:
+            if (name == "sentence")
+            {
+              return SpeechMarkType::sentence;
+            }
+            break;
+          case ssml_HASH:
+            if (name == "ssml")
+            {
+              return SpeechMarkType::ssml;
+            }
+            break;
+          case viseme_HASH:
+            if (name == "viseme")
+            {
+              return SpeechMarkType::viseme;
+            }
+            break;
+          case word_HASH:
+            if (name == "word")
+            {
+              return SpeechMarkType::word;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return SpeechMarkType::NOT_SET;
         }
 
-        Aws::String GetNameForSpeechMarkType(SpeechMarkType enumValue)
+        const char* GetNameForSpeechMarkType(SpeechMarkType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
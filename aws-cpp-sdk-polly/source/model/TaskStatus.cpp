@@ -30,30 +30,44 @@ namespace Aws
       namespace TaskStatusMapper
       {
 
-        static const int scheduled_HASH = HashingUtils::HashString("scheduled");
-        static const int inProgress_HASH = HashingUtils::HashString("inProgress");
-        static const int completed_HASH = HashingUtils::HashString("completed");
-        static const int failed_HASH = HashingUtils::HashString("failed");
+        static constexpr int scheduled_HASH = HashingUtils::CompileTimeHashString("scheduled");
+        static constexpr int inProgress_HASH = HashingUtils::CompileTimeHashString("inProgress");
+        static constexpr int completed_HASH = HashingUtils::CompileTimeHashString("completed");
+        static constexpr int failed_HASH = HashingUtils::CompileTimeHashString("failed");
 
 
         TaskStatus GetTaskStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == scheduled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TaskStatus::scheduled;
-          }
-          else if (hashCode == inProgress_HASH)
-          {
-            return TaskStatus::inProgress;
-          }
-          else if (hashCode == completed_HASH)
-          {
-            return TaskStatus::completed;
-          }
-          else if (hashCode == failed_HASH)
-          {
-            return TaskStatus::failed;
+          case scheduled_HASH:
+            if (name == "scheduled")
+            {
+              return TaskStatus::scheduled;
+            }
+            break;
+          case inProgress_HASH:
+            if (name == "inProgress")
+            {
+              return TaskStatus::inProgress;
+            }
+            break;
+          case completed_HASH:
+            if (name == "completed")
+            {
+              return TaskStatus::completed;
+            }
+            break;
+          case failed_HASH:
+            if (name == "failed")
+            {
+              return TaskStatus::failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return TaskStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTaskStatus(TaskStatus enumValue)
+        const char* GetNameForTaskStatus(TaskStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace TextTypeMapper
       {
 
-        static const int ssml_HASH = HashingUtils::HashString("ssml");
-        static const int text_HASH = HashingUtils::HashString("text");
+        static constexpr int ssml_HASH = HashingUtils::CompileTimeHashString("ssml");
+        static constexpr int text_HASH = HashingUtils::CompileTimeHashString("text");
 
 
         TextType GetTextTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ssml_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TextType::ssml;
-          }
-          else if (hashCode == text_HASH)
-          {
-            return TextType::text;
+          case ssml_HASH:
+            if (name == "ssml")
+            {
+              return TextType::ssml;
+            }
+            break;
+          case text_HASH:
+            if (name == "text")
+            {
+              return TextType::text;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TextType::NOT_SET;
         }
 
-        Aws::String GetNameForTextType(TextType enumValue)
+        const char* GetNameForTextType(TextType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,275 +30,387 @@ namespace Aws
       namespace VoiceIdMapper
       {
 
-        static const int Geraint_HASH = HashingUtils::HashString("Geraint");
-        static const int Gwyneth_HASH = HashingUtils::HashString("Gwyneth");
-        static const int Mads_HASH = HashingUtils::HashString("Mads");
-        static const int Naja_HASH = HashingUtils::HashString("Naja");
-        static const int Hans_HASH = HashingUtils::HashString("Hans");
-        static const int Marlene_HASH = HashingUtils::HashString("Marlene");
-        static const int Nicole_HASH = HashingUtils::HashString("Nicole");
-        static const int Russell_HASH = HashingUtils::HashString("Russell");
-        static const int Amy_HASH = HashingUtils::HashString("Amy");
-        static const int Brian_HASH = HashingUtils::HashString("Brian");
-        static const int Emma_HASH = HashingUtils::HashString("Emma");
-        static const int Raveena_HASH = HashingUtils::HashString("Raveena");
-        static const int Ivy_HASH = HashingUtils::HashString("Ivy");
-        static const int Joanna_HASH = HashingUtils::HashString("Joanna");
-        static const int Joey_HASH = HashingUtils::HashString("Joey");
-        static const int Justin_HASH = HashingUtils::HashString("Justin");
-        static const int Kendra_HASH = HashingUtils::HashString("Kendra");
-        static const int Kimberly_HASH = HashingUtils::HashString("Kimberly");
-        static const int Matthew_HASH = HashingUtils::HashString("Matthew");
-        static const int Salli_HASH = HashingUtils::HashString("Salli");
-        static const int Conchita_HASH = HashingUtils::HashString("Conchita");
-        static const int Enrique_HASH = HashingUtils::HashString("Enrique");
-        static const int Miguel_HASH = HashingUtils::HashString("Miguel");
-        static const int Penelope_HASH = HashingUtils::HashString("Penelope");
-        static const int Chantal_HASH = HashingUtils::HashString("Chantal");
-        static const int Celine_HASH = HashingUtils::HashString("Celine");
-        static const int Lea_HASH = HashingUtils::HashString("Lea");
-        static const int Mathieu_HASH = HashingUtils::HashString("Mathieu");
-        static const int Dora_HASH = HashingUtils::HashString("Dora");
-        static const int Karl_HASH = HashingUtils::HashString("Karl");
-        static const int Carla_HASH = HashingUtils::HashString("Carla");
-        static const int Giorgio_HASH = HashingUtils::HashString("Giorgio");
-        static const int Mizuki_HASH = HashingUtils::HashString("Mizuki");
-        static const int Liv_HASH = HashingUtils::HashString("Liv");
-        static const int Lotte_HASH = HashingUtils::HashString("Lotte");
-        static const int Ruben_HASH = HashingUtils::HashString("Ruben");
-        static const int Ewa_HASH = HashingUtils::HashString("Ewa");
-        static const int Jacek_HASH = HashingUtils::HashString("Jacek");
-        static const int Jan_HASH = HashingUtils::HashString("Jan");
-        static const int Maja_HASH = HashingUtils::HashString("Maja");
-        static const int Ricardo_HASH = HashingUtils::HashString("Ricardo");
-        static const int Vitoria_HASH = HashingUtils::HashString("Vitoria");
-        static const int Cristiano_HASH = HashingUtils::HashString("Cristiano");
-        static const int Ines_HASH = HashingUtils::HashString("Ines");
-        static const int Carmen_HASH = HashingUtils::HashString("Carmen");
-        static const int Maxim_HASH = HashingUtils::HashString("Maxim");
-        static const int Tatyana_HASH = HashingUtils::HashString("Tatyana");
-        static const int Astrid_HASH = HashingUtils::HashString("Astrid");
-        static const int Filiz_HASH = HashingUtils::HashString("Filiz");
-        static const int Vicki_HASH = HashingUtils::HashString("Vicki");
-        static const int Takumi_HASH = HashingUtils::HashString("Takumi");
-        static const int Seoyeon_HASH = HashingUtils::HashString("Seoyeon");
-        static const int Aditi_HASH = HashingUtils::HashString("Aditi");
+        static constexpr int Geraint_HASH = HashingUtils::CompileTimeHashString("Geraint");
+        static constexpr int Gwyneth_HASH = HashingUtils::CompileTimeHashString("Gwyneth");
+        static constexpr int Mads_HASH = HashingUtils::CompileTimeHashString("Mads");
+        static constexpr int Naja_HASH = HashingUtils::CompileTimeHashString("Naja");
+        static constexpr int Hans_HASH = HashingUtils::CompileTimeHashString("Hans");
+        static constexpr int Marlene_HASH = HashingUtils::CompileTimeHashString("Marlene");
+        static constexpr int Nicole_HASH = HashingUtils::CompileTimeHashString("Nicole");
+        static constexpr int Russell_HASH = HashingUtils::CompileTimeHashString("Russell");
+        static constexpr int Amy_HASH = HashingUtils::CompileTimeHashString("Amy");
+        static constexpr int Brian_HASH = HashingUtils::CompileTimeHashString("Brian");
+        static constexpr int Emma_HASH = HashingUtils::CompileTimeHashString("Emma");
+        static constexpr int Raveena_HASH = HashingUtils::CompileTimeHashString("Raveena");
+        static constexpr int Ivy_HASH = HashingUtils::CompileTimeHashString("Ivy");
+        static constexpr int Joanna_HASH = HashingUtils::CompileTimeHashString("Joanna");
+        static constexpr int Joey_HASH = HashingUtils::CompileTimeHashString("Joey");
+        static constexpr int Justin_HASH = HashingUtils::CompileTimeHashString("Justin");
+        static constexpr int Kendra_HASH = HashingUtils::CompileTimeHashString("Kendra");
+        static constexpr int Kimberly_HASH = HashingUtils::CompileTimeHashString("Kimberly");
+        static constexpr int Matthew_HASH = HashingUtils::CompileTimeHashString("Matthew");
+        static constexpr int Salli_HASH = HashingUtils::CompileTimeHashString("Salli");
+        static constexpr int Conchita_HASH = HashingUtils::CompileTimeHashString("Conchita");
+        static constexpr int Enrique_HASH = HashingUtils::CompileTimeHashString("Enrique");
+        static constexpr int Miguel_HASH = HashingUtils::CompileTimeHashString("Miguel");
+        static constexpr int Penelope_HASH = HashingUtils::CompileTimeHashString("Penelope");
+        static constexpr int Chantal_HASH = HashingUtils::CompileTimeHashString("Chantal");
+        static constexpr int Celine_HASH = HashingUtils::CompileTimeHashString("Celine");
+        static constexpr int Lea_HASH = HashingUtils::CompileTimeHashString("Lea");
+        static constexpr int Mathieu_HASH = HashingUtils::CompileTimeHashString("Mathieu");
+        static constexpr int Dora_HASH = HashingUtils::CompileTimeHashString("Dora");
+        static constexpr int Karl_HASH = HashingUtils::CompileTimeHashString("Karl");
+        static constexpr int Carla_HASH = HashingUtils::CompileTimeHashString("Carla");
+        static constexpr int Giorgio_HASH = HashingUtils::CompileTimeHashString("Giorgio");
+        static constexpr int Mizuki_HASH = HashingUtils::CompileTimeHashString("Mizuki");
+        static constexpr int Liv_HASH = HashingUtils::CompileTimeHashString("Liv");
+        static constexpr int Lotte_HASH = HashingUtils::CompileTimeHashString("Lotte");
+        static constexpr int Ruben_HASH = HashingUtils::CompileTimeHashString("Ruben");
+        static constexpr int Ewa_HASH = HashingUtils::CompileTimeHashString("Ewa");
+        static constexpr int Jacek_HASH = HashingUtils::CompileTimeHashString("Jacek");
+        static constexpr int Jan_HASH = HashingUtils::CompileTimeHashString("Jan");
+        static constexpr int Maja_HASH = HashingUtils::CompileTimeHashString("Maja");
+        static constexpr int Ricardo_HASH = HashingUtils::CompileTimeHashString("Ricardo");
+        static constexpr int Vitoria_HASH = HashingUtils::CompileTimeHashString("Vitoria");
+        static constexpr int Cristiano_HASH = HashingUtils::CompileTimeHashString("Cristiano");
+        static constexpr int Ines_HASH = HashingUtils::CompileTimeHashString("Ines");
+        static constexpr int Carmen_HASH = HashingUtils::CompileTimeHashString("Carmen");
+        static constexpr int Maxim_HASH = HashingUtils::CompileTimeHashString("Maxim");
+        static constexpr int Tatyana_HASH = HashingUtils::CompileTimeHashString("Tatyana");
+        static constexpr int Astrid_HASH = HashingUtils::CompileTimeHashString("Astrid");
+        static constexpr int Filiz_HASH = HashingUtils::CompileTimeHashString("Filiz");
+        static constexpr int Vicki_HASH = HashingUtils::CompileTimeHashString("Vicki");
+        static constexpr int Takumi_HASH = HashingUtils::CompileTimeHashString("Takumi");
+        static constexpr int Seoyeon_HASH = HashingUtils::CompileTimeHashString("Seoyeon");
+        static constexpr int Aditi_HASH = HashingUtils::CompileTimeHashString("Aditi");
 
 
         VoiceId GetVoiceIdForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Geraint_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VoiceId::Geraint;
-          }
-          else if (hashCode == Gwyneth_HASH)
-          {
-            return VoiceId::Gwyneth;
-          }
-          else if (hashCode == Mads_HASH)
-          {
-            return VoiceId::Mads;
-          }
-          else if (hashCode == Naja_HASH)
-          {
-            return VoiceId::Naja;
-          }
-          else if (hashCode == Hans_HASH)
-          {
-            return VoiceId::Hans;
-          }
-          else if (hashCode == Marlene_HASH)
-          {
-            return VoiceId::Marlene;
-          }
-          else if (hashCode == Nicole_HASH)
-          {
-            return VoiceId::Nicole;
-          }
-          else if (hashCode == Russell_HASH)
-          {
-            return VoiceId::Russell;
-          }
-          else if (hashCode == Amy_HASH)
-          {
-            return VoiceId::Amy;
-          }
-          else if (hashCode == Brian_HASH)
-          {
-            return VoiceId::Brian;
-          }
-          else if (hashCode == Emma_HASH)
-          {
-            return VoiceId::Emma;
-          }
-          else if (hashCode == Raveena_HASH)
-          {
-            return VoiceId::Raveena;
-          }
-          else if (hashCode == Ivy_HASH)
-          {
-            return VoiceId::Ivy;
-          }
-          else if (hashCode == Joanna_HASH)
-          {
-            return VoiceId::Joanna;
-          }
-          else if (hashCode == Joey_HASH)
-          {
-            return VoiceId::Joey;
-          }
-          else if (hashCode == Justin_HASH)
-          {
-            return VoiceId::Justin;
-          }
-          else if (hashCode == Kendra_HASH)
-          {
-            return VoiceId::Kendra;
-          }
-          else if (hashCode == Kimberly_HASH)
-          {
-            return VoiceId::Kimberly;
-          }
-          else if (hashCode == Matthew_HASH)
-          {
-            return VoiceId::Matthew;
-          }
-          else if (hashCode == Salli_HASH)
-          {
-            return VoiceId::Salli;
-          }
-          else if (hashCode == Conchita_HASH)
-          {
-            return VoiceId::Conchita;
-          }
-          else if (hashCode == Enrique_HASH)
-          {
-            return VoiceId::Enrique;
-          }
-          else if (hashCode == Miguel_HASH)
-          {
-            return VoiceId::Miguel;
-          }
-          else if (hashCode == Penelope_HASH)
-          {
-            return VoiceId::Penelope;
-          }
-          else if (hashCode == Chantal_HASH)
-          {
-            return VoiceId::Chantal;
-          }
-          else if (hashCode == Celine_HASH)
-          {
-            return VoiceId::Celine;
-          }
-          else if (hashCode == Lea_HASH)
-          {
-            return VoiceId::Lea;
-          }
-          else if (hashCode == Mathieu_HASH)
-          {
-            return VoiceId::Mathieu;
-          }
-          else if (hashCode == Dora_HASH)
-          {
-            return VoiceId::Dora;
-          }
-          else if (hashCode == Karl_HASH)
-          {
-            return VoiceId::Karl;
-          }
-          else if (hashCode == Carla_HASH)
-          {
-            return VoiceId::Carla;
-          }
-          else if (hashCode == Giorgio_HASH)
-          {
-            return VoiceId::Giorgio;
-          }
-          else if (hashCode == Mizuki_HASH)
-          {
-            return VoiceId::Mizuki;
-          }
-          else if (hashCode == Liv_HASH)
-          {
-            return VoiceId::Liv;
-          }
-          else if (hashCode == Lotte_HASH)
-          {
-            return VoiceId::Lotte;
-          }
-          else if (hashCode == Ruben_HASH)
-          {
-            return VoiceId::Ruben;
-          }
-          else if (hashCode == Ewa_HASH)
-          {
-            return VoiceId::Ewa;
-          }
-          else if (hashCode == Jacek_HASH)
-          {
-            return VoiceId::Jacek;
-          }
-          else if (hashCode == Jan_HASH)
-          {
-            return VoiceId::Jan;
-          }
-          else if (hashCode == Maja_HASH)
-          {
-            return VoiceId::Maja;
-          }
-          else if (hashCode == Ricardo_HASH)
-          {
-            return VoiceId::Ricardo;
-          }
-          else if (hashCode == Vitoria_HASH)
-          {
-            return VoiceId::Vitoria;
-          }
-          else if (hashCode == Cristiano_HASH)
-          {
-            return VoiceId::Cristiano;
-          }
-          else if (hashCode == Ines_HASH)
-          {
-            return VoiceId::Ines;
-          }
-          else if (hashCode == Carmen_HASH)
-          {
-            return VoiceId::Carmen;
-          }
-          else if (hashCode == Maxim_HASH)
-          {
-            return VoiceId::Maxim;
-          }
-          else if (hashCode == Tatyana_HASH)
-          {
-            return VoiceId::Tatyana;
-          }
-          else if (hashCode == Astrid_HASH)
-          {
-            return VoiceId::Astrid;
-          }
-          else if (hashCode == Filiz_HASH)
-          {
-            return VoiceId::Filiz;
-          }
-          else if (hashCode == Vicki_HASH)
-          {
-            return VoiceId::Vicki;
-          }
-          else if (hashCode == Takumi_HASH)
-          {
-            return VoiceId::Takumi;
-          }
-          else if (hashCode == Seoyeon_HASH)
-          {
-            return VoiceId::Seoyeon;
-          }
-          else if (hashCode == Aditi_HASH)
-          {
-            return VoiceId::Aditi;
+          case Geraint_HASH:
+            if (name == "Geraint")
+            {
+              return VoiceId::Geraint;
+            }
+            break;
+          case Gwyneth_HASH:
+            if (name == "Gwyneth")
+            {
+              return VoiceId::Gwyneth;
+            }
+            break;
+          case Mads_HASH:
+            if (name == "Mads")
+            {
+              return VoiceId::Mads;
+            }
+            break;
+          case Naja_HASH:
+            if (name == "Naja")
+            {
+              return VoiceId::Naja;
+            }
+            break;
+          case Hans_HASH:
+            if (name == "Hans")
+            {
+              return VoiceId::Hans;
+            }
+            break;
+          case Marlene_HASH:
+            if (name == "Marlene")
+            {
+              return VoiceId::Marlene;
+            }
+            break;
+          case Nicole_HASH:
+            if (name == "Nicole")
+            {
+              return VoiceId::Nicole;
+            }
+            break;
+          case Russell_HASH:
+            if (name == "Russell")
+            {
+              return VoiceId::Russell;
+            }
+            break;
+          case Amy_HASH:
+            if (name == "Amy")
+            {
+              return VoiceId::Amy;
+            }
+            break;
+          case Brian_HASH:
+            if (name == "Brian")
+            {
+              return VoiceId::Brian;
+            }
+            break;
+          case Emma_HASH:
+            if (name == "Emma")
+            {
+              return VoiceId::Emma;
+            }
+            break;
+          case Raveena_HASH:
+            if (name == "Raveena")
+            {
+              return VoiceId::Raveena;
+            }
+            break;
+          case Ivy_HASH:
+            if (name == "Ivy")
+            {
+              return VoiceId::Ivy;
+            }
+            break;
+          case Joanna_HASH:
+            if (name == "Joanna")
+            {
+              return VoiceId::Joanna;
+            }
+            break;
+          case Joey_HASH:
+            if (name == "Joey")
+            {
+              return VoiceId::Joey;
+            }
+            break;
+          case Justin_HASH:
+            if (name == "Justin")
+            {
+              return VoiceId::Justin;
+            }
+            break;
+          case Kendra_HASH:
+            if (name == "Kendra")
+            {
+              return VoiceId::Kendra;
+            }
+            break;
+          case Kimberly_HASH:
+            if (name == "Kimberly")
+            {
+              return VoiceId::Kimberly;
+            }
+            break;
+          case Matthew_HASH:
+            if (name == "Matthew")
+            {
+              return VoiceId::Matthew;
+            }
+            break;
+          case Salli_HASH:
+            if (name == "Salli")
+            {
+              return VoiceId::Salli;
+            }
+            break;
+          case Conchita_HASH:
+            if (name == "Conchita")
+            {
+              return VoiceId::Conchita;
+            }
+            break;
+          case Enrique_HASH:
+            if (name == "Enrique")
+            {
+              return VoiceId::Enrique;
+            }
+            break;
+          case Miguel_HASH:
+            if (name == "Miguel")
+            {
+              return VoiceId::Miguel;
+            }
+            break;
+          case Penelope_HASH:
+            if (name == "Penelope")
+            {
+              return VoiceId::Penelope;
+            }
+            break;
+          case Chantal_HASH:
+            if (name == "Chantal")
+            {
+              return VoiceId::Chantal;
+            }
+            break;
+          case Celine_HASH:
+            if (name == "Celine")
+            {
+              return VoiceId::Celine;
+            }
+            break;
+          case Lea_HASH:
+            if (name == "Lea")
+            {
+              return VoiceId::Lea;
+            }
+            break;
+          case Mathieu_HASH:
+            if (name == "Mathieu")
+            {
+              return VoiceId::Mathieu;
+            }
+            break;
+          case Dora_HASH:
+            if (name == "Dora")
+            {
+              return VoiceId::Dora;
+            }
+            break;
+          case Karl_HASH:
+            if (name == "Karl")
+            {
+              return VoiceId::Karl;
+            }
+            break;
+          case Carla_HASH:
+            if (name == "Carla")
+            {
+              return VoiceId::Carla;
+            }
+            break;
+          case Giorgio_HASH:
+            if (name == "Giorgio")
+            {
+              return VoiceId::Giorgio;
+            }
+            break;
+          case Mizuki_HASH:
+            if (name == "Mizuki")
+            {
+              return VoiceId::Mizuki;
+            }
+            break;
+          case Liv_HASH:
+            if (name == "Liv")
+            {
+              return VoiceId::Liv;
+            }
+            break;
+          case Lotte_HASH:
+            if (name == "Lotte")
+            {
+              return VoiceId::Lotte;
+            }
+            break;
+          case Ruben_HASH:
+            if (name == "Ruben")
+            {
+              return VoiceId::Ruben;
+            }
+            break;
+          case Ewa_HASH:
+            if (name == "Ewa")
+            {
+              return VoiceId::Ewa;
+            }
+            break;
+          case Jacek_HASH:
+            if (name == "Jacek")
+            {
+              return VoiceId::Jacek;
+            }
+            break;
+          case Jan_HASH:
+            if (name == "Jan")
+            {
+              return VoiceId::Jan;
+            }
+            break;
+          case Maja_HASH:
+            if (name == "Maja")
+            {
+              return VoiceId::Maja;
+            }
+            break;
+          case Ricardo_HASH:
+            if (name == "Ricardo")
+            {
+              return VoiceId::Ricardo;
+            }
+            break;
+          case Vitoria_HASH:
+            if (name == "Vitoria")
+            {
+              return VoiceId::Vitoria;
+            }
+            break;
+          case Cristiano_HASH:
+            if (name == "Cristiano")
+            {
+              return VoiceId::Cristiano;
+            }
+            break;
+          case Ines_HASH:
+            if (name == "Ines")
+            {
+              return VoiceId::Ines;
+            }
+            break;
+          case Carmen_HASH:
+            if (name == "Carmen")
+            {
+              return VoiceId::Carmen;
+            }
+            break;
+          case Maxim_HASH:
+            if (name == "Maxim")
+            {
+              return VoiceId::Maxim;
+            }
+            break;
+          case Tatyana_HASH:
+            if (name == "Tatyana")
+            {
+              return VoiceId::Tatyana;
+            }
+            break;
+          case Astrid_HASH:
+            if (name == "Astrid")
+            {
+              return VoiceId::Astrid;
+            }
+            break;
+          case Filiz_HASH:
+            if (name == "Filiz")
+            {
+              return VoiceId::Filiz;
+            }
+            break;
+          case Vicki_HASH:
+            if (name == "Vicki")
+            {
+              return VoiceId::Vicki;
+            }
+            break;
+          case Takumi_HASH:
+            if (name == "Takumi")
+            {
+              return VoiceId::Takumi;
+            }
+            break;
+          case Seoyeon_HASH:
+            if (name == "Seoyeon")
+            {
+              return VoiceId::Seoyeon;
+            }
+            break;
+          case Aditi_HASH:
+            if (name == "Aditi")
+            {
+              return VoiceId::Aditi;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -310,7 +422,7 @@ namespace Aws
           return VoiceId::NOT_SET;
         }
 
-        Aws::String GetNameForVoiceId(VoiceId enumValue)
+        const char* GetNameForVoiceId(VoiceId enumValue)
         {
           switch(enumValue)
           {
@@ -424,7 +536,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
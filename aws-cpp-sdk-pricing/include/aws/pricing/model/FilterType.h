@@ -33,7 +33,8 @@ namespace FilterTypeMapper
 {
 AWS_PRICING_API FilterType GetFilterTypeForName(const Aws::String& name);
 
-AWS_PRICING_API Aws::String GetNameForFilterType(FilterType value);
+// names of values not modeled point into the enum overflow container
+AWS_PRICING_API const char* GetNameForFilterType(FilterType value);
 } // namespace FilterTypeMapper
 } // namespace Model
 } // namespace Pricing
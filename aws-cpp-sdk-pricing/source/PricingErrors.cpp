@@ -28,11 +28,11 @@ namespace Pricing
 namespace PricingErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFoundException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int EXPIRED_NEXT_TOKEN_HASH = HashingUtils::HashString("ExpiredNextTokenException");
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalErrorException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFoundException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int EXPIRED_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("ExpiredNextTokenException");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalErrorException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
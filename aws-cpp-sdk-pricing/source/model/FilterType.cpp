@@ -30,15 +30,23 @@ namespace Aws
       namespace FilterTypeMapper
       {
 
-        static const int TERM_MATCH_HASH = HashingUtils::HashString("TERM_MATCH");
+        static constexpr int TERM_MATCH_HASH = HashingUtils::CompileTimeHashString("TERM_MATCH");
 
 
         FilterType GetFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERM_MATCH_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FilterType::TERM_MATCH;
+          case TERM_MATCH_HASH:
+            if (name == "TERM_MATCH")
+            {
+              return FilterType::TERM_MATCH;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return FilterType::NOT_SET;
         }
 
-        Aws::String GetNameForFilterType(FilterType enumValue)
+        const char* GetNameForFilterType(FilterType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -0,0 +1,303 @@
+/*
+  * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/queues/sqs/SQSQueue.h>
+#include <aws/sqs/model/GetQueueUrlRequest.h>
+#include <aws/sqs/model/GetQueueUrlResult.h>
+#include <aws/sqs/model/SendMessageBatchRequest.h>
+#include <aws/sqs/model/SendMessageBatchResult.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchResult.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Queues;
+using namespace Aws::Queues::Sqs;
+using namespace Aws::SQS;
+using namespace Aws::SQS::Model;
+
+static const char* ALLOC_TAG = "SQSQueueTests";
+static const char* QUEUE_NAME = "SQSQueueTestQueue";
+static const char* QUEUE_URL = "https://sqs.us-east-1.amazonaws.com/123456789012/SQSQueueTestQueue";
+
+/**
+ * SQS client holding on to the batch requests it is sent until the test completes them. Entries are failed by body, or receipt handle
+ * for deletes: with the sender at fault every time, or SQS at fault the given number of times.
+ */
+class MockSQSClient : public SQSClient
+{
+public:
+    MockSQSClient() : SQSClient(Aws::Auth::AWSCredentials("", "")) {}
+
+    GetQueueUrlOutcome GetQueueUrl(const GetQueueUrlRequest&) const override
+    {
+        GetQueueUrlResult result;
+        result.SetQueueUrl(QUEUE_URL);
+        return result;
+    }
+
+    void SendMessageBatchAsync(const SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler,
+                               const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_sendRequests.push_back(request);
+        SendMessageBatchResult result;
+        for (const auto& entry : request.GetEntries())
+        {
+            BatchResultErrorEntry error;
+            if (AnswerEntry(entry.GetId(), entry.GetMessageBody(), error))
+            {
+                result.AddSuccessful(SendMessageBatchResultEntry().WithId(entry.GetId()));
+            }
+            else
+            {
+                result.AddFailed(error);
+            }
+        }
+        m_requestsToComplete.push_back([this, request, handler, context, result]() { handler(this, request, SendMessageBatchOutcome(result), context); });
+    }
+
+    void DeleteMessageBatchAsync(const DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler,
+                                 const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        m_deleteRequests.push_back(request);
+        DeleteMessageBatchResult result;
+        for (const auto& entry : request.GetEntries())
+        {
+            BatchResultErrorEntry error;
+            if (AnswerEntry(entry.GetId(), entry.GetReceiptHandle(), error))
+            {
+                result.AddSuccessful(DeleteMessageBatchResultEntry().WithId(entry.GetId()));
+            }
+            else
+            {
+                result.AddFailed(error);
+            }
+        }
+        m_requestsToComplete.push_back([this, request, handler, context, result]() { handler(this, request, DeleteMessageBatchOutcome(result), context); });
+    }
+
+    // calls the handlers of the requests sent so far, returns whether there were any
+    bool CompleteRequests()
+    {
+        Aws::Vector<std::function<void()>> requests;
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            requests.swap(m_requestsToComplete);
+        }
+        for (const auto& request : requests)
+        {
+            request();
+        }
+        return !requests.empty();
+    }
+
+    void CompleteAllRequests()
+    {
+        while (CompleteRequests());
+    }
+
+    Aws::Vector<SendMessageBatchRequest> GetSendRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_sendRequests;
+    }
+
+    Aws::Vector<DeleteMessageBatchRequest> GetDeleteRequests() const
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        return m_deleteRequests;
+    }
+
+    Aws::Set<Aws::String> m_senderFaults;
+    mutable Aws::Map<Aws::String, unsigned> m_serviceFaults;
+
+private:
+    bool AnswerEntry(const Aws::String& id, const Aws::String& key, BatchResultErrorEntry& error) const
+    {
+        if (m_senderFaults.find(key) != m_senderFaults.end())
+        {
+            error = BatchResultErrorEntry().WithId(id).WithSenderFault(true).WithCode("InvalidMessageContents");
+            return false;
+        }
+        auto serviceFault = m_serviceFaults.find(key);
+        if (serviceFault != m_serviceFaults.end() && serviceFault->second > 0)
+        {
+            --serviceFault->second;
+            error = BatchResultErrorEntry().WithId(id).WithSenderFault(false).WithCode("InternalError");
+            return false;
+        }
+        return true;
+    }
+
+    mutable std::mutex m_lock;
+    mutable Aws::Vector<SendMessageBatchRequest> m_sendRequests;
+    mutable Aws::Vector<DeleteMessageBatchRequest> m_deleteRequests;
+    mutable Aws::Vector<std::function<void()>> m_requestsToComplete;
+};
+
+class SQSQueueTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_client = Aws::MakeShared<MockSQSClient>(ALLOC_TAG);
+        m_queue = Aws::MakeShared<SQSQueue>(ALLOC_TAG, m_client, QUEUE_NAME, 30);
+        m_queue->EnsureQueueIsInitialized();
+        // a batch at a time, so the messages pushed while it is in flight go out together
+        m_queue->SetBatchingEnabled(true, 1);
+
+        m_queue->SetMessageSendSuccessEventHandler([this](const Queue<Message>*, const Message& message) { Record(m_sent, message.GetBody()); });
+        m_queue->SetMessageSendFailedEventHandler([this](const Queue<Message>*, const Message& message) { Record(m_sendFailed, message.GetBody()); });
+        m_queue->SetMessageDeleteSuccessEventHandler([this](const Queue<Message>*, const Message& message) { Record(m_deleted, message.GetReceiptHandle()); });
+        m_queue->SetMessageDeleteFailedEventHandler([this](const Queue<Message>*, const Message& message) { Record(m_deleteFailed, message.GetReceiptHandle()); });
+    }
+
+    void TearDown() override
+    {
+        m_client->CompleteAllRequests();
+        m_queue = nullptr;
+        m_client = nullptr;
+    }
+
+    void Record(Aws::Vector<Aws::String>& notified, const Aws::String& value)
+    {
+        std::lock_guard<std::mutex> locker(m_lock);
+        notified.push_back(value);
+    }
+
+    static Message BuildMessage(const Aws::String& body)
+    {
+        Message message;
+        message.SetBody(body);
+        message.SetReceiptHandle(body);
+        return message;
+    }
+
+    std::shared_ptr<MockSQSClient> m_client;
+    std::shared_ptr<SQSQueue> m_queue;
+    std::mutex m_lock;
+    Aws::Vector<Aws::String> m_sent;
+    Aws::Vector<Aws::String> m_sendFailed;
+    Aws::Vector<Aws::String> m_deleted;
+    Aws::Vector<Aws::String> m_deleteFailed;
+};
+
+TEST_F(SQSQueueTest, TestBatchEntriesAreNotifiedForTheirMessages)
+{
+    m_client->m_senderFaults.insert("third");
+    m_queue->Push(BuildMessage("first"));
+    m_queue->Push(BuildMessage("second"));
+    m_queue->Push(BuildMessage("third"));
+    m_queue->Push(BuildMessage("fourth"));
+    m_client->CompleteAllRequests();
+
+    auto requests = m_client->GetSendRequests();
+    ASSERT_EQ(2u, requests.size());
+    ASSERT_EQ(1u, requests[0].GetEntries().size());
+    ASSERT_EQ(3u, requests[1].GetEntries().size());
+    ASSERT_EQ("0", requests[1].GetEntries()[0].GetId());
+    ASSERT_EQ("second", requests[1].GetEntries()[0].GetMessageBody());
+    ASSERT_EQ("2", requests[1].GetEntries()[2].GetId());
+    ASSERT_EQ("fourth", requests[1].GetEntries()[2].GetMessageBody());
+
+    Aws::Vector<Aws::String> expectedSent = { "first", "second", "fourth" };
+    ASSERT_EQ(expectedSent, m_sent);
+    ASSERT_EQ(1u, m_sendFailed.size());
+    ASSERT_EQ("third", m_sendFailed[0]);
+}
+
+TEST_F(SQSQueueTest, TestSendBatchesStayUnderThePayloadLimit)
+{
+    m_queue->Push(BuildMessage("first"));
+    for (char c = 'a'; c < 'd'; ++c)
+    {
+        m_queue->Push(BuildMessage(Aws::String(100 * 1024, c)));
+    }
+    m_client->CompleteAllRequests();
+
+    auto requests = m_client->GetSendRequests();
+    ASSERT_EQ(3u, requests.size());
+    ASSERT_EQ(1u, requests[0].GetEntries().size());
+    ASSERT_EQ(2u, requests[1].GetEntries().size());
+    ASSERT_EQ(1u, requests[2].GetEntries().size());
+    ASSERT_EQ(4u, m_sent.size());
+    ASSERT_TRUE(m_sendFailed.empty());
+}
+
+TEST_F(SQSQueueTest, TestEntriesFailedBySQSAreRetried)
+{
+    m_client->m_serviceFaults["second"] = 1;
+    m_queue->Delete(BuildMessage("first"));
+    m_queue->Delete(BuildMessage("second"));
+    m_queue->Delete(BuildMessage("third"));
+    m_client->CompleteAllRequests();
+
+    auto requests = m_client->GetDeleteRequests();
+    ASSERT_EQ(3u, requests.size());
+    ASSERT_EQ(2u, requests[1].GetEntries().size());
+    ASSERT_EQ(1u, requests[2].GetEntries().size());
+    ASSERT_EQ("0", requests[2].GetEntries()[0].GetId());
+    ASSERT_EQ("second", requests[2].GetEntries()[0].GetReceiptHandle());
+
+    Aws::Vector<Aws::String> expectedDeleted = { "first", "third", "second" };
+    ASSERT_EQ(expectedDeleted, m_deleted);
+    ASSERT_TRUE(m_deleteFailed.empty());
+}
+
+TEST_F(SQSQueueTest, TestEntriesFailedBySQSFailAfterTheirLastAttempt)
+{
+    m_client->m_serviceFaults["first"] = 10;
+    m_queue->Push(BuildMessage("first"));
+    m_client->CompleteAllRequests();
+
+    ASSERT_EQ(3u, m_client->GetSendRequests().size());
+    ASSERT_TRUE(m_sent.empty());
+    ASSERT_EQ(1u, m_sendFailed.size());
+    ASSERT_EQ("first", m_sendFailed[0]);
+}
+
+TEST_F(SQSQueueTest, TestFlushBatchesWaitsForBatchesInFlight)
+{
+    m_queue->Push(BuildMessage("first"));
+    m_queue->Push(BuildMessage("second"));
+    m_queue->Delete(BuildMessage("third"));
+
+    std::atomic<bool> flushed(false);
+    std::thread flusher([this, &flushed]()
+    {
+        m_queue->FlushBatches();
+        flushed = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(flushed);
+    // the first push and the delete complete, the second push is sent
+    EXPECT_TRUE(m_client->CompleteRequests());
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(flushed);
+    m_client->CompleteAllRequests();
+    flusher.join();
+
+    ASSERT_TRUE(flushed);
+    ASSERT_EQ(2u, m_sent.size());
+    ASSERT_EQ(1u, m_deleted.size());
+}
@@ -15,10 +15,15 @@
 #pragma once
 
 #include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <aws/queues/Queues_EXPORTS.h>
 #include <thread>
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 
 namespace Aws
 {
@@ -47,7 +52,7 @@ namespace Aws
              * upon completion of the existing poll, this value is useful only if you intend to use this instance for the asynchronous polling model.
              */
             Queue(unsigned pollingFrequency) :
-                    m_continue(true), m_pollingFrequencyMs(pollingFrequency), m_pollingThread(nullptr)
+                    m_continue(true), m_pollingFrequencyMs(pollingFrequency), m_pollerCount(1), m_maxMessagesPerPoll(1), m_handlersInFlight(0)
             {
             }
 
@@ -61,35 +66,74 @@ namespace Aws
             virtual void Push(const MESSAGE_TYPE&) = 0;
 
             /**
-             * Starts a polling thread in the background. You will need to register OnMessageReceived
+             * Returns up to maxMessages messages, blocking like Top() until there is at least one. The default implementation returns Top().
+             * Implementations return an empty vector if there is nothing to return, e.g. because polling was stopped.
+             */
+            virtual Aws::Vector<MESSAGE_TYPE> TopBatch(size_t /*maxMessages*/) const
+            {
+                Aws::Vector<MESSAGE_TYPE> messages;
+                messages.push_back(Top());
+                return messages;
+            }
+
+            /**
+             * Starts polling threads in the background. You will need to register OnMessageReceived
              * to receive the messages. This method can be called after StopPolling to resume polling after
              * being paused.
              */
             void StartPolling()
             {
-                if(!m_pollingThread)
+                if(m_pollingThreads.empty())
                 {
                     m_continue = true;
-                    m_pollingThread = Aws::MakeUnique<std::thread>(MEM_TAG, &Queue::Main, this);
+                    for (size_t i = 0; i < m_pollerCount; ++i)
+                    {
+                        m_pollingThreads.push_back(Aws::MakeUnique<std::thread>(MEM_TAG, &Queue::Main, this));
+                    }
                 }
             }
 
             /**
-             * Stops the polling thread. Messages in transit will be handled before termination of the thread.
-             * Will be called by the destructor so only call this if you want control over when the thread exits.
-             * This method blocks waiting on the polling thread to stop. After being called, the StartPolling() method
-             * can be called, and the thread will resume.
+             * Stops the polling threads. Messages in transit will be handled before termination of the threads, including those dispatched
+             * to the handler executor. Will be called by the destructor so only call this if you want control over when the threads exit.
+             * This method blocks waiting on the polling threads to stop. After being called, the StartPolling() method
+             * can be called, and the threads will resume.
              */
             void StopPolling()
             {
                 m_continue = false;
-                if(m_pollingThread)
+                for (auto& pollingThread : m_pollingThreads)
                 {
-                    m_pollingThread->join();
-                    m_pollingThread = nullptr;
+                    pollingThread->join();
                 }
+                m_pollingThreads.clear();
+
+                std::unique_lock<std::mutex> locker(m_handlersLock);
+                m_handlersDone.wait(locker, [this]() { return m_handlersInFlight == 0; });
             }
 
+            /**
+             * Number of threads StartPolling() starts, each running its own poll loop. Defaults to 1. Takes effect on the next call to StartPolling().
+             */
+            inline void SetPollerCount(size_t pollerCount) { m_pollerCount = (std::max)(pollerCount, static_cast<size_t>(1)); }
+            inline size_t GetPollerCount() const { return m_pollerCount; }
+
+            /**
+             * Maximum number of messages each poll asks for through TopBatch(). Defaults to 1.
+             * While polls return as many messages as asked for, which means more are likely waiting, and this is greater than 1,
+             * the next poll starts right away instead of waiting for the polling frequency.
+             */
+            inline void SetMaxMessagesPerPoll(size_t maxMessages) { m_maxMessagesPerPoll = (std::max)(maxMessages, static_cast<size_t>(1)); }
+            inline size_t GetMaxMessagesPerPoll() const { return m_maxMessagesPerPoll; }
+
+            /**
+             * By default, the received handler runs on the polling thread, one message after the other.
+             * With an executor, the handler of every message received is submitted to it, and the polling thread carries on polling.
+             * A polling thread waits for handlers to finish before polling again once there are more handlers pending than one full poll per poller,
+             * so that messages don't sit in the executor until their visibility timeout expires. Set before calling StartPolling().
+             */
+            inline void SetMessageHandlerExecutor(const std::shared_ptr<Aws::Utils::Threading::Executor>& executor) { m_handlerExecutor = executor; }
+
             inline void SetMessageReceivedEventHandler(const MessageReceivedEventHandler& messageHandler) { m_messageReceivedHandler = messageHandler; }
             inline void SetMessageDeleteFailedEventHandler(const MessageDeleteFailedEventHandler& messageHandler) { m_messageDeleteFailedHandler = messageHandler; }
             inline void SetMessageDeleteSuccessEventHandler(const MessageDeleteSuccessEventHandler& messageHandler) { m_messageDeleteSuccessHandler = messageHandler; }
@@ -116,22 +160,39 @@ namespace Aws
             {
                 while(m_continue)
                 {
-                    auto start = std::chrono::system_clock::now();
-                    MESSAGE_TYPE topMessage = Top();
-                    bool deleteMessage = false;
-                    
-                    auto& receivedHandler = GetMessageReceivedEventHandler();
-                    if (receivedHandler)
+                    WaitForHandlers();
+                    if (!m_continue)
                     {
-                        receivedHandler(this, topMessage, deleteMessage);
+                        break;
                     }
 
-                    if (deleteMessage)
+                    auto start = std::chrono::system_clock::now();
+                    size_t maxMessages = m_maxMessagesPerPoll;
+                    Aws::Vector<MESSAGE_TYPE> messages = TopBatch(maxMessages);
+
+                    for (const auto& message : messages)
                     {
-                        Delete(topMessage);
+                        if (m_handlerExecutor)
+                        {
+                            {
+                                std::lock_guard<std::mutex> locker(m_handlersLock);
+                                ++m_handlersInFlight;
+                            }
+                            m_handlerExecutor->Submit([this, message]()
+                            {
+                                HandleMessage(message);
+                                std::lock_guard<std::mutex> locker(m_handlersLock);
+                                --m_handlersInFlight;
+                                m_handlersDone.notify_all();
+                            });
+                        }
+                        else
+                        {
+                            HandleMessage(message);
+                        }
                     }
 
-                    if(m_continue)
+                    if(m_continue && (maxMessages == 1 || messages.size() < maxMessages))
                     {
                         auto stop = std::chrono::system_clock::now();
                         auto timeTaken = std::chrono::duration_cast<std::chrono::milliseconds>(stop - start);
@@ -144,8 +205,39 @@ namespace Aws
                 }
             }
 
+            void HandleMessage(const MESSAGE_TYPE& message)
+            {
+                bool deleteMessage = false;
+
+                auto& receivedHandler = GetMessageReceivedEventHandler();
+                if (receivedHandler)
+                {
+                    receivedHandler(this, message, deleteMessage);
+                }
+
+                if (deleteMessage)
+                {
+                    Delete(message);
+                }
+            }
+
+            void WaitForHandlers()
+            {
+                if (m_handlerExecutor)
+                {
+                    std::unique_lock<std::mutex> locker(m_handlersLock);
+                    m_handlersDone.wait(locker, [this]() { return !m_continue || m_handlersInFlight <= m_pollerCount * m_maxMessagesPerPoll; });
+                }
+            }
+
             unsigned m_pollingFrequencyMs;
-            Aws::UniquePtr<std::thread> m_pollingThread;
+            size_t m_pollerCount;
+            std::atomic<size_t> m_maxMessagesPerPoll;
+            Aws::Vector<Aws::UniquePtr<std::thread>> m_pollingThreads;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_handlerExecutor;
+            std::mutex m_handlersLock;
+            std::condition_variable m_handlersDone;
+            size_t m_handlersInFlight;
 
             // Handlers
             MessageReceivedEventHandler m_messageReceivedHandler;
@@ -20,6 +20,8 @@
 #include <memory>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/sqs/SQSClient.h>
+#include <condition_variable>
+#include <mutex>
 
 namespace Aws
 {
@@ -29,6 +31,8 @@ namespace Aws
         {
             class DeleteMessageRequest;
             class SendMessageRequest;
+            class DeleteMessageBatchRequest;
+            class SendMessageBatchRequest;
         }
     }
 
@@ -36,8 +40,19 @@ namespace Aws
     {
         namespace Sqs
         {
+            /**
+             * Default number of DeleteMessageBatch and of SendMessageBatch requests an SQSQueue has in flight at a time with batching enabled.
+             */
+            static const size_t DEFAULT_MAX_BATCHES_IN_FLIGHT = 4;
+
+            class QueueBatchContext;
+
             /**
              * SQS implementation of the Queue interface. See Queue documentation for more details.
+             *
+             * For high throughput, receive up to 10 messages per poll with SetMaxMessagesPerPoll() and a longer SetWaitTimeSeconds(), poll with several
+             * threads with SetPollerCount(), run the handlers on an executor with SetMessageHandlerExecutor(), and enable batching of deletes and pushes
+             * with SetBatchingEnabled().
              */
             class AWS_QUEUES_API SQSQueue : public Queue<Aws::SQS::Model::Message>
             {
@@ -86,11 +101,22 @@ namespace Aws
                  */
                 SQSQueue(const std::shared_ptr<SQS::SQSClient>& client, const char* queueName, unsigned visibilityTimeout, unsigned pollingFrequencyMs = 10000);
 
+                /**
+                 * Stops polling and waits for batched deletes and pushes to complete.
+                 */
+                ~SQSQueue();
+
                 /**
                  * Will continue polling until a message is received or StopPolling is called.
                  */
                 Aws::SQS::Model::Message Top() const override;
 
+                /**
+                 * Will continue polling until at least one message is received or StopPolling is called, and returns up to maxMessages of them,
+                 * at most 10 as that's what a ReceiveMessage request returns.
+                 */
+                Aws::Vector<Aws::SQS::Model::Message> TopBatch(size_t maxMessages) const override;
+
                 /**
                  * Does not block. Register for notifications of success or failure with the appropriate handlers.
                  */
@@ -101,6 +127,26 @@ namespace Aws
                  */
                 void Push(const  Aws::SQS::Model::Message&) override;
 
+                /**
+                 * How long, in seconds, each ReceiveMessage request waits for messages to arrive. Defaults to 1, at most 20.
+                 */
+                inline void SetWaitTimeSeconds(unsigned waitTimeSeconds) { m_waitTimeSeconds = waitTimeSeconds; }
+                inline unsigned GetWaitTimeSeconds() const { return m_waitTimeSeconds; }
+
+                /**
+                 * With batching, Delete() and Push() send DeleteMessageBatch and SendMessageBatch requests of up to 10 messages instead of a request per message.
+                 * A batch is sent as soon as fewer than maxBatchesInFlight batches of its kind are in flight, so messages only wait for each other
+                 * while that many requests are outstanding and latency stays low when there is little traffic.
+                 * Handlers are still notified per message. Entries of a batch that SQS fails without it being the sender's fault are sent again
+                 * in a batch of their own, a few times, before their failed handler is called. Off by default.
+                 */
+                void SetBatchingEnabled(bool batching, size_t maxBatchesInFlight = DEFAULT_MAX_BATCHES_IN_FLIGHT);
+
+                /**
+                 * Blocks until all batched deletes and pushes have been sent and their handlers notified.
+                 */
+                void FlushBatches();
+
                 /**
                 * Does not block. Register for notifications of success or failure with the appropriate handlers.
                 */
@@ -119,6 +165,32 @@ namespace Aws
                 Aws::String m_queueUrl;
                 Aws::String m_queueName;
                 unsigned m_visibilityTimeout;
+                std::atomic<unsigned> m_waitTimeSeconds;
+
+                std::mutex m_batchLock;
+                std::condition_variable m_batchesDone;
+                bool m_batching;
+                size_t m_maxBatchesInFlight;
+                Aws::Vector<Aws::SQS::Model::Message> m_pendingDeletes;
+                Aws::Vector<Aws::SQS::Model::Message> m_pendingPushes;
+                size_t m_deleteBatchesInFlight;
+                size_t m_pushBatchesInFlight;
+
+                /**
+                 * Sends pending messages while there are fewer than m_maxBatchesInFlight batches of the kind in flight,
+                 * after accounting for the batch that completed, if any.
+                 */
+                void SendDeleteBatches(bool batchCompleted = false);
+                void SendPushBatches(bool batchCompleted = false);
+
+                void SendDeleteBatch(const std::shared_ptr<QueueBatchContext>& batch);
+                void SendPushBatch(const std::shared_ptr<QueueBatchContext>& batch);
+
+                void OnMessageDeleteBatchOutcomeReceived(const SQS::SQSClient*, const SQS::Model::DeleteMessageBatchRequest&,
+                                                         const SQS::Model::DeleteMessageBatchOutcome&, const std::shared_ptr<const Client::AsyncCallerContext>&);
+
+                void OnMessageSendBatchOutcomeReceived(const SQS::SQSClient*, const SQS::Model::SendMessageBatchRequest&,
+                                                       const SQS::Model::SendMessageBatchOutcome&, const std::shared_ptr<const Client::AsyncCallerContext>&);
 
                 void OnMessageDeletedOutcomeReceived(const SQS::SQSClient*, const SQS::Model::DeleteMessageRequest&,
                                                      const SQS::Model::DeleteMessageOutcome& deleteMessageOutcome, const std::shared_ptr<const Client::AsyncCallerContext>&);
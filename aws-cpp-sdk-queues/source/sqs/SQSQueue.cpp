@@ -17,12 +17,15 @@
 #include <aws/sqs/model/ReceiveMessageRequest.h>
 #include <aws/sqs/model/DeleteMessageRequest.h>
 #include <aws/sqs/model/SendMessageRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/sqs/model/SendMessageBatchRequest.h>
 #include <aws/sqs/model/GetQueueUrlRequest.h>
 #include <aws/sqs/model/GetQueueAttributesRequest.h>
 #include <aws/sqs/model/CreateQueueRequest.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/logging/LogSystemInterface.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/StringUtils.h>
 
 #include <algorithm>
 
@@ -33,6 +36,12 @@ using namespace Aws::Client;
 
 static const char* CLASS_TAG = "Aws::Queues::Sqs::SQSQueue";
 static const int QUEUE_DELETED_RECENTLY_WAIT_TIME = 10;
+// limits of ReceiveMessage and of the batch requests
+static const size_t MAX_MESSAGES_PER_REQUEST = 10;
+static const unsigned MAX_WAIT_TIME_SECONDS = 20;
+static const size_t MAX_BATCH_PAYLOAD_SIZE = 256 * 1024;
+// entries SQS failed on its side are sent up to this many times
+static const unsigned MAX_BATCH_ENTRY_ATTEMPTS = 3;
 
 class QueueMessageContext : public AsyncCallerContext
 {
@@ -45,33 +54,118 @@ private:
     Message m_message;
 };
 
+namespace Aws
+{
+    namespace Queues
+    {
+        namespace Sqs
+        {
+            /**
+             * Messages of a batch request, entry ids are their index. Attempt is how many times the messages have been sent.
+             */
+            class QueueBatchContext : public AsyncCallerContext
+            {
+            public:
+                QueueBatchContext(Aws::Vector<Message>&& messages, unsigned attempt = 1) : m_messages(std::move(messages)), m_attempt(attempt) {}
+
+                const Aws::Vector<Message>& GetMessages() const { return m_messages; }
+                unsigned GetAttempt() const { return m_attempt; }
+
+                const Message* GetMessage(const Aws::String& id) const
+                {
+                    size_t index = static_cast<size_t>(Aws::Utils::StringUtils::ConvertToInt32(id.c_str()));
+                    return index < m_messages.size() ? &m_messages[index] : nullptr;
+                }
+
+            private:
+                Aws::Vector<Message> m_messages;
+                unsigned m_attempt;
+            };
+        }
+    }
+}
+
+// what counts against the payload limit of SendMessageBatch
+static size_t GetPayloadSize(const Message& message)
+{
+    size_t size = message.GetBody().size();
+    for (const auto& attribute : message.GetMessageAttributes())
+    {
+        size += attribute.first.size() + attribute.second.GetDataType().size() + attribute.second.GetStringValue().size() +
+            attribute.second.GetBinaryValue().GetLength();
+    }
+    return size;
+}
+
+// takes the next batch off pending, the payload of batches of sends is limited
+static Aws::Vector<Message> TakeBatch(Aws::Vector<Message>& pending, bool limitPayload)
+{
+    size_t count = 0;
+    size_t payloadSize = 0;
+    while (count < pending.size() && count < MAX_MESSAGES_PER_REQUEST)
+    {
+        payloadSize += limitPayload ? GetPayloadSize(pending[count]) : 0;
+        if (count > 0 && payloadSize > MAX_BATCH_PAYLOAD_SIZE)
+        {
+            break;
+        }
+        ++count;
+    }
+
+    Aws::Vector<Message> batch(pending.begin(), pending.begin() + count);
+    pending.erase(pending.begin(), pending.begin() + count);
+    return batch;
+}
+
 SQSQueue::SQSQueue(const std::shared_ptr<SQSClient>& client, const char* queueName, unsigned visibilityTimeout,
                    unsigned pollingFrequencyMs) :
    Queue(pollingFrequencyMs),
    m_client(client),
    m_queueName(queueName),
-   m_visibilityTimeout(visibilityTimeout)
+   m_visibilityTimeout(visibilityTimeout),
+   m_waitTimeSeconds(1),
+   m_batching(false),
+   m_maxBatchesInFlight(DEFAULT_MAX_BATCHES_IN_FLIGHT),
+   m_deleteBatchesInFlight(0),
+   m_pushBatchesInFlight(0)
+{
+}
+
+SQSQueue::~SQSQueue()
 {
+    // the pollers and the batch handlers use this instance
+    StopPolling();
+    FlushBatches();
 }
 
 Message SQSQueue::Top() const
+{
+    Aws::Vector<Message> messages = TopBatch(1);
+    return messages.empty() ? Message() : messages.front();
+}
+
+Aws::Vector<Message> SQSQueue::TopBatch(size_t maxMessages) const
 {
     if(IsInitialized())
     {
+        int maxNumberOfMessages = static_cast<int>((std::min)((std::max)(maxMessages, static_cast<size_t>(1)), MAX_MESSAGES_PER_REQUEST));
+        int waitTimeSeconds = static_cast<int>((std::min)(m_waitTimeSeconds.load(), MAX_WAIT_TIME_SECONDS));
+
         while (m_continue)
         {
-            AWS_LOGSTREAM_TRACE(CLASS_TAG, "Polling for new message with timeout of 1 second with a maximum of 1 message.");
+            AWS_LOGSTREAM_TRACE(CLASS_TAG, "Polling for new message with timeout of " << waitTimeSeconds << " seconds with a maximum of "
+                                           << maxNumberOfMessages << " messages.");
             ReceiveMessageRequest receiveMessageRequest;
-            receiveMessageRequest.SetMaxNumberOfMessages(1);
+            receiveMessageRequest.SetMaxNumberOfMessages(maxNumberOfMessages);
             receiveMessageRequest.SetQueueUrl(m_queueUrl);
             receiveMessageRequest.SetVisibilityTimeout(m_visibilityTimeout);
-            receiveMessageRequest.SetWaitTimeSeconds(1);
+            receiveMessageRequest.SetWaitTimeSeconds(waitTimeSeconds);
 
             ReceiveMessageOutcome receiveMessageOutcome = m_client->ReceiveMessage(receiveMessageRequest);
             if (receiveMessageOutcome.IsSuccess() && receiveMessageOutcome.GetResult().GetMessages().size() > 0)
             {
-                AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Message found, returning");
-                return receiveMessageOutcome.GetResult().GetMessages()[0];
+                AWS_LOGSTREAM_DEBUG(CLASS_TAG, receiveMessageOutcome.GetResult().GetMessages().size() << " messages found, returning");
+                return receiveMessageOutcome.GetResult().GetMessages();
             }
             else if (!receiveMessageOutcome.IsSuccess())
             {
@@ -87,13 +181,28 @@ Message SQSQueue::Top() const
         AWS_LOGSTREAM_ERROR(CLASS_TAG, "Queue is not initialized, not polling. Call EnsureQueueIsInitialized before calling this method.");
     }
 
-    return Message();
+    return Aws::Vector<Message>();
 }
 
 void SQSQueue::Delete(const Message& message)
 {
     if(IsInitialized())
     {
+        bool batched = false;
+        {
+            std::lock_guard<std::mutex> locker(m_batchLock);
+            if (m_batching)
+            {
+                m_pendingDeletes.push_back(message);
+                batched = true;
+            }
+        }
+        if (batched)
+        {
+            SendDeleteBatches();
+            return;
+        }
+
         AWS_LOGSTREAM_TRACE(CLASS_TAG, "Deleting message " << message.GetReceiptHandle() << ". From queue " << m_queueUrl);
         DeleteMessageRequest deleteMessageRequest;
         deleteMessageRequest.SetQueueUrl(m_queueUrl);
@@ -113,6 +222,21 @@ void SQSQueue::Push(const Message& message)
 {
    if(IsInitialized())
    {
+       bool batched = false;
+       {
+           std::lock_guard<std::mutex> locker(m_batchLock);
+           if (m_batching)
+           {
+               m_pendingPushes.push_back(message);
+               batched = true;
+           }
+       }
+       if (batched)
+       {
+           SendPushBatches();
+           return;
+       }
+
        AWS_LOGSTREAM_TRACE(CLASS_TAG, "Sending message to " << m_queueUrl);
        SendMessageRequest sendMessageRequest;
        sendMessageRequest.SetQueueUrl(m_queueUrl);
@@ -130,6 +254,110 @@ void SQSQueue::Push(const Message& message)
    }
 }
 
+void SQSQueue::SetBatchingEnabled(bool batching, size_t maxBatchesInFlight)
+{
+    AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Setting batching " << (batching ? "on" : "off") << " with " << maxBatchesInFlight << " batches in flight.");
+    {
+        std::lock_guard<std::mutex> locker(m_batchLock);
+        m_batching = batching;
+        m_maxBatchesInFlight = (std::max)(maxBatchesInFlight, static_cast<size_t>(1));
+    }
+    SendDeleteBatches();
+    SendPushBatches();
+}
+
+void SQSQueue::FlushBatches()
+{
+    std::unique_lock<std::mutex> locker(m_batchLock);
+    m_batchesDone.wait(locker, [this]()
+    {
+        return m_pendingDeletes.empty() && m_pendingPushes.empty() && m_deleteBatchesInFlight == 0 && m_pushBatchesInFlight == 0;
+    });
+}
+
+void SQSQueue::SendDeleteBatches(bool batchCompleted)
+{
+    Aws::Vector<std::shared_ptr<QueueBatchContext>> batches;
+    {
+        // FlushBatches() may return, and this instance go away, as soon as the lock is released, unless more batches are sent
+        std::lock_guard<std::mutex> locker(m_batchLock);
+        if (batchCompleted)
+        {
+            --m_deleteBatchesInFlight;
+            m_batchesDone.notify_all();
+        }
+        while (!m_pendingDeletes.empty() && m_deleteBatchesInFlight < m_maxBatchesInFlight)
+        {
+            batches.push_back(Aws::MakeShared<QueueBatchContext>(CLASS_TAG, TakeBatch(m_pendingDeletes, false)));
+            ++m_deleteBatchesInFlight;
+        }
+    }
+
+    for (const auto& batch : batches)
+    {
+        SendDeleteBatch(batch);
+    }
+}
+
+void SQSQueue::SendDeleteBatch(const std::shared_ptr<QueueBatchContext>& batch)
+{
+    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Deleting batch of " << batch->GetMessages().size() << " messages from queue " << m_queueUrl);
+    DeleteMessageBatchRequest deleteMessageBatchRequest;
+    deleteMessageBatchRequest.SetQueueUrl(m_queueUrl);
+    for (size_t i = 0; i < batch->GetMessages().size(); ++i)
+    {
+        DeleteMessageBatchRequestEntry entry;
+        entry.SetId(Aws::Utils::StringUtils::to_string(i));
+        entry.SetReceiptHandle(batch->GetMessages()[i].GetReceiptHandle());
+        deleteMessageBatchRequest.AddEntries(entry);
+    }
+
+    m_client->DeleteMessageBatchAsync(deleteMessageBatchRequest, std::bind(&SQSQueue::OnMessageDeleteBatchOutcomeReceived, this, std::placeholders::_1,
+                                                                           std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), batch);
+}
+
+void SQSQueue::SendPushBatches(bool batchCompleted)
+{
+    Aws::Vector<std::shared_ptr<QueueBatchContext>> batches;
+    {
+        // FlushBatches() may return, and this instance go away, as soon as the lock is released, unless more batches are sent
+        std::lock_guard<std::mutex> locker(m_batchLock);
+        if (batchCompleted)
+        {
+            --m_pushBatchesInFlight;
+            m_batchesDone.notify_all();
+        }
+        while (!m_pendingPushes.empty() && m_pushBatchesInFlight < m_maxBatchesInFlight)
+        {
+            batches.push_back(Aws::MakeShared<QueueBatchContext>(CLASS_TAG, TakeBatch(m_pendingPushes, true)));
+            ++m_pushBatchesInFlight;
+        }
+    }
+
+    for (const auto& batch : batches)
+    {
+        SendPushBatch(batch);
+    }
+}
+
+void SQSQueue::SendPushBatch(const std::shared_ptr<QueueBatchContext>& batch)
+{
+    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Sending batch of " << batch->GetMessages().size() << " messages to " << m_queueUrl);
+    SendMessageBatchRequest sendMessageBatchRequest;
+    sendMessageBatchRequest.SetQueueUrl(m_queueUrl);
+    for (size_t i = 0; i < batch->GetMessages().size(); ++i)
+    {
+        SendMessageBatchRequestEntry entry;
+        entry.SetId(Aws::Utils::StringUtils::to_string(i));
+        entry.SetMessageBody(batch->GetMessages()[i].GetBody());
+        entry.SetMessageAttributes(batch->GetMessages()[i].GetMessageAttributes());
+        sendMessageBatchRequest.AddEntries(entry);
+    }
+
+    m_client->SendMessageBatchAsync(sendMessageBatchRequest, std::bind(&SQSQueue::OnMessageSendBatchOutcomeReceived, this, std::placeholders::_1,
+                                                                       std::placeholders::_2, std::placeholders::_3, std::placeholders::_4), batch);
+}
+
 void SQSQueue::RequestArn()
 {
     if (IsInitialized())
@@ -251,6 +479,126 @@ void SQSQueue::OnMessageSentOutcomeReceived(const SQSClient*, const SendMessageR
     }
 }
 
+void SQSQueue::OnMessageDeleteBatchOutcomeReceived(const SQSClient*, const DeleteMessageBatchRequest&,
+                                                   const DeleteMessageBatchOutcome& deleteMessageBatchOutcome, const std::shared_ptr<const AsyncCallerContext>& context)
+{
+    auto batchContext = std::static_pointer_cast<const QueueBatchContext>(context);
+    auto& deleteFailed = GetMessageDeleteFailedEventHandler();
+    auto& deleteSuccess = GetMessageDeleteSuccessEventHandler();
+
+    if (!deleteMessageBatchOutcome.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Delete message batch failed with error: " << deleteMessageBatchOutcome.GetError().GetExceptionName() <<
+                                     " and message: " << deleteMessageBatchOutcome.GetError().GetMessage());
+        if (deleteFailed)
+        {
+            for (const auto& message : batchContext->GetMessages())
+            {
+                deleteFailed(this, message);
+            }
+        }
+    }
+    else
+    {
+        AWS_LOGSTREAM_TRACE(CLASS_TAG, "Message batch deleted, " << deleteMessageBatchOutcome.GetResult().GetFailed().size() << " messages failed.");
+        for (const auto& entry : deleteMessageBatchOutcome.GetResult().GetSuccessful())
+        {
+            const Message* message = batchContext->GetMessage(entry.GetId());
+            if (message && deleteSuccess)
+            {
+                deleteSuccess(this, *message);
+            }
+        }
+
+        Aws::Vector<Message> retries;
+        for (const auto& entry : deleteMessageBatchOutcome.GetResult().GetFailed())
+        {
+            const Message* message = batchContext->GetMessage(entry.GetId());
+            if (message && !entry.GetSenderFault() && batchContext->GetAttempt() < MAX_BATCH_ENTRY_ATTEMPTS)
+            {
+                AWS_LOGSTREAM_WARN(CLASS_TAG, "Delete message failed with error: " << entry.GetCode() << " and message: " << entry.GetMessage() << ", retrying.");
+                retries.push_back(*message);
+                continue;
+            }
+
+            AWS_LOGSTREAM_ERROR(CLASS_TAG, "Delete message failed with error: " << entry.GetCode() << " and message: " << entry.GetMessage());
+            if (message && deleteFailed)
+            {
+                deleteFailed(this, *message);
+            }
+        }
+
+        // the retry takes the place of the batch that completed, it stays in flight
+        if (!retries.empty())
+        {
+            SendDeleteBatch(Aws::MakeShared<QueueBatchContext>(CLASS_TAG, std::move(retries), batchContext->GetAttempt() + 1));
+            return;
+        }
+    }
+
+    SendDeleteBatches(true);
+}
+
+void SQSQueue::OnMessageSendBatchOutcomeReceived(const SQSClient*, const SendMessageBatchRequest&,
+                                                 const SendMessageBatchOutcome& sendMessageBatchOutcome, const std::shared_ptr<const AsyncCallerContext>& context)
+{
+    auto batchContext = std::static_pointer_cast<const QueueBatchContext>(context);
+    auto& sendFailed = GetMessageSendFailedEventHandler();
+    auto& sendSuccess = GetMessageSendSuccessEventHandler();
+
+    if (!sendMessageBatchOutcome.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(CLASS_TAG, "Send message batch failed with error: " << sendMessageBatchOutcome.GetError().GetExceptionName() <<
+                                     " and message: " << sendMessageBatchOutcome.GetError().GetMessage());
+        if (sendFailed)
+        {
+            for (const auto& message : batchContext->GetMessages())
+            {
+                sendFailed(this, message);
+            }
+        }
+    }
+    else
+    {
+        AWS_LOGSTREAM_TRACE(CLASS_TAG, "Message batch sent, " << sendMessageBatchOutcome.GetResult().GetFailed().size() << " messages failed.");
+        for (const auto& entry : sendMessageBatchOutcome.GetResult().GetSuccessful())
+        {
+            const Message* message = batchContext->GetMessage(entry.GetId());
+            if (message && sendSuccess)
+            {
+                sendSuccess(this, *message);
+            }
+        }
+
+        Aws::Vector<Message> retries;
+        for (const auto& entry : sendMessageBatchOutcome.GetResult().GetFailed())
+        {
+            const Message* message = batchContext->GetMessage(entry.GetId());
+            if (message && !entry.GetSenderFault() && batchContext->GetAttempt() < MAX_BATCH_ENTRY_ATTEMPTS)
+            {
+                AWS_LOGSTREAM_WARN(CLASS_TAG, "Send message failed with error: " << entry.GetCode() << " and message: " << entry.GetMessage() << ", retrying.");
+                retries.push_back(*message);
+                continue;
+            }
+
+            AWS_LOGSTREAM_ERROR(CLASS_TAG, "Send message failed with error: " << entry.GetCode() << " and message: " << entry.GetMessage());
+            if (message && sendFailed)
+            {
+                sendFailed(this, *message);
+            }
+        }
+
+        // the retry takes the place of the batch that completed, it stays in flight
+        if (!retries.empty())
+        {
+            SendPushBatch(Aws::MakeShared<QueueBatchContext>(CLASS_TAG, std::move(retries), batchContext->GetAttempt() + 1));
+            return;
+        }
+    }
+
+    SendPushBatches(true);
+}
+
 void SQSQueue::OnGetQueueAttributesOutcomeReceived(const SQSClient*, const GetQueueAttributesRequest& request,
 						   const GetQueueAttributesOutcome& getQueueAttributeOutcome, const std::shared_ptr<const AsyncCallerContext>&)
 {
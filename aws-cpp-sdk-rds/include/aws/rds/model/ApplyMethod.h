@@ -34,7 +34,8 @@ namespace ApplyMethodMapper
 {
 AWS_RDS_API ApplyMethod GetApplyMethodForName(const Aws::String& name);
 
-AWS_RDS_API Aws::String GetNameForApplyMethod(ApplyMethod value);
+// names of values not modeled point into the enum overflow container
+AWS_RDS_API const char* GetNameForApplyMethod(ApplyMethod value);
 } // namespace ApplyMethodMapper
 } // namespace Model
 } // namespace RDS
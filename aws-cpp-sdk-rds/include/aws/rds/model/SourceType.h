@@ -38,7 +38,8 @@ namespace SourceTypeMapper
 {
 AWS_RDS_API SourceType GetSourceTypeForName(const Aws::String& name);
 
-AWS_RDS_API Aws::String GetNameForSourceType(SourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_RDS_API const char* GetNameForSourceType(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace RDS
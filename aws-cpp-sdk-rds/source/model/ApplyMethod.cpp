@@ -30,20 +30,30 @@ namespace Aws
       namespace ApplyMethodMapper
       {
 
-        static const int immediate_HASH = HashingUtils::HashString("immediate");
-        static const int pending_reboot_HASH = HashingUtils::HashString("pending-reboot");
+        static constexpr int immediate_HASH = HashingUtils::CompileTimeHashString("immediate");
+        static constexpr int pending_reboot_HASH = HashingUtils::CompileTimeHashString("pending-reboot");
 
 
         ApplyMethod GetApplyMethodForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == immediate_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ApplyMethod::immediate;
-          }
-          else if (hashCode == pending_reboot_HASH)
-          {
-            return ApplyMethod::pending_reboot;
+          case immediate_HASH:
+            if (name == "immediate")
+            {
+              return ApplyMethod::immediate;
+            }
+            break;
+          case pending_reboot_HASH:
+            if (name == "pending-reboot")
+            {
+              return ApplyMethod::pending_reboot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ApplyMethod::NOT_SET;
         }
 
-        Aws::String GetNameForApplyMethod(ApplyMethod enumValue)
+        const char* GetNameForApplyMethod(ApplyMethod enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace ParameterApplyTypeMapper
 {
 AWS_REDSHIFT_API ParameterApplyType GetParameterApplyTypeForName(const Aws::String& name);
 
-AWS_REDSHIFT_API Aws::String GetNameForParameterApplyType(ParameterApplyType value);
+// names of values not modeled point into the enum overflow container
+AWS_REDSHIFT_API const char* GetNameForParameterApplyType(ParameterApplyType value);
 } // namespace ParameterApplyTypeMapper
 } // namespace Model
 } // namespace Redshift
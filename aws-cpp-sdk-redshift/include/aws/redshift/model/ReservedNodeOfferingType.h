@@ -34,7 +34,8 @@ namespace ReservedNodeOfferingTypeMapper
 {
 AWS_REDSHIFT_API ReservedNodeOfferingType GetReservedNodeOfferingTypeForName(const Aws::String& name);
 
-AWS_REDSHIFT_API Aws::String GetNameForReservedNodeOfferingType(ReservedNodeOfferingType value);
+// names of values not modeled point into the enum overflow container
+AWS_REDSHIFT_API const char* GetNameForReservedNodeOfferingType(ReservedNodeOfferingType value);
 } // namespace ReservedNodeOfferingTypeMapper
 } // namespace Model
 } // namespace Redshift
@@ -36,7 +36,8 @@ namespace SourceTypeMapper
 {
 AWS_REDSHIFT_API SourceType GetSourceTypeForName(const Aws::String& name);
 
-AWS_REDSHIFT_API Aws::String GetNameForSourceType(SourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_REDSHIFT_API const char* GetNameForSourceType(SourceType value);
 } // namespace SourceTypeMapper
 } // namespace Model
 } // namespace Redshift
@@ -37,7 +37,8 @@ namespace TableRestoreStatusTypeMapper
 {
 AWS_REDSHIFT_API TableRestoreStatusType GetTableRestoreStatusTypeForName(const Aws::String& name);
 
-AWS_REDSHIFT_API Aws::String GetNameForTableRestoreStatusType(TableRestoreStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_REDSHIFT_API const char* GetNameForTableRestoreStatusType(TableRestoreStatusType value);
 } // namespace TableRestoreStatusTypeMapper
 } // namespace Model
 } // namespace Redshift
@@ -28,95 +28,95 @@ namespace Redshift
 namespace RedshiftErrorMapper
 {
 
-static const int RESERVED_NODE_ALREADY_MIGRATED_FAULT_HASH = HashingUtils::HashString("ReservedNodeAlreadyMigrated");
-static const int HSM_CLIENT_CERTIFICATE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("HsmClientCertificateAlreadyExistsFault");
-static const int BUCKET_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("BucketNotFoundFault");
-static const int CLUSTER_SUBNET_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ClusterSubnetQuotaExceededFault");
-static const int TABLE_LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::HashString("TableLimitExceeded");
-static const int INSUFFICIENT_S3_BUCKET_POLICY_FAULT_HASH = HashingUtils::HashString("InsufficientS3BucketPolicyFault");
-static const int S_N_S_INVALID_TOPIC_FAULT_HASH = HashingUtils::HashString("SNSInvalidTopic");
-static const int HSM_CONFIGURATION_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("HsmConfigurationQuotaExceededFault");
-static const int INSUFFICIENT_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::HashString("InsufficientClusterCapacity");
-static const int RESERVED_NODE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ReservedNodeQuotaExceeded");
-static const int CLUSTER_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ClusterAlreadyExists");
-static const int CLUSTER_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ClusterQuotaExceeded");
-static const int AUTHORIZATION_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("AuthorizationNotFound");
-static const int SNAPSHOT_COPY_ALREADY_DISABLED_FAULT_HASH = HashingUtils::HashString("SnapshotCopyAlreadyDisabledFault");
-static const int CLUSTER_SNAPSHOT_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ClusterSnapshotNotFound");
-static const int SUBSCRIPTION_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SubscriptionNotFound");
-static const int CLUSTER_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ClusterNotFound");
-static const int CLUSTER_SUBNET_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ClusterSubnetGroupQuotaExceeded");
-static const int CLUSTER_PARAMETER_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ClusterParameterGroupAlreadyExists");
-static const int SNAPSHOT_COPY_GRANT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("SnapshotCopyGrantAlreadyExistsFault");
-static const int SNAPSHOT_COPY_GRANT_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SnapshotCopyGrantNotFoundFault");
-static const int UNKNOWN_SNAPSHOT_COPY_REGION_FAULT_HASH = HashingUtils::HashString("UnknownSnapshotCopyRegionFault");
-static const int SNAPSHOT_COPY_DISABLED_FAULT_HASH = HashingUtils::HashString("SnapshotCopyDisabledFault");
-static const int INVALID_HSM_CONFIGURATION_STATE_FAULT_HASH = HashingUtils::HashString("InvalidHsmConfigurationStateFault");
-static const int RESIZE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ResizeNotFound");
-static const int INVALID_CLUSTER_PARAMETER_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidClusterParameterGroupState");
-static const int INVALID_HSM_CLIENT_CERTIFICATE_STATE_FAULT_HASH = HashingUtils::HashString("InvalidHsmClientCertificateStateFault");
-static const int NUMBER_OF_NODES_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("NumberOfNodesQuotaExceeded");
-static const int SNAPSHOT_COPY_GRANT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("SnapshotCopyGrantQuotaExceededFault");
-static const int INVALID_CLUSTER_STATE_FAULT_HASH = HashingUtils::HashString("InvalidClusterState");
-static const int INCOMPATIBLE_ORDERABLE_OPTIONS_HASH = HashingUtils::HashString("IncompatibleOrderableOptions");
-static const int SNAPSHOT_COPY_ALREADY_ENABLED_FAULT_HASH = HashingUtils::HashString("SnapshotCopyAlreadyEnabledFault");
-static const int COPY_TO_REGION_DISABLED_FAULT_HASH = HashingUtils::HashString("CopyToRegionDisabledFault");
-static const int S_N_S_NO_AUTHORIZATION_FAULT_HASH = HashingUtils::HashString("SNSNoAuthorization");
-static const int CLUSTER_SNAPSHOT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ClusterSnapshotAlreadyExists");
-static const int HSM_CONFIGURATION_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("HsmConfigurationNotFoundFault");
-static const int S_N_S_TOPIC_ARN_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SNSTopicArnNotFound");
-static const int INVALID_S3_BUCKET_NAME_FAULT_HASH = HashingUtils::HashString("InvalidS3BucketNameFault");
-static const int IN_PROGRESS_TABLE_RESTORE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("InProgressTableRestoreQuotaExceededFault");
-static const int EVENT_SUBSCRIPTION_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("EventSubscriptionQuotaExceeded");
-static const int INVALID_CLUSTER_SUBNET_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidClusterSubnetGroupStateFault");
-static const int INVALID_CLUSTER_SUBNET_STATE_FAULT_HASH = HashingUtils::HashString("InvalidClusterSubnetStateFault");
-static const int SUBSCRIPTION_SEVERITY_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SubscriptionSeverityNotFound");
-static const int SUBNET_ALREADY_IN_USE_HASH = HashingUtils::HashString("SubnetAlreadyInUse");
-static const int CLUSTER_PARAMETER_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ClusterParameterGroupQuotaExceeded");
-static const int SUBSCRIPTION_EVENT_ID_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SubscriptionEventIdNotFound");
-static const int CLUSTER_SECURITY_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ClusterSecurityGroupNotFound");
-static const int TAG_LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::HashString("TagLimitExceededFault");
-static const int RESERVED_NODE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ReservedNodeNotFound");
-static const int INVALID_CLUSTER_SECURITY_GROUP_STATE_FAULT_HASH = HashingUtils::HashString("InvalidClusterSecurityGroupState");
-static const int INVALID_V_P_C_NETWORK_STATE_FAULT_HASH = HashingUtils::HashString("InvalidVPCNetworkStateFault");
-static const int UNSUPPORTED_OPERATION_FAULT_HASH = HashingUtils::HashString("UnsupportedOperation");
-static const int AUTHORIZATION_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("AuthorizationQuotaExceeded");
-static const int ACCESS_TO_SNAPSHOT_DENIED_FAULT_HASH = HashingUtils::HashString("AccessToSnapshotDenied");
-static const int CLUSTER_SUBNET_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ClusterSubnetGroupAlreadyExists");
-static const int CLUSTER_SUBNET_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ClusterSubnetGroupNotFoundFault");
-static const int UNAUTHORIZED_OPERATION_HASH = HashingUtils::HashString("UnauthorizedOperation");
-static const int INVALID_SUBSCRIPTION_STATE_FAULT_HASH = HashingUtils::HashString("InvalidSubscriptionStateFault");
-static const int RESERVED_NODE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ReservedNodeAlreadyExists");
-static const int LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::HashString("LimitExceededFault");
-static const int SOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SourceNotFound");
-static const int CLUSTER_PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ClusterParameterGroupNotFound");
-static const int DEPENDENT_SERVICE_UNAVAILABLE_FAULT_HASH = HashingUtils::HashString("DependentServiceUnavailableFault");
-static const int HSM_CLIENT_CERTIFICATE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("HsmClientCertificateQuotaExceededFault");
-static const int INVALID_CLUSTER_SNAPSHOT_STATE_FAULT_HASH = HashingUtils::HashString("InvalidClusterSnapshotState");
-static const int INVALID_S3_KEY_PREFIX_FAULT_HASH = HashingUtils::HashString("InvalidS3KeyPrefixFault");
-static const int SUBSCRIPTION_CATEGORY_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("SubscriptionCategoryNotFound");
-static const int INVALID_TABLE_RESTORE_ARGUMENT_FAULT_HASH = HashingUtils::HashString("InvalidTableRestoreArgument");
-static const int INVALID_SUBNET_HASH = HashingUtils::HashString("InvalidSubnet");
-static const int RESOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ResourceNotFoundFault");
-static const int AUTHORIZATION_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("AuthorizationAlreadyExists");
-static const int HSM_CLIENT_CERTIFICATE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("HsmClientCertificateNotFoundFault");
-static const int INVALID_TAG_FAULT_HASH = HashingUtils::HashString("InvalidTagFault");
-static const int CLUSTER_SNAPSHOT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("ClusterSnapshotQuotaExceeded");
-static const int CLUSTER_SECURITY_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("ClusterSecurityGroupAlreadyExists");
-static const int HSM_CONFIGURATION_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("HsmConfigurationAlreadyExistsFault");
-static const int CLUSTER_SECURITY_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::HashString("QuotaExceeded.ClusterSecurityGroup");
-static const int DEPENDENT_SERVICE_REQUEST_THROTTLING_FAULT_HASH = HashingUtils::HashString("DependentServiceRequestThrottlingFault");
-static const int INVALID_SNAPSHOT_COPY_GRANT_STATE_FAULT_HASH = HashingUtils::HashString("InvalidSnapshotCopyGrantStateFault");
-static const int SUBSCRIPTION_ALREADY_EXIST_FAULT_HASH = HashingUtils::HashString("SubscriptionAlreadyExist");
-static const int INVALID_RESTORE_FAULT_HASH = HashingUtils::HashString("InvalidRestore");
-static const int UNSUPPORTED_OPTION_FAULT_HASH = HashingUtils::HashString("UnsupportedOptionFault");
-static const int CLUSTER_ON_LATEST_REVISION_FAULT_HASH = HashingUtils::HashString("ClusterOnLatestRevision");
-static const int INVALID_CLUSTER_TRACK_FAULT_HASH = HashingUtils::HashString("InvalidClusterTrack");
-static const int NUMBER_OF_NODES_PER_CLUSTER_LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::HashString("NumberOfNodesPerClusterLimitExceeded");
-static const int RESERVED_NODE_OFFERING_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("ReservedNodeOfferingNotFound");
-static const int INVALID_ELASTIC_IP_FAULT_HASH = HashingUtils::HashString("InvalidElasticIpFault");
-static const int TABLE_RESTORE_NOT_FOUND_FAULT_HASH = HashingUtils::HashString("TableRestoreNotFoundFault");
-static const int INVALID_RESERVED_NODE_STATE_FAULT_HASH = HashingUtils::HashString("InvalidReservedNodeState");
+static constexpr int RESERVED_NODE_ALREADY_MIGRATED_FAULT_HASH = HashingUtils::CompileTimeHashString("ReservedNodeAlreadyMigrated");
+static constexpr int HSM_CLIENT_CERTIFICATE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("HsmClientCertificateAlreadyExistsFault");
+static constexpr int BUCKET_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("BucketNotFoundFault");
+static constexpr int CLUSTER_SUBNET_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterSubnetQuotaExceededFault");
+static constexpr int TABLE_LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("TableLimitExceeded");
+static constexpr int INSUFFICIENT_S3_BUCKET_POLICY_FAULT_HASH = HashingUtils::CompileTimeHashString("InsufficientS3BucketPolicyFault");
+static constexpr int S_N_S_INVALID_TOPIC_FAULT_HASH = HashingUtils::CompileTimeHashString("SNSInvalidTopic");
+static constexpr int HSM_CONFIGURATION_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("HsmConfigurationQuotaExceededFault");
+static constexpr int INSUFFICIENT_CLUSTER_CAPACITY_FAULT_HASH = HashingUtils::CompileTimeHashString("InsufficientClusterCapacity");
+static constexpr int RESERVED_NODE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ReservedNodeQuotaExceeded");
+static constexpr int CLUSTER_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterAlreadyExists");
+static constexpr int CLUSTER_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterQuotaExceeded");
+static constexpr int AUTHORIZATION_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("AuthorizationNotFound");
+static constexpr int SNAPSHOT_COPY_ALREADY_DISABLED_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotCopyAlreadyDisabledFault");
+static constexpr int CLUSTER_SNAPSHOT_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterSnapshotNotFound");
+static constexpr int SUBSCRIPTION_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SubscriptionNotFound");
+static constexpr int CLUSTER_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterNotFound");
+static constexpr int CLUSTER_SUBNET_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterSubnetGroupQuotaExceeded");
+static constexpr int CLUSTER_PARAMETER_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterParameterGroupAlreadyExists");
+static constexpr int SNAPSHOT_COPY_GRANT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotCopyGrantAlreadyExistsFault");
+static constexpr int SNAPSHOT_COPY_GRANT_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotCopyGrantNotFoundFault");
+static constexpr int UNKNOWN_SNAPSHOT_COPY_REGION_FAULT_HASH = HashingUtils::CompileTimeHashString("UnknownSnapshotCopyRegionFault");
+static constexpr int SNAPSHOT_COPY_DISABLED_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotCopyDisabledFault");
+static constexpr int INVALID_HSM_CONFIGURATION_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidHsmConfigurationStateFault");
+static constexpr int RESIZE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ResizeNotFound");
+static constexpr int INVALID_CLUSTER_PARAMETER_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidClusterParameterGroupState");
+static constexpr int INVALID_HSM_CLIENT_CERTIFICATE_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidHsmClientCertificateStateFault");
+static constexpr int NUMBER_OF_NODES_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("NumberOfNodesQuotaExceeded");
+static constexpr int SNAPSHOT_COPY_GRANT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotCopyGrantQuotaExceededFault");
+static constexpr int INVALID_CLUSTER_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidClusterState");
+static constexpr int INCOMPATIBLE_ORDERABLE_OPTIONS_HASH = HashingUtils::CompileTimeHashString("IncompatibleOrderableOptions");
+static constexpr int SNAPSHOT_COPY_ALREADY_ENABLED_FAULT_HASH = HashingUtils::CompileTimeHashString("SnapshotCopyAlreadyEnabledFault");
+static constexpr int COPY_TO_REGION_DISABLED_FAULT_HASH = HashingUtils::CompileTimeHashString("CopyToRegionDisabledFault");
+static constexpr int S_N_S_NO_AUTHORIZATION_FAULT_HASH = HashingUtils::CompileTimeHashString("SNSNoAuthorization");
+static constexpr int CLUSTER_SNAPSHOT_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterSnapshotAlreadyExists");
+static constexpr int HSM_CONFIGURATION_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("HsmConfigurationNotFoundFault");
+static constexpr int S_N_S_TOPIC_ARN_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SNSTopicArnNotFound");
+static constexpr int INVALID_S3_BUCKET_NAME_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidS3BucketNameFault");
+static constexpr int IN_PROGRESS_TABLE_RESTORE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("InProgressTableRestoreQuotaExceededFault");
+static constexpr int EVENT_SUBSCRIPTION_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("EventSubscriptionQuotaExceeded");
+static constexpr int INVALID_CLUSTER_SUBNET_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidClusterSubnetGroupStateFault");
+static constexpr int INVALID_CLUSTER_SUBNET_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidClusterSubnetStateFault");
+static constexpr int SUBSCRIPTION_SEVERITY_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SubscriptionSeverityNotFound");
+static constexpr int SUBNET_ALREADY_IN_USE_HASH = HashingUtils::CompileTimeHashString("SubnetAlreadyInUse");
+static constexpr int CLUSTER_PARAMETER_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterParameterGroupQuotaExceeded");
+static constexpr int SUBSCRIPTION_EVENT_ID_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SubscriptionEventIdNotFound");
+static constexpr int CLUSTER_SECURITY_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterSecurityGroupNotFound");
+static constexpr int TAG_LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("TagLimitExceededFault");
+static constexpr int RESERVED_NODE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ReservedNodeNotFound");
+static constexpr int INVALID_CLUSTER_SECURITY_GROUP_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidClusterSecurityGroupState");
+static constexpr int INVALID_V_P_C_NETWORK_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidVPCNetworkStateFault");
+static constexpr int UNSUPPORTED_OPERATION_FAULT_HASH = HashingUtils::CompileTimeHashString("UnsupportedOperation");
+static constexpr int AUTHORIZATION_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("AuthorizationQuotaExceeded");
+static constexpr int ACCESS_TO_SNAPSHOT_DENIED_FAULT_HASH = HashingUtils::CompileTimeHashString("AccessToSnapshotDenied");
+static constexpr int CLUSTER_SUBNET_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterSubnetGroupAlreadyExists");
+static constexpr int CLUSTER_SUBNET_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterSubnetGroupNotFoundFault");
+static constexpr int UNAUTHORIZED_OPERATION_HASH = HashingUtils::CompileTimeHashString("UnauthorizedOperation");
+static constexpr int INVALID_SUBSCRIPTION_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidSubscriptionStateFault");
+static constexpr int RESERVED_NODE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ReservedNodeAlreadyExists");
+static constexpr int LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("LimitExceededFault");
+static constexpr int SOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SourceNotFound");
+static constexpr int CLUSTER_PARAMETER_GROUP_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterParameterGroupNotFound");
+static constexpr int DEPENDENT_SERVICE_UNAVAILABLE_FAULT_HASH = HashingUtils::CompileTimeHashString("DependentServiceUnavailableFault");
+static constexpr int HSM_CLIENT_CERTIFICATE_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("HsmClientCertificateQuotaExceededFault");
+static constexpr int INVALID_CLUSTER_SNAPSHOT_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidClusterSnapshotState");
+static constexpr int INVALID_S3_KEY_PREFIX_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidS3KeyPrefixFault");
+static constexpr int SUBSCRIPTION_CATEGORY_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("SubscriptionCategoryNotFound");
+static constexpr int INVALID_TABLE_RESTORE_ARGUMENT_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidTableRestoreArgument");
+static constexpr int INVALID_SUBNET_HASH = HashingUtils::CompileTimeHashString("InvalidSubnet");
+static constexpr int RESOURCE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ResourceNotFoundFault");
+static constexpr int AUTHORIZATION_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("AuthorizationAlreadyExists");
+static constexpr int HSM_CLIENT_CERTIFICATE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("HsmClientCertificateNotFoundFault");
+static constexpr int INVALID_TAG_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidTagFault");
+static constexpr int CLUSTER_SNAPSHOT_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterSnapshotQuotaExceeded");
+static constexpr int CLUSTER_SECURITY_GROUP_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterSecurityGroupAlreadyExists");
+static constexpr int HSM_CONFIGURATION_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("HsmConfigurationAlreadyExistsFault");
+static constexpr int CLUSTER_SECURITY_GROUP_QUOTA_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("QuotaExceeded.ClusterSecurityGroup");
+static constexpr int DEPENDENT_SERVICE_REQUEST_THROTTLING_FAULT_HASH = HashingUtils::CompileTimeHashString("DependentServiceRequestThrottlingFault");
+static constexpr int INVALID_SNAPSHOT_COPY_GRANT_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidSnapshotCopyGrantStateFault");
+static constexpr int SUBSCRIPTION_ALREADY_EXIST_FAULT_HASH = HashingUtils::CompileTimeHashString("SubscriptionAlreadyExist");
+static constexpr int INVALID_RESTORE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidRestore");
+static constexpr int UNSUPPORTED_OPTION_FAULT_HASH = HashingUtils::CompileTimeHashString("UnsupportedOptionFault");
+static constexpr int CLUSTER_ON_LATEST_REVISION_FAULT_HASH = HashingUtils::CompileTimeHashString("ClusterOnLatestRevision");
+static constexpr int INVALID_CLUSTER_TRACK_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidClusterTrack");
+static constexpr int NUMBER_OF_NODES_PER_CLUSTER_LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("NumberOfNodesPerClusterLimitExceeded");
+static constexpr int RESERVED_NODE_OFFERING_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("ReservedNodeOfferingNotFound");
+static constexpr int INVALID_ELASTIC_IP_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidElasticIpFault");
+static constexpr int TABLE_RESTORE_NOT_FOUND_FAULT_HASH = HashingUtils::CompileTimeHashString("TableRestoreNotFoundFault");
+static constexpr int INVALID_RESERVED_NODE_STATE_FAULT_HASH = HashingUtils::CompileTimeHashString("InvalidReservedNodeState");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
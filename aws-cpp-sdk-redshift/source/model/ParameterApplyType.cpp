@@ -30,20 +30,30 @@ namespace Aws
       namespace ParameterApplyTypeMapper
       {
 
-        static const int static__HASH = HashingUtils::HashString("static");
-        static const int dynamic_HASH = HashingUtils::HashString("dynamic");
+        static constexpr int static__HASH = HashingUtils::CompileTimeHashString("static");
+        static constexpr int dynamic_HASH = HashingUtils::CompileTimeHashString("dynamic");
 
 
         ParameterApplyType GetParameterApplyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == static__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ParameterApplyType::static_;
-          }
-          else if (hashCode == dynamic_HASH)
-          {
-            return ParameterApplyType::dynamic;
+          case static__HASH:
+            if (name == "static")
+            {
+              return ParameterApplyType::static_;
+            }
+            break;
+          case dynamic_HASH:
+            if (name == "dynamic")
+            {
+              return ParameterApplyType::dynamic;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ParameterApplyType::NOT_SET;
         }
 
-        Aws::String GetNameForParameterApplyType(ParameterApplyType enumValue)
+        const char* GetNameForParameterApplyType(ParameterApplyType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
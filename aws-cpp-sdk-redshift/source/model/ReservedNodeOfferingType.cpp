@@ -30,20 +30,30 @@ namespace Aws
       namespace ReservedNodeOfferingTypeMapper
       {
 
-        static const int Regular_HASH = HashingUtils::HashString("Regular");
-        static const int Upgradable_HASH = HashingUtils::HashString("Upgradable");
+        static constexpr int Regular_HASH = HashingUtils::CompileTimeHashString("Regular");
+        static constexpr int Upgradable_HASH = HashingUtils::CompileTimeHashString("Upgradable");
 
 
         ReservedNodeOfferingType GetReservedNodeOfferingTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Regular_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReservedNodeOfferingType::Regular;
-          }
-          else if (hashCode == Upgradable_HASH)
-          {
-            return ReservedNodeOfferingType::Upgradable;
+          case Regular_HASH:
+            if (name == "Regular")
+            {
+              return ReservedNodeOfferingType::Regular;
+            }
+            break;
+          case Upgradable_HASH:
+            if (name == "Upgradable")
+            {
+              return ReservedNodeOfferingType::Upgradable;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReservedNodeOfferingType::NOT_SET;
         }
 
-        Aws::String GetNameForReservedNodeOfferingType(ReservedNodeOfferingType enumValue)
+        const char* GetNameForReservedNodeOfferingType(ReservedNodeOfferingType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
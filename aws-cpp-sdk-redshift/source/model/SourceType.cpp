@@ -30,30 +30,44 @@ namespace Aws
       namespace SourceTypeMapper
       {
 
-        static const int cluster_HASH = HashingUtils::HashString("cluster");
-        static const int cluster_parameter_group_HASH = HashingUtils::HashString("cluster-parameter-group");
-        static const int cluster_security_group_HASH = HashingUtils::HashString("cluster-security-group");
-        static const int cluster_snapshot_HASH = HashingUtils::HashString("cluster-snapshot");
+        static constexpr int cluster_HASH = HashingUtils::CompileTimeHashString("cluster");
+        static constexpr int cluster_parameter_group_HASH = HashingUtils::CompileTimeHashString("cluster-parameter-group");
+        static constexpr int cluster_security_group_HASH = HashingUtils::CompileTimeHashString("cluster-security-group");
+        static constexpr int cluster_snapshot_HASH = HashingUtils::CompileTimeHashString("cluster-snapshot");
 
 
         SourceType GetSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == cluster_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SourceType::cluster;
-          }
-          else if (hashCode == cluster_parameter_group_HASH)
-          {
-            return SourceType::cluster_parameter_group;
-          }
-          else if (hashCode == cluster_security_group_HASH)
-          {
-            return SourceType::cluster_security_group;
-          }
-          else if (hashCode == cluster_snapshot_HASH)
-          {
-            return SourceType::cluster_snapshot;
+          case cluster_HASH:
+            if (name == "cluster")
+            {
+              return SourceType::cluster;
+            }
+            break;
+          case cluster_parameter_group_HASH:
+            if (name == "cluster-parameter-group")
+            {
+              return SourceType::cluster_parameter_group;
+            }
+            break;
+          case cluster_security_group_HASH:
+            if (name == "cluster-security-group")
+            {
+              return SourceType::cluster_security_group;
+            }
+            break;
+          case cluster_snapshot_HASH:
+            if (name == "cluster-snapshot")
+            {
+              return SourceType::cluster_snapshot;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return SourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSourceType(SourceType enumValue)
+        const char* GetNameForSourceType(SourceType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
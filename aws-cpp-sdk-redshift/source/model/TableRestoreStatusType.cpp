@@ -30,35 +30,51 @@ namespace Aws
       namespace TableRestoreStatusTypeMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
 
 
         TableRestoreStatusType GetTableRestoreStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TableRestoreStatusType::PENDING;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return TableRestoreStatusType::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return TableRestoreStatusType::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return TableRestoreStatusType::FAILED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return TableRestoreStatusType::CANCELED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return TableRestoreStatusType::PENDING;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return TableRestoreStatusType::IN_PROGRESS;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return TableRestoreStatusType::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return TableRestoreStatusType::FAILED;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return TableRestoreStatusType::CANCELED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return TableRestoreStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForTableRestoreStatusType(TableRestoreStatusType enumValue)
+        const char* GetNameForTableRestoreStatusType(TableRestoreStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -34,7 +34,8 @@ namespace AttributeMapper
 {
 AWS_REKOGNITION_API Attribute GetAttributeForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForAttribute(Attribute value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForAttribute(Attribute value);
 } // namespace AttributeMapper
 } // namespace Model
 } // namespace Rekognition
@@ -34,7 +34,8 @@ namespace CelebrityRecognitionSortByMapper
 {
 AWS_REKOGNITION_API CelebrityRecognitionSortBy GetCelebrityRecognitionSortByForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForCelebrityRecognitionSortBy(CelebrityRecognitionSortBy value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForCelebrityRecognitionSortBy(CelebrityRecognitionSortBy value);
 } // namespace CelebrityRecognitionSortByMapper
 } // namespace Model
 } // namespace Rekognition
@@ -34,7 +34,8 @@ namespace ContentModerationSortByMapper
 {
 AWS_REKOGNITION_API ContentModerationSortBy GetContentModerationSortByForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForContentModerationSortBy(ContentModerationSortBy value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForContentModerationSortBy(ContentModerationSortBy value);
 } // namespace ContentModerationSortByMapper
 } // namespace Model
 } // namespace Rekognition
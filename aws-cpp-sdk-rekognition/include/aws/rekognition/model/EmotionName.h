@@ -40,7 +40,8 @@ namespace EmotionNameMapper
 {
 AWS_REKOGNITION_API EmotionName GetEmotionNameForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForEmotionName(EmotionName value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForEmotionName(EmotionName value);
 } // namespace EmotionNameMapper
 } // namespace Model
 } // namespace Rekognition
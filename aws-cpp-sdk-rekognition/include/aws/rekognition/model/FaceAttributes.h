@@ -34,7 +34,8 @@ namespace FaceAttributesMapper
 {
 AWS_REKOGNITION_API FaceAttributes GetFaceAttributesForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForFaceAttributes(FaceAttributes value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForFaceAttributes(FaceAttributes value);
 } // namespace FaceAttributesMapper
 } // namespace Model
 } // namespace Rekognition
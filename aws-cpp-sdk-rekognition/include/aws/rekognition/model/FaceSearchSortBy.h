@@ -34,7 +34,8 @@ namespace FaceSearchSortByMapper
 {
 AWS_REKOGNITION_API FaceSearchSortBy GetFaceSearchSortByForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForFaceSearchSortBy(FaceSearchSortBy value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForFaceSearchSortBy(FaceSearchSortBy value);
 } // namespace FaceSearchSortByMapper
 } // namespace Model
 } // namespace Rekognition
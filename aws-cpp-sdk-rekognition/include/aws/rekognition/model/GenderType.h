@@ -34,7 +34,8 @@ namespace GenderTypeMapper
 {
 AWS_REKOGNITION_API GenderType GetGenderTypeForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForGenderType(GenderType value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForGenderType(GenderType value);
 } // namespace GenderTypeMapper
 } // namespace Model
 } // namespace Rekognition
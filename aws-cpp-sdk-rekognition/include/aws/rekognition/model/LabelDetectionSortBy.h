@@ -34,7 +34,8 @@ namespace LabelDetectionSortByMapper
 {
 AWS_REKOGNITION_API LabelDetectionSortBy GetLabelDetectionSortByForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForLabelDetectionSortBy(LabelDetectionSortBy value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForLabelDetectionSortBy(LabelDetectionSortBy value);
 } // namespace LabelDetectionSortByMapper
 } // namespace Model
 } // namespace Rekognition
@@ -57,7 +57,8 @@ namespace LandmarkTypeMapper
 {
 AWS_REKOGNITION_API LandmarkType GetLandmarkTypeForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForLandmarkType(LandmarkType value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForLandmarkType(LandmarkType value);
 } // namespace LandmarkTypeMapper
 } // namespace Model
 } // namespace Rekognition
@@ -36,7 +36,8 @@ namespace OrientationCorrectionMapper
 {
 AWS_REKOGNITION_API OrientationCorrection GetOrientationCorrectionForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForOrientationCorrection(OrientationCorrection value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForOrientationCorrection(OrientationCorrection value);
 } // namespace OrientationCorrectionMapper
 } // namespace Model
 } // namespace Rekognition
@@ -34,7 +34,8 @@ namespace PersonTrackingSortByMapper
 {
 AWS_REKOGNITION_API PersonTrackingSortBy GetPersonTrackingSortByForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForPersonTrackingSortBy(PersonTrackingSortBy value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForPersonTrackingSortBy(PersonTrackingSortBy value);
 } // namespace PersonTrackingSortByMapper
 } // namespace Model
 } // namespace Rekognition
@@ -37,7 +37,8 @@ namespace StreamProcessorStatusMapper
 {
 AWS_REKOGNITION_API StreamProcessorStatus GetStreamProcessorStatusForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForStreamProcessorStatus(StreamProcessorStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForStreamProcessorStatus(StreamProcessorStatus value);
 } // namespace StreamProcessorStatusMapper
 } // namespace Model
 } // namespace Rekognition
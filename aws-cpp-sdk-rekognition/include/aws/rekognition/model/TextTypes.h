@@ -34,7 +34,8 @@ namespace TextTypesMapper
 {
 AWS_REKOGNITION_API TextTypes GetTextTypesForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForTextTypes(TextTypes value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForTextTypes(TextTypes value);
 } // namespace TextTypesMapper
 } // namespace Model
 } // namespace Rekognition
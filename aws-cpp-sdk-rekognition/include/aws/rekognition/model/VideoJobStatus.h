@@ -35,7 +35,8 @@ namespace VideoJobStatusMapper
 {
 AWS_REKOGNITION_API VideoJobStatus GetVideoJobStatusForName(const Aws::String& name);
 
-AWS_REKOGNITION_API Aws::String GetNameForVideoJobStatus(VideoJobStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_REKOGNITION_API const char* GetNameForVideoJobStatus(VideoJobStatus value);
 } // namespace VideoJobStatusMapper
 } // namespace Model
 } // namespace Rekognition
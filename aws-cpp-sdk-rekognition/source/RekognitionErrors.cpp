@@ -28,17 +28,17 @@ namespace Rekognition
 namespace RekognitionErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int IMAGE_TOO_LARGE_HASH = HashingUtils::HashString("ImageTooLargeException");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int INVALID_IMAGE_FORMAT_HASH = HashingUtils::HashString("InvalidImageFormatException");
-static const int INVALID_S3_OBJECT_HASH = HashingUtils::HashString("InvalidS3ObjectException");
-static const int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ResourceAlreadyExistsException");
-static const int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::HashString("IdempotentParameterMismatchException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::HashString("InvalidPaginationTokenException");
-static const int PROVISIONED_THROUGHPUT_EXCEEDED_HASH = HashingUtils::HashString("ProvisionedThroughputExceededException");
-static const int VIDEO_TOO_LARGE_HASH = HashingUtils::HashString("VideoTooLargeException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int IMAGE_TOO_LARGE_HASH = HashingUtils::CompileTimeHashString("ImageTooLargeException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int INVALID_IMAGE_FORMAT_HASH = HashingUtils::CompileTimeHashString("InvalidImageFormatException");
+static constexpr int INVALID_S3_OBJECT_HASH = HashingUtils::CompileTimeHashString("InvalidS3ObjectException");
+static constexpr int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyExistsException");
+static constexpr int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::CompileTimeHashString("IdempotentParameterMismatchException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidPaginationTokenException");
+static constexpr int PROVISIONED_THROUGHPUT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ProvisionedThroughputExceededException");
+static constexpr int VIDEO_TOO_LARGE_HASH = HashingUtils::CompileTimeHashString("VideoTooLargeException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace CelebrityRecognitionSortByMapper
       {
 
-        static const int ID_HASH = HashingUtils::HashString("ID");
-        static const int TIMESTAMP_HASH = HashingUtils::HashString("TIMESTAMP");
+        static constexpr int ID_HASH = HashingUtils::CompileTimeHashString("ID");
+        static constexpr int TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("TIMESTAMP");
 
 
         CelebrityRecognitionSortBy GetCelebrityRecognitionSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ID_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CelebrityRecognitionSortBy::ID;
-          }
-          else if (hashCode == TIMESTAMP_HASH)
-          {
-            return CelebrityRecognitionSortBy::TIMESTAMP;
+          case ID_HASH:
+            if (name == "ID")
+            {
+              return CelebrityRecognitionSortBy::ID;
+            }
+            break;
+          case TIMESTAMP_HASH:
+            if (name == "TIMESTAMP")
+            {
+              return CelebrityRecognitionSortBy::TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CelebrityRecognitionSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForCelebrityRecognitionSortBy(CelebrityRecognitionSortBy enumValue)
+        const char* GetNameForCelebrityRecognitionSortBy(CelebrityRecognitionSortBy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
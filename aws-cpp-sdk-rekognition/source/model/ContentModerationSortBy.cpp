@@ -30,20 +30,30 @@ namespace Aws
       namespace ContentModerationSortByMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int TIMESTAMP_HASH = HashingUtils::HashString("TIMESTAMP");
+        static constexpr int NAME_HASH = HashingUtils::CompileTimeHashString("NAME");
+        static constexpr int TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("TIMESTAMP");
 
 
         ContentModerationSortBy GetContentModerationSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContentModerationSortBy::NAME;
-          }
-          else if (hashCode == TIMESTAMP_HASH)
-          {
-            return ContentModerationSortBy::TIMESTAMP;
+          case NAME_HASH:
+            if (name == "NAME")
+            {
+              return ContentModerationSortBy::NAME;
+            }
+            break;
+          case TIMESTAMP_HASH:
+            if (name == "TIMESTAMP")
+            {
+              return ContentModerationSortBy::TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ContentModerationSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForContentModerationSortBy(ContentModerationSortBy enumValue)
+        const char* GetNameForContentModerationSortBy(ContentModerationSortBy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace EmotionNameMapper
       {
 
-        static const int HAPPY_HASH = HashingUtils::HashString("HAPPY");
-        static const int SAD_HASH = HashingUtils::HashString("SAD");
-        static const int ANGRY_HASH = HashingUtils::HashString("ANGRY");
-        static const int CONFUSED_HASH = HashingUtils::HashString("CONFUSED");
-        static const int DISGUSTED_HASH = HashingUtils::HashString("DISGUSTED");
-        static const int SURPRISED_HASH = HashingUtils::HashString("SURPRISED");
-        static const int CALM_HASH = HashingUtils::HashString("CALM");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
+        static constexpr int HAPPY_HASH = HashingUtils::CompileTimeHashString("HAPPY");
+        static constexpr int SAD_HASH = HashingUtils::CompileTimeHashString("SAD");
+        static constexpr int ANGRY_HASH = HashingUtils::CompileTimeHashString("ANGRY");
+        static constexpr int CONFUSED_HASH = HashingUtils::CompileTimeHashString("CONFUSED");
+        static constexpr int DISGUSTED_HASH = HashingUtils::CompileTimeHashString("DISGUSTED");
+        static constexpr int SURPRISED_HASH = HashingUtils::CompileTimeHashString("SURPRISED");
+        static constexpr int CALM_HASH = HashingUtils::CompileTimeHashString("CALM");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
 
 
         EmotionName GetEmotionNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HAPPY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EmotionName::HAPPY;
-          }
-          else if (hashCode == SAD_HASH)
-          {
-            return EmotionName::SAD;
-          }
-          else if (hashCode == ANGRY_HASH)
-          {
-            return EmotionName::ANGRY;
-          }
-          else if (hashCode == CONFUSED_HASH)
-          {
-            return EmotionName::CONFUSED;
-          }
-          else if (hashCode == DISGUSTED_HASH)
-          {
-            return EmotionName::DISGUSTED;
-          }
-          else if (hashCode == SURPRISED_HASH)
-          {
-            return EmotionName::SURPRISED;
-          }
-          else if (hashCode == CALM_HASH)
-          {
-            return EmotionName::CALM;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return EmotionName::UNKNOWN;
+          case HAPPY_HASH:
+            if (name == "HAPPY")
+            {
+              return EmotionName::HAPPY;
+            }
+            break;
+          case SAD_HASH:
+            if (name == "SAD")
+            {
+              return EmotionName::SAD;
+            }
+            break;
+          case ANGRY_HASH:
+            if (name == "ANGRY")
+            {
+              return EmotionName::ANGRY;
+            }
+            break;
+          case CONFUSED_HASH:
+            if (name == "CONFUSED")
+            {
+              return EmotionName::CONFUSED;
+            }
+            break;
+          case DISGUSTED_HASH:
+            if (name == "DISGUSTED")
+            {
+              return EmotionName::DISGUSTED;
+            }
+            break;
+          case SURPRISED_HASH:
+            if (name == "SURPRISED")
+            {
+              return EmotionName::SURPRISED;
+            }
+            break;
+          case CALM_HASH:
+            if (name == "CALM")
+            {
+              return EmotionName::CALM;
+            }
+            break;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return EmotionName::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return EmotionName::NOT_SET;
         }
 
-        Aws::String GetNameForEmotionName(EmotionName enumValue)
+        const char* GetNameForEmotionName(EmotionName enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace FaceAttributesMapper
       {
 
-        static const int DEFAULT_HASH = HashingUtils::HashString("DEFAULT");
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
+        static constexpr int DEFAULT_HASH = HashingUtils::CompileTimeHashString("DEFAULT");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
 
 
         FaceAttributes GetFaceAttributesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DEFAULT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FaceAttributes::DEFAULT;
-          }
-          else if (hashCode == ALL_HASH)
-          {
-            return FaceAttributes::ALL;
+          case DEFAULT_HASH:
+            if (name == "DEFAULT")
+            {
+              return FaceAttributes::DEFAULT;
+            }
+            break;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return FaceAttributes::ALL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FaceAttributes::NOT_SET;
         }
 
-        Aws::String GetNameForFaceAttributes(FaceAttributes enumValue)
+        const char* GetNameForFaceAttributes(FaceAttributes enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace GenderTypeMapper
       {
 
-        static const int Male_HASH = HashingUtils::HashString("Male");
-        static const int Female_HASH = HashingUtils::HashString("Female");
+        static constexpr int Male_HASH = HashingUtils::CompileTimeHashString("Male");
+        static constexpr int Female_HASH = HashingUtils::CompileTimeHashString("Female");
 
 
         GenderType GetGenderTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Male_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GenderType::Male;
-          }
-          else if (hashCode == Female_HASH)
-          {
-            return GenderType::Female;
+          case Male_HASH:
+            if (name == "Male")
+            {
+              return GenderType::Male;
+            }
+            break;
+          case Female_HASH:
+            if (name == "Female")
+            {
+              return GenderType::Female;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return GenderType::NOT_SET;
         }
 
-        Aws::String GetNameForGenderType(GenderType enumValue)
+        const char* GetNameForGenderType(GenderType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace LabelDetectionSortByMapper
       {
 
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
-        static const int TIMESTAMP_HASH = HashingUtils::HashString("TIMESTAMP");
+        static constexpr int NAME_HASH = HashingUtils::CompileTimeHashString("NAME");
+        static constexpr int TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("TIMESTAMP");
 
 
         LabelDetectionSortBy GetLabelDetectionSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LabelDetectionSortBy::NAME;
-          }
-          else if (hashCode == TIMESTAMP_HASH)
-          {
-            return LabelDetectionSortBy::TIMESTAMP;
+          case NAME_HASH:
+            if (name == "NAME")
+            {
+              return LabelDetectionSortBy::NAME;
+            }
+            break;
+          case TIMESTAMP_HASH:
+            if (name == "TIMESTAMP")
+            {
+              return LabelDetectionSortBy::TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LabelDetectionSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForLabelDetectionSortBy(LabelDetectionSortBy enumValue)
+        const char* GetNameForLabelDetectionSortBy(LabelDetectionSortBy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,135 +30,191 @@ namespace Aws
       namespace LandmarkTypeMapper
       {
 
-        static const int eyeLeft_HASH = HashingUtils::HashString("eyeLeft");
-        static const int eyeRight_HASH = HashingUtils::HashString("eyeRight");
-        static const int nose_HASH = HashingUtils::HashString("nose");
-        static const int mouthLeft_HASH = HashingUtils::HashString("mouthLeft");
-        static const int mouthRight_HASH = HashingUtils::HashString("mouthRight");
-        static const int leftEyeBrowLeft_HASH = HashingUtils::HashString("leftEyeBrowLeft");
-        static const int leftEyeBrowRight_HASH = HashingUtils::HashString("leftEyeBrowRight");
-        static const int leftEyeBrowUp_HASH = HashingUtils::HashString("leftEyeBrowUp");
-        static const int rightEyeBrowLeft_HASH = HashingUtils::HashString("rightEyeBrowLeft");
-        static const int rightEyeBrowRight_HASH = HashingUtils::HashString("rightEyeBrowRight");
-        static const int rightEyeBrowUp_HASH = HashingUtils::HashString("rightEyeBrowUp");
-        static const int leftEyeLeft_HASH = HashingUtils::HashString("leftEyeLeft");
-        static const int leftEyeRight_HASH = HashingUtils::HashString("leftEyeRight");
-        static const int leftEyeUp_HASH = HashingUtils::HashString("leftEyeUp");
-        static const int leftEyeDown_HASH = HashingUtils::HashString("leftEyeDown");
-        static const int rightEyeLeft_HASH = HashingUtils::HashString("rightEyeLeft");
-        static const int rightEyeRight_HASH = HashingUtils::HashString("rightEyeRight");
-        static const int rightEyeUp_HASH = HashingUtils::HashString("rightEyeUp");
-        static const int rightEyeDown_HASH = HashingUtils::HashString("rightEyeDown");
-        static const int noseLeft_HASH = HashingUtils::HashString("noseLeft");
-        static const int noseRight_HASH = HashingUtils::HashString("noseRight");
-        static const int mouthUp_HASH = HashingUtils::HashString("mouthUp");
-        static const int mouthDown_HASH = HashingUtils::HashString("mouthDown");
-        static const int leftPupil_HASH = HashingUtils::HashString("leftPupil");
-        static const int rightPupil_HASH = HashingUtils::HashString("rightPupil");
+        static constexpr int eyeLeft_HASH = HashingUtils::CompileTimeHashString("eyeLeft");
+        static constexpr int eyeRight_HASH = HashingUtils::CompileTimeHashString("eyeRight");
+        static constexpr int nose_HASH = HashingUtils::CompileTimeHashString("nose");
+        static constexpr int mouthLeft_HASH = HashingUtils::CompileTimeHashString("mouthLeft");
+        static constexpr int mouthRight_HASH = HashingUtils::CompileTimeHashString("mouthRight");
+        static constexpr int leftEyeBrowLeft_HASH = HashingUtils::CompileTimeHashString("leftEyeBrowLeft");
+        static constexpr int leftEyeBrowRight_HASH = HashingUtils::CompileTimeHashString("leftEyeBrowRight");
+        static constexpr int leftEyeBrowUp_HASH = HashingUtils::CompileTimeHashString("leftEyeBrowUp");
+        static constexpr int rightEyeBrowLeft_HASH = HashingUtils::CompileTimeHashString("rightEyeBrowLeft");
+        static constexpr int rightEyeBrowRight_HASH = HashingUtils::CompileTimeHashString("rightEyeBrowRight");
+        static constexpr int rightEyeBrowUp_HASH = HashingUtils::CompileTimeHashString("rightEyeBrowUp");
+        static constexpr int leftEyeLeft_HASH = HashingUtils::CompileTimeHashString("leftEyeLeft");
+        static constexpr int leftEyeRight_HASH = HashingUtils::CompileTimeHashString("leftEyeRight");
+        static constexpr int leftEyeUp_HASH = HashingUtils::CompileTimeHashString("leftEyeUp");
+        static constexpr int leftEyeDown_HASH = HashingUtils::CompileTimeHashString("leftEyeDown");
+        static constexpr int rightEyeLeft_HASH = HashingUtils::CompileTimeHashString("rightEyeLeft");
+        static constexpr int rightEyeRight_HASH = HashingUtils::CompileTimeHashString("rightEyeRight");
+        static constexpr int rightEyeUp_HASH = HashingUtils::CompileTimeHashString("rightEyeUp");
+        static constexpr int rightEyeDown_HASH = HashingUtils::CompileTimeHashString("rightEyeDown");
+        static constexpr int noseLeft_HASH = HashingUtils::CompileTimeHashString("noseLeft");
+        static constexpr int noseRight_HASH = HashingUtils::CompileTimeHashString("noseRight");
+        static constexpr int mouthUp_HASH = HashingUtils::CompileTimeHashString("mouthUp");
+        static constexpr int mouthDown_HASH = HashingUtils::CompileTimeHashString("mouthDown");
+        static constexpr int leftPupil_HASH = HashingUtils::CompileTimeHashString("leftPupil");
+        static constexpr int rightPupil_HASH = HashingUtils::CompileTimeHashString("rightPupil");
 
 
         LandmarkType GetLandmarkTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == eyeLeft_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LandmarkType::eyeLeft;
-          }
-          else if (hashCode == eyeRight_HASH)
-          {
-            return LandmarkType::eyeRight;
-          }
-          else if (hashCode == nose_HASH)
-          {
-            return LandmarkType::nose;
-          }
-          else if (hashCode == mouthLeft_HASH)
-          {
-            return LandmarkType::mouthLeft;
-          }
-          else if (hashCode == mouthRight_HASH)
-          {
-            return LandmarkType::mouthRight;
-          }
-          else if (hashCode == leftEyeBrowLeft_HASH)
-          {
-            return LandmarkType::leftEyeBrowLeft;
-          }
-          else if (hashCode == leftEyeBrowRight_HASH)
-          {
-            return LandmarkType::leftEyeBrowRight;
-          }
-          else if (hashCode == leftEyeBrowUp_HASH)
-          {
-            return LandmarkType::leftEyeBrowUp;
-          }
-          else if (hashCode == rightEyeBrowLeft_HASH)
-          {
-            return LandmarkType::rightEyeBrowLeft;
-          }
-          else if (hashCode == rightEyeBrowRight_HASH)
-          {
-            return LandmarkType::rightEyeBrowRight;
-          }
-          else if (hashCode == rightEyeBrowUp_HASH)
-          {
-            return LandmarkType::rightEyeBrowUp;
-          }
-          else if (hashCode == leftEyeLeft_HASH)
-          {
-            return LandmarkType::leftEyeLeft;
-          }
-          else if (hashCode == leftEyeRight_HASH)
-          {
-            return LandmarkType::leftEyeRight;
-          }
-          else if (hashCode == leftEyeUp_HASH)
-          {
-            return LandmarkType::leftEyeUp;
-          }
-          else if (hashCode == leftEyeDown_HASH)
-          {
-            return LandmarkType::leftEyeDown;
-          }
-          else if (hashCode == rightEyeLeft_HASH)
-          {
-            return LandmarkType::rightEyeLeft;
-          }
-          else if (hashCode == rightEyeRight_HASH)
-          {
-            return LandmarkType::rightEyeRight;
-          }
-          else if (hashCode == rightEyeUp_HASH)
-          {
-            return LandmarkType::rightEyeUp;
-          }
-          else if (hashCode == rightEyeDown_HASH)
-          {
-            return LandmarkType::rightEyeDown;
-          }
-          else if (hashCode == noseLeft_HASH)
-          {
-            return LandmarkType::noseLeft;
-          }
-          else if (hashCode == noseRight_HASH)
-          {
-            return LandmarkType::noseRight;
-          }
-          else if (hashCode == mouthUp_HASH)
-          {
-            return LandmarkType::mouthUp;
-          }
-          else if (hashCode == mouthDown_HASH)
-          {
-            return LandmarkType::mouthDown;
-          }
-          else if (hashCode == leftPupil_HASH)
-          {
-            return LandmarkType::leftPupil;
-          }
-          else if (hashCode == rightPupil_HASH)
-          {
-            return LandmarkType::rightPupil;
+          case eyeLeft_HASH:
+            if (name == "eyeLeft")
+            {
+              return LandmarkType::eyeLeft;
+            }
+            break;
+          case eyeRight_HASH:
+            if (name == "eyeRight")
+            {
+              return LandmarkType::eyeRight;
+            }
+            break;
+          case nose_HASH:
+            if (name == "nose")
+            {
+              return LandmarkType::nose;
+            }
+            break;
+          case mouthLeft_HASH:
+            if (name == "mouthLeft")
+            {
+              return LandmarkType::mouthLeft;
+            }
+            break;
+          case mouthRight_HASH:
+            if (name == "mouthRight")
+            {
+              return LandmarkType::mouthRight;
+            }
+            break;
+          case leftEyeBrowLeft_HASH:
+            if (name == "leftEyeBrowLeft")
+            {
+              return LandmarkType::leftEyeBrowLeft;
+            }
+            break;
+          case leftEyeBrowRight_HASH:
+            if (name == "leftEyeBrowRight")
+            {
+              return LandmarkType::leftEyeBrowRight;
+            }
+            break;
+          case leftEyeBrowUp_HASH:
+            if (name == "leftEyeBrowUp")
+            {
+              return LandmarkType::leftEyeBrowUp;
+            }
+            break;
+          case rightEyeBrowLeft_HASH:
+            if (name == "rightEyeBrowLeft")
+            {
+              return LandmarkType::rightEyeBrowLeft;
+            }
+            break;
+          case rightEyeBrowRight_HASH:
+            if (name == "rightEyeBrowRight")
+            {
+              return LandmarkType::rightEyeBrowRight;
+            }
+            break;
+          case rightEyeBrowUp_HASH:
+            if (name == "rightEyeBrowUp")
+            {
+              return LandmarkType::rightEyeBrowUp;
+            }
+            break;
+          case leftEyeLeft_HASH:
+            if (name == "leftEyeLeft")
+            {
+              return LandmarkType::leftEyeLeft;
+            }
+            break;
+          case leftEyeRight_HASH:
+            if (name == "leftEyeRight")
+            {
+              return LandmarkType::leftEyeRight;
+            }
+            break;
+          case leftEyeUp_HASH:
+            if (name == "leftEyeUp")
+            {
+              return LandmarkType::leftEyeUp;
+            }
+            break;
+          case leftEyeDown_HASH:
+            if (name == "leftEyeDown")
+            {
+              return LandmarkType::leftEyeDown;
+            }
+            break;
+          case rightEyeLeft_HASH:
+            if (name == "rightEyeLeft")
+            {
+              return LandmarkType::rightEyeLeft;
+            }
+            break;
+          case rightEyeRight_HASH:
+            if (name == "rightEyeRight")
+            {
+              return LandmarkType::rightEyeRight;
+            }
+            break;
+          case rightEyeUp_HASH:
+            if (name == "rightEyeUp")
+            {
+              return LandmarkType::rightEyeUp;
+            }
+            break;
+          case rightEyeDown_HASH:
+            if (name == "rightEyeDown")
+            {
+              return LandmarkType::rightEyeDown;
+            }
+            break;
+          case noseLeft_HASH:
+            if (name == "noseLeft")
+            {
+              return LandmarkType::noseLeft;
+            }
+            break;
+          case noseRight_HASH:
+            if (name == "noseRight")
+            {
+              return LandmarkType::noseRight;
+            }
+            break;
+          case mouthUp_HASH:
+            if (name == "mouthUp")
+            {
+              return LandmarkType::mouthUp;
+            }
+            break;
+          case mouthDown_HASH:
+            if (name == "mouthDown")
+            {
+              return LandmarkType::mouthDown;
+            }
+            break;
+          case leftPupil_HASH:
+            if (name == "leftPupil")
+            {
+              return LandmarkType::leftPupil;
+            }
+            break;
+          case rightPupil_HASH:
+            if (name == "rightPupil")
+            {
+              return LandmarkType::rightPupil;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -170,7 +226,7 @@ namespace Aws
           return LandmarkType::NOT_SET;
         }
 
-        Aws::String GetNameForLandmarkType(LandmarkType enumValue)
+        const char* GetNameForLandmarkType(LandmarkType enumValue)
         {
           switch(enumValue)
           {
@@ -228,7 +284,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
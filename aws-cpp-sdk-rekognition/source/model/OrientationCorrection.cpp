@@ -30,30 +30,44 @@ namespace Aws
       namespace OrientationCorrectionMapper
       {
 
-        static const int ROTATE_0_HASH = HashingUtils::HashString("ROTATE_0");
-        static const int ROTATE_90_HASH = HashingUtils::HashString("ROTATE_90");
-        static const int ROTATE_180_HASH = HashingUtils::HashString("ROTATE_180");
-        static const int ROTATE_270_HASH = HashingUtils::HashString("ROTATE_270");
+        static constexpr int ROTATE_0_HASH = HashingUtils::CompileTimeHashString("ROTATE_0");
+        static constexpr int ROTATE_90_HASH = HashingUtils::CompileTimeHashString("ROTATE_90");
+        static constexpr int ROTATE_180_HASH = HashingUtils::CompileTimeHashString("ROTATE_180");
+        static constexpr int ROTATE_270_HASH = HashingUtils::CompileTimeHashString("ROTATE_270");
 
 
         OrientationCorrection GetOrientationCorrectionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ROTATE_0_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OrientationCorrection::ROTATE_0;
-          }
-          else if (hashCode == ROTATE_90_HASH)
-          {
-            return OrientationCorrection::ROTATE_90;
-          }
-          else if (hashCode == ROTATE_180_HASH)
-          {
-            return OrientationCorrection::ROTATE_180;
-          }
-          else if (hashCode == ROTATE_270_HASH)
-          {
-            return OrientationCorrection::ROTATE_270;
+          case ROTATE_0_HASH:
+            if (name == "ROTATE_0")
+            {
+              return OrientationCorrection::ROTATE_0;
+            }
+            break;
+          case ROTATE_90_HASH:
+            if (name == "ROTATE_90")
+            {
+              return OrientationCorrection::ROTATE_90;
+            }
+            break;
+          case ROTATE_180_HASH:
+            if (name == "ROTATE_180")
+            {
+              return OrientationCorrection::ROTATE_180;
+            }
+            break;
+          case ROTATE_270_HASH:
+            if (name == "ROTATE_270")
+            {
+              return OrientationCorrection::ROTATE_270;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return OrientationCorrection::NOT_SET;
         }
 
-        Aws::String GetNameForOrientationCorrection(OrientationCorrection enumValue)
+        const char* GetNameForOrientationCorrection(OrientationCorrection enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
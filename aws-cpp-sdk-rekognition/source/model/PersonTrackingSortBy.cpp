@@ -30,20 +30,30 @@ namespace Aws
       namespace PersonTrackingSortByMapper
       {
 
-        static const int INDEX_HASH = HashingUtils::HashString("INDEX");
-        static const int TIMESTAMP_HASH = HashingUtils::HashString("TIMESTAMP");
+        static constexpr int INDEX_HASH = HashingUtils::CompileTimeHashString("INDEX");
+        static constexpr int TIMESTAMP_HASH = HashingUtils::CompileTimeHashString("TIMESTAMP");
 
 
         PersonTrackingSortBy GetPersonTrackingSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INDEX_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PersonTrackingSortBy::INDEX;
-          }
-          else if (hashCode == TIMESTAMP_HASH)
-          {
-            return PersonTrackingSortBy::TIMESTAMP;
+          case INDEX_HASH:
+            if (name == "INDEX")
+            {
+              return PersonTrackingSortBy::INDEX;
+            }
+            break;
+          case TIMESTAMP_HASH:
+            if (name == "TIMESTAMP")
+            {
+              return PersonTrackingSortBy::TIMESTAMP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PersonTrackingSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForPersonTrackingSortBy(PersonTrackingSortBy enumValue)
+        const char* GetNameForPersonTrackingSortBy(PersonTrackingSortBy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace StreamProcessorStatusMapper
       {
 
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
+        static constexpr int STARTING_HASH = HashingUtils::CompileTimeHashString("STARTING");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
 
 
         StreamProcessorStatus GetStreamProcessorStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STOPPED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StreamProcessorStatus::STOPPED;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return StreamProcessorStatus::STARTING;
-          }
-          else if (hashCode == RUNNING_HASH)
-          {
-            return StreamProcessorStatus::RUNNING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return StreamProcessorStatus::FAILED;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return StreamProcessorStatus::STOPPING;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return StreamProcessorStatus::STOPPED;
+            }
+            break;
+          case STARTING_HASH:
+            if (name == "STARTING")
+            {
+              return StreamProcessorStatus::STARTING;
+            }
+            break;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return StreamProcessorStatus::RUNNING;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return StreamProcessorStatus::FAILED;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return StreamProcessorStatus::STOPPING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return StreamProcessorStatus::NOT_SET;
         }
 
-        Aws::String GetNameForStreamProcessorStatus(StreamProcessorStatus enumValue)
+        const char* GetNameForStreamProcessorStatus(StreamProcessorStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
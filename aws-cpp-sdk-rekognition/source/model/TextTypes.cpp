@@ -30,20 +30,30 @@ namespace Aws
       namespace TextTypesMapper
       {
 
-        static const int LINE_HASH = HashingUtils::HashString("LINE");
-        static const int WORD_HASH = HashingUtils::HashString("WORD");
+        static constexpr int LINE_HASH = HashingUtils::CompileTimeHashString("LINE");
+        static constexpr int WORD_HASH = HashingUtils::CompileTimeHashString("WORD");
 
 
         TextTypes GetTextTypesForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == LINE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TextTypes::LINE;
-          }
-          else if (hashCode == WORD_HASH)
-          {
-            return TextTypes::WORD;
+          case LINE_HASH:
+            if (name == "LINE")
+            {
+              return TextTypes::LINE;
+            }
+            break;
+          case WORD_HASH:
+            if (name == "WORD")
+            {
+              return TextTypes::WORD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TextTypes::NOT_SET;
         }
 
-        Aws::String GetNameForTextTypes(TextTypes enumValue)
+        const char* GetNameForTextTypes(TextTypes enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
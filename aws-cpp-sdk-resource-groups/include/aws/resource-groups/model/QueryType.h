@@ -33,7 +33,8 @@ namespace QueryTypeMapper
 {
 AWS_RESOURCEGROUPS_API QueryType GetQueryTypeForName(const Aws::String& name);
 
-AWS_RESOURCEGROUPS_API Aws::String GetNameForQueryType(QueryType value);
+// names of values not modeled point into the enum overflow container
+AWS_RESOURCEGROUPS_API const char* GetNameForQueryType(QueryType value);
 } // namespace QueryTypeMapper
 } // namespace Model
 } // namespace ResourceGroups
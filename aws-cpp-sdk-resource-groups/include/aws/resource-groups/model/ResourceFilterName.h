@@ -33,7 +33,8 @@ namespace ResourceFilterNameMapper
 {
 AWS_RESOURCEGROUPS_API ResourceFilterName GetResourceFilterNameForName(const Aws::String& name);
 
-AWS_RESOURCEGROUPS_API Aws::String GetNameForResourceFilterName(ResourceFilterName value);
+// names of values not modeled point into the enum overflow container
+AWS_RESOURCEGROUPS_API const char* GetNameForResourceFilterName(ResourceFilterName value);
 } // namespace ResourceFilterNameMapper
 } // namespace Model
 } // namespace ResourceGroups
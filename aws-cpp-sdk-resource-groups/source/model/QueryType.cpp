@@ -30,15 +30,23 @@ namespace Aws
       namespace QueryTypeMapper
       {
 
-        static const int TAG_FILTERS_1_0_HASH = HashingUtils::HashString("TAG_FILTERS_1_0");
+        static constexpr int TAG_FILTERS_1_0_HASH = HashingUtils::CompileTimeHashString("TAG_FILTERS_1_0");
 
 
         QueryType GetQueryTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TAG_FILTERS_1_0_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QueryType::TAG_FILTERS_1_0;
+          case TAG_FILTERS_1_0_HASH:
+            if (name == "TAG_FILTERS_1_0")
+            {
+              return QueryType::TAG_FILTERS_1_0;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return QueryType::NOT_SET;
         }
 
-        Aws::String GetNameForQueryType(QueryType enumValue)
+        const char* GetNameForQueryType(QueryType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ResourceFilterNameMapper
       {
 
-        static const int resource_type_HASH = HashingUtils::HashString("resource-type");
+        static constexpr int resource_type_HASH = HashingUtils::CompileTimeHashString("resource-type");
 
 
         ResourceFilterName GetResourceFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == resource_type_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceFilterName::resource_type;
+          case resource_type_HASH:
+            if (name == "resource-type")
+            {
+              return ResourceFilterName::resource_type;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ResourceFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForResourceFilterName(ResourceFilterName enumValue)
+        const char* GetNameForResourceFilterName(ResourceFilterName enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
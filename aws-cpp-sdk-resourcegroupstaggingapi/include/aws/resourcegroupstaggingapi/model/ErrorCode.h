@@ -34,7 +34,8 @@ namespace ErrorCodeMapper
 {
 AWS_RESOURCEGROUPSTAGGINGAPI_API ErrorCode GetErrorCodeForName(const Aws::String& name);
 
-AWS_RESOURCEGROUPSTAGGINGAPI_API Aws::String GetNameForErrorCode(ErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_RESOURCEGROUPSTAGGINGAPI_API const char* GetNameForErrorCode(ErrorCode value);
 } // namespace ErrorCodeMapper
 } // namespace Model
 } // namespace ResourceGroupsTaggingAPI
@@ -28,10 +28,10 @@ namespace ResourceGroupsTaggingAPI
 namespace ResourceGroupsTaggingAPIErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int THROTTLED_HASH = HashingUtils::HashString("ThrottledException");
-static const int PAGINATION_TOKEN_EXPIRED_HASH = HashingUtils::HashString("PaginationTokenExpiredException");
-static const int INTERNAL_SERVICE_HASH = HashingUtils::HashString("InternalServiceException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int THROTTLED_HASH = HashingUtils::CompileTimeHashString("ThrottledException");
+static constexpr int PAGINATION_TOKEN_EXPIRED_HASH = HashingUtils::CompileTimeHashString("PaginationTokenExpiredException");
+static constexpr int INTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int InternalServiceException_HASH = HashingUtils::HashString("InternalServiceException");
-        static const int InvalidParameterException_HASH = HashingUtils::HashString("InvalidParameterException");
+        static constexpr int InternalServiceException_HASH = HashingUtils::CompileTimeHashString("InternalServiceException");
+        static constexpr int InvalidParameterException_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
 
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InternalServiceException_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ErrorCode::InternalServiceException;
-          }
-          else if (hashCode == InvalidParameterException_HASH)
-          {
-            return ErrorCode::InvalidParameterException;
+          case InternalServiceException_HASH:
+            if (name == "InternalServiceException")
+            {
+              return ErrorCode::InternalServiceException;
+            }
+            break;
+          case InvalidParameterException_HASH:
+            if (name == "InvalidParameterException")
+            {
+              return ErrorCode::InvalidParameterException;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCode(ErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -37,7 +37,8 @@ namespace AccountLimitTypeMapper
 {
 AWS_ROUTE53_API AccountLimitType GetAccountLimitTypeForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForAccountLimitType(AccountLimitType value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForAccountLimitType(AccountLimitType value);
 } // namespace AccountLimitTypeMapper
 } // namespace Model
 } // namespace Route53
@@ -35,7 +35,8 @@ namespace ChangeActionMapper
 {
 AWS_ROUTE53_API ChangeAction GetChangeActionForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForChangeAction(ChangeAction value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForChangeAction(ChangeAction value);
 } // namespace ChangeActionMapper
 } // namespace Model
 } // namespace Route53
@@ -34,7 +34,8 @@ namespace ChangeStatusMapper
 {
 AWS_ROUTE53_API ChangeStatus GetChangeStatusForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForChangeStatus(ChangeStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForChangeStatus(ChangeStatus value);
 } // namespace ChangeStatusMapper
 } // namespace Model
 } // namespace Route53
@@ -48,7 +48,8 @@ namespace CloudWatchRegionMapper
 {
 AWS_ROUTE53_API CloudWatchRegion GetCloudWatchRegionForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForCloudWatchRegion(CloudWatchRegion value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForCloudWatchRegion(CloudWatchRegion value);
 } // namespace CloudWatchRegionMapper
 } // namespace Model
 } // namespace Route53
@@ -40,7 +40,8 @@ namespace HealthCheckRegionMapper
 {
 AWS_ROUTE53_API HealthCheckRegion GetHealthCheckRegionForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForHealthCheckRegion(HealthCheckRegion value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForHealthCheckRegion(HealthCheckRegion value);
 } // namespace HealthCheckRegionMapper
 } // namespace Model
 } // namespace Route53
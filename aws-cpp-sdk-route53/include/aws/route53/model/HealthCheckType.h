@@ -39,7 +39,8 @@ namespace HealthCheckTypeMapper
 {
 AWS_ROUTE53_API HealthCheckType GetHealthCheckTypeForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForHealthCheckType(HealthCheckType value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForHealthCheckType(HealthCheckType value);
 } // namespace HealthCheckTypeMapper
 } // namespace Model
 } // namespace Route53
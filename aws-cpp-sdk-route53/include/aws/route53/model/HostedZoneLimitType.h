@@ -34,7 +34,8 @@ namespace HostedZoneLimitTypeMapper
 {
 AWS_ROUTE53_API HostedZoneLimitType GetHostedZoneLimitTypeForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForHostedZoneLimitType(HostedZoneLimitType value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForHostedZoneLimitType(HostedZoneLimitType value);
 } // namespace HostedZoneLimitTypeMapper
 } // namespace Model
 } // namespace Route53
@@ -35,7 +35,8 @@ namespace InsufficientDataHealthStatusMapper
 {
 AWS_ROUTE53_API InsufficientDataHealthStatus GetInsufficientDataHealthStatusForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForInsufficientDataHealthStatus(InsufficientDataHealthStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForInsufficientDataHealthStatus(InsufficientDataHealthStatus value);
 } // namespace InsufficientDataHealthStatusMapper
 } // namespace Model
 } // namespace Route53
@@ -44,7 +44,8 @@ namespace RRTypeMapper
 {
 AWS_ROUTE53_API RRType GetRRTypeForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForRRType(RRType value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForRRType(RRType value);
 } // namespace RRTypeMapper
 } // namespace Model
 } // namespace Route53
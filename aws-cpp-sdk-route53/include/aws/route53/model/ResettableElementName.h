@@ -36,7 +36,8 @@ namespace ResettableElementNameMapper
 {
 AWS_ROUTE53_API ResettableElementName GetResettableElementNameForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForResettableElementName(ResettableElementName value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForResettableElementName(ResettableElementName value);
 } // namespace ResettableElementNameMapper
 } // namespace Model
 } // namespace Route53
@@ -34,7 +34,8 @@ namespace ResourceRecordSetFailoverMapper
 {
 AWS_ROUTE53_API ResourceRecordSetFailover GetResourceRecordSetFailoverForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForResourceRecordSetFailover(ResourceRecordSetFailover value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForResourceRecordSetFailover(ResourceRecordSetFailover value);
 } // namespace ResourceRecordSetFailoverMapper
 } // namespace Model
 } // namespace Route53
@@ -50,7 +50,8 @@ namespace ResourceRecordSetRegionMapper
 {
 AWS_ROUTE53_API ResourceRecordSetRegion GetResourceRecordSetRegionForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForResourceRecordSetRegion(ResourceRecordSetRegion value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForResourceRecordSetRegion(ResourceRecordSetRegion value);
 } // namespace ResourceRecordSetRegionMapper
 } // namespace Model
 } // namespace Route53
@@ -33,7 +33,8 @@ namespace ReusableDelegationSetLimitTypeMapper
 {
 AWS_ROUTE53_API ReusableDelegationSetLimitType GetReusableDelegationSetLimitTypeForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForReusableDelegationSetLimitType(ReusableDelegationSetLimitType value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForReusableDelegationSetLimitType(ReusableDelegationSetLimitType value);
 } // namespace ReusableDelegationSetLimitTypeMapper
 } // namespace Model
 } // namespace Route53
@@ -37,7 +37,8 @@ namespace StatisticMapper
 {
 AWS_ROUTE53_API Statistic GetStatisticForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForStatistic(Statistic value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForStatistic(Statistic value);
 } // namespace StatisticMapper
 } // namespace Model
 } // namespace Route53
@@ -34,7 +34,8 @@ namespace TagResourceTypeMapper
 {
 AWS_ROUTE53_API TagResourceType GetTagResourceTypeForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForTagResourceType(TagResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForTagResourceType(TagResourceType value);
 } // namespace TagResourceTypeMapper
 } // namespace Model
 } // namespace Route53
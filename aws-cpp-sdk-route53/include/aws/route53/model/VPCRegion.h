@@ -49,7 +49,8 @@ namespace VPCRegionMapper
 {
 AWS_ROUTE53_API VPCRegion GetVPCRegionForName(const Aws::String& name);
 
-AWS_ROUTE53_API Aws::String GetNameForVPCRegion(VPCRegion value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53_API const char* GetNameForVPCRegion(VPCRegion value);
 } // namespace VPCRegionMapper
 } // namespace Model
 } // namespace Route53
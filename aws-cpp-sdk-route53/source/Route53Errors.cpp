@@ -28,56 +28,56 @@ namespace Route53
 namespace Route53ErrorMapper
 {
 
-static const int TOO_MANY_TRAFFIC_POLICY_INSTANCES_HASH = HashingUtils::HashString("TooManyTrafficPolicyInstances");
-static const int DELEGATION_SET_ALREADY_CREATED_HASH = HashingUtils::HashString("DelegationSetAlreadyCreated");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModification");
-static const int HOSTED_ZONE_NOT_FOUND_HASH = HashingUtils::HashString("HostedZoneNotFound");
-static const int NO_SUCH_DELEGATION_SET_HASH = HashingUtils::HashString("NoSuchDelegationSet");
-static const int LAST_V_P_C_ASSOCIATION_HASH = HashingUtils::HashString("LastVPCAssociation");
-static const int TOO_MANY_HOSTED_ZONES_HASH = HashingUtils::HashString("TooManyHostedZones");
-static const int NO_SUCH_CHANGE_HASH = HashingUtils::HashString("NoSuchChange");
-static const int QUERY_LOGGING_CONFIG_ALREADY_EXISTS_HASH = HashingUtils::HashString("QueryLoggingConfigAlreadyExists");
-static const int CONFLICTING_TYPES_HASH = HashingUtils::HashString("ConflictingTypes");
-static const int TOO_MANY_TRAFFIC_POLICY_VERSIONS_FOR_CURRENT_POLICY_HASH = HashingUtils::HashString("TooManyTrafficPolicyVersionsForCurrentPolicy");
-static const int INVALID_TRAFFIC_POLICY_DOCUMENT_HASH = HashingUtils::HashString("InvalidTrafficPolicyDocument");
-static const int LIMITS_EXCEEDED_HASH = HashingUtils::HashString("LimitsExceeded");
-static const int NO_SUCH_TRAFFIC_POLICY_HASH = HashingUtils::HashString("NoSuchTrafficPolicy");
-static const int CONFLICTING_DOMAIN_EXISTS_HASH = HashingUtils::HashString("ConflictingDomainExists");
-static const int NO_SUCH_QUERY_LOGGING_CONFIG_HASH = HashingUtils::HashString("NoSuchQueryLoggingConfig");
-static const int DELEGATION_SET_IN_USE_HASH = HashingUtils::HashString("DelegationSetInUse");
-static const int INVALID_DOMAIN_NAME_HASH = HashingUtils::HashString("InvalidDomainName");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInput");
-static const int HEALTH_CHECK_ALREADY_EXISTS_HASH = HashingUtils::HashString("HealthCheckAlreadyExists");
-static const int HOSTED_ZONE_ALREADY_EXISTS_HASH = HashingUtils::HashString("HostedZoneAlreadyExists");
-static const int HEALTH_CHECK_IN_USE_HASH = HashingUtils::HashString("HealthCheckInUse");
-static const int INVALID_V_P_C_ID_HASH = HashingUtils::HashString("InvalidVPCId");
-static const int PRIOR_REQUEST_NOT_COMPLETE_HASH = HashingUtils::HashString("PriorRequestNotComplete");
-static const int TOO_MANY_V_P_C_ASSOCIATION_AUTHORIZATIONS_HASH = HashingUtils::HashString("TooManyVPCAssociationAuthorizations");
-static const int INCOMPATIBLE_VERSION_HASH = HashingUtils::HashString("IncompatibleVersion");
-static const int V_P_C_ASSOCIATION_NOT_FOUND_HASH = HashingUtils::HashString("VPCAssociationNotFound");
-static const int NO_SUCH_GEO_LOCATION_HASH = HashingUtils::HashString("NoSuchGeoLocation");
-static const int DELEGATION_SET_NOT_AVAILABLE_HASH = HashingUtils::HashString("DelegationSetNotAvailable");
-static const int NO_SUCH_TRAFFIC_POLICY_INSTANCE_HASH = HashingUtils::HashString("NoSuchTrafficPolicyInstance");
-static const int INVALID_ARGUMENT_HASH = HashingUtils::HashString("InvalidArgument");
-static const int V_P_C_ASSOCIATION_AUTHORIZATION_NOT_FOUND_HASH = HashingUtils::HashString("VPCAssociationAuthorizationNotFound");
-static const int PUBLIC_ZONE_V_P_C_ASSOCIATION_HASH = HashingUtils::HashString("PublicZoneVPCAssociation");
-static const int NO_SUCH_HOSTED_ZONE_HASH = HashingUtils::HashString("NoSuchHostedZone");
-static const int DELEGATION_SET_NOT_REUSABLE_HASH = HashingUtils::HashString("DelegationSetNotReusable");
-static const int TRAFFIC_POLICY_IN_USE_HASH = HashingUtils::HashString("TrafficPolicyInUse");
-static const int TOO_MANY_HEALTH_CHECKS_HASH = HashingUtils::HashString("TooManyHealthChecks");
-static const int INVALID_CHANGE_BATCH_HASH = HashingUtils::HashString("InvalidChangeBatch");
-static const int NOT_AUTHORIZED_HASH = HashingUtils::HashString("NotAuthorizedException");
-static const int HOSTED_ZONE_NOT_PRIVATE_HASH = HashingUtils::HashString("HostedZoneNotPrivate");
-static const int HEALTH_CHECK_VERSION_MISMATCH_HASH = HashingUtils::HashString("HealthCheckVersionMismatch");
-static const int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::HashString("InvalidPaginationToken");
-static const int TRAFFIC_POLICY_INSTANCE_ALREADY_EXISTS_HASH = HashingUtils::HashString("TrafficPolicyInstanceAlreadyExists");
-static const int HOSTED_ZONE_NOT_EMPTY_HASH = HashingUtils::HashString("HostedZoneNotEmpty");
-static const int NO_SUCH_CLOUD_WATCH_LOGS_LOG_GROUP_HASH = HashingUtils::HashString("NoSuchCloudWatchLogsLogGroup");
-static const int TOO_MANY_TRAFFIC_POLICIES_HASH = HashingUtils::HashString("TooManyTrafficPolicies");
-static const int DELEGATION_SET_ALREADY_REUSABLE_HASH = HashingUtils::HashString("DelegationSetAlreadyReusable");
-static const int INSUFFICIENT_CLOUD_WATCH_LOGS_RESOURCE_POLICY_HASH = HashingUtils::HashString("InsufficientCloudWatchLogsResourcePolicy");
-static const int TRAFFIC_POLICY_ALREADY_EXISTS_HASH = HashingUtils::HashString("TrafficPolicyAlreadyExists");
-static const int NO_SUCH_HEALTH_CHECK_HASH = HashingUtils::HashString("NoSuchHealthCheck");
+static constexpr int TOO_MANY_TRAFFIC_POLICY_INSTANCES_HASH = HashingUtils::CompileTimeHashString("TooManyTrafficPolicyInstances");
+static constexpr int DELEGATION_SET_ALREADY_CREATED_HASH = HashingUtils::CompileTimeHashString("DelegationSetAlreadyCreated");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModification");
+static constexpr int HOSTED_ZONE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("HostedZoneNotFound");
+static constexpr int NO_SUCH_DELEGATION_SET_HASH = HashingUtils::CompileTimeHashString("NoSuchDelegationSet");
+static constexpr int LAST_V_P_C_ASSOCIATION_HASH = HashingUtils::CompileTimeHashString("LastVPCAssociation");
+static constexpr int TOO_MANY_HOSTED_ZONES_HASH = HashingUtils::CompileTimeHashString("TooManyHostedZones");
+static constexpr int NO_SUCH_CHANGE_HASH = HashingUtils::CompileTimeHashString("NoSuchChange");
+static constexpr int QUERY_LOGGING_CONFIG_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("QueryLoggingConfigAlreadyExists");
+static constexpr int CONFLICTING_TYPES_HASH = HashingUtils::CompileTimeHashString("ConflictingTypes");
+static constexpr int TOO_MANY_TRAFFIC_POLICY_VERSIONS_FOR_CURRENT_POLICY_HASH = HashingUtils::CompileTimeHashString("TooManyTrafficPolicyVersionsForCurrentPolicy");
+static constexpr int INVALID_TRAFFIC_POLICY_DOCUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidTrafficPolicyDocument");
+static constexpr int LIMITS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitsExceeded");
+static constexpr int NO_SUCH_TRAFFIC_POLICY_HASH = HashingUtils::CompileTimeHashString("NoSuchTrafficPolicy");
+static constexpr int CONFLICTING_DOMAIN_EXISTS_HASH = HashingUtils::CompileTimeHashString("ConflictingDomainExists");
+static constexpr int NO_SUCH_QUERY_LOGGING_CONFIG_HASH = HashingUtils::CompileTimeHashString("NoSuchQueryLoggingConfig");
+static constexpr int DELEGATION_SET_IN_USE_HASH = HashingUtils::CompileTimeHashString("DelegationSetInUse");
+static constexpr int INVALID_DOMAIN_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidDomainName");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInput");
+static constexpr int HEALTH_CHECK_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("HealthCheckAlreadyExists");
+static constexpr int HOSTED_ZONE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("HostedZoneAlreadyExists");
+static constexpr int HEALTH_CHECK_IN_USE_HASH = HashingUtils::CompileTimeHashString("HealthCheckInUse");
+static constexpr int INVALID_V_P_C_ID_HASH = HashingUtils::CompileTimeHashString("InvalidVPCId");
+static constexpr int PRIOR_REQUEST_NOT_COMPLETE_HASH = HashingUtils::CompileTimeHashString("PriorRequestNotComplete");
+static constexpr int TOO_MANY_V_P_C_ASSOCIATION_AUTHORIZATIONS_HASH = HashingUtils::CompileTimeHashString("TooManyVPCAssociationAuthorizations");
+static constexpr int INCOMPATIBLE_VERSION_HASH = HashingUtils::CompileTimeHashString("IncompatibleVersion");
+static constexpr int V_P_C_ASSOCIATION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("VPCAssociationNotFound");
+static constexpr int NO_SUCH_GEO_LOCATION_HASH = HashingUtils::CompileTimeHashString("NoSuchGeoLocation");
+static constexpr int DELEGATION_SET_NOT_AVAILABLE_HASH = HashingUtils::CompileTimeHashString("DelegationSetNotAvailable");
+static constexpr int NO_SUCH_TRAFFIC_POLICY_INSTANCE_HASH = HashingUtils::CompileTimeHashString("NoSuchTrafficPolicyInstance");
+static constexpr int INVALID_ARGUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidArgument");
+static constexpr int V_P_C_ASSOCIATION_AUTHORIZATION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("VPCAssociationAuthorizationNotFound");
+static constexpr int PUBLIC_ZONE_V_P_C_ASSOCIATION_HASH = HashingUtils::CompileTimeHashString("PublicZoneVPCAssociation");
+static constexpr int NO_SUCH_HOSTED_ZONE_HASH = HashingUtils::CompileTimeHashString("NoSuchHostedZone");
+static constexpr int DELEGATION_SET_NOT_REUSABLE_HASH = HashingUtils::CompileTimeHashString("DelegationSetNotReusable");
+static constexpr int TRAFFIC_POLICY_IN_USE_HASH = HashingUtils::CompileTimeHashString("TrafficPolicyInUse");
+static constexpr int TOO_MANY_HEALTH_CHECKS_HASH = HashingUtils::CompileTimeHashString("TooManyHealthChecks");
+static constexpr int INVALID_CHANGE_BATCH_HASH = HashingUtils::CompileTimeHashString("InvalidChangeBatch");
+static constexpr int NOT_AUTHORIZED_HASH = HashingUtils::CompileTimeHashString("NotAuthorizedException");
+static constexpr int HOSTED_ZONE_NOT_PRIVATE_HASH = HashingUtils::CompileTimeHashString("HostedZoneNotPrivate");
+static constexpr int HEALTH_CHECK_VERSION_MISMATCH_HASH = HashingUtils::CompileTimeHashString("HealthCheckVersionMismatch");
+static constexpr int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidPaginationToken");
+static constexpr int TRAFFIC_POLICY_INSTANCE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("TrafficPolicyInstanceAlreadyExists");
+static constexpr int HOSTED_ZONE_NOT_EMPTY_HASH = HashingUtils::CompileTimeHashString("HostedZoneNotEmpty");
+static constexpr int NO_SUCH_CLOUD_WATCH_LOGS_LOG_GROUP_HASH = HashingUtils::CompileTimeHashString("NoSuchCloudWatchLogsLogGroup");
+static constexpr int TOO_MANY_TRAFFIC_POLICIES_HASH = HashingUtils::CompileTimeHashString("TooManyTrafficPolicies");
+static constexpr int DELEGATION_SET_ALREADY_REUSABLE_HASH = HashingUtils::CompileTimeHashString("DelegationSetAlreadyReusable");
+static constexpr int INSUFFICIENT_CLOUD_WATCH_LOGS_RESOURCE_POLICY_HASH = HashingUtils::CompileTimeHashString("InsufficientCloudWatchLogsResourcePolicy");
+static constexpr int TRAFFIC_POLICY_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("TrafficPolicyAlreadyExists");
+static constexpr int NO_SUCH_HEALTH_CHECK_HASH = HashingUtils::CompileTimeHashString("NoSuchHealthCheck");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
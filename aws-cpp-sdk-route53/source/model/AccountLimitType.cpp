@@ -30,35 +30,51 @@ namespace Aws
       namespace AccountLimitTypeMapper
       {
 
-        static const int MAX_HEALTH_CHECKS_BY_OWNER_HASH = HashingUtils::HashString("MAX_HEALTH_CHECKS_BY_OWNER");
-        static const int MAX_HOSTED_ZONES_BY_OWNER_HASH = HashingUtils::HashString("MAX_HOSTED_ZONES_BY_OWNER");
-        static const int MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER_HASH = HashingUtils::HashString("MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER");
-        static const int MAX_REUSABLE_DELEGATION_SETS_BY_OWNER_HASH = HashingUtils::HashString("MAX_REUSABLE_DELEGATION_SETS_BY_OWNER");
-        static const int MAX_TRAFFIC_POLICIES_BY_OWNER_HASH = HashingUtils::HashString("MAX_TRAFFIC_POLICIES_BY_OWNER");
+        static constexpr int MAX_HEALTH_CHECKS_BY_OWNER_HASH = HashingUtils::CompileTimeHashString("MAX_HEALTH_CHECKS_BY_OWNER");
+        static constexpr int MAX_HOSTED_ZONES_BY_OWNER_HASH = HashingUtils::CompileTimeHashString("MAX_HOSTED_ZONES_BY_OWNER");
+        static constexpr int MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER_HASH = HashingUtils::CompileTimeHashString("MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER");
+        static constexpr int MAX_REUSABLE_DELEGATION_SETS_BY_OWNER_HASH = HashingUtils::CompileTimeHashString("MAX_REUSABLE_DELEGATION_SETS_BY_OWNER");
+        static constexpr int MAX_TRAFFIC_POLICIES_BY_OWNER_HASH = HashingUtils::CompileTimeHashString("MAX_TRAFFIC_POLICIES_BY_OWNER");
 
 
         AccountLimitType GetAccountLimitTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_HEALTH_CHECKS_BY_OWNER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccountLimitType::MAX_HEALTH_CHECKS_BY_OWNER;
-          }
-          else if (hashCode == MAX_HOSTED_ZONES_BY_OWNER_HASH)
-          {
-            return AccountLimitType::MAX_HOSTED_ZONES_BY_OWNER;
-          }
-          else if (hashCode == MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER_HASH)
-          {
-            return AccountLimitType::MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER;
-          }
-          else if (hashCode == MAX_REUSABLE_DELEGATION_SETS_BY_OWNER_HASH)
-          {
-            return AccountLimitType::MAX_REUSABLE_DELEGATION_SETS_BY_OWNER;
-          }
-          else if (hashCode == MAX_TRAFFIC_POLICIES_BY_OWNER_HASH)
-          {
-            return AccountLimitType::MAX_TRAFFIC_POLICIES_BY_OWNER;
+          case MAX_HEALTH_CHECKS_BY_OWNER_HASH:
+            if (name == "MAX_HEALTH_CHECKS_BY_OWNER")
+            {
+              return AccountLimitType::MAX_HEALTH_CHECKS_BY_OWNER;
+            }
+            break;
+          case MAX_HOSTED_ZONES_BY_OWNER_HASH:
+            if (name == "MAX_HOSTED_ZONES_BY_OWNER")
+            {
+              return AccountLimitType::MAX_HOSTED_ZONES_BY_OWNER;
+            }
+            break;
+          case MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER_HASH:
+            if (name == "MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER")
+            {
+              return AccountLimitType::MAX_TRAFFIC_POLICY_INSTANCES_BY_OWNER;
+            }
+            break;
+          case MAX_REUSABLE_DELEGATION_SETS_BY_OWNER_HASH:
+            if (name == "MAX_REUSABLE_DELEGATION_SETS_BY_OWNER")
+            {
+              return AccountLimitType::MAX_REUSABLE_DELEGATION_SETS_BY_OWNER;
+            }
+            break;
+          case MAX_TRAFFIC_POLICIES_BY_OWNER_HASH:
+            if (name == "MAX_TRAFFIC_POLICIES_BY_OWNER")
+            {
+              return AccountLimitType::MAX_TRAFFIC_POLICIES_BY_OWNER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return AccountLimitType::NOT_SET;
         }
 
-        Aws::String GetNameForAccountLimitType(AccountLimitType enumValue)
+        const char* GetNameForAccountLimitType(AccountLimitType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ChangeActionMapper
       {
 
-        static const int CREATE_HASH = HashingUtils::HashString("CREATE");
-        static const int DELETE__HASH = HashingUtils::HashString("DELETE");
-        static const int UPSERT_HASH = HashingUtils::HashString("UPSERT");
+        static constexpr int CREATE_HASH = HashingUtils::CompileTimeHashString("CREATE");
+        static constexpr int DELETE__HASH = HashingUtils::CompileTimeHashString("DELETE");
+        static constexpr int UPSERT_HASH = HashingUtils::CompileTimeHashString("UPSERT");
 
 
         ChangeAction GetChangeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeAction::CREATE;
-          }
-          else if (hashCode == DELETE__HASH)
-          {
-            return ChangeAction::DELETE_;
-          }
-          else if (hashCode == UPSERT_HASH)
-          {
-            return ChangeAction::UPSERT;
+          case CREATE_HASH:
+            if (name == "CREATE")
+            {
+              return ChangeAction::CREATE;
+            }
+            break;
+          case DELETE__HASH:
+            if (name == "DELETE")
+            {
+              return ChangeAction::DELETE_;
+            }
+            break;
+          case UPSERT_HASH:
+            if (name == "UPSERT")
+            {
+              return ChangeAction::UPSERT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ChangeAction::NOT_SET;
         }
 
-        Aws::String GetNameForChangeAction(ChangeAction enumValue)
+        const char* GetNameForChangeAction(ChangeAction enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ChangeStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int INSYNC_HASH = HashingUtils::HashString("INSYNC");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int INSYNC_HASH = HashingUtils::CompileTimeHashString("INSYNC");
 
 
         ChangeStatus GetChangeStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeStatus::PENDING;
-          }
-          else if (hashCode == INSYNC_HASH)
-          {
-            return ChangeStatus::INSYNC;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ChangeStatus::PENDING;
+            }
+            break;
+          case INSYNC_HASH:
+            if (name == "INSYNC")
+            {
+              return ChangeStatus::INSYNC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ChangeStatus::NOT_SET;
         }
 
-        Aws::String GetNameForChangeStatus(ChangeStatus enumValue)
+        const char* GetNameForChangeStatus(ChangeStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
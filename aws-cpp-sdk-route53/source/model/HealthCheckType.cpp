@@ -30,45 +30,65 @@ namespace Aws
       namespace HealthCheckTypeMapper
       {
 
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int HTTPS_HASH = HashingUtils::HashString("HTTPS");
-        static const int HTTP_STR_MATCH_HASH = HashingUtils::HashString("HTTP_STR_MATCH");
-        static const int HTTPS_STR_MATCH_HASH = HashingUtils::HashString("HTTPS_STR_MATCH");
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
-        static const int CALCULATED_HASH = HashingUtils::HashString("CALCULATED");
-        static const int CLOUDWATCH_METRIC_HASH = HashingUtils::HashString("CLOUDWATCH_METRIC");
+        static constexpr int HTTP_HASH = HashingUtils::CompileTimeHashString("HTTP");
+        static constexpr int HTTPS_HASH = HashingUtils::CompileTimeHashString("HTTPS");
+        static constexpr int HTTP_STR_MATCH_HASH = HashingUtils::CompileTimeHashString("HTTP_STR_MATCH");
+        static constexpr int HTTPS_STR_MATCH_HASH = HashingUtils::CompileTimeHashString("HTTPS_STR_MATCH");
+        static constexpr int TCP_HASH = HashingUtils::CompileTimeHashString("TCP");
+        static constexpr int CALCULATED_HASH = HashingUtils::CompileTimeHashString("CALCULATED");
+        static constexpr int CLOUDWATCH_METRIC_HASH = HashingUtils::CompileTimeHashString("CLOUDWATCH_METRIC");
 
 
         HealthCheckType GetHealthCheckTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HealthCheckType::HTTP;
-          }
-          else if (hashCode == HTTPS_HASH)
-          {
-            return HealthCheckType::HTTPS;
-          }
-          else if (hashCode == HTTP_STR_MATCH_HASH)
-          {
-            return HealthCheckType::HTTP_STR_MATCH;
-          }
-          else if (hashCode == HTTPS_STR_MATCH_HASH)
-          {
-            return HealthCheckType::HTTPS_STR_MATCH;
-          }
-          else if (hashCode == TCP_HASH)
-          {
-            return HealthCheckType::TCP;
-          }
-          else if (hashCode == CALCULATED_HASH)
-          {
-            return HealthCheckType::CALCULATED;
-          }
-          else if (hashCode == CLOUDWATCH_METRIC_HASH)
-          {
-            return HealthCheckType::CLOUDWATCH_METRIC;
+          case HTTP_HASH:
+            if (name == "HTTP")
+            {
+              return HealthCheckType::HTTP;
+            }
+            break;
+          case HTTPS_HASH:
+            if (name == "HTTPS")
+            {
+              return HealthCheckType::HTTPS;
+            }
+            break;
+          case HTTP_STR_MATCH_HASH:
+            if (name == "HTTP_STR_MATCH")
+            {
+              return HealthCheckType::HTTP_STR_MATCH;
+            }
+            break;
+          case HTTPS_STR_MATCH_HASH:
+            if (name == "HTTPS_STR_MATCH")
+            {
+              return HealthCheckType::HTTPS_STR_MATCH;
+            }
+            break;
+          case TCP_HASH:
+            if (name == "TCP")
+            {
+              return HealthCheckType::TCP;
+            }
+            break;
+          case CALCULATED_HASH:
+            if (name == "CALCULATED")
+            {
+              return HealthCheckType::CALCULATED;
+            }
+            break;
+          case CLOUDWATCH_METRIC_HASH:
+            if (name == "CLOUDWATCH_METRIC")
+            {
+              return HealthCheckType::CLOUDWATCH_METRIC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return HealthCheckType::NOT_SET;
         }
 
-        Aws::String GetNameForHealthCheckType(HealthCheckType enumValue)
+        const char* GetNameForHealthCheckType(HealthCheckType enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
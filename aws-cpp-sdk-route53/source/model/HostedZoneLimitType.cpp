@@ -30,20 +30,30 @@ namespace Aws
       namespace HostedZoneLimitTypeMapper
       {
 
-        static const int MAX_RRSETS_BY_ZONE_HASH = HashingUtils::HashString("MAX_RRSETS_BY_ZONE");
-        static const int MAX_VPCS_ASSOCIATED_BY_ZONE_HASH = HashingUtils::HashString("MAX_VPCS_ASSOCIATED_BY_ZONE");
+        static constexpr int MAX_RRSETS_BY_ZONE_HASH = HashingUtils::CompileTimeHashString("MAX_RRSETS_BY_ZONE");
+        static constexpr int MAX_VPCS_ASSOCIATED_BY_ZONE_HASH = HashingUtils::CompileTimeHashString("MAX_VPCS_ASSOCIATED_BY_ZONE");
 
 
         HostedZoneLimitType GetHostedZoneLimitTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_RRSETS_BY_ZONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HostedZoneLimitType::MAX_RRSETS_BY_ZONE;
-          }
-          else if (hashCode == MAX_VPCS_ASSOCIATED_BY_ZONE_HASH)
-          {
-            return HostedZoneLimitType::MAX_VPCS_ASSOCIATED_BY_ZONE;
+          case MAX_RRSETS_BY_ZONE_HASH:
+            if (name == "MAX_RRSETS_BY_ZONE")
+            {
+              return HostedZoneLimitType::MAX_RRSETS_BY_ZONE;
+            }
+            break;
+          case MAX_VPCS_ASSOCIATED_BY_ZONE_HASH:
+            if (name == "MAX_VPCS_ASSOCIATED_BY_ZONE")
+            {
+              return HostedZoneLimitType::MAX_VPCS_ASSOCIATED_BY_ZONE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HostedZoneLimitType::NOT_SET;
         }
 
-        Aws::String GetNameForHostedZoneLimitType(HostedZoneLimitType enumValue)
+        const char* GetNameForHostedZoneLimitType(HostedZoneLimitType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
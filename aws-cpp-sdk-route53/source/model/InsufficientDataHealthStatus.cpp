@@ -30,25 +30,37 @@ namespace Aws
       namespace InsufficientDataHealthStatusMapper
       {
 
-        static const int Healthy_HASH = HashingUtils::HashString("Healthy");
-        static const int Unhealthy_HASH = HashingUtils::HashString("Unhealthy");
-        static const int LastKnownStatus_HASH = HashingUtils::HashString("LastKnownStatus");
+        static constexpr int Healthy_HASH = HashingUtils::CompileTimeHashString("Healthy");
+        static constexpr int Unhealthy_HASH = HashingUtils::CompileTimeHashString("Unhealthy");
+        static constexpr int LastKnownStatus_HASH = HashingUtils::CompileTimeHashString("LastKnownStatus");
 
 
         InsufficientDataHealthStatus GetInsufficientDataHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Healthy_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InsufficientDataHealthStatus::Healthy;
-          }
-          else if (hashCode == Unhealthy_HASH)
-          {
-            return InsufficientDataHealthStatus::Unhealthy;
-          }
-          else if (hashCode == LastKnownStatus_HASH)
-          {
-            return InsufficientDataHealthStatus::LastKnownStatus;
+          case Healthy_HASH:
+            if (name == "Healthy")
+            {
+              return InsufficientDataHealthStatus::Healthy;
+            }
+            break;
+          case Unhealthy_HASH:
+            if (name == "Unhealthy")
+            {
+              return InsufficientDataHealthStatus::Unhealthy;
+            }
+            break;
+          case LastKnownStatus_HASH:
+            if (name == "LastKnownStatus")
+            {
+              return InsufficientDataHealthStatus::LastKnownStatus;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return InsufficientDataHealthStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInsufficientDataHealthStatus(InsufficientDataHealthStatus enumValue)
+        const char* GetNameForInsufficientDataHealthStatus(InsufficientDataHealthStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
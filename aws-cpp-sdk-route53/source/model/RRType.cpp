@@ -30,70 +30,100 @@ namespace Aws
       namespace RRTypeMapper
       {
 
-        static const int SOA_HASH = HashingUtils::HashString("SOA");
-        static const int A_HASH = HashingUtils::HashString("A");
-        static const int TXT_HASH = HashingUtils::HashString("TXT");
-        static const int NS_HASH = HashingUtils::HashString("NS");
-        static const int CNAME_HASH = HashingUtils::HashString("CNAME");
-        static const int MX_HASH = HashingUtils::HashString("MX");
-        static const int NAPTR_HASH = HashingUtils::HashString("NAPTR");
-        static const int PTR_HASH = HashingUtils::HashString("PTR");
-        static const int SRV_HASH = HashingUtils::HashString("SRV");
-        static const int SPF_HASH = HashingUtils::HashString("SPF");
-        static const int AAAA_HASH = HashingUtils::HashString("AAAA");
-        static const int CAA_HASH = HashingUtils::HashString("CAA");
+        static constexpr int SOA_HASH = HashingUtils::CompileTimeHashString("SOA");
+        static constexpr int A_HASH = HashingUtils::CompileTimeHashString("A");
+        static constexpr int TXT_HASH = HashingUtils::CompileTimeHashString("TXT");
+        static constexpr int NS_HASH = HashingUtils::CompileTimeHashString("NS");
+        static constexpr int CNAME_HASH = HashingUtils::CompileTimeHashString("CNAME");
+        static constexpr int MX_HASH = HashingUtils::CompileTimeHashString("MX");
+        static constexpr int NAPTR_HASH = HashingUtils::CompileTimeHashString("NAPTR");
+        static constexpr int PTR_HASH = HashingUtils::CompileTimeHashString("PTR");
+        static constexpr int SRV_HASH = HashingUtils::CompileTimeHashString("SRV");
+        static constexpr int SPF_HASH = HashingUtils::CompileTimeHashString("SPF");
+        static constexpr int AAAA_HASH = HashingUtils::CompileTimeHashString("AAAA");
+        static constexpr int CAA_HASH = HashingUtils::CompileTimeHashString("CAA");
 
 
         RRType GetRRTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SOA_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RRType::SOA;
-          }
-          else if (hashCode == A_HASH)
-          {
-            return RRType::A;
-          }
-          else if (hashCode == TXT_HASH)
-          {
-            return RRType::TXT;
-          }
-          else if (hashCode == NS_HASH)
-          {
-            return RRType::NS;
-          }
-          else if (hashCode == CNAME_HASH)
-          {
-            return RRType::CNAME;
-          }
-          else if (hashCode == MX_HASH)
-          {
-            return RRType::MX;
-          }
-          else if (hashCode == NAPTR_HASH)
-          {
-            return RRType::NAPTR;
-          }
-          else if (hashCode == PTR_HASH)
-          {
-            return RRType::PTR;
-          }
-          else if (hashCode == SRV_HASH)
-          {
-            return RRType::SRV;
-          }
-          else if (hashCode == SPF_HASH)
-          {
-            return RRType::SPF;
-          }
-          else if (hashCode == AAAA_HASH)
-          {
-            return RRType::AAAA;
-          }
-          else if (hashCode == CAA_HASH)
-          {
-            return RRType::CAA;
+          case SOA_HASH:
+            if (name == "SOA")
+            {
+              return RRType::SOA;
+            }
+            break;
+          case A_HASH:
+            if (name == "A")
+            {
+              return RRType::A;
+            }
+            break;
+          case TXT_HASH:
+            if (name == "TXT")
+            {
+              return RRType::TXT;
+            }
+            break;
+          case NS_HASH:
+            if (name == "NS")
+            {
+              return RRType::NS;
+            }
+            break;
+          case CNAME_HASH:
+            if (name == "CNAME")
+            {
+              return RRType::CNAME;
+            }
+            break;
+          case MX_HASH:
+            if (name == "MX")
+            {
+              return RRType::MX;
+            }
+            break;
+          case NAPTR_HASH:
+            if (name == "NAPTR")
+            {
+              return RRType::NAPTR;
+            }
+            break;
+          case PTR_HASH:
+            if (name == "PTR")
+            {
+              return RRType::PTR;
+            }
+            break;
+          case SRV_HASH:
+            if (name == "SRV")
+            {
+              return RRType::SRV;
+            }
+            break;
+          case SPF_HASH:
+            if (name == "SPF")
+            {
+              return RRType::SPF;
+            }
+            break;
+          case AAAA_HASH:
+            if (name == "AAAA")
+            {
+              return RRType::AAAA;
+            }
+            break;
+          case CAA_HASH:
+            if (name == "CAA")
+            {
+              return RRType::CAA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return RRType::NOT_SET;
         }
 
-        Aws::String GetNameForRRType(RRType enumValue)
+        const char* GetNameForRRType(RRType enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
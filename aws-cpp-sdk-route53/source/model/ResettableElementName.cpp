@@ -30,30 +30,44 @@ namespace Aws
       namespace ResettableElementNameMapper
       {
 
-        static const int FullyQualifiedDomainName_HASH = HashingUtils::HashString("FullyQualifiedDomainName");
-        static const int Regions_HASH = HashingUtils::HashString("Regions");
-        static const int ResourcePath_HASH = HashingUtils::HashString("ResourcePath");
-        static const int ChildHealthChecks_HASH = HashingUtils::HashString("ChildHealthChecks");
+        static constexpr int FullyQualifiedDomainName_HASH = HashingUtils::CompileTimeHashString("FullyQualifiedDomainName");
+        static constexpr int Regions_HASH = HashingUtils::CompileTimeHashString("Regions");
+        static constexpr int ResourcePath_HASH = HashingUtils::CompileTimeHashString("ResourcePath");
+        static constexpr int ChildHealthChecks_HASH = HashingUtils::CompileTimeHashString("ChildHealthChecks");
 
 
         ResettableElementName GetResettableElementNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FullyQualifiedDomainName_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResettableElementName::FullyQualifiedDomainName;
-          }
-          else if (hashCode == Regions_HASH)
-          {
-            return ResettableElementName::Regions;
-          }
-          else if (hashCode == ResourcePath_HASH)
-          {
-            return ResettableElementName::ResourcePath;
-          }
-          else if (hashCode == ChildHealthChecks_HASH)
-          {
-            return ResettableElementName::ChildHealthChecks;
+          case FullyQualifiedDomainName_HASH:
+            if (name == "FullyQualifiedDomainName")
+            {
+              return ResettableElementName::FullyQualifiedDomainName;
+            }
+            break;
+          case Regions_HASH:
+            if (name == "Regions")
+            {
+              return ResettableElementName::Regions;
+            }
+            break;
+          case ResourcePath_HASH:
+            if (name == "ResourcePath")
+            {
+              return ResettableElementName::ResourcePath;
+            }
+            break;
+          case ChildHealthChecks_HASH:
+            if (name == "ChildHealthChecks")
+            {
+              return ResettableElementName::ChildHealthChecks;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ResettableElementName::NOT_SET;
         }
 
-        Aws::String GetNameForResettableElementName(ResettableElementName enumValue)
+        const char* GetNameForResettableElementName(ResettableElementName enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
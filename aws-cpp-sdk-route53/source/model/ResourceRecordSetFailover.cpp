@@ -30,20 +30,30 @@ namespace Aws
       namespace ResourceRecordSetFailoverMapper
       {
 
-        static const int PRIMARY_HASH = HashingUtils::HashString("PRIMARY");
-        static const int SECONDARY_HASH = HashingUtils::HashString("SECONDARY");
+        static constexpr int PRIMARY_HASH = HashingUtils::CompileTimeHashString("PRIMARY");
+        static constexpr int SECONDARY_HASH = HashingUtils::CompileTimeHashString("SECONDARY");
 
 
         ResourceRecordSetFailover GetResourceRecordSetFailoverForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRIMARY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceRecordSetFailover::PRIMARY;
-          }
-          else if (hashCode == SECONDARY_HASH)
-          {
-            return ResourceRecordSetFailover::SECONDARY;
+          case PRIMARY_HASH:
+            if (name == "PRIMARY")
+            {
+              return ResourceRecordSetFailover::PRIMARY;
+            }
+            break;
+          case SECONDARY_HASH:
+            if (name == "SECONDARY")
+            {
+              return ResourceRecordSetFailover::SECONDARY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ResourceRecordSetFailover::NOT_SET;
         }
 
-        Aws::String GetNameForResourceRecordSetFailover(ResourceRecordSetFailover enumValue)
+        const char* GetNameForResourceRecordSetFailover(ResourceRecordSetFailover enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
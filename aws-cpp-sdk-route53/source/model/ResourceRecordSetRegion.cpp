@@ -30,100 +30,142 @@ namespace Aws
       namespace ResourceRecordSetRegionMapper
       {
 
-        static const int us_east_1_HASH = HashingUtils::HashString("us-east-1");
-        static const int us_east_2_HASH = HashingUtils::HashString("us-east-2");
-        static const int us_west_1_HASH = HashingUtils::HashString("us-west-1");
-        static const int us_west_2_HASH = HashingUtils::HashString("us-west-2");
-        static const int ca_central_1_HASH = HashingUtils::HashString("ca-central-1");
-        static const int eu_west_1_HASH = HashingUtils::HashString("eu-west-1");
-        static const int eu_west_2_HASH = HashingUtils::HashString("eu-west-2");
-        static const int eu_west_3_HASH = HashingUtils::HashString("eu-west-3");
-        static const int eu_central_1_HASH = HashingUtils::HashString("eu-central-1");
-        static const int ap_southeast_1_HASH = HashingUtils::HashString("ap-southeast-1");
-        static const int ap_southeast_2_HASH = HashingUtils::HashString("ap-southeast-2");
-        static const int ap_northeast_1_HASH = HashingUtils::HashString("ap-northeast-1");
-        static const int ap_northeast_2_HASH = HashingUtils::HashString("ap-northeast-2");
-        static const int ap_northeast_3_HASH = HashingUtils::HashString("ap-northeast-3");
-        static const int sa_east_1_HASH = HashingUtils::HashString("sa-east-1");
-        static const int cn_north_1_HASH = HashingUtils::HashString("cn-north-1");
-        static const int cn_northwest_1_HASH = HashingUtils::HashString("cn-northwest-1");
-        static const int ap_south_1_HASH = HashingUtils::HashString("ap-south-1");
+        static constexpr int us_east_1_HASH = HashingUtils::CompileTimeHashString("us-east-1");
+        static constexpr int us_east_2_HASH = HashingUtils::CompileTimeHashString("us-east-2");
+        static constexpr int us_west_1_HASH = HashingUtils::CompileTimeHashString("us-west-1");
+        static constexpr int us_west_2_HASH = HashingUtils::CompileTimeHashString("us-west-2");
+        static constexpr int ca_central_1_HASH = HashingUtils::CompileTimeHashString("ca-central-1");
+        static constexpr int eu_west_1_HASH = HashingUtils::CompileTimeHashString("eu-west-1");
+        static constexpr int eu_west_2_HASH = HashingUtils::CompileTimeHashString("eu-west-2");
+        static constexpr int eu_west_3_HASH = HashingUtils::CompileTimeHashString("eu-west-3");
+        static constexpr int eu_central_1_HASH = HashingUtils::CompileTimeHashString("eu-central-1");
+        static constexpr int ap_southeast_1_HASH = HashingUtils::CompileTimeHashString("ap-southeast-1");
+        static constexpr int ap_southeast_2_HASH = HashingUtils::CompileTimeHashString("ap-southeast-2");
+        static constexpr int ap_northeast_1_HASH = HashingUtils::CompileTimeHashString("ap-northeast-1");
+        static constexpr int ap_northeast_2_HASH = HashingUtils::CompileTimeHashString("ap-northeast-2");
+        static constexpr int ap_northeast_3_HASH = HashingUtils::CompileTimeHashString("ap-northeast-3");
+        static constexpr int sa_east_1_HASH = HashingUtils::CompileTimeHashString("sa-east-1");
+        static constexpr int cn_north_1_HASH = HashingUtils::CompileTimeHashString("cn-north-1");
+        static constexpr int cn_northwest_1_HASH = HashingUtils::CompileTimeHashString("cn-northwest-1");
+        static constexpr int ap_south_1_HASH = HashingUtils::CompileTimeHashString("ap-south-1");
 
 
         ResourceRecordSetRegion GetResourceRecordSetRegionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == us_east_1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceRecordSetRegion::us_east_1;
-          }
-          else if (hashCode == us_east_2_HASH)
-          {
-            return ResourceRecordSetRegion::us_east_2;
-          }
-          else if (hashCode == us_west_1_HASH)
-          {
-            return ResourceRecordSetRegion::us_west_1;
-          }
-          else if (hashCode == us_west_2_HASH)
-          {
-            return ResourceRecordSetRegion::us_west_2;
-          }
-          else if (hashCode == ca_central_1_HASH)
-          {
-            return ResourceRecordSetRegion::ca_central_1;
-          }
-          else if (hashCode == eu_west_1_HASH)
-          {
-            return ResourceRecordSetRegion::eu_west_1;
-          }
-          else if (hashCode == eu_west_2_HASH)
-          {
-            return ResourceRecordSetRegion::eu_west_2;
-          }
-          else if (hashCode == eu_west_3_HASH)
-          {
-            return ResourceRecordSetRegion::eu_west_3;
-          }
-          else if (hashCode == eu_central_1_HASH)
-          {
-            return ResourceRecordSetRegion::eu_central_1;
-          }
-          else if (hashCode == ap_southeast_1_HASH)
-          {
-            return ResourceRecordSetRegion::ap_southeast_1;
-          }
-          else if (hashCode == ap_southeast_2_HASH)
-          {
-            return ResourceRecordSetRegion::ap_southeast_2;
-          }
-          else if (hashCode == ap_northeast_1_HASH)
-          {
-            return ResourceRecordSetRegion::ap_northeast_1;
-          }
-          else if (hashCode == ap_northeast_2_HASH)
-          {
-            return ResourceRecordSetRegion::ap_northeast_2;
-          }
-          else if (hashCode == ap_northeast_3_HASH)
-          {
-            return ResourceRecordSetRegion::ap_northeast_3;
-          }
-          else if (hashCode == sa_east_1_HASH)
-          {
-            return ResourceRecordSetRegion::sa_east_1;
-          }
-          else if (hashCode == cn_north_1_HASH)
-          {
-            return ResourceRecordSetRegion::cn_north_1;
-          }
-          else if (hashCode == cn_northwest_1_HASH)
-          {
-            return ResourceRecordSetRegion::cn_northwest_1;
-          }
-          else if (hashCode == ap_south_1_HASH)
-          {
-            return ResourceRecordSetRegion::ap_south_1;
+          case us_east_1_HASH:
+            if (name == "us-east-1")
+            {
+              return ResourceRecordSetRegion::us_east_1;
+            }
+            break;
+          case us_east_2_HASH:
+            if (name == "us-east-2")
+            {
+              return ResourceRecordSetRegion::us_east_2;
+            }
+            break;
+          case us_west_1_HASH:
+            if (name == "us-west-1")
+            {
+              return ResourceRecordSetRegion::us_west_1;
+            }
+            break;
+          case us_west_2_HASH:
+            if (name == "us-west-2")
+            {
+              return ResourceRecordSetRegion::us_west_2;
+            }
+            break;
+          case ca_central_1_HASH:
+            if (name == "ca-central-1")
+            {
+              return ResourceRecordSetRegion::ca_central_1;
+            }
+            break;
+          case eu_west_1_HASH:
+            if (name == "eu-west-1")
+            {
+              return ResourceRecordSetRegion::eu_west_1;
+            }
+            break;
+          case eu_west_2_HASH:
+            if (name == "eu-west-2")
+            {
+              return ResourceRecordSetRegion::eu_west_2;
+            }
+            break;
+          case eu_west_3_HASH:
+            if (name == "eu-west-3")
+            {
+              return ResourceRecordSetRegion::eu_west_3;
+            }
+            break;
+          case eu_central_1_HASH:
+            if (name == "eu-central-1")
+            {
+              return ResourceRecordSetRegion::eu_central_1;
+            }
+            break;
+          case ap_southeast_1_HASH:
+            if (name == "ap-southeast-1")
+            {
+              return ResourceRecordSetRegion::ap_southeast_1;
+            }
+            break;
+          case ap_southeast_2_HASH:
+            if (name == "ap-southeast-2")
+            {
+              return ResourceRecordSetRegion::ap_southeast_2;
+            }
+            break;
+          case ap_northeast_1_HASH:
+            if (name == "ap-northeast-1")
+            {
+              return ResourceRecordSetRegion::ap_northeast_1;
+            }
+            break;
+          case ap_northeast_2_HASH:
+            if (name == "ap-northeast-2")
+            {
+              return ResourceRecordSetRegion::ap_northeast_2;
+            }
+            break;
+          case ap_northeast_3_HASH:
+            if (name == "ap-northeast-3")
+            {
+              return ResourceRecordSetRegion::ap_northeast_3;
+            }
+            break;
+          case sa_east_1_HASH:
+            if (name == "sa-east-1")
+            {
+              return ResourceRecordSetRegion::sa_east_1;
+            }
+            break;
+          case cn_north_1_HASH:
+            if (name == "cn-north-1")
+            {
+              return ResourceRecordSetRegion::cn_north_1;
+            }
+            break;
+          case cn_northwest_1_HASH:
+            if (name == "cn-northwest-1")
+            {
+              return ResourceRecordSetRegion::cn_northwest_1;
+            }
+            break;
+          case ap_south_1_HASH:
+            if (name == "ap-south-1")
+            {
+              return ResourceRecordSetRegion::ap_south_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -135,7 +177,7 @@ namespace Aws
           return ResourceRecordSetRegion::NOT_SET;
         }
 
-        Aws::String GetNameForResourceRecordSetRegion(ResourceRecordSetRegion enumValue)
+        const char* GetNameForResourceRecordSetRegion(ResourceRecordSetRegion enumValue)
         {
           switch(enumValue)
           {
@@ -179,7 +221,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
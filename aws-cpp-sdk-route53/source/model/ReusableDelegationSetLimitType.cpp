@@ -30,15 +30,23 @@ namespace Aws
       namespace ReusableDelegationSetLimitTypeMapper
       {
 
-        static const int MAX_ZONES_BY_REUSABLE_DELEGATION_SET_HASH = HashingUtils::HashString("MAX_ZONES_BY_REUSABLE_DELEGATION_SET");
+        static constexpr int MAX_ZONES_BY_REUSABLE_DELEGATION_SET_HASH = HashingUtils::CompileTimeHashString("MAX_ZONES_BY_REUSABLE_DELEGATION_SET");
 
 
         ReusableDelegationSetLimitType GetReusableDelegationSetLimitTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MAX_ZONES_BY_REUSABLE_DELEGATION_SET_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReusableDelegationSetLimitType::MAX_ZONES_BY_REUSABLE_DELEGATION_SET;
+          case MAX_ZONES_BY_REUSABLE_DELEGATION_SET_HASH:
+            if (name == "MAX_ZONES_BY_REUSABLE_DELEGATION_SET")
+            {
+              return ReusableDelegationSetLimitType::MAX_ZONES_BY_REUSABLE_DELEGATION_SET;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ReusableDelegationSetLimitType::NOT_SET;
         }
 
-        Aws::String GetNameForReusableDelegationSetLimitType(ReusableDelegationSetLimitType enumValue)
+        const char* GetNameForReusableDelegationSetLimitType(ReusableDelegationSetLimitType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace StatisticMapper
       {
 
-        static const int Average_HASH = HashingUtils::HashString("Average");
-        static const int Sum_HASH = HashingUtils::HashString("Sum");
-        static const int SampleCount_HASH = HashingUtils::HashString("SampleCount");
-        static const int Maximum_HASH = HashingUtils::HashString("Maximum");
-        static const int Minimum_HASH = HashingUtils::HashString("Minimum");
+        static constexpr int Average_HASH = HashingUtils::CompileTimeHashString("Average");
+        static constexpr int Sum_HASH = HashingUtils::CompileTimeHashString("Sum");
+        static constexpr int SampleCount_HASH = HashingUtils::CompileTimeHashString("SampleCount");
+        static constexpr int Maximum_HASH = HashingUtils::CompileTimeHashString("Maximum");
+        static constexpr int Minimum_HASH = HashingUtils::CompileTimeHashString("Minimum");
 
 
         Statistic GetStatisticForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Average_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Statistic::Average;
-          }
-          else if (hashCode == Sum_HASH)
-          {
-            return Statistic::Sum;
-          }
-          else if (hashCode == SampleCount_HASH)
-          {
-            return Statistic::SampleCount;
-          }
-          else if (hashCode == Maximum_HASH)
-          {
-            return Statistic::Maximum;
-          }
-          else if (hashCode == Minimum_HASH)
-          {
-            return Statistic::Minimum;
+          case Average_HASH:
+            if (name == "Average")
+            {
+              return Statistic::Average;
+            }
+            break;
+          case Sum_HASH:
+            if (name == "Sum")
+            {
+              return Statistic::Sum;
+            }
+            break;
+          case SampleCount_HASH:
+            if (name == "SampleCount")
+            {
+              return Statistic::SampleCount;
+            }
+            break;
+          case Maximum_HASH:
+            if (name == "Maximum")
+            {
+              return Statistic::Maximum;
+            }
+            break;
+          case Minimum_HASH:
+            if (name == "Minimum")
+            {
+              return Statistic::Minimum;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Statistic::NOT_SET;
         }
 
-        Aws::String GetNameForStatistic(Statistic enumValue)
+        const char* GetNameForStatistic(Statistic enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace TagResourceTypeMapper
       {
 
-        static const int healthcheck_HASH = HashingUtils::HashString("healthcheck");
-        static const int hostedzone_HASH = HashingUtils::HashString("hostedzone");
+        static constexpr int healthcheck_HASH = HashingUtils::CompileTimeHashString("healthcheck");
+        static constexpr int hostedzone_HASH = HashingUtils::CompileTimeHashString("hostedzone");
 
 
         TagResourceType GetTagResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == healthcheck_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TagResourceType::healthcheck;
-          }
-          else if (hashCode == hostedzone_HASH)
-          {
-            return TagResourceType::hostedzone;
+          case healthcheck_HASH:
+            if (name == "healthcheck")
+            {
+              return TagResourceType::healthcheck;
+            }
+            break;
+          case hostedzone_HASH:
+            if (name == "hostedzone")
+            {
+              return TagResourceType::hostedzone;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TagResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForTagResourceType(TagResourceType enumValue)
+        const char* GetNameForTagResourceType(TagResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
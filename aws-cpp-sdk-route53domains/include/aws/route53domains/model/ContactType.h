@@ -37,7 +37,8 @@ namespace ContactTypeMapper
 {
 AWS_ROUTE53DOMAINS_API ContactType GetContactTypeForName(const Aws::String& name);
 
-AWS_ROUTE53DOMAINS_API Aws::String GetNameForContactType(ContactType value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53DOMAINS_API const char* GetNameForContactType(ContactType value);
 } // namespace ContactTypeMapper
 } // namespace Model
 } // namespace Route53Domains
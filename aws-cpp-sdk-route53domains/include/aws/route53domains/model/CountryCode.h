@@ -261,7 +261,8 @@ namespace CountryCodeMapper
 {
 AWS_ROUTE53DOMAINS_API CountryCode GetCountryCodeForName(const Aws::String& name);
 
-AWS_ROUTE53DOMAINS_API Aws::String GetNameForCountryCode(CountryCode value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53DOMAINS_API const char* GetNameForCountryCode(CountryCode value);
 } // namespace CountryCodeMapper
 } // namespace Model
 } // namespace Route53Domains
@@ -40,7 +40,8 @@ namespace DomainAvailabilityMapper
 {
 AWS_ROUTE53DOMAINS_API DomainAvailability GetDomainAvailabilityForName(const Aws::String& name);
 
-AWS_ROUTE53DOMAINS_API Aws::String GetNameForDomainAvailability(DomainAvailability value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53DOMAINS_API const char* GetNameForDomainAvailability(DomainAvailability value);
 } // namespace DomainAvailabilityMapper
 } // namespace Model
 } // namespace Route53Domains
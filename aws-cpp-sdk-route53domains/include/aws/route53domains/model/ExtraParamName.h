@@ -58,7 +58,8 @@ namespace ExtraParamNameMapper
 {
 AWS_ROUTE53DOMAINS_API ExtraParamName GetExtraParamNameForName(const Aws::String& name);
 
-AWS_ROUTE53DOMAINS_API Aws::String GetNameForExtraParamName(ExtraParamName value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53DOMAINS_API const char* GetNameForExtraParamName(ExtraParamName value);
 } // namespace ExtraParamNameMapper
 } // namespace Model
 } // namespace Route53Domains
@@ -37,7 +37,8 @@ namespace OperationStatusMapper
 {
 AWS_ROUTE53DOMAINS_API OperationStatus GetOperationStatusForName(const Aws::String& name);
 
-AWS_ROUTE53DOMAINS_API Aws::String GetNameForOperationStatus(OperationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53DOMAINS_API const char* GetNameForOperationStatus(OperationStatus value);
 } // namespace OperationStatusMapper
 } // namespace Model
 } // namespace Route53Domains
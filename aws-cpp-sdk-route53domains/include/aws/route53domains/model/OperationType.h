@@ -48,7 +48,8 @@ namespace OperationTypeMapper
 {
 AWS_ROUTE53DOMAINS_API OperationType GetOperationTypeForName(const Aws::String& name);
 
-AWS_ROUTE53DOMAINS_API Aws::String GetNameForOperationType(OperationType value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53DOMAINS_API const char* GetNameForOperationType(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace Route53Domains
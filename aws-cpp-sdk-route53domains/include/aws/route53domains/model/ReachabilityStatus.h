@@ -35,7 +35,8 @@ namespace ReachabilityStatusMapper
 {
 AWS_ROUTE53DOMAINS_API ReachabilityStatus GetReachabilityStatusForName(const Aws::String& name);
 
-AWS_ROUTE53DOMAINS_API Aws::String GetNameForReachabilityStatus(ReachabilityStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53DOMAINS_API const char* GetNameForReachabilityStatus(ReachabilityStatus value);
 } // namespace ReachabilityStatusMapper
 } // namespace Model
 } // namespace Route53Domains
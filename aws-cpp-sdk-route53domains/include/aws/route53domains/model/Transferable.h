@@ -35,7 +35,8 @@ namespace TransferableMapper
 {
 AWS_ROUTE53DOMAINS_API Transferable GetTransferableForName(const Aws::String& name);
 
-AWS_ROUTE53DOMAINS_API Aws::String GetNameForTransferable(Transferable value);
+// names of values not modeled point into the enum overflow container
+AWS_ROUTE53DOMAINS_API const char* GetNameForTransferable(Transferable value);
 } // namespace TransferableMapper
 } // namespace Model
 } // namespace Route53Domains
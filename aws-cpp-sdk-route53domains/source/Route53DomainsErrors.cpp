@@ -28,12 +28,12 @@ namespace Route53Domains
 namespace Route53DomainsErrorMapper
 {
 
-static const int DUPLICATE_REQUEST_HASH = HashingUtils::HashString("DuplicateRequest");
-static const int T_L_D_RULES_VIOLATION_HASH = HashingUtils::HashString("TLDRulesViolation");
-static const int UNSUPPORTED_T_L_D_HASH = HashingUtils::HashString("UnsupportedTLD");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInput");
-static const int OPERATION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OperationLimitExceeded");
-static const int DOMAIN_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DomainLimitExceeded");
+static constexpr int DUPLICATE_REQUEST_HASH = HashingUtils::CompileTimeHashString("DuplicateRequest");
+static constexpr int T_L_D_RULES_VIOLATION_HASH = HashingUtils::CompileTimeHashString("TLDRulesViolation");
+static constexpr int UNSUPPORTED_T_L_D_HASH = HashingUtils::CompileTimeHashString("UnsupportedTLD");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInput");
+static constexpr int OPERATION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("OperationLimitExceeded");
+static constexpr int DOMAIN_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DomainLimitExceeded");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
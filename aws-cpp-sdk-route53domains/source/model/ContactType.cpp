@@ -30,35 +30,51 @@ namespace Aws
       namespace ContactTypeMapper
       {
 
-        static const int PERSON_HASH = HashingUtils::HashString("PERSON");
-        static const int COMPANY_HASH = HashingUtils::HashString("COMPANY");
-        static const int ASSOCIATION_HASH = HashingUtils::HashString("ASSOCIATION");
-        static const int PUBLIC_BODY_HASH = HashingUtils::HashString("PUBLIC_BODY");
-        static const int RESELLER_HASH = HashingUtils::HashString("RESELLER");
+        static constexpr int PERSON_HASH = HashingUtils::CompileTimeHashString("PERSON");
+        static constexpr int COMPANY_HASH = HashingUtils::CompileTimeHashString("COMPANY");
+        static constexpr int ASSOCIATION_HASH = HashingUtils::CompileTimeHashString("ASSOCIATION");
+        static constexpr int PUBLIC_BODY_HASH = HashingUtils::CompileTimeHashString("PUBLIC_BODY");
+        static constexpr int RESELLER_HASH = HashingUtils::CompileTimeHashString("RESELLER");
 
 
         ContactType GetContactTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PERSON_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContactType::PERSON;
-          }
-          else if (hashCode == COMPANY_HASH)
-          {
-            return ContactType::COMPANY;
-          }
-          else if (hashCode == ASSOCIATION_HASH)
-          {
-            return ContactType::ASSOCIATION;
-          }
-          else if (hashCode == PUBLIC_BODY_HASH)
-          {
-            return ContactType::PUBLIC_BODY;
-          }
-          else if (hashCode == RESELLER_HASH)
-          {
-            return ContactType::RESELLER;
+          case PERSON_HASH:
+            if (name == "PERSON")
+            {
+              return ContactType::PERSON;
+            }
+            break;
+          case COMPANY_HASH:
+            if (name == "COMPANY")
+            {
+              return ContactType::COMPANY;
+            }
+            break;
+          case ASSOCIATION_HASH:
+            if (name == "ASSOCIATION")
+            {
+              return ContactType::ASSOCIATION;
+            }
+            break;
+          case PUBLIC_BODY_HASH:
+            if (name == "PUBLIC_BODY")
+            {
+              return ContactType::PUBLIC_BODY;
+            }
+            break;
+          case RESELLER_HASH:
+            if (name == "RESELLER")
+            {
+              return ContactType::RESELLER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ContactType::NOT_SET;
         }
 
-        Aws::String GetNameForContactType(ContactType enumValue)
+        const char* GetNameForContactType(ContactType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
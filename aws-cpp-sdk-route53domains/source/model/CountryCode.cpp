@@ -30,2139 +30,2101 @@ namespace Aws
       namespace CountryCodeMapper
       {
 
-        static const int AD_HASH = HashingUtils::HashString("AD");
-        static const int AE_HASH = HashingUtils::HashString("AE");
-        static const int AF_HASH = HashingUtils::HashString("AF");
-        static const int AG_HASH = HashingUtils::HashString("AG");
-        static const int AI_HASH = HashingUtils::HashString("AI");
-        static const int AL_HASH = HashingUtils::HashString("AL");
-        static const int AM_HASH = HashingUtils::HashString("AM");
-        static const int AN_HASH = HashingUtils::HashString("AN");
-        static const int AO_HASH = HashingUtils::HashString("AO");
-        static const int AQ_HASH = HashingUtils::HashString("AQ");
-        static const int AR_HASH = HashingUtils::HashString("AR");
-        static const int AS_HASH = HashingUtils::HashString("AS");
-        static const int AT_HASH = HashingUtils::HashString("AT");
-        static const int AU_HASH = HashingUtils::HashString("AU");
-        static const int AW_HASH = HashingUtils::HashString("AW");
-        static const int AZ_HASH = HashingUtils::HashString("AZ");
-        static const int BA_HASH = HashingUtils::HashString("BA");
-        static const int BB_HASH = HashingUtils::HashString("BB");
-        static const int BD_HASH = HashingUtils::HashString("BD");
-        static const int BE_HASH = HashingUtils::HashString("BE");
-        static const int BF_HASH = HashingUtils::HashString("BF");
-        static const int BG_HASH = HashingUtils::HashString("BG");
-        static const int BH_HASH = HashingUtils::HashString("BH");
-        static const int BI_HASH = HashingUtils::HashString("BI");
-        static const int BJ_HASH = HashingUtils::HashString("BJ");
-        static const int BL_HASH = HashingUtils::HashString("BL");
-        static const int BM_HASH = HashingUtils::HashString("BM");
-        static const int BN_HASH = HashingUtils::HashString("BN");
-        static const int BO_HASH = HashingUtils::HashString("BO");
-        static const int BR_HASH = HashingUtils::HashString("BR");
-        static const int BS_HASH = HashingUtils::HashString("BS");
-        static const int BT_HASH = HashingUtils::HashString("BT");
-        static const int BW_HASH = HashingUtils::HashString("BW");
-        static const int BY_HASH = HashingUtils::HashString("BY");
-        static const int BZ_HASH = HashingUtils::HashString("BZ");
-        static const int CA_HASH = HashingUtils::HashString("CA");
-        static const int CC_HASH = HashingUtils::HashString("CC");
-        static const int CD_HASH = HashingUtils::HashString("CD");
-        static const int CF_HASH = HashingUtils::HashString("CF");
-        static const int CG_HASH = HashingUtils::HashString("CG");
-        static const int CH_HASH = HashingUtils::HashString("CH");
-        static const int CI_HASH = HashingUtils::HashString("CI");
-        static const int CK_HASH = HashingUtils::HashString("CK");
-        static const int CL_HASH = HashingUtils::HashString("CL");
-        static const int CM_HASH = HashingUtils::HashString("CM");
-        static const int CN_HASH = HashingUtils::HashString("CN");
-        static const int CO_HASH = HashingUtils::HashString("CO");
-        static const int CR_HASH = HashingUtils::HashString("CR");
-        static const int CU_HASH = HashingUtils::HashString("CU");
-        static const int CV_HASH = HashingUtils::HashString("CV");
-        static const int CX_HASH = HashingUtils::HashString("CX");
-        static const int CY_HASH = HashingUtils::HashString("CY");
-        static const int CZ_HASH = HashingUtils::HashString("CZ");
-        static const int DE_HASH = HashingUtils::HashString("DE");
-        static const int DJ_HASH = HashingUtils::HashString("DJ");
-        static const int DK_HASH = HashingUtils::HashString("DK");
-        static const int DM_HASH = HashingUtils::HashString("DM");
-        static const int DO_HASH = HashingUtils::HashString("DO");
-        static const int DZ_HASH = HashingUtils::HashString("DZ");
-        static const int EC_HASH = HashingUtils::HashString("EC");
-        static const int EE_HASH = HashingUtils::HashString("EE");
-        static const int EG_HASH = HashingUtils::HashString("EG");
-        static const int ER_HASH = HashingUtils::HashString("ER");
-        static const int ES_HASH = HashingUtils::HashString("ES");
-        static const int ET_HASH = HashingUtils::HashString("ET");
-        static const int FI_HASH = HashingUtils::HashString("FI");
-        static const int FJ_HASH = HashingUtils::HashString("FJ");
-        static const int FK_HASH = HashingUtils::HashString("FK");
-        static const int FM_HASH = HashingUtils::HashString("FM");
-        static const int FO_HASH = HashingUtils::HashString("FO");
-        static const int FR_HASH = HashingUtils::HashString("FR");
-        static const int GA_HASH = HashingUtils::HashString("GA");
-        static const int GB_HASH = HashingUtils::HashString("GB");
-        static const int GD_HASH = HashingUtils::HashString("GD");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int GH_HASH = HashingUtils::HashString("GH");
-        static const int GI_HASH = HashingUtils::HashString("GI");
-        static const int GL_HASH = HashingUtils::HashString("GL");
-        static const int GM_HASH = HashingUtils::HashString("GM");
-        static const int GN_HASH = HashingUtils::HashString("GN");
-        static const int GQ_HASH = HashingUtils::HashString("GQ");
-        static const int GR_HASH = HashingUtils::HashString("GR");
-        static const int GT_HASH = HashingUtils::HashString("GT");
-        static const int GU_HASH = HashingUtils::HashString("GU");
-        static const int GW_HASH = HashingUtils::HashString("GW");
-        static const int GY_HASH = HashingUtils::HashString("GY");
-        static const int HK_HASH = HashingUtils::HashString("HK");
-        static const int HN_HASH = HashingUtils::HashString("HN");
-        static const int HR_HASH = HashingUtils::HashString("HR");
-        static const int HT_HASH = HashingUtils::HashString("HT");
-        static const int HU_HASH = HashingUtils::HashString("HU");
-        static const int ID_HASH = HashingUtils::HashString("ID");
-        static const int IE_HASH = HashingUtils::HashString("IE");
-        static const int IL_HASH = HashingUtils::HashString("IL");
-        static const int IM_HASH = HashingUtils::HashString("IM");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int IQ_HASH = HashingUtils::HashString("IQ");
-        static const int IR_HASH = HashingUtils::HashString("IR");
-        static const int IS_HASH = HashingUtils::HashString("IS");
-        static const int IT_HASH = HashingUtils::HashString("IT");
-        static const int JM_HASH = HashingUtils::HashString("JM");
-        static const int JO_HASH = HashingUtils::HashString("JO");
-        static const int JP_HASH = HashingUtils::HashString("JP");
-        static const int KE_HASH = HashingUtils::HashString("KE");
-        static const int KG_HASH = HashingUtils::HashString("KG");
-        static const int KH_HASH = HashingUtils::HashString("KH");
-        static const int KI_HASH = HashingUtils::HashString("KI");
-        static const int KM_HASH = HashingUtils::HashString("KM");
-        static const int KN_HASH = HashingUtils::HashString("KN");
-        static const int KP_HASH = HashingUtils::HashString("KP");
-        static const int KR_HASH = HashingUtils::HashString("KR");
-        static const int KW_HASH = HashingUtils::HashString("KW");
-        static const int KY_HASH = HashingUtils::HashString("KY");
-        static const int KZ_HASH = HashingUtils::HashString("KZ");
-        static const int LA_HASH = HashingUtils::HashString("LA");
-        static const int LB_HASH = HashingUtils::HashString("LB");
-        static const int LC_HASH = HashingUtils::HashString("LC");
-        static const int LI_HASH = HashingUtils::HashString("LI");
-        static const int LK_HASH = HashingUtils::HashString("LK");
-        static const int LR_HASH = HashingUtils::HashString("LR");
-        static const int LS_HASH = HashingUtils::HashString("LS");
-        static const int LT_HASH = HashingUtils::HashString("LT");
-        static const int LU_HASH = HashingUtils::HashString("LU");
-        static const int LV_HASH = HashingUtils::HashString("LV");
-        static const int LY_HASH = HashingUtils::HashString("LY");
-        static const int MA_HASH = HashingUtils::HashString("MA");
-        static const int MC_HASH = HashingUtils::HashString("MC");
-        static const int MD_HASH = HashingUtils::HashString("MD");
-        static const int ME_HASH = HashingUtils::HashString("ME");
-        static const int MF_HASH = HashingUtils::HashString("MF");
-        static const int MG_HASH = HashingUtils::HashString("MG");
-        static const int MH_HASH = HashingUtils::HashString("MH");
-        static const int MK_HASH = HashingUtils::HashString("MK");
-        static const int ML_HASH = HashingUtils::HashString("ML");
-        static const int MM_HASH = HashingUtils::HashString("MM");
-        static const int MN_HASH = HashingUtils::HashString("MN");
-        static const int MO_HASH = HashingUtils::HashString("MO");
-        static const int MP_HASH = HashingUtils::HashString("MP");
-        static const int MR_HASH = HashingUtils::HashString("MR");
-        static const int MS_HASH = HashingUtils::HashString("MS");
-        static const int MT_HASH = HashingUtils::HashString("MT");
-        static const int MU_HASH = HashingUtils::HashString("MU");
-        static const int MV_HASH = HashingUtils::HashString("MV");
-        static const int MW_HASH = HashingUtils::HashString("MW");
-        static const int MX_HASH = HashingUtils::HashString("MX");
-        static const int MY_HASH = HashingUtils::HashString("MY");
-        static const int MZ_HASH = HashingUtils::HashString("MZ");
-        static const int NA_HASH = HashingUtils::HashString("NA");
-        static const int NC_HASH = HashingUtils::HashString("NC");
-        static const int NE_HASH = HashingUtils::HashString("NE");
-        static const int NG_HASH = HashingUtils::HashString("NG");
-        static const int NI_HASH = HashingUtils::HashString("NI");
-        static const int NL_HASH = HashingUtils::HashString("NL");
-        static const int NO_HASH = HashingUtils::HashString("NO");
-        static const int NP_HASH = HashingUtils::HashString("NP");
-        static const int NR_HASH = HashingUtils::HashString("NR");
-        static const int NU_HASH = HashingUtils::HashString("NU");
-        static const int NZ_HASH = HashingUtils::HashString("NZ");
-        static const int OM_HASH = HashingUtils::HashString("OM");
-        static const int PA_HASH = HashingUtils::HashString("PA");
-        static const int PE_HASH = HashingUtils::HashString("PE");
-        static const int PF_HASH = HashingUtils::HashString("PF");
-        static const int PG_HASH = HashingUtils::HashString("PG");
-        static const int PH_HASH = HashingUtils::HashString("PH");
-        static const int PK_HASH = HashingUtils::HashString("PK");
-        static const int PL_HASH = HashingUtils::HashString("PL");
-        static const int PM_HASH = HashingUtils::HashString("PM");
-        static const int PN_HASH = HashingUtils::HashString("PN");
-        static const int PR_HASH = HashingUtils::HashString("PR");
-        static const int PT_HASH = HashingUtils::HashString("PT");
-        static const int PW_HASH = HashingUtils::HashString("PW");
-        static const int PY_HASH = HashingUtils::HashString("PY");
-        static const int QA_HASH = HashingUtils::HashString("QA");
-        static const int RO_HASH = HashingUtils::HashString("RO");
-        static const int RS_HASH = HashingUtils::HashString("RS");
-        static const int RU_HASH = HashingUtils::HashString("RU");
-        static const int RW_HASH = HashingUtils::HashString("RW");
-        static const int SA_HASH = HashingUtils::HashString("SA");
-        static const int SB_HASH = HashingUtils::HashString("SB");
-        static const int SC_HASH = HashingUtils::HashString("SC");
-        static const int SD_HASH = HashingUtils::HashString("SD");
-        static const int SE_HASH = HashingUtils::HashString("SE");
-        static const int SG_HASH = HashingUtils::HashString("SG");
-        static const int SH_HASH = HashingUtils::HashString("SH");
-        static const int SI_HASH = HashingUtils::HashString("SI");
-        static const int SK_HASH = HashingUtils::HashString("SK");
-        static const int SL_HASH = HashingUtils::HashString("SL");
-        static const int SM_HASH = HashingUtils::HashString("SM");
-        static const int SN_HASH = HashingUtils::HashString("SN");
-        static const int SO_HASH = HashingUtils::HashString("SO");
-        static const int SR_HASH = HashingUtils::HashString("SR");
-        static const int ST_HASH = HashingUtils::HashString("ST");
-        static const int SV_HASH = HashingUtils::HashString("SV");
-        static const int SY_HASH = HashingUtils::HashString("SY");
-        static const int SZ_HASH = HashingUtils::HashString("SZ");
-        static const int TC_HASH = HashingUtils::HashString("TC");
-        static const int TD_HASH = HashingUtils::HashString("TD");
-        static const int TG_HASH = HashingUtils::HashString("TG");
-        static const int TH_HASH = HashingUtils::HashString("TH");
-        static const int TJ_HASH = HashingUtils::HashString("TJ");
-        static const int TK_HASH = HashingUtils::HashString("TK");
-        static const int TL_HASH = HashingUtils::HashString("TL");
-        static const int TM_HASH = HashingUtils::HashString("TM");
-        static const int TN_HASH = HashingUtils::HashString("TN");
-        static const int TO_HASH = HashingUtils::HashString("TO");
-        static const int TR_HASH = HashingUtils::HashString("TR");
-        static const int TT_HASH = HashingUtils::HashString("TT");
-        static const int TV_HASH = HashingUtils::HashString("TV");
-        static const int TW_HASH = HashingUtils::HashString("TW");
-        static const int TZ_HASH = HashingUtils::HashString("TZ");
-        static const int UA_HASH = HashingUtils::HashString("UA");
-        static const int UG_HASH = HashingUtils::HashString("UG");
-        static const int US_HASH = HashingUtils::HashString("US");
-        static const int UY_HASH = HashingUtils::HashString("UY");
-        static const int UZ_HASH = HashingUtils::HashString("UZ");
-        static const int VA_HASH = HashingUtils::HashString("VA");
-        static const int VC_HASH = HashingUtils::HashString("VC");
-        static const int VE_HASH = HashingUtils::HashString("VE");
-        static const int VG_HASH = HashingUtils::HashString("VG");
-        static const int VI_HASH = HashingUtils::HashString("VI");
-        static const int VN_HASH = HashingUtils::HashString("VN");
-        static const int VU_HASH = HashingUtils::HashString("VU");
-        static const int WF_HASH = HashingUtils::HashString("WF");
-        static const int WS_HASH = HashingUtils::HashString("WS");
-        static const int YE_HASH = HashingUtils::HashString("YE");
-        static const int YT_HASH = HashingUtils::HashString("YT");
-        static const int ZA_HASH = HashingUtils::HashString("ZA");
-        static const int ZM_HASH = HashingUtils::HashString("ZM");
-        static const int ZW_HASH = HashingUtils::HashString("ZW");
+        static constexpr int AD_HASH = HashingUtils::CompileTimeHashString("AD");
+        static constexpr int AE_HASH = HashingUtils::CompileTimeHashString("AE");
+        static constexpr int AF_HASH = HashingUtils::CompileTimeHashString("AF");
+        static constexpr int AG_HASH = HashingUtils::CompileTimeHashString("AG");
+        static constexpr int AI_HASH = HashingUtils::CompileTimeHashString("AI");
+        static constexpr int AL_HASH = HashingUtils::CompileTimeHashString("AL");
+        static constexpr int AM_HASH = HashingUtils::CompileTimeHashString("AM");
+        static constexpr int AN_HASH = HashingUtils::CompileTimeHashString("AN");
+        static constexpr int AO_HASH = HashingUtils::CompileTimeHashString("AO");
+        static constexpr int AQ_HASH = HashingUtils::CompileTimeHashString("AQ");
+        static constexpr int AR_HASH = HashingUtils::CompileTimeHashString("AR");
+        static constexpr int AS_HASH = HashingUtils::CompileTimeHashString("AS");
+        static constexpr int AT_HASH = HashingUtils::CompileTimeHashString("AT");
+        static constexpr int AU_HASH = HashingUtils::CompileTimeHashString("AU");
+        static constexpr int AW_HASH = HashingUtils::CompileTimeHashString("AW");
+        static constexpr int AZ_HASH = HashingUtils::CompileTimeHashString("AZ");
+        static constexpr int BA_HASH = HashingUtils::CompileTimeHashString("BA");
+        static constexpr int BB_HASH = HashingUtils::CompileTimeHashString("BB");
+        static constexpr int BD_HASH = HashingUtils::CompileTimeHashString("BD");
+        static constexpr int BE_HASH = HashingUtils::CompileTimeHashString("BE");
+        static constexpr int BF_HASH = HashingUtils::CompileTimeHashString("BF");
+        static constexpr int BG_HASH = HashingUtils::CompileTimeHashString("BG");
+        static constexpr int BH_HASH = HashingUtils::CompileTimeHashString("BH");
+        static constexpr int BI_HASH = HashingUtils::CompileTimeHashString("BI");
+        static constexpr int BJ_HASH = HashingUtils::CompileTimeHashString("BJ");
+        static constexpr int BL_HASH = HashingUtils::CompileTimeHashString("BL");
+        static constexpr int BM_HASH = HashingUtils::CompileTimeHashString("BM");
+        static constexpr int BN_HASH = HashingUtils::CompileTimeHashString("BN");
+        static constexpr int BO_HASH = HashingUtils::CompileTimeHashString("BO");
+        static constexpr int BR_HASH = HashingUtils::CompileTimeHashString("BR");
+        static constexpr int BS_HASH = HashingUtils::CompileTimeHashString("BS");
+        static constexpr int BT_HASH = HashingUtils::CompileTimeHashString("BT");
+        static constexpr int BW_HASH = HashingUtils::CompileTimeHashString("BW");
+        static constexpr int BY_HASH = HashingUtils::CompileTimeHashString("BY");
+        static constexpr int BZ_HASH = HashingUtils::CompileTimeHashString("BZ");
+        static constexpr int CA_HASH = HashingUtils::CompileTimeHashString("CA");
+        static constexpr int CC_HASH = HashingUtils::CompileTimeHashString("CC");
+        static constexpr int CD_HASH = HashingUtils::CompileTimeHashString("CD");
+        static constexpr int CF_HASH = HashingUtils::CompileTimeHashString("CF");
+        static constexpr int CG_HASH = HashingUtils::CompileTimeHashString("CG");
+        static constexpr int CH_HASH = HashingUtils::CompileTimeHashString("CH");
+        static constexpr int CI_HASH = HashingUtils::CompileTimeHashString("CI");
+        static constexpr int CK_HASH = HashingUtils::CompileTimeHashString("CK");
+        static constexpr int CL_HASH = HashingUtils::CompileTimeHashString("CL");
+        static constexpr int CM_HASH = HashingUtils::CompileTimeHashString("CM");
+        static constexpr int CN_HASH = HashingUtils::CompileTimeHashString("CN");
+        static constexpr int CO_HASH = HashingUtils::CompileTimeHashString("CO");
+        static constexpr int CR_HASH = HashingUtils::CompileTimeHashString("CR");
+        static constexpr int CU_HASH = HashingUtils::CompileTimeHashString("CU");
+        static constexpr int CV_HASH = HashingUtils::CompileTimeHashString("CV");
+        static constexpr int CX_HASH = HashingUtils::CompileTimeHashString("CX");
+        static constexpr int CY_HASH = HashingUtils::CompileTimeHashString("CY");
+        static constexpr int CZ_HASH = HashingUtils::CompileTimeHashString("CZ");
+        static constexpr int DE_HASH = HashingUtils::CompileTimeHashString("DE");
+        static constexpr int DJ_HASH = HashingUtils::CompileTimeHashString("DJ");
+        static constexpr int DK_HASH = HashingUtils::CompileTimeHashString("DK");
+        static constexpr int DM_HASH = HashingUtils::CompileTimeHashString("DM");
+        static constexpr int DO_HASH = HashingUtils::CompileTimeHashString("DO");
+        static constexpr int DZ_HASH = HashingUtils::CompileTimeHashString("DZ");
+        static constexpr int EC_HASH = HashingUtils::CompileTimeHashString("EC");
+        static constexpr int EE_HASH = HashingUtils::CompileTimeHashString("EE");
+        static constexpr int EG_HASH = HashingUtils::CompileTimeHashString("EG");
+        static constexpr int ER_HASH = HashingUtils::CompileTimeHashString("ER");
+        static constexpr int ES_HASH = HashingUtils::CompileTimeHashString("ES");
+        static constexpr int ET_HASH = HashingUtils::CompileTimeHashString("ET");
+        static constexpr int FI_HASH = HashingUtils::CompileTimeHashString("FI");
+        static constexpr int FJ_HASH = HashingUtils::CompileTimeHashString("FJ");
+        static constexpr int FK_HASH = HashingUtils::CompileTimeHashString("FK");
+        static constexpr int FM_HASH = HashingUtils::CompileTimeHashString("FM");
+        static constexpr int FO_HASH = HashingUtils::CompileTimeHashString("FO");
+        static constexpr int FR_HASH = HashingUtils::CompileTimeHashString("FR");
+        static constexpr int GA_HASH = HashingUtils::CompileTimeHashString("GA");
+        static constexpr int GB_HASH = HashingUtils::CompileTimeHashString("GB");
+        static constexpr int GD_HASH = HashingUtils::CompileTimeHashString("GD");
+        static constexpr int GE_HASH = HashingUtils::CompileTimeHashString("GE");
+        static constexpr int GH_HASH = HashingUtils::CompileTimeHashString("GH");
+        static constexpr int GI_HASH = HashingUtils::CompileTimeHashString("GI");
+        static constexpr int GL_HASH = HashingUtils::CompileTimeHashString("GL");
+        static constexpr int GM_HASH = HashingUtils::CompileTimeHashString("GM");
+        static constexpr int GN_HASH = HashingUtils::CompileTimeHashString("GN");
+        static constexpr int GQ_HASH = HashingUtils::CompileTimeHashString("GQ");
+        static constexpr int GR_HASH = HashingUtils::CompileTimeHashString("GR");
+        static constexpr int GT_HASH = HashingUtils::CompileTimeHashString("GT");
+        static constexpr int GU_HASH = HashingUtils::CompileTimeHashString("GU");
+        static constexpr int GW_HASH = HashingUtils::CompileTimeHashString("GW");
+        static constexpr int GY_HASH = HashingUtils::CompileTimeHashString("GY");
+        static constexpr int HK_HASH = HashingUtils::CompileTimeHashString("HK");
+        static constexpr int HN_HASH = HashingUtils::CompileTimeHashString("HN");
+        static constexpr int HR_HASH = HashingUtils::CompileTimeHashString("HR");
+        static constexpr int HT_HASH = HashingUtils::CompileTimeHashString("HT");
+        static constexpr int HU_HASH = HashingUtils::CompileTimeHashString("HU");
+        static constexpr int ID_HASH = HashingUtils::CompileTimeHashString("ID");
+        static constexpr int IE_HASH = HashingUtils::CompileTimeHashString("IE");
+        static constexpr int IL_HASH = HashingUtils::CompileTimeHashString("IL");
+        static constexpr int IM_HASH = HashingUtils::CompileTimeHashString("IM");
+        static constexpr int IN_HASH = HashingUtils::CompileTimeHashString("IN");
+        static constexpr int IQ_HASH = HashingUtils::CompileTimeHashString("IQ");
+        static constexpr int IR_HASH = HashingUtils::CompileTimeHashString("IR");
+        static constexpr int IS_HASH = HashingUtils::CompileTimeHashString("IS");
+        static constexpr int IT_HASH = HashingUtils::CompileTimeHashString("IT");
+        static constexpr int JM_HASH = HashingUtils::CompileTimeHashString("JM");
+        static constexpr int JO_HASH = HashingUtils::CompileTimeHashString("JO");
+        static constexpr int JP_HASH = HashingUtils::CompileTimeHashString("JP");
+        static constexpr int KE_HASH = HashingUtils::CompileTimeHashString("KE");
+        static constexpr int KG_HASH = HashingUtils::CompileTimeHashString("KG");
+        static constexpr int KH_HASH = HashingUtils::CompileTimeHashString("KH");
+        static constexpr int KI_HASH = HashingUtils::CompileTimeHashString("KI");
+        static constexpr int KM_HASH = HashingUtils::CompileTimeHashString("KM");
+        static constexpr int KN_HASH = HashingUtils::CompileTimeHashString("KN");
+        static constexpr int KP_HASH = HashingUtils::CompileTimeHashString("KP");
+        static constexpr int KR_HASH = HashingUtils::CompileTimeHashString("KR");
+        static constexpr int KW_HASH = HashingUtils::CompileTimeHashString("KW");
+        static constexpr int KY_HASH = HashingUtils::CompileTimeHashString("KY");
+        static constexpr int KZ_HASH = HashingUtils::CompileTimeHashString("KZ");
+        static constexpr int LA_HASH = HashingUtils::CompileTimeHashString("LA");
+        static constexpr int LB_HASH = HashingUtils::CompileTimeHashString("LB");
+        static constexpr int LC_HASH = HashingUtils::CompileTimeHashString("LC");
+        static constexpr int LI_HASH = HashingUtils::CompileTimeHashString("LI");
+        static constexpr int LK_HASH = HashingUtils::CompileTimeHashString("LK");
+        static constexpr int LR_HASH = HashingUtils::CompileTimeHashString("LR");
+        static constexpr int LS_HASH = HashingUtils::CompileTimeHashString("LS");
+        static constexpr int LT_HASH = HashingUtils::CompileTimeHashString("LT");
+        static constexpr int LU_HASH = HashingUtils::CompileTimeHashString("LU");
+        static constexpr int LV_HASH = HashingUtils::CompileTimeHashString("LV");
+        static constexpr int LY_HASH = HashingUtils::CompileTimeHashString("LY");
+        static constexpr int MA_HASH = HashingUtils::CompileTimeHashString("MA");
+        static constexpr int MC_HASH = HashingUtils::CompileTimeHashString("MC");
+        static constexpr int MD_HASH = HashingUtils::CompileTimeHashString("MD");
+        static constexpr int ME_HASH = HashingUtils::CompileTimeHashString("ME");
+        static constexpr int MF_HASH = HashingUtils::CompileTimeHashString("MF");
+        static constexpr int MG_HASH = HashingUtils::CompileTimeHashString("MG");
+        static constexpr int MH_HASH = HashingUtils::CompileTimeHashString("MH");
+        static constexpr int MK_HASH = HashingUtils::CompileTimeHashString("MK");
+        static constexpr int ML_HASH = HashingUtils::CompileTimeHashString("ML");
+        static constexpr int MM_HASH = HashingUtils::CompileTimeHashString("MM");
+        static constexpr int MN_HASH = HashingUtils::CompileTimeHashString("MN");
+        static constexpr int MO_HASH = HashingUtils::CompileTimeHashString("MO");
+        static constexpr int MP_HASH = HashingUtils::CompileTimeHashString("MP");
+        static constexpr int MR_HASH = HashingUtils::CompileTimeHashString("MR");
+        static constexpr int MS_HASH = HashingUtils::CompileTimeHashString("MS");
+        static constexpr int MT_HASH = HashingUtils::CompileTimeHashString("MT");
+        static constexpr int MU_HASH = HashingUtils::CompileTimeHashString("MU");
+        static constexpr int MV_HASH = HashingUtils::CompileTimeHashString("MV");
+        static constexpr int MW_HASH = HashingUtils::CompileTimeHashString("MW");
+        static constexpr int MX_HASH = HashingUtils::CompileTimeHashString("MX");
+        static constexpr int MY_HASH = HashingUtils::CompileTimeHashString("MY");
+        static constexpr int MZ_HASH = HashingUtils::CompileTimeHashString("MZ");
+        static constexpr int NA_HASH = HashingUtils::CompileTimeHashString("NA");
+        static constexpr int NC_HASH = HashingUtils::CompileTimeHashString("NC");
+        static constexpr int NE_HASH = HashingUtils::CompileTimeHashString("NE");
+        static constexpr int NG_HASH = HashingUtils::CompileTimeHashString("NG");
+        static constexpr int NI_HASH = HashingUtils::CompileTimeHashString("NI");
+        static constexpr int NL_HASH = HashingUtils::CompileTimeHashString("NL");
+        static constexpr int NO_HASH = HashingUtils::CompileTimeHashString("NO");
+        static constexpr int NP_HASH = HashingUtils::CompileTimeHashString("NP");
+        static constexpr int NR_HASH = HashingUtils::CompileTimeHashString("NR");
+        static constexpr int NU_HASH = HashingUtils::CompileTimeHashString("NU");
+        static constexpr int NZ_HASH = HashingUtils::CompileTimeHashString("NZ");
+        static constexpr int OM_HASH = HashingUtils::CompileTimeHashString("OM");
+        static constexpr int PA_HASH = HashingUtils::CompileTimeHashString("PA");
+        static constexpr int PE_HASH = HashingUtils::CompileTimeHashString("PE");
+        static constexpr int PF_HASH = HashingUtils::CompileTimeHashString("PF");
+        static constexpr int PG_HASH = HashingUtils::CompileTimeHashString("PG");
+        static constexpr int PH_HASH = HashingUtils::CompileTimeHashString("PH");
+        static constexpr int PK_HASH = HashingUtils::CompileTimeHashString("PK");
+        static constexpr int PL_HASH = HashingUtils::CompileTimeHashString("PL");
+        static constexpr int PM_HASH = HashingUtils::CompileTimeHashString("PM");
+        static constexpr int PN_HASH = HashingUtils::CompileTimeHashString("PN");
+        static constexpr int PR_HASH = HashingUtils::CompileTimeHashString("PR");
+        static constexpr int PT_HASH = HashingUtils::CompileTimeHashString("PT");
+        static constexpr int PW_HASH = HashingUtils::CompileTimeHashString("PW");
+        static constexpr int PY_HASH = HashingUtils::CompileTimeHashString("PY");
+        static constexpr int QA_HASH = HashingUtils::CompileTimeHashString("QA");
+        static constexpr int RO_HASH = HashingUtils::CompileTimeHashString("RO");
+        static constexpr int RS_HASH = HashingUtils::CompileTimeHashString("RS");
+        static constexpr int RU_HASH = HashingUtils::CompileTimeHashString("RU");
+        static constexpr int RW_HASH = HashingUtils::CompileTimeHashString("RW");
+        static constexpr int SA_HASH = HashingUtils::CompileTimeHashString("SA");
+        static constexpr int SB_HASH = HashingUtils::CompileTimeHashString("SB");
+        static constexpr int SC_HASH = HashingUtils::CompileTimeHashString("SC");
+        static constexpr int SD_HASH = HashingUtils::CompileTimeHashString("SD");
+        static constexpr int SE_HASH = HashingUtils::CompileTimeHashString("SE");
+        static constexpr int SG_HASH = HashingUtils::CompileTimeHashString("SG");
+        static constexpr int SH_HASH = HashingUtils::CompileTimeHashString("SH");
+        static constexpr int SI_HASH = HashingUtils::CompileTimeHashString("SI");
+        static constexpr int SK_HASH = HashingUtils::CompileTimeHashString("SK");
+        static constexpr int SL_HASH = HashingUtils::CompileTimeHashString("SL");
+        static constexpr int SM_HASH = HashingUtils::CompileTimeHashString("SM");
+        static constexpr int SN_HASH = HashingUtils::CompileTimeHashString("SN");
+        static constexpr int SO_HASH = HashingUtils::CompileTimeHashString("SO");
+        static constexpr int SR_HASH = HashingUtils::CompileTimeHashString("SR");
+        static constexpr int ST_HASH = HashingUtils::CompileTimeHashString("ST");
+        static constexpr int SV_HASH = HashingUtils::CompileTimeHashString("SV");
+        static constexpr int SY_HASH = HashingUtils::CompileTimeHashString("SY");
+        static constexpr int SZ_HASH = HashingUtils::CompileTimeHashString("SZ");
+        static constexpr int TC_HASH = HashingUtils::CompileTimeHashString("TC");
+        static constexpr int TD_HASH = HashingUtils::CompileTimeHashString("TD");
+        static constexpr int TG_HASH = HashingUtils::CompileTimeHashString("TG");
+        static constexpr int TH_HASH = HashingUtils::CompileTimeHashString("TH");
+        static constexpr int TJ_HASH = HashingUtils::CompileTimeHashString("TJ");
+        static constexpr int TK_HASH = HashingUtils::CompileTimeHashString("TK");
+        static constexpr int TL_HASH = HashingUtils::CompileTimeHashString("TL");
+        static constexpr int TM_HASH = HashingUtils::CompileTimeHashString("TM");
+        static constexpr int TN_HASH = HashingUtils::CompileTimeHashString("TN");
+        static constexpr int TO_HASH = HashingUtils::CompileTimeHashString("TO");
+        static constexpr int TR_HASH = HashingUtils::CompileTimeHashString("TR");
+        static constexpr int TT_HASH = HashingUtils::CompileTimeHashString("TT");
+        static constexpr int TV_HASH = HashingUtils::CompileTimeHashString("TV");
+        static constexpr int TW_HASH = HashingUtils::CompileTimeHashString("TW");
+        static constexpr int TZ_HASH = HashingUtils::CompileTimeHashString("TZ");
+        static constexpr int UA_HASH = HashingUtils::CompileTimeHashString("UA");
+        static constexpr int UG_HASH = HashingUtils::CompileTimeHashString("UG");
+        static constexpr int US_HASH = HashingUtils::CompileTimeHashString("US");
+        static constexpr int UY_HASH = HashingUtils::CompileTimeHashString("UY");
+        static constexpr int UZ_HASH = HashingUtils::CompileTimeHashString("UZ");
+        static constexpr int VA_HASH = HashingUtils::CompileTimeHashString("VA");
+        static constexpr int VC_HASH = HashingUtils::CompileTimeHashString("VC");
+        static constexpr int VE_HASH = HashingUtils::CompileTimeHashString("VE");
+        static constexpr int VG_HASH = HashingUtils::CompileTimeHashString("VG");
+        static constexpr int VI_HASH = HashingUtils::CompileTimeHashString("VI");
+        static constexpr int VN_HASH = HashingUtils::CompileTimeHashString("VN");
+        static constexpr int VU_HASH = HashingUtils::CompileTimeHashString("VU");
+        static constexpr int WF_HASH = HashingUtils::CompileTimeHashString("WF");
+        static constexpr int WS_HASH = HashingUtils::CompileTimeHashString("WS");
+        static constexpr int YE_HASH = HashingUtils::CompileTimeHashString("YE");
+        static constexpr int YT_HASH = HashingUtils::CompileTimeHashString("YT");
+        static constexpr int ZA_HASH = HashingUtils::CompileTimeHashString("ZA");
+        static constexpr int ZM_HASH = HashingUtils::CompileTimeHashString("ZM");
+        static constexpr int ZW_HASH = HashingUtils::CompileTimeHashString("ZW");
 
-        /*
-        The if-else chains in this file are converted into a jump table by the compiler,
-        which allows constant time lookup. The chain has been broken into helper functions
-        because MSVC has a maximum of 122 chained if-else blocks.
-        */
-        static bool GetEnumForNameHelper0(int hashCode, CountryCode& enumValue)
-        {
-          if (hashCode == AD_HASH)
-          {
-            enumValue = CountryCode::AD;
-            return true;
-          }
-          else if (hashCode == AE_HASH)
-          {
-            enumValue = CountryCode::AE;
-            return true;
-          }
-          else if (hashCode == AF_HASH)
-          {
-            enumValue = CountryCode::AF;
-            return true;
-          }
-          else if (hashCode == AG_HASH)
-          {
-            enumValue = CountryCode::AG;
-            return true;
-          }
-          else if (hashCode == AI_HASH)
-          {
-            enumValue = CountryCode::AI;
-            return true;
-          }
-          else if (hashCode == AL_HASH)
-          {
-            enumValue = CountryCode::AL;
-            return true;
-          }
-          else if (hashCode == AM_HASH)
-          {
-            enumValue = CountryCode::AM;
-            return true;
-          }
-          else if (hashCode == AN_HASH)
-          {
-            enumValue = CountryCode::AN;
-            return true;
-          }
-          else if (hashCode == AO_HASH)
-          {
-            enumValue = CountryCode::AO;
-            return true;
-          }
-          else if (hashCode == AQ_HASH)
-          {
-            enumValue = CountryCode::AQ;
-            return true;
-          }
-          else if (hashCode == AR_HASH)
-          {
-            enumValue = CountryCode::AR;
-            return true;
-          }
-          else if (hashCode == AS_HASH)
-          {
-            enumValue = CountryCode::AS;
-            return true;
-          }
-          else if (hashCode == AT_HASH)
-          {
-            enumValue = CountryCode::AT;
-            return true;
-          }
-          else if (hashCode == AU_HASH)
-          {
-            enumValue = CountryCode::AU;
-            return true;
-          }
-          else if (hashCode == AW_HASH)
-          {
-            enumValue = CountryCode::AW;
-            return true;
-          }
-          else if (hashCode == AZ_HASH)
-          {
-            enumValue = CountryCode::AZ;
-            return true;
-          }
-          else if (hashCode == BA_HASH)
-          {
-            enumValue = CountryCode::BA;
-            return true;
-          }
-          else if (hashCode == BB_HASH)
-          {
-            enumValue = CountryCode::BB;
-            return true;
-          }
-          else if (hashCode == BD_HASH)
-          {
-            enumValue = CountryCode::BD;
-            return true;
-          }
-          else if (hashCode == BE_HASH)
-          {
-            enumValue = CountryCode::BE;
-            return true;
-          }
-          else if (hashCode == BF_HASH)
-          {
-            enumValue = CountryCode::BF;
-            return true;
-          }
-          else if (hashCode == BG_HASH)
-          {
-            enumValue = CountryCode::BG;
-            return true;
-          }
-          else if (hashCode == BH_HASH)
-          {
-            enumValue = CountryCode::BH;
-            return true;
-          }
-          else if (hashCode == BI_HASH)
-          {
-            enumValue = CountryCode::BI;
-            return true;
-          }
-          else if (hashCode == BJ_HASH)
-          {
-            enumValue = CountryCode::BJ;
-            return true;
-          }
-          else if (hashCode == BL_HASH)
-          {
-            enumValue = CountryCode::BL;
-            return true;
-          }
-          else if (hashCode == BM_HASH)
-          {
-            enumValue = CountryCode::BM;
-            return true;
-          }
-          else if (hashCode == BN_HASH)
-          {
-            enumValue = CountryCode::BN;
-            return true;
-          }
-          else if (hashCode == BO_HASH)
-          {
-            enumValue = CountryCode::BO;
-            return true;
-          }
-          else if (hashCode == BR_HASH)
-          {
-            enumValue = CountryCode::BR;
-            return true;
-          }
-          else if (hashCode == BS_HASH)
-          {
-            enumValue = CountryCode::BS;
-            return true;
-          }
-          else if (hashCode == BT_HASH)
-          {
-            enumValue = CountryCode::BT;
-            return true;
-          }
-          else if (hashCode == BW_HASH)
-          {
-            enumValue = CountryCode::BW;
-            return true;
-          }
-          else if (hashCode == BY_HASH)
-          {
-            enumValue = CountryCode::BY;
-            return true;
-          }
-          else if (hashCode == BZ_HASH)
-          {
-            enumValue = CountryCode::BZ;
-            return true;
-          }
-          else if (hashCode == CA_HASH)
-          {
-            enumValue = CountryCode::CA;
-            return true;
-          }
-          else if (hashCode == CC_HASH)
-          {
-            enumValue = CountryCode::CC;
-            return true;
-          }
-          else if (hashCode == CD_HASH)
-          {
-            enumValue = CountryCode::CD;
-            return true;
-          }
-          else if (hashCode == CF_HASH)
-          {
-            enumValue = CountryCode::CF;
-            return true;
-          }
-          else if (hashCode == CG_HASH)
-          {
-            enumValue = CountryCode::CG;
-            return true;
-          }
-          else if (hashCode == CH_HASH)
-          {
-            enumValue = CountryCode::CH;
-            return true;
-          }
-          else if (hashCode == CI_HASH)
-          {
-            enumValue = CountryCode::CI;
-            return true;
-          }
-          else if (hashCode == CK_HASH)
-          {
-            enumValue = CountryCode::CK;
-            return true;
-          }
-          else if (hashCode == CL_HASH)
-          {
-            enumValue = CountryCode::CL;
-            return true;
-          }
-          else if (hashCode == CM_HASH)
-          {
-            enumValue = CountryCode::CM;
-            return true;
-          }
-          else if (hashCode == CN_HASH)
-          {
-            enumValue = CountryCode::CN;
-            return true;
-          }
-          else if (hashCode == CO_HASH)
-          {
-            enumValue = CountryCode::CO;
-            return true;
-          }
-          else if (hashCode == CR_HASH)
-          {
-            enumValue = CountryCode::CR;
-            return true;
-          }
-          else if (hashCode == CU_HASH)
-          {
-            enumValue = CountryCode::CU;
-            return true;
-          }
-          else if (hashCode == CV_HASH)
-          {
-            enumValue = CountryCode::CV;
-            return true;
-          }
-          else if (hashCode == CX_HASH)
-          {
-            enumValue = CountryCode::CX;
-            return true;
-          }
-          else if (hashCode == CY_HASH)
-          {
-            enumValue = CountryCode::CY;
-            return true;
-          }
-          else if (hashCode == CZ_HASH)
-          {
-            enumValue = CountryCode::CZ;
-            return true;
-          }
-          else if (hashCode == DE_HASH)
-          {
-            enumValue = CountryCode::DE;
-            return true;
-          }
-          else if (hashCode == DJ_HASH)
-          {
-            enumValue = CountryCode::DJ;
-            return true;
-          }
-          else if (hashCode == DK_HASH)
-          {
-            enumValue = CountryCode::DK;
-            return true;
-          }
-          else if (hashCode == DM_HASH)
-          {
-            enumValue = CountryCode::DM;
-            return true;
-          }
-          else if (hashCode == DO_HASH)
-          {
-            enumValue = CountryCode::DO;
-            return true;
-          }
-          else if (hashCode == DZ_HASH)
-          {
-            enumValue = CountryCode::DZ;
-            return true;
-          }
-          else if (hashCode == EC_HASH)
-          {
-            enumValue = CountryCode::EC;
-            return true;
-          }
-          else if (hashCode == EE_HASH)
-          {
-            enumValue = CountryCode::EE;
-            return true;
-          }
-          else if (hashCode == EG_HASH)
-          {
-            enumValue = CountryCode::EG;
-            return true;
-          }
-          else if (hashCode == ER_HASH)
-          {
-            enumValue = CountryCode::ER;
-            return true;
-          }
-          else if (hashCode == ES_HASH)
-          {
-            enumValue = CountryCode::ES;
-            return true;
-          }
-          else if (hashCode == ET_HASH)
-          {
-            enumValue = CountryCode::ET;
-            return true;
-          }
-          else if (hashCode == FI_HASH)
-          {
-            enumValue = CountryCode::FI;
-            return true;
-          }
-          else if (hashCode == FJ_HASH)
-          {
-            enumValue = CountryCode::FJ;
-            return true;
-          }
-          else if (hashCode == FK_HASH)
-          {
-            enumValue = CountryCode::FK;
-            return true;
-          }
-          else if (hashCode == FM_HASH)
-          {
-            enumValue = CountryCode::FM;
-            return true;
-          }
-          else if (hashCode == FO_HASH)
-          {
-            enumValue = CountryCode::FO;
-            return true;
-          }
-          else if (hashCode == FR_HASH)
-          {
-            enumValue = CountryCode::FR;
-            return true;
-          }
-          else if (hashCode == GA_HASH)
-          {
-            enumValue = CountryCode::GA;
-            return true;
-          }
-          else if (hashCode == GB_HASH)
-          {
-            enumValue = CountryCode::GB;
-            return true;
-          }
-          else if (hashCode == GD_HASH)
-          {
-            enumValue = CountryCode::GD;
-            return true;
-          }
-          else if (hashCode == GE_HASH)
-          {
-            enumValue = CountryCode::GE;
-            return true;
-          }
-          else if (hashCode == GH_HASH)
-          {
-            enumValue = CountryCode::GH;
-            return true;
-          }
-          else if (hashCode == GI_HASH)
-          {
-            enumValue = CountryCode::GI;
-            return true;
-          }
-          else if (hashCode == GL_HASH)
-          {
-            enumValue = CountryCode::GL;
-            return true;
-          }
-          else if (hashCode == GM_HASH)
-          {
-            enumValue = CountryCode::GM;
-            return true;
-          }
-          else if (hashCode == GN_HASH)
-          {
-            enumValue = CountryCode::GN;
-            return true;
-          }
-          else if (hashCode == GQ_HASH)
-          {
-            enumValue = CountryCode::GQ;
-            return true;
-          }
-          else if (hashCode == GR_HASH)
-          {
-            enumValue = CountryCode::GR;
-            return true;
-          }
-          else if (hashCode == GT_HASH)
-          {
-            enumValue = CountryCode::GT;
-            return true;
-          }
-          else if (hashCode == GU_HASH)
-          {
-            enumValue = CountryCode::GU;
-            return true;
-          }
-          else if (hashCode == GW_HASH)
-          {
-            enumValue = CountryCode::GW;
-            return true;
-          }
-          else if (hashCode == GY_HASH)
-          {
-            enumValue = CountryCode::GY;
-            return true;
-          }
-          else if (hashCode == HK_HASH)
-          {
-            enumValue = CountryCode::HK;
-            return true;
-          }
-          else if (hashCode == HN_HASH)
-          {
-            enumValue = CountryCode::HN;
-            return true;
-          }
-          else if (hashCode == HR_HASH)
-          {
-            enumValue = CountryCode::HR;
-            return true;
-          }
-          else if (hashCode == HT_HASH)
-          {
-            enumValue = CountryCode::HT;
-            return true;
-          }
-          else if (hashCode == HU_HASH)
-          {
-            enumValue = CountryCode::HU;
-            return true;
-          }
-          else if (hashCode == ID_HASH)
-          {
-            enumValue = CountryCode::ID;
-            return true;
-          }
-          else if (hashCode == IE_HASH)
-          {
-            enumValue = CountryCode::IE;
-            return true;
-          }
-          else if (hashCode == IL_HASH)
-          {
-            enumValue = CountryCode::IL;
-            return true;
-          }
-          else if (hashCode == IM_HASH)
-          {
-            enumValue = CountryCode::IM;
-            return true;
-          }
-          else if (hashCode == IN_HASH)
-          {
-            enumValue = CountryCode::IN;
-            return true;
-          }
-          else if (hashCode == IQ_HASH)
-          {
-            enumValue = CountryCode::IQ;
-            return true;
-          }
-          else if (hashCode == IR_HASH)
-          {
-            enumValue = CountryCode::IR;
-            return true;
-          }
-          else if (hashCode == IS_HASH)
-          {
-            enumValue = CountryCode::IS;
-            return true;
-          }
-          else if (hashCode == IT_HASH)
-          {
-            enumValue = CountryCode::IT;
-            return true;
-          }
-          else if (hashCode == JM_HASH)
-          {
-            enumValue = CountryCode::JM;
-            return true;
-          }
-          else if (hashCode == JO_HASH)
-          {
-            enumValue = CountryCode::JO;
-            return true;
-          }
-          else if (hashCode == JP_HASH)
-          {
-            enumValue = CountryCode::JP;
-            return true;
-          }
-          else if (hashCode == KE_HASH)
-          {
-            enumValue = CountryCode::KE;
-            return true;
-          }
-          else if (hashCode == KG_HASH)
-          {
-            enumValue = CountryCode::KG;
-            return true;
-          }
-          else if (hashCode == KH_HASH)
-          {
-            enumValue = CountryCode::KH;
-            return true;
-          }
-          else if (hashCode == KI_HASH)
-          {
-            enumValue = CountryCode::KI;
-            return true;
-          }
-          else if (hashCode == KM_HASH)
-          {
-            enumValue = CountryCode::KM;
-            return true;
-          }
-          else if (hashCode == KN_HASH)
-          {
-            enumValue = CountryCode::KN;
-            return true;
-          }
-          else if (hashCode == KP_HASH)
-          {
-            enumValue = CountryCode::KP;
-            return true;
-          }
-          else if (hashCode == KR_HASH)
-          {
-            enumValue = CountryCode::KR;
-            return true;
-          }
-          else if (hashCode == KW_HASH)
-          {
-            enumValue = CountryCode::KW;
-            return true;
-          }
-          else if (hashCode == KY_HASH)
-          {
-            enumValue = CountryCode::KY;
-            return true;
-          }
-          else if (hashCode == KZ_HASH)
-          {
-            enumValue = CountryCode::KZ;
-            return true;
-          }
-          else if (hashCode == LA_HASH)
-          {
-            enumValue = CountryCode::LA;
-            return true;
-          }
-          else if (hashCode == LB_HASH)
-          {
-            enumValue = CountryCode::LB;
-            return true;
-          }
-          else if (hashCode == LC_HASH)
-          {
-            enumValue = CountryCode::LC;
-            return true;
-          }
-          else if (hashCode == LI_HASH)
-          {
-            enumValue = CountryCode::LI;
-            return true;
-          }
-          else if (hashCode == LK_HASH)
-          {
-            enumValue = CountryCode::LK;
-            return true;
-          }
-          else if (hashCode == LR_HASH)
-          {
-            enumValue = CountryCode::LR;
-            return true;
-          }
-          else if (hashCode == LS_HASH)
-          {
-            enumValue = CountryCode::LS;
-            return true;
-          }
-          else if (hashCode == LT_HASH)
-          {
-            enumValue = CountryCode::LT;
-            return true;
-          }
-          return false;
-        }
-        static bool GetEnumForNameHelper1(int hashCode, CountryCode& enumValue)
+
+        CountryCode GetCountryCodeForName(const Aws::String& name)
         {
-          if (hashCode == LU_HASH)
-          {
-            enumValue = CountryCode::LU;
-            return true;
-          }
-          else if (hashCode == LV_HASH)
-          {
-            enumValue = CountryCode::LV;
-            return true;
-          }
-          else if (hashCode == LY_HASH)
-          {
-            enumValue = CountryCode::LY;
-            return true;
-          }
-          else if (hashCode == MA_HASH)
-          {
-            enumValue = CountryCode::MA;
-            return true;
-          }
-          else if (hashCode == MC_HASH)
-          {
-            enumValue = CountryCode::MC;
-            return true;
-          }
-          else if (hashCode == MD_HASH)
-          {
-            enumValue = CountryCode::MD;
-            return true;
-          }
-          else if (hashCode == ME_HASH)
-          {
-            enumValue = CountryCode::ME;
-            return true;
-          }
-          else if (hashCode == MF_HASH)
-          {
-            enumValue = CountryCode::MF;
-            return true;
-          }
-          else if (hashCode == MG_HASH)
-          {
-            enumValue = CountryCode::MG;
-            return true;
-          }
-          else if (hashCode == MH_HASH)
-          {
-            enumValue = CountryCode::MH;
-            return true;
-          }
-          else if (hashCode == MK_HASH)
-          {
-            enumValue = CountryCode::MK;
-            return true;
-          }
-          else if (hashCode == ML_HASH)
-          {
-            enumValue = CountryCode::ML;
-            return true;
-          }
-          else if (hashCode == MM_HASH)
-          {
-            enumValue = CountryCode::MM;
-            return true;
-          }
-          else if (hashCode == MN_HASH)
-          {
-            enumValue = CountryCode::MN;
-            return true;
-          }
-          else if (hashCode == MO_HASH)
-          {
-            enumValue = CountryCode::MO;
-            return true;
-          }
-          else if (hashCode == MP_HASH)
-          {
-            enumValue = CountryCode::MP;
-            return true;
-          }
-          else if (hashCode == MR_HASH)
-          {
-            enumValue = CountryCode::MR;
-            return true;
-          }
-          else if (hashCode == MS_HASH)
-          {
-            enumValue = CountryCode::MS;
-            return true;
-          }
-          else if (hashCode == MT_HASH)
-          {
-            enumValue = CountryCode::MT;
-            return true;
-          }
-          else if (hashCode == MU_HASH)
-          {
-            enumValue = CountryCode::MU;
-            return true;
-          }
-          else if (hashCode == MV_HASH)
-          {
-            enumValue = CountryCode::MV;
-            return true;
-          }
-          else if (hashCode == MW_HASH)
-          {
-            enumValue = CountryCode::MW;
-            return true;
-          }
-          else if (hashCode == MX_HASH)
-          {
-            enumValue = CountryCode::MX;
-            return true;
-          }
-          else if (hashCode == MY_HASH)
-          {
-            enumValue = CountryCode::MY;
-            return true;
-          }
-          else if (hashCode == MZ_HASH)
-          {
-            enumValue = CountryCode::MZ;
-            return true;
-          }
-          else if (hashCode == NA_HASH)
-          {
-            enumValue = CountryCode::NA;
-            return true;
-          }
-          else if (hashCode == NC_HASH)
-          {
-            enumValue = CountryCode::NC;
-            return true;
-          }
-          else if (hashCode == NE_HASH)
-          {
-            enumValue = CountryCode::NE;
-            return true;
-          }
-          else if (hashCode == NG_HASH)
-          {
-            enumValue = CountryCode::NG;
-            return true;
-          }
-          else if (hashCode == NI_HASH)
-          {
-            enumValue = CountryCode::NI;
-            return true;
-          }
-          else if (hashCode == NL_HASH)
-          {
-            enumValue = CountryCode::NL;
-            return true;
-          }
-          else if (hashCode == NO_HASH)
-          {
-            enumValue = CountryCode::NO;
-            return true;
-          }
-          else if (hashCode == NP_HASH)
-          {
-            enumValue = CountryCode::NP;
-            return true;
-          }
-          else if (hashCode == NR_HASH)
-          {
-            enumValue = CountryCode::NR;
-            return true;
-          }
-          else if (hashCode == NU_HASH)
-          {
-            enumValue = CountryCode::NU;
-            return true;
-          }
-          else if (hashCode == NZ_HASH)
-          {
-            enumValue = CountryCode::NZ;
-            return true;
-          }
-          else if (hashCode == OM_HASH)
-          {
-            enumValue = CountryCode::OM;
-            return true;
-          }
-          else if (hashCode == PA_HASH)
-          {
-            enumValue = CountryCode::PA;
-            return true;
-          }
-          else if (hashCode == PE_HASH)
-          {
-            enumValue = CountryCode::PE;
-            return true;
-          }
-          else if (hashCode == PF_HASH)
-          {
-            enumValue = CountryCode::PF;
-            return true;
-          }
-          else if (hashCode == PG_HASH)
-          {
-            enumValue = CountryCode::PG;
-            return true;
-          }
-          else if (hashCode == PH_HASH)
-          {
-            enumValue = CountryCode::PH;
-            return true;
-          }
-          else if (hashCode == PK_HASH)
-          {
-            enumValue = CountryCode::PK;
-            return true;
-          }
-          else if (hashCode == PL_HASH)
-          {
-            enumValue = CountryCode::PL;
-            return true;
-          }
-          else if (hashCode == PM_HASH)
-          {
-            enumValue = CountryCode::PM;
-            return true;
-          }
-          else if (hashCode == PN_HASH)
-          {
-            enumValue = CountryCode::PN;
-            return true;
-          }
-          else if (hashCode == PR_HASH)
-          {
-            enumValue = CountryCode::PR;
-            return true;
-          }
-          else if (hashCode == PT_HASH)
-          {
-            enumValue = CountryCode::PT;
-            return true;
-          }
-          else if (hashCode == PW_HASH)
-          {
-            enumValue = CountryCode::PW;
-            return true;
-          }
-          else if (hashCode == PY_HASH)
-          {
-            enumValue = CountryCode::PY;
-            return true;
-          }
-          else if (hashCode == QA_HASH)
-          {
-            enumValue = CountryCode::QA;
-            return true;
-          }
-          else if (hashCode == RO_HASH)
-          {
-            enumValue = CountryCode::RO;
-            return true;
-          }
-          else if (hashCode == RS_HASH)
-          {
-            enumValue = CountryCode::RS;
-            return true;
-          }
-          else if (hashCode == RU_HASH)
-          {
-            enumValue = CountryCode::RU;
-            return true;
-          }
-          else if (hashCode == RW_HASH)
-          {
-            enumValue = CountryCode::RW;
-            return true;
-          }
-          else if (hashCode == SA_HASH)
-          {
-            enumValue = CountryCode::SA;
-            return true;
-          }
-          else if (hashCode == SB_HASH)
-          {
-            enumValue = CountryCode::SB;
-            return true;
-          }
-          else if (hashCode == SC_HASH)
-          {
-            enumValue = CountryCode::SC;
-            return true;
-          }
-          else if (hashCode == SD_HASH)
-          {
-            enumValue = CountryCode::SD;
-            return true;
-          }
-          else if (hashCode == SE_HASH)
-          {
-            enumValue = CountryCode::SE;
-            return true;
-          }
-          else if (hashCode == SG_HASH)
-          {
-            enumValue = CountryCode::SG;
-            return true;
-          }
-          else if (hashCode == SH_HASH)
-          {
-            enumValue = CountryCode::SH;
-            return true;
-          }
-          else if (hashCode == SI_HASH)
-          {
-            enumValue = CountryCode::SI;
-            return true;
-          }
-          else if (hashCode == SK_HASH)
-          {
-            enumValue = CountryCode::SK;
-            return true;
-          }
-          else if (hashCode == SL_HASH)
-          {
-            enumValue = CountryCode::SL;
-            return true;
-          }
-          else if (hashCode == SM_HASH)
-          {
-            enumValue = CountryCode::SM;
-            return true;
-          }
-          else if (hashCode == SN_HASH)
-          {
-            enumValue = CountryCode::SN;
-            return true;
-          }
-          else if (hashCode == SO_HASH)
-          {
-            enumValue = CountryCode::SO;
-            return true;
-          }
-          else if (hashCode == SR_HASH)
-          {
-            enumValue = CountryCode::SR;
-            return true;
-          }
-          else if (hashCode == ST_HASH)
-          {
-            enumValue = CountryCode::ST;
-            return true;
-          }
-          else if (hashCode == SV_HASH)
-          {
-            enumValue = CountryCode::SV;
-            return true;
-          }
-          else if (hashCode == SY_HASH)
-          {
-            enumValue = CountryCode::SY;
-            return true;
-          }
-          else if (hashCode == SZ_HASH)
-          {
-            enumValue = CountryCode::SZ;
-            return true;
-          }
-          else if (hashCode == TC_HASH)
-          {
-            enumValue = CountryCode::TC;
-            return true;
-          }
-          else if (hashCode == TD_HASH)
-          {
-            enumValue = CountryCode::TD;
-            return true;
-          }
-          else if (hashCode == TG_HASH)
-          {
-            enumValue = CountryCode::TG;
-            return true;
-          }
-          else if (hashCode == TH_HASH)
-          {
-            enumValue = CountryCode::TH;
-            return true;
-          }
-          else if (hashCode == TJ_HASH)
-          {
-            enumValue = CountryCode::TJ;
-            return true;
-          }
-          else if (hashCode == TK_HASH)
-          {
-            enumValue = CountryCode::TK;
-            return true;
-          }
-          else if (hashCode == TL_HASH)
-          {
-            enumValue = CountryCode::TL;
-            return true;
-          }
-          else if (hashCode == TM_HASH)
-          {
-            enumValue = CountryCode::TM;
-            return true;
-          }
-          else if (hashCode == TN_HASH)
-          {
-            enumValue = CountryCode::TN;
-            return true;
-          }
-          else if (hashCode == TO_HASH)
-          {
-            enumValue = CountryCode::TO;
-            return true;
-          }
-          else if (hashCode == TR_HASH)
-          {
-            enumValue = CountryCode::TR;
-            return true;
-          }
-          else if (hashCode == TT_HASH)
-          {
-            enumValue = CountryCode::TT;
-            return true;
-          }
-          else if (hashCode == TV_HASH)
-          {
-            enumValue = CountryCode::TV;
-            return true;
-          }
-          else if (hashCode == TW_HASH)
-          {
-            enumValue = CountryCode::TW;
-            return true;
-          }
-          else if (hashCode == TZ_HASH)
-          {
-            enumValue = CountryCode::TZ;
-            return true;
-          }
-          else if (hashCode == UA_HASH)
-          {
-            enumValue = CountryCode::UA;
-            return true;
-          }
-          else if (hashCode == UG_HASH)
-          {
-            enumValue = CountryCode::UG;
-            return true;
-          }
-          else if (hashCode == US_HASH)
-          {
-            enumValue = CountryCode::US;
-            return true;
-          }
-          else if (hashCode == UY_HASH)
-          {
-            enumValue = CountryCode::UY;
-            return true;
-          }
-          else if (hashCode == UZ_HASH)
-          {
-            enumValue = CountryCode::UZ;
-            return true;
-          }
-          else if (hashCode == VA_HASH)
-          {
-            enumValue = CountryCode::VA;
-            return true;
-          }
-          else if (hashCode == VC_HASH)
-          {
-            enumValue = CountryCode::VC;
-            return true;
-          }
-          else if (hashCode == VE_HASH)
-          {
-            enumValue = CountryCode::VE;
-            return true;
-          }
-          else if (hashCode == VG_HASH)
-          {
-            enumValue = CountryCode::VG;
-            return true;
-          }
-          else if (hashCode == VI_HASH)
-          {
-            enumValue = CountryCode::VI;
-            return true;
-          }
-          else if (hashCode == VN_HASH)
-          {
-            enumValue = CountryCode::VN;
-            return true;
-          }
-          else if (hashCode == VU_HASH)
-          {
-            enumValue = CountryCode::VU;
-            return true;
-          }
-          else if (hashCode == WF_HASH)
-          {
-            enumValue = CountryCode::WF;
-            return true;
-          }
-          else if (hashCode == WS_HASH)
-          {
-            enumValue = CountryCode::WS;
-            return true;
-          }
-          else if (hashCode == YE_HASH)
-          {
-            enumValue = CountryCode::YE;
-            return true;
-          }
-          else if (hashCode == YT_HASH)
-          {
-            enumValue = CountryCode::YT;
-            return true;
-          }
-          else if (hashCode == ZA_HASH)
-          {
-            enumValue = CountryCode::ZA;
-            return true;
-          }
-          else if (hashCode == ZM_HASH)
-          {
-            enumValue = CountryCode::ZM;
-            return true;
+          int hashCode = HashingUtils::HashString(name.c_str());
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
+          {
+          case AD_HASH:
+            if (name == "AD")
+            {
+              return CountryCode::AD;
+            }
+            break;
+          case AE_HASH:
+            if (name == "AE")
+            {
+              return CountryCode::AE;
+            }
+            break;
+          case AF_HASH:
+            if (name == "AF")
+            {
+              return CountryCode::AF;
+            }
+            break;
+          case AG_HASH:
+            if (name == "AG")
+            {
+              return CountryCode::AG;
+            }
+            break;
+          case AI_HASH:
+            if (name == "AI")
+            {
+              return CountryCode::AI;
+            }
+            break;
+          case AL_HASH:
+            if (name == "AL")
+            {
+              return CountryCode::AL;
+            }
+            break;
+          case AM_HASH:
+            if (name == "AM")
+            {
+              return CountryCode::AM;
+            }
+            break;
+          case AN_HASH:
+            if (name == "AN")
+            {
+              return CountryCode::AN;
+            }
+            break;
+          case AO_HASH:
+            if (name == "AO")
+            {
+              return CountryCode::AO;
+            }
+            break;
+          case AQ_HASH:
+            if (name == "AQ")
+            {
+              return CountryCode::AQ;
+            }
+            break;
+          case AR_HASH:
+            if (name == "AR")
+            {
+              return CountryCode::AR;
+            }
+            break;
+          case AS_HASH:
+            if (name == "AS")
+            {
+              return CountryCode::AS;
+            }
+            break;
+          case AT_HASH:
+            if (name == "AT")
+            {
+              return CountryCode::AT;
+            }
+            break;
+          case AU_HASH:
+            if (name == "AU")
+            {
+              return CountryCode::AU;
+            }
+            break;
+          case AW_HASH:
+            if (name == "AW")
+            {
+              return CountryCode::AW;
+            }
+            break;
+          case AZ_HASH:
+            if (name == "AZ")
+            {
+              return CountryCode::AZ;
+            }
+            break;
+          case BA_HASH:
+            if (name == "BA")
+            {
+              return CountryCode::BA;
+            }
+            break;
+          case BB_HASH:
+            if (name == "BB")
+            {
+              return CountryCode::BB;
+            }
+            break;
+          case BD_HASH:
+            if (name == "BD")
+            {
+              return CountryCode::BD;
+            }
+            break;
+          case BE_HASH:
+            if (name == "BE")
+            {
+              return CountryCode::BE;
+            }
+            break;
+          case BF_HASH:
+            if (name == "BF")
+            {
+              return CountryCode::BF;
+            }
+            break;
+          case BG_HASH:
+            if (name == "BG")
+            {
+              return CountryCode::BG;
+            }
+            break;
+          case BH_HASH:
+            if (name == "BH")
+            {
+              return CountryCode::BH;
+            }
+            break;
+          case BI_HASH:
+            if (name == "BI")
+            {
+              return CountryCode::BI;
+            }
+            break;
+          case BJ_HASH:
+            if (name == "BJ")
+            {
+              return CountryCode::BJ;
+            }
+            break;
+          case BL_HASH:
+            if (name == "BL")
+            {
+              return CountryCode::BL;
+            }
+            break;
+          case BM_HASH:
+            if (name == "BM")
+            {
+              return CountryCode::BM;
+            }
+            break;
+          case BN_HASH:
+            if (name == "BN")
+            {
+              return CountryCode::BN;
+            }
+            break;
+          case BO_HASH:
+            if (name == "BO")
+            {
+              return CountryCode::BO;
+            }
+            break;
+          case BR_HASH:
+            if (name == "BR")
+            {
+              return CountryCode::BR;
+            }
+            break;
+          case BS_HASH:
+            if (name == "BS")
+            {
+              return CountryCode::BS;
+            }
+            break;
+          case BT_HASH:
+            if (name == "BT")
+            {
+              return CountryCode::BT;
+            }
+            break;
+          case BW_HASH:
+            if (name == "BW")
+            {
+              return CountryCode::BW;
+            }
+            break;
+          case BY_HASH:
+            if (name == "BY")
+            {
+              return CountryCode::BY;
+            }
+            break;
+          case BZ_HASH:
+            if (name == "BZ")
+            {
+              return CountryCode::BZ;
+            }
+            break;
+          case CA_HASH:
+            if (name == "CA")
+            {
+              return CountryCode::CA;
+            }
+            break;
+          case CC_HASH:
+            if (name == "CC")
+            {
+              return CountryCode::CC;
+            }
+            break;
+          case CD_HASH:
+            if (name == "CD")
+            {
+              return CountryCode::CD;
+            }
+            break;
+          case CF_HASH:
+            if (name == "CF")
+            {
+              return CountryCode::CF;
+            }
+            break;
+          case CG_HASH:
+            if (name == "CG")
+            {
+              return CountryCode::CG;
+            }
+            break;
+          case CH_HASH:
+            if (name == "CH")
+            {
+              return CountryCode::CH;
+            }
+            break;
+          case CI_HASH:
+            if (name == "CI")
+            {
+              return CountryCode::CI;
+            }
+            break;
+          case CK_HASH:
+            if (name == "CK")
+            {
+              return CountryCode::CK;
+            }
+            break;
+          case CL_HASH:
+            if (name == "CL")
+            {
+              return CountryCode::CL;
+            }
+            break;
+          case CM_HASH:
+            if (name == "CM")
+            {
+              return CountryCode::CM;
+            }
+            break;
+          case CN_HASH:
+            if (name == "CN")
+            {
+              return CountryCode::CN;
+            }
+            break;
+          case CO_HASH:
+            if (name == "CO")
+            {
+              return CountryCode::CO;
+            }
+            break;
+          case CR_HASH:
+            if (name == "CR")
+            {
+              return CountryCode::CR;
+            }
+            break;
+          case CU_HASH:
+            if (name == "CU")
+            {
+              return CountryCode::CU;
+            }
+            break;
+          case CV_HASH:
+            if (name == "CV")
+            {
+              return CountryCode::CV;
+            }
+            break;
+          case CX_HASH:
+            if (name == "CX")
+            {
+              return CountryCode::CX;
+            }
+            break;
+          case CY_HASH:
+            if (name == "CY")
+            {
+              return CountryCode::CY;
+            }
+            break;
+          case CZ_HASH:
+            if (name == "CZ")
+            {
+              return CountryCode::CZ;
+            }
+            break;
+          case DE_HASH:
+            if (name == "DE")
+            {
+              return CountryCode::DE;
+            }
+            break;
+          case DJ_HASH:
+            if (name == "DJ")
+            {
+              return CountryCode::DJ;
+            }
+            break;
+          case DK_HASH:
+            if (name == "DK")
+            {
+              return CountryCode::DK;
+            }
+            break;
+          case DM_HASH:
+            if (name == "DM")
+            {
+              return CountryCode::DM;
+            }
+            break;
+          case DO_HASH:
+            if (name == "DO")
+            {
+              return CountryCode::DO;
+            }
+            break;
+          case DZ_HASH:
+            if (name == "DZ")
+            {
+              return CountryCode::DZ;
+            }
+            break;
+          case EC_HASH:
+            if (name == "EC")
+            {
+              return CountryCode::EC;
+            }
+            break;
+          case EE_HASH:
+            if (name == "EE")
+            {
+              return CountryCode::EE;
+            }
+            break;
+          case EG_HASH:
+            if (name == "EG")
+            {
+              return CountryCode::EG;
+            }
+            break;
+          case ER_HASH:
+            if (name == "ER")
+            {
+              return CountryCode::ER;
+            }
+            break;
+          case ES_HASH:
+            if (name == "ES")
+            {
+              return CountryCode::ES;
+            }
+            break;
+          case ET_HASH:
+            if (name == "ET")
+            {
+              return CountryCode::ET;
+            }
+            break;
+          case FI_HASH:
+            if (name == "FI")
+            {
+              return CountryCode::FI;
+            }
+            break;
+          case FJ_HASH:
+            if (name == "FJ")
+            {
+              return CountryCode::FJ;
+            }
+            break;
+          case FK_HASH:
+            if (name == "FK")
+            {
+              return CountryCode::FK;
+            }
+            break;
+          case FM_HASH:
+            if (name == "FM")
+            {
+              return CountryCode::FM;
+            }
+            break;
+          case FO_HASH:
+            if (name == "FO")
+            {
+              return CountryCode::FO;
+            }
+            break;
+          case FR_HASH:
+            if (name == "FR")
+            {
+              return CountryCode::FR;
+            }
+            break;
+          case GA_HASH:
+            if (name == "GA")
+            {
+              return CountryCode::GA;
+            }
+            break;
+          case GB_HASH:
+            if (name == "GB")
+            {
+              return CountryCode::GB;
+            }
+            break;
+          case GD_HASH:
+            if (name == "GD")
+            {
+              return CountryCode::GD;
+            }
+            break;
+          case GE_HASH:
+            if (name == "GE")
+            {
+              return CountryCode::GE;
+            }
+            break;
+          case GH_HASH:
+            if (name == "GH")
+            {
+              return CountryCode::GH;
+            }
+            break;
+          case GI_HASH:
+            if (name == "GI")
+            {
+              return CountryCode::GI;
+            }
+            break;
+          case GL_HASH:
+            if (name == "GL")
+            {
+              return CountryCode::GL;
+            }
+            break;
+          case GM_HASH:
+            if (name == "GM")
+            {
+              return CountryCode::GM;
+            }
+            break;
+          case GN_HASH:
+            if (name == "GN")
+            {
+              return CountryCode::GN;
+            }
+            break;
+          case GQ_HASH:
+            if (name == "GQ")
+            {
+              return CountryCode::GQ;
+            }
+            break;
+          case GR_HASH:
+            if (name == "GR")
+            {
+              return CountryCode::GR;
+            }
+            break;
+          case GT_HASH:
+            if (name == "GT")
+            {
+              return CountryCode::GT;
+            }
+            break;
+          case GU_HASH:
+            if (name == "GU")
+            {
+              return CountryCode::GU;
+            }
+            break;
+          case GW_HASH:
+            if (name == "GW")
+            {
+              return CountryCode::GW;
+            }
+            break;
+          case GY_HASH:
+            if (name == "GY")
+            {
+              return CountryCode::GY;
+            }
+            break;
+          case HK_HASH:
+            if (name == "HK")
+            {
+              return CountryCode::HK;
+            }
+            break;
+          case HN_HASH:
+            if (name == "HN")
+            {
+              return CountryCode::HN;
+            }
+            break;
+          case HR_HASH:
+            if (name == "HR")
+            {
+              return CountryCode::HR;
+            }
+            break;
+          case HT_HASH:
+            if (name == "HT")
+            {
+              return CountryCode::HT;
+            }
+            break;
+          case HU_HASH:
+            if (name == "HU")
+            {
+              return CountryCode::HU;
+            }
+            break;
+          case ID_HASH:
+            if (name == "ID")
+            {
+              return CountryCode::ID;
+            }
+            break;
+          case IE_HASH:
+            if (name == "IE")
+            {
+              return CountryCode::IE;
+            }
+            break;
+          case IL_HASH:
+            if (name == "IL")
+            {
+              return CountryCode::IL;
+            }
+            break;
+          case IM_HASH:
+            if (name == "IM")
+            {
+              return CountryCode::IM;
+            }
+            break;
+          case IN_HASH:
+            if (name == "IN")
+            {
+              return CountryCode::IN;
+            }
+            break;
+          case IQ_HASH:
+            if (name == "IQ")
+            {
+              return CountryCode::IQ;
+            }
+            break;
+          case IR_HASH:
+            if (name == "IR")
+            {
+              return CountryCode::IR;
+            }
+            break;
+          case IS_HASH:
+            if (name == "IS")
+            {
+              return CountryCode::IS;
+            }
+            break;
+          case IT_HASH:
+            if (name == "IT")
+            {
+              return CountryCode::IT;
+            }
+            break;
+          case JM_HASH:
+            if (name == "JM")
+            {
+              return CountryCode::JM;
+            }
+            break;
+          case JO_HASH:
+            if (name == "JO")
+            {
+              return CountryCode::JO;
+            }
+            break;
+          case JP_HASH:
+            if (name == "JP")
+            {
+              return CountryCode::JP;
+            }
+            break;
+          case KE_HASH:
+            if (name == "KE")
+            {
+              return CountryCode::KE;
+            }
+            break;
+          case KG_HASH:
+            if (name == "KG")
+            {
+              return CountryCode::KG;
+            }
+            break;
+          case KH_HASH:
+            if (name == "KH")
+            {
+              return CountryCode::KH;
+            }
+            break;
+          case KI_HASH:
+            if (name == "KI")
+            {
+              return CountryCode::KI;
+            }
+            break;
+          case KM_HASH:
+            if (name == "KM")
+            {
+              return CountryCode::KM;
+            }
+            break;
+          case KN_HASH:
+            if (name == "KN")
+            {
+              return CountryCode::KN;
+            }
+            break;
+          case KP_HASH:
+            if (name == "KP")
+            {
+              return CountryCode::KP;
+            }
+            break;
+          case KR_HASH:
+            if (name == "KR")
+            {
+              return CountryCode::KR;
+            }
+            break;
+          case KW_HASH:
+            if (name == "KW")
+            {
+              return CountryCode::KW;
+            }
+            break;
+          case KY_HASH:
+            if (name == "KY")
+            {
+              return CountryCode::KY;
+            }
+            break;
+          case KZ_HASH:
+            if (name == "KZ")
+            {
+              return CountryCode::KZ;
+            }
+            break;
+          case LA_HASH:
+            if (name == "LA")
+            {
+              return CountryCode::LA;
+            }
+            break;
+          case LB_HASH:
+            if (name == "LB")
+            {
+              return CountryCode::LB;
+            }
+            break;
+          case LC_HASH:
+            if (name == "LC")
+            {
+              return CountryCode::LC;
+            }
+            break;
+          case LI_HASH:
+            if (name == "LI")
+            {
+              return CountryCode::LI;
+            }
+            break;
+          case LK_HASH:
+            if (name == "LK")
+            {
+              return CountryCode::LK;
+            }
+            break;
+          case LR_HASH:
+            if (name == "LR")
+            {
+              return CountryCode::LR;
+            }
+            break;
+          case LS_HASH:
+            if (name == "LS")
+            {
+              return CountryCode::LS;
+            }
+            break;
+          case LT_HASH:
+            if (name == "LT")
+            {
+              return CountryCode::LT;
+            }
+            break;
+          case LU_HASH:
+            if (name == "LU")
+            {
+              return CountryCode::LU;
+            }
+            break;
+          case LV_HASH:
+            if (name == "LV")
+            {
+              return CountryCode::LV;
+            }
+            break;
+          case LY_HASH:
+            if (name == "LY")
+            {
+              return CountryCode::LY;
+            }
+            break;
+          case MA_HASH:
+            if (name == "MA")
+            {
+              return CountryCode::MA;
+            }
+            break;
+          case MC_HASH:
+            if (name == "MC")
+            {
+              return CountryCode::MC;
+            }
+            break;
+          case MD_HASH:
+            if (name == "MD")
+            {
+              return CountryCode::MD;
+            }
+            break;
+          case ME_HASH:
+            if (name == "ME")
+            {
+              return CountryCode::ME;
+            }
+            break;
+          case MF_HASH:
+            if (name == "MF")
+            {
+              return CountryCode::MF;
+            }
+            break;
+          case MG_HASH:
+            if (name == "MG")
+            {
+              return CountryCode::MG;
+            }
+            break;
+          case MH_HASH:
+            if (name == "MH")
+            {
+              return CountryCode::MH;
+            }
+            break;
+          case MK_HASH:
+            if (name == "MK")
+            {
+              return CountryCode::MK;
+            }
+            break;
+          case ML_HASH:
+            if (name == "ML")
+            {
+              return CountryCode::ML;
+            }
+            break;
+          case MM_HASH:
+            if (name == "MM")
+            {
+              return CountryCode::MM;
+            }
+            break;
+          case MN_HASH:
+            if (name == "MN")
+            {
+              return CountryCode::MN;
+            }
+            break;
+          case MO_HASH:
+            if (name == "MO")
+            {
+              return CountryCode::MO;
+            }
+            break;
+          case MP_HASH:
+            if (name == "MP")
+            {
+              return CountryCode::MP;
+            }
+            break;
+          case MR_HASH:
+            if (name == "MR")
+            {
+              return CountryCode::MR;
+            }
+            break;
+          case MS_HASH:
+            if (name == "MS")
+            {
+              return CountryCode::MS;
+            }
+            break;
+          case MT_HASH:
+            if (name == "MT")
+            {
+              return CountryCode::MT;
+            }
+            break;
+          case MU_HASH:
+            if (name == "MU")
+            {
+              return CountryCode::MU;
+            }
+            break;
+          case MV_HASH:
+            if (name == "MV")
+            {
+              return CountryCode::MV;
+            }
+            break;
+          case MW_HASH:
+            if (name == "MW")
+            {
+              return CountryCode::MW;
+            }
+            break;
+          case MX_HASH:
+            if (name == "MX")
+            {
+              return CountryCode::MX;
+            }
+            break;
+          case MY_HASH:
+            if (name == "MY")
+            {
+              return CountryCode::MY;
+            }
+            break;
+          case MZ_HASH:
+            if (name == "MZ")
+            {
+              return CountryCode::MZ;
+            }
+            break;
+          case NA_HASH:
+            if (name == "NA")
+            {
+              return CountryCode::NA;
+            }
+            break;
+          case NC_HASH:
+            if (name == "NC")
+            {
+              return CountryCode::NC;
+            }
+            break;
+          case NE_HASH:
+            if (name == "NE")
+            {
+              return CountryCode::NE;
+            }
+            break;
+          case NG_HASH:
+            if (name == "NG")
+            {
+              return CountryCode::NG;
+            }
+            break;
+          case NI_HASH:
+            if (name == "NI")
+            {
+              return CountryCode::NI;
+            }
+            break;
+          case NL_HASH:
+            if (name == "NL")
+            {
+              return CountryCode::NL;
+            }
+            break;
+          case NO_HASH:
+            if (name == "NO")
+            {
+              return CountryCode::NO;
+            }
+            break;
+          case NP_HASH:
+            if (name == "NP")
+            {
+              return CountryCode::NP;
+            }
+            break;
+          case NR_HASH:
+            if (name == "NR")
+            {
+              return CountryCode::NR;
+            }
+            break;
+          case NU_HASH:
+            if (name == "NU")
+            {
+              return CountryCode::NU;
+            }
+            break;
+          case NZ_HASH:
+            if (name == "NZ")
+            {
+              return CountryCode::NZ;
+            }
+            break;
+          case OM_HASH:
+            if (name == "OM")
+            {
+              return CountryCode::OM;
+            }
+            break;
+          case PA_HASH:
+            if (name == "PA")
+            {
+              return CountryCode::PA;
+            }
+            break;
+          case PE_HASH:
+            if (name == "PE")
+            {
+              return CountryCode::PE;
+            }
+            break;
+          case PF_HASH:
+            if (name == "PF")
+            {
+              return CountryCode::PF;
+            }
+            break;
+          case PG_HASH:
+            if (name == "PG")
+            {
+              return CountryCode::PG;
+            }
+            break;
+          case PH_HASH:
+            if (name == "PH")
+            {
+              return CountryCode::PH;
+            }
+            break;
+          case PK_HASH:
+            if (name == "PK")
+            {
+              return CountryCode::PK;
+            }
+            break;
+          case PL_HASH:
+            if (name == "PL")
+            {
+              return CountryCode::PL;
+            }
+            break;
+          case PM_HASH:
+            if (name == "PM")
+            {
+              return CountryCode::PM;
+            }
+            break;
+          case PN_HASH:
+            if (name == "PN")
+            {
+              return CountryCode::PN;
+            }
+            break;
+          case PR_HASH:
+            if (name == "PR")
+            {
+              return CountryCode::PR;
+            }
+            break;
+          case PT_HASH:
+            if (name == "PT")
+            {
+              return CountryCode::PT;
+            }
+            break;
+          case PW_HASH:
+            if (name == "PW")
+            {
+              return CountryCode::PW;
+            }
+            break;
+          case PY_HASH:
+            if (name == "PY")
+            {
+              return CountryCode::PY;
+            }
+            break;
+          case QA_HASH:
+            if (name == "QA")
+            {
+              return CountryCode::QA;
+            }
+            break;
+          case RO_HASH:
+            if (name == "RO")
+            {
+              return CountryCode::RO;
+            }
+            break;
+          case RS_HASH:
+            if (name == "RS")
+            {
+              return CountryCode::RS;
+            }
+            break;
+          case RU_HASH:
+            if (name == "RU")
+            {
+              return CountryCode::RU;
+            }
+            break;
+          case RW_HASH:
+            if (name == "RW")
+            {
+              return CountryCode::RW;
+            }
+            break;
+          case SA_HASH:
+            if (name == "SA")
+            {
+              return CountryCode::SA;
+            }
+            break;
+          case SB_HASH:
+            if (name == "SB")
+            {
+              return CountryCode::SB;
+            }
+            break;
+          case SC_HASH:
+            if (name == "SC")
+            {
+              return CountryCode::SC;
+            }
+            break;
+          case SD_HASH:
+            if (name == "SD")
+            {
+              return CountryCode::SD;
+            }
+            break;
+          case SE_HASH:
+            if (name == "SE")
+            {
+              return CountryCode::SE;
+            }
+            break;
+          case SG_HASH:
+            if (name == "SG")
+            {
+              return CountryCode::SG;
+            }
+            break;
+          case SH_HASH:
+            if (name == "SH")
+            {
+              return CountryCode::SH;
+            }
+            break;
+          case SI_HASH:
+            if (name == "SI")
+            {
+              return CountryCode::SI;
+            }
+            break;
+          case SK_HASH:
+            if (name == "SK")
+            {
+              return CountryCode::SK;
+            }
+            break;
+          case SL_HASH:
+            if (name == "SL")
+            {
+              return CountryCode::SL;
+            }
+            break;
+          case SM_HASH:
+            if (name == "SM")
+            {
+              return CountryCode::SM;
+            }
+            break;
+          case SN_HASH:
+            if (name == "SN")
+            {
+              return CountryCode::SN;
+            }
+            break;
+          case SO_HASH:
+            if (name == "SO")
+            {
+              return CountryCode::SO;
+            }
+            break;
+          case SR_HASH:
+            if (name == "SR")
+            {
+              return CountryCode::SR;
+            }
+            break;
+          case ST_HASH:
+            if (name == "ST")
+            {
+              return CountryCode::ST;
+            }
+            break;
+          case SV_HASH:
+            if (name == "SV")
+            {
+              return CountryCode::SV;
+            }
+            break;
+          case SY_HASH:
+            if (name == "SY")
+            {
+              return CountryCode::SY;
+            }
+            break;
+          case SZ_HASH:
+            if (name == "SZ")
+            {
+              return CountryCode::SZ;
+            }
+            break;
+          case TC_HASH:
+            if (name == "TC")
+            {
+              return CountryCode::TC;
+            }
+            break;
+          case TD_HASH:
+            if (name == "TD")
+            {
+              return CountryCode::TD;
+            }
+            break;
+          case TG_HASH:
+            if (name == "TG")
+            {
+              return CountryCode::TG;
+            }
+            break;
+          case TH_HASH:
+            if (name == "TH")
+            {
+              return CountryCode::TH;
+            }
+            break;
+          case TJ_HASH:
+            if (name == "TJ")
+            {
+              return CountryCode::TJ;
+            }
+            break;
+          case TK_HASH:
+            if (name == "TK")
+            {
+              return CountryCode::TK;
+            }
+            break;
+          case TL_HASH:
+            if (name == "TL")
+            {
+              return CountryCode::TL;
+            }
+            break;
+          case TM_HASH:
+            if (name == "TM")
+            {
+              return CountryCode::TM;
+            }
+            break;
+          case TN_HASH:
+            if (name == "TN")
+            {
+              return CountryCode::TN;
+            }
+            break;
+          case TO_HASH:
+            if (name == "TO")
+            {
+              return CountryCode::TO;
+            }
+            break;
+          case TR_HASH:
+            if (name == "TR")
+            {
+              return CountryCode::TR;
+            }
+            break;
+          case TT_HASH:
+            if (name == "TT")
+            {
+              return CountryCode::TT;
+            }
+            break;
+          case TV_HASH:
+            if (name == "TV")
+            {
+              return CountryCode::TV;
+            }
+            break;
+          case TW_HASH:
+            if (name == "TW")
+            {
+              return CountryCode::TW;
+            }
+            break;
+          case TZ_HASH:
+            if (name == "TZ")
+            {
+              return CountryCode::TZ;
+            }
+            break;
+          case UA_HASH:
+            if (name == "UA")
+            {
+              return CountryCode::UA;
+            }
+            break;
+          case UG_HASH:
+            if (name == "UG")
+            {
+              return CountryCode::UG;
+            }
+            break;
+          case US_HASH:
+            if (name == "US")
+            {
+              return CountryCode::US;
+            }
+            break;
+          case UY_HASH:
+            if (name == "UY")
+            {
+              return CountryCode::UY;
+            }
+            break;
+          case UZ_HASH:
+            if (name == "UZ")
+            {
+              return CountryCode::UZ;
+            }
+            break;
+          case VA_HASH:
+            if (name == "VA")
+            {
+              return CountryCode::VA;
+            }
+            break;
+          case VC_HASH:
+            if (name == "VC")
+            {
+              return CountryCode::VC;
+            }
+            break;
+          case VE_HASH:
+            if (name == "VE")
+            {
+              return CountryCode::VE;
+            }
+            break;
+          case VG_HASH:
+            if (name == "VG")
+            {
+              return CountryCode::VG;
+            }
+            break;
+          case VI_HASH:
+            if (name == "VI")
+            {
+              return CountryCode::VI;
+            }
+            break;
+          case VN_HASH:
+            if (name == "VN")
+            {
+              return CountryCode::VN;
+            }
+            break;
+          case VU_HASH:
+            if (name == "VU")
+            {
+              return CountryCode::VU;
+            }
+            break;
+          case WF_HASH:
+            if (name == "WF")
+            {
+              return CountryCode::WF;
+            }
+            break;
+          case WS_HASH:
+            if (name == "WS")
+            {
+              return CountryCode::WS;
+            }
+            break;
+          case YE_HASH:
+            if (name == "YE")
+            {
+              return CountryCode::YE;
+            }
+            break;
+          case YT_HASH:
+            if (name == "YT")
+            {
+              return CountryCode::YT;
+            }
+            break;
+          case ZA_HASH:
+            if (name == "ZA")
+            {
+              return CountryCode::ZA;
+            }
+            break;
+          case ZM_HASH:
+            if (name == "ZM")
+            {
+              return CountryCode::ZM;
+            }
+            break;
+          case ZW_HASH:
+            if (name == "ZW")
+            {
+              return CountryCode::ZW;
+            }
+            break;
+          default:
+            break;
           }
-          else if (hashCode == ZW_HASH)
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
           {
-            enumValue = CountryCode::ZW;
-            return true;
+            overflowContainer->StoreOverflow(hashCode, name);
+            return static_cast<CountryCode>(hashCode);
           }
-          return false;
+
+          return CountryCode::NOT_SET;
         }
 
-        static bool GetNameForEnumHelper0(CountryCode enumValue, Aws::String& value)
+        const char* GetNameForCountryCode(CountryCode enumValue)
         {
           switch(enumValue)
           {
           case CountryCode::AD:
-            value = "AD";
-            return true;
+            return "AD";
           case CountryCode::AE:
-            value = "AE";
-            return true;
+            return "AE";
           case CountryCode::AF:
-            value = "AF";
-            return true;
+            return "AF";
           case CountryCode::AG:
-            value = "AG";
-            return true;
+            return "AG";
           case CountryCode::AI:
-            value = "AI";
-            return true;
+            return "AI";
           case CountryCode::AL:
-            value = "AL";
-            return true;
+            return "AL";
           case CountryCode::AM:
-            value = "AM";
-            return true;
+            return "AM";
           case CountryCode::AN:
-            value = "AN";
-            return true;
+            return "AN";
           case CountryCode::AO:
-            value = "AO";
-            return true;
+            return "AO";
           case CountryCode::AQ:
-            value = "AQ";
-            return true;
+            return "AQ";
           case CountryCode::AR:
-            value = "AR";
-            return true;
+            return "AR";
           case CountryCode::AS:
-            value = "AS";
-            return true;
+            return "AS";
           case CountryCode::AT:
-            value = "AT";
-            return true;
+            return "AT";
           case CountryCode::AU:
-            value = "AU";
-            return true;
+            return "AU";
           case CountryCode::AW:
-            value = "AW";
-            return true;
+            return "AW";
           case CountryCode::AZ:
-            value = "AZ";
-            return true;
+            return "AZ";
           case CountryCode::BA:
-            value = "BA";
-            return true;
+            return "BA";
           case CountryCode::BB:
-            value = "BB";
-            return true;
+            return "BB";
           case CountryCode::BD:
-            value = "BD";
-            return true;
+            return "BD";
           case CountryCode::BE:
-            value = "BE";
-            return true;
+            return "BE";
           case CountryCode::BF:
-            value = "BF";
-            return true;
+            return "BF";
           case CountryCode::BG:
-            value = "BG";
-            return true;
+            return "BG";
           case CountryCode::BH:
-            value = "BH";
-            return true;
+            return "BH";
           case CountryCode::BI:
-            value = "BI";
-            return true;
+            return "BI";
           case CountryCode::BJ:
-            value = "BJ";
-            return true;
+            return "BJ";
           case CountryCode::BL:
-            value = "BL";
-            return true;
+            return "BL";
           case CountryCode::BM:
-            value = "BM";
-            return true;
+            return "BM";
           case CountryCode::BN:
-            value = "BN";
-            return true;
+            return "BN";
           case CountryCode::BO:
-            value = "BO";
-            return true;
+            return "BO";
           case CountryCode::BR:
-            value = "BR";
-            return true;
+            return "BR";
           case CountryCode::BS:
-            value = "BS";
-            return true;
+            return "BS";
           case CountryCode::BT:
-            value = "BT";
-            return true;
+            return "BT";
           case CountryCode::BW:
-            value = "BW";
-            return true;
+            return "BW";
           case CountryCode::BY:
-            value = "BY";
-            return true;
+            return "BY";
           case CountryCode::BZ:
-            value = "BZ";
-            return true;
+            return "BZ";
           case CountryCode::CA:
-            value = "CA";
-            return true;
+            return "CA";
           case CountryCode::CC:
-            value = "CC";
-            return true;
+            return "CC";
           case CountryCode::CD:
-            value = "CD";
-            return true;
+            return "CD";
           case CountryCode::CF:
-            value = "CF";
-            return true;
+            return "CF";
           case CountryCode::CG:
-            value = "CG";
-            return true;
+            return "CG";
           case CountryCode::CH:
-            value = "CH";
-            return true;
+            return "CH";
           case CountryCode::CI:
-            value = "CI";
-            return true;
+            return "CI";
           case CountryCode::CK:
-            value = "CK";
-            return true;
+            return "CK";
           case CountryCode::CL:
-            value = "CL";
-            return true;
+            return "CL";
           case CountryCode::CM:
-            value = "CM";
-            return true;
+            return "CM";
           case CountryCode::CN:
-            value = "CN";
-            return true;
+            return "CN";
           case CountryCode::CO:
-            value = "CO";
-            return true;
+            return "CO";
           case CountryCode::CR:
-            value = "CR";
-            return true;
+            return "CR";
           case CountryCode::CU:
-            value = "CU";
-            return true;
+            return "CU";
           case CountryCode::CV:
-            value = "CV";
-            return true;
+            return "CV";
           case CountryCode::CX:
-            value = "CX";
-            return true;
+            return "CX";
           case CountryCode::CY:
-            value = "CY";
-            return true;
+            return "CY";
           case CountryCode::CZ:
-            value = "CZ";
-            return true;
+            return "CZ";
           case CountryCode::DE:
-            value = "DE";
-            return true;
+            return "DE";
           case CountryCode::DJ:
-            value = "DJ";
-            return true;
+            return "DJ";
           case CountryCode::DK:
-            value = "DK";
-            return true;
+            return "DK";
           case CountryCode::DM:
-            value = "DM";
-            return true;
+            return "DM";
           case CountryCode::DO:
-            value = "DO";
-            return true;
+            return "DO";
           case CountryCode::DZ:
-            value = "DZ";
-            return true;
+            return "DZ";
           case CountryCode::EC:
-            value = "EC";
-            return true;
+            return "EC";
           case CountryCode::EE:
-            value = "EE";
-            return true;
+            return "EE";
           case CountryCode::EG:
-            value = "EG";
-            return true;
+            return "EG";
           case CountryCode::ER:
-            value = "ER";
-            return true;
+            return "ER";
           case CountryCode::ES:
-            value = "ES";
-            return true;
+            return "ES";
           case CountryCode::ET:
-            value = "ET";
-            return true;
+            return "ET";
           case CountryCode::FI:
-            value = "FI";
-            return true;
+            return "FI";
           case CountryCode::FJ:
-            value = "FJ";
-            return true;
+            return "FJ";
           case CountryCode::FK:
-            value = "FK";
-            return true;
+            return "FK";
           case CountryCode::FM:
-            value = "FM";
-            return true;
+            return "FM";
           case CountryCode::FO:
-            value = "FO";
-            return true;
+            return "FO";
           case CountryCode::FR:
-            value = "FR";
-            return true;
+            return "FR";
           case CountryCode::GA:
-            value = "GA";
-            return true;
+            return "GA";
           case CountryCode::GB:
-            value = "GB";
-            return true;
+            return "GB";
           case CountryCode::GD:
-            value = "GD";
-            return true;
+            return "GD";
           case CountryCode::GE:
-            value = "GE";
-            return true;
+            return "GE";
           case CountryCode::GH:
-            value = "GH";
-            return true;
+            return "GH";
           case CountryCode::GI:
-            value = "GI";
-            return true;
+            return "GI";
           case CountryCode::GL:
-            value = "GL";
-            return true;
+            return "GL";
           case CountryCode::GM:
-            value = "GM";
-            return true;
+            return "GM";
           case CountryCode::GN:
-            value = "GN";
-            return true;
+            return "GN";
           case CountryCode::GQ:
-            value = "GQ";
-            return true;
+            return "GQ";
           case CountryCode::GR:
-            value = "GR";
-            return true;
+            return "GR";
           case CountryCode::GT:
-            value = "GT";
-            return true;
+            return "GT";
           case CountryCode::GU:
-            value = "GU";
-            return true;
+            return "GU";
           case CountryCode::GW:
-            value = "GW";
-            return true;
+            return "GW";
           case CountryCode::GY:
-            value = "GY";
-            return true;
+            return "GY";
           case CountryCode::HK:
-            value = "HK";
-            return true;
+            return "HK";
           case CountryCode::HN:
-            value = "HN";
-            return true;
+            return "HN";
           case CountryCode::HR:
-            value = "HR";
-            return true;
+            return "HR";
           case CountryCode::HT:
-            value = "HT";
-            return true;
+            return "HT";
           case CountryCode::HU:
-            value = "HU";
-            return true;
+            return "HU";
           case CountryCode::ID:
-            value = "ID";
-            return true;
+            return "ID";
           case CountryCode::IE:
-            value = "IE";
-            return true;
+            return "IE";
           case CountryCode::IL:
-            value = "IL";
-            return true;
+            return "IL";
           case CountryCode::IM:
-            value = "IM";
-            return true;
+            return "IM";
           case CountryCode::IN:
-            value = "IN";
-            return true;
+            return "IN";
           case CountryCode::IQ:
-            value = "IQ";
-            return true;
+            return "IQ";
           case CountryCode::IR:
-            value = "IR";
-            return true;
+            return "IR";
           case CountryCode::IS:
-            value = "IS";
-            return true;
+            return "IS";
           case CountryCode::IT:
-            value = "IT";
-            return true;
+            return "IT";
           case CountryCode::JM:
-            value = "JM";
-            return true;
+            return "JM";
           case CountryCode::JO:
-            value = "JO";
-            return true;
+            return "JO";
           case CountryCode::JP:
-            value = "JP";
-            return true;
+            return "JP";
           case CountryCode::KE:
-            value = "KE";
-            return true;
+            return "KE";
           case CountryCode::KG:
-            value = "KG";
-            return true;
+            return "KG";
           case CountryCode::KH:
-            value = "KH";
-            return true;
+            return "KH";
           case CountryCode::KI:
-            value = "KI";
-            return true;
+            return "KI";
           case CountryCode::KM:
-            value = "KM";
-            return true;
+            return "KM";
           case CountryCode::KN:
-            value = "KN";
-            return true;
+            return "KN";
           case CountryCode::KP:
-            value = "KP";
-            return true;
+            return "KP";
           case CountryCode::KR:
-            value = "KR";
-            return true;
+            return "KR";
           case CountryCode::KW:
-            value = "KW";
-            return true;
+            return "KW";
           case CountryCode::KY:
-            value = "KY";
-            return true;
+            return "KY";
           case CountryCode::KZ:
-            value = "KZ";
-            return true;
+            return "KZ";
           case CountryCode::LA:
-            value = "LA";
-            return true;
+            return "LA";
           case CountryCode::LB:
-            value = "LB";
-            return true;
+            return "LB";
           case CountryCode::LC:
-            value = "LC";
-            return true;
+            return "LC";
           case CountryCode::LI:
-            value = "LI";
-            return true;
+            return "LI";
           case CountryCode::LK:
-            value = "LK";
-            return true;
+            return "LK";
           case CountryCode::LR:
-            value = "LR";
-            return true;
+            return "LR";
           case CountryCode::LS:
-            value = "LS";
-            return true;
+            return "LS";
           case CountryCode::LT:
-            value = "LT";
-            return true;
-          default:
-            return false;
-          }
-        }
-        static bool GetNameForEnumHelper1(CountryCode enumValue, Aws::String& value)
-        {
-          switch(enumValue)
-          {
+            return "LT";
           case CountryCode::LU:
-            value = "LU";
-            return true;
+            return "LU";
           case CountryCode::LV:
-            value = "LV";
-            return true;
+            return "LV";
           case CountryCode::LY:
-            value = "LY";
-            return true;
+            return "LY";
           case CountryCode::MA:
-            value = "MA";
-            return true;
+            return "MA";
           case CountryCode::MC:
-            value = "MC";
-            return true;
+            return "MC";
           case CountryCode::MD:
-            value = "MD";
-            return true;
+            return "MD";
           case CountryCode::ME:
-            value = "ME";
-            return true;
+            return "ME";
           case CountryCode::MF:
-            value = "MF";
-            return true;
+            return "MF";
           case CountryCode::MG:
-            value = "MG";
-            return true;
+            return "MG";
           case CountryCode::MH:
-            value = "MH";
-            return true;
+            return "MH";
           case CountryCode::MK:
-            value = "MK";
-            return true;
+            return "MK";
           case CountryCode::ML:
-            value = "ML";
-            return true;
+            return "ML";
           case CountryCode::MM:
-            value = "MM";
-            return true;
+            return "MM";
           case CountryCode::MN:
-            value = "MN";
-            return true;
+            return "MN";
           case CountryCode::MO:
-            value = "MO";
-            return true;
+            return "MO";
           case CountryCode::MP:
-            value = "MP";
-            return true;
+            return "MP";
           case CountryCode::MR:
-            value = "MR";
-            return true;
+            return "MR";
           case CountryCode::MS:
-            value = "MS";
-            return true;
+            return "MS";
           case CountryCode::MT:
-            value = "MT";
-            return true;
+            return "MT";
           case CountryCode::MU:
-            value = "MU";
-            return true;
+            return "MU";
           case CountryCode::MV:
-            value = "MV";
-            return true;
+            return "MV";
           case CountryCode::MW:
-            value = "MW";
-            return true;
+            return "MW";
           case CountryCode::MX:
-            value = "MX";
-            return true;
+            return "MX";
           case CountryCode::MY:
-            value = "MY";
-            return true;
+            return "MY";
           case CountryCode::MZ:
-            value = "MZ";
-            return true;
+            return "MZ";
           case CountryCode::NA:
-            value = "NA";
-            return true;
+            return "NA";
           case CountryCode::NC:
-            value = "NC";
-            return true;
+            return "NC";
           case CountryCode::NE:
-            value = "NE";
-            return true;
+            return "NE";
           case CountryCode::NG:
-            value = "NG";
-            return true;
+            return "NG";
           case CountryCode::NI:
-            value = "NI";
-            return true;
+            return "NI";
           case CountryCode::NL:
-            value = "NL";
-            return true;
+            return "NL";
           case CountryCode::NO:
-            value = "NO";
-            return true;
+            return "NO";
           case CountryCode::NP:
-            value = "NP";
-            return true;
+            return "NP";
           case CountryCode::NR:
-            value = "NR";
-            return true;
+            return "NR";
           case CountryCode::NU:
-            value = "NU";
-            return true;
+            return "NU";
           case CountryCode::NZ:
-            value = "NZ";
-            return true;
+            return "NZ";
           case CountryCode::OM:
-            value = "OM";
-            return true;
+            return "OM";
           case CountryCode::PA:
-            value = "PA";
-            return true;
+            return "PA";
           case CountryCode::PE:
-            value = "PE";
-            return true;
+            return "PE";
           case CountryCode::PF:
-            value = "PF";
-            return true;
+            return "PF";
           case CountryCode::PG:
-            value = "PG";
-            return true;
+            return "PG";
           case CountryCode::PH:
-            value = "PH";
-            return true;
+            return "PH";
           case CountryCode::PK:
-            value = "PK";
-            return true;
+            return "PK";
           case CountryCode::PL:
-            value = "PL";
-            return true;
+            return "PL";
           case CountryCode::PM:
-            value = "PM";
-            return true;
+            return "PM";
           case CountryCode::PN:
-            value = "PN";
-            return true;
+            return "PN";
           case CountryCode::PR:
-            value = "PR";
-            return true;
+            return "PR";
           case CountryCode::PT:
-            value = "PT";
-            return true;
+            return "PT";
           case CountryCode::PW:
-            value = "PW";
-            return true;
+            return "PW";
           case CountryCode::PY:
-            value = "PY";
-            return true;
+            return "PY";
           case CountryCode::QA:
-            value = "QA";
-            return true;
+            return "QA";
           case CountryCode::RO:
-            value = "RO";
-            return true;
+            return "RO";
           case CountryCode::RS:
-            value = "RS";
-            return true;
+            return "RS";
           case CountryCode::RU:
-            value = "RU";
-            return true;
+            return "RU";
           case CountryCode::RW:
-            value = "RW";
-            return true;
+            return "RW";
           case CountryCode::SA:
-            value = "SA";
-            return true;
+            return "SA";
           case CountryCode::SB:
-            value = "SB";
-            return true;
+            return "SB";
           case CountryCode::SC:
-            value = "SC";
-            return true;
+            return "SC";
           case CountryCode::SD:
-            value = "SD";
-            return true;
+            return "SD";
           case CountryCode::SE:
-            value = "SE";
-            return true;
+            return "SE";
           case CountryCode::SG:
-            value = "SG";
-            return true;
+            return "SG";
           case CountryCode::SH:
-            value = "SH";
-            return true;
+            return "SH";
           case CountryCode::SI:
-            value = "SI";
-            return true;
+            return "SI";
           case CountryCode::SK:
-            value = "SK";
-            return true;
+            return "SK";
           case CountryCode::SL:
-            value = "SL";
-            return true;
+            return "SL";
           case CountryCode::SM:
-            value = "SM";
-            return true;
+            return "SM";
           case CountryCode::SN:
-            value = "SN";
-            return true;
+            return "SN";
           case CountryCode::SO:
-            value = "SO";
-            return true;
+            return "SO";
           case CountryCode::SR:
-            value = "SR";
-            return true;
+            return "SR";
           case CountryCode::ST:
-            value = "ST";
-            return true;
+            return "ST";
           case CountryCode::SV:
-            value = "SV";
-            return true;
+            return "SV";
           case CountryCode::SY:
-            value = "SY";
-            return true;
+            return "SY";
           case CountryCode::SZ:
-            value = "SZ";
-            return true;
+            return "SZ";
           case CountryCode::TC:
-            value = "TC";
-            return true;
+            return "TC";
           case CountryCode::TD:
-            value = "TD";
-            return true;
+            return "TD";
           case CountryCode::TG:
-            value = "TG";
-            return true;
+            return "TG";
           case CountryCode::TH:
-            value = "TH";
-            return true;
+            return "TH";
           case CountryCode::TJ:
-            value = "TJ";
-            return true;
+            return "TJ";
           case CountryCode::TK:
-            value = "TK";
-            return true;
+            return "TK";
           case CountryCode::TL:
-            value = "TL";
-            return true;
+            return "TL";
           case CountryCode::TM:
-            value = "TM";
-            return true;
+            return "TM";
           case CountryCode::TN:
-            value = "TN";
-            return true;
+            return "TN";
           case CountryCode::TO:
-            value = "TO";
-            return true;
+            return "TO";
           case CountryCode::TR:
-            value = "TR";
-            return true;
+            return "TR";
           case CountryCode::TT:
-            value = "TT";
-            return true;
+            return "TT";
           case CountryCode::TV:
-            value = "TV";
-            return true;
+            return "TV";
           case CountryCode::TW:
-            value = "TW";
-            return true;
+            return "TW";
           case CountryCode::TZ:
-            value = "TZ";
-            return true;
+            return "TZ";
           case CountryCode::UA:
-            value = "UA";
-            return true;
+            return "UA";
           case CountryCode::UG:
-            value = "UG";
-            return true;
+            return "UG";
           case CountryCode::US:
-            value = "US";
-            return true;
+            return "US";
           case CountryCode::UY:
-            value = "UY";
-            return true;
+            return "UY";
           case CountryCode::UZ:
-            value = "UZ";
-            return true;
+            return "UZ";
           case CountryCode::VA:
-            value = "VA";
-            return true;
+            return "VA";
           case CountryCode::VC:
-            value = "VC";
-            return true;
+            return "VC";
           case CountryCode::VE:
-            value = "VE";
-            return true;
+            return "VE";
           case CountryCode::VG:
-            value = "VG";
-            return true;
+            return "VG";
           case CountryCode::VI:
-            value = "VI";
-            return true;
+            return "VI";
           case CountryCode::VN:
-            value = "VN";
-            return true;
+            return "VN";
           case CountryCode::VU:
-            value = "VU";
-            return true;
+            return "VU";
           case CountryCode::WF:
-            value = "WF";
-            return true;
+            return "WF";
           case CountryCode::WS:
-            value = "WS";
-            return true;
+            return "WS";
           case CountryCode::YE:
-            value = "YE";
-            return true;
+            return "YE";
           case CountryCode::YT:
-            value = "YT";
-            return true;
+            return "YT";
           case CountryCode::ZA:
-            value = "ZA";
-            return true;
+            return "ZA";
           case CountryCode::ZM:
-            value = "ZM";
-            return true;
+            return "ZM";
           case CountryCode::ZW:
-            value = "ZW";
-            return true;
+            return "ZW";
           default:
-            return false;
-          }
-        }
+            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+            if(overflowContainer)
+            {
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
+            }
 
-        CountryCode GetCountryCodeForName(const Aws::String& name)
-        {
-          int hashCode = HashingUtils::HashString(name.c_str());
-          CountryCode enumValue;
-          if (GetEnumForNameHelper0(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          else if (GetEnumForNameHelper1(hashCode, enumValue))
-          {
-             return enumValue;
+            return "";
           }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            overflowContainer->StoreOverflow(hashCode, name);
-            return static_cast<CountryCode>(hashCode);
-          }
-
-          return CountryCode::NOT_SET;
-        }
-
-        Aws::String GetNameForCountryCode(CountryCode enumValue)
-        {
-          Aws::String value;
-          if (GetNameForEnumHelper0(enumValue, value))
-          {
-            return value;
-          }
-          else if (GetNameForEnumHelper1(enumValue, value))
-          {
-            return value;
-          }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
-          }
-
-          return "";
         }
 
       } // namespace CountryCodeMapper
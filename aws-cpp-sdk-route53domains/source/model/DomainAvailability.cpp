@@ -30,50 +30,72 @@ namespace Aws
       namespace DomainAvailabilityMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int AVAILABLE_RESERVED_HASH = HashingUtils::HashString("AVAILABLE_RESERVED");
-        static const int AVAILABLE_PREORDER_HASH = HashingUtils::HashString("AVAILABLE_PREORDER");
-        static const int UNAVAILABLE_HASH = HashingUtils::HashString("UNAVAILABLE");
-        static const int UNAVAILABLE_PREMIUM_HASH = HashingUtils::HashString("UNAVAILABLE_PREMIUM");
-        static const int UNAVAILABLE_RESTRICTED_HASH = HashingUtils::HashString("UNAVAILABLE_RESTRICTED");
-        static const int RESERVED_HASH = HashingUtils::HashString("RESERVED");
-        static const int DONT_KNOW_HASH = HashingUtils::HashString("DONT_KNOW");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int AVAILABLE_RESERVED_HASH = HashingUtils::CompileTimeHashString("AVAILABLE_RESERVED");
+        static constexpr int AVAILABLE_PREORDER_HASH = HashingUtils::CompileTimeHashString("AVAILABLE_PREORDER");
+        static constexpr int UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("UNAVAILABLE");
+        static constexpr int UNAVAILABLE_PREMIUM_HASH = HashingUtils::CompileTimeHashString("UNAVAILABLE_PREMIUM");
+        static constexpr int UNAVAILABLE_RESTRICTED_HASH = HashingUtils::CompileTimeHashString("UNAVAILABLE_RESTRICTED");
+        static constexpr int RESERVED_HASH = HashingUtils::CompileTimeHashString("RESERVED");
+        static constexpr int DONT_KNOW_HASH = HashingUtils::CompileTimeHashString("DONT_KNOW");
 
 
         DomainAvailability GetDomainAvailabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DomainAvailability::AVAILABLE;
-          }
-          else if (hashCode == AVAILABLE_RESERVED_HASH)
-          {
-            return DomainAvailability::AVAILABLE_RESERVED;
-          }
-          else if (hashCode == AVAILABLE_PREORDER_HASH)
-          {
-            return DomainAvailability::AVAILABLE_PREORDER;
-          }
-          else if (hashCode == UNAVAILABLE_HASH)
-          {
-            return DomainAvailability::UNAVAILABLE;
-          }
-          else if (hashCode == UNAVAILABLE_PREMIUM_HASH)
-          {
-            return DomainAvailability::UNAVAILABLE_PREMIUM;
-          }
-          else if (hashCode == UNAVAILABLE_RESTRICTED_HASH)
-          {
-            return DomainAvailability::UNAVAILABLE_RESTRICTED;
-          }
-          else if (hashCode == RESERVED_HASH)
-          {
-            return DomainAvailability::RESERVED;
-          }
-          else if (hashCode == DONT_KNOW_HASH)
-          {
-            return DomainAvailability::DONT_KNOW;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return DomainAvailability::AVAILABLE;
+            }
+            break;
+          case AVAILABLE_RESERVED_HASH:
+            if (name == "AVAILABLE_RESERVED")
+            {
+              return DomainAvailability::AVAILABLE_RESERVED;
+            }
+            break;
+          case AVAILABLE_PREORDER_HASH:
+            if (name == "AVAILABLE_PREORDER")
+            {
+              return DomainAvailability::AVAILABLE_PREORDER;
+            }
+            break;
+          case UNAVAILABLE_HASH:
+            if (name == "UNAVAILABLE")
+            {
+              return DomainAvailability::UNAVAILABLE;
+            }
+            break;
+          case UNAVAILABLE_PREMIUM_HASH:
+            if (name == "UNAVAILABLE_PREMIUM")
+            {
+              return DomainAvailability::UNAVAILABLE_PREMIUM;
+            }
+            break;
+          case UNAVAILABLE_RESTRICTED_HASH:
+            if (name == "UNAVAILABLE_RESTRICTED")
+            {
+              return DomainAvailability::UNAVAILABLE_RESTRICTED;
+            }
+            break;
+          case RESERVED_HASH:
+            if (name == "RESERVED")
+            {
+              return DomainAvailability::RESERVED;
+            }
+            break;
+          case DONT_KNOW_HASH:
+            if (name == "DONT_KNOW")
+            {
+              return DomainAvailability::DONT_KNOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return DomainAvailability::NOT_SET;
         }
 
-        Aws::String GetNameForDomainAvailability(DomainAvailability enumValue)
+        const char* GetNameForDomainAvailability(DomainAvailability enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
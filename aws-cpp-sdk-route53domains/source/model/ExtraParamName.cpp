@@ -30,140 +30,198 @@ namespace Aws
       namespace ExtraParamNameMapper
       {
 
-        static const int DUNS_NUMBER_HASH = HashingUtils::HashString("DUNS_NUMBER");
-        static const int BRAND_NUMBER_HASH = HashingUtils::HashString("BRAND_NUMBER");
-        static const int BIRTH_DEPARTMENT_HASH = HashingUtils::HashString("BIRTH_DEPARTMENT");
-        static const int BIRTH_DATE_IN_YYYY_MM_DD_HASH = HashingUtils::HashString("BIRTH_DATE_IN_YYYY_MM_DD");
-        static const int BIRTH_COUNTRY_HASH = HashingUtils::HashString("BIRTH_COUNTRY");
-        static const int BIRTH_CITY_HASH = HashingUtils::HashString("BIRTH_CITY");
-        static const int DOCUMENT_NUMBER_HASH = HashingUtils::HashString("DOCUMENT_NUMBER");
-        static const int AU_ID_NUMBER_HASH = HashingUtils::HashString("AU_ID_NUMBER");
-        static const int AU_ID_TYPE_HASH = HashingUtils::HashString("AU_ID_TYPE");
-        static const int CA_LEGAL_TYPE_HASH = HashingUtils::HashString("CA_LEGAL_TYPE");
-        static const int CA_BUSINESS_ENTITY_TYPE_HASH = HashingUtils::HashString("CA_BUSINESS_ENTITY_TYPE");
-        static const int ES_IDENTIFICATION_HASH = HashingUtils::HashString("ES_IDENTIFICATION");
-        static const int ES_IDENTIFICATION_TYPE_HASH = HashingUtils::HashString("ES_IDENTIFICATION_TYPE");
-        static const int ES_LEGAL_FORM_HASH = HashingUtils::HashString("ES_LEGAL_FORM");
-        static const int FI_BUSINESS_NUMBER_HASH = HashingUtils::HashString("FI_BUSINESS_NUMBER");
-        static const int FI_ID_NUMBER_HASH = HashingUtils::HashString("FI_ID_NUMBER");
-        static const int FI_NATIONALITY_HASH = HashingUtils::HashString("FI_NATIONALITY");
-        static const int FI_ORGANIZATION_TYPE_HASH = HashingUtils::HashString("FI_ORGANIZATION_TYPE");
-        static const int IT_PIN_HASH = HashingUtils::HashString("IT_PIN");
-        static const int IT_REGISTRANT_ENTITY_TYPE_HASH = HashingUtils::HashString("IT_REGISTRANT_ENTITY_TYPE");
-        static const int RU_PASSPORT_DATA_HASH = HashingUtils::HashString("RU_PASSPORT_DATA");
-        static const int SE_ID_NUMBER_HASH = HashingUtils::HashString("SE_ID_NUMBER");
-        static const int SG_ID_NUMBER_HASH = HashingUtils::HashString("SG_ID_NUMBER");
-        static const int VAT_NUMBER_HASH = HashingUtils::HashString("VAT_NUMBER");
-        static const int UK_CONTACT_TYPE_HASH = HashingUtils::HashString("UK_CONTACT_TYPE");
-        static const int UK_COMPANY_NUMBER_HASH = HashingUtils::HashString("UK_COMPANY_NUMBER");
+        static constexpr int DUNS_NUMBER_HASH = HashingUtils::CompileTimeHashString("DUNS_NUMBER");
+        static constexpr int BRAND_NUMBER_HASH = HashingUtils::CompileTimeHashString("BRAND_NUMBER");
+        static constexpr int BIRTH_DEPARTMENT_HASH = HashingUtils::CompileTimeHashString("BIRTH_DEPARTMENT");
+        static constexpr int BIRTH_DATE_IN_YYYY_MM_DD_HASH = HashingUtils::CompileTimeHashString("BIRTH_DATE_IN_YYYY_MM_DD");
+        static constexpr int BIRTH_COUNTRY_HASH = HashingUtils::CompileTimeHashString("BIRTH_COUNTRY");
+        static constexpr int BIRTH_CITY_HASH = HashingUtils::CompileTimeHashString("BIRTH_CITY");
+        static constexpr int DOCUMENT_NUMBER_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_NUMBER");
+        static constexpr int AU_ID_NUMBER_HASH = HashingUtils::CompileTimeHashString("AU_ID_NUMBER");
+        static constexpr int AU_ID_TYPE_HASH = HashingUtils::CompileTimeHashString("AU_ID_TYPE");
+        static constexpr int CA_LEGAL_TYPE_HASH = HashingUtils::CompileTimeHashString("CA_LEGAL_TYPE");
+        static constexpr int CA_BUSINESS_ENTITY_TYPE_HASH = HashingUtils::CompileTimeHashString("CA_BUSINESS_ENTITY_TYPE");
+        static constexpr int ES_IDENTIFICATION_HASH = HashingUtils::CompileTimeHashString("ES_IDENTIFICATION");
+        static constexpr int ES_IDENTIFICATION_TYPE_HASH = HashingUtils::CompileTimeHashString("ES_IDENTIFICATION_TYPE");
+        static constexpr int ES_LEGAL_FORM_HASH = HashingUtils::CompileTimeHashString("ES_LEGAL_FORM");
+        static constexpr int FI_BUSINESS_NUMBER_HASH = HashingUtils::CompileTimeHashString("FI_BUSINESS_NUMBER");
+        static constexpr int FI_ID_NUMBER_HASH = HashingUtils::CompileTimeHashString("FI_ID_NUMBER");
+        static constexpr int FI_NATIONALITY_HASH = HashingUtils::CompileTimeHashString("FI_NATIONALITY");
+        static constexpr int FI_ORGANIZATION_TYPE_HASH = HashingUtils::CompileTimeHashString("FI_ORGANIZATION_TYPE");
+        static constexpr int IT_PIN_HASH = HashingUtils::CompileTimeHashString("IT_PIN");
+        static constexpr int IT_REGISTRANT_ENTITY_TYPE_HASH = HashingUtils::CompileTimeHashString("IT_REGISTRANT_ENTITY_TYPE");
+        static constexpr int RU_PASSPORT_DATA_HASH = HashingUtils::CompileTimeHashString("RU_PASSPORT_DATA");
+        static constexpr int SE_ID_NUMBER_HASH = HashingUtils::CompileTimeHashString("SE_ID_NUMBER");
+        static constexpr int SG_ID_NUMBER_HASH = HashingUtils::CompileTimeHashString("SG_ID_NUMBER");
+        static constexpr int VAT_NUMBER_HASH = HashingUtils::CompileTimeHashString("VAT_NUMBER");
+        static constexpr int UK_CONTACT_TYPE_HASH = HashingUtils::CompileTimeHashString("UK_CONTACT_TYPE");
+        static constexpr int UK_COMPANY_NUMBER_HASH = HashingUtils::CompileTimeHashString("UK_COMPANY_NUMBER");
 
 
         ExtraParamName GetExtraParamNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DUNS_NUMBER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExtraParamName::DUNS_NUMBER;
-          }
-          else if (hashCode == BRAND_NUMBER_HASH)
-          {
-            return ExtraParamName::BRAND_NUMBER;
-          }
-          else if (hashCode == BIRTH_DEPARTMENT_HASH)
-          {
-            return ExtraParamName::BIRTH_DEPARTMENT;
-          }
-          else if (hashCode == BIRTH_DATE_IN_YYYY_MM_DD_HASH)
-          {
-            return ExtraParamName::BIRTH_DATE_IN_YYYY_MM_DD;
-          }
-          else if (hashCode == BIRTH_COUNTRY_HASH)
-          {
-            return ExtraParamName::BIRTH_COUNTRY;
-          }
-          else if (hashCode == BIRTH_CITY_HASH)
-          {
-            return ExtraParamName::BIRTH_CITY;
-          }
-          else if (hashCode == DOCUMENT_NUMBER_HASH)
-          {
-            return ExtraParamName::DOCUMENT_NUMBER;
-          }
-          else if (hashCode == AU_ID_NUMBER_HASH)
-          {
-            return ExtraParamName::AU_ID_NUMBER;
-          }
-          else if (hashCode == AU_ID_TYPE_HASH)
-          {
-            return ExtraParamName::AU_ID_TYPE;
-          }
-          else if (hashCode == CA_LEGAL_TYPE_HASH)
-          {
-            return ExtraParamName::CA_LEGAL_TYPE;
-          }
-          else if (hashCode == CA_BUSINESS_ENTITY_TYPE_HASH)
-          {
-            return ExtraParamName::CA_BUSINESS_ENTITY_TYPE;
-          }
-          else if (hashCode == ES_IDENTIFICATION_HASH)
-          {
-            return ExtraParamName::ES_IDENTIFICATION;
-          }
-          else if (hashCode == ES_IDENTIFICATION_TYPE_HASH)
-          {
-            return ExtraParamName::ES_IDENTIFICATION_TYPE;
-          }
-          else if (hashCode == ES_LEGAL_FORM_HASH)
-          {
-            return ExtraParamName::ES_LEGAL_FORM;
-          }
-          else if (hashCode == FI_BUSINESS_NUMBER_HASH)
-          {
-            return ExtraParamName::FI_BUSINESS_NUMBER;
-          }
-          else if (hashCode == FI_ID_NUMBER_HASH)
-          {
-            return ExtraParamName::FI_ID_NUMBER;
-          }
-          else if (hashCode == FI_NATIONALITY_HASH)
-          {
-            return ExtraParamName::FI_NATIONALITY;
-          }
-          else if (hashCode == FI_ORGANIZATION_TYPE_HASH)
-          {
-            return ExtraParamName::FI_ORGANIZATION_TYPE;
-          }
-          else if (hashCode == IT_PIN_HASH)
-          {
-            return ExtraParamName::IT_PIN;
-          }
-          else if (hashCode == IT_REGISTRANT_ENTITY_TYPE_HASH)
-          {
-            return ExtraParamName::IT_REGISTRANT_ENTITY_TYPE;
-          }
-          else if (hashCode == RU_PASSPORT_DATA_HASH)
-          {
-            return ExtraParamName::RU_PASSPORT_DATA;
-          }
-          else if (hashCode == SE_ID_NUMBER_HASH)
-          {
-            return ExtraParamName::SE_ID_NUMBER;
-          }
-          else if (hashCode == SG_ID_NUMBER_HASH)
-          {
-            return ExtraParamName::SG_ID_NUMBER;
-          }
-          else if (hashCode == VAT_NUMBER_HASH)
-          {
-            return ExtraParamName::VAT_NUMBER;
-          }
-          else if (hashCode == UK_CONTACT_TYPE_HASH)
-          {
-            return ExtraParamName::UK_CONTACT_TYPE;
-          }
-          else if (hashCode == UK_COMPANY_NUMBER_HASH)
-          {
-            return ExtraParamName::UK_COMPANY_NUMBER;
+          case DUNS_NUMBER_HASH:
+            if (name == "DUNS_NUMBER")
+            {
+              return ExtraParamName::DUNS_NUMBER;
+            }
+            break;
+          case BRAND_NUMBER_HASH:
+            if (name == "BRAND_NUMBER")
+            {
+              return ExtraParamName::BRAND_NUMBER;
+            }
+            break;
+          case BIRTH_DEPARTMENT_HASH:
+            if (name == "BIRTH_DEPARTMENT")
+            {
+              return ExtraParamName::BIRTH_DEPARTMENT;
+            }
+            break;
+          case BIRTH_DATE_IN_YYYY_MM_DD_HASH:
+            if (name == "BIRTH_DATE_IN_YYYY_MM_DD")
+            {
+              return ExtraParamName::BIRTH_DATE_IN_YYYY_MM_DD;
+            }
+            break;
+          case BIRTH_COUNTRY_HASH:
+            if (name == "BIRTH_COUNTRY")
+            {
+              return ExtraParamName::BIRTH_COUNTRY;
+            }
+            break;
+          case BIRTH_CITY_HASH:
+            if (name == "BIRTH_CITY")
+            {
+              return ExtraParamName::BIRTH_CITY;
+            }
+            break;
+          case DOCUMENT_NUMBER_HASH:
+            if (name == "DOCUMENT_NUMBER")
+            {
+              return ExtraParamName::DOCUMENT_NUMBER;
+            }
+            break;
+          case AU_ID_NUMBER_HASH:
+            if (name == "AU_ID_NUMBER")
+            {
+              return ExtraParamName::AU_ID_NUMBER;
+            }
+            break;
+          case AU_ID_TYPE_HASH:
+            if (name == "AU_ID_TYPE")
+            {
+              return ExtraParamName::AU_ID_TYPE;
+            }
+            break;
+          case CA_LEGAL_TYPE_HASH:
+            if (name == "CA_LEGAL_TYPE")
+            {
+              return ExtraParamName::CA_LEGAL_TYPE;
+            }
+            break;
+          case CA_BUSINESS_ENTITY_TYPE_HASH:
+            if (name == "CA_BUSINESS_ENTITY_TYPE")
+            {
+              return ExtraParamName::CA_BUSINESS_ENTITY_TYPE;
+            }
+            break;
+          case ES_IDENTIFICATION_HASH:
+            if (name == "ES_IDENTIFICATION")
+            {
+              return ExtraParamName::ES_IDENTIFICATION;
+            }
+            break;
+          case ES_IDENTIFICATION_TYPE_HASH:
+            if (name == "ES_IDENTIFICATION_TYPE")
+            {
+              return ExtraParamName::ES_IDENTIFICATION_TYPE;
+            }
+            break;
+          case ES_LEGAL_FORM_HASH:
+            if (name == "ES_LEGAL_FORM")
+            {
+              return ExtraParamName::ES_LEGAL_FORM;
+            }
+            break;
+          case FI_BUSINESS_NUMBER_HASH:
+            if (name == "FI_BUSINESS_NUMBER")
+            {
+              return ExtraParamName::FI_BUSINESS_NUMBER;
+            }
+            break;
+          case FI_ID_NUMBER_HASH:
+            if (name == "FI_ID_NUMBER")
+            {
+              return ExtraParamName::FI_ID_NUMBER;
+            }
+            break;
+          case FI_NATIONALITY_HASH:
+            if (name == "FI_NATIONALITY")
+            {
+              return ExtraParamName::FI_NATIONALITY;
+            }
+            break;
+          case FI_ORGANIZATION_TYPE_HASH:
+            if (name == "FI_ORGANIZATION_TYPE")
+            {
+              return ExtraParamName::FI_ORGANIZATION_TYPE;
+            }
+            break;
+          case IT_PIN_HASH:
+            if (name == "IT_PIN")
+            {
+              return ExtraParamName::IT_PIN;
+            }
+            break;
+          case IT_REGISTRANT_ENTITY_TYPE_HASH:
+            if (name == "IT_REGISTRANT_ENTITY_TYPE")
+            {
+              return ExtraParamName::IT_REGISTRANT_ENTITY_TYPE;
+            }
+            break;
+          case RU_PASSPORT_DATA_HASH:
+            if (name == "RU_PASSPORT_DATA")
+            {
+              return ExtraParamName::RU_PASSPORT_DATA;
+            }
+            break;
+          case SE_ID_NUMBER_HASH:
+            if (name == "SE_ID_NUMBER")
+            {
+              return ExtraParamName::SE_ID_NUMBER;
+            }
+            break;
+          case SG_ID_NUMBER_HASH:
+            if (name == "SG_ID_NUMBER")
+            {
+              return ExtraParamName::SG_ID_NUMBER;
+            }
+            break;
+          case VAT_NUMBER_HASH:
+            if (name == "VAT_NUMBER")
+            {
+              return ExtraParamName::VAT_NUMBER;
+            }
+            break;
+          case UK_CONTACT_TYPE_HASH:
+            if (name == "UK_CONTACT_TYPE")
+            {
+              return ExtraParamName::UK_CONTACT_TYPE;
+            }
+            break;
+          case UK_COMPANY_NUMBER_HASH:
+            if (name == "UK_COMPANY_NUMBER")
+            {
+              return ExtraParamName::UK_COMPANY_NUMBER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -175,7 +233,7 @@ namespace Aws
           return ExtraParamName::NOT_SET;
         }
 
-        Aws::String GetNameForExtraParamName(ExtraParamName enumValue)
+        const char* GetNameForExtraParamName(ExtraParamName enumValue)
         {
           switch(enumValue)
           {
@@ -235,7 +293,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
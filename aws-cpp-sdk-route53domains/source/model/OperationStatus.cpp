@@ -30,35 +30,51 @@ namespace Aws
       namespace OperationStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int SUCCESSFUL_HASH = HashingUtils::HashString("SUCCESSFUL");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int SUBMITTED_HASH = HashingUtils::CompileTimeHashString("SUBMITTED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int SUCCESSFUL_HASH = HashingUtils::CompileTimeHashString("SUCCESSFUL");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         OperationStatus GetOperationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationStatus::SUBMITTED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return OperationStatus::IN_PROGRESS;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return OperationStatus::ERROR_;
-          }
-          else if (hashCode == SUCCESSFUL_HASH)
-          {
-            return OperationStatus::SUCCESSFUL;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return OperationStatus::FAILED;
+          case SUBMITTED_HASH:
+            if (name == "SUBMITTED")
+            {
+              return OperationStatus::SUBMITTED;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return OperationStatus::IN_PROGRESS;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return OperationStatus::ERROR_;
+            }
+            break;
+          case SUCCESSFUL_HASH:
+            if (name == "SUCCESSFUL")
+            {
+              return OperationStatus::SUCCESSFUL;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return OperationStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return OperationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForOperationStatus(OperationStatus enumValue)
+        const char* GetNameForOperationStatus(OperationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
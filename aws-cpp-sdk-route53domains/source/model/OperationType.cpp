@@ -30,90 +30,128 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int REGISTER_DOMAIN_HASH = HashingUtils::HashString("REGISTER_DOMAIN");
-        static const int DELETE_DOMAIN_HASH = HashingUtils::HashString("DELETE_DOMAIN");
-        static const int TRANSFER_IN_DOMAIN_HASH = HashingUtils::HashString("TRANSFER_IN_DOMAIN");
-        static const int UPDATE_DOMAIN_CONTACT_HASH = HashingUtils::HashString("UPDATE_DOMAIN_CONTACT");
-        static const int UPDATE_NAMESERVER_HASH = HashingUtils::HashString("UPDATE_NAMESERVER");
-        static const int CHANGE_PRIVACY_PROTECTION_HASH = HashingUtils::HashString("CHANGE_PRIVACY_PROTECTION");
-        static const int DOMAIN_LOCK_HASH = HashingUtils::HashString("DOMAIN_LOCK");
-        static const int ENABLE_AUTORENEW_HASH = HashingUtils::HashString("ENABLE_AUTORENEW");
-        static const int DISABLE_AUTORENEW_HASH = HashingUtils::HashString("DISABLE_AUTORENEW");
-        static const int ADD_DNSSEC_HASH = HashingUtils::HashString("ADD_DNSSEC");
-        static const int REMOVE_DNSSEC_HASH = HashingUtils::HashString("REMOVE_DNSSEC");
-        static const int EXPIRE_DOMAIN_HASH = HashingUtils::HashString("EXPIRE_DOMAIN");
-        static const int TRANSFER_OUT_DOMAIN_HASH = HashingUtils::HashString("TRANSFER_OUT_DOMAIN");
-        static const int CHANGE_DOMAIN_OWNER_HASH = HashingUtils::HashString("CHANGE_DOMAIN_OWNER");
-        static const int RENEW_DOMAIN_HASH = HashingUtils::HashString("RENEW_DOMAIN");
-        static const int PUSH_DOMAIN_HASH = HashingUtils::HashString("PUSH_DOMAIN");
+        static constexpr int REGISTER_DOMAIN_HASH = HashingUtils::CompileTimeHashString("REGISTER_DOMAIN");
+        static constexpr int DELETE_DOMAIN_HASH = HashingUtils::CompileTimeHashString("DELETE_DOMAIN");
+        static constexpr int TRANSFER_IN_DOMAIN_HASH = HashingUtils::CompileTimeHashString("TRANSFER_IN_DOMAIN");
+        static constexpr int UPDATE_DOMAIN_CONTACT_HASH = HashingUtils::CompileTimeHashString("UPDATE_DOMAIN_CONTACT");
+        static constexpr int UPDATE_NAMESERVER_HASH = HashingUtils::CompileTimeHashString("UPDATE_NAMESERVER");
+        static constexpr int CHANGE_PRIVACY_PROTECTION_HASH = HashingUtils::CompileTimeHashString("CHANGE_PRIVACY_PROTECTION");
+        static constexpr int DOMAIN_LOCK_HASH = HashingUtils::CompileTimeHashString("DOMAIN_LOCK");
+        static constexpr int ENABLE_AUTORENEW_HASH = HashingUtils::CompileTimeHashString("ENABLE_AUTORENEW");
+        static constexpr int DISABLE_AUTORENEW_HASH = HashingUtils::CompileTimeHashString("DISABLE_AUTORENEW");
+        static constexpr int ADD_DNSSEC_HASH = HashingUtils::CompileTimeHashString("ADD_DNSSEC");
+        static constexpr int REMOVE_DNSSEC_HASH = HashingUtils::CompileTimeHashString("REMOVE_DNSSEC");
+        static constexpr int EXPIRE_DOMAIN_HASH = HashingUtils::CompileTimeHashString("EXPIRE_DOMAIN");
+        static constexpr int TRANSFER_OUT_DOMAIN_HASH = HashingUtils::CompileTimeHashString("TRANSFER_OUT_DOMAIN");
+        static constexpr int CHANGE_DOMAIN_OWNER_HASH = HashingUtils::CompileTimeHashString("CHANGE_DOMAIN_OWNER");
+        static constexpr int RENEW_DOMAIN_HASH = HashingUtils::CompileTimeHashString("RENEW_DOMAIN");
+        static constexpr int PUSH_DOMAIN_HASH = HashingUtils::CompileTimeHashString("PUSH_DOMAIN");
 
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGISTER_DOMAIN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationType::REGISTER_DOMAIN;
-          }
-          else if (hashCode == DELETE_DOMAIN_HASH)
-          {
-            return OperationType::DELETE_DOMAIN;
-          }
-          else if (hashCode == TRANSFER_IN_DOMAIN_HASH)
-          {
-            return OperationType::TRANSFER_IN_DOMAIN;
-          }
-          else if (hashCode == UPDATE_DOMAIN_CONTACT_HASH)
-          {
-            return OperationType::UPDATE_DOMAIN_CONTACT;
-          }
-          else if (hashCode == UPDATE_NAMESERVER_HASH)
-          {
-            return OperationType::UPDATE_NAMESERVER;
-          }
-          else if (hashCode == CHANGE_PRIVACY_PROTECTION_HASH)
-          {
-            return OperationType::CHANGE_PRIVACY_PROTECTION;
-          }
-          else if (hashCode == DOMAIN_LOCK_HASH)
-          {
-            return OperationType::DOMAIN_LOCK;
-          }
-          else if (hashCode == ENABLE_AUTORENEW_HASH)
-          {
-            return OperationType::ENABLE_AUTORENEW;
-          }
-          else if (hashCode == DISABLE_AUTORENEW_HASH)
-          {
-            return OperationType::DISABLE_AUTORENEW;
-          }
-          else if (hashCode == ADD_DNSSEC_HASH)
-          {
-            return OperationType::ADD_DNSSEC;
-          }
-          else if (hashCode == REMOVE_DNSSEC_HASH)
-          {
-            return OperationType::REMOVE_DNSSEC;
-          }
-          else if (hashCode == EXPIRE_DOMAIN_HASH)
-          {
-            return OperationType::EXPIRE_DOMAIN;
-          }
-          else if (hashCode == TRANSFER_OUT_DOMAIN_HASH)
-          {
-            return OperationType::TRANSFER_OUT_DOMAIN;
-          }
-          else if (hashCode == CHANGE_DOMAIN_OWNER_HASH)
-          {
-            return OperationType::CHANGE_DOMAIN_OWNER;
-          }
-          else if (hashCode == RENEW_DOMAIN_HASH)
-          {
-            return OperationType::RENEW_DOMAIN;
-          }
-          else if (hashCode == PUSH_DOMAIN_HASH)
-          {
-            return OperationType::PUSH_DOMAIN;
+          case REGISTER_DOMAIN_HASH:
+            if (name == "REGISTER_DOMAIN")
+            {
+              return OperationType::REGISTER_DOMAIN;
+            }
+            break;
+          case DELETE_DOMAIN_HASH:
+            if (name == "DELETE_DOMAIN")
+            {
+              return OperationType::DELETE_DOMAIN;
+            }
+            break;
+          case TRANSFER_IN_DOMAIN_HASH:
+            if (name == "TRANSFER_IN_DOMAIN")
+            {
+              return OperationType::TRANSFER_IN_DOMAIN;
+            }
+            break;
+          case UPDATE_DOMAIN_CONTACT_HASH:
+            if (name == "UPDATE_DOMAIN_CONTACT")
+            {
+              return OperationType::UPDATE_DOMAIN_CONTACT;
+            }
+            break;
+          case UPDATE_NAMESERVER_HASH:
+            if (name == "UPDATE_NAMESERVER")
+            {
+              return OperationType::UPDATE_NAMESERVER;
+            }
+            break;
+          case CHANGE_PRIVACY_PROTECTION_HASH:
+            if (name == "CHANGE_PRIVACY_PROTECTION")
+            {
+              return OperationType::CHANGE_PRIVACY_PROTECTION;
+            }
+            break;
+          case DOMAIN_LOCK_HASH:
+            if (name == "DOMAIN_LOCK")
+            {
+              return OperationType::DOMAIN_LOCK;
+            }
+            break;
+          case ENABLE_AUTORENEW_HASH:
+            if (name == "ENABLE_AUTORENEW")
+            {
+              return OperationType::ENABLE_AUTORENEW;
+            }
+            break;
+          case DISABLE_AUTORENEW_HASH:
+            if (name == "DISABLE_AUTORENEW")
+            {
+              return OperationType::DISABLE_AUTORENEW;
+            }
+            break;
+          case ADD_DNSSEC_HASH:
+            if (name == "ADD_DNSSEC")
+            {
+              return OperationType::ADD_DNSSEC;
+            }
+            break;
+          case REMOVE_DNSSEC_HASH:
+            if (name == "REMOVE_DNSSEC")
+            {
+              return OperationType::REMOVE_DNSSEC;
+            }
+            break;
+          case EXPIRE_DOMAIN_HASH:
+            if (name == "EXPIRE_DOMAIN")
+            {
+              return OperationType::EXPIRE_DOMAIN;
+            }
+            break;
+          case TRANSFER_OUT_DOMAIN_HASH:
+            if (name == "TRANSFER_OUT_DOMAIN")
+            {
+              return OperationType::TRANSFER_OUT_DOMAIN;
+            }
+            break;
+          case CHANGE_DOMAIN_OWNER_HASH:
+            if (name == "CHANGE_DOMAIN_OWNER")
+            {
+              return OperationType::CHANGE_DOMAIN_OWNER;
+            }
+            break;
+          case RENEW_DOMAIN_HASH:
+            if (name == "RENEW_DOMAIN")
+            {
+              return OperationType::RENEW_DOMAIN;
+            }
+            break;
+          case PUSH_DOMAIN_HASH:
+            if (name == "PUSH_DOMAIN")
+            {
+              return OperationType::PUSH_DOMAIN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -125,7 +163,7 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationType(OperationType enumValue)
         {
           switch(enumValue)
           {
@@ -165,7 +203,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ReachabilityStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int DONE_HASH = HashingUtils::HashString("DONE");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int DONE_HASH = HashingUtils::CompileTimeHashString("DONE");
+        static constexpr int EXPIRED_HASH = HashingUtils::CompileTimeHashString("EXPIRED");
 
 
         ReachabilityStatus GetReachabilityStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReachabilityStatus::PENDING;
-          }
-          else if (hashCode == DONE_HASH)
-          {
-            return ReachabilityStatus::DONE;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return ReachabilityStatus::EXPIRED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ReachabilityStatus::PENDING;
+            }
+            break;
+          case DONE_HASH:
+            if (name == "DONE")
+            {
+              return ReachabilityStatus::DONE;
+            }
+            break;
+          case EXPIRED_HASH:
+            if (name == "EXPIRED")
+            {
+              return ReachabilityStatus::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ReachabilityStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReachabilityStatus(ReachabilityStatus enumValue)
+        const char* GetNameForReachabilityStatus(ReachabilityStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
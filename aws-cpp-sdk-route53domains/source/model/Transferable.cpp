@@ -30,25 +30,37 @@ namespace Aws
       namespace TransferableMapper
       {
 
-        static const int TRANSFERABLE_HASH = HashingUtils::HashString("TRANSFERABLE");
-        static const int UNTRANSFERABLE_HASH = HashingUtils::HashString("UNTRANSFERABLE");
-        static const int DONT_KNOW_HASH = HashingUtils::HashString("DONT_KNOW");
+        static constexpr int TRANSFERABLE_HASH = HashingUtils::CompileTimeHashString("TRANSFERABLE");
+        static constexpr int UNTRANSFERABLE_HASH = HashingUtils::CompileTimeHashString("UNTRANSFERABLE");
+        static constexpr int DONT_KNOW_HASH = HashingUtils::CompileTimeHashString("DONT_KNOW");
 
 
         Transferable GetTransferableForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRANSFERABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Transferable::TRANSFERABLE;
-          }
-          else if (hashCode == UNTRANSFERABLE_HASH)
-          {
-            return Transferable::UNTRANSFERABLE;
-          }
-          else if (hashCode == DONT_KNOW_HASH)
-          {
-            return Transferable::DONT_KNOW;
+          case TRANSFERABLE_HASH:
+            if (name == "TRANSFERABLE")
+            {
+              return Transferable::TRANSFERABLE;
+            }
+            break;
+          case UNTRANSFERABLE_HASH:
+            if (name == "UNTRANSFERABLE")
+            {
+              return Transferable::UNTRANSFERABLE;
+            }
+            break;
+          case DONT_KNOW_HASH:
+            if (name == "DONT_KNOW")
+            {
+              return Transferable::DONT_KNOW;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Transferable::NOT_SET;
         }
 
-        Aws::String GetNameForTransferable(Transferable enumValue)
+        const char* GetNameForTransferable(Transferable enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
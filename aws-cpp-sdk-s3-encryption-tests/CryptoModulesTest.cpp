@@ -39,10 +39,15 @@
 #include <aws/s3/model/CreateBucketRequest.h>
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
 
 #include <aws/kms/KMSClient.h>
 #include <aws/kms/model/EncryptRequest.h>
 #include <aws/kms/model/DecryptRequest.h>
+#include <mutex>
 
 namespace
 {
@@ -62,6 +67,8 @@ namespace
     static const char* const GET_RANGE_OUTPUT = "ge for encryption and";
     static size_t const GCM_TAG_LENGTH = 128u;
     static size_t const GCM_IV_SIZE_BYTES = 12u;
+    static const char* const UPLOAD_ID_TEST = "testUploadId";
+    static size_t const PART_SIZE_TEST = 1024u;
 #endif
 
     using namespace Aws::Auth;
@@ -151,6 +158,10 @@ namespace
             m_putObjectCalled++;
             if (request.GetKey().find(Aws::S3Encryption::Handlers::DEFAULT_INSTRUCTION_FILE_SUFFIX) != Aws::String::npos)
             {
+                if (m_failInstructionFilePut)
+                {
+                    return Aws::S3::Model::PutObjectOutcome(Aws::Client::AWSError<Aws::S3::S3Errors>(Aws::S3::S3Errors::ACCESS_DENIED, false));
+                }
 
                 Aws::S3::Model::PutObjectOutcome outcome;
                 Aws::S3::Model::PutObjectResult result(outcome.GetResultWithOwnership());
@@ -170,7 +181,11 @@ namespace
 
         Aws::S3::Model::GetObjectOutcome GetObject(const Aws::S3::Model::GetObjectRequest& request) const override
         {
-            m_getObjectCalled++;
+            {
+                //parts are got concurrently
+                std::lock_guard<std::mutex> locker(m_partsLock);
+                m_getObjectCalled++;
+            }
             auto factory = request.GetResponseStreamFactory();
             Aws::Utils::Stream::ResponseStream responseStream(factory);
 
@@ -206,6 +221,48 @@ namespace
             return result;
         }
 
+        Aws::S3::Model::CreateMultipartUploadOutcome CreateMultipartUpload(const Aws::S3::Model::CreateMultipartUploadRequest& request) const override
+        {
+            m_metadata = request.GetMetadata();
+            m_parts.clear();
+            Aws::S3::Model::CreateMultipartUploadResult result;
+            result.SetUploadId(UPLOAD_ID_TEST);
+            return result;
+        }
+
+        Aws::S3::Model::UploadPartOutcome UploadPart(const Aws::S3::Model::UploadPartRequest& request) const override
+        {
+            EXPECT_EQ(UPLOAD_ID_TEST, request.GetUploadId());
+            std::shared_ptr<Aws::IOStream> body = request.GetBody();
+            Aws::String part((Aws::IStreamBufIterator(*body)), Aws::IStreamBufIterator());
+            EXPECT_EQ(static_cast<size_t>(request.GetContentLength()), part.size());
+
+            std::lock_guard<std::mutex> locker(m_partsLock);
+            m_parts[request.GetPartNumber()] = part;
+            Aws::S3::Model::UploadPartResult result;
+            result.SetETag(Aws::Utils::StringUtils::to_string(request.GetPartNumber()));
+            return result;
+        }
+
+        Aws::S3::Model::CompleteMultipartUploadOutcome CompleteMultipartUpload(const Aws::S3::Model::CompleteMultipartUploadRequest& request) const override
+        {
+            bodyString.clear();
+            for (const auto& part : request.GetMultipartUpload().GetParts())
+            {
+                EXPECT_EQ(Aws::Utils::StringUtils::to_string(part.GetPartNumber()), part.GetETag());
+                bodyString += m_parts[part.GetPartNumber()];
+            }
+            m_requestContentLength = bodyString.size();
+            m_completedParts = request.GetMultipartUpload().GetParts().size();
+            return Aws::S3::Model::CompleteMultipartUploadResult();
+        }
+
+        Aws::S3::Model::AbortMultipartUploadOutcome AbortMultipartUpload(const Aws::S3::Model::AbortMultipartUploadRequest&) const override
+        {
+            m_parts.clear();
+            return Aws::S3::Model::AbortMultipartUploadResult();
+        }
+
         const Aws::Map<Aws::String, Aws::String>& GetMetadata() const
         {
             return m_metadata;
@@ -223,6 +280,10 @@ namespace
         mutable std::shared_ptr<Aws::IOStream> m_body;
         mutable std::shared_ptr<Aws::IOStream> m_instructionBody;
         mutable size_t m_requestContentLength;
+        mutable std::mutex m_partsLock;
+        mutable Aws::Map<int, Aws::String> m_parts;
+        mutable size_t m_completedParts = 0;
+        bool m_failInstructionFilePut = false;
     };
 
     class CryptoModulesTest : public ::testing::Test
@@ -834,6 +895,41 @@ namespace
 #endif // !defined(NDEBUG) && defined(GTEST_HAS_DEATH_TEST)
 #endif
 
+    TEST_F(CryptoModulesTest, InstructionFilePutBeforeBody)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::INSTRUCTION_FILE, CryptoMode::AUTHENTICATED_ENCRYPTION);
+
+        MockS3Client s3Client;
+        CryptoModuleFactory factory;
+        auto putObjectFunction = [&s3Client](const Aws::S3::Model::PutObjectRequest& putRequest) { return s3Client.PutObject(putRequest); };
+
+        for (bool failInstructionFilePut : { false, true })
+        {
+            s3Client.m_failInstructionFilePut = failInstructionFilePut;
+            s3Client.m_putObjectCalled = 0;
+            auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+
+            PutObjectRequest putRequest;
+            putRequest.SetBucket(BUCKET_TEST_NAME);
+            putRequest.SetKey(KEY_TEST_NAME);
+            std::shared_ptr<Aws::IOStream> objectStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+            *objectStream << BODY_STREAM_TEST;
+            objectStream->flush();
+            putRequest.SetBody(objectStream);
+
+            auto putOutcome = module->PutObjectSecurely(putRequest, putObjectFunction);
+            ASSERT_EQ(!failInstructionFilePut, putOutcome.IsSuccess());
+            //the body isn't put without its instruction file
+            ASSERT_EQ(failInstructionFilePut ? 1u : 2u, s3Client.m_putObjectCalled);
+            ASSERT_EQ(0u, s3Client.GetMetadata().count(CONTENT_KEY_HEADER));
+            if (failInstructionFilePut)
+            {
+                ASSERT_TRUE(putOutcome.GetError().GetErrorType().IsS3Error());
+            }
+        }
+    }
+
     TEST_F(CryptoModulesTest, RangeParserSuccess)
     {
         SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
@@ -871,6 +967,247 @@ namespace
             ASSERT_EQ(pair, std::make_pair(static_cast<int64_t>(0), static_cast<int64_t>(0)));
         }
     }
+
+    //Puts an object with a multipart upload and gets it back with ranged gets, in each crypto mode.
+    static void PartsRoundTrip(CryptoMode cryptoMode, size_t bodyLength, bool concurrentParts = true)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, cryptoMode);
+        cryptoConfig.SetPartSize(PART_SIZE_TEST);
+        cryptoConfig.SetMaxConcurrentParts(2);
+
+        MockS3Client s3Client;
+        CryptoModuleFactory factory;
+        auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+
+        Aws::String body;
+        for (size_t i = 0; i < bodyLength; ++i)
+        {
+            body.push_back(static_cast<char>('a' + i % 26));
+        }
+        PutObjectRequest putRequest;
+        putRequest.SetBucket(BUCKET_TEST_NAME);
+        putRequest.SetKey(KEY_TEST_NAME);
+        std::shared_ptr<Aws::IOStream> objectStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        *objectStream << body;
+        objectStream->flush();
+        putRequest.SetBody(objectStream);
+
+        auto putOutcome = module->PutObjectSecurelyInParts(putRequest, s3Client, concurrentParts);
+        ASSERT_TRUE(putOutcome.IsSuccess());
+        ASSERT_EQ((bodyLength + PART_SIZE_TEST - 1) / PART_SIZE_TEST, s3Client.m_completedParts);
+        ASSERT_EQ(0u, s3Client.m_putObjectCalled);
+        ASSERT_EQ(1u, s3Client.GetMetadata().count(CONTENT_KEY_HEADER));
+        ASSERT_EQ(1u, s3Client.GetMetadata().count(IV_HEADER));
+        ASSERT_TRUE(s3Client.GetRequestContentLength() > bodyLength);
+
+        HeadObjectRequest headObject;
+        headObject.WithBucket(BUCKET_TEST_NAME);
+        headObject.WithKey(KEY_TEST_NAME);
+        HeadObjectOutcome headOutcome = s3Client.HeadObject(headObject);
+        Aws::S3Encryption::Handlers::MetadataHandler handler;
+        ContentCryptoMaterial contentCryptoMaterial = handler.ReadContentCryptoMaterial(headOutcome.GetResult());
+
+        //the object is the same as one put with a single request, so it can be got with a single request too
+        auto decryptionModule = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        GetObjectRequest getRequest;
+        getRequest.SetBucket(BUCKET_TEST_NAME);
+        getRequest.SetKey(KEY_TEST_NAME);
+        auto getObjectFunction = [&s3Client](Aws::S3::Model::GetObjectRequest getRequest) -> Aws::S3::Model::GetObjectOutcome { return s3Client.GetObject(getRequest); };
+        auto getOutcome = decryptionModule->GetObjectSecurely(getRequest, headOutcome.GetResult(), contentCryptoMaterial, getObjectFunction);
+        ASSERT_TRUE(getOutcome.IsSuccess());
+        Aws::OStringStream singleRequestBody;
+        singleRequestBody << getOutcome.GetResult().GetBody().rdbuf();
+        ASSERT_EQ(body, singleRequestBody.str());
+
+        decryptionModule = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        auto partsOutcome = decryptionModule->GetObjectSecurelyInParts(getRequest, headOutcome.GetResult(), contentCryptoMaterial, s3Client, concurrentParts);
+        ASSERT_TRUE(partsOutcome.IsSuccess());
+        Aws::OStringStream partsBody;
+        partsBody << partsOutcome.GetResult().GetBody().rdbuf();
+        ASSERT_EQ(body, partsBody.str());
+        ASSERT_EQ(static_cast<long long>(bodyLength), partsOutcome.GetResult().GetContentLength());
+        ASSERT_EQ(s3Client.GetMetadata(), partsOutcome.GetResult().GetMetadata());
+    }
+
+    TEST_F(CryptoModulesTest, EncryptionOnlyPartsRoundTrip)
+    {
+        PartsRoundTrip(CryptoMode::ENCRYPTION_ONLY, 5 * PART_SIZE_TEST + 100);
+        PartsRoundTrip(CryptoMode::ENCRYPTION_ONLY, 3 * PART_SIZE_TEST);
+    }
+
+    TEST_F(CryptoModulesTest, AuthenticatedEncryptionPartsRoundTrip)
+    {
+        PartsRoundTrip(CryptoMode::AUTHENTICATED_ENCRYPTION, 5 * PART_SIZE_TEST + 100);
+        PartsRoundTrip(CryptoMode::AUTHENTICATED_ENCRYPTION, 3 * PART_SIZE_TEST);
+    }
+
+    TEST_F(CryptoModulesTest, StrictAuthenticatedEncryptionPartsRoundTrip)
+    {
+        PartsRoundTrip(CryptoMode::STRICT_AUTHENTICATED_ENCRYPTION, 5 * PART_SIZE_TEST + 100);
+    }
+
+    TEST_F(CryptoModulesTest, PartsRoundTripOnCallingThread)
+    {
+        PartsRoundTrip(CryptoMode::ENCRYPTION_ONLY, 5 * PART_SIZE_TEST + 100, false);
+        PartsRoundTrip(CryptoMode::AUTHENTICATED_ENCRYPTION, 5 * PART_SIZE_TEST + 100, false);
+    }
+
+    TEST_F(CryptoModulesTest, InstructionFilePutBeforeParts)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::INSTRUCTION_FILE, CryptoMode::AUTHENTICATED_ENCRYPTION);
+        cryptoConfig.SetPartSize(PART_SIZE_TEST);
+
+        MockS3Client s3Client;
+        s3Client.m_failInstructionFilePut = true;
+        CryptoModuleFactory factory;
+        auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+
+        PutObjectRequest putRequest;
+        putRequest.SetBucket(BUCKET_TEST_NAME);
+        putRequest.SetKey(KEY_TEST_NAME);
+        std::shared_ptr<Aws::IOStream> objectStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        *objectStream << Aws::String(3 * PART_SIZE_TEST, 'x');
+        objectStream->flush();
+        putRequest.SetBody(objectStream);
+
+        auto putOutcome = module->PutObjectSecurelyInParts(putRequest, s3Client);
+        ASSERT_FALSE(putOutcome.IsSuccess());
+        ASSERT_TRUE(putOutcome.GetError().GetErrorType().IsS3Error());
+        ASSERT_EQ(1u, s3Client.m_putObjectCalled);
+        //the multipart upload wasn't started
+        ASSERT_TRUE(s3Client.m_parts.empty());
+        ASSERT_EQ(0u, s3Client.m_completedParts);
+    }
+
+    TEST_F(CryptoModulesTest, AuthenticatedEncryptionPartsDetectTampering)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, CryptoMode::AUTHENTICATED_ENCRYPTION);
+        cryptoConfig.SetPartSize(PART_SIZE_TEST);
+
+        MockS3Client s3Client;
+        CryptoModuleFactory factory;
+        auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+
+        PutObjectRequest putRequest;
+        putRequest.SetBucket(BUCKET_TEST_NAME);
+        putRequest.SetKey(KEY_TEST_NAME);
+        std::shared_ptr<Aws::IOStream> objectStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        *objectStream << Aws::String(3 * PART_SIZE_TEST, 'x');
+        objectStream->flush();
+        putRequest.SetBody(objectStream);
+        ASSERT_TRUE(module->PutObjectSecurelyInParts(putRequest, s3Client).IsSuccess());
+
+        s3Client.bodyString[2 * PART_SIZE_TEST] ^= 0x01;
+
+        HeadObjectRequest headObject;
+        headObject.WithBucket(BUCKET_TEST_NAME);
+        headObject.WithKey(KEY_TEST_NAME);
+        HeadObjectOutcome headOutcome = s3Client.HeadObject(headObject);
+        Aws::S3Encryption::Handlers::MetadataHandler handler;
+        ContentCryptoMaterial contentCryptoMaterial = handler.ReadContentCryptoMaterial(headOutcome.GetResult());
+
+        GetObjectRequest getRequest;
+        getRequest.SetBucket(BUCKET_TEST_NAME);
+        getRequest.SetKey(KEY_TEST_NAME);
+        auto decryptionModule = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+        auto partsOutcome = decryptionModule->GetObjectSecurelyInParts(getRequest, headOutcome.GetResult(), contentCryptoMaterial, s3Client);
+        ASSERT_FALSE(partsOutcome.IsSuccess());
+        ASSERT_TRUE(partsOutcome.GetError().GetErrorType().IsCryptoError());
+    }
+
+    TEST_F(CryptoModulesTest, EncryptionOnlyPartsAreWholeBlocks)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, CryptoMode::ENCRYPTION_ONLY);
+        //not a multiple of the block size, parts are rounded up to 1008 bytes
+        cryptoConfig.SetPartSize(PART_SIZE_TEST - 24);
+
+        MockS3Client s3Client;
+        CryptoModuleFactory factory;
+        auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+
+        PutObjectRequest putRequest;
+        putRequest.SetBucket(BUCKET_TEST_NAME);
+        putRequest.SetKey(KEY_TEST_NAME);
+        std::shared_ptr<Aws::IOStream> objectStream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+        *objectStream << Aws::String(3 * PART_SIZE_TEST, 'x');
+        objectStream->flush();
+        putRequest.SetBody(objectStream);
+        ASSERT_TRUE(module->PutObjectSecurelyInParts(putRequest, s3Client).IsSuccess());
+
+        ASSERT_EQ(4u, s3Client.m_parts.size());
+        ASSERT_EQ(1008u, s3Client.m_parts[1].size());
+        ASSERT_EQ(1008u, s3Client.m_parts[2].size());
+        ASSERT_EQ(1008u, s3Client.m_parts[3].size());
+        //the rest of the body and its padding
+        ASSERT_EQ(3 * PART_SIZE_TEST - 3 * 1008u + 16u, s3Client.m_parts[4].size());
+    }
+
+    //Reports a body longer than the one it holds, as a stream over a file truncated after its length was taken would.
+    class TruncatedStreamBuf : public std::streambuf
+    {
+    public:
+        TruncatedStreamBuf(const Aws::String& data, size_t reportedLength) : m_data(data), m_reportedLength(reportedLength), m_atReportedEnd(false)
+        {
+            setg(&m_data[0], &m_data[0], &m_data[0] + m_data.size());
+        }
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+        {
+            //the end, and telling the position there, go by the reported length
+            if (dir == std::ios_base::end || (dir == std::ios_base::cur && m_atReportedEnd))
+            {
+                m_atReportedEnd = true;
+                return pos_type(static_cast<off_type>(m_reportedLength) + off);
+            }
+            off_type position = (dir == std::ios_base::beg ? 0 : gptr() - eback()) + off;
+            return seekpos(pos_type(position), which);
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode) override
+        {
+            off_type position = static_cast<off_type>(pos);
+            if (position < 0 || position > static_cast<off_type>(m_data.size()))
+            {
+                return pos_type(off_type(-1));
+            }
+            m_atReportedEnd = false;
+            setg(&m_data[0], &m_data[0] + position, &m_data[0] + m_data.size());
+            return pos;
+        }
+
+    private:
+        Aws::String m_data;
+        size_t m_reportedLength;
+        bool m_atReportedEnd;
+    };
+
+    TEST_F(CryptoModulesTest, PartsPutFailsOnShortBody)
+    {
+        SimpleEncryptionMaterials materials(Aws::Utils::Crypto::SymmetricCipher::GenerateKey());
+        CryptoConfiguration cryptoConfig(StorageMethod::METADATA, CryptoMode::AUTHENTICATED_ENCRYPTION);
+        cryptoConfig.SetPartSize(PART_SIZE_TEST);
+
+        MockS3Client s3Client;
+        CryptoModuleFactory factory;
+        auto module = factory.FetchCryptoModule(Aws::MakeShared<SimpleEncryptionMaterials>(ALLOCATION_TAG, materials), cryptoConfig);
+
+        TruncatedStreamBuf streamBuf(Aws::String(2 * PART_SIZE_TEST + 100, 'x'), 3 * PART_SIZE_TEST);
+        PutObjectRequest putRequest;
+        putRequest.SetBucket(BUCKET_TEST_NAME);
+        putRequest.SetKey(KEY_TEST_NAME);
+        putRequest.SetBody(Aws::MakeShared<Aws::IOStream>(ALLOCATION_TAG, &streamBuf));
+
+        auto putOutcome = module->PutObjectSecurelyInParts(putRequest, s3Client);
+        ASSERT_FALSE(putOutcome.IsSuccess());
+        ASSERT_EQ(0u, s3Client.m_completedParts);
+        //aborted
+        ASSERT_TRUE(s3Client.m_parts.empty());
+    }
 }
 
 #endif
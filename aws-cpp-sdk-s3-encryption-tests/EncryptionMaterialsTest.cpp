@@ -393,6 +393,83 @@ namespace
         ASSERT_EQ(myClient->m_decryptCalledCount, 0u);
         ASSERT_EQ(myClient->m_encryptCalledCount, 0u);
     }
+
+    //This tests that with a data key cache, a key wrapped by KMS is reused for up to the max number of objects per key.
+    TEST_F(KMSEncryptionMaterialsTest, TestDataKeyCacheReusesEncryptionKeys)
+    {
+        auto myClient = Aws::MakeShared<MockKMSClient>(AllocationTag, ClientConfiguration());
+        InitMockKMSClient(myClient);
+
+        KMSEncryptionMaterials encryptionMaterials(TEST_CMK_ID, myClient);
+        encryptionMaterials.SetDataKeyCache(Aws::MakeShared<KMSDataKeyCache>(AllocationTag, std::chrono::minutes(5), 2u));
+
+        ContentCryptoMaterial firstMaterial(SymmetricCipher::GenerateKey(), ContentCryptoScheme::GCM);
+        auto firstKey = firstMaterial.GetContentEncryptionKey();
+        ASSERT_TRUE(encryptionMaterials.EncryptCEK(firstMaterial).IsSuccess());
+
+        ContentCryptoMaterial secondMaterial(SymmetricCipher::GenerateKey(), ContentCryptoScheme::GCM);
+        ASSERT_TRUE(encryptionMaterials.EncryptCEK(secondMaterial).IsSuccess());
+        ASSERT_EQ(firstKey, secondMaterial.GetContentEncryptionKey());
+        ASSERT_EQ(firstMaterial.GetEncryptedContentEncryptionKey(), secondMaterial.GetEncryptedContentEncryptionKey());
+        ASSERT_EQ(KeyWrapAlgorithm::KMS, secondMaterial.GetKeyWrapAlgorithm());
+        ASSERT_EQ(TEST_CMK_ID, secondMaterial.GetMaterialsDescription().at(cmkID_Identifier));
+        ASSERT_EQ(myClient->m_encryptCalledCount, 1u);
+
+        //the cached key has been used for two objects, so the third one gets its own
+        ContentCryptoMaterial thirdMaterial(SymmetricCipher::GenerateKey(), ContentCryptoScheme::GCM);
+        auto thirdKey = thirdMaterial.GetContentEncryptionKey();
+        ASSERT_TRUE(encryptionMaterials.EncryptCEK(thirdMaterial).IsSuccess());
+        ASSERT_EQ(thirdKey, thirdMaterial.GetContentEncryptionKey());
+        ASSERT_EQ(myClient->m_encryptCalledCount, 2u);
+
+        //a different encryption context doesn't share keys
+        ContentCryptoMaterial otherContextMaterial(SymmetricCipher::GenerateKey(), ContentCryptoScheme::GCM);
+        otherContextMaterial.AddMaterialsDescription("purpose", "test");
+        ASSERT_TRUE(encryptionMaterials.EncryptCEK(otherContextMaterial).IsSuccess());
+        ASSERT_EQ(myClient->m_encryptCalledCount, 3u);
+
+        //keys encrypted through the cache are known for decryption as well
+        ContentCryptoMaterial encryptedContentCryptoMaterial;
+        encryptedContentCryptoMaterial.SetMaterialsDescription(firstMaterial.GetMaterialsDescription());
+        encryptedContentCryptoMaterial.SetKeyWrapAlgorithm(KeyWrapAlgorithm::KMS);
+        encryptedContentCryptoMaterial.SetEncryptedContentEncryptionKey(firstMaterial.GetEncryptedContentEncryptionKey());
+        ASSERT_TRUE(encryptionMaterials.DecryptCEK(encryptedContentCryptoMaterial).IsSuccess());
+        ASSERT_EQ(myClient->m_decryptCalledCount, 0u);
+    }
+
+    //This tests that with a data key cache, decrypted keys are remembered until they expire.
+    TEST_F(KMSEncryptionMaterialsTest, TestDataKeyCacheRemembersDecryptedKeys)
+    {
+        auto myClient = Aws::MakeShared<MockKMSClient>(AllocationTag, ClientConfiguration());
+        InitMockKMSClient(myClient);
+
+        KMSEncryptionMaterials encryptionMaterials(TEST_CMK_ID, myClient);
+        encryptionMaterials.SetDataKeyCache(Aws::MakeShared<KMSDataKeyCache>(AllocationTag));
+
+        auto encryptedContentKey = SymmetricCipher::GenerateKey();
+        for (unsigned i = 0; i < 3; ++i)
+        {
+            ContentCryptoMaterial encryptedContentCryptoMaterial;
+            encryptedContentCryptoMaterial.AddMaterialsDescription(cmkID_Identifier, TEST_CMK_ID);
+            encryptedContentCryptoMaterial.SetKeyWrapAlgorithm(KeyWrapAlgorithm::KMS);
+            encryptedContentCryptoMaterial.SetEncryptedContentEncryptionKey(encryptedContentKey);
+            ASSERT_TRUE(encryptionMaterials.DecryptCEK(encryptedContentCryptoMaterial).IsSuccess());
+            ASSERT_EQ(myClient->m_decryptedKey, encryptedContentCryptoMaterial.GetContentEncryptionKey());
+        }
+        ASSERT_EQ(myClient->m_decryptCalledCount, 1u);
+
+        //expired entries go back to KMS
+        encryptionMaterials.SetDataKeyCache(Aws::MakeShared<KMSDataKeyCache>(AllocationTag, std::chrono::milliseconds(0)));
+        for (unsigned i = 0; i < 2; ++i)
+        {
+            ContentCryptoMaterial encryptedContentCryptoMaterial;
+            encryptedContentCryptoMaterial.AddMaterialsDescription(cmkID_Identifier, TEST_CMK_ID);
+            encryptedContentCryptoMaterial.SetKeyWrapAlgorithm(KeyWrapAlgorithm::KMS);
+            encryptedContentCryptoMaterial.SetEncryptedContentEncryptionKey(encryptedContentKey);
+            ASSERT_TRUE(encryptionMaterials.DecryptCEK(encryptedContentCryptoMaterial).IsSuccess());
+        }
+        ASSERT_EQ(myClient->m_decryptCalledCount, 3u);
+    }
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,270 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#ifndef NO_SYMMETRIC_ENCRYPTION
+#include <aws/external/gtest.h>
+#include <aws/core/Aws.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/s3-encryption/S3EncryptionClient.h>
+#include <aws/s3-encryption/materials/SimpleEncryptionMaterials.h>
+#include <aws/s3-encryption/handlers/InstructionFileHandler.h>
+#include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/PutObjectRequest.h>
+#include <aws/testing/mocks/http/MockHttpClient.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::S3::Model;
+using namespace Aws::S3Encryption;
+using namespace Aws::Utils::Crypto;
+
+namespace
+{
+    static const char* const ALLOCATION_TAG = "S3EncryptionClientTest";
+    static const char* const BUCKET_TEST_NAME = "bucket";
+    static const char* const KEY_TEST_NAME = "key";
+
+    //The encrypted body of a request refers to the crypto module of the call that sent it, which is gone once the call
+    //returns, so requests are recorded without their bodies.
+    class BodilessMockHttpClient : public MockHttpClient
+    {
+    public:
+        using MockHttpClient::MakeRequest;
+
+        std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+        {
+            auto recorded = Aws::MakeShared<StandardHttpRequest>(ALLOCATION_TAG, static_cast<const StandardHttpRequest&>(*request));
+            recorded->AddContentBody(nullptr);
+            return MockHttpClient::MakeRequest(recorded, readLimiter, writeLimiter);
+        }
+    };
+
+    //Holds each request until the number of requests expected to be in flight together have all been made, or a few seconds
+    //went by, and records how many requests it saw in flight at once.
+    class RendezvousMockHttpClient : public BodilessMockHttpClient
+    {
+    public:
+        RendezvousMockHttpClient(size_t expectedTogether) : m_expectedTogether(expectedTogether), m_requestsMade(0), m_inFlight(0), m_maxInFlight(0) {}
+
+        using BodilessMockHttpClient::MakeRequest;
+
+        std::shared_ptr<HttpResponse> MakeRequest(const std::shared_ptr<HttpRequest>& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override
+        {
+            std::unique_lock<std::mutex> locker(m_lock);
+            ++m_requestsMade;
+            m_maxInFlight = (std::max)(m_maxInFlight, ++m_inFlight);
+            m_signal.notify_all();
+            m_signal.wait_for(locker, std::chrono::seconds(5), [this]() { return m_requestsMade >= m_expectedTogether; });
+            --m_inFlight;
+            return BodilessMockHttpClient::MakeRequest(request, readLimiter, writeLimiter);
+        }
+
+        size_t GetMaxInFlight() const
+        {
+            std::lock_guard<std::mutex> locker(m_lock);
+            return m_maxInFlight;
+        }
+
+    private:
+        const size_t m_expectedTogether;
+        mutable std::mutex m_lock;
+        mutable std::condition_variable m_signal;
+        mutable size_t m_requestsMade;
+        mutable size_t m_inFlight;
+        mutable size_t m_maxInFlight;
+    };
+
+    //The calls of the client run against a mocked http client on an executor with a single thread, unless a test creates
+    //the client again: a call that queued requests on the executor and waited for them would never return.
+    class S3EncryptionClientTest : public ::testing::Test
+    {
+    protected:
+        void SetUp()
+        {
+            m_mockHttpClientFactory = Aws::MakeShared<MockHttpClientFactory>(ALLOCATION_TAG);
+            SetHttpClientFactory(m_mockHttpClientFactory);
+            m_dummyRequest = m_mockHttpClientFactory->CreateHttpRequest(URI("http://www.uri.com"), HttpMethod::HTTP_GET,
+                Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            CreateClient(Aws::MakeShared<BodilessMockHttpClient>(ALLOCATION_TAG), 1);
+        }
+
+        void CreateClient(const std::shared_ptr<MockHttpClient>& mockHttpClient, size_t executorThreads)
+        {
+            m_client = nullptr;
+            m_mockHttpClient = mockHttpClient;
+            m_mockHttpClientFactory->SetClient(m_mockHttpClient);
+
+            Aws::Client::ClientConfiguration config;
+            config.scheme = Scheme::HTTP;
+            config.region = Aws::Region::US_EAST_1;
+            config.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOCATION_TAG, executorThreads);
+            config.retryStrategy = Aws::MakeShared<Aws::Client::DefaultRetryStrategy>(ALLOCATION_TAG, 0);
+
+            CryptoConfiguration cryptoConfig(StorageMethod::INSTRUCTION_FILE, CryptoMode::AUTHENTICATED_ENCRYPTION);
+            auto materials = Aws::MakeShared<Materials::SimpleEncryptionMaterials>(ALLOCATION_TAG, SymmetricCipher::GenerateKey());
+            m_client = Aws::MakeShared<S3EncryptionClient>(ALLOCATION_TAG, materials, cryptoConfig, Aws::Auth::AWSCredentials("", ""), config);
+        }
+
+        void TearDown()
+        {
+            m_client = nullptr;
+            m_mockHttpClient = nullptr;
+            m_mockHttpClientFactory = nullptr;
+            m_dummyRequest = nullptr;
+            CleanupHttp();
+            InitHttp();
+        }
+
+        void AddResponse(HttpResponseCode responseCode)
+        {
+            auto response = Aws::MakeShared<StandardHttpResponse>(ALLOCATION_TAG, *m_dummyRequest);
+            response->SetResponseCode(responseCode);
+            m_mockHttpClient->AddResponseToReturn(response);
+        }
+
+        static PutObjectRequest BuildPutRequest()
+        {
+            PutObjectRequest putRequest;
+            putRequest.SetBucket(BUCKET_TEST_NAME);
+            putRequest.SetKey(KEY_TEST_NAME);
+            auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+            *body << "This is a test body for the encryption client.";
+            putRequest.SetBody(body);
+            return putRequest;
+        }
+
+        static GetObjectRequest BuildGetRequest()
+        {
+            GetObjectRequest getRequest;
+            getRequest.SetBucket(BUCKET_TEST_NAME);
+            getRequest.SetKey(KEY_TEST_NAME);
+            return getRequest;
+        }
+
+        static bool IsInstructionFileRequest(const StandardHttpRequest& request)
+        {
+            return request.GetURIString().find(Handlers::DEFAULT_INSTRUCTION_FILE_SUFFIX) != Aws::String::npos;
+        }
+
+        std::shared_ptr<MockHttpClient> m_mockHttpClient;
+        std::shared_ptr<MockHttpClientFactory> m_mockHttpClientFactory;
+        std::shared_ptr<HttpRequest> m_dummyRequest;
+        std::shared_ptr<S3EncryptionClient> m_client;
+    };
+
+    TEST_F(S3EncryptionClientTest, PutObjectCallablePutsInstructionFileThenBody)
+    {
+        AddResponse(HttpResponseCode::OK);
+        AddResponse(HttpResponseCode::OK);
+
+        auto outcome = m_client->PutObjectCallable(BuildPutRequest()).get();
+        ASSERT_TRUE(outcome.IsSuccess());
+        const auto& requests = m_mockHttpClient->GetAllRequestsMade();
+        ASSERT_EQ(2u, requests.size());
+        ASSERT_TRUE(IsInstructionFileRequest(requests[0]));
+        ASSERT_FALSE(IsInstructionFileRequest(requests[1]));
+    }
+
+    TEST_F(S3EncryptionClientTest, PutObjectAsyncFailsBeforeBodyWithoutInstructionFile)
+    {
+        AddResponse(HttpResponseCode::FORBIDDEN);
+
+        std::mutex lock;
+        std::condition_variable signal;
+        bool called = false;
+        bool succeeded = true;
+        m_client->PutObjectAsync(BuildPutRequest(), [&](const S3EncryptionClient*, const PutObjectRequest&, const S3EncryptionPutObjectOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+        {
+            std::lock_guard<std::mutex> locker(lock);
+            succeeded = outcome.IsSuccess();
+            called = true;
+            signal.notify_one();
+        });
+
+        std::unique_lock<std::mutex> locker(lock);
+        signal.wait(locker, [&]() { return called; });
+        ASSERT_FALSE(succeeded);
+        //the body was never sent
+        ASSERT_EQ(1u, m_mockHttpClient->GetAllRequestsMade().size());
+    }
+
+    TEST_F(S3EncryptionClientTest, GetObjectCallableDoesNotWaitOnQueuedRequests)
+    {
+        AddResponse(HttpResponseCode::NOT_FOUND);
+
+        auto outcome = m_client->GetObjectCallable(BuildGetRequest()).get();
+        ASSERT_FALSE(outcome.IsSuccess());
+        //the head and the instruction file get are queued together, neither waits for the other
+        const auto& requests = m_mockHttpClient->GetAllRequestsMade();
+        ASSERT_EQ(2u, requests.size());
+        ASSERT_EQ(HttpMethod::HTTP_HEAD, requests[0].GetMethod());
+        ASSERT_TRUE(IsInstructionFileRequest(requests[1]));
+    }
+
+    TEST_F(S3EncryptionClientTest, GetObjectCallableOverlapsHeadAndInstructionFileGet)
+    {
+        auto rendezvousHttpClient = Aws::MakeShared<RendezvousMockHttpClient>(ALLOCATION_TAG, 2);
+        CreateClient(rendezvousHttpClient, 2);
+        AddResponse(HttpResponseCode::NOT_FOUND);
+        AddResponse(HttpResponseCode::NOT_FOUND);
+
+        auto outcome = m_client->GetObjectCallable(BuildGetRequest()).get();
+        ASSERT_FALSE(outcome.IsSuccess());
+        ASSERT_EQ(2u, rendezvousHttpClient->GetAllRequestsMade().size());
+        //the instruction file get was made while the head was still in flight
+        ASSERT_EQ(2u, rendezvousHttpClient->GetMaxInFlight());
+    }
+
+    TEST_F(S3EncryptionClientTest, GetObjectAsyncGetsInstructionFileWithHead)
+    {
+        //the object has no materials in its metadata, and no instruction file
+        AddResponse(HttpResponseCode::OK);
+        AddResponse(HttpResponseCode::NOT_FOUND);
+
+        std::mutex lock;
+        std::condition_variable signal;
+        bool called = false;
+        bool succeeded = true;
+        m_client->GetObjectAsync(BuildGetRequest(), [&](const S3EncryptionClient*, const GetObjectRequest&, const S3EncryptionGetObjectOutcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)
+        {
+            std::lock_guard<std::mutex> locker(lock);
+            succeeded = outcome.IsSuccess();
+            called = true;
+            signal.notify_one();
+        });
+
+        std::unique_lock<std::mutex> locker(lock);
+        signal.wait(locker, [&]() { return called; });
+        ASSERT_FALSE(succeeded);
+        const auto& requests = m_mockHttpClient->GetAllRequestsMade();
+        ASSERT_EQ(2u, requests.size());
+        ASSERT_EQ(HttpMethod::HTTP_HEAD, requests[0].GetMethod());
+        ASSERT_TRUE(IsInstructionFileRequest(requests[1]));
+    }
+}
+
+#endif
@@ -16,6 +16,8 @@
 
 #include <aws/s3-encryption/s3Encryption_EXPORTS.h>
 
+#include <cstddef>
+
 namespace Aws
 {
     namespace S3Encryption
@@ -88,9 +90,66 @@ namespace Aws
                 m_cryptoMode = cryptoMode;
             }
 
+            /**
+            * Gets the part size for multipart uploads and parallel ranged gets. 0 means objects are transferred in a single request.
+            */
+            inline size_t GetPartSize() const
+            {
+                return m_partSize;
+            }
+
+            /**
+            * Objects larger than partSize are put with a multipart upload, and (unless the get asks for a range) got with
+            * ranged gets, of parts of this size. Content is still encrypted and decrypted in order, with the same cipher as a
+            * single request, so the objects are indistinguishable from single request ones; only the transfers run in parallel.
+            * The size is rounded up to a multiple of the 16 byte cipher block. S3 requires parts of at least 5MB. 0, the default,
+            * transfers every object in a single request.
+            */
+            inline void SetPartSize(size_t partSize)
+            {
+                m_partSize = partSize;
+            }
+
+            /**
+            * Gets the maximum number of parts in flight at a time for one object.
+            */
+            inline size_t GetMaxConcurrentParts() const
+            {
+                return m_maxConcurrentParts;
+            }
+
+            /**
+            * Sets the maximum number of parts in flight at a time for one object, and so buffered in memory. Defaults to 4.
+            * The parts run on the executor of the client configuration.
+            */
+            inline void SetMaxConcurrentParts(size_t maxConcurrentParts)
+            {
+                m_maxConcurrentParts = maxConcurrentParts;
+            }
+
+            /**
+            * Gets the size of the buffers content is encrypted and decrypted through.
+            */
+            inline size_t GetBufferSize() const
+            {
+                return m_bufferSize;
+            }
+
+            /**
+            * Sets the size of the buffers content is read, encrypted or decrypted, and written through, per object.
+            * Larger buffers mean fewer and larger calls into the cipher. Defaults to Aws::Utils::Crypto::DEFAULT_BUF_SIZE (16KB).
+            */
+            inline void SetBufferSize(size_t bufferSize)
+            {
+                m_bufferSize = bufferSize;
+            }
+
         private:
             StorageMethod m_storageMethod;
             CryptoMode m_cryptoMode;
+            size_t m_partSize;
+            size_t m_maxConcurrentParts;
+            size_t m_bufferSize;
         };
     }
 }
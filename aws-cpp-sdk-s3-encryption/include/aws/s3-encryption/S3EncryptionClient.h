@@ -18,6 +18,10 @@
 #include <aws/s3/S3Client.h>
 #include <aws/s3-encryption/modules/CryptoModuleFactory.h>
 #include <aws/core/client/AWSError.h>
+#include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <functional>
+#include <future>
 
 namespace Aws
 {
@@ -57,6 +61,18 @@ namespace Aws
         typedef Aws::Utils::Outcome<Aws::S3::Model::PutObjectResult, AWSError<S3EncryptionErrors>> S3EncryptionPutObjectOutcome;
         typedef Aws::Utils::Outcome<Aws::S3::Model::GetObjectResult, AWSError<S3EncryptionErrors>> S3EncryptionGetObjectOutcome;
 
+        struct PendingEncryptedGet;
+
+        typedef std::future<S3EncryptionPutObjectOutcome> S3EncryptionPutObjectOutcomeCallable;
+        typedef std::future<S3EncryptionGetObjectOutcome> S3EncryptionGetObjectOutcomeCallable;
+
+        class S3EncryptionClient;
+
+        typedef std::function<void(const S3EncryptionClient*, const Aws::S3::Model::PutObjectRequest&, const S3EncryptionPutObjectOutcome&,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)> S3EncryptionPutObjectResponseReceivedHandler;
+        typedef std::function<void(const S3EncryptionClient*, const Aws::S3::Model::GetObjectRequest&, const S3EncryptionGetObjectOutcome&,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>&)> S3EncryptionGetObjectResponseReceivedHandler;
+
         class AWS_S3ENCRYPTION_API S3EncryptionClient
         {
         public:
@@ -86,23 +102,82 @@ namespace Aws
 
             /*
             * Function to put an object encrypted to S3.
+            * Bodies larger than the part size of the crypto configuration are put with a multipart upload, with concurrent part uploads.
             */
             S3EncryptionPutObjectOutcome PutObject(const Aws::S3::Model::PutObjectRequest& request) const;
 
             /*
             * Function to get an object decrypted from S3.
+            * Without a range, objects larger than the part size of the crypto configuration are got with concurrent ranged gets.
             */
             S3EncryptionGetObjectOutcome GetObject(const Aws::S3::Model::GetObjectRequest& request) const;
 
+            /*
+            * Queues PutObject on the executor of the client configuration and returns a future for its outcome.
+            * The put runs as a single task that makes its S3 requests one after another, so it never waits on other tasks of the
+            * executor, whatever its size. There is nothing to overlap: the body isn't put before its instruction file is in place.
+            * The parts of a multipart upload are only uploaded concurrently by PutObject.
+            */
+            S3EncryptionPutObjectOutcomeCallable PutObjectCallable(const Aws::S3::Model::PutObjectRequest& request) const;
+
+            /*
+            * Queues PutObject on the executor of the client configuration and calls handler with its outcome.
+            * See PutObjectCallable about the executor.
+            */
+            void PutObjectAsync(const Aws::S3::Model::PutObjectRequest& request, const S3EncryptionPutObjectResponseReceivedHandler& handler,
+                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+            /*
+            * Gets the object as GetObject does and returns a future for its outcome.
+            * The head and, for a client configured for instruction files, the instruction file get are sent together as two tasks
+            * on the executor of the client configuration. Whichever completes last gets and decrypts the body on its own thread,
+            * so no task waits on another; the parts of a large object are only got concurrently by GetObject.
+            */
+            S3EncryptionGetObjectOutcomeCallable GetObjectCallable(const Aws::S3::Model::GetObjectRequest& request) const;
+
+            /*
+            * Gets the object as GetObjectCallable does and calls handler with its outcome.
+            */
+            void GetObjectAsync(const Aws::S3::Model::GetObjectRequest& request, const S3EncryptionGetObjectResponseReceivedHandler& handler,
+                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
             inline bool MultipartUploadSupported() const { return false; }
 
         private:
+            /*
+            * With concurrentRequests, the requests that don't depend on each other are started on the executor and waited for.
+            * Without, they are made in turn on the calling thread, as the async calls need: they already run on the executor, and
+            * waiting on tasks queued behind them could wait forever.
+            */
+            S3EncryptionPutObjectOutcome PutObject(const Aws::S3::Model::PutObjectRequest& request, bool concurrentRequests) const;
+            S3EncryptionGetObjectOutcome GetObject(const Aws::S3::Model::GetObjectRequest& request, bool concurrentRequests) const;
+
+            /*
+            * Gets and decrypts the body of an object once its head and materials are known.
+            */
+            S3EncryptionGetObjectOutcome DecryptObject(const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::HeadObjectResult& headResult,
+                const Aws::Utils::Crypto::ContentCryptoMaterial& contentCryptoMaterial, bool concurrentRequests) const;
+
+            typedef std::function<void(S3EncryptionGetObjectOutcome&&)> GetObjectContinuation;
+
+            /*
+            * The get of GetObjectCallable and GetObjectAsync: starts the head and the instruction file get as tasks of the executor,
+            * the last one to complete calls ContinueGetObject and hands its outcome to continuation.
+            */
+            void StartGetObject(const Aws::S3::Model::GetObjectRequest& request, const GetObjectContinuation& continuation) const;
+            S3EncryptionGetObjectOutcome ContinueGetObject(const Aws::S3::Model::GetObjectRequest& request, PendingEncryptedGet& pending) const;
+
             /*
             * Function to get the instruction file object of a encrypted object from S3. This instruction file object will be used to assist decryption.
+            * If startedGet is valid, it's the get of the instruction file already started and its outcome is used.
             */
-            Aws::S3::Model::GetObjectOutcome GetInstructionFileObject(const Aws::S3::Model::GetObjectRequest& originalGetRequest) const;
+            Aws::S3::Model::GetObjectOutcome GetInstructionFileObject(const Aws::S3::Model::GetObjectRequest& originalGetRequest,
+                Aws::S3::Model::GetObjectOutcomeCallable& startedGet) const;
+
+            static Aws::S3::Model::GetObjectRequest BuildInstructionFileRequest(const Aws::S3::Model::GetObjectRequest& originalGetRequest);
 
             Aws::UniquePtr<S3Client> m_s3Client;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
             Aws::S3Encryption::Modules::CryptoModuleFactory m_cryptoModuleFactory;
             std::shared_ptr<Aws::Utils::Crypto::EncryptionMaterials> m_encryptionMaterials;
             const Aws::S3Encryption::CryptoConfiguration m_cryptoConfig;
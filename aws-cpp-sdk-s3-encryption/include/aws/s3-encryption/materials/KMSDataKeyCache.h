@@ -0,0 +1,103 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#pragma once
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/s3-encryption/s3Encryption_EXPORTS.h>
+
+#include <chrono>
+#include <mutex>
+
+namespace Aws
+{
+    namespace S3Encryption
+    {
+        namespace Materials
+        {
+            /*
+            * Cache of content encryption keys for KMSEncryptionMaterials, to save the KMS round trip on every put and get.
+            *
+            * On encryption, a key generated and wrapped by KMS is reused for up to maxObjectsPerKey objects with the same
+            * encryption context (each object still gets its own IV). On decryption, the plaintext of a wrapped key is cached,
+            * keyed by the wrapped key and its encryption context.
+            * Entries expire maxAge after KMS returned them; at most maxEntries keys of each kind are kept, evicting the oldest.
+            *
+            * Caching is off unless a cache is set on the materials. A cache is thread safe and can be shared by several materials.
+            */
+            class AWS_S3ENCRYPTION_API KMSDataKeyCache
+            {
+            public:
+                KMSDataKeyCache(std::chrono::milliseconds maxAge = std::chrono::minutes(5), size_t maxObjectsPerKey = 1000, size_t maxEntries = 100);
+
+                /*
+                * Looks up a key to encrypt a new object with under encryptionContext. On a hit, counts one more use of the key
+                * and fills in the plaintext and the KMS encrypted key.
+                */
+                bool GetEncryptionKey(const Aws::String& encryptionContext, Aws::Utils::CryptoBuffer& contentEncryptionKey,
+                    Aws::Utils::CryptoBuffer& encryptedContentEncryptionKey);
+
+                /*
+                * Adds a key KMS has just encrypted under encryptionContext, counting the object it was generated for.
+                * The key can then be used for decryption too.
+                */
+                void PutEncryptionKey(const Aws::String& encryptionContext, const Aws::Utils::CryptoBuffer& contentEncryptionKey,
+                    const Aws::Utils::CryptoBuffer& encryptedContentEncryptionKey);
+
+                /*
+                * Looks up the plaintext of encryptedContentEncryptionKey, encrypted under encryptionContext.
+                */
+                bool GetDecryptedKey(const Aws::String& encryptionContext, const Aws::Utils::CryptoBuffer& encryptedContentEncryptionKey,
+                    Aws::Utils::CryptoBuffer& contentEncryptionKey);
+
+                /*
+                * Adds the plaintext KMS has returned for encryptedContentEncryptionKey.
+                */
+                void PutDecryptedKey(const Aws::String& encryptionContext, const Aws::Utils::CryptoBuffer& encryptedContentEncryptionKey,
+                    const Aws::Utils::CryptoBuffer& contentEncryptionKey);
+
+                /*
+                * Drops all cached keys.
+                */
+                void Clear();
+
+                inline std::chrono::milliseconds GetMaxAge() const { return m_maxAge; }
+                inline size_t GetMaxObjectsPerKey() const { return m_maxObjectsPerKey; }
+                inline size_t GetMaxEntries() const { return m_maxEntries; }
+
+            private:
+                struct CachedKey
+                {
+                    Aws::Utils::CryptoBuffer contentEncryptionKey;
+                    Aws::Utils::CryptoBuffer encryptedContentEncryptionKey;
+                    std::chrono::steady_clock::time_point expiresAt;
+                    size_t uses;
+                };
+
+                typedef Aws::Map<Aws::String, CachedKey> CachedKeys;
+
+                void Insert(CachedKeys& keys, const Aws::String& cacheKey, CachedKey&& cachedKey);
+
+                std::chrono::milliseconds m_maxAge;
+                size_t m_maxObjectsPerKey;
+                size_t m_maxEntries;
+
+                std::mutex m_cacheLock;
+                CachedKeys m_encryptionKeys;
+                CachedKeys m_decryptedKeys;
+            };
+        }//namespace Materials
+    }//namespace S3Encryption
+}//namespace Aws
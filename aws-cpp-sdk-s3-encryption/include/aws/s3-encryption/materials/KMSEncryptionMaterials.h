@@ -18,6 +18,7 @@
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/kms/KMSClient.h>
 #include <aws/s3-encryption/s3Encryption_EXPORTS.h>
+#include <aws/s3-encryption/materials/KMSDataKeyCache.h>
 
 using namespace Aws::Utils::Crypto;
 
@@ -36,6 +37,8 @@ namespace Aws
             * master key ID to encrypt/decrypt keys. It also allows the user to pass in their
             * own KMS Client, or a Client Configuration where it will create a KMS Client
             * with that configuration.
+            * With a data key cache set, keys are reused and decrypted keys remembered within the limits of the cache,
+            * instead of calling KMS for every object.
             */
             class AWS_S3ENCRYPTION_API KMSEncryptionMaterials : public Aws::Utils::Crypto::EncryptionMaterials
             {
@@ -67,9 +70,18 @@ namespace Aws
                 */
                 CryptoOutcome DecryptCEK(Aws::Utils::Crypto::ContentCryptoMaterial& contentCryptoMaterial) override;
 
+                /*
+                * Sets the cache of content encryption keys to use, nullptr (the default) to call KMS for every object.
+                * When a cached key is used, EncryptCEK replaces the content encryption key of the content crypto material.
+                */
+                inline void SetDataKeyCache(const std::shared_ptr<KMSDataKeyCache>& dataKeyCache) { m_dataKeyCache = dataKeyCache; }
+
+                inline const std::shared_ptr<KMSDataKeyCache>& GetDataKeyCache() const { return m_dataKeyCache; }
+
             private:
                 Aws::String m_customerMasterKeyID;
                 std::shared_ptr<Aws::KMS::KMSClient> m_kmsClient;
+                std::shared_ptr<KMSDataKeyCache> m_dataKeyCache;
             };
         }//namespace Materials
     }//namespace S3Encryption
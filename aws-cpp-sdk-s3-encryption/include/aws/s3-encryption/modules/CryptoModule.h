@@ -59,6 +59,22 @@ namespace Aws
                 S3EncryptionGetObjectOutcome GetObjectSecurely(const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::HeadObjectResult& headObjectResult,
                     const Aws::Utils::Crypto::ContentCryptoMaterial& contentCryptoMaterial, const GetObjectFunction& getObjectFunction);
 
+                /*
+                * Function to put an encrypted object to S3 with a multipart upload of parts of the configured part size.
+                * The instruction file, if any, is put first. The body is encrypted in order, and with concurrentParts the parts are
+                * uploaded concurrently on the executor of the S3 client, otherwise one after another on the calling thread.
+                */
+                S3EncryptionPutObjectOutcome PutObjectSecurelyInParts(const Aws::S3::Model::PutObjectRequest& request, const Aws::S3::S3Client& s3Client,
+                    bool concurrentParts = true);
+
+                /*
+                * Function to get a whole encrypted object from S3 with ranged gets of the configured part size, concurrent on the executor
+                * of the S3 client with concurrentParts, otherwise one after another on the calling thread.
+                * The parts are decrypted in order, so authenticated encryption still verifies the tag of the whole object.
+                */
+                S3EncryptionGetObjectOutcome GetObjectSecurelyInParts(const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::HeadObjectResult& headObjectResult,
+                    const Aws::Utils::Crypto::ContentCryptoMaterial& contentCryptoMaterial, const Aws::S3::S3Client& s3Client, bool concurrentParts = true);
+
                 /*
                 * Function to parse range of a get object request and return a pair containing the lower and upper bounds.
                 */
@@ -269,6 +285,16 @@ namespace Aws
                  */
                 Aws::Utils::CryptoBuffer EncryptBuffer(const Aws::Utils::CryptoBuffer& unEncryptedData) override;
 
+                /**
+                 * Calls straight through to internal cipher.
+                 */
+                bool EncryptInto(const unsigned char* data, size_t length, Aws::Utils::CryptoBuffer& output, size_t outputOffset, size_t& outputLength) override;
+
+                /**
+                 * Same as the internal cipher.
+                 */
+                bool SupportsInPlace() const override;
+
                 /**
                  * Finalize Encryption, returns whatever is left in the cipher, computes the tag, and appends the tag to the output.
                  *  Calls FinalizeEncryption on the underlying cipher first.
@@ -13,29 +13,35 @@
 * permissions and limitations under the License.
 */
 #include <aws/s3-encryption/CryptoConfiguration.h>
+#include <aws/core/utils/crypto/CryptoBuf.h>
 
 namespace Aws
 {
     namespace S3Encryption
     {
+        static const size_t DEFAULT_MAX_CONCURRENT_PARTS = 4;
 
         CryptoConfiguration::CryptoConfiguration() :
-            m_storageMethod(StorageMethod::METADATA), m_cryptoMode(CryptoMode::AUTHENTICATED_ENCRYPTION)
+            m_storageMethod(StorageMethod::METADATA), m_cryptoMode(CryptoMode::AUTHENTICATED_ENCRYPTION), m_partSize(0), m_maxConcurrentParts(DEFAULT_MAX_CONCURRENT_PARTS),
+            m_bufferSize(Aws::Utils::Crypto::DEFAULT_BUF_SIZE)
         {
         }
 
         CryptoConfiguration::CryptoConfiguration(StorageMethod storageMethod) :
-            m_storageMethod(storageMethod), m_cryptoMode(CryptoMode::AUTHENTICATED_ENCRYPTION)
+            m_storageMethod(storageMethod), m_cryptoMode(CryptoMode::AUTHENTICATED_ENCRYPTION), m_partSize(0), m_maxConcurrentParts(DEFAULT_MAX_CONCURRENT_PARTS),
+            m_bufferSize(Aws::Utils::Crypto::DEFAULT_BUF_SIZE)
         {
         }
 
         CryptoConfiguration::CryptoConfiguration(CryptoMode cryptoMode) :
-            m_storageMethod(StorageMethod::METADATA), m_cryptoMode(cryptoMode)
+            m_storageMethod(StorageMethod::METADATA), m_cryptoMode(cryptoMode), m_partSize(0), m_maxConcurrentParts(DEFAULT_MAX_CONCURRENT_PARTS),
+            m_bufferSize(Aws::Utils::Crypto::DEFAULT_BUF_SIZE)
         {
         }
 
         CryptoConfiguration::CryptoConfiguration(StorageMethod storageMode, CryptoMode cryptoMode) :
-            m_storageMethod(storageMode), m_cryptoMode(cryptoMode)
+            m_storageMethod(storageMode), m_cryptoMode(cryptoMode), m_partSize(0), m_maxConcurrentParts(DEFAULT_MAX_CONCURRENT_PARTS),
+            m_bufferSize(Aws::Utils::Crypto::DEFAULT_BUF_SIZE)
         {
         }
 
@@ -18,6 +18,8 @@
 #include <aws/core/utils/memory/stl/AWSAllocator.h>
 #include <aws/core/utils/logging/LogMacros.h>
 
+#include <mutex>
+
 using namespace Aws::Utils::Crypto;
 namespace Aws
 {
@@ -27,56 +29,139 @@ namespace Aws
         using namespace Aws::S3;
         using namespace Aws::S3::Model;
 
+        /*
+        * What the requests started together by StartGetObject found, each filled in by its own task.
+        */
+        struct PendingEncryptedGet
+        {
+            PendingEncryptedGet() : requestsInFlight(0), instructionFileGot(false), instructionFileSucceeded(false) {}
+
+            std::mutex lock;
+            size_t requestsInFlight;
+            HeadObjectOutcome headOutcome;
+            bool instructionFileGot;
+            bool instructionFileSucceeded;
+            AWSError<S3Errors> instructionFileError;
+            ContentCryptoMaterial instructionFileMaterial;
+        };
+
+        static HeadObjectRequest BuildHeadRequest(const GetObjectRequest& getRequest)
+        {
+            HeadObjectRequest headRequest;
+            headRequest.WithBucket(getRequest.GetBucket());
+            headRequest.WithKey(getRequest.GetKey());
+            return headRequest;
+        }
+
+        static AWSError<S3EncryptionErrors> BuildHeadError(const AWSError<S3Errors>& error)
+        {
+            AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Head Request not successful: "
+                << error.GetExceptionName() << " : "
+                << error.GetMessage());
+            return BuildS3EncryptionError(error);
+        }
+
+        static bool HasMaterialsInMetadata(const HeadObjectResult& headResult)
+        {
+            const auto& headMetadata = headResult.GetMetadata();
+            return headMetadata.find(CONTENT_KEY_HEADER) != headMetadata.end() && headMetadata.find(IV_HEADER) != headMetadata.end();
+        }
+
+        // the materials are read where the outcome is got, its body can only be read through a non const result
+        static void ReadInstructionFile(GetObjectOutcome& instructionOutcome, PendingEncryptedGet& pending)
+        {
+            pending.instructionFileGot = true;
+            if (!instructionOutcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Instruction file get operation not successful: "
+                    << instructionOutcome.GetError().GetExceptionName() << " : "
+                    << instructionOutcome.GetError().GetMessage());
+                pending.instructionFileError = instructionOutcome.GetError();
+                return;
+            }
+            Handlers::InstructionFileHandler handler;
+            pending.instructionFileMaterial = handler.ReadContentCryptoMaterial(instructionOutcome.GetResult());
+            pending.instructionFileSucceeded = true;
+        }
+
         S3EncryptionClient::S3EncryptionClient(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const Aws::S3Encryption::CryptoConfiguration& cryptoConfig,
             const Client::ClientConfiguration& clientConfiguration) :
-            m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
+            m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, clientConfiguration)), m_executor(clientConfiguration.executor), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
         {
         }
 
         S3EncryptionClient::S3EncryptionClient(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const Aws::S3Encryption::CryptoConfiguration& cryptoConfig,
             const Auth::AWSCredentials& credentials, const Client::ClientConfiguration& clientConfiguration) :
-            m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, credentials, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
+            m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, credentials, clientConfiguration)), m_executor(clientConfiguration.executor), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
         {
         }
 
         S3EncryptionClient::S3EncryptionClient(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials,
             const Aws::S3Encryption::CryptoConfiguration& cryptoConfig, const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider, const Client::ClientConfiguration& clientConfiguration) :
-            m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, credentialsProvider, clientConfiguration)), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
+            m_s3Client(Aws::MakeUnique<S3Client>(ALLOCATION_TAG, credentialsProvider, clientConfiguration)), m_executor(clientConfiguration.executor), m_cryptoModuleFactory(), m_encryptionMaterials(encryptionMaterials), m_cryptoConfig(cryptoConfig)
         {
         }
 
         S3EncryptionPutObjectOutcome S3EncryptionClient::PutObject(const Aws::S3::Model::PutObjectRequest& request) const
+        {
+            return PutObject(request, true);
+        }
+
+        S3EncryptionPutObjectOutcome S3EncryptionClient::PutObject(const Aws::S3::Model::PutObjectRequest& request, bool concurrentRequests) const
         {
             auto module = m_cryptoModuleFactory.FetchCryptoModule(m_encryptionMaterials, m_cryptoConfig);
+            if (m_cryptoConfig.GetPartSize() > 0 && request.GetBody())
+            {
+                request.GetBody()->seekg(0, std::ios_base::end);
+                auto bodyLength = static_cast<uint64_t>(request.GetBody()->tellg());
+                request.GetBody()->seekg(0, std::ios_base::beg);
+                if (bodyLength > m_cryptoConfig.GetPartSize())
+                {
+                    return module->PutObjectSecurelyInParts(request, *m_s3Client, concurrentRequests);
+                }
+            }
             auto putObjectFunction = [this](const Aws::S3::Model::PutObjectRequest& putRequest) { return m_s3Client->PutObject(putRequest); };
             return module->PutObjectSecurely(request, putObjectFunction);
         }
 
         S3EncryptionGetObjectOutcome S3EncryptionClient::GetObject(const Aws::S3::Model::GetObjectRequest & request) const
         {
-            Aws::S3::Model::HeadObjectRequest headRequest;
-            headRequest.WithBucket(request.GetBucket());
-            headRequest.WithKey(request.GetKey());
-            Aws::S3::Model::HeadObjectOutcome headOutcome = m_s3Client->HeadObject(headRequest);
-            if (!headOutcome.IsSuccess())
+            return GetObject(request, true);
+        }
+
+        S3EncryptionGetObjectOutcome S3EncryptionClient::GetObject(const Aws::S3::Model::GetObjectRequest & request, bool concurrentRequests) const
+        {
+            GetObjectOutcomeCallable instructionFileOutcome;
+            if (concurrentRequests && m_cryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE)
             {
-                AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Head Request not successful: "
-                    << headOutcome.GetError().GetExceptionName() << " : "
-                    << headOutcome.GetError().GetMessage());
-                return S3EncryptionGetObjectOutcome(BuildS3EncryptionError(headOutcome.GetError()));
+                // objects put with this configuration keep their materials in an instruction file, so it's got while the object is headed
+                instructionFileOutcome = m_s3Client->GetObjectCallable(BuildInstructionFileRequest(request));
             }
 
-            auto headMetadata = headOutcome.GetResult().GetMetadata();
-            auto metadataEnd = headMetadata.end();
-            CryptoConfiguration decryptionCryptoConfig;
-            headMetadata.find(CONTENT_KEY_HEADER) != metadataEnd && headMetadata.find(IV_HEADER) != metadataEnd
-                ? decryptionCryptoConfig.SetStorageMethod(StorageMethod::METADATA)
-                : decryptionCryptoConfig.SetStorageMethod(StorageMethod::INSTRUCTION_FILE);
+            Aws::S3::Model::HeadObjectOutcome headOutcome = m_s3Client->HeadObject(BuildHeadRequest(request));
+            if (!headOutcome.IsSuccess())
+            {
+                if (instructionFileOutcome.valid())
+                {
+                    instructionFileOutcome.wait();
+                }
+                return S3EncryptionGetObjectOutcome(BuildHeadError(headOutcome.GetError()));
+            }
 
             ContentCryptoMaterial contentCryptoMaterial;
-            if (decryptionCryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE)
+            if (HasMaterialsInMetadata(headOutcome.GetResult()))
+            {
+                if (instructionFileOutcome.valid())
+                {
+                    // the object turned out to have its materials in its metadata
+                    instructionFileOutcome.wait();
+                }
+                Handlers::MetadataHandler handler;
+                contentCryptoMaterial = handler.ReadContentCryptoMaterial(headOutcome.GetResult());
+            }
+            else
             {
-                GetObjectOutcome instructionOutcome = GetInstructionFileObject(request);
+                GetObjectOutcome instructionOutcome = GetInstructionFileObject(request, instructionFileOutcome);
                 if (!instructionOutcome.IsSuccess())
                 {
                     return S3EncryptionGetObjectOutcome(BuildS3EncryptionError(instructionOutcome.GetError()));
@@ -84,11 +169,20 @@ namespace Aws
                 Handlers::InstructionFileHandler handler;
                 contentCryptoMaterial = handler.ReadContentCryptoMaterial(instructionOutcome.GetResult());
             }
-            else
-            {
-                Handlers::MetadataHandler handler;
-                contentCryptoMaterial = handler.ReadContentCryptoMaterial(headOutcome.GetResult());
-            }
+
+            return DecryptObject(request, headOutcome.GetResult(), contentCryptoMaterial, concurrentRequests);
+        }
+
+        S3EncryptionGetObjectOutcome S3EncryptionClient::DecryptObject(const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::HeadObjectResult& headResult,
+            const ContentCryptoMaterial& contentCryptoMaterial, bool concurrentRequests) const
+        {
+            CryptoConfiguration decryptionCryptoConfig;
+            decryptionCryptoConfig.SetPartSize(m_cryptoConfig.GetPartSize());
+            decryptionCryptoConfig.SetMaxConcurrentParts(m_cryptoConfig.GetMaxConcurrentParts());
+            decryptionCryptoConfig.SetBufferSize(m_cryptoConfig.GetBufferSize());
+            HasMaterialsInMetadata(headResult)
+                ? decryptionCryptoConfig.SetStorageMethod(StorageMethod::METADATA)
+                : decryptionCryptoConfig.SetStorageMethod(StorageMethod::INSTRUCTION_FILE);
 
             if (contentCryptoMaterial.GetContentCryptoScheme() == ContentCryptoScheme::CBC)
             {
@@ -106,16 +200,118 @@ namespace Aws
             }
 
             auto module = m_cryptoModuleFactory.FetchCryptoModule(m_encryptionMaterials, decryptionCryptoConfig);
+            if (decryptionCryptoConfig.GetPartSize() > 0 && request.GetRange().empty() &&
+                static_cast<uint64_t>(headResult.GetContentLength()) > decryptionCryptoConfig.GetPartSize())
+            {
+                return module->GetObjectSecurelyInParts(request, headResult, contentCryptoMaterial, *m_s3Client, concurrentRequests);
+            }
             auto getObjectFunction = [this](const Aws::S3::Model::GetObjectRequest& getRequest) { return m_s3Client->GetObject(getRequest); };
-            return module->GetObjectSecurely(request, headOutcome.GetResult(), contentCryptoMaterial, getObjectFunction);
+            return module->GetObjectSecurely(request, headResult, contentCryptoMaterial, getObjectFunction);
         }
 
-        Aws::S3::Model::GetObjectOutcome S3EncryptionClient::GetInstructionFileObject(const Aws::S3::Model::GetObjectRequest & originalGetRequest) const
+        S3EncryptionPutObjectOutcomeCallable S3EncryptionClient::PutObjectCallable(const Aws::S3::Model::PutObjectRequest& request) const
         {
-            GetObjectRequest instructionFileRequest;
-            instructionFileRequest.SetKey(originalGetRequest.GetKey() + Handlers::DEFAULT_INSTRUCTION_FILE_SUFFIX);
-            instructionFileRequest.SetBucket(originalGetRequest.GetBucket());
-            GetObjectOutcome instructionOutcome = m_s3Client->GetObject(instructionFileRequest);
+            std::packaged_task< S3EncryptionPutObjectOutcome() > task([this, request](){ return this->PutObject(request, false); });
+            auto future = task.get_future();
+            m_executor->Submit(std::move(task));
+            return future;
+        }
+
+        void S3EncryptionClient::PutObjectAsync(const Aws::S3::Model::PutObjectRequest& request, const S3EncryptionPutObjectResponseReceivedHandler& handler,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+        {
+            m_executor->Submit([this, request, handler, context](){ handler(this, request, this->PutObject(request, false), context); });
+        }
+
+        S3EncryptionGetObjectOutcomeCallable S3EncryptionClient::GetObjectCallable(const Aws::S3::Model::GetObjectRequest& request) const
+        {
+            auto promise = Aws::MakeShared<std::promise<S3EncryptionGetObjectOutcome>>(ALLOCATION_TAG);
+            StartGetObject(request, [promise](S3EncryptionGetObjectOutcome&& outcome) { promise->set_value(std::move(outcome)); });
+            return promise->get_future();
+        }
+
+        void S3EncryptionClient::GetObjectAsync(const Aws::S3::Model::GetObjectRequest& request, const S3EncryptionGetObjectResponseReceivedHandler& handler,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+        {
+            StartGetObject(request, [this, request, handler, context](S3EncryptionGetObjectOutcome&& outcome) { handler(this, request, outcome, context); });
+        }
+
+        void S3EncryptionClient::StartGetObject(const Aws::S3::Model::GetObjectRequest& request, const GetObjectContinuation& continuation) const
+        {
+            auto pending = Aws::MakeShared<PendingEncryptedGet>(ALLOCATION_TAG);
+            const bool getInstructionFile = m_cryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE;
+            pending->requestsInFlight = getInstructionFile ? 2 : 1;
+
+            // the last of the requests to complete carries on with the get, on its own thread, so nothing waits for the other
+            auto completeRequest = [this, request, continuation, pending]()
+            {
+                {
+                    std::lock_guard<std::mutex> locker(pending->lock);
+                    if (--pending->requestsInFlight > 0)
+                    {
+                        return;
+                    }
+                }
+                continuation(ContinueGetObject(request, *pending));
+            };
+
+            m_executor->Submit([this, request, pending, completeRequest]()
+            {
+                auto headOutcome = m_s3Client->HeadObject(BuildHeadRequest(request));
+                {
+                    std::lock_guard<std::mutex> locker(pending->lock);
+                    pending->headOutcome = std::move(headOutcome);
+                }
+                completeRequest();
+            });
+
+            if (getInstructionFile)
+            {
+                // objects put with this configuration keep their materials in an instruction file, so it's got while the object is headed
+                m_executor->Submit([this, request, pending, completeRequest]()
+                {
+                    GetObjectOutcome instructionOutcome = m_s3Client->GetObject(BuildInstructionFileRequest(request));
+                    {
+                        std::lock_guard<std::mutex> locker(pending->lock);
+                        ReadInstructionFile(instructionOutcome, *pending);
+                    }
+                    completeRequest();
+                });
+            }
+        }
+
+        S3EncryptionGetObjectOutcome S3EncryptionClient::ContinueGetObject(const Aws::S3::Model::GetObjectRequest& request, PendingEncryptedGet& pending) const
+        {
+            if (!pending.headOutcome.IsSuccess())
+            {
+                return S3EncryptionGetObjectOutcome(BuildHeadError(pending.headOutcome.GetError()));
+            }
+
+            const auto& headResult = pending.headOutcome.GetResult();
+            if (HasMaterialsInMetadata(headResult))
+            {
+                // an instruction file got alongside is simply dropped
+                Handlers::MetadataHandler handler;
+                return DecryptObject(request, headResult, handler.ReadContentCryptoMaterial(headResult), false);
+            }
+
+            if (!pending.instructionFileGot)
+            {
+                // this client puts materials in metadata, the object was put by another one; the instruction file is got now, from this thread
+                GetObjectOutcome instructionOutcome = m_s3Client->GetObject(BuildInstructionFileRequest(request));
+                ReadInstructionFile(instructionOutcome, pending);
+            }
+            if (!pending.instructionFileSucceeded)
+            {
+                return S3EncryptionGetObjectOutcome(BuildS3EncryptionError(pending.instructionFileError));
+            }
+            return DecryptObject(request, headResult, pending.instructionFileMaterial, false);
+        }
+
+        Aws::S3::Model::GetObjectOutcome S3EncryptionClient::GetInstructionFileObject(const Aws::S3::Model::GetObjectRequest & originalGetRequest,
+            Aws::S3::Model::GetObjectOutcomeCallable& startedGet) const
+        {
+            GetObjectOutcome instructionOutcome = startedGet.valid() ? startedGet.get() : m_s3Client->GetObject(BuildInstructionFileRequest(originalGetRequest));
             if (!instructionOutcome.IsSuccess())
             {
                 AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Instruction file get operation not successful: "
@@ -125,6 +321,13 @@ namespace Aws
             }
             return instructionOutcome;
         }
-    }
-}
 
+        Aws::S3::Model::GetObjectRequest S3EncryptionClient::BuildInstructionFileRequest(const Aws::S3::Model::GetObjectRequest& originalGetRequest)
+        {
+            GetObjectRequest instructionFileRequest;
+            instructionFileRequest.SetKey(originalGetRequest.GetKey() + Handlers::DEFAULT_INSTRUCTION_FILE_SUFFIX);
+            instructionFileRequest.SetBucket(originalGetRequest.GetBucket());
+            return instructionFileRequest;
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+#include <aws/s3-encryption/materials/KMSDataKeyCache.h>
+
+#include <algorithm>
+
+using namespace Aws::Utils;
+
+namespace Aws
+{
+    namespace S3Encryption
+    {
+        namespace Materials
+        {
+            // the wrapped key is appended to the encryption context, which KMSEncryptionMaterials serializes with length prefixes
+            static Aws::String DecryptedKeyCacheKey(const Aws::String& encryptionContext, const CryptoBuffer& encryptedContentEncryptionKey)
+            {
+                Aws::String cacheKey;
+                cacheKey.reserve(encryptionContext.size() + encryptedContentEncryptionKey.GetLength());
+                cacheKey.append(encryptionContext);
+                cacheKey.append(reinterpret_cast<const char*>(encryptedContentEncryptionKey.GetUnderlyingData()), encryptedContentEncryptionKey.GetLength());
+                return cacheKey;
+            }
+
+            KMSDataKeyCache::KMSDataKeyCache(std::chrono::milliseconds maxAge, size_t maxObjectsPerKey, size_t maxEntries) :
+                m_maxAge(maxAge), m_maxObjectsPerKey((std::max)(maxObjectsPerKey, static_cast<size_t>(1))), m_maxEntries((std::max)(maxEntries, static_cast<size_t>(1)))
+            {
+            }
+
+            bool KMSDataKeyCache::GetEncryptionKey(const Aws::String& encryptionContext, CryptoBuffer& contentEncryptionKey,
+                CryptoBuffer& encryptedContentEncryptionKey)
+            {
+                std::lock_guard<std::mutex> locker(m_cacheLock);
+                auto iter = m_encryptionKeys.find(encryptionContext);
+                if (iter == m_encryptionKeys.end())
+                {
+                    return false;
+                }
+
+                CachedKey& cachedKey = iter->second;
+                if (std::chrono::steady_clock::now() >= cachedKey.expiresAt || cachedKey.uses >= m_maxObjectsPerKey)
+                {
+                    m_encryptionKeys.erase(iter);
+                    return false;
+                }
+
+                ++cachedKey.uses;
+                contentEncryptionKey = cachedKey.contentEncryptionKey;
+                encryptedContentEncryptionKey = cachedKey.encryptedContentEncryptionKey;
+                return true;
+            }
+
+            void KMSDataKeyCache::PutEncryptionKey(const Aws::String& encryptionContext, const CryptoBuffer& contentEncryptionKey,
+                const CryptoBuffer& encryptedContentEncryptionKey)
+            {
+                auto expiresAt = std::chrono::steady_clock::now() + m_maxAge;
+                std::lock_guard<std::mutex> locker(m_cacheLock);
+                Insert(m_encryptionKeys, encryptionContext, CachedKey{ contentEncryptionKey, encryptedContentEncryptionKey, expiresAt, 1 });
+                Insert(m_decryptedKeys, DecryptedKeyCacheKey(encryptionContext, encryptedContentEncryptionKey),
+                    CachedKey{ contentEncryptionKey, CryptoBuffer(), expiresAt, 0 });
+            }
+
+            bool KMSDataKeyCache::GetDecryptedKey(const Aws::String& encryptionContext, const CryptoBuffer& encryptedContentEncryptionKey,
+                CryptoBuffer& contentEncryptionKey)
+            {
+                Aws::String cacheKey = DecryptedKeyCacheKey(encryptionContext, encryptedContentEncryptionKey);
+                std::lock_guard<std::mutex> locker(m_cacheLock);
+                auto iter = m_decryptedKeys.find(cacheKey);
+                if (iter == m_decryptedKeys.end())
+                {
+                    return false;
+                }
+
+                if (std::chrono::steady_clock::now() >= iter->second.expiresAt)
+                {
+                    m_decryptedKeys.erase(iter);
+                    return false;
+                }
+
+                contentEncryptionKey = iter->second.contentEncryptionKey;
+                return true;
+            }
+
+            void KMSDataKeyCache::PutDecryptedKey(const Aws::String& encryptionContext, const CryptoBuffer& encryptedContentEncryptionKey,
+                const CryptoBuffer& contentEncryptionKey)
+            {
+                Aws::String cacheKey = DecryptedKeyCacheKey(encryptionContext, encryptedContentEncryptionKey);
+                auto expiresAt = std::chrono::steady_clock::now() + m_maxAge;
+                std::lock_guard<std::mutex> locker(m_cacheLock);
+                Insert(m_decryptedKeys, cacheKey, CachedKey{ contentEncryptionKey, CryptoBuffer(), expiresAt, 0 });
+            }
+
+            void KMSDataKeyCache::Clear()
+            {
+                std::lock_guard<std::mutex> locker(m_cacheLock);
+                m_encryptionKeys.clear();
+                m_decryptedKeys.clear();
+            }
+
+            void KMSDataKeyCache::Insert(CachedKeys& keys, const Aws::String& cacheKey, CachedKey&& cachedKey)
+            {
+                auto iter = keys.find(cacheKey);
+                if (iter != keys.end())
+                {
+                    iter->second = std::move(cachedKey);
+                    return;
+                }
+
+                if (keys.size() >= m_maxEntries)
+                {
+                    // all entries have the same max age, so the one expiring first is the oldest
+                    auto oldest = std::min_element(keys.begin(), keys.end(),
+                        [](const CachedKeys::value_type& left, const CachedKeys::value_type& right) { return left.second.expiresAt < right.second.expiresAt; });
+                    keys.erase(oldest);
+                }
+                keys.emplace(cacheKey, std::move(cachedKey));
+            }
+        }//namespace Materials
+    }//namespace S3Encryption
+}//namespace Aws
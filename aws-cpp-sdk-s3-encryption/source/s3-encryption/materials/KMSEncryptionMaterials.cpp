@@ -7,6 +7,7 @@
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
 
 using namespace Aws;
 using namespace Aws::Utils;
@@ -24,6 +25,17 @@ namespace Aws
             static const char* const ALLOCATION_TAG = "KMSEncryptionMaterials";
             const char* cmkID_Identifier = "kms_cmk_id";
 
+            // entries are length prefixed, so different contexts never serialize to the same string
+            static Aws::String SerializeEncryptionContext(const Aws::Map<Aws::String, Aws::String>& encryptionContext)
+            {
+                Aws::StringStream ss;
+                for (const auto& entry : encryptionContext)
+                {
+                    ss << entry.first.size() << ':' << entry.first << entry.second.size() << ':' << entry.second;
+                }
+                return ss.str();
+            }
+
             KMSEncryptionMaterials::KMSEncryptionMaterials(const String& customerMasterKeyID, const ClientConfiguration& clientConfig) :
                 m_customerMasterKeyID(customerMasterKeyID), m_kmsClient(Aws::MakeShared<KMSClient>(ALLOCATION_TAG, clientConfig))
             {
@@ -42,6 +54,21 @@ namespace Aws
                 contentCryptoMaterial.AddMaterialsDescription(cmkID_Identifier, m_customerMasterKeyID);
                 request.SetEncryptionContext(contentCryptoMaterial.GetMaterialsDescription());
 
+                Aws::String encryptionContext;
+                if (m_dataKeyCache)
+                {
+                    encryptionContext = SerializeEncryptionContext(contentCryptoMaterial.GetMaterialsDescription());
+                    CryptoBuffer contentEncryptionKey;
+                    CryptoBuffer encryptedContentEncryptionKey;
+                    if (m_dataKeyCache->GetEncryptionKey(encryptionContext, contentEncryptionKey, encryptedContentEncryptionKey))
+                    {
+                        contentCryptoMaterial.SetContentEncryptionKey(contentEncryptionKey);
+                        contentCryptoMaterial.SetKeyWrapAlgorithm(KeyWrapAlgorithm::KMS);
+                        contentCryptoMaterial.SetEncryptedContentEncryptionKey(encryptedContentEncryptionKey);
+                        return CryptoOutcome(Aws::NoResult());
+                    }
+                }
+
                 request.SetPlaintext(contentCryptoMaterial.GetContentEncryptionKey());
 
                 EncryptOutcome outcome = m_kmsClient->Encrypt(request);
@@ -57,6 +84,10 @@ namespace Aws
                 contentCryptoMaterial.SetKeyWrapAlgorithm(KeyWrapAlgorithm::KMS);
                 contentCryptoMaterial.AddMaterialsDescription(cmkID_Identifier, m_customerMasterKeyID);
                 contentCryptoMaterial.SetEncryptedContentEncryptionKey(result.GetCiphertextBlob());
+                if (m_dataKeyCache)
+                {
+                    m_dataKeyCache->PutEncryptionKey(encryptionContext, contentCryptoMaterial.GetContentEncryptionKey(), result.GetCiphertextBlob());
+                }
                 return CryptoOutcome(Aws::NoResult());
             }
 
@@ -85,6 +116,18 @@ namespace Aws
                     return errorOutcome;
                 }
 
+                Aws::String encryptionContext;
+                if (m_dataKeyCache)
+                {
+                    encryptionContext = SerializeEncryptionContext(contentCryptoMaterial.GetMaterialsDescription());
+                    CryptoBuffer contentEncryptionKey;
+                    if (m_dataKeyCache->GetDecryptedKey(encryptionContext, encryptedContentEncryptionKey, contentEncryptionKey))
+                    {
+                        contentCryptoMaterial.SetContentEncryptionKey(contentEncryptionKey);
+                        return CryptoOutcome(Aws::NoResult());
+                    }
+                }
+
                 DecryptRequest request;
                 request.SetEncryptionContext(contentCryptoMaterial.GetMaterialsDescription());
                 request.SetCiphertextBlob(encryptedContentEncryptionKey);
@@ -104,6 +147,10 @@ namespace Aws
                     AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Content Encryption Key could not be decrypted.");
                     return errorOutcome;
                 }
+                if (m_dataKeyCache)
+                {
+                    m_dataKeyCache->PutDecryptedKey(encryptionContext, encryptedContentEncryptionKey, contentCryptoMaterial.GetContentEncryptionKey());
+                }
                 return CryptoOutcome(Aws::NoResult());
             }
 
@@ -19,6 +19,13 @@
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/client/AWSError.h>
 #include <aws/s3-encryption/S3EncryptionClient.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
 
 using namespace Aws::S3::Model;
 using namespace Aws::Utils;
@@ -32,6 +39,57 @@ namespace Aws
         namespace Modules
         {
             static const char* const ALLOCATION_TAG = "CryptoModule";
+
+            // an encrypted part, kept alive until its upload completes
+            struct UploadPartInFlight
+            {
+                int partNumber;
+                std::shared_ptr<CryptoBuffer> ciphertext;
+                std::shared_ptr<Aws::Utils::Stream::PreallocatedStreamBuf> streamBuf;
+                UploadPartOutcomeCallable outcome;
+            };
+
+            static CreateMultipartUploadRequest BuildCreateMultipartUploadRequest(const PutObjectRequest& request)
+            {
+                CreateMultipartUploadRequest createRequest;
+                createRequest.WithBucket(request.GetBucket()).WithKey(request.GetKey());
+                // only what was set, so that the request doesn't send empty headers
+                if (request.GetACL() != ObjectCannedACL::NOT_SET) createRequest.SetACL(request.GetACL());
+                if (!request.GetCacheControl().empty()) createRequest.SetCacheControl(request.GetCacheControl());
+                if (!request.GetContentDisposition().empty()) createRequest.SetContentDisposition(request.GetContentDisposition());
+                if (!request.GetContentEncoding().empty()) createRequest.SetContentEncoding(request.GetContentEncoding());
+                if (!request.GetContentLanguage().empty()) createRequest.SetContentLanguage(request.GetContentLanguage());
+                if (!request.GetContentType().empty()) createRequest.SetContentType(request.GetContentType());
+                if (!request.GetGrantFullControl().empty()) createRequest.SetGrantFullControl(request.GetGrantFullControl());
+                if (!request.GetGrantRead().empty()) createRequest.SetGrantRead(request.GetGrantRead());
+                if (!request.GetGrantReadACP().empty()) createRequest.SetGrantReadACP(request.GetGrantReadACP());
+                if (!request.GetGrantWriteACP().empty()) createRequest.SetGrantWriteACP(request.GetGrantWriteACP());
+                if (!request.GetMetadata().empty()) createRequest.SetMetadata(request.GetMetadata());
+                if (request.GetServerSideEncryption() != ServerSideEncryption::NOT_SET) createRequest.SetServerSideEncryption(request.GetServerSideEncryption());
+                if (request.GetStorageClass() != StorageClass::NOT_SET) createRequest.SetStorageClass(request.GetStorageClass());
+                if (!request.GetWebsiteRedirectLocation().empty()) createRequest.SetWebsiteRedirectLocation(request.GetWebsiteRedirectLocation());
+                if (!request.GetSSECustomerAlgorithm().empty()) createRequest.SetSSECustomerAlgorithm(request.GetSSECustomerAlgorithm());
+                if (!request.GetSSECustomerKey().empty()) createRequest.SetSSECustomerKey(request.GetSSECustomerKey());
+                if (!request.GetSSECustomerKeyMD5().empty()) createRequest.SetSSECustomerKeyMD5(request.GetSSECustomerKeyMD5());
+                if (!request.GetSSEKMSKeyId().empty()) createRequest.SetSSEKMSKeyId(request.GetSSEKMSKeyId());
+                if (request.GetRequestPayer() != RequestPayer::NOT_SET) createRequest.SetRequestPayer(request.GetRequestPayer());
+                if (!request.GetTagging().empty()) createRequest.SetTagging(request.GetTagging());
+                if (!request.GetCustomizedAccessLogTag().empty()) createRequest.SetCustomizedAccessLogTag(request.GetCustomizedAccessLogTag());
+                return createRequest;
+            }
+
+            static void AbortMultipartUpload(const S3::S3Client& s3Client, const PutObjectRequest& request, const Aws::String& uploadId)
+            {
+                AbortMultipartUploadRequest abortRequest;
+                abortRequest.WithBucket(request.GetBucket()).WithKey(request.GetKey()).WithUploadId(uploadId);
+                if (request.GetRequestPayer() != RequestPayer::NOT_SET) abortRequest.SetRequestPayer(request.GetRequestPayer());
+                auto abortOutcome = s3Client.AbortMultipartUpload(abortRequest);
+                if (!abortOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Failed to abort multipart upload " << uploadId << ": "
+                        << abortOutcome.GetError().GetExceptionName() << " : " << abortOutcome.GetError().GetMessage());
+                }
+            }
             static const char* LAST_BYTES_SPECIFIER = "bytes=-";
             static const char* FIRST_BYTES_SPECIFIER = "bytes=0-";
             static const size_t GCM_IV_SIZE = 12u;
@@ -39,23 +97,43 @@ namespace Aws
             static const size_t AES_BLOCK_SIZE = 16u;
             static const size_t BITS_IN_BYTE = 8u;
 
+            // parts are whole cipher blocks, so that every part's ciphertext is as long as its plaintext even with CBC, which holds back
+            // a partial block. Rounded up, a part size at S3's 5MB minimum stays at or above it.
+            static size_t PartSizeInWholeBlocks(size_t partSize)
+            {
+                return (std::max)((partSize + AES_BLOCK_SIZE - 1) / AES_BLOCK_SIZE * AES_BLOCK_SIZE, AES_BLOCK_SIZE);
+            }
+
             CryptoModule::CryptoModule(const std::shared_ptr<EncryptionMaterials>& encryptionMaterials, const CryptoConfiguration & cryptoConfig) :
                 m_encryptionMaterials(encryptionMaterials), m_contentCryptoMaterial(ContentCryptoMaterial()), m_cryptoConfig(cryptoConfig), m_cipher(nullptr)
             {
             }
 
+            static bool InstructionFilePutSucceeded(const PutObjectOutcome& instructionOutcome)
+            {
+                if (!instructionOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Instruction file put operation not successful: "
+                        << instructionOutcome.GetError().GetExceptionName() << " : "
+                        << instructionOutcome.GetError().GetMessage());
+                    return false;
+                }
+                return true;
+            }
+
             S3EncryptionPutObjectOutcome CryptoModule::PutObjectSecurely(const Aws::S3::Model::PutObjectRequest& request, const PutObjectFunction& putObjectFunction)
             {
                 PutObjectRequest copyRequest(request);
                 PopulateCryptoContentMaterial();
-                InitEncryptionCipher();
-                SetContentLength(copyRequest);
+                // the materials can swap in a cached content encryption key, so the cipher is set up after the key is wrapped
                 auto encryptOutcome = m_encryptionMaterials->EncryptCEK(m_contentCryptoMaterial);
                 if (!encryptOutcome.IsSuccess())
                 {
                     return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(encryptOutcome.GetError()));
                 }
-                
+                InitEncryptionCipher();
+                SetContentLength(copyRequest);
+
                 if (m_cryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE)
                 {
                     Handlers::InstructionFileHandler handler;
@@ -63,12 +141,10 @@ namespace Aws
                     instructionFileRequest.WithBucket(copyRequest.GetBucket());
                     instructionFileRequest.WithKey(copyRequest.GetKey());
                     handler.PopulateRequest(instructionFileRequest, m_contentCryptoMaterial);
+                    // the body can't be decrypted without it, so it isn't uploaded unless the instruction file is in place
                     PutObjectOutcome instructionOutcome = putObjectFunction(instructionFileRequest);
-                    if (!instructionOutcome.IsSuccess())
+                    if (!InstructionFilePutSucceeded(instructionOutcome))
                     {
-                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Instruction file put operation not successful: "
-                            << instructionOutcome.GetError().GetExceptionName() << " : "
-                            << instructionOutcome.GetError().GetMessage());
                         return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(instructionOutcome.GetError()));
                     }
                 }
@@ -77,6 +153,7 @@ namespace Aws
                     Handlers::MetadataHandler handler;
                     handler.PopulateRequest(copyRequest, m_contentCryptoMaterial);
                 }
+
                 return WrapAndMakeRequestWithCipher(copyRequest, putObjectFunction);
             }
 
@@ -117,10 +194,319 @@ namespace Aws
                 return UnwrapAndMakeRequestWithCipher(copyRequest, getObjectFunction, firstBlockAdjustment);
             }
 
+            S3EncryptionPutObjectOutcome CryptoModule::PutObjectSecurelyInParts(const Aws::S3::Model::PutObjectRequest& request, const Aws::S3::S3Client& s3Client,
+                bool concurrentParts)
+            {
+                PopulateCryptoContentMaterial();
+                auto encryptOutcome = m_encryptionMaterials->EncryptCEK(m_contentCryptoMaterial);
+                if (!encryptOutcome.IsSuccess())
+                {
+                    return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(encryptOutcome.GetError()));
+                }
+                InitEncryptionCipher();
+
+                CreateMultipartUploadRequest createRequest = BuildCreateMultipartUploadRequest(request);
+                if (m_cryptoConfig.GetStorageMethod() == StorageMethod::INSTRUCTION_FILE)
+                {
+                    Handlers::InstructionFileHandler handler;
+                    PutObjectRequest instructionFileRequest;
+                    instructionFileRequest.WithBucket(request.GetBucket());
+                    instructionFileRequest.WithKey(request.GetKey());
+                    handler.PopulateRequest(instructionFileRequest, m_contentCryptoMaterial);
+                    // as with a single request, no part is uploaded unless the instruction file is in place
+                    PutObjectOutcome instructionOutcome = s3Client.PutObject(instructionFileRequest);
+                    if (!InstructionFilePutSucceeded(instructionOutcome))
+                    {
+                        return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(instructionOutcome.GetError()));
+                    }
+                }
+                else
+                {
+                    Handlers::MetadataHandler handler;
+                    PutObjectRequest metadataRequest;
+                    handler.PopulateRequest(metadataRequest, m_contentCryptoMaterial);
+                    for (const auto& metadata : metadataRequest.GetMetadata())
+                    {
+                        createRequest.AddMetadata(metadata.first, metadata.second);
+                    }
+                }
+
+                CreateMultipartUploadOutcome createOutcome = s3Client.CreateMultipartUpload(createRequest);
+                if (!createOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 create multipart upload operation not successful: "
+                        << createOutcome.GetError().GetExceptionName() << " : "
+                        << createOutcome.GetError().GetMessage());
+                    return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(createOutcome.GetError()));
+                }
+                const Aws::String& uploadId = createOutcome.GetResult().GetUploadId();
+
+                std::shared_ptr<Aws::IOStream> body = request.GetBody();
+                body->clear();
+                body->seekg(0, std::ios_base::end);
+                uint64_t bytesLeft = static_cast<uint64_t>(body->tellg());
+                body->seekg(0, std::ios_base::beg);
+
+                const size_t partSize = PartSizeInWholeBlocks(m_cryptoConfig.GetPartSize());
+                const size_t maxConcurrentParts = concurrentParts ? (std::max)(m_cryptoConfig.GetMaxConcurrentParts(), static_cast<size_t>(1)) : 1;
+                Aws::Deque<UploadPartInFlight> partsInFlight;
+                CompletedMultipartUpload completedUpload;
+                std::shared_ptr<PutObjectOutcome> failedOutcome;
+
+                // parts have to be waited for even after a failure, they reference the buffers
+                auto completeOldestPart = [&]()
+                {
+                    UploadPartInFlight& part = partsInFlight.front();
+                    UploadPartOutcome outcome = part.outcome.get();
+                    if (outcome.IsSuccess())
+                    {
+                        completedUpload.AddParts(CompletedPart().WithETag(outcome.GetResult().GetETag()).WithPartNumber(part.partNumber));
+                    }
+                    else if (!failedOutcome)
+                    {
+                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 upload part operation not successful for part " << part.partNumber << ": "
+                            << outcome.GetError().GetExceptionName() << " : "
+                            << outcome.GetError().GetMessage());
+                        failedOutcome = Aws::MakeShared<PutObjectOutcome>(ALLOCATION_TAG, outcome.GetError());
+                    }
+                    partsInFlight.pop_front();
+                };
+
+                int partNumber = 0;
+                while (bytesLeft > 0 && !failedOutcome)
+                {
+                    size_t plaintextLength = static_cast<size_t>((std::min)(bytesLeft, static_cast<uint64_t>(partSize)));
+                    CryptoBuffer plaintext(plaintextLength);
+                    body->read(reinterpret_cast<char*>(plaintext.GetUnderlyingData()), plaintextLength);
+                    if (static_cast<size_t>(body->gcount()) != plaintextLength)
+                    {
+                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Read " << body->gcount() << " bytes of part " << partNumber + 1
+                            << " of the body instead of " << plaintextLength << ", the upload is aborted.");
+                        failedOutcome = Aws::MakeShared<PutObjectOutcome>(ALLOCATION_TAG, AWSError<Aws::S3::S3Errors>(Aws::S3::S3Errors::INVALID_PARAMETER_VALUE,
+                            "BodyReadFailed", "The request body ended before the length it reported", false/*not retryable*/));
+                        break;
+                    }
+                    bytesLeft -= plaintextLength;
+
+                    auto ciphertext = Aws::MakeShared<CryptoBuffer>(ALLOCATION_TAG, m_cipher->EncryptBuffer(plaintext));
+                    if (bytesLeft == 0)
+                    {
+                        CryptoBuffer finalBlocks = m_cipher->FinalizeEncryption();
+                        *ciphertext = CryptoBuffer({ ciphertext.get(), &finalBlocks });
+                    }
+
+                    UploadPartInFlight part;
+                    part.partNumber = ++partNumber;
+                    part.ciphertext = ciphertext;
+                    part.streamBuf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf>(ALLOCATION_TAG, ciphertext.get(), ciphertext->GetLength());
+
+                    UploadPartRequest uploadPartRequest;
+                    uploadPartRequest.WithBucket(request.GetBucket())
+                        .WithKey(request.GetKey())
+                        .WithUploadId(uploadId)
+                        .WithPartNumber(part.partNumber)
+                        .WithContentLength(static_cast<long long>(ciphertext->GetLength()));
+                    if (!request.GetSSECustomerAlgorithm().empty()) uploadPartRequest.SetSSECustomerAlgorithm(request.GetSSECustomerAlgorithm());
+                    if (!request.GetSSECustomerKey().empty()) uploadPartRequest.SetSSECustomerKey(request.GetSSECustomerKey());
+                    if (!request.GetSSECustomerKeyMD5().empty()) uploadPartRequest.SetSSECustomerKeyMD5(request.GetSSECustomerKeyMD5());
+                    if (request.GetRequestPayer() != RequestPayer::NOT_SET) uploadPartRequest.SetRequestPayer(request.GetRequestPayer());
+                    uploadPartRequest.SetBody(Aws::MakeShared<Aws::IOStream>(ALLOCATION_TAG, part.streamBuf.get()));
+
+                    if (concurrentParts)
+                    {
+                        part.outcome = s3Client.UploadPartCallable(uploadPartRequest);
+                    }
+                    else
+                    {
+                        std::packaged_task<UploadPartOutcome()> uploadPart([&s3Client, &uploadPartRequest]() { return s3Client.UploadPart(uploadPartRequest); });
+                        part.outcome = uploadPart.get_future();
+                        uploadPart();
+                    }
+                    partsInFlight.push_back(std::move(part));
+                    if (partsInFlight.size() >= maxConcurrentParts)
+                    {
+                        completeOldestPart();
+                    }
+                }
+
+                while (!partsInFlight.empty())
+                {
+                    completeOldestPart();
+                }
+
+                if (failedOutcome)
+                {
+                    AbortMultipartUpload(s3Client, request, uploadId);
+                    return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(failedOutcome->GetError()));
+                }
+
+                CompleteMultipartUploadRequest completeRequest;
+                completeRequest.WithBucket(request.GetBucket())
+                    .WithKey(request.GetKey())
+                    .WithUploadId(uploadId)
+                    .WithMultipartUpload(completedUpload);
+                if (request.GetRequestPayer() != RequestPayer::NOT_SET) completeRequest.SetRequestPayer(request.GetRequestPayer());
+                CompleteMultipartUploadOutcome completeOutcome = s3Client.CompleteMultipartUpload(completeRequest);
+                if (!completeOutcome.IsSuccess())
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 complete multipart upload operation not successful: "
+                        << completeOutcome.GetError().GetExceptionName() << " : "
+                        << completeOutcome.GetError().GetMessage());
+                    AbortMultipartUpload(s3Client, request, uploadId);
+                    return S3EncryptionPutObjectOutcome(BuildS3EncryptionError(completeOutcome.GetError()));
+                }
+
+                const CompleteMultipartUploadResult& completeResult = completeOutcome.GetResult();
+                PutObjectResult result;
+                result.SetETag(completeResult.GetETag());
+                result.SetExpiration(completeResult.GetExpiration());
+                result.SetServerSideEncryption(completeResult.GetServerSideEncryption());
+                result.SetVersionId(completeResult.GetVersionId());
+                result.SetSSEKMSKeyId(completeResult.GetSSEKMSKeyId());
+                result.SetRequestCharged(completeResult.GetRequestCharged());
+                return S3EncryptionPutObjectOutcome(std::move(result));
+            }
+
+            S3EncryptionGetObjectOutcome CryptoModule::GetObjectSecurelyInParts(const Aws::S3::Model::GetObjectRequest& request, const Aws::S3::Model::HeadObjectResult& headObjectResult,
+                const ContentCryptoMaterial& contentCryptoMaterial, const Aws::S3::S3Client& s3Client, bool concurrentParts)
+            {
+                assert(request.GetRange().empty());
+                GetObjectRequest copyRequest(request);
+                m_contentCryptoMaterial = contentCryptoMaterial;
+                DecryptionConditionCheck(copyRequest.GetRange());
+                auto decryptOutcome = m_encryptionMaterials->DecryptCEK(m_contentCryptoMaterial);
+                if (!decryptOutcome.IsSuccess())
+                {
+                    return S3EncryptionGetObjectOutcome(BuildS3EncryptionError(decryptOutcome.GetError()));
+                }
+
+                auto getObjectFunction = [&s3Client](const GetObjectRequest& getRequest) { return s3Client.GetObject(getRequest); };
+                CryptoBuffer tagFromBody = GetTag(copyRequest, getObjectFunction);
+                InitDecryptionCipher(0, 0, tagFromBody);
+
+                // the range of the ciphertext, without the tag
+                auto cipherTextRange = AdjustRange(copyRequest, headObjectResult);
+                const int64_t lastByte = (std::min)(cipherTextRange.second, static_cast<int64_t>(headObjectResult.GetContentLength()) - 1);
+                int64_t nextByte = cipherTextRange.first;
+
+                const int64_t partSize = static_cast<int64_t>(PartSizeInWholeBlocks(m_cryptoConfig.GetPartSize()));
+                const size_t maxConcurrentParts = concurrentParts ? (std::max)(m_cryptoConfig.GetMaxConcurrentParts(), static_cast<size_t>(1)) : 1;
+                Aws::Deque<GetObjectOutcomeCallable> partsInFlight;
+                auto requestNextParts = [&]()
+                {
+                    while (partsInFlight.size() < maxConcurrentParts && nextByte <= lastByte)
+                    {
+                        int64_t partLastByte = (std::min)(nextByte + partSize - 1, lastByte);
+                        GetObjectRequest partRequest(copyRequest);
+                        partRequest.SetResponseStreamFactory(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+                        Aws::StringStream ss;
+                        ss << "bytes=" << nextByte << "-" << partLastByte;
+                        partRequest.SetRange(ss.str());
+                        if (concurrentParts)
+                        {
+                            partsInFlight.push_back(s3Client.GetObjectCallable(partRequest));
+                        }
+                        else
+                        {
+                            std::packaged_task<GetObjectOutcome()> getPart([&s3Client, &partRequest]() { return s3Client.GetObject(partRequest); });
+                            partsInFlight.push_back(getPart.get_future());
+                            getPart();
+                        }
+                        nextByte = partLastByte + 1;
+                    }
+                };
+
+                Aws::IOStream* userSuppliedStream = request.GetResponseStreamFactory()();
+                std::shared_ptr<GetObjectOutcome> failedOutcome;
+                GetObjectResult firstPartResult;
+                bool isFirstPart = true;
+                int64_t bytesDecrypted = 0;
+                CryptoBuffer ciphertext;
+                // stream modes decrypt each part in place, CBC into a buffer reused across parts
+                CryptoBuffer plaintextBuffer;
+
+                requestNextParts();
+                while (!partsInFlight.empty())
+                {
+                    GetObjectOutcome outcome = partsInFlight.front().get();
+                    partsInFlight.pop_front();
+                    if (!outcome.IsSuccess())
+                    {
+                        if (!failedOutcome)
+                        {
+                            AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "S3 get operation not successful: "
+                                << outcome.GetError().GetExceptionName() << " : "
+                                << outcome.GetError().GetMessage());
+                            failedOutcome = Aws::MakeShared<GetObjectOutcome>(ALLOCATION_TAG, std::move(outcome));
+                        }
+                        continue;
+                    }
+                    if (failedOutcome)
+                    {
+                        continue;
+                    }
+
+                    Aws::IOStream& partBody = outcome.GetResult().GetBody();
+                    partBody.seekg(0, std::ios_base::end);
+                    size_t partLength = static_cast<size_t>(partBody.tellg());
+                    partBody.seekg(0, std::ios_base::beg);
+                    if (ciphertext.GetLength() != partLength)
+                    {
+                        ciphertext = CryptoBuffer(partLength);
+                    }
+                    partBody.read(reinterpret_cast<char*>(ciphertext.GetUnderlyingData()), partLength);
+                    if (static_cast<size_t>(partBody.gcount()) != partLength)
+                    {
+                        AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Read " << partBody.gcount() << " bytes of a part of " << partLength << " bytes.");
+                        failedOutcome = Aws::MakeShared<GetObjectOutcome>(ALLOCATION_TAG, AWSError<Aws::S3::S3Errors>(Aws::S3::S3Errors::INTERNAL_FAILURE,
+                            "PartReadFailed", "Failed to read a part of the object content", false/*not retryable*/));
+                        continue;
+                    }
+
+                    CryptoBuffer& plaintext = m_cipher->SupportsInPlace() ? ciphertext : plaintextBuffer;
+                    size_t plaintextLength = 0;
+                    m_cipher->DecryptInto(ciphertext.GetUnderlyingData(), partLength, plaintext, 0, plaintextLength);
+                    userSuppliedStream->write(reinterpret_cast<const char*>(plaintext.GetUnderlyingData()), plaintextLength);
+                    bytesDecrypted += static_cast<int64_t>(plaintextLength);
+
+                    if (isFirstPart)
+                    {
+                        firstPartResult = outcome.GetResultWithOwnership();
+                        isFirstPart = false;
+                    }
+                    requestNextParts();
+                }
+
+                if (failedOutcome)
+                {
+                    Aws::Delete(userSuppliedStream);
+                    return S3EncryptionGetObjectOutcome(BuildS3EncryptionError(failedOutcome->GetError()));
+                }
+
+                CryptoBuffer finalBlocks = m_cipher->FinalizeDecryption();
+                userSuppliedStream->write(reinterpret_cast<const char*>(finalBlocks.GetUnderlyingData()), finalBlocks.GetLength());
+                bytesDecrypted += static_cast<int64_t>(finalBlocks.GetLength());
+                if (!*m_cipher)
+                {
+                    AWS_LOGSTREAM_ERROR(ALLOCATION_TAG, "Decryption of the object content failed.");
+                    Aws::Delete(userSuppliedStream);
+                    return S3EncryptionGetObjectOutcome(AWSError<S3EncryptionErrors>(CryptoErrors::DECRYPT_CONTENT_ENCRYPTION_KEY_FAILED,
+                        "DecryptContentFailed", "Failed to decrypt the object content", false/*not retryable*/));
+                }
+
+                userSuppliedStream->flush();
+                userSuppliedStream->clear();
+                userSuppliedStream->seekg(0, std::ios_base::beg);
+                firstPartResult.ReplaceBody(userSuppliedStream);
+                firstPartResult.SetContentLength(bytesDecrypted);
+                firstPartResult.SetContentRange("");
+                return S3EncryptionGetObjectOutcome(std::move(firstPartResult));
+            }
+
             S3EncryptionPutObjectOutcome CryptoModule::WrapAndMakeRequestWithCipher(Aws::S3::Model::PutObjectRequest & request, const PutObjectFunction& putObjectFunction)
             {
                 std::shared_ptr<Aws::IOStream> iostream = request.GetBody();
-                request.SetBody(Aws::MakeShared<Aws::Utils::Crypto::SymmetricCryptoStream>(ALLOCATION_TAG, (Aws::IStream&)*iostream, CipherMode::Encrypt, (*m_cipher)));
+                request.SetBody(Aws::MakeShared<Aws::Utils::Crypto::SymmetricCryptoStream>(ALLOCATION_TAG, (Aws::IStream&)*iostream, CipherMode::Encrypt, (*m_cipher), m_cryptoConfig.GetBufferSize()));
                 iostream->clear();
                 iostream->seekg(0, std::ios_base::beg);
 
@@ -142,7 +528,7 @@ namespace Aws
                 auto userSuppliedStream = userSuppliedStreamFactory();
 
                 request.SetResponseStreamFactory(
-                    [&] { return Aws::New<SymmetricCryptoStream>(ALLOCATION_TAG, (Aws::OStream&)*userSuppliedStream, CipherMode::Decrypt, *m_cipher, DEFAULT_BUF_SIZE, firstBlockOffset); }
+                    [&] { return Aws::New<SymmetricCryptoStream>(ALLOCATION_TAG, (Aws::OStream&)*userSuppliedStream, CipherMode::Decrypt, *m_cipher, m_cryptoConfig.GetBufferSize(), firstBlockOffset); }
                 );
                 GetObjectOutcome outcome = getObjectFunction(request);
                 if (!outcome.IsSuccess())
@@ -477,6 +863,16 @@ namespace Aws
                 return m_cipher->EncryptBuffer(unEncryptedData);
             }
 
+            bool AES_GCM_AppendedTag::EncryptInto(const unsigned char* data, size_t length, CryptoBuffer& output, size_t outputOffset, size_t& outputLength)
+            {
+                return m_cipher->EncryptInto(data, length, output, outputOffset, outputLength);
+            }
+
+            bool AES_GCM_AppendedTag::SupportsInPlace() const
+            {
+                return m_cipher->SupportsInPlace();
+            }
+
             CryptoBuffer AES_GCM_AppendedTag::FinalizeEncryption()
             {
                 CryptoBuffer&& finalizeBuffer = m_cipher->FinalizeEncryption();
@@ -19,6 +19,7 @@
 #include <aws/core/client/AWSError.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/client/AWSClient.h>
+#include <aws/core/http/URI.h>
 #include <aws/core/auth/AWSAuthSigner.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
@@ -2539,6 +2540,7 @@ namespace Aws
         void init(const Client::ClientConfiguration& clientConfiguration);
         Aws::String ComputeEndpointString(const Aws::String& bucket) const;
         Aws::String ComputeEndpointString() const;
+        Aws::Http::URI ComputeEndpoint(const Aws::String& bucket) const;
 
         /**Async helpers**/
         void AbortMultipartUploadAsyncHelper(const Model::AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const;
@@ -2617,6 +2619,7 @@ namespace Aws
 
         Aws::String m_baseUri;
         Aws::String m_scheme;
+        Aws::Http::URI m_baseEndpoint;
         std::shared_ptr<Utils::Threading::Executor> m_executor;
         bool m_useVirtualAdressing;
     };
@@ -33,7 +33,8 @@ namespace AnalyticsS3ExportFileFormatMapper
 {
 AWS_S3_API AnalyticsS3ExportFileFormat GetAnalyticsS3ExportFileFormatForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForAnalyticsS3ExportFileFormat(AnalyticsS3ExportFileFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForAnalyticsS3ExportFileFormat(AnalyticsS3ExportFileFormat value);
 } // namespace AnalyticsS3ExportFileFormatMapper
 } // namespace Model
 } // namespace S3
@@ -34,7 +34,8 @@ namespace BucketAccelerateStatusMapper
 {
 AWS_S3_API BucketAccelerateStatus GetBucketAccelerateStatusForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForBucketAccelerateStatus(BucketAccelerateStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForBucketAccelerateStatus(BucketAccelerateStatus value);
 } // namespace BucketAccelerateStatusMapper
 } // namespace Model
 } // namespace S3
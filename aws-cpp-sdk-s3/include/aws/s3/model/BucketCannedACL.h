@@ -36,7 +36,8 @@ namespace BucketCannedACLMapper
 {
 AWS_S3_API BucketCannedACL GetBucketCannedACLForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForBucketCannedACL(BucketCannedACL value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForBucketCannedACL(BucketCannedACL value);
 } // namespace BucketCannedACLMapper
 } // namespace Model
 } // namespace S3
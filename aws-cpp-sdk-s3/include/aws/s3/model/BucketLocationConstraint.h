@@ -51,7 +51,8 @@ namespace BucketLocationConstraintMapper
 {
 AWS_S3_API BucketLocationConstraint GetBucketLocationConstraintForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForBucketLocationConstraint(BucketLocationConstraint value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForBucketLocationConstraint(BucketLocationConstraint value);
 } // namespace BucketLocationConstraintMapper
 } // namespace Model
 } // namespace S3
@@ -35,7 +35,8 @@ namespace BucketLogsPermissionMapper
 {
 AWS_S3_API BucketLogsPermission GetBucketLogsPermissionForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForBucketLogsPermission(BucketLogsPermission value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForBucketLogsPermission(BucketLogsPermission value);
 } // namespace BucketLogsPermissionMapper
 } // namespace Model
 } // namespace S3
@@ -34,7 +34,8 @@ namespace BucketVersioningStatusMapper
 {
 AWS_S3_API BucketVersioningStatus GetBucketVersioningStatusForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForBucketVersioningStatus(BucketVersioningStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForBucketVersioningStatus(BucketVersioningStatus value);
 } // namespace BucketVersioningStatusMapper
 } // namespace Model
 } // namespace S3
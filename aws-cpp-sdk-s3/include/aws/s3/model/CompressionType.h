@@ -35,7 +35,8 @@ namespace CompressionTypeMapper
 {
 AWS_S3_API CompressionType GetCompressionTypeForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForCompressionType(CompressionType value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForCompressionType(CompressionType value);
 } // namespace CompressionTypeMapper
 } // namespace Model
 } // namespace S3
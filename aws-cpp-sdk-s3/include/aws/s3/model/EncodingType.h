@@ -33,7 +33,8 @@ namespace EncodingTypeMapper
 {
 AWS_S3_API EncodingType GetEncodingTypeForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForEncodingType(EncodingType value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForEncodingType(EncodingType value);
 } // namespace EncodingTypeMapper
 } // namespace Model
 } // namespace S3
@@ -41,7 +41,8 @@ namespace EventMapper
 {
 AWS_S3_API Event GetEventForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForEvent(Event value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForEvent(Event value);
 } // namespace EventMapper
 } // namespace Model
 } // namespace S3
@@ -34,7 +34,8 @@ namespace ExpirationStatusMapper
 {
 AWS_S3_API ExpirationStatus GetExpirationStatusForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForExpirationStatus(ExpirationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForExpirationStatus(ExpirationStatus value);
 } // namespace ExpirationStatusMapper
 } // namespace Model
 } // namespace S3
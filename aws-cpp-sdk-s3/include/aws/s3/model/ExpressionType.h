@@ -33,7 +33,8 @@ namespace ExpressionTypeMapper
 {
 AWS_S3_API ExpressionType GetExpressionTypeForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForExpressionType(ExpressionType value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForExpressionType(ExpressionType value);
 } // namespace ExpressionTypeMapper
 } // namespace Model
 } // namespace S3
@@ -35,7 +35,8 @@ namespace FileHeaderInfoMapper
 {
 AWS_S3_API FileHeaderInfo GetFileHeaderInfoForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForFileHeaderInfo(FileHeaderInfo value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForFileHeaderInfo(FileHeaderInfo value);
 } // namespace FileHeaderInfoMapper
 } // namespace Model
 } // namespace S3
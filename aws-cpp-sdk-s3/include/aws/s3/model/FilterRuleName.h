@@ -34,7 +34,8 @@ namespace FilterRuleNameMapper
 {
 AWS_S3_API FilterRuleName GetFilterRuleNameForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForFilterRuleName(FilterRuleName value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForFilterRuleName(FilterRuleName value);
 } // namespace FilterRuleNameMapper
 } // namespace Model
 } // namespace S3
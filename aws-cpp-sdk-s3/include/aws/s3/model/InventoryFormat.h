@@ -34,7 +34,8 @@ namespace InventoryFormatMapper
 {
 AWS_S3_API InventoryFormat GetInventoryFormatForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForInventoryFormat(InventoryFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForInventoryFormat(InventoryFormat value);
 } // namespace InventoryFormatMapper
 } // namespace Model
 } // namespace S3
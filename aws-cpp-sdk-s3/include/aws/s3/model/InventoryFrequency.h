@@ -34,7 +34,8 @@ namespace InventoryFrequencyMapper
 {
 AWS_S3_API InventoryFrequency GetInventoryFrequencyForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForInventoryFrequency(InventoryFrequency value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForInventoryFrequency(InventoryFrequency value);
 } // namespace InventoryFrequencyMapper
 } // namespace Model
 } // namespace S3
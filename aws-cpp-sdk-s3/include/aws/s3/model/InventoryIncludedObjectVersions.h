@@ -34,7 +34,8 @@ namespace InventoryIncludedObjectVersionsMapper
 {
 AWS_S3_API InventoryIncludedObjectVersions GetInventoryIncludedObjectVersionsForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForInventoryIncludedObjectVersions(InventoryIncludedObjectVersions value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForInventoryIncludedObjectVersions(InventoryIncludedObjectVersions value);
 } // namespace InventoryIncludedObjectVersionsMapper
 } // namespace Model
 } // namespace S3
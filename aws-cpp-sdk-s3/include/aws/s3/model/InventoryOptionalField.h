@@ -39,7 +39,8 @@ namespace InventoryOptionalFieldMapper
 {
 AWS_S3_API InventoryOptionalField GetInventoryOptionalFieldForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForInventoryOptionalField(InventoryOptionalField value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForInventoryOptionalField(InventoryOptionalField value);
 } // namespace InventoryOptionalFieldMapper
 } // namespace Model
 } // namespace S3
@@ -34,7 +34,8 @@ namespace JSONTypeMapper
 {
 AWS_S3_API JSONType GetJSONTypeForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForJSONType(JSONType value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForJSONType(JSONType value);
 } // namespace JSONTypeMapper
 } // namespace Model
 } // namespace S3
@@ -34,7 +34,8 @@ namespace MFADeleteMapper
 {
 AWS_S3_API MFADelete GetMFADeleteForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForMFADelete(MFADelete value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForMFADelete(MFADelete value);
 } // namespace MFADeleteMapper
 } // namespace Model
 } // namespace S3
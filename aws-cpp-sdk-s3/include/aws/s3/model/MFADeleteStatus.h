@@ -34,7 +34,8 @@ namespace MFADeleteStatusMapper
 {
 AWS_S3_API MFADeleteStatus GetMFADeleteStatusForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForMFADeleteStatus(MFADeleteStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForMFADeleteStatus(MFADeleteStatus value);
 } // namespace MFADeleteStatusMapper
 } // namespace Model
 } // namespace S3
@@ -34,7 +34,8 @@ namespace MetadataDirectiveMapper
 {
 AWS_S3_API MetadataDirective GetMetadataDirectiveForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForMetadataDirective(MetadataDirective value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForMetadataDirective(MetadataDirective value);
 } // namespace MetadataDirectiveMapper
 } // namespace Model
 } // namespace S3
@@ -39,7 +39,8 @@ namespace ObjectCannedACLMapper
 {
 AWS_S3_API ObjectCannedACL GetObjectCannedACLForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForObjectCannedACL(ObjectCannedACL value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForObjectCannedACL(ObjectCannedACL value);
 } // namespace ObjectCannedACLMapper
 } // namespace Model
 } // namespace S3
@@ -37,7 +37,8 @@ namespace ObjectStorageClassMapper
 {
 AWS_S3_API ObjectStorageClass GetObjectStorageClassForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForObjectStorageClass(ObjectStorageClass value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForObjectStorageClass(ObjectStorageClass value);
 } // namespace ObjectStorageClassMapper
 } // namespace Model
 } // namespace S3
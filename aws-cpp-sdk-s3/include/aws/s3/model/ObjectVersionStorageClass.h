@@ -33,7 +33,8 @@ namespace ObjectVersionStorageClassMapper
 {
 AWS_S3_API ObjectVersionStorageClass GetObjectVersionStorageClassForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForObjectVersionStorageClass(ObjectVersionStorageClass value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForObjectVersionStorageClass(ObjectVersionStorageClass value);
 } // namespace ObjectVersionStorageClassMapper
 } // namespace Model
 } // namespace S3
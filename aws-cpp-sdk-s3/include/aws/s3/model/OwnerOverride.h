@@ -33,7 +33,8 @@ namespace OwnerOverrideMapper
 {
 AWS_S3_API OwnerOverride GetOwnerOverrideForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForOwnerOverride(OwnerOverride value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForOwnerOverride(OwnerOverride value);
 } // namespace OwnerOverrideMapper
 } // namespace Model
 } // namespace S3
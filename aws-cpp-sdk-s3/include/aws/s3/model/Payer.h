@@ -34,7 +34,8 @@ namespace PayerMapper
 {
 AWS_S3_API Payer GetPayerForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForPayer(Payer value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForPayer(Payer value);
 } // namespace PayerMapper
 } // namespace Model
 } // namespace S3
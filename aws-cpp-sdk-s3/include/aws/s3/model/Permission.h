@@ -37,7 +37,8 @@ namespace PermissionMapper
 {
 AWS_S3_API Permission GetPermissionForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForPermission(Permission value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForPermission(Permission value);
 } // namespace PermissionMapper
 } // namespace Model
 } // namespace S3
@@ -34,7 +34,8 @@ namespace ProtocolMapper
 {
 AWS_S3_API Protocol GetProtocolForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForProtocol(Protocol value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForProtocol(Protocol value);
 } // namespace ProtocolMapper
 } // namespace Model
 } // namespace S3
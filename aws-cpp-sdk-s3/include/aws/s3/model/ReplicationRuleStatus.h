@@ -34,7 +34,8 @@ namespace ReplicationRuleStatusMapper
 {
 AWS_S3_API ReplicationRuleStatus GetReplicationRuleStatusForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForReplicationRuleStatus(ReplicationRuleStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForReplicationRuleStatus(ReplicationRuleStatus value);
 } // namespace ReplicationRuleStatusMapper
 } // namespace Model
 } // namespace S3
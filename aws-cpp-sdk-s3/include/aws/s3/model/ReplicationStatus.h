@@ -36,7 +36,8 @@ namespace ReplicationStatusMapper
 {
 AWS_S3_API ReplicationStatus GetReplicationStatusForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForReplicationStatus(ReplicationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForReplicationStatus(ReplicationStatus value);
 } // namespace ReplicationStatusMapper
 } // namespace Model
 } // namespace S3
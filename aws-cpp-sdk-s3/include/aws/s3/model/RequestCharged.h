@@ -33,7 +33,8 @@ namespace RequestChargedMapper
 {
 AWS_S3_API RequestCharged GetRequestChargedForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForRequestCharged(RequestCharged value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForRequestCharged(RequestCharged value);
 } // namespace RequestChargedMapper
 } // namespace Model
 } // namespace S3
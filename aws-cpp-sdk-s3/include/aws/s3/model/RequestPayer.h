@@ -33,7 +33,8 @@ namespace RequestPayerMapper
 {
 AWS_S3_API RequestPayer GetRequestPayerForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForRequestPayer(RequestPayer value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForRequestPayer(RequestPayer value);
 } // namespace RequestPayerMapper
 } // namespace Model
 } // namespace S3
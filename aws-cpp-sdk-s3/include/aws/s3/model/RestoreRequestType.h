@@ -33,7 +33,8 @@ namespace RestoreRequestTypeMapper
 {
 AWS_S3_API RestoreRequestType GetRestoreRequestTypeForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForRestoreRequestType(RestoreRequestType value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForRestoreRequestType(RestoreRequestType value);
 } // namespace RestoreRequestTypeMapper
 } // namespace Model
 } // namespace S3
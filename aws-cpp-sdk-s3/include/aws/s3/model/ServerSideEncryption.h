@@ -34,7 +34,8 @@ namespace ServerSideEncryptionMapper
 {
 AWS_S3_API ServerSideEncryption GetServerSideEncryptionForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForServerSideEncryption(ServerSideEncryption value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForServerSideEncryption(ServerSideEncryption value);
 } // namespace ServerSideEncryptionMapper
 } // namespace Model
 } // namespace S3
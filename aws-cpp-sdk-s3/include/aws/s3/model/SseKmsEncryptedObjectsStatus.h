@@ -34,7 +34,8 @@ namespace SseKmsEncryptedObjectsStatusMapper
 {
 AWS_S3_API SseKmsEncryptedObjectsStatus GetSseKmsEncryptedObjectsStatusForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForSseKmsEncryptedObjectsStatus(SseKmsEncryptedObjectsStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForSseKmsEncryptedObjectsStatus(SseKmsEncryptedObjectsStatus value);
 } // namespace SseKmsEncryptedObjectsStatusMapper
 } // namespace Model
 } // namespace S3
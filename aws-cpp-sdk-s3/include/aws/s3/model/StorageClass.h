@@ -36,7 +36,8 @@ namespace StorageClassMapper
 {
 AWS_S3_API StorageClass GetStorageClassForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForStorageClass(StorageClass value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForStorageClass(StorageClass value);
 } // namespace StorageClassMapper
 } // namespace Model
 } // namespace S3
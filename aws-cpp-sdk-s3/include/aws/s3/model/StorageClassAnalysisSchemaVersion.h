@@ -33,7 +33,8 @@ namespace StorageClassAnalysisSchemaVersionMapper
 {
 AWS_S3_API StorageClassAnalysisSchemaVersion GetStorageClassAnalysisSchemaVersionForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForStorageClassAnalysisSchemaVersion(StorageClassAnalysisSchemaVersion value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForStorageClassAnalysisSchemaVersion(StorageClassAnalysisSchemaVersion value);
 } // namespace StorageClassAnalysisSchemaVersionMapper
 } // namespace Model
 } // namespace S3
@@ -34,7 +34,8 @@ namespace TaggingDirectiveMapper
 {
 AWS_S3_API TaggingDirective GetTaggingDirectiveForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForTaggingDirective(TaggingDirective value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForTaggingDirective(TaggingDirective value);
 } // namespace TaggingDirectiveMapper
 } // namespace Model
 } // namespace S3
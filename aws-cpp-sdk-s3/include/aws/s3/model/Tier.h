@@ -35,7 +35,8 @@ namespace TierMapper
 {
 AWS_S3_API Tier GetTierForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForTier(Tier value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForTier(Tier value);
 } // namespace TierMapper
 } // namespace Model
 } // namespace S3
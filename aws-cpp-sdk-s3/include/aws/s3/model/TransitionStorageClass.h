@@ -35,7 +35,8 @@ namespace TransitionStorageClassMapper
 {
 AWS_S3_API TransitionStorageClass GetTransitionStorageClassForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForTransitionStorageClass(TransitionStorageClass value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForTransitionStorageClass(TransitionStorageClass value);
 } // namespace TransitionStorageClassMapper
 } // namespace Model
 } // namespace S3
@@ -35,7 +35,8 @@ namespace TypeMapper
 {
 AWS_S3_API Type GetTypeForName(const Aws::String& name);
 
-AWS_S3_API Aws::String GetNameForType(Type value);
+// names of values not modeled point into the enum overflow container
+AWS_S3_API const char* GetNameForType(Type value);
 } // namespace TypeMapper
 } // namespace Model
 } // namespace S3
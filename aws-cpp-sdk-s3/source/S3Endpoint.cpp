@@ -26,12 +26,12 @@ namespace S3
 {
 namespace S3Endpoint
 {
-  static const int CN_NORTH_HASH = Aws::Utils::HashingUtils::HashString("cn-north-1");
-  static const int CN_NORTHWEST_1_HASH = Aws::Utils::HashingUtils::HashString("cn-northwest-1");
+  static constexpr int CN_NORTH_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("cn-north-1");
+  static constexpr int CN_NORTHWEST_1_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("cn-northwest-1");
   
-  static const int US_EAST_1_HASH = Aws::Utils::HashingUtils::HashString("us-east-1");
-  static const int US_GOV_WEST_1_HASH = Aws::Utils::HashingUtils::HashString("us-gov-west-1");
-  static const int FIPS_US_GOV_WEST_1_HASH = Aws::Utils::HashingUtils::HashString("fips-us-gov-west-1");
+  static constexpr int US_EAST_1_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("us-east-1");
+  static constexpr int US_GOV_WEST_1_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("us-gov-west-1");
+  static constexpr int FIPS_US_GOV_WEST_1_HASH = Aws::Utils::HashingUtils::CompileTimeHashString("fips-us-gov-west-1");
 
   Aws::String ForRegion(const Aws::String& regionName, bool useDualStack)
   {
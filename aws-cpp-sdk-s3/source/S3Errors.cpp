@@ -28,13 +28,13 @@ namespace S3
 namespace S3ErrorMapper
 {
 
-static const int BUCKET_ALREADY_EXISTS_HASH = HashingUtils::HashString("BucketAlreadyExists");
-static const int BUCKET_ALREADY_OWNED_BY_YOU_HASH = HashingUtils::HashString("BucketAlreadyOwnedByYou");
-static const int OBJECT_ALREADY_IN_ACTIVE_TIER_HASH = HashingUtils::HashString("ObjectAlreadyInActiveTierError");
-static const int NO_SUCH_KEY_HASH = HashingUtils::HashString("NoSuchKey");
-static const int NO_SUCH_BUCKET_HASH = HashingUtils::HashString("NoSuchBucket");
-static const int OBJECT_NOT_IN_ACTIVE_TIER_HASH = HashingUtils::HashString("ObjectNotInActiveTierError");
-static const int NO_SUCH_UPLOAD_HASH = HashingUtils::HashString("NoSuchUpload");
+static constexpr int BUCKET_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("BucketAlreadyExists");
+static constexpr int BUCKET_ALREADY_OWNED_BY_YOU_HASH = HashingUtils::CompileTimeHashString("BucketAlreadyOwnedByYou");
+static constexpr int OBJECT_ALREADY_IN_ACTIVE_TIER_HASH = HashingUtils::CompileTimeHashString("ObjectAlreadyInActiveTierError");
+static constexpr int NO_SUCH_KEY_HASH = HashingUtils::CompileTimeHashString("NoSuchKey");
+static constexpr int NO_SUCH_BUCKET_HASH = HashingUtils::CompileTimeHashString("NoSuchBucket");
+static constexpr int OBJECT_NOT_IN_ACTIVE_TIER_HASH = HashingUtils::CompileTimeHashString("ObjectNotInActiveTierError");
+static constexpr int NO_SUCH_UPLOAD_HASH = HashingUtils::CompileTimeHashString("NoSuchUpload");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,15 +30,23 @@ namespace Aws
       namespace AnalyticsS3ExportFileFormatMapper
       {
 
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
+        static constexpr int CSV_HASH = HashingUtils::CompileTimeHashString("CSV");
 
 
         AnalyticsS3ExportFileFormat GetAnalyticsS3ExportFileFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CSV_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AnalyticsS3ExportFileFormat::CSV;
+          case CSV_HASH:
+            if (name == "CSV")
+            {
+              return AnalyticsS3ExportFileFormat::CSV;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return AnalyticsS3ExportFileFormat::NOT_SET;
         }
 
-        Aws::String GetNameForAnalyticsS3ExportFileFormat(AnalyticsS3ExportFileFormat enumValue)
+        const char* GetNameForAnalyticsS3ExportFileFormat(AnalyticsS3ExportFileFormat enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace BucketCannedACLMapper
       {
 
-        static const int private__HASH = HashingUtils::HashString("private");
-        static const int public_read_HASH = HashingUtils::HashString("public-read");
-        static const int public_read_write_HASH = HashingUtils::HashString("public-read-write");
-        static const int authenticated_read_HASH = HashingUtils::HashString("authenticated-read");
+        static constexpr int private__HASH = HashingUtils::CompileTimeHashString("private");
+        static constexpr int public_read_HASH = HashingUtils::CompileTimeHashString("public-read");
+        static constexpr int public_read_write_HASH = HashingUtils::CompileTimeHashString("public-read-write");
+        static constexpr int authenticated_read_HASH = HashingUtils::CompileTimeHashString("authenticated-read");
 
 
         BucketCannedACL GetBucketCannedACLForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == private__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BucketCannedACL::private_;
-          }
-          else if (hashCode == public_read_HASH)
-          {
-            return BucketCannedACL::public_read;
-          }
-          else if (hashCode == public_read_write_HASH)
-          {
-            return BucketCannedACL::public_read_write;
-          }
-          else if (hashCode == authenticated_read_HASH)
-          {
-            return BucketCannedACL::authenticated_read;
+          case private__HASH:
+            if (name == "private")
+            {
+              return BucketCannedACL::private_;
+            }
+            break;
+          case public_read_HASH:
+            if (name == "public-read")
+            {
+              return BucketCannedACL::public_read;
+            }
+            break;
+          case public_read_write_HASH:
+            if (name == "public-read-write")
+            {
+              return BucketCannedACL::public_read_write;
+            }
+            break;
+          case authenticated_read_HASH:
+            if (name == "authenticated-read")
+            {
+              return BucketCannedACL::authenticated_read;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return BucketCannedACL::NOT_SET;
         }
 
-        Aws::String GetNameForBucketCannedACL(BucketCannedACL enumValue)
+        const char* GetNameForBucketCannedACL(BucketCannedACL enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
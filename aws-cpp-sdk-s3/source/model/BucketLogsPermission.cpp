@@ -30,25 +30,37 @@ namespace Aws
       namespace BucketLogsPermissionMapper
       {
 
-        static const int FULL_CONTROL_HASH = HashingUtils::HashString("FULL_CONTROL");
-        static const int READ_HASH = HashingUtils::HashString("READ");
-        static const int WRITE_HASH = HashingUtils::HashString("WRITE");
+        static constexpr int FULL_CONTROL_HASH = HashingUtils::CompileTimeHashString("FULL_CONTROL");
+        static constexpr int READ_HASH = HashingUtils::CompileTimeHashString("READ");
+        static constexpr int WRITE_HASH = HashingUtils::CompileTimeHashString("WRITE");
 
 
         BucketLogsPermission GetBucketLogsPermissionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_CONTROL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BucketLogsPermission::FULL_CONTROL;
-          }
-          else if (hashCode == READ_HASH)
-          {
-            return BucketLogsPermission::READ;
-          }
-          else if (hashCode == WRITE_HASH)
-          {
-            return BucketLogsPermission::WRITE;
+          case FULL_CONTROL_HASH:
+            if (name == "FULL_CONTROL")
+            {
+              return BucketLogsPermission::FULL_CONTROL;
+            }
+            break;
+          case READ_HASH:
+            if (name == "READ")
+            {
+              return BucketLogsPermission::READ;
+            }
+            break;
+          case WRITE_HASH:
+            if (name == "WRITE")
+            {
+              return BucketLogsPermission::WRITE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return BucketLogsPermission::NOT_SET;
         }
 
-        Aws::String GetNameForBucketLogsPermission(BucketLogsPermission enumValue)
+        const char* GetNameForBucketLogsPermission(BucketLogsPermission enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
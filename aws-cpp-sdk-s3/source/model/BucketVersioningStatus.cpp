@@ -30,20 +30,30 @@ namespace Aws
       namespace BucketVersioningStatusMapper
       {
 
-        static const int Enabled_HASH = HashingUtils::HashString("Enabled");
-        static const int Suspended_HASH = HashingUtils::HashString("Suspended");
+        static constexpr int Enabled_HASH = HashingUtils::CompileTimeHashString("Enabled");
+        static constexpr int Suspended_HASH = HashingUtils::CompileTimeHashString("Suspended");
 
 
         BucketVersioningStatus GetBucketVersioningStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Enabled_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BucketVersioningStatus::Enabled;
-          }
-          else if (hashCode == Suspended_HASH)
-          {
-            return BucketVersioningStatus::Suspended;
+          case Enabled_HASH:
+            if (name == "Enabled")
+            {
+              return BucketVersioningStatus::Enabled;
+            }
+            break;
+          case Suspended_HASH:
+            if (name == "Suspended")
+            {
+              return BucketVersioningStatus::Suspended;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BucketVersioningStatus::NOT_SET;
         }
 
-        Aws::String GetNameForBucketVersioningStatus(BucketVersioningStatus enumValue)
+        const char* GetNameForBucketVersioningStatus(BucketVersioningStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
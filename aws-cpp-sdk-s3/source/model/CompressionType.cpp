@@ -30,25 +30,37 @@ namespace Aws
       namespace CompressionTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int GZIP_HASH = HashingUtils::HashString("GZIP");
-        static const int BZIP2_HASH = HashingUtils::HashString("BZIP2");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int GZIP_HASH = HashingUtils::CompileTimeHashString("GZIP");
+        static constexpr int BZIP2_HASH = HashingUtils::CompileTimeHashString("BZIP2");
 
 
         CompressionType GetCompressionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CompressionType::NONE;
-          }
-          else if (hashCode == GZIP_HASH)
-          {
-            return CompressionType::GZIP;
-          }
-          else if (hashCode == BZIP2_HASH)
-          {
-            return CompressionType::BZIP2;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return CompressionType::NONE;
+            }
+            break;
+          case GZIP_HASH:
+            if (name == "GZIP")
+            {
+              return CompressionType::GZIP;
+            }
+            break;
+          case BZIP2_HASH:
+            if (name == "BZIP2")
+            {
+              return CompressionType::BZIP2;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return CompressionType::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionType(CompressionType enumValue)
+        const char* GetNameForCompressionType(CompressionType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,55 +30,79 @@ namespace Aws
       namespace EventMapper
       {
 
-        static const int s3_ReducedRedundancyLostObject_HASH = HashingUtils::HashString("s3:ReducedRedundancyLostObject");
-        static const int s3_ObjectCreated_HASH = HashingUtils::HashString("s3:ObjectCreated:*");
-        static const int s3_ObjectCreated_Put_HASH = HashingUtils::HashString("s3:ObjectCreated:Put");
-        static const int s3_ObjectCreated_Post_HASH = HashingUtils::HashString("s3:ObjectCreated:Post");
-        static const int s3_ObjectCreated_Copy_HASH = HashingUtils::HashString("s3:ObjectCreated:Copy");
-        static const int s3_ObjectCreated_CompleteMultipartUpload_HASH = HashingUtils::HashString("s3:ObjectCreated:CompleteMultipartUpload");
-        static const int s3_ObjectRemoved_HASH = HashingUtils::HashString("s3:ObjectRemoved:*");
-        static const int s3_ObjectRemoved_Delete_HASH = HashingUtils::HashString("s3:ObjectRemoved:Delete");
-        static const int s3_ObjectRemoved_DeleteMarkerCreated_HASH = HashingUtils::HashString("s3:ObjectRemoved:DeleteMarkerCreated");
+        static constexpr int s3_ReducedRedundancyLostObject_HASH = HashingUtils::CompileTimeHashString("s3:ReducedRedundancyLostObject");
+        static constexpr int s3_ObjectCreated_HASH = HashingUtils::CompileTimeHashString("s3:ObjectCreated:*");
+        static constexpr int s3_ObjectCreated_Put_HASH = HashingUtils::CompileTimeHashString("s3:ObjectCreated:Put");
+        static constexpr int s3_ObjectCreated_Post_HASH = HashingUtils::CompileTimeHashString("s3:ObjectCreated:Post");
+        static constexpr int s3_ObjectCreated_Copy_HASH = HashingUtils::CompileTimeHashString("s3:ObjectCreated:Copy");
+        static constexpr int s3_ObjectCreated_CompleteMultipartUpload_HASH = HashingUtils::CompileTimeHashString("s3:ObjectCreated:CompleteMultipartUpload");
+        static constexpr int s3_ObjectRemoved_HASH = HashingUtils::CompileTimeHashString("s3:ObjectRemoved:*");
+        static constexpr int s3_ObjectRemoved_Delete_HASH = HashingUtils::CompileTimeHashString("s3:ObjectRemoved:Delete");
+        static constexpr int s3_ObjectRemoved_DeleteMarkerCreated_HASH = HashingUtils::CompileTimeHashString("s3:ObjectRemoved:DeleteMarkerCreated");
 
 
         Event GetEventForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == s3_ReducedRedundancyLostObject_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Event::s3_ReducedRedundancyLostObject;
-          }
-          else if (hashCode == s3_ObjectCreated_HASH)
-          {
-            return Event::s3_ObjectCreated;
-          }
-          else if (hashCode == s3_ObjectCreated_Put_HASH)
-          {
-            return Event::s3_ObjectCreated_Put;
-          }
-          else if (hashCode == s3_ObjectCreated_Post_HASH)
-          {
-            return Event::s3_ObjectCreated_Post;
-          }
-          else if (hashCode == s3_ObjectCreated_Copy_HASH)
-          {
-            return Event::s3_ObjectCreated_Copy;
-          }
-          else if (hashCode == s3_ObjectCreated_CompleteMultipartUpload_HASH)
-          {
-            return Event::s3_ObjectCreated_CompleteMultipartUpload;
-          }
-          else if (hashCode == s3_ObjectRemoved_HASH)
-          {
-            return Event::s3_ObjectRemoved;
-          }
-          else if (hashCode == s3_ObjectRemoved_Delete_HASH)
-          {
-            return Event::s3_ObjectRemoved_Delete;
-          }
-          else if (hashCode == s3_ObjectRemoved_DeleteMarkerCreated_HASH)
-          {
-            return Event::s3_ObjectRemoved_DeleteMarkerCreated;
+          case s3_ReducedRedundancyLostObject_HASH:
+            if (name == "s3:ReducedRedundancyLostObject")
+            {
+              return Event::s3_ReducedRedundancyLostObject;
+            }
+            break;
+          case s3_ObjectCreated_HASH:
+            if (name == "s3:ObjectCreated:*")
+            {
+              return Event::s3_ObjectCreated;
+            }
+            break;
+          case s3_ObjectCreated_Put_HASH:
+            if (name == "s3:ObjectCreated:Put")
+            {
+              return Event::s3_ObjectCreated_Put;
+            }
+            break;
+          case s3_ObjectCreated_Post_HASH:
+            if (name == "s3:ObjectCreated:Post")
+            {
+              return Event::s3_ObjectCreated_Post;
+            }
+            break;
+          case s3_ObjectCreated_Copy_HASH:
+            if (name == "s3:ObjectCreated:Copy")
+            {
+              return Event::s3_ObjectCreated_Copy;
+            }
+            break;
+          case s3_ObjectCreated_CompleteMultipartUpload_HASH:
+            if (name == "s3:ObjectCreated:CompleteMultipartUpload")
+            {
+              return Event::s3_ObjectCreated_CompleteMultipartUpload;
+            }
+            break;
+          case s3_ObjectRemoved_HASH:
+            if (name == "s3:ObjectRemoved:*")
+            {
+              return Event::s3_ObjectRemoved;
+            }
+            break;
+          case s3_ObjectRemoved_Delete_HASH:
+            if (name == "s3:ObjectRemoved:Delete")
+            {
+              return Event::s3_ObjectRemoved_Delete;
+            }
+            break;
+          case s3_ObjectRemoved_DeleteMarkerCreated_HASH:
+            if (name == "s3:ObjectRemoved:DeleteMarkerCreated")
+            {
+              return Event::s3_ObjectRemoved_DeleteMarkerCreated;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return Event::NOT_SET;
         }
 
-        Aws::String GetNameForEvent(Event enumValue)
+        const char* GetNameForEvent(Event enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
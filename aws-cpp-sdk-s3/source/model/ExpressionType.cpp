@@ -30,15 +30,23 @@ namespace Aws
       namespace ExpressionTypeMapper
       {
 
-        static const int SQL_HASH = HashingUtils::HashString("SQL");
+        static constexpr int SQL_HASH = HashingUtils::CompileTimeHashString("SQL");
 
 
         ExpressionType GetExpressionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SQL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExpressionType::SQL;
+          case SQL_HASH:
+            if (name == "SQL")
+            {
+              return ExpressionType::SQL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ExpressionType::NOT_SET;
         }
 
-        Aws::String GetNameForExpressionType(ExpressionType enumValue)
+        const char* GetNameForExpressionType(ExpressionType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
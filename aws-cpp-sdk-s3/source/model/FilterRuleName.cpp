@@ -30,20 +30,30 @@ namespace Aws
       namespace FilterRuleNameMapper
       {
 
-        static const int prefix_HASH = HashingUtils::HashString("prefix");
-        static const int suffix_HASH = HashingUtils::HashString("suffix");
+        static constexpr int prefix_HASH = HashingUtils::CompileTimeHashString("prefix");
+        static constexpr int suffix_HASH = HashingUtils::CompileTimeHashString("suffix");
 
 
         FilterRuleName GetFilterRuleNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == prefix_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FilterRuleName::prefix;
-          }
-          else if (hashCode == suffix_HASH)
-          {
-            return FilterRuleName::suffix;
+          case prefix_HASH:
+            if (name == "prefix")
+            {
+              return FilterRuleName::prefix;
+            }
+            break;
+          case suffix_HASH:
+            if (name == "suffix")
+            {
+              return FilterRuleName::suffix;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FilterRuleName::NOT_SET;
         }
 
-        Aws::String GetNameForFilterRuleName(FilterRuleName enumValue)
+        const char* GetNameForFilterRuleName(FilterRuleName enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
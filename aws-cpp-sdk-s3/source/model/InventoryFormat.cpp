@@ -30,20 +30,30 @@ namespace Aws
       namespace InventoryFormatMapper
       {
 
-        static const int CSV_HASH = HashingUtils::HashString("CSV");
-        static const int ORC_HASH = HashingUtils::HashString("ORC");
+        static constexpr int CSV_HASH = HashingUtils::CompileTimeHashString("CSV");
+        static constexpr int ORC_HASH = HashingUtils::CompileTimeHashString("ORC");
 
 
         InventoryFormat GetInventoryFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CSV_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InventoryFormat::CSV;
-          }
-          else if (hashCode == ORC_HASH)
-          {
-            return InventoryFormat::ORC;
+          case CSV_HASH:
+            if (name == "CSV")
+            {
+              return InventoryFormat::CSV;
+            }
+            break;
+          case ORC_HASH:
+            if (name == "ORC")
+            {
+              return InventoryFormat::ORC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InventoryFormat::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryFormat(InventoryFormat enumValue)
+        const char* GetNameForInventoryFormat(InventoryFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace InventoryFrequencyMapper
       {
 
-        static const int Daily_HASH = HashingUtils::HashString("Daily");
-        static const int Weekly_HASH = HashingUtils::HashString("Weekly");
+        static constexpr int Daily_HASH = HashingUtils::CompileTimeHashString("Daily");
+        static constexpr int Weekly_HASH = HashingUtils::CompileTimeHashString("Weekly");
 
 
         InventoryFrequency GetInventoryFrequencyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Daily_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InventoryFrequency::Daily;
-          }
-          else if (hashCode == Weekly_HASH)
-          {
-            return InventoryFrequency::Weekly;
+          case Daily_HASH:
+            if (name == "Daily")
+            {
+              return InventoryFrequency::Daily;
+            }
+            break;
+          case Weekly_HASH:
+            if (name == "Weekly")
+            {
+              return InventoryFrequency::Weekly;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InventoryFrequency::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryFrequency(InventoryFrequency enumValue)
+        const char* GetNameForInventoryFrequency(InventoryFrequency enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace InventoryIncludedObjectVersionsMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int Current_HASH = HashingUtils::HashString("Current");
+        static constexpr int All_HASH = HashingUtils::CompileTimeHashString("All");
+        static constexpr int Current_HASH = HashingUtils::CompileTimeHashString("Current");
 
 
         InventoryIncludedObjectVersions GetInventoryIncludedObjectVersionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InventoryIncludedObjectVersions::All;
-          }
-          else if (hashCode == Current_HASH)
-          {
-            return InventoryIncludedObjectVersions::Current;
+          case All_HASH:
+            if (name == "All")
+            {
+              return InventoryIncludedObjectVersions::All;
+            }
+            break;
+          case Current_HASH:
+            if (name == "Current")
+            {
+              return InventoryIncludedObjectVersions::Current;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InventoryIncludedObjectVersions::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryIncludedObjectVersions(InventoryIncludedObjectVersions enumValue)
+        const char* GetNameForInventoryIncludedObjectVersions(InventoryIncludedObjectVersions enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace InventoryOptionalFieldMapper
       {
 
-        static const int Size_HASH = HashingUtils::HashString("Size");
-        static const int LastModifiedDate_HASH = HashingUtils::HashString("LastModifiedDate");
-        static const int StorageClass_HASH = HashingUtils::HashString("StorageClass");
-        static const int ETag_HASH = HashingUtils::HashString("ETag");
-        static const int IsMultipartUploaded_HASH = HashingUtils::HashString("IsMultipartUploaded");
-        static const int ReplicationStatus_HASH = HashingUtils::HashString("ReplicationStatus");
-        static const int EncryptionStatus_HASH = HashingUtils::HashString("EncryptionStatus");
+        static constexpr int Size_HASH = HashingUtils::CompileTimeHashString("Size");
+        static constexpr int LastModifiedDate_HASH = HashingUtils::CompileTimeHashString("LastModifiedDate");
+        static constexpr int StorageClass_HASH = HashingUtils::CompileTimeHashString("StorageClass");
+        static constexpr int ETag_HASH = HashingUtils::CompileTimeHashString("ETag");
+        static constexpr int IsMultipartUploaded_HASH = HashingUtils::CompileTimeHashString("IsMultipartUploaded");
+        static constexpr int ReplicationStatus_HASH = HashingUtils::CompileTimeHashString("ReplicationStatus");
+        static constexpr int EncryptionStatus_HASH = HashingUtils::CompileTimeHashString("EncryptionStatus");
 
 
         InventoryOptionalField GetInventoryOptionalFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Size_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InventoryOptionalField::Size;
-          }
-          else if (hashCode == LastModifiedDate_HASH)
-          {
-            return InventoryOptionalField::LastModifiedDate;
-          }
-          else if (hashCode == StorageClass_HASH)
-          {
-            return InventoryOptionalField::StorageClass;
-          }
-          else if (hashCode == ETag_HASH)
-          {
-            return InventoryOptionalField::ETag;
-          }
-          else if (hashCode == IsMultipartUploaded_HASH)
-          {
-            return InventoryOptionalField::IsMultipartUploaded;
-          }
-          else if (hashCode == ReplicationStatus_HASH)
-          {
-            return InventoryOptionalField::ReplicationStatus;
-          }
-          else if (hashCode == EncryptionStatus_HASH)
-          {
-            return InventoryOptionalField::EncryptionStatus;
+          case Size_HASH:
+            if (name == "Size")
+            {
+              return InventoryOptionalField::Size;
+            }
+            break;
+          case LastModifiedDate_HASH:
+            if (name == "LastModifiedDate")
+            {
+              return InventoryOptionalField::LastModifiedDate;
+            }
+            break;
+          case StorageClass_HASH:
+            if (name == "StorageClass")
+            {
+              return InventoryOptionalField::StorageClass;
+            }
+            break;
+          case ETag_HASH:
+            if (name == "ETag")
+            {
+              return InventoryOptionalField::ETag;
+            }
+            break;
+          case IsMultipartUploaded_HASH:
+            if (name == "IsMultipartUploaded")
+            {
+              return InventoryOptionalField::IsMultipartUploaded;
+            }
+            break;
+          case ReplicationStatus_HASH:
+            if (name == "ReplicationStatus")
+            {
+              return InventoryOptionalField::ReplicationStatus;
+            }
+            break;
+          case EncryptionStatus_HASH:
+            if (name == "EncryptionStatus")
+            {
+              return InventoryOptionalField::EncryptionStatus;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return InventoryOptionalField::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryOptionalField(InventoryOptionalField enumValue)
+        const char* GetNameForInventoryOptionalField(InventoryOptionalField enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
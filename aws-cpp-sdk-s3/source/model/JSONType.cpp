@@ -30,20 +30,30 @@ namespace Aws
       namespace JSONTypeMapper
       {
 
-        static const int DOCUMENT_HASH = HashingUtils::HashString("DOCUMENT");
-        static const int LINES_HASH = HashingUtils::HashString("LINES");
+        static constexpr int DOCUMENT_HASH = HashingUtils::CompileTimeHashString("DOCUMENT");
+        static constexpr int LINES_HASH = HashingUtils::CompileTimeHashString("LINES");
 
 
         JSONType GetJSONTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DOCUMENT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JSONType::DOCUMENT;
-          }
-          else if (hashCode == LINES_HASH)
-          {
-            return JSONType::LINES;
+          case DOCUMENT_HASH:
+            if (name == "DOCUMENT")
+            {
+              return JSONType::DOCUMENT;
+            }
+            break;
+          case LINES_HASH:
+            if (name == "LINES")
+            {
+              return JSONType::LINES;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return JSONType::NOT_SET;
         }
 
-        Aws::String GetNameForJSONType(JSONType enumValue)
+        const char* GetNameForJSONType(JSONType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
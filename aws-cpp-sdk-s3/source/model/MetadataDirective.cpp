@@ -30,20 +30,30 @@ namespace Aws
       namespace MetadataDirectiveMapper
       {
 
-        static const int COPY_HASH = HashingUtils::HashString("COPY");
-        static const int REPLACE_HASH = HashingUtils::HashString("REPLACE");
+        static constexpr int COPY_HASH = HashingUtils::CompileTimeHashString("COPY");
+        static constexpr int REPLACE_HASH = HashingUtils::CompileTimeHashString("REPLACE");
 
 
         MetadataDirective GetMetadataDirectiveForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COPY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MetadataDirective::COPY;
-          }
-          else if (hashCode == REPLACE_HASH)
-          {
-            return MetadataDirective::REPLACE;
+          case COPY_HASH:
+            if (name == "COPY")
+            {
+              return MetadataDirective::COPY;
+            }
+            break;
+          case REPLACE_HASH:
+            if (name == "REPLACE")
+            {
+              return MetadataDirective::REPLACE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MetadataDirective::NOT_SET;
         }
 
-        Aws::String GetNameForMetadataDirective(MetadataDirective enumValue)
+        const char* GetNameForMetadataDirective(MetadataDirective enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace ObjectStorageClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int REDUCED_REDUNDANCY_HASH = HashingUtils::HashString("REDUCED_REDUNDANCY");
-        static const int GLACIER_HASH = HashingUtils::HashString("GLACIER");
-        static const int STANDARD_IA_HASH = HashingUtils::HashString("STANDARD_IA");
-        static const int ONEZONE_IA_HASH = HashingUtils::HashString("ONEZONE_IA");
+        static constexpr int STANDARD_HASH = HashingUtils::CompileTimeHashString("STANDARD");
+        static constexpr int REDUCED_REDUNDANCY_HASH = HashingUtils::CompileTimeHashString("REDUCED_REDUNDANCY");
+        static constexpr int GLACIER_HASH = HashingUtils::CompileTimeHashString("GLACIER");
+        static constexpr int STANDARD_IA_HASH = HashingUtils::CompileTimeHashString("STANDARD_IA");
+        static constexpr int ONEZONE_IA_HASH = HashingUtils::CompileTimeHashString("ONEZONE_IA");
 
 
         ObjectStorageClass GetObjectStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ObjectStorageClass::STANDARD;
-          }
-          else if (hashCode == REDUCED_REDUNDANCY_HASH)
-          {
-            return ObjectStorageClass::REDUCED_REDUNDANCY;
-          }
-          else if (hashCode == GLACIER_HASH)
-          {
-            return ObjectStorageClass::GLACIER;
-          }
-          else if (hashCode == STANDARD_IA_HASH)
-          {
-            return ObjectStorageClass::STANDARD_IA;
-          }
-          else if (hashCode == ONEZONE_IA_HASH)
-          {
-            return ObjectStorageClass::ONEZONE_IA;
+          case STANDARD_HASH:
+            if (name == "STANDARD")
+            {
+              return ObjectStorageClass::STANDARD;
+            }
+            break;
+          case REDUCED_REDUNDANCY_HASH:
+            if (name == "REDUCED_REDUNDANCY")
+            {
+              return ObjectStorageClass::REDUCED_REDUNDANCY;
+            }
+            break;
+          case GLACIER_HASH:
+            if (name == "GLACIER")
+            {
+              return ObjectStorageClass::GLACIER;
+            }
+            break;
+          case STANDARD_IA_HASH:
+            if (name == "STANDARD_IA")
+            {
+              return ObjectStorageClass::STANDARD_IA;
+            }
+            break;
+          case ONEZONE_IA_HASH:
+            if (name == "ONEZONE_IA")
+            {
+              return ObjectStorageClass::ONEZONE_IA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ObjectStorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForObjectStorageClass(ObjectStorageClass enumValue)
+        const char* GetNameForObjectStorageClass(ObjectStorageClass enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ObjectVersionStorageClassMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
+        static constexpr int STANDARD_HASH = HashingUtils::CompileTimeHashString("STANDARD");
 
 
         ObjectVersionStorageClass GetObjectVersionStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ObjectVersionStorageClass::STANDARD;
+          case STANDARD_HASH:
+            if (name == "STANDARD")
+            {
+              return ObjectVersionStorageClass::STANDARD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ObjectVersionStorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForObjectVersionStorageClass(ObjectVersionStorageClass enumValue)
+        const char* GetNameForObjectVersionStorageClass(ObjectVersionStorageClass enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace OwnerOverrideMapper
       {
 
-        static const int Destination_HASH = HashingUtils::HashString("Destination");
+        static constexpr int Destination_HASH = HashingUtils::CompileTimeHashString("Destination");
 
 
         OwnerOverride GetOwnerOverrideForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Destination_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OwnerOverride::Destination;
+          case Destination_HASH:
+            if (name == "Destination")
+            {
+              return OwnerOverride::Destination;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return OwnerOverride::NOT_SET;
         }
 
-        Aws::String GetNameForOwnerOverride(OwnerOverride enumValue)
+        const char* GetNameForOwnerOverride(OwnerOverride enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PayerMapper
       {
 
-        static const int Requester_HASH = HashingUtils::HashString("Requester");
-        static const int BucketOwner_HASH = HashingUtils::HashString("BucketOwner");
+        static constexpr int Requester_HASH = HashingUtils::CompileTimeHashString("Requester");
+        static constexpr int BucketOwner_HASH = HashingUtils::CompileTimeHashString("BucketOwner");
 
 
         Payer GetPayerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Requester_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Payer::Requester;
-          }
-          else if (hashCode == BucketOwner_HASH)
-          {
-            return Payer::BucketOwner;
+          case Requester_HASH:
+            if (name == "Requester")
+            {
+              return Payer::Requester;
+            }
+            break;
+          case BucketOwner_HASH:
+            if (name == "BucketOwner")
+            {
+              return Payer::BucketOwner;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Payer::NOT_SET;
         }
 
-        Aws::String GetNameForPayer(Payer enumValue)
+        const char* GetNameForPayer(Payer enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ProtocolMapper
       {
 
-        static const int http_HASH = HashingUtils::HashString("http");
-        static const int https_HASH = HashingUtils::HashString("https");
+        static constexpr int http_HASH = HashingUtils::CompileTimeHashString("http");
+        static constexpr int https_HASH = HashingUtils::CompileTimeHashString("https");
 
 
         Protocol GetProtocolForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == http_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Protocol::http;
-          }
-          else if (hashCode == https_HASH)
-          {
-            return Protocol::https;
+          case http_HASH:
+            if (name == "http")
+            {
+              return Protocol::http;
+            }
+            break;
+          case https_HASH:
+            if (name == "https")
+            {
+              return Protocol::https;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return Protocol::NOT_SET;
         }
 
-        Aws::String GetNameForProtocol(Protocol enumValue)
+        const char* GetNameForProtocol(Protocol enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ReplicationStatusMapper
       {
 
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int REPLICA_HASH = HashingUtils::HashString("REPLICA");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int REPLICA_HASH = HashingUtils::CompileTimeHashString("REPLICA");
 
 
         ReplicationStatus GetReplicationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLETED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReplicationStatus::COMPLETED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return ReplicationStatus::PENDING;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ReplicationStatus::FAILED;
-          }
-          else if (hashCode == REPLICA_HASH)
-          {
-            return ReplicationStatus::REPLICA;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return ReplicationStatus::COMPLETED;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ReplicationStatus::PENDING;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ReplicationStatus::FAILED;
+            }
+            break;
+          case REPLICA_HASH:
+            if (name == "REPLICA")
+            {
+              return ReplicationStatus::REPLICA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ReplicationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationStatus(ReplicationStatus enumValue)
+        const char* GetNameForReplicationStatus(ReplicationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
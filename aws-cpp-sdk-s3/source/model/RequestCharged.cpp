@@ -30,15 +30,23 @@ namespace Aws
       namespace RequestChargedMapper
       {
 
-        static const int requester_HASH = HashingUtils::HashString("requester");
+        static constexpr int requester_HASH = HashingUtils::CompileTimeHashString("requester");
 
 
         RequestCharged GetRequestChargedForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == requester_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RequestCharged::requester;
+          case requester_HASH:
+            if (name == "requester")
+            {
+              return RequestCharged::requester;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return RequestCharged::NOT_SET;
         }
 
-        Aws::String GetNameForRequestCharged(RequestCharged enumValue)
+        const char* GetNameForRequestCharged(RequestCharged enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
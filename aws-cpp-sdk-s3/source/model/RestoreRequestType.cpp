@@ -30,15 +30,23 @@ namespace Aws
       namespace RestoreRequestTypeMapper
       {
 
-        static const int SELECT_HASH = HashingUtils::HashString("SELECT");
+        static constexpr int SELECT_HASH = HashingUtils::CompileTimeHashString("SELECT");
 
 
         RestoreRequestType GetRestoreRequestTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SELECT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RestoreRequestType::SELECT;
+          case SELECT_HASH:
+            if (name == "SELECT")
+            {
+              return RestoreRequestType::SELECT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return RestoreRequestType::NOT_SET;
         }
 
-        Aws::String GetNameForRestoreRequestType(RestoreRequestType enumValue)
+        const char* GetNameForRestoreRequestType(RestoreRequestType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
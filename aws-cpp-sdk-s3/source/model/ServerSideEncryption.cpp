@@ -30,20 +30,30 @@ namespace Aws
       namespace ServerSideEncryptionMapper
       {
 
-        static const int AES256_HASH = HashingUtils::HashString("AES256");
-        static const int aws_kms_HASH = HashingUtils::HashString("aws:kms");
+        static constexpr int AES256_HASH = HashingUtils::CompileTimeHashString("AES256");
+        static constexpr int aws_kms_HASH = HashingUtils::CompileTimeHashString("aws:kms");
 
 
         ServerSideEncryption GetServerSideEncryptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AES256_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServerSideEncryption::AES256;
-          }
-          else if (hashCode == aws_kms_HASH)
-          {
-            return ServerSideEncryption::aws_kms;
+          case AES256_HASH:
+            if (name == "AES256")
+            {
+              return ServerSideEncryption::AES256;
+            }
+            break;
+          case aws_kms_HASH:
+            if (name == "aws:kms")
+            {
+              return ServerSideEncryption::aws_kms;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ServerSideEncryption::NOT_SET;
         }
 
-        Aws::String GetNameForServerSideEncryption(ServerSideEncryption enumValue)
+        const char* GetNameForServerSideEncryption(ServerSideEncryption enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace StorageClassAnalysisSchemaVersionMapper
       {
 
-        static const int V_1_HASH = HashingUtils::HashString("V_1");
+        static constexpr int V_1_HASH = HashingUtils::CompileTimeHashString("V_1");
 
 
         StorageClassAnalysisSchemaVersion GetStorageClassAnalysisSchemaVersionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == V_1_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StorageClassAnalysisSchemaVersion::V_1;
+          case V_1_HASH:
+            if (name == "V_1")
+            {
+              return StorageClassAnalysisSchemaVersion::V_1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return StorageClassAnalysisSchemaVersion::NOT_SET;
         }
 
-        Aws::String GetNameForStorageClassAnalysisSchemaVersion(StorageClassAnalysisSchemaVersion enumValue)
+        const char* GetNameForStorageClassAnalysisSchemaVersion(StorageClassAnalysisSchemaVersion enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
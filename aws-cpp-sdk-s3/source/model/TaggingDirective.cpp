@@ -30,20 +30,30 @@ namespace Aws
       namespace TaggingDirectiveMapper
       {
 
-        static const int COPY_HASH = HashingUtils::HashString("COPY");
-        static const int REPLACE_HASH = HashingUtils::HashString("REPLACE");
+        static constexpr int COPY_HASH = HashingUtils::CompileTimeHashString("COPY");
+        static constexpr int REPLACE_HASH = HashingUtils::CompileTimeHashString("REPLACE");
 
 
         TaggingDirective GetTaggingDirectiveForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COPY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TaggingDirective::COPY;
-          }
-          else if (hashCode == REPLACE_HASH)
-          {
-            return TaggingDirective::REPLACE;
+          case COPY_HASH:
+            if (name == "COPY")
+            {
+              return TaggingDirective::COPY;
+            }
+            break;
+          case REPLACE_HASH:
+            if (name == "REPLACE")
+            {
+              return TaggingDirective::REPLACE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TaggingDirective::NOT_SET;
         }
 
-        Aws::String GetNameForTaggingDirective(TaggingDirective enumValue)
+        const char* GetNameForTaggingDirective(TaggingDirective enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
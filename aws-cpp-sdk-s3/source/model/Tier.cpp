@@ -30,25 +30,37 @@ namespace Aws
       namespace TierMapper
       {
 
-        static const int Standard_HASH = HashingUtils::HashString("Standard");
-        static const int Bulk_HASH = HashingUtils::HashString("Bulk");
-        static const int Expedited_HASH = HashingUtils::HashString("Expedited");
+        static constexpr int Standard_HASH = HashingUtils::CompileTimeHashString("Standard");
+        static constexpr int Bulk_HASH = HashingUtils::CompileTimeHashString("Bulk");
+        static constexpr int Expedited_HASH = HashingUtils::CompileTimeHashString("Expedited");
 
 
         Tier GetTierForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Standard_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Tier::Standard;
-          }
-          else if (hashCode == Bulk_HASH)
-          {
-            return Tier::Bulk;
-          }
-          else if (hashCode == Expedited_HASH)
-          {
-            return Tier::Expedited;
+          case Standard_HASH:
+            if (name == "Standard")
+            {
+              return Tier::Standard;
+            }
+            break;
+          case Bulk_HASH:
+            if (name == "Bulk")
+            {
+              return Tier::Bulk;
+            }
+            break;
+          case Expedited_HASH:
+            if (name == "Expedited")
+            {
+              return Tier::Expedited;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Tier::NOT_SET;
         }
 
-        Aws::String GetNameForTier(Tier enumValue)
+        const char* GetNameForTier(Tier enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
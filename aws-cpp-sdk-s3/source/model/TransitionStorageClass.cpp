@@ -30,25 +30,37 @@ namespace Aws
       namespace TransitionStorageClassMapper
       {
 
-        static const int GLACIER_HASH = HashingUtils::HashString("GLACIER");
-        static const int STANDARD_IA_HASH = HashingUtils::HashString("STANDARD_IA");
-        static const int ONEZONE_IA_HASH = HashingUtils::HashString("ONEZONE_IA");
+        static constexpr int GLACIER_HASH = HashingUtils::CompileTimeHashString("GLACIER");
+        static constexpr int STANDARD_IA_HASH = HashingUtils::CompileTimeHashString("STANDARD_IA");
+        static constexpr int ONEZONE_IA_HASH = HashingUtils::CompileTimeHashString("ONEZONE_IA");
 
 
         TransitionStorageClass GetTransitionStorageClassForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GLACIER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TransitionStorageClass::GLACIER;
-          }
-          else if (hashCode == STANDARD_IA_HASH)
-          {
-            return TransitionStorageClass::STANDARD_IA;
-          }
-          else if (hashCode == ONEZONE_IA_HASH)
-          {
-            return TransitionStorageClass::ONEZONE_IA;
+          case GLACIER_HASH:
+            if (name == "GLACIER")
+            {
+              return TransitionStorageClass::GLACIER;
+            }
+            break;
+          case STANDARD_IA_HASH:
+            if (name == "STANDARD_IA")
+            {
+              return TransitionStorageClass::STANDARD_IA;
+            }
+            break;
+          case ONEZONE_IA_HASH:
+            if (name == "ONEZONE_IA")
+            {
+              return TransitionStorageClass::ONEZONE_IA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return TransitionStorageClass::NOT_SET;
         }
 
-        Aws::String GetNameForTransitionStorageClass(TransitionStorageClass enumValue)
+        const char* GetNameForTransitionStorageClass(TransitionStorageClass enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -28,7 +28,7 @@ namespace SageMakerRuntime
 namespace SageMakerRuntimeErrorMapper
 {
 
-static const int MODEL_HASH = HashingUtils::HashString("ModelError");
+static constexpr int MODEL_HASH = HashingUtils::CompileTimeHashString("ModelError");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -34,7 +34,8 @@ namespace AssemblyTypeMapper
 {
 AWS_SAGEMAKER_API AssemblyType GetAssemblyTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForAssemblyType(AssemblyType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForAssemblyType(AssemblyType value);
 } // namespace AssemblyTypeMapper
 } // namespace Model
 } // namespace SageMaker
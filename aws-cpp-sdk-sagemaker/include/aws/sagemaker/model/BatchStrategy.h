@@ -34,7 +34,8 @@ namespace BatchStrategyMapper
 {
 AWS_SAGEMAKER_API BatchStrategy GetBatchStrategyForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForBatchStrategy(BatchStrategy value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForBatchStrategy(BatchStrategy value);
 } // namespace BatchStrategyMapper
 } // namespace Model
 } // namespace SageMaker
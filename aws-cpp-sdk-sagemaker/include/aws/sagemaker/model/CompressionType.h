@@ -34,7 +34,8 @@ namespace CompressionTypeMapper
 {
 AWS_SAGEMAKER_API CompressionType GetCompressionTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForCompressionType(CompressionType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForCompressionType(CompressionType value);
 } // namespace CompressionTypeMapper
 } // namespace Model
 } // namespace SageMaker
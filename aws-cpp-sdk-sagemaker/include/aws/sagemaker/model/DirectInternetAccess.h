@@ -34,7 +34,8 @@ namespace DirectInternetAccessMapper
 {
 AWS_SAGEMAKER_API DirectInternetAccess GetDirectInternetAccessForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForDirectInternetAccess(DirectInternetAccess value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForDirectInternetAccess(DirectInternetAccess value);
 } // namespace DirectInternetAccessMapper
 } // namespace Model
 } // namespace SageMaker
@@ -34,7 +34,8 @@ namespace EndpointConfigSortKeyMapper
 {
 AWS_SAGEMAKER_API EndpointConfigSortKey GetEndpointConfigSortKeyForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForEndpointConfigSortKey(EndpointConfigSortKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForEndpointConfigSortKey(EndpointConfigSortKey value);
 } // namespace EndpointConfigSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,7 +35,8 @@ namespace EndpointSortKeyMapper
 {
 AWS_SAGEMAKER_API EndpointSortKey GetEndpointSortKeyForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForEndpointSortKey(EndpointSortKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForEndpointSortKey(EndpointSortKey value);
 } // namespace EndpointSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
@@ -39,7 +39,8 @@ namespace EndpointStatusMapper
 {
 AWS_SAGEMAKER_API EndpointStatus GetEndpointStatusForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForEndpointStatus(EndpointStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForEndpointStatus(EndpointStatus value);
 } // namespace EndpointStatusMapper
 } // namespace Model
 } // namespace SageMaker
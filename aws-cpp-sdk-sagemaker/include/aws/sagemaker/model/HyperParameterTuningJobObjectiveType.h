@@ -34,7 +34,8 @@ namespace HyperParameterTuningJobObjectiveTypeMapper
 {
 AWS_SAGEMAKER_API HyperParameterTuningJobObjectiveType GetHyperParameterTuningJobObjectiveTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForHyperParameterTuningJobObjectiveType(HyperParameterTuningJobObjectiveType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForHyperParameterTuningJobObjectiveType(HyperParameterTuningJobObjectiveType value);
 } // namespace HyperParameterTuningJobObjectiveTypeMapper
 } // namespace Model
 } // namespace SageMaker
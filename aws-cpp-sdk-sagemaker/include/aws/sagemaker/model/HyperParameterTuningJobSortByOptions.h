@@ -35,7 +35,8 @@ namespace HyperParameterTuningJobSortByOptionsMapper
 {
 AWS_SAGEMAKER_API HyperParameterTuningJobSortByOptions GetHyperParameterTuningJobSortByOptionsForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForHyperParameterTuningJobSortByOptions(HyperParameterTuningJobSortByOptions value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForHyperParameterTuningJobSortByOptions(HyperParameterTuningJobSortByOptions value);
 } // namespace HyperParameterTuningJobSortByOptionsMapper
 } // namespace Model
 } // namespace SageMaker
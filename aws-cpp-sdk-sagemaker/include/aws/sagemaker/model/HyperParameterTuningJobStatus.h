@@ -37,7 +37,8 @@ namespace HyperParameterTuningJobStatusMapper
 {
 AWS_SAGEMAKER_API HyperParameterTuningJobStatus GetHyperParameterTuningJobStatusForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForHyperParameterTuningJobStatus(HyperParameterTuningJobStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForHyperParameterTuningJobStatus(HyperParameterTuningJobStatus value);
 } // namespace HyperParameterTuningJobStatusMapper
 } // namespace Model
 } // namespace SageMaker
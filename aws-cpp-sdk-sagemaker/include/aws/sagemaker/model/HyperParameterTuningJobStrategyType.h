@@ -33,7 +33,8 @@ namespace HyperParameterTuningJobStrategyTypeMapper
 {
 AWS_SAGEMAKER_API HyperParameterTuningJobStrategyType GetHyperParameterTuningJobStrategyTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForHyperParameterTuningJobStrategyType(HyperParameterTuningJobStrategyType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForHyperParameterTuningJobStrategyType(HyperParameterTuningJobStrategyType value);
 } // namespace HyperParameterTuningJobStrategyTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -47,7 +47,8 @@ namespace InstanceTypeMapper
 {
 AWS_SAGEMAKER_API InstanceType GetInstanceTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForInstanceType(InstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForInstanceType(InstanceType value);
 } // namespace InstanceTypeMapper
 } // namespace Model
 } // namespace SageMaker
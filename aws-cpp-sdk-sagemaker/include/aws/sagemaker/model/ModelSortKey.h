@@ -34,7 +34,8 @@ namespace ModelSortKeyMapper
 {
 AWS_SAGEMAKER_API ModelSortKey GetModelSortKeyForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForModelSortKey(ModelSortKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForModelSortKey(ModelSortKey value);
 } // namespace ModelSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
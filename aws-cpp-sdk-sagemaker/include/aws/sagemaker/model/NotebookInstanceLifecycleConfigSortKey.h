@@ -35,7 +35,8 @@ namespace NotebookInstanceLifecycleConfigSortKeyMapper
 {
 AWS_SAGEMAKER_API NotebookInstanceLifecycleConfigSortKey GetNotebookInstanceLifecycleConfigSortKeyForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceLifecycleConfigSortKey(NotebookInstanceLifecycleConfigSortKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceLifecycleConfigSortKey(NotebookInstanceLifecycleConfigSortKey value);
 } // namespace NotebookInstanceLifecycleConfigSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
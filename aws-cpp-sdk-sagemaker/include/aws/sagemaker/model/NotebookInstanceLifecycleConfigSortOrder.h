@@ -34,7 +34,8 @@ namespace NotebookInstanceLifecycleConfigSortOrderMapper
 {
 AWS_SAGEMAKER_API NotebookInstanceLifecycleConfigSortOrder GetNotebookInstanceLifecycleConfigSortOrderForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceLifecycleConfigSortOrder(NotebookInstanceLifecycleConfigSortOrder value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceLifecycleConfigSortOrder(NotebookInstanceLifecycleConfigSortOrder value);
 } // namespace NotebookInstanceLifecycleConfigSortOrderMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,7 +35,8 @@ namespace NotebookInstanceSortKeyMapper
 {
 AWS_SAGEMAKER_API NotebookInstanceSortKey GetNotebookInstanceSortKeyForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceSortKey(NotebookInstanceSortKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceSortKey(NotebookInstanceSortKey value);
 } // namespace NotebookInstanceSortKeyMapper
 } // namespace Model
 } // namespace SageMaker
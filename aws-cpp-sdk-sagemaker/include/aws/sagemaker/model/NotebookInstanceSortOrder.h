@@ -34,7 +34,8 @@ namespace NotebookInstanceSortOrderMapper
 {
 AWS_SAGEMAKER_API NotebookInstanceSortOrder GetNotebookInstanceSortOrderForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceSortOrder(NotebookInstanceSortOrder value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceSortOrder(NotebookInstanceSortOrder value);
 } // namespace NotebookInstanceSortOrderMapper
 } // namespace Model
 } // namespace SageMaker
@@ -39,7 +39,8 @@ namespace NotebookInstanceStatusMapper
 {
 AWS_SAGEMAKER_API NotebookInstanceStatus GetNotebookInstanceStatusForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForNotebookInstanceStatus(NotebookInstanceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForNotebookInstanceStatus(NotebookInstanceStatus value);
 } // namespace NotebookInstanceStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,7 +35,8 @@ namespace ObjectiveStatusMapper
 {
 AWS_SAGEMAKER_API ObjectiveStatus GetObjectiveStatusForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForObjectiveStatus(ObjectiveStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForObjectiveStatus(ObjectiveStatus value);
 } // namespace ObjectiveStatusMapper
 } // namespace Model
 } // namespace SageMaker
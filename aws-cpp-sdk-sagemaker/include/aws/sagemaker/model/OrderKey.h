@@ -34,7 +34,8 @@ namespace OrderKeyMapper
 {
 AWS_SAGEMAKER_API OrderKey GetOrderKeyForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForOrderKey(OrderKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForOrderKey(OrderKey value);
 } // namespace OrderKeyMapper
 } // namespace Model
 } // namespace SageMaker
@@ -64,7 +64,8 @@ namespace ProductionVariantInstanceTypeMapper
 {
 AWS_SAGEMAKER_API ProductionVariantInstanceType GetProductionVariantInstanceTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForProductionVariantInstanceType(ProductionVariantInstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForProductionVariantInstanceType(ProductionVariantInstanceType value);
 } // namespace ProductionVariantInstanceTypeMapper
 } // namespace Model
 } // namespace SageMaker
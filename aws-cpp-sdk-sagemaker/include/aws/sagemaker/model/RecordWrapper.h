@@ -34,7 +34,8 @@ namespace RecordWrapperMapper
 {
 AWS_SAGEMAKER_API RecordWrapper GetRecordWrapperForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForRecordWrapper(RecordWrapper value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForRecordWrapper(RecordWrapper value);
 } // namespace RecordWrapperMapper
 } // namespace Model
 } // namespace SageMaker
@@ -34,7 +34,8 @@ namespace S3DataDistributionMapper
 {
 AWS_SAGEMAKER_API S3DataDistribution GetS3DataDistributionForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForS3DataDistribution(S3DataDistribution value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForS3DataDistribution(S3DataDistribution value);
 } // namespace S3DataDistributionMapper
 } // namespace Model
 } // namespace SageMaker
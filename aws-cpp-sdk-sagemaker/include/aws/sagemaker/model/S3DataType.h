@@ -34,7 +34,8 @@ namespace S3DataTypeMapper
 {
 AWS_SAGEMAKER_API S3DataType GetS3DataTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForS3DataType(S3DataType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForS3DataType(S3DataType value);
 } // namespace S3DataTypeMapper
 } // namespace Model
 } // namespace SageMaker
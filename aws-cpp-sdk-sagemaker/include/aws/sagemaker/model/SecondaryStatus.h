@@ -44,7 +44,8 @@ namespace SecondaryStatusMapper
 {
 AWS_SAGEMAKER_API SecondaryStatus GetSecondaryStatusForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForSecondaryStatus(SecondaryStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForSecondaryStatus(SecondaryStatus value);
 } // namespace SecondaryStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,7 +35,8 @@ namespace SortByMapper
 {
 AWS_SAGEMAKER_API SortBy GetSortByForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForSortBy(SortBy value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForSortBy(SortBy value);
 } // namespace SortByMapper
 } // namespace Model
 } // namespace SageMaker
@@ -35,7 +35,8 @@ namespace SplitTypeMapper
 {
 AWS_SAGEMAKER_API SplitType GetSplitTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForSplitType(SplitType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForSplitType(SplitType value);
 } // namespace SplitTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -34,7 +34,8 @@ namespace TrainingInputModeMapper
 {
 AWS_SAGEMAKER_API TrainingInputMode GetTrainingInputModeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForTrainingInputMode(TrainingInputMode value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForTrainingInputMode(TrainingInputMode value);
 } // namespace TrainingInputModeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -58,7 +58,8 @@ namespace TrainingInstanceTypeMapper
 {
 AWS_SAGEMAKER_API TrainingInstanceType GetTrainingInstanceTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForTrainingInstanceType(TrainingInstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForTrainingInstanceType(TrainingInstanceType value);
 } // namespace TrainingInstanceTypeMapper
 } // namespace Model
 } // namespace SageMaker
@@ -36,7 +36,8 @@ namespace TrainingJobSortByOptionsMapper
 {
 AWS_SAGEMAKER_API TrainingJobSortByOptions GetTrainingJobSortByOptionsForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForTrainingJobSortByOptions(TrainingJobSortByOptions value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForTrainingJobSortByOptions(TrainingJobSortByOptions value);
 } // namespace TrainingJobSortByOptionsMapper
 } // namespace Model
 } // namespace SageMaker
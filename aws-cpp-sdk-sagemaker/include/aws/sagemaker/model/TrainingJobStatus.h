@@ -37,7 +37,8 @@ namespace TrainingJobStatusMapper
 {
 AWS_SAGEMAKER_API TrainingJobStatus GetTrainingJobStatusForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForTrainingJobStatus(TrainingJobStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForTrainingJobStatus(TrainingJobStatus value);
 } // namespace TrainingJobStatusMapper
 } // namespace Model
 } // namespace SageMaker
@@ -58,7 +58,8 @@ namespace TransformInstanceTypeMapper
 {
 AWS_SAGEMAKER_API TransformInstanceType GetTransformInstanceTypeForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForTransformInstanceType(TransformInstanceType value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForTransformInstanceType(TransformInstanceType value);
 } // namespace TransformInstanceTypeMapper
 } // namespace Model
 } // namespace SageMaker
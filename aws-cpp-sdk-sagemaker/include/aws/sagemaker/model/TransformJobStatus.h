@@ -37,7 +37,8 @@ namespace TransformJobStatusMapper
 {
 AWS_SAGEMAKER_API TransformJobStatus GetTransformJobStatusForName(const Aws::String& name);
 
-AWS_SAGEMAKER_API Aws::String GetNameForTransformJobStatus(TransformJobStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SAGEMAKER_API const char* GetNameForTransformJobStatus(TransformJobStatus value);
 } // namespace TransformJobStatusMapper
 } // namespace Model
 } // namespace SageMaker
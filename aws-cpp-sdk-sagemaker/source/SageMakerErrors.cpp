@@ -28,8 +28,8 @@ namespace SageMaker
 namespace SageMakerErrorMapper
 {
 
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUse");
-static const int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ResourceLimitExceeded");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUse");
+static constexpr int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceLimitExceeded");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace AssemblyTypeMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int Line_HASH = HashingUtils::HashString("Line");
+        static constexpr int None_HASH = HashingUtils::CompileTimeHashString("None");
+        static constexpr int Line_HASH = HashingUtils::CompileTimeHashString("Line");
 
 
         AssemblyType GetAssemblyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssemblyType::None;
-          }
-          else if (hashCode == Line_HASH)
-          {
-            return AssemblyType::Line;
+          case None_HASH:
+            if (name == "None")
+            {
+              return AssemblyType::None;
+            }
+            break;
+          case Line_HASH:
+            if (name == "Line")
+            {
+              return AssemblyType::Line;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AssemblyType::NOT_SET;
         }
 
-        Aws::String GetNameForAssemblyType(AssemblyType enumValue)
+        const char* GetNameForAssemblyType(AssemblyType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
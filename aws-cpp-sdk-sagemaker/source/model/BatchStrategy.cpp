@@ -30,20 +30,30 @@ namespace Aws
       namespace BatchStrategyMapper
       {
 
-        static const int MultiRecord_HASH = HashingUtils::HashString("MultiRecord");
-        static const int SingleRecord_HASH = HashingUtils::HashString("SingleRecord");
+        static constexpr int MultiRecord_HASH = HashingUtils::CompileTimeHashString("MultiRecord");
+        static constexpr int SingleRecord_HASH = HashingUtils::CompileTimeHashString("SingleRecord");
 
 
         BatchStrategy GetBatchStrategyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MultiRecord_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BatchStrategy::MultiRecord;
-          }
-          else if (hashCode == SingleRecord_HASH)
-          {
-            return BatchStrategy::SingleRecord;
+          case MultiRecord_HASH:
+            if (name == "MultiRecord")
+            {
+              return BatchStrategy::MultiRecord;
+            }
+            break;
+          case SingleRecord_HASH:
+            if (name == "SingleRecord")
+            {
+              return BatchStrategy::SingleRecord;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BatchStrategy::NOT_SET;
         }
 
-        Aws::String GetNameForBatchStrategy(BatchStrategy enumValue)
+        const char* GetNameForBatchStrategy(BatchStrategy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
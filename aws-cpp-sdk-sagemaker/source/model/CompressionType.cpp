@@ -30,20 +30,30 @@ namespace Aws
       namespace CompressionTypeMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int Gzip_HASH = HashingUtils::HashString("Gzip");
+        static constexpr int None_HASH = HashingUtils::CompileTimeHashString("None");
+        static constexpr int Gzip_HASH = HashingUtils::CompileTimeHashString("Gzip");
 
 
         CompressionType GetCompressionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CompressionType::None;
-          }
-          else if (hashCode == Gzip_HASH)
-          {
-            return CompressionType::Gzip;
+          case None_HASH:
+            if (name == "None")
+            {
+              return CompressionType::None;
+            }
+            break;
+          case Gzip_HASH:
+            if (name == "Gzip")
+            {
+              return CompressionType::Gzip;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CompressionType::NOT_SET;
         }
 
-        Aws::String GetNameForCompressionType(CompressionType enumValue)
+        const char* GetNameForCompressionType(CompressionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
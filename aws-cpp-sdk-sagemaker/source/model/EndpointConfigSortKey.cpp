@@ -30,20 +30,30 @@ namespace Aws
       namespace EndpointConfigSortKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int CreationTime_HASH = HashingUtils::CompileTimeHashString("CreationTime");
 
 
         EndpointConfigSortKey GetEndpointConfigSortKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EndpointConfigSortKey::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
-          {
-            return EndpointConfigSortKey::CreationTime;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return EndpointConfigSortKey::Name;
+            }
+            break;
+          case CreationTime_HASH:
+            if (name == "CreationTime")
+            {
+              return EndpointConfigSortKey::CreationTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EndpointConfigSortKey::NOT_SET;
         }
 
-        Aws::String GetNameForEndpointConfigSortKey(EndpointConfigSortKey enumValue)
+        const char* GetNameForEndpointConfigSortKey(EndpointConfigSortKey enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace EndpointStatusMapper
       {
 
-        static const int OutOfService_HASH = HashingUtils::HashString("OutOfService");
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
-        static const int RollingBack_HASH = HashingUtils::HashString("RollingBack");
-        static const int InService_HASH = HashingUtils::HashString("InService");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int OutOfService_HASH = HashingUtils::CompileTimeHashString("OutOfService");
+        static constexpr int Creating_HASH = HashingUtils::CompileTimeHashString("Creating");
+        static constexpr int Updating_HASH = HashingUtils::CompileTimeHashString("Updating");
+        static constexpr int RollingBack_HASH = HashingUtils::CompileTimeHashString("RollingBack");
+        static constexpr int InService_HASH = HashingUtils::CompileTimeHashString("InService");
+        static constexpr int Deleting_HASH = HashingUtils::CompileTimeHashString("Deleting");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         EndpointStatus GetEndpointStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OutOfService_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EndpointStatus::OutOfService;
-          }
-          else if (hashCode == Creating_HASH)
-          {
-            return EndpointStatus::Creating;
-          }
-          else if (hashCode == Updating_HASH)
-          {
-            return EndpointStatus::Updating;
-          }
-          else if (hashCode == RollingBack_HASH)
-          {
-            return EndpointStatus::RollingBack;
-          }
-          else if (hashCode == InService_HASH)
-          {
-            return EndpointStatus::InService;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return EndpointStatus::Deleting;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return EndpointStatus::Failed;
+          case OutOfService_HASH:
+            if (name == "OutOfService")
+            {
+              return EndpointStatus::OutOfService;
+            }
+            break;
+          case Creating_HASH:
+            if (name == "Creating")
+            {
+              return EndpointStatus::Creating;
+            }
+            break;
+          case Updating_HASH:
+            if (name == "Updating")
+            {
+              return EndpointStatus::Updating;
+            }
+            break;
+          case RollingBack_HASH:
+            if (name == "RollingBack")
+            {
+              return EndpointStatus::RollingBack;
+            }
+            break;
+          case InService_HASH:
+            if (name == "InService")
+            {
+              return EndpointStatus::InService;
+            }
+            break;
+          case Deleting_HASH:
+            if (name == "Deleting")
+            {
+              return EndpointStatus::Deleting;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return EndpointStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return EndpointStatus::NOT_SET;
         }
 
-        Aws::String GetNameForEndpointStatus(EndpointStatus enumValue)
+        const char* GetNameForEndpointStatus(EndpointStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace HyperParameterTuningJobObjectiveTypeMapper
       {
 
-        static const int Maximize_HASH = HashingUtils::HashString("Maximize");
-        static const int Minimize_HASH = HashingUtils::HashString("Minimize");
+        static constexpr int Maximize_HASH = HashingUtils::CompileTimeHashString("Maximize");
+        static constexpr int Minimize_HASH = HashingUtils::CompileTimeHashString("Minimize");
 
 
         HyperParameterTuningJobObjectiveType GetHyperParameterTuningJobObjectiveTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Maximize_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HyperParameterTuningJobObjectiveType::Maximize;
-          }
-          else if (hashCode == Minimize_HASH)
-          {
-            return HyperParameterTuningJobObjectiveType::Minimize;
+          case Maximize_HASH:
+            if (name == "Maximize")
+            {
+              return HyperParameterTuningJobObjectiveType::Maximize;
+            }
+            break;
+          case Minimize_HASH:
+            if (name == "Minimize")
+            {
+              return HyperParameterTuningJobObjectiveType::Minimize;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return HyperParameterTuningJobObjectiveType::NOT_SET;
         }
 
-        Aws::String GetNameForHyperParameterTuningJobObjectiveType(HyperParameterTuningJobObjectiveType enumValue)
+        const char* GetNameForHyperParameterTuningJobObjectiveType(HyperParameterTuningJobObjectiveType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
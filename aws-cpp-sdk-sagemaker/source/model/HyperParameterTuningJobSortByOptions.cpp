@@ -30,25 +30,37 @@ namespace Aws
       namespace HyperParameterTuningJobSortByOptionsMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
+        static constexpr int CreationTime_HASH = HashingUtils::CompileTimeHashString("CreationTime");
 
 
         HyperParameterTuningJobSortByOptions GetHyperParameterTuningJobSortByOptionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HyperParameterTuningJobSortByOptions::Name;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return HyperParameterTuningJobSortByOptions::Status;
-          }
-          else if (hashCode == CreationTime_HASH)
-          {
-            return HyperParameterTuningJobSortByOptions::CreationTime;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return HyperParameterTuningJobSortByOptions::Name;
+            }
+            break;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return HyperParameterTuningJobSortByOptions::Status;
+            }
+            break;
+          case CreationTime_HASH:
+            if (name == "CreationTime")
+            {
+              return HyperParameterTuningJobSortByOptions::CreationTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return HyperParameterTuningJobSortByOptions::NOT_SET;
         }
 
-        Aws::String GetNameForHyperParameterTuningJobSortByOptions(HyperParameterTuningJobSortByOptions enumValue)
+        const char* GetNameForHyperParameterTuningJobSortByOptions(HyperParameterTuningJobSortByOptions enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
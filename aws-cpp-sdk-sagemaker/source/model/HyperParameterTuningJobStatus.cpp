@@ -30,35 +30,51 @@ namespace Aws
       namespace HyperParameterTuningJobStatusMapper
       {
 
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
+        static constexpr int Completed_HASH = HashingUtils::CompileTimeHashString("Completed");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Stopped_HASH = HashingUtils::CompileTimeHashString("Stopped");
+        static constexpr int Stopping_HASH = HashingUtils::CompileTimeHashString("Stopping");
 
 
         HyperParameterTuningJobStatus GetHyperParameterTuningJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Completed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HyperParameterTuningJobStatus::Completed;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return HyperParameterTuningJobStatus::InProgress;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return HyperParameterTuningJobStatus::Failed;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return HyperParameterTuningJobStatus::Stopped;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return HyperParameterTuningJobStatus::Stopping;
+          case Completed_HASH:
+            if (name == "Completed")
+            {
+              return HyperParameterTuningJobStatus::Completed;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return HyperParameterTuningJobStatus::InProgress;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return HyperParameterTuningJobStatus::Failed;
+            }
+            break;
+          case Stopped_HASH:
+            if (name == "Stopped")
+            {
+              return HyperParameterTuningJobStatus::Stopped;
+            }
+            break;
+          case Stopping_HASH:
+            if (name == "Stopping")
+            {
+              return HyperParameterTuningJobStatus::Stopping;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return HyperParameterTuningJobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForHyperParameterTuningJobStatus(HyperParameterTuningJobStatus enumValue)
+        const char* GetNameForHyperParameterTuningJobStatus(HyperParameterTuningJobStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace HyperParameterTuningJobStrategyTypeMapper
       {
 
-        static const int Bayesian_HASH = HashingUtils::HashString("Bayesian");
+        static constexpr int Bayesian_HASH = HashingUtils::CompileTimeHashString("Bayesian");
 
 
         HyperParameterTuningJobStrategyType GetHyperParameterTuningJobStrategyTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Bayesian_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HyperParameterTuningJobStrategyType::Bayesian;
+          case Bayesian_HASH:
+            if (name == "Bayesian")
+            {
+              return HyperParameterTuningJobStrategyType::Bayesian;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return HyperParameterTuningJobStrategyType::NOT_SET;
         }
 
-        Aws::String GetNameForHyperParameterTuningJobStrategyType(HyperParameterTuningJobStrategyType enumValue)
+        const char* GetNameForHyperParameterTuningJobStrategyType(HyperParameterTuningJobStrategyType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,85 +30,121 @@ namespace Aws
       namespace InstanceTypeMapper
       {
 
-        static const int ml_t2_medium_HASH = HashingUtils::HashString("ml.t2.medium");
-        static const int ml_t2_large_HASH = HashingUtils::HashString("ml.t2.large");
-        static const int ml_t2_xlarge_HASH = HashingUtils::HashString("ml.t2.xlarge");
-        static const int ml_t2_2xlarge_HASH = HashingUtils::HashString("ml.t2.2xlarge");
-        static const int ml_m4_xlarge_HASH = HashingUtils::HashString("ml.m4.xlarge");
-        static const int ml_m4_2xlarge_HASH = HashingUtils::HashString("ml.m4.2xlarge");
-        static const int ml_m4_4xlarge_HASH = HashingUtils::HashString("ml.m4.4xlarge");
-        static const int ml_m4_10xlarge_HASH = HashingUtils::HashString("ml.m4.10xlarge");
-        static const int ml_m4_16xlarge_HASH = HashingUtils::HashString("ml.m4.16xlarge");
-        static const int ml_p2_xlarge_HASH = HashingUtils::HashString("ml.p2.xlarge");
-        static const int ml_p2_8xlarge_HASH = HashingUtils::HashString("ml.p2.8xlarge");
-        static const int ml_p2_16xlarge_HASH = HashingUtils::HashString("ml.p2.16xlarge");
-        static const int ml_p3_2xlarge_HASH = HashingUtils::HashString("ml.p3.2xlarge");
-        static const int ml_p3_8xlarge_HASH = HashingUtils::HashString("ml.p3.8xlarge");
-        static const int ml_p3_16xlarge_HASH = HashingUtils::HashString("ml.p3.16xlarge");
+        static constexpr int ml_t2_medium_HASH = HashingUtils::CompileTimeHashString("ml.t2.medium");
+        static constexpr int ml_t2_large_HASH = HashingUtils::CompileTimeHashString("ml.t2.large");
+        static constexpr int ml_t2_xlarge_HASH = HashingUtils::CompileTimeHashString("ml.t2.xlarge");
+        static constexpr int ml_t2_2xlarge_HASH = HashingUtils::CompileTimeHashString("ml.t2.2xlarge");
+        static constexpr int ml_m4_xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.xlarge");
+        static constexpr int ml_m4_2xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.2xlarge");
+        static constexpr int ml_m4_4xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.4xlarge");
+        static constexpr int ml_m4_10xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.10xlarge");
+        static constexpr int ml_m4_16xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.16xlarge");
+        static constexpr int ml_p2_xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p2.xlarge");
+        static constexpr int ml_p2_8xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p2.8xlarge");
+        static constexpr int ml_p2_16xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p2.16xlarge");
+        static constexpr int ml_p3_2xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p3.2xlarge");
+        static constexpr int ml_p3_8xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p3.8xlarge");
+        static constexpr int ml_p3_16xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p3.16xlarge");
 
 
         InstanceType GetInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ml_t2_medium_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceType::ml_t2_medium;
-          }
-          else if (hashCode == ml_t2_large_HASH)
-          {
-            return InstanceType::ml_t2_large;
-          }
-          else if (hashCode == ml_t2_xlarge_HASH)
-          {
-            return InstanceType::ml_t2_xlarge;
-          }
-          else if (hashCode == ml_t2_2xlarge_HASH)
-          {
-            return InstanceType::ml_t2_2xlarge;
-          }
-          else if (hashCode == ml_m4_xlarge_HASH)
-          {
-            return InstanceType::ml_m4_xlarge;
-          }
-          else if (hashCode == ml_m4_2xlarge_HASH)
-          {
-            return InstanceType::ml_m4_2xlarge;
-          }
-          else if (hashCode == ml_m4_4xlarge_HASH)
-          {
-            return InstanceType::ml_m4_4xlarge;
-          }
-          else if (hashCode == ml_m4_10xlarge_HASH)
-          {
-            return InstanceType::ml_m4_10xlarge;
-          }
-          else if (hashCode == ml_m4_16xlarge_HASH)
-          {
-            return InstanceType::ml_m4_16xlarge;
-          }
-          else if (hashCode == ml_p2_xlarge_HASH)
-          {
-            return InstanceType::ml_p2_xlarge;
-          }
-          else if (hashCode == ml_p2_8xlarge_HASH)
-          {
-            return InstanceType::ml_p2_8xlarge;
-          }
-          else if (hashCode == ml_p2_16xlarge_HASH)
-          {
-            return InstanceType::ml_p2_16xlarge;
-          }
-          else if (hashCode == ml_p3_2xlarge_HASH)
-          {
-            return InstanceType::ml_p3_2xlarge;
-          }
-          else if (hashCode == ml_p3_8xlarge_HASH)
-          {
-            return InstanceType::ml_p3_8xlarge;
-          }
-          else if (hashCode == ml_p3_16xlarge_HASH)
-          {
-            return InstanceType::ml_p3_16xlarge;
+          case ml_t2_medium_HASH:
+            if (name == "ml.t2.medium")
+            {
+              return InstanceType::ml_t2_medium;
+            }
+            break;
+          case ml_t2_large_HASH:
+            if (name == "ml.t2.large")
+            {
+              return InstanceType::ml_t2_large;
+            }
+            break;
+          case ml_t2_xlarge_HASH:
+            if (name == "ml.t2.xlarge")
+            {
+              return InstanceType::ml_t2_xlarge;
+            }
+            break;
+          case ml_t2_2xlarge_HASH:
+            if (name == "ml.t2.2xlarge")
+            {
+              return InstanceType::ml_t2_2xlarge;
+            }
+            break;
+          case ml_m4_xlarge_HASH:
+            if (name == "ml.m4.xlarge")
+            {
+              return InstanceType::ml_m4_xlarge;
+            }
+            break;
+          case ml_m4_2xlarge_HASH:
+            if (name == "ml.m4.2xlarge")
+            {
+              return InstanceType::ml_m4_2xlarge;
+            }
+            break;
+          case ml_m4_4xlarge_HASH:
+            if (name == "ml.m4.4xlarge")
+            {
+              return InstanceType::ml_m4_4xlarge;
+            }
+            break;
+          case ml_m4_10xlarge_HASH:
+            if (name == "ml.m4.10xlarge")
+            {
+              return InstanceType::ml_m4_10xlarge;
+            }
+            break;
+          case ml_m4_16xlarge_HASH:
+            if (name == "ml.m4.16xlarge")
+            {
+              return InstanceType::ml_m4_16xlarge;
+            }
+            break;
+          case ml_p2_xlarge_HASH:
+            if (name == "ml.p2.xlarge")
+            {
+              return InstanceType::ml_p2_xlarge;
+            }
+            break;
+          case ml_p2_8xlarge_HASH:
+            if (name == "ml.p2.8xlarge")
+            {
+              return InstanceType::ml_p2_8xlarge;
+            }
+            break;
+          case ml_p2_16xlarge_HASH:
+            if (name == "ml.p2.16xlarge")
+            {
+              return InstanceType::ml_p2_16xlarge;
+            }
+            break;
+          case ml_p3_2xlarge_HASH:
+            if (name == "ml.p3.2xlarge")
+            {
+              return InstanceType::ml_p3_2xlarge;
+            }
+            break;
+          case ml_p3_8xlarge_HASH:
+            if (name == "ml.p3.8xlarge")
+            {
+              return InstanceType::ml_p3_8xlarge;
+            }
+            break;
+          case ml_p3_16xlarge_HASH:
+            if (name == "ml.p3.16xlarge")
+            {
+              return InstanceType::ml_p3_16xlarge;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -120,7 +156,7 @@ namespace Aws
           return InstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceType(InstanceType enumValue)
+        const char* GetNameForInstanceType(InstanceType enumValue)
         {
           switch(enumValue)
           {
@@ -158,7 +194,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace NotebookInstanceLifecycleConfigSortKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-        static const int LastModifiedTime_HASH = HashingUtils::HashString("LastModifiedTime");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int CreationTime_HASH = HashingUtils::CompileTimeHashString("CreationTime");
+        static constexpr int LastModifiedTime_HASH = HashingUtils::CompileTimeHashString("LastModifiedTime");
 
 
         NotebookInstanceLifecycleConfigSortKey GetNotebookInstanceLifecycleConfigSortKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotebookInstanceLifecycleConfigSortKey::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
-          {
-            return NotebookInstanceLifecycleConfigSortKey::CreationTime;
-          }
-          else if (hashCode == LastModifiedTime_HASH)
-          {
-            return NotebookInstanceLifecycleConfigSortKey::LastModifiedTime;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return NotebookInstanceLifecycleConfigSortKey::Name;
+            }
+            break;
+          case CreationTime_HASH:
+            if (name == "CreationTime")
+            {
+              return NotebookInstanceLifecycleConfigSortKey::CreationTime;
+            }
+            break;
+          case LastModifiedTime_HASH:
+            if (name == "LastModifiedTime")
+            {
+              return NotebookInstanceLifecycleConfigSortKey::LastModifiedTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return NotebookInstanceLifecycleConfigSortKey::NOT_SET;
         }
 
-        Aws::String GetNameForNotebookInstanceLifecycleConfigSortKey(NotebookInstanceLifecycleConfigSortKey enumValue)
+        const char* GetNameForNotebookInstanceLifecycleConfigSortKey(NotebookInstanceLifecycleConfigSortKey enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace NotebookInstanceSortKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-        static const int Status_HASH = HashingUtils::HashString("Status");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int CreationTime_HASH = HashingUtils::CompileTimeHashString("CreationTime");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
 
 
         NotebookInstanceSortKey GetNotebookInstanceSortKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotebookInstanceSortKey::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
-          {
-            return NotebookInstanceSortKey::CreationTime;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return NotebookInstanceSortKey::Status;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return NotebookInstanceSortKey::Name;
+            }
+            break;
+          case CreationTime_HASH:
+            if (name == "CreationTime")
+            {
+              return NotebookInstanceSortKey::CreationTime;
+            }
+            break;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return NotebookInstanceSortKey::Status;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return NotebookInstanceSortKey::NOT_SET;
         }
 
-        Aws::String GetNameForNotebookInstanceSortKey(NotebookInstanceSortKey enumValue)
+        const char* GetNameForNotebookInstanceSortKey(NotebookInstanceSortKey enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
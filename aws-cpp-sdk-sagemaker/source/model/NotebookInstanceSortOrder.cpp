@@ -30,20 +30,30 @@ namespace Aws
       namespace NotebookInstanceSortOrderMapper
       {
 
-        static const int Ascending_HASH = HashingUtils::HashString("Ascending");
-        static const int Descending_HASH = HashingUtils::HashString("Descending");
+        static constexpr int Ascending_HASH = HashingUtils::CompileTimeHashString("Ascending");
+        static constexpr int Descending_HASH = HashingUtils::CompileTimeHashString("Descending");
 
 
         NotebookInstanceSortOrder GetNotebookInstanceSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Ascending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotebookInstanceSortOrder::Ascending;
-          }
-          else if (hashCode == Descending_HASH)
-          {
-            return NotebookInstanceSortOrder::Descending;
+          case Ascending_HASH:
+            if (name == "Ascending")
+            {
+              return NotebookInstanceSortOrder::Ascending;
+            }
+            break;
+          case Descending_HASH:
+            if (name == "Descending")
+            {
+              return NotebookInstanceSortOrder::Descending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return NotebookInstanceSortOrder::NOT_SET;
         }
 
-        Aws::String GetNameForNotebookInstanceSortOrder(NotebookInstanceSortOrder enumValue)
+        const char* GetNameForNotebookInstanceSortOrder(NotebookInstanceSortOrder enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
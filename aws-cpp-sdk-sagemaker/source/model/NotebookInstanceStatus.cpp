@@ -30,45 +30,65 @@ namespace Aws
       namespace NotebookInstanceStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InService_HASH = HashingUtils::HashString("InService");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InService_HASH = HashingUtils::CompileTimeHashString("InService");
+        static constexpr int Stopping_HASH = HashingUtils::CompileTimeHashString("Stopping");
+        static constexpr int Stopped_HASH = HashingUtils::CompileTimeHashString("Stopped");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Deleting_HASH = HashingUtils::CompileTimeHashString("Deleting");
+        static constexpr int Updating_HASH = HashingUtils::CompileTimeHashString("Updating");
 
 
         NotebookInstanceStatus GetNotebookInstanceStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotebookInstanceStatus::Pending;
-          }
-          else if (hashCode == InService_HASH)
-          {
-            return NotebookInstanceStatus::InService;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return NotebookInstanceStatus::Stopping;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return NotebookInstanceStatus::Stopped;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return NotebookInstanceStatus::Failed;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return NotebookInstanceStatus::Deleting;
-          }
-          else if (hashCode == Updating_HASH)
-          {
-            return NotebookInstanceStatus::Updating;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return NotebookInstanceStatus::Pending;
+            }
+            break;
+          case InService_HASH:
+            if (name == "InService")
+            {
+              return NotebookInstanceStatus::InService;
+            }
+            break;
+          case Stopping_HASH:
+            if (name == "Stopping")
+            {
+              return NotebookInstanceStatus::Stopping;
+            }
+            break;
+          case Stopped_HASH:
+            if (name == "Stopped")
+            {
+              return NotebookInstanceStatus::Stopped;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return NotebookInstanceStatus::Failed;
+            }
+            break;
+          case Deleting_HASH:
+            if (name == "Deleting")
+            {
+              return NotebookInstanceStatus::Deleting;
+            }
+            break;
+          case Updating_HASH:
+            if (name == "Updating")
+            {
+              return NotebookInstanceStatus::Updating;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return NotebookInstanceStatus::NOT_SET;
         }
 
-        Aws::String GetNameForNotebookInstanceStatus(NotebookInstanceStatus enumValue)
+        const char* GetNameForNotebookInstanceStatus(NotebookInstanceStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ObjectiveStatusMapper
       {
 
-        static const int Succeeded_HASH = HashingUtils::HashString("Succeeded");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Succeeded_HASH = HashingUtils::CompileTimeHashString("Succeeded");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         ObjectiveStatus GetObjectiveStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Succeeded_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ObjectiveStatus::Succeeded;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return ObjectiveStatus::Pending;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return ObjectiveStatus::Failed;
+          case Succeeded_HASH:
+            if (name == "Succeeded")
+            {
+              return ObjectiveStatus::Succeeded;
+            }
+            break;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return ObjectiveStatus::Pending;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return ObjectiveStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ObjectiveStatus::NOT_SET;
         }
 
-        Aws::String GetNameForObjectiveStatus(ObjectiveStatus enumValue)
+        const char* GetNameForObjectiveStatus(ObjectiveStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
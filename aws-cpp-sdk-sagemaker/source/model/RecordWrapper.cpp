@@ -30,20 +30,30 @@ namespace Aws
       namespace RecordWrapperMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int RecordIO_HASH = HashingUtils::HashString("RecordIO");
+        static constexpr int None_HASH = HashingUtils::CompileTimeHashString("None");
+        static constexpr int RecordIO_HASH = HashingUtils::CompileTimeHashString("RecordIO");
 
 
         RecordWrapper GetRecordWrapperForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RecordWrapper::None;
-          }
-          else if (hashCode == RecordIO_HASH)
-          {
-            return RecordWrapper::RecordIO;
+          case None_HASH:
+            if (name == "None")
+            {
+              return RecordWrapper::None;
+            }
+            break;
+          case RecordIO_HASH:
+            if (name == "RecordIO")
+            {
+              return RecordWrapper::RecordIO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RecordWrapper::NOT_SET;
         }
 
-        Aws::String GetNameForRecordWrapper(RecordWrapper enumValue)
+        const char* GetNameForRecordWrapper(RecordWrapper enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
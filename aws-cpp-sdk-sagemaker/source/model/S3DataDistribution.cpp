@@ -30,20 +30,30 @@ namespace Aws
       namespace S3DataDistributionMapper
       {
 
-        static const int FullyReplicated_HASH = HashingUtils::HashString("FullyReplicated");
-        static const int ShardedByS3Key_HASH = HashingUtils::HashString("ShardedByS3Key");
+        static constexpr int FullyReplicated_HASH = HashingUtils::CompileTimeHashString("FullyReplicated");
+        static constexpr int ShardedByS3Key_HASH = HashingUtils::CompileTimeHashString("ShardedByS3Key");
 
 
         S3DataDistribution GetS3DataDistributionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FullyReplicated_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return S3DataDistribution::FullyReplicated;
-          }
-          else if (hashCode == ShardedByS3Key_HASH)
-          {
-            return S3DataDistribution::ShardedByS3Key;
+          case FullyReplicated_HASH:
+            if (name == "FullyReplicated")
+            {
+              return S3DataDistribution::FullyReplicated;
+            }
+            break;
+          case ShardedByS3Key_HASH:
+            if (name == "ShardedByS3Key")
+            {
+              return S3DataDistribution::ShardedByS3Key;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return S3DataDistribution::NOT_SET;
         }
 
-        Aws::String GetNameForS3DataDistribution(S3DataDistribution enumValue)
+        const char* GetNameForS3DataDistribution(S3DataDistribution enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace S3DataTypeMapper
       {
 
-        static const int ManifestFile_HASH = HashingUtils::HashString("ManifestFile");
-        static const int S3Prefix_HASH = HashingUtils::HashString("S3Prefix");
+        static constexpr int ManifestFile_HASH = HashingUtils::CompileTimeHashString("ManifestFile");
+        static constexpr int S3Prefix_HASH = HashingUtils::CompileTimeHashString("S3Prefix");
 
 
         S3DataType GetS3DataTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ManifestFile_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return S3DataType::ManifestFile;
-          }
-          else if (hashCode == S3Prefix_HASH)
-          {
-            return S3DataType::S3Prefix;
+          case ManifestFile_HASH:
+            if (name == "ManifestFile")
+            {
+              return S3DataType::ManifestFile;
+            }
+            break;
+          case S3Prefix_HASH:
+            if (name == "S3Prefix")
+            {
+              return S3DataType::S3Prefix;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return S3DataType::NOT_SET;
         }
 
-        Aws::String GetNameForS3DataType(S3DataType enumValue)
+        const char* GetNameForS3DataType(S3DataType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,70 +30,100 @@ namespace Aws
       namespace SecondaryStatusMapper
       {
 
-        static const int Starting_HASH = HashingUtils::HashString("Starting");
-        static const int LaunchingMLInstances_HASH = HashingUtils::HashString("LaunchingMLInstances");
-        static const int PreparingTrainingStack_HASH = HashingUtils::HashString("PreparingTrainingStack");
-        static const int Downloading_HASH = HashingUtils::HashString("Downloading");
-        static const int DownloadingTrainingImage_HASH = HashingUtils::HashString("DownloadingTrainingImage");
-        static const int Training_HASH = HashingUtils::HashString("Training");
-        static const int Uploading_HASH = HashingUtils::HashString("Uploading");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
-        static const int MaxRuntimeExceeded_HASH = HashingUtils::HashString("MaxRuntimeExceeded");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Starting_HASH = HashingUtils::CompileTimeHashString("Starting");
+        static constexpr int LaunchingMLInstances_HASH = HashingUtils::CompileTimeHashString("LaunchingMLInstances");
+        static constexpr int PreparingTrainingStack_HASH = HashingUtils::CompileTimeHashString("PreparingTrainingStack");
+        static constexpr int Downloading_HASH = HashingUtils::CompileTimeHashString("Downloading");
+        static constexpr int DownloadingTrainingImage_HASH = HashingUtils::CompileTimeHashString("DownloadingTrainingImage");
+        static constexpr int Training_HASH = HashingUtils::CompileTimeHashString("Training");
+        static constexpr int Uploading_HASH = HashingUtils::CompileTimeHashString("Uploading");
+        static constexpr int Stopping_HASH = HashingUtils::CompileTimeHashString("Stopping");
+        static constexpr int Stopped_HASH = HashingUtils::CompileTimeHashString("Stopped");
+        static constexpr int MaxRuntimeExceeded_HASH = HashingUtils::CompileTimeHashString("MaxRuntimeExceeded");
+        static constexpr int Completed_HASH = HashingUtils::CompileTimeHashString("Completed");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         SecondaryStatus GetSecondaryStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Starting_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SecondaryStatus::Starting;
-          }
-          else if (hashCode == LaunchingMLInstances_HASH)
-          {
-            return SecondaryStatus::LaunchingMLInstances;
-          }
-          else if (hashCode == PreparingTrainingStack_HASH)
-          {
-            return SecondaryStatus::PreparingTrainingStack;
-          }
-          else if (hashCode == Downloading_HASH)
-          {
-            return SecondaryStatus::Downloading;
-          }
-          else if (hashCode == DownloadingTrainingImage_HASH)
-          {
-            return SecondaryStatus::DownloadingTrainingImage;
-          }
-          else if (hashCode == Training_HASH)
-          {
-            return SecondaryStatus::Training;
-          }
-          else if (hashCode == Uploading_HASH)
-          {
-            return SecondaryStatus::Uploading;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return SecondaryStatus::Stopping;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return SecondaryStatus::Stopped;
-          }
-          else if (hashCode == MaxRuntimeExceeded_HASH)
-          {
-            return SecondaryStatus::MaxRuntimeExceeded;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return SecondaryStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return SecondaryStatus::Failed;
+          case Starting_HASH:
+            if (name == "Starting")
+            {
+              return SecondaryStatus::Starting;
+            }
+            break;
+          case LaunchingMLInstances_HASH:
+            if (name == "LaunchingMLInstances")
+            {
+              return SecondaryStatus::LaunchingMLInstances;
+            }
+            break;
+          case PreparingTrainingStack_HASH:
+            if (name == "PreparingTrainingStack")
+            {
+              return SecondaryStatus::PreparingTrainingStack;
+            }
+            break;
+          case Downloading_HASH:
+            if (name == "Downloading")
+            {
+              return SecondaryStatus::Downloading;
+            }
+            break;
+          case DownloadingTrainingImage_HASH:
+            if (name == "DownloadingTrainingImage")
+            {
+              return SecondaryStatus::DownloadingTrainingImage;
+            }
+            break;
+          case Training_HASH:
+            if (name == "Training")
+            {
+              return SecondaryStatus::Training;
+            }
+            break;
+          case Uploading_HASH:
+            if (name == "Uploading")
+            {
+              return SecondaryStatus::Uploading;
+            }
+            break;
+          case Stopping_HASH:
+            if (name == "Stopping")
+            {
+              return SecondaryStatus::Stopping;
+            }
+            break;
+          case Stopped_HASH:
+            if (name == "Stopped")
+            {
+              return SecondaryStatus::Stopped;
+            }
+            break;
+          case MaxRuntimeExceeded_HASH:
+            if (name == "MaxRuntimeExceeded")
+            {
+              return SecondaryStatus::MaxRuntimeExceeded;
+            }
+            break;
+          case Completed_HASH:
+            if (name == "Completed")
+            {
+              return SecondaryStatus::Completed;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return SecondaryStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return SecondaryStatus::NOT_SET;
         }
 
-        Aws::String GetNameForSecondaryStatus(SecondaryStatus enumValue)
+        const char* GetNameForSecondaryStatus(SecondaryStatus enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
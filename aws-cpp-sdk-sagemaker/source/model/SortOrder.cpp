@@ -30,20 +30,30 @@ namespace Aws
       namespace SortOrderMapper
       {
 
-        static const int Ascending_HASH = HashingUtils::HashString("Ascending");
-        static const int Descending_HASH = HashingUtils::HashString("Descending");
+        static constexpr int Ascending_HASH = HashingUtils::CompileTimeHashString("Ascending");
+        static constexpr int Descending_HASH = HashingUtils::CompileTimeHashString("Descending");
 
 
         SortOrder GetSortOrderForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Ascending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SortOrder::Ascending;
-          }
-          else if (hashCode == Descending_HASH)
-          {
-            return SortOrder::Descending;
+          case Ascending_HASH:
+            if (name == "Ascending")
+            {
+              return SortOrder::Ascending;
+            }
+            break;
+          case Descending_HASH:
+            if (name == "Descending")
+            {
+              return SortOrder::Descending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SortOrder::NOT_SET;
         }
 
-        Aws::String GetNameForSortOrder(SortOrder enumValue)
+        const char* GetNameForSortOrder(SortOrder enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
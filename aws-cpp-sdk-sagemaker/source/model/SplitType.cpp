@@ -30,25 +30,37 @@ namespace Aws
       namespace SplitTypeMapper
       {
 
-        static const int None_HASH = HashingUtils::HashString("None");
-        static const int Line_HASH = HashingUtils::HashString("Line");
-        static const int RecordIO_HASH = HashingUtils::HashString("RecordIO");
+        static constexpr int None_HASH = HashingUtils::CompileTimeHashString("None");
+        static constexpr int Line_HASH = HashingUtils::CompileTimeHashString("Line");
+        static constexpr int RecordIO_HASH = HashingUtils::CompileTimeHashString("RecordIO");
 
 
         SplitType GetSplitTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == None_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SplitType::None;
-          }
-          else if (hashCode == Line_HASH)
-          {
-            return SplitType::Line;
-          }
-          else if (hashCode == RecordIO_HASH)
-          {
-            return SplitType::RecordIO;
+          case None_HASH:
+            if (name == "None")
+            {
+              return SplitType::None;
+            }
+            break;
+          case Line_HASH:
+            if (name == "Line")
+            {
+              return SplitType::Line;
+            }
+            break;
+          case RecordIO_HASH:
+            if (name == "RecordIO")
+            {
+              return SplitType::RecordIO;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return SplitType::NOT_SET;
         }
 
-        Aws::String GetNameForSplitType(SplitType enumValue)
+        const char* GetNameForSplitType(SplitType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
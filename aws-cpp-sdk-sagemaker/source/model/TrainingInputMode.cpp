@@ -30,20 +30,30 @@ namespace Aws
       namespace TrainingInputModeMapper
       {
 
-        static const int Pipe_HASH = HashingUtils::HashString("Pipe");
-        static const int File_HASH = HashingUtils::HashString("File");
+        static constexpr int Pipe_HASH = HashingUtils::CompileTimeHashString("Pipe");
+        static constexpr int File_HASH = HashingUtils::CompileTimeHashString("File");
 
 
         TrainingInputMode GetTrainingInputModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pipe_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TrainingInputMode::Pipe;
-          }
-          else if (hashCode == File_HASH)
-          {
-            return TrainingInputMode::File;
+          case Pipe_HASH:
+            if (name == "Pipe")
+            {
+              return TrainingInputMode::Pipe;
+            }
+            break;
+          case File_HASH:
+            if (name == "File")
+            {
+              return TrainingInputMode::File;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TrainingInputMode::NOT_SET;
         }
 
-        Aws::String GetNameForTrainingInputMode(TrainingInputMode enumValue)
+        const char* GetNameForTrainingInputMode(TrainingInputMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
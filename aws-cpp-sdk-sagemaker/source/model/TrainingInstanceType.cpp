@@ -30,140 +30,198 @@ namespace Aws
       namespace TrainingInstanceTypeMapper
       {
 
-        static const int ml_m4_xlarge_HASH = HashingUtils::HashString("ml.m4.xlarge");
-        static const int ml_m4_2xlarge_HASH = HashingUtils::HashString("ml.m4.2xlarge");
-        static const int ml_m4_4xlarge_HASH = HashingUtils::HashString("ml.m4.4xlarge");
-        static const int ml_m4_10xlarge_HASH = HashingUtils::HashString("ml.m4.10xlarge");
-        static const int ml_m4_16xlarge_HASH = HashingUtils::HashString("ml.m4.16xlarge");
-        static const int ml_m5_large_HASH = HashingUtils::HashString("ml.m5.large");
-        static const int ml_m5_xlarge_HASH = HashingUtils::HashString("ml.m5.xlarge");
-        static const int ml_m5_2xlarge_HASH = HashingUtils::HashString("ml.m5.2xlarge");
-        static const int ml_m5_4xlarge_HASH = HashingUtils::HashString("ml.m5.4xlarge");
-        static const int ml_m5_12xlarge_HASH = HashingUtils::HashString("ml.m5.12xlarge");
-        static const int ml_m5_24xlarge_HASH = HashingUtils::HashString("ml.m5.24xlarge");
-        static const int ml_c4_xlarge_HASH = HashingUtils::HashString("ml.c4.xlarge");
-        static const int ml_c4_2xlarge_HASH = HashingUtils::HashString("ml.c4.2xlarge");
-        static const int ml_c4_4xlarge_HASH = HashingUtils::HashString("ml.c4.4xlarge");
-        static const int ml_c4_8xlarge_HASH = HashingUtils::HashString("ml.c4.8xlarge");
-        static const int ml_p2_xlarge_HASH = HashingUtils::HashString("ml.p2.xlarge");
-        static const int ml_p2_8xlarge_HASH = HashingUtils::HashString("ml.p2.8xlarge");
-        static const int ml_p2_16xlarge_HASH = HashingUtils::HashString("ml.p2.16xlarge");
-        static const int ml_p3_2xlarge_HASH = HashingUtils::HashString("ml.p3.2xlarge");
-        static const int ml_p3_8xlarge_HASH = HashingUtils::HashString("ml.p3.8xlarge");
-        static const int ml_p3_16xlarge_HASH = HashingUtils::HashString("ml.p3.16xlarge");
-        static const int ml_c5_xlarge_HASH = HashingUtils::HashString("ml.c5.xlarge");
-        static const int ml_c5_2xlarge_HASH = HashingUtils::HashString("ml.c5.2xlarge");
-        static const int ml_c5_4xlarge_HASH = HashingUtils::HashString("ml.c5.4xlarge");
-        static const int ml_c5_9xlarge_HASH = HashingUtils::HashString("ml.c5.9xlarge");
-        static const int ml_c5_18xlarge_HASH = HashingUtils::HashString("ml.c5.18xlarge");
+        static constexpr int ml_m4_xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.xlarge");
+        static constexpr int ml_m4_2xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.2xlarge");
+        static constexpr int ml_m4_4xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.4xlarge");
+        static constexpr int ml_m4_10xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.10xlarge");
+        static constexpr int ml_m4_16xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m4.16xlarge");
+        static constexpr int ml_m5_large_HASH = HashingUtils::CompileTimeHashString("ml.m5.large");
+        static constexpr int ml_m5_xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m5.xlarge");
+        static constexpr int ml_m5_2xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m5.2xlarge");
+        static constexpr int ml_m5_4xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m5.4xlarge");
+        static constexpr int ml_m5_12xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m5.12xlarge");
+        static constexpr int ml_m5_24xlarge_HASH = HashingUtils::CompileTimeHashString("ml.m5.24xlarge");
+        static constexpr int ml_c4_xlarge_HASH = HashingUtils::CompileTimeHashString("ml.c4.xlarge");
+        static constexpr int ml_c4_2xlarge_HASH = HashingUtils::CompileTimeHashString("ml.c4.2xlarge");
+        static constexpr int ml_c4_4xlarge_HASH = HashingUtils::CompileTimeHashString("ml.c4.4xlarge");
+        static constexpr int ml_c4_8xlarge_HASH = HashingUtils::CompileTimeHashString("ml.c4.8xlarge");
+        static constexpr int ml_p2_xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p2.xlarge");
+        static constexpr int ml_p2_8xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p2.8xlarge");
+        static constexpr int ml_p2_16xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p2.16xlarge");
+        static constexpr int ml_p3_2xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p3.2xlarge");
+        static constexpr int ml_p3_8xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p3.8xlarge");
+        static constexpr int ml_p3_16xlarge_HASH = HashingUtils::CompileTimeHashString("ml.p3.16xlarge");
+        static constexpr int ml_c5_xlarge_HASH = HashingUtils::CompileTimeHashString("ml.c5.xlarge");
+        static constexpr int ml_c5_2xlarge_HASH = HashingUtils::CompileTimeHashString("ml.c5.2xlarge");
+        static constexpr int ml_c5_4xlarge_HASH = HashingUtils::CompileTimeHashString("ml.c5.4xlarge");
+        static constexpr int ml_c5_9xlarge_HASH = HashingUtils::CompileTimeHashString("ml.c5.9xlarge");
+        static constexpr int ml_c5_18xlarge_HASH = HashingUtils::CompileTimeHashString("ml.c5.18xlarge");
 
 
         TrainingInstanceType GetTrainingInstanceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ml_m4_xlarge_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TrainingInstanceType::ml_m4_xlarge;
-          }
-          else if (hashCode == ml_m4_2xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_m4_2xlarge;
-          }
-          else if (hashCode == ml_m4_4xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_m4_4xlarge;
-          }
-          else if (hashCode == ml_m4_10xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_m4_10xlarge;
-          }
-          else if (hashCode == ml_m4_16xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_m4_16xlarge;
-          }
-          else if (hashCode == ml_m5_large_HASH)
-          {
-            return TrainingInstanceType::ml_m5_large;
-          }
-          else if (hashCode == ml_m5_xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_m5_xlarge;
-          }
-          else if (hashCode == ml_m5_2xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_m5_2xlarge;
-          }
-          else if (hashCode == ml_m5_4xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_m5_4xlarge;
-          }
-          else if (hashCode == ml_m5_12xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_m5_12xlarge;
-          }
-          else if (hashCode == ml_m5_24xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_m5_24xlarge;
-          }
-          else if (hashCode == ml_c4_xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_c4_xlarge;
-          }
-          else if (hashCode == ml_c4_2xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_c4_2xlarge;
-          }
-          else if (hashCode == ml_c4_4xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_c4_4xlarge;
-          }
-          else if (hashCode == ml_c4_8xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_c4_8xlarge;
-          }
-          else if (hashCode == ml_p2_xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_p2_xlarge;
-          }
-          else if (hashCode == ml_p2_8xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_p2_8xlarge;
-          }
-          else if (hashCode == ml_p2_16xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_p2_16xlarge;
-          }
-          else if (hashCode == ml_p3_2xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_p3_2xlarge;
-          }
-          else if (hashCode == ml_p3_8xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_p3_8xlarge;
-          }
-          else if (hashCode == ml_p3_16xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_p3_16xlarge;
-          }
-          else if (hashCode == ml_c5_xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_c5_xlarge;
-          }
-          else if (hashCode == ml_c5_2xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_c5_2xlarge;
-          }
-          else if (hashCode == ml_c5_4xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_c5_4xlarge;
-          }
-          else if (hashCode == ml_c5_9xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_c5_9xlarge;
-          }
-          else if (hashCode == ml_c5_18xlarge_HASH)
-          {
-            return TrainingInstanceType::ml_c5_18xlarge;
+          case ml_m4_xlarge_HASH:
+            if (name == "ml.m4.xlarge")
+            {
+              return TrainingInstanceType::ml_m4_xlarge;
+            }
+            break;
+          case ml_m4_2xlarge_HASH:
+            if (name == "ml.m4.2xlarge")
+            {
+              return TrainingInstanceType::ml_m4_2xlarge;
+            }
+            break;
+          case ml_m4_4xlarge_HASH:
+            if (name == "ml.m4.4xlarge")
+            {
+              return TrainingInstanceType::ml_m4_4xlarge;
+            }
+            break;
+          case ml_m4_10xlarge_HASH:
+            if (name == "ml.m4.10xlarge")
+            {
+              return TrainingInstanceType::ml_m4_10xlarge;
+            }
+            break;
+          case ml_m4_16xlarge_HASH:
+            if (name == "ml.m4.16xlarge")
+            {
+              return TrainingInstanceType::ml_m4_16xlarge;
+            }
+            break;
+          case ml_m5_large_HASH:
+            if (name == "ml.m5.large")
+            {
+              return TrainingInstanceType::ml_m5_large;
+            }
+            break;
+          case ml_m5_xlarge_HASH:
+            if (name == "ml.m5.xlarge")
+            {
+              return TrainingInstanceType::ml_m5_xlarge;
+            }
+            break;
+          case ml_m5_2xlarge_HASH:
+            if (name == "ml.m5.2xlarge")
+            {
+              return TrainingInstanceType::ml_m5_2xlarge;
+            }
+            break;
+          case ml_m5_4xlarge_HASH:
+            if (name == "ml.m5.4xlarge")
+            {
+              return TrainingInstanceType::ml_m5_4xlarge;
+            }
+            break;
+          case ml_m5_12xlarge_HASH:
+            if (name == "ml.m5.12xlarge")
+            {
+              return TrainingInstanceType::ml_m5_12xlarge;
+            }
+            break;
+          case ml_m5_24xlarge_HASH:
+            if (name == "ml.m5.24xlarge")
+            {
+              return TrainingInstanceType::ml_m5_24xlarge;
+            }
+            break;
+          case ml_c4_xlarge_HASH:
+            if (name == "ml.c4.xlarge")
+            {
+              return TrainingInstanceType::ml_c4_xlarge;
+            }
+            break;
+          case ml_c4_2xlarge_HASH:
+            if (name == "ml.c4.2xlarge")
+            {
+              return TrainingInstanceType::ml_c4_2xlarge;
+            }
+            break;
+          case ml_c4_4xlarge_HASH:
+            if (name == "ml.c4.4xlarge")
+            {
+              return TrainingInstanceType::ml_c4_4xlarge;
+            }
+            break;
+          case ml_c4_8xlarge_HASH:
+            if (name == "ml.c4.8xlarge")
+            {
+              return TrainingInstanceType::ml_c4_8xlarge;
+            }
+            break;
+          case ml_p2_xlarge_HASH:
+            if (name == "ml.p2.xlarge")
+            {
+              return TrainingInstanceType::ml_p2_xlarge;
+            }
+            break;
+          case ml_p2_8xlarge_HASH:
+            if (name == "ml.p2.8xlarge")
+            {
+              return TrainingInstanceType::ml_p2_8xlarge;
+            }
+            break;
+          case ml_p2_16xlarge_HASH:
+            if (name == "ml.p2.16xlarge")
+            {
+              return TrainingInstanceType::ml_p2_16xlarge;
+            }
+            break;
+          case ml_p3_2xlarge_HASH:
+            if (name == "ml.p3.2xlarge")
+            {
+              return TrainingInstanceType::ml_p3_2xlarge;
+            }
+            break;
+          case ml_p3_8xlarge_HASH:
+            if (name == "ml.p3.8xlarge")
+            {
+              return TrainingInstanceType::ml_p3_8xlarge;
+            }
+            break;
+          case ml_p3_16xlarge_HASH:
+            if (name == "ml.p3.16xlarge")
+            {
+              return TrainingInstanceType::ml_p3_16xlarge;
+            }
+            break;
+          case ml_c5_xlarge_HASH:
+            if (name == "ml.c5.xlarge")
+            {
+              return TrainingInstanceType::ml_c5_xlarge;
+            }
+            break;
+          case ml_c5_2xlarge_HASH:
+            if (name == "ml.c5.2xlarge")
+            {
+              return TrainingInstanceType::ml_c5_2xlarge;
+            }
+            break;
+          case ml_c5_4xlarge_HASH:
+            if (name == "ml.c5.4xlarge")
+            {
+              return TrainingInstanceType::ml_c5_4xlarge;
+            }
+            break;
+          case ml_c5_9xlarge_HASH:
+            if (name == "ml.c5.9xlarge")
+            {
+              return TrainingInstanceType::ml_c5_9xlarge;
+            }
+            break;
+          case ml_c5_18xlarge_HASH:
+            if (name == "ml.c5.18xlarge")
+            {
+              return TrainingInstanceType::ml_c5_18xlarge;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -175,7 +233,7 @@ namespace Aws
           return TrainingInstanceType::NOT_SET;
         }
 
-        Aws::String GetNameForTrainingInstanceType(TrainingInstanceType enumValue)
+        const char* GetNameForTrainingInstanceType(TrainingInstanceType enumValue)
         {
           switch(enumValue)
           {
@@ -235,7 +293,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace TrainingJobSortByOptionsMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int CreationTime_HASH = HashingUtils::HashString("CreationTime");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int FinalObjectiveMetricValue_HASH = HashingUtils::HashString("FinalObjectiveMetricValue");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int CreationTime_HASH = HashingUtils::CompileTimeHashString("CreationTime");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
+        static constexpr int FinalObjectiveMetricValue_HASH = HashingUtils::CompileTimeHashString("FinalObjectiveMetricValue");
 
 
         TrainingJobSortByOptions GetTrainingJobSortByOptionsForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TrainingJobSortByOptions::Name;
-          }
-          else if (hashCode == CreationTime_HASH)
-          {
-            return TrainingJobSortByOptions::CreationTime;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return TrainingJobSortByOptions::Status;
-          }
-          else if (hashCode == FinalObjectiveMetricValue_HASH)
-          {
-            return TrainingJobSortByOptions::FinalObjectiveMetricValue;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return TrainingJobSortByOptions::Name;
+            }
+            break;
+          case CreationTime_HASH:
+            if (name == "CreationTime")
+            {
+              return TrainingJobSortByOptions::CreationTime;
+            }
+            break;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return TrainingJobSortByOptions::Status;
+            }
+            break;
+          case FinalObjectiveMetricValue_HASH:
+            if (name == "FinalObjectiveMetricValue")
+            {
+              return TrainingJobSortByOptions::FinalObjectiveMetricValue;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return TrainingJobSortByOptions::NOT_SET;
         }
 
-        Aws::String GetNameForTrainingJobSortByOptions(TrainingJobSortByOptions enumValue)
+        const char* GetNameForTrainingJobSortByOptions(TrainingJobSortByOptions enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
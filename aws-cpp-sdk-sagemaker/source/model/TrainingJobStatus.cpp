@@ -30,35 +30,51 @@ namespace Aws
       namespace TrainingJobStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Completed_HASH = HashingUtils::CompileTimeHashString("Completed");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Stopping_HASH = HashingUtils::CompileTimeHashString("Stopping");
+        static constexpr int Stopped_HASH = HashingUtils::CompileTimeHashString("Stopped");
 
 
         TrainingJobStatus GetTrainingJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TrainingJobStatus::InProgress;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return TrainingJobStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return TrainingJobStatus::Failed;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return TrainingJobStatus::Stopping;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return TrainingJobStatus::Stopped;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return TrainingJobStatus::InProgress;
+            }
+            break;
+          case Completed_HASH:
+            if (name == "Completed")
+            {
+              return TrainingJobStatus::Completed;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return TrainingJobStatus::Failed;
+            }
+            break;
+          case Stopping_HASH:
+            if (name == "Stopping")
+            {
+              return TrainingJobStatus::Stopping;
+            }
+            break;
+          case Stopped_HASH:
+            if (name == "Stopped")
+            {
+              return TrainingJobStatus::Stopped;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return TrainingJobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTrainingJobStatus(TrainingJobStatus enumValue)
+        const char* GetNameForTrainingJobStatus(TrainingJobStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
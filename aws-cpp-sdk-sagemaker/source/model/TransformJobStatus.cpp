@@ -30,35 +30,51 @@ namespace Aws
       namespace TransformJobStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Completed_HASH = HashingUtils::HashString("Completed");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Stopping_HASH = HashingUtils::HashString("Stopping");
-        static const int Stopped_HASH = HashingUtils::HashString("Stopped");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Completed_HASH = HashingUtils::CompileTimeHashString("Completed");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Stopping_HASH = HashingUtils::CompileTimeHashString("Stopping");
+        static constexpr int Stopped_HASH = HashingUtils::CompileTimeHashString("Stopped");
 
 
         TransformJobStatus GetTransformJobStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TransformJobStatus::InProgress;
-          }
-          else if (hashCode == Completed_HASH)
-          {
-            return TransformJobStatus::Completed;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return TransformJobStatus::Failed;
-          }
-          else if (hashCode == Stopping_HASH)
-          {
-            return TransformJobStatus::Stopping;
-          }
-          else if (hashCode == Stopped_HASH)
-          {
-            return TransformJobStatus::Stopped;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return TransformJobStatus::InProgress;
+            }
+            break;
+          case Completed_HASH:
+            if (name == "Completed")
+            {
+              return TransformJobStatus::Completed;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return TransformJobStatus::Failed;
+            }
+            break;
+          case Stopping_HASH:
+            if (name == "Stopping")
+            {
+              return TransformJobStatus::Stopping;
+            }
+            break;
+          case Stopped_HASH:
+            if (name == "Stopped")
+            {
+              return TransformJobStatus::Stopped;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return TransformJobStatus::NOT_SET;
         }
 
-        Aws::String GetNameForTransformJobStatus(TransformJobStatus enumValue)
+        const char* GetNameForTransformJobStatus(TransformJobStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -28,21 +28,21 @@ namespace SimpleDB
 namespace SimpleDBErrorMapper
 {
 
-static const int NUMBER_DOMAIN_BYTES_EXCEEDED_HASH = HashingUtils::HashString("NumberDomainBytesExceeded");
-static const int REQUEST_TIMEOUT_HASH = HashingUtils::HashString("RequestTimeout");
-static const int NUMBER_DOMAIN_ATTRIBUTES_EXCEEDED_HASH = HashingUtils::HashString("NumberDomainAttributesExceeded");
-static const int INVALID_NUMBER_PREDICATES_HASH = HashingUtils::HashString("InvalidNumberPredicates");
-static const int ATTRIBUTE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("AttributeDoesNotExist");
-static const int TOO_MANY_REQUESTED_ATTRIBUTES_HASH = HashingUtils::HashString("TooManyRequestedAttributes");
-static const int NUMBER_SUBMITTED_ATTRIBUTES_EXCEEDED_HASH = HashingUtils::HashString("NumberSubmittedAttributesExceeded");
-static const int INVALID_NUMBER_VALUE_TESTS_HASH = HashingUtils::HashString("InvalidNumberValueTests");
-static const int DUPLICATE_ITEM_NAME_HASH = HashingUtils::HashString("DuplicateItemName");
-static const int NUMBER_ITEM_ATTRIBUTES_EXCEEDED_HASH = HashingUtils::HashString("NumberItemAttributesExceeded");
-static const int NUMBER_DOMAINS_EXCEEDED_HASH = HashingUtils::HashString("NumberDomainsExceeded");
-static const int NUMBER_SUBMITTED_ITEMS_EXCEEDED_HASH = HashingUtils::HashString("NumberSubmittedItemsExceeded");
-static const int INVALID_QUERY_EXPRESSION_HASH = HashingUtils::HashString("InvalidQueryExpression");
-static const int NO_SUCH_DOMAIN_HASH = HashingUtils::HashString("NoSuchDomain");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextToken");
+static constexpr int NUMBER_DOMAIN_BYTES_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NumberDomainBytesExceeded");
+static constexpr int REQUEST_TIMEOUT_HASH = HashingUtils::CompileTimeHashString("RequestTimeout");
+static constexpr int NUMBER_DOMAIN_ATTRIBUTES_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NumberDomainAttributesExceeded");
+static constexpr int INVALID_NUMBER_PREDICATES_HASH = HashingUtils::CompileTimeHashString("InvalidNumberPredicates");
+static constexpr int ATTRIBUTE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("AttributeDoesNotExist");
+static constexpr int TOO_MANY_REQUESTED_ATTRIBUTES_HASH = HashingUtils::CompileTimeHashString("TooManyRequestedAttributes");
+static constexpr int NUMBER_SUBMITTED_ATTRIBUTES_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NumberSubmittedAttributesExceeded");
+static constexpr int INVALID_NUMBER_VALUE_TESTS_HASH = HashingUtils::CompileTimeHashString("InvalidNumberValueTests");
+static constexpr int DUPLICATE_ITEM_NAME_HASH = HashingUtils::CompileTimeHashString("DuplicateItemName");
+static constexpr int NUMBER_ITEM_ATTRIBUTES_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NumberItemAttributesExceeded");
+static constexpr int NUMBER_DOMAINS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NumberDomainsExceeded");
+static constexpr int NUMBER_SUBMITTED_ITEMS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("NumberSubmittedItemsExceeded");
+static constexpr int INVALID_QUERY_EXPRESSION_HASH = HashingUtils::CompileTimeHashString("InvalidQueryExpression");
+static constexpr int NO_SUCH_DOMAIN_HASH = HashingUtils::CompileTimeHashString("NoSuchDomain");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextToken");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -28,16 +28,16 @@ namespace SecretsManager
 namespace SecretsManagerErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int RESOURCE_EXISTS_HASH = HashingUtils::HashString("ResourceExistsException");
-static const int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::HashString("MalformedPolicyDocumentException");
-static const int INTERNAL_SERVICE_HASH = HashingUtils::HashString("InternalServiceError");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int ENCRYPTION_FAILURE_HASH = HashingUtils::HashString("EncryptionFailure");
-static const int DECRYPTION_FAILURE_HASH = HashingUtils::HashString("DecryptionFailure");
-static const int PRECONDITION_NOT_MET_HASH = HashingUtils::HashString("PreconditionNotMetException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int RESOURCE_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceExistsException");
+static constexpr int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::CompileTimeHashString("MalformedPolicyDocumentException");
+static constexpr int INTERNAL_SERVICE_HASH = HashingUtils::CompileTimeHashString("InternalServiceError");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int ENCRYPTION_FAILURE_HASH = HashingUtils::CompileTimeHashString("EncryptionFailure");
+static constexpr int DECRYPTION_FAILURE_HASH = HashingUtils::CompileTimeHashString("DecryptionFailure");
+static constexpr int PRECONDITION_NOT_MET_HASH = HashingUtils::CompileTimeHashString("PreconditionNotMetException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
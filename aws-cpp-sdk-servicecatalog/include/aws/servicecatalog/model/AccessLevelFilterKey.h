@@ -35,7 +35,8 @@ namespace AccessLevelFilterKeyMapper
 {
 AWS_SERVICECATALOG_API AccessLevelFilterKey GetAccessLevelFilterKeyForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForAccessLevelFilterKey(AccessLevelFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForAccessLevelFilterKey(AccessLevelFilterKey value);
 } // namespace AccessLevelFilterKeyMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -33,7 +33,8 @@ namespace CopyOptionMapper
 {
 AWS_SERVICECATALOG_API CopyOption GetCopyOptionForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForCopyOption(CopyOption value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForCopyOption(CopyOption value);
 } // namespace CopyOptionMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -35,7 +35,8 @@ namespace CopyProductStatusMapper
 {
 AWS_SERVICECATALOG_API CopyProductStatus GetCopyProductStatusForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForCopyProductStatus(CopyProductStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForCopyProductStatus(CopyProductStatus value);
 } // namespace CopyProductStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -34,7 +34,8 @@ namespace EvaluationTypeMapper
 {
 AWS_SERVICECATALOG_API EvaluationType GetEvaluationTypeForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForEvaluationType(EvaluationType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForEvaluationType(EvaluationType value);
 } // namespace EvaluationTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -34,7 +34,8 @@ namespace PortfolioShareTypeMapper
 {
 AWS_SERVICECATALOG_API PortfolioShareType GetPortfolioShareTypeForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForPortfolioShareType(PortfolioShareType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForPortfolioShareType(PortfolioShareType value);
 } // namespace PortfolioShareTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -33,7 +33,8 @@ namespace PrincipalTypeMapper
 {
 AWS_SERVICECATALOG_API PrincipalType GetPrincipalTypeForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForPrincipalType(PrincipalType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForPrincipalType(PrincipalType value);
 } // namespace PrincipalTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
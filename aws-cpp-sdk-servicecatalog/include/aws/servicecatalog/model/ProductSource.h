@@ -33,7 +33,8 @@ namespace ProductSourceMapper
 {
 AWS_SERVICECATALOG_API ProductSource GetProductSourceForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProductSource(ProductSource value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProductSource(ProductSource value);
 } // namespace ProductSourceMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -34,7 +34,8 @@ namespace ProductTypeMapper
 {
 AWS_SERVICECATALOG_API ProductType GetProductTypeForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProductType(ProductType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProductType(ProductType value);
 } // namespace ProductTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -36,7 +36,8 @@ namespace ProductViewFilterByMapper
 {
 AWS_SERVICECATALOG_API ProductViewFilterBy GetProductViewFilterByForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProductViewFilterBy(ProductViewFilterBy value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProductViewFilterBy(ProductViewFilterBy value);
 } // namespace ProductViewFilterByMapper
 } // namespace Model
 } // namespace ServiceCatalog
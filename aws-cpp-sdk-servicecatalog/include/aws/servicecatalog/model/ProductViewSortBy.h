@@ -35,7 +35,8 @@ namespace ProductViewSortByMapper
 {
 AWS_SERVICECATALOG_API ProductViewSortBy GetProductViewSortByForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProductViewSortBy(ProductViewSortBy value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProductViewSortBy(ProductViewSortBy value);
 } // namespace ProductViewSortByMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -38,7 +38,8 @@ namespace ProvisionedProductPlanStatusMapper
 {
 AWS_SERVICECATALOG_API ProvisionedProductPlanStatus GetProvisionedProductPlanStatusForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProvisionedProductPlanStatus(ProvisionedProductPlanStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProvisionedProductPlanStatus(ProvisionedProductPlanStatus value);
 } // namespace ProvisionedProductPlanStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
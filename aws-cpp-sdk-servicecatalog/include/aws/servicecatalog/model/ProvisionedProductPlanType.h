@@ -33,7 +33,8 @@ namespace ProvisionedProductPlanTypeMapper
 {
 AWS_SERVICECATALOG_API ProvisionedProductPlanType GetProvisionedProductPlanTypeForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProvisionedProductPlanType(ProvisionedProductPlanType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProvisionedProductPlanType(ProvisionedProductPlanType value);
 } // namespace ProvisionedProductPlanTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -37,7 +37,8 @@ namespace ProvisionedProductStatusMapper
 {
 AWS_SERVICECATALOG_API ProvisionedProductStatus GetProvisionedProductStatusForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProvisionedProductStatus(ProvisionedProductStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProvisionedProductStatus(ProvisionedProductStatus value);
 } // namespace ProvisionedProductStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -33,7 +33,8 @@ namespace ProvisionedProductViewFilterByMapper
 {
 AWS_SERVICECATALOG_API ProvisionedProductViewFilterBy GetProvisionedProductViewFilterByForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProvisionedProductViewFilterBy(ProvisionedProductViewFilterBy value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProvisionedProductViewFilterBy(ProvisionedProductViewFilterBy value);
 } // namespace ProvisionedProductViewFilterByMapper
 } // namespace Model
 } // namespace ServiceCatalog
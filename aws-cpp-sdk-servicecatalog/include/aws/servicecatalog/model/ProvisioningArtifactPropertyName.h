@@ -33,7 +33,8 @@ namespace ProvisioningArtifactPropertyNameMapper
 {
 AWS_SERVICECATALOG_API ProvisioningArtifactPropertyName GetProvisioningArtifactPropertyNameForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProvisioningArtifactPropertyName(ProvisioningArtifactPropertyName value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProvisioningArtifactPropertyName(ProvisioningArtifactPropertyName value);
 } // namespace ProvisioningArtifactPropertyNameMapper
 } // namespace Model
 } // namespace ServiceCatalog
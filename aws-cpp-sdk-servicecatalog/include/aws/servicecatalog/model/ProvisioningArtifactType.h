@@ -35,7 +35,8 @@ namespace ProvisioningArtifactTypeMapper
 {
 AWS_SERVICECATALOG_API ProvisioningArtifactType GetProvisioningArtifactTypeForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForProvisioningArtifactType(ProvisioningArtifactType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForProvisioningArtifactType(ProvisioningArtifactType value);
 } // namespace ProvisioningArtifactTypeMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -37,7 +37,8 @@ namespace RecordStatusMapper
 {
 AWS_SERVICECATALOG_API RecordStatus GetRecordStatusForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForRecordStatus(RecordStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForRecordStatus(RecordStatus value);
 } // namespace RecordStatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -35,7 +35,8 @@ namespace ReplacementMapper
 {
 AWS_SERVICECATALOG_API Replacement GetReplacementForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForReplacement(Replacement value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForReplacement(Replacement value);
 } // namespace ReplacementMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -38,7 +38,8 @@ namespace ResourceAttributeMapper
 {
 AWS_SERVICECATALOG_API ResourceAttribute GetResourceAttributeForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForResourceAttribute(ResourceAttribute value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForResourceAttribute(ResourceAttribute value);
 } // namespace ResourceAttributeMapper
 } // namespace Model
 } // namespace ServiceCatalog
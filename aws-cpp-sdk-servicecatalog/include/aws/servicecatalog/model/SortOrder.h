@@ -34,7 +34,8 @@ namespace SortOrderMapper
 {
 AWS_SERVICECATALOG_API SortOrder GetSortOrderForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForSortOrder(SortOrder value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForSortOrder(SortOrder value);
 } // namespace SortOrderMapper
 } // namespace Model
 } // namespace ServiceCatalog
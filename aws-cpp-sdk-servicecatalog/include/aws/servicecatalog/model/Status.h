@@ -35,7 +35,8 @@ namespace StatusMapper
 {
 AWS_SERVICECATALOG_API Status GetStatusForName(const Aws::String& name);
 
-AWS_SERVICECATALOG_API Aws::String GetNameForStatus(Status value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICECATALOG_API const char* GetNameForStatus(Status value);
 } // namespace StatusMapper
 } // namespace Model
 } // namespace ServiceCatalog
@@ -28,12 +28,12 @@ namespace ServiceCatalog
 namespace ServiceCatalogErrorMapper
 {
 
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int INVALID_PARAMETERS_HASH = HashingUtils::HashString("InvalidParametersException");
-static const int INVALID_STATE_HASH = HashingUtils::HashString("InvalidStateException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int DUPLICATE_RESOURCE_HASH = HashingUtils::HashString("DuplicateResourceException");
-static const int TAG_OPTION_NOT_MIGRATED_HASH = HashingUtils::HashString("TagOptionNotMigratedException");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int INVALID_PARAMETERS_HASH = HashingUtils::CompileTimeHashString("InvalidParametersException");
+static constexpr int INVALID_STATE_HASH = HashingUtils::CompileTimeHashString("InvalidStateException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int DUPLICATE_RESOURCE_HASH = HashingUtils::CompileTimeHashString("DuplicateResourceException");
+static constexpr int TAG_OPTION_NOT_MIGRATED_HASH = HashingUtils::CompileTimeHashString("TagOptionNotMigratedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace AccessLevelFilterKeyMapper
       {
 
-        static const int Account_HASH = HashingUtils::HashString("Account");
-        static const int Role_HASH = HashingUtils::HashString("Role");
-        static const int User_HASH = HashingUtils::HashString("User");
+        static constexpr int Account_HASH = HashingUtils::CompileTimeHashString("Account");
+        static constexpr int Role_HASH = HashingUtils::CompileTimeHashString("Role");
+        static constexpr int User_HASH = HashingUtils::CompileTimeHashString("User");
 
 
         AccessLevelFilterKey GetAccessLevelFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Account_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AccessLevelFilterKey::Account;
-          }
-          else if (hashCode == Role_HASH)
-          {
-            return AccessLevelFilterKey::Role;
-          }
-          else if (hashCode == User_HASH)
-          {
-            return AccessLevelFilterKey::User;
+          case Account_HASH:
+            if (name == "Account")
+            {
+              return AccessLevelFilterKey::Account;
+            }
+            break;
+          case Role_HASH:
+            if (name == "Role")
+            {
+              return AccessLevelFilterKey::Role;
+            }
+            break;
+          case User_HASH:
+            if (name == "User")
+            {
+              return AccessLevelFilterKey::User;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AccessLevelFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAccessLevelFilterKey(AccessLevelFilterKey enumValue)
+        const char* GetNameForAccessLevelFilterKey(AccessLevelFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ChangeActionMapper
       {
 
-        static const int ADD_HASH = HashingUtils::HashString("ADD");
-        static const int MODIFY_HASH = HashingUtils::HashString("MODIFY");
-        static const int REMOVE_HASH = HashingUtils::HashString("REMOVE");
+        static constexpr int ADD_HASH = HashingUtils::CompileTimeHashString("ADD");
+        static constexpr int MODIFY_HASH = HashingUtils::CompileTimeHashString("MODIFY");
+        static constexpr int REMOVE_HASH = HashingUtils::CompileTimeHashString("REMOVE");
 
 
         ChangeAction GetChangeActionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ADD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeAction::ADD;
-          }
-          else if (hashCode == MODIFY_HASH)
-          {
-            return ChangeAction::MODIFY;
-          }
-          else if (hashCode == REMOVE_HASH)
-          {
-            return ChangeAction::REMOVE;
+          case ADD_HASH:
+            if (name == "ADD")
+            {
+              return ChangeAction::ADD;
+            }
+            break;
+          case MODIFY_HASH:
+            if (name == "MODIFY")
+            {
+              return ChangeAction::MODIFY;
+            }
+            break;
+          case REMOVE_HASH:
+            if (name == "REMOVE")
+            {
+              return ChangeAction::REMOVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ChangeAction::NOT_SET;
         }
 
-        Aws::String GetNameForChangeAction(ChangeAction enumValue)
+        const char* GetNameForChangeAction(ChangeAction enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace CopyOptionMapper
       {
 
-        static const int CopyTags_HASH = HashingUtils::HashString("CopyTags");
+        static constexpr int CopyTags_HASH = HashingUtils::CompileTimeHashString("CopyTags");
 
 
         CopyOption GetCopyOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CopyTags_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CopyOption::CopyTags;
+          case CopyTags_HASH:
+            if (name == "CopyTags")
+            {
+              return CopyOption::CopyTags;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return CopyOption::NOT_SET;
         }
 
-        Aws::String GetNameForCopyOption(CopyOption enumValue)
+        const char* GetNameForCopyOption(CopyOption enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace EvaluationTypeMapper
       {
 
-        static const int STATIC__HASH = HashingUtils::HashString("STATIC");
-        static const int DYNAMIC_HASH = HashingUtils::HashString("DYNAMIC");
+        static constexpr int STATIC__HASH = HashingUtils::CompileTimeHashString("STATIC");
+        static constexpr int DYNAMIC_HASH = HashingUtils::CompileTimeHashString("DYNAMIC");
 
 
         EvaluationType GetEvaluationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STATIC__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EvaluationType::STATIC_;
-          }
-          else if (hashCode == DYNAMIC_HASH)
-          {
-            return EvaluationType::DYNAMIC;
+          case STATIC__HASH:
+            if (name == "STATIC")
+            {
+              return EvaluationType::STATIC_;
+            }
+            break;
+          case DYNAMIC_HASH:
+            if (name == "DYNAMIC")
+            {
+              return EvaluationType::DYNAMIC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EvaluationType::NOT_SET;
         }
 
-        Aws::String GetNameForEvaluationType(EvaluationType enumValue)
+        const char* GetNameForEvaluationType(EvaluationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PortfolioShareTypeMapper
       {
 
-        static const int IMPORTED_HASH = HashingUtils::HashString("IMPORTED");
-        static const int AWS_SERVICECATALOG_HASH = HashingUtils::HashString("AWS_SERVICECATALOG");
+        static constexpr int IMPORTED_HASH = HashingUtils::CompileTimeHashString("IMPORTED");
+        static constexpr int AWS_SERVICECATALOG_HASH = HashingUtils::CompileTimeHashString("AWS_SERVICECATALOG");
 
 
         PortfolioShareType GetPortfolioShareTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMPORTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PortfolioShareType::IMPORTED;
-          }
-          else if (hashCode == AWS_SERVICECATALOG_HASH)
-          {
-            return PortfolioShareType::AWS_SERVICECATALOG;
+          case IMPORTED_HASH:
+            if (name == "IMPORTED")
+            {
+              return PortfolioShareType::IMPORTED;
+            }
+            break;
+          case AWS_SERVICECATALOG_HASH:
+            if (name == "AWS_SERVICECATALOG")
+            {
+              return PortfolioShareType::AWS_SERVICECATALOG;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PortfolioShareType::NOT_SET;
         }
 
-        Aws::String GetNameForPortfolioShareType(PortfolioShareType enumValue)
+        const char* GetNameForPortfolioShareType(PortfolioShareType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ProductTypeMapper
       {
 
-        static const int CLOUD_FORMATION_TEMPLATE_HASH = HashingUtils::HashString("CLOUD_FORMATION_TEMPLATE");
-        static const int MARKETPLACE_HASH = HashingUtils::HashString("MARKETPLACE");
+        static constexpr int CLOUD_FORMATION_TEMPLATE_HASH = HashingUtils::CompileTimeHashString("CLOUD_FORMATION_TEMPLATE");
+        static constexpr int MARKETPLACE_HASH = HashingUtils::CompileTimeHashString("MARKETPLACE");
 
 
         ProductType GetProductTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLOUD_FORMATION_TEMPLATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProductType::CLOUD_FORMATION_TEMPLATE;
-          }
-          else if (hashCode == MARKETPLACE_HASH)
-          {
-            return ProductType::MARKETPLACE;
+          case CLOUD_FORMATION_TEMPLATE_HASH:
+            if (name == "CLOUD_FORMATION_TEMPLATE")
+            {
+              return ProductType::CLOUD_FORMATION_TEMPLATE;
+            }
+            break;
+          case MARKETPLACE_HASH:
+            if (name == "MARKETPLACE")
+            {
+              return ProductType::MARKETPLACE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ProductType::NOT_SET;
         }
 
-        Aws::String GetNameForProductType(ProductType enumValue)
+        const char* GetNameForProductType(ProductType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ProductViewFilterByMapper
       {
 
-        static const int FullTextSearch_HASH = HashingUtils::HashString("FullTextSearch");
-        static const int Owner_HASH = HashingUtils::HashString("Owner");
-        static const int ProductType_HASH = HashingUtils::HashString("ProductType");
-        static const int SourceProductId_HASH = HashingUtils::HashString("SourceProductId");
+        static constexpr int FullTextSearch_HASH = HashingUtils::CompileTimeHashString("FullTextSearch");
+        static constexpr int Owner_HASH = HashingUtils::CompileTimeHashString("Owner");
+        static constexpr int ProductType_HASH = HashingUtils::CompileTimeHashString("ProductType");
+        static constexpr int SourceProductId_HASH = HashingUtils::CompileTimeHashString("SourceProductId");
 
 
         ProductViewFilterBy GetProductViewFilterByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FullTextSearch_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProductViewFilterBy::FullTextSearch;
-          }
-          else if (hashCode == Owner_HASH)
-          {
-            return ProductViewFilterBy::Owner;
-          }
-          else if (hashCode == ProductType_HASH)
-          {
-            return ProductViewFilterBy::ProductType;
-          }
-          else if (hashCode == SourceProductId_HASH)
-          {
-            return ProductViewFilterBy::SourceProductId;
+          case FullTextSearch_HASH:
+            if (name == "FullTextSearch")
+            {
+              return ProductViewFilterBy::FullTextSearch;
+            }
+            break;
+          case Owner_HASH:
+            if (name == "Owner")
+            {
+              return ProductViewFilterBy::Owner;
+            }
+            break;
+          case ProductType_HASH:
+            if (name == "ProductType")
+            {
+              return ProductViewFilterBy::ProductType;
+            }
+            break;
+          case SourceProductId_HASH:
+            if (name == "SourceProductId")
+            {
+              return ProductViewFilterBy::SourceProductId;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ProductViewFilterBy::NOT_SET;
         }
 
-        Aws::String GetNameForProductViewFilterBy(ProductViewFilterBy enumValue)
+        const char* GetNameForProductViewFilterBy(ProductViewFilterBy enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
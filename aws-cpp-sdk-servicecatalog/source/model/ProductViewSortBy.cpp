@@ -30,25 +30,37 @@ namespace Aws
       namespace ProductViewSortByMapper
       {
 
-        static const int Title_HASH = HashingUtils::HashString("Title");
-        static const int VersionCount_HASH = HashingUtils::HashString("VersionCount");
-        static const int CreationDate_HASH = HashingUtils::HashString("CreationDate");
+        static constexpr int Title_HASH = HashingUtils::CompileTimeHashString("Title");
+        static constexpr int VersionCount_HASH = HashingUtils::CompileTimeHashString("VersionCount");
+        static constexpr int CreationDate_HASH = HashingUtils::CompileTimeHashString("CreationDate");
 
 
         ProductViewSortBy GetProductViewSortByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Title_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProductViewSortBy::Title;
-          }
-          else if (hashCode == VersionCount_HASH)
-          {
-            return ProductViewSortBy::VersionCount;
-          }
-          else if (hashCode == CreationDate_HASH)
-          {
-            return ProductViewSortBy::CreationDate;
+          case Title_HASH:
+            if (name == "Title")
+            {
+              return ProductViewSortBy::Title;
+            }
+            break;
+          case VersionCount_HASH:
+            if (name == "VersionCount")
+            {
+              return ProductViewSortBy::VersionCount;
+            }
+            break;
+          case CreationDate_HASH:
+            if (name == "CreationDate")
+            {
+              return ProductViewSortBy::CreationDate;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ProductViewSortBy::NOT_SET;
         }
 
-        Aws::String GetNameForProductViewSortBy(ProductViewSortBy enumValue)
+        const char* GetNameForProductViewSortBy(ProductViewSortBy enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace ProvisionedProductPlanStatusMapper
       {
 
-        static const int CREATE_IN_PROGRESS_HASH = HashingUtils::HashString("CREATE_IN_PROGRESS");
-        static const int CREATE_SUCCESS_HASH = HashingUtils::HashString("CREATE_SUCCESS");
-        static const int CREATE_FAILED_HASH = HashingUtils::HashString("CREATE_FAILED");
-        static const int EXECUTE_IN_PROGRESS_HASH = HashingUtils::HashString("EXECUTE_IN_PROGRESS");
-        static const int EXECUTE_SUCCESS_HASH = HashingUtils::HashString("EXECUTE_SUCCESS");
-        static const int EXECUTE_FAILED_HASH = HashingUtils::HashString("EXECUTE_FAILED");
+        static constexpr int CREATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("CREATE_IN_PROGRESS");
+        static constexpr int CREATE_SUCCESS_HASH = HashingUtils::CompileTimeHashString("CREATE_SUCCESS");
+        static constexpr int CREATE_FAILED_HASH = HashingUtils::CompileTimeHashString("CREATE_FAILED");
+        static constexpr int EXECUTE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("EXECUTE_IN_PROGRESS");
+        static constexpr int EXECUTE_SUCCESS_HASH = HashingUtils::CompileTimeHashString("EXECUTE_SUCCESS");
+        static constexpr int EXECUTE_FAILED_HASH = HashingUtils::CompileTimeHashString("EXECUTE_FAILED");
 
 
         ProvisionedProductPlanStatus GetProvisionedProductPlanStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_IN_PROGRESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProvisionedProductPlanStatus::CREATE_IN_PROGRESS;
-          }
-          else if (hashCode == CREATE_SUCCESS_HASH)
-          {
-            return ProvisionedProductPlanStatus::CREATE_SUCCESS;
-          }
-          else if (hashCode == CREATE_FAILED_HASH)
-          {
-            return ProvisionedProductPlanStatus::CREATE_FAILED;
-          }
-          else if (hashCode == EXECUTE_IN_PROGRESS_HASH)
-          {
-            return ProvisionedProductPlanStatus::EXECUTE_IN_PROGRESS;
-          }
-          else if (hashCode == EXECUTE_SUCCESS_HASH)
-          {
-            return ProvisionedProductPlanStatus::EXECUTE_SUCCESS;
-          }
-          else if (hashCode == EXECUTE_FAILED_HASH)
-          {
-            return ProvisionedProductPlanStatus::EXECUTE_FAILED;
+          case CREATE_IN_PROGRESS_HASH:
+            if (name == "CREATE_IN_PROGRESS")
+            {
+              return ProvisionedProductPlanStatus::CREATE_IN_PROGRESS;
+            }
+            break;
+          case CREATE_SUCCESS_HASH:
+            if (name == "CREATE_SUCCESS")
+            {
+              return ProvisionedProductPlanStatus::CREATE_SUCCESS;
+            }
+            break;
+          case CREATE_FAILED_HASH:
+            if (name == "CREATE_FAILED")
+            {
+              return ProvisionedProductPlanStatus::CREATE_FAILED;
+            }
+            break;
+          case EXECUTE_IN_PROGRESS_HASH:
+            if (name == "EXECUTE_IN_PROGRESS")
+            {
+              return ProvisionedProductPlanStatus::EXECUTE_IN_PROGRESS;
+            }
+            break;
+          case EXECUTE_SUCCESS_HASH:
+            if (name == "EXECUTE_SUCCESS")
+            {
+              return ProvisionedProductPlanStatus::EXECUTE_SUCCESS;
+            }
+            break;
+          case EXECUTE_FAILED_HASH:
+            if (name == "EXECUTE_FAILED")
+            {
+              return ProvisionedProductPlanStatus::EXECUTE_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ProvisionedProductPlanStatus::NOT_SET;
         }
 
-        Aws::String GetNameForProvisionedProductPlanStatus(ProvisionedProductPlanStatus enumValue)
+        const char* GetNameForProvisionedProductPlanStatus(ProvisionedProductPlanStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
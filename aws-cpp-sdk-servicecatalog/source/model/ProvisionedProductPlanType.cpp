@@ -30,15 +30,23 @@ namespace Aws
       namespace ProvisionedProductPlanTypeMapper
       {
 
-        static const int CLOUDFORMATION_HASH = HashingUtils::HashString("CLOUDFORMATION");
+        static constexpr int CLOUDFORMATION_HASH = HashingUtils::CompileTimeHashString("CLOUDFORMATION");
 
 
         ProvisionedProductPlanType GetProvisionedProductPlanTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLOUDFORMATION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProvisionedProductPlanType::CLOUDFORMATION;
+          case CLOUDFORMATION_HASH:
+            if (name == "CLOUDFORMATION")
+            {
+              return ProvisionedProductPlanType::CLOUDFORMATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ProvisionedProductPlanType::NOT_SET;
         }
 
-        Aws::String GetNameForProvisionedProductPlanType(ProvisionedProductPlanType enumValue)
+        const char* GetNameForProvisionedProductPlanType(ProvisionedProductPlanType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
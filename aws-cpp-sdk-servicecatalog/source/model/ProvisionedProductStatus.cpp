@@ -30,35 +30,51 @@ namespace Aws
       namespace ProvisionedProductStatusMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int UNDER_CHANGE_HASH = HashingUtils::HashString("UNDER_CHANGE");
-        static const int TAINTED_HASH = HashingUtils::HashString("TAINTED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
-        static const int PLAN_IN_PROGRESS_HASH = HashingUtils::HashString("PLAN_IN_PROGRESS");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int UNDER_CHANGE_HASH = HashingUtils::CompileTimeHashString("UNDER_CHANGE");
+        static constexpr int TAINTED_HASH = HashingUtils::CompileTimeHashString("TAINTED");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
+        static constexpr int PLAN_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("PLAN_IN_PROGRESS");
 
 
         ProvisionedProductStatus GetProvisionedProductStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProvisionedProductStatus::AVAILABLE;
-          }
-          else if (hashCode == UNDER_CHANGE_HASH)
-          {
-            return ProvisionedProductStatus::UNDER_CHANGE;
-          }
-          else if (hashCode == TAINTED_HASH)
-          {
-            return ProvisionedProductStatus::TAINTED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return ProvisionedProductStatus::ERROR_;
-          }
-          else if (hashCode == PLAN_IN_PROGRESS_HASH)
-          {
-            return ProvisionedProductStatus::PLAN_IN_PROGRESS;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return ProvisionedProductStatus::AVAILABLE;
+            }
+            break;
+          case UNDER_CHANGE_HASH:
+            if (name == "UNDER_CHANGE")
+            {
+              return ProvisionedProductStatus::UNDER_CHANGE;
+            }
+            break;
+          case TAINTED_HASH:
+            if (name == "TAINTED")
+            {
+              return ProvisionedProductStatus::TAINTED;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return ProvisionedProductStatus::ERROR_;
+            }
+            break;
+          case PLAN_IN_PROGRESS_HASH:
+            if (name == "PLAN_IN_PROGRESS")
+            {
+              return ProvisionedProductStatus::PLAN_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ProvisionedProductStatus::NOT_SET;
         }
 
-        Aws::String GetNameForProvisionedProductStatus(ProvisionedProductStatus enumValue)
+        const char* GetNameForProvisionedProductStatus(ProvisionedProductStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
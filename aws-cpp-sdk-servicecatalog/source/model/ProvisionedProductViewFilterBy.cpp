@@ -30,15 +30,23 @@ namespace Aws
       namespace ProvisionedProductViewFilterByMapper
       {
 
-        static const int SearchQuery_HASH = HashingUtils::HashString("SearchQuery");
+        static constexpr int SearchQuery_HASH = HashingUtils::CompileTimeHashString("SearchQuery");
 
 
         ProvisionedProductViewFilterBy GetProvisionedProductViewFilterByForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SearchQuery_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProvisionedProductViewFilterBy::SearchQuery;
+          case SearchQuery_HASH:
+            if (name == "SearchQuery")
+            {
+              return ProvisionedProductViewFilterBy::SearchQuery;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ProvisionedProductViewFilterBy::NOT_SET;
         }
 
-        Aws::String GetNameForProvisionedProductViewFilterBy(ProvisionedProductViewFilterBy enumValue)
+        const char* GetNameForProvisionedProductViewFilterBy(ProvisionedProductViewFilterBy enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ProvisioningArtifactPropertyNameMapper
       {
 
-        static const int Id_HASH = HashingUtils::HashString("Id");
+        static constexpr int Id_HASH = HashingUtils::CompileTimeHashString("Id");
 
 
         ProvisioningArtifactPropertyName GetProvisioningArtifactPropertyNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Id_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProvisioningArtifactPropertyName::Id;
+          case Id_HASH:
+            if (name == "Id")
+            {
+              return ProvisioningArtifactPropertyName::Id;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ProvisioningArtifactPropertyName::NOT_SET;
         }
 
-        Aws::String GetNameForProvisioningArtifactPropertyName(ProvisioningArtifactPropertyName enumValue)
+        const char* GetNameForProvisioningArtifactPropertyName(ProvisioningArtifactPropertyName enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ProvisioningArtifactTypeMapper
       {
 
-        static const int CLOUD_FORMATION_TEMPLATE_HASH = HashingUtils::HashString("CLOUD_FORMATION_TEMPLATE");
-        static const int MARKETPLACE_AMI_HASH = HashingUtils::HashString("MARKETPLACE_AMI");
-        static const int MARKETPLACE_CAR_HASH = HashingUtils::HashString("MARKETPLACE_CAR");
+        static constexpr int CLOUD_FORMATION_TEMPLATE_HASH = HashingUtils::CompileTimeHashString("CLOUD_FORMATION_TEMPLATE");
+        static constexpr int MARKETPLACE_AMI_HASH = HashingUtils::CompileTimeHashString("MARKETPLACE_AMI");
+        static constexpr int MARKETPLACE_CAR_HASH = HashingUtils::CompileTimeHashString("MARKETPLACE_CAR");
 
 
         ProvisioningArtifactType GetProvisioningArtifactTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CLOUD_FORMATION_TEMPLATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ProvisioningArtifactType::CLOUD_FORMATION_TEMPLATE;
-          }
-          else if (hashCode == MARKETPLACE_AMI_HASH)
-          {
-            return ProvisioningArtifactType::MARKETPLACE_AMI;
-          }
-          else if (hashCode == MARKETPLACE_CAR_HASH)
-          {
-            return ProvisioningArtifactType::MARKETPLACE_CAR;
+          case CLOUD_FORMATION_TEMPLATE_HASH:
+            if (name == "CLOUD_FORMATION_TEMPLATE")
+            {
+              return ProvisioningArtifactType::CLOUD_FORMATION_TEMPLATE;
+            }
+            break;
+          case MARKETPLACE_AMI_HASH:
+            if (name == "MARKETPLACE_AMI")
+            {
+              return ProvisioningArtifactType::MARKETPLACE_AMI;
+            }
+            break;
+          case MARKETPLACE_CAR_HASH:
+            if (name == "MARKETPLACE_CAR")
+            {
+              return ProvisioningArtifactType::MARKETPLACE_CAR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ProvisioningArtifactType::NOT_SET;
         }
 
-        Aws::String GetNameForProvisioningArtifactType(ProvisioningArtifactType enumValue)
+        const char* GetNameForProvisioningArtifactType(ProvisioningArtifactType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
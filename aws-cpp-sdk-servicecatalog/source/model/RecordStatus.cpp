@@ -30,35 +30,51 @@ namespace Aws
       namespace RecordStatusMapper
       {
 
-        static const int CREATED_HASH = HashingUtils::HashString("CREATED");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int IN_PROGRESS_IN_ERROR_HASH = HashingUtils::HashString("IN_PROGRESS_IN_ERROR");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int CREATED_HASH = HashingUtils::CompileTimeHashString("CREATED");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int IN_PROGRESS_IN_ERROR_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS_IN_ERROR");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         RecordStatus GetRecordStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RecordStatus::CREATED;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return RecordStatus::IN_PROGRESS;
-          }
-          else if (hashCode == IN_PROGRESS_IN_ERROR_HASH)
-          {
-            return RecordStatus::IN_PROGRESS_IN_ERROR;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return RecordStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return RecordStatus::FAILED;
+          case CREATED_HASH:
+            if (name == "CREATED")
+            {
+              return RecordStatus::CREATED;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return RecordStatus::IN_PROGRESS;
+            }
+            break;
+          case IN_PROGRESS_IN_ERROR_HASH:
+            if (name == "IN_PROGRESS_IN_ERROR")
+            {
+              return RecordStatus::IN_PROGRESS_IN_ERROR;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return RecordStatus::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return RecordStatus::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return RecordStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRecordStatus(RecordStatus enumValue)
+        const char* GetNameForRecordStatus(RecordStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ReplacementMapper
       {
 
-        static const int TRUE_HASH = HashingUtils::HashString("TRUE");
-        static const int FALSE_HASH = HashingUtils::HashString("FALSE");
-        static const int CONDITIONAL_HASH = HashingUtils::HashString("CONDITIONAL");
+        static constexpr int TRUE_HASH = HashingUtils::CompileTimeHashString("TRUE");
+        static constexpr int FALSE_HASH = HashingUtils::CompileTimeHashString("FALSE");
+        static constexpr int CONDITIONAL_HASH = HashingUtils::CompileTimeHashString("CONDITIONAL");
 
 
         Replacement GetReplacementForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRUE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Replacement::TRUE;
-          }
-          else if (hashCode == FALSE_HASH)
-          {
-            return Replacement::FALSE;
-          }
-          else if (hashCode == CONDITIONAL_HASH)
-          {
-            return Replacement::CONDITIONAL;
+          case TRUE_HASH:
+            if (name == "TRUE")
+            {
+              return Replacement::TRUE;
+            }
+            break;
+          case FALSE_HASH:
+            if (name == "FALSE")
+            {
+              return Replacement::FALSE;
+            }
+            break;
+          case CONDITIONAL_HASH:
+            if (name == "CONDITIONAL")
+            {
+              return Replacement::CONDITIONAL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Replacement::NOT_SET;
         }
 
-        Aws::String GetNameForReplacement(Replacement enumValue)
+        const char* GetNameForReplacement(Replacement enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace RequiresRecreationMapper
       {
 
-        static const int NEVER_HASH = HashingUtils::HashString("NEVER");
-        static const int CONDITIONALLY_HASH = HashingUtils::HashString("CONDITIONALLY");
-        static const int ALWAYS_HASH = HashingUtils::HashString("ALWAYS");
+        static constexpr int NEVER_HASH = HashingUtils::CompileTimeHashString("NEVER");
+        static constexpr int CONDITIONALLY_HASH = HashingUtils::CompileTimeHashString("CONDITIONALLY");
+        static constexpr int ALWAYS_HASH = HashingUtils::CompileTimeHashString("ALWAYS");
 
 
         RequiresRecreation GetRequiresRecreationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NEVER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RequiresRecreation::NEVER;
-          }
-          else if (hashCode == CONDITIONALLY_HASH)
-          {
-            return RequiresRecreation::CONDITIONALLY;
-          }
-          else if (hashCode == ALWAYS_HASH)
-          {
-            return RequiresRecreation::ALWAYS;
+          case NEVER_HASH:
+            if (name == "NEVER")
+            {
+              return RequiresRecreation::NEVER;
+            }
+            break;
+          case CONDITIONALLY_HASH:
+            if (name == "CONDITIONALLY")
+            {
+              return RequiresRecreation::CONDITIONALLY;
+            }
+            break;
+          case ALWAYS_HASH:
+            if (name == "ALWAYS")
+            {
+              return RequiresRecreation::ALWAYS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return RequiresRecreation::NOT_SET;
         }
 
-        Aws::String GetNameForRequiresRecreation(RequiresRecreation enumValue)
+        const char* GetNameForRequiresRecreation(RequiresRecreation enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
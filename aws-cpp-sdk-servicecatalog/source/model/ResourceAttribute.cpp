@@ -30,40 +30,58 @@ namespace Aws
       namespace ResourceAttributeMapper
       {
 
-        static const int PROPERTIES_HASH = HashingUtils::HashString("PROPERTIES");
-        static const int METADATA_HASH = HashingUtils::HashString("METADATA");
-        static const int CREATIONPOLICY_HASH = HashingUtils::HashString("CREATIONPOLICY");
-        static const int UPDATEPOLICY_HASH = HashingUtils::HashString("UPDATEPOLICY");
-        static const int DELETIONPOLICY_HASH = HashingUtils::HashString("DELETIONPOLICY");
-        static const int TAGS_HASH = HashingUtils::HashString("TAGS");
+        static constexpr int PROPERTIES_HASH = HashingUtils::CompileTimeHashString("PROPERTIES");
+        static constexpr int METADATA_HASH = HashingUtils::CompileTimeHashString("METADATA");
+        static constexpr int CREATIONPOLICY_HASH = HashingUtils::CompileTimeHashString("CREATIONPOLICY");
+        static constexpr int UPDATEPOLICY_HASH = HashingUtils::CompileTimeHashString("UPDATEPOLICY");
+        static constexpr int DELETIONPOLICY_HASH = HashingUtils::CompileTimeHashString("DELETIONPOLICY");
+        static constexpr int TAGS_HASH = HashingUtils::CompileTimeHashString("TAGS");
 
 
         ResourceAttribute GetResourceAttributeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROPERTIES_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceAttribute::PROPERTIES;
-          }
-          else if (hashCode == METADATA_HASH)
-          {
-            return ResourceAttribute::METADATA;
-          }
-          else if (hashCode == CREATIONPOLICY_HASH)
-          {
-            return ResourceAttribute::CREATIONPOLICY;
-          }
-          else if (hashCode == UPDATEPOLICY_HASH)
-          {
-            return ResourceAttribute::UPDATEPOLICY;
-          }
-          else if (hashCode == DELETIONPOLICY_HASH)
-          {
-            return ResourceAttribute::DELETIONPOLICY;
-          }
-          else if (hashCode == TAGS_HASH)
-          {
-            return ResourceAttribute::TAGS;
+          case PROPERTIES_HASH:
+            if (name == "PROPERTIES")
+            {
+              return ResourceAttribute::PROPERTIES;
+            }
+            break;
+          case METADATA_HASH:
+            if (name == "METADATA")
+            {
+              return ResourceAttribute::METADATA;
+            }
+            break;
+          case CREATIONPOLICY_HASH:
+            if (name == "CREATIONPOLICY")
+            {
+              return ResourceAttribute::CREATIONPOLICY;
+            }
+            break;
+          case UPDATEPOLICY_HASH:
+            if (name == "UPDATEPOLICY")
+            {
+              return ResourceAttribute::UPDATEPOLICY;
+            }
+            break;
+          case DELETIONPOLICY_HASH:
+            if (name == "DELETIONPOLICY")
+            {
+              return ResourceAttribute::DELETIONPOLICY;
+            }
+            break;
+          case TAGS_HASH:
+            if (name == "TAGS")
+            {
+              return ResourceAttribute::TAGS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ResourceAttribute::NOT_SET;
         }
 
-        Aws::String GetNameForResourceAttribute(ResourceAttribute enumValue)
+        const char* GetNameForResourceAttribute(ResourceAttribute enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
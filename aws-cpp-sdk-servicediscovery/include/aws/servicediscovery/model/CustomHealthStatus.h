@@ -34,7 +34,8 @@ namespace CustomHealthStatusMapper
 {
 AWS_SERVICEDISCOVERY_API CustomHealthStatus GetCustomHealthStatusForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForCustomHealthStatus(CustomHealthStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForCustomHealthStatus(CustomHealthStatus value);
 } // namespace CustomHealthStatusMapper
 } // namespace Model
 } // namespace ServiceDiscovery
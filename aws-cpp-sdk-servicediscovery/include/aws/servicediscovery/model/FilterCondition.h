@@ -35,7 +35,8 @@ namespace FilterConditionMapper
 {
 AWS_SERVICEDISCOVERY_API FilterCondition GetFilterConditionForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForFilterCondition(FilterCondition value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForFilterCondition(FilterCondition value);
 } // namespace FilterConditionMapper
 } // namespace Model
 } // namespace ServiceDiscovery
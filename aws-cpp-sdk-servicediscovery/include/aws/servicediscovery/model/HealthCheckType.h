@@ -35,7 +35,8 @@ namespace HealthCheckTypeMapper
 {
 AWS_SERVICEDISCOVERY_API HealthCheckType GetHealthCheckTypeForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForHealthCheckType(HealthCheckType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForHealthCheckType(HealthCheckType value);
 } // namespace HealthCheckTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -35,7 +35,8 @@ namespace HealthStatusMapper
 {
 AWS_SERVICEDISCOVERY_API HealthStatus GetHealthStatusForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForHealthStatus(HealthStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForHealthStatus(HealthStatus value);
 } // namespace HealthStatusMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -33,7 +33,8 @@ namespace NamespaceFilterNameMapper
 {
 AWS_SERVICEDISCOVERY_API NamespaceFilterName GetNamespaceFilterNameForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForNamespaceFilterName(NamespaceFilterName value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForNamespaceFilterName(NamespaceFilterName value);
 } // namespace NamespaceFilterNameMapper
 } // namespace Model
 } // namespace ServiceDiscovery
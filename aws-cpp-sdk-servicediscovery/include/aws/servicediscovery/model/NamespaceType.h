@@ -34,7 +34,8 @@ namespace NamespaceTypeMapper
 {
 AWS_SERVICEDISCOVERY_API NamespaceType GetNamespaceTypeForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForNamespaceType(NamespaceType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForNamespaceType(NamespaceType value);
 } // namespace NamespaceTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -37,7 +37,8 @@ namespace OperationFilterNameMapper
 {
 AWS_SERVICEDISCOVERY_API OperationFilterName GetOperationFilterNameForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForOperationFilterName(OperationFilterName value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForOperationFilterName(OperationFilterName value);
 } // namespace OperationFilterNameMapper
 } // namespace Model
 } // namespace ServiceDiscovery
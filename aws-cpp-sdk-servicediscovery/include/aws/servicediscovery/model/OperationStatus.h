@@ -36,7 +36,8 @@ namespace OperationStatusMapper
 {
 AWS_SERVICEDISCOVERY_API OperationStatus GetOperationStatusForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForOperationStatus(OperationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForOperationStatus(OperationStatus value);
 } // namespace OperationStatusMapper
 } // namespace Model
 } // namespace ServiceDiscovery
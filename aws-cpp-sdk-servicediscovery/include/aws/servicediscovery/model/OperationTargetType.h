@@ -35,7 +35,8 @@ namespace OperationTargetTypeMapper
 {
 AWS_SERVICEDISCOVERY_API OperationTargetType GetOperationTargetTypeForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForOperationTargetType(OperationTargetType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForOperationTargetType(OperationTargetType value);
 } // namespace OperationTargetTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
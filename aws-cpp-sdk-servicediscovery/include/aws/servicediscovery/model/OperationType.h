@@ -37,7 +37,8 @@ namespace OperationTypeMapper
 {
 AWS_SERVICEDISCOVERY_API OperationType GetOperationTypeForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForOperationType(OperationType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForOperationType(OperationType value);
 } // namespace OperationTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
@@ -36,7 +36,8 @@ namespace RecordTypeMapper
 {
 AWS_SERVICEDISCOVERY_API RecordType GetRecordTypeForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForRecordType(RecordType value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForRecordType(RecordType value);
 } // namespace RecordTypeMapper
 } // namespace Model
 } // namespace ServiceDiscovery
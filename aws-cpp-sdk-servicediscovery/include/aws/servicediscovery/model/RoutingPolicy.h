@@ -34,7 +34,8 @@ namespace RoutingPolicyMapper
 {
 AWS_SERVICEDISCOVERY_API RoutingPolicy GetRoutingPolicyForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForRoutingPolicy(RoutingPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForRoutingPolicy(RoutingPolicy value);
 } // namespace RoutingPolicyMapper
 } // namespace Model
 } // namespace ServiceDiscovery
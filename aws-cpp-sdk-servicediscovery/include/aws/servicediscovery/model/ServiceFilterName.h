@@ -33,7 +33,8 @@ namespace ServiceFilterNameMapper
 {
 AWS_SERVICEDISCOVERY_API ServiceFilterName GetServiceFilterNameForName(const Aws::String& name);
 
-AWS_SERVICEDISCOVERY_API Aws::String GetNameForServiceFilterName(ServiceFilterName value);
+// names of values not modeled point into the enum overflow container
+AWS_SERVICEDISCOVERY_API const char* GetNameForServiceFilterName(ServiceFilterName value);
 } // namespace ServiceFilterNameMapper
 } // namespace Model
 } // namespace ServiceDiscovery
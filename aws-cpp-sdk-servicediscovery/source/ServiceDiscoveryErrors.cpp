@@ -28,17 +28,17 @@ namespace ServiceDiscovery
 namespace ServiceDiscoveryErrorMapper
 {
 
-static const int SERVICE_NOT_FOUND_HASH = HashingUtils::HashString("ServiceNotFound");
-static const int CUSTOM_HEALTH_NOT_FOUND_HASH = HashingUtils::HashString("CustomHealthNotFound");
-static const int DUPLICATE_REQUEST_HASH = HashingUtils::HashString("DuplicateRequest");
-static const int SERVICE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ServiceAlreadyExists");
-static const int OPERATION_NOT_FOUND_HASH = HashingUtils::HashString("OperationNotFound");
-static const int INSTANCE_NOT_FOUND_HASH = HashingUtils::HashString("InstanceNotFound");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUse");
-static const int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ResourceLimitExceeded");
-static const int INVALID_INPUT_HASH = HashingUtils::HashString("InvalidInput");
-static const int NAMESPACE_ALREADY_EXISTS_HASH = HashingUtils::HashString("NamespaceAlreadyExists");
-static const int NAMESPACE_NOT_FOUND_HASH = HashingUtils::HashString("NamespaceNotFound");
+static constexpr int SERVICE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ServiceNotFound");
+static constexpr int CUSTOM_HEALTH_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("CustomHealthNotFound");
+static constexpr int DUPLICATE_REQUEST_HASH = HashingUtils::CompileTimeHashString("DuplicateRequest");
+static constexpr int SERVICE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ServiceAlreadyExists");
+static constexpr int OPERATION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("OperationNotFound");
+static constexpr int INSTANCE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("InstanceNotFound");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUse");
+static constexpr int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceLimitExceeded");
+static constexpr int INVALID_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidInput");
+static constexpr int NAMESPACE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("NamespaceAlreadyExists");
+static constexpr int NAMESPACE_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NamespaceNotFound");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
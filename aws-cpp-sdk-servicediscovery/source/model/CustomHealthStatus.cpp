@@ -30,20 +30,30 @@ namespace Aws
       namespace CustomHealthStatusMapper
       {
 
-        static const int HEALTHY_HASH = HashingUtils::HashString("HEALTHY");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
+        static constexpr int HEALTHY_HASH = HashingUtils::CompileTimeHashString("HEALTHY");
+        static constexpr int UNHEALTHY_HASH = HashingUtils::CompileTimeHashString("UNHEALTHY");
 
 
         CustomHealthStatus GetCustomHealthStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HEALTHY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CustomHealthStatus::HEALTHY;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return CustomHealthStatus::UNHEALTHY;
+          case HEALTHY_HASH:
+            if (name == "HEALTHY")
+            {
+              return CustomHealthStatus::HEALTHY;
+            }
+            break;
+          case UNHEALTHY_HASH:
+            if (name == "UNHEALTHY")
+            {
+              return CustomHealthStatus::UNHEALTHY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CustomHealthStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCustomHealthStatus(CustomHealthStatus enumValue)
+        const char* GetNameForCustomHealthStatus(CustomHealthStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
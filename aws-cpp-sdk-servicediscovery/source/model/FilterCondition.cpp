@@ -30,25 +30,37 @@ namespace Aws
       namespace FilterConditionMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int BETWEEN_HASH = HashingUtils::HashString("BETWEEN");
+        static constexpr int EQ_HASH = HashingUtils::CompileTimeHashString("EQ");
+        static constexpr int IN_HASH = HashingUtils::CompileTimeHashString("IN");
+        static constexpr int BETWEEN_HASH = HashingUtils::CompileTimeHashString("BETWEEN");
 
 
         FilterCondition GetFilterConditionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FilterCondition::EQ;
-          }
-          else if (hashCode == IN_HASH)
-          {
-            return FilterCondition::IN;
-          }
-          else if (hashCode == BETWEEN_HASH)
-          {
-            return FilterCondition::BETWEEN;
+          case EQ_HASH:
+            if (name == "EQ")
+            {
+              return FilterCondition::EQ;
+            }
+            break;
+          case IN_HASH:
+            if (name == "IN")
+            {
+              return FilterCondition::IN;
+            }
+            break;
+          case BETWEEN_HASH:
+            if (name == "BETWEEN")
+            {
+              return FilterCondition::BETWEEN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FilterCondition::NOT_SET;
         }
 
-        Aws::String GetNameForFilterCondition(FilterCondition enumValue)
+        const char* GetNameForFilterCondition(FilterCondition enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
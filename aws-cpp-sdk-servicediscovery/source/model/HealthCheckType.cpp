@@ -30,25 +30,37 @@ namespace Aws
       namespace HealthCheckTypeMapper
       {
 
-        static const int HTTP_HASH = HashingUtils::HashString("HTTP");
-        static const int HTTPS_HASH = HashingUtils::HashString("HTTPS");
-        static const int TCP_HASH = HashingUtils::HashString("TCP");
+        static constexpr int HTTP_HASH = HashingUtils::CompileTimeHashString("HTTP");
+        static constexpr int HTTPS_HASH = HashingUtils::CompileTimeHashString("HTTPS");
+        static constexpr int TCP_HASH = HashingUtils::CompileTimeHashString("TCP");
 
 
         HealthCheckType GetHealthCheckTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HealthCheckType::HTTP;
-          }
-          else if (hashCode == HTTPS_HASH)
-          {
-            return HealthCheckType::HTTPS;
-          }
-          else if (hashCode == TCP_HASH)
-          {
-            return HealthCheckType::TCP;
+          case HTTP_HASH:
+            if (name == "HTTP")
+            {
+              return HealthCheckType::HTTP;
+            }
+            break;
+          case HTTPS_HASH:
+            if (name == "HTTPS")
+            {
+              return HealthCheckType::HTTPS;
+            }
+            break;
+          case TCP_HASH:
+            if (name == "TCP")
+            {
+              return HealthCheckType::TCP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return HealthCheckType::NOT_SET;
         }
 
-        Aws::String GetNameForHealthCheckType(HealthCheckType enumValue)
+        const char* GetNameForHealthCheckType(HealthCheckType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
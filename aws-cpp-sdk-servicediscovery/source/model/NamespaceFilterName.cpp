@@ -30,15 +30,23 @@ namespace Aws
       namespace NamespaceFilterNameMapper
       {
 
-        static const int TYPE_HASH = HashingUtils::HashString("TYPE");
+        static constexpr int TYPE_HASH = HashingUtils::CompileTimeHashString("TYPE");
 
 
         NamespaceFilterName GetNamespaceFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TYPE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NamespaceFilterName::TYPE;
+          case TYPE_HASH:
+            if (name == "TYPE")
+            {
+              return NamespaceFilterName::TYPE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return NamespaceFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForNamespaceFilterName(NamespaceFilterName enumValue)
+        const char* GetNameForNamespaceFilterName(NamespaceFilterName enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace NamespaceTypeMapper
       {
 
-        static const int DNS_PUBLIC_HASH = HashingUtils::HashString("DNS_PUBLIC");
-        static const int DNS_PRIVATE_HASH = HashingUtils::HashString("DNS_PRIVATE");
+        static constexpr int DNS_PUBLIC_HASH = HashingUtils::CompileTimeHashString("DNS_PUBLIC");
+        static constexpr int DNS_PRIVATE_HASH = HashingUtils::CompileTimeHashString("DNS_PRIVATE");
 
 
         NamespaceType GetNamespaceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DNS_PUBLIC_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NamespaceType::DNS_PUBLIC;
-          }
-          else if (hashCode == DNS_PRIVATE_HASH)
-          {
-            return NamespaceType::DNS_PRIVATE;
+          case DNS_PUBLIC_HASH:
+            if (name == "DNS_PUBLIC")
+            {
+              return NamespaceType::DNS_PUBLIC;
+            }
+            break;
+          case DNS_PRIVATE_HASH:
+            if (name == "DNS_PRIVATE")
+            {
+              return NamespaceType::DNS_PRIVATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return NamespaceType::NOT_SET;
         }
 
-        Aws::String GetNameForNamespaceType(NamespaceType enumValue)
+        const char* GetNameForNamespaceType(NamespaceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
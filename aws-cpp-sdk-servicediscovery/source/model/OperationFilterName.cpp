@@ -30,35 +30,51 @@ namespace Aws
       namespace OperationFilterNameMapper
       {
 
-        static const int NAMESPACE_ID_HASH = HashingUtils::HashString("NAMESPACE_ID");
-        static const int SERVICE_ID_HASH = HashingUtils::HashString("SERVICE_ID");
-        static const int STATUS_HASH = HashingUtils::HashString("STATUS");
-        static const int TYPE_HASH = HashingUtils::HashString("TYPE");
-        static const int UPDATE_DATE_HASH = HashingUtils::HashString("UPDATE_DATE");
+        static constexpr int NAMESPACE_ID_HASH = HashingUtils::CompileTimeHashString("NAMESPACE_ID");
+        static constexpr int SERVICE_ID_HASH = HashingUtils::CompileTimeHashString("SERVICE_ID");
+        static constexpr int STATUS_HASH = HashingUtils::CompileTimeHashString("STATUS");
+        static constexpr int TYPE_HASH = HashingUtils::CompileTimeHashString("TYPE");
+        static constexpr int UPDATE_DATE_HASH = HashingUtils::CompileTimeHashString("UPDATE_DATE");
 
 
         OperationFilterName GetOperationFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAMESPACE_ID_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationFilterName::NAMESPACE_ID;
-          }
-          else if (hashCode == SERVICE_ID_HASH)
-          {
-            return OperationFilterName::SERVICE_ID;
-          }
-          else if (hashCode == STATUS_HASH)
-          {
-            return OperationFilterName::STATUS;
-          }
-          else if (hashCode == TYPE_HASH)
-          {
-            return OperationFilterName::TYPE;
-          }
-          else if (hashCode == UPDATE_DATE_HASH)
-          {
-            return OperationFilterName::UPDATE_DATE;
+          case NAMESPACE_ID_HASH:
+            if (name == "NAMESPACE_ID")
+            {
+              return OperationFilterName::NAMESPACE_ID;
+            }
+            break;
+          case SERVICE_ID_HASH:
+            if (name == "SERVICE_ID")
+            {
+              return OperationFilterName::SERVICE_ID;
+            }
+            break;
+          case STATUS_HASH:
+            if (name == "STATUS")
+            {
+              return OperationFilterName::STATUS;
+            }
+            break;
+          case TYPE_HASH:
+            if (name == "TYPE")
+            {
+              return OperationFilterName::TYPE;
+            }
+            break;
+          case UPDATE_DATE_HASH:
+            if (name == "UPDATE_DATE")
+            {
+              return OperationFilterName::UPDATE_DATE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return OperationFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForOperationFilterName(OperationFilterName enumValue)
+        const char* GetNameForOperationFilterName(OperationFilterName enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace OperationStatusMapper
       {
 
-        static const int SUBMITTED_HASH = HashingUtils::HashString("SUBMITTED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAIL_HASH = HashingUtils::HashString("FAIL");
+        static constexpr int SUBMITTED_HASH = HashingUtils::CompileTimeHashString("SUBMITTED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int FAIL_HASH = HashingUtils::CompileTimeHashString("FAIL");
 
 
         OperationStatus GetOperationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUBMITTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationStatus::SUBMITTED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return OperationStatus::PENDING;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return OperationStatus::SUCCESS;
-          }
-          else if (hashCode == FAIL_HASH)
-          {
-            return OperationStatus::FAIL;
+          case SUBMITTED_HASH:
+            if (name == "SUBMITTED")
+            {
+              return OperationStatus::SUBMITTED;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return OperationStatus::PENDING;
+            }
+            break;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return OperationStatus::SUCCESS;
+            }
+            break;
+          case FAIL_HASH:
+            if (name == "FAIL")
+            {
+              return OperationStatus::FAIL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return OperationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForOperationStatus(OperationStatus enumValue)
+        const char* GetNameForOperationStatus(OperationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace OperationTargetTypeMapper
       {
 
-        static const int NAMESPACE_HASH = HashingUtils::HashString("NAMESPACE");
-        static const int SERVICE_HASH = HashingUtils::HashString("SERVICE");
-        static const int INSTANCE_HASH = HashingUtils::HashString("INSTANCE");
+        static constexpr int NAMESPACE_HASH = HashingUtils::CompileTimeHashString("NAMESPACE");
+        static constexpr int SERVICE_HASH = HashingUtils::CompileTimeHashString("SERVICE");
+        static constexpr int INSTANCE_HASH = HashingUtils::CompileTimeHashString("INSTANCE");
 
 
         OperationTargetType GetOperationTargetTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAMESPACE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationTargetType::NAMESPACE;
-          }
-          else if (hashCode == SERVICE_HASH)
-          {
-            return OperationTargetType::SERVICE;
-          }
-          else if (hashCode == INSTANCE_HASH)
-          {
-            return OperationTargetType::INSTANCE;
+          case NAMESPACE_HASH:
+            if (name == "NAMESPACE")
+            {
+              return OperationTargetType::NAMESPACE;
+            }
+            break;
+          case SERVICE_HASH:
+            if (name == "SERVICE")
+            {
+              return OperationTargetType::SERVICE;
+            }
+            break;
+          case INSTANCE_HASH:
+            if (name == "INSTANCE")
+            {
+              return OperationTargetType::INSTANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return OperationTargetType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationTargetType(OperationTargetType enumValue)
+        const char* GetNameForOperationTargetType(OperationTargetType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace OperationTypeMapper
       {
 
-        static const int CREATE_NAMESPACE_HASH = HashingUtils::HashString("CREATE_NAMESPACE");
-        static const int DELETE_NAMESPACE_HASH = HashingUtils::HashString("DELETE_NAMESPACE");
-        static const int UPDATE_SERVICE_HASH = HashingUtils::HashString("UPDATE_SERVICE");
-        static const int REGISTER_INSTANCE_HASH = HashingUtils::HashString("REGISTER_INSTANCE");
-        static const int DEREGISTER_INSTANCE_HASH = HashingUtils::HashString("DEREGISTER_INSTANCE");
+        static constexpr int CREATE_NAMESPACE_HASH = HashingUtils::CompileTimeHashString("CREATE_NAMESPACE");
+        static constexpr int DELETE_NAMESPACE_HASH = HashingUtils::CompileTimeHashString("DELETE_NAMESPACE");
+        static constexpr int UPDATE_SERVICE_HASH = HashingUtils::CompileTimeHashString("UPDATE_SERVICE");
+        static constexpr int REGISTER_INSTANCE_HASH = HashingUtils::CompileTimeHashString("REGISTER_INSTANCE");
+        static constexpr int DEREGISTER_INSTANCE_HASH = HashingUtils::CompileTimeHashString("DEREGISTER_INSTANCE");
 
 
         OperationType GetOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CREATE_NAMESPACE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperationType::CREATE_NAMESPACE;
-          }
-          else if (hashCode == DELETE_NAMESPACE_HASH)
-          {
-            return OperationType::DELETE_NAMESPACE;
-          }
-          else if (hashCode == UPDATE_SERVICE_HASH)
-          {
-            return OperationType::UPDATE_SERVICE;
-          }
-          else if (hashCode == REGISTER_INSTANCE_HASH)
-          {
-            return OperationType::REGISTER_INSTANCE;
-          }
-          else if (hashCode == DEREGISTER_INSTANCE_HASH)
-          {
-            return OperationType::DEREGISTER_INSTANCE;
+          case CREATE_NAMESPACE_HASH:
+            if (name == "CREATE_NAMESPACE")
+            {
+              return OperationType::CREATE_NAMESPACE;
+            }
+            break;
+          case DELETE_NAMESPACE_HASH:
+            if (name == "DELETE_NAMESPACE")
+            {
+              return OperationType::DELETE_NAMESPACE;
+            }
+            break;
+          case UPDATE_SERVICE_HASH:
+            if (name == "UPDATE_SERVICE")
+            {
+              return OperationType::UPDATE_SERVICE;
+            }
+            break;
+          case REGISTER_INSTANCE_HASH:
+            if (name == "REGISTER_INSTANCE")
+            {
+              return OperationType::REGISTER_INSTANCE;
+            }
+            break;
+          case DEREGISTER_INSTANCE_HASH:
+            if (name == "DEREGISTER_INSTANCE")
+            {
+              return OperationType::DEREGISTER_INSTANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return OperationType::NOT_SET;
         }
 
-        Aws::String GetNameForOperationType(OperationType enumValue)
+        const char* GetNameForOperationType(OperationType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace RecordTypeMapper
       {
 
-        static const int SRV_HASH = HashingUtils::HashString("SRV");
-        static const int A_HASH = HashingUtils::HashString("A");
-        static const int AAAA_HASH = HashingUtils::HashString("AAAA");
-        static const int CNAME_HASH = HashingUtils::HashString("CNAME");
+        static constexpr int SRV_HASH = HashingUtils::CompileTimeHashString("SRV");
+        static constexpr int A_HASH = HashingUtils::CompileTimeHashString("A");
+        static constexpr int AAAA_HASH = HashingUtils::CompileTimeHashString("AAAA");
+        static constexpr int CNAME_HASH = HashingUtils::CompileTimeHashString("CNAME");
 
 
         RecordType GetRecordTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SRV_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RecordType::SRV;
-          }
-          else if (hashCode == A_HASH)
-          {
-            return RecordType::A;
-          }
-          else if (hashCode == AAAA_HASH)
-          {
-            return RecordType::AAAA;
-          }
-          else if (hashCode == CNAME_HASH)
-          {
-            return RecordType::CNAME;
+          case SRV_HASH:
+            if (name == "SRV")
+            {
+              return RecordType::SRV;
+            }
+            break;
+          case A_HASH:
+            if (name == "A")
+            {
+              return RecordType::A;
+            }
+            break;
+          case AAAA_HASH:
+            if (name == "AAAA")
+            {
+              return RecordType::AAAA;
+            }
+            break;
+          case CNAME_HASH:
+            if (name == "CNAME")
+            {
+              return RecordType::CNAME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return RecordType::NOT_SET;
         }
 
-        Aws::String GetNameForRecordType(RecordType enumValue)
+        const char* GetNameForRecordType(RecordType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace RoutingPolicyMapper
       {
 
-        static const int MULTIVALUE_HASH = HashingUtils::HashString("MULTIVALUE");
-        static const int WEIGHTED_HASH = HashingUtils::HashString("WEIGHTED");
+        static constexpr int MULTIVALUE_HASH = HashingUtils::CompileTimeHashString("MULTIVALUE");
+        static constexpr int WEIGHTED_HASH = HashingUtils::CompileTimeHashString("WEIGHTED");
 
 
         RoutingPolicy GetRoutingPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == MULTIVALUE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RoutingPolicy::MULTIVALUE;
-          }
-          else if (hashCode == WEIGHTED_HASH)
-          {
-            return RoutingPolicy::WEIGHTED;
+          case MULTIVALUE_HASH:
+            if (name == "MULTIVALUE")
+            {
+              return RoutingPolicy::MULTIVALUE;
+            }
+            break;
+          case WEIGHTED_HASH:
+            if (name == "WEIGHTED")
+            {
+              return RoutingPolicy::WEIGHTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RoutingPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForRoutingPolicy(RoutingPolicy enumValue)
+        const char* GetNameForRoutingPolicy(RoutingPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ServiceFilterNameMapper
       {
 
-        static const int NAMESPACE_ID_HASH = HashingUtils::HashString("NAMESPACE_ID");
+        static constexpr int NAMESPACE_ID_HASH = HashingUtils::CompileTimeHashString("NAMESPACE_ID");
 
 
         ServiceFilterName GetServiceFilterNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NAMESPACE_ID_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServiceFilterName::NAMESPACE_ID;
+          case NAMESPACE_ID_HASH:
+            if (name == "NAMESPACE_ID")
+            {
+              return ServiceFilterName::NAMESPACE_ID;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ServiceFilterName::NOT_SET;
         }
 
-        Aws::String GetNameForServiceFilterName(ServiceFilterName enumValue)
+        const char* GetNameForServiceFilterName(ServiceFilterName enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
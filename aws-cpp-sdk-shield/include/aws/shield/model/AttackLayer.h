@@ -34,7 +34,8 @@ namespace AttackLayerMapper
 {
 AWS_SHIELD_API AttackLayer GetAttackLayerForName(const Aws::String& name);
 
-AWS_SHIELD_API Aws::String GetNameForAttackLayer(AttackLayer value);
+// names of values not modeled point into the enum overflow container
+AWS_SHIELD_API const char* GetNameForAttackLayer(AttackLayer value);
 } // namespace AttackLayerMapper
 } // namespace Model
 } // namespace Shield
@@ -38,7 +38,8 @@ namespace AttackPropertyIdentifierMapper
 {
 AWS_SHIELD_API AttackPropertyIdentifier GetAttackPropertyIdentifierForName(const Aws::String& name);
 
-AWS_SHIELD_API Aws::String GetNameForAttackPropertyIdentifier(AttackPropertyIdentifier value);
+// names of values not modeled point into the enum overflow container
+AWS_SHIELD_API const char* GetNameForAttackPropertyIdentifier(AttackPropertyIdentifier value);
 } // namespace AttackPropertyIdentifierMapper
 } // namespace Model
 } // namespace Shield
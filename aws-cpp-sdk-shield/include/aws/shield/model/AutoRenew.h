@@ -34,7 +34,8 @@ namespace AutoRenewMapper
 {
 AWS_SHIELD_API AutoRenew GetAutoRenewForName(const Aws::String& name);
 
-AWS_SHIELD_API Aws::String GetNameForAutoRenew(AutoRenew value);
+// names of values not modeled point into the enum overflow container
+AWS_SHIELD_API const char* GetNameForAutoRenew(AutoRenew value);
 } // namespace AutoRenewMapper
 } // namespace Model
 } // namespace Shield
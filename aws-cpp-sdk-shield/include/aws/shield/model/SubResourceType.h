@@ -34,7 +34,8 @@ namespace SubResourceTypeMapper
 {
 AWS_SHIELD_API SubResourceType GetSubResourceTypeForName(const Aws::String& name);
 
-AWS_SHIELD_API Aws::String GetNameForSubResourceType(SubResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_SHIELD_API const char* GetNameForSubResourceType(SubResourceType value);
 } // namespace SubResourceTypeMapper
 } // namespace Model
 } // namespace Shield
@@ -34,7 +34,8 @@ namespace SubscriptionStateMapper
 {
 AWS_SHIELD_API SubscriptionState GetSubscriptionStateForName(const Aws::String& name);
 
-AWS_SHIELD_API Aws::String GetNameForSubscriptionState(SubscriptionState value);
+// names of values not modeled point into the enum overflow container
+AWS_SHIELD_API const char* GetNameForSubscriptionState(SubscriptionState value);
 } // namespace SubscriptionStateMapper
 } // namespace Model
 } // namespace Shield
@@ -36,7 +36,8 @@ namespace UnitMapper
 {
 AWS_SHIELD_API Unit GetUnitForName(const Aws::String& name);
 
-AWS_SHIELD_API Aws::String GetNameForUnit(Unit value);
+// names of values not modeled point into the enum overflow container
+AWS_SHIELD_API const char* GetNameForUnit(Unit value);
 } // namespace UnitMapper
 } // namespace Model
 } // namespace Shield
@@ -28,17 +28,17 @@ namespace Shield
 namespace ShieldErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int INVALID_RESOURCE_HASH = HashingUtils::HashString("InvalidResourceException");
-static const int LIMITS_EXCEEDED_HASH = HashingUtils::HashString("LimitsExceededException");
-static const int LOCKED_SUBSCRIPTION_HASH = HashingUtils::HashString("LockedSubscriptionException");
-static const int OPTIMISTIC_LOCK_HASH = HashingUtils::HashString("OptimisticLockException");
-static const int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ResourceAlreadyExistsException");
-static const int INVALID_OPERATION_HASH = HashingUtils::HashString("InvalidOperationException");
-static const int ACCESS_DENIED_FOR_DEPENDENCY_HASH = HashingUtils::HashString("AccessDeniedForDependencyException");
-static const int NO_ASSOCIATED_ROLE_HASH = HashingUtils::HashString("NoAssociatedRoleException");
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalErrorException");
-static const int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::HashString("InvalidPaginationTokenException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int INVALID_RESOURCE_HASH = HashingUtils::CompileTimeHashString("InvalidResourceException");
+static constexpr int LIMITS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitsExceededException");
+static constexpr int LOCKED_SUBSCRIPTION_HASH = HashingUtils::CompileTimeHashString("LockedSubscriptionException");
+static constexpr int OPTIMISTIC_LOCK_HASH = HashingUtils::CompileTimeHashString("OptimisticLockException");
+static constexpr int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyExistsException");
+static constexpr int INVALID_OPERATION_HASH = HashingUtils::CompileTimeHashString("InvalidOperationException");
+static constexpr int ACCESS_DENIED_FOR_DEPENDENCY_HASH = HashingUtils::CompileTimeHashString("AccessDeniedForDependencyException");
+static constexpr int NO_ASSOCIATED_ROLE_HASH = HashingUtils::CompileTimeHashString("NoAssociatedRoleException");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalErrorException");
+static constexpr int INVALID_PAGINATION_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidPaginationTokenException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
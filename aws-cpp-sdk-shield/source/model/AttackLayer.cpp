@@ -30,20 +30,30 @@ namespace Aws
       namespace AttackLayerMapper
       {
 
-        static const int NETWORK_HASH = HashingUtils::HashString("NETWORK");
-        static const int APPLICATION_HASH = HashingUtils::HashString("APPLICATION");
+        static constexpr int NETWORK_HASH = HashingUtils::CompileTimeHashString("NETWORK");
+        static constexpr int APPLICATION_HASH = HashingUtils::CompileTimeHashString("APPLICATION");
 
 
         AttackLayer GetAttackLayerForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NETWORK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AttackLayer::NETWORK;
-          }
-          else if (hashCode == APPLICATION_HASH)
-          {
-            return AttackLayer::APPLICATION;
+          case NETWORK_HASH:
+            if (name == "NETWORK")
+            {
+              return AttackLayer::NETWORK;
+            }
+            break;
+          case APPLICATION_HASH:
+            if (name == "APPLICATION")
+            {
+              return AttackLayer::APPLICATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return AttackLayer::NOT_SET;
         }
 
-        Aws::String GetNameForAttackLayer(AttackLayer enumValue)
+        const char* GetNameForAttackLayer(AttackLayer enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
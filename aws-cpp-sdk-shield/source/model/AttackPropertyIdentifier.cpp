@@ -30,40 +30,58 @@ namespace Aws
       namespace AttackPropertyIdentifierMapper
       {
 
-        static const int DESTINATION_URL_HASH = HashingUtils::HashString("DESTINATION_URL");
-        static const int REFERRER_HASH = HashingUtils::HashString("REFERRER");
-        static const int SOURCE_ASN_HASH = HashingUtils::HashString("SOURCE_ASN");
-        static const int SOURCE_COUNTRY_HASH = HashingUtils::HashString("SOURCE_COUNTRY");
-        static const int SOURCE_IP_ADDRESS_HASH = HashingUtils::HashString("SOURCE_IP_ADDRESS");
-        static const int SOURCE_USER_AGENT_HASH = HashingUtils::HashString("SOURCE_USER_AGENT");
+        static constexpr int DESTINATION_URL_HASH = HashingUtils::CompileTimeHashString("DESTINATION_URL");
+        static constexpr int REFERRER_HASH = HashingUtils::CompileTimeHashString("REFERRER");
+        static constexpr int SOURCE_ASN_HASH = HashingUtils::CompileTimeHashString("SOURCE_ASN");
+        static constexpr int SOURCE_COUNTRY_HASH = HashingUtils::CompileTimeHashString("SOURCE_COUNTRY");
+        static constexpr int SOURCE_IP_ADDRESS_HASH = HashingUtils::CompileTimeHashString("SOURCE_IP_ADDRESS");
+        static constexpr int SOURCE_USER_AGENT_HASH = HashingUtils::CompileTimeHashString("SOURCE_USER_AGENT");
 
 
         AttackPropertyIdentifier GetAttackPropertyIdentifierForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DESTINATION_URL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AttackPropertyIdentifier::DESTINATION_URL;
-          }
-          else if (hashCode == REFERRER_HASH)
-          {
-            return AttackPropertyIdentifier::REFERRER;
-          }
-          else if (hashCode == SOURCE_ASN_HASH)
-          {
-            return AttackPropertyIdentifier::SOURCE_ASN;
-          }
-          else if (hashCode == SOURCE_COUNTRY_HASH)
-          {
-            return AttackPropertyIdentifier::SOURCE_COUNTRY;
-          }
-          else if (hashCode == SOURCE_IP_ADDRESS_HASH)
-          {
-            return AttackPropertyIdentifier::SOURCE_IP_ADDRESS;
-          }
-          else if (hashCode == SOURCE_USER_AGENT_HASH)
-          {
-            return AttackPropertyIdentifier::SOURCE_USER_AGENT;
+          case DESTINATION_URL_HASH:
+            if (name == "DESTINATION_URL")
+            {
+              return AttackPropertyIdentifier::DESTINATION_URL;
+            }
+            break;
+          case REFERRER_HASH:
+            if (name == "REFERRER")
+            {
+              return AttackPropertyIdentifier::REFERRER;
+            }
+            break;
+          case SOURCE_ASN_HASH:
+            if (name == "SOURCE_ASN")
+            {
+              return AttackPropertyIdentifier::SOURCE_ASN;
+            }
+            break;
+          case SOURCE_COUNTRY_HASH:
+            if (name == "SOURCE_COUNTRY")
+            {
+              return AttackPropertyIdentifier::SOURCE_COUNTRY;
+            }
+            break;
+          case SOURCE_IP_ADDRESS_HASH:
+            if (name == "SOURCE_IP_ADDRESS")
+            {
+              return AttackPropertyIdentifier::SOURCE_IP_ADDRESS;
+            }
+            break;
+          case SOURCE_USER_AGENT_HASH:
+            if (name == "SOURCE_USER_AGENT")
+            {
+              return AttackPropertyIdentifier::SOURCE_USER_AGENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return AttackPropertyIdentifier::NOT_SET;
         }
 
-        Aws::String GetNameForAttackPropertyIdentifier(AttackPropertyIdentifier enumValue)
+        const char* GetNameForAttackPropertyIdentifier(AttackPropertyIdentifier enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
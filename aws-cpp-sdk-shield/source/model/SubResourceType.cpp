@@ -30,20 +30,30 @@ namespace Aws
       namespace SubResourceTypeMapper
       {
 
-        static const int IP_HASH = HashingUtils::HashString("IP");
-        static const int URL_HASH = HashingUtils::HashString("URL");
+        static constexpr int IP_HASH = HashingUtils::CompileTimeHashString("IP");
+        static constexpr int URL_HASH = HashingUtils::CompileTimeHashString("URL");
 
 
         SubResourceType GetSubResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SubResourceType::IP;
-          }
-          else if (hashCode == URL_HASH)
-          {
-            return SubResourceType::URL;
+          case IP_HASH:
+            if (name == "IP")
+            {
+              return SubResourceType::IP;
+            }
+            break;
+          case URL_HASH:
+            if (name == "URL")
+            {
+              return SubResourceType::URL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SubResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForSubResourceType(SubResourceType enumValue)
+        const char* GetNameForSubResourceType(SubResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace UnitMapper
       {
 
-        static const int BITS_HASH = HashingUtils::HashString("BITS");
-        static const int BYTES_HASH = HashingUtils::HashString("BYTES");
-        static const int PACKETS_HASH = HashingUtils::HashString("PACKETS");
-        static const int REQUESTS_HASH = HashingUtils::HashString("REQUESTS");
+        static constexpr int BITS_HASH = HashingUtils::CompileTimeHashString("BITS");
+        static constexpr int BYTES_HASH = HashingUtils::CompileTimeHashString("BYTES");
+        static constexpr int PACKETS_HASH = HashingUtils::CompileTimeHashString("PACKETS");
+        static constexpr int REQUESTS_HASH = HashingUtils::CompileTimeHashString("REQUESTS");
 
 
         Unit GetUnitForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BITS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Unit::BITS;
-          }
-          else if (hashCode == BYTES_HASH)
-          {
-            return Unit::BYTES;
-          }
-          else if (hashCode == PACKETS_HASH)
-          {
-            return Unit::PACKETS;
-          }
-          else if (hashCode == REQUESTS_HASH)
-          {
-            return Unit::REQUESTS;
+          case BITS_HASH:
+            if (name == "BITS")
+            {
+              return Unit::BITS;
+            }
+            break;
+          case BYTES_HASH:
+            if (name == "BYTES")
+            {
+              return Unit::BYTES;
+            }
+            break;
+          case PACKETS_HASH:
+            if (name == "PACKETS")
+            {
+              return Unit::PACKETS;
+            }
+            break;
+          case REQUESTS_HASH:
+            if (name == "REQUESTS")
+            {
+              return Unit::REQUESTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return Unit::NOT_SET;
         }
 
-        Aws::String GetNameForUnit(Unit enumValue)
+        const char* GetNameForUnit(Unit enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
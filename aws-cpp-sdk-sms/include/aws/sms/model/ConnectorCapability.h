@@ -33,7 +33,8 @@ namespace ConnectorCapabilityMapper
 {
 AWS_SMS_API ConnectorCapability GetConnectorCapabilityForName(const Aws::String& name);
 
-AWS_SMS_API Aws::String GetNameForConnectorCapability(ConnectorCapability value);
+// names of values not modeled point into the enum overflow container
+AWS_SMS_API const char* GetNameForConnectorCapability(ConnectorCapability value);
 } // namespace ConnectorCapabilityMapper
 } // namespace Model
 } // namespace SMS
@@ -34,7 +34,8 @@ namespace ConnectorStatusMapper
 {
 AWS_SMS_API ConnectorStatus GetConnectorStatusForName(const Aws::String& name);
 
-AWS_SMS_API Aws::String GetNameForConnectorStatus(ConnectorStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SMS_API const char* GetNameForConnectorStatus(ConnectorStatus value);
 } // namespace ConnectorStatusMapper
 } // namespace Model
 } // namespace SMS
@@ -34,7 +34,8 @@ namespace LicenseTypeMapper
 {
 AWS_SMS_API LicenseType GetLicenseTypeForName(const Aws::String& name);
 
-AWS_SMS_API Aws::String GetNameForLicenseType(LicenseType value);
+// names of values not modeled point into the enum overflow container
+AWS_SMS_API const char* GetNameForLicenseType(LicenseType value);
 } // namespace LicenseTypeMapper
 } // namespace Model
 } // namespace SMS
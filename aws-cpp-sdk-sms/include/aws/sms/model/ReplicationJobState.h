@@ -37,7 +37,8 @@ namespace ReplicationJobStateMapper
 {
 AWS_SMS_API ReplicationJobState GetReplicationJobStateForName(const Aws::String& name);
 
-AWS_SMS_API Aws::String GetNameForReplicationJobState(ReplicationJobState value);
+// names of values not modeled point into the enum overflow container
+AWS_SMS_API const char* GetNameForReplicationJobState(ReplicationJobState value);
 } // namespace ReplicationJobStateMapper
 } // namespace Model
 } // namespace SMS
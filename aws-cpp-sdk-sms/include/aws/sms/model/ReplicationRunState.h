@@ -39,7 +39,8 @@ namespace ReplicationRunStateMapper
 {
 AWS_SMS_API ReplicationRunState GetReplicationRunStateForName(const Aws::String& name);
 
-AWS_SMS_API Aws::String GetNameForReplicationRunState(ReplicationRunState value);
+// names of values not modeled point into the enum overflow container
+AWS_SMS_API const char* GetNameForReplicationRunState(ReplicationRunState value);
 } // namespace ReplicationRunStateMapper
 } // namespace Model
 } // namespace SMS
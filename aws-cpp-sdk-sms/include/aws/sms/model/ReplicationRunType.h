@@ -34,7 +34,8 @@ namespace ReplicationRunTypeMapper
 {
 AWS_SMS_API ReplicationRunType GetReplicationRunTypeForName(const Aws::String& name);
 
-AWS_SMS_API Aws::String GetNameForReplicationRunType(ReplicationRunType value);
+// names of values not modeled point into the enum overflow container
+AWS_SMS_API const char* GetNameForReplicationRunType(ReplicationRunType value);
 } // namespace ReplicationRunTypeMapper
 } // namespace Model
 } // namespace SMS
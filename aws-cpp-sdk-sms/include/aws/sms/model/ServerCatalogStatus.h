@@ -37,7 +37,8 @@ namespace ServerCatalogStatusMapper
 {
 AWS_SMS_API ServerCatalogStatus GetServerCatalogStatusForName(const Aws::String& name);
 
-AWS_SMS_API Aws::String GetNameForServerCatalogStatus(ServerCatalogStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SMS_API const char* GetNameForServerCatalogStatus(ServerCatalogStatus value);
 } // namespace ServerCatalogStatusMapper
 } // namespace Model
 } // namespace SMS
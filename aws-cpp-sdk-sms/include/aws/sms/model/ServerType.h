@@ -33,7 +33,8 @@ namespace ServerTypeMapper
 {
 AWS_SMS_API ServerType GetServerTypeForName(const Aws::String& name);
 
-AWS_SMS_API Aws::String GetNameForServerType(ServerType value);
+// names of values not modeled point into the enum overflow container
+AWS_SMS_API const char* GetNameForServerType(ServerType value);
 } // namespace ServerTypeMapper
 } // namespace Model
 } // namespace SMS
@@ -33,7 +33,8 @@ namespace VmManagerTypeMapper
 {
 AWS_SMS_API VmManagerType GetVmManagerTypeForName(const Aws::String& name);
 
-AWS_SMS_API Aws::String GetNameForVmManagerType(VmManagerType value);
+// names of values not modeled point into the enum overflow container
+AWS_SMS_API const char* GetNameForVmManagerType(VmManagerType value);
 } // namespace VmManagerTypeMapper
 } // namespace Model
 } // namespace SMS
@@ -28,16 +28,16 @@ namespace SMS
 namespace SMSErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int REPLICATION_RUN_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ReplicationRunLimitExceededException");
-static const int NO_CONNECTORS_AVAILABLE_HASH = HashingUtils::HashString("NoConnectorsAvailableException");
-static const int UNAUTHORIZED_OPERATION_HASH = HashingUtils::HashString("UnauthorizedOperationException");
-static const int REPLICATION_JOB_NOT_FOUND_HASH = HashingUtils::HashString("ReplicationJobNotFoundException");
-static const int INTERNAL_HASH = HashingUtils::HashString("InternalError");
-static const int REPLICATION_JOB_ALREADY_EXISTS_HASH = HashingUtils::HashString("ReplicationJobAlreadyExistsException");
-static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OperationNotPermittedException");
-static const int MISSING_REQUIRED_PARAMETER_HASH = HashingUtils::HashString("MissingRequiredParameterException");
-static const int SERVER_CANNOT_BE_REPLICATED_HASH = HashingUtils::HashString("ServerCannotBeReplicatedException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int REPLICATION_RUN_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ReplicationRunLimitExceededException");
+static constexpr int NO_CONNECTORS_AVAILABLE_HASH = HashingUtils::CompileTimeHashString("NoConnectorsAvailableException");
+static constexpr int UNAUTHORIZED_OPERATION_HASH = HashingUtils::CompileTimeHashString("UnauthorizedOperationException");
+static constexpr int REPLICATION_JOB_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ReplicationJobNotFoundException");
+static constexpr int INTERNAL_HASH = HashingUtils::CompileTimeHashString("InternalError");
+static constexpr int REPLICATION_JOB_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ReplicationJobAlreadyExistsException");
+static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OperationNotPermittedException");
+static constexpr int MISSING_REQUIRED_PARAMETER_HASH = HashingUtils::CompileTimeHashString("MissingRequiredParameterException");
+static constexpr int SERVER_CANNOT_BE_REPLICATED_HASH = HashingUtils::CompileTimeHashString("ServerCannotBeReplicatedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
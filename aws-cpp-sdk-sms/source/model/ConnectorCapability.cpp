@@ -30,15 +30,23 @@ namespace Aws
       namespace ConnectorCapabilityMapper
       {
 
-        static const int VSPHERE_HASH = HashingUtils::HashString("VSPHERE");
+        static constexpr int VSPHERE_HASH = HashingUtils::CompileTimeHashString("VSPHERE");
 
 
         ConnectorCapability GetConnectorCapabilityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VSPHERE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConnectorCapability::VSPHERE;
+          case VSPHERE_HASH:
+            if (name == "VSPHERE")
+            {
+              return ConnectorCapability::VSPHERE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ConnectorCapability::NOT_SET;
         }
 
-        Aws::String GetNameForConnectorCapability(ConnectorCapability enumValue)
+        const char* GetNameForConnectorCapability(ConnectorCapability enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
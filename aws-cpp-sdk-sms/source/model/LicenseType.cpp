@@ -30,20 +30,30 @@ namespace Aws
       namespace LicenseTypeMapper
       {
 
-        static const int AWS_HASH = HashingUtils::HashString("AWS");
-        static const int BYOL_HASH = HashingUtils::HashString("BYOL");
+        static constexpr int AWS_HASH = HashingUtils::CompileTimeHashString("AWS");
+        static constexpr int BYOL_HASH = HashingUtils::CompileTimeHashString("BYOL");
 
 
         LicenseType GetLicenseTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AWS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LicenseType::AWS;
-          }
-          else if (hashCode == BYOL_HASH)
-          {
-            return LicenseType::BYOL;
+          case AWS_HASH:
+            if (name == "AWS")
+            {
+              return LicenseType::AWS;
+            }
+            break;
+          case BYOL_HASH:
+            if (name == "BYOL")
+            {
+              return LicenseType::BYOL;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LicenseType::NOT_SET;
         }
 
-        Aws::String GetNameForLicenseType(LicenseType enumValue)
+        const char* GetNameForLicenseType(LicenseType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace ReplicationRunStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int MISSED_HASH = HashingUtils::HashString("MISSED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int DELETING_HASH = HashingUtils::HashString("DELETING");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int MISSED_HASH = HashingUtils::CompileTimeHashString("MISSED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int DELETING_HASH = HashingUtils::CompileTimeHashString("DELETING");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         ReplicationRunState GetReplicationRunStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReplicationRunState::PENDING;
-          }
-          else if (hashCode == MISSED_HASH)
-          {
-            return ReplicationRunState::MISSED;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return ReplicationRunState::ACTIVE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ReplicationRunState::FAILED;
-          }
-          else if (hashCode == COMPLETED_HASH)
-          {
-            return ReplicationRunState::COMPLETED;
-          }
-          else if (hashCode == DELETING_HASH)
-          {
-            return ReplicationRunState::DELETING;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ReplicationRunState::DELETED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ReplicationRunState::PENDING;
+            }
+            break;
+          case MISSED_HASH:
+            if (name == "MISSED")
+            {
+              return ReplicationRunState::MISSED;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ReplicationRunState::ACTIVE;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ReplicationRunState::FAILED;
+            }
+            break;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return ReplicationRunState::COMPLETED;
+            }
+            break;
+          case DELETING_HASH:
+            if (name == "DELETING")
+            {
+              return ReplicationRunState::DELETING;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return ReplicationRunState::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return ReplicationRunState::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationRunState(ReplicationRunState enumValue)
+        const char* GetNameForReplicationRunState(ReplicationRunState enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ReplicationRunTypeMapper
       {
 
-        static const int ON_DEMAND_HASH = HashingUtils::HashString("ON_DEMAND");
-        static const int AUTOMATIC_HASH = HashingUtils::HashString("AUTOMATIC");
+        static constexpr int ON_DEMAND_HASH = HashingUtils::CompileTimeHashString("ON_DEMAND");
+        static constexpr int AUTOMATIC_HASH = HashingUtils::CompileTimeHashString("AUTOMATIC");
 
 
         ReplicationRunType GetReplicationRunTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ON_DEMAND_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ReplicationRunType::ON_DEMAND;
-          }
-          else if (hashCode == AUTOMATIC_HASH)
-          {
-            return ReplicationRunType::AUTOMATIC;
+          case ON_DEMAND_HASH:
+            if (name == "ON_DEMAND")
+            {
+              return ReplicationRunType::ON_DEMAND;
+            }
+            break;
+          case AUTOMATIC_HASH:
+            if (name == "AUTOMATIC")
+            {
+              return ReplicationRunType::AUTOMATIC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ReplicationRunType::NOT_SET;
         }
 
-        Aws::String GetNameForReplicationRunType(ReplicationRunType enumValue)
+        const char* GetNameForReplicationRunType(ReplicationRunType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
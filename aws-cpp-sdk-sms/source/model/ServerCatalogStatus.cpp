@@ -30,35 +30,51 @@ namespace Aws
       namespace ServerCatalogStatusMapper
       {
 
-        static const int NOT_IMPORTED_HASH = HashingUtils::HashString("NOT_IMPORTED");
-        static const int IMPORTING_HASH = HashingUtils::HashString("IMPORTING");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
-        static const int EXPIRED_HASH = HashingUtils::HashString("EXPIRED");
+        static constexpr int NOT_IMPORTED_HASH = HashingUtils::CompileTimeHashString("NOT_IMPORTED");
+        static constexpr int IMPORTING_HASH = HashingUtils::CompileTimeHashString("IMPORTING");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
+        static constexpr int EXPIRED_HASH = HashingUtils::CompileTimeHashString("EXPIRED");
 
 
         ServerCatalogStatus GetServerCatalogStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NOT_IMPORTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServerCatalogStatus::NOT_IMPORTED;
-          }
-          else if (hashCode == IMPORTING_HASH)
-          {
-            return ServerCatalogStatus::IMPORTING;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return ServerCatalogStatus::AVAILABLE;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return ServerCatalogStatus::DELETED;
-          }
-          else if (hashCode == EXPIRED_HASH)
-          {
-            return ServerCatalogStatus::EXPIRED;
+          case NOT_IMPORTED_HASH:
+            if (name == "NOT_IMPORTED")
+            {
+              return ServerCatalogStatus::NOT_IMPORTED;
+            }
+            break;
+          case IMPORTING_HASH:
+            if (name == "IMPORTING")
+            {
+              return ServerCatalogStatus::IMPORTING;
+            }
+            break;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return ServerCatalogStatus::AVAILABLE;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return ServerCatalogStatus::DELETED;
+            }
+            break;
+          case EXPIRED_HASH:
+            if (name == "EXPIRED")
+            {
+              return ServerCatalogStatus::EXPIRED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ServerCatalogStatus::NOT_SET;
         }
 
-        Aws::String GetNameForServerCatalogStatus(ServerCatalogStatus enumValue)
+        const char* GetNameForServerCatalogStatus(ServerCatalogStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace ServerTypeMapper
       {
 
-        static const int VIRTUAL_MACHINE_HASH = HashingUtils::HashString("VIRTUAL_MACHINE");
+        static constexpr int VIRTUAL_MACHINE_HASH = HashingUtils::CompileTimeHashString("VIRTUAL_MACHINE");
 
 
         ServerType GetServerTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VIRTUAL_MACHINE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ServerType::VIRTUAL_MACHINE;
+          case VIRTUAL_MACHINE_HASH:
+            if (name == "VIRTUAL_MACHINE")
+            {
+              return ServerType::VIRTUAL_MACHINE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ServerType::NOT_SET;
         }
 
-        Aws::String GetNameForServerType(ServerType enumValue)
+        const char* GetNameForServerType(ServerType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -37,7 +37,8 @@ namespace ClusterStateMapper
 {
 AWS_SNOWBALL_API ClusterState GetClusterStateForName(const Aws::String& name);
 
-AWS_SNOWBALL_API Aws::String GetNameForClusterState(ClusterState value);
+// names of values not modeled point into the enum overflow container
+AWS_SNOWBALL_API const char* GetNameForClusterState(ClusterState value);
 } // namespace ClusterStateMapper
 } // namespace Model
 } // namespace Snowball
@@ -44,7 +44,8 @@ namespace JobStateMapper
 {
 AWS_SNOWBALL_API JobState GetJobStateForName(const Aws::String& name);
 
-AWS_SNOWBALL_API Aws::String GetNameForJobState(JobState value);
+// names of values not modeled point into the enum overflow container
+AWS_SNOWBALL_API const char* GetNameForJobState(JobState value);
 } // namespace JobStateMapper
 } // namespace Model
 } // namespace Snowball
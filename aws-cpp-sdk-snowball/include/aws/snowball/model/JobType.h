@@ -35,7 +35,8 @@ namespace JobTypeMapper
 {
 AWS_SNOWBALL_API JobType GetJobTypeForName(const Aws::String& name);
 
-AWS_SNOWBALL_API Aws::String GetNameForJobType(JobType value);
+// names of values not modeled point into the enum overflow container
+AWS_SNOWBALL_API const char* GetNameForJobType(JobType value);
 } // namespace JobTypeMapper
 } // namespace Model
 } // namespace Snowball
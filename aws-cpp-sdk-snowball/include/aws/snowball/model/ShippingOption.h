@@ -36,7 +36,8 @@ namespace ShippingOptionMapper
 {
 AWS_SNOWBALL_API ShippingOption GetShippingOptionForName(const Aws::String& name);
 
-AWS_SNOWBALL_API Aws::String GetNameForShippingOption(ShippingOption value);
+// names of values not modeled point into the enum overflow container
+AWS_SNOWBALL_API const char* GetNameForShippingOption(ShippingOption value);
 } // namespace ShippingOptionMapper
 } // namespace Model
 } // namespace Snowball
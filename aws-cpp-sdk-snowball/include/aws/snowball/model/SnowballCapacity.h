@@ -36,7 +36,8 @@ namespace SnowballCapacityMapper
 {
 AWS_SNOWBALL_API SnowballCapacity GetSnowballCapacityForName(const Aws::String& name);
 
-AWS_SNOWBALL_API Aws::String GetNameForSnowballCapacity(SnowballCapacity value);
+// names of values not modeled point into the enum overflow container
+AWS_SNOWBALL_API const char* GetNameForSnowballCapacity(SnowballCapacity value);
 } // namespace SnowballCapacityMapper
 } // namespace Model
 } // namespace Snowball
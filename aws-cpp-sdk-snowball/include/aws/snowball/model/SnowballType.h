@@ -34,7 +34,8 @@ namespace SnowballTypeMapper
 {
 AWS_SNOWBALL_API SnowballType GetSnowballTypeForName(const Aws::String& name);
 
-AWS_SNOWBALL_API Aws::String GetNameForSnowballType(SnowballType value);
+// names of values not modeled point into the enum overflow container
+AWS_SNOWBALL_API const char* GetNameForSnowballType(SnowballType value);
 } // namespace SnowballTypeMapper
 } // namespace Model
 } // namespace Snowball
@@ -28,15 +28,15 @@ namespace Snowball
 namespace SnowballErrorMapper
 {
 
-static const int INVALID_RESOURCE_HASH = HashingUtils::HashString("InvalidResourceException");
-static const int EC2_REQUEST_FAILED_HASH = HashingUtils::HashString("Ec2RequestFailedException");
-static const int INVALID_INPUT_COMBINATION_HASH = HashingUtils::HashString("InvalidInputCombinationException");
-static const int INVALID_JOB_STATE_HASH = HashingUtils::HashString("InvalidJobStateException");
-static const int UNSUPPORTED_ADDRESS_HASH = HashingUtils::HashString("UnsupportedAddressException");
-static const int K_M_S_REQUEST_FAILED_HASH = HashingUtils::HashString("KMSRequestFailedException");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextTokenException");
-static const int CLUSTER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ClusterLimitExceededException");
-static const int INVALID_ADDRESS_HASH = HashingUtils::HashString("InvalidAddressException");
+static constexpr int INVALID_RESOURCE_HASH = HashingUtils::CompileTimeHashString("InvalidResourceException");
+static constexpr int EC2_REQUEST_FAILED_HASH = HashingUtils::CompileTimeHashString("Ec2RequestFailedException");
+static constexpr int INVALID_INPUT_COMBINATION_HASH = HashingUtils::CompileTimeHashString("InvalidInputCombinationException");
+static constexpr int INVALID_JOB_STATE_HASH = HashingUtils::CompileTimeHashString("InvalidJobStateException");
+static constexpr int UNSUPPORTED_ADDRESS_HASH = HashingUtils::CompileTimeHashString("UnsupportedAddressException");
+static constexpr int K_M_S_REQUEST_FAILED_HASH = HashingUtils::CompileTimeHashString("KMSRequestFailedException");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextTokenException");
+static constexpr int CLUSTER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ClusterLimitExceededException");
+static constexpr int INVALID_ADDRESS_HASH = HashingUtils::CompileTimeHashString("InvalidAddressException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,35 +30,51 @@ namespace Aws
       namespace ClusterStateMapper
       {
 
-        static const int AwaitingQuorum_HASH = HashingUtils::HashString("AwaitingQuorum");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InUse_HASH = HashingUtils::HashString("InUse");
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
+        static constexpr int AwaitingQuorum_HASH = HashingUtils::CompileTimeHashString("AwaitingQuorum");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InUse_HASH = HashingUtils::CompileTimeHashString("InUse");
+        static constexpr int Complete_HASH = HashingUtils::CompileTimeHashString("Complete");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
 
 
         ClusterState GetClusterStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AwaitingQuorum_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ClusterState::AwaitingQuorum;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return ClusterState::Pending;
-          }
-          else if (hashCode == InUse_HASH)
-          {
-            return ClusterState::InUse;
-          }
-          else if (hashCode == Complete_HASH)
-          {
-            return ClusterState::Complete;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return ClusterState::Cancelled;
+          case AwaitingQuorum_HASH:
+            if (name == "AwaitingQuorum")
+            {
+              return ClusterState::AwaitingQuorum;
+            }
+            break;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return ClusterState::Pending;
+            }
+            break;
+          case InUse_HASH:
+            if (name == "InUse")
+            {
+              return ClusterState::InUse;
+            }
+            break;
+          case Complete_HASH:
+            if (name == "Complete")
+            {
+              return ClusterState::Complete;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return ClusterState::Cancelled;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ClusterState::NOT_SET;
         }
 
-        Aws::String GetNameForClusterState(ClusterState enumValue)
+        const char* GetNameForClusterState(ClusterState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,70 +30,100 @@ namespace Aws
       namespace JobStateMapper
       {
 
-        static const int New_HASH = HashingUtils::HashString("New");
-        static const int PreparingAppliance_HASH = HashingUtils::HashString("PreparingAppliance");
-        static const int PreparingShipment_HASH = HashingUtils::HashString("PreparingShipment");
-        static const int InTransitToCustomer_HASH = HashingUtils::HashString("InTransitToCustomer");
-        static const int WithCustomer_HASH = HashingUtils::HashString("WithCustomer");
-        static const int InTransitToAWS_HASH = HashingUtils::HashString("InTransitToAWS");
-        static const int WithAWS_HASH = HashingUtils::HashString("WithAWS");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Listing_HASH = HashingUtils::HashString("Listing");
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
+        static constexpr int New_HASH = HashingUtils::CompileTimeHashString("New");
+        static constexpr int PreparingAppliance_HASH = HashingUtils::CompileTimeHashString("PreparingAppliance");
+        static constexpr int PreparingShipment_HASH = HashingUtils::CompileTimeHashString("PreparingShipment");
+        static constexpr int InTransitToCustomer_HASH = HashingUtils::CompileTimeHashString("InTransitToCustomer");
+        static constexpr int WithCustomer_HASH = HashingUtils::CompileTimeHashString("WithCustomer");
+        static constexpr int InTransitToAWS_HASH = HashingUtils::CompileTimeHashString("InTransitToAWS");
+        static constexpr int WithAWS_HASH = HashingUtils::CompileTimeHashString("WithAWS");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Complete_HASH = HashingUtils::CompileTimeHashString("Complete");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
+        static constexpr int Listing_HASH = HashingUtils::CompileTimeHashString("Listing");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
 
 
         JobState GetJobStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == New_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobState::New;
-          }
-          else if (hashCode == PreparingAppliance_HASH)
-          {
-            return JobState::PreparingAppliance;
-          }
-          else if (hashCode == PreparingShipment_HASH)
-          {
-            return JobState::PreparingShipment;
-          }
-          else if (hashCode == InTransitToCustomer_HASH)
-          {
-            return JobState::InTransitToCustomer;
-          }
-          else if (hashCode == WithCustomer_HASH)
-          {
-            return JobState::WithCustomer;
-          }
-          else if (hashCode == InTransitToAWS_HASH)
-          {
-            return JobState::InTransitToAWS;
-          }
-          else if (hashCode == WithAWS_HASH)
-          {
-            return JobState::WithAWS;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return JobState::InProgress;
-          }
-          else if (hashCode == Complete_HASH)
-          {
-            return JobState::Complete;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return JobState::Cancelled;
-          }
-          else if (hashCode == Listing_HASH)
-          {
-            return JobState::Listing;
-          }
-          else if (hashCode == Pending_HASH)
-          {
-            return JobState::Pending;
+          case New_HASH:
+            if (name == "New")
+            {
+              return JobState::New;
+            }
+            break;
+          case PreparingAppliance_HASH:
+            if (name == "PreparingAppliance")
+            {
+              return JobState::PreparingAppliance;
+            }
+            break;
+          case PreparingShipment_HASH:
+            if (name == "PreparingShipment")
+            {
+              return JobState::PreparingShipment;
+            }
+            break;
+          case InTransitToCustomer_HASH:
+            if (name == "InTransitToCustomer")
+            {
+              return JobState::InTransitToCustomer;
+            }
+            break;
+          case WithCustomer_HASH:
+            if (name == "WithCustomer")
+            {
+              return JobState::WithCustomer;
+            }
+            break;
+          case InTransitToAWS_HASH:
+            if (name == "InTransitToAWS")
+            {
+              return JobState::InTransitToAWS;
+            }
+            break;
+          case WithAWS_HASH:
+            if (name == "WithAWS")
+            {
+              return JobState::WithAWS;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return JobState::InProgress;
+            }
+            break;
+          case Complete_HASH:
+            if (name == "Complete")
+            {
+              return JobState::Complete;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return JobState::Cancelled;
+            }
+            break;
+          case Listing_HASH:
+            if (name == "Listing")
+            {
+              return JobState::Listing;
+            }
+            break;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return JobState::Pending;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -105,7 +135,7 @@ namespace Aws
           return JobState::NOT_SET;
         }
 
-        Aws::String GetNameForJobState(JobState enumValue)
+        const char* GetNameForJobState(JobState enumValue)
         {
           switch(enumValue)
           {
@@ -137,7 +167,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace JobTypeMapper
       {
 
-        static const int IMPORT_HASH = HashingUtils::HashString("IMPORT");
-        static const int EXPORT_HASH = HashingUtils::HashString("EXPORT");
-        static const int LOCAL_USE_HASH = HashingUtils::HashString("LOCAL_USE");
+        static constexpr int IMPORT_HASH = HashingUtils::CompileTimeHashString("IMPORT");
+        static constexpr int EXPORT_HASH = HashingUtils::CompileTimeHashString("EXPORT");
+        static constexpr int LOCAL_USE_HASH = HashingUtils::CompileTimeHashString("LOCAL_USE");
 
 
         JobType GetJobTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IMPORT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return JobType::IMPORT;
-          }
-          else if (hashCode == EXPORT_HASH)
-          {
-            return JobType::EXPORT;
-          }
-          else if (hashCode == LOCAL_USE_HASH)
-          {
-            return JobType::LOCAL_USE;
+          case IMPORT_HASH:
+            if (name == "IMPORT")
+            {
+              return JobType::IMPORT;
+            }
+            break;
+          case EXPORT_HASH:
+            if (name == "EXPORT")
+            {
+              return JobType::EXPORT;
+            }
+            break;
+          case LOCAL_USE_HASH:
+            if (name == "LOCAL_USE")
+            {
+              return JobType::LOCAL_USE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return JobType::NOT_SET;
         }
 
-        Aws::String GetNameForJobType(JobType enumValue)
+        const char* GetNameForJobType(JobType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ShippingOptionMapper
       {
 
-        static const int SECOND_DAY_HASH = HashingUtils::HashString("SECOND_DAY");
-        static const int NEXT_DAY_HASH = HashingUtils::HashString("NEXT_DAY");
-        static const int EXPRESS_HASH = HashingUtils::HashString("EXPRESS");
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
+        static constexpr int SECOND_DAY_HASH = HashingUtils::CompileTimeHashString("SECOND_DAY");
+        static constexpr int NEXT_DAY_HASH = HashingUtils::CompileTimeHashString("NEXT_DAY");
+        static constexpr int EXPRESS_HASH = HashingUtils::CompileTimeHashString("EXPRESS");
+        static constexpr int STANDARD_HASH = HashingUtils::CompileTimeHashString("STANDARD");
 
 
         ShippingOption GetShippingOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SECOND_DAY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ShippingOption::SECOND_DAY;
-          }
-          else if (hashCode == NEXT_DAY_HASH)
-          {
-            return ShippingOption::NEXT_DAY;
-          }
-          else if (hashCode == EXPRESS_HASH)
-          {
-            return ShippingOption::EXPRESS;
-          }
-          else if (hashCode == STANDARD_HASH)
-          {
-            return ShippingOption::STANDARD;
+          case SECOND_DAY_HASH:
+            if (name == "SECOND_DAY")
+            {
+              return ShippingOption::SECOND_DAY;
+            }
+            break;
+          case NEXT_DAY_HASH:
+            if (name == "NEXT_DAY")
+            {
+              return ShippingOption::NEXT_DAY;
+            }
+            break;
+          case EXPRESS_HASH:
+            if (name == "EXPRESS")
+            {
+              return ShippingOption::EXPRESS;
+            }
+            break;
+          case STANDARD_HASH:
+            if (name == "STANDARD")
+            {
+              return ShippingOption::STANDARD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ShippingOption::NOT_SET;
         }
 
-        Aws::String GetNameForShippingOption(ShippingOption enumValue)
+        const char* GetNameForShippingOption(ShippingOption enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace SnowballCapacityMapper
       {
 
-        static const int T50_HASH = HashingUtils::HashString("T50");
-        static const int T80_HASH = HashingUtils::HashString("T80");
-        static const int T100_HASH = HashingUtils::HashString("T100");
-        static const int NoPreference_HASH = HashingUtils::HashString("NoPreference");
+        static constexpr int T50_HASH = HashingUtils::CompileTimeHashString("T50");
+        static constexpr int T80_HASH = HashingUtils::CompileTimeHashString("T80");
+        static constexpr int T100_HASH = HashingUtils::CompileTimeHashString("T100");
+        static constexpr int NoPreference_HASH = HashingUtils::CompileTimeHashString("NoPreference");
 
 
         SnowballCapacity GetSnowballCapacityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == T50_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SnowballCapacity::T50;
-          }
-          else if (hashCode == T80_HASH)
-          {
-            return SnowballCapacity::T80;
-          }
-          else if (hashCode == T100_HASH)
-          {
-            return SnowballCapacity::T100;
-          }
-          else if (hashCode == NoPreference_HASH)
-          {
-            return SnowballCapacity::NoPreference;
+          case T50_HASH:
+            if (name == "T50")
+            {
+              return SnowballCapacity::T50;
+            }
+            break;
+          case T80_HASH:
+            if (name == "T80")
+            {
+              return SnowballCapacity::T80;
+            }
+            break;
+          case T100_HASH:
+            if (name == "T100")
+            {
+              return SnowballCapacity::T100;
+            }
+            break;
+          case NoPreference_HASH:
+            if (name == "NoPreference")
+            {
+              return SnowballCapacity::NoPreference;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return SnowballCapacity::NOT_SET;
         }
 
-        Aws::String GetNameForSnowballCapacity(SnowballCapacity enumValue)
+        const char* GetNameForSnowballCapacity(SnowballCapacity enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
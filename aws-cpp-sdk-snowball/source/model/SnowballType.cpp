@@ -30,20 +30,30 @@ namespace Aws
       namespace SnowballTypeMapper
       {
 
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int EDGE_HASH = HashingUtils::HashString("EDGE");
+        static constexpr int STANDARD_HASH = HashingUtils::CompileTimeHashString("STANDARD");
+        static constexpr int EDGE_HASH = HashingUtils::CompileTimeHashString("EDGE");
 
 
         SnowballType GetSnowballTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == STANDARD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SnowballType::STANDARD;
-          }
-          else if (hashCode == EDGE_HASH)
-          {
-            return SnowballType::EDGE;
+          case STANDARD_HASH:
+            if (name == "STANDARD")
+            {
+              return SnowballType::STANDARD;
+            }
+            break;
+          case EDGE_HASH:
+            if (name == "EDGE")
+            {
+              return SnowballType::EDGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return SnowballType::NOT_SET;
         }
 
-        Aws::String GetNameForSnowballType(SnowballType enumValue)
+        const char* GetNameForSnowballType(SnowballType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -28,16 +28,16 @@ namespace SNS
 namespace SNSErrorMapper
 {
 
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameter");
-static const int THROTTLED_HASH = HashingUtils::HashString("Throttled");
-static const int SUBSCRIPTION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("SubscriptionLimitExceeded");
-static const int ENDPOINT_DISABLED_HASH = HashingUtils::HashString("EndpointDisabled");
-static const int NOT_FOUND_HASH = HashingUtils::HashString("NotFound");
-static const int FILTER_POLICY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("FilterPolicyLimitExceeded");
-static const int PLATFORM_APPLICATION_DISABLED_HASH = HashingUtils::HashString("PlatformApplicationDisabled");
-static const int INTERNAL_ERROR_HASH = HashingUtils::HashString("InternalError");
-static const int TOPIC_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TopicLimitExceeded");
-static const int AUTHORIZATION_ERROR_HASH = HashingUtils::HashString("AuthorizationError");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameter");
+static constexpr int THROTTLED_HASH = HashingUtils::CompileTimeHashString("Throttled");
+static constexpr int SUBSCRIPTION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("SubscriptionLimitExceeded");
+static constexpr int ENDPOINT_DISABLED_HASH = HashingUtils::CompileTimeHashString("EndpointDisabled");
+static constexpr int NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("NotFound");
+static constexpr int FILTER_POLICY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("FilterPolicyLimitExceeded");
+static constexpr int PLATFORM_APPLICATION_DISABLED_HASH = HashingUtils::CompileTimeHashString("PlatformApplicationDisabled");
+static constexpr int INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("InternalError");
+static constexpr int TOPIC_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TopicLimitExceeded");
+static constexpr int AUTHORIZATION_ERROR_HASH = HashingUtils::CompileTimeHashString("AuthorizationError");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -39,7 +39,8 @@ namespace MessageSystemAttributeNameMapper
 {
 AWS_SQS_API MessageSystemAttributeName GetMessageSystemAttributeNameForName(const Aws::String& name);
 
-AWS_SQS_API Aws::String GetNameForMessageSystemAttributeName(MessageSystemAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_SQS_API const char* GetNameForMessageSystemAttributeName(MessageSystemAttributeName value);
 } // namespace MessageSystemAttributeNameMapper
 } // namespace Model
 } // namespace SQS
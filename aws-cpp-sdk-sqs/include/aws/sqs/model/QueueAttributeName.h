@@ -54,7 +54,8 @@ namespace QueueAttributeNameMapper
 {
 AWS_SQS_API QueueAttributeName GetQueueAttributeNameForName(const Aws::String& name);
 
-AWS_SQS_API Aws::String GetNameForQueueAttributeName(QueueAttributeName value);
+// names of values not modeled point into the enum overflow container
+AWS_SQS_API const char* GetNameForQueueAttributeName(QueueAttributeName value);
 } // namespace QueueAttributeNameMapper
 } // namespace Model
 } // namespace SQS
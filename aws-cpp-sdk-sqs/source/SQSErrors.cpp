@@ -28,22 +28,22 @@ namespace SQS
 namespace SQSErrorMapper
 {
 
-static const int OVER_LIMIT_HASH = HashingUtils::HashString("OverLimit");
-static const int QUEUE_NAME_EXISTS_HASH = HashingUtils::HashString("QueueAlreadyExists");
-static const int BATCH_REQUEST_TOO_LONG_HASH = HashingUtils::HashString("AWS.SimpleQueueService.BatchRequestTooLong");
-static const int TOO_MANY_ENTRIES_IN_BATCH_REQUEST_HASH = HashingUtils::HashString("AWS.SimpleQueueService.TooManyEntriesInBatchRequest");
-static const int EMPTY_BATCH_REQUEST_HASH = HashingUtils::HashString("AWS.SimpleQueueService.EmptyBatchRequest");
-static const int PURGE_QUEUE_IN_PROGRESS_HASH = HashingUtils::HashString("AWS.SimpleQueueService.PurgeQueueInProgress");
-static const int QUEUE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("AWS.SimpleQueueService.NonExistentQueue");
-static const int BATCH_ENTRY_IDS_NOT_DISTINCT_HASH = HashingUtils::HashString("AWS.SimpleQueueService.BatchEntryIdsNotDistinct");
-static const int INVALID_ATTRIBUTE_NAME_HASH = HashingUtils::HashString("InvalidAttributeName");
-static const int MESSAGE_NOT_INFLIGHT_HASH = HashingUtils::HashString("AWS.SimpleQueueService.MessageNotInflight");
-static const int INVALID_MESSAGE_CONTENTS_HASH = HashingUtils::HashString("InvalidMessageContents");
-static const int UNSUPPORTED_OPERATION_HASH = HashingUtils::HashString("AWS.SimpleQueueService.UnsupportedOperation");
-static const int RECEIPT_HANDLE_IS_INVALID_HASH = HashingUtils::HashString("ReceiptHandleIsInvalid");
-static const int QUEUE_DELETED_RECENTLY_HASH = HashingUtils::HashString("AWS.SimpleQueueService.QueueDeletedRecently");
-static const int INVALID_ID_FORMAT_HASH = HashingUtils::HashString("InvalidIdFormat");
-static const int INVALID_BATCH_ENTRY_ID_HASH = HashingUtils::HashString("AWS.SimpleQueueService.InvalidBatchEntryId");
+static constexpr int OVER_LIMIT_HASH = HashingUtils::CompileTimeHashString("OverLimit");
+static constexpr int QUEUE_NAME_EXISTS_HASH = HashingUtils::CompileTimeHashString("QueueAlreadyExists");
+static constexpr int BATCH_REQUEST_TOO_LONG_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.BatchRequestTooLong");
+static constexpr int TOO_MANY_ENTRIES_IN_BATCH_REQUEST_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.TooManyEntriesInBatchRequest");
+static constexpr int EMPTY_BATCH_REQUEST_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.EmptyBatchRequest");
+static constexpr int PURGE_QUEUE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.PurgeQueueInProgress");
+static constexpr int QUEUE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.NonExistentQueue");
+static constexpr int BATCH_ENTRY_IDS_NOT_DISTINCT_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.BatchEntryIdsNotDistinct");
+static constexpr int INVALID_ATTRIBUTE_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidAttributeName");
+static constexpr int MESSAGE_NOT_INFLIGHT_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.MessageNotInflight");
+static constexpr int INVALID_MESSAGE_CONTENTS_HASH = HashingUtils::CompileTimeHashString("InvalidMessageContents");
+static constexpr int UNSUPPORTED_OPERATION_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.UnsupportedOperation");
+static constexpr int RECEIPT_HANDLE_IS_INVALID_HASH = HashingUtils::CompileTimeHashString("ReceiptHandleIsInvalid");
+static constexpr int QUEUE_DELETED_RECENTLY_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.QueueDeletedRecently");
+static constexpr int INVALID_ID_FORMAT_HASH = HashingUtils::CompileTimeHashString("InvalidIdFormat");
+static constexpr int INVALID_BATCH_ENTRY_ID_HASH = HashingUtils::CompileTimeHashString("AWS.SimpleQueueService.InvalidBatchEntryId");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -41,7 +41,7 @@ Aws::String GetQueueAttributesRequest::SerializePayload() const
     for(auto& item : m_attributeNames)
     {
       ss << "AttributeName." << attributeNamesCount << "="
-          << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item).c_str()) << "&";
+          << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item)) << "&";
       attributeNamesCount++;
     }
   }
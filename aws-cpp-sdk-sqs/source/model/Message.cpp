@@ -152,7 +152,7 @@ void Message::OutputToStream(Aws::OStream& oStream, const char* location, unsign
       for(auto& item : m_attributes)
       {
         oStream << location << index << locationValue << ".Attribute." << attributesIdx << ".Name="
-            << StringUtils::URLEncode(MessageSystemAttributeNameMapper::GetNameForMessageSystemAttributeName(item.first).c_str()) << "&";
+            << StringUtils::URLEncode(MessageSystemAttributeNameMapper::GetNameForMessageSystemAttributeName(item.first)) << "&";
         oStream << location << index << locationValue << ".Attribute." << attributesIdx << ".Value="
             << StringUtils::URLEncode(item.second.c_str()) << "&";
         attributesIdx++;
@@ -204,7 +204,7 @@ void Message::OutputToStream(Aws::OStream& oStream, const char* location) const
       for(auto& item : m_attributes)
       {
         oStream << location << ".Attribute."  << attributesIdx << ".Name="
-            << StringUtils::URLEncode(MessageSystemAttributeNameMapper::GetNameForMessageSystemAttributeName(item.first).c_str()) << "&";
+            << StringUtils::URLEncode(MessageSystemAttributeNameMapper::GetNameForMessageSystemAttributeName(item.first)) << "&";
         oStream << location <<  ".Attribute." << attributesIdx << ".Value="
             << StringUtils::URLEncode(item.second.c_str()) << "&";
         attributesIdx++;
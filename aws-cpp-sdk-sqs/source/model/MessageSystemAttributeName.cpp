@@ -30,45 +30,65 @@ namespace Aws
       namespace MessageSystemAttributeNameMapper
       {
 
-        static const int SenderId_HASH = HashingUtils::HashString("SenderId");
-        static const int SentTimestamp_HASH = HashingUtils::HashString("SentTimestamp");
-        static const int ApproximateReceiveCount_HASH = HashingUtils::HashString("ApproximateReceiveCount");
-        static const int ApproximateFirstReceiveTimestamp_HASH = HashingUtils::HashString("ApproximateFirstReceiveTimestamp");
-        static const int SequenceNumber_HASH = HashingUtils::HashString("SequenceNumber");
-        static const int MessageDeduplicationId_HASH = HashingUtils::HashString("MessageDeduplicationId");
-        static const int MessageGroupId_HASH = HashingUtils::HashString("MessageGroupId");
+        static constexpr int SenderId_HASH = HashingUtils::CompileTimeHashString("SenderId");
+        static constexpr int SentTimestamp_HASH = HashingUtils::CompileTimeHashString("SentTimestamp");
+        static constexpr int ApproximateReceiveCount_HASH = HashingUtils::CompileTimeHashString("ApproximateReceiveCount");
+        static constexpr int ApproximateFirstReceiveTimestamp_HASH = HashingUtils::CompileTimeHashString("ApproximateFirstReceiveTimestamp");
+        static constexpr int SequenceNumber_HASH = HashingUtils::CompileTimeHashString("SequenceNumber");
+        static constexpr int MessageDeduplicationId_HASH = HashingUtils::CompileTimeHashString("MessageDeduplicationId");
+        static constexpr int MessageGroupId_HASH = HashingUtils::CompileTimeHashString("MessageGroupId");
 
 
         MessageSystemAttributeName GetMessageSystemAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SenderId_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MessageSystemAttributeName::SenderId;
-          }
-          else if (hashCode == SentTimestamp_HASH)
-          {
-            return MessageSystemAttributeName::SentTimestamp;
-          }
-          else if (hashCode == ApproximateReceiveCount_HASH)
-          {
-            return MessageSystemAttributeName::ApproximateReceiveCount;
-          }
-          else if (hashCode == ApproximateFirstReceiveTimestamp_HASH)
-          {
-            return MessageSystemAttributeName::ApproximateFirstReceiveTimestamp;
-          }
-          else if (hashCode == SequenceNumber_HASH)
-          {
-            return MessageSystemAttributeName::SequenceNumber;
-          }
-          else if (hashCode == MessageDeduplicationId_HASH)
-          {
-            return MessageSystemAttributeName::MessageDeduplicationId;
-          }
-          else if (hashCode == MessageGroupId_HASH)
-          {
-            return MessageSystemAttributeName::MessageGroupId;
+          case SenderId_HASH:
+            if (name == "SenderId")
+            {
+              return MessageSystemAttributeName::SenderId;
+            }
+            break;
+          case SentTimestamp_HASH:
+            if (name == "SentTimestamp")
+            {
+              return MessageSystemAttributeName::SentTimestamp;
+            }
+            break;
+          case ApproximateReceiveCount_HASH:
+            if (name == "ApproximateReceiveCount")
+            {
+              return MessageSystemAttributeName::ApproximateReceiveCount;
+            }
+            break;
+          case ApproximateFirstReceiveTimestamp_HASH:
+            if (name == "ApproximateFirstReceiveTimestamp")
+            {
+              return MessageSystemAttributeName::ApproximateFirstReceiveTimestamp;
+            }
+            break;
+          case SequenceNumber_HASH:
+            if (name == "SequenceNumber")
+            {
+              return MessageSystemAttributeName::SequenceNumber;
+            }
+            break;
+          case MessageDeduplicationId_HASH:
+            if (name == "MessageDeduplicationId")
+            {
+              return MessageSystemAttributeName::MessageDeduplicationId;
+            }
+            break;
+          case MessageGroupId_HASH:
+            if (name == "MessageGroupId")
+            {
+              return MessageSystemAttributeName::MessageGroupId;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return MessageSystemAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForMessageSystemAttributeName(MessageSystemAttributeName enumValue)
+        const char* GetNameForMessageSystemAttributeName(MessageSystemAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,120 +30,170 @@ namespace Aws
       namespace QueueAttributeNameMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int Policy_HASH = HashingUtils::HashString("Policy");
-        static const int VisibilityTimeout_HASH = HashingUtils::HashString("VisibilityTimeout");
-        static const int MaximumMessageSize_HASH = HashingUtils::HashString("MaximumMessageSize");
-        static const int MessageRetentionPeriod_HASH = HashingUtils::HashString("MessageRetentionPeriod");
-        static const int ApproximateNumberOfMessages_HASH = HashingUtils::HashString("ApproximateNumberOfMessages");
-        static const int ApproximateNumberOfMessagesNotVisible_HASH = HashingUtils::HashString("ApproximateNumberOfMessagesNotVisible");
-        static const int CreatedTimestamp_HASH = HashingUtils::HashString("CreatedTimestamp");
-        static const int LastModifiedTimestamp_HASH = HashingUtils::HashString("LastModifiedTimestamp");
-        static const int QueueArn_HASH = HashingUtils::HashString("QueueArn");
-        static const int ApproximateNumberOfMessagesDelayed_HASH = HashingUtils::HashString("ApproximateNumberOfMessagesDelayed");
-        static const int DelaySeconds_HASH = HashingUtils::HashString("DelaySeconds");
-        static const int ReceiveMessageWaitTimeSeconds_HASH = HashingUtils::HashString("ReceiveMessageWaitTimeSeconds");
-        static const int RedrivePolicy_HASH = HashingUtils::HashString("RedrivePolicy");
-        static const int FifoQueue_HASH = HashingUtils::HashString("FifoQueue");
-        static const int ContentBasedDeduplication_HASH = HashingUtils::HashString("ContentBasedDeduplication");
-        static const int KmsMasterKeyId_HASH = HashingUtils::HashString("KmsMasterKeyId");
-        static const int KmsDataKeyReusePeriodSeconds_HASH = HashingUtils::HashString("KmsDataKeyReusePeriodSeconds");
-        static const int SentTimestamp_HASH = HashingUtils::HashString("SentTimestamp");
-        static const int ApproximateFirstReceiveTimestamp_HASH = HashingUtils::HashString("ApproximateFirstReceiveTimestamp");
-        static const int ApproximateReceiveCount_HASH = HashingUtils::HashString("ApproximateReceiveCount");
-        static const int SenderId_HASH = HashingUtils::HashString("SenderId");
+        static constexpr int All_HASH = HashingUtils::CompileTimeHashString("All");
+        static constexpr int Policy_HASH = HashingUtils::CompileTimeHashString("Policy");
+        static constexpr int VisibilityTimeout_HASH = HashingUtils::CompileTimeHashString("VisibilityTimeout");
+        static constexpr int MaximumMessageSize_HASH = HashingUtils::CompileTimeHashString("MaximumMessageSize");
+        static constexpr int MessageRetentionPeriod_HASH = HashingUtils::CompileTimeHashString("MessageRetentionPeriod");
+        static constexpr int ApproximateNumberOfMessages_HASH = HashingUtils::CompileTimeHashString("ApproximateNumberOfMessages");
+        static constexpr int ApproximateNumberOfMessagesNotVisible_HASH = HashingUtils::CompileTimeHashString("ApproximateNumberOfMessagesNotVisible");
+        static constexpr int CreatedTimestamp_HASH = HashingUtils::CompileTimeHashString("CreatedTimestamp");
+        static constexpr int LastModifiedTimestamp_HASH = HashingUtils::CompileTimeHashString("LastModifiedTimestamp");
+        static constexpr int QueueArn_HASH = HashingUtils::CompileTimeHashString("QueueArn");
+        static constexpr int ApproximateNumberOfMessagesDelayed_HASH = HashingUtils::CompileTimeHashString("ApproximateNumberOfMessagesDelayed");
+        static constexpr int DelaySeconds_HASH = HashingUtils::CompileTimeHashString("DelaySeconds");
+        static constexpr int ReceiveMessageWaitTimeSeconds_HASH = HashingUtils::CompileTimeHashString("ReceiveMessageWaitTimeSeconds");
+        static constexpr int RedrivePolicy_HASH = HashingUtils::CompileTimeHashString("RedrivePolicy");
+        static constexpr int FifoQueue_HASH = HashingUtils::CompileTimeHashString("FifoQueue");
+        static constexpr int ContentBasedDeduplication_HASH = HashingUtils::CompileTimeHashString("ContentBasedDeduplication");
+        static constexpr int KmsMasterKeyId_HASH = HashingUtils::CompileTimeHashString("KmsMasterKeyId");
+        static constexpr int KmsDataKeyReusePeriodSeconds_HASH = HashingUtils::CompileTimeHashString("KmsDataKeyReusePeriodSeconds");
+        static constexpr int SentTimestamp_HASH = HashingUtils::CompileTimeHashString("SentTimestamp");
+        static constexpr int ApproximateFirstReceiveTimestamp_HASH = HashingUtils::CompileTimeHashString("ApproximateFirstReceiveTimestamp");
+        static constexpr int ApproximateReceiveCount_HASH = HashingUtils::CompileTimeHashString("ApproximateReceiveCount");
+        static constexpr int SenderId_HASH = HashingUtils::CompileTimeHashString("SenderId");
 
 
         QueueAttributeName GetQueueAttributeNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return QueueAttributeName::All;
-          }
-          else if (hashCode == Policy_HASH)
-          {
-            return QueueAttributeName::Policy;
-          }
-          else if (hashCode == VisibilityTimeout_HASH)
-          {
-            return QueueAttributeName::VisibilityTimeout;
-          }
-          else if (hashCode == MaximumMessageSize_HASH)
-          {
-            return QueueAttributeName::MaximumMessageSize;
-          }
-          else if (hashCode == MessageRetentionPeriod_HASH)
-          {
-            return QueueAttributeName::MessageRetentionPeriod;
-          }
-          else if (hashCode == ApproximateNumberOfMessages_HASH)
-          {
-            return QueueAttributeName::ApproximateNumberOfMessages;
-          }
-          else if (hashCode == ApproximateNumberOfMessagesNotVisible_HASH)
-          {
-            return QueueAttributeName::ApproximateNumberOfMessagesNotVisible;
-          }
-          else if (hashCode == CreatedTimestamp_HASH)
-          {
-            return QueueAttributeName::CreatedTimestamp;
-          }
-          else if (hashCode == LastModifiedTimestamp_HASH)
-          {
-            return QueueAttributeName::LastModifiedTimestamp;
-          }
-          else if (hashCode == QueueArn_HASH)
-          {
-            return QueueAttributeName::QueueArn;
-          }
-          else if (hashCode == ApproximateNumberOfMessagesDelayed_HASH)
-          {
-            return QueueAttributeName::ApproximateNumberOfMessagesDelayed;
-          }
-          else if (hashCode == DelaySeconds_HASH)
-          {
-            return QueueAttributeName::DelaySeconds;
-          }
-          else if (hashCode == ReceiveMessageWaitTimeSeconds_HASH)
-          {
-            return QueueAttributeName::ReceiveMessageWaitTimeSeconds;
-          }
-          else if (hashCode == RedrivePolicy_HASH)
-          {
-            return QueueAttributeName::RedrivePolicy;
-          }
-          else if (hashCode == FifoQueue_HASH)
-          {
-            return QueueAttributeName::FifoQueue;
-          }
-          else if (hashCode == ContentBasedDeduplication_HASH)
-          {
-            return QueueAttributeName::ContentBasedDeduplication;
-          }
-          else if (hashCode == KmsMasterKeyId_HASH)
-          {
-            return QueueAttributeName::KmsMasterKeyId;
-          }
-          else if (hashCode == KmsDataKeyReusePeriodSeconds_HASH)
-          {
-            return QueueAttributeName::KmsDataKeyReusePeriodSeconds;
-          }
-          else if (hashCode == SentTimestamp_HASH)
-          {
-            return QueueAttributeName::SentTimestamp;
-          }
-          else if (hashCode == ApproximateFirstReceiveTimestamp_HASH)
-          {
-            return QueueAttributeName::ApproximateFirstReceiveTimestamp;
-          }
-          else if (hashCode == ApproximateReceiveCount_HASH)
-          {
-            return QueueAttributeName::ApproximateReceiveCount;
-          }
-          else if (hashCode == SenderId_HASH)
-          {
-            return QueueAttributeName::SenderId;
+          case All_HASH:
+            if (name == "All")
+            {
+              return QueueAttributeName::All;
+            }
+            break;
+          case Policy_HASH:
+            if (name == "Policy")
+            {
+              return QueueAttributeName::Policy;
+            }
+            break;
+          case VisibilityTimeout_HASH:
+            if (name == "VisibilityTimeout")
+            {
+              return QueueAttributeName::VisibilityTimeout;
+            }
+            break;
+          case MaximumMessageSize_HASH:
+            if (name == "MaximumMessageSize")
+            {
+              return QueueAttributeName::MaximumMessageSize;
+            }
+            break;
+          case MessageRetentionPeriod_HASH:
+            if (name == "MessageRetentionPeriod")
+            {
+              return QueueAttributeName::MessageRetentionPeriod;
+            }
+            break;
+          case ApproximateNumberOfMessages_HASH:
+            if (name == "ApproximateNumberOfMessages")
+            {
+              return QueueAttributeName::ApproximateNumberOfMessages;
+            }
+            break;
+          case ApproximateNumberOfMessagesNotVisible_HASH:
+            if (name == "ApproximateNumberOfMessagesNotVisible")
+            {
+              return QueueAttributeName::ApproximateNumberOfMessagesNotVisible;
+            }
+            break;
+          case CreatedTimestamp_HASH:
+            if (name == "CreatedTimestamp")
+            {
+              return QueueAttributeName::CreatedTimestamp;
+            }
+            break;
+          case LastModifiedTimestamp_HASH:
+            if (name == "LastModifiedTimestamp")
+            {
+              return QueueAttributeName::LastModifiedTimestamp;
+            }
+            break;
+          case QueueArn_HASH:
+            if (name == "QueueArn")
+            {
+              return QueueAttributeName::QueueArn;
+            }
+            break;
+          case ApproximateNumberOfMessagesDelayed_HASH:
+            if (name == "ApproximateNumberOfMessagesDelayed")
+            {
+              return QueueAttributeName::ApproximateNumberOfMessagesDelayed;
+            }
+            break;
+          case DelaySeconds_HASH:
+            if (name == "DelaySeconds")
+            {
+              return QueueAttributeName::DelaySeconds;
+            }
+            break;
+          case ReceiveMessageWaitTimeSeconds_HASH:
+            if (name == "ReceiveMessageWaitTimeSeconds")
+            {
+              return QueueAttributeName::ReceiveMessageWaitTimeSeconds;
+            }
+            break;
+          case RedrivePolicy_HASH:
+            if (name == "RedrivePolicy")
+            {
+              return QueueAttributeName::RedrivePolicy;
+            }
+            break;
+          case FifoQueue_HASH:
+            if (name == "FifoQueue")
+            {
+              return QueueAttributeName::FifoQueue;
+            }
+            break;
+          case ContentBasedDeduplication_HASH:
+            if (name == "ContentBasedDeduplication")
+            {
+              return QueueAttributeName::ContentBasedDeduplication;
+            }
+            break;
+          case KmsMasterKeyId_HASH:
+            if (name == "KmsMasterKeyId")
+            {
+              return QueueAttributeName::KmsMasterKeyId;
+            }
+            break;
+          case KmsDataKeyReusePeriodSeconds_HASH:
+            if (name == "KmsDataKeyReusePeriodSeconds")
+            {
+              return QueueAttributeName::KmsDataKeyReusePeriodSeconds;
+            }
+            break;
+          case SentTimestamp_HASH:
+            if (name == "SentTimestamp")
+            {
+              return QueueAttributeName::SentTimestamp;
+            }
+            break;
+          case ApproximateFirstReceiveTimestamp_HASH:
+            if (name == "ApproximateFirstReceiveTimestamp")
+            {
+              return QueueAttributeName::ApproximateFirstReceiveTimestamp;
+            }
+            break;
+          case ApproximateReceiveCount_HASH:
+            if (name == "ApproximateReceiveCount")
+            {
+              return QueueAttributeName::ApproximateReceiveCount;
+            }
+            break;
+          case SenderId_HASH:
+            if (name == "SenderId")
+            {
+              return QueueAttributeName::SenderId;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -155,7 +205,7 @@ namespace Aws
           return QueueAttributeName::NOT_SET;
         }
 
-        Aws::String GetNameForQueueAttributeName(QueueAttributeName enumValue)
+        const char* GetNameForQueueAttributeName(QueueAttributeName enumValue)
         {
           switch(enumValue)
           {
@@ -207,7 +257,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -49,7 +49,7 @@ Aws::String ReceiveMessageRequest::SerializePayload() const
     for(auto& item : m_attributeNames)
     {
       ss << "AttributeName." << attributeNamesCount << "="
-          << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item).c_str()) << "&";
+          << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item)) << "&";
       attributeNamesCount++;
     }
   }
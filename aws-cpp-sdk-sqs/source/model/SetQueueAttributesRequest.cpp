@@ -41,7 +41,7 @@ Aws::String SetQueueAttributesRequest::SerializePayload() const
     for(auto& item : m_attributes)
     {
       ss << "Attribute." << attributesCount << ".Name="
-          << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item.first).c_str()) << "&";
+          << StringUtils::URLEncode(QueueAttributeNameMapper::GetNameForQueueAttributeName(item.first)) << "&";
       ss << "Attribute." << attributesCount << ".Value="
           << StringUtils::URLEncode(item.second.c_str()) << "&";
       attributesCount++;
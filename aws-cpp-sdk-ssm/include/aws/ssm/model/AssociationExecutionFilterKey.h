@@ -35,7 +35,8 @@ namespace AssociationExecutionFilterKeyMapper
 {
 AWS_SSM_API AssociationExecutionFilterKey GetAssociationExecutionFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForAssociationExecutionFilterKey(AssociationExecutionFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForAssociationExecutionFilterKey(AssociationExecutionFilterKey value);
 } // namespace AssociationExecutionFilterKeyMapper
 } // namespace Model
 } // namespace SSM
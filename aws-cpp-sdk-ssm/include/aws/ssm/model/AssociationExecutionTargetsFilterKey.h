@@ -35,7 +35,8 @@ namespace AssociationExecutionTargetsFilterKeyMapper
 {
 AWS_SSM_API AssociationExecutionTargetsFilterKey GetAssociationExecutionTargetsFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForAssociationExecutionTargetsFilterKey(AssociationExecutionTargetsFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForAssociationExecutionTargetsFilterKey(AssociationExecutionTargetsFilterKey value);
 } // namespace AssociationExecutionTargetsFilterKeyMapper
 } // namespace Model
 } // namespace SSM
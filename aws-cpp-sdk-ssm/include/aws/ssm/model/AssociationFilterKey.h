@@ -39,7 +39,8 @@ namespace AssociationFilterKeyMapper
 {
 AWS_SSM_API AssociationFilterKey GetAssociationFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForAssociationFilterKey(AssociationFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForAssociationFilterKey(AssociationFilterKey value);
 } // namespace AssociationFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -35,7 +35,8 @@ namespace AssociationFilterOperatorTypeMapper
 {
 AWS_SSM_API AssociationFilterOperatorType GetAssociationFilterOperatorTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForAssociationFilterOperatorType(AssociationFilterOperatorType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForAssociationFilterOperatorType(AssociationFilterOperatorType value);
 } // namespace AssociationFilterOperatorTypeMapper
 } // namespace Model
 } // namespace SSM
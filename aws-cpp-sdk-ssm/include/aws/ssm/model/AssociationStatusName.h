@@ -35,7 +35,8 @@ namespace AssociationStatusNameMapper
 {
 AWS_SSM_API AssociationStatusName GetAssociationStatusNameForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForAssociationStatusName(AssociationStatusName value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForAssociationStatusName(AssociationStatusName value);
 } // namespace AssociationStatusNameMapper
 } // namespace Model
 } // namespace SSM
@@ -39,7 +39,8 @@ namespace AutomationExecutionFilterKeyMapper
 {
 AWS_SSM_API AutomationExecutionFilterKey GetAutomationExecutionFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForAutomationExecutionFilterKey(AutomationExecutionFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForAutomationExecutionFilterKey(AutomationExecutionFilterKey value);
 } // namespace AutomationExecutionFilterKeyMapper
 } // namespace Model
 } // namespace SSM
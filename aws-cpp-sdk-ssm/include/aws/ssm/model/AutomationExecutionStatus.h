@@ -40,7 +40,8 @@ namespace AutomationExecutionStatusMapper
 {
 AWS_SSM_API AutomationExecutionStatus GetAutomationExecutionStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForAutomationExecutionStatus(AutomationExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForAutomationExecutionStatus(AutomationExecutionStatus value);
 } // namespace AutomationExecutionStatusMapper
 } // namespace Model
 } // namespace SSM
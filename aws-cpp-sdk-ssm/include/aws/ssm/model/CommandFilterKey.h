@@ -35,7 +35,8 @@ namespace CommandFilterKeyMapper
 {
 AWS_SSM_API CommandFilterKey GetCommandFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForCommandFilterKey(CommandFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForCommandFilterKey(CommandFilterKey value);
 } // namespace CommandFilterKeyMapper
 } // namespace Model
 } // namespace SSM
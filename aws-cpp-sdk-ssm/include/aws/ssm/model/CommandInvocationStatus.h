@@ -40,7 +40,8 @@ namespace CommandInvocationStatusMapper
 {
 AWS_SSM_API CommandInvocationStatus GetCommandInvocationStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForCommandInvocationStatus(CommandInvocationStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForCommandInvocationStatus(CommandInvocationStatus value);
 } // namespace CommandInvocationStatusMapper
 } // namespace Model
 } // namespace SSM
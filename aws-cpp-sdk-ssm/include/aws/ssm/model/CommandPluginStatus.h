@@ -38,7 +38,8 @@ namespace CommandPluginStatusMapper
 {
 AWS_SSM_API CommandPluginStatus GetCommandPluginStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForCommandPluginStatus(CommandPluginStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForCommandPluginStatus(CommandPluginStatus value);
 } // namespace CommandPluginStatusMapper
 } // namespace Model
 } // namespace SSM
@@ -39,7 +39,8 @@ namespace CommandStatusMapper
 {
 AWS_SSM_API CommandStatus GetCommandStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForCommandStatus(CommandStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForCommandStatus(CommandStatus value);
 } // namespace CommandStatusMapper
 } // namespace Model
 } // namespace SSM
@@ -37,7 +37,8 @@ namespace ComplianceQueryOperatorTypeMapper
 {
 AWS_SSM_API ComplianceQueryOperatorType GetComplianceQueryOperatorTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForComplianceQueryOperatorType(ComplianceQueryOperatorType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForComplianceQueryOperatorType(ComplianceQueryOperatorType value);
 } // namespace ComplianceQueryOperatorTypeMapper
 } // namespace Model
 } // namespace SSM
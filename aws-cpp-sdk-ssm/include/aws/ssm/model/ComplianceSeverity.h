@@ -38,7 +38,8 @@ namespace ComplianceSeverityMapper
 {
 AWS_SSM_API ComplianceSeverity GetComplianceSeverityForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForComplianceSeverity(ComplianceSeverity value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForComplianceSeverity(ComplianceSeverity value);
 } // namespace ComplianceSeverityMapper
 } // namespace Model
 } // namespace SSM
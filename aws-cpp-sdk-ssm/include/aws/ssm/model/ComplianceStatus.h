@@ -34,7 +34,8 @@ namespace ComplianceStatusMapper
 {
 AWS_SSM_API ComplianceStatus GetComplianceStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForComplianceStatus(ComplianceStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForComplianceStatus(ComplianceStatus value);
 } // namespace ComplianceStatusMapper
 } // namespace Model
 } // namespace SSM
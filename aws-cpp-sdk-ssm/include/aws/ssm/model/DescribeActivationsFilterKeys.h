@@ -35,7 +35,8 @@ namespace DescribeActivationsFilterKeysMapper
 {
 AWS_SSM_API DescribeActivationsFilterKeys GetDescribeActivationsFilterKeysForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForDescribeActivationsFilterKeys(DescribeActivationsFilterKeys value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForDescribeActivationsFilterKeys(DescribeActivationsFilterKeys value);
 } // namespace DescribeActivationsFilterKeysMapper
 } // namespace Model
 } // namespace SSM
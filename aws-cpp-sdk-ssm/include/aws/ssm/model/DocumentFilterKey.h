@@ -36,7 +36,8 @@ namespace DocumentFilterKeyMapper
 {
 AWS_SSM_API DocumentFilterKey GetDocumentFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForDocumentFilterKey(DocumentFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForDocumentFilterKey(DocumentFilterKey value);
 } // namespace DocumentFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -34,7 +34,8 @@ namespace DocumentFormatMapper
 {
 AWS_SSM_API DocumentFormat GetDocumentFormatForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForDocumentFormat(DocumentFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForDocumentFormat(DocumentFormat value);
 } // namespace DocumentFormatMapper
 } // namespace Model
 } // namespace SSM
@@ -34,7 +34,8 @@ namespace DocumentHashTypeMapper
 {
 AWS_SSM_API DocumentHashType GetDocumentHashTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForDocumentHashType(DocumentHashType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForDocumentHashType(DocumentHashType value);
 } // namespace DocumentHashTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -34,7 +34,8 @@ namespace DocumentParameterTypeMapper
 {
 AWS_SSM_API DocumentParameterType GetDocumentParameterTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForDocumentParameterType(DocumentParameterType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForDocumentParameterType(DocumentParameterType value);
 } // namespace DocumentParameterTypeMapper
 } // namespace Model
 } // namespace SSM
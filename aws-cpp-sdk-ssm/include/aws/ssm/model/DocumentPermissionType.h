@@ -33,7 +33,8 @@ namespace DocumentPermissionTypeMapper
 {
 AWS_SSM_API DocumentPermissionType GetDocumentPermissionTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForDocumentPermissionType(DocumentPermissionType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForDocumentPermissionType(DocumentPermissionType value);
 } // namespace DocumentPermissionTypeMapper
 } // namespace Model
 } // namespace SSM
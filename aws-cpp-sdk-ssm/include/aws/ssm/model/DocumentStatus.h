@@ -36,7 +36,8 @@ namespace DocumentStatusMapper
 {
 AWS_SSM_API DocumentStatus GetDocumentStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForDocumentStatus(DocumentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForDocumentStatus(DocumentStatus value);
 } // namespace DocumentStatusMapper
 } // namespace Model
 } // namespace SSM
@@ -35,7 +35,8 @@ namespace DocumentTypeMapper
 {
 AWS_SSM_API DocumentType GetDocumentTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForDocumentType(DocumentType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForDocumentType(DocumentType value);
 } // namespace DocumentTypeMapper
 } // namespace Model
 } // namespace SSM
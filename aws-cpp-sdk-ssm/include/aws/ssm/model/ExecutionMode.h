@@ -34,7 +34,8 @@ namespace ExecutionModeMapper
 {
 AWS_SSM_API ExecutionMode GetExecutionModeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForExecutionMode(ExecutionMode value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForExecutionMode(ExecutionMode value);
 } // namespace ExecutionModeMapper
 } // namespace Model
 } // namespace SSM
@@ -35,7 +35,8 @@ namespace FaultMapper
 {
 AWS_SSM_API Fault GetFaultForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForFault(Fault value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForFault(Fault value);
 } // namespace FaultMapper
 } // namespace Model
 } // namespace SSM
@@ -40,7 +40,8 @@ namespace InstanceInformationFilterKeyMapper
 {
 AWS_SSM_API InstanceInformationFilterKey GetInstanceInformationFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForInstanceInformationFilterKey(InstanceInformationFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForInstanceInformationFilterKey(InstanceInformationFilterKey value);
 } // namespace InstanceInformationFilterKeyMapper
 } // namespace Model
 } // namespace SSM
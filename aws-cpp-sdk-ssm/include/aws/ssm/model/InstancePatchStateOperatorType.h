@@ -36,7 +36,8 @@ namespace InstancePatchStateOperatorTypeMapper
 {
 AWS_SSM_API InstancePatchStateOperatorType GetInstancePatchStateOperatorTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForInstancePatchStateOperatorType(InstancePatchStateOperatorType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForInstancePatchStateOperatorType(InstancePatchStateOperatorType value);
 } // namespace InstancePatchStateOperatorTypeMapper
 } // namespace Model
 } // namespace SSM
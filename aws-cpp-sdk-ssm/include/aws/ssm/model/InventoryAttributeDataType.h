@@ -34,7 +34,8 @@ namespace InventoryAttributeDataTypeMapper
 {
 AWS_SSM_API InventoryAttributeDataType GetInventoryAttributeDataTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForInventoryAttributeDataType(InventoryAttributeDataType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForInventoryAttributeDataType(InventoryAttributeDataType value);
 } // namespace InventoryAttributeDataTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -34,7 +34,8 @@ namespace InventoryDeletionStatusMapper
 {
 AWS_SSM_API InventoryDeletionStatus GetInventoryDeletionStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForInventoryDeletionStatus(InventoryDeletionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForInventoryDeletionStatus(InventoryDeletionStatus value);
 } // namespace InventoryDeletionStatusMapper
 } // namespace Model
 } // namespace SSM
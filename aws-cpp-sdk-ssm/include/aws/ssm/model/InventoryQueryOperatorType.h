@@ -37,7 +37,8 @@ namespace InventoryQueryOperatorTypeMapper
 {
 AWS_SSM_API InventoryQueryOperatorType GetInventoryQueryOperatorTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForInventoryQueryOperatorType(InventoryQueryOperatorType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForInventoryQueryOperatorType(InventoryQueryOperatorType value);
 } // namespace InventoryQueryOperatorTypeMapper
 } // namespace Model
 } // namespace SSM
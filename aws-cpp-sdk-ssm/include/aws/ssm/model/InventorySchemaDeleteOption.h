@@ -34,7 +34,8 @@ namespace InventorySchemaDeleteOptionMapper
 {
 AWS_SSM_API InventorySchemaDeleteOption GetInventorySchemaDeleteOptionForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForInventorySchemaDeleteOption(InventorySchemaDeleteOption value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForInventorySchemaDeleteOption(InventorySchemaDeleteOption value);
 } // namespace InventorySchemaDeleteOptionMapper
 } // namespace Model
 } // namespace SSM
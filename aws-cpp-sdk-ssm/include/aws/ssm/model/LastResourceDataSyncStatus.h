@@ -35,7 +35,8 @@ namespace LastResourceDataSyncStatusMapper
 {
 AWS_SSM_API LastResourceDataSyncStatus GetLastResourceDataSyncStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForLastResourceDataSyncStatus(LastResourceDataSyncStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForLastResourceDataSyncStatus(LastResourceDataSyncStatus value);
 } // namespace LastResourceDataSyncStatusMapper
 } // namespace Model
 } // namespace SSM
@@ -40,7 +40,8 @@ namespace MaintenanceWindowExecutionStatusMapper
 {
 AWS_SSM_API MaintenanceWindowExecutionStatus GetMaintenanceWindowExecutionStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForMaintenanceWindowExecutionStatus(MaintenanceWindowExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForMaintenanceWindowExecutionStatus(MaintenanceWindowExecutionStatus value);
 } // namespace MaintenanceWindowExecutionStatusMapper
 } // namespace Model
 } // namespace SSM
@@ -33,7 +33,8 @@ namespace MaintenanceWindowResourceTypeMapper
 {
 AWS_SSM_API MaintenanceWindowResourceType GetMaintenanceWindowResourceTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForMaintenanceWindowResourceType(MaintenanceWindowResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForMaintenanceWindowResourceType(MaintenanceWindowResourceType value);
 } // namespace MaintenanceWindowResourceTypeMapper
 } // namespace Model
 } // namespace SSM
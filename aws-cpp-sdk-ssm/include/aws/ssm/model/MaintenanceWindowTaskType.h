@@ -36,7 +36,8 @@ namespace MaintenanceWindowTaskTypeMapper
 {
 AWS_SSM_API MaintenanceWindowTaskType GetMaintenanceWindowTaskTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForMaintenanceWindowTaskType(MaintenanceWindowTaskType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForMaintenanceWindowTaskType(MaintenanceWindowTaskType value);
 } // namespace MaintenanceWindowTaskTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -38,7 +38,8 @@ namespace NotificationEventMapper
 {
 AWS_SSM_API NotificationEvent GetNotificationEventForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForNotificationEvent(NotificationEvent value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForNotificationEvent(NotificationEvent value);
 } // namespace NotificationEventMapper
 } // namespace Model
 } // namespace SSM
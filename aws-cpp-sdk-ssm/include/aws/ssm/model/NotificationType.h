@@ -34,7 +34,8 @@ namespace NotificationTypeMapper
 {
 AWS_SSM_API NotificationType GetNotificationTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForNotificationType(NotificationType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForNotificationType(NotificationType value);
 } // namespace NotificationTypeMapper
 } // namespace Model
 } // namespace SSM
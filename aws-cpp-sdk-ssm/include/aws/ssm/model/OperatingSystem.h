@@ -39,7 +39,8 @@ namespace OperatingSystemMapper
 {
 AWS_SSM_API OperatingSystem GetOperatingSystemForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForOperatingSystem(OperatingSystem value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForOperatingSystem(OperatingSystem value);
 } // namespace OperatingSystemMapper
 } // namespace Model
 } // namespace SSM
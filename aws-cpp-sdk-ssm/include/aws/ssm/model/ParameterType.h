@@ -35,7 +35,8 @@ namespace ParameterTypeMapper
 {
 AWS_SSM_API ParameterType GetParameterTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForParameterType(ParameterType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForParameterType(ParameterType value);
 } // namespace ParameterTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -35,7 +35,8 @@ namespace ParametersFilterKeyMapper
 {
 AWS_SSM_API ParametersFilterKey GetParametersFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForParametersFilterKey(ParametersFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForParametersFilterKey(ParametersFilterKey value);
 } // namespace ParametersFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -37,7 +37,8 @@ namespace PatchComplianceDataStateMapper
 {
 AWS_SSM_API PatchComplianceDataState GetPatchComplianceDataStateForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForPatchComplianceDataState(PatchComplianceDataState value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForPatchComplianceDataState(PatchComplianceDataState value);
 } // namespace PatchComplianceDataStateMapper
 } // namespace Model
 } // namespace SSM
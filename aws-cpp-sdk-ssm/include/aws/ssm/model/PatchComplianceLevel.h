@@ -38,7 +38,8 @@ namespace PatchComplianceLevelMapper
 {
 AWS_SSM_API PatchComplianceLevel GetPatchComplianceLevelForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForPatchComplianceLevel(PatchComplianceLevel value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForPatchComplianceLevel(PatchComplianceLevel value);
 } // namespace PatchComplianceLevelMapper
 } // namespace Model
 } // namespace SSM
@@ -36,7 +36,8 @@ namespace PatchDeploymentStatusMapper
 {
 AWS_SSM_API PatchDeploymentStatus GetPatchDeploymentStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForPatchDeploymentStatus(PatchDeploymentStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForPatchDeploymentStatus(PatchDeploymentStatus value);
 } // namespace PatchDeploymentStatusMapper
 } // namespace Model
 } // namespace SSM
@@ -39,7 +39,8 @@ namespace PatchFilterKeyMapper
 {
 AWS_SSM_API PatchFilterKey GetPatchFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForPatchFilterKey(PatchFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForPatchFilterKey(PatchFilterKey value);
 } // namespace PatchFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -34,7 +34,8 @@ namespace PatchOperationTypeMapper
 {
 AWS_SSM_API PatchOperationType GetPatchOperationTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForPatchOperationType(PatchOperationType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForPatchOperationType(PatchOperationType value);
 } // namespace PatchOperationTypeMapper
 } // namespace Model
 } // namespace SSM
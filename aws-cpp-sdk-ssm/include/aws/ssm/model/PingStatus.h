@@ -35,7 +35,8 @@ namespace PingStatusMapper
 {
 AWS_SSM_API PingStatus GetPingStatusForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForPingStatus(PingStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForPingStatus(PingStatus value);
 } // namespace PingStatusMapper
 } // namespace Model
 } // namespace SSM
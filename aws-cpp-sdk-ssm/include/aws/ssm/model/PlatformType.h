@@ -34,7 +34,8 @@ namespace PlatformTypeMapper
 {
 AWS_SSM_API PlatformType GetPlatformTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForPlatformType(PlatformType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForPlatformType(PlatformType value);
 } // namespace PlatformTypeMapper
 } // namespace Model
 } // namespace SSM
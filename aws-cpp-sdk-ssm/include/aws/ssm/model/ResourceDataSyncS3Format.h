@@ -33,7 +33,8 @@ namespace ResourceDataSyncS3FormatMapper
 {
 AWS_SSM_API ResourceDataSyncS3Format GetResourceDataSyncS3FormatForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForResourceDataSyncS3Format(ResourceDataSyncS3Format value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForResourceDataSyncS3Format(ResourceDataSyncS3Format value);
 } // namespace ResourceDataSyncS3FormatMapper
 } // namespace Model
 } // namespace SSM
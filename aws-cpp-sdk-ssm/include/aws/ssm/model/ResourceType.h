@@ -35,7 +35,8 @@ namespace ResourceTypeMapper
 {
 AWS_SSM_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForResourceType(ResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForResourceType(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace SSM
@@ -37,7 +37,8 @@ namespace ResourceTypeForTaggingMapper
 {
 AWS_SSM_API ResourceTypeForTagging GetResourceTypeForTaggingForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForResourceTypeForTagging(ResourceTypeForTagging value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForResourceTypeForTagging(ResourceTypeForTagging value);
 } // namespace ResourceTypeForTaggingMapper
 } // namespace Model
 } // namespace SSM
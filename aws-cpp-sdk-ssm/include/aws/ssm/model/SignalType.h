@@ -37,7 +37,8 @@ namespace SignalTypeMapper
 {
 AWS_SSM_API SignalType GetSignalTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForSignalType(SignalType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForSignalType(SignalType value);
 } // namespace SignalTypeMapper
 } // namespace Model
 } // namespace SSM
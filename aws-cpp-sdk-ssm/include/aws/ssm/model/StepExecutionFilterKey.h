@@ -38,7 +38,8 @@ namespace StepExecutionFilterKeyMapper
 {
 AWS_SSM_API StepExecutionFilterKey GetStepExecutionFilterKeyForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForStepExecutionFilterKey(StepExecutionFilterKey value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForStepExecutionFilterKey(StepExecutionFilterKey value);
 } // namespace StepExecutionFilterKeyMapper
 } // namespace Model
 } // namespace SSM
@@ -34,7 +34,8 @@ namespace StopTypeMapper
 {
 AWS_SSM_API StopType GetStopTypeForName(const Aws::String& name);
 
-AWS_SSM_API Aws::String GetNameForStopType(StopType value);
+// names of values not modeled point into the enum overflow container
+AWS_SSM_API const char* GetNameForStopType(StopType value);
 } // namespace StopTypeMapper
 } // namespace Model
 } // namespace SSM
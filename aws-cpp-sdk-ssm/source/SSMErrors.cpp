@@ -28,101 +28,101 @@ namespace SSM
 namespace SSMErrorMapper
 {
 
-static const int INVALID_ACTIVATION_ID_HASH = HashingUtils::HashString("InvalidActivationId");
-static const int DOES_NOT_EXIST_HASH = HashingUtils::HashString("DoesNotExistException");
-static const int INVALID_COMMAND_ID_HASH = HashingUtils::HashString("InvalidCommandId");
-static const int INVALID_SCHEDULE_HASH = HashingUtils::HashString("InvalidSchedule");
-static const int HIERARCHY_TYPE_MISMATCH_HASH = HashingUtils::HashString("HierarchyTypeMismatchException");
-static const int INVALID_INSTANCE_INFORMATION_FILTER_VALUE_HASH = HashingUtils::HashString("InvalidInstanceInformationFilterValue");
-static const int INVALID_OPTION_HASH = HashingUtils::HashString("InvalidOptionException");
-static const int CUSTOM_SCHEMA_COUNT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("CustomSchemaCountLimitExceededException");
-static const int INVALID_AUTOMATION_EXECUTION_PARAMETERS_HASH = HashingUtils::HashString("InvalidAutomationExecutionParametersException");
-static const int TARGET_IN_USE_HASH = HashingUtils::HashString("TargetInUseException");
-static const int ITEM_CONTENT_MISMATCH_HASH = HashingUtils::HashString("ItemContentMismatchException");
-static const int MAX_DOCUMENT_SIZE_EXCEEDED_HASH = HashingUtils::HashString("MaxDocumentSizeExceeded");
-static const int TOTAL_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TotalSizeLimitExceededException");
-static const int INVALID_RESOURCE_TYPE_HASH = HashingUtils::HashString("InvalidResourceType");
-static const int INVALID_ROLE_HASH = HashingUtils::HashString("InvalidRole");
-static const int INVALID_ASSOCIATION_HASH = HashingUtils::HashString("InvalidAssociation");
-static const int RESOURCE_DATA_SYNC_NOT_FOUND_HASH = HashingUtils::HashString("ResourceDataSyncNotFoundException");
-static const int INVALID_DOCUMENT_OPERATION_HASH = HashingUtils::HashString("InvalidDocumentOperation");
-static const int INVALID_TARGET_HASH = HashingUtils::HashString("InvalidTarget");
-static const int INVALID_DOCUMENT_CONTENT_HASH = HashingUtils::HashString("InvalidDocumentContent");
-static const int PARAMETER_VERSION_LABEL_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ParameterVersionLabelLimitExceeded");
-static const int TOO_MANY_TAGS_HASH = HashingUtils::HashString("TooManyTagsError");
-static const int INVALID_FILTER_VALUE_HASH = HashingUtils::HashString("InvalidFilterValue");
-static const int INVALID_INVENTORY_REQUEST_HASH = HashingUtils::HashString("InvalidInventoryRequestException");
-static const int RESOURCE_DATA_SYNC_COUNT_EXCEEDED_HASH = HashingUtils::HashString("ResourceDataSyncCountExceededException");
-static const int DUPLICATE_DOCUMENT_CONTENT_HASH = HashingUtils::HashString("DuplicateDocumentContent");
-static const int ASSOCIATION_EXECUTION_DOES_NOT_EXIST_HASH = HashingUtils::HashString("AssociationExecutionDoesNotExist");
-static const int INVALID_DELETE_INVENTORY_PARAMETERS_HASH = HashingUtils::HashString("InvalidDeleteInventoryParametersException");
-static const int AUTOMATION_STEP_NOT_FOUND_HASH = HashingUtils::HashString("AutomationStepNotFoundException");
-static const int INVALID_PARAMETERS_HASH = HashingUtils::HashString("InvalidParameters");
-static const int INVALID_DOCUMENT_HASH = HashingUtils::HashString("InvalidDocument");
-static const int UNSUPPORTED_INVENTORY_ITEM_CONTEXT_HASH = HashingUtils::HashString("UnsupportedInventoryItemContextException");
-static const int PARAMETER_MAX_VERSION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ParameterMaxVersionLimitExceeded");
-static const int DOCUMENT_ALREADY_EXISTS_HASH = HashingUtils::HashString("DocumentAlreadyExists");
-static const int RESOURCE_DATA_SYNC_ALREADY_EXISTS_HASH = HashingUtils::HashString("ResourceDataSyncAlreadyExistsException");
-static const int INVALID_PLUGIN_NAME_HASH = HashingUtils::HashString("InvalidPluginName");
-static const int UNSUPPORTED_INVENTORY_SCHEMA_VERSION_HASH = HashingUtils::HashString("UnsupportedInventorySchemaVersionException");
-static const int ASSOCIATION_DOES_NOT_EXIST_HASH = HashingUtils::HashString("AssociationDoesNotExist");
-static const int RESOURCE_IN_USE_HASH = HashingUtils::HashString("ResourceInUseException");
-static const int PARAMETER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ParameterLimitExceeded");
-static const int AUTOMATION_DEFINITION_VERSION_NOT_FOUND_HASH = HashingUtils::HashString("AutomationDefinitionVersionNotFoundException");
-static const int ASSOCIATION_VERSION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AssociationVersionLimitExceeded");
-static const int INVALID_AUTOMATION_SIGNAL_HASH = HashingUtils::HashString("InvalidAutomationSignalException");
-static const int INVALID_INSTANCE_ID_HASH = HashingUtils::HashString("InvalidInstanceId");
-static const int DOCUMENT_PERMISSION_LIMIT_HASH = HashingUtils::HashString("DocumentPermissionLimit");
-static const int INVALID_PERMISSION_TYPE_HASH = HashingUtils::HashString("InvalidPermissionType");
-static const int ALREADY_EXISTS_HASH = HashingUtils::HashString("AlreadyExistsException");
-static const int DOCUMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DocumentLimitExceeded");
-static const int INVALID_NOTIFICATION_CONFIG_HASH = HashingUtils::HashString("InvalidNotificationConfig");
-static const int ASSOCIATION_ALREADY_EXISTS_HASH = HashingUtils::HashString("AssociationAlreadyExists");
-static const int ITEM_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ItemSizeLimitExceededException");
-static const int PARAMETER_PATTERN_MISMATCH_HASH = HashingUtils::HashString("ParameterPatternMismatchException");
-static const int INVALID_FILTER_HASH = HashingUtils::HashString("InvalidFilter");
-static const int PARAMETER_NOT_FOUND_HASH = HashingUtils::HashString("ParameterNotFound");
-static const int AUTOMATION_DEFINITION_NOT_FOUND_HASH = HashingUtils::HashString("AutomationDefinitionNotFoundException");
-static const int DOCUMENT_VERSION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DocumentVersionLimitExceeded");
-static const int INVALID_ALLOWED_PATTERN_HASH = HashingUtils::HashString("InvalidAllowedPatternException");
-static const int INVALID_ASSOCIATION_VERSION_HASH = HashingUtils::HashString("InvalidAssociationVersion");
-static const int INVOCATION_DOES_NOT_EXIST_HASH = HashingUtils::HashString("InvocationDoesNotExist");
-static const int UNSUPPORTED_OPERATING_SYSTEM_HASH = HashingUtils::HashString("UnsupportedOperatingSystem");
-static const int FEATURE_NOT_AVAILABLE_HASH = HashingUtils::HashString("FeatureNotAvailableException");
-static const int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ResourceLimitExceededException");
-static const int INVALID_ACTIVATION_HASH = HashingUtils::HashString("InvalidActivation");
-static const int HIERARCHY_LEVEL_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("HierarchyLevelLimitExceededException");
-static const int UNSUPPORTED_PARAMETER_TYPE_HASH = HashingUtils::HashString("UnsupportedParameterType");
-static const int INVALID_FILTER_KEY_HASH = HashingUtils::HashString("InvalidFilterKey");
-static const int INVALID_DELETION_ID_HASH = HashingUtils::HashString("InvalidDeletionIdException");
-static const int INVALID_FILTER_OPTION_HASH = HashingUtils::HashString("InvalidFilterOption");
-static const int RESOURCE_DATA_SYNC_INVALID_CONFIGURATION_HASH = HashingUtils::HashString("ResourceDataSyncInvalidConfigurationException");
-static const int PARAMETER_ALREADY_EXISTS_HASH = HashingUtils::HashString("ParameterAlreadyExists");
-static const int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::HashString("IdempotentParameterMismatch");
-static const int INVALID_NEXT_TOKEN_HASH = HashingUtils::HashString("InvalidNextToken");
-static const int UNSUPPORTED_PLATFORM_TYPE_HASH = HashingUtils::HashString("UnsupportedPlatformType");
-static const int AUTOMATION_EXECUTION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AutomationExecutionLimitExceededException");
-static const int INVALID_UPDATE_HASH = HashingUtils::HashString("InvalidUpdate");
-static const int INVALID_ITEM_CONTENT_HASH = HashingUtils::HashString("InvalidItemContentException");
-static const int INVALID_OUTPUT_LOCATION_HASH = HashingUtils::HashString("InvalidOutputLocation");
-static const int COMPLIANCE_TYPE_COUNT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ComplianceTypeCountLimitExceededException");
-static const int PARAMETER_VERSION_NOT_FOUND_HASH = HashingUtils::HashString("ParameterVersionNotFound");
-static const int ASSOCIATION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AssociationLimitExceeded");
-static const int AUTOMATION_EXECUTION_NOT_FOUND_HASH = HashingUtils::HashString("AutomationExecutionNotFoundException");
-static const int INVALID_INVENTORY_ITEM_CONTEXT_HASH = HashingUtils::HashString("InvalidInventoryItemContextException");
-static const int INVALID_RESULT_ATTRIBUTE_HASH = HashingUtils::HashString("InvalidResultAttributeException");
-static const int INVALID_KEY_ID_HASH = HashingUtils::HashString("InvalidKeyId");
-static const int INVALID_TYPE_NAME_HASH = HashingUtils::HashString("InvalidTypeNameException");
-static const int STATUS_UNCHANGED_HASH = HashingUtils::HashString("StatusUnchanged");
-static const int TOO_MANY_UPDATES_HASH = HashingUtils::HashString("TooManyUpdates");
-static const int INVALID_DOCUMENT_SCHEMA_VERSION_HASH = HashingUtils::HashString("InvalidDocumentSchemaVersion");
-static const int DUPLICATE_INSTANCE_ID_HASH = HashingUtils::HashString("DuplicateInstanceId");
-static const int SUB_TYPE_COUNT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("SubTypeCountLimitExceededException");
-static const int INVALID_AUTOMATION_STATUS_UPDATE_HASH = HashingUtils::HashString("InvalidAutomationStatusUpdateException");
-static const int INVALID_DOCUMENT_VERSION_HASH = HashingUtils::HashString("InvalidDocumentVersion");
-static const int INVALID_OUTPUT_FOLDER_HASH = HashingUtils::HashString("InvalidOutputFolder");
-static const int INVALID_RESOURCE_ID_HASH = HashingUtils::HashString("InvalidResourceId");
-static const int ASSOCIATED_INSTANCES_HASH = HashingUtils::HashString("AssociatedInstances");
+static constexpr int INVALID_ACTIVATION_ID_HASH = HashingUtils::CompileTimeHashString("InvalidActivationId");
+static constexpr int DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("DoesNotExistException");
+static constexpr int INVALID_COMMAND_ID_HASH = HashingUtils::CompileTimeHashString("InvalidCommandId");
+static constexpr int INVALID_SCHEDULE_HASH = HashingUtils::CompileTimeHashString("InvalidSchedule");
+static constexpr int HIERARCHY_TYPE_MISMATCH_HASH = HashingUtils::CompileTimeHashString("HierarchyTypeMismatchException");
+static constexpr int INVALID_INSTANCE_INFORMATION_FILTER_VALUE_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceInformationFilterValue");
+static constexpr int INVALID_OPTION_HASH = HashingUtils::CompileTimeHashString("InvalidOptionException");
+static constexpr int CUSTOM_SCHEMA_COUNT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CustomSchemaCountLimitExceededException");
+static constexpr int INVALID_AUTOMATION_EXECUTION_PARAMETERS_HASH = HashingUtils::CompileTimeHashString("InvalidAutomationExecutionParametersException");
+static constexpr int TARGET_IN_USE_HASH = HashingUtils::CompileTimeHashString("TargetInUseException");
+static constexpr int ITEM_CONTENT_MISMATCH_HASH = HashingUtils::CompileTimeHashString("ItemContentMismatchException");
+static constexpr int MAX_DOCUMENT_SIZE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("MaxDocumentSizeExceeded");
+static constexpr int TOTAL_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TotalSizeLimitExceededException");
+static constexpr int INVALID_RESOURCE_TYPE_HASH = HashingUtils::CompileTimeHashString("InvalidResourceType");
+static constexpr int INVALID_ROLE_HASH = HashingUtils::CompileTimeHashString("InvalidRole");
+static constexpr int INVALID_ASSOCIATION_HASH = HashingUtils::CompileTimeHashString("InvalidAssociation");
+static constexpr int RESOURCE_DATA_SYNC_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ResourceDataSyncNotFoundException");
+static constexpr int INVALID_DOCUMENT_OPERATION_HASH = HashingUtils::CompileTimeHashString("InvalidDocumentOperation");
+static constexpr int INVALID_TARGET_HASH = HashingUtils::CompileTimeHashString("InvalidTarget");
+static constexpr int INVALID_DOCUMENT_CONTENT_HASH = HashingUtils::CompileTimeHashString("InvalidDocumentContent");
+static constexpr int PARAMETER_VERSION_LABEL_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ParameterVersionLabelLimitExceeded");
+static constexpr int TOO_MANY_TAGS_HASH = HashingUtils::CompileTimeHashString("TooManyTagsError");
+static constexpr int INVALID_FILTER_VALUE_HASH = HashingUtils::CompileTimeHashString("InvalidFilterValue");
+static constexpr int INVALID_INVENTORY_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidInventoryRequestException");
+static constexpr int RESOURCE_DATA_SYNC_COUNT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceDataSyncCountExceededException");
+static constexpr int DUPLICATE_DOCUMENT_CONTENT_HASH = HashingUtils::CompileTimeHashString("DuplicateDocumentContent");
+static constexpr int ASSOCIATION_EXECUTION_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("AssociationExecutionDoesNotExist");
+static constexpr int INVALID_DELETE_INVENTORY_PARAMETERS_HASH = HashingUtils::CompileTimeHashString("InvalidDeleteInventoryParametersException");
+static constexpr int AUTOMATION_STEP_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("AutomationStepNotFoundException");
+static constexpr int INVALID_PARAMETERS_HASH = HashingUtils::CompileTimeHashString("InvalidParameters");
+static constexpr int INVALID_DOCUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidDocument");
+static constexpr int UNSUPPORTED_INVENTORY_ITEM_CONTEXT_HASH = HashingUtils::CompileTimeHashString("UnsupportedInventoryItemContextException");
+static constexpr int PARAMETER_MAX_VERSION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ParameterMaxVersionLimitExceeded");
+static constexpr int DOCUMENT_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("DocumentAlreadyExists");
+static constexpr int RESOURCE_DATA_SYNC_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceDataSyncAlreadyExistsException");
+static constexpr int INVALID_PLUGIN_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidPluginName");
+static constexpr int UNSUPPORTED_INVENTORY_SCHEMA_VERSION_HASH = HashingUtils::CompileTimeHashString("UnsupportedInventorySchemaVersionException");
+static constexpr int ASSOCIATION_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("AssociationDoesNotExist");
+static constexpr int RESOURCE_IN_USE_HASH = HashingUtils::CompileTimeHashString("ResourceInUseException");
+static constexpr int PARAMETER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ParameterLimitExceeded");
+static constexpr int AUTOMATION_DEFINITION_VERSION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("AutomationDefinitionVersionNotFoundException");
+static constexpr int ASSOCIATION_VERSION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AssociationVersionLimitExceeded");
+static constexpr int INVALID_AUTOMATION_SIGNAL_HASH = HashingUtils::CompileTimeHashString("InvalidAutomationSignalException");
+static constexpr int INVALID_INSTANCE_ID_HASH = HashingUtils::CompileTimeHashString("InvalidInstanceId");
+static constexpr int DOCUMENT_PERMISSION_LIMIT_HASH = HashingUtils::CompileTimeHashString("DocumentPermissionLimit");
+static constexpr int INVALID_PERMISSION_TYPE_HASH = HashingUtils::CompileTimeHashString("InvalidPermissionType");
+static constexpr int ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("AlreadyExistsException");
+static constexpr int DOCUMENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DocumentLimitExceeded");
+static constexpr int INVALID_NOTIFICATION_CONFIG_HASH = HashingUtils::CompileTimeHashString("InvalidNotificationConfig");
+static constexpr int ASSOCIATION_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("AssociationAlreadyExists");
+static constexpr int ITEM_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ItemSizeLimitExceededException");
+static constexpr int PARAMETER_PATTERN_MISMATCH_HASH = HashingUtils::CompileTimeHashString("ParameterPatternMismatchException");
+static constexpr int INVALID_FILTER_HASH = HashingUtils::CompileTimeHashString("InvalidFilter");
+static constexpr int PARAMETER_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ParameterNotFound");
+static constexpr int AUTOMATION_DEFINITION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("AutomationDefinitionNotFoundException");
+static constexpr int DOCUMENT_VERSION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DocumentVersionLimitExceeded");
+static constexpr int INVALID_ALLOWED_PATTERN_HASH = HashingUtils::CompileTimeHashString("InvalidAllowedPatternException");
+static constexpr int INVALID_ASSOCIATION_VERSION_HASH = HashingUtils::CompileTimeHashString("InvalidAssociationVersion");
+static constexpr int INVOCATION_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("InvocationDoesNotExist");
+static constexpr int UNSUPPORTED_OPERATING_SYSTEM_HASH = HashingUtils::CompileTimeHashString("UnsupportedOperatingSystem");
+static constexpr int FEATURE_NOT_AVAILABLE_HASH = HashingUtils::CompileTimeHashString("FeatureNotAvailableException");
+static constexpr int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceLimitExceededException");
+static constexpr int INVALID_ACTIVATION_HASH = HashingUtils::CompileTimeHashString("InvalidActivation");
+static constexpr int HIERARCHY_LEVEL_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("HierarchyLevelLimitExceededException");
+static constexpr int UNSUPPORTED_PARAMETER_TYPE_HASH = HashingUtils::CompileTimeHashString("UnsupportedParameterType");
+static constexpr int INVALID_FILTER_KEY_HASH = HashingUtils::CompileTimeHashString("InvalidFilterKey");
+static constexpr int INVALID_DELETION_ID_HASH = HashingUtils::CompileTimeHashString("InvalidDeletionIdException");
+static constexpr int INVALID_FILTER_OPTION_HASH = HashingUtils::CompileTimeHashString("InvalidFilterOption");
+static constexpr int RESOURCE_DATA_SYNC_INVALID_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("ResourceDataSyncInvalidConfigurationException");
+static constexpr int PARAMETER_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ParameterAlreadyExists");
+static constexpr int IDEMPOTENT_PARAMETER_MISMATCH_HASH = HashingUtils::CompileTimeHashString("IdempotentParameterMismatch");
+static constexpr int INVALID_NEXT_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidNextToken");
+static constexpr int UNSUPPORTED_PLATFORM_TYPE_HASH = HashingUtils::CompileTimeHashString("UnsupportedPlatformType");
+static constexpr int AUTOMATION_EXECUTION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AutomationExecutionLimitExceededException");
+static constexpr int INVALID_UPDATE_HASH = HashingUtils::CompileTimeHashString("InvalidUpdate");
+static constexpr int INVALID_ITEM_CONTENT_HASH = HashingUtils::CompileTimeHashString("InvalidItemContentException");
+static constexpr int INVALID_OUTPUT_LOCATION_HASH = HashingUtils::CompileTimeHashString("InvalidOutputLocation");
+static constexpr int COMPLIANCE_TYPE_COUNT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ComplianceTypeCountLimitExceededException");
+static constexpr int PARAMETER_VERSION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("ParameterVersionNotFound");
+static constexpr int ASSOCIATION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AssociationLimitExceeded");
+static constexpr int AUTOMATION_EXECUTION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("AutomationExecutionNotFoundException");
+static constexpr int INVALID_INVENTORY_ITEM_CONTEXT_HASH = HashingUtils::CompileTimeHashString("InvalidInventoryItemContextException");
+static constexpr int INVALID_RESULT_ATTRIBUTE_HASH = HashingUtils::CompileTimeHashString("InvalidResultAttributeException");
+static constexpr int INVALID_KEY_ID_HASH = HashingUtils::CompileTimeHashString("InvalidKeyId");
+static constexpr int INVALID_TYPE_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidTypeNameException");
+static constexpr int STATUS_UNCHANGED_HASH = HashingUtils::CompileTimeHashString("StatusUnchanged");
+static constexpr int TOO_MANY_UPDATES_HASH = HashingUtils::CompileTimeHashString("TooManyUpdates");
+static constexpr int INVALID_DOCUMENT_SCHEMA_VERSION_HASH = HashingUtils::CompileTimeHashString("InvalidDocumentSchemaVersion");
+static constexpr int DUPLICATE_INSTANCE_ID_HASH = HashingUtils::CompileTimeHashString("DuplicateInstanceId");
+static constexpr int SUB_TYPE_COUNT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("SubTypeCountLimitExceededException");
+static constexpr int INVALID_AUTOMATION_STATUS_UPDATE_HASH = HashingUtils::CompileTimeHashString("InvalidAutomationStatusUpdateException");
+static constexpr int INVALID_DOCUMENT_VERSION_HASH = HashingUtils::CompileTimeHashString("InvalidDocumentVersion");
+static constexpr int INVALID_OUTPUT_FOLDER_HASH = HashingUtils::CompileTimeHashString("InvalidOutputFolder");
+static constexpr int INVALID_RESOURCE_ID_HASH = HashingUtils::CompileTimeHashString("InvalidResourceId");
+static constexpr int ASSOCIATED_INSTANCES_HASH = HashingUtils::CompileTimeHashString("AssociatedInstances");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
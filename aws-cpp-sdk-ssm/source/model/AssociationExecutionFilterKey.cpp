@@ -30,25 +30,37 @@ namespace Aws
       namespace AssociationExecutionFilterKeyMapper
       {
 
-        static const int ExecutionId_HASH = HashingUtils::HashString("ExecutionId");
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int CreatedTime_HASH = HashingUtils::HashString("CreatedTime");
+        static constexpr int ExecutionId_HASH = HashingUtils::CompileTimeHashString("ExecutionId");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
+        static constexpr int CreatedTime_HASH = HashingUtils::CompileTimeHashString("CreatedTime");
 
 
         AssociationExecutionFilterKey GetAssociationExecutionFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ExecutionId_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssociationExecutionFilterKey::ExecutionId;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return AssociationExecutionFilterKey::Status;
-          }
-          else if (hashCode == CreatedTime_HASH)
-          {
-            return AssociationExecutionFilterKey::CreatedTime;
+          case ExecutionId_HASH:
+            if (name == "ExecutionId")
+            {
+              return AssociationExecutionFilterKey::ExecutionId;
+            }
+            break;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return AssociationExecutionFilterKey::Status;
+            }
+            break;
+          case CreatedTime_HASH:
+            if (name == "CreatedTime")
+            {
+              return AssociationExecutionFilterKey::CreatedTime;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AssociationExecutionFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationExecutionFilterKey(AssociationExecutionFilterKey enumValue)
+        const char* GetNameForAssociationExecutionFilterKey(AssociationExecutionFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
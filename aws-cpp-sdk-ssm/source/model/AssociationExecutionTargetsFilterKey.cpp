@@ -30,25 +30,37 @@ namespace Aws
       namespace AssociationExecutionTargetsFilterKeyMapper
       {
 
-        static const int Status_HASH = HashingUtils::HashString("Status");
-        static const int ResourceId_HASH = HashingUtils::HashString("ResourceId");
-        static const int ResourceType_HASH = HashingUtils::HashString("ResourceType");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
+        static constexpr int ResourceId_HASH = HashingUtils::CompileTimeHashString("ResourceId");
+        static constexpr int ResourceType_HASH = HashingUtils::CompileTimeHashString("ResourceType");
 
 
         AssociationExecutionTargetsFilterKey GetAssociationExecutionTargetsFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Status_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssociationExecutionTargetsFilterKey::Status;
-          }
-          else if (hashCode == ResourceId_HASH)
-          {
-            return AssociationExecutionTargetsFilterKey::ResourceId;
-          }
-          else if (hashCode == ResourceType_HASH)
-          {
-            return AssociationExecutionTargetsFilterKey::ResourceType;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return AssociationExecutionTargetsFilterKey::Status;
+            }
+            break;
+          case ResourceId_HASH:
+            if (name == "ResourceId")
+            {
+              return AssociationExecutionTargetsFilterKey::ResourceId;
+            }
+            break;
+          case ResourceType_HASH:
+            if (name == "ResourceType")
+            {
+              return AssociationExecutionTargetsFilterKey::ResourceType;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AssociationExecutionTargetsFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationExecutionTargetsFilterKey(AssociationExecutionTargetsFilterKey enumValue)
+        const char* GetNameForAssociationExecutionTargetsFilterKey(AssociationExecutionTargetsFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace AssociationFilterKeyMapper
       {
 
-        static const int InstanceId_HASH = HashingUtils::HashString("InstanceId");
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int AssociationId_HASH = HashingUtils::HashString("AssociationId");
-        static const int AssociationStatusName_HASH = HashingUtils::HashString("AssociationStatusName");
-        static const int LastExecutedBefore_HASH = HashingUtils::HashString("LastExecutedBefore");
-        static const int LastExecutedAfter_HASH = HashingUtils::HashString("LastExecutedAfter");
-        static const int AssociationName_HASH = HashingUtils::HashString("AssociationName");
+        static constexpr int InstanceId_HASH = HashingUtils::CompileTimeHashString("InstanceId");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int AssociationId_HASH = HashingUtils::CompileTimeHashString("AssociationId");
+        static constexpr int AssociationStatusName_HASH = HashingUtils::CompileTimeHashString("AssociationStatusName");
+        static constexpr int LastExecutedBefore_HASH = HashingUtils::CompileTimeHashString("LastExecutedBefore");
+        static constexpr int LastExecutedAfter_HASH = HashingUtils::CompileTimeHashString("LastExecutedAfter");
+        static constexpr int AssociationName_HASH = HashingUtils::CompileTimeHashString("AssociationName");
 
 
         AssociationFilterKey GetAssociationFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceId_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssociationFilterKey::InstanceId;
-          }
-          else if (hashCode == Name_HASH)
-          {
-            return AssociationFilterKey::Name;
-          }
-          else if (hashCode == AssociationId_HASH)
-          {
-            return AssociationFilterKey::AssociationId;
-          }
-          else if (hashCode == AssociationStatusName_HASH)
-          {
-            return AssociationFilterKey::AssociationStatusName;
-          }
-          else if (hashCode == LastExecutedBefore_HASH)
-          {
-            return AssociationFilterKey::LastExecutedBefore;
-          }
-          else if (hashCode == LastExecutedAfter_HASH)
-          {
-            return AssociationFilterKey::LastExecutedAfter;
-          }
-          else if (hashCode == AssociationName_HASH)
-          {
-            return AssociationFilterKey::AssociationName;
+          case InstanceId_HASH:
+            if (name == "InstanceId")
+            {
+              return AssociationFilterKey::InstanceId;
+            }
+            break;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return AssociationFilterKey::Name;
+            }
+            break;
+          case AssociationId_HASH:
+            if (name == "AssociationId")
+            {
+              return AssociationFilterKey::AssociationId;
+            }
+            break;
+          case AssociationStatusName_HASH:
+            if (name == "AssociationStatusName")
+            {
+              return AssociationFilterKey::AssociationStatusName;
+            }
+            break;
+          case LastExecutedBefore_HASH:
+            if (name == "LastExecutedBefore")
+            {
+              return AssociationFilterKey::LastExecutedBefore;
+            }
+            break;
+          case LastExecutedAfter_HASH:
+            if (name == "LastExecutedAfter")
+            {
+              return AssociationFilterKey::LastExecutedAfter;
+            }
+            break;
+          case AssociationName_HASH:
+            if (name == "AssociationName")
+            {
+              return AssociationFilterKey::AssociationName;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return AssociationFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationFilterKey(AssociationFilterKey enumValue)
+        const char* GetNameForAssociationFilterKey(AssociationFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AssociationFilterOperatorTypeMapper
       {
 
-        static const int EQUAL_HASH = HashingUtils::HashString("EQUAL");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
+        static constexpr int EQUAL_HASH = HashingUtils::CompileTimeHashString("EQUAL");
+        static constexpr int LESS_THAN_HASH = HashingUtils::CompileTimeHashString("LESS_THAN");
+        static constexpr int GREATER_THAN_HASH = HashingUtils::CompileTimeHashString("GREATER_THAN");
 
 
         AssociationFilterOperatorType GetAssociationFilterOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssociationFilterOperatorType::EQUAL;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
-            return AssociationFilterOperatorType::LESS_THAN;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
-            return AssociationFilterOperatorType::GREATER_THAN;
+          case EQUAL_HASH:
+            if (name == "EQUAL")
+            {
+              return AssociationFilterOperatorType::EQUAL;
+            }
+            break;
+          case LESS_THAN_HASH:
+            if (name == "LESS_THAN")
+            {
+              return AssociationFilterOperatorType::LESS_THAN;
+            }
+            break;
+          case GREATER_THAN_HASH:
+            if (name == "GREATER_THAN")
+            {
+              return AssociationFilterOperatorType::GREATER_THAN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AssociationFilterOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationFilterOperatorType(AssociationFilterOperatorType enumValue)
+        const char* GetNameForAssociationFilterOperatorType(AssociationFilterOperatorType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace AssociationStatusNameMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         AssociationStatusName GetAssociationStatusNameForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AssociationStatusName::Pending;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return AssociationStatusName::Success;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return AssociationStatusName::Failed;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return AssociationStatusName::Pending;
+            }
+            break;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return AssociationStatusName::Success;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return AssociationStatusName::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return AssociationStatusName::NOT_SET;
         }
 
-        Aws::String GetNameForAssociationStatusName(AssociationStatusName enumValue)
+        const char* GetNameForAssociationStatusName(AssociationStatusName enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,45 +30,65 @@ namespace Aws
       namespace AutomationExecutionFilterKeyMapper
       {
 
-        static const int DocumentNamePrefix_HASH = HashingUtils::HashString("DocumentNamePrefix");
-        static const int ExecutionStatus_HASH = HashingUtils::HashString("ExecutionStatus");
-        static const int ExecutionId_HASH = HashingUtils::HashString("ExecutionId");
-        static const int ParentExecutionId_HASH = HashingUtils::HashString("ParentExecutionId");
-        static const int CurrentAction_HASH = HashingUtils::HashString("CurrentAction");
-        static const int StartTimeBefore_HASH = HashingUtils::HashString("StartTimeBefore");
-        static const int StartTimeAfter_HASH = HashingUtils::HashString("StartTimeAfter");
+        static constexpr int DocumentNamePrefix_HASH = HashingUtils::CompileTimeHashString("DocumentNamePrefix");
+        static constexpr int ExecutionStatus_HASH = HashingUtils::CompileTimeHashString("ExecutionStatus");
+        static constexpr int ExecutionId_HASH = HashingUtils::CompileTimeHashString("ExecutionId");
+        static constexpr int ParentExecutionId_HASH = HashingUtils::CompileTimeHashString("ParentExecutionId");
+        static constexpr int CurrentAction_HASH = HashingUtils::CompileTimeHashString("CurrentAction");
+        static constexpr int StartTimeBefore_HASH = HashingUtils::CompileTimeHashString("StartTimeBefore");
+        static constexpr int StartTimeAfter_HASH = HashingUtils::CompileTimeHashString("StartTimeAfter");
 
 
         AutomationExecutionFilterKey GetAutomationExecutionFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DocumentNamePrefix_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AutomationExecutionFilterKey::DocumentNamePrefix;
-          }
-          else if (hashCode == ExecutionStatus_HASH)
-          {
-            return AutomationExecutionFilterKey::ExecutionStatus;
-          }
-          else if (hashCode == ExecutionId_HASH)
-          {
-            return AutomationExecutionFilterKey::ExecutionId;
-          }
-          else if (hashCode == ParentExecutionId_HASH)
-          {
-            return AutomationExecutionFilterKey::ParentExecutionId;
-          }
-          else if (hashCode == CurrentAction_HASH)
-          {
-            return AutomationExecutionFilterKey::CurrentAction;
-          }
-          else if (hashCode == StartTimeBefore_HASH)
-          {
-            return AutomationExecutionFilterKey::StartTimeBefore;
-          }
-          else if (hashCode == StartTimeAfter_HASH)
-          {
-            return AutomationExecutionFilterKey::StartTimeAfter;
+          case DocumentNamePrefix_HASH:
+            if (name == "DocumentNamePrefix")
+            {
+              return AutomationExecutionFilterKey::DocumentNamePrefix;
+            }
+            break;
+          case ExecutionStatus_HASH:
+            if (name == "ExecutionStatus")
+            {
+              return AutomationExecutionFilterKey::ExecutionStatus;
+            }
+            break;
+          case ExecutionId_HASH:
+            if (name == "ExecutionId")
+            {
+              return AutomationExecutionFilterKey::ExecutionId;
+            }
+            break;
+          case ParentExecutionId_HASH:
+            if (name == "ParentExecutionId")
+            {
+              return AutomationExecutionFilterKey::ParentExecutionId;
+            }
+            break;
+          case CurrentAction_HASH:
+            if (name == "CurrentAction")
+            {
+              return AutomationExecutionFilterKey::CurrentAction;
+            }
+            break;
+          case StartTimeBefore_HASH:
+            if (name == "StartTimeBefore")
+            {
+              return AutomationExecutionFilterKey::StartTimeBefore;
+            }
+            break;
+          case StartTimeAfter_HASH:
+            if (name == "StartTimeAfter")
+            {
+              return AutomationExecutionFilterKey::StartTimeAfter;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return AutomationExecutionFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForAutomationExecutionFilterKey(AutomationExecutionFilterKey enumValue)
+        const char* GetNameForAutomationExecutionFilterKey(AutomationExecutionFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
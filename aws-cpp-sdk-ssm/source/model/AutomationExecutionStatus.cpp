@@ -30,50 +30,72 @@ namespace Aws
       namespace AutomationExecutionStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Waiting_HASH = HashingUtils::HashString("Waiting");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Cancelling_HASH = HashingUtils::HashString("Cancelling");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Waiting_HASH = HashingUtils::CompileTimeHashString("Waiting");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int TimedOut_HASH = HashingUtils::CompileTimeHashString("TimedOut");
+        static constexpr int Cancelling_HASH = HashingUtils::CompileTimeHashString("Cancelling");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         AutomationExecutionStatus GetAutomationExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return AutomationExecutionStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return AutomationExecutionStatus::InProgress;
-          }
-          else if (hashCode == Waiting_HASH)
-          {
-            return AutomationExecutionStatus::Waiting;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return AutomationExecutionStatus::Success;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return AutomationExecutionStatus::TimedOut;
-          }
-          else if (hashCode == Cancelling_HASH)
-          {
-            return AutomationExecutionStatus::Cancelling;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return AutomationExecutionStatus::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return AutomationExecutionStatus::Failed;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return AutomationExecutionStatus::Pending;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return AutomationExecutionStatus::InProgress;
+            }
+            break;
+          case Waiting_HASH:
+            if (name == "Waiting")
+            {
+              return AutomationExecutionStatus::Waiting;
+            }
+            break;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return AutomationExecutionStatus::Success;
+            }
+            break;
+          case TimedOut_HASH:
+            if (name == "TimedOut")
+            {
+              return AutomationExecutionStatus::TimedOut;
+            }
+            break;
+          case Cancelling_HASH:
+            if (name == "Cancelling")
+            {
+              return AutomationExecutionStatus::Cancelling;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return AutomationExecutionStatus::Cancelled;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return AutomationExecutionStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return AutomationExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForAutomationExecutionStatus(AutomationExecutionStatus enumValue)
+        const char* GetNameForAutomationExecutionStatus(AutomationExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace CommandFilterKeyMapper
       {
 
-        static const int InvokedAfter_HASH = HashingUtils::HashString("InvokedAfter");
-        static const int InvokedBefore_HASH = HashingUtils::HashString("InvokedBefore");
-        static const int Status_HASH = HashingUtils::HashString("Status");
+        static constexpr int InvokedAfter_HASH = HashingUtils::CompileTimeHashString("InvokedAfter");
+        static constexpr int InvokedBefore_HASH = HashingUtils::CompileTimeHashString("InvokedBefore");
+        static constexpr int Status_HASH = HashingUtils::CompileTimeHashString("Status");
 
 
         CommandFilterKey GetCommandFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InvokedAfter_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CommandFilterKey::InvokedAfter;
-          }
-          else if (hashCode == InvokedBefore_HASH)
-          {
-            return CommandFilterKey::InvokedBefore;
-          }
-          else if (hashCode == Status_HASH)
-          {
-            return CommandFilterKey::Status;
+          case InvokedAfter_HASH:
+            if (name == "InvokedAfter")
+            {
+              return CommandFilterKey::InvokedAfter;
+            }
+            break;
+          case InvokedBefore_HASH:
+            if (name == "InvokedBefore")
+            {
+              return CommandFilterKey::InvokedBefore;
+            }
+            break;
+          case Status_HASH:
+            if (name == "Status")
+            {
+              return CommandFilterKey::Status;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return CommandFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForCommandFilterKey(CommandFilterKey enumValue)
+        const char* GetNameForCommandFilterKey(CommandFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,50 +30,72 @@ namespace Aws
       namespace CommandInvocationStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Delayed_HASH = HashingUtils::HashString("Delayed");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int Cancelling_HASH = HashingUtils::HashString("Cancelling");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Delayed_HASH = HashingUtils::CompileTimeHashString("Delayed");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
+        static constexpr int TimedOut_HASH = HashingUtils::CompileTimeHashString("TimedOut");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int Cancelling_HASH = HashingUtils::CompileTimeHashString("Cancelling");
 
 
         CommandInvocationStatus GetCommandInvocationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CommandInvocationStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return CommandInvocationStatus::InProgress;
-          }
-          else if (hashCode == Delayed_HASH)
-          {
-            return CommandInvocationStatus::Delayed;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return CommandInvocationStatus::Success;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return CommandInvocationStatus::Cancelled;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return CommandInvocationStatus::TimedOut;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return CommandInvocationStatus::Failed;
-          }
-          else if (hashCode == Cancelling_HASH)
-          {
-            return CommandInvocationStatus::Cancelling;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return CommandInvocationStatus::Pending;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return CommandInvocationStatus::InProgress;
+            }
+            break;
+          case Delayed_HASH:
+            if (name == "Delayed")
+            {
+              return CommandInvocationStatus::Delayed;
+            }
+            break;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return CommandInvocationStatus::Success;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return CommandInvocationStatus::Cancelled;
+            }
+            break;
+          case TimedOut_HASH:
+            if (name == "TimedOut")
+            {
+              return CommandInvocationStatus::TimedOut;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return CommandInvocationStatus::Failed;
+            }
+            break;
+          case Cancelling_HASH:
+            if (name == "Cancelling")
+            {
+              return CommandInvocationStatus::Cancelling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return CommandInvocationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCommandInvocationStatus(CommandInvocationStatus enumValue)
+        const char* GetNameForCommandInvocationStatus(CommandInvocationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
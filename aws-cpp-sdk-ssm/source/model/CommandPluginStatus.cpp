@@ -30,40 +30,58 @@ namespace Aws
       namespace CommandPluginStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int TimedOut_HASH = HashingUtils::CompileTimeHashString("TimedOut");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         CommandPluginStatus GetCommandPluginStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CommandPluginStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return CommandPluginStatus::InProgress;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return CommandPluginStatus::Success;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return CommandPluginStatus::TimedOut;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return CommandPluginStatus::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return CommandPluginStatus::Failed;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return CommandPluginStatus::Pending;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return CommandPluginStatus::InProgress;
+            }
+            break;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return CommandPluginStatus::Success;
+            }
+            break;
+          case TimedOut_HASH:
+            if (name == "TimedOut")
+            {
+              return CommandPluginStatus::TimedOut;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return CommandPluginStatus::Cancelled;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return CommandPluginStatus::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return CommandPluginStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCommandPluginStatus(CommandPluginStatus enumValue)
+        const char* GetNameForCommandPluginStatus(CommandPluginStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
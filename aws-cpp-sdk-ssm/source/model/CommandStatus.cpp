@@ -30,45 +30,65 @@ namespace Aws
       namespace CommandStatusMapper
       {
 
-        static const int Pending_HASH = HashingUtils::HashString("Pending");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Cancelling_HASH = HashingUtils::HashString("Cancelling");
+        static constexpr int Pending_HASH = HashingUtils::CompileTimeHashString("Pending");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int TimedOut_HASH = HashingUtils::CompileTimeHashString("TimedOut");
+        static constexpr int Cancelling_HASH = HashingUtils::CompileTimeHashString("Cancelling");
 
 
         CommandStatus GetCommandStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Pending_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CommandStatus::Pending;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return CommandStatus::InProgress;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return CommandStatus::Success;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return CommandStatus::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return CommandStatus::Failed;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return CommandStatus::TimedOut;
-          }
-          else if (hashCode == Cancelling_HASH)
-          {
-            return CommandStatus::Cancelling;
+          case Pending_HASH:
+            if (name == "Pending")
+            {
+              return CommandStatus::Pending;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return CommandStatus::InProgress;
+            }
+            break;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return CommandStatus::Success;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return CommandStatus::Cancelled;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return CommandStatus::Failed;
+            }
+            break;
+          case TimedOut_HASH:
+            if (name == "TimedOut")
+            {
+              return CommandStatus::TimedOut;
+            }
+            break;
+          case Cancelling_HASH:
+            if (name == "Cancelling")
+            {
+              return CommandStatus::Cancelling;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return CommandStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCommandStatus(CommandStatus enumValue)
+        const char* GetNameForCommandStatus(CommandStatus enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace ComplianceQueryOperatorTypeMapper
       {
 
-        static const int EQUAL_HASH = HashingUtils::HashString("EQUAL");
-        static const int NOT_EQUAL_HASH = HashingUtils::HashString("NOT_EQUAL");
-        static const int BEGIN_WITH_HASH = HashingUtils::HashString("BEGIN_WITH");
-        static const int LESS_THAN_HASH = HashingUtils::HashString("LESS_THAN");
-        static const int GREATER_THAN_HASH = HashingUtils::HashString("GREATER_THAN");
+        static constexpr int EQUAL_HASH = HashingUtils::CompileTimeHashString("EQUAL");
+        static constexpr int NOT_EQUAL_HASH = HashingUtils::CompileTimeHashString("NOT_EQUAL");
+        static constexpr int BEGIN_WITH_HASH = HashingUtils::CompileTimeHashString("BEGIN_WITH");
+        static constexpr int LESS_THAN_HASH = HashingUtils::CompileTimeHashString("LESS_THAN");
+        static constexpr int GREATER_THAN_HASH = HashingUtils::CompileTimeHashString("GREATER_THAN");
 
 
         ComplianceQueryOperatorType GetComplianceQueryOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQUAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComplianceQueryOperatorType::EQUAL;
-          }
-          else if (hashCode == NOT_EQUAL_HASH)
-          {
-            return ComplianceQueryOperatorType::NOT_EQUAL;
-          }
-          else if (hashCode == BEGIN_WITH_HASH)
-          {
-            return ComplianceQueryOperatorType::BEGIN_WITH;
-          }
-          else if (hashCode == LESS_THAN_HASH)
-          {
-            return ComplianceQueryOperatorType::LESS_THAN;
-          }
-          else if (hashCode == GREATER_THAN_HASH)
-          {
-            return ComplianceQueryOperatorType::GREATER_THAN;
+          case EQUAL_HASH:
+            if (name == "EQUAL")
+            {
+              return ComplianceQueryOperatorType::EQUAL;
+            }
+            break;
+          case NOT_EQUAL_HASH:
+            if (name == "NOT_EQUAL")
+            {
+              return ComplianceQueryOperatorType::NOT_EQUAL;
+            }
+            break;
+          case BEGIN_WITH_HASH:
+            if (name == "BEGIN_WITH")
+            {
+              return ComplianceQueryOperatorType::BEGIN_WITH;
+            }
+            break;
+          case LESS_THAN_HASH:
+            if (name == "LESS_THAN")
+            {
+              return ComplianceQueryOperatorType::LESS_THAN;
+            }
+            break;
+          case GREATER_THAN_HASH:
+            if (name == "GREATER_THAN")
+            {
+              return ComplianceQueryOperatorType::GREATER_THAN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ComplianceQueryOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForComplianceQueryOperatorType(ComplianceQueryOperatorType enumValue)
+        const char* GetNameForComplianceQueryOperatorType(ComplianceQueryOperatorType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace ComplianceSeverityMapper
       {
 
-        static const int CRITICAL_HASH = HashingUtils::HashString("CRITICAL");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int INFORMATIONAL_HASH = HashingUtils::HashString("INFORMATIONAL");
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
+        static constexpr int CRITICAL_HASH = HashingUtils::CompileTimeHashString("CRITICAL");
+        static constexpr int HIGH_HASH = HashingUtils::CompileTimeHashString("HIGH");
+        static constexpr int MEDIUM_HASH = HashingUtils::CompileTimeHashString("MEDIUM");
+        static constexpr int LOW_HASH = HashingUtils::CompileTimeHashString("LOW");
+        static constexpr int INFORMATIONAL_HASH = HashingUtils::CompileTimeHashString("INFORMATIONAL");
+        static constexpr int UNSPECIFIED_HASH = HashingUtils::CompileTimeHashString("UNSPECIFIED");
 
 
         ComplianceSeverity GetComplianceSeverityForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CRITICAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComplianceSeverity::CRITICAL;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return ComplianceSeverity::HIGH;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return ComplianceSeverity::MEDIUM;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return ComplianceSeverity::LOW;
-          }
-          else if (hashCode == INFORMATIONAL_HASH)
-          {
-            return ComplianceSeverity::INFORMATIONAL;
-          }
-          else if (hashCode == UNSPECIFIED_HASH)
-          {
-            return ComplianceSeverity::UNSPECIFIED;
+          case CRITICAL_HASH:
+            if (name == "CRITICAL")
+            {
+              return ComplianceSeverity::CRITICAL;
+            }
+            break;
+          case HIGH_HASH:
+            if (name == "HIGH")
+            {
+              return ComplianceSeverity::HIGH;
+            }
+            break;
+          case MEDIUM_HASH:
+            if (name == "MEDIUM")
+            {
+              return ComplianceSeverity::MEDIUM;
+            }
+            break;
+          case LOW_HASH:
+            if (name == "LOW")
+            {
+              return ComplianceSeverity::LOW;
+            }
+            break;
+          case INFORMATIONAL_HASH:
+            if (name == "INFORMATIONAL")
+            {
+              return ComplianceSeverity::INFORMATIONAL;
+            }
+            break;
+          case UNSPECIFIED_HASH:
+            if (name == "UNSPECIFIED")
+            {
+              return ComplianceSeverity::UNSPECIFIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ComplianceSeverity::NOT_SET;
         }
 
-        Aws::String GetNameForComplianceSeverity(ComplianceSeverity enumValue)
+        const char* GetNameForComplianceSeverity(ComplianceSeverity enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace DescribeActivationsFilterKeysMapper
       {
 
-        static const int ActivationIds_HASH = HashingUtils::HashString("ActivationIds");
-        static const int DefaultInstanceName_HASH = HashingUtils::HashString("DefaultInstanceName");
-        static const int IamRole_HASH = HashingUtils::HashString("IamRole");
+        static constexpr int ActivationIds_HASH = HashingUtils::CompileTimeHashString("ActivationIds");
+        static constexpr int DefaultInstanceName_HASH = HashingUtils::CompileTimeHashString("DefaultInstanceName");
+        static constexpr int IamRole_HASH = HashingUtils::CompileTimeHashString("IamRole");
 
 
         DescribeActivationsFilterKeys GetDescribeActivationsFilterKeysForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivationIds_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DescribeActivationsFilterKeys::ActivationIds;
-          }
-          else if (hashCode == DefaultInstanceName_HASH)
-          {
-            return DescribeActivationsFilterKeys::DefaultInstanceName;
-          }
-          else if (hashCode == IamRole_HASH)
-          {
-            return DescribeActivationsFilterKeys::IamRole;
+          case ActivationIds_HASH:
+            if (name == "ActivationIds")
+            {
+              return DescribeActivationsFilterKeys::ActivationIds;
+            }
+            break;
+          case DefaultInstanceName_HASH:
+            if (name == "DefaultInstanceName")
+            {
+              return DescribeActivationsFilterKeys::DefaultInstanceName;
+            }
+            break;
+          case IamRole_HASH:
+            if (name == "IamRole")
+            {
+              return DescribeActivationsFilterKeys::IamRole;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DescribeActivationsFilterKeys::NOT_SET;
         }
 
-        Aws::String GetNameForDescribeActivationsFilterKeys(DescribeActivationsFilterKeys enumValue)
+        const char* GetNameForDescribeActivationsFilterKeys(DescribeActivationsFilterKeys enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace DocumentFilterKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int Owner_HASH = HashingUtils::HashString("Owner");
-        static const int PlatformTypes_HASH = HashingUtils::HashString("PlatformTypes");
-        static const int DocumentType_HASH = HashingUtils::HashString("DocumentType");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int Owner_HASH = HashingUtils::CompileTimeHashString("Owner");
+        static constexpr int PlatformTypes_HASH = HashingUtils::CompileTimeHashString("PlatformTypes");
+        static constexpr int DocumentType_HASH = HashingUtils::CompileTimeHashString("DocumentType");
 
 
         DocumentFilterKey GetDocumentFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentFilterKey::Name;
-          }
-          else if (hashCode == Owner_HASH)
-          {
-            return DocumentFilterKey::Owner;
-          }
-          else if (hashCode == PlatformTypes_HASH)
-          {
-            return DocumentFilterKey::PlatformTypes;
-          }
-          else if (hashCode == DocumentType_HASH)
-          {
-            return DocumentFilterKey::DocumentType;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return DocumentFilterKey::Name;
+            }
+            break;
+          case Owner_HASH:
+            if (name == "Owner")
+            {
+              return DocumentFilterKey::Owner;
+            }
+            break;
+          case PlatformTypes_HASH:
+            if (name == "PlatformTypes")
+            {
+              return DocumentFilterKey::PlatformTypes;
+            }
+            break;
+          case DocumentType_HASH:
+            if (name == "DocumentType")
+            {
+              return DocumentFilterKey::DocumentType;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DocumentFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentFilterKey(DocumentFilterKey enumValue)
+        const char* GetNameForDocumentFilterKey(DocumentFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DocumentFormatMapper
       {
 
-        static const int YAML_HASH = HashingUtils::HashString("YAML");
-        static const int JSON_HASH = HashingUtils::HashString("JSON");
+        static constexpr int YAML_HASH = HashingUtils::CompileTimeHashString("YAML");
+        static constexpr int JSON_HASH = HashingUtils::CompileTimeHashString("JSON");
 
 
         DocumentFormat GetDocumentFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == YAML_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentFormat::YAML;
-          }
-          else if (hashCode == JSON_HASH)
-          {
-            return DocumentFormat::JSON;
+          case YAML_HASH:
+            if (name == "YAML")
+            {
+              return DocumentFormat::YAML;
+            }
+            break;
+          case JSON_HASH:
+            if (name == "JSON")
+            {
+              return DocumentFormat::JSON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DocumentFormat::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentFormat(DocumentFormat enumValue)
+        const char* GetNameForDocumentFormat(DocumentFormat enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
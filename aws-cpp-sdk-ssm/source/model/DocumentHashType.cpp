@@ -30,20 +30,30 @@ namespace Aws
       namespace DocumentHashTypeMapper
       {
 
-        static const int Sha256_HASH = HashingUtils::HashString("Sha256");
-        static const int Sha1_HASH = HashingUtils::HashString("Sha1");
+        static constexpr int Sha256_HASH = HashingUtils::CompileTimeHashString("Sha256");
+        static constexpr int Sha1_HASH = HashingUtils::CompileTimeHashString("Sha1");
 
 
         DocumentHashType GetDocumentHashTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Sha256_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentHashType::Sha256;
-          }
-          else if (hashCode == Sha1_HASH)
-          {
-            return DocumentHashType::Sha1;
+          case Sha256_HASH:
+            if (name == "Sha256")
+            {
+              return DocumentHashType::Sha256;
+            }
+            break;
+          case Sha1_HASH:
+            if (name == "Sha1")
+            {
+              return DocumentHashType::Sha1;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DocumentHashType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentHashType(DocumentHashType enumValue)
+        const char* GetNameForDocumentHashType(DocumentHashType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DocumentParameterTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int StringList_HASH = HashingUtils::HashString("StringList");
+        static constexpr int String_HASH = HashingUtils::CompileTimeHashString("String");
+        static constexpr int StringList_HASH = HashingUtils::CompileTimeHashString("StringList");
 
 
         DocumentParameterType GetDocumentParameterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentParameterType::String;
-          }
-          else if (hashCode == StringList_HASH)
-          {
-            return DocumentParameterType::StringList;
+          case String_HASH:
+            if (name == "String")
+            {
+              return DocumentParameterType::String;
+            }
+            break;
+          case StringList_HASH:
+            if (name == "StringList")
+            {
+              return DocumentParameterType::StringList;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DocumentParameterType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentParameterType(DocumentParameterType enumValue)
+        const char* GetNameForDocumentParameterType(DocumentParameterType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace DocumentPermissionTypeMapper
       {
 
-        static const int Share_HASH = HashingUtils::HashString("Share");
+        static constexpr int Share_HASH = HashingUtils::CompileTimeHashString("Share");
 
 
         DocumentPermissionType GetDocumentPermissionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Share_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentPermissionType::Share;
+          case Share_HASH:
+            if (name == "Share")
+            {
+              return DocumentPermissionType::Share;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return DocumentPermissionType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentPermissionType(DocumentPermissionType enumValue)
+        const char* GetNameForDocumentPermissionType(DocumentPermissionType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace DocumentStatusMapper
       {
 
-        static const int Creating_HASH = HashingUtils::HashString("Creating");
-        static const int Active_HASH = HashingUtils::HashString("Active");
-        static const int Updating_HASH = HashingUtils::HashString("Updating");
-        static const int Deleting_HASH = HashingUtils::HashString("Deleting");
+        static constexpr int Creating_HASH = HashingUtils::CompileTimeHashString("Creating");
+        static constexpr int Active_HASH = HashingUtils::CompileTimeHashString("Active");
+        static constexpr int Updating_HASH = HashingUtils::CompileTimeHashString("Updating");
+        static constexpr int Deleting_HASH = HashingUtils::CompileTimeHashString("Deleting");
 
 
         DocumentStatus GetDocumentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Creating_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentStatus::Creating;
-          }
-          else if (hashCode == Active_HASH)
-          {
-            return DocumentStatus::Active;
-          }
-          else if (hashCode == Updating_HASH)
-          {
-            return DocumentStatus::Updating;
-          }
-          else if (hashCode == Deleting_HASH)
-          {
-            return DocumentStatus::Deleting;
+          case Creating_HASH:
+            if (name == "Creating")
+            {
+              return DocumentStatus::Creating;
+            }
+            break;
+          case Active_HASH:
+            if (name == "Active")
+            {
+              return DocumentStatus::Active;
+            }
+            break;
+          case Updating_HASH:
+            if (name == "Updating")
+            {
+              return DocumentStatus::Updating;
+            }
+            break;
+          case Deleting_HASH:
+            if (name == "Deleting")
+            {
+              return DocumentStatus::Deleting;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return DocumentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentStatus(DocumentStatus enumValue)
+        const char* GetNameForDocumentStatus(DocumentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace DocumentTypeMapper
       {
 
-        static const int Command_HASH = HashingUtils::HashString("Command");
-        static const int Policy_HASH = HashingUtils::HashString("Policy");
-        static const int Automation_HASH = HashingUtils::HashString("Automation");
+        static constexpr int Command_HASH = HashingUtils::CompileTimeHashString("Command");
+        static constexpr int Policy_HASH = HashingUtils::CompileTimeHashString("Policy");
+        static constexpr int Automation_HASH = HashingUtils::CompileTimeHashString("Automation");
 
 
         DocumentType GetDocumentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Command_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentType::Command;
-          }
-          else if (hashCode == Policy_HASH)
-          {
-            return DocumentType::Policy;
-          }
-          else if (hashCode == Automation_HASH)
-          {
-            return DocumentType::Automation;
+          case Command_HASH:
+            if (name == "Command")
+            {
+              return DocumentType::Command;
+            }
+            break;
+          case Policy_HASH:
+            if (name == "Policy")
+            {
+              return DocumentType::Policy;
+            }
+            break;
+          case Automation_HASH:
+            if (name == "Automation")
+            {
+              return DocumentType::Automation;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DocumentType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentType(DocumentType enumValue)
+        const char* GetNameForDocumentType(DocumentType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
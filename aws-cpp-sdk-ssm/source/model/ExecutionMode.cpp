@@ -30,20 +30,30 @@ namespace Aws
       namespace ExecutionModeMapper
       {
 
-        static const int Auto_HASH = HashingUtils::HashString("Auto");
-        static const int Interactive_HASH = HashingUtils::HashString("Interactive");
+        static constexpr int Auto_HASH = HashingUtils::CompileTimeHashString("Auto");
+        static constexpr int Interactive_HASH = HashingUtils::CompileTimeHashString("Interactive");
 
 
         ExecutionMode GetExecutionModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Auto_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExecutionMode::Auto;
-          }
-          else if (hashCode == Interactive_HASH)
-          {
-            return ExecutionMode::Interactive;
+          case Auto_HASH:
+            if (name == "Auto")
+            {
+              return ExecutionMode::Auto;
+            }
+            break;
+          case Interactive_HASH:
+            if (name == "Interactive")
+            {
+              return ExecutionMode::Interactive;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ExecutionMode::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionMode(ExecutionMode enumValue)
+        const char* GetNameForExecutionMode(ExecutionMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
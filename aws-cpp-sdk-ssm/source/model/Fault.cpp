@@ -30,25 +30,37 @@ namespace Aws
       namespace FaultMapper
       {
 
-        static const int Client_HASH = HashingUtils::HashString("Client");
-        static const int Server_HASH = HashingUtils::HashString("Server");
-        static const int Unknown_HASH = HashingUtils::HashString("Unknown");
+        static constexpr int Client_HASH = HashingUtils::CompileTimeHashString("Client");
+        static constexpr int Server_HASH = HashingUtils::CompileTimeHashString("Server");
+        static constexpr int Unknown_HASH = HashingUtils::CompileTimeHashString("Unknown");
 
 
         Fault GetFaultForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Client_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Fault::Client;
-          }
-          else if (hashCode == Server_HASH)
-          {
-            return Fault::Server;
-          }
-          else if (hashCode == Unknown_HASH)
-          {
-            return Fault::Unknown;
+          case Client_HASH:
+            if (name == "Client")
+            {
+              return Fault::Client;
+            }
+            break;
+          case Server_HASH:
+            if (name == "Server")
+            {
+              return Fault::Server;
+            }
+            break;
+          case Unknown_HASH:
+            if (name == "Unknown")
+            {
+              return Fault::Unknown;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return Fault::NOT_SET;
         }
 
-        Aws::String GetNameForFault(Fault enumValue)
+        const char* GetNameForFault(Fault enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
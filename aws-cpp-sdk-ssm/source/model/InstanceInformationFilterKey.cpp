@@ -30,50 +30,72 @@ namespace Aws
       namespace InstanceInformationFilterKeyMapper
       {
 
-        static const int InstanceIds_HASH = HashingUtils::HashString("InstanceIds");
-        static const int AgentVersion_HASH = HashingUtils::HashString("AgentVersion");
-        static const int PingStatus_HASH = HashingUtils::HashString("PingStatus");
-        static const int PlatformTypes_HASH = HashingUtils::HashString("PlatformTypes");
-        static const int ActivationIds_HASH = HashingUtils::HashString("ActivationIds");
-        static const int IamRole_HASH = HashingUtils::HashString("IamRole");
-        static const int ResourceType_HASH = HashingUtils::HashString("ResourceType");
-        static const int AssociationStatus_HASH = HashingUtils::HashString("AssociationStatus");
+        static constexpr int InstanceIds_HASH = HashingUtils::CompileTimeHashString("InstanceIds");
+        static constexpr int AgentVersion_HASH = HashingUtils::CompileTimeHashString("AgentVersion");
+        static constexpr int PingStatus_HASH = HashingUtils::CompileTimeHashString("PingStatus");
+        static constexpr int PlatformTypes_HASH = HashingUtils::CompileTimeHashString("PlatformTypes");
+        static constexpr int ActivationIds_HASH = HashingUtils::CompileTimeHashString("ActivationIds");
+        static constexpr int IamRole_HASH = HashingUtils::CompileTimeHashString("IamRole");
+        static constexpr int ResourceType_HASH = HashingUtils::CompileTimeHashString("ResourceType");
+        static constexpr int AssociationStatus_HASH = HashingUtils::CompileTimeHashString("AssociationStatus");
 
 
         InstanceInformationFilterKey GetInstanceInformationFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InstanceIds_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstanceInformationFilterKey::InstanceIds;
-          }
-          else if (hashCode == AgentVersion_HASH)
-          {
-            return InstanceInformationFilterKey::AgentVersion;
-          }
-          else if (hashCode == PingStatus_HASH)
-          {
-            return InstanceInformationFilterKey::PingStatus;
-          }
-          else if (hashCode == PlatformTypes_HASH)
-          {
-            return InstanceInformationFilterKey::PlatformTypes;
-          }
-          else if (hashCode == ActivationIds_HASH)
-          {
-            return InstanceInformationFilterKey::ActivationIds;
-          }
-          else if (hashCode == IamRole_HASH)
-          {
-            return InstanceInformationFilterKey::IamRole;
-          }
-          else if (hashCode == ResourceType_HASH)
-          {
-            return InstanceInformationFilterKey::ResourceType;
-          }
-          else if (hashCode == AssociationStatus_HASH)
-          {
-            return InstanceInformationFilterKey::AssociationStatus;
+          case InstanceIds_HASH:
+            if (name == "InstanceIds")
+            {
+              return InstanceInformationFilterKey::InstanceIds;
+            }
+            break;
+          case AgentVersion_HASH:
+            if (name == "AgentVersion")
+            {
+              return InstanceInformationFilterKey::AgentVersion;
+            }
+            break;
+          case PingStatus_HASH:
+            if (name == "PingStatus")
+            {
+              return InstanceInformationFilterKey::PingStatus;
+            }
+            break;
+          case PlatformTypes_HASH:
+            if (name == "PlatformTypes")
+            {
+              return InstanceInformationFilterKey::PlatformTypes;
+            }
+            break;
+          case ActivationIds_HASH:
+            if (name == "ActivationIds")
+            {
+              return InstanceInformationFilterKey::ActivationIds;
+            }
+            break;
+          case IamRole_HASH:
+            if (name == "IamRole")
+            {
+              return InstanceInformationFilterKey::IamRole;
+            }
+            break;
+          case ResourceType_HASH:
+            if (name == "ResourceType")
+            {
+              return InstanceInformationFilterKey::ResourceType;
+            }
+            break;
+          case AssociationStatus_HASH:
+            if (name == "AssociationStatus")
+            {
+              return InstanceInformationFilterKey::AssociationStatus;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return InstanceInformationFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForInstanceInformationFilterKey(InstanceInformationFilterKey enumValue)
+        const char* GetNameForInstanceInformationFilterKey(InstanceInformationFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace InstancePatchStateOperatorTypeMapper
       {
 
-        static const int Equal_HASH = HashingUtils::HashString("Equal");
-        static const int NotEqual_HASH = HashingUtils::HashString("NotEqual");
-        static const int LessThan_HASH = HashingUtils::HashString("LessThan");
-        static const int GreaterThan_HASH = HashingUtils::HashString("GreaterThan");
+        static constexpr int Equal_HASH = HashingUtils::CompileTimeHashString("Equal");
+        static constexpr int NotEqual_HASH = HashingUtils::CompileTimeHashString("NotEqual");
+        static constexpr int LessThan_HASH = HashingUtils::CompileTimeHashString("LessThan");
+        static constexpr int GreaterThan_HASH = HashingUtils::CompileTimeHashString("GreaterThan");
 
 
         InstancePatchStateOperatorType GetInstancePatchStateOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Equal_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InstancePatchStateOperatorType::Equal;
-          }
-          else if (hashCode == NotEqual_HASH)
-          {
-            return InstancePatchStateOperatorType::NotEqual;
-          }
-          else if (hashCode == LessThan_HASH)
-          {
-            return InstancePatchStateOperatorType::LessThan;
-          }
-          else if (hashCode == GreaterThan_HASH)
-          {
-            return InstancePatchStateOperatorType::GreaterThan;
+          case Equal_HASH:
+            if (name == "Equal")
+            {
+              return InstancePatchStateOperatorType::Equal;
+            }
+            break;
+          case NotEqual_HASH:
+            if (name == "NotEqual")
+            {
+              return InstancePatchStateOperatorType::NotEqual;
+            }
+            break;
+          case LessThan_HASH:
+            if (name == "LessThan")
+            {
+              return InstancePatchStateOperatorType::LessThan;
+            }
+            break;
+          case GreaterThan_HASH:
+            if (name == "GreaterThan")
+            {
+              return InstancePatchStateOperatorType::GreaterThan;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return InstancePatchStateOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForInstancePatchStateOperatorType(InstancePatchStateOperatorType enumValue)
+        const char* GetNameForInstancePatchStateOperatorType(InstancePatchStateOperatorType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
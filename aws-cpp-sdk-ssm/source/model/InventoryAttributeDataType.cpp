@@ -30,20 +30,30 @@ namespace Aws
       namespace InventoryAttributeDataTypeMapper
       {
 
-        static const int string_HASH = HashingUtils::HashString("string");
-        static const int number_HASH = HashingUtils::HashString("number");
+        static constexpr int string_HASH = HashingUtils::CompileTimeHashString("string");
+        static constexpr int number_HASH = HashingUtils::CompileTimeHashString("number");
 
 
         InventoryAttributeDataType GetInventoryAttributeDataTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == string_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InventoryAttributeDataType::string;
-          }
-          else if (hashCode == number_HASH)
-          {
-            return InventoryAttributeDataType::number;
+          case string_HASH:
+            if (name == "string")
+            {
+              return InventoryAttributeDataType::string;
+            }
+            break;
+          case number_HASH:
+            if (name == "number")
+            {
+              return InventoryAttributeDataType::number;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InventoryAttributeDataType::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryAttributeDataType(InventoryAttributeDataType enumValue)
+        const char* GetNameForInventoryAttributeDataType(InventoryAttributeDataType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
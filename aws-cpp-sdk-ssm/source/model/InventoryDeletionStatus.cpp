@@ -30,20 +30,30 @@ namespace Aws
       namespace InventoryDeletionStatusMapper
       {
 
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Complete_HASH = HashingUtils::CompileTimeHashString("Complete");
 
 
         InventoryDeletionStatus GetInventoryDeletionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == InProgress_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InventoryDeletionStatus::InProgress;
-          }
-          else if (hashCode == Complete_HASH)
-          {
-            return InventoryDeletionStatus::Complete;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return InventoryDeletionStatus::InProgress;
+            }
+            break;
+          case Complete_HASH:
+            if (name == "Complete")
+            {
+              return InventoryDeletionStatus::Complete;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InventoryDeletionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryDeletionStatus(InventoryDeletionStatus enumValue)
+        const char* GetNameForInventoryDeletionStatus(InventoryDeletionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace InventoryQueryOperatorTypeMapper
       {
 
-        static const int Equal_HASH = HashingUtils::HashString("Equal");
-        static const int NotEqual_HASH = HashingUtils::HashString("NotEqual");
-        static const int BeginWith_HASH = HashingUtils::HashString("BeginWith");
-        static const int LessThan_HASH = HashingUtils::HashString("LessThan");
-        static const int GreaterThan_HASH = HashingUtils::HashString("GreaterThan");
+        static constexpr int Equal_HASH = HashingUtils::CompileTimeHashString("Equal");
+        static constexpr int NotEqual_HASH = HashingUtils::CompileTimeHashString("NotEqual");
+        static constexpr int BeginWith_HASH = HashingUtils::CompileTimeHashString("BeginWith");
+        static constexpr int LessThan_HASH = HashingUtils::CompileTimeHashString("LessThan");
+        static constexpr int GreaterThan_HASH = HashingUtils::CompileTimeHashString("GreaterThan");
 
 
         InventoryQueryOperatorType GetInventoryQueryOperatorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Equal_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InventoryQueryOperatorType::Equal;
-          }
-          else if (hashCode == NotEqual_HASH)
-          {
-            return InventoryQueryOperatorType::NotEqual;
-          }
-          else if (hashCode == BeginWith_HASH)
-          {
-            return InventoryQueryOperatorType::BeginWith;
-          }
-          else if (hashCode == LessThan_HASH)
-          {
-            return InventoryQueryOperatorType::LessThan;
-          }
-          else if (hashCode == GreaterThan_HASH)
-          {
-            return InventoryQueryOperatorType::GreaterThan;
+          case Equal_HASH:
+            if (name == "Equal")
+            {
+              return InventoryQueryOperatorType::Equal;
+            }
+            break;
+          case NotEqual_HASH:
+            if (name == "NotEqual")
+            {
+              return InventoryQueryOperatorType::NotEqual;
+            }
+            break;
+          case BeginWith_HASH:
+            if (name == "BeginWith")
+            {
+              return InventoryQueryOperatorType::BeginWith;
+            }
+            break;
+          case LessThan_HASH:
+            if (name == "LessThan")
+            {
+              return InventoryQueryOperatorType::LessThan;
+            }
+            break;
+          case GreaterThan_HASH:
+            if (name == "GreaterThan")
+            {
+              return InventoryQueryOperatorType::GreaterThan;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return InventoryQueryOperatorType::NOT_SET;
         }
 
-        Aws::String GetNameForInventoryQueryOperatorType(InventoryQueryOperatorType enumValue)
+        const char* GetNameForInventoryQueryOperatorType(InventoryQueryOperatorType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace InventorySchemaDeleteOptionMapper
       {
 
-        static const int DisableSchema_HASH = HashingUtils::HashString("DisableSchema");
-        static const int DeleteSchema_HASH = HashingUtils::HashString("DeleteSchema");
+        static constexpr int DisableSchema_HASH = HashingUtils::CompileTimeHashString("DisableSchema");
+        static constexpr int DeleteSchema_HASH = HashingUtils::CompileTimeHashString("DeleteSchema");
 
 
         InventorySchemaDeleteOption GetInventorySchemaDeleteOptionForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DisableSchema_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return InventorySchemaDeleteOption::DisableSchema;
-          }
-          else if (hashCode == DeleteSchema_HASH)
-          {
-            return InventorySchemaDeleteOption::DeleteSchema;
+          case DisableSchema_HASH:
+            if (name == "DisableSchema")
+            {
+              return InventorySchemaDeleteOption::DisableSchema;
+            }
+            break;
+          case DeleteSchema_HASH:
+            if (name == "DeleteSchema")
+            {
+              return InventorySchemaDeleteOption::DeleteSchema;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return InventorySchemaDeleteOption::NOT_SET;
         }
 
-        Aws::String GetNameForInventorySchemaDeleteOption(InventorySchemaDeleteOption enumValue)
+        const char* GetNameForInventorySchemaDeleteOption(InventorySchemaDeleteOption enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace LastResourceDataSyncStatusMapper
       {
 
-        static const int Successful_HASH = HashingUtils::HashString("Successful");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
+        static constexpr int Successful_HASH = HashingUtils::CompileTimeHashString("Successful");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
 
 
         LastResourceDataSyncStatus GetLastResourceDataSyncStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Successful_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LastResourceDataSyncStatus::Successful;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return LastResourceDataSyncStatus::Failed;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return LastResourceDataSyncStatus::InProgress;
+          case Successful_HASH:
+            if (name == "Successful")
+            {
+              return LastResourceDataSyncStatus::Successful;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return LastResourceDataSyncStatus::Failed;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return LastResourceDataSyncStatus::InProgress;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return LastResourceDataSyncStatus::NOT_SET;
         }
 
-        Aws::String GetNameForLastResourceDataSyncStatus(LastResourceDataSyncStatus enumValue)
+        const char* GetNameForLastResourceDataSyncStatus(LastResourceDataSyncStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
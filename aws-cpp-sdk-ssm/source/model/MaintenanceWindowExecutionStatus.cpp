@@ -30,50 +30,72 @@ namespace Aws
       namespace MaintenanceWindowExecutionStatusMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int IN_PROGRESS_HASH = HashingUtils::HashString("IN_PROGRESS");
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-        static const int CANCELLING_HASH = HashingUtils::HashString("CANCELLING");
-        static const int CANCELLED_HASH = HashingUtils::HashString("CANCELLED");
-        static const int SKIPPED_OVERLAPPING_HASH = HashingUtils::HashString("SKIPPED_OVERLAPPING");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("IN_PROGRESS");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("TIMED_OUT");
+        static constexpr int CANCELLING_HASH = HashingUtils::CompileTimeHashString("CANCELLING");
+        static constexpr int CANCELLED_HASH = HashingUtils::CompileTimeHashString("CANCELLED");
+        static constexpr int SKIPPED_OVERLAPPING_HASH = HashingUtils::CompileTimeHashString("SKIPPED_OVERLAPPING");
 
 
         MaintenanceWindowExecutionStatus GetMaintenanceWindowExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MaintenanceWindowExecutionStatus::PENDING;
-          }
-          else if (hashCode == IN_PROGRESS_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::IN_PROGRESS;
-          }
-          else if (hashCode == SUCCESS_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::SUCCESS;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::FAILED;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::TIMED_OUT;
-          }
-          else if (hashCode == CANCELLING_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::CANCELLING;
-          }
-          else if (hashCode == CANCELLED_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::CANCELLED;
-          }
-          else if (hashCode == SKIPPED_OVERLAPPING_HASH)
-          {
-            return MaintenanceWindowExecutionStatus::SKIPPED_OVERLAPPING;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return MaintenanceWindowExecutionStatus::PENDING;
+            }
+            break;
+          case IN_PROGRESS_HASH:
+            if (name == "IN_PROGRESS")
+            {
+              return MaintenanceWindowExecutionStatus::IN_PROGRESS;
+            }
+            break;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return MaintenanceWindowExecutionStatus::SUCCESS;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return MaintenanceWindowExecutionStatus::FAILED;
+            }
+            break;
+          case TIMED_OUT_HASH:
+            if (name == "TIMED_OUT")
+            {
+              return MaintenanceWindowExecutionStatus::TIMED_OUT;
+            }
+            break;
+          case CANCELLING_HASH:
+            if (name == "CANCELLING")
+            {
+              return MaintenanceWindowExecutionStatus::CANCELLING;
+            }
+            break;
+          case CANCELLED_HASH:
+            if (name == "CANCELLED")
+            {
+              return MaintenanceWindowExecutionStatus::CANCELLED;
+            }
+            break;
+          case SKIPPED_OVERLAPPING_HASH:
+            if (name == "SKIPPED_OVERLAPPING")
+            {
+              return MaintenanceWindowExecutionStatus::SKIPPED_OVERLAPPING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -85,7 +107,7 @@ namespace Aws
           return MaintenanceWindowExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForMaintenanceWindowExecutionStatus(MaintenanceWindowExecutionStatus enumValue)
+        const char* GetNameForMaintenanceWindowExecutionStatus(MaintenanceWindowExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -109,7 +131,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
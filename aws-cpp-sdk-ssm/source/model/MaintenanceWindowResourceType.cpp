@@ -30,15 +30,23 @@ namespace Aws
       namespace MaintenanceWindowResourceTypeMapper
       {
 
-        static const int INSTANCE_HASH = HashingUtils::HashString("INSTANCE");
+        static constexpr int INSTANCE_HASH = HashingUtils::CompileTimeHashString("INSTANCE");
 
 
         MaintenanceWindowResourceType GetMaintenanceWindowResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTANCE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MaintenanceWindowResourceType::INSTANCE;
+          case INSTANCE_HASH:
+            if (name == "INSTANCE")
+            {
+              return MaintenanceWindowResourceType::INSTANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return MaintenanceWindowResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForMaintenanceWindowResourceType(MaintenanceWindowResourceType enumValue)
+        const char* GetNameForMaintenanceWindowResourceType(MaintenanceWindowResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
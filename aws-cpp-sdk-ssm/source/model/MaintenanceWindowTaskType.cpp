@@ -30,30 +30,44 @@ namespace Aws
       namespace MaintenanceWindowTaskTypeMapper
       {
 
-        static const int RUN_COMMAND_HASH = HashingUtils::HashString("RUN_COMMAND");
-        static const int AUTOMATION_HASH = HashingUtils::HashString("AUTOMATION");
-        static const int STEP_FUNCTIONS_HASH = HashingUtils::HashString("STEP_FUNCTIONS");
-        static const int LAMBDA_HASH = HashingUtils::HashString("LAMBDA");
+        static constexpr int RUN_COMMAND_HASH = HashingUtils::CompileTimeHashString("RUN_COMMAND");
+        static constexpr int AUTOMATION_HASH = HashingUtils::CompileTimeHashString("AUTOMATION");
+        static constexpr int STEP_FUNCTIONS_HASH = HashingUtils::CompileTimeHashString("STEP_FUNCTIONS");
+        static constexpr int LAMBDA_HASH = HashingUtils::CompileTimeHashString("LAMBDA");
 
 
         MaintenanceWindowTaskType GetMaintenanceWindowTaskTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUN_COMMAND_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MaintenanceWindowTaskType::RUN_COMMAND;
-          }
-          else if (hashCode == AUTOMATION_HASH)
-          {
-            return MaintenanceWindowTaskType::AUTOMATION;
-          }
-          else if (hashCode == STEP_FUNCTIONS_HASH)
-          {
-            return MaintenanceWindowTaskType::STEP_FUNCTIONS;
-          }
-          else if (hashCode == LAMBDA_HASH)
-          {
-            return MaintenanceWindowTaskType::LAMBDA;
+          case RUN_COMMAND_HASH:
+            if (name == "RUN_COMMAND")
+            {
+              return MaintenanceWindowTaskType::RUN_COMMAND;
+            }
+            break;
+          case AUTOMATION_HASH:
+            if (name == "AUTOMATION")
+            {
+              return MaintenanceWindowTaskType::AUTOMATION;
+            }
+            break;
+          case STEP_FUNCTIONS_HASH:
+            if (name == "STEP_FUNCTIONS")
+            {
+              return MaintenanceWindowTaskType::STEP_FUNCTIONS;
+            }
+            break;
+          case LAMBDA_HASH:
+            if (name == "LAMBDA")
+            {
+              return MaintenanceWindowTaskType::LAMBDA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return MaintenanceWindowTaskType::NOT_SET;
         }
 
-        Aws::String GetNameForMaintenanceWindowTaskType(MaintenanceWindowTaskType enumValue)
+        const char* GetNameForMaintenanceWindowTaskType(MaintenanceWindowTaskType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
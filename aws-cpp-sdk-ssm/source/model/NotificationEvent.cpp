@@ -30,40 +30,58 @@ namespace Aws
       namespace NotificationEventMapper
       {
 
-        static const int All_HASH = HashingUtils::HashString("All");
-        static const int InProgress_HASH = HashingUtils::HashString("InProgress");
-        static const int Success_HASH = HashingUtils::HashString("Success");
-        static const int TimedOut_HASH = HashingUtils::HashString("TimedOut");
-        static const int Cancelled_HASH = HashingUtils::HashString("Cancelled");
-        static const int Failed_HASH = HashingUtils::HashString("Failed");
+        static constexpr int All_HASH = HashingUtils::CompileTimeHashString("All");
+        static constexpr int InProgress_HASH = HashingUtils::CompileTimeHashString("InProgress");
+        static constexpr int Success_HASH = HashingUtils::CompileTimeHashString("Success");
+        static constexpr int TimedOut_HASH = HashingUtils::CompileTimeHashString("TimedOut");
+        static constexpr int Cancelled_HASH = HashingUtils::CompileTimeHashString("Cancelled");
+        static constexpr int Failed_HASH = HashingUtils::CompileTimeHashString("Failed");
 
 
         NotificationEvent GetNotificationEventForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == All_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotificationEvent::All;
-          }
-          else if (hashCode == InProgress_HASH)
-          {
-            return NotificationEvent::InProgress;
-          }
-          else if (hashCode == Success_HASH)
-          {
-            return NotificationEvent::Success;
-          }
-          else if (hashCode == TimedOut_HASH)
-          {
-            return NotificationEvent::TimedOut;
-          }
-          else if (hashCode == Cancelled_HASH)
-          {
-            return NotificationEvent::Cancelled;
-          }
-          else if (hashCode == Failed_HASH)
-          {
-            return NotificationEvent::Failed;
+          case All_HASH:
+            if (name == "All")
+            {
+              return NotificationEvent::All;
+            }
+            break;
+          case InProgress_HASH:
+            if (name == "InProgress")
+            {
+              return NotificationEvent::InProgress;
+            }
+            break;
+          case Success_HASH:
+            if (name == "Success")
+            {
+              return NotificationEvent::Success;
+            }
+            break;
+          case TimedOut_HASH:
+            if (name == "TimedOut")
+            {
+              return NotificationEvent::TimedOut;
+            }
+            break;
+          case Cancelled_HASH:
+            if (name == "Cancelled")
+            {
+              return NotificationEvent::Cancelled;
+            }
+            break;
+          case Failed_HASH:
+            if (name == "Failed")
+            {
+              return NotificationEvent::Failed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return NotificationEvent::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationEvent(NotificationEvent enumValue)
+        const char* GetNameForNotificationEvent(NotificationEvent enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace NotificationTypeMapper
       {
 
-        static const int Command_HASH = HashingUtils::HashString("Command");
-        static const int Invocation_HASH = HashingUtils::HashString("Invocation");
+        static constexpr int Command_HASH = HashingUtils::CompileTimeHashString("Command");
+        static constexpr int Invocation_HASH = HashingUtils::CompileTimeHashString("Invocation");
 
 
         NotificationType GetNotificationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Command_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return NotificationType::Command;
-          }
-          else if (hashCode == Invocation_HASH)
-          {
-            return NotificationType::Invocation;
+          case Command_HASH:
+            if (name == "Command")
+            {
+              return NotificationType::Command;
+            }
+            break;
+          case Invocation_HASH:
+            if (name == "Invocation")
+            {
+              return NotificationType::Invocation;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return NotificationType::NOT_SET;
         }
 
-        Aws::String GetNameForNotificationType(NotificationType enumValue)
+        const char* GetNameForNotificationType(NotificationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
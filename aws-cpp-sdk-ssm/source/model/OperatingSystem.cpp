@@ -30,45 +30,65 @@ namespace Aws
       namespace OperatingSystemMapper
       {
 
-        static const int WINDOWS_HASH = HashingUtils::HashString("WINDOWS");
-        static const int AMAZON_LINUX_HASH = HashingUtils::HashString("AMAZON_LINUX");
-        static const int AMAZON_LINUX_2_HASH = HashingUtils::HashString("AMAZON_LINUX_2");
-        static const int UBUNTU_HASH = HashingUtils::HashString("UBUNTU");
-        static const int REDHAT_ENTERPRISE_LINUX_HASH = HashingUtils::HashString("REDHAT_ENTERPRISE_LINUX");
-        static const int SUSE_HASH = HashingUtils::HashString("SUSE");
-        static const int CENTOS_HASH = HashingUtils::HashString("CENTOS");
+        static constexpr int WINDOWS_HASH = HashingUtils::CompileTimeHashString("WINDOWS");
+        static constexpr int AMAZON_LINUX_HASH = HashingUtils::CompileTimeHashString("AMAZON_LINUX");
+        static constexpr int AMAZON_LINUX_2_HASH = HashingUtils::CompileTimeHashString("AMAZON_LINUX_2");
+        static constexpr int UBUNTU_HASH = HashingUtils::CompileTimeHashString("UBUNTU");
+        static constexpr int REDHAT_ENTERPRISE_LINUX_HASH = HashingUtils::CompileTimeHashString("REDHAT_ENTERPRISE_LINUX");
+        static constexpr int SUSE_HASH = HashingUtils::CompileTimeHashString("SUSE");
+        static constexpr int CENTOS_HASH = HashingUtils::CompileTimeHashString("CENTOS");
 
 
         OperatingSystem GetOperatingSystemForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WINDOWS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OperatingSystem::WINDOWS;
-          }
-          else if (hashCode == AMAZON_LINUX_HASH)
-          {
-            return OperatingSystem::AMAZON_LINUX;
-          }
-          else if (hashCode == AMAZON_LINUX_2_HASH)
-          {
-            return OperatingSystem::AMAZON_LINUX_2;
-          }
-          else if (hashCode == UBUNTU_HASH)
-          {
-            return OperatingSystem::UBUNTU;
-          }
-          else if (hashCode == REDHAT_ENTERPRISE_LINUX_HASH)
-          {
-            return OperatingSystem::REDHAT_ENTERPRISE_LINUX;
-          }
-          else if (hashCode == SUSE_HASH)
-          {
-            return OperatingSystem::SUSE;
-          }
-          else if (hashCode == CENTOS_HASH)
-          {
-            return OperatingSystem::CENTOS;
+          case WINDOWS_HASH:
+            if (name == "WINDOWS")
+            {
+              return OperatingSystem::WINDOWS;
+            }
+            break;
+          case AMAZON_LINUX_HASH:
+            if (name == "AMAZON_LINUX")
+            {
+              return OperatingSystem::AMAZON_LINUX;
+            }
+            break;
+          case AMAZON_LINUX_2_HASH:
+            if (name == "AMAZON_LINUX_2")
+            {
+              return OperatingSystem::AMAZON_LINUX_2;
+            }
+            break;
+          case UBUNTU_HASH:
+            if (name == "UBUNTU")
+            {
+              return OperatingSystem::UBUNTU;
+            }
+            break;
+          case REDHAT_ENTERPRISE_LINUX_HASH:
+            if (name == "REDHAT_ENTERPRISE_LINUX")
+            {
+              return OperatingSystem::REDHAT_ENTERPRISE_LINUX;
+            }
+            break;
+          case SUSE_HASH:
+            if (name == "SUSE")
+            {
+              return OperatingSystem::SUSE;
+            }
+            break;
+          case CENTOS_HASH:
+            if (name == "CENTOS")
+            {
+              return OperatingSystem::CENTOS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return OperatingSystem::NOT_SET;
         }
 
-        Aws::String GetNameForOperatingSystem(OperatingSystem enumValue)
+        const char* GetNameForOperatingSystem(OperatingSystem enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
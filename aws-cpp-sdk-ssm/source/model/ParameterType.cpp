@@ -30,25 +30,37 @@ namespace Aws
       namespace ParameterTypeMapper
       {
 
-        static const int String_HASH = HashingUtils::HashString("String");
-        static const int StringList_HASH = HashingUtils::HashString("StringList");
-        static const int SecureString_HASH = HashingUtils::HashString("SecureString");
+        static constexpr int String_HASH = HashingUtils::CompileTimeHashString("String");
+        static constexpr int StringList_HASH = HashingUtils::CompileTimeHashString("StringList");
+        static constexpr int SecureString_HASH = HashingUtils::CompileTimeHashString("SecureString");
 
 
         ParameterType GetParameterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == String_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ParameterType::String;
-          }
-          else if (hashCode == StringList_HASH)
-          {
-            return ParameterType::StringList;
-          }
-          else if (hashCode == SecureString_HASH)
-          {
-            return ParameterType::SecureString;
+          case String_HASH:
+            if (name == "String")
+            {
+              return ParameterType::String;
+            }
+            break;
+          case StringList_HASH:
+            if (name == "StringList")
+            {
+              return ParameterType::StringList;
+            }
+            break;
+          case SecureString_HASH:
+            if (name == "SecureString")
+            {
+              return ParameterType::SecureString;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ParameterType::NOT_SET;
         }
 
-        Aws::String GetNameForParameterType(ParameterType enumValue)
+        const char* GetNameForParameterType(ParameterType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ParametersFilterKeyMapper
       {
 
-        static const int Name_HASH = HashingUtils::HashString("Name");
-        static const int Type_HASH = HashingUtils::HashString("Type");
-        static const int KeyId_HASH = HashingUtils::HashString("KeyId");
+        static constexpr int Name_HASH = HashingUtils::CompileTimeHashString("Name");
+        static constexpr int Type_HASH = HashingUtils::CompileTimeHashString("Type");
+        static constexpr int KeyId_HASH = HashingUtils::CompileTimeHashString("KeyId");
 
 
         ParametersFilterKey GetParametersFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Name_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ParametersFilterKey::Name;
-          }
-          else if (hashCode == Type_HASH)
-          {
-            return ParametersFilterKey::Type;
-          }
-          else if (hashCode == KeyId_HASH)
-          {
-            return ParametersFilterKey::KeyId;
+          case Name_HASH:
+            if (name == "Name")
+            {
+              return ParametersFilterKey::Name;
+            }
+            break;
+          case Type_HASH:
+            if (name == "Type")
+            {
+              return ParametersFilterKey::Type;
+            }
+            break;
+          case KeyId_HASH:
+            if (name == "KeyId")
+            {
+              return ParametersFilterKey::KeyId;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ParametersFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForParametersFilterKey(ParametersFilterKey enumValue)
+        const char* GetNameForParametersFilterKey(ParametersFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace PatchComplianceDataStateMapper
       {
 
-        static const int INSTALLED_HASH = HashingUtils::HashString("INSTALLED");
-        static const int INSTALLED_OTHER_HASH = HashingUtils::HashString("INSTALLED_OTHER");
-        static const int MISSING_HASH = HashingUtils::HashString("MISSING");
-        static const int NOT_APPLICABLE_HASH = HashingUtils::HashString("NOT_APPLICABLE");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int INSTALLED_HASH = HashingUtils::CompileTimeHashString("INSTALLED");
+        static constexpr int INSTALLED_OTHER_HASH = HashingUtils::CompileTimeHashString("INSTALLED_OTHER");
+        static constexpr int MISSING_HASH = HashingUtils::CompileTimeHashString("MISSING");
+        static constexpr int NOT_APPLICABLE_HASH = HashingUtils::CompileTimeHashString("NOT_APPLICABLE");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         PatchComplianceDataState GetPatchComplianceDataStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INSTALLED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PatchComplianceDataState::INSTALLED;
-          }
-          else if (hashCode == INSTALLED_OTHER_HASH)
-          {
-            return PatchComplianceDataState::INSTALLED_OTHER;
-          }
-          else if (hashCode == MISSING_HASH)
-          {
-            return PatchComplianceDataState::MISSING;
-          }
-          else if (hashCode == NOT_APPLICABLE_HASH)
-          {
-            return PatchComplianceDataState::NOT_APPLICABLE;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return PatchComplianceDataState::FAILED;
+          case INSTALLED_HASH:
+            if (name == "INSTALLED")
+            {
+              return PatchComplianceDataState::INSTALLED;
+            }
+            break;
+          case INSTALLED_OTHER_HASH:
+            if (name == "INSTALLED_OTHER")
+            {
+              return PatchComplianceDataState::INSTALLED_OTHER;
+            }
+            break;
+          case MISSING_HASH:
+            if (name == "MISSING")
+            {
+              return PatchComplianceDataState::MISSING;
+            }
+            break;
+          case NOT_APPLICABLE_HASH:
+            if (name == "NOT_APPLICABLE")
+            {
+              return PatchComplianceDataState::NOT_APPLICABLE;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return PatchComplianceDataState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return PatchComplianceDataState::NOT_SET;
         }
 
-        Aws::String GetNameForPatchComplianceDataState(PatchComplianceDataState enumValue)
+        const char* GetNameForPatchComplianceDataState(PatchComplianceDataState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
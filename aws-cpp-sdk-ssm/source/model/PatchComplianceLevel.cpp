@@ -30,40 +30,58 @@ namespace Aws
       namespace PatchComplianceLevelMapper
       {
 
-        static const int CRITICAL_HASH = HashingUtils::HashString("CRITICAL");
-        static const int HIGH_HASH = HashingUtils::HashString("HIGH");
-        static const int MEDIUM_HASH = HashingUtils::HashString("MEDIUM");
-        static const int LOW_HASH = HashingUtils::HashString("LOW");
-        static const int INFORMATIONAL_HASH = HashingUtils::HashString("INFORMATIONAL");
-        static const int UNSPECIFIED_HASH = HashingUtils::HashString("UNSPECIFIED");
+        static constexpr int CRITICAL_HASH = HashingUtils::CompileTimeHashString("CRITICAL");
+        static constexpr int HIGH_HASH = HashingUtils::CompileTimeHashString("HIGH");
+        static constexpr int MEDIUM_HASH = HashingUtils::CompileTimeHashString("MEDIUM");
+        static constexpr int LOW_HASH = HashingUtils::CompileTimeHashString("LOW");
+        static constexpr int INFORMATIONAL_HASH = HashingUtils::CompileTimeHashString("INFORMATIONAL");
+        static constexpr int UNSPECIFIED_HASH = HashingUtils::CompileTimeHashString("UNSPECIFIED");
 
 
         PatchComplianceLevel GetPatchComplianceLevelForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CRITICAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PatchComplianceLevel::CRITICAL;
-          }
-          else if (hashCode == HIGH_HASH)
-          {
-            return PatchComplianceLevel::HIGH;
-          }
-          else if (hashCode == MEDIUM_HASH)
-          {
-            return PatchComplianceLevel::MEDIUM;
-          }
-          else if (hashCode == LOW_HASH)
-          {
-            return PatchComplianceLevel::LOW;
-          }
-          else if (hashCode == INFORMATIONAL_HASH)
-          {
-            return PatchComplianceLevel::INFORMATIONAL;
-          }
-          else if (hashCode == UNSPECIFIED_HASH)
-          {
-            return PatchComplianceLevel::UNSPECIFIED;
+          case CRITICAL_HASH:
+            if (name == "CRITICAL")
+            {
+              return PatchComplianceLevel::CRITICAL;
+            }
+            break;
+          case HIGH_HASH:
+            if (name == "HIGH")
+            {
+              return PatchComplianceLevel::HIGH;
+            }
+            break;
+          case MEDIUM_HASH:
+            if (name == "MEDIUM")
+            {
+              return PatchComplianceLevel::MEDIUM;
+            }
+            break;
+          case LOW_HASH:
+            if (name == "LOW")
+            {
+              return PatchComplianceLevel::LOW;
+            }
+            break;
+          case INFORMATIONAL_HASH:
+            if (name == "INFORMATIONAL")
+            {
+              return PatchComplianceLevel::INFORMATIONAL;
+            }
+            break;
+          case UNSPECIFIED_HASH:
+            if (name == "UNSPECIFIED")
+            {
+              return PatchComplianceLevel::UNSPECIFIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return PatchComplianceLevel::NOT_SET;
         }
 
-        Aws::String GetNameForPatchComplianceLevel(PatchComplianceLevel enumValue)
+        const char* GetNameForPatchComplianceLevel(PatchComplianceLevel enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
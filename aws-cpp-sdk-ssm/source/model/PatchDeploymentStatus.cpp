@@ -30,30 +30,44 @@ namespace Aws
       namespace PatchDeploymentStatusMapper
       {
 
-        static const int APPROVED_HASH = HashingUtils::HashString("APPROVED");
-        static const int PENDING_APPROVAL_HASH = HashingUtils::HashString("PENDING_APPROVAL");
-        static const int EXPLICIT_APPROVED_HASH = HashingUtils::HashString("EXPLICIT_APPROVED");
-        static const int EXPLICIT_REJECTED_HASH = HashingUtils::HashString("EXPLICIT_REJECTED");
+        static constexpr int APPROVED_HASH = HashingUtils::CompileTimeHashString("APPROVED");
+        static constexpr int PENDING_APPROVAL_HASH = HashingUtils::CompileTimeHashString("PENDING_APPROVAL");
+        static constexpr int EXPLICIT_APPROVED_HASH = HashingUtils::CompileTimeHashString("EXPLICIT_APPROVED");
+        static constexpr int EXPLICIT_REJECTED_HASH = HashingUtils::CompileTimeHashString("EXPLICIT_REJECTED");
 
 
         PatchDeploymentStatus GetPatchDeploymentStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == APPROVED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PatchDeploymentStatus::APPROVED;
-          }
-          else if (hashCode == PENDING_APPROVAL_HASH)
-          {
-            return PatchDeploymentStatus::PENDING_APPROVAL;
-          }
-          else if (hashCode == EXPLICIT_APPROVED_HASH)
-          {
-            return PatchDeploymentStatus::EXPLICIT_APPROVED;
-          }
-          else if (hashCode == EXPLICIT_REJECTED_HASH)
-          {
-            return PatchDeploymentStatus::EXPLICIT_REJECTED;
+          case APPROVED_HASH:
+            if (name == "APPROVED")
+            {
+              return PatchDeploymentStatus::APPROVED;
+            }
+            break;
+          case PENDING_APPROVAL_HASH:
+            if (name == "PENDING_APPROVAL")
+            {
+              return PatchDeploymentStatus::PENDING_APPROVAL;
+            }
+            break;
+          case EXPLICIT_APPROVED_HASH:
+            if (name == "EXPLICIT_APPROVED")
+            {
+              return PatchDeploymentStatus::EXPLICIT_APPROVED;
+            }
+            break;
+          case EXPLICIT_REJECTED_HASH:
+            if (name == "EXPLICIT_REJECTED")
+            {
+              return PatchDeploymentStatus::EXPLICIT_REJECTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return PatchDeploymentStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPatchDeploymentStatus(PatchDeploymentStatus enumValue)
+        const char* GetNameForPatchDeploymentStatus(PatchDeploymentStatus enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
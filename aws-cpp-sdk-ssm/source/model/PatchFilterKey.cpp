@@ -30,45 +30,65 @@ namespace Aws
       namespace PatchFilterKeyMapper
       {
 
-        static const int PRODUCT_HASH = HashingUtils::HashString("PRODUCT");
-        static const int CLASSIFICATION_HASH = HashingUtils::HashString("CLASSIFICATION");
-        static const int MSRC_SEVERITY_HASH = HashingUtils::HashString("MSRC_SEVERITY");
-        static const int PATCH_ID_HASH = HashingUtils::HashString("PATCH_ID");
-        static const int SECTION_HASH = HashingUtils::HashString("SECTION");
-        static const int PRIORITY_HASH = HashingUtils::HashString("PRIORITY");
-        static const int SEVERITY_HASH = HashingUtils::HashString("SEVERITY");
+        static constexpr int PRODUCT_HASH = HashingUtils::CompileTimeHashString("PRODUCT");
+        static constexpr int CLASSIFICATION_HASH = HashingUtils::CompileTimeHashString("CLASSIFICATION");
+        static constexpr int MSRC_SEVERITY_HASH = HashingUtils::CompileTimeHashString("MSRC_SEVERITY");
+        static constexpr int PATCH_ID_HASH = HashingUtils::CompileTimeHashString("PATCH_ID");
+        static constexpr int SECTION_HASH = HashingUtils::CompileTimeHashString("SECTION");
+        static constexpr int PRIORITY_HASH = HashingUtils::CompileTimeHashString("PRIORITY");
+        static constexpr int SEVERITY_HASH = HashingUtils::CompileTimeHashString("SEVERITY");
 
 
         PatchFilterKey GetPatchFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PRODUCT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PatchFilterKey::PRODUCT;
-          }
-          else if (hashCode == CLASSIFICATION_HASH)
-          {
-            return PatchFilterKey::CLASSIFICATION;
-          }
-          else if (hashCode == MSRC_SEVERITY_HASH)
-          {
-            return PatchFilterKey::MSRC_SEVERITY;
-          }
-          else if (hashCode == PATCH_ID_HASH)
-          {
-            return PatchFilterKey::PATCH_ID;
-          }
-          else if (hashCode == SECTION_HASH)
-          {
-            return PatchFilterKey::SECTION;
-          }
-          else if (hashCode == PRIORITY_HASH)
-          {
-            return PatchFilterKey::PRIORITY;
-          }
-          else if (hashCode == SEVERITY_HASH)
-          {
-            return PatchFilterKey::SEVERITY;
+          case PRODUCT_HASH:
+            if (name == "PRODUCT")
+            {
+              return PatchFilterKey::PRODUCT;
+            }
+            break;
+          case CLASSIFICATION_HASH:
+            if (name == "CLASSIFICATION")
+            {
+              return PatchFilterKey::CLASSIFICATION;
+            }
+            break;
+          case MSRC_SEVERITY_HASH:
+            if (name == "MSRC_SEVERITY")
+            {
+              return PatchFilterKey::MSRC_SEVERITY;
+            }
+            break;
+          case PATCH_ID_HASH:
+            if (name == "PATCH_ID")
+            {
+              return PatchFilterKey::PATCH_ID;
+            }
+            break;
+          case SECTION_HASH:
+            if (name == "SECTION")
+            {
+              return PatchFilterKey::SECTION;
+            }
+            break;
+          case PRIORITY_HASH:
+            if (name == "PRIORITY")
+            {
+              return PatchFilterKey::PRIORITY;
+            }
+            break;
+          case SEVERITY_HASH:
+            if (name == "SEVERITY")
+            {
+              return PatchFilterKey::SEVERITY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return PatchFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForPatchFilterKey(PatchFilterKey enumValue)
+        const char* GetNameForPatchFilterKey(PatchFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
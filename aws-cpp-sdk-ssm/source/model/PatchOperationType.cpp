@@ -30,20 +30,30 @@ namespace Aws
       namespace PatchOperationTypeMapper
       {
 
-        static const int Scan_HASH = HashingUtils::HashString("Scan");
-        static const int Install_HASH = HashingUtils::HashString("Install");
+        static constexpr int Scan_HASH = HashingUtils::CompileTimeHashString("Scan");
+        static constexpr int Install_HASH = HashingUtils::CompileTimeHashString("Install");
 
 
         PatchOperationType GetPatchOperationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Scan_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PatchOperationType::Scan;
-          }
-          else if (hashCode == Install_HASH)
-          {
-            return PatchOperationType::Install;
+          case Scan_HASH:
+            if (name == "Scan")
+            {
+              return PatchOperationType::Scan;
+            }
+            break;
+          case Install_HASH:
+            if (name == "Install")
+            {
+              return PatchOperationType::Install;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PatchOperationType::NOT_SET;
         }
 
-        Aws::String GetNameForPatchOperationType(PatchOperationType enumValue)
+        const char* GetNameForPatchOperationType(PatchOperationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
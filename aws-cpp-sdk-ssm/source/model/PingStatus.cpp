@@ -30,25 +30,37 @@ namespace Aws
       namespace PingStatusMapper
       {
 
-        static const int Online_HASH = HashingUtils::HashString("Online");
-        static const int ConnectionLost_HASH = HashingUtils::HashString("ConnectionLost");
-        static const int Inactive_HASH = HashingUtils::HashString("Inactive");
+        static constexpr int Online_HASH = HashingUtils::CompileTimeHashString("Online");
+        static constexpr int ConnectionLost_HASH = HashingUtils::CompileTimeHashString("ConnectionLost");
+        static constexpr int Inactive_HASH = HashingUtils::CompileTimeHashString("Inactive");
 
 
         PingStatus GetPingStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Online_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PingStatus::Online;
-          }
-          else if (hashCode == ConnectionLost_HASH)
-          {
-            return PingStatus::ConnectionLost;
-          }
-          else if (hashCode == Inactive_HASH)
-          {
-            return PingStatus::Inactive;
+          case Online_HASH:
+            if (name == "Online")
+            {
+              return PingStatus::Online;
+            }
+            break;
+          case ConnectionLost_HASH:
+            if (name == "ConnectionLost")
+            {
+              return PingStatus::ConnectionLost;
+            }
+            break;
+          case Inactive_HASH:
+            if (name == "Inactive")
+            {
+              return PingStatus::Inactive;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PingStatus::NOT_SET;
         }
 
-        Aws::String GetNameForPingStatus(PingStatus enumValue)
+        const char* GetNameForPingStatus(PingStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace PlatformTypeMapper
       {
 
-        static const int Windows_HASH = HashingUtils::HashString("Windows");
-        static const int Linux_HASH = HashingUtils::HashString("Linux");
+        static constexpr int Windows_HASH = HashingUtils::CompileTimeHashString("Windows");
+        static constexpr int Linux_HASH = HashingUtils::CompileTimeHashString("Linux");
 
 
         PlatformType GetPlatformTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Windows_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PlatformType::Windows;
-          }
-          else if (hashCode == Linux_HASH)
-          {
-            return PlatformType::Linux;
+          case Windows_HASH:
+            if (name == "Windows")
+            {
+              return PlatformType::Windows;
+            }
+            break;
+          case Linux_HASH:
+            if (name == "Linux")
+            {
+              return PlatformType::Linux;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return PlatformType::NOT_SET;
         }
 
-        Aws::String GetNameForPlatformType(PlatformType enumValue)
+        const char* GetNameForPlatformType(PlatformType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
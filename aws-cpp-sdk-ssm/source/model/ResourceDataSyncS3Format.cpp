@@ -30,15 +30,23 @@ namespace Aws
       namespace ResourceDataSyncS3FormatMapper
       {
 
-        static const int JsonSerDe_HASH = HashingUtils::HashString("JsonSerDe");
+        static constexpr int JsonSerDe_HASH = HashingUtils::CompileTimeHashString("JsonSerDe");
 
 
         ResourceDataSyncS3Format GetResourceDataSyncS3FormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == JsonSerDe_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceDataSyncS3Format::JsonSerDe;
+          case JsonSerDe_HASH:
+            if (name == "JsonSerDe")
+            {
+              return ResourceDataSyncS3Format::JsonSerDe;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return ResourceDataSyncS3Format::NOT_SET;
         }
 
-        Aws::String GetNameForResourceDataSyncS3Format(ResourceDataSyncS3Format enumValue)
+        const char* GetNameForResourceDataSyncS3Format(ResourceDataSyncS3Format enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
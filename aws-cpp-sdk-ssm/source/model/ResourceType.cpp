@@ -30,25 +30,37 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int ManagedInstance_HASH = HashingUtils::HashString("ManagedInstance");
-        static const int Document_HASH = HashingUtils::HashString("Document");
-        static const int EC2Instance_HASH = HashingUtils::HashString("EC2Instance");
+        static constexpr int ManagedInstance_HASH = HashingUtils::CompileTimeHashString("ManagedInstance");
+        static constexpr int Document_HASH = HashingUtils::CompileTimeHashString("Document");
+        static constexpr int EC2Instance_HASH = HashingUtils::CompileTimeHashString("EC2Instance");
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ManagedInstance_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceType::ManagedInstance;
-          }
-          else if (hashCode == Document_HASH)
-          {
-            return ResourceType::Document;
-          }
-          else if (hashCode == EC2Instance_HASH)
-          {
-            return ResourceType::EC2Instance;
+          case ManagedInstance_HASH:
+            if (name == "ManagedInstance")
+            {
+              return ResourceType::ManagedInstance;
+            }
+            break;
+          case Document_HASH:
+            if (name == "Document")
+            {
+              return ResourceType::Document;
+            }
+            break;
+          case EC2Instance_HASH:
+            if (name == "EC2Instance")
+            {
+              return ResourceType::EC2Instance;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceType(ResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace ResourceTypeForTaggingMapper
       {
 
-        static const int Document_HASH = HashingUtils::HashString("Document");
-        static const int ManagedInstance_HASH = HashingUtils::HashString("ManagedInstance");
-        static const int MaintenanceWindow_HASH = HashingUtils::HashString("MaintenanceWindow");
-        static const int Parameter_HASH = HashingUtils::HashString("Parameter");
-        static const int PatchBaseline_HASH = HashingUtils::HashString("PatchBaseline");
+        static constexpr int Document_HASH = HashingUtils::CompileTimeHashString("Document");
+        static constexpr int ManagedInstance_HASH = HashingUtils::CompileTimeHashString("ManagedInstance");
+        static constexpr int MaintenanceWindow_HASH = HashingUtils::CompileTimeHashString("MaintenanceWindow");
+        static constexpr int Parameter_HASH = HashingUtils::CompileTimeHashString("Parameter");
+        static constexpr int PatchBaseline_HASH = HashingUtils::CompileTimeHashString("PatchBaseline");
 
 
         ResourceTypeForTagging GetResourceTypeForTaggingForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Document_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceTypeForTagging::Document;
-          }
-          else if (hashCode == ManagedInstance_HASH)
-          {
-            return ResourceTypeForTagging::ManagedInstance;
-          }
-          else if (hashCode == MaintenanceWindow_HASH)
-          {
-            return ResourceTypeForTagging::MaintenanceWindow;
-          }
-          else if (hashCode == Parameter_HASH)
-          {
-            return ResourceTypeForTagging::Parameter;
-          }
-          else if (hashCode == PatchBaseline_HASH)
-          {
-            return ResourceTypeForTagging::PatchBaseline;
+          case Document_HASH:
+            if (name == "Document")
+            {
+              return ResourceTypeForTagging::Document;
+            }
+            break;
+          case ManagedInstance_HASH:
+            if (name == "ManagedInstance")
+            {
+              return ResourceTypeForTagging::ManagedInstance;
+            }
+            break;
+          case MaintenanceWindow_HASH:
+            if (name == "MaintenanceWindow")
+            {
+              return ResourceTypeForTagging::MaintenanceWindow;
+            }
+            break;
+          case Parameter_HASH:
+            if (name == "Parameter")
+            {
+              return ResourceTypeForTagging::Parameter;
+            }
+            break;
+          case PatchBaseline_HASH:
+            if (name == "PatchBaseline")
+            {
+              return ResourceTypeForTagging::PatchBaseline;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ResourceTypeForTagging::NOT_SET;
         }
 
-        Aws::String GetNameForResourceTypeForTagging(ResourceTypeForTagging enumValue)
+        const char* GetNameForResourceTypeForTagging(ResourceTypeForTagging enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
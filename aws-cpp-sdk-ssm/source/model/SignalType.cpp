@@ -30,35 +30,51 @@ namespace Aws
       namespace SignalTypeMapper
       {
 
-        static const int Approve_HASH = HashingUtils::HashString("Approve");
-        static const int Reject_HASH = HashingUtils::HashString("Reject");
-        static const int StartStep_HASH = HashingUtils::HashString("StartStep");
-        static const int StopStep_HASH = HashingUtils::HashString("StopStep");
-        static const int Resume_HASH = HashingUtils::HashString("Resume");
+        static constexpr int Approve_HASH = HashingUtils::CompileTimeHashString("Approve");
+        static constexpr int Reject_HASH = HashingUtils::CompileTimeHashString("Reject");
+        static constexpr int StartStep_HASH = HashingUtils::CompileTimeHashString("StartStep");
+        static constexpr int StopStep_HASH = HashingUtils::CompileTimeHashString("StopStep");
+        static constexpr int Resume_HASH = HashingUtils::CompileTimeHashString("Resume");
 
 
         SignalType GetSignalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Approve_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SignalType::Approve;
-          }
-          else if (hashCode == Reject_HASH)
-          {
-            return SignalType::Reject;
-          }
-          else if (hashCode == StartStep_HASH)
-          {
-            return SignalType::StartStep;
-          }
-          else if (hashCode == StopStep_HASH)
-          {
-            return SignalType::StopStep;
-          }
-          else if (hashCode == Resume_HASH)
-          {
-            return SignalType::Resume;
+          case Approve_HASH:
+            if (name == "Approve")
+            {
+              return SignalType::Approve;
+            }
+            break;
+          case Reject_HASH:
+            if (name == "Reject")
+            {
+              return SignalType::Reject;
+            }
+            break;
+          case StartStep_HASH:
+            if (name == "StartStep")
+            {
+              return SignalType::StartStep;
+            }
+            break;
+          case StopStep_HASH:
+            if (name == "StopStep")
+            {
+              return SignalType::StopStep;
+            }
+            break;
+          case Resume_HASH:
+            if (name == "Resume")
+            {
+              return SignalType::Resume;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return SignalType::NOT_SET;
         }
 
-        Aws::String GetNameForSignalType(SignalType enumValue)
+        const char* GetNameForSignalType(SignalType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,40 +30,58 @@ namespace Aws
       namespace StepExecutionFilterKeyMapper
       {
 
-        static const int StartTimeBefore_HASH = HashingUtils::HashString("StartTimeBefore");
-        static const int StartTimeAfter_HASH = HashingUtils::HashString("StartTimeAfter");
-        static const int StepExecutionStatus_HASH = HashingUtils::HashString("StepExecutionStatus");
-        static const int StepExecutionId_HASH = HashingUtils::HashString("StepExecutionId");
-        static const int StepName_HASH = HashingUtils::HashString("StepName");
-        static const int Action_HASH = HashingUtils::HashString("Action");
+        static constexpr int StartTimeBefore_HASH = HashingUtils::CompileTimeHashString("StartTimeBefore");
+        static constexpr int StartTimeAfter_HASH = HashingUtils::CompileTimeHashString("StartTimeAfter");
+        static constexpr int StepExecutionStatus_HASH = HashingUtils::CompileTimeHashString("StepExecutionStatus");
+        static constexpr int StepExecutionId_HASH = HashingUtils::CompileTimeHashString("StepExecutionId");
+        static constexpr int StepName_HASH = HashingUtils::CompileTimeHashString("StepName");
+        static constexpr int Action_HASH = HashingUtils::CompileTimeHashString("Action");
 
 
         StepExecutionFilterKey GetStepExecutionFilterKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == StartTimeBefore_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StepExecutionFilterKey::StartTimeBefore;
-          }
-          else if (hashCode == StartTimeAfter_HASH)
-          {
-            return StepExecutionFilterKey::StartTimeAfter;
-          }
-          else if (hashCode == StepExecutionStatus_HASH)
-          {
-            return StepExecutionFilterKey::StepExecutionStatus;
-          }
-          else if (hashCode == StepExecutionId_HASH)
-          {
-            return StepExecutionFilterKey::StepExecutionId;
-          }
-          else if (hashCode == StepName_HASH)
-          {
-            return StepExecutionFilterKey::StepName;
-          }
-          else if (hashCode == Action_HASH)
-          {
-            return StepExecutionFilterKey::Action;
+          case StartTimeBefore_HASH:
+            if (name == "StartTimeBefore")
+            {
+              return StepExecutionFilterKey::StartTimeBefore;
+            }
+            break;
+          case StartTimeAfter_HASH:
+            if (name == "StartTimeAfter")
+            {
+              return StepExecutionFilterKey::StartTimeAfter;
+            }
+            break;
+          case StepExecutionStatus_HASH:
+            if (name == "StepExecutionStatus")
+            {
+              return StepExecutionFilterKey::StepExecutionStatus;
+            }
+            break;
+          case StepExecutionId_HASH:
+            if (name == "StepExecutionId")
+            {
+              return StepExecutionFilterKey::StepExecutionId;
+            }
+            break;
+          case StepName_HASH:
+            if (name == "StepName")
+            {
+              return StepExecutionFilterKey::StepName;
+            }
+            break;
+          case Action_HASH:
+            if (name == "Action")
+            {
+              return StepExecutionFilterKey::Action;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return StepExecutionFilterKey::NOT_SET;
         }
 
-        Aws::String GetNameForStepExecutionFilterKey(StepExecutionFilterKey enumValue)
+        const char* GetNameForStepExecutionFilterKey(StepExecutionFilterKey enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace StopTypeMapper
       {
 
-        static const int Complete_HASH = HashingUtils::HashString("Complete");
-        static const int Cancel_HASH = HashingUtils::HashString("Cancel");
+        static constexpr int Complete_HASH = HashingUtils::CompileTimeHashString("Complete");
+        static constexpr int Cancel_HASH = HashingUtils::CompileTimeHashString("Cancel");
 
 
         StopType GetStopTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Complete_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StopType::Complete;
-          }
-          else if (hashCode == Cancel_HASH)
-          {
-            return StopType::Cancel;
+          case Complete_HASH:
+            if (name == "Complete")
+            {
+              return StopType::Complete;
+            }
+            break;
+          case Cancel_HASH:
+            if (name == "Cancel")
+            {
+              return StopType::Cancel;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return StopType::NOT_SET;
         }
 
-        Aws::String GetNameForStopType(StopType enumValue)
+        const char* GetNameForStopType(StopType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
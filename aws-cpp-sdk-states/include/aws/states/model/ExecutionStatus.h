@@ -37,7 +37,8 @@ namespace ExecutionStatusMapper
 {
 AWS_SFN_API ExecutionStatus GetExecutionStatusForName(const Aws::String& name);
 
-AWS_SFN_API Aws::String GetNameForExecutionStatus(ExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SFN_API const char* GetNameForExecutionStatus(ExecutionStatus value);
 } // namespace ExecutionStatusMapper
 } // namespace Model
 } // namespace SFN
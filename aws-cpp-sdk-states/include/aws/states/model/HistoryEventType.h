@@ -69,7 +69,8 @@ namespace HistoryEventTypeMapper
 {
 AWS_SFN_API HistoryEventType GetHistoryEventTypeForName(const Aws::String& name);
 
-AWS_SFN_API Aws::String GetNameForHistoryEventType(HistoryEventType value);
+// names of values not modeled point into the enum overflow container
+AWS_SFN_API const char* GetNameForHistoryEventType(HistoryEventType value);
 } // namespace HistoryEventTypeMapper
 } // namespace Model
 } // namespace SFN
@@ -34,7 +34,8 @@ namespace StateMachineStatusMapper
 {
 AWS_SFN_API StateMachineStatus GetStateMachineStatusForName(const Aws::String& name);
 
-AWS_SFN_API Aws::String GetNameForStateMachineStatus(StateMachineStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SFN_API const char* GetNameForStateMachineStatus(StateMachineStatus value);
 } // namespace StateMachineStatusMapper
 } // namespace Model
 } // namespace SFN
@@ -28,25 +28,25 @@ namespace SFN
 namespace SFNErrorMapper
 {
 
-static const int MISSING_REQUIRED_PARAMETER_HASH = HashingUtils::HashString("MissingRequiredParameter");
-static const int EXECUTION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ExecutionLimitExceeded");
-static const int TASK_TIMED_OUT_HASH = HashingUtils::HashString("TaskTimedOut");
-static const int INVALID_ARN_HASH = HashingUtils::HashString("InvalidArn");
-static const int ACTIVITY_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ActivityDoesNotExist");
-static const int STATE_MACHINE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("StateMachineDoesNotExist");
-static const int STATE_MACHINE_DELETING_HASH = HashingUtils::HashString("StateMachineDeleting");
-static const int ACTIVITY_WORKER_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ActivityWorkerLimitExceeded");
-static const int EXECUTION_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ExecutionDoesNotExist");
-static const int INVALID_NAME_HASH = HashingUtils::HashString("InvalidName");
-static const int INVALID_DEFINITION_HASH = HashingUtils::HashString("InvalidDefinition");
-static const int EXECUTION_ALREADY_EXISTS_HASH = HashingUtils::HashString("ExecutionAlreadyExists");
-static const int ACTIVITY_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ActivityLimitExceeded");
-static const int STATE_MACHINE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("StateMachineLimitExceeded");
-static const int INVALID_OUTPUT_HASH = HashingUtils::HashString("InvalidOutput");
-static const int STATE_MACHINE_ALREADY_EXISTS_HASH = HashingUtils::HashString("StateMachineAlreadyExists");
-static const int INVALID_TOKEN_HASH = HashingUtils::HashString("InvalidToken");
-static const int INVALID_EXECUTION_INPUT_HASH = HashingUtils::HashString("InvalidExecutionInput");
-static const int TASK_DOES_NOT_EXIST_HASH = HashingUtils::HashString("TaskDoesNotExist");
+static constexpr int MISSING_REQUIRED_PARAMETER_HASH = HashingUtils::CompileTimeHashString("MissingRequiredParameter");
+static constexpr int EXECUTION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ExecutionLimitExceeded");
+static constexpr int TASK_TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("TaskTimedOut");
+static constexpr int INVALID_ARN_HASH = HashingUtils::CompileTimeHashString("InvalidArn");
+static constexpr int ACTIVITY_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ActivityDoesNotExist");
+static constexpr int STATE_MACHINE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("StateMachineDoesNotExist");
+static constexpr int STATE_MACHINE_DELETING_HASH = HashingUtils::CompileTimeHashString("StateMachineDeleting");
+static constexpr int ACTIVITY_WORKER_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ActivityWorkerLimitExceeded");
+static constexpr int EXECUTION_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ExecutionDoesNotExist");
+static constexpr int INVALID_NAME_HASH = HashingUtils::CompileTimeHashString("InvalidName");
+static constexpr int INVALID_DEFINITION_HASH = HashingUtils::CompileTimeHashString("InvalidDefinition");
+static constexpr int EXECUTION_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ExecutionAlreadyExists");
+static constexpr int ACTIVITY_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ActivityLimitExceeded");
+static constexpr int STATE_MACHINE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("StateMachineLimitExceeded");
+static constexpr int INVALID_OUTPUT_HASH = HashingUtils::CompileTimeHashString("InvalidOutput");
+static constexpr int STATE_MACHINE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("StateMachineAlreadyExists");
+static constexpr int INVALID_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidToken");
+static constexpr int INVALID_EXECUTION_INPUT_HASH = HashingUtils::CompileTimeHashString("InvalidExecutionInput");
+static constexpr int TASK_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("TaskDoesNotExist");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
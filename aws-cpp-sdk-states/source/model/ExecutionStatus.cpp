@@ -30,35 +30,51 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int RUNNING_HASH = HashingUtils::HashString("RUNNING");
-        static const int SUCCEEDED_HASH = HashingUtils::HashString("SUCCEEDED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
-        static const int ABORTED_HASH = HashingUtils::HashString("ABORTED");
+        static constexpr int RUNNING_HASH = HashingUtils::CompileTimeHashString("RUNNING");
+        static constexpr int SUCCEEDED_HASH = HashingUtils::CompileTimeHashString("SUCCEEDED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("TIMED_OUT");
+        static constexpr int ABORTED_HASH = HashingUtils::CompileTimeHashString("ABORTED");
 
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == RUNNING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExecutionStatus::RUNNING;
-          }
-          else if (hashCode == SUCCEEDED_HASH)
-          {
-            return ExecutionStatus::SUCCEEDED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return ExecutionStatus::FAILED;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return ExecutionStatus::TIMED_OUT;
-          }
-          else if (hashCode == ABORTED_HASH)
-          {
-            return ExecutionStatus::ABORTED;
+          case RUNNING_HASH:
+            if (name == "RUNNING")
+            {
+              return ExecutionStatus::RUNNING;
+            }
+            break;
+          case SUCCEEDED_HASH:
+            if (name == "SUCCEEDED")
+            {
+              return ExecutionStatus::SUCCEEDED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return ExecutionStatus::FAILED;
+            }
+            break;
+          case TIMED_OUT_HASH:
+            if (name == "TIMED_OUT")
+            {
+              return ExecutionStatus::TIMED_OUT;
+            }
+            break;
+          case ABORTED_HASH:
+            if (name == "ABORTED")
+            {
+              return ExecutionStatus::ABORTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return ExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        const char* GetNameForExecutionStatus(ExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,195 +30,275 @@ namespace Aws
       namespace HistoryEventTypeMapper
       {
 
-        static const int ActivityFailed_HASH = HashingUtils::HashString("ActivityFailed");
-        static const int ActivityScheduleFailed_HASH = HashingUtils::HashString("ActivityScheduleFailed");
-        static const int ActivityScheduled_HASH = HashingUtils::HashString("ActivityScheduled");
-        static const int ActivityStarted_HASH = HashingUtils::HashString("ActivityStarted");
-        static const int ActivitySucceeded_HASH = HashingUtils::HashString("ActivitySucceeded");
-        static const int ActivityTimedOut_HASH = HashingUtils::HashString("ActivityTimedOut");
-        static const int ChoiceStateEntered_HASH = HashingUtils::HashString("ChoiceStateEntered");
-        static const int ChoiceStateExited_HASH = HashingUtils::HashString("ChoiceStateExited");
-        static const int ExecutionFailed_HASH = HashingUtils::HashString("ExecutionFailed");
-        static const int ExecutionStarted_HASH = HashingUtils::HashString("ExecutionStarted");
-        static const int ExecutionSucceeded_HASH = HashingUtils::HashString("ExecutionSucceeded");
-        static const int ExecutionAborted_HASH = HashingUtils::HashString("ExecutionAborted");
-        static const int ExecutionTimedOut_HASH = HashingUtils::HashString("ExecutionTimedOut");
-        static const int FailStateEntered_HASH = HashingUtils::HashString("FailStateEntered");
-        static const int LambdaFunctionFailed_HASH = HashingUtils::HashString("LambdaFunctionFailed");
-        static const int LambdaFunctionScheduleFailed_HASH = HashingUtils::HashString("LambdaFunctionScheduleFailed");
-        static const int LambdaFunctionScheduled_HASH = HashingUtils::HashString("LambdaFunctionScheduled");
-        static const int LambdaFunctionStartFailed_HASH = HashingUtils::HashString("LambdaFunctionStartFailed");
-        static const int LambdaFunctionStarted_HASH = HashingUtils::HashString("LambdaFunctionStarted");
-        static const int LambdaFunctionSucceeded_HASH = HashingUtils::HashString("LambdaFunctionSucceeded");
-        static const int LambdaFunctionTimedOut_HASH = HashingUtils::HashString("LambdaFunctionTimedOut");
-        static const int SucceedStateEntered_HASH = HashingUtils::HashString("SucceedStateEntered");
-        static const int SucceedStateExited_HASH = HashingUtils::HashString("SucceedStateExited");
-        static const int TaskStateAborted_HASH = HashingUtils::HashString("TaskStateAborted");
-        static const int TaskStateEntered_HASH = HashingUtils::HashString("TaskStateEntered");
-        static const int TaskStateExited_HASH = HashingUtils::HashString("TaskStateExited");
-        static const int PassStateEntered_HASH = HashingUtils::HashString("PassStateEntered");
-        static const int PassStateExited_HASH = HashingUtils::HashString("PassStateExited");
-        static const int ParallelStateAborted_HASH = HashingUtils::HashString("ParallelStateAborted");
-        static const int ParallelStateEntered_HASH = HashingUtils::HashString("ParallelStateEntered");
-        static const int ParallelStateExited_HASH = HashingUtils::HashString("ParallelStateExited");
-        static const int ParallelStateFailed_HASH = HashingUtils::HashString("ParallelStateFailed");
-        static const int ParallelStateStarted_HASH = HashingUtils::HashString("ParallelStateStarted");
-        static const int ParallelStateSucceeded_HASH = HashingUtils::HashString("ParallelStateSucceeded");
-        static const int WaitStateAborted_HASH = HashingUtils::HashString("WaitStateAborted");
-        static const int WaitStateEntered_HASH = HashingUtils::HashString("WaitStateEntered");
-        static const int WaitStateExited_HASH = HashingUtils::HashString("WaitStateExited");
+        static constexpr int ActivityFailed_HASH = HashingUtils::CompileTimeHashString("ActivityFailed");
+        static constexpr int ActivityScheduleFailed_HASH = HashingUtils::CompileTimeHashString("ActivityScheduleFailed");
+        static constexpr int ActivityScheduled_HASH = HashingUtils::CompileTimeHashString("ActivityScheduled");
+        static constexpr int ActivityStarted_HASH = HashingUtils::CompileTimeHashString("ActivityStarted");
+        static constexpr int ActivitySucceeded_HASH = HashingUtils::CompileTimeHashString("ActivitySucceeded");
+        static constexpr int ActivityTimedOut_HASH = HashingUtils::CompileTimeHashString("ActivityTimedOut");
+        static constexpr int ChoiceStateEntered_HASH = HashingUtils::CompileTimeHashString("ChoiceStateEntered");
+        static constexpr int ChoiceStateExited_HASH = HashingUtils::CompileTimeHashString("ChoiceStateExited");
+        static constexpr int ExecutionFailed_HASH = HashingUtils::CompileTimeHashString("ExecutionFailed");
+        static constexpr int ExecutionStarted_HASH = HashingUtils::CompileTimeHashString("ExecutionStarted");
+        static constexpr int ExecutionSucceeded_HASH = HashingUtils::CompileTimeHashString("ExecutionSucceeded");
+        static constexpr int ExecutionAborted_HASH = HashingUtils::CompileTimeHashString("ExecutionAborted");
+        static constexpr int ExecutionTimedOut_HASH = HashingUtils::CompileTimeHashString("ExecutionTimedOut");
+        static constexpr int FailStateEntered_HASH = HashingUtils::CompileTimeHashString("FailStateEntered");
+        static constexpr int LambdaFunctionFailed_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionFailed");
+        static constexpr int LambdaFunctionScheduleFailed_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionScheduleFailed");
+        static constexpr int LambdaFunctionScheduled_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionScheduled");
+        static constexpr int LambdaFunctionStartFailed_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionStartFailed");
+        static constexpr int LambdaFunctionStarted_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionStarted");
+        static constexpr int LambdaFunctionSucceeded_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionSucceeded");
+        static constexpr int LambdaFunctionTimedOut_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionTimedOut");
+        static constexpr int SucceedStateEntered_HASH = HashingUtils::CompileTimeHashString("SucceedStateEntered");
+        static constexpr int SucceedStateExited_HASH = HashingUtils::CompileTimeHashString("SucceedStateExited");
+        static constexpr int TaskStateAborted_HASH = HashingUtils::CompileTimeHashString("TaskStateAborted");
+        static constexpr int TaskStateEntered_HASH = HashingUtils::CompileTimeHashString("TaskStateEntered");
+        static constexpr int TaskStateExited_HASH = HashingUtils::CompileTimeHashString("TaskStateExited");
+        static constexpr int PassStateEntered_HASH = HashingUtils::CompileTimeHashString("PassStateEntered");
+        static constexpr int PassStateExited_HASH = HashingUtils::CompileTimeHashString("PassStateExited");
+        static constexpr int ParallelStateAborted_HASH = HashingUtils::CompileTimeHashString("ParallelStateAborted");
+        static constexpr int ParallelStateEntered_HASH = HashingUtils::CompileTimeHashString("ParallelStateEntered");
+        static constexpr int ParallelStateExited_HASH = HashingUtils::CompileTimeHashString("ParallelStateExited");
+        static constexpr int ParallelStateFailed_HASH = HashingUtils::CompileTimeHashString("ParallelStateFailed");
+        static constexpr int ParallelStateStarted_HASH = HashingUtils::CompileTimeHashString("ParallelStateStarted");
+        static constexpr int ParallelStateSucceeded_HASH = HashingUtils::CompileTimeHashString("ParallelStateSucceeded");
+        static constexpr int WaitStateAborted_HASH = HashingUtils::CompileTimeHashString("WaitStateAborted");
+        static constexpr int WaitStateEntered_HASH = HashingUtils::CompileTimeHashString("WaitStateEntered");
+        static constexpr int WaitStateExited_HASH = HashingUtils::CompileTimeHashString("WaitStateExited");
 
 
         HistoryEventType GetHistoryEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivityFailed_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return HistoryEventType::ActivityFailed;
-          }
-          else if (hashCode == ActivityScheduleFailed_HASH)
-          {
-            return HistoryEventType::ActivityScheduleFailed;
-          }
-          else if (hashCode == ActivityScheduled_HASH)
-          {
-            return HistoryEventType::ActivityScheduled;
-          }
-          else if (hashCode == ActivityStarted_HASH)
-          {
-            return HistoryEventType::ActivityStarted;
-          }
-          else if (hashCode == ActivitySucceeded_HASH)
-          {
-            return HistoryEventType::ActivitySucceeded;
-          }
-          else if (hashCode == ActivityTimedOut_HASH)
-          {
-            return HistoryEventType::ActivityTimedOut;
-          }
-          else if (hashCode == ChoiceStateEntered_HASH)
-          {
-            return HistoryEventType::ChoiceStateEntered;
-          }
-          else if (hashCode == ChoiceStateExited_HASH)
-          {
-            return HistoryEventType::ChoiceStateExited;
-          }
-          else if (hashCode == ExecutionFailed_HASH)
-          {
-            return HistoryEventType::ExecutionFailed;
-          }
-          else if (hashCode == ExecutionStarted_HASH)
-          {
-            return HistoryEventType::ExecutionStarted;
-          }
-          else if (hashCode == ExecutionSucceeded_HASH)
-          {
-            return HistoryEventType::ExecutionSucceeded;
-          }
-          else if (hashCode == ExecutionAborted_HASH)
-          {
-            return HistoryEventType::ExecutionAborted;
-          }
-          else if (hashCode == ExecutionTimedOut_HASH)
-          {
-            return HistoryEventType::ExecutionTimedOut;
-          }
-          else if (hashCode == FailStateEntered_HASH)
-          {
-            return HistoryEventType::FailStateEntered;
-          }
-          else if (hashCode == LambdaFunctionFailed_HASH)
-          {
-            return HistoryEventType::LambdaFunctionFailed;
-          }
-          else if (hashCode == LambdaFunctionScheduleFailed_HASH)
-          {
-            return HistoryEventType::LambdaFunctionScheduleFailed;
-          }
-          else if (hashCode == LambdaFunctionScheduled_HASH)
-          {
-            return HistoryEventType::LambdaFunctionScheduled;
-          }
-          else if (hashCode == LambdaFunctionStartFailed_HASH)
-          {
-            return HistoryEventType::LambdaFunctionStartFailed;
-          }
-          else if (hashCode == LambdaFunctionStarted_HASH)
-          {
-            return HistoryEventType::LambdaFunctionStarted;
-          }
-          else if (hashCode == LambdaFunctionSucceeded_HASH)
-          {
-            return HistoryEventType::LambdaFunctionSucceeded;
-          }
-          else if (hashCode == LambdaFunctionTimedOut_HASH)
-          {
-            return HistoryEventType::LambdaFunctionTimedOut;
-          }
-          else if (hashCode == SucceedStateEntered_HASH)
-          {
-            return HistoryEventType::SucceedStateEntered;
-          }
-          else if (hashCode == SucceedStateExited_HASH)
-          {
-            return HistoryEventType::SucceedStateExited;
-          }
-          else if (hashCode == TaskStateAborted_HASH)
-          {
-            return HistoryEventType::TaskStateAborted;
-          }
-          else if (hashCode == TaskStateEntered_HASH)
-          {
-            return HistoryEventType::TaskStateEntered;
-          }
-          else if (hashCode == TaskStateExited_HASH)
-          {
-            return HistoryEventType::TaskStateExited;
-          }
-          else if (hashCode == PassStateEntered_HASH)
-          {
-            return HistoryEventType::PassStateEntered;
-          }
-          else if (hashCode == PassStateExited_HASH)
-          {
-            return HistoryEventType::PassStateExited;
-          }
-          else if (hashCode == ParallelStateAborted_HASH)
-          {
-            return HistoryEventType::ParallelStateAborted;
-          }
-          else if (hashCode == ParallelStateEntered_HASH)
-          {
-            return HistoryEventType::ParallelStateEntered;
-          }
-          else if (hashCode == ParallelStateExited_HASH)
-          {
-            return HistoryEventType::ParallelStateExited;
-          }
-          else if (hashCode == ParallelStateFailed_HASH)
-          {
-            return HistoryEventType::ParallelStateFailed;
-          }
-          else if (hashCode == ParallelStateStarted_HASH)
-          {
-            return HistoryEventType::ParallelStateStarted;
-          }
-          else if (hashCode == ParallelStateSucceeded_HASH)
-          {
-            return HistoryEventType::ParallelStateSucceeded;
-          }
-          else if (hashCode == WaitStateAborted_HASH)
-          {
-            return HistoryEventType::WaitStateAborted;
-          }
-          else if (hashCode == WaitStateEntered_HASH)
-          {
-            return HistoryEventType::WaitStateEntered;
-          }
-          else if (hashCode == WaitStateExited_HASH)
-          {
-            return HistoryEventType::WaitStateExited;
+          case ActivityFailed_HASH:
+            if (name == "ActivityFailed")
+            {
+              return HistoryEventType::ActivityFailed;
+            }
+            break;
+          case ActivityScheduleFailed_HASH:
+            if (name == "ActivityScheduleFailed")
+            {
+              return HistoryEventType::ActivityScheduleFailed;
+            }
+            break;
+          case ActivityScheduled_HASH:
+            if (name == "ActivityScheduled")
+            {
+              return HistoryEventType::ActivityScheduled;
+            }
+            break;
+          case ActivityStarted_HASH:
+            if (name == "ActivityStarted")
+            {
+              return HistoryEventType::ActivityStarted;
+            }
+            break;
+          case ActivitySucceeded_HASH:
+            if (name == "ActivitySucceeded")
+            {
+              return HistoryEventType::ActivitySucceeded;
+            }
+            break;
+          case ActivityTimedOut_HASH:
+            if (name == "ActivityTimedOut")
+            {
+              return HistoryEventType::ActivityTimedOut;
+            }
+            break;
+          case ChoiceStateEntered_HASH:
+            if (name == "ChoiceStateEntered")
+            {
+              return HistoryEventType::ChoiceStateEntered;
+            }
+            break;
+          case ChoiceStateExited_HASH:
+            if (name == "ChoiceStateExited")
+            {
+              return HistoryEventType::ChoiceStateExited;
+            }
+            break;
+          case ExecutionFailed_HASH:
+            if (name == "ExecutionFailed")
+            {
+              return HistoryEventType::ExecutionFailed;
+            }
+            break;
+          case ExecutionStarted_HASH:
+            if (name == "ExecutionStarted")
+            {
+              return HistoryEventType::ExecutionStarted;
+            }
+            break;
+          case ExecutionSucceeded_HASH:
+            if (name == "ExecutionSucceeded")
+            {
+              return HistoryEventType::ExecutionSucceeded;
+            }
+            break;
+          case ExecutionAborted_HASH:
+            if (name == "ExecutionAborted")
+            {
+              return HistoryEventType::ExecutionAborted;
+            }
+            break;
+          case ExecutionTimedOut_HASH:
+            if (name == "ExecutionTimedOut")
+            {
+              return HistoryEventType::ExecutionTimedOut;
+            }
+            break;
+          case FailStateEntered_HASH:
+            if (name == "FailStateEntered")
+            {
+              return HistoryEventType::FailStateEntered;
+            }
+            break;
+          case LambdaFunctionFailed_HASH:
+            if (name == "LambdaFunctionFailed")
+            {
+              return HistoryEventType::LambdaFunctionFailed;
+            }
+            break;
+          case LambdaFunctionScheduleFailed_HASH:
+            if (name == "LambdaFunctionScheduleFailed")
+            {
+              return HistoryEventType::LambdaFunctionScheduleFailed;
+            }
+            break;
+          case LambdaFunctionScheduled_HASH:
+            if (name == "LambdaFunctionScheduled")
+            {
+              return HistoryEventType::LambdaFunctionScheduled;
+            }
+            break;
+          case LambdaFunctionStartFailed_HASH:
+            if (name == "LambdaFunctionStartFailed")
+            {
+              return HistoryEventType::LambdaFunctionStartFailed;
+            }
+            break;
+          case LambdaFunctionStarted_HASH:
+            if (name == "LambdaFunctionStarted")
+            {
+              return HistoryEventType::LambdaFunctionStarted;
+            }
+            break;
+          case LambdaFunctionSucceeded_HASH:
+            if (name == "LambdaFunctionSucceeded")
+            {
+              return HistoryEventType::LambdaFunctionSucceeded;
+            }
+            break;
+          case LambdaFunctionTimedOut_HASH:
+            if (name == "LambdaFunctionTimedOut")
+            {
+              return HistoryEventType::LambdaFunctionTimedOut;
+            }
+            break;
+          case SucceedStateEntered_HASH:
+            if (name == "SucceedStateEntered")
+            {
+              return HistoryEventType::SucceedStateEntered;
+            }
+            break;
+          case SucceedStateExited_HASH:
+            if (name == "SucceedStateExited")
+            {
+              return HistoryEventType::SucceedStateExited;
+            }
+            break;
+          case TaskStateAborted_HASH:
+            if (name == "TaskStateAborted")
+            {
+              return HistoryEventType::TaskStateAborted;
+            }
+            break;
+          case TaskStateEntered_HASH:
+            if (name == "TaskStateEntered")
+            {
+              return HistoryEventType::TaskStateEntered;
+            }
+            break;
+          case TaskStateExited_HASH:
+            if (name == "TaskStateExited")
+            {
+              return HistoryEventType::TaskStateExited;
+            }
+            break;
+          case PassStateEntered_HASH:
+            if (name == "PassStateEntered")
+            {
+              return HistoryEventType::PassStateEntered;
+            }
+            break;
+          case PassStateExited_HASH:
+            if (name == "PassStateExited")
+            {
+              return HistoryEventType::PassStateExited;
+            }
+            break;
+          case ParallelStateAborted_HASH:
+            if (name == "ParallelStateAborted")
+            {
+              return HistoryEventType::ParallelStateAborted;
+            }
+            break;
+          case ParallelStateEntered_HASH:
+            if (name == "ParallelStateEntered")
+            {
+              return HistoryEventType::ParallelStateEntered;
+            }
+            break;
+          case ParallelStateExited_HASH:
+            if (name == "ParallelStateExited")
+            {
+              return HistoryEventType::ParallelStateExited;
+            }
+            break;
+          case ParallelStateFailed_HASH:
+            if (name == "ParallelStateFailed")
+            {
+              return HistoryEventType::ParallelStateFailed;
+            }
+            break;
+          case ParallelStateStarted_HASH:
+            if (name == "ParallelStateStarted")
+            {
+              return HistoryEventType::ParallelStateStarted;
+            }
+            break;
+          case ParallelStateSucceeded_HASH:
+            if (name == "ParallelStateSucceeded")
+            {
+              return HistoryEventType::ParallelStateSucceeded;
+            }
+            break;
+          case WaitStateAborted_HASH:
+            if (name == "WaitStateAborted")
+            {
+              return HistoryEventType::WaitStateAborted;
+            }
+            break;
+          case WaitStateEntered_HASH:
+            if (name == "WaitStateEntered")
+            {
+              return HistoryEventType::WaitStateEntered;
+            }
+            break;
+          case WaitStateExited_HASH:
+            if (name == "WaitStateExited")
+            {
+              return HistoryEventType::WaitStateExited;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -230,7 +310,7 @@ namespace Aws
           return HistoryEventType::NOT_SET;
         }
 
-        Aws::String GetNameForHistoryEventType(HistoryEventType enumValue)
+        const char* GetNameForHistoryEventType(HistoryEventType enumValue)
         {
           switch(enumValue)
           {
@@ -312,7 +392,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -93,7 +93,8 @@ namespace ErrorCodeMapper
 {
 AWS_STORAGEGATEWAY_API ErrorCode GetErrorCodeForName(const Aws::String& name);
 
-AWS_STORAGEGATEWAY_API Aws::String GetNameForErrorCode(ErrorCode value);
+// names of values not modeled point into the enum overflow container
+AWS_STORAGEGATEWAY_API const char* GetNameForErrorCode(ErrorCode value);
 } // namespace ErrorCodeMapper
 } // namespace Model
 } // namespace StorageGateway
@@ -34,7 +34,8 @@ namespace FileShareTypeMapper
 {
 AWS_STORAGEGATEWAY_API FileShareType GetFileShareTypeForName(const Aws::String& name);
 
-AWS_STORAGEGATEWAY_API Aws::String GetNameForFileShareType(FileShareType value);
+// names of values not modeled point into the enum overflow container
+AWS_STORAGEGATEWAY_API const char* GetNameForFileShareType(FileShareType value);
 } // namespace FileShareTypeMapper
 } // namespace Model
 } // namespace StorageGateway
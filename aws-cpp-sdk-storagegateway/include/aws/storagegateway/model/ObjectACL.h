@@ -39,7 +39,8 @@ namespace ObjectACLMapper
 {
 AWS_STORAGEGATEWAY_API ObjectACL GetObjectACLForName(const Aws::String& name);
 
-AWS_STORAGEGATEWAY_API Aws::String GetNameForObjectACL(ObjectACL value);
+// names of values not modeled point into the enum overflow container
+AWS_STORAGEGATEWAY_API const char* GetNameForObjectACL(ObjectACL value);
 } // namespace ObjectACLMapper
 } // namespace Model
 } // namespace StorageGateway
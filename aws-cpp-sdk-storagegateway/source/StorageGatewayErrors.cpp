@@ -28,7 +28,7 @@ namespace StorageGateway
 namespace StorageGatewayErrorMapper
 {
 
-static const int INVALID_GATEWAY_REQUEST_HASH = HashingUtils::HashString("InvalidGatewayRequestException");
+static constexpr int INVALID_GATEWAY_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidGatewayRequestException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,315 +30,443 @@ namespace Aws
       namespace ErrorCodeMapper
       {
 
-        static const int ActivationKeyExpired_HASH = HashingUtils::HashString("ActivationKeyExpired");
-        static const int ActivationKeyInvalid_HASH = HashingUtils::HashString("ActivationKeyInvalid");
-        static const int ActivationKeyNotFound_HASH = HashingUtils::HashString("ActivationKeyNotFound");
-        static const int GatewayInternalError_HASH = HashingUtils::HashString("GatewayInternalError");
-        static const int GatewayNotConnected_HASH = HashingUtils::HashString("GatewayNotConnected");
-        static const int GatewayNotFound_HASH = HashingUtils::HashString("GatewayNotFound");
-        static const int GatewayProxyNetworkConnectionBusy_HASH = HashingUtils::HashString("GatewayProxyNetworkConnectionBusy");
-        static const int AuthenticationFailure_HASH = HashingUtils::HashString("AuthenticationFailure");
-        static const int BandwidthThrottleScheduleNotFound_HASH = HashingUtils::HashString("BandwidthThrottleScheduleNotFound");
-        static const int Blocked_HASH = HashingUtils::HashString("Blocked");
-        static const int CannotExportSnapshot_HASH = HashingUtils::HashString("CannotExportSnapshot");
-        static const int ChapCredentialNotFound_HASH = HashingUtils::HashString("ChapCredentialNotFound");
-        static const int DiskAlreadyAllocated_HASH = HashingUtils::HashString("DiskAlreadyAllocated");
-        static const int DiskDoesNotExist_HASH = HashingUtils::HashString("DiskDoesNotExist");
-        static const int DiskSizeGreaterThanVolumeMaxSize_HASH = HashingUtils::HashString("DiskSizeGreaterThanVolumeMaxSize");
-        static const int DiskSizeLessThanVolumeSize_HASH = HashingUtils::HashString("DiskSizeLessThanVolumeSize");
-        static const int DiskSizeNotGigAligned_HASH = HashingUtils::HashString("DiskSizeNotGigAligned");
-        static const int DuplicateCertificateInfo_HASH = HashingUtils::HashString("DuplicateCertificateInfo");
-        static const int DuplicateSchedule_HASH = HashingUtils::HashString("DuplicateSchedule");
-        static const int EndpointNotFound_HASH = HashingUtils::HashString("EndpointNotFound");
-        static const int IAMNotSupported_HASH = HashingUtils::HashString("IAMNotSupported");
-        static const int InitiatorInvalid_HASH = HashingUtils::HashString("InitiatorInvalid");
-        static const int InitiatorNotFound_HASH = HashingUtils::HashString("InitiatorNotFound");
-        static const int InternalError_HASH = HashingUtils::HashString("InternalError");
-        static const int InvalidGateway_HASH = HashingUtils::HashString("InvalidGateway");
-        static const int InvalidEndpoint_HASH = HashingUtils::HashString("InvalidEndpoint");
-        static const int InvalidParameters_HASH = HashingUtils::HashString("InvalidParameters");
-        static const int InvalidSchedule_HASH = HashingUtils::HashString("InvalidSchedule");
-        static const int LocalStorageLimitExceeded_HASH = HashingUtils::HashString("LocalStorageLimitExceeded");
-        static const int LunAlreadyAllocated_HASH = HashingUtils::HashString("LunAlreadyAllocated ");
-        static const int LunInvalid_HASH = HashingUtils::HashString("LunInvalid");
-        static const int MaximumContentLengthExceeded_HASH = HashingUtils::HashString("MaximumContentLengthExceeded");
-        static const int MaximumTapeCartridgeCountExceeded_HASH = HashingUtils::HashString("MaximumTapeCartridgeCountExceeded");
-        static const int MaximumVolumeCountExceeded_HASH = HashingUtils::HashString("MaximumVolumeCountExceeded");
-        static const int NetworkConfigurationChanged_HASH = HashingUtils::HashString("NetworkConfigurationChanged");
-        static const int NoDisksAvailable_HASH = HashingUtils::HashString("NoDisksAvailable");
-        static const int NotImplemented_HASH = HashingUtils::HashString("NotImplemented");
-        static const int NotSupported_HASH = HashingUtils::HashString("NotSupported");
-        static const int OperationAborted_HASH = HashingUtils::HashString("OperationAborted");
-        static const int OutdatedGateway_HASH = HashingUtils::HashString("OutdatedGateway");
-        static const int ParametersNotImplemented_HASH = HashingUtils::HashString("ParametersNotImplemented");
-        static const int RegionInvalid_HASH = HashingUtils::HashString("RegionInvalid");
-        static const int RequestTimeout_HASH = HashingUtils::HashString("RequestTimeout");
-        static const int ServiceUnavailable_HASH = HashingUtils::HashString("ServiceUnavailable");
-        static const int SnapshotDeleted_HASH = HashingUtils::HashString("SnapshotDeleted");
-        static const int SnapshotIdInvalid_HASH = HashingUtils::HashString("SnapshotIdInvalid");
-        static const int SnapshotInProgress_HASH = HashingUtils::HashString("SnapshotInProgress");
-        static const int SnapshotNotFound_HASH = HashingUtils::HashString("SnapshotNotFound");
-        static const int SnapshotScheduleNotFound_HASH = HashingUtils::HashString("SnapshotScheduleNotFound");
-        static const int StagingAreaFull_HASH = HashingUtils::HashString("StagingAreaFull");
-        static const int StorageFailure_HASH = HashingUtils::HashString("StorageFailure");
-        static const int TapeCartridgeNotFound_HASH = HashingUtils::HashString("TapeCartridgeNotFound");
-        static const int TargetAlreadyExists_HASH = HashingUtils::HashString("TargetAlreadyExists");
-        static const int TargetInvalid_HASH = HashingUtils::HashString("TargetInvalid");
-        static const int TargetNotFound_HASH = HashingUtils::HashString("TargetNotFound");
-        static const int UnauthorizedOperation_HASH = HashingUtils::HashString("UnauthorizedOperation");
-        static const int VolumeAlreadyExists_HASH = HashingUtils::HashString("VolumeAlreadyExists");
-        static const int VolumeIdInvalid_HASH = HashingUtils::HashString("VolumeIdInvalid");
-        static const int VolumeInUse_HASH = HashingUtils::HashString("VolumeInUse");
-        static const int VolumeNotFound_HASH = HashingUtils::HashString("VolumeNotFound");
-        static const int VolumeNotReady_HASH = HashingUtils::HashString("VolumeNotReady");
+        static constexpr int ActivationKeyExpired_HASH = HashingUtils::CompileTimeHashString("ActivationKeyExpired");
+        static constexpr int ActivationKeyInvalid_HASH = HashingUtils::CompileTimeHashString("ActivationKeyInvalid");
+        static constexpr int ActivationKeyNotFound_HASH = HashingUtils::CompileTimeHashString("ActivationKeyNotFound");
+        static constexpr int GatewayInternalError_HASH = HashingUtils::CompileTimeHashString("GatewayInternalError");
+        static constexpr int GatewayNotConnected_HASH = HashingUtils::CompileTimeHashString("GatewayNotConnected");
+        static constexpr int GatewayNotFound_HASH = HashingUtils::CompileTimeHashString("GatewayNotFound");
+        static constexpr int GatewayProxyNetworkConnectionBusy_HASH = HashingUtils::CompileTimeHashString("GatewayProxyNetworkConnectionBusy");
+        static constexpr int AuthenticationFailure_HASH = HashingUtils::CompileTimeHashString("AuthenticationFailure");
+        static constexpr int BandwidthThrottleScheduleNotFound_HASH = HashingUtils::CompileTimeHashString("BandwidthThrottleScheduleNotFound");
+        static constexpr int Blocked_HASH = HashingUtils::CompileTimeHashString("Blocked");
+        static constexpr int CannotExportSnapshot_HASH = HashingUtils::CompileTimeHashString("CannotExportSnapshot");
+        static constexpr int ChapCredentialNotFound_HASH = HashingUtils::CompileTimeHashString("ChapCredentialNotFound");
+        static constexpr int DiskAlreadyAllocated_HASH = HashingUtils::CompileTimeHashString("DiskAlreadyAllocated");
+        static constexpr int DiskDoesNotExist_HASH = HashingUtils::CompileTimeHashString("DiskDoesNotExist");
+        static constexpr int DiskSizeGreaterThanVolumeMaxSize_HASH = HashingUtils::CompileTimeHashString("DiskSizeGreaterThanVolumeMaxSize");
+        static constexpr int DiskSizeLessThanVolumeSize_HASH = HashingUtils::CompileTimeHashString("DiskSizeLessThanVolumeSize");
+        static constexpr int DiskSizeNotGigAligned_HASH = HashingUtils::CompileTimeHashString("DiskSizeNotGigAligned");
+        static constexpr int DuplicateCertificateInfo_HASH = HashingUtils::CompileTimeHashString("DuplicateCertificateInfo");
+        static constexpr int DuplicateSchedule_HASH = HashingUtils::CompileTimeHashString("DuplicateSchedule");
+        static constexpr int EndpointNotFound_HASH = HashingUtils::CompileTimeHashString("EndpointNotFound");
+        static constexpr int IAMNotSupported_HASH = HashingUtils::CompileTimeHashString("IAMNotSupported");
+        static constexpr int InitiatorInvalid_HASH = HashingUtils::CompileTimeHashString("InitiatorInvalid");
+        static constexpr int InitiatorNotFound_HASH = HashingUtils::CompileTimeHashString("InitiatorNotFound");
+        static constexpr int InternalError_HASH = HashingUtils::CompileTimeHashString("InternalError");
+        static constexpr int InvalidGateway_HASH = HashingUtils::CompileTimeHashString("InvalidGateway");
+        static constexpr int InvalidEndpoint_HASH = HashingUtils::CompileTimeHashString("InvalidEndpoint");
+        static constexpr int InvalidParameters_HASH = HashingUtils::CompileTimeHashString("InvalidParameters");
+        static constexpr int InvalidSchedule_HASH = HashingUtils::CompileTimeHashString("InvalidSchedule");
+        static constexpr int LocalStorageLimitExceeded_HASH = HashingUtils::CompileTimeHashString("LocalStorageLimitExceeded");
+        static constexpr int LunAlreadyAllocated_HASH = HashingUtils::CompileTimeHashString("LunAlreadyAllocated ");
+        static constexpr int LunInvalid_HASH = HashingUtils::CompileTimeHashString("LunInvalid");
+        static constexpr int MaximumContentLengthExceeded_HASH = HashingUtils::CompileTimeHashString("MaximumContentLengthExceeded");
+        static constexpr int MaximumTapeCartridgeCountExceeded_HASH = HashingUtils::CompileTimeHashString("MaximumTapeCartridgeCountExceeded");
+        static constexpr int MaximumVolumeCountExceeded_HASH = HashingUtils::CompileTimeHashString("MaximumVolumeCountExceeded");
+        static constexpr int NetworkConfigurationChanged_HASH = HashingUtils::CompileTimeHashString("NetworkConfigurationChanged");
+        static constexpr int NoDisksAvailable_HASH = HashingUtils::CompileTimeHashString("NoDisksAvailable");
+        static constexpr int NotImplemented_HASH = HashingUtils::CompileTimeHashString("NotImplemented");
+        static constexpr int NotSupported_HASH = HashingUtils::CompileTimeHashString("NotSupported");
+        static constexpr int OperationAborted_HASH = HashingUtils::CompileTimeHashString("OperationAborted");
+        static constexpr int OutdatedGateway_HASH = HashingUtils::CompileTimeHashString("OutdatedGateway");
+        static constexpr int ParametersNotImplemented_HASH = HashingUtils::CompileTimeHashString("ParametersNotImplemented");
+        static constexpr int RegionInvalid_HASH = HashingUtils::CompileTimeHashString("RegionInvalid");
+        static constexpr int RequestTimeout_HASH = HashingUtils::CompileTimeHashString("RequestTimeout");
+        static constexpr int ServiceUnavailable_HASH = HashingUtils::CompileTimeHashString("ServiceUnavailable");
+        static constexpr int SnapshotDeleted_HASH = HashingUtils::CompileTimeHashString("SnapshotDeleted");
+        static constexpr int SnapshotIdInvalid_HASH = HashingUtils::CompileTimeHashString("SnapshotIdInvalid");
+        static constexpr int SnapshotInProgress_HASH = HashingUtils::CompileTimeHashString("SnapshotInProgress");
+        static constexpr int SnapshotNotFound_HASH = HashingUtils::CompileTimeHashString("SnapshotNotFound");
+        static constexpr int SnapshotScheduleNotFound_HASH = HashingUtils::CompileTimeHashString("SnapshotScheduleNotFound");
+        static constexpr int StagingAreaFull_HASH = HashingUtils::CompileTimeHashString("StagingAreaFull");
+        static constexpr int StorageFailure_HASH = HashingUtils::CompileTimeHashString("StorageFailure");
+        static constexpr int TapeCartridgeNotFound_HASH = HashingUtils::CompileTimeHashString("TapeCartridgeNotFound");
+        static constexpr int TargetAlreadyExists_HASH = HashingUtils::CompileTimeHashString("TargetAlreadyExists");
+        static constexpr int TargetInvalid_HASH = HashingUtils::CompileTimeHashString("TargetInvalid");
+        static constexpr int TargetNotFound_HASH = HashingUtils::CompileTimeHashString("TargetNotFound");
+        static constexpr int UnauthorizedOperation_HASH = HashingUtils::CompileTimeHashString("UnauthorizedOperation");
+        static constexpr int VolumeAlreadyExists_HASH = HashingUtils::CompileTimeHashString("VolumeAlreadyExists");
+        static constexpr int VolumeIdInvalid_HASH = HashingUtils::CompileTimeHashString("VolumeIdInvalid");
+        static constexpr int VolumeInUse_HASH = HashingUtils::CompileTimeHashString("VolumeInUse");
+        static constexpr int VolumeNotFound_HASH = HashingUtils::CompileTimeHashString("VolumeNotFound");
+        static constexpr int VolumeNotReady_HASH = HashingUtils::CompileTimeHashString("VolumeNotReady");
 
 
         ErrorCode GetErrorCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ActivationKeyExpired_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ErrorCode::ActivationKeyExpired;
-          }
-          else if (hashCode == ActivationKeyInvalid_HASH)
-          {
-            return ErrorCode::ActivationKeyInvalid;
-          }
-          else if (hashCode == ActivationKeyNotFound_HASH)
-          {
-            return ErrorCode::ActivationKeyNotFound;
-          }
-          else if (hashCode == GatewayInternalError_HASH)
-          {
-            return ErrorCode::GatewayInternalError;
-          }
-          else if (hashCode == GatewayNotConnected_HASH)
-          {
-            return ErrorCode::GatewayNotConnected;
-          }
-          else if (hashCode == GatewayNotFound_HASH)
-          {
-            return ErrorCode::GatewayNotFound;
-          }
-          else if (hashCode == GatewayProxyNetworkConnectionBusy_HASH)
-          {
-            return ErrorCode::GatewayProxyNetworkConnectionBusy;
-          }
-          else if (hashCode == AuthenticationFailure_HASH)
-          {
-            return ErrorCode::AuthenticationFailure;
-          }
-          else if (hashCode == BandwidthThrottleScheduleNotFound_HASH)
-          {
-            return ErrorCode::BandwidthThrottleScheduleNotFound;
-          }
-          else if (hashCode == Blocked_HASH)
-          {
-            return ErrorCode::Blocked;
-          }
-          else if (hashCode == CannotExportSnapshot_HASH)
-          {
-            return ErrorCode::CannotExportSnapshot;
-          }
-          else if (hashCode == ChapCredentialNotFound_HASH)
-          {
-            return ErrorCode::ChapCredentialNotFound;
-          }
-          else if (hashCode == DiskAlreadyAllocated_HASH)
-          {
-            return ErrorCode::DiskAlreadyAllocated;
-          }
-          else if (hashCode == DiskDoesNotExist_HASH)
-          {
-            return ErrorCode::DiskDoesNotExist;
-          }
-          else if (hashCode == DiskSizeGreaterThanVolumeMaxSize_HASH)
-          {
-            return ErrorCode::DiskSizeGreaterThanVolumeMaxSize;
-          }
-          else if (hashCode == DiskSizeLessThanVolumeSize_HASH)
-          {
-            return ErrorCode::DiskSizeLessThanVolumeSize;
-          }
-          else if (hashCode == DiskSizeNotGigAligned_HASH)
-          {
-            return ErrorCode::DiskSizeNotGigAligned;
-          }
-          else if (hashCode == DuplicateCertificateInfo_HASH)
-          {
-            return ErrorCode::DuplicateCertificateInfo;
-          }
-          else if (hashCode == DuplicateSchedule_HASH)
-          {
-            return ErrorCode::DuplicateSchedule;
-          }
-          else if (hashCode == EndpointNotFound_HASH)
-          {
-            return ErrorCode::EndpointNotFound;
-          }
-          else if (hashCode == IAMNotSupported_HASH)
-          {
-            return ErrorCode::IAMNotSupported;
-          }
-          else if (hashCode == InitiatorInvalid_HASH)
-          {
-            return ErrorCode::InitiatorInvalid;
-          }
-          else if (hashCode == InitiatorNotFound_HASH)
-          {
-            return ErrorCode::InitiatorNotFound;
-          }
-          else if (hashCode == InternalError_HASH)
-          {
-            return ErrorCode::InternalError;
-          }
-          else if (hashCode == InvalidGateway_HASH)
-          {
-            return ErrorCode::InvalidGateway;
-          }
-          else if (hashCode == InvalidEndpoint_HASH)
-          {
-            return ErrorCode::InvalidEndpoint;
-          }
-          else if (hashCode == InvalidParameters_HASH)
-          {
-            return ErrorCode::InvalidParameters;
-          }
-          else if (hashCode == InvalidSchedule_HASH)
-          {
-            return ErrorCode::InvalidSchedule;
-          }
-          else if (hashCode == LocalStorageLimitExceeded_HASH)
-          {
-            return ErrorCode::LocalStorageLimitExceeded;
-          }
-          else if (hashCode == LunAlreadyAllocated_HASH)
-          {
-            return ErrorCode::LunAlreadyAllocated;
-          }
-          else if (hashCode == LunInvalid_HASH)
-          {
-            return ErrorCode::LunInvalid;
-          }
-          else if (hashCode == MaximumContentLengthExceeded_HASH)
-          {
-            return ErrorCode::MaximumContentLengthExceeded;
-          }
-          else if (hashCode == MaximumTapeCartridgeCountExceeded_HASH)
-          {
-            return ErrorCode::MaximumTapeCartridgeCountExceeded;
-          }
-          else if (hashCode == MaximumVolumeCountExceeded_HASH)
-          {
-            return ErrorCode::MaximumVolumeCountExceeded;
-          }
-          else if (hashCode == NetworkConfigurationChanged_HASH)
-          {
-            return ErrorCode::NetworkConfigurationChanged;
-          }
-          else if (hashCode == NoDisksAvailable_HASH)
-          {
-            return ErrorCode::NoDisksAvailable;
-          }
-          else if (hashCode == NotImplemented_HASH)
-          {
-            return ErrorCode::NotImplemented;
-          }
-          else if (hashCode == NotSupported_HASH)
-          {
-            return ErrorCode::NotSupported;
-          }
-          else if (hashCode == OperationAborted_HASH)
-          {
-            return ErrorCode::OperationAborted;
-          }
-          else if (hashCode == OutdatedGateway_HASH)
-          {
-            return ErrorCode::OutdatedGateway;
-          }
-          else if (hashCode == ParametersNotImplemented_HASH)
-          {
-            return ErrorCode::ParametersNotImplemented;
-          }
-          else if (hashCode == RegionInvalid_HASH)
-          {
-            return ErrorCode::RegionInvalid;
-          }
-          else if (hashCode == RequestTimeout_HASH)
-          {
-            return ErrorCode::RequestTimeout;
-          }
-          else if (hashCode == ServiceUnavailable_HASH)
-          {
-            return ErrorCode::ServiceUnavailable;
-          }
-          else if (hashCode == SnapshotDeleted_HASH)
-          {
-            return ErrorCode::SnapshotDeleted;
-          }
-          else if (hashCode == SnapshotIdInvalid_HASH)
-          {
-            return ErrorCode::SnapshotIdInvalid;
-          }
-          else if (hashCode == SnapshotInProgress_HASH)
-          {
-            return ErrorCode::SnapshotInProgress;
-          }
-          else if (hashCode == SnapshotNotFound_HASH)
-          {
-            return ErrorCode::SnapshotNotFound;
-          }
-          else if (hashCode == SnapshotScheduleNotFound_HASH)
-          {
-            return ErrorCode::SnapshotScheduleNotFound;
-          }
-          else if (hashCode == StagingAreaFull_HASH)
-          {
-            return ErrorCode::StagingAreaFull;
-          }
-          else if (hashCode == StorageFailure_HASH)
-          {
-            return ErrorCode::StorageFailure;
-          }
-          else if (hashCode == TapeCartridgeNotFound_HASH)
-          {
-            return ErrorCode::TapeCartridgeNotFound;
-          }
-          else if (hashCode == TargetAlreadyExists_HASH)
-          {
-            return ErrorCode::TargetAlreadyExists;
-          }
-          else if (hashCode == TargetInvalid_HASH)
-          {
-            return ErrorCode::TargetInvalid;
-          }
-          else if (hashCode == TargetNotFound_HASH)
-          {
-            return ErrorCode::TargetNotFound;
-          }
-          else if (hashCode == UnauthorizedOperation_HASH)
-          {
-            return ErrorCode::UnauthorizedOperation;
-          }
-          else if (hashCode == VolumeAlreadyExists_HASH)
-          {
-            return ErrorCode::VolumeAlreadyExists;
-          }
-          else if (hashCode == VolumeIdInvalid_HASH)
-          {
-            return ErrorCode::VolumeIdInvalid;
-          }
-          else if (hashCode == VolumeInUse_HASH)
-          {
-            return ErrorCode::VolumeInUse;
-          }
-          else if (hashCode == VolumeNotFound_HASH)
-          {
-            return ErrorCode::VolumeNotFound;
-          }
-          else if (hashCode == VolumeNotReady_HASH)
-          {
-            return ErrorCode::VolumeNotReady;
+          case ActivationKeyExpired_HASH:
+            if (name == "ActivationKeyExpired")
+            {
+              return ErrorCode::ActivationKeyExpired;
+            }
+            break;
+          case ActivationKeyInvalid_HASH:
+            if (name == "ActivationKeyInvalid")
+            {
+              return ErrorCode::ActivationKeyInvalid;
+            }
+            break;
+          case ActivationKeyNotFound_HASH:
+            if (name == "ActivationKeyNotFound")
+            {
+              return ErrorCode::ActivationKeyNotFound;
+            }
+            break;
+          case GatewayInternalError_HASH:
+            if (name == "GatewayInternalError")
+            {
+              return ErrorCode::GatewayInternalError;
+            }
+            break;
+          case GatewayNotConnected_HASH:
+            if (name == "GatewayNotConnected")
+            {
+              return ErrorCode::GatewayNotConnected;
+            }
+            break;
+          case GatewayNotFound_HASH:
+            if (name == "GatewayNotFound")
+            {
+              return ErrorCode::GatewayNotFound;
+            }
+            break;
+          case GatewayProxyNetworkConnectionBusy_HASH:
+            if (name == "GatewayProxyNetworkConnectionBusy")
+            {
+              return ErrorCode::GatewayProxyNetworkConnectionBusy;
+            }
+            break;
+          case AuthenticationFailure_HASH:
+            if (name == "AuthenticationFailure")
+            {
+              return ErrorCode::AuthenticationFailure;
+            }
+            break;
+          case BandwidthThrottleScheduleNotFound_HASH:
+            if (name == "BandwidthThrottleScheduleNotFound")
+            {
+              return ErrorCode::BandwidthThrottleScheduleNotFound;
+            }
+            break;
+          case Blocked_HASH:
+            if (name == "Blocked")
+            {
+              return ErrorCode::Blocked;
+            }
+            break;
+          case CannotExportSnapshot_HASH:
+            if (name == "CannotExportSnapshot")
+            {
+              return ErrorCode::CannotExportSnapshot;
+            }
+            break;
+          case ChapCredentialNotFound_HASH:
+            if (name == "ChapCredentialNotFound")
+            {
+              return ErrorCode::ChapCredentialNotFound;
+            }
+            break;
+          case DiskAlreadyAllocated_HASH:
+            if (name == "DiskAlreadyAllocated")
+            {
+              return ErrorCode::DiskAlreadyAllocated;
+            }
+            break;
+          case DiskDoesNotExist_HASH:
+            if (name == "DiskDoesNotExist")
+            {
+              return ErrorCode::DiskDoesNotExist;
+            }
+            break;
+          case DiskSizeGreaterThanVolumeMaxSize_HASH:
+            if (name == "DiskSizeGreaterThanVolumeMaxSize")
+            {
+              return ErrorCode::DiskSizeGreaterThanVolumeMaxSize;
+            }
+            break;
+          case DiskSizeLessThanVolumeSize_HASH:
+            if (name == "DiskSizeLessThanVolumeSize")
+            {
+              return ErrorCode::DiskSizeLessThanVolumeSize;
+            }
+            break;
+          case DiskSizeNotGigAligned_HASH:
+            if (name == "DiskSizeNotGigAligned")
+            {
+              return ErrorCode::DiskSizeNotGigAligned;
+            }
+            break;
+          case DuplicateCertificateInfo_HASH:
+            if (name == "DuplicateCertificateInfo")
+            {
+              return ErrorCode::DuplicateCertificateInfo;
+            }
+            break;
+          case DuplicateSchedule_HASH:
+            if (name == "DuplicateSchedule")
+            {
+              return ErrorCode::DuplicateSchedule;
+            }
+            break;
+          case EndpointNotFound_HASH:
+            if (name == "EndpointNotFound")
+            {
+              return ErrorCode::EndpointNotFound;
+            }
+            break;
+          case IAMNotSupported_HASH:
+            if (name == "IAMNotSupported")
+            {
+              return ErrorCode::IAMNotSupported;
+            }
+            break;
+          case InitiatorInvalid_HASH:
+            if (name == "InitiatorInvalid")
+            {
+              return ErrorCode::InitiatorInvalid;
+            }
+            break;
+          case InitiatorNotFound_HASH:
+            if (name == "InitiatorNotFound")
+            {
+              return ErrorCode::InitiatorNotFound;
+            }
+            break;
+          case InternalError_HASH:
+            if (name == "InternalError")
+            {
+              return ErrorCode::InternalError;
+            }
+            break;
+          case InvalidGateway_HASH:
+            if (name == "InvalidGateway")
+            {
+              return ErrorCode::InvalidGateway;
+            }
+            break;
+          case InvalidEndpoint_HASH:
+            if (name == "InvalidEndpoint")
+            {
+              return ErrorCode::InvalidEndpoint;
+            }
+            break;
+          case InvalidParameters_HASH:
+            if (name == "InvalidParameters")
+            {
+              return ErrorCode::InvalidParameters;
+            }
+            break;
+          case InvalidSchedule_HASH:
+            if (name == "InvalidSchedule")
+            {
+              return ErrorCode::InvalidSchedule;
+            }
+            break;
+          case LocalStorageLimitExceeded_HASH:
+            if (name == "LocalStorageLimitExceeded")
+            {
+              return ErrorCode::LocalStorageLimitExceeded;
+            }
+            break;
+          case LunAlreadyAllocated_HASH:
+            if (name == "LunAlreadyAllocated ")
+            {
+              return ErrorCode::LunAlreadyAllocated;
+            }
+            break;
+          case LunInvalid_HASH:
+            if (name == "LunInvalid")
+            {
+              return ErrorCode::LunInvalid;
+            }
+            break;
+          case MaximumContentLengthExceeded_HASH:
+            if (name == "MaximumContentLengthExceeded")
+            {
+              return ErrorCode::MaximumContentLengthExceeded;
+            }
+            break;
+          case MaximumTapeCartridgeCountExceeded_HASH:
+            if (name == "MaximumTapeCartridgeCountExceeded")
+            {
+              return ErrorCode::MaximumTapeCartridgeCountExceeded;
+            }
+            break;
+          case MaximumVolumeCountExceeded_HASH:
+            if (name == "MaximumVolumeCountExceeded")
+            {
+              return ErrorCode::MaximumVolumeCountExceeded;
+            }
+            break;
+          case NetworkConfigurationChanged_HASH:
+            if (name == "NetworkConfigurationChanged")
+            {
+              return ErrorCode::NetworkConfigurationChanged;
+            }
+            break;
+          case NoDisksAvailable_HASH:
+            if (name == "NoDisksAvailable")
+            {
+              return ErrorCode::NoDisksAvailable;
+            }
+            break;
+          case NotImplemented_HASH:
+            if (name == "NotImplemented")
+            {
+              return ErrorCode::NotImplemented;
+            }
+            break;
+          case NotSupported_HASH:
+            if (name == "NotSupported")
+            {
+              return ErrorCode::NotSupported;
+            }
+            break;
+          case OperationAborted_HASH:
+            if (name == "OperationAborted")
+            {
+              return ErrorCode::OperationAborted;
+            }
+            break;
+          case OutdatedGateway_HASH:
+            if (name == "OutdatedGateway")
+            {
+              return ErrorCode::OutdatedGateway;
+            }
+            break;
+          case ParametersNotImplemented_HASH:
+            if (name == "ParametersNotImplemented")
+            {
+              return ErrorCode::ParametersNotImplemented;
+            }
+            break;
+          case RegionInvalid_HASH:
+            if (name == "RegionInvalid")
+            {
+              return ErrorCode::RegionInvalid;
+            }
+            break;
+          case RequestTimeout_HASH:
+            if (name == "RequestTimeout")
+            {
+              return ErrorCode::RequestTimeout;
+            }
+            break;
+          case ServiceUnavailable_HASH:
+            if (name == "ServiceUnavailable")
+            {
+              return ErrorCode::ServiceUnavailable;
+            }
+            break;
+          case SnapshotDeleted_HASH:
+            if (name == "SnapshotDeleted")
+            {
+              return ErrorCode::SnapshotDeleted;
+            }
+            break;
+          case SnapshotIdInvalid_HASH:
+            if (name == "SnapshotIdInvalid")
+            {
+              return ErrorCode::SnapshotIdInvalid;
+            }
+            break;
+          case SnapshotInProgress_HASH:
+            if (name == "SnapshotInProgress")
+            {
+              return ErrorCode::SnapshotInProgress;
+            }
+            break;
+          case SnapshotNotFound_HASH:
+            if (name == "SnapshotNotFound")
+            {
+              return ErrorCode::SnapshotNotFound;
+            }
+            break;
+          case SnapshotScheduleNotFound_HASH:
+            if (name == "SnapshotScheduleNotFound")
+            {
+              return ErrorCode::SnapshotScheduleNotFound;
+            }
+            break;
+          case StagingAreaFull_HASH:
+            if (name == "StagingAreaFull")
+            {
+              return ErrorCode::StagingAreaFull;
+            }
+            break;
+          case StorageFailure_HASH:
+            if (name == "StorageFailure")
+            {
+              return ErrorCode::StorageFailure;
+            }
+            break;
+          case TapeCartridgeNotFound_HASH:
+            if (name == "TapeCartridgeNotFound")
+            {
+              return ErrorCode::TapeCartridgeNotFound;
+            }
+            break;
+          case TargetAlreadyExists_HASH:
+            if (name == "TargetAlreadyExists")
+            {
+              return ErrorCode::TargetAlreadyExists;
+            }
+            break;
+          case TargetInvalid_HASH:
+            if (name == "TargetInvalid")
+            {
+              return ErrorCode::TargetInvalid;
+            }
+            break;
+          case TargetNotFound_HASH:
+            if (name == "TargetNotFound")
+            {
+              return ErrorCode::TargetNotFound;
+            }
+            break;
+          case UnauthorizedOperation_HASH:
+            if (name == "UnauthorizedOperation")
+            {
+              return ErrorCode::UnauthorizedOperation;
+            }
+            break;
+          case VolumeAlreadyExists_HASH:
+            if (name == "VolumeAlreadyExists")
+            {
+              return ErrorCode::VolumeAlreadyExists;
+            }
+            break;
+          case VolumeIdInvalid_HASH:
+            if (name == "VolumeIdInvalid")
+            {
+              return ErrorCode::VolumeIdInvalid;
+            }
+            break;
+          case VolumeInUse_HASH:
+            if (name == "VolumeInUse")
+            {
+              return ErrorCode::VolumeInUse;
+            }
+            break;
+          case VolumeNotFound_HASH:
+            if (name == "VolumeNotFound")
+            {
+              return ErrorCode::VolumeNotFound;
+            }
+            break;
+          case VolumeNotReady_HASH:
+            if (name == "VolumeNotReady")
+            {
+              return ErrorCode::VolumeNotReady;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -350,7 +478,7 @@ namespace Aws
           return ErrorCode::NOT_SET;
         }
 
-        Aws::String GetNameForErrorCode(ErrorCode enumValue)
+        const char* GetNameForErrorCode(ErrorCode enumValue)
         {
           switch(enumValue)
           {
@@ -480,7 +608,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace FileShareTypeMapper
       {
 
-        static const int NFS_HASH = HashingUtils::HashString("NFS");
-        static const int SMB_HASH = HashingUtils::HashString("SMB");
+        static constexpr int NFS_HASH = HashingUtils::CompileTimeHashString("NFS");
+        static constexpr int SMB_HASH = HashingUtils::CompileTimeHashString("SMB");
 
 
         FileShareType GetFileShareTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NFS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FileShareType::NFS;
-          }
-          else if (hashCode == SMB_HASH)
-          {
-            return FileShareType::SMB;
+          case NFS_HASH:
+            if (name == "NFS")
+            {
+              return FileShareType::NFS;
+            }
+            break;
+          case SMB_HASH:
+            if (name == "SMB")
+            {
+              return FileShareType::SMB;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FileShareType::NOT_SET;
         }
 
-        Aws::String GetNameForFileShareType(FileShareType enumValue)
+        const char* GetNameForFileShareType(FileShareType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -28,14 +28,14 @@ namespace STS
 namespace STSErrorMapper
 {
 
-static const int I_D_P_REJECTED_CLAIM_HASH = HashingUtils::HashString("IDPRejectedClaim");
-static const int INVALID_IDENTITY_TOKEN_HASH = HashingUtils::HashString("InvalidIdentityToken");
-static const int INVALID_AUTHORIZATION_MESSAGE_HASH = HashingUtils::HashString("InvalidAuthorizationMessageException");
-static const int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::HashString("MalformedPolicyDocument");
-static const int PACKED_POLICY_TOO_LARGE_HASH = HashingUtils::HashString("PackedPolicyTooLarge");
-static const int EXPIRED_TOKEN_HASH = HashingUtils::HashString("ExpiredTokenException");
-static const int I_D_P_COMMUNICATION_ERROR_HASH = HashingUtils::HashString("IDPCommunicationError");
-static const int REGION_DISABLED_HASH = HashingUtils::HashString("RegionDisabledException");
+static constexpr int I_D_P_REJECTED_CLAIM_HASH = HashingUtils::CompileTimeHashString("IDPRejectedClaim");
+static constexpr int INVALID_IDENTITY_TOKEN_HASH = HashingUtils::CompileTimeHashString("InvalidIdentityToken");
+static constexpr int INVALID_AUTHORIZATION_MESSAGE_HASH = HashingUtils::CompileTimeHashString("InvalidAuthorizationMessageException");
+static constexpr int MALFORMED_POLICY_DOCUMENT_HASH = HashingUtils::CompileTimeHashString("MalformedPolicyDocument");
+static constexpr int PACKED_POLICY_TOO_LARGE_HASH = HashingUtils::CompileTimeHashString("PackedPolicyTooLarge");
+static constexpr int EXPIRED_TOKEN_HASH = HashingUtils::CompileTimeHashString("ExpiredTokenException");
+static constexpr int I_D_P_COMMUNICATION_ERROR_HASH = HashingUtils::CompileTimeHashString("IDPCommunicationError");
+static constexpr int REGION_DISABLED_HASH = HashingUtils::CompileTimeHashString("RegionDisabledException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -28,14 +28,14 @@ namespace Support
 namespace SupportErrorMapper
 {
 
-static const int CASE_CREATION_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("CaseCreationLimitExceeded");
-static const int ATTACHMENT_SET_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AttachmentSetSizeLimitExceeded");
-static const int ATTACHMENT_SET_ID_NOT_FOUND_HASH = HashingUtils::HashString("AttachmentSetIdNotFound");
-static const int ATTACHMENT_SET_EXPIRED_HASH = HashingUtils::HashString("AttachmentSetExpired");
-static const int DESCRIBE_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("DescribeAttachmentLimitExceeded");
-static const int ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("AttachmentLimitExceeded");
-static const int CASE_ID_NOT_FOUND_HASH = HashingUtils::HashString("CaseIdNotFound");
-static const int ATTACHMENT_ID_NOT_FOUND_HASH = HashingUtils::HashString("AttachmentIdNotFound");
+static constexpr int CASE_CREATION_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CaseCreationLimitExceeded");
+static constexpr int ATTACHMENT_SET_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AttachmentSetSizeLimitExceeded");
+static constexpr int ATTACHMENT_SET_ID_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("AttachmentSetIdNotFound");
+static constexpr int ATTACHMENT_SET_EXPIRED_HASH = HashingUtils::CompileTimeHashString("AttachmentSetExpired");
+static constexpr int DESCRIBE_ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("DescribeAttachmentLimitExceeded");
+static constexpr int ATTACHMENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("AttachmentLimitExceeded");
+static constexpr int CASE_ID_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("CaseIdNotFound");
+static constexpr int ATTACHMENT_ID_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("AttachmentIdNotFound");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -36,7 +36,8 @@ namespace ActivityTaskTimeoutTypeMapper
 {
 AWS_SWF_API ActivityTaskTimeoutType GetActivityTaskTimeoutTypeForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForActivityTaskTimeoutType(ActivityTaskTimeoutType value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForActivityTaskTimeoutType(ActivityTaskTimeoutType value);
 } // namespace ActivityTaskTimeoutTypeMapper
 } // namespace Model
 } // namespace SWF
@@ -34,7 +34,8 @@ namespace CancelTimerFailedCauseMapper
 {
 AWS_SWF_API CancelTimerFailedCause GetCancelTimerFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForCancelTimerFailedCause(CancelTimerFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForCancelTimerFailedCause(CancelTimerFailedCause value);
 } // namespace CancelTimerFailedCauseMapper
 } // namespace Model
 } // namespace SWF
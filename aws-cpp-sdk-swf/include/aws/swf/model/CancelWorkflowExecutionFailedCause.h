@@ -34,7 +34,8 @@ namespace CancelWorkflowExecutionFailedCauseMapper
 {
 AWS_SWF_API CancelWorkflowExecutionFailedCause GetCancelWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForCancelWorkflowExecutionFailedCause(CancelWorkflowExecutionFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForCancelWorkflowExecutionFailedCause(CancelWorkflowExecutionFailedCause value);
 } // namespace CancelWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -35,7 +35,8 @@ namespace ChildPolicyMapper
 {
 AWS_SWF_API ChildPolicy GetChildPolicyForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForChildPolicy(ChildPolicy value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForChildPolicy(ChildPolicy value);
 } // namespace ChildPolicyMapper
 } // namespace Model
 } // namespace SWF
@@ -38,7 +38,8 @@ namespace CloseStatusMapper
 {
 AWS_SWF_API CloseStatus GetCloseStatusForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForCloseStatus(CloseStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForCloseStatus(CloseStatus value);
 } // namespace CloseStatusMapper
 } // namespace Model
 } // namespace SWF
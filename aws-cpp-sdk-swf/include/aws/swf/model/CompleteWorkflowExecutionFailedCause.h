@@ -34,7 +34,8 @@ namespace CompleteWorkflowExecutionFailedCauseMapper
 {
 AWS_SWF_API CompleteWorkflowExecutionFailedCause GetCompleteWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForCompleteWorkflowExecutionFailedCause(CompleteWorkflowExecutionFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForCompleteWorkflowExecutionFailedCause(CompleteWorkflowExecutionFailedCause value);
 } // namespace CompleteWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
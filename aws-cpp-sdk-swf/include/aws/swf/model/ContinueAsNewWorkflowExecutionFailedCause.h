@@ -41,7 +41,8 @@ namespace ContinueAsNewWorkflowExecutionFailedCauseMapper
 {
 AWS_SWF_API ContinueAsNewWorkflowExecutionFailedCause GetContinueAsNewWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForContinueAsNewWorkflowExecutionFailedCause(ContinueAsNewWorkflowExecutionFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForContinueAsNewWorkflowExecutionFailedCause(ContinueAsNewWorkflowExecutionFailedCause value);
 } // namespace ContinueAsNewWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
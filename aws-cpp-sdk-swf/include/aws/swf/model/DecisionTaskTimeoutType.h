@@ -33,7 +33,8 @@ namespace DecisionTaskTimeoutTypeMapper
 {
 AWS_SWF_API DecisionTaskTimeoutType GetDecisionTaskTimeoutTypeForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForDecisionTaskTimeoutType(DecisionTaskTimeoutType value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForDecisionTaskTimeoutType(DecisionTaskTimeoutType value);
 } // namespace DecisionTaskTimeoutTypeMapper
 } // namespace Model
 } // namespace SWF
@@ -45,7 +45,8 @@ namespace DecisionTypeMapper
 {
 AWS_SWF_API DecisionType GetDecisionTypeForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForDecisionType(DecisionType value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForDecisionType(DecisionType value);
 } // namespace DecisionTypeMapper
 } // namespace Model
 } // namespace SWF
@@ -86,7 +86,8 @@ namespace EventTypeMapper
 {
 AWS_SWF_API EventType GetEventTypeForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForEventType(EventType value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForEventType(EventType value);
 } // namespace EventTypeMapper
 } // namespace Model
 } // namespace SWF
@@ -34,7 +34,8 @@ namespace ExecutionStatusMapper
 {
 AWS_SWF_API ExecutionStatus GetExecutionStatusForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForExecutionStatus(ExecutionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForExecutionStatus(ExecutionStatus value);
 } // namespace ExecutionStatusMapper
 } // namespace Model
 } // namespace SWF
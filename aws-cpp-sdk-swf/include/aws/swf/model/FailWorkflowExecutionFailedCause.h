@@ -34,7 +34,8 @@ namespace FailWorkflowExecutionFailedCauseMapper
 {
 AWS_SWF_API FailWorkflowExecutionFailedCause GetFailWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForFailWorkflowExecutionFailedCause(FailWorkflowExecutionFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForFailWorkflowExecutionFailedCause(FailWorkflowExecutionFailedCause value);
 } // namespace FailWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -33,7 +33,8 @@ namespace LambdaFunctionTimeoutTypeMapper
 {
 AWS_SWF_API LambdaFunctionTimeoutType GetLambdaFunctionTimeoutTypeForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForLambdaFunctionTimeoutType(LambdaFunctionTimeoutType value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForLambdaFunctionTimeoutType(LambdaFunctionTimeoutType value);
 } // namespace LambdaFunctionTimeoutTypeMapper
 } // namespace Model
 } // namespace SWF
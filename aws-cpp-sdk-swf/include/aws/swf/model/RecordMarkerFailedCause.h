@@ -33,7 +33,8 @@ namespace RecordMarkerFailedCauseMapper
 {
 AWS_SWF_API RecordMarkerFailedCause GetRecordMarkerFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForRecordMarkerFailedCause(RecordMarkerFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForRecordMarkerFailedCause(RecordMarkerFailedCause value);
 } // namespace RecordMarkerFailedCauseMapper
 } // namespace Model
 } // namespace SWF
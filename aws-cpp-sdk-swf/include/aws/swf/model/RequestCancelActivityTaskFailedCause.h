@@ -34,7 +34,8 @@ namespace RequestCancelActivityTaskFailedCauseMapper
 {
 AWS_SWF_API RequestCancelActivityTaskFailedCause GetRequestCancelActivityTaskFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForRequestCancelActivityTaskFailedCause(RequestCancelActivityTaskFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForRequestCancelActivityTaskFailedCause(RequestCancelActivityTaskFailedCause value);
 } // namespace RequestCancelActivityTaskFailedCauseMapper
 } // namespace Model
 } // namespace SWF
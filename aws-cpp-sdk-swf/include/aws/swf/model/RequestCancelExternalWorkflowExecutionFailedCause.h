@@ -35,7 +35,8 @@ namespace RequestCancelExternalWorkflowExecutionFailedCauseMapper
 {
 AWS_SWF_API RequestCancelExternalWorkflowExecutionFailedCause GetRequestCancelExternalWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForRequestCancelExternalWorkflowExecutionFailedCause(RequestCancelExternalWorkflowExecutionFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForRequestCancelExternalWorkflowExecutionFailedCause(RequestCancelExternalWorkflowExecutionFailedCause value);
 } // namespace RequestCancelExternalWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -43,7 +43,8 @@ namespace ScheduleActivityTaskFailedCauseMapper
 {
 AWS_SWF_API ScheduleActivityTaskFailedCause GetScheduleActivityTaskFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForScheduleActivityTaskFailedCause(ScheduleActivityTaskFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForScheduleActivityTaskFailedCause(ScheduleActivityTaskFailedCause value);
 } // namespace ScheduleActivityTaskFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -36,7 +36,8 @@ namespace ScheduleLambdaFunctionFailedCauseMapper
 {
 AWS_SWF_API ScheduleLambdaFunctionFailedCause GetScheduleLambdaFunctionFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForScheduleLambdaFunctionFailedCause(ScheduleLambdaFunctionFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForScheduleLambdaFunctionFailedCause(ScheduleLambdaFunctionFailedCause value);
 } // namespace ScheduleLambdaFunctionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -35,7 +35,8 @@ namespace SignalExternalWorkflowExecutionFailedCauseMapper
 {
 AWS_SWF_API SignalExternalWorkflowExecutionFailedCause GetSignalExternalWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForSignalExternalWorkflowExecutionFailedCause(SignalExternalWorkflowExecutionFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForSignalExternalWorkflowExecutionFailedCause(SignalExternalWorkflowExecutionFailedCause value);
 } // namespace SignalExternalWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -43,7 +43,8 @@ namespace StartChildWorkflowExecutionFailedCauseMapper
 {
 AWS_SWF_API StartChildWorkflowExecutionFailedCause GetStartChildWorkflowExecutionFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForStartChildWorkflowExecutionFailedCause(StartChildWorkflowExecutionFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForStartChildWorkflowExecutionFailedCause(StartChildWorkflowExecutionFailedCause value);
 } // namespace StartChildWorkflowExecutionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
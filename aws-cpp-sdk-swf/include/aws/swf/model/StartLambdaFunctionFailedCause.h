@@ -33,7 +33,8 @@ namespace StartLambdaFunctionFailedCauseMapper
 {
 AWS_SWF_API StartLambdaFunctionFailedCause GetStartLambdaFunctionFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForStartLambdaFunctionFailedCause(StartLambdaFunctionFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForStartLambdaFunctionFailedCause(StartLambdaFunctionFailedCause value);
 } // namespace StartLambdaFunctionFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -36,7 +36,8 @@ namespace StartTimerFailedCauseMapper
 {
 AWS_SWF_API StartTimerFailedCause GetStartTimerFailedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForStartTimerFailedCause(StartTimerFailedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForStartTimerFailedCause(StartTimerFailedCause value);
 } // namespace StartTimerFailedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -33,7 +33,8 @@ namespace WorkflowExecutionCancelRequestedCauseMapper
 {
 AWS_SWF_API WorkflowExecutionCancelRequestedCause GetWorkflowExecutionCancelRequestedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForWorkflowExecutionCancelRequestedCause(WorkflowExecutionCancelRequestedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForWorkflowExecutionCancelRequestedCause(WorkflowExecutionCancelRequestedCause value);
 } // namespace WorkflowExecutionCancelRequestedCauseMapper
 } // namespace Model
 } // namespace SWF
@@ -35,7 +35,8 @@ namespace WorkflowExecutionTerminatedCauseMapper
 {
 AWS_SWF_API WorkflowExecutionTerminatedCause GetWorkflowExecutionTerminatedCauseForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForWorkflowExecutionTerminatedCause(WorkflowExecutionTerminatedCause value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForWorkflowExecutionTerminatedCause(WorkflowExecutionTerminatedCause value);
 } // namespace WorkflowExecutionTerminatedCauseMapper
 } // namespace Model
 } // namespace SWF
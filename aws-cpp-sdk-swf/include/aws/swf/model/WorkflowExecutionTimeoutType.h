@@ -33,7 +33,8 @@ namespace WorkflowExecutionTimeoutTypeMapper
 {
 AWS_SWF_API WorkflowExecutionTimeoutType GetWorkflowExecutionTimeoutTypeForName(const Aws::String& name);
 
-AWS_SWF_API Aws::String GetNameForWorkflowExecutionTimeoutType(WorkflowExecutionTimeoutType value);
+// names of values not modeled point into the enum overflow container
+AWS_SWF_API const char* GetNameForWorkflowExecutionTimeoutType(WorkflowExecutionTimeoutType value);
 } // namespace WorkflowExecutionTimeoutTypeMapper
 } // namespace Model
 } // namespace SWF
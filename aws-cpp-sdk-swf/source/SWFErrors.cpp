@@ -28,15 +28,15 @@ namespace SWF
 namespace SWFErrorMapper
 {
 
-static const int DOMAIN_DEPRECATED_FAULT_HASH = HashingUtils::HashString("DomainDeprecatedFault");
-static const int OPERATION_NOT_PERMITTED_FAULT_HASH = HashingUtils::HashString("OperationNotPermittedFault");
-static const int DOMAIN_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("DomainAlreadyExistsFault");
-static const int UNKNOWN_RESOURCE_FAULT_HASH = HashingUtils::HashString("UnknownResourceFault");
-static const int DEFAULT_UNDEFINED_FAULT_HASH = HashingUtils::HashString("DefaultUndefinedFault");
-static const int TYPE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::HashString("TypeAlreadyExistsFault");
-static const int WORKFLOW_EXECUTION_ALREADY_STARTED_FAULT_HASH = HashingUtils::HashString("WorkflowExecutionAlreadyStartedFault");
-static const int TYPE_DEPRECATED_FAULT_HASH = HashingUtils::HashString("TypeDeprecatedFault");
-static const int LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::HashString("LimitExceededFault");
+static constexpr int DOMAIN_DEPRECATED_FAULT_HASH = HashingUtils::CompileTimeHashString("DomainDeprecatedFault");
+static constexpr int OPERATION_NOT_PERMITTED_FAULT_HASH = HashingUtils::CompileTimeHashString("OperationNotPermittedFault");
+static constexpr int DOMAIN_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("DomainAlreadyExistsFault");
+static constexpr int UNKNOWN_RESOURCE_FAULT_HASH = HashingUtils::CompileTimeHashString("UnknownResourceFault");
+static constexpr int DEFAULT_UNDEFINED_FAULT_HASH = HashingUtils::CompileTimeHashString("DefaultUndefinedFault");
+static constexpr int TYPE_ALREADY_EXISTS_FAULT_HASH = HashingUtils::CompileTimeHashString("TypeAlreadyExistsFault");
+static constexpr int WORKFLOW_EXECUTION_ALREADY_STARTED_FAULT_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionAlreadyStartedFault");
+static constexpr int TYPE_DEPRECATED_FAULT_HASH = HashingUtils::CompileTimeHashString("TypeDeprecatedFault");
+static constexpr int LIMIT_EXCEEDED_FAULT_HASH = HashingUtils::CompileTimeHashString("LimitExceededFault");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,30 +30,44 @@ namespace Aws
       namespace ActivityTaskTimeoutTypeMapper
       {
 
-        static const int START_TO_CLOSE_HASH = HashingUtils::HashString("START_TO_CLOSE");
-        static const int SCHEDULE_TO_START_HASH = HashingUtils::HashString("SCHEDULE_TO_START");
-        static const int SCHEDULE_TO_CLOSE_HASH = HashingUtils::HashString("SCHEDULE_TO_CLOSE");
-        static const int HEARTBEAT_HASH = HashingUtils::HashString("HEARTBEAT");
+        static constexpr int START_TO_CLOSE_HASH = HashingUtils::CompileTimeHashString("START_TO_CLOSE");
+        static constexpr int SCHEDULE_TO_START_HASH = HashingUtils::CompileTimeHashString("SCHEDULE_TO_START");
+        static constexpr int SCHEDULE_TO_CLOSE_HASH = HashingUtils::CompileTimeHashString("SCHEDULE_TO_CLOSE");
+        static constexpr int HEARTBEAT_HASH = HashingUtils::CompileTimeHashString("HEARTBEAT");
 
 
         ActivityTaskTimeoutType GetActivityTaskTimeoutTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == START_TO_CLOSE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActivityTaskTimeoutType::START_TO_CLOSE;
-          }
-          else if (hashCode == SCHEDULE_TO_START_HASH)
-          {
-            return ActivityTaskTimeoutType::SCHEDULE_TO_START;
-          }
-          else if (hashCode == SCHEDULE_TO_CLOSE_HASH)
-          {
-            return ActivityTaskTimeoutType::SCHEDULE_TO_CLOSE;
-          }
-          else if (hashCode == HEARTBEAT_HASH)
-          {
-            return ActivityTaskTimeoutType::HEARTBEAT;
+          case START_TO_CLOSE_HASH:
+            if (name == "START_TO_CLOSE")
+            {
+              return ActivityTaskTimeoutType::START_TO_CLOSE;
+            }
+            break;
+          case SCHEDULE_TO_START_HASH:
+            if (name == "SCHEDULE_TO_START")
+            {
+              return ActivityTaskTimeoutType::SCHEDULE_TO_START;
+            }
+            break;
+          case SCHEDULE_TO_CLOSE_HASH:
+            if (name == "SCHEDULE_TO_CLOSE")
+            {
+              return ActivityTaskTimeoutType::SCHEDULE_TO_CLOSE;
+            }
+            break;
+          case HEARTBEAT_HASH:
+            if (name == "HEARTBEAT")
+            {
+              return ActivityTaskTimeoutType::HEARTBEAT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ActivityTaskTimeoutType::NOT_SET;
         }
 
-        Aws::String GetNameForActivityTaskTimeoutType(ActivityTaskTimeoutType enumValue)
+        const char* GetNameForActivityTaskTimeoutType(ActivityTaskTimeoutType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
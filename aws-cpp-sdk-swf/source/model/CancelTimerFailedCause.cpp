@@ -30,20 +30,30 @@ namespace Aws
       namespace CancelTimerFailedCauseMapper
       {
 
-        static const int TIMER_ID_UNKNOWN_HASH = HashingUtils::HashString("TIMER_ID_UNKNOWN");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        static constexpr int TIMER_ID_UNKNOWN_HASH = HashingUtils::CompileTimeHashString("TIMER_ID_UNKNOWN");
+        static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OPERATION_NOT_PERMITTED");
 
 
         CancelTimerFailedCause GetCancelTimerFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TIMER_ID_UNKNOWN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CancelTimerFailedCause::TIMER_ID_UNKNOWN;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
-            return CancelTimerFailedCause::OPERATION_NOT_PERMITTED;
+          case TIMER_ID_UNKNOWN_HASH:
+            if (name == "TIMER_ID_UNKNOWN")
+            {
+              return CancelTimerFailedCause::TIMER_ID_UNKNOWN;
+            }
+            break;
+          case OPERATION_NOT_PERMITTED_HASH:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return CancelTimerFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CancelTimerFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForCancelTimerFailedCause(CancelTimerFailedCause enumValue)
+        const char* GetNameForCancelTimerFailedCause(CancelTimerFailedCause enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
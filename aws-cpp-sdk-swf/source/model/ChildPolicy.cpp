@@ -30,25 +30,37 @@ namespace Aws
       namespace ChildPolicyMapper
       {
 
-        static const int TERMINATE_HASH = HashingUtils::HashString("TERMINATE");
-        static const int REQUEST_CANCEL_HASH = HashingUtils::HashString("REQUEST_CANCEL");
-        static const int ABANDON_HASH = HashingUtils::HashString("ABANDON");
+        static constexpr int TERMINATE_HASH = HashingUtils::CompileTimeHashString("TERMINATE");
+        static constexpr int REQUEST_CANCEL_HASH = HashingUtils::CompileTimeHashString("REQUEST_CANCEL");
+        static constexpr int ABANDON_HASH = HashingUtils::CompileTimeHashString("ABANDON");
 
 
         ChildPolicy GetChildPolicyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TERMINATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChildPolicy::TERMINATE;
-          }
-          else if (hashCode == REQUEST_CANCEL_HASH)
-          {
-            return ChildPolicy::REQUEST_CANCEL;
-          }
-          else if (hashCode == ABANDON_HASH)
-          {
-            return ChildPolicy::ABANDON;
+          case TERMINATE_HASH:
+            if (name == "TERMINATE")
+            {
+              return ChildPolicy::TERMINATE;
+            }
+            break;
+          case REQUEST_CANCEL_HASH:
+            if (name == "REQUEST_CANCEL")
+            {
+              return ChildPolicy::REQUEST_CANCEL;
+            }
+            break;
+          case ABANDON_HASH:
+            if (name == "ABANDON")
+            {
+              return ChildPolicy::ABANDON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ChildPolicy::NOT_SET;
         }
 
-        Aws::String GetNameForChildPolicy(ChildPolicy enumValue)
+        const char* GetNameForChildPolicy(ChildPolicy enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
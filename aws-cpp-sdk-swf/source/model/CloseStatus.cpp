@@ -30,40 +30,58 @@ namespace Aws
       namespace CloseStatusMapper
       {
 
-        static const int COMPLETED_HASH = HashingUtils::HashString("COMPLETED");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
-        static const int CANCELED_HASH = HashingUtils::HashString("CANCELED");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int CONTINUED_AS_NEW_HASH = HashingUtils::HashString("CONTINUED_AS_NEW");
-        static const int TIMED_OUT_HASH = HashingUtils::HashString("TIMED_OUT");
+        static constexpr int COMPLETED_HASH = HashingUtils::CompileTimeHashString("COMPLETED");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
+        static constexpr int CANCELED_HASH = HashingUtils::CompileTimeHashString("CANCELED");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
+        static constexpr int CONTINUED_AS_NEW_HASH = HashingUtils::CompileTimeHashString("CONTINUED_AS_NEW");
+        static constexpr int TIMED_OUT_HASH = HashingUtils::CompileTimeHashString("TIMED_OUT");
 
 
         CloseStatus GetCloseStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == COMPLETED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CloseStatus::COMPLETED;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return CloseStatus::FAILED;
-          }
-          else if (hashCode == CANCELED_HASH)
-          {
-            return CloseStatus::CANCELED;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return CloseStatus::TERMINATED;
-          }
-          else if (hashCode == CONTINUED_AS_NEW_HASH)
-          {
-            return CloseStatus::CONTINUED_AS_NEW;
-          }
-          else if (hashCode == TIMED_OUT_HASH)
-          {
-            return CloseStatus::TIMED_OUT;
+          case COMPLETED_HASH:
+            if (name == "COMPLETED")
+            {
+              return CloseStatus::COMPLETED;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return CloseStatus::FAILED;
+            }
+            break;
+          case CANCELED_HASH:
+            if (name == "CANCELED")
+            {
+              return CloseStatus::CANCELED;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return CloseStatus::TERMINATED;
+            }
+            break;
+          case CONTINUED_AS_NEW_HASH:
+            if (name == "CONTINUED_AS_NEW")
+            {
+              return CloseStatus::CONTINUED_AS_NEW;
+            }
+            break;
+          case TIMED_OUT_HASH:
+            if (name == "TIMED_OUT")
+            {
+              return CloseStatus::TIMED_OUT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return CloseStatus::NOT_SET;
         }
 
-        Aws::String GetNameForCloseStatus(CloseStatus enumValue)
+        const char* GetNameForCloseStatus(CloseStatus enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,55 +30,79 @@ namespace Aws
       namespace ContinueAsNewWorkflowExecutionFailedCauseMapper
       {
 
-        static const int UNHANDLED_DECISION_HASH = HashingUtils::HashString("UNHANDLED_DECISION");
-        static const int WORKFLOW_TYPE_DEPRECATED_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DEPRECATED");
-        static const int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DOES_NOT_EXIST");
-        static const int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_LIST_UNDEFINED");
-        static const int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_CHILD_POLICY_UNDEFINED");
-        static const int CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH = HashingUtils::HashString("CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        static constexpr int UNHANDLED_DECISION_HASH = HashingUtils::CompileTimeHashString("UNHANDLED_DECISION");
+        static constexpr int WORKFLOW_TYPE_DEPRECATED_HASH = HashingUtils::CompileTimeHashString("WORKFLOW_TYPE_DEPRECATED");
+        static constexpr int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("WORKFLOW_TYPE_DOES_NOT_EXIST");
+        static constexpr int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED");
+        static constexpr int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED");
+        static constexpr int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_TASK_LIST_UNDEFINED");
+        static constexpr int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_CHILD_POLICY_UNDEFINED");
+        static constexpr int CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED");
+        static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OPERATION_NOT_PERMITTED");
 
 
         ContinueAsNewWorkflowExecutionFailedCause GetContinueAsNewWorkflowExecutionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNHANDLED_DECISION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ContinueAsNewWorkflowExecutionFailedCause::UNHANDLED_DECISION;
-          }
-          else if (hashCode == WORKFLOW_TYPE_DEPRECATED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
-          }
-          else if (hashCode == WORKFLOW_TYPE_DOES_NOT_EXIST_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_LIST_UNDEFINED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_CHILD_POLICY_UNDEFINED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
-          }
-          else if (hashCode == CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
-            return ContinueAsNewWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+          case UNHANDLED_DECISION_HASH:
+            if (name == "UNHANDLED_DECISION")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::UNHANDLED_DECISION;
+            }
+            break;
+          case WORKFLOW_TYPE_DEPRECATED_HASH:
+            if (name == "WORKFLOW_TYPE_DEPRECATED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
+            }
+            break;
+          case WORKFLOW_TYPE_DOES_NOT_EXIST_HASH:
+            if (name == "WORKFLOW_TYPE_DOES_NOT_EXIST")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
+            }
+            break;
+          case DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
+            if (name == "DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
+            if (name == "DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case DEFAULT_TASK_LIST_UNDEFINED_HASH:
+            if (name == "DEFAULT_TASK_LIST_UNDEFINED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
+            }
+            break;
+          case DEFAULT_CHILD_POLICY_UNDEFINED_HASH:
+            if (name == "DEFAULT_CHILD_POLICY_UNDEFINED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
+            }
+            break;
+          case CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED_HASH:
+            if (name == "CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::CONTINUE_AS_NEW_WORKFLOW_EXECUTION_RATE_EXCEEDED;
+            }
+            break;
+          case OPERATION_NOT_PERMITTED_HASH:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return ContinueAsNewWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -90,7 +114,7 @@ namespace Aws
           return ContinueAsNewWorkflowExecutionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForContinueAsNewWorkflowExecutionFailedCause(ContinueAsNewWorkflowExecutionFailedCause enumValue)
+        const char* GetNameForContinueAsNewWorkflowExecutionFailedCause(ContinueAsNewWorkflowExecutionFailedCause enumValue)
         {
           switch(enumValue)
           {
@@ -116,7 +140,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace DecisionTaskTimeoutTypeMapper
       {
 
-        static const int START_TO_CLOSE_HASH = HashingUtils::HashString("START_TO_CLOSE");
+        static constexpr int START_TO_CLOSE_HASH = HashingUtils::CompileTimeHashString("START_TO_CLOSE");
 
 
         DecisionTaskTimeoutType GetDecisionTaskTimeoutTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == START_TO_CLOSE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DecisionTaskTimeoutType::START_TO_CLOSE;
+          case START_TO_CLOSE_HASH:
+            if (name == "START_TO_CLOSE")
+            {
+              return DecisionTaskTimeoutType::START_TO_CLOSE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return DecisionTaskTimeoutType::NOT_SET;
         }
 
-        Aws::String GetNameForDecisionTaskTimeoutType(DecisionTaskTimeoutType enumValue)
+        const char* GetNameForDecisionTaskTimeoutType(DecisionTaskTimeoutType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
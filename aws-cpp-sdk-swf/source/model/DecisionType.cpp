@@ -30,75 +30,107 @@ namespace Aws
       namespace DecisionTypeMapper
       {
 
-        static const int ScheduleActivityTask_HASH = HashingUtils::HashString("ScheduleActivityTask");
-        static const int RequestCancelActivityTask_HASH = HashingUtils::HashString("RequestCancelActivityTask");
-        static const int CompleteWorkflowExecution_HASH = HashingUtils::HashString("CompleteWorkflowExecution");
-        static const int FailWorkflowExecution_HASH = HashingUtils::HashString("FailWorkflowExecution");
-        static const int CancelWorkflowExecution_HASH = HashingUtils::HashString("CancelWorkflowExecution");
-        static const int ContinueAsNewWorkflowExecution_HASH = HashingUtils::HashString("ContinueAsNewWorkflowExecution");
-        static const int RecordMarker_HASH = HashingUtils::HashString("RecordMarker");
-        static const int StartTimer_HASH = HashingUtils::HashString("StartTimer");
-        static const int CancelTimer_HASH = HashingUtils::HashString("CancelTimer");
-        static const int SignalExternalWorkflowExecution_HASH = HashingUtils::HashString("SignalExternalWorkflowExecution");
-        static const int RequestCancelExternalWorkflowExecution_HASH = HashingUtils::HashString("RequestCancelExternalWorkflowExecution");
-        static const int StartChildWorkflowExecution_HASH = HashingUtils::HashString("StartChildWorkflowExecution");
-        static const int ScheduleLambdaFunction_HASH = HashingUtils::HashString("ScheduleLambdaFunction");
+        static constexpr int ScheduleActivityTask_HASH = HashingUtils::CompileTimeHashString("ScheduleActivityTask");
+        static constexpr int RequestCancelActivityTask_HASH = HashingUtils::CompileTimeHashString("RequestCancelActivityTask");
+        static constexpr int CompleteWorkflowExecution_HASH = HashingUtils::CompileTimeHashString("CompleteWorkflowExecution");
+        static constexpr int FailWorkflowExecution_HASH = HashingUtils::CompileTimeHashString("FailWorkflowExecution");
+        static constexpr int CancelWorkflowExecution_HASH = HashingUtils::CompileTimeHashString("CancelWorkflowExecution");
+        static constexpr int ContinueAsNewWorkflowExecution_HASH = HashingUtils::CompileTimeHashString("ContinueAsNewWorkflowExecution");
+        static constexpr int RecordMarker_HASH = HashingUtils::CompileTimeHashString("RecordMarker");
+        static constexpr int StartTimer_HASH = HashingUtils::CompileTimeHashString("StartTimer");
+        static constexpr int CancelTimer_HASH = HashingUtils::CompileTimeHashString("CancelTimer");
+        static constexpr int SignalExternalWorkflowExecution_HASH = HashingUtils::CompileTimeHashString("SignalExternalWorkflowExecution");
+        static constexpr int RequestCancelExternalWorkflowExecution_HASH = HashingUtils::CompileTimeHashString("RequestCancelExternalWorkflowExecution");
+        static constexpr int StartChildWorkflowExecution_HASH = HashingUtils::CompileTimeHashString("StartChildWorkflowExecution");
+        static constexpr int ScheduleLambdaFunction_HASH = HashingUtils::CompileTimeHashString("ScheduleLambdaFunction");
 
 
         DecisionType GetDecisionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ScheduleActivityTask_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DecisionType::ScheduleActivityTask;
-          }
-          else if (hashCode == RequestCancelActivityTask_HASH)
-          {
-            return DecisionType::RequestCancelActivityTask;
-          }
-          else if (hashCode == CompleteWorkflowExecution_HASH)
-          {
-            return DecisionType::CompleteWorkflowExecution;
-          }
-          else if (hashCode == FailWorkflowExecution_HASH)
-          {
-            return DecisionType::FailWorkflowExecution;
-          }
-          else if (hashCode == CancelWorkflowExecution_HASH)
-          {
-            return DecisionType::CancelWorkflowExecution;
-          }
-          else if (hashCode == ContinueAsNewWorkflowExecution_HASH)
-          {
-            return DecisionType::ContinueAsNewWorkflowExecution;
-          }
-          else if (hashCode == RecordMarker_HASH)
-          {
-            return DecisionType::RecordMarker;
-          }
-          else if (hashCode == StartTimer_HASH)
-          {
-            return DecisionType::StartTimer;
-          }
-          else if (hashCode == CancelTimer_HASH)
-          {
-            return DecisionType::CancelTimer;
-          }
-          else if (hashCode == SignalExternalWorkflowExecution_HASH)
-          {
-            return DecisionType::SignalExternalWorkflowExecution;
-          }
-          else if (hashCode == RequestCancelExternalWorkflowExecution_HASH)
-          {
-            return DecisionType::RequestCancelExternalWorkflowExecution;
-          }
-          else if (hashCode == StartChildWorkflowExecution_HASH)
-          {
-            return DecisionType::StartChildWorkflowExecution;
-          }
-          else if (hashCode == ScheduleLambdaFunction_HASH)
-          {
-            return DecisionType::ScheduleLambdaFunction;
+          case ScheduleActivityTask_HASH:
+            if (name == "ScheduleActivityTask")
+            {
+              return DecisionType::ScheduleActivityTask;
+            }
+            break;
+          case RequestCancelActivityTask_HASH:
+            if (name == "RequestCancelActivityTask")
+            {
+              return DecisionType::RequestCancelActivityTask;
+            }
+            break;
+          case CompleteWorkflowExecution_HASH:
+            if (name == "CompleteWorkflowExecution")
+            {
+              return DecisionType::CompleteWorkflowExecution;
+            }
+            break;
+          case FailWorkflowExecution_HASH:
+            if (name == "FailWorkflowExecution")
+            {
+              return DecisionType::FailWorkflowExecution;
+            }
+            break;
+          case CancelWorkflowExecution_HASH:
+            if (name == "CancelWorkflowExecution")
+            {
+              return DecisionType::CancelWorkflowExecution;
+            }
+            break;
+          case ContinueAsNewWorkflowExecution_HASH:
+            if (name == "ContinueAsNewWorkflowExecution")
+            {
+              return DecisionType::ContinueAsNewWorkflowExecution;
+            }
+            break;
+          case RecordMarker_HASH:
+            if (name == "RecordMarker")
+            {
+              return DecisionType::RecordMarker;
+            }
+            break;
+          case StartTimer_HASH:
+            if (name == "StartTimer")
+            {
+              return DecisionType::StartTimer;
+            }
+            break;
+          case CancelTimer_HASH:
+            if (name == "CancelTimer")
+            {
+              return DecisionType::CancelTimer;
+            }
+            break;
+          case SignalExternalWorkflowExecution_HASH:
+            if (name == "SignalExternalWorkflowExecution")
+            {
+              return DecisionType::SignalExternalWorkflowExecution;
+            }
+            break;
+          case RequestCancelExternalWorkflowExecution_HASH:
+            if (name == "RequestCancelExternalWorkflowExecution")
+            {
+              return DecisionType::RequestCancelExternalWorkflowExecution;
+            }
+            break;
+          case StartChildWorkflowExecution_HASH:
+            if (name == "StartChildWorkflowExecution")
+            {
+              return DecisionType::StartChildWorkflowExecution;
+            }
+            break;
+          case ScheduleLambdaFunction_HASH:
+            if (name == "ScheduleLambdaFunction")
+            {
+              return DecisionType::ScheduleLambdaFunction;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -110,7 +142,7 @@ namespace Aws
           return DecisionType::NOT_SET;
         }
 
-        Aws::String GetNameForDecisionType(DecisionType enumValue)
+        const char* GetNameForDecisionType(DecisionType enumValue)
         {
           switch(enumValue)
           {
@@ -144,7 +176,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,280 +30,394 @@ namespace Aws
       namespace EventTypeMapper
       {
 
-        static const int WorkflowExecutionStarted_HASH = HashingUtils::HashString("WorkflowExecutionStarted");
-        static const int WorkflowExecutionCancelRequested_HASH = HashingUtils::HashString("WorkflowExecutionCancelRequested");
-        static const int WorkflowExecutionCompleted_HASH = HashingUtils::HashString("WorkflowExecutionCompleted");
-        static const int CompleteWorkflowExecutionFailed_HASH = HashingUtils::HashString("CompleteWorkflowExecutionFailed");
-        static const int WorkflowExecutionFailed_HASH = HashingUtils::HashString("WorkflowExecutionFailed");
-        static const int FailWorkflowExecutionFailed_HASH = HashingUtils::HashString("FailWorkflowExecutionFailed");
-        static const int WorkflowExecutionTimedOut_HASH = HashingUtils::HashString("WorkflowExecutionTimedOut");
-        static const int WorkflowExecutionCanceled_HASH = HashingUtils::HashString("WorkflowExecutionCanceled");
-        static const int CancelWorkflowExecutionFailed_HASH = HashingUtils::HashString("CancelWorkflowExecutionFailed");
-        static const int WorkflowExecutionContinuedAsNew_HASH = HashingUtils::HashString("WorkflowExecutionContinuedAsNew");
-        static const int ContinueAsNewWorkflowExecutionFailed_HASH = HashingUtils::HashString("ContinueAsNewWorkflowExecutionFailed");
-        static const int WorkflowExecutionTerminated_HASH = HashingUtils::HashString("WorkflowExecutionTerminated");
-        static const int DecisionTaskScheduled_HASH = HashingUtils::HashString("DecisionTaskScheduled");
-        static const int DecisionTaskStarted_HASH = HashingUtils::HashString("DecisionTaskStarted");
-        static const int DecisionTaskCompleted_HASH = HashingUtils::HashString("DecisionTaskCompleted");
-        static const int DecisionTaskTimedOut_HASH = HashingUtils::HashString("DecisionTaskTimedOut");
-        static const int ActivityTaskScheduled_HASH = HashingUtils::HashString("ActivityTaskScheduled");
-        static const int ScheduleActivityTaskFailed_HASH = HashingUtils::HashString("ScheduleActivityTaskFailed");
-        static const int ActivityTaskStarted_HASH = HashingUtils::HashString("ActivityTaskStarted");
-        static const int ActivityTaskCompleted_HASH = HashingUtils::HashString("ActivityTaskCompleted");
-        static const int ActivityTaskFailed_HASH = HashingUtils::HashString("ActivityTaskFailed");
-        static const int ActivityTaskTimedOut_HASH = HashingUtils::HashString("ActivityTaskTimedOut");
-        static const int ActivityTaskCanceled_HASH = HashingUtils::HashString("ActivityTaskCanceled");
-        static const int ActivityTaskCancelRequested_HASH = HashingUtils::HashString("ActivityTaskCancelRequested");
-        static const int RequestCancelActivityTaskFailed_HASH = HashingUtils::HashString("RequestCancelActivityTaskFailed");
-        static const int WorkflowExecutionSignaled_HASH = HashingUtils::HashString("WorkflowExecutionSignaled");
-        static const int MarkerRecorded_HASH = HashingUtils::HashString("MarkerRecorded");
-        static const int RecordMarkerFailed_HASH = HashingUtils::HashString("RecordMarkerFailed");
-        static const int TimerStarted_HASH = HashingUtils::HashString("TimerStarted");
-        static const int StartTimerFailed_HASH = HashingUtils::HashString("StartTimerFailed");
-        static const int TimerFired_HASH = HashingUtils::HashString("TimerFired");
-        static const int TimerCanceled_HASH = HashingUtils::HashString("TimerCanceled");
-        static const int CancelTimerFailed_HASH = HashingUtils::HashString("CancelTimerFailed");
-        static const int StartChildWorkflowExecutionInitiated_HASH = HashingUtils::HashString("StartChildWorkflowExecutionInitiated");
-        static const int StartChildWorkflowExecutionFailed_HASH = HashingUtils::HashString("StartChildWorkflowExecutionFailed");
-        static const int ChildWorkflowExecutionStarted_HASH = HashingUtils::HashString("ChildWorkflowExecutionStarted");
-        static const int ChildWorkflowExecutionCompleted_HASH = HashingUtils::HashString("ChildWorkflowExecutionCompleted");
-        static const int ChildWorkflowExecutionFailed_HASH = HashingUtils::HashString("ChildWorkflowExecutionFailed");
-        static const int ChildWorkflowExecutionTimedOut_HASH = HashingUtils::HashString("ChildWorkflowExecutionTimedOut");
-        static const int ChildWorkflowExecutionCanceled_HASH = HashingUtils::HashString("ChildWorkflowExecutionCanceled");
-        static const int ChildWorkflowExecutionTerminated_HASH = HashingUtils::HashString("ChildWorkflowExecutionTerminated");
-        static const int SignalExternalWorkflowExecutionInitiated_HASH = HashingUtils::HashString("SignalExternalWorkflowExecutionInitiated");
-        static const int SignalExternalWorkflowExecutionFailed_HASH = HashingUtils::HashString("SignalExternalWorkflowExecutionFailed");
-        static const int ExternalWorkflowExecutionSignaled_HASH = HashingUtils::HashString("ExternalWorkflowExecutionSignaled");
-        static const int RequestCancelExternalWorkflowExecutionInitiated_HASH = HashingUtils::HashString("RequestCancelExternalWorkflowExecutionInitiated");
-        static const int RequestCancelExternalWorkflowExecutionFailed_HASH = HashingUtils::HashString("RequestCancelExternalWorkflowExecutionFailed");
-        static const int ExternalWorkflowExecutionCancelRequested_HASH = HashingUtils::HashString("ExternalWorkflowExecutionCancelRequested");
-        static const int LambdaFunctionScheduled_HASH = HashingUtils::HashString("LambdaFunctionScheduled");
-        static const int LambdaFunctionStarted_HASH = HashingUtils::HashString("LambdaFunctionStarted");
-        static const int LambdaFunctionCompleted_HASH = HashingUtils::HashString("LambdaFunctionCompleted");
-        static const int LambdaFunctionFailed_HASH = HashingUtils::HashString("LambdaFunctionFailed");
-        static const int LambdaFunctionTimedOut_HASH = HashingUtils::HashString("LambdaFunctionTimedOut");
-        static const int ScheduleLambdaFunctionFailed_HASH = HashingUtils::HashString("ScheduleLambdaFunctionFailed");
-        static const int StartLambdaFunctionFailed_HASH = HashingUtils::HashString("StartLambdaFunctionFailed");
+        static constexpr int WorkflowExecutionStarted_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionStarted");
+        static constexpr int WorkflowExecutionCancelRequested_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionCancelRequested");
+        static constexpr int WorkflowExecutionCompleted_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionCompleted");
+        static constexpr int CompleteWorkflowExecutionFailed_HASH = HashingUtils::CompileTimeHashString("CompleteWorkflowExecutionFailed");
+        static constexpr int WorkflowExecutionFailed_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionFailed");
+        static constexpr int FailWorkflowExecutionFailed_HASH = HashingUtils::CompileTimeHashString("FailWorkflowExecutionFailed");
+        static constexpr int WorkflowExecutionTimedOut_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionTimedOut");
+        static constexpr int WorkflowExecutionCanceled_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionCanceled");
+        static constexpr int CancelWorkflowExecutionFailed_HASH = HashingUtils::CompileTimeHashString("CancelWorkflowExecutionFailed");
+        static constexpr int WorkflowExecutionContinuedAsNew_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionContinuedAsNew");
+        static constexpr int ContinueAsNewWorkflowExecutionFailed_HASH = HashingUtils::CompileTimeHashString("ContinueAsNewWorkflowExecutionFailed");
+        static constexpr int WorkflowExecutionTerminated_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionTerminated");
+        static constexpr int DecisionTaskScheduled_HASH = HashingUtils::CompileTimeHashString("DecisionTaskScheduled");
+        static constexpr int DecisionTaskStarted_HASH = HashingUtils::CompileTimeHashString("DecisionTaskStarted");
+        static constexpr int DecisionTaskCompleted_HASH = HashingUtils::CompileTimeHashString("DecisionTaskCompleted");
+        static constexpr int DecisionTaskTimedOut_HASH = HashingUtils::CompileTimeHashString("DecisionTaskTimedOut");
+        static constexpr int ActivityTaskScheduled_HASH = HashingUtils::CompileTimeHashString("ActivityTaskScheduled");
+        static constexpr int ScheduleActivityTaskFailed_HASH = HashingUtils::CompileTimeHashString("ScheduleActivityTaskFailed");
+        static constexpr int ActivityTaskStarted_HASH = HashingUtils::CompileTimeHashString("ActivityTaskStarted");
+        static constexpr int ActivityTaskCompleted_HASH = HashingUtils::CompileTimeHashString("ActivityTaskCompleted");
+        static constexpr int ActivityTaskFailed_HASH = HashingUtils::CompileTimeHashString("ActivityTaskFailed");
+        static constexpr int ActivityTaskTimedOut_HASH = HashingUtils::CompileTimeHashString("ActivityTaskTimedOut");
+        static constexpr int ActivityTaskCanceled_HASH = HashingUtils::CompileTimeHashString("ActivityTaskCanceled");
+        static constexpr int ActivityTaskCancelRequested_HASH = HashingUtils::CompileTimeHashString("ActivityTaskCancelRequested");
+        static constexpr int RequestCancelActivityTaskFailed_HASH = HashingUtils::CompileTimeHashString("RequestCancelActivityTaskFailed");
+        static constexpr int WorkflowExecutionSignaled_HASH = HashingUtils::CompileTimeHashString("WorkflowExecutionSignaled");
+        static constexpr int MarkerRecorded_HASH = HashingUtils::CompileTimeHashString("MarkerRecorded");
+        static constexpr int RecordMarkerFailed_HASH = HashingUtils::CompileTimeHashString("RecordMarkerFailed");
+        static constexpr int TimerStarted_HASH = HashingUtils::CompileTimeHashString("TimerStarted");
+        static constexpr int StartTimerFailed_HASH = HashingUtils::CompileTimeHashString("StartTimerFailed");
+        static constexpr int TimerFired_HASH = HashingUtils::CompileTimeHashString("TimerFired");
+        static constexpr int TimerCanceled_HASH = HashingUtils::CompileTimeHashString("TimerCanceled");
+        static constexpr int CancelTimerFailed_HASH = HashingUtils::CompileTimeHashString("CancelTimerFailed");
+        static constexpr int StartChildWorkflowExecutionInitiated_HASH = HashingUtils::CompileTimeHashString("StartChildWorkflowExecutionInitiated");
+        static constexpr int StartChildWorkflowExecutionFailed_HASH = HashingUtils::CompileTimeHashString("StartChildWorkflowExecutionFailed");
+        static constexpr int ChildWorkflowExecutionStarted_HASH = HashingUtils::CompileTimeHashString("ChildWorkflowExecutionStarted");
+        static constexpr int ChildWorkflowExecutionCompleted_HASH = HashingUtils::CompileTimeHashString("ChildWorkflowExecutionCompleted");
+        static constexpr int ChildWorkflowExecutionFailed_HASH = HashingUtils::CompileTimeHashString("ChildWorkflowExecutionFailed");
+        static constexpr int ChildWorkflowExecutionTimedOut_HASH = HashingUtils::CompileTimeHashString("ChildWorkflowExecutionTimedOut");
+        static constexpr int ChildWorkflowExecutionCanceled_HASH = HashingUtils::CompileTimeHashString("ChildWorkflowExecutionCanceled");
+        static constexpr int ChildWorkflowExecutionTerminated_HASH = HashingUtils::CompileTimeHashString("ChildWorkflowExecutionTerminated");
+        static constexpr int SignalExternalWorkflowExecutionInitiated_HASH = HashingUtils::CompileTimeHashString("SignalExternalWorkflowExecutionInitiated");
+        static constexpr int SignalExternalWorkflowExecutionFailed_HASH = HashingUtils::CompileTimeHashString("SignalExternalWorkflowExecutionFailed");
+        static constexpr int ExternalWorkflowExecutionSignaled_HASH = HashingUtils::CompileTimeHashString("ExternalWorkflowExecutionSignaled");
+        static constexpr int RequestCancelExternalWorkflowExecutionInitiated_HASH = HashingUtils::CompileTimeHashString("RequestCancelExternalWorkflowExecutionInitiated");
+        static constexpr int RequestCancelExternalWorkflowExecutionFailed_HASH = HashingUtils::CompileTimeHashString("RequestCancelExternalWorkflowExecutionFailed");
+        static constexpr int ExternalWorkflowExecutionCancelRequested_HASH = HashingUtils::CompileTimeHashString("ExternalWorkflowExecutionCancelRequested");
+        static constexpr int LambdaFunctionScheduled_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionScheduled");
+        static constexpr int LambdaFunctionStarted_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionStarted");
+        static constexpr int LambdaFunctionCompleted_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionCompleted");
+        static constexpr int LambdaFunctionFailed_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionFailed");
+        static constexpr int LambdaFunctionTimedOut_HASH = HashingUtils::CompileTimeHashString("LambdaFunctionTimedOut");
+        static constexpr int ScheduleLambdaFunctionFailed_HASH = HashingUtils::CompileTimeHashString("ScheduleLambdaFunctionFailed");
+        static constexpr int StartLambdaFunctionFailed_HASH = HashingUtils::CompileTimeHashString("StartLambdaFunctionFailed");
 
 
         EventType GetEventTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WorkflowExecutionStarted_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EventType::WorkflowExecutionStarted;
-          }
-          else if (hashCode == WorkflowExecutionCancelRequested_HASH)
-          {
-            return EventType::WorkflowExecutionCancelRequested;
-          }
-          else if (hashCode == WorkflowExecutionCompleted_HASH)
-          {
-            return EventType::WorkflowExecutionCompleted;
-          }
-          else if (hashCode == CompleteWorkflowExecutionFailed_HASH)
-          {
-            return EventType::CompleteWorkflowExecutionFailed;
-          }
-          else if (hashCode == WorkflowExecutionFailed_HASH)
-          {
-            return EventType::WorkflowExecutionFailed;
-          }
-          else if (hashCode == FailWorkflowExecutionFailed_HASH)
-          {
-            return EventType::FailWorkflowExecutionFailed;
-          }
-          else if (hashCode == WorkflowExecutionTimedOut_HASH)
-          {
-            return EventType::WorkflowExecutionTimedOut;
-          }
-          else if (hashCode == WorkflowExecutionCanceled_HASH)
-          {
-            return EventType::WorkflowExecutionCanceled;
-          }
-          else if (hashCode == CancelWorkflowExecutionFailed_HASH)
-          {
-            return EventType::CancelWorkflowExecutionFailed;
-          }
-          else if (hashCode == WorkflowExecutionContinuedAsNew_HASH)
-          {
-            return EventType::WorkflowExecutionContinuedAsNew;
-          }
-          else if (hashCode == ContinueAsNewWorkflowExecutionFailed_HASH)
-          {
-            return EventType::ContinueAsNewWorkflowExecutionFailed;
-          }
-          else if (hashCode == WorkflowExecutionTerminated_HASH)
-          {
-            return EventType::WorkflowExecutionTerminated;
-          }
-          else if (hashCode == DecisionTaskScheduled_HASH)
-          {
-            return EventType::DecisionTaskScheduled;
-          }
-          else if (hashCode == DecisionTaskStarted_HASH)
-          {
-            return EventType::DecisionTaskStarted;
-          }
-          else if (hashCode == DecisionTaskCompleted_HASH)
-          {
-            return EventType::DecisionTaskCompleted;
-          }
-          else if (hashCode == DecisionTaskTimedOut_HASH)
-          {
-            return EventType::DecisionTaskTimedOut;
-          }
-          else if (hashCode == ActivityTaskScheduled_HASH)
-          {
-            return EventType::ActivityTaskScheduled;
-          }
-          else if (hashCode == ScheduleActivityTaskFailed_HASH)
-          {
-            return EventType::ScheduleActivityTaskFailed;
-          }
-          else if (hashCode == ActivityTaskStarted_HASH)
-          {
-            return EventType::ActivityTaskStarted;
-          }
-          else if (hashCode == ActivityTaskCompleted_HASH)
-          {
-            return EventType::ActivityTaskCompleted;
-          }
-          else if (hashCode == ActivityTaskFailed_HASH)
-          {
-            return EventType::ActivityTaskFailed;
-          }
-          else if (hashCode == ActivityTaskTimedOut_HASH)
-          {
-            return EventType::ActivityTaskTimedOut;
-          }
-          else if (hashCode == ActivityTaskCanceled_HASH)
-          {
-            return EventType::ActivityTaskCanceled;
-          }
-          else if (hashCode == ActivityTaskCancelRequested_HASH)
-          {
-            return EventType::ActivityTaskCancelRequested;
-          }
-          else if (hashCode == RequestCancelActivityTaskFailed_HASH)
-          {
-            return EventType::RequestCancelActivityTaskFailed;
-          }
-          else if (hashCode == WorkflowExecutionSignaled_HASH)
-          {
-            return EventType::WorkflowExecutionSignaled;
-          }
-          else if (hashCode == MarkerRecorded_HASH)
-          {
-            return EventType::MarkerRecorded;
-          }
-          else if (hashCode == RecordMarkerFailed_HASH)
-          {
-            return EventType::RecordMarkerFailed;
-          }
-          else if (hashCode == TimerStarted_HASH)
-          {
-            return EventType::TimerStarted;
-          }
-          else if (hashCode == StartTimerFailed_HASH)
-          {
-            return EventType::StartTimerFailed;
-          }
-          else if (hashCode == TimerFired_HASH)
-          {
-            return EventType::TimerFired;
-          }
-          else if (hashCode == TimerCanceled_HASH)
-          {
-            return EventType::TimerCanceled;
-          }
-          else if (hashCode == CancelTimerFailed_HASH)
-          {
-            return EventType::CancelTimerFailed;
-          }
-          else if (hashCode == StartChildWorkflowExecutionInitiated_HASH)
-          {
-            return EventType::StartChildWorkflowExecutionInitiated;
-          }
-          else if (hashCode == StartChildWorkflowExecutionFailed_HASH)
-          {
-            return EventType::StartChildWorkflowExecutionFailed;
-          }
-          else if (hashCode == ChildWorkflowExecutionStarted_HASH)
-          {
-            return EventType::ChildWorkflowExecutionStarted;
-          }
-          else if (hashCode == ChildWorkflowExecutionCompleted_HASH)
-          {
-            return EventType::ChildWorkflowExecutionCompleted;
-          }
-          else if (hashCode == ChildWorkflowExecutionFailed_HASH)
-          {
-            return EventType::ChildWorkflowExecutionFailed;
-          }
-          else if (hashCode == ChildWorkflowExecutionTimedOut_HASH)
-          {
-            return EventType::ChildWorkflowExecutionTimedOut;
-          }
-          else if (hashCode == ChildWorkflowExecutionCanceled_HASH)
-          {
-            return EventType::ChildWorkflowExecutionCanceled;
-          }
-          else if (hashCode == ChildWorkflowExecutionTerminated_HASH)
-          {
-            return EventType::ChildWorkflowExecutionTerminated;
-          }
-          else if (hashCode == SignalExternalWorkflowExecutionInitiated_HASH)
-          {
-            return EventType::SignalExternalWorkflowExecutionInitiated;
-          }
-          else if (hashCode == SignalExternalWorkflowExecutionFailed_HASH)
-          {
-            return EventType::SignalExternalWorkflowExecutionFailed;
-          }
-          else if (hashCode == ExternalWorkflowExecutionSignaled_HASH)
-          {
-            return EventType::ExternalWorkflowExecutionSignaled;
-          }
-          else if (hashCode == RequestCancelExternalWorkflowExecutionInitiated_HASH)
-          {
-            return EventType::RequestCancelExternalWorkflowExecutionInitiated;
-          }
-          else if (hashCode == RequestCancelExternalWorkflowExecutionFailed_HASH)
-          {
-            return EventType::RequestCancelExternalWorkflowExecutionFailed;
-          }
-          else if (hashCode == ExternalWorkflowExecutionCancelRequested_HASH)
-          {
-            return EventType::ExternalWorkflowExecutionCancelRequested;
-          }
-          else if (hashCode == LambdaFunctionScheduled_HASH)
-          {
-            return EventType::LambdaFunctionScheduled;
-          }
-          else if (hashCode == LambdaFunctionStarted_HASH)
-          {
-            return EventType::LambdaFunctionStarted;
-          }
-          else if (hashCode == LambdaFunctionCompleted_HASH)
-          {
-            return EventType::LambdaFunctionCompleted;
-          }
-          else if (hashCode == LambdaFunctionFailed_HASH)
-          {
-            return EventType::LambdaFunctionFailed;
-          }
-          else if (hashCode == LambdaFunctionTimedOut_HASH)
-          {
-            return EventType::LambdaFunctionTimedOut;
-          }
-          else if (hashCode == ScheduleLambdaFunctionFailed_HASH)
-          {
-            return EventType::ScheduleLambdaFunctionFailed;
-          }
-          else if (hashCode == StartLambdaFunctionFailed_HASH)
-          {
-            return EventType::StartLambdaFunctionFailed;
+          case WorkflowExecutionStarted_HASH:
+            if (name == "WorkflowExecutionStarted")
+            {
+              return EventType::WorkflowExecutionStarted;
+            }
+            break;
+          case WorkflowExecutionCancelRequested_HASH:
+            if (name == "WorkflowExecutionCancelRequested")
+            {
+              return EventType::WorkflowExecutionCancelRequested;
+            }
+            break;
+          case WorkflowExecutionCompleted_HASH:
+            if (name == "WorkflowExecutionCompleted")
+            {
+              return EventType::WorkflowExecutionCompleted;
+            }
+            break;
+          case CompleteWorkflowExecutionFailed_HASH:
+            if (name == "CompleteWorkflowExecutionFailed")
+            {
+              return EventType::CompleteWorkflowExecutionFailed;
+            }
+            break;
+          case WorkflowExecutionFailed_HASH:
+            if (name == "WorkflowExecutionFailed")
+            {
+              return EventType::WorkflowExecutionFailed;
+            }
+            break;
+          case FailWorkflowExecutionFailed_HASH:
+            if (name == "FailWorkflowExecutionFailed")
+            {
+              return EventType::FailWorkflowExecutionFailed;
+            }
+            break;
+          case WorkflowExecutionTimedOut_HASH:
+            if (name == "WorkflowExecutionTimedOut")
+            {
+              return EventType::WorkflowExecutionTimedOut;
+            }
+            break;
+          case WorkflowExecutionCanceled_HASH:
+            if (name == "WorkflowExecutionCanceled")
+            {
+              return EventType::WorkflowExecutionCanceled;
+            }
+            break;
+          case CancelWorkflowExecutionFailed_HASH:
+            if (name == "CancelWorkflowExecutionFailed")
+            {
+              return EventType::CancelWorkflowExecutionFailed;
+            }
+            break;
+          case WorkflowExecutionContinuedAsNew_HASH:
+            if (name == "WorkflowExecutionContinuedAsNew")
+            {
+              return EventType::WorkflowExecutionContinuedAsNew;
+            }
+            break;
+          case ContinueAsNewWorkflowExecutionFailed_HASH:
+            if (name == "ContinueAsNewWorkflowExecutionFailed")
+            {
+              return EventType::ContinueAsNewWorkflowExecutionFailed;
+            }
+            break;
+          case WorkflowExecutionTerminated_HASH:
+            if (name == "WorkflowExecutionTerminated")
+            {
+              return EventType::WorkflowExecutionTerminated;
+            }
+            break;
+          case DecisionTaskScheduled_HASH:
+            if (name == "DecisionTaskScheduled")
+            {
+              return EventType::DecisionTaskScheduled;
+            }
+            break;
+          case DecisionTaskStarted_HASH:
+            if (name == "DecisionTaskStarted")
+            {
+              return EventType::DecisionTaskStarted;
+            }
+            break;
+          case DecisionTaskCompleted_HASH:
+            if (name == "DecisionTaskCompleted")
+            {
+              return EventType::DecisionTaskCompleted;
+            }
+            break;
+          case DecisionTaskTimedOut_HASH:
+            if (name == "DecisionTaskTimedOut")
+            {
+              return EventType::DecisionTaskTimedOut;
+            }
+            break;
+          case ActivityTaskScheduled_HASH:
+            if (name == "ActivityTaskScheduled")
+            {
+              return EventType::ActivityTaskScheduled;
+            }
+            break;
+          case ScheduleActivityTaskFailed_HASH:
+            if (name == "ScheduleActivityTaskFailed")
+            {
+              return EventType::ScheduleActivityTaskFailed;
+            }
+            break;
+          case ActivityTaskStarted_HASH:
+            if (name == "ActivityTaskStarted")
+            {
+              return EventType::ActivityTaskStarted;
+            }
+            break;
+          case ActivityTaskCompleted_HASH:
+            if (name == "ActivityTaskCompleted")
+            {
+              return EventType::ActivityTaskCompleted;
+            }
+            break;
+          case ActivityTaskFailed_HASH:
+            if (name == "ActivityTaskFailed")
+            {
+              return EventType::ActivityTaskFailed;
+            }
+            break;
+          case ActivityTaskTimedOut_HASH:
+            if (name == "ActivityTaskTimedOut")
+            {
+              return EventType::ActivityTaskTimedOut;
+            }
+            break;
+          case ActivityTaskCanceled_HASH:
+            if (name == "ActivityTaskCanceled")
+            {
+              return EventType::ActivityTaskCanceled;
+            }
+            break;
+          case ActivityTaskCancelRequested_HASH:
+            if (name == "ActivityTaskCancelRequested")
+            {
+              return EventType::ActivityTaskCancelRequested;
+            }
+            break;
+          case RequestCancelActivityTaskFailed_HASH:
+            if (name == "RequestCancelActivityTaskFailed")
+            {
+              return EventType::RequestCancelActivityTaskFailed;
+            }
+            break;
+          case WorkflowExecutionSignaled_HASH:
+            if (name == "WorkflowExecutionSignaled")
+            {
+              return EventType::WorkflowExecutionSignaled;
+            }
+            break;
+          case MarkerRecorded_HASH:
+            if (name == "MarkerRecorded")
+            {
+              return EventType::MarkerRecorded;
+            }
+            break;
+          case RecordMarkerFailed_HASH:
+            if (name == "RecordMarkerFailed")
+            {
+              return EventType::RecordMarkerFailed;
+            }
+            break;
+          case TimerStarted_HASH:
+            if (name == "TimerStarted")
+            {
+              return EventType::TimerStarted;
+            }
+            break;
+          case StartTimerFailed_HASH:
+            if (name == "StartTimerFailed")
+            {
+              return EventType::StartTimerFailed;
+            }
+            break;
+          case TimerFired_HASH:
+            if (name == "TimerFired")
+            {
+              return EventType::TimerFired;
+            }
+            break;
+          case TimerCanceled_HASH:
+            if (name == "TimerCanceled")
+            {
+              return EventType::TimerCanceled;
+            }
+            break;
+          case CancelTimerFailed_HASH:
+            if (name == "CancelTimerFailed")
+            {
+              return EventType::CancelTimerFailed;
+            }
+            break;
+          case StartChildWorkflowExecutionInitiated_HASH:
+            if (name == "StartChildWorkflowExecutionInitiated")
+            {
+              return EventType::StartChildWorkflowExecutionInitiated;
+            }
+            break;
+          case StartChildWorkflowExecutionFailed_HASH:
+            if (name == "StartChildWorkflowExecutionFailed")
+            {
+              return EventType::StartChildWorkflowExecutionFailed;
+            }
+            break;
+          case ChildWorkflowExecutionStarted_HASH:
+            if (name == "ChildWorkflowExecutionStarted")
+            {
+              return EventType::ChildWorkflowExecutionStarted;
+            }
+            break;
+          case ChildWorkflowExecutionCompleted_HASH:
+            if (name == "ChildWorkflowExecutionCompleted")
+            {
+              return EventType::ChildWorkflowExecutionCompleted;
+            }
+            break;
+          case ChildWorkflowExecutionFailed_HASH:
+            if (name == "ChildWorkflowExecutionFailed")
+            {
+              return EventType::ChildWorkflowExecutionFailed;
+            }
+            break;
+          case ChildWorkflowExecutionTimedOut_HASH:
+            if (name == "ChildWorkflowExecutionTimedOut")
+            {
+              return EventType::ChildWorkflowExecutionTimedOut;
+            }
+            break;
+          case ChildWorkflowExecutionCanceled_HASH:
+            if (name == "ChildWorkflowExecutionCanceled")
+            {
+              return EventType::ChildWorkflowExecutionCanceled;
+            }
+            break;
+          case ChildWorkflowExecutionTerminated_HASH:
+            if (name == "ChildWorkflowExecutionTerminated")
+            {
+              return EventType::ChildWorkflowExecutionTerminated;
+            }
+            break;
+          case SignalExternalWorkflowExecutionInitiated_HASH:
+            if (name == "SignalExternalWorkflowExecutionInitiated")
+            {
+              return EventType::SignalExternalWorkflowExecutionInitiated;
+            }
+            break;
+          case SignalExternalWorkflowExecutionFailed_HASH:
+            if (name == "SignalExternalWorkflowExecutionFailed")
+            {
+              return EventType::SignalExternalWorkflowExecutionFailed;
+            }
+            break;
+          case ExternalWorkflowExecutionSignaled_HASH:
+            if (name == "ExternalWorkflowExecutionSignaled")
+            {
+              return EventType::ExternalWorkflowExecutionSignaled;
+            }
+            break;
+          case RequestCancelExternalWorkflowExecutionInitiated_HASH:
+            if (name == "RequestCancelExternalWorkflowExecutionInitiated")
+            {
+              return EventType::RequestCancelExternalWorkflowExecutionInitiated;
+            }
+            break;
+          case RequestCancelExternalWorkflowExecutionFailed_HASH:
+            if (name == "RequestCancelExternalWorkflowExecutionFailed")
+            {
+              return EventType::RequestCancelExternalWorkflowExecutionFailed;
+            }
+            break;
+          case ExternalWorkflowExecutionCancelRequested_HASH:
+            if (name == "ExternalWorkflowExecutionCancelRequested")
+            {
+              return EventType::ExternalWorkflowExecutionCancelRequested;
+            }
+            break;
+          case LambdaFunctionScheduled_HASH:
+            if (name == "LambdaFunctionScheduled")
+            {
+              return EventType::LambdaFunctionScheduled;
+            }
+            break;
+          case LambdaFunctionStarted_HASH:
+            if (name == "LambdaFunctionStarted")
+            {
+              return EventType::LambdaFunctionStarted;
+            }
+            break;
+          case LambdaFunctionCompleted_HASH:
+            if (name == "LambdaFunctionCompleted")
+            {
+              return EventType::LambdaFunctionCompleted;
+            }
+            break;
+          case LambdaFunctionFailed_HASH:
+            if (name == "LambdaFunctionFailed")
+            {
+              return EventType::LambdaFunctionFailed;
+            }
+            break;
+          case LambdaFunctionTimedOut_HASH:
+            if (name == "LambdaFunctionTimedOut")
+            {
+              return EventType::LambdaFunctionTimedOut;
+            }
+            break;
+          case ScheduleLambdaFunctionFailed_HASH:
+            if (name == "ScheduleLambdaFunctionFailed")
+            {
+              return EventType::ScheduleLambdaFunctionFailed;
+            }
+            break;
+          case StartLambdaFunctionFailed_HASH:
+            if (name == "StartLambdaFunctionFailed")
+            {
+              return EventType::StartLambdaFunctionFailed;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -315,7 +429,7 @@ namespace Aws
           return EventType::NOT_SET;
         }
 
-        Aws::String GetNameForEventType(EventType enumValue)
+        const char* GetNameForEventType(EventType enumValue)
         {
           switch(enumValue)
           {
@@ -431,7 +545,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ExecutionStatusMapper
       {
 
-        static const int OPEN_HASH = HashingUtils::HashString("OPEN");
-        static const int CLOSED_HASH = HashingUtils::HashString("CLOSED");
+        static constexpr int OPEN_HASH = HashingUtils::CompileTimeHashString("OPEN");
+        static constexpr int CLOSED_HASH = HashingUtils::CompileTimeHashString("CLOSED");
 
 
         ExecutionStatus GetExecutionStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == OPEN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ExecutionStatus::OPEN;
-          }
-          else if (hashCode == CLOSED_HASH)
-          {
-            return ExecutionStatus::CLOSED;
+          case OPEN_HASH:
+            if (name == "OPEN")
+            {
+              return ExecutionStatus::OPEN;
+            }
+            break;
+          case CLOSED_HASH:
+            if (name == "CLOSED")
+            {
+              return ExecutionStatus::CLOSED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ExecutionStatus::NOT_SET;
         }
 
-        Aws::String GetNameForExecutionStatus(ExecutionStatus enumValue)
+        const char* GetNameForExecutionStatus(ExecutionStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace FailWorkflowExecutionFailedCauseMapper
       {
 
-        static const int UNHANDLED_DECISION_HASH = HashingUtils::HashString("UNHANDLED_DECISION");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        static constexpr int UNHANDLED_DECISION_HASH = HashingUtils::CompileTimeHashString("UNHANDLED_DECISION");
+        static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OPERATION_NOT_PERMITTED");
 
 
         FailWorkflowExecutionFailedCause GetFailWorkflowExecutionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNHANDLED_DECISION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FailWorkflowExecutionFailedCause::UNHANDLED_DECISION;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
-            return FailWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+          case UNHANDLED_DECISION_HASH:
+            if (name == "UNHANDLED_DECISION")
+            {
+              return FailWorkflowExecutionFailedCause::UNHANDLED_DECISION;
+            }
+            break;
+          case OPERATION_NOT_PERMITTED_HASH:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return FailWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return FailWorkflowExecutionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForFailWorkflowExecutionFailedCause(FailWorkflowExecutionFailedCause enumValue)
+        const char* GetNameForFailWorkflowExecutionFailedCause(FailWorkflowExecutionFailedCause enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace RegistrationStatusMapper
       {
 
-        static const int REGISTERED_HASH = HashingUtils::HashString("REGISTERED");
-        static const int DEPRECATED_HASH = HashingUtils::HashString("DEPRECATED");
+        static constexpr int REGISTERED_HASH = HashingUtils::CompileTimeHashString("REGISTERED");
+        static constexpr int DEPRECATED_HASH = HashingUtils::CompileTimeHashString("DEPRECATED");
 
 
         RegistrationStatus GetRegistrationStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGISTERED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RegistrationStatus::REGISTERED;
-          }
-          else if (hashCode == DEPRECATED_HASH)
-          {
-            return RegistrationStatus::DEPRECATED;
+          case REGISTERED_HASH:
+            if (name == "REGISTERED")
+            {
+              return RegistrationStatus::REGISTERED;
+            }
+            break;
+          case DEPRECATED_HASH:
+            if (name == "DEPRECATED")
+            {
+              return RegistrationStatus::DEPRECATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RegistrationStatus::NOT_SET;
         }
 
-        Aws::String GetNameForRegistrationStatus(RegistrationStatus enumValue)
+        const char* GetNameForRegistrationStatus(RegistrationStatus enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
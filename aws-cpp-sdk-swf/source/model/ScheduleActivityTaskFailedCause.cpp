@@ -30,65 +30,93 @@ namespace Aws
       namespace ScheduleActivityTaskFailedCauseMapper
       {
 
-        static const int ACTIVITY_TYPE_DEPRECATED_HASH = HashingUtils::HashString("ACTIVITY_TYPE_DEPRECATED");
-        static const int ACTIVITY_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("ACTIVITY_TYPE_DOES_NOT_EXIST");
-        static const int ACTIVITY_ID_ALREADY_IN_USE_HASH = HashingUtils::HashString("ACTIVITY_ID_ALREADY_IN_USE");
-        static const int OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_ACTIVITIES_LIMIT_EXCEEDED");
-        static const int ACTIVITY_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("ACTIVITY_CREATION_RATE_EXCEEDED");
-        static const int DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_LIST_UNDEFINED");
-        static const int DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        static constexpr int ACTIVITY_TYPE_DEPRECATED_HASH = HashingUtils::CompileTimeHashString("ACTIVITY_TYPE_DEPRECATED");
+        static constexpr int ACTIVITY_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("ACTIVITY_TYPE_DOES_NOT_EXIST");
+        static constexpr int ACTIVITY_ID_ALREADY_IN_USE_HASH = HashingUtils::CompileTimeHashString("ACTIVITY_ID_ALREADY_IN_USE");
+        static constexpr int OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("OPEN_ACTIVITIES_LIMIT_EXCEEDED");
+        static constexpr int ACTIVITY_CREATION_RATE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ACTIVITY_CREATION_RATE_EXCEEDED");
+        static constexpr int DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED");
+        static constexpr int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_TASK_LIST_UNDEFINED");
+        static constexpr int DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED");
+        static constexpr int DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED");
+        static constexpr int DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED");
+        static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OPERATION_NOT_PERMITTED");
 
 
         ScheduleActivityTaskFailedCause GetScheduleActivityTaskFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVITY_TYPE_DEPRECATED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DEPRECATED;
-          }
-          else if (hashCode == ACTIVITY_TYPE_DOES_NOT_EXIST_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == ACTIVITY_ID_ALREADY_IN_USE_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::ACTIVITY_ID_ALREADY_IN_USE;
-          }
-          else if (hashCode == OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::OPEN_ACTIVITIES_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == ACTIVITY_CREATION_RATE_EXCEEDED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::ACTIVITY_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_LIST_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
-            return ScheduleActivityTaskFailedCause::OPERATION_NOT_PERMITTED;
+          case ACTIVITY_TYPE_DEPRECATED_HASH:
+            if (name == "ACTIVITY_TYPE_DEPRECATED")
+            {
+              return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DEPRECATED;
+            }
+            break;
+          case ACTIVITY_TYPE_DOES_NOT_EXIST_HASH:
+            if (name == "ACTIVITY_TYPE_DOES_NOT_EXIST")
+            {
+              return ScheduleActivityTaskFailedCause::ACTIVITY_TYPE_DOES_NOT_EXIST;
+            }
+            break;
+          case ACTIVITY_ID_ALREADY_IN_USE_HASH:
+            if (name == "ACTIVITY_ID_ALREADY_IN_USE")
+            {
+              return ScheduleActivityTaskFailedCause::ACTIVITY_ID_ALREADY_IN_USE;
+            }
+            break;
+          case OPEN_ACTIVITIES_LIMIT_EXCEEDED_HASH:
+            if (name == "OPEN_ACTIVITIES_LIMIT_EXCEEDED")
+            {
+              return ScheduleActivityTaskFailedCause::OPEN_ACTIVITIES_LIMIT_EXCEEDED;
+            }
+            break;
+          case ACTIVITY_CREATION_RATE_EXCEEDED_HASH:
+            if (name == "ACTIVITY_CREATION_RATE_EXCEEDED")
+            {
+              return ScheduleActivityTaskFailedCause::ACTIVITY_CREATION_RATE_EXCEEDED;
+            }
+            break;
+          case DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
+            if (name == "DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case DEFAULT_TASK_LIST_UNDEFINED_HASH:
+            if (name == "DEFAULT_TASK_LIST_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
+            }
+            break;
+          case DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED_HASH:
+            if (name == "DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_SCHEDULE_TO_START_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
+            if (name == "DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED_HASH:
+            if (name == "DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED")
+            {
+              return ScheduleActivityTaskFailedCause::DEFAULT_HEARTBEAT_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case OPERATION_NOT_PERMITTED_HASH:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return ScheduleActivityTaskFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return ScheduleActivityTaskFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForScheduleActivityTaskFailedCause(ScheduleActivityTaskFailedCause enumValue)
+        const char* GetNameForScheduleActivityTaskFailedCause(ScheduleActivityTaskFailedCause enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace ScheduleLambdaFunctionFailedCauseMapper
       {
 
-        static const int ID_ALREADY_IN_USE_HASH = HashingUtils::HashString("ID_ALREADY_IN_USE");
-        static const int OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED");
-        static const int LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED");
-        static const int LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH = HashingUtils::HashString("LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION");
+        static constexpr int ID_ALREADY_IN_USE_HASH = HashingUtils::CompileTimeHashString("ID_ALREADY_IN_USE");
+        static constexpr int OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED");
+        static constexpr int LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED");
+        static constexpr int LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH = HashingUtils::CompileTimeHashString("LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION");
 
 
         ScheduleLambdaFunctionFailedCause GetScheduleLambdaFunctionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ID_ALREADY_IN_USE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ScheduleLambdaFunctionFailedCause::ID_ALREADY_IN_USE;
-          }
-          else if (hashCode == OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH)
-          {
-            return ScheduleLambdaFunctionFailedCause::OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH)
-          {
-            return ScheduleLambdaFunctionFailedCause::LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH)
-          {
-            return ScheduleLambdaFunctionFailedCause::LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION;
+          case ID_ALREADY_IN_USE_HASH:
+            if (name == "ID_ALREADY_IN_USE")
+            {
+              return ScheduleLambdaFunctionFailedCause::ID_ALREADY_IN_USE;
+            }
+            break;
+          case OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED_HASH:
+            if (name == "OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED")
+            {
+              return ScheduleLambdaFunctionFailedCause::OPEN_LAMBDA_FUNCTIONS_LIMIT_EXCEEDED;
+            }
+            break;
+          case LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED_HASH:
+            if (name == "LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED")
+            {
+              return ScheduleLambdaFunctionFailedCause::LAMBDA_FUNCTION_CREATION_RATE_EXCEEDED;
+            }
+            break;
+          case LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION_HASH:
+            if (name == "LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION")
+            {
+              return ScheduleLambdaFunctionFailedCause::LAMBDA_SERVICE_NOT_AVAILABLE_IN_REGION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ScheduleLambdaFunctionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForScheduleLambdaFunctionFailedCause(ScheduleLambdaFunctionFailedCause enumValue)
+        const char* GetNameForScheduleLambdaFunctionFailedCause(ScheduleLambdaFunctionFailedCause enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,65 +30,93 @@ namespace Aws
       namespace StartChildWorkflowExecutionFailedCauseMapper
       {
 
-        static const int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DOES_NOT_EXIST");
-        static const int WORKFLOW_TYPE_DEPRECATED_HASH = HashingUtils::HashString("WORKFLOW_TYPE_DEPRECATED");
-        static const int OPEN_CHILDREN_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_CHILDREN_LIMIT_EXCEEDED");
-        static const int OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_WORKFLOWS_LIMIT_EXCEEDED");
-        static const int CHILD_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("CHILD_CREATION_RATE_EXCEEDED");
-        static const int WORKFLOW_ALREADY_RUNNING_HASH = HashingUtils::HashString("WORKFLOW_ALREADY_RUNNING");
-        static const int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_LIST_UNDEFINED");
-        static const int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED");
-        static const int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = HashingUtils::HashString("DEFAULT_CHILD_POLICY_UNDEFINED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        static constexpr int WORKFLOW_TYPE_DOES_NOT_EXIST_HASH = HashingUtils::CompileTimeHashString("WORKFLOW_TYPE_DOES_NOT_EXIST");
+        static constexpr int WORKFLOW_TYPE_DEPRECATED_HASH = HashingUtils::CompileTimeHashString("WORKFLOW_TYPE_DEPRECATED");
+        static constexpr int OPEN_CHILDREN_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("OPEN_CHILDREN_LIMIT_EXCEEDED");
+        static constexpr int OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("OPEN_WORKFLOWS_LIMIT_EXCEEDED");
+        static constexpr int CHILD_CREATION_RATE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CHILD_CREATION_RATE_EXCEEDED");
+        static constexpr int WORKFLOW_ALREADY_RUNNING_HASH = HashingUtils::CompileTimeHashString("WORKFLOW_ALREADY_RUNNING");
+        static constexpr int DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED");
+        static constexpr int DEFAULT_TASK_LIST_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_TASK_LIST_UNDEFINED");
+        static constexpr int DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED");
+        static constexpr int DEFAULT_CHILD_POLICY_UNDEFINED_HASH = HashingUtils::CompileTimeHashString("DEFAULT_CHILD_POLICY_UNDEFINED");
+        static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OPERATION_NOT_PERMITTED");
 
 
         StartChildWorkflowExecutionFailedCause GetStartChildWorkflowExecutionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == WORKFLOW_TYPE_DOES_NOT_EXIST_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
-          }
-          else if (hashCode == WORKFLOW_TYPE_DEPRECATED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
-          }
-          else if (hashCode == OPEN_CHILDREN_LIMIT_EXCEEDED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::OPEN_CHILDREN_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::OPEN_WORKFLOWS_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == CHILD_CREATION_RATE_EXCEEDED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::CHILD_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == WORKFLOW_ALREADY_RUNNING_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::WORKFLOW_ALREADY_RUNNING;
-          }
-          else if (hashCode == DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_LIST_UNDEFINED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
-          }
-          else if (hashCode == DEFAULT_CHILD_POLICY_UNDEFINED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
-            return StartChildWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+          case WORKFLOW_TYPE_DOES_NOT_EXIST_HASH:
+            if (name == "WORKFLOW_TYPE_DOES_NOT_EXIST")
+            {
+              return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DOES_NOT_EXIST;
+            }
+            break;
+          case WORKFLOW_TYPE_DEPRECATED_HASH:
+            if (name == "WORKFLOW_TYPE_DEPRECATED")
+            {
+              return StartChildWorkflowExecutionFailedCause::WORKFLOW_TYPE_DEPRECATED;
+            }
+            break;
+          case OPEN_CHILDREN_LIMIT_EXCEEDED_HASH:
+            if (name == "OPEN_CHILDREN_LIMIT_EXCEEDED")
+            {
+              return StartChildWorkflowExecutionFailedCause::OPEN_CHILDREN_LIMIT_EXCEEDED;
+            }
+            break;
+          case OPEN_WORKFLOWS_LIMIT_EXCEEDED_HASH:
+            if (name == "OPEN_WORKFLOWS_LIMIT_EXCEEDED")
+            {
+              return StartChildWorkflowExecutionFailedCause::OPEN_WORKFLOWS_LIMIT_EXCEEDED;
+            }
+            break;
+          case CHILD_CREATION_RATE_EXCEEDED_HASH:
+            if (name == "CHILD_CREATION_RATE_EXCEEDED")
+            {
+              return StartChildWorkflowExecutionFailedCause::CHILD_CREATION_RATE_EXCEEDED;
+            }
+            break;
+          case WORKFLOW_ALREADY_RUNNING_HASH:
+            if (name == "WORKFLOW_ALREADY_RUNNING")
+            {
+              return StartChildWorkflowExecutionFailedCause::WORKFLOW_ALREADY_RUNNING;
+            }
+            break;
+          case DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
+            if (name == "DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return StartChildWorkflowExecutionFailedCause::DEFAULT_EXECUTION_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case DEFAULT_TASK_LIST_UNDEFINED_HASH:
+            if (name == "DEFAULT_TASK_LIST_UNDEFINED")
+            {
+              return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_LIST_UNDEFINED;
+            }
+            break;
+          case DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED_HASH:
+            if (name == "DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED")
+            {
+              return StartChildWorkflowExecutionFailedCause::DEFAULT_TASK_START_TO_CLOSE_TIMEOUT_UNDEFINED;
+            }
+            break;
+          case DEFAULT_CHILD_POLICY_UNDEFINED_HASH:
+            if (name == "DEFAULT_CHILD_POLICY_UNDEFINED")
+            {
+              return StartChildWorkflowExecutionFailedCause::DEFAULT_CHILD_POLICY_UNDEFINED;
+            }
+            break;
+          case OPERATION_NOT_PERMITTED_HASH:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return StartChildWorkflowExecutionFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return StartChildWorkflowExecutionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForStartChildWorkflowExecutionFailedCause(StartChildWorkflowExecutionFailedCause enumValue)
+        const char* GetNameForStartChildWorkflowExecutionFailedCause(StartChildWorkflowExecutionFailedCause enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace StartLambdaFunctionFailedCauseMapper
       {
 
-        static const int ASSUME_ROLE_FAILED_HASH = HashingUtils::HashString("ASSUME_ROLE_FAILED");
+        static constexpr int ASSUME_ROLE_FAILED_HASH = HashingUtils::CompileTimeHashString("ASSUME_ROLE_FAILED");
 
 
         StartLambdaFunctionFailedCause GetStartLambdaFunctionFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ASSUME_ROLE_FAILED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StartLambdaFunctionFailedCause::ASSUME_ROLE_FAILED;
+          case ASSUME_ROLE_FAILED_HASH:
+            if (name == "ASSUME_ROLE_FAILED")
+            {
+              return StartLambdaFunctionFailedCause::ASSUME_ROLE_FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return StartLambdaFunctionFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForStartLambdaFunctionFailedCause(StartLambdaFunctionFailedCause enumValue)
+        const char* GetNameForStartLambdaFunctionFailedCause(StartLambdaFunctionFailedCause enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace StartTimerFailedCauseMapper
       {
 
-        static const int TIMER_ID_ALREADY_IN_USE_HASH = HashingUtils::HashString("TIMER_ID_ALREADY_IN_USE");
-        static const int OPEN_TIMERS_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("OPEN_TIMERS_LIMIT_EXCEEDED");
-        static const int TIMER_CREATION_RATE_EXCEEDED_HASH = HashingUtils::HashString("TIMER_CREATION_RATE_EXCEEDED");
-        static const int OPERATION_NOT_PERMITTED_HASH = HashingUtils::HashString("OPERATION_NOT_PERMITTED");
+        static constexpr int TIMER_ID_ALREADY_IN_USE_HASH = HashingUtils::CompileTimeHashString("TIMER_ID_ALREADY_IN_USE");
+        static constexpr int OPEN_TIMERS_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("OPEN_TIMERS_LIMIT_EXCEEDED");
+        static constexpr int TIMER_CREATION_RATE_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TIMER_CREATION_RATE_EXCEEDED");
+        static constexpr int OPERATION_NOT_PERMITTED_HASH = HashingUtils::CompileTimeHashString("OPERATION_NOT_PERMITTED");
 
 
         StartTimerFailedCause GetStartTimerFailedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TIMER_ID_ALREADY_IN_USE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StartTimerFailedCause::TIMER_ID_ALREADY_IN_USE;
-          }
-          else if (hashCode == OPEN_TIMERS_LIMIT_EXCEEDED_HASH)
-          {
-            return StartTimerFailedCause::OPEN_TIMERS_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == TIMER_CREATION_RATE_EXCEEDED_HASH)
-          {
-            return StartTimerFailedCause::TIMER_CREATION_RATE_EXCEEDED;
-          }
-          else if (hashCode == OPERATION_NOT_PERMITTED_HASH)
-          {
-            return StartTimerFailedCause::OPERATION_NOT_PERMITTED;
+          case TIMER_ID_ALREADY_IN_USE_HASH:
+            if (name == "TIMER_ID_ALREADY_IN_USE")
+            {
+              return StartTimerFailedCause::TIMER_ID_ALREADY_IN_USE;
+            }
+            break;
+          case OPEN_TIMERS_LIMIT_EXCEEDED_HASH:
+            if (name == "OPEN_TIMERS_LIMIT_EXCEEDED")
+            {
+              return StartTimerFailedCause::OPEN_TIMERS_LIMIT_EXCEEDED;
+            }
+            break;
+          case TIMER_CREATION_RATE_EXCEEDED_HASH:
+            if (name == "TIMER_CREATION_RATE_EXCEEDED")
+            {
+              return StartTimerFailedCause::TIMER_CREATION_RATE_EXCEEDED;
+            }
+            break;
+          case OPERATION_NOT_PERMITTED_HASH:
+            if (name == "OPERATION_NOT_PERMITTED")
+            {
+              return StartTimerFailedCause::OPERATION_NOT_PERMITTED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return StartTimerFailedCause::NOT_SET;
         }
 
-        Aws::String GetNameForStartTimerFailedCause(StartTimerFailedCause enumValue)
+        const char* GetNameForStartTimerFailedCause(StartTimerFailedCause enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace WorkflowExecutionCancelRequestedCauseMapper
       {
 
-        static const int CHILD_POLICY_APPLIED_HASH = HashingUtils::HashString("CHILD_POLICY_APPLIED");
+        static constexpr int CHILD_POLICY_APPLIED_HASH = HashingUtils::CompileTimeHashString("CHILD_POLICY_APPLIED");
 
 
         WorkflowExecutionCancelRequestedCause GetWorkflowExecutionCancelRequestedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHILD_POLICY_APPLIED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WorkflowExecutionCancelRequestedCause::CHILD_POLICY_APPLIED;
+          case CHILD_POLICY_APPLIED_HASH:
+            if (name == "CHILD_POLICY_APPLIED")
+            {
+              return WorkflowExecutionCancelRequestedCause::CHILD_POLICY_APPLIED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return WorkflowExecutionCancelRequestedCause::NOT_SET;
         }
 
-        Aws::String GetNameForWorkflowExecutionCancelRequestedCause(WorkflowExecutionCancelRequestedCause enumValue)
+        const char* GetNameForWorkflowExecutionCancelRequestedCause(WorkflowExecutionCancelRequestedCause enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
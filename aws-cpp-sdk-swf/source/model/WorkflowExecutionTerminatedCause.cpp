@@ -30,25 +30,37 @@ namespace Aws
       namespace WorkflowExecutionTerminatedCauseMapper
       {
 
-        static const int CHILD_POLICY_APPLIED_HASH = HashingUtils::HashString("CHILD_POLICY_APPLIED");
-        static const int EVENT_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("EVENT_LIMIT_EXCEEDED");
-        static const int OPERATOR_INITIATED_HASH = HashingUtils::HashString("OPERATOR_INITIATED");
+        static constexpr int CHILD_POLICY_APPLIED_HASH = HashingUtils::CompileTimeHashString("CHILD_POLICY_APPLIED");
+        static constexpr int EVENT_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("EVENT_LIMIT_EXCEEDED");
+        static constexpr int OPERATOR_INITIATED_HASH = HashingUtils::CompileTimeHashString("OPERATOR_INITIATED");
 
 
         WorkflowExecutionTerminatedCause GetWorkflowExecutionTerminatedCauseForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHILD_POLICY_APPLIED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WorkflowExecutionTerminatedCause::CHILD_POLICY_APPLIED;
-          }
-          else if (hashCode == EVENT_LIMIT_EXCEEDED_HASH)
-          {
-            return WorkflowExecutionTerminatedCause::EVENT_LIMIT_EXCEEDED;
-          }
-          else if (hashCode == OPERATOR_INITIATED_HASH)
-          {
-            return WorkflowExecutionTerminatedCause::OPERATOR_INITIATED;
+          case CHILD_POLICY_APPLIED_HASH:
+            if (name == "CHILD_POLICY_APPLIED")
+            {
+              return WorkflowExecutionTerminatedCause::CHILD_POLICY_APPLIED;
+            }
+            break;
+          case EVENT_LIMIT_EXCEEDED_HASH:
+            if (name == "EVENT_LIMIT_EXCEEDED")
+            {
+              return WorkflowExecutionTerminatedCause::EVENT_LIMIT_EXCEEDED;
+            }
+            break;
+          case OPERATOR_INITIATED_HASH:
+            if (name == "OPERATOR_INITIATED")
+            {
+              return WorkflowExecutionTerminatedCause::OPERATOR_INITIATED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return WorkflowExecutionTerminatedCause::NOT_SET;
         }
 
-        Aws::String GetNameForWorkflowExecutionTerminatedCause(WorkflowExecutionTerminatedCause enumValue)
+        const char* GetNameForWorkflowExecutionTerminatedCause(WorkflowExecutionTerminatedCause enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -15,12 +15,17 @@
 
 #include <aws/external/gtest.h>
 #include <aws/text-to-speech/TextToSpeechManager.h>
+#include <aws/text-to-speech/FilePCMOutputDriver.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/polly/model/DescribeVoicesRequest.h>
 #include <aws/polly/model/SynthesizeSpeechRequest.h>
+#include <aws/core/platform/FileSystem.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/threading/Semaphore.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
 #include <aws/core/utils/threading/Executor.h>
+#include <thread>
 using namespace Aws::TextToSpeech;
 using namespace Aws::Polly;
 using namespace Aws::Polly::Model;
@@ -174,6 +179,353 @@ private:
     mutable SynthesizeSpeechRequest m_capturedSynthRequest;
 };
 
+/**
+ * Polly client that delivers the audio through the request's response stream and data received handler in chunks,
+ * the way the http clients do, and records how much audio the driver has been sent after each chunk.
+ * Without chunks, the request's text is returned as the audio.
+ */
+class StreamingMockPollyClient : public PollyClient
+{
+public:
+    StreamingMockPollyClient(const Aws::Client::ClientConfiguration& clientConfig) : PollyClient(Aws::Auth::AWSCredentials("", ""), clientConfig) {}
+
+    SynthesizeSpeechOutcome SynthesizeSpeech(const SynthesizeSpeechRequest& request) const override
+    {
+        Aws::Http::Standard::StandardHttpRequest httpRequest(Aws::Http::URI("http://localhost"), Aws::Http::HttpMethod::HTTP_POST);
+        httpRequest.SetResponseStreamFactory(request.GetResponseStreamFactory());
+        Aws::Http::Standard::StandardHttpResponse httpResponse(httpRequest);
+        httpResponse.AddHeader(Aws::Http::CONTENT_TYPE_HEADER, m_contentType);
+
+        Aws::Vector<Aws::String> chunks = m_chunks;
+        if (chunks.empty())
+        {
+            chunks.push_back(request.GetText());
+        }
+
+        std::lock_guard<std::mutex> locker(m_synthLock);
+        ++m_synthCalls;
+        for (const auto& chunk : chunks)
+        {
+            httpResponse.GetResponseBody().write(chunk.c_str(), static_cast<std::streamsize>(chunk.size()));
+            if (request.GetDataReceivedEventHandler())
+            {
+                request.GetDataReceivedEventHandler()(&httpRequest, &httpResponse, static_cast<long long>(chunk.size()));
+            }
+            m_bytesPlayedAfterChunk.push_back(m_driver->GetBytesWritten());
+        }
+
+        if (m_contentType.find("audio/") != 0)
+        {
+            // an error's body is parsed from the response stream
+            Aws::StringStream errorBody;
+            errorBody << httpResponse.GetResponseBody().rdbuf();
+            m_errorBody = errorBody.str();
+            return Aws::Client::AWSError<PollyErrors>(PollyErrors::THROTTLING, true);
+        }
+
+        Aws::AmazonWebServiceResult<Aws::Utils::Stream::ResponseStream> result(httpResponse.SwapResponseStreamOwnership(), httpResponse.GetHeaders());
+        return SynthesizeSpeechOutcome(SynthesizeSpeechResult(std::move(result)));
+    }
+
+    Aws::String m_contentType = "audio/pcm";
+    Aws::Vector<Aws::String> m_chunks;
+    std::shared_ptr<FilePCMOutputDriver> m_driver;
+    mutable Aws::Vector<size_t> m_bytesPlayedAfterChunk;
+    mutable Aws::String m_errorBody;
+    mutable size_t m_synthCalls = 0;
+    mutable std::mutex m_synthLock;
+};
+
+static Aws::String ReadFileContents(const char* fileName)
+{
+    Aws::IFStream file(fileName, std::ios_base::in | std::ios_base::binary);
+    Aws::StringStream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+static bool SendTextAndWait(const std::shared_ptr<TextToSpeechManager>& manager, const char* text)
+{
+    Aws::Utils::Threading::Semaphore handlerExitSemaphore(0, 1);
+    bool played = false;
+    manager->SendTextToOutputDevice(text, [&](const char*, const SynthesizeSpeechOutcome&, bool sent)
+    {
+        played = sent;
+        handlerExitSemaphore.Release();
+    });
+    handlerExitSemaphore.WaitOne();
+    return played;
+}
+
+TEST(TextToSpeechManagerTests, TestStreamingPlaybackStartsBeforeDownloadFinished)
+{
+    Aws::Client::ClientConfiguration clientConfig;
+    clientConfig.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOC_TAG, 2);
+    auto pollyClient = Aws::MakeShared<StreamingMockPollyClient>(ALLOC_TAG, clientConfig);
+
+    const char* FILE_NAME = "TestStreamingPlayback.pcm";
+    auto driver = Aws::MakeShared<FilePCMOutputDriver>(ALLOC_TAG, FILE_NAME);
+    pollyClient->m_driver = driver;
+
+    Aws::String audio;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        // odd sized chunks, only whole 16 bit samples go to the device
+        Aws::String chunk(1001, static_cast<char>('a' + i));
+        pollyClient->m_chunks.push_back(chunk);
+        audio += chunk;
+    }
+
+    auto driverFactory = Aws::MakeShared<MockPCMDriverFactory>(ALLOC_TAG);
+    driverFactory->AddDriver(driver);
+    auto manager = TextToSpeechManager::Create(pollyClient, driverFactory);
+    auto devices = manager->EnumerateDevices();
+    ASSERT_EQ(1u, devices.size());
+    manager->SetActiveDevice(driver, devices[0].first, devices[0].first.capabilities[0]);
+    manager->SetStreamingPlayback(true, 3000);
+
+    ASSERT_TRUE(SendTextAndWait(manager, "Blah blah blah"));
+
+    // nothing until the jitter buffer filled, then everything received so far
+    ASSERT_EQ(8u, pollyClient->m_bytesPlayedAfterChunk.size());
+    ASSERT_EQ(0u, pollyClient->m_bytesPlayedAfterChunk[1]);
+    ASSERT_EQ(3002u, pollyClient->m_bytesPlayedAfterChunk[2]);
+    ASSERT_EQ(4004u, pollyClient->m_bytesPlayedAfterChunk[3]);
+    ASSERT_EQ(8008u, pollyClient->m_bytesPlayedAfterChunk[7]);
+    ASSERT_EQ(audio.size(), driver->GetBytesWritten());
+    ASSERT_NE(std::chrono::steady_clock::time_point(), driver->GetFirstWriteTime());
+
+    // shorter than the jitter buffer, played once downloaded
+    pollyClient->m_chunks.resize(1);
+    pollyClient->m_bytesPlayedAfterChunk.clear();
+    ASSERT_TRUE(SendTextAndWait(manager, "Blah"));
+    ASSERT_EQ(audio.size(), pollyClient->m_bytesPlayedAfterChunk[0]);
+    ASSERT_EQ(audio.size() + 1001, driver->GetBytesWritten());
+
+    driver = nullptr;
+    pollyClient->m_driver = nullptr;
+    manager = nullptr;
+    driverFactory = nullptr;
+
+    ASSERT_EQ(audio + pollyClient->m_chunks[0], ReadFileContents(FILE_NAME));
+    remove(FILE_NAME);
+    pollyClient = nullptr;
+}
+
+TEST(TextToSpeechManagerTests, TestStreamingPlaybackDoesNotPlayErrors)
+{
+    Aws::Client::ClientConfiguration clientConfig;
+    clientConfig.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOC_TAG, 2);
+    auto pollyClient = Aws::MakeShared<StreamingMockPollyClient>(ALLOC_TAG, clientConfig);
+
+    auto driver = Aws::MakeShared<FilePCMOutputDriver>(ALLOC_TAG);
+    pollyClient->m_driver = driver;
+    pollyClient->m_contentType = "application/json";
+    pollyClient->m_chunks.push_back("{\"message\":");
+    pollyClient->m_chunks.push_back("\"Rate exceeded\"}");
+
+    auto driverFactory = Aws::MakeShared<MockPCMDriverFactory>(ALLOC_TAG);
+    driverFactory->AddDriver(driver);
+    auto manager = TextToSpeechManager::Create(pollyClient, driverFactory);
+    manager->SetStreamingPlayback(true, 0);
+
+    ASSERT_FALSE(SendTextAndWait(manager, "Blah blah blah"));
+    ASSERT_EQ(0u, driver->GetBytesWritten());
+    ASSERT_STREQ("{\"message\":\"Rate exceeded\"}", pollyClient->m_errorBody.c_str());
+    pollyClient = nullptr;
+}
+
+TEST(TextToSpeechManagerTests, TestSpeechCacheEvictsLeastRecentlyUsed)
+{
+    auto a = Aws::MakeShared<ByteBuffer>(ALLOC_TAG, (unsigned char*)"aaaa", 4);
+    auto b = Aws::MakeShared<ByteBuffer>(ALLOC_TAG, (unsigned char*)"bbbb", 4);
+    auto c = Aws::MakeShared<ByteBuffer>(ALLOC_TAG, (unsigned char*)"cccc", 4);
+
+    SynthesizedSpeechCache cache(10);
+    cache.Put("a", a);
+    cache.Put("b", b);
+    ASSERT_EQ(8u, cache.GetSize());
+    ASSERT_EQ(a, cache.Get("a"));
+    cache.Put("c", c);
+
+    ASSERT_EQ(8u, cache.GetSize());
+    ASSERT_EQ(a, cache.Get("a"));
+    ASSERT_EQ(nullptr, cache.Get("b"));
+    ASSERT_EQ(c, cache.Get("c"));
+
+    // too large to keep in memory
+    cache.Put("large", Aws::MakeShared<ByteBuffer>(ALLOC_TAG, 11));
+    ASSERT_EQ(nullptr, cache.Get("large"));
+    ASSERT_EQ(8u, cache.GetSize());
+
+    cache.Clear();
+    ASSERT_EQ(0u, cache.GetSize());
+    ASSERT_EQ(nullptr, cache.Get("a"));
+}
+
+TEST(TextToSpeechManagerTests, TestSpeechCacheReadsEvictedEntriesFromDirectory)
+{
+    const char* DIRECTORY = "TestSpeechCache";
+    auto a = Aws::MakeShared<ByteBuffer>(ALLOC_TAG, (unsigned char*)"aaaa", 4);
+    auto b = Aws::MakeShared<ByteBuffer>(ALLOC_TAG, (unsigned char*)"bbbb", 4);
+    {
+        SynthesizedSpeechCache cache(4, DIRECTORY);
+        cache.Put("a", a);
+        cache.Put("b", b);
+        ASSERT_EQ(4u, cache.GetSize());
+        auto fromDisk = cache.Get("a");
+        ASSERT_NE(nullptr, fromDisk);
+        ASSERT_EQ(*a, *fromDisk);
+    }
+
+    // and from another instance
+    SynthesizedSpeechCache cache(4, DIRECTORY);
+    auto fromDisk = cache.Get("b");
+    ASSERT_NE(nullptr, fromDisk);
+    ASSERT_EQ(*b, *fromDisk);
+    ASSERT_EQ(nullptr, cache.Get("c"));
+    Aws::FileSystem::DeepDeleteDirectory(DIRECTORY);
+}
+
+TEST(TextToSpeechManagerTests, TestSpeechCacheHitDoesNotCallPolly)
+{
+    Aws::Client::ClientConfiguration clientConfig;
+    clientConfig.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOC_TAG, 2);
+    auto pollyClient = Aws::MakeShared<StreamingMockPollyClient>(ALLOC_TAG, clientConfig);
+
+    auto driver = Aws::MakeShared<FilePCMOutputDriver>(ALLOC_TAG);
+    pollyClient->m_driver = driver;
+
+    auto driverFactory = Aws::MakeShared<MockPCMDriverFactory>(ALLOC_TAG);
+    driverFactory->AddDriver(driver);
+    auto manager = TextToSpeechManager::Create(pollyClient, driverFactory);
+    auto cache = Aws::MakeShared<SynthesizedSpeechCache>(ALLOC_TAG);
+    manager->SetSpeechCache(cache);
+
+    const char* REQUEST_TEXT = "Blah blah blah";
+    ASSERT_TRUE(SendTextAndWait(manager, REQUEST_TEXT));
+    ASSERT_EQ(1u, pollyClient->m_synthCalls);
+    ASSERT_EQ(strlen(REQUEST_TEXT), cache->GetSize());
+
+    ASSERT_TRUE(SendTextAndWait(manager, REQUEST_TEXT));
+    ASSERT_EQ(1u, pollyClient->m_synthCalls);
+    ASSERT_EQ(2 * strlen(REQUEST_TEXT), driver->GetBytesWritten());
+
+    // audio played while it's streamed is cached too
+    manager->SetStreamingPlayback(true, 0);
+    ASSERT_TRUE(SendTextAndWait(manager, "Blah blah"));
+    ASSERT_TRUE(SendTextAndWait(manager, "Blah blah"));
+    ASSERT_EQ(2u, pollyClient->m_synthCalls);
+    ASSERT_EQ(2 * strlen(REQUEST_TEXT) + 2 * strlen("Blah blah") - 2, driver->GetBytesWritten());
+    pollyClient = nullptr;
+}
+
+TEST(TextToSpeechManagerTests, TestSentencePipeliningPlaysInOrder)
+{
+    Aws::Client::ClientConfiguration clientConfig;
+    clientConfig.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOC_TAG, 4);
+    auto pollyClient = Aws::MakeShared<StreamingMockPollyClient>(ALLOC_TAG, clientConfig);
+
+    const char* FILE_NAME = "TestSentencePipelining.pcm";
+    auto driver = Aws::MakeShared<FilePCMOutputDriver>(ALLOC_TAG, FILE_NAME);
+    pollyClient->m_driver = driver;
+
+    auto driverFactory = Aws::MakeShared<MockPCMDriverFactory>(ALLOC_TAG);
+    driverFactory->AddDriver(driver);
+    auto manager = TextToSpeechManager::Create(pollyClient, driverFactory);
+    auto cache = Aws::MakeShared<SynthesizedSpeechCache>(ALLOC_TAG);
+    manager->SetSpeechCache(cache);
+    manager->SetSentencePipelining(true);
+
+    ASSERT_TRUE(SendTextAndWait(manager, "Two?"));
+    ASSERT_EQ(1u, pollyClient->m_synthCalls);
+
+    // the cached sentence is played in its place, and 3.5 isn't the end of a sentence
+    ASSERT_TRUE(SendTextAndWait(manager, "One costs 3.5 dollars.  Two? Three!\nFour"));
+    ASSERT_EQ(4u, pollyClient->m_synthCalls);
+
+    driver = nullptr;
+    pollyClient->m_driver = nullptr;
+    manager = nullptr;
+    driverFactory = nullptr;
+    ASSERT_EQ("Two?One costs 3.5 dollars.Two?Three!Four", ReadFileContents(FILE_NAME));
+    remove(FILE_NAME);
+    pollyClient = nullptr;
+}
+
+/**
+ * Polly client that returns the text of a request as its audio, and fails sentences starting with "Fail"; the first one it
+ * fails slowly, so that the failures complete out of order.
+ */
+class FailingSentencesMockPollyClient : public PollyClient
+{
+public:
+    FailingSentencesMockPollyClient(const Aws::Client::ClientConfiguration& clientConfig) : PollyClient(Aws::Auth::AWSCredentials("", ""), clientConfig) {}
+
+    SynthesizeSpeechOutcome SynthesizeSpeech(const SynthesizeSpeechRequest& request) const override
+    {
+        if (request.GetText() == "Fail slowly.")
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            return Aws::Client::AWSError<PollyErrors>(PollyErrors::THROTTLING, true);
+        }
+        if (request.GetText().find("Fail") == 0)
+        {
+            return Aws::Client::AWSError<PollyErrors>(PollyErrors::ACCESS_DENIED, false);
+        }
+
+        auto audio = Aws::New<Aws::StringStream>(ALLOC_TAG);
+        *audio << request.GetText();
+        SynthesizeSpeechResult result;
+        result.ReplaceBody(audio);
+        result.SetContentType("audio/pcm");
+        result.SetRequestCharacters(static_cast<int>(request.GetText().size()));
+        return SynthesizeSpeechOutcome(std::move(result));
+    }
+};
+
+TEST(TextToSpeechManagerTests, TestSentencePipeliningReportsFirstFailedSentence)
+{
+    Aws::Client::ClientConfiguration clientConfig;
+    clientConfig.executor = Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(ALLOC_TAG, 4);
+    auto pollyClient = Aws::MakeShared<FailingSentencesMockPollyClient>(ALLOC_TAG, clientConfig);
+
+    const char* FILE_NAME = "TestSentencePipeliningFailure.pcm";
+    auto driver = Aws::MakeShared<FilePCMOutputDriver>(ALLOC_TAG, FILE_NAME);
+    auto driverFactory = Aws::MakeShared<MockPCMDriverFactory>(ALLOC_TAG);
+    driverFactory->AddDriver(driver);
+    auto manager = TextToSpeechManager::Create(pollyClient, driverFactory);
+    manager->SetSentencePipelining(true);
+
+    Aws::Utils::Threading::Semaphore handlerExitSemaphore(0, 1);
+    bool played = true;
+    bool succeeded = true;
+    PollyErrors error = PollyErrors::UNKNOWN;
+    manager->SendTextToOutputDevice("One. Fail slowly. Fail fast. Four.", [&](const char*, const SynthesizeSpeechOutcome& outcome, bool sent)
+    {
+        played = sent;
+        succeeded = outcome.IsSuccess();
+        if (!succeeded)
+        {
+            error = outcome.GetError().GetErrorType();
+        }
+        handlerExitSemaphore.Release();
+    });
+    handlerExitSemaphore.WaitOne();
+
+    ASSERT_FALSE(played);
+    ASSERT_FALSE(succeeded);
+    // the error of the first sentence that failed, not of the first failure to arrive
+    ASSERT_EQ(PollyErrors::THROTTLING, error);
+
+    driver = nullptr;
+    manager = nullptr;
+    driverFactory = nullptr;
+    ASSERT_EQ("One.Four.", ReadFileContents(FILE_NAME));
+    remove(FILE_NAME);
+    pollyClient = nullptr;
+}
+
 TEST(TextToSpeechManagerTests, TestListVoicesSuccess)
 {
     Voice voice1;
@@ -357,6 +709,8 @@ TEST(TextToSpeechManagerTests, TestSynthResponseAndOutput)
 
     SynthesizeSpeechResult res;
     res.ReplaceBody(strStream);
+    res.SetContentType("audio/pcm;rate=8000");
+    res.SetRequestCharacters(14);
 
     pollyClient->MockSynthesizeSpeech(std::move(res));
 
@@ -378,11 +732,15 @@ TEST(TextToSpeechManagerTests, TestSynthResponseAndOutput)
 
     const char* REQUEST_TEXT = "Blah blah blah";
 
-    SendTextCompletedHandler handler = [&](const char* text, const SynthesizeSpeechOutcome&, bool sent) 
+    SendTextCompletedHandler handler = [&](const char* text, const SynthesizeSpeechOutcome& outcome, bool sent) 
         {
             std::lock_guard<std::mutex> lockGuard(lock);
             EXPECT_STREQ(REQUEST_TEXT, text);
             EXPECT_TRUE(sent);
+            // Polly's own result
+            EXPECT_TRUE(outcome.IsSuccess());
+            EXPECT_EQ("audio/pcm;rate=8000", outcome.GetResult().GetContentType());
+            EXPECT_EQ(14, outcome.GetResult().GetRequestCharacters());
             semaphore.notify_all();
         };
 
@@ -442,11 +800,13 @@ TEST(TextToSpeechManagerTests, TestSynthRequestFailedAndNoOutput)
 
     const char* REQUEST_TEXT = "Blah blah blah";
 
-    SendTextCompletedHandler handler = [&](const char* text, const SynthesizeSpeechOutcome&, bool sent)
+    SendTextCompletedHandler handler = [&](const char* text, const SynthesizeSpeechOutcome& outcome, bool sent)
     {
         std::lock_guard<std::mutex> lockGuard(lock);
         EXPECT_STREQ(REQUEST_TEXT, text);
         EXPECT_FALSE(sent);
+        EXPECT_FALSE(outcome.IsSuccess());
+        EXPECT_EQ(PollyErrors::ACCESS_DENIED, outcome.GetError().GetErrorType());
         semaphore.notify_all();
     };
 
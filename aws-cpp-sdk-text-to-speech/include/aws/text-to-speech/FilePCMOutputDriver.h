@@ -0,0 +1,70 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/text-to-speech/PCMOutputDriver.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+
+namespace Aws
+{
+    namespace TextToSpeech
+    {
+        /**
+         * Output driver that writes the raw pcm data to a file instead of a sound card, or throws it away if no file name is given.
+         * Useful where there is no audio hardware, e.g. to measure how long it takes for the first audio to be played.
+         */
+        class AWS_TEXT_TO_SPEECH_API FilePCMOutputDriver : public PCMOutputDriver
+        {
+        public:
+            /**
+             * Writes audio to fileName, truncating it. With an empty fileName, audio is counted and discarded.
+             */
+            FilePCMOutputDriver(const Aws::String& fileName = "");
+            ~FilePCMOutputDriver();
+
+            bool WriteBufferToDevice(const unsigned char*, size_t) override;
+            Aws::Vector<DeviceInfo> EnumerateDevices() const override;
+            void SetActiveDevice(const DeviceInfo&, const CapabilityInfo&) override;
+            const char* GetName() const override;
+            void Prime() override;
+            void Flush() override;
+
+            /**
+             * Total bytes written to the device.
+             */
+            size_t GetBytesWritten() const;
+
+            /**
+             * When the first bytes after the last call to Prime() were written. Default constructed if nothing has been written since.
+             */
+            std::chrono::steady_clock::time_point GetFirstWriteTime() const;
+
+            const CapabilityInfo& GetActiveCaps() const { return m_selectedCaps; }
+
+        private:
+            Aws::String m_fileName;
+            Aws::OFStream m_file;
+            CapabilityInfo m_selectedCaps;
+            size_t m_bytesWritten;
+            std::chrono::steady_clock::time_point m_firstWriteTime;
+            mutable std::mutex m_writeLock;
+        };
+    }
+}
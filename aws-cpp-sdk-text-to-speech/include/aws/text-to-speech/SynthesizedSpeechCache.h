@@ -0,0 +1,91 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#pragma once
+
+#include <aws/text-to-speech/TextToSpeech_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSList.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace TextToSpeech
+    {
+        /**
+         * Default bytes of audio a SynthesizedSpeechCache keeps in memory, about half an hour at 16khz.
+         */
+        static const size_t DEFAULT_SPEECH_CACHE_SIZE = 64 * 1024 * 1024;
+
+        /**
+         * Least recently used cache of audio synthesized by Polly, for TextToSpeechManager to replay phrases it has rendered before
+         * without a round trip. Keys are built by the manager from the voice, the output format and the text.
+         *
+         * Up to maxBytes of audio are kept in memory. If a directory is given, every entry is also written there, one file per entry,
+         * and entries not in memory are looked up there; files are never removed by the cache, so they outlive the process.
+         * The cache is thread safe and can be shared by several managers.
+         */
+        class AWS_TEXT_TO_SPEECH_API SynthesizedSpeechCache
+        {
+        public:
+            SynthesizedSpeechCache(size_t maxBytes = DEFAULT_SPEECH_CACHE_SIZE, const Aws::String& directory = "");
+
+            /**
+             * Returns the audio cached for key, nullptr if there is none.
+             */
+            std::shared_ptr<const Aws::Utils::ByteBuffer> Get(const Aws::String& key);
+
+            /**
+             * Adds audio for key, evicting the least recently used entries from memory if needed.
+             * Audio larger than the cache is only written to the directory.
+             */
+            void Put(const Aws::String& key, const std::shared_ptr<const Aws::Utils::ByteBuffer>& audio);
+
+            /**
+             * Drops all entries from memory. Files in the directory are kept.
+             */
+            void Clear();
+
+            /**
+             * Bytes of audio currently held in memory.
+             */
+            size_t GetSize() const;
+
+            inline size_t GetMaxSize() const { return m_maxBytes; }
+            inline const Aws::String& GetDirectory() const { return m_directory; }
+
+        private:
+            typedef std::pair<Aws::String, std::shared_ptr<const Aws::Utils::ByteBuffer>> Entry;
+
+            void Insert(const Aws::String& key, const std::shared_ptr<const Aws::Utils::ByteBuffer>& audio);
+            Aws::String GetFileName(const Aws::String& key) const;
+            std::shared_ptr<const Aws::Utils::ByteBuffer> ReadFile(const Aws::String& key) const;
+            void WriteFile(const Aws::String& key, const Aws::Utils::ByteBuffer& audio) const;
+
+            size_t m_maxBytes;
+            Aws::String m_directory;
+
+            mutable std::mutex m_cacheLock;
+            // most recently used first
+            Aws::List<Entry> m_entries;
+            Aws::Map<Aws::String, Aws::List<Entry>::iterator> m_index;
+            size_t m_size;
+        };
+    }
+}
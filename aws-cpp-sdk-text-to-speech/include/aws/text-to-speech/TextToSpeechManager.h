@@ -17,8 +17,11 @@
 
 #include <aws/text-to-speech/TextToSpeech_EXPORTS.h>
 #include <aws/text-to-speech/PCMOutputDriver.h>
+#include <aws/text-to-speech/SynthesizedSpeechCache.h>
 #include <aws/polly/PollyClient.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -30,7 +33,8 @@ namespace Aws
         /**
          * Callback for handling notifications that the SendTextToOutputDevice operation has finished.
          * @arg1 the text that was sent
-         * @arg2 the outcome of the operation from the polly service.
+         * @arg2 the outcome of the operation from the polly service. If the text was split into sentences, the first error or a result
+         *       totalling the characters synthesized.
          * @arg3 whether or not the audio stream was successfully sent to the audio driver. 
          */
         typedef std::function<void(const char*, const Polly::Model::SynthesizeSpeechOutcome&, bool)> SendTextCompletedHandler;
@@ -44,6 +48,12 @@ namespace Aws
          */
         static const size_t BUFF_SIZE = 8192;
 
+        /**
+         * Default bytes of audio TextToSpeechManager collects from Polly before it starts playing with streaming playback,
+         * a quarter of a second at 16khz.
+         */
+        static const size_t DEFAULT_JITTER_BUFFER_SIZE = BUFF_SIZE;
+
         /**
          * Manager for rendering text to the Polly service and then sending directly to an audio driver.
          * By default this uses our best guess at the correct drivers for you operating system.
@@ -59,9 +69,11 @@ namespace Aws
             /**
              * Create a TextToSpeechManager instance initialized with a polly client and a driver factory.
              * If driver factory is nullptr, we will create a default implementation for your operating system.
+             * Audio that doesn't need a call to Polly (see SetSpeechCache()) is played on executor, by default a DefaultExecutor.
              */
             static std::shared_ptr<TextToSpeechManager> Create(const std::shared_ptr<Polly::PollyClient>& pollyClient,
-                const std::shared_ptr<PCMOutputDriverFactory>& driverFactory = nullptr);
+                const std::shared_ptr<PCMOutputDriverFactory>& driverFactory = nullptr,
+                const std::shared_ptr<Aws::Utils::Threading::Executor>& executor = nullptr);
             
             ~TextToSpeechManager();
             TextToSpeechManager(const TextToSpeechManager&) = delete;
@@ -99,18 +111,57 @@ namespace Aws
              */
             void SetActiveVoice(const Aws::String& voice);
 
+            /**
+             * With streaming playback, audio is sent to the audio driver while it's downloaded from Polly instead of once the download finished,
+             * so playback starts after the first jitterBufferSize bytes. Off by default.
+             * The active device is then held from the first audio until the download finished, and requests sent concurrently wait for it
+             * while they download. Streaming relies on the http client reporting received data, which all of the built-in clients do.
+             */
+            void SetStreamingPlayback(bool streaming, size_t jitterBufferSize = DEFAULT_JITTER_BUFFER_SIZE);
+
+            /**
+             * Sets a cache of synthesized audio, keyed by voice, sample rate and text: text found in it is played without calling Polly,
+             * and audio received from Polly is added to it. nullptr, the default, turns caching off.
+             */
+            void SetSpeechCache(const std::shared_ptr<SynthesizedSpeechCache>& speechCache);
+
+            /**
+             * With sentence pipelining, text is split into sentences which are synthesized concurrently (and looked up in the speech cache
+             * one by one), and played back in order as soon as each one and all before it have arrived. Off by default.
+             * A sentence that fails to synthesize is skipped, and the operation reported as failed.
+             */
+            void SetSentencePipelining(bool pipelining);
+
         private:
+            struct SpeechJob;
+            friend struct SendTextCompletionHandlerCallbackContext;
+
             TextToSpeechManager(const std::shared_ptr<Polly::PollyClient>& pollyClient,
-                const std::shared_ptr<PCMOutputDriverFactory>& driverFactory);
+                const std::shared_ptr<PCMOutputDriverFactory>& driverFactory, const std::shared_ptr<Aws::Utils::Threading::Executor>& executor);
+
+            void SynthesizeSegment(const std::shared_ptr<SpeechJob>& job, size_t segment, bool streamingPlayback);
 
             void OnPollySynthSpeechOutcomeRecieved(const Polly::PollyClient*, const Polly::Model::SynthesizeSpeechRequest&, 
                 const Polly::Model::SynthesizeSpeechOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&) const;
+
+            /**
+             * Plays the segments of job that are ready, in order, and calls its callback once all have been. Only one thread plays a job at a time,
+             * the others return right away and what they made ready is picked up by it.
+             */
+            void PlayReadySegments(const std::shared_ptr<SpeechJob>& job) const;
+
+            bool PlayAudio(const Aws::Utils::ByteBuffer& audio) const;
             
             Polly::PollyClient* m_pollyClient;
             std::shared_ptr<PCMOutputDriver> m_activeDriver;
             Aws::Vector<std::shared_ptr<PCMOutputDriver>> m_drivers;
             std::atomic<Polly::Model::VoiceId> m_activeVoice;
             CapabilityInfo m_selectedCaps;
+            std::atomic<bool> m_streamingPlayback;
+            std::atomic<size_t> m_jitterBufferSize;
+            std::atomic<bool> m_sentencePipelining;
+            std::shared_ptr<SynthesizedSpeechCache> m_speechCache;
+            std::shared_ptr<Aws::Utils::Threading::Executor> m_executor;
             mutable std::mutex m_driverLock;
         };
     }
@@ -0,0 +1,120 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/text-to-speech/FilePCMOutputDriver.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+namespace Aws
+{
+    namespace TextToSpeech
+    {
+        static const char* CLASS_NAME = "FilePCMOutputDriver";
+
+        FilePCMOutputDriver::FilePCMOutputDriver(const Aws::String& fileName) : m_fileName(fileName), m_bytesWritten(0)
+        {
+            if (!m_fileName.empty())
+            {
+                m_file.open(m_fileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+                if (!m_file)
+                {
+                    AWS_LOGSTREAM_ERROR(CLASS_NAME, " error opening " << m_fileName << " for writing");
+                }
+            }
+        }
+
+        FilePCMOutputDriver::~FilePCMOutputDriver()
+        {
+        }
+
+        bool FilePCMOutputDriver::WriteBufferToDevice(const unsigned char* buffer, size_t size)
+        {
+            std::lock_guard<std::mutex> locker(m_writeLock);
+            if (m_firstWriteTime == std::chrono::steady_clock::time_point() && size > 0)
+            {
+                m_firstWriteTime = std::chrono::steady_clock::now();
+            }
+
+            if (!m_fileName.empty())
+            {
+                m_file.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(size));
+                if (!m_file)
+                {
+                    AWS_LOGSTREAM_ERROR(CLASS_NAME, " error writing buffer to " << m_fileName);
+                    return false;
+                }
+            }
+
+            m_bytesWritten += size;
+            return true;
+        }
+
+        Aws::Vector<DeviceInfo> FilePCMOutputDriver::EnumerateDevices() const
+        {
+            DeviceInfo deviceInfo;
+            deviceInfo.deviceId = "0";
+            deviceInfo.deviceName = m_fileName.empty() ? "null output device" : m_fileName;
+
+            // a file takes any format; these are the sample rates polly renders pcm in
+            CapabilityInfo capabilityInfo;
+            capabilityInfo.channels = MONO;
+            capabilityInfo.sampleWidthBits = BIT_WIDTH_16;
+            capabilityInfo.sampleRate = KHZ_16;
+            deviceInfo.capabilities.push_back(capabilityInfo);
+            capabilityInfo.sampleRate = KHZ_8;
+            deviceInfo.capabilities.push_back(capabilityInfo);
+
+            Aws::Vector<DeviceInfo> devices;
+            devices.push_back(deviceInfo);
+            return devices;
+        }
+
+        void FilePCMOutputDriver::SetActiveDevice(const DeviceInfo&, const CapabilityInfo& capabilityInfo)
+        {
+            m_selectedCaps = capabilityInfo;
+        }
+
+        const char* FilePCMOutputDriver::GetName() const
+        {
+            return "File";
+        }
+
+        void FilePCMOutputDriver::Prime()
+        {
+            std::lock_guard<std::mutex> locker(m_writeLock);
+            m_firstWriteTime = std::chrono::steady_clock::time_point();
+        }
+
+        void FilePCMOutputDriver::Flush()
+        {
+            std::lock_guard<std::mutex> locker(m_writeLock);
+            if (!m_fileName.empty())
+            {
+                m_file.flush();
+            }
+        }
+
+        size_t FilePCMOutputDriver::GetBytesWritten() const
+        {
+            std::lock_guard<std::mutex> locker(m_writeLock);
+            return m_bytesWritten;
+        }
+
+        std::chrono::steady_clock::time_point FilePCMOutputDriver::GetFirstWriteTime() const
+        {
+            std::lock_guard<std::mutex> locker(m_writeLock);
+            return m_firstWriteTime;
+        }
+    }
+}
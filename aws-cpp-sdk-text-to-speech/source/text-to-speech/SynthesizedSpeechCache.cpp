@@ -0,0 +1,180 @@
+/*
+* Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+*
+* Licensed under the Apache License, Version 2.0 (the "License").
+* You may not use this file except in compliance with the License.
+* A copy of the License is located at
+*
+*  http://aws.amazon.com/apache2.0
+*
+* or in the "license" file accompanying this file. This file is distributed
+* on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+* express or implied. See the License for the specific language governing
+* permissions and limitations under the License.
+*/
+
+#include <aws/text-to-speech/SynthesizedSpeechCache.h>
+#include <aws/core/platform/FileSystem.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/UUID.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <fstream>
+
+using namespace Aws::Utils;
+
+namespace Aws
+{
+    namespace TextToSpeech
+    {
+        static const char* CLASS_TAG = "SynthesizedSpeechCache";
+
+        SynthesizedSpeechCache::SynthesizedSpeechCache(size_t maxBytes, const Aws::String& directory) :
+            m_maxBytes(maxBytes), m_directory(directory), m_size(0)
+        {
+            if (!m_directory.empty() && !Aws::FileSystem::CreateDirectoryIfNotExists(m_directory.c_str(), true))
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to create cache directory " << m_directory);
+            }
+        }
+
+        std::shared_ptr<const ByteBuffer> SynthesizedSpeechCache::Get(const Aws::String& key)
+        {
+            {
+                std::lock_guard<std::mutex> locker(m_cacheLock);
+                auto iter = m_index.find(key);
+                if (iter != m_index.end())
+                {
+                    m_entries.splice(m_entries.begin(), m_entries, iter->second);
+                    return iter->second->second;
+                }
+            }
+
+            if (m_directory.empty())
+            {
+                return nullptr;
+            }
+
+            auto audio = ReadFile(key);
+            if (audio)
+            {
+                AWS_LOGSTREAM_TRACE(CLASS_TAG, "Loaded " << audio->GetLength() << " bytes of audio from " << GetFileName(key));
+                std::lock_guard<std::mutex> locker(m_cacheLock);
+                Insert(key, audio);
+            }
+            return audio;
+        }
+
+        void SynthesizedSpeechCache::Put(const Aws::String& key, const std::shared_ptr<const ByteBuffer>& audio)
+        {
+            if (!audio)
+            {
+                return;
+            }
+
+            if (!m_directory.empty())
+            {
+                WriteFile(key, *audio);
+            }
+
+            std::lock_guard<std::mutex> locker(m_cacheLock);
+            Insert(key, audio);
+        }
+
+        void SynthesizedSpeechCache::Clear()
+        {
+            std::lock_guard<std::mutex> locker(m_cacheLock);
+            m_index.clear();
+            m_entries.clear();
+            m_size = 0;
+        }
+
+        size_t SynthesizedSpeechCache::GetSize() const
+        {
+            std::lock_guard<std::mutex> locker(m_cacheLock);
+            return m_size;
+        }
+
+        void SynthesizedSpeechCache::Insert(const Aws::String& key, const std::shared_ptr<const ByteBuffer>& audio)
+        {
+            auto iter = m_index.find(key);
+            if (iter != m_index.end())
+            {
+                m_size -= iter->second->second->GetLength();
+                m_entries.erase(iter->second);
+                m_index.erase(iter);
+            }
+
+            if (audio->GetLength() > m_maxBytes)
+            {
+                return;
+            }
+
+            while (m_size + audio->GetLength() > m_maxBytes)
+            {
+                const Entry& leastRecentlyUsed = m_entries.back();
+                m_size -= leastRecentlyUsed.second->GetLength();
+                m_index.erase(leastRecentlyUsed.first);
+                m_entries.pop_back();
+            }
+
+            m_entries.emplace_front(key, audio);
+            m_index[key] = m_entries.begin();
+            m_size += audio->GetLength();
+        }
+
+        Aws::String SynthesizedSpeechCache::GetFileName(const Aws::String& key) const
+        {
+            // keys hold arbitrary text, so files are named after their hash
+            return m_directory + Aws::FileSystem::PATH_DELIM + HashingUtils::HexEncode(HashingUtils::CalculateSHA256(key)) + ".pcm";
+        }
+
+        std::shared_ptr<const ByteBuffer> SynthesizedSpeechCache::ReadFile(const Aws::String& key) const
+        {
+            Aws::IFStream file(GetFileName(key).c_str(), std::ios_base::in | std::ios_base::binary);
+            if (!file)
+            {
+                return nullptr;
+            }
+
+            file.seekg(0, std::ios_base::end);
+            auto length = static_cast<size_t>(file.tellg());
+            file.seekg(0, std::ios_base::beg);
+
+            auto audio = Aws::MakeShared<ByteBuffer>(CLASS_TAG, length);
+            file.read(reinterpret_cast<char*>(audio->GetUnderlyingData()), static_cast<std::streamsize>(length));
+            if (static_cast<size_t>(file.gcount()) != length)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to read cached audio from " << GetFileName(key));
+                return nullptr;
+            }
+            return audio;
+        }
+
+        void SynthesizedSpeechCache::WriteFile(const Aws::String& key, const ByteBuffer& audio) const
+        {
+            // written aside and renamed, so a concurrent Get never reads a partial file
+            Aws::String fileName = GetFileName(key);
+            Aws::String tempFileName = fileName + "." + Aws::String(UUID::RandomUUID()) + ".tmp";
+            bool written(false);
+            {
+                Aws::OFStream file(tempFileName.c_str(), std::ios_base::out | std::ios_base::binary | std::ios_base::trunc);
+                file.write(reinterpret_cast<const char*>(audio.GetUnderlyingData()), static_cast<std::streamsize>(audio.GetLength()));
+                file.close();
+                written = !file.fail();
+            }
+
+            if (!written)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to write cached audio to " << tempFileName);
+                Aws::FileSystem::RemoveFileIfExists(tempFileName.c_str());
+            }
+            else if (!Aws::FileSystem::RelocateFileOrDirectory(tempFileName.c_str(), fileName.c_str()))
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to move cached audio to " << fileName);
+                Aws::FileSystem::RemoveFileIfExists(tempFileName.c_str());
+            }
+        }
+    }
+}
@@ -16,8 +16,15 @@
 #include <aws/text-to-speech/TextToSpeechManager.h>
 #include <aws/polly/model/SynthesizeSpeechRequest.h>
 #include <aws/polly/model/DescribeVoicesRequest.h>
+#include <aws/polly/model/OutputFormat.h>
+#include <aws/polly/model/VoiceId.h>
+#include <aws/core/http/HttpResponse.h>
 #include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <algorithm>
+#include <cctype>
 
 using namespace Aws::Polly;
 using namespace Aws::Polly::Model;
@@ -29,29 +36,268 @@ namespace Aws
     {
         static const char* CLASS_TAG = "TextToSpeechManager";
 
-        struct SendTextCompletionHandlerCallbackContext : public Aws::Client::AsyncCallerContext
+        /**
+         * Response stream buffer of a SynthesizeSpeech request that sends the audio to the driver as the http client writes it,
+         * once the jitter buffer filled up. Until the response turns out to be audio, everything written is kept and can be read back,
+         * as errors are parsed from the body.
+         * The transfer and the completion handler run on the same thread, which holds the driver lock from the first audio on until Finish().
+         */
+        class StreamingPlaybackBuf : public std::streambuf
+        {
+        public:
+            StreamingPlaybackBuf(const std::shared_ptr<PCMOutputDriver>& driver, std::mutex& driverLock, const CapabilityInfo& caps, size_t jitterBufferSize,
+                bool keepPlayedAudio) :
+                m_driver(driver), m_driverLocker(driverLock, std::defer_lock),
+                m_frameSize((std::max)(static_cast<size_t>(1), static_cast<size_t>(caps.channels * caps.sampleWidthBits / 8))),
+                m_jitterBufferSize(jitterBufferSize), m_checkedContentType(false), m_isAudio(false), m_played(true), m_bytesPlayed(0), m_bytesToSkip(0),
+                m_keepPlayedAudio(keepPlayedAudio)
+            {
+            }
+
+            /**
+             * Response stream factory, called for every attempt of the request.
+             */
+            Aws::IOStream* CreateResponseStream()
+            {
+                m_pending.clear();
+                ResetGetArea(0);
+                m_checkedContentType = false;
+                m_isAudio = false;
+                // a retry renders the same audio again, so what has been played already is skipped
+                m_bytesToSkip = m_bytesPlayed;
+                return Aws::New<Aws::IOStream>(CLASS_TAG, this);
+            }
+
+            void OnDataReceived(const Aws::Http::HttpResponse& response)
+            {
+                if (!m_checkedContentType)
+                {
+                    m_checkedContentType = true;
+                    m_isAudio = response.HasHeader(Aws::Http::CONTENT_TYPE_HEADER) && response.GetContentType().find("audio/") == 0;
+                }
+
+                if (!m_isAudio)
+                {
+                    return;
+                }
+
+                if (m_bytesToSkip > 0)
+                {
+                    size_t skipped = (std::min)(m_bytesToSkip, m_pending.size());
+                    m_pending.erase(m_pending.begin(), m_pending.begin() + skipped);
+                    m_bytesToSkip -= skipped;
+                    ResetGetArea(0);
+                }
+
+                if (!IsPlaying())
+                {
+                    if (m_pending.size() < m_jitterBufferSize)
+                    {
+                        return;
+                    }
+                    m_driverLocker.lock();
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Jitter buffer filled, starting playback.");
+                    m_driver->Prime();
+                }
+                Play();
+            }
+
+            bool IsPlaying() const
+            {
+                return m_driverLocker.owns_lock();
+            }
+
+            /**
+             * Plays the rest of the audio and releases the driver. Returns whether all of the audio was successfully sent to the driver.
+             */
+            bool Finish()
+            {
+                if (!IsPlaying())
+                {
+                    return false;
+                }
+                Play();
+                m_driver->Flush();
+                m_driverLocker.unlock();
+                return m_played;
+            }
+
+            /**
+             * All audio played, if it's kept.
+             */
+            std::shared_ptr<const ByteBuffer> GetPlayedAudio() const
+            {
+                return Aws::MakeShared<ByteBuffer>(CLASS_TAG, m_playedAudio.data(), m_playedAudio.size());
+            }
+
+        protected:
+            std::streamsize xsputn(const char* s, std::streamsize n) override
+            {
+                size_t readOffset = static_cast<size_t>(gptr() - eback());
+                m_pending.insert(m_pending.end(), reinterpret_cast<const unsigned char*>(s), reinterpret_cast<const unsigned char*>(s) + n);
+                ResetGetArea(readOffset);
+                return n;
+            }
+
+            int_type overflow(int_type ch) override
+            {
+                if (traits_type::eq_int_type(ch, traits_type::eof()))
+                {
+                    return traits_type::not_eof(ch);
+                }
+                char c = traits_type::to_char_type(ch);
+                xsputn(&c, 1);
+                return ch;
+            }
+
+        private:
+            void Play()
+            {
+                // only whole frames go to the device, the rest waits for the next write
+                size_t length = m_pending.size() - m_pending.size() % m_frameSize;
+                for (size_t offset = 0; offset < length && m_played; offset += BUFF_SIZE)
+                {
+                    size_t chunk = (std::min)(BUFF_SIZE, length - offset);
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Writing " << chunk << " bytes to device.");
+                    m_played = m_driver->WriteBufferToDevice(m_pending.data() + offset, chunk);
+                }
+                m_bytesPlayed += length;
+                if (m_keepPlayedAudio)
+                {
+                    m_playedAudio.insert(m_playedAudio.end(), m_pending.begin(), m_pending.begin() + length);
+                }
+                m_pending.erase(m_pending.begin(), m_pending.begin() + length);
+                ResetGetArea(0);
+            }
+
+            void ResetGetArea(size_t readOffset)
+            {
+                char* data = reinterpret_cast<char*>(m_pending.data());
+                setg(data, data + readOffset, data + m_pending.size());
+            }
+
+            std::shared_ptr<PCMOutputDriver> m_driver;
+            std::unique_lock<std::mutex> m_driverLocker;
+            size_t m_frameSize;
+            size_t m_jitterBufferSize;
+            Aws::Vector<unsigned char> m_pending;
+            bool m_checkedContentType;
+            bool m_isAudio;
+            bool m_played;
+            size_t m_bytesPlayed;
+            size_t m_bytesToSkip;
+            bool m_keepPlayedAudio;
+            Aws::Vector<unsigned char> m_playedAudio;
+        };
+
+        /**
+         * Part of the text of a SendTextToOutputDevice call, synthesized by its own request.
+         */
+        struct SpeechSegment
+        {
+            SpeechSegment() : ready(false), failed(false), streamed(false), played(false) {}
+
+            Aws::String text;
+            Aws::String cacheKey;
+            std::shared_ptr<const ByteBuffer> audio;
+            bool ready;
+            bool failed;
+            Aws::Client::AWSError<PollyErrors> error;
+            // played while downloaded
+            bool streamed;
+            bool played;
+        };
+
+        struct TextToSpeechManager::SpeechJob
         {
+            SpeechJob() : nextToPlay(0), playing(false), finished(false), allPlayed(true), requestCharacters(0) {}
+
+            Aws::String text;
             SendTextCompletedHandler callback;
+            std::shared_ptr<SynthesizedSpeechCache> speechCache;
+
+            std::mutex jobLock;
+            Aws::Vector<SpeechSegment> segments;
+            size_t nextToPlay;
+            bool playing;
+            bool finished;
+            bool allPlayed;
+            int requestCharacters;
+            // Polly's own outcome when the text was synthesized by a single request, handed to the callback as it is
+            std::shared_ptr<SynthesizeSpeechOutcome> outcome;
         };
 
+        struct SendTextCompletionHandlerCallbackContext : public Aws::Client::AsyncCallerContext
+        {
+            std::shared_ptr<TextToSpeechManager::SpeechJob> job;
+            size_t segment;
+            std::shared_ptr<StreamingPlaybackBuf> playback;
+        };
+
+        static void AddSentence(Aws::Vector<Aws::String>& sentences, const Aws::String& sentence)
+        {
+            Aws::String trimmed = StringUtils::Trim(sentence.c_str());
+            if (!trimmed.empty())
+            {
+                sentences.push_back(trimmed);
+            }
+        }
+
+        // splits after sentence ending punctuation followed by white space, keeping the punctuation with its sentence
+        static Aws::Vector<Aws::String> SplitIntoSentences(const Aws::String& text)
+        {
+            Aws::Vector<Aws::String> sentences;
+            size_t start = 0;
+            for (size_t i = 0; i < text.size(); ++i)
+            {
+                char c = text[i];
+                if ((c == '.' || c == '!' || c == '?') && (i + 1 == text.size() || isspace(static_cast<unsigned char>(text[i + 1]))))
+                {
+                    AddSentence(sentences, text.substr(start, i + 1 - start));
+                    start = i + 1;
+                }
+            }
+            AddSentence(sentences, text.substr(start));
+            return sentences;
+        }
+
+        static Aws::String BuildCacheKey(VoiceId voice, size_t sampleRate, const Aws::String& text)
+        {
+            return Aws::String(VoiceIdMapper::GetNameForVoiceId(voice)) + "\n" + OutputFormatMapper::GetNameForOutputFormat(OutputFormat::pcm) + "\n"
+                + StringUtils::to_string(sampleRate) + "\n" + text;
+        }
+
+        static std::shared_ptr<const ByteBuffer> ReadAudio(Aws::IOStream& stream)
+        {
+            Aws::Vector<unsigned char> audio;
+            unsigned char buffer[BUFF_SIZE];
+            while (stream)
+            {
+                stream.read((char*) buffer, BUFF_SIZE);
+                audio.insert(audio.end(), buffer, buffer + stream.gcount());
+            }
+            return Aws::MakeShared<ByteBuffer>(CLASS_TAG, audio.data(), audio.size());
+        }
+
         std::shared_ptr<TextToSpeechManager> TextToSpeechManager::Create(const std::shared_ptr<Polly::PollyClient>& pollyClient,
-            const std::shared_ptr<PCMOutputDriverFactory>& driverFactory)
+            const std::shared_ptr<PCMOutputDriverFactory>& driverFactory, const std::shared_ptr<Aws::Utils::Threading::Executor>& executor)
         {
             // Because TextToSpeechManager's ctor is private (to ensure it's always constructed as a shared_ptr)
             // Aws::MakeShared does not have access to that private constructor. This workaround essentially 
             // enables Aws::MakeShared to construct TextToSpeechManager.
             struct MakeSharedEnabler : public TextToSpeechManager {
                 MakeSharedEnabler(const std::shared_ptr<Polly::PollyClient>& pollyClient,
-                    const std::shared_ptr<PCMOutputDriverFactory>& driverFactory)
-                    : TextToSpeechManager(pollyClient, driverFactory) {}
+                    const std::shared_ptr<PCMOutputDriverFactory>& driverFactory, const std::shared_ptr<Aws::Utils::Threading::Executor>& executor)
+                    : TextToSpeechManager(pollyClient, driverFactory, executor) {}
             };
             
-            return Aws::MakeShared<MakeSharedEnabler>(CLASS_TAG, pollyClient, driverFactory);
+            return Aws::MakeShared<MakeSharedEnabler>(CLASS_TAG, pollyClient, driverFactory, executor);
         }
 
         TextToSpeechManager::TextToSpeechManager(const std::shared_ptr<Polly::PollyClient>& pollyClient, 
-            const std::shared_ptr<PCMOutputDriverFactory>& driverFactory) 
-            : m_pollyClient(pollyClient.get()), m_activeVoice(VoiceId::Kimberly)
+            const std::shared_ptr<PCMOutputDriverFactory>& driverFactory, const std::shared_ptr<Aws::Utils::Threading::Executor>& executor) 
+            : m_pollyClient(pollyClient.get()), m_activeVoice(VoiceId::Kimberly), m_streamingPlayback(false), m_jitterBufferSize(DEFAULT_JITTER_BUFFER_SIZE),
+            m_sentencePipelining(false), m_executor(executor ? executor : Aws::MakeShared<Aws::Utils::Threading::DefaultExecutor>(CLASS_TAG))
         {
             m_drivers = (driverFactory ? driverFactory : DefaultPCMOutputDriverFactoryInitFn())->LoadDrivers();
         }
@@ -71,15 +317,80 @@ namespace Aws
                 SetActiveDevice(devices.front().second, devices.front().first, devices.front().first.capabilities.front());
             }
 
+            auto job = Aws::MakeShared<SpeechJob>(CLASS_TAG);
+            job->text = text;
+            job->callback = handler;
+            job->speechCache = std::atomic_load(&m_speechCache);
+
+            Aws::Vector<Aws::String> texts;
+            if (m_sentencePipelining)
+            {
+                texts = SplitIntoSentences(text);
+            }
+            if (texts.empty())
+            {
+                texts.push_back(text);
+            }
+
+            job->segments.resize(texts.size());
+            for (size_t i = 0; i < texts.size(); ++i)
+            {
+                SpeechSegment& segment = job->segments[i];
+                segment.text = texts[i];
+                if (job->speechCache)
+                {
+                    segment.cacheKey = BuildCacheKey(m_activeVoice, m_selectedCaps.sampleRate, segment.text);
+                    segment.audio = job->speechCache->Get(segment.cacheKey);
+                    segment.ready = segment.audio != nullptr;
+                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Speech cache " << (segment.ready ? "hit" : "miss") << " for: " << segment.text);
+                }
+            }
+
+            // segments are only touched under the job lock once requests are out
+            bool firstSegmentReady = job->segments.front().ready;
+            for (size_t i = 0; i < texts.size(); ++i)
+            {
+                if (!job->segments[i].ready)
+                {
+                    // only the first segment can be played as it arrives, the others have to wait for it anyway
+                    SynthesizeSegment(job, i, i == 0 && m_streamingPlayback);
+                }
+            }
+
+            if (firstSegmentReady)
+            {
+                auto self = shared_from_this();
+                m_executor->Submit([self, job]() { self->PlayReadySegments(job); });
+            }
+        }
+
+        void TextToSpeechManager::SynthesizeSegment(const std::shared_ptr<SpeechJob>& job, size_t segment, bool streamingPlayback)
+        {
             SynthesizeSpeechRequest synthesizeSpeechRequest;
             synthesizeSpeechRequest.WithOutputFormat(OutputFormat::pcm)
                 .WithSampleRate(StringUtils::to_string(m_selectedCaps.sampleRate))
                 .WithTextType(TextType::text)
-                .WithText(text)
+                .WithText(job->segments[segment].text)
                 .WithVoiceId(m_activeVoice);
 
             auto context = Aws::MakeShared<SendTextCompletionHandlerCallbackContext>(CLASS_TAG);
-            context->callback = handler;
+            context->job = job;
+            context->segment = segment;
+
+            if (streamingPlayback)
+            {
+                std::shared_ptr<PCMOutputDriver> driver;
+                {
+                    std::lock_guard<std::mutex> m(m_driverLock);
+                    driver = m_activeDriver;
+                }
+                auto playback = Aws::MakeShared<StreamingPlaybackBuf>(CLASS_TAG, driver, m_driverLock, m_selectedCaps, m_jitterBufferSize,
+                    job->speechCache != nullptr);
+                synthesizeSpeechRequest.SetResponseStreamFactory([playback]() { return playback->CreateResponseStream(); });
+                synthesizeSpeechRequest.SetDataReceivedEventHandler([playback](const Aws::Http::HttpRequest*, Aws::Http::HttpResponse* response, long long)
+                    { playback->OnDataReceived(*response); });
+                context->playback = playback;
+            }
 
             auto self = shared_from_this();
             m_pollyClient->SynthesizeSpeechAsync(synthesizeSpeechRequest, [self](const Polly::PollyClient* client, const Polly::Model::SynthesizeSpeechRequest& request,
@@ -144,48 +455,185 @@ namespace Aws
             m_activeVoice = VoiceIdMapper::GetVoiceIdForName(voice);
         }
 
-        void TextToSpeechManager::OnPollySynthSpeechOutcomeRecieved(const Polly::PollyClient*, const Polly::Model::SynthesizeSpeechRequest& request,
+        void TextToSpeechManager::SetSpeechCache(const std::shared_ptr<SynthesizedSpeechCache>& speechCache)
+        {
+            std::atomic_store(&m_speechCache, speechCache);
+        }
+
+        void TextToSpeechManager::SetSentencePipelining(bool pipelining)
+        {
+            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Setting sentence pipelining " << (pipelining ? "on" : "off"));
+            m_sentencePipelining = pipelining;
+        }
+
+        void TextToSpeechManager::SetStreamingPlayback(bool streaming, size_t jitterBufferSize)
+        {
+            AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Setting streaming playback " << (streaming ? "on" : "off") << " with a jitter buffer of " << jitterBufferSize << " bytes.");
+            m_jitterBufferSize = jitterBufferSize;
+            m_streamingPlayback = streaming;
+        }
+
+        void TextToSpeechManager::OnPollySynthSpeechOutcomeRecieved(const Polly::PollyClient*, const Polly::Model::SynthesizeSpeechRequest&,
             const Polly::Model::SynthesizeSpeechOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
         {
+            const auto& callbackContext = (const std::shared_ptr<SendTextCompletionHandlerCallbackContext>&)context;
+            const auto& job = callbackContext->job;
+            const auto& playback = callbackContext->playback;
+
+            std::shared_ptr<const ByteBuffer> audio;
+            bool streamed(false);
             bool played(false);
+            int requestCharacters(0);
 
+            // the handler's outcome is a temporary of the async call, the result is taken over to read its audio, or to forward it
+            auto& pollyOutcome = const_cast<Polly::Model::SynthesizeSpeechOutcome&>(outcome);
             if(outcome.IsSuccess())
             {
-                auto result = const_cast<Polly::Model::SynthesizeSpeechOutcome&>(outcome).GetResultWithOwnership();
+                auto& result = pollyOutcome.GetResult();
                 auto& stream = result.GetAudioStream();
                 AWS_LOGSTREAM_TRACE(CLASS_TAG, "Audio retrieved from Polly. " << result.GetContentType() << " with " 
                     << result.GetRequestCharacters() << " characters syntesized");
+                requestCharacters = result.GetRequestCharacters();
 
-                std::streamsize amountRead(0);
-                unsigned char buffer[BUFF_SIZE];
-
-                std::lock_guard<std::mutex> m(m_driverLock);
-                m_activeDriver->Prime();
-                bool successfullyPlayed(true);
-                while (stream && successfullyPlayed)
+                if (playback && playback->IsPlaying())
                 {
-                    stream.read((char*) buffer, BUFF_SIZE);
-                    auto read = stream.gcount();
-                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Writing " << read << " bytes to device.");
-
-                    successfullyPlayed = m_activeDriver->WriteBufferToDevice(buffer, (std::size_t)read);
-                    amountRead += read;
-                    played = successfullyPlayed;
+                    played = playback->Finish();
+                    streamed = true;
+                    if (job->speechCache)
+                    {
+                        audio = playback->GetPlayedAudio();
+                    }
+                }
+                else
+                {
+                    // not streamed, or shorter than the jitter buffer
+                    audio = ReadAudio(stream);
                 }
 
-                m_activeDriver->Flush();
+                if (job->speechCache && audio)
+                {
+                    job->speechCache->Put(job->segments[callbackContext->segment].cacheKey, audio);
+                }
             }
             else
             {
+                if (playback)
+                {
+                    // the download failed part way through the audio
+                    playback->Finish();
+                }
                 AWS_LOGSTREAM_ERROR(CLASS_TAG, "Error while fetching audio from polly. " << outcome.GetError().GetExceptionName() << " "
                     << outcome.GetError().GetMessage());
             }
 
-            auto callback = ((const std::shared_ptr<SendTextCompletionHandlerCallbackContext>&)context)->callback;
-            if (callback)
             {
-                callback(request.GetText().c_str(), outcome, played);
+                std::lock_guard<std::mutex> locker(job->jobLock);
+                SpeechSegment& segment = job->segments[callbackContext->segment];
+                segment.ready = true;
+                segment.audio = audio;
+                segment.streamed = streamed;
+                segment.played = played;
+                if (!outcome.IsSuccess())
+                {
+                    segment.failed = true;
+                    segment.error = outcome.GetError();
+                }
+                job->requestCharacters += requestCharacters;
+                if (job->segments.size() == 1)
+                {
+                    job->outcome = Aws::MakeShared<SynthesizeSpeechOutcome>(CLASS_TAG, std::move(pollyOutcome));
+                }
+            }
+
+            PlayReadySegments(job);
+        }
+
+        void TextToSpeechManager::PlayReadySegments(const std::shared_ptr<SpeechJob>& job) const
+        {
+            {
+                std::lock_guard<std::mutex> locker(job->jobLock);
+                if (job->playing)
+                {
+                    return;
+                }
+                job->playing = true;
+            }
+
+            bool finished(false);
+            for (;;)
+            {
+                std::shared_ptr<const ByteBuffer> audio;
+                {
+                    std::lock_guard<std::mutex> locker(job->jobLock);
+                    if (job->nextToPlay == job->segments.size() || !job->segments[job->nextToPlay].ready)
+                    {
+                        job->playing = false;
+                        if (job->nextToPlay == job->segments.size() && !job->finished)
+                        {
+                            job->finished = true;
+                            finished = true;
+                        }
+                        break;
+                    }
+
+                    const SpeechSegment& segment = job->segments[job->nextToPlay++];
+                    if (segment.failed)
+                    {
+                        job->allPlayed = false;
+                    }
+                    else if (segment.streamed)
+                    {
+                        job->allPlayed = job->allPlayed && segment.played;
+                    }
+                    else
+                    {
+                        audio = segment.audio;
+                    }
+                }
+
+                if (audio)
+                {
+                    bool played = PlayAudio(*audio);
+                    std::lock_guard<std::mutex> locker(job->jobLock);
+                    job->allPlayed = job->allPlayed && played;
+                }
+            }
+
+            if (finished && job->callback)
+            {
+                // segments are only written before they are ready, and all of them are by now
+                auto firstFailed = std::find_if(job->segments.begin(), job->segments.end(), [](const SpeechSegment& segment) { return segment.failed; });
+                if (job->outcome)
+                {
+                    job->callback(job->text.c_str(), *job->outcome, job->allPlayed);
+                }
+                else if (firstFailed != job->segments.end())
+                {
+                    job->callback(job->text.c_str(), SynthesizeSpeechOutcome(firstFailed->error), false);
+                }
+                else
+                {
+                    SynthesizeSpeechResult result;
+                    result.SetContentType("audio/pcm");
+                    result.SetRequestCharacters(job->requestCharacters);
+                    job->callback(job->text.c_str(), SynthesizeSpeechOutcome(std::move(result)), job->allPlayed);
+                }
+            }
+        }
+
+        bool TextToSpeechManager::PlayAudio(const ByteBuffer& audio) const
+        {
+            std::lock_guard<std::mutex> m(m_driverLock);
+            m_activeDriver->Prime();
+            bool played(true);
+            for (size_t offset = 0; offset < audio.GetLength() && played; offset += BUFF_SIZE)
+            {
+                size_t length = (std::min)(BUFF_SIZE, audio.GetLength() - offset);
+                AWS_LOGSTREAM_TRACE(CLASS_TAG, "Writing " << length << " bytes to device.");
+                played = m_activeDriver->WriteBufferToDevice(audio.GetUnderlyingData() + offset, length);
             }
+            m_activeDriver->Flush();
+            return played;
         }
     }
 }
@@ -36,7 +36,8 @@ namespace MediaFormatMapper
 {
 AWS_TRANSCRIBESERVICE_API MediaFormat GetMediaFormatForName(const Aws::String& name);
 
-AWS_TRANSCRIBESERVICE_API Aws::String GetNameForMediaFormat(MediaFormat value);
+// names of values not modeled point into the enum overflow container
+AWS_TRANSCRIBESERVICE_API const char* GetNameForMediaFormat(MediaFormat value);
 } // namespace MediaFormatMapper
 } // namespace Model
 } // namespace TranscribeService
@@ -34,7 +34,8 @@ namespace OutputLocationTypeMapper
 {
 AWS_TRANSCRIBESERVICE_API OutputLocationType GetOutputLocationTypeForName(const Aws::String& name);
 
-AWS_TRANSCRIBESERVICE_API Aws::String GetNameForOutputLocationType(OutputLocationType value);
+// names of values not modeled point into the enum overflow container
+AWS_TRANSCRIBESERVICE_API const char* GetNameForOutputLocationType(OutputLocationType value);
 } // namespace OutputLocationTypeMapper
 } // namespace Model
 } // namespace TranscribeService
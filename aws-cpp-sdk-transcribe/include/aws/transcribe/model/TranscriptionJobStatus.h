@@ -35,7 +35,8 @@ namespace TranscriptionJobStatusMapper
 {
 AWS_TRANSCRIBESERVICE_API TranscriptionJobStatus GetTranscriptionJobStatusForName(const Aws::String& name);
 
-AWS_TRANSCRIBESERVICE_API Aws::String GetNameForTranscriptionJobStatus(TranscriptionJobStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_TRANSCRIBESERVICE_API const char* GetNameForTranscriptionJobStatus(TranscriptionJobStatus value);
 } // namespace TranscriptionJobStatusMapper
 } // namespace Model
 } // namespace TranscribeService
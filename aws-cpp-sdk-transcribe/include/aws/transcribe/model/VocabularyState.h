@@ -35,7 +35,8 @@ namespace VocabularyStateMapper
 {
 AWS_TRANSCRIBESERVICE_API VocabularyState GetVocabularyStateForName(const Aws::String& name);
 
-AWS_TRANSCRIBESERVICE_API Aws::String GetNameForVocabularyState(VocabularyState value);
+// names of values not modeled point into the enum overflow container
+AWS_TRANSCRIBESERVICE_API const char* GetNameForVocabularyState(VocabularyState value);
 } // namespace VocabularyStateMapper
 } // namespace Model
 } // namespace TranscribeService
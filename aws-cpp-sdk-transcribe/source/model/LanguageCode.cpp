@@ -30,20 +30,30 @@ namespace Aws
       namespace LanguageCodeMapper
       {
 
-        static const int en_US_HASH = HashingUtils::HashString("en-US");
-        static const int es_US_HASH = HashingUtils::HashString("es-US");
+        static constexpr int en_US_HASH = HashingUtils::CompileTimeHashString("en-US");
+        static constexpr int es_US_HASH = HashingUtils::CompileTimeHashString("es-US");
 
 
         LanguageCode GetLanguageCodeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_US_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LanguageCode::en_US;
-          }
-          else if (hashCode == es_US_HASH)
-          {
-            return LanguageCode::es_US;
+          case en_US_HASH:
+            if (name == "en-US")
+            {
+              return LanguageCode::en_US;
+            }
+            break;
+          case es_US_HASH:
+            if (name == "es-US")
+            {
+              return LanguageCode::es_US;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return LanguageCode::NOT_SET;
         }
 
-        Aws::String GetNameForLanguageCode(LanguageCode enumValue)
+        const char* GetNameForLanguageCode(LanguageCode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,30 +30,44 @@ namespace Aws
       namespace MediaFormatMapper
       {
 
-        static const int mp3_HASH = HashingUtils::HashString("mp3");
-        static const int mp4_HASH = HashingUtils::HashString("mp4");
-        static const int wav_HASH = HashingUtils::HashString("wav");
-        static const int flac_HASH = HashingUtils::HashString("flac");
+        static constexpr int mp3_HASH = HashingUtils::CompileTimeHashString("mp3");
+        static constexpr int mp4_HASH = HashingUtils::CompileTimeHashString("mp4");
+        static constexpr int wav_HASH = HashingUtils::CompileTimeHashString("wav");
+        static constexpr int flac_HASH = HashingUtils::CompileTimeHashString("flac");
 
 
         MediaFormat GetMediaFormatForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == mp3_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MediaFormat::mp3;
-          }
-          else if (hashCode == mp4_HASH)
-          {
-            return MediaFormat::mp4;
-          }
-          else if (hashCode == wav_HASH)
-          {
-            return MediaFormat::wav;
-          }
-          else if (hashCode == flac_HASH)
-          {
-            return MediaFormat::flac;
+          case mp3_HASH:
+            if (name == "mp3")
+            {
+              return MediaFormat::mp3;
+            }
+            break;
+          case mp4_HASH:
+            if (name == "mp4")
+            {
+              return MediaFormat::mp4;
+            }
+            break;
+          case wav_HASH:
+            if (name == "wav")
+            {
+              return MediaFormat::wav;
+            }
+            break;
+          case flac_HASH:
+            if (name == "flac")
+            {
+              return MediaFormat::flac;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return MediaFormat::NOT_SET;
         }
 
-        Aws::String GetNameForMediaFormat(MediaFormat enumValue)
+        const char* GetNameForMediaFormat(MediaFormat enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
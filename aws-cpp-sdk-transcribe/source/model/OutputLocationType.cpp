@@ -30,20 +30,30 @@ namespace Aws
       namespace OutputLocationTypeMapper
       {
 
-        static const int CUSTOMER_BUCKET_HASH = HashingUtils::HashString("CUSTOMER_BUCKET");
-        static const int SERVICE_BUCKET_HASH = HashingUtils::HashString("SERVICE_BUCKET");
+        static constexpr int CUSTOMER_BUCKET_HASH = HashingUtils::CompileTimeHashString("CUSTOMER_BUCKET");
+        static constexpr int SERVICE_BUCKET_HASH = HashingUtils::CompileTimeHashString("SERVICE_BUCKET");
 
 
         OutputLocationType GetOutputLocationTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CUSTOMER_BUCKET_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return OutputLocationType::CUSTOMER_BUCKET;
-          }
-          else if (hashCode == SERVICE_BUCKET_HASH)
-          {
-            return OutputLocationType::SERVICE_BUCKET;
+          case CUSTOMER_BUCKET_HASH:
+            if (name == "CUSTOMER_BUCKET")
+            {
+              return OutputLocationType::CUSTOMER_BUCKET;
+            }
+            break;
+          case SERVICE_BUCKET_HASH:
+            if (name == "SERVICE_BUCKET")
+            {
+              return OutputLocationType::SERVICE_BUCKET;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return OutputLocationType::NOT_SET;
         }
 
-        Aws::String GetNameForOutputLocationType(OutputLocationType enumValue)
+        const char* GetNameForOutputLocationType(OutputLocationType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
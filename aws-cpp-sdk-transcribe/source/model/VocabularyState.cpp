@@ -30,25 +30,37 @@ namespace Aws
       namespace VocabularyStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int READY_HASH = HashingUtils::HashString("READY");
-        static const int FAILED_HASH = HashingUtils::HashString("FAILED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int READY_HASH = HashingUtils::CompileTimeHashString("READY");
+        static constexpr int FAILED_HASH = HashingUtils::CompileTimeHashString("FAILED");
 
 
         VocabularyState GetVocabularyStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return VocabularyState::PENDING;
-          }
-          else if (hashCode == READY_HASH)
-          {
-            return VocabularyState::READY;
-          }
-          else if (hashCode == FAILED_HASH)
-          {
-            return VocabularyState::FAILED;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return VocabularyState::PENDING;
+            }
+            break;
+          case READY_HASH:
+            if (name == "READY")
+            {
+              return VocabularyState::READY;
+            }
+            break;
+          case FAILED_HASH:
+            if (name == "FAILED")
+            {
+              return VocabularyState::FAILED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return VocabularyState::NOT_SET;
         }
 
-        Aws::String GetNameForVocabularyState(VocabularyState enumValue)
+        const char* GetNameForVocabularyState(VocabularyState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
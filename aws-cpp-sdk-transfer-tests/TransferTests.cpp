@@ -160,7 +160,8 @@ class MockS3Client : public S3Client
 {
 public:
     MockS3Client(const Aws::Client::ClientConfiguration& clientConfiguration = Aws::Client::ClientConfiguration()):
-        S3Client(clientConfiguration), executor(clientConfiguration.executor), listObjectsV2RequestCount(0) 
+        S3Client(clientConfiguration), executor(clientConfiguration.executor), listObjectsV2RequestCount(0), putObjectsInFlight(0),
+        maxPutObjectsInFlight(0)
     {}
 
     ~MockS3Client() 
@@ -171,11 +172,19 @@ public:
     // Override this function to do verification.
     void ListObjectsV2Async(const Model::ListObjectsV2Request& request, const ListObjectsV2ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
     {
-        EXPECT_STREQ("", request.GetDelimiter().c_str());
-        EXPECT_STREQ("nestedTest", request.GetPrefix().c_str());
+        {
+            std::lock_guard<std::mutex> locker(listObjectsV2RequestsLock);
+            listObjectsV2Requests.push_back(request);
+        }
         executor->Submit( [this, request, handler, context](){ this->ListObjectsV2AsyncHelper( request, handler, context ); } );
     }
 
+    Aws::Vector<ListObjectsV2Request> GetListObjectsV2Requests() const
+    {
+        std::lock_guard<std::mutex> locker(listObjectsV2RequestsLock);
+        return listObjectsV2Requests;
+    }
+
     // This function is private in base class (S3Client), but will be called by ListObjectsV2Async.
     void ListObjectsV2AsyncHelper(const ListObjectsV2Request& request, const ListObjectsV2ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
     {
@@ -183,11 +192,33 @@ public:
         handler(this, request, ListObjectsV2(request), context);
     }
 
+    // Override this function to count the uploads in flight, until their outcome is known.
+    void PutObjectAsync(const Model::PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const override
+    {
+        unsigned int inFlight = ++putObjectsInFlight;
+        unsigned int maxInFlight = maxPutObjectsInFlight;
+        while (inFlight > maxInFlight && !maxPutObjectsInFlight.compare_exchange_weak(maxInFlight, inFlight))
+        {
+        }
+        executor->Submit( [this, request, handler, context]()
+        {
+            auto outcome = PutObject(request);
+            --putObjectsInFlight;
+            handler(this, request, outcome, context);
+        } );
+    }
+
     // m_executor in Base class is private, we need our own one.
     std::shared_ptr<Aws::Utils::Threading::Executor> executor;
 
     // Declared as mutable in order to get updated in constness function.
     mutable std::atomic<unsigned int> listObjectsV2RequestCount;
+    mutable std::atomic<unsigned int> putObjectsInFlight;
+    mutable std::atomic<unsigned int> maxPutObjectsInFlight;
+
+private:
+    mutable std::mutex listObjectsV2RequestsLock;
+    mutable Aws::Vector<ListObjectsV2Request> listObjectsV2Requests;
 };
 
 class TransferTests : public ::testing::Test
@@ -725,6 +756,85 @@ TEST_F(TransferTests, TransferManager_SmallTest)
 }
 
 
+// A file small enough for a single PutObject is streamed from disk and doesn't wait for a buffer of the pool.
+TEST_F(TransferTests, TransferManager_SmallFileWithoutBuffersTest)
+{
+    Aws::String smallTestFileName = MakeFilePath( SMALL_TEST_FILE_NAME );
+    ScopedTestFile testFile(smallTestFileName, SMALL_TEST_SIZE, testString);
+
+    if (EmptyBucket(GetTestBucketName()))
+    {
+        WaitForBucketToEmpty(GetTestBucketName());
+    }
+
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+    // the pool has no buffer at all, a transfer acquiring one would never finish
+    transferManagerConfig.transferBufferMaxHeapSize = 0;
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    std::shared_ptr<TransferHandle> requestPtr = transferManager->UploadFile(smallTestFileName, GetTestBucketName(), SMALL_FILE_KEY, "text/plain", Aws::Map<Aws::String, Aws::String>());
+    requestPtr->WaitUntilFinished();
+
+    ASSERT_EQ(TransferStatus::COMPLETED, requestPtr->GetStatus());
+    ASSERT_FALSE(requestPtr->IsMultipart());
+    uint64_t fileSize = requestPtr->GetBytesTotalSize();
+    ASSERT_EQ(fileSize, (SMALL_TEST_SIZE / testStrLen * testStrLen));
+    ASSERT_EQ(fileSize, requestPtr->GetBytesTransferred());
+
+    ASSERT_TRUE(WaitForObjectToPropagate(GetTestBucketName(), SMALL_FILE_KEY));
+    HeadObjectRequest headObjectRequest;
+    headObjectRequest.WithBucket(GetTestBucketName())
+        .WithKey(SMALL_FILE_KEY);
+    auto headObjectOutcome = m_s3Client->HeadObject(headObjectRequest);
+    ASSERT_TRUE(headObjectOutcome.IsSuccess());
+    ASSERT_EQ(static_cast<long long>(fileSize), headObjectOutcome.GetResult().GetContentLength());
+}
+
+// Small files don't take a buffer of the pool, but each holds an open file while in flight, so only so many are uploaded at once.
+TEST_F(TransferTests, TransferManager_SmallFilesInFlightAreBoundedTest)
+{
+    static const size_t FILE_COUNT = 8;
+    static const size_t MAX_IN_FLIGHT = 2;
+
+    if (EmptyBucket(GetTestBucketName()))
+    {
+        WaitForBucketToEmpty(GetTestBucketName());
+    }
+
+    Aws::Vector<Aws::String> fileNames;
+    Aws::Vector<std::shared_ptr<ScopedTestFile>> testFiles;
+    for (size_t i = 0; i < FILE_COUNT; ++i)
+    {
+        fileNames.push_back(MakeFilePath((Aws::String("InFlight") + Aws::Utils::StringUtils::to_string(i) + CONTENT_TEST_FILE_NAME).c_str()));
+        testFiles.push_back(Aws::MakeShared<ScopedTestFile>(ALLOCATION_TAG, fileNames.back(), CONTENT_TEST_FILE_TEXT));
+    }
+
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+    // a single buffer, so the limit is maxDirectoryTransfersInFlight, for files uploaded one by one as well
+    transferManagerConfig.transferBufferMaxHeapSize = transferManagerConfig.bufferSize;
+    transferManagerConfig.maxDirectoryTransfersInFlight = MAX_IN_FLIGHT;
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    m_s3Client->maxPutObjectsInFlight = 0;
+    Aws::Vector<std::shared_ptr<TransferHandle>> handles;
+    for (size_t i = 0; i < FILE_COUNT; ++i)
+    {
+        handles.push_back(transferManager->UploadFile(fileNames[i], GetTestBucketName(), CONTENT_FILE_KEY + Aws::Utils::StringUtils::to_string(i),
+                                                      "text/plain", Aws::Map<Aws::String, Aws::String>()));
+    }
+
+    for (const auto& handle : handles)
+    {
+        handle->WaitUntilFinished();
+        ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+        ASSERT_FALSE(handle->IsMultipart());
+    }
+    ASSERT_GE(MAX_IN_FLIGHT, m_s3Client->maxPutObjectsInFlight.load());
+    ASSERT_LT(0u, m_s3Client->maxPutObjectsInFlight.load());
+}
+
 TEST_F(TransferTests, TransferManager_ContentTest)
 {
     Aws::String contentTestFileName = MakeFilePath( CONTENT_TEST_FILE_NAME );
@@ -905,6 +1015,280 @@ TEST_F(TransferTests, TransferManager_DirectoryUploadAndDownloadTest)
 
     // Verify that the updated DownloadToDirectory function only trigger ListObjectsV2Requst once
     ASSERT_EQ(1u, m_s3Client->listObjectsV2RequestCount);
+    auto listRequests = m_s3Client->GetListObjectsV2Requests();
+    ASSERT_EQ(1u, listRequests.size());
+    ASSERT_STREQ("", listRequests[0].GetDelimiter().c_str());
+    ASSERT_STREQ("nestedTest", listRequests[0].GetPrefix().c_str());
+}
+
+TEST_F(TransferTests, TransferManager_DirectorySyncUploadTest)
+{
+    auto uploadDir = Aws::FileSystem::Join(GetTestFilesDirectory(), "dirSync");
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(uploadDir.c_str()));
+    auto smallTestFileName = Aws::FileSystem::Join(uploadDir, SMALL_TEST_FILE_NAME);
+    auto contentTestFileName = Aws::FileSystem::Join(uploadDir, CONTENT_TEST_FILE_NAME);
+    auto nestedDirectory = Aws::FileSystem::Join(uploadDir, "nested");
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(nestedDirectory.c_str()));
+    auto nestedFileName = Aws::FileSystem::Join(nestedDirectory, "nestedFile");
+
+    ScopedTestFile smallFile(smallTestFileName, SMALL_TEST_SIZE, testString);
+    ScopedTestFile contentFile(contentTestFileName, CONTENT_TEST_FILE_TEXT);
+    ScopedTestFile nestedFile(nestedFileName, CONTENT_TEST_FILE_TEXT);
+
+    if (EmptyBucket(GetTestBucketName()))
+    {
+        WaitForBucketToEmpty(GetTestBucketName());
+    }
+
+    Aws::Vector<std::shared_ptr<TransferHandle>> directoryUploads;
+    size_t unchangedFiles = 0;
+    std::condition_variable directorySignal;
+    std::mutex semaphoreLock;
+
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+    // a single slot, so the files of the tree wait for each other
+    transferManagerConfig.maxDirectoryTransfersInFlight = 1;
+    transferManagerConfig.transferInitiatedCallback = [&](const TransferManager*, const std::shared_ptr<const TransferHandle>& handle)
+        {
+            std::lock_guard<std::mutex> m(semaphoreLock);
+            directoryUploads.push_back(std::const_pointer_cast<TransferHandle>(handle));
+            directorySignal.notify_one();
+        };
+    transferManagerConfig.transferStatusUpdatedCallback = [&](const TransferManager*, const std::shared_ptr<const TransferHandle>& handle)
+        {
+            if (handle->GetStatus() == TransferStatus::EXACT_OBJECT_ALREADY_EXISTS)
+            {
+                std::lock_guard<std::mutex> m(semaphoreLock);
+                unchangedFiles++;
+                directorySignal.notify_one();
+            }
+        };
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    transferManager->UploadDirectory(uploadDir, GetTestBucketName(), "syncTest", Aws::Map<Aws::String, Aws::String>(), DirectoryTransferMode::TRANSFER_CHANGED);
+
+    {
+        std::unique_lock<std::mutex> locker(semaphoreLock);
+        ASSERT_TRUE(directorySignal.wait_for(locker, std::chrono::seconds(60), [&] { return directoryUploads.size() == 3; }));
+    }
+    ASSERT_EQ(0u, unchangedFiles);
+
+    for (auto handle : directoryUploads)
+    {
+        handle->WaitUntilFinished();
+        ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+        ASSERT_TRUE(WaitForObjectToPropagate(GetTestBucketName(), handle->GetKey().c_str()));
+    }
+
+    {
+        std::lock_guard<std::mutex> m(semaphoreLock);
+        directoryUploads.clear();
+    }
+
+    // only the file that changed size is uploaded again
+    ScopedTestFile changedContentFile(contentTestFileName, "This is a changed test.");
+    transferManager->UploadDirectory(uploadDir, GetTestBucketName(), "syncTest", Aws::Map<Aws::String, Aws::String>(), DirectoryTransferMode::TRANSFER_CHANGED);
+
+    {
+        std::unique_lock<std::mutex> locker(semaphoreLock);
+        ASSERT_TRUE(directorySignal.wait_for(locker, std::chrono::seconds(60), [&] { return directoryUploads.size() == 1 && unchangedFiles == 2; }));
+    }
+
+    ASSERT_EQ(contentTestFileName, directoryUploads[0]->GetTargetFilePath());
+    directoryUploads[0]->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, directoryUploads[0]->GetStatus());
+}
+
+TEST_F(TransferTests, TransferManager_DirectorySyncDownloadTest)
+{
+    auto uploadDir = Aws::FileSystem::Join(GetTestFilesDirectory(), "dirSyncSource");
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(uploadDir.c_str()));
+    auto contentTestFileName = Aws::FileSystem::Join(uploadDir, CONTENT_TEST_FILE_NAME);
+    auto otherTestFileName = Aws::FileSystem::Join(uploadDir, "otherFile");
+    auto nestedDirectory = Aws::FileSystem::Join(uploadDir, "nested");
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(nestedDirectory.c_str()));
+    auto nestedFileName = Aws::FileSystem::Join(nestedDirectory, "nestedFile");
+
+    ScopedTestFile contentFile(contentTestFileName, CONTENT_TEST_FILE_TEXT);
+    ScopedTestFile otherFile(otherTestFileName, "This is another test.");
+    ScopedTestFile nestedFile(nestedFileName, CONTENT_TEST_FILE_TEXT);
+
+    if (EmptyBucket(GetTestBucketName()))
+    {
+        WaitForBucketToEmpty(GetTestBucketName());
+    }
+
+    Aws::Vector<std::shared_ptr<TransferHandle>> directoryUploads;
+    Aws::Vector<std::shared_ptr<TransferHandle>> directoryDownloads;
+    size_t unchangedFiles = 0;
+    std::condition_variable directorySignal;
+    std::mutex semaphoreLock;
+
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+    transferManagerConfig.transferInitiatedCallback = [&](const TransferManager*, const std::shared_ptr<const TransferHandle>& handle)
+        {
+            std::lock_guard<std::mutex> m(semaphoreLock);
+            auto& handles = handle->GetTransferDirection() == TransferDirection::UPLOAD ? directoryUploads : directoryDownloads;
+            handles.push_back(std::const_pointer_cast<TransferHandle>(handle));
+            directorySignal.notify_one();
+        };
+    transferManagerConfig.transferStatusUpdatedCallback = [&](const TransferManager*, const std::shared_ptr<const TransferHandle>& handle)
+        {
+            if (handle->GetStatus() == TransferStatus::EXACT_OBJECT_ALREADY_EXISTS)
+            {
+                std::lock_guard<std::mutex> m(semaphoreLock);
+                unchangedFiles++;
+                directorySignal.notify_one();
+            }
+        };
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    transferManager->UploadDirectory(uploadDir, GetTestBucketName(), "syncDownloadTest", Aws::Map<Aws::String, Aws::String>());
+
+    {
+        std::unique_lock<std::mutex> locker(semaphoreLock);
+        ASSERT_TRUE(directorySignal.wait_for(locker, std::chrono::seconds(60), [&] { return directoryUploads.size() == 3; }));
+    }
+
+    for (auto handle : directoryUploads)
+    {
+        handle->WaitUntilFinished();
+        ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+        ASSERT_TRUE(WaitForObjectToPropagate(GetTestBucketName(), handle->GetKey().c_str()));
+    }
+
+    auto downloadDir = Aws::FileSystem::Join(GetTestFilesDirectory(), "dirSyncDownload");
+    size_t listRequestsBefore = m_s3Client->GetListObjectsV2Requests().size();
+    transferManager->DownloadToDirectory(downloadDir, GetTestBucketName(), "syncDownloadTest", DirectoryTransferMode::TRANSFER_CHANGED);
+
+    {
+        std::unique_lock<std::mutex> locker(semaphoreLock);
+        ASSERT_TRUE(directorySignal.wait_for(locker, std::chrono::seconds(60), [&] { return directoryDownloads.size() == 3; }));
+    }
+    ASSERT_EQ(0u, unchangedFiles);
+
+    for (auto handle : directoryDownloads)
+    {
+        handle->WaitUntilFinished();
+        ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+    }
+
+    Aws::FileSystem::DirectoryTree uploadTree(uploadDir);
+    Aws::FileSystem::DirectoryTree downloadTree(downloadDir);
+    ASSERT_EQ(uploadTree, downloadTree);
+
+    // the bucket is listed a level at a time, the root and the nested directory
+    auto listRequests = m_s3Client->GetListObjectsV2Requests();
+    ASSERT_EQ(listRequestsBefore + 2, listRequests.size());
+    for (size_t i = listRequestsBefore; i < listRequests.size(); ++i)
+    {
+        ASSERT_STREQ("/", listRequests[i].GetDelimiter().c_str());
+    }
+
+    {
+        std::lock_guard<std::mutex> m(semaphoreLock);
+        directoryDownloads.clear();
+    }
+
+    // the files just downloaded are newer than their objects
+    transferManager->DownloadToDirectory(downloadDir, GetTestBucketName(), "syncDownloadTest", DirectoryTransferMode::TRANSFER_CHANGED);
+
+    {
+        std::unique_lock<std::mutex> locker(semaphoreLock);
+        ASSERT_TRUE(directorySignal.wait_for(locker, std::chrono::seconds(60), [&] { return unchangedFiles == 3; }));
+        ASSERT_EQ(0u, directoryDownloads.size());
+    }
+
+    // only the local file that changed size is downloaded again
+    auto changedFileName = Aws::FileSystem::Join(downloadDir, CONTENT_TEST_FILE_NAME);
+    ScopedTestFile changedFile(changedFileName, "This is a changed test.");
+    transferManager->DownloadToDirectory(downloadDir, GetTestBucketName(), "syncDownloadTest", DirectoryTransferMode::TRANSFER_CHANGED);
+
+    {
+        std::unique_lock<std::mutex> locker(semaphoreLock);
+        ASSERT_TRUE(directorySignal.wait_for(locker, std::chrono::seconds(60), [&] { return directoryDownloads.size() == 1 && unchangedFiles == 5; }));
+    }
+
+    ASSERT_EQ(changedFileName, directoryDownloads[0]->GetTargetFilePath());
+    directoryDownloads[0]->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, directoryDownloads[0]->GetStatus());
+    ASSERT_TRUE(AreFilesSame(contentTestFileName, changedFileName));
+}
+
+TEST_F(TransferTests, TransferManager_DirectorySyncComparesETagWithMD5)
+{
+    auto uploadDir = Aws::FileSystem::Join(GetTestFilesDirectory(), "dirSyncMD5");
+    ASSERT_TRUE(Aws::FileSystem::CreateDirectoryIfNotExists(uploadDir.c_str()));
+    auto rewrittenFileName = Aws::FileSystem::Join(uploadDir, "rewrittenFile");
+    auto changedFileName = Aws::FileSystem::Join(uploadDir, "changedFile");
+
+    ScopedTestFile rewrittenFile(rewrittenFileName, CONTENT_TEST_FILE_TEXT);
+    ScopedTestFile changedFile(changedFileName, CONTENT_TEST_FILE_TEXT);
+
+    if (EmptyBucket(GetTestBucketName()))
+    {
+        WaitForBucketToEmpty(GetTestBucketName());
+    }
+
+    Aws::Vector<std::shared_ptr<TransferHandle>> directoryUploads;
+    size_t unchangedFiles = 0;
+    std::condition_variable directorySignal;
+    std::mutex semaphoreLock;
+
+    TransferManagerConfiguration transferManagerConfig(m_executor.get());
+    transferManagerConfig.s3Client = m_s3Client;
+    transferManagerConfig.transferInitiatedCallback = [&](const TransferManager*, const std::shared_ptr<const TransferHandle>& handle)
+        {
+            std::lock_guard<std::mutex> m(semaphoreLock);
+            directoryUploads.push_back(std::const_pointer_cast<TransferHandle>(handle));
+            directorySignal.notify_one();
+        };
+    transferManagerConfig.transferStatusUpdatedCallback = [&](const TransferManager*, const std::shared_ptr<const TransferHandle>& handle)
+        {
+            if (handle->GetStatus() == TransferStatus::EXACT_OBJECT_ALREADY_EXISTS)
+            {
+                std::lock_guard<std::mutex> m(semaphoreLock);
+                unchangedFiles++;
+                directorySignal.notify_one();
+            }
+        };
+    auto transferManager = TransferManager::Create(transferManagerConfig);
+
+    transferManager->UploadDirectory(uploadDir, GetTestBucketName(), "syncMD5Test", Aws::Map<Aws::String, Aws::String>(), DirectoryTransferMode::TRANSFER_CHANGED);
+
+    {
+        std::unique_lock<std::mutex> locker(semaphoreLock);
+        ASSERT_TRUE(directorySignal.wait_for(locker, std::chrono::seconds(60), [&] { return directoryUploads.size() == 2; }));
+    }
+
+    for (auto handle : directoryUploads)
+    {
+        handle->WaitUntilFinished();
+        ASSERT_EQ(TransferStatus::COMPLETED, handle->GetStatus());
+        ASSERT_TRUE(WaitForObjectToPropagate(GetTestBucketName(), handle->GetKey().c_str()));
+    }
+
+    {
+        std::lock_guard<std::mutex> m(semaphoreLock);
+        directoryUploads.clear();
+    }
+
+    // both files are now newer than their objects and still the same size, only the content of one of them changed
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    ScopedTestFile sameContentFile(rewrittenFileName, CONTENT_TEST_FILE_TEXT);
+    ScopedTestFile sameSizeFile(changedFileName, "This is a tset..");
+    transferManager->UploadDirectory(uploadDir, GetTestBucketName(), "syncMD5Test", Aws::Map<Aws::String, Aws::String>(), DirectoryTransferMode::TRANSFER_CHANGED);
+
+    {
+        std::unique_lock<std::mutex> locker(semaphoreLock);
+        ASSERT_TRUE(directorySignal.wait_for(locker, std::chrono::seconds(60), [&] { return directoryUploads.size() == 1 && unchangedFiles == 1; }));
+    }
+
+    ASSERT_EQ(changedFileName, directoryUploads[0]->GetTargetFilePath());
+    directoryUploads[0]->WaitUntilFinished();
+    ASSERT_EQ(TransferStatus::COMPLETED, directoryUploads[0]->GetStatus());
 }
 
 // Test of a basic multi part upload - 7.5 megs
@@ -21,11 +21,14 @@
 #include <aws/s3/model/CreateMultipartUploadRequest.h>
 #include <aws/s3/model/UploadPartRequest.h>
 #include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/Semaphore.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/ResourceManager.h>
 #include <aws/core/client/AsyncCallerContext.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
 
 #include <memory>
+#include <mutex>
 
 namespace Aws
 {    
@@ -41,12 +44,29 @@ namespace Aws
 
         const uint64_t MB5 = 5 * 1024 * 1024;
 
+        /**
+         * Which files UploadDirectory and DownloadToDirectory transfer.
+         */
+        enum class DirectoryTransferMode
+        {
+            //Every file is transferred
+            TRANSFER_ALL,
+            //Only files that are missing on the other side or differ from their counterpart are transferred.
+            //A file and an object are the same when their sizes match and either the copy that would be overwritten is the newer one,
+            //or the object's ETag is the MD5 of the file. Unchanged files are reported through transferStatusUpdatedCallback
+            //with the status EXACT_OBJECT_ALREADY_EXISTS.
+            TRANSFER_CHANGED
+        };
+
+        struct DirectoryTransferContext;
+
         /**
          * Configuration for use with TransferManager. The data here will be copied directly to TransferManager.
          */
         struct TransferManagerConfiguration
         {
-            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5)
+            TransferManagerConfiguration(Aws::Utils::Threading::Executor* executor) : s3Client(nullptr), transferExecutor(executor), transferBufferMaxHeapSize(10 * MB5), bufferSize(MB5),
+                maxDirectoryTransfersInFlight(64)
             {
             }
 
@@ -86,6 +106,18 @@ namespace Aws
              * to increase your max heap size if this is something you plan on increasing.
              */
             uint64_t bufferSize;
+            /**
+             * Maximum number of transfers each UploadDirectory or DownloadToDirectory call with DirectoryTransferMode::TRANSFER_CHANGED keeps in flight.
+             * Further files wait until one of them finishes, and directories are only read ahead as far as needed to keep the transfers busy, so memory
+             * stays bounded on very large trees. Calls with TRANSFER_ALL start every transfer as soon as its file is found, as they always have.
+             * Files no larger than bufferSize are streamed from disk rather than through the buffers of transferBufferMaxHeapSize. Each of those
+             * uploads holds an open file, so across all uploads of the manager, whatever their mode, at most this many of them are in flight, or
+             * as many as transferBufferMaxHeapSize / bufferSize if that is more; further ones wait for one of them to finish. For trees of small
+             * files this can be raised to hundreds, as far as the open file limit of the process allows; how many requests actually run at once
+             * is up to the executor and maxConnections of the S3 client.
+             * Defaults to 64, 0 means no limit.
+             */
+            size_t maxDirectoryTransfersInFlight;
 
             /**
              * Callback to receive progress updates for uploads.
@@ -201,8 +233,12 @@ namespace Aws
              * directory: the absolute directory on disk to upload
              * bucketName: the name of the S3 bucket to upload to
              * prefix: the prefix to put on all objects uploaded (e.g. put them in x directory in the bucket).
+             * mode: whether to upload every file or only the ones that changed since the objects under prefix were written.
+             *
+             * Sub directories are read in parallel on the transfer executor.
              */
-            void UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata);
+            void UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata,
+                                 DirectoryTransferMode mode = DirectoryTransferMode::TRANSFER_ALL);
 
             /**
             * Downloads entire contents of an Amazon S3 bucket starting at prefix stores them in a directory (not including the prefix). This is an asynchronous method. You will receive notifications
@@ -212,8 +248,11 @@ namespace Aws
             * directory: the absolute directory on disk to download to
             * bucketName: the name of the S3 bucket to upload to
             * prefix: the prefix in the bucket to use as the root directory (e.g. download all objects at x prefix in S3 and then store them starting in directory with the prefix stripped out).
+            * mode: whether to download every object or only the ones that changed since the files in directory were written. With TRANSFER_CHANGED, the bucket
+            *       is listed one '/' delimited level at a time, and the levels are listed in parallel on the transfer executor.
             */
-            void DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix = Aws::String());
+            void DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix = Aws::String(),
+                                     DirectoryTransferMode mode = DirectoryTransferMode::TRANSFER_ALL);
 
         private:
             /**
@@ -270,6 +309,8 @@ namespace Aws
 
             void DoMultiPartUpload(const std::shared_ptr<TransferHandle>& handle);
             void DoSinglePartUpload(const std::shared_ptr<TransferHandle>& handle);
+            void DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& body, const std::shared_ptr<TransferHandle>& handle,
+                                    const Aws::S3::PutObjectResponseReceivedHandler& callback);
 
             void DoDownload(const std::shared_ptr<TransferHandle>& handle);
             void DoSinglePartDownload(const std::shared_ptr<TransferHandle>& handle);
@@ -283,18 +324,41 @@ namespace Aws
 
             void HandleUploadPartResponse(const Aws::S3::S3Client*, const Aws::S3::Model::UploadPartRequest&, const Aws::S3::Model::UploadPartOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
             void HandlePutObjectResponse(const Aws::S3::S3Client*, const Aws::S3::Model::PutObjectRequest&, const Aws::S3::Model::PutObjectOutcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
+
+            /**
+             * Starts waiting transfers and directory scans of a directory operation, as far as its limits allow.
+             */
+            void ScheduleDirectoryTransfers(const std::shared_ptr<DirectoryTransferContext>& context);
+            /**
+             * Reads one level of a directory operation: a local directory for uploads, a page of the listing for downloads (in HandleListObjectsResponse).
+             * Files to transfer and further levels to read are queued on the context, then FinishDirectoryScan is called.
+             */
+            void ScanLocalDirectory(const std::shared_ptr<DirectoryTransferContext>& context, const Aws::String& relativePath);
+            void ListBucketPrefix(const std::shared_ptr<DirectoryTransferContext>& context, const Aws::String& relativePath, const Aws::String& continuationToken);
             void HandleListObjectsResponse(const Aws::S3::S3Client*, const Aws::S3::Model::ListObjectsV2Request&, const Aws::S3::Model::ListObjectsV2Outcome&, const std::shared_ptr<const Aws::Client::AsyncCallerContext>&);
+            void FinishDirectoryScan(const std::shared_ptr<DirectoryTransferContext>& context);
+            void ReportUnchangedFile(const DirectoryTransferContext& context, const Aws::String& fileName, const Aws::String& keyName, uint64_t size);
+            /**
+             * Frees the directory operation's slot held by handle once it finishes. Returns false if it has finished already, the caller then frees the slot.
+             */
+            bool TrackDirectoryTransfer(const std::shared_ptr<DirectoryTransferContext>& context, const std::shared_ptr<TransferHandle>& handle);
 
             TransferStatus DetermineIfFailedOrCanceled(const TransferHandle&) const;
             void TriggerUploadProgressCallback(const std::shared_ptr<const TransferHandle>&) const;
             void TriggerDownloadProgressCallback(const std::shared_ptr<const TransferHandle>&) const;
-            void TriggerTransferStatusUpdatedCallback(const std::shared_ptr<const TransferHandle>&) const;
+            void TriggerTransferStatusUpdatedCallback(const std::shared_ptr<const TransferHandle>&);
             void TriggerErrorCallback(const std::shared_ptr<const TransferHandle>&, const Aws::Client::AWSError<Aws::S3::S3Errors>& error)const;
 
             static Aws::String DetermineFilePath(const Aws::String& directory, const Aws::String& prefix, const Aws::String& keyName);
 
             Aws::Utils::ExclusiveOwnershipResourceManager<Aws::Utils::Array<uint8_t>*> m_bufferManager;
             TransferManagerConfiguration m_transferConfig;
+            // single-part uploads of files, which hold an open file rather than a buffer of m_bufferManager while in flight
+            Aws::Utils::Threading::Semaphore m_singlePartUploadSlots;
+
+            std::mutex m_directoryTransfersLock;
+            // transfers started by directory operations, until they finish
+            Aws::UnorderedMap<const TransferHandle*, std::shared_ptr<DirectoryTransferContext>> m_directoryTransfers;
         };
 
         
@@ -18,6 +18,7 @@
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSQueue.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/FileSystemUtils.h>
 #include <aws/core/platform/FileSystem.h>
@@ -47,12 +48,108 @@ namespace Aws
             PartPointer partState;
         };
 
-        struct DownloadDirectoryContext : public Aws::Client::AsyncCallerContext
+        static inline bool IsFinishedStatus(TransferStatus status)
+        {
+            return status != TransferStatus::NOT_STARTED && status != TransferStatus::IN_PROGRESS;
+        }
+
+        // directory levels of one operation read at the same time
+        static const size_t MAX_DIRECTORY_SCANS_IN_FLIGHT = 8;
+
+        struct DirectoryTransferContext
         {
-            Aws::String rootDirectory;
+            DirectoryTransferContext(TransferDirection transferDirection, DirectoryTransferMode transferMode, const Aws::String& rootDirectory,
+                                     const Aws::String& bucket, const Aws::String& keyPrefix) :
+                direction(transferDirection), mode(transferMode), directory(rootDirectory), bucketName(bucket), prefix(keyPrefix),
+                scansInFlight(0), transfersInFlight(0)
+            {
+            }
+
+            TransferDirection direction;
+            DirectoryTransferMode mode;
+            Aws::String directory;
+            Aws::String bucketName;
             Aws::String prefix;
+            Aws::Map<Aws::String, Aws::String> metadata;
+
+            std::mutex lock;
+            // levels waiting to be read: the path relative to the root and, for listings, the continuation token
+            Aws::Queue<std::pair<Aws::String, Aws::String>> pendingScans;
+            // files waiting for a transfer slot: the file path and the key
+            Aws::Queue<std::pair<Aws::String, Aws::String>> pendingFiles;
+            size_t scansInFlight;
+            size_t transfersInFlight;
+        };
+
+        struct DownloadDirectoryContext : public Aws::Client::AsyncCallerContext
+        {
+            std::shared_ptr<DirectoryTransferContext> transfer;
+            Aws::String relativePath;
         };
 
+        static Aws::String ReplaceDelimiter(const Aws::String& path, const char* from, const char* to)
+        {
+            Aws::String result = path;
+            Aws::Utils::StringUtils::Replace(result, from, to);
+            return result;
+        }
+
+        static Aws::String ToKeyPath(const Aws::String& relativePath)
+        {
+            char delimiter[] = { Aws::FileSystem::PATH_DELIM, 0 };
+            return ReplaceDelimiter(relativePath, delimiter, "/");
+        }
+
+        static Aws::String ToFilePath(const Aws::String& keyPath)
+        {
+            char delimiter[] = { Aws::FileSystem::PATH_DELIM, 0 };
+            return ReplaceDelimiter(keyPath, "/", delimiter);
+        }
+
+        static Aws::String GetListingRootPrefix(const DirectoryTransferContext& context)
+        {
+            if (context.mode == DirectoryTransferMode::TRANSFER_CHANGED && !context.prefix.empty() && !IsS3KeyPrefix(context.prefix))
+            {
+                return context.prefix + "/";
+            }
+            return context.prefix;
+        }
+
+        // A file and an object are the same if their sizes match and either the copy that would be overwritten is the newer one,
+        // or the ETag is the MD5 of the file, which holds for objects put in a single part without KMS encryption.
+        static bool IsUnchanged(const Aws::FileSystem::DirectoryEntry& file, const Aws::S3::Model::Object& object, TransferDirection direction)
+        {
+            if (file.fileSize != object.GetSize())
+            {
+                return false;
+            }
+
+            int64_t objectLastModified = object.GetLastModified().Millis();
+            if (direction == TransferDirection::UPLOAD ? objectLastModified >= file.lastModified : file.lastModified >= objectLastModified)
+            {
+                return true;
+            }
+
+            Aws::String eTag = object.GetETag();
+            eTag.erase(std::remove(eTag.begin(), eTag.end(), '"'), eTag.end());
+            if (eTag.empty() || eTag.find('-') != Aws::String::npos)
+            {
+                return false;
+            }
+
+#ifdef _MSC_VER
+            Aws::FStream fileStream(Aws::Utils::StringUtils::ToWString(file.path.c_str()).c_str(), std::ios_base::in | std::ios_base::binary);
+#else
+            Aws::FStream fileStream(file.path.c_str(), std::ios_base::in | std::ios_base::binary);
+#endif
+            if (!fileStream)
+            {
+                return false;
+            }
+
+            return Aws::Utils::StringUtils::ToLower(eTag.c_str()) == Aws::Utils::HashingUtils::HexEncode(Aws::Utils::HashingUtils::CalculateMD5(fileStream));
+        }
+
         std::shared_ptr<TransferManager> TransferManager::Create(const TransferManagerConfiguration& config)
         {
             // Because TransferManager's ctor is private (to ensure it's always constructed as a shared_ptr)
@@ -65,7 +162,14 @@ namespace Aws
             return Aws::MakeShared<MakeSharedEnabler>(CLASS_TAG, config);
         }
 
-        TransferManager::TransferManager(const TransferManagerConfiguration& configuration) : m_transferConfig(configuration)
+        static size_t MaxSinglePartUploadsInFlight(const TransferManagerConfiguration& config)
+        {
+            size_t buffers = static_cast<size_t>(config.transferBufferMaxHeapSize / config.bufferSize);
+            return (std::max)((std::max)(buffers, config.maxDirectoryTransfersInFlight), static_cast<size_t>(1));
+        }
+
+        TransferManager::TransferManager(const TransferManagerConfiguration& configuration) : m_transferConfig(configuration),
+            m_singlePartUploadSlots(MaxSinglePartUploadsInFlight(configuration), MaxSinglePartUploadsInFlight(configuration))
         {
             assert(m_transferConfig.s3Client);
             assert(m_transferConfig.transferExecutor);
@@ -200,54 +304,369 @@ namespace Aws
             m_transferConfig.transferExecutor->Submit([self, inProgressHandle] { self->WaitForCancellationAndAbortUpload(inProgressHandle); });
         }
 
-        void TransferManager::UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata)
+        void TransferManager::UploadDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, const Aws::Map<Aws::String, Aws::String>& metadata,
+                                              DirectoryTransferMode mode)
         {
             assert(m_transferConfig.transferInitiatedCallback);
 
-            auto self = shared_from_this();
-            auto visitor = [self, bucketName, prefix, metadata](const Aws::FileSystem::DirectoryTree*, const Aws::FileSystem::DirectoryEntry& entry)
+            auto context = Aws::MakeShared<DirectoryTransferContext>(CLASS_TAG, TransferDirection::UPLOAD, mode, directory, bucketName, prefix);
+            context->metadata = metadata;
+            context->pendingScans.emplace(Aws::String(), Aws::String());
+            ScheduleDirectoryTransfers(context);
+        }
+
+        void TransferManager::DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix, DirectoryTransferMode mode)
+        {
+            assert(m_transferConfig.transferInitiatedCallback);
+            Aws::FileSystem::CreateDirectoryIfNotExists(directory.c_str());
+
+            auto context = Aws::MakeShared<DirectoryTransferContext>(CLASS_TAG, TransferDirection::DOWNLOAD, mode, directory, bucketName, prefix);
+            context->pendingScans.emplace(Aws::String(), Aws::String());
+            ScheduleDirectoryTransfers(context);
+        }
+
+        void TransferManager::ScheduleDirectoryTransfers(const std::shared_ptr<DirectoryTransferContext>& context)
+        {
+            // only syncs are bounded, TRANSFER_ALL starts every file as soon as it is found
+            const size_t maxTransfers = context->mode == DirectoryTransferMode::TRANSFER_CHANGED ? m_transferConfig.maxDirectoryTransfersInFlight : 0;
+            auto self = shared_from_this(); // keep transfer manager alive until all scans are finished.
+
+            bool freedSlots(true);
+            while (freedSlots)
             {
-                if (entry && entry.fileType == Aws::FileSystem::FileType::File)
+                freedSlots = false;
+                Aws::Vector<std::pair<Aws::String, Aws::String>> filesToTransfer;
+                Aws::Vector<std::pair<Aws::String, Aws::String>> levelsToScan;
                 {
-                    Aws::StringStream ssKey;
-                    Aws::String relativePath = entry.relativePath;
-                    char delimiter[] = { Aws::FileSystem::PATH_DELIM, 0 };
-                    Aws::Utils::StringUtils::Replace(relativePath, delimiter, "/");
-
-                    ssKey << prefix << "/" << relativePath;
-                    Aws::String keyName = ssKey.str();
-                    AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Uploading file: " << entry.path
-                            << " as part of directory upload to S3 Bucket: [" << bucketName << "] and Key: ["
-                            << keyName << "].");
-                    self->m_transferConfig.transferInitiatedCallback(self.get(), self->UploadFile(entry.path, bucketName, keyName, DEFAULT_CONTENT_TYPE, metadata));
+                    std::lock_guard<std::mutex> locker(context->lock);
+                    while (!context->pendingFiles.empty() && (maxTransfers == 0 || context->transfersInFlight < maxTransfers))
+                    {
+                        filesToTransfer.push_back(std::move(context->pendingFiles.front()));
+                        context->pendingFiles.pop();
+                        ++context->transfersInFlight;
+                    }
+
+                    // only read ahead while the files found so far can't keep the transfers busy
+                    while (!context->pendingScans.empty() && context->scansInFlight < MAX_DIRECTORY_SCANS_IN_FLIGHT &&
+                           (maxTransfers == 0 || context->pendingFiles.size() < maxTransfers))
+                    {
+                        levelsToScan.push_back(std::move(context->pendingScans.front()));
+                        context->pendingScans.pop();
+                        ++context->scansInFlight;
+                    }
                 }
 
-                return true;
-            };
+                for (const auto& level : levelsToScan)
+                {
+                    if (context->direction == TransferDirection::UPLOAD)
+                    {
+                        m_transferConfig.transferExecutor->Submit([self, context, level] { self->ScanLocalDirectory(context, level.first); });
+                    }
+                    else
+                    {
+                        ListBucketPrefix(context, level.first, level.second);
+                    }
+                }
 
-            m_transferConfig.transferExecutor->Submit([directory, visitor]() { Aws::FileSystem::DirectoryTree dir(directory); dir.TraverseDepthFirst(visitor); });
+                for (const auto& file : filesToTransfer)
+                {
+                    std::shared_ptr<TransferHandle> handle;
+                    if (context->direction == TransferDirection::UPLOAD)
+                    {
+                        AWS_LOGSTREAM_DEBUG(CLASS_TAG, "Uploading file: " << file.first
+                                << " as part of directory upload to S3 Bucket: [" << context->bucketName << "] and Key: ["
+                                << file.second << "].");
+                        handle = UploadFile(file.first, context->bucketName, file.second, DEFAULT_CONTENT_TYPE, context->metadata);
+                    }
+                    else
+                    {
+                        AWS_LOGSTREAM_INFO(CLASS_TAG, "Initiating download of key: [" << file.second <<
+                                "] in bucket: [" << context->bucketName << "] to destination file: [" << file.first << "]");
+                        handle = DownloadFile(context->bucketName, file.second, file.first);
+                    }
+
+                    m_transferConfig.transferInitiatedCallback(this, handle);
+                    if (!TrackDirectoryTransfer(context, handle))
+                    {
+                        std::lock_guard<std::mutex> locker(context->lock);
+                        --context->transfersInFlight;
+                        freedSlots = true;
+                    }
+                }
+            }
         }
 
-        void TransferManager::DownloadToDirectory(const Aws::String& directory, const Aws::String& bucketName, const Aws::String& prefix)
+        bool TransferManager::TrackDirectoryTransfer(const std::shared_ptr<DirectoryTransferContext>& context, const std::shared_ptr<TransferHandle>& handle)
         {
-            assert(m_transferConfig.transferInitiatedCallback);
-            Aws::FileSystem::CreateDirectoryIfNotExists(directory.c_str());
-         
-            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
-            auto handler = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::ListObjectsV2Request& request,
-                const Aws::S3::Model::ListObjectsV2Outcome& outcome,
-                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) { self->HandleListObjectsResponse(client, request, outcome, context); };
+            std::lock_guard<std::mutex> locker(m_directoryTransfersLock);
+            // a handle that finished before it got here was not found by its status update
+            if (IsFinishedStatus(handle->GetStatus()))
+            {
+                return false;
+            }
+
+            m_directoryTransfers[handle.get()] = context;
+            return true;
+        }
+
+        void TransferManager::FinishDirectoryScan(const std::shared_ptr<DirectoryTransferContext>& context)
+        {
+            {
+                std::lock_guard<std::mutex> locker(context->lock);
+                --context->scansInFlight;
+            }
+            ScheduleDirectoryTransfers(context);
+        }
+
+        void TransferManager::ScanLocalDirectory(const std::shared_ptr<DirectoryTransferContext>& context, const Aws::String& relativePath)
+        {
+            Aws::String path = relativePath.empty() ? context->directory : Aws::FileSystem::Join(context->directory, relativePath);
+            auto dir = Aws::FileSystem::OpenDirectory(path, relativePath);
+            if (!dir || !*dir)
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Unable to read directory " << path << " as part of directory upload to S3 Bucket: [" << context->bucketName << "].");
+                FinishDirectoryScan(context);
+                return;
+            }
+
+            Aws::Vector<Aws::FileSystem::DirectoryEntry> files;
+            Aws::Vector<std::pair<Aws::String, Aws::String>> subDirectories;
+            while (Aws::FileSystem::DirectoryEntry&& entry = dir->Next())
+            {
+                if (entry.fileType == Aws::FileSystem::FileType::Directory)
+                {
+                    subDirectories.emplace_back(entry.relativePath, Aws::String());
+                }
+                else if (entry.fileType == Aws::FileSystem::FileType::File)
+                {
+                    files.push_back(std::move(entry));
+                }
+            }
+
+            Aws::String keyPrefix = context->prefix + "/";
+            if (!relativePath.empty())
+            {
+                keyPrefix += ToKeyPath(relativePath) + "/";
+            }
+
+            // objects directly under keyPrefix, by name
+            Aws::Map<Aws::String, Aws::S3::Model::Object> objects;
+            bool compare = context->mode == DirectoryTransferMode::TRANSFER_CHANGED && !files.empty();
+            if (compare)
+            {
+                Aws::S3::Model::ListObjectsV2Request request;
+                request.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
+                request.WithBucket(context->bucketName)
+                    .WithPrefix(keyPrefix)
+                    .WithDelimiter("/");
+
+                do
+                {
+                    auto outcome = m_transferConfig.s3Client->ListObjectsV2(request);
+                    if (!outcome.IsSuccess())
+                    {
+                        AWS_LOGSTREAM_WARN(CLASS_TAG, "Listing objects failed for bucket: " << context->bucketName << " with prefix: "
+                                << keyPrefix << ", uploading all files of " << path << ". Error message: " << outcome.GetError());
+                        compare = false;
+                        break;
+                    }
+
+                    for (const auto& object : outcome.GetResult().GetContents())
+                    {
+                        objects[object.GetKey().substr(keyPrefix.size())] = object;
+                    }
+                    request.SetContinuationToken(outcome.GetResult().GetNextContinuationToken());
+                } while (!request.GetContinuationToken().empty());
+            }
+
+            Aws::Vector<std::pair<Aws::String, Aws::String>> filesToUpload;
+            for (const auto& file : files)
+            {
+                Aws::String name = relativePath.empty() ? file.relativePath : file.relativePath.substr(relativePath.size() + 1);
+                Aws::String keyName = keyPrefix + name;
+                if (compare)
+                {
+                    auto object = objects.find(name);
+                    if (object != objects.end() && IsUnchanged(file, object->second, TransferDirection::UPLOAD))
+                    {
+                        ReportUnchangedFile(*context, file.path, keyName, static_cast<uint64_t>(file.fileSize));
+                        continue;
+                    }
+                }
+                filesToUpload.emplace_back(file.path, keyName);
+            }
+
+            {
+                std::lock_guard<std::mutex> locker(context->lock);
+                for (auto& subDirectory : subDirectories)
+                {
+                    context->pendingScans.push(std::move(subDirectory));
+                }
+                for (auto& file : filesToUpload)
+                {
+                    context->pendingFiles.push(std::move(file));
+                }
+            }
+            FinishDirectoryScan(context);
+        }
+
+        void TransferManager::ListBucketPrefix(const std::shared_ptr<DirectoryTransferContext>& context, const Aws::String& relativePath, const Aws::String& continuationToken)
+        {
+            // a sync walks the listing one level at a time so it can compare each level with one local directory
+            bool compare = context->mode == DirectoryTransferMode::TRANSFER_CHANGED;
+            Aws::String rootPrefix = GetListingRootPrefix(*context);
 
             Aws::S3::Model::ListObjectsV2Request request;
             request.SetCustomizedAccessLogTag(m_transferConfig.customizedAccessLogTag);
-            request.WithBucket(bucketName)
-                .WithPrefix(prefix);
+            request.WithBucket(context->bucketName)
+                .WithPrefix(rootPrefix + relativePath);
+            if (compare)
+            {
+                request.SetDelimiter("/");
+            }
+            if (!continuationToken.empty())
+            {
+                request.SetContinuationToken(continuationToken);
+            }
+
+            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
+            auto handler = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
+                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) { self->HandleListObjectsResponse(client, request, outcome, context); };
+
+            auto downloadContext = Aws::MakeShared<DownloadDirectoryContext>(CLASS_TAG);
+            downloadContext->transfer = context;
+            downloadContext->relativePath = relativePath;
+            m_transferConfig.s3Client->ListObjectsV2Async(request, handler, downloadContext);
+        }
+
+        void TransferManager::HandleListObjectsResponse(const Aws::S3::S3Client*, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& asyncContext)
+        {
+            auto downloadContext = std::static_pointer_cast<const DownloadDirectoryContext>(asyncContext);
+            const auto& context = downloadContext->transfer;
+            const auto& relativePath = downloadContext->relativePath;
+            bool compare = context->mode == DirectoryTransferMode::TRANSFER_CHANGED;
+            Aws::String rootPrefix = GetListingRootPrefix(*context);
+
+            if (!outcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Listing objects failed for bucket: " << context->bucketName << " with prefix: "
+                        << request.GetPrefix() << ". Error message: " << outcome.GetError());
+                //notify user if list objects failed.
+                if (m_transferConfig.errorCallback)
+                {
+                    auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, context->bucketName, "");
+                    m_transferConfig.errorCallback(this, handle, outcome.GetError());
+                }
+                FinishDirectoryScan(context);
+                return;
+            }
+
+            const auto& result = outcome.GetResult();
+            AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects succeeded for bucket: " << context->bucketName <<
+                    " with prefix: " << request.GetPrefix() << ". Number of keys received: " << result.GetContents().size());
 
-            auto context = Aws::MakeShared<DownloadDirectoryContext>(CLASS_TAG);
-            context->rootDirectory = directory;
-            context->prefix = prefix;
+            Aws::Vector<std::pair<Aws::String, Aws::String>> levelsToScan;
+            // the next page is read once this one is worked off, see ScheduleDirectoryTransfers
+            if (result.GetIsTruncated())
+            {
+                levelsToScan.emplace_back(relativePath, result.GetNextContinuationToken());
+            }
+            for (const auto& commonPrefix : result.GetCommonPrefixes())
+            {
+                levelsToScan.emplace_back(commonPrefix.GetPrefix().substr(rootPrefix.size()), Aws::String());
+            }
 
-            m_transferConfig.s3Client->ListObjectsV2Async(request, handler, context);
+            // files directly in the local directory of this level, by name
+            Aws::String localDirectory = context->directory;
+            Aws::Map<Aws::String, Aws::FileSystem::DirectoryEntry> files;
+            if (compare)
+            {
+                if (!relativePath.empty())
+                {
+                    localDirectory = Aws::FileSystem::Join(localDirectory, ToFilePath(relativePath.substr(0, relativePath.size() - 1)));
+                }
+
+                auto dir = Aws::FileSystem::OpenDirectory(localDirectory);
+                if (dir && *dir)
+                {
+                    while (Aws::FileSystem::DirectoryEntry&& entry = dir->Next())
+                    {
+                        if (entry.fileType == Aws::FileSystem::FileType::File)
+                        {
+                            files[entry.relativePath] = std::move(entry);
+                        }
+                    }
+                }
+            }
+
+            Aws::Vector<std::pair<Aws::String, Aws::String>> filesToDownload;
+            for (const auto& content : result.GetContents())
+            {
+                if (IsS3KeyPrefix(content.GetKey()))
+                {
+                    continue;
+                }
+
+                if (!compare)
+                {
+                    Aws::String fileName = DetermineFilePath(context->directory, context->prefix, content.GetKey());
+                    auto lastDelimter = fileName.find_last_of(Aws::FileSystem::PATH_DELIM);
+                    if (lastDelimter != std::string::npos)
+                    {
+                        Aws::FileSystem::CreateDirectoryIfNotExists(fileName.substr(0, lastDelimter).c_str(), true/*create parent dirs*/);
+                    }
+                    filesToDownload.emplace_back(fileName, content.GetKey());
+                    continue;
+                }
+
+                Aws::String name = content.GetKey().substr(request.GetPrefix().size());
+                Aws::String fileName = Aws::FileSystem::Join(localDirectory, name);
+                auto file = files.find(name);
+                if (file != files.end() && IsUnchanged(file->second, content, TransferDirection::DOWNLOAD))
+                {
+                    ReportUnchangedFile(*context, fileName, content.GetKey(), static_cast<uint64_t>(content.GetSize()));
+                    continue;
+                }
+
+                if (filesToDownload.empty())
+                {
+                    Aws::FileSystem::CreateDirectoryIfNotExists(localDirectory.c_str(), true/*create parent dirs*/);
+                }
+                filesToDownload.emplace_back(fileName, content.GetKey());
+            }
+
+            {
+                std::lock_guard<std::mutex> locker(context->lock);
+                for (auto& level : levelsToScan)
+                {
+                    context->pendingScans.push(std::move(level));
+                }
+                for (auto& file : filesToDownload)
+                {
+                    context->pendingFiles.push(std::move(file));
+                }
+            }
+            FinishDirectoryScan(context);
+        }
+
+        void TransferManager::ReportUnchangedFile(const DirectoryTransferContext& context, const Aws::String& fileName, const Aws::String& keyName, uint64_t size)
+        {
+            AWS_LOGSTREAM_TRACE(CLASS_TAG, "Skipping unchanged file: " << fileName << " in directory transfer with S3 Bucket: ["
+                    << context.bucketName << "] and Key: [" << keyName << "].");
+
+            // a handle costs a UUID, which adds up over millions of files; skip it when nobody listens
+            if (!m_transferConfig.transferStatusUpdatedCallback)
+            {
+                return;
+            }
+
+            auto handle = context.direction == TransferDirection::UPLOAD ?
+                Aws::MakeShared<TransferHandle>(CLASS_TAG, context.bucketName, keyName, size, fileName) :
+                Aws::MakeShared<TransferHandle>(CLASS_TAG, context.bucketName, keyName, fileName);
+            handle->SetBytesTotalSize(size);
+            handle->UpdateStatus(TransferStatus::EXACT_OBJECT_ALREADY_EXISTS);
+            TriggerTransferStatusUpdatedCallback(handle);
         }
 
         void TransferManager::DoMultiPartUpload(const std::shared_ptr<TransferHandle>& handle)
@@ -401,17 +820,63 @@ namespace Aws
 
         void TransferManager::DoSinglePartUpload(const std::shared_ptr<TransferHandle>& handle)
         {
+            // the pool doesn't bound these uploads, the slots do, so that a tree of small files can't run out of file descriptors
+            m_singlePartUploadSlots.WaitOne();
 #ifdef _MSC_VER
             auto wide = Aws::Utils::StringUtils::ToWString(handle->GetTargetFilePath().c_str());
             auto streamToPut = Aws::MakeShared<Aws::FStream>(CLASS_TAG, wide.c_str(), std::ios_base::in | std::ios_base::binary);
-            DoSinglePartUpload(streamToPut, handle);
 #else
             auto streamToPut = Aws::MakeShared<Aws::FStream>(CLASS_TAG, handle->GetTargetFilePath().c_str(), std::ios_base::in | std::ios_base::binary);
-            DoSinglePartUpload(streamToPut, handle);
 #endif
+            if (!streamToPut->good())
+            {
+                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Transfer handle [" << handle->GetId() << "] Failed to open file: "
+                        << handle->GetTargetFilePath() << " to upload to bucket: " << handle->GetBucketName() << " with key: " << handle->GetKey());
+                Aws::Client::AWSError<Aws::S3::S3Errors> error(Aws::S3::S3Errors::NO_SUCH_UPLOAD, "NoSuchUpload", "The requested file could not be opened.", false);
+                handle->SetError(error);
+                handle->UpdateStatus(TransferStatus::FAILED);
+                m_singlePartUploadSlots.Release();
+                TriggerErrorCallback(handle, error);
+                TriggerTransferStatusUpdatedCallback(handle);
+                return;
+            }
+
+            // a single part fits in one request, so the file is streamed as the body instead of being copied into a buffer from the pool.
+            // Small files then cost an open file rather than bufferSize bytes each, and the client rewinds the body if the request is retried.
+            auto self = shared_from_this();
+            auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::PutObjectRequest& request,
+                const Aws::S3::Model::PutObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+            {
+                self->m_singlePartUploadSlots.Release();
+                self->HandlePutObjectResponse(client, request, outcome, context);
+            };
+
+            DoSinglePartUpload(streamToPut, handle, callback);
         }
 
         void TransferManager::DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& streamToPut, const std::shared_ptr<TransferHandle>& handle)
+        {
+            auto buffer = m_bufferManager.Acquire();
+
+            auto lengthToWrite = (std::min)(static_cast<uint64_t>(buffer->GetLength()), handle->GetBytesTotalSize());
+            streamToPut->read((char*)buffer->GetUnderlyingData(), lengthToWrite);
+            auto streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
+            auto preallocatedStreamReader = Aws::MakeShared<Aws::IOStream>(CLASS_TAG, streamBuf);
+
+            auto self = shared_from_this();
+            auto callback = [self, buffer, streamBuf](const Aws::S3::S3Client* client, const Aws::S3::Model::PutObjectRequest& request,
+                const Aws::S3::Model::PutObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
+            {
+                self->m_bufferManager.Release(buffer);
+                Aws::Delete(streamBuf);
+                self->HandlePutObjectResponse(client, request, outcome, context);
+            };
+
+            DoSinglePartUpload(preallocatedStreamReader, handle, callback);
+        }
+
+        void TransferManager::DoSinglePartUpload(const std::shared_ptr<Aws::IOStream>& body, const std::shared_ptr<TransferHandle>& handle,
+                                                 const Aws::S3::PutObjectResponseReceivedHandler& callback)
         {
             auto partState = Aws::MakeShared<PartState>(CLASS_TAG, 1, 0, static_cast<size_t>(handle->GetBytesTotalSize()), true);
 
@@ -429,15 +894,7 @@ namespace Aws
                 .WithMetadata(handle->GetMetadata());
 
             putObjectRequest.SetContentType(handle->GetContentType());
-
-            auto buffer = m_bufferManager.Acquire();
-
-            auto lengthToWrite = (std::min)(static_cast<uint64_t>(buffer->GetLength()), handle->GetBytesTotalSize());
-            streamToPut->read((char*)buffer->GetUnderlyingData(), lengthToWrite);
-            auto streamBuf = Aws::New<Aws::Utils::Stream::PreallocatedStreamBuf>(CLASS_TAG, buffer, static_cast<size_t>(lengthToWrite));
-            auto preallocatedStreamReader = Aws::MakeShared<Aws::IOStream>(CLASS_TAG, streamBuf);
-
-            putObjectRequest.SetBody(preallocatedStreamReader);
+            putObjectRequest.SetBody(body);
 
             auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
             auto uploadProgressCallback = [self, partState, handle](const Aws::Http::HttpRequest*, long long progress)
@@ -459,12 +916,6 @@ namespace Aws
             asyncContext->handle = handle;
             asyncContext->partState = partState;
 
-            auto callback = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::PutObjectRequest& request,
-                const Aws::S3::Model::PutObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
-            {
-                self->HandlePutObjectResponse(client, request, outcome, context);
-            };
-
             m_transferConfig.s3Client->PutObjectAsync(putObjectRequest, callback, asyncContext);
         }
 
@@ -575,17 +1026,12 @@ namespace Aws
             }
         }
 
-        void TransferManager::HandlePutObjectResponse(const Aws::S3::S3Client*, const Aws::S3::Model::PutObjectRequest& request,
+        void TransferManager::HandlePutObjectResponse(const Aws::S3::S3Client*, const Aws::S3::Model::PutObjectRequest&,
             const Aws::S3::Model::PutObjectOutcome& outcome, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
         {
             std::shared_ptr<TransferHandleAsyncContext> transferContext =
                 std::const_pointer_cast<TransferHandleAsyncContext>(std::static_pointer_cast<const TransferHandleAsyncContext>(context));
 
-            auto originalStreamBuffer = (Aws::Utils::Stream::PreallocatedStreamBuf*)request.GetBody()->rdbuf();
-
-            m_bufferManager.Release(originalStreamBuffer->GetBuffer());
-            Aws::Delete(originalStreamBuffer);
-
             const auto& handle = transferContext->handle;
             const auto& partState = transferContext->partState;
 
@@ -981,66 +1427,6 @@ namespace Aws
             }
         }
 
-        void TransferManager::HandleListObjectsResponse(const Aws::S3::S3Client*, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
-            const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context)
-        {
-            auto self = shared_from_this(); // keep transfer manager alive until all callbacks are finished.
-            auto handler = [self](const Aws::S3::S3Client* client, const Aws::S3::Model::ListObjectsV2Request& request, const Aws::S3::Model::ListObjectsV2Outcome& outcome,
-                const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) { self->HandleListObjectsResponse(client, request, outcome, context); };
-
-            auto downloadContext = std::static_pointer_cast<const DownloadDirectoryContext>(context);
-            const auto& directory = downloadContext->rootDirectory;
-            const auto& prefix = downloadContext->prefix;
-
-            if (outcome.IsSuccess())
-            {
-                Aws::S3::Model::ListObjectsV2Request requestCpy = request;
-
-                auto& result = outcome.GetResult();
-
-                AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects succeeded for bucket: " << directory <<
-                        " with prefix: " << prefix << ". Number of keys received: " << result.GetContents().size());
-
-                //if it was truncated, we don't care on this pass anyways. Just go ahead and kick off another list objects and will handle it when it finishes.
-                if (result.GetIsTruncated())
-                {
-                    AWS_LOGSTREAM_TRACE(CLASS_TAG, "Listing objects response has a continuation token for bucket: "
-                            << directory << " with prefix: " << prefix << ". Getting the next set of results.");
-                    requestCpy.SetContinuationToken(result.GetNextContinuationToken());
-                    m_transferConfig.s3Client->ListObjectsV2Async(requestCpy, handler, context);
-                }
-
-                //this can contain matching directories or actual objects to download. If it's a directory, go ahead and create a local directory then
-                // take the new prefix and call list again. if it's an object key, go ahead and initiate download.
-                for (auto& content : result.GetContents())
-                {
-                    if (!IsS3KeyPrefix(content.GetKey()))
-                    {
-                        Aws::String fileName = DetermineFilePath(downloadContext->rootDirectory, downloadContext->prefix, content.GetKey());
-                        auto lastDelimter = fileName.find_last_of(Aws::FileSystem::PATH_DELIM);
-                        if (lastDelimter != std::string::npos)
-                        {
-                            Aws::FileSystem::CreateDirectoryIfNotExists(fileName.substr(0, lastDelimter).c_str(), true/*create parent dirs*/);
-                        }
-                        AWS_LOGSTREAM_INFO(CLASS_TAG, "Initiating download of key: [" << content.GetKey() <<
-                                "] in bucket: [" << directory << "] to destination file: [" << fileName << "]");
-                        m_transferConfig.transferInitiatedCallback(this, DownloadFile(request.GetBucket(), content.GetKey(), fileName));
-                    }
-                }
-            }
-            else
-            {
-                AWS_LOGSTREAM_ERROR(CLASS_TAG, "Listing objects failed for bucket: " << directory << " with prefix: "
-                        << prefix << ". Error message: " << outcome.GetError());
-                //notify user if list objects failed.
-                if (m_transferConfig.errorCallback)
-                {
-                    auto handle = Aws::MakeShared<TransferHandle>(CLASS_TAG, request.GetBucket(), "");
-                    m_transferConfig.errorCallback(this, handle, outcome.GetError());
-                }
-            }
-        }
-
         Aws::String TransferManager::DetermineFilePath(const Aws::String& directory, const Aws::String& prefix, const Aws::String& keyName)
         {
             Aws::String prefixCpy = prefix;
@@ -1081,12 +1467,37 @@ namespace Aws
             }
         }
 
-        void TransferManager::TriggerTransferStatusUpdatedCallback(const std::shared_ptr<const TransferHandle>& handle) const
+        void TransferManager::TriggerTransferStatusUpdatedCallback(const std::shared_ptr<const TransferHandle>& handle)
         {
             if (m_transferConfig.transferStatusUpdatedCallback)
             {
                 m_transferConfig.transferStatusUpdatedCallback(this, handle);
             }
+
+            if (!IsFinishedStatus(handle->GetStatus()))
+            {
+                return;
+            }
+
+            std::shared_ptr<DirectoryTransferContext> context;
+            {
+                std::lock_guard<std::mutex> locker(m_directoryTransfersLock);
+                auto iter = m_directoryTransfers.find(handle.get());
+                if (iter != m_directoryTransfers.end())
+                {
+                    context = iter->second;
+                    m_directoryTransfers.erase(iter);
+                }
+            }
+
+            if (context)
+            {
+                {
+                    std::lock_guard<std::mutex> locker(context->lock);
+                    --context->transfersInFlight;
+                }
+                ScheduleDirectoryTransfers(context);
+            }
         }
 
         void TransferManager::TriggerErrorCallback(const std::shared_ptr<const TransferHandle>& handle, const Aws::Client::AWSError<Aws::S3::S3Errors>& error) const
@@ -28,12 +28,12 @@ namespace Translate
 namespace TranslateErrorMapper
 {
 
-static const int UNSUPPORTED_LANGUAGE_PAIR_HASH = HashingUtils::HashString("UnsupportedLanguagePairException");
-static const int INTERNAL_SERVER_HASH = HashingUtils::HashString("InternalServerException");
-static const int TEXT_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("TextSizeLimitExceededException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
-static const int TOO_MANY_REQUESTS_HASH = HashingUtils::HashString("TooManyRequestsException");
-static const int DETECTED_LANGUAGE_LOW_CONFIDENCE_HASH = HashingUtils::HashString("DetectedLanguageLowConfidenceException");
+static constexpr int UNSUPPORTED_LANGUAGE_PAIR_HASH = HashingUtils::CompileTimeHashString("UnsupportedLanguagePairException");
+static constexpr int INTERNAL_SERVER_HASH = HashingUtils::CompileTimeHashString("InternalServerException");
+static constexpr int TEXT_SIZE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("TextSizeLimitExceededException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
+static constexpr int TOO_MANY_REQUESTS_HASH = HashingUtils::CompileTimeHashString("TooManyRequestsException");
+static constexpr int DETECTED_LANGUAGE_LOW_CONFIDENCE_HASH = HashingUtils::CompileTimeHashString("DetectedLanguageLowConfidenceException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
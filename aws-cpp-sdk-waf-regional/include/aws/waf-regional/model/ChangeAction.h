@@ -34,7 +34,8 @@ namespace ChangeActionMapper
 {
 AWS_WAFREGIONAL_API ChangeAction GetChangeActionForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForChangeAction(ChangeAction value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForChangeAction(ChangeAction value);
 } // namespace ChangeActionMapper
 } // namespace Model
 } // namespace WAFRegional
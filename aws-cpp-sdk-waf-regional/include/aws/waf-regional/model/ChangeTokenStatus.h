@@ -35,7 +35,8 @@ namespace ChangeTokenStatusMapper
 {
 AWS_WAFREGIONAL_API ChangeTokenStatus GetChangeTokenStatusForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForChangeTokenStatus(ChangeTokenStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForChangeTokenStatus(ChangeTokenStatus value);
 } // namespace ChangeTokenStatusMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -38,7 +38,8 @@ namespace ComparisonOperatorMapper
 {
 AWS_WAFREGIONAL_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForComparisonOperator(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -37,7 +37,8 @@ namespace MatchFieldTypeMapper
 {
 AWS_WAFREGIONAL_API MatchFieldType GetMatchFieldTypeForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForMatchFieldType(MatchFieldType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForMatchFieldType(MatchFieldType value);
 } // namespace MatchFieldTypeMapper
 } // namespace Model
 } // namespace WAFRegional
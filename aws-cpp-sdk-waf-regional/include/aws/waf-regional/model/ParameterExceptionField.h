@@ -47,7 +47,8 @@ namespace ParameterExceptionFieldMapper
 {
 AWS_WAFREGIONAL_API ParameterExceptionField GetParameterExceptionFieldForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForParameterExceptionField(ParameterExceptionField value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForParameterExceptionField(ParameterExceptionField value);
 } // namespace ParameterExceptionFieldMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -34,7 +34,8 @@ namespace ParameterExceptionReasonMapper
 {
 AWS_WAFREGIONAL_API ParameterExceptionReason GetParameterExceptionReasonForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForParameterExceptionReason(ParameterExceptionReason value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForParameterExceptionReason(ParameterExceptionReason value);
 } // namespace ParameterExceptionReasonMapper
 } // namespace Model
 } // namespace WAFRegional
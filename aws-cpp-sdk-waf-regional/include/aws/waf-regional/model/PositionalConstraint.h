@@ -37,7 +37,8 @@ namespace PositionalConstraintMapper
 {
 AWS_WAFREGIONAL_API PositionalConstraint GetPositionalConstraintForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForPositionalConstraint(PositionalConstraint value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForPositionalConstraint(PositionalConstraint value);
 } // namespace PositionalConstraintMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -39,7 +39,8 @@ namespace PredicateTypeMapper
 {
 AWS_WAFREGIONAL_API PredicateType GetPredicateTypeForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForPredicateType(PredicateType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForPredicateType(PredicateType value);
 } // namespace PredicateTypeMapper
 } // namespace Model
 } // namespace WAFRegional
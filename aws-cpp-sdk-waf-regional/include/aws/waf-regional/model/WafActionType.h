@@ -35,7 +35,8 @@ namespace WafActionTypeMapper
 {
 AWS_WAFREGIONAL_API WafActionType GetWafActionTypeForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForWafActionType(WafActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForWafActionType(WafActionType value);
 } // namespace WafActionTypeMapper
 } // namespace Model
 } // namespace WAFRegional
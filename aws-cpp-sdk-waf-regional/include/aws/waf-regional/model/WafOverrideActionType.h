@@ -34,7 +34,8 @@ namespace WafOverrideActionTypeMapper
 {
 AWS_WAFREGIONAL_API WafOverrideActionType GetWafOverrideActionTypeForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForWafOverrideActionType(WafOverrideActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForWafOverrideActionType(WafOverrideActionType value);
 } // namespace WafOverrideActionTypeMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -35,7 +35,8 @@ namespace WafRuleTypeMapper
 {
 AWS_WAFREGIONAL_API WafRuleType GetWafRuleTypeForName(const Aws::String& name);
 
-AWS_WAFREGIONAL_API Aws::String GetNameForWafRuleType(WafRuleType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAFREGIONAL_API const char* GetNameForWafRuleType(WafRuleType value);
 } // namespace WafRuleTypeMapper
 } // namespace Model
 } // namespace WAFRegional
@@ -28,21 +28,21 @@ namespace WAFRegional
 namespace WAFRegionalErrorMapper
 {
 
-static const int W_A_F_UNAVAILABLE_ENTITY_HASH = HashingUtils::HashString("WAFUnavailableEntityException");
-static const int W_A_F_LIMITS_EXCEEDED_HASH = HashingUtils::HashString("WAFLimitsExceededException");
-static const int W_A_F_REFERENCED_ITEM_HASH = HashingUtils::HashString("WAFReferencedItemException");
-static const int W_A_F_NON_EMPTY_ENTITY_HASH = HashingUtils::HashString("WAFNonEmptyEntityException");
-static const int W_A_F_DISALLOWED_NAME_HASH = HashingUtils::HashString("WAFDisallowedNameException");
-static const int W_A_F_INVALID_PERMISSION_POLICY_HASH = HashingUtils::HashString("WAFInvalidPermissionPolicyException");
-static const int W_A_F_NONEXISTENT_CONTAINER_HASH = HashingUtils::HashString("WAFNonexistentContainerException");
-static const int W_A_F_INVALID_OPERATION_HASH = HashingUtils::HashString("WAFInvalidOperationException");
-static const int W_A_F_INTERNAL_ERROR_HASH = HashingUtils::HashString("WAFInternalErrorException");
-static const int W_A_F_INVALID_REGEX_PATTERN_HASH = HashingUtils::HashString("WAFInvalidRegexPatternException");
-static const int W_A_F_INVALID_PARAMETER_HASH = HashingUtils::HashString("WAFInvalidParameterException");
-static const int W_A_F_SUBSCRIPTION_NOT_FOUND_HASH = HashingUtils::HashString("WAFSubscriptionNotFoundException");
-static const int W_A_F_NONEXISTENT_ITEM_HASH = HashingUtils::HashString("WAFNonexistentItemException");
-static const int W_A_F_INVALID_ACCOUNT_HASH = HashingUtils::HashString("WAFInvalidAccountException");
-static const int W_A_F_STALE_DATA_HASH = HashingUtils::HashString("WAFStaleDataException");
+static constexpr int W_A_F_UNAVAILABLE_ENTITY_HASH = HashingUtils::CompileTimeHashString("WAFUnavailableEntityException");
+static constexpr int W_A_F_LIMITS_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("WAFLimitsExceededException");
+static constexpr int W_A_F_REFERENCED_ITEM_HASH = HashingUtils::CompileTimeHashString("WAFReferencedItemException");
+static constexpr int W_A_F_NON_EMPTY_ENTITY_HASH = HashingUtils::CompileTimeHashString("WAFNonEmptyEntityException");
+static constexpr int W_A_F_DISALLOWED_NAME_HASH = HashingUtils::CompileTimeHashString("WAFDisallowedNameException");
+static constexpr int W_A_F_INVALID_PERMISSION_POLICY_HASH = HashingUtils::CompileTimeHashString("WAFInvalidPermissionPolicyException");
+static constexpr int W_A_F_NONEXISTENT_CONTAINER_HASH = HashingUtils::CompileTimeHashString("WAFNonexistentContainerException");
+static constexpr int W_A_F_INVALID_OPERATION_HASH = HashingUtils::CompileTimeHashString("WAFInvalidOperationException");
+static constexpr int W_A_F_INTERNAL_ERROR_HASH = HashingUtils::CompileTimeHashString("WAFInternalErrorException");
+static constexpr int W_A_F_INVALID_REGEX_PATTERN_HASH = HashingUtils::CompileTimeHashString("WAFInvalidRegexPatternException");
+static constexpr int W_A_F_INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("WAFInvalidParameterException");
+static constexpr int W_A_F_SUBSCRIPTION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("WAFSubscriptionNotFoundException");
+static constexpr int W_A_F_NONEXISTENT_ITEM_HASH = HashingUtils::CompileTimeHashString("WAFNonexistentItemException");
+static constexpr int W_A_F_INVALID_ACCOUNT_HASH = HashingUtils::CompileTimeHashString("WAFInvalidAccountException");
+static constexpr int W_A_F_STALE_DATA_HASH = HashingUtils::CompileTimeHashString("WAFStaleDataException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,25 +30,37 @@ namespace Aws
       namespace ChangeTokenStatusMapper
       {
 
-        static const int PROVISIONED_HASH = HashingUtils::HashString("PROVISIONED");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int INSYNC_HASH = HashingUtils::HashString("INSYNC");
+        static constexpr int PROVISIONED_HASH = HashingUtils::CompileTimeHashString("PROVISIONED");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int INSYNC_HASH = HashingUtils::CompileTimeHashString("INSYNC");
 
 
         ChangeTokenStatus GetChangeTokenStatusForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PROVISIONED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ChangeTokenStatus::PROVISIONED;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return ChangeTokenStatus::PENDING;
-          }
-          else if (hashCode == INSYNC_HASH)
-          {
-            return ChangeTokenStatus::INSYNC;
+          case PROVISIONED_HASH:
+            if (name == "PROVISIONED")
+            {
+              return ChangeTokenStatus::PROVISIONED;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return ChangeTokenStatus::PENDING;
+            }
+            break;
+          case INSYNC_HASH:
+            if (name == "INSYNC")
+            {
+              return ChangeTokenStatus::INSYNC;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ChangeTokenStatus::NOT_SET;
         }
 
-        Aws::String GetNameForChangeTokenStatus(ChangeTokenStatus enumValue)
+        const char* GetNameForChangeTokenStatus(ChangeTokenStatus enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,2339 +30,2281 @@ namespace Aws
       namespace GeoMatchConstraintValueMapper
       {
 
-        static const int AF_HASH = HashingUtils::HashString("AF");
-        static const int AX_HASH = HashingUtils::HashString("AX");
-        static const int AL_HASH = HashingUtils::HashString("AL");
-        static const int DZ_HASH = HashingUtils::HashString("DZ");
-        static const int AS_HASH = HashingUtils::HashString("AS");
-        static const int AD_HASH = HashingUtils::HashString("AD");
-        static const int AO_HASH = HashingUtils::HashString("AO");
-        static const int AI_HASH = HashingUtils::HashString("AI");
-        static const int AQ_HASH = HashingUtils::HashString("AQ");
-        static const int AG_HASH = HashingUtils::HashString("AG");
-        static const int AR_HASH = HashingUtils::HashString("AR");
-        static const int AM_HASH = HashingUtils::HashString("AM");
-        static const int AW_HASH = HashingUtils::HashString("AW");
-        static const int AU_HASH = HashingUtils::HashString("AU");
-        static const int AT_HASH = HashingUtils::HashString("AT");
-        static const int AZ_HASH = HashingUtils::HashString("AZ");
-        static const int BS_HASH = HashingUtils::HashString("BS");
-        static const int BH_HASH = HashingUtils::HashString("BH");
-        static const int BD_HASH = HashingUtils::HashString("BD");
-        static const int BB_HASH = HashingUtils::HashString("BB");
-        static const int BY_HASH = HashingUtils::HashString("BY");
-        static const int BE_HASH = HashingUtils::HashString("BE");
-        static const int BZ_HASH = HashingUtils::HashString("BZ");
-        static const int BJ_HASH = HashingUtils::HashString("BJ");
-        static const int BM_HASH = HashingUtils::HashString("BM");
-        static const int BT_HASH = HashingUtils::HashString("BT");
-        static const int BO_HASH = HashingUtils::HashString("BO");
-        static const int BQ_HASH = HashingUtils::HashString("BQ");
-        static const int BA_HASH = HashingUtils::HashString("BA");
-        static const int BW_HASH = HashingUtils::HashString("BW");
-        static const int BV_HASH = HashingUtils::HashString("BV");
-        static const int BR_HASH = HashingUtils::HashString("BR");
-        static const int IO_HASH = HashingUtils::HashString("IO");
-        static const int BN_HASH = HashingUtils::HashString("BN");
-        static const int BG_HASH = HashingUtils::HashString("BG");
-        static const int BF_HASH = HashingUtils::HashString("BF");
-        static const int BI_HASH = HashingUtils::HashString("BI");
-        static const int KH_HASH = HashingUtils::HashString("KH");
-        static const int CM_HASH = HashingUtils::HashString("CM");
-        static const int CA_HASH = HashingUtils::HashString("CA");
-        static const int CV_HASH = HashingUtils::HashString("CV");
-        static const int KY_HASH = HashingUtils::HashString("KY");
-        static const int CF_HASH = HashingUtils::HashString("CF");
-        static const int TD_HASH = HashingUtils::HashString("TD");
-        static const int CL_HASH = HashingUtils::HashString("CL");
-        static const int CN_HASH = HashingUtils::HashString("CN");
-        static const int CX_HASH = HashingUtils::HashString("CX");
-        static const int CC_HASH = HashingUtils::HashString("CC");
-        static const int CO_HASH = HashingUtils::HashString("CO");
-        static const int KM_HASH = HashingUtils::HashString("KM");
-        static const int CG_HASH = HashingUtils::HashString("CG");
-        static const int CD_HASH = HashingUtils::HashString("CD");
-        static const int CK_HASH = HashingUtils::HashString("CK");
-        static const int CR_HASH = HashingUtils::HashString("CR");
-        static const int CI_HASH = HashingUtils::HashString("CI");
-        static const int HR_HASH = HashingUtils::HashString("HR");
-        static const int CU_HASH = HashingUtils::HashString("CU");
-        static const int CW_HASH = HashingUtils::HashString("CW");
-        static const int CY_HASH = HashingUtils::HashString("CY");
-        static const int CZ_HASH = HashingUtils::HashString("CZ");
-        static const int DK_HASH = HashingUtils::HashString("DK");
-        static const int DJ_HASH = HashingUtils::HashString("DJ");
-        static const int DM_HASH = HashingUtils::HashString("DM");
-        static const int DO_HASH = HashingUtils::HashString("DO");
-        static const int EC_HASH = HashingUtils::HashString("EC");
-        static const int EG_HASH = HashingUtils::HashString("EG");
-        static const int SV_HASH = HashingUtils::HashString("SV");
-        static const int GQ_HASH = HashingUtils::HashString("GQ");
-        static const int ER_HASH = HashingUtils::HashString("ER");
-        static const int EE_HASH = HashingUtils::HashString("EE");
-        static const int ET_HASH = HashingUtils::HashString("ET");
-        static const int FK_HASH = HashingUtils::HashString("FK");
-        static const int FO_HASH = HashingUtils::HashString("FO");
-        static const int FJ_HASH = HashingUtils::HashString("FJ");
-        static const int FI_HASH = HashingUtils::HashString("FI");
-        static const int FR_HASH = HashingUtils::HashString("FR");
-        static const int GF_HASH = HashingUtils::HashString("GF");
-        static const int PF_HASH = HashingUtils::HashString("PF");
-        static const int TF_HASH = HashingUtils::HashString("TF");
-        static const int GA_HASH = HashingUtils::HashString("GA");
-        static const int GM_HASH = HashingUtils::HashString("GM");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int DE_HASH = HashingUtils::HashString("DE");
-        static const int GH_HASH = HashingUtils::HashString("GH");
-        static const int GI_HASH = HashingUtils::HashString("GI");
-        static const int GR_HASH = HashingUtils::HashString("GR");
-        static const int GL_HASH = HashingUtils::HashString("GL");
-        static const int GD_HASH = HashingUtils::HashString("GD");
-        static const int GP_HASH = HashingUtils::HashString("GP");
-        static const int GU_HASH = HashingUtils::HashString("GU");
-        static const int GT_HASH = HashingUtils::HashString("GT");
-        static const int GG_HASH = HashingUtils::HashString("GG");
-        static const int GN_HASH = HashingUtils::HashString("GN");
-        static const int GW_HASH = HashingUtils::HashString("GW");
-        static const int GY_HASH = HashingUtils::HashString("GY");
-        static const int HT_HASH = HashingUtils::HashString("HT");
-        static const int HM_HASH = HashingUtils::HashString("HM");
-        static const int VA_HASH = HashingUtils::HashString("VA");
-        static const int HN_HASH = HashingUtils::HashString("HN");
-        static const int HK_HASH = HashingUtils::HashString("HK");
-        static const int HU_HASH = HashingUtils::HashString("HU");
-        static const int IS_HASH = HashingUtils::HashString("IS");
-        static const int IN_HASH = HashingUtils::HashString("IN");
-        static const int ID_HASH = HashingUtils::HashString("ID");
-        static const int IR_HASH = HashingUtils::HashString("IR");
-        static const int IQ_HASH = HashingUtils::HashString("IQ");
-        static const int IE_HASH = HashingUtils::HashString("IE");
-        static const int IM_HASH = HashingUtils::HashString("IM");
-        static const int IL_HASH = HashingUtils::HashString("IL");
-        static const int IT_HASH = HashingUtils::HashString("IT");
-        static const int JM_HASH = HashingUtils::HashString("JM");
-        static const int JP_HASH = HashingUtils::HashString("JP");
-        static const int JE_HASH = HashingUtils::HashString("JE");
-        static const int JO_HASH = HashingUtils::HashString("JO");
-        static const int KZ_HASH = HashingUtils::HashString("KZ");
-        static const int KE_HASH = HashingUtils::HashString("KE");
-        static const int KI_HASH = HashingUtils::HashString("KI");
-        static const int KP_HASH = HashingUtils::HashString("KP");
-        static const int KR_HASH = HashingUtils::HashString("KR");
-        static const int KW_HASH = HashingUtils::HashString("KW");
-        static const int KG_HASH = HashingUtils::HashString("KG");
-        static const int LA_HASH = HashingUtils::HashString("LA");
-        static const int LV_HASH = HashingUtils::HashString("LV");
-        static const int LB_HASH = HashingUtils::HashString("LB");
-        static const int LS_HASH = HashingUtils::HashString("LS");
-        static const int LR_HASH = HashingUtils::HashString("LR");
-        static const int LY_HASH = HashingUtils::HashString("LY");
-        static const int LI_HASH = HashingUtils::HashString("LI");
-        static const int LT_HASH = HashingUtils::HashString("LT");
-        static const int LU_HASH = HashingUtils::HashString("LU");
-        static const int MO_HASH = HashingUtils::HashString("MO");
-        static const int MK_HASH = HashingUtils::HashString("MK");
-        static const int MG_HASH = HashingUtils::HashString("MG");
-        static const int MW_HASH = HashingUtils::HashString("MW");
-        static const int MY_HASH = HashingUtils::HashString("MY");
-        static const int MV_HASH = HashingUtils::HashString("MV");
-        static const int ML_HASH = HashingUtils::HashString("ML");
-        static const int MT_HASH = HashingUtils::HashString("MT");
-        static const int MH_HASH = HashingUtils::HashString("MH");
-        static const int MQ_HASH = HashingUtils::HashString("MQ");
-        static const int MR_HASH = HashingUtils::HashString("MR");
-        static const int MU_HASH = HashingUtils::HashString("MU");
-        static const int YT_HASH = HashingUtils::HashString("YT");
-        static const int MX_HASH = HashingUtils::HashString("MX");
-        static const int FM_HASH = HashingUtils::HashString("FM");
-        static const int MD_HASH = HashingUtils::HashString("MD");
-        static const int MC_HASH = HashingUtils::HashString("MC");
-        static const int MN_HASH = HashingUtils::HashString("MN");
-        static const int ME_HASH = HashingUtils::HashString("ME");
-        static const int MS_HASH = HashingUtils::HashString("MS");
-        static const int MA_HASH = HashingUtils::HashString("MA");
-        static const int MZ_HASH = HashingUtils::HashString("MZ");
-        static const int MM_HASH = HashingUtils::HashString("MM");
-        static const int NA_HASH = HashingUtils::HashString("NA");
-        static const int NR_HASH = HashingUtils::HashString("NR");
-        static const int NP_HASH = HashingUtils::HashString("NP");
-        static const int NL_HASH = HashingUtils::HashString("NL");
-        static const int NC_HASH = HashingUtils::HashString("NC");
-        static const int NZ_HASH = HashingUtils::HashString("NZ");
-        static const int NI_HASH = HashingUtils::HashString("NI");
-        static const int NE_HASH = HashingUtils::HashString("NE");
-        static const int NG_HASH = HashingUtils::HashString("NG");
-        static const int NU_HASH = HashingUtils::HashString("NU");
-        static const int NF_HASH = HashingUtils::HashString("NF");
-        static const int MP_HASH = HashingUtils::HashString("MP");
-        static const int NO_HASH = HashingUtils::HashString("NO");
-        static const int OM_HASH = HashingUtils::HashString("OM");
-        static const int PK_HASH = HashingUtils::HashString("PK");
-        static const int PW_HASH = HashingUtils::HashString("PW");
-        static const int PS_HASH = HashingUtils::HashString("PS");
-        static const int PA_HASH = HashingUtils::HashString("PA");
-        static const int PG_HASH = HashingUtils::HashString("PG");
-        static const int PY_HASH = HashingUtils::HashString("PY");
-        static const int PE_HASH = HashingUtils::HashString("PE");
-        static const int PH_HASH = HashingUtils::HashString("PH");
-        static const int PN_HASH = HashingUtils::HashString("PN");
-        static const int PL_HASH = HashingUtils::HashString("PL");
-        static const int PT_HASH = HashingUtils::HashString("PT");
-        static const int PR_HASH = HashingUtils::HashString("PR");
-        static const int QA_HASH = HashingUtils::HashString("QA");
-        static const int RE_HASH = HashingUtils::HashString("RE");
-        static const int RO_HASH = HashingUtils::HashString("RO");
-        static const int RU_HASH = HashingUtils::HashString("RU");
-        static const int RW_HASH = HashingUtils::HashString("RW");
-        static const int BL_HASH = HashingUtils::HashString("BL");
-        static const int SH_HASH = HashingUtils::HashString("SH");
-        static const int KN_HASH = HashingUtils::HashString("KN");
-        static const int LC_HASH = HashingUtils::HashString("LC");
-        static const int MF_HASH = HashingUtils::HashString("MF");
-        static const int PM_HASH = HashingUtils::HashString("PM");
-        static const int VC_HASH = HashingUtils::HashString("VC");
-        static const int WS_HASH = HashingUtils::HashString("WS");
-        static const int SM_HASH = HashingUtils::HashString("SM");
-        static const int ST_HASH = HashingUtils::HashString("ST");
-        static const int SA_HASH = HashingUtils::HashString("SA");
-        static const int SN_HASH = HashingUtils::HashString("SN");
-        static const int RS_HASH = HashingUtils::HashString("RS");
-        static const int SC_HASH = HashingUtils::HashString("SC");
-        static const int SL_HASH = HashingUtils::HashString("SL");
-        static const int SG_HASH = HashingUtils::HashString("SG");
-        static const int SX_HASH = HashingUtils::HashString("SX");
-        static const int SK_HASH = HashingUtils::HashString("SK");
-        static const int SI_HASH = HashingUtils::HashString("SI");
-        static const int SB_HASH = HashingUtils::HashString("SB");
-        static const int SO_HASH = HashingUtils::HashString("SO");
-        static const int ZA_HASH = HashingUtils::HashString("ZA");
-        static const int GS_HASH = HashingUtils::HashString("GS");
-        static const int SS_HASH = HashingUtils::HashString("SS");
-        static const int ES_HASH = HashingUtils::HashString("ES");
-        static const int LK_HASH = HashingUtils::HashString("LK");
-        static const int SD_HASH = HashingUtils::HashString("SD");
-        static const int SR_HASH = HashingUtils::HashString("SR");
-        static const int SJ_HASH = HashingUtils::HashString("SJ");
-        static const int SZ_HASH = HashingUtils::HashString("SZ");
-        static const int SE_HASH = HashingUtils::HashString("SE");
-        static const int CH_HASH = HashingUtils::HashString("CH");
-        static const int SY_HASH = HashingUtils::HashString("SY");
-        static const int TW_HASH = HashingUtils::HashString("TW");
-        static const int TJ_HASH = HashingUtils::HashString("TJ");
-        static const int TZ_HASH = HashingUtils::HashString("TZ");
-        static const int TH_HASH = HashingUtils::HashString("TH");
-        static const int TL_HASH = HashingUtils::HashString("TL");
-        static const int TG_HASH = HashingUtils::HashString("TG");
-        static const int TK_HASH = HashingUtils::HashString("TK");
-        static const int TO_HASH = HashingUtils::HashString("TO");
-        static const int TT_HASH = HashingUtils::HashString("TT");
-        static const int TN_HASH = HashingUtils::HashString("TN");
-        static const int TR_HASH = HashingUtils::HashString("TR");
-        static const int TM_HASH = HashingUtils::HashString("TM");
-        static const int TC_HASH = HashingUtils::HashString("TC");
-        static const int TV_HASH = HashingUtils::HashString("TV");
-        static const int UG_HASH = HashingUtils::HashString("UG");
-        static const int UA_HASH = HashingUtils::HashString("UA");
-        static const int AE_HASH = HashingUtils::HashString("AE");
-        static const int GB_HASH = HashingUtils::HashString("GB");
-        static const int US_HASH = HashingUtils::HashString("US");
-        static const int UM_HASH = HashingUtils::HashString("UM");
-        static const int UY_HASH = HashingUtils::HashString("UY");
-        static const int UZ_HASH = HashingUtils::HashString("UZ");
-        static const int VU_HASH = HashingUtils::HashString("VU");
-        static const int VE_HASH = HashingUtils::HashString("VE");
-        static const int VN_HASH = HashingUtils::HashString("VN");
-        static const int VG_HASH = HashingUtils::HashString("VG");
-        static const int VI_HASH = HashingUtils::HashString("VI");
-        static const int WF_HASH = HashingUtils::HashString("WF");
-        static const int EH_HASH = HashingUtils::HashString("EH");
-        static const int YE_HASH = HashingUtils::HashString("YE");
-        static const int ZM_HASH = HashingUtils::HashString("ZM");
-        static const int ZW_HASH = HashingUtils::HashString("ZW");
+        static constexpr int AF_HASH = HashingUtils::CompileTimeHashString("AF");
+        static constexpr int AX_HASH = HashingUtils::CompileTimeHashString("AX");
+        static constexpr int AL_HASH = HashingUtils::CompileTimeHashString("AL");
+        static constexpr int DZ_HASH = HashingUtils::CompileTimeHashString("DZ");
+        static constexpr int AS_HASH = HashingUtils::CompileTimeHashString("AS");
+        static constexpr int AD_HASH = HashingUtils::CompileTimeHashString("AD");
+        static constexpr int AO_HASH = HashingUtils::CompileTimeHashString("AO");
+        static constexpr int AI_HASH = HashingUtils::CompileTimeHashString("AI");
+        static constexpr int AQ_HASH = HashingUtils::CompileTimeHashString("AQ");
+        static constexpr int AG_HASH = HashingUtils::CompileTimeHashString("AG");
+        static constexpr int AR_HASH = HashingUtils::CompileTimeHashString("AR");
+        static constexpr int AM_HASH = HashingUtils::CompileTimeHashString("AM");
+        static constexpr int AW_HASH = HashingUtils::CompileTimeHashString("AW");
+        static constexpr int AU_HASH = HashingUtils::CompileTimeHashString("AU");
+        static constexpr int AT_HASH = HashingUtils::CompileTimeHashString("AT");
+        static constexpr int AZ_HASH = HashingUtils::CompileTimeHashString("AZ");
+        static constexpr int BS_HASH = HashingUtils::CompileTimeHashString("BS");
+        static constexpr int BH_HASH = HashingUtils::CompileTimeHashString("BH");
+        static constexpr int BD_HASH = HashingUtils::CompileTimeHashString("BD");
+        static constexpr int BB_HASH = HashingUtils::CompileTimeHashString("BB");
+        static constexpr int BY_HASH = HashingUtils::CompileTimeHashString("BY");
+        static constexpr int BE_HASH = HashingUtils::CompileTimeHashString("BE");
+        static constexpr int BZ_HASH = HashingUtils::CompileTimeHashString("BZ");
+        static constexpr int BJ_HASH = HashingUtils::CompileTimeHashString("BJ");
+        static constexpr int BM_HASH = HashingUtils::CompileTimeHashString("BM");
+        static constexpr int BT_HASH = HashingUtils::CompileTimeHashString("BT");
+        static constexpr int BO_HASH = HashingUtils::CompileTimeHashString("BO");
+        static constexpr int BQ_HASH = HashingUtils::CompileTimeHashString("BQ");
+        static constexpr int BA_HASH = HashingUtils::CompileTimeHashString("BA");
+        static constexpr int BW_HASH = HashingUtils::CompileTimeHashString("BW");
+        static constexpr int BV_HASH = HashingUtils::CompileTimeHashString("BV");
+        static constexpr int BR_HASH = HashingUtils::CompileTimeHashString("BR");
+        static constexpr int IO_HASH = HashingUtils::CompileTimeHashString("IO");
+        static constexpr int BN_HASH = HashingUtils::CompileTimeHashString("BN");
+        static constexpr int BG_HASH = HashingUtils::CompileTimeHashString("BG");
+        static constexpr int BF_HASH = HashingUtils::CompileTimeHashString("BF");
+        static constexpr int BI_HASH = HashingUtils::CompileTimeHashString("BI");
+        static constexpr int KH_HASH = HashingUtils::CompileTimeHashString("KH");
+        static constexpr int CM_HASH = HashingUtils::CompileTimeHashString("CM");
+        static constexpr int CA_HASH = HashingUtils::CompileTimeHashString("CA");
+        static constexpr int CV_HASH = HashingUtils::CompileTimeHashString("CV");
+        static constexpr int KY_HASH = HashingUtils::CompileTimeHashString("KY");
+        static constexpr int CF_HASH = HashingUtils::CompileTimeHashString("CF");
+        static constexpr int TD_HASH = HashingUtils::CompileTimeHashString("TD");
+        static constexpr int CL_HASH = HashingUtils::CompileTimeHashString("CL");
+        static constexpr int CN_HASH = HashingUtils::CompileTimeHashString("CN");
+        static constexpr int CX_HASH = HashingUtils::CompileTimeHashString("CX");
+        static constexpr int CC_HASH = HashingUtils::CompileTimeHashString("CC");
+        static constexpr int CO_HASH = HashingUtils::CompileTimeHashString("CO");
+        static constexpr int KM_HASH = HashingUtils::CompileTimeHashString("KM");
+        static constexpr int CG_HASH = HashingUtils::CompileTimeHashString("CG");
+        static constexpr int CD_HASH = HashingUtils::CompileTimeHashString("CD");
+        static constexpr int CK_HASH = HashingUtils::CompileTimeHashString("CK");
+        static constexpr int CR_HASH = HashingUtils::CompileTimeHashString("CR");
+        static constexpr int CI_HASH = HashingUtils::CompileTimeHashString("CI");
+        static constexpr int HR_HASH = HashingUtils::CompileTimeHashString("HR");
+        static constexpr int CU_HASH = HashingUtils::CompileTimeHashString("CU");
+        static constexpr int CW_HASH = HashingUtils::CompileTimeHashString("CW");
+        static constexpr int CY_HASH = HashingUtils::CompileTimeHashString("CY");
+        static constexpr int CZ_HASH = HashingUtils::CompileTimeHashString("CZ");
+        static constexpr int DK_HASH = HashingUtils::CompileTimeHashString("DK");
+        static constexpr int DJ_HASH = HashingUtils::CompileTimeHashString("DJ");
+        static constexpr int DM_HASH = HashingUtils::CompileTimeHashString("DM");
+        static constexpr int DO_HASH = HashingUtils::CompileTimeHashString("DO");
+        static constexpr int EC_HASH = HashingUtils::CompileTimeHashString("EC");
+        static constexpr int EG_HASH = HashingUtils::CompileTimeHashString("EG");
+        static constexpr int SV_HASH = HashingUtils::CompileTimeHashString("SV");
+        static constexpr int GQ_HASH = HashingUtils::CompileTimeHashString("GQ");
+        static constexpr int ER_HASH = HashingUtils::CompileTimeHashString("ER");
+        static constexpr int EE_HASH = HashingUtils::CompileTimeHashString("EE");
+        static constexpr int ET_HASH = HashingUtils::CompileTimeHashString("ET");
+        static constexpr int FK_HASH = HashingUtils::CompileTimeHashString("FK");
+        static constexpr int FO_HASH = HashingUtils::CompileTimeHashString("FO");
+        static constexpr int FJ_HASH = HashingUtils::CompileTimeHashString("FJ");
+        static constexpr int FI_HASH = HashingUtils::CompileTimeHashString("FI");
+        static constexpr int FR_HASH = HashingUtils::CompileTimeHashString("FR");
+        static constexpr int GF_HASH = HashingUtils::CompileTimeHashString("GF");
+        static constexpr int PF_HASH = HashingUtils::CompileTimeHashString("PF");
+        static constexpr int TF_HASH = HashingUtils::CompileTimeHashString("TF");
+        static constexpr int GA_HASH = HashingUtils::CompileTimeHashString("GA");
+        static constexpr int GM_HASH = HashingUtils::CompileTimeHashString("GM");
+        static constexpr int GE_HASH = HashingUtils::CompileTimeHashString("GE");
+        static constexpr int DE_HASH = HashingUtils::CompileTimeHashString("DE");
+        static constexpr int GH_HASH = HashingUtils::CompileTimeHashString("GH");
+        static constexpr int GI_HASH = HashingUtils::CompileTimeHashString("GI");
+        static constexpr int GR_HASH = HashingUtils::CompileTimeHashString("GR");
+        static constexpr int GL_HASH = HashingUtils::CompileTimeHashString("GL");
+        static constexpr int GD_HASH = HashingUtils::CompileTimeHashString("GD");
+        static constexpr int GP_HASH = HashingUtils::CompileTimeHashString("GP");
+        static constexpr int GU_HASH = HashingUtils::CompileTimeHashString("GU");
+        static constexpr int GT_HASH = HashingUtils::CompileTimeHashString("GT");
+        static constexpr int GG_HASH = HashingUtils::CompileTimeHashString("GG");
+        static constexpr int GN_HASH = HashingUtils::CompileTimeHashString("GN");
+        static constexpr int GW_HASH = HashingUtils::CompileTimeHashString("GW");
+        static constexpr int GY_HASH = HashingUtils::CompileTimeHashString("GY");
+        static constexpr int HT_HASH = HashingUtils::CompileTimeHashString("HT");
+        static constexpr int HM_HASH = HashingUtils::CompileTimeHashString("HM");
+        static constexpr int VA_HASH = HashingUtils::CompileTimeHashString("VA");
+        static constexpr int HN_HASH = HashingUtils::CompileTimeHashString("HN");
+        static constexpr int HK_HASH = HashingUtils::CompileTimeHashString("HK");
+        static constexpr int HU_HASH = HashingUtils::CompileTimeHashString("HU");
+        static constexpr int IS_HASH = HashingUtils::CompileTimeHashString("IS");
+        static constexpr int IN_HASH = HashingUtils::CompileTimeHashString("IN");
+        static constexpr int ID_HASH = HashingUtils::CompileTimeHashString("ID");
+        static constexpr int IR_HASH = HashingUtils::CompileTimeHashString("IR");
+        static constexpr int IQ_HASH = HashingUtils::CompileTimeHashString("IQ");
+        static constexpr int IE_HASH = HashingUtils::CompileTimeHashString("IE");
+        static constexpr int IM_HASH = HashingUtils::CompileTimeHashString("IM");
+        static constexpr int IL_HASH = HashingUtils::CompileTimeHashString("IL");
+        static constexpr int IT_HASH = HashingUtils::CompileTimeHashString("IT");
+        static constexpr int JM_HASH = HashingUtils::CompileTimeHashString("JM");
+        static constexpr int JP_HASH = HashingUtils::CompileTimeHashString("JP");
+        static constexpr int JE_HASH = HashingUtils::CompileTimeHashString("JE");
+        static constexpr int JO_HASH = HashingUtils::CompileTimeHashString("JO");
+        static constexpr int KZ_HASH = HashingUtils::CompileTimeHashString("KZ");
+        static constexpr int KE_HASH = HashingUtils::CompileTimeHashString("KE");
+        static constexpr int KI_HASH = HashingUtils::CompileTimeHashString("KI");
+        static constexpr int KP_HASH = HashingUtils::CompileTimeHashString("KP");
+        static constexpr int KR_HASH = HashingUtils::CompileTimeHashString("KR");
+        static constexpr int KW_HASH = HashingUtils::CompileTimeHashString("KW");
+        static constexpr int KG_HASH = HashingUtils::CompileTimeHashString("KG");
+        static constexpr int LA_HASH = HashingUtils::CompileTimeHashString("LA");
+        static constexpr int LV_HASH = HashingUtils::CompileTimeHashString("LV");
+        static constexpr int LB_HASH = HashingUtils::CompileTimeHashString("LB");
+        static constexpr int LS_HASH = HashingUtils::CompileTimeHashString("LS");
+        static constexpr int LR_HASH = HashingUtils::CompileTimeHashString("LR");
+        static constexpr int LY_HASH = HashingUtils::CompileTimeHashString("LY");
+        static constexpr int LI_HASH = HashingUtils::CompileTimeHashString("LI");
+        static constexpr int LT_HASH = HashingUtils::CompileTimeHashString("LT");
+        static constexpr int LU_HASH = HashingUtils::CompileTimeHashString("LU");
+        static constexpr int MO_HASH = HashingUtils::CompileTimeHashString("MO");
+        static constexpr int MK_HASH = HashingUtils::CompileTimeHashString("MK");
+        static constexpr int MG_HASH = HashingUtils::CompileTimeHashString("MG");
+        static constexpr int MW_HASH = HashingUtils::CompileTimeHashString("MW");
+        static constexpr int MY_HASH = HashingUtils::CompileTimeHashString("MY");
+        static constexpr int MV_HASH = HashingUtils::CompileTimeHashString("MV");
+        static constexpr int ML_HASH = HashingUtils::CompileTimeHashString("ML");
+        static constexpr int MT_HASH = HashingUtils::CompileTimeHashString("MT");
+        static constexpr int MH_HASH = HashingUtils::CompileTimeHashString("MH");
+        static constexpr int MQ_HASH = HashingUtils::CompileTimeHashString("MQ");
+        static constexpr int MR_HASH = HashingUtils::CompileTimeHashString("MR");
+        static constexpr int MU_HASH = HashingUtils::CompileTimeHashString("MU");
+        static constexpr int YT_HASH = HashingUtils::CompileTimeHashString("YT");
+        static constexpr int MX_HASH = HashingUtils::CompileTimeHashString("MX");
+        static constexpr int FM_HASH = HashingUtils::CompileTimeHashString("FM");
+        static constexpr int MD_HASH = HashingUtils::CompileTimeHashString("MD");
+        static constexpr int MC_HASH = HashingUtils::CompileTimeHashString("MC");
+        static constexpr int MN_HASH = HashingUtils::CompileTimeHashString("MN");
+        static constexpr int ME_HASH = HashingUtils::CompileTimeHashString("ME");
+        static constexpr int MS_HASH = HashingUtils::CompileTimeHashString("MS");
+        static constexpr int MA_HASH = HashingUtils::CompileTimeHashString("MA");
+        static constexpr int MZ_HASH = HashingUtils::CompileTimeHashString("MZ");
+        static constexpr int MM_HASH = HashingUtils::CompileTimeHashString("MM");
+        static constexpr int NA_HASH = HashingUtils::CompileTimeHashString("NA");
+        static constexpr int NR_HASH = HashingUtils::CompileTimeHashString("NR");
+        static constexpr int NP_HASH = HashingUtils::CompileTimeHashString("NP");
+        static constexpr int NL_HASH = HashingUtils::CompileTimeHashString("NL");
+        static constexpr int NC_HASH = HashingUtils::CompileTimeHashString("NC");
+        static constexpr int NZ_HASH = HashingUtils::CompileTimeHashString("NZ");
+        static constexpr int NI_HASH = HashingUtils::CompileTimeHashString("NI");
+        static constexpr int NE_HASH = HashingUtils::CompileTimeHashString("NE");
+        static constexpr int NG_HASH = HashingUtils::CompileTimeHashString("NG");
+        static constexpr int NU_HASH = HashingUtils::CompileTimeHashString("NU");
+        static constexpr int NF_HASH = HashingUtils::CompileTimeHashString("NF");
+        static constexpr int MP_HASH = HashingUtils::CompileTimeHashString("MP");
+        static constexpr int NO_HASH = HashingUtils::CompileTimeHashString("NO");
+        static constexpr int OM_HASH = HashingUtils::CompileTimeHashString("OM");
+        static constexpr int PK_HASH = HashingUtils::CompileTimeHashString("PK");
+        static constexpr int PW_HASH = HashingUtils::CompileTimeHashString("PW");
+        static constexpr int PS_HASH = HashingUtils::CompileTimeHashString("PS");
+        static constexpr int PA_HASH = HashingUtils::CompileTimeHashString("PA");
+        static constexpr int PG_HASH = HashingUtils::CompileTimeHashString("PG");
+        static constexpr int PY_HASH = HashingUtils::CompileTimeHashString("PY");
+        static constexpr int PE_HASH = HashingUtils::CompileTimeHashString("PE");
+        static constexpr int PH_HASH = HashingUtils::CompileTimeHashString("PH");
+        static constexpr int PN_HASH = HashingUtils::CompileTimeHashString("PN");
+        static constexpr int PL_HASH = HashingUtils::CompileTimeHashString("PL");
+        static constexpr int PT_HASH = HashingUtils::CompileTimeHashString("PT");
+        static constexpr int PR_HASH = HashingUtils::CompileTimeHashString("PR");
+        static constexpr int QA_HASH = HashingUtils::CompileTimeHashString("QA");
+        static constexpr int RE_HASH = HashingUtils::CompileTimeHashString("RE");
+        static constexpr int RO_HASH = HashingUtils::CompileTimeHashString("RO");
+        static constexpr int RU_HASH = HashingUtils::CompileTimeHashString("RU");
+        static constexpr int RW_HASH = HashingUtils::CompileTimeHashString("RW");
+        static constexpr int BL_HASH = HashingUtils::CompileTimeHashString("BL");
+        static constexpr int SH_HASH = HashingUtils::CompileTimeHashString("SH");
+        static constexpr int KN_HASH = HashingUtils::CompileTimeHashString("KN");
+        static constexpr int LC_HASH = HashingUtils::CompileTimeHashString("LC");
+        static constexpr int MF_HASH = HashingUtils::CompileTimeHashString("MF");
+        static constexpr int PM_HASH = HashingUtils::CompileTimeHashString("PM");
+        static constexpr int VC_HASH = HashingUtils::CompileTimeHashString("VC");
+        static constexpr int WS_HASH = HashingUtils::CompileTimeHashString("WS");
+        static constexpr int SM_HASH = HashingUtils::CompileTimeHashString("SM");
+        static constexpr int ST_HASH = HashingUtils::CompileTimeHashString("ST");
+        static constexpr int SA_HASH = HashingUtils::CompileTimeHashString("SA");
+        static constexpr int SN_HASH = HashingUtils::CompileTimeHashString("SN");
+        static constexpr int RS_HASH = HashingUtils::CompileTimeHashString("RS");
+        static constexpr int SC_HASH = HashingUtils::CompileTimeHashString("SC");
+        static constexpr int SL_HASH = HashingUtils::CompileTimeHashString("SL");
+        static constexpr int SG_HASH = HashingUtils::CompileTimeHashString("SG");
+        static constexpr int SX_HASH = HashingUtils::CompileTimeHashString("SX");
+        static constexpr int SK_HASH = HashingUtils::CompileTimeHashString("SK");
+        static constexpr int SI_HASH = HashingUtils::CompileTimeHashString("SI");
+        static constexpr int SB_HASH = HashingUtils::CompileTimeHashString("SB");
+        static constexpr int SO_HASH = HashingUtils::CompileTimeHashString("SO");
+        static constexpr int ZA_HASH = HashingUtils::CompileTimeHashString("ZA");
+        static constexpr int GS_HASH = HashingUtils::CompileTimeHashString("GS");
+        static constexpr int SS_HASH = HashingUtils::CompileTimeHashString("SS");
+        static constexpr int ES_HASH = HashingUtils::CompileTimeHashString("ES");
+        static constexpr int LK_HASH = HashingUtils::CompileTimeHashString("LK");
+        static constexpr int SD_HASH = HashingUtils::CompileTimeHashString("SD");
+        static constexpr int SR_HASH = HashingUtils::CompileTimeHashString("SR");
+        static constexpr int SJ_HASH = HashingUtils::CompileTimeHashString("SJ");
+        static constexpr int SZ_HASH = HashingUtils::CompileTimeHashString("SZ");
+        static constexpr int SE_HASH = HashingUtils::CompileTimeHashString("SE");
+        static constexpr int CH_HASH = HashingUtils::CompileTimeHashString("CH");
+        static constexpr int SY_HASH = HashingUtils::CompileTimeHashString("SY");
+        static constexpr int TW_HASH = HashingUtils::CompileTimeHashString("TW");
+        static constexpr int TJ_HASH = HashingUtils::CompileTimeHashString("TJ");
+        static constexpr int TZ_HASH = HashingUtils::CompileTimeHashString("TZ");
+        static constexpr int TH_HASH = HashingUtils::CompileTimeHashString("TH");
+        static constexpr int TL_HASH = HashingUtils::CompileTimeHashString("TL");
+        static constexpr int TG_HASH = HashingUtils::CompileTimeHashString("TG");
+        static constexpr int TK_HASH = HashingUtils::CompileTimeHashString("TK");
+        static constexpr int TO_HASH = HashingUtils::CompileTimeHashString("TO");
+        static constexpr int TT_HASH = HashingUtils::CompileTimeHashString("TT");
+        static constexpr int TN_HASH = HashingUtils::CompileTimeHashString("TN");
+        static constexpr int TR_HASH = HashingUtils::CompileTimeHashString("TR");
+        static constexpr int TM_HASH = HashingUtils::CompileTimeHashString("TM");
+        static constexpr int TC_HASH = HashingUtils::CompileTimeHashString("TC");
+        static constexpr int TV_HASH = HashingUtils::CompileTimeHashString("TV");
+        static constexpr int UG_HASH = HashingUtils::CompileTimeHashString("UG");
+        static constexpr int UA_HASH = HashingUtils::CompileTimeHashString("UA");
+        static constexpr int AE_HASH = HashingUtils::CompileTimeHashString("AE");
+        static constexpr int GB_HASH = HashingUtils::CompileTimeHashString("GB");
+        static constexpr int US_HASH = HashingUtils::CompileTimeHashString("US");
+        static constexpr int UM_HASH = HashingUtils::CompileTimeHashString("UM");
+        static constexpr int UY_HASH = HashingUtils::CompileTimeHashString("UY");
+        static constexpr int UZ_HASH = HashingUtils::CompileTimeHashString("UZ");
+        static constexpr int VU_HASH = HashingUtils::CompileTimeHashString("VU");
+        static constexpr int VE_HASH = HashingUtils::CompileTimeHashString("VE");
+        static constexpr int VN_HASH = HashingUtils::CompileTimeHashString("VN");
+        static constexpr int VG_HASH = HashingUtils::CompileTimeHashString("VG");
+        static constexpr int VI_HASH = HashingUtils::CompileTimeHashString("VI");
+        static constexpr int WF_HASH = HashingUtils::CompileTimeHashString("WF");
+        static constexpr int EH_HASH = HashingUtils::CompileTimeHashString("EH");
+        static constexpr int YE_HASH = HashingUtils::CompileTimeHashString("YE");
+        static constexpr int ZM_HASH = HashingUtils::CompileTimeHashString("ZM");
+        static constexpr int ZW_HASH = HashingUtils::CompileTimeHashString("ZW");
 
-        /*
-        The if-else chains in this file are converted into a jump table by the compiler,
-        which allows constant time lookup. The chain has been broken into helper functions
-        because MSVC has a maximum of 122 chained if-else blocks.
-        */
-        static bool GetEnumForNameHelper0(int hashCode, GeoMatchConstraintValue& enumValue)
-        {
-          if (hashCode == AF_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AF;
-            return true;
-          }
-          else if (hashCode == AX_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AX;
-            return true;
-          }
-          else if (hashCode == AL_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AL;
-            return true;
-          }
-          else if (hashCode == DZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::DZ;
-            return true;
-          }
-          else if (hashCode == AS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AS;
-            return true;
-          }
-          else if (hashCode == AD_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AD;
-            return true;
-          }
-          else if (hashCode == AO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AO;
-            return true;
-          }
-          else if (hashCode == AI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AI;
-            return true;
-          }
-          else if (hashCode == AQ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AQ;
-            return true;
-          }
-          else if (hashCode == AG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AG;
-            return true;
-          }
-          else if (hashCode == AR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AR;
-            return true;
-          }
-          else if (hashCode == AM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AM;
-            return true;
-          }
-          else if (hashCode == AW_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AW;
-            return true;
-          }
-          else if (hashCode == AU_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AU;
-            return true;
-          }
-          else if (hashCode == AT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AT;
-            return true;
-          }
-          else if (hashCode == AZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AZ;
-            return true;
-          }
-          else if (hashCode == BS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BS;
-            return true;
-          }
-          else if (hashCode == BH_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BH;
-            return true;
-          }
-          else if (hashCode == BD_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BD;
-            return true;
-          }
-          else if (hashCode == BB_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BB;
-            return true;
-          }
-          else if (hashCode == BY_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BY;
-            return true;
-          }
-          else if (hashCode == BE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BE;
-            return true;
-          }
-          else if (hashCode == BZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BZ;
-            return true;
-          }
-          else if (hashCode == BJ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BJ;
-            return true;
-          }
-          else if (hashCode == BM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BM;
-            return true;
-          }
-          else if (hashCode == BT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BT;
-            return true;
-          }
-          else if (hashCode == BO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BO;
-            return true;
-          }
-          else if (hashCode == BQ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BQ;
-            return true;
-          }
-          else if (hashCode == BA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BA;
-            return true;
-          }
-          else if (hashCode == BW_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BW;
-            return true;
-          }
-          else if (hashCode == BV_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BV;
-            return true;
-          }
-          else if (hashCode == BR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BR;
-            return true;
-          }
-          else if (hashCode == IO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::IO;
-            return true;
-          }
-          else if (hashCode == BN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BN;
-            return true;
-          }
-          else if (hashCode == BG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BG;
-            return true;
-          }
-          else if (hashCode == BF_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BF;
-            return true;
-          }
-          else if (hashCode == BI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BI;
-            return true;
-          }
-          else if (hashCode == KH_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KH;
-            return true;
-          }
-          else if (hashCode == CM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CM;
-            return true;
-          }
-          else if (hashCode == CA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CA;
-            return true;
-          }
-          else if (hashCode == CV_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CV;
-            return true;
-          }
-          else if (hashCode == KY_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KY;
-            return true;
-          }
-          else if (hashCode == CF_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CF;
-            return true;
-          }
-          else if (hashCode == TD_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TD;
-            return true;
-          }
-          else if (hashCode == CL_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CL;
-            return true;
-          }
-          else if (hashCode == CN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CN;
-            return true;
-          }
-          else if (hashCode == CX_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CX;
-            return true;
-          }
-          else if (hashCode == CC_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CC;
-            return true;
-          }
-          else if (hashCode == CO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CO;
-            return true;
-          }
-          else if (hashCode == KM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KM;
-            return true;
-          }
-          else if (hashCode == CG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CG;
-            return true;
-          }
-          else if (hashCode == CD_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CD;
-            return true;
-          }
-          else if (hashCode == CK_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CK;
-            return true;
-          }
-          else if (hashCode == CR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CR;
-            return true;
-          }
-          else if (hashCode == CI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CI;
-            return true;
-          }
-          else if (hashCode == HR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::HR;
-            return true;
-          }
-          else if (hashCode == CU_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CU;
-            return true;
-          }
-          else if (hashCode == CW_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CW;
-            return true;
-          }
-          else if (hashCode == CY_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CY;
-            return true;
-          }
-          else if (hashCode == CZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CZ;
-            return true;
-          }
-          else if (hashCode == DK_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::DK;
-            return true;
-          }
-          else if (hashCode == DJ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::DJ;
-            return true;
-          }
-          else if (hashCode == DM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::DM;
-            return true;
-          }
-          else if (hashCode == DO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::DO;
-            return true;
-          }
-          else if (hashCode == EC_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::EC;
-            return true;
-          }
-          else if (hashCode == EG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::EG;
-            return true;
-          }
-          else if (hashCode == SV_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SV;
-            return true;
-          }
-          else if (hashCode == GQ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GQ;
-            return true;
-          }
-          else if (hashCode == ER_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::ER;
-            return true;
-          }
-          else if (hashCode == EE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::EE;
-            return true;
-          }
-          else if (hashCode == ET_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::ET;
-            return true;
-          }
-          else if (hashCode == FK_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::FK;
-            return true;
-          }
-          else if (hashCode == FO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::FO;
-            return true;
-          }
-          else if (hashCode == FJ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::FJ;
-            return true;
-          }
-          else if (hashCode == FI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::FI;
-            return true;
-          }
-          else if (hashCode == FR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::FR;
-            return true;
-          }
-          else if (hashCode == GF_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GF;
-            return true;
-          }
-          else if (hashCode == PF_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PF;
-            return true;
-          }
-          else if (hashCode == TF_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TF;
-            return true;
-          }
-          else if (hashCode == GA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GA;
-            return true;
-          }
-          else if (hashCode == GM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GM;
-            return true;
-          }
-          else if (hashCode == GE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GE;
-            return true;
-          }
-          else if (hashCode == DE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::DE;
-            return true;
-          }
-          else if (hashCode == GH_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GH;
-            return true;
-          }
-          else if (hashCode == GI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GI;
-            return true;
-          }
-          else if (hashCode == GR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GR;
-            return true;
-          }
-          else if (hashCode == GL_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GL;
-            return true;
-          }
-          else if (hashCode == GD_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GD;
-            return true;
-          }
-          else if (hashCode == GP_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GP;
-            return true;
-          }
-          else if (hashCode == GU_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GU;
-            return true;
-          }
-          else if (hashCode == GT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GT;
-            return true;
-          }
-          else if (hashCode == GG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GG;
-            return true;
-          }
-          else if (hashCode == GN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GN;
-            return true;
-          }
-          else if (hashCode == GW_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GW;
-            return true;
-          }
-          else if (hashCode == GY_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GY;
-            return true;
-          }
-          else if (hashCode == HT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::HT;
-            return true;
-          }
-          else if (hashCode == HM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::HM;
-            return true;
-          }
-          else if (hashCode == VA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::VA;
-            return true;
-          }
-          else if (hashCode == HN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::HN;
-            return true;
-          }
-          else if (hashCode == HK_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::HK;
-            return true;
-          }
-          else if (hashCode == HU_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::HU;
-            return true;
-          }
-          else if (hashCode == IS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::IS;
-            return true;
-          }
-          else if (hashCode == IN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::IN;
-            return true;
-          }
-          else if (hashCode == ID_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::ID;
-            return true;
-          }
-          else if (hashCode == IR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::IR;
-            return true;
-          }
-          else if (hashCode == IQ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::IQ;
-            return true;
-          }
-          else if (hashCode == IE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::IE;
-            return true;
-          }
-          else if (hashCode == IM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::IM;
-            return true;
-          }
-          else if (hashCode == IL_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::IL;
-            return true;
-          }
-          else if (hashCode == IT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::IT;
-            return true;
-          }
-          else if (hashCode == JM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::JM;
-            return true;
-          }
-          else if (hashCode == JP_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::JP;
-            return true;
-          }
-          else if (hashCode == JE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::JE;
-            return true;
-          }
-          else if (hashCode == JO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::JO;
-            return true;
-          }
-          else if (hashCode == KZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KZ;
-            return true;
-          }
-          else if (hashCode == KE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KE;
-            return true;
-          }
-          else if (hashCode == KI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KI;
-            return true;
-          }
-          else if (hashCode == KP_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KP;
-            return true;
-          }
-          else if (hashCode == KR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KR;
-            return true;
-          }
-          else if (hashCode == KW_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KW;
-            return true;
-          }
-          else if (hashCode == KG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KG;
-            return true;
-          }
-          else if (hashCode == LA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LA;
-            return true;
-          }
-          return false;
-        }
-        static bool GetEnumForNameHelper1(int hashCode, GeoMatchConstraintValue& enumValue)
-        {
-          if (hashCode == LV_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LV;
-            return true;
-          }
-          else if (hashCode == LB_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LB;
-            return true;
-          }
-          else if (hashCode == LS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LS;
-            return true;
-          }
-          else if (hashCode == LR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LR;
-            return true;
-          }
-          else if (hashCode == LY_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LY;
-            return true;
-          }
-          else if (hashCode == LI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LI;
-            return true;
-          }
-          else if (hashCode == LT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LT;
-            return true;
-          }
-          else if (hashCode == LU_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LU;
-            return true;
-          }
-          else if (hashCode == MO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MO;
-            return true;
-          }
-          else if (hashCode == MK_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MK;
-            return true;
-          }
-          else if (hashCode == MG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MG;
-            return true;
-          }
-          else if (hashCode == MW_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MW;
-            return true;
-          }
-          else if (hashCode == MY_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MY;
-            return true;
-          }
-          else if (hashCode == MV_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MV;
-            return true;
-          }
-          else if (hashCode == ML_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::ML;
-            return true;
-          }
-          else if (hashCode == MT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MT;
-            return true;
-          }
-          else if (hashCode == MH_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MH;
-            return true;
-          }
-          else if (hashCode == MQ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MQ;
-            return true;
-          }
-          else if (hashCode == MR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MR;
-            return true;
-          }
-          else if (hashCode == MU_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MU;
-            return true;
-          }
-          else if (hashCode == YT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::YT;
-            return true;
-          }
-          else if (hashCode == MX_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MX;
-            return true;
-          }
-          else if (hashCode == FM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::FM;
-            return true;
-          }
-          else if (hashCode == MD_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MD;
-            return true;
-          }
-          else if (hashCode == MC_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MC;
-            return true;
-          }
-          else if (hashCode == MN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MN;
-            return true;
-          }
-          else if (hashCode == ME_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::ME;
-            return true;
-          }
-          else if (hashCode == MS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MS;
-            return true;
-          }
-          else if (hashCode == MA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MA;
-            return true;
-          }
-          else if (hashCode == MZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MZ;
-            return true;
-          }
-          else if (hashCode == MM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MM;
-            return true;
-          }
-          else if (hashCode == NA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NA;
-            return true;
-          }
-          else if (hashCode == NR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NR;
-            return true;
-          }
-          else if (hashCode == NP_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NP;
-            return true;
-          }
-          else if (hashCode == NL_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NL;
-            return true;
-          }
-          else if (hashCode == NC_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NC;
-            return true;
-          }
-          else if (hashCode == NZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NZ;
-            return true;
-          }
-          else if (hashCode == NI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NI;
-            return true;
-          }
-          else if (hashCode == NE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NE;
-            return true;
-          }
-          else if (hashCode == NG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NG;
-            return true;
-          }
-          else if (hashCode == NU_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NU;
-            return true;
-          }
-          else if (hashCode == NF_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NF;
-            return true;
-          }
-          else if (hashCode == MP_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MP;
-            return true;
-          }
-          else if (hashCode == NO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::NO;
-            return true;
-          }
-          else if (hashCode == OM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::OM;
-            return true;
-          }
-          else if (hashCode == PK_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PK;
-            return true;
-          }
-          else if (hashCode == PW_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PW;
-            return true;
-          }
-          else if (hashCode == PS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PS;
-            return true;
-          }
-          else if (hashCode == PA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PA;
-            return true;
-          }
-          else if (hashCode == PG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PG;
-            return true;
-          }
-          else if (hashCode == PY_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PY;
-            return true;
-          }
-          else if (hashCode == PE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PE;
-            return true;
-          }
-          else if (hashCode == PH_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PH;
-            return true;
-          }
-          else if (hashCode == PN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PN;
-            return true;
-          }
-          else if (hashCode == PL_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PL;
-            return true;
-          }
-          else if (hashCode == PT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PT;
-            return true;
-          }
-          else if (hashCode == PR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PR;
-            return true;
-          }
-          else if (hashCode == QA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::QA;
-            return true;
-          }
-          else if (hashCode == RE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::RE;
-            return true;
-          }
-          else if (hashCode == RO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::RO;
-            return true;
-          }
-          else if (hashCode == RU_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::RU;
-            return true;
-          }
-          else if (hashCode == RW_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::RW;
-            return true;
-          }
-          else if (hashCode == BL_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::BL;
-            return true;
-          }
-          else if (hashCode == SH_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SH;
-            return true;
-          }
-          else if (hashCode == KN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::KN;
-            return true;
-          }
-          else if (hashCode == LC_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LC;
-            return true;
-          }
-          else if (hashCode == MF_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::MF;
-            return true;
-          }
-          else if (hashCode == PM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::PM;
-            return true;
-          }
-          else if (hashCode == VC_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::VC;
-            return true;
-          }
-          else if (hashCode == WS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::WS;
-            return true;
-          }
-          else if (hashCode == SM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SM;
-            return true;
-          }
-          else if (hashCode == ST_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::ST;
-            return true;
-          }
-          else if (hashCode == SA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SA;
-            return true;
-          }
-          else if (hashCode == SN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SN;
-            return true;
-          }
-          else if (hashCode == RS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::RS;
-            return true;
-          }
-          else if (hashCode == SC_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SC;
-            return true;
-          }
-          else if (hashCode == SL_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SL;
-            return true;
-          }
-          else if (hashCode == SG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SG;
-            return true;
-          }
-          else if (hashCode == SX_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SX;
-            return true;
-          }
-          else if (hashCode == SK_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SK;
-            return true;
-          }
-          else if (hashCode == SI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SI;
-            return true;
-          }
-          else if (hashCode == SB_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SB;
-            return true;
-          }
-          else if (hashCode == SO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SO;
-            return true;
-          }
-          else if (hashCode == ZA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::ZA;
-            return true;
-          }
-          else if (hashCode == GS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GS;
-            return true;
-          }
-          else if (hashCode == SS_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SS;
-            return true;
-          }
-          else if (hashCode == ES_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::ES;
-            return true;
-          }
-          else if (hashCode == LK_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::LK;
-            return true;
-          }
-          else if (hashCode == SD_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SD;
-            return true;
-          }
-          else if (hashCode == SR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SR;
-            return true;
-          }
-          else if (hashCode == SJ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SJ;
-            return true;
-          }
-          else if (hashCode == SZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SZ;
-            return true;
-          }
-          else if (hashCode == SE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SE;
-            return true;
-          }
-          else if (hashCode == CH_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::CH;
-            return true;
-          }
-          else if (hashCode == SY_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::SY;
-            return true;
-          }
-          else if (hashCode == TW_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TW;
-            return true;
-          }
-          else if (hashCode == TJ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TJ;
-            return true;
-          }
-          else if (hashCode == TZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TZ;
-            return true;
-          }
-          else if (hashCode == TH_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TH;
-            return true;
-          }
-          else if (hashCode == TL_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TL;
-            return true;
-          }
-          else if (hashCode == TG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TG;
-            return true;
-          }
-          else if (hashCode == TK_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TK;
-            return true;
-          }
-          else if (hashCode == TO_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TO;
-            return true;
-          }
-          else if (hashCode == TT_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TT;
-            return true;
-          }
-          else if (hashCode == TN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TN;
-            return true;
-          }
-          else if (hashCode == TR_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TR;
-            return true;
-          }
-          else if (hashCode == TM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TM;
-            return true;
-          }
-          else if (hashCode == TC_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TC;
-            return true;
-          }
-          else if (hashCode == TV_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::TV;
-            return true;
-          }
-          else if (hashCode == UG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::UG;
-            return true;
-          }
-          else if (hashCode == UA_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::UA;
-            return true;
-          }
-          else if (hashCode == AE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::AE;
-            return true;
-          }
-          else if (hashCode == GB_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::GB;
-            return true;
-          }
-          else if (hashCode == US_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::US;
-            return true;
-          }
-          else if (hashCode == UM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::UM;
-            return true;
-          }
-          else if (hashCode == UY_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::UY;
-            return true;
-          }
-          else if (hashCode == UZ_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::UZ;
-            return true;
-          }
-          else if (hashCode == VU_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::VU;
-            return true;
-          }
-          else if (hashCode == VE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::VE;
-            return true;
-          }
-          else if (hashCode == VN_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::VN;
-            return true;
-          }
-          else if (hashCode == VG_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::VG;
-            return true;
-          }
-          else if (hashCode == VI_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::VI;
-            return true;
-          }
-          return false;
-        }
-        static bool GetEnumForNameHelper2(int hashCode, GeoMatchConstraintValue& enumValue)
+
+        GeoMatchConstraintValue GetGeoMatchConstraintValueForName(const Aws::String& name)
         {
-          if (hashCode == WF_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::WF;
-            return true;
-          }
-          else if (hashCode == EH_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::EH;
-            return true;
-          }
-          else if (hashCode == YE_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::YE;
-            return true;
-          }
-          else if (hashCode == ZM_HASH)
-          {
-            enumValue = GeoMatchConstraintValue::ZM;
-            return true;
+          int hashCode = HashingUtils::HashString(name.c_str());
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
+          {
+          case AF_HASH:
+            if (name == "AF")
+            {
+              return GeoMatchConstraintValue::AF;
+            }
+            break;
+          case AX_HASH:
+            if (name == "AX")
+            {
+              return GeoMatchConstraintValue::AX;
+            }
+            break;
+          case AL_HASH:
+            if (name == "AL")
+            {
+              return GeoMatchConstraintValue::AL;
+            }
+            break;
+          case DZ_HASH:
+            if (name == "DZ")
+            {
+              return GeoMatchConstraintValue::DZ;
+            }
+            break;
+          case AS_HASH:
+            if (name == "AS")
+            {
+              return GeoMatchConstraintValue::AS;
+            }
+            break;
+          case AD_HASH:
+            if (name == "AD")
+            {
+              return GeoMatchConstraintValue::AD;
+            }
+            break;
+          case AO_HASH:
+            if (name == "AO")
+            {
+              return GeoMatchConstraintValue::AO;
+            }
+            break;
+          case AI_HASH:
+            if (name == "AI")
+            {
+              return GeoMatchConstraintValue::AI;
+            }
+            break;
+          case AQ_HASH:
+            if (name == "AQ")
+            {
+              return GeoMatchConstraintValue::AQ;
+            }
+            break;
+          case AG_HASH:
+            if (name == "AG")
+            {
+              return GeoMatchConstraintValue::AG;
+            }
+            break;
+          case AR_HASH:
+            if (name == "AR")
+            {
+              return GeoMatchConstraintValue::AR;
+            }
+            break;
+          case AM_HASH:
+            if (name == "AM")
+            {
+              return GeoMatchConstraintValue::AM;
+            }
+            break;
+          case AW_HASH:
+            if (name == "AW")
+            {
+              return GeoMatchConstraintValue::AW;
+            }
+            break;
+          case AU_HASH:
+            if (name == "AU")
+            {
+              return GeoMatchConstraintValue::AU;
+            }
+            break;
+          case AT_HASH:
+            if (name == "AT")
+            {
+              return GeoMatchConstraintValue::AT;
+            }
+            break;
+          case AZ_HASH:
+            if (name == "AZ")
+            {
+              return GeoMatchConstraintValue::AZ;
+            }
+            break;
+          case BS_HASH:
+            if (name == "BS")
+            {
+              return GeoMatchConstraintValue::BS;
+            }
+            break;
+          case BH_HASH:
+            if (name == "BH")
+            {
+              return GeoMatchConstraintValue::BH;
+            }
+            break;
+          case BD_HASH:
+            if (name == "BD")
+            {
+              return GeoMatchConstraintValue::BD;
+            }
+            break;
+          case BB_HASH:
+            if (name == "BB")
+            {
+              return GeoMatchConstraintValue::BB;
+            }
+            break;
+          case BY_HASH:
+            if (name == "BY")
+            {
+              return GeoMatchConstraintValue::BY;
+            }
+            break;
+          case BE_HASH:
+            if (name == "BE")
+            {
+              return GeoMatchConstraintValue::BE;
+            }
+            break;
+          case BZ_HASH:
+            if (name == "BZ")
+            {
+              return GeoMatchConstraintValue::BZ;
+            }
+            break;
+          case BJ_HASH:
+            if (name == "BJ")
+            {
+              return GeoMatchConstraintValue::BJ;
+            }
+            break;
+          case BM_HASH:
+            if (name == "BM")
+            {
+              return GeoMatchConstraintValue::BM;
+            }
+            break;
+          case BT_HASH:
+            if (name == "BT")
+            {
+              return GeoMatchConstraintValue::BT;
+            }
+            break;
+          case BO_HASH:
+            if (name == "BO")
+            {
+              return GeoMatchConstraintValue::BO;
+            }
+            break;
+          case BQ_HASH:
+            if (name == "BQ")
+            {
+              return GeoMatchConstraintValue::BQ;
+            }
+            break;
+          case BA_HASH:
+            if (name == "BA")
+            {
+              return GeoMatchConstraintValue::BA;
+            }
+            break;
+          case BW_HASH:
+            if (name == "BW")
+            {
+              return GeoMatchConstraintValue::BW;
+            }
+            break;
+          case BV_HASH:
+            if (name == "BV")
+            {
+              return GeoMatchConstraintValue::BV;
+            }
+            break;
+          case BR_HASH:
+            if (name == "BR")
+            {
+              return GeoMatchConstraintValue::BR;
+            }
+            break;
+          case IO_HASH:
+            if (name == "IO")
+            {
+              return GeoMatchConstraintValue::IO;
+            }
+            break;
+          case BN_HASH:
+            if (name == "BN")
+            {
+              return GeoMatchConstraintValue::BN;
+            }
+            break;
+          case BG_HASH:
+            if (name == "BG")
+            {
+              return GeoMatchConstraintValue::BG;
+            }
+            break;
+          case BF_HASH:
+            if (name == "BF")
+            {
+              return GeoMatchConstraintValue::BF;
+            }
+            break;
+          case BI_HASH:
+            if (name == "BI")
+            {
+              return GeoMatchConstraintValue::BI;
+            }
+            break;
+          case KH_HASH:
+            if (name == "KH")
+            {
+              return GeoMatchConstraintValue::KH;
+            }
+            break;
+          case CM_HASH:
+            if (name == "CM")
+            {
+              return GeoMatchConstraintValue::CM;
+            }
+            break;
+          case CA_HASH:
+            if (name == "CA")
+            {
+              return GeoMatchConstraintValue::CA;
+            }
+            break;
+          case CV_HASH:
+            if (name == "CV")
+            {
+              return GeoMatchConstraintValue::CV;
+            }
+            break;
+          case KY_HASH:
+            if (name == "KY")
+            {
+              return GeoMatchConstraintValue::KY;
+            }
+            break;
+          case CF_HASH:
+            if (name == "CF")
+            {
+              return GeoMatchConstraintValue::CF;
+            }
+            break;
+          case TD_HASH:
+            if (name == "TD")
+            {
+              return GeoMatchConstraintValue::TD;
+            }
+            break;
+          case CL_HASH:
+            if (name == "CL")
+            {
+              return GeoMatchConstraintValue::CL;
+            }
+            break;
+          case CN_HASH:
+            if (name == "CN")
+            {
+              return GeoMatchConstraintValue::CN;
+            }
+            break;
+          case CX_HASH:
+            if (name == "CX")
+            {
+              return GeoMatchConstraintValue::CX;
+            }
+            break;
+          case CC_HASH:
+            if (name == "CC")
+            {
+              return GeoMatchConstraintValue::CC;
+            }
+            break;
+          case CO_HASH:
+            if (name == "CO")
+            {
+              return GeoMatchConstraintValue::CO;
+            }
+            break;
+          case KM_HASH:
+            if (name == "KM")
+            {
+              return GeoMatchConstraintValue::KM;
+            }
+            break;
+          case CG_HASH:
+            if (name == "CG")
+            {
+              return GeoMatchConstraintValue::CG;
+            }
+            break;
+          case CD_HASH:
+            if (name == "CD")
+            {
+              return GeoMatchConstraintValue::CD;
+            }
+            break;
+          case CK_HASH:
+            if (name == "CK")
+            {
+              return GeoMatchConstraintValue::CK;
+            }
+            break;
+          case CR_HASH:
+            if (name == "CR")
+            {
+              return GeoMatchConstraintValue::CR;
+            }
+            break;
+          case CI_HASH:
+            if (name == "CI")
+            {
+              return GeoMatchConstraintValue::CI;
+            }
+            break;
+          case HR_HASH:
+            if (name == "HR")
+            {
+              return GeoMatchConstraintValue::HR;
+            }
+            break;
+          case CU_HASH:
+            if (name == "CU")
+            {
+              return GeoMatchConstraintValue::CU;
+            }
+            break;
+          case CW_HASH:
+            if (name == "CW")
+            {
+              return GeoMatchConstraintValue::CW;
+            }
+            break;
+          case CY_HASH:
+            if (name == "CY")
+            {
+              return GeoMatchConstraintValue::CY;
+            }
+            break;
+          case CZ_HASH:
+            if (name == "CZ")
+            {
+              return GeoMatchConstraintValue::CZ;
+            }
+            break;
+          case DK_HASH:
+            if (name == "DK")
+            {
+              return GeoMatchConstraintValue::DK;
+            }
+            break;
+          case DJ_HASH:
+            if (name == "DJ")
+            {
+              return GeoMatchConstraintValue::DJ;
+            }
+            break;
+          case DM_HASH:
+            if (name == "DM")
+            {
+              return GeoMatchConstraintValue::DM;
+            }
+            break;
+          case DO_HASH:
+            if (name == "DO")
+            {
+              return GeoMatchConstraintValue::DO;
+            }
+            break;
+          case EC_HASH:
+            if (name == "EC")
+            {
+              return GeoMatchConstraintValue::EC;
+            }
+            break;
+          case EG_HASH:
+            if (name == "EG")
+            {
+              return GeoMatchConstraintValue::EG;
+            }
+            break;
+          case SV_HASH:
+            if (name == "SV")
+            {
+              return GeoMatchConstraintValue::SV;
+            }
+            break;
+          case GQ_HASH:
+            if (name == "GQ")
+            {
+              return GeoMatchConstraintValue::GQ;
+            }
+            break;
+          case ER_HASH:
+            if (name == "ER")
+            {
+              return GeoMatchConstraintValue::ER;
+            }
+            break;
+          case EE_HASH:
+            if (name == "EE")
+            {
+              return GeoMatchConstraintValue::EE;
+            }
+            break;
+          case ET_HASH:
+            if (name == "ET")
+            {
+              return GeoMatchConstraintValue::ET;
+            }
+            break;
+          case FK_HASH:
+            if (name == "FK")
+            {
+              return GeoMatchConstraintValue::FK;
+            }
+            break;
+          case FO_HASH:
+            if (name == "FO")
+            {
+              return GeoMatchConstraintValue::FO;
+            }
+            break;
+          case FJ_HASH:
+            if (name == "FJ")
+            {
+              return GeoMatchConstraintValue::FJ;
+            }
+            break;
+          case FI_HASH:
+            if (name == "FI")
+            {
+              return GeoMatchConstraintValue::FI;
+            }
+            break;
+          case FR_HASH:
+            if (name == "FR")
+            {
+              return GeoMatchConstraintValue::FR;
+            }
+            break;
+          case GF_HASH:
+            if (name == "GF")
+            {
+              return GeoMatchConstraintValue::GF;
+            }
+            break;
+          case PF_HASH:
+            if (name == "PF")
+            {
+              return GeoMatchConstraintValue::PF;
+            }
+            break;
+          case TF_HASH:
+            if (name == "TF")
+            {
+              return GeoMatchConstraintValue::TF;
+            }
+            break;
+          case GA_HASH:
+            if (name == "GA")
+            {
+              return GeoMatchConstraintValue::GA;
+            }
+            break;
+          case GM_HASH:
+            if (name == "GM")
+            {
+              return GeoMatchConstraintValue::GM;
+            }
+            break;
+          case GE_HASH:
+            if (name == "GE")
+            {
+              return GeoMatchConstraintValue::GE;
+            }
+            break;
+          case DE_HASH:
+            if (name == "DE")
+            {
+              return GeoMatchConstraintValue::DE;
+            }
+            break;
+          case GH_HASH:
+            if (name == "GH")
+            {
+              return GeoMatchConstraintValue::GH;
+            }
+            break;
+          case GI_HASH:
+            if (name == "GI")
+            {
+              return GeoMatchConstraintValue::GI;
+            }
+            break;
+          case GR_HASH:
+            if (name == "GR")
+            {
+              return GeoMatchConstraintValue::GR;
+            }
+            break;
+          case GL_HASH:
+            if (name == "GL")
+            {
+              return GeoMatchConstraintValue::GL;
+            }
+            break;
+          case GD_HASH:
+            if (name == "GD")
+            {
+              return GeoMatchConstraintValue::GD;
+            }
+            break;
+          case GP_HASH:
+            if (name == "GP")
+            {
+              return GeoMatchConstraintValue::GP;
+            }
+            break;
+          case GU_HASH:
+            if (name == "GU")
+            {
+              return GeoMatchConstraintValue::GU;
+            }
+            break;
+          case GT_HASH:
+            if (name == "GT")
+            {
+              return GeoMatchConstraintValue::GT;
+            }
+            break;
+          case GG_HASH:
+            if (name == "GG")
+            {
+              return GeoMatchConstraintValue::GG;
+            }
+            break;
+          case GN_HASH:
+            if (name == "GN")
+            {
+              return GeoMatchConstraintValue::GN;
+            }
+            break;
+          case GW_HASH:
+            if (name == "GW")
+            {
+              return GeoMatchConstraintValue::GW;
+            }
+            break;
+          case GY_HASH:
+            if (name == "GY")
+            {
+              return GeoMatchConstraintValue::GY;
+            }
+            break;
+          case HT_HASH:
+            if (name == "HT")
+            {
+              return GeoMatchConstraintValue::HT;
+            }
+            break;
+          case HM_HASH:
+            if (name == "HM")
+            {
+              return GeoMatchConstraintValue::HM;
+            }
+            break;
+          case VA_HASH:
+            if (name == "VA")
+            {
+              return GeoMatchConstraintValue::VA;
+            }
+            break;
+          case HN_HASH:
+            if (name == "HN")
+            {
+              return GeoMatchConstraintValue::HN;
+            }
+            break;
+          case HK_HASH:
+            if (name == "HK")
+            {
+              return GeoMatchConstraintValue::HK;
+            }
+            break;
+          case HU_HASH:
+            if (name == "HU")
+            {
+              return GeoMatchConstraintValue::HU;
+            }
+            break;
+          case IS_HASH:
+            if (name == "IS")
+            {
+              return GeoMatchConstraintValue::IS;
+            }
+            break;
+          case IN_HASH:
+            if (name == "IN")
+            {
+              return GeoMatchConstraintValue::IN;
+            }
+            break;
+          case ID_HASH:
+            if (name == "ID")
+            {
+              return GeoMatchConstraintValue::ID;
+            }
+            break;
+          case IR_HASH:
+            if (name == "IR")
+            {
+              return GeoMatchConstraintValue::IR;
+            }
+            break;
+          case IQ_HASH:
+            if (name == "IQ")
+            {
+              return GeoMatchConstraintValue::IQ;
+            }
+            break;
+          case IE_HASH:
+            if (name == "IE")
+            {
+              return GeoMatchConstraintValue::IE;
+            }
+            break;
+          case IM_HASH:
+            if (name == "IM")
+            {
+              return GeoMatchConstraintValue::IM;
+            }
+            break;
+          case IL_HASH:
+            if (name == "IL")
+            {
+              return GeoMatchConstraintValue::IL;
+            }
+            break;
+          case IT_HASH:
+            if (name == "IT")
+            {
+              return GeoMatchConstraintValue::IT;
+            }
+            break;
+          case JM_HASH:
+            if (name == "JM")
+            {
+              return GeoMatchConstraintValue::JM;
+            }
+            break;
+          case JP_HASH:
+            if (name == "JP")
+            {
+              return GeoMatchConstraintValue::JP;
+            }
+            break;
+          case JE_HASH:
+            if (name == "JE")
+            {
+              return GeoMatchConstraintValue::JE;
+            }
+            break;
+          case JO_HASH:
+            if (name == "JO")
+            {
+              return GeoMatchConstraintValue::JO;
+            }
+            break;
+          case KZ_HASH:
+            if (name == "KZ")
+            {
+              return GeoMatchConstraintValue::KZ;
+            }
+            break;
+          case KE_HASH:
+            if (name == "KE")
+            {
+              return GeoMatchConstraintValue::KE;
+            }
+            break;
+          case KI_HASH:
+            if (name == "KI")
+            {
+              return GeoMatchConstraintValue::KI;
+            }
+            break;
+          case KP_HASH:
+            if (name == "KP")
+            {
+              return GeoMatchConstraintValue::KP;
+            }
+            break;
+          case KR_HASH:
+            if (name == "KR")
+            {
+              return GeoMatchConstraintValue::KR;
+            }
+            break;
+          case KW_HASH:
+            if (name == "KW")
+            {
+              return GeoMatchConstraintValue::KW;
+            }
+            break;
+          case KG_HASH:
+            if (name == "KG")
+            {
+              return GeoMatchConstraintValue::KG;
+            }
+            break;
+          case LA_HASH:
+            if (name == "LA")
+            {
+              return GeoMatchConstraintValue::LA;
+            }
+            break;
+          case LV_HASH:
+            if (name == "LV")
+            {
+              return GeoMatchConstraintValue::LV;
+            }
+            break;
+          case LB_HASH:
+            if (name == "LB")
+            {
+              return GeoMatchConstraintValue::LB;
+            }
+            break;
+          case LS_HASH:
+            if (name == "LS")
+            {
+              return GeoMatchConstraintValue::LS;
+            }
+            break;
+          case LR_HASH:
+            if (name == "LR")
+            {
+              return GeoMatchConstraintValue::LR;
+            }
+            break;
+          case LY_HASH:
+            if (name == "LY")
+            {
+              return GeoMatchConstraintValue::LY;
+            }
+            break;
+          case LI_HASH:
+            if (name == "LI")
+            {
+              return GeoMatchConstraintValue::LI;
+            }
+            break;
+          case LT_HASH:
+            if (name == "LT")
+            {
+              return GeoMatchConstraintValue::LT;
+            }
+            break;
+          case LU_HASH:
+            if (name == "LU")
+            {
+              return GeoMatchConstraintValue::LU;
+            }
+            break;
+          case MO_HASH:
+            if (name == "MO")
+            {
+              return GeoMatchConstraintValue::MO;
+            }
+            break;
+          case MK_HASH:
+            if (name == "MK")
+            {
+              return GeoMatchConstraintValue::MK;
+            }
+            break;
+          case MG_HASH:
+            if (name == "MG")
+            {
+              return GeoMatchConstraintValue::MG;
+            }
+            break;
+          case MW_HASH:
+            if (name == "MW")
+            {
+              return GeoMatchConstraintValue::MW;
+            }
+            break;
+          case MY_HASH:
+            if (name == "MY")
+            {
+              return GeoMatchConstraintValue::MY;
+            }
+            break;
+          case MV_HASH:
+            if (name == "MV")
+            {
+              return GeoMatchConstraintValue::MV;
+            }
+            break;
+          case ML_HASH:
+            if (name == "ML")
+            {
+              return GeoMatchConstraintValue::ML;
+            }
+            break;
+          case MT_HASH:
+            if (name == "MT")
+            {
+              return GeoMatchConstraintValue::MT;
+            }
+            break;
+          case MH_HASH:
+            if (name == "MH")
+            {
+              return GeoMatchConstraintValue::MH;
+            }
+            break;
+          case MQ_HASH:
+            if (name == "MQ")
+            {
+              return GeoMatchConstraintValue::MQ;
+            }
+            break;
+          case MR_HASH:
+            if (name == "MR")
+            {
+              return GeoMatchConstraintValue::MR;
+            }
+            break;
+          case MU_HASH:
+            if (name == "MU")
+            {
+              return GeoMatchConstraintValue::MU;
+            }
+            break;
+          case YT_HASH:
+            if (name == "YT")
+            {
+              return GeoMatchConstraintValue::YT;
+            }
+            break;
+          case MX_HASH:
+            if (name == "MX")
+            {
+              return GeoMatchConstraintValue::MX;
+            }
+            break;
+          case FM_HASH:
+            if (name == "FM")
+            {
+              return GeoMatchConstraintValue::FM;
+            }
+            break;
+          case MD_HASH:
+            if (name == "MD")
+            {
+              return GeoMatchConstraintValue::MD;
+            }
+            break;
+          case MC_HASH:
+            if (name == "MC")
+            {
+              return GeoMatchConstraintValue::MC;
+            }
+            break;
+          case MN_HASH:
+            if (name == "MN")
+            {
+              return GeoMatchConstraintValue::MN;
+            }
+            break;
+          case ME_HASH:
+            if (name == "ME")
+            {
+              return GeoMatchConstraintValue::ME;
+            }
+            break;
+          case MS_HASH:
+            if (name == "MS")
+            {
+              return GeoMatchConstraintValue::MS;
+            }
+            break;
+          case MA_HASH:
+            if (name == "MA")
+            {
+              return GeoMatchConstraintValue::MA;
+            }
+            break;
+          case MZ_HASH:
+            if (name == "MZ")
+            {
+              return GeoMatchConstraintValue::MZ;
+            }
+            break;
+          case MM_HASH:
+            if (name == "MM")
+            {
+              return GeoMatchConstraintValue::MM;
+            }
+            break;
+          case NA_HASH:
+            if (name == "NA")
+            {
+              return GeoMatchConstraintValue::NA;
+            }
+            break;
+          case NR_HASH:
+            if (name == "NR")
+            {
+              return GeoMatchConstraintValue::NR;
+            }
+            break;
+          case NP_HASH:
+            if (name == "NP")
+            {
+              return GeoMatchConstraintValue::NP;
+            }
+            break;
+          case NL_HASH:
+            if (name == "NL")
+            {
+              return GeoMatchConstraintValue::NL;
+            }
+            break;
+          case NC_HASH:
+            if (name == "NC")
+            {
+              return GeoMatchConstraintValue::NC;
+            }
+            break;
+          case NZ_HASH:
+            if (name == "NZ")
+            {
+              return GeoMatchConstraintValue::NZ;
+            }
+            break;
+          case NI_HASH:
+            if (name == "NI")
+            {
+              return GeoMatchConstraintValue::NI;
+            }
+            break;
+          case NE_HASH:
+            if (name == "NE")
+            {
+              return GeoMatchConstraintValue::NE;
+            }
+            break;
+          case NG_HASH:
+            if (name == "NG")
+            {
+              return GeoMatchConstraintValue::NG;
+            }
+            break;
+          case NU_HASH:
+            if (name == "NU")
+            {
+              return GeoMatchConstraintValue::NU;
+            }
+            break;
+          case NF_HASH:
+            if (name == "NF")
+            {
+              return GeoMatchConstraintValue::NF;
+            }
+            break;
+          case MP_HASH:
+            if (name == "MP")
+            {
+              return GeoMatchConstraintValue::MP;
+            }
+            break;
+          case NO_HASH:
+            if (name == "NO")
+            {
+              return GeoMatchConstraintValue::NO;
+            }
+            break;
+          case OM_HASH:
+            if (name == "OM")
+            {
+              return GeoMatchConstraintValue::OM;
+            }
+            break;
+          case PK_HASH:
+            if (name == "PK")
+            {
+              return GeoMatchConstraintValue::PK;
+            }
+            break;
+          case PW_HASH:
+            if (name == "PW")
+            {
+              return GeoMatchConstraintValue::PW;
+            }
+            break;
+          case PS_HASH:
+            if (name == "PS")
+            {
+              return GeoMatchConstraintValue::PS;
+            }
+            break;
+          case PA_HASH:
+            if (name == "PA")
+            {
+              return GeoMatchConstraintValue::PA;
+            }
+            break;
+          case PG_HASH:
+            if (name == "PG")
+            {
+              return GeoMatchConstraintValue::PG;
+            }
+            break;
+          case PY_HASH:
+            if (name == "PY")
+            {
+              return GeoMatchConstraintValue::PY;
+            }
+            break;
+          case PE_HASH:
+            if (name == "PE")
+            {
+              return GeoMatchConstraintValue::PE;
+            }
+            break;
+          case PH_HASH:
+            if (name == "PH")
+            {
+              return GeoMatchConstraintValue::PH;
+            }
+            break;
+          case PN_HASH:
+            if (name == "PN")
+            {
+              return GeoMatchConstraintValue::PN;
+            }
+            break;
+          case PL_HASH:
+            if (name == "PL")
+            {
+              return GeoMatchConstraintValue::PL;
+            }
+            break;
+          case PT_HASH:
+            if (name == "PT")
+            {
+              return GeoMatchConstraintValue::PT;
+            }
+            break;
+          case PR_HASH:
+            if (name == "PR")
+            {
+              return GeoMatchConstraintValue::PR;
+            }
+            break;
+          case QA_HASH:
+            if (name == "QA")
+            {
+              return GeoMatchConstraintValue::QA;
+            }
+            break;
+          case RE_HASH:
+            if (name == "RE")
+            {
+              return GeoMatchConstraintValue::RE;
+            }
+            break;
+          case RO_HASH:
+            if (name == "RO")
+            {
+              return GeoMatchConstraintValue::RO;
+            }
+            break;
+          case RU_HASH:
+            if (name == "RU")
+            {
+              return GeoMatchConstraintValue::RU;
+            }
+            break;
+          case RW_HASH:
+            if (name == "RW")
+            {
+              return GeoMatchConstraintValue::RW;
+            }
+            break;
+          case BL_HASH:
+            if (name == "BL")
+            {
+              return GeoMatchConstraintValue::BL;
+            }
+            break;
+          case SH_HASH:
+            if (name == "SH")
+            {
+              return GeoMatchConstraintValue::SH;
+            }
+            break;
+          case KN_HASH:
+            if (name == "KN")
+            {
+              return GeoMatchConstraintValue::KN;
+            }
+            break;
+          case LC_HASH:
+            if (name == "LC")
+            {
+              return GeoMatchConstraintValue::LC;
+            }
+            break;
+          case MF_HASH:
+            if (name == "MF")
+            {
+              return GeoMatchConstraintValue::MF;
+            }
+            break;
+          case PM_HASH:
+            if (name == "PM")
+            {
+              return GeoMatchConstraintValue::PM;
+            }
+            break;
+          case VC_HASH:
+            if (name == "VC")
+            {
+              return GeoMatchConstraintValue::VC;
+            }
+            break;
+          case WS_HASH:
+            if (name == "WS")
+            {
+              return GeoMatchConstraintValue::WS;
+            }
+            break;
+          case SM_HASH:
+            if (name == "SM")
+            {
+              return GeoMatchConstraintValue::SM;
+            }
+            break;
+          case ST_HASH:
+            if (name == "ST")
+            {
+              return GeoMatchConstraintValue::ST;
+            }
+            break;
+          case SA_HASH:
+            if (name == "SA")
+            {
+              return GeoMatchConstraintValue::SA;
+            }
+            break;
+          case SN_HASH:
+            if (name == "SN")
+            {
+              return GeoMatchConstraintValue::SN;
+            }
+            break;
+          case RS_HASH:
+            if (name == "RS")
+            {
+              return GeoMatchConstraintValue::RS;
+            }
+            break;
+          case SC_HASH:
+            if (name == "SC")
+            {
+              return GeoMatchConstraintValue::SC;
+            }
+            break;
+          case SL_HASH:
+            if (name == "SL")
+            {
+              return GeoMatchConstraintValue::SL;
+            }
+            break;
+          case SG_HASH:
+            if (name == "SG")
+            {
+              return GeoMatchConstraintValue::SG;
+            }
+            break;
+          case SX_HASH:
+            if (name == "SX")
+            {
+              return GeoMatchConstraintValue::SX;
+            }
+            break;
+          case SK_HASH:
+            if (name == "SK")
+            {
+              return GeoMatchConstraintValue::SK;
+            }
+            break;
+          case SI_HASH:
+            if (name == "SI")
+            {
+              return GeoMatchConstraintValue::SI;
+            }
+            break;
+          case SB_HASH:
+            if (name == "SB")
+            {
+              return GeoMatchConstraintValue::SB;
+            }
+            break;
+          case SO_HASH:
+            if (name == "SO")
+            {
+              return GeoMatchConstraintValue::SO;
+            }
+            break;
+          case ZA_HASH:
+            if (name == "ZA")
+            {
+              return GeoMatchConstraintValue::ZA;
+            }
+            break;
+          case GS_HASH:
+            if (name == "GS")
+            {
+              return GeoMatchConstraintValue::GS;
+            }
+            break;
+          case SS_HASH:
+            if (name == "SS")
+            {
+              return GeoMatchConstraintValue::SS;
+            }
+            break;
+          case ES_HASH:
+            if (name == "ES")
+            {
+              return GeoMatchConstraintValue::ES;
+            }
+            break;
+          case LK_HASH:
+            if (name == "LK")
+            {
+              return GeoMatchConstraintValue::LK;
+            }
+            break;
+          case SD_HASH:
+            if (name == "SD")
+            {
+              return GeoMatchConstraintValue::SD;
+            }
+            break;
+          case SR_HASH:
+            if (name == "SR")
+            {
+              return GeoMatchConstraintValue::SR;
+            }
+            break;
+          case SJ_HASH:
+            if (name == "SJ")
+            {
+              return GeoMatchConstraintValue::SJ;
+            }
+            break;
+          case SZ_HASH:
+            if (name == "SZ")
+            {
+              return GeoMatchConstraintValue::SZ;
+            }
+            break;
+          case SE_HASH:
+            if (name == "SE")
+            {
+              return GeoMatchConstraintValue::SE;
+            }
+            break;
+          case CH_HASH:
+            if (name == "CH")
+            {
+              return GeoMatchConstraintValue::CH;
+            }
+            break;
+          case SY_HASH:
+            if (name == "SY")
+            {
+              return GeoMatchConstraintValue::SY;
+            }
+            break;
+          case TW_HASH:
+            if (name == "TW")
+            {
+              return GeoMatchConstraintValue::TW;
+            }
+            break;
+          case TJ_HASH:
+            if (name == "TJ")
+            {
+              return GeoMatchConstraintValue::TJ;
+            }
+            break;
+          case TZ_HASH:
+            if (name == "TZ")
+            {
+              return GeoMatchConstraintValue::TZ;
+            }
+            break;
+          case TH_HASH:
+            if (name == "TH")
+            {
+              return GeoMatchConstraintValue::TH;
+            }
+            break;
+          case TL_HASH:
+            if (name == "TL")
+            {
+              return GeoMatchConstraintValue::TL;
+            }
+            break;
+          case TG_HASH:
+            if (name == "TG")
+            {
+              return GeoMatchConstraintValue::TG;
+            }
+            break;
+          case TK_HASH:
+            if (name == "TK")
+            {
+              return GeoMatchConstraintValue::TK;
+            }
+            break;
+          case TO_HASH:
+            if (name == "TO")
+            {
+              return GeoMatchConstraintValue::TO;
+            }
+            break;
+          case TT_HASH:
+            if (name == "TT")
+            {
+              return GeoMatchConstraintValue::TT;
+            }
+            break;
+          case TN_HASH:
+            if (name == "TN")
+            {
+              return GeoMatchConstraintValue::TN;
+            }
+            break;
+          case TR_HASH:
+            if (name == "TR")
+            {
+              return GeoMatchConstraintValue::TR;
+            }
+            break;
+          case TM_HASH:
+            if (name == "TM")
+            {
+              return GeoMatchConstraintValue::TM;
+            }
+            break;
+          case TC_HASH:
+            if (name == "TC")
+            {
+              return GeoMatchConstraintValue::TC;
+            }
+            break;
+          case TV_HASH:
+            if (name == "TV")
+            {
+              return GeoMatchConstraintValue::TV;
+            }
+            break;
+          case UG_HASH:
+            if (name == "UG")
+            {
+              return GeoMatchConstraintValue::UG;
+            }
+            break;
+          case UA_HASH:
+            if (name == "UA")
+            {
+              return GeoMatchConstraintValue::UA;
+            }
+            break;
+          case AE_HASH:
+            if (name == "AE")
+            {
+              return GeoMatchConstraintValue::AE;
+            }
+            break;
+          case GB_HASH:
+            if (name == "GB")
+            {
+              return GeoMatchConstraintValue::GB;
+            }
+            break;
+          case US_HASH:
+            if (name == "US")
+            {
+              return GeoMatchConstraintValue::US;
+            }
+            break;
+          case UM_HASH:
+            if (name == "UM")
+            {
+              return GeoMatchConstraintValue::UM;
+            }
+            break;
+          case UY_HASH:
+            if (name == "UY")
+            {
+              return GeoMatchConstraintValue::UY;
+            }
+            break;
+          case UZ_HASH:
+            if (name == "UZ")
+            {
+              return GeoMatchConstraintValue::UZ;
+            }
+            break;
+          case VU_HASH:
+            if (name == "VU")
+            {
+              return GeoMatchConstraintValue::VU;
+            }
+            break;
+          case VE_HASH:
+            if (name == "VE")
+            {
+              return GeoMatchConstraintValue::VE;
+            }
+            break;
+          case VN_HASH:
+            if (name == "VN")
+            {
+              return GeoMatchConstraintValue::VN;
+            }
+            break;
+          case VG_HASH:
+            if (name == "VG")
+            {
+              return GeoMatchConstraintValue::VG;
+            }
+            break;
+          case VI_HASH:
+            if (name == "VI")
+            {
+              return GeoMatchConstraintValue::VI;
+            }
+            break;
+          case WF_HASH:
+            if (name == "WF")
+            {
+              return GeoMatchConstraintValue::WF;
+            }
+            break;
+          case EH_HASH:
+            if (name == "EH")
+            {
+              return GeoMatchConstraintValue::EH;
+            }
+            break;
+          case YE_HASH:
+            if (name == "YE")
+            {
+              return GeoMatchConstraintValue::YE;
+            }
+            break;
+          case ZM_HASH:
+            if (name == "ZM")
+            {
+              return GeoMatchConstraintValue::ZM;
+            }
+            break;
+          case ZW_HASH:
+            if (name == "ZW")
+            {
+              return GeoMatchConstraintValue::ZW;
+            }
+            break;
+          default:
+            break;
           }
-          else if (hashCode == ZW_HASH)
+          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+          if(overflowContainer)
           {
-            enumValue = GeoMatchConstraintValue::ZW;
-            return true;
+            overflowContainer->StoreOverflow(hashCode, name);
+            return static_cast<GeoMatchConstraintValue>(hashCode);
           }
-          return false;
+
+          return GeoMatchConstraintValue::NOT_SET;
         }
 
-        static bool GetNameForEnumHelper0(GeoMatchConstraintValue enumValue, Aws::String& value)
+        const char* GetNameForGeoMatchConstraintValue(GeoMatchConstraintValue enumValue)
         {
           switch(enumValue)
           {
           case GeoMatchConstraintValue::AF:
-            value = "AF";
-            return true;
+            return "AF";
           case GeoMatchConstraintValue::AX:
-            value = "AX";
-            return true;
+            return "AX";
           case GeoMatchConstraintValue::AL:
-            value = "AL";
-            return true;
+            return "AL";
           case GeoMatchConstraintValue::DZ:
-            value = "DZ";
-            return true;
+            return "DZ";
           case GeoMatchConstraintValue::AS:
-            value = "AS";
-            return true;
+            return "AS";
           case GeoMatchConstraintValue::AD:
-            value = "AD";
-            return true;
+            return "AD";
           case GeoMatchConstraintValue::AO:
-            value = "AO";
-            return true;
+            return "AO";
           case GeoMatchConstraintValue::AI:
-            value = "AI";
-            return true;
+            return "AI";
           case GeoMatchConstraintValue::AQ:
-            value = "AQ";
-            return true;
+            return "AQ";
           case GeoMatchConstraintValue::AG:
-            value = "AG";
-            return true;
+            return "AG";
           case GeoMatchConstraintValue::AR:
-            value = "AR";
-            return true;
+            return "AR";
           case GeoMatchConstraintValue::AM:
-            value = "AM";
-            return true;
+            return "AM";
           case GeoMatchConstraintValue::AW:
-            value = "AW";
-            return true;
+            return "AW";
           case GeoMatchConstraintValue::AU:
-            value = "AU";
-            return true;
+            return "AU";
           case GeoMatchConstraintValue::AT:
-            value = "AT";
-            return true;
+            return "AT";
           case GeoMatchConstraintValue::AZ:
-            value = "AZ";
-            return true;
+            return "AZ";
           case GeoMatchConstraintValue::BS:
-            value = "BS";
-            return true;
+            return "BS";
           case GeoMatchConstraintValue::BH:
-            value = "BH";
-            return true;
+            return "BH";
           case GeoMatchConstraintValue::BD:
-            value = "BD";
-            return true;
+            return "BD";
           case GeoMatchConstraintValue::BB:
-            value = "BB";
-            return true;
+            return "BB";
           case GeoMatchConstraintValue::BY:
-            value = "BY";
-            return true;
+            return "BY";
           case GeoMatchConstraintValue::BE:
-            value = "BE";
-            return true;
+            return "BE";
           case GeoMatchConstraintValue::BZ:
-            value = "BZ";
-            return true;
+            return "BZ";
           case GeoMatchConstraintValue::BJ:
-            value = "BJ";
-            return true;
+            return "BJ";
           case GeoMatchConstraintValue::BM:
-            value = "BM";
-            return true;
+            return "BM";
           case GeoMatchConstraintValue::BT:
-            value = "BT";
-            return true;
+            return "BT";
           case GeoMatchConstraintValue::BO:
-            value = "BO";
-            return true;
+            return "BO";
           case GeoMatchConstraintValue::BQ:
-            value = "BQ";
-            return true;
+            return "BQ";
           case GeoMatchConstraintValue::BA:
-            value = "BA";
-            return true;
+            return "BA";
           case GeoMatchConstraintValue::BW:
-            value = "BW";
-            return true;
+            return "BW";
           case GeoMatchConstraintValue::BV:
-            value = "BV";
-            return true;
+            return "BV";
           case GeoMatchConstraintValue::BR:
-            value = "BR";
-            return true;
+            return "BR";
           case GeoMatchConstraintValue::IO:
-            value = "IO";
-            return true;
+            return "IO";
           case GeoMatchConstraintValue::BN:
-            value = "BN";
-            return true;
+            return "BN";
           case GeoMatchConstraintValue::BG:
-            value = "BG";
-            return true;
+            return "BG";
           case GeoMatchConstraintValue::BF:
-            value = "BF";
-            return true;
+            return "BF";
           case GeoMatchConstraintValue::BI:
-            value = "BI";
-            return true;
+            return "BI";
           case GeoMatchConstraintValue::KH:
-            value = "KH";
-            return true;
+            return "KH";
           case GeoMatchConstraintValue::CM:
-            value = "CM";
-            return true;
+            return "CM";
           case GeoMatchConstraintValue::CA:
-            value = "CA";
-            return true;
+            return "CA";
           case GeoMatchConstraintValue::CV:
-            value = "CV";
-            return true;
+            return "CV";
           case GeoMatchConstraintValue::KY:
-            value = "KY";
-            return true;
+            return "KY";
           case GeoMatchConstraintValue::CF:
-            value = "CF";
-            return true;
+            return "CF";
           case GeoMatchConstraintValue::TD:
-            value = "TD";
-            return true;
+            return "TD";
           case GeoMatchConstraintValue::CL:
-            value = "CL";
-            return true;
+            return "CL";
           case GeoMatchConstraintValue::CN:
-            value = "CN";
-            return true;
+            return "CN";
           case GeoMatchConstraintValue::CX:
-            value = "CX";
-            return true;
+            return "CX";
           case GeoMatchConstraintValue::CC:
-            value = "CC";
-            return true;
+            return "CC";
           case GeoMatchConstraintValue::CO:
-            value = "CO";
-            return true;
+            return "CO";
           case GeoMatchConstraintValue::KM:
-            value = "KM";
-            return true;
+            return "KM";
           case GeoMatchConstraintValue::CG:
-            value = "CG";
-            return true;
+            return "CG";
           case GeoMatchConstraintValue::CD:
-            value = "CD";
-            return true;
+            return "CD";
           case GeoMatchConstraintValue::CK:
-            value = "CK";
-            return true;
+            return "CK";
           case GeoMatchConstraintValue::CR:
-            value = "CR";
-            return true;
+            return "CR";
           case GeoMatchConstraintValue::CI:
-            value = "CI";
-            return true;
+            return "CI";
           case GeoMatchConstraintValue::HR:
-            value = "HR";
-            return true;
+            return "HR";
           case GeoMatchConstraintValue::CU:
-            value = "CU";
-            return true;
+            return "CU";
           case GeoMatchConstraintValue::CW:
-            value = "CW";
-            return true;
+            return "CW";
           case GeoMatchConstraintValue::CY:
-            value = "CY";
-            return true;
+            return "CY";
           case GeoMatchConstraintValue::CZ:
-            value = "CZ";
-            return true;
+            return "CZ";
           case GeoMatchConstraintValue::DK:
-            value = "DK";
-            return true;
+            return "DK";
           case GeoMatchConstraintValue::DJ:
-            value = "DJ";
-            return true;
+            return "DJ";
           case GeoMatchConstraintValue::DM:
-            value = "DM";
-            return true;
+            return "DM";
           case GeoMatchConstraintValue::DO:
-            value = "DO";
-            return true;
+            return "DO";
           case GeoMatchConstraintValue::EC:
-            value = "EC";
-            return true;
+            return "EC";
           case GeoMatchConstraintValue::EG:
-            value = "EG";
-            return true;
+            return "EG";
           case GeoMatchConstraintValue::SV:
-            value = "SV";
-            return true;
+            return "SV";
           case GeoMatchConstraintValue::GQ:
-            value = "GQ";
-            return true;
+            return "GQ";
           case GeoMatchConstraintValue::ER:
-            value = "ER";
-            return true;
+            return "ER";
           case GeoMatchConstraintValue::EE:
-            value = "EE";
-            return true;
+            return "EE";
           case GeoMatchConstraintValue::ET:
-            value = "ET";
-            return true;
+            return "ET";
           case GeoMatchConstraintValue::FK:
-            value = "FK";
-            return true;
+            return "FK";
           case GeoMatchConstraintValue::FO:
-            value = "FO";
-            return true;
+            return "FO";
           case GeoMatchConstraintValue::FJ:
-            value = "FJ";
-            return true;
+            return "FJ";
           case GeoMatchConstraintValue::FI:
-            value = "FI";
-            return true;
+            return "FI";
           case GeoMatchConstraintValue::FR:
-            value = "FR";
-            return true;
+            return "FR";
           case GeoMatchConstraintValue::GF:
-            value = "GF";
-            return true;
+            return "GF";
           case GeoMatchConstraintValue::PF:
-            value = "PF";
-            return true;
+            return "PF";
           case GeoMatchConstraintValue::TF:
-            value = "TF";
-            return true;
+            return "TF";
           case GeoMatchConstraintValue::GA:
-            value = "GA";
-            return true;
+            return "GA";
           case GeoMatchConstraintValue::GM:
-            value = "GM";
-            return true;
+            return "GM";
           case GeoMatchConstraintValue::GE:
-            value = "GE";
-            return true;
+            return "GE";
           case GeoMatchConstraintValue::DE:
-            value = "DE";
-            return true;
+            return "DE";
           case GeoMatchConstraintValue::GH:
-            value = "GH";
-            return true;
+            return "GH";
           case GeoMatchConstraintValue::GI:
-            value = "GI";
-            return true;
+            return "GI";
           case GeoMatchConstraintValue::GR:
-            value = "GR";
-            return true;
+            return "GR";
           case GeoMatchConstraintValue::GL:
-            value = "GL";
-            return true;
+            return "GL";
           case GeoMatchConstraintValue::GD:
-            value = "GD";
-            return true;
+            return "GD";
           case GeoMatchConstraintValue::GP:
-            value = "GP";
-            return true;
+            return "GP";
           case GeoMatchConstraintValue::GU:
-            value = "GU";
-            return true;
+            return "GU";
           case GeoMatchConstraintValue::GT:
-            value = "GT";
-            return true;
+            return "GT";
           case GeoMatchConstraintValue::GG:
-            value = "GG";
-            return true;
+            return "GG";
           case GeoMatchConstraintValue::GN:
-            value = "GN";
-            return true;
+            return "GN";
           case GeoMatchConstraintValue::GW:
-            value = "GW";
-            return true;
+            return "GW";
           case GeoMatchConstraintValue::GY:
-            value = "GY";
-            return true;
+            return "GY";
           case GeoMatchConstraintValue::HT:
-            value = "HT";
-            return true;
+            return "HT";
           case GeoMatchConstraintValue::HM:
-            value = "HM";
-            return true;
+            return "HM";
           case GeoMatchConstraintValue::VA:
-            value = "VA";
-            return true;
+            return "VA";
           case GeoMatchConstraintValue::HN:
-            value = "HN";
-            return true;
+            return "HN";
           case GeoMatchConstraintValue::HK:
-            value = "HK";
-            return true;
+            return "HK";
           case GeoMatchConstraintValue::HU:
-            value = "HU";
-            return true;
+            return "HU";
           case GeoMatchConstraintValue::IS:
-            value = "IS";
-            return true;
+            return "IS";
           case GeoMatchConstraintValue::IN:
-            value = "IN";
-            return true;
+            return "IN";
           case GeoMatchConstraintValue::ID:
-            value = "ID";
-            return true;
+            return "ID";
           case GeoMatchConstraintValue::IR:
-            value = "IR";
-            return true;
+            return "IR";
           case GeoMatchConstraintValue::IQ:
-            value = "IQ";
-            return true;
+            return "IQ";
           case GeoMatchConstraintValue::IE:
-            value = "IE";
-            return true;
+            return "IE";
           case GeoMatchConstraintValue::IM:
-            value = "IM";
-            return true;
+            return "IM";
           case GeoMatchConstraintValue::IL:
-            value = "IL";
-            return true;
+            return "IL";
           case GeoMatchConstraintValue::IT:
-            value = "IT";
-            return true;
+            return "IT";
           case GeoMatchConstraintValue::JM:
-            value = "JM";
-            return true;
+            return "JM";
           case GeoMatchConstraintValue::JP:
-            value = "JP";
-            return true;
+            return "JP";
           case GeoMatchConstraintValue::JE:
-            value = "JE";
-            return true;
+            return "JE";
           case GeoMatchConstraintValue::JO:
-            value = "JO";
-            return true;
+            return "JO";
           case GeoMatchConstraintValue::KZ:
-            value = "KZ";
-            return true;
+            return "KZ";
           case GeoMatchConstraintValue::KE:
-            value = "KE";
-            return true;
+            return "KE";
           case GeoMatchConstraintValue::KI:
-            value = "KI";
-            return true;
+            return "KI";
           case GeoMatchConstraintValue::KP:
-            value = "KP";
-            return true;
+            return "KP";
           case GeoMatchConstraintValue::KR:
-            value = "KR";
-            return true;
+            return "KR";
           case GeoMatchConstraintValue::KW:
-            value = "KW";
-            return true;
+            return "KW";
           case GeoMatchConstraintValue::KG:
-            value = "KG";
-            return true;
+            return "KG";
           case GeoMatchConstraintValue::LA:
-            value = "LA";
-            return true;
-          default:
-            return false;
-          }
-        }
-        static bool GetNameForEnumHelper1(GeoMatchConstraintValue enumValue, Aws::String& value)
-        {
-          switch(enumValue)
-          {
+            return "LA";
           case GeoMatchConstraintValue::LV:
-            value = "LV";
-            return true;
+            return "LV";
           case GeoMatchConstraintValue::LB:
-            value = "LB";
-            return true;
+            return "LB";
           case GeoMatchConstraintValue::LS:
-            value = "LS";
-            return true;
+            return "LS";
           case GeoMatchConstraintValue::LR:
-            value = "LR";
-            return true;
+            return "LR";
           case GeoMatchConstraintValue::LY:
-            value = "LY";
-            return true;
+            return "LY";
           case GeoMatchConstraintValue::LI:
-            value = "LI";
-            return true;
+            return "LI";
           case GeoMatchConstraintValue::LT:
-            value = "LT";
-            return true;
+            return "LT";
           case GeoMatchConstraintValue::LU:
-            value = "LU";
-            return true;
+            return "LU";
           case GeoMatchConstraintValue::MO:
-            value = "MO";
-            return true;
+            return "MO";
           case GeoMatchConstraintValue::MK:
-            value = "MK";
-            return true;
+            return "MK";
           case GeoMatchConstraintValue::MG:
-            value = "MG";
-            return true;
+            return "MG";
           case GeoMatchConstraintValue::MW:
-            value = "MW";
-            return true;
+            return "MW";
           case GeoMatchConstraintValue::MY:
-            value = "MY";
-            return true;
+            return "MY";
           case GeoMatchConstraintValue::MV:
-            value = "MV";
-            return true;
+            return "MV";
           case GeoMatchConstraintValue::ML:
-            value = "ML";
-            return true;
+            return "ML";
           case GeoMatchConstraintValue::MT:
-            value = "MT";
-            return true;
+            return "MT";
           case GeoMatchConstraintValue::MH:
-            value = "MH";
-            return true;
+            return "MH";
           case GeoMatchConstraintValue::MQ:
-            value = "MQ";
-            return true;
+            return "MQ";
           case GeoMatchConstraintValue::MR:
-            value = "MR";
-            return true;
+            return "MR";
           case GeoMatchConstraintValue::MU:
-            value = "MU";
-            return true;
+            return "MU";
           case GeoMatchConstraintValue::YT:
-            value = "YT";
-            return true;
+            return "YT";
           case GeoMatchConstraintValue::MX:
-            value = "MX";
-            return true;
+            return "MX";
           case GeoMatchConstraintValue::FM:
-            value = "FM";
-            return true;
+            return "FM";
           case GeoMatchConstraintValue::MD:
-            value = "MD";
-            return true;
+            return "MD";
           case GeoMatchConstraintValue::MC:
-            value = "MC";
-            return true;
+            return "MC";
           case GeoMatchConstraintValue::MN:
-            value = "MN";
-            return true;
+            return "MN";
           case GeoMatchConstraintValue::ME:
-            value = "ME";
-            return true;
+            return "ME";
           case GeoMatchConstraintValue::MS:
-            value = "MS";
-            return true;
+            return "MS";
           case GeoMatchConstraintValue::MA:
-            value = "MA";
-            return true;
+            return "MA";
           case GeoMatchConstraintValue::MZ:
-            value = "MZ";
-            return true;
+            return "MZ";
           case GeoMatchConstraintValue::MM:
-            value = "MM";
-            return true;
+            return "MM";
           case GeoMatchConstraintValue::NA:
-            value = "NA";
-            return true;
+            return "NA";
           case GeoMatchConstraintValue::NR:
-            value = "NR";
-            return true;
+            return "NR";
           case GeoMatchConstraintValue::NP:
-            value = "NP";
-            return true;
+            return "NP";
           case GeoMatchConstraintValue::NL:
-            value = "NL";
-            return true;
+            return "NL";
           case GeoMatchConstraintValue::NC:
-            value = "NC";
-            return true;
+            return "NC";
           case GeoMatchConstraintValue::NZ:
-            value = "NZ";
-            return true;
+            return "NZ";
           case GeoMatchConstraintValue::NI:
-            value = "NI";
-            return true;
+            return "NI";
           case GeoMatchConstraintValue::NE:
-            value = "NE";
-            return true;
+            return "NE";
           case GeoMatchConstraintValue::NG:
-            value = "NG";
-            return true;
+            return "NG";
           case GeoMatchConstraintValue::NU:
-            value = "NU";
-            return true;
+            return "NU";
           case GeoMatchConstraintValue::NF:
-            value = "NF";
-            return true;
+            return "NF";
           case GeoMatchConstraintValue::MP:
-            value = "MP";
-            return true;
+            return "MP";
           case GeoMatchConstraintValue::NO:
-            value = "NO";
-            return true;
+            return "NO";
           case GeoMatchConstraintValue::OM:
-            value = "OM";
-            return true;
+            return "OM";
           case GeoMatchConstraintValue::PK:
-            value = "PK";
-            return true;
+            return "PK";
           case GeoMatchConstraintValue::PW:
-            value = "PW";
-            return true;
+            return "PW";
           case GeoMatchConstraintValue::PS:
-            value = "PS";
-            return true;
+            return "PS";
           case GeoMatchConstraintValue::PA:
-            value = "PA";
-            return true;
+            return "PA";
           case GeoMatchConstraintValue::PG:
-            value = "PG";
-            return true;
+            return "PG";
           case GeoMatchConstraintValue::PY:
-            value = "PY";
-            return true;
+            return "PY";
           case GeoMatchConstraintValue::PE:
-            value = "PE";
-            return true;
+            return "PE";
           case GeoMatchConstraintValue::PH:
-            value = "PH";
-            return true;
+            return "PH";
           case GeoMatchConstraintValue::PN:
-            value = "PN";
-            return true;
+            return "PN";
           case GeoMatchConstraintValue::PL:
-            value = "PL";
-            return true;
+            return "PL";
           case GeoMatchConstraintValue::PT:
-            value = "PT";
-            return true;
+            return "PT";
           case GeoMatchConstraintValue::PR:
-            value = "PR";
-            return true;
+            return "PR";
           case GeoMatchConstraintValue::QA:
-            value = "QA";
-            return true;
+            return "QA";
           case GeoMatchConstraintValue::RE:
-            value = "RE";
-            return true;
+            return "RE";
           case GeoMatchConstraintValue::RO:
-            value = "RO";
-            return true;
+            return "RO";
           case GeoMatchConstraintValue::RU:
-            value = "RU";
-            return true;
+            return "RU";
           case GeoMatchConstraintValue::RW:
-            value = "RW";
-            return true;
+            return "RW";
           case GeoMatchConstraintValue::BL:
-            value = "BL";
-            return true;
+            return "BL";
           case GeoMatchConstraintValue::SH:
-            value = "SH";
-            return true;
+            return "SH";
           case GeoMatchConstraintValue::KN:
-            value = "KN";
-            return true;
+            return "KN";
           case GeoMatchConstraintValue::LC:
-            value = "LC";
-            return true;
+            return "LC";
           case GeoMatchConstraintValue::MF:
-            value = "MF";
-            return true;
+            return "MF";
           case GeoMatchConstraintValue::PM:
-            value = "PM";
-            return true;
+            return "PM";
           case GeoMatchConstraintValue::VC:
-            value = "VC";
-            return true;
+            return "VC";
           case GeoMatchConstraintValue::WS:
-            value = "WS";
-            return true;
+            return "WS";
           case GeoMatchConstraintValue::SM:
-            value = "SM";
-            return true;
+            return "SM";
           case GeoMatchConstraintValue::ST:
-            value = "ST";
-            return true;
+            return "ST";
           case GeoMatchConstraintValue::SA:
-            value = "SA";
-            return true;
+            return "SA";
           case GeoMatchConstraintValue::SN:
-            value = "SN";
-            return true;
+            return "SN";
           case GeoMatchConstraintValue::RS:
-            value = "RS";
-            return true;
+            return "RS";
           case GeoMatchConstraintValue::SC:
-            value = "SC";
-            return true;
+            return "SC";
           case GeoMatchConstraintValue::SL:
-            value = "SL";
-            return true;
+            return "SL";
           case GeoMatchConstraintValue::SG:
-            value = "SG";
-            return true;
+            return "SG";
           case GeoMatchConstraintValue::SX:
-            value = "SX";
-            return true;
+            return "SX";
           case GeoMatchConstraintValue::SK:
-            value = "SK";
-            return true;
+            return "SK";
           case GeoMatchConstraintValue::SI:
-            value = "SI";
-            return true;
+            return "SI";
           case GeoMatchConstraintValue::SB:
-            value = "SB";
-            return true;
+            return "SB";
           case GeoMatchConstraintValue::SO:
-            value = "SO";
-            return true;
+            return "SO";
           case GeoMatchConstraintValue::ZA:
-            value = "ZA";
-            return true;
+            return "ZA";
           case GeoMatchConstraintValue::GS:
-            value = "GS";
-            return true;
+            return "GS";
           case GeoMatchConstraintValue::SS:
-            value = "SS";
-            return true;
+            return "SS";
           case GeoMatchConstraintValue::ES:
-            value = "ES";
-            return true;
+            return "ES";
           case GeoMatchConstraintValue::LK:
-            value = "LK";
-            return true;
+            return "LK";
           case GeoMatchConstraintValue::SD:
-            value = "SD";
-            return true;
+            return "SD";
           case GeoMatchConstraintValue::SR:
-            value = "SR";
-            return true;
+            return "SR";
           case GeoMatchConstraintValue::SJ:
-            value = "SJ";
-            return true;
+            return "SJ";
           case GeoMatchConstraintValue::SZ:
-            value = "SZ";
-            return true;
+            return "SZ";
           case GeoMatchConstraintValue::SE:
-            value = "SE";
-            return true;
+            return "SE";
           case GeoMatchConstraintValue::CH:
-            value = "CH";
-            return true;
+            return "CH";
           case GeoMatchConstraintValue::SY:
-            value = "SY";
-            return true;
+            return "SY";
           case GeoMatchConstraintValue::TW:
-            value = "TW";
-            return true;
+            return "TW";
           case GeoMatchConstraintValue::TJ:
-            value = "TJ";
-            return true;
+            return "TJ";
           case GeoMatchConstraintValue::TZ:
-            value = "TZ";
-            return true;
+            return "TZ";
           case GeoMatchConstraintValue::TH:
-            value = "TH";
-            return true;
+            return "TH";
           case GeoMatchConstraintValue::TL:
-            value = "TL";
-            return true;
+            return "TL";
           case GeoMatchConstraintValue::TG:
-            value = "TG";
-            return true;
+            return "TG";
           case GeoMatchConstraintValue::TK:
-            value = "TK";
-            return true;
+            return "TK";
           case GeoMatchConstraintValue::TO:
-            value = "TO";
-            return true;
+            return "TO";
           case GeoMatchConstraintValue::TT:
-            value = "TT";
-            return true;
+            return "TT";
           case GeoMatchConstraintValue::TN:
-            value = "TN";
-            return true;
+            return "TN";
           case GeoMatchConstraintValue::TR:
-            value = "TR";
-            return true;
+            return "TR";
           case GeoMatchConstraintValue::TM:
-            value = "TM";
-            return true;
+            return "TM";
           case GeoMatchConstraintValue::TC:
-            value = "TC";
-            return true;
+            return "TC";
           case GeoMatchConstraintValue::TV:
-            value = "TV";
-            return true;
+            return "TV";
           case GeoMatchConstraintValue::UG:
-            value = "UG";
-            return true;
+            return "UG";
           case GeoMatchConstraintValue::UA:
-            value = "UA";
-            return true;
+            return "UA";
           case GeoMatchConstraintValue::AE:
-            value = "AE";
-            return true;
+            return "AE";
           case GeoMatchConstraintValue::GB:
-            value = "GB";
-            return true;
+            return "GB";
           case GeoMatchConstraintValue::US:
-            value = "US";
-            return true;
+            return "US";
           case GeoMatchConstraintValue::UM:
-            value = "UM";
-            return true;
+            return "UM";
           case GeoMatchConstraintValue::UY:
-            value = "UY";
-            return true;
+            return "UY";
           case GeoMatchConstraintValue::UZ:
-            value = "UZ";
-            return true;
+            return "UZ";
           case GeoMatchConstraintValue::VU:
-            value = "VU";
-            return true;
+            return "VU";
           case GeoMatchConstraintValue::VE:
-            value = "VE";
-            return true;
+            return "VE";
           case GeoMatchConstraintValue::VN:
-            value = "VN";
-            return true;
+            return "VN";
           case GeoMatchConstraintValue::VG:
-            value = "VG";
-            return true;
+            return "VG";
           case GeoMatchConstraintValue::VI:
-            value = "VI";
-            return true;
-          default:
-            return false;
-          }
-        }
-        static bool GetNameForEnumHelper2(GeoMatchConstraintValue enumValue, Aws::String& value)
-        {
-          switch(enumValue)
-          {
+            return "VI";
           case GeoMatchConstraintValue::WF:
-            value = "WF";
-            return true;
+            return "WF";
           case GeoMatchConstraintValue::EH:
-            value = "EH";
-            return true;
+            return "EH";
           case GeoMatchConstraintValue::YE:
-            value = "YE";
-            return true;
+            return "YE";
           case GeoMatchConstraintValue::ZM:
-            value = "ZM";
-            return true;
+            return "ZM";
           case GeoMatchConstraintValue::ZW:
-            value = "ZW";
-            return true;
+            return "ZW";
           default:
-            return false;
-          }
-        }
-
-        GeoMatchConstraintValue GetGeoMatchConstraintValueForName(const Aws::String& name)
-        {
-          int hashCode = HashingUtils::HashString(name.c_str());
-          GeoMatchConstraintValue enumValue;
-          if (GetEnumForNameHelper0(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          else if (GetEnumForNameHelper1(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          else if (GetEnumForNameHelper2(hashCode, enumValue))
-          {
-             return enumValue;
-          }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            overflowContainer->StoreOverflow(hashCode, name);
-            return static_cast<GeoMatchConstraintValue>(hashCode);
-          }
-
-          return GeoMatchConstraintValue::NOT_SET;
-        }
+            EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
+            if(overflowContainer)
+            {
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
+            }
 
-        Aws::String GetNameForGeoMatchConstraintValue(GeoMatchConstraintValue enumValue)
-        {
-          Aws::String value;
-          if (GetNameForEnumHelper0(enumValue, value))
-          {
-            return value;
-          }
-          else if (GetNameForEnumHelper1(enumValue, value))
-          {
-            return value;
-          }
-          else if (GetNameForEnumHelper2(enumValue, value))
-          {
-            return value;
-          }
-          EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
-          if(overflowContainer)
-          {
-            return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+            return "";
           }
-
-          return "";
         }
 
       } // namespace GeoMatchConstraintValueMapper
@@ -30,85 +30,121 @@ namespace Aws
       namespace ParameterExceptionFieldMapper
       {
 
-        static const int CHANGE_ACTION_HASH = HashingUtils::HashString("CHANGE_ACTION");
-        static const int WAF_ACTION_HASH = HashingUtils::HashString("WAF_ACTION");
-        static const int WAF_OVERRIDE_ACTION_HASH = HashingUtils::HashString("WAF_OVERRIDE_ACTION");
-        static const int PREDICATE_TYPE_HASH = HashingUtils::HashString("PREDICATE_TYPE");
-        static const int IPSET_TYPE_HASH = HashingUtils::HashString("IPSET_TYPE");
-        static const int BYTE_MATCH_FIELD_TYPE_HASH = HashingUtils::HashString("BYTE_MATCH_FIELD_TYPE");
-        static const int SQL_INJECTION_MATCH_FIELD_TYPE_HASH = HashingUtils::HashString("SQL_INJECTION_MATCH_FIELD_TYPE");
-        static const int BYTE_MATCH_TEXT_TRANSFORMATION_HASH = HashingUtils::HashString("BYTE_MATCH_TEXT_TRANSFORMATION");
-        static const int BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH = HashingUtils::HashString("BYTE_MATCH_POSITIONAL_CONSTRAINT");
-        static const int SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH = HashingUtils::HashString("SIZE_CONSTRAINT_COMPARISON_OPERATOR");
-        static const int GEO_MATCH_LOCATION_TYPE_HASH = HashingUtils::HashString("GEO_MATCH_LOCATION_TYPE");
-        static const int GEO_MATCH_LOCATION_VALUE_HASH = HashingUtils::HashString("GEO_MATCH_LOCATION_VALUE");
-        static const int RATE_KEY_HASH = HashingUtils::HashString("RATE_KEY");
-        static const int RULE_TYPE_HASH = HashingUtils::HashString("RULE_TYPE");
-        static const int NEXT_MARKER_HASH = HashingUtils::HashString("NEXT_MARKER");
+        static constexpr int CHANGE_ACTION_HASH = HashingUtils::CompileTimeHashString("CHANGE_ACTION");
+        static constexpr int WAF_ACTION_HASH = HashingUtils::CompileTimeHashString("WAF_ACTION");
+        static constexpr int WAF_OVERRIDE_ACTION_HASH = HashingUtils::CompileTimeHashString("WAF_OVERRIDE_ACTION");
+        static constexpr int PREDICATE_TYPE_HASH = HashingUtils::CompileTimeHashString("PREDICATE_TYPE");
+        static constexpr int IPSET_TYPE_HASH = HashingUtils::CompileTimeHashString("IPSET_TYPE");
+        static constexpr int BYTE_MATCH_FIELD_TYPE_HASH = HashingUtils::CompileTimeHashString("BYTE_MATCH_FIELD_TYPE");
+        static constexpr int SQL_INJECTION_MATCH_FIELD_TYPE_HASH = HashingUtils::CompileTimeHashString("SQL_INJECTION_MATCH_FIELD_TYPE");
+        static constexpr int BYTE_MATCH_TEXT_TRANSFORMATION_HASH = HashingUtils::CompileTimeHashString("BYTE_MATCH_TEXT_TRANSFORMATION");
+        static constexpr int BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH = HashingUtils::CompileTimeHashString("BYTE_MATCH_POSITIONAL_CONSTRAINT");
+        static constexpr int SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH = HashingUtils::CompileTimeHashString("SIZE_CONSTRAINT_COMPARISON_OPERATOR");
+        static constexpr int GEO_MATCH_LOCATION_TYPE_HASH = HashingUtils::CompileTimeHashString("GEO_MATCH_LOCATION_TYPE");
+        static constexpr int GEO_MATCH_LOCATION_VALUE_HASH = HashingUtils::CompileTimeHashString("GEO_MATCH_LOCATION_VALUE");
+        static constexpr int RATE_KEY_HASH = HashingUtils::CompileTimeHashString("RATE_KEY");
+        static constexpr int RULE_TYPE_HASH = HashingUtils::CompileTimeHashString("RULE_TYPE");
+        static constexpr int NEXT_MARKER_HASH = HashingUtils::CompileTimeHashString("NEXT_MARKER");
 
 
         ParameterExceptionField GetParameterExceptionFieldForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CHANGE_ACTION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ParameterExceptionField::CHANGE_ACTION;
-          }
-          else if (hashCode == WAF_ACTION_HASH)
-          {
-            return ParameterExceptionField::WAF_ACTION;
-          }
-          else if (hashCode == WAF_OVERRIDE_ACTION_HASH)
-          {
-            return ParameterExceptionField::WAF_OVERRIDE_ACTION;
-          }
-          else if (hashCode == PREDICATE_TYPE_HASH)
-          {
-            return ParameterExceptionField::PREDICATE_TYPE;
-          }
-          else if (hashCode == IPSET_TYPE_HASH)
-          {
-            return ParameterExceptionField::IPSET_TYPE;
-          }
-          else if (hashCode == BYTE_MATCH_FIELD_TYPE_HASH)
-          {
-            return ParameterExceptionField::BYTE_MATCH_FIELD_TYPE;
-          }
-          else if (hashCode == SQL_INJECTION_MATCH_FIELD_TYPE_HASH)
-          {
-            return ParameterExceptionField::SQL_INJECTION_MATCH_FIELD_TYPE;
-          }
-          else if (hashCode == BYTE_MATCH_TEXT_TRANSFORMATION_HASH)
-          {
-            return ParameterExceptionField::BYTE_MATCH_TEXT_TRANSFORMATION;
-          }
-          else if (hashCode == BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH)
-          {
-            return ParameterExceptionField::BYTE_MATCH_POSITIONAL_CONSTRAINT;
-          }
-          else if (hashCode == SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH)
-          {
-            return ParameterExceptionField::SIZE_CONSTRAINT_COMPARISON_OPERATOR;
-          }
-          else if (hashCode == GEO_MATCH_LOCATION_TYPE_HASH)
-          {
-            return ParameterExceptionField::GEO_MATCH_LOCATION_TYPE;
-          }
-          else if (hashCode == GEO_MATCH_LOCATION_VALUE_HASH)
-          {
-            return ParameterExceptionField::GEO_MATCH_LOCATION_VALUE;
-          }
-          else if (hashCode == RATE_KEY_HASH)
-          {
-            return ParameterExceptionField::RATE_KEY;
-          }
-          else if (hashCode == RULE_TYPE_HASH)
-          {
-            return ParameterExceptionField::RULE_TYPE;
-          }
-          else if (hashCode == NEXT_MARKER_HASH)
-          {
-            return ParameterExceptionField::NEXT_MARKER;
+          case CHANGE_ACTION_HASH:
+            if (name == "CHANGE_ACTION")
+            {
+              return ParameterExceptionField::CHANGE_ACTION;
+            }
+            break;
+          case WAF_ACTION_HASH:
+            if (name == "WAF_ACTION")
+            {
+              return ParameterExceptionField::WAF_ACTION;
+            }
+            break;
+          case WAF_OVERRIDE_ACTION_HASH:
+            if (name == "WAF_OVERRIDE_ACTION")
+            {
+              return ParameterExceptionField::WAF_OVERRIDE_ACTION;
+            }
+            break;
+          case PREDICATE_TYPE_HASH:
+            if (name == "PREDICATE_TYPE")
+            {
+              return ParameterExceptionField::PREDICATE_TYPE;
+            }
+            break;
+          case IPSET_TYPE_HASH:
+            if (name == "IPSET_TYPE")
+            {
+              return ParameterExceptionField::IPSET_TYPE;
+            }
+            break;
+          case BYTE_MATCH_FIELD_TYPE_HASH:
+            if (name == "BYTE_MATCH_FIELD_TYPE")
+            {
+              return ParameterExceptionField::BYTE_MATCH_FIELD_TYPE;
+            }
+            break;
+          case SQL_INJECTION_MATCH_FIELD_TYPE_HASH:
+            if (name == "SQL_INJECTION_MATCH_FIELD_TYPE")
+            {
+              return ParameterExceptionField::SQL_INJECTION_MATCH_FIELD_TYPE;
+            }
+            break;
+          case BYTE_MATCH_TEXT_TRANSFORMATION_HASH:
+            if (name == "BYTE_MATCH_TEXT_TRANSFORMATION")
+            {
+              return ParameterExceptionField::BYTE_MATCH_TEXT_TRANSFORMATION;
+            }
+            break;
+          case BYTE_MATCH_POSITIONAL_CONSTRAINT_HASH:
+            if (name == "BYTE_MATCH_POSITIONAL_CONSTRAINT")
+            {
+              return ParameterExceptionField::BYTE_MATCH_POSITIONAL_CONSTRAINT;
+            }
+            break;
+          case SIZE_CONSTRAINT_COMPARISON_OPERATOR_HASH:
+            if (name == "SIZE_CONSTRAINT_COMPARISON_OPERATOR")
+            {
+              return ParameterExceptionField::SIZE_CONSTRAINT_COMPARISON_OPERATOR;
+            }
+            break;
+          case GEO_MATCH_LOCATION_TYPE_HASH:
+            if (name == "GEO_MATCH_LOCATION_TYPE")
+            {
+              return ParameterExceptionField::GEO_MATCH_LOCATION_TYPE;
+            }
+            break;
+          case GEO_MATCH_LOCATION_VALUE_HASH:
+            if (name == "GEO_MATCH_LOCATION_VALUE")
+            {
+              return ParameterExceptionField::GEO_MATCH_LOCATION_VALUE;
+            }
+            break;
+          case RATE_KEY_HASH:
+            if (name == "RATE_KEY")
+            {
+              return ParameterExceptionField::RATE_KEY;
+            }
+            break;
+          case RULE_TYPE_HASH:
+            if (name == "RULE_TYPE")
+            {
+              return ParameterExceptionField::RULE_TYPE;
+            }
+            break;
+          case NEXT_MARKER_HASH:
+            if (name == "NEXT_MARKER")
+            {
+              return ParameterExceptionField::NEXT_MARKER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -120,7 +156,7 @@ namespace Aws
           return ParameterExceptionField::NOT_SET;
         }
 
-        Aws::String GetNameForParameterExceptionField(ParameterExceptionField enumValue)
+        const char* GetNameForParameterExceptionField(ParameterExceptionField enumValue)
         {
           switch(enumValue)
           {
@@ -158,7 +194,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ParameterExceptionReasonMapper
       {
 
-        static const int INVALID_OPTION_HASH = HashingUtils::HashString("INVALID_OPTION");
-        static const int ILLEGAL_COMBINATION_HASH = HashingUtils::HashString("ILLEGAL_COMBINATION");
+        static constexpr int INVALID_OPTION_HASH = HashingUtils::CompileTimeHashString("INVALID_OPTION");
+        static constexpr int ILLEGAL_COMBINATION_HASH = HashingUtils::CompileTimeHashString("ILLEGAL_COMBINATION");
 
 
         ParameterExceptionReason GetParameterExceptionReasonForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INVALID_OPTION_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ParameterExceptionReason::INVALID_OPTION;
-          }
-          else if (hashCode == ILLEGAL_COMBINATION_HASH)
-          {
-            return ParameterExceptionReason::ILLEGAL_COMBINATION;
+          case INVALID_OPTION_HASH:
+            if (name == "INVALID_OPTION")
+            {
+              return ParameterExceptionReason::INVALID_OPTION;
+            }
+            break;
+          case ILLEGAL_COMBINATION_HASH:
+            if (name == "ILLEGAL_COMBINATION")
+            {
+              return ParameterExceptionReason::ILLEGAL_COMBINATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ParameterExceptionReason::NOT_SET;
         }
 
-        Aws::String GetNameForParameterExceptionReason(ParameterExceptionReason enumValue)
+        const char* GetNameForParameterExceptionReason(ParameterExceptionReason enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace PositionalConstraintMapper
       {
 
-        static const int EXACTLY_HASH = HashingUtils::HashString("EXACTLY");
-        static const int STARTS_WITH_HASH = HashingUtils::HashString("STARTS_WITH");
-        static const int ENDS_WITH_HASH = HashingUtils::HashString("ENDS_WITH");
-        static const int CONTAINS_HASH = HashingUtils::HashString("CONTAINS");
-        static const int CONTAINS_WORD_HASH = HashingUtils::HashString("CONTAINS_WORD");
+        static constexpr int EXACTLY_HASH = HashingUtils::CompileTimeHashString("EXACTLY");
+        static constexpr int STARTS_WITH_HASH = HashingUtils::CompileTimeHashString("STARTS_WITH");
+        static constexpr int ENDS_WITH_HASH = HashingUtils::CompileTimeHashString("ENDS_WITH");
+        static constexpr int CONTAINS_HASH = HashingUtils::CompileTimeHashString("CONTAINS");
+        static constexpr int CONTAINS_WORD_HASH = HashingUtils::CompileTimeHashString("CONTAINS_WORD");
 
 
         PositionalConstraint GetPositionalConstraintForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EXACTLY_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PositionalConstraint::EXACTLY;
-          }
-          else if (hashCode == STARTS_WITH_HASH)
-          {
-            return PositionalConstraint::STARTS_WITH;
-          }
-          else if (hashCode == ENDS_WITH_HASH)
-          {
-            return PositionalConstraint::ENDS_WITH;
-          }
-          else if (hashCode == CONTAINS_HASH)
-          {
-            return PositionalConstraint::CONTAINS;
-          }
-          else if (hashCode == CONTAINS_WORD_HASH)
-          {
-            return PositionalConstraint::CONTAINS_WORD;
+          case EXACTLY_HASH:
+            if (name == "EXACTLY")
+            {
+              return PositionalConstraint::EXACTLY;
+            }
+            break;
+          case STARTS_WITH_HASH:
+            if (name == "STARTS_WITH")
+            {
+              return PositionalConstraint::STARTS_WITH;
+            }
+            break;
+          case ENDS_WITH_HASH:
+            if (name == "ENDS_WITH")
+            {
+              return PositionalConstraint::ENDS_WITH;
+            }
+            break;
+          case CONTAINS_HASH:
+            if (name == "CONTAINS")
+            {
+              return PositionalConstraint::CONTAINS;
+            }
+            break;
+          case CONTAINS_WORD_HASH:
+            if (name == "CONTAINS_WORD")
+            {
+              return PositionalConstraint::CONTAINS_WORD;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return PositionalConstraint::NOT_SET;
         }
 
-        Aws::String GetNameForPositionalConstraint(PositionalConstraint enumValue)
+        const char* GetNameForPositionalConstraint(PositionalConstraint enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
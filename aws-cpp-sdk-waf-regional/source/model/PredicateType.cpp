@@ -30,45 +30,65 @@ namespace Aws
       namespace PredicateTypeMapper
       {
 
-        static const int IPMatch_HASH = HashingUtils::HashString("IPMatch");
-        static const int ByteMatch_HASH = HashingUtils::HashString("ByteMatch");
-        static const int SqlInjectionMatch_HASH = HashingUtils::HashString("SqlInjectionMatch");
-        static const int GeoMatch_HASH = HashingUtils::HashString("GeoMatch");
-        static const int SizeConstraint_HASH = HashingUtils::HashString("SizeConstraint");
-        static const int XssMatch_HASH = HashingUtils::HashString("XssMatch");
-        static const int RegexMatch_HASH = HashingUtils::HashString("RegexMatch");
+        static constexpr int IPMatch_HASH = HashingUtils::CompileTimeHashString("IPMatch");
+        static constexpr int ByteMatch_HASH = HashingUtils::CompileTimeHashString("ByteMatch");
+        static constexpr int SqlInjectionMatch_HASH = HashingUtils::CompileTimeHashString("SqlInjectionMatch");
+        static constexpr int GeoMatch_HASH = HashingUtils::CompileTimeHashString("GeoMatch");
+        static constexpr int SizeConstraint_HASH = HashingUtils::CompileTimeHashString("SizeConstraint");
+        static constexpr int XssMatch_HASH = HashingUtils::CompileTimeHashString("XssMatch");
+        static constexpr int RegexMatch_HASH = HashingUtils::CompileTimeHashString("RegexMatch");
 
 
         PredicateType GetPredicateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IPMatch_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PredicateType::IPMatch;
-          }
-          else if (hashCode == ByteMatch_HASH)
-          {
-            return PredicateType::ByteMatch;
-          }
-          else if (hashCode == SqlInjectionMatch_HASH)
-          {
-            return PredicateType::SqlInjectionMatch;
-          }
-          else if (hashCode == GeoMatch_HASH)
-          {
-            return PredicateType::GeoMatch;
-          }
-          else if (hashCode == SizeConstraint_HASH)
-          {
-            return PredicateType::SizeConstraint;
-          }
-          else if (hashCode == XssMatch_HASH)
-          {
-            return PredicateType::XssMatch;
-          }
-          else if (hashCode == RegexMatch_HASH)
-          {
-            return PredicateType::RegexMatch;
+          case IPMatch_HASH:
+            if (name == "IPMatch")
+            {
+              return PredicateType::IPMatch;
+            }
+            break;
+          case ByteMatch_HASH:
+            if (name == "ByteMatch")
+            {
+              return PredicateType::ByteMatch;
+            }
+            break;
+          case SqlInjectionMatch_HASH:
+            if (name == "SqlInjectionMatch")
+            {
+              return PredicateType::SqlInjectionMatch;
+            }
+            break;
+          case GeoMatch_HASH:
+            if (name == "GeoMatch")
+            {
+              return PredicateType::GeoMatch;
+            }
+            break;
+          case SizeConstraint_HASH:
+            if (name == "SizeConstraint")
+            {
+              return PredicateType::SizeConstraint;
+            }
+            break;
+          case XssMatch_HASH:
+            if (name == "XssMatch")
+            {
+              return PredicateType::XssMatch;
+            }
+            break;
+          case RegexMatch_HASH:
+            if (name == "RegexMatch")
+            {
+              return PredicateType::RegexMatch;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -80,7 +100,7 @@ namespace Aws
           return PredicateType::NOT_SET;
         }
 
-        Aws::String GetNameForPredicateType(PredicateType enumValue)
+        const char* GetNameForPredicateType(PredicateType enumValue)
         {
           switch(enumValue)
           {
@@ -102,7 +122,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
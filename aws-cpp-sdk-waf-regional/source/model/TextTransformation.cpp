@@ -30,40 +30,58 @@ namespace Aws
       namespace TextTransformationMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int COMPRESS_WHITE_SPACE_HASH = HashingUtils::HashString("COMPRESS_WHITE_SPACE");
-        static const int HTML_ENTITY_DECODE_HASH = HashingUtils::HashString("HTML_ENTITY_DECODE");
-        static const int LOWERCASE_HASH = HashingUtils::HashString("LOWERCASE");
-        static const int CMD_LINE_HASH = HashingUtils::HashString("CMD_LINE");
-        static const int URL_DECODE_HASH = HashingUtils::HashString("URL_DECODE");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int COMPRESS_WHITE_SPACE_HASH = HashingUtils::CompileTimeHashString("COMPRESS_WHITE_SPACE");
+        static constexpr int HTML_ENTITY_DECODE_HASH = HashingUtils::CompileTimeHashString("HTML_ENTITY_DECODE");
+        static constexpr int LOWERCASE_HASH = HashingUtils::CompileTimeHashString("LOWERCASE");
+        static constexpr int CMD_LINE_HASH = HashingUtils::CompileTimeHashString("CMD_LINE");
+        static constexpr int URL_DECODE_HASH = HashingUtils::CompileTimeHashString("URL_DECODE");
 
 
         TextTransformation GetTextTransformationForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TextTransformation::NONE;
-          }
-          else if (hashCode == COMPRESS_WHITE_SPACE_HASH)
-          {
-            return TextTransformation::COMPRESS_WHITE_SPACE;
-          }
-          else if (hashCode == HTML_ENTITY_DECODE_HASH)
-          {
-            return TextTransformation::HTML_ENTITY_DECODE;
-          }
-          else if (hashCode == LOWERCASE_HASH)
-          {
-            return TextTransformation::LOWERCASE;
-          }
-          else if (hashCode == CMD_LINE_HASH)
-          {
-            return TextTransformation::CMD_LINE;
-          }
-          else if (hashCode == URL_DECODE_HASH)
-          {
-            return TextTransformation::URL_DECODE;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return TextTransformation::NONE;
+            }
+            break;
+          case COMPRESS_WHITE_SPACE_HASH:
+            if (name == "COMPRESS_WHITE_SPACE")
+            {
+              return TextTransformation::COMPRESS_WHITE_SPACE;
+            }
+            break;
+          case HTML_ENTITY_DECODE_HASH:
+            if (name == "HTML_ENTITY_DECODE")
+            {
+              return TextTransformation::HTML_ENTITY_DECODE;
+            }
+            break;
+          case LOWERCASE_HASH:
+            if (name == "LOWERCASE")
+            {
+              return TextTransformation::LOWERCASE;
+            }
+            break;
+          case CMD_LINE_HASH:
+            if (name == "CMD_LINE")
+            {
+              return TextTransformation::CMD_LINE;
+            }
+            break;
+          case URL_DECODE_HASH:
+            if (name == "URL_DECODE")
+            {
+              return TextTransformation::URL_DECODE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return TextTransformation::NOT_SET;
         }
 
-        Aws::String GetNameForTextTransformation(TextTransformation enumValue)
+        const char* GetNameForTextTransformation(TextTransformation enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
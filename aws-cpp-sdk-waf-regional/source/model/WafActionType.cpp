@@ -30,25 +30,37 @@ namespace Aws
       namespace WafActionTypeMapper
       {
 
-        static const int BLOCK_HASH = HashingUtils::HashString("BLOCK");
-        static const int ALLOW_HASH = HashingUtils::HashString("ALLOW");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
+        static constexpr int BLOCK_HASH = HashingUtils::CompileTimeHashString("BLOCK");
+        static constexpr int ALLOW_HASH = HashingUtils::CompileTimeHashString("ALLOW");
+        static constexpr int COUNT_HASH = HashingUtils::CompileTimeHashString("COUNT");
 
 
         WafActionType GetWafActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == BLOCK_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WafActionType::BLOCK;
-          }
-          else if (hashCode == ALLOW_HASH)
-          {
-            return WafActionType::ALLOW;
-          }
-          else if (hashCode == COUNT_HASH)
-          {
-            return WafActionType::COUNT;
+          case BLOCK_HASH:
+            if (name == "BLOCK")
+            {
+              return WafActionType::BLOCK;
+            }
+            break;
+          case ALLOW_HASH:
+            if (name == "ALLOW")
+            {
+              return WafActionType::ALLOW;
+            }
+            break;
+          case COUNT_HASH:
+            if (name == "COUNT")
+            {
+              return WafActionType::COUNT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return WafActionType::NOT_SET;
         }
 
-        Aws::String GetNameForWafActionType(WafActionType enumValue)
+        const char* GetNameForWafActionType(WafActionType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
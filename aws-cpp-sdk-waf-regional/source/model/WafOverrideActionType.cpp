@@ -30,20 +30,30 @@ namespace Aws
       namespace WafOverrideActionTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int COUNT_HASH = HashingUtils::HashString("COUNT");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int COUNT_HASH = HashingUtils::CompileTimeHashString("COUNT");
 
 
         WafOverrideActionType GetWafOverrideActionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WafOverrideActionType::NONE;
-          }
-          else if (hashCode == COUNT_HASH)
-          {
-            return WafOverrideActionType::COUNT;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return WafOverrideActionType::NONE;
+            }
+            break;
+          case COUNT_HASH:
+            if (name == "COUNT")
+            {
+              return WafOverrideActionType::COUNT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return WafOverrideActionType::NOT_SET;
         }
 
-        Aws::String GetNameForWafOverrideActionType(WafOverrideActionType enumValue)
+        const char* GetNameForWafOverrideActionType(WafOverrideActionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
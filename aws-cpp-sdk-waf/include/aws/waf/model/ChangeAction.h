@@ -34,7 +34,8 @@ namespace ChangeActionMapper
 {
 AWS_WAF_API ChangeAction GetChangeActionForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForChangeAction(ChangeAction value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForChangeAction(ChangeAction value);
 } // namespace ChangeActionMapper
 } // namespace Model
 } // namespace WAF
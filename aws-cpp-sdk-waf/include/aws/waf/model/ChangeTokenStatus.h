@@ -35,7 +35,8 @@ namespace ChangeTokenStatusMapper
 {
 AWS_WAF_API ChangeTokenStatus GetChangeTokenStatusForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForChangeTokenStatus(ChangeTokenStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForChangeTokenStatus(ChangeTokenStatus value);
 } // namespace ChangeTokenStatusMapper
 } // namespace Model
 } // namespace WAF
@@ -38,7 +38,8 @@ namespace ComparisonOperatorMapper
 {
 AWS_WAF_API ComparisonOperator GetComparisonOperatorForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForComparisonOperator(ComparisonOperator value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForComparisonOperator(ComparisonOperator value);
 } // namespace ComparisonOperatorMapper
 } // namespace Model
 } // namespace WAF
@@ -33,7 +33,8 @@ namespace GeoMatchConstraintTypeMapper
 {
 AWS_WAF_API GeoMatchConstraintType GetGeoMatchConstraintTypeForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForGeoMatchConstraintType(GeoMatchConstraintType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForGeoMatchConstraintType(GeoMatchConstraintType value);
 } // namespace GeoMatchConstraintTypeMapper
 } // namespace Model
 } // namespace WAF
@@ -281,7 +281,8 @@ namespace GeoMatchConstraintValueMapper
 {
 AWS_WAF_API GeoMatchConstraintValue GetGeoMatchConstraintValueForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForGeoMatchConstraintValue(GeoMatchConstraintValue value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForGeoMatchConstraintValue(GeoMatchConstraintValue value);
 } // namespace GeoMatchConstraintValueMapper
 } // namespace Model
 } // namespace WAF
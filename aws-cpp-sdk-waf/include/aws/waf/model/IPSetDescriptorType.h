@@ -34,7 +34,8 @@ namespace IPSetDescriptorTypeMapper
 {
 AWS_WAF_API IPSetDescriptorType GetIPSetDescriptorTypeForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForIPSetDescriptorType(IPSetDescriptorType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForIPSetDescriptorType(IPSetDescriptorType value);
 } // namespace IPSetDescriptorTypeMapper
 } // namespace Model
 } // namespace WAF
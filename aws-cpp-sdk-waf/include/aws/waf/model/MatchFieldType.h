@@ -37,7 +37,8 @@ namespace MatchFieldTypeMapper
 {
 AWS_WAF_API MatchFieldType GetMatchFieldTypeForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForMatchFieldType(MatchFieldType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForMatchFieldType(MatchFieldType value);
 } // namespace MatchFieldTypeMapper
 } // namespace Model
 } // namespace WAF
@@ -47,7 +47,8 @@ namespace ParameterExceptionFieldMapper
 {
 AWS_WAF_API ParameterExceptionField GetParameterExceptionFieldForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForParameterExceptionField(ParameterExceptionField value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForParameterExceptionField(ParameterExceptionField value);
 } // namespace ParameterExceptionFieldMapper
 } // namespace Model
 } // namespace WAF
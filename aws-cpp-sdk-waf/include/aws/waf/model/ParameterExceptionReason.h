@@ -34,7 +34,8 @@ namespace ParameterExceptionReasonMapper
 {
 AWS_WAF_API ParameterExceptionReason GetParameterExceptionReasonForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForParameterExceptionReason(ParameterExceptionReason value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForParameterExceptionReason(ParameterExceptionReason value);
 } // namespace ParameterExceptionReasonMapper
 } // namespace Model
 } // namespace WAF
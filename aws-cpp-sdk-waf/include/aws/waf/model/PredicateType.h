@@ -39,7 +39,8 @@ namespace PredicateTypeMapper
 {
 AWS_WAF_API PredicateType GetPredicateTypeForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForPredicateType(PredicateType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForPredicateType(PredicateType value);
 } // namespace PredicateTypeMapper
 } // namespace Model
 } // namespace WAF
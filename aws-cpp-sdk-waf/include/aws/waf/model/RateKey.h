@@ -33,7 +33,8 @@ namespace RateKeyMapper
 {
 AWS_WAF_API RateKey GetRateKeyForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForRateKey(RateKey value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForRateKey(RateKey value);
 } // namespace RateKeyMapper
 } // namespace Model
 } // namespace WAF
@@ -38,7 +38,8 @@ namespace TextTransformationMapper
 {
 AWS_WAF_API TextTransformation GetTextTransformationForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForTextTransformation(TextTransformation value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForTextTransformation(TextTransformation value);
 } // namespace TextTransformationMapper
 } // namespace Model
 } // namespace WAF
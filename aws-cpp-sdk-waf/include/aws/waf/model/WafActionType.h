@@ -35,7 +35,8 @@ namespace WafActionTypeMapper
 {
 AWS_WAF_API WafActionType GetWafActionTypeForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForWafActionType(WafActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForWafActionType(WafActionType value);
 } // namespace WafActionTypeMapper
 } // namespace Model
 } // namespace WAF
@@ -34,7 +34,8 @@ namespace WafOverrideActionTypeMapper
 {
 AWS_WAF_API WafOverrideActionType GetWafOverrideActionTypeForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForWafOverrideActionType(WafOverrideActionType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForWafOverrideActionType(WafOverrideActionType value);
 } // namespace WafOverrideActionTypeMapper
 } // namespace Model
 } // namespace WAF
@@ -35,7 +35,8 @@ namespace WafRuleTypeMapper
 {
 AWS_WAF_API WafRuleType GetWafRuleTypeForName(const Aws::String& name);
 
-AWS_WAF_API Aws::String GetNameForWafRuleType(WafRuleType value);
+// names of values not modeled point into the enum overflow container
+AWS_WAF_API const char* GetNameForWafRuleType(WafRuleType value);
 } // namespace WafRuleTypeMapper
 } // namespace Model
 } // namespace WAF
@@ -30,40 +30,58 @@ namespace Aws
       namespace ComparisonOperatorMapper
       {
 
-        static const int EQ_HASH = HashingUtils::HashString("EQ");
-        static const int NE_HASH = HashingUtils::HashString("NE");
-        static const int LE_HASH = HashingUtils::HashString("LE");
-        static const int LT_HASH = HashingUtils::HashString("LT");
-        static const int GE_HASH = HashingUtils::HashString("GE");
-        static const int GT_HASH = HashingUtils::HashString("GT");
+        static constexpr int EQ_HASH = HashingUtils::CompileTimeHashString("EQ");
+        static constexpr int NE_HASH = HashingUtils::CompileTimeHashString("NE");
+        static constexpr int LE_HASH = HashingUtils::CompileTimeHashString("LE");
+        static constexpr int LT_HASH = HashingUtils::CompileTimeHashString("LT");
+        static constexpr int GE_HASH = HashingUtils::CompileTimeHashString("GE");
+        static constexpr int GT_HASH = HashingUtils::CompileTimeHashString("GT");
 
 
         ComparisonOperator GetComparisonOperatorForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == EQ_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ComparisonOperator::EQ;
-          }
-          else if (hashCode == NE_HASH)
-          {
-            return ComparisonOperator::NE;
-          }
-          else if (hashCode == LE_HASH)
-          {
-            return ComparisonOperator::LE;
-          }
-          else if (hashCode == LT_HASH)
-          {
-            return ComparisonOperator::LT;
-          }
-          else if (hashCode == GE_HASH)
-          {
-            return ComparisonOperator::GE;
-          }
-          else if (hashCode == GT_HASH)
-          {
-            return ComparisonOperator::GT;
+          case EQ_HASH:
+            if (name == "EQ")
+            {
+              return ComparisonOperator::EQ;
+            }
+            break;
+          case NE_HASH:
+            if (name == "NE")
+            {
+              return ComparisonOperator::NE;
+            }
+            break;
+          case LE_HASH:
+            if (name == "LE")
+            {
+              return ComparisonOperator::LE;
+            }
+            break;
+          case LT_HASH:
+            if (name == "LT")
+            {
+              return ComparisonOperator::LT;
+            }
+            break;
+          case GE_HASH:
+            if (name == "GE")
+            {
+              return ComparisonOperator::GE;
+            }
+            break;
+          case GT_HASH:
+            if (name == "GT")
+            {
+              return ComparisonOperator::GT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -75,7 +93,7 @@ namespace Aws
           return ComparisonOperator::NOT_SET;
         }
 
-        Aws::String GetNameForComparisonOperator(ComparisonOperator enumValue)
+        const char* GetNameForComparisonOperator(ComparisonOperator enumValue)
         {
           switch(enumValue)
           {
@@ -95,7 +113,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace GeoMatchConstraintTypeMapper
       {
 
-        static const int Country_HASH = HashingUtils::HashString("Country");
+        static constexpr int Country_HASH = HashingUtils::CompileTimeHashString("Country");
 
 
         GeoMatchConstraintType GetGeoMatchConstraintTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == Country_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return GeoMatchConstraintType::Country;
+          case Country_HASH:
+            if (name == "Country")
+            {
+              return GeoMatchConstraintType::Country;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return GeoMatchConstraintType::NOT_SET;
         }
 
-        Aws::String GetNameForGeoMatchConstraintType(GeoMatchConstraintType enumValue)
+        const char* GetNameForGeoMatchConstraintType(GeoMatchConstraintType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace IPSetDescriptorTypeMapper
       {
 
-        static const int IPV4_HASH = HashingUtils::HashString("IPV4");
-        static const int IPV6_HASH = HashingUtils::HashString("IPV6");
+        static constexpr int IPV4_HASH = HashingUtils::CompileTimeHashString("IPV4");
+        static constexpr int IPV6_HASH = HashingUtils::CompileTimeHashString("IPV6");
 
 
         IPSetDescriptorType GetIPSetDescriptorTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IPV4_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return IPSetDescriptorType::IPV4;
-          }
-          else if (hashCode == IPV6_HASH)
-          {
-            return IPSetDescriptorType::IPV6;
+          case IPV4_HASH:
+            if (name == "IPV4")
+            {
+              return IPSetDescriptorType::IPV4;
+            }
+            break;
+          case IPV6_HASH:
+            if (name == "IPV6")
+            {
+              return IPSetDescriptorType::IPV6;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return IPSetDescriptorType::NOT_SET;
         }
 
-        Aws::String GetNameForIPSetDescriptorType(IPSetDescriptorType enumValue)
+        const char* GetNameForIPSetDescriptorType(IPSetDescriptorType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
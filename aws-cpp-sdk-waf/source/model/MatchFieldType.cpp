@@ -30,35 +30,51 @@ namespace Aws
       namespace MatchFieldTypeMapper
       {
 
-        static const int URI_HASH = HashingUtils::HashString("URI");
-        static const int QUERY_STRING_HASH = HashingUtils::HashString("QUERY_STRING");
-        static const int HEADER_HASH = HashingUtils::HashString("HEADER");
-        static const int METHOD_HASH = HashingUtils::HashString("METHOD");
-        static const int BODY_HASH = HashingUtils::HashString("BODY");
+        static constexpr int URI_HASH = HashingUtils::CompileTimeHashString("URI");
+        static constexpr int QUERY_STRING_HASH = HashingUtils::CompileTimeHashString("QUERY_STRING");
+        static constexpr int HEADER_HASH = HashingUtils::CompileTimeHashString("HEADER");
+        static constexpr int METHOD_HASH = HashingUtils::CompileTimeHashString("METHOD");
+        static constexpr int BODY_HASH = HashingUtils::CompileTimeHashString("BODY");
 
 
         MatchFieldType GetMatchFieldTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == URI_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MatchFieldType::URI;
-          }
-          else if (hashCode == QUERY_STRING_HASH)
-          {
-            return MatchFieldType::QUERY_STRING;
-          }
-          else if (hashCode == HEADER_HASH)
-          {
-            return MatchFieldType::HEADER;
-          }
-          else if (hashCode == METHOD_HASH)
-          {
-            return MatchFieldType::METHOD;
-          }
-          else if (hashCode == BODY_HASH)
-          {
-            return MatchFieldType::BODY;
+          case URI_HASH:
+            if (name == "URI")
+            {
+              return MatchFieldType::URI;
+            }
+            break;
+          case QUERY_STRING_HASH:
+            if (name == "QUERY_STRING")
+            {
+              return MatchFieldType::QUERY_STRING;
+            }
+            break;
+          case HEADER_HASH:
+            if (name == "HEADER")
+            {
+              return MatchFieldType::HEADER;
+            }
+            break;
+          case METHOD_HASH:
+            if (name == "METHOD")
+            {
+              return MatchFieldType::METHOD;
+            }
+            break;
+          case BODY_HASH:
+            if (name == "BODY")
+            {
+              return MatchFieldType::BODY;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return MatchFieldType::NOT_SET;
         }
 
-        Aws::String GetNameForMatchFieldType(MatchFieldType enumValue)
+        const char* GetNameForMatchFieldType(MatchFieldType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace RateKeyMapper
       {
 
-        static const int IP_HASH = HashingUtils::HashString("IP");
+        static constexpr int IP_HASH = HashingUtils::CompileTimeHashString("IP");
 
 
         RateKey GetRateKeyForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == IP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RateKey::IP;
+          case IP_HASH:
+            if (name == "IP")
+            {
+              return RateKey::IP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return RateKey::NOT_SET;
         }
 
-        Aws::String GetNameForRateKey(RateKey enumValue)
+        const char* GetNameForRateKey(RateKey enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
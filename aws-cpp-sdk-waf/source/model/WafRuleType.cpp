@@ -30,25 +30,37 @@ namespace Aws
       namespace WafRuleTypeMapper
       {
 
-        static const int REGULAR_HASH = HashingUtils::HashString("REGULAR");
-        static const int RATE_BASED_HASH = HashingUtils::HashString("RATE_BASED");
-        static const int GROUP_HASH = HashingUtils::HashString("GROUP");
+        static constexpr int REGULAR_HASH = HashingUtils::CompileTimeHashString("REGULAR");
+        static constexpr int RATE_BASED_HASH = HashingUtils::CompileTimeHashString("RATE_BASED");
+        static constexpr int GROUP_HASH = HashingUtils::CompileTimeHashString("GROUP");
 
 
         WafRuleType GetWafRuleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGULAR_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WafRuleType::REGULAR;
-          }
-          else if (hashCode == RATE_BASED_HASH)
-          {
-            return WafRuleType::RATE_BASED;
-          }
-          else if (hashCode == GROUP_HASH)
-          {
-            return WafRuleType::GROUP;
+          case REGULAR_HASH:
+            if (name == "REGULAR")
+            {
+              return WafRuleType::REGULAR;
+            }
+            break;
+          case RATE_BASED_HASH:
+            if (name == "RATE_BASED")
+            {
+              return WafRuleType::RATE_BASED;
+            }
+            break;
+          case GROUP_HASH:
+            if (name == "GROUP")
+            {
+              return WafRuleType::GROUP;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return WafRuleType::NOT_SET;
         }
 
-        Aws::String GetNameForWafRuleType(WafRuleType enumValue)
+        const char* GetNameForWafRuleType(WafRuleType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -63,7 +63,8 @@ namespace ActivityTypeMapper
 {
 AWS_WORKDOCS_API ActivityType GetActivityTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForActivityType(ActivityType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForActivityType(ActivityType value);
 } // namespace ActivityTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,7 +34,8 @@ namespace BooleanEnumTypeMapper
 {
 AWS_WORKDOCS_API BooleanEnumType GetBooleanEnumTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForBooleanEnumType(BooleanEnumType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForBooleanEnumType(BooleanEnumType value);
 } // namespace BooleanEnumTypeMapper
 } // namespace Model
 } // namespace WorkDocs
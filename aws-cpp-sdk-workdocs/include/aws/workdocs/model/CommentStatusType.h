@@ -35,7 +35,8 @@ namespace CommentStatusTypeMapper
 {
 AWS_WORKDOCS_API CommentStatusType GetCommentStatusTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForCommentStatusType(CommentStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForCommentStatusType(CommentStatusType value);
 } // namespace CommentStatusTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,7 +34,8 @@ namespace CommentVisibilityTypeMapper
 {
 AWS_WORKDOCS_API CommentVisibilityType GetCommentVisibilityTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForCommentVisibilityType(CommentVisibilityType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForCommentVisibilityType(CommentVisibilityType value);
 } // namespace CommentVisibilityTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,7 +34,8 @@ namespace DocumentSourceTypeMapper
 {
 AWS_WORKDOCS_API DocumentSourceType GetDocumentSourceTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForDocumentSourceType(DocumentSourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForDocumentSourceType(DocumentSourceType value);
 } // namespace DocumentSourceTypeMapper
 } // namespace Model
 } // namespace WorkDocs
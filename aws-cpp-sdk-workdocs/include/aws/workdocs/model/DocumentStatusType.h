@@ -34,7 +34,8 @@ namespace DocumentStatusTypeMapper
 {
 AWS_WORKDOCS_API DocumentStatusType GetDocumentStatusTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForDocumentStatusType(DocumentStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForDocumentStatusType(DocumentStatusType value);
 } // namespace DocumentStatusTypeMapper
 } // namespace Model
 } // namespace WorkDocs
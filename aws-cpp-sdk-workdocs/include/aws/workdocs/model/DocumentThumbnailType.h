@@ -35,7 +35,8 @@ namespace DocumentThumbnailTypeMapper
 {
 AWS_WORKDOCS_API DocumentThumbnailType GetDocumentThumbnailTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForDocumentThumbnailType(DocumentThumbnailType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForDocumentThumbnailType(DocumentThumbnailType value);
 } // namespace DocumentThumbnailTypeMapper
 } // namespace Model
 } // namespace WorkDocs
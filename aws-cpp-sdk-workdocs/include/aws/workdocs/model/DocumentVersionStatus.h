@@ -33,7 +33,8 @@ namespace DocumentVersionStatusMapper
 {
 AWS_WORKDOCS_API DocumentVersionStatus GetDocumentVersionStatusForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForDocumentVersionStatus(DocumentVersionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForDocumentVersionStatus(DocumentVersionStatus value);
 } // namespace DocumentVersionStatusMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -35,7 +35,8 @@ namespace FolderContentTypeMapper
 {
 AWS_WORKDOCS_API FolderContentType GetFolderContentTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForFolderContentType(FolderContentType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForFolderContentType(FolderContentType value);
 } // namespace FolderContentTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -43,7 +43,8 @@ namespace LocaleTypeMapper
 {
 AWS_WORKDOCS_API LocaleType GetLocaleTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForLocaleType(LocaleType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForLocaleType(LocaleType value);
 } // namespace LocaleTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,7 +34,8 @@ namespace OrderTypeMapper
 {
 AWS_WORKDOCS_API OrderType GetOrderTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForOrderType(OrderType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForOrderType(OrderType value);
 } // namespace OrderTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -37,7 +37,8 @@ namespace PrincipalTypeMapper
 {
 AWS_WORKDOCS_API PrincipalType GetPrincipalTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForPrincipalType(PrincipalType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForPrincipalType(PrincipalType value);
 } // namespace PrincipalTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,7 +34,8 @@ namespace ResourceSortTypeMapper
 {
 AWS_WORKDOCS_API ResourceSortType GetResourceSortTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForResourceSortType(ResourceSortType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForResourceSortType(ResourceSortType value);
 } // namespace ResourceSortTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -36,7 +36,8 @@ namespace ResourceStateTypeMapper
 {
 AWS_WORKDOCS_API ResourceStateType GetResourceStateTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForResourceStateType(ResourceStateType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForResourceStateType(ResourceStateType value);
 } // namespace ResourceStateTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,7 +34,8 @@ namespace ResourceTypeMapper
 {
 AWS_WORKDOCS_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForResourceType(ResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForResourceType(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace WorkDocs
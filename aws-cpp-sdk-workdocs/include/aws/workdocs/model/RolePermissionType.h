@@ -34,7 +34,8 @@ namespace RolePermissionTypeMapper
 {
 AWS_WORKDOCS_API RolePermissionType GetRolePermissionTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForRolePermissionType(RolePermissionType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForRolePermissionType(RolePermissionType value);
 } // namespace RolePermissionTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -36,7 +36,8 @@ namespace RoleTypeMapper
 {
 AWS_WORKDOCS_API RoleType GetRoleTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForRoleType(RoleType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForRoleType(RoleType value);
 } // namespace RoleTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,7 +34,8 @@ namespace ShareStatusTypeMapper
 {
 AWS_WORKDOCS_API ShareStatusType GetShareStatusTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForShareStatusType(ShareStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForShareStatusType(ShareStatusType value);
 } // namespace ShareStatusTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,7 +34,8 @@ namespace StorageTypeMapper
 {
 AWS_WORKDOCS_API StorageType GetStorageTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForStorageType(StorageType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForStorageType(StorageType value);
 } // namespace StorageTypeMapper
 } // namespace Model
 } // namespace WorkDocs
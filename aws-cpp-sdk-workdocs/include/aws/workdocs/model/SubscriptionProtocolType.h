@@ -33,7 +33,8 @@ namespace SubscriptionProtocolTypeMapper
 {
 AWS_WORKDOCS_API SubscriptionProtocolType GetSubscriptionProtocolTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForSubscriptionProtocolType(SubscriptionProtocolType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForSubscriptionProtocolType(SubscriptionProtocolType value);
 } // namespace SubscriptionProtocolTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -33,7 +33,8 @@ namespace SubscriptionTypeMapper
 {
 AWS_WORKDOCS_API SubscriptionType GetSubscriptionTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForSubscriptionType(SubscriptionType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForSubscriptionType(SubscriptionType value);
 } // namespace SubscriptionTypeMapper
 } // namespace Model
 } // namespace WorkDocs
@@ -34,7 +34,8 @@ namespace UserFilterTypeMapper
 {
 AWS_WORKDOCS_API UserFilterType GetUserFilterTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForUserFilterType(UserFilterType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForUserFilterType(UserFilterType value);
 } // namespace UserFilterTypeMapper
 } // namespace Model
 } // namespace WorkDocs
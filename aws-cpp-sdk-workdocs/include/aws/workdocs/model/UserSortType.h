@@ -37,7 +37,8 @@ namespace UserSortTypeMapper
 {
 AWS_WORKDOCS_API UserSortType GetUserSortTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForUserSortType(UserSortType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForUserSortType(UserSortType value);
 } // namespace UserSortTypeMapper
 } // namespace Model
 } // namespace WorkDocs
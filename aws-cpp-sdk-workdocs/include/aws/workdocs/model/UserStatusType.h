@@ -35,7 +35,8 @@ namespace UserStatusTypeMapper
 {
 AWS_WORKDOCS_API UserStatusType GetUserStatusTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForUserStatusType(UserStatusType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForUserStatusType(UserStatusType value);
 } // namespace UserStatusTypeMapper
 } // namespace Model
 } // namespace WorkDocs
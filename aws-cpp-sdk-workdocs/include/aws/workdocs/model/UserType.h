@@ -37,7 +37,8 @@ namespace UserTypeMapper
 {
 AWS_WORKDOCS_API UserType GetUserTypeForName(const Aws::String& name);
 
-AWS_WORKDOCS_API Aws::String GetNameForUserType(UserType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKDOCS_API const char* GetNameForUserType(UserType value);
 } // namespace UserTypeMapper
 } // namespace Model
 } // namespace WorkDocs
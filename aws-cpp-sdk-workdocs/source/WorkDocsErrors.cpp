@@ -28,27 +28,27 @@ namespace WorkDocs
 namespace WorkDocsErrorMapper
 {
 
-static const int FAILED_DEPENDENCY_HASH = HashingUtils::HashString("FailedDependencyException");
-static const int RESOURCE_ALREADY_CHECKED_OUT_HASH = HashingUtils::HashString("ResourceAlreadyCheckedOutException");
-static const int ENTITY_NOT_EXISTS_HASH = HashingUtils::HashString("EntityNotExistsException");
-static const int CONCURRENT_MODIFICATION_HASH = HashingUtils::HashString("ConcurrentModificationException");
-static const int ENTITY_ALREADY_EXISTS_HASH = HashingUtils::HashString("EntityAlreadyExistsException");
-static const int TOO_MANY_LABELS_HASH = HashingUtils::HashString("TooManyLabelsException");
-static const int STORAGE_LIMIT_WILL_EXCEED_HASH = HashingUtils::HashString("StorageLimitWillExceedException");
-static const int PROHIBITED_STATE_HASH = HashingUtils::HashString("ProhibitedStateException");
-static const int DOCUMENT_LOCKED_FOR_COMMENTS_HASH = HashingUtils::HashString("DocumentLockedForCommentsException");
-static const int ILLEGAL_USER_STATE_HASH = HashingUtils::HashString("IllegalUserStateException");
-static const int INVALID_ARGUMENT_HASH = HashingUtils::HashString("InvalidArgumentException");
-static const int DEACTIVATING_LAST_SYSTEM_USER_HASH = HashingUtils::HashString("DeactivatingLastSystemUserException");
-static const int UNAUTHORIZED_OPERATION_HASH = HashingUtils::HashString("UnauthorizedOperationException");
-static const int TOO_MANY_SUBSCRIPTIONS_HASH = HashingUtils::HashString("TooManySubscriptionsException");
-static const int INVALID_PASSWORD_HASH = HashingUtils::HashString("InvalidPasswordException");
-static const int DRAFT_UPLOAD_OUT_OF_SYNC_HASH = HashingUtils::HashString("DraftUploadOutOfSyncException");
-static const int INVALID_OPERATION_HASH = HashingUtils::HashString("InvalidOperationException");
-static const int UNAUTHORIZED_RESOURCE_ACCESS_HASH = HashingUtils::HashString("UnauthorizedResourceAccessException");
-static const int CUSTOM_METADATA_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("CustomMetadataLimitExceededException");
-static const int LIMIT_EXCEEDED_HASH = HashingUtils::HashString("LimitExceededException");
-static const int STORAGE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("StorageLimitExceededException");
+static constexpr int FAILED_DEPENDENCY_HASH = HashingUtils::CompileTimeHashString("FailedDependencyException");
+static constexpr int RESOURCE_ALREADY_CHECKED_OUT_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyCheckedOutException");
+static constexpr int ENTITY_NOT_EXISTS_HASH = HashingUtils::CompileTimeHashString("EntityNotExistsException");
+static constexpr int CONCURRENT_MODIFICATION_HASH = HashingUtils::CompileTimeHashString("ConcurrentModificationException");
+static constexpr int ENTITY_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("EntityAlreadyExistsException");
+static constexpr int TOO_MANY_LABELS_HASH = HashingUtils::CompileTimeHashString("TooManyLabelsException");
+static constexpr int STORAGE_LIMIT_WILL_EXCEED_HASH = HashingUtils::CompileTimeHashString("StorageLimitWillExceedException");
+static constexpr int PROHIBITED_STATE_HASH = HashingUtils::CompileTimeHashString("ProhibitedStateException");
+static constexpr int DOCUMENT_LOCKED_FOR_COMMENTS_HASH = HashingUtils::CompileTimeHashString("DocumentLockedForCommentsException");
+static constexpr int ILLEGAL_USER_STATE_HASH = HashingUtils::CompileTimeHashString("IllegalUserStateException");
+static constexpr int INVALID_ARGUMENT_HASH = HashingUtils::CompileTimeHashString("InvalidArgumentException");
+static constexpr int DEACTIVATING_LAST_SYSTEM_USER_HASH = HashingUtils::CompileTimeHashString("DeactivatingLastSystemUserException");
+static constexpr int UNAUTHORIZED_OPERATION_HASH = HashingUtils::CompileTimeHashString("UnauthorizedOperationException");
+static constexpr int TOO_MANY_SUBSCRIPTIONS_HASH = HashingUtils::CompileTimeHashString("TooManySubscriptionsException");
+static constexpr int INVALID_PASSWORD_HASH = HashingUtils::CompileTimeHashString("InvalidPasswordException");
+static constexpr int DRAFT_UPLOAD_OUT_OF_SYNC_HASH = HashingUtils::CompileTimeHashString("DraftUploadOutOfSyncException");
+static constexpr int INVALID_OPERATION_HASH = HashingUtils::CompileTimeHashString("InvalidOperationException");
+static constexpr int UNAUTHORIZED_RESOURCE_ACCESS_HASH = HashingUtils::CompileTimeHashString("UnauthorizedResourceAccessException");
+static constexpr int CUSTOM_METADATA_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("CustomMetadataLimitExceededException");
+static constexpr int LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("LimitExceededException");
+static constexpr int STORAGE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("StorageLimitExceededException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
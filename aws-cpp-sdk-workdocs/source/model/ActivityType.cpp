@@ -30,165 +30,233 @@ namespace Aws
       namespace ActivityTypeMapper
       {
 
-        static const int DOCUMENT_CHECKED_IN_HASH = HashingUtils::HashString("DOCUMENT_CHECKED_IN");
-        static const int DOCUMENT_CHECKED_OUT_HASH = HashingUtils::HashString("DOCUMENT_CHECKED_OUT");
-        static const int DOCUMENT_RENAMED_HASH = HashingUtils::HashString("DOCUMENT_RENAMED");
-        static const int DOCUMENT_VERSION_UPLOADED_HASH = HashingUtils::HashString("DOCUMENT_VERSION_UPLOADED");
-        static const int DOCUMENT_VERSION_DELETED_HASH = HashingUtils::HashString("DOCUMENT_VERSION_DELETED");
-        static const int DOCUMENT_RECYCLED_HASH = HashingUtils::HashString("DOCUMENT_RECYCLED");
-        static const int DOCUMENT_RESTORED_HASH = HashingUtils::HashString("DOCUMENT_RESTORED");
-        static const int DOCUMENT_REVERTED_HASH = HashingUtils::HashString("DOCUMENT_REVERTED");
-        static const int DOCUMENT_SHARED_HASH = HashingUtils::HashString("DOCUMENT_SHARED");
-        static const int DOCUMENT_UNSHARED_HASH = HashingUtils::HashString("DOCUMENT_UNSHARED");
-        static const int DOCUMENT_SHARE_PERMISSION_CHANGED_HASH = HashingUtils::HashString("DOCUMENT_SHARE_PERMISSION_CHANGED");
-        static const int DOCUMENT_SHAREABLE_LINK_CREATED_HASH = HashingUtils::HashString("DOCUMENT_SHAREABLE_LINK_CREATED");
-        static const int DOCUMENT_SHAREABLE_LINK_REMOVED_HASH = HashingUtils::HashString("DOCUMENT_SHAREABLE_LINK_REMOVED");
-        static const int DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED_HASH = HashingUtils::HashString("DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED");
-        static const int DOCUMENT_MOVED_HASH = HashingUtils::HashString("DOCUMENT_MOVED");
-        static const int DOCUMENT_COMMENT_ADDED_HASH = HashingUtils::HashString("DOCUMENT_COMMENT_ADDED");
-        static const int DOCUMENT_COMMENT_DELETED_HASH = HashingUtils::HashString("DOCUMENT_COMMENT_DELETED");
-        static const int DOCUMENT_ANNOTATION_ADDED_HASH = HashingUtils::HashString("DOCUMENT_ANNOTATION_ADDED");
-        static const int DOCUMENT_ANNOTATION_DELETED_HASH = HashingUtils::HashString("DOCUMENT_ANNOTATION_DELETED");
-        static const int FOLDER_CREATED_HASH = HashingUtils::HashString("FOLDER_CREATED");
-        static const int FOLDER_DELETED_HASH = HashingUtils::HashString("FOLDER_DELETED");
-        static const int FOLDER_RENAMED_HASH = HashingUtils::HashString("FOLDER_RENAMED");
-        static const int FOLDER_RECYCLED_HASH = HashingUtils::HashString("FOLDER_RECYCLED");
-        static const int FOLDER_RESTORED_HASH = HashingUtils::HashString("FOLDER_RESTORED");
-        static const int FOLDER_SHARED_HASH = HashingUtils::HashString("FOLDER_SHARED");
-        static const int FOLDER_UNSHARED_HASH = HashingUtils::HashString("FOLDER_UNSHARED");
-        static const int FOLDER_SHARE_PERMISSION_CHANGED_HASH = HashingUtils::HashString("FOLDER_SHARE_PERMISSION_CHANGED");
-        static const int FOLDER_SHAREABLE_LINK_CREATED_HASH = HashingUtils::HashString("FOLDER_SHAREABLE_LINK_CREATED");
-        static const int FOLDER_SHAREABLE_LINK_REMOVED_HASH = HashingUtils::HashString("FOLDER_SHAREABLE_LINK_REMOVED");
-        static const int FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED_HASH = HashingUtils::HashString("FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED");
-        static const int FOLDER_MOVED_HASH = HashingUtils::HashString("FOLDER_MOVED");
+        static constexpr int DOCUMENT_CHECKED_IN_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_CHECKED_IN");
+        static constexpr int DOCUMENT_CHECKED_OUT_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_CHECKED_OUT");
+        static constexpr int DOCUMENT_RENAMED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_RENAMED");
+        static constexpr int DOCUMENT_VERSION_UPLOADED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_VERSION_UPLOADED");
+        static constexpr int DOCUMENT_VERSION_DELETED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_VERSION_DELETED");
+        static constexpr int DOCUMENT_RECYCLED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_RECYCLED");
+        static constexpr int DOCUMENT_RESTORED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_RESTORED");
+        static constexpr int DOCUMENT_REVERTED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_REVERTED");
+        static constexpr int DOCUMENT_SHARED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_SHARED");
+        static constexpr int DOCUMENT_UNSHARED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_UNSHARED");
+        static constexpr int DOCUMENT_SHARE_PERMISSION_CHANGED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_SHARE_PERMISSION_CHANGED");
+        static constexpr int DOCUMENT_SHAREABLE_LINK_CREATED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_SHAREABLE_LINK_CREATED");
+        static constexpr int DOCUMENT_SHAREABLE_LINK_REMOVED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_SHAREABLE_LINK_REMOVED");
+        static constexpr int DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED");
+        static constexpr int DOCUMENT_MOVED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_MOVED");
+        static constexpr int DOCUMENT_COMMENT_ADDED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_COMMENT_ADDED");
+        static constexpr int DOCUMENT_COMMENT_DELETED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_COMMENT_DELETED");
+        static constexpr int DOCUMENT_ANNOTATION_ADDED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_ANNOTATION_ADDED");
+        static constexpr int DOCUMENT_ANNOTATION_DELETED_HASH = HashingUtils::CompileTimeHashString("DOCUMENT_ANNOTATION_DELETED");
+        static constexpr int FOLDER_CREATED_HASH = HashingUtils::CompileTimeHashString("FOLDER_CREATED");
+        static constexpr int FOLDER_DELETED_HASH = HashingUtils::CompileTimeHashString("FOLDER_DELETED");
+        static constexpr int FOLDER_RENAMED_HASH = HashingUtils::CompileTimeHashString("FOLDER_RENAMED");
+        static constexpr int FOLDER_RECYCLED_HASH = HashingUtils::CompileTimeHashString("FOLDER_RECYCLED");
+        static constexpr int FOLDER_RESTORED_HASH = HashingUtils::CompileTimeHashString("FOLDER_RESTORED");
+        static constexpr int FOLDER_SHARED_HASH = HashingUtils::CompileTimeHashString("FOLDER_SHARED");
+        static constexpr int FOLDER_UNSHARED_HASH = HashingUtils::CompileTimeHashString("FOLDER_UNSHARED");
+        static constexpr int FOLDER_SHARE_PERMISSION_CHANGED_HASH = HashingUtils::CompileTimeHashString("FOLDER_SHARE_PERMISSION_CHANGED");
+        static constexpr int FOLDER_SHAREABLE_LINK_CREATED_HASH = HashingUtils::CompileTimeHashString("FOLDER_SHAREABLE_LINK_CREATED");
+        static constexpr int FOLDER_SHAREABLE_LINK_REMOVED_HASH = HashingUtils::CompileTimeHashString("FOLDER_SHAREABLE_LINK_REMOVED");
+        static constexpr int FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED_HASH = HashingUtils::CompileTimeHashString("FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED");
+        static constexpr int FOLDER_MOVED_HASH = HashingUtils::CompileTimeHashString("FOLDER_MOVED");
 
 
         ActivityType GetActivityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DOCUMENT_CHECKED_IN_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ActivityType::DOCUMENT_CHECKED_IN;
-          }
-          else if (hashCode == DOCUMENT_CHECKED_OUT_HASH)
-          {
-            return ActivityType::DOCUMENT_CHECKED_OUT;
-          }
-          else if (hashCode == DOCUMENT_RENAMED_HASH)
-          {
-            return ActivityType::DOCUMENT_RENAMED;
-          }
-          else if (hashCode == DOCUMENT_VERSION_UPLOADED_HASH)
-          {
-            return ActivityType::DOCUMENT_VERSION_UPLOADED;
-          }
-          else if (hashCode == DOCUMENT_VERSION_DELETED_HASH)
-          {
-            return ActivityType::DOCUMENT_VERSION_DELETED;
-          }
-          else if (hashCode == DOCUMENT_RECYCLED_HASH)
-          {
-            return ActivityType::DOCUMENT_RECYCLED;
-          }
-          else if (hashCode == DOCUMENT_RESTORED_HASH)
-          {
-            return ActivityType::DOCUMENT_RESTORED;
-          }
-          else if (hashCode == DOCUMENT_REVERTED_HASH)
-          {
-            return ActivityType::DOCUMENT_REVERTED;
-          }
-          else if (hashCode == DOCUMENT_SHARED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHARED;
-          }
-          else if (hashCode == DOCUMENT_UNSHARED_HASH)
-          {
-            return ActivityType::DOCUMENT_UNSHARED;
-          }
-          else if (hashCode == DOCUMENT_SHARE_PERMISSION_CHANGED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHARE_PERMISSION_CHANGED;
-          }
-          else if (hashCode == DOCUMENT_SHAREABLE_LINK_CREATED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHAREABLE_LINK_CREATED;
-          }
-          else if (hashCode == DOCUMENT_SHAREABLE_LINK_REMOVED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHAREABLE_LINK_REMOVED;
-          }
-          else if (hashCode == DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED_HASH)
-          {
-            return ActivityType::DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED;
-          }
-          else if (hashCode == DOCUMENT_MOVED_HASH)
-          {
-            return ActivityType::DOCUMENT_MOVED;
-          }
-          else if (hashCode == DOCUMENT_COMMENT_ADDED_HASH)
-          {
-            return ActivityType::DOCUMENT_COMMENT_ADDED;
-          }
-          else if (hashCode == DOCUMENT_COMMENT_DELETED_HASH)
-          {
-            return ActivityType::DOCUMENT_COMMENT_DELETED;
-          }
-          else if (hashCode == DOCUMENT_ANNOTATION_ADDED_HASH)
-          {
-            return ActivityType::DOCUMENT_ANNOTATION_ADDED;
-          }
-          else if (hashCode == DOCUMENT_ANNOTATION_DELETED_HASH)
-          {
-            return ActivityType::DOCUMENT_ANNOTATION_DELETED;
-          }
-          else if (hashCode == FOLDER_CREATED_HASH)
-          {
-            return ActivityType::FOLDER_CREATED;
-          }
-          else if (hashCode == FOLDER_DELETED_HASH)
-          {
-            return ActivityType::FOLDER_DELETED;
-          }
-          else if (hashCode == FOLDER_RENAMED_HASH)
-          {
-            return ActivityType::FOLDER_RENAMED;
-          }
-          else if (hashCode == FOLDER_RECYCLED_HASH)
-          {
-            return ActivityType::FOLDER_RECYCLED;
-          }
-          else if (hashCode == FOLDER_RESTORED_HASH)
-          {
-            return ActivityType::FOLDER_RESTORED;
-          }
-          else if (hashCode == FOLDER_SHARED_HASH)
-          {
-            return ActivityType::FOLDER_SHARED;
-          }
-          else if (hashCode == FOLDER_UNSHARED_HASH)
-          {
-            return ActivityType::FOLDER_UNSHARED;
-          }
-          else if (hashCode == FOLDER_SHARE_PERMISSION_CHANGED_HASH)
-          {
-            return ActivityType::FOLDER_SHARE_PERMISSION_CHANGED;
-          }
-          else if (hashCode == FOLDER_SHAREABLE_LINK_CREATED_HASH)
-          {
-            return ActivityType::FOLDER_SHAREABLE_LINK_CREATED;
-          }
-          else if (hashCode == FOLDER_SHAREABLE_LINK_REMOVED_HASH)
-          {
-            return ActivityType::FOLDER_SHAREABLE_LINK_REMOVED;
-          }
-          else if (hashCode == FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED_HASH)
-          {
-            return ActivityType::FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED;
-          }
-          else if (hashCode == FOLDER_MOVED_HASH)
-          {
-            return ActivityType::FOLDER_MOVED;
+          case DOCUMENT_CHECKED_IN_HASH:
+            if (name == "DOCUMENT_CHECKED_IN")
+            {
+              return ActivityType::DOCUMENT_CHECKED_IN;
+            }
+            break;
+          case DOCUMENT_CHECKED_OUT_HASH:
+            if (name == "DOCUMENT_CHECKED_OUT")
+            {
+              return ActivityType::DOCUMENT_CHECKED_OUT;
+            }
+            break;
+          case DOCUMENT_RENAMED_HASH:
+            if (name == "DOCUMENT_RENAMED")
+            {
+              return ActivityType::DOCUMENT_RENAMED;
+            }
+            break;
+          case DOCUMENT_VERSION_UPLOADED_HASH:
+            if (name == "DOCUMENT_VERSION_UPLOADED")
+            {
+              return ActivityType::DOCUMENT_VERSION_UPLOADED;
+            }
+            break;
+          case DOCUMENT_VERSION_DELETED_HASH:
+            if (name == "DOCUMENT_VERSION_DELETED")
+            {
+              return ActivityType::DOCUMENT_VERSION_DELETED;
+            }
+            break;
+          case DOCUMENT_RECYCLED_HASH:
+            if (name == "DOCUMENT_RECYCLED")
+            {
+              return ActivityType::DOCUMENT_RECYCLED;
+            }
+            break;
+          case DOCUMENT_RESTORED_HASH:
+            if (name == "DOCUMENT_RESTORED")
+            {
+              return ActivityType::DOCUMENT_RESTORED;
+            }
+            break;
+          case DOCUMENT_REVERTED_HASH:
+            if (name == "DOCUMENT_REVERTED")
+            {
+              return ActivityType::DOCUMENT_REVERTED;
+            }
+            break;
+          case DOCUMENT_SHARED_HASH:
+            if (name == "DOCUMENT_SHARED")
+            {
+              return ActivityType::DOCUMENT_SHARED;
+            }
+            break;
+          case DOCUMENT_UNSHARED_HASH:
+            if (name == "DOCUMENT_UNSHARED")
+            {
+              return ActivityType::DOCUMENT_UNSHARED;
+            }
+            break;
+          case DOCUMENT_SHARE_PERMISSION_CHANGED_HASH:
+            if (name == "DOCUMENT_SHARE_PERMISSION_CHANGED")
+            {
+              return ActivityType::DOCUMENT_SHARE_PERMISSION_CHANGED;
+            }
+            break;
+          case DOCUMENT_SHAREABLE_LINK_CREATED_HASH:
+            if (name == "DOCUMENT_SHAREABLE_LINK_CREATED")
+            {
+              return ActivityType::DOCUMENT_SHAREABLE_LINK_CREATED;
+            }
+            break;
+          case DOCUMENT_SHAREABLE_LINK_REMOVED_HASH:
+            if (name == "DOCUMENT_SHAREABLE_LINK_REMOVED")
+            {
+              return ActivityType::DOCUMENT_SHAREABLE_LINK_REMOVED;
+            }
+            break;
+          case DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED_HASH:
+            if (name == "DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED")
+            {
+              return ActivityType::DOCUMENT_SHAREABLE_LINK_PERMISSION_CHANGED;
+            }
+            break;
+          case DOCUMENT_MOVED_HASH:
+            if (name == "DOCUMENT_MOVED")
+            {
+              return ActivityType::DOCUMENT_MOVED;
+            }
+            break;
+          case DOCUMENT_COMMENT_ADDED_HASH:
+            if (name == "DOCUMENT_COMMENT_ADDED")
+            {
+              return ActivityType::DOCUMENT_COMMENT_ADDED;
+            }
+            break;
+          case DOCUMENT_COMMENT_DELETED_HASH:
+            if (name == "DOCUMENT_COMMENT_DELETED")
+            {
+              return ActivityType::DOCUMENT_COMMENT_DELETED;
+            }
+            break;
+          case DOCUMENT_ANNOTATION_ADDED_HASH:
+            if (name == "DOCUMENT_ANNOTATION_ADDED")
+            {
+              return ActivityType::DOCUMENT_ANNOTATION_ADDED;
+            }
+            break;
+          case DOCUMENT_ANNOTATION_DELETED_HASH:
+            if (name == "DOCUMENT_ANNOTATION_DELETED")
+            {
+              return ActivityType::DOCUMENT_ANNOTATION_DELETED;
+            }
+            break;
+          case FOLDER_CREATED_HASH:
+            if (name == "FOLDER_CREATED")
+            {
+              return ActivityType::FOLDER_CREATED;
+            }
+            break;
+          case FOLDER_DELETED_HASH:
+            if (name == "FOLDER_DELETED")
+            {
+              return ActivityType::FOLDER_DELETED;
+            }
+            break;
+          case FOLDER_RENAMED_HASH:
+            if (name == "FOLDER_RENAMED")
+            {
+              return ActivityType::FOLDER_RENAMED;
+            }
+            break;
+          case FOLDER_RECYCLED_HASH:
+            if (name == "FOLDER_RECYCLED")
+            {
+              return ActivityType::FOLDER_RECYCLED;
+            }
+            break;
+          case FOLDER_RESTORED_HASH:
+            if (name == "FOLDER_RESTORED")
+            {
+              return ActivityType::FOLDER_RESTORED;
+            }
+            break;
+          case FOLDER_SHARED_HASH:
+            if (name == "FOLDER_SHARED")
+            {
+              return ActivityType::FOLDER_SHARED;
+            }
+            break;
+          case FOLDER_UNSHARED_HASH:
+            if (name == "FOLDER_UNSHARED")
+            {
+              return ActivityType::FOLDER_UNSHARED;
+            }
+            break;
+          case FOLDER_SHARE_PERMISSION_CHANGED_HASH:
+            if (name == "FOLDER_SHARE_PERMISSION_CHANGED")
+            {
+              return ActivityType::FOLDER_SHARE_PERMISSION_CHANGED;
+            }
+            break;
+          case FOLDER_SHAREABLE_LINK_CREATED_HASH:
+            if (name == "FOLDER_SHAREABLE_LINK_CREATED")
+            {
+              return ActivityType::FOLDER_SHAREABLE_LINK_CREATED;
+            }
+            break;
+          case FOLDER_SHAREABLE_LINK_REMOVED_HASH:
+            if (name == "FOLDER_SHAREABLE_LINK_REMOVED")
+            {
+              return ActivityType::FOLDER_SHAREABLE_LINK_REMOVED;
+            }
+            break;
+          case FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED_HASH:
+            if (name == "FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED")
+            {
+              return ActivityType::FOLDER_SHAREABLE_LINK_PERMISSION_CHANGED;
+            }
+            break;
+          case FOLDER_MOVED_HASH:
+            if (name == "FOLDER_MOVED")
+            {
+              return ActivityType::FOLDER_MOVED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -200,7 +268,7 @@ namespace Aws
           return ActivityType::NOT_SET;
         }
 
-        Aws::String GetNameForActivityType(ActivityType enumValue)
+        const char* GetNameForActivityType(ActivityType enumValue)
         {
           switch(enumValue)
           {
@@ -270,7 +338,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace BooleanEnumTypeMapper
       {
 
-        static const int TRUE_HASH = HashingUtils::HashString("TRUE");
-        static const int FALSE_HASH = HashingUtils::HashString("FALSE");
+        static constexpr int TRUE_HASH = HashingUtils::CompileTimeHashString("TRUE");
+        static constexpr int FALSE_HASH = HashingUtils::CompileTimeHashString("FALSE");
 
 
         BooleanEnumType GetBooleanEnumTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == TRUE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return BooleanEnumType::TRUE;
-          }
-          else if (hashCode == FALSE_HASH)
-          {
-            return BooleanEnumType::FALSE;
+          case TRUE_HASH:
+            if (name == "TRUE")
+            {
+              return BooleanEnumType::TRUE;
+            }
+            break;
+          case FALSE_HASH:
+            if (name == "FALSE")
+            {
+              return BooleanEnumType::FALSE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return BooleanEnumType::NOT_SET;
         }
 
-        Aws::String GetNameForBooleanEnumType(BooleanEnumType enumValue)
+        const char* GetNameForBooleanEnumType(BooleanEnumType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
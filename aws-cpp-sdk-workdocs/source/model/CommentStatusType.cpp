@@ -30,25 +30,37 @@ namespace Aws
       namespace CommentStatusTypeMapper
       {
 
-        static const int DRAFT_HASH = HashingUtils::HashString("DRAFT");
-        static const int PUBLISHED_HASH = HashingUtils::HashString("PUBLISHED");
-        static const int DELETED_HASH = HashingUtils::HashString("DELETED");
+        static constexpr int DRAFT_HASH = HashingUtils::CompileTimeHashString("DRAFT");
+        static constexpr int PUBLISHED_HASH = HashingUtils::CompileTimeHashString("PUBLISHED");
+        static constexpr int DELETED_HASH = HashingUtils::CompileTimeHashString("DELETED");
 
 
         CommentStatusType GetCommentStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DRAFT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CommentStatusType::DRAFT;
-          }
-          else if (hashCode == PUBLISHED_HASH)
-          {
-            return CommentStatusType::PUBLISHED;
-          }
-          else if (hashCode == DELETED_HASH)
-          {
-            return CommentStatusType::DELETED;
+          case DRAFT_HASH:
+            if (name == "DRAFT")
+            {
+              return CommentStatusType::DRAFT;
+            }
+            break;
+          case PUBLISHED_HASH:
+            if (name == "PUBLISHED")
+            {
+              return CommentStatusType::PUBLISHED;
+            }
+            break;
+          case DELETED_HASH:
+            if (name == "DELETED")
+            {
+              return CommentStatusType::DELETED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return CommentStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForCommentStatusType(CommentStatusType enumValue)
+        const char* GetNameForCommentStatusType(CommentStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace CommentVisibilityTypeMapper
       {
 
-        static const int PUBLIC__HASH = HashingUtils::HashString("PUBLIC");
-        static const int PRIVATE__HASH = HashingUtils::HashString("PRIVATE");
+        static constexpr int PUBLIC__HASH = HashingUtils::CompileTimeHashString("PUBLIC");
+        static constexpr int PRIVATE__HASH = HashingUtils::CompileTimeHashString("PRIVATE");
 
 
         CommentVisibilityType GetCommentVisibilityTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PUBLIC__HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return CommentVisibilityType::PUBLIC_;
-          }
-          else if (hashCode == PRIVATE__HASH)
-          {
-            return CommentVisibilityType::PRIVATE_;
+          case PUBLIC__HASH:
+            if (name == "PUBLIC")
+            {
+              return CommentVisibilityType::PUBLIC_;
+            }
+            break;
+          case PRIVATE__HASH:
+            if (name == "PRIVATE")
+            {
+              return CommentVisibilityType::PRIVATE_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return CommentVisibilityType::NOT_SET;
         }
 
-        Aws::String GetNameForCommentVisibilityType(CommentVisibilityType enumValue)
+        const char* GetNameForCommentVisibilityType(CommentVisibilityType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace DocumentSourceTypeMapper
       {
 
-        static const int ORIGINAL_HASH = HashingUtils::HashString("ORIGINAL");
-        static const int WITH_COMMENTS_HASH = HashingUtils::HashString("WITH_COMMENTS");
+        static constexpr int ORIGINAL_HASH = HashingUtils::CompileTimeHashString("ORIGINAL");
+        static constexpr int WITH_COMMENTS_HASH = HashingUtils::CompileTimeHashString("WITH_COMMENTS");
 
 
         DocumentSourceType GetDocumentSourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ORIGINAL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentSourceType::ORIGINAL;
-          }
-          else if (hashCode == WITH_COMMENTS_HASH)
-          {
-            return DocumentSourceType::WITH_COMMENTS;
+          case ORIGINAL_HASH:
+            if (name == "ORIGINAL")
+            {
+              return DocumentSourceType::ORIGINAL;
+            }
+            break;
+          case WITH_COMMENTS_HASH:
+            if (name == "WITH_COMMENTS")
+            {
+              return DocumentSourceType::WITH_COMMENTS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DocumentSourceType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentSourceType(DocumentSourceType enumValue)
+        const char* GetNameForDocumentSourceType(DocumentSourceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
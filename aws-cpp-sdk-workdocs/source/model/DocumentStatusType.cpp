@@ -30,20 +30,30 @@ namespace Aws
       namespace DocumentStatusTypeMapper
       {
 
-        static const int INITIALIZED_HASH = HashingUtils::HashString("INITIALIZED");
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
+        static constexpr int INITIALIZED_HASH = HashingUtils::CompileTimeHashString("INITIALIZED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
 
 
         DocumentStatusType GetDocumentStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == INITIALIZED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentStatusType::INITIALIZED;
-          }
-          else if (hashCode == ACTIVE_HASH)
-          {
-            return DocumentStatusType::ACTIVE;
+          case INITIALIZED_HASH:
+            if (name == "INITIALIZED")
+            {
+              return DocumentStatusType::INITIALIZED;
+            }
+            break;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return DocumentStatusType::ACTIVE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return DocumentStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentStatusType(DocumentStatusType enumValue)
+        const char* GetNameForDocumentStatusType(DocumentStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
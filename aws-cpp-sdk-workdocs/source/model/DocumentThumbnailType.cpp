@@ -30,25 +30,37 @@ namespace Aws
       namespace DocumentThumbnailTypeMapper
       {
 
-        static const int SMALL_HASH = HashingUtils::HashString("SMALL");
-        static const int SMALL_HQ_HASH = HashingUtils::HashString("SMALL_HQ");
-        static const int LARGE_HASH = HashingUtils::HashString("LARGE");
+        static constexpr int SMALL_HASH = HashingUtils::CompileTimeHashString("SMALL");
+        static constexpr int SMALL_HQ_HASH = HashingUtils::CompileTimeHashString("SMALL_HQ");
+        static constexpr int LARGE_HASH = HashingUtils::CompileTimeHashString("LARGE");
 
 
         DocumentThumbnailType GetDocumentThumbnailTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SMALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return DocumentThumbnailType::SMALL;
-          }
-          else if (hashCode == SMALL_HQ_HASH)
-          {
-            return DocumentThumbnailType::SMALL_HQ;
-          }
-          else if (hashCode == LARGE_HASH)
-          {
-            return DocumentThumbnailType::LARGE;
+          case SMALL_HASH:
+            if (name == "SMALL")
+            {
+              return DocumentThumbnailType::SMALL;
+            }
+            break;
+          case SMALL_HQ_HASH:
+            if (name == "SMALL_HQ")
+            {
+              return DocumentThumbnailType::SMALL_HQ;
+            }
+            break;
+          case LARGE_HASH:
+            if (name == "LARGE")
+            {
+              return DocumentThumbnailType::LARGE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return DocumentThumbnailType::NOT_SET;
         }
 
-        Aws::String GetNameForDocumentThumbnailType(DocumentThumbnailType enumValue)
+        const char* GetNameForDocumentThumbnailType(DocumentThumbnailType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
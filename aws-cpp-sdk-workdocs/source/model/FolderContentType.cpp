@@ -30,25 +30,37 @@ namespace Aws
       namespace FolderContentTypeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int DOCUMENT_HASH = HashingUtils::HashString("DOCUMENT");
-        static const int FOLDER_HASH = HashingUtils::HashString("FOLDER");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
+        static constexpr int DOCUMENT_HASH = HashingUtils::CompileTimeHashString("DOCUMENT");
+        static constexpr int FOLDER_HASH = HashingUtils::CompileTimeHashString("FOLDER");
 
 
         FolderContentType GetFolderContentTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return FolderContentType::ALL;
-          }
-          else if (hashCode == DOCUMENT_HASH)
-          {
-            return FolderContentType::DOCUMENT;
-          }
-          else if (hashCode == FOLDER_HASH)
-          {
-            return FolderContentType::FOLDER;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return FolderContentType::ALL;
+            }
+            break;
+          case DOCUMENT_HASH:
+            if (name == "DOCUMENT")
+            {
+              return FolderContentType::DOCUMENT;
+            }
+            break;
+          case FOLDER_HASH:
+            if (name == "FOLDER")
+            {
+              return FolderContentType::FOLDER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return FolderContentType::NOT_SET;
         }
 
-        Aws::String GetNameForFolderContentType(FolderContentType enumValue)
+        const char* GetNameForFolderContentType(FolderContentType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
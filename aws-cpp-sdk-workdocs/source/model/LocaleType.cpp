@@ -30,65 +30,93 @@ namespace Aws
       namespace LocaleTypeMapper
       {
 
-        static const int en_HASH = HashingUtils::HashString("en");
-        static const int fr_HASH = HashingUtils::HashString("fr");
-        static const int ko_HASH = HashingUtils::HashString("ko");
-        static const int de_HASH = HashingUtils::HashString("de");
-        static const int es_HASH = HashingUtils::HashString("es");
-        static const int ja_HASH = HashingUtils::HashString("ja");
-        static const int ru_HASH = HashingUtils::HashString("ru");
-        static const int zh_CN_HASH = HashingUtils::HashString("zh_CN");
-        static const int zh_TW_HASH = HashingUtils::HashString("zh_TW");
-        static const int pt_BR_HASH = HashingUtils::HashString("pt_BR");
-        static const int default__HASH = HashingUtils::HashString("default");
+        static constexpr int en_HASH = HashingUtils::CompileTimeHashString("en");
+        static constexpr int fr_HASH = HashingUtils::CompileTimeHashString("fr");
+        static constexpr int ko_HASH = HashingUtils::CompileTimeHashString("ko");
+        static constexpr int de_HASH = HashingUtils::CompileTimeHashString("de");
+        static constexpr int es_HASH = HashingUtils::CompileTimeHashString("es");
+        static constexpr int ja_HASH = HashingUtils::CompileTimeHashString("ja");
+        static constexpr int ru_HASH = HashingUtils::CompileTimeHashString("ru");
+        static constexpr int zh_CN_HASH = HashingUtils::CompileTimeHashString("zh_CN");
+        static constexpr int zh_TW_HASH = HashingUtils::CompileTimeHashString("zh_TW");
+        static constexpr int pt_BR_HASH = HashingUtils::CompileTimeHashString("pt_BR");
+        static constexpr int default__HASH = HashingUtils::CompileTimeHashString("default");
 
 
         LocaleType GetLocaleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == en_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return LocaleType::en;
-          }
-          else if (hashCode == fr_HASH)
-          {
-            return LocaleType::fr;
-          }
-          else if (hashCode == ko_HASH)
-          {
-            return LocaleType::ko;
-          }
-          else if (hashCode == de_HASH)
-          {
-            return LocaleType::de;
-          }
-          else if (hashCode == es_HASH)
-          {
-            return LocaleType::es;
-          }
-          else if (hashCode == ja_HASH)
-          {
-            return LocaleType::ja;
-          }
-          else if (hashCode == ru_HASH)
-          {
-            return LocaleType::ru;
-          }
-          else if (hashCode == zh_CN_HASH)
-          {
-            return LocaleType::zh_CN;
-          }
-          else if (hashCode == zh_TW_HASH)
-          {
-            return LocaleType::zh_TW;
-          }
-          else if (hashCode == pt_BR_HASH)
-          {
-            return LocaleType::pt_BR;
-          }
-          else if (hashCode == default__HASH)
-          {
-            return LocaleType::default_;
+          case en_HASH:
+            if (name == "en")
+            {
+              return LocaleType::en;
+            }
+            break;
+          case fr_HASH:
+            if (name == "fr")
+            {
+              return LocaleType::fr;
+            }
+            break;
+          case ko_HASH:
+            if (name == "ko")
+            {
+              return LocaleType::ko;
+            }
+            break;
+          case de_HASH:
+            if (name == "de")
+            {
+              return LocaleType::de;
+            }
+            break;
+          case es_HASH:
+            if (name == "es")
+            {
+              return LocaleType::es;
+            }
+            break;
+          case ja_HASH:
+            if (name == "ja")
+            {
+              return LocaleType::ja;
+            }
+            break;
+          case ru_HASH:
+            if (name == "ru")
+            {
+              return LocaleType::ru;
+            }
+            break;
+          case zh_CN_HASH:
+            if (name == "zh_CN")
+            {
+              return LocaleType::zh_CN;
+            }
+            break;
+          case zh_TW_HASH:
+            if (name == "zh_TW")
+            {
+              return LocaleType::zh_TW;
+            }
+            break;
+          case pt_BR_HASH:
+            if (name == "pt_BR")
+            {
+              return LocaleType::pt_BR;
+            }
+            break;
+          case default__HASH:
+            if (name == "default")
+            {
+              return LocaleType::default_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -100,7 +128,7 @@ namespace Aws
           return LocaleType::NOT_SET;
         }
 
-        Aws::String GetNameForLocaleType(LocaleType enumValue)
+        const char* GetNameForLocaleType(LocaleType enumValue)
         {
           switch(enumValue)
           {
@@ -130,7 +158,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
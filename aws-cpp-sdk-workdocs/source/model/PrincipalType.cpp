@@ -30,35 +30,51 @@ namespace Aws
       namespace PrincipalTypeMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int GROUP_HASH = HashingUtils::HashString("GROUP");
-        static const int INVITE_HASH = HashingUtils::HashString("INVITE");
-        static const int ANONYMOUS_HASH = HashingUtils::HashString("ANONYMOUS");
-        static const int ORGANIZATION_HASH = HashingUtils::HashString("ORGANIZATION");
+        static constexpr int USER_HASH = HashingUtils::CompileTimeHashString("USER");
+        static constexpr int GROUP_HASH = HashingUtils::CompileTimeHashString("GROUP");
+        static constexpr int INVITE_HASH = HashingUtils::CompileTimeHashString("INVITE");
+        static constexpr int ANONYMOUS_HASH = HashingUtils::CompileTimeHashString("ANONYMOUS");
+        static constexpr int ORGANIZATION_HASH = HashingUtils::CompileTimeHashString("ORGANIZATION");
 
 
         PrincipalType GetPrincipalTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PrincipalType::USER;
-          }
-          else if (hashCode == GROUP_HASH)
-          {
-            return PrincipalType::GROUP;
-          }
-          else if (hashCode == INVITE_HASH)
-          {
-            return PrincipalType::INVITE;
-          }
-          else if (hashCode == ANONYMOUS_HASH)
-          {
-            return PrincipalType::ANONYMOUS;
-          }
-          else if (hashCode == ORGANIZATION_HASH)
-          {
-            return PrincipalType::ORGANIZATION;
+          case USER_HASH:
+            if (name == "USER")
+            {
+              return PrincipalType::USER;
+            }
+            break;
+          case GROUP_HASH:
+            if (name == "GROUP")
+            {
+              return PrincipalType::GROUP;
+            }
+            break;
+          case INVITE_HASH:
+            if (name == "INVITE")
+            {
+              return PrincipalType::INVITE;
+            }
+            break;
+          case ANONYMOUS_HASH:
+            if (name == "ANONYMOUS")
+            {
+              return PrincipalType::ANONYMOUS;
+            }
+            break;
+          case ORGANIZATION_HASH:
+            if (name == "ORGANIZATION")
+            {
+              return PrincipalType::ORGANIZATION;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return PrincipalType::NOT_SET;
         }
 
-        Aws::String GetNameForPrincipalType(PrincipalType enumValue)
+        const char* GetNameForPrincipalType(PrincipalType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
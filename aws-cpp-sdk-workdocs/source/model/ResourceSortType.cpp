@@ -30,20 +30,30 @@ namespace Aws
       namespace ResourceSortTypeMapper
       {
 
-        static const int DATE_HASH = HashingUtils::HashString("DATE");
-        static const int NAME_HASH = HashingUtils::HashString("NAME");
+        static constexpr int DATE_HASH = HashingUtils::CompileTimeHashString("DATE");
+        static constexpr int NAME_HASH = HashingUtils::CompileTimeHashString("NAME");
 
 
         ResourceSortType GetResourceSortTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DATE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceSortType::DATE;
-          }
-          else if (hashCode == NAME_HASH)
-          {
-            return ResourceSortType::NAME;
+          case DATE_HASH:
+            if (name == "DATE")
+            {
+              return ResourceSortType::DATE;
+            }
+            break;
+          case NAME_HASH:
+            if (name == "NAME")
+            {
+              return ResourceSortType::NAME;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ResourceSortType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceSortType(ResourceSortType enumValue)
+        const char* GetNameForResourceSortType(ResourceSortType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
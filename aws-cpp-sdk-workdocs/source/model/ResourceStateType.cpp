@@ -30,30 +30,44 @@ namespace Aws
       namespace ResourceStateTypeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int RESTORING_HASH = HashingUtils::HashString("RESTORING");
-        static const int RECYCLING_HASH = HashingUtils::HashString("RECYCLING");
-        static const int RECYCLED_HASH = HashingUtils::HashString("RECYCLED");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int RESTORING_HASH = HashingUtils::CompileTimeHashString("RESTORING");
+        static constexpr int RECYCLING_HASH = HashingUtils::CompileTimeHashString("RECYCLING");
+        static constexpr int RECYCLED_HASH = HashingUtils::CompileTimeHashString("RECYCLED");
 
 
         ResourceStateType GetResourceStateTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceStateType::ACTIVE;
-          }
-          else if (hashCode == RESTORING_HASH)
-          {
-            return ResourceStateType::RESTORING;
-          }
-          else if (hashCode == RECYCLING_HASH)
-          {
-            return ResourceStateType::RECYCLING;
-          }
-          else if (hashCode == RECYCLED_HASH)
-          {
-            return ResourceStateType::RECYCLED;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return ResourceStateType::ACTIVE;
+            }
+            break;
+          case RESTORING_HASH:
+            if (name == "RESTORING")
+            {
+              return ResourceStateType::RESTORING;
+            }
+            break;
+          case RECYCLING_HASH:
+            if (name == "RECYCLING")
+            {
+              return ResourceStateType::RECYCLING;
+            }
+            break;
+          case RECYCLED_HASH:
+            if (name == "RECYCLED")
+            {
+              return ResourceStateType::RECYCLED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return ResourceStateType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceStateType(ResourceStateType enumValue)
+        const char* GetNameForResourceStateType(ResourceStateType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
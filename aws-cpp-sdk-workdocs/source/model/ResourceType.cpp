@@ -30,20 +30,30 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int FOLDER_HASH = HashingUtils::HashString("FOLDER");
-        static const int DOCUMENT_HASH = HashingUtils::HashString("DOCUMENT");
+        static constexpr int FOLDER_HASH = HashingUtils::CompileTimeHashString("FOLDER");
+        static constexpr int DOCUMENT_HASH = HashingUtils::CompileTimeHashString("DOCUMENT");
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FOLDER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceType::FOLDER;
-          }
-          else if (hashCode == DOCUMENT_HASH)
-          {
-            return ResourceType::DOCUMENT;
+          case FOLDER_HASH:
+            if (name == "FOLDER")
+            {
+              return ResourceType::FOLDER;
+            }
+            break;
+          case DOCUMENT_HASH:
+            if (name == "DOCUMENT")
+            {
+              return ResourceType::DOCUMENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceType(ResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace RolePermissionTypeMapper
       {
 
-        static const int DIRECT_HASH = HashingUtils::HashString("DIRECT");
-        static const int INHERITED_HASH = HashingUtils::HashString("INHERITED");
+        static constexpr int DIRECT_HASH = HashingUtils::CompileTimeHashString("DIRECT");
+        static constexpr int INHERITED_HASH = HashingUtils::CompileTimeHashString("INHERITED");
 
 
         RolePermissionType GetRolePermissionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == DIRECT_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RolePermissionType::DIRECT;
-          }
-          else if (hashCode == INHERITED_HASH)
-          {
-            return RolePermissionType::INHERITED;
+          case DIRECT_HASH:
+            if (name == "DIRECT")
+            {
+              return RolePermissionType::DIRECT;
+            }
+            break;
+          case INHERITED_HASH:
+            if (name == "INHERITED")
+            {
+              return RolePermissionType::INHERITED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RolePermissionType::NOT_SET;
         }
 
-        Aws::String GetNameForRolePermissionType(RolePermissionType enumValue)
+        const char* GetNameForRolePermissionType(RolePermissionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
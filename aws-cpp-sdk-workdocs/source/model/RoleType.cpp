@@ -30,30 +30,44 @@ namespace Aws
       namespace RoleTypeMapper
       {
 
-        static const int VIEWER_HASH = HashingUtils::HashString("VIEWER");
-        static const int CONTRIBUTOR_HASH = HashingUtils::HashString("CONTRIBUTOR");
-        static const int OWNER_HASH = HashingUtils::HashString("OWNER");
-        static const int COOWNER_HASH = HashingUtils::HashString("COOWNER");
+        static constexpr int VIEWER_HASH = HashingUtils::CompileTimeHashString("VIEWER");
+        static constexpr int CONTRIBUTOR_HASH = HashingUtils::CompileTimeHashString("CONTRIBUTOR");
+        static constexpr int OWNER_HASH = HashingUtils::CompileTimeHashString("OWNER");
+        static constexpr int COOWNER_HASH = HashingUtils::CompileTimeHashString("COOWNER");
 
 
         RoleType GetRoleTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VIEWER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RoleType::VIEWER;
-          }
-          else if (hashCode == CONTRIBUTOR_HASH)
-          {
-            return RoleType::CONTRIBUTOR;
-          }
-          else if (hashCode == OWNER_HASH)
-          {
-            return RoleType::OWNER;
-          }
-          else if (hashCode == COOWNER_HASH)
-          {
-            return RoleType::COOWNER;
+          case VIEWER_HASH:
+            if (name == "VIEWER")
+            {
+              return RoleType::VIEWER;
+            }
+            break;
+          case CONTRIBUTOR_HASH:
+            if (name == "CONTRIBUTOR")
+            {
+              return RoleType::CONTRIBUTOR;
+            }
+            break;
+          case OWNER_HASH:
+            if (name == "OWNER")
+            {
+              return RoleType::OWNER;
+            }
+            break;
+          case COOWNER_HASH:
+            if (name == "COOWNER")
+            {
+              return RoleType::COOWNER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -65,7 +79,7 @@ namespace Aws
           return RoleType::NOT_SET;
         }
 
-        Aws::String GetNameForRoleType(RoleType enumValue)
+        const char* GetNameForRoleType(RoleType enumValue)
         {
           switch(enumValue)
           {
@@ -81,7 +95,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
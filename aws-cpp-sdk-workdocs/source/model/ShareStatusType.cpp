@@ -30,20 +30,30 @@ namespace Aws
       namespace ShareStatusTypeMapper
       {
 
-        static const int SUCCESS_HASH = HashingUtils::HashString("SUCCESS");
-        static const int FAILURE_HASH = HashingUtils::HashString("FAILURE");
+        static constexpr int SUCCESS_HASH = HashingUtils::CompileTimeHashString("SUCCESS");
+        static constexpr int FAILURE_HASH = HashingUtils::CompileTimeHashString("FAILURE");
 
 
         ShareStatusType GetShareStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SUCCESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ShareStatusType::SUCCESS;
-          }
-          else if (hashCode == FAILURE_HASH)
-          {
-            return ShareStatusType::FAILURE;
+          case SUCCESS_HASH:
+            if (name == "SUCCESS")
+            {
+              return ShareStatusType::SUCCESS;
+            }
+            break;
+          case FAILURE_HASH:
+            if (name == "FAILURE")
+            {
+              return ShareStatusType::FAILURE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ShareStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForShareStatusType(ShareStatusType enumValue)
+        const char* GetNameForShareStatusType(ShareStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace StorageTypeMapper
       {
 
-        static const int UNLIMITED_HASH = HashingUtils::HashString("UNLIMITED");
-        static const int QUOTA_HASH = HashingUtils::HashString("QUOTA");
+        static constexpr int UNLIMITED_HASH = HashingUtils::CompileTimeHashString("UNLIMITED");
+        static constexpr int QUOTA_HASH = HashingUtils::CompileTimeHashString("QUOTA");
 
 
         StorageType GetStorageTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UNLIMITED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return StorageType::UNLIMITED;
-          }
-          else if (hashCode == QUOTA_HASH)
-          {
-            return StorageType::QUOTA;
+          case UNLIMITED_HASH:
+            if (name == "UNLIMITED")
+            {
+              return StorageType::UNLIMITED;
+            }
+            break;
+          case QUOTA_HASH:
+            if (name == "QUOTA")
+            {
+              return StorageType::QUOTA;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return StorageType::NOT_SET;
         }
 
-        Aws::String GetNameForStorageType(StorageType enumValue)
+        const char* GetNameForStorageType(StorageType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,15 +30,23 @@ namespace Aws
       namespace SubscriptionProtocolTypeMapper
       {
 
-        static const int HTTPS_HASH = HashingUtils::HashString("HTTPS");
+        static constexpr int HTTPS_HASH = HashingUtils::CompileTimeHashString("HTTPS");
 
 
         SubscriptionProtocolType GetSubscriptionProtocolTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == HTTPS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return SubscriptionProtocolType::HTTPS;
+          case HTTPS_HASH:
+            if (name == "HTTPS")
+            {
+              return SubscriptionProtocolType::HTTPS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -50,7 +58,7 @@ namespace Aws
           return SubscriptionProtocolType::NOT_SET;
         }
 
-        Aws::String GetNameForSubscriptionProtocolType(SubscriptionProtocolType enumValue)
+        const char* GetNameForSubscriptionProtocolType(SubscriptionProtocolType enumValue)
         {
           switch(enumValue)
           {
@@ -60,7 +68,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace UserFilterTypeMapper
       {
 
-        static const int ALL_HASH = HashingUtils::HashString("ALL");
-        static const int ACTIVE_PENDING_HASH = HashingUtils::HashString("ACTIVE_PENDING");
+        static constexpr int ALL_HASH = HashingUtils::CompileTimeHashString("ALL");
+        static constexpr int ACTIVE_PENDING_HASH = HashingUtils::CompileTimeHashString("ACTIVE_PENDING");
 
 
         UserFilterType GetUserFilterTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ALL_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UserFilterType::ALL;
-          }
-          else if (hashCode == ACTIVE_PENDING_HASH)
-          {
-            return UserFilterType::ACTIVE_PENDING;
+          case ALL_HASH:
+            if (name == "ALL")
+            {
+              return UserFilterType::ALL;
+            }
+            break;
+          case ACTIVE_PENDING_HASH:
+            if (name == "ACTIVE_PENDING")
+            {
+              return UserFilterType::ACTIVE_PENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return UserFilterType::NOT_SET;
         }
 
-        Aws::String GetNameForUserFilterType(UserFilterType enumValue)
+        const char* GetNameForUserFilterType(UserFilterType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,35 +30,51 @@ namespace Aws
       namespace UserSortTypeMapper
       {
 
-        static const int USER_NAME_HASH = HashingUtils::HashString("USER_NAME");
-        static const int FULL_NAME_HASH = HashingUtils::HashString("FULL_NAME");
-        static const int STORAGE_LIMIT_HASH = HashingUtils::HashString("STORAGE_LIMIT");
-        static const int USER_STATUS_HASH = HashingUtils::HashString("USER_STATUS");
-        static const int STORAGE_USED_HASH = HashingUtils::HashString("STORAGE_USED");
+        static constexpr int USER_NAME_HASH = HashingUtils::CompileTimeHashString("USER_NAME");
+        static constexpr int FULL_NAME_HASH = HashingUtils::CompileTimeHashString("FULL_NAME");
+        static constexpr int STORAGE_LIMIT_HASH = HashingUtils::CompileTimeHashString("STORAGE_LIMIT");
+        static constexpr int USER_STATUS_HASH = HashingUtils::CompileTimeHashString("USER_STATUS");
+        static constexpr int STORAGE_USED_HASH = HashingUtils::CompileTimeHashString("STORAGE_USED");
 
 
         UserSortType GetUserSortTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_NAME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UserSortType::USER_NAME;
-          }
-          else if (hashCode == FULL_NAME_HASH)
-          {
-            return UserSortType::FULL_NAME;
-          }
-          else if (hashCode == STORAGE_LIMIT_HASH)
-          {
-            return UserSortType::STORAGE_LIMIT;
-          }
-          else if (hashCode == USER_STATUS_HASH)
-          {
-            return UserSortType::USER_STATUS;
-          }
-          else if (hashCode == STORAGE_USED_HASH)
-          {
-            return UserSortType::STORAGE_USED;
+          case USER_NAME_HASH:
+            if (name == "USER_NAME")
+            {
+              return UserSortType::USER_NAME;
+            }
+            break;
+          case FULL_NAME_HASH:
+            if (name == "FULL_NAME")
+            {
+              return UserSortType::FULL_NAME;
+            }
+            break;
+          case STORAGE_LIMIT_HASH:
+            if (name == "STORAGE_LIMIT")
+            {
+              return UserSortType::STORAGE_LIMIT;
+            }
+            break;
+          case USER_STATUS_HASH:
+            if (name == "USER_STATUS")
+            {
+              return UserSortType::USER_STATUS;
+            }
+            break;
+          case STORAGE_USED_HASH:
+            if (name == "STORAGE_USED")
+            {
+              return UserSortType::STORAGE_USED;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return UserSortType::NOT_SET;
         }
 
-        Aws::String GetNameForUserSortType(UserSortType enumValue)
+        const char* GetNameForUserSortType(UserSortType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
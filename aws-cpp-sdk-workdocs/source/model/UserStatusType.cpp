@@ -30,25 +30,37 @@ namespace Aws
       namespace UserStatusTypeMapper
       {
 
-        static const int ACTIVE_HASH = HashingUtils::HashString("ACTIVE");
-        static const int INACTIVE_HASH = HashingUtils::HashString("INACTIVE");
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
+        static constexpr int ACTIVE_HASH = HashingUtils::CompileTimeHashString("ACTIVE");
+        static constexpr int INACTIVE_HASH = HashingUtils::CompileTimeHashString("INACTIVE");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
 
 
         UserStatusType GetUserStatusTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ACTIVE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UserStatusType::ACTIVE;
-          }
-          else if (hashCode == INACTIVE_HASH)
-          {
-            return UserStatusType::INACTIVE;
-          }
-          else if (hashCode == PENDING_HASH)
-          {
-            return UserStatusType::PENDING;
+          case ACTIVE_HASH:
+            if (name == "ACTIVE")
+            {
+              return UserStatusType::ACTIVE;
+            }
+            break;
+          case INACTIVE_HASH:
+            if (name == "INACTIVE")
+            {
+              return UserStatusType::INACTIVE;
+            }
+            break;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return UserStatusType::PENDING;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return UserStatusType::NOT_SET;
         }
 
-        Aws::String GetNameForUserStatusType(UserStatusType enumValue)
+        const char* GetNameForUserStatusType(UserStatusType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
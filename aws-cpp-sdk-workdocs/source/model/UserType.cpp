@@ -30,35 +30,51 @@ namespace Aws
       namespace UserTypeMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int ADMIN_HASH = HashingUtils::HashString("ADMIN");
-        static const int POWERUSER_HASH = HashingUtils::HashString("POWERUSER");
-        static const int MINIMALUSER_HASH = HashingUtils::HashString("MINIMALUSER");
-        static const int WORKSPACESUSER_HASH = HashingUtils::HashString("WORKSPACESUSER");
+        static constexpr int USER_HASH = HashingUtils::CompileTimeHashString("USER");
+        static constexpr int ADMIN_HASH = HashingUtils::CompileTimeHashString("ADMIN");
+        static constexpr int POWERUSER_HASH = HashingUtils::CompileTimeHashString("POWERUSER");
+        static constexpr int MINIMALUSER_HASH = HashingUtils::CompileTimeHashString("MINIMALUSER");
+        static constexpr int WORKSPACESUSER_HASH = HashingUtils::CompileTimeHashString("WORKSPACESUSER");
 
 
         UserType GetUserTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UserType::USER;
-          }
-          else if (hashCode == ADMIN_HASH)
-          {
-            return UserType::ADMIN;
-          }
-          else if (hashCode == POWERUSER_HASH)
-          {
-            return UserType::POWERUSER;
-          }
-          else if (hashCode == MINIMALUSER_HASH)
-          {
-            return UserType::MINIMALUSER;
-          }
-          else if (hashCode == WORKSPACESUSER_HASH)
-          {
-            return UserType::WORKSPACESUSER;
+          case USER_HASH:
+            if (name == "USER")
+            {
+              return UserType::USER;
+            }
+            break;
+          case ADMIN_HASH:
+            if (name == "ADMIN")
+            {
+              return UserType::ADMIN;
+            }
+            break;
+          case POWERUSER_HASH:
+            if (name == "POWERUSER")
+            {
+              return UserType::POWERUSER;
+            }
+            break;
+          case MINIMALUSER_HASH:
+            if (name == "MINIMALUSER")
+            {
+              return UserType::MINIMALUSER;
+            }
+            break;
+          case WORKSPACESUSER_HASH:
+            if (name == "WORKSPACESUSER")
+            {
+              return UserType::WORKSPACESUSER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return UserType::NOT_SET;
         }
 
-        Aws::String GetNameForUserType(UserType enumValue)
+        const char* GetNameForUserType(UserType enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
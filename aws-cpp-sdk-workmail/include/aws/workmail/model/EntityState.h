@@ -35,7 +35,8 @@ namespace EntityStateMapper
 {
 AWS_WORKMAIL_API EntityState GetEntityStateForName(const Aws::String& name);
 
-AWS_WORKMAIL_API Aws::String GetNameForEntityState(EntityState value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKMAIL_API const char* GetNameForEntityState(EntityState value);
 } // namespace EntityStateMapper
 } // namespace Model
 } // namespace WorkMail
@@ -34,7 +34,8 @@ namespace MemberTypeMapper
 {
 AWS_WORKMAIL_API MemberType GetMemberTypeForName(const Aws::String& name);
 
-AWS_WORKMAIL_API Aws::String GetNameForMemberType(MemberType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKMAIL_API const char* GetNameForMemberType(MemberType value);
 } // namespace MemberTypeMapper
 } // namespace Model
 } // namespace WorkMail
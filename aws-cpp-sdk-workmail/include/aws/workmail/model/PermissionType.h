@@ -35,7 +35,8 @@ namespace PermissionTypeMapper
 {
 AWS_WORKMAIL_API PermissionType GetPermissionTypeForName(const Aws::String& name);
 
-AWS_WORKMAIL_API Aws::String GetNameForPermissionType(PermissionType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKMAIL_API const char* GetNameForPermissionType(PermissionType value);
 } // namespace PermissionTypeMapper
 } // namespace Model
 } // namespace WorkMail
@@ -34,7 +34,8 @@ namespace ResourceTypeMapper
 {
 AWS_WORKMAIL_API ResourceType GetResourceTypeForName(const Aws::String& name);
 
-AWS_WORKMAIL_API Aws::String GetNameForResourceType(ResourceType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKMAIL_API const char* GetNameForResourceType(ResourceType value);
 } // namespace ResourceTypeMapper
 } // namespace Model
 } // namespace WorkMail
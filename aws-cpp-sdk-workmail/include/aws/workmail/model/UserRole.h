@@ -35,7 +35,8 @@ namespace UserRoleMapper
 {
 AWS_WORKMAIL_API UserRole GetUserRoleForName(const Aws::String& name);
 
-AWS_WORKMAIL_API Aws::String GetNameForUserRole(UserRole value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKMAIL_API const char* GetNameForUserRole(UserRole value);
 } // namespace UserRoleMapper
 } // namespace Model
 } // namespace WorkMail
@@ -28,22 +28,22 @@ namespace WorkMail
 namespace WorkMailErrorMapper
 {
 
-static const int ORGANIZATION_NOT_FOUND_HASH = HashingUtils::HashString("OrganizationNotFoundException");
-static const int RESERVED_NAME_HASH = HashingUtils::HashString("ReservedNameException");
-static const int ENTITY_NOT_FOUND_HASH = HashingUtils::HashString("EntityNotFoundException");
-static const int DIRECTORY_UNAVAILABLE_HASH = HashingUtils::HashString("DirectoryUnavailableException");
-static const int MAIL_DOMAIN_NOT_FOUND_HASH = HashingUtils::HashString("MailDomainNotFoundException");
-static const int NAME_AVAILABILITY_HASH = HashingUtils::HashString("NameAvailabilityException");
-static const int EMAIL_ADDRESS_IN_USE_HASH = HashingUtils::HashString("EmailAddressInUseException");
-static const int INVALID_PARAMETER_HASH = HashingUtils::HashString("InvalidParameterException");
-static const int INVALID_CONFIGURATION_HASH = HashingUtils::HashString("InvalidConfigurationException");
-static const int ORGANIZATION_STATE_HASH = HashingUtils::HashString("OrganizationStateException");
-static const int ENTITY_ALREADY_REGISTERED_HASH = HashingUtils::HashString("EntityAlreadyRegisteredException");
-static const int MAIL_DOMAIN_STATE_HASH = HashingUtils::HashString("MailDomainStateException");
-static const int INVALID_PASSWORD_HASH = HashingUtils::HashString("InvalidPasswordException");
-static const int ENTITY_STATE_HASH = HashingUtils::HashString("EntityStateException");
-static const int DIRECTORY_SERVICE_AUTHENTICATION_FAILED_HASH = HashingUtils::HashString("DirectoryServiceAuthenticationFailedException");
-static const int UNSUPPORTED_OPERATION_HASH = HashingUtils::HashString("UnsupportedOperationException");
+static constexpr int ORGANIZATION_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("OrganizationNotFoundException");
+static constexpr int RESERVED_NAME_HASH = HashingUtils::CompileTimeHashString("ReservedNameException");
+static constexpr int ENTITY_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("EntityNotFoundException");
+static constexpr int DIRECTORY_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("DirectoryUnavailableException");
+static constexpr int MAIL_DOMAIN_NOT_FOUND_HASH = HashingUtils::CompileTimeHashString("MailDomainNotFoundException");
+static constexpr int NAME_AVAILABILITY_HASH = HashingUtils::CompileTimeHashString("NameAvailabilityException");
+static constexpr int EMAIL_ADDRESS_IN_USE_HASH = HashingUtils::CompileTimeHashString("EmailAddressInUseException");
+static constexpr int INVALID_PARAMETER_HASH = HashingUtils::CompileTimeHashString("InvalidParameterException");
+static constexpr int INVALID_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("InvalidConfigurationException");
+static constexpr int ORGANIZATION_STATE_HASH = HashingUtils::CompileTimeHashString("OrganizationStateException");
+static constexpr int ENTITY_ALREADY_REGISTERED_HASH = HashingUtils::CompileTimeHashString("EntityAlreadyRegisteredException");
+static constexpr int MAIL_DOMAIN_STATE_HASH = HashingUtils::CompileTimeHashString("MailDomainStateException");
+static constexpr int INVALID_PASSWORD_HASH = HashingUtils::CompileTimeHashString("InvalidPasswordException");
+static constexpr int ENTITY_STATE_HASH = HashingUtils::CompileTimeHashString("EntityStateException");
+static constexpr int DIRECTORY_SERVICE_AUTHENTICATION_FAILED_HASH = HashingUtils::CompileTimeHashString("DirectoryServiceAuthenticationFailedException");
+static constexpr int UNSUPPORTED_OPERATION_HASH = HashingUtils::CompileTimeHashString("UnsupportedOperationException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
@@ -30,20 +30,30 @@ namespace Aws
       namespace MemberTypeMapper
       {
 
-        static const int GROUP_HASH = HashingUtils::HashString("GROUP");
-        static const int USER_HASH = HashingUtils::HashString("USER");
+        static constexpr int GROUP_HASH = HashingUtils::CompileTimeHashString("GROUP");
+        static constexpr int USER_HASH = HashingUtils::CompileTimeHashString("USER");
 
 
         MemberType GetMemberTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == GROUP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return MemberType::GROUP;
-          }
-          else if (hashCode == USER_HASH)
-          {
-            return MemberType::USER;
+          case GROUP_HASH:
+            if (name == "GROUP")
+            {
+              return MemberType::GROUP;
+            }
+            break;
+          case USER_HASH:
+            if (name == "USER")
+            {
+              return MemberType::USER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return MemberType::NOT_SET;
         }
 
-        Aws::String GetNameForMemberType(MemberType enumValue)
+        const char* GetNameForMemberType(MemberType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace PermissionTypeMapper
       {
 
-        static const int FULL_ACCESS_HASH = HashingUtils::HashString("FULL_ACCESS");
-        static const int SEND_AS_HASH = HashingUtils::HashString("SEND_AS");
-        static const int SEND_ON_BEHALF_HASH = HashingUtils::HashString("SEND_ON_BEHALF");
+        static constexpr int FULL_ACCESS_HASH = HashingUtils::CompileTimeHashString("FULL_ACCESS");
+        static constexpr int SEND_AS_HASH = HashingUtils::CompileTimeHashString("SEND_AS");
+        static constexpr int SEND_ON_BEHALF_HASH = HashingUtils::CompileTimeHashString("SEND_ON_BEHALF");
 
 
         PermissionType GetPermissionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == FULL_ACCESS_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return PermissionType::FULL_ACCESS;
-          }
-          else if (hashCode == SEND_AS_HASH)
-          {
-            return PermissionType::SEND_AS;
-          }
-          else if (hashCode == SEND_ON_BEHALF_HASH)
-          {
-            return PermissionType::SEND_ON_BEHALF;
+          case FULL_ACCESS_HASH:
+            if (name == "FULL_ACCESS")
+            {
+              return PermissionType::FULL_ACCESS;
+            }
+            break;
+          case SEND_AS_HASH:
+            if (name == "SEND_AS")
+            {
+              return PermissionType::SEND_AS;
+            }
+            break;
+          case SEND_ON_BEHALF_HASH:
+            if (name == "SEND_ON_BEHALF")
+            {
+              return PermissionType::SEND_ON_BEHALF;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return PermissionType::NOT_SET;
         }
 
-        Aws::String GetNameForPermissionType(PermissionType enumValue)
+        const char* GetNameForPermissionType(PermissionType enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ResourceTypeMapper
       {
 
-        static const int ROOM_HASH = HashingUtils::HashString("ROOM");
-        static const int EQUIPMENT_HASH = HashingUtils::HashString("EQUIPMENT");
+        static constexpr int ROOM_HASH = HashingUtils::CompileTimeHashString("ROOM");
+        static constexpr int EQUIPMENT_HASH = HashingUtils::CompileTimeHashString("EQUIPMENT");
 
 
         ResourceType GetResourceTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ROOM_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ResourceType::ROOM;
-          }
-          else if (hashCode == EQUIPMENT_HASH)
-          {
-            return ResourceType::EQUIPMENT;
+          case ROOM_HASH:
+            if (name == "ROOM")
+            {
+              return ResourceType::ROOM;
+            }
+            break;
+          case EQUIPMENT_HASH:
+            if (name == "EQUIPMENT")
+            {
+              return ResourceType::EQUIPMENT;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ResourceType::NOT_SET;
         }
 
-        Aws::String GetNameForResourceType(ResourceType enumValue)
+        const char* GetNameForResourceType(ResourceType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
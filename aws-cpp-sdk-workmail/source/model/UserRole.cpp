@@ -30,25 +30,37 @@ namespace Aws
       namespace UserRoleMapper
       {
 
-        static const int USER_HASH = HashingUtils::HashString("USER");
-        static const int RESOURCE_HASH = HashingUtils::HashString("RESOURCE");
-        static const int SYSTEM_USER_HASH = HashingUtils::HashString("SYSTEM_USER");
+        static constexpr int USER_HASH = HashingUtils::CompileTimeHashString("USER");
+        static constexpr int RESOURCE_HASH = HashingUtils::CompileTimeHashString("RESOURCE");
+        static constexpr int SYSTEM_USER_HASH = HashingUtils::CompileTimeHashString("SYSTEM_USER");
 
 
         UserRole GetUserRoleForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == USER_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return UserRole::USER;
-          }
-          else if (hashCode == RESOURCE_HASH)
-          {
-            return UserRole::RESOURCE;
-          }
-          else if (hashCode == SYSTEM_USER_HASH)
-          {
-            return UserRole::SYSTEM_USER;
+          case USER_HASH:
+            if (name == "USER")
+            {
+              return UserRole::USER;
+            }
+            break;
+          case RESOURCE_HASH:
+            if (name == "RESOURCE")
+            {
+              return UserRole::RESOURCE;
+            }
+            break;
+          case SYSTEM_USER_HASH:
+            if (name == "SYSTEM_USER")
+            {
+              return UserRole::SYSTEM_USER;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return UserRole::NOT_SET;
         }
 
-        Aws::String GetNameForUserRole(UserRole enumValue)
+        const char* GetNameForUserRole(UserRole enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -37,7 +37,8 @@ namespace ComputeMapper
 {
 AWS_WORKSPACES_API Compute GetComputeForName(const Aws::String& name);
 
-AWS_WORKSPACES_API Aws::String GetNameForCompute(Compute value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKSPACES_API const char* GetNameForCompute(Compute value);
 } // namespace ComputeMapper
 } // namespace Model
 } // namespace WorkSpaces
@@ -35,7 +35,8 @@ namespace ConnectionStateMapper
 {
 AWS_WORKSPACES_API ConnectionState GetConnectionStateForName(const Aws::String& name);
 
-AWS_WORKSPACES_API Aws::String GetNameForConnectionState(ConnectionState value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKSPACES_API const char* GetNameForConnectionState(ConnectionState value);
 } // namespace ConnectionStateMapper
 } // namespace Model
 } // namespace WorkSpaces
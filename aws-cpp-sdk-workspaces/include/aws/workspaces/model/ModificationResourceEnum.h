@@ -35,7 +35,8 @@ namespace ModificationResourceEnumMapper
 {
 AWS_WORKSPACES_API ModificationResourceEnum GetModificationResourceEnumForName(const Aws::String& name);
 
-AWS_WORKSPACES_API Aws::String GetNameForModificationResourceEnum(ModificationResourceEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKSPACES_API const char* GetNameForModificationResourceEnum(ModificationResourceEnum value);
 } // namespace ModificationResourceEnumMapper
 } // namespace Model
 } // namespace WorkSpaces
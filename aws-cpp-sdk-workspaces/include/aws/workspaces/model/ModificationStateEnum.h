@@ -34,7 +34,8 @@ namespace ModificationStateEnumMapper
 {
 AWS_WORKSPACES_API ModificationStateEnum GetModificationStateEnumForName(const Aws::String& name);
 
-AWS_WORKSPACES_API Aws::String GetNameForModificationStateEnum(ModificationStateEnum value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKSPACES_API const char* GetNameForModificationStateEnum(ModificationStateEnum value);
 } // namespace ModificationStateEnumMapper
 } // namespace Model
 } // namespace WorkSpaces
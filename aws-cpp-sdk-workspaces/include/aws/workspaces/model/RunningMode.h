@@ -34,7 +34,8 @@ namespace RunningModeMapper
 {
 AWS_WORKSPACES_API RunningMode GetRunningModeForName(const Aws::String& name);
 
-AWS_WORKSPACES_API Aws::String GetNameForRunningMode(RunningMode value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKSPACES_API const char* GetNameForRunningMode(RunningMode value);
 } // namespace RunningModeMapper
 } // namespace Model
 } // namespace WorkSpaces
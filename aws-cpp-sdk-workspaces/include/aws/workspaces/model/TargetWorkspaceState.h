@@ -34,7 +34,8 @@ namespace TargetWorkspaceStateMapper
 {
 AWS_WORKSPACES_API TargetWorkspaceState GetTargetWorkspaceStateForName(const Aws::String& name);
 
-AWS_WORKSPACES_API Aws::String GetNameForTargetWorkspaceState(TargetWorkspaceState value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKSPACES_API const char* GetNameForTargetWorkspaceState(TargetWorkspaceState value);
 } // namespace TargetWorkspaceStateMapper
 } // namespace Model
 } // namespace WorkSpaces
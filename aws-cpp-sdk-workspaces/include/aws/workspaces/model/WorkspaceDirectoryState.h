@@ -37,7 +37,8 @@ namespace WorkspaceDirectoryStateMapper
 {
 AWS_WORKSPACES_API WorkspaceDirectoryState GetWorkspaceDirectoryStateForName(const Aws::String& name);
 
-AWS_WORKSPACES_API Aws::String GetNameForWorkspaceDirectoryState(WorkspaceDirectoryState value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKSPACES_API const char* GetNameForWorkspaceDirectoryState(WorkspaceDirectoryState value);
 } // namespace WorkspaceDirectoryStateMapper
 } // namespace Model
 } // namespace WorkSpaces
@@ -34,7 +34,8 @@ namespace WorkspaceDirectoryTypeMapper
 {
 AWS_WORKSPACES_API WorkspaceDirectoryType GetWorkspaceDirectoryTypeForName(const Aws::String& name);
 
-AWS_WORKSPACES_API Aws::String GetNameForWorkspaceDirectoryType(WorkspaceDirectoryType value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKSPACES_API const char* GetNameForWorkspaceDirectoryType(WorkspaceDirectoryType value);
 } // namespace WorkspaceDirectoryTypeMapper
 } // namespace Model
 } // namespace WorkSpaces
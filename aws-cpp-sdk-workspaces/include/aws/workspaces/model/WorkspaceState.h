@@ -48,7 +48,8 @@ namespace WorkspaceStateMapper
 {
 AWS_WORKSPACES_API WorkspaceState GetWorkspaceStateForName(const Aws::String& name);
 
-AWS_WORKSPACES_API Aws::String GetNameForWorkspaceState(WorkspaceState value);
+// names of values not modeled point into the enum overflow container
+AWS_WORKSPACES_API const char* GetNameForWorkspaceState(WorkspaceState value);
 } // namespace WorkspaceStateMapper
 } // namespace Model
 } // namespace WorkSpaces
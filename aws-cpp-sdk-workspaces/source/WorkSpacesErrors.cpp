@@ -28,16 +28,16 @@ namespace WorkSpaces
 namespace WorkSpacesErrorMapper
 {
 
-static const int OPERATION_NOT_SUPPORTED_HASH = HashingUtils::HashString("OperationNotSupportedException");
-static const int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::HashString("ResourceLimitExceededException");
-static const int RESOURCE_ASSOCIATED_HASH = HashingUtils::HashString("ResourceAssociatedException");
-static const int UNSUPPORTED_WORKSPACE_CONFIGURATION_HASH = HashingUtils::HashString("UnsupportedWorkspaceConfigurationException");
-static const int INVALID_RESOURCE_STATE_HASH = HashingUtils::HashString("InvalidResourceStateException");
-static const int INVALID_PARAMETER_VALUES_HASH = HashingUtils::HashString("InvalidParameterValuesException");
-static const int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::HashString("ResourceAlreadyExistsException");
-static const int RESOURCE_UNAVAILABLE_HASH = HashingUtils::HashString("ResourceUnavailableException");
-static const int OPERATION_IN_PROGRESS_HASH = HashingUtils::HashString("OperationInProgressException");
-static const int RESOURCE_CREATION_FAILED_HASH = HashingUtils::HashString("ResourceCreationFailedException");
+static constexpr int OPERATION_NOT_SUPPORTED_HASH = HashingUtils::CompileTimeHashString("OperationNotSupportedException");
+static constexpr int RESOURCE_LIMIT_EXCEEDED_HASH = HashingUtils::CompileTimeHashString("ResourceLimitExceededException");
+static constexpr int RESOURCE_ASSOCIATED_HASH = HashingUtils::CompileTimeHashString("ResourceAssociatedException");
+static constexpr int UNSUPPORTED_WORKSPACE_CONFIGURATION_HASH = HashingUtils::CompileTimeHashString("UnsupportedWorkspaceConfigurationException");
+static constexpr int INVALID_RESOURCE_STATE_HASH = HashingUtils::CompileTimeHashString("InvalidResourceStateException");
+static constexpr int INVALID_PARAMETER_VALUES_HASH = HashingUtils::CompileTimeHashString("InvalidParameterValuesException");
+static constexpr int RESOURCE_ALREADY_EXISTS_HASH = HashingUtils::CompileTimeHashString("ResourceAlreadyExistsException");
+static constexpr int RESOURCE_UNAVAILABLE_HASH = HashingUtils::CompileTimeHashString("ResourceUnavailableException");
+static constexpr int OPERATION_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("OperationInProgressException");
+static constexpr int RESOURCE_CREATION_FAILED_HASH = HashingUtils::CompileTimeHashString("ResourceCreationFailedException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
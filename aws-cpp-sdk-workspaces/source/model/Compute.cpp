@@ -30,35 +30,51 @@ namespace Aws
       namespace ComputeMapper
       {
 
-        static const int VALUE_HASH = HashingUtils::HashString("VALUE");
-        static const int STANDARD_HASH = HashingUtils::HashString("STANDARD");
-        static const int PERFORMANCE_HASH = HashingUtils::HashString("PERFORMANCE");
-        static const int POWER_HASH = HashingUtils::HashString("POWER");
-        static const int GRAPHICS_HASH = HashingUtils::HashString("GRAPHICS");
+        static constexpr int VALUE_HASH = HashingUtils::CompileTimeHashString("VALUE");
+        static constexpr int STANDARD_HASH = HashingUtils::CompileTimeHashString("STANDARD");
+        static constexpr int PERFORMANCE_HASH = HashingUtils::CompileTimeHashString("PERFORMANCE");
+        static constexpr int POWER_HASH = HashingUtils::CompileTimeHashString("POWER");
+        static constexpr int GRAPHICS_HASH = HashingUtils::CompileTimeHashString("GRAPHICS");
 
 
         Compute GetComputeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == VALUE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return Compute::VALUE;
-          }
-          else if (hashCode == STANDARD_HASH)
-          {
-            return Compute::STANDARD;
-          }
-          else if (hashCode == PERFORMANCE_HASH)
-          {
-            return Compute::PERFORMANCE;
-          }
-          else if (hashCode == POWER_HASH)
-          {
-            return Compute::POWER;
-          }
-          else if (hashCode == GRAPHICS_HASH)
-          {
-            return Compute::GRAPHICS;
+          case VALUE_HASH:
+            if (name == "VALUE")
+            {
+              return Compute::VALUE;
+            }
+            break;
+          case STANDARD_HASH:
+            if (name == "STANDARD")
+            {
+              return Compute::STANDARD;
+            }
+            break;
+          case PERFORMANCE_HASH:
+            if (name == "PERFORMANCE")
+            {
+              return Compute::PERFORMANCE;
+            }
+            break;
+          case POWER_HASH:
+            if (name == "POWER")
+            {
+              return Compute::POWER;
+            }
+            break;
+          case GRAPHICS_HASH:
+            if (name == "GRAPHICS")
+            {
+              return Compute::GRAPHICS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return Compute::NOT_SET;
         }
 
-        Aws::String GetNameForCompute(Compute enumValue)
+        const char* GetNameForCompute(Compute enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ConnectionStateMapper
       {
 
-        static const int CONNECTED_HASH = HashingUtils::HashString("CONNECTED");
-        static const int DISCONNECTED_HASH = HashingUtils::HashString("DISCONNECTED");
-        static const int UNKNOWN_HASH = HashingUtils::HashString("UNKNOWN");
+        static constexpr int CONNECTED_HASH = HashingUtils::CompileTimeHashString("CONNECTED");
+        static constexpr int DISCONNECTED_HASH = HashingUtils::CompileTimeHashString("DISCONNECTED");
+        static constexpr int UNKNOWN_HASH = HashingUtils::CompileTimeHashString("UNKNOWN");
 
 
         ConnectionState GetConnectionStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == CONNECTED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ConnectionState::CONNECTED;
-          }
-          else if (hashCode == DISCONNECTED_HASH)
-          {
-            return ConnectionState::DISCONNECTED;
-          }
-          else if (hashCode == UNKNOWN_HASH)
-          {
-            return ConnectionState::UNKNOWN;
+          case CONNECTED_HASH:
+            if (name == "CONNECTED")
+            {
+              return ConnectionState::CONNECTED;
+            }
+            break;
+          case DISCONNECTED_HASH:
+            if (name == "DISCONNECTED")
+            {
+              return ConnectionState::DISCONNECTED;
+            }
+            break;
+          case UNKNOWN_HASH:
+            if (name == "UNKNOWN")
+            {
+              return ConnectionState::UNKNOWN;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ConnectionState::NOT_SET;
         }
 
-        Aws::String GetNameForConnectionState(ConnectionState enumValue)
+        const char* GetNameForConnectionState(ConnectionState enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,25 +30,37 @@ namespace Aws
       namespace ModificationResourceEnumMapper
       {
 
-        static const int ROOT_VOLUME_HASH = HashingUtils::HashString("ROOT_VOLUME");
-        static const int USER_VOLUME_HASH = HashingUtils::HashString("USER_VOLUME");
-        static const int COMPUTE_TYPE_HASH = HashingUtils::HashString("COMPUTE_TYPE");
+        static constexpr int ROOT_VOLUME_HASH = HashingUtils::CompileTimeHashString("ROOT_VOLUME");
+        static constexpr int USER_VOLUME_HASH = HashingUtils::CompileTimeHashString("USER_VOLUME");
+        static constexpr int COMPUTE_TYPE_HASH = HashingUtils::CompileTimeHashString("COMPUTE_TYPE");
 
 
         ModificationResourceEnum GetModificationResourceEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == ROOT_VOLUME_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ModificationResourceEnum::ROOT_VOLUME;
-          }
-          else if (hashCode == USER_VOLUME_HASH)
-          {
-            return ModificationResourceEnum::USER_VOLUME;
-          }
-          else if (hashCode == COMPUTE_TYPE_HASH)
-          {
-            return ModificationResourceEnum::COMPUTE_TYPE;
+          case ROOT_VOLUME_HASH:
+            if (name == "ROOT_VOLUME")
+            {
+              return ModificationResourceEnum::ROOT_VOLUME;
+            }
+            break;
+          case USER_VOLUME_HASH:
+            if (name == "USER_VOLUME")
+            {
+              return ModificationResourceEnum::USER_VOLUME;
+            }
+            break;
+          case COMPUTE_TYPE_HASH:
+            if (name == "COMPUTE_TYPE")
+            {
+              return ModificationResourceEnum::COMPUTE_TYPE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -60,7 +72,7 @@ namespace Aws
           return ModificationResourceEnum::NOT_SET;
         }
 
-        Aws::String GetNameForModificationResourceEnum(ModificationResourceEnum enumValue)
+        const char* GetNameForModificationResourceEnum(ModificationResourceEnum enumValue)
         {
           switch(enumValue)
           {
@@ -74,7 +86,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace ModificationStateEnumMapper
       {
 
-        static const int UPDATE_INITIATED_HASH = HashingUtils::HashString("UPDATE_INITIATED");
-        static const int UPDATE_IN_PROGRESS_HASH = HashingUtils::HashString("UPDATE_IN_PROGRESS");
+        static constexpr int UPDATE_INITIATED_HASH = HashingUtils::CompileTimeHashString("UPDATE_INITIATED");
+        static constexpr int UPDATE_IN_PROGRESS_HASH = HashingUtils::CompileTimeHashString("UPDATE_IN_PROGRESS");
 
 
         ModificationStateEnum GetModificationStateEnumForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == UPDATE_INITIATED_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return ModificationStateEnum::UPDATE_INITIATED;
-          }
-          else if (hashCode == UPDATE_IN_PROGRESS_HASH)
-          {
-            return ModificationStateEnum::UPDATE_IN_PROGRESS;
+          case UPDATE_INITIATED_HASH:
+            if (name == "UPDATE_INITIATED")
+            {
+              return ModificationStateEnum::UPDATE_INITIATED;
+            }
+            break;
+          case UPDATE_IN_PROGRESS_HASH:
+            if (name == "UPDATE_IN_PROGRESS")
+            {
+              return ModificationStateEnum::UPDATE_IN_PROGRESS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return ModificationStateEnum::NOT_SET;
         }
 
-        Aws::String GetNameForModificationStateEnum(ModificationStateEnum enumValue)
+        const char* GetNameForModificationStateEnum(ModificationStateEnum enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
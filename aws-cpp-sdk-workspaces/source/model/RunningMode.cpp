@@ -30,20 +30,30 @@ namespace Aws
       namespace RunningModeMapper
       {
 
-        static const int AUTO_STOP_HASH = HashingUtils::HashString("AUTO_STOP");
-        static const int ALWAYS_ON_HASH = HashingUtils::HashString("ALWAYS_ON");
+        static constexpr int AUTO_STOP_HASH = HashingUtils::CompileTimeHashString("AUTO_STOP");
+        static constexpr int ALWAYS_ON_HASH = HashingUtils::CompileTimeHashString("ALWAYS_ON");
 
 
         RunningMode GetRunningModeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AUTO_STOP_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return RunningMode::AUTO_STOP;
-          }
-          else if (hashCode == ALWAYS_ON_HASH)
-          {
-            return RunningMode::ALWAYS_ON;
+          case AUTO_STOP_HASH:
+            if (name == "AUTO_STOP")
+            {
+              return RunningMode::AUTO_STOP;
+            }
+            break;
+          case ALWAYS_ON_HASH:
+            if (name == "ALWAYS_ON")
+            {
+              return RunningMode::ALWAYS_ON;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return RunningMode::NOT_SET;
         }
 
-        Aws::String GetNameForRunningMode(RunningMode enumValue)
+        const char* GetNameForRunningMode(RunningMode enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace TargetWorkspaceStateMapper
       {
 
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int ADMIN_MAINTENANCE_HASH = HashingUtils::HashString("ADMIN_MAINTENANCE");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int ADMIN_MAINTENANCE_HASH = HashingUtils::CompileTimeHashString("ADMIN_MAINTENANCE");
 
 
         TargetWorkspaceState GetTargetWorkspaceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == AVAILABLE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return TargetWorkspaceState::AVAILABLE;
-          }
-          else if (hashCode == ADMIN_MAINTENANCE_HASH)
-          {
-            return TargetWorkspaceState::ADMIN_MAINTENANCE;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return TargetWorkspaceState::AVAILABLE;
+            }
+            break;
+          case ADMIN_MAINTENANCE_HASH:
+            if (name == "ADMIN_MAINTENANCE")
+            {
+              return TargetWorkspaceState::ADMIN_MAINTENANCE;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return TargetWorkspaceState::NOT_SET;
         }
 
-        Aws::String GetNameForTargetWorkspaceState(TargetWorkspaceState enumValue)
+        const char* GetNameForTargetWorkspaceState(TargetWorkspaceState enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
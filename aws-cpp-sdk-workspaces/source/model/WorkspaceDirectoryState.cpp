@@ -30,35 +30,51 @@ namespace Aws
       namespace WorkspaceDirectoryStateMapper
       {
 
-        static const int REGISTERING_HASH = HashingUtils::HashString("REGISTERING");
-        static const int REGISTERED_HASH = HashingUtils::HashString("REGISTERED");
-        static const int DEREGISTERING_HASH = HashingUtils::HashString("DEREGISTERING");
-        static const int DEREGISTERED_HASH = HashingUtils::HashString("DEREGISTERED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        static constexpr int REGISTERING_HASH = HashingUtils::CompileTimeHashString("REGISTERING");
+        static constexpr int REGISTERED_HASH = HashingUtils::CompileTimeHashString("REGISTERED");
+        static constexpr int DEREGISTERING_HASH = HashingUtils::CompileTimeHashString("DEREGISTERING");
+        static constexpr int DEREGISTERED_HASH = HashingUtils::CompileTimeHashString("DEREGISTERED");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
 
 
         WorkspaceDirectoryState GetWorkspaceDirectoryStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == REGISTERING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WorkspaceDirectoryState::REGISTERING;
-          }
-          else if (hashCode == REGISTERED_HASH)
-          {
-            return WorkspaceDirectoryState::REGISTERED;
-          }
-          else if (hashCode == DEREGISTERING_HASH)
-          {
-            return WorkspaceDirectoryState::DEREGISTERING;
-          }
-          else if (hashCode == DEREGISTERED_HASH)
-          {
-            return WorkspaceDirectoryState::DEREGISTERED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return WorkspaceDirectoryState::ERROR_;
+          case REGISTERING_HASH:
+            if (name == "REGISTERING")
+            {
+              return WorkspaceDirectoryState::REGISTERING;
+            }
+            break;
+          case REGISTERED_HASH:
+            if (name == "REGISTERED")
+            {
+              return WorkspaceDirectoryState::REGISTERED;
+            }
+            break;
+          case DEREGISTERING_HASH:
+            if (name == "DEREGISTERING")
+            {
+              return WorkspaceDirectoryState::DEREGISTERING;
+            }
+            break;
+          case DEREGISTERED_HASH:
+            if (name == "DEREGISTERED")
+            {
+              return WorkspaceDirectoryState::DEREGISTERED;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return WorkspaceDirectoryState::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -70,7 +86,7 @@ namespace Aws
           return WorkspaceDirectoryState::NOT_SET;
         }
 
-        Aws::String GetNameForWorkspaceDirectoryState(WorkspaceDirectoryState enumValue)
+        const char* GetNameForWorkspaceDirectoryState(WorkspaceDirectoryState enumValue)
         {
           switch(enumValue)
           {
@@ -88,7 +104,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,20 +30,30 @@ namespace Aws
       namespace WorkspaceDirectoryTypeMapper
       {
 
-        static const int SIMPLE_AD_HASH = HashingUtils::HashString("SIMPLE_AD");
-        static const int AD_CONNECTOR_HASH = HashingUtils::HashString("AD_CONNECTOR");
+        static constexpr int SIMPLE_AD_HASH = HashingUtils::CompileTimeHashString("SIMPLE_AD");
+        static constexpr int AD_CONNECTOR_HASH = HashingUtils::CompileTimeHashString("AD_CONNECTOR");
 
 
         WorkspaceDirectoryType GetWorkspaceDirectoryTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == SIMPLE_AD_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WorkspaceDirectoryType::SIMPLE_AD;
-          }
-          else if (hashCode == AD_CONNECTOR_HASH)
-          {
-            return WorkspaceDirectoryType::AD_CONNECTOR;
+          case SIMPLE_AD_HASH:
+            if (name == "SIMPLE_AD")
+            {
+              return WorkspaceDirectoryType::SIMPLE_AD;
+            }
+            break;
+          case AD_CONNECTOR_HASH:
+            if (name == "AD_CONNECTOR")
+            {
+              return WorkspaceDirectoryType::AD_CONNECTOR;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return WorkspaceDirectoryType::NOT_SET;
         }
 
-        Aws::String GetNameForWorkspaceDirectoryType(WorkspaceDirectoryType enumValue)
+        const char* GetNameForWorkspaceDirectoryType(WorkspaceDirectoryType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -30,90 +30,128 @@ namespace Aws
       namespace WorkspaceStateMapper
       {
 
-        static const int PENDING_HASH = HashingUtils::HashString("PENDING");
-        static const int AVAILABLE_HASH = HashingUtils::HashString("AVAILABLE");
-        static const int IMPAIRED_HASH = HashingUtils::HashString("IMPAIRED");
-        static const int UNHEALTHY_HASH = HashingUtils::HashString("UNHEALTHY");
-        static const int REBOOTING_HASH = HashingUtils::HashString("REBOOTING");
-        static const int STARTING_HASH = HashingUtils::HashString("STARTING");
-        static const int REBUILDING_HASH = HashingUtils::HashString("REBUILDING");
-        static const int MAINTENANCE_HASH = HashingUtils::HashString("MAINTENANCE");
-        static const int ADMIN_MAINTENANCE_HASH = HashingUtils::HashString("ADMIN_MAINTENANCE");
-        static const int TERMINATING_HASH = HashingUtils::HashString("TERMINATING");
-        static const int TERMINATED_HASH = HashingUtils::HashString("TERMINATED");
-        static const int SUSPENDED_HASH = HashingUtils::HashString("SUSPENDED");
-        static const int UPDATING_HASH = HashingUtils::HashString("UPDATING");
-        static const int STOPPING_HASH = HashingUtils::HashString("STOPPING");
-        static const int STOPPED_HASH = HashingUtils::HashString("STOPPED");
-        static const int ERROR__HASH = HashingUtils::HashString("ERROR");
+        static constexpr int PENDING_HASH = HashingUtils::CompileTimeHashString("PENDING");
+        static constexpr int AVAILABLE_HASH = HashingUtils::CompileTimeHashString("AVAILABLE");
+        static constexpr int IMPAIRED_HASH = HashingUtils::CompileTimeHashString("IMPAIRED");
+        static constexpr int UNHEALTHY_HASH = HashingUtils::CompileTimeHashString("UNHEALTHY");
+        static constexpr int REBOOTING_HASH = HashingUtils::CompileTimeHashString("REBOOTING");
+        static constexpr int STARTING_HASH = HashingUtils::CompileTimeHashString("STARTING");
+        static constexpr int REBUILDING_HASH = HashingUtils::CompileTimeHashString("REBUILDING");
+        static constexpr int MAINTENANCE_HASH = HashingUtils::CompileTimeHashString("MAINTENANCE");
+        static constexpr int ADMIN_MAINTENANCE_HASH = HashingUtils::CompileTimeHashString("ADMIN_MAINTENANCE");
+        static constexpr int TERMINATING_HASH = HashingUtils::CompileTimeHashString("TERMINATING");
+        static constexpr int TERMINATED_HASH = HashingUtils::CompileTimeHashString("TERMINATED");
+        static constexpr int SUSPENDED_HASH = HashingUtils::CompileTimeHashString("SUSPENDED");
+        static constexpr int UPDATING_HASH = HashingUtils::CompileTimeHashString("UPDATING");
+        static constexpr int STOPPING_HASH = HashingUtils::CompileTimeHashString("STOPPING");
+        static constexpr int STOPPED_HASH = HashingUtils::CompileTimeHashString("STOPPED");
+        static constexpr int ERROR__HASH = HashingUtils::CompileTimeHashString("ERROR");
 
 
         WorkspaceState GetWorkspaceStateForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == PENDING_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return WorkspaceState::PENDING;
-          }
-          else if (hashCode == AVAILABLE_HASH)
-          {
-            return WorkspaceState::AVAILABLE;
-          }
-          else if (hashCode == IMPAIRED_HASH)
-          {
-            return WorkspaceState::IMPAIRED;
-          }
-          else if (hashCode == UNHEALTHY_HASH)
-          {
-            return WorkspaceState::UNHEALTHY;
-          }
-          else if (hashCode == REBOOTING_HASH)
-          {
-            return WorkspaceState::REBOOTING;
-          }
-          else if (hashCode == STARTING_HASH)
-          {
-            return WorkspaceState::STARTING;
-          }
-          else if (hashCode == REBUILDING_HASH)
-          {
-            return WorkspaceState::REBUILDING;
-          }
-          else if (hashCode == MAINTENANCE_HASH)
-          {
-            return WorkspaceState::MAINTENANCE;
-          }
-          else if (hashCode == ADMIN_MAINTENANCE_HASH)
-          {
-            return WorkspaceState::ADMIN_MAINTENANCE;
-          }
-          else if (hashCode == TERMINATING_HASH)
-          {
-            return WorkspaceState::TERMINATING;
-          }
-          else if (hashCode == TERMINATED_HASH)
-          {
-            return WorkspaceState::TERMINATED;
-          }
-          else if (hashCode == SUSPENDED_HASH)
-          {
-            return WorkspaceState::SUSPENDED;
-          }
-          else if (hashCode == UPDATING_HASH)
-          {
-            return WorkspaceState::UPDATING;
-          }
-          else if (hashCode == STOPPING_HASH)
-          {
-            return WorkspaceState::STOPPING;
-          }
-          else if (hashCode == STOPPED_HASH)
-          {
-            return WorkspaceState::STOPPED;
-          }
-          else if (hashCode == ERROR__HASH)
-          {
-            return WorkspaceState::ERROR_;
+          case PENDING_HASH:
+            if (name == "PENDING")
+            {
+              return WorkspaceState::PENDING;
+            }
+            break;
+          case AVAILABLE_HASH:
+            if (name == "AVAILABLE")
+            {
+              return WorkspaceState::AVAILABLE;
+            }
+            break;
+          case IMPAIRED_HASH:
+            if (name == "IMPAIRED")
+            {
+              return WorkspaceState::IMPAIRED;
+            }
+            break;
+          case UNHEALTHY_HASH:
+            if (name == "UNHEALTHY")
+            {
+              return WorkspaceState::UNHEALTHY;
+            }
+            break;
+          case REBOOTING_HASH:
+            if (name == "REBOOTING")
+            {
+              return WorkspaceState::REBOOTING;
+            }
+            break;
+          case STARTING_HASH:
+            if (name == "STARTING")
+            {
+              return WorkspaceState::STARTING;
+            }
+            break;
+          case REBUILDING_HASH:
+            if (name == "REBUILDING")
+            {
+              return WorkspaceState::REBUILDING;
+            }
+            break;
+          case MAINTENANCE_HASH:
+            if (name == "MAINTENANCE")
+            {
+              return WorkspaceState::MAINTENANCE;
+            }
+            break;
+          case ADMIN_MAINTENANCE_HASH:
+            if (name == "ADMIN_MAINTENANCE")
+            {
+              return WorkspaceState::ADMIN_MAINTENANCE;
+            }
+            break;
+          case TERMINATING_HASH:
+            if (name == "TERMINATING")
+            {
+              return WorkspaceState::TERMINATING;
+            }
+            break;
+          case TERMINATED_HASH:
+            if (name == "TERMINATED")
+            {
+              return WorkspaceState::TERMINATED;
+            }
+            break;
+          case SUSPENDED_HASH:
+            if (name == "SUSPENDED")
+            {
+              return WorkspaceState::SUSPENDED;
+            }
+            break;
+          case UPDATING_HASH:
+            if (name == "UPDATING")
+            {
+              return WorkspaceState::UPDATING;
+            }
+            break;
+          case STOPPING_HASH:
+            if (name == "STOPPING")
+            {
+              return WorkspaceState::STOPPING;
+            }
+            break;
+          case STOPPED_HASH:
+            if (name == "STOPPED")
+            {
+              return WorkspaceState::STOPPED;
+            }
+            break;
+          case ERROR__HASH:
+            if (name == "ERROR")
+            {
+              return WorkspaceState::ERROR_;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -125,7 +163,7 @@ namespace Aws
           return WorkspaceState::NOT_SET;
         }
 
-        Aws::String GetNameForWorkspaceState(WorkspaceState enumValue)
+        const char* GetNameForWorkspaceState(WorkspaceState enumValue)
         {
           switch(enumValue)
           {
@@ -165,7 +203,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
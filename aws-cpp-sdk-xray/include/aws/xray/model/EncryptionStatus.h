@@ -34,7 +34,8 @@ namespace EncryptionStatusMapper
 {
 AWS_XRAY_API EncryptionStatus GetEncryptionStatusForName(const Aws::String& name);
 
-AWS_XRAY_API Aws::String GetNameForEncryptionStatus(EncryptionStatus value);
+// names of values not modeled point into the enum overflow container
+AWS_XRAY_API const char* GetNameForEncryptionStatus(EncryptionStatus value);
 } // namespace EncryptionStatusMapper
 } // namespace Model
 } // namespace XRay
@@ -34,7 +34,8 @@ namespace EncryptionTypeMapper
 {
 AWS_XRAY_API EncryptionType GetEncryptionTypeForName(const Aws::String& name);
 
-AWS_XRAY_API Aws::String GetNameForEncryptionType(EncryptionType value);
+// names of values not modeled point into the enum overflow container
+AWS_XRAY_API const char* GetNameForEncryptionType(EncryptionType value);
 } // namespace EncryptionTypeMapper
 } // namespace Model
 } // namespace XRay
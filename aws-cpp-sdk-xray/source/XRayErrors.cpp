@@ -28,8 +28,8 @@ namespace XRay
 namespace XRayErrorMapper
 {
 
-static const int THROTTLED_HASH = HashingUtils::HashString("ThrottledException");
-static const int INVALID_REQUEST_HASH = HashingUtils::HashString("InvalidRequestException");
+static constexpr int THROTTLED_HASH = HashingUtils::CompileTimeHashString("ThrottledException");
+static constexpr int INVALID_REQUEST_HASH = HashingUtils::CompileTimeHashString("InvalidRequestException");
 
 
 AWSError<CoreErrors> GetErrorForName(const char* errorName)
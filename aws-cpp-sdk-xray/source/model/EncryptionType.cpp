@@ -30,20 +30,30 @@ namespace Aws
       namespace EncryptionTypeMapper
       {
 
-        static const int NONE_HASH = HashingUtils::HashString("NONE");
-        static const int KMS_HASH = HashingUtils::HashString("KMS");
+        static constexpr int NONE_HASH = HashingUtils::CompileTimeHashString("NONE");
+        static constexpr int KMS_HASH = HashingUtils::CompileTimeHashString("KMS");
 
 
         EncryptionType GetEncryptionTypeForName(const Aws::String& name)
         {
           int hashCode = HashingUtils::HashString(name.c_str());
-          if (hashCode == NONE_HASH)
+          // the hashes are compile time constants, so this is a jump table or a binary search; a match is confirmed by the name
+          switch (hashCode)
           {
-            return EncryptionType::NONE;
-          }
-          else if (hashCode == KMS_HASH)
-          {
-            return EncryptionType::KMS;
+          case NONE_HASH:
+            if (name == "NONE")
+            {
+              return EncryptionType::NONE;
+            }
+            break;
+          case KMS_HASH:
+            if (name == "KMS")
+            {
+              return EncryptionType::KMS;
+            }
+            break;
+          default:
+            break;
           }
           EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
           if(overflowContainer)
@@ -55,7 +65,7 @@ namespace Aws
           return EncryptionType::NOT_SET;
         }
 
-        Aws::String GetNameForEncryptionType(EncryptionType enumValue)
+        const char* GetNameForEncryptionType(EncryptionType enumValue)
         {
           switch(enumValue)
           {
@@ -67,7 +77,7 @@ namespace Aws
             EnumParseOverflowContainer* overflowContainer = Aws::GetEnumOverflowContainer();
             if(overflowContainer)
             {
-              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue));
+              return overflowContainer->RetrieveOverflow(static_cast<int>(enumValue)).c_str();
             }
 
             return "";
@@ -123,6 +123,12 @@ list(APPEND HIGH_LEVEL_SDK_LIST "queues")
 list(APPEND HIGH_LEVEL_SDK_LIST "transfer") 
 list(APPEND HIGH_LEVEL_SDK_LIST "s3-encryption") 
 list(APPEND HIGH_LEVEL_SDK_LIST "text-to-speech") 
+list(APPEND HIGH_LEVEL_SDK_LIST "kinesis-producer") 
+list(APPEND HIGH_LEVEL_SDK_LIST "kinesis-consumer") 
+list(APPEND HIGH_LEVEL_SDK_LIST "firehose-writer") 
+list(APPEND HIGH_LEVEL_SDK_LIST "logs-shipper") 
+list(APPEND HIGH_LEVEL_SDK_LIST "metric-aggregator") 
+list(APPEND HIGH_LEVEL_SDK_LIST "dynamodb-batch") 
 
 set(SDK_TEST_PROJECT_LIST "")
 list(APPEND SDK_TEST_PROJECT_LIST "cognito-identity:aws-cpp-sdk-cognitoidentity-integration-tests")
@@ -132,11 +138,18 @@ list(APPEND SDK_TEST_PROJECT_LIST "lambda:aws-cpp-sdk-lambda-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "s3:aws-cpp-sdk-s3-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "redshift:aws-cpp-sdk-redshift-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "sqs:aws-cpp-sdk-sqs-integration-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "queues:aws-cpp-sdk-queues-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "transfer:aws-cpp-sdk-transfer-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "s3-encryption:aws-cpp-sdk-s3-encryption-tests,aws-cpp-sdk-s3-encryption-integration-tests")
 list(APPEND SDK_TEST_PROJECT_LIST "ec2:aws-cpp-sdk-ec2-integration-tests")
-list(APPEND SDK_TEST_PROJECT_LIST "core:aws-cpp-sdk-core-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "core:aws-cpp-sdk-core-tests,aws-cpp-sdk-core-benchmarks")
 list(APPEND SDK_TEST_PROJECT_LIST "text-to-speech:aws-cpp-sdk-text-to-speech-tests,aws-cpp-sdk-polly-sample")
+list(APPEND SDK_TEST_PROJECT_LIST "kinesis-producer:aws-cpp-sdk-kinesis-producer-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "kinesis-consumer:aws-cpp-sdk-kinesis-consumer-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "firehose-writer:aws-cpp-sdk-firehose-writer-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "logs-shipper:aws-cpp-sdk-logs-shipper-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "metric-aggregator:aws-cpp-sdk-metric-aggregator-tests")
+list(APPEND SDK_TEST_PROJECT_LIST "dynamodb-batch:aws-cpp-sdk-dynamodb-batch-tests")
 
 set(SDK_DEPENDENCY_LIST "")
 list(APPEND SDK_DEPENDENCY_LIST "access-management:iam,cognito-identity,core")
@@ -145,15 +158,28 @@ list(APPEND SDK_DEPENDENCY_LIST "queues:sqs,core")
 list(APPEND SDK_DEPENDENCY_LIST "transfer:s3,core")
 list(APPEND SDK_DEPENDENCY_LIST "s3-encryption:s3,kms,core")
 list(APPEND SDK_DEPENDENCY_LIST "text-to-speech:polly,core")
+list(APPEND SDK_DEPENDENCY_LIST "kinesis-producer:kinesis,core")
+list(APPEND SDK_DEPENDENCY_LIST "kinesis-consumer:kinesis,core")
+list(APPEND SDK_DEPENDENCY_LIST "firehose-writer:firehose,core")
+list(APPEND SDK_DEPENDENCY_LIST "logs-shipper:logs,core")
+list(APPEND SDK_DEPENDENCY_LIST "metric-aggregator:monitoring,core")
+list(APPEND SDK_DEPENDENCY_LIST "dynamodb-batch:dynamodb,core")
 
 set(TEST_DEPENDENCY_LIST "")
 list(APPEND TEST_DEPENDENCY_LIST "cognito-identity:access-management,iam,core")
 list(APPEND TEST_DEPENDENCY_LIST "identity-management:cognito-identity,sts,core")
 list(APPEND TEST_DEPENDENCY_LIST "lambda:access-management,cognito-identity,iam,kinesis,core")
 list(APPEND TEST_DEPENDENCY_LIST "sqs:access-management,cognito-identity,iam,core")
+list(APPEND TEST_DEPENDENCY_LIST "queues:sqs,core")
 list(APPEND TEST_DEPENDENCY_LIST "transfer:s3,core")
 list(APPEND TEST_DEPENDENCY_LIST "s3-encryption:s3,kms,core")
 list(APPEND TEST_DEPENDENCY_LIST "text-to-speech:polly,core")
+list(APPEND TEST_DEPENDENCY_LIST "kinesis-producer:kinesis,core")
+list(APPEND TEST_DEPENDENCY_LIST "kinesis-consumer:kinesis,core")
+list(APPEND TEST_DEPENDENCY_LIST "firehose-writer:firehose,core")
+list(APPEND TEST_DEPENDENCY_LIST "logs-shipper:logs,core")
+list(APPEND TEST_DEPENDENCY_LIST "metric-aggregator:monitoring,core")
+list(APPEND TEST_DEPENDENCY_LIST "dynamodb-batch:dynamodb,core")
 
 build_sdk_list()
 
@@ -131,7 +131,13 @@ def GetHighLevelSDKDirectories():
     return [ "aws-cpp-sdk-access-management",
              "aws-cpp-sdk-identity-management",
              "aws-cpp-sdk-queues",
-             "aws-cpp-sdk-transfer" ]
+             "aws-cpp-sdk-transfer",
+             "aws-cpp-sdk-kinesis-producer",
+             "aws-cpp-sdk-kinesis-consumer",
+             "aws-cpp-sdk-firehose-writer",
+             "aws-cpp-sdk-logs-shipper",
+             "aws-cpp-sdk-metric-aggregator",
+             "aws-cpp-sdk-dynamodb-batch" ]
 
 def GetAllDirectories():
     return GetCoreDirectories() + GetGeneratedSDKDirectories() + GetTestDirectories() + GetHighLevelSDKDirectories()
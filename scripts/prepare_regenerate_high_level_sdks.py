@@ -27,7 +27,13 @@ highLevelSdkList = [
     "queues", 
     "transfer", 
     "s3-encryption", 
-    "text-to-speech"
+    "text-to-speech",
+    "kinesis-producer",
+    "kinesis-consumer",
+    "firehose-writer",
+    "logs-shipper",
+    "metric-aggregator",
+    "dynamodb-batch"
 ];
 
 def ParseArguments():
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *  http://aws.amazon.com/apache2.0
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#pragma once
+
+#include <aws/external/gtest.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+namespace Testing
+{
+    /**
+     * Service client a mock derives from, overriding the operations the code under test calls. It has empty credentials, so
+     * nothing looks for real ones, and m_lock guards whatever the mock records, since operations are called from any thread.
+     */
+    template<typename ServiceClient>
+    class MockServiceClient : public ServiceClient
+    {
+    public:
+        MockServiceClient() : ServiceClient(Aws::Auth::AWSCredentials("", "")) {}
+
+    protected:
+        mutable std::mutex m_lock;
+    };
+
+    /**
+     * Fixture of the tests of a client that batches entries into requests to a mocked service, e.g. the Firehose writer.
+     * Each test gets a new mock in m_client.
+     */
+    template<typename MockClient>
+    class MockClientTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_client = Aws::MakeShared<MockClient>("MockClientTest");
+        }
+
+        void TearDown() override
+        {
+            m_client = nullptr;
+        }
+
+        /**
+         * Entry data telling entries apart by index, "record 12".
+         */
+        static Aws::Utils::ByteBuffer MakeData(size_t index)
+        {
+            Aws::String data = "record " + Aws::Utils::StringUtils::to_string(index);
+            return Aws::Utils::ByteBuffer(reinterpret_cast<const unsigned char*>(data.c_str()), data.size());
+        }
+
+        static Aws::String ToString(const Aws::Utils::ByteBuffer& data)
+        {
+            return Aws::String(reinterpret_cast<const char*>(data.GetUnderlyingData()), data.GetLength());
+        }
+
+        /**
+         * A partition key, item key or the like telling entries apart by index, "key12".
+         */
+        static Aws::String MakeKey(size_t index)
+        {
+            return "key" + Aws::Utils::StringUtils::to_string(index);
+        }
+
+        std::shared_ptr<MockClient> m_client;
+    };
+
+    /**
+     * MockClientTest of a client reporting what became of each entry through a callback: the fixture sets the callback to
+     * AddResult(), which keeps the results in m_results.
+     */
+    template<typename MockClient, typename Result>
+    class BatchingClientTest : public MockClientTest<MockClient>
+    {
+    protected:
+        void TearDown() override
+        {
+            MockClientTest<MockClient>::TearDown();
+            std::lock_guard<std::mutex> locker(m_resultsLock);
+            m_results.clear();
+        }
+
+        void AddResult(const Result& result)
+        {
+            std::lock_guard<std::mutex> locker(m_resultsLock);
+            m_results.push_back(result);
+        }
+
+        /**
+         * A copy of the results so far, for tests looking at them while the client may still report more.
+         */
+        Aws::Vector<Result> GetResults() const
+        {
+            std::lock_guard<std::mutex> locker(m_resultsLock);
+            return m_results;
+        }
+
+        mutable std::mutex m_resultsLock;
+        Aws::Vector<Result> m_results;
+    };
+} // namespace Testing
+} // namespace Aws